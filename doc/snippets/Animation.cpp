@@ -25,14 +25,19 @@
 */
 
 #include <vector>
+#include <Corrade/Containers/Array.h>
 
 #include "Magnum/Timeline.h"
 #include "Magnum/Math/Bezier.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Quaternion.h"
 #include "Magnum/Math/Packing.h"
+#include "Magnum/Animation/BatchPlayer.h"
 #include "Magnum/Animation/Easing.h"
+#include "Magnum/Animation/PackedQuaternion.h"
 #include "Magnum/Animation/Player.h"
+#include "Magnum/Animation/PoseBlender.h"
+#include "Magnum/Animation/ReduceKeyframes.h"
 
 #define DOXYGEN_ELLIPSIS(...) __VA_ARGS__
 
@@ -258,6 +263,63 @@ timer.advance(timeline.previousFrameTime());
 /* [Player-higher-order-animated-time] */
 }
 
+{
+const Animation::TrackView<Float, Vector3> translation;
+const Animation::TrackView<Float, Quaternion> rotation;
+Float now{};
+/* [BatchPlayer-usage] */
+struct Bone {
+    Vector3 translation;
+    Quaternion rotation;
+    DOXYGEN_ELLIPSIS()
+};
+Containers::Array<Bone> bones{1000};
+
+Animation::BatchPlayer player{bones.size()};
+player
+    .add(translation, Containers::stridedArrayView(bones).slice(&Bone::translation))
+    .add(rotation, Containers::stridedArrayView(bones).slice(&Bone::rotation));
+
+// start all instances at once, or each at a different time
+player.play(now);
+
+// every frame
+player.advance(now);
+/* [BatchPlayer-usage] */
+}
+
+{
+Animation::TrackView<const Float, const Quaternion> walkRotations[2];
+Animation::TrackView<const Float, const Quaternion> waveRotation;
+Animation::TrackView<const Float, const Vector3> breathingScaling;
+Containers::StridedArrayView1D<Vector3> translations;
+Containers::StridedArrayView1D<Quaternion> rotations;
+Containers::StridedArrayView1D<Vector3> scalings;
+Float walkTime{}, waveTime{}, breathingTime{}, waveBlend{};
+/* [PoseBlender-usage] */
+Animation::PoseBlender blender{UnsignedInt(rotations.size())};
+
+/* Full-body walk cycle as the base */
+UnsignedInt walk = blender.addLayer(Animation::BlendMode::Override);
+blender
+    .addRotation(walk, 0, walkRotations[0])
+    .addRotation(walk, 1, walkRotations[1]);
+
+/* Waving with the right arm, faded in and out */
+UnsignedInt wave = blender.addLayer(Animation::BlendMode::Override, 0.0f);
+blender.addRotation(wave, 1, waveRotation);
+
+/* Breathing on top of everything */
+UnsignedInt breathing = blender.addLayer(Animation::BlendMode::Additive);
+blender.addScaling(breathing, 0, breathingScaling);
+
+// every frame, with translations, rotations and scalings being the rest pose
+blender.setLayerWeight(wave, waveBlend);
+const Float times[]{walkTime, waveTime, breathingTime};
+blender.blend(times, translations, rotations, scalings);
+/* [PoseBlender-usage] */
+}
+
 {
 #ifndef CORRADE_MSVC2015_COMPATIBILITY /* Can't call + on lambdas */
 /* [Player-addRawCallback] */
@@ -354,4 +416,26 @@ static_cast<void>(position);
 static_cast<void>(rotation);
 }
 
+{
+/* [reduceKeyframesInPlace] */
+Containers::StridedArrayView1D<Float> keys = DOXYGEN_ELLIPSIS({});
+Containers::StridedArrayView1D<Quaternion> rotations = DOXYGEN_ELLIPSIS({});
+
+/* Drop keyframes that slerp reconstructs with less than 0.1° error */
+std::size_t count = Animation::reduceKeyframesInPlace(keys, rotations,
+    Math::slerpShortestPath, Float(Rad(0.1_degf)));
+
+/* Pack the rest to a third of the original size */
+Containers::Array<Animation::PackedQuaternion> packed{NoInit, count};
+for(std::size_t i = 0; i != count; ++i)
+    packed[i] = Animation::PackedQuaternion{rotations[i]};
+
+Animation::TrackView<const Float, const Animation::PackedQuaternion> track{
+    keys.prefix(count), Containers::arrayView(packed),
+    Animation::slerpShortestPath};
+Quaternion rotation = track.at(DOXYGEN_ELLIPSIS(0.0f));
+/* [reduceKeyframesInPlace] */
+static_cast<void>(rotation);
+}
+
 }
@@ -86,4 +86,23 @@ listener.update({group, someOtherGroup});
 /* [Playable-usage] */
 }
 
+{
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+Scene3D scene;
+/* [PlayableGroup-batched] */
+Audio::Listener3D listener{scene};
+Audio::PlayableGroup3D emitters;
+emitters
+    .setBatched(true)
+    /* Sources farther than this are inaudible anyway */
+    .setCullDistance(50.0f);
+
+// ...
+
+// every frame, only sources that are playing and closer than 50 units get
+// updated
+listener.update({emitters});
+/* [PlayableGroup-batched] */
+}
+
 }
@@ -29,10 +29,19 @@
 #define CORRADE_STATIC_PLUGIN
 
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/PluginManager/Manager.h>
 
 #include "Magnum/Audio/AbstractImporter.h"
+#include "Magnum/Audio/Buffer.h"
 #include "Magnum/Audio/Context.h"
 #include "Magnum/Audio/Extensions.h"
+#include "Magnum/Audio/Source.h"
+#include "Magnum/Audio/SourcePool.h"
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include "Magnum/Audio/BufferCache.h"
+#include "Magnum/Audio/SourceStream.h"
+#endif
 
 using namespace Magnum;
 
@@ -77,4 +86,55 @@ MAGNUM_ASSERT_AUDIO_EXTENSION_SUPPORTED(Audio::Extensions::ALC::SOFTX::HRTF);
 /* [MAGNUM_ASSERT_AUDIO_EXTENSION_SUPPORTED] */
 }
 
+{
+Audio::Buffer explosionBuffer;
+Vector3 explosionPosition, listenerPosition;
+Float timeDelta{};
+/* [SourcePool-usage] */
+Audio::SourcePool pool{32};
+
+// each explosion, may be way more than 32 at a time
+UnsignedInt explosion = pool.addVoice(explosionBuffer, 2.0f);
+pool.setVoicePosition(explosion, explosionPosition);
+
+// each frame, the 32 most important voices get a real source
+pool.update(listenerPosition, timeDelta);
+/* [SourcePool-usage] */
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+{
+Audio::Source source;
+/* [BufferCache-usage] */
+PluginManager::Manager<Audio::AbstractImporter> manager;
+Audio::BufferCache cache{manager, 32*1024*1024};
+
+// while loading a level, decode the sounds in the background
+cache.prefetch("explosion.wav");
+cache.prefetch("footsteps.ogg");
+
+// each frame, upload what got decoded
+cache.update();
+
+// when playing, the buffer is most likely ready already
+if(Audio::Buffer* buffer = cache.get("explosion.wav"))
+    source.setBuffer(buffer).play();
+/* [BufferCache-usage] */
+}
+
+{
+Containers::Pointer<Audio::AbstractImporter> importer;
+/* [SourceStream-usage] */
+importer->openFile("soundtrack.wav");
+
+Audio::Source source;
+Audio::SourceStream stream{source, *importer};
+source.play();
+
+// each frame
+stream.update();
+/* [SourceStream-usage] */
+}
+#endif
+
 }
@@ -24,6 +24,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/TestSuite/Tester.h>
@@ -37,12 +38,15 @@
 #include "Magnum/DebugTools/FrameProfiler.h"
 #include "Magnum/DebugTools/ResourceManager.h"
 #include "Magnum/DebugTools/ObjectRenderer.h"
+#include "Magnum/DebugTools/RendererBatch.h"
 #include "Magnum/DebugTools/TextureImage.h"
 #include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/Renderer.h"
 #include "Magnum/GL/CubeMapTexture.h"
 #include "Magnum/GL/Texture.h"
 #include "Magnum/GL/TextureFormat.h"
 #include "Magnum/Math/Range.h"
+#include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
 #include "Magnum/SceneGraph/Object.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
@@ -50,9 +54,21 @@
 #ifndef MAGNUM_TARGET_GLES
 #include "Magnum/GL/SampleQuery.h"
 #endif
+#if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
+#include "Magnum/DebugTools/OcclusionCuller.h"
+#endif
 #ifndef MAGNUM_TARGET_GLES2
 #include "Magnum/GL/BufferImage.h"
 #endif
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include <Corrade/PluginManager/Manager.h>
+
+#include "Magnum/DebugTools/AsyncReadback.h"
+#include "Magnum/GL/DefaultFramebuffer.h"
+#include "Magnum/Trade/AbstractImageConverter.h"
+#endif
+
+#define DOXYGEN_ELLIPSIS(...) __VA_ARGS__
 
 using namespace Magnum;
 using namespace Magnum::Math::Literals;
@@ -154,6 +170,46 @@ new DebugTools::ObjectRenderer3D{manager, *object, "my", &debugDrawables};
 /* [ObjectRenderer] */
 }
 
+{
+DebugTools::ResourceManager manager;
+SceneGraph::Object<SceneGraph::MatrixTransformation3D>* object{};
+SceneGraph::Camera3D* camera{};
+SceneGraph::DrawableGroup3D debugDrawables;
+Vector3 force;
+/* [RendererBatch] */
+DebugTools::RendererBatch3D batch;
+
+// Attach renderers to the batch, ideally all of them
+(new DebugTools::ObjectRenderer3D{manager, *object, {}, &debugDrawables})
+    ->setBatch(&batch);
+(new DebugTools::ForceRenderer3D{manager, *object, {}, force, {},
+    &debugDrawables})
+    ->setBatch(&batch);
+
+// Each frame, collect the instances and draw them all at once
+camera->draw(debugDrawables);
+batch.draw(*camera);
+/* [RendererBatch] */
+}
+
+#if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
+{
+SceneGraph::Camera3D* camera{};
+SceneGraph::DrawableGroup3D drawables;
+/* [OcclusionCuller] */
+DebugTools::OcclusionCuller culler;
+
+// Object-relative bounding boxes, in the same order as drawables in the group
+Containers::Array<Range3D> boundingBoxes{DOXYGEN_ELLIPSIS()};
+
+// Each frame
+GL::Renderer::enable(GL::Renderer::Feature::DepthTest);
+std::size_t occluded = culler.draw(*camera, drawables, boundingBoxes);
+/* [OcclusionCuller] */
+static_cast<void>(occluded);
+}
+#endif
+
 {
 /* [FrameProfilerGL-usage] */
 DebugTools::FrameProfilerGL _profiler{
@@ -162,6 +218,32 @@ DebugTools::FrameProfilerGL _profiler{
 /* [FrameProfilerGL-usage] */
 }
 
+{
+/* [FrameProfilerGL-gpu-scopes] */
+enum: UnsignedInt { ShadowPass, GBufferPass, PostProcessPass };
+
+DebugTools::FrameProfilerGL profiler{
+    DebugTools::FrameProfilerGL::Value::GpuDuration,
+    {"Shadow pass", "GBuffer pass", "Post-processing"}, 50};
+
+profiler.beginFrame();
+
+profiler.beginGpuScope(ShadowPass);
+// render shadow maps ...
+profiler.endGpuScope(ShadowPass);
+
+profiler.beginGpuScope(GBufferPass);
+// render the GBuffer ...
+profiler.endGpuScope(GBufferPass);
+
+profiler.beginGpuScope(PostProcessPass);
+// post-processing ...
+profiler.endGpuScope(PostProcessPass);
+
+profiler.endFrame();
+/* [FrameProfilerGL-gpu-scopes] */
+}
+
 {
 GL::Texture2D texture;
 Range2Di rect;
@@ -202,6 +284,59 @@ GL::BufferImage2D image = DebugTools::textureSubImage(texture,
 /* [textureSubImage-cubemap-rvalue-buffer] */
 }
 #endif
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+{
+/* [AsyncReadback-usage] */
+DebugTools::AsyncReadback readback;
+
+// Issue the read at the end of a frame, don't wait for it
+UnsignedInt handle = readback.read(GL::defaultFramebuffer,
+    GL::defaultFramebuffer.viewport(), PixelFormat::RGBA8Unorm);
+
+DOXYGEN_ELLIPSIS()
+
+// A few frames later, retrieve the data once the GPU is done
+if(readback.isReady(handle)) {
+    Image2D image = readback.take(handle);
+    DOXYGEN_ELLIPSIS(static_cast<void>(image);)
+}
+/* [AsyncReadback-usage] */
+}
+
+{
+GL::Buffer indirectDraws, visibleInstances;
+/* [AsyncReadback-buffers] */
+DebugTools::AsyncReadback readback;
+
+// Schedule GPU-side copies of all buffers of interest after culling
+UnsignedInt draws = readback.bufferData(indirectDraws);
+UnsignedInt instances = readback.bufferData(visibleInstances);
+
+DOXYGEN_ELLIPSIS()
+
+// Retrieve them once the GPU is done, the buffers may be modified since
+if(readback.isReady(draws) && readback.isReady(instances)) {
+    Containers::Array<char> drawData = readback.takeBuffer(draws);
+    Containers::Array<char> instanceData = readback.takeBuffer(instances);
+    DOXYGEN_ELLIPSIS(static_cast<void>(drawData); static_cast<void>(instanceData);)
+}
+/* [AsyncReadback-buffers] */
+}
+
+{
+/* [AsyncScreenshot-usage] */
+PluginManager::Manager<Trade::AbstractImageConverter> manager;
+DebugTools::AsyncScreenshot screenshot{manager};
+
+// On a key press
+screenshot.capture(GL::defaultFramebuffer, "screenshot.png");
+
+// At the end of every frame, hands finished reads over to the saving thread
+screenshot.update();
+/* [AsyncScreenshot-usage] */
+}
+#endif
 }
 
 struct Foo: TestSuite::Tester {
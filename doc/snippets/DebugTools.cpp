@@ -26,16 +26,21 @@
 
 #include <chrono>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/PluginManager/Manager.h>
+#include <Corrade/Utility/Path.h>
 
 #include "Magnum/Image.h"
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/Timeline.h"
 #include "Magnum/DebugTools/CompareImage.h"
 #include "Magnum/DebugTools/FrameProfiler.h"
+#include "Magnum/DebugTools/ScopeProfiler.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Time.h"
 #include "Magnum/Trade/AbstractImporter.h"
 
 using namespace Magnum;
@@ -102,6 +107,16 @@ CORRADE_COMPARE_WITH(actual.pixels<Color3ub>().flipped<0>(), expected,
     (DebugTools::CompareImage{1.5f, 0.01f}));
 /* [CompareImage-pixels-flip] */
 }
+
+{
+Image2D actual = doProcessing();
+Image2D expected = loadExpectedImage();
+/* [CompareImage-tiles] */
+CORRADE_COMPARE_WITH(actual, expected, (DebugTools::CompareImage{1.5f, 0.01f}
+    .setTileSize({64, 64})
+    .setSsimThreshold(0.98f)));
+/* [CompareImage-tiles] */
+}
 }
 };
 
@@ -167,4 +182,64 @@ DebugTools::FrameProfiler profiler{{
 /* [FrameProfiler-setup-immediate] */
 }
 
+{
+/* [FrameProfiler-setup-timeline] */
+Timeline timeline;
+DebugTools::FrameProfiler profiler{{
+    DebugTools::FrameProfiler::Measurement{"Frame time",
+        DebugTools::FrameProfiler::Units::Nanoseconds,
+        [](void*) {},
+        [](void* state) {
+            return UnsignedLong(Long(static_cast<Timeline*>(state)
+                ->previousFrameDurationNanoseconds()));
+        }, &timeline}
+}, 50};
+
+timeline.start();
+
+// in the draw event
+profiler.beginFrame();
+// ...
+timeline.nextFrame();
+profiler.endFrame();
+/* [FrameProfiler-setup-timeline] */
+}
+
+{
+DebugTools::FrameProfiler profiler;
+auto uploadTelemetry = [](Containers::ArrayView<const char>) {};
+/* [FrameProfiler-histogram] */
+profiler.enableHistogram();
+
+// after a while, for example when a level is finished …
+Debug{} << "Frame time p50:" << profiler.histogramPercentile(0, 50.0f)
+        << "p95:" << profiler.histogramPercentile(0, 95.0f)
+        << "p99:" << profiler.histogramPercentile(0, 99.0f)
+        << "max:" << profiler.histogramMax(0);
+
+uploadTelemetry(profiler.histogramSnapshot());
+profiler.resetHistogram();
+/* [FrameProfiler-histogram] */
+}
+
+{
+/* [ScopeProfiler-usage] */
+DebugTools::ScopeProfiler profiler;
+profiler.setThreadName("main");
+
+for(std::size_t frame = 0; frame != 100; ++frame) {
+    DebugTools::ScopeProfiler::Scope frameScope{profiler, "frame"};
+    {
+        DebugTools::ScopeProfiler::Scope scope{profiler, "update"};
+        // ...
+    } {
+        DebugTools::ScopeProfiler::Scope scope{profiler, "render"};
+        // ...
+    }
+}
+
+Utility::Path::write("trace.json", profiler.chromeTrace());
+/* [ScopeProfiler-usage] */
+}
+
 }
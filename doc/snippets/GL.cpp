@@ -24,18 +24,22 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/ArrayViewStl.h>
 #include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/Reference.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/Containers/Triple.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Path.h>
 
 #include "Magnum/Image.h"
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/TiledImageView.h"
 #include "Magnum/GL/AbstractShaderProgram.h"
 #include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/Context.h"
@@ -49,6 +53,7 @@
 #include "Magnum/GL/Renderbuffer.h"
 #include "Magnum/GL/RenderbufferFormat.h"
 #include "Magnum/GL/Shader.h"
+#include "Magnum/GL/ShaderCompileQueue.h"
 #include "Magnum/GL/Texture.h"
 #include "Magnum/GL/TextureFormat.h"
 #include "Magnum/GL/Version.h"
@@ -74,7 +79,9 @@
 
 #ifndef MAGNUM_TARGET_GLES2
 #include "Magnum/GL/BufferImage.h"
+#include "Magnum/GL/Fence.h"
 #include "Magnum/GL/PrimitiveQuery.h"
+#include "Magnum/GL/RenderPass.h"
 #include "Magnum/GL/TextureArray.h"
 #include "Magnum/GL/TransformFeedback.h"
 #endif
@@ -84,6 +91,8 @@
 #include "Magnum/GL/BufferTextureFormat.h"
 #include "Magnum/GL/CubeMapTextureArray.h"
 #include "Magnum/GL/MultisampleTexture.h"
+#include "Magnum/GL/StreamingBuffer.h"
+#include "Magnum/GL/TextureUploadQueue.h"
 #endif
 
 #ifndef MAGNUM_TARGET_GLES
@@ -480,6 +489,45 @@ MyShader shader{std::move(state)};
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+{
+/* [AbstractShaderProgram-binary-cache] */
+GL::AbstractShaderProgram::setBinaryCache(
+    [](Containers::StringView key, void*) -> Containers::Optional<Containers::Array<char>> {
+        const Containers::String file = Utility::Path::join("shader-cache", key);
+        if(!Utility::Path::exists(file)) return {};
+        return Utility::Path::read(file);
+    },
+    [](Containers::StringView key, Containers::ArrayView<const char> data, void*) {
+        Utility::Path::make("shader-cache");
+        Utility::Path::write(Utility::Path::join("shader-cache", key), data);
+    });
+
+/* Compiled from scratch on the first run, loaded from the cache afterwards */
+Shaders::PhongGL shader;
+/* [AbstractShaderProgram-binary-cache] */
+}
+#endif
+
+{
+/* [ShaderCompileQueue-usage] */
+GL::ShaderCompileQueue<Shaders::PhongGL> queue;
+for(UnsignedInt lightCount: {1, 2, 4, 8})
+    queue.compile(Shaders::PhongGL::Configuration{}
+        .setFlags(Shaders::PhongGL::Flag::DiffuseTexture)
+        .setLightCount(lightCount));
+
+DOXYGEN_ELLIPSIS()
+
+/* Each frame, finalize at most two shaders to keep the frame time stable */
+queue.update(2);
+if(queue.isFinished()) {
+    Shaders::PhongGL shader = queue.release(0);
+    DOXYGEN_ELLIPSIS(static_cast<void>(shader));
+}
+/* [ShaderCompileQueue-usage] */
+}
+
 {
 GL::Framebuffer framebuffer{{}};
 /* [AbstractFramebuffer-read1] */
@@ -580,6 +628,91 @@ GL::Buffer indices{GL::Buffer::TargetHint::ElementArray};
 /* [Buffer-webgl] */
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+{
+struct TransformationUniform {
+    Matrix4 transformationMatrix;
+};
+Containers::ArrayView<const TransformationUniform> objects;
+auto drawObject = [](std::size_t) {};
+/* [StreamingBuffer-usage] */
+GL::StreamingBuffer uniforms{GL::Buffer::TargetHint::Uniform, 64*1024};
+
+/* Each frame */
+for(std::size_t i = 0; i != objects.size(); ++i) {
+    std::size_t offset = uniforms.write(
+        Containers::arrayView(&objects[i], 1),
+        GL::Buffer::uniformOffsetAlignment());
+    uniforms.buffer().bind(GL::Buffer::Target::Uniform, 0,
+        offset, sizeof(TransformationUniform));
+    drawObject(i);
+}
+uniforms.nextFrame();
+/* [StreamingBuffer-usage] */
+}
+
+{
+Containers::ArrayView<const ImageView2D> tiles;
+Containers::ArrayView<const Vector2i> tileOffsets;
+auto useTile = [](std::size_t) {};
+/* [TextureUploadQueue-usage] */
+GL::Texture2D texture;
+texture.setStorage(1, GL::TextureFormat::RGBA8, {4096, 4096});
+
+GL::TextureUploadQueue queue{4*1024*1024};
+
+/* Each frame, upload the tiles and remember their IDs */
+Containers::Array<UnsignedLong> uploads{NoInit, tiles.size()};
+for(std::size_t i = 0; i != tiles.size(); ++i)
+    uploads[i] = queue.upload(texture, 0, tileOffsets[i], tiles[i]);
+queue.nextFrame();
+
+/* Later, the tiles can be used once the GPU is done with the upload */
+for(std::size_t i = 0; i != uploads.size(); ++i)
+    if(queue.isComplete(uploads[i])) useTile(i);
+/* [TextureUploadQueue-usage] */
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+{
+GL::Buffer buffer;
+auto fillBuffer = [](GL::Buffer&) {};
+auto drawUsingBuffer = [](GL::Buffer&) {};
+/* [Fence-usage] */
+drawUsingBuffer(buffer);
+GL::Fence fence;
+
+DOXYGEN_ELLIPSIS()
+
+/* Next frame, modify the buffer only if the GPU is done with it */
+if(fence.isSignaled())
+    fillBuffer(buffer);
+/* [Fence-usage] */
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+{
+GL::Framebuffer framebuffer{{}};
+auto drawScene = []() {};
+/* [RenderPass-usage] */
+/* Color gets cleared and kept, depth gets cleared and then discarded without
+   ever being written to memory */
+GL::RenderPass pass{framebuffer};
+pass.setColorAttachment(0,
+        GL::RenderPass::LoadAction::Clear, GL::RenderPass::StoreAction::Store,
+        0x1f1f1f_rgbf)
+    .setDepthAttachment(
+        GL::RenderPass::LoadAction::Clear, GL::RenderPass::StoreAction::DontCare);
+
+pass.begin();
+drawScene();
+pass.end();
+/* [RenderPass-usage] */
+}
+#endif
+
 #ifndef MAGNUM_TARGET_GLES2
 {
 char data[3];
@@ -1236,6 +1369,22 @@ shader.draw(mesh);
 /* [Mesh-draw] */
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+{
+GL::Buffer vertices[2];
+/* [Mesh-shareVertexFormat] */
+GL::Mesh meshes[2];
+for(std::size_t i = 0; i != 2; ++i) {
+    meshes[i]
+        .shareVertexFormat()
+        .addVertexBuffer(vertices[i], 0,
+            Shaders::PhongGL::Position{},
+            Shaders::PhongGL::Normal{});
+}
+/* [Mesh-shareVertexFormat] */
+}
+#endif
+
 
 {
 /* [Mesh-addVertexBuffer1] */
@@ -1475,6 +1624,31 @@ GL::BufferImage2D image = texture.image(0,
 /* [Texture-image2] */
 }
 
+{
+Containers::ArrayView<const char* const> tileData;
+/* [Texture-sparse] */
+const Vector2i pageSize = GL::Texture2D::virtualPageSize(GL::TextureFormat::RGBA8);
+TiledImageView2D tiles{PixelFormat::RGBA8Unorm, {65536, 65536}, pageSize,
+    tileData};
+
+GL::Texture2D texture;
+texture
+    .setSparse(true)
+    .setStorage(1, GL::TextureFormat::RGBA8, tiles.size());
+
+/* Commit memory only for tiles that are resident and upload them */
+for(Int y = 0; y != tiles.tileCount().y(); ++y) {
+    for(Int x = 0; x != tiles.tileCount().x(); ++x) {
+        if(!tiles.isTileResident({x, y})) continue;
+        const Range2Di range = tiles.tileRange({x, y});
+        texture
+            .commitPages(0, range.min(), range.size())
+            .setSubImage(0, range.min(), tiles.tile({x, y}));
+    }
+}
+/* [Texture-sparse] */
+}
+
 {
 GL::Texture2D texture;
 /* [Texture-compressedImage1] */
@@ -26,6 +26,8 @@
 
 #include "Magnum/Platform/Sdl2Application.h"
 #include "Magnum/Timeline.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector2.h"
 
 using namespace Magnum;
 
@@ -74,6 +76,59 @@ void MyApplication::drawEvent() {
 
 }
 
+namespace B {
+
+struct State {
+    Vector2 position;
+};
+
+class MyApplication: public Platform::Application {
+    public:
+        explicit MyApplication(const Arguments& arguments);
+
+        void drawEvent();
+
+    private:
+        void simulate(State& state, Float step);
+
+        Timeline _timeline;
+        State _previous, _current;
+};
+
+/* [Timeline-fixed-step] */
+MyApplication::MyApplication(const Arguments& arguments):
+    Platform::Application{arguments, NoCreate}
+{
+    DOXYGEN_ELLIPSIS()
+
+    // Advance the physics 60 times a second, regardless of the framerate
+    _timeline.setFixedTimeStep(1.0f/60.0f);
+    _timeline.start();
+}
+
+void MyApplication::drawEvent() {
+    for(UnsignedInt i = 0; i != _timeline.fixedStepCount(); ++i) {
+        _previous = _current;
+        simulate(_current, _timeline.fixedTimeStep());
+    }
+
+    // Interpolate between the last two simulation steps to render a smooth
+    // motion
+    Vector2 position = Math::lerp(_previous.position, _current.position,
+        _timeline.fixedStepInterpolation()); DOXYGEN_IGNORE(static_cast<void>(position);)
+
+    // Draw the state ...
+
+    swapBuffers();
+    redraw();
+    _timeline.nextFrame();
+}
+/* [Timeline-fixed-step] */
+
+void MyApplication::simulate(State&, Float) {}
+
+}
+
 /* To prevent macOS ranlib from complaining that there are no symbols. OTOH
    also make sure the name doesn't conflict with any other snippets to avoid
    linker warnings, AND unlike with `int main()` there now has to be a
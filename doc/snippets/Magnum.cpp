@@ -29,9 +29,13 @@
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Image.h"
+#include "Magnum/ImageDataPool.h"
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/VertexFormat.h"
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+#include "Magnum/AsyncResourceLoader.h"
+#endif
 #ifdef MAGNUM_TARGET_GL
 #include "Magnum/ResourceManager.h"
 #include "Magnum/GL/AbstractShaderProgram.h"
@@ -276,6 +280,20 @@ Image2D image{
 /* [Image-usage-alignment] */
 }
 
+{
+/* [ImageDataPool-usage] */
+ImageDataPool pool;
+
+/* Each frame */
+{
+    Vector2i size{512, 256};
+    Image2D image{PixelFormat::RGBA8Unorm, size,
+        pool.allocate(size.product()*4)};
+    DOXYGEN_ELLIPSIS()
+} /* The memory goes back to the pool, next allocation will reuse it */
+/* [ImageDataPool-usage] */
+}
+
 #if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES)
 {
 /* [Image-usage-query] */
@@ -360,6 +378,81 @@ manager.setLoader<GL::Mesh>(std::move(loader));
 Resource<GL::Mesh> myMesh = manager.get<GL::Mesh>("my-mesh");
 /* [AbstractResourceLoader-use] */
 }
+
+{
+using namespace Wew;
+ResourceManager<GL::Mesh> manager;
+Containers::Pointer<MeshResourceLoader> loaderPtr{InPlaceInit};
+MeshResourceLoader& loader = *loaderPtr;
+manager.setLoader<GL::Mesh>(std::move(loaderPtr));
+/* [AbstractResourceLoader-prefetch] */
+// The combined mesh needs both parts to be loaded first
+loader.addDependency("combined", "part-a");
+loader.addDependency("combined", "part-b");
+
+// Request everything needed by the level upfront, no Resource references
+// are needed for that
+loader.prefetch({"combined", "terrain", "sky"});
+/* [AbstractResourceLoader-prefetch] */
+}
+#endif
+
+{
+/* [ResourceManager-memory-budget] */
+ResourceManager<Image2D> manager;
+
+// Keep at most 256 MB of images around
+manager.setMemoryBudget<Image2D>(256*1024*1024);
+
+Image2D image = DOXYGEN_ELLIPSIS(Image2D{PixelFormat::RGBA8Unorm, {}, {}});
+const std::size_t size = image.data().size();
+manager.set("image.png", Containers::pointer<Image2D>(std::move(image)),
+    ResourceDataState::Final, ResourcePolicy::Cached, size);
+/* [ResourceManager-memory-budget] */
+}
+
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+{
+/* [AsyncResourceLoader-usage] */
+ResourceManager<Image2D> manager;
+
+Containers::Pointer<AsyncResourceLoader<Image2D>> loaderPtr{InPlaceInit,
+    [](ResourceKey key, void*) -> Containers::Pointer<Image2D> {
+        // Open and decode the image corresponding to the key, return nullptr
+        // if it's not found ...
+        DOXYGEN_ELLIPSIS(static_cast<void>(key); return {};)
+    }, nullptr};
+AsyncResourceLoader<Image2D>& loader = *loaderPtr;
+manager.setLoader<Image2D>(std::move(loaderPtr));
+
+// Requests the image, which starts loading it on a worker thread
+Resource<Image2D> image = manager.get<Image2D>("image.png");
+
+// Then, every frame, publish what finished loading so far
+loader.update();
+if(image.state() == ResourceState::Final) {
+    // Use the image ...
+}
+/* [AsyncResourceLoader-usage] */
+}
+
+{
+ResourceManager<Image2D> manager;
+Containers::Pointer<AsyncResourceLoader<Image2D>> loaderPtr{InPlaceInit,
+    [](ResourceKey, void*) -> Containers::Pointer<Image2D> { return {}; },
+    nullptr};
+AsyncResourceLoader<Image2D>& loader = *loaderPtr;
+manager.setLoader<Image2D>(std::move(loaderPtr));
+/* [AsyncResourceLoader-dependencies] */
+// A material image combining a diffuse and a normal map
+loader.addDependency("brick-combined", "brick-diffuse");
+loader.addDependency("brick-combined", "brick-normal");
+
+// Load everything for the level at once. The diffuse and normal maps of all
+// materials load in parallel, each combined image only after both its parts.
+loader.prefetch({"brick-combined", "wood-combined", "sky"});
+/* [AsyncResourceLoader-dependencies] */
+}
 #endif
 
 {
@@ -37,6 +37,7 @@
 #include "Magnum/Math/Range.h"
 #include "Magnum/Math/Swizzle.h"
 #include "Magnum/Math/Time.h"
+#include "Magnum/Math/VectorSoA.h"
 #include "Magnum/Math/Algorithms/GramSchmidt.h"
 
 #define DOXYGEN_ELLIPSIS(...) __VA_ARGS__
@@ -836,6 +837,16 @@ if(!(b < a - epsilon || a + epsilon < b)) {
 /* [BitVector-boolean] */
 }
 
+{
+/* [BitVector-iteration] */
+Math::BitVector<4096> visible = DOXYGEN_ELLIPSIS({});
+
+for(std::size_t i = visible.firstSet(); i != visible.Size; i = visible.nextSet(i + 1)) {
+    // draw object i
+}
+/* [BitVector-iteration] */
+}
+
 {
 /* [Color3] */
 Color3 a{1.0f, 0.2f, 0.4f};
@@ -1440,4 +1451,18 @@ Matrix4::scaling(Vector3::xScale(-2.0f));
 /* [Vector3-xScale] */
 }
 
+{
+/* [VectorSoA] */
+Containers::StridedArrayView1D<Vector3> positions = DOXYGEN_ELLIPSIS({});
+
+/* Deinterleave the positions, process each component separately */
+Vector3SoA soa{positions};
+for(Float& y: soa.y())
+    y = Math::max(y, 0.0f);
+
+/* Put the result back */
+soa.copyInto(positions);
+/* [VectorSoA] */
+}
+
 }
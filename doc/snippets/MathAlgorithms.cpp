@@ -26,13 +26,17 @@
 
 #include <numeric>
 #include <vector>
-#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Algorithms/KahanSum.h"
 #include "Magnum/Math/Algorithms/Svd.h"
+#include "Magnum/Math/Algorithms/SvdBatch.h"
 #include "Magnum/Math/Packing.h"
 
+#define DOXYGEN_ELLIPSIS(...) __VA_ARGS__
+
 using namespace Magnum;
 using namespace Magnum::Math::Literals;
 
@@ -62,6 +66,23 @@ for(UnsignedByte pixel: pixels) {
 /* [kahanSum-iterative] */
 }
 
+{
+/* [kahanSumChunked] */
+Containers::StridedArrayView1D<const Float> areas = DOXYGEN_ELLIPSIS({});
+
+/* The chunks can be summed on different threads in any order, for example by
+   distributing the loop iterations to a thread pool */
+Containers::Array<Float> partials{NoInit,
+    Math::Algorithms::kahanSumChunkCount(areas.size())};
+for(std::size_t i = 0; i != partials.size(); ++i)
+    partials[i] = Math::Algorithms::kahanSumChunk(areas, i);
+
+/* Same as Math::Algorithms::kahanSumChunked(areas) */
+Float total = Math::Algorithms::kahanSumPartials<Float>(partials);
+/* [kahanSumChunked] */
+static_cast<void>(total);
+}
+
 {
 enum: std::size_t { cols = 3, rows = 4 };
 /* [svd] */
@@ -85,4 +106,20 @@ Math::RectangularMatrix<cols, rows, Double> w =
 static_cast<void>(w);
 }
 
+{
+/* [svdInto] */
+Containers::StridedArrayView1D<const Matrix3x3> deformations = DOXYGEN_ELLIPSIS({});
+
+Containers::Array<Matrix3x3> u{NoInit, deformations.size()};
+Containers::Array<Vector3> w{NoInit, deformations.size()};
+Containers::Array<Matrix3x3> v{NoInit, deformations.size()};
+Math::Algorithms::svdInto(deformations, u, w, v);
+
+/* Rotation closest to each deformation matrix */
+Containers::Array<Matrix3x3> rotations{NoInit, deformations.size()};
+for(std::size_t i = 0; i != deformations.size(); ++i)
+    rotations[i] = u[i]*v[i].transposed();
+/* [svdInto] */
+}
+
 }
@@ -39,6 +39,9 @@
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/Primitives/Cube.h"
 #include "Magnum/Trade/MeshData.h"
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+#include "Magnum/ThreadPool.h"
+#endif
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 #define _MAGNUM_NO_DEPRECATED_COMBINEINDEXEDARRAYS
@@ -84,6 +87,18 @@ Containers::Pair<Containers::Array<char>, MeshIndexType> compressed =
 /* [compressIndices-offset] */
 }
 
+{
+Trade::MeshData mesh{MeshPrimitive::Points, 0};
+/* [compressIndicesInto] */
+MeshIndexType type = MeshTools::compressedIndexType(mesh.indices());
+Containers::Array<char> out{NoInit,
+    mesh.indexCount()*meshIndexTypeSize(type)};
+MeshTools::compressIndicesInto(mesh.indices(),
+    Containers::StridedArrayView2D<char>{out,
+        {mesh.indexCount(), meshIndexTypeSize(type)}});
+/* [compressIndicesInto] */
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 {
 CORRADE_IGNORE_DEPRECATED_PUSH
@@ -200,4 +215,39 @@ MeshTools::transformPointsInPlace(transformation, points);
 /* [transformPoints] */
 }
 
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+{
+Containers::StridedArrayView1D<const UnsignedInt> indices;
+Containers::StridedArrayView1D<const Vector3> positions;
+/* [ThreadPool-usage] */
+/* Created once by the application and shared by all algorithms */
+ThreadPool pool;
+
+DOXYGEN_ELLIPSIS()
+Containers::Array<Vector3> normals = MeshTools::generateSmoothNormals(
+    indices, positions, ThreadPool::parallelFor, &pool);
+/* [ThreadPool-usage] */
+}
+#endif
+
+{
+Containers::StridedArrayView1D<const UnsignedInt> indices;
+Containers::StridedArrayView1D<const Vector3> positions;
+/* [ThreadPool-custom] */
+struct JobSystem { DOXYGEN_ELLIPSIS() } jobs;
+
+MeshTools::ParallelFor parallelFor = [](void* state, std::size_t count,
+    void(*task)(void*, std::size_t), void* taskState)
+{
+    JobSystem& jobs = *static_cast<JobSystem*>(state);
+    /* Dispatch task(taskState, i) for all i in [0, count) to the job system
+       and wait until all of them finish ... */
+    DOXYGEN_ELLIPSIS(static_cast<void>(jobs); for(std::size_t i = 0; i != count; ++i) task(taskState, i);)
+};
+
+Containers::Array<Vector3> normals = MeshTools::generateSmoothNormals(
+    indices, positions, parallelFor, &jobs);
+/* [ThreadPool-custom] */
+}
+
 }
@@ -0,0 +1,51 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Utility/Debug.h>
+#include <Magnum/Platform/WindowlessEglApplication.h>
+
+using namespace Magnum;
+
+/* In this case `int main()` won't conflict with any other snippets as the
+   source is compiled into a standalone static library */
+/* [WindowlessEglContextPool] */
+int main() {
+    Platform::WindowlessEglContextPool pool;
+    Debug{} << "Rendering on" << pool.contextCount() << "devices";
+
+    for(std::size_t i = 0; i != 100; ++i)
+        pool.submit([](UnsignedInt device, void* state) {
+            /* GL::Context::current() is the context on given device here */
+            std::size_t frame = reinterpret_cast<std::size_t>(state);
+            Debug{} << "Rendering frame" << frame << "on device" << device;
+
+            // Render and read back the frame ...
+        }, reinterpret_cast<void*>(i));
+
+    /* Block until all jobs are done */
+    pool.wait();
+}
+/* [WindowlessEglContextPool] */
@@ -25,11 +25,44 @@
 */
 
 #include <thread>
+#include <Magnum/ImageView.h>
+#include <Magnum/GL/Texture.h>
+#include <Magnum/GL/TextureFormat.h>
 #include <Magnum/Platform/WindowlessEglApplication.h>
 #include <Magnum/Platform/GLContext.h>
+#include <Magnum/Platform/SharedGLContextThread.h>
 
 using namespace Magnum;
 
+namespace A {
+
+void foo(const ImageView2D& image);
+/* [SharedGLContextThread] */
+void foo(const ImageView2D& image) {
+    /* Called on the render thread with the application context current */
+    Platform::SharedGLContextThread<Platform::WindowlessGLContext> uploader;
+
+    struct Upload {
+        ImageView2D image;
+        GL::Texture2D texture{NoCreate};
+    } upload{image};
+    uploader.submit([](void* state) {
+        Upload& upload = *static_cast<Upload*>(state);
+        upload.texture = GL::Texture2D{};
+        upload.texture
+            .setStorage(1, GL::TextureFormat::RGBA8, upload.image.size())
+            .setSubImage(0, {}, upload.image);
+    }, &upload);
+
+    // Render other things meanwhile ...
+
+    /* The texture is now ready to be used on the render thread */
+    uploader.wait();
+}
+/* [SharedGLContextThread] */
+
+}
+
 /* In this case `int main()` won't conflict with any other snippets as the
    source is compiled into a standalone static library */
 /* [thread] */
@@ -395,3 +395,26 @@ void MyApplication::pointerMoveEvent(PointerMoveEvent& event) {
 /* [TwoFingerGesture] */
 
 }
+
+#include <SDL_events.h>
+
+namespace L {
+
+struct MyApplication: Platform::Application {
+    void pointerMoveEvent(PointerMoveEvent& event) override;
+
+    void addStrokePoint(const Vector2&) {}
+};
+
+/* [Sdl2Application-coalescing] */
+void MyApplication::pointerMoveEvent(PointerMoveEvent& event) {
+    /* Add all positions the mouse went through to a stroke, not just the
+       last one */
+    for(const SDL_Event& e: event.coalescedEvents())
+        addStrokePoint({Float(e.motion.x), Float(e.motion.y)});
+
+    DOXYGEN_ELLIPSIS()
+}
+/* [Sdl2Application-coalescing] */
+
+}
@@ -24,9 +24,14 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/StridedArrayView.h>
+
 #include "Magnum/Math/Color.h"
 #include "Magnum/Primitives/Gradient.h"
 #include "Magnum/Primitives/Line.h"
+#include "Magnum/Primitives/MeshCache.h"
+#include "Magnum/Primitives/Static.h"
+#include "Magnum/Primitives/UVSphere.h"
 #include "Magnum/Trade/MeshData.h"
 
 using namespace Magnum;
@@ -68,4 +73,43 @@ Primitives::line2D({0.0f, 0.0f}, {1.0f, 0.0f});
 Primitives::line3D({0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f});
 /* [line3D-identity] */
 }
+
+{
+void drawDebugSphere(const Trade::MeshData&);
+/* [MeshCache] */
+Primitives::MeshCache cache;
+
+/* Generated on the first iteration, taken from the cache on the others */
+for(std::size_t i = 0; i != 100; ++i)
+    drawDebugSphere(cache.uvSphereSolid(8, 16));
+/* [MeshCache] */
+}
+
+{
+/* [circle3DSolid-static] */
+/* Data for a 32-segment circle with texture coordinates, filled into static
+   memory on the first call */
+Trade::MeshData circle = Primitives::circle3DSolid<32,
+    Primitives::Circle3DFlag::TextureCoordinates>();
+/* [circle3DSolid-static] */
+}
+
+{
+struct Vertex {
+    Vector3 position;
+    Vector3 normal;
+};
+Containers::ArrayView<UnsignedInt> mappedIndices;
+Containers::ArrayView<Vertex> mappedVertices;
+/* [uvSphereSolidInto] */
+/* mappedIndices and mappedVertices point to memory such as mapped GPU
+   buffers, sized to uvSphereSolidIndexCount(8, 16) and
+   uvSphereSolidVertexCount(8, 16). Generate straight into the interleaved
+   layout, without tangents and texture coordinates. */
+Containers::StridedArrayView1D<Vertex> vertices = mappedVertices;
+Primitives::uvSphereSolidInto(8, 16, mappedIndices,
+    vertices.slice(&Vertex::position),
+    vertices.slice(&Vertex::normal), nullptr, nullptr);
+/* [uvSphereSolidInto] */
+}
 }
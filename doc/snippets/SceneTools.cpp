@@ -37,6 +37,7 @@
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/SceneTools/Filter.h"
 #include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/SceneTools/Instances.h"
 #include "Magnum/Trade/SceneData.h"
 #include "Magnum/Trade/MeshData.h"
 
@@ -165,4 +166,32 @@ for(const Containers::Pair<UnsignedInt, Int>& parent:
 }
 /* [parentsBreadthFirst-transformations] */
 }
+
+{
+/* [meshInstanceTransformations3D] */
+Trade::SceneData scene = DOXYGEN_ELLIPSIS(Trade::SceneData{{}, 0, nullptr, {}});
+
+Containers::Pair<
+    Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>,
+    Containers::Array<Matrix4>> instances =
+        SceneTools::meshInstanceTransformations3D(scene);
+Debug{} << "Draw count reduced from" << instances.second().size() << "to"
+    << instances.first().size();
+
+std::size_t offset = 0;
+for(const Containers::Triple<UnsignedInt, Int, UnsignedInt>& group:
+    instances.first())
+{
+    Containers::ArrayView<const Matrix4> transformations =
+        instances.second().sliceSize(offset, group.third());
+
+    /* Upload transformations and normal matrices to an instance buffer, set
+       up material group.second() and draw group.third() instances of mesh
+       group.first() with Shaders::PhongGL::Flag::InstancedTransformation */
+    DOXYGEN_ELLIPSIS(static_cast<void>(transformations);)
+
+    offset += group.third();
+}
+/* [meshInstanceTransformations3D] */
+}
 }
@@ -125,6 +125,46 @@ Containers::Optional<Containers::Array<char>> spirv =
 /* [AbstractConverter-usage-compilation] */
 }
 
+{
+PluginManager::Manager<ShaderTools::AbstractConverter> manager;
+Containers::StringView glsl;
+/* [AbstractConverter-usage-cache] */
+Containers::Pointer<ShaderTools::AbstractConverter> converter =
+    manager.loadAndInstantiate("GlslToSpirvShaderConverter");
+converter->setCacheDirectory("build/shader-cache");
+
+/* The first run compiles the shader, later runs with the same source and
+   definitions load it from the cache */
+converter->setDefinitions({{"TEXTURED", ""}});
+Containers::Optional<Containers::Array<char>> spirv =
+    converter->convertDataToData(ShaderTools::Stage::Fragment, glsl);
+/* [AbstractConverter-usage-cache] */
+}
+
+{
+PluginManager::Manager<ShaderTools::AbstractConverter> manager;
+Containers::StringView glsl;
+/* [AbstractConverter-usage-specialization] */
+Containers::Pointer<ShaderTools::AbstractConverter> converter =
+    manager.loadAndInstantiate("GlslToSpirvShaderConverter");
+
+/* Instead of a module per light count and texturing combination, a single
+   module with LIGHT_COUNT and TEXTURED being specialization constants 0 and 1,
+   defaulting to 3 and false */
+converter->setDefinitions({
+    {"LIGHT_COUNT", "3"},
+    {"TEXTURED", "0"}
+});
+converter->setSpecializationConstants({
+    {"LIGHT_COUNT", 0},
+    {"TEXTURED", 1}
+});
+converter->setOptimizationLevel("1");
+Containers::Optional<Containers::Array<char>> spirv =
+    converter->convertDataToData(ShaderTools::Stage::Fragment, glsl);
+/* [AbstractConverter-usage-specialization] */
+}
+
 {
 /* -Wnonnull in GCC 11+  "helpfully" says "this is null" if I don't initialize
    the converter pointer. I don't care, I just want you to check compilation
@@ -29,6 +29,7 @@
 #include <Corrade/Containers/ArrayViewStl.h>
 #include <Corrade/Containers/Iterable.h>
 #include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Utility/Format.h>
 
@@ -51,21 +52,27 @@
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/MaterialTools/CompileUniforms.h"
 #include "Magnum/MeshTools/Compile.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/MeshTools/GenerateLines.h"
+#include "Magnum/SceneTools/DrawList.h"
 #include "Magnum/Shaders/DistanceFieldVectorGL.h"
 #include "Magnum/Shaders/FlatGL.h"
 #include "Magnum/Shaders/MeshVisualizerGL.h"
 #include "Magnum/Shaders/PhongGL.h"
+#include "Magnum/Shaders/ShaderCacheGL.h"
 #include "Magnum/Shaders/VectorGL.h"
 #include "Magnum/Shaders/VertexColorGL.h"
 #include "Magnum/Trade/LightData.h"
+#include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
 #include "Magnum/Trade/SkinData.h"
 
 #ifndef MAGNUM_TARGET_GLES2
 #include "Magnum/GL/TextureArray.h"
+#include "Magnum/GL/TransformFeedback.h"
 #include "Magnum/Primitives/Circle.h"
 #include "Magnum/MeshTools/CompileLines.h"
 #include "Magnum/Shaders/DistanceFieldVector.h"
@@ -75,9 +82,20 @@
 #include "Magnum/Shaders/LineGL.h"
 #include "Magnum/Shaders/MeshVisualizer.h"
 #include "Magnum/Shaders/Phong.h"
+#include "Magnum/Shaders/SkinningGL.h"
 #include "Magnum/Shaders/Vector.h"
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/GL/BufferTexture.h"
+#include "Magnum/GL/BufferTextureFormat.h"
+#include "Magnum/GL/StreamingBuffer.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Shaders/DrawBatchGL.h"
+#include "Magnum/Shaders/FrustumCullingGL.h"
+#include "Magnum/Shaders/LightClusterGrid.h"
+#endif
+
 #define DOXYGEN_ELLIPSIS(...) __VA_ARGS__
 
 using namespace Magnum;
@@ -399,6 +417,225 @@ shader
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+{
+GL::Mesh mesh;
+Matrix4 projectionMatrix, cameraMatrix;
+UnsignedInt instanceCount{};
+/* [FrustumCullingGL-usage] */
+/* Transformation, normal matrix, tightly packed, and a bounding sphere for
+   each instance */
+GL::Buffer instances, bounds;
+DOXYGEN_ELLIPSIS()
+
+/* Output buffer of the same size as the input and an indexed draw command */
+GL::Buffer outputInstances{GL::Buffer::TargetHint::ShaderStorage};
+outputInstances.setData({nullptr, std::size_t(instances.size())});
+GL::Buffer drawCommand{GL::Buffer::TargetHint::DrawIndirect};
+mesh.addVertexBufferInstanced(outputInstances, 1, 0,
+    Shaders::PhongGL::TransformationMatrix{},
+    Shaders::PhongGL::NormalMatrix{});
+
+Shaders::FrustumCullingGL culling;
+culling
+    .setInstanceStride(sizeof(Matrix4) + sizeof(Matrix3x3))
+    .bindInstanceBuffer(instances)
+    .bindBoundsBuffer(bounds)
+    .bindOutputInstanceBuffer(outputInstances)
+    .bindDrawCommandBuffer(drawCommand);
+
+/* Each frame, reset the instance count, cull and draw */
+GL::DrawElementsIndirectCommand command{UnsignedInt(mesh.count()), 0, 0, 0, 0};
+drawCommand.setData({&command, 1});
+culling
+    .setFrustum(Frustum::fromMatrix(projectionMatrix*cameraMatrix))
+    .cull(instanceCount);
+
+Shaders::PhongGL shader{Shaders::PhongGL::Configuration{}
+    .setFlags(Shaders::PhongGL::Flag::InstancedTransformation)};
+shader
+    .setProjectionMatrix(projectionMatrix)
+    .setTransformationMatrix(cameraMatrix)
+    .setNormalMatrix(cameraMatrix.normalMatrix())
+    .draw(mesh, drawCommand, 0, 1);
+/* [FrustumCullingGL-usage] */
+}
+
+{
+Matrix4 projectionMatrix;
+GL::Buffer materials, lights;
+struct Drawable {
+    GL::MeshView mesh;
+    Matrix4 transformation;
+    UnsignedInt materialId;
+};
+Containers::ArrayView<Drawable> drawables;
+/* [DrawBatchGL-usage] */
+Shaders::PhongGL shader{Shaders::PhongGL::Configuration{}
+    .setFlags(Shaders::PhongGL::Flag::MultiDraw)
+    .setMaterialCount(DOXYGEN_ELLIPSIS(16))
+    .setLightCount(DOXYGEN_ELLIPSIS(4))
+    .setDrawCount(Shaders::DrawBatchGL<Shaders::PhongGL>::maxDrawCount())};
+GL::Buffer projection{GL::Buffer::TargetHint::Uniform, {
+    Shaders::ProjectionUniform3D{}.setProjectionMatrix(projectionMatrix)
+}};
+shader
+    .bindProjectionBuffer(projection)
+    .bindMaterialBuffer(materials)
+    .bindLightBuffer(lights);
+
+/* 1 MB for each frame */
+GL::StreamingBuffer buffer{GL::Buffer::TargetHint::Uniform, 1024*1024};
+Shaders::DrawBatchGL<Shaders::PhongGL> batch{shader, buffer};
+
+/* Each frame, add all drawables, draw them in as few batches as possible
+   and advance the streaming buffer */
+for(Drawable& drawable: drawables)
+    batch.add(drawable.mesh,
+        Shaders::TransformationUniform3D{}
+            .setTransformationMatrix(drawable.transformation),
+        Shaders::PhongDrawUniform{}
+            .setNormalMatrix(drawable.transformation.normalMatrix())
+            .setMaterialId(drawable.materialId));
+batch.draw();
+buffer.nextFrame();
+/* [DrawBatchGL-usage] */
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+{
+Trade::SceneData scene = DOXYGEN_ELLIPSIS(Trade::SceneData{{}, 0, nullptr, {}});
+Containers::Array<Trade::MeshData> meshes;
+GL::Buffer projection, materials, lights;
+/* [meshDrawList3D] */
+/* All meshes in a single vertex and index buffer */
+Containers::Array<UnsignedInt> meshCounts{NoInit, meshes.size()};
+Containers::Array<UnsignedInt> meshVertexOffsets{NoInit, meshes.size()};
+Containers::Array<UnsignedInt> meshIndexOffsets{NoInit, meshes.size()};
+GL::Mesh mesh = MeshTools::compile(meshes,
+    meshCounts, meshVertexOffsets, meshIndexOffsets);
+
+/* Material batches are ignored, all materials are just uniforms */
+Containers::Pair<
+    Containers::Array<Containers::Pair<Int, UnsignedInt>>,
+    Containers::Array<Containers::Pair<UnsignedInt, Matrix4>>> drawList =
+        SceneTools::meshDrawList3D(scene);
+const std::size_t drawCount = drawList.second().size();
+
+Shaders::PhongGL shader{Shaders::PhongGL::Configuration{}
+    .setFlags(Shaders::PhongGL::Flag::MultiDraw)
+    .setMaterialCount(DOXYGEN_ELLIPSIS(16))
+    .setLightCount(DOXYGEN_ELLIPSIS(4))
+    .setDrawCount(256)};
+
+/* Per-draw ranges */
+Containers::Array<UnsignedInt> counts{NoInit, drawCount};
+Containers::Array<UnsignedInt> vertexOffsets{NoInit, drawCount};
+Containers::Array<UnsignedInt> indexOffsets{NoInit, drawCount};
+SceneTools::meshDrawRangesInto(stridedArrayView(drawList.second())
+        .slice(&Containers::Pair<UnsignedInt, Matrix4>::first),
+    meshCounts, meshVertexOffsets, meshIndexOffsets,
+    counts, vertexOffsets, indexOffsets);
+
+/* Per-draw uniforms, uploaded just once. Padded to a multiple of the shader
+   draw count as the bound ranges have to cover whole uniform blocks. */
+const std::size_t paddedDrawCount = (drawCount + shader.drawCount() - 1)/
+    shader.drawCount()*shader.drawCount();
+Containers::Array<Shaders::TransformationUniform3D> transformationUniforms{
+    ValueInit, paddedDrawCount};
+Containers::Array<Shaders::PhongDrawUniform> drawUniforms{
+    ValueInit, paddedDrawCount};
+std::size_t i = 0;
+for(const Containers::Pair<Int, UnsignedInt>& batch: drawList.first()) {
+    for(const std::size_t end = i + batch.second(); i != end; ++i) {
+        const Matrix4& transformation = drawList.second()[i].second();
+        transformationUniforms[i].setTransformationMatrix(transformation);
+        drawUniforms[i]
+            .setNormalMatrix(transformation.normalMatrix())
+            .setMaterialId(Math::max(batch.first(), 0));
+    }
+}
+GL::Buffer transformationBuffer{GL::Buffer::TargetHint::Uniform,
+    transformationUniforms};
+GL::Buffer drawBuffer{GL::Buffer::TargetHint::Uniform, drawUniforms};
+
+/* Each frame, draw everything in chunks of the shader draw count */
+shader
+    .bindProjectionBuffer(projection)
+    .bindMaterialBuffer(materials)
+    .bindLightBuffer(lights);
+for(std::size_t offset = 0; offset < drawCount; offset += shader.drawCount()) {
+    const std::size_t size = Math::min(drawCount - offset,
+        std::size_t{shader.drawCount()});
+    shader
+        .bindTransformationBuffer(transformationBuffer,
+            offset*sizeof(Shaders::TransformationUniform3D),
+            shader.drawCount()*sizeof(Shaders::TransformationUniform3D))
+        .bindDrawBuffer(drawBuffer,
+            offset*sizeof(Shaders::PhongDrawUniform),
+            shader.drawCount()*sizeof(Shaders::PhongDrawUniform))
+        .draw(mesh, counts.sliceSize(offset, size),
+            vertexOffsets.sliceSize(offset, size),
+            indexOffsets.sliceSize(offset, size));
+}
+/* [meshDrawList3D] */
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+{
+UnsignedInt vertexCount{}, indexCount{}, jointCount{};
+Containers::ArrayView<const Matrix4> jointMatrices;
+Matrix4 transformationMatrix, projectionMatrix;
+/* [SkinningGL-usage] */
+/* Positions, normals, joint IDs and weights for each vertex */
+GL::Buffer vertices, indices;
+DOXYGEN_ELLIPSIS()
+
+/* A point mesh that's used only for skinning */
+GL::Mesh skinMesh{GL::MeshPrimitive::Points};
+skinMesh.setCount(vertexCount)
+    .addVertexBuffer(vertices, 0,
+        Shaders::SkinningGL::Position{},
+        Shaders::SkinningGL::Normal{},
+        Shaders::SkinningGL::JointIds{},
+        Shaders::SkinningGL::Weights{});
+
+/* Skinned output, used as a regular vertex buffer afterwards */
+GL::Buffer skinned;
+skinned.setData({nullptr, vertexCount*(sizeof(Vector3) + sizeof(Vector3))},
+    GL::BufferUsage::DynamicCopy);
+GL::TransformFeedback feedback;
+feedback.attachBuffer(0, skinned);
+
+GL::Mesh mesh;
+mesh.setCount(indexCount)
+    .addVertexBuffer(skinned, 0,
+        Shaders::PhongGL::Position{},
+        Shaders::PhongGL::Normal{})
+    .setIndexBuffer(indices, 0, MeshIndexType::UnsignedInt);
+
+Shaders::SkinningGL skinning{Shaders::SkinningGL::Configuration{}
+    .setFlags(Shaders::SkinningGL::Flag::Normal)
+    .setJointCount(jointCount, 4)};
+
+/* Each frame, skin the vertices once and then draw the result in as many
+   passes as needed */
+skinning
+    .setJointMatrices(jointMatrices)
+    .skin(skinMesh, feedback);
+
+Shaders::PhongGL shader;
+shader
+    .setTransformationMatrix(transformationMatrix)
+    .setNormalMatrix(transformationMatrix.normalMatrix())
+    .setProjectionMatrix(projectionMatrix)
+    .draw(mesh);
+/* [SkinningGL-usage] */
+}
+#endif
+
 {
 GL::Buffer vertices;
 GL::Mesh mesh;
@@ -770,6 +1007,32 @@ shader
     .draw(mesh);
 /* [LineGL-ubo] */
 }
+
+#ifndef MAGNUM_TARGET_WEBGL
+{
+Containers::ArrayView<const Vector2> chartPoints;
+Matrix3 transformationMatrix, projectionMatrix;
+/* [LineGL-vertex-pulling] */
+GL::Buffer points;
+points.setData(chartPoints, GL::BufferUsage::DynamicDraw);
+GL::BufferTexture pointTexture;
+pointTexture.setBuffer(GL::BufferTextureFormat::RG32F, points);
+
+/* No attributes, twelve vertices for each segment */
+GL::Mesh mesh;
+mesh.setCount(12*(chartPoints.size() - 1));
+
+Shaders::LineGL2D shader{Shaders::LineGL2D::Configuration{}
+    .setFlags(Shaders::LineGL2D::Flag::VertexPulling)};
+shader
+    .setViewportSize(Vector2{GL::defaultFramebuffer.viewport().size()})
+    .setTransformationProjectionMatrix(projectionMatrix*transformationMatrix)
+    .setColor(0x2f83cc_rgbf)
+    .bindVertexPullingPositionTexture(pointTexture)
+    .draw(mesh);
+/* [LineGL-vertex-pulling] */
+}
+#endif
 #endif
 
 {
@@ -906,6 +1169,37 @@ shader.setColor(0x2f83cc_rgbf)
 /* [MeshVisualizerGL3D-usage-no-geom2] */
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+{
+Containers::ArrayView<const UnsignedInt> indexData;
+Containers::ArrayView<const Vector3> positionData;
+Matrix4 transformationMatrix, projectionMatrix;
+/* [MeshVisualizerGL3D-usage-vertex-pulling] */
+GL::Buffer indices{indexData};
+GL::Buffer positions{positionData};
+
+GL::BufferTexture indexTexture, positionTexture;
+indexTexture.setBuffer(GL::BufferTextureFormat::R32UI, indices);
+positionTexture.setBuffer(GL::BufferTextureFormat::RGB32F, positions);
+
+/* No attributes, just the vertex count */
+GL::Mesh mesh;
+mesh.setCount(indexData.size());
+
+Shaders::MeshVisualizerGL3D shader{Shaders::MeshVisualizerGL3D::Configuration{}
+    .setFlags(Shaders::MeshVisualizerGL3D::Flag::Wireframe|
+              Shaders::MeshVisualizerGL3D::Flag::VertexPulling)};
+shader.setColor(0x2f83cc_rgbf)
+    .setWireframeColor(0xdcdcdc_rgbf)
+    .setTransformationMatrix(transformationMatrix)
+    .setProjectionMatrix(projectionMatrix)
+    .bindVertexPullingIndexTexture(indexTexture)
+    .bindVertexPullingPositionTexture(positionTexture)
+    .draw(mesh);
+/* [MeshVisualizerGL3D-usage-vertex-pulling] */
+}
+#endif
+
 #ifndef MAGNUM_TARGET_GLES2
 {
 GL::Mesh mesh;
@@ -1142,6 +1436,38 @@ mesh.setInstanceCount(Containers::arraySize(instanceData))
 /* [PhongGL-usage-instancing] */
 }
 
+{
+GL::Mesh mesh;
+Matrix4 transformationMatrix, projectionMatrix;
+/* [PhongGL-depth-only] */
+Shaders::PhongGL::Configuration configuration;
+configuration
+    .setFlags(Shaders::PhongGL::Flag::DiffuseTexture|
+              Shaders::PhongGL::Flag::InstancedTransformation)
+    .setLightCount(3);
+Shaders::PhongGL shader{configuration};
+Shaders::PhongGL depthShader{configuration.depthOnlyVariant()};
+
+/* Depth prepass */
+GL::Renderer::setColorMask(false, false, false, false);
+depthShader
+    .setTransformationMatrix(transformationMatrix)
+    .setProjectionMatrix(projectionMatrix)
+    .draw(mesh);
+
+/* Color pass, shading only the visible fragments */
+GL::Renderer::setColorMask(true, true, true, true);
+GL::Renderer::setDepthMask(false);
+GL::Renderer::setDepthFunction(GL::Renderer::DepthFunction::LessOrEqual);
+shader
+    .setTransformationMatrix(transformationMatrix)
+    .setNormalMatrix(transformationMatrix.normalMatrix())
+    .setProjectionMatrix(projectionMatrix)
+    DOXYGEN_ELLIPSIS()
+    .draw(mesh);
+/* [PhongGL-depth-only] */
+}
+
 #ifndef MAGNUM_TARGET_GLES2
 {
 GL::Mesh mesh;
@@ -1185,6 +1511,99 @@ shader
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+{
+GL::Mesh mesh;
+Matrix4 projectionMatrix;
+GL::Buffer projectionUniform, materialUniform, transformationUniform,
+    drawUniform;
+/* [PhongGL-clustered-lights] */
+/* Camera-space light positions, colors and ranges */
+Containers::Array<Shaders::PhongLightUniform> lights{DOXYGEN_ELLIPSIS()};
+
+/* 16x9 screen-space tiles and 24 depth slices */
+Shaders::LightClusterGrid grid{{16, 9, 24},
+    GL::defaultFramebuffer.viewport().size(), projectionMatrix};
+grid.assign(lights);
+
+GL::Buffer lightBuffer, clusterBuffer, clusterIndexBuffer;
+lightBuffer.setData(lights);
+clusterBuffer.setData(grid.clusterData());
+clusterIndexBuffer.setData(grid.lightIndices());
+
+Shaders::PhongGL shader{Shaders::PhongGL::Configuration{}
+    .setFlags(Shaders::PhongGL::Flag::ShaderStorageBuffers|
+              Shaders::PhongGL::Flag::ClusteredLights)};
+shader
+    .bindLightBuffer(lightBuffer)
+    .bindLightClusterBuffer(clusterBuffer)
+    .bindLightClusterIndexBuffer(clusterIndexBuffer)
+    DOXYGEN_ELLIPSIS(.bindProjectionBuffer(projectionUniform)
+    .bindMaterialBuffer(materialUniform)
+    .bindTransformationBuffer(transformationUniform)
+    .bindDrawBuffer(drawUniform))
+    .draw(mesh);
+/* [PhongGL-clustered-lights] */
+}
+#endif
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+{
+Containers::Array<Trade::MeshData> meshes;
+GL::Buffer projectionUniform, materialUniform, transformationUniform,
+    drawUniform, lightUniform;
+/* [compileVertexPulling] */
+/* All meshes in a single vertex storage buffer, drawn through a mesh that has
+   just an index buffer */
+Containers::Array<UnsignedInt> counts{NoInit, meshes.size()};
+Containers::Array<UnsignedInt> vertexOffsets{NoInit, meshes.size()};
+Containers::Array<UnsignedInt> indexOffsets{NoInit, meshes.size()};
+GL::Buffer vertices{GL::Buffer::TargetHint::ShaderStorage};
+GL::Mesh mesh = MeshTools::compileVertexPulling(meshes, vertices,
+    counts, vertexOffsets, indexOffsets).first();
+
+Shaders::PhongGL shader{Shaders::PhongGL::Configuration{}
+    .setFlags(Shaders::PhongGL::Flag::ShaderStorageBuffers|
+              Shaders::PhongGL::Flag::MultiDraw|
+              Shaders::PhongGL::Flag::VertexPulling)};
+shader
+    .bindVertexBuffer(vertices)
+    DOXYGEN_ELLIPSIS(.bindProjectionBuffer(projectionUniform)
+    .bindMaterialBuffer(materialUniform)
+    .bindTransformationBuffer(transformationUniform)
+    .bindDrawBuffer(drawUniform)
+    .bindLightBuffer(lightUniform))
+    .draw(mesh, counts, vertexOffsets, indexOffsets);
+/* [compileVertexPulling] */
+}
+#endif
+
+{
+GL::Mesh mesh;
+Matrix4 transformationMatrix, projectionMatrix;
+Shaders::PhongGL fallbackShader{NoCreate};
+/* [ShaderCacheGL-usage] */
+Shaders::ShaderCacheGL<Shaders::PhongGL> cache;
+
+/* Doesn't block, returns nullptr until the variant is compiled and linked */
+if(Shaders::PhongGL* shader = cache.find(Shaders::PhongGL::Configuration{}
+    .setFlags(Shaders::PhongGL::Flag::DiffuseTexture)
+    .setLightCount(3)))
+{
+    shader->setTransformationMatrix(transformationMatrix)
+        .setProjectionMatrix(projectionMatrix)
+        DOXYGEN_ELLIPSIS()
+        .draw(mesh);
+} else fallbackShader.draw(mesh);
+
+/* Blocks until the variant is ready */
+cache.get(Shaders::PhongGL::Configuration{})
+    .setTransformationMatrix(transformationMatrix)
+    .setProjectionMatrix(projectionMatrix)
+    .draw(mesh);
+/* [ShaderCacheGL-usage] */
+}
+
 #if !defined(CORRADE_TARGET_GCC) || defined(CORRADE_TARGET_CLANG) || __GNUC__ >= 5
 {
 /* [VectorGL-usage1] */
@@ -1302,4 +1721,29 @@ shader
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES2
+{
+Containers::Array<Trade::MaterialData> materials;
+GL::Mesh mesh;
+/* [MaterialTools-compilePhongUniforms] */
+/* All materials extracted in a single pass, with texture IDs in a separate
+   table to bind the textures from */
+Containers::Pair<Containers::Array<Shaders::PhongMaterialUniform>,
+                 Containers::Array<MaterialTools::PhongMaterialTextures>>
+    compiled = MaterialTools::compilePhongUniforms(materials);
+
+GL::Buffer materialUniform;
+materialUniform.setData(compiled.first());
+
+Shaders::PhongGL shader{Shaders::PhongGL::Configuration{}
+    .setFlags(Shaders::PhongGL::Flag::UniformBuffers)
+    .setMaterialCount(compiled.first().size())};
+shader
+    .bindMaterialBuffer(materialUniform)
+    DOXYGEN_ELLIPSIS()
+    .draw(mesh);
+/* [MaterialTools-compilePhongUniforms] */
+}
+#endif
+
 }
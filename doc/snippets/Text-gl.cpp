@@ -24,9 +24,12 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/PluginManager/Manager.h>
 
+#include "Magnum/Image.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix3.h"
@@ -34,6 +37,7 @@
 #include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Text/DistanceFieldGlyphCacheGL.h"
 #include "Magnum/Text/Renderer.h"
+#include "Magnum/TextureTools/DistanceFieldCpu.h"
 
 #define DOXYGEN_ELLIPSIS(...) __VA_ARGS__
 
@@ -88,6 +92,21 @@ font->fillGlyphCache(cache, "abcdefghijklmnopqrstuvwxyz"
 /* [DistanceFieldGlyphCacheGL-usage] */
 }
 
+{
+Text::DistanceFieldGlyphCacheGL cache{Vector2i{1024}, Vector2i{128}, 12};
+/* [DistanceFieldGlyphCacheGL-cpu] */
+/* Glyphs rendered at the source size, for example on a build machine */
+Image2D source = DOXYGEN_ELLIPSIS(Image2D{PixelFormat::R8Unorm});
+
+Image2D processed{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm,
+    Vector2i{128}, Containers::Array<char>{NoInit, 128*128}};
+TextureTools::distanceFieldInto(source.pixels<UnsignedByte>(),
+    processed.pixels<UnsignedByte>(), 12);
+
+cache.setProcessedImage({}, processed);
+/* [DistanceFieldGlyphCacheGL-cpu] */
+}
+
 {
 /* -Wnonnull in GCC 11+  "helpfully" says "this is null" if I don't initialize
    the font pointer. I don't care, I just want you to check compilation errors,
@@ -159,6 +178,36 @@ shader.setTransformationProjectionMatrix(projectionMatrix)
 /* [Renderer-usage2] */
 }
 
+{
+PluginManager::Manager<Text::AbstractFont> manager;
+Containers::Pointer<Text::AbstractFont> font = manager.loadAndInstantiate("");
+Text::GlyphCacheGL cache{PixelFormat::R8Unorm, Vector2i{128}};
+Matrix3 projectionMatrix;
+/* [BatchRenderer-usage] */
+/* Reserve capacity for all labels together */
+Text::BatchRenderer2D renderer{*font, cache, 12.0f, Text::Alignment::LineCenter};
+renderer.reserve(4096, GL::BufferUsage::DynamicDraw, GL::BufferUsage::StaticDraw);
+
+/* Static labels take exactly as many glyphs as they need, the label that
+   changes gets a fixed-size slot */
+renderer.add("Base", {-200.0f, 100.0f}, 0x3bd267_rgbf);
+renderer.add("Outpost", {150.0f, -50.0f}, 0xc7cf2f_rgbf);
+UnsignedInt counter = renderer.add("Score: 0", {0.0f, 220.0f}, 0xffffff_rgbf, 16);
+
+/* Later, change just the one label and upload only its part of the buffer */
+renderer.setText(counter, "Score: 1250")
+    .setColor(counter, 0xcd3431_rgbf);
+renderer.update();
+
+/* Draw all labels in a single draw call */
+Shaders::VectorGL2D shader{Shaders::VectorGL2D::Configuration{}
+    .setFlags(Shaders::VectorGL2D::Flag::VertexColor)};
+shader.setTransformationProjectionMatrix(projectionMatrix)
+    .bindVectorTexture(cache.texture())
+    .draw(renderer.mesh());
+/* [BatchRenderer-usage] */
+}
+
 {
 /* [Renderer-dpi-interface-size] */
 Vector2 interfaceSize = Vector2{windowSize()}/dpiScaling();
@@ -33,6 +33,7 @@
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once file callbacks are <string>-free */
@@ -52,9 +53,11 @@
 #include "Magnum/Text/AbstractFontConverter.h"
 #include "Magnum/Text/AbstractGlyphCache.h"
 #include "Magnum/Text/AbstractShaper.h"
+#include "Magnum/Text/CachingShaper.h"
 #include "Magnum/Text/Direction.h"
 #include "Magnum/Text/Feature.h"
 #include "Magnum/Text/Script.h"
+#include "Magnum/Text/ShapeRuns.h"
 #include "Magnum/TextureTools/Atlas.h"
 
 #define DOXYGEN_ELLIPSIS(...) __VA_ARGS__
@@ -263,6 +266,35 @@ for(std::size_t i = 0; i != fontGlyphIds.size(); ++i) {
 /* [AbstractGlyphCache-querying-batch] */
 }
 
+{
+struct: Text::AbstractGlyphCache {
+    using Text::AbstractGlyphCache::AbstractGlyphCache;
+
+    Text::GlyphCacheFeatures doFeatures() const override { return {}; }
+} cacheInstance{PixelFormat::R8Unorm, Vector2i{256}};
+/* [AbstractGlyphCache-filling-eviction] */
+Containers::Pointer<Text::AbstractFont> font = DOXYGEN_ELLIPSIS({});
+Text::AbstractGlyphCache& cache = DOXYGEN_ELLIPSIS(cacheInstance);
+
+/* Cache-global IDs of all glyphs in currently visible text, and unique
+   font-specific IDs of glyphs for which glyphIdsInto() returned 0 */
+Containers::ArrayView<const UnsignedInt> visibleGlyphIds = DOXYGEN_ELLIPSIS({});
+Containers::ArrayView<const UnsignedInt> missingFontGlyphIds = DOXYGEN_ELLIPSIS({});
+
+/* Mark the visible glyphs as used */
+cache.markGlyphsUsed(visibleGlyphIds);
+
+/* Rasterize the missing glyphs. If they don't fit, evict a quarter of the
+   least recently used glyphs and try again. */
+while(!font->fillGlyphCache(cache, missingFontGlyphIds)) {
+    if(!cache.evictGlyphs(cache.glyphCount()/4)) {
+        Error{} << "Glyph cache too small to fit the text";
+        break;
+    }
+}
+/* [AbstractGlyphCache-filling-eviction] */
+}
+
 {
 /* -Wnonnull in GCC 11+  "helpfully" says "this is null" if I don't initialize
    the font pointer. I don't care, I just want you to check compilation errors,
@@ -379,4 +411,45 @@ Containers::StringView selection = text.slice(clusters[2], clusters[5]);
 static_cast<void>(selection);
 }
 
+{
+/* -Wnonnull in GCC 11+  "helpfully" says "this is null" if I don't initialize
+   the font pointer. I don't care, I just want you to check compilation errors,
+   not more! */
+PluginManager::Manager<Text::AbstractFont> manager;
+Containers::Pointer<Text::AbstractFont> font = manager.loadAndInstantiate("SomethingWhatever");
+/* [CachingShaper-usage] */
+Containers::Pointer<Text::AbstractShaper> shaper = font->createShaper();
+
+/* Remember shaping results of up to about 1 MB of text */
+Text::CachingShaper cachingShaper{*shaper, 1024*1024};
+
+/* The first call goes to the font plugin, subsequent calls with the same text
+   and options are just copies of the cached data */
+cachingShaper.shape("Hello, world!");
+DOXYGEN_ELLIPSIS()
+/* [CachingShaper-usage] */
+}
+
+{
+PluginManager::Manager<Text::AbstractFont> manager;
+Containers::Pointer<Text::AbstractFont> font = manager.loadAndInstantiate("SomethingWhatever");
+Text::ParallelFor parallelFor = nullptr;
+void* threadPool = nullptr;
+/* [shapeRuns] */
+Containers::StringView text = DOXYGEN_ELLIPSIS({});
+
+/* Shape each line separately, in parallel if the font allows it */
+Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> lines =
+    Text::textLineRuns(text);
+Containers::Array<UnsignedInt> lineGlyphOffsets{NoInit, lines.size() + 1};
+Containers::Array<Text::ShapedGlyph> glyphs = Text::shapeRuns(*font, text,
+    lines, {}, lineGlyphOffsets, parallelFor, threadPool);
+
+/* Glyphs of the third line */
+Containers::ArrayView<const Text::ShapedGlyph> line = glyphs.slice(
+    lineGlyphOffsets[2], lineGlyphOffsets[3]);
+/* [shapeRuns] */
+static_cast<void>(line);
+}
+
 }
@@ -38,6 +38,8 @@
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/TextureTools/Atlas.h"
+#include "Magnum/TextureTools/ConvertPixelFormat.h"
+#include "Magnum/TextureTools/Mipmap.h"
 #include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
 
@@ -125,6 +127,60 @@ for(std::size_t i = 0; i != images.size(); ++i) {
 /* [AtlasLandfill-usage-array] */
 }
 
+{
+Containers::ArrayView<const ImageView2D> images = DOXYGEN_ELLIPSIS({});
+Containers::Array<Vector3i> offsets{NoInit, images.size()};
+Containers::BitArray rotations{NoInit, images.size()};
+/* [AtlasLandfill-usage-array-parallel] */
+/* An executor integrating with a thread pool in the application */
+TextureTools::ParallelFor parallelFor = DOXYGEN_ELLIPSIS(nullptr);
+void* parallelForState = DOXYGEN_ELLIPSIS(nullptr);
+
+/* Fill the slices concurrently */
+TextureTools::AtlasLandfill atlas{{1024, 1024, 0}};
+atlas.add(stridedArrayView(images).slice(&ImageView2D::size), offsets, rotations,
+    parallelFor, parallelForState);
+/* [AtlasLandfill-usage-array-parallel] */
+}
+
+{
+TextureTools::AtlasLandfill atlasInstance{{1024, 1024}};
+Image2D imageInstance{PixelFormat::RGBA8Unorm};
+/* [AtlasLandfill-compact] */
+TextureTools::AtlasLandfill& atlas = DOXYGEN_ELLIPSIS(atlasInstance);
+Image2D& image = DOXYGEN_ELLIPSIS(imageInstance);
+/* Sizes and offsets of items that are currently in the atlas and image,
+   assuming the atlas has rotations disabled */
+Containers::ArrayView<const Vector2i> sizes = DOXYGEN_ELLIPSIS({});
+Containers::ArrayView<Vector2i> offsets = DOXYGEN_ELLIPSIS({});
+
+/* Remember the previous placement and image contents */
+Containers::Array<Vector2i> previousOffsets{NoInit, offsets.size()};
+Utility::copy(offsets, previousOffsets);
+Image2D previous{image.format(), image.size(),
+    Containers::Array<char>{NoInit, image.data().size()}};
+Utility::copy(image.data(), previous.mutableData());
+
+/* Compact and copy the data of items that moved, assuming RGBA8Unorm */
+if(atlas.compact(sizes, offsets)) {
+    Containers::StridedArrayView2D<const Color4ub> src = previous.pixels<Color4ub>();
+    Containers::StridedArrayView2D<Color4ub> dst = image.pixels<Color4ub>();
+    for(std::size_t i = 0; i != sizes.size(); ++i) {
+        if(offsets[i] == previousOffsets[i])
+            continue;
+
+        const Containers::Size2D size{std::size_t(sizes[i].y()),
+                                      std::size_t(sizes[i].x())};
+        Utility::copy(
+            src.sliceSize({std::size_t(previousOffsets[i].y()),
+                           std::size_t(previousOffsets[i].x())}, size),
+            dst.sliceSize({std::size_t(offsets[i].y()),
+                           std::size_t(offsets[i].x())}, size));
+    }
+}
+/* [AtlasLandfill-compact] */
+}
+
 {
 /* [atlasArrayPowerOfTwo] */
 Containers::ArrayView<const ImageView2D> input;
@@ -186,4 +242,42 @@ materialMatrix = matrix*materialMatrix;
 /* [atlasTextureCoordinateTransformation-materialdata] */
 }
 
+{
+/* [convertPixelFormat] */
+/* A BGR image, such as from a TGA file, expanded to RGBA with an opaque alpha
+   and converted to half-floats */
+ImageView2D bgr = DOXYGEN_ELLIPSIS(ImageView2D{PixelFormat::RGB8Unorm, {}});
+Image2D rgba = TextureTools::convertPixelFormat(bgr, PixelFormat::RGBA16F,
+    "bgr1");
+/* [convertPixelFormat] */
+static_cast<void>(rgba);
+}
+
+{
+/* [mipmaps] */
+ImageView2D image = DOXYGEN_ELLIPSIS(ImageView2D{PixelFormat::RGBA8Srgb, {}});
+
+/* Foliage texture rendered with alpha test at 0.5, keep it from thinning out
+   in the distance */
+Containers::Array<Image2D> levels = TextureTools::mipmaps(image,
+    TextureTools::MipmapFilter::Kaiser,
+    TextureTools::MipmapFlag::PreserveAlphaCoverage, 0.5f);
+for(std::size_t i = 0; i != levels.size(); ++i) {
+    /* Level i + 1 of the texture */
+    DOXYGEN_ELLIPSIS(static_cast<void>(levels[i]);)
+}
+/* [mipmaps] */
+}
+
+{
+/* [resizeInto] */
+ImageView2D screenshot = DOXYGEN_ELLIPSIS(ImageView2D{PixelFormat::RGBA8Srgb, {}});
+
+/* A 256x144 thumbnail */
+Image2D thumbnail{PixelFormat::RGBA8Srgb, {256, 144},
+    Containers::Array<char>{NoInit, 256*144*4}};
+TextureTools::resizeInto(screenshot, thumbnail, TextureTools::ResizeFilter::Lanczos);
+/* [resizeInto] */
+}
+
 }
@@ -378,6 +378,32 @@ if(!converter->addSupportedImporterContents(*importer, ~Trade::SceneContent::Mes
 /* [AbstractSceneConverter-usage-multiple-file-selective] */
 }
 
+{
+Containers::Pointer<Trade::AbstractImporter> importer;
+Containers::Pointer<Trade::AbstractSceneConverter> converter;
+/* [AbstractSceneConverter-usage-update] */
+/* Initial export, the converter remembers what it wrote */
+if(!converter->beginFile("scene.bin") ||
+   !converter->addSupportedImporterContents(*importer) ||
+   !converter->endFile())
+    Fatal{} << "Can't save the output file";
+
+DOXYGEN_ELLIPSIS()
+
+/* After an edit, pass all materials through. Only the changed ones get
+   actually rewritten. */
+if(!converter->beginUpdateFile("scene.bin"))
+    Fatal{} << "Can't update the output file";
+for(UnsignedInt i = 0; i != importer->materialCount(); ++i) {
+    Containers::Optional<Trade::MaterialData> material = importer->material(i);
+    if(!material || !converter->update(i, *material))
+        Fatal{} << "Can't update material" << i;
+}
+if(!converter->endFile())
+    Fatal{} << "Can't save the output file";
+/* [AbstractSceneConverter-usage-update] */
+}
+
 {
 UnsignedInt id{};
 Containers::Pointer<Trade::AbstractImporter> importer;
@@ -753,6 +779,21 @@ Vector3 bitangent = Math::cross(normal, tangent.xyz())*tangent.w();
 static_cast<void>(bitangent);
 }
 
+#if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+{
+/* [MeshData-deserialize-mapped] */
+/* A file previously produced by MeshData::serialize() */
+Containers::Optional<Containers::Array<char, Utility::Path::MapDeleter>> file =
+    Utility::Path::map("scan.blob");
+Containers::Optional<Trade::MeshData> mesh =
+    Trade::MeshData::deserialize(*file, Trade::DataFlag::Mutable);
+
+/* Changes are written directly to the file */
+MeshTools::transform3DInPlace(*mesh, Matrix4::scaling(Vector3{0.001f}));
+/* [MeshData-deserialize-mapped] */
+}
+#endif
+
 {
 /* [MeshAttributeData-usage] */
 Containers::StridedArrayView1D<const Vector3> positions;
@@ -30,17 +30,20 @@
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Path.h>
 
+#include "Magnum/ImageView.h"
 #include "Magnum/Magnum.h"
 #include "Magnum/Mesh.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/Sampler.h"
 #include "Magnum/VertexFormat.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Vk/Assert.h"
 #include "Magnum/Vk/BufferCreateInfo.h"
 #include "Magnum/Vk/CommandBuffer.h"
 #include "Magnum/Vk/CommandPoolCreateInfo.h"
 #include "Magnum/Vk/ComputePipelineCreateInfo.h"
+#include "Magnum/Vk/DescriptorAllocator.h"
 #include "Magnum/Vk/DescriptorPoolCreateInfo.h"
 #include "Magnum/Vk/DescriptorSet.h"
 #include "Magnum/Vk/DescriptorSetLayoutCreateInfo.h"
@@ -51,6 +54,7 @@
 #include "Magnum/Vk/Extensions.h"
 #include "Magnum/Vk/ExtensionProperties.h"
 #include "Magnum/Vk/FenceCreateInfo.h"
+#include "Magnum/Vk/FrameCommandPools.h"
 #include "Magnum/Vk/FramebufferCreateInfo.h"
 #include "Magnum/Vk/InstanceCreateInfo.h"
 #include "Magnum/Vk/Integration.h"
@@ -58,17 +62,22 @@
 #include "Magnum/Vk/ImageViewCreateInfo.h"
 #include "Magnum/Vk/LayerProperties.h"
 #include "Magnum/Vk/MemoryAllocateInfo.h"
+#include "Magnum/Vk/MemoryAllocator.h"
 #include "Magnum/Vk/Mesh.h"
 #include "Magnum/Vk/Pipeline.h"
+#include "Magnum/Vk/PipelineCacheCreateInfo.h"
 #include "Magnum/Vk/PipelineLayoutCreateInfo.h"
 #include "Magnum/Vk/PixelFormat.h"
+#include "Magnum/Vk/QueryPoolCreateInfo.h"
 #include "Magnum/Vk/Queue.h"
 #include "Magnum/Vk/RasterizationPipelineCreateInfo.h"
 #include "Magnum/Vk/RenderPassCreateInfo.h"
 #include "Magnum/Vk/Result.h"
 #include "Magnum/Vk/SamplerCreateInfo.h"
+#include "Magnum/Vk/SemaphoreCreateInfo.h"
 #include "Magnum/Vk/ShaderCreateInfo.h"
 #include "Magnum/Vk/ShaderSet.h"
+#include "Magnum/Vk/StagingUploader.h"
 #include "MagnumExternal/Vulkan/flextVkGlobal.h"
 
 /* [wrapping-include-createinfo] */
@@ -322,6 +331,104 @@ fence.wait();
 /* [CommandBuffer-usage-submit] */
 }
 
+{
+Vk::Device device{NoCreate};
+Vk::CommandPool commandPool{NoCreate};
+Vk::RenderPass renderPass{NoCreate};
+Vk::Framebuffer framebuffer{NoCreate};
+/* [CommandBuffer-secondary] */
+Vk::CommandBuffer secondary = commandPool.allocate(Vk::CommandBufferLevel::Secondary);
+secondary.begin(Vk::CommandBufferBeginInfo{renderPass, 0, framebuffer})
+   DOXYGEN_ELLIPSIS()
+   .end();
+
+Vk::CommandBuffer cmd = commandPool.allocate();
+cmd.begin()
+   .beginRenderPass(Vk::RenderPassBeginInfo{renderPass, framebuffer},
+        Vk::SubpassBeginInfo{Vk::SubpassContents::SecondaryCommandBuffers})
+   .executeCommands({secondary})
+   .endRenderPass()
+   .end();
+/* [CommandBuffer-secondary] */
+}
+
+{
+Vk::Device device{NoCreate};
+Vk::ShaderSet shaderSet;
+Vk::MeshLayout meshLayout{MeshPrimitive::Triangles};
+Vk::PipelineLayout pipelineLayout{NoCreate};
+Vk::RenderPass renderPass{NoCreate};
+Vk::CommandBuffer cmd{NoCreate};
+Vk::Mesh opaque{Vk::MeshLayout{MeshPrimitive::Triangles}};
+Vk::Mesh transparent{Vk::MeshLayout{MeshPrimitive::Triangles}};
+Vector2i size;
+/* [CommandBuffer-dynamic-state] */
+Vk::Pipeline pipeline{device, Vk::RasterizationPipelineCreateInfo{
+        shaderSet, meshLayout, pipelineLayout, renderPass, 0, 1}
+    .setDynamicStates(Vk::DynamicRasterizationState::Viewport|
+                      Vk::DynamicRasterizationState::Scissor|
+                      Vk::DynamicRasterizationState::CullMode|
+                      Vk::DynamicRasterizationState::DepthWriteEnable)
+};
+
+DOXYGEN_ELLIPSIS()
+
+cmd.bindPipeline(pipeline)
+   .setViewport(Range2D{{}, Vector2{size}})
+   .setScissor(Range2Di{{}, size})
+   .setCullMode(Vk::CullMode::Back)
+   .setDepthWriteEnabled(true)
+   .draw(opaque)
+   /* Same pipeline, just with different state */
+   .setCullMode(Vk::CullMode::None)
+   .setDepthWriteEnabled(false)
+   .draw(transparent);
+/* [CommandBuffer-dynamic-state] */
+}
+
+{
+Vk::Device device{NoCreate};
+/* The include should be a no-op here since it was already included above */
+/* [DescriptorAllocator-creation] */
+#include <Magnum/Vk/DescriptorAllocator.h>
+
+DOXYGEN_ELLIPSIS()
+
+/* Each pool for at most 64 sets with 64 uniform buffers and 128 samplers */
+Vk::DescriptorAllocator allocator{device, 64, {
+    {Vk::DescriptorType::UniformBuffer, 64},
+    {Vk::DescriptorType::CombinedImageSampler, 128}
+}};
+/* [DescriptorAllocator-creation] */
+
+Vk::FrameCommandPools pools{NoCreate};
+Vk::DescriptorSetLayout layout{NoCreate};
+/* [DescriptorAllocator-usage] */
+/* One allocator for each frame in flight */
+Vk::DescriptorAllocator allocators[]{
+    Vk::DescriptorAllocator{DOXYGEN_ELLIPSIS(NoCreate)},
+    Vk::DescriptorAllocator{DOXYGEN_ELLIPSIS(NoCreate)}
+};
+
+pools.beginFrame();
+Vk::DescriptorAllocator& frameAllocator = allocators[pools.frame()];
+frameAllocator.reset();
+
+Vk::DescriptorSet set = frameAllocator.allocate(layout);
+DOXYGEN_ELLIPSIS(static_cast<void>(set);)
+/* [DescriptorAllocator-usage] */
+
+Vk::Buffer buffer{NoCreate};
+/* [DescriptorAllocator-usage-cache] */
+/* Non-dispatchable handles are 64-bit on all platforms */
+Containers::Pair<Vk::DescriptorSet, bool> cached = frameAllocator.allocateCached(
+    layout, {reinterpret_cast<UnsignedLong>(buffer.handle()), 0, 256});
+if(cached.second()) {
+    /* Write the buffer to cached.first() */
+}
+/* [DescriptorAllocator-usage-cache] */
+}
+
 {
 Vk::Device device{NoCreate};
 /* The include should be a no-op here since it was already included above */
@@ -584,6 +691,47 @@ Vk::Fence fence{device, Vk::FenceCreateInfo{Vk::FenceCreateInfo::Flag::Signaled}
 /* [Fence-creation] */
 }
 
+{
+Vk::Device device{NoCreate};
+/* The include should be a no-op here since it was already included above */
+/* [FrameCommandPools-creation] */
+#include <Magnum/Vk/FrameCommandPools.h>
+
+DOXYGEN_ELLIPSIS()
+
+/* Four recording threads, two frames in flight */
+Vk::FrameCommandPools pools{device,
+    device.properties().pickQueueFamily(Vk::QueueFlag::Graphics), 4, 2};
+/* [FrameCommandPools-creation] */
+
+Vk::Queue queue{NoCreate};
+Vk::RenderPass renderPass{NoCreate};
+Vk::Framebuffer framebuffer{NoCreate};
+/* [FrameCommandPools-usage] */
+pools.beginFrame();
+
+/* On each of the four threads, i being the thread index */
+VkCommandBuffer secondary[4];
+for(UnsignedInt i = 0; i != 4; ++i) {
+    Vk::CommandBuffer cmd = pools.allocate(i, Vk::CommandBufferLevel::Secondary);
+    cmd.begin(Vk::CommandBufferBeginInfo{renderPass, 0, framebuffer})
+       DOXYGEN_ELLIPSIS()
+       .end();
+    secondary[i] = cmd;
+}
+
+/* Once all threads are done, on the main thread */
+Vk::CommandBuffer cmd = pools.allocate(0);
+cmd.begin()
+   .beginRenderPass(Vk::RenderPassBeginInfo{renderPass, framebuffer},
+        Vk::SubpassBeginInfo{Vk::SubpassContents::SecondaryCommandBuffers})
+   .executeCommands(secondary)
+   .endRenderPass()
+   .end();
+queue.submit({Vk::SubmitInfo{}.setCommandBuffers({cmd})}, pools.fence());
+/* [FrameCommandPools-usage] */
+}
+
 {
 Vk::Device device{DOXYGEN_ELLIPSIS(NoCreate)};
 Vector2i size;
@@ -909,6 +1057,30 @@ indices.bindMemory(memory, indicesOffset);
 /* [Memory-mapping] */
 }
 
+{
+Vk::Device device{NoCreate};
+Containers::ArrayView<const char> vertexData;
+/* The include should be a no-op here since it was already included above */
+/* [MemoryAllocator-usage] */
+#include <Magnum/Vk/MemoryAllocator.h>
+
+DOXYGEN_ELLIPSIS()
+
+Vk::MemoryAllocator allocator{device};
+
+/* Both buffers get a sub-range of the same memory block */
+Vk::Buffer vertices{device,
+    Vk::BufferCreateInfo{Vk::BufferUsage::VertexBuffer, vertexData.size()},
+    allocator, Vk::MemoryFlag::HostVisible};
+Vk::Buffer instances{device,
+    Vk::BufferCreateInfo{Vk::BufferUsage::VertexBuffer, 16*1024},
+    allocator, Vk::MemoryFlag::HostVisible};
+
+/* The block is mapped once and stays mapped for all its allocations */
+Utility::copy(vertexData, vertices.allocation().map().prefix(vertexData.size()));
+/* [MemoryAllocator-usage] */
+}
+
 {
 /* [MeshLayout-usage] */
 constexpr UnsignedInt Binding = 0;
@@ -1095,6 +1267,19 @@ Vk::Pipeline pipeline{device, Vk::ComputePipelineCreateInfo{
 /* [Pipeline-creation-compute] */
 }
 
+{
+Vk::Device device{NoCreate};
+/* [Pipeline-creation-cache] */
+Vk::PipelineCache cache{DOXYGEN_ELLIPSIS(NoCreate)};
+Vk::ShaderSet shaderSet{DOXYGEN_ELLIPSIS()};
+Vk::PipelineLayout pipelineLayout{DOXYGEN_ELLIPSIS(NoCreate)};
+
+Vk::Pipeline pipeline{device, Vk::ComputePipelineCreateInfo{
+    shaderSet, pipelineLayout
+}, cache};
+/* [Pipeline-creation-cache] */
+}
+
 {
 Vk::CommandBuffer cmd{NoCreate};
 /* [Pipeline-usage] */
@@ -1124,6 +1309,66 @@ Vk::PipelineLayout{device, Vk::PipelineLayoutCreateInfo{
 /* [PipelineLayout-creation] */
 }
 
+{
+Vk::Device device{NoCreate};
+/* The include should be a no-op here since it was already included above */
+/* [PipelineCache-creation] */
+#include <Magnum/Vk/PipelineCacheCreateInfo.h>
+
+DOXYGEN_ELLIPSIS()
+
+/* If the file doesn't exist, an empty cache gets created */
+Containers::Optional<Containers::Array<char>> data =
+    Utility::Path::read("pipeline-cache.bin");
+Vk::PipelineCache cache{device, Vk::PipelineCacheCreateInfo{
+    data ? Containers::ArrayView<const void>{*data} : nullptr
+}};
+/* [PipelineCache-creation] */
+
+/* [PipelineCache-usage] */
+Vk::Pipeline pipeline{device, DOXYGEN_ELLIPSIS(Vk::ComputePipelineCreateInfo{Vk::ShaderSet{}, Vk::PipelineLayout{NoCreate}}), cache};
+
+DOXYGEN_ELLIPSIS()
+
+Utility::Path::write("pipeline-cache.bin", cache.data());
+/* [PipelineCache-usage] */
+}
+
+{
+Vk::Device device{NoCreate};
+/* The include should be a no-op here since it was already included above */
+/* [QueryPool-creation] */
+#include <Magnum/Vk/QueryPoolCreateInfo.h>
+
+DOXYGEN_ELLIPSIS()
+
+Vk::QueryPool timestamps{device, Vk::QueryPoolCreateInfo{
+    Vk::QueryType::Timestamp, 2
+}};
+
+Vk::QueryPool statistics{device, Vk::QueryPoolCreateInfo{
+    Vk::QueryPipelineStatistic::ClippingInvocations|
+    Vk::QueryPipelineStatistic::ClippingPrimitives, 1
+}};
+/* [QueryPool-creation] */
+
+Vk::CommandBuffer cmd{NoCreate};
+/* [QueryPool-usage] */
+cmd.resetQueryPool(timestamps, 0, 2)
+   .writeTimestamp(Vk::PipelineStage::TopOfPipe, timestamps, 0)
+   DOXYGEN_ELLIPSIS()
+   .writeTimestamp(Vk::PipelineStage::BottomOfPipe, timestamps, 1);
+
+DOXYGEN_ELLIPSIS()
+
+UnsignedLong data[2];
+if(timestamps.results(0, 2, data)) {
+    Float period = device.properties().properties().properties.limits.timestampPeriod;
+    Debug{} << "GPU time:" << (data[1] - data[0])*period << "ns";
+}
+/* [QueryPool-usage] */
+}
+
 {
 Vk::Device device{NoCreate};
 /* The include should be a no-op here since it was already included above */
@@ -1209,6 +1454,40 @@ Vk::Sampler sampler{device, Vk::SamplerCreateInfo{}
 /* [Sampler-creation-linear] */
 }
 
+{
+Vk::Device device{NoCreate};
+/* The include should be a no-op here since it was already included above */
+/* [Semaphore-creation] */
+#include <Magnum/Vk/SemaphoreCreateInfo.h>
+
+DOXYGEN_ELLIPSIS()
+
+Vk::Semaphore binary{device};
+Vk::Semaphore timeline{device,
+    Vk::SemaphoreCreateInfo{Vk::SemaphoreType::Timeline, 0}};
+/* [Semaphore-creation] */
+}
+
+{
+Vk::Queue computeQueue{NoCreate}, graphicsQueue{NoCreate};
+Vk::Semaphore timeline{NoCreate};
+Vk::CommandBuffer compute{NoCreate}, draw{NoCreate};
+UnsignedLong frame{};
+/* [Semaphore-usage] */
+/* Compute writes vertex data and bumps the timeline to the frame index ... */
+computeQueue.submit({Vk::SubmitInfo{}
+    .setCommandBuffers({compute})
+    .setSignalSemaphores({{timeline, frame}})
+}, {});
+
+/* ... which the vertex input stage of the draw waits for */
+graphicsQueue.submit({Vk::SubmitInfo{}
+    .setWaitSemaphores({{timeline, frame, Vk::PipelineStage::VertexInput}})
+    .setCommandBuffers({draw})
+}, {});
+/* [Semaphore-usage] */
+}
+
 {
 Vk::Device device{NoCreate};
 /* The include should be a no-op here since it was already included above */
@@ -1258,6 +1537,47 @@ set.addShader(Vk::ShaderStage::Vertex, shader, "vert"_s)
 /* [ShaderSet-usage-ownership-transfer] */
 }
 
+{
+Vk::Device device{NoCreate};
+Vk::Queue queue{NoCreate};
+/* [StagingUploader-creation] */
+#include <Magnum/Vk/StagingUploader.h>
+
+DOXYGEN_ELLIPSIS()
+
+/* A queue and its family index, in this case queried at device creation */
+UnsignedInt queueFamilyIndex = DOXYGEN_ELLIPSIS(0);
+
+/* A 4 MB staging buffer */
+Vk::StagingUploader uploader{device, queue, queueFamilyIndex, 4*1024*1024};
+/* [StagingUploader-creation] */
+
+/* [StagingUploader-usage] */
+Containers::ArrayView<const void> vertexData = DOXYGEN_ELLIPSIS({});
+ImageView2D image = DOXYGEN_ELLIPSIS(ImageView2D{PixelFormat::RGBA8Unorm, {}});
+
+Vk::Buffer vertices{device, Vk::BufferCreateInfo{
+    Vk::BufferUsage::VertexBuffer|Vk::BufferUsage::TransferDestination,
+    vertexData.size()
+}, Vk::MemoryFlag::DeviceLocal};
+Vk::Image texture{device, Vk::ImageCreateInfo2D{
+    Vk::ImageUsage::Sampled|Vk::ImageUsage::TransferDestination,
+    image.format(), image.size(), 1
+}, Vk::MemoryFlag::DeviceLocal};
+
+/* Record the uploads and submit them as a single batch */
+UnsignedLong batch = uploader
+    .upload(vertices, 0, vertexData)
+    .upload(texture, 0, image)
+    .submit();
+
+DOXYGEN_ELLIPSIS()
+
+/* Wait for the data to arrive before using the buffer and the texture */
+uploader.wait(batch);
+/* [StagingUploader-usage] */
+}
+
 {
 /* [Integration] */
 VkOffset2D a{64, 32};
@@ -85,9 +85,13 @@
 #  WglContext                   - WGL context
 #  OpenGLTester                 - OpenGLTester class
 #  VulkanTester                 - VulkanTester class
+#  BcnImageConverter            - BCn block compression image converter plugin
 #  MagnumFont                   - Magnum bitmap font plugin
 #  MagnumFontConverter          - Magnum bitmap font converter plugin
+#  MagnumImporter               - Magnum blob importer plugin
+#  MagnumSceneConverter         - Magnum blob scene converter plugin
 #  ObjImporter                  - OBJ importer plugin
+#  PixelFormatImageConverter    - Pixel format conversion image converter plugin
 #  TgaImageConverter            - TGA image converter plugin
 #  TgaImporter                  - TGA importer plugin
 #  WavAudioImporter             - WAV audio importer plugin
@@ -246,7 +250,7 @@ foreach(_magnum_component ${Magnum_FIND_COMPONENTS})
 
     # Unrolling the transitive dependencies here so this doesn't need to be
     # after resolving inter-component dependencies. Listing also all plugins.
-    if(_magnum_component MATCHES "^(Audio|DebugTools|MeshTools|Primitives|SceneTools|ShaderTools|Text|TextureTools|Trade|.+Importer|.+ImageConverter|.+Font|.+ShaderConverter)$")
+    if(_magnum_component MATCHES "^(Audio|DebugTools|MeshTools|Primitives|SceneTools|ShaderTools|Text|TextureTools|Trade|.+Importer|.+ImageConverter|.+SceneConverter|.+Font|.+ShaderConverter)$")
         list(APPEND _MAGNUM_${_magnum_component}_CORRADE_DEPENDENCIES PluginManager)
     endif()
     if(_magnum_component STREQUAL DebugTools)
@@ -414,7 +418,8 @@ set(_MAGNUM_LIBRARY_COMPONENTS
     WindowlessEglApplication EglContext OpenGLTester)
 set(_MAGNUM_PLUGIN_COMPONENTS
     AnyAudioImporter AnyImageConverter AnyImageImporter AnySceneConverter
-    AnySceneImporter MagnumFont MagnumFontConverter ObjImporter
+    AnySceneImporter BcnImageConverter MagnumFont MagnumFontConverter
+    MagnumImporter MagnumSceneConverter ObjImporter PixelFormatImageConverter
     TgaImageConverter TgaImporter WavAudioImporter)
 set(_MAGNUM_EXECUTABLE_COMPONENTS
     imageconverter sceneconverter shaderconverter gl-info al-info)
@@ -473,6 +478,12 @@ if(MAGNUM_TARGET_GL)
     set(_MAGNUM_DebugTools_Shaders_DEPENDENCY_IS_OPTIONAL ON)
     set(_MAGNUM_DebugTools_GL_DEPENDENCY_IS_OPTIONAL ON)
 endif()
+# Vk is used only for FrameProfilerVk, compiled in only if the Vk library was
+# selected
+if(MAGNUM_TARGET_VK)
+    list(APPEND _MAGNUM_DebugTools_DEPENDENCIES Vk)
+    set(_MAGNUM_DebugTools_Vk_DEPENDENCY_IS_OPTIONAL ON)
+endif()
 
 set(_MAGNUM_MaterialTools_DEPENDENCIES Trade)
 
@@ -480,6 +491,9 @@ set(_MAGNUM_MeshTools_DEPENDENCIES Trade)
 if(MAGNUM_TARGET_GL)
     list(APPEND _MAGNUM_MeshTools_DEPENDENCIES GL)
 endif()
+if(MAGNUM_TARGET_VK)
+    list(APPEND _MAGNUM_MeshTools_DEPENDENCIES Vk)
+endif()
 
 set(_MAGNUM_OpenGLTester_DEPENDENCIES GL)
 if(MAGNUM_TARGET_EGL)
@@ -546,9 +560,11 @@ set(_MAGNUM_EglContext_DEPENDENCIES GL)
 set(_MAGNUM_GlxContext_DEPENDENCIES GL)
 set(_MAGNUM_WglContext_DEPENDENCIES GL)
 
+set(_MAGNUM_BcnImageConverter_DEPENDENCIES TextureTools) # and below
 set(_MAGNUM_MagnumFont_DEPENDENCIES Trade TgaImporter GL) # and below
 set(_MAGNUM_MagnumFontConverter_DEPENDENCIES Trade TgaImageConverter) # and below
 set(_MAGNUM_ObjImporter_DEPENDENCIES MeshTools) # and below
+set(_MAGNUM_PixelFormatImageConverter_DEPENDENCIES TextureTools) # and below
 foreach(_component ${_MAGNUM_PLUGIN_COMPONENTS})
     if(_component MATCHES ".+AudioImporter")
         list(APPEND _MAGNUM_${_component}_DEPENDENCIES Audio)
@@ -901,6 +917,12 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
                 find_package(EGL)
                 set_property(TARGET Magnum::${_component} APPEND PROPERTY
                     INTERFACE_LINK_LIBRARIES EGL::EGL)
+                # WindowlessEglContextPool uses std::thread
+                if(NOT CORRADE_TARGET_EMSCRIPTEN)
+                    find_package(Threads REQUIRED)
+                    set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                        INTERFACE_LINK_LIBRARIES Threads::Threads)
+                endif()
 
             # Windowless iOS application dependencies
             elseif(_component STREQUAL WindowlessIosApplication)
@@ -1015,9 +1037,13 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         # No special setup for AnyImageConverter plugin
         # No special setup for AnyImageImporter plugin
         # No special setup for AnySceneImporter plugin
+        # No special setup for BcnImageConverter plugin
         # No special setup for MagnumFont plugin
         # No special setup for MagnumFontConverter plugin
+        # No special setup for MagnumImporter plugin
+        # No special setup for MagnumSceneConverter plugin
         # No special setup for ObjImporter plugin
+        # No special setup for PixelFormatImageConverter plugin
         # No special setup for TgaImageConverter plugin
         # No special setup for TgaImporter plugin
         # No special setup for WavAudioImporter plugin
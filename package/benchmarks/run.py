@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+
+#
+#   This file is part of Magnum.
+#
+#   Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+#               2020, 2021, 2022, 2023, 2024
+#             Vladimír Vondruš <mosra@centrum.cz>
+#
+#   Permission is hereby granted, free of charge, to any person obtaining a
+#   copy of this software and associated documentation files (the "Software"),
+#   to deal in the Software without restriction, including without limitation
+#   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#   and/or sell copies of the Software, and to permit persons to whom the
+#   Software is furnished to do so, subject to the following conditions:
+#
+#   The above copyright notice and this permission notice shall be included
+#   in all copies or substantial portions of the Software.
+#
+#   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+#   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+#   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+#   DEALINGS IN THE SOFTWARE.
+#
+
+# Runs benchmarks of all tests built in a build directory through CTest, with
+# regular test cases skipped, and saves the results to a JSON file. Two such
+# files can be then compared with --compare. See the building-tests section in
+# doc/building.dox for details.
+
+import argparse
+import datetime
+import json
+import os
+import platform
+import re
+import subprocess
+import sys
+
+# Test executable name, printed by each test at the start
+starting_re = re.compile(r'^Starting (?P<test>\S+) with \d+ test cases')
+# A benchmark result, such as
+#  BENCH [04]   1.36 ± 0.05   µs dot<3>()@9x1000000 (wall time)
+# Custom benchmarks measuring plain counts have either just a prefix or no
+# unit at all, such as
+#  BENCH [02] 812.00 ± 9.00      positions()@5x1 (MB/s)
+bench_re = re.compile(r'^ *BENCH \[\d+\] +(?P<value>[\d.]+) ± (?P<stddev>[\d.]+) +(?:(?P<unit>[^\s()@]+) +)?(?P<case>\S.*)@(?P<batches>\d+)x(?P<iterations>\d+) \((?P<type>[^)]+)\)$')
+# CTest verbose output prefixes every line with a test index
+ctest_prefix_re = re.compile(r'^\d+: ')
+ansi_re = re.compile(r'\x1b\[[\d;]*m')
+
+unit_prefixes = {'n': 1.0e-9, 'µ': 1.0e-6, 'u': 1.0e-6, 'm': 1.0e-3, 'k': 1.0e3, 'M': 1.0e6, 'G': 1.0e9}
+
+def normalize(value, unit):
+    """Converts a value with a prefixed unit to the base unit"""
+    if not unit:
+        return value, ''
+    if unit[0] in unit_prefixes and (len(unit) > 1 or unit[0] in 'kMG'):
+        return value*unit_prefixes[unit[0]], unit[1:]
+    return value, unit
+
+def parse(lines):
+    results = []
+    test = None
+    for line in lines:
+        line = ansi_re.sub('', ctest_prefix_re.sub('', line.rstrip('\n')))
+        match = starting_re.match(line)
+        if match:
+            test = match.group('test')
+            continue
+        match = bench_re.match(line)
+        if not match:
+            continue
+        value, unit = normalize(float(match.group('value')), match.group('unit'))
+        stddev, _ = normalize(float(match.group('stddev')), match.group('unit'))
+        results += [{
+            'test': test,
+            'case': match.group('case'),
+            'type': match.group('type'),
+            'value': value,
+            'stddev': stddev,
+            'unit': unit,
+            'batches': int(match.group('batches')),
+            'iterations': int(match.group('iterations'))
+        }]
+    return results
+
+def run(args):
+    env = dict(os.environ)
+    env['CORRADE_TEST_SKIP_TESTS'] = 'ON'
+    env['CORRADE_TEST_COLOR'] = 'OFF'
+    command = [args.ctest, '-V', '-j1']
+    if args.config:
+        command += ['-C', args.config]
+    if args.regex:
+        command += ['-R', args.regex]
+    process = subprocess.Popen(command, cwd=args.build_dir, env=env,
+        stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+        universal_newlines=True, encoding='utf-8')
+    lines = []
+    for line in process.stdout:
+        if ' BENCH [' in line:
+            sys.stdout.write(line)
+        lines += [line]
+    process.wait()
+
+    out = {
+        'date': datetime.datetime.now(datetime.timezone.utc).isoformat(),
+        'platform': platform.platform(),
+        'machine': platform.machine(),
+        'processor': platform.processor(),
+        'results': parse(lines)
+    }
+    with open(args.output, 'w', encoding='utf-8') as f:
+        json.dump(out, f, indent=2, ensure_ascii=False)
+    print("Saved {} benchmark results to {}".format(len(out['results']), args.output))
+
+    # Benchmark cases can fail too, propagate that
+    return process.returncode
+
+def compare(args):
+    with open(args.compare[0], encoding='utf-8') as f:
+        before = {(i['test'], i['case'], i['type']): i for i in json.load(f)['results']}
+    with open(args.compare[1], encoding='utf-8') as f:
+        after = json.load(f)['results']
+
+    for i in after:
+        key = (i['test'], i['case'], i['type'])
+        if key not in before:
+            print("{:>8} {} {} ({})".format("new", i['test'], i['case'], i['type']))
+            continue
+        previous = before[key]['value']
+        if not previous:
+            continue
+        print("{:>+7.1f}% {} {} ({})".format((i['value'] - previous)/previous*100.0, i['test'], i['case'], i['type']))
+
+    return 0
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Runs benchmarks of all tests in a build directory and saves the results as JSON, or compares two result files.")
+    parser.add_argument('build_dir', nargs='?', default='.', help="build directory to run CTest in")
+    parser.add_argument('--ctest', default='ctest', help="CTest executable")
+    parser.add_argument('-C', '--config', help="build configuration, for multi-config generators")
+    parser.add_argument('-R', '--regex', help="run only tests matching given regex")
+    parser.add_argument('-o', '--output', default='benchmarks.json', help="output JSON file")
+    parser.add_argument('--compare', nargs=2, metavar=('BEFORE', 'AFTER'), help="compare two result files instead of running benchmarks, printing relative difference for each benchmark")
+    args = parser.parse_args()
+
+    sys.exit(compare(args) if args.compare else run(args))
@@ -82,9 +82,13 @@ cmake .. \
     -DMAGNUM_WITH_ANYSCENECONVERTER=OFF \
     -DMAGNUM_WITH_ANYSCENEIMPORTER=OFF \
     -DMAGNUM_WITH_ANYSHADERCONVERTER=OFF \
+    -DMAGNUM_WITH_BCNIMAGECONVERTER=OFF \
     -DMAGNUM_WITH_MAGNUMFONT=OFF \
     -DMAGNUM_WITH_MAGNUMFONTCONVERTER=OFF \
+    -DMAGNUM_WITH_MAGNUMIMPORTER=OFF \
+    -DMAGNUM_WITH_MAGNUMSCENECONVERTER=OFF \
     -DMAGNUM_WITH_OBJIMPORTER=OFF \
+    -DMAGNUM_WITH_PIXELFORMATIMAGECONVERTER=OFF \
     -DMAGNUM_WITH_TGAIMAGECONVERTER=OFF \
     -DMAGNUM_WITH_TGAIMPORTER=ON \
     -DMAGNUM_WITH_WAVAUDIOIMPORTER=OFF \
@@ -38,9 +38,13 @@ cmake .. ^
     -DMAGNUM_WITH_ANYSCENECONVERTER=ON ^
     -DMAGNUM_WITH_ANYSCENEIMPORTER=ON ^
     -DMAGNUM_WITH_ANYSHADERCONVERTER=ON ^
+    -DMAGNUM_WITH_BCNIMAGECONVERTER=ON ^
     -DMAGNUM_WITH_MAGNUMFONT=ON ^
     -DMAGNUM_WITH_MAGNUMFONTCONVERTER=ON ^
+    -DMAGNUM_WITH_MAGNUMIMPORTER=ON ^
+    -DMAGNUM_WITH_MAGNUMSCENECONVERTER=ON ^
     -DMAGNUM_WITH_OBJIMPORTER=ON ^
+    -DMAGNUM_WITH_PIXELFORMATIMAGECONVERTER=ON ^
     -DMAGNUM_WITH_TGAIMAGECONVERTER=ON ^
     -DMAGNUM_WITH_TGAIMPORTER=ON ^
     -DMAGNUM_WITH_WAVAUDIOIMPORTER=ON ^
@@ -40,9 +40,13 @@ cmake .. \
     -DMAGNUM_WITH_ANYSCENECONVERTER=OFF \
     -DMAGNUM_WITH_ANYSCENEIMPORTER=OFF \
     -DMAGNUM_WITH_ANYSHADERCONVERTER=OFF \
+    -DMAGNUM_WITH_BCNIMAGECONVERTER=ON \
     -DMAGNUM_WITH_MAGNUMFONT=ON \
     -DMAGNUM_WITH_MAGNUMFONTCONVERTER=ON \
+    -DMAGNUM_WITH_MAGNUMIMPORTER=ON \
+    -DMAGNUM_WITH_MAGNUMSCENECONVERTER=ON \
     -DMAGNUM_WITH_OBJIMPORTER=OFF \
+    -DMAGNUM_WITH_PIXELFORMATIMAGECONVERTER=ON \
     -DMAGNUM_WITH_TGAIMAGECONVERTER=ON \
     -DMAGNUM_WITH_TGAIMPORTER=ON \
     -DMAGNUM_WITH_WAVAUDIOIMPORTER=OFF \
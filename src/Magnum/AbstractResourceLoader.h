@@ -30,7 +30,10 @@
  * @brief Class @ref Magnum::AbstractResourceLoader
  */
 
+#include <initializer_list>
 #include <string>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
 
 #include "Magnum/ResourceManager.h"
 
@@ -76,6 +79,32 @@ the following code, however, the loader destroys itself (and removes itself
 from the manager) before the manager is destroyed.
 
 @snippet Magnum.cpp AbstractResourceLoader-use
+
+@section AbstractResourceLoader-prefetch Prefetching and dependencies
+
+Apart from loading resources on demand through @ref ResourceManager::get(),
+resources can be requested ahead of time using @ref prefetch() without having
+to hold a @ref Resource reference to them. A whole list of resources, for
+example everything needed by a level, can be prefetched with a single call.
+
+Resources can also declare dependencies on other resources of the same type
+using @ref addDependency(). Whenever a resource is loaded or prefetched, its
+dependencies that aren't loaded yet are requested first, so a synchronous
+loader has them already available in the @ref ResourceManager when its
+@ref doLoad() gets called for the dependent resource.
+
+@snippet Magnum.cpp AbstractResourceLoader-prefetch
+
+A prefetch request is passed to @ref doPrefetch(), which by default does the
+same as @ref doLoad(). Loaders that load in the background can reimplement it
+to process prefetch requests with a lower priority. When a resource that's
+still being loaded gets requested through @ref ResourceManager::get(), or
+when it's a dependency of a resource that gets loaded, @ref doPromote() is
+called to tell the loader the resource is needed now. The
+@ref AsyncResourceLoader implements both.
+
+For loading resources on worker threads without having to deal with
+synchronization of the @ref ResourceManager, see @ref AsyncResourceLoader.
 */
 template<class T> class AbstractResourceLoader {
     public:
@@ -127,6 +156,56 @@ template<class T> class AbstractResourceLoader {
          */
         void load(ResourceKey key);
 
+        /**
+         * @brief Request resource to be loaded ahead of time
+         * @m_since_latest
+         *
+         * If the resource isn't yet loaded or loading, its dependencies
+         * that aren't loaded or loading are prefetched first, then state of
+         * the resource is set to @ref ResourceState::Loading, count of
+         * requested features is incremented and @ref doPrefetch() is called.
+         * Otherwise does nothing. Compared to @ref load() the loader may
+         * process the request with a lower priority. See
+         * @ref AbstractResourceLoader-prefetch for more information.
+         */
+        void prefetch(ResourceKey key);
+
+        /**
+         * @brief Request a list of resources to be loaded ahead of time
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref prefetch(ResourceKey) for each item in
+         * @p keys.
+         */
+        void prefetch(Containers::ArrayView<const ResourceKey> keys);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        void prefetch(std::initializer_list<ResourceKey> keys);
+
+        /**
+         * @brief Add a resource dependency
+         * @m_since_latest
+         *
+         * Marks @p key as depending on @p dependency, causing @p dependency
+         * to be requested before @p key every time @p key is loaded or
+         * prefetched. Expects that the dependency doesn't create a cycle.
+         * Adding the same dependency more than once does nothing. See
+         * @ref AbstractResourceLoader-prefetch for more information.
+         */
+        void addDependency(ResourceKey key, ResourceKey dependency);
+
+        /**
+         * @brief Dependencies of a resource
+         * @m_since_latest
+         *
+         * Direct dependencies added with @ref addDependency(), in the order
+         * they were added.
+         */
+        Containers::Array<ResourceKey> dependencies(ResourceKey key) const;
+
     protected:
         /**
          * @brief Set loaded resource to resource manager
@@ -156,6 +235,24 @@ template<class T> class AbstractResourceLoader {
             set(key, new typename std::decay<U>::type(std::forward<U>(data)), state, policy);
         }
 
+        /**
+         * @brief Set loaded resource with a size to resource manager
+         * @m_since_latest
+         *
+         * Same as @ref set(ResourceKey, T*, ResourceDataState, ResourcePolicy),
+         * but additionally records @p size of the resource. See
+         * @ref ResourceManager-memory-budget for more information.
+         */
+        void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        void set(ResourceKey key, Containers::Pointer<T> data, ResourceDataState state, ResourcePolicy policy, std::size_t size) {
+            return set(key, data.release(), state, policy, size);
+        }
+
         /**
          * @brief Set loaded resource to resource manager
          *
@@ -207,15 +304,46 @@ template<class T> class AbstractResourceLoader {
          */
         virtual void doLoad(ResourceKey key) = 0;
 
+        /**
+         * @brief Implementation for @ref prefetch()
+         * @m_since_latest
+         *
+         * Default implementation calls @ref doLoad().
+         */
+        virtual void doPrefetch(ResourceKey key);
+
+        /**
+         * @brief Resource that's being loaded is needed now
+         * @m_since_latest
+         *
+         * Called when a resource in the @ref ResourceState::Loading state is
+         * requested through @ref ResourceManager::get() or when it's a
+         * dependency of a resource passed to @ref load(). Called for its
+         * dependencies that are still loading as well. Default
+         * implementation does nothing.
+         */
+        virtual void doPromote(ResourceKey key);
+
     private:
         #ifndef DOXYGEN_GENERATING_OUTPUT /* https://bugzilla.gnome.org/show_bug.cgi?id=776986 */
         friend Implementation::ResourceManagerData<T>;
         #endif
 
+        /* Calls doPromote() for the key and all its dependencies that are
+           still loading */
+        void promote(ResourceKey key);
+        /* Loads or prefetches dependencies that aren't there yet, promotes
+           those that are still loading if not prefetching */
+        void requestDependencies(ResourceKey key, bool prefetch);
+        bool dependsOn(ResourceKey key, ResourceKey dependency) const;
+
         Implementation::ResourceManagerData<T>* manager;
         std::size_t _requestedCount,
             _loadedCount,
             _notFoundCount;
+        /* Resource and its dependency. Expected to be small enough for a
+           linear lookup to be sufficient. */
+        Containers::Array<Containers::Pair<ResourceKey, ResourceKey>> _dependencies;
 };
 
 template<class T> AbstractResourceLoader<T>::~AbstractResourceLoader() {
@@ -224,18 +352,104 @@ template<class T> AbstractResourceLoader<T>::~AbstractResourceLoader() {
 
 template<class T> std::string AbstractResourceLoader<T>::doName(ResourceKey) const { return {}; }
 
+template<class T> void AbstractResourceLoader<T>::doPrefetch(ResourceKey key) { doLoad(key); }
+
+template<class T> void AbstractResourceLoader<T>::doPromote(ResourceKey) {}
+
 template<class T> void AbstractResourceLoader<T>::load(ResourceKey key) {
     ++_requestedCount;
     /** @todo What policy for loading resources? */
     manager->set(key, nullptr, ResourceDataState::Loading, ResourcePolicy::Resident);
 
+    requestDependencies(key, false);
     doLoad(key);
 }
 
+template<class T> void AbstractResourceLoader<T>::prefetch(ResourceKey key) {
+    if(manager->find(key) != Implementation::ResourceManagerData<T>::NoSlot)
+        return;
+
+    ++_requestedCount;
+    manager->set(key, nullptr, ResourceDataState::Loading, ResourcePolicy::Resident);
+
+    requestDependencies(key, true);
+    doPrefetch(key);
+}
+
+template<class T> void AbstractResourceLoader<T>::prefetch(const Containers::ArrayView<const ResourceKey> keys) {
+    for(const ResourceKey key: keys) prefetch(key);
+}
+
+template<class T> void AbstractResourceLoader<T>::prefetch(const std::initializer_list<ResourceKey> keys) {
+    prefetch(Containers::arrayView(keys));
+}
+
+template<class T> void AbstractResourceLoader<T>::addDependency(const ResourceKey key, const ResourceKey dependency) {
+    CORRADE_ASSERT(key != dependency && !dependsOn(dependency, key),
+        "AbstractResourceLoader::addDependency(): dependency of" << key << "on" << dependency << "would create a cycle", );
+
+    for(const Containers::Pair<ResourceKey, ResourceKey>& i: _dependencies)
+        if(i.first() == key && i.second() == dependency) return;
+
+    arrayAppend(_dependencies, InPlaceInit, key, dependency);
+}
+
+template<class T> Containers::Array<ResourceKey> AbstractResourceLoader<T>::dependencies(const ResourceKey key) const {
+    Containers::Array<ResourceKey> out;
+    for(const Containers::Pair<ResourceKey, ResourceKey>& i: _dependencies)
+        if(i.first() == key) arrayAppend(out, i.second());
+    /* Convert to a default deleter so the array can be used without
+       GrowableArray.h */
+    arrayShrink(out, DefaultInit);
+    return out;
+}
+
+template<class T> bool AbstractResourceLoader<T>::dependsOn(const ResourceKey key, const ResourceKey dependency) const {
+    for(const Containers::Pair<ResourceKey, ResourceKey>& i: _dependencies) {
+        if(i.first() != key) continue;
+        if(i.second() == dependency || dependsOn(i.second(), dependency))
+            return true;
+    }
+
+    return false;
+}
+
+template<class T> void AbstractResourceLoader<T>::requestDependencies(const ResourceKey key, const bool prefetch) {
+    /* Indexing instead of a range-for as loading a dependency may call back
+       into the loader, which could add more dependencies */
+    for(std::size_t i = 0; i != _dependencies.size(); ++i) {
+        if(_dependencies[i].first() != key) continue;
+        const ResourceKey dependency = _dependencies[i].second();
+
+        const UnsignedInt found = manager->find(dependency);
+        if(found == Implementation::ResourceManagerData<T>::NoSlot) {
+            if(prefetch) this->prefetch(dependency);
+            else load(dependency);
+        } else if(!prefetch && manager->data(found).state == ResourceDataState::Loading)
+            promote(dependency);
+    }
+}
+
+template<class T> void AbstractResourceLoader<T>::promote(const ResourceKey key) {
+    doPromote(key);
+
+    for(std::size_t i = 0; i != _dependencies.size(); ++i) {
+        if(_dependencies[i].first() != key) continue;
+
+        const UnsignedInt found = manager->find(_dependencies[i].second());
+        if(found != Implementation::ResourceManagerData<T>::NoSlot && manager->data(found).state == ResourceDataState::Loading)
+            promote(_dependencies[i].second());
+    }
+}
+
 template<class T> void AbstractResourceLoader<T>::set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy) {
+    set(key, data, state, policy, 0);
+}
+
+template<class T> void AbstractResourceLoader<T>::set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size) {
     if(data) ++_loadedCount;
     if(!data && state == ResourceDataState::NotFound) ++_notFoundCount;
-    manager->set(key, data, state, policy);
+    manager->set(key, data, state, policy, size);
 }
 
 }
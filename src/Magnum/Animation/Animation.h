@@ -44,8 +44,13 @@ template<class V> using ResultOf = typename Implementation::ResultTraits<V>::Typ
 
 enum class Interpolation: UnsignedByte;
 enum class Extrapolation: UnsignedByte;
+enum class BlendMode: UnsignedByte;
+
+class BatchPlayer;
+class PackedQuaternion;
 
 template<class T, class K = T> class Player;
+class PoseBlender;
 
 template<class K, class V, class R = ResultOf<V>> class Track;
 template<class K> class TrackViewStorage;
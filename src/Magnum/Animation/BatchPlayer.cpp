@@ -0,0 +1,361 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BatchPlayer.h"
+
+#include <cmath>
+#include <Corrade/Containers/GrowableArray.h>
+
+#include "Magnum/Math/QuaternionBatch.h"
+
+namespace Magnum { namespace Animation {
+
+namespace Implementation {
+
+struct BatchPlayerTrack {
+    TrackViewStorage<const Float> track;
+    BatchPlayerKernel kernel;
+    void(*evaluate)(BatchPlayerTrack&, BatchPlayerScratch&, std::size_t, bool);
+    Containers::StridedArrayView1D<void> destination;
+    /* Keyframe search hint for every instance */
+    Containers::Array<UnsignedInt> hints;
+};
+
+/* Temporary memory for advance(), allocated upfront for all instances. The
+   quaternion arrays are allocated only once a quaternion track is added. */
+struct BatchPlayerScratch {
+    Containers::Array<UnsignedInt> instances;
+    Containers::Array<Float> keys;
+    Containers::Array<UnsignedInt> keyframes;
+    Containers::Array<Float> factors;
+    Containers::Array<UnsignedInt> defaults;
+    Containers::Array<Quaternion> quaternionsA;
+    Containers::Array<Quaternion> quaternionsB;
+    Containers::Array<Quaternion> quaternionsResult;
+};
+
+}
+
+namespace {
+
+/* Finds the keyframe and interpolation factor for all instances in the
+   scratch, in the same way as interpolate() does. Returns count of items for
+   which a default-constructed value should be used, their indices are put
+   into scratch.defaults. Expects at least one keyframe. */
+std::size_t findKeyframes(const Containers::StridedArrayView1D<const Float>& keys, const Extrapolation before, const Extrapolation after, const Containers::ArrayView<UnsignedInt> hints, Implementation::BatchPlayerScratch& scratch, const std::size_t count) {
+    std::size_t defaultCount = 0;
+
+    /* Only one frame, use it verbatim (or default-constructed, if desired) */
+    if(keys.size() == 1) {
+        for(std::size_t i = 0; i != count; ++i) {
+            const Float key = scratch.keys[i];
+            scratch.keyframes[i] = 0;
+            scratch.factors[i] = 0.0f;
+            if((key < keys[0] && before == Extrapolation::DefaultConstructed) ||
+               (key > keys[0] && after == Extrapolation::DefaultConstructed))
+                scratch.defaults[defaultCount++] = i;
+        }
+
+        return defaultCount;
+    }
+
+    for(std::size_t i = 0; i != count; ++i) {
+        Float key = scratch.keys[i];
+        UnsignedInt& hint = hints[scratch.instances[i]];
+
+        /* Find a pair that is around given time */
+        hint = Implementation::findKeyframe(keys, key, hint);
+
+        /* Special extrapolation outside of range */
+        if(key < keys[hint]) {
+            if(before == Extrapolation::DefaultConstructed)
+                scratch.defaults[defaultCount++] = i;
+            else if(before == Extrapolation::Constant)
+                key = keys[hint];
+        } else if(key >= keys[hint + 1]) {
+            if(after == Extrapolation::DefaultConstructed)
+                scratch.defaults[defaultCount++] = i;
+            else if(after == Extrapolation::Constant)
+                key = keys[hint + 1];
+        }
+
+        scratch.keyframes[i] = hint;
+        scratch.factors[i] = Math::lerpInverted(keys[hint], keys[hint + 1], key);
+    }
+
+    return defaultCount;
+}
+
+/* Generic types don't have any batch kernels */
+template<class V> bool interpolateBatch(const Implementation::BatchPlayerTrack&, const Containers::StridedArrayView1D<const V>&, std::size_t, Implementation::BatchPlayerScratch&, std::size_t, bool) {
+    return false;
+}
+
+bool interpolateBatch(const Implementation::BatchPlayerTrack& track, const Containers::StridedArrayView1D<const Quaternion>& values, const std::size_t next, Implementation::BatchPlayerScratch& scratch, const std::size_t count, const bool allInstances) {
+    void(*interpolateInto)(const Containers::StridedArrayView1D<const Quaternion>&, const Containers::StridedArrayView1D<const Quaternion>&, const Containers::StridedArrayView1D<const Float>&, const Containers::StridedArrayView1D<Quaternion>&);
+    switch(track.kernel) {
+        case Implementation::BatchPlayerKernel::Lerp:
+            interpolateInto = Math::lerpInto;
+            break;
+        case Implementation::BatchPlayerKernel::LerpShortestPath:
+            interpolateInto = Math::lerpShortestPathInto;
+            break;
+        case Implementation::BatchPlayerKernel::Slerp:
+            interpolateInto = Math::slerpInto;
+            break;
+        case Implementation::BatchPlayerKernel::SlerpShortestPath:
+            interpolateInto = Math::slerpShortestPathInto;
+            break;
+        default:
+            return false;
+    }
+
+    /* Gather the keyframe pairs into contiguous arrays */
+    const Containers::ArrayView<Quaternion> a = scratch.quaternionsA.prefix(count);
+    const Containers::ArrayView<Quaternion> b = scratch.quaternionsB.prefix(count);
+    for(std::size_t i = 0; i != count; ++i) {
+        a[i] = values[scratch.keyframes[i]];
+        b[i] = values[scratch.keyframes[i] + next];
+    }
+
+    /* If all instances are updated, interpolate directly into the
+       destination, otherwise go through a temporary and scatter the results
+       afterwards */
+    const Containers::StridedArrayView1D<Quaternion> destination = Containers::arrayCast<Quaternion>(track.destination);
+    if(allInstances) {
+        interpolateInto(a, b, scratch.factors.prefix(count), destination);
+    } else {
+        const Containers::ArrayView<Quaternion> result = scratch.quaternionsResult.prefix(count);
+        interpolateInto(a, b, scratch.factors.prefix(count), result);
+        for(std::size_t i = 0; i != count; ++i)
+            destination[scratch.instances[i]] = result[i];
+    }
+
+    return true;
+}
+
+template<class V> void evaluate(Implementation::BatchPlayerTrack& track, Implementation::BatchPlayerScratch& scratch, const std::size_t count, const bool allInstances) {
+    const TrackView<const Float, const V>& view = static_cast<const TrackView<const Float, const V>&>(track.track);
+    const Containers::StridedArrayView1D<const V> values = view.values();
+    const Containers::StridedArrayView1D<V> destination = Containers::arrayCast<V>(track.destination);
+
+    /* No data, use a default-constructed value */
+    if(values.isEmpty()) {
+        for(std::size_t i = 0; i != count; ++i)
+            destination[scratch.instances[i]] = V{};
+        return;
+    }
+
+    const std::size_t defaultCount = findKeyframes(view.keys(), view.before(), view.after(), track.hints, scratch, count);
+
+    /* With just a single keyframe it's used for both sides of the
+       interpolator */
+    const std::size_t next = values.size() == 1 ? 0 : 1;
+
+    /* Interpolate with a batch kernel if there's one, otherwise in a loop
+       specialized for given interpolator */
+    if(!interpolateBatch(track, values, next, scratch, count, allInstances)) switch(track.kernel) {
+        case Implementation::BatchPlayerKernel::Select:
+            for(std::size_t i = 0; i != count; ++i) {
+                const UnsignedInt keyframe = scratch.keyframes[i];
+                destination[scratch.instances[i]] = Math::select(values[keyframe], values[keyframe + next], scratch.factors[i]);
+            }
+            break;
+        case Implementation::BatchPlayerKernel::Lerp:
+            for(std::size_t i = 0; i != count; ++i) {
+                const UnsignedInt keyframe = scratch.keyframes[i];
+                destination[scratch.instances[i]] = Math::lerp(values[keyframe], values[keyframe + next], scratch.factors[i]);
+            }
+            break;
+        default: {
+            const auto interpolator = view.interpolator();
+            for(std::size_t i = 0; i != count; ++i) {
+                const UnsignedInt keyframe = scratch.keyframes[i];
+                destination[scratch.instances[i]] = interpolator(values[keyframe], values[keyframe + next], scratch.factors[i]);
+            }
+        }
+    }
+
+    /* Overwrite values that should be default-constructed */
+    for(std::size_t i = 0; i != defaultCount; ++i)
+        destination[scratch.instances[scratch.defaults[i]]] = V{};
+}
+
+}
+
+BatchPlayer::BatchPlayer(const std::size_t instanceCount): _scratch{InPlaceInit}, _startTimes{ValueInit, instanceCount}, _states{DirectInit, instanceCount, State::Stopped}, _parkPending{ValueInit, instanceCount} {
+    _scratch->instances = Containers::Array<UnsignedInt>{NoInit, instanceCount};
+    _scratch->keys = Containers::Array<Float>{NoInit, instanceCount};
+    _scratch->keyframes = Containers::Array<UnsignedInt>{NoInit, instanceCount};
+    _scratch->factors = Containers::Array<Float>{NoInit, instanceCount};
+    _scratch->defaults = Containers::Array<UnsignedInt>{NoInit, instanceCount};
+}
+
+BatchPlayer::BatchPlayer(BatchPlayer&&) noexcept = default;
+
+BatchPlayer::~BatchPlayer() = default;
+
+BatchPlayer& BatchPlayer::operator=(BatchPlayer&&) noexcept = default;
+
+bool BatchPlayer::isEmpty() const {
+    return _tracks.isEmpty();
+}
+
+std::size_t BatchPlayer::size() const {
+    return _tracks.size();
+}
+
+auto BatchPlayer::evaluatorFloat() -> Evaluator { return evaluate<Float>; }
+auto BatchPlayer::evaluatorVector2() -> Evaluator { return evaluate<Vector2>; }
+auto BatchPlayer::evaluatorVector3() -> Evaluator { return evaluate<Vector3>; }
+auto BatchPlayer::evaluatorVector4() -> Evaluator { return evaluate<Vector4>; }
+auto BatchPlayer::evaluatorQuaternion() -> Evaluator { return evaluate<Quaternion>; }
+
+BatchPlayer& BatchPlayer::addInternal(const TrackViewStorage<const Float>& track, const Implementation::BatchPlayerKernel kernel, const Containers::StridedArrayView1D<void>& destination, const Evaluator evaluator) {
+    const std::size_t instanceCount = _startTimes.size();
+    CORRADE_ASSERT(destination.size() == instanceCount,
+        "Animation::BatchPlayer::add(): expected destination view to have" << instanceCount << "items but got" << destination.size(), *this);
+
+    /* Allocate temporaries for the quaternion batch kernels on the first
+       quaternion track that uses them */
+    if(evaluator == evaluate<Quaternion> && kernel != Implementation::BatchPlayerKernel::Select && kernel != Implementation::BatchPlayerKernel::Custom && _scratch->quaternionsA.isEmpty()) {
+        _scratch->quaternionsA = Containers::Array<Quaternion>{NoInit, instanceCount};
+        _scratch->quaternionsB = Containers::Array<Quaternion>{NoInit, instanceCount};
+        _scratch->quaternionsResult = Containers::Array<Quaternion>{NoInit, instanceCount};
+    }
+
+    if(_tracks.isEmpty() && _duration == Math::Range1D<Float>{})
+        _duration = track.duration();
+    else
+        _duration = Math::join(track.duration(), _duration);
+    arrayAppend(_tracks, Implementation::BatchPlayerTrack{track, kernel, evaluator, destination, Containers::Array<UnsignedInt>{ValueInit, instanceCount}});
+    return *this;
+}
+
+State BatchPlayer::state(const std::size_t instance) const {
+    CORRADE_ASSERT(instance < _states.size(),
+        "Animation::BatchPlayer::state(): index" << instance << "out of range for" << _states.size() << "instances", {});
+    return _states[instance];
+}
+
+BatchPlayer& BatchPlayer::play(const std::size_t instance, const Float startTime) {
+    CORRADE_ASSERT(instance < _states.size(),
+        "Animation::BatchPlayer::play(): index" << instance << "out of range for" << _states.size() << "instances", *this);
+    _states[instance] = State::Playing;
+    _startTimes[instance] = startTime;
+    _parkPending.reset(instance);
+    return *this;
+}
+
+BatchPlayer& BatchPlayer::play(const Float startTime) {
+    for(std::size_t i = 0; i != _states.size(); ++i) {
+        _states[i] = State::Playing;
+        _startTimes[i] = startTime;
+    }
+    _parkPending.resetAll();
+    return *this;
+}
+
+BatchPlayer& BatchPlayer::play(const Containers::StridedArrayView1D<const Float>& startTimes) {
+    CORRADE_ASSERT(startTimes.size() == _states.size(),
+        "Animation::BatchPlayer::play(): expected" << _states.size() << "start times but got" << startTimes.size(), *this);
+    for(std::size_t i = 0; i != _states.size(); ++i) {
+        _states[i] = State::Playing;
+        _startTimes[i] = startTimes[i];
+    }
+    _parkPending.resetAll();
+    return *this;
+}
+
+BatchPlayer& BatchPlayer::stop(const std::size_t instance) {
+    CORRADE_ASSERT(instance < _states.size(),
+        "Animation::BatchPlayer::stop(): index" << instance << "out of range for" << _states.size() << "instances", *this);
+    _states[instance] = State::Stopped;
+    _parkPending.set(instance);
+    return *this;
+}
+
+BatchPlayer& BatchPlayer::stop() {
+    for(State& state: _states) state = State::Stopped;
+    _parkPending.setAll();
+    return *this;
+}
+
+BatchPlayer& BatchPlayer::advance(const Float time) {
+    Implementation::BatchPlayerScratch& scratch = *_scratch;
+    const Float duration = _duration.size();
+
+    /* Calculate the key for every instance that should be updated, in the
+       same way as Player::advance() with the default scaler */
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != _states.size(); ++i) {
+        Float key;
+
+        /* The instance was stopped by the user right before this iteration,
+           "park" it to the initial time */
+        if(_states[i] == State::Stopped && _parkPending[i]) {
+            _parkPending.reset(i);
+            key = 0.0f;
+
+        /* Otherwise, if the instance is not playing or scheduled to start
+           playing in the future, skip it */
+        } else if(_states[i] != State::Playing || time < _startTimes[i]) {
+            continue;
+
+        /* If the duration is empty, infinitely advance to a key at duration
+           start, or stop the instance if the play count is finite */
+        } else if(duration == 0.0f) {
+            key = 0.0f;
+            if(_playCount) _states[i] = State::Stopped;
+
+        /* Otherwise calculate current play iteration and key value in that
+           iteration. If we exceeded play count, stop the instance and give
+           out value at duration end. */
+        } else {
+            const Float elapsed = time - _startTimes[i];
+            const UnsignedInt playIteration = elapsed/duration;
+            key = Float(std::fmod(Double(elapsed), Double(duration)));
+            if(_playCount && playIteration >= _playCount) {
+                _states[i] = State::Stopped;
+                key = duration;
+            }
+        }
+
+        scratch.instances[count] = i;
+        scratch.keys[count] = _duration.min() + key;
+        ++count;
+    }
+
+    if(!count) return *this;
+
+    const bool allInstances = count == _states.size();
+    for(Implementation::BatchPlayerTrack& track: _tracks)
+        track.evaluate(track, scratch, count, allInstances);
+
+    return *this;
+}
+
+}}
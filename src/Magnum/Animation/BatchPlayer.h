@@ -0,0 +1,350 @@
+#ifndef Magnum_Animation_BatchPlayer_h
+#define Magnum_Animation_BatchPlayer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Animation::BatchPlayer
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Animation/Player.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace Animation {
+
+namespace Implementation {
+    struct BatchPlayerTrack;
+    struct BatchPlayerScratch;
+
+    enum class BatchPlayerKernel: UnsignedByte {
+        Custom,
+        Select,
+        Lerp,
+        LerpShortestPath,
+        Slerp,
+        SlerpShortestPath
+    };
+
+    /* Has to be done in the header, as the interpolator function pointers
+       are compared to instantiations in user code */
+    template<class V> BatchPlayerKernel batchPlayerKernel(V(*const interpolator)(const V&, const V&, Float)) {
+        typedef V(*Interpolator)(const V&, const V&, Float);
+        if(interpolator == static_cast<Interpolator>(Math::select))
+            return BatchPlayerKernel::Select;
+        if(interpolator == static_cast<Interpolator>(Math::lerp))
+            return BatchPlayerKernel::Lerp;
+        return BatchPlayerKernel::Custom;
+    }
+    template<> inline BatchPlayerKernel batchPlayerKernel<Quaternion>(Quaternion(*const interpolator)(const Quaternion&, const Quaternion&, Float)) {
+        typedef Quaternion(*Interpolator)(const Quaternion&, const Quaternion&, Float);
+        /* The default interpolators are instantiated inside the library, so
+           they may have a different address than the ones in user code */
+        if(interpolator == static_cast<Interpolator>(Math::select) ||
+           interpolator == interpolatorFor<Quaternion>(Interpolation::Constant))
+            return BatchPlayerKernel::Select;
+        if(interpolator == static_cast<Interpolator>(Math::lerp))
+            return BatchPlayerKernel::Lerp;
+        if(interpolator == static_cast<Interpolator>(Math::lerpShortestPath))
+            return BatchPlayerKernel::LerpShortestPath;
+        if(interpolator == static_cast<Interpolator>(Math::slerp))
+            return BatchPlayerKernel::Slerp;
+        if(interpolator == static_cast<Interpolator>(Math::slerpShortestPath) ||
+           interpolator == interpolatorFor<Quaternion>(Interpolation::Linear))
+            return BatchPlayerKernel::SlerpShortestPath;
+        return BatchPlayerKernel::Custom;
+    }
+}
+
+/**
+@brief Batch animation player
+@m_since_latest
+
+A data-oriented counterpart to @ref Player for playing the same animation clip
+on many instances at once, such as a crowd of characters sharing the same
+skeleton and animation. Each track is added just once and its interpolated
+values are written into a strided destination view with one item per
+instance. The instances have their own playback state but share the
+@ref duration() and @ref playCount().
+
+@section Animation-BatchPlayer-usage Usage
+
+The player is constructed with an instance count, tracks are then added
+together with destination views that have exactly that many items. The
+following plays a translation and rotation track on a thousand instances,
+writing the results into an array of structures:
+
+@snippet Animation.cpp BatchPlayer-usage
+
+Compared to the @ref Player, the time and key type is always
+@ref Magnum::Float "Float", there's no notion of a paused state and the
+results are only written into destination views, without firing any
+callbacks. Only tracks of @ref Magnum::Float "Float",
+@ref Magnum::Vector2 "Vector2", @ref Magnum::Vector3 "Vector3",
+@ref Magnum::Vector4 "Vector4" and @ref Magnum::Quaternion "Quaternion"
+values are supported, which covers the common case of skeletal animation.
+Use the @ref Player for anything else.
+
+@section Animation-BatchPlayer-performance Performance considerations
+
+In @ref advance(), the elapsed time of all instances is calculated first.
+Then, for each track, the keyframe search is done for all instances that
+need an update, after which the values are interpolated in a tight loop
+specialized for the interpolator function, without any indirect call per
+instance. Quaternion tracks interpolated with @ref Math::lerp(),
+@ref Math::lerpShortestPath(), @ref Math::slerp() or
+@ref Math::slerpShortestPath() go through the SIMD-optimized
+@ref Math::lerpInto(), @ref Math::lerpShortestPathInto(),
+@ref Math::slerpInto() and @ref Math::slerpShortestPathInto() batch
+functions. Tracks with other interpolator functions call the interpolator for
+every instance.
+
+Every track keeps a keyframe search hint for every instance, so the search
+has the same complexity as in the @ref Player. Quaternion results computed
+by the SIMD kernels can differ from the @ref Player output in the last few
+bits.
+@experimental
+*/
+class MAGNUM_EXPORT BatchPlayer {
+    public:
+        /**
+         * @brief Constructor
+         * @param instanceCount     Instance count
+         *
+         * All instances are initially in a @ref State::Stopped state.
+         */
+        explicit BatchPlayer(std::size_t instanceCount);
+
+        /** @brief Copying is not allowed */
+        BatchPlayer(const BatchPlayer&) = delete;
+
+        /** @brief Move constructor */
+        BatchPlayer(BatchPlayer&&) noexcept;
+
+        ~BatchPlayer();
+
+        /** @brief Copying is not allowed */
+        BatchPlayer& operator=(const BatchPlayer&) = delete;
+
+        /** @brief Move assignment */
+        BatchPlayer& operator=(BatchPlayer&&) noexcept;
+
+        /** @brief Instance count */
+        std::size_t instanceCount() const { return _startTimes.size(); }
+
+        /**
+         * @brief Duration
+         *
+         * Shared by all instances. If the duration was not set explicitly
+         * using @ref setDuration(), returns value calculated implicitly from
+         * all added tracks. If no tracks are added, returns default-constructed
+         * value.
+         * @see @ref Player::duration()
+         */
+        Math::Range1D<Float> duration() const { return _duration; }
+
+        /**
+         * @brief Set duration
+         *
+         * Behaves the same as @ref Player::setDuration().
+         */
+        BatchPlayer& setDuration(const Math::Range1D<Float>& duration) {
+            _duration = duration;
+            return *this;
+        }
+
+        /** @brief Play count */
+        UnsignedInt playCount() const { return _playCount; }
+
+        /**
+         * @brief Set play count
+         *
+         * Shared by all instances. By default, the animation plays once. Set
+         * the count to @cpp 0 @ce to make it repeat indefinitely.
+         * @see @ref Player::setPlayCount()
+         */
+        BatchPlayer& setPlayCount(UnsignedInt count) {
+            _playCount = count;
+            return *this;
+        }
+
+        /**
+         * @brief Whether the player is empty
+         *
+         * @see @ref size()
+         */
+        bool isEmpty() const;
+
+        /**
+         * @brief Count of tracks managed by this player
+         *
+         * @see @ref isEmpty()
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief Add a track shared by all instances
+         * @param track         Track to add
+         * @param destination   Destination with one item per instance
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p destination has exactly @ref instanceCount() items.
+         * The @p track and @p destination are expected to stay in scope for
+         * the whole player lifetime. Similarly to @ref Player::add(), the
+         * @ref duration() is extended to span the track duration.
+         */
+        BatchPlayer& add(const TrackView<const Float, const Float>& track, const Containers::StridedArrayView1D<Float>& destination) {
+            return addInternal(track, Implementation::batchPlayerKernel(track.interpolator()), destination, evaluatorFloat());
+        }
+
+        /** @overload */
+        BatchPlayer& add(const TrackView<const Float, const Vector2>& track, const Containers::StridedArrayView1D<Vector2>& destination) {
+            return addInternal(track, Implementation::batchPlayerKernel(track.interpolator()), destination, evaluatorVector2());
+        }
+
+        /** @overload */
+        BatchPlayer& add(const TrackView<const Float, const Vector3>& track, const Containers::StridedArrayView1D<Vector3>& destination) {
+            return addInternal(track, Implementation::batchPlayerKernel(track.interpolator()), destination, evaluatorVector3());
+        }
+
+        /** @overload */
+        BatchPlayer& add(const TrackView<const Float, const Vector4>& track, const Containers::StridedArrayView1D<Vector4>& destination) {
+            return addInternal(track, Implementation::batchPlayerKernel(track.interpolator()), destination, evaluatorVector4());
+        }
+
+        /** @overload */
+        BatchPlayer& add(const TrackView<const Float, const Quaternion>& track, const Containers::StridedArrayView1D<Quaternion>& destination) {
+            return addInternal(track, Implementation::batchPlayerKernel(track.interpolator()), destination, evaluatorQuaternion());
+        }
+
+        /** @overload */
+        template<class V> BatchPlayer& add(const TrackView<Float, V>& track, const Containers::StridedArrayView1D<typename std::remove_const<V>::type>& destination) {
+            return add(reinterpret_cast<const TrackView<const Float, const V>&>(track), destination);
+        }
+
+        /** @overload */
+        template<class V> BatchPlayer& add(const Track<Float, V>& track, const Containers::StridedArrayView1D<typename std::remove_const<V>::type>& destination) {
+            return add(TrackView<const Float, const V>{track}, destination);
+        }
+
+        /**
+         * @brief State of given instance
+         *
+         * Expects that @p instance is less than @ref instanceCount(). Only
+         * @ref State::Playing and @ref State::Stopped is ever returned.
+         */
+        State state(std::size_t instance) const;
+
+        /**
+         * @brief Play given instance
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p instance is less than @ref instanceCount(). The
+         * instance starts playing from the beginning at @p startTime, even if
+         * it's already playing.
+         * @see @ref Player::play()
+         */
+        BatchPlayer& play(std::size_t instance, Float startTime);
+
+        /**
+         * @brief Play all instances
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to calling @ref play(std::size_t, Float) for all
+         * instances with the same @p startTime.
+         */
+        BatchPlayer& play(Float startTime);
+
+        /**
+         * @brief Play all instances with different start times
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p startTimes has exactly @ref instanceCount() items.
+         * Equivalent to calling @ref play(std::size_t, Float) for all
+         * instances.
+         */
+        BatchPlayer& play(const Containers::StridedArrayView1D<const Float>& startTimes);
+
+        /**
+         * @brief Stop given instance
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p instance is less than @ref instanceCount(). The
+         * next @ref advance() parks the instance at the beginning of
+         * @ref duration(), after that it's not updated until played again.
+         * @see @ref Player::stop()
+         */
+        BatchPlayer& stop(std::size_t instance);
+
+        /**
+         * @brief Stop all instances
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to calling @ref stop(std::size_t) for all instances.
+         */
+        BatchPlayer& stop();
+
+        /**
+         * @brief Advance all instances
+         * @return Reference to self (for method chaining)
+         *
+         * For every instance behaves the same as @ref Player::advance(),
+         * updating all destination items of instances that are playing,
+         * have just run out of their play count or were stopped since the
+         * last call. Items of other instances are left untouched.
+         */
+        BatchPlayer& advance(Float time);
+
+    private:
+        typedef void(*Evaluator)(Implementation::BatchPlayerTrack&, Implementation::BatchPlayerScratch&, std::size_t, bool);
+
+        static Evaluator evaluatorFloat();
+        static Evaluator evaluatorVector2();
+        static Evaluator evaluatorVector3();
+        static Evaluator evaluatorVector4();
+        static Evaluator evaluatorQuaternion();
+
+        BatchPlayer& addInternal(const TrackViewStorage<const Float>& track, Implementation::BatchPlayerKernel kernel, const Containers::StridedArrayView1D<void>& destination, Evaluator evaluator);
+
+        Containers::Array<Implementation::BatchPlayerTrack> _tracks;
+        Containers::Pointer<Implementation::BatchPlayerScratch> _scratch;
+        /* Per-instance state */
+        Containers::Array<Float> _startTimes;
+        Containers::Array<State> _states;
+        Containers::BitArray _parkPending;
+        Math::Range1D<Float> _duration;
+        UnsignedInt _playCount{1};
+};
+
+}}
+
+#endif
@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Alias @ref Magnum::Animation::ResultOf, enum @ref Magnum::Animation::Interpolation. @ref Magnum::Animation::Extrapolation, function @ref Magnum::Animation::interpolatorFor(), @ref Magnum::Animation::interpolate(), @ref Magnum::Animation::interpolateStrict(), @ref Magnum::Animation::ease(), @ref Magnum::Animation::easeClamped() @ref Magnum::Animation::unpack(), @ref Magnum::Animation::unpackEase(), @ref Magnum::Animation::unpackEaseClamped()
+ * @brief Alias @ref Magnum::Animation::ResultOf, enum @ref Magnum::Animation::Interpolation. @ref Magnum::Animation::Extrapolation, function @ref Magnum::Animation::interpolatorFor(), @ref Magnum::Animation::interpolate(), @ref Magnum::Animation::interpolateStrict(), @ref Magnum::Animation::interpolateInto(), @ref Magnum::Animation::interpolateFixedRate(), @ref Magnum::Animation::ease(), @ref Magnum::Animation::easeClamped() @ref Magnum::Animation::unpack(), @ref Magnum::Animation::unpackEase(), @ref Magnum::Animation::unpackEaseClamped()
  */
 
 #include <Corrade/Containers/StridedArrayView.h>
@@ -176,8 +176,8 @@ MAGNUM_EXPORT Debug& operator<<(Debug& debug, Extrapolation value);
 @param frame        Frame at which to interpolate
 @param hint         Hint for keyframe search
 
-Does a linear search over the keyframes until it finds last keyframe which is
-not larger than @p frame. Once the keyframe is found, reference to it and the immediately following keyframe is passed to @p interpolator along with
+Searches for the last keyframe which is not larger than @p frame. Once the
+keyframe is found, reference to it and the immediately following keyframe is passed to @p interpolator along with
 calculated interpolation factor, returning the interpolated value.
 
 -   In case the first keyframe is already larger than @p frame or @p frame is
@@ -188,14 +188,18 @@ calculated interpolation factor, returning the interpolated value.
     the interpolator.
 -   In case no keyframes are present, default-constructed value is returned.
 
-The @p hint parameter hints where to start the linear search and is updated
-with keyframe index matching @p frame. If @p frame is earlier than @p hint, the
-search is restarted from the beginning.
+The @p hint parameter hints where to start the search and is updated with
+keyframe index matching @p frame. If @p frame is in the same or the
+immediately following keyframe pair as @p hint, which is the common case when
+playing an animation forward, the keyframe is found in constant time.
+Otherwise, such as when seeking, the remaining range is searched using a
+binary search.
 
 Used internally from @ref Track::at() / @ref TrackView::at(), see @ref Track
 documentation for more information.
 
-@see @ref interpolateStrict(), @ref Math::select(), @ref Math::lerp(),
+@see @ref interpolateStrict(), @ref interpolateInto(),
+    @ref interpolateFixedRate(), @ref Math::select(), @ref Math::lerp(),
     @ref Math::slerp(), @ref Math::sclerp()
 @experimental
 */
@@ -204,12 +208,11 @@ template<class K, class V, class R = ResultOf<V>> R interpolate(const Containers
 /**
 @brief Interpolate animation value with strict constraints
 
-Does a linear search over the keyframes until it finds last keyframe which is
-not larger than @p frame. Once the keyframe is found, reference to it and the immediately following keyframe is passed to @p interpolator along with
+Searches for the last keyframe which is not larger than @p frame. Once the
+keyframe is found, reference to it and the immediately following keyframe is passed to @p interpolator along with
 calculated interpolation factor, returning the interpolated value. The @p hint
-parameter hints where to start the linear search and is updated with keyframe
-index matching @p frame. If @p frame is earlier than @p hint, the search is
-restarted from the beginning.
+parameter hints where to start the search and is updated with keyframe index
+matching @p frame, see @ref interpolate() for details.
 
 This is a stricter but more performant version of @ref interpolate() with
 implicit @ref Extrapolation::Extrapolated behavior. Expects that there are
@@ -224,6 +227,50 @@ Used internally from @ref Track::atStrict() / @ref TrackView::atStrict(), see
 */
 template<class K, class V, class R = ResultOf<V>> R interpolateStrict(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView1D<const V>& values, R(*interpolator)(const V&, const V&, Float), K frame, std::size_t& hint);
 
+/**
+@brief Interpolate values of multiple tracks sharing the same keys
+@param keys         Keys
+@param values       Values, first dimension being keyframes and second
+    dimension tracks
+@param before       Extrapolation mode before first keyframe
+@param after        Extrapolation mode after last keyframe
+@param interpolator Interpolator function
+@param frame        Frame at which to interpolate
+@param hint         Hint for keyframe search
+@param destination  Where to put the interpolated value for each track
+@m_since_latest
+
+Equivalent to calling @ref interpolate() for each column of @p values and
+writing the result to the corresponding item of @p destination, but the
+keyframe search, extrapolation handling and interpolation factor calculation
+is done just once for all tracks. Useful for example for skeletal animations
+where all joints are sampled at the same times. Expects that the first
+dimension of @p values has the same size as @p keys and the second dimension
+has the same size as @p destination.
+@experimental
+*/
+template<class K, class V, class R> void interpolateInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, Extrapolation before, Extrapolation after, R(*interpolator)(const V&, const V&, Float), K frame, std::size_t& hint, const Containers::StridedArrayView1D<R>& destination);
+
+/**
+@brief Interpolate animation value with keyframes at a fixed rate
+@param begin        Key of the first keyframe
+@param step         Distance between two consecutive keys
+@param values       Values
+@param before       Extrapolation mode before first keyframe
+@param after        Extrapolation mode after last keyframe
+@param interpolator Interpolator function
+@param frame        Frame at which to interpolate
+@m_since_latest
+
+Equivalent to @ref interpolate() with keys being
+@cpp begin + i*step @ce for each item @cpp i @ce in @p values, but the
+keyframe index is calculated directly from @p frame instead of being searched
+for, which makes this function constant-time and without any need for a hint.
+Useful for baked or resampled animations. Expects that @p step is positive.
+@experimental
+*/
+template<class K, class V, class R = ResultOf<V>> R interpolateFixedRate(K begin, K step, const Containers::StridedArrayView1D<const V>& values, Extrapolation before, Extrapolation after, R(*interpolator)(const V&, const V&, Float), K frame);
+
 /**
 @brief Combine easing function and an interpolator
 
@@ -409,6 +456,33 @@ TypeTraits<Math::CubicHermite<T>, T> {
     Interpolator interpolator(Interpolation interpolation);
 };
 
+/* Finds the last keyframe that's not larger than given frame, clamped to
+   [0, keys.size() - 2]. Expects at least two keys. If the hint is in the same
+   or the next keyframe pair, which is the common case for forward playback,
+   it's found in constant time, otherwise a binary search is done in the
+   remaining range. */
+template<class K> std::size_t findKeyframe(const Containers::StridedArrayView1D<const K>& keys, const K& frame, const std::size_t hint) {
+    const std::size_t last = keys.size() - 2;
+    std::size_t begin = 0;
+    if(hint < keys.size() && !(frame < keys[hint])) {
+        if(hint >= last || frame < keys[hint + 1])
+            return Math::min(hint, last);
+        if(hint + 1 == last || frame < keys[hint + 2])
+            return hint + 1;
+        begin = hint + 2;
+    }
+
+    /* Keys[begin] is not larger than the frame here (or begin is zero), find
+       the last such key in [begin, last] */
+    std::size_t end = last + 1;
+    while(end - begin > 1) {
+        const std::size_t middle = begin + (end - begin)/2;
+        if(frame < keys[middle]) end = middle;
+        else begin = middle;
+    }
+    return begin;
+}
+
 }
 
 /* Needs to be defined later so it can pick up the TypeTraits definitions */
@@ -431,12 +505,8 @@ template<class K, class V, class R> R interpolate(const Containers::StridedArray
         return interpolator(values[0], values[0], 0.0f);
     }
 
-    /* Rewind from the beginning if hint is too late */
-    if(hint >= keys.size() || frame < keys[hint]) hint = 0;
-
-    /* Go through the keys until we find a pair that is around given time */
-    while(hint + 2 < keys.size() && frame >= keys[hint + 1])
-        ++hint;
+    /* Find a pair that is around given time */
+    hint = Implementation::findKeyframe(keys, frame, hint);
 
     /* Special extrapolation outside of range. Usual extrapolation is handled
        below. */
@@ -456,17 +526,97 @@ template<class K, class V, class R> R interpolateStrict(const Containers::Stride
     CORRADE_ASSERT(keys.size() >= 2, "Animation::interpolateStrict(): at least two keyframes required", {});
     CORRADE_ASSERT(keys.size() == values.size(), "Animation::interpolateStrict(): keys and values don't have the same size", {});
 
-    /* Rewind from the beginning if hint is too late */
-    if(hint >= keys.size() || frame < keys[hint]) hint = 0;
-
-    /* Go through the keys until we find a pair that is around given time */
-    while(hint + 2 < keys.size() && frame >= keys[hint + 1])
-        ++hint;
+    /* Find a pair that is around given time */
+    hint = Implementation::findKeyframe(keys, frame, hint);
 
     return interpolator(values[hint], values[hint + 1],
         Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame)));
 }
 
+template<class K, class V, class R> void interpolateInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, const Extrapolation before, const Extrapolation after, R(*const interpolator)(const V&, const V&, Float), K frame, std::size_t& hint, const Containers::StridedArrayView1D<R>& destination) {
+    CORRADE_ASSERT(keys.size() == values.size()[0],
+        "Animation::interpolateInto(): expected" << keys.size() << "keyframes but got" << values.size()[0], );
+    CORRADE_ASSERT(destination.size() == values.size()[1],
+        "Animation::interpolateInto(): expected destination view to have" << values.size()[1] << "items but got" << destination.size(), );
+
+    /* Default-constructed value for everything if there's no data or if
+       requested by the extrapolation mode */
+    bool defaultConstructed = !keys.size();
+
+    /* Only one frame, use it verbatim */
+    std::size_t first = 0, second = 0;
+    Float factor = 0.0f;
+    if(keys.size() == 1) {
+        defaultConstructed =
+            (frame < keys[0] && before == Extrapolation::DefaultConstructed) ||
+            (frame > keys[0] && after == Extrapolation::DefaultConstructed);
+
+    /* Otherwise find a pair that is around given time and handle the
+       extrapolation the same way as interpolate() */
+    } else if(keys.size() > 1) {
+        hint = Implementation::findKeyframe(keys, frame, hint);
+        if(frame < keys[hint]) {
+            if(before == Extrapolation::DefaultConstructed) defaultConstructed = true;
+            if(before == Extrapolation::Constant) frame = keys[hint];
+        } else if(frame >= keys[hint + 1]) {
+            if(after == Extrapolation::DefaultConstructed) defaultConstructed = true;
+            if(after == Extrapolation::Constant) frame = keys[hint + 1];
+        }
+
+        first = hint;
+        second = hint + 1;
+        factor = Math::lerpInverted(Float(keys[hint]), Float(keys[hint + 1]), Float(frame));
+    }
+
+    if(defaultConstructed) {
+        for(R& i: destination) i = R{};
+        return;
+    }
+
+    const Containers::StridedArrayView1D<const V> a = values[first];
+    const Containers::StridedArrayView1D<const V> b = values[second];
+    for(std::size_t i = 0; i != destination.size(); ++i)
+        destination[i] = interpolator(a[i], b[i], factor);
+}
+
+template<class K, class V, class R> R interpolateFixedRate(const K begin, const K step, const Containers::StridedArrayView1D<const V>& values, const Extrapolation before, const Extrapolation after, R(*const interpolator)(const V&, const V&, Float), const K frame) {
+    CORRADE_ASSERT(step > K{},
+        "Animation::interpolateFixedRate(): expected a positive step", {});
+
+    /* No data, return default-constructed value */
+    if(!values.size()) return {};
+
+    /* Only one frame, return it verbatim (or default-constructed, if desired) */
+    if(values.size() == 1) {
+        if((frame < begin && before == Extrapolation::DefaultConstructed) ||
+           (frame > begin && after == Extrapolation::DefaultConstructed))
+            return {};
+
+        return interpolator(values[0], values[0], 0.0f);
+    }
+
+    /* Calculate the keyframe index directly. The position is relative to the
+       first key, so it's negative before the first key and larger than the
+       index of the last keyframe pair after the last key. */
+    const std::size_t last = values.size() - 2;
+    const Float position = Float(frame - begin)/Float(step);
+    const std::size_t index = position < 0.0f ? 0 :
+        Math::min(std::size_t(position), last);
+    Float factor = position - Float(index);
+
+    /* Special extrapolation outside of range. Usual extrapolation is done by
+       the factor being outside of the [0, 1] range. */
+    if(position < 0.0f) {
+        if(before == Extrapolation::DefaultConstructed) return {};
+        if(before == Extrapolation::Constant) factor = 0.0f;
+    } else if(position >= Float(last + 1)) {
+        if(after == Extrapolation::DefaultConstructed) return {};
+        if(after == Extrapolation::Constant) factor = 1.0f;
+    }
+
+    return interpolator(values[index], values[index + 1], factor);
+}
+
 }}
 
 #endif
@@ -0,0 +1,210 @@
+#ifndef Magnum_Animation_PackedQuaternion_h
+#define Magnum_Animation_PackedQuaternion_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Animation::PackedQuaternion, function @ref Magnum::Animation::select(const PackedQuaternion&, const PackedQuaternion&, Float), @ref Magnum::Animation::slerpShortestPath(const PackedQuaternion&, const PackedQuaternion&, Float)
+ * @m_since_latest
+ */
+
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Animation/Interpolation.h"
+
+namespace Magnum { namespace Animation {
+
+/**
+@brief Rotation quaternion packed into 48 bits
+@m_since_latest
+
+Stores a unit @ref Magnum::Quaternion "Quaternion" using the *smallest three*
+encoding --- the component with the largest absolute value is dropped and
+reconstructed from the remaining three on unpacking, using the fact that the
+quaternion is normalized. Because @f$ q @f$ and @f$ -q @f$ represent the same
+rotation, the sign is flipped on packing to make the dropped component
+positive. The remaining three components lie in the
+@f$ [-\frac{1}{\sqrt{2}}, \frac{1}{\sqrt{2}}] @f$ range and are quantized to
+15 bits each, with the two-bit index of the dropped component stored in the
+topmost bits of the first two. Zero is represented exactly, the maximal error
+of a single component is around @cpp 2.2e-5 @ce.
+
+The type is a third of the size of a @ref Magnum::Quaternion "Quaternion",
+which makes it suitable for storing large amounts of rotation keyframes. A
+@ref Track or @ref TrackView with this value type has a
+@ref Magnum::Quaternion "Quaternion" result type and interpolator functions
+for it can be retrieved via @ref interpolatorFor():
+
+@m_class{m-fullwidth}
+
+Interpolation       | Interpolator
+------------------- | ------------
+@ref Interpolation::Constant "Constant" | @ref select(const PackedQuaternion&, const PackedQuaternion&, Float)
+@ref Interpolation::Linear "Linear" | @ref slerpShortestPath(const PackedQuaternion&, const PackedQuaternion&, Float)
+
+The values are unpacked on the fly in each interpolator call. The type is also
+supported in @ref Trade::AnimationData as
+@ref Trade::AnimationTrackType::PackedQuaternion.
+@see @ref reduceKeyframesInPlace()
+@experimental
+*/
+class PackedQuaternion {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Equivalent to an identity quaternion.
+         */
+        constexpr /*implicit*/ PackedQuaternion() noexcept: _data{0x8000|16383, 0x8000|16383, 16383} {}
+
+        /** @brief Construct from raw packed data */
+        constexpr explicit PackedQuaternion(const Vector3us& data) noexcept: _data{data} {}
+
+        /**
+         * @brief Pack a quaternion
+         *
+         * Expects that the quaternion is normalized.
+         */
+        explicit PackedQuaternion(const Quaternion& quaternion) noexcept;
+
+        /** @brief Equality comparison */
+        constexpr bool operator==(const PackedQuaternion& other) const {
+            return _data[0] == other._data[0] &&
+                   _data[1] == other._data[1] &&
+                   _data[2] == other._data[2];
+        }
+
+        /** @brief Non-equality comparison */
+        constexpr bool operator!=(const PackedQuaternion& other) const {
+            return !operator==(other);
+        }
+
+        /** @brief Unpack to a quaternion */
+        explicit operator Quaternion() const;
+
+        /** @brief Raw packed data */
+        constexpr Vector3us data() const { return _data; }
+
+    private:
+        Vector3us _data;
+};
+
+/**
+@brief Constant interpolation of packed quaternions
+@m_since_latest
+
+Unpacks @p a if @p t is less than @cpp 1.0f @ce and @p b otherwise.
+Counterpart to @ref Math::select() for the @ref PackedQuaternion type.
+*/
+inline Quaternion select(const PackedQuaternion& a, const PackedQuaternion& b, Float t) {
+    return Quaternion{t < 1.0f ? a : b};
+}
+
+/**
+@brief Spherical linear shortest-path interpolation of packed quaternions
+@m_since_latest
+
+Unpacks both @p a and @p b and delegates to
+@ref Math::slerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T).
+*/
+inline Quaternion slerpShortestPath(const PackedQuaternion& a, const PackedQuaternion& b, Float t) {
+    return Math::slerpShortestPath(Quaternion{a}, Quaternion{b}, t);
+}
+
+namespace Implementation {
+    enum: UnsignedShort { PackedQuaternionZero = 16383 };
+}
+
+inline PackedQuaternion::PackedQuaternion(const Quaternion& quaternion) noexcept {
+    CORRADE_DEBUG_ASSERT(quaternion.isNormalized(),
+        "Animation::PackedQuaternion:" << quaternion << "is not normalized", );
+
+    const Vector4 q{quaternion.vector(), quaternion.scalar()};
+    UnsignedInt largest = 0;
+    for(UnsignedInt i = 1; i != 4; ++i)
+        if(Math::abs(q[i]) > Math::abs(q[largest])) largest = i;
+
+    /* Flip the sign so the dropped component is positive, the range of the
+       remaining ones is then [-1/sqrt(2), 1/sqrt(2)] */
+    const Float scale = (q[largest] < 0.0f ? -1.0f : 1.0f)*Constants::sqrt2()*Float(Implementation::PackedQuaternionZero);
+    UnsignedShort packed[3];
+    for(UnsignedInt i = 0, j = 0; i != 4; ++i) {
+        if(i == largest) continue;
+        packed[j++] = UnsignedShort(Int(Math::round(Math::clamp(q[i]*scale,
+            -Float(Implementation::PackedQuaternionZero),
+             Float(Implementation::PackedQuaternionZero)))) + Implementation::PackedQuaternionZero);
+    }
+
+    _data = {UnsignedShort(packed[0]|((largest & 0x2) << 14)),
+             UnsignedShort(packed[1]|((largest & 0x1) << 15)),
+             packed[2]};
+}
+
+inline PackedQuaternion::operator Quaternion() const {
+    const UnsignedInt largest = ((_data[0] >> 15) << 1)|(_data[1] >> 15);
+    const Float scale = 1.0f/(Constants::sqrt2()*Float(Implementation::PackedQuaternionZero));
+    const Vector3 small{
+        Float(Int(_data[0] & 0x7fff) - Implementation::PackedQuaternionZero)*scale,
+        Float(Int(_data[1] & 0x7fff) - Implementation::PackedQuaternionZero)*scale,
+        Float(Int(_data[2] & 0x7fff) - Implementation::PackedQuaternionZero)*scale};
+
+    Vector4 q;
+    for(UnsignedInt i = 0, j = 0; i != 4; ++i)
+        q[i] = i == largest ? 0.0f : small[j++];
+    q[largest] = std::sqrt(Math::max(1.0f - small.dot(), 0.0f));
+
+    return Quaternion{q.xyz(), q.w()};
+}
+
+namespace Implementation {
+
+template<> struct ResultTraits<PackedQuaternion> {
+    typedef Quaternion Type;
+};
+template<> struct ResultTraits<const PackedQuaternion> {
+    typedef Quaternion Type;
+};
+template<> struct TypeTraits<PackedQuaternion, Quaternion> {
+    typedef Quaternion(*Interpolator)(const PackedQuaternion&, const PackedQuaternion&, Float);
+
+    static Interpolator interpolator(Interpolation interpolation) {
+        switch(interpolation) {
+            case Interpolation::Constant: return Animation::select;
+            case Interpolation::Linear: return Animation::slerpShortestPath;
+
+            case Interpolation::Spline:
+            case Interpolation::Custom: ; /* nope */
+        }
+
+        CORRADE_ASSERT_UNREACHABLE("Animation::interpolatorFor(): can't deduce interpolator function for" << interpolation, {});
+    }
+};
+
+}
+
+}}
+
+#endif
@@ -33,6 +33,7 @@
 #include <chrono>
 #include <Corrade/Containers/Array.h>
 
+#include "Magnum/Animation/Parallel.h"
 #include "Magnum/Animation/Track.h"
 #include "Magnum/Math/Range.h"
 
@@ -265,9 +266,36 @@ template<class T, class K
          * @brief Advance multiple players at the same time
          *
          * Equivalent to calling @ref advance(T) for each item in @p players.
+         * @see @ref advance(T, Containers::ArrayView<const Containers::Reference<Player<T, K>>>, ParallelFor, void*)
          */
         static void advance(T time, std::initializer_list<Containers::Reference<Player<T, K>>> players);
 
+        /**
+         * @brief Advance multiple players at the same time, optionally in parallel
+         * @param time              Time
+         * @param players           Players to advance
+         * @param parallelFor       Parallel loop executor or @cpp nullptr @ce
+         * @param parallelForState  State pointer passed to @p parallelFor
+         * @m_since_latest
+         *
+         * If @p parallelFor is @cpp nullptr @ce, equivalent to calling
+         * @ref advance(T) for each item in @p players in order. Otherwise
+         * each player is advanced in a separate task dispatched to
+         * @p parallelFor. As @p parallelFor is expected to return only
+         * after all tasks finished, all destinations are updated and all
+         * callbacks fired once this function returns.
+         *
+         * Because the players are advanced concurrently, each player is
+         * expected to be present in @p players just once, and result
+         * destinations and callback user data pointers of different players
+         * are expected to not alias. If asserts are enabled, this is checked
+         * before advancing anything. Result destinations and user data shared
+         * by tracks of the same player are fine, as a single player is always
+         * advanced on a single thread. The callbacks themselves have to be
+         * safe to call from multiple threads at the same time.
+         */
+        static void advance(T time, Containers::ArrayView<const Containers::Reference<Player<T, K>>> players, ParallelFor parallelFor, void* parallelForState = nullptr);
+
         /** @brief Constructor */
         explicit Player();
 
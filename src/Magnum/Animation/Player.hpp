@@ -32,6 +32,9 @@
 
 #include "Player.h"
 
+#ifndef CORRADE_NO_ASSERT
+#include <algorithm>
+#endif
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Reference.h>
@@ -77,6 +80,50 @@ template<class T, class K> void Player<T, K>::advance(const T time, const std::i
     for(Player<T, K>& p: players) p.advance(time);
 }
 
+template<class T, class K> void Player<T, K>::advance(const T time, const Containers::ArrayView<const Containers::Reference<Player<T, K>>> players, const ParallelFor parallelFor, void* const parallelForState) {
+    if(!parallelFor) {
+        for(Player<T, K>& p: players) p.advance(time);
+        return;
+    }
+
+    #ifndef CORRADE_NO_ASSERT
+    /* Gather the player itself, all result destinations and callback user
+       data along with the player index, sort them and check that no two
+       neighboring items with the same pointer belong to different players */
+    {
+        std::size_t count = 0;
+        for(Player<T, K>& p: players)
+            count += 1 + 2*p._tracks.size();
+        Containers::Array<std::pair<const void*, std::size_t>> pointers{NoInit, count};
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i != players.size(); ++i) {
+            pointers[offset++] = {&players[i].get(), i};
+            for(const Track& t: players[i].get()._tracks) {
+                if(t.destination) pointers[offset++] = {t.destination, i};
+                if(t.userCallbackData) pointers[offset++] = {t.userCallbackData, i};
+            }
+        }
+        std::sort(pointers.begin(), pointers.begin() + offset);
+        for(std::size_t i = 1; i < offset; ++i) {
+            CORRADE_ASSERT(pointers[i - 1].first != pointers[i].first || pointers[i - 1].second == pointers[i].second,
+                "Animation::Player::advance(): players" << pointers[i - 1].second << "and" << pointers[i].second << "share a destination or callback data pointer", );
+        }
+    }
+    #endif
+
+    /* Every player touches only its own state, destinations and callback
+       data, so the result doesn't depend on how the executor orders the
+       work */
+    struct State {
+        Containers::ArrayView<const Containers::Reference<Player<T, K>>> players;
+        T time;
+    } state{players, time};
+    parallelFor(parallelForState, players.size(), [](void* taskState, std::size_t i) {
+        const State& state = *static_cast<const State*>(taskState);
+        state.players[i].get().advance(state.time);
+    }, &state);
+}
+
 template<class T, class K> Player<T, K>::Player(Player<T, K>&&) noexcept = default;
 
 template<class T, class K> Player<T, K>& Player<T, K>::operator=(Player<T, K>&&) noexcept = default;
@@ -0,0 +1,257 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PoseBlender.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+
+#include "Magnum/Math/QuaternionBatch.h"
+
+namespace Magnum { namespace Animation {
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+Debug& operator<<(Debug& debug, const BlendMode value) {
+    const bool packed = debug.immediateFlags() >= Debug::Flag::Packed;
+
+    if(!packed)
+        debug << "Animation::BlendMode" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case BlendMode::value: return debug << (packed ? "" : "::") << Debug::nospace << #value;
+        _c(Override)
+        _c(Additive)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << (packed ? "" : "(") << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << (packed ? "" : ")");
+}
+#endif
+
+struct PoseBlender::State {
+    template<class V> struct Track {
+        TrackView<const Float, const V> track;
+        UnsignedInt joint;
+        std::size_t hint;
+    };
+
+    struct Layer {
+        BlendMode mode;
+        Float weight;
+        Containers::Array<Track<Vector3>> translations;
+        Containers::Array<Track<Quaternion>> rotations;
+        Containers::Array<Track<Vector3>> scalings;
+    };
+
+    UnsignedInt jointCount;
+    Containers::Array<Layer> layers;
+
+    /* Sampled values of a single layer and rotations gathered from the pose
+       for blending, sized to the largest track count in any layer so blend()
+       doesn't need to allocate */
+    Containers::Array<Vector3> sampledVectors;
+    Containers::Array<Quaternion> sampledRotations;
+    Containers::Array<Quaternion> poseRotations;
+};
+
+PoseBlender::PoseBlender(const UnsignedInt jointCount): _state{InPlaceInit} {
+    _state->jointCount = jointCount;
+}
+
+PoseBlender::PoseBlender(PoseBlender&&) noexcept = default;
+
+PoseBlender::~PoseBlender() = default;
+
+PoseBlender& PoseBlender::operator=(PoseBlender&&) noexcept = default;
+
+UnsignedInt PoseBlender::jointCount() const {
+    return _state->jointCount;
+}
+
+UnsignedInt PoseBlender::layerCount() const {
+    return _state->layers.size();
+}
+
+UnsignedInt PoseBlender::addLayer(const BlendMode mode, const Float weight) {
+    arrayAppend(_state->layers, State::Layer{mode, weight, {}, {}, {}});
+    return _state->layers.size() - 1;
+}
+
+BlendMode PoseBlender::layerMode(const UnsignedInt layer) const {
+    CORRADE_ASSERT(layer < _state->layers.size(),
+        "Animation::PoseBlender::layerMode(): index" << layer << "out of range for" << _state->layers.size() << "layers", {});
+    return _state->layers[layer].mode;
+}
+
+Float PoseBlender::layerWeight(const UnsignedInt layer) const {
+    CORRADE_ASSERT(layer < _state->layers.size(),
+        "Animation::PoseBlender::layerWeight(): index" << layer << "out of range for" << _state->layers.size() << "layers", {});
+    return _state->layers[layer].weight;
+}
+
+PoseBlender& PoseBlender::setLayerWeight(const UnsignedInt layer, const Float weight) {
+    CORRADE_ASSERT(layer < _state->layers.size(),
+        "Animation::PoseBlender::setLayerWeight(): index" << layer << "out of range for" << _state->layers.size() << "layers", *this);
+    _state->layers[layer].weight = weight;
+    return *this;
+}
+
+namespace {
+
+template<class V, class T> void addTrack(Containers::Array<T>& tracks, const UnsignedInt joint, const TrackView<const Float, const V>& track, Containers::Array<V>& scratch) {
+    arrayAppend(tracks, T{track, joint, 0});
+    if(scratch.size() < tracks.size())
+        arrayResize(scratch, NoInit, tracks.size());
+}
+
+}
+
+PoseBlender& PoseBlender::addTranslation(const UnsignedInt layer, const UnsignedInt joint, const TrackView<const Float, const Vector3>& track) {
+    State& state = *_state;
+    CORRADE_ASSERT(layer < state.layers.size(),
+        "Animation::PoseBlender::addTranslation(): index" << layer << "out of range for" << state.layers.size() << "layers", *this);
+    CORRADE_ASSERT(joint < state.jointCount,
+        "Animation::PoseBlender::addTranslation(): joint" << joint << "out of range for" << state.jointCount << "joints", *this);
+    addTrack(state.layers[layer].translations, joint, track, state.sampledVectors);
+    return *this;
+}
+
+PoseBlender& PoseBlender::addRotation(const UnsignedInt layer, const UnsignedInt joint, const TrackView<const Float, const Quaternion>& track) {
+    State& state = *_state;
+    CORRADE_ASSERT(layer < state.layers.size(),
+        "Animation::PoseBlender::addRotation(): index" << layer << "out of range for" << state.layers.size() << "layers", *this);
+    CORRADE_ASSERT(joint < state.jointCount,
+        "Animation::PoseBlender::addRotation(): joint" << joint << "out of range for" << state.jointCount << "joints", *this);
+    addTrack(state.layers[layer].rotations, joint, track, state.sampledRotations);
+    if(state.poseRotations.size() < state.sampledRotations.size())
+        arrayResize(state.poseRotations, NoInit, state.sampledRotations.size());
+    return *this;
+}
+
+PoseBlender& PoseBlender::addScaling(const UnsignedInt layer, const UnsignedInt joint, const TrackView<const Float, const Vector3>& track) {
+    State& state = *_state;
+    CORRADE_ASSERT(layer < state.layers.size(),
+        "Animation::PoseBlender::addScaling(): index" << layer << "out of range for" << state.layers.size() << "layers", *this);
+    CORRADE_ASSERT(joint < state.jointCount,
+        "Animation::PoseBlender::addScaling(): joint" << joint << "out of range for" << state.jointCount << "joints", *this);
+    addTrack(state.layers[layer].scalings, joint, track, state.sampledVectors);
+    return *this;
+}
+
+namespace {
+
+template<class T, class V> void sample(Containers::Array<T>& tracks, const Float time, const Containers::ArrayView<V>& out) {
+    for(std::size_t i = 0; i != tracks.size(); ++i)
+        out[i] = tracks[i].track.at(time, tracks[i].hint);
+}
+
+}
+
+void PoseBlender::blend(const Containers::StridedArrayView1D<const Float>& layerTimes, const Containers::StridedArrayView1D<Vector3>& translations, const Containers::StridedArrayView1D<Quaternion>& rotations, const Containers::StridedArrayView1D<Vector3>& scalings) {
+    State& state = *_state;
+    CORRADE_ASSERT(layerTimes.size() == state.layers.size(),
+        "Animation::PoseBlender::blend(): expected" << state.layers.size() << "layer times but got" << layerTimes.size(), );
+    CORRADE_ASSERT(translations.size() == state.jointCount && rotations.size() == state.jointCount && scalings.size() == state.jointCount,
+        "Animation::PoseBlender::blend(): expected translation, rotation and scaling views to have" << state.jointCount << "items but got" << translations.size() << Debug::nospace << "," << rotations.size() << "and" << scalings.size(), );
+
+    for(std::size_t l = 0; l != state.layers.size(); ++l) {
+        State::Layer& layer = state.layers[l];
+        const Float weight = layer.weight;
+        if(weight == 0.0f) continue;
+
+        const Float time = layerTimes[l];
+        const bool override = layer.mode == BlendMode::Override;
+
+        /* Translations. Overriding with a full weight is a plain copy,
+           otherwise it's a lerp or a weighted addition. */
+        if(const std::size_t count = layer.translations.size()) {
+            const Containers::ArrayView<Vector3> sampled = state.sampledVectors.prefix(count);
+            sample(layer.translations, time, sampled);
+            if(override && weight == 1.0f) {
+                for(std::size_t i = 0; i != count; ++i)
+                    translations[layer.translations[i].joint] = sampled[i];
+            } else if(override) {
+                for(std::size_t i = 0; i != count; ++i) {
+                    Vector3& destination = translations[layer.translations[i].joint];
+                    destination = Math::lerp(destination, sampled[i], weight);
+                }
+            } else {
+                for(std::size_t i = 0; i != count; ++i)
+                    translations[layer.translations[i].joint] += sampled[i]*weight;
+            }
+        }
+
+        /* Rotations. Interpolation is done with the batch kernel, for which
+           the affected rotations are first gathered from the pose. */
+        if(const std::size_t count = layer.rotations.size()) {
+            const Containers::ArrayView<Quaternion> sampled = state.sampledRotations.prefix(count);
+            sample(layer.rotations, time, sampled);
+            const Containers::StridedArrayView1D<const Float> weights = Containers::stridedArrayView(&weight, 1).broadcasted<0>(count);
+            if(override && weight == 1.0f) {
+                for(std::size_t i = 0; i != count; ++i)
+                    rotations[layer.rotations[i].joint] = sampled[i];
+            } else if(override) {
+                const Containers::ArrayView<Quaternion> pose = state.poseRotations.prefix(count);
+                for(std::size_t i = 0; i != count; ++i)
+                    pose[i] = rotations[layer.rotations[i].joint];
+                Math::slerpShortestPathInto(pose, sampled, weights, pose);
+                for(std::size_t i = 0; i != count; ++i)
+                    rotations[layer.rotations[i].joint] = pose[i];
+            } else {
+                if(weight != 1.0f) {
+                    const Quaternion identity;
+                    Math::slerpShortestPathInto(Containers::stridedArrayView(&identity, 1).broadcasted<0>(count), sampled, weights, sampled);
+                }
+                for(std::size_t i = 0; i != count; ++i) {
+                    Quaternion& destination = rotations[layer.rotations[i].joint];
+                    destination = destination*sampled[i];
+                }
+            }
+        }
+
+        /* Scalings. Same as translations, except that the additive mode
+           multiplies. */
+        if(const std::size_t count = layer.scalings.size()) {
+            const Containers::ArrayView<Vector3> sampled = state.sampledVectors.prefix(count);
+            sample(layer.scalings, time, sampled);
+            if(override && weight == 1.0f) {
+                for(std::size_t i = 0; i != count; ++i)
+                    scalings[layer.scalings[i].joint] = sampled[i];
+            } else if(override) {
+                for(std::size_t i = 0; i != count; ++i) {
+                    Vector3& destination = scalings[layer.scalings[i].joint];
+                    destination = Math::lerp(destination, sampled[i], weight);
+                }
+            } else {
+                for(std::size_t i = 0; i != count; ++i)
+                    scalings[layer.scalings[i].joint] *= Math::lerp(Vector3{1.0f}, sampled[i], weight);
+            }
+        }
+    }
+}
+
+}}
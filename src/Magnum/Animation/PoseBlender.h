@@ -0,0 +1,228 @@
+#ifndef Magnum_Animation_PoseBlender_h
+#define Magnum_Animation_PoseBlender_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Animation::PoseBlender, enum @ref Magnum::Animation::BlendMode
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Animation/Track.h"
+#include "Magnum/Math/Quaternion.h"
+
+namespace Magnum { namespace Animation {
+
+/**
+@brief Pose blend mode
+@m_since_latest
+
+@see @ref PoseBlender::addLayer()
+@experimental
+*/
+enum class BlendMode: UnsignedByte {
+    /**
+     * The layer value replaces the value from layers below. With a weight
+     * less than @cpp 1.0f @ce, translation and scaling is linearly
+     * interpolated and rotation is interpolated with
+     * @ref Math::slerpShortestPath() between the two.
+     */
+    Override,
+
+    /**
+     * The layer value is added on top of the value from layers below.
+     * Translation is added, rotation is multiplied from the right and scaling
+     * multiplied component-wise. With a weight less than @cpp 1.0f @ce, the
+     * layer value is first interpolated from an identity, i.e. a zero
+     * translation, an identity rotation and a unit scaling.
+     */
+    Additive
+};
+
+/**
+@debugoperatorenum{BlendMode}
+@m_since_latest
+*/
+MAGNUM_EXPORT Debug& operator<<(Debug& debug, BlendMode value);
+
+/**
+@brief Layered skeletal pose blender
+@m_since_latest
+
+Samples translation, rotation and scaling tracks of multiple animation layers
+and blends them together into a single pose, without any temporary
+allocations or intermediate copies of the whole pose. Meant as a replacement
+for having multiple @ref Player instances writing into temporary poses and
+mixing them together manually.
+
+@section Animation-PoseBlender-usage Usage
+
+The blender is constructed with a joint count. Layers are then added with
+@ref addLayer(), and each layer gets tracks for any subset of the joints
+using @ref addTranslation(), @ref addRotation() and @ref addScaling().
+Finally, @ref blend() samples all layers at given per-layer times and blends
+the results into the destination pose, which is expected to contain the
+rest pose or a pose from a previous step on input. Layers are applied in the
+order they were added and joints that don't have a track in given layer are
+not affected by it:
+
+@snippet Animation.cpp PoseBlender-usage
+
+The layer weight can be changed with @ref setLayerWeight() at any time, for
+example to cross-fade between two animations. Layers with zero weight are
+skipped entirely. The time at which each layer is sampled is
+supplied directly, which means the playback can be driven by a @ref Player
+or any other timing mechanism.
+
+@section Animation-PoseBlender-performance Performance considerations
+
+Each layer keeps a keyframe search hint for each of its tracks, so sampling
+an animation that's playing forward is constant-time, see
+@ref interpolate() for details. Sampled values are stored in a scratch
+buffer that's sized when tracks are added and reused for every layer, and
+rotations are blended using the SIMD-optimized
+@ref Math::slerpShortestPathInto(). A layer in the
+@ref BlendMode::Override mode with a weight of @cpp 1.0f @ce writes the
+sampled values directly to the destination, without any interpolation.
+@experimental
+*/
+class MAGNUM_EXPORT PoseBlender {
+    public:
+        /**
+         * @brief Constructor
+         * @param jointCount    Count of joints in the pose
+         *
+         * No layers are present initially.
+         */
+        explicit PoseBlender(UnsignedInt jointCount);
+
+        /** @brief Copying is not allowed */
+        PoseBlender(const PoseBlender&) = delete;
+
+        /** @brief Move constructor */
+        PoseBlender(PoseBlender&&) noexcept;
+
+        ~PoseBlender();
+
+        /** @brief Copying is not allowed */
+        PoseBlender& operator=(const PoseBlender&) = delete;
+
+        /** @brief Move assignment */
+        PoseBlender& operator=(PoseBlender&&) noexcept;
+
+        /** @brief Count of joints in the pose */
+        UnsignedInt jointCount() const;
+
+        /** @brief Count of layers */
+        UnsignedInt layerCount() const;
+
+        /**
+         * @brief Add a layer
+         * @param mode      Blend mode
+         * @param weight    Layer weight
+         * @return Layer ID, equal to @ref layerCount() before the call
+         */
+        UnsignedInt addLayer(BlendMode mode, Float weight = 1.0f);
+
+        /**
+         * @brief Layer blend mode
+         *
+         * Expects that @p layer is less than @ref layerCount().
+         */
+        BlendMode layerMode(UnsignedInt layer) const;
+
+        /**
+         * @brief Layer weight
+         *
+         * Expects that @p layer is less than @ref layerCount().
+         */
+        Float layerWeight(UnsignedInt layer) const;
+
+        /**
+         * @brief Set layer weight
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p layer is less than @ref layerCount(). A weight of
+         * @cpp 0.0f @ce makes @ref blend() skip the layer.
+         */
+        PoseBlender& setLayerWeight(UnsignedInt layer, Float weight);
+
+        /**
+         * @brief Add a translation track
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p layer is less than @ref layerCount() and @p joint
+         * is less than @ref jointCount(). The track data are expected to
+         * stay in scope for the whole blender lifetime.
+         */
+        PoseBlender& addTranslation(UnsignedInt layer, UnsignedInt joint, const TrackView<const Float, const Vector3>& track);
+
+        /**
+         * @brief Add a rotation track
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p layer is less than @ref layerCount() and @p joint
+         * is less than @ref jointCount(). The track data are expected to
+         * stay in scope for the whole blender lifetime and the sampled values
+         * are expected to be normalized.
+         */
+        PoseBlender& addRotation(UnsignedInt layer, UnsignedInt joint, const TrackView<const Float, const Quaternion>& track);
+
+        /**
+         * @brief Add a scaling track
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p layer is less than @ref layerCount() and @p joint
+         * is less than @ref jointCount(). The track data are expected to
+         * stay in scope for the whole blender lifetime.
+         */
+        PoseBlender& addScaling(UnsignedInt layer, UnsignedInt joint, const TrackView<const Float, const Vector3>& track);
+
+        /**
+         * @brief Sample all layers and blend them into a pose
+         * @param[in] layerTimes        Time at which to sample each layer
+         * @param[in,out] translations  Joint translations
+         * @param[in,out] rotations     Joint rotations
+         * @param[in,out] scalings      Joint scalings
+         *
+         * Expects that @p layerTimes has @ref layerCount() items and the
+         * pose views have @ref jointCount() items. The pose views are
+         * expected to contain a pose to blend on top of, such as the rest
+         * pose, and rotations in it are expected to be normalized.
+         */
+        void blend(const Containers::StridedArrayView1D<const Float>& layerTimes, const Containers::StridedArrayView1D<Vector3>& translations, const Containers::StridedArrayView1D<Quaternion>& rotations, const Containers::StridedArrayView1D<Vector3>& scalings);
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef Magnum_Animation_ReduceKeyframes_h
+#define Magnum_Animation_ReduceKeyframes_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Animation::reduceKeyframesInPlace()
+ * @m_since_latest
+ */
+
+#include <type_traits>
+
+#include "Magnum/Math/Complex.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Animation/Interpolation.h"
+
+namespace Magnum { namespace Animation {
+
+namespace Implementation {
+    template<class T, bool = std::is_arithmetic<T>::value> struct KeyframeError {
+        static Float error(const T& a, const T& b) {
+            return Float((a - b).length());
+        }
+    };
+    template<class T> struct KeyframeError<T, true> {
+        static Float error(T a, T b) {
+            return Float(a > b ? a - b : b - a);
+        }
+    };
+    /* Rotation angle between the two, shortest path for quaternions as q and
+       -q represent the same rotation */
+    template<class T> struct KeyframeError<Math::Complex<T>, false> {
+        static Float error(const Math::Complex<T>& a, const Math::Complex<T>& b) {
+            return Float(std::acos(Math::clamp(Math::dot(a, b), T(-1), T(1))));
+        }
+    };
+    template<class T> struct KeyframeError<Math::Quaternion<T>, false> {
+        static Float error(const Math::Quaternion<T>& a, const Math::Quaternion<T>& b) {
+            return Float(T(2)*std::acos(Math::min(Math::abs(Math::dot(a, b)), T(1))));
+        }
+    };
+}
+
+/**
+@brief Remove keyframes that can be reconstructed by interpolation
+@param[in,out] keys     Track keys
+@param[in,out] values   Track values
+@param[in] interpolator Interpolator function used for playback
+@param[in] maxError     Max error of a removed keyframe
+@return Count of keyframes that were kept
+@m_since_latest
+
+Goes through the track and greedily drops keyframes for which the value
+produced by @p interpolator from the nearest kept keyframes on both sides
+differs from the original value by at most @p maxError, for all dropped
+keyframes in between. The first and last keyframes are always kept. Kept
+keyframes are moved to the front of @p keys and @p values, preserving their
+order; use the returned count to slice the views. For the same data and
+interpolator, playback of the reduced track differs from the original by at
+most @p maxError at the original keyframe positions.
+
+The error is calculated as an absolute difference for scalar types, as a
+length of the difference for vector types, as an angle in radians for
+@ref Math::Complex and as a shortest-path rotation angle in radians for
+@ref Math::Quaternion. It's meant to be used on linearly-interpolated tracks,
+for tracks with constant interpolation only repeated keyframes get removed.
+The typical use is reducing a densely sampled motion capture track before
+packing its rotations to @ref PackedQuaternion, which together can reduce the
+memory use several times:
+
+@snippet Animation.cpp reduceKeyframesInPlace
+
+Expects that @p keys and @p values have the same size.
+@experimental
+*/
+template<class K, class V, class R> std::size_t reduceKeyframesInPlace(const Containers::StridedArrayView1D<K>& keys, const Containers::StridedArrayView1D<V>& values, R(*interpolator)(const V&, const V&, Float), Float maxError) {
+    CORRADE_ASSERT(keys.size() == values.size(),
+        "Animation::reduceKeyframesInPlace(): expected key and value view to have the same size but got" << keys.size() << "and" << values.size(), {});
+
+    if(keys.size() < 3) return keys.size();
+
+    /* Positions before `last` are overwritten with the kept keyframes, but
+       never past it, so all keyframes that are yet to be checked stay
+       intact */
+    std::size_t last = 0;
+    std::size_t out = 1;
+    for(std::size_t end = 2; end != keys.size(); ++end) {
+        bool removable = true;
+        for(std::size_t i = last + 1; i != end; ++i) {
+            const Float t = Math::lerpInverted(Float(keys[last]), Float(keys[end]), Float(keys[i]));
+            if(Implementation::KeyframeError<R>::error(interpolator(values[last], values[end], t), interpolator(values[i], values[i], 0.0f)) > maxError) {
+                removable = false;
+                break;
+            }
+        }
+        if(removable) continue;
+
+        /* The keyframe right before `end` can't be removed, keep it and
+           continue from it */
+        last = end - 1;
+        keys[out] = keys[last];
+        values[out] = values[last];
+        ++out;
+    }
+
+    keys[out] = keys.back();
+    values[out] = values.back();
+    return out + 1;
+}
+
+}}
+
+#endif
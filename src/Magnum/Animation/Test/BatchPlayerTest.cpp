@@ -0,0 +1,542 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Animation/BatchPlayer.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace Animation { namespace Test { namespace {
+
+using namespace Math::Literals;
+
+struct BatchPlayerTest: TestSuite::Tester {
+    explicit BatchPlayerTest();
+
+    void construct();
+    void constructCopy();
+    void constructMove();
+
+    void add();
+    void addInvalidDestination();
+
+    void advanceSelect();
+    void advanceLerp();
+    void advanceQuaternion();
+    void advanceCustomInterpolator();
+    void advanceExtrapolation();
+    void advanceSingleKeyframe();
+    void advanceNoKeyframes();
+
+    void advanceNotStarted();
+    void advancePlayCount();
+    void advancePlayCountInfinite();
+    void advanceStop();
+    void advanceZeroDuration();
+
+    void invalidIndex();
+    void playInvalidStartTimeCount();
+};
+
+const struct {
+    const char* name;
+    Quaternion(*interpolator)(const Quaternion&, const Quaternion&, Float);
+    Float startTimeLast;
+} AdvanceQuaternionData[]{
+    {"select", Math::select, 0.5f},
+    {"lerp", Math::lerp, 0.5f},
+    {"lerp shortest path", Math::lerpShortestPath, 0.5f},
+    {"slerp", Math::slerp, 0.5f},
+    {"slerp shortest path", Math::slerpShortestPath, 0.5f},
+    /* Last instance starting in the future means only a subset of instances
+       is updated, which goes through a different code path */
+    {"slerp shortest path, not all instances active", Math::slerpShortestPath, 1000.0f},
+    {"custom", [](const Quaternion& a, const Quaternion& b, Float t) {
+        return Math::slerp(a, b, t*t);
+    }, 0.5f}
+};
+
+const struct {
+    const char* name;
+    Extrapolation before, after;
+} AdvanceExtrapolationData[]{
+    {"constant", Extrapolation::Constant, Extrapolation::Constant},
+    {"extrapolated", Extrapolation::Extrapolated, Extrapolation::Extrapolated},
+    {"default constructed", Extrapolation::DefaultConstructed, Extrapolation::DefaultConstructed},
+    {"default constructed before, constant after", Extrapolation::DefaultConstructed, Extrapolation::Constant}
+};
+
+BatchPlayerTest::BatchPlayerTest() {
+    addTests({&BatchPlayerTest::construct,
+              &BatchPlayerTest::constructCopy,
+              &BatchPlayerTest::constructMove,
+
+              &BatchPlayerTest::add,
+              &BatchPlayerTest::addInvalidDestination,
+
+              &BatchPlayerTest::advanceSelect,
+              &BatchPlayerTest::advanceLerp});
+
+    addInstancedTests({&BatchPlayerTest::advanceQuaternion},
+        Containers::arraySize(AdvanceQuaternionData));
+
+    addTests({&BatchPlayerTest::advanceCustomInterpolator});
+
+    addInstancedTests({&BatchPlayerTest::advanceExtrapolation},
+        Containers::arraySize(AdvanceExtrapolationData));
+
+    addTests({&BatchPlayerTest::advanceSingleKeyframe,
+              &BatchPlayerTest::advanceNoKeyframes,
+
+              &BatchPlayerTest::advanceNotStarted,
+              &BatchPlayerTest::advancePlayCount,
+              &BatchPlayerTest::advancePlayCountInfinite,
+              &BatchPlayerTest::advanceStop,
+              &BatchPlayerTest::advanceZeroDuration,
+
+              &BatchPlayerTest::invalidIndex,
+              &BatchPlayerTest::playInvalidStartTimeCount});
+}
+
+const Animation::Track<Float, Float> Track{{
+    {1.0f, 1.5f},
+    {2.5f, 3.0f},
+    {3.0f, 5.0f},
+    {4.0f, 2.0f}
+}, Math::lerp};
+
+/* Times at which both the batch player and the reference players get
+   advanced. Covers the first iteration, a wraparound and running out. */
+constexpr Float AdvanceTimes[]{
+    0.0f, 0.5f, 1.25f, 2.0f, 2.125f, 3.0f, 3.875f, 5.0f, 6.5f, 11.0f
+};
+
+/* Plays the track with a regular Player for each instance and verifies the
+   batch player produces the same output at each time */
+template<class V> void compareWithPlayer(const TrackView<const Float, const V>& track, const Containers::ArrayView<const Float> startTimes, const V& initial) {
+    Containers::Array<V> actual{DirectInit, startTimes.size(), initial};
+    Containers::Array<V> expected{DirectInit, startTimes.size(), initial};
+
+    BatchPlayer batchPlayer{startTimes.size()};
+    batchPlayer
+        .add(track, Containers::stridedArrayView(actual))
+        .setPlayCount(2)
+        .play(startTimes);
+
+    Containers::Array<Player<Float>> players{startTimes.size()};
+    for(std::size_t i = 0; i != startTimes.size(); ++i)
+        players[i]
+            .add(track, expected[i])
+            .setPlayCount(2)
+            .play(startTimes[i]);
+
+    for(const Float time: AdvanceTimes) {
+        CORRADE_ITERATION(time);
+        batchPlayer.advance(time);
+        for(Player<Float>& player: players)
+            player.advance(time);
+
+        for(std::size_t i = 0; i != startTimes.size(); ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_COMPARE(batchPlayer.state(i), players[i].state());
+            CORRADE_COMPARE(actual[i], expected[i]);
+        }
+    }
+}
+
+constexpr Float StartTimes[]{0.0f, 0.25f, 1.0f, 1.75f, 2.5f, 1000.0f};
+
+void BatchPlayerTest::construct() {
+    BatchPlayer player{5};
+    CORRADE_COMPARE(player.instanceCount(), 5);
+    CORRADE_COMPARE(player.duration(), Range1D{});
+    CORRADE_COMPARE(player.playCount(), 1);
+    CORRADE_VERIFY(player.isEmpty());
+    CORRADE_COMPARE(player.size(), 0);
+    for(std::size_t i = 0; i != 5; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(player.state(i), State::Stopped);
+    }
+}
+
+void BatchPlayerTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<BatchPlayer>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<BatchPlayer>{});
+}
+
+void BatchPlayerTest::constructMove() {
+    Float values[3];
+    BatchPlayer a{3};
+    a.add(Track, values)
+     .setPlayCount(37)
+     .play(1, 0.0f);
+
+    BatchPlayer b{Utility::move(a)};
+    CORRADE_COMPARE(b.instanceCount(), 3);
+    CORRADE_COMPARE(b.duration(), (Range1D{1.0f, 4.0f}));
+    CORRADE_COMPARE(b.playCount(), 37);
+    CORRADE_COMPARE(b.size(), 1);
+    CORRADE_COMPARE(b.state(0), State::Stopped);
+    CORRADE_COMPARE(b.state(1), State::Playing);
+
+    BatchPlayer c{5};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.instanceCount(), 3);
+    CORRADE_COMPARE(c.duration(), (Range1D{1.0f, 4.0f}));
+    CORRADE_COMPARE(c.playCount(), 37);
+    CORRADE_COMPARE(c.size(), 1);
+    CORRADE_COMPARE(c.state(0), State::Stopped);
+    CORRADE_COMPARE(c.state(1), State::Playing);
+
+    /* The moved-to player should still be usable */
+    c.advance(1.5f);
+    CORRADE_COMPARE(values[1], 3.0f);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<BatchPlayer>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<BatchPlayer>::value);
+}
+
+void BatchPlayerTest::add() {
+    const Animation::Track<Float, Vector2> track2{{
+        {0.5f, {}},
+        {3.0f, {}}
+    }, Math::lerp};
+
+    Float values[2];
+    Vector2 values2[2];
+    BatchPlayer player{2};
+    player
+        .add(Track, values)
+        .add(track2, values2);
+    CORRADE_VERIFY(!player.isEmpty());
+    CORRADE_COMPARE(player.size(), 2);
+    /* Duration is a union of all tracks */
+    CORRADE_COMPARE(player.duration(), (Range1D{0.5f, 4.0f}));
+
+    /* Explicitly set duration is replaced, same as with Player */
+    player.setDuration({-1.0f, 2.0f});
+    CORRADE_COMPARE(player.duration(), (Range1D{-1.0f, 2.0f}));
+}
+
+void BatchPlayerTest::addInvalidDestination() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Float values[2];
+    BatchPlayer player{3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    player.add(Track, values);
+    CORRADE_COMPARE(out.str(), "Animation::BatchPlayer::add(): expected destination view to have 3 items but got 2\n");
+}
+
+void BatchPlayerTest::advanceSelect() {
+    const Animation::Track<Float, Float> track{{
+        {1.0f, 1.0f},
+        {2.5f, 3.0f},
+        {3.0f, 5.0f},
+        {4.0f, 2.0f}
+    }, Math::select};
+    compareWithPlayer<Float>(track, StartTimes, -1.0f);
+}
+
+void BatchPlayerTest::advanceLerp() {
+    const Animation::Track<Float, Vector3> track{{
+        {1.0f, {1.5f, 0.0f, -1.0f}},
+        {2.5f, {3.0f, 1.0f, -2.0f}},
+        {3.0f, {5.0f, 2.0f, 0.5f}},
+        {4.0f, {2.0f, 0.0f, 7.0f}}
+    }, Math::lerp};
+
+    compareWithPlayer<Vector3>(track, StartTimes, Vector3{-1.0f});
+}
+
+void BatchPlayerTest::advanceQuaternion() {
+    auto&& data = AdvanceQuaternionData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The middle pair of keyframes takes the longer path, so the shortest
+       path variants differ from the others */
+    const Animation::Track<Float, Quaternion> track{{
+        {1.0f, Quaternion::rotation(15.0_degf, Vector3::xAxis())},
+        {2.5f, Quaternion::rotation(75.0_degf, Vector3::yAxis())},
+        {3.0f, -Quaternion::rotation(35.0_degf, Vector3::zAxis())},
+        {4.0f, Quaternion::rotation(-90.0_degf, Vector3::xAxis())}
+    }, data.interpolator};
+
+    const Float startTimes[]{0.0f, 0.25f, 1.0f, 1.75f, 2.5f, data.startTimeLast};
+    /* The batch kernels operate on many values at once and so may differ
+       from the scalar implementation in the last few bits, the
+       Quaternion comparison is fuzzy so that's fine */
+    compareWithPlayer<Quaternion>(track, startTimes, Quaternion{Math::ZeroInit});
+}
+
+void BatchPlayerTest::advanceCustomInterpolator() {
+    const Animation::Track<Float, Vector2> track{{
+        {1.0f, {1.5f, 0.0f}},
+        {2.5f, {3.0f, 1.0f}},
+        {3.0f, {5.0f, 2.0f}},
+        {4.0f, {2.0f, 0.0f}}
+    }, [](const Vector2& a, const Vector2& b, Float t) {
+        return Math::lerp(a, b, t*t);
+    }};
+
+    compareWithPlayer<Vector2>(track, StartTimes, Vector2{-1.0f});
+}
+
+void BatchPlayerTest::advanceExtrapolation() {
+    auto&& data = AdvanceExtrapolationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Animation::Track<Float, Vector4> track{{
+        {1.0f, {1.5f, 0.0f, -1.0f, 1.0f}},
+        {2.5f, {3.0f, 1.0f, -2.0f, 0.5f}},
+        {3.0f, {5.0f, 2.0f, 0.5f, 0.0f}}
+    }, Math::lerp, data.before, data.after};
+
+    const Vector4 initial{-100.0f};
+    Vector4 actual[4]{initial, initial, initial, initial};
+    Vector4 expected[4]{initial, initial, initial, initial};
+
+    /* Duration extends past the track on both sides so the extrapolation
+       gets exercised */
+    const Float startTimes[]{0.0f, 0.5f, 1.75f, 3.5f};
+    BatchPlayer batchPlayer{4};
+    batchPlayer
+        .add(track, actual)
+        .setDuration({0.0f, 4.0f})
+        .play(startTimes);
+
+    Player<Float> players[4];
+    for(std::size_t i = 0; i != 4; ++i)
+        players[i]
+            .add(track, expected[i])
+            .setDuration({0.0f, 4.0f})
+            .play(startTimes[i]);
+
+    for(const Float time: AdvanceTimes) {
+        CORRADE_ITERATION(time);
+        batchPlayer.advance(time);
+        for(Player<Float>& player: players)
+            player.advance(time);
+
+        for(std::size_t i = 0; i != 4; ++i) {
+            CORRADE_ITERATION(i);
+            CORRADE_COMPARE(actual[i], expected[i]);
+        }
+    }
+}
+
+void BatchPlayerTest::advanceSingleKeyframe() {
+    const Animation::Track<Float, Float> track{{
+        {1.0f, 3.5f}
+    }, Math::lerp};
+
+    Float values[2]{-1.0f, -1.0f};
+    BatchPlayer player{2};
+    player.add(track, values)
+        .setDuration({0.0f, 2.0f})
+        .play(0.0f);
+
+    player.advance(0.5f);
+    CORRADE_COMPARE(values[0], 3.5f);
+    CORRADE_COMPARE(values[1], 3.5f);
+
+    player.advance(1.5f);
+    CORRADE_COMPARE(values[0], 3.5f);
+    CORRADE_COMPARE(values[1], 3.5f);
+}
+
+void BatchPlayerTest::advanceNoKeyframes() {
+    Vector3 values[2]{Vector3{-1.0f}, Vector3{-1.0f}};
+    BatchPlayer player{2};
+    player.add(TrackView<const Float, const Vector3>{}, values)
+        .setDuration({0.0f, 2.0f})
+        .play(0.0f);
+
+    /* Same as with interpolate(), the value is default-constructed */
+    player.advance(0.5f);
+    CORRADE_COMPARE(values[0], Vector3{});
+    CORRADE_COMPARE(values[1], Vector3{});
+}
+
+void BatchPlayerTest::advanceNotStarted() {
+    Float values[3]{-1.0f, -1.0f, -1.0f};
+    BatchPlayer player{3};
+    player.add(Track, values)
+        .play(1, 2.0f);
+
+    /* Instance 0 and 2 are stopped, instance 1 is not started yet */
+    player.advance(1.75f);
+    CORRADE_COMPARE(player.state(1), State::Playing);
+    CORRADE_COMPARE(values[0], -1.0f);
+    CORRADE_COMPARE(values[1], -1.0f);
+    CORRADE_COMPARE(values[2], -1.0f);
+
+    /* Now it's playing */
+    player.advance(3.0f);
+    CORRADE_COMPARE(values[0], -1.0f);
+    CORRADE_COMPARE(values[1], 2.5f);
+    CORRADE_COMPARE(values[2], -1.0f);
+}
+
+void BatchPlayerTest::advancePlayCount() {
+    Float values[2]{-1.0f, -1.0f};
+    BatchPlayer player{2};
+    player.add(Track, values)
+        .setPlayCount(2)
+        .play(Containers::stridedArrayView({0.0f, 1.0f}));
+
+    player.advance(4.5f);
+    CORRADE_COMPARE(player.state(0), State::Playing);
+    CORRADE_COMPARE(player.state(1), State::Playing);
+    CORRADE_COMPARE(values[0], 3.0f);
+    CORRADE_COMPARE(values[1], 2.0f);
+
+    /* The first instance runs out, the value is parked at the end */
+    player.advance(6.5f);
+    CORRADE_COMPARE(player.state(0), State::Stopped);
+    CORRADE_COMPARE(player.state(1), State::Playing);
+    CORRADE_COMPARE(values[0], 2.0f);
+    CORRADE_COMPARE(values[1], 3.5f);
+
+    /* Further advancing doesn't touch the stopped instance */
+    values[0] = -1.0f;
+    player.advance(7.0f);
+    CORRADE_COMPARE(player.state(0), State::Stopped);
+    CORRADE_COMPARE(player.state(1), State::Stopped);
+    CORRADE_COMPARE(values[0], -1.0f);
+    CORRADE_COMPARE(values[1], 2.0f);
+}
+
+void BatchPlayerTest::advancePlayCountInfinite() {
+    Float values[1]{-1.0f};
+    BatchPlayer player{1};
+    player.add(Track, values)
+        .setPlayCount(0)
+        .play(0.0f);
+
+    player.advance(30.0f*3.0f + 1.5f);
+    CORRADE_COMPARE(player.state(0), State::Playing);
+    CORRADE_COMPARE(values[0], 3.0f);
+}
+
+void BatchPlayerTest::advanceStop() {
+    Float values[2]{-1.0f, -1.0f};
+    BatchPlayer player{2};
+    player.add(Track, values)
+        .play(2.0f);
+
+    player.advance(3.75f);
+    CORRADE_COMPARE(values[0], 4.0f);
+    CORRADE_COMPARE(values[1], 4.0f);
+
+    /* Stopping doesn't update anything */
+    values[0] = values[1] = -1.0f;
+    player.stop(1);
+    CORRADE_COMPARE(player.state(0), State::Playing);
+    CORRADE_COMPARE(player.state(1), State::Stopped);
+    CORRADE_COMPARE(values[1], -1.0f);
+
+    /* Advancing will update the stopped instance with a value from the
+       beginning of the duration */
+    player.advance(4.5f);
+    CORRADE_COMPARE(values[0], 3.5f);
+    CORRADE_COMPARE(values[1], 1.5f);
+
+    /* But further advancing will not touch it anymore */
+    values[1] = -1.0f;
+    player.advance(4.625f);
+    CORRADE_COMPARE(values[1], -1.0f);
+
+    /* Stopping all parks all */
+    player.stop();
+    player.advance(100.0f);
+    CORRADE_COMPARE(player.state(0), State::Stopped);
+    CORRADE_COMPARE(values[0], 1.5f);
+    CORRADE_COMPARE(values[1], 1.5f);
+}
+
+void BatchPlayerTest::advanceZeroDuration() {
+    Float values[2]{-1.0f, -1.0f};
+    BatchPlayer player{2};
+    player.add(Track, values)
+        .setDuration({2.5f, 2.5f})
+        .play(0.0f);
+
+    /* Both instances get the value at the duration start and are stopped
+       right away */
+    player.advance(1.0f);
+    CORRADE_COMPARE(player.state(0), State::Stopped);
+    CORRADE_COMPARE(player.state(1), State::Stopped);
+    CORRADE_COMPARE(values[0], 3.0f);
+    CORRADE_COMPARE(values[1], 3.0f);
+
+    /* With infinite play count it's advancing forever */
+    values[0] = values[1] = -1.0f;
+    player.setPlayCount(0)
+        .play(0.0f)
+        .advance(1.0f)
+        .advance(2.0f);
+    CORRADE_COMPARE(player.state(0), State::Playing);
+    CORRADE_COMPARE(player.state(1), State::Playing);
+    CORRADE_COMPARE(values[0], 3.0f);
+    CORRADE_COMPARE(values[1], 3.0f);
+}
+
+void BatchPlayerTest::invalidIndex() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    BatchPlayer player{3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    player.state(3);
+    player.play(3, 0.0f);
+    player.stop(3);
+    CORRADE_COMPARE(out.str(),
+        "Animation::BatchPlayer::state(): index 3 out of range for 3 instances\n"
+        "Animation::BatchPlayer::play(): index 3 out of range for 3 instances\n"
+        "Animation::BatchPlayer::stop(): index 3 out of range for 3 instances\n");
+}
+
+void BatchPlayerTest::playInvalidStartTimeCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    BatchPlayer player{3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    player.play(Containers::stridedArrayView({0.0f, 1.0f}));
+    CORRADE_COMPARE(out.str(), "Animation::BatchPlayer::play(): expected 3 start times but got 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::BatchPlayerTest)
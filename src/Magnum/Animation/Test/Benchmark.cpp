@@ -26,6 +26,7 @@
 
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Animation/BatchPlayer.h"
 #include "Magnum/Animation/Player.h"
 
 namespace Magnum { namespace Animation { namespace Test { namespace {
@@ -36,6 +37,8 @@ struct Benchmark: TestSuite::Tester {
     void interpolateEmpty();
     void interpolateInterleaved();
     void interpolateInterleavedStrict();
+    void interpolateInterleavedBackwards();
+    void interpolateFixedRate();
 
     void atEmpty();
     void at();
@@ -51,6 +54,9 @@ struct Benchmark: TestSuite::Tester {
     void playerAdvanceRawCallback();
     void playerAdvanceRawCallbackDirectInterpolator();
 
+    void playerAdvanceInstances();
+    void batchPlayerAdvance();
+
     Containers::Array<Float> _keys;
     Containers::Array<Int> _values;
     Containers::Array<std::pair<Float, Int>> _interleaved;
@@ -58,16 +64,27 @@ struct Benchmark: TestSuite::Tester {
     Containers::StridedArrayView1D<const Int> _valuesInterleaved;
     TrackView<const Float, const Int> _track;
     TrackView<const Float, const Int> _trackInterleaved;
+
+    Containers::Array<std::pair<Float, Vector3>> _translations;
+    Containers::Array<std::pair<Float, Quaternion>> _rotations;
+    TrackView<const Float, const Vector3> _translationTrack;
+    TrackView<const Float, const Quaternion> _rotationTrack;
 };
 
 namespace {
-    enum: std::size_t { DataSize = 2000 };
+    enum: std::size_t {
+        DataSize = 2000,
+        InstanceKeyframeCount = 16,
+        InstanceCount = 1000
+    };
 }
 
 Benchmark::Benchmark() {
     addBenchmarks({&Benchmark::interpolateEmpty,
                    &Benchmark::interpolateInterleaved,
                    &Benchmark::interpolateInterleavedStrict,
+                   &Benchmark::interpolateInterleavedBackwards,
+                   &Benchmark::interpolateFixedRate,
 
                    &Benchmark::atEmpty,
                    &Benchmark::at,
@@ -81,7 +98,10 @@ Benchmark::Benchmark() {
                    &Benchmark::playerAdvance,
                    &Benchmark::playerAdvanceCallback,
                    &Benchmark::playerAdvanceRawCallback,
-                   &Benchmark::playerAdvanceRawCallbackDirectInterpolator}, 10);
+                   &Benchmark::playerAdvanceRawCallbackDirectInterpolator,
+
+                   &Benchmark::playerAdvanceInstances,
+                   &Benchmark::batchPlayerAdvance}, 10);
 
     _keys = Containers::Array<Float>{DataSize};
     _values = Containers::Array<Int>{DirectInit, DataSize, 1};
@@ -95,6 +115,15 @@ Benchmark::Benchmark() {
     _track = TrackView<const Float, const Int>{
         Containers::arrayView(_keys), Containers::arrayView(_values), Math::select};
     _trackInterleaved = {_keysInterleaved, _valuesInterleaved, Math::select};
+
+    _translations = Containers::Array<std::pair<Float, Vector3>>{InstanceKeyframeCount};
+    _rotations = Containers::Array<std::pair<Float, Quaternion>>{InstanceKeyframeCount};
+    for(std::size_t i = 0; i != InstanceKeyframeCount; ++i) {
+        _translations[i] = {Float(i)*0.5f, Vector3{Float(i), 0.5f, -Float(i)}};
+        _rotations[i] = {Float(i)*0.5f, Quaternion::rotation(Deg(Float(i)*35.0f), Vector3::yAxis())};
+    }
+    _translationTrack = {Containers::arrayView(_translations), Math::lerp};
+    _rotationTrack = {Containers::arrayView(_rotations), Math::slerpShortestPath};
 }
 
 void Benchmark::interpolateEmpty() {
@@ -127,6 +156,26 @@ void Benchmark::interpolateInterleavedStrict() {
     CORRADE_COMPARE(result, 125000);
 }
 
+void Benchmark::interpolateInterleavedBackwards() {
+    Int result{};
+    CORRADE_BENCHMARK(250) {
+        std::size_t hint{};
+        /* Every step goes back, so the hint can't be used */
+        for(Float i = 500.0f; i > 0.0f; i -= 1.0f)
+            result += interpolate(_keysInterleaved, _valuesInterleaved, {}, {}, Math::select, i, hint);
+    }
+    CORRADE_COMPARE(result, 125000);
+}
+
+void Benchmark::interpolateFixedRate() {
+    Int result{};
+    CORRADE_BENCHMARK(250) {
+        for(Float i = 0.0f; i < 500.0f; i += 1.0f)
+            result += Animation::interpolateFixedRate(0.0f, 3.1254f, _valuesInterleaved, {}, {}, Math::select, i);
+    }
+    CORRADE_COMPARE(result, 125000);
+}
+
 void Benchmark::atEmpty() {
     TrackView<Float, Int> empty{nullptr, nullptr, Math::select};
 
@@ -261,6 +310,47 @@ void Benchmark::playerAdvanceRawCallbackDirectInterpolator() {
     CORRADE_COMPARE(result, 125000);
 }
 
+void Benchmark::playerAdvanceInstances() {
+    Containers::Array<Vector3> translations{InstanceCount};
+    Containers::Array<Quaternion> rotations{InstanceCount};
+    Containers::Array<Player<Float>> players{InstanceCount};
+    for(std::size_t i = 0; i != InstanceCount; ++i) {
+        players[i]
+            .add(_translationTrack, translations[i])
+            .add(_rotationTrack, rotations[i])
+            .setPlayCount(0)
+            .play(Float(i)*0.01f);
+    }
+
+    CORRADE_BENCHMARK(10) {
+        for(Float i = 10.0f; i < 20.0f; i += 0.25f)
+            for(Player<Float>& player: players)
+                player.advance(i);
+    }
+    CORRADE_VERIFY(rotations[InstanceCount - 1].isNormalized());
+}
+
+void Benchmark::batchPlayerAdvance() {
+    Containers::Array<Vector3> translations{InstanceCount};
+    Containers::Array<Quaternion> rotations{InstanceCount};
+    Containers::Array<Float> startTimes{InstanceCount};
+    for(std::size_t i = 0; i != InstanceCount; ++i)
+        startTimes[i] = Float(i)*0.01f;
+
+    BatchPlayer player{InstanceCount};
+    player
+        .add(_translationTrack, Containers::stridedArrayView(translations))
+        .add(_rotationTrack, Containers::stridedArrayView(rotations))
+        .setPlayCount(0)
+        .play(Containers::stridedArrayView(startTimes));
+
+    CORRADE_BENCHMARK(10) {
+        for(Float i = 10.0f; i < 20.0f; i += 0.25f)
+            player.advance(i);
+    }
+    CORRADE_VERIFY(rotations[InstanceCount - 1].isNormalized());
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Animation::Test::Benchmark)
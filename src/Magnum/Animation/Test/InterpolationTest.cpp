@@ -69,6 +69,7 @@ struct InterpolationTest: TestSuite::Tester {
 
     void interpolateHint();
     void interpolateStrictHint();
+    void interpolateHintSeek();
 
     void interpolateDifferentResultType();
     void interpolateStrictDifferentResultType();
@@ -79,6 +80,17 @@ struct InterpolationTest: TestSuite::Tester {
     void interpolateIntegerKey();
     void interpolateStrictIntegerKey();
 
+    void interpolateInto();
+    void interpolateIntoSingleKeyframe();
+    void interpolateIntoNoKeyframe();
+    void interpolateIntoError();
+
+    void interpolateFixedRate();
+    void interpolateFixedRateSingleKeyframe();
+    void interpolateFixedRateNoKeyframe();
+    void interpolateFixedRateIntegerKey();
+    void interpolateFixedRateError();
+
     void ease();
     void easeClamped();
     void unpack();
@@ -194,14 +206,35 @@ InterpolationTest::InterpolationTest() {
                        &InterpolationTest::interpolateStrictHint},
                        Containers::arraySize(HintData));
 
-    addTests({&InterpolationTest::interpolateDifferentResultType,
+    addTests({&InterpolationTest::interpolateHintSeek,
+
+              &InterpolationTest::interpolateDifferentResultType,
               &InterpolationTest::interpolateStrictDifferentResultType,
 
               &InterpolationTest::interpolateError,
               &InterpolationTest::interpolateStrictError,
 
               &InterpolationTest::interpolateIntegerKey,
-              &InterpolationTest::interpolateStrictIntegerKey,
+              &InterpolationTest::interpolateStrictIntegerKey});
+
+    addInstancedTests({&InterpolationTest::interpolateInto},
+                       Containers::arraySize(Data));
+
+    addInstancedTests({&InterpolationTest::interpolateIntoSingleKeyframe},
+                       Containers::arraySize(SingleKeyframeData));
+
+    addTests({&InterpolationTest::interpolateIntoNoKeyframe,
+              &InterpolationTest::interpolateIntoError});
+
+    addInstancedTests({&InterpolationTest::interpolateFixedRate},
+                       Containers::arraySize(Data));
+
+    addInstancedTests({&InterpolationTest::interpolateFixedRateSingleKeyframe},
+                       Containers::arraySize(SingleKeyframeData));
+
+    addTests({&InterpolationTest::interpolateFixedRateNoKeyframe,
+              &InterpolationTest::interpolateFixedRateIntegerKey,
+              &InterpolationTest::interpolateFixedRateError,
 
               &InterpolationTest::ease,
               &InterpolationTest::easeClamped,
@@ -503,6 +536,37 @@ void InterpolationTest::interpolateStrictHint() {
     CORRADE_COMPARE(hint, 2);
 }
 
+void InterpolationTest::interpolateHintSeek() {
+    constexpr Float keys[]{0.0f, 1.0f, 1.5f, 1.5f, 3.0f, 4.0f, 4.5f, 6.0f, 7.0f, 8.0f, 10.0f};
+    constexpr Float values[]{0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f};
+
+    /* Going forward by small steps, jumping forward and backward and
+       outside of the range. The hint is carried over between all of them. */
+    std::size_t hint{};
+    for(Float frame: {-1.0f, 0.0f, 0.5f, 1.25f, 1.5f, 2.0f, 3.5f, 9.0f, 9.5f,
+                      15.0f, 0.25f, 4.25f, 4.0f, 1.5f, 1.0f, 7.5f, 6.0f,
+                      -3.0f}) {
+        CORRADE_ITERATION(frame);
+
+        /* Last key that's not larger than the frame, limited to the last
+           keyframe pair */
+        std::size_t expectedHint = 0;
+        while(expectedHint + 2 < Containers::arraySize(keys) && frame >= keys[expectedHint + 1])
+            ++expectedHint;
+
+        std::size_t freshHint{};
+        const Float expected = Animation::interpolate<Float, Float>(
+            keys, values, Extrapolation::Extrapolated,
+            Extrapolation::Extrapolated, Math::lerp, frame, freshHint);
+        CORRADE_COMPARE(freshHint, expectedHint);
+
+        CORRADE_COMPARE((Animation::interpolate<Float, Float>(
+            keys, values, Extrapolation::Extrapolated,
+            Extrapolation::Extrapolated, Math::lerp, frame, hint)), expected);
+        CORRADE_COMPARE(hint, expectedHint);
+    }
+}
+
 using namespace Math::Literals;
 
 const Half HalfValues[]{3.0_h, 1.0_h, 2.5_h, 0.5_h};
@@ -541,6 +605,139 @@ void InterpolationTest::interpolateStrictIntegerKey() {
     CORRADE_COMPARE(hint, 2);
 }
 
+void InterpolationTest::interpolateInto() {
+    const auto& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Second track is the first one scaled */
+    const Float values[]{
+        Values[0], Values[0]*2.0f,
+        Values[1], Values[1]*2.0f,
+        Values[2], Values[2]*2.0f,
+        Values[3], Values[3]*2.0f
+    };
+
+    std::size_t hint{};
+    Float out[2];
+    Animation::interpolateInto<Float, Float, Float>(Keys,
+        Containers::StridedArrayView2D<const Float>{values, {4, 2}},
+        data.extrapolationBefore, data.extrapolationAfter, Math::lerp,
+        data.time, hint, out);
+    CORRADE_COMPARE(out[0], data.expectedValue);
+    CORRADE_COMPARE(out[1], data.expectedValue*2.0f);
+    CORRADE_COMPARE(hint, data.expectedHint);
+}
+
+void InterpolationTest::interpolateIntoSingleKeyframe() {
+    const auto& data = SingleKeyframeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Float values[]{Values[0], Values[0]*2.0f};
+
+    std::size_t hint{};
+    Float out[2];
+    Animation::interpolateInto<Float, Float, Float>(
+        Containers::arrayView(Keys).prefix(1),
+        Containers::StridedArrayView2D<const Float>{values, {1, 2}},
+        data.extrapolation, data.extrapolation,
+        Math::lerp, data.time, hint, out);
+    CORRADE_COMPARE(out[0], data.expectedValue);
+    CORRADE_COMPARE(out[1], data.expectedValue*2.0f);
+    CORRADE_COMPARE(hint, 0);
+}
+
+void InterpolationTest::interpolateIntoNoKeyframe() {
+    std::size_t hint{};
+    Float out[2]{1.0f, 2.0f};
+    Animation::interpolateInto<Float, Float, Float>(
+        nullptr, Containers::StridedArrayView2D<const Float>{nullptr, {0, 2}},
+        Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+        Math::lerp, 3.5f, hint, out);
+    CORRADE_COMPARE(out[0], Float{});
+    CORRADE_COMPARE(out[1], Float{});
+    CORRADE_COMPARE(hint, 0);
+}
+
+void InterpolationTest::interpolateIntoError() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Float values[8]{};
+    Float destination[3];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    {
+        std::size_t hint{};
+        Animation::interpolateInto<Float, Float, Float>(
+            Containers::arrayView(Keys).prefix(3),
+            Containers::StridedArrayView2D<const Float>{values, {4, 2}},
+            Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+            Math::lerp, 0.0f, hint,
+            Containers::arrayView(destination).prefix(2));
+    } {
+        std::size_t hint{};
+        Animation::interpolateInto<Float, Float, Float>(Keys,
+            Containers::StridedArrayView2D<const Float>{values, {4, 2}},
+            Extrapolation::Extrapolated, Extrapolation::Extrapolated,
+            Math::lerp, 0.0f, hint, destination);
+    }
+    CORRADE_COMPARE(out.str(),
+        "Animation::interpolateInto(): expected 3 keyframes but got 4\n"
+        "Animation::interpolateInto(): expected destination view to have 2 items but got 3\n");
+}
+
+void InterpolationTest::interpolateFixedRate() {
+    const auto& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Compare against interpolate() with keys at the fixed rate */
+    const Float keys[]{0.0f, 2.0f, 4.0f, 6.0f};
+    std::size_t hint{};
+    const Float expected = Animation::interpolate<Float, Float>(
+        keys, Values, data.extrapolationBefore, data.extrapolationAfter,
+        Math::lerp, data.time, hint);
+
+    CORRADE_COMPARE((Animation::interpolateFixedRate<Float, Float>(
+        0.0f, 2.0f, Values, data.extrapolationBefore, data.extrapolationAfter,
+        Math::lerp, data.time)), expected);
+}
+
+void InterpolationTest::interpolateFixedRateSingleKeyframe() {
+    const auto& data = SingleKeyframeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    CORRADE_COMPARE((Animation::interpolateFixedRate<Float, Float>(
+        0.0f, 2.0f, Containers::arrayView(Values).prefix(1),
+        data.extrapolation, data.extrapolation,
+        Math::lerp, data.time)), data.expectedValue);
+}
+
+void InterpolationTest::interpolateFixedRateNoKeyframe() {
+    CORRADE_COMPARE((Animation::interpolateFixedRate<Float, Float>(
+        0.0f, 2.0f, nullptr, Extrapolation::Extrapolated,
+        Extrapolation::Extrapolated, Math::lerp, 3.5f)), Float{});
+}
+
+void InterpolationTest::interpolateFixedRateIntegerKey() {
+    /* Same as interpolateIntegerKey(), except that the keys are evenly
+       spaced */
+    CORRADE_COMPARE((Animation::interpolateFixedRate<Int, Float>(
+        0, 48, Values, Extrapolation::Extrapolated,
+        Extrapolation::Extrapolated, Math::lerp, 132)), 1.0f);
+}
+
+void InterpolationTest::interpolateFixedRateError() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Animation::interpolateFixedRate<Float, Float>(1.0f, 0.0f, Values,
+        Extrapolation::Extrapolated, Extrapolation::Extrapolated, Math::lerp,
+        0.0f);
+    CORRADE_COMPARE(out.str(),
+        "Animation::interpolateFixedRate(): expected a positive step\n");
+}
+
 void InterpolationTest::interpolateError() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -0,0 +1,184 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h> /** @todo remove once Debug is stream-free */
+
+#include "Magnum/Animation/PackedQuaternion.h"
+#include "Magnum/Animation/Track.h"
+
+namespace Magnum { namespace Animation { namespace Test { namespace {
+
+struct PackedQuaternionTest: TestSuite::Tester {
+    explicit PackedQuaternionTest();
+
+    void construct();
+    void constructDefault();
+    void constructData();
+    void pack();
+    void packNegative();
+    void compare();
+
+    void interpolate();
+    void interpolatorFor();
+    void track();
+};
+
+using namespace Math::Literals;
+
+/* Shortest-path angle between two rotations, the packing isn't precise enough
+   for a fuzzy compare of the components */
+Float angle(const Quaternion& a, const Quaternion& b) {
+    return 2.0f*std::acos(Math::min(Math::abs(Math::dot(a, b)), 1.0f));
+}
+
+const struct {
+    const char* name;
+    Quaternion rotation;
+} PackData[]{
+    {"identity", Quaternion{}},
+    {"X", Quaternion::rotation(35.0_degf, Vector3::xAxis())},
+    {"Y", Quaternion::rotation(-120.0_degf, Vector3::yAxis())},
+    {"Z", Quaternion::rotation(179.0_degf, Vector3::zAxis())},
+    {"arbitrary", Quaternion::rotation(73.0_degf, Vector3{1.0f, -2.0f, 0.5f}.normalized())},
+    {"all components equal", Quaternion{{0.5f, 0.5f, 0.5f}, 0.5f}},
+};
+
+PackedQuaternionTest::PackedQuaternionTest() {
+    addTests({&PackedQuaternionTest::construct,
+              &PackedQuaternionTest::constructDefault,
+              &PackedQuaternionTest::constructData});
+
+    addInstancedTests({&PackedQuaternionTest::pack},
+        Containers::arraySize(PackData));
+
+    addTests({&PackedQuaternionTest::packNegative,
+              &PackedQuaternionTest::compare,
+
+              &PackedQuaternionTest::interpolate,
+              &PackedQuaternionTest::interpolatorFor,
+              &PackedQuaternionTest::track});
+}
+
+void PackedQuaternionTest::construct() {
+    PackedQuaternion a{Quaternion::rotation(90.0_degf, Vector3::zAxis())};
+    CORRADE_COMPARE(Quaternion{a}, Quaternion::rotation(90.0_degf, Vector3::zAxis()));
+
+    CORRADE_COMPARE(sizeof(PackedQuaternion), 6);
+    CORRADE_VERIFY(std::is_trivially_copyable<PackedQuaternion>::value);
+    CORRADE_VERIFY(std::is_nothrow_constructible<PackedQuaternion, Quaternion>::value);
+
+    /* Not implicitly constructible from a quaternion nor implicitly
+       convertible to it */
+    CORRADE_VERIFY(!std::is_convertible<Quaternion, PackedQuaternion>::value);
+    CORRADE_VERIFY(!std::is_convertible<PackedQuaternion, Quaternion>::value);
+}
+
+void PackedQuaternionTest::constructDefault() {
+    constexpr PackedQuaternion a;
+    CORRADE_COMPARE(Quaternion{a}, Quaternion{});
+
+    /* Zero is represented exactly, so the identity is exact as well */
+    CORRADE_COMPARE(Quaternion{a}.vector().x(), 0.0f);
+    CORRADE_COMPARE(Quaternion{a}.scalar(), 1.0f);
+    CORRADE_VERIFY(a == PackedQuaternion{Quaternion{}});
+
+    CORRADE_VERIFY(std::is_nothrow_default_constructible<PackedQuaternion>::value);
+}
+
+void PackedQuaternionTest::constructData() {
+    constexpr PackedQuaternion a{Vector3us{0x8000|16383, 0x8000|16383, 16383}};
+    constexpr Vector3us data = a.data();
+    CORRADE_COMPARE(data, (Vector3us{0x8000|16383, 0x8000|16383, 16383}));
+    CORRADE_VERIFY(a == PackedQuaternion{});
+}
+
+void PackedQuaternionTest::pack() {
+    auto&& data = PackData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Quaternion unpacked{PackedQuaternion{data.rotation}};
+    CORRADE_VERIFY(unpacked.isNormalized());
+
+    CORRADE_COMPARE_AS(angle(unpacked, data.rotation), 0.0002f,
+        TestSuite::Compare::Less);
+}
+
+void PackedQuaternionTest::packNegative() {
+    /* The largest component is negative, the result gets flipped but
+       represents the same rotation */
+    Quaternion a{{0.1f, -0.2f, 0.3f}, -0.9f};
+    a = a.normalized();
+    Quaternion unpacked{PackedQuaternion{a}};
+    CORRADE_COMPARE_AS(unpacked.scalar(), 0.0f,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(angle(unpacked, a), 0.0002f,
+        TestSuite::Compare::Less);
+}
+
+void PackedQuaternionTest::compare() {
+    PackedQuaternion a{Quaternion::rotation(35.0_degf, Vector3::xAxis())};
+    PackedQuaternion b{Quaternion::rotation(35.0_degf, Vector3::xAxis())};
+    PackedQuaternion c{Quaternion::rotation(35.0_degf, Vector3::yAxis())};
+    CORRADE_VERIFY(a == b);
+    CORRADE_VERIFY(!(a != b));
+    CORRADE_VERIFY(a != c);
+    CORRADE_VERIFY(!(a == c));
+}
+
+void PackedQuaternionTest::interpolate() {
+    Quaternion a = Quaternion::rotation(15.0_degf, Vector3::xAxis());
+    Quaternion b = Quaternion::rotation(75.0_degf, Vector3::xAxis());
+    PackedQuaternion pa{a}, pb{b};
+
+    CORRADE_COMPARE(select(pa, pb, 0.25f), Quaternion{pa});
+    CORRADE_COMPARE(select(pa, pb, 1.0f), Quaternion{pb});
+    CORRADE_COMPARE(slerpShortestPath(pa, pb, 0.5f),
+        Math::slerpShortestPath(Quaternion{pa}, Quaternion{pb}, 0.5f));
+    CORRADE_COMPARE_AS(angle(slerpShortestPath(pa, pb, 0.5f), Quaternion::rotation(45.0_degf, Vector3::xAxis())), 0.0002f,
+        TestSuite::Compare::Less);
+}
+
+void PackedQuaternionTest::interpolatorFor() {
+    CORRADE_VERIFY((Animation::interpolatorFor<PackedQuaternion, Quaternion>(Interpolation::Constant) == static_cast<Quaternion(*)(const PackedQuaternion&, const PackedQuaternion&, Float)>(select)));
+    CORRADE_VERIFY((Animation::interpolatorFor<PackedQuaternion>(Interpolation::Linear) == static_cast<Quaternion(*)(const PackedQuaternion&, const PackedQuaternion&, Float)>(slerpShortestPath)));
+}
+
+void PackedQuaternionTest::track() {
+    const Track<Float, PackedQuaternion> track{{
+        {0.0f, PackedQuaternion{Quaternion::rotation(0.0_degf, Vector3::zAxis())}},
+        {2.0f, PackedQuaternion{Quaternion::rotation(90.0_degf, Vector3::zAxis())}},
+        {4.0f, PackedQuaternion{Quaternion::rotation(180.0_degf, Vector3::zAxis())}}
+    }, Interpolation::Linear};
+
+    CORRADE_COMPARE(track.at(1.0f), Quaternion::rotation(45.0_degf, Vector3::zAxis()));
+    CORRADE_COMPARE(track.at(3.0f), Quaternion::rotation(135.0_degf, Vector3::zAxis()));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::PackedQuaternionTest)
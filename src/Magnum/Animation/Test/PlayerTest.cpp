@@ -63,6 +63,8 @@ struct PlayerTest: TestSuite::Tester {
     void advancePlayCountInfinite();
     void advanceChrono();
     void advanceList();
+    void advanceListParallel();
+    void advanceListParallelAliasing();
     void advanceZeroDurationStop();
     void advanceZeroDurationPause();
     void advanceZeroDurationInfinitePlayCount();
@@ -154,6 +156,8 @@ PlayerTest::PlayerTest() {
               &PlayerTest::advancePlayCountInfinite,
               &PlayerTest::advanceChrono,
               &PlayerTest::advanceList,
+              &PlayerTest::advanceListParallel,
+              &PlayerTest::advanceListParallelAliasing,
               &PlayerTest::advanceZeroDurationStop,
               &PlayerTest::advanceZeroDurationPause,
               &PlayerTest::advanceZeroDurationInfinitePlayCount,
@@ -803,6 +807,96 @@ void PlayerTest::advanceList() {
     CORRADE_COMPARE(valueB, 2.75f);
 }
 
+/* Executes the tasks serially in reverse order and counts the calls, to
+   verify the result doesn't depend on the iteration order */
+void reverseParallelFor(void* state, std::size_t count, void(*task)(void*, std::size_t), void* taskState) {
+    ++*static_cast<std::size_t*>(state);
+    for(std::size_t i = count; i != 0; --i)
+        task(taskState, i - 1);
+}
+
+void PlayerTest::advanceListParallel() {
+    Float valueA = -1.0f, valueB = -1.0f, valueC = -1.0f;
+    Int callbackValue = 0;
+    Player<Float> a, b, c;
+    a.add(Track, valueA)
+     .play(2.0f);
+    /* Result destination and callback data shared by tracks of the same
+       player is fine */
+    b.add(Track, valueB)
+     .addWithCallbackOnChange(Track, [](Float, const Float&, Int& callbackValue) {
+        ++callbackValue;
+     }, valueB, callbackValue)
+     .play(1.0f);
+    /* Not playing yet, shouldn't get updated */
+    c.add(Track, valueC)
+     .play(5.0f);
+
+    const Containers::Reference<Player<Float>> players[]{a, b, c};
+
+    /* 1.75 secs in for A, 2.75 seconds in for B */
+    std::size_t calls = 0;
+    Player<Float>::advance(3.75f, players, reverseParallelFor, &calls);
+    CORRADE_COMPARE(calls, 1);
+    CORRADE_COMPARE(a.state(), State::Playing);
+    CORRADE_COMPARE(b.state(), State::Playing);
+    CORRADE_COMPARE(valueA, 4.0f);
+    CORRADE_COMPARE(valueB, 2.75f);
+    CORRADE_COMPARE(valueC, -1.0f);
+    /* The destination got updated by the first track already, so the
+       on-change callback doesn't fire */
+    CORRADE_COMPARE(callbackValue, 0);
+
+    /* With a null executor it's serial, giving the same result */
+    valueA = valueB = -1.0f;
+    Player<Float>::advance(3.75f, players, nullptr);
+    CORRADE_COMPARE(calls, 1);
+    CORRADE_COMPARE(valueA, 4.0f);
+    CORRADE_COMPARE(valueB, 2.75f);
+    CORRADE_COMPARE(valueC, -1.0f);
+}
+
+void PlayerTest::advanceListParallelAliasing() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Float valueA = -1.0f, valueB = -1.0f;
+    Int callbackValue = 0;
+    auto callback = [](Float, const Float&, Int& callbackValue) {
+        ++callbackValue;
+    };
+    Player<Float> a, b, c, d;
+    a.add(Track, valueA);
+    b.add(Track, valueB);
+    c.add(Track, valueA);
+    d.addWithCallback(Track, callback, callbackValue);
+    Player<Float> e;
+    e.addWithCallback(Track, callback, callbackValue);
+
+    std::size_t calls = 0;
+    std::ostringstream out;
+    Error redirectError{&out};
+    Player<Float>::advance(1.0f, Containers::arrayView({
+        Containers::Reference<Player<Float>>{a},
+        Containers::Reference<Player<Float>>{b},
+        Containers::Reference<Player<Float>>{c}
+    }), reverseParallelFor, &calls);
+    Player<Float>::advance(1.0f, Containers::arrayView({
+        Containers::Reference<Player<Float>>{d},
+        Containers::Reference<Player<Float>>{e}
+    }), reverseParallelFor, &calls);
+    Player<Float>::advance(1.0f, Containers::arrayView({
+        Containers::Reference<Player<Float>>{b},
+        Containers::Reference<Player<Float>>{a},
+        Containers::Reference<Player<Float>>{b}
+    }), reverseParallelFor, &calls);
+    /* The executor isn't called at all */
+    CORRADE_COMPARE(calls, 0);
+    CORRADE_COMPARE(out.str(),
+        "Animation::Player::advance(): players 0 and 2 share a destination or callback data pointer\n"
+        "Animation::Player::advance(): players 0 and 1 share a destination or callback data pointer\n"
+        "Animation::Player::advance(): players 0 and 2 share a destination or callback data pointer\n");
+}
+
 void PlayerTest::advanceZeroDurationStop() {
     Float value = -1.0f;
     Player<Float> player;
@@ -0,0 +1,396 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Animation/PoseBlender.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Animation { namespace Test { namespace {
+
+struct PoseBlenderTest: TestSuite::Tester {
+    explicit PoseBlenderTest();
+
+    void construct();
+    void constructCopy();
+    void constructMove();
+
+    void addLayer();
+    void layerInvalid();
+    void addTrackInvalid();
+
+    void blendEmpty();
+    void blendOverride();
+    void blendOverrideWeighted();
+    void blendAdditive();
+    void blendAdditiveWeighted();
+    void blendLayers();
+    void blendZeroWeight();
+    void blendInvalid();
+
+    void debugBlendMode();
+    void debugBlendModePacked();
+};
+
+using namespace Math::Literals;
+
+PoseBlenderTest::PoseBlenderTest() {
+    addTests({&PoseBlenderTest::construct,
+              &PoseBlenderTest::constructCopy,
+              &PoseBlenderTest::constructMove,
+
+              &PoseBlenderTest::addLayer,
+              &PoseBlenderTest::layerInvalid,
+              &PoseBlenderTest::addTrackInvalid,
+
+              &PoseBlenderTest::blendEmpty,
+              &PoseBlenderTest::blendOverride,
+              &PoseBlenderTest::blendOverrideWeighted,
+              &PoseBlenderTest::blendAdditive,
+              &PoseBlenderTest::blendAdditiveWeighted,
+              &PoseBlenderTest::blendLayers,
+              &PoseBlenderTest::blendZeroWeight,
+              &PoseBlenderTest::blendInvalid,
+
+              &PoseBlenderTest::debugBlendMode,
+              &PoseBlenderTest::debugBlendModePacked});
+}
+
+const Track<Float, Vector3> TranslationTrack{{
+    {0.0f, {0.0f, 0.0f, 0.0f}},
+    {2.0f, {2.0f, 4.0f, 6.0f}}
+}, Math::lerp};
+
+const Track<Float, Quaternion> RotationTrack{{
+    {0.0f, {}},
+    {2.0f, Quaternion::rotation(90.0_degf, Vector3::zAxis())}
+}, Math::slerpShortestPath};
+
+const Track<Float, Vector3> ScalingTrack{{
+    {0.0f, Vector3{1.0f}},
+    {2.0f, Vector3{3.0f}}
+}, Math::lerp};
+
+/* Sampled at 1.0, the tracks give these */
+const Vector3 SampledTranslation{1.0f, 2.0f, 3.0f};
+const Quaternion SampledRotation = Quaternion::rotation(45.0_degf, Vector3::zAxis());
+const Vector3 SampledScaling{2.0f};
+
+/* Pose to blend on top of */
+const Vector3 PoseTranslations[]{
+    {1.0f, 0.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f},
+    {0.0f, 0.0f, 1.0f}
+};
+const Quaternion PoseRotations[]{
+    Quaternion::rotation(30.0_degf, Vector3::xAxis()),
+    Quaternion::rotation(-60.0_degf, Vector3::zAxis()),
+    Quaternion::rotation(15.0_degf, Vector3::yAxis())
+};
+const Vector3 PoseScalings[]{
+    Vector3{0.5f},
+    Vector3{1.0f},
+    Vector3{2.0f}
+};
+
+struct Pose {
+    Vector3 translations[3]{PoseTranslations[0], PoseTranslations[1], PoseTranslations[2]};
+    Quaternion rotations[3]{PoseRotations[0], PoseRotations[1], PoseRotations[2]};
+    Vector3 scalings[3]{PoseScalings[0], PoseScalings[1], PoseScalings[2]};
+};
+
+void PoseBlenderTest::construct() {
+    PoseBlender blender{5};
+    CORRADE_COMPARE(blender.jointCount(), 5);
+    CORRADE_COMPARE(blender.layerCount(), 0);
+}
+
+void PoseBlenderTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<PoseBlender>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<PoseBlender>{});
+}
+
+void PoseBlenderTest::constructMove() {
+    PoseBlender a{5};
+    a.addLayer(BlendMode::Additive, 0.5f);
+
+    PoseBlender b{Utility::move(a)};
+    CORRADE_COMPARE(b.jointCount(), 5);
+    CORRADE_COMPARE(b.layerCount(), 1);
+    CORRADE_COMPARE(b.layerMode(0), BlendMode::Additive);
+
+    PoseBlender c{3};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.jointCount(), 5);
+    CORRADE_COMPARE(c.layerCount(), 1);
+    CORRADE_COMPARE(c.layerWeight(0), 0.5f);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<PoseBlender>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<PoseBlender>::value);
+}
+
+void PoseBlenderTest::addLayer() {
+    PoseBlender blender{3};
+    CORRADE_COMPARE(blender.addLayer(BlendMode::Override), 0);
+    CORRADE_COMPARE(blender.addLayer(BlendMode::Additive, 0.25f), 1);
+    CORRADE_COMPARE(blender.layerCount(), 2);
+    CORRADE_COMPARE(blender.layerMode(0), BlendMode::Override);
+    CORRADE_COMPARE(blender.layerMode(1), BlendMode::Additive);
+    CORRADE_COMPARE(blender.layerWeight(0), 1.0f);
+    CORRADE_COMPARE(blender.layerWeight(1), 0.25f);
+
+    blender.setLayerWeight(0, 0.75f);
+    CORRADE_COMPARE(blender.layerWeight(0), 0.75f);
+}
+
+void PoseBlenderTest::layerInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    PoseBlender blender{3};
+    blender.addLayer(BlendMode::Override);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    blender.layerMode(1);
+    blender.layerWeight(1);
+    blender.setLayerWeight(1, 0.5f);
+    CORRADE_COMPARE(out.str(),
+        "Animation::PoseBlender::layerMode(): index 1 out of range for 1 layers\n"
+        "Animation::PoseBlender::layerWeight(): index 1 out of range for 1 layers\n"
+        "Animation::PoseBlender::setLayerWeight(): index 1 out of range for 1 layers\n");
+}
+
+void PoseBlenderTest::addTrackInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    PoseBlender blender{3};
+    blender.addLayer(BlendMode::Override);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    blender.addTranslation(1, 0, TranslationTrack);
+    blender.addTranslation(0, 3, TranslationTrack);
+    blender.addRotation(1, 0, RotationTrack);
+    blender.addRotation(0, 3, RotationTrack);
+    blender.addScaling(1, 0, ScalingTrack);
+    blender.addScaling(0, 3, ScalingTrack);
+    CORRADE_COMPARE(out.str(),
+        "Animation::PoseBlender::addTranslation(): index 1 out of range for 1 layers\n"
+        "Animation::PoseBlender::addTranslation(): joint 3 out of range for 3 joints\n"
+        "Animation::PoseBlender::addRotation(): index 1 out of range for 1 layers\n"
+        "Animation::PoseBlender::addRotation(): joint 3 out of range for 3 joints\n"
+        "Animation::PoseBlender::addScaling(): index 1 out of range for 1 layers\n"
+        "Animation::PoseBlender::addScaling(): joint 3 out of range for 3 joints\n");
+}
+
+void PoseBlenderTest::blendEmpty() {
+    PoseBlender blender{3};
+    blender.addLayer(BlendMode::Override);
+
+    /* A layer with no tracks does nothing */
+    Pose pose;
+    const Float times[]{1.0f};
+    blender.blend(times, pose.translations, pose.rotations, pose.scalings);
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(pose.translations[i], PoseTranslations[i]);
+        CORRADE_COMPARE(pose.rotations[i], PoseRotations[i]);
+        CORRADE_COMPARE(pose.scalings[i], PoseScalings[i]);
+    }
+}
+
+void PoseBlenderTest::blendOverride() {
+    PoseBlender blender{3};
+    blender.addLayer(BlendMode::Override);
+    /* Each joint gets a different subset of tracks, the rest stays
+       untouched */
+    blender
+        .addTranslation(0, 0, TranslationTrack)
+        .addRotation(0, 1, RotationTrack)
+        .addScaling(0, 2, ScalingTrack)
+        .addRotation(0, 2, RotationTrack);
+
+    Pose pose;
+    const Float times[]{1.0f};
+    blender.blend(times, pose.translations, pose.rotations, pose.scalings);
+    CORRADE_COMPARE(pose.translations[0], SampledTranslation);
+    CORRADE_COMPARE(pose.rotations[0], PoseRotations[0]);
+    CORRADE_COMPARE(pose.scalings[0], PoseScalings[0]);
+    CORRADE_COMPARE(pose.translations[1], PoseTranslations[1]);
+    CORRADE_COMPARE(pose.rotations[1], SampledRotation);
+    CORRADE_COMPARE(pose.scalings[1], PoseScalings[1]);
+    CORRADE_COMPARE(pose.translations[2], PoseTranslations[2]);
+    CORRADE_COMPARE(pose.rotations[2], SampledRotation);
+    CORRADE_COMPARE(pose.scalings[2], SampledScaling);
+
+    /* Blending again at a later time continues from the hint and overwrites
+       the values again */
+    const Float times2[]{2.0f};
+    blender.blend(times2, pose.translations, pose.rotations, pose.scalings);
+    CORRADE_COMPARE(pose.translations[0], (Vector3{2.0f, 4.0f, 6.0f}));
+    CORRADE_COMPARE(pose.rotations[1], Quaternion::rotation(90.0_degf, Vector3::zAxis()));
+    CORRADE_COMPARE(pose.scalings[2], Vector3{3.0f});
+}
+
+void PoseBlenderTest::blendOverrideWeighted() {
+    PoseBlender blender{3};
+    blender.addLayer(BlendMode::Override, 0.25f);
+    blender
+        .addTranslation(0, 1, TranslationTrack)
+        .addRotation(0, 1, RotationTrack)
+        .addRotation(0, 2, RotationTrack)
+        .addScaling(0, 0, ScalingTrack);
+
+    Pose pose;
+    const Float times[]{1.0f};
+    blender.blend(times, pose.translations, pose.rotations, pose.scalings);
+    CORRADE_COMPARE(pose.translations[0], PoseTranslations[0]);
+    CORRADE_COMPARE(pose.translations[1], Math::lerp(PoseTranslations[1], SampledTranslation, 0.25f));
+    CORRADE_COMPARE(pose.translations[2], PoseTranslations[2]);
+    CORRADE_COMPARE(pose.rotations[0], PoseRotations[0]);
+    CORRADE_COMPARE(pose.rotations[1], Math::slerpShortestPath(PoseRotations[1], SampledRotation, 0.25f));
+    CORRADE_COMPARE(pose.rotations[2], Math::slerpShortestPath(PoseRotations[2], SampledRotation, 0.25f));
+    CORRADE_COMPARE(pose.scalings[0], Math::lerp(PoseScalings[0], SampledScaling, 0.25f));
+    CORRADE_COMPARE(pose.scalings[1], PoseScalings[1]);
+    CORRADE_COMPARE(pose.scalings[2], PoseScalings[2]);
+}
+
+void PoseBlenderTest::blendAdditive() {
+    PoseBlender blender{3};
+    blender.addLayer(BlendMode::Additive);
+    blender
+        .addTranslation(0, 0, TranslationTrack)
+        .addRotation(0, 1, RotationTrack)
+        .addScaling(0, 2, ScalingTrack);
+
+    Pose pose;
+    const Float times[]{1.0f};
+    blender.blend(times, pose.translations, pose.rotations, pose.scalings);
+    CORRADE_COMPARE(pose.translations[0], PoseTranslations[0] + SampledTranslation);
+    CORRADE_COMPARE(pose.rotations[1], PoseRotations[1]*SampledRotation);
+    CORRADE_COMPARE(pose.scalings[2], PoseScalings[2]*SampledScaling);
+
+    /* The rest is untouched */
+    CORRADE_COMPARE(pose.translations[1], PoseTranslations[1]);
+    CORRADE_COMPARE(pose.rotations[0], PoseRotations[0]);
+    CORRADE_COMPARE(pose.scalings[0], PoseScalings[0]);
+}
+
+void PoseBlenderTest::blendAdditiveWeighted() {
+    PoseBlender blender{3};
+    blender.addLayer(BlendMode::Additive, 0.5f);
+    blender
+        .addTranslation(0, 0, TranslationTrack)
+        .addRotation(0, 1, RotationTrack)
+        .addScaling(0, 2, ScalingTrack);
+
+    Pose pose;
+    const Float times[]{1.0f};
+    blender.blend(times, pose.translations, pose.rotations, pose.scalings);
+    CORRADE_COMPARE(pose.translations[0], PoseTranslations[0] + SampledTranslation*0.5f);
+    /* Half of 45° */
+    CORRADE_COMPARE(pose.rotations[1], PoseRotations[1]*Quaternion::rotation(22.5_degf, Vector3::zAxis()));
+    CORRADE_COMPARE(pose.scalings[2], PoseScalings[2]*Vector3{1.5f});
+}
+
+void PoseBlenderTest::blendLayers() {
+    PoseBlender blender{3};
+    blender.addLayer(BlendMode::Override);
+    blender.addLayer(BlendMode::Additive);
+    blender.addLayer(BlendMode::Override, 0.5f);
+    blender
+        .addTranslation(0, 0, TranslationTrack)
+        .addTranslation(1, 0, TranslationTrack)
+        .addTranslation(2, 0, TranslationTrack)
+        .addRotation(1, 1, RotationTrack)
+        .addRotation(2, 1, RotationTrack);
+
+    /* Each layer sampled at a different time */
+    Pose pose;
+    const Float times[]{1.0f, 2.0f, 0.0f};
+    blender.blend(times, pose.translations, pose.rotations, pose.scalings);
+
+    /* (1, 2, 3) from the first layer, + (2, 4, 6) from the second, halfway
+       to (0, 0, 0) from the third */
+    CORRADE_COMPARE(pose.translations[0], (Vector3{1.5f, 3.0f, 4.5f}));
+    /* Pose rotation multiplied with 90°, halfway to identity */
+    CORRADE_COMPARE(pose.rotations[1], Math::slerpShortestPath(PoseRotations[1]*Quaternion::rotation(90.0_degf, Vector3::zAxis()), Quaternion{}, 0.5f));
+}
+
+void PoseBlenderTest::blendZeroWeight() {
+    PoseBlender blender{3};
+    blender.addLayer(BlendMode::Override, 0.0f);
+    blender.addLayer(BlendMode::Additive, 0.0f);
+    blender
+        .addTranslation(0, 0, TranslationTrack)
+        .addRotation(1, 1, RotationTrack);
+
+    Pose pose;
+    const Float times[]{1.0f, 1.0f};
+    blender.blend(times, pose.translations, pose.rotations, pose.scalings);
+    CORRADE_COMPARE(pose.translations[0], PoseTranslations[0]);
+    CORRADE_COMPARE(pose.rotations[1], PoseRotations[1]);
+}
+
+void PoseBlenderTest::blendInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    PoseBlender blender{3};
+    blender.addLayer(BlendMode::Override);
+
+    Vector3 translations[3];
+    Quaternion rotations[3];
+    Vector3 scalings[3];
+    const Float times[]{1.0f, 2.0f};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    blender.blend(times, translations, rotations, scalings);
+    blender.blend(Containers::arrayView(times).prefix(1), translations, Containers::arrayView(rotations).prefix(2), scalings);
+    CORRADE_COMPARE(out.str(),
+        "Animation::PoseBlender::blend(): expected 1 layer times but got 2\n"
+        "Animation::PoseBlender::blend(): expected translation, rotation and scaling views to have 3 items but got 3, 2 and 3\n");
+}
+
+void PoseBlenderTest::debugBlendMode() {
+    std::ostringstream out;
+    Debug{&out} << BlendMode::Additive << BlendMode(0xbe);
+    CORRADE_COMPARE(out.str(), "Animation::BlendMode::Additive Animation::BlendMode(0xbe)\n");
+}
+
+void PoseBlenderTest::debugBlendModePacked() {
+    std::ostringstream out;
+    /* Last is not packed, ones before should not make any flags persistent */
+    Debug{&out} << Debug::packed << BlendMode::Additive << Debug::packed << BlendMode(0xbe) << BlendMode::Override;
+    CORRADE_COMPARE(out.str(), "Additive 0xbe Animation::BlendMode::Override\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::PoseBlenderTest)
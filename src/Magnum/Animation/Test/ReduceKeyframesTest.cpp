@@ -0,0 +1,202 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h> /** @todo remove once Debug is stream-free */
+
+#include "Magnum/Animation/ReduceKeyframes.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Animation { namespace Test { namespace {
+
+struct ReduceKeyframesTest: TestSuite::Tester {
+    explicit ReduceKeyframesTest();
+
+    void scalar();
+    void vector();
+    void quaternion();
+    void constant();
+    void maxError();
+    void tooFewKeyframes();
+    void sizeMismatch();
+};
+
+using namespace Math::Literals;
+
+ReduceKeyframesTest::ReduceKeyframesTest() {
+    addTests({&ReduceKeyframesTest::scalar,
+              &ReduceKeyframesTest::vector,
+              &ReduceKeyframesTest::quaternion,
+              &ReduceKeyframesTest::constant,
+              &ReduceKeyframesTest::maxError,
+              &ReduceKeyframesTest::tooFewKeyframes,
+              &ReduceKeyframesTest::sizeMismatch});
+}
+
+void ReduceKeyframesTest::scalar() {
+    /* Two linear segments with a corner at 3 and a step at 5 */
+    Float keys[]{0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+    Float values[]{0.0f, 1.0f, 2.0f, 3.0f, 2.0f, 1.0f, 5.0f};
+
+    std::size_t count = reduceKeyframesInPlace(
+        Containers::stridedArrayView(keys),
+        Containers::stridedArrayView(values),
+        Math::lerp, 0.001f);
+    CORRADE_COMPARE_AS(Containers::arrayView(keys).prefix(count),
+        Containers::arrayView({0.0f, 3.0f, 5.0f, 6.0f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(values).prefix(count),
+        Containers::arrayView({0.0f, 3.0f, 1.0f, 5.0f}),
+        TestSuite::Compare::Container);
+}
+
+void ReduceKeyframesTest::vector() {
+    /* Interleaved data, a straight line with non-uniform key spacing and a
+       single outlier */
+    struct Keyframe {
+        Float time;
+        Vector3 position;
+    } data[]{
+        {0.0f, {0.0f, 0.0f, 0.0f}},
+        {0.5f, {0.5f, 1.0f, 0.0f}},
+        {2.0f, {2.0f, 4.0f, 0.0f}},
+        {2.5f, {2.5f, 5.0f, 1.0f}},
+        {3.0f, {3.0f, 6.0f, 0.0f}},
+        {4.0f, {4.0f, 8.0f, 0.0f}},
+    };
+
+    Containers::StridedArrayView1D<Keyframe> view = data;
+    std::size_t count = reduceKeyframesInPlace(
+        view.slice(&Keyframe::time),
+        view.slice(&Keyframe::position),
+        Math::lerp, 0.001f);
+    CORRADE_COMPARE_AS(view.slice(&Keyframe::time).prefix(count),
+        Containers::arrayView({0.0f, 2.0f, 2.5f, 3.0f, 4.0f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(view.slice(&Keyframe::position).prefix(count),
+        Containers::arrayView<Vector3>({
+            {0.0f, 0.0f, 0.0f},
+            {2.0f, 4.0f, 0.0f},
+            {2.5f, 5.0f, 1.0f},
+            {3.0f, 6.0f, 0.0f},
+            {4.0f, 8.0f, 0.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void ReduceKeyframesTest::quaternion() {
+    /* Uniform rotation around a single axis, densely sampled, with the sign
+       of one keyframe flipped, which represents the same rotation */
+    Float keys[9];
+    Quaternion values[9];
+    for(std::size_t i = 0; i != 9; ++i) {
+        keys[i] = Float(i);
+        values[i] = Quaternion::rotation(Deg(Float(i)*20.0f), Vector3::yAxis());
+    }
+    values[4] = -values[4];
+
+    std::size_t count = reduceKeyframesInPlace(
+        Containers::stridedArrayView(keys),
+        Containers::stridedArrayView(values),
+        Math::slerpShortestPath, Float(Rad(0.01_degf)));
+    CORRADE_COMPARE(count, 2);
+    CORRADE_COMPARE(keys[1], 8.0f);
+    CORRADE_COMPARE(values[1], Quaternion::rotation(160.0_degf, Vector3::yAxis()));
+}
+
+void ReduceKeyframesTest::constant() {
+    /* With constant interpolation only repeated keyframes get removed */
+    Float keys[]{0.0f, 1.0f, 2.0f, 3.0f, 4.0f};
+    Int values[]{1, 1, 1, 2, 2};
+
+    std::size_t count = reduceKeyframesInPlace(
+        Containers::stridedArrayView(keys),
+        Containers::stridedArrayView(values),
+        Math::select, 0.0f);
+    CORRADE_COMPARE_AS(Containers::arrayView(keys).prefix(count),
+        Containers::arrayView({0.0f, 3.0f, 4.0f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(values).prefix(count),
+        Containers::arrayView({1, 2, 2}),
+        TestSuite::Compare::Container);
+}
+
+void ReduceKeyframesTest::maxError() {
+    /* The middle value is off by 0.1 from the lerp, so it's kept only if the
+       max error is smaller */
+    {
+        Float keys[]{0.0f, 1.0f, 2.0f};
+        Float values[]{0.0f, 1.1f, 2.0f};
+        CORRADE_COMPARE(reduceKeyframesInPlace(
+            Containers::stridedArrayView(keys),
+            Containers::stridedArrayView(values),
+            Math::lerp, 0.05f), 3);
+    } {
+        Float keys[]{0.0f, 1.0f, 2.0f};
+        Float values[]{0.0f, 1.1f, 2.0f};
+        CORRADE_COMPARE(reduceKeyframesInPlace(
+            Containers::stridedArrayView(keys),
+            Containers::stridedArrayView(values),
+            Math::lerp, 0.15f), 2);
+        CORRADE_COMPARE(keys[1], 2.0f);
+        CORRADE_COMPARE(values[1], 2.0f);
+    }
+}
+
+void ReduceKeyframesTest::tooFewKeyframes() {
+    Float keys[]{0.0f, 1.0f};
+    Float values[]{3.0f, 3.0f};
+
+    /* Even if equal, both are kept */
+    CORRADE_COMPARE(reduceKeyframesInPlace(
+        Containers::stridedArrayView(keys),
+        Containers::stridedArrayView(values),
+        Math::lerp, 1.0f), 2);
+    CORRADE_COMPARE(reduceKeyframesInPlace(
+        Containers::stridedArrayView(keys).prefix(0),
+        Containers::stridedArrayView(values).prefix(0),
+        Math::lerp, 1.0f), 0);
+}
+
+void ReduceKeyframesTest::sizeMismatch() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Float keys[3]{};
+    Float values[2]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    reduceKeyframesInPlace(
+        Containers::stridedArrayView(keys),
+        Containers::stridedArrayView(values),
+        Math::lerp, 1.0f);
+    CORRADE_COMPARE(out.str(), "Animation::reduceKeyframesInPlace(): expected key and value view to have the same size but got 3 and 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Animation::Test::ReduceKeyframesTest)
@@ -77,12 +77,19 @@ performance. You have the following options:
 @subsection Animation-Track-performance-hint Keyframe hinting
 
 The @ref Track and @ref TrackView classes are fully stateless and the
-@ref at(K) const function performs a linear search for matching keyframe from
-the beginning every time. You can use @ref at(K, std::size_t&) const to
-remember last used keyframe index and pass it in the next iteration as a hint:
+@ref at(K) const function performs a binary search for matching keyframe
+every time. You can use @ref at(K, std::size_t&) const to remember last used
+keyframe index and pass it in the next iteration as a hint, which makes the
+search constant-time if the next frame is in the same or the immediately
+following keyframe pair:
 
 @snippet Animation.cpp Track-performance-hint
 
+If multiple tracks share the same keys, @ref interpolateInto() can sample all
+of them with a single keyframe search. If the keyframes are at a fixed rate,
+@ref interpolateFixedRate() calculates the keyframe index directly from the
+time, without any search.
+
 @subsection Animation-Track-performance-strict Strict interpolation
 
 While it's possible to have different @ref Extrapolation modes for frames
@@ -349,8 +356,8 @@ template<class K, class V, class R
          * @brief Animated value at a given time
          *
          * Calls @ref interpolate(), see its documentation for more
-         * information. Note that this function performs a linear search every
-         * time, use @ref at(K, std::size_t&) const to supply a search hint.
+         * information. Note that this function performs a binary search
+         * every time, use @ref at(K, std::size_t&) const to supply a search hint.
          * @see @ref atStrict(K, std::size_t&) const,
          *      @ref at(Interpolator, K) const
          */
@@ -766,8 +773,8 @@ template<class K, class V, class R
          * @brief Animated value at a given time
          *
          * Calls @ref interpolate(), see its documentation for more
-         * information. Note that this function performs a linear search every
-         * time, use @ref at(K, std::size_t&) const to supply a search hint.
+         * information. Note that this function performs a binary search
+         * every time, use @ref at(K, std::size_t&) const to supply a search hint.
          * @see @ref atStrict(K, std::size_t&) const,
          *      @ref at(Interpolator, K) const
          */
@@ -0,0 +1,461 @@
+#ifndef Magnum_AsyncResourceLoader_h
+#define Magnum_AsyncResourceLoader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::AsyncResourceLoader
+ * @m_since_latest
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/AbstractResourceLoader.h"
+
+#if defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(__EMSCRIPTEN_PTHREADS__)
+#error this header requires Emscripten to be built with -pthread
+#endif
+
+namespace Magnum {
+
+/**
+@brief Resource loader running on a pool of worker threads
+@m_since_latest
+
+Compared to the @ref AbstractResourceLoader, which loads resources on
+whichever thread calls @ref ResourceManager::get(), this loader performs
+the I/O and decoding on worker threads and only publishes the results to the
+@ref ResourceManager on the main thread. As the manager itself isn't
+thread-safe, the workers never touch it --- instead, finished resources are
+handed over through a lock-free queue that's drained by @ref update(),
+which is meant to be called once per frame on the thread that owns the
+manager.
+
+@section AsyncResourceLoader-usage Usage
+
+The loading itself is done by a function passed to the constructor,
+together with a state pointer. It's called on a worker thread with the
+requested key and is expected to return the loaded resource or
+@cpp nullptr @ce if it wasn't found. As it can be called from several
+workers at the same time, everything it accesses through the state pointer
+has to be thread-safe.
+
+@snippet Magnum.cpp AsyncResourceLoader-usage
+
+Until @ref update() publishes them, the requested resources are in the
+@ref ResourceState::Loading state, after that they're either
+@ref ResourceState::Final or @ref ResourceState::NotFound. Because the
+loader is only a single instance per resource type, resources of different
+types need a separate loader each.
+
+@section AsyncResourceLoader-priorities Loading priorities
+
+Requests are processed in the order they were made by default. Using
+@ref setPriority() before the resource is requested, or while it's still
+waiting in the queue, will make requests with a higher priority go first,
+for example in order to load resources that are visible on screen before the
+ones that aren't.
+
+Resources requested with @ref AbstractResourceLoader::prefetch() are queued
+after all resources requested through @ref ResourceManager::get(),
+regardless of their priority, and ordered by priority among themselves. Once
+a prefetched resource that's still waiting in the queue is requested through
+@ref ResourceManager::get(), it's moved among the regular requests.
+
+@section AsyncResourceLoader-dependencies Dependencies
+
+Dependencies added with @ref AbstractResourceLoader::addDependency() are
+requested before the resource that depends on them. A worker doesn't start
+loading a resource until all its dependencies that were queued at the time it
+was requested are finished, but independent resources are still loaded in
+parallel. Because the results are published by @ref update() in the order
+they finished, a resource becomes available in the @ref ResourceManager only
+after all its dependencies. For example, all textures and materials of a
+level can be requested at once this way, with each material loaded only
+after all its textures:
+
+@snippet Magnum.cpp AsyncResourceLoader-dependencies
+
+@note This class is header-only and requires the application to link to a
+    threading library, for example `Threads::Threads` in CMake. On
+    @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" it's available only if
+    building with `-pthread`.
+*/
+template<class T> class AsyncResourceLoader: public AbstractResourceLoader<T> {
+    public:
+        /**
+         * @brief Load function
+         *
+         * Receives the requested key and the state pointer passed to the
+         * constructor. Called on a worker thread, expected to return
+         * @cpp nullptr @ce if the resource wasn't found.
+         */
+        typedef Containers::Pointer<T>(*Loader)(ResourceKey, void*);
+
+        /**
+         * @brief Constructor
+         * @param loader        Load function
+         * @param state         State pointer passed to @p loader
+         * @param threadCount   Worker thread count. If @cpp 0 @ce,
+         *      @ref std::thread::hardware_concurrency() is used.
+         *
+         * Expects that @p loader is not @cpp nullptr @ce.
+         */
+        explicit AsyncResourceLoader(Loader loader, void* state, UnsignedInt threadCount = 0);
+
+        /** @brief Copying is not allowed */
+        AsyncResourceLoader(const AsyncResourceLoader<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        AsyncResourceLoader(AsyncResourceLoader<T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Discards requests that didn't start loading yet, waits for the
+         * ones that are being loaded and joins the worker threads.
+         * Resources that were loaded but not published by @ref update() are
+         * deleted.
+         */
+        ~AsyncResourceLoader();
+
+        /** @brief Copying is not allowed */
+        AsyncResourceLoader<T>& operator=(const AsyncResourceLoader<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        AsyncResourceLoader<T>& operator=(AsyncResourceLoader<T>&&) = delete;
+
+        /** @brief Worker thread count */
+        UnsignedInt threadCount() const { return UnsignedInt(_threads.size()); }
+
+        /**
+         * @brief Set loading priority of a resource
+         *
+         * If the resource is waiting in the queue, it's moved to a position
+         * corresponding to the new priority. Otherwise the priority is
+         * remembered and used once the resource is requested. Requests with
+         * a higher priority are loaded first, requests with the same
+         * priority are loaded in the order they were made. Default priority
+         * is @cpp 0 @ce. Prefetched resources are always loaded after
+         * resources requested through @ref ResourceManager::get(), see
+         * @ref AsyncResourceLoader-priorities for more information.
+         */
+        void setPriority(ResourceKey key, Int priority);
+
+        /**
+         * @brief Count of pending resources
+         *
+         * Resources that are requested but not yet published by
+         * @ref update(), including those that are queued or being loaded.
+         */
+        std::size_t pendingCount() const { return _pendingCount; }
+
+        /**
+         * @brief Publish loaded resources to the manager
+         * @return Count of published resources
+         *
+         * Calls @ref AbstractResourceLoader::set() or
+         * @relativeref{AbstractResourceLoader,setNotFound()} for all
+         * resources that finished loading since the last call, in the order
+         * they finished. Has to be called from the thread that owns the
+         * @ref ResourceManager, doesn't block.
+         */
+        std::size_t update();
+
+        /**
+         * @brief Wait until all requested resources finish loading
+         *
+         * Blocks until the queue is empty and no resource is being loaded.
+         * The resources still have to be published with @ref update()
+         * afterwards.
+         */
+        void wait();
+
+    private:
+        struct Request {
+            ResourceKey key;
+            Int priority;
+            bool prefetch;
+            /* Copied from the base on the main thread so the workers don't
+               need to access it */
+            Containers::Array<ResourceKey> dependencies;
+        };
+
+        /* Node of the lock-free list of loaded resources */
+        struct Result {
+            ResourceKey key;
+            T* data;
+            Result* next;
+        };
+
+        void doLoad(ResourceKey key) override;
+        void doPrefetch(ResourceKey key) override;
+        void doPromote(ResourceKey key) override;
+
+        void request(ResourceKey key, bool prefetch);
+        void run();
+        /* These expect _mutex to be locked */
+        void enqueue(Request&& request);
+        bool isQueuedOrRunning(ResourceKey key) const;
+        /* Returns _queue.end() if all queued requests wait for their
+           dependencies */
+        typename std::deque<Request>::iterator nextReady();
+
+        Loader _loader;
+        void* _state;
+        std::mutex _mutex;
+        std::condition_variable _requestCondition, _doneCondition;
+        /* Regular requests first, then prefetch requests, each sorted by
+           priority, highest first */
+        std::deque<Request> _queue;
+        /* Priorities set for resources that aren't requested yet */
+        std::deque<Containers::Pair<ResourceKey, Int>> _priorities;
+        /* Keys that are being loaded by the workers */
+        Containers::Array<ResourceKey> _running;
+        bool _quit{};
+        std::atomic<std::size_t> _pendingCount{};
+        /* Pushed to by the workers, drained by update() */
+        std::atomic<Result*> _results{};
+        Containers::Array<std::thread> _threads;
+};
+
+template<class T> AsyncResourceLoader<T>::AsyncResourceLoader(const Loader loader, void* const state, UnsignedInt threadCount): _loader{loader}, _state{state} {
+    CORRADE_ASSERT(loader,
+        "AsyncResourceLoader: loader is null", );
+
+    if(!threadCount) threadCount = std::thread::hardware_concurrency();
+    /* hardware_concurrency() returns 0 if the value can't be determined */
+    if(!threadCount) threadCount = 1;
+
+    _threads = Containers::Array<std::thread>{threadCount};
+    for(std::thread& thread: _threads)
+        thread = std::thread{&AsyncResourceLoader<T>::run, this};
+}
+
+template<class T> AsyncResourceLoader<T>::~AsyncResourceLoader() {
+    {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _quit = true;
+        _queue.clear();
+    }
+    _requestCondition.notify_all();
+    for(std::thread& thread: _threads) thread.join();
+
+    /* Delete whatever wasn't published */
+    Result* result = _results.exchange(nullptr, std::memory_order_acquire);
+    while(result) {
+        Result* const next = result->next;
+        delete result->data;
+        delete result;
+        result = next;
+    }
+}
+
+template<class T> void AsyncResourceLoader<T>::doLoad(const ResourceKey key) {
+    request(key, false);
+}
+
+template<class T> void AsyncResourceLoader<T>::doPrefetch(const ResourceKey key) {
+    request(key, true);
+}
+
+template<class T> void AsyncResourceLoader<T>::request(const ResourceKey key, const bool prefetch) {
+    ++_pendingCount;
+
+    /* The base requested all dependencies already, so the ones that aren't
+       loaded yet are either in the queue or being loaded */
+    Containers::Array<ResourceKey> dependencies = this->dependencies(key);
+
+    {
+        std::unique_lock<std::mutex> lock{_mutex};
+
+        /* Pick the priority set for this resource earlier, if any */
+        Int priority = 0;
+        for(auto it = _priorities.begin(); it != _priorities.end(); ++it) {
+            if(it->first() != key) continue;
+            priority = it->second();
+            _priorities.erase(it);
+            break;
+        }
+
+        enqueue({key, priority, prefetch, std::move(dependencies)});
+    }
+    _requestCondition.notify_one();
+}
+
+template<class T> void AsyncResourceLoader<T>::doPromote(const ResourceKey key) {
+    std::unique_lock<std::mutex> lock{_mutex};
+
+    for(auto it = _queue.begin(); it != _queue.end(); ++it) {
+        if(it->key != key) continue;
+        if(!it->prefetch) return;
+
+        Request request = std::move(*it);
+        _queue.erase(it);
+        request.prefetch = false;
+        enqueue(std::move(request));
+        return;
+    }
+}
+
+template<class T> void AsyncResourceLoader<T>::enqueue(Request&& request) {
+    /* Insert after all requests with the same or higher priority to keep
+       the order stable, prefetch requests always after regular ones */
+    auto it = _queue.end();
+    while(it != _queue.begin() && ((it - 1)->prefetch > request.prefetch || ((it - 1)->prefetch == request.prefetch && (it - 1)->priority < request.priority))) --it;
+    _queue.insert(it, std::move(request));
+}
+
+template<class T> bool AsyncResourceLoader<T>::isQueuedOrRunning(const ResourceKey key) const {
+    for(const Request& request: _queue)
+        if(request.key == key) return true;
+    for(const ResourceKey running: _running)
+        if(running == key) return true;
+    return false;
+}
+
+template<class T> auto AsyncResourceLoader<T>::nextReady() -> typename std::deque<Request>::iterator {
+    for(auto it = _queue.begin(); it != _queue.end(); ++it) {
+        bool ready = true;
+        for(const ResourceKey dependency: it->dependencies) {
+            if(!isQueuedOrRunning(dependency)) continue;
+            ready = false;
+            break;
+        }
+        if(ready) return it;
+    }
+
+    return _queue.end();
+}
+
+template<class T> void AsyncResourceLoader<T>::setPriority(const ResourceKey key, const Int priority) {
+    std::unique_lock<std::mutex> lock{_mutex};
+
+    for(auto it = _queue.begin(); it != _queue.end(); ++it) {
+        if(it->key != key) continue;
+        Request request = std::move(*it);
+        _queue.erase(it);
+        request.priority = priority;
+        enqueue(std::move(request));
+        return;
+    }
+
+    for(Containers::Pair<ResourceKey, Int>& request: _priorities) if(request.first() == key) {
+        request.second() = priority;
+        return;
+    }
+
+    _priorities.emplace_back(key, priority);
+}
+
+template<class T> void AsyncResourceLoader<T>::run() {
+    for(;;) {
+        ResourceKey key;
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            typename std::deque<Request>::iterator next;
+            _requestCondition.wait(lock, [this, &next]{
+                if(_quit) return true;
+                next = nextReady();
+                return next != _queue.end();
+            });
+            if(_quit) break;
+
+            key = next->key;
+            _queue.erase(next);
+            arrayAppend(_running, key);
+        }
+
+        Result* const result = new Result{key, _loader(key, _state).release(), nullptr};
+
+        /* Push to the list of results. Release ordering so update() sees
+           the fully constructed resource. */
+        result->next = _results.load(std::memory_order_relaxed);
+        while(!_results.compare_exchange_weak(result->next, result, std::memory_order_release, std::memory_order_relaxed));
+
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            for(std::size_t i = 0; i != _running.size(); ++i) {
+                if(_running[i] != key) continue;
+                _running[i] = _running[_running.size() - 1];
+                arrayRemoveSuffix(_running);
+                break;
+            }
+
+            /* Requests waiting for this resource may be ready now */
+            if(!_queue.empty())
+                _requestCondition.notify_all();
+            else if(_running.isEmpty())
+                _doneCondition.notify_all();
+        }
+    }
+}
+
+template<class T> std::size_t AsyncResourceLoader<T>::update() {
+    Result* result = _results.exchange(nullptr, std::memory_order_acquire);
+
+    /* The list is in reverse order of completion, flip it */
+    Result* reversed = nullptr;
+    while(result) {
+        Result* const next = result->next;
+        result->next = reversed;
+        reversed = result;
+        result = next;
+    }
+
+    std::size_t count = 0;
+    while(reversed) {
+        Result* const next = reversed->next;
+        if(reversed->data)
+            this->set(reversed->key, reversed->data);
+        else
+            this->setNotFound(reversed->key);
+        delete reversed;
+        reversed = next;
+        ++count;
+    }
+
+    _pendingCount -= count;
+    return count;
+}
+
+template<class T> void AsyncResourceLoader<T>::wait() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _doneCondition.wait(lock, [this]{
+        return _queue.empty() && _running.isEmpty();
+    });
+}
+
+}
+
+#endif
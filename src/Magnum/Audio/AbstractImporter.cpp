@@ -37,6 +37,8 @@
 #include <Corrade/Utility/DebugStl.h> /** @todo remove once AbstractImporter is <string>-free */
 #include <Corrade/Utility/Path.h>
 
+#include "Magnum/Math/Functions.h"
+
 #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
 #include "Magnum/Audio/configure.h"
 #endif
@@ -141,6 +143,72 @@ Containers::Array<char> AbstractImporter::data() {
     return out;
 }
 
+UnsignedInt AbstractImporter::frameSize() const {
+    CORRADE_ASSERT(features() & ImporterFeature::Streaming,
+        "Audio::AbstractImporter::frameSize(): feature not supported", {});
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::frameSize(): no file opened", {});
+    return doFrameSize();
+}
+
+UnsignedInt AbstractImporter::doFrameSize() const {
+    CORRADE_ASSERT_UNREACHABLE("Audio::AbstractImporter::frameSize(): feature advertised but not implemented", {});
+}
+
+UnsignedLong AbstractImporter::frameCount() const {
+    CORRADE_ASSERT(features() & ImporterFeature::Streaming,
+        "Audio::AbstractImporter::frameCount(): feature not supported", {});
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::frameCount(): no file opened", {});
+    return doFrameCount();
+}
+
+UnsignedLong AbstractImporter::doFrameCount() const {
+    CORRADE_ASSERT_UNREACHABLE("Audio::AbstractImporter::frameCount(): feature advertised but not implemented", {});
+}
+
+UnsignedLong AbstractImporter::frameOffset() const {
+    CORRADE_ASSERT(features() & ImporterFeature::Streaming,
+        "Audio::AbstractImporter::frameOffset(): feature not supported", {});
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::frameOffset(): no file opened", {});
+    return doFrameOffset();
+}
+
+UnsignedLong AbstractImporter::doFrameOffset() const {
+    CORRADE_ASSERT_UNREACHABLE("Audio::AbstractImporter::frameOffset(): feature advertised but not implemented", {});
+}
+
+void AbstractImporter::seekFrame(const UnsignedLong frame) {
+    CORRADE_ASSERT(features() & ImporterFeature::Streaming,
+        "Audio::AbstractImporter::seekFrame(): feature not supported", );
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::seekFrame(): no file opened", );
+    #ifndef CORRADE_NO_ASSERT
+    const UnsignedLong count = doFrameCount();
+    #endif
+    CORRADE_ASSERT(frame <= count,
+        "Audio::AbstractImporter::seekFrame(): frame" << frame << "out of range for" << count << "frames", );
+    doSeekFrame(frame);
+}
+
+void AbstractImporter::doSeekFrame(UnsignedLong) {
+    CORRADE_ASSERT_UNREACHABLE("Audio::AbstractImporter::seekFrame(): feature advertised but not implemented", );
+}
+
+std::size_t AbstractImporter::readFrames(const Containers::ArrayView<char> out) {
+    CORRADE_ASSERT(features() & ImporterFeature::Streaming,
+        "Audio::AbstractImporter::readFrames(): feature not supported", {});
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::readFrames(): no file opened", {});
+
+    const UnsignedInt frameSize = doFrameSize();
+    const std::size_t count = Math::min(UnsignedLong(out.size()/frameSize), doFrameCount() - doFrameOffset());
+    if(!count) return 0;
+
+    doReadFrames(out.prefix(count*frameSize));
+    return count;
+}
+
+void AbstractImporter::doReadFrames(Containers::ArrayView<char>) {
+    CORRADE_ASSERT_UNREACHABLE("Audio::AbstractImporter::readFrames(): feature advertised but not implemented", );
+}
+
 Debug& operator<<(Debug& debug, const ImporterFeature value) {
     const bool packed = debug.immediateFlags() >= Debug::Flag::Packed;
 
@@ -151,6 +219,7 @@ Debug& operator<<(Debug& debug, const ImporterFeature value) {
         /* LCOV_EXCL_START */
         #define _c(v) case ImporterFeature::v: return debug << (packed ? "" : "::") << Debug::nospace << #v;
         _c(OpenData)
+        _c(Streaming)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -160,7 +229,8 @@ Debug& operator<<(Debug& debug, const ImporterFeature value) {
 
 Debug& operator<<(Debug& debug, const ImporterFeatures value) {
     return Containers::enumSetDebugOutput(debug, value, debug.immediateFlags() >= Debug::Flag::Packed ? "{}" : "Audio::ImporterFeatures{}", {
-        ImporterFeature::OpenData});
+        ImporterFeature::OpenData,
+        ImporterFeature::Streaming});
 }
 
 }}
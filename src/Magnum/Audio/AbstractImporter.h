@@ -46,7 +46,16 @@ namespace Magnum { namespace Audio {
 */
 enum class ImporterFeature: UnsignedByte {
     /** Opening files from raw data using @ref AbstractImporter::openData() */
-    OpenData = 1 << 0
+    OpenData = 1 << 0,
+
+    /**
+     * Reading sample data in chunks using
+     * @ref AbstractImporter::readFrames() and
+     * @ref AbstractImporter::seekFrame() instead of getting all of it at
+     * once through @ref AbstractImporter::data().
+     * @m_since_latest
+     */
+    Streaming = 1 << 1
 };
 
 /**
@@ -81,11 +90,26 @@ around in order to have the returned data valid. Moreover, all returned
 deleters --- this is to avoid potential dangling function pointer calls when
 destructing such instances after the plugin module has been unloaded.
 
+@section Audio-AbstractImporter-streaming Streaming
+
+Getting the whole sample data at once through @ref data() means the whole
+decoded file has to be in memory, which may be prohibitive for long tracks. If
+the importer supports @ref ImporterFeature::Streaming, the data can be
+instead read in chunks of whole frames into a caller-provided buffer using
+@ref readFrames(), with @ref seekFrame() for random access. A frame is one
+sample for each channel, its size in bytes is returned by @ref frameSize() and
+the total frame count by @ref frameCount(). Reading is independent of
+@ref data(), which always returns all samples regardless of the current
+position.
+
 @section Audio-AbstractImporter-subclassing Subclassing
 
 Plugin implements function @ref doFeatures(), @ref doIsOpened(), one of or both
 @ref doOpenData() and @ref doOpenFile() functions, function @ref doClose() and
 data access functions @ref doFormat(), @ref doFrequency() and @ref doData().
+If @ref ImporterFeature::Streaming is supported, it additionally implements
+@ref doFrameSize(), @ref doFrameCount(), @ref doFrameOffset(),
+@ref doSeekFrame() and @ref doReadFrames().
 
 You don't need to do most of the redundant sanity checks, these things are
 checked by the implementation:
@@ -97,6 +121,13 @@ checked by the implementation:
     is supported.
 -   All `do*()` implementations working on opened file are called only if
     there is any file opened.
+-   Functions @ref doFrameSize(), @ref doFrameCount(), @ref doFrameOffset(),
+    @ref doSeekFrame() and @ref doReadFrames() are called only if
+    @ref ImporterFeature::Streaming is supported.
+-   Function @ref doSeekFrame() is called only with a frame index not larger
+    than @ref frameCount().
+-   Function @ref doReadFrames() is called with a view that's non-empty and
+    has its size a multiple of @ref frameSize().
 
 @m_class{m-block m-warning}
 
@@ -201,6 +232,66 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Sample data */
         Containers::Array<char> data();
 
+        /**
+         * @brief Size of a single frame in bytes
+         * @m_since_latest
+         *
+         * Size of one sample for all channels. Available only if
+         * @ref ImporterFeature::Streaming is supported. Expects that a file
+         * is opened.
+         * @see @ref features(), @ref readFrames()
+         */
+        UnsignedInt frameSize() const;
+
+        /**
+         * @brief Frame count
+         * @m_since_latest
+         *
+         * Available only if @ref ImporterFeature::Streaming is supported.
+         * Expects that a file is opened.
+         * @see @ref features(), @ref frameOffset()
+         */
+        UnsignedLong frameCount() const;
+
+        /**
+         * @brief Current frame offset
+         * @m_since_latest
+         *
+         * Index of the frame the next @ref readFrames() call reads from.
+         * Available only if @ref ImporterFeature::Streaming is supported.
+         * Expects that a file is opened. Is @cpp 0 @ce right after opening a
+         * file.
+         * @see @ref features(), @ref seekFrame()
+         */
+        UnsignedLong frameOffset() const;
+
+        /**
+         * @brief Seek to given frame
+         * @m_since_latest
+         *
+         * Available only if @ref ImporterFeature::Streaming is supported.
+         * Expects that a file is opened and @p frame is not larger than
+         * @ref frameCount().
+         * @see @ref features(), @ref frameOffset()
+         */
+        void seekFrame(UnsignedLong frame);
+
+        /**
+         * @brief Read frames into a buffer
+         * @m_since_latest
+         *
+         * Reads as many whole frames as fit into @p out, starting at
+         * @ref frameOffset(), and advances the offset past them. Returns the
+         * number of frames read, which is less than
+         * @cpp out.size()/frameSize() @ce if the end of the data was reached
+         * and @cpp 0 @ce if the offset is already at the end. The data are in
+         * the same format as returned by @ref data(). Available only if
+         * @ref ImporterFeature::Streaming is supported. Expects that a file
+         * is opened.
+         * @see @ref features(), @ref frameSize(), @ref seekFrame()
+         */
+        std::size_t readFrames(Containers::ArrayView<char> out);
+
         /* Since 1.8.17, the original short-hand group closing doesn't work
            anymore. FFS. */
         /**
@@ -237,6 +328,41 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
 
         /** @brief Implementation for @ref data() */
         virtual Containers::Array<char> doData() = 0;
+
+        /**
+         * @brief Implementation for @ref frameSize()
+         * @m_since_latest
+         */
+        virtual UnsignedInt doFrameSize() const;
+
+        /**
+         * @brief Implementation for @ref frameCount()
+         * @m_since_latest
+         */
+        virtual UnsignedLong doFrameCount() const;
+
+        /**
+         * @brief Implementation for @ref frameOffset()
+         * @m_since_latest
+         */
+        virtual UnsignedLong doFrameOffset() const;
+
+        /**
+         * @brief Implementation for @ref seekFrame()
+         * @m_since_latest
+         */
+        virtual void doSeekFrame(UnsignedLong frame);
+
+        /**
+         * @brief Implementation for @ref readFrames()
+         * @m_since_latest
+         *
+         * The @p out view is already clamped to a multiple of
+         * @ref frameSize() and to the frames remaining until
+         * @ref frameCount(). The implementation is expected to fill all of it
+         * and advance the frame offset accordingly.
+         */
+        virtual void doReadFrames(Containers::ArrayView<char> out);
 };
 
 /**
@@ -257,7 +383,7 @@ updated interface string.
 */
 /* Silly indentation to make the string appear in pluginInterface() docs */
 #define MAGNUM_AUDIO_ABSTRACTIMPORTER_PLUGIN_INTERFACE /* [interface] */ \
-"cz.mosra.magnum.Audio.AbstractImporter/0.1"
+"cz.mosra.magnum.Audio.AbstractImporter/0.2"
 /* [interface] */
 
 }}
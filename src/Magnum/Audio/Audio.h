@@ -44,6 +44,11 @@ enum class BufferFormat: ALenum;
 class Buffer;
 class Context;
 class Source;
+class SourcePool;
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+class BufferCache;
+class SourceStream;
+#endif
 /* Renderer used only statically */
 
 template<UnsignedInt> class Playable;
@@ -0,0 +1,321 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BufferCache.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StringStl.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/BufferFormat.h"
+
+namespace Magnum { namespace Audio {
+
+namespace {
+
+struct Entry {
+    Buffer buffer;
+    std::size_t size;
+    /* Value of State::useCounter at the last get() */
+    UnsignedLong lastUse;
+};
+
+struct Decoded {
+    std::string filename;
+    BufferFormat format;
+    UnsignedInt frequency;
+    Containers::Array<char> data;
+    /* False if the import failed or if the data were already taken */
+    bool valid;
+};
+
+}
+
+struct BufferCache::State {
+    explicit State(PluginManager::Manager<AbstractImporter>& manager, const std::size_t budget, const Containers::StringView plugin): importer{manager.loadAndInstantiate(plugin)}, budget{budget}, prefetchImporter{manager.loadAndInstantiate(plugin)} {}
+
+    /* Fills out.valid based on whether the import succeeded */
+    static void decode(AbstractImporter& importer, Decoded& out);
+    void add(Decoded&& decoded);
+    void evictToBudget(const Entry* keep);
+    void work();
+
+    /* Accessed only from the main thread */
+    Containers::Pointer<AbstractImporter> importer;
+    std::unordered_map<std::string, Entry> entries;
+    std::size_t budget;
+    std::size_t memoryUsage = 0;
+    UnsignedLong useCounter = 0;
+
+    /* Accessed only from the background thread once it's started */
+    Containers::Pointer<AbstractImporter> prefetchImporter;
+
+    /* Everything below is guarded by the mutex */
+    std::mutex mutex;
+    /* Signaled when a new file is queued or when the worker should exit */
+    std::condition_variable queued;
+    /* Signaled when the worker finishes decoding a file */
+    std::condition_variable decodedSignal;
+    std::deque<std::string> pending;
+    /* File currently being decoded by the worker, if any */
+    std::string inProgress;
+    Containers::Array<Decoded> decoded;
+    bool exit = false;
+
+    /* Has to be last so it's started after everything else is constructed */
+    std::thread thread;
+};
+
+void BufferCache::State::decode(AbstractImporter& importer, Decoded& out) {
+    out.valid = importer.openFile(out.filename);
+    if(!out.valid) return;
+
+    out.format = importer.format();
+    out.frequency = importer.frequency();
+    out.data = importer.data();
+    importer.close();
+}
+
+void BufferCache::State::add(Decoded&& decoded) {
+    /* Could have been added by get() while being prefetched */
+    if(entries.find(decoded.filename) != entries.end()) return;
+
+    Entry& entry = entries[decoded.filename];
+    entry.buffer.setData(decoded.format, Containers::arrayView(decoded.data), decoded.frequency);
+    entry.size = decoded.data.size();
+    entry.lastUse = ++useCounter;
+    memoryUsage += entry.size;
+
+    evictToBudget(&entry);
+}
+
+void BufferCache::State::evictToBudget(const Entry* const keep) {
+    /* There's usually just a few dozens of entries at most and eviction
+       happens only when adding a new one, so a linear search for the least
+       recently used one is fine */
+    while(memoryUsage > budget) {
+        auto lru = entries.end();
+        for(auto it = entries.begin(); it != entries.end(); ++it) {
+            if(&it->second == keep) continue;
+            if(lru == entries.end() || it->second.lastUse < lru->second.lastUse)
+                lru = it;
+        }
+        if(lru == entries.end()) break;
+
+        memoryUsage -= lru->second.size;
+        entries.erase(lru);
+    }
+}
+
+void BufferCache::State::work() {
+    std::unique_lock<std::mutex> lock{mutex};
+    for(;;) {
+        queued.wait(lock, [this]{ return exit || !pending.empty(); });
+        if(exit) return;
+
+        Decoded out;
+        out.filename = std::move(pending.front());
+        pending.pop_front();
+        inProgress = out.filename;
+        lock.unlock();
+
+        decode(*prefetchImporter, out);
+
+        lock.lock();
+        inProgress.clear();
+        arrayAppend(decoded, std::move(out));
+        decodedSignal.notify_all();
+    }
+}
+
+BufferCache::BufferCache(PluginManager::Manager<AbstractImporter>& manager, const std::size_t budget, const Containers::StringView plugin): _state{InPlaceInit, manager, budget, plugin} {
+    /* Not starting the thread if the plugin failed to load, the manager
+       printed a message already */
+    if(_state->prefetchImporter)
+        _state->thread = std::thread{&State::work, _state.get()};
+}
+
+BufferCache::BufferCache(BufferCache&&) noexcept = default;
+
+BufferCache::~BufferCache() {
+    /* Moved out */
+    if(!_state) return;
+
+    if(_state->thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock{_state->mutex};
+            _state->exit = true;
+        }
+        _state->queued.notify_one();
+        _state->thread.join();
+    }
+}
+
+BufferCache& BufferCache::operator=(BufferCache&& other) noexcept {
+    /* Swapping so the other destructor stops the thread of the previous
+       state, if any */
+    using Utility::swap;
+    swap(_state, other._state);
+    return *this;
+}
+
+std::size_t BufferCache::budget() const {
+    return _state->budget;
+}
+
+BufferCache& BufferCache::setBudget(const std::size_t budget) {
+    _state->budget = budget;
+    _state->evictToBudget(nullptr);
+    return *this;
+}
+
+std::size_t BufferCache::memoryUsage() const {
+    return _state->memoryUsage;
+}
+
+std::size_t BufferCache::count() const {
+    return _state->entries.size();
+}
+
+bool BufferCache::contains(const std::string& filename) const {
+    return _state->entries.find(filename) != _state->entries.end();
+}
+
+Buffer* BufferCache::get(const std::string& filename) {
+    State& state = *_state;
+
+    {
+        auto found = state.entries.find(filename);
+        if(found != state.entries.end()) {
+            found->second.lastUse = ++state.useCounter;
+            return &found->second.buffer;
+        }
+    }
+
+    if(!state.importer) return nullptr;
+
+    /* If the file is queued for prefetch but not being decoded yet, take it
+       out of the queue and decode it here instead of waiting for the files
+       before it. If it's being decoded, wait for it. */
+    Decoded out;
+    out.filename = filename;
+    bool done = false;
+    {
+        std::unique_lock<std::mutex> lock{state.mutex};
+        for(auto it = state.pending.begin(); it != state.pending.end(); ++it) {
+            if(*it != filename) continue;
+            state.pending.erase(it);
+            break;
+        }
+
+        state.decodedSignal.wait(lock, [&]{ return state.inProgress != filename; });
+
+        for(Decoded& i: state.decoded) {
+            if(i.filename != filename) continue;
+            out = std::move(i);
+            /* Mark as taken so update() skips it */
+            i.valid = false;
+            done = true;
+            break;
+        }
+    }
+
+    if(!done) State::decode(*state.importer, out);
+    if(!out.valid) return nullptr;
+
+    /* The newly added entry is never evicted, even if it alone exceeds the
+       budget */
+    state.add(std::move(out));
+    return &state.entries.at(filename).buffer;
+}
+
+void BufferCache::prefetch(const std::string& filename) {
+    State& state = *_state;
+    if(!state.thread.joinable() || state.entries.find(filename) != state.entries.end())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock{state.mutex};
+        if(state.inProgress == filename) return;
+        for(const std::string& i: state.pending)
+            if(i == filename) return;
+        for(const Decoded& i: state.decoded)
+            if(i.filename == filename) return;
+
+        state.pending.push_back(filename);
+    }
+    state.queued.notify_one();
+}
+
+std::size_t BufferCache::update() {
+    State& state = *_state;
+
+    Containers::Array<Decoded> decoded;
+    {
+        std::lock_guard<std::mutex> lock{state.mutex};
+        using Utility::swap;
+        swap(decoded, state.decoded);
+    }
+
+    std::size_t count = 0;
+    for(Decoded& i: decoded) {
+        /* Import failed or taken by get() */
+        if(!i.valid) continue;
+        if(state.entries.find(i.filename) != state.entries.end()) continue;
+
+        state.add(std::move(i));
+        ++count;
+    }
+
+    return count;
+}
+
+bool BufferCache::evict(const std::string& filename) {
+    State& state = *_state;
+    auto found = state.entries.find(filename);
+    if(found == state.entries.end()) return false;
+
+    state.memoryUsage -= found->second.size;
+    state.entries.erase(found);
+    return true;
+}
+
+void BufferCache::clear() {
+    _state->entries.clear();
+    _state->memoryUsage = 0;
+}
+
+}}
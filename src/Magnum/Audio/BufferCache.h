@@ -0,0 +1,207 @@
+#ifndef Magnum_Audio_BufferCache_h
+#define Magnum_Audio_BufferCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::BufferCache
+ * @m_since_latest
+ */
+
+#include <string>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/PluginManager/PluginManager.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Audio/Audio.h"
+#include "Magnum/Audio/visibility.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+namespace Magnum { namespace Audio {
+
+/**
+@brief Cache of decoded audio buffers
+@m_since_latest
+
+Keeps @ref Buffer instances filled with data decoded from files, so playing
+the same sound again doesn't go through the importer again. The total size of
+the decoded data is kept under a memory budget by evicting least recently used
+buffers.
+
+@section Audio-BufferCache-usage Usage
+
+The cache instantiates the importer plugins from a passed plugin manager,
+@ref AnyImporter "AnyAudioImporter" by default. A buffer is retrieved
+using @ref get(), which decodes the file if it's not in the cache yet:
+
+@snippet Audio.cpp BufferCache-usage
+
+In order to avoid hitches on first play, the files can be decoded ahead of
+time on a background thread with @ref prefetch(). The decoded data are
+uploaded to buffers in @ref update(), which is expected to be called
+periodically, for example once each frame. If @ref get() is called for a file
+that's being decoded on the background thread, it waits for it to finish.
+
+All OpenAL calls are done on the thread calling the constructor, @ref get(),
+@ref update() and the destructor, only the prefetch importer is accessed from
+the background thread. Because of that, the class isn't available on
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+
+@section Audio-BufferCache-eviction Buffer eviction
+
+When a newly added buffer makes the total size exceed @ref budget(), the
+least recently retrieved buffers are deleted until the size fits again, with
+the exception of the newly added one. A pointer returned from @ref get() thus
+stays valid only until a subsequent call to @ref get(), @ref update(),
+@ref setBudget() or @ref clear(), and it's the caller responsibility to not
+have an evicted buffer attached to any @ref Source --- OpenAL doesn't allow
+deleting buffers that are in use. The budget should be set large enough to
+hold all sounds that can be played at the same time.
+@see @ref SourcePool
+*/
+class MAGNUM_AUDIO_EXPORT BufferCache {
+    public:
+        /**
+         * @brief Constructor
+         * @param manager   Plugin manager to instantiate the importers from
+         * @param budget    Memory budget in bytes
+         * @param plugin    Importer plugin name
+         *
+         * Instantiates two importer instances, one for @ref get() and one for
+         * the background thread used by @ref prefetch(), and starts the
+         * thread. If the plugin can't be instantiated, @ref get() always
+         * returns @cpp nullptr @ce and @ref prefetch() does nothing.
+         */
+        explicit BufferCache(PluginManager::Manager<AbstractImporter>& manager, std::size_t budget, Containers::StringView plugin = "AnyAudioImporter");
+
+        /** @brief Copying is not allowed */
+        BufferCache(const BufferCache&) = delete;
+
+        /** @brief Move constructor */
+        BufferCache(BufferCache&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Stops the background thread, discarding pending prefetches, and
+         * deletes all cached buffers.
+         */
+        ~BufferCache();
+
+        /** @brief Copying is not allowed */
+        BufferCache& operator=(const BufferCache&) = delete;
+
+        /** @brief Move assignment */
+        BufferCache& operator=(BufferCache&&) noexcept;
+
+        /** @brief Memory budget in bytes */
+        std::size_t budget() const;
+
+        /**
+         * @brief Set memory budget
+         * @return Reference to self (for method chaining)
+         *
+         * If the current @ref memoryUsage() exceeds @p budget, least recently
+         * used buffers are evicted right away.
+         */
+        BufferCache& setBudget(std::size_t budget);
+
+        /**
+         * @brief Memory usage in bytes
+         *
+         * Sum of decoded data sizes of all cached buffers. Data decoded by
+         * @ref prefetch() but not uploaded in @ref update() yet are not
+         * counted.
+         */
+        std::size_t memoryUsage() const;
+
+        /** @brief Count of cached buffers */
+        std::size_t count() const;
+
+        /**
+         * @brief Whether a file is cached
+         *
+         * Doesn't affect the eviction order.
+         */
+        bool contains(const std::string& filename) const;
+
+        /**
+         * @brief Get a buffer for given file
+         *
+         * If the file isn't cached yet, decodes it and evicts least recently
+         * used buffers if the budget is exceeded. If the file is being
+         * prefetched on the background thread, waits until it's done. Returns
+         * @cpp nullptr @ce if the file can't be imported. See
+         * @ref Audio-BufferCache-eviction for details about validity of the
+         * returned pointer.
+         */
+        Buffer* get(const std::string& filename);
+
+        /**
+         * @brief Decode a file in the background
+         *
+         * If the file isn't cached or queued yet, queues it for decoding on
+         * the background thread. The decoded data are uploaded in the next
+         * @ref update() after the decoding finishes.
+         */
+        void prefetch(const std::string& filename);
+
+        /**
+         * @brief Upload prefetched data
+         * @return Count of buffers that got added to the cache
+         *
+         * Creates buffers for data decoded by the background thread since
+         * the last call and evicts least recently used buffers if the budget
+         * is exceeded.
+         */
+        std::size_t update();
+
+        /**
+         * @brief Evict a file
+         * @return @cpp true @ce if the file was cached, @cpp false @ce
+         *      otherwise
+         */
+        bool evict(const std::string& filename);
+
+        /**
+         * @brief Evict all cached buffers
+         *
+         * Pending prefetches are not affected.
+         */
+        void clear();
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+#else
+#error this header is not available on Emscripten
+#endif
+
+#endif
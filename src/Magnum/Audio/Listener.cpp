@@ -61,7 +61,8 @@ template<UnsignedInt dimensions> void Listener<dimensions>::clean(const MatrixTy
     /* Only clean if this Listener is active */
     if(!isActive()) return;
 
-    Renderer::setListenerPosition(_soundTransformation.transformVector(Vector3::pad(absoluteTransformationMatrix.translation())));
+    _position = _soundTransformation.transformVector(Vector3::pad(absoluteTransformationMatrix.translation()));
+    Renderer::setListenerPosition(_position);
 
     const Vector3 fwd = _soundTransformation.transformVector(-padMatrix4(absoluteTransformationMatrix).backward());
     const Vector3 up = _soundTransformation.transformVector(padMatrix4(absoluteTransformationMatrix).up());
@@ -98,6 +99,10 @@ template<UnsignedInt dimensions> void Listener<dimensions>::update(std::initiali
 
     /* Use the more performant way to set multiple objects clean */
     SceneGraph::AbstractObject<dimensions, Float>::setClean(objects);
+
+    /* Apply source updates deferred in the above in batched groups */
+    for(PlayableGroup<dimensions>& group: groups)
+        if(group.isBatched()) group.cleanSources(_position);
 }
 
 template<UnsignedInt dimensions> Listener<dimensions>& Listener<dimensions>::setGain(const Float gain) {
@@ -118,7 +118,10 @@ template<UnsignedInt dimensions> class Listener: public SceneGraph::AbstractFeat
          * all objects of the @ref Playable "Playables" in the group to reflect
          * transformation changes to spatial audio behavior. Also updates
          * listener-related configuration for @ref Renderer (position,
-         * orientation, gain).
+         * orientation, gain). For groups with
+         * @ref PlayableGroup::setBatched() "batched updates" enabled, the
+         * pending transformation changes are then applied to sources that
+         * are audible and playing.
          */
         void update(std::initializer_list<Containers::Reference<PlayableGroup<dimensions>>> groups);
 
@@ -141,6 +144,9 @@ template<UnsignedInt dimensions> class Listener: public SceneGraph::AbstractFeat
         MAGNUM_AUDIO_LOCAL void clean(const MatrixTypeFor<dimensions, Float>& absoluteTransformationMatrix) override;
 
         Matrix4 _soundTransformation;
+        /* Position passed to OpenAL in the last clean(), used for culling in
+           PlayableGroup::cleanSources() */
+        Vector3 _position;
         Float _gain;
 };
 
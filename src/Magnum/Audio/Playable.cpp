@@ -33,7 +33,7 @@
 
 namespace Magnum { namespace Audio {
 
-template<UnsignedInt dimensions> Playable<dimensions>::Playable(SceneGraph::AbstractObject<dimensions, Float>& object, const VectorTypeFor<dimensions, Float>& direction, PlayableGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, Playable<dimensions>, Float>(object, group), _direction{direction}, _gain{1.0f} {
+template<UnsignedInt dimensions> Playable<dimensions>::Playable(SceneGraph::AbstractObject<dimensions, Float>& object, const VectorTypeFor<dimensions, Float>& direction, PlayableGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, Playable<dimensions>, Float>(object, group), _direction{direction}, _gain{1.0f}, _sourceDirty{false} {
     SceneGraph::AbstractFeature<dimensions, Float>::setCachedTransformations(SceneGraph::CachedTransformation::Absolute);
 }
 
@@ -46,16 +46,26 @@ template<UnsignedInt dimensions> Playable<dimensions>& Playable<dimensions>::set
 }
 
 template<UnsignedInt dimensions> void Playable<dimensions>::clean(const MatrixTypeFor<dimensions, Float>& absoluteTransformationMatrix) {
-    Vector3 position = Vector3::pad(absoluteTransformationMatrix.translation());
+    _position = Vector3::pad(absoluteTransformationMatrix.translation());
     if(playables())
-        position = playables()->soundTransformation().transformVector(position);
+        _position = playables()->soundTransformation().transformVector(_position);
+    _transformedDirection = Vector3::pad(absoluteTransformationMatrix.rotation()*_direction);
 
-    _source.setPosition(position);
-    _source.setDirection(Vector3::pad(absoluteTransformationMatrix.rotation()*_direction));
+    /* In batched groups the source gets updated only later in
+       Listener::update(), if it's playing and audible */
+    if(playables() && playables()->isBatched())
+        _sourceDirty = true;
+    else cleanSource();
 
     /** @todo velocity */
 }
 
+template<UnsignedInt dimensions> void Playable<dimensions>::cleanSource() {
+    _source.setPosition(_position);
+    _source.setDirection(_transformedDirection);
+    _sourceDirty = false;
+}
+
 template<UnsignedInt dimensions> PlayableGroup<dimensions>* Playable<dimensions>::playables() {
     return static_cast<PlayableGroup<dimensions>*>(this->group());
 }
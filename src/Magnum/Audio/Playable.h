@@ -71,6 +71,11 @@ you have to use other means to update them:
     @ref Playable gain and updated on every call to @ref setGain() or
     @ref PlayableGroup::setGain().
 
+If the playable is in a group with @ref PlayableGroup::setBatched() "batched updates"
+enabled, the transformation changes aren't applied to the source right away
+but only in @ref Listener::update(), and only if the source is audible and
+playing. See @ref Audio-PlayableGroup-batched for more information.
+
 @see @ref Playable2D, @ref Playable3D
 */
 template<UnsignedInt dimensions> class Playable: public SceneGraph::AbstractGroupedFeature<dimensions, Playable<dimensions>, Float> {
@@ -137,8 +142,17 @@ template<UnsignedInt dimensions> class Playable: public SceneGraph::AbstractGrou
            PlayableGroup::setGain() */
         MAGNUM_AUDIO_LOCAL void cleanGain();
 
+        /* Applies _position and _transformedDirection calculated in clean()
+           to the underlying source. Called from clean() and
+           PlayableGroup::cleanSources(). */
+        MAGNUM_AUDIO_LOCAL void cleanSource();
+
         VectorTypeFor<dimensions, Float> _direction;
         Float _gain;
+        /* Set in clean() if the source update is deferred to
+           PlayableGroup::cleanSources() */
+        bool _sourceDirty;
+        Vector3 _position, _transformedDirection;
         Source _source;
 };
 
@@ -29,6 +29,7 @@
 
 #include "Magnum/Audio/Playable.h"
 #include "Magnum/Audio/Source.h"
+#include "Magnum/Math/Constants.h"
 #include "Magnum/SceneGraph/AbstractObject.h"
 
 namespace Magnum { namespace Audio {
@@ -45,11 +46,18 @@ template<UnsignedInt dimensions> std::vector<std::reference_wrapper<Source>> sou
 
 }
 
-template<UnsignedInt dimensions> PlayableGroup<dimensions>::PlayableGroup(): SceneGraph::FeatureGroup<dimensions, Playable<dimensions>, Float>(), _gain{1.0f} {}
+template<UnsignedInt dimensions> PlayableGroup<dimensions>::PlayableGroup(): SceneGraph::FeatureGroup<dimensions, Playable<dimensions>, Float>(), _gain{1.0f}, _batched{false}, _cullDistance{Constants::inf()} {}
 
 template<UnsignedInt dimensions> PlayableGroup<dimensions>::~PlayableGroup() = default;
 
 template<UnsignedInt dimensions> PlayableGroup<dimensions>& PlayableGroup<dimensions>::play() {
+    /* Sources that weren't playing may have pending transformation updates,
+       apply them so the sources don't start at a stale position */
+    if(_batched) for(std::size_t i = 0; i != this->size(); ++i) {
+        Playable<dimensions>& playable = (*this)[i];
+        if(playable._sourceDirty) playable.cleanSource();
+    }
+
     Source::play(sources(*this));
     return *this;
 }
@@ -84,6 +92,39 @@ template<UnsignedInt dimensions> PlayableGroup<dimensions>& PlayableGroup<dimens
     return *this;
 }
 
+template<UnsignedInt dimensions> PlayableGroup<dimensions>& PlayableGroup<dimensions>::setBatched(const bool batched) {
+    /* Apply all pending changes so nothing gets lost when switching back to
+       immediate updates */
+    if(_batched && !batched) for(std::size_t i = 0; i != this->size(); ++i) {
+        Playable<dimensions>& playable = (*this)[i];
+        if(playable._sourceDirty) playable.cleanSource();
+    }
+
+    _batched = batched;
+    return *this;
+}
+
+template<UnsignedInt dimensions> PlayableGroup<dimensions>& PlayableGroup<dimensions>::setCullDistance(const Float distance) {
+    _cullDistance = distance;
+    return *this;
+}
+
+template<UnsignedInt dimensions> void PlayableGroup<dimensions>::cleanSources(const Vector3& listenerPosition) {
+    /* The checks are ordered from the cheapest, querying the source state is
+       an OpenAL call so it's done last */
+    const Float cullDistanceSquared = _cullDistance*_cullDistance;
+    for(std::size_t i = 0; i != this->size(); ++i) {
+        Playable<dimensions>& playable = (*this)[i];
+        if(!playable._sourceDirty ||
+           playable._gain*_gain == 0.0f ||
+           (playable._position - listenerPosition).dot() > cullDistanceSquared ||
+           playable._source.state() != Source::State::Playing)
+            continue;
+
+        playable.cleanSource();
+    }
+}
+
 /* On non-MinGW Windows the instantiations are already marked with extern
    template. However Clang-CL doesn't propagate the export from the extern
    template, it seems. */
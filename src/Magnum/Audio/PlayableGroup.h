@@ -45,6 +45,29 @@ namespace Magnum { namespace Audio {
 Manages a group of @ref Playable instances with an ability to control gain,
 transformation or state for all of them at once. See @ref Playable and
 @ref Listener documentation for more information.
+
+@section Audio-PlayableGroup-batched Batched updates
+
+By default, each @ref Playable updates position and direction of its
+@ref Source right when its object gets cleaned, which means two OpenAL calls
+for each moving playable every frame, even for sources that are not playing or
+are too far to be heard. With many emitters in the scene it's better to enable
+batched updates using @ref setBatched(). Transformation changes are then only
+recorded when cleaning the objects and applied in a single pass at the end of
+@ref Listener::update(), skipping playables that:
+
+-   have a zero combined gain of the playable and the group,
+-   are farther from the listener than @ref cullDistance(), or
+-   don't have their source in the @ref Source::State::Playing state.
+
+The skipped playables stay marked as changed and are updated in a later
+@ref Listener::update() once they become audible or start playing again.
+Sources started through @ref play() get updated right before being played,
+sources started directly through @ref Source::play() get their position
+updated in the next @ref Listener::update().
+
+@snippet Audio-scenegraph.cpp PlayableGroup-batched
+
 @see @ref PlayableGroup2D, @ref PlayableGroup3D
 */
 template<UnsignedInt dimensions> class PlayableGroup: public SceneGraph::FeatureGroup<dimensions, Playable<dimensions>, Float> {
@@ -57,6 +80,8 @@ template<UnsignedInt dimensions> class PlayableGroup: public SceneGraph::Feature
          * @brief Play all sound sources in this group
          * @return Reference to self (for method chaining)
          *
+         * If @ref isBatched() is enabled, pending transformation changes are
+         * applied to all sources before playing them.
          * @see @ref Source::play()
          */
         PlayableGroup<dimensions>& play();
@@ -100,11 +125,58 @@ template<UnsignedInt dimensions> class PlayableGroup: public SceneGraph::Feature
          */
         PlayableGroup& setSoundTransformation(const Matrix4& matrix);
 
+        /**
+         * @brief Whether source updates are batched
+         * @m_since_latest
+         */
+        bool isBatched() const { return _batched; }
+
+        /**
+         * @brief Set whether source updates are batched
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * If enabled, transformation changes of playables in this group are
+         * applied to their sources only in @ref Listener::update() and only
+         * if the sources are audible and playing. Disabling applies all
+         * pending changes immediately. Default is @cpp false @ce. See
+         * @ref Audio-PlayableGroup-batched for more information.
+         * @see @ref setCullDistance()
+         */
+        PlayableGroup<dimensions>& setBatched(bool batched);
+
+        /**
+         * @brief Cull distance
+         * @m_since_latest
+         */
+        Float cullDistance() const { return _cullDistance; }
+
+        /**
+         * @brief Set cull distance
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Playables farther than @p distance from the active listener, after
+         * applying @ref soundTransformation() and
+         * @ref Listener::soundTransformation(), don't get their sources
+         * updated. Used only if @ref isBatched() is enabled. Default is
+         * @ref Constants::inf(), i.e. no distance culling.
+         * @see @ref Source::setMaxDistance()
+         */
+        PlayableGroup<dimensions>& setCullDistance(Float distance);
+
     private:
         friend Playable<dimensions>;
+        friend Listener<dimensions>;
+
+        /* Applies pending transformation changes to sources of audible
+           playing playables. Called from Listener::update(). */
+        MAGNUM_AUDIO_LOCAL void cleanSources(const Vector3& listenerPosition);
 
         Matrix4 _soundTransform;
         Float _gain;
+        bool _batched;
+        Float _cullDistance;
 };
 
 /**
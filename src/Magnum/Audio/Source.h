@@ -53,8 +53,8 @@ namespace Magnum { namespace Audio {
 /**
 @brief Source
 
-Manages positional audio source.
-@todo Expose convenient API for buffer queuing
+Manages positional audio source. For streaming long tracks through a queue of
+buffers see @ref SourceStream.
 */
 class MAGNUM_AUDIO_EXPORT Source {
     public:
@@ -0,0 +1,391 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SourcePool.h"
+
+#include <cmath>
+#include <algorithm>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/Source.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Audio {
+
+namespace {
+
+constexpr UnsignedInt NoSource = ~UnsignedInt{};
+
+}
+
+struct SourcePool::State {
+    struct Voice {
+        /* Null for a free slot */
+        Buffer* buffer;
+        Vector3 position;
+        Float gain;
+        Float priority;
+        /* Buffer duration in seconds, cached to avoid OpenAL queries */
+        Float duration;
+        /* Tracked only while the voice is virtual */
+        Float offset;
+        /* Index into sources or NoSource if virtual */
+        UnsignedInt source;
+        /* Starts at 1, so handle 0 is never valid */
+        UnsignedShort generation;
+        bool looping;
+        /* Set for voices added since the last update(), their offset isn't
+           advanced by the time delta */
+        bool added;
+    };
+
+    Containers::Array<Source> sources;
+    /* Indices of sources not used by any voice */
+    Containers::Array<UnsignedInt> freeSources;
+    Containers::Array<Voice> voices;
+    /* Indices of free voice slots */
+    Containers::Array<UnsignedInt> freeVoices;
+    /* Scratch memory for update() */
+    Containers::Array<UnsignedInt> ranked;
+    Containers::Array<Float> scores;
+
+    Float referenceDistance = 1.0f;
+    Float rolloffFactor = 1.0f;
+    Float maxDistance = Constants::inf();
+    Float audibilityThreshold = 0.0f;
+
+    Voice* voice(UnsignedInt handle);
+    void releaseSource(Voice& voice);
+    void removeVoice(UnsignedInt id);
+};
+
+auto SourcePool::State::voice(const UnsignedInt handle) -> Voice* {
+    const UnsignedInt id = handle & 0xffff;
+    if(id >= voices.size()) return nullptr;
+    Voice& voice = voices[id];
+    if(!voice.buffer || voice.generation != handle >> 16) return nullptr;
+    return &voice;
+}
+
+void SourcePool::State::releaseSource(Voice& voice) {
+    Source& source = sources[voice.source];
+    source.stop();
+    source.setBuffer(nullptr);
+    arrayAppend(freeSources, voice.source);
+    voice.source = NoSource;
+}
+
+void SourcePool::State::removeVoice(const UnsignedInt id) {
+    Voice& voice = voices[id];
+    if(voice.source != NoSource) releaseSource(voice);
+    voice.buffer = nullptr;
+    /* Skip zero on wraparound so handle 0 stays invalid */
+    if(!++voice.generation) voice.generation = 1;
+    arrayAppend(freeVoices, id);
+}
+
+SourcePool::SourcePool(const UnsignedInt capacity): _state{InPlaceInit} {
+    CORRADE_ASSERT(capacity,
+        "Audio::SourcePool: expected a non-zero capacity", );
+
+    _state->sources = Containers::Array<Source>{ValueInit, capacity};
+    _state->freeSources = Containers::Array<UnsignedInt>{NoInit, capacity};
+    /* Reversed so the sources get taken from the front */
+    for(UnsignedInt i = 0; i != capacity; ++i)
+        _state->freeSources[i] = capacity - i - 1;
+}
+
+SourcePool::SourcePool(SourcePool&&) noexcept = default;
+
+SourcePool::~SourcePool() = default;
+
+SourcePool& SourcePool::operator=(SourcePool&&) noexcept = default;
+
+UnsignedInt SourcePool::capacity() const {
+    return _state->sources.size();
+}
+
+std::size_t SourcePool::voiceCount() const {
+    return _state->voices.size() - _state->freeVoices.size();
+}
+
+std::size_t SourcePool::realVoiceCount() const {
+    return _state->sources.size() - _state->freeSources.size();
+}
+
+Float SourcePool::referenceDistance() const {
+    return _state->referenceDistance;
+}
+
+SourcePool& SourcePool::setReferenceDistance(const Float distance) {
+    _state->referenceDistance = distance;
+    for(Source& source: _state->sources) source.setReferenceDistance(distance);
+    return *this;
+}
+
+Float SourcePool::rolloffFactor() const {
+    return _state->rolloffFactor;
+}
+
+SourcePool& SourcePool::setRolloffFactor(const Float factor) {
+    _state->rolloffFactor = factor;
+    for(Source& source: _state->sources) source.setRolloffFactor(factor);
+    return *this;
+}
+
+Float SourcePool::maxDistance() const {
+    return _state->maxDistance;
+}
+
+SourcePool& SourcePool::setMaxDistance(const Float distance) {
+    _state->maxDistance = distance;
+    for(Source& source: _state->sources) source.setMaxDistance(distance);
+    return *this;
+}
+
+Float SourcePool::audibilityThreshold() const {
+    return _state->audibilityThreshold;
+}
+
+SourcePool& SourcePool::setAudibilityThreshold(const Float threshold) {
+    _state->audibilityThreshold = threshold;
+    return *this;
+}
+
+UnsignedInt SourcePool::addVoice(Buffer& buffer, const Float priority) {
+    State& state = *_state;
+
+    UnsignedInt id;
+    if(!state.freeVoices.isEmpty()) {
+        id = state.freeVoices.back();
+        arrayRemoveSuffix(state.freeVoices);
+    } else {
+        CORRADE_ASSERT(state.voices.size() < 0x10000,
+            "Audio::SourcePool::addVoice(): only 65536 voices can be present at a time", {});
+        id = state.voices.size();
+        State::Voice& voice = arrayAppend(state.voices, NoInit, 1).front();
+        voice.generation = 1;
+    }
+
+    State::Voice& voice = state.voices[id];
+    voice.buffer = &buffer;
+    voice.position = {};
+    voice.gain = 1.0f;
+    voice.priority = priority;
+    const Int sampleCount = buffer.sampleCount();
+    voice.duration = sampleCount ? Float(sampleCount)/buffer.frequency() : 0.0f;
+    voice.offset = 0.0f;
+    voice.source = NoSource;
+    voice.looping = false;
+    voice.added = true;
+    return UnsignedInt(voice.generation) << 16 | id;
+}
+
+void SourcePool::removeVoice(const UnsignedInt handle) {
+    CORRADE_ASSERT(_state->voice(handle),
+        "Audio::SourcePool::removeVoice(): invalid handle" << handle, );
+    _state->removeVoice(handle & 0xffff);
+}
+
+bool SourcePool::isVoiceValid(const UnsignedInt handle) const {
+    return _state->voice(handle);
+}
+
+bool SourcePool::isVoiceReal(const UnsignedInt handle) const {
+    const State::Voice* voice = _state->voice(handle);
+    CORRADE_ASSERT(voice,
+        "Audio::SourcePool::isVoiceReal(): invalid handle" << handle, {});
+    return voice->source != NoSource;
+}
+
+Float SourcePool::voicePriority(const UnsignedInt handle) const {
+    const State::Voice* voice = _state->voice(handle);
+    CORRADE_ASSERT(voice,
+        "Audio::SourcePool::voicePriority(): invalid handle" << handle, {});
+    return voice->priority;
+}
+
+SourcePool& SourcePool::setVoicePriority(const UnsignedInt handle, const Float priority) {
+    State::Voice* voice = _state->voice(handle);
+    CORRADE_ASSERT(voice,
+        "Audio::SourcePool::setVoicePriority(): invalid handle" << handle, *this);
+    voice->priority = priority;
+    return *this;
+}
+
+Vector3 SourcePool::voicePosition(const UnsignedInt handle) const {
+    const State::Voice* voice = _state->voice(handle);
+    CORRADE_ASSERT(voice,
+        "Audio::SourcePool::voicePosition(): invalid handle" << handle, {});
+    return voice->position;
+}
+
+SourcePool& SourcePool::setVoicePosition(const UnsignedInt handle, const Vector3& position) {
+    State::Voice* voice = _state->voice(handle);
+    CORRADE_ASSERT(voice,
+        "Audio::SourcePool::setVoicePosition(): invalid handle" << handle, *this);
+    voice->position = position;
+    if(voice->source != NoSource)
+        _state->sources[voice->source].setPosition(position);
+    return *this;
+}
+
+Float SourcePool::voiceGain(const UnsignedInt handle) const {
+    const State::Voice* voice = _state->voice(handle);
+    CORRADE_ASSERT(voice,
+        "Audio::SourcePool::voiceGain(): invalid handle" << handle, {});
+    return voice->gain;
+}
+
+SourcePool& SourcePool::setVoiceGain(const UnsignedInt handle, const Float gain) {
+    State::Voice* voice = _state->voice(handle);
+    CORRADE_ASSERT(voice,
+        "Audio::SourcePool::setVoiceGain(): invalid handle" << handle, *this);
+    voice->gain = gain;
+    if(voice->source != NoSource)
+        _state->sources[voice->source].setGain(gain);
+    return *this;
+}
+
+bool SourcePool::isVoiceLooping(const UnsignedInt handle) const {
+    const State::Voice* voice = _state->voice(handle);
+    CORRADE_ASSERT(voice,
+        "Audio::SourcePool::isVoiceLooping(): invalid handle" << handle, {});
+    return voice->looping;
+}
+
+SourcePool& SourcePool::setVoiceLooping(const UnsignedInt handle, const bool looping) {
+    State::Voice* voice = _state->voice(handle);
+    CORRADE_ASSERT(voice,
+        "Audio::SourcePool::setVoiceLooping(): invalid handle" << handle, *this);
+    voice->looping = looping;
+    if(voice->source != NoSource)
+        _state->sources[voice->source].setLooping(looping);
+    return *this;
+}
+
+Float SourcePool::voiceOffset(const UnsignedInt handle) const {
+    const State::Voice* voice = _state->voice(handle);
+    CORRADE_ASSERT(voice,
+        "Audio::SourcePool::voiceOffset(): invalid handle" << handle, {});
+    return voice->source != NoSource ?
+        _state->sources[voice->source].offsetInSeconds() : voice->offset;
+}
+
+void SourcePool::update(const Vector3& listenerPosition, const Float timeDelta) {
+    State& state = *_state;
+
+    /* Remove finished voices and advance the virtual ones. Real voices
+       stopped by the user through other means than removeVoice() aren't
+       possible as the sources aren't exposed. */
+    for(UnsignedInt i = 0; i != state.voices.size(); ++i) {
+        State::Voice& voice = state.voices[i];
+        if(!voice.buffer) continue;
+
+        if(voice.source != NoSource) {
+            if(state.sources[voice.source].state() == Source::State::Stopped)
+                state.removeVoice(i);
+            continue;
+        }
+
+        if(voice.added) {
+            voice.added = false;
+            continue;
+        }
+
+        voice.offset += timeDelta;
+        if(voice.offset >= voice.duration) {
+            if(voice.looping && voice.duration > 0.0f)
+                voice.offset = std::fmod(voice.offset, voice.duration);
+            else state.removeVoice(i);
+        }
+    }
+
+    /* Rank audible voices by priority and audibility, estimated with the
+       inverse distance clamped model */
+    arrayResize(state.ranked, NoInit, 0);
+    arrayResize(state.scores, NoInit, state.voices.size());
+    for(UnsignedInt i = 0; i != state.voices.size(); ++i) {
+        State::Voice& voice = state.voices[i];
+        voice.added = false;
+        if(!voice.buffer) continue;
+
+        const Float distance = Math::clamp((voice.position - listenerPosition).length(), state.referenceDistance, state.maxDistance);
+        const Float audibility = voice.gain*state.referenceDistance/(state.referenceDistance + state.rolloffFactor*(distance - state.referenceDistance));
+        if(audibility <= state.audibilityThreshold) continue;
+
+        state.scores[i] = voice.priority*audibility;
+        arrayAppend(state.ranked, i);
+    }
+
+    /* On equal score prefer voices that are already real to avoid needless
+       source switching, then order by the slot to make the result
+       deterministic */
+    const std::size_t realCount = Math::min(state.ranked.size(), state.sources.size());
+    std::partial_sort(state.ranked.begin(), state.ranked.begin() + realCount, state.ranked.end(), [&state](UnsignedInt a, UnsignedInt b) {
+        if(state.scores[a] != state.scores[b])
+            return state.scores[a] > state.scores[b];
+        const bool realA = state.voices[a].source != NoSource;
+        const bool realB = state.voices[b].source != NoSource;
+        if(realA != realB) return realA;
+        return a < b;
+    });
+
+    /* Mark the voices that should be real, reusing the added flag as it's
+       cleared above */
+    for(std::size_t i = 0; i != realCount; ++i)
+        state.voices[state.ranked[i]].added = true;
+
+    /* Demote real voices that fell out, remembering where they were */
+    for(State::Voice& voice: state.voices) {
+        if(!voice.buffer || voice.added || voice.source == NoSource) continue;
+        voice.offset = state.sources[voice.source].offsetInSeconds();
+        state.releaseSource(voice);
+    }
+
+    /* Promote the virtual ones that got in */
+    for(std::size_t i = 0; i != realCount; ++i) {
+        State::Voice& voice = state.voices[state.ranked[i]];
+        voice.added = false;
+        if(voice.source != NoSource) continue;
+
+        voice.source = state.freeSources.back();
+        arrayRemoveSuffix(state.freeSources);
+        state.sources[voice.source]
+            .setBuffer(voice.buffer)
+            .setLooping(voice.looping)
+            .setPosition(voice.position)
+            .setGain(voice.gain)
+            .setOffsetInSeconds(voice.offset)
+            .play();
+    }
+}
+
+}}
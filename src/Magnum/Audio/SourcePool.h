@@ -0,0 +1,314 @@
+#ifndef Magnum_Audio_SourcePool_h
+#define Magnum_Audio_SourcePool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::SourcePool
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Audio/Audio.h"
+#include "Magnum/Audio/visibility.h"
+
+namespace Magnum { namespace Audio {
+
+/**
+@brief Pool of sources with voice virtualization
+@m_since_latest
+
+OpenAL implementations can mix only a limited number of sources at once and
+creating a @ref Source for each played sound means a lot of OpenAL object
+churn. This class creates a fixed amount of sources upfront and plays an
+arbitrary amount of *voices* through them. Voices that don't fit into the
+pool are tracked *virtually* --- their playback position advances without
+them being audible --- and get promoted to a real source once they become
+more important than some of the real ones.
+
+@section Audio-SourcePool-usage Usage
+
+Voices are added with @ref addVoice(), which returns a handle used to further
+configure them. In @ref update(), which is expected to be called periodically,
+for example once each frame, the voices are ranked by their priority
+multiplied by estimated audibility at given listener position, and the
+highest-ranked ones get a real source:
+
+@snippet Audio.cpp SourcePool-usage
+
+The audibility is estimated from voice gain and its distance to the listener
+using the @ref Renderer::DistanceModel::InverseClamped model, which is the
+OpenAL default. Its parameters are set with @ref setReferenceDistance(),
+@ref setRolloffFactor() and @ref setMaxDistance() and are applied to all
+pooled sources as well, so the estimate matches what's actually heard.
+Voices with the estimated audibility below @ref audibilityThreshold() are
+kept virtual even if there are free sources.
+
+Non-looping voices are removed automatically once they finish playing, after
+which their handles become invalid. Use @ref isVoiceValid() to check for that.
+
+@section Audio-SourcePool-handles Voice handles
+
+A voice handle is an opaque @relativeref{Magnum,UnsignedInt} value. Handles
+of removed voices are not reused until the slot is recycled
+@cpp 65535 @ce times, so a stale handle is reliably detected by
+@ref isVoiceValid() and by assertions in all other voice APIs. A handle with
+value @cpp 0 @ce is never valid.
+@see @ref Source, @ref PlayableGroup
+*/
+class MAGNUM_AUDIO_EXPORT SourcePool {
+    public:
+        /**
+         * @brief Constructor
+         * @param capacity  Count of real sources in the pool. Expected to be
+         *      non-zero.
+         *
+         * Creates @p capacity instances of @ref Source upfront.
+         */
+        explicit SourcePool(UnsignedInt capacity);
+
+        /** @brief Copying is not allowed */
+        SourcePool(const SourcePool&) = delete;
+
+        /** @brief Move constructor */
+        SourcePool(SourcePool&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Stops and deletes all pooled sources.
+         */
+        ~SourcePool();
+
+        /** @brief Copying is not allowed */
+        SourcePool& operator=(const SourcePool&) = delete;
+
+        /** @brief Move assignment */
+        SourcePool& operator=(SourcePool&&) noexcept;
+
+        /** @brief Count of real sources in the pool */
+        UnsignedInt capacity() const;
+
+        /** @brief Count of voices, including the virtual ones */
+        std::size_t voiceCount() const;
+
+        /** @brief Count of voices that are played through a real source */
+        std::size_t realVoiceCount() const;
+
+        /** @brief Reference distance */
+        Float referenceDistance() const;
+
+        /**
+         * @brief Set reference distance
+         * @return Reference to self (for method chaining)
+         *
+         * Applied to all pooled sources and used for estimating voice
+         * audibility. Default is @cpp 1.0f @ce.
+         * @see @ref Source::setReferenceDistance()
+         */
+        SourcePool& setReferenceDistance(Float distance);
+
+        /** @brief Rolloff factor */
+        Float rolloffFactor() const;
+
+        /**
+         * @brief Set rolloff factor
+         * @return Reference to self (for method chaining)
+         *
+         * Applied to all pooled sources and used for estimating voice
+         * audibility. Default is @cpp 1.0f @ce.
+         * @see @ref Source::setRolloffFactor()
+         */
+        SourcePool& setRolloffFactor(Float factor);
+
+        /** @brief Max distance */
+        Float maxDistance() const;
+
+        /**
+         * @brief Set max distance
+         * @return Reference to self (for method chaining)
+         *
+         * Applied to all pooled sources and used for estimating voice
+         * audibility. Default is @ref Constants::inf().
+         * @see @ref Source::setMaxDistance()
+         */
+        SourcePool& setMaxDistance(Float distance);
+
+        /** @brief Audibility threshold */
+        Float audibilityThreshold() const;
+
+        /**
+         * @brief Set audibility threshold
+         * @return Reference to self (for method chaining)
+         *
+         * Voices with gain attenuated by distance to the listener below
+         * @p threshold are kept virtual. Default is @cpp 0.0f @ce, i.e. only
+         * voices with a zero gain are kept virtual.
+         */
+        SourcePool& setAudibilityThreshold(Float threshold);
+
+        /**
+         * @brief Add a voice
+         * @param buffer    Buffer to play. Expected to stay alive and not
+         *      change its contents for the whole lifetime of the voice.
+         * @param priority  Voice priority. Voices with a higher priority are
+         *      preferred when assigning real sources.
+         * @return Voice handle
+         *
+         * The voice is positioned at origin with a gain of @cpp 1.0f @ce and
+         * isn't looping. It starts playing once it gets a real source in the
+         * next @ref update(), or is tracked virtually from that point if it
+         * doesn't get one.
+         */
+        UnsignedInt addVoice(Buffer& buffer, Float priority = 1.0f);
+
+        /**
+         * @brief Remove a voice
+         *
+         * Expects that @p handle is valid. If the voice is real, its source
+         * is stopped and returned to the pool.
+         * @see @ref isVoiceValid()
+         */
+        void removeVoice(UnsignedInt handle);
+
+        /**
+         * @brief Whether a voice handle is valid
+         *
+         * Returns @cpp false @ce for voices that were removed or that
+         * finished playing.
+         */
+        bool isVoiceValid(UnsignedInt handle) const;
+
+        /**
+         * @brief Whether a voice is played through a real source
+         *
+         * Expects that @p handle is valid.
+         */
+        bool isVoiceReal(UnsignedInt handle) const;
+
+        /**
+         * @brief Voice priority
+         *
+         * Expects that @p handle is valid.
+         */
+        Float voicePriority(UnsignedInt handle) const;
+
+        /**
+         * @brief Set voice priority
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p handle is valid. Takes effect in the next
+         * @ref update().
+         */
+        SourcePool& setVoicePriority(UnsignedInt handle, Float priority);
+
+        /**
+         * @brief Voice position
+         *
+         * Expects that @p handle is valid.
+         */
+        Vector3 voicePosition(UnsignedInt handle) const;
+
+        /**
+         * @brief Set voice position
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p handle is valid. If the voice is real, the position
+         * is applied to its source right away.
+         * @see @ref Source::setPosition()
+         */
+        SourcePool& setVoicePosition(UnsignedInt handle, const Vector3& position);
+
+        /**
+         * @brief Voice gain
+         *
+         * Expects that @p handle is valid.
+         */
+        Float voiceGain(UnsignedInt handle) const;
+
+        /**
+         * @brief Set voice gain
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p handle is valid. If the voice is real, the gain is
+         * applied to its source right away.
+         * @see @ref Source::setGain()
+         */
+        SourcePool& setVoiceGain(UnsignedInt handle, Float gain);
+
+        /**
+         * @brief Whether a voice is looping
+         *
+         * Expects that @p handle is valid.
+         */
+        bool isVoiceLooping(UnsignedInt handle) const;
+
+        /**
+         * @brief Set whether a voice is looping
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p handle is valid. If the voice is real, the looping
+         * is applied to its source right away.
+         * @see @ref Source::setLooping()
+         */
+        SourcePool& setVoiceLooping(UnsignedInt handle, bool looping);
+
+        /**
+         * @brief Voice playback offset in seconds
+         *
+         * Expects that @p handle is valid. For real voices the offset is
+         * queried from the source, for virtual voices it's the offset
+         * tracked in @ref update().
+         * @see @ref Source::offsetInSeconds()
+         */
+        Float voiceOffset(UnsignedInt handle) const;
+
+        /**
+         * @brief Update the pool
+         * @param listenerPosition  Listener position used for estimating
+         *      voice audibility
+         * @param timeDelta         Time in seconds elapsed since the
+         *      previous call
+         *
+         * Removes voices that finished playing, advances the playback offset
+         * of virtual voices by @p timeDelta, ranks the voices and moves the
+         * real sources from voices that are no longer among the
+         * @ref capacity() highest-ranked ones to the ones that are, resuming
+         * playback at the virtually tracked offset.
+         * @see @ref Renderer::listenerPosition()
+         */
+        void update(const Vector3& listenerPosition, Float timeDelta);
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
@@ -0,0 +1,261 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SourceStream.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Reference.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/Source.h"
+
+namespace Magnum { namespace Audio {
+
+struct SourceStream::State {
+    explicit State(Source& source, AbstractImporter& importer): source(source), importer(importer) {}
+
+    /* Fills given chunk with whole frames, seeking back to the start if
+       looping. Returns the byte count, which is less than the chunk size
+       only if the end of the data was reached. */
+    std::size_t decode(Containers::ArrayView<char> chunk, bool looping);
+    void work();
+
+    Source& source;
+    /* Accessed only from the background thread once it's started */
+    AbstractImporter& importer;
+    BufferFormat format;
+    UnsignedInt frequency;
+    UnsignedInt frameSize;
+    std::size_t chunkSize;
+
+    /* Accessed only from the main thread. Buffers not queued to the source
+       are listed in the prefix of idle. */
+    Containers::Array<Buffer> buffers;
+    Containers::Array<UnsignedInt> idle;
+    std::size_t idleCount = 0;
+
+    /* Everything below is guarded by the mutex */
+    mutable std::mutex mutex;
+    /* Signaled when a decoded chunk is consumed, when looping is enabled or
+       when the worker should exit */
+    std::condition_variable chunkConsumed;
+    /* A ring of decoded chunks, chunkCount of them starting at chunkBegin
+       are ready to be uploaded. The rest is owned by the worker. */
+    Containers::Array<char> chunkData;
+    Containers::Array<std::size_t> chunkSizes;
+    std::size_t chunkBegin = 0;
+    std::size_t chunkCount = 0;
+    bool looping = false;
+    /* Set if the importer reached the end of the data */
+    bool end = false;
+    bool exit = false;
+
+    /* Has to be last so it's started after everything else is constructed */
+    std::thread thread;
+};
+
+std::size_t SourceStream::State::decode(const Containers::ArrayView<char> chunk, const bool looping) {
+    std::size_t size = importer.readFrames(chunk)*frameSize;
+    while(looping && size < chunk.size()) {
+        importer.seekFrame(0);
+        const std::size_t read = importer.readFrames(chunk.exceptPrefix(size))*frameSize;
+        /* Don't spin forever if there's no data at all */
+        if(!read) break;
+        size += read;
+    }
+    return size;
+}
+
+void SourceStream::State::work() {
+    std::unique_lock<std::mutex> lock{mutex};
+    for(;;) {
+        chunkConsumed.wait(lock, [this]{
+            return exit || (!end && chunkCount < chunkSizes.size());
+        });
+        if(exit) return;
+
+        /* The next chunk after the ready ones isn't touched by the main
+           thread, so it can be decoded without holding the lock */
+        const std::size_t id = (chunkBegin + chunkCount) % chunkSizes.size();
+        const bool loop = looping;
+        lock.unlock();
+
+        const std::size_t size = decode(chunkData.sliceSize(id*chunkSize, chunkSize), loop);
+
+        lock.lock();
+        if(size) {
+            chunkSizes[id] = size;
+            ++chunkCount;
+        }
+        if(size < chunkSize) end = true;
+    }
+}
+
+SourceStream::SourceStream(Source& source, AbstractImporter& importer, const UnsignedInt bufferCount, const std::size_t bufferSize): _state{InPlaceInit, source, importer} {
+    CORRADE_ASSERT(importer.isOpened(),
+        "Audio::SourceStream: no file opened in the importer", );
+    CORRADE_ASSERT(importer.features() & ImporterFeature::Streaming,
+        "Audio::SourceStream: the importer doesn't support streaming", );
+    CORRADE_ASSERT(bufferCount >= 2,
+        "Audio::SourceStream: expected at least two buffers but got" << bufferCount, );
+
+    State& state = *_state;
+    state.format = importer.format();
+    state.frequency = importer.frequency();
+    state.frameSize = importer.frameSize();
+    state.chunkSize = bufferSize/state.frameSize*state.frameSize;
+    CORRADE_ASSERT(state.chunkSize,
+        "Audio::SourceStream: expected the buffer size to fit at least one" << state.frameSize << "byte frame but got" << bufferSize, );
+
+    state.buffers = Containers::Array<Buffer>{ValueInit, bufferCount};
+    state.idle = Containers::Array<UnsignedInt>{NoInit, bufferCount};
+    state.chunkData = Containers::Array<char>{NoInit, bufferCount*state.chunkSize};
+    state.chunkSizes = Containers::Array<std::size_t>{ValueInit, bufferCount};
+
+    /* Fill and queue all buffers upfront so the source can be played right
+       away. Using the first chunk as a scratch memory as the worker isn't
+       started yet. */
+    source.setBuffer(nullptr);
+    const Containers::ArrayView<char> scratch = state.chunkData.prefix(state.chunkSize);
+    for(UnsignedInt i = 0; i != bufferCount; ++i) {
+        const std::size_t size = state.end ? 0 : state.decode(scratch, false);
+        if(size < state.chunkSize) state.end = true;
+        if(!size) {
+            state.idle[state.idleCount++] = i;
+            continue;
+        }
+
+        Containers::Reference<Buffer> buffer = state.buffers[i];
+        buffer->setData(state.format, scratch.prefix(size), state.frequency);
+        source.queueBuffers({&buffer, 1});
+    }
+
+    state.thread = std::thread{&State::work, &state};
+}
+
+SourceStream::SourceStream(SourceStream&&) noexcept = default;
+
+SourceStream::~SourceStream() {
+    /* Moved out */
+    if(!_state) return;
+
+    /* The thread isn't running if the constructor asserted */
+    if(_state->thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock{_state->mutex};
+            _state->exit = true;
+        }
+        _state->chunkConsumed.notify_one();
+        _state->thread.join();
+    }
+
+    /* Queued buffers can't be deleted, detach them first */
+    _state->source.stop();
+    _state->source.setBuffer(nullptr);
+}
+
+SourceStream& SourceStream::operator=(SourceStream&& other) noexcept {
+    /* Swapping so the other destructor stops the thread of the previous
+       state, if any */
+    using Utility::swap;
+    swap(_state, other._state);
+    return *this;
+}
+
+Source& SourceStream::source() {
+    return _state->source;
+}
+
+bool SourceStream::isLooping() const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    return _state->looping;
+}
+
+SourceStream& SourceStream::setLooping(const bool looping) {
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        _state->looping = looping;
+        /* If the end was already reached, the worker continues from the
+           start again */
+        if(looping) _state->end = false;
+    }
+    _state->chunkConsumed.notify_one();
+    return *this;
+}
+
+bool SourceStream::isFinished() const {
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        if(!_state->end || _state->chunkCount) return false;
+    }
+
+    /* All data were queued, the source stops once it played them */
+    return _state->source.state() == Source::State::Stopped;
+}
+
+std::size_t SourceStream::update() {
+    State& state = *_state;
+
+    /* Put buffers the source finished playing back to the idle list. There's
+       just a few of them, so a linear search for the ID is fine. */
+    ALint processed;
+    alGetSourcei(state.source.id(), AL_BUFFERS_PROCESSED, &processed);
+    for(ALint i = 0; i != processed; ++i) {
+        ALuint id;
+        alSourceUnqueueBuffers(state.source.id(), 1, &id);
+        for(UnsignedInt j = 0; j != state.buffers.size(); ++j) {
+            if(state.buffers[j].id() != id) continue;
+            state.idle[state.idleCount++] = j;
+            break;
+        }
+    }
+
+    /* Fill the idle buffers with decoded chunks */
+    std::size_t queued = 0;
+    {
+        std::lock_guard<std::mutex> lock{state.mutex};
+        while(state.idleCount && state.chunkCount) {
+            Containers::Reference<Buffer> buffer = state.buffers[state.idle[--state.idleCount]];
+            buffer->setData(state.format, state.chunkData.sliceSize(state.chunkBegin*state.chunkSize, state.chunkSizes[state.chunkBegin]), state.frequency);
+            state.source.queueBuffers({&buffer, 1});
+
+            state.chunkBegin = (state.chunkBegin + 1) % state.chunkSizes.size();
+            --state.chunkCount;
+            ++queued;
+        }
+    }
+    if(queued) state.chunkConsumed.notify_one();
+
+    return queued;
+}
+
+}}
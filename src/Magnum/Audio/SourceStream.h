@@ -0,0 +1,167 @@
+#ifndef Magnum_Audio_SourceStream_h
+#define Magnum_Audio_SourceStream_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::SourceStream
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Audio/Audio.h"
+#include "Magnum/Audio/visibility.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+namespace Magnum { namespace Audio {
+
+/**
+@brief Streaming playback of a source
+@m_since_latest
+
+Plays long tracks through a @ref Source without having the whole decoded
+sample data in memory. The data are read in chunks from an
+@ref AbstractImporter supporting @ref ImporterFeature::Streaming on a
+background thread, and queued to the source in a small ring of @ref Buffer
+instances, thus the memory used is bounded by @p bufferCount times
+@p bufferSize for the decoded chunks plus the same amount for the buffers.
+
+@section Audio-SourceStream-usage Usage
+
+The constructor fills and queues all buffers, so it's possible to start
+playing the source right after. Then @ref update() is expected to be called
+periodically, for example once each frame, to recycle buffers that finished
+playing and queue new data decoded by the background thread in the meantime:
+
+@snippet Audio.cpp SourceStream-usage
+
+If @ref update() isn't called often enough, the source runs out of queued
+buffers and stops, in which case it needs to be started again with
+@ref Source::play(). The total duration the buffers can hold, and thus the
+maximum period between @ref update() calls, is
+@cpp bufferCount*bufferSize/(importer.frameSize()*importer.frequency()) @ce
+seconds. With the defaults and a 44.1 kHz stereo 16-bit track it's roughly
+1.5 seconds.
+
+The importer and the source are expected to stay alive and not be accessed
+from elsewhere for the whole lifetime of the stream. Looping has to be done
+through @ref setLooping() instead of @ref Source::setLooping(), as the source
+itself sees only the currently queued buffers.
+
+All OpenAL calls are done on the thread calling the constructor,
+@ref update() and the destructor, only the importer is accessed from the
+background thread. Because of that, the class isn't available on
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+@see @ref Source::queueBuffers()
+*/
+class MAGNUM_AUDIO_EXPORT SourceStream {
+    public:
+        /**
+         * @brief Constructor
+         * @param source        Source to play the stream with
+         * @param importer      Importer to read the data from
+         * @param bufferCount   Count of buffers to queue. Expected to be at
+         *      least @cpp 2 @ce.
+         * @param bufferSize    Size of each buffer in bytes. Gets rounded
+         *      down to a multiple of @ref AbstractImporter::frameSize(),
+         *      expected to fit at least one frame.
+         *
+         * Expects that @p importer has a file opened and supports
+         * @ref ImporterFeature::Streaming. Reads the data from the current
+         * @ref AbstractImporter::frameOffset(), fills and queues all buffers
+         * and starts the background thread. Any buffers attached to
+         * @p source are detached.
+         */
+        explicit SourceStream(Source& source, AbstractImporter& importer, UnsignedInt bufferCount = 4, std::size_t bufferSize = 65536);
+
+        /** @brief Copying is not allowed */
+        SourceStream(const SourceStream&) = delete;
+
+        /** @brief Move constructor */
+        SourceStream(SourceStream&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Stops the background thread, stops the source and detaches all
+         * buffers from it.
+         */
+        ~SourceStream();
+
+        /** @brief Copying is not allowed */
+        SourceStream& operator=(const SourceStream&) = delete;
+
+        /** @brief Move assignment */
+        SourceStream& operator=(SourceStream&&) noexcept;
+
+        /** @brief Source the stream is played with */
+        Source& source();
+
+        /** @brief Whether the stream is looping */
+        bool isLooping() const;
+
+        /**
+         * @brief Set whether the stream is looping
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, the importer seeks back to the first frame once it
+         * reaches the end of the data. Affects only data that weren't read
+         * yet. Default is @cpp false @ce.
+         */
+        SourceStream& setLooping(bool looping);
+
+        /**
+         * @brief Whether the stream is finished
+         *
+         * Returns @cpp true @ce if all data were read, queued and the source
+         * finished playing them, @cpp false @ce otherwise. Never returns
+         * @cpp true @ce if the stream is looping.
+         */
+        bool isFinished() const;
+
+        /**
+         * @brief Update the stream
+         * @return Count of buffers that got queued
+         *
+         * Unqueues buffers the source finished playing and fills and queues
+         * them again with the data decoded by the background thread, if
+         * available.
+         */
+        std::size_t update();
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+#else
+#error this header is not available on Emscripten
+#endif
+
+#endif
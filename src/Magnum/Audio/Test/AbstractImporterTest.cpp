@@ -67,6 +67,12 @@ struct AbstractImporterTest: TestSuite::Tester {
     void dataNoFile();
     void dataCustomDeleter();
 
+    void streaming();
+    void streamingNotSupported();
+    void streamingNotImplemented();
+    void streamingNoFile();
+    void seekFrameOutOfRange();
+
     void debugFeature();
     void debugFeaturePacked();
     void debugFeatures();
@@ -94,6 +100,12 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::dataNoFile,
               &AbstractImporterTest::dataCustomDeleter,
 
+              &AbstractImporterTest::streaming,
+              &AbstractImporterTest::streamingNotSupported,
+              &AbstractImporterTest::streamingNotImplemented,
+              &AbstractImporterTest::streamingNoFile,
+              &AbstractImporterTest::seekFrameOutOfRange,
+
               &AbstractImporterTest::debugFeature,
               &AbstractImporterTest::debugFeaturePacked,
               &AbstractImporterTest::debugFeatures,
@@ -386,6 +398,170 @@ void AbstractImporterTest::dataCustomDeleter() {
     CORRADE_COMPARE(out.str(), "Audio::AbstractImporter::data(): implementation is not allowed to use a custom Array deleter\n");
 }
 
+void AbstractImporterTest::streaming() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+
+        UnsignedInt doFrameSize() const override { return 2; }
+        UnsignedLong doFrameCount() const override { return 5; }
+        UnsignedLong doFrameOffset() const override { return offset; }
+        void doSeekFrame(UnsignedLong frame) override { offset = frame; }
+        void doReadFrames(Containers::ArrayView<char> out) override {
+            /* The base should clamp the view to whole frames that are left */
+            CORRADE_COMPARE(out.size() % 2, 0);
+            CORRADE_VERIFY(out.size()/2 <= 5 - offset);
+            for(char& i: out) i = char('a' + offset);
+            offset += out.size()/2;
+        }
+
+        UnsignedLong offset = 0;
+    } importer;
+
+    CORRADE_COMPARE(importer.frameSize(), 2);
+    CORRADE_COMPARE(importer.frameCount(), 5);
+    CORRADE_COMPARE(importer.frameOffset(), 0);
+
+    /* Only whole frames are read */
+    char out[7]{};
+    CORRADE_COMPARE(importer.readFrames(out), 3);
+    CORRADE_COMPARE(importer.frameOffset(), 3);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView<char>({'a', 'a', 'a', 'a', 'a', 'a', '\0'}),
+        TestSuite::Compare::Container);
+
+    /* Only frames that are left are read */
+    CORRADE_COMPARE(importer.readFrames(out), 2);
+    CORRADE_COMPARE(importer.frameOffset(), 5);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView<char>({'d', 'd', 'd', 'd', 'a', 'a', '\0'}),
+        TestSuite::Compare::Container);
+
+    /* At the end, the implementation isn't called at all */
+    CORRADE_COMPARE(importer.readFrames(out), 0);
+
+    /* A buffer smaller than a frame also doesn't call the implementation */
+    importer.seekFrame(1);
+    CORRADE_COMPARE(importer.frameOffset(), 1);
+    CORRADE_COMPARE(importer.readFrames(Containers::arrayView(out).prefix(1)), 0);
+    CORRADE_COMPARE(importer.frameOffset(), 1);
+}
+
+void AbstractImporterTest::streamingNotSupported() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    char data[1];
+    importer.frameSize();
+    importer.frameCount();
+    importer.frameOffset();
+    importer.seekFrame(0);
+    importer.readFrames(data);
+    CORRADE_COMPARE(out.str(),
+        "Audio::AbstractImporter::frameSize(): feature not supported\n"
+        "Audio::AbstractImporter::frameCount(): feature not supported\n"
+        "Audio::AbstractImporter::frameOffset(): feature not supported\n"
+        "Audio::AbstractImporter::seekFrame(): feature not supported\n"
+        "Audio::AbstractImporter::readFrames(): feature not supported\n");
+}
+
+void AbstractImporterTest::streamingNotImplemented() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.frameSize();
+    importer.frameCount();
+    importer.frameOffset();
+    CORRADE_COMPARE(out.str(),
+        "Audio::AbstractImporter::frameSize(): feature advertised but not implemented\n"
+        "Audio::AbstractImporter::frameCount(): feature advertised but not implemented\n"
+        "Audio::AbstractImporter::frameOffset(): feature advertised but not implemented\n");
+}
+
+void AbstractImporterTest::streamingNoFile() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    char data[1];
+    importer.frameSize();
+    importer.frameCount();
+    importer.frameOffset();
+    importer.seekFrame(0);
+    importer.readFrames(data);
+    CORRADE_COMPARE(out.str(),
+        "Audio::AbstractImporter::frameSize(): no file opened\n"
+        "Audio::AbstractImporter::frameCount(): no file opened\n"
+        "Audio::AbstractImporter::frameOffset(): no file opened\n"
+        "Audio::AbstractImporter::seekFrame(): no file opened\n"
+        "Audio::AbstractImporter::readFrames(): no file opened\n");
+}
+
+void AbstractImporterTest::seekFrameOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+
+        UnsignedLong doFrameCount() const override { return 5; }
+        void doSeekFrame(UnsignedLong) override {
+            CORRADE_FAIL("This shouldn't be called");
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    importer.seekFrame(6);
+    CORRADE_COMPARE(out.str(), "Audio::AbstractImporter::seekFrame(): frame 6 out of range for 5 frames\n");
+}
+
 void AbstractImporterTest::debugFeature() {
     std::ostringstream out;
 
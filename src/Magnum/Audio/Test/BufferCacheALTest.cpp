@@ -0,0 +1,327 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StringStl.h> /** @todo remove once AbstractImporter is <string>-free */
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Move.h>
+#include <Corrade/Utility/Path.h>
+#include <Corrade/Utility/System.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/BufferCache.h"
+#include "Magnum/Audio/Context.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Audio { namespace Test { namespace {
+
+struct BufferCacheALTest: TestSuite::Tester {
+    explicit BufferCacheALTest();
+
+    void construct();
+    void constructPluginNotFound();
+    void constructMove();
+
+    void get();
+    void getFailed();
+    void evictBudget();
+    void evictBudgetLargerThanBudget();
+    void setBudget();
+    void evict();
+    void clear();
+
+    void prefetch();
+    void prefetchFailed();
+    void prefetchGet();
+
+    PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+    Context _context;
+};
+
+BufferCacheALTest::BufferCacheALTest():
+    TestSuite::Tester{TestSuite::Tester::TesterConfiguration{}.setSkippedArgumentPrefixes({"magnum"})},
+    _context{arguments().first, arguments().second}
+{
+    addTests({&BufferCacheALTest::construct,
+              &BufferCacheALTest::constructPluginNotFound,
+              &BufferCacheALTest::constructMove,
+
+              &BufferCacheALTest::get,
+              &BufferCacheALTest::getFailed,
+              &BufferCacheALTest::evictBudget,
+              &BufferCacheALTest::evictBudgetLargerThanBudget,
+              &BufferCacheALTest::setBudget,
+              &BufferCacheALTest::evict,
+              &BufferCacheALTest::clear,
+
+              &BufferCacheALTest::prefetch,
+              &BufferCacheALTest::prefetchFailed,
+              &BufferCacheALTest::prefetchGet});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef WAVAUDIOIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(WAVAUDIOIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+/* The mono8.wav file has 2136 bytes of data, mono16.wav, stereo8.wav and
+   stereo16.wav have 4 bytes */
+
+void BufferCacheALTest::construct() {
+    BufferCache cache{_manager, 4096, "WavAudioImporter"};
+    CORRADE_COMPARE(cache.budget(), 4096);
+    CORRADE_COMPARE(cache.memoryUsage(), 0);
+    CORRADE_COMPARE(cache.count(), 0);
+}
+
+void BufferCacheALTest::constructPluginNotFound() {
+    std::ostringstream out;
+    {
+        Error redirectError{&out};
+        BufferCache cache{_manager, 4096, "NonexistentAudioImporter"};
+        CORRADE_VERIFY(!cache.get(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "mono8.wav")));
+
+        /* Does nothing */
+        cache.prefetch(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "mono8.wav"));
+        CORRADE_COMPARE(cache.update(), 0);
+    }
+    /* The message comes from the plugin manager */
+    CORRADE_COMPARE_AS(out.str(),
+        "NonexistentAudioImporter",
+        TestSuite::Compare::StringContains);
+}
+
+void BufferCacheALTest::constructMove() {
+    const std::string filename = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "mono8.wav");
+
+    BufferCache a{_manager, 4096, "WavAudioImporter"};
+    Buffer* buffer = a.get(filename);
+    CORRADE_VERIFY(buffer);
+
+    BufferCache b = Utility::move(a);
+    CORRADE_COMPARE(b.count(), 1);
+    CORRADE_COMPARE(b.get(filename), buffer);
+
+    BufferCache c{_manager, 1024, "WavAudioImporter"};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.count(), 1);
+    CORRADE_COMPARE(c.get(filename), buffer);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<BufferCache>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<BufferCache>::value);
+}
+
+void BufferCacheALTest::get() {
+    const std::string filename = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "mono8.wav");
+
+    BufferCache cache{_manager, 4096, "WavAudioImporter"};
+    CORRADE_VERIFY(!cache.contains(filename));
+
+    Buffer* buffer = cache.get(filename);
+    CORRADE_VERIFY(buffer);
+    CORRADE_COMPARE(buffer->size(), 2136);
+    CORRADE_COMPARE(buffer->frequency(), 22050);
+    CORRADE_VERIFY(cache.contains(filename));
+    CORRADE_COMPARE(cache.count(), 1);
+    CORRADE_COMPARE(cache.memoryUsage(), 2136);
+
+    /* Second time it's the same instance */
+    CORRADE_COMPARE(cache.get(filename), buffer);
+    CORRADE_COMPARE(cache.count(), 1);
+    CORRADE_COMPARE(cache.memoryUsage(), 2136);
+}
+
+void BufferCacheALTest::getFailed() {
+    BufferCache cache{_manager, 4096, "WavAudioImporter"};
+
+    std::ostringstream out;
+    {
+        Error redirectError{&out};
+        CORRADE_VERIFY(!cache.get(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "wrongSignature.wav")));
+    }
+    CORRADE_VERIFY(!out.str().empty());
+    CORRADE_COMPARE(cache.count(), 0);
+    CORRADE_COMPARE(cache.memoryUsage(), 0);
+}
+
+void BufferCacheALTest::evictBudget() {
+    const std::string mono16 = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "mono16.wav");
+    const std::string stereo8 = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo8.wav");
+    const std::string stereo16 = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo16.wav");
+
+    BufferCache cache{_manager, 8, "WavAudioImporter"};
+    CORRADE_VERIFY(cache.get(mono16));
+    CORRADE_VERIFY(cache.get(stereo8));
+    CORRADE_COMPARE(cache.memoryUsage(), 8);
+
+    /* Using the first one again makes the second least recently used */
+    CORRADE_VERIFY(cache.get(mono16));
+    CORRADE_VERIFY(cache.get(stereo16));
+    CORRADE_COMPARE(cache.count(), 2);
+    CORRADE_COMPARE(cache.memoryUsage(), 8);
+    CORRADE_VERIFY(cache.contains(mono16));
+    CORRADE_VERIFY(!cache.contains(stereo8));
+    CORRADE_VERIFY(cache.contains(stereo16));
+}
+
+void BufferCacheALTest::evictBudgetLargerThanBudget() {
+    const std::string mono8 = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "mono8.wav");
+    const std::string mono16 = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "mono16.wav");
+
+    BufferCache cache{_manager, 1024, "WavAudioImporter"};
+    CORRADE_VERIFY(cache.get(mono16));
+
+    /* The new buffer alone exceeds the budget, it's kept but everything
+       else is evicted */
+    CORRADE_VERIFY(cache.get(mono8));
+    CORRADE_COMPARE(cache.count(), 1);
+    CORRADE_COMPARE(cache.memoryUsage(), 2136);
+    CORRADE_VERIFY(cache.contains(mono8));
+}
+
+void BufferCacheALTest::setBudget() {
+    const std::string mono16 = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "mono16.wav");
+    const std::string stereo8 = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo8.wav");
+
+    BufferCache cache{_manager, 1024, "WavAudioImporter"};
+    CORRADE_VERIFY(cache.get(mono16));
+    CORRADE_VERIFY(cache.get(stereo8));
+    CORRADE_COMPARE(cache.memoryUsage(), 8);
+
+    /* The least recently used one gets evicted right away */
+    cache.setBudget(4);
+    CORRADE_COMPARE(cache.budget(), 4);
+    CORRADE_COMPARE(cache.count(), 1);
+    CORRADE_COMPARE(cache.memoryUsage(), 4);
+    CORRADE_VERIFY(cache.contains(stereo8));
+}
+
+void BufferCacheALTest::evict() {
+    const std::string mono16 = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "mono16.wav");
+    const std::string stereo8 = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo8.wav");
+
+    BufferCache cache{_manager, 1024, "WavAudioImporter"};
+    CORRADE_VERIFY(cache.get(mono16));
+    CORRADE_VERIFY(cache.get(stereo8));
+
+    CORRADE_VERIFY(cache.evict(mono16));
+    CORRADE_VERIFY(!cache.evict(mono16));
+    CORRADE_COMPARE(cache.count(), 1);
+    CORRADE_COMPARE(cache.memoryUsage(), 4);
+    CORRADE_VERIFY(!cache.contains(mono16));
+    CORRADE_VERIFY(cache.contains(stereo8));
+}
+
+void BufferCacheALTest::clear() {
+    BufferCache cache{_manager, 1024, "WavAudioImporter"};
+    CORRADE_VERIFY(cache.get(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "mono16.wav")));
+    CORRADE_VERIFY(cache.get(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo8.wav")));
+
+    cache.clear();
+    CORRADE_COMPARE(cache.count(), 0);
+    CORRADE_COMPARE(cache.memoryUsage(), 0);
+}
+
+/* Calls update() until something gets added or it times out */
+std::size_t updateUntilAdded(BufferCache& cache) {
+    for(std::size_t i = 0; i != 1000; ++i) {
+        if(const std::size_t count = cache.update()) return count;
+        Utility::System::sleep(1);
+    }
+    return 0;
+}
+
+void BufferCacheALTest::prefetch() {
+    const std::string filename = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "mono8.wav");
+
+    BufferCache cache{_manager, 4096, "WavAudioImporter"};
+    cache.prefetch(filename);
+    /* Prefetching again is a no-op */
+    cache.prefetch(filename);
+    CORRADE_COMPARE(updateUntilAdded(cache), 1);
+    CORRADE_VERIFY(cache.contains(filename));
+    CORRADE_COMPARE(cache.memoryUsage(), 2136);
+
+    /* Nothing else got added */
+    CORRADE_COMPARE(cache.update(), 0);
+    CORRADE_COMPARE(cache.count(), 1);
+
+    /* Prefetching a cached file is a no-op too */
+    cache.prefetch(filename);
+    Utility::System::sleep(10);
+    CORRADE_COMPARE(cache.update(), 0);
+
+    Buffer* buffer = cache.get(filename);
+    CORRADE_VERIFY(buffer);
+    CORRADE_COMPARE(buffer->size(), 2136);
+}
+
+void BufferCacheALTest::prefetchFailed() {
+    BufferCache cache{_manager, 4096, "WavAudioImporter"};
+
+    std::ostringstream out;
+    {
+        Error redirectError{&out};
+        cache.prefetch(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "wrongSignature.wav"));
+        /* Give it some time to fail */
+        Utility::System::sleep(100);
+        CORRADE_COMPARE(cache.update(), 0);
+    }
+    CORRADE_COMPARE(cache.count(), 0);
+}
+
+void BufferCacheALTest::prefetchGet() {
+    const std::string mono8 = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "mono8.wav");
+    const std::string mono16 = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "mono16.wav");
+
+    BufferCache cache{_manager, 4096, "WavAudioImporter"};
+    cache.prefetch(mono8);
+    cache.prefetch(mono16);
+
+    /* Getting a prefetched file either takes it from the queue, waits for it
+       or takes the decoded data, in any case it's available right away */
+    Buffer* buffer = cache.get(mono16);
+    CORRADE_VERIFY(buffer);
+    CORRADE_COMPARE(buffer->size(), 4);
+    CORRADE_COMPARE(cache.count(), 1);
+
+    /* The other one gets added in update(), the one already taken by get()
+       not again */
+    CORRADE_COMPARE(updateUntilAdded(cache), 1);
+    CORRADE_COMPARE(cache.count(), 2);
+    CORRADE_COMPARE(cache.memoryUsage(), 2140);
+    CORRADE_COMPARE(cache.get(mono16), buffer);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::BufferCacheALTest)
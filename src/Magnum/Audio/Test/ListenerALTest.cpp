@@ -28,6 +28,8 @@
 #include <Corrade/Containers/Reference.h>
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/BufferFormat.h"
 #include "Magnum/Audio/Context.h"
 #include "Magnum/Audio/Listener.h"
 #include "Magnum/Audio/Playable.h"
@@ -52,6 +54,7 @@ struct ListenerALTest: TestSuite::Tester {
     void feature2D();
     void feature3D();
     void updateGroups();
+    void updateGroupsBatched();
 
     Context _context;
 };
@@ -62,7 +65,8 @@ ListenerALTest::ListenerALTest():
 {
     addTests({&ListenerALTest::feature2D,
               &ListenerALTest::feature3D,
-              &ListenerALTest::updateGroups});
+              &ListenerALTest::updateGroups,
+              &ListenerALTest::updateGroupsBatched});
 }
 
 void ListenerALTest::feature2D() {
@@ -111,6 +115,64 @@ void ListenerALTest::updateGroups() {
     CORRADE_COMPARE(playable.source().position(), offset*13.0f);
 }
 
+void ListenerALTest::updateGroupsBatched() {
+    Scene3D scene;
+    Object3D sourceObject{&scene};
+    Object3D object{&scene};
+    PlayableGroup3D group;
+    group.setBatched(true)
+        .setCullDistance(10.0f);
+    CORRADE_VERIFY(group.isBatched());
+    CORRADE_COMPARE(group.cullDistance(), 10.0f);
+    Playable3D playable{sourceObject, &group};
+    Listener3D listener{object};
+
+    /* A looping source so it stays playing */
+    constexpr char data[]{0, 64, 127, 64, 0, -64, -127, -64};
+    Buffer buffer;
+    buffer.setData(BufferFormat::Mono8, data, 22050);
+    playable.source()
+        .setBuffer(&buffer)
+        .setLooping(true);
+
+    /* The source isn't playing, so the position isn't updated */
+    sourceObject.translate({1.0f, 2.0f, 3.0f});
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().position(), Vector3{});
+
+    /* Playing through the group applies the pending update first */
+    group.play();
+    CORRADE_COMPARE(playable.source().position(), (Vector3{1.0f, 2.0f, 3.0f}));
+
+    /* Playing and in range, updated */
+    sourceObject.translate({1.0f, 0.0f, 0.0f});
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().position(), (Vector3{2.0f, 2.0f, 3.0f}));
+
+    /* Out of range, not updated */
+    sourceObject.translate({20.0f, 0.0f, 0.0f});
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().position(), (Vector3{2.0f, 2.0f, 3.0f}));
+
+    /* Listener moved closer, the pending update gets applied even though
+       the playable itself didn't change */
+    object.translate({15.0f, 0.0f, 0.0f});
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().position(), (Vector3{22.0f, 2.0f, 3.0f}));
+
+    /* Zero gain, not updated */
+    playable.setGain(0.0f);
+    sourceObject.translate({1.0f, 0.0f, 0.0f});
+    listener.update({group});
+    CORRADE_COMPARE(playable.source().position(), (Vector3{22.0f, 2.0f, 3.0f}));
+
+    /* Disabling batching applies pending updates right away */
+    group.setBatched(false);
+    CORRADE_COMPARE(playable.source().position(), (Vector3{23.0f, 2.0f, 3.0f}));
+
+    group.stop();
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::ListenerALTest)
@@ -0,0 +1,380 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/BufferFormat.h"
+#include "Magnum/Audio/Context.h"
+#include "Magnum/Audio/SourcePool.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Audio { namespace Test { namespace {
+
+struct SourcePoolALTest: TestSuite::Tester {
+    explicit SourcePoolALTest();
+
+    void construct();
+    void constructZeroCapacity();
+    void constructMove();
+
+    void distanceAttenuation();
+
+    void addRemoveVoice();
+    void voiceProperties();
+    void invalidHandle();
+
+    void updatePromote();
+    void updatePriority();
+    void updateDistance();
+    void updateThreshold();
+    void updateVirtualOffset();
+    void updateVirtualFinished();
+    void updateVirtualLooping();
+
+    Context _context;
+    Buffer _buffer;
+};
+
+SourcePoolALTest::SourcePoolALTest():
+    TestSuite::Tester{TestSuite::Tester::TesterConfiguration{}.setSkippedArgumentPrefixes({"magnum"})},
+    _context{arguments().first, arguments().second}
+{
+    addTests({&SourcePoolALTest::construct,
+              &SourcePoolALTest::constructZeroCapacity,
+              &SourcePoolALTest::constructMove,
+
+              &SourcePoolALTest::distanceAttenuation,
+
+              &SourcePoolALTest::addRemoveVoice,
+              &SourcePoolALTest::voiceProperties,
+              &SourcePoolALTest::invalidHandle,
+
+              &SourcePoolALTest::updatePromote,
+              &SourcePoolALTest::updatePriority,
+              &SourcePoolALTest::updateDistance,
+              &SourcePoolALTest::updateThreshold,
+              &SourcePoolALTest::updateVirtualOffset,
+              &SourcePoolALTest::updateVirtualFinished,
+              &SourcePoolALTest::updateVirtualLooping});
+
+    /* One second of silence */
+    char data[22050];
+    for(char& i: data) i = '\x80';
+    _buffer.setData(BufferFormat::Mono8, data, 22050);
+}
+
+void SourcePoolALTest::construct() {
+    SourcePool pool{3};
+    CORRADE_COMPARE(pool.capacity(), 3);
+    CORRADE_COMPARE(pool.voiceCount(), 0);
+    CORRADE_COMPARE(pool.realVoiceCount(), 0);
+    CORRADE_COMPARE(pool.referenceDistance(), 1.0f);
+    CORRADE_COMPARE(pool.rolloffFactor(), 1.0f);
+    CORRADE_COMPARE(pool.maxDistance(), Constants::inf());
+    CORRADE_COMPARE(pool.audibilityThreshold(), 0.0f);
+}
+
+void SourcePoolALTest::constructZeroCapacity() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    SourcePool{0};
+    CORRADE_COMPARE(out.str(), "Audio::SourcePool: expected a non-zero capacity\n");
+}
+
+void SourcePoolALTest::constructMove() {
+    SourcePool a{2};
+    UnsignedInt voice = a.addVoice(_buffer);
+
+    SourcePool b = Utility::move(a);
+    CORRADE_COMPARE(b.capacity(), 2);
+    CORRADE_VERIFY(b.isVoiceValid(voice));
+
+    SourcePool c{5};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.capacity(), 2);
+    CORRADE_VERIFY(c.isVoiceValid(voice));
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<SourcePool>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<SourcePool>::value);
+}
+
+void SourcePoolALTest::distanceAttenuation() {
+    SourcePool pool{2};
+    pool.setReferenceDistance(2.0f)
+        .setRolloffFactor(0.5f)
+        .setMaxDistance(100.0f)
+        .setAudibilityThreshold(0.25f);
+    CORRADE_COMPARE(pool.referenceDistance(), 2.0f);
+    CORRADE_COMPARE(pool.rolloffFactor(), 0.5f);
+    CORRADE_COMPARE(pool.maxDistance(), 100.0f);
+    CORRADE_COMPARE(pool.audibilityThreshold(), 0.25f);
+}
+
+void SourcePoolALTest::addRemoveVoice() {
+    SourcePool pool{2};
+
+    UnsignedInt a = pool.addVoice(_buffer);
+    UnsignedInt b = pool.addVoice(_buffer, 2.0f);
+    CORRADE_VERIFY(a != 0);
+    CORRADE_VERIFY(b != 0);
+    CORRADE_VERIFY(a != b);
+    CORRADE_COMPARE(pool.voiceCount(), 2);
+    CORRADE_VERIFY(pool.isVoiceValid(a));
+    CORRADE_VERIFY(pool.isVoiceValid(b));
+    CORRADE_VERIFY(!pool.isVoiceValid(0));
+    CORRADE_VERIFY(!pool.isVoiceReal(a));
+    CORRADE_COMPARE(pool.voicePriority(b), 2.0f);
+
+    pool.removeVoice(a);
+    CORRADE_COMPARE(pool.voiceCount(), 1);
+    CORRADE_VERIFY(!pool.isVoiceValid(a));
+    CORRADE_VERIFY(pool.isVoiceValid(b));
+
+    /* The slot is recycled, but the handle is different */
+    UnsignedInt c = pool.addVoice(_buffer);
+    CORRADE_COMPARE(pool.voiceCount(), 2);
+    CORRADE_VERIFY(c != a);
+    CORRADE_VERIFY(!pool.isVoiceValid(a));
+    CORRADE_VERIFY(pool.isVoiceValid(c));
+
+    /* Removing a real voice gives the source back */
+    pool.update({}, 0.0f);
+    CORRADE_COMPARE(pool.realVoiceCount(), 2);
+    pool.removeVoice(b);
+    CORRADE_COMPARE(pool.realVoiceCount(), 1);
+    CORRADE_COMPARE(pool.voiceCount(), 1);
+}
+
+void SourcePoolALTest::voiceProperties() {
+    SourcePool pool{1};
+    UnsignedInt voice = pool.addVoice(_buffer);
+    CORRADE_COMPARE(pool.voicePosition(voice), Vector3{});
+    CORRADE_COMPARE(pool.voiceGain(voice), 1.0f);
+    CORRADE_VERIFY(!pool.isVoiceLooping(voice));
+    CORRADE_COMPARE(pool.voiceOffset(voice), 0.0f);
+
+    pool.setVoicePosition(voice, {1.0f, 2.0f, 3.0f})
+        .setVoiceGain(voice, 0.5f)
+        .setVoiceLooping(voice, true)
+        .setVoicePriority(voice, 3.0f);
+    CORRADE_COMPARE(pool.voicePosition(voice), (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(pool.voiceGain(voice), 0.5f);
+    CORRADE_VERIFY(pool.isVoiceLooping(voice));
+    CORRADE_COMPARE(pool.voicePriority(voice), 3.0f);
+
+    /* Changing properties of a real voice works too */
+    pool.update({}, 0.0f);
+    CORRADE_VERIFY(pool.isVoiceReal(voice));
+    pool.setVoicePosition(voice, {3.0f, 2.0f, 1.0f})
+        .setVoiceGain(voice, 0.25f)
+        .setVoiceLooping(voice, false);
+    CORRADE_COMPARE(pool.voicePosition(voice), (Vector3{3.0f, 2.0f, 1.0f}));
+    CORRADE_COMPARE(pool.voiceGain(voice), 0.25f);
+    CORRADE_VERIFY(!pool.isVoiceLooping(voice));
+}
+
+void SourcePoolALTest::invalidHandle() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    SourcePool pool{1};
+    UnsignedInt voice = pool.addVoice(_buffer);
+    pool.removeVoice(voice);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    pool.removeVoice(voice);
+    pool.isVoiceReal(voice);
+    pool.voicePriority(0);
+    pool.setVoicePriority(voice, 1.0f);
+    pool.voicePosition(voice);
+    pool.setVoicePosition(voice, {});
+    pool.voiceGain(voice);
+    pool.setVoiceGain(voice, 1.0f);
+    pool.isVoiceLooping(voice);
+    pool.setVoiceLooping(voice, true);
+    pool.voiceOffset(voice);
+    CORRADE_COMPARE(out.str(),
+        "Audio::SourcePool::removeVoice(): invalid handle 65536\n"
+        "Audio::SourcePool::isVoiceReal(): invalid handle 65536\n"
+        "Audio::SourcePool::voicePriority(): invalid handle 0\n"
+        "Audio::SourcePool::setVoicePriority(): invalid handle 65536\n"
+        "Audio::SourcePool::voicePosition(): invalid handle 65536\n"
+        "Audio::SourcePool::setVoicePosition(): invalid handle 65536\n"
+        "Audio::SourcePool::voiceGain(): invalid handle 65536\n"
+        "Audio::SourcePool::setVoiceGain(): invalid handle 65536\n"
+        "Audio::SourcePool::isVoiceLooping(): invalid handle 65536\n"
+        "Audio::SourcePool::setVoiceLooping(): invalid handle 65536\n"
+        "Audio::SourcePool::voiceOffset(): invalid handle 65536\n");
+}
+
+void SourcePoolALTest::updatePromote() {
+    SourcePool pool{2};
+    UnsignedInt a = pool.addVoice(_buffer);
+    UnsignedInt b = pool.addVoice(_buffer);
+    UnsignedInt c = pool.addVoice(_buffer);
+
+    pool.update({}, 0.0f);
+    CORRADE_COMPARE(pool.voiceCount(), 3);
+    CORRADE_COMPARE(pool.realVoiceCount(), 2);
+    /* With everything equal, the first voices win */
+    CORRADE_VERIFY(pool.isVoiceReal(a));
+    CORRADE_VERIFY(pool.isVoiceReal(b));
+    CORRADE_VERIFY(!pool.isVoiceReal(c));
+
+    /* Once a real voice is removed, the virtual one takes its source */
+    pool.removeVoice(a);
+    pool.update({}, 0.0f);
+    CORRADE_COMPARE(pool.realVoiceCount(), 2);
+    CORRADE_VERIFY(pool.isVoiceReal(b));
+    CORRADE_VERIFY(pool.isVoiceReal(c));
+}
+
+void SourcePoolALTest::updatePriority() {
+    SourcePool pool{1};
+    UnsignedInt a = pool.addVoice(_buffer, 1.0f);
+    UnsignedInt b = pool.addVoice(_buffer, 2.0f);
+
+    pool.update({}, 0.0f);
+    CORRADE_VERIFY(!pool.isVoiceReal(a));
+    CORRADE_VERIFY(pool.isVoiceReal(b));
+
+    /* Raising the priority moves the source to the other voice */
+    pool.setVoicePriority(a, 3.0f);
+    pool.update({}, 0.0f);
+    CORRADE_VERIFY(pool.isVoiceReal(a));
+    CORRADE_VERIFY(!pool.isVoiceReal(b));
+}
+
+void SourcePoolALTest::updateDistance() {
+    SourcePool pool{1};
+    UnsignedInt a = pool.addVoice(_buffer);
+    UnsignedInt b = pool.addVoice(_buffer);
+    pool.setVoicePosition(a, {10.0f, 0.0f, 0.0f})
+        .setVoicePosition(b, {0.0f, 0.0f, 5.0f});
+
+    /* The closer voice wins */
+    pool.update({}, 0.0f);
+    CORRADE_VERIFY(!pool.isVoiceReal(a));
+    CORRADE_VERIFY(pool.isVoiceReal(b));
+
+    /* Listener moved, the other voice is closer now */
+    pool.update({9.0f, 0.0f, 0.0f}, 0.0f);
+    CORRADE_VERIFY(pool.isVoiceReal(a));
+    CORRADE_VERIFY(!pool.isVoiceReal(b));
+
+    /* A louder voice wins even if farther */
+    pool.setVoiceGain(b, 100.0f);
+    pool.update({9.0f, 0.0f, 0.0f}, 0.0f);
+    CORRADE_VERIFY(!pool.isVoiceReal(a));
+    CORRADE_VERIFY(pool.isVoiceReal(b));
+}
+
+void SourcePoolALTest::updateThreshold() {
+    SourcePool pool{2};
+    pool.setAudibilityThreshold(0.1f);
+    UnsignedInt a = pool.addVoice(_buffer);
+    UnsignedInt b = pool.addVoice(_buffer);
+    UnsignedInt c = pool.addVoice(_buffer);
+    /* Attenuated to 1/20 */
+    pool.setVoicePosition(a, {20.0f, 0.0f, 0.0f})
+        .setVoiceGain(b, 0.0f);
+
+    /* Only one voice is audible enough, the other source stays free */
+    pool.update({}, 0.0f);
+    CORRADE_COMPARE(pool.realVoiceCount(), 1);
+    CORRADE_VERIFY(!pool.isVoiceReal(a));
+    CORRADE_VERIFY(!pool.isVoiceReal(b));
+    CORRADE_VERIFY(pool.isVoiceReal(c));
+
+    /* Getting inaudible demotes a real voice */
+    pool.setVoiceGain(c, 0.05f);
+    pool.update({}, 0.0f);
+    CORRADE_COMPARE(pool.realVoiceCount(), 0);
+    CORRADE_COMPARE(pool.voiceCount(), 3);
+}
+
+void SourcePoolALTest::updateVirtualOffset() {
+    SourcePool pool{1};
+    UnsignedInt a = pool.addVoice(_buffer, 2.0f);
+    UnsignedInt b = pool.addVoice(_buffer, 1.0f);
+
+    /* The offset of a freshly added voice isn't advanced in the first
+       update */
+    pool.update({}, 0.25f);
+    CORRADE_VERIFY(!pool.isVoiceReal(b));
+    CORRADE_COMPARE(pool.voiceOffset(b), 0.0f);
+
+    pool.update({}, 0.25f);
+    pool.update({}, 0.25f);
+    CORRADE_VERIFY(!pool.isVoiceReal(b));
+    CORRADE_COMPARE(pool.voiceOffset(b), 0.5f);
+
+    /* Once promoted, it continues from the tracked offset */
+    pool.removeVoice(a);
+    pool.update({}, 0.125f);
+    CORRADE_VERIFY(pool.isVoiceReal(b));
+    CORRADE_COMPARE_WITH(pool.voiceOffset(b), 0.625f,
+        TestSuite::Compare::around(0.05f));
+}
+
+void SourcePoolALTest::updateVirtualFinished() {
+    SourcePool pool{1};
+    pool.addVoice(_buffer, 2.0f);
+    UnsignedInt b = pool.addVoice(_buffer, 1.0f);
+
+    pool.update({}, 0.0f);
+    pool.update({}, 0.5f);
+    CORRADE_VERIFY(pool.isVoiceValid(b));
+
+    /* The one-second buffer ends, the voice gets removed */
+    pool.update({}, 0.5f);
+    CORRADE_VERIFY(!pool.isVoiceValid(b));
+    CORRADE_COMPARE(pool.voiceCount(), 1);
+}
+
+void SourcePoolALTest::updateVirtualLooping() {
+    SourcePool pool{1};
+    pool.addVoice(_buffer, 2.0f);
+    UnsignedInt b = pool.addVoice(_buffer, 1.0f);
+    pool.setVoiceLooping(b, true);
+
+    pool.update({}, 0.0f);
+    pool.update({}, 0.75f);
+    pool.update({}, 0.5f);
+    CORRADE_VERIFY(pool.isVoiceValid(b));
+    CORRADE_COMPARE(pool.voiceOffset(b), 0.25f);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::SourcePoolALTest)
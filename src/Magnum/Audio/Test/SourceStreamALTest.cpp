@@ -0,0 +1,293 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+#include "Magnum/Audio/BufferFormat.h"
+#include "Magnum/Audio/Context.h"
+#include "Magnum/Audio/Source.h"
+#include "Magnum/Audio/SourceStream.h"
+
+namespace Magnum { namespace Audio { namespace Test { namespace {
+
+struct SourceStreamALTest: TestSuite::Tester {
+    explicit SourceStreamALTest();
+
+    void construct();
+    void constructShortData();
+    void constructNotOpened();
+    void constructNotStreaming();
+    void constructInvalidBufferCount();
+    void constructInvalidBufferSize();
+    void constructMove();
+
+    void play();
+    void looping();
+
+    void destructDetachesBuffers();
+
+    Context _context;
+};
+
+SourceStreamALTest::SourceStreamALTest():
+    TestSuite::Tester{TestSuite::Tester::TesterConfiguration{}.setSkippedArgumentPrefixes({"magnum"})},
+    _context{arguments().first, arguments().second}
+{
+    addTests({&SourceStreamALTest::construct,
+              &SourceStreamALTest::constructShortData,
+              &SourceStreamALTest::constructNotOpened,
+              &SourceStreamALTest::constructNotStreaming,
+              &SourceStreamALTest::constructInvalidBufferCount,
+              &SourceStreamALTest::constructInvalidBufferSize,
+              &SourceStreamALTest::constructMove,
+
+              &SourceStreamALTest::play,
+              &SourceStreamALTest::looping,
+
+              &SourceStreamALTest::destructDetachesBuffers});
+}
+
+/* Generates a mono 16-bit sawtooth of given length */
+struct StreamingImporter: AbstractImporter {
+    explicit StreamingImporter(UnsignedLong frameCount): _frameCount{frameCount} {}
+
+    ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+    bool doIsOpened() const override { return true; }
+    void doClose() override {}
+
+    BufferFormat doFormat() const override { return BufferFormat::Mono16; }
+    UnsignedInt doFrequency() const override { return 22050; }
+    Containers::Array<char> doData() override { return nullptr; }
+
+    UnsignedInt doFrameSize() const override { return 2; }
+    UnsignedLong doFrameCount() const override { return _frameCount; }
+    UnsignedLong doFrameOffset() const override { return _offset; }
+    void doSeekFrame(UnsignedLong frame) override { _offset = frame; }
+    void doReadFrames(Containers::ArrayView<char> out) override {
+        const Containers::ArrayView<Short> frames = Containers::arrayCast<Short>(out);
+        for(Short& i: frames) i = Short((_offset++ % 100)*300 - 15000);
+    }
+
+    UnsignedLong _frameCount, _offset = 0;
+};
+
+Int queuedBufferCount(Source& source) {
+    ALint queued;
+    alGetSourcei(source.id(), AL_BUFFERS_QUEUED, &queued);
+    return queued;
+}
+
+void SourceStreamALTest::construct() {
+    StreamingImporter importer{10000};
+    Source source;
+
+    {
+        SourceStream stream{source, importer, 3, 1001};
+        CORRADE_COMPARE(&stream.source(), &source);
+        CORRADE_VERIFY(!stream.isLooping());
+        CORRADE_VERIFY(!stream.isFinished());
+        CORRADE_COMPARE(queuedBufferCount(source), 3);
+        /* The buffer size got rounded down to whole frames, the
+           constructor read three of them and the worker thread may have
+           read ahead already */
+        CORRADE_COMPARE_AS(importer.frameOffset(), UnsignedLong{3*500},
+            TestSuite::Compare::GreaterOrEqual);
+    }
+
+    /* The worker thread may have read ahead, but not more than a ring's
+       worth */
+    CORRADE_COMPARE_AS(importer.frameOffset(), UnsignedLong{6*500},
+        TestSuite::Compare::LessOrEqual);
+}
+
+void SourceStreamALTest::constructShortData() {
+    StreamingImporter importer{700};
+    Source source;
+
+    SourceStream stream{source, importer, 4, 1000};
+    /* Only two buffers got filled */
+    CORRADE_COMPARE(queuedBufferCount(source), 2);
+    CORRADE_COMPARE(importer.frameOffset(), UnsignedLong{700});
+    /* Not finished until the source plays the data */
+    CORRADE_VERIFY(!stream.isFinished());
+}
+
+void SourceStreamALTest::constructNotOpened() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: StreamingImporter {
+        using StreamingImporter::StreamingImporter;
+        bool doIsOpened() const override { return false; }
+    } importer{100};
+    Source source;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    SourceStream{source, importer};
+    CORRADE_COMPARE(out.str(), "Audio::SourceStream: no file opened in the importer\n");
+}
+
+void SourceStreamALTest::constructNotStreaming() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: StreamingImporter {
+        using StreamingImporter::StreamingImporter;
+        ImporterFeatures doFeatures() const override { return {}; }
+    } importer{100};
+    Source source;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    SourceStream{source, importer};
+    CORRADE_COMPARE(out.str(), "Audio::SourceStream: the importer doesn't support streaming\n");
+}
+
+void SourceStreamALTest::constructInvalidBufferCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    StreamingImporter importer{100};
+    Source source;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    SourceStream{source, importer, 1};
+    CORRADE_COMPARE(out.str(), "Audio::SourceStream: expected at least two buffers but got 1\n");
+}
+
+void SourceStreamALTest::constructInvalidBufferSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    StreamingImporter importer{100};
+    Source source;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    SourceStream{source, importer, 4, 1};
+    CORRADE_COMPARE(out.str(), "Audio::SourceStream: expected the buffer size to fit at least one 2 byte frame but got 1\n");
+}
+
+void SourceStreamALTest::constructMove() {
+    StreamingImporter importer{10000};
+    Source source;
+
+    SourceStream a{source, importer, 3, 1000};
+    SourceStream b = Utility::move(a);
+    CORRADE_COMPARE(&b.source(), &source);
+    CORRADE_COMPARE(queuedBufferCount(source), 3);
+
+    StreamingImporter importer2{10000};
+    Source source2;
+    SourceStream c{source2, importer2, 2, 1000};
+    c = Utility::move(b);
+    CORRADE_COMPARE(&c.source(), &source);
+    CORRADE_COMPARE(queuedBufferCount(source), 3);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<SourceStream>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<SourceStream>::value);
+}
+
+void SourceStreamALTest::play() {
+    /* 0.2 seconds of data in ten buffers of 0.02 seconds, four of them
+       queued at a time */
+    StreamingImporter importer{4410};
+    Source source;
+
+    SourceStream stream{source, importer, 4, 882};
+    source.play();
+
+    std::size_t queued = 0;
+    for(std::size_t i = 0; i != 200 && !stream.isFinished(); ++i) {
+        queued += stream.update();
+        /* If the source ran out of data before the next update, resume */
+        if(source.state() == Source::State::Stopped && !stream.isFinished())
+            source.play();
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+
+    CORRADE_VERIFY(stream.isFinished());
+    /* The constructor queued four, update() the remaining six */
+    CORRADE_COMPARE(queued, 6);
+    CORRADE_COMPARE(importer.frameOffset(), UnsignedLong{4410});
+}
+
+void SourceStreamALTest::looping() {
+    StreamingImporter importer{441};
+    Source source;
+
+    SourceStream stream{source, importer, 4, 882};
+    stream.setLooping(true);
+    CORRADE_VERIFY(stream.isLooping());
+    source.play();
+
+    /* Data for 0.02 seconds, played for 0.2 seconds */
+    std::size_t queued = 0;
+    for(std::size_t i = 0; i != 20; ++i) {
+        queued += stream.update();
+        if(source.state() == Source::State::Stopped)
+            source.play();
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+
+    CORRADE_VERIFY(!stream.isFinished());
+    CORRADE_COMPARE_AS(queued, std::size_t{0},
+        TestSuite::Compare::Greater);
+
+    /* After disabling looping it eventually finishes */
+    stream.setLooping(false);
+    for(std::size_t i = 0; i != 200 && !stream.isFinished(); ++i) {
+        stream.update();
+        if(source.state() == Source::State::Stopped && !stream.isFinished())
+            source.play();
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    CORRADE_VERIFY(stream.isFinished());
+}
+
+void SourceStreamALTest::destructDetachesBuffers() {
+    StreamingImporter importer{10000};
+    Source source;
+
+    {
+        SourceStream stream{source, importer, 3, 1000};
+        source.play();
+        CORRADE_COMPARE(queuedBufferCount(source), 3);
+    }
+
+    CORRADE_COMPARE(source.state(), Source::State::Stopped);
+    CORRADE_COMPARE(queuedBufferCount(source), 0);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::SourceStreamALTest)
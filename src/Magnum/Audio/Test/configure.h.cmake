@@ -25,3 +25,5 @@
 */
 
 #define AUDIO_TEST_DIR "${AUDIO_TEST_DIR}"
+#cmakedefine WAVAUDIOIMPORTER_PLUGIN_FILENAME "${WAVAUDIOIMPORTER_PLUGIN_FILENAME}"
+#define WAVAUDIOIMPORTER_TEST_DIR "${WAVAUDIOIMPORTER_TEST_DIR}"
@@ -0,0 +1,402 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AsyncReadback.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/DebugTools/TextureImage.h"
+#include "Magnum/GL/AbstractFramebuffer.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/BufferImage.h"
+#include "Magnum/GL/Fence.h"
+#include "Magnum/GL/PixelFormat.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Trade/AbstractImageConverter.h"
+
+namespace Magnum { namespace DebugTools {
+
+struct AsyncReadback::State {
+    struct Slot {
+        explicit Slot(): handle{}, isBuffer{}, format{}, image{NoCreate}, buffer{NoCreate}, bufferCapacity{}, bufferSize{}, fence{NoCreate} {}
+
+        /* Zero if the slot is free */
+        UnsignedInt handle;
+        /* Whether the slot is used for a buffer capture or an image read */
+        bool isBuffer;
+        PixelFormat format;
+        GL::BufferImage2D image;
+        /* Buffer copies are kept separately from the buffer images so a slot
+           alternating between both doesn't reallocate every time */
+        GL::Buffer buffer;
+        std::size_t bufferCapacity;
+        std::size_t bufferSize;
+        GL::Fence fence;
+    };
+
+    /* Returns a free slot with a buffer image in given format, reusing a
+       previously allocated buffer if possible */
+    Slot& acquire(PixelFormat format);
+    /* Returns a free slot with a buffer of at least given size, preferring
+       slots that don't need to reallocate */
+    Slot& acquireBuffer(std::size_t size);
+    /* Places a fence after the read and assigns a handle to the slot */
+    UnsignedInt submit(Slot& slot);
+    Slot* find(UnsignedInt handle);
+
+    Containers::Array<Slot> slots;
+    UnsignedInt nextHandle = 1;
+};
+
+AsyncReadback::State::Slot& AsyncReadback::State::acquire(const PixelFormat format) {
+    Slot* slot = nullptr;
+    for(Slot& i: slots) if(!i.handle) {
+        slot = &i;
+        break;
+    }
+    if(!slot) slot = &arrayAppend(slots, InPlaceInit);
+
+    /* Create the buffer image if not already, otherwise just update the
+       format and keep the allocated buffer */
+    if(!slot->image.buffer().id())
+        slot->image = GL::BufferImage2D{format};
+    else if(slot->format != format)
+        slot->image.setData(format, {}, nullptr, GL::BufferUsage::StreamRead);
+    slot->format = format;
+    slot->isBuffer = false;
+    return *slot;
+}
+
+AsyncReadback::State::Slot& AsyncReadback::State::acquireBuffer(const std::size_t size) {
+    Slot* slot = nullptr;
+    for(Slot& i: slots) if(!i.handle) {
+        if(i.bufferCapacity >= size) {
+            slot = &i;
+            break;
+        }
+        if(!slot) slot = &i;
+    }
+    if(!slot) slot = &arrayAppend(slots, InPlaceInit);
+
+    if(!slot->buffer.id())
+        slot->buffer = GL::Buffer{GL::Buffer::TargetHint::CopyWrite};
+    if(slot->bufferCapacity < size) {
+        slot->buffer.setData({nullptr, size}, GL::BufferUsage::StreamRead);
+        slot->bufferCapacity = size;
+    }
+    slot->bufferSize = size;
+    slot->isBuffer = true;
+    return *slot;
+}
+
+UnsignedInt AsyncReadback::State::submit(Slot& slot) {
+    CORRADE_INTERNAL_ASSERT(!slot.fence.id());
+    slot.fence = GL::Fence{};
+    slot.handle = nextHandle;
+    /* Skip zero on wraparound, it's reserved for free slots */
+    if(!++nextHandle) nextHandle = 1;
+    return slot.handle;
+}
+
+AsyncReadback::State::Slot* AsyncReadback::State::find(const UnsignedInt handle) {
+    if(handle) for(Slot& slot: slots)
+        if(slot.handle == handle) return &slot;
+    return nullptr;
+}
+
+AsyncReadback::AsyncReadback(): _state{InPlaceInit} {}
+
+AsyncReadback::AsyncReadback(AsyncReadback&&) noexcept = default;
+
+AsyncReadback::~AsyncReadback() = default;
+
+AsyncReadback& AsyncReadback::operator=(AsyncReadback&&) noexcept = default;
+
+std::size_t AsyncReadback::pendingCount() const {
+    std::size_t count = 0;
+    for(const State::Slot& slot: _state->slots)
+        if(slot.handle) ++count;
+    return count;
+}
+
+UnsignedInt AsyncReadback::read(GL::AbstractFramebuffer& framebuffer, const Range2Di& rectangle, const PixelFormat format) {
+    State::Slot& slot = _state->acquire(format);
+    framebuffer.read(rectangle, slot.image, GL::BufferUsage::StreamRead);
+    return _state->submit(slot);
+}
+
+UnsignedInt AsyncReadback::read(GL::AbstractFramebuffer& framebuffer) {
+    /* Same as in screenshot() */
+    const GL::PixelFormat format = framebuffer.implementationColorReadFormat();
+    const GL::PixelType type = framebuffer.implementationColorReadType();
+    const Containers::Optional<PixelFormat> genericFormat = GL::genericPixelFormat(format, type);
+    if(!genericFormat) {
+        Error{} << "DebugTools::AsyncReadback::read(): can't map {" << Debug::nospace << format << Debug::nospace << "," << type << Debug::nospace << "} to a generic pixel format";
+        return 0;
+    }
+
+    return read(framebuffer, framebuffer.viewport(), *genericFormat);
+}
+
+UnsignedInt AsyncReadback::textureSubImage(GL::Texture2D& texture, const Int level, const Range2Di& range, const PixelFormat format) {
+    State::Slot& slot = _state->acquire(format);
+    DebugTools::textureSubImage(texture, level, range, slot.image, GL::BufferUsage::StreamRead);
+    return _state->submit(slot);
+}
+
+UnsignedInt AsyncReadback::textureSubImage(GL::CubeMapTexture& texture, const GL::CubeMapCoordinate coordinate, const Int level, const Range2Di& range, const PixelFormat format) {
+    State::Slot& slot = _state->acquire(format);
+    DebugTools::textureSubImage(texture, coordinate, level, range, slot.image, GL::BufferUsage::StreamRead);
+    return _state->submit(slot);
+}
+
+UnsignedInt AsyncReadback::bufferSubData(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    State::Slot& slot = _state->acquireBuffer(size);
+    /* The copy is done entirely on the GPU, the data get to the CPU only
+       in takeBuffer() */
+    if(size) GL::Buffer::copy(buffer, slot.buffer, offset, 0, size);
+    return _state->submit(slot);
+}
+
+UnsignedInt AsyncReadback::bufferData(GL::Buffer& buffer) {
+    return bufferSubData(buffer, 0, buffer.size());
+}
+
+bool AsyncReadback::isReady(const UnsignedInt handle) {
+    State::Slot* const slot = _state->find(handle);
+    CORRADE_ASSERT(slot,
+        "DebugTools::AsyncReadback::isReady(): invalid handle" << handle, {});
+
+    return slot->fence.isSignaled();
+}
+
+Image2D AsyncReadback::take(const UnsignedInt handle) {
+    State::Slot* const slot = _state->find(handle);
+    CORRADE_ASSERT(slot,
+        "DebugTools::AsyncReadback::take(): invalid handle" << handle, (Image2D{PixelFormat::RGBA8Unorm}));
+    CORRADE_ASSERT(!slot->isBuffer,
+        "DebugTools::AsyncReadback::take(): handle" << handle << "is a buffer capture, use takeBuffer() instead", (Image2D{PixelFormat::RGBA8Unorm}));
+
+    slot->fence.clientWait();
+    slot->fence = GL::Fence{NoCreate};
+    slot->handle = 0;
+
+    /* The buffer may be larger than needed if it was reused from a larger
+       read */
+    const std::size_t dataSize = Magnum::Implementation::imageDataSize(slot->image);
+    Containers::Array<char> data{NoInit, dataSize};
+    if(dataSize) {
+        const Containers::ArrayView<const char> mapped = slot->image.buffer().map(0, dataSize, GL::Buffer::MapFlag::Read);
+        CORRADE_INTERNAL_ASSERT(mapped.data());
+        Utility::copy(mapped, data);
+        slot->image.buffer().unmap();
+    }
+
+    return Image2D{slot->image.storage(), slot->format, slot->image.size(), Utility::move(data)};
+}
+
+Containers::Array<char> AsyncReadback::takeBuffer(const UnsignedInt handle) {
+    State::Slot* const slot = _state->find(handle);
+    CORRADE_ASSERT(slot,
+        "DebugTools::AsyncReadback::takeBuffer(): invalid handle" << handle, {});
+    CORRADE_ASSERT(slot->isBuffer,
+        "DebugTools::AsyncReadback::takeBuffer(): handle" << handle << "is an image read, use take() instead", {});
+
+    slot->fence.clientWait();
+    slot->fence = GL::Fence{NoCreate};
+    slot->handle = 0;
+
+    /* The buffer may be larger than needed if it was reused from a larger
+       capture */
+    Containers::Array<char> data{NoInit, slot->bufferSize};
+    if(slot->bufferSize) {
+        const Containers::ArrayView<const char> mapped = slot->buffer.map(0, slot->bufferSize, GL::Buffer::MapFlag::Read);
+        CORRADE_INTERNAL_ASSERT(mapped.data());
+        Utility::copy(mapped, data);
+        slot->buffer.unmap();
+    }
+
+    return data;
+}
+
+struct AsyncScreenshot::State {
+    struct Pending {
+        UnsignedInt handle;
+        Containers::String filename;
+    };
+
+    struct Job {
+        Image2D image;
+        Containers::String filename;
+    };
+
+    void work();
+
+    AsyncReadback readback;
+    Containers::Pointer<Trade::AbstractImageConverter> converter;
+    /* Reads in flight, accessed only from the main thread */
+    Containers::Array<Pending> pending;
+
+    /* Everything below is guarded by the mutex */
+    std::mutex mutex;
+    /* Signaled when new jobs are added or when the worker should exit */
+    std::condition_variable jobsAvailable;
+    /* Signaled when the worker finishes all jobs */
+    std::condition_variable jobsDone;
+    Containers::Array<Job> jobs;
+    std::size_t jobsInProgress = 0;
+    bool exit = false;
+
+    /* Has to be last so it's started after everything else is constructed */
+    std::thread thread;
+};
+
+void AsyncScreenshot::State::work() {
+    std::unique_lock<std::mutex> lock{mutex};
+    for(;;) {
+        jobsAvailable.wait(lock, [this]{ return exit || !jobs.isEmpty(); });
+        if(jobs.isEmpty() && exit) return;
+
+        /* Take all jobs and process them without holding the lock */
+        Containers::Array<Job> current = Utility::move(jobs);
+        jobsInProgress = current.size();
+        lock.unlock();
+
+        for(Job& job: current) {
+            if(converter->convertToFile(job.image, job.filename))
+                Debug{} << "DebugTools::AsyncScreenshot: saved a" << job.image.format() << "image of size" << job.image.size() << "to" << job.filename;
+        }
+
+        lock.lock();
+        jobsInProgress = 0;
+        if(jobs.isEmpty()) jobsDone.notify_all();
+    }
+}
+
+AsyncScreenshot::AsyncScreenshot(PluginManager::Manager<Trade::AbstractImageConverter>& manager): _state{InPlaceInit} {
+    if(!(_state->converter = manager.loadAndInstantiate("AnyImageConverter")))
+        return;
+
+    _state->thread = std::thread{&State::work, _state.get()};
+}
+
+AsyncScreenshot::~AsyncScreenshot() {
+    if(!_state->converter) return;
+
+    finish();
+
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        _state->exit = true;
+    }
+    _state->jobsAvailable.notify_one();
+    _state->thread.join();
+}
+
+AsyncReadback& AsyncScreenshot::readback() {
+    return _state->readback;
+}
+
+std::size_t AsyncScreenshot::pendingCount() const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    return _state->pending.size() + _state->jobs.size() + _state->jobsInProgress;
+}
+
+bool AsyncScreenshot::capture(GL::AbstractFramebuffer& framebuffer, const Containers::StringView filename) {
+    if(!_state->converter) {
+        Error{} << "DebugTools::AsyncScreenshot::capture(): no converter plugin available";
+        return false;
+    }
+
+    const UnsignedInt handle = _state->readback.read(framebuffer);
+    if(!handle) return false;
+
+    arrayAppend(_state->pending, InPlaceInit, handle, Containers::String{filename});
+    return true;
+}
+
+bool AsyncScreenshot::capture(GL::AbstractFramebuffer& framebuffer, const PixelFormat format, const Containers::StringView filename) {
+    if(!_state->converter) {
+        Error{} << "DebugTools::AsyncScreenshot::capture(): no converter plugin available";
+        return false;
+    }
+
+    const UnsignedInt handle = _state->readback.read(framebuffer, framebuffer.viewport(), format);
+    arrayAppend(_state->pending, InPlaceInit, handle, Containers::String{filename});
+    return true;
+}
+
+void AsyncScreenshot::update() {
+    /* Move finished reads to the worker, keep the rest in order */
+    std::size_t kept = 0;
+    bool added = false;
+    for(State::Pending& pending: _state->pending) {
+        if(!_state->readback.isReady(pending.handle)) {
+            _state->pending[kept++] = Utility::move(pending);
+            continue;
+        }
+
+        Image2D image = _state->readback.take(pending.handle);
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        arrayAppend(_state->jobs, InPlaceInit, Utility::move(image), Utility::move(pending.filename));
+        added = true;
+    }
+    arrayRemoveSuffix(_state->pending, _state->pending.size() - kept);
+
+    if(added) _state->jobsAvailable.notify_one();
+}
+
+void AsyncScreenshot::finish() {
+    if(!_state->converter) return;
+
+    /* Wait for all reads, take() blocks until the data are available */
+    if(!_state->pending.isEmpty()) {
+        {
+            std::lock_guard<std::mutex> lock{_state->mutex};
+            for(State::Pending& pending: _state->pending)
+                arrayAppend(_state->jobs, InPlaceInit, _state->readback.take(pending.handle), Utility::move(pending.filename));
+        }
+        arrayResize(_state->pending, 0);
+        _state->jobsAvailable.notify_one();
+    }
+
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    _state->jobsDone.wait(lock, [this]{
+        return _state->jobs.isEmpty() && !_state->jobsInProgress;
+    });
+}
+
+}}
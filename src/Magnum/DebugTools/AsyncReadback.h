@@ -0,0 +1,339 @@
+#ifndef Magnum_DebugTools_AsyncReadback_h
+#define Magnum_DebugTools_AsyncReadback_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::DebugTools::AsyncReadback, @ref Magnum::DebugTools::AsyncScreenshot
+ * @m_since_latest
+ */
+#endif
+
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/PluginManager/PluginManager.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/DebugTools/visibility.h"
+#include "Magnum/GL/GL.h"
+#include "Magnum/GL/OpenGL.h"
+#include "Magnum/Trade/Trade.h"
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Asynchronous framebuffer and texture readback
+@m_since_latest
+
+Unlike @ref GL::AbstractFramebuffer::read() or @ref textureSubImage() into an
+@ref Image2D, which wait until the GPU finishes rendering and then copy the
+data, this class reads pixels into a @ref GL::BufferImage2D and places a fence
+sync object after the read. The returned handle can be then polled with
+@ref isReady() in subsequent frames and once the fence is signaled, the data
+are retrieved with @ref take() without stalling the pipeline:
+
+@snippet DebugTools-gl.cpp AsyncReadback-usage
+
+Buffer images of finished reads are kept around and reused for subsequent
+reads in order to avoid repeated allocations.
+
+@section DebugTools-AsyncReadback-buffers Buffer capture
+
+Contents of @ref GL::Buffer instances can be captured as well, which is useful
+for example for inspecting intermediate data of GPU-driven pipelines. Unlike
+@ref DebugTools::bufferData(GL::Buffer&), which maps the buffer
+or queries its data and thus waits for the GPU, @ref bufferData() and
+@ref bufferSubData() only schedule a GPU-side copy into an internal buffer,
+followed by a fence. The copied data are then retrieved with @ref takeBuffer()
+once @ref isReady() returns @cpp true @ce. Capturing many buffers at once is
+thus just a sequence of GPU commands, and the capture represents buffer
+contents at the time it was scheduled even if the original buffer gets
+modified later:
+
+@snippet DebugTools-gl.cpp AsyncReadback-buffers
+
+Same as with buffer images, the internal buffers are kept around and reused for
+subsequent captures of the same or smaller size.
+@requires_gl31 Extension @gl_extension{ARB,copy_buffer} for buffer capture
+@requires_gles30 Pixel pack buffers and fence sync objects are not available
+    in OpenGL ES 2.0.
+@requires_gles Buffer mapping is not available in WebGL.
+@see @ref AsyncScreenshot
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT AsyncReadback {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * No OpenGL objects are created until the first read.
+         */
+        explicit AsyncReadback();
+
+        /** @brief Copying is not allowed */
+        AsyncReadback(const AsyncReadback&) = delete;
+
+        /** @brief Move constructor */
+        AsyncReadback(AsyncReadback&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Pending reads that weren't retrieved with @ref take() are
+         * discarded.
+         */
+        ~AsyncReadback();
+
+        /** @brief Copying is not allowed */
+        AsyncReadback& operator=(const AsyncReadback&) = delete;
+
+        /** @brief Move assignment */
+        AsyncReadback& operator=(AsyncReadback&&) noexcept;
+
+        /** @brief Count of reads that weren't retrieved yet */
+        std::size_t pendingCount() const;
+
+        /**
+         * @brief Read a framebuffer rectangle
+         * @param framebuffer   Framebuffer to read
+         * @param rectangle     Rectangle to read
+         * @param format        Pixel format to read in
+         * @return Non-zero read handle
+         *
+         * Asynchronous equivalent of
+         * @ref GL::AbstractFramebuffer::read(const Range2Di&, const BasicMutableImageView2D<char>&).
+         * Note that supplying a format that's incompatible with the
+         * framebuffer may result in GL errors.
+         */
+        UnsignedInt read(GL::AbstractFramebuffer& framebuffer, const Range2Di& rectangle, PixelFormat format);
+
+        /**
+         * @brief Read a framebuffer viewport
+         * @return Non-zero read handle or @cpp 0 @ce on failure
+         *
+         * Reads the whole @ref GL::AbstractFramebuffer::viewport(). Pixel
+         * format is queried and mapped to a generic format the same way as in
+         * @ref screenshot(GL::AbstractFramebuffer&, Containers::StringView).
+         * If the mapping fails, a message is printed and @cpp 0 @ce is
+         * returned.
+         */
+        UnsignedInt read(GL::AbstractFramebuffer& framebuffer);
+
+        /**
+         * @brief Read a texture subimage
+         * @return Non-zero read handle
+         *
+         * Asynchronous equivalent of
+         * @ref textureSubImage(GL::Texture2D&, Int, const Range2Di&, GL::BufferImage2D&, GL::BufferUsage).
+         */
+        UnsignedInt textureSubImage(GL::Texture2D& texture, Int level, const Range2Di& range, PixelFormat format);
+
+        /**
+         * @brief Read a cube map texture subimage
+         * @return Non-zero read handle
+         *
+         * Asynchronous equivalent of
+         * @ref textureSubImage(GL::CubeMapTexture&, GL::CubeMapCoordinate, Int, const Range2Di&, GL::BufferImage2D&, GL::BufferUsage).
+         */
+        UnsignedInt textureSubImage(GL::CubeMapTexture& texture, GL::CubeMapCoordinate coordinate, Int level, const Range2Di& range, PixelFormat format);
+
+        /**
+         * @brief Capture a buffer range
+         * @param buffer    Buffer to capture
+         * @param offset    Offset in the buffer
+         * @param size      Size of the captured range
+         * @return Non-zero capture handle
+         * @m_since_latest
+         *
+         * Asynchronous equivalent of
+         * @ref DebugTools::bufferSubData(GL::Buffer&, GLintptr, GLsizeiptr).
+         * Copies the range into an internal buffer using
+         * @ref GL::Buffer::copy() and places a fence after, the data are then
+         * retrieved with @ref takeBuffer(). See
+         * @ref DebugTools-AsyncReadback-buffers for more information.
+         * @requires_gl31 Extension @gl_extension{ARB,copy_buffer}
+         */
+        UnsignedInt bufferSubData(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+
+        /**
+         * @brief Capture whole buffer contents
+         * @return Non-zero capture handle
+         * @m_since_latest
+         *
+         * Asynchronous equivalent of
+         * @ref DebugTools::bufferData(GL::Buffer&). Calls
+         * @ref bufferSubData() with the whole @ref GL::Buffer::size().
+         * @requires_gl31 Extension @gl_extension{ARB,copy_buffer}
+         */
+        UnsignedInt bufferData(GL::Buffer& buffer);
+
+        /**
+         * @brief Whether a read is finished
+         *
+         * Checks the fence without waiting. Expects that @p handle was
+         * returned from one of the read or buffer capture functions and
+         * wasn't retrieved with @ref take() or @ref takeBuffer() yet.
+         */
+        bool isReady(UnsignedInt handle);
+
+        /**
+         * @brief Retrieve read data
+         *
+         * If the read isn't finished yet, waits until it is --- call
+         * @ref isReady() first to avoid stalls. Then copies the data out of
+         * the buffer and makes @p handle invalid. Expects that @p handle was
+         * returned from one of the read functions and wasn't retrieved with
+         * @ref take() yet.
+         */
+        Image2D take(UnsignedInt handle);
+
+        /**
+         * @brief Retrieve captured buffer data
+         * @m_since_latest
+         *
+         * If the capture isn't finished yet, waits until it is --- call
+         * @ref isReady() first to avoid stalls. Then copies the data out of
+         * the internal buffer and makes @p handle invalid. Expects that
+         * @p handle was returned from @ref bufferData() or
+         * @ref bufferSubData() and wasn't retrieved with @ref takeBuffer()
+         * yet.
+         */
+        Containers::Array<char> takeBuffer(UnsignedInt handle);
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+/**
+@brief Asynchronous screenshot saving
+@m_since_latest
+
+Continuously captures framebuffer contents using @ref AsyncReadback and saves
+them on a worker thread using the
+@ref Trade::AnyImageConverter "AnyImageConverter" plugin, so neither the
+readback nor the file encoding blocks rendering. Call @ref capture() to
+schedule a screenshot and @ref update() once per frame to hand finished reads
+over to the worker:
+
+@snippet DebugTools-gl.cpp AsyncScreenshot-usage
+
+The converter plugin instance is used exclusively from the worker thread,
+the plugin manager is accessed only in the constructor. The same set of
+file format and pixel format restrictions as in
+@ref screenshot(GL::AbstractFramebuffer&, Containers::StringView) applies,
+success of each save is reported through messages printed from the worker
+thread.
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT AsyncScreenshot {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Instantiates the @ref Trade::AnyImageConverter "AnyImageConverter"
+         * plugin from @p manager and starts the worker thread. If the plugin
+         * can't be loaded, a message is printed and all subsequent
+         * @ref capture() calls fail.
+         */
+        explicit AsyncScreenshot(PluginManager::Manager<Trade::AbstractImageConverter>& manager);
+
+        /** @brief Copying is not allowed */
+        AsyncScreenshot(const AsyncScreenshot&) = delete;
+
+        /** @brief Moving is not allowed */
+        AsyncScreenshot(AsyncScreenshot&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Calls @ref finish() and stops the worker thread.
+         */
+        ~AsyncScreenshot();
+
+        /** @brief Copying is not allowed */
+        AsyncScreenshot& operator=(const AsyncScreenshot&) = delete;
+
+        /** @brief Moving is not allowed */
+        AsyncScreenshot& operator=(AsyncScreenshot&&) = delete;
+
+        /** @brief Underlying readback instance */
+        AsyncReadback& readback();
+
+        /**
+         * @brief Count of pending screenshots
+         *
+         * Includes both screenshots that are still being read back and
+         * screenshots waiting to be saved or being saved on the worker
+         * thread.
+         */
+        std::size_t pendingCount() const;
+
+        /**
+         * @brief Schedule a screenshot
+         *
+         * Starts an asynchronous read of the framebuffer viewport with
+         * @ref AsyncReadback::read(GL::AbstractFramebuffer&). Returns
+         * @cpp false @ce if the converter plugin couldn't be loaded or if
+         * the pixel format can't be mapped to a generic format, a message is
+         * printed in both cases.
+         */
+        bool capture(GL::AbstractFramebuffer& framebuffer, Containers::StringView filename);
+
+        /**
+         * @brief Schedule a screenshot in requested pixel format
+         *
+         * Similar to @ref capture(GL::AbstractFramebuffer&, Containers::StringView)
+         * but with an explicit pixel format. Returns @cpp false @ce if the
+         * converter plugin couldn't be loaded.
+         */
+        bool capture(GL::AbstractFramebuffer& framebuffer, PixelFormat format, Containers::StringView filename);
+
+        /**
+         * @brief Hand finished reads over to the worker thread
+         *
+         * Doesn't block. Meant to be called once per frame.
+         */
+        void update();
+
+        /**
+         * @brief Wait until all pending screenshots are saved
+         *
+         * Blocks until all pending reads are finished and the worker thread
+         * saves all of them.
+         */
+        void finish();
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+#else
+#error this header is available only in the OpenGL build and is not available in OpenGL ES 2.0 and WebGL builds
+#endif
+
+#endif
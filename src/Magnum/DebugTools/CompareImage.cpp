@@ -26,8 +26,13 @@
 
 #include "CompareImage.h"
 
+#include <cstring>
+#include <limits>
 #include <map>
 #include <sstream>
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
@@ -49,6 +54,10 @@
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/ImageData.h"
 
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace Magnum { namespace DebugTools { namespace Implementation {
 
 namespace {
@@ -98,6 +107,62 @@ template<std::size_t size, class T, typename std::enable_if<Math::IsFloatingPoin
     return max;
 }
 
+/* Processes the row prefix that can be handled with SIMD and returns the
+   count of processed pixels together with max delta in them. The generic
+   variant doesn't process anything. */
+template<std::size_t size, class T> Containers::Pair<std::size_t, Float> calculateRowDeltaSimd(const Containers::StridedArrayView1D<const Math::Vector<size, T>>&, const Containers::StridedArrayView1D<const Math::Vector<size, T>>&, const Containers::StridedArrayView1D<Float>&) {
+    return {0, 0.0f};
+}
+
+#ifdef CORRADE_TARGET_SSE2
+/* Four-channel 8-bit formats are the most common in rendering output, so
+   those get a dedicated SSE2 variant calculating four pixels at once. The
+   result is bit-exact with the scalar code, as the per-pixel sums are
+   integers and division by 4 is exact. */
+template<> Containers::Pair<std::size_t, Float> calculateRowDeltaSimd<4, UnsignedByte>(const Containers::StridedArrayView1D<const Math::Vector<4, UnsignedByte>>& actual, const Containers::StridedArrayView1D<const Math::Vector<4, UnsignedByte>>& expected, const Containers::StridedArrayView1D<Float>& output) {
+    if(!actual.isContiguous() || !expected.isContiguous() || !output.isContiguous())
+        return {0, 0.0f};
+
+    const auto* actualData = static_cast<const char*>(actual.data());
+    const auto* expectedData = static_cast<const char*>(expected.data());
+    Float* const outputData = static_cast<Float*>(output.data());
+    const std::size_t count = actual.size() & ~std::size_t{3};
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi16(1);
+    const __m128 quarter = _mm_set1_ps(0.25f);
+    __m128 max = _mm_setzero_ps();
+    for(std::size_t i = 0; i != count; i += 4) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(actualData + i*4));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(expectedData + i*4));
+
+        /* Absolute difference of unsigned bytes */
+        const __m128i diff = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+
+        /* Widen to 16 bits and sum pairs of channels into 32 bits, giving
+           two partial sums for each pixel */
+        const __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi8(diff, zero), ones);
+        const __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi8(diff, zero), ones);
+
+        /* Deinterleave the partial sums and add them together */
+        const __m128 loF = _mm_castsi128_ps(lo);
+        const __m128 hiF = _mm_castsi128_ps(hi);
+        const __m128i sum = _mm_add_epi32(
+            _mm_castps_si128(_mm_shuffle_ps(loF, hiF, _MM_SHUFFLE(2, 0, 2, 0))),
+            _mm_castps_si128(_mm_shuffle_ps(loF, hiF, _MM_SHUFFLE(3, 1, 3, 1))));
+
+        const __m128 delta = _mm_mul_ps(_mm_cvtepi32_ps(sum), quarter);
+        _mm_storeu_ps(outputData + i, delta);
+        max = _mm_max_ps(max, delta);
+    }
+
+    /* Horizontal max */
+    max = _mm_max_ps(max, _mm_shuffle_ps(max, max, _MM_SHUFFLE(1, 0, 3, 2)));
+    max = _mm_max_ps(max, _mm_shuffle_ps(max, max, _MM_SHUFFLE(2, 3, 0, 1)));
+    return {count, _mm_cvtss_f32(max)};
+}
+#endif
+
 template<std::size_t size, class T, typename std::enable_if<Math::IsIntegral<T>::value, int>::type = 0> Float calculateImageDelta(const Containers::StridedArrayView2D<const Math::Vector<size, T>>& actual, const Containers::StridedArrayView2D<const Math::Vector<size, T>>& expected, const Containers::StridedArrayView2D<Float>& output) {
     CORRADE_INTERNAL_ASSERT(actual.size() == output.size());
     CORRADE_INTERNAL_ASSERT(output.size() == expected.size());
@@ -109,7 +174,11 @@ template<std::size_t size, class T, typename std::enable_if<Math::IsIntegral<T>:
         Containers::StridedArrayView1D<const Math::Vector<size, T>> expectedRow = expected[i];
         Containers::StridedArrayView1D<Float> outputRow = output[i];
 
-        for(std::size_t j = 0, jMax = expectedRow.size(); j != jMax; ++j) {
+        /* Process what's possible with SIMD first, the rest in scalar code */
+        const Containers::Pair<std::size_t, Float> simd = calculateRowDeltaSimd(actualRow, expectedRow, outputRow);
+        max = Math::max(max, simd.second());
+
+        for(std::size_t j = simd.first(), jMax = expectedRow.size(); j != jMax; ++j) {
             /* Explicitly convert from T to Float */
             auto actualPixel = Math::Vector<size, Float>(actualRow[j]);
             auto expectedPixel = Math::Vector<size, Float>(expectedRow[j]);
@@ -123,6 +192,145 @@ template<std::size_t size, class T, typename std::enable_if<Math::IsIntegral<T>:
     return max;
 }
 
+bool pixelsIdentical(const Containers::StridedArrayView3D<const char>& actual, const Containers::StridedArrayView3D<const char>& expected) {
+    CORRADE_INTERNAL_ASSERT(actual.size() == expected.size());
+
+    for(std::size_t i = 0, iMax = actual.size()[0]; i != iMax; ++i) {
+        const Containers::StridedArrayView2D<const char> actualRow = actual[i];
+        const Containers::StridedArrayView2D<const char> expectedRow = expected[i];
+        if(actualRow.isContiguous() && expectedRow.isContiguous()) {
+            if(std::memcmp(actualRow.data(), expectedRow.data(), actualRow.size()[0]*actualRow.size()[1]) != 0)
+                return false;
+        } else for(std::size_t j = 0, jMax = actualRow.size()[0]; j != jMax; ++j) {
+            for(std::size_t k = 0, kMax = actualRow.size()[1]; k != kMax; ++k)
+                if(actualRow[j][k] != expectedRow[j][k]) return false;
+        }
+    }
+
+    return true;
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+/* Images below this pixel count are processed on a single thread, and each
+   thread gets at least this many pixels */
+constexpr std::size_t ParallelPixelCount = 256*1024;
+#endif
+
+template<std::size_t size, class T> Float calculateImageDelta(const Containers::StridedArrayView3D<const char>& actualPixels, const Containers::StridedArrayView3D<const char>& expectedPixels, const Containers::StridedArrayView2D<Float>& output, bool& identical) {
+    /* Fast path for bitwise identical images, which is the common case in
+       regression tests. Even NaNs and infinities would result in a zero delta
+       if bitwise equal. */
+    if(pixelsIdentical(actualPixels, expectedPixels)) {
+        for(std::size_t i = 0, iMax = output.size()[0]; i != iMax; ++i)
+            for(Float& j: output[i]) j = 0.0f;
+        identical = true;
+        return 0.0f;
+    }
+
+    const auto actual = Containers::arrayCast<2, const Math::Vector<size, T>>(actualPixels);
+    const auto expected = Containers::arrayCast<2, const Math::Vector<size, T>>(expectedPixels);
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* Split large images into row ranges processed on multiple threads, the
+       calling thread processing the last range */
+    const std::size_t rowCount = output.size()[0];
+    const std::size_t threadCount = Math::min(
+        Math::max(std::size_t(std::thread::hardware_concurrency()), std::size_t{1}),
+        Math::min(rowCount, output.size()[0]*output.size()[1]/ParallelPixelCount));
+    if(threadCount > 1) {
+        Containers::Array<Float> maxes{ValueInit, threadCount};
+        const auto calculate = [&](const std::size_t thread) {
+            const std::size_t begin = rowCount*thread/threadCount;
+            const std::size_t end = rowCount*(thread + 1)/threadCount;
+            maxes[thread] = calculateImageDelta<size, T>(
+                actual.slice(begin, end),
+                expected.slice(begin, end),
+                output.slice(begin, end));
+        };
+
+        Containers::Array<std::thread> threads{threadCount - 1};
+        for(std::size_t i = 0; i != threads.size(); ++i)
+            threads[i] = std::thread{calculate, i};
+        calculate(threadCount - 1);
+        for(std::thread& thread: threads) thread.join();
+
+        Float max{};
+        for(const Float i: maxes) max = Math::max(max, i);
+        return max;
+    }
+    #endif
+
+    return calculateImageDelta<size, T>(actual, expected, output);
+}
+
+/* Dynamic range of the pixel values for the SSIM stabilization constants.
+   Deltas are calculated on unnormalized values, so the same is done here. */
+template<class T, typename std::enable_if<Math::IsIntegral<T>::value, int>::type = 0> Double ssimRange() {
+    return Double(std::numeric_limits<T>::max()) - Double(std::numeric_limits<T>::min());
+}
+template<class T, typename std::enable_if<Math::IsFloatingPoint<T>::value, int>::type = 0> Double ssimRange() {
+    return 1.0;
+}
+
+/* Running sums of one SSIM window */
+struct SsimWindow {
+    Double actual, expected, actualSquared, expectedSquared, actualExpected;
+    std::size_t count;
+};
+
+template<std::size_t size, class T> Float calculateImageSsim(const Containers::StridedArrayView2D<const Math::Vector<size, T>>& actual, const Containers::StridedArrayView2D<const Math::Vector<size, T>>& expected, const Vector2i& windowSize) {
+    CORRADE_INTERNAL_ASSERT(actual.size() == expected.size());
+
+    const Double c1 = Math::pow<2>(0.01*ssimRange<T>());
+    const Double c2 = Math::pow<2>(0.03*ssimRange<T>());
+
+    /* Only one row of windows is kept, which gets finalized once all its
+       pixel rows are processed, so both images are read just once, in
+       order */
+    const std::size_t width = expected.size()[1];
+    const std::size_t height = expected.size()[0];
+    Containers::Array<SsimWindow> windows{ValueInit, (width + windowSize.x() - 1)/windowSize.x()};
+    Double ssimSum = 0.0;
+    std::size_t windowCount = 0;
+    for(std::size_t i = 0; i != height; ++i) {
+        Containers::StridedArrayView1D<const Math::Vector<size, T>> actualRow = actual[i];
+        Containers::StridedArrayView1D<const Math::Vector<size, T>> expectedRow = expected[i];
+
+        for(std::size_t j = 0; j != width; ++j) {
+            /* The channels are averaged, similarly to how the delta is a
+               per-channel average */
+            const Double a = Math::Vector<size, Float>(actualRow[j]).sum()/size;
+            const Double e = Math::Vector<size, Float>(expectedRow[j]).sum()/size;
+
+            SsimWindow& window = windows[j/windowSize.x()];
+            window.actual += a;
+            window.expected += e;
+            window.actualSquared += a*a;
+            window.expectedSquared += e*e;
+            window.actualExpected += a*e;
+            ++window.count;
+        }
+
+        if((i + 1) % windowSize.y() && i + 1 != height) continue;
+
+        for(SsimWindow& window: windows) {
+            const Double actualMean = window.actual/window.count;
+            const Double expectedMean = window.expected/window.count;
+            const Double actualVariance = window.actualSquared/window.count - actualMean*actualMean;
+            const Double expectedVariance = window.expectedSquared/window.count - expectedMean*expectedMean;
+            const Double covariance = window.actualExpected/window.count - actualMean*expectedMean;
+
+            ssimSum += ((2.0*actualMean*expectedMean + c1)*(2.0*covariance + c2))/
+                ((actualMean*actualMean + expectedMean*expectedMean + c1)*(actualVariance + expectedVariance + c2));
+            ++windowCount;
+
+            window = {};
+        }
+    }
+
+    return Float(ssimSum/windowCount);
+}
+
 }
 
 Containers::Triple<Containers::Array<Float>, Float, Float> calculateImageDelta(const PixelFormat actualFormat, const Containers::StridedArrayView3D<const char>& actualPixels, const ImageView2D& expected) {
@@ -144,36 +352,33 @@ Containers::Triple<Containers::Array<Float>, Float, Float> calculateImageDelta(c
     #pragma GCC diagnostic error "-Wswitch"
     #endif
     Float max{Constants::nan()};
+    bool identical = false;
     switch(expected.format()) {
         #define _c(format, size, T)                                         \
             case PixelFormat::format:                                       \
-                max = calculateImageDelta<size, T>(                         \
-                    Containers::arrayCast<2, const Math::Vector<size, T>>(actualPixels), \
-                    expected.pixels<Math::Vector<size, T>>(), delta);       \
+                max = calculateImageDelta<size, T>(actualPixels,            \
+                    expected.pixels(), delta, identical);                   \
                 break;
         #define _d(first, second, size, T)                                  \
             case PixelFormat::first:                                        \
             case PixelFormat::second:                                       \
-                max = calculateImageDelta<size, T>(                         \
-                    Containers::arrayCast<2, const Math::Vector<size, T>>(actualPixels), \
-                    expected.pixels<Math::Vector<size, T>>(), delta);       \
+                max = calculateImageDelta<size, T>(actualPixels,            \
+                    expected.pixels(), delta, identical);                   \
                 break;
         #define _e(first, second, third, size, T)                           \
             case PixelFormat::first:                                        \
             case PixelFormat::second:                                       \
             case PixelFormat::third:                                        \
-                max = calculateImageDelta<size, T>(                         \
-                    Containers::arrayCast<2, const Math::Vector<size, T>>(actualPixels), \
-                    expected.pixels<Math::Vector<size, T>>(), delta);       \
+                max = calculateImageDelta<size, T>(actualPixels,            \
+                    expected.pixels(), delta, identical);                   \
                 break;
         #define _f(first, second, third, fourth, size, T)                   \
             case PixelFormat::first:                                        \
             case PixelFormat::second:                                       \
             case PixelFormat::third:                                        \
             case PixelFormat::fourth:                                       \
-                max = calculateImageDelta<size, T>(                         \
-                    Containers::arrayCast<2, const Math::Vector<size, T>>(actualPixels), \
-                    expected.pixels<Math::Vector<size, T>>(), delta);       \
+                max = calculateImageDelta<size, T>(actualPixels,            \
+                    expected.pixels(), delta, identical);                   \
                 break;
         /* LCOV_EXCL_START */
         _f(R8Unorm, R8Srgb, R8UI, Stencil8UI, 1, UnsignedByte)
@@ -231,11 +436,131 @@ Containers::Triple<Containers::Array<Float>, Float, Float> calculateImageDelta(c
        *deliberately* leaves specials in. The `max` has them already filtered
        out so if this would filter them out as well, there would be nothing
        left that could cause the comparison to fail. */
-    const Float mean = Math::Algorithms::kahanSum(deltaData.begin(), deltaData.end())/deltaData.size();
+    const Float mean = identical ? 0.0f :
+        Math::Algorithms::kahanSum(deltaData.begin(), deltaData.end())/deltaData.size();
 
     return {Utility::move(deltaData), max, mean};
 }
 
+Float calculateImageSsim(const PixelFormat actualFormat, const Containers::StridedArrayView3D<const char>& actualPixels, const ImageView2D& expected, const Vector2i& windowSize) {
+    CORRADE_INTERNAL_ASSERT(actualFormat == expected.format());
+    #ifdef CORRADE_NO_ASSERT
+    static_cast<void>(actualFormat);
+    #endif
+    CORRADE_INTERNAL_ASSERT(Vector2i{Int(actualPixels.size()[1]), Int(actualPixels.size()[0])} == expected.size());
+    CORRADE_INTERNAL_ASSERT(windowSize.product() > 0);
+    CORRADE_ASSERT(!isPixelFormatImplementationSpecific(expected.format()),
+        "DebugTools::CompareImage: can't compare implementation-specific pixel formats", {});
+
+    /* An empty image is trivially similar */
+    if(!expected.size().product()) return 1.0f;
+
+    #ifdef CORRADE_TARGET_GCC
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic error "-Wswitch"
+    #endif
+    switch(expected.format()) {
+        #define _c(format, size, T)                                         \
+            case PixelFormat::format:                                       \
+                return calculateImageSsim<size, T>(                         \
+                    Containers::arrayCast<2, const Math::Vector<size, T>>(actualPixels), \
+                    expected.pixels<Math::Vector<size, T>>(), windowSize);
+        #define _d(first, second, size, T)                                  \
+            case PixelFormat::first:                                        \
+            _c(second, size, T)
+        #define _e(first, second, third, size, T)                           \
+            case PixelFormat::first:                                        \
+            case PixelFormat::second:                                       \
+            _c(third, size, T)
+        #define _f(first, second, third, fourth, size, T)                   \
+            case PixelFormat::first:                                        \
+            case PixelFormat::second:                                       \
+            case PixelFormat::third:                                        \
+            _c(fourth, size, T)
+        /* LCOV_EXCL_START */
+        _f(R8Unorm, R8Srgb, R8UI, Stencil8UI, 1, UnsignedByte)
+        _e(RG8Unorm, RG8Srgb, RG8UI, 2, UnsignedByte)
+        _e(RGB8Unorm, RGB8Srgb, RGB8UI, 3, UnsignedByte)
+        _e(RGBA8Unorm, RGBA8Srgb, RGBA8UI, 4, UnsignedByte)
+        _d(R8Snorm, R8I, 1, Byte)
+        _d(RG8Snorm, RG8I, 2, Byte)
+        _d(RGB8Snorm, RGB8I, 3, Byte)
+        _d(RGBA8Snorm, RGBA8I, 4, Byte)
+        _e(R16Unorm, R16UI, Depth16Unorm, 1, UnsignedShort)
+        _d(RG16Unorm, RG16UI, 2, UnsignedShort)
+        _d(RGB16Unorm, RGB16UI, 3, UnsignedShort)
+        _d(RGBA16Unorm, RGBA16UI, 4, UnsignedShort)
+        _d(R16Snorm, R16I, 1, Short)
+        _d(RG16Snorm, RG16I, 2, Short)
+        _d(RGB16Snorm, RGB16I, 3, Short)
+        _d(RGBA16Snorm, RGBA16I, 4, Short)
+        _d(R32UI, Depth24Unorm, 1, UnsignedInt)
+        _c(RG32UI, 2, UnsignedInt)
+        _c(RGB32UI, 3, UnsignedInt)
+        _c(RGBA32UI, 4, UnsignedInt)
+        _c(R32I, 1, Int)
+        _c(RG32I, 2, Int)
+        _c(RGB32I, 3, Int)
+        _c(RGBA32I, 4, Int)
+        _c(R16F, 1, Half)
+        _c(RG16F, 2, Half)
+        _c(RGB16F, 3, Half)
+        _c(RGBA16F, 4, Half)
+        _d(R32F, Depth32F, 1, Float)
+        _c(RG32F, 2, Float)
+        _c(RGB32F, 3, Float)
+        _c(RGBA32F, 4, Float)
+        /* LCOV_EXCL_STOP */
+        #undef _f
+        #undef _e
+        #undef _d
+        #undef _c
+
+        case PixelFormat::Depth16UnormStencil8UI:
+        case PixelFormat::Depth24UnormStencil8UI:
+        case PixelFormat::Depth32FStencil8UI:
+            CORRADE_ASSERT_UNREACHABLE("DebugTools::CompareImage: packed depth/stencil formats are not supported yet", {});
+    }
+    #ifdef CORRADE_TARGET_GCC
+    #pragma GCC diagnostic pop
+    #endif
+
+    CORRADE_ASSERT_UNREACHABLE("DebugTools::CompareImage: unknown format" << expected.format(), {});
+}
+
+Containers::Array<Containers::Pair<Float, Float>> calculateTileDeltas(const Containers::ArrayView<const Float> deltas, const Vector2i& size, const Vector2i& tileSize) {
+    CORRADE_INTERNAL_ASSERT(std::size_t(size.product()) == deltas.size());
+    CORRADE_INTERNAL_ASSERT(tileSize.product() > 0);
+
+    const Vector2i tileCount = (size + tileSize - Vector2i{1})/tileSize;
+    Containers::Array<Containers::Pair<Float, Float>> out{ValueInit, std::size_t(tileCount.product())};
+
+    /* Go through the deltas just once, in order, summing into the tiles of
+       current row */
+    for(Int y = 0; y != size.y(); ++y) {
+        Containers::Pair<Float, Float>* const tileRow = out.data() + y/tileSize.y()*tileCount.x();
+        for(Int x = 0; x != size.x(); ++x) {
+            const Float delta = deltas[y*size.x() + x];
+            Containers::Pair<Float, Float>& tile = tileRow[x/tileSize.x()];
+            /* Same as with the global max and mean, specials are ignored in
+               the max but propagated to the mean */
+            if(!Math::isNan(delta) && !Math::isInf(delta))
+                tile.first() = Math::max(tile.first(), delta);
+            tile.second() += delta;
+        }
+    }
+
+    /* Turn the sums into means */
+    for(Int y = 0; y != tileCount.y(); ++y) {
+        for(Int x = 0; x != tileCount.x(); ++x) {
+            const Vector2i currentSize = Math::min(size - Vector2i{x, y}*tileSize, tileSize);
+            out[y*tileCount.x() + x].second() /= currentSize.product();
+        }
+    }
+
+    return out;
+}
+
 namespace {
     /* Done by printing an white to black gradient using one of the online
        ASCII converters. Yes, I'm lazy. Another one could be " .,:;ox%#@". */
@@ -428,6 +753,51 @@ void printPixelDeltas(Debug& out, Containers::ArrayView<const Float> delta, Pixe
     }
 }
 
+void printTileDeltas(Debug& out, const Containers::ArrayView<const Containers::Pair<Float, Float>> tiles, const Vector2i& size, const Vector2i& tileSize, const Float maxThreshold, const Float meanThreshold, const std::size_t maxCount) {
+    const Int tileCountX = (size.x() + tileSize.x() - 1)/tileSize.x();
+    CORRADE_INTERNAL_ASSERT(tiles.size() == std::size_t(tileCountX*((size.y() + tileSize.y() - 1)/tileSize.y())));
+
+    /* Find tiles that have either the max or the mean above threshold and
+       put them into a map sorted by the max. Need to reverse the mean
+       condition in order to catch NaNs. */
+    std::multimap<Float, std::size_t> large;
+    for(std::size_t i = 0; i != tiles.size(); ++i)
+        if(tiles[i].first() > maxThreshold || !(tiles[i].second() <= meanThreshold))
+            large.emplace(tiles[i].first(), i);
+
+    /* If there's no tiles above thresholds, don't print anything. Happens for
+       example when a large amount of tiles is just slightly below the mean
+       threshold. */
+    if(large.empty()) return;
+
+    out << Debug::newline;
+
+    if(large.size() > maxCount)
+        out << "        Top" << maxCount << "out of" << large.size() << "tiles above max/mean threshold:";
+    else
+        out << "        Tiles above max/mean threshold:";
+
+    std::size_t count = 0;
+    for(auto it = large.crbegin(); it != large.crend(); ++it) {
+        if(++count > maxCount) break;
+
+        const Containers::Pair<Int, Int> div = Math::div(Int(it->second), tileCountX);
+        const Vector2i offset = Vector2i{div.second(), div.first()}*tileSize;
+        const Vector2i currentSize = Math::min(size - offset, tileSize);
+        const Containers::Pair<Float, Float>& tile = tiles[it->second];
+        out << Debug::newline << "          [" << Debug::nospace << offset.x()
+            << Debug::nospace << "," << Debug::nospace << offset.y()
+            << Debug::nospace << "]" << currentSize.x() << Debug::nospace
+            << "x" << Debug::nospace << currentSize.y() << "tile, max Δ ="
+            << Debug::boldColor(tile.first() > maxThreshold ?
+                Debug::Color::Red : Debug::Color::Default) << tile.first()
+            << Debug::nospace << Debug::resetColor << ", mean Δ ="
+            << Debug::boldColor(!(tile.second() <= meanThreshold) ?
+                Debug::Color::Yellow : Debug::Color::Default) << tile.second()
+            << Debug::nospace << Debug::resetColor;
+    }
+}
+
 namespace {
 
 enum class Result: UnsignedByte {
@@ -441,6 +811,7 @@ enum class Result: UnsignedByte {
     AboveThresholds,
     AboveMeanThreshold,
     AboveMaxThreshold,
+    BelowSsimThreshold,
     VerboseMessage
 };
 
@@ -481,9 +852,14 @@ class ImageComparatorBase::State {
         Containers::Optional<ImageView2D> expectedImage;
 
         Float maxThreshold, meanThreshold;
+        /* NaN if the SSIM calculation is disabled */
+        Float ssimThreshold{Constants::nan()};
+        /* Zero if the per-tile statistics are disabled */
+        Vector2i tileSize;
         Result result{};
-        Float max{}, mean{};
+        Float max{}, mean{}, ssim{};
         Containers::Array<Float> delta;
+        Containers::Array<Containers::Pair<Float, Float>> tiles;
 };
 
 ImageComparatorBase::ImageComparatorBase(PluginManager::Manager<Trade::AbstractImporter>* importerManager, PluginManager::Manager<Trade::AbstractImageConverter>* converterManager, Float maxThreshold, Float meanThreshold): _state{InPlaceInit, importerManager, converterManager, maxThreshold, meanThreshold} {
@@ -496,6 +872,18 @@ ImageComparatorBase::ImageComparatorBase(PluginManager::Manager<Trade::AbstractI
 
 ImageComparatorBase::~ImageComparatorBase() = default;
 
+void ImageComparatorBase::setTileSize(const Vector2i& size) {
+    CORRADE_ASSERT(size.x() > 0 && size.y() > 0,
+        "DebugTools::CompareImage::setTileSize(): expected a positive size, got" << Debug::packed << size, );
+    _state->tileSize = size;
+}
+
+void ImageComparatorBase::setSsimThreshold(const Float threshold) {
+    CORRADE_ASSERT(threshold >= -1.0f && threshold <= 1.0f,
+        "DebugTools::CompareImage::setSsimThreshold(): expected a value between -1 and 1, got" << threshold, );
+    _state->ssimThreshold = threshold;
+}
+
 TestSuite::ComparisonStatusFlags ImageComparatorBase::compare(const PixelFormat actualFormat, const Containers::StridedArrayView3D<const char>& actualPixels, const ImageView2D& expected) {
     /* The reference can be pointing to the storage, don't call the assignment
        on itself in that case */
@@ -527,6 +915,13 @@ TestSuite::ComparisonStatusFlags ImageComparatorBase::compare(const PixelFormat
     CORRADE_INTERNAL_ASSERT(!(_state->mean < 0.0f));
     CORRADE_INTERNAL_ASSERT(_state->max >= 0.0f && !Math::isInf(_state->max) && !Math::isNan(_state->max));
 
+    /* Calculate the structural similarity only if requested, images with
+       a zero delta are trivially similar */
+    const bool ssimEnabled = !Math::isNan(_state->ssimThreshold);
+    if(ssimEnabled)
+        _state->ssim = _state->max == 0.0f && _state->mean == 0.0f ? 1.0f :
+            DebugTools::Implementation::calculateImageSsim(actualFormat, actualPixels, expected, {8, 8});
+
     /* If both values are not above threshold, success. If the values are
        above, save the delta. If the values are below thresholds but nonzero,
        we can provide optional message -- save the delta in that case too. */
@@ -538,13 +933,19 @@ TestSuite::ComparisonStatusFlags ImageComparatorBase::compare(const PixelFormat
     /* Comparing this way in order to propely catch NaNs in mean values */
     else if(!(_state->mean <= _state->meanThreshold))
         _state->result = Result::AboveMeanThreshold;
+    /* Again comparing this way to catch NaNs */
+    else if(ssimEnabled && !(_state->ssim >= _state->ssimThreshold))
+        _state->result = Result::BelowSsimThreshold;
     else if(_state->max > 0.0f || _state->mean > 0.0f) {
         _state->result = Result::VerboseMessage;
         flags = TestSuite::ComparisonStatusFlag::Verbose;
     } else return TestSuite::ComparisonStatusFlags{};
 
-    /* Otherwise save the deltas and fail */
+    /* Otherwise save the deltas and fail. The per-tile statistics are used
+       only for the diagnostic, so calculate them only here. */
     _state->delta = Utility::move(deltaMaxMean.first());
+    if(_state->tileSize.x())
+        _state->tiles = DebugTools::Implementation::calculateTileDeltas(_state->delta, expected.size(), _state->tileSize);
     return flags;
 }
 
@@ -747,6 +1148,13 @@ void ImageComparatorBase::printMessage(const TestSuite::ComparisonStatusFlags fl
                 << "but at most" << _state->meanThreshold
                 << "expected. Max delta" << _state->max << "is within threshold"
                 << _state->maxThreshold << Debug::nospace << ".";
+        else if(_state->result == Result::BelowSsimThreshold)
+            out << "structural similarity below threshold, actual" << _state->ssim
+                << "but at least" << _state->ssimThreshold
+                << "expected. Deltas" << _state->max << Debug::nospace << "/"
+                << Debug::nospace << _state->mean << "are within threshold"
+                << _state->maxThreshold << Debug::nospace << "/"
+                << Debug::nospace << _state->meanThreshold << Debug::nospace << ".";
         else if(_state->result == Result::VerboseMessage) {
             CORRADE_INTERNAL_ASSERT(flags & TestSuite::ComparisonStatusFlag::Verbose);
             #ifdef CORRADE_NO_ASSERT
@@ -758,10 +1166,15 @@ void ImageComparatorBase::printMessage(const TestSuite::ComparisonStatusFlags fl
                 << Debug::nospace << _state->meanThreshold << Debug::nospace << ".";
         } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 
+        if(!Math::isNan(_state->ssimThreshold) && _state->result != Result::BelowSsimThreshold)
+            out << "Structural similarity" << _state->ssim << Debug::nospace << ".";
+
         out << "Delta image:" << Debug::newline;
         DebugTools::Implementation::printDeltaImage(out, _state->delta, _state->expectedImage->size(), _state->max, _state->maxThreshold, _state->meanThreshold);
         CORRADE_INTERNAL_ASSERT(_state->actualFormat == _state->expectedImage->format());
         DebugTools::Implementation::printPixelDeltas(out, _state->delta, _state->actualFormat, _state->actualPixels, _state->expectedImage->pixels(), _state->maxThreshold, _state->meanThreshold, 10);
+        if(!_state->tiles.isEmpty())
+            DebugTools::Implementation::printTileDeltas(out, _state->tiles, _state->expectedImage->size(), _state->tileSize, _state->maxThreshold, _state->meanThreshold, 10);
     }
 }
 
@@ -54,6 +54,12 @@ namespace Implementation {
     MAGNUM_DEBUGTOOLS_EXPORT void printDeltaImage(Debug& out, Containers::ArrayView<const Float> delta, const Vector2i& size, Float max, Float maxThreshold, Float meanThreshold);
 
     MAGNUM_DEBUGTOOLS_EXPORT void printPixelDeltas(Debug& out, Containers::ArrayView<const Float> delta, PixelFormat format, const Containers::StridedArrayView3D<const char>& actualPixels, const Containers::StridedArrayView3D<const char>& expectedPixels, Float maxThreshold, Float meanThreshold, std::size_t maxCount);
+
+    MAGNUM_DEBUGTOOLS_EXPORT Float calculateImageSsim(PixelFormat actualFormat, const Containers::StridedArrayView3D<const char>& actualPixels, const ImageView2D& expected, const Vector2i& windowSize);
+
+    MAGNUM_DEBUGTOOLS_EXPORT Containers::Array<Containers::Pair<Float, Float>> calculateTileDeltas(Containers::ArrayView<const Float> delta, const Vector2i& size, const Vector2i& tileSize);
+
+    MAGNUM_DEBUGTOOLS_EXPORT void printTileDeltas(Debug& out, Containers::ArrayView<const Containers::Pair<Float, Float>> tiles, const Vector2i& size, const Vector2i& tileSize, Float maxThreshold, Float meanThreshold, std::size_t maxCount);
 }
 
 class CompareImage;
@@ -97,6 +103,10 @@ class MAGNUM_DEBUGTOOLS_EXPORT ImageComparatorBase {
 
         void saveDiagnostic(TestSuite::ComparisonStatusFlags flags, Utility::Debug& out, Containers::StringView path);
 
+        void setTileSize(const Vector2i& size);
+
+        void setSsimThreshold(Float threshold);
+
     private:
         class State;
         Containers::Pointer<State> _state;
@@ -338,6 +348,30 @@ comparison fails the same way as if comparing two views of different pixel
 formats. Byte and short color types always autodetect to normalized (sRGB)
 pixel formats, never to integer formats.
 
+@section DebugTools-CompareImage-tiles Per-tile statistics and structural similarity
+
+For large images, the delta image and the list of top pixel deltas may not be
+enough to quickly see which parts of the image differ. With
+@ref setTileSize(), the delta is additionally aggregated into tiles of given
+size and the diagnostic for a failed comparison lists tiles which have their
+max or mean delta above the thresholds, sorted by the max delta:
+
+@snippet DebugTools.cpp CompareImage-tiles
+
+The per-tile statistics are calculated from the already calculated per-pixel
+delta, only if the comparison fails or prints a verbose message.
+
+With @ref setSsimThreshold(), the comparator additionally calculates a
+structural similarity index (SSIM) of the two images and fails if it's below
+given threshold. The index is calculated on channel averages in
+non-overlapping @f$ 8 \times 8 @f$ windows, which are then averaged. The
+values are taken unnormalized, same as for the delta, with the dynamic range
+being the full range of given type for integer formats and @cpp 1.0f @ce for
+floating-point formats. It's calculated in a single pass over both images and
+only if the images aren't bitwise identical. Unlike with the delta, NaN and
+infinity values in the images result in a NaN index, which makes the
+comparison fail.
+
 @see @ref CompareMaterial
 */
 class CompareImage {
@@ -359,6 +393,37 @@ class CompareImage {
          */
         explicit CompareImage(): _c{0.0f, 0.0f} {}
 
+        /**
+         * @brief Set tile size for per-tile statistics
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that both components are positive. By default, per-tile
+         * statistics aren't calculated. See
+         * @ref DebugTools-CompareImage-tiles for more information.
+         */
+        CompareImage& setTileSize(const Vector2i& size) {
+            _c.setTileSize(size);
+            return *this;
+        }
+
+        /**
+         * @brief Set structural similarity threshold
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * If the structural similarity index of the two images is below this
+         * value, the comparison fails. Expects that the value is between
+         * @cpp -1.0f @ce and @cpp 1.0f @ce, pass @cpp -1.0f @ce to only have
+         * the index reported in the diagnostic without affecting the
+         * comparison result. By default, the index isn't calculated. See
+         * @ref DebugTools-CompareImage-tiles for more information.
+         */
+        CompareImage& setSsimThreshold(Float threshold) {
+            _c.setSsimThreshold(threshold);
+            return *this;
+        }
+
         #ifndef DOXYGEN_GENERATING_OUTPUT
         TestSuite::Comparator<CompareImage>& comparator() {
             return _c;
@@ -474,6 +539,30 @@ class CompareImageFile {
          */
         explicit CompareImageFile(): _c{nullptr, nullptr, 0.0f, 0.0f} {}
 
+        /**
+         * @brief Set tile size for per-tile statistics
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * See @ref CompareImage::setTileSize() for more information.
+         */
+        CompareImageFile& setTileSize(const Vector2i& size) {
+            _c.setTileSize(size);
+            return *this;
+        }
+
+        /**
+         * @brief Set structural similarity threshold
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * See @ref CompareImage::setSsimThreshold() for more information.
+         */
+        CompareImageFile& setSsimThreshold(Float threshold) {
+            _c.setSsimThreshold(threshold);
+            return *this;
+        }
+
         #ifndef DOXYGEN_GENERATING_OUTPUT
         TestSuite::Comparator<CompareImageFile>& comparator() {
             return _c;
@@ -546,6 +635,30 @@ class CompareImageToFile {
          */
         explicit CompareImageToFile(): _c{nullptr, nullptr, 0.0f, 0.0f} {}
 
+        /**
+         * @brief Set tile size for per-tile statistics
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * See @ref CompareImage::setTileSize() for more information.
+         */
+        CompareImageToFile& setTileSize(const Vector2i& size) {
+            _c.setTileSize(size);
+            return *this;
+        }
+
+        /**
+         * @brief Set structural similarity threshold
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * See @ref CompareImage::setSsimThreshold() for more information.
+         */
+        CompareImageToFile& setSsimThreshold(Float threshold) {
+            _c.setSsimThreshold(threshold);
+            return *this;
+        }
+
         #ifndef DOXYGEN_GENERATING_OUTPUT
         TestSuite::Comparator<CompareImageToFile>& comparator() {
             return _c;
@@ -601,6 +714,30 @@ class CompareFileToImage {
          */
         explicit CompareFileToImage(): _c{nullptr, 0.0f, 0.0f} {}
 
+        /**
+         * @brief Set tile size for per-tile statistics
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * See @ref CompareImage::setTileSize() for more information.
+         */
+        CompareFileToImage& setTileSize(const Vector2i& size) {
+            _c.setTileSize(size);
+            return *this;
+        }
+
+        /**
+         * @brief Set structural similarity threshold
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * See @ref CompareImage::setSsimThreshold() for more information.
+         */
+        CompareFileToImage& setSsimThreshold(Float threshold) {
+            _c.setSsimThreshold(threshold);
+            return *this;
+        }
+
         #ifndef DOXYGEN_GENERATING_OUTPUT
         TestSuite::Comparator<CompareFileToImage>& comparator() {
             return _c;
@@ -43,6 +43,7 @@ namespace Magnum { namespace DebugTools {
 class CORRADE_DEPRECATED("use FrameProfiler instead") Profiler;
 #endif
 class FrameProfiler;
+class ScopeProfiler;
 
 #ifdef MAGNUM_TARGET_GL
 class FrameProfilerGL;
@@ -60,6 +61,14 @@ typedef ObjectRenderer<2> ObjectRenderer2D;
 typedef ObjectRenderer<3> ObjectRenderer3D;
 class ObjectRendererOptions;
 
+#if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+class OcclusionCuller;
+#endif
+
+template<UnsignedInt> class RendererBatch;
+typedef RendererBatch<2> RendererBatch2D;
+typedef RendererBatch<3> RendererBatch3D;
+
 class ResourceManager;
 #endif
 
@@ -31,6 +31,8 @@
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/Shaders/FlatGL.h"
 
+#include "Magnum/DebugTools/RendererBatch.h"
+#include "Magnum/DebugTools/Implementation/ForceRendererMesh.h"
 #include "Magnum/DebugTools/Implementation/ForceRendererTransformation.h"
 
 namespace Magnum { namespace DebugTools {
@@ -41,19 +43,6 @@ template<UnsignedInt dimensions> ResourceKey shaderKey();
 template<> inline ResourceKey shaderKey<2>() { return ResourceKey("FlatShader2D"); }
 template<> inline ResourceKey shaderKey<3>() { return ResourceKey("FlatShader3D"); }
 
-constexpr Vector2 positions[]{
-    {0.0f,  0.0f},
-    {1.0f,  0.0f},
-    {0.9f,  0.1f},
-    {0.9f, -0.1f}
-};
-
-constexpr UnsignedByte indices[]{
-    0, 1,
-    1, 2,
-    1, 3
-};
-
 }
 
 template<UnsignedInt dimensions> ForceRenderer<dimensions>::ForceRenderer(ResourceManager& manager, SceneGraph::AbstractObject<dimensions, Float>& object, const VectorTypeFor<dimensions, Float>& forcePosition, const VectorTypeFor<dimensions, Float>& force, ResourceKey options, SceneGraph::DrawableGroup<dimensions, Float>* drawables): SceneGraph::Drawable<dimensions, Float>(object, drawables), _forcePosition(forcePosition), _force(force), _options(manager.get<ForceRendererOptions>(options)) {
@@ -67,22 +56,36 @@ template<UnsignedInt dimensions> ForceRenderer<dimensions>::ForceRenderer(Resour
 
     /* Create the mesh */
     GL::Buffer vertexBuffer{GL::Buffer::TargetHint::Array};
-    vertexBuffer.setData(positions, GL::BufferUsage::StaticDraw);
+    vertexBuffer.setData(Implementation::ForceRendererPositions, GL::BufferUsage::StaticDraw);
     GL::Buffer indexBuffer{GL::Buffer::TargetHint::ElementArray};
-    indexBuffer.setData(indices, GL::BufferUsage::StaticDraw);
+    indexBuffer.setData(Implementation::ForceRendererIndices, GL::BufferUsage::StaticDraw);
     GL::Mesh mesh{GL::MeshPrimitive::Lines};
-    mesh.setCount(Containers::arraySize(indices))
+    mesh.setCount(Containers::arraySize(Implementation::ForceRendererIndices))
         .addVertexBuffer(std::move(vertexBuffer), 0,
             typename Shaders::FlatGL<dimensions>::Position(Shaders::FlatGL<dimensions>::Position::Components::Two))
-        .setIndexBuffer(std::move(indexBuffer), 0, GL::MeshIndexType::UnsignedByte, 0, Containers::arraySize(positions));
+        .setIndexBuffer(std::move(indexBuffer), 0, GL::MeshIndexType::UnsignedByte, 0, Containers::arraySize(Implementation::ForceRendererPositions));
     manager.set(_mesh.key(), std::move(mesh), ResourceDataState::Final, ResourcePolicy::Manual);
 }
 
 /* To avoid deleting pointers to incomplete type on destruction of Resource members */
 template<UnsignedInt dimensions> ForceRenderer<dimensions>::~ForceRenderer() = default;
 
+template<UnsignedInt dimensions> ForceRenderer<dimensions>& ForceRenderer<dimensions>::setBatch(RendererBatch<dimensions>* batch) {
+    _batch = batch;
+    return *this;
+}
+
 template<UnsignedInt dimensions> void ForceRenderer<dimensions>::draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::Camera<dimensions, Float>& camera) {
-    _shader->setTransformationProjectionMatrix(camera.projectionMatrix()*Implementation::forceRendererTransformation<dimensions>(transformationMatrix.transformPoint(_forcePosition), _force)*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{_options->size()}))
+    const MatrixTypeFor<dimensions, Float> transformation = Implementation::forceRendererTransformation<dimensions>(transformationMatrix.transformPoint(_forcePosition), _force)*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{_options->size()});
+
+    /* If batched, only record the instance, RendererBatch::draw() then
+       submits all of them at once */
+    if(_batch) {
+        _batch->addForce(transformation, _options->color());
+        return;
+    }
+
+    _shader->setTransformationProjectionMatrix(camera.projectionMatrix()*transformation)
         .setColor(_options->color())
         .draw(*_mesh);
 }
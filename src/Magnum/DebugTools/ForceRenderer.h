@@ -156,6 +156,29 @@ template<UnsignedInt dimensions> class ForceRenderer: public SceneGraph::Drawabl
 
         ~ForceRenderer();
 
+        /**
+         * @brief Draw into a batch instead of drawing directly
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * If set to a non-null value, drawing this renderer through a camera
+         * only records its transformation and color into @p batch, which then
+         * draws all recorded instances with a single instanced draw call in
+         * @ref RendererBatch::draw(). The batch is expected to outlive the
+         * renderer or be reset back to @cpp nullptr @ce before it's
+         * destroyed. Default is @cpp nullptr @ce. See
+         * @ref DebugTools-RendererBatch-usage for an example.
+         */
+        ForceRenderer<dimensions>& setBatch(RendererBatch<dimensions>* batch);
+
+        /**
+         * @brief Batch the renderer draws into
+         * @m_since_latest
+         *
+         * If @cpp nullptr @ce, the renderer draws directly.
+         */
+        RendererBatch<dimensions>* batch() const { return _batch; }
+
     private:
         void draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::Camera<dimensions, Float>& camera) override;
 
@@ -165,6 +188,7 @@ template<UnsignedInt dimensions> class ForceRenderer: public SceneGraph::Drawabl
         Resource<ForceRendererOptions> _options;
         Resource<GL::AbstractShaderProgram, Shaders::FlatGL<dimensions>> _shader;
         Resource<GL::Mesh> _mesh;
+        RendererBatch<dimensions>* _batch{};
 };
 
 /** @brief Two-dimensional force renderer */
@@ -27,6 +27,7 @@
 #include "FrameProfiler.h"
 
 #include <chrono>
+#include <cstring>
 #include <sstream>
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Containers/GrowableArray.h>
@@ -38,11 +39,20 @@
 
 #include "Magnum/Math/Functions.h"
 #ifdef MAGNUM_TARGET_GL
+#include "Magnum/GL/Context.h"
 #include "Magnum/GL/TimeQuery.h"
 #ifndef MAGNUM_TARGET_GLES
 #include "Magnum/GL/PipelineStatisticsQuery.h"
 #endif
 #endif
+#ifdef MAGNUM_TARGET_VK
+#include "Magnum/Vk/CommandBuffer.h"
+#include "Magnum/Vk/Device.h"
+#include "Magnum/Vk/DeviceFeatures.h"
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/Pipeline.h"
+#include "Magnum/Vk/QueryPoolCreateInfo.h"
+#endif
 
 namespace Magnum { namespace DebugTools {
 
@@ -73,15 +83,21 @@ FrameProfiler::FrameProfiler(FrameProfiler&& other) noexcept:
     #ifndef CORRADE_NO_ASSERT
     _beginFrameCalled{other._beginFrameCalled},
     #endif
+    _histogramEnabled{other._histogramEnabled},
     _maxFrameCount{other._maxFrameCount},
     _measuredFrameCount{other._measuredFrameCount},
     _measurements{Utility::move(other._measurements)},
-    _data{Utility::move(other._data)}
+    _data{Utility::move(other._data)},
+    _histogram{Utility::move(other._histogram)},
+    _histogramStatistics{Utility::move(other._histogramStatistics)}
 {
     /* For all state pointers that point to &other patch them to point to this
        instead, to account for 90% of use cases of derived classes */
     for(Measurement& measurement: _measurements)
         if(measurement._state == &other) measurement._state = this;
+
+    /* The histogram arrays are gone from the other instance */
+    other._histogramEnabled = false;
 }
 
 FrameProfiler& FrameProfiler::operator=(FrameProfiler&& other) noexcept {
@@ -93,7 +109,10 @@ FrameProfiler& FrameProfiler::operator=(FrameProfiler&& other) noexcept {
     swap(_maxFrameCount, other._maxFrameCount);
     swap(_measuredFrameCount, other._measuredFrameCount);
     swap(_measurements, other._measurements);
+    swap(_histogramEnabled, other._histogramEnabled);
     swap(_data, other._data);
+    swap(_histogram, other._histogram);
+    swap(_histogramStatistics, other._histogramStatistics);
 
     /* For all state pointers that point to &other patch them to point to this
        instead, to account for 90% of use cases of derived classes */
@@ -115,6 +134,13 @@ void FrameProfiler::setup(Containers::Array<Measurement>&& measurements, const U
     _measurements = Utility::move(measurements);
     arrayReserve(_data, maxFrameCount*_measurements.size());
 
+    /* Reallocate the histogram only if the measurement count changed, to
+       allow keeping data across setups of the same measurements */
+    if(_histogramEnabled && _histogramStatistics.size() != 2*_measurements.size()) {
+        _histogram = Containers::Array<UnsignedInt>{ValueInit, HistogramBucketCount*_measurements.size()};
+        _histogramStatistics = Containers::Array<UnsignedLong>{ValueInit, 2*_measurements.size()};
+    }
+
     #ifndef CORRADE_NO_ASSERT
     for(const Measurement& measurement: _measurements) {
         /* Max frame count is always >= 1, so even if _delay is 0 the condition
@@ -171,6 +197,28 @@ void FrameProfiler::beginFrame() {
     }
 }
 
+namespace {
+
+/* Values below 16 have a bucket each, larger are split into 16 sub-buckets
+   for each power of two. See the class docs for details. */
+UnsignedInt histogramBucket(const UnsignedLong value) {
+    if(value < 16) return UnsignedInt(value);
+    const UnsignedInt log2 = value >> 32 ?
+        32 + Math::log2(UnsignedInt(value >> 32)) :
+        Math::log2(UnsignedInt(value));
+    return (log2 - 3)*16 + UnsignedInt(value >> (log2 - 4)) - 16;
+}
+
+UnsignedLong histogramBucketUpperBound(const UnsignedInt bucket) {
+    if(bucket < 16) return bucket;
+    const UnsignedInt shift = bucket/16 - 1;
+    /* For the last bucket the shift overflows to 0 and the subtraction wraps
+       around to the largest 64-bit value, which is what we want */
+    return (UnsignedLong(17 + bucket%16) << shift) - 1;
+}
+
+}
+
 UnsignedInt FrameProfiler::delayedCurrentData(UnsignedInt delay) const {
     CORRADE_INTERNAL_ASSERT(delay >= 1);
     return (_measuredFrameCount - delay) % _maxFrameCount;
@@ -233,6 +281,12 @@ void FrameProfiler::endFrame() {
             const UnsignedLong data = _data[delayedCurrentData(measurementDelay)*_measurements.size() + i];
             CORRADE_INTERNAL_ASSERT(_measurements[i]._movingSum + data >= _measurements[i]._movingSum);
             _measurements[i]._movingSum += data;
+
+            if(_histogramEnabled) {
+                ++_histogram[i*HistogramBucketCount + histogramBucket(data)];
+                ++_histogramStatistics[2*i + 0];
+                _histogramStatistics[2*i + 1] = Math::max(_histogramStatistics[2*i + 1], data);
+            }
         }
     }
 }
@@ -275,6 +329,126 @@ UnsignedLong FrameProfiler::measurementData(const UnsignedInt id, const Unsigned
     return _data[((_measuredFrameCount - Math::min(_maxFrameCount + Math::max(_measurements[id]._delay, 1u) - 1, _measuredFrameCount) + frame) % _maxFrameCount)*_measurements.size() + id];
 }
 
+void FrameProfiler::enableHistogram() {
+    if(_histogramEnabled) return;
+
+    _histogramEnabled = true;
+    _histogram = Containers::Array<UnsignedInt>{ValueInit, HistogramBucketCount*_measurements.size()};
+    _histogramStatistics = Containers::Array<UnsignedLong>{ValueInit, 2*_measurements.size()};
+}
+
+void FrameProfiler::disableHistogram() {
+    _histogramEnabled = false;
+    _histogram = nullptr;
+    _histogramStatistics = nullptr;
+}
+
+void FrameProfiler::resetHistogram() {
+    CORRADE_ASSERT(_histogramEnabled,
+        "DebugTools::FrameProfiler::resetHistogram(): histogram not enabled", );
+
+    for(UnsignedInt& i: _histogram) i = 0;
+    for(UnsignedLong& i: _histogramStatistics) i = 0;
+}
+
+UnsignedLong FrameProfiler::histogramSampleCount(const UnsignedInt id) const {
+    CORRADE_ASSERT(_histogramEnabled,
+        "DebugTools::FrameProfiler::histogramSampleCount(): histogram not enabled", {});
+    CORRADE_ASSERT(id < _measurements.size(),
+        "DebugTools::FrameProfiler::histogramSampleCount(): index" << id << "out of range for" << _measurements.size() << "measurements", {});
+    return _histogramStatistics[2*id + 0];
+}
+
+UnsignedLong FrameProfiler::histogramMax(const UnsignedInt id) const {
+    CORRADE_ASSERT(_histogramEnabled,
+        "DebugTools::FrameProfiler::histogramMax(): histogram not enabled", {});
+    CORRADE_ASSERT(id < _measurements.size(),
+        "DebugTools::FrameProfiler::histogramMax(): index" << id << "out of range for" << _measurements.size() << "measurements", {});
+    return _histogramStatistics[2*id + 1];
+}
+
+UnsignedLong FrameProfiler::histogramPercentile(const UnsignedInt id, const Float percentile) const {
+    CORRADE_ASSERT(_histogramEnabled,
+        "DebugTools::FrameProfiler::histogramPercentile(): histogram not enabled", {});
+    CORRADE_ASSERT(id < _measurements.size(),
+        "DebugTools::FrameProfiler::histogramPercentile(): index" << id << "out of range for" << _measurements.size() << "measurements", {});
+    CORRADE_ASSERT(percentile >= 0.0f && percentile <= 100.0f,
+        "DebugTools::FrameProfiler::histogramPercentile(): expected percentile to be between 0 and 100 but got" << percentile, {});
+    const UnsignedLong sampleCount = _histogramStatistics[2*id + 0];
+    CORRADE_ASSERT(sampleCount,
+        "DebugTools::FrameProfiler::histogramPercentile(): no samples recorded for measurement" << id, {});
+
+    /* Find the first bucket where the cumulative count reaches given fraction
+       of all samples, always at least one sample */
+    const UnsignedLong target = Math::max(UnsignedLong(Math::ceil(sampleCount*Double(percentile)/100.0)), UnsignedLong{1});
+    const UnsignedLong max = _histogramStatistics[2*id + 1];
+    UnsignedLong cumulative = 0;
+    for(UnsignedInt i = 0; i != HistogramBucketCount; ++i) {
+        cumulative += _histogram[id*HistogramBucketCount + i];
+        if(cumulative >= target) {
+            const UnsignedLong upperBound = histogramBucketUpperBound(i);
+            return Math::min(upperBound, max);
+        }
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+namespace {
+
+/* See the class docs for the format description */
+struct HistogramSnapshotHeader {
+    char magic[4];
+    UnsignedInt version;
+    UnsignedInt measurementCount;
+    UnsignedInt bucketCount;
+};
+
+struct HistogramSnapshotMeasurement {
+    UnsignedLong sampleCount;
+    UnsignedLong max;
+    UnsignedInt units;
+    UnsignedInt padding;
+};
+
+static_assert(sizeof(HistogramSnapshotHeader) == 16 && sizeof(HistogramSnapshotMeasurement) == 24 && FrameProfiler::HistogramBucketCount*4 % 8 == 0,
+    "snapshot layout not tightly packed");
+
+}
+
+std::size_t FrameProfiler::histogramSnapshotSize() const {
+    return sizeof(HistogramSnapshotHeader) + _measurements.size()*(sizeof(HistogramSnapshotMeasurement) + HistogramBucketCount*sizeof(UnsignedInt));
+}
+
+void FrameProfiler::histogramSnapshotInto(const Containers::ArrayView<char> destination) const {
+    CORRADE_ASSERT(_histogramEnabled,
+        "DebugTools::FrameProfiler::histogramSnapshotInto(): histogram not enabled", );
+    CORRADE_ASSERT(destination.size() == histogramSnapshotSize(),
+        "DebugTools::FrameProfiler::histogramSnapshotInto(): expected a view with" << histogramSnapshotSize() << "bytes but got" << destination.size(), );
+
+    /* Using memcpy to not need the destination to be aligned */
+    char* out = destination.data();
+    const HistogramSnapshotHeader header{{'M', 'F', 'P', 'H'}, 1, UnsignedInt(_measurements.size()), HistogramBucketCount};
+    std::memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+    for(std::size_t i = 0; i != _measurements.size(); ++i) {
+        const HistogramSnapshotMeasurement measurement{
+            _histogramStatistics[2*i + 0],
+            _histogramStatistics[2*i + 1],
+            UnsignedInt(_measurements[i]._units), 0};
+        std::memcpy(out, &measurement, sizeof(measurement));
+        out += sizeof(measurement);
+        std::memcpy(out, _histogram.data() + i*HistogramBucketCount, HistogramBucketCount*sizeof(UnsignedInt));
+        out += HistogramBucketCount*sizeof(UnsignedInt);
+    }
+}
+
+Containers::Array<char> FrameProfiler::histogramSnapshot() const {
+    Containers::Array<char> out{NoInit, histogramSnapshotSize()};
+    histogramSnapshotInto(out);
+    return out;
+}
+
 Double FrameProfiler::measurementMeanInternal(const Measurement& measurement) const {
     return Double(measurement._movingSum)/
         Math::min(_measuredFrameCount - Math::max(measurement._delay, 1u) + 1, _maxFrameCount);
@@ -432,6 +606,46 @@ Debug& operator<<(Debug& debug, const FrameProfiler::Units value) {
 }
 
 #ifdef MAGNUM_TARGET_GL
+namespace {
+
+/* Values taken from GL::Context::statistics(), in the order of their bits */
+constexpr struct {
+    FrameProfilerGL::Value value;
+    const char* name;
+    FrameProfiler::Units units;
+    UnsignedLong GL::Context::Statistics::*counter;
+} FrameProfilerGLStatisticsValues[]{
+    {FrameProfilerGL::Value::DrawCount, "Draw calls",
+        FrameProfiler::Units::Count,
+        &GL::Context::Statistics::drawCount},
+    {FrameProfilerGL::Value::BindCount, "Binds",
+        FrameProfiler::Units::Count,
+        &GL::Context::Statistics::bindCount},
+    {FrameProfilerGL::Value::BindSkippedCount, "Skipped binds",
+        FrameProfiler::Units::Count,
+        &GL::Context::Statistics::bindSkippedCount},
+    {FrameProfilerGL::Value::ShaderProgramSwitchCount, "Shader program switches",
+        FrameProfiler::Units::Count,
+        &GL::Context::Statistics::shaderProgramSwitchCount},
+    {FrameProfilerGL::Value::TextureSwitchCount, "Texture switches",
+        FrameProfiler::Units::Count,
+        &GL::Context::Statistics::textureSwitchCount},
+    {FrameProfilerGL::Value::BufferUploadCount, "Buffer uploads",
+        FrameProfiler::Units::Count,
+        &GL::Context::Statistics::bufferUploadCount},
+    {FrameProfilerGL::Value::BufferUploadSize, "Buffer upload size",
+        FrameProfiler::Units::Bytes,
+        &GL::Context::Statistics::bufferUploadSize},
+    {FrameProfilerGL::Value::InvalidatedAttachmentCount, "Invalidated attachments",
+        FrameProfiler::Units::Count,
+        &GL::Context::Statistics::invalidatedAttachmentCount},
+    {FrameProfilerGL::Value::InvalidatedPixelCount, "Invalidated pixels",
+        FrameProfiler::Units::Count,
+        &GL::Context::Statistics::invalidatedPixelCount},
+};
+
+}
+
 struct FrameProfilerGL::State {
     UnsignedShort cpuDurationIndex = 0xffff,
         gpuDurationIndex = 0xffff,
@@ -443,6 +657,16 @@ struct FrameProfilerGL::State {
     UnsignedLong frameTimeStartFrame[2];
     UnsignedLong cpuDurationStartFrame;
 
+    enum: std::size_t { StatisticsCount = Containers::arraySize(FrameProfilerGLStatisticsValues) };
+    UnsignedShort statisticsIndices[StatisticsCount]{0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff};
+    /* Counter values at the beginning of a frame. Each measurement gets a
+       pointer to its own item as the state so the lambdas don't need to know
+       which counter they measure. */
+    struct StatisticsCounter {
+        UnsignedLong GL::Context::Statistics::*counter;
+        UnsignedLong start;
+    } statisticsCounters[StatisticsCount];
+
     enum: std::size_t { QueryCount = 3 };
     Containers::StaticArray<QueryCount, GL::TimeQuery> timeQueries{DirectInit, NoCreate};
     #ifndef MAGNUM_TARGET_GLES
@@ -451,6 +675,20 @@ struct FrameProfilerGL::State {
     Containers::StaticArray<QueryCount, GL::PipelineStatisticsQuery> clippingInputPrimitivesQueries{DirectInit, NoCreate};
     Containers::StaticArray<QueryCount, GL::PipelineStatisticsQuery> clippingOutputPrimitivesQueries{DirectInit, NoCreate};
     #endif
+
+    /* Each GPU scope measurement gets a pointer to its own item as the state,
+       similarly to statistics counters */
+    struct GpuScope {
+        Containers::StaticArray<QueryCount, GL::TimeQuery> beginQueries{DirectInit, NoCreate};
+        Containers::StaticArray<QueryCount, GL::TimeQuery> endQueries{DirectInit, NoCreate};
+        /* Index passed to the measurement begin function in this frame */
+        UnsignedInt current{};
+        /* Bit i set if the begin / end timestamp was recorded into query i
+           in the frame that used it */
+        UnsignedByte begun{}, ended{};
+    };
+    UnsignedShort gpuScopesIndex = 0xffff;
+    Containers::Array<GpuScope> gpuScopes;
 };
 
 FrameProfilerGL::FrameProfilerGL(): _state{InPlaceInit} {}
@@ -460,6 +698,13 @@ FrameProfilerGL::FrameProfilerGL(const Values values, const UnsignedInt maxFrame
     setup(values, maxFrameCount);
 }
 
+FrameProfilerGL::FrameProfilerGL(const Values values, const Containers::ArrayView<const Containers::StringView> gpuScopes, const UnsignedInt maxFrameCount): FrameProfilerGL{}
+{
+    setup(values, gpuScopes, maxFrameCount);
+}
+
+FrameProfilerGL::FrameProfilerGL(const Values values, const std::initializer_list<Containers::StringView> gpuScopes, const UnsignedInt maxFrameCount): FrameProfilerGL{values, Containers::arrayView(gpuScopes), maxFrameCount} {}
+
 FrameProfilerGL::FrameProfilerGL(FrameProfilerGL&&) noexcept = default;
 
 FrameProfilerGL& FrameProfilerGL::operator=(FrameProfilerGL&&) noexcept = default;
@@ -467,6 +712,14 @@ FrameProfilerGL& FrameProfilerGL::operator=(FrameProfilerGL&&) noexcept = defaul
 FrameProfilerGL::~FrameProfilerGL() = default;
 
 void FrameProfilerGL::setup(const Values values, const UnsignedInt maxFrameCount) {
+    setup(values, Containers::ArrayView<const Containers::StringView>{}, maxFrameCount);
+}
+
+void FrameProfilerGL::setup(const Values values, const std::initializer_list<Containers::StringView> gpuScopes, const UnsignedInt maxFrameCount) {
+    setup(values, Containers::arrayView(gpuScopes), maxFrameCount);
+}
+
+void FrameProfilerGL::setup(const Values values, const Containers::ArrayView<const Containers::StringView> gpuScopes, const UnsignedInt maxFrameCount) {
     UnsignedShort index = 0;
     Containers::Array<Measurement> measurements;
     if(values & Value::FrameTime) {
@@ -582,9 +835,91 @@ void FrameProfilerGL::setup(const Values values, const UnsignedInt maxFrameCount
         _state->primitiveClipRatioIndex = index++;
     }
     #endif
+    for(std::size_t i = 0; i != State::StatisticsCount; ++i) {
+        if(!(values & FrameProfilerGLStatisticsValues[i].value)) {
+            _state->statisticsIndices[i] = 0xffff;
+            continue;
+        }
+
+        _state->statisticsCounters[i].counter = FrameProfilerGLStatisticsValues[i].counter;
+        arrayAppend(measurements, InPlaceInit,
+            Containers::StringView{FrameProfilerGLStatisticsValues[i].name, Containers::StringViewFlag::Global},
+            FrameProfilerGLStatisticsValues[i].units,
+            [](void* state) {
+                auto& counter = *static_cast<State::StatisticsCounter*>(state);
+                counter.start = GL::Context::current().statistics().*counter.counter;
+            },
+            [](void* state) {
+                auto& counter = *static_cast<State::StatisticsCounter*>(state);
+                return GL::Context::current().statistics().*counter.counter - counter.start;
+            }, &_state->statisticsCounters[i]);
+        _state->statisticsIndices[i] = index++;
+    }
+
+    /* The array is allocated upfront so the state pointers stay stable */
+    _state->gpuScopes = Containers::Array<State::GpuScope>{ValueInit, gpuScopes.size()};
+    _state->gpuScopesIndex = gpuScopes.isEmpty() ? 0xffff : index;
+    for(std::size_t i = 0; i != gpuScopes.size(); ++i) {
+        State::GpuScope& scope = _state->gpuScopes[i];
+        for(GL::TimeQuery& q: scope.beginQueries)
+            q = GL::TimeQuery{GL::TimeQuery::Target::Timestamp};
+        for(GL::TimeQuery& q: scope.endQueries)
+            q = GL::TimeQuery{GL::TimeQuery::Target::Timestamp};
+        arrayAppend(measurements, InPlaceInit,
+            gpuScopes[i], Units::Nanoseconds,
+            UnsignedInt(scope.beginQueries.size()),
+            [](void* state, UnsignedInt current) {
+                /* The timestamps are recorded by beginGpuScope() and
+                   endGpuScope(), here just remember which queries to use */
+                auto& scope = *static_cast<State::GpuScope*>(state);
+                scope.current = current;
+                scope.begun &= ~(1 << current);
+                scope.ended &= ~(1 << current);
+            },
+            [](void*, UnsignedInt) {},
+            [](void* state, UnsignedInt previous, UnsignedInt) {
+                /* If the scope wasn't entered in given frame, the queries
+                   don't have any result. Report a zero duration. */
+                auto& scope = *static_cast<State::GpuScope*>(state);
+                if(!(scope.begun & scope.ended & (1 << previous)))
+                    return UnsignedLong{};
+
+                /* Guard against an underflow if the scope got ended before
+                   it was begun */
+                const auto begin = scope.beginQueries[previous].result<UnsignedLong>();
+                const auto end = scope.endQueries[previous].result<UnsignedLong>();
+                return end > begin ? end - begin : UnsignedLong{};
+            }, &scope);
+        ++index;
+    }
+
     setup(Utility::move(measurements), maxFrameCount);
 }
 
+UnsignedInt FrameProfilerGL::gpuScopeCount() const {
+    return _state->gpuScopes.size();
+}
+
+void FrameProfilerGL::beginGpuScope(const UnsignedInt id) {
+    CORRADE_ASSERT(id < _state->gpuScopes.size(),
+        "DebugTools::FrameProfilerGL::beginGpuScope(): index" << id << "out of range for" << _state->gpuScopes.size() << "GPU scopes", );
+    if(!isEnabled()) return;
+
+    State::GpuScope& scope = _state->gpuScopes[id];
+    scope.beginQueries[scope.current].timestamp();
+    scope.begun |= 1 << scope.current;
+}
+
+void FrameProfilerGL::endGpuScope(const UnsignedInt id) {
+    CORRADE_ASSERT(id < _state->gpuScopes.size(),
+        "DebugTools::FrameProfilerGL::endGpuScope(): index" << id << "out of range for" << _state->gpuScopes.size() << "GPU scopes", );
+    if(!isEnabled()) return;
+
+    State::GpuScope& scope = _state->gpuScopes[id];
+    scope.endQueries[scope.current].timestamp();
+    scope.ended |= 1 << scope.current;
+}
+
 auto FrameProfilerGL::values() const -> Values {
     Values values;
     if(_state->frameTimeIndex != 0xffff) values |= Value::FrameTime;
@@ -594,10 +929,13 @@ auto FrameProfilerGL::values() const -> Values {
     if(_state->vertexFetchRatioIndex != 0xffff) values |= Value::VertexFetchRatio;
     if(_state->primitiveClipRatioIndex != 0xffff) values |= Value::PrimitiveClipRatio;
     #endif
+    for(std::size_t i = 0; i != State::StatisticsCount; ++i)
+        if(_state->statisticsIndices[i] != 0xffff)
+            values |= FrameProfilerGLStatisticsValues[i].value;
     return values;
 }
 
-bool FrameProfilerGL::isMeasurementAvailable(const Value value) const {
+UnsignedShort FrameProfilerGL::measurementIndex(const Value value) const {
     const UnsignedShort* index = nullptr;
     switch(value) {
         case Value::FrameTime: index = &_state->frameTimeIndex; break;
@@ -607,11 +945,48 @@ bool FrameProfilerGL::isMeasurementAvailable(const Value value) const {
         case Value::VertexFetchRatio: index = &_state->vertexFetchRatioIndex; break;
         case Value::PrimitiveClipRatio: index = &_state->primitiveClipRatioIndex; break;
         #endif
+        case Value::DrawCount:
+        case Value::BindCount:
+        case Value::BindSkippedCount:
+        case Value::ShaderProgramSwitchCount:
+        case Value::TextureSwitchCount:
+        case Value::BufferUploadCount:
+        case Value::BufferUploadSize:
+        case Value::InvalidatedAttachmentCount:
+        case Value::InvalidatedPixelCount:
+            for(std::size_t i = 0; i != State::StatisticsCount; ++i)
+                if(FrameProfilerGLStatisticsValues[i].value == value)
+                    index = &_state->statisticsIndices[i];
+            break;
     }
     CORRADE_INTERNAL_ASSERT(index);
-    CORRADE_ASSERT(*index < measurementCount(),
+    return *index;
+}
+
+bool FrameProfilerGL::isMeasurementAvailable(const Value value) const {
+    const UnsignedShort index = measurementIndex(value);
+    CORRADE_ASSERT(index < measurementCount(),
         "DebugTools::FrameProfilerGL::isMeasurementAvailable():" << value << "not enabled", {});
-    return isMeasurementAvailable(*index);
+    return isMeasurementAvailable(index);
+}
+
+Double FrameProfilerGL::measurementMean(const Value value) const {
+    const UnsignedShort index = measurementIndex(value);
+    CORRADE_ASSERT(index < measurementCount(),
+        "DebugTools::FrameProfilerGL::measurementMean():" << value << "not enabled", {});
+    return measurementMean(index);
+}
+
+bool FrameProfilerGL::isGpuScopeMeasurementAvailable(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _state->gpuScopes.size(),
+        "DebugTools::FrameProfilerGL::isGpuScopeMeasurementAvailable(): index" << id << "out of range for" << _state->gpuScopes.size() << "GPU scopes", {});
+    return isMeasurementAvailable(_state->gpuScopesIndex + id);
+}
+
+Double FrameProfilerGL::gpuScopeMean(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _state->gpuScopes.size(),
+        "DebugTools::FrameProfilerGL::gpuScopeMean(): index" << id << "out of range for" << _state->gpuScopes.size() << "GPU scopes", {});
+    return measurementMean(_state->gpuScopesIndex + id);
 }
 
 Double FrameProfilerGL::frameTimeMean() const {
@@ -653,7 +1028,16 @@ constexpr const char* FrameProfilerGLValueNames[] {
     "CpuDuration",
     "GpuDuration",
     "VertexFetchRatio",
-    "PrimitiveClipRatio"
+    "PrimitiveClipRatio",
+    "DrawCount",
+    "BindCount",
+    "BindSkippedCount",
+    "ShaderProgramSwitchCount",
+    "TextureSwitchCount",
+    "BufferUploadCount",
+    "BufferUploadSize",
+    "InvalidatedAttachmentCount",
+    "InvalidatedPixelCount"
 };
 
 }
@@ -675,8 +1059,295 @@ Debug& operator<<(Debug& debug, const FrameProfilerGL::Values value) {
         FrameProfilerGL::Value::GpuDuration,
         #ifndef MAGNUM_TARGET_GLES
         FrameProfilerGL::Value::VertexFetchRatio,
-        FrameProfilerGL::Value::PrimitiveClipRatio
+        FrameProfilerGL::Value::PrimitiveClipRatio,
         #endif
+        FrameProfilerGL::Value::DrawCount,
+        FrameProfilerGL::Value::BindCount,
+        FrameProfilerGL::Value::BindSkippedCount,
+        FrameProfilerGL::Value::ShaderProgramSwitchCount,
+        FrameProfilerGL::Value::TextureSwitchCount,
+        FrameProfilerGL::Value::BufferUploadCount,
+        FrameProfilerGL::Value::BufferUploadSize,
+        FrameProfilerGL::Value::InvalidatedAttachmentCount,
+        FrameProfilerGL::Value::InvalidatedPixelCount
+        });
+}
+#endif
+
+#ifdef MAGNUM_TARGET_VK
+struct FrameProfilerVk::State {
+    explicit State(Vk::Device& device): device(device) {}
+
+    Vk::Device& device;
+    /* Set only for the duration of beginFrame() / endFrame() */
+    Vk::CommandBuffer* cmd{};
+    UnsignedShort cpuDurationIndex = 0xffff,
+        gpuDurationIndex = 0xffff,
+        frameTimeIndex = 0xffff,
+        vertexFetchRatioIndex = 0xffff,
+        primitiveClipRatioIndex = 0xffff;
+    UnsignedLong frameTimeStartFrame[2];
+    UnsignedLong cpuDurationStartFrame;
+    Float timestampPeriod;
+
+    /* Each pool has framesInFlight + 1 slots, the timestamp pool two queries
+       per slot */
+    Vk::QueryPool timestampQueries{NoCreate};
+    Vk::QueryPool vertexFetchQueries{NoCreate};
+    Vk::QueryPool primitiveClipQueries{NoCreate};
+};
+
+FrameProfilerVk::FrameProfilerVk(Vk::Device& device): _state{InPlaceInit, device} {}
+
+FrameProfilerVk::FrameProfilerVk(Vk::Device& device, const Values values, const UnsignedInt maxFrameCount, const UnsignedInt framesInFlight): FrameProfilerVk{device}
+{
+    setup(values, maxFrameCount, framesInFlight);
+}
+
+FrameProfilerVk::FrameProfilerVk(FrameProfilerVk&&) noexcept = default;
+
+FrameProfilerVk& FrameProfilerVk::operator=(FrameProfilerVk&&) noexcept = default;
+
+FrameProfilerVk::~FrameProfilerVk() = default;
+
+void FrameProfilerVk::setup(const Values values, const UnsignedInt maxFrameCount, const UnsignedInt framesInFlight) {
+    CORRADE_ASSERT(framesInFlight >= 1,
+        "DebugTools::FrameProfilerVk::setup(): expected at least one frame in flight", );
+    CORRADE_ASSERT(!(values & (Value::VertexFetchRatio|Value::PrimitiveClipRatio)) || (_state->device.enabledFeatures() & Vk::DeviceFeature::PipelineStatisticsQuery),
+        "DebugTools::FrameProfilerVk::setup(): pipeline statistics queries not enabled on the device", );
+
+    const UnsignedInt queryCount = framesInFlight + 1;
+
+    UnsignedShort index = 0;
+    Containers::Array<Measurement> measurements;
+    if(values & Value::FrameTime) {
+        /* Using steady_clock for the same reasons as in FrameProfilerGL */
+        arrayAppend(measurements, InPlaceInit,
+            "Frame time"_s, Units::Nanoseconds, UnsignedInt(Containers::arraySize(_state->frameTimeStartFrame)),
+            [](void* state, UnsignedInt current) {
+                static_cast<State*>(state)->frameTimeStartFrame[current] = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+            },
+            [](void*, UnsignedInt) {},
+            [](void* state, UnsignedInt previous, UnsignedInt current) {
+                auto& self = *static_cast<State*>(state);
+                return self.frameTimeStartFrame[current] -
+                    self.frameTimeStartFrame[previous];
+            }, _state.get());
+        _state->frameTimeIndex = index++;
+    } else _state->frameTimeIndex = 0xffff;
+    if(values & Value::CpuDuration) {
+        arrayAppend(measurements, InPlaceInit,
+            "CPU duration"_s, Units::Nanoseconds,
+            [](void* state) {
+                static_cast<State*>(state)->cpuDurationStartFrame = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+            },
+            [](void* state) {
+                return UnsignedLong(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() - static_cast<State*>(state)->cpuDurationStartFrame);
+            }, _state.get());
+        _state->cpuDurationIndex = index++;
+    } else _state->cpuDurationIndex = 0xffff;
+    if(values & Value::GpuDuration) {
+        _state->timestampPeriod = _state->device.properties().properties().properties.limits.timestampPeriod;
+        _state->timestampQueries = Vk::QueryPool{_state->device, Vk::QueryPoolCreateInfo{Vk::QueryType::Timestamp, queryCount*2}};
+        arrayAppend(measurements, InPlaceInit,
+            "GPU duration"_s, Units::Nanoseconds, queryCount,
+            [](void* state, UnsignedInt current) {
+                auto& self = *static_cast<State*>(state);
+                self.cmd->resetQueryPool(self.timestampQueries, current*2, 2)
+                    .writeTimestamp(Vk::PipelineStage::TopOfPipe, self.timestampQueries, current*2);
+            },
+            [](void* state, UnsignedInt current) {
+                auto& self = *static_cast<State*>(state);
+                self.cmd->writeTimestamp(Vk::PipelineStage::BottomOfPipe, self.timestampQueries, current*2 + 1);
+            },
+            [](void* state, UnsignedInt previous, UnsignedInt) {
+                auto& self = *static_cast<State*>(state);
+                /* The frame is known to be finished at this point, so the
+                   wait is there only to not have to handle the not-ready
+                   case */
+                UnsignedLong timestamps[2];
+                self.timestampQueries.results(previous*2, 2, timestamps, Vk::QueryResultFlag::Wait);
+                /* Avoid an underflow if the timestamp counter wrapped around */
+                if(timestamps[1] < timestamps[0]) return UnsignedLong{};
+
+                return UnsignedLong(Double(timestamps[1] - timestamps[0])*self.timestampPeriod);
+            }, _state.get());
+        _state->gpuDurationIndex = index++;
+    } else {
+        _state->timestampQueries = Vk::QueryPool{NoCreate};
+        _state->gpuDurationIndex = 0xffff;
+    }
+    if(values & Value::VertexFetchRatio) {
+        _state->vertexFetchQueries = Vk::QueryPool{_state->device, Vk::QueryPoolCreateInfo{Vk::QueryPipelineStatistic::InputAssemblyVertices|Vk::QueryPipelineStatistic::VertexShaderInvocations, queryCount}};
+        arrayAppend(measurements, InPlaceInit,
+            "Vertex fetch ratio"_s, Units::RatioThousandths, queryCount,
+            [](void* state, UnsignedInt current) {
+                auto& self = *static_cast<State*>(state);
+                self.cmd->resetQueryPool(self.vertexFetchQueries, current, 1)
+                    .beginQuery(self.vertexFetchQueries, current);
+            },
+            [](void* state, UnsignedInt current) {
+                auto& self = *static_cast<State*>(state);
+                self.cmd->endQuery(self.vertexFetchQueries, current);
+            },
+            [](void* state, UnsignedInt previous, UnsignedInt) {
+                /* Values are ordered by the statistic bit position */
+                UnsignedLong submittedInvocations[2];
+                static_cast<State*>(state)->vertexFetchQueries.results(previous, 1, submittedInvocations, Vk::QueryResultFlag::Wait);
+
+                /* Avoid division by zero if a frame doesn't have any draws */
+                if(!submittedInvocations[0]) return UnsignedLong{};
+
+                return submittedInvocations[1]*1000/submittedInvocations[0];
+            }, _state.get());
+        _state->vertexFetchRatioIndex = index++;
+    } else {
+        _state->vertexFetchQueries = Vk::QueryPool{NoCreate};
+        _state->vertexFetchRatioIndex = 0xffff;
+    }
+    if(values & Value::PrimitiveClipRatio) {
+        _state->primitiveClipQueries = Vk::QueryPool{_state->device, Vk::QueryPoolCreateInfo{Vk::QueryPipelineStatistic::ClippingInvocations|Vk::QueryPipelineStatistic::ClippingPrimitives, queryCount}};
+        arrayAppend(measurements, InPlaceInit,
+            "Primitives clipped"_s, Units::PercentageThousandths, queryCount,
+            [](void* state, UnsignedInt current) {
+                auto& self = *static_cast<State*>(state);
+                self.cmd->resetQueryPool(self.primitiveClipQueries, current, 1)
+                    .beginQuery(self.primitiveClipQueries, current);
+            },
+            [](void* state, UnsignedInt current) {
+                auto& self = *static_cast<State*>(state);
+                self.cmd->endQuery(self.primitiveClipQueries, current);
+            },
+            [](void* state, UnsignedInt previous, UnsignedInt) {
+                /* Values are ordered by the statistic bit position */
+                UnsignedLong inputOutput[2];
+                static_cast<State*>(state)->primitiveClipQueries.results(previous, 1, inputOutput, Vk::QueryResultFlag::Wait);
+
+                /* Avoid division by zero if a frame doesn't have any draws */
+                if(!inputOutput[0]) return UnsignedLong{};
+
+                /* A triangle can get split into multiple by the clipper, in
+                   which case there's more output primitives than input. Return
+                   zero as well to avoid an underflow. */
+                if(inputOutput[0] < inputOutput[1]) return UnsignedLong{};
+
+                return 100000 - inputOutput[1]*100000/inputOutput[0];
+            }, _state.get());
+        _state->primitiveClipRatioIndex = index++;
+    } else {
+        _state->primitiveClipQueries = Vk::QueryPool{NoCreate};
+        _state->primitiveClipRatioIndex = 0xffff;
+    }
+    setup(Utility::move(measurements), maxFrameCount);
+}
+
+auto FrameProfilerVk::values() const -> Values {
+    Values values;
+    if(_state->frameTimeIndex != 0xffff) values |= Value::FrameTime;
+    if(_state->cpuDurationIndex != 0xffff) values |= Value::CpuDuration;
+    if(_state->gpuDurationIndex != 0xffff) values |= Value::GpuDuration;
+    if(_state->vertexFetchRatioIndex != 0xffff) values |= Value::VertexFetchRatio;
+    if(_state->primitiveClipRatioIndex != 0xffff) values |= Value::PrimitiveClipRatio;
+    return values;
+}
+
+void FrameProfilerVk::beginFrame(Vk::CommandBuffer& cmd) {
+    _state->cmd = &cmd;
+    FrameProfiler::beginFrame();
+    _state->cmd = nullptr;
+}
+
+void FrameProfilerVk::endFrame(Vk::CommandBuffer& cmd) {
+    _state->cmd = &cmd;
+    FrameProfiler::endFrame();
+    _state->cmd = nullptr;
+}
+
+UnsignedShort FrameProfilerVk::measurementIndex(const Value value) const {
+    switch(value) {
+        case Value::FrameTime: return _state->frameTimeIndex;
+        case Value::CpuDuration: return _state->cpuDurationIndex;
+        case Value::GpuDuration: return _state->gpuDurationIndex;
+        case Value::VertexFetchRatio: return _state->vertexFetchRatioIndex;
+        case Value::PrimitiveClipRatio: return _state->primitiveClipRatioIndex;
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+bool FrameProfilerVk::isMeasurementAvailable(const Value value) const {
+    const UnsignedShort index = measurementIndex(value);
+    CORRADE_ASSERT(index < measurementCount(),
+        "DebugTools::FrameProfilerVk::isMeasurementAvailable():" << value << "not enabled", {});
+    return isMeasurementAvailable(index);
+}
+
+Double FrameProfilerVk::measurementMean(const Value value) const {
+    const UnsignedShort index = measurementIndex(value);
+    CORRADE_ASSERT(index < measurementCount(),
+        "DebugTools::FrameProfilerVk::measurementMean():" << value << "not enabled", {});
+    return measurementMean(index);
+}
+
+Double FrameProfilerVk::frameTimeMean() const {
+    CORRADE_ASSERT(_state->frameTimeIndex < measurementCount(),
+        "DebugTools::FrameProfilerVk::frameTimeMean(): not enabled", {});
+    return measurementMean(_state->frameTimeIndex);
+}
+
+Double FrameProfilerVk::cpuDurationMean() const {
+    CORRADE_ASSERT(_state->cpuDurationIndex < measurementCount(),
+        "DebugTools::FrameProfilerVk::cpuDurationMean(): not enabled", {});
+    return measurementMean(_state->cpuDurationIndex);
+}
+
+Double FrameProfilerVk::gpuDurationMean() const {
+    CORRADE_ASSERT(_state->gpuDurationIndex < measurementCount(),
+        "DebugTools::FrameProfilerVk::gpuDurationMean(): not enabled", {});
+    return measurementMean(_state->gpuDurationIndex);
+}
+
+Double FrameProfilerVk::vertexFetchRatioMean() const {
+    CORRADE_ASSERT(_state->vertexFetchRatioIndex < measurementCount(),
+        "DebugTools::FrameProfilerVk::vertexFetchRatioMean(): not enabled", {});
+    return measurementMean(_state->vertexFetchRatioIndex);
+}
+
+Double FrameProfilerVk::primitiveClipRatioMean() const {
+    CORRADE_ASSERT(_state->primitiveClipRatioIndex < measurementCount(),
+        "DebugTools::FrameProfilerVk::primitiveClipRatioMean(): not enabled", {});
+    return measurementMean(_state->primitiveClipRatioIndex);
+}
+
+namespace {
+
+constexpr const char* FrameProfilerVkValueNames[] {
+    "FrameTime",
+    "CpuDuration",
+    "GpuDuration",
+    "VertexFetchRatio",
+    "PrimitiveClipRatio"
+};
+
+}
+
+Debug& operator<<(Debug& debug, const FrameProfilerVk::Value value) {
+    debug << "DebugTools::FrameProfilerVk::Value" << Debug::nospace;
+
+    const UnsignedInt bit = Math::log2(UnsignedShort(value));
+    if(1 << bit == UnsignedShort(value) && bit < Containers::arraySize(FrameProfilerVkValueNames))
+        return debug << "::" << Debug::nospace << FrameProfilerVkValueNames[bit];
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedShort(value) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const FrameProfilerVk::Values value) {
+    return Containers::enumSetDebugOutput(debug, value, "DebugTools::FrameProfilerVk::Values{}", {
+        FrameProfilerVk::Value::FrameTime,
+        FrameProfilerVk::Value::CpuDuration,
+        FrameProfilerVk::Value::GpuDuration,
+        FrameProfilerVk::Value::VertexFetchRatio,
+        FrameProfilerVk::Value::PrimitiveClipRatio
         });
 }
 #endif
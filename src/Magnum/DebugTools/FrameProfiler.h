@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::DebugTools::FrameProfiler, @ref Magnum::DebugTools::FrameProfilerGL
+ * @brief Class @ref Magnum::DebugTools::FrameProfiler, @ref Magnum::DebugTools::FrameProfilerGL, @ref Magnum::DebugTools::FrameProfilerVk
  * @m_since{2020,06}
  */
 
@@ -38,6 +38,10 @@
 #include "Magnum/Magnum.h"
 #include "Magnum/DebugTools/visibility.h"
 
+#ifdef MAGNUM_TARGET_VK
+#include "Magnum/Vk/Vk.h"
+#endif
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /* Measurement used to take a std::string, measurementName() and statistics()
    used to be a std::string. Not ideal for the return types, but at least
@@ -90,6 +94,50 @@ And here's a sample output on the terminal --- using a fully configured
 
 @include debugtools-frameprofiler.ansi
 
+@section DebugTools-FrameProfiler-histogram Always-on histogram recording
+
+The moving average and the textual output of @ref statistics() are mainly
+useful for interactive debugging. For collecting frame time distribution from
+release builds, call @ref enableHistogram(). After that, each measured value
+is additionally recorded into a fixed-size histogram for each measurement, and
+@ref histogramPercentile() and @ref histogramMax() can be used to retrieve the
+p50, p95, p99 or max values over all frames since the histogram was enabled
+or @ref resetHistogram() was called last time:
+
+@snippet DebugTools.cpp FrameProfiler-histogram
+
+Recording a value is a constant-time operation that doesn't allocate. The
+histogram buckets are log-linear --- values @f$ v < 16 @f$ are stored in
+bucket @f$ v @f$, larger values are split into 16 equally sized sub-buckets
+per each power of two, which means a bucket @f$ b \ge 16 @f$ covers a range
+of @f$ [ (16 + (b mod 16)) \cdot 2^{e}, (17 + (b mod 16)) \cdot 2^{e}) @f$,
+where @f$ e = \lfloor rac{b}{16} 
+floor - 1 @f$. That's
+@ref HistogramBucketCount buckets covering the whole 64-bit range with a
+relative error of at most @f$ rac{1}{16} @f$, independently of the
+measurement units.
+
+@subsection DebugTools-FrameProfiler-histogram-snapshot Binary snapshot format
+
+For upload to a telemetry service, @ref histogramSnapshotInto() writes the
+histograms of all measurements into a flat buffer without allocating. All
+values are in the native endianness and naturally aligned, starting with a
+16-byte header:
+
+-   4 bytes, the `MFPH` magic
+-   32-bit version, currently @cpp 1 @ce
+-   32-bit measurement count
+-   32-bit bucket count, equal to @ref HistogramBucketCount
+
+Followed by the following for each measurement, in the order they were
+passed to @ref setup():
+
+-   64-bit sample count, same as @ref histogramSampleCount()
+-   64-bit max value, same as @ref histogramMax()
+-   32-bit @ref Units value
+-   32-bit padding, zero
+-   32-bit counter for each bucket
+
 @section DebugTools-FrameProfiler-setup Setting up measurements
 
 Unless you're using this class through @ref FrameProfilerGL, measurements
@@ -111,6 +159,16 @@ parameters passed to each callback:
 
 @snippet DebugTools-gl.cpp FrameProfiler-setup-delayed
 
+@subsection DebugTools-FrameProfiler-setup-timeline Using durations measured by a Timeline
+
+If the application already uses a @ref Timeline, its
+@ref Timeline::previousFrameDurationNanoseconds() can be reused instead of
+measuring the frame time again. The duration is known only after
+@ref Timeline::nextFrame(), so it has to be called before
+@ref endFrame():
+
+@snippet DebugTools.cpp FrameProfiler-setup-timeline
+
 <b></b>
 
 @m_class{m-block m-warning}
@@ -403,6 +461,133 @@ class MAGNUM_DEBUGTOOLS_EXPORT FrameProfiler {
             printStatistics(out, frequency);
         }
 
+        enum: UnsignedInt {
+            /**
+             * Count of buckets in the histogram of each measurement. See
+             * @ref DebugTools-FrameProfiler-histogram for details about the
+             * bucket layout.
+             * @m_since_latest
+             */
+            HistogramBucketCount = 976
+        };
+
+        /**
+         * @brief Whether histogram recording is enabled
+         * @m_since_latest
+         *
+         * Disabled by default.
+         * @see @ref enableHistogram(), @ref disableHistogram()
+         */
+        bool isHistogramEnabled() const { return _histogramEnabled; }
+
+        /**
+         * @brief Enable histogram recording
+         * @m_since_latest
+         *
+         * Allocates a histogram of @ref HistogramBucketCount counters for
+         * every measurement and from then on records all measured values into
+         * it. No further allocations are done, not even when calling
+         * @ref setup() again with the same measurement count. Calling this
+         * function on a profiler that already has histograms enabled does
+         * nothing. See @ref DebugTools-FrameProfiler-histogram for more
+         * information.
+         * @see @ref isHistogramEnabled(), @ref resetHistogram()
+         */
+        void enableHistogram();
+
+        /**
+         * @brief Disable histogram recording
+         * @m_since_latest
+         *
+         * Frees the histogram memory allocated by @ref enableHistogram().
+         */
+        void disableHistogram();
+
+        /**
+         * @brief Reset the histogram
+         * @m_since_latest
+         *
+         * Zeroes out counters, sample counts and max values of all
+         * measurements, keeping the histogram enabled and without doing any
+         * allocation. Histograms are not reset by @ref enable() or by
+         * @ref setup() with the same measurement count in order to allow
+         * collecting data over the whole application lifetime. Expects that
+         * histogram recording is enabled.
+         */
+        void resetHistogram();
+
+        /**
+         * @brief Count of samples recorded in a histogram
+         * @m_since_latest
+         *
+         * The @p id corresponds to the index of the measurement in the list
+         * passed to @ref setup(). Expects that @p id is less than
+         * @ref measurementCount() and that histogram recording is enabled.
+         */
+        UnsignedLong histogramSampleCount(UnsignedInt id) const;
+
+        /**
+         * @brief Max value recorded in a histogram
+         * @m_since_latest
+         *
+         * Exact, not rounded to a bucket boundary. The @p id corresponds to
+         * the index of the measurement in the list passed to @ref setup().
+         * Expects that @p id is less than @ref measurementCount() and that
+         * histogram recording is enabled.
+         */
+        UnsignedLong histogramMax(UnsignedInt id) const;
+
+        /**
+         * @brief Percentile of values recorded in a histogram
+         * @param id            Measurement index
+         * @param percentile    Percentile, between @cpp 0.0f @ce and
+         *      @cpp 100.0f @ce
+         * @m_since_latest
+         *
+         * Returns an upper bound of a bucket containing given percentile,
+         * clamped to @ref histogramMax(). The relative error is thus at most
+         * @f$ rac{1}{16} @f$, values below @cpp 16 @ce are exact. For
+         * example, p99 of a frame time measurement is
+         * @cpp histogramPercentile(id, 99.0f) @ce. Expects that @p id is less
+         * than @ref measurementCount(), that histogram recording is enabled
+         * and at least one sample was recorded.
+         * @see @ref histogramSampleCount()
+         */
+        UnsignedLong histogramPercentile(UnsignedInt id, Float percentile) const;
+
+        /**
+         * @brief Histogram snapshot size
+         * @m_since_latest
+         *
+         * Size of a buffer needed by @ref histogramSnapshotInto(). Depends
+         * only on @ref measurementCount(). See
+         * @ref DebugTools-FrameProfiler-histogram-snapshot for a description
+         * of the format.
+         */
+        std::size_t histogramSnapshotSize() const;
+
+        /**
+         * @brief Write a histogram snapshot into a buffer
+         * @m_since_latest
+         *
+         * Doesn't allocate, making it suitable for periodic telemetry upload.
+         * Expects that histogram recording is enabled and that @p destination
+         * is exactly @ref histogramSnapshotSize() bytes. See
+         * @ref DebugTools-FrameProfiler-histogram-snapshot for a description
+         * of the format.
+         * @see @ref histogramSnapshot()
+         */
+        void histogramSnapshotInto(Containers::ArrayView<char> destination) const;
+
+        /**
+         * @brief Histogram snapshot
+         * @m_since_latest
+         *
+         * Allocates a buffer of @ref histogramSnapshotSize() bytes and calls
+         * @ref histogramSnapshotInto() with it.
+         */
+        Containers::Array<char> histogramSnapshot() const;
+
     private:
         UnsignedInt delayedCurrentData(UnsignedInt delay) const;
         Double measurementMeanInternal(const Measurement& measurement) const;
@@ -414,9 +599,14 @@ class MAGNUM_DEBUGTOOLS_EXPORT FrameProfiler {
            asserts get disabled */
         bool _beginFrameCalled{};
         #endif
+        bool _histogramEnabled{};
         UnsignedInt _maxFrameCount{1}, _measuredFrameCount{};
         Containers::Array<Measurement> _measurements;
         Containers::Array<UnsignedLong> _data;
+        /* HistogramBucketCount counters for each measurement */
+        Containers::Array<UnsignedInt> _histogram;
+        /* Sample count and max value for each measurement */
+        Containers::Array<UnsignedLong> _histogramStatistics;
 };
 
 /**
@@ -523,8 +713,29 @@ in the @ref DebugTools-FrameProfiler-usage "FrameProfiler usage documentation":
 @snippet DebugTools-gl.cpp FrameProfilerGL-usage
 
 If none of @ref Value::GpuDuration, @ref Value::VertexFetchRatio and
-@ref Value::PrimitiveClipRatio is not enabled, the class can operate without an
-active OpenGL context.
+@ref Value::PrimitiveClipRatio is not enabled and no GPU scopes are set up,
+the class can operate without an active OpenGL context.
+
+@section DebugTools-FrameProfilerGL-gpu-scopes GPU scopes
+
+While @ref Value::GpuDuration measures the whole frame, a breakdown into
+individual render passes can be done by passing a list of GPU scope names to
+@ref FrameProfilerGL(Values, Containers::ArrayView<const Containers::StringView>, UnsignedInt)
+or @ref setup(Values, Containers::ArrayView<const Containers::StringView>, UnsignedInt)
+and then wrapping the passes in @ref beginGpuScope() and @ref endGpuScope()
+calls. Each scope becomes an additional measurement named after the scope and
+shown in @ref statistics(), its mean value is available through
+@ref gpuScopeMean():
+
+@snippet DebugTools-gl.cpp FrameProfilerGL-gpu-scopes
+
+Each scope is measured with a pair of @ref GL::TimeQuery::Target::Timestamp
+queries, with the queries cycled across frames the same way as for
+@ref Value::GpuDuration and retrieved with a delay of 3 frames, so the CPU
+doesn't stall waiting for the GPU. Because timestamps are used instead of
+elapsed time queries, scopes can be nested and overlap with each other as well
+as with @ref Value::GpuDuration. A scope that wasn't entered in a particular
+frame contributes a zero duration for that frame.
 
 @experimental
 */
@@ -586,8 +797,84 @@ class MAGNUM_DEBUGTOOLS_EXPORT FrameProfilerGL: public FrameProfiler {
              * value requires an active OpenGL context.
              * @requires_gl46 Extension @gl_extension{ARB,pipeline_statistics_query}
              */
-            PrimitiveClipRatio = 1 << 4
+            PrimitiveClipRatio = 1 << 4,
             #endif
+
+            /**
+             * Count of draw calls issued in a frame, taken from
+             * @ref GL::Context::Statistics::drawCount. Reported in
+             * @ref Units::Count with a delay of 1 frame.
+             * @m_since_latest
+             */
+            DrawCount = 1 << 5,
+
+            /**
+             * Count of object binds and shader program switches issued in a
+             * frame, taken from @ref GL::Context::Statistics::bindCount.
+             * Reported in @ref Units::Count with a delay of 1 frame.
+             * @m_since_latest
+             */
+            BindCount = 1 << 6,
+
+            /**
+             * Count of object binds and shader program switches skipped by
+             * the state tracker in a frame, taken from
+             * @ref GL::Context::Statistics::bindSkippedCount. A high value
+             * compared to @ref Value::BindCount isn't a problem on its own,
+             * but a high @ref Value::BindCount compared to
+             * @ref Value::DrawCount hints at a state thrash. Reported in
+             * @ref Units::Count with a delay of 1 frame.
+             * @m_since_latest
+             */
+            BindSkippedCount = 1 << 7,
+
+            /**
+             * Count of shader program switches in a frame, taken from
+             * @ref GL::Context::Statistics::shaderProgramSwitchCount.
+             * Reported in @ref Units::Count with a delay of 1 frame.
+             * @m_since_latest
+             */
+            ShaderProgramSwitchCount = 1 << 8,
+
+            /**
+             * Count of texture binds to texture units in a frame, taken from
+             * @ref GL::Context::Statistics::textureSwitchCount. Reported in
+             * @ref Units::Count with a delay of 1 frame.
+             * @m_since_latest
+             */
+            TextureSwitchCount = 1 << 9,
+
+            /**
+             * Count of buffer data uploads in a frame, taken from
+             * @ref GL::Context::Statistics::bufferUploadCount. Reported in
+             * @ref Units::Count with a delay of 1 frame.
+             * @m_since_latest
+             */
+            BufferUploadCount = 1 << 10,
+
+            /**
+             * Size of buffer data uploaded in a frame, taken from
+             * @ref GL::Context::Statistics::bufferUploadSize. Reported in
+             * @ref Units::Bytes with a delay of 1 frame.
+             * @m_since_latest
+             */
+            BufferUploadSize = 1 << 11,
+
+            /**
+             * Count of framebuffer attachments invalidated in a frame, taken
+             * from @ref GL::Context::Statistics::invalidatedAttachmentCount.
+             * Reported in @ref Units::Count with a delay of 1 frame.
+             * @m_since_latest
+             */
+            InvalidatedAttachmentCount = 1 << 12,
+
+            /**
+             * Pixel area of framebuffer attachments invalidated in a frame,
+             * taken from @ref GL::Context::Statistics::invalidatedPixelCount.
+             * Reported in @ref Units::Count with a delay of 1 frame.
+             * @m_since_latest
+             */
+            InvalidatedPixelCount = 1 << 13
         };
 
         /**
@@ -612,6 +899,22 @@ class MAGNUM_DEBUGTOOLS_EXPORT FrameProfilerGL: public FrameProfiler {
          */
         explicit FrameProfilerGL(Values values, UnsignedInt maxFrameCount);
 
+        /**
+         * @brief Construct with GPU scopes
+         * @m_since_latest
+         *
+         * Equivalent to default-constructing an instance and calling
+         * @ref setup(Values, Containers::ArrayView<const Containers::StringView>, UnsignedInt)
+         * afterwards.
+         */
+        explicit FrameProfilerGL(Values values, Containers::ArrayView<const Containers::StringView> gpuScopes, UnsignedInt maxFrameCount);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        explicit FrameProfilerGL(Values values, std::initializer_list<Containers::StringView> gpuScopes, UnsignedInt maxFrameCount);
+
         /** @brief Copying is not allowed */
         FrameProfilerGL(const FrameProfilerGL&) = delete;
 
@@ -638,6 +941,36 @@ class MAGNUM_DEBUGTOOLS_EXPORT FrameProfilerGL: public FrameProfiler {
          */
         void setup(Values values, UnsignedInt maxFrameCount);
 
+        /**
+         * @brief Setup measured values and GPU scopes
+         * @param values        List of measuremed values
+         * @param gpuScopes     GPU scope names
+         * @param maxFrameCount Max frame count over which to calculate a
+         *      moving average. Expected to be at least @cpp 1 @ce.
+         * @m_since_latest
+         *
+         * Measurements for @p gpuScopes are added after all @p values, in
+         * the order they're listed. The scopes are then referenced by their
+         * index in @ref beginGpuScope(), @ref endGpuScope() and
+         * @ref gpuScopeMean(). If @p gpuScopes is non-empty, an active OpenGL
+         * context is required. See @ref DebugTools-FrameProfilerGL-gpu-scopes
+         * for more information.
+         * @requires_gl33 Extension @gl_extension{ARB,timer_query} if
+         *      @p gpuScopes is non-empty
+         * @requires_es_extension Extension @gl_extension{EXT,disjoint_timer_query}
+         *      if @p gpuScopes is non-empty
+         * @requires_webgl_extension Extension @webgl_extension{EXT,disjoint_timer_query}
+         *      on WebGL 1, @webgl_extension{EXT,disjoint_timer_query_webgl2}
+         *      on WebGL 2 if @p gpuScopes is non-empty
+         */
+        void setup(Values values, Containers::ArrayView<const Containers::StringView> gpuScopes, UnsignedInt maxFrameCount);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        void setup(Values values, std::initializer_list<Containers::StringView> gpuScopes, UnsignedInt maxFrameCount);
+
         /**
          * @brief Measured values
          *
@@ -646,6 +979,41 @@ class MAGNUM_DEBUGTOOLS_EXPORT FrameProfilerGL: public FrameProfiler {
          */
         Values values() const;
 
+        /**
+         * @brief GPU scope count
+         * @m_since_latest
+         *
+         * Corresponds to the size of the @p gpuScopes parameter passed to
+         * @ref FrameProfilerGL(Values, Containers::ArrayView<const Containers::StringView>, UnsignedInt)
+         * or @ref setup(Values, Containers::ArrayView<const Containers::StringView>, UnsignedInt),
+         * @cpp 0 @ce if no GPU scopes were set up.
+         */
+        UnsignedInt gpuScopeCount() const;
+
+        /**
+         * @brief Begin a GPU scope
+         * @m_since_latest
+         *
+         * Records a GPU timestamp marking the beginning of scope @p id.
+         * Expects that @p id is less than @ref gpuScopeCount(). Should be
+         * called between @ref beginFrame() and @ref endFrame(), at most once
+         * per frame for a particular scope and followed by a corresponding
+         * @ref endGpuScope() in the same frame. If the profiler is disabled,
+         * the function is a no-op.
+         */
+        void beginGpuScope(UnsignedInt id);
+
+        /**
+         * @brief End a GPU scope
+         * @m_since_latest
+         *
+         * Records a GPU timestamp marking the end of scope @p id. Expects
+         * that @p id is less than @ref gpuScopeCount(). If the profiler is
+         * disabled, the function is a no-op.
+         * @see @ref beginGpuScope()
+         */
+        void endGpuScope(UnsignedInt id);
+
         /**
          * @brief Whether given measurement is available
          *
@@ -710,9 +1078,44 @@ class MAGNUM_DEBUGTOOLS_EXPORT FrameProfilerGL: public FrameProfiler {
         Double primitiveClipRatioMean() const;
         #endif
 
+        /**
+         * @brief Mean of given measured value
+         * @m_since_latest
+         *
+         * Expects that @p value was enabled, and that measurement data is
+         * available. Useful mainly for values that don't have a dedicated
+         * accessor such as @ref Value::DrawCount.
+         * @see @ref isMeasurementAvailable(Value) const
+         */
+        Double measurementMean(Value value) const;
+
+        /**
+         * @brief Whether given GPU scope measurement is available
+         * @m_since_latest
+         *
+         * Returns @cpp true @ce if enough frames was captured to calculate
+         * duration of GPU scope @p id, @cpp false @ce otherwise. Expects that
+         * @p id is less than @ref gpuScopeCount().
+         */
+        bool isGpuScopeMeasurementAvailable(UnsignedInt id) const;
+
+        /**
+         * @brief Mean GPU scope duration in nanoseconds
+         * @m_since_latest
+         *
+         * Expects that @p id is less than @ref gpuScopeCount() and that
+         * measurement data is available.
+         * @see @ref isGpuScopeMeasurementAvailable()
+         */
+        Double gpuScopeMean(UnsignedInt id) const;
+
+        using FrameProfiler::measurementMean;
+
     private:
         using FrameProfiler::setup;
 
+        MAGNUM_DEBUGTOOLS_LOCAL UnsignedShort measurementIndex(Value value) const;
+
         struct State;
         Containers::Pointer<State> _state;
 };
@@ -739,6 +1142,277 @@ typedef CORRADE_DEPRECATED("use FrameProfilerGL instead") FrameProfilerGL GLFram
 #endif
 #endif
 
+#ifdef MAGNUM_TARGET_VK
+/**
+@brief Vulkan frame profiler
+@m_since_latest
+
+A @ref FrameProfiler with Vulkan-specific measurements. Instantiate with a
+device and a desired subset of measured values and then continue similarly as
+described in the @ref DebugTools-FrameProfiler-usage "FrameProfiler usage documentation",
+except that @ref beginFrame(Vk::CommandBuffer&) and
+@ref endFrame(Vk::CommandBuffer&) take a command buffer into which GPU queries
+get recorded:
+
+@snippet DebugTools-vk.cpp FrameProfilerVk-usage
+
+The @p cmd passed to @ref beginFrame(Vk::CommandBuffer&) is expected to be in
+a recording state and outside of a render pass, as the queries are reset
+there. The same applies to @p cmd passed to @ref endFrame(Vk::CommandBuffer&),
+which is usually the same command buffer. If a frame consists of multiple
+command buffers, pass the first to @ref beginFrame(Vk::CommandBuffer&) and
+the last to @ref endFrame(Vk::CommandBuffer&), submitted in that order to the
+same queue.
+
+GPU measurements are retrieved from a ring of queries with a delay of
+@p framesInFlight plus one frame, so the queries of a particular frame are
+read only after the application already waited for the frame to finish
+and the CPU never stalls on the GPU. The @p framesInFlight passed to
+@ref FrameProfilerVk(Vk::Device&, Values, UnsignedInt, UnsignedInt) or
+@ref setup() thus has to be at least the count of frames the application
+allows to be in flight at the same time.
+
+@experimental
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT FrameProfilerVk: public FrameProfiler {
+    public:
+        /**
+         * @brief Measured value
+         *
+         * @see @ref Values, @ref FrameProfilerVk(Vk::Device&, Values, UnsignedInt, UnsignedInt),
+         *      @ref setup()
+         */
+        enum class Value: UnsignedShort {
+            /**
+             * Measure total frame time (i.e., time between consecutive
+             * @ref beginFrame(Vk::CommandBuffer&) calls). Reported in
+             * @ref Units::Nanoseconds with a delay of 2 frames. When
+             * converted to seconds, the value is an inverse of FPS.
+             */
+            FrameTime = 1 << 0,
+
+            /**
+             * Measure CPU frame duration (i.e., CPU time spent between
+             * @ref beginFrame(Vk::CommandBuffer&) and
+             * @ref endFrame(Vk::CommandBuffer&)). Reported in
+             * @ref Units::Nanoseconds with a delay of 1 frame.
+             */
+            CpuDuration = 1 << 1,
+
+            /**
+             * Measure GPU frame duration (i.e., time between a
+             * @ref Vk::PipelineStage::TopOfPipe timestamp written in
+             * @ref beginFrame(Vk::CommandBuffer&) and a
+             * @ref Vk::PipelineStage::BottomOfPipe timestamp written in
+             * @ref endFrame(Vk::CommandBuffer&)). Reported in
+             * @ref Units::Nanoseconds with a delay of @p framesInFlight plus
+             * one frame. Expects that the queue the command buffers are
+             * submitted to supports timestamps.
+             */
+            GpuDuration = 1 << 2,
+
+            /**
+             * Ratio of vertex shader invocations to count of vertices
+             * submitted. For a non-indexed draw the ratio will be 1, for
+             * indexed draws ratio is less than 1. The lower the value is, the
+             * better a mesh is optimized for post-transform vertex cache.
+             * Reported in @ref Units::RatioThousandths with a delay of
+             * @p framesInFlight plus one frame.
+             * @requires_vk_feature @ref Vk::DeviceFeature::PipelineStatisticsQuery
+             */
+            VertexFetchRatio = 1 << 3,
+
+            /**
+             * Ratio of primitives discarded by the clipping stage to count of
+             * primitives submitted. The ratio is 0 when all primitives pass
+             * the clipping stage and 1 when all are discarded. Can be used to
+             * measure efficiency of a frustum culling algorithm. Reported in
+             * @ref Units::PercentageThousandths with a delay of
+             * @p framesInFlight plus one frame.
+             * @requires_vk_feature @ref Vk::DeviceFeature::PipelineStatisticsQuery
+             */
+            PrimitiveClipRatio = 1 << 4
+        };
+
+        /**
+         * @brief Measured values
+         *
+         * @see @ref FrameProfilerVk(Vk::Device&, Values, UnsignedInt, UnsignedInt),
+         *      @ref setup()
+         */
+        typedef Containers::EnumSet<Value> Values;
+
+        /**
+         * @brief Constructor
+         *
+         * Call @ref setup() to populate the profiler with measurements.
+         */
+        explicit FrameProfilerVk(Vk::Device& device);
+
+        /**
+         * @brief Constructor
+         *
+         * Equivalent to constructing an instance with
+         * @ref FrameProfilerVk(Vk::Device&) and calling @ref setup()
+         * afterwards.
+         */
+        explicit FrameProfilerVk(Vk::Device& device, Values values, UnsignedInt maxFrameCount, UnsignedInt framesInFlight = 2);
+
+        /** @brief Copying is not allowed */
+        FrameProfilerVk(const FrameProfilerVk&) = delete;
+
+        /** @brief Move constructor */
+        FrameProfilerVk(FrameProfilerVk&&) noexcept;
+
+        /** @brief Copying is not allowed */
+        FrameProfilerVk& operator=(const FrameProfilerVk&) = delete;
+
+        /** @brief Move assignment */
+        FrameProfilerVk& operator=(FrameProfilerVk&&) noexcept;
+
+        ~FrameProfilerVk();
+
+        /**
+         * @brief Setup measured values
+         * @param values            List of measuremed values
+         * @param maxFrameCount     Max frame count over which to calculate a
+         *      moving average. Expected to be at least @cpp 1 @ce.
+         * @param framesInFlight    Max count of frames the application has in
+         *      flight. Expected to be at least @cpp 1 @ce.
+         *
+         * Calling @ref setup() on an already set up profiler will replace
+         * existing measurements with @p measurements and reset
+         * @ref measuredFrameCount() back to @cpp 0 @ce. If
+         * @ref Value::VertexFetchRatio or @ref Value::PrimitiveClipRatio is
+         * enabled, expects that @ref Vk::DeviceFeature::PipelineStatisticsQuery
+         * is enabled on the device.
+         */
+        void setup(Values values, UnsignedInt maxFrameCount, UnsignedInt framesInFlight = 2);
+
+        /**
+         * @brief Measured values
+         *
+         * Corresponds to the @p values parameter passed to
+         * @ref FrameProfilerVk(Vk::Device&, Values, UnsignedInt, UnsignedInt)
+         * or @ref setup().
+         */
+        Values values() const;
+
+        /**
+         * @brief Begin a frame
+         *
+         * Records GPU queries for the enabled measurements into @p cmd and
+         * then delegates to @ref FrameProfiler::beginFrame(). Expects that
+         * @p cmd is in a recording state and outside of a render pass.
+         */
+        void beginFrame(Vk::CommandBuffer& cmd);
+
+        /**
+         * @brief End a frame
+         *
+         * Records GPU queries for the enabled measurements into @p cmd and
+         * then delegates to @ref FrameProfiler::endFrame(), retrieving the
+         * results of queries recorded @p framesInFlight plus one frames ago.
+         * Expects that @p cmd is in a recording state and outside of a
+         * render pass.
+         */
+        void endFrame(Vk::CommandBuffer& cmd);
+
+        /**
+         * @brief Whether given measurement is available
+         *
+         * Returns @cpp true @ce if enough frames was captured to calculate
+         * given @p value, @cpp false @ce otherwise. Expects that @p value was
+         * enabled.
+         */
+        bool isMeasurementAvailable(Value value) const;
+
+        using FrameProfiler::isMeasurementAvailable;
+
+        /**
+         * @brief Mean frame time in nanoseconds
+         *
+         * Expects that @ref Value::FrameTime was enabled, and that measurement
+         * data is available. See the flag documentation for more information.
+         * @see @ref isMeasurementAvailable(), @ref measurementMean()
+         */
+        Double frameTimeMean() const;
+
+        /**
+         * @brief Mean CPU frame duration in nanoseconds
+         *
+         * Expects that @ref Value::CpuDuration was enabled, and that
+         * measurement data is available. See the flag documentation for more
+         * information.
+         * @see @ref isMeasurementAvailable(), @ref measurementMean()
+         */
+        Double cpuDurationMean() const;
+
+        /**
+         * @brief Mean GPU frame duration in nanoseconds
+         *
+         * Expects that @ref Value::GpuDuration was enabled, and that
+         * measurement data is available. See the flag documentation for more
+         * information.
+         * @see @ref isMeasurementAvailable(), @ref measurementMean()
+         */
+        Double gpuDurationMean() const;
+
+        /**
+         * @brief Mean vertex fetch ratio in thousandths
+         *
+         * Expects that @ref Value::VertexFetchRatio was enabled, and that
+         * measurement data is available. See the flag documentation for more
+         * information.
+         * @see @ref isMeasurementAvailable(), @ref measurementMean()
+         */
+        Double vertexFetchRatioMean() const;
+
+        /**
+         * @brief Mean primitive clip ratio in percentage thousandths
+         *
+         * Expects that @ref Value::PrimitiveClipRatio was enabled, and that
+         * measurement data is available. See the flag documentation for more
+         * information.
+         * @see @ref isMeasurementAvailable(), @ref measurementMean()
+         */
+        Double primitiveClipRatioMean() const;
+
+        /**
+         * @brief Mean of given measured value
+         *
+         * Expects that @p value was enabled, and that measurement data is
+         * available.
+         * @see @ref isMeasurementAvailable(Value) const
+         */
+        Double measurementMean(Value value) const;
+
+        using FrameProfiler::measurementMean;
+
+    private:
+        using FrameProfiler::setup;
+
+        MAGNUM_DEBUGTOOLS_LOCAL UnsignedShort measurementIndex(Value value) const;
+
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+CORRADE_ENUMSET_OPERATORS(FrameProfilerVk::Values)
+
+/**
+@debugoperatorclassenum{FrameProfilerVk,FrameProfilerVk::Value}
+@m_since_latest
+*/
+MAGNUM_DEBUGTOOLS_EXPORT Debug& operator<<(Debug& debug, FrameProfilerVk::Value value);
+
+/**
+@debugoperatorclassenum{FrameProfilerVk,FrameProfilerVk::Values}
+@m_since_latest
+*/
+MAGNUM_DEBUGTOOLS_EXPORT Debug& operator<<(Debug& debug, FrameProfilerVk::Values value);
+#endif
+
 }}
 
 namespace Corrade { namespace Utility {
@@ -26,6 +26,7 @@
 
 #include "ObjectRenderer.h"
 
+#include "Magnum/DebugTools/RendererBatch.h"
 #include "Magnum/DebugTools/ResourceManager.h"
 #include "Magnum/GL/Mesh.h"
 #include "Magnum/MeshTools/Compile.h"
@@ -68,8 +69,22 @@ template<UnsignedInt dimensions> ObjectRenderer<dimensions>::ObjectRenderer(Reso
 /* To avoid deleting pointers to incomplete type on destruction of Resource members */
 template<UnsignedInt dimensions> ObjectRenderer<dimensions>::~ObjectRenderer() = default;
 
+template<UnsignedInt dimensions> ObjectRenderer<dimensions>& ObjectRenderer<dimensions>::setBatch(RendererBatch<dimensions>* batch) {
+    _batch = batch;
+    return *this;
+}
+
 template<UnsignedInt dimensions> void ObjectRenderer<dimensions>::draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::Camera<dimensions, Float>& camera) {
-    _shader->setTransformationProjectionMatrix(camera.projectionMatrix()*transformationMatrix*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{_options->size()}))
+    const MatrixTypeFor<dimensions, Float> transformation = transformationMatrix*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{_options->size()});
+
+    /* If batched, only record the instance, RendererBatch::draw() then
+       submits all of them at once */
+    if(_batch) {
+        _batch->addObject(transformation);
+        return;
+    }
+
+    _shader->setTransformationProjectionMatrix(camera.projectionMatrix()*transformation)
         .draw(*_mesh);
 }
 
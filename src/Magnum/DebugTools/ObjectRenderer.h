@@ -118,12 +118,36 @@ template<UnsignedInt dimensions> class ObjectRenderer: public SceneGraph::Drawab
 
         ~ObjectRenderer();
 
+        /**
+         * @brief Draw into a batch instead of drawing directly
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * If set to a non-null value, drawing this renderer through a camera
+         * only records its transformation into @p batch, which then
+         * draws all recorded instances with a single instanced draw call in
+         * @ref RendererBatch::draw(). The batch is expected to outlive the
+         * renderer or be reset back to @cpp nullptr @ce before it's
+         * destroyed. Default is @cpp nullptr @ce. See
+         * @ref DebugTools-RendererBatch-usage for an example.
+         */
+        ObjectRenderer<dimensions>& setBatch(RendererBatch<dimensions>* batch);
+
+        /**
+         * @brief Batch the renderer draws into
+         * @m_since_latest
+         *
+         * If @cpp nullptr @ce, the renderer draws directly.
+         */
+        RendererBatch<dimensions>* batch() const { return _batch; }
+
     private:
         void draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::Camera<dimensions, Float>& camera) override;
 
         Resource<ObjectRendererOptions> _options;
         Resource<GL::AbstractShaderProgram, Shaders::VertexColorGL<dimensions>> _shader;
         Resource<GL::Mesh> _mesh;
+        RendererBatch<dimensions>* _batch{};
 };
 
 /** @brief Two-dimensional object renderer */
@@ -0,0 +1,205 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OcclusionCuller.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/MeshTools/Compile.h"
+#include "Magnum/Primitives/Cube.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/Shaders/FlatGL.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace DebugTools {
+
+namespace {
+
+GL::SampleQuery::Target defaultTarget() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::ES3_compatibility>())
+        return GL::SampleQuery::Target::AnySamplesPassed;
+    #endif
+    return GL::SampleQuery::Target::AnySamplesPassedConservative;
+}
+
+/* If any corner of the box is in front of the near plane or behind the
+   camera, parts of the box get clipped away and the query may report it as
+   occluded even though it isn't */
+bool intersectsNearPlane(const Matrix4& boxTransformationProjection) {
+    for(UnsignedInt i = 0; i != 8; ++i) {
+        const Vector4 corner = boxTransformationProjection*Vector4{
+            i & 1 ? 1.0f : -1.0f,
+            i & 2 ? 1.0f : -1.0f,
+            i & 4 ? 1.0f : -1.0f, 1.0f};
+        if(corner.w() <= 0.0f || corner.z() < -corner.w())
+            return true;
+    }
+
+    return false;
+}
+
+}
+
+struct OcclusionCuller::State {
+    explicit State(GL::SampleQuery::Target target);
+
+    struct Entry {
+        GL::SampleQuery query{NoCreate};
+        /* The query was issued and its result wasn't retrieved yet */
+        bool pending = false;
+        /* Last known visibility, new drawables are assumed to be visible */
+        bool visible = true;
+    };
+
+    GL::SampleQuery::Target target;
+    bool conditionalRendering;
+    Shaders::FlatGL3D shader;
+    GL::Mesh box;
+    Containers::Array<Entry> entries;
+};
+
+OcclusionCuller::State::State(const GL::SampleQuery::Target target): target{target},
+    #ifndef MAGNUM_TARGET_GLES
+    conditionalRendering{GL::Context::current().isExtensionSupported<GL::Extensions::NV::conditional_render>()},
+    #else
+    conditionalRendering{false},
+    #endif
+    box{MeshTools::compile(Primitives::cubeSolid())} {}
+
+OcclusionCuller::OcclusionCuller(): OcclusionCuller{defaultTarget()} {}
+
+OcclusionCuller::OcclusionCuller(const GL::SampleQuery::Target target): _state{InPlaceInit, target} {}
+
+OcclusionCuller::OcclusionCuller(OcclusionCuller&&) noexcept = default;
+
+OcclusionCuller::~OcclusionCuller() = default;
+
+OcclusionCuller& OcclusionCuller::operator=(OcclusionCuller&&) noexcept = default;
+
+GL::SampleQuery::Target OcclusionCuller::target() const {
+    return _state->target;
+}
+
+bool OcclusionCuller::usesConditionalRendering() const {
+    return _state->conditionalRendering;
+}
+
+std::size_t OcclusionCuller::draw(SceneGraph::Camera3D& camera, SceneGraph::DrawableGroup3D& group, const Containers::StridedArrayView1D<const Range3D>& boundingBoxes) {
+    CORRADE_ASSERT(boundingBoxes.size() == group.size(),
+        "DebugTools::OcclusionCuller::draw(): expected" << group.size() << "bounding boxes but got" << boundingBoxes.size(), {});
+
+    State& state = *_state;
+    if(state.entries.size() != group.size())
+        state.entries = Containers::Array<State::Entry>{group.size()};
+
+    Containers::Array<Matrix4> transformations{NoInit, group.size()};
+    camera.drawableTransformationsInto(group, transformations);
+    const Matrix4 projectionMatrix = camera.projectionMatrix();
+
+    /* Pick up query results that are already available, the others keep the
+       last known visibility to not stall on them. Boxes intersecting the
+       near plane can't be queried and are always visible. */
+    Containers::Array<Matrix4> boxTransformationProjections{NoInit, group.size()};
+    Containers::Array<bool> queryable{NoInit, group.size()};
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        State::Entry& entry = state.entries[i];
+        if(entry.pending && entry.query.resultAvailable()) {
+            entry.visible = entry.query.result<bool>();
+            entry.pending = false;
+        }
+
+        const Range3D& boundingBox = boundingBoxes[i];
+        boxTransformationProjections[i] = projectionMatrix*transformations[i]*
+            Matrix4::translation(boundingBox.center())*
+            Matrix4::scaling(boundingBox.size()*0.5f);
+        queryable[i] = !intersectsNearPlane(boxTransformationProjections[i]);
+        if(!queryable[i]) entry.visible = true;
+    }
+
+    /* Draw everything that was visible, which fills the depth buffer for the
+       queries */
+    std::size_t occludedCount = 0;
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        if(state.entries[i].visible)
+            group[i].draw(transformations[i], camera);
+        else ++occludedCount;
+    }
+
+    /* Query the bounding boxes, slightly pulled towards the camera so boxes
+       coinciding with the drawable surfaces aren't occluded by them */
+    GL::Renderer::setColorMask(false, false, false, false);
+    GL::Renderer::setDepthMask(false);
+    GL::Renderer::enable(GL::Renderer::Feature::PolygonOffsetFill);
+    GL::Renderer::setPolygonOffset(-1.0f, -1.0f);
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        State::Entry& entry = state.entries[i];
+        if(entry.pending || !queryable[i]) continue;
+
+        if(!entry.query.id())
+            entry.query = GL::SampleQuery{state.target};
+        entry.query.begin();
+        state.shader
+            .setTransformationProjectionMatrix(boxTransformationProjections[i])
+            .draw(state.box);
+        entry.query.end();
+        entry.pending = true;
+    }
+    GL::Renderer::disable(GL::Renderer::Feature::PolygonOffsetFill);
+    GL::Renderer::setDepthMask(true);
+    GL::Renderer::setColorMask(true, true, true, true);
+
+    /* Draw what was occluded, letting the GPU discard it if it's still
+       occluded. This waits only on the GPU side, for the queries issued just
+       above or in a previous frame. */
+    #ifndef MAGNUM_TARGET_GLES
+    if(state.conditionalRendering) for(std::size_t i = 0; i != group.size(); ++i) {
+        State::Entry& entry = state.entries[i];
+        if(entry.visible) continue;
+
+        entry.query.beginConditionalRender(GL::SampleQuery::ConditionalRenderMode::Wait);
+        group[i].draw(transformations[i], camera);
+        entry.query.endConditionalRender();
+    }
+    #endif
+
+    return occludedCount;
+}
+
+OcclusionCuller& OcclusionCuller::reset() {
+    _state->entries = {};
+    return *this;
+}
+
+}}
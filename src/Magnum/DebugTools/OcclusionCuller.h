@@ -0,0 +1,187 @@
+#ifndef Magnum_DebugTools_OcclusionCuller_h
+#define Magnum_DebugTools_OcclusionCuller_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if defined(MAGNUM_TARGET_GL) && !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+/** @file
+ * @brief Class @ref Magnum::DebugTools::OcclusionCuller
+ * @m_since_latest
+ */
+#endif
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/DebugTools/DebugTools.h"
+#include "Magnum/DebugTools/visibility.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+
+#if defined(MAGNUM_TARGET_GL) && !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+#include "Magnum/GL/SampleQuery.h"
+
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Occlusion culler for scene graph drawables
+@m_since_latest
+
+Draws a @ref SceneGraph::DrawableGroup3D, skipping drawables whose bounding
+boxes were found to be hidden behind other geometry using
+@ref GL::SampleQuery occlusion queries. Useful for dense scenes such as
+building interiors, where most of the scene is occluded by walls and
+frustum culling alone doesn't help much.
+
+@section DebugTools-OcclusionCuller-usage Usage
+
+Supply an object-relative bounding box for every drawable in the group, in
+the same order as the drawables, and draw the group through the culler
+instead of @ref SceneGraph::Camera::draw(). The depth test is expected to be
+enabled:
+
+@snippet DebugTools-gl.cpp OcclusionCuller
+
+@section DebugTools-OcclusionCuller-algorithm Algorithm
+
+To avoid stalling the pipeline, the culler never waits for query results on
+the CPU side. Each frame, it performs the following steps:
+
+1.  Picks up results of queries from previous frames that are already
+    available. Drawables with pending queries keep their last known
+    visibility. New drawables are considered visible.
+2.  Draws drawables that were visible, filling the depth buffer.
+3.  With color and depth writes disabled, draws the bounding boxes of all
+    drawables without a pending query, each inside its own query. Bounding
+    boxes crossing the near plane or containing the camera can't be queried
+    reliably, so drawables with those are always considered visible.
+4.  If conditional rendering is supported, draws drawables that were
+    occluded in the previous frame, each conditionally based on its query
+    result. The GPU thus skips drawables that are still occluded, while
+    drawables that became visible appear without a frame delay.
+
+Without conditional rendering, which is the case on OpenGL ES and WebGL,
+drawables that were occluded are not drawn at all and show up in the next
+frame after their query reports them as visible.
+
+Queries are matched to drawables by their index in the group. If the group
+size changes, all state is discarded and all drawables are considered
+visible again. Call @ref reset() if the drawables were otherwise reordered.
+
+@requires_gl33 Extension @gl_extension{ARB,occlusion_query2}
+@requires_gles30 Extension @gl_extension{EXT,occlusion_query_boolean} in
+    OpenGL ES 2.0.
+@requires_webgl20 Queries are not available in WebGL 1.0.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL "TARGET_GL" and `MAGNUM_WITH_SCENEGRAPH` enabled
+    (done by default). See @ref building-features for more information.
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT OcclusionCuller {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Uses @ref GL::SampleQuery::Target::AnySamplesPassedConservative if
+         * supported, @ref GL::SampleQuery::Target::AnySamplesPassed
+         * otherwise.
+         */
+        explicit OcclusionCuller();
+
+        /**
+         * @brief Construct with an explicit query target
+         *
+         * With @ref GL::SampleQuery::Target::SamplesPassed a drawable is
+         * considered occluded if no samples of its bounding box passed.
+         */
+        explicit OcclusionCuller(GL::SampleQuery::Target target);
+
+        /** @brief Copying is not allowed */
+        OcclusionCuller(const OcclusionCuller&) = delete;
+
+        /** @brief Move constructor */
+        OcclusionCuller(OcclusionCuller&&) noexcept;
+
+        ~OcclusionCuller();
+
+        /** @brief Copying is not allowed */
+        OcclusionCuller& operator=(const OcclusionCuller&) = delete;
+
+        /** @brief Move assignment */
+        OcclusionCuller& operator=(OcclusionCuller&&) noexcept;
+
+        /** @brief Query target */
+        GL::SampleQuery::Target target() const;
+
+        /**
+         * @brief Whether conditional rendering is used
+         *
+         * Always @cpp false @ce on OpenGL ES and WebGL.
+         * @see @ref DebugTools-OcclusionCuller-algorithm
+         */
+        bool usesConditionalRendering() const;
+
+        /**
+         * @brief Draw given group of drawables, culling occluded ones
+         * @param camera        Camera
+         * @param group         Drawable group
+         * @param boundingBoxes Bounding box for each drawable, relative to
+         *      its object
+         * @return Count of drawables considered occluded based on the
+         *      previous query results
+         *
+         * Expects that @p boundingBoxes has the same size as @p group, in
+         * the same order as drawables in the group. See
+         * @ref DebugTools-OcclusionCuller-algorithm for details. The color
+         * and depth masks are set to @cpp true @ce at the end. Apart from
+         * that and the currently bound shader and mesh, no other GL state is
+         * changed.
+         *
+         * The returned count is meant mainly for profiling purposes. If
+         * conditional rendering is used, the drawables are still submitted,
+         * but the GPU discards them if they're still occluded.
+         */
+        std::size_t draw(SceneGraph::Camera3D& camera, SceneGraph::DrawableGroup3D& group, const Containers::StridedArrayView1D<const Range3D>& boundingBoxes);
+
+        /**
+         * @brief Discard all queries
+         * @return Reference to self (for method chaining)
+         *
+         * All drawables will be considered visible in the next
+         * @ref draw().
+         */
+        OcclusionCuller& reset();
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+#else
+#error this header is available only in the OpenGL build and not in WebGL 1.0
+#endif
+
+#endif
@@ -0,0 +1,157 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RendererBatch.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/Compile.h"
+#include "Magnum/Primitives/Axis.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/Shaders/FlatGL.h"
+#include "Magnum/Trade/MeshData.h"
+
+#include "Magnum/DebugTools/Implementation/ForceRendererMesh.h"
+
+namespace Magnum { namespace DebugTools {
+
+namespace {
+
+template<UnsignedInt> Trade::MeshData axisMeshData();
+template<> inline Trade::MeshData axisMeshData<2>() { return Primitives::axis2D(); }
+template<> inline Trade::MeshData axisMeshData<3>() { return Primitives::axis3D(); }
+
+}
+
+template<UnsignedInt dimensions> struct RendererBatch<dimensions>::State {
+    explicit State();
+
+    struct ForceInstance {
+        MatrixTypeFor<dimensions, Float> transformation;
+        Color4 color;
+    };
+
+    Shaders::FlatGL<dimensions> shader{typename Shaders::FlatGL<dimensions>::Configuration{}
+        .setFlags(Shaders::FlatGL<dimensions>::Flag::VertexColor|
+                  Shaders::FlatGL<dimensions>::Flag::InstancedTransformation)};
+
+    /* The meshes reference the instance buffers, so these have to be
+       destroyed after */
+    GL::Buffer objectInstanceBuffer{GL::Buffer::TargetHint::Array};
+    GL::Buffer forceInstanceBuffer{GL::Buffer::TargetHint::Array};
+    GL::Mesh objectMesh{NoCreate};
+    GL::Mesh forceMesh{GL::MeshPrimitive::Lines};
+
+    Containers::Array<MatrixTypeFor<dimensions, Float>> objectInstances;
+    Containers::Array<ForceInstance> forceInstances;
+};
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>::State::State() {
+    typedef Shaders::FlatGL<dimensions> Shader;
+
+    /* Axes, with colors coming from the vertex data */
+    objectMesh = MeshTools::compile(axisMeshData<dimensions>());
+    objectMesh.addVertexBufferInstanced(objectInstanceBuffer, 1, 0,
+        typename Shader::TransformationMatrix{});
+
+    /* Arrow, with per-instance colors */
+    GL::Buffer vertexBuffer{GL::Buffer::TargetHint::Array};
+    vertexBuffer.setData(Implementation::ForceRendererPositions, GL::BufferUsage::StaticDraw);
+    GL::Buffer indexBuffer{GL::Buffer::TargetHint::ElementArray};
+    indexBuffer.setData(Implementation::ForceRendererIndices, GL::BufferUsage::StaticDraw);
+    forceMesh.setCount(Containers::arraySize(Implementation::ForceRendererIndices))
+        .addVertexBuffer(std::move(vertexBuffer), 0,
+            typename Shader::Position{Shader::Position::Components::Two})
+        .addVertexBufferInstanced(forceInstanceBuffer, 1, 0,
+            typename Shader::TransformationMatrix{},
+            typename Shader::Color4{})
+        .setIndexBuffer(std::move(indexBuffer), 0, GL::MeshIndexType::UnsignedByte, 0, Containers::arraySize(Implementation::ForceRendererPositions));
+}
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>::RendererBatch(): _state{InPlaceInit} {}
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>::RendererBatch(RendererBatch<dimensions>&&) noexcept = default;
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>::~RendererBatch() = default;
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>& RendererBatch<dimensions>::operator=(RendererBatch<dimensions>&&) noexcept = default;
+
+template<UnsignedInt dimensions> std::size_t RendererBatch<dimensions>::objectCount() const {
+    return _state->objectInstances.size();
+}
+
+template<UnsignedInt dimensions> std::size_t RendererBatch<dimensions>::forceCount() const {
+    return _state->forceInstances.size();
+}
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>& RendererBatch<dimensions>::addObject(const MatrixTypeFor<dimensions, Float>& transformation) {
+    arrayAppend(_state->objectInstances, transformation);
+    return *this;
+}
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>& RendererBatch<dimensions>::addForce(const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color) {
+    arrayAppend(_state->forceInstances, typename State::ForceInstance{transformation, color});
+    return *this;
+}
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>& RendererBatch<dimensions>::draw(const MatrixTypeFor<dimensions, Float>& projectionMatrix) {
+    State& state = *_state;
+    state.shader.setTransformationProjectionMatrix(projectionMatrix);
+
+    if(!state.objectInstances.isEmpty()) {
+        state.objectInstanceBuffer.setData(state.objectInstances, GL::BufferUsage::StreamDraw);
+        state.objectMesh.setInstanceCount(Int(state.objectInstances.size()));
+        state.shader.draw(state.objectMesh);
+    }
+
+    if(!state.forceInstances.isEmpty()) {
+        state.forceInstanceBuffer.setData(state.forceInstances, GL::BufferUsage::StreamDraw);
+        state.forceMesh.setInstanceCount(Int(state.forceInstances.size()));
+        state.shader.draw(state.forceMesh);
+    }
+
+    return clear();
+}
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>& RendererBatch<dimensions>::draw(SceneGraph::Camera<dimensions, Float>& camera) {
+    return draw(camera.projectionMatrix());
+}
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>& RendererBatch<dimensions>::clear() {
+    /* Keep the capacity so the next frame doesn't need to reallocate */
+    arrayResize(_state->objectInstances, NoInit, 0);
+    arrayResize(_state->forceInstances, NoInit, 0);
+    return *this;
+}
+
+template class MAGNUM_DEBUGTOOLS_EXPORT RendererBatch<2>;
+template class MAGNUM_DEBUGTOOLS_EXPORT RendererBatch<3>;
+
+}}
@@ -0,0 +1,181 @@
+#ifndef Magnum_DebugTools_RendererBatch_h
+#define Magnum_DebugTools_RendererBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifdef MAGNUM_TARGET_GL
+/** @file
+ * @brief Class @ref Magnum::DebugTools::RendererBatch, typedef @ref Magnum::DebugTools::RendererBatch2D, @ref Magnum::DebugTools::RendererBatch3D
+ * @m_since_latest
+ */
+#endif
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/DebugTools/DebugTools.h"
+#include "Magnum/DebugTools/visibility.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+
+#ifdef MAGNUM_TARGET_GL
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Instanced batch for object and force renderers
+@m_since_latest
+
+Collects @ref ObjectRenderer and @ref ForceRenderer instances and draws all of
+them with one instanced draw call per renderer type, instead of issuing a
+shader setup and a draw call for every renderer. Useful for visualizing
+physics or animation state of scenes with thousands of objects, where the
+per-renderer overhead would otherwise dominate the frame time.
+
+@section DebugTools-RendererBatch-usage Usage
+
+Attach the batch to renderers using @ref ObjectRenderer::setBatch() /
+@ref ForceRenderer::setBatch(). Drawing the drawable group through a camera
+then only records per-instance transformations and colors, and a subsequent
+@ref draw() uploads them to a GPU buffer and submits everything at once:
+
+@snippet DebugTools-gl.cpp RendererBatch
+
+The batch uses its own instanced @ref Shaders::FlatGL and its own copies of the
+axis and arrow meshes, the @ref ObjectRendererOptions and
+@ref ForceRendererOptions set up for particular renderers are applied when
+recording each instance. Only the camera projection is applied in
+@ref draw(), so all renderers sharing a batch are expected to be drawn with
+the same camera.
+
+@requires_gl33 Extension @gl_extension{ARB,instanced_arrays}
+@requires_gles30 Extension @gl_extension{ANGLE,instanced_arrays},
+    @gl_extension{EXT,instanced_arrays} or
+    @gl_extension{NV,instanced_arrays} in OpenGL ES 2.0.
+@requires_webgl20 Extension @webgl_extension{ANGLE,instanced_arrays} in WebGL
+    1.0.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL "TARGET_GL" and `MAGNUM_WITH_SCENEGRAPH` enabled
+    (done by default). See @ref building-features for more information.
+
+@see @ref RendererBatch2D, @ref RendererBatch3D
+*/
+template<UnsignedInt dimensions> class RendererBatch {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Compiles the instanced shader and creates the meshes.
+         */
+        explicit RendererBatch();
+
+        /** @brief Copying is not allowed */
+        RendererBatch(const RendererBatch<dimensions>&) = delete;
+
+        /** @brief Move constructor */
+        RendererBatch(RendererBatch<dimensions>&&) noexcept;
+
+        ~RendererBatch();
+
+        /** @brief Copying is not allowed */
+        RendererBatch<dimensions>& operator=(const RendererBatch<dimensions>&) = delete;
+
+        /** @brief Move assignment */
+        RendererBatch<dimensions>& operator=(RendererBatch<dimensions>&&) noexcept;
+
+        /** @brief Count of recorded object instances */
+        std::size_t objectCount() const;
+
+        /** @brief Count of recorded force instances */
+        std::size_t forceCount() const;
+
+        /**
+         * @brief Record an object instance
+         * @return Reference to self (for method chaining)
+         *
+         * The @p transformation is expected to be relative to the camera and
+         * include the axis size. Called from @ref ObjectRenderer if it has
+         * the batch set, but can be used directly as well.
+         */
+        RendererBatch<dimensions>& addObject(const MatrixTypeFor<dimensions, Float>& transformation);
+
+        /**
+         * @brief Record a force instance
+         * @return Reference to self (for method chaining)
+         *
+         * The @p transformation is expected to be relative to the camera and
+         * map the unit X axis to the force arrow. Called from
+         * @ref ForceRenderer if it has the batch set, but can be used directly
+         * as well.
+         */
+        RendererBatch<dimensions>& addForce(const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color);
+
+        /**
+         * @brief Draw all recorded instances
+         * @return Reference to self (for method chaining)
+         *
+         * Uploads the recorded instance data, draws the objects and forces
+         * with one instanced draw call each using @p projectionMatrix and
+         * then clears the recorded instances. Does nothing for renderer types
+         * that have no instances recorded.
+         */
+        RendererBatch<dimensions>& draw(const MatrixTypeFor<dimensions, Float>& projectionMatrix);
+
+        /**
+         * @brief Draw all recorded instances with given camera
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to calling @ref draw(const MatrixTypeFor<dimensions, Float>&)
+         * with @ref SceneGraph::Camera::projectionMatrix().
+         */
+        RendererBatch<dimensions>& draw(SceneGraph::Camera<dimensions, Float>& camera);
+
+        /**
+         * @brief Clear recorded instances
+         * @return Reference to self (for method chaining)
+         *
+         * Discards the instances without drawing them. Done implicitly at the
+         * end of @ref draw().
+         */
+        RendererBatch<dimensions>& clear();
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+/** @brief Two-dimensional renderer batch */
+typedef RendererBatch<2> RendererBatch2D;
+
+/** @brief Three-dimensional renderer batch */
+typedef RendererBatch<3> RendererBatch3D;
+
+}}
+#else
+#error this header is available only in the OpenGL build
+#endif
+
+#endif
@@ -0,0 +1,250 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ScopeProfiler.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringStl.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/Macros.h> /* CORRADE_THREAD_LOCAL */
+
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace DebugTools {
+
+namespace {
+
+struct Event {
+    const char* name;
+    std::size_t nameSize;
+    UnsignedLong begin;
+    UnsignedLong end;
+};
+
+/* Each profiler gets an unique ID so the thread-local cache below doesn't
+   match a different profiler that happens to be allocated at the same
+   address */
+std::atomic<UnsignedLong> profilerIdCounter{0};
+
+}
+
+struct ScopeProfiler::Thread {
+    explicit Thread(const std::thread::id id, const UnsignedInt index, const std::size_t capacity, const std::chrono::steady_clock::time_point start, const std::atomic<bool>& enabled): id{id}, index{index}, events{NoInit, capacity}, start{start}, enabled(enabled) {}
+
+    UnsignedLong now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::thread::id id;
+    UnsignedInt index;
+    Containers::Array<Event> events;
+    std::chrono::steady_clock::time_point start;
+    const std::atomic<bool>& enabled;
+    /* Written only by the owning thread, read by chromeTrace(). Events
+       [written - events.size(), written) are valid. */
+    std::atomic<std::size_t> written{0};
+    /* Guarded by State::mutex */
+    Containers::String name;
+};
+
+struct ScopeProfiler::State {
+    explicit State(const std::size_t eventCapacity): eventCapacity{eventCapacity} {}
+
+    Thread& thread();
+
+    UnsignedLong id = ++profilerIdCounter;
+    std::size_t eventCapacity;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::atomic<bool> enabled{true};
+
+    mutable std::mutex mutex;
+    /* Pointers so the Thread addresses stay stable when the array grows */
+    Containers::Array<Containers::Pointer<Thread>> threads;
+};
+
+namespace {
+
+/* The ScopeProfiler::Thread type is private, thus a void pointer */
+struct ThreadCache {
+    UnsignedLong profilerId;
+    void* thread;
+};
+
+#ifdef CORRADE_BUILD_MULTITHREADED
+CORRADE_THREAD_LOCAL
+#endif
+ThreadCache threadCache{};
+
+}
+
+ScopeProfiler::Thread& ScopeProfiler::State::thread() {
+    /* Fast path, the same profiler used on this thread as the last time */
+    if(threadCache.profilerId == id) return *static_cast<Thread*>(threadCache.thread);
+
+    /* Otherwise find the thread among the registered ones or add it */
+    const std::thread::id threadId = std::this_thread::get_id();
+    Thread* found = nullptr;
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        for(Containers::Pointer<Thread>& i: threads) if(i->id == threadId) {
+            found = i.get();
+            break;
+        }
+        if(!found) found = arrayAppend(threads, Containers::pointer<Thread>(threadId, UnsignedInt(threads.size()), eventCapacity, start, enabled)).get();
+    }
+
+    threadCache.profilerId = id;
+    threadCache.thread = found;
+    return *found;
+}
+
+ScopeProfiler::ScopeProfiler(const std::size_t eventCapacity): _state{InPlaceInit, eventCapacity} {
+    CORRADE_ASSERT(eventCapacity,
+        "DebugTools::ScopeProfiler: expected a non-zero event capacity", );
+}
+
+ScopeProfiler::ScopeProfiler(ScopeProfiler&&) noexcept = default;
+
+ScopeProfiler::~ScopeProfiler() = default;
+
+ScopeProfiler& ScopeProfiler::operator=(ScopeProfiler&&) noexcept = default;
+
+std::size_t ScopeProfiler::eventCapacity() const {
+    return _state->eventCapacity;
+}
+
+bool ScopeProfiler::isEnabled() const {
+    return _state->enabled.load(std::memory_order_relaxed);
+}
+
+ScopeProfiler& ScopeProfiler::setEnabled(const bool enabled) {
+    _state->enabled.store(enabled, std::memory_order_relaxed);
+    return *this;
+}
+
+ScopeProfiler& ScopeProfiler::setThreadName(const Containers::StringView name) {
+    Thread& thread = _state->thread();
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    thread.name = Containers::String{name};
+    return *this;
+}
+
+std::size_t ScopeProfiler::threadCount() const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    return _state->threads.size();
+}
+
+namespace {
+
+void appendEscaped(std::string& out, const Containers::StringView string) {
+    for(const char c: string) {
+        if(c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if(UnsignedByte(c) < 0x20)
+            Utility::formatInto(out, out.size(), "\\u{:.4x}", UnsignedInt(c));
+        else out += c;
+    }
+}
+
+}
+
+Containers::String ScopeProfiler::chromeTrace() const {
+    std::string out = "{\"traceEvents\":[";
+    bool first = true;
+
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    Containers::Array<Event> events;
+    for(const Containers::Pointer<Thread>& thread: _state->threads) {
+        const std::size_t capacity = thread->events.size();
+
+        if(thread->name) {
+            if(!first) out += ',';
+            first = false;
+            Utility::formatInto(out, out.size(), "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},\"args\":{{\"name\":\"", thread->index);
+            appendEscaped(out, thread->name);
+            out += "\"}}";
+        }
+
+        /* Copy the events out first and then check which of them could have
+           been overwritten during the copy. Those are discarded without
+           looking at their contents. */
+        const std::size_t written = thread->written.load(std::memory_order_acquire);
+        const std::size_t begin = written > capacity ? written - capacity : 0;
+        arrayResize(events, NoInit, written - begin);
+        for(std::size_t i = begin; i != written; ++i)
+            events[i - begin] = thread->events[i % capacity];
+        const std::size_t writtenAfter = thread->written.load(std::memory_order_acquire);
+        const std::size_t validBegin = writtenAfter > capacity ? writtenAfter - capacity : 0;
+
+        for(std::size_t i = Math::max(begin, validBegin); i != written; ++i) {
+            const Event& event = events[i - begin];
+            if(!first) out += ',';
+            first = false;
+            out += "{\"name\":\"";
+            appendEscaped(out, {event.name, event.nameSize});
+            Utility::formatInto(out, out.size(), "\",\"ph\":\"X\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                thread->index,
+                event.begin/1000.0,
+                (event.end - event.begin)/1000.0);
+        }
+    }
+
+    out += "],\"displayTimeUnit\":\"ns\"}";
+    return out;
+}
+
+ScopeProfiler::Scope::Scope(ScopeProfiler& profiler, const Containers::StringView name): _thread{}, _name{name} {
+    if(!profiler._state->enabled.load(std::memory_order_relaxed)) return;
+
+    _thread = &profiler._state->thread();
+    _begin = _thread->now();
+}
+
+ScopeProfiler::Scope::~Scope() {
+    if(!_thread) return;
+
+    const UnsignedLong end = _thread->now();
+    /* Only this thread writes the counter, so a relaxed load is fine. The
+       release store makes the event contents visible to chromeTrace(). */
+    const std::size_t written = _thread->written.load(std::memory_order_relaxed);
+    Event& event = _thread->events[written % _thread->events.size()];
+    event.name = _name.data();
+    event.nameSize = _name.size();
+    event.begin = _begin;
+    event.end = end;
+    _thread->written.store(written + 1, std::memory_order_release);
+}
+
+}}
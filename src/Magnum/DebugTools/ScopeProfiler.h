@@ -0,0 +1,210 @@
+#ifndef Magnum_DebugTools_ScopeProfiler_h
+#define Magnum_DebugTools_ScopeProfiler_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::DebugTools::ScopeProfiler
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/StringView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/DebugTools/visibility.h"
+
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Hierarchical CPU scope profiler
+@m_since_latest
+
+Records durations of nested named scopes on any number of threads and exports
+them in the [Chrome trace event format](https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU/),
+which can be viewed in `chrome://tracing` or in
+[Perfetto](https://ui.perfetto.dev). Compared to @ref FrameProfiler, which
+calculates moving averages of a few frame-granular values, this class records
+each scope individually, showing exactly where the time goes.
+
+@section DebugTools-ScopeProfiler-usage Usage
+
+Create a single profiler instance and make it accessible to all code that
+should be profiled. Scopes are then recorded by creating a @ref Scope instance
+on stack, which measures the time until its destruction:
+
+@snippet DebugTools.cpp ScopeProfiler-usage
+
+The trace is then retrieved with @ref chromeTrace() and for example saved to
+a file with @relativeref{Corrade,Utility::Path::write()}.
+
+@section DebugTools-ScopeProfiler-threads Threads
+
+Each thread records into its own ring buffer of @p eventCapacity scopes passed
+to the constructor, which gets allocated on the first scope recorded on that
+thread. Recording is lock-free and involves no allocation, only the first
+scope on each thread takes a lock to allocate the buffer. When the buffer is
+full, the oldest scopes get overwritten. Threads can be named with
+@ref setThreadName() to make them easier to find in the trace.
+
+The scopes are added to the buffer when they end, so a scope that didn't end
+yet isn't exported. The export can be done while other threads are recording,
+scopes that get overwritten during the export are skipped.
+
+If @ref CORRADE_BUILD_MULTITHREADED is not enabled, the profiler can be used
+only from a single thread.
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT ScopeProfiler {
+    private:
+        struct Thread;
+
+    public:
+        class Scope;
+
+        /**
+         * @brief Constructor
+         * @param eventCapacity     Count of scopes each thread can record
+         *      before the oldest ones get overwritten. Expected to be
+         *      non-zero.
+         */
+        explicit ScopeProfiler(std::size_t eventCapacity = 65536);
+
+        /** @brief Copying is not allowed */
+        ScopeProfiler(const ScopeProfiler&) = delete;
+
+        /** @brief Move constructor */
+        ScopeProfiler(ScopeProfiler&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Expects that no @ref Scope recording to this profiler is active
+         * anymore.
+         */
+        ~ScopeProfiler();
+
+        /** @brief Copying is not allowed */
+        ScopeProfiler& operator=(const ScopeProfiler&) = delete;
+
+        /** @brief Move assignment */
+        ScopeProfiler& operator=(ScopeProfiler&&) noexcept;
+
+        /** @brief Count of scopes each thread can record */
+        std::size_t eventCapacity() const;
+
+        /** @brief Whether recording is enabled */
+        bool isEnabled() const;
+
+        /**
+         * @brief Enable or disable recording
+         * @return Reference to self (for method chaining)
+         *
+         * Scopes created while the recording is disabled aren't recorded.
+         * Can be called from any thread. Enabled by default.
+         */
+        ScopeProfiler& setEnabled(bool enabled);
+
+        /**
+         * @brief Set name of the calling thread
+         * @return Reference to self (for method chaining)
+         *
+         * The name is shown in the exported trace instead of a numeric
+         * thread ID.
+         */
+        ScopeProfiler& setThreadName(Containers::StringView name);
+
+        /**
+         * @brief Count of threads that recorded at least one scope
+         *
+         * Includes also threads that called @ref setThreadName().
+         */
+        std::size_t threadCount() const;
+
+        /**
+         * @brief Export a Chrome trace
+         *
+         * Returns a JSON with a complete event for each recorded scope and a
+         * metadata event for each named thread. Timestamps are in
+         * microseconds relative to the profiler construction. Can be called
+         * from any thread.
+         */
+        Containers::String chromeTrace() const;
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+/**
+@brief Profiled scope
+@m_since_latest
+
+Measures the time between its construction and destruction and records it in
+the profiler for the calling thread. See @ref ScopeProfiler for more
+information.
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT ScopeProfiler::Scope {
+    public:
+        /**
+         * @brief Constructor
+         * @param profiler  Profiler to record the scope to
+         * @param name      Scope name
+         *
+         * Only a view on @p name is stored, so its data are expected to stay
+         * in scope until the last @ref chromeTrace() call. Usually it's a
+         * string literal. If recording is disabled in @p profiler, the scope
+         * isn't recorded.
+         */
+        explicit Scope(ScopeProfiler& profiler, Containers::StringView name);
+
+        /** @brief Copying is not allowed */
+        Scope(const Scope&) = delete;
+
+        /** @brief Moving is not allowed */
+        Scope(Scope&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Records the scope.
+         */
+        ~Scope();
+
+        /** @brief Copying is not allowed */
+        Scope& operator=(const Scope&) = delete;
+
+        /** @brief Moving is not allowed */
+        Scope& operator=(Scope&&) = delete;
+
+    private:
+        Thread* _thread;
+        Containers::StringView _name;
+        UnsignedLong _begin;
+};
+
+}}
+
+#endif
@@ -0,0 +1,408 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/DebugTools/AsyncReadback.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/CubeMapTexture.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace DebugTools { namespace Test { namespace {
+
+struct AsyncReadbackGLTest: GL::OpenGLTester {
+    explicit AsyncReadbackGLTest();
+
+    void construct();
+    void constructMove();
+
+    void read();
+    void readImplementationFormat();
+    void textureSubImage();
+    void textureSubImageCubeMap();
+    void reuse();
+
+    void bufferData();
+    void bufferSubData();
+    void bufferReuse();
+
+    void isReadyInvalidHandle();
+    void takeInvalidHandle();
+    void takeBufferInvalidHandle();
+};
+
+AsyncReadbackGLTest::AsyncReadbackGLTest() {
+    addTests({&AsyncReadbackGLTest::construct,
+              &AsyncReadbackGLTest::constructMove,
+
+              &AsyncReadbackGLTest::read,
+              &AsyncReadbackGLTest::readImplementationFormat,
+              &AsyncReadbackGLTest::textureSubImage,
+              &AsyncReadbackGLTest::textureSubImageCubeMap,
+              &AsyncReadbackGLTest::reuse,
+
+              &AsyncReadbackGLTest::bufferData,
+              &AsyncReadbackGLTest::bufferSubData,
+              &AsyncReadbackGLTest::bufferReuse,
+
+              &AsyncReadbackGLTest::isReadyInvalidHandle,
+              &AsyncReadbackGLTest::takeInvalidHandle,
+              &AsyncReadbackGLTest::takeBufferInvalidHandle});
+}
+
+using namespace Math::Literals;
+
+constexpr Color4ub Data[]{
+    0x11223344_rgba, 0x22334455_rgba, 0x33445566_rgba, 0x44556677_rgba,
+    0x55667788_rgba, 0x66778899_rgba, 0x778899aa_rgba, 0x8899aabb_rgba,
+    0x99aabbcc_rgba, 0xaabbccdd_rgba, 0xbbccddee_rgba, 0xccddeeff_rgba
+};
+
+void AsyncReadbackGLTest::construct() {
+    AsyncReadback readback;
+    CORRADE_COMPARE(readback.pendingCount(), 0);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void AsyncReadbackGLTest::constructMove() {
+    GL::Texture2D texture;
+    texture.setStorage(1, GL::TextureFormat::RGBA8, {4, 3})
+        .setSubImage(0, {}, ImageView2D{PixelFormat::RGBA8Unorm, {4, 3}, Data});
+
+    AsyncReadback a;
+    const UnsignedInt handle = a.textureSubImage(texture, 0, {{}, {4, 3}}, PixelFormat::RGBA8Unorm);
+
+    AsyncReadback b{Utility::move(a)};
+    CORRADE_COMPARE(b.pendingCount(), 1);
+
+    AsyncReadback c;
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.pendingCount(), 1);
+
+    Image2D image = c.take(handle);
+    CORRADE_COMPARE_AS(image.pixels<Color4ub>().asContiguous(),
+        Containers::arrayView(Data),
+        TestSuite::Compare::Container);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<AsyncReadback>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<AsyncReadback>::value);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void AsyncReadbackGLTest::read() {
+    GL::Texture2D texture;
+    texture.setStorage(1, GL::TextureFormat::RGBA8, {4, 3})
+        .setSubImage(0, {}, ImageView2D{PixelFormat::RGBA8Unorm, {4, 3}, Data});
+    GL::Framebuffer framebuffer{{{}, {4, 3}}};
+    framebuffer.attachTexture(GL::Framebuffer::ColorAttachment{0}, texture, 0);
+    CORRADE_COMPARE(framebuffer.checkStatus(GL::FramebufferTarget::Read), GL::Framebuffer::Status::Complete);
+
+    AsyncReadback readback;
+    const UnsignedInt handle = readback.read(framebuffer, {{1, 1}, {3, 3}}, PixelFormat::RGBA8Unorm);
+    CORRADE_VERIFY(handle);
+    CORRADE_COMPARE(readback.pendingCount(), 1);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* After a finish the fence should be signaled */
+    GL::Renderer::finish();
+    CORRADE_VERIFY(readback.isReady(handle));
+
+    Image2D image = readback.take(handle);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(readback.pendingCount(), 0);
+    CORRADE_COMPARE(image.format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(image.size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE_AS(image.pixels<Color4ub>().asContiguous(), Containers::arrayView<Color4ub>({
+        0x66778899_rgba, 0x778899aa_rgba,
+        0xaabbccdd_rgba, 0xbbccddee_rgba
+    }), TestSuite::Compare::Container);
+}
+
+void AsyncReadbackGLTest::readImplementationFormat() {
+    GL::Texture2D texture;
+    texture.setStorage(1, GL::TextureFormat::RGBA8, {4, 3})
+        .setSubImage(0, {}, ImageView2D{PixelFormat::RGBA8Unorm, {4, 3}, Data});
+    GL::Framebuffer framebuffer{{{}, {4, 3}}};
+    framebuffer.attachTexture(GL::Framebuffer::ColorAttachment{0}, texture, 0);
+    CORRADE_COMPARE(framebuffer.checkStatus(GL::FramebufferTarget::Read), GL::Framebuffer::Status::Complete);
+
+    AsyncReadback readback;
+    const UnsignedInt handle = readback.read(framebuffer);
+    CORRADE_VERIFY(handle);
+
+    Image2D image = readback.take(handle);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(image.size(), (Vector2i{4, 3}));
+    if(image.format() != PixelFormat::RGBA8Unorm)
+        CORRADE_SKIP("Implementation-defined color read format is" << image.format() << Debug::nospace << ", can't test contents.");
+    CORRADE_COMPARE_AS(image.pixels<Color4ub>().asContiguous(),
+        Containers::arrayView(Data),
+        TestSuite::Compare::Container);
+}
+
+void AsyncReadbackGLTest::textureSubImage() {
+    GL::Texture2D texture;
+    texture.setStorage(1, GL::TextureFormat::RGBA8, {4, 3})
+        .setSubImage(0, {}, ImageView2D{PixelFormat::RGBA8Unorm, {4, 3}, Data});
+
+    AsyncReadback readback;
+    const UnsignedInt handle = readback.textureSubImage(texture, 0, {{}, {4, 3}}, PixelFormat::RGBA8Unorm);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Image2D image = readback.take(handle);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(image.size(), (Vector2i{4, 3}));
+    CORRADE_COMPARE_AS(image.pixels<Color4ub>().asContiguous(),
+        Containers::arrayView(Data),
+        TestSuite::Compare::Container);
+}
+
+void AsyncReadbackGLTest::textureSubImageCubeMap() {
+    GL::CubeMapTexture texture;
+    texture.setStorage(1, GL::TextureFormat::RGBA8, Vector2i{2})
+        .setSubImage(GL::CubeMapCoordinate::NegativeY, 0, {}, ImageView2D{PixelFormat::RGBA8Unorm, Vector2i{2}, Containers::arrayView(Data).prefix(4)});
+
+    AsyncReadback readback;
+    const UnsignedInt handle = readback.textureSubImage(texture, GL::CubeMapCoordinate::NegativeY, 0, {{}, Vector2i{2}}, PixelFormat::RGBA8Unorm);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Image2D image = readback.take(handle);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(image.size(), Vector2i{2});
+    CORRADE_COMPARE_AS(image.pixels<Color4ub>().asContiguous(),
+        Containers::arrayView(Data).prefix(4),
+        TestSuite::Compare::Container);
+}
+
+void AsyncReadbackGLTest::reuse() {
+    GL::Texture2D texture;
+    texture.setStorage(1, GL::TextureFormat::RGBA8, {4, 3})
+        .setSubImage(0, {}, ImageView2D{PixelFormat::RGBA8Unorm, {4, 3}, Data});
+
+    AsyncReadback readback;
+    const UnsignedInt a = readback.textureSubImage(texture, 0, {{}, {4, 3}}, PixelFormat::RGBA8Unorm);
+    const UnsignedInt b = readback.textureSubImage(texture, 0, {{}, {1, 1}}, PixelFormat::RGBA8Unorm);
+    CORRADE_VERIFY(a != b);
+    CORRADE_COMPARE(readback.pendingCount(), 2);
+
+    /* Taking out of order is fine */
+    Image2D imageB = readback.take(b);
+    CORRADE_COMPARE(readback.pendingCount(), 1);
+    CORRADE_COMPARE(imageB.size(), (Vector2i{1, 1}));
+
+    /* A new read reuses the free slot, handle is different from both */
+    const UnsignedInt c = readback.textureSubImage(texture, 0, {{2, 1}, {4, 3}}, PixelFormat::RGBA8Unorm);
+    CORRADE_VERIFY(c != a);
+    CORRADE_VERIFY(c != b);
+    CORRADE_COMPARE(readback.pendingCount(), 2);
+
+    Image2D imageA = readback.take(a);
+    Image2D imageC = readback.take(c);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(readback.pendingCount(), 0);
+    CORRADE_COMPARE(imageB.pixels<Color4ub>()[0][0], Data[0]);
+    CORRADE_COMPARE_AS(imageA.pixels<Color4ub>().asContiguous(),
+        Containers::arrayView(Data),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(imageC.pixels<Color4ub>().asContiguous(), Containers::arrayView<Color4ub>({
+        0x778899aa_rgba, 0x8899aabb_rgba,
+        0xbbccddee_rgba, 0xccddeeff_rgba
+    }), TestSuite::Compare::Container);
+}
+
+void AsyncReadbackGLTest::bufferData() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::copy_buffer>())
+        CORRADE_SKIP(GL::Extensions::ARB::copy_buffer::string() << "is not supported.");
+    #endif
+
+    GL::Buffer buffer{Data};
+
+    AsyncReadback readback;
+    const UnsignedInt handle = readback.bufferData(buffer);
+    CORRADE_VERIFY(handle);
+    CORRADE_COMPARE(readback.pendingCount(), 1);
+
+    /* The capture should contain the data at the time it was scheduled, not
+       what's there after */
+    buffer.setSubData(0, Containers::arrayView({0xffffffff_rgba}));
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Containers::Array<char> data = readback.takeBuffer(handle);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(readback.pendingCount(), 0);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color4ub>(data),
+        Containers::arrayView(Data),
+        TestSuite::Compare::Container);
+}
+
+void AsyncReadbackGLTest::bufferSubData() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::copy_buffer>())
+        CORRADE_SKIP(GL::Extensions::ARB::copy_buffer::string() << "is not supported.");
+    #endif
+
+    GL::Buffer buffer{Data};
+
+    AsyncReadback readback;
+    const UnsignedInt a = readback.bufferSubData(buffer, 2*4, 3*4);
+    /* Zero-size captures are allowed */
+    const UnsignedInt b = readback.bufferSubData(buffer, 4, 0);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(readback.pendingCount(), 2);
+
+    Containers::Array<char> dataB = readback.takeBuffer(b);
+    Containers::Array<char> dataA = readback.takeBuffer(a);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(dataB.size(), 0);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color4ub>(dataA),
+        Containers::arrayView(Data).slice(2, 5),
+        TestSuite::Compare::Container);
+}
+
+void AsyncReadbackGLTest::bufferReuse() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::copy_buffer>())
+        CORRADE_SKIP(GL::Extensions::ARB::copy_buffer::string() << "is not supported.");
+    #endif
+
+    GL::Texture2D texture;
+    texture.setStorage(1, GL::TextureFormat::RGBA8, {4, 3})
+        .setSubImage(0, {}, ImageView2D{PixelFormat::RGBA8Unorm, {4, 3}, Data});
+    GL::Buffer buffer{Data};
+
+    /* Image reads and buffer captures can be mixed */
+    AsyncReadback readback;
+    const UnsignedInt a = readback.bufferData(buffer);
+    const UnsignedInt b = readback.textureSubImage(texture, 0, {{}, {1, 1}}, PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(readback.pendingCount(), 2);
+
+    Containers::Array<char> dataA = readback.takeBuffer(a);
+    Image2D imageB = readback.take(b);
+    CORRADE_COMPARE(readback.pendingCount(), 0);
+
+    /* A smaller capture reuses the previous buffer, a capture into a slot
+       previously used for an image allocates a new one */
+    const UnsignedInt c = readback.bufferSubData(buffer, 4, 4);
+    const UnsignedInt d = readback.bufferSubData(buffer, 0, 4*4);
+    CORRADE_VERIFY(c != a);
+    CORRADE_VERIFY(d != b);
+    CORRADE_COMPARE(readback.pendingCount(), 2);
+
+    Containers::Array<char> dataC = readback.takeBuffer(c);
+    Containers::Array<char> dataD = readback.takeBuffer(d);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color4ub>(dataA),
+        Containers::arrayView(Data),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(imageB.pixels<Color4ub>()[0][0], Data[0]);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color4ub>(dataC),
+        Containers::arrayView(Data).slice(1, 2),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color4ub>(dataD),
+        Containers::arrayView(Data).prefix(4),
+        TestSuite::Compare::Container);
+}
+
+void AsyncReadbackGLTest::isReadyInvalidHandle() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    AsyncReadback readback;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    readback.isReady(0);
+    readback.isReady(1);
+    CORRADE_COMPARE(out.str(),
+        "DebugTools::AsyncReadback::isReady(): invalid handle 0\n"
+        "DebugTools::AsyncReadback::isReady(): invalid handle 1\n");
+}
+
+void AsyncReadbackGLTest::takeInvalidHandle() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    GL::Texture2D texture;
+    texture.setStorage(1, GL::TextureFormat::RGBA8, {4, 3});
+
+    AsyncReadback readback;
+    const UnsignedInt handle = readback.textureSubImage(texture, 0, {{}, {4, 3}}, PixelFormat::RGBA8Unorm);
+    readback.take(handle);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    /* Already taken */
+    readback.take(handle);
+    CORRADE_COMPARE(out.str(), "DebugTools::AsyncReadback::take(): invalid handle 1\n");
+}
+
+void AsyncReadbackGLTest::takeBufferInvalidHandle() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::copy_buffer>())
+        CORRADE_SKIP(GL::Extensions::ARB::copy_buffer::string() << "is not supported.");
+    #endif
+
+    GL::Texture2D texture;
+    texture.setStorage(1, GL::TextureFormat::RGBA8, {4, 3});
+    GL::Buffer buffer{Data};
+
+    AsyncReadback readback;
+    const UnsignedInt image = readback.textureSubImage(texture, 0, {{}, {4, 3}}, PixelFormat::RGBA8Unorm);
+    const UnsignedInt captured = readback.bufferData(buffer);
+    const UnsignedInt taken = readback.bufferData(buffer);
+    readback.takeBuffer(taken);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    readback.takeBuffer(taken);
+    readback.takeBuffer(image);
+    readback.take(captured);
+    CORRADE_COMPARE(out.str(),
+        "DebugTools::AsyncReadback::takeBuffer(): invalid handle 3\n"
+        "DebugTools::AsyncReadback::takeBuffer(): handle 1 is an image read, use take() instead\n"
+        "DebugTools::AsyncReadback::take(): handle 2 is a buffer capture, use takeBuffer() instead\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::AsyncReadbackGLTest)
@@ -29,6 +29,7 @@
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringStl.h> /** @todo drop once Debug is stream-free */
 #include <Corrade/Containers/Triple.h>
@@ -68,6 +69,11 @@ struct CompareImageTest: TestSuite::Tester {
     void calculateDeltaStorage();
     void calculateDeltaSpecials();
     void calculateDeltaSpecials3();
+    void calculateDeltaIdentical();
+    void calculateDeltaIdenticalStorage();
+    void calculateDeltaRgba8();
+    void calculateDeltaRgba8Strided();
+    void calculateDeltaLarge();
 
     void deltaImage();
     void deltaImageScaling();
@@ -80,6 +86,14 @@ struct CompareImageTest: TestSuite::Tester {
     void pixelDeltaHalf();
     void pixelDeltaSpecials();
 
+    void ssim();
+    void ssimIntegral();
+    void ssimIdentical();
+    void tileDelta();
+    void tileDeltaSpecials();
+    void tileDeltaPrint();
+    void tileDeltaPrintEmpty();
+
     void compareDifferentSize();
     void compareDifferentFormat();
     void compareSameZeroThreshold();
@@ -90,6 +104,9 @@ struct CompareImageTest: TestSuite::Tester {
     void compareSpecials();
     void compareSpecialsMeanOnly();
     void compareSpecialsDisallowedThreshold();
+    void compareBelowSsimThreshold();
+    void compareTilesSsim();
+    void compareInvalidTileSizeSsimThreshold();
 
     void setupExternalPluginManager();
     void teardownExternalPluginManager();
@@ -158,6 +175,11 @@ CompareImageTest::CompareImageTest() {
               &CompareImageTest::calculateDeltaStorage,
               &CompareImageTest::calculateDeltaSpecials,
               &CompareImageTest::calculateDeltaSpecials3,
+              &CompareImageTest::calculateDeltaIdentical,
+              &CompareImageTest::calculateDeltaIdenticalStorage,
+              &CompareImageTest::calculateDeltaRgba8,
+              &CompareImageTest::calculateDeltaRgba8Strided,
+              &CompareImageTest::calculateDeltaLarge,
 
               &CompareImageTest::deltaImage,
               &CompareImageTest::deltaImageScaling,
@@ -170,6 +192,14 @@ CompareImageTest::CompareImageTest() {
               &CompareImageTest::pixelDeltaHalf,
               &CompareImageTest::pixelDeltaSpecials,
 
+              &CompareImageTest::ssim,
+              &CompareImageTest::ssimIntegral,
+              &CompareImageTest::ssimIdentical,
+              &CompareImageTest::tileDelta,
+              &CompareImageTest::tileDeltaSpecials,
+              &CompareImageTest::tileDeltaPrint,
+              &CompareImageTest::tileDeltaPrintEmpty,
+
               &CompareImageTest::compareDifferentSize,
               &CompareImageTest::compareDifferentFormat,
               &CompareImageTest::compareSameZeroThreshold,
@@ -180,6 +210,9 @@ CompareImageTest::CompareImageTest() {
               &CompareImageTest::compareSpecials,
               &CompareImageTest::compareSpecialsMeanOnly,
               &CompareImageTest::compareSpecialsDisallowedThreshold,
+              &CompareImageTest::compareBelowSsimThreshold,
+              &CompareImageTest::compareTilesSsim,
+              &CompareImageTest::compareInvalidTileSizeSsimThreshold,
 
               &CompareImageTest::imageZeroDelta,
               &CompareImageTest::imageNonZeroDelta,
@@ -397,6 +430,118 @@ void CompareImageTest::calculateDeltaStorage() {
     CORRADE_COMPARE(deltaMaxMean.third(), 18.5f);
 }
 
+void CompareImageTest::calculateDeltaIdentical() {
+    /* Bitwise identical specials should result in a zero delta as well */
+    const Float data[]{
+        Constants::nan(), -Constants::inf(), 0.3f,
+        Constants::inf(), -0.0f, 1.0f
+    };
+    const ImageView2D image{PixelFormat::R32F, {3, 2}, data};
+
+    Containers::Triple<Containers::Array<Float>, Float, Float> deltaMaxMean = Implementation::calculateImageDelta(image.format(), image.pixels(), image);
+    CORRADE_COMPARE_AS(deltaMaxMean.first(), Containers::arrayView<Float>({
+        0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(deltaMaxMean.second(), 0.0f);
+    CORRADE_COMPARE(deltaMaxMean.third(), 0.0f);
+}
+
+void CompareImageTest::calculateDeltaIdenticalStorage() {
+    /* Same pixels as ActualRgb but with a different storage, so the rows
+       aren't contiguous and the bytes outside of the pixels differ */
+    const UnsignedByte data[]{
+        0xff, 0xff, 0xff, 0x56, 0xf8, 0x3a, 0x56, 0x47, 0xec, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0x23, 0x57, 0x10, 0xab, 0xcd, 0x85, 0xff, 0xff, 0xff
+    };
+    const ImageView2D image{
+        PixelStorage{}.setSkip({1, 0, 0}).setRowLength(4),
+        PixelFormat::RGB8Unorm, {2, 2}, data};
+
+    Containers::Triple<Containers::Array<Float>, Float, Float> deltaMaxMean = Implementation::calculateImageDelta(ActualRgb.format(), ActualRgb.pixels(), image);
+    CORRADE_COMPARE_AS(deltaMaxMean.first(), Containers::arrayView<Float>({
+        0.0f, 0.0f,
+        0.0f, 0.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(deltaMaxMean.second(), 0.0f);
+    CORRADE_COMPARE(deltaMaxMean.third(), 0.0f);
+}
+
+void CompareImageTest::calculateDeltaRgba8() {
+    /* Seven pixels in a row, so both the four-pixel SIMD blocks (if enabled)
+       and the scalar remainder get tested */
+    const Color4ub actualData[]{
+        {0, 0, 0, 0}, {255, 255, 255, 255}, {10, 20, 30, 40}, {0, 255, 0, 255},
+        {1, 2, 3, 4}, {100, 100, 100, 100}, {255, 0, 255, 0},
+
+        {5, 5, 5, 5}, {6, 6, 6, 6}, {7, 7, 7, 7}, {8, 8, 8, 8},
+        {9, 9, 9, 9}, {10, 10, 10, 10}, {11, 11, 11, 11}
+    };
+    const Color4ub expectedData[]{
+        {255, 255, 255, 255}, {0, 0, 0, 0}, {40, 30, 20, 10}, {0, 255, 0, 255},
+        {2, 2, 2, 2}, {100, 101, 100, 100}, {0, 255, 0, 255},
+
+        {5, 5, 5, 5}, {6, 6, 6, 6}, {7, 7, 7, 7}, {8, 8, 8, 8},
+        {9, 9, 9, 9}, {10, 10, 10, 10}, {11, 11, 11, 13}
+    };
+    const ImageView2D actual{PixelFormat::RGBA8Unorm, {7, 2}, actualData};
+    const ImageView2D expected{PixelFormat::RGBA8Unorm, {7, 2}, expectedData};
+
+    Containers::Triple<Containers::Array<Float>, Float, Float> deltaMaxMean = Implementation::calculateImageDelta(actual.format(), actual.pixels(), expected);
+    CORRADE_COMPARE_AS(deltaMaxMean.first(), Containers::arrayView<Float>({
+        255.0f, 255.0f, 20.0f, 0.0f, 1.0f, 0.25f, 255.0f,
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.5f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(deltaMaxMean.second(), 255.0f);
+    CORRADE_COMPARE(deltaMaxMean.third(), 786.75f/14.0f);
+}
+
+void CompareImageTest::calculateDeltaRgba8Strided() {
+    /* Every other pixel of the actual image is used, so the SIMD code path
+       can't be used for it */
+    const Color4ub actualData[]{
+        {0, 0, 0, 0}, {}, {255, 255, 255, 255}, {}, {10, 20, 30, 40}, {},
+        {0, 255, 0, 255}, {}, {1, 2, 3, 4}, {}
+    };
+    const Color4ub expectedData[]{
+        {255, 255, 255, 255}, {0, 0, 0, 0}, {40, 30, 20, 10}, {0, 255, 0, 255},
+        {2, 2, 2, 2}
+    };
+    const ImageView2D expected{PixelFormat::RGBA8Unorm, {5, 1}, expectedData};
+
+    Containers::StridedArrayView3D<const char> actualPixels{actualData, reinterpret_cast<const char*>(actualData), {1, 5, 4}, {40, 8, 1}};
+
+    Containers::Triple<Containers::Array<Float>, Float, Float> deltaMaxMean = Implementation::calculateImageDelta(expected.format(), actualPixels, expected);
+    CORRADE_COMPARE_AS(deltaMaxMean.first(), Containers::arrayView<Float>({
+        255.0f, 255.0f, 20.0f, 0.0f, 1.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(deltaMaxMean.second(), 255.0f);
+    CORRADE_COMPARE(deltaMaxMean.third(), 531.0f/5.0f);
+}
+
+void CompareImageTest::calculateDeltaLarge() {
+    /* Large enough to be processed on multiple threads, if available. Every
+       row has a delta of 1 in the first pixel, with the max of 7 in the last
+       row. */
+    const Vector2i size{1024, 1024};
+    Image2D actual{PixelFormat::R8Unorm, size, Containers::Array<char>{ValueInit, std::size_t(size.product())}};
+    Image2D expected{PixelFormat::R8Unorm, size, Containers::Array<char>{ValueInit, std::size_t(size.product())}};
+    for(Int y = 0; y != size.y(); ++y)
+        actual.pixels<UnsignedByte>()[y][0] = 1;
+    actual.pixels<UnsignedByte>()[size.y() - 1][size.x() - 1] = 7;
+
+    Containers::Triple<Containers::Array<Float>, Float, Float> deltaMaxMean = Implementation::calculateImageDelta(actual.format(), actual.pixels(), expected);
+    Containers::StridedArrayView2D<const Float> delta{deltaMaxMean.first(), {std::size_t(size.y()), std::size_t(size.x())}};
+    for(Int y = 0; y != size.y(); ++y) {
+        CORRADE_ITERATION(y);
+        CORRADE_COMPARE(delta[y][0], 1.0f);
+        CORRADE_COMPARE(delta[y][1], 0.0f);
+    }
+    CORRADE_COMPARE(delta[size.y() - 1][size.x() - 1], 7.0f);
+    CORRADE_COMPARE(deltaMaxMean.second(), 7.0f);
+    CORRADE_COMPARE(deltaMaxMean.third(), (1024.0f + 7.0f)/(1024.0f*1024.0f));
+}
+
 /* Variants:
     -   expected number, got inf (and inverse)
     -   expected number, got nan (and inverse)
@@ -647,6 +792,92 @@ void CompareImageTest::pixelDeltaSpecials() {
     #endif
 }
 
+void CompareImageTest::ssim() {
+    /* Four windows, one of them with just a single pixel. Values calculated
+       with an independent implementation of the same algorithm. */
+    CORRADE_COMPARE(Implementation::calculateImageSsim(ActualRed.format(), ActualRed.pixels(), ExpectedRed, {2, 2}), 0.658522f);
+
+    /* A single window covering the whole image */
+    CORRADE_COMPARE(Implementation::calculateImageSsim(ActualRed.format(), ActualRed.pixels(), ExpectedRed, {8, 8}), 0.589255f);
+}
+
+void CompareImageTest::ssimIntegral() {
+    /* The dynamic range is 255 for 8-bit types, channels are averaged */
+    CORRADE_COMPARE(Implementation::calculateImageSsim(ActualRgb.format(), ActualRgb.pixels(), ExpectedRgb, {8, 8}), 0.914511f);
+}
+
+void CompareImageTest::ssimIdentical() {
+    CORRADE_COMPARE(Implementation::calculateImageSsim(ActualRed.format(), ActualRed.pixels(), ActualRed, {2, 2}), 1.0f);
+    CORRADE_COMPARE(Implementation::calculateImageSsim(ActualRgb.format(), ActualRgb.pixels(), ActualRgb, {1, 1}), 1.0f);
+}
+
+void CompareImageTest::tileDelta() {
+    /* Partial tiles on the right and top edge */
+    Containers::Array<Containers::Pair<Float, Float>> tiles = Implementation::calculateTileDeltas(DeltaRed, {3, 3}, {2, 2});
+    CORRADE_COMPARE(tiles.size(), 4);
+    CORRADE_COMPARE(tiles[0].first(), 0.35f);
+    CORRADE_COMPARE(tiles[0].second(), 0.09f);
+    CORRADE_COMPARE(tiles[1].first(), 0.3f);
+    CORRADE_COMPARE(tiles[1].second(), 0.2f);
+    CORRADE_COMPARE(tiles[2].first(), 1.0f);
+    CORRADE_COMPARE(tiles[2].second(), 0.56f);
+    CORRADE_COMPARE(tiles[3].first(), 0.0f);
+    CORRADE_COMPARE(tiles[3].second(), 0.0f);
+}
+
+void CompareImageTest::tileDeltaSpecials() {
+    const Float deltas[]{
+        1.0f, Constants::nan(), 0.5f, 0.0f,
+        3.0f, 0.5f, 2.0f, Constants::inf()
+    };
+
+    /* Specials are ignored in the max but propagated to the mean, same as
+       when calculating the max and mean for the whole image */
+    Containers::Array<Containers::Pair<Float, Float>> tiles = Implementation::calculateTileDeltas(deltas, {4, 2}, {2, 2});
+    CORRADE_COMPARE(tiles.size(), 2);
+    CORRADE_COMPARE(tiles[0].first(), 3.0f);
+    CORRADE_COMPARE(tiles[0].second(), Constants::nan());
+    CORRADE_COMPARE(tiles[1].first(), 2.0f);
+    CORRADE_COMPARE(tiles[1].second(), Constants::inf());
+}
+
+void CompareImageTest::tileDeltaPrint() {
+    Containers::Array<Containers::Pair<Float, Float>> tiles = Implementation::calculateTileDeltas(DeltaRed, {3, 3}, {2, 2});
+
+    {
+        Debug out;
+        out << "Visual verification -- first max should be red, both means yellow:";
+        Implementation::printTileDeltas(out, tiles, {3, 3}, {2, 2}, 0.5f, 0.1f, 10);
+    }
+
+    std::ostringstream out;
+    Debug d{&out, Debug::Flag::DisableColors};
+    Implementation::printTileDeltas(d, tiles, {3, 3}, {2, 2}, 0.5f, 0.1f, 10);
+
+    /* The first tile has the mean below threshold */
+    CORRADE_COMPARE(out.str(), "\n"
+        "        Tiles above max/mean threshold:\n"
+        "          [0,2] 2x1 tile, max Δ = 1, mean Δ = 0.56\n"
+        "          [2,0] 1x2 tile, max Δ = 0.3, mean Δ = 0.2");
+
+    std::ostringstream outOverflow;
+    Debug dOverflow{&outOverflow, Debug::Flag::DisableColors};
+    Implementation::printTileDeltas(dOverflow, tiles, {3, 3}, {2, 2}, 0.5f, 0.1f, 1);
+    CORRADE_COMPARE(outOverflow.str(), "\n"
+        "        Top 1 out of 2 tiles above max/mean threshold:\n"
+        "          [0,2] 2x1 tile, max Δ = 1, mean Δ = 0.56");
+}
+
+void CompareImageTest::tileDeltaPrintEmpty() {
+    Containers::Array<Containers::Pair<Float, Float>> tiles = Implementation::calculateTileDeltas(DeltaRed, {3, 3}, {2, 2});
+
+    std::ostringstream out;
+    Debug d{&out, Debug::Flag::DisableColors};
+    Implementation::printTileDeltas(d, tiles, {3, 3}, {2, 2}, 1.0f, 1.0f, 10);
+
+    CORRADE_COMPARE(out.str(), "");
+}
+
 void CompareImageTest::compareDifferentSize() {
     std::stringstream out;
 
@@ -986,6 +1217,76 @@ void CompareImageTest::compareSpecialsDisallowedThreshold() {
         "DebugTools::CompareImage: thresholds can't be NaN or infinity\n");
 }
 
+void CompareImageTest::compareBelowSsimThreshold() {
+    std::stringstream out;
+
+    {
+        TestSuite::Comparator<CompareImage> compare{40.0f, 20.0f};
+        compare.setSsimThreshold(0.95f);
+        TestSuite::ComparisonStatusFlags flags = compare(ActualRgb, ExpectedRgb);
+        /* No diagnostic as we don't have any expected filename */
+        CORRADE_COMPARE(flags, TestSuite::ComparisonStatusFlag::Failed);
+        Debug d{&out, Debug::Flag::DisableColors};
+        compare.printMessage(flags, d, "a", "b");
+    }
+
+    CORRADE_COMPARE(out.str(),
+        "Images a and b have structural similarity below threshold, actual 0.914511 but at least 0.95 expected. Deltas 39/18.5 are within threshold 40/20. Delta image:\n"
+        "          |?M|\n"
+        "        Pixels above max/mean threshold:\n"
+        "          [1,1] #abcd85, expected #abcdfa (Δ = 39)\n");
+}
+
+void CompareImageTest::compareTilesSsim() {
+    std::stringstream out;
+
+    {
+        /* Only reporting the SSIM, not failing on it */
+        TestSuite::Comparator<CompareImage> compare{30.0f, 20.0f};
+        compare.setTileSize({1, 1});
+        compare.setSsimThreshold(-1.0f);
+        TestSuite::ComparisonStatusFlags flags = compare(ActualRgb, ExpectedRgb);
+        /* No diagnostic as we don't have any expected filename */
+        CORRADE_COMPARE(flags, TestSuite::ComparisonStatusFlag::Failed);
+        Debug d{&out, Debug::Flag::DisableColors};
+        compare.printMessage(flags, d, "a", "b");
+    }
+
+    CORRADE_COMPARE(out.str(),
+        "Images a and b have max delta above threshold, actual 39 but at most 30 expected. Mean delta 18.5 is within threshold 20. Structural similarity 0.914511. Delta image:\n"
+        "          |?M|\n"
+        "        Pixels above max/mean threshold:\n"
+        "          [1,1] #abcd85, expected #abcdfa (Δ = 39)\n"
+        "        Tiles above max/mean threshold:\n"
+        "          [1,1] 1x1 tile, max Δ = 39, mean Δ = 39\n");
+
+    /* Same images pass with a SSIM threshold set, without calculating it */
+    {
+        TestSuite::Comparator<CompareImage> compare;
+        compare.setTileSize({1, 1});
+        compare.setSsimThreshold(1.0f);
+        CORRADE_COMPARE(compare(ActualRgb, ActualRgb), TestSuite::ComparisonStatusFlags{});
+    }
+}
+
+void CompareImageTest::compareInvalidTileSizeSsimThreshold() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::stringstream out;
+
+    {
+        Error redirectError{&out};
+        CompareImage{}.setTileSize({16, 0});
+        CompareImage{}.setSsimThreshold(1.5f);
+        CompareImage{}.setSsimThreshold(-2.0f);
+    }
+
+    CORRADE_COMPARE(out.str(),
+        "DebugTools::CompareImage::setTileSize(): expected a positive size, got {16, 0}\n"
+        "DebugTools::CompareImage::setSsimThreshold(): expected a value between -1 and 1, got 1.5\n"
+        "DebugTools::CompareImage::setSsimThreshold(): expected a value between -1 and 1, got -2\n");
+}
+
 void CompareImageTest::setupExternalPluginManager() {
     _importerManager.emplace("nonexistent");
     _converterManager.emplace("nonexistent");
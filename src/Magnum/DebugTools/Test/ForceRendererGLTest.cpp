@@ -34,6 +34,7 @@
 #include "Magnum/PixelFormat.h"
 #include "Magnum/DebugTools/CompareImage.h"
 #include "Magnum/DebugTools/ForceRenderer.h"
+#include "Magnum/DebugTools/RendererBatch.h"
 #include "Magnum/DebugTools/ResourceManager.h"
 #include "Magnum/GL/Framebuffer.h"
 #include "Magnum/GL/OpenGLTester.h"
@@ -45,11 +46,10 @@
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/Trade/AbstractImporter.h"
 
-#include "configure.h"
-
-#ifdef CORRADE_TARGET_ANDROID
 #include "Magnum/GL/Context.h"
-#endif
+#include "Magnum/GL/Extensions.h"
+
+#include "configure.h"
 
 namespace Magnum { namespace DebugTools { namespace Test { namespace {
 
@@ -63,9 +63,18 @@ struct ForceRendererGLTest: GL::OpenGLTester {
         PluginManager::Manager<Trade::AbstractImporter> _manager{"nonexistent"};
 };
 
+const struct {
+    const char* name;
+    bool batched;
+} RenderData[]{
+    {"", false},
+    {"batched", true}
+};
+
 ForceRendererGLTest::ForceRendererGLTest() {
-    addTests({&ForceRendererGLTest::render2D,
-              &ForceRendererGLTest::render3D});
+    addInstancedTests({&ForceRendererGLTest::render2D,
+                       &ForceRendererGLTest::render3D},
+        Containers::arraySize(RenderData));
 
     /* Load the plugins directly from the build tree. Otherwise they're either
        static and already loaded or not present in the build tree */
@@ -80,6 +89,26 @@ ForceRendererGLTest::ForceRendererGLTest() {
 using namespace Math::Literals;
 
 void ForceRendererGLTest::render2D() {
+    auto&& data = RenderData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(data.batched) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::instanced_arrays>())
+            CORRADE_SKIP(GL::Extensions::ARB::instanced_arrays::string() << "is not supported.");
+        #elif defined(MAGNUM_TARGET_GLES2)
+        #ifndef MAGNUM_TARGET_WEBGL
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ANGLE::instanced_arrays>() &&
+           !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::instanced_arrays>() &&
+           !GL::Context::current().isExtensionSupported<GL::Extensions::NV::instanced_arrays>())
+            CORRADE_SKIP("GL_{ANGLE,EXT,NV}_instanced_arrays is not supported");
+        #else
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ANGLE::instanced_arrays>())
+            CORRADE_SKIP(GL::Extensions::ANGLE::instanced_arrays::string() << "is not supported.");
+        #endif
+        #endif
+    }
+
     SceneGraph::Scene<SceneGraph::MatrixTransformation2D> scene;
 
     SceneGraph::DrawableGroup2D drawables;
@@ -93,6 +122,8 @@ void ForceRendererGLTest::render2D() {
     object.translate({-1.0f, -1.0f});
     Vector2 force{2.0f, 2.0f};
     ForceRenderer2D renderer{manager, object, {}, force, "my", &drawables};
+    RendererBatch2D batch;
+    if(data.batched) renderer.setBatch(&batch);
 
     GL::Renderbuffer color;
     color.setStorage(
@@ -108,6 +139,12 @@ void ForceRendererGLTest::render2D() {
         .bind();
 
     camera.draw(drawables);
+    if(data.batched) {
+        CORRADE_COMPARE(batch.forceCount(), 1);
+        CORRADE_COMPARE(batch.objectCount(), 0);
+        batch.draw(camera);
+        CORRADE_COMPARE(batch.forceCount(), 0);
+    }
 
     MAGNUM_VERIFY_NO_GL_ERROR();
 
@@ -132,6 +169,26 @@ void ForceRendererGLTest::render2D() {
 }
 
 void ForceRendererGLTest::render3D() {
+    auto&& data = RenderData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(data.batched) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::instanced_arrays>())
+            CORRADE_SKIP(GL::Extensions::ARB::instanced_arrays::string() << "is not supported.");
+        #elif defined(MAGNUM_TARGET_GLES2)
+        #ifndef MAGNUM_TARGET_WEBGL
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ANGLE::instanced_arrays>() &&
+           !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::instanced_arrays>() &&
+           !GL::Context::current().isExtensionSupported<GL::Extensions::NV::instanced_arrays>())
+            CORRADE_SKIP("GL_{ANGLE,EXT,NV}_instanced_arrays is not supported");
+        #else
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ANGLE::instanced_arrays>())
+            CORRADE_SKIP(GL::Extensions::ANGLE::instanced_arrays::string() << "is not supported.");
+        #endif
+        #endif
+    }
+
     SceneGraph::Scene<SceneGraph::MatrixTransformation3D> scene;
 
     SceneGraph::DrawableGroup3D drawables;
@@ -149,6 +206,8 @@ void ForceRendererGLTest::render3D() {
         .translate({-0.5f, -1.0f, 1.0f});
     Vector3 force{2.0f, 2.0f, 0.0f};
     ForceRenderer3D renderer{manager, object, {}, force, "my", &drawables};
+    RendererBatch3D batch;
+    if(data.batched) renderer.setBatch(&batch);
 
     GL::Renderbuffer color;
     color.setStorage(
@@ -164,6 +223,12 @@ void ForceRendererGLTest::render3D() {
         .bind();
 
     camera.draw(drawables);
+    if(data.batched) {
+        CORRADE_COMPARE(batch.forceCount(), 1);
+        CORRADE_COMPARE(batch.objectCount(), 0);
+        batch.draw(camera);
+        CORRADE_COMPARE(batch.forceCount(), 0);
+    }
 
     MAGNUM_VERIFY_NO_GL_ERROR();
 
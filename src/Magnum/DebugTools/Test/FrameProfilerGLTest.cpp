@@ -28,6 +28,7 @@
 #include <Corrade/Utility/System.h>
 
 #include "Magnum/DebugTools/FrameProfiler.h"
+#include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Framebuffer.h"
@@ -50,6 +51,8 @@ struct FrameProfilerGLTest: GL::OpenGLTester {
     explicit FrameProfilerGLTest();
 
     void test();
+    void contextStatistics();
+    void gpuScopes();
     #ifndef MAGNUM_TARGET_GLES
     void vertexFetchRatioDivisionByZero();
     void primitiveClipRatioDivisionByZero();
@@ -76,6 +79,9 @@ FrameProfilerGLTest::FrameProfilerGLTest() {
     addInstancedTests({&FrameProfilerGLTest::test},
         Containers::arraySize(Data));
 
+    addTests({&FrameProfilerGLTest::contextStatistics,
+              &FrameProfilerGLTest::gpuScopes});
+
     #ifndef MAGNUM_TARGET_GLES
     addTests({&FrameProfilerGLTest::vertexFetchRatioDivisionByZero,
               &FrameProfilerGLTest::primitiveClipRatioDivisionByZero,
@@ -198,6 +204,130 @@ void FrameProfilerGLTest::test() {
     #endif
 }
 
+void FrameProfilerGLTest::contextStatistics() {
+    /* Bind some FB to avoid errors on contexts w/o default FB */
+    GL::Renderbuffer color;
+    color.setStorage(
+        #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+        GL::RenderbufferFormat::RGBA8,
+        #else
+        GL::RenderbufferFormat::RGBA4,
+        #endif
+        Vector2i{32});
+    GL::Framebuffer fb{{{}, Vector2i{32}}};
+    fb.attachRenderbuffer(GL::Framebuffer::ColorAttachment{0}, color)
+      .bind();
+
+    GL::Mesh mesh = MeshTools::compile(Primitives::cubeSolid());
+    Shaders::FlatGL3D a, b;
+
+    GL::Buffer buffer;
+    buffer.setData({nullptr, 64}, GL::BufferUsage::DynamicDraw);
+    const Float data[4]{};
+
+    FrameProfilerGL profiler{
+        FrameProfilerGL::Value::DrawCount|
+        FrameProfilerGL::Value::ShaderProgramSwitchCount|
+        FrameProfilerGL::Value::BufferUploadCount|
+        FrameProfilerGL::Value::BufferUploadSize, 4};
+    CORRADE_COMPARE(profiler.values(),
+        FrameProfilerGL::Value::DrawCount|
+        FrameProfilerGL::Value::ShaderProgramSwitchCount|
+        FrameProfilerGL::Value::BufferUploadCount|
+        FrameProfilerGL::Value::BufferUploadSize);
+    CORRADE_COMPARE(profiler.measurementName(0), "Draw calls");
+    CORRADE_COMPARE(profiler.measurementUnits(3), FrameProfiler::Units::Bytes);
+    CORRADE_VERIFY(!profiler.isMeasurementAvailable(FrameProfilerGL::Value::DrawCount));
+
+    /* Each frame switches between two shaders, draws three times and uploads
+       16 bytes */
+    for(std::size_t i = 0; i != 4; ++i) {
+        profiler.beginFrame();
+        buffer.setSubData(0, data);
+        a.draw(mesh);
+        a.draw(mesh);
+        b.draw(mesh);
+        profiler.endFrame();
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_VERIFY(profiler.isMeasurementAvailable(FrameProfilerGL::Value::DrawCount));
+    CORRADE_COMPARE(profiler.measurementMean(FrameProfilerGL::Value::DrawCount), 3.0);
+    CORRADE_COMPARE(profiler.measurementMean(FrameProfilerGL::Value::ShaderProgramSwitchCount), 2.0);
+    CORRADE_COMPARE(profiler.measurementMean(FrameProfilerGL::Value::BufferUploadCount), 1.0);
+    CORRADE_COMPARE(profiler.measurementMean(FrameProfilerGL::Value::BufferUploadSize), 16.0);
+}
+
+void FrameProfilerGLTest::gpuScopes() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::timer_query>())
+        CORRADE_SKIP(GL::Extensions::ARB::timer_query::string() << "is not supported.");
+    #elif defined(MAGNUM_TARGET_WEBGL) && !defined(MAGNUM_TARGET_GLES2)
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::disjoint_timer_query_webgl2>())
+        CORRADE_SKIP(GL::Extensions::EXT::disjoint_timer_query_webgl2::string() << "is not supported.");
+    #else
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::disjoint_timer_query>())
+        CORRADE_SKIP(GL::Extensions::EXT::disjoint_timer_query::string() << "is not supported.");
+    #endif
+
+    /* Bind some FB to avoid errors on contexts w/o default FB */
+    GL::Renderbuffer color;
+    color.setStorage(
+        #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+        GL::RenderbufferFormat::RGBA8,
+        #else
+        GL::RenderbufferFormat::RGBA4,
+        #endif
+        Vector2i{32});
+    GL::Framebuffer fb{{{}, Vector2i{32}}};
+    fb.attachRenderbuffer(GL::Framebuffer::ColorAttachment{0}, color)
+      .bind();
+
+    GL::Mesh mesh = MeshTools::compile(Primitives::cubeSolid());
+    Shaders::FlatGL3D shader;
+
+    FrameProfilerGL profiler{FrameProfilerGL::Value::GpuDuration, {
+        "Shadow pass", "Main pass", "Never entered"}, 4};
+    CORRADE_COMPARE(profiler.values(), FrameProfilerGL::Value::GpuDuration);
+    CORRADE_COMPARE(profiler.gpuScopeCount(), 3);
+    CORRADE_COMPARE(profiler.measurementCount(), 4);
+    CORRADE_COMPARE(profiler.measurementName(1), "Shadow pass");
+    CORRADE_COMPARE(profiler.measurementName(2), "Main pass");
+    CORRADE_COMPARE(profiler.measurementUnits(3), FrameProfiler::Units::Nanoseconds);
+
+    for(std::size_t i = 0; i != 6; ++i) {
+        profiler.beginFrame();
+        profiler.beginGpuScope(0);
+        shader.draw(mesh);
+        profiler.endGpuScope(0);
+        /* Nested inside the whole frame GPU duration query */
+        profiler.beginGpuScope(1);
+        for(std::size_t j = 0; j != 10; ++j)
+            shader.draw(mesh);
+        profiler.endGpuScope(1);
+        profiler.endFrame();
+        MAGNUM_VERIFY_NO_GL_ERROR();
+
+        /* The delay is the same as for GpuDuration */
+        CORRADE_COMPARE(profiler.isGpuScopeMeasurementAvailable(0), i >= 2);
+    }
+
+    CORRADE_VERIFY(profiler.isGpuScopeMeasurementAvailable(0));
+    CORRADE_VERIFY(profiler.isGpuScopeMeasurementAvailable(1));
+    CORRADE_VERIFY(profiler.isGpuScopeMeasurementAvailable(2));
+
+    /* GPU timing is imprecise, so just verify that the scopes recorded
+       something and the scope that was never entered didn't */
+    CORRADE_COMPARE_AS(profiler.gpuScopeMean(0), 0.0,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(profiler.gpuScopeMean(1), 0.0,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE(profiler.gpuScopeMean(2), 0.0);
+    CORRADE_COMPARE_AS(profiler.gpuDurationMean(), profiler.gpuScopeMean(1),
+        TestSuite::Compare::GreaterOrEqual);
+}
+
 #ifndef MAGNUM_TARGET_GLES
 void FrameProfilerGLTest::vertexFetchRatioDivisionByZero() {
     if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::pipeline_statistics_query>())
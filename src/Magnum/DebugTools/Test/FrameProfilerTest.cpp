@@ -24,8 +24,10 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
 #include <sstream>
 #include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/StringView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Numeric.h>
 #include <Corrade/Utility/DebugStl.h>
@@ -62,9 +64,19 @@ struct FrameProfilerTest: TestSuite::Tester {
 
     void statistics();
 
+    void histogram();
+    void histogramLargeValues();
+    void histogramDelayed();
+    void histogramReSetup();
+    void histogramMove();
+    void histogramSnapshot();
+    void histogramNotEnabled();
+    void histogramInvalid();
+
     #ifdef MAGNUM_TARGET_GL
     void gl();
     void glNotEnabled();
+    void glGpuScopeOutOfRange();
     #endif
 
     void debugUnits();
@@ -75,6 +87,10 @@ struct FrameProfilerTest: TestSuite::Tester {
     void configurationGLValue();
     void configurationGLValues();
     #endif
+    #ifdef MAGNUM_TARGET_VK
+    void debugVkValue();
+    void debugVkValues();
+    #endif
 };
 
 struct {
@@ -134,7 +150,16 @@ FrameProfilerTest::FrameProfilerTest() {
               &FrameProfilerTest::dataNotAvailableYet,
               &FrameProfilerTest::meanNotAvailableYet,
 
-              &FrameProfilerTest::statistics});
+              &FrameProfilerTest::statistics,
+
+              &FrameProfilerTest::histogram,
+              &FrameProfilerTest::histogramLargeValues,
+              &FrameProfilerTest::histogramDelayed,
+              &FrameProfilerTest::histogramReSetup,
+              &FrameProfilerTest::histogramMove,
+              &FrameProfilerTest::histogramSnapshot,
+              &FrameProfilerTest::histogramNotEnabled,
+              &FrameProfilerTest::histogramInvalid});
 
     #ifdef MAGNUM_TARGET_GL
     addInstancedTests({&FrameProfilerTest::gl},
@@ -144,6 +169,7 @@ FrameProfilerTest::FrameProfilerTest() {
     addTests({
               #ifdef MAGNUM_TARGET_GL
               &FrameProfilerTest::glNotEnabled,
+              &FrameProfilerTest::glGpuScopeOutOfRange,
               #endif
 
               &FrameProfilerTest::debugUnits,
@@ -152,7 +178,11 @@ FrameProfilerTest::FrameProfilerTest() {
               &FrameProfilerTest::debugGLValues,
 
               &FrameProfilerTest::configurationGLValue,
-              &FrameProfilerTest::configurationGLValues
+              &FrameProfilerTest::configurationGLValues,
+              #endif
+              #ifdef MAGNUM_TARGET_VK
+              &FrameProfilerTest::debugVkValue,
+              &FrameProfilerTest::debugVkValues
               #endif
               });
 }
@@ -1093,6 +1123,301 @@ void FrameProfilerTest::statistics() {
         "  CPU usage: -.-- %");
 }
 
+void FrameProfilerTest::histogram() {
+    UnsignedLong i = 0;
+    FrameProfiler profiler{{
+        FrameProfiler::Measurement{"", FrameProfiler::Units::Count,
+            [](void*) {},
+            [](void* state) {
+                return ++*static_cast<UnsignedLong*>(state);
+            }, &i}
+    }, 5};
+    CORRADE_VERIFY(!profiler.isHistogramEnabled());
+
+    profiler.enableHistogram();
+    CORRADE_VERIFY(profiler.isHistogramEnabled());
+    CORRADE_COMPARE(profiler.histogramSampleCount(0), 0);
+    CORRADE_COMPARE(profiler.histogramMax(0), 0);
+
+    /* Values 1 to 100 */
+    for(std::size_t j = 0; j != 100; ++j) {
+        profiler.beginFrame();
+        profiler.endFrame();
+    }
+    CORRADE_COMPARE(profiler.histogramSampleCount(0), 100);
+    CORRADE_COMPARE(profiler.histogramMax(0), 100);
+
+    /* Values below 32 have exact buckets, values up to 64 are in buckets of
+       2, up to 128 in buckets of 4 */
+    CORRADE_COMPARE(profiler.histogramPercentile(0, 0.0f), 1);
+    CORRADE_COMPARE(profiler.histogramPercentile(0, 25.0f), 25);
+    CORRADE_COMPARE(profiler.histogramPercentile(0, 50.0f), 51);
+    CORRADE_COMPARE(profiler.histogramPercentile(0, 95.0f), 95);
+    CORRADE_COMPARE(profiler.histogramPercentile(0, 99.0f), 99);
+    /* Clamped to the max value, not 103 */
+    CORRADE_COMPARE(profiler.histogramPercentile(0, 100.0f), 100);
+
+    /* Disabling and enabling the profiler doesn't reset the histogram */
+    profiler.disable();
+    profiler.enable();
+    CORRADE_COMPARE(profiler.histogramSampleCount(0), 100);
+
+    profiler.resetHistogram();
+    CORRADE_VERIFY(profiler.isHistogramEnabled());
+    CORRADE_COMPARE(profiler.histogramSampleCount(0), 0);
+    CORRADE_COMPARE(profiler.histogramMax(0), 0);
+
+    profiler.beginFrame();
+    profiler.endFrame();
+    CORRADE_COMPARE(profiler.histogramSampleCount(0), 1);
+    CORRADE_COMPARE(profiler.histogramMax(0), 101);
+    CORRADE_COMPARE(profiler.histogramPercentile(0, 50.0f), 101);
+
+    profiler.disableHistogram();
+    CORRADE_VERIFY(!profiler.isHistogramEnabled());
+
+    /* Not recorded anywhere, shouldn't crash */
+    profiler.beginFrame();
+    profiler.endFrame();
+}
+
+void FrameProfilerTest::histogramLargeValues() {
+    UnsignedLong value;
+    FrameProfiler profiler{{
+        FrameProfiler::Measurement{"", FrameProfiler::Units::Nanoseconds,
+            [](void*) {},
+            [](void* state) {
+                return *static_cast<UnsignedLong*>(state);
+            }, &value}
+    }, 1};
+    profiler.enableHistogram();
+
+    /* 1 ms is in a bucket of 32768 ns, 983040 to 1015807 */
+    value = 1000000;
+    profiler.beginFrame();
+    profiler.endFrame();
+    value = 1000001;
+    profiler.beginFrame();
+    profiler.endFrame();
+    CORRADE_COMPARE(profiler.histogramPercentile(0, 50.0f), 1000001);
+
+    value = 2000000;
+    profiler.beginFrame();
+    profiler.endFrame();
+    CORRADE_COMPARE(profiler.histogramPercentile(0, 50.0f), 1015807);
+
+    /* The last bucket */
+    value = ~UnsignedLong{};
+    profiler.beginFrame();
+    profiler.endFrame();
+    CORRADE_COMPARE(profiler.histogramMax(0), ~UnsignedLong{});
+    CORRADE_COMPARE(profiler.histogramPercentile(0, 100.0f), ~UnsignedLong{});
+}
+
+void FrameProfilerTest::histogramDelayed() {
+    UnsignedLong i = 15;
+    FrameProfiler profiler{{
+        FrameProfiler::Measurement{"", FrameProfiler::Units::Count, 2,
+            [](void*, UnsignedInt) {},
+            [](void*, UnsignedInt) {},
+            [](void* state, UnsignedInt, UnsignedInt) {
+                return (*static_cast<UnsignedLong*>(state))++;
+            }, &i},
+    }, 5};
+    profiler.enableHistogram();
+
+    /* The first frame doesn't have any value yet */
+    profiler.beginFrame();
+    profiler.endFrame();
+    CORRADE_COMPARE(profiler.histogramSampleCount(0), 0);
+
+    profiler.beginFrame();
+    profiler.endFrame();
+    profiler.beginFrame();
+    profiler.endFrame();
+    CORRADE_COMPARE(profiler.histogramSampleCount(0), 2);
+    CORRADE_COMPARE(profiler.histogramMax(0), 16);
+    CORRADE_COMPARE(profiler.histogramPercentile(0, 50.0f), 15);
+}
+
+void FrameProfilerTest::histogramReSetup() {
+    FrameProfiler profiler{{
+        FrameProfiler::Measurement{"", FrameProfiler::Units::Count,
+            [](void*) {},
+            [](void*) { return UnsignedLong{7}; },
+            nullptr}
+    }, 5};
+    profiler.enableHistogram();
+    profiler.beginFrame();
+    profiler.endFrame();
+    CORRADE_COMPARE(profiler.histogramSampleCount(0), 1);
+
+    /* Same measurement count, the data is kept */
+    profiler.setup({
+        FrameProfiler::Measurement{"", FrameProfiler::Units::Count,
+            [](void*) {},
+            [](void*) { return UnsignedLong{3}; },
+            nullptr}
+    }, 10);
+    CORRADE_VERIFY(profiler.isHistogramEnabled());
+    CORRADE_COMPARE(profiler.histogramSampleCount(0), 1);
+    CORRADE_COMPARE(profiler.histogramMax(0), 7);
+
+    /* Different measurement count, reallocated */
+    profiler.setup({
+        FrameProfiler::Measurement{"", FrameProfiler::Units::Count,
+            [](void*) {},
+            [](void*) { return UnsignedLong{3}; },
+            nullptr},
+        FrameProfiler::Measurement{"", FrameProfiler::Units::Count,
+            [](void*) {},
+            [](void*) { return UnsignedLong{5}; },
+            nullptr}
+    }, 10);
+    CORRADE_VERIFY(profiler.isHistogramEnabled());
+    CORRADE_COMPARE(profiler.histogramSampleCount(0), 0);
+    CORRADE_COMPARE(profiler.histogramSampleCount(1), 0);
+
+    profiler.beginFrame();
+    profiler.endFrame();
+    CORRADE_COMPARE(profiler.histogramMax(0), 3);
+    CORRADE_COMPARE(profiler.histogramMax(1), 5);
+}
+
+void FrameProfilerTest::histogramMove() {
+    FrameProfiler a{{
+        FrameProfiler::Measurement{"", FrameProfiler::Units::Count,
+            [](void*) {},
+            [](void*) { return UnsignedLong{7}; },
+            nullptr}
+    }, 5};
+    a.enableHistogram();
+    a.beginFrame();
+    a.endFrame();
+
+    FrameProfiler b{Utility::move(a)};
+    CORRADE_VERIFY(b.isHistogramEnabled());
+    CORRADE_COMPARE(b.histogramSampleCount(0), 1);
+    CORRADE_COMPARE(b.histogramMax(0), 7);
+
+    FrameProfiler c;
+    c = Utility::move(b);
+    CORRADE_VERIFY(c.isHistogramEnabled());
+    CORRADE_VERIFY(!b.isHistogramEnabled());
+    CORRADE_COMPARE(c.histogramSampleCount(0), 1);
+    CORRADE_COMPARE(c.histogramMax(0), 7);
+}
+
+void FrameProfilerTest::histogramSnapshot() {
+    FrameProfiler profiler{{
+        FrameProfiler::Measurement{"", FrameProfiler::Units::Nanoseconds,
+            [](void*) {},
+            [](void*) { return UnsignedLong{3}; },
+            nullptr},
+        FrameProfiler::Measurement{"", FrameProfiler::Units::Bytes,
+            [](void*) {},
+            [](void*) { return UnsignedLong{17}; },
+            nullptr}
+    }, 5};
+    profiler.enableHistogram();
+    for(std::size_t i = 0; i != 3; ++i) {
+        profiler.beginFrame();
+        profiler.endFrame();
+    }
+
+    CORRADE_COMPARE(profiler.histogramSnapshotSize(), 16 + 2*(24 + FrameProfiler::HistogramBucketCount*4));
+    Containers::Array<char> snapshot = profiler.histogramSnapshot();
+    CORRADE_COMPARE(snapshot.size(), profiler.histogramSnapshotSize());
+
+    CORRADE_COMPARE((Containers::StringView{snapshot.data(), 4}), "MFPH");
+    UnsignedInt header[3];
+    std::memcpy(header, snapshot.data() + 4, sizeof(header));
+    CORRADE_COMPARE(header[0], 1);
+    CORRADE_COMPARE(header[1], 2);
+    CORRADE_COMPARE(header[2], FrameProfiler::HistogramBucketCount);
+
+    const std::size_t measurementSize = 24 + FrameProfiler::HistogramBucketCount*4;
+    for(std::size_t i = 0; i != 2; ++i) {
+        CORRADE_ITERATION(i);
+        const char* measurement = snapshot.data() + 16 + i*measurementSize;
+        UnsignedLong statistics[2];
+        UnsignedInt units[2];
+        std::memcpy(statistics, measurement, sizeof(statistics));
+        std::memcpy(units, measurement + 16, sizeof(units));
+        CORRADE_COMPARE(statistics[0], 3);
+        CORRADE_COMPARE(statistics[1], i ? 17 : 3);
+        CORRADE_COMPARE(units[0], UnsignedInt(i ? FrameProfiler::Units::Bytes : FrameProfiler::Units::Nanoseconds));
+        CORRADE_COMPARE(units[1], 0);
+
+        /* 3 is in bucket 3, 17 in bucket 17 */
+        UnsignedInt buckets[FrameProfiler::HistogramBucketCount];
+        std::memcpy(buckets, measurement + 24, sizeof(buckets));
+        for(UnsignedInt j = 0; j != FrameProfiler::HistogramBucketCount; ++j) {
+            CORRADE_ITERATION(j);
+            CORRADE_COMPARE(buckets[j], j == (i ? 17 : 3) ? 3 : 0);
+        }
+    }
+}
+
+void FrameProfilerTest::histogramNotEnabled() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FrameProfiler profiler{{
+        FrameProfiler::Measurement{"", FrameProfiler::Units::Count,
+            [](void*) {},
+            [](void*) { return UnsignedLong{}; },
+            nullptr}
+    }, 5};
+
+    char data[16 + 24 + FrameProfiler::HistogramBucketCount*4];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    profiler.resetHistogram();
+    profiler.histogramSampleCount(0);
+    profiler.histogramMax(0);
+    profiler.histogramPercentile(0, 50.0f);
+    profiler.histogramSnapshotInto(data);
+    CORRADE_COMPARE(out.str(),
+        "DebugTools::FrameProfiler::resetHistogram(): histogram not enabled\n"
+        "DebugTools::FrameProfiler::histogramSampleCount(): histogram not enabled\n"
+        "DebugTools::FrameProfiler::histogramMax(): histogram not enabled\n"
+        "DebugTools::FrameProfiler::histogramPercentile(): histogram not enabled\n"
+        "DebugTools::FrameProfiler::histogramSnapshotInto(): histogram not enabled\n");
+}
+
+void FrameProfilerTest::histogramInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FrameProfiler profiler{{
+        FrameProfiler::Measurement{"", FrameProfiler::Units::Count,
+            [](void*) {},
+            [](void*) { return UnsignedLong{}; },
+            nullptr}
+    }, 5};
+    profiler.enableHistogram();
+
+    char data[16 + 24 + FrameProfiler::HistogramBucketCount*4 + 1];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    profiler.histogramSampleCount(1);
+    profiler.histogramMax(1);
+    profiler.histogramPercentile(1, 50.0f);
+    profiler.histogramPercentile(0, -0.1f);
+    profiler.histogramPercentile(0, 100.1f);
+    profiler.histogramPercentile(0, 50.0f);
+    profiler.histogramSnapshotInto(data);
+    CORRADE_COMPARE(out.str(),
+        "DebugTools::FrameProfiler::histogramSampleCount(): index 1 out of range for 1 measurements\n"
+        "DebugTools::FrameProfiler::histogramMax(): index 1 out of range for 1 measurements\n"
+        "DebugTools::FrameProfiler::histogramPercentile(): index 1 out of range for 1 measurements\n"
+        "DebugTools::FrameProfiler::histogramPercentile(): expected percentile to be between 0 and 100 but got -0.1\n"
+        "DebugTools::FrameProfiler::histogramPercentile(): expected percentile to be between 0 and 100 but got 100.1\n"
+        "DebugTools::FrameProfiler::histogramPercentile(): no samples recorded for measurement 0\n"
+        "DebugTools::FrameProfiler::histogramSnapshotInto(): expected a view with 3944 bytes but got 3945\n");
+}
+
 #ifdef MAGNUM_TARGET_GL
 void FrameProfilerTest::gl() {
     auto&& data = GLData[testCaseInstanceId()];
@@ -1172,6 +1497,26 @@ void FrameProfilerTest::glNotEnabled() {
         "DebugTools::FrameProfilerGL::cpuDurationMean(): not enabled\n"
         "DebugTools::FrameProfilerGL::gpuDurationMean(): not enabled\n");
 }
+
+void FrameProfilerTest::glGpuScopeOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    /* Without any GPU scopes this doesn't need a GL context */
+    FrameProfilerGL profiler{FrameProfilerGL::Value::CpuDuration, 5};
+    CORRADE_COMPARE(profiler.gpuScopeCount(), 0);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    profiler.beginGpuScope(0);
+    profiler.endGpuScope(0);
+    profiler.isGpuScopeMeasurementAvailable(0);
+    profiler.gpuScopeMean(0);
+    CORRADE_COMPARE(out.str(),
+        "DebugTools::FrameProfilerGL::beginGpuScope(): index 0 out of range for 0 GPU scopes\n"
+        "DebugTools::FrameProfilerGL::endGpuScope(): index 0 out of range for 0 GPU scopes\n"
+        "DebugTools::FrameProfilerGL::isGpuScopeMeasurementAvailable(): index 0 out of range for 0 GPU scopes\n"
+        "DebugTools::FrameProfilerGL::gpuScopeMean(): index 0 out of range for 0 GPU scopes\n");
+}
 #endif
 
 void FrameProfilerTest::debugUnits() {
@@ -1223,12 +1568,28 @@ void FrameProfilerTest::configurationGLValues() {
     CORRADE_COMPARE(c.value("empty"), "");
     CORRADE_COMPARE(c.value<FrameProfilerGL::Values>("empty"), FrameProfilerGL::Values{});
 
-    c.setValue("invalid", FrameProfilerGL::Value::CpuDuration|FrameProfilerGL::Value::GpuDuration|FrameProfilerGL::Value(0xff00));
+    c.setValue("invalid", FrameProfilerGL::Value::CpuDuration|FrameProfilerGL::Value::GpuDuration|FrameProfilerGL::Value(0xc000));
     CORRADE_COMPARE(c.value("invalid"), "CpuDuration GpuDuration");
     CORRADE_COMPARE(c.value<FrameProfilerGL::Values>("invalid"), FrameProfilerGL::Value::CpuDuration|FrameProfilerGL::Value::GpuDuration);
 }
 #endif
 
+#ifdef MAGNUM_TARGET_VK
+void FrameProfilerTest::debugVkValue() {
+    std::ostringstream out;
+
+    Debug{&out} << FrameProfilerVk::Value::GpuDuration << FrameProfilerVk::Value(0xfff0);
+    CORRADE_COMPARE(out.str(), "DebugTools::FrameProfilerVk::Value::GpuDuration DebugTools::FrameProfilerVk::Value(0xfff0)\n");
+}
+
+void FrameProfilerTest::debugVkValues() {
+    std::ostringstream out;
+
+    Debug{&out} << (FrameProfilerVk::Value::CpuDuration|FrameProfilerVk::Value::FrameTime) << FrameProfilerVk::Values{};
+    CORRADE_COMPARE(out.str(), "DebugTools::FrameProfilerVk::Value::FrameTime|DebugTools::FrameProfilerVk::Value::CpuDuration DebugTools::FrameProfilerVk::Values{}\n");
+}
+#endif
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::DebugTools::Test::FrameProfilerTest)
@@ -0,0 +1,127 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/System.h>
+
+#include "Magnum/DebugTools/FrameProfiler.h"
+#include "Magnum/Vk/CommandBuffer.h"
+#include "Magnum/Vk/CommandPoolCreateInfo.h"
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/Fence.h"
+#include "Magnum/Vk/Queue.h"
+#include "Magnum/Vk/VulkanTester.h"
+
+namespace Magnum { namespace DebugTools { namespace Test { namespace {
+
+struct FrameProfilerVkTest: Vk::VulkanTester {
+    explicit FrameProfilerVkTest();
+
+    void test();
+};
+
+const struct {
+    const char* name;
+    FrameProfilerVk::Values values;
+    UnsignedInt framesInFlight;
+} Data[]{
+    {"cpu duration", FrameProfilerVk::Value::CpuDuration, 2},
+    {"gpu duration", FrameProfilerVk::Value::GpuDuration, 2},
+    {"cpu duration + gpu duration", FrameProfilerVk::Value::CpuDuration|FrameProfilerVk::Value::GpuDuration, 2},
+    {"frame time + gpu duration, single frame in flight", FrameProfilerVk::Value::FrameTime|FrameProfilerVk::Value::GpuDuration, 1},
+};
+
+FrameProfilerVkTest::FrameProfilerVkTest() {
+    addInstancedTests({&FrameProfilerVkTest::test},
+        Containers::arraySize(Data));
+}
+
+void FrameProfilerVkTest::test() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const UnsignedInt queueFamily = device().properties().pickQueueFamily(Vk::QueueFlag::Graphics);
+    if((data.values & FrameProfilerVk::Value::GpuDuration) && !device().properties().queueFamilyProperties()[queueFamily].queueFamilyProperties.timestampValidBits)
+        CORRADE_SKIP("Timestamps not supported on the graphics queue, can't test.");
+
+    FrameProfilerVk profiler{device(), data.values, 4, data.framesInFlight};
+    CORRADE_COMPARE(profiler.values(), data.values);
+    CORRADE_COMPARE(profiler.maxFrameCount(), 4);
+
+    /* MSVC 2015 needs the {} */
+    UnsignedInt i = 0;
+    for(auto value: {FrameProfilerVk::Value::FrameTime,
+                     FrameProfilerVk::Value::CpuDuration,
+                     FrameProfilerVk::Value::GpuDuration}) {
+        if(!(data.values & value)) continue;
+
+        CORRADE_VERIFY(!profiler.isMeasurementAvailable(value));
+        /* The names should not be allocated */
+        CORRADE_COMPARE(profiler.measurementName(i++).flags(), Containers::StringViewFlag::NullTerminated|Containers::StringViewFlag::Global);
+    }
+
+    Vk::CommandPool pool{device(), Vk::CommandPoolCreateInfo{queueFamily}};
+
+    /* Each frame is waited on before the next one is recorded, which is
+       stricter than what the frames in flight would need */
+    for(UnsignedInt frame = 0; frame != 5; ++frame) {
+        Vk::CommandBuffer cmd = pool.allocate();
+        cmd.begin();
+        profiler.beginFrame(cmd);
+        Utility::System::sleep(1);
+        profiler.endFrame(cmd);
+        cmd.end();
+        queue().submit({Vk::SubmitInfo{}.setCommandBuffers({cmd})}).wait();
+    }
+
+    /* The GPU time can be just the time between two timestamps in an
+       otherwise empty command buffer, so test just that it's there */
+    if(data.values & FrameProfilerVk::Value::GpuDuration) {
+        CORRADE_VERIFY(profiler.isMeasurementAvailable(FrameProfilerVk::Value::GpuDuration));
+        CORRADE_COMPARE_AS(profiler.gpuDurationMean(), 0.0,
+            TestSuite::Compare::GreaterOrEqual);
+    }
+
+    /* Each frame took at least 1 ms. Can't test upper bound because
+       (especially on overloaded CIs) it all takes a magnitude more than
+       expected. */
+    if(data.values & FrameProfilerVk::Value::CpuDuration) {
+        CORRADE_VERIFY(profiler.isMeasurementAvailable(FrameProfilerVk::Value::CpuDuration));
+        CORRADE_COMPARE_AS(profiler.cpuDurationMean(), 0.95*1000*1000,
+            TestSuite::Compare::GreaterOrEqual);
+    }
+
+    if(data.values & FrameProfilerVk::Value::FrameTime) {
+        CORRADE_VERIFY(profiler.isMeasurementAvailable(FrameProfilerVk::Value::FrameTime));
+        CORRADE_COMPARE_AS(profiler.frameTimeMean(), 0.95*1000*1000,
+            TestSuite::Compare::GreaterOrEqual);
+    }
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::FrameProfilerVkTest)
@@ -34,6 +34,7 @@
 #include "Magnum/PixelFormat.h"
 #include "Magnum/DebugTools/CompareImage.h"
 #include "Magnum/DebugTools/ObjectRenderer.h"
+#include "Magnum/DebugTools/RendererBatch.h"
 #include "Magnum/DebugTools/ResourceManager.h"
 #include "Magnum/GL/Framebuffer.h"
 #include "Magnum/GL/OpenGLTester.h"
@@ -45,11 +46,10 @@
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/Trade/AbstractImporter.h"
 
-#include "configure.h"
-
-#ifdef CORRADE_TARGET_ANDROID
 #include "Magnum/GL/Context.h"
-#endif
+#include "Magnum/GL/Extensions.h"
+
+#include "configure.h"
 
 namespace Magnum { namespace DebugTools { namespace Test { namespace {
 
@@ -58,14 +58,26 @@ struct ObjectRendererGLTest: GL::OpenGLTester {
 
     void render2D();
     void render3D();
+    void batchMultiple();
 
     private:
         PluginManager::Manager<Trade::AbstractImporter> _manager{"nonexistent"};
 };
 
+const struct {
+    const char* name;
+    bool batched;
+} RenderData[]{
+    {"", false},
+    {"batched", true}
+};
+
 ObjectRendererGLTest::ObjectRendererGLTest() {
-    addTests({&ObjectRendererGLTest::render2D,
-              &ObjectRendererGLTest::render3D});
+    addInstancedTests({&ObjectRendererGLTest::render2D,
+                       &ObjectRendererGLTest::render3D},
+        Containers::arraySize(RenderData));
+
+    addTests({&ObjectRendererGLTest::batchMultiple});
 
     /* Load the plugins directly from the build tree. Otherwise they're either
        static and already loaded or not present in the build tree */
@@ -80,6 +92,26 @@ ObjectRendererGLTest::ObjectRendererGLTest() {
 using namespace Math::Literals;
 
 void ObjectRendererGLTest::render2D() {
+    auto&& data = RenderData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(data.batched) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::instanced_arrays>())
+            CORRADE_SKIP(GL::Extensions::ARB::instanced_arrays::string() << "is not supported.");
+        #elif defined(MAGNUM_TARGET_GLES2)
+        #ifndef MAGNUM_TARGET_WEBGL
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ANGLE::instanced_arrays>() &&
+           !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::instanced_arrays>() &&
+           !GL::Context::current().isExtensionSupported<GL::Extensions::NV::instanced_arrays>())
+            CORRADE_SKIP("GL_{ANGLE,EXT,NV}_instanced_arrays is not supported");
+        #else
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ANGLE::instanced_arrays>())
+            CORRADE_SKIP(GL::Extensions::ANGLE::instanced_arrays::string() << "is not supported.");
+        #endif
+        #endif
+    }
+
     SceneGraph::Scene<SceneGraph::MatrixTransformation2D> scene;
 
     SceneGraph::DrawableGroup2D drawables;
@@ -94,6 +126,8 @@ void ObjectRendererGLTest::render2D() {
         .rotate(-17.3_degf)
         .translate({-1.0f, -1.0f});
     ObjectRenderer2D renderer{manager, object, "my", &drawables};
+    RendererBatch2D batch;
+    if(data.batched) renderer.setBatch(&batch);
 
     GL::Renderbuffer color;
     color.setStorage(
@@ -109,6 +143,11 @@ void ObjectRendererGLTest::render2D() {
         .bind();
 
     camera.draw(drawables);
+    if(data.batched) {
+        CORRADE_COMPARE(batch.objectCount(), 1);
+        batch.draw(camera);
+        CORRADE_COMPARE(batch.objectCount(), 0);
+    }
 
     MAGNUM_VERIFY_NO_GL_ERROR();
 
@@ -124,6 +163,26 @@ void ObjectRendererGLTest::render2D() {
 }
 
 void ObjectRendererGLTest::render3D() {
+    auto&& data = RenderData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(data.batched) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::instanced_arrays>())
+            CORRADE_SKIP(GL::Extensions::ARB::instanced_arrays::string() << "is not supported.");
+        #elif defined(MAGNUM_TARGET_GLES2)
+        #ifndef MAGNUM_TARGET_WEBGL
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ANGLE::instanced_arrays>() &&
+           !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::instanced_arrays>() &&
+           !GL::Context::current().isExtensionSupported<GL::Extensions::NV::instanced_arrays>())
+            CORRADE_SKIP("GL_{ANGLE,EXT,NV}_instanced_arrays is not supported");
+        #else
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ANGLE::instanced_arrays>())
+            CORRADE_SKIP(GL::Extensions::ANGLE::instanced_arrays::string() << "is not supported.");
+        #endif
+        #endif
+    }
+
     SceneGraph::Scene<SceneGraph::MatrixTransformation3D> scene;
 
     SceneGraph::DrawableGroup3D drawables;
@@ -139,6 +198,8 @@ void ObjectRendererGLTest::render3D() {
         .rotateY(45.0_degf)
         .translate({-1.0f, -1.0f, -1.0f});
     ObjectRenderer3D renderer{manager, object, "my", &drawables};
+    RendererBatch3D batch;
+    if(data.batched) renderer.setBatch(&batch);
 
     GL::Renderbuffer color;
     color.setStorage(
@@ -154,6 +215,11 @@ void ObjectRendererGLTest::render3D() {
         .bind();
 
     camera.draw(drawables);
+    if(data.batched) {
+        CORRADE_COMPARE(batch.objectCount(), 1);
+        batch.draw(camera);
+        CORRADE_COMPARE(batch.objectCount(), 0);
+    }
 
     MAGNUM_VERIFY_NO_GL_ERROR();
 
@@ -178,6 +244,60 @@ void ObjectRendererGLTest::render3D() {
         *comparator);
 }
 
+void ObjectRendererGLTest::batchMultiple() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::instanced_arrays>())
+        CORRADE_SKIP(GL::Extensions::ARB::instanced_arrays::string() << "is not supported.");
+    #elif defined(MAGNUM_TARGET_GLES2)
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ANGLE::instanced_arrays>() &&
+       !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::instanced_arrays>() &&
+       !GL::Context::current().isExtensionSupported<GL::Extensions::NV::instanced_arrays>())
+        CORRADE_SKIP("GL_{ANGLE,EXT,NV}_instanced_arrays is not supported");
+    #else
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ANGLE::instanced_arrays>())
+        CORRADE_SKIP(GL::Extensions::ANGLE::instanced_arrays::string() << "is not supported.");
+    #endif
+    #endif
+
+    SceneGraph::Scene<SceneGraph::MatrixTransformation2D> scene;
+
+    SceneGraph::DrawableGroup2D drawables;
+    SceneGraph::Camera2D camera{scene};
+    camera.setProjectionMatrix(Matrix3::projection({4.0f, 4.0f}));
+
+    ResourceManager manager;
+    RendererBatch2D batch;
+
+    SceneGraph::Object<SceneGraph::MatrixTransformation2D> a{&scene};
+    SceneGraph::Object<SceneGraph::MatrixTransformation2D> b{&scene};
+    SceneGraph::Object<SceneGraph::MatrixTransformation2D> c{&scene};
+    ObjectRenderer2D rendererA{manager, a, {}, &drawables};
+    ObjectRenderer2D rendererB{manager, b, {}, &drawables};
+    ObjectRenderer2D rendererC{manager, c, {}, &drawables};
+    CORRADE_COMPARE(rendererA.batch(), nullptr);
+    rendererA.setBatch(&batch);
+    rendererB.setBatch(&batch);
+    CORRADE_COMPARE(rendererA.batch(), &batch);
+
+    /* The third renderer isn't batched, so it draws directly */
+    camera.draw(drawables);
+    CORRADE_COMPARE(batch.objectCount(), 2);
+    CORRADE_COMPARE(batch.forceCount(), 0);
+
+    /* Clearing discards the instances, drawing an empty batch is a no-op */
+    batch.clear();
+    CORRADE_COMPARE(batch.objectCount(), 0);
+    batch.draw(camera);
+
+    camera.draw(drawables);
+    CORRADE_COMPARE(batch.objectCount(), 2);
+    batch.draw(camera);
+    CORRADE_COMPARE(batch.objectCount(), 0);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::DebugTools::Test::ObjectRendererGLTest)
@@ -0,0 +1,325 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/DebugTools/OcclusionCuller.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Renderbuffer.h"
+#include "Magnum/GL/RenderbufferFormat.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/MeshTools/Compile.h"
+#include "Magnum/Primitives/Cube.h"
+#include "Magnum/Primitives/Plane.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Object.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/Shaders/FlatGL.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace DebugTools { namespace Test { namespace {
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+struct OcclusionCullerGLTest: GL::OpenGLTester {
+    explicit OcclusionCullerGLTest();
+
+    void construct();
+    void constructMove();
+
+    void draw();
+    void drawNearPlane();
+    void drawGroupSizeChanged();
+    void drawInvalidSize();
+    void reset();
+
+    private:
+        void setupFramebuffer();
+        void teardownFramebuffer();
+
+        GL::Renderbuffer _color{NoCreate}, _depth{NoCreate};
+        GL::Framebuffer _framebuffer{NoCreate};
+};
+
+OcclusionCullerGLTest::OcclusionCullerGLTest() {
+    addTests({&OcclusionCullerGLTest::construct,
+              &OcclusionCullerGLTest::constructMove});
+
+    addTests({&OcclusionCullerGLTest::draw,
+              &OcclusionCullerGLTest::drawNearPlane,
+              &OcclusionCullerGLTest::drawGroupSizeChanged,
+              &OcclusionCullerGLTest::drawInvalidSize,
+              &OcclusionCullerGLTest::reset},
+        &OcclusionCullerGLTest::setupFramebuffer,
+        &OcclusionCullerGLTest::teardownFramebuffer);
+}
+
+constexpr Vector2i RenderSize{64, 64};
+
+void OcclusionCullerGLTest::setupFramebuffer() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::occlusion_query2>())
+        CORRADE_SKIP(GL::Extensions::ARB::occlusion_query2::string() << "is not supported.");
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::occlusion_query_boolean>())
+        CORRADE_SKIP(GL::Extensions::EXT::occlusion_query_boolean::string() << "is not supported.");
+    #endif
+
+    _color = GL::Renderbuffer{};
+    _color.setStorage(
+        #if !defined(MAGNUM_TARGET_GLES2) || !defined(MAGNUM_TARGET_WEBGL)
+        GL::RenderbufferFormat::RGBA8,
+        #else
+        GL::RenderbufferFormat::RGBA4,
+        #endif
+        RenderSize);
+    _depth = GL::Renderbuffer{};
+    _depth.setStorage(GL::RenderbufferFormat::DepthComponent16, RenderSize);
+    _framebuffer = GL::Framebuffer{{{}, RenderSize}};
+    _framebuffer
+        .attachRenderbuffer(GL::Framebuffer::ColorAttachment{0}, _color)
+        .attachRenderbuffer(GL::Framebuffer::BufferAttachment::Depth, _depth)
+        .clear(GL::FramebufferClear::Color|GL::FramebufferClear::Depth)
+        .bind();
+
+    GL::Renderer::enable(GL::Renderer::Feature::DepthTest);
+}
+
+void OcclusionCullerGLTest::teardownFramebuffer() {
+    GL::Renderer::disable(GL::Renderer::Feature::DepthTest);
+
+    _framebuffer = GL::Framebuffer{NoCreate};
+    _color = GL::Renderbuffer{NoCreate};
+    _depth = GL::Renderbuffer{NoCreate};
+}
+
+struct CountingDrawable: SceneGraph::Drawable3D {
+    explicit CountingDrawable(Object3D& object, SceneGraph::DrawableGroup3D& group, Shaders::FlatGL3D& shader, GL::Mesh& mesh): SceneGraph::Drawable3D{object, &group}, shader(shader), mesh(mesh) {}
+
+    void draw(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) override {
+        ++drawCount;
+        shader
+            .setTransformationProjectionMatrix(camera.projectionMatrix()*transformationMatrix)
+            .draw(mesh);
+    }
+
+    Shaders::FlatGL3D& shader;
+    GL::Mesh& mesh;
+    Int drawCount = 0;
+};
+
+/* A wall covering the whole view at Z = -3, a small cube in front of it and
+   a cube behind it */
+struct TestScene {
+    explicit TestScene();
+
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    SceneGraph::Camera3D camera{cameraObject};
+    SceneGraph::DrawableGroup3D drawables;
+
+    Shaders::FlatGL3D shader;
+    GL::Mesh plane{MeshTools::compile(Primitives::planeSolid())};
+    GL::Mesh cube{MeshTools::compile(Primitives::cubeSolid())};
+
+    Object3D wallObject{&scene};
+    Object3D visibleObject{&scene};
+    Object3D hiddenObject{&scene};
+    CountingDrawable wall{wallObject, drawables, shader, plane};
+    CountingDrawable visible{visibleObject, drawables, shader, cube};
+    CountingDrawable hidden{hiddenObject, drawables, shader, cube};
+
+    Range3D boundingBoxes[3]{
+        {{-1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}},
+        {{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}},
+        {{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}}
+    };
+};
+
+TestScene::TestScene() {
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(60.0f), 1.0f, 0.1f, 100.0f));
+    wallObject
+        .scale(Vector3{5.0f})
+        .translate(Vector3::zAxis(-3.0f));
+    visibleObject
+        .scale(Vector3{0.2f})
+        .translate({0.5f, 0.0f, -2.0f});
+    hiddenObject
+        .scale(Vector3{0.5f})
+        .translate(Vector3::zAxis(-10.0f));
+}
+
+void OcclusionCullerGLTest::construct() {
+    OcclusionCuller culler;
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::ES3_compatibility>())
+        CORRADE_COMPARE(culler.target(), GL::SampleQuery::Target::AnySamplesPassed);
+    else
+    #endif
+    {
+        CORRADE_COMPARE(culler.target(), GL::SampleQuery::Target::AnySamplesPassedConservative);
+    }
+
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(culler.usesConditionalRendering(), GL::Context::current().isExtensionSupported<GL::Extensions::NV::conditional_render>());
+    #else
+    CORRADE_VERIFY(!culler.usesConditionalRendering());
+    #endif
+}
+
+void OcclusionCullerGLTest::constructMove() {
+    OcclusionCuller a{GL::SampleQuery::Target::AnySamplesPassed};
+
+    OcclusionCuller b = Utility::move(a);
+    CORRADE_COMPARE(b.target(), GL::SampleQuery::Target::AnySamplesPassed);
+
+    OcclusionCuller c;
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.target(), GL::SampleQuery::Target::AnySamplesPassed);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<OcclusionCuller>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<OcclusionCuller>::value);
+}
+
+void OcclusionCullerGLTest::draw() {
+    TestScene s;
+    OcclusionCuller culler;
+    const Int drawnIfOccluded = culler.usesConditionalRendering() ? 1 : 0;
+
+    /* Without any previous results everything is drawn. Finishing after
+       every frame to have the query results available in the next one. */
+    CORRADE_COMPARE(culler.draw(s.camera, s.drawables, s.boundingBoxes), 0);
+    GL::Renderer::finish();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(s.wall.drawCount, 1);
+    CORRADE_COMPARE(s.visible.drawCount, 1);
+    CORRADE_COMPARE(s.hidden.drawCount, 1);
+
+    /* The cube behind the wall is found to be occluded. If conditional
+       rendering is used it's still submitted, but discarded by the GPU. */
+    _framebuffer.clear(GL::FramebufferClear::Color|GL::FramebufferClear::Depth);
+    CORRADE_COMPARE(culler.draw(s.camera, s.drawables, s.boundingBoxes), 1);
+    GL::Renderer::finish();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(s.wall.drawCount, 2);
+    CORRADE_COMPARE(s.visible.drawCount, 2);
+    CORRADE_COMPARE(s.hidden.drawCount, 1 + drawnIfOccluded);
+
+    /* Move the cube in front of the wall, next to the other cube. The query
+       issued in the previous frame still says it's occluded. */
+    s.hiddenObject.translate({-0.5f, 0.0f, 8.0f});
+    _framebuffer.clear(GL::FramebufferClear::Color|GL::FramebufferClear::Depth);
+    CORRADE_COMPARE(culler.draw(s.camera, s.drawables, s.boundingBoxes), 1);
+    GL::Renderer::finish();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(s.hidden.drawCount, 1 + 2*drawnIfOccluded);
+
+    /* Now it's visible again */
+    _framebuffer.clear(GL::FramebufferClear::Color|GL::FramebufferClear::Depth);
+    CORRADE_COMPARE(culler.draw(s.camera, s.drawables, s.boundingBoxes), 0);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(s.hidden.drawCount, 2 + 2*drawnIfOccluded);
+}
+
+void OcclusionCullerGLTest::drawNearPlane() {
+    TestScene s;
+    OcclusionCuller culler;
+
+    /* The hidden cube bounding box contains the camera, so the query can't
+       be used */
+    s.boundingBoxes[2] = {{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 25.0f}};
+
+    CORRADE_COMPARE(culler.draw(s.camera, s.drawables, s.boundingBoxes), 0);
+    GL::Renderer::finish();
+    _framebuffer.clear(GL::FramebufferClear::Color|GL::FramebufferClear::Depth);
+    CORRADE_COMPARE(culler.draw(s.camera, s.drawables, s.boundingBoxes), 0);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(s.hidden.drawCount, 2);
+}
+
+void OcclusionCullerGLTest::drawGroupSizeChanged() {
+    TestScene s;
+    OcclusionCuller culler;
+
+    CORRADE_COMPARE(culler.draw(s.camera, s.drawables, s.boundingBoxes), 0);
+    GL::Renderer::finish();
+    _framebuffer.clear(GL::FramebufferClear::Color|GL::FramebufferClear::Depth);
+    CORRADE_COMPARE(culler.draw(s.camera, s.drawables, s.boundingBoxes), 1);
+    GL::Renderer::finish();
+
+    /* Removing a drawable discards all state */
+    s.drawables.remove(s.visible);
+    const Range3D boundingBoxes[]{s.boundingBoxes[0], s.boundingBoxes[2]};
+    _framebuffer.clear(GL::FramebufferClear::Color|GL::FramebufferClear::Depth);
+    CORRADE_COMPARE(culler.draw(s.camera, s.drawables, boundingBoxes), 0);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void OcclusionCullerGLTest::drawInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    TestScene s;
+    OcclusionCuller culler;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    culler.draw(s.camera, s.drawables, Containers::arrayView(s.boundingBoxes).exceptSuffix(1));
+    CORRADE_COMPARE(out.str(), "DebugTools::OcclusionCuller::draw(): expected 3 bounding boxes but got 2\n");
+}
+
+void OcclusionCullerGLTest::reset() {
+    TestScene s;
+    OcclusionCuller culler;
+
+    CORRADE_COMPARE(culler.draw(s.camera, s.drawables, s.boundingBoxes), 0);
+    GL::Renderer::finish();
+    _framebuffer.clear(GL::FramebufferClear::Color|GL::FramebufferClear::Depth);
+    CORRADE_COMPARE(culler.draw(s.camera, s.drawables, s.boundingBoxes), 1);
+    GL::Renderer::finish();
+
+    /* After a reset everything is considered visible again */
+    culler.reset();
+    _framebuffer.clear(GL::FramebufferClear::Color|GL::FramebufferClear::Depth);
+    CORRADE_COMPARE(culler.draw(s.camera, s.drawables, s.boundingBoxes), 0);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::OcclusionCullerGLTest)
@@ -0,0 +1,289 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringStl.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/DebugTools/ScopeProfiler.h"
+
+namespace Magnum { namespace DebugTools { namespace Test { namespace {
+
+struct ScopeProfilerTest: TestSuite::Tester {
+    explicit ScopeProfilerTest();
+
+    void construct();
+    void constructZeroCapacity();
+    void constructMove();
+
+    void empty();
+    void scopes();
+    void nested();
+    void disabled();
+    void overflow();
+    void threadName();
+    void escape();
+    void multipleThreads();
+    void multipleProfilers();
+};
+
+ScopeProfilerTest::ScopeProfilerTest() {
+    addTests({&ScopeProfilerTest::construct,
+              &ScopeProfilerTest::constructZeroCapacity,
+              &ScopeProfilerTest::constructMove,
+
+              &ScopeProfilerTest::empty,
+              &ScopeProfilerTest::scopes,
+              &ScopeProfilerTest::nested,
+              &ScopeProfilerTest::disabled,
+              &ScopeProfilerTest::overflow,
+              &ScopeProfilerTest::threadName,
+              &ScopeProfilerTest::escape,
+              &ScopeProfilerTest::multipleThreads,
+              &ScopeProfilerTest::multipleProfilers});
+}
+
+std::size_t count(const std::string& string, const std::string& substring) {
+    std::size_t count = 0;
+    for(std::size_t pos = string.find(substring); pos != std::string::npos; pos = string.find(substring, pos + substring.size()))
+        ++count;
+    return count;
+}
+
+void ScopeProfilerTest::construct() {
+    ScopeProfiler profiler{128};
+    CORRADE_COMPARE(profiler.eventCapacity(), 128);
+    CORRADE_VERIFY(profiler.isEnabled());
+    CORRADE_COMPARE(profiler.threadCount(), 0);
+}
+
+void ScopeProfilerTest::constructZeroCapacity() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    ScopeProfiler{0};
+    CORRADE_COMPARE(out.str(), "DebugTools::ScopeProfiler: expected a non-zero event capacity\n");
+}
+
+void ScopeProfilerTest::constructMove() {
+    ScopeProfiler a{128};
+    {
+        ScopeProfiler::Scope scope{a, "first"};
+    }
+
+    ScopeProfiler b = Utility::move(a);
+    CORRADE_COMPARE(b.eventCapacity(), 128);
+    {
+        ScopeProfiler::Scope scope{b, "second"};
+    }
+    CORRADE_COMPARE(b.threadCount(), 1);
+
+    ScopeProfiler c{16};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.eventCapacity(), 128);
+
+    std::string trace = c.chromeTrace();
+    CORRADE_COMPARE(count(trace, "\"name\":\"first\""), 1);
+    CORRADE_COMPARE(count(trace, "\"name\":\"second\""), 1);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<ScopeProfiler>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<ScopeProfiler>::value);
+}
+
+void ScopeProfilerTest::empty() {
+    ScopeProfiler profiler;
+    CORRADE_COMPARE(profiler.chromeTrace(),
+        "{\"traceEvents\":[],\"displayTimeUnit\":\"ns\"}");
+}
+
+void ScopeProfilerTest::scopes() {
+    ScopeProfiler profiler;
+    for(std::size_t i = 0; i != 3; ++i) {
+        ScopeProfiler::Scope scope{profiler, "frame"};
+    }
+    CORRADE_COMPARE(profiler.threadCount(), 1);
+
+    std::string trace = profiler.chromeTrace();
+    CORRADE_COMPARE_AS(trace, "{\"traceEvents\":[{\"name\":\"frame\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":",
+        TestSuite::Compare::StringHasPrefix);
+    CORRADE_COMPARE_AS(trace, "}],\"displayTimeUnit\":\"ns\"}",
+        TestSuite::Compare::StringHasSuffix);
+    CORRADE_COMPARE(count(trace, "\"ph\":\"X\""), 3);
+}
+
+void ScopeProfilerTest::nested() {
+    ScopeProfiler profiler;
+    {
+        ScopeProfiler::Scope frame{profiler, "frame"};
+        {
+            ScopeProfiler::Scope update{profiler, "update"};
+        } {
+            ScopeProfiler::Scope render{profiler, "render"};
+            ScopeProfiler::Scope draw{profiler, "draw"};
+        }
+    }
+
+    /* Scopes are recorded when they end, so the children are first */
+    std::string trace = profiler.chromeTrace();
+    const std::size_t update = trace.find("\"name\":\"update\"");
+    const std::size_t draw = trace.find("\"name\":\"draw\"");
+    const std::size_t render = trace.find("\"name\":\"render\"");
+    const std::size_t frame = trace.find("\"name\":\"frame\"");
+    CORRADE_VERIFY(update != std::string::npos);
+    CORRADE_VERIFY(draw != std::string::npos);
+    CORRADE_VERIFY(render != std::string::npos);
+    CORRADE_VERIFY(frame != std::string::npos);
+    CORRADE_VERIFY(update < draw);
+    CORRADE_VERIFY(draw < render);
+    CORRADE_VERIFY(render < frame);
+}
+
+void ScopeProfilerTest::disabled() {
+    ScopeProfiler profiler;
+    profiler.setEnabled(false);
+    CORRADE_VERIFY(!profiler.isEnabled());
+    {
+        ScopeProfiler::Scope scope{profiler, "disabled"};
+    }
+    /* Not even registered */
+    CORRADE_COMPARE(profiler.threadCount(), 0);
+
+    profiler.setEnabled(true);
+    {
+        ScopeProfiler::Scope scope{profiler, "enabled"};
+        /* Disabling while a scope is active still records it */
+        profiler.setEnabled(false);
+    }
+
+    std::string trace = profiler.chromeTrace();
+    CORRADE_COMPARE(count(trace, "\"name\":\"disabled\""), 0);
+    CORRADE_COMPARE(count(trace, "\"name\":\"enabled\""), 1);
+}
+
+void ScopeProfilerTest::overflow() {
+    ScopeProfiler profiler{2};
+    {
+        ScopeProfiler::Scope scope{profiler, "a"};
+    } {
+        ScopeProfiler::Scope scope{profiler, "b"};
+    } {
+        ScopeProfiler::Scope scope{profiler, "c"};
+    }
+
+    /* Only the last two are kept */
+    std::string trace = profiler.chromeTrace();
+    CORRADE_COMPARE(count(trace, "\"ph\":\"X\""), 2);
+    CORRADE_COMPARE(count(trace, "\"name\":\"a\""), 0);
+    CORRADE_VERIFY(trace.find("\"name\":\"b\"") < trace.find("\"name\":\"c\""));
+}
+
+void ScopeProfilerTest::threadName() {
+    ScopeProfiler profiler;
+    profiler.setThreadName("main");
+    CORRADE_COMPARE(profiler.threadCount(), 1);
+    CORRADE_COMPARE(profiler.chromeTrace(),
+        "{\"traceEvents\":[{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"main\"}}],\"displayTimeUnit\":\"ns\"}");
+
+    /* Renaming replaces the previous name */
+    profiler.setThreadName("render");
+    CORRADE_COMPARE(profiler.threadCount(), 1);
+    CORRADE_COMPARE(profiler.chromeTrace(),
+        "{\"traceEvents\":[{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"render\"}}],\"displayTimeUnit\":\"ns\"}");
+}
+
+void ScopeProfilerTest::escape() {
+    ScopeProfiler profiler;
+    profiler.setThreadName("\"main\"\n");
+    {
+        ScopeProfiler::Scope scope{profiler, "C:\\Program Files"};
+    }
+
+    std::string trace = profiler.chromeTrace();
+    CORRADE_COMPARE_AS(trace, "\"args\":{\"name\":\"\\\"main\\\"\\u000a\"}",
+        TestSuite::Compare::StringContains);
+    CORRADE_COMPARE_AS(trace, "\"name\":\"C:\\\\Program Files\"",
+        TestSuite::Compare::StringContains);
+}
+
+void ScopeProfilerTest::multipleThreads() {
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_SKIP("Threads are not available on Emscripten.");
+    #else
+    ScopeProfiler profiler;
+    profiler.setThreadName("main");
+
+    auto work = [&profiler](const char* name) {
+        profiler.setThreadName(name);
+        for(std::size_t i = 0; i != 100; ++i) {
+            ScopeProfiler::Scope scope{profiler, "work"};
+        }
+    };
+    std::thread a{work, "a"};
+    std::thread b{work, "b"};
+
+    /* Exporting while the threads record shouldn't crash */
+    profiler.chromeTrace();
+
+    a.join();
+    b.join();
+
+    CORRADE_COMPARE(profiler.threadCount(), 3);
+    std::string trace = profiler.chromeTrace();
+    CORRADE_COMPARE(count(trace, "\"name\":\"work\""), 200);
+    CORRADE_COMPARE(count(trace, "\"name\":\"thread_name\""), 3);
+    CORRADE_COMPARE(count(trace, "\"tid\":0,"), 1);
+    CORRADE_COMPARE(count(trace, "\"tid\":1,"), 101);
+    CORRADE_COMPARE(count(trace, "\"tid\":2,"), 101);
+    #endif
+}
+
+void ScopeProfilerTest::multipleProfilers() {
+    ScopeProfiler a, b;
+    {
+        ScopeProfiler::Scope scopeA{a, "a"};
+        ScopeProfiler::Scope scopeB{b, "b"};
+    } {
+        ScopeProfiler::Scope scopeA{a, "a"};
+    }
+
+    std::string traceA = a.chromeTrace();
+    std::string traceB = b.chromeTrace();
+    CORRADE_COMPARE(count(traceA, "\"name\":\"a\""), 2);
+    CORRADE_COMPARE(count(traceA, "\"name\":\"b\""), 0);
+    CORRADE_COMPARE(count(traceB, "\"name\":\"a\""), 0);
+    CORRADE_COMPARE(count(traceB, "\"name\":\"b\""), 1);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::ScopeProfilerTest)
@@ -49,6 +49,10 @@
 #include "Magnum/GL/DebugOutput.h"
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/DebugTools/AsyncReadback.h"
+#endif
+
 #ifdef MAGNUM_TARGET_GLES2
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
@@ -67,6 +71,11 @@ struct ScreenshotGLTest: GL::OpenGLTester {
     void pluginLoadFailed();
     void saveFailed();
 
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void async();
+    void asyncPluginLoadFailed();
+    #endif
+
     private:
         PluginManager::Manager<Trade::AbstractImageConverter> _converterManager{"nonexistent"};
         PluginManager::Manager<Trade::AbstractImporter> _importerManager{"nonexistent"};
@@ -79,6 +88,11 @@ ScreenshotGLTest::ScreenshotGLTest() {
               &ScreenshotGLTest::pluginLoadFailed,
               &ScreenshotGLTest::saveFailed});
 
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    addTests({&ScreenshotGLTest::async,
+              &ScreenshotGLTest::asyncPluginLoadFailed});
+    #endif
+
     /* Load the plugins directly from the build tree. Otherwise they're either
        static and already loaded or not present in the build tree */
     #ifdef ANYIMAGECONVERTER_PLUGIN_FILENAME
@@ -319,6 +333,83 @@ void ScreenshotGLTest::saveFailed() {
     CORRADE_COMPARE(out.str(), "Trade::AnyImageConverter::convertToFile(): cannot determine the format of image.poo for a 2D image\n");
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void ScreenshotGLTest::async() {
+    if(!(_converterManager.loadState("AnyImageConverter") & PluginManager::LoadState::Loaded) ||
+       !(_converterManager.loadState("TgaImageConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("AnyImageConverter / TgaImageConverter plugins not found.");
+
+    ImageView2D rgba{PixelFormat::RGBA8Unorm, {4, 3}, DataRgba8};
+
+    GL::Texture2D texture;
+    texture.setStorage(1, GL::TextureFormat::RGBA8, {4, 3})
+        .setSubImage(0, {}, rgba);
+    GL::Framebuffer framebuffer{{{}, {4, 3}}};
+    framebuffer.attachTexture(GL::Framebuffer::ColorAttachment{0}, texture, 0);
+
+    CORRADE_COMPARE(framebuffer.checkStatus(GL::FramebufferTarget::Read), GL::Framebuffer::Status::Complete);
+
+    Containers::String file1 = Utility::Path::join(SCREENSHOTTEST_SAVE_DIR, "async1.tga");
+    Containers::String file2 = Utility::Path::join(SCREENSHOTTEST_SAVE_DIR, "async2.tga");
+    CORRADE_VERIFY(Utility::Path::make(SCREENSHOTTEST_SAVE_DIR));
+    if(Utility::Path::exists(file1))
+        CORRADE_VERIFY(Utility::Path::remove(file1));
+    if(Utility::Path::exists(file2))
+        CORRADE_VERIFY(Utility::Path::remove(file2));
+
+    {
+        AsyncScreenshot screenshot{_converterManager};
+        CORRADE_VERIFY(screenshot.capture(framebuffer, PixelFormat::RGBA8Unorm, file1));
+        CORRADE_VERIFY(screenshot.capture(framebuffer, PixelFormat::RGBA8Unorm, file2));
+        CORRADE_COMPARE(screenshot.pendingCount(), 2);
+
+        screenshot.update();
+        screenshot.finish();
+        CORRADE_COMPARE(screenshot.pendingCount(), 0);
+        CORRADE_COMPARE(screenshot.readback().pendingCount(), 0);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(Utility::Path::exists(file1));
+    CORRADE_VERIFY(Utility::Path::exists(file2));
+
+    if(!(_importerManager.loadState("AnyImageImporter") & PluginManager::LoadState::Loaded) ||
+       !(_importerManager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("AnyImageImporter / TgaImporter plugins not found.");
+
+    CORRADE_COMPARE_WITH(file1, rgba, CompareFileToImage{_importerManager});
+    CORRADE_COMPARE_WITH(file2, rgba, CompareFileToImage{_importerManager});
+}
+
+void ScreenshotGLTest::asyncPluginLoadFailed() {
+    PluginManager::Manager<Trade::AbstractImageConverter> manager{"nowhere"};
+    if(manager.loadState("AnyImageConverter") != PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("AnyImageConverter plugin found, can't test.");
+
+    GL::Framebuffer framebuffer{{{}, {4, 3}}};
+
+    std::ostringstream out;
+    bool succeeded;
+    {
+        Error redirectOutput{&out};
+        AsyncScreenshot screenshot{manager};
+        succeeded = screenshot.capture(framebuffer, PixelFormat::RGBA8Unorm, Utility::Path::join(SCREENSHOTTEST_SAVE_DIR, "image.tga"));
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(!succeeded);
+    #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_COMPARE(out.str(),
+        "PluginManager::Manager::load(): plugin AnyImageConverter is not static and was not found in nowhere\n"
+        "DebugTools::AsyncScreenshot::capture(): no converter plugin available\n");
+    #else
+    CORRADE_COMPARE(out.str(),
+        "PluginManager::Manager::load(): plugin AnyImageConverter was not found\n"
+        "DebugTools::AsyncScreenshot::capture(): no converter plugin available\n");
+    #endif
+}
+#endif
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::DebugTools::Test::ScreenshotGLTest)
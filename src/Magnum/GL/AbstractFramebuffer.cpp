@@ -45,6 +45,7 @@
 #ifndef MAGNUM_TARGET_GLES2
 #include "Magnum/GL/TextureArray.h"
 #endif
+#include "Magnum/GL/Implementation/ContextState.h"
 #include "Magnum/GL/Implementation/FramebufferState.h"
 #include "Magnum/GL/Implementation/RendererState.h"
 #include "Magnum/GL/Implementation/State.h"
@@ -131,10 +132,15 @@ void AbstractFramebuffer::bindInternal(FramebufferTarget target) {
 
 #ifdef MAGNUM_TARGET_GLES2
 void AbstractFramebuffer::bindImplementationSingle(AbstractFramebuffer& self, FramebufferTarget) {
-    Implementation::FramebufferState& state = Context::current().state().framebuffer;
+    Implementation::State& glState = Context::current().state();
+    Implementation::FramebufferState& state = glState.framebuffer;
     CORRADE_INTERNAL_ASSERT(state.readBinding == state.drawBinding);
-    if(state.readBinding == self._id) return;
+    if(state.readBinding == self._id) {
+        ++glState.context.statistics.bindSkippedCount;
+        return;
+    }
 
+    ++glState.context.statistics.bindCount;
     state.readBinding = state.drawBinding = self._id;
 
     /* Binding the framebuffer finally creates it */
@@ -147,15 +153,23 @@ void AbstractFramebuffer::bindImplementationSingle(AbstractFramebuffer& self, Fr
 inline
 #endif
 void AbstractFramebuffer::bindImplementationDefault(AbstractFramebuffer& self, FramebufferTarget target) {
-    Implementation::FramebufferState& state = Context::current().state().framebuffer;
+    Implementation::State& glState = Context::current().state();
+    Implementation::FramebufferState& state = glState.framebuffer;
+
+    GLuint* binding;
+    if(target == FramebufferTarget::Read)
+        binding = &state.readBinding;
+    else if(target == FramebufferTarget::Draw)
+        binding = &state.drawBinding;
+    else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+    if(*binding == self._id) {
+        ++glState.context.statistics.bindSkippedCount;
+        return;
+    }
 
-    if(target == FramebufferTarget::Read) {
-        if(state.readBinding == self._id) return;
-        state.readBinding = self._id;
-    } else if(target == FramebufferTarget::Draw) {
-        if(state.drawBinding == self._id) return;
-        state.drawBinding = self._id;
-    } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    ++glState.context.statistics.bindCount;
+    *binding = self._id;
 
     /* Binding the framebuffer finally creates it */
     self._flags |= ObjectFlag::Created;
@@ -174,17 +188,19 @@ FramebufferTarget AbstractFramebuffer::bindInternal() {
 
 #ifdef MAGNUM_TARGET_GLES2
 FramebufferTarget AbstractFramebuffer::bindImplementationSingle(AbstractFramebuffer& self) {
-    Implementation::FramebufferState& state = Context::current().state().framebuffer;
+    Implementation::State& glState = Context::current().state();
+    Implementation::FramebufferState& state = glState.framebuffer;
     CORRADE_INTERNAL_ASSERT(state.readBinding == state.drawBinding);
 
     /* Bind the framebuffer, if not already */
     if(state.readBinding != self._id) {
+        ++glState.context.statistics.bindCount;
         state.readBinding = state.drawBinding = self._id;
 
         /* Binding the framebuffer finally creates it */
         self._flags |= ObjectFlag::Created;
         glBindFramebuffer(GL_FRAMEBUFFER, self._id);
-    }
+    } else ++glState.context.statistics.bindSkippedCount;
 
     /* On ES2 w/o separate read/draw bindings the return value is used as a
        first parameter to glFramebufferRenderbuffer() etc. and so it needs to
@@ -198,15 +214,21 @@ FramebufferTarget AbstractFramebuffer::bindImplementationSingle(AbstractFramebuf
 inline
 #endif
 FramebufferTarget AbstractFramebuffer::bindImplementationDefault(AbstractFramebuffer& self) {
-    Implementation::FramebufferState& state = Context::current().state().framebuffer;
+    Implementation::State& glState = Context::current().state();
+    Implementation::FramebufferState& state = glState.framebuffer;
 
     /* Return target to which the framebuffer is already bound */
-    if(state.readBinding == self._id)
+    if(state.readBinding == self._id) {
+        ++glState.context.statistics.bindSkippedCount;
         return FramebufferTarget::Read;
-    if(state.drawBinding == self._id)
+    }
+    if(state.drawBinding == self._id) {
+        ++glState.context.statistics.bindSkippedCount;
         return FramebufferTarget::Draw;
+    }
 
     /* Or bind it, if not already */
+    ++glState.context.statistics.bindCount;
     state.readBinding = self._id;
 
     /* Binding the framebuffer finally creates it */
@@ -498,13 +520,28 @@ void AbstractFramebuffer::copySubImage(const Range2Di& rectangle, CubeMapTexture
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) || !defined(CORRADE_TARGET_EMSCRIPTEN)
+namespace {
+
+/* Not done in the no-op variants, as nothing gets saved there */
+void recordInvalidation(const GLsizei count, const Vector2i& size) {
+    Context::Statistics& statistics = Context::current().state().context.statistics;
+    statistics.invalidatedAttachmentCount += count;
+    statistics.invalidatedPixelCount += UnsignedLong(count)*size.product();
+}
+
+}
+#endif
+
 void AbstractFramebuffer::invalidateImplementationNoOp(AbstractFramebuffer&, GLsizei, const GLenum* const) {}
 
 void AbstractFramebuffer::invalidateImplementationDefault(AbstractFramebuffer& self, const GLsizei count, const GLenum* const attachments) {
     #ifndef MAGNUM_TARGET_GLES2
     glInvalidateFramebuffer(GLenum(self.bindInternal()), count, attachments);
+    recordInvalidation(count, self._viewport.size());
     #elif !defined(CORRADE_TARGET_EMSCRIPTEN)
     glDiscardFramebufferEXT(GLenum(self.bindInternal()), count, attachments);
+    recordInvalidation(count, self._viewport.size());
     #else
     static_cast<void>(self);
     static_cast<void>(count);
@@ -516,6 +553,7 @@ void AbstractFramebuffer::invalidateImplementationDefault(AbstractFramebuffer& s
 #ifndef MAGNUM_TARGET_GLES
 void AbstractFramebuffer::invalidateImplementationDSA(AbstractFramebuffer& self, const GLsizei count, const GLenum* const attachments) {
     glInvalidateNamedFramebufferData(self._id, count, attachments);
+    recordInvalidation(count, self._viewport.size());
 }
 #endif
 
@@ -524,11 +562,13 @@ void AbstractFramebuffer::invalidateImplementationNoOp(AbstractFramebuffer&, GLs
 
 void AbstractFramebuffer::invalidateImplementationDefault(AbstractFramebuffer& self, const GLsizei count, const GLenum* const attachments, const Range2Di& rectangle) {
     glInvalidateSubFramebuffer(GLenum(self.bindInternal()), count, attachments, rectangle.left(), rectangle.bottom(), rectangle.sizeX(), rectangle.sizeY());
+    recordInvalidation(count, rectangle.size());
 }
 
 #ifndef MAGNUM_TARGET_GLES
 void AbstractFramebuffer::invalidateImplementationDSA(AbstractFramebuffer& self, const GLsizei count, const GLenum* const attachments, const Range2Di& rectangle) {
     glInvalidateNamedFramebufferSubData(self._id, count, attachments, rectangle.left(), rectangle.bottom(), rectangle.sizeX(), rectangle.sizeY());
+    recordInvalidation(count, rectangle.size());
 }
 #endif
 #endif
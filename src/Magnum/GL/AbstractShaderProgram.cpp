@@ -28,6 +28,7 @@
 
 #include "AbstractShaderProgram.h"
 
+#include <cstring>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Iterable.h>
 #include <Corrade/Containers/Pair.h>
@@ -37,12 +38,17 @@
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringIterable.h>
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/Sha1.h>
+#endif
 
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Mesh.h"
 #include "Magnum/GL/MeshView.h"
 #include "Magnum/GL/Shader.h"
+#include "Magnum/GL/Implementation/ContextState.h"
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Magnum/GL/Implementation/DebugState.h"
 #endif
@@ -296,13 +302,46 @@ Int AbstractShaderProgram::maxTexelOffset() {
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void AbstractShaderProgram::setBinaryCache(Containers::Optional<Containers::Array<char>>(*const load)(Containers::StringView, void*), void(*const store)(Containers::StringView, Containers::ArrayView<const char>, void*), void* const userData) {
+    CORRADE_ASSERT(!load == !store,
+        "GL::AbstractShaderProgram::setBinaryCache(): expected either both or neither callback to be set", );
+
+    Implementation::ShaderProgramState& state = Context::current().state().shaderProgram;
+    state.binaryCacheLoad = nullptr;
+    state.binaryCacheStore = nullptr;
+    state.binaryCacheUserData = nullptr;
+    if(!load) return;
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::get_program_binary>())
+        return;
+    #endif
+
+    /* Some drivers (such as Mesa with certain configurations) advertise the
+       functionality but report no formats, which means no binary can ever
+       be retrieved */
+    GLint formatCount{};
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    if(!formatCount) return;
+
+    state.binaryCacheLoad = load;
+    state.binaryCacheStore = store;
+    state.binaryCacheUserData = userData;
+}
+#endif
+
 AbstractShaderProgram::AbstractShaderProgram(): _id(glCreateProgram()) {
     CORRADE_INTERNAL_ASSERT(_id != Implementation::State::DisengagedBinding);
 }
 
 AbstractShaderProgram::AbstractShaderProgram(NoCreateT) noexcept: _id{0} {}
 
-AbstractShaderProgram::AbstractShaderProgram(AbstractShaderProgram&& other) noexcept: _id(other._id) {
+AbstractShaderProgram::AbstractShaderProgram(AbstractShaderProgram&& other) noexcept: _id(other._id)
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    , _binaryCacheHash{Utility::move(other._binaryCacheHash)}, _binaryCacheKey{Utility::move(other._binaryCacheKey)}, _binaryCacheHit{other._binaryCacheHit}
+    #endif
+{
     other._id = 0;
 }
 
@@ -319,6 +358,11 @@ AbstractShaderProgram::~AbstractShaderProgram() {
 AbstractShaderProgram& AbstractShaderProgram::operator=(AbstractShaderProgram&& other) noexcept {
     using Utility::swap;
     swap(_id, other._id);
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    swap(_binaryCacheHash, other._binaryCacheHash);
+    swap(_binaryCacheKey, other._binaryCacheKey);
+    swap(_binaryCacheHit, other._binaryCacheHit);
+    #endif
     return *this;
 }
 
@@ -501,6 +545,38 @@ AbstractShaderProgram& AbstractShaderProgram::draw(const Containers::Iterable<Me
     return *this;
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+AbstractShaderProgram& AbstractShaderProgram::draw(Mesh& mesh, Buffer& buffer, const GLintptr offset, const UnsignedInt drawCount, const UnsignedInt stride) {
+    CORRADE_ASSERT(offset % 4 == 0 && stride % 4 == 0,
+        "GL::AbstractShaderProgram::draw(): expected offset and stride to be a multiple of 4, got" << offset << "and" << stride, *this);
+    CORRADE_ASSERT(!mesh._indexBuffer.id() || !mesh._indexBufferOffset,
+        "GL::AbstractShaderProgram::draw(): indirect draws expect the index buffer to be set with a zero offset, got" << mesh._indexBufferOffset, *this);
+
+    /* Nothing to draw, exit without touching any state */
+    if(!drawCount) return *this;
+
+    use();
+    mesh.drawIndirectInternal(buffer, offset, drawCount, stride);
+    return *this;
+}
+
+#ifndef MAGNUM_TARGET_GLES
+AbstractShaderProgram& AbstractShaderProgram::draw(Mesh& mesh, Buffer& buffer, const GLintptr offset, Buffer& drawCountBuffer, const GLintptr drawCountOffset, const UnsignedInt maxDrawCount, const UnsignedInt stride) {
+    CORRADE_ASSERT(offset % 4 == 0 && drawCountOffset % 4 == 0 && stride % 4 == 0,
+        "GL::AbstractShaderProgram::draw(): expected offset, draw count offset and stride to be a multiple of 4, got" << offset << Debug::nospace << "," << drawCountOffset << "and" << stride, *this);
+    CORRADE_ASSERT(!mesh._indexBuffer.id() || !mesh._indexBufferOffset,
+        "GL::AbstractShaderProgram::draw(): indirect draws expect the index buffer to be set with a zero offset, got" << mesh._indexBufferOffset, *this);
+
+    /* Nothing to draw, exit without touching any state */
+    if(!maxDrawCount) return *this;
+
+    use();
+    mesh.drawIndirectInternal(buffer, offset, drawCountBuffer, drawCountOffset, maxDrawCount, stride);
+    return *this;
+}
+#endif
+#endif
+
 #ifndef MAGNUM_TARGET_GLES
 AbstractShaderProgram& AbstractShaderProgram::drawTransformFeedback(Mesh& mesh, TransformFeedback& xfb, UnsignedInt stream) {
     /* Nothing to draw, exit without touching any state */
@@ -534,14 +610,57 @@ AbstractShaderProgram& AbstractShaderProgram::dispatchCompute(const Vector3ui& w
 
 void AbstractShaderProgram::use(const GLuint id) {
     /* Use only if the program isn't already in use */
-    GLuint& current = Context::current().state().shaderProgram.current;
-    if(current != id) glUseProgram(current = id);
+    Implementation::State& state = Context::current().state();
+    GLuint& current = state.shaderProgram.current;
+    if(current == id) {
+        ++state.context.statistics.bindSkippedCount;
+        return;
+    }
+
+    ++state.context.statistics.bindCount;
+    ++state.context.statistics.shaderProgramSwitchCount;
+    glUseProgram(current = id);
 }
 
 void AbstractShaderProgram::use() { use(_id); }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void AbstractShaderProgram::binaryCacheKeyAppend(const Containers::ArrayView<const char> data) {
+    /* Do nothing if the cache isn't enabled */
+    if(!Context::current().state().shaderProgram.binaryCacheLoad) return;
+
+    /* A binary is valid only for the exact same driver, so make it a part of
+       the key */
+    if(!_binaryCacheHash) {
+        _binaryCacheHash.emplace();
+        for(const Containers::StringView string: {
+            Context::current().vendorString(),
+            Context::current().rendererString(),
+            Context::current().versionString()
+        }) binaryCacheKeyAppend(string);
+    }
+
+    *_binaryCacheHash << data;
+}
+
+void AbstractShaderProgram::binaryCacheKeyAppend(const Containers::StringView data) {
+    /* Prefix with the size to avoid different splits of the same
+       concatenated string resulting in the same key */
+    const std::size_t size = data.size();
+    binaryCacheKeyAppend(Containers::arrayView(reinterpret_cast<const char*>(&size), sizeof(std::size_t)));
+    binaryCacheKeyAppend(Containers::arrayView(data.data(), data.size()));
+}
+#endif
+
 void AbstractShaderProgram::attachShader(Shader& shader) {
     glAttachShader(_id, shader.id());
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    const Shader::Type type = shader.type();
+    binaryCacheKeyAppend(Containers::arrayView(reinterpret_cast<const char*>(&type), sizeof(Shader::Type)));
+    for(const Containers::StringView source: shader.sources())
+        binaryCacheKeyAppend(source);
+    #endif
 }
 
 void AbstractShaderProgram::attachShaders(const Containers::Iterable<Shader>& shaders) {
@@ -550,6 +669,11 @@ void AbstractShaderProgram::attachShaders(const Containers::Iterable<Shader>& sh
 
 void AbstractShaderProgram::bindAttributeLocation(const UnsignedInt location, const Containers::StringView name) {
     glBindAttribLocation(_id, location, Containers::String::nullTerminatedView(name).data());
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    binaryCacheKeyAppend(Containers::arrayView(reinterpret_cast<const char*>(&location), sizeof(UnsignedInt)));
+    binaryCacheKeyAppend(name);
+    #endif
 }
 
 #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
@@ -560,6 +684,9 @@ void AbstractShaderProgram::bindFragmentDataLocation(const UnsignedInt location,
     glBindFragDataLocationEXT
     #endif
         (_id, location, Containers::String::nullTerminatedView(name).data());
+
+    binaryCacheKeyAppend(Containers::arrayView(reinterpret_cast<const char*>(&location), sizeof(UnsignedInt)));
+    binaryCacheKeyAppend(name);
 }
 
 void AbstractShaderProgram::bindFragmentDataLocationIndexed(const UnsignedInt location, UnsignedInt index, const Containers::StringView name) {
@@ -569,12 +696,22 @@ void AbstractShaderProgram::bindFragmentDataLocationIndexed(const UnsignedInt lo
     glBindFragDataLocationIndexedEXT
     #endif
         (_id, location, index, Containers::String::nullTerminatedView(name).data());
+
+    const UnsignedInt locationIndex[]{location, index};
+    binaryCacheKeyAppend(Containers::arrayView(reinterpret_cast<const char*>(locationIndex), sizeof(locationIndex)));
+    binaryCacheKeyAppend(name);
 }
 #endif
 
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractShaderProgram::setTransformFeedbackOutputs(const Containers::StringIterable& outputs, const TransformFeedbackBufferMode bufferMode) {
     Context::current().state().shaderProgram.transformFeedbackVaryingsImplementation(*this, outputs, bufferMode);
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    binaryCacheKeyAppend(Containers::arrayView(reinterpret_cast<const char*>(&bufferMode), sizeof(TransformFeedbackBufferMode)));
+    for(const Containers::StringView output: outputs)
+        binaryCacheKeyAppend(output);
+    #endif
 }
 
 void AbstractShaderProgram::transformFeedbackVaryingsImplementationDefault(AbstractShaderProgram& self, const Containers::StringIterable& outputs, const TransformFeedbackBufferMode bufferMode) {
@@ -625,10 +762,55 @@ bool AbstractShaderProgram::link() {
 }
 
 void AbstractShaderProgram::submitLink() {
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    const Implementation::ShaderProgramState& state = Context::current().state().shaderProgram;
+    _binaryCacheHit = false;
+    _binaryCacheKey = {};
+    /* The cache could have been disabled between attachShader() and now */
+    if(_binaryCacheHash && state.binaryCacheLoad) {
+        constexpr const char Hex[]{"0123456789abcdef"};
+        const Utility::Sha1::Digest digest = _binaryCacheHash->digest();
+        _binaryCacheHash = nullptr;
+        _binaryCacheKey = Containers::String{NoInit, Utility::Sha1::DigestSize*2};
+        for(std::size_t i = 0; i != Utility::Sha1::DigestSize; ++i) {
+            const UnsignedByte byte = digest.byteArray()[i];
+            _binaryCacheKey[i*2 + 0] = Hex[byte >> 4];
+            _binaryCacheKey[i*2 + 1] = Hex[byte & 0xf];
+        }
+
+        /* The binary format is stored in the first four bytes. If the data is
+           found and the driver accepts it, we're done and there's no need to
+           link or even wait for the shaders to compile. */
+        const Containers::Optional<Containers::Array<char>> data = state.binaryCacheLoad(_binaryCacheKey, state.binaryCacheUserData);
+        if(data && data->size() > sizeof(GLenum)) {
+            GLenum format;
+            std::memcpy(&format, data->data(), sizeof(GLenum));
+            glProgramBinary(_id, format, data->data() + sizeof(GLenum), data->size() - sizeof(GLenum));
+
+            GLint success;
+            glGetProgramiv(_id, GL_LINK_STATUS, &success);
+            if(success) {
+                _binaryCacheKey = {};
+                _binaryCacheHit = true;
+                return;
+            }
+        }
+
+        /* Otherwise, such as after a driver update, link from scratch and
+           make the binary retrievable so checkLink() can store it */
+        glProgramParameteri(_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    #endif
+
     glLinkProgram(_id);
 }
 
 bool AbstractShaderProgram::checkLink(const Containers::Iterable<Shader>& shaders) {
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    /* Loaded from the binary cache, nothing to check */
+    if(_binaryCacheHit) return true;
+    #endif
+
     /* If any compilation failed, abort without even checking the link status.
        The checkCompile() API is called always, to print also compilation
        warnings even in case everything still manages to link well. */
@@ -670,6 +852,25 @@ bool AbstractShaderProgram::checkLink(const Containers::Iterable<Shader>& shader
             << Debug::newline << messageTrimmed;
     }
 
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    /* Store the binary if it wasn't found in the cache in submitLink() */
+    const Implementation::ShaderProgramState& state = Context::current().state().shaderProgram;
+    if(success && !_binaryCacheKey.isEmpty() && state.binaryCacheStore) {
+        GLint length{};
+        glGetProgramiv(_id, GL_PROGRAM_BINARY_LENGTH, &length);
+        if(length) {
+            Containers::Array<char> data{NoInit, sizeof(GLenum) + std::size_t(length)};
+            GLenum format;
+            GLsizei written{};
+            glGetProgramBinary(_id, length, &written, &format, data.data() + sizeof(GLenum));
+            std::memcpy(data.data(), &format, sizeof(GLenum));
+            if(written)
+                state.binaryCacheStore(_binaryCacheKey, data.prefix(sizeof(GLenum) + written), state.binaryCacheUserData);
+        }
+    }
+    _binaryCacheKey = {};
+    #endif
+
     return success;
 }
 
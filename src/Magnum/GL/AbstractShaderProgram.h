@@ -39,6 +39,10 @@
 #if defined(CORRADE_TARGET_WINDOWS) && !defined(MAGNUM_TARGET_GLES2)
 #include <Corrade/Containers/ArrayTuple.h>
 #endif
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/String.h>
+#endif
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 #include <Corrade/Utility/Macros.h>
@@ -55,6 +59,10 @@
 #include <Corrade/Containers/StringIterable.h>
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Corrade { namespace Utility { class Sha1; }}
+#endif
+
 namespace Magnum { namespace GL {
 
 namespace Implementation { struct ShaderProgramState; }
@@ -507,6 +515,32 @@ was done the usual way.
 
 @snippet GL.cpp AbstractShaderProgram-async-usage
 
+For compiling a larger amount of shaders in the background and polling them
+for completion each frame, the @ref ShaderCompileQueue class can be used.
+
+@subsection GL-AbstractShaderProgram-binary-cache Program binary cache
+
+Even with asynchronous compilation, building many shader variants can take a
+significant amount of time on startup, especially on mobile GPUs. If
+@gl_extension{ARB,get_program_binary} (part of OpenGL 4.1) or OpenGL ES 3.0 is
+available, an application can opt into a program binary cache by calling
+@ref setBinaryCache() with a pair of callbacks that load and store binary
+blobs from a persistent storage of its choice:
+
+@snippet GL.cpp AbstractShaderProgram-binary-cache
+
+Once enabled, all shader sources passed to @ref attachShader(), together with
+attribute, fragment output and transform feedback bindings and the driver
+vendor, renderer and version strings, are hashed into a key. In
+@ref submitLink() the key is passed to the load callback and if it returns a
+binary the driver accepts, linking is skipped altogether and the subsequent
+@ref checkLink() doesn't wait for any shader compilation either. Otherwise the
+program is linked from scratch and, if that succeeds, its binary is passed to
+the store callback in @ref checkLink(). As the key contains the driver
+version, binaries are implicitly invalidated by driver updates. That applies
+to all shaders including the builtin ones from the @ref Shaders namespace
+without any changes to their code.
+
 @section GL-AbstractShaderProgram-performance-optimization Performance optimizations
 
 The engine tracks currently used shader program to avoid unnecessary calls to
@@ -755,6 +789,38 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
         static Int maxTexelOffset();
         #endif
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Enable a program binary cache
+         * @param load      Callback for loading a binary from the cache
+         * @param store     Callback for storing a binary to the cache
+         * @param userData  User data passed to both callbacks
+         * @m_since_latest
+         *
+         * The @p load callback gets a key uniquely identifying given program
+         * and is expected to return the data previously passed to @p store
+         * with the same key or a @ref Containers::NullOpt if there's no such
+         * entry. The data are opaque to the application. Passing
+         * @cpp nullptr @ce to both callbacks disables the cache, expects that
+         * either both or neither callback is @cpp nullptr @ce. The setting is
+         * specific to the current context and affects only programs for which
+         * @ref attachShader() is called after.
+         *
+         * If @gl_extension{ARB,get_program_binary} is not available or the
+         * driver reports no supported program binary formats, the function
+         * does nothing. See @ref GL-AbstractShaderProgram-binary-cache for
+         * more information.
+         * @see @ref setRetrievableBinary(), @fn_gl{Get} with
+         *      @def_gl_keyword{NUM_PROGRAM_BINARY_FORMATS},
+         *      @fn_gl_keyword{GetProgramBinary}, @fn_gl_keyword{ProgramBinary}
+         * @requires_gl41 Extension @gl_extension{ARB,get_program_binary}
+         * @requires_gles30 Not available in OpenGL ES 2.0.
+         * @requires_gles Binary program representations are not supported in
+         *      WebGL.
+         */
+        static void setBinaryCache(Containers::Optional<Containers::Array<char>>(*load)(Containers::StringView key, void* userData), void(*store)(Containers::StringView key, Containers::ArrayView<const char> data, void* userData), void* userData = nullptr);
+        #endif
+
         /**
          * @brief Constructor
          *
@@ -1267,6 +1333,89 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
          */
         AbstractShaderProgram& draw(const Containers::Iterable<MeshView>& meshes);
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Draw a mesh using commands from a buffer
+         * @param mesh      Mesh to draw
+         * @param buffer    Buffer containing the draw commands
+         * @param offset    Offset of the first command in @p buffer, in bytes
+         * @param drawCount Count of commands to execute
+         * @param stride    Distance between two commands in @p buffer, in
+         *      bytes. If @cpp 0 @ce, the commands are assumed to be tightly
+         *      packed.
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that @p mesh is compatible with this shader and is fully
+         * set up. If the mesh is indexed, @p buffer is expected to contain
+         * @ref DrawElementsIndirectCommand structures, otherwise
+         * @ref DrawArraysIndirectCommand structures. Everything set by
+         * @ref Mesh::setCount(), @ref Mesh::setInstanceCount(),
+         * @ref Mesh::setBaseInstance(), @ref Mesh::setBaseVertex() and
+         * @ref Mesh::setIndexOffset() is ignored, the commands fully describe
+         * each draw. Because the indices are addressed relatively to the start
+         * of the index buffer, expects that the mesh index buffer was set
+         * with a zero offset. Both @p offset and @p stride are expected to be
+         * a multiple of 4. If @p drawCount is @cpp 0 @ce, no draw commands
+         * are issued.
+         *
+         * As the commands are sourced directly from GPU memory, this allows
+         * for example drawing command lists produced by a compute shader
+         * without any CPU round trip. On desktop GL, if
+         * @gl_extension{ARB,multi_draw_indirect} (part of OpenGL 4.3) is
+         * available, all commands are submitted with a single
+         * @fn_gl_keyword{MultiDrawArraysIndirect} /
+         * @fn_gl_keyword{MultiDrawElementsIndirect} call, otherwise and on
+         * OpenGL ES the functionality is emulated with a sequence of
+         * @fn_gl_keyword{DrawArraysIndirect} /
+         * @fn_gl_keyword{DrawElementsIndirect} calls. Note that in the latter
+         * case the `gl_DrawID` shader builtin isn't available.
+         * @see @ref draw(Mesh&, Buffer&, GLintptr, Buffer&, GLintptr, UnsignedInt, UnsignedInt),
+         *      @ref draw(Mesh&, const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const UnsignedInt>&),
+         *      @fn_gl_keyword{UseProgram}, @fn_gl_keyword{EnableVertexAttribArray},
+         *      @fn_gl{BindBuffer}, @fn_gl_keyword{VertexAttribPointer},
+         *      @fn_gl_keyword{DisableVertexAttribArray} or @fn_gl_keyword{BindVertexArray}
+         * @requires_gl40 Extension @gl_extension{ARB,draw_indirect}
+         * @requires_gles31 Indirect draws are not available in OpenGL ES 3.0
+         *      and older.
+         * @requires_gles Indirect draws are not available in WebGL.
+         */
+        AbstractShaderProgram& draw(Mesh& mesh, Buffer& buffer, GLintptr offset, UnsignedInt drawCount, UnsignedInt stride = 0);
+
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Draw a mesh using commands and a draw count from a buffer
+         * @param mesh              Mesh to draw
+         * @param buffer            Buffer containing the draw commands
+         * @param offset            Offset of the first command in @p buffer,
+         *      in bytes
+         * @param drawCountBuffer   Buffer containing the draw count
+         * @param drawCountOffset   Offset of a 32-bit draw count in
+         *      @p drawCountBuffer, in bytes
+         * @param maxDrawCount      Upper bound on the draw count
+         * @param stride            Distance between two commands in
+         *      @p buffer, in bytes. If @cpp 0 @ce, the commands are assumed
+         *      to be tightly packed.
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Compared to @ref draw(Mesh&, Buffer&, GLintptr, UnsignedInt, UnsignedInt)
+         * the actual count of commands to execute is read from
+         * @p drawCountBuffer, clamped to @p maxDrawCount, which allows both
+         * the commands and their count to be produced on the GPU. Expects
+         * that @p offset, @p drawCountOffset and @p stride are a multiple of
+         * 4. If @p maxDrawCount is @cpp 0 @ce, no draw commands are issued.
+         * @see @fn_gl{BindBuffer} with @def_gl{PARAMETER_BUFFER},
+         *      @fn_gl_keyword{MultiDrawArraysIndirectCount} /
+         *      @fn_gl_keyword{MultiDrawElementsIndirectCount}
+         * @requires_gl46 Extension @gl_extension{ARB,indirect_parameters}
+         * @requires_gl Indirect draw count is not available in OpenGL ES or
+         *      WebGL.
+         */
+        AbstractShaderProgram& draw(Mesh& mesh, Buffer& buffer, GLintptr offset, Buffer& drawCountBuffer, GLintptr drawCountOffset, UnsignedInt maxDrawCount, UnsignedInt stride = 0);
+        #endif
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES
         /**
          * @brief Draw a mesh with vertices coming out of transform feedback
@@ -1915,6 +2064,11 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
         MAGNUM_GL_LOCAL static void use(GLuint id);
         void use();
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        MAGNUM_GL_LOCAL void binaryCacheKeyAppend(Containers::ArrayView<const char> data);
+        MAGNUM_GL_LOCAL void binaryCacheKeyAppend(Containers::StringView data);
+        #endif
+
         /* To avoid pointless extra function pointer indirections and copypaste
            for all suffixed/unsuffixed variants, these are all static with a
            signature matching the DSA APIs. On DSA-enabled platforms the
@@ -1982,6 +2136,17 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
 
         GLuint _id;
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /* Hash of everything that affects the program binary, created in
+           attachShader() and friends only if the binary cache is enabled.
+           Turned into a key in submitLink(), which is then kept until
+           checkLink() if the binary wasn't found in the cache. */
+        Containers::Pointer<Utility::Sha1> _binaryCacheHash;
+        Containers::String _binaryCacheKey;
+        /* Set in submitLink() if the binary was loaded from the cache */
+        bool _binaryCacheHit{};
+        #endif
+
         #if defined(CORRADE_TARGET_WINDOWS) && !defined(MAGNUM_TARGET_GLES2)
         /* Needed for the nv-windows-dangling-transform-feedback-varying-names
            workaround */
@@ -2050,6 +2215,23 @@ class MAGNUM_GL_EXPORT AbstractShaderProgram: public AbstractObject {
         return static_cast<__VA_ARGS__&>(Magnum::GL::AbstractShaderProgram::drawTransformFeedback(mesh, xfb, stream)); \
     }
 #endif
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#ifndef MAGNUM_TARGET_GLES
+#define _MAGNUM_GL_ABSTRACTSHADERPROGRAM_SUBCLASS_DRAW_IMPLEMENTATION_INDIRECT_NOT_GLES(...) \
+    __VA_ARGS__& draw(Magnum::GL::Mesh& mesh, Magnum::GL::Buffer& buffer, GLintptr offset, Magnum::GL::Buffer& drawCountBuffer, GLintptr drawCountOffset, Magnum::UnsignedInt maxDrawCount, Magnum::UnsignedInt stride = 0) { \
+        return static_cast<__VA_ARGS__&>(Magnum::GL::AbstractShaderProgram::draw(mesh, buffer, offset, drawCountBuffer, drawCountOffset, maxDrawCount, stride)); \
+    }
+#else
+#define _MAGNUM_GL_ABSTRACTSHADERPROGRAM_SUBCLASS_DRAW_IMPLEMENTATION_INDIRECT_NOT_GLES(...)
+#endif
+#define _MAGNUM_GL_ABSTRACTSHADERPROGRAM_SUBCLASS_DRAW_IMPLEMENTATION_INDIRECT(...) \
+    __VA_ARGS__& draw(Magnum::GL::Mesh& mesh, Magnum::GL::Buffer& buffer, GLintptr offset, Magnum::UnsignedInt drawCount, Magnum::UnsignedInt stride = 0) { \
+        return static_cast<__VA_ARGS__&>(Magnum::GL::AbstractShaderProgram::draw(mesh, buffer, offset, drawCount, stride)); \
+    }                                                                       \
+    _MAGNUM_GL_ABSTRACTSHADERPROGRAM_SUBCLASS_DRAW_IMPLEMENTATION_INDIRECT_NOT_GLES(__VA_ARGS__)
+#else
+#define _MAGNUM_GL_ABSTRACTSHADERPROGRAM_SUBCLASS_DRAW_IMPLEMENTATION_INDIRECT(...)
+#endif
 #ifndef MAGNUM_TARGET_GLES
 #define _MAGNUM_GL_ABSTRACTSHADERPROGRAM_SUBCLASS_DRAW_IMPLEMENTATION_HIDE_XFB \
     using Magnum::GL::AbstractShaderProgram::drawTransformFeedback;
@@ -2100,6 +2282,7 @@ accidental calls to
         __VA_ARGS__& draw(const Corrade::Containers::Iterable<Magnum::GL::MeshView>& meshes) { \
             return static_cast<__VA_ARGS__&>(Magnum::GL::AbstractShaderProgram::draw(meshes)); \
         }                                                                   \
+        _MAGNUM_GL_ABSTRACTSHADERPROGRAM_SUBCLASS_DRAW_IMPLEMENTATION_INDIRECT(__VA_ARGS__) \
         _MAGNUM_GL_ABSTRACTSHADERPROGRAM_SUBCLASS_DRAW_IMPLEMENTATION_NOT_GLES(__VA_ARGS__)
 
 #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
@@ -40,6 +40,7 @@
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/PixelFormat.h"
 #include "Magnum/GL/TextureFormat.h"
+#include "Magnum/GL/Implementation/ContextState.h"
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Magnum/GL/Implementation/DebugState.h"
 #endif
@@ -172,7 +173,8 @@ void AbstractTexture::bindImplementationFallback(const GLint firstTextureUnit, c
 #ifndef MAGNUM_TARGET_GLES
 /** @todoc const Containers::ArrayView makes Doxygen grumpy */
 void AbstractTexture::bindImplementationMulti(const GLint firstTextureUnit, Containers::ArrayView<AbstractTexture* const> textures) {
-    Implementation::TextureState& textureState = Context::current().state().texture;
+    Implementation::State& state = Context::current().state();
+    Implementation::TextureState& textureState = state.texture;
 
     /* Create array of IDs and also update bindings in state tracker */
     /** @todo VLAs */
@@ -193,7 +195,11 @@ void AbstractTexture::bindImplementationMulti(const GLint firstTextureUnit, Cont
     }
 
     /* Avoid doing the binding if there is nothing different */
-    if(different) glBindTextures(firstTextureUnit, textures.size(), ids);
+    if(different) {
+        ++state.context.statistics.bindCount;
+        ++state.context.statistics.textureSwitchCount;
+        glBindTextures(firstTextureUnit, textures.size(), ids);
+    } else ++state.context.statistics.bindSkippedCount;
 }
 #endif
 
@@ -202,6 +208,29 @@ Int AbstractTexture::compressedBlockDataSize(const GLenum target, const TextureF
     return (Context::current().state().texture.compressedBlockDataSizeImplementation)(target, format);
 }
 
+Int AbstractTexture::virtualPageSizeCount(const GLenum target, const TextureFormat format) {
+    GLint value;
+    glGetInternalformativ(target, GLenum(format), GL_NUM_VIRTUAL_PAGE_SIZES_ARB, 1, &value);
+    return value;
+}
+
+Vector3i AbstractTexture::virtualPageSize(const GLenum target, const TextureFormat format, const Int index) {
+    const Int count = virtualPageSizeCount(target, format);
+    CORRADE_ASSERT(index < count,
+        "GL::AbstractTexture::virtualPageSize(): index" << index << "out of range for" << count << "page sizes of" << format, {});
+
+    /* The queries return all page sizes at once */
+    Containers::Array<GLint> values{NoInit, std::size_t(count)};
+    Vector3i size{NoInit};
+    glGetInternalformativ(target, GLenum(format), GL_VIRTUAL_PAGE_SIZE_X_ARB, count, values);
+    size.x() = values[index];
+    glGetInternalformativ(target, GLenum(format), GL_VIRTUAL_PAGE_SIZE_Y_ARB, count, values);
+    size.y() = values[index];
+    glGetInternalformativ(target, GLenum(format), GL_VIRTUAL_PAGE_SIZE_Z_ARB, count, values);
+    size.z() = values[index];
+    return size;
+}
+
 Int AbstractTexture::compressedBlockDataSizeImplementationDefault(const GLenum target, const TextureFormat format) {
     GLint value;
     glGetInternalformativ(target, GLenum(format), GL_TEXTURE_COMPRESSED_BLOCK_SIZE, 1, &value);
@@ -338,13 +367,38 @@ void AbstractTexture::bindImageInternal(const Int imageUnit, const Int level, co
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+UnsignedLong AbstractTexture::handle() {
+    createIfNotAlready();
+    return glGetTextureHandleARB(_id);
+}
+
+void AbstractTexture::makeHandleResident(const UnsignedLong handle) {
+    glMakeTextureHandleResidentARB(handle);
+}
+
+void AbstractTexture::makeHandleNonResident(const UnsignedLong handle) {
+    glMakeTextureHandleNonResidentARB(handle);
+}
+
+bool AbstractTexture::isHandleResident(const UnsignedLong handle) {
+    return glIsTextureHandleResidentARB(handle);
+}
+#endif
+
 void AbstractTexture::bind(Int textureUnit) {
-    Implementation::TextureState& textureState = Context::current().state().texture;
+    Implementation::State& state = Context::current().state();
+    Implementation::TextureState& textureState = state.texture;
 
     /* If already bound in given texture unit, nothing to do */
-    if(textureState.bindings[textureUnit].second() == _id) return;
+    if(textureState.bindings[textureUnit].second() == _id) {
+        ++state.context.statistics.bindSkippedCount;
+        return;
+    }
 
     /* Update state tracker, bind the texture to the unit */
+    ++state.context.statistics.bindCount;
+    ++state.context.statistics.textureSwitchCount;
     textureState.bindings[textureUnit] = {_target, _id};
     textureState.bindImplementation(*this, textureUnit);
 }
@@ -525,6 +579,20 @@ void AbstractTexture::generateMipmap() {
     Context::current().state().texture.mipmapImplementation(*this);
 }
 
+#ifndef MAGNUM_TARGET_GLES
+void AbstractTexture::setSparse(const bool sparse, const Int virtualPageSizeIndex) {
+    Context::current().state().texture.parameteriImplementation(*this, GL_TEXTURE_SPARSE_ARB, sparse);
+    Context::current().state().texture.parameteriImplementation(*this, GL_VIRTUAL_PAGE_SIZE_INDEX_ARB, virtualPageSizeIndex);
+}
+
+void AbstractTexture::setPageCommitmentInternal(const GLint level, const Vector3i& offset, const Vector3i& size, const bool commit) {
+    /* There's no DSA variant in ARB_sparse_texture, only in the EXT_dsa
+       extension, which isn't used anywhere else either */
+    bindInternal();
+    glTexPageCommitmentARB(_target, level, offset.x(), offset.y(), offset.z(), size.x(), size.y(), size.z(), commit);
+}
+#endif
+
 void AbstractTexture::mipmapImplementationDefault(AbstractTexture& self) {
     self.bindInternal();
     glGenerateMipmap(self._target);
@@ -541,11 +609,14 @@ void AbstractTexture::bindInternal() {
        functions need to have the texture bound in *currently active* unit,
        so we would need to call glActiveTexture() afterwards anyway. */
 
-    Implementation::TextureState& textureState = Context::current().state().texture;
+    Implementation::State& state = Context::current().state();
+    Implementation::TextureState& textureState = state.texture;
 
     /* If the texture is already bound in current unit, nothing to do */
-    if(textureState.bindings[textureState.currentTextureUnit].second() == _id)
+    if(textureState.bindings[textureState.currentTextureUnit].second() == _id) {
+        ++state.context.statistics.bindSkippedCount;
         return;
+    }
 
     /* Set internal unit as active if not already, update state tracker */
     CORRADE_INTERNAL_ASSERT(textureState.maxTextureUnits > 1);
@@ -554,7 +625,10 @@ void AbstractTexture::bindInternal() {
         glActiveTexture(GL_TEXTURE0 + (textureState.currentTextureUnit = internalTextureUnit));
 
     /* If already bound in given texture unit, nothing to do */
-    if(textureState.bindings[internalTextureUnit].second() == _id) return;
+    if(textureState.bindings[internalTextureUnit].second() == _id) {
+        ++state.context.statistics.bindSkippedCount;
+        return;
+    }
 
     /* Update state tracker, bind the texture to the unit. Not directly calling
        glBindTexture() here because we may need to include various
@@ -562,6 +636,7 @@ void AbstractTexture::bindInternal() {
        reuse textureState.bindImplementation as we *need* to call
        glBindTexture() in order to create it and have ObjectFlag::Created set
        (which is then asserted in createIfNotAlready()) */
+    ++state.context.statistics.bindCount;
     textureState.bindings[internalTextureUnit] = {_target, _id};
     textureState.bindInternalImplementation(*this, internalTextureUnit);
 }
@@ -320,6 +320,48 @@ class MAGNUM_GL_EXPORT AbstractTexture: public AbstractObject {
         static void bindImages(Int firstImageUnit, std::initializer_list<AbstractTexture*> textures);
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Make a bindless texture handle resident
+         * @m_since_latest
+         *
+         * A handle returned from @ref handle() has to be made resident before
+         * a shader can sample from it. Expects that the handle isn't resident
+         * already.
+         * @see @ref makeHandleNonResident(), @ref isHandleResident(),
+         *      @fn_gl_extension_keyword{MakeTextureHandleResident,ARB,bindless_texture}
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES and
+         *      WebGL.
+         */
+        static void makeHandleResident(UnsignedLong handle);
+
+        /**
+         * @brief Make a bindless texture handle non-resident
+         * @m_since_latest
+         *
+         * Expects that the handle is resident.
+         * @see @ref makeHandleResident(), @ref isHandleResident(),
+         *      @fn_gl_extension_keyword{MakeTextureHandleNonResident,ARB,bindless_texture}
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES and
+         *      WebGL.
+         */
+        static void makeHandleNonResident(UnsignedLong handle);
+
+        /**
+         * @brief Whether a bindless texture handle is resident
+         * @m_since_latest
+         *
+         * @see @ref makeHandleResident(), @ref makeHandleNonResident(),
+         *      @fn_gl_extension_keyword{IsTextureHandleResident,ARB,bindless_texture}
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES and
+         *      WebGL.
+         */
+        static bool isHandleResident(UnsignedLong handle);
+        #endif
+
         /** @brief Copying is not allowed */
         AbstractTexture(const AbstractTexture&) = delete;
 
@@ -405,6 +447,30 @@ class MAGNUM_GL_EXPORT AbstractTexture: public AbstractObject {
          */
         void bind(Int textureUnit);
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Bindless texture handle
+         * @m_since_latest
+         *
+         * Returns a 64-bit handle that can be passed to a shader through a
+         * uniform or a uniform buffer instead of binding the texture to a
+         * texture unit, which allows a single draw to access an arbitrary
+         * amount of textures. The handle has to be made resident using
+         * @ref makeHandleResident() before it can be used for sampling.
+         *
+         * Repeated calls return the same value. Once a handle is queried,
+         * texture parameters and storage become immutable, so the texture
+         * has to be fully set up and complete before calling this function.
+         * @see @ref Shaders::FlatGL::Flag::BindlessTextures,
+         *      @ref Shaders::PhongGL::Flag::BindlessTextures,
+         *      @fn_gl_extension_keyword{GetTextureHandle,ARB,bindless_texture}
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES and
+         *      WebGL.
+         */
+        UnsignedLong handle();
+        #endif
+
     #if !defined(MAGNUM_BUILD_DEPRECATED) || defined(DOXYGEN_GENERATING_OUTPUT)
     protected: /* Destructor was public before */
     #endif
@@ -433,6 +499,8 @@ class MAGNUM_GL_EXPORT AbstractTexture: public AbstractObject {
 
         #ifndef MAGNUM_TARGET_GLES
         static Int compressedBlockDataSize(GLenum target, TextureFormat format);
+        static Int virtualPageSizeCount(GLenum target, TextureFormat format);
+        static Vector3i virtualPageSize(GLenum target, TextureFormat format, Int index);
         #endif
 
         explicit AbstractTexture(GLenum target);
@@ -497,6 +565,10 @@ class MAGNUM_GL_EXPORT AbstractTexture: public AbstractObject {
         #endif
         void invalidateImage(Int level);
         void generateMipmap();
+        #ifndef MAGNUM_TARGET_GLES
+        void setSparse(bool sparse, Int virtualPageSizeIndex);
+        void setPageCommitmentInternal(GLint level, const Vector3i& offset, const Vector3i& size, bool commit);
+        #endif
 
         #ifndef MAGNUM_TARGET_GLES
         template<UnsignedInt dimensions> void image(GLint level, const BasicMutableImageView<dimensions>& image);
@@ -368,6 +368,20 @@ Debug& operator<<(Debug& debug, const FloatAttribute::DataType value) {
         _c(Double)
         #endif
         #undef _c
+
+        /* GL expects four components for the packed types always, for the
+           three-component variant the shader simply ignores the last one */
+        #ifndef MAGNUM_TARGET_GLES2
+        case VertexFormat::Vector3i1010102Normalized:
+        case VertexFormat::Vector4i1010102Normalized:
+            _components = Components::Four;
+            _dataType = DataType::Int2101010Rev;
+            break;
+        case VertexFormat::Vector4ui1010102Normalized:
+            _components = Components::Four;
+            _dataType = DataType::UnsignedInt2101010Rev;
+            break;
+        #endif
         /* LCOV_EXCL_STOP */
     }
 
@@ -479,6 +493,17 @@ bool hasVertexFormat(const VertexFormat format) {
     #endif
 
     switch(vertexFormatComponentFormat(format)) {
+        /* Packed formats need the 2_10_10_10_REV types, which are not on
+           ES2 */
+        case VertexFormat::Vector3i1010102Normalized:
+        case VertexFormat::Vector4i1010102Normalized:
+        case VertexFormat::Vector4ui1010102Normalized:
+            #ifndef MAGNUM_TARGET_GLES2
+            return true;
+            #else
+            return false;
+            #endif
+
         case VertexFormat::UnsignedByte:
         case VertexFormat::Byte:
         case VertexFormat::UnsignedShort:
@@ -580,6 +605,20 @@ DynamicAttribute::DynamicAttribute(const Kind kind, UnsignedInt location, const
         #endif
         #undef _c
 
+        /* GL expects four components for the packed types always, for the
+           three-component variant the shader simply ignores the last one */
+        #ifndef MAGNUM_TARGET_GLES2
+        case VertexFormat::Vector3i1010102Normalized:
+        case VertexFormat::Vector4i1010102Normalized:
+            _components = Components::Four;
+            _dataType = DataType::Int2101010Rev;
+            break;
+        case VertexFormat::Vector4ui1010102Normalized:
+            _components = Components::Four;
+            _dataType = DataType::UnsignedInt2101010Rev;
+            break;
+        #endif
+
         /* Nothing else expected to be returned from
            vertexFormatComponentFormat(), the unavailable formats were caught
            by the hasVertexFormat() above already */
@@ -609,8 +648,10 @@ DynamicAttribute::DynamicAttribute(const Kind kind, UnsignedInt location, const
     #ifndef CORRADE_NO_ASSERT
     CORRADE_ASSERT(_vectors <= maxVectors,
         "GL::DynamicAttribute: can't use" << format << "for a" << maxVectors << Debug::nospace << "-vector attribute", );
-    /* Should pass also if maxComponents is GL_BGRA */
-    CORRADE_ASSERT(GLint(_components) <= maxComponents,
+    /* Should pass also if maxComponents is GL_BGRA. Using the generic
+       component count and not _components, as for packed three-component
+       formats it's always four. */
+    CORRADE_ASSERT(GLint(vertexFormatComponentCount(format)) <= maxComponents,
         "GL::DynamicAttribute: can't use" << format << "for a" << maxComponents << Debug::nospace << "-component attribute", );
     #else
     static_cast<void>(maxVectors);
@@ -39,6 +39,7 @@
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Implementation/State.h"
 #include "Magnum/GL/Implementation/BufferState.h"
+#include "Magnum/GL/Implementation/ContextState.h"
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Magnum/GL/Implementation/DebugState.h"
 #endif
@@ -265,12 +266,17 @@ Buffer& Buffer::setLabel(const Containers::StringView label) {
 
 void Buffer::bindInternal(const TargetHint target, Buffer* const buffer) {
     const GLuint id = buffer ? buffer->_id : 0;
-    GLuint& bound = Context::current().state().buffer.bindings[Implementation::BufferState::indexForTarget(target)];
+    Implementation::State& state = Context::current().state();
+    GLuint& bound = state.buffer.bindings[Implementation::BufferState::indexForTarget(target)];
 
     /* Already bound, nothing to do */
-    if(bound == id) return;
+    if(bound == id) {
+        ++state.context.statistics.bindSkippedCount;
+        return;
+    }
 
     /* Bind the buffer otherwise, which will also finally create it */
+    ++state.context.statistics.bindCount;
     bound = id;
     if(buffer) buffer->_flags |= ObjectFlag::Created;
     glBindBuffer(GLenum(target), id);
@@ -356,7 +362,12 @@ Buffer& Buffer::bind(const Target target, const UnsignedInt index) {
 
 #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
 Buffer& Buffer::setStorage(const Containers::ArrayView<const void> data, const StorageFlags flags) {
-    Context::current().state().buffer.storageImplementation(*this, data, flags);
+    Implementation::State& state = Context::current().state();
+    state.buffer.storageImplementation(*this, data, flags);
+    if(data.data()) {
+        ++state.context.statistics.bufferUploadCount;
+        state.context.statistics.bufferUploadSize += data.size();
+    }
     return *this;
 }
 
@@ -382,12 +393,20 @@ Containers::Array<char> Buffer::data() {
 #endif
 
 Buffer& Buffer::setData(const Containers::ArrayView<const void> data, const BufferUsage usage) {
-    Context::current().state().buffer.dataImplementation(*this, data.size(), data, usage);
+    Implementation::State& state = Context::current().state();
+    state.buffer.dataImplementation(*this, data.size(), data, usage);
+    if(data.data()) {
+        ++state.context.statistics.bufferUploadCount;
+        state.context.statistics.bufferUploadSize += data.size();
+    }
     return *this;
 }
 
 Buffer& Buffer::setSubData(const GLintptr offset, const Containers::ArrayView<const void> data) {
-    Context::current().state().buffer.subDataImplementation(*this, offset, data.size(), data);
+    Implementation::State& state = Context::current().state();
+    state.buffer.subDataImplementation(*this, offset, data.size(), data);
+    ++state.context.statistics.bufferUploadCount;
+    state.context.statistics.bufferUploadSize += data.size();
     return *this;
 }
 
@@ -1377,6 +1377,7 @@ class MAGNUM_GL_EXPORT Buffer: public AbstractObject {
         friend Implementation::BufferState;
         #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
         friend BufferTexture; /* calls createIfNotAlready() */
+        friend TextureUploadQueue; /* calls bindInternal() */
         #endif
 
         static void bindInternal(TargetHint hint, Buffer* buffer);
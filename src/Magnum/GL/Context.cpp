@@ -27,6 +27,7 @@
 #include "Context.h"
 
 #include <algorithm> /* std::lower_bound() */
+#include <chrono>
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Reference.h>
@@ -61,6 +62,7 @@
 #ifndef MAGNUM_TARGET_GLES2
 #include "Magnum/GL/Implementation/TransformFeedbackState.h"
 #endif
+#include "Magnum/Math/Time.h"
 
 #if defined(CORRADE_TARGET_WINDOWS) && defined(MAGNUM_BUILD_STATIC_UNIQUE_GLOBALS) && !defined(CORRADE_TARGET_WINDOWS_RT)
 #include "Magnum/Implementation/WindowsWeakSymbol.h"
@@ -806,7 +808,8 @@ Context::Context(Context&& other) noexcept:
     _detectedDrivers{Utility::move(other._detectedDrivers)},
     _driverWorkarounds{Utility::move(other._driverWorkarounds)},
     _disabledExtensions{Utility::move(other._disabledExtensions)},
-    _configurationFlags{other._configurationFlags}
+    _configurationFlags{other._configurationFlags},
+    _creationDurations{other._creationDurations}
 {
     if(currentContext == &other) currentContext = this;
 }
@@ -815,6 +818,15 @@ Context::~Context() {
     if(currentContext == this) currentContext = nullptr;
 }
 
+namespace {
+
+/* Using steady_clock for the same reasons as in DebugTools::FrameProfiler */
+Long creationTimestamp() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}
+
 void Context::create(const Configuration& configuration) {
     /* Hard exit if the context cannot be created */
     if(!tryCreate(configuration)) std::exit(1);
@@ -855,10 +867,21 @@ bool Context::tryCreate(const Configuration& configuration) {
     for(const Extension& extension: configuration.disabledExtensions())
         arrayAppend(_disabledExtensions, extension);
 
+    /* Timestamps of each creation phase, exposed through creationDuration().
+       Phases that aren't reached because of an error stay zero. */
+    for(Long& i: _creationDurations) i = 0;
+    Long phaseStart = creationTimestamp();
+
     /* Load GL function pointers. Pass this instance to it so it can use it for
        potential driver-specific workarounds. */
     if(_functionLoader) _functionLoader(*this);
 
+    {
+        const Long now = creationTimestamp();
+        _creationDurations[UnsignedInt(CreationPhase::FunctionLoading)] = now - phaseStart;
+        phaseStart = now;
+    }
+
     /* Initialize to something predictable to avoid crashes on improperly
        created contexts */
     GLint majorVersion = 0, minorVersion = 0;
@@ -1001,10 +1024,22 @@ bool Context::tryCreate(const Configuration& configuration) {
     for(const Extension& extension: _disabledExtensions)
         _extensionRequiredVersion[extension.index()] = Version::None;
 
+    {
+        const Long now = creationTimestamp();
+        _creationDurations[UnsignedInt(CreationPhase::ExtensionDetection)] = now - phaseStart;
+        phaseStart = now;
+    }
+
     /* Setup driver workarounds (increase required version for particular
        extensions), see Implementation/driverWorkarounds.cpp */
     setupDriverWorkarounds();
 
+    {
+        const Long now = creationTimestamp();
+        _creationDurations[UnsignedInt(CreationPhase::DriverWorkarounds)] = now - phaseStart;
+        phaseStart = now;
+    }
+
     /* Set this context as current */
     CORRADE_ASSERT(!currentContext, "GL::Context: Another context currently active", false);
     currentContext = this;
@@ -1029,9 +1064,18 @@ bool Context::tryCreate(const Configuration& configuration) {
             Debug{output} << "   " << extension.string();
     }
 
+    /* The log printing above is counted into the finalization phase as
+       well */
+    const Long stateStart = creationTimestamp();
     Containers::Pair<Containers::ArrayTuple, Containers::Reference<Implementation::State>> state = Implementation::State::allocate(*this, output);
     _stateData = Utility::move(state.first());
     _state = &*state.second();
+    {
+        const Long now = creationTimestamp();
+        _creationDurations[UnsignedInt(CreationPhase::StateInitialization)] = now - stateStart;
+        _creationDurations[UnsignedInt(CreationPhase::Finalization)] = stateStart - phaseStart;
+        phaseStart = now;
+    }
 
     /* Print a list of used workarounds */
     if(!_driverWorkarounds.isEmpty()) {
@@ -1082,10 +1126,16 @@ bool Context::tryCreate(const Configuration& configuration) {
         #endif
     }
 
+    _creationDurations[UnsignedInt(CreationPhase::Finalization)] += creationTimestamp() - phaseStart;
+
     /* Everything okay */
     return true;
 }
 
+Nanoseconds Context::creationDuration(const CreationPhase phase) const {
+    return Nanoseconds{_creationDurations[UnsignedInt(phase)]};
+}
+
 Containers::StringView Context::vendorString() const {
     return {reinterpret_cast<const char*>(glGetString(GL_VENDOR)), Containers::StringViewFlag::Global};
 }
@@ -1228,6 +1278,14 @@ Version Context::supportedVersion(std::initializer_list<Version> versions) const
     #endif
 }
 
+auto Context::statistics() const -> const Statistics& {
+    return _state->context.statistics;
+}
+
+void Context::resetStatistics() {
+    _state->context.statistics = {};
+}
+
 void Context::resetState(const States states) {
     #ifndef MAGNUM_TARGET_GLES2
     /* Unbind a PBO (if any) to avoid confusing external GL code that is not
@@ -1396,6 +1454,27 @@ Debug& operator<<(Debug& debug, const Context::DetectedDriver value) {
     return debug << (packed ? "" : "(") << Debug::nospace << Debug::hex << GLint(value) << Debug::nospace << (packed ? "" : ")");
 }
 
+Debug& operator<<(Debug& debug, const Context::CreationPhase value) {
+    const bool packed = debug.immediateFlags() >= Debug::Flag::Packed;
+
+    if(!packed)
+        debug << "GL::Context::CreationPhase" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case Context::CreationPhase::value: return debug << (packed ? "" : "::") << Debug::nospace << #value;
+        _c(FunctionLoading)
+        _c(ExtensionDetection)
+        _c(DriverWorkarounds)
+        _c(StateInitialization)
+        _c(Finalization)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << (packed ? "" : "(") << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << (packed ? "" : ")");
+}
+
 Debug& operator<<(Debug& debug, const Context::DetectedDrivers value) {
     return Containers::enumSetDebugOutput(debug, value, debug.immediateFlags() >= Debug::Flag::Packed ? "{}" : "GL::Context::DetectedDrivers{}", {
         Context::DetectedDriver::Amd,
@@ -512,6 +512,106 @@ class MAGNUM_GL_EXPORT Context {
          */
         typedef Containers::EnumSet<DetectedDriver> DetectedDrivers;
 
+        /**
+         * @brief Context creation phase
+         * @m_since_latest
+         *
+         * @see @ref creationDuration()
+         */
+        enum class CreationPhase: UnsignedByte {
+            /** Loading OpenGL function pointers */
+            FunctionLoading,
+
+            /** Querying the version, context flags and supported extensions */
+            ExtensionDetection,
+
+            /** Detecting the driver and setting up driver workarounds */
+            DriverWorkarounds,
+
+            /** Initializing the internal state tracker */
+            StateInitialization,
+
+            /**
+             * Remaining setup, including printing the startup log, querying
+             * the default framebuffer viewport and enabling GPU validation
+             */
+            Finalization
+        };
+
+        /**
+         * @brief State tracker statistics
+         * @m_since_latest
+         *
+         * Counters of GL calls issued and skipped by the internal state
+         * tracker. All counters are cumulative since context creation or the
+         * last @ref resetStatistics() call, per-frame values can be
+         * calculated as a difference of two snapshots. See
+         * @ref DebugTools::FrameProfilerGL::Value::DrawCount and related
+         * values for a way to measure them per frame.
+         * @see @ref statistics()
+         */
+        struct Statistics {
+            /**
+             * Count of object binds that resulted in a GL call. Includes
+             * buffer, texture, framebuffer, renderbuffer, mesh, transform
+             * feedback binds and shader program switches.
+             */
+            UnsignedLong bindCount;
+
+            /**
+             * Count of object binds that were skipped because the object was
+             * already bound according to the state tracker.
+             */
+            UnsignedLong bindSkippedCount;
+
+            /**
+             * Count of shader program switches that resulted in a GL call. A
+             * subset of @ref bindCount.
+             */
+            UnsignedLong shaderProgramSwitchCount;
+
+            /**
+             * Count of binds of a texture to a texture unit that resulted in a
+             * GL call. A subset of @ref bindCount.
+             */
+            UnsignedLong textureSwitchCount;
+
+            /**
+             * Count of data uploads done via @ref Buffer::setData(),
+             * @relativeref{Buffer,setSubData()} and
+             * @relativeref{Buffer,setStorage()}. Calls that only allocate
+             * the storage without any data aren't counted.
+             */
+            UnsignedLong bufferUploadCount;
+
+            /** Total size of uploaded buffer data in bytes */
+            UnsignedLong bufferUploadSize;
+
+            /**
+             * Count of draw calls. A multi-draw or an indirect draw counts as
+             * a single call.
+             */
+            UnsignedLong drawCount;
+
+            /**
+             * Count of framebuffer attachments invalidated via
+             * @ref Framebuffer::invalidate() or
+             * @ref DefaultFramebuffer::invalidate(). Calls that do nothing
+             * because framebuffer invalidation isn't supported by the driver
+             * aren't counted.
+             */
+            UnsignedLong invalidatedAttachmentCount;
+
+            /**
+             * Pixel area of the invalidated attachments, summed over all
+             * attachments in @ref invalidatedAttachmentCount. If the whole
+             * framebuffer is invalidated, the area is taken from its
+             * viewport. Multiplied by pixel size of the attachments, gives an
+             * estimate of memory bandwidth saved on tiled GPUs.
+             */
+            UnsignedLong invalidatedPixelCount;
+        };
+
         /**
          * @brief Whether there is any current context
          *
@@ -852,6 +952,24 @@ class MAGNUM_GL_EXPORT Context {
          */
         void resetState(States states = ~States{});
 
+        /**
+         * @brief State tracker statistics
+         * @m_since_latest
+         *
+         * Counters are always enabled and updated only in code paths that
+         * already access the state tracker, so the overhead is negligible.
+         * @see @ref resetStatistics()
+         */
+        const Statistics& statistics() const;
+
+        /**
+         * @brief Reset state tracker statistics
+         * @m_since_latest
+         *
+         * Sets all @ref Statistics counters to zero.
+         */
+        void resetStatistics();
+
         /**
          * @brief Detect driver
          *
@@ -862,6 +980,22 @@ class MAGNUM_GL_EXPORT Context {
          */
         DetectedDrivers detectedDriver();
 
+        /**
+         * @brief Duration of a context creation phase
+         * @m_since_latest
+         *
+         * Measured during @ref create() or @ref tryCreate(), not including
+         * the time spent by the platform-specific code creating the
+         * underlying OpenGL context. Useful for profiling startup of
+         * short-lived applications such as headless batch jobs, a breakdown
+         * of all phases is printed by @ref magnum-gl-info "magnum-gl-info"
+         * with the `--timing` option. Returns @cpp 0_nsec @ce if the context
+         * isn't created yet or if creation failed before reaching given
+         * phase. Use @ref Magnum/Math/Time.h to operate with the returned
+         * value.
+         */
+        Nanoseconds creationDuration(CreationPhase phase) const;
+
     #ifdef DOXYGEN_GENERATING_OUTPUT
     private:
     #endif
@@ -930,6 +1064,9 @@ class MAGNUM_GL_EXPORT Context {
         Containers::Array<Containers::Pair<Containers::StringView, bool>> _driverWorkarounds;
         Containers::Array<Extension> _disabledExtensions;
         Implementation::ContextConfigurationFlags _configurationFlags;
+        /* Indexed by CreationPhase. Not using Nanoseconds as that would
+           require including Time.h */
+        Containers::StaticArray<5, Long> _creationDurations;
 };
 
 #ifndef MAGNUM_TARGET_WEBGL
@@ -952,6 +1089,12 @@ MAGNUM_GL_EXPORT Debug& operator<<(Debug& debug, Context::DetectedDriver value);
 /** @debugoperatorclassenum{Context,Context::DetectedDrivers} */
 MAGNUM_GL_EXPORT Debug& operator<<(Debug& debug, Context::DetectedDrivers value);
 
+/**
+@debugoperatorclassenum{Context,Context::CreationPhase}
+@m_since_latest
+*/
+MAGNUM_GL_EXPORT Debug& operator<<(Debug& debug, Context::CreationPhase value);
+
 /**
 @brief Configuration
 @m_since_latest
@@ -0,0 +1,109 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Fence.h"
+
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Time.h"
+
+namespace Magnum { namespace GL {
+
+Fence::Fence(): _id{glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)}, _flags{ObjectFlag::DeleteOnDestruction}, _flushed{} {}
+
+Fence::~Fence() {
+    /* Moved out or not deleting on destruction, nothing to do */
+    if(!_id || !(_flags & ObjectFlag::DeleteOnDestruction)) return;
+
+    glDeleteSync(_id);
+}
+
+bool Fence::isSignaled() const {
+    CORRADE_ASSERT(_id,
+        "GL::Fence::isSignaled(): the fence is not created", {});
+
+    GLint status;
+    glGetSynciv(_id, GL_SYNC_STATUS, 1, nullptr, &status);
+    return status == GL_SIGNALED;
+}
+
+Fence::Status Fence::clientWait(const Nanoseconds timeout) {
+    CORRADE_ASSERT(_id,
+        "GL::Fence::clientWait(): the fence is not created", {});
+    #ifndef MAGNUM_TARGET_WEBGL
+    CORRADE_ASSERT(Long(timeout) >= 0,
+        "GL::Fence::clientWait(): expected a non-negative timeout, got" << timeout, {});
+    #else
+    CORRADE_ASSERT(Long(timeout) == 0,
+        "GL::Fence::clientWait(): expected a zero timeout on WebGL, got" << timeout, {});
+    #endif
+
+    /* Flush on the first wait so the fence is guaranteed to get signaled
+       eventually, subsequent waits don't need to */
+    const GLbitfield flags = _flushed ? 0 : GL_SYNC_FLUSH_COMMANDS_BIT;
+    _flushed = true;
+    return Status(glClientWaitSync(_id, flags, GLuint64(Long(timeout))));
+}
+
+#ifndef MAGNUM_TARGET_WEBGL
+void Fence::clientWait() {
+    CORRADE_ASSERT(_id,
+        "GL::Fence::clientWait(): the fence is not created", );
+
+    /* Waiting in reasonably long steps instead of passing the maximum
+       timeout, as that's implementation-defined and thus capped anyway */
+    Status status;
+    while((status = clientWait(Nanoseconds{1000000})) == Status::TimeoutExpired);
+    CORRADE_INTERNAL_ASSERT(status != Status::WaitFailed);
+}
+#endif
+
+void Fence::serverWait() {
+    CORRADE_ASSERT(_id,
+        "GL::Fence::serverWait(): the fence is not created", );
+
+    glWaitSync(_id, 0, GL_TIMEOUT_IGNORED);
+}
+
+Debug& operator<<(Debug& debug, const Fence::Status value) {
+    debug << "GL::Fence::Status" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case Fence::Status::value: return debug << "::" #value;
+        _c(AlreadySignaled)
+        _c(ConditionSatisfied)
+        _c(TimeoutExpired)
+        _c(WaitFailed)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << GLenum(value) << Debug::nospace << ")";
+}
+
+}}
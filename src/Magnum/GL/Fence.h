@@ -0,0 +1,241 @@
+#ifndef Magnum_GL_Fence_h
+#define Magnum_GL_Fence_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::GL::Fence
+ * @m_since_latest
+ */
+
+#include "Magnum/configure.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
+#include "Magnum/GL/AbstractObject.h"
+
+namespace Magnum { namespace GL {
+
+/**
+@brief Fence sync object
+@m_since_latest
+
+Inserted into the GL command stream on construction and signaled once the GPU
+finishes all commands submitted before it. Useful for knowing when it's safe
+to reuse memory that the GPU reads from or for retrieving results of an
+asynchronous operation without stalling the pipeline:
+
+@snippet GL.cpp Fence-usage
+
+The status can be queried without blocking with @ref isSignaled(), while
+@ref clientWait() blocks the calling thread until the fence gets signaled or
+given timeout expires. The first client wait on a particular fence flushes the
+command queue to ensure the fence gets eventually signaled, subsequent waits
+don't.
+@requires_gl32 Extension @gl_extension{ARB,sync}
+@requires_gles30 Fence sync objects are not available in OpenGL ES 2.0.
+@requires_webgl20 Fence sync objects are not available in WebGL 1.0.
+@see @ref StreamingBuffer, @ref TextureUploadQueue
+*/
+class MAGNUM_GL_EXPORT Fence {
+    public:
+        /**
+         * @brief Client wait status
+         *
+         * @see @ref clientWait()
+         */
+        enum class Status: GLenum {
+            /** The fence was already signaled when the wait started */
+            AlreadySignaled = GL_ALREADY_SIGNALED,
+
+            /** The fence got signaled before the timeout expired */
+            ConditionSatisfied = GL_CONDITION_SATISFIED,
+
+            /** The timeout expired before the fence got signaled */
+            TimeoutExpired = GL_TIMEOUT_EXPIRED,
+
+            /** An error occurred */
+            WaitFailed = GL_WAIT_FAILED
+        };
+
+        /**
+         * @brief Wrap existing OpenGL fence sync object
+         * @param id        OpenGL fence sync object
+         * @param flags     Object creation flags
+         *
+         * The @p id is expected to be of an existing OpenGL fence sync
+         * object. Unlike fence created using constructor, the OpenGL object
+         * is by default not deleted on destruction, use @p flags for
+         * different behavior.
+         * @see @ref release()
+         */
+        static Fence wrap(GLsync id, ObjectFlags flags = {}) {
+            return Fence{id, flags};
+        }
+
+        /**
+         * @brief Constructor
+         *
+         * Creates a new fence sync object and inserts it into the command
+         * stream.
+         * @see @ref Fence(NoCreateT), @ref wrap(),
+         *      @fn_gl_keyword{FenceSync} with
+         *      @def_gl{SYNC_GPU_COMMANDS_COMPLETE}
+         */
+        explicit Fence();
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         * However note that this is a low-level and a potentially dangerous
+         * API, see the documentation of @ref NoCreate for alternatives.
+         * @see @ref Fence(), @ref wrap()
+         */
+        explicit Fence(NoCreateT) noexcept: _id{}, _flags{ObjectFlag::DeleteOnDestruction}, _flushed{} {}
+
+        /** @brief Copying is not allowed */
+        Fence(const Fence&) = delete;
+
+        /** @brief Move constructor */
+        Fence(Fence&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes associated OpenGL fence sync object.
+         * @see @ref wrap(), @ref release(), @fn_gl_keyword{DeleteSync}
+         */
+        ~Fence();
+
+        /** @brief Copying is not allowed */
+        Fence& operator=(const Fence&) = delete;
+
+        /** @brief Move assignment */
+        Fence& operator=(Fence&& other) noexcept;
+
+        /** @brief OpenGL fence sync object */
+        GLsync id() const { return _id; }
+
+        /**
+         * @brief Release OpenGL object
+         *
+         * Releases ownership of OpenGL fence sync object and returns it so it
+         * is not deleted on destruction. The internal state is then
+         * equivalent to moved-from state.
+         * @see @ref wrap()
+         */
+        GLsync release();
+
+        /**
+         * @brief Whether the fence is signaled
+         *
+         * Doesn't block and doesn't flush the command queue. Expects that the
+         * fence is created.
+         * @see @fn_gl_keyword{GetSync} with @def_gl{SYNC_STATUS}
+         */
+        bool isSignaled() const;
+
+        /**
+         * @brief Wait for the fence on the client side
+         *
+         * Blocks until the fence gets signaled or @p timeout expires. Passing
+         * a zero timeout makes it just check the status. If this is the first
+         * client wait on this fence, the command queue is flushed first.
+         * Expects that the fence is created.
+         * @see @ref isSignaled(), @fn_gl_keyword{ClientWaitSync} with
+         *      @def_gl{SYNC_FLUSH_COMMANDS_BIT}
+         * @requires_webgl20 The @p timeout is expected to be zero on WebGL,
+         *      which doesn't allow blocking the main thread.
+         */
+        Status clientWait(Nanoseconds timeout);
+
+        #ifndef MAGNUM_TARGET_WEBGL
+        /**
+         * @brief Wait for the fence on the client side without a timeout
+         *
+         * Blocks until the fence gets signaled. Expects that the fence is
+         * created.
+         * @see @ref clientWait(Nanoseconds)
+         * @requires_gles Blocking client waits are not available in WebGL.
+         */
+        void clientWait();
+        #endif
+
+        /**
+         * @brief Wait for the fence on the server side
+         *
+         * Makes the GPU wait until the fence is signaled before executing
+         * further commands. Returns immediately on the client side. Useful
+         * for synchronizing command streams of two shared contexts. Expects
+         * that the fence is created.
+         * @see @fn_gl_keyword{WaitSync} with @def_gl{TIMEOUT_IGNORED}
+         */
+        void serverWait();
+
+    private:
+        explicit Fence(GLsync id, ObjectFlags flags) noexcept: _id{id}, _flags{flags}, _flushed{} {}
+
+        GLsync _id;
+        ObjectFlags _flags;
+        bool _flushed;
+};
+
+/** @debugoperatorclassenum{Fence,Fence::Status} */
+MAGNUM_GL_EXPORT Debug& operator<<(Debug& debug, Fence::Status value);
+
+inline Fence::Fence(Fence&& other) noexcept: _id{other._id}, _flags{other._flags}, _flushed{other._flushed} {
+    other._id = nullptr;
+}
+
+inline Fence& Fence::operator=(Fence&& other) noexcept {
+    using Utility::swap;
+    swap(_id, other._id);
+    swap(_flags, other._flags);
+    swap(_flushed, other._flushed);
+    return *this;
+}
+
+inline GLsync Fence::release() {
+    const GLsync id = _id;
+    _id = nullptr;
+    return id;
+}
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -98,6 +98,9 @@ class CubeMapTextureArray;
 /* DimensionTraits forward declaration is not needed */
 
 class Extension;
+#ifndef MAGNUM_TARGET_GLES2
+class Fence;
+#endif
 class Framebuffer;
 
 #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
@@ -142,6 +145,10 @@ class RectangleTexture;
 class Renderbuffer;
 enum class RenderbufferFormat: GLenum;
 
+#ifndef MAGNUM_TARGET_GLES2
+class RenderPass;
+#endif
+
 enum class SamplerFilter: GLint;
 enum class SamplerMipmap: GLint;
 enum class SamplerWrapping: GLint;
@@ -155,6 +162,10 @@ enum class SamplerDepthStencilMode: GLenum;
 
 class Sampler;
 class Shader;
+template<class> class ShaderCompileQueue;
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+class StreamingBuffer;
+#endif
 
 template<UnsignedInt> class Texture;
 #ifndef MAGNUM_TARGET_GLES
@@ -172,6 +183,9 @@ typedef TextureArray<1> Texture1DArray;
 #endif
 typedef TextureArray<2> Texture2DArray;
 #endif
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+class TextureUploadQueue;
+#endif
 
 enum class TextureFormat: GLenum;
 
@@ -27,13 +27,15 @@
 */
 
 #include "Magnum/Magnum.h"
-#include "Magnum/GL/GL.h"
+#include "Magnum/GL/Context.h"
 
 namespace Magnum { namespace GL { namespace Implementation {
 
 struct ContextState {
     explicit ContextState(Context& context, Containers::StaticArrayView<Implementation::ExtensionCount, const char*> extensions);
 
+    Context::Statistics statistics{};
+
     #ifndef MAGNUM_TARGET_GLES
     enum class CoreProfile {
         Initial,
@@ -532,13 +532,20 @@ MeshState::MeshState(Context& context, ContextState& contextState, Containers::S
     #endif
 }
 
-#ifndef MAGNUM_TARGET_GLES
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
 MeshState::~MeshState() {
+    #ifndef MAGNUM_TARGET_GLES
     /* If the default VAO was created, we need to delete it to avoid leaks.
        Delete also the scratch VAO if the engine was so unlucky to have to run
        awful external GL code (it was created in Context::resetState()). */
     if(defaultVAO) glDeleteVertexArrays(1, &defaultVAO);
     if(scratchVAO) glDeleteVertexArrays(1, &scratchVAO);
+    #endif
+
+    /* VAOs shared by meshes with Mesh::shareVertexFormat() are owned by the
+       context */
+    for(const VertexFormat& format: vertexFormats)
+        glDeleteVertexArrays(1, &format.id);
 }
 #endif
 
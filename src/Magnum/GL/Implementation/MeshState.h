@@ -33,8 +33,23 @@ namespace Magnum { namespace GL { namespace Implementation {
 struct ContextState;
 
 struct MeshState {
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    /* Vertex format shared by meshes with Mesh::shareVertexFormat() enabled,
+       matching the corresponding Mesh::AttributeLayout fields */
+    struct VertexFormatAttribute {
+        UnsignedByte location;
+        UnsignedByte kindSize;
+        UnsignedShort type;
+        UnsignedInt divisor;
+    };
+    struct VertexFormat {
+        GLuint id;
+        Containers::Array<VertexFormatAttribute> attributes;
+    };
+    #endif
+
     explicit MeshState(Context& context, ContextState& contextState, Containers::StaticArrayView<Implementation::ExtensionCount, const char*> extensions);
-    #ifndef MAGNUM_TARGET_GLES
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
     ~MeshState();
     #endif
 
@@ -102,6 +117,9 @@ struct MeshState {
     #endif
 
     GLuint currentVAO;
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    Containers::Array<VertexFormat> vertexFormats;
+    #endif
     #if !defined(MAGNUM_TARGET_WEBGL) && !defined(MAGNUM_TARGET_GLES2)
     GLint maxVertexAttributeStride{};
     #endif
@@ -117,6 +117,14 @@ struct ShaderProgramState {
     /* Currently used program */
     GLuint current;
 
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    /* Program binary cache callbacks, set via
+       AbstractShaderProgram::setBinaryCache(). Both null if disabled. */
+    Containers::Optional<Containers::Array<char>>(*binaryCacheLoad)(Containers::StringView, void*){};
+    void(*binaryCacheStore)(Containers::StringView, Containers::ArrayView<const char>, void*){};
+    void* binaryCacheUserData{};
+    #endif
+
     GLint maxVertexAttributes;
     #ifndef MAGNUM_TARGET_GLES2
     #ifndef MAGNUM_TARGET_WEBGL
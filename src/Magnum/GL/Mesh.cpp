@@ -42,6 +42,7 @@
 #include "Magnum/GL/TransformFeedback.h"
 #endif
 #include "Magnum/GL/Implementation/BufferState.h"
+#include "Magnum/GL/Implementation/ContextState.h"
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Magnum/GL/Implementation/DebugState.h"
 #endif
@@ -353,7 +354,11 @@ Mesh::~Mesh() {
     Context::current().state().mesh.destroyImplementation(*this);
 }
 
-Mesh::Mesh(Mesh&& other) noexcept: _id(other._id), _primitive(other._primitive), _flags{other._flags}, _countSet{other._countSet}, _count(other._count), _baseVertex{other._baseVertex}, _instanceCount{other._instanceCount},
+Mesh::Mesh(Mesh&& other) noexcept: _id(other._id), _primitive(other._primitive), _flags{other._flags}, _countSet{other._countSet},
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    _vertexFormatShared{other._vertexFormatShared},
+    #endif
+    _count(other._count), _baseVertex{other._baseVertex}, _instanceCount{other._instanceCount},
     #ifndef MAGNUM_TARGET_GLES
     _baseInstance{other._baseInstance},
     #endif
@@ -372,6 +377,9 @@ Mesh& Mesh::operator=(Mesh&& other) noexcept {
     swap(_flags, other._flags);
     swap(_primitive, other._primitive);
     swap(_countSet, other._countSet);
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    swap(_vertexFormatShared, other._vertexFormatShared);
+    #endif
     swap(_count, other._count);
     swap(_baseVertex, other._baseVertex);
     swap(_instanceCount, other._instanceCount);
@@ -426,6 +434,35 @@ Mesh& Mesh::setLabel(const Containers::StringView label) {
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+Mesh& Mesh::shareVertexFormat() {
+    CORRADE_ASSERT(_attributes.isEmpty(),
+        "GL::Mesh::shareVertexFormat(): expected to be called before adding vertex buffers", *this);
+
+    /* Nothing to do if already shared or if it's not possible */
+    if(_vertexFormatShared) return *this;
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::vertex_array_object>() ||
+       !Context::current().isExtensionSupported<Extensions::ARB::vertex_attrib_binding>())
+    #else
+    if(!Context::current().isVersionSupported(Version::GLES310))
+    #endif
+        return *this;
+
+    /* Delete the owned VAO, if any. The shared one gets looked up on first
+       draw, and the mesh doesn't own it. */
+    if(_id && (_flags & ObjectFlag::DeleteOnDestruction)) {
+        GLuint& current = Context::current().state().mesh.currentVAO;
+        if(current == _id) current = 0;
+        Context::current().state().mesh.destroyImplementation(*this);
+    }
+    _id = 0;
+    _flags &= ~ObjectFlag::DeleteOnDestruction;
+    _vertexFormatShared = true;
+    return *this;
+}
+#endif
+
 MeshIndexType Mesh::indexType() const {
     CORRADE_ASSERT(_indexBuffer.id(), "GL::Mesh::indexType(): mesh is not indexed", {});
     return _indexType;
@@ -469,8 +506,14 @@ Mesh& Mesh::setIndexBuffer(Buffer&& buffer, GLintptr offset, MeshIndexType type,
 
     /* It's IMPORTANT to do this *before* the _indexBuffer is set, since the
        bindVAO() function called from here is resetting element buffer state
-       tracker to _indexBuffer.id(). */
-    Context::current().state().mesh.bindIndexBufferImplementation(*this, buffer);
+       tracker to _indexBuffer.id(). With a shared vertex format the index
+       buffer is bound on every draw instead. */
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(!_vertexFormatShared)
+    #endif
+    {
+        Context::current().state().mesh.bindIndexBufferImplementation(*this, buffer);
+    }
 
     _indexBuffer = Utility::move(buffer);
     _indexBufferOffset = offset;
@@ -501,7 +544,9 @@ void Mesh::drawInternal(const Containers::ArrayView<const UnsignedInt>& counts,
        original mesh, the counts/vertexOffsets/indexOffsets completely describe
        the range being drawn */
 
-    const Implementation::MeshState& state = Context::current().state().mesh;
+    Implementation::State& glState = Context::current().state();
+    const Implementation::MeshState& state = glState.mesh;
+    ++glState.context.statistics.drawCount;
     state.bindImplementation(*this);
 
     /* Non-indexed meshes */
@@ -562,7 +607,9 @@ void Mesh::drawInternal(const Containers::ArrayView<const UnsignedInt>& counts,
     , const Containers::ArrayView<const UnsignedInt>& instanceOffsets
     #endif
 ) {
-    const Implementation::MeshState& state = Context::current().state().mesh;
+    Implementation::State& glState = Context::current().state();
+    const Implementation::MeshState& state = glState.mesh;
+    ++glState.context.statistics.drawCount;
     state.bindImplementation(*this);
 
     CORRADE_ASSERT(instanceCounts.size() == counts.size(),
@@ -870,7 +917,9 @@ void Mesh::drawInternal(Int count, Int baseVertex, Int instanceCount, UnsignedIn
 void Mesh::drawInternal(Int count, Int baseVertex, Int instanceCount, GLintptr indexOffset)
 #endif
 {
-    const Implementation::MeshState& state = Context::current().state().mesh;
+    Implementation::State& glState = Context::current().state();
+    const Implementation::MeshState& state = glState.mesh;
+    ++glState.context.statistics.drawCount;
 
     const GLintptr indexByteOffset = _indexBuffer.id() ?
         _indexBufferOffset + indexOffset*meshIndexTypeSize(_indexType) :
@@ -1018,7 +1067,9 @@ void Mesh::drawInternal(Int count, Int baseVertex, Int instanceCount, GLintptr i
 
 #ifndef MAGNUM_TARGET_GLES
 void Mesh::drawInternal(TransformFeedback& xfb, const UnsignedInt stream, const Int instanceCount) {
-    const Implementation::MeshState& state = Context::current().state().mesh;
+    Implementation::State& glState = Context::current().state();
+    const Implementation::MeshState& state = glState.mesh;
+    ++glState.context.statistics.drawCount;
 
     state.bindImplementation(*this);
 
@@ -1043,6 +1094,75 @@ void Mesh::drawInternal(TransformFeedback& xfb, const UnsignedInt stream, const
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void Mesh::drawIndirectInternal(Buffer& buffer, const GLintptr offset, const UnsignedInt drawCount, UnsignedInt stride) {
+    Implementation::State& glState = Context::current().state();
+    const Implementation::MeshState& state = glState.mesh;
+    ++glState.context.statistics.drawCount;
+
+    state.bindImplementation(*this);
+    buffer.bindInternal(Buffer::TargetHint::DrawIndirect);
+
+    /* Non-indexed mesh */
+    if(!_indexBuffer.id()) {
+        if(!stride) stride = sizeof(DrawArraysIndirectCommand);
+
+        #ifndef MAGNUM_TARGET_GLES
+        if(drawCount != 1 && Context::current().isExtensionSupported<Extensions::ARB::multi_draw_indirect>())
+            glMultiDrawArraysIndirect(GLenum(_primitive), reinterpret_cast<GLvoid*>(offset), drawCount, stride);
+        else
+        #endif
+        {
+            for(UnsignedInt i = 0; i != drawCount; ++i)
+                glDrawArraysIndirect(GLenum(_primitive), reinterpret_cast<GLvoid*>(offset + i*stride));
+        }
+
+    /* Indexed mesh */
+    } else {
+        if(!stride) stride = sizeof(DrawElementsIndirectCommand);
+
+        #ifndef MAGNUM_TARGET_GLES
+        if(drawCount != 1 && Context::current().isExtensionSupported<Extensions::ARB::multi_draw_indirect>())
+            glMultiDrawElementsIndirect(GLenum(_primitive), GLenum(_indexType), reinterpret_cast<GLvoid*>(offset), drawCount, stride);
+        else
+        #endif
+        {
+            for(UnsignedInt i = 0; i != drawCount; ++i)
+                glDrawElementsIndirect(GLenum(_primitive), GLenum(_indexType), reinterpret_cast<GLvoid*>(offset + i*stride));
+        }
+    }
+
+    state.unbindImplementation(*this);
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void Mesh::drawIndirectInternal(Buffer& buffer, const GLintptr offset, Buffer& drawCountBuffer, const GLintptr drawCountOffset, const UnsignedInt maxDrawCount, const UnsignedInt stride) {
+    Implementation::State& glState = Context::current().state();
+    const Implementation::MeshState& state = glState.mesh;
+    ++glState.context.statistics.drawCount;
+
+    state.bindImplementation(*this);
+    buffer.bindInternal(Buffer::TargetHint::DrawIndirect);
+
+    /* GL_PARAMETER_BUFFER isn't tracked by the state tracker, bind it directly
+       and reset it back after so it doesn't stay dangling */
+    glBindBuffer(GL_PARAMETER_BUFFER, drawCountBuffer.id());
+
+    /* Non-indexed mesh */
+    if(!_indexBuffer.id())
+        glMultiDrawArraysIndirectCount(GLenum(_primitive), reinterpret_cast<GLvoid*>(offset), drawCountOffset, maxDrawCount, stride);
+
+    /* Indexed mesh */
+    else
+        glMultiDrawElementsIndirectCount(GLenum(_primitive), GLenum(_indexType), reinterpret_cast<GLvoid*>(offset), drawCountOffset, maxDrawCount, stride);
+
+    glBindBuffer(GL_PARAMETER_BUFFER, 0);
+
+    state.unbindImplementation(*this);
+}
+#endif
+#endif
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 Mesh& Mesh::draw(AbstractShaderProgram& shader) {
     shader.draw(*this);
@@ -1079,7 +1199,10 @@ void Mesh::bindVAOImplementationVAO(const GLuint id) {
 }
 
 void Mesh::bindVAO() {
-    if(Context::current().state().mesh.currentVAO != _id) {
+    Implementation::State& state = Context::current().state();
+    if(state.mesh.currentVAO != _id) {
+        ++state.context.statistics.bindCount;
+
         /* Binding the VAO finally creates it */
         _flags |= ObjectFlag::Created;
         bindVAOImplementationVAO(_id);
@@ -1091,8 +1214,8 @@ void Mesh::bindVAO() {
            particular, the setIndexBuffer() buffers call this function *and
            then* sets the _indexBuffer, which means at this point the ID will
            be still 0. */
-        Context::current().state().buffer.bindings[Implementation::BufferState::indexForTarget(Buffer::TargetHint::ElementArray)] = _indexBuffer.id();
-    }
+        state.buffer.bindings[Implementation::BufferState::indexForTarget(Buffer::TargetHint::ElementArray)] = _indexBuffer.id();
+    } else ++state.context.statistics.bindSkippedCount;
 }
 
 void Mesh::createImplementationDefault(Mesh& self) {
@@ -1133,6 +1256,17 @@ void Mesh::attributePointerInternal(const Buffer& buffer, const GLuint location,
 void Mesh::attributePointerInternal(AttributeLayout&& attribute) {
     CORRADE_ASSERT(attribute.buffer.id(),
         "GL::Mesh::addVertexBuffer(): empty or moved-out Buffer instance was passed", );
+
+    /* With a shared vertex format, the attributes are just recorded and the
+       matching VAO gets looked up again on next draw */
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_vertexFormatShared) {
+        _id = 0;
+        arrayAppend(_attributes, Utility::move(attribute));
+        return;
+    }
+    #endif
+
     Context::current().state().mesh.attributePointerImplementation(*this, Utility::move(attribute));
 }
 
@@ -1264,6 +1398,13 @@ void Mesh::vertexAttribDivisorImplementationNV(Mesh&, const GLuint index, const
 #endif
 
 void Mesh::acquireVertexBuffer(Buffer&& buffer) {
+    /* Attributes of shared vertex formats are recorded the same way as when
+       VAOs aren't available */
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_vertexFormatShared)
+        return acquireVertexBufferImplementationDefault(*this, Utility::move(buffer));
+    #endif
+
     Context::current().state().mesh.acquireVertexBufferImplementation(*this, Utility::move(buffer));
 }
 
@@ -1310,9 +1451,90 @@ void Mesh::bindImplementationDefault(Mesh& self) {
 }
 
 void Mesh::bindImplementationVAO(Mesh& self) {
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(self._vertexFormatShared)
+        return self.bindSharedVertexFormat();
+    #endif
+
     self.bindVAO();
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+GLuint Mesh::sharedVertexFormat(const Containers::ArrayView<const AttributeLayout> attributes) {
+    Implementation::MeshState& state = Context::current().state().mesh;
+
+    /* Linear search is fine here, as it's done only on the first draw after
+       the attributes change and there's usually just a handful of distinct
+       vertex formats */
+    for(const Implementation::MeshState::VertexFormat& format: state.vertexFormats) {
+        if(format.attributes.size() != attributes.size()) continue;
+
+        bool matches = true;
+        for(std::size_t i = 0; i != attributes.size(); ++i) {
+            const Implementation::MeshState::VertexFormatAttribute& a = format.attributes[i];
+            const AttributeLayout& b = attributes[i];
+            if(a.location != b.location || a.kindSize != b.kindSize || a.type != b.type || a.divisor != b.divisor) {
+                matches = false;
+                break;
+            }
+        }
+
+        if(matches) return format.id;
+    }
+
+    /* Not found, create a new VAO and specify the format. The buffer
+       bindings are the same as attribute locations, same as in
+       attributePointerImplementationVAODSA(). */
+    Implementation::MeshState::VertexFormat& format = arrayAppend(state.vertexFormats, InPlaceInit);
+    glGenVertexArrays(1, &format.id);
+    bindVAOImplementationVAO(format.id);
+    format.attributes = Containers::Array<Implementation::MeshState::VertexFormatAttribute>{NoInit, attributes.size()};
+    for(std::size_t i = 0; i != attributes.size(); ++i) {
+        const AttributeLayout& attribute = attributes[i];
+        format.attributes[i] = {attribute.location, attribute.kindSize, attribute.type, attribute.divisor};
+
+        glEnableVertexAttribArray(attribute.location);
+
+        const DynamicAttribute::Kind attributeKind = attribute.kind();
+        if(attributeKind == DynamicAttribute::Kind::Integral)
+            glVertexAttribIFormat(attribute.location, attribute.size(), attribute.type, 0);
+        #ifndef MAGNUM_TARGET_GLES
+        else if(attributeKind == DynamicAttribute::Kind::Long)
+            glVertexAttribLFormat(attribute.location, attribute.size(), attribute.type, 0);
+        #endif
+        else glVertexAttribFormat(attribute.location, attribute.size(), attribute.type, attributeKind == DynamicAttribute::Kind::GenericNormalized, 0);
+
+        glVertexAttribBinding(attribute.location, attribute.location);
+        if(attribute.divisor)
+            glVertexBindingDivisor(attribute.location, attribute.divisor);
+    }
+
+    return format.id;
+}
+
+void Mesh::bindSharedVertexFormat() {
+    /* Look up the shared VAO if not done yet or if the attributes changed
+       since */
+    if(!_id) _id = sharedVertexFormat(_attributes);
+    bindVAO();
+
+    /* Buffer bindings are VAO state, and as the VAO is shared with other
+       meshes, they have to be specified on every draw */
+    for(const AttributeLayout& attribute: _attributes) {
+        CORRADE_INTERNAL_ASSERT(attribute.stride() != 0);
+        glBindVertexBuffer(attribute.location, attribute.buffer.id(), attribute.offset(), attribute.stride());
+    }
+
+    /* The bindVAO() above reset the element buffer state tracker to this
+       mesh's index buffer only if a different VAO was bound before, and even
+       then the shared VAO may have an index buffer of another mesh bound.
+       Bind it unconditionally and update the state tracker. */
+    const GLuint indexBuffer = _indexBuffer.id();
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    Context::current().state().buffer.bindings[Implementation::BufferState::indexForTarget(Buffer::TargetHint::ElementArray)] = indexBuffer;
+}
+#endif
+
 void Mesh::unbindImplementationDefault(Mesh& self) {
     for(const AttributeLayout& attribute: self._attributes) {
         glDisableVertexAttribArray(attribute.location);
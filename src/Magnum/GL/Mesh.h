@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::GL::Mesh, enum @ref Magnum::GL::MeshPrimitive, @ref Magnum::GL::MeshIndexType, function @ref Magnum::GL::meshPrimitive(), @ref Magnum::GL::meshIndexType(), @ref Magnum::GL::meshIndexTypeSize()
+ * @brief Class @ref Magnum::GL::Mesh, enum @ref Magnum::GL::MeshPrimitive, @ref Magnum::GL::MeshIndexType, struct @ref Magnum::GL::DrawArraysIndirectCommand, @ref Magnum::GL::DrawElementsIndirectCommand, function @ref Magnum::GL::meshPrimitive(), @ref Magnum::GL::meshIndexType(), @ref Magnum::GL::meshIndexTypeSize()
  */
 
 #include <Corrade/Containers/Array.h>
@@ -433,6 +433,14 @@ available, DSA functions are used for specifying attribute locations to avoid
 unnecessary calls to @fn_gl{BindBuffer} and @fn_gl{BindVertexArray}. See
 documentation of @ref addVertexBuffer() for more information.
 
+If @gl_extension{ARB,vertex_attrib_binding} (part of OpenGL 4.3) or OpenGL ES
+3.1 is available, meshes can opt into sharing a VAO with all other meshes of
+the same vertex format using @ref shareVertexFormat(). Drawing such meshes then
+only rebinds the vertex and index buffers instead of switching whole VAOs,
+which is considerably cheaper on many drivers:
+
+@snippet GL.cpp Mesh-shareVertexFormat
+
 If index range is specified in @ref setIndexBuffer(), range-based version of
 drawing commands are used on desktop OpenGL and OpenGL ES 3.0. See also
 @ref AbstractShaderProgram::draw() for more information.
@@ -648,6 +656,45 @@ class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
         Mesh& setLabel(Containers::StringView label);
         #endif
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Whether the mesh shares its vertex format with other meshes
+         * @m_since_latest
+         *
+         * @see @ref shareVertexFormat()
+         * @requires_gles30 Not available in OpenGL ES 2.0.
+         * @requires_gles Not available in WebGL.
+         */
+        bool isVertexFormatShared() const { return _vertexFormatShared; }
+
+        /**
+         * @brief Share a vertex array object with meshes of the same vertex format
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that no vertex buffers were added yet. Deletes the VAO
+         * owned by this mesh and instead, on first draw, uses a VAO shared
+         * by all meshes that have the same attribute locations, types,
+         * component counts and divisors, added in the same order. Such VAOs
+         * are owned by the @ref Context. On every draw, only the vertex
+         * buffers and the index buffer are rebound via
+         * @fn_gl_keyword{BindVertexBuffer} and @fn_gl{BindBuffer}, so drawing
+         * many meshes of the same vertex format doesn't need to switch VAOs.
+         *
+         * The @ref id() then returns the shared VAO or @cpp 0 @ce if the mesh
+         * wasn't drawn yet, and the mesh doesn't delete it on destruction.
+         * If neither @gl_extension{ARB,vertex_attrib_binding} (part of
+         * OpenGL 4.3) nor OpenGL ES 3.1 is available, or VAOs aren't
+         * available, this function does nothing.
+         * @see @ref isVertexFormatShared(), @fn_gl_keyword{VertexAttribFormat},
+         *      @fn_gl_keyword{VertexAttribBinding},
+         *      @fn_gl_keyword{VertexBindingDivisor}
+         * @requires_gles30 Not available in OpenGL ES 2.0.
+         * @requires_gles Not available in WebGL.
+         */
+        Mesh& shareVertexFormat();
+        #endif
+
         /**
          * @brief Whether the mesh is indexed
          *
@@ -1270,6 +1317,13 @@ class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
 
         void MAGNUM_GL_LOCAL bindVAO();
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /* Looks up or creates a VAO with a vertex format matching given
+           attributes in the per-context cache */
+        static GLuint MAGNUM_GL_LOCAL sharedVertexFormat(Containers::ArrayView<const AttributeLayout> attributes);
+        void MAGNUM_GL_LOCAL bindSharedVertexFormat();
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES2
         MAGNUM_GL_LOCAL void drawInternal(Int count, Int baseVertex, Int instanceCount, UnsignedInt baseInstance, GLintptr indexOffset, Int indexStart, Int indexEnd);
         #else
@@ -1318,6 +1372,13 @@ class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
         MAGNUM_GL_LOCAL void drawInternal(TransformFeedback& xfb, UnsignedInt stream, Int instanceCount);
         #endif
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        MAGNUM_GL_LOCAL void drawIndirectInternal(Buffer& buffer, GLintptr offset, UnsignedInt drawCount, UnsignedInt stride);
+        #ifndef MAGNUM_TARGET_GLES
+        MAGNUM_GL_LOCAL void drawIndirectInternal(Buffer& buffer, GLintptr offset, Buffer& drawCountBuffer, GLintptr drawCountOffset, UnsignedInt maxDrawCount, UnsignedInt stride);
+        #endif
+        #endif
+
         static void MAGNUM_GL_LOCAL createImplementationDefault(Mesh& self);
         static void MAGNUM_GL_LOCAL createImplementationVAO(Mesh& self);
         #ifndef MAGNUM_TARGET_GLES
@@ -1418,7 +1479,9 @@ class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
         /* using a separate bool for _count instead of Optional to make use of
            the 3-byte gap after _flags */
         bool _countSet{};
-        /* 1 byte free */
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        bool _vertexFormatShared{};
+        #endif
         #ifdef MAGNUM_TARGET_GLES
         /* See the "angle-instanced-attributes-always-draw-instanced" workaround */
         bool _instanced{};
@@ -1433,11 +1496,75 @@ class MAGNUM_GL_EXPORT Mesh: public AbstractObject {
         GLintptr _indexBufferOffset{}, _indexOffset{};
         Buffer _indexBuffer{NoCreate};
 
-        /* Stores attribute layouts in case VAOs are not supported or disabled,
-           abused for capturing buffer ownership if VAOs are supported. */
+        /* Stores attribute layouts in case VAOs are not supported or disabled
+           or the vertex format is shared, abused for capturing buffer
+           ownership if VAOs are supported. */
         Containers::Array<AttributeLayout> _attributes;
 };
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/**
+@brief Non-indexed indirect draw command
+@m_since_latest
+
+Layout of a single command in a buffer passed to
+@ref AbstractShaderProgram::draw(Mesh&, Buffer&, GLintptr, UnsignedInt, UnsignedInt)
+for non-indexed meshes. Matches the layout expected by
+@fn_gl_keyword{DrawArraysIndirect} and @fn_gl_keyword{MultiDrawArraysIndirect}.
+@see @ref DrawElementsIndirectCommand
+@requires_gl40 Extension @gl_extension{ARB,draw_indirect}
+@requires_gles31 Indirect draws are not available in OpenGL ES 3.0 and older.
+@requires_gles Indirect draws are not available in WebGL.
+*/
+struct DrawArraysIndirectCommand {
+    UnsignedInt count;          /**< Vertex count */
+    UnsignedInt instanceCount;  /**< Instance count */
+    UnsignedInt first;          /**< Offset of the first vertex */
+
+    /**
+     * @brief Base instance
+     *
+     * Has to be @cpp 0 @ce on OpenGL ES.
+     */
+    UnsignedInt baseInstance;
+};
+
+/**
+@brief Indexed indirect draw command
+@m_since_latest
+
+Layout of a single command in a buffer passed to
+@ref AbstractShaderProgram::draw(Mesh&, Buffer&, GLintptr, UnsignedInt, UnsignedInt)
+for indexed meshes. Matches the layout expected by
+@fn_gl_keyword{DrawElementsIndirect} and
+@fn_gl_keyword{MultiDrawElementsIndirect}.
+@see @ref DrawArraysIndirectCommand
+@requires_gl40 Extension @gl_extension{ARB,draw_indirect}
+@requires_gles31 Indirect draws are not available in OpenGL ES 3.0 and older.
+@requires_gles Indirect draws are not available in WebGL.
+*/
+struct DrawElementsIndirectCommand {
+    UnsignedInt count;          /**< Index count */
+    UnsignedInt instanceCount;  /**< Instance count */
+
+    /**
+     * @brief Offset of the first index
+     *
+     * In indices, not bytes.
+     */
+    UnsignedInt firstIndex;
+
+    Int baseVertex;             /**< Base vertex */
+
+    /**
+     * @brief Base instance
+     *
+     * Has to be @cpp 0 @ce on OpenGL ES.
+     */
+    UnsignedInt baseInstance;
+};
+#endif
+
 /** @debugoperatorenum{MeshPrimitive} */
 MAGNUM_GL_EXPORT Debug& operator<<(Debug& debug, MeshPrimitive value);
 
@@ -0,0 +1,149 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RenderPass.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/GL/Framebuffer.h"
+
+namespace Magnum { namespace GL {
+
+RenderPass::RenderPass(Framebuffer& framebuffer) noexcept: _framebuffer{&framebuffer}, _clearColors{}, _colorLoad{}, _colorStore{}, _clearDepth{1.0f}, _clearStencil{}, _depthLoad{LoadAction::Load}, _stencilLoad{LoadAction::Load}, _depthStore{StoreAction::Store}, _stencilStore{StoreAction::Store} {}
+
+RenderPass& RenderPass::setColorAttachment(const UnsignedInt attachment, const LoadAction load, const StoreAction store, const Color4& clearColor) {
+    CORRADE_ASSERT(attachment < MaxColorAttachments,
+        "GL::RenderPass::setColorAttachment(): index" << attachment << "out of range for" << MaxColorAttachments << "color attachments", *this);
+    _colorLoad[attachment] = load;
+    _colorStore[attachment] = store;
+    _clearColors[attachment] = clearColor;
+    return *this;
+}
+
+RenderPass& RenderPass::setDepthAttachment(const LoadAction load, const StoreAction store, const Float clearDepth) {
+    _depthLoad = load;
+    _depthStore = store;
+    _clearDepth = clearDepth;
+    return *this;
+}
+
+RenderPass& RenderPass::setStencilAttachment(const LoadAction load, const StoreAction store, const Int clearStencil) {
+    _stencilLoad = load;
+    _stencilStore = store;
+    _clearStencil = clearStencil;
+    return *this;
+}
+
+RenderPass::LoadAction RenderPass::colorLoadAction(const UnsignedInt attachment) const {
+    CORRADE_ASSERT(attachment < MaxColorAttachments,
+        "GL::RenderPass::colorLoadAction(): index" << attachment << "out of range for" << MaxColorAttachments << "color attachments", {});
+    return _colorLoad[attachment];
+}
+
+RenderPass::StoreAction RenderPass::colorStoreAction(const UnsignedInt attachment) const {
+    CORRADE_ASSERT(attachment < MaxColorAttachments,
+        "GL::RenderPass::colorStoreAction(): index" << attachment << "out of range for" << MaxColorAttachments << "color attachments", {});
+    return _colorStore[attachment];
+}
+
+RenderPass& RenderPass::begin() {
+    _framebuffer->bind();
+
+    /* Invalidate first, so the driver knows it doesn't need to load anything
+       before the clears or draws happen */
+    Containers::Array<Framebuffer::InvalidationAttachment> invalidate;
+    for(UnsignedInt i = 0; i != MaxColorAttachments; ++i)
+        if(_colorLoad[i] == LoadAction::DontCare)
+            arrayAppend(invalidate, Framebuffer::InvalidationAttachment{Framebuffer::ColorAttachment{i}});
+    if(_depthLoad == LoadAction::DontCare)
+        arrayAppend(invalidate, Framebuffer::InvalidationAttachment::Depth);
+    if(_stencilLoad == LoadAction::DontCare)
+        arrayAppend(invalidate, Framebuffer::InvalidationAttachment::Stencil);
+    if(!invalidate.isEmpty())
+        _framebuffer->invalidate(invalidate);
+
+    for(UnsignedInt i = 0; i != MaxColorAttachments; ++i)
+        if(_colorLoad[i] == LoadAction::Clear)
+            _framebuffer->clearColor(i, _clearColors[i]);
+    if(_depthLoad == LoadAction::Clear && _stencilLoad == LoadAction::Clear)
+        _framebuffer->clearDepthStencil(_clearDepth, _clearStencil);
+    else if(_depthLoad == LoadAction::Clear)
+        _framebuffer->clearDepth(_clearDepth);
+    else if(_stencilLoad == LoadAction::Clear)
+        _framebuffer->clearStencil(_clearStencil);
+
+    return *this;
+}
+
+RenderPass& RenderPass::end() {
+    Containers::Array<Framebuffer::InvalidationAttachment> invalidate;
+    for(UnsignedInt i = 0; i != MaxColorAttachments; ++i)
+        if(_colorStore[i] == StoreAction::DontCare)
+            arrayAppend(invalidate, Framebuffer::InvalidationAttachment{Framebuffer::ColorAttachment{i}});
+    if(_depthStore == StoreAction::DontCare)
+        arrayAppend(invalidate, Framebuffer::InvalidationAttachment::Depth);
+    if(_stencilStore == StoreAction::DontCare)
+        arrayAppend(invalidate, Framebuffer::InvalidationAttachment::Stencil);
+    if(!invalidate.isEmpty())
+        _framebuffer->invalidate(invalidate);
+
+    return *this;
+}
+
+Debug& operator<<(Debug& debug, const RenderPass::LoadAction value) {
+    debug << "GL::RenderPass::LoadAction" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case RenderPass::LoadAction::value: return debug << "::" #value;
+        _c(Load)
+        _c(Clear)
+        _c(DontCare)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const RenderPass::StoreAction value) {
+    debug << "GL::RenderPass::StoreAction" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case RenderPass::StoreAction::value: return debug << "::" #value;
+        _c(Store)
+        _c(DontCare)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << ")";
+}
+
+}}
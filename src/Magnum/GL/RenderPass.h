@@ -0,0 +1,259 @@
+#ifndef Magnum_GL_RenderPass_h
+#define Magnum_GL_RenderPass_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::GL::RenderPass
+ * @m_since_latest
+ */
+
+#include "Magnum/configure.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/GL/GL.h"
+#include "Magnum/GL/visibility.h"
+#include "Magnum/Math/Color.h"
+
+namespace Magnum { namespace GL {
+
+/**
+@brief Render pass
+@m_since_latest
+
+Describes what happens with contents of @ref Framebuffer attachments at the
+beginning and at the end of rendering to it. On tiled GPUs, which are common
+on mobile and embedded platforms, rendering happens in on-chip tile memory
+and the attachments have to be loaded into it from main memory at the start
+and stored back at the end. Declaring that the previous contents aren't needed
+or that the results get discarded afterwards saves that memory bandwidth,
+which is often the largest cost for such GPUs. Depth and stencil buffers are
+common candidates, as they're rarely needed after the frame is rendered.
+
+@snippet GL.cpp RenderPass-usage
+
+Each attachment has a @ref LoadAction and a @ref StoreAction, by default
+@ref LoadAction::Load and @ref StoreAction::Store, which is equivalent to not
+using a render pass at all. The @ref begin() function binds the framebuffer for
+drawing, invalidates attachments with @ref LoadAction::DontCare using
+@ref Framebuffer::invalidate() and clears attachments with
+@ref LoadAction::Clear. The @ref end() function then invalidates attachments
+with @ref StoreAction::DontCare.
+
+Amount of invalidated attachments is tracked in
+@ref Context::Statistics::invalidatedAttachmentCount and
+@relativeref{Context::Statistics,invalidatedPixelCount} and can be
+visualized with @ref DebugTools::FrameProfilerGL::Value::InvalidatedAttachmentCount
+and @relativeref{DebugTools::FrameProfilerGL::Value,InvalidatedPixelCount}.
+
+@section GL-RenderPass-color-attachments Color attachment indices
+
+Color attachment index @p i passed to @ref setColorAttachment() is used both
+for @ref Framebuffer::ColorAttachment when invalidating and for the draw
+buffer index when clearing with @ref Framebuffer::clearColor(). Those match
+only if the framebuffer has the draw buffers mapped to color attachments of
+the same index using @ref Framebuffer::mapForDraw(), which is the case for
+the default mapping of a single color attachment @cpp 0 @ce.
+
+Clearing is affected by @ref Renderer::Feature::ScissorTest and by color,
+depth and stencil write masks same as any other framebuffer clear.
+Invalidation does nothing if neither @gl_extension{ARB,invalidate_subdata}
+(part of OpenGL 4.3) nor OpenGL ES 3.0 is available.
+@requires_gl30 Direct framebuffer clearing is not available in OpenGL 2.1.
+@requires_gles30 Direct framebuffer clearing is not available in OpenGL ES
+    2.0.
+@requires_webgl20 Direct framebuffer clearing is not available in WebGL 1.0.
+*/
+class MAGNUM_GL_EXPORT RenderPass {
+    public:
+        /**
+         * @brief Max color attachment count
+         *
+         * Matches the minimal value of
+         * @ref Framebuffer::maxColorAttachments() on desktop GL.
+         */
+        enum: UnsignedInt { MaxColorAttachments = 8 };
+
+        /**
+         * @brief Load action
+         *
+         * @see @ref setColorAttachment(), @ref setDepthAttachment(),
+         *      @ref setStencilAttachment()
+         */
+        enum class LoadAction: UnsignedByte {
+            /** Preserve previous contents of the attachment */
+            Load,
+
+            /** Clear the attachment with given value */
+            Clear,
+
+            /**
+             * Previous contents of the attachment are not needed, invalidate
+             * them
+             */
+            DontCare
+        };
+
+        /**
+         * @brief Store action
+         *
+         * @see @ref setColorAttachment(), @ref setDepthAttachment(),
+         *      @ref setStencilAttachment()
+         */
+        enum class StoreAction: UnsignedByte {
+            /** Preserve the rendered contents of the attachment */
+            Store,
+
+            /**
+             * Rendered contents of the attachment are not needed, invalidate
+             * them
+             */
+            DontCare
+        };
+
+        /**
+         * @brief Constructor
+         *
+         * All attachments are set to @ref LoadAction::Load and
+         * @ref StoreAction::Store. The @p framebuffer is expected to stay in
+         * scope for the whole lifetime of the render pass.
+         */
+        explicit RenderPass(Framebuffer& framebuffer) noexcept;
+
+        /** @brief Framebuffer */
+        Framebuffer& framebuffer() { return *_framebuffer; }
+
+        /**
+         * @brief Set color attachment actions
+         * @param attachment    Color attachment index
+         * @param load          Load action
+         * @param store         Store action
+         * @param clearColor    Color to clear with if @p load is
+         *      @ref LoadAction::Clear
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p attachment is less than @ref MaxColorAttachments.
+         * See @ref GL-RenderPass-color-attachments for details about how the
+         * index is used.
+         */
+        RenderPass& setColorAttachment(UnsignedInt attachment, LoadAction load, StoreAction store, const Color4& clearColor = {});
+
+        /**
+         * @brief Set depth attachment actions
+         * @param load          Load action
+         * @param store         Store action
+         * @param clearDepth    Depth to clear with if @p load is
+         *      @ref LoadAction::Clear
+         * @return Reference to self (for method chaining)
+         *
+         * For a combined depth/stencil attachment call also
+         * @ref setStencilAttachment(). If both have @ref LoadAction::Clear,
+         * they're cleared together with @ref Framebuffer::clearDepthStencil().
+         */
+        RenderPass& setDepthAttachment(LoadAction load, StoreAction store, Float clearDepth = 1.0f);
+
+        /**
+         * @brief Set stencil attachment actions
+         * @param load          Load action
+         * @param store         Store action
+         * @param clearStencil  Stencil value to clear with if @p load is
+         *      @ref LoadAction::Clear
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref setDepthAttachment()
+         */
+        RenderPass& setStencilAttachment(LoadAction load, StoreAction store, Int clearStencil = 0);
+
+        /**
+         * @brief Color attachment load action
+         *
+         * Expects that @p attachment is less than @ref MaxColorAttachments.
+         */
+        LoadAction colorLoadAction(UnsignedInt attachment) const;
+
+        /**
+         * @brief Color attachment store action
+         *
+         * Expects that @p attachment is less than @ref MaxColorAttachments.
+         */
+        StoreAction colorStoreAction(UnsignedInt attachment) const;
+
+        /** @brief Depth attachment load action */
+        LoadAction depthLoadAction() const { return _depthLoad; }
+
+        /** @brief Depth attachment store action */
+        StoreAction depthStoreAction() const { return _depthStore; }
+
+        /** @brief Stencil attachment load action */
+        LoadAction stencilLoadAction() const { return _stencilLoad; }
+
+        /** @brief Stencil attachment store action */
+        StoreAction stencilStoreAction() const { return _stencilStore; }
+
+        /**
+         * @brief Begin the render pass
+         * @return Reference to self (for method chaining)
+         *
+         * Binds the framebuffer for drawing using @ref Framebuffer::bind(),
+         * invalidates all attachments with @ref LoadAction::DontCare and
+         * clears all attachments with @ref LoadAction::Clear.
+         */
+        RenderPass& begin();
+
+        /**
+         * @brief End the render pass
+         * @return Reference to self (for method chaining)
+         *
+         * Invalidates all attachments with @ref StoreAction::DontCare. Call
+         * after all rendering to the framebuffer, including resolving
+         * multisampled attachments with @ref AbstractFramebuffer::blit(), is
+         * done.
+         */
+        RenderPass& end();
+
+    private:
+        Framebuffer* _framebuffer;
+        Color4 _clearColors[MaxColorAttachments];
+        LoadAction _colorLoad[MaxColorAttachments];
+        StoreAction _colorStore[MaxColorAttachments];
+        Float _clearDepth;
+        Int _clearStencil;
+        LoadAction _depthLoad, _stencilLoad;
+        StoreAction _depthStore, _stencilStore;
+};
+
+/** @debugoperatorclassenum{RenderPass,RenderPass::LoadAction} */
+MAGNUM_GL_EXPORT Debug& operator<<(Debug& debug, RenderPass::LoadAction value);
+
+/** @debugoperatorclassenum{RenderPass,RenderPass::StoreAction} */
+MAGNUM_GL_EXPORT Debug& operator<<(Debug& debug, RenderPass::StoreAction value);
+
+}}
+#else
+#error this header is not available in the OpenGL ES 2.0 / WebGL 1.0 build
+#endif
+
+#endif
@@ -33,6 +33,7 @@
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 
+#include "Magnum/GL/Implementation/ContextState.h"
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Magnum/GL/Implementation/DebugState.h"
 #endif
@@ -134,9 +135,15 @@ void Renderbuffer::setStorageMultisample(const Int samples, const RenderbufferFo
 #endif
 
 void Renderbuffer::bind() {
-    GLuint& binding = Context::current().state().framebuffer.renderbufferBinding;
+    Implementation::State& state = Context::current().state();
+    GLuint& binding = state.framebuffer.renderbufferBinding;
+
+    if(binding == _id) {
+        ++state.context.statistics.bindSkippedCount;
+        return;
+    }
 
-    if(binding == _id) return;
+    ++state.context.statistics.bindCount;
 
     /* Binding the renderbuffer finally creates it */
     binding = _id;
@@ -0,0 +1,268 @@
+#ifndef Magnum_GL_ShaderCompileQueue_h
+#define Magnum_GL_ShaderCompileQueue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::GL::ShaderCompileQueue
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Tags.h"
+#include "Magnum/GL/GL.h"
+
+namespace Magnum { namespace GL {
+
+/**
+@brief Shader compile queue
+@tparam T   Shader type
+@m_since_latest
+
+Schedules asynchronous compilation and linking of many shader instances of the
+same type and hands them back once they're ready, without ever blocking on
+the driver. Meant to be used for example on loading screens, which need to
+compile a large amount of shader variants while still rendering at an
+interactive frame rate. See @ref GL-AbstractShaderProgram-async for
+background on how the asynchronous compilation works.
+
+The @p T type is expected to follow the convention described in
+@ref GL-AbstractShaderProgram-async, i.e. have a @cpp T::CompileState @ce
+type with a @ref AbstractShaderProgram::isLinkFinished() function, a
+@cpp T::compile() @ce function returning it and a @cpp T(T::CompileState&&) @ce
+constructor, and additionally be constructible with @ref NoCreate. All builtin
+shaders in the @ref Shaders namespace satisfy this.
+
+@section GL-ShaderCompileQueue-usage Usage
+
+Shaders are added either through @ref compile(), which forwards its arguments
+to @cpp T::compile() @ce, or with @ref add() taking an existing
+@cpp T::CompileState @ce. In both cases the compilation and linking is
+submitted to the driver immediately and an ID is returned. Then, each frame,
+@ref update() polls all pending shaders for completion and finalizes those
+that are done. Finished shaders can be accessed with @ref operator[]() or
+moved out with @ref release():
+
+@snippet GL.cpp ShaderCompileQueue-usage
+
+If @gl_extension{KHR,parallel_shader_compile} isn't available, the driver
+reports every shader as finished right away and @ref update() then waits for
+each compilation and linking to finish. Use the @p maxCount argument to
+spread the work over several frames in that case. The @ref finish() function
+finalizes all pending shaders at once, regardless of whether they're reported
+as finished.
+*/
+template<class T> class ShaderCompileQueue {
+    public:
+        /** @brief Shader compile state type */
+        typedef typename T::CompileState CompileState;
+
+        /** @brief Constructor */
+        explicit ShaderCompileQueue() = default;
+
+        /** @brief Copying is not allowed */
+        ShaderCompileQueue(const ShaderCompileQueue<T>&) = delete;
+
+        /** @brief Move constructor */
+        ShaderCompileQueue(ShaderCompileQueue<T>&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        ShaderCompileQueue<T>& operator=(const ShaderCompileQueue<T>&) = delete;
+
+        /** @brief Move assignment */
+        ShaderCompileQueue<T>& operator=(ShaderCompileQueue<T>&&) noexcept = default;
+
+        /**
+         * @brief Count of all shaders added to the queue
+         *
+         * Includes pending, finished and released shaders. Shader IDs are
+         * always less than this value.
+         */
+        std::size_t size() const { return _entries.size(); }
+
+        /**
+         * @brief Count of shaders that are not finished yet
+         *
+         * @see @ref isFinished()
+         */
+        std::size_t pendingCount() const { return _pendingCount; }
+
+        /**
+         * @brief Whether all shaders in the queue are finished
+         *
+         * Equivalent to @ref pendingCount() being @cpp 0 @ce.
+         */
+        bool isFinished() const { return !_pendingCount; }
+
+        /**
+         * @brief Whether given shader is finished
+         *
+         * Expects that @p id is less than @ref size(). Returns
+         * @cpp true @ce also if the shader was already released.
+         */
+        bool isFinished(std::size_t id) const;
+
+        /**
+         * @brief Add a compile state
+         * @return ID of the shader
+         *
+         * Assumes compilation and linking of @p state was already submitted,
+         * which is what @cpp T::compile() @ce does.
+         * @see @ref compile()
+         */
+        std::size_t add(CompileState&& state);
+
+        /**
+         * @brief Submit a shader for compilation
+         * @return ID of the shader
+         *
+         * Calls @cpp T::compile() @ce with @p args and passes the result to
+         * @ref add().
+         */
+        template<class ...Args> std::size_t compile(Args&&... args) {
+            return add(T::compile(Utility::forward<Args>(args)...));
+        }
+
+        /**
+         * @brief Finalize shaders that finished compiling and linking
+         * @param maxCount  Max count of shaders to finalize in this call
+         * @return Count of shaders finalized in this call
+         *
+         * Goes through all pending shaders in the order they were added and
+         * for each for which @ref AbstractShaderProgram::isLinkFinished()
+         * returns @cpp true @ce constructs @p T out of its compile state,
+         * until @p maxCount shaders are finalized.
+         * @see @ref finish()
+         */
+        std::size_t update(std::size_t maxCount = ~std::size_t{});
+
+        /**
+         * @brief Finalize all pending shaders
+         *
+         * Unlike @ref update(), waits for all pending compilation and linking
+         * operations to finish. After calling this function,
+         * @ref isFinished() returns @cpp true @ce.
+         */
+        void finish();
+
+        /**
+         * @brief Finished shader
+         *
+         * Expects that @p id is less than @ref size() and that the shader is
+         * finished and not yet released.
+         * @see @ref isFinished(std::size_t) const, @ref release()
+         */
+        T& operator[](std::size_t id);
+
+        /**
+         * @brief Release a finished shader
+         *
+         * Moves the shader out of the queue. Expects that @p id is less than
+         * @ref size() and that the shader is finished and not yet released.
+         * @see @ref isFinished(std::size_t) const, @ref operator[]()
+         */
+        T release(std::size_t id);
+
+    private:
+        struct Entry {
+            Containers::Optional<CompileState> state;
+            Containers::Optional<T> shader;
+        };
+
+        Containers::Array<Entry> _entries;
+        std::size_t _pendingCount{}, _firstPending{};
+};
+
+template<class T> bool ShaderCompileQueue<T>::isFinished(const std::size_t id) const {
+    CORRADE_ASSERT(id < _entries.size(),
+        "GL::ShaderCompileQueue::isFinished(): index" << id << "out of range for" << _entries.size() << "shaders", {});
+    return !_entries[id].state;
+}
+
+template<class T> std::size_t ShaderCompileQueue<T>::add(CompileState&& state) {
+    Entry& entry = arrayAppend(_entries, InPlaceInit);
+    entry.state.emplace(Utility::move(state));
+    ++_pendingCount;
+    return _entries.size() - 1;
+}
+
+template<class T> std::size_t ShaderCompileQueue<T>::update(const std::size_t maxCount) {
+    std::size_t count = 0;
+    for(std::size_t i = _firstPending; i != _entries.size() && count != maxCount; ++i) {
+        Entry& entry = _entries[i];
+        if(!entry.state || !entry.state->isLinkFinished()) continue;
+
+        entry.shader.emplace(Utility::move(*entry.state));
+        entry.state = Containers::NullOpt;
+        --_pendingCount;
+        ++count;
+    }
+
+    /* Skip the finished prefix next time */
+    while(_firstPending != _entries.size() && !_entries[_firstPending].state)
+        ++_firstPending;
+
+    return count;
+}
+
+template<class T> void ShaderCompileQueue<T>::finish() {
+    for(std::size_t i = _firstPending; i != _entries.size(); ++i) {
+        Entry& entry = _entries[i];
+        if(!entry.state) continue;
+
+        entry.shader.emplace(Utility::move(*entry.state));
+        entry.state = Containers::NullOpt;
+    }
+
+    _pendingCount = 0;
+    _firstPending = _entries.size();
+}
+
+template<class T> T& ShaderCompileQueue<T>::operator[](const std::size_t id) {
+    CORRADE_ASSERT(id < _entries.size(),
+        "GL::ShaderCompileQueue::operator[](): index" << id << "out of range for" << _entries.size() << "shaders", *_entries[0].shader);
+    CORRADE_ASSERT(_entries[id].shader,
+        "GL::ShaderCompileQueue::operator[](): shader" << id << (_entries[id].state ? "is not finished yet" : "was already released"), *_entries[0].shader);
+    return *_entries[id].shader;
+}
+
+template<class T> T ShaderCompileQueue<T>::release(const std::size_t id) {
+    CORRADE_ASSERT(id < _entries.size(),
+        "GL::ShaderCompileQueue::release(): index" << id << "out of range for" << _entries.size() << "shaders", T{NoCreate});
+    CORRADE_ASSERT(_entries[id].shader,
+        "GL::ShaderCompileQueue::release(): shader" << id << (_entries[id].state ? "is not finished yet" : "was already released"), T{NoCreate});
+    T out = Utility::move(*_entries[id].shader);
+    _entries[id].shader = Containers::NullOpt;
+    return out;
+}
+
+}}
+
+#endif
@@ -0,0 +1,141 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "StreamingBuffer.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include <cstring>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+
+namespace Magnum { namespace GL {
+
+StreamingBuffer::StreamingBuffer(const Buffer::TargetHint targetHint, const std::size_t regionSize, const UnsignedInt regionCount): _buffer{targetHint}, _regionSize{regionSize}, _regionCount{regionCount}, _currentRegion{}, _currentRegionUsedSize{}, _mapped{} {
+    CORRADE_ASSERT(regionSize && regionCount,
+        "GL::StreamingBuffer: expected non-zero region size and count but got" << regionSize << "and" << regionCount, );
+
+    const std::size_t size = regionSize*regionCount;
+    #ifndef MAGNUM_TARGET_GLES
+    if(Context::current().isExtensionSupported<Extensions::ARB::buffer_storage>())
+    #else
+    if(Context::current().isExtensionSupported<Extensions::EXT::buffer_storage>())
+    #endif
+    {
+        _buffer.setStorage(size, Buffer::StorageFlag::MapWrite|Buffer::StorageFlag::MapPersistent|Buffer::StorageFlag::MapCoherent);
+        _mapped = _buffer.map(0, size, Buffer::MapFlag::Write|Buffer::MapFlag::Persistent|Buffer::MapFlag::Coherent).data();
+        _fences = Containers::Array<Fence>{DirectInit, regionCount, NoCreate};
+    } else {
+        _buffer.setData({nullptr, size}, BufferUsage::StreamDraw);
+    }
+}
+
+StreamingBuffer::StreamingBuffer(NoCreateT) noexcept: _buffer{NoCreate}, _regionSize{}, _regionCount{}, _currentRegion{}, _currentRegionUsedSize{}, _mapped{} {}
+
+StreamingBuffer::StreamingBuffer(StreamingBuffer&& other) noexcept: _buffer{Utility::move(other._buffer)}, _regionSize{other._regionSize}, _regionCount{other._regionCount}, _currentRegion{other._currentRegion}, _currentRegionUsedSize{other._currentRegionUsedSize}, _mapped{other._mapped}, _fences{Utility::move(other._fences)} {
+    other._mapped = nullptr;
+}
+
+/* The buffer gets unmapped implicitly on deletion */
+StreamingBuffer::~StreamingBuffer() = default;
+
+StreamingBuffer& StreamingBuffer::operator=(StreamingBuffer&& other) noexcept {
+    using Utility::swap;
+    swap(_buffer, other._buffer);
+    swap(_regionSize, other._regionSize);
+    swap(_regionCount, other._regionCount);
+    swap(_currentRegion, other._currentRegion);
+    swap(_currentRegionUsedSize, other._currentRegionUsedSize);
+    swap(_mapped, other._mapped);
+    swap(_fences, other._fences);
+    return *this;
+}
+
+std::size_t StreamingBuffer::write(const Containers::ArrayView<const void> data, const std::size_t alignment) {
+    CORRADE_ASSERT(_regionCount,
+        "GL::StreamingBuffer::write(): the buffer is not created", {});
+    CORRADE_ASSERT(alignment && !(alignment & (alignment - 1)),
+        "GL::StreamingBuffer::write(): expected alignment to be a power of two, got" << alignment, {});
+
+    /* Align the absolute offset, the region size doesn't need to be a
+       multiple of the alignment */
+    const std::size_t regionOffset = _currentRegion*_regionSize;
+    const std::size_t offset = (regionOffset + _currentRegionUsedSize + alignment - 1) & ~(alignment - 1);
+    CORRADE_ASSERT(offset + data.size() <= regionOffset + _regionSize,
+        "GL::StreamingBuffer::write(): can't fit" << data.size() << "bytes aligned to" << alignment << "into a region of" << _regionSize << "bytes with" << _currentRegionUsedSize << "bytes already used", {});
+
+    if(!data.isEmpty()) {
+        if(_mapped)
+            std::memcpy(_mapped + offset, data.data(), data.size());
+
+        /* The range was never written to since the last orphaning, so no
+           need to synchronize */
+        else {
+            const Containers::ArrayView<char> mapped = _buffer.map(offset, data.size(), Buffer::MapFlag::Write|Buffer::MapFlag::InvalidateRange|Buffer::MapFlag::Unsynchronized);
+            CORRADE_INTERNAL_ASSERT(mapped.data());
+            std::memcpy(mapped.data(), data.data(), data.size());
+            _buffer.unmap();
+        }
+    }
+
+    _currentRegionUsedSize = offset + data.size() - regionOffset;
+    return offset;
+}
+
+StreamingBuffer& StreamingBuffer::nextFrame() {
+    CORRADE_ASSERT(_regionCount,
+        "GL::StreamingBuffer::nextFrame(): the buffer is not created", *this);
+
+    /* Guard the region that was just written to so it doesn't get
+       overwritten until the GPU is done with it */
+    if(_mapped) {
+        CORRADE_INTERNAL_ASSERT(!_fences[_currentRegion].id());
+        _fences[_currentRegion] = Fence{};
+    }
+
+    _currentRegion = (_currentRegion + 1) % _regionCount;
+    _currentRegionUsedSize = 0;
+
+    /* If the GPU is still using the next region, wait until it's done */
+    if(_mapped) {
+        Fence& fence = _fences[_currentRegion];
+        if(fence.id()) {
+            fence.clientWait();
+            fence = Fence{NoCreate};
+        }
+
+    /* Otherwise orphan the whole buffer on wraparound, the driver will
+       provide new memory while the GPU is still using the old one */
+    } else if(_currentRegion == 0) {
+        _buffer.setData({nullptr, _regionSize*_regionCount}, BufferUsage::StreamDraw);
+    }
+
+    return *this;
+}
+
+}}
+#endif
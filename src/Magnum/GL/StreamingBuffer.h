@@ -0,0 +1,196 @@
+#ifndef Magnum_GL_StreamingBuffer_h
+#define Magnum_GL_StreamingBuffer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::GL::StreamingBuffer
+ * @m_since_latest
+ */
+#endif
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/GL/Buffer.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/GL/Fence.h"
+
+namespace Magnum { namespace GL {
+
+/**
+@brief Ring buffer for streaming per-frame data
+@m_since_latest
+
+Meant for data that change every frame, such as uniforms, particles or text
+vertices, where repeated @ref Buffer::setData() or @ref Buffer::setSubData()
+calls would cause the driver to implicitly synchronize with the GPU. The
+buffer is split into @ref regionCount() regions of @ref regionSize() bytes,
+by default three for triple buffering. Data for the current frame are
+appended to the current region with @ref write(), which returns an offset
+that can be passed for example to
+@ref Buffer::bind(Target, UnsignedInt, GLintptr, GLsizeiptr) or used as a
+vertex buffer offset. At the end of a frame, @ref nextFrame() switches to the
+next region:
+
+@snippet GL.cpp StreamingBuffer-usage
+
+If @gl_extension{ARB,buffer_storage} (part of OpenGL 4.4) or
+@gl_extension{EXT,buffer_storage} on OpenGL ES is available, the buffer is
+allocated with @ref Buffer::setStorage() and mapped persistently and
+coherently for its whole lifetime, @ref write() then only copies the data to
+the mapped memory. Each region is guarded with a fence sync object placed in
+@ref nextFrame() and the CPU waits on it only if the GPU is still using the
+region when it's about to be reused, which happens only if the CPU is more
+than @ref regionCount() frames ahead.
+
+Otherwise the buffer is allocated with @ref Buffer::setData() and each
+@ref write() maps just the written range with
+@ref Buffer::MapFlag::InvalidateRange and
+@relativeref{Buffer::MapFlag,Unsynchronized}. Every time @ref nextFrame()
+wraps around to the first region, the whole buffer is orphaned by calling
+@ref Buffer::setData() with @cpp nullptr @ce data, letting the driver provide
+fresh memory while the GPU still uses the previous one. Use
+@ref isPersistentlyMapped() to check which of the two is used.
+@requires_gles30 Buffer mapping with @ref Buffer::map(GLintptr, GLsizeiptr, Buffer::MapFlags)
+    and fence sync objects are not available in OpenGL ES 2.0.
+@requires_gles Buffer mapping is not available in WebGL.
+*/
+class MAGNUM_GL_EXPORT StreamingBuffer {
+    public:
+        /**
+         * @brief Constructor
+         * @param targetHint    Target hint for the underlying buffer
+         * @param regionSize    Size of a single region in bytes
+         * @param regionCount   Region count
+         *
+         * Expects that both @p regionSize and @p regionCount are non-zero.
+         * The underlying buffer is @p regionSize*@p regionCount bytes large.
+         */
+        explicit StreamingBuffer(Buffer::TargetHint targetHint, std::size_t regionSize, UnsignedInt regionCount = 3);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         * However note that this is a low-level and a potentially dangerous
+         * API, see the documentation of @ref NoCreate for alternatives.
+         */
+        explicit StreamingBuffer(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        StreamingBuffer(const StreamingBuffer&) = delete;
+
+        /** @brief Move constructor */
+        StreamingBuffer(StreamingBuffer&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes all fence sync objects and the underlying buffer.
+         */
+        ~StreamingBuffer();
+
+        /** @brief Copying is not allowed */
+        StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+
+        /** @brief Move assignment */
+        StreamingBuffer& operator=(StreamingBuffer&&) noexcept;
+
+        /** @brief Underlying buffer */
+        Buffer& buffer() { return _buffer; }
+        const Buffer& buffer() const { return _buffer; } /**< @overload */
+
+        /** @brief Region size in bytes */
+        std::size_t regionSize() const { return _regionSize; }
+
+        /** @brief Region count */
+        UnsignedInt regionCount() const { return _regionCount; }
+
+        /** @brief Index of the region that's currently written to */
+        UnsignedInt currentRegion() const { return _currentRegion; }
+
+        /**
+         * @brief Bytes used in the current region
+         *
+         * Includes also padding added because of alignment in @ref write().
+         * Reset back to @cpp 0 @ce in @ref nextFrame().
+         */
+        std::size_t currentRegionUsedSize() const { return _currentRegionUsedSize; }
+
+        /**
+         * @brief Whether the buffer is persistently mapped
+         *
+         * See the @ref StreamingBuffer "class documentation" for more
+         * information.
+         */
+        bool isPersistentlyMapped() const { return _mapped; }
+
+        /**
+         * @brief Write data to the current region
+         * @param data          Data to write
+         * @param alignment     Alignment of the returned offset, has to be a
+         *      power of two
+         * @return Offset of the written data in @ref buffer()
+         *
+         * Expects that the data, together with padding needed to satisfy
+         * @p alignment, fit into the remaining space of the current region.
+         * When binding the data as a uniform buffer range, pass
+         * @ref Buffer::uniformOffsetAlignment() to @p alignment.
+         */
+        std::size_t write(Containers::ArrayView<const void> data, std::size_t alignment = 1);
+
+        /**
+         * @brief Switch to the next region
+         * @return Reference to self (for method chaining)
+         *
+         * Call after all draws using data from the current region are
+         * submitted. See the @ref StreamingBuffer "class documentation"
+         * for details about synchronization.
+         */
+        StreamingBuffer& nextFrame();
+
+    private:
+        Buffer _buffer;
+        std::size_t _regionSize;
+        UnsignedInt _regionCount, _currentRegion;
+        std::size_t _currentRegionUsedSize;
+        char* _mapped;
+        Containers::Array<Fence> _fences;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL build
+#endif
+
+#endif
@@ -27,13 +27,16 @@
 
 #include <sstream>
 #include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/Reference.h>
+#include <Corrade/Containers/ScopeGuard.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/StringStl.h> /* StringHasPrefix / StringHasSuffix */
 #include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/TestSuite/Compare/Numeric.h>
 #include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/DebugStl.h>
 #include <Corrade/Utility/Resource.h>
 #include <Corrade/Utility/System.h>
@@ -95,6 +98,9 @@ struct AbstractShaderProgramGLTest: OpenGLTester {
     void uniformVector();
     void uniformMatrix();
     void uniformArray();
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void binaryCache();
+    #endif
     #ifndef MAGNUM_TARGET_GLES
     void uniformDouble();
     void uniformDoubleVector();
@@ -197,6 +203,9 @@ AbstractShaderProgramGLTest::AbstractShaderProgramGLTest() {
               &AbstractShaderProgramGLTest::uniformVector,
               &AbstractShaderProgramGLTest::uniformMatrix,
               &AbstractShaderProgramGLTest::uniformArray,
+              #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+              &AbstractShaderProgramGLTest::binaryCache,
+              #endif
               #ifndef MAGNUM_TARGET_GLES
               &AbstractShaderProgramGLTest::uniformDouble,
               &AbstractShaderProgramGLTest::uniformDoubleVector,
@@ -986,6 +995,70 @@ void AbstractShaderProgramGLTest::uniformArray() {
     MAGNUM_VERIFY_NO_GL_ERROR();
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void AbstractShaderProgramGLTest::binaryCache() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::get_program_binary>())
+        CORRADE_SKIP(Extensions::ARB::get_program_binary::string() << "is not supported.");
+    #endif
+
+    GLint formatCount{};
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    if(!formatCount)
+        CORRADE_SKIP("No program binary formats are supported.");
+
+    struct Cache {
+        Containers::String key;
+        Containers::Array<char> data;
+        Int loadCount{}, storeCount{};
+    } cache;
+
+    AbstractShaderProgram::setBinaryCache([](Containers::StringView key, void* userData) -> Containers::Optional<Containers::Array<char>> {
+        Cache& cache = *static_cast<Cache*>(userData);
+        ++cache.loadCount;
+        if(key != cache.key) return {};
+        Containers::Array<char> out{NoInit, cache.data.size()};
+        Utility::copy(cache.data, out);
+        return out;
+    }, [](Containers::StringView key, Containers::ArrayView<const char> data, void* userData) {
+        Cache& cache = *static_cast<Cache*>(userData);
+        ++cache.storeCount;
+        cache.key = key;
+        cache.data = Containers::Array<char>{NoInit, data.size()};
+        Utility::copy(data, cache.data);
+    }, &cache);
+    Containers::ScopeGuard disableCache{&cache, [](Cache*) {
+        AbstractShaderProgram::setBinaryCache(nullptr, nullptr);
+    }};
+
+    /* First time the binary isn't found, so it gets linked and stored */
+    {
+        MyShader shader;
+
+        MAGNUM_VERIFY_NO_GL_ERROR();
+        CORRADE_COMPARE(cache.loadCount, 1);
+        CORRADE_COMPARE(cache.storeCount, 1);
+        CORRADE_COMPARE(cache.key.size(), 40);
+        CORRADE_VERIFY(!cache.data.isEmpty());
+        CORRADE_VERIFY(shader.multiplierUniform >= 0);
+    }
+
+    /* Second time it's loaded from the cache and not stored again, the
+       program is still usable */
+    {
+        MyShader shader;
+
+        MAGNUM_VERIFY_NO_GL_ERROR();
+        CORRADE_COMPARE(cache.loadCount, 2);
+        CORRADE_COMPARE(cache.storeCount, 1);
+        CORRADE_VERIFY(shader.multiplierUniform >= 0);
+
+        shader.setUniform(shader.multiplierUniform, 0.35f);
+        MAGNUM_VERIFY_NO_GL_ERROR();
+    }
+}
+#endif
+
 #ifndef MAGNUM_TARGET_GLES
 struct MyDoubleShader: AbstractShaderProgram {
     explicit MyDoubleShader();
@@ -49,6 +49,8 @@ struct AbstractTextureGLTest: OpenGLTester {
        be deinlined to avoid including a StringView */
 
     #ifndef MAGNUM_TARGET_GLES
+    void handle();
+
     void imageQueryViewNullptr();
     void imageQueryViewBadSize();
     void subImageQueryViewNullptr();
@@ -70,6 +72,8 @@ AbstractTextureGLTest::AbstractTextureGLTest() {
               &AbstractTextureGLTest::constructMove,
 
               #ifndef MAGNUM_TARGET_GLES
+              &AbstractTextureGLTest::handle,
+
               &AbstractTextureGLTest::imageQueryViewNullptr,
               &AbstractTextureGLTest::imageQueryViewBadSize,
               &AbstractTextureGLTest::subImageQueryViewNullptr,
@@ -122,6 +126,32 @@ void AbstractTextureGLTest::constructMove() {
 }
 
 #ifndef MAGNUM_TARGET_GLES
+void AbstractTextureGLTest::handle() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::bindless_texture>())
+        CORRADE_SKIP(Extensions::ARB::bindless_texture::string() << "is not supported.");
+
+    Texture2D texture;
+    texture.setMinificationFilter(SamplerFilter::Linear)
+        .setMagnificationFilter(SamplerFilter::Linear)
+        .setStorage(1, TextureFormat::RGBA8, Vector2i{4});
+
+    const UnsignedLong handle = texture.handle();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(handle);
+
+    /* Repeated queries return the same handle */
+    CORRADE_COMPARE(texture.handle(), handle);
+    CORRADE_VERIFY(!AbstractTexture::isHandleResident(handle));
+
+    AbstractTexture::makeHandleResident(handle);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(AbstractTexture::isHandleResident(handle));
+
+    AbstractTexture::makeHandleNonResident(handle);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(!AbstractTexture::isHandleResident(handle));
+}
+
 void AbstractTextureGLTest::imageQueryViewNullptr() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
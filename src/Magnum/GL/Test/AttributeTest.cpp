@@ -71,6 +71,9 @@ struct AttributeTest: TestSuite::Tester {
     void attributeFromGenericFormatMatrixMxN();
     #endif
     void attributeFromGenericFormatEnableNormalized();
+    #ifndef MAGNUM_TARGET_GLES2
+    void attributeFromGenericFormatPacked();
+    #endif
     void attributeFromGenericFormatUnexpectedForNormalizedKind();
     #ifndef MAGNUM_TARGET_GLES2
     void attributeFromGenericFormatUnexpectedForIntegralKind();
@@ -145,6 +148,9 @@ AttributeTest::AttributeTest() {
               &AttributeTest::attributeFromGenericFormatMatrixMxN,
               #endif
               &AttributeTest::attributeFromGenericFormatEnableNormalized,
+              #ifndef MAGNUM_TARGET_GLES2
+              &AttributeTest::attributeFromGenericFormatPacked,
+              #endif
               &AttributeTest::attributeFromGenericFormatUnexpectedForNormalizedKind,
               #ifndef MAGNUM_TARGET_GLES2
               &AttributeTest::attributeFromGenericFormatUnexpectedForIntegralKind,
@@ -1106,6 +1112,30 @@ void AttributeTest::attributeFromGenericFormatEnableNormalized() {
     CORRADE_COMPARE(a.dataType(), DynamicAttribute::DataType::UnsignedByte);
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+void AttributeTest::attributeFromGenericFormatPacked() {
+    DynamicAttribute a{DynamicAttribute::Kind::Generic, 3,
+        VertexFormat::Vector4ui1010102Normalized};
+    CORRADE_COMPARE(a.kind(), DynamicAttribute::Kind::GenericNormalized);
+    CORRADE_COMPARE(a.location(), 3);
+    CORRADE_COMPARE(a.components(), DynamicAttribute::Components::Four);
+    CORRADE_COMPARE(a.vectorStride(), 4);
+    CORRADE_COMPARE(a.vectors(), 1);
+    CORRADE_COMPARE(a.dataType(), DynamicAttribute::DataType::UnsignedInt2101010Rev);
+
+    /* The three-component variant is still four components in GL, but can be
+       used for a three-component attribute */
+    DynamicAttribute a2{Attribute<5, Vector3>{},
+        VertexFormat::Vector3i1010102Normalized};
+    CORRADE_COMPARE(a2.kind(), DynamicAttribute::Kind::GenericNormalized);
+    CORRADE_COMPARE(a2.location(), 5);
+    CORRADE_COMPARE(a2.components(), DynamicAttribute::Components::Four);
+    CORRADE_COMPARE(a2.vectorStride(), 4);
+    CORRADE_COMPARE(a2.vectors(), 1);
+    CORRADE_COMPARE(a2.dataType(), DynamicAttribute::DataType::Int2101010Rev);
+}
+#endif
+
 void AttributeTest::attributeFromGenericFormatUnexpectedForNormalizedKind() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -1187,8 +1217,10 @@ void AttributeTest::hasVertexFormat() {
     #endif
     #ifndef MAGNUM_TARGET_GLES2
     CORRADE_VERIFY(GL::hasVertexFormat(Magnum::VertexFormat::Matrix2x3));
+    CORRADE_VERIFY(GL::hasVertexFormat(Magnum::VertexFormat::Vector3i1010102Normalized));
     #else
     CORRADE_VERIFY(!GL::hasVertexFormat(Magnum::VertexFormat::Matrix2x3));
+    CORRADE_VERIFY(!GL::hasVertexFormat(Magnum::VertexFormat::Vector3i1010102Normalized));
     #endif
 
     /* Ensure all generic formats are handled by going though all and executing
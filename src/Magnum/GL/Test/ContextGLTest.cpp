@@ -32,9 +32,11 @@
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/TestSuite/Compare/Numeric.h>
 
+#include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Texture.h"
 #include "Magnum/Platform/GLContext.h"
 
 #ifndef CORRADE_TARGET_EMSCRIPTEN
@@ -65,6 +67,8 @@ struct ContextGLTest: OpenGLTester {
     void supportedVersion();
     void isExtensionSupported();
     void isExtensionDisabled();
+
+    void statistics();
 };
 
 using namespace Containers::Literals;
@@ -205,7 +209,9 @@ ContextGLTest::ContextGLTest() {
         #endif
         &ContextGLTest::supportedVersion,
         &ContextGLTest::isExtensionSupported,
-        &ContextGLTest::isExtensionDisabled});
+        &ContextGLTest::isExtensionDisabled,
+
+        &ContextGLTest::statistics});
 }
 
 void ContextGLTest::stringFlags() {
@@ -519,6 +525,45 @@ void ContextGLTest::isExtensionDisabled() {
     #endif
 }
 
+void ContextGLTest::statistics() {
+    Context& context = Context::current();
+
+    context.resetStatistics();
+    CORRADE_COMPARE(context.statistics().bindCount, 0);
+    CORRADE_COMPARE(context.statistics().bindSkippedCount, 0);
+    CORRADE_COMPARE(context.statistics().textureSwitchCount, 0);
+    CORRADE_COMPARE(context.statistics().bufferUploadCount, 0);
+    CORRADE_COMPARE(context.statistics().bufferUploadSize, 0);
+    CORRADE_COMPARE(context.statistics().drawCount, 0);
+    CORRADE_COMPARE(context.statistics().invalidatedAttachmentCount, 0);
+    CORRADE_COMPARE(context.statistics().invalidatedPixelCount, 0);
+
+    /* Allocating without data isn't counted as an upload */
+    const char data[16]{};
+    Buffer buffer;
+    buffer.setData({nullptr, 32}, BufferUsage::StaticDraw)
+        .setSubData(0, data)
+        .setSubData(16, Containers::arrayView(data).prefix(8));
+    CORRADE_COMPARE(context.statistics().bufferUploadCount, 2);
+    CORRADE_COMPARE(context.statistics().bufferUploadSize, 24);
+
+    /* The second bind is redundant and gets skipped */
+    Texture2D texture;
+    const UnsignedLong bindCount = context.statistics().bindCount;
+    const UnsignedLong bindSkippedCount = context.statistics().bindSkippedCount;
+    texture.bind(0);
+    texture.bind(0);
+    CORRADE_COMPARE(context.statistics().textureSwitchCount, 1);
+    CORRADE_COMPARE(context.statistics().bindCount, bindCount + 1);
+    CORRADE_COMPARE(context.statistics().bindSkippedCount, bindSkippedCount + 1);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    context.resetStatistics();
+    CORRADE_COMPARE(context.statistics().textureSwitchCount, 0);
+    CORRADE_COMPARE(context.statistics().bufferUploadCount, 0);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::GL::Test::ContextGLTest)
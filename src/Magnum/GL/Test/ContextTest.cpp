@@ -35,6 +35,7 @@
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Version.h"
+#include "Magnum/Math/Time.h"
 
 namespace Magnum { namespace GL { namespace Test { namespace {
 
@@ -66,6 +67,9 @@ struct ContextTest: TestSuite::Tester {
     void debugDetectedDriverPacked();
     void debugDetectedDrivers();
     void debugDetectedDriversPacked();
+
+    void debugCreationPhase();
+    void debugCreationPhasePacked();
 };
 
 ContextTest::ContextTest() {
@@ -91,7 +95,10 @@ ContextTest::ContextTest() {
               &ContextTest::debugDetectedDriver,
               &ContextTest::debugDetectedDriverPacked,
               &ContextTest::debugDetectedDrivers,
-              &ContextTest::debugDetectedDriversPacked});
+              &ContextTest::debugDetectedDriversPacked,
+
+              &ContextTest::debugCreationPhase,
+              &ContextTest::debugCreationPhasePacked});
 }
 
 void ContextTest::isExtension() {
@@ -355,6 +362,10 @@ void ContextTest::constructNoCreate() {
         } context;
 
         CORRADE_VERIFY(!Context::hasCurrent());
+
+        /* Nothing measured yet */
+        CORRADE_COMPARE(context.creationDuration(Context::CreationPhase::FunctionLoading), Nanoseconds{});
+        CORRADE_COMPARE(context.creationDuration(Context::CreationPhase::Finalization), Nanoseconds{});
     }
 
     CORRADE_VERIFY(!Context::hasCurrent());
@@ -541,6 +552,19 @@ void ContextTest::debugDetectedDriversPacked() {
     #endif
 }
 
+void ContextTest::debugCreationPhase() {
+    std::ostringstream out;
+    Debug{&out} << Context::CreationPhase::StateInitialization << Context::CreationPhase(0xde);
+    CORRADE_COMPARE(out.str(), "GL::Context::CreationPhase::StateInitialization GL::Context::CreationPhase(0xde)\n");
+}
+
+void ContextTest::debugCreationPhasePacked() {
+    std::ostringstream out;
+    /* Last is not packed, ones before should not make any flags persistent */
+    Debug{&out} << Debug::packed << Context::CreationPhase::StateInitialization << Debug::packed << Context::CreationPhase(0xde) << Context::CreationPhase::Finalization;
+    CORRADE_COMPARE(out.str(), "StateInitialization 0xde GL::Context::CreationPhase::Finalization\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::GL::Test::ContextTest)
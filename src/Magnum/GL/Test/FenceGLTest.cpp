@@ -0,0 +1,207 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Fence.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/Math/Time.h"
+
+namespace Magnum { namespace GL { namespace Test { namespace {
+
+struct FenceGLTest: OpenGLTester {
+    explicit FenceGLTest();
+
+    void construct();
+    void constructMove();
+    void wrap();
+
+    void isSignaled();
+    void clientWait();
+    #ifndef MAGNUM_TARGET_WEBGL
+    void clientWaitBlocking();
+    #endif
+    void clientWaitInvalidTimeout();
+    void serverWait();
+};
+
+FenceGLTest::FenceGLTest() {
+    addTests({&FenceGLTest::construct,
+              &FenceGLTest::constructMove,
+              &FenceGLTest::wrap,
+
+              &FenceGLTest::isSignaled,
+              &FenceGLTest::clientWait,
+              #ifndef MAGNUM_TARGET_WEBGL
+              &FenceGLTest::clientWaitBlocking,
+              #endif
+              &FenceGLTest::clientWaitInvalidTimeout,
+              &FenceGLTest::serverWait});
+}
+
+#ifndef MAGNUM_TARGET_GLES
+#define SKIP_IF_NO_SYNC()                                                   \
+    if(!Context::current().isExtensionSupported<Extensions::ARB::sync>())   \
+        CORRADE_SKIP(Extensions::ARB::sync::string() << "is not supported.")
+#else
+#define SKIP_IF_NO_SYNC()
+#endif
+
+void FenceGLTest::construct() {
+    SKIP_IF_NO_SYNC();
+
+    {
+        Fence fence;
+
+        MAGNUM_VERIFY_NO_GL_ERROR();
+        CORRADE_VERIFY(fence.id());
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void FenceGLTest::constructMove() {
+    SKIP_IF_NO_SYNC();
+
+    Fence a;
+    GLsync id = a.id();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(id);
+
+    Fence b{Utility::move(a)};
+    CORRADE_VERIFY(!a.id());
+    CORRADE_COMPARE(b.id(), id);
+
+    Fence c{NoCreate};
+    c = Utility::move(b);
+    CORRADE_VERIFY(!b.id());
+    CORRADE_COMPARE(c.id(), id);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<Fence>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<Fence>::value);
+}
+
+void FenceGLTest::wrap() {
+    SKIP_IF_NO_SYNC();
+
+    GLsync id = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    /* Releasing won't delete anything */
+    {
+        auto fence = Fence::wrap(id, ObjectFlag::DeleteOnDestruction);
+        CORRADE_COMPARE(fence.release(), id);
+    }
+
+    /* ...so we can wrap it again */
+    Fence::wrap(id);
+    glDeleteSync(id);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void FenceGLTest::isSignaled() {
+    SKIP_IF_NO_SYNC();
+
+    Fence fence;
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Not checking the status before, as the GPU may be already done */
+    Renderer::finish();
+    CORRADE_VERIFY(fence.isSignaled());
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void FenceGLTest::clientWait() {
+    SKIP_IF_NO_SYNC();
+
+    Fence fence;
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* The first wait flushes, polling in a loop should thus eventually
+       succeed */
+    Fence::Status status;
+    while((status = fence.clientWait(Nanoseconds{0})) == Fence::Status::TimeoutExpired);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_AS(status, Fence::Status::WaitFailed,
+        TestSuite::Compare::NotEqual);
+    CORRADE_VERIFY(fence.isSignaled());
+
+    /* Waiting on a signaled fence returns immediately */
+    CORRADE_COMPARE(fence.clientWait(Nanoseconds{0}), Fence::Status::AlreadySignaled);
+}
+
+#ifndef MAGNUM_TARGET_WEBGL
+void FenceGLTest::clientWaitBlocking() {
+    SKIP_IF_NO_SYNC();
+
+    Fence fence;
+    fence.clientWait();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_VERIFY(fence.isSignaled());
+}
+#endif
+
+void FenceGLTest::clientWaitInvalidTimeout() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+    SKIP_IF_NO_SYNC();
+
+    Fence fence;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    #ifndef MAGNUM_TARGET_WEBGL
+    fence.clientWait(Nanoseconds{-5});
+    CORRADE_COMPARE(out.str(), "GL::Fence::clientWait(): expected a non-negative timeout, got Nanoseconds(-5)\n");
+    #else
+    fence.clientWait(Nanoseconds{5});
+    CORRADE_COMPARE(out.str(), "GL::Fence::clientWait(): expected a zero timeout on WebGL, got Nanoseconds(5)\n");
+    #endif
+}
+
+void FenceGLTest::serverWait() {
+    SKIP_IF_NO_SYNC();
+
+    Fence fence;
+    fence.serverWait();
+
+    /* Nothing observable on the client side, just verify there are no
+       errors */
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::FenceGLTest)
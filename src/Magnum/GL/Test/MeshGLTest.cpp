@@ -149,6 +149,11 @@ struct MeshGLTest: OpenGLTester {
 
     void indexTypeSetIndexOffsetNotIndexed();
 
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void shareVertexFormat();
+    void shareVertexFormatAfterVertexBuffers();
+    #endif
+
     void unbindVAOWhenSettingIndexBufferData();
     void unbindIndexBufferWhenBindingVao();
     void resetIndexBufferBindingWhenBindingVao();
@@ -214,6 +219,16 @@ struct MeshGLTest: OpenGLTester {
     #endif
     void multiDrawViewsInstanced();
     void multiDrawViewsDifferentMeshes();
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void multiDrawIndirect();
+    void multiDrawIndirectIndexed();
+    #ifndef MAGNUM_TARGET_GLES
+    void multiDrawIndirectCount();
+    #endif
+    void multiDrawIndirectInvalidOffsetStride();
+    void multiDrawIndirectIndexBufferOffset();
+    #endif
     #ifdef MAGNUM_TARGET_GLES
     void multiDrawInstanced();
     void multiDrawInstancedSparseArrays();
@@ -645,6 +660,11 @@ MeshGLTest::MeshGLTest() {
 
               &MeshGLTest::indexTypeSetIndexOffsetNotIndexed,
 
+              #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+              &MeshGLTest::shareVertexFormat,
+              &MeshGLTest::shareVertexFormatAfterVertexBuffers,
+              #endif
+
               &MeshGLTest::unbindVAOWhenSettingIndexBufferData,
               &MeshGLTest::unbindIndexBufferWhenBindingVao,
               &MeshGLTest::resetIndexBufferBindingWhenBindingVao,
@@ -724,6 +744,21 @@ MeshGLTest::MeshGLTest() {
         &MeshGLTest::multiDrawViewsDifferentMeshes
     });
 
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    addInstancedTests({&MeshGLTest::multiDrawIndirect,
+                       #ifndef MAGNUM_TARGET_GLES
+                       &MeshGLTest::multiDrawIndirectCount
+                       #endif
+                       },
+        Containers::arraySize(MultiDrawData));
+
+    addInstancedTests({&MeshGLTest::multiDrawIndirectIndexed},
+        Containers::arraySize(MultiDrawIndexedData));
+
+    addTests({&MeshGLTest::multiDrawIndirectInvalidOffsetStride,
+              &MeshGLTest::multiDrawIndirectIndexBufferOffset});
+    #endif
+
     #ifdef MAGNUM_TARGET_GLES
     addInstancedTests({&MeshGLTest::multiDrawInstanced,
                        &MeshGLTest::multiDrawInstancedSparseArrays},
@@ -2732,6 +2767,78 @@ void MeshGLTest::indexTypeSetIndexOffsetNotIndexed() {
         "GL::MeshView::setIndexOffset(): mesh is not indexed\n");
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void MeshGLTest::shareVertexFormat() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::vertex_attrib_binding>())
+        CORRADE_SKIP(Extensions::ARB::vertex_attrib_binding::string() << "is not supported.");
+    #else
+    if(!Context::current().isVersionSupported(Version::GLES310))
+        CORRADE_SKIP("OpenGL ES 3.1 is not supported.");
+    #endif
+
+    Buffer vertices;
+    vertices.setData(indexedVertexData, BufferUsage::StaticDraw);
+
+    constexpr UnsignedShort indexData[] = { 2, 1, 0 };
+    Buffer indices{Buffer::TargetHint::ElementArray};
+    indices.setData(indexData, BufferUsage::StaticDraw);
+
+    /* Two meshes with the same layout but different buffers and offsets */
+    Buffer vertices2;
+    vertices2.setData(indexedVertexData, BufferUsage::StaticDraw);
+    Buffer indices2{Buffer::TargetHint::ElementArray};
+    indices2.setData(indexData, BufferUsage::StaticDraw);
+
+    Mesh a;
+    a.shareVertexFormat();
+    CORRADE_VERIFY(a.isVertexFormatShared());
+    CORRADE_COMPARE(a.id(), 0);
+    a.addVertexBuffer(vertices, 1*4, MultipleShader::Position(),
+                      MultipleShader::Normal(), MultipleShader::TextureCoordinates())
+     .setIndexBuffer(indices, 0, MeshIndexType::UnsignedShort);
+
+    Mesh b;
+    b.shareVertexFormat()
+     .addVertexBuffer(vertices2, 1*4, MultipleShader::Position(),
+                      MultipleShader::Normal(), MultipleShader::TextureCoordinates())
+     .setIndexBuffer(indices2, 0, MeshIndexType::UnsignedShort);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    const auto valueA = Checker(MultipleShader{},
+        RenderbufferFormat::RGBA8,
+        a).get<Color4ub>(PixelFormat::RGBA, PixelType::UnsignedByte);
+    const auto valueB = Checker(MultipleShader{},
+        RenderbufferFormat::RGBA8,
+        b).get<Color4ub>(PixelFormat::RGBA, PixelType::UnsignedByte);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(valueA, indexedResult);
+    CORRADE_COMPARE(valueB, indexedResult);
+
+    /* Both meshes use the same VAO owned by the context after the draw */
+    CORRADE_VERIFY(a.id());
+    CORRADE_COMPARE(b.id(), a.id());
+
+    /* Calling it again is a no-op */
+    a.shareVertexFormat();
+    CORRADE_VERIFY(a.isVertexFormatShared());
+}
+
+void MeshGLTest::shareVertexFormatAfterVertexBuffers() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Mesh mesh;
+    mesh.addVertexBuffer(Buffer{}, 0, Attribute<0, Float>{});
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    mesh.shareVertexFormat();
+    CORRADE_COMPARE(out.str(), "GL::Mesh::shareVertexFormat(): expected to be called before adding vertex buffers\n");
+}
+#endif
+
 void MeshGLTest::unbindVAOWhenSettingIndexBufferData() {
     #ifndef MAGNUM_TARGET_GLES
     if(!Context::current().isExtensionSupported<Extensions::ARB::vertex_array_object>())
@@ -4637,6 +4744,223 @@ void MeshGLTest::multiDrawViewsDifferentMeshes() {
     CORRADE_COMPARE(out.str(), Utility::formatString("GL::AbstractShaderProgram::draw(): all meshes must be views of the same original mesh, expected 0x{:x} but got 0x{:x} at index 1\n", reinterpret_cast<std::uintptr_t>(&a), reinterpret_cast<std::uintptr_t>(&b)));
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void MeshGLTest::multiDrawIndirect() {
+    auto&& data = MultiDrawData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::draw_indirect>())
+        CORRADE_SKIP(Extensions::ARB::draw_indirect::string() << "is not supported.");
+    #else
+    if(!Context::current().isVersionSupported(Version::GLES310))
+        CORRADE_SKIP("OpenGL ES 3.1 is not supported.");
+    #endif
+
+    if(data.vertexId && !GL::Context::current().isExtensionSupported<GL::Extensions::MAGNUM::shader_vertex_id>())
+        CORRADE_SKIP("gl_VertexID not supported");
+
+    if(data.drawId) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shader_draw_parameters>())
+            CORRADE_SKIP(GL::Extensions::ARB::shader_draw_parameters::string() << "is not supported.");
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::multi_draw_indirect>())
+            CORRADE_SKIP(GL::Extensions::ARB::multi_draw_indirect::string() << "is not supported.");
+        #else
+        CORRADE_SKIP("gl_DrawID is not available for indirect draws on OpenGL ES.");
+        #endif
+    }
+
+    const struct {
+        Vector2 position;
+        Vector4 value;
+    } vertexData[] {
+        {}, /* initial offset */
+        {{-1.0f/3.0f, -1.0f/3.0f}, data.values[0]},
+        {{ 1.0f/3.0f, -1.0f/3.0f}, data.values[1]},
+        {{-1.0f/3.0f,  1.0f/3.0f}, data.values[2]},
+        {{ 1.0f/3.0f,  1.0f/3.0f}, data.values[3]},
+    };
+
+    Mesh mesh{MeshPrimitive::Points};
+    mesh.addVertexBuffer(Buffer{vertexData}, sizeof(vertexData[0]), MultiDrawShader::Position{}, MultiDrawShader::Value{});
+
+    /* Put some garbage in front to verify the offset is taken into account */
+    const DrawArraysIndirectCommand commands[] {
+        {},
+        {data.counts[0], 1, data.vertexOffsets[0], 0},
+        {data.counts[1], 1, data.vertexOffsets[1], 0},
+        {data.counts[2], 1, data.vertexOffsets[2], 0},
+        {data.counts[3], 1, data.vertexOffsets[3], 0},
+    };
+    Buffer commandBuffer{Buffer::TargetHint::DrawIndirect, commands};
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    MultiDrawChecker checker;
+    MultiDrawShader{data.vertexId, data.drawId}.draw(mesh, commandBuffer, sizeof(DrawArraysIndirectCommand), 4);
+    Vector4 value = checker.get();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_WITH(value, data.expected,
+        TestSuite::Compare::around(Vector4{1.0f/255.0f}));
+}
+
+void MeshGLTest::multiDrawIndirectIndexed() {
+    auto&& data = MultiDrawIndexedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::ARB::draw_indirect>())
+        CORRADE_SKIP(Extensions::ARB::draw_indirect::string() << "is not supported.");
+    #else
+    if(!Context::current().isVersionSupported(Version::GLES310))
+        CORRADE_SKIP("OpenGL ES 3.1 is not supported.");
+    #endif
+
+    if(data.vertexId && !GL::Context::current().isExtensionSupported<GL::Extensions::MAGNUM::shader_vertex_id>())
+        CORRADE_SKIP("gl_VertexID not supported");
+
+    const struct {
+        Vector2 position;
+        Vector4 value;
+    } vertexData[] {
+        {}, /* initial offset */
+        {{-1.0f/3.0f, -1.0f/3.0f}, data.values[0]},
+        {{ 1.0f/3.0f, -1.0f/3.0f}, data.values[1]},
+        {{-1.0f/3.0f,  1.0f/3.0f}, data.values[2]},
+        {{ 1.0f/3.0f,  1.0f/3.0f}, data.values[3]},
+    };
+
+    Mesh mesh{MeshPrimitive::Points};
+    mesh.addVertexBuffer(Buffer{vertexData}, sizeof(vertexData[0]), MultiDrawShader::Position{}, MultiDrawShader::Value{})
+        .setIndexBuffer(Buffer{Buffer::TargetHint::ElementArray, data.indices}, 0, MeshIndexType::UnsignedInt);
+
+    /* Commands interleaved with unrelated data to verify the stride is taken
+       into account */
+    const struct {
+        DrawElementsIndirectCommand command;
+        UnsignedInt padding;
+    } commands[] {
+        {{data.counts[0], 1, data.indexOffsetsInBytes[0]/4, Int(data.vertexOffsets[0]), 0}, 0xdeadbeef},
+        {{data.counts[1], 1, data.indexOffsetsInBytes[1]/4, Int(data.vertexOffsets[1]), 0}, 0xdeadbeef},
+        {{data.counts[2], 1, data.indexOffsetsInBytes[2]/4, Int(data.vertexOffsets[2]), 0}, 0xdeadbeef},
+        {{data.counts[3], 1, data.indexOffsetsInBytes[3]/4, Int(data.vertexOffsets[3]), 0}, 0xdeadbeef},
+    };
+    Buffer commandBuffer{Buffer::TargetHint::DrawIndirect, commands};
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    MultiDrawChecker checker;
+    MultiDrawShader{data.vertexId}.draw(mesh, commandBuffer, 0, 4, sizeof(commands[0]));
+    Vector4 value = checker.get();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_WITH(value, data.expected,
+        TestSuite::Compare::around(Vector4{1.0f/255.0f}));
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void MeshGLTest::multiDrawIndirectCount() {
+    auto&& data = MultiDrawData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!Context::current().isExtensionSupported<Extensions::ARB::indirect_parameters>())
+        CORRADE_SKIP(Extensions::ARB::indirect_parameters::string() << "is not supported.");
+
+    if(data.vertexId && !GL::Context::current().isExtensionSupported<GL::Extensions::MAGNUM::shader_vertex_id>())
+        CORRADE_SKIP("gl_VertexID not supported");
+
+    if(data.drawId && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shader_draw_parameters>())
+        CORRADE_SKIP(GL::Extensions::ARB::shader_draw_parameters::string() << "is not supported.");
+
+    const struct {
+        Vector2 position;
+        Vector4 value;
+    } vertexData[] {
+        {}, /* initial offset */
+        {{-1.0f/3.0f, -1.0f/3.0f}, data.values[0]},
+        {{ 1.0f/3.0f, -1.0f/3.0f}, data.values[1]},
+        {{-1.0f/3.0f,  1.0f/3.0f}, data.values[2]},
+        {{ 1.0f/3.0f,  1.0f/3.0f}, data.values[3]},
+    };
+
+    Mesh mesh{MeshPrimitive::Points};
+    mesh.addVertexBuffer(Buffer{vertexData}, sizeof(vertexData[0]), MultiDrawShader::Position{}, MultiDrawShader::Value{});
+
+    /* The last command is past the count stored in the buffer and thus should
+       never get drawn even though max draw count allows it */
+    const DrawArraysIndirectCommand commands[] {
+        {data.counts[0], 1, data.vertexOffsets[0], 0},
+        {data.counts[1], 1, data.vertexOffsets[1], 0},
+        {data.counts[2], 1, data.vertexOffsets[2], 0},
+        {data.counts[3], 1, data.vertexOffsets[3], 0},
+        {4, 1, 0, 0},
+    };
+    Buffer commandBuffer{Buffer::TargetHint::DrawIndirect, commands};
+
+    /* Garbage in front to verify the offset is taken into account */
+    const UnsignedInt drawCount[]{0xdeadbeef, 4};
+    Buffer drawCountBuffer{drawCount};
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    MultiDrawChecker checker;
+    MultiDrawShader{data.vertexId, data.drawId}.draw(mesh, commandBuffer, 0, drawCountBuffer, 4, 5);
+    Vector4 value = checker.get();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_WITH(value, data.expected,
+        TestSuite::Compare::around(Vector4{1.0f/255.0f}));
+}
+#endif
+
+void MeshGLTest::multiDrawIndirectInvalidOffsetStride() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Mesh mesh;
+    MultiDrawShader shader;
+    Buffer buffer{NoCreate};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    shader.draw(mesh, buffer, 2, 1);
+    shader.draw(mesh, buffer, 0, 1, 17);
+    #ifndef MAGNUM_TARGET_GLES
+    shader.draw(mesh, buffer, 0, buffer, 6, 1);
+    #endif
+    CORRADE_COMPARE(out.str(),
+        "GL::AbstractShaderProgram::draw(): expected offset and stride to be a multiple of 4, got 2 and 0\n"
+        "GL::AbstractShaderProgram::draw(): expected offset and stride to be a multiple of 4, got 0 and 17\n"
+        #ifndef MAGNUM_TARGET_GLES
+        "GL::AbstractShaderProgram::draw(): expected offset, draw count offset and stride to be a multiple of 4, got 0, 6 and 0\n"
+        #endif
+        );
+}
+
+void MeshGLTest::multiDrawIndirectIndexBufferOffset() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Mesh mesh;
+    mesh.setIndexBuffer(Buffer{Buffer::TargetHint::ElementArray, {0, 2, 1, 0}}, 4, MeshIndexType::UnsignedInt);
+    MultiDrawShader shader;
+    Buffer buffer{NoCreate};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    shader.draw(mesh, buffer, 0, 1);
+    #ifndef MAGNUM_TARGET_GLES
+    shader.draw(mesh, buffer, 0, buffer, 0, 1);
+    #endif
+    CORRADE_COMPARE(out.str(),
+        "GL::AbstractShaderProgram::draw(): indirect draws expect the index buffer to be set with a zero offset, got 4\n"
+        #ifndef MAGNUM_TARGET_GLES
+        "GL::AbstractShaderProgram::draw(): indirect draws expect the index buffer to be set with a zero offset, got 4\n"
+        #endif
+        );
+}
+#endif
+
 #ifdef MAGNUM_TARGET_GLES
 struct MultiDrawInstancedShader: AbstractShaderProgram {
     typedef Attribute<0, Float> PositionX;
@@ -0,0 +1,163 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/PixelFormat.h"
+#include "Magnum/GL/Renderbuffer.h"
+#include "Magnum/GL/RenderbufferFormat.h"
+#include "Magnum/GL/RenderPass.h"
+#include "Magnum/Math/Color.h"
+
+namespace Magnum { namespace GL { namespace Test { namespace {
+
+struct RenderPassGLTest: OpenGLTester {
+    explicit RenderPassGLTest();
+
+    void loadStore();
+    void clear();
+    void invalidate();
+};
+
+RenderPassGLTest::RenderPassGLTest() {
+    addTests({&RenderPassGLTest::loadStore,
+              &RenderPassGLTest::clear,
+              &RenderPassGLTest::invalidate});
+}
+
+using namespace Math::Literals;
+
+void RenderPassGLTest::loadStore() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("GL 3.0 is not supported.");
+    #endif
+
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{16});
+
+    Framebuffer framebuffer{{{}, Vector2i{16}}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color)
+        .clearColor(0, 0x3366ccff_rgbaf);
+
+    /* With the defaults, nothing is cleared or invalidated */
+    Context& context = Context::current();
+    const UnsignedLong invalidatedAttachmentCount = context.statistics().invalidatedAttachmentCount;
+    RenderPass{framebuffer}
+        .begin()
+        .end();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(context.statistics().invalidatedAttachmentCount, invalidatedAttachmentCount);
+
+    Image2D image = framebuffer.read({{}, Vector2i{1}}, {PixelFormat::RGBA, PixelType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(Containers::arrayCast<Color4ub>(image.data())[0], 0x3366ccff_rgba);
+}
+
+void RenderPassGLTest::clear() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("GL 3.0 is not supported.");
+    #endif
+
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{16});
+    Renderbuffer depthStencil;
+    depthStencil.setStorage(RenderbufferFormat::Depth24Stencil8, Vector2i{16});
+
+    Framebuffer framebuffer{{{}, Vector2i{16}}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color)
+        .attachRenderbuffer(Framebuffer::BufferAttachment::DepthStencil, depthStencil);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(framebuffer.checkStatus(FramebufferTarget::Draw), Framebuffer::Status::Complete);
+
+    RenderPass{framebuffer}
+        .setColorAttachment(0, RenderPass::LoadAction::Clear, RenderPass::StoreAction::Store, 0x3366ccff_rgbaf)
+        .setDepthAttachment(RenderPass::LoadAction::Clear, RenderPass::StoreAction::Store, 0.5f)
+        .setStencilAttachment(RenderPass::LoadAction::Clear, RenderPass::StoreAction::Store, 67)
+        .begin()
+        .end();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Image2D image = framebuffer.read({{}, Vector2i{1}}, {PixelFormat::RGBA, PixelType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(Containers::arrayCast<Color4ub>(image.data())[0], 0x3366ccff_rgba);
+}
+
+void RenderPassGLTest::invalidate() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("GL 3.0 is not supported.");
+    #endif
+
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{16});
+    Renderbuffer depthStencil;
+    depthStencil.setStorage(RenderbufferFormat::Depth24Stencil8, Vector2i{16});
+
+    Framebuffer framebuffer{{{}, Vector2i{16}}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color)
+        .attachRenderbuffer(Framebuffer::BufferAttachment::DepthStencil, depthStencil);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Context& context = Context::current();
+    const UnsignedLong invalidatedAttachmentCount = context.statistics().invalidatedAttachmentCount;
+    const UnsignedLong invalidatedPixelCount = context.statistics().invalidatedPixelCount;
+
+    /* Color load is discarded, depth and stencil are cleared and then
+       discarded as well */
+    RenderPass{framebuffer}
+        .setColorAttachment(0, RenderPass::LoadAction::DontCare, RenderPass::StoreAction::Store)
+        .setDepthAttachment(RenderPass::LoadAction::Clear, RenderPass::StoreAction::DontCare)
+        .setStencilAttachment(RenderPass::LoadAction::Clear, RenderPass::StoreAction::DontCare)
+        .begin()
+        .end();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!context.isExtensionSupported<Extensions::ARB::invalidate_subdata>())
+        CORRADE_SKIP(Extensions::ARB::invalidate_subdata::string() << "is not supported, can't test invalidation statistics.");
+    #endif
+
+    CORRADE_COMPARE(context.statistics().invalidatedAttachmentCount, invalidatedAttachmentCount + 3);
+    CORRADE_COMPARE(context.statistics().invalidatedPixelCount, invalidatedPixelCount + 3*16*16);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::RenderPassGLTest)
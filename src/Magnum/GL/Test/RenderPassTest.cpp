@@ -0,0 +1,119 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/RenderPass.h"
+
+namespace Magnum { namespace GL { namespace Test { namespace {
+
+struct RenderPassTest: TestSuite::Tester {
+    explicit RenderPassTest();
+
+    void construct();
+    void setAttachments();
+    void colorAttachmentOutOfRange();
+
+    void debugLoadAction();
+    void debugStoreAction();
+};
+
+RenderPassTest::RenderPassTest() {
+    addTests({&RenderPassTest::construct,
+              &RenderPassTest::setAttachments,
+              &RenderPassTest::colorAttachmentOutOfRange,
+
+              &RenderPassTest::debugLoadAction,
+              &RenderPassTest::debugStoreAction});
+}
+
+void RenderPassTest::construct() {
+    Framebuffer framebuffer{NoCreate};
+    RenderPass pass{framebuffer};
+    CORRADE_COMPARE(&pass.framebuffer(), &framebuffer);
+    CORRADE_COMPARE(pass.colorLoadAction(0), RenderPass::LoadAction::Load);
+    CORRADE_COMPARE(pass.colorStoreAction(7), RenderPass::StoreAction::Store);
+    CORRADE_COMPARE(pass.depthLoadAction(), RenderPass::LoadAction::Load);
+    CORRADE_COMPARE(pass.depthStoreAction(), RenderPass::StoreAction::Store);
+    CORRADE_COMPARE(pass.stencilLoadAction(), RenderPass::LoadAction::Load);
+    CORRADE_COMPARE(pass.stencilStoreAction(), RenderPass::StoreAction::Store);
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<Framebuffer&, RenderPass>::value);
+}
+
+void RenderPassTest::setAttachments() {
+    Framebuffer framebuffer{NoCreate};
+    RenderPass pass{framebuffer};
+    pass.setColorAttachment(3, RenderPass::LoadAction::Clear, RenderPass::StoreAction::DontCare)
+        .setDepthAttachment(RenderPass::LoadAction::DontCare, RenderPass::StoreAction::DontCare)
+        .setStencilAttachment(RenderPass::LoadAction::Clear, RenderPass::StoreAction::Store);
+    CORRADE_COMPARE(pass.colorLoadAction(3), RenderPass::LoadAction::Clear);
+    CORRADE_COMPARE(pass.colorStoreAction(3), RenderPass::StoreAction::DontCare);
+    CORRADE_COMPARE(pass.colorLoadAction(0), RenderPass::LoadAction::Load);
+    CORRADE_COMPARE(pass.depthLoadAction(), RenderPass::LoadAction::DontCare);
+    CORRADE_COMPARE(pass.depthStoreAction(), RenderPass::StoreAction::DontCare);
+    CORRADE_COMPARE(pass.stencilLoadAction(), RenderPass::LoadAction::Clear);
+    CORRADE_COMPARE(pass.stencilStoreAction(), RenderPass::StoreAction::Store);
+}
+
+void RenderPassTest::colorAttachmentOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Framebuffer framebuffer{NoCreate};
+    RenderPass pass{framebuffer};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    pass.setColorAttachment(8, RenderPass::LoadAction::Clear, RenderPass::StoreAction::Store);
+    pass.colorLoadAction(8);
+    pass.colorStoreAction(8);
+    CORRADE_COMPARE(out.str(),
+        "GL::RenderPass::setColorAttachment(): index 8 out of range for 8 color attachments\n"
+        "GL::RenderPass::colorLoadAction(): index 8 out of range for 8 color attachments\n"
+        "GL::RenderPass::colorStoreAction(): index 8 out of range for 8 color attachments\n");
+}
+
+void RenderPassTest::debugLoadAction() {
+    std::ostringstream out;
+
+    Debug(&out) << RenderPass::LoadAction::DontCare << RenderPass::LoadAction(0xde);
+    CORRADE_COMPARE(out.str(), "GL::RenderPass::LoadAction::DontCare GL::RenderPass::LoadAction(0xde)\n");
+}
+
+void RenderPassTest::debugStoreAction() {
+    std::ostringstream out;
+
+    Debug(&out) << RenderPass::StoreAction::DontCare << RenderPass::StoreAction(0xde);
+    CORRADE_COMPARE(out.str(), "GL::RenderPass::StoreAction::DontCare GL::RenderPass::StoreAction(0xde)\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::RenderPassTest)
@@ -0,0 +1,290 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/GL/ShaderCompileQueue.h"
+
+namespace Magnum { namespace GL { namespace Test { namespace {
+
+struct ShaderCompileQueueTest: TestSuite::Tester {
+    explicit ShaderCompileQueueTest();
+
+    void construct();
+    void constructCopy();
+    void constructMove();
+
+    void add();
+    void compile();
+    void update();
+    void updateMaxCount();
+    void finish();
+    void release();
+
+    void isFinishedOutOfRange();
+    void releaseInvalid();
+};
+
+ShaderCompileQueueTest::ShaderCompileQueueTest() {
+    addTests({&ShaderCompileQueueTest::construct,
+              &ShaderCompileQueueTest::constructCopy,
+              &ShaderCompileQueueTest::constructMove,
+
+              &ShaderCompileQueueTest::add,
+              &ShaderCompileQueueTest::compile,
+              &ShaderCompileQueueTest::update,
+              &ShaderCompileQueueTest::updateMaxCount,
+              &ShaderCompileQueueTest::finish,
+              &ShaderCompileQueueTest::release,
+
+              &ShaderCompileQueueTest::isFinishedOutOfRange,
+              &ShaderCompileQueueTest::releaseInvalid});
+}
+
+/* Mimics the CompileState convention of builtin shaders without needing a GL
+   context. The link status is controlled through an external flag. */
+struct FakeShader {
+    class CompileState;
+
+    explicit FakeShader(NoCreateT): value{} {}
+    explicit FakeShader(int value): value{value} {}
+    explicit FakeShader(CompileState&& state);
+
+    FakeShader(const FakeShader&) = delete;
+    FakeShader(FakeShader&&) noexcept = default;
+    FakeShader& operator=(const FakeShader&) = delete;
+    FakeShader& operator=(FakeShader&&) noexcept = default;
+
+    static CompileState compile(int value, const bool* finished);
+
+    int value;
+};
+
+class FakeShader::CompileState: public FakeShader {
+    public:
+        explicit CompileState(FakeShader&& shader, const bool* finished): FakeShader{Utility::move(shader)}, _finished{finished} {}
+
+        bool isLinkFinished() const { return *_finished; }
+
+    private:
+        const bool* _finished;
+};
+
+FakeShader::FakeShader(CompileState&& state): FakeShader{static_cast<FakeShader&&>(Utility::move(state))} {}
+
+FakeShader::CompileState FakeShader::compile(int value, const bool* finished) {
+    return CompileState{FakeShader{value}, finished};
+}
+
+void ShaderCompileQueueTest::construct() {
+    ShaderCompileQueue<FakeShader> queue;
+    CORRADE_COMPARE(queue.size(), 0);
+    CORRADE_COMPARE(queue.pendingCount(), 0);
+    CORRADE_VERIFY(queue.isFinished());
+    CORRADE_COMPARE(queue.update(), 0);
+}
+
+void ShaderCompileQueueTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<ShaderCompileQueue<FakeShader>>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<ShaderCompileQueue<FakeShader>>{});
+}
+
+void ShaderCompileQueueTest::constructMove() {
+    bool finished = false;
+
+    ShaderCompileQueue<FakeShader> a;
+    a.compile(3, &finished);
+
+    ShaderCompileQueue<FakeShader> b = Utility::move(a);
+    CORRADE_COMPARE(b.size(), 1);
+    CORRADE_COMPARE(b.pendingCount(), 1);
+
+    ShaderCompileQueue<FakeShader> c;
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.size(), 1);
+    CORRADE_COMPARE(c.pendingCount(), 1);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<ShaderCompileQueue<FakeShader>>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<ShaderCompileQueue<FakeShader>>::value);
+}
+
+void ShaderCompileQueueTest::add() {
+    bool finished = false;
+
+    ShaderCompileQueue<FakeShader> queue;
+    CORRADE_COMPARE(queue.add(FakeShader::compile(7, &finished)), 0);
+    CORRADE_COMPARE(queue.add(FakeShader::compile(8, &finished)), 1);
+    CORRADE_COMPARE(queue.size(), 2);
+    CORRADE_COMPARE(queue.pendingCount(), 2);
+    CORRADE_VERIFY(!queue.isFinished());
+    CORRADE_VERIFY(!queue.isFinished(0));
+    CORRADE_VERIFY(!queue.isFinished(1));
+}
+
+void ShaderCompileQueueTest::compile() {
+    bool finished = false;
+
+    ShaderCompileQueue<FakeShader> queue;
+    CORRADE_COMPARE(queue.compile(7, &finished), 0);
+    CORRADE_COMPARE(queue.compile(8, &finished), 1);
+    CORRADE_COMPARE(queue.size(), 2);
+    CORRADE_COMPARE(queue.pendingCount(), 2);
+}
+
+void ShaderCompileQueueTest::update() {
+    bool finishedA = false, finishedB = false, finishedC = false;
+
+    ShaderCompileQueue<FakeShader> queue;
+    queue.compile(1, &finishedA);
+    queue.compile(2, &finishedB);
+    queue.compile(3, &finishedC);
+
+    /* Nothing finished yet */
+    CORRADE_COMPARE(queue.update(), 0);
+    CORRADE_COMPARE(queue.pendingCount(), 3);
+
+    /* Finishing out of order is fine */
+    finishedB = true;
+    CORRADE_COMPARE(queue.update(), 1);
+    CORRADE_COMPARE(queue.pendingCount(), 2);
+    CORRADE_VERIFY(!queue.isFinished(0));
+    CORRADE_VERIFY(queue.isFinished(1));
+    CORRADE_VERIFY(!queue.isFinished(2));
+    CORRADE_COMPARE(queue[1].value, 2);
+
+    /* Already finalized shaders aren't counted again */
+    finishedA = finishedC = true;
+    CORRADE_COMPARE(queue.update(), 2);
+    CORRADE_COMPARE(queue.pendingCount(), 0);
+    CORRADE_VERIFY(queue.isFinished());
+    CORRADE_COMPARE(queue[0].value, 1);
+    CORRADE_COMPARE(queue[2].value, 3);
+
+    CORRADE_COMPARE(queue.update(), 0);
+
+    /* Adding more after everything finished works too */
+    bool finishedD = true;
+    CORRADE_COMPARE(queue.compile(4, &finishedD), 3);
+    CORRADE_VERIFY(!queue.isFinished());
+    CORRADE_COMPARE(queue.update(), 1);
+    CORRADE_VERIFY(queue.isFinished());
+    CORRADE_COMPARE(queue[3].value, 4);
+}
+
+void ShaderCompileQueueTest::updateMaxCount() {
+    bool finished = true;
+
+    ShaderCompileQueue<FakeShader> queue;
+    queue.compile(1, &finished);
+    queue.compile(2, &finished);
+    queue.compile(3, &finished);
+
+    CORRADE_COMPARE(queue.update(2), 2);
+    CORRADE_COMPARE(queue.pendingCount(), 1);
+    CORRADE_VERIFY(queue.isFinished(0));
+    CORRADE_VERIFY(queue.isFinished(1));
+    CORRADE_VERIFY(!queue.isFinished(2));
+
+    CORRADE_COMPARE(queue.update(2), 1);
+    CORRADE_VERIFY(queue.isFinished());
+}
+
+void ShaderCompileQueueTest::finish() {
+    bool finished = false, finishedB = true;
+
+    ShaderCompileQueue<FakeShader> queue;
+    queue.compile(1, &finished);
+    queue.compile(2, &finishedB);
+    queue.compile(3, &finished);
+    CORRADE_COMPARE(queue.update(), 1);
+
+    /* Finalizes everything regardless of the reported status */
+    queue.finish();
+    CORRADE_COMPARE(queue.pendingCount(), 0);
+    CORRADE_VERIFY(queue.isFinished());
+    CORRADE_COMPARE(queue[0].value, 1);
+    CORRADE_COMPARE(queue[1].value, 2);
+    CORRADE_COMPARE(queue[2].value, 3);
+}
+
+void ShaderCompileQueueTest::release() {
+    bool finished = true;
+
+    ShaderCompileQueue<FakeShader> queue;
+    queue.compile(5, &finished);
+    queue.compile(6, &finished);
+    queue.update();
+
+    FakeShader shader = queue.release(1);
+    CORRADE_COMPARE(shader.value, 6);
+
+    /* Released shaders still count as finished and the size stays */
+    CORRADE_VERIFY(queue.isFinished(1));
+    CORRADE_COMPARE(queue.size(), 2);
+    CORRADE_COMPARE(queue[0].value, 5);
+}
+
+void ShaderCompileQueueTest::isFinishedOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    bool finished = false;
+
+    ShaderCompileQueue<FakeShader> queue;
+    queue.compile(1, &finished);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    queue.isFinished(1);
+    CORRADE_COMPARE(out.str(), "GL::ShaderCompileQueue::isFinished(): index 1 out of range for 1 shaders\n");
+}
+
+void ShaderCompileQueueTest::releaseInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    bool finished = false, finishedB = true;
+
+    ShaderCompileQueue<FakeShader> queue;
+    queue.compile(1, &finished);
+    queue.compile(2, &finishedB);
+    queue.update();
+    queue.release(1);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    queue.release(2);
+    queue.release(0);
+    queue.release(1);
+    CORRADE_COMPARE(out.str(),
+        "GL::ShaderCompileQueue::release(): index 2 out of range for 2 shaders\n"
+        "GL::ShaderCompileQueue::release(): shader 0 is not finished yet\n"
+        "GL::ShaderCompileQueue::release(): shader 1 was already released\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::ShaderCompileQueueTest)
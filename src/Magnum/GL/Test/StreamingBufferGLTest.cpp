@@ -0,0 +1,233 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/StreamingBuffer.h"
+
+namespace Magnum { namespace GL { namespace Test { namespace {
+
+struct StreamingBufferGLTest: OpenGLTester {
+    explicit StreamingBufferGLTest();
+
+    void construct();
+    void constructZeroSize();
+    void constructMove();
+
+    void write();
+    void writeAligned();
+    void writeInvalidAlignment();
+    void writeTooLarge();
+    void nextFrame();
+};
+
+StreamingBufferGLTest::StreamingBufferGLTest() {
+    addTests({&StreamingBufferGLTest::construct,
+              &StreamingBufferGLTest::constructZeroSize,
+              &StreamingBufferGLTest::constructMove,
+
+              &StreamingBufferGLTest::write,
+              &StreamingBufferGLTest::writeAligned,
+              &StreamingBufferGLTest::writeInvalidAlignment,
+              &StreamingBufferGLTest::writeTooLarge,
+              &StreamingBufferGLTest::nextFrame});
+}
+
+void StreamingBufferGLTest::construct() {
+    {
+        StreamingBuffer buffer{Buffer::TargetHint::Uniform, 64};
+        MAGNUM_VERIFY_NO_GL_ERROR();
+
+        CORRADE_VERIFY(buffer.buffer().id() > 0);
+        CORRADE_COMPARE(buffer.buffer().targetHint(), Buffer::TargetHint::Uniform);
+        CORRADE_COMPARE(buffer.buffer().size(), 3*64);
+        CORRADE_COMPARE(buffer.regionSize(), 64);
+        CORRADE_COMPARE(buffer.regionCount(), 3);
+        CORRADE_COMPARE(buffer.currentRegion(), 0);
+        CORRADE_COMPARE(buffer.currentRegionUsedSize(), 0);
+
+        #ifndef MAGNUM_TARGET_GLES
+        CORRADE_COMPARE(buffer.isPersistentlyMapped(), Context::current().isExtensionSupported<Extensions::ARB::buffer_storage>());
+        #else
+        CORRADE_COMPARE(buffer.isPersistentlyMapped(), Context::current().isExtensionSupported<Extensions::EXT::buffer_storage>());
+        #endif
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void StreamingBufferGLTest::constructZeroSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    StreamingBuffer{Buffer::TargetHint::Array, 0};
+    StreamingBuffer{Buffer::TargetHint::Array, 16, 0};
+    CORRADE_COMPARE(out.str(),
+        "GL::StreamingBuffer: expected non-zero region size and count but got 0 and 3\n"
+        "GL::StreamingBuffer: expected non-zero region size and count but got 16 and 0\n");
+}
+
+void StreamingBufferGLTest::constructMove() {
+    StreamingBuffer a{Buffer::TargetHint::Array, 32, 2};
+    const Int data[]{3, 7};
+    a.write(data);
+    const GLuint id = a.buffer().id();
+    const bool persistentlyMapped = a.isPersistentlyMapped();
+
+    StreamingBuffer b{Utility::move(a)};
+    CORRADE_COMPARE(a.buffer().id(), 0);
+    CORRADE_VERIFY(!a.isPersistentlyMapped());
+    CORRADE_COMPARE(b.buffer().id(), id);
+    CORRADE_COMPARE(b.regionSize(), 32);
+    CORRADE_COMPARE(b.regionCount(), 2);
+    CORRADE_COMPARE(b.currentRegionUsedSize(), 8);
+    CORRADE_COMPARE(b.isPersistentlyMapped(), persistentlyMapped);
+
+    StreamingBuffer c{Buffer::TargetHint::Array, 16};
+    const GLuint cId = c.buffer().id();
+    c = Utility::move(b);
+    CORRADE_COMPARE(b.buffer().id(), cId);
+    CORRADE_COMPARE(b.regionSize(), 16);
+    CORRADE_COMPARE(c.buffer().id(), id);
+    CORRADE_COMPARE(c.regionSize(), 32);
+    CORRADE_COMPARE(c.currentRegionUsedSize(), 8);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<StreamingBuffer>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<StreamingBuffer>::value);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void StreamingBufferGLTest::write() {
+    StreamingBuffer buffer{Buffer::TargetHint::Array, 32};
+
+    const Int a[]{2, 7, 5};
+    const Int b[]{13, 25};
+    CORRADE_COMPARE(buffer.write(a), 0);
+    CORRADE_COMPARE(buffer.currentRegionUsedSize(), 12);
+    CORRADE_COMPARE(buffer.write(b), 12);
+    CORRADE_COMPARE(buffer.currentRegionUsedSize(), 20);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE_AS(Containers::arrayCast<Int>(buffer.buffer().subData(0, 20)),
+        Containers::arrayView<Int>({2, 7, 5, 13, 25}),
+        TestSuite::Compare::Container);
+    #endif
+}
+
+void StreamingBufferGLTest::writeAligned() {
+    StreamingBuffer buffer{Buffer::TargetHint::Uniform, 40};
+
+    const char data[]{'a', 'b', 'c'};
+    CORRADE_COMPARE(buffer.write(data, 16), 0);
+    CORRADE_COMPARE(buffer.write(data, 16), 16);
+    CORRADE_COMPARE(buffer.currentRegionUsedSize(), 19);
+
+    /* The alignment is relative to the whole buffer, not the region, so the
+       region start at 40 gets aligned to 48 */
+    buffer.nextFrame();
+    CORRADE_COMPARE(buffer.write(data, 16), 48);
+    CORRADE_COMPARE(buffer.currentRegionUsedSize(), 11);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void StreamingBufferGLTest::writeInvalidAlignment() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    StreamingBuffer buffer{Buffer::TargetHint::Array, 32};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    const char data[4]{};
+    buffer.write(data, 0);
+    buffer.write(data, 12);
+    CORRADE_COMPARE(out.str(),
+        "GL::StreamingBuffer::write(): expected alignment to be a power of two, got 0\n"
+        "GL::StreamingBuffer::write(): expected alignment to be a power of two, got 12\n");
+}
+
+void StreamingBufferGLTest::writeTooLarge() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    StreamingBuffer buffer{Buffer::TargetHint::Array, 32};
+    const char data[20]{};
+    buffer.write(data);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    /* 20 + 12 fits, 20 + 13 not, 24 + 12 not either */
+    buffer.write(Containers::arrayView(data).prefix(13));
+    buffer.write(Containers::arrayView(data).prefix(12), 8);
+    CORRADE_COMPARE(out.str(),
+        "GL::StreamingBuffer::write(): can't fit 13 bytes aligned to 1 into a region of 32 bytes with 20 bytes already used\n"
+        "GL::StreamingBuffer::write(): can't fit 12 bytes aligned to 8 into a region of 32 bytes with 20 bytes already used\n");
+}
+
+void StreamingBufferGLTest::nextFrame() {
+    StreamingBuffer buffer{Buffer::TargetHint::Array, 16, 3};
+
+    const Int a[]{1, 2};
+    const Int b[]{3, 4};
+    const Int c[]{5, 6};
+
+    CORRADE_COMPARE(buffer.write(a), 0);
+    CORRADE_COMPARE(&buffer.nextFrame(), &buffer);
+    CORRADE_COMPARE(buffer.currentRegion(), 1);
+    CORRADE_COMPARE(buffer.currentRegionUsedSize(), 0);
+    CORRADE_COMPARE(buffer.write(b), 16);
+    buffer.nextFrame();
+    CORRADE_COMPARE(buffer.currentRegion(), 2);
+    CORRADE_COMPARE(buffer.write(c), 32);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Wraps around back to the first region, waiting for the GPU or
+       orphaning the buffer */
+    buffer.nextFrame();
+    CORRADE_COMPARE(buffer.currentRegion(), 0);
+    CORRADE_COMPARE(buffer.write(c), 0);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE_AS(Containers::arrayCast<Int>(buffer.buffer().subData(0, 8)),
+        Containers::arrayView(c),
+        TestSuite::Compare::Container);
+    #endif
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::StreamingBufferGLTest)
@@ -0,0 +1,98 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/GL/StreamingBuffer.h"
+
+namespace Magnum { namespace GL { namespace Test { namespace {
+
+struct StreamingBufferTest: TestSuite::Tester {
+    explicit StreamingBufferTest();
+
+    void constructNoCreate();
+    void constructCopy();
+
+    void writeNoCreate();
+    void nextFrameNoCreate();
+};
+
+StreamingBufferTest::StreamingBufferTest() {
+    addTests({&StreamingBufferTest::constructNoCreate,
+              &StreamingBufferTest::constructCopy,
+
+              &StreamingBufferTest::writeNoCreate,
+              &StreamingBufferTest::nextFrameNoCreate});
+}
+
+void StreamingBufferTest::constructNoCreate() {
+    {
+        StreamingBuffer buffer{NoCreate};
+        CORRADE_COMPARE(buffer.buffer().id(), 0);
+        CORRADE_COMPARE(buffer.regionSize(), 0);
+        CORRADE_COMPARE(buffer.regionCount(), 0);
+        CORRADE_COMPARE(buffer.currentRegion(), 0);
+        CORRADE_COMPARE(buffer.currentRegionUsedSize(), 0);
+        CORRADE_VERIFY(!buffer.isPersistentlyMapped());
+    }
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<NoCreateT, StreamingBuffer>::value);
+}
+
+void StreamingBufferTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<StreamingBuffer>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<StreamingBuffer>{});
+}
+
+void StreamingBufferTest::writeNoCreate() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    StreamingBuffer buffer{NoCreate};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    const char data[4]{};
+    buffer.write(data);
+    CORRADE_COMPARE(out.str(), "GL::StreamingBuffer::write(): the buffer is not created\n");
+}
+
+void StreamingBufferTest::nextFrameNoCreate() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    StreamingBuffer buffer{NoCreate};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    buffer.nextFrame();
+    CORRADE_COMPARE(out.str(), "GL::StreamingBuffer::nextFrame(): the buffer is not created\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::StreamingBufferTest)
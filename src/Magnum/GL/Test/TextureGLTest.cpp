@@ -24,7 +24,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
 
 #include "Magnum/Image.h"
 #include "Magnum/ImageView.h"
@@ -289,6 +291,11 @@ struct TextureGLTest: OpenGLTester {
     void invalidateSubImage3D();
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES
+    void sparse2D();
+    void sparse3D();
+    #endif
+
     void srgbStorage();
     void srgbAlphaStorage();
 };
@@ -697,6 +704,11 @@ TextureGLTest::TextureGLTest() {
         &TextureGLTest::invalidateSubImage3D,
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES
+        &TextureGLTest::sparse2D,
+        &TextureGLTest::sparse3D,
+        #endif
+
         &TextureGLTest::srgbStorage,
         &TextureGLTest::srgbAlphaStorage});
 }
@@ -3254,6 +3266,55 @@ void TextureGLTest::invalidateSubImage3D() {
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+void TextureGLTest::sparse2D() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::sparse_texture>())
+        CORRADE_SKIP(Extensions::ARB::sparse_texture::string() << "is not supported.");
+
+    const Int pageSizeCount = Texture2D::virtualPageSizeCount(TextureFormat::RGBA8);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_AS(pageSizeCount, 0, TestSuite::Compare::Greater);
+
+    const Vector2i pageSize = Texture2D::virtualPageSize(TextureFormat::RGBA8, pageSizeCount - 1);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_AS(pageSize.product(), 0, TestSuite::Compare::Greater);
+
+    Texture2D texture;
+    texture.setSparse(true, pageSizeCount - 1)
+        .setStorage(1, TextureFormat::RGBA8, pageSize*4);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Commit two pages, upload to one of them, release the other */
+    texture.commitPages(0, pageSize, pageSize*Vector2i{2, 1});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Containers::Array<char> data{ValueInit, std::size_t(pageSize.product()*4)};
+    texture.setSubImage(0, pageSize, ImageView2D{PixelFormat::RGBA8Unorm, pageSize, data})
+        .uncommitPages(0, pageSize*Vector2i{2, 1}, pageSize);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void TextureGLTest::sparse3D() {
+    if(!Context::current().isExtensionSupported<Extensions::ARB::sparse_texture>())
+        CORRADE_SKIP(Extensions::ARB::sparse_texture::string() << "is not supported.");
+
+    const Int pageSizeCount = Texture3D::virtualPageSizeCount(TextureFormat::RGBA8);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    if(!pageSizeCount)
+        CORRADE_SKIP("3D sparse textures are not supported for" << TextureFormat::RGBA8);
+
+    const Vector3i pageSize = Texture3D::virtualPageSize(TextureFormat::RGBA8);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Texture3D texture;
+    texture.setSparse(true)
+        .setStorage(1, TextureFormat::RGBA8, pageSize*2)
+        .commitPages(0, {}, pageSize)
+        .uncommitPages(0, {}, pageSize);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+#endif
+
 void TextureGLTest::srgbStorage() {
     #ifdef MAGNUM_TARGET_GLES2
     if(!Context::current().isExtensionSupported<Extensions::EXT::sRGB>())
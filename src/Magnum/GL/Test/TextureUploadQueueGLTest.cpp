@@ -0,0 +1,255 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureArray.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/GL/TextureUploadQueue.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace GL { namespace Test { namespace {
+
+struct TextureUploadQueueGLTest: OpenGLTester {
+    explicit TextureUploadQueueGLTest();
+
+    void construct();
+    void constructMove();
+
+    void upload2D();
+    void upload3D();
+    void upload2DArray();
+    void uploadTooLarge();
+
+    void completion();
+};
+
+TextureUploadQueueGLTest::TextureUploadQueueGLTest() {
+    addTests({&TextureUploadQueueGLTest::construct,
+              &TextureUploadQueueGLTest::constructMove,
+
+              &TextureUploadQueueGLTest::upload2D,
+              &TextureUploadQueueGLTest::upload3D,
+              &TextureUploadQueueGLTest::upload2DArray,
+              &TextureUploadQueueGLTest::uploadTooLarge,
+
+              &TextureUploadQueueGLTest::completion});
+}
+
+constexpr UnsignedByte Zero[4*4*4*2]{};
+
+/* 2x2 RGBA8 image, with one row of padding in front that's skipped via pixel
+   storage */
+constexpr UnsignedByte SubData2D[]{
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+
+void TextureUploadQueueGLTest::construct() {
+    {
+        TextureUploadQueue queue{256, 2};
+        MAGNUM_VERIFY_NO_GL_ERROR();
+
+        CORRADE_VERIFY(queue.buffer().buffer().id() > 0);
+        CORRADE_COMPARE(queue.buffer().buffer().targetHint(), Buffer::TargetHint::PixelUnpack);
+        CORRADE_COMPARE(queue.buffer().regionSize(), 256);
+        CORRADE_COMPARE(queue.buffer().regionCount(), 2);
+        CORRADE_COMPARE(queue.submittedCount(), 0);
+        CORRADE_COMPARE(queue.completedCount(), 0);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void TextureUploadQueueGLTest::constructMove() {
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, Vector2i{4});
+
+    TextureUploadQueue a{256};
+    a.upload(texture, 0, {}, ImageView2D{Magnum::PixelFormat::RGBA8Unorm, {2, 2}, Containers::arrayView(SubData2D).exceptPrefix(8)});
+    const GLuint id = a.buffer().buffer().id();
+
+    TextureUploadQueue b{Utility::move(a)};
+    CORRADE_COMPARE(a.buffer().buffer().id(), 0);
+    CORRADE_COMPARE(b.buffer().buffer().id(), id);
+    CORRADE_COMPARE(b.submittedCount(), 1);
+
+    TextureUploadQueue c{128};
+    const GLuint cId = c.buffer().buffer().id();
+    c = Utility::move(b);
+    CORRADE_COMPARE(b.buffer().buffer().id(), cId);
+    CORRADE_COMPARE(b.submittedCount(), 0);
+    CORRADE_COMPARE(c.buffer().buffer().id(), id);
+    CORRADE_COMPARE(c.submittedCount(), 1);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<TextureUploadQueue>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<TextureUploadQueue>::value);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void TextureUploadQueueGLTest::upload2D() {
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, Vector2i{4})
+        .setSubImage(0, {}, ImageView2D{Magnum::PixelFormat::RGBA8Unorm, Vector2i{4}, Containers::arrayView(Zero).prefix(4*4*4)});
+
+    TextureUploadQueue queue{256};
+    CORRADE_COMPARE(queue.upload(texture, 0, Vector2i{1}, ImageView2D{
+        PixelStorage{}.setSkip({0, 1, 0}),
+        Magnum::PixelFormat::RGBA8Unorm, {2, 2}, SubData2D}), 0);
+    CORRADE_COMPARE(queue.submittedCount(), 1);
+    CORRADE_COMPARE(queue.buffer().currentRegionUsedSize(), sizeof(SubData2D));
+
+    /* A second upload is aligned */
+    CORRADE_COMPARE(queue.upload(texture, 0, {}, ImageView2D{
+        Magnum::PixelFormat::RGBA8Unorm, {1, 1}, Containers::arrayView(SubData2D).prefix(4)}), 1);
+    CORRADE_COMPARE(queue.buffer().currentRegionUsedSize(), 32 + 4);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /** @todo How to test this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Image2D image = texture.image(0, {Magnum::PixelFormat::RGBA8Unorm});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE_AS(Containers::arrayCast<UnsignedByte>(image.data()), Containers::arrayView<UnsignedByte>({
+        0xff, 0xff, 0xff, 0xff, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0, 0, 0, 0,
+        0, 0, 0, 0, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+    }), TestSuite::Compare::Container);
+    #endif
+}
+
+void TextureUploadQueueGLTest::upload3D() {
+    Texture3D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, Vector3i{2})
+        .setSubImage(0, {}, ImageView3D{Magnum::PixelFormat::RGBA8Unorm, Vector3i{2}, Containers::arrayView(Zero).prefix(2*2*2*4)});
+
+    TextureUploadQueue queue{256};
+    CORRADE_COMPARE(queue.upload(texture, 0, {0, 0, 1}, ImageView3D{
+        Magnum::PixelFormat::RGBA8Unorm, {2, 2, 1},
+        Containers::arrayView(SubData2D).exceptPrefix(8)}), 0);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /** @todo How to test this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Image3D image = texture.image(0, {Magnum::PixelFormat::RGBA8Unorm});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE_AS(Containers::arrayCast<UnsignedByte>(image.data()).exceptPrefix(16),
+        Containers::arrayView(SubData2D).exceptPrefix(8),
+        TestSuite::Compare::Container);
+    #endif
+}
+
+void TextureUploadQueueGLTest::upload2DArray() {
+    Texture2DArray texture;
+    texture.setStorage(1, TextureFormat::RGBA8, Vector3i{2})
+        .setSubImage(0, {}, ImageView3D{Magnum::PixelFormat::RGBA8Unorm, Vector3i{2}, Containers::arrayView(Zero).prefix(2*2*2*4)});
+
+    TextureUploadQueue queue{256};
+    CORRADE_COMPARE(queue.upload(texture, 0, {0, 0, 1}, ImageView3D{
+        Magnum::PixelFormat::RGBA8Unorm, {2, 2, 1},
+        Containers::arrayView(SubData2D).exceptPrefix(8)}), 0);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /** @todo How to test this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Image3D image = texture.image(0, {Magnum::PixelFormat::RGBA8Unorm});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE_AS(Containers::arrayCast<UnsignedByte>(image.data()).exceptPrefix(16),
+        Containers::arrayView(SubData2D).exceptPrefix(8),
+        TestSuite::Compare::Container);
+    #endif
+}
+
+void TextureUploadQueueGLTest::uploadTooLarge() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, Vector2i{4});
+
+    TextureUploadQueue queue{32};
+    queue.upload(texture, 0, {}, ImageView2D{Magnum::PixelFormat::RGBA8Unorm, {1, 1}, Containers::arrayView(SubData2D).prefix(4)});
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    /* Would fit if the offset wasn't aligned */
+    queue.upload(texture, 0, {}, ImageView2D{
+        PixelStorage{}.setSkip({0, 1, 0}),
+        Magnum::PixelFormat::RGBA8Unorm, {2, 2}, SubData2D});
+    CORRADE_COMPARE(out.str(), "GL::TextureUploadQueue::upload(): can't fit 24 bytes into a region of 32 bytes with 4 bytes already used\n");
+}
+
+void TextureUploadQueueGLTest::completion() {
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, Vector2i{4});
+
+    TextureUploadQueue queue{64};
+    const ImageView2D image{Magnum::PixelFormat::RGBA8Unorm, {2, 2}, Containers::arrayView(SubData2D).exceptPrefix(8)};
+
+    /* Nothing is reported as completed until a fence is placed */
+    const UnsignedLong a = queue.upload(texture, 0, {}, image);
+    const UnsignedLong b = queue.upload(texture, 0, Vector2i{2}, image);
+    Renderer::finish();
+    CORRADE_COMPARE(queue.completedCount(), 0);
+    CORRADE_VERIFY(!queue.isComplete(a));
+
+    queue.nextFrame();
+    const UnsignedLong c = queue.upload(texture, 0, {}, image);
+    Renderer::finish();
+    CORRADE_COMPARE(queue.completedCount(), 2);
+    CORRADE_VERIFY(queue.isComplete(a));
+    CORRADE_VERIFY(queue.isComplete(b));
+    CORRADE_VERIFY(!queue.isComplete(c));
+
+    /* No uploads in this frame, so only the fence for c is placed */
+    queue.nextFrame()
+         .nextFrame();
+    Renderer::finish();
+    CORRADE_COMPARE(queue.completedCount(), 3);
+    CORRADE_VERIFY(queue.isComplete(c));
+    CORRADE_COMPARE(queue.submittedCount(), 3);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::TextureUploadQueueGLTest)
@@ -0,0 +1,101 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureUploadQueue.h"
+
+namespace Magnum { namespace GL { namespace Test { namespace {
+
+struct TextureUploadQueueTest: TestSuite::Tester {
+    explicit TextureUploadQueueTest();
+
+    void constructNoCreate();
+    void constructCopy();
+
+    void uploadNoCreate();
+    void nextFrameNoCreate();
+};
+
+TextureUploadQueueTest::TextureUploadQueueTest() {
+    addTests({&TextureUploadQueueTest::constructNoCreate,
+              &TextureUploadQueueTest::constructCopy,
+
+              &TextureUploadQueueTest::uploadNoCreate,
+              &TextureUploadQueueTest::nextFrameNoCreate});
+}
+
+void TextureUploadQueueTest::constructNoCreate() {
+    {
+        TextureUploadQueue queue{NoCreate};
+        CORRADE_COMPARE(queue.buffer().buffer().id(), 0);
+        CORRADE_COMPARE(queue.buffer().regionCount(), 0);
+        CORRADE_COMPARE(queue.submittedCount(), 0);
+        /* No fences, so this doesn't need a GL context */
+        CORRADE_COMPARE(queue.completedCount(), 0);
+    }
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<NoCreateT, TextureUploadQueue>::value);
+}
+
+void TextureUploadQueueTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<TextureUploadQueue>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<TextureUploadQueue>{});
+}
+
+void TextureUploadQueueTest::uploadNoCreate() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    TextureUploadQueue queue{NoCreate};
+    Texture2D texture{NoCreate};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    const char data[4]{};
+    queue.upload(texture, 0, {}, ImageView2D{Magnum::PixelFormat::RGBA8Unorm, {1, 1}, data});
+    CORRADE_COMPARE(out.str(), "GL::TextureUploadQueue::upload(): the queue is not created\n");
+}
+
+void TextureUploadQueueTest::nextFrameNoCreate() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    TextureUploadQueue queue{NoCreate};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    queue.nextFrame();
+    CORRADE_COMPARE(out.str(), "GL::TextureUploadQueue::nextFrame(): the queue is not created\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::TextureUploadQueueTest)
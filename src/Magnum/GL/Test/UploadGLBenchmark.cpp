@@ -0,0 +1,343 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/Math/Vector2.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/GL/BufferImage.h"
+#endif
+
+namespace Magnum { namespace GL { namespace Test { namespace {
+
+/* Measures buffer and texture upload strategies with three different
+   metrics. The CPU time is how long the application is blocked in the upload
+   calls, which includes any stalls caused by the driver synchronizing with
+   the GPU. The GPU time is what the upload costs on the GPU side. The
+   throughput is measured on the wall clock and includes a glFinish() at the
+   end, so uploads that the driver merely queued are counted as well. */
+struct UploadGLBenchmark: OpenGLTester {
+    explicit UploadGLBenchmark();
+
+    /* The throughput benchmarks rely on each case adding the uploaded amount
+       of data to _bytes during CORRADE_BENCHMARK() */
+    void throughputBegin();
+    std::uint64_t throughputEnd();
+
+    void buffer();
+    void texture();
+
+    private:
+        std::chrono::high_resolution_clock::time_point _begin;
+        std::size_t _bytes;
+};
+
+enum class BufferUpload {
+    SetData,
+    SetSubData,
+    #ifndef MAGNUM_TARGET_WEBGL
+    MapInvalidateBuffer,
+    MapUnsynchronized,
+    #endif
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    StorageSubData,
+    StoragePersistent
+    #endif
+};
+
+enum class TextureUpload {
+    SetImage,
+    SetSubImage,
+    #ifndef MAGNUM_TARGET_GLES2
+    SetSubImageBuffer
+    #endif
+};
+
+/* Each benchmark iteration uploads the whole data, a batch is several
+   iterations in order to amortize the query / clock overhead */
+constexpr std::size_t Iterations = 8;
+constexpr std::size_t BenchmarkRepeats = 10;
+
+const struct {
+    const char* name;
+    BufferUpload upload;
+    std::size_t size;
+} BufferData[]{
+    {"setData(), 4 kB", BufferUpload::SetData, 4*1024},
+    {"setData(), 256 kB", BufferUpload::SetData, 256*1024},
+    {"setData(), 16 MB", BufferUpload::SetData, 16*1024*1024},
+    {"setSubData(), 4 kB", BufferUpload::SetSubData, 4*1024},
+    {"setSubData(), 256 kB", BufferUpload::SetSubData, 256*1024},
+    {"setSubData(), 16 MB", BufferUpload::SetSubData, 16*1024*1024},
+    #ifndef MAGNUM_TARGET_WEBGL
+    {"map() with InvalidateBuffer, 4 kB", BufferUpload::MapInvalidateBuffer, 4*1024},
+    {"map() with InvalidateBuffer, 256 kB", BufferUpload::MapInvalidateBuffer, 256*1024},
+    {"map() with InvalidateBuffer, 16 MB", BufferUpload::MapInvalidateBuffer, 16*1024*1024},
+    {"map() with Unsynchronized, 4 kB", BufferUpload::MapUnsynchronized, 4*1024},
+    {"map() with Unsynchronized, 256 kB", BufferUpload::MapUnsynchronized, 256*1024},
+    {"map() with Unsynchronized, 16 MB", BufferUpload::MapUnsynchronized, 16*1024*1024},
+    #endif
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    {"setStorage() + setSubData(), 4 kB", BufferUpload::StorageSubData, 4*1024},
+    {"setStorage() + setSubData(), 256 kB", BufferUpload::StorageSubData, 256*1024},
+    {"setStorage() + setSubData(), 16 MB", BufferUpload::StorageSubData, 16*1024*1024},
+    {"setStorage() + persistent map(), 4 kB", BufferUpload::StoragePersistent, 4*1024},
+    {"setStorage() + persistent map(), 256 kB", BufferUpload::StoragePersistent, 256*1024},
+    {"setStorage() + persistent map(), 16 MB", BufferUpload::StoragePersistent, 16*1024*1024},
+    #endif
+};
+
+const struct {
+    const char* name;
+    TextureUpload upload;
+    Vector2i size;
+} TextureData[]{
+    /* 4 kB, 256 kB and 16 MB of RGBA8 */
+    {"setImage(), 32x32", TextureUpload::SetImage, {32, 32}},
+    {"setImage(), 256x256", TextureUpload::SetImage, {256, 256}},
+    {"setImage(), 2048x2048", TextureUpload::SetImage, {2048, 2048}},
+    {"setStorage() + setSubImage(), 32x32", TextureUpload::SetSubImage, {32, 32}},
+    {"setStorage() + setSubImage(), 256x256", TextureUpload::SetSubImage, {256, 256}},
+    {"setStorage() + setSubImage(), 2048x2048", TextureUpload::SetSubImage, {2048, 2048}},
+    #ifndef MAGNUM_TARGET_GLES2
+    {"setStorage() + setSubImage() from a BufferImage, 32x32", TextureUpload::SetSubImageBuffer, {32, 32}},
+    {"setStorage() + setSubImage() from a BufferImage, 256x256", TextureUpload::SetSubImageBuffer, {256, 256}},
+    {"setStorage() + setSubImage() from a BufferImage, 2048x2048", TextureUpload::SetSubImageBuffer, {2048, 2048}},
+    #endif
+};
+
+UploadGLBenchmark::UploadGLBenchmark() {
+    /* CPU time to see how long the application stalls in the upload calls,
+       GPU time (which is measured with a GL::TimeQuery) to see what the
+       upload costs on the GPU */
+    for(BenchmarkType type: {BenchmarkType::CpuTime, BenchmarkType::GpuTime}) {
+        addInstancedBenchmarks({&UploadGLBenchmark::buffer},
+            BenchmarkRepeats, Containers::arraySize(BufferData), type);
+
+        addInstancedBenchmarks({&UploadGLBenchmark::texture},
+            BenchmarkRepeats, Containers::arraySize(TextureData), type);
+    }
+
+    /* Run all benchmarks again but measuring the end-to-end throughput */
+    addInstancedCustomBenchmarks({&UploadGLBenchmark::buffer},
+        BenchmarkRepeats, Containers::arraySize(BufferData),
+        &UploadGLBenchmark::throughputBegin,
+        &UploadGLBenchmark::throughputEnd,
+        BenchmarkUnits::Count);
+
+    addInstancedCustomBenchmarks({&UploadGLBenchmark::texture},
+        BenchmarkRepeats, Containers::arraySize(TextureData),
+        &UploadGLBenchmark::throughputBegin,
+        &UploadGLBenchmark::throughputEnd,
+        BenchmarkUnits::Count);
+}
+
+void UploadGLBenchmark::throughputBegin() {
+    setBenchmarkName("MB/s");
+    _bytes = 0;
+    /* Make sure nothing from the setup is still in flight */
+    Renderer::finish();
+    _begin = std::chrono::high_resolution_clock::now();
+}
+
+std::uint64_t UploadGLBenchmark::throughputEnd() {
+    /* Wait until the uploads actually finish, not just get queued */
+    Renderer::finish();
+    const std::uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - _begin).count();
+    /* If the test failed or was too fast to measure, exit early as
+       continuing would cause a division by zero */
+    if(!ns) return {};
+
+    /* Bytes per nanosecond is GB/s, multiplied by 1000 to get MB/s */
+    return _bytes*1000ull/ns;
+}
+
+void UploadGLBenchmark::buffer() {
+    auto&& data = BufferData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(data.upload == BufferUpload::MapInvalidateBuffer ||
+       data.upload == BufferUpload::MapUnsynchronized) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(!Context::current().isExtensionSupported<Extensions::ARB::map_buffer_range>())
+            CORRADE_SKIP(Extensions::ARB::map_buffer_range::string() << "is not supported.");
+        #elif defined(MAGNUM_TARGET_GLES2)
+        if(!Context::current().isExtensionSupported<Extensions::EXT::map_buffer_range>())
+            CORRADE_SKIP(Extensions::EXT::map_buffer_range::string() << "is not supported.");
+        #endif
+    }
+    #endif
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(data.upload == BufferUpload::StorageSubData ||
+       data.upload == BufferUpload::StoragePersistent) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(!Context::current().isExtensionSupported<Extensions::ARB::buffer_storage>())
+            CORRADE_SKIP(Extensions::ARB::buffer_storage::string() << "is not supported.");
+        #else
+        if(!Context::current().isExtensionSupported<Extensions::EXT::buffer_storage>())
+            CORRADE_SKIP(Extensions::EXT::buffer_storage::string() << "is not supported.");
+        #endif
+    }
+    #endif
+
+    Containers::Array<char> src{NoInit, data.size};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = char(i*7);
+
+    /* Allocate the buffer upfront for all strategies except setData(), which
+       is expected to reallocate on every call */
+    Buffer buffer;
+    Containers::ArrayView<char> persistent;
+    switch(data.upload) {
+        case BufferUpload::SetData:
+            break;
+        case BufferUpload::SetSubData:
+        #ifndef MAGNUM_TARGET_WEBGL
+        case BufferUpload::MapInvalidateBuffer:
+        case BufferUpload::MapUnsynchronized:
+        #endif
+            buffer.setData({nullptr, data.size}, BufferUsage::StreamDraw);
+            break;
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        case BufferUpload::StorageSubData:
+            buffer.setStorage(data.size, Buffer::StorageFlag::DynamicStorage);
+            break;
+        case BufferUpload::StoragePersistent:
+            buffer.setStorage(data.size, Buffer::StorageFlag::MapWrite|Buffer::StorageFlag::MapPersistent|Buffer::StorageFlag::MapCoherent);
+            persistent = buffer.map(0, data.size, Buffer::MapFlag::Write|Buffer::MapFlag::Persistent|Buffer::MapFlag::Coherent);
+            CORRADE_VERIFY(persistent.data());
+            break;
+        #endif
+    }
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_BENCHMARK(Iterations) {
+        switch(data.upload) {
+            case BufferUpload::SetData:
+                buffer.setData(src, BufferUsage::StreamDraw);
+                break;
+            case BufferUpload::SetSubData:
+            #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+            case BufferUpload::StorageSubData:
+            #endif
+                buffer.setSubData(0, src);
+                break;
+            #ifndef MAGNUM_TARGET_WEBGL
+            case BufferUpload::MapInvalidateBuffer:
+            case BufferUpload::MapUnsynchronized: {
+                Containers::ArrayView<char> mapped = buffer.map(0, data.size, Buffer::MapFlag::Write|(data.upload == BufferUpload::MapInvalidateBuffer ? Buffer::MapFlag::InvalidateBuffer : Buffer::MapFlag::Unsynchronized));
+                std::memcpy(mapped.data(), src.data(), data.size);
+                buffer.unmap();
+            } break;
+            #endif
+            #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+            /* With a coherent mapping the copy is all that's needed. A real
+               application would have to fence to not overwrite data the GPU
+               is still reading from, which isn't measured here. */
+            case BufferUpload::StoragePersistent:
+                std::memcpy(persistent.data(), src.data(), data.size);
+                break;
+            #endif
+        }
+
+        _bytes += data.size;
+    }
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(persistent.data()) buffer.unmap();
+    #endif
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void UploadGLBenchmark::texture() {
+    auto&& data = TextureData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef MAGNUM_TARGET_GLES2
+    constexpr TextureFormat format = TextureFormat::RGBA8;
+    #else
+    constexpr TextureFormat format = TextureFormat::RGBA;
+    #endif
+
+    const std::size_t size = 4*data.size.product();
+    Containers::Array<char> src{NoInit, size};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = char(i*7);
+    const ImageView2D image{PixelFormat::RGBA8Unorm, data.size, src};
+
+    /* Allocate the storage upfront for all strategies except setImage(),
+       which is expected to reallocate on every call */
+    Texture2D texture;
+    if(data.upload != TextureUpload::SetImage)
+        texture.setStorage(1, format, data.size);
+    #ifndef MAGNUM_TARGET_GLES2
+    BufferImage2D bufferImage{NoCreate};
+    if(data.upload == TextureUpload::SetSubImageBuffer)
+        bufferImage = BufferImage2D{PixelFormat::RGBA8Unorm, data.size, src, BufferUsage::StreamDraw};
+    #endif
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_BENCHMARK(Iterations) {
+        switch(data.upload) {
+            case TextureUpload::SetImage:
+                texture.setImage(0, format, image);
+                break;
+            case TextureUpload::SetSubImage:
+                texture.setSubImage(0, {}, image);
+                break;
+            #ifndef MAGNUM_TARGET_GLES2
+            /* Includes the upload to the pixel buffer, otherwise it'd be
+               just a GPU-side copy */
+            case TextureUpload::SetSubImageBuffer:
+                bufferImage.setData(PixelFormat::RGBA8Unorm, data.size, src, BufferUsage::StreamDraw);
+                texture.setSubImage(0, {}, bufferImage);
+                break;
+            #endif
+        }
+
+        _bytes += size;
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::GL::Test::UploadGLBenchmark)
@@ -157,6 +157,45 @@ Texture: public AbstractTexture {
         static Int compressedBlockDataSize(TextureFormat format) {
             return AbstractTexture::compressedBlockDataSize(Implementation::textureTarget<dimensions>(), format);
         }
+
+        /**
+         * @brief Count of virtual page sizes for sparse textures
+         * @m_since_latest
+         *
+         * Returns count of virtual page sizes available for given @p format,
+         * zero if the format can't be used for sparse textures.
+         * @see @ref virtualPageSize(), @ref setSparse(),
+         *      @fn_gl_keyword{GetInternalformat} with
+         *      @def_gl_extension{NUM_VIRTUAL_PAGE_SIZES,ARB,sparse_texture}
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        static Int virtualPageSizeCount(TextureFormat format) {
+            return AbstractTexture::virtualPageSizeCount(Implementation::textureTarget<dimensions>(), format);
+        }
+
+        /**
+         * @brief Virtual page size for sparse textures
+         * @m_since_latest
+         *
+         * Returns size of a virtual page at given @p index for given
+         * @p format. Expects that @p index is less than
+         * @ref virtualPageSizeCount(). Offsets and sizes passed to
+         * @ref commitPages() and @ref uncommitPages() are expected to be
+         * multiples of the page size selected in @ref setSparse(). Suitable
+         * as a tile size for a @ref TiledImageView for streaming the data.
+         * @see @fn_gl_keyword{GetInternalformat} with
+         *      @def_gl_extension{VIRTUAL_PAGE_SIZE_X,ARB,sparse_texture},
+         *      @def_gl_extension{VIRTUAL_PAGE_SIZE_Y,ARB,sparse_texture} and
+         *      @def_gl_extension{VIRTUAL_PAGE_SIZE_Z,ARB,sparse_texture}
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        static VectorTypeFor<dimensions, Int> virtualPageSize(TextureFormat format, Int index = 0) {
+            return Math::Vector<dimensions, Int>::from(AbstractTexture::virtualPageSize(Implementation::textureTarget<dimensions>(), format, index).data());
+        }
         #endif
 
         #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
@@ -1487,6 +1526,87 @@ Texture: public AbstractTexture {
             DataHelper<dimensions>::invalidateSubImage(*this, level, offset, size);
         }
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Make the texture sparse
+         * @param sparse                Whether the texture is sparse
+         * @param virtualPageSizeIndex  Index of the virtual page size
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Has to be called before @ref setStorage(). Storage of a sparse
+         * texture is only virtually allocated, with physical memory being
+         * allocated and released per page using @ref commitPages() and
+         * @ref uncommitPages(). The @p virtualPageSizeIndex is expected to
+         * be less than @ref virtualPageSizeCount() for the format passed to
+         * @ref setStorage(). If @gl_extension{ARB,direct_state_access} (part
+         * of OpenGL 4.5) is not available, the texture is bound before the
+         * operation (if not already).
+         *
+         * @snippet GL.cpp Texture-sparse
+         *
+         * @see @ref virtualPageSize(),
+         *      @fn_gl2_keyword{TextureParameter,TexParameter},
+         *      eventually @fn_gl{ActiveTexture}, @fn_gl{BindTexture} and
+         *      @fn_gl_keyword{TexParameter} with
+         *      @def_gl_extension{TEXTURE_SPARSE,ARB,sparse_texture} and
+         *      @def_gl_extension{VIRTUAL_PAGE_SIZE_INDEX,ARB,sparse_texture}
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        Texture<dimensions>& setSparse(bool sparse, Int virtualPageSizeIndex = 0) {
+            AbstractTexture::setSparse(sparse, virtualPageSizeIndex);
+            return *this;
+        }
+
+        /**
+         * @brief Commit physical memory for sparse texture pages
+         * @param level             Mip level
+         * @param offset            Offset into the texture
+         * @param size              Size of committed region
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that the texture was made sparse with @ref setSparse()
+         * and that @p offset and @p size are multiples of the
+         * @ref virtualPageSize() or extend to the edge of the level. Data
+         * in committed pages are undefined until uploaded with
+         * @ref setSubImage(). The texture is bound before the operation (if
+         * not already).
+         * @see @ref uncommitPages(), @fn_gl{ActiveTexture},
+         *      @fn_gl{BindTexture} and @fn_gl_extension_keyword{TexPageCommitment,ARB,sparse_texture}
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        Texture<dimensions>& commitPages(Int level, const VectorTypeFor<dimensions, Int>& offset, const VectorTypeFor<dimensions, Int>& size) {
+            setPageCommitmentInternal(level, Vector3i::pad(offset, 0), Vector3i::pad(size, 1), true);
+            return *this;
+        }
+
+        /**
+         * @brief Release physical memory of sparse texture pages
+         * @param level             Mip level
+         * @param offset            Offset into the texture
+         * @param size              Size of the released region
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Counterpart to @ref commitPages(), with the same expectations.
+         * Data in the released pages are lost.
+         * @see @fn_gl{ActiveTexture}, @fn_gl{BindTexture} and
+         *      @fn_gl_extension_keyword{TexPageCommitment,ARB,sparse_texture}
+         * @requires_extension Extension @gl_extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        Texture<dimensions>& uncommitPages(Int level, const VectorTypeFor<dimensions, Int>& offset, const VectorTypeFor<dimensions, Int>& size) {
+            setPageCommitmentInternal(level, Vector3i::pad(offset, 0), Vector3i::pad(size, 1), false);
+            return *this;
+        }
+        #endif
+
         /* Overloads to remove WTF-factor from method chaining order */
         #if !defined(DOXYGEN_GENERATING_OUTPUT) && !defined(MAGNUM_TARGET_WEBGL)
         Texture<dimensions>& setLabel(Containers::StringView label);
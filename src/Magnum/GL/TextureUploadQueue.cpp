@@ -0,0 +1,146 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TextureUploadQueue.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/PixelFormat.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureArray.h"
+#include "Magnum/GL/Implementation/RendererState.h"
+#include "Magnum/GL/Implementation/State.h"
+#include "Magnum/GL/Implementation/TextureState.h"
+
+namespace Magnum { namespace GL {
+
+namespace {
+    /* Pixel unpack buffer offsets have to be a multiple of the pixel type
+       size, which is at most 8 bytes for
+       PixelType::Float32UnsignedInt248Rev. Use 16 to be on the safe side. */
+    constexpr std::size_t StagingAlignment = 16;
+}
+
+TextureUploadQueue::TextureUploadQueue(const std::size_t regionSize, const UnsignedInt regionCount): _buffer{Buffer::TargetHint::PixelUnpack, regionSize, regionCount}, _submittedCount{}, _fencedCount{}, _completedCount{}, _fences{DirectInit, regionCount, NoCreate}, _fenceCounts{ValueInit, regionCount} {}
+
+TextureUploadQueue::TextureUploadQueue(NoCreateT) noexcept: _buffer{NoCreate}, _submittedCount{}, _fencedCount{}, _completedCount{} {}
+
+TextureUploadQueue::TextureUploadQueue(TextureUploadQueue&& other) noexcept: _buffer{Utility::move(other._buffer)}, _submittedCount{other._submittedCount}, _fencedCount{other._fencedCount}, _completedCount{other._completedCount}, _fences{Utility::move(other._fences)}, _fenceCounts{Utility::move(other._fenceCounts)} {}
+
+TextureUploadQueue::~TextureUploadQueue() = default;
+
+TextureUploadQueue& TextureUploadQueue::operator=(TextureUploadQueue&& other) noexcept {
+    using Utility::swap;
+    swap(_buffer, other._buffer);
+    swap(_submittedCount, other._submittedCount);
+    swap(_fencedCount, other._fencedCount);
+    swap(_completedCount, other._completedCount);
+    swap(_fences, other._fences);
+    swap(_fenceCounts, other._fenceCounts);
+    return *this;
+}
+
+UnsignedLong TextureUploadQueue::completedCount() {
+    /* Fences get signaled in order, so the completed count is given by the
+       newest signaled fence. Older pending fences are implicitly signaled as
+       well, but it's not a problem to check them again. */
+    for(std::size_t i = 0; i != _fences.size(); ++i) {
+        Fence& fence = _fences[i];
+        if(!fence.id() || !fence.isSignaled()) continue;
+
+        if(_fenceCounts[i] > _completedCount)
+            _completedCount = _fenceCounts[i];
+        fence = Fence{NoCreate};
+    }
+
+    return _completedCount;
+}
+
+std::size_t TextureUploadQueue::stage(const Containers::ArrayView<const void> data) {
+    /* Check here to have a more helpful message than what StreamingBuffer
+       would print */
+    const std::size_t regionOffset = _buffer.currentRegion()*_buffer.regionSize();
+    const std::size_t offset = (regionOffset + _buffer.currentRegionUsedSize() + StagingAlignment - 1) & ~(StagingAlignment - 1);
+    CORRADE_ASSERT(offset + data.size() <= regionOffset + _buffer.regionSize(),
+        "GL::TextureUploadQueue::upload(): can't fit" << data.size() << "bytes into a region of" << _buffer.regionSize() << "bytes with" << _buffer.currentRegionUsedSize() << "bytes already used", {});
+
+    const std::size_t out = _buffer.write(data, StagingAlignment);
+    _buffer.buffer().bindInternal(Buffer::TargetHint::PixelUnpack);
+    return out;
+}
+
+UnsignedLong TextureUploadQueue::upload(Texture2D& texture, const Int level, const Vector2i& offset, const ImageView2D& image) {
+    CORRADE_ASSERT(_buffer.regionCount(),
+        "GL::TextureUploadQueue::upload(): the queue is not created", {});
+
+    const std::size_t bufferOffset = stage(image.data());
+    Context::current().state().renderer.applyPixelStorageUnpack(image.storage());
+    Context::current().state().texture.subImage2DImplementation(texture, level, offset, image.size(), pixelFormat(image.format()), pixelType(image.format(), image.formatExtra()), reinterpret_cast<const GLvoid*>(bufferOffset), image.storage());
+    return _submittedCount++;
+}
+
+UnsignedLong TextureUploadQueue::upload(Texture3D& texture, const Int level, const Vector3i& offset, const ImageView3D& image) {
+    CORRADE_ASSERT(_buffer.regionCount(),
+        "GL::TextureUploadQueue::upload(): the queue is not created", {});
+
+    const std::size_t bufferOffset = stage(image.data());
+    Context::current().state().renderer.applyPixelStorageUnpack(image.storage());
+    Context::current().state().texture.subImage3DImplementation(texture, level, offset, image.size(), pixelFormat(image.format()), pixelType(image.format(), image.formatExtra()), reinterpret_cast<const GLvoid*>(bufferOffset), image.storage());
+    return _submittedCount++;
+}
+
+UnsignedLong TextureUploadQueue::upload(Texture2DArray& texture, const Int level, const Vector3i& offset, const ImageView3D& image) {
+    CORRADE_ASSERT(_buffer.regionCount(),
+        "GL::TextureUploadQueue::upload(): the queue is not created", {});
+
+    const std::size_t bufferOffset = stage(image.data());
+    Context::current().state().renderer.applyPixelStorageUnpack(image.storage());
+    Context::current().state().texture.subImage3DImplementation(texture, level, offset, image.size(), pixelFormat(image.format()), pixelType(image.format(), image.formatExtra()), reinterpret_cast<const GLvoid*>(bufferOffset), image.storage());
+    return _submittedCount++;
+}
+
+TextureUploadQueue& TextureUploadQueue::nextFrame() {
+    CORRADE_ASSERT(_buffer.regionCount(),
+        "GL::TextureUploadQueue::nextFrame(): the queue is not created", *this);
+
+    /* Place a fence only if there were any uploads since the last one. If
+       the slot still has a pending fence from regionCount() frames ago, the
+       new one will get signaled after it, so it can be discarded. */
+    if(_submittedCount != _fencedCount) {
+        const UnsignedInt slot = _buffer.currentRegion();
+        _fences[slot] = Fence{};
+        _fenceCounts[slot] = _fencedCount = _submittedCount;
+    }
+
+    _buffer.nextFrame();
+    return *this;
+}
+
+}}
+#endif
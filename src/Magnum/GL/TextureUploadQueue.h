@@ -0,0 +1,218 @@
+#ifndef Magnum_GL_TextureUploadQueue_h
+#define Magnum_GL_TextureUploadQueue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::GL::TextureUploadQueue
+ * @m_since_latest
+ */
+#endif
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/GL/StreamingBuffer.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum { namespace GL {
+
+/**
+@brief Asynchronous texture upload queue
+@m_since_latest
+
+A plain @ref Texture::setSubImage() call with an @ref ImageView makes the
+driver copy the pixel data before returning, which for large images stalls the
+calling thread. This class instead copies the data into a
+@ref StreamingBuffer bound as a pixel unpack buffer and issues the upload from
+there, letting the GPU perform the actual transfer asynchronously. Each
+@ref upload() returns a monotonically increasing ID, and @ref nextFrame()
+places a fence sync object after all uploads issued in given frame. Completion
+can be then queried without blocking with @ref isComplete() or
+@ref completedCount():
+
+@snippet GL.cpp TextureUploadQueue-usage
+
+The staging memory is split into @ref StreamingBuffer::regionCount() regions
+of @ref StreamingBuffer::regionSize() bytes, see the @ref StreamingBuffer
+documentation for details about how each region is reused. All images
+uploaded in a single frame have to fit into one region, you can check the
+remaining space using @ref StreamingBuffer::currentRegionUsedSize() of
+@ref buffer() and postpone the rest of the uploads to the next frame.
+
+Compressed images are not supported at the moment.
+@requires_gles30 Pixel unpack buffers and fence sync objects are not
+    available in OpenGL ES 2.0.
+@requires_gles Buffer mapping is not available in WebGL.
+*/
+class MAGNUM_GL_EXPORT TextureUploadQueue {
+    public:
+        /**
+         * @brief Constructor
+         * @param regionSize    Size of staging memory available for uploads
+         *      in a single frame
+         * @param regionCount   Region count
+         *
+         * Creates a @ref StreamingBuffer with
+         * @ref Buffer::TargetHint::PixelUnpack and given @p regionSize and
+         * @p regionCount.
+         */
+        explicit TextureUploadQueue(std::size_t regionSize, UnsignedInt regionCount = 3);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL objects
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         * However note that this is a low-level and a potentially dangerous
+         * API, see the documentation of @ref NoCreate for alternatives.
+         */
+        explicit TextureUploadQueue(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        TextureUploadQueue(const TextureUploadQueue&) = delete;
+
+        /** @brief Move constructor */
+        TextureUploadQueue(TextureUploadQueue&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes all fence sync objects and the staging buffer. Uploads that
+         * are still in progress are not affected.
+         */
+        ~TextureUploadQueue();
+
+        /** @brief Copying is not allowed */
+        TextureUploadQueue& operator=(const TextureUploadQueue&) = delete;
+
+        /** @brief Move assignment */
+        TextureUploadQueue& operator=(TextureUploadQueue&&) noexcept;
+
+        /** @brief Staging buffer */
+        StreamingBuffer& buffer() { return _buffer; }
+        const StreamingBuffer& buffer() const { return _buffer; } /**< @overload */
+
+        /**
+         * @brief Count of submitted uploads
+         *
+         * Count of all @ref upload() calls so far. The ID returned from the
+         * next @ref upload() call is equal to this value.
+         */
+        UnsignedLong submittedCount() const { return _submittedCount; }
+
+        /**
+         * @brief Count of completed uploads
+         *
+         * Checks fence sync objects placed by @ref nextFrame() without
+         * waiting and returns the count of uploads that are known to be
+         * completed by the GPU. Uploads issued in the current frame are
+         * never reported as completed until @ref nextFrame() is called.
+         * @see @ref isComplete()
+         */
+        UnsignedLong completedCount();
+
+        /**
+         * @brief Whether an upload is completed
+         *
+         * Equivalent to checking that @p id is less than
+         * @ref completedCount().
+         */
+        bool isComplete(UnsignedLong id) { return id < completedCount(); }
+
+        /**
+         * @brief Upload an image to a 2D texture
+         * @param texture       Texture to upload to
+         * @param level         Mip level
+         * @param offset        Offset where to put the data in the texture
+         * @param image         Image
+         * @return Upload ID, to be passed to @ref isComplete()
+         *
+         * Copies the image data including its @ref PixelStorage padding
+         * to the current region of @ref buffer() and calls the equivalent
+         * of @ref Texture::setSubImage() with the buffer bound as a pixel
+         * unpack buffer. Expects that the data fit into the remaining space
+         * of the current region. The @p image can be discarded right after
+         * this function returns.
+         * @see @fn_gl_keyword{BindBuffer} with @def_gl{PIXEL_UNPACK_BUFFER},
+         *      @fn_gl2_keyword{TextureSubImage2D,TexSubImage2D},
+         *      @fn_gl_extension{TextureSubImage2D,EXT,direct_state_access},
+         *      eventually @fn_gl{ActiveTexture}, @fn_gl{BindTexture} and
+         *      @fn_gl_keyword{TexSubImage2D}
+         */
+        UnsignedLong upload(Texture2D& texture, Int level, const Vector2i& offset, const ImageView2D& image);
+
+        /**
+         * @brief Upload an image to a 3D texture
+         *
+         * Same as @ref upload(Texture2D&, Int, const Vector2i&, const ImageView2D&)
+         * but calling the equivalent of @ref Texture::setSubImage() on a 3D
+         * texture.
+         */
+        UnsignedLong upload(Texture3D& texture, Int level, const Vector3i& offset, const ImageView3D& image);
+
+        /**
+         * @brief Upload an image to a 2D array texture
+         *
+         * Same as @ref upload(Texture2D&, Int, const Vector2i&, const ImageView2D&)
+         * but calling the equivalent of @ref TextureArray::setSubImage() on
+         * a 2D array texture.
+         */
+        UnsignedLong upload(Texture2DArray& texture, Int level, const Vector3i& offset, const ImageView3D& image);
+
+        /**
+         * @brief Switch to the next frame
+         * @return Reference to self (for method chaining)
+         *
+         * If any uploads were issued since the last call, places a fence
+         * sync object after them, which is then checked in
+         * @ref completedCount(). Then calls @ref StreamingBuffer::nextFrame()
+         * on @ref buffer().
+         */
+        TextureUploadQueue& nextFrame();
+
+    private:
+        MAGNUM_GL_LOCAL std::size_t stage(Containers::ArrayView<const void> data);
+
+        StreamingBuffer _buffer;
+        UnsignedLong _submittedCount, _fencedCount, _completedCount;
+        /* One fence per region, together with the submitted count it
+           corresponds to */
+        Containers::Array<Fence> _fences;
+        Containers::Array<UnsignedLong> _fenceCounts;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL build
+#endif
+
+#endif
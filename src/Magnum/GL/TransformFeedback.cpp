@@ -38,6 +38,7 @@
 #include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Implementation/ContextState.h"
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Magnum/GL/Implementation/DebugState.h"
 #endif
@@ -142,12 +143,17 @@ TransformFeedback::~TransformFeedback() {
 }
 
 void TransformFeedback::bindInternal() {
-    GLuint& bound = Context::current().state().transformFeedback.binding;
+    Implementation::State& state = Context::current().state();
+    GLuint& bound = state.transformFeedback.binding;
 
     /* Already bound, nothing to do */
-    if(bound == _id) return;
+    if(bound == _id) {
+        ++state.context.statistics.bindSkippedCount;
+        return;
+    }
 
     /* Bind the transform feedback otherwise, which will also finally create it */
+    ++state.context.statistics.bindCount;
     bound = _id;
     _flags |= ObjectFlag::Created;
     glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, _id);
@@ -0,0 +1,211 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ImageDataPool.h"
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <Corrade/Containers/GrowableArray.h>
+
+namespace Magnum {
+
+namespace {
+
+/* Allocations up to 4 kB all go to the first size class, then there's four
+   size classes for each power of two */
+constexpr std::size_t MinSizeLog2 = 12;
+constexpr std::size_t SizeClassCount = (sizeof(std::size_t)*8 - MinSizeLog2)*4;
+
+std::size_t sizeClassSize(const std::size_t sizeClass) {
+    return (4 + sizeClass%4) << (MinSizeLog2 + sizeClass/4 - 2);
+}
+
+std::size_t sizeClassFor(const std::size_t size) {
+    if(size <= (std::size_t{1} << MinSizeLog2))
+        return 0;
+
+    std::size_t log2 = 0;
+    for(std::size_t i = size; i >>= 1; ) ++log2;
+
+    const std::size_t step = std::size_t{1} << (log2 - 2);
+    const std::size_t steps = (size + step - 1)/step;
+    /* Rounded up to the next power of two */
+    if(steps == 8)
+        return (log2 + 1 - MinSizeLog2)*4;
+    return (log2 - MinSizeLog2)*4 + steps - 4;
+}
+
+}
+
+namespace Implementation {
+
+struct ImageDataPoolState {
+    std::mutex mutex;
+    Containers::Array<char*> freeBlocks[SizeClassCount];
+    std::size_t maxCachedSize = 256*1024*1024;
+    std::size_t cachedSize = 0;
+    std::size_t allocationCount = 0;
+    std::size_t reuseCount = 0;
+    /* Set when the pool is destroyed with live allocations, the last of
+       them then deletes the state */
+    bool orphaned = false;
+};
+
+}
+
+namespace {
+
+/* Stored in front of each allocation so the deleter knows where to put the
+   memory back. Padded to keep the data aligned. */
+struct Header {
+    Implementation::ImageDataPoolState* state;
+    std::size_t sizeClass;
+};
+
+constexpr std::size_t HeaderSize = (sizeof(Header) + alignof(std::max_align_t) - 1)/alignof(std::max_align_t)*alignof(std::max_align_t);
+
+/* Expects the mutex to be locked */
+void evict(Implementation::ImageDataPoolState& state, const std::size_t maxCachedSize) {
+    /* Free the largest blocks first */
+    for(std::size_t i = SizeClassCount; i != 0 && state.cachedSize > maxCachedSize; --i) {
+        Containers::Array<char*>& blocks = state.freeBlocks[i - 1];
+        while(!blocks.isEmpty() && state.cachedSize > maxCachedSize) {
+            delete[] blocks.back();
+            arrayRemoveSuffix(blocks);
+            state.cachedSize -= sizeClassSize(i - 1);
+        }
+    }
+}
+
+void deleter(char* const data, std::size_t) {
+    char* const block = data - HeaderSize;
+    const Header& header = *reinterpret_cast<const Header*>(block);
+    Implementation::ImageDataPoolState& state = *header.state;
+    const std::size_t size = sizeClassSize(header.sizeClass);
+
+    std::unique_lock<std::mutex> lock{state.mutex};
+    --state.allocationCount;
+    if(!state.orphaned && state.cachedSize + size <= state.maxCachedSize) {
+        arrayAppend(state.freeBlocks[header.sizeClass], block);
+        state.cachedSize += size;
+        return;
+    }
+
+    const bool deleteState = state.orphaned && !state.allocationCount;
+    lock.unlock();
+    delete[] block;
+    if(deleteState) delete &state;
+}
+
+}
+
+ImageDataPool::ImageDataPool(): _state{new Implementation::ImageDataPoolState} {}
+
+ImageDataPool::ImageDataPool(ImageDataPool&& other) noexcept: _state{other._state} {
+    other._state = nullptr;
+}
+
+ImageDataPool::~ImageDataPool() {
+    if(!_state) return;
+
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    evict(*_state, 0);
+    if(_state->allocationCount) {
+        _state->orphaned = true;
+        return;
+    }
+
+    lock.unlock();
+    delete _state;
+}
+
+ImageDataPool& ImageDataPool::operator=(ImageDataPool&& other) noexcept {
+    std::swap(_state, other._state);
+    return *this;
+}
+
+std::size_t ImageDataPool::maxCachedSize() const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    return _state->maxCachedSize;
+}
+
+ImageDataPool& ImageDataPool::setMaxCachedSize(const std::size_t size) {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    _state->maxCachedSize = size;
+    evict(*_state, size);
+    return *this;
+}
+
+std::size_t ImageDataPool::cachedSize() const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    return _state->cachedSize;
+}
+
+std::size_t ImageDataPool::allocationCount() const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    return _state->allocationCount;
+}
+
+std::size_t ImageDataPool::reuseCount() const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    return _state->reuseCount;
+}
+
+Containers::Array<char> ImageDataPool::allocate(const std::size_t size) {
+    if(!size) return {};
+
+    const std::size_t sizeClass = sizeClassFor(size);
+    char* block = nullptr;
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        ++_state->allocationCount;
+        Containers::Array<char*>& blocks = _state->freeBlocks[sizeClass];
+        if(!blocks.isEmpty()) {
+            block = blocks.back();
+            arrayRemoveSuffix(blocks);
+            _state->cachedSize -= sizeClassSize(sizeClass);
+            ++_state->reuseCount;
+        }
+    }
+
+    /* Allocate outside of the lock to not block other threads */
+    if(!block) {
+        block = new char[HeaderSize + sizeClassSize(sizeClass)];
+        new(block) Header{_state, sizeClass};
+    }
+
+    return Containers::Array<char>{block + HeaderSize, size, deleter};
+}
+
+ImageDataPool& ImageDataPool::trim() {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    evict(*_state, 0);
+    return *this;
+}
+
+}
@@ -0,0 +1,157 @@
+#ifndef Magnum_ImageDataPool_h
+#define Magnum_ImageDataPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::ImageDataPool
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+namespace Implementation { struct ImageDataPoolState; }
+
+/**
+@brief Pool of image data allocations
+@m_since_latest
+
+Allocates memory for image data in a set of size classes and, once the
+allocation is freed, keeps it around for reuse by a subsequent allocation
+of the same size class. Useful for workflows that create and destroy many
+images of similar sizes, such as texture streaming, where the general-purpose
+allocator would otherwise show up in profiles.
+
+@section ImageDataPool-usage Usage
+
+Memory is allocated with @ref allocate(), which returns a
+@relativeref{Corrade,Containers::Array} with a custom deleter. The array
+can be then passed to any @ref Image, @ref CompressedImage or
+@ref Trade::ImageData constructor, and once the image is destroyed or its
+data released and freed, the memory goes back to the pool:
+
+@snippet Magnum.cpp ImageDataPool-usage
+
+Size classes are spaced at quarters of a power of two, so at most 25% of
+each allocation is wasted. Allocations smaller than 4 kB are all put into
+the smallest size class. The amount of memory kept in the pool is limited by
+@ref setMaxCachedSize(), memory over the limit is freed immediately, and all
+cached memory can be released with @ref trim().
+
+@section ImageDataPool-threads Thread safety
+
+The pool is guarded by a mutex, so allocations can be made and freed from
+multiple threads at the same time. The pool can be destroyed while there are
+still live allocations, the memory then gets freed directly once the arrays
+are destroyed.
+*/
+class MAGNUM_EXPORT ImageDataPool {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * The max cached size is initially set to 256 MB.
+         */
+        explicit ImageDataPool();
+
+        /** @brief Copying is not allowed */
+        ImageDataPool(const ImageDataPool&) = delete;
+
+        /** @brief Move constructor */
+        ImageDataPool(ImageDataPool&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Frees all cached memory. Memory of live allocations is freed once
+         * the corresponding arrays are destroyed.
+         */
+        ~ImageDataPool();
+
+        /** @brief Copying is not allowed */
+        ImageDataPool& operator=(const ImageDataPool&) = delete;
+
+        /** @brief Move assignment */
+        ImageDataPool& operator=(ImageDataPool&& other) noexcept;
+
+        /** @brief Max size of memory kept in the pool for reuse, in bytes */
+        std::size_t maxCachedSize() const;
+
+        /**
+         * @brief Set max size of memory kept in the pool for reuse
+         * @return Reference to self (for method chaining)
+         *
+         * If more memory than @p size is currently cached, the excess is
+         * freed. Allocations freed after the limit was reached are freed
+         * directly instead of being put back into the pool.
+         */
+        ImageDataPool& setMaxCachedSize(std::size_t size);
+
+        /** @brief Size of memory currently kept in the pool for reuse, in bytes */
+        std::size_t cachedSize() const;
+
+        /** @brief Count of live allocations */
+        std::size_t allocationCount() const;
+
+        /**
+         * @brief Count of allocations that reused pooled memory
+         *
+         * Counts all allocations since the pool was created, useful for
+         * checking the pool effectiveness.
+         */
+        std::size_t reuseCount() const;
+
+        /**
+         * @brief Allocate memory
+         *
+         * Returns a @relativeref{Corrade,Containers::Array} of @p size bytes
+         * with uninitialized contents and a custom deleter that puts the
+         * memory back into the pool. The memory is aligned to
+         * @cpp alignof(std::max_align_t) @ce. If @p size is zero, returns an
+         * empty array without any allocation.
+         */
+        Containers::Array<char> allocate(std::size_t size);
+
+        /**
+         * @brief Free all memory kept in the pool for reuse
+         * @return Reference to self (for method chaining)
+         *
+         * Doesn't affect live allocations.
+         */
+        ImageDataPool& trim();
+
+    private:
+        Implementation::ImageDataPoolState* _state;
+};
+
+}
+
+#endif
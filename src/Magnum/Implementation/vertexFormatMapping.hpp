@@ -135,4 +135,7 @@ _c(Matrix4x2bNormalizedAligned)
 _c(Matrix4x3hAligned)
 _c(Matrix4x3bNormalizedAligned)
 _c(Matrix4x3sNormalizedAligned)
+_c(Vector3i1010102Normalized)
+_c(Vector4i1010102Normalized)
+_c(Vector4ui1010102Normalized)
 #endif
@@ -939,6 +939,24 @@ typedef Math::Range3D<Int> Range3Di;
 /** @brief Float frustum */
 typedef Math::Frustum<Float> Frustum;
 
+/**
+@brief Two-component float structure-of-arrays vector container
+@m_since_latest
+*/
+typedef Math::Vector2SoA<Float> Vector2SoA;
+
+/**
+@brief Three-component float structure-of-arrays vector container
+@m_since_latest
+*/
+typedef Math::Vector3SoA<Float> Vector3SoA;
+
+/**
+@brief Four-component float structure-of-arrays vector container
+@m_since_latest
+*/
+typedef Math::Vector4SoA<Float> Vector4SoA;
+
 /**
 @brief 64-bit signed integer nanoseconds
 @m_since_latest
@@ -1357,6 +1375,16 @@ typedef BasicMutableCompressedImageView<1> MutableCompressedImageView1D;
 typedef BasicMutableCompressedImageView<2> MutableCompressedImageView2D;
 typedef BasicMutableCompressedImageView<3> MutableCompressedImageView3D;
 
+template<UnsignedInt, class> class TiledImageView;
+template<UnsignedInt dimensions> using BasicTiledImageView = TiledImageView<dimensions, const char>;
+typedef BasicTiledImageView<1> TiledImageView1D;
+typedef BasicTiledImageView<2> TiledImageView2D;
+typedef BasicTiledImageView<3> TiledImageView3D;
+template<UnsignedInt dimensions> using BasicMutableTiledImageView = TiledImageView<dimensions, char>;
+typedef BasicMutableTiledImageView<1> MutableTiledImageView1D;
+typedef BasicMutableTiledImageView<2> MutableTiledImageView2D;
+typedef BasicMutableTiledImageView<3> MutableTiledImageView3D;
+
 enum class MeshPrimitive: UnsignedInt;
 enum class MeshIndexType: UnsignedInt;
 enum class VertexFormat: UnsignedInt;
@@ -0,0 +1,134 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CompileUniforms.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/MaterialTools/FindAttributeIds.h"
+#include "Magnum/Trade/MaterialData.h"
+
+/* This header is included only privately and doesn't introduce any linker
+   dependency, thus it's completely safe to not link to the Shaders library */
+#include "Magnum/Shaders/Phong.h"
+
+namespace Magnum { namespace MaterialTools {
+
+namespace {
+
+/* Order matches the Attribute* indices below */
+constexpr Trade::MaterialAttribute Attributes[]{
+    Trade::MaterialAttribute::AmbientColor,
+    Trade::MaterialAttribute::AmbientTexture,
+    Trade::MaterialAttribute::DiffuseColor,
+    Trade::MaterialAttribute::DiffuseTexture,
+    Trade::MaterialAttribute::BaseColor,
+    Trade::MaterialAttribute::BaseColorTexture,
+    Trade::MaterialAttribute::SpecularColor,
+    Trade::MaterialAttribute::SpecularTexture,
+    Trade::MaterialAttribute::NormalTexture,
+    Trade::MaterialAttribute::NormalTextureScale,
+    Trade::MaterialAttribute::Shininess,
+    Trade::MaterialAttribute::AlphaMask
+};
+
+enum: std::size_t {
+    AttributeAmbientColor,
+    AttributeAmbientTexture,
+    AttributeDiffuseColor,
+    AttributeDiffuseTexture,
+    AttributeBaseColor,
+    AttributeBaseColorTexture,
+    AttributeSpecularColor,
+    AttributeSpecularTexture,
+    AttributeNormalTexture,
+    AttributeNormalTextureScale,
+    AttributeShininess,
+    AttributeAlphaMask,
+    AttributeCount
+};
+
+static_assert(Containers::arraySize(Attributes) == AttributeCount, "attribute list and indices out of sync");
+
+template<class T> T attributeOr(const Trade::MaterialData& material, const UnsignedInt id, const T& defaultValue) {
+    return id == ~UnsignedInt{} ? defaultValue : material.attribute<T>(0, id);
+}
+
+}
+
+void compilePhongUniformsInto(const Containers::Iterable<const Trade::MaterialData>& materials, const Containers::StridedArrayView1D<Shaders::PhongMaterialUniform>& uniforms, const Containers::StridedArrayView1D<PhongMaterialTextures>& textures) {
+    CORRADE_ASSERT(uniforms.size() == materials.size(),
+        "MaterialTools::compilePhongUniformsInto(): expected" << materials.size() << "uniforms but got" << uniforms.size(), );
+    CORRADE_ASSERT(textures.isEmpty() || textures.size() == materials.size(),
+        "MaterialTools::compilePhongUniformsInto(): expected" << materials.size() << "texture bindings but got" << textures.size(), );
+
+    /* Resolve all attribute IDs upfront in a single pass over each material */
+    const Containers::Array<UnsignedInt> ids = findAttributeIds(materials, 0, Attributes);
+
+    for(std::size_t i = 0; i != materials.size(); ++i) {
+        const Trade::MaterialData& material = materials[i];
+        const Containers::ArrayView<const UnsignedInt> materialIds = ids.sliceSize(i*AttributeCount, AttributeCount);
+
+        /* Fall back to base color for materials that have no diffuse
+           properties, such as PBR metallic/roughness materials */
+        const bool useBaseColor =
+            materialIds[AttributeDiffuseColor] == ~UnsignedInt{} &&
+            materialIds[AttributeDiffuseTexture] == ~UnsignedInt{};
+        const UnsignedInt diffuseColorId = materialIds[useBaseColor ? AttributeBaseColor : AttributeDiffuseColor];
+        const UnsignedInt diffuseTextureId = materialIds[useBaseColor ? AttributeBaseColorTexture : AttributeDiffuseTexture];
+
+        /* Defaults match Trade::PhongMaterialData */
+        const bool hasAmbientTexture = materialIds[AttributeAmbientTexture] != ~UnsignedInt{};
+        uniforms[i] = Shaders::PhongMaterialUniform{}
+            .setAmbientColor(attributeOr<Color4>(material, materialIds[AttributeAmbientColor], hasAmbientTexture ? Color4{1.0f} : Color4{0.0f, 1.0f}))
+            .setDiffuseColor(attributeOr<Color4>(material, diffuseColorId, Color4{1.0f}))
+            .setSpecularColor(attributeOr<Color4>(material, materialIds[AttributeSpecularColor], Color4{1.0f, 0.0f}))
+            .setNormalTextureScale(attributeOr<Float>(material, materialIds[AttributeNormalTextureScale], 1.0f))
+            .setShininess(attributeOr<Float>(material, materialIds[AttributeShininess], 80.0f))
+            .setAlphaMask(attributeOr<Float>(material, materialIds[AttributeAlphaMask], 0.5f));
+
+        if(!textures.isEmpty()) {
+            PhongMaterialTextures& out = textures[i];
+            out.ambientTexture = attributeOr<UnsignedInt>(material, materialIds[AttributeAmbientTexture], ~UnsignedInt{});
+            out.diffuseTexture = attributeOr<UnsignedInt>(material, diffuseTextureId, ~UnsignedInt{});
+            out.specularTexture = attributeOr<UnsignedInt>(material, materialIds[AttributeSpecularTexture], ~UnsignedInt{});
+            out.normalTexture = attributeOr<UnsignedInt>(material, materialIds[AttributeNormalTexture], ~UnsignedInt{});
+        }
+    }
+}
+
+Containers::Pair<Containers::Array<Shaders::PhongMaterialUniform>, Containers::Array<PhongMaterialTextures>> compilePhongUniforms(const Containers::Iterable<const Trade::MaterialData>& materials) {
+    Containers::Array<Shaders::PhongMaterialUniform> uniforms{NoInit, materials.size()};
+    Containers::Array<PhongMaterialTextures> textures{NoInit, materials.size()};
+    compilePhongUniformsInto(materials, uniforms, textures);
+    return {Utility::move(uniforms), Utility::move(textures)};
+}
+
+}}
@@ -0,0 +1,125 @@
+#ifndef Magnum_MaterialTools_CompileUniforms_h
+#define Magnum_MaterialTools_CompileUniforms_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MaterialTools::PhongMaterialTextures, function @ref Magnum::MaterialTools::compilePhongUniforms(), @ref Magnum::MaterialTools::compilePhongUniformsInto()
+ * @m_since_latest
+ */
+
+#include "Magnum/configure.h"
+
+#ifdef MAGNUM_TARGET_GL
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MaterialTools/visibility.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MaterialTools {
+
+/**
+@brief Textures used by a Phong material
+@m_since_latest
+
+Texture binding table entry produced by @ref compilePhongUniforms() alongside
+a @ref Shaders::PhongMaterialUniform. Each field is a texture ID as referenced
+by the source @ref Trade::MaterialData, or @cpp ~UnsignedInt{} @ce if the
+material doesn't have given texture.
+*/
+struct PhongMaterialTextures {
+    /** @brief Ambient texture ID */
+    UnsignedInt ambientTexture;
+
+    /** @brief Diffuse texture ID */
+    UnsignedInt diffuseTexture;
+
+    /** @brief Specular texture ID */
+    UnsignedInt specularTexture;
+
+    /** @brief Normal texture ID */
+    UnsignedInt normalTexture;
+};
+
+/**
+@brief Compile materials into a Phong uniform array and a texture binding table
+@param materials    List of materials
+@return Material uniforms and texture bindings, both having the same size as
+    @p materials
+@m_since_latest
+
+Extracts attributes of the base layer of each material into a
+@ref Shaders::PhongMaterialUniform in a single pass, ready to be uploaded into
+a uniform or storage buffer and referenced via
+@ref Shaders::PhongDrawUniform::materialId. Texture IDs are put into a
+@ref PhongMaterialTextures table next to it.
+
+Defaults for missing attributes are the same as in
+@ref Trade::PhongMaterialData. If a material doesn't have
+@ref Trade::MaterialAttribute::DiffuseColor or
+@ref Trade::MaterialAttribute::DiffuseTexture, for example because it's a
+@ref Trade::MaterialType::PbrMetallicRoughness material,
+@ref Trade::MaterialAttribute::BaseColor and
+@ref Trade::MaterialAttribute::BaseColorTexture are used instead, if present.
+
+The attributes are looked up using @ref findAttributeIds(), i.e. with a
+single linear pass over attributes of each material. The
+@ref Shaders::PhongMaterialUniform structure is header-only, so this function
+doesn't introduce a linker dependency on the @ref Shaders or @ref GL
+libraries, however you need to include @ref Magnum/Shaders/Phong.h in order to
+access the output. Available only if Magnum is compiled with
+@ref MAGNUM_TARGET_GL enabled.
+
+@snippet Shaders-gl.cpp MaterialTools-compilePhongUniforms
+
+@see @ref compilePhongUniformsInto()
+*/
+MAGNUM_MATERIALTOOLS_EXPORT Containers::Pair<Containers::Array<Shaders::PhongMaterialUniform>, Containers::Array<PhongMaterialTextures>> compilePhongUniforms(const Containers::Iterable<const Trade::MaterialData>& materials);
+
+/**
+@brief Compile materials into a Phong uniform array and a texture binding table, putting the output into given views
+@param[in]  materials   List of materials
+@param[out] uniforms    Where to put material uniforms
+@param[out] textures    Where to put texture bindings. Can be empty, in which
+    case no texture bindings are written.
+@m_since_latest
+
+Like @ref compilePhongUniforms() but puts the output into @p uniforms and
+@p textures instead of allocating new arrays, which can be for example a
+mapped GPU buffer. Expects that @p uniforms has the same size as
+@p materials and that @p textures is either empty or has the same size as
+well.
+*/
+MAGNUM_MATERIALTOOLS_EXPORT void compilePhongUniformsInto(const Containers::Iterable<const Trade::MaterialData>& materials, const Containers::StridedArrayView1D<Shaders::PhongMaterialUniform>& uniforms, const Containers::StridedArrayView1D<PhongMaterialTextures>& textures);
+
+}}
+#else
+#error this header is available only in the OpenGL build
+#endif
+
+#endif
@@ -27,10 +27,12 @@
 #include "Filter.h"
 
 #include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/Iterable.h>
 #include <Corrade/Containers/StridedBitArrayView.h>
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/BitAlgorithms.h>
 
+#include "Magnum/MaterialTools/Implementation/materialBatch.h"
 #include "Magnum/Trade/MaterialData.h"
 
 namespace Magnum { namespace MaterialTools {
@@ -106,6 +108,30 @@ Trade::MaterialData filterAttributesLayersImplementation(const Trade::MaterialDa
     return Trade::MaterialData{material.types() & typesToKeep, Utility::move(attributes), Utility::move(layers)};
 }
 
+struct FilterAttributesState {
+    const Containers::Iterable<const Trade::MaterialData>& materials;
+    Containers::BitArrayView attributesToKeep;
+    /* Offsets into attributesToKeep, the batch attribute storage and the
+       batch layer storage, materialCount + 1 items each */
+    Containers::ArrayView<const std::size_t> inputAttributeOffsets;
+    Containers::ArrayView<const std::size_t> attributeOffsets;
+    Containers::ArrayView<const std::size_t> layerOffsets;
+    Containers::ArrayView<Trade::MaterialAttributeData> attributes;
+    Containers::ArrayView<UnsignedInt> layers;
+};
+
+void filterAttributesTask(void* const taskState, const std::size_t i) {
+    FilterAttributesState& state = *static_cast<FilterAttributesState*>(taskState);
+    const Trade::MaterialData& material = state.materials[i];
+    const Containers::BitArrayView attributesToKeep = state.attributesToKeep.slice(state.inputAttributeOffsets[i], state.inputAttributeOffsets[i + 1]);
+
+    const Containers::ArrayView<UnsignedInt> layers = state.layers.slice(state.layerOffsets[i], state.layerOffsets[i + 1]);
+    for(UnsignedInt j = 0; j != material.layerCount(); ++j)
+        layers[j] = attributesToKeep.prefix(material.attributeDataOffset(j + 1)).count();
+
+    Utility::copyMasked(material.attributeData(), attributesToKeep, state.attributes.slice(state.attributeOffsets[i], state.attributeOffsets[i + 1]));
+}
+
 }
 
 Trade::MaterialData filterAttributes(const Trade::MaterialData& material, const Containers::BitArrayView attributesToKeep, const Trade::MaterialTypes typesToKeep) {
@@ -115,6 +141,41 @@ Trade::MaterialData filterAttributes(const Trade::MaterialData& material, const
     return filterAttributesLayersImplementation(material, attributesToKeep, nullptr, typesToKeep);
 }
 
+Containers::Array<Trade::MaterialData> filterAttributes(const Containers::Iterable<const Trade::MaterialData>& materials, const Containers::BitArrayView attributesToKeep, const Trade::MaterialTypes typesToKeep, const ParallelFor parallelFor, void* const parallelForState) {
+    /* Calculate offsets of each material in the input bits and in the batch
+       storage. The output attribute count is known upfront from the set
+       bits, so the storage has no gaps. */
+    const std::size_t materialCount = materials.size();
+    Containers::Array<std::size_t> offsets{NoInit, 3*materialCount + 3};
+    const Containers::ArrayView<std::size_t> inputAttributeOffsets = offsets.prefix(materialCount + 1);
+    const Containers::ArrayView<std::size_t> attributeOffsets = offsets.sliceSize(materialCount + 1, materialCount + 1);
+    const Containers::ArrayView<std::size_t> layerOffsets = offsets.exceptPrefix(2*materialCount + 2);
+    inputAttributeOffsets[0] = 0;
+    attributeOffsets[0] = 0;
+    layerOffsets[0] = 0;
+    for(std::size_t i = 0; i != materialCount; ++i) {
+        inputAttributeOffsets[i + 1] = inputAttributeOffsets[i] + materials[i].attributeData().size();
+        layerOffsets[i + 1] = layerOffsets[i] + materials[i].layerCount();
+    }
+
+    CORRADE_ASSERT(attributesToKeep.size() == inputAttributeOffsets.back(),
+        "MaterialTools::filterAttributes(): expected" << inputAttributeOffsets.back() << "bits but got" << attributesToKeep.size(), {});
+
+    for(std::size_t i = 0; i != materialCount; ++i)
+        attributeOffsets[i + 1] = attributeOffsets[i] + attributesToKeep.slice(inputAttributeOffsets[i], inputAttributeOffsets[i + 1]).count();
+
+    Implementation::MaterialBatch batch{materialCount, attributeOffsets.back(), layerOffsets.back()};
+    FilterAttributesState state{materials, attributesToKeep, inputAttributeOffsets, attributeOffsets, layerOffsets, batch.attributes(), batch.layers()};
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, materialCount, filterAttributesTask, &state);
+
+    for(std::size_t i = 0; i != materialCount; ++i)
+        batch.set(i, materials[i].types() & typesToKeep,
+            batch.attributes().slice(attributeOffsets[i], attributeOffsets[i + 1]),
+            batch.layers().slice(layerOffsets[i], layerOffsets[i + 1]));
+
+    return batch.release();
+}
+
 Trade::MaterialData filterLayers(const Trade::MaterialData& material, const Containers::BitArrayView layersToKeep, const Trade::MaterialTypes typesToKeep) {
     CORRADE_ASSERT(layersToKeep.size() == material.layerCount(),
         "MaterialTools::filterLayers(): expected" << material.layerCount() << "bits but got" << layersToKeep.size(), (Trade::MaterialData{{}, {}}));
@@ -33,6 +33,7 @@
 
 #include <Corrade/Containers/EnumSet.h>
 
+#include "Magnum/MaterialTools/Parallel.h"
 #include "Magnum/MaterialTools/visibility.h"
 #include "Magnum/Trade/Trade.h"
 
@@ -52,10 +53,38 @@ many attributes are left in those. Empty layers are kept,
 The size of @p attributesToKeep is expected to be equal to the number of
 attributes in all layers (i.e., size of the
 @ref Trade::MaterialData::attributeData() array).
-@see @ref filterLayers(), @ref filterAttributesLayers()
+@see @ref filterLayers(), @ref filterAttributesLayers(),
+    @ref filterAttributes(const Containers::Iterable<const Trade::MaterialData>&, Containers::BitArrayView, Trade::MaterialTypes, ParallelFor, void*)
 */
 MAGNUM_MATERIALTOOLS_EXPORT Trade::MaterialData filterAttributes(const Trade::MaterialData& material, Containers::BitArrayView attributesToKeep, Trade::MaterialTypes typesToKeep = ~Trade::MaterialTypes{});
 
+/**
+@brief Filter attributes of a batch of materials
+@param materials        Materials to filter
+@param attributesToKeep Attributes to keep in all materials
+@param typesToKeep      Material types to keep
+@param parallelFor      Parallel loop executor or @cpp nullptr @ce
+@param parallelForState State pointer passed to @p parallelFor
+@m_since_latest
+
+Equivalent to calling @ref filterAttributes(const Trade::MaterialData&, Containers::BitArrayView, Trade::MaterialTypes)
+on every material in @p materials, with the work distributed across
+@p parallelFor. The @p attributesToKeep bits for all materials are
+concatenated, i.e. its size is expected to be equal to the sum of
+@ref Trade::MaterialData::attributeData() sizes of all materials.
+
+Instead of allocating every material separately, the returned materials
+together with all their attributes and layer offsets are placed in a single
+allocation owned by the returned array, which uses a custom deleter. The
+@ref Trade::MaterialData::attributeDataFlags() and
+@relativeref{Trade::MaterialData,layerDataFlags()} of the materials are thus
+empty and the materials are valid only as long as the returned array is. Use
+@ref copy(const Trade::MaterialData&) to turn any of them into a
+self-contained instance.
+@see @ref ParallelFor, @ref parallelForSerial()
+*/
+MAGNUM_MATERIALTOOLS_EXPORT Containers::Array<Trade::MaterialData> filterAttributes(const Containers::Iterable<const Trade::MaterialData>& materials, Containers::BitArrayView attributesToKeep, Trade::MaterialTypes typesToKeep = ~Trade::MaterialTypes{}, ParallelFor parallelFor = parallelForSerial, void* parallelForState = nullptr);
+
 /**
 @brief Filter material layers
 @m_since_latest
@@ -0,0 +1,94 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FindAttributeIds.h"
+
+#include <algorithm>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StringIterable.h>
+
+#include "Magnum/Trade/MaterialData.h"
+
+namespace Magnum { namespace MaterialTools {
+
+void findAttributeIdsInto(const Containers::Iterable<const Trade::MaterialData>& materials, const UnsignedInt layer, const Containers::StringIterable& names, const Containers::StridedArrayView2D<UnsignedInt>& ids) {
+    CORRADE_ASSERT(ids.size()[0] == materials.size() && ids.size()[1] == names.size(),
+        "MaterialTools::findAttributeIdsInto(): bad output size, expected" << materials.size() << "by" << names.size() << "but got" << ids.size()[0] << "by" << ids.size()[1], );
+
+    /* Sort the names once. Attributes in each material layer are sorted as
+       well, so the lookup can be then done by a linear walk through both. */
+    Containers::Array<UnsignedInt> order{NoInit, names.size()};
+    for(UnsignedInt i = 0; i != order.size(); ++i)
+        order[i] = i;
+    std::sort(order.begin(), order.end(), [&names](UnsignedInt a, UnsignedInt b) {
+        return names[a] < names[b];
+    });
+
+    for(std::size_t i = 0; i != materials.size(); ++i) {
+        const Trade::MaterialData& material = materials[i];
+        const Containers::StridedArrayView1D<UnsignedInt> materialIds = ids[i];
+
+        /* The material doesn't have such layer, nothing to find */
+        if(layer >= material.layerCount()) {
+            for(UnsignedInt& id: materialIds)
+                id = ~UnsignedInt{};
+            continue;
+        }
+
+        const Containers::ArrayView<const Trade::MaterialAttributeData> attributes = material.attributeData().slice(material.attributeDataOffset(layer), material.attributeDataOffset(layer + 1));
+        UnsignedInt attribute = 0;
+        for(const UnsignedInt j: order) {
+            const Containers::StringView name = names[j];
+            while(attribute != attributes.size() && attributes[attribute].name() < name)
+                ++attribute;
+            materialIds[j] = attribute != attributes.size() && attributes[attribute].name() == name ? attribute : ~UnsignedInt{};
+        }
+    }
+}
+
+void findAttributeIdsInto(const Containers::Iterable<const Trade::MaterialData>& materials, const UnsignedInt layer, const Containers::ArrayView<const Trade::MaterialAttribute> names, const Containers::StridedArrayView2D<UnsignedInt>& ids) {
+    Containers::Array<Containers::StringView> nameStrings{NoInit, names.size()};
+    for(std::size_t i = 0; i != names.size(); ++i)
+        nameStrings[i] = Trade::materialAttributeName(names[i]);
+
+    findAttributeIdsInto(materials, layer, nameStrings, ids);
+}
+
+Containers::Array<UnsignedInt> findAttributeIds(const Containers::Iterable<const Trade::MaterialData>& materials, const UnsignedInt layer, const Containers::StringIterable& names) {
+    Containers::Array<UnsignedInt> out{NoInit, materials.size()*names.size()};
+    findAttributeIdsInto(materials, layer, names, Containers::StridedArrayView2D<UnsignedInt>{out, {materials.size(), names.size()}});
+    return out;
+}
+
+Containers::Array<UnsignedInt> findAttributeIds(const Containers::Iterable<const Trade::MaterialData>& materials, const UnsignedInt layer, const Containers::ArrayView<const Trade::MaterialAttribute> names) {
+    Containers::Array<UnsignedInt> out{NoInit, materials.size()*names.size()};
+    findAttributeIdsInto(materials, layer, names, Containers::StridedArrayView2D<UnsignedInt>{out, {materials.size(), names.size()}});
+    return out;
+}
+
+}}
@@ -0,0 +1,105 @@
+#ifndef Magnum_MaterialTools_FindAttributeIds_h
+#define Magnum_MaterialTools_FindAttributeIds_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MaterialTools::findAttributeIds(), @ref Magnum::MaterialTools::findAttributeIdsInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/MaterialTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MaterialTools {
+
+/**
+@brief Find IDs of given attributes in a list of materials
+@param materials    List of materials
+@param layer        Layer to look for the attributes in
+@param names        Attribute names to look for
+@return Attribute IDs, row-major with @p names as the second dimension
+@m_since_latest
+
+For every material in @p materials and every name in @p names returns an
+attribute ID in given @p layer, usable with
+@ref Trade::MaterialData::attribute(UnsignedInt, UnsignedInt) const and other
+ID-based accessors, or @cpp ~UnsignedInt{} @ce if the material doesn't have
+given attribute or given layer. The ID for a name at index @cpp j @ce in a
+material at index @cpp i @ce is at index @cpp i*names.size() + j @ce in the
+output. Once resolved, accessing the attributes is an @f$ \mathcal{O}(1) @f$
+operation, which is useful for example when extracting a fixed set of
+attributes from many materials into a GPU-side material table.
+
+As attributes are sorted by name in @ref Trade::MaterialData, the names are
+sorted once upfront and then the lookup is done in a single linear pass over
+the attributes in given layer for each material, i.e. an
+@f$ \mathcal{O}(m + n) @f$ operation per material instead of
+@f$ \mathcal{O}(n \log m) @f$ when calling
+@ref Trade::MaterialData::findAttributeId() for each name, with @f$ m @f$
+being the attribute count in the layer and @f$ n @f$ the count of names. The
+names are allowed to repeat. The function allocates a temporary array for the
+sorted name order.
+@see @ref findAttributeIdsInto()
+*/
+MAGNUM_MATERIALTOOLS_EXPORT Containers::Array<UnsignedInt> findAttributeIds(const Containers::Iterable<const Trade::MaterialData>& materials, UnsignedInt layer, const Containers::StringIterable& names);
+
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * The @p names are expected to not be custom attributes.
+ */
+MAGNUM_MATERIALTOOLS_EXPORT Containers::Array<UnsignedInt> findAttributeIds(const Containers::Iterable<const Trade::MaterialData>& materials, UnsignedInt layer, Containers::ArrayView<const Trade::MaterialAttribute> names);
+
+/**
+@brief Find IDs of given attributes in a list of materials into given output array
+@param[in]  materials   List of materials
+@param[in]  layer       Layer to look for the attributes in
+@param[in]  names       Attribute names to look for
+@param[out] ids         Where to put the attribute IDs
+@m_since_latest
+
+Like @ref findAttributeIds() but puts the IDs into @p ids instead of
+allocating a new array. Expects that the first dimension of @p ids has the
+same size as @p materials and the second the same size as @p names, the view
+doesn't need to be contiguous.
+*/
+MAGNUM_MATERIALTOOLS_EXPORT void findAttributeIdsInto(const Containers::Iterable<const Trade::MaterialData>& materials, UnsignedInt layer, const Containers::StringIterable& names, const Containers::StridedArrayView2D<UnsignedInt>& ids);
+
+/**
+ * @overload
+ * @m_since_latest
+ *
+ * The @p names are expected to not be custom attributes.
+ */
+MAGNUM_MATERIALTOOLS_EXPORT void findAttributeIdsInto(const Containers::Iterable<const Trade::MaterialData>& materials, UnsignedInt layer, Containers::ArrayView<const Trade::MaterialAttribute> names, const Containers::StridedArrayView2D<UnsignedInt>& ids);
+
+}}
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef Magnum_MaterialTools_Implementation_materialBatch_h
+#define Magnum_MaterialTools_Implementation_materialBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <new>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Trade/MaterialData.h"
+
+namespace Magnum { namespace MaterialTools { namespace Implementation {
+
+/* Storage for a batch of materials together with all attribute and layer data
+   they reference, placed in a single allocation. The batch operations first
+   fill attributes() and layers() from multiple threads, then call set() for
+   every material and finally release() the result. If release() isn't
+   called, the memory is freed without any material being constructed, which
+   is what happens on failure. */
+class MaterialBatch {
+    public:
+        explicit MaterialBatch(const std::size_t materialCount, const std::size_t attributeCount, const std::size_t layerCount): _materialCount{materialCount} {
+            /* Materials are placed first so the deleter can free the whole
+               allocation from the material array pointer alone, attributes
+               and layer offsets after. The new[] allocation is suitably
+               aligned for all of them. */
+            static_assert(alignof(Trade::MaterialAttributeData) <= alignof(std::max_align_t),
+                "unexpected alignment of material attribute data");
+            const std::size_t attributeOffset = (materialCount*sizeof(Trade::MaterialData) + alignof(Trade::MaterialAttributeData) - 1)/alignof(Trade::MaterialAttributeData)*alignof(Trade::MaterialAttributeData);
+            const std::size_t layerOffset = attributeOffset + attributeCount*sizeof(Trade::MaterialAttributeData);
+            _data = new char[layerOffset + layerCount*sizeof(UnsignedInt)];
+            _attributes = {reinterpret_cast<Trade::MaterialAttributeData*>(_data + attributeOffset), attributeCount};
+            _layers = {reinterpret_cast<UnsignedInt*>(_data + layerOffset), layerCount};
+        }
+
+        MaterialBatch(const MaterialBatch&) = delete;
+        MaterialBatch& operator=(const MaterialBatch&) = delete;
+
+        ~MaterialBatch() { delete[] _data; }
+
+        Containers::ArrayView<Trade::MaterialAttributeData> attributes() const { return _attributes; }
+        Containers::ArrayView<UnsignedInt> layers() const { return _layers; }
+
+        /* Constructs a material referencing given attribute and layer data.
+           Has to be called exactly once for every material before
+           release(). */
+        void set(const std::size_t i, const Trade::MaterialTypes types, const Containers::ArrayView<const Trade::MaterialAttributeData> attributes, const Containers::ArrayView<const UnsignedInt> layers) {
+            new(reinterpret_cast<Trade::MaterialData*>(_data) + i) Trade::MaterialData{types, {}, attributes, {}, layers};
+        }
+
+        Containers::Array<Trade::MaterialData> release() {
+            Containers::Array<Trade::MaterialData> out{reinterpret_cast<Trade::MaterialData*>(_data), _materialCount, deleter};
+            _data = nullptr;
+            return out;
+        }
+
+    private:
+        static void deleter(Trade::MaterialData* const data, const std::size_t size) {
+            for(std::size_t i = 0; i != size; ++i) data[i].~MaterialData();
+            delete[] reinterpret_cast<char*>(data);
+        }
+
+        char* _data;
+        std::size_t _materialCount;
+        Containers::ArrayView<Trade::MaterialAttributeData> _attributes;
+        Containers::ArrayView<UnsignedInt> _layers;
+};
+            _layers = {reinterpret_cast<UnsignedInt*>(_data + _attributeSize + _materialSize), layerCount};
+        }
+
+        MaterialBatch(const MaterialBatch&) = delete;
+        MaterialBatch& operator=(const MaterialBatch&) = delete;
+
+        ~MaterialBatch() { delete[] _data; }
+
+        Containers::ArrayView<Trade::MaterialAttributeData> attributes() const { return _attributes; }
+        Containers::ArrayView<UnsignedInt> layers() const { return _layers; }
+
+        /* Constructs a material referencing given attribute and layer data.
+           Has to be called exactly once for every material before
+           release(). */
+        void set(const std::size_t i, const Trade::MaterialTypes types, const Containers::ArrayView<const Trade::MaterialAttributeData> attributes, const Containers::ArrayView<const UnsignedInt> layers) {
+            new(materials() + i) Trade::MaterialData{types, {}, attributes, {}, layers};
+        }
+
+        Containers::Array<Trade::MaterialData> release() {
+            Containers::Array<Trade::MaterialData> out{materials(), _materialCount, deleter};
+            _data = nullptr;
+            return out;
+        }
+
+    private:
+        Trade::MaterialData* materials() const {
+            return reinterpret_cast<Trade::MaterialData*>(_data + _attributeSize);
+        }
+
+        /* The deleter gets only the material array pointer, so it has to
+           calculate the allocation start from it. The attribute count is
+           unknown here, however, so the allocation start is remembered in
+           an extra pointer-sized slot right before the materials. */
+        static void deleter(Trade::MaterialData* data, std::size_t size);
+
+        char* _data;
+        std::size_t _materialCount, _attributeSize, _materialSize;
+        Containers::ArrayView<Trade::MaterialAttributeData> _attributes;
+        Containers::ArrayView<UnsignedInt> _layers;
+};
+
+}}}
+
+#endif
@@ -27,17 +27,23 @@
 #include "Merge.h"
 
 #include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Iterable.h>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/Algorithms.h>
 
+#include "Magnum/MaterialTools/Implementation/materialBatch.h"
 #include "Magnum/Trade/MaterialData.h"
 
 namespace Magnum { namespace MaterialTools {
 
-Containers::Optional<Trade::MaterialData> merge(const Trade::MaterialData& first, const Trade::MaterialData& second, MergeConflicts conflicts) {
-    Containers::Array<Trade::MaterialAttributeData> attributes;
-    arrayReserve(attributes, first.attributeData().size() + second.attributeData().size());
+namespace {
 
-    Containers::Array<UnsignedInt> layers{NoInit, Math::max(first.layerCount(), second.layerCount())};
+/* Writes merged attributes to the attributes view, which is expected to have
+   space for all attributes from both materials, and layer offsets to the
+   layers view, which is expected to be large enough for layers from both.
+   Returns the actual attribute count or NullOpt on a conflict. */
+Containers::Optional<std::size_t> mergeInto(const Trade::MaterialData& first, const Trade::MaterialData& second, const MergeConflicts conflicts, const Containers::ArrayView<Trade::MaterialAttributeData> attributes, const Containers::ArrayView<UnsignedInt> layers) {
+    std::size_t attributeCount = 0;
 
     /* Go over all layers that are in both materials */
     std::size_t layer = 0;
@@ -66,18 +72,18 @@ Containers::Optional<Trade::MaterialData> merge(const Trade::MaterialData& first
                 }
 
                 /* Add the first attribute, ignore the second */
-                arrayAppend(attributes, first.attributeData(layer, attributeFirst));
+                attributes[attributeCount++] = first.attributeData(layer, attributeFirst);
                 ++attributeFirst;
                 ++attributeSecond;
 
             /* The attribute from first material should go first */
             } else if(first.attributeName(layer, attributeFirst) < second.attributeName(layer, attributeSecond)) {
-                arrayAppend(attributes, first.attributeData(layer, attributeFirst));
+                attributes[attributeCount++] = first.attributeData(layer, attributeFirst);
                 ++attributeFirst;
 
             /* The attribute from second material should go first */
             } else if(first.attributeName(layer, attributeFirst) > second.attributeName(layer, attributeSecond)) {
-                arrayAppend(attributes, second.attributeData(layer, attributeSecond));
+                attributes[attributeCount++] = second.attributeData(layer, attributeSecond);
                 ++attributeSecond;
             } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
         }
@@ -85,37 +91,117 @@ Containers::Optional<Trade::MaterialData> merge(const Trade::MaterialData& first
         /* Consume remaining leftover attributes in either. Only one of these
            loops get entered. */
         while(attributeFirst < first.attributeCount(layer)) {
-            arrayAppend(attributes, first.attributeData(layer, attributeFirst));
+            attributes[attributeCount++] = first.attributeData(layer, attributeFirst);
             ++attributeFirst;
         }
         while(attributeSecond < second.attributeCount(layer)) {
-            arrayAppend(attributes, second.attributeData(layer, attributeSecond));
+            attributes[attributeCount++] = second.attributeData(layer, attributeSecond);
             ++attributeSecond;
         }
 
-        layers[layer] = attributes.size();
+        layers[layer] = attributeCount;
     }
 
     /* Go over remaining layers which weren't in the other attribute and
        add them as a whole. Only one of these loops get entered. */
     for(; layer < first.layerCount(); ++layer) {
-        arrayAppend(attributes, first.attributeData().slice(
+        const Containers::ArrayView<const Trade::MaterialAttributeData> layerAttributes = first.attributeData().slice(
             first.attributeDataOffset(layer),
-            first.attributeDataOffset(layer + 1)));
+            first.attributeDataOffset(layer + 1));
+        Utility::copy(layerAttributes, attributes.sliceSize(attributeCount, layerAttributes.size()));
+        attributeCount += layerAttributes.size();
 
-        layers[layer] = attributes.size();
+        layers[layer] = attributeCount;
     }
     for(; layer < second.layerCount(); ++layer) {
-        arrayAppend(attributes, second.attributeData().slice(
+        const Containers::ArrayView<const Trade::MaterialAttributeData> layerAttributes = second.attributeData().slice(
             second.attributeDataOffset(layer),
-            second.attributeDataOffset(layer + 1)));
+            second.attributeDataOffset(layer + 1));
+        Utility::copy(layerAttributes, attributes.sliceSize(attributeCount, layerAttributes.size()));
+        attributeCount += layerAttributes.size();
 
-        layers[layer] = attributes.size();
+        layers[layer] = attributeCount;
     }
 
-    CORRADE_INTERNAL_ASSERT(layer == layers.size());
+    CORRADE_INTERNAL_ASSERT(layer == Math::max(first.layerCount(), second.layerCount()));
+
+    return attributeCount;
+}
+
+struct MergeState {
+    const Containers::Iterable<const Trade::MaterialData>& first;
+    const Containers::Iterable<const Trade::MaterialData>& second;
+    MergeConflicts conflicts;
+    /* Offsets into the batch attribute and layer storage, materialCount + 1
+       items each */
+    Containers::ArrayView<const std::size_t> attributeOffsets;
+    Containers::ArrayView<const std::size_t> layerOffsets;
+    /* Actual attribute count for every material or ~std::size_t{} if the
+       merge failed */
+    Containers::ArrayView<std::size_t> attributeCounts;
+    Containers::ArrayView<Trade::MaterialAttributeData> attributes;
+    Containers::ArrayView<UnsignedInt> layers;
+};
+
+void mergeTask(void* const taskState, const std::size_t i) {
+    MergeState& state = *static_cast<MergeState*>(taskState);
+    const Containers::Optional<std::size_t> attributeCount = mergeInto(
+        state.first[i], state.second[i], state.conflicts,
+        state.attributes.slice(state.attributeOffsets[i], state.attributeOffsets[i + 1]),
+        state.layers.slice(state.layerOffsets[i], state.layerOffsets[i + 1]));
+    state.attributeCounts[i] = attributeCount ? *attributeCount : ~std::size_t{};
+}
+
+}
+
+Containers::Optional<Trade::MaterialData> merge(const Trade::MaterialData& first, const Trade::MaterialData& second, MergeConflicts conflicts) {
+    /* Allocate for the worst case where there are no conflicts and shrink
+       afterwards */
+    Containers::Array<Trade::MaterialAttributeData> attributes;
+    arrayResize(attributes, NoInit, first.attributeData().size() + second.attributeData().size());
+
+    Containers::Array<UnsignedInt> layers{NoInit, Math::max(first.layerCount(), second.layerCount())};
+
+    const Containers::Optional<std::size_t> attributeCount = mergeInto(first, second, conflicts, attributes, layers);
+    if(!attributeCount) return {};
+    arrayRemoveSuffix(attributes, attributes.size() - *attributeCount);
 
     return Trade::MaterialData{first.types()|second.types(), Utility::move(attributes), Utility::move(layers)};
 }
 
+Containers::Optional<Containers::Array<Trade::MaterialData>> merge(const Containers::Iterable<const Trade::MaterialData>& first, const Containers::Iterable<const Trade::MaterialData>& second, const MergeConflicts conflicts, const ParallelFor parallelFor, void* const parallelForState) {
+    CORRADE_ASSERT(first.size() == second.size(),
+        "MaterialTools::merge(): expected the same count of first and second materials but got" << first.size() << "and" << second.size(), {});
+
+    /* Calculate offsets of each material in the batch storage, again
+       assuming the worst case where there are no conflicts */
+    const std::size_t materialCount = first.size();
+    Containers::Array<std::size_t> offsets{NoInit, 3*materialCount + 2};
+    const Containers::ArrayView<std::size_t> attributeOffsets = offsets.prefix(materialCount + 1);
+    const Containers::ArrayView<std::size_t> layerOffsets = offsets.sliceSize(materialCount + 1, materialCount + 1);
+    const Containers::ArrayView<std::size_t> attributeCounts = offsets.exceptPrefix(2*materialCount + 2);
+    attributeOffsets[0] = 0;
+    layerOffsets[0] = 0;
+    for(std::size_t i = 0; i != materialCount; ++i) {
+        attributeOffsets[i + 1] = attributeOffsets[i] + first[i].attributeData().size() + second[i].attributeData().size();
+        layerOffsets[i + 1] = layerOffsets[i] + Math::max(first[i].layerCount(), second[i].layerCount());
+    }
+
+    Implementation::MaterialBatch batch{materialCount, attributeOffsets.back(), layerOffsets.back()};
+    MergeState state{first, second, conflicts, attributeOffsets, layerOffsets, attributeCounts, batch.attributes(), batch.layers()};
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, materialCount, mergeTask, &state);
+
+    /* If any of the merges failed, fail the whole operation. The message was
+       already printed by the task. */
+    for(std::size_t i = 0; i != materialCount; ++i)
+        if(attributeCounts[i] == ~std::size_t{}) return {};
+
+    for(std::size_t i = 0; i != materialCount; ++i)
+        batch.set(i, first[i].types()|second[i].types(),
+            batch.attributes().sliceSize(attributeOffsets[i], attributeCounts[i]),
+            batch.layers().slice(layerOffsets[i], layerOffsets[i + 1]));
+
+    return batch.release();
+}
+
 }}
@@ -31,6 +31,9 @@
  * @m_since_latest
  */
 
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/MaterialTools/Parallel.h"
 #include "Magnum/MaterialTools/visibility.h"
 #include "Magnum/Trade/Trade.h"
 
@@ -90,9 +93,39 @@ As the input materials have the attributes sorted already, the operation is
 done in an @f$ \mathcal{O}(m + n) @f$ execution time and memory complexity,
 with @f$ m @f$ and @f$ n @f$ being count of all attributes and layers in
 @p first and @p second, respectively.
+@see @ref merge(const Containers::Iterable<const Trade::MaterialData>&, const Containers::Iterable<const Trade::MaterialData>&, MergeConflicts, ParallelFor, void*)
 */
 Containers::Optional<Trade::MaterialData> MAGNUM_MATERIALTOOLS_EXPORT merge(const Trade::MaterialData& first, const Trade::MaterialData& second, MergeConflicts conflicts = MergeConflicts::Fail);
 
+/**
+@brief Merge pairs of materials in a batch
+@param first            First materials
+@param second           Second materials. Expected to have the same size as
+    @p first.
+@param conflicts        Conflict resolution
+@param parallelFor      Parallel loop executor or @cpp nullptr @ce
+@param parallelForState State pointer passed to @p parallelFor
+@m_since_latest
+
+Equivalent to calling @ref merge(const Trade::MaterialData&, const Trade::MaterialData&, MergeConflicts)
+on every pair of materials from @p first and @p second, with the work
+distributed across @p parallelFor. If merging any of the pairs fails, prints
+messages for all failed pairs to @relativeref{Magnum,Error} and returns
+@relativeref{Corrade,Containers::NullOpt}. The messages are printed from the
+threads executing the tasks, in an unspecified order.
+
+Instead of allocating every material separately, the returned materials
+together with all their attributes and layer offsets are placed in a single
+allocation owned by the returned array, which uses a custom deleter. The
+@ref Trade::MaterialData::attributeDataFlags() and
+@relativeref{Trade::MaterialData,layerDataFlags()} of the materials are thus
+empty and the materials are valid only as long as the returned array is. Use
+@ref copy(const Trade::MaterialData&) to turn any of them into a
+self-contained instance.
+@see @ref ParallelFor, @ref parallelForSerial()
+*/
+MAGNUM_MATERIALTOOLS_EXPORT Containers::Optional<Containers::Array<Trade::MaterialData>> merge(const Containers::Iterable<const Trade::MaterialData>& first, const Containers::Iterable<const Trade::MaterialData>& second, MergeConflicts conflicts = MergeConflicts::Fail, ParallelFor parallelFor = parallelForSerial, void* parallelForState = nullptr);
+
 }}
 
 #endif
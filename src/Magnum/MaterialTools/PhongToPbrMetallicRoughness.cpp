@@ -26,29 +26,42 @@
 
 #include "PhongToPbrMetallicRoughness.h"
 
+#include <algorithm>
 #include <Corrade/Containers/BitArray.h>
 #include <Corrade/Containers/BitArrayView.h>
 #include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Vector4.h"
-#include "Magnum/MaterialTools/Filter.h"
-#include "Magnum/MaterialTools/Merge.h"
+#include "Magnum/MaterialTools/Implementation/materialBatch.h"
 #include "Magnum/Trade/MaterialData.h"
 
 namespace Magnum { namespace MaterialTools {
 
 using namespace Containers::Literals;
 
-Containers::Optional<Trade::MaterialData> phongToPbrMetallicRoughness(const Trade::MaterialData& material, const PhongToPbrMetallicRoughnessFlags flags) {
-    /* Attributes to merge into the base layer. We'll need at most 5 -- color,
-       texture and texture layer/coordinates/matrix. */
-    Containers::Array<Trade::MaterialAttributeData> attributes;
-    arrayReserve(attributes, 5);
+namespace {
+
+/* At most 5 attributes get added to the base layer -- color, texture and
+   texture layer/coordinates/matrix */
+constexpr std::size_t MaxAddedAttributes = 5;
+
+/* Writes converted attributes to the attributes view, which is expected to
+   have space for all input attributes plus MaxAddedAttributes, and layer
+   offsets to the layers view, which is expected to have a size matching the
+   input layer count. The attributesToKeep view is used as a scratch memory
+   and is expected to have a size matching the input attribute count. Returns
+   the actual attribute count or NullOpt on failure. */
+Containers::Optional<std::size_t> phongToPbrMetallicRoughnessInto(const Trade::MaterialData& material, const PhongToPbrMetallicRoughnessFlags flags, const Containers::MutableBitArrayView attributesToKeep, const Containers::ArrayView<Trade::MaterialAttributeData> attributes, const Containers::ArrayView<UnsignedInt> layers) {
+    /* Attributes to merge into the base layer */
+    Trade::MaterialAttributeData addedAttributes[MaxAddedAttributes];
+    std::size_t addedAttributeCount = 0;
 
     /* Attributes to keep */
-    Containers::BitArray attributesToKeep{DirectInit, material.attributeDataOffset(material.layerCount()), true};
+    attributesToKeep.setAll();
 
     /* Decide about unconvertable attributes */
     /** @todo conversion of these:
@@ -105,7 +118,7 @@ Containers::Optional<Trade::MaterialData> phongToPbrMetallicRoughness(const Trad
     if(const Containers::Optional<UnsignedInt> id = material.findAttributeId(Trade::MaterialAttribute::DiffuseColor)) {
         /* Convert only if the target attribute isn't there already */
         if(!material.hasAttribute(Trade::MaterialAttribute::BaseColor))
-            arrayAppend(attributes, InPlaceInit, Trade::MaterialAttribute::BaseColor, material.attribute<Vector4>(*id));
+            addedAttributes[addedAttributeCount++] = Trade::MaterialAttributeData{Trade::MaterialAttribute::BaseColor, material.attribute<Vector4>(*id)};
 
         /* Skip unless we're told to keep the original attributes */
         if(!(flags >= PhongToPbrMetallicRoughnessFlag::KeepOriginalAttributes))
@@ -120,13 +133,13 @@ Containers::Optional<Trade::MaterialData> phongToPbrMetallicRoughness(const Trad
 
         /* Convert only if the target attribute isn't there already */
         if(!material.hasAttribute(Trade::MaterialAttribute::BaseColorTexture)) {
-            arrayAppend(attributes, InPlaceInit, Trade::MaterialAttribute::BaseColorTexture, material.attribute<UnsignedInt>(*id));
+            addedAttributes[addedAttributeCount++] = Trade::MaterialAttributeData{Trade::MaterialAttribute::BaseColorTexture, material.attribute<UnsignedInt>(*id)};
             if(matrixId)
-                arrayAppend(attributes, InPlaceInit, Trade::MaterialAttribute::BaseColorTextureMatrix, material.attribute<Matrix3>(*matrixId));
+                addedAttributes[addedAttributeCount++] = Trade::MaterialAttributeData{Trade::MaterialAttribute::BaseColorTextureMatrix, material.attribute<Matrix3>(*matrixId)};
             if(coordinatesId)
-                arrayAppend(attributes, InPlaceInit, Trade::MaterialAttribute::BaseColorTextureCoordinates, material.attribute<UnsignedInt>(*coordinatesId));
+                addedAttributes[addedAttributeCount++] = Trade::MaterialAttributeData{Trade::MaterialAttribute::BaseColorTextureCoordinates, material.attribute<UnsignedInt>(*coordinatesId)};
             if(layerId)
-                arrayAppend(attributes, InPlaceInit, Trade::MaterialAttribute::BaseColorTextureLayer, material.attribute<UnsignedInt>(*layerId));
+                addedAttributes[addedAttributeCount++] = Trade::MaterialAttributeData{Trade::MaterialAttribute::BaseColorTextureLayer, material.attribute<UnsignedInt>(*layerId)};
         }
 
         /* Skip unless we're told to keep the original attributes */
@@ -141,13 +154,122 @@ Containers::Optional<Trade::MaterialData> phongToPbrMetallicRoughness(const Trad
         }
     }
 
-    /* Filter & merge the attributes -- they have to be moved into the
-       constructor in order to get sorted. Remove the Phong type from the
-       output as well. There should be no conflicts if we did everything above
-       correctly, so just unpack the Optional directly. */
-    return *CORRADE_INTERNAL_ASSERT_EXPRESSION(merge(
-        filterAttributes(material, attributesToKeep, ~Trade::MaterialType::Phong),
-        Trade::MaterialData{Trade::MaterialType::PbrMetallicRoughness, Utility::move(attributes)}));
+    /* Merge the added attributes with attributes that are kept in the base
+       layer, preserving the sorted order. There should be no conflicts if we
+       did everything above correctly. Other layers are just filtered. */
+    std::sort(addedAttributes, addedAttributes + addedAttributeCount, [](const Trade::MaterialAttributeData& a, const Trade::MaterialAttributeData& b) {
+        return a.name() < b.name();
+    });
+    std::size_t attributeCount = 0;
+    std::size_t addedAttribute = 0;
+    for(UnsignedInt i = 0, iMax = material.attributeDataOffset(1); i != iMax; ++i) {
+        if(!attributesToKeep[i]) continue;
+
+        const Trade::MaterialAttributeData& attribute = material.attributeData()[i];
+        while(addedAttribute != addedAttributeCount && addedAttributes[addedAttribute].name() < attribute.name())
+            attributes[attributeCount++] = addedAttributes[addedAttribute++];
+        CORRADE_INTERNAL_ASSERT(addedAttribute == addedAttributeCount || addedAttributes[addedAttribute].name() != attribute.name());
+        attributes[attributeCount++] = attribute;
+    }
+    while(addedAttribute != addedAttributeCount)
+        attributes[attributeCount++] = addedAttributes[addedAttribute++];
+    layers[0] = attributeCount;
+
+    for(UnsignedInt layer = 1; layer != material.layerCount(); ++layer) {
+        for(UnsignedInt i = material.attributeDataOffset(layer), iMax = material.attributeDataOffset(layer + 1); i != iMax; ++i)
+            if(attributesToKeep[i])
+                attributes[attributeCount++] = material.attributeData()[i];
+        layers[layer] = attributeCount;
+    }
+
+    return attributeCount;
+}
+
+/* Remove the Phong type from the output as well */
+Trade::MaterialTypes outputTypes(const Trade::MaterialData& material) {
+    return (material.types() & ~Trade::MaterialType::Phong)|Trade::MaterialType::PbrMetallicRoughness;
+}
+
+struct PhongToPbrMetallicRoughnessState {
+    const Containers::Iterable<const Trade::MaterialData>& materials;
+    PhongToPbrMetallicRoughnessFlags flags;
+    /* Offsets into the scratch bits, the batch attribute storage and the
+       batch layer storage, materialCount + 1 items each */
+    Containers::ArrayView<const std::size_t> bitOffsets;
+    Containers::ArrayView<const std::size_t> attributeOffsets;
+    Containers::ArrayView<const std::size_t> layerOffsets;
+    /* Actual attribute count for every material or ~std::size_t{} if the
+       conversion failed */
+    Containers::ArrayView<std::size_t> attributeCounts;
+    Containers::MutableBitArrayView attributesToKeep;
+    Containers::ArrayView<Trade::MaterialAttributeData> attributes;
+    Containers::ArrayView<UnsignedInt> layers;
+};
+
+void phongToPbrMetallicRoughnessTask(void* const taskState, const std::size_t i) {
+    PhongToPbrMetallicRoughnessState& state = *static_cast<PhongToPbrMetallicRoughnessState*>(taskState);
+    const Trade::MaterialData& material = state.materials[i];
+    const Containers::Optional<std::size_t> attributeCount = phongToPbrMetallicRoughnessInto(material, state.flags,
+        state.attributesToKeep.sliceSize(state.bitOffsets[i], material.attributeData().size()),
+        state.attributes.slice(state.attributeOffsets[i], state.attributeOffsets[i + 1]),
+        state.layers.slice(state.layerOffsets[i], state.layerOffsets[i + 1]));
+    state.attributeCounts[i] = attributeCount ? *attributeCount : ~std::size_t{};
+}
+
+}
+
+Containers::Optional<Trade::MaterialData> phongToPbrMetallicRoughness(const Trade::MaterialData& material, const PhongToPbrMetallicRoughnessFlags flags) {
+    /* Allocate for the worst case where all attributes are kept and all
+       possible attributes are added, shrink afterwards */
+    Containers::BitArray attributesToKeep{NoInit, material.attributeData().size()};
+    Containers::Array<Trade::MaterialAttributeData> attributes;
+    arrayResize(attributes, NoInit, material.attributeData().size() + MaxAddedAttributes);
+    Containers::Array<UnsignedInt> layers{NoInit, material.layerCount()};
+
+    const Containers::Optional<std::size_t> attributeCount = phongToPbrMetallicRoughnessInto(material, flags, attributesToKeep, attributes, layers);
+    if(!attributeCount) return {};
+    arrayRemoveSuffix(attributes, attributes.size() - *attributeCount);
+
+    return Trade::MaterialData{outputTypes(material), Utility::move(attributes), Utility::move(layers)};
+}
+
+Containers::Optional<Containers::Array<Trade::MaterialData>> phongToPbrMetallicRoughness(const Containers::Iterable<const Trade::MaterialData>& materials, const PhongToPbrMetallicRoughnessFlags flags, const ParallelFor parallelFor, void* const parallelForState) {
+    /* Calculate offsets of each material in the scratch bits and in the batch
+       storage, assuming the worst case for the attribute count. Scratch bits
+       of each material start at a byte boundary so tasks for neighboring
+       materials don't write to the same byte. */
+    const std::size_t materialCount = materials.size();
+    Containers::Array<std::size_t> offsets{NoInit, 4*materialCount + 3};
+    const Containers::ArrayView<std::size_t> bitOffsets = offsets.prefix(materialCount + 1);
+    const Containers::ArrayView<std::size_t> attributeOffsets = offsets.sliceSize(materialCount + 1, materialCount + 1);
+    const Containers::ArrayView<std::size_t> layerOffsets = offsets.sliceSize(2*materialCount + 2, materialCount + 1);
+    const Containers::ArrayView<std::size_t> attributeCounts = offsets.exceptPrefix(3*materialCount + 3);
+    bitOffsets[0] = 0;
+    attributeOffsets[0] = 0;
+    layerOffsets[0] = 0;
+    for(std::size_t i = 0; i != materialCount; ++i) {
+        const std::size_t attributeCount = materials[i].attributeData().size();
+        bitOffsets[i + 1] = bitOffsets[i] + (attributeCount + 7)/8*8;
+        attributeOffsets[i + 1] = attributeOffsets[i] + attributeCount + MaxAddedAttributes;
+        layerOffsets[i + 1] = layerOffsets[i] + materials[i].layerCount();
+    }
+
+    Containers::BitArray attributesToKeep{NoInit, bitOffsets.back()};
+    Implementation::MaterialBatch batch{materialCount, attributeOffsets.back(), layerOffsets.back()};
+    PhongToPbrMetallicRoughnessState state{materials, flags, bitOffsets, attributeOffsets, layerOffsets, attributeCounts, attributesToKeep, batch.attributes(), batch.layers()};
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, materialCount, phongToPbrMetallicRoughnessTask, &state);
+
+    /* If any of the conversions failed, fail the whole operation. The message
+       was already printed by the task. */
+    for(std::size_t i = 0; i != materialCount; ++i)
+        if(attributeCounts[i] == ~std::size_t{}) return {};
+
+    for(std::size_t i = 0; i != materialCount; ++i)
+        batch.set(i, outputTypes(materials[i]),
+            batch.attributes().sliceSize(attributeOffsets[i], attributeCounts[i]),
+            batch.layers().slice(layerOffsets[i], layerOffsets[i + 1]));
+
+    return batch.release();
 }
 
 }}
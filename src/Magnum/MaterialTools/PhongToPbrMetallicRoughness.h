@@ -34,6 +34,7 @@
 #include <Corrade/Containers/EnumSet.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/MaterialTools/Parallel.h"
 #include "Magnum/MaterialTools/visibility.h"
 #include "Magnum/Trade/Trade.h"
 
@@ -138,10 +139,37 @@ All other attributes (including ones common for Phong and PBR such as
 resulting material has @ref Trade::MaterialType::PbrMetallicRoughness set and
 @ref Trade::MaterialType::Phong removed.
 
-@see @ref Trade::PbrMetallicRoughnessMaterialData
+@see @ref Trade::PbrMetallicRoughnessMaterialData,
+    @ref phongToPbrMetallicRoughness(const Containers::Iterable<const Trade::MaterialData>&, PhongToPbrMetallicRoughnessFlags, ParallelFor, void*)
 */
 MAGNUM_MATERIALTOOLS_EXPORT Containers::Optional<Trade::MaterialData> phongToPbrMetallicRoughness(const Trade::MaterialData& material, PhongToPbrMetallicRoughnessFlags flags = {});
 
+/**
+@brief Convert a batch of Phong materials to PBR metallic/roughness
+@param materials        Materials to convert
+@param flags            Conversion flags
+@param parallelFor      Parallel loop executor or @cpp nullptr @ce
+@param parallelForState State pointer passed to @p parallelFor
+@m_since_latest
+
+Equivalent to calling @ref phongToPbrMetallicRoughness(const Trade::MaterialData&, PhongToPbrMetallicRoughnessFlags)
+on every material in @p materials, with the work distributed across
+@p parallelFor. If the conversion of any material fails, returns
+@relativeref{Corrade,Containers::NullOpt}. Messages for all materials are
+printed from the threads executing the tasks, in an unspecified order.
+
+Instead of allocating every material separately, the returned materials
+together with all their attributes and layer offsets are placed in a single
+allocation owned by the returned array, which uses a custom deleter. The
+@ref Trade::MaterialData::attributeDataFlags() and
+@relativeref{Trade::MaterialData,layerDataFlags()} of the materials are thus
+empty and the materials are valid only as long as the returned array is. Use
+@ref copy(const Trade::MaterialData&) to turn any of them into a
+self-contained instance.
+@see @ref ParallelFor, @ref parallelForSerial()
+*/
+MAGNUM_MATERIALTOOLS_EXPORT Containers::Optional<Containers::Array<Trade::MaterialData>> phongToPbrMetallicRoughness(const Containers::Iterable<const Trade::MaterialData>& materials, PhongToPbrMetallicRoughnessFlags flags = {}, ParallelFor parallelFor = parallelForSerial, void* parallelForState = nullptr);
+
 }}
 
 #endif
@@ -26,9 +26,12 @@
 
 #include "RemoveDuplicates.h"
 
+#include <unordered_map>
 #include <Corrade/Containers/Iterable.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/MaterialTools/Implementation/attributesEqual.h"
 #include "Magnum/Trade/MaterialData.h"
@@ -75,22 +78,88 @@ bool materialEqual(const Trade::MaterialData& a, const Trade::MaterialData& b) {
     return true;
 }
 
+std::size_t hashBytes(const void* data, const std::size_t size) {
+    return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(static_cast<const char*>(data), size).byteArray());
+}
+
+void hashCombine(std::size_t& seed, const std::size_t value) {
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+/* Has to give the same value for all materials that materialEqual() considers
+   equal. Floating-point values are compared with fuzzy comparison, so for
+   those only the type is hashed and the values get compared only when the
+   hashes match. */
+std::size_t materialHash(const Trade::MaterialData& material) {
+    std::size_t seed = std::size_t(UnsignedInt(material.types()));
+
+    /* Implicit layer data and a single layer are equivalent, so hash the
+       layer offsets only if there's more than one */
+    const Containers::ArrayView<const UnsignedInt> layerData = material.layerData();
+    if(layerData.size() > 1)
+        hashCombine(seed, hashBytes(layerData.data(), layerData.size()*sizeof(UnsignedInt)));
+
+    for(const Trade::MaterialAttributeData& attribute: material.attributeData()) {
+        const Containers::StringView name = attribute.name();
+        hashCombine(seed, hashBytes(name.data(), name.size()));
+        hashCombine(seed, std::size_t(attribute.type()));
+
+        switch(attribute.type()) {
+            /* Compared with fuzzy comparison, can't be hashed */
+            case Trade::MaterialAttributeType::Float:
+            case Trade::MaterialAttributeType::Deg:
+            case Trade::MaterialAttributeType::Rad:
+            case Trade::MaterialAttributeType::Vector2:
+            case Trade::MaterialAttributeType::Vector3:
+            case Trade::MaterialAttributeType::Vector4:
+            case Trade::MaterialAttributeType::Matrix2x2:
+            case Trade::MaterialAttributeType::Matrix2x3:
+            case Trade::MaterialAttributeType::Matrix2x4:
+            case Trade::MaterialAttributeType::Matrix3x2:
+            case Trade::MaterialAttributeType::Matrix3x3:
+            case Trade::MaterialAttributeType::Matrix3x4:
+            case Trade::MaterialAttributeType::Matrix4x2:
+            case Trade::MaterialAttributeType::Matrix4x3:
+                break;
+            case Trade::MaterialAttributeType::String: {
+                const Containers::StringView value = attribute.value<Containers::StringView>();
+                hashCombine(seed, hashBytes(value.data(), value.size()));
+            } break;
+            case Trade::MaterialAttributeType::Buffer: {
+                const Containers::ArrayView<const void> value = attribute.value<Containers::ArrayView<const void>>();
+                hashCombine(seed, hashBytes(value.data(), value.size()));
+            } break;
+            /* Everything else is compared exactly, for pointers value() gives
+               back a pointer to the pointer */
+            default:
+                hashCombine(seed, hashBytes(attribute.value(), Trade::materialAttributeTypeSize(attribute.type())));
+        }
+    }
+
+    return seed;
+}
+
 }
 
 std::size_t removeDuplicatesInPlaceInto(const Containers::Iterable<Trade::MaterialData>& materials, const Containers::StridedArrayView1D<UnsignedInt>& mapping) {
     CORRADE_ASSERT(mapping.size() == materials.size(),
         "MaterialTools::removeDuplicatesInPlaceInto(): bad output size, expected" << materials.size() << "but got" << mapping.size(), {});
 
-    /* O(n^2). As there's a lot of early returns, should be fine for a moderate
-       count of materials that differ in a significant way. Won't work well for
-       materials that are all the same except one attribute value. */
+    /* Materials are bucketed by a hash and then compared only to unique
+       materials in the same bucket, which makes this near-linear unless the
+       materials differ only in floating-point values that can't be hashed.
+       The table maps hashes to indices in the unique prefix. */
+    std::unordered_multimap<std::size_t, UnsignedInt> table;
+    table.reserve(materials.size());
+
     std::size_t uniqueCount = 0;
     for(std::size_t i = 0; i != materials.size(); ++i) {
         /* Find a material that's already in the unique set */
+        const std::size_t hash = materialHash(materials[i]);
         Containers::Optional<UnsignedInt> found;
-        for(std::size_t j = 0; j != uniqueCount; ++j) {
-            if(materialEqual(materials[i], materials[j])) {
-                found = j;
+        for(auto range = table.equal_range(hash); range.first != range.second; ++range.first) {
+            if(materialEqual(materials[i], materials[range.first->second])) {
+                found = range.first->second;
                 break;
             }
         }
@@ -104,6 +173,7 @@ std::size_t removeDuplicatesInPlaceInto(const Containers::Iterable<Trade::Materi
         } else {
             if(uniqueCount != i)
                 materials[uniqueCount] = Utility::move(materials[i]);
+            table.emplace(hash, uniqueCount);
             mapping[i] = uniqueCount++;
         }
     }
@@ -121,22 +191,20 @@ std::size_t removeDuplicatesInto(const Containers::Iterable<const Trade::Materia
     CORRADE_ASSERT(mapping.size() == materials.size(),
         "MaterialTools::removeDuplicatesInto(): bad output size, expected" << materials.size() << "but got" << mapping.size(), {});
 
-    /* O(n^2). Like removeDuplicatesInPlaceInto(), but as the input material
-       list is immutable, it has to go through the already-processed prefix
-       and compare only against materials that are unique, which may add some
-       extra overhead. Another option would be to allocate a temporary array
-       with (contiguous) references to the material data, but so far I think
-       the prefix iteration is efficient enough to not need that. */
+    /* Like removeDuplicatesInPlaceInto(), but as the input material list is
+       immutable, the table maps hashes to the original indices of unique
+       materials */
+    std::unordered_multimap<std::size_t, UnsignedInt> table;
+    table.reserve(materials.size());
+
     std::size_t uniqueCount = 0;
     for(std::size_t i = 0; i != materials.size(); ++i) {
-        /* Find a material that's already in the unique set by going through
-           the already-processed prefix and comparing only against materials
-           that are unique, i.e. for which the output index is the same as the
-           input index. */
+        /* Find a material that's already in the unique set */
+        const std::size_t hash = materialHash(materials[i]);
         Containers::Optional<UnsignedInt> found;
-        for(std::size_t j = 0; j != i; ++j) {
-            if(mapping[j] == j && materialEqual(materials[i], materials[j])) {
-                found = j;
+        for(auto range = table.equal_range(hash); range.first != range.second; ++range.first) {
+            if(materialEqual(materials[i], materials[range.first->second])) {
+                found = range.first->second;
                 break;
             }
         }
@@ -149,6 +217,7 @@ std::size_t removeDuplicatesInto(const Containers::Iterable<const Trade::Materia
            increase the number of unique materials which isn't used for
            anything here except the return value. */
         } else {
+            table.emplace(hash, i);
             mapping[i] = i;
             uniqueCount++;
         }
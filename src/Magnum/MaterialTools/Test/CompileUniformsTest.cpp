@@ -0,0 +1,194 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/MaterialTools/CompileUniforms.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Shaders/Phong.h"
+#include "Magnum/Trade/PhongMaterialData.h"
+
+namespace Magnum { namespace MaterialTools { namespace Test { namespace {
+
+struct CompileUniformsTest: TestSuite::Tester {
+    explicit CompileUniformsTest();
+
+    void phong();
+    void phongDefaults();
+    void phongBaseColorFallback();
+    void phongIntoNoTextures();
+
+    void phongWrongOutputSize();
+};
+
+CompileUniformsTest::CompileUniformsTest() {
+    addTests({&CompileUniformsTest::phong,
+              &CompileUniformsTest::phongDefaults,
+              &CompileUniformsTest::phongBaseColorFallback,
+              &CompileUniformsTest::phongIntoNoTextures,
+
+              &CompileUniformsTest::phongWrongOutputSize});
+}
+
+using namespace Math::Literals;
+
+void CompileUniformsTest::phong() {
+    const Trade::MaterialData materials[]{
+        Trade::MaterialData{Trade::MaterialType::Phong, {
+            {Trade::MaterialAttribute::AmbientColor, 0x11223344_rgbaf},
+            {Trade::MaterialAttribute::DiffuseColor, 0x55667788_rgbaf},
+            {Trade::MaterialAttribute::DiffuseTexture, 3u},
+            {Trade::MaterialAttribute::SpecularColor, 0x99aabbcc_rgbaf},
+            {Trade::MaterialAttribute::SpecularTexture, 5u},
+            {Trade::MaterialAttribute::NormalTexture, 7u},
+            {Trade::MaterialAttribute::NormalTextureScale, 0.25f},
+            {Trade::MaterialAttribute::Shininess, 12.0f},
+            {Trade::MaterialAttribute::AlphaMask, 0.75f},
+        }},
+        Trade::MaterialData{Trade::MaterialType::Phong, {
+            {Trade::MaterialAttribute::AmbientTexture, 1u},
+            {Trade::MaterialAttribute::DiffuseColor, 0xddeeff99_rgbaf},
+        }},
+    };
+
+    Containers::Pair<Containers::Array<Shaders::PhongMaterialUniform>, Containers::Array<PhongMaterialTextures>> out = compilePhongUniforms(materials);
+    CORRADE_COMPARE(out.first().size(), 2);
+    CORRADE_COMPARE(out.second().size(), 2);
+
+    CORRADE_COMPARE(out.first()[0].ambientColor, 0x11223344_rgbaf);
+    CORRADE_COMPARE(out.first()[0].diffuseColor, 0x55667788_rgbaf);
+    CORRADE_COMPARE(out.first()[0].specularColor, 0x99aabbcc_rgbaf);
+    CORRADE_COMPARE(out.first()[0].normalTextureScale, 0.25f);
+    CORRADE_COMPARE(out.first()[0].shininess, 12.0f);
+    CORRADE_COMPARE(out.first()[0].alphaMask, 0.75f);
+    CORRADE_COMPARE(out.second()[0].ambientTexture, ~UnsignedInt{});
+    CORRADE_COMPARE(out.second()[0].diffuseTexture, 3);
+    CORRADE_COMPARE(out.second()[0].specularTexture, 5);
+    CORRADE_COMPARE(out.second()[0].normalTexture, 7);
+
+    /* Ambient color defaults to white if there's an ambient texture, same as
+       in Trade::PhongMaterialData */
+    CORRADE_COMPARE(out.first()[1].ambientColor, 0xffffffff_rgbaf);
+    CORRADE_COMPARE(out.first()[1].diffuseColor, 0xddeeff99_rgbaf);
+    CORRADE_COMPARE(out.second()[1].ambientTexture, 1);
+    CORRADE_COMPARE(out.second()[1].diffuseTexture, ~UnsignedInt{});
+}
+
+void CompileUniformsTest::phongDefaults() {
+    const Trade::MaterialData materials[]{
+        Trade::MaterialData{{}, {}}
+    };
+
+    Containers::Pair<Containers::Array<Shaders::PhongMaterialUniform>, Containers::Array<PhongMaterialTextures>> out = compilePhongUniforms(materials);
+    CORRADE_COMPARE(out.first().size(), 1);
+
+    /* Same as defaults in Trade::PhongMaterialData */
+    const Trade::PhongMaterialData& phong = materials[0].as<Trade::PhongMaterialData>();
+    CORRADE_COMPARE(out.first()[0].ambientColor, phong.ambientColor());
+    CORRADE_COMPARE(out.first()[0].diffuseColor, phong.diffuseColor());
+    CORRADE_COMPARE(out.first()[0].specularColor, phong.specularColor());
+    CORRADE_COMPARE(out.first()[0].shininess, phong.shininess());
+    CORRADE_COMPARE(out.first()[0].alphaMask, phong.alphaMask());
+    CORRADE_COMPARE(out.first()[0].normalTextureScale, 1.0f);
+    CORRADE_COMPARE(out.second()[0].ambientTexture, ~UnsignedInt{});
+    CORRADE_COMPARE(out.second()[0].diffuseTexture, ~UnsignedInt{});
+    CORRADE_COMPARE(out.second()[0].specularTexture, ~UnsignedInt{});
+    CORRADE_COMPARE(out.second()[0].normalTexture, ~UnsignedInt{});
+}
+
+void CompileUniformsTest::phongBaseColorFallback() {
+    const Trade::MaterialData materials[]{
+        /* PBR material, base color is used */
+        Trade::MaterialData{Trade::MaterialType::PbrMetallicRoughness, {
+            {Trade::MaterialAttribute::BaseColor, 0x33669900_rgbaf},
+            {Trade::MaterialAttribute::BaseColorTexture, 4u},
+        }},
+        /* Material with both, diffuse properties have a precedence */
+        Trade::MaterialData{Trade::MaterialType::Phong|Trade::MaterialType::PbrMetallicRoughness, {
+            {Trade::MaterialAttribute::BaseColor, 0x33669900_rgbaf},
+            {Trade::MaterialAttribute::BaseColorTexture, 4u},
+            {Trade::MaterialAttribute::DiffuseColor, 0xff336699_rgbaf},
+        }},
+    };
+
+    Containers::Pair<Containers::Array<Shaders::PhongMaterialUniform>, Containers::Array<PhongMaterialTextures>> out = compilePhongUniforms(materials);
+    CORRADE_COMPARE(out.first()[0].diffuseColor, 0x33669900_rgbaf);
+    CORRADE_COMPARE(out.second()[0].diffuseTexture, 4);
+    CORRADE_COMPARE(out.first()[1].diffuseColor, 0xff336699_rgbaf);
+    CORRADE_COMPARE(out.second()[1].diffuseTexture, ~UnsignedInt{});
+}
+
+void CompileUniformsTest::phongIntoNoTextures() {
+    const Trade::MaterialData materials[]{
+        Trade::MaterialData{Trade::MaterialType::Phong, {
+            {Trade::MaterialAttribute::DiffuseColor, 0x55667788_rgbaf},
+            {Trade::MaterialAttribute::DiffuseTexture, 3u},
+        }},
+        Trade::MaterialData{Trade::MaterialType::Phong, {
+            {Trade::MaterialAttribute::Shininess, 3.0f},
+        }},
+    };
+
+    /* The uniforms can be a part of a larger struct, such as when being
+       interleaved with other data in a buffer */
+    struct Interleaved {
+        Int other;
+        Shaders::PhongMaterialUniform uniform;
+    } data[2];
+    compilePhongUniformsInto(materials, Containers::stridedArrayView(data).slice(&Interleaved::uniform), nullptr);
+    CORRADE_COMPARE(data[0].uniform.diffuseColor, 0x55667788_rgbaf);
+    CORRADE_COMPARE(data[1].uniform.shininess, 3.0f);
+}
+
+void CompileUniformsTest::phongWrongOutputSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MaterialData materials[]{
+        Trade::MaterialData{{}, {}},
+        Trade::MaterialData{{}, {}},
+    };
+    Shaders::PhongMaterialUniform uniforms[2];
+    Shaders::PhongMaterialUniform uniformsWrong[3];
+    PhongMaterialTextures texturesWrong[1];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    compilePhongUniformsInto(materials, uniformsWrong, nullptr);
+    compilePhongUniformsInto(materials, uniforms, texturesWrong);
+    CORRADE_COMPARE(out.str(),
+        "MaterialTools::compilePhongUniformsInto(): expected 2 uniforms but got 3\n"
+        "MaterialTools::compilePhongUniformsInto(): expected 2 texture bindings but got 1\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MaterialTools::Test::CompileUniformsTest)
@@ -27,12 +27,14 @@
 #include <sstream>
 #include <Corrade/Containers/BitArray.h>
 #include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/Iterable.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/DebugStl.h>
 
 #include "Magnum/DebugTools/CompareMaterial.h"
 #include "Magnum/MaterialTools/Filter.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Test/parallelFor.h"
 #include "Magnum/Trade/MaterialData.h"
 
 namespace Magnum { namespace MaterialTools { namespace Test { namespace {
@@ -43,6 +45,8 @@ struct FilterTest: TestSuite::Tester {
     void attributes();
     void attributesMultipleLayers();
     void attributesWrongBitCount();
+    void attributesBatch();
+    void attributesBatchWrongBitCount();
 
     void layers();
     void layersRemoveBase();
@@ -59,6 +63,8 @@ FilterTest::FilterTest() {
     addTests({&FilterTest::attributes,
               &FilterTest::attributesMultipleLayers,
               &FilterTest::attributesWrongBitCount,
+              &FilterTest::attributesBatch,
+              &FilterTest::attributesBatchWrongBitCount,
 
               &FilterTest::layers,
               &FilterTest::layersRemoveBase,
@@ -73,6 +79,8 @@ FilterTest::FilterTest() {
 
 using namespace Math::Literals;
 
+using Magnum::Test::parallelForReverse;
+
 void FilterTest::attributes() {
     /* Supplying the attributes as external in order to make sure they're
        sorted for correct numbering */
@@ -168,6 +176,72 @@ void FilterTest::attributesWrongBitCount() {
     CORRADE_COMPARE(out.str(), "MaterialTools::filterAttributes(): expected 4 bits but got 5\n");
 }
 
+void FilterTest::attributesBatch() {
+    const Trade::MaterialData materials[]{
+        Trade::MaterialData{Trade::MaterialType::PbrClearCoat|Trade::MaterialType::Flat, {
+            {Trade::MaterialAttribute::AlphaBlend, true},
+            {Trade::MaterialAttribute::BaseColor, 0xffcc66ff_rgbaf},
+            {Trade::MaterialAttribute::BaseColorTexture, 7u},
+        }},
+        Trade::MaterialData{Trade::MaterialType::Phong, {}},
+        Trade::MaterialData{Trade::MaterialType::PbrClearCoat, {
+            {Trade::MaterialAttribute::BaseColor, 0xffcc66ff_rgbaf},
+            {Trade::MaterialLayer::ClearCoat},
+            {Trade::MaterialAttribute::LayerFactor, 0.7f},
+            {Trade::MaterialAttribute::Roughness, 0.25f},
+            {"texturePointer", nullptr},
+        }, {1, 4, 4, 5}},
+    };
+
+    /* The bits for all materials are concatenated */
+    Containers::BitArray attributesToKeep{DirectInit, 8, true};
+    attributesToKeep.reset(1);
+    attributesToKeep.reset(4);
+
+    Containers::Array<Trade::MaterialData> filtered = filterAttributes(materials, attributesToKeep, ~Trade::MaterialType::Flat, parallelForReverse);
+    CORRADE_COMPARE(filtered.size(), 3);
+
+    /* The materials reference a single allocation owned by the array */
+    for(const Trade::MaterialData& material: filtered) {
+        CORRADE_ITERATION(&material - filtered.data());
+        CORRADE_COMPARE(material.attributeDataFlags(), Trade::DataFlags{});
+        CORRADE_COMPARE(material.layerDataFlags(), Trade::DataFlags{});
+    }
+
+    CORRADE_COMPARE_AS(filtered[0], (Trade::MaterialData{Trade::MaterialType::PbrClearCoat, {
+        {Trade::MaterialAttribute::AlphaBlend, true},
+        {Trade::MaterialAttribute::BaseColorTexture, 7u},
+    }}), DebugTools::CompareMaterial);
+    CORRADE_COMPARE_AS(filtered[1], (Trade::MaterialData{Trade::MaterialType::Phong, {}}), DebugTools::CompareMaterial);
+    CORRADE_COMPARE_AS(filtered[2], (Trade::MaterialData{Trade::MaterialType::PbrClearCoat, {
+        {Trade::MaterialAttribute::BaseColor, 0xffcc66ff_rgbaf},
+        {Trade::MaterialAttribute::LayerFactor, 0.7f},
+        {Trade::MaterialAttribute::Roughness, 0.25f},
+        /* Empty layer stays */
+        {"texturePointer", nullptr},
+    }, {1, 3, 3, 4}}), DebugTools::CompareMaterial);
+}
+
+void FilterTest::attributesBatchWrongBitCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MaterialData materials[]{
+        Trade::MaterialData{{}, {
+            {Trade::MaterialAttribute::BaseColor, 0xffcc66ff_rgbaf},
+            {Trade::MaterialAttribute::BaseColorTexture, 7u},
+        }},
+        Trade::MaterialData{{}, {
+            {Trade::MaterialAttribute::LayerFactor, 0.7f},
+        }},
+    };
+    Containers::BitArrayView attributesToKeep{nullptr, 0, 4};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    filterAttributes(materials, attributesToKeep);
+    CORRADE_COMPARE(out.str(), "MaterialTools::filterAttributes(): expected 3 bits but got 4\n");
+}
+
 void FilterTest::layers() {
     const Trade::MaterialAttributeData attributes[]{
         {Trade::MaterialAttribute::AlphaBlend, true},               /* 0 */
@@ -0,0 +1,205 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StringIterable.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/MaterialTools/FindAttributeIds.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/MaterialData.h"
+
+namespace Magnum { namespace MaterialTools { namespace Test { namespace {
+
+struct FindAttributeIdsTest: TestSuite::Tester {
+    explicit FindAttributeIdsTest();
+
+    void strings();
+    void enums();
+    void layer();
+    void into();
+    void empty();
+
+    void wrongOutputSize();
+};
+
+FindAttributeIdsTest::FindAttributeIdsTest() {
+    addTests({&FindAttributeIdsTest::strings,
+              &FindAttributeIdsTest::enums,
+              &FindAttributeIdsTest::layer,
+              &FindAttributeIdsTest::into,
+              &FindAttributeIdsTest::empty,
+
+              &FindAttributeIdsTest::wrongOutputSize});
+}
+
+using namespace Math::Literals;
+
+constexpr UnsignedInt NotFound = ~UnsignedInt{};
+
+void FindAttributeIdsTest::strings() {
+    /* Attributes get sorted by name on construction */
+    const Trade::MaterialData materials[]{
+        {{}, {
+            {Trade::MaterialAttribute::Roughness, 0.5f},            /* 2 */
+            {Trade::MaterialAttribute::BaseColor, 0xffcc66ff_rgbaf},/* 0 */
+            {"highlightColor", 0x336699ff_rgbaf},                   /* 3 */
+            {Trade::MaterialAttribute::Metalness, 0.25f},           /* 1 */
+        }},
+        {{}, {
+            {Trade::MaterialAttribute::Metalness, 1.0f},            /* 0 */
+        }},
+        {{}, {}}
+    };
+
+    /* The names are deliberately not sorted and one is repeated */
+    Containers::Array<UnsignedInt> ids = findAttributeIds(materials, 0, {
+        "Roughness",
+        "highlightColor",
+        "BaseColor",
+        "NormalTexture",
+        "Roughness"
+    });
+    CORRADE_COMPARE_AS(ids, Containers::arrayView<UnsignedInt>({
+        2, 3, 0, NotFound, 2,
+        NotFound, NotFound, NotFound, NotFound, NotFound,
+        NotFound, NotFound, NotFound, NotFound, NotFound
+    }), TestSuite::Compare::Container);
+
+    /* The IDs match what the single-attribute lookup returns */
+    CORRADE_COMPARE(materials[0].attributeId("Roughness"), ids[0]);
+    CORRADE_COMPARE(materials[0].attributeId("highlightColor"), ids[1]);
+    CORRADE_COMPARE(materials[0].attributeId("BaseColor"), ids[2]);
+}
+
+void FindAttributeIdsTest::enums() {
+    const Trade::MaterialData materials[]{
+        {{}, {
+            {Trade::MaterialAttribute::Roughness, 0.5f},
+            {Trade::MaterialAttribute::BaseColor, 0xffcc66ff_rgbaf},
+            {Trade::MaterialAttribute::Metalness, 0.25f},
+        }},
+        {{}, {
+            {Trade::MaterialAttribute::Metalness, 1.0f},
+        }}
+    };
+
+    Containers::Array<UnsignedInt> ids = findAttributeIds(materials, 0, Containers::arrayView({
+        Trade::MaterialAttribute::Metalness,
+        Trade::MaterialAttribute::BaseColor,
+        Trade::MaterialAttribute::EmissiveColor,
+    }));
+    CORRADE_COMPARE_AS(ids, Containers::arrayView<UnsignedInt>({
+        1, 0, NotFound,
+        0, NotFound, NotFound
+    }), TestSuite::Compare::Container);
+}
+
+void FindAttributeIdsTest::layer() {
+    const Trade::MaterialData materials[]{
+        {{}, {
+            {Trade::MaterialAttribute::BaseColor, 0xffcc66ff_rgbaf},
+            {Trade::MaterialLayer::ClearCoat},
+            {Trade::MaterialAttribute::Roughness, 0.5f},
+            {Trade::MaterialAttribute::LayerFactor, 0.25f},
+        }, {1, 4}},
+        /* Just the base layer */
+        {{}, {
+            {Trade::MaterialAttribute::Roughness, 1.0f},
+        }}
+    };
+
+    /* IDs are relative to the layer */
+    Containers::Array<UnsignedInt> ids = findAttributeIds(materials, 1, {
+        "Roughness",
+        "LayerFactor",
+        "BaseColor"
+    });
+    CORRADE_COMPARE_AS(ids, Containers::arrayView<UnsignedInt>({
+        2, 1, NotFound,
+        NotFound, NotFound, NotFound
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(materials[0].attribute<Float>(1, ids[0]), 0.5f);
+    CORRADE_COMPARE(materials[0].attribute<Float>(1, ids[1]), 0.25f);
+}
+
+void FindAttributeIdsTest::into() {
+    const Trade::MaterialData materials[]{
+        {{}, {
+            {Trade::MaterialAttribute::Roughness, 0.5f},
+            {Trade::MaterialAttribute::BaseColor, 0xffcc66ff_rgbaf},
+        }},
+        {{}, {
+            {Trade::MaterialAttribute::Metalness, 1.0f},
+            {Trade::MaterialAttribute::Roughness, 0.5f},
+        }}
+    };
+
+    /* Transposed output, i.e. with materials in the second dimension */
+    UnsignedInt ids[4];
+    findAttributeIdsInto(materials, 0, {"Roughness", "Metalness"}, Containers::StridedArrayView2D<UnsignedInt>{ids, {2, 2}}.transposed<0, 1>());
+    CORRADE_COMPARE_AS(Containers::arrayView(ids), Containers::arrayView<UnsignedInt>({
+        1, 1,
+        NotFound, 0
+    }), TestSuite::Compare::Container);
+}
+
+void FindAttributeIdsTest::empty() {
+    const Trade::MaterialData materials[]{
+        {{}, {
+            {Trade::MaterialAttribute::Roughness, 0.5f},
+        }}
+    };
+
+    CORRADE_COMPARE(findAttributeIds(materials, 0, Containers::StringIterable{}).size(), 0);
+    CORRADE_COMPARE(findAttributeIds(nullptr, 0, {"Roughness"}).size(), 0);
+}
+
+void FindAttributeIdsTest::wrongOutputSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MaterialData materials[]{
+        {{}, {}},
+        {{}, {}}
+    };
+    UnsignedInt ids[6];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    findAttributeIdsInto(materials, 0, {"Roughness"}, Containers::StridedArrayView2D<UnsignedInt>{ids, {2, 2}});
+    findAttributeIdsInto(materials, 0, {"Roughness", "Metalness"}, Containers::StridedArrayView2D<UnsignedInt>{ids, {3, 2}});
+    CORRADE_COMPARE(out.str(),
+        "MaterialTools::findAttributeIdsInto(): bad output size, expected 2 by 1 but got 2 by 2\n"
+        "MaterialTools::findAttributeIdsInto(): bad output size, expected 2 by 2 but got 3 by 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MaterialTools::Test::FindAttributeIdsTest)
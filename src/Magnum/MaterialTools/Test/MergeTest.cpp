@@ -25,12 +25,15 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/DebugStl.h>
 
 #include "Magnum/DebugTools/CompareMaterial.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/MaterialTools/Merge.h"
+#include "Magnum/Test/parallelFor.h"
 #include "Magnum/Trade/MaterialData.h"
 
 namespace Magnum { namespace MaterialTools { namespace Test { namespace {
@@ -48,6 +51,10 @@ struct MergeTest: TestSuite::Tester {
     void conflictsFail();
 
     void emptyInput();
+
+    void batch();
+    void batchFail();
+    void batchDifferentSize();
 };
 
 using namespace Math::Literals;
@@ -62,9 +69,15 @@ MergeTest::MergeTest() {
               &MergeTest::conflictsDifferentType,
               &MergeTest::conflictsFail,
 
-              &MergeTest::emptyInput});
+              &MergeTest::emptyInput,
+
+              &MergeTest::batch,
+              &MergeTest::batchFail,
+              &MergeTest::batchDifferentSize});
 }
 
+using Magnum::Test::parallelForReverse;
+
 void MergeTest::singleLayer() {
     Trade::MaterialData a{Trade::MaterialType::PbrMetallicRoughness, {
         {Trade::MaterialAttribute::BaseColor, 0xffcc66ff_rgbaf},
@@ -344,6 +357,105 @@ void MergeTest::emptyInput() {
     }
 }
 
+void MergeTest::batch() {
+    const Trade::MaterialData first[]{
+        Trade::MaterialData{Trade::MaterialType::PbrMetallicRoughness, {
+            {Trade::MaterialAttribute::BaseColor, 0xffcc66ff_rgbaf},
+            {Trade::MaterialAttribute::RoughnessTexture, 7u},
+            /* Second layer */
+            {Trade::MaterialAttribute::Roughness, 0.3f},
+        }, {2, 3}},
+        Trade::MaterialData{Trade::MaterialType::Flat, {}},
+        Trade::MaterialData{{}, {
+            {Trade::MaterialAttribute::RoughnessTexture, 7u},
+        }},
+    };
+    const Trade::MaterialData second[]{
+        Trade::MaterialData{Trade::MaterialType::PbrClearCoat, {
+            {Trade::MaterialAttribute::AlphaBlend, true},
+        }},
+        Trade::MaterialData{Trade::MaterialType::Phong, {
+            {Trade::MaterialAttribute::DiffuseTexture, 3u},
+            {Trade::MaterialAttribute::LayerFactor, 1.0f},
+        }, {1, 1, 2}},
+        /* Conflicting attribute, the first is kept */
+        Trade::MaterialData{{}, {
+            {Trade::MaterialAttribute::RoughnessTexture, 5u},
+            {Trade::MaterialAttribute::DoubleSided, true},
+        }},
+    };
+
+    Containers::Optional<Containers::Array<Trade::MaterialData>> actual = merge(first, second, MergeConflicts::KeepFirstIfSameType, parallelForReverse);
+    CORRADE_VERIFY(actual);
+    CORRADE_COMPARE(actual->size(), 3);
+
+    /* The materials reference a single allocation owned by the array */
+    for(const Trade::MaterialData& material: *actual) {
+        CORRADE_ITERATION(&material - actual->data());
+        CORRADE_COMPARE(material.attributeDataFlags(), Trade::DataFlags{});
+        CORRADE_COMPARE(material.layerDataFlags(), Trade::DataFlags{});
+    }
+
+    CORRADE_COMPARE_AS((*actual)[0], (Trade::MaterialData{Trade::MaterialType::PbrMetallicRoughness|Trade::MaterialType::PbrClearCoat, {
+        {Trade::MaterialAttribute::AlphaBlend, true},
+        {Trade::MaterialAttribute::BaseColor, 0xffcc66ff_rgbaf},
+        {Trade::MaterialAttribute::RoughnessTexture, 7u},
+        {Trade::MaterialAttribute::Roughness, 0.3f},
+    }, {3, 4}}), DebugTools::CompareMaterial);
+    CORRADE_COMPARE_AS((*actual)[1], (Trade::MaterialData{Trade::MaterialType::Flat|Trade::MaterialType::Phong, {
+        {Trade::MaterialAttribute::DiffuseTexture, 3u},
+        {Trade::MaterialAttribute::LayerFactor, 1.0f},
+    }, {1, 1, 2}}), DebugTools::CompareMaterial);
+    CORRADE_COMPARE_AS((*actual)[2], (Trade::MaterialData{{}, {
+        {Trade::MaterialAttribute::DoubleSided, true},
+        {Trade::MaterialAttribute::RoughnessTexture, 7u},
+    }}), DebugTools::CompareMaterial);
+}
+
+void MergeTest::batchFail() {
+    const Trade::MaterialData first[]{
+        Trade::MaterialData{{}, {
+            {Trade::MaterialAttribute::BaseColor, 0xffcc66ff_rgbaf},
+        }},
+        Trade::MaterialData{{}, {
+            {Trade::MaterialAttribute::RoughnessTexture, 7u},
+        }},
+    };
+    const Trade::MaterialData second[]{
+        Trade::MaterialData{{}, {
+            {Trade::MaterialAttribute::AlphaBlend, true},
+        }},
+        Trade::MaterialData{{}, {
+            {Trade::MaterialAttribute::RoughnessTexture, 7u},
+        }},
+    };
+
+    /* If any of the pairs fails, the whole batch fails */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!merge(first, second));
+    CORRADE_COMPARE(out.str(),
+        "MaterialTools::merge(): conflicting attribute RoughnessTexture in layer 0\n");
+}
+
+void MergeTest::batchDifferentSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MaterialData first[]{
+        Trade::MaterialData{{}, {}},
+        Trade::MaterialData{{}, {}},
+    };
+    const Trade::MaterialData second[]{
+        Trade::MaterialData{{}, {}},
+    };
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    merge(first, second);
+    CORRADE_COMPARE(out.str(),
+        "MaterialTools::merge(): expected the same count of first and second materials but got 2 and 1\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MaterialTools::Test::MergeTest)
@@ -25,6 +25,9 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Reference.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/DebugStl.h> /** @todo remove once Debug is stream-free */
 
@@ -32,6 +35,7 @@
 #include "Magnum/MaterialTools/PhongToPbrMetallicRoughness.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix3.h"
+#include "Magnum/Test/parallelFor.h"
 #include "Magnum/Trade/MaterialData.h"
 
 namespace Magnum { namespace MaterialTools { namespace Test { namespace {
@@ -42,6 +46,9 @@ struct PhongToPbrMetallicRoughnessTest: TestSuite::Tester {
     void convert();
     void warning();
     void fail();
+
+    void convertBatch();
+    void failBatch();
 };
 
 using namespace Math::Literals;
@@ -272,8 +279,15 @@ PhongToPbrMetallicRoughnessTest::PhongToPbrMetallicRoughnessTest() {
 
     addInstancedTests({&PhongToPbrMetallicRoughnessTest::fail},
         Containers::arraySize(FailData));
+
+    addInstancedTests({&PhongToPbrMetallicRoughnessTest::convertBatch},
+        Containers::arraySize(ConvertData));
+
+    addTests({&PhongToPbrMetallicRoughnessTest::failBatch});
 }
 
+using Magnum::Test::parallelForReverse;
+
 void PhongToPbrMetallicRoughnessTest::convert() {
     auto&& data = ConvertData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -309,6 +323,51 @@ void PhongToPbrMetallicRoughnessTest::fail() {
     CORRADE_COMPARE(out.str(), data.message);
 }
 
+void PhongToPbrMetallicRoughnessTest::convertBatch() {
+    auto&& data = ConvertData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Converting the same material multiple times to verify the batch
+       storage offsets are calculated correctly */
+    const Containers::Reference<const Trade::MaterialData> materials[]{
+        data.material,
+        data.material,
+        data.material
+    };
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Warning redirectWarning{&out};
+    Containers::Optional<Containers::Array<Trade::MaterialData>> actual = phongToPbrMetallicRoughness(materials, data.flags, parallelForReverse);
+    CORRADE_VERIFY(actual);
+    CORRADE_COMPARE(actual->size(), 3);
+    for(const Trade::MaterialData& material: *actual) {
+        CORRADE_ITERATION(&material - actual->data());
+        CORRADE_COMPARE(material.attributeDataFlags(), Trade::DataFlags{});
+        CORRADE_COMPARE(material.layerDataFlags(), Trade::DataFlags{});
+        CORRADE_COMPARE_AS(material, data.expected, DebugTools::CompareMaterial);
+    }
+    CORRADE_COMPARE(out.str(), "");
+}
+
+void PhongToPbrMetallicRoughnessTest::failBatch() {
+    const Trade::MaterialData materials[]{
+        Trade::MaterialData{{}, {
+            {Trade::MaterialAttribute::DiffuseColor, 0xff3366cc_rgbaf},
+        }},
+        Trade::MaterialData{{}, {
+            {Trade::MaterialAttribute::Shininess, 0.5f},
+        }},
+    };
+
+    /* If any of the materials fails, the whole batch fails */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!phongToPbrMetallicRoughness(materials, PhongToPbrMetallicRoughnessFlag::FailOnUnconvertibleAttributes));
+    CORRADE_COMPARE(out.str(),
+        "MaterialTools::phongToPbrMetallicRoughness(): unconvertible Trade::MaterialAttribute::Shininess attribute\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MaterialTools::Test::PhongToPbrMetallicRoughnessTest)
@@ -25,6 +25,7 @@
 */
 
 #include <sstream> /** @todo remove once Debug is stream-free */
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Iterable.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
@@ -64,6 +65,8 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     void inPlaceAsArray();
 
     void invalidSize();
+
+    void benchmark();
 };
 
 using namespace Math::Literals;
@@ -150,6 +153,8 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
               &RemoveDuplicatesTest::inPlaceAsArray,
 
               &RemoveDuplicatesTest::invalidSize});
+
+    addBenchmarks({&RemoveDuplicatesTest::benchmark}, 10);
 }
 
 void RemoveDuplicatesTest::empty() {
@@ -657,6 +662,29 @@ void RemoveDuplicatesTest::invalidSize() {
         "MaterialTools::removeDuplicatesInPlaceInto(): bad output size, expected 2 but got 3\n");
 }
 
+void RemoveDuplicatesTest::benchmark() {
+    /* Resembling a large CAD import, with a thousand unique materials
+       repeated ten times over, differing in integer values and all having the
+       same floating-point value */
+    Containers::Array<Trade::MaterialData> materials;
+    for(UnsignedInt i = 0; i != 10000; ++i)
+        arrayAppend(materials, Trade::MaterialData{Trade::MaterialType::PbrMetallicRoughness, {
+            {Trade::MaterialAttribute::BaseColorTexture, i % 1000},
+            {Trade::MaterialAttribute::Roughness, 0.5f},
+            {Trade::MaterialAttribute::MetalnessTexture, (i % 1000)/10},
+        }});
+
+    Containers::Array<UnsignedInt> mapping{NoInit, materials.size()};
+    std::size_t uniqueCount = 0;
+    CORRADE_BENCHMARK(1) {
+        uniqueCount = removeDuplicatesInto(materials, mapping);
+    }
+
+    CORRADE_COMPARE(uniqueCount, 1000);
+    CORRADE_COMPARE(mapping[1000], 0);
+    CORRADE_COMPARE(mapping[9999], 999);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MaterialTools::Test::RemoveDuplicatesTest)
@@ -0,0 +1,255 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GramSchmidtBatch.h"
+
+#include <Corrade/Cpu.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Matrix.h"
+
+#ifdef CORRADE_ENABLE_SSE2
+#include <Corrade/Utility/IntrinsicsSse2.h>
+#endif
+#ifdef CORRADE_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+namespace {
+
+typedef void(*OrthonormalizeFunction)(const char*, std::ptrdiff_t, char*, std::ptrdiff_t, std::size_t);
+
+void orthonormalizeScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        /* Same as gramSchmidtOrthonormalizeInPlace(), except that it doesn't
+           go through Vector::projectedOntoNormalized() in order to not
+           trigger its debug assertion for degenerate matrices, consistently
+           with the SIMD variants */
+        Matrix3x3<Float> m = *reinterpret_cast<const Matrix3x3<Float>*>(src);
+        for(std::size_t j = 0; j != 3; ++j) {
+            m[j] = m[j].normalized();
+            for(std::size_t k = j + 1; k != 3; ++k)
+                m[k] -= m[j]*Math::dot(m[k], m[j]);
+        }
+        *reinterpret_cast<Matrix3x3<Float>*>(dst) = m;
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+/* The SIMD variants process four matrices at a time, with each lane being a
+   separate matrix and each register one matrix element, i.e. it's the same
+   sequence of operations as in the scalar variant */
+
+#ifdef CORRADE_ENABLE_SSE2
+struct ColumnSse2 {
+    __m128 x, y, z;
+};
+
+CORRADE_ENABLE_SSE2 inline __m128 loadLanesSse2(const char* const data, const std::ptrdiff_t stride, const std::size_t i) {
+    return _mm_setr_ps(
+        reinterpret_cast<const Float*>(data)[i],
+        reinterpret_cast<const Float*>(data + stride)[i],
+        reinterpret_cast<const Float*>(data + 2*stride)[i],
+        reinterpret_cast<const Float*>(data + 3*stride)[i]);
+}
+
+CORRADE_ENABLE_SSE2 inline void storeLanesSse2(char* const data, const std::ptrdiff_t stride, const std::size_t i, const __m128 value) {
+    alignas(16) Float lanes[4];
+    _mm_store_ps(lanes, value);
+    for(std::size_t j = 0; j != 4; ++j)
+        reinterpret_cast<Float*>(data + j*stride)[i] = lanes[j];
+}
+
+CORRADE_ENABLE_SSE2 inline ColumnSse2 loadColumnSse2(const char* const data, const std::ptrdiff_t stride, const std::size_t column) {
+    return {loadLanesSse2(data, stride, column*3 + 0),
+            loadLanesSse2(data, stride, column*3 + 1),
+            loadLanesSse2(data, stride, column*3 + 2)};
+}
+
+CORRADE_ENABLE_SSE2 inline void storeColumnSse2(char* const data, const std::ptrdiff_t stride, const std::size_t column, const ColumnSse2& value) {
+    storeLanesSse2(data, stride, column*3 + 0, value.x);
+    storeLanesSse2(data, stride, column*3 + 1, value.y);
+    storeLanesSse2(data, stride, column*3 + 2, value.z);
+}
+
+CORRADE_ENABLE_SSE2 inline __m128 dotSse2(const ColumnSse2& a, const ColumnSse2& b) {
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a.x, b.x), _mm_mul_ps(a.y, b.y)), _mm_mul_ps(a.z, b.z));
+}
+
+CORRADE_ENABLE_SSE2 inline ColumnSse2 normalizedSse2(const ColumnSse2& a) {
+    /* Same as Vector::normalized(), so the results are bit-exact with the
+       scalar variant */
+    const __m128 lengthInverted = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(dotSse2(a, a)));
+    return {_mm_mul_ps(a.x, lengthInverted),
+            _mm_mul_ps(a.y, lengthInverted),
+            _mm_mul_ps(a.z, lengthInverted)};
+}
+
+/* a - dot(a, b)*b with b being normalized */
+CORRADE_ENABLE_SSE2 inline ColumnSse2 subtractProjectionSse2(const ColumnSse2& a, const ColumnSse2& b) {
+    const __m128 dot = dotSse2(a, b);
+    return {_mm_sub_ps(a.x, _mm_mul_ps(b.x, dot)),
+            _mm_sub_ps(a.y, _mm_mul_ps(b.y, dot)),
+            _mm_sub_ps(a.z, _mm_mul_ps(b.z, dot))};
+}
+
+CORRADE_ENABLE_SSE2 void orthonormalizeSse2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        const ColumnSse2 c0 = normalizedSse2(loadColumnSse2(src, srcStride, 0));
+        const ColumnSse2 c1 = normalizedSse2(subtractProjectionSse2(loadColumnSse2(src, srcStride, 1), c0));
+        const ColumnSse2 c2 = normalizedSse2(subtractProjectionSse2(subtractProjectionSse2(loadColumnSse2(src, srcStride, 2), c0), c1));
+        storeColumnSse2(dst, dstStride, 0, c0);
+        storeColumnSse2(dst, dstStride, 1, c1);
+        storeColumnSse2(dst, dstStride, 2, c2);
+        src += 4*srcStride;
+        dst += 4*dstStride;
+    }
+
+    /* Remaining items */
+    orthonormalizeScalar(src, srcStride, dst, dstStride, size - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_NEON
+struct ColumnNeon {
+    float32x4_t x, y, z;
+};
+
+CORRADE_ENABLE_NEON inline float32x4_t loadLanesNeon(const char* const data, const std::ptrdiff_t stride, const std::size_t i) {
+    float32x4_t out = vdupq_n_f32(0.0f);
+    out = vsetq_lane_f32(reinterpret_cast<const Float*>(data)[i], out, 0);
+    out = vsetq_lane_f32(reinterpret_cast<const Float*>(data + stride)[i], out, 1);
+    out = vsetq_lane_f32(reinterpret_cast<const Float*>(data + 2*stride)[i], out, 2);
+    out = vsetq_lane_f32(reinterpret_cast<const Float*>(data + 3*stride)[i], out, 3);
+    return out;
+}
+
+CORRADE_ENABLE_NEON inline void storeLanesNeon(char* const data, const std::ptrdiff_t stride, const std::size_t i, const float32x4_t value) {
+    reinterpret_cast<Float*>(data)[i] = vgetq_lane_f32(value, 0);
+    reinterpret_cast<Float*>(data + stride)[i] = vgetq_lane_f32(value, 1);
+    reinterpret_cast<Float*>(data + 2*stride)[i] = vgetq_lane_f32(value, 2);
+    reinterpret_cast<Float*>(data + 3*stride)[i] = vgetq_lane_f32(value, 3);
+}
+
+CORRADE_ENABLE_NEON inline ColumnNeon loadColumnNeon(const char* const data, const std::ptrdiff_t stride, const std::size_t column) {
+    return {loadLanesNeon(data, stride, column*3 + 0),
+            loadLanesNeon(data, stride, column*3 + 1),
+            loadLanesNeon(data, stride, column*3 + 2)};
+}
+
+CORRADE_ENABLE_NEON inline void storeColumnNeon(char* const data, const std::ptrdiff_t stride, const std::size_t column, const ColumnNeon& value) {
+    storeLanesNeon(data, stride, column*3 + 0, value.x);
+    storeLanesNeon(data, stride, column*3 + 1, value.y);
+    storeLanesNeon(data, stride, column*3 + 2, value.z);
+}
+
+CORRADE_ENABLE_NEON inline float32x4_t dotNeon(const ColumnNeon& a, const ColumnNeon& b) {
+    return vaddq_f32(vaddq_f32(vmulq_f32(a.x, b.x), vmulq_f32(a.y, b.y)), vmulq_f32(a.z, b.z));
+}
+
+CORRADE_ENABLE_NEON inline ColumnNeon normalizedNeon(const ColumnNeon& a) {
+    /* There's no division on ARMv7, using the reciprocal square root
+       estimate refined with two Newton-Raphson steps instead */
+    const float32x4_t dot = dotNeon(a, a);
+    float32x4_t lengthInverted = vrsqrteq_f32(dot);
+    lengthInverted = vmulq_f32(lengthInverted, vrsqrtsq_f32(vmulq_f32(dot, lengthInverted), lengthInverted));
+    lengthInverted = vmulq_f32(lengthInverted, vrsqrtsq_f32(vmulq_f32(dot, lengthInverted), lengthInverted));
+    return {vmulq_f32(a.x, lengthInverted),
+            vmulq_f32(a.y, lengthInverted),
+            vmulq_f32(a.z, lengthInverted)};
+}
+
+/* a - dot(a, b)*b with b being normalized */
+CORRADE_ENABLE_NEON inline ColumnNeon subtractProjectionNeon(const ColumnNeon& a, const ColumnNeon& b) {
+    const float32x4_t dot = dotNeon(a, b);
+    return {vsubq_f32(a.x, vmulq_f32(b.x, dot)),
+            vsubq_f32(a.y, vmulq_f32(b.y, dot)),
+            vsubq_f32(a.z, vmulq_f32(b.z, dot))};
+}
+
+CORRADE_ENABLE_NEON void orthonormalizeNeon(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        const ColumnNeon c0 = normalizedNeon(loadColumnNeon(src, srcStride, 0));
+        const ColumnNeon c1 = normalizedNeon(subtractProjectionNeon(loadColumnNeon(src, srcStride, 1), c0));
+        const ColumnNeon c2 = normalizedNeon(subtractProjectionNeon(subtractProjectionNeon(loadColumnNeon(src, srcStride, 2), c0), c1));
+        storeColumnNeon(dst, dstStride, 0, c0);
+        storeColumnNeon(dst, dstStride, 1, c1);
+        storeColumnNeon(dst, dstStride, 2, c2);
+        src += 4*srcStride;
+        dst += 4*dstStride;
+    }
+
+    /* Remaining items */
+    orthonormalizeScalar(src, srcStride, dst, dstStride, size - i);
+}
+#endif
+
+struct Kernels {
+    OrthonormalizeFunction orthonormalize;
+};
+
+Kernels kernelsFor(const Cpu::Features features) {
+    Kernels out{
+        orthonormalizeScalar
+    };
+
+    #ifdef CORRADE_ENABLE_SSE2
+    if(features & Cpu::Sse2)
+        out.orthonormalize = orthonormalizeSse2;
+    #endif
+    #ifdef CORRADE_ENABLE_NEON
+    if(features & Cpu::Neon)
+        out.orthonormalize = orthonormalizeNeon;
+    #endif
+
+    /* Silence unused variable warnings on platforms with no SIMD variant */
+    static_cast<void>(features);
+
+    return out;
+}
+
+const Kernels& kernels() {
+    /* Picked on first use, the static initialization is thread-safe */
+    static const Kernels out = kernelsFor(Cpu::runtimeFeatures());
+    return out;
+}
+
+}
+
+void gramSchmidtOrthonormalizeInto(const Containers::StridedArrayView1D<const Matrix3x3<Float>>& src, const Containers::StridedArrayView1D<Matrix3x3<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::Algorithms::gramSchmidtOrthonormalizeInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+
+    kernels().orthonormalize(static_cast<const char*>(src.data()), src.stride(), static_cast<char*>(dst.data()), dst.stride(), src.size());
+}
+
+}}}
@@ -0,0 +1,64 @@
+#ifndef Magnum_Math_Algorithms_GramSchmidtBatch_h
+#define Magnum_Math_Algorithms_GramSchmidtBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Algorithms::gramSchmidtOrthonormalizeInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+/**
+@brief Batch Gram-Schmidt orthonormalization of 3x3 matrices
+@param[in]  src     Source matrices
+@param[out] dst     Destination matrices
+@m_since_latest
+
+Equivalent to calling @ref gramSchmidtOrthonormalize() for all items, but
+processing several matrices at once using SIMD instructions. The
+implementation is picked at runtime on first use based on instruction sets
+available on the CPU, with an SSE2 variant on x86 and a NEON variant on ARM.
+The SSE2 variant gives bit-exact results with @ref gramSchmidtOrthonormalize(),
+the NEON variant calculates the vector length using a reciprocal square root
+approximation and thus may differ in the last few bits.
+
+Expects that @p src and @p dst have the same size. The @p dst view is allowed
+to be the same as @p src to perform the operation in-place, partial overlaps
+are not allowed.
+@see @ref svdInto()
+*/
+MAGNUM_EXPORT void gramSchmidtOrthonormalizeInto(const Containers::StridedArrayView1D<const Matrix3x3<Float>>& src, const Containers::StridedArrayView1D<Matrix3x3<Float>>& dst);
+
+}}}
+
+#endif
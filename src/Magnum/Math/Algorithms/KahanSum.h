@@ -27,12 +27,16 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::Math::Algorithms::kahanSum()
+ * @brief Function @ref Magnum::Math::Algorithms::kahanSum(), @ref Magnum::Math::Algorithms::kahanSumChunkCount(), @ref Magnum::Math::Algorithms::kahanSumChunk(), @ref Magnum::Math::Algorithms::kahanSumPartials(), @ref Magnum::Math::Algorithms::kahanSumChunked()
  */
 
 /* std::declval() is said to be in <utility> but libstdc++, libc++ and MSVC STL
    all have it directly in <type_traits> because it just makes sense */
 #include <type_traits>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Magnum.h"
 
 namespace Magnum { namespace Math { namespace Algorithms {
 
@@ -75,6 +79,131 @@ template<class Iterator, class T = typename std::decay<decltype(*std::declval<It
     return sum;
 }
 
+namespace Implementation {
+    /* Adds partial results in [begin, end) in a binary tree that depends only
+       on the partial count, tracking the rounding error of each addition with
+       Knuth's TwoSum. The resulting compensation is meant to be added to the
+       sum, unlike in kahanSum() where it's subtracted. */
+    template<class T, class Partial> void kahanSumTree(const Partial& partial, const std::size_t begin, const std::size_t end, T& sum, T& compensation) {
+        if(end - begin == 1) {
+            sum = partial(begin);
+            compensation = T(0);
+            return;
+        }
+
+        const std::size_t middle = begin + (end - begin)/2;
+        T a, aCompensation, b, bCompensation;
+        kahanSumTree(partial, begin, middle, a, aCompensation);
+        kahanSumTree(partial, middle, end, b, bCompensation);
+        sum = a + b;
+        const T bVirtual = sum - a;
+        const T error = (a - (sum - bVirtual)) + (b - bVirtual);
+        compensation = (aCompensation + bCompensation) + error;
+    }
+
+    template<class T> struct KahanSumChunkPartial {
+        T operator()(std::size_t i) const { return view[i]; }
+        const Containers::StridedArrayView1D<const T>& view;
+    };
+}
+
+/**
+@brief Chunk count for a parallel Kahan summation
+@param size         Count of values to sum
+@param chunkSize    Count of values in a single chunk
+@m_since_latest
+
+Returns @p size divided by @p chunkSize, rounded up. Expects that
+@p chunkSize is not zero. See @ref kahanSumChunked() for more information.
+*/
+inline std::size_t kahanSumChunkCount(const std::size_t size, const std::size_t chunkSize = 16384) {
+    CORRADE_ASSERT(chunkSize,
+        "Math::Algorithms::kahanSumChunkCount(): expected non-zero chunk size", {});
+    return (size + chunkSize - 1)/chunkSize;
+}
+
+/**
+@brief Kahan sum of a single chunk
+@param values       Values to sum
+@param chunk        Chunk index
+@param chunkSize    Count of values in a single chunk
+@m_since_latest
+
+Calculates a @ref kahanSum() of values in range
+@cpp [chunk*chunkSize, (chunk + 1)*chunkSize) @ce, clamped to the size of
+@p values, and returns it with the roundoff error compensation applied. Expects
+that @p chunk is less than @ref kahanSumChunkCount(). The function doesn't
+access any shared state and thus can be called for different chunks from
+multiple threads at the same time. See @ref kahanSumChunked() for more
+information.
+*/
+template<class T> T kahanSumChunk(const Containers::StridedArrayView1D<const T>& values, const std::size_t chunk, const std::size_t chunkSize = 16384) {
+    CORRADE_ASSERT(chunk < kahanSumChunkCount(values.size(), chunkSize),
+        "Math::Algorithms::kahanSumChunk(): index" << chunk << "out of range for" << kahanSumChunkCount(values.size(), chunkSize) << "chunks", {});
+    const std::size_t end = (chunk + 1)*chunkSize;
+    const Containers::StridedArrayView1D<const T> slice = values.slice(chunk*chunkSize, end < values.size() ? end : values.size());
+    T compensation = T(0);
+    const T sum = kahanSum(slice.begin(), slice.end(), T(0), &compensation);
+    return sum - compensation;
+}
+
+/**
+@brief Combine partial Kahan sums
+@param partials     Partial sums returned from @ref kahanSumChunk()
+@m_since_latest
+
+Adds the partial sums together in a binary tree that depends only on the
+partial count, tracking the roundoff error of each addition. The result is
+thus only dependent on the input values and the chunk size, not on the order
+in which the partials were calculated. Returns @cpp T(0) @ce for an empty
+view. See @ref kahanSumChunked() for more information.
+*/
+template<class T> T kahanSumPartials(const Containers::StridedArrayView1D<const T>& partials) {
+    if(partials.isEmpty()) return T(0);
+
+    T sum, compensation;
+    Implementation::kahanSumTree(Implementation::KahanSumChunkPartial<T>{partials}, 0, partials.size(), sum, compensation);
+    return sum + compensation;
+}
+
+/**
+@brief Pairwise Kahan summation
+@param values       Values to sum
+@param chunkSize    Count of values in a single chunk
+@m_since_latest
+
+Splits @p values into chunks of @p chunkSize, sums each with
+@ref kahanSum() and then combines the partial results with
+@ref kahanSumPartials(). The precision is comparable to using
+@ref kahanSum() on the whole range.
+
+The result is bit-exact with calculating @ref kahanSumChunk() for all
+@ref kahanSumChunkCount() chunks and passing them to @ref kahanSumPartials().
+The chunks can be calculated in parallel in any order using an arbitrary
+threading mechanism, and the result stays the same independently of the
+thread count as long as the chunk size is the same:
+
+@snippet MathAlgorithms.cpp kahanSumChunked
+*/
+template<class T> T kahanSumChunked(const Containers::StridedArrayView1D<const T>& values, const std::size_t chunkSize = 16384) {
+    const std::size_t chunkCount = kahanSumChunkCount(values.size(), chunkSize);
+    if(!chunkCount) return T(0);
+
+    T sum, compensation;
+    Implementation::kahanSumTree([&values, chunkSize](std::size_t i) {
+        return kahanSumChunk(values, i, chunkSize);
+    }, 0, chunkCount, sum, compensation);
+    return sum + compensation;
+}
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+template<class T> inline typename std::remove_const<T>::type kahanSumChunked(const Containers::StridedArrayView1D<T>& values, const std::size_t chunkSize = 16384) {
+    return kahanSumChunked(Containers::StridedArrayView1D<const typename std::remove_const<T>::type>{values}, chunkSize);
+}
+
 }}}
 
 #endif
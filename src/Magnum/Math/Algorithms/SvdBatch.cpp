@@ -0,0 +1,444 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SvdBatch.h"
+
+#include <cmath>
+#include <Corrade/Cpu.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Matrix.h"
+#include "Magnum/Math/Vector3.h"
+
+#if defined(CORRADE_ENABLE_SSE2) && defined(CORRADE_TARGET_SSE2)
+#include <Corrade/Utility/IntrinsicsSse2.h>
+#endif
+#if defined(CORRADE_ENABLE_NEON) && defined(CORRADE_TARGET_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+namespace {
+
+/* The decomposition is a fixed-iteration variant of the algorithm from
+   McAdams, A.; Selle, A.; Tamstorf, R.; Teran, J.; Sifakis, E. (2011).
+   "Computing the Singular Value Decomposition of 3x3 matrices with minimal
+   branching and elementary floating point operations". It's written just
+   once as a template operating either on a single Float or on a SIMD
+   register where each lane is a separate matrix, with all data-dependent
+   branches replaced with selects. Besides arithmetic operators the type is
+   expected to have the lane*() overloads below.
+
+   The template itself can't be annotated with a target attribute as the
+   same code is shared with the scalar variant, which means the SIMD variants
+   are only enabled if the instruction set is available at compile time
+   already. That's the case with SSE2 on all x86-64 builds and with NEON on
+   all AArch64 builds. */
+
+/* Number of cyclic Jacobi sweeps, each consisting of three rotations. Six
+   is enough to reach Float precision for all but pathological inputs. */
+constexpr std::size_t JacobiSweeps = 6;
+
+/* 3 + sqrt(8) = cot^2(pi/8), cos(pi/8) and sin(pi/8), used for the approximate Givens
+   rotation in the Jacobi step */
+constexpr Float JacobiGamma = 5.828427125f;
+constexpr Float JacobiCosPi8 = 0.923879533f;
+constexpr Float JacobiSinPi8 = 0.382683432f;
+
+/* Matrices with all elements below this value are treated as zero */
+constexpr Float MinScale = 1.0e-30f;
+
+/* Once an off-diagonal element of the (normalized) symmetric matrix gets
+   below this value it's flushed to zero. Without that it would slowly
+   converge towards denormals, which are extremely slow on most CPUs. */
+constexpr Float JacobiEpsilon = 1.0e-12f;
+
+/* Below this value the element to eliminate in the QR step is treated as
+   zero. Chosen so its square is still a normal Float. */
+constexpr Float QrEpsilon = 1.0e-18f;
+
+inline Float laneSqrt(const Float a) { return std::sqrt(a); }
+inline Float laneRsqrt(const Float a) { return 1.0f/std::sqrt(a); }
+inline Float laneAbs(const Float a) { return std::abs(a); }
+inline Float laneMax(const Float a, const Float b) { return a < b ? b : a; }
+inline bool laneLess(const Float a, const Float b) { return a < b; }
+inline Float laneSelect(const bool mask, const Float a, const Float b) { return mask ? a : b; }
+
+#if defined(CORRADE_ENABLE_SSE2) && defined(CORRADE_TARGET_SSE2)
+struct Sse2Float {
+    /* Default values not initialized, the same as with Float */
+    Sse2Float() = default;
+    CORRADE_ENABLE_SSE2 /*implicit*/ Sse2Float(const __m128 v): v{v} {}
+    CORRADE_ENABLE_SSE2 /*implicit*/ Sse2Float(const Float a): v{_mm_set1_ps(a)} {}
+
+    __m128 v;
+};
+
+struct Sse2Mask {
+    __m128 v;
+};
+
+CORRADE_ENABLE_SSE2 inline Sse2Float operator+(const Sse2Float a, const Sse2Float b) { return _mm_add_ps(a.v, b.v); }
+CORRADE_ENABLE_SSE2 inline Sse2Float operator-(const Sse2Float a, const Sse2Float b) { return _mm_sub_ps(a.v, b.v); }
+CORRADE_ENABLE_SSE2 inline Sse2Float operator-(const Sse2Float a) { return _mm_xor_ps(a.v, _mm_set1_ps(-0.0f)); }
+CORRADE_ENABLE_SSE2 inline Sse2Float operator*(const Sse2Float a, const Sse2Float b) { return _mm_mul_ps(a.v, b.v); }
+CORRADE_ENABLE_SSE2 inline Sse2Float laneSqrt(const Sse2Float a) { return _mm_sqrt_ps(a.v); }
+CORRADE_ENABLE_SSE2 inline Sse2Float laneRsqrt(const Sse2Float a) {
+    /* The estimate has just 12 bits of precision, one Newton-Raphson step
+       gets it close to full Float precision */
+    const __m128 y = _mm_rsqrt_ps(a.v);
+    return _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), a.v), _mm_mul_ps(y, y))));
+}
+CORRADE_ENABLE_SSE2 inline Sse2Float laneAbs(const Sse2Float a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v); }
+CORRADE_ENABLE_SSE2 inline Sse2Float laneMax(const Sse2Float a, const Sse2Float b) { return _mm_max_ps(a.v, b.v); }
+CORRADE_ENABLE_SSE2 inline Sse2Mask laneLess(const Sse2Float a, const Sse2Float b) { return {_mm_cmplt_ps(a.v, b.v)}; }
+CORRADE_ENABLE_SSE2 inline Sse2Float laneSelect(const Sse2Mask mask, const Sse2Float a, const Sse2Float b) {
+    return _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v));
+}
+#endif
+
+#if defined(CORRADE_ENABLE_NEON) && defined(CORRADE_TARGET_NEON)
+struct NeonFloat {
+    /* Default values not initialized, the same as with Float */
+    NeonFloat() = default;
+    CORRADE_ENABLE_NEON /*implicit*/ NeonFloat(const float32x4_t v): v{v} {}
+    CORRADE_ENABLE_NEON /*implicit*/ NeonFloat(const Float a): v{vdupq_n_f32(a)} {}
+
+    float32x4_t v;
+};
+
+struct NeonMask {
+    uint32x4_t v;
+};
+
+CORRADE_ENABLE_NEON inline NeonFloat operator+(const NeonFloat a, const NeonFloat b) { return vaddq_f32(a.v, b.v); }
+CORRADE_ENABLE_NEON inline NeonFloat operator-(const NeonFloat a, const NeonFloat b) { return vsubq_f32(a.v, b.v); }
+CORRADE_ENABLE_NEON inline NeonFloat operator-(const NeonFloat a) { return vnegq_f32(a.v); }
+CORRADE_ENABLE_NEON inline NeonFloat operator*(const NeonFloat a, const NeonFloat b) { return vmulq_f32(a.v, b.v); }
+CORRADE_ENABLE_NEON inline NeonFloat laneRsqrt(const NeonFloat a) {
+    /* The estimate has just 8 bits of precision, two Newton-Raphson steps
+       get it close to full Float precision */
+    float32x4_t y = vrsqrteq_f32(a.v);
+    y = vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(a.v, y), y));
+    y = vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(a.v, y), y));
+    return y;
+}
+CORRADE_ENABLE_NEON inline NeonFloat laneSqrt(const NeonFloat a) {
+    /* There's no vsqrtq_f32() on ARMv7, calculating it from the reciprocal
+       square root instead. That'd be a NaN for zero, so masking it out. */
+    return vbslq_f32(vcgtq_f32(a.v, vdupq_n_f32(0.0f)), vmulq_f32(a.v, laneRsqrt(a).v), vdupq_n_f32(0.0f));
+}
+CORRADE_ENABLE_NEON inline NeonFloat laneAbs(const NeonFloat a) { return vabsq_f32(a.v); }
+CORRADE_ENABLE_NEON inline NeonFloat laneMax(const NeonFloat a, const NeonFloat b) { return vmaxq_f32(a.v, b.v); }
+CORRADE_ENABLE_NEON inline NeonMask laneLess(const NeonFloat a, const NeonFloat b) { return {vcltq_f32(a.v, b.v)}; }
+CORRADE_ENABLE_NEON inline NeonFloat laneSelect(const NeonMask mask, const NeonFloat a, const NeonFloat b) { return vbslq_f32(mask.v, a.v, b.v); }
+#endif
+
+/* All matrices are column-major with 9 elements. Applies a Jacobi rotation
+   in the (p, q) plane to the symmetric matrix S, with k being the remaining
+   index, and accumulates it into V. */
+template<std::size_t p, std::size_t q, class T> void jacobiRotate(T& spp, T& sqq, T& spq, T& spk, T& sqk, T(&v)[9]) {
+    /* Approximate half-angle of the rotation, falling back to a rotation by
+       pi/4 if it would be too large. The sign is moved to the sine so the
+       fallback rotates in the right direction. */
+    spq = laneSelect(laneLess(laneAbs(spq), T(JacobiEpsilon)), T(0.0f), spq);
+    const T ch1 = T(2.0f)*(spp - sqq);
+    const auto flip = laneLess(ch1, T(0.0f));
+    const T ch0 = laneAbs(ch1);
+    const T sh0 = laneSelect(flip, -spq, spq);
+    const auto approximate = laneLess(T(JacobiGamma)*sh0*sh0, ch0*ch0);
+    const T w = laneRsqrt(ch0*ch0 + sh0*sh0);
+    const T ch = laneSelect(approximate, w*ch0, T(JacobiCosPi8));
+    const T sh = laneSelect(approximate, w*sh0, laneSelect(laneLess(sh0, T(0.0f)), T(-JacobiSinPi8), T(JacobiSinPi8)));
+    const T c = ch*ch - sh*sh;
+    const T s = T(2.0f)*sh*ch;
+
+    /* S = R^T S R, V = V R */
+    const T cc = c*c;
+    const T ss = s*s;
+    const T cs = c*s;
+    const T pp = cc*spp + T(2.0f)*cs*spq + ss*sqq;
+    const T qq = ss*spp - T(2.0f)*cs*spq + cc*sqq;
+    spq = (cc - ss)*spq + cs*(sqq - spp);
+    spp = pp;
+    sqq = qq;
+    const T pk = c*spk + s*sqk;
+    sqk = c*sqk - s*spk;
+    spk = pk;
+    for(std::size_t i = 0; i != 3; ++i) {
+        const T vp = v[p*3 + i];
+        const T vq = v[q*3 + i];
+        v[p*3 + i] = c*vp + s*vq;
+        v[q*3 + i] = c*vq - s*vp;
+    }
+}
+
+/* Swaps columns i and j of B and V if column j has a larger norm, negating
+   one of them to keep V a rotation */
+template<std::size_t i, std::size_t j, class T> void sortColumns(T(&b)[9], T(&v)[9], T(&rho)[3]) {
+    const auto swap = laneLess(rho[i], rho[j]);
+    for(std::size_t k = 0; k != 3; ++k) {
+        const T bi = b[i*3 + k];
+        const T bj = b[j*3 + k];
+        b[i*3 + k] = laneSelect(swap, bj, bi);
+        b[j*3 + k] = laneSelect(swap, -bi, bj);
+        const T vi = v[i*3 + k];
+        const T vj = v[j*3 + k];
+        v[i*3 + k] = laneSelect(swap, vj, vi);
+        v[j*3 + k] = laneSelect(swap, -vi, vj);
+    }
+    const T rhoi = rho[i];
+    rho[i] = laneSelect(swap, rho[j], rhoi);
+    rho[j] = laneSelect(swap, rhoi, rho[j]);
+}
+
+/* Applies a Givens rotation eliminating element at column p, row q of B and
+   accumulates it into U */
+template<std::size_t p, std::size_t q, class T> void qrRotate(T(&b)[9], T(&u)[9]) {
+    const T a1 = b[p*3 + p];
+    const T a2 = b[p*3 + q];
+    const T rho = laneSqrt(a1*a1 + a2*a2);
+    const T sh0 = laneSelect(laneLess(T(QrEpsilon), rho), a2, T(0.0f));
+    const T ch0 = laneAbs(a1) + laneMax(rho, T(QrEpsilon));
+    const auto negative = laneLess(a1, T(0.0f));
+    const T w = laneRsqrt(ch0*ch0 + sh0*sh0);
+    const T ch = w*laneSelect(negative, sh0, ch0);
+    const T sh = w*laneSelect(negative, ch0, sh0);
+    const T c = ch*ch - sh*sh;
+    const T s = T(2.0f)*ch*sh;
+
+    /* B = Q^T B, U = U Q */
+    for(std::size_t k = 0; k != 3; ++k) {
+        const T bp = b[k*3 + p];
+        const T bq = b[k*3 + q];
+        b[k*3 + p] = c*bp + s*bq;
+        b[k*3 + q] = c*bq - s*bp;
+        const T up = u[p*3 + k];
+        const T uq = u[q*3 + k];
+        u[p*3 + k] = c*up + s*uq;
+        u[q*3 + k] = c*uq - s*up;
+    }
+}
+
+template<class T> void svdLanes(const T(&input)[9], T(&u)[9], T(&w)[3], T(&v)[9]) {
+    /* Normalize the matrix by its largest absolute element, which makes the
+       rest independent of the overall scale and the epsilons above absolute.
+       The reciprocal is calculated through a square root as there's no
+       division on ARMv7 NEON. */
+    T scale = laneAbs(input[0]);
+    for(std::size_t i = 1; i != 9; ++i)
+        scale = laneMax(scale, laneAbs(input[i]));
+    const T scaleRsqrt = laneRsqrt(scale);
+    const T inverseScale = laneSelect(laneLess(T(MinScale), scale), scaleRsqrt*scaleRsqrt, T(0.0f));
+    T m[9];
+    for(std::size_t i = 0; i != 9; ++i)
+        m[i] = input[i]*inverseScale;
+
+    /* Upper triangle of the symmetric S = M^T M */
+    T s00 = m[0]*m[0] + m[1]*m[1] + m[2]*m[2];
+    T s01 = m[0]*m[3] + m[1]*m[4] + m[2]*m[5];
+    T s02 = m[0]*m[6] + m[1]*m[7] + m[2]*m[8];
+    T s11 = m[3]*m[3] + m[4]*m[4] + m[5]*m[5];
+    T s12 = m[3]*m[6] + m[4]*m[7] + m[5]*m[8];
+    T s22 = m[6]*m[6] + m[7]*m[7] + m[8]*m[8];
+
+    /* Diagonalize it, accumulating the rotations into V */
+    for(std::size_t i = 0; i != 9; ++i)
+        v[i] = T(i % 4 == 0 ? 1.0f : 0.0f);
+    for(std::size_t i = 0; i != JacobiSweeps; ++i) {
+        jacobiRotate<0, 1>(s00, s11, s01, s02, s12, v);
+        jacobiRotate<1, 2>(s11, s22, s12, s01, s02, v);
+        jacobiRotate<0, 2>(s00, s22, s02, s01, s12, v);
+    }
+
+    /* B = M V, sort its columns by decreasing norm */
+    T b[9];
+    for(std::size_t col = 0; col != 3; ++col)
+        for(std::size_t row = 0; row != 3; ++row)
+            b[col*3 + row] = m[row]*v[col*3] + m[3 + row]*v[col*3 + 1] + m[6 + row]*v[col*3 + 2];
+    T rho[3];
+    for(std::size_t col = 0; col != 3; ++col)
+        rho[col] = b[col*3]*b[col*3] + b[col*3 + 1]*b[col*3 + 1] + b[col*3 + 2]*b[col*3 + 2];
+    sortColumns<0, 1>(b, v, rho);
+    sortColumns<0, 2>(b, v, rho);
+    sortColumns<1, 2>(b, v, rho);
+
+    /* QR decomposition of B, which results in U and an upper triangular
+       matrix with the (signed) singular values on the diagonal */
+    for(std::size_t i = 0; i != 9; ++i)
+        u[i] = T(i % 4 == 0 ? 1.0f : 0.0f);
+    qrRotate<0, 1>(b, u);
+    qrRotate<0, 2>(b, u);
+    qrRotate<1, 2>(b, u);
+    w[0] = b[0]*scale;
+    w[1] = b[4]*scale;
+    w[2] = b[8]*scale;
+}
+
+typedef void(*SvdFunction)(const char*, std::ptrdiff_t, char*, std::ptrdiff_t, char*, std::ptrdiff_t, char*, std::ptrdiff_t, std::size_t);
+
+void svdScalar(const char* src, const std::ptrdiff_t srcStride, char* u, const std::ptrdiff_t uStride, char* w, const std::ptrdiff_t wStride, char* v, const std::ptrdiff_t vStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        /* Copying the input first to allow in-place operation */
+        Float m[9];
+        for(std::size_t j = 0; j != 9; ++j)
+            m[j] = reinterpret_cast<const Float*>(src)[j];
+        svdLanes(m, *reinterpret_cast<Float(*)[9]>(u), *reinterpret_cast<Float(*)[3]>(w), *reinterpret_cast<Float(*)[9]>(v));
+        src += srcStride;
+        u += uStride;
+        w += wStride;
+        v += vStride;
+    }
+}
+
+#if defined(CORRADE_ENABLE_SSE2) && defined(CORRADE_TARGET_SSE2)
+/* Gathers / scatters the same element from four consecutive strided items */
+CORRADE_ENABLE_SSE2 inline Sse2Float loadLanesSse2(const char* const data, const std::ptrdiff_t stride, const std::size_t i) {
+    return _mm_setr_ps(
+        reinterpret_cast<const Float*>(data)[i],
+        reinterpret_cast<const Float*>(data + stride)[i],
+        reinterpret_cast<const Float*>(data + 2*stride)[i],
+        reinterpret_cast<const Float*>(data + 3*stride)[i]);
+}
+
+CORRADE_ENABLE_SSE2 inline void storeLanesSse2(char* const data, const std::ptrdiff_t stride, const std::size_t i, const Sse2Float value) {
+    alignas(16) Float lanes[4];
+    _mm_store_ps(lanes, value.v);
+    for(std::size_t j = 0; j != 4; ++j)
+        reinterpret_cast<Float*>(data + j*stride)[i] = lanes[j];
+}
+
+CORRADE_ENABLE_SSE2 void svdSse2(const char* src, const std::ptrdiff_t srcStride, char* u, const std::ptrdiff_t uStride, char* w, const std::ptrdiff_t wStride, char* v, const std::ptrdiff_t vStride, const std::size_t size) {
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        Sse2Float m[9], mu[9], mw[3], mv[9];
+        for(std::size_t j = 0; j != 9; ++j)
+            m[j] = loadLanesSse2(src, srcStride, j);
+        svdLanes(m, mu, mw, mv);
+        for(std::size_t j = 0; j != 9; ++j) {
+            storeLanesSse2(u, uStride, j, mu[j]);
+            storeLanesSse2(v, vStride, j, mv[j]);
+        }
+        for(std::size_t j = 0; j != 3; ++j)
+            storeLanesSse2(w, wStride, j, mw[j]);
+        src += 4*srcStride;
+        u += 4*uStride;
+        w += 4*wStride;
+        v += 4*vStride;
+    }
+
+    /* Remaining items */
+    svdScalar(src, srcStride, u, uStride, w, wStride, v, vStride, size - i);
+}
+#endif
+
+#if defined(CORRADE_ENABLE_NEON) && defined(CORRADE_TARGET_NEON)
+CORRADE_ENABLE_NEON inline NeonFloat loadLanesNeon(const char* const data, const std::ptrdiff_t stride, const std::size_t i) {
+    float32x4_t out = vdupq_n_f32(0.0f);
+    out = vsetq_lane_f32(reinterpret_cast<const Float*>(data)[i], out, 0);
+    out = vsetq_lane_f32(reinterpret_cast<const Float*>(data + stride)[i], out, 1);
+    out = vsetq_lane_f32(reinterpret_cast<const Float*>(data + 2*stride)[i], out, 2);
+    out = vsetq_lane_f32(reinterpret_cast<const Float*>(data + 3*stride)[i], out, 3);
+    return out;
+}
+
+CORRADE_ENABLE_NEON inline void storeLanesNeon(char* const data, const std::ptrdiff_t stride, const std::size_t i, const NeonFloat value) {
+    reinterpret_cast<Float*>(data)[i] = vgetq_lane_f32(value.v, 0);
+    reinterpret_cast<Float*>(data + stride)[i] = vgetq_lane_f32(value.v, 1);
+    reinterpret_cast<Float*>(data + 2*stride)[i] = vgetq_lane_f32(value.v, 2);
+    reinterpret_cast<Float*>(data + 3*stride)[i] = vgetq_lane_f32(value.v, 3);
+}
+
+CORRADE_ENABLE_NEON void svdNeon(const char* src, const std::ptrdiff_t srcStride, char* u, const std::ptrdiff_t uStride, char* w, const std::ptrdiff_t wStride, char* v, const std::ptrdiff_t vStride, const std::size_t size) {
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        NeonFloat m[9], mu[9], mw[3], mv[9];
+        for(std::size_t j = 0; j != 9; ++j)
+            m[j] = loadLanesNeon(src, srcStride, j);
+        svdLanes(m, mu, mw, mv);
+        for(std::size_t j = 0; j != 9; ++j) {
+            storeLanesNeon(u, uStride, j, mu[j]);
+            storeLanesNeon(v, vStride, j, mv[j]);
+        }
+        for(std::size_t j = 0; j != 3; ++j)
+            storeLanesNeon(w, wStride, j, mw[j]);
+        src += 4*srcStride;
+        u += 4*uStride;
+        w += 4*wStride;
+        v += 4*vStride;
+    }
+
+    /* Remaining items */
+    svdScalar(src, srcStride, u, uStride, w, wStride, v, vStride, size - i);
+}
+#endif
+
+struct Kernels {
+    SvdFunction svd;
+};
+
+Kernels kernelsFor(const Cpu::Features features) {
+    Kernels out{
+        svdScalar
+    };
+
+    #if defined(CORRADE_ENABLE_SSE2) && defined(CORRADE_TARGET_SSE2)
+    if(features & Cpu::Sse2)
+        out.svd = svdSse2;
+    #endif
+    #if defined(CORRADE_ENABLE_NEON) && defined(CORRADE_TARGET_NEON)
+    if(features & Cpu::Neon)
+        out.svd = svdNeon;
+    #endif
+
+    /* Silence unused variable warnings on platforms with no SIMD variant */
+    static_cast<void>(features);
+
+    return out;
+}
+
+const Kernels& kernels() {
+    /* Picked on first use, the static initialization is thread-safe */
+    static const Kernels out = kernelsFor(Cpu::runtimeFeatures());
+    return out;
+}
+
+}
+
+void svdInto(const Containers::StridedArrayView1D<const Matrix3x3<Float>>& matrices, const Containers::StridedArrayView1D<Matrix3x3<Float>>& u, const Containers::StridedArrayView1D<Vector3<Float>>& w, const Containers::StridedArrayView1D<Matrix3x3<Float>>& v) {
+    CORRADE_ASSERT(u.size() == matrices.size(),
+        "Math::Algorithms::svdInto(): expected U view to have" << matrices.size() << "items but got" << u.size(), );
+    CORRADE_ASSERT(w.size() == matrices.size(),
+        "Math::Algorithms::svdInto(): expected W view to have" << matrices.size() << "items but got" << w.size(), );
+    CORRADE_ASSERT(v.size() == matrices.size(),
+        "Math::Algorithms::svdInto(): expected V view to have" << matrices.size() << "items but got" << v.size(), );
+
+    kernels().svd(static_cast<const char*>(matrices.data()), matrices.stride(), static_cast<char*>(u.data()), u.stride(), static_cast<char*>(w.data()), w.stride(), static_cast<char*>(v.data()), v.stride(), matrices.size());
+}
+
+}}}
@@ -0,0 +1,89 @@
+#ifndef Magnum_Math_Algorithms_SvdBatch_h
+#define Magnum_Math_Algorithms_SvdBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Algorithms::svdInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+/**
+@brief Batch Singular Value Decomposition of 3x3 matrices
+@param[in]  matrices    Input matrices
+@param[out] u           Where to put the @f$ \boldsymbol{U} @f$ rotations
+@param[out] w           Where to put the singular values
+@param[out] v           Where to put the @f$ \boldsymbol{V} @f$ rotations
+@m_since_latest
+
+A specialized variant of @ref svd() for processing a large amount of @f$ 3
+\times 3 @f$ matrices. Each matrix is decomposed as follows: @f[
+    \boldsymbol{M} = \boldsymbol{U} \boldsymbol{\Sigma} \boldsymbol{V}^T
+@f]
+
+Unlike @ref svd(), which uses an iterative process until convergence, this
+function performs a fixed amount of Jacobi iterations with all data-dependent
+branches replaced with selects, which makes it possible to process several
+matrices at once using SIMD instructions. The SIMD variants are used only if
+the instruction set is enabled at compile time already, which is the case with
+SSE2 on x86-64 and with NEON on AArch64. The result differs from @ref svd() in
+the following aspects:
+
+-   Both @f$ \boldsymbol{U} @f$ and @f$ \boldsymbol{V} @f$ are always
+    rotation matrices, i.e. with a determinant of @f$ 1 @f$. Instead, if
+    @f$ \boldsymbol{M} @f$ has a negative determinant, the last singular value
+    is negative.
+-   The singular values are sorted by their absolute value in descending
+    order.
+-   The result never fails to converge, but it's accurate only up to around
+    @f$ 10^{-5} @f$ relative to the largest matrix element.
+
+Thanks to the first property, a rotation closest to @f$ \boldsymbol{M} @f$,
+useful for example in shape matching, can be directly calculated as
+@f$ \boldsymbol{U} \boldsymbol{V}^T @f$:
+
+@snippet MathAlgorithms.cpp svdInto
+
+Expects that all views have the same size. The @p u or @p v views are allowed
+to be the same as @p matrices to perform the operation in-place, partial
+overlaps are not allowed. Implementation based on *McAdams, A.; Selle, A.;
+Tamstorf, R.; Teran, J.; Sifakis, E. (2011). "Computing the Singular Value
+Decomposition of 3x3 matrices with minimal branching and elementary floating
+point operations"*.
+@see @ref gramSchmidtOrthonormalizeInto()
+*/
+MAGNUM_EXPORT void svdInto(const Containers::StridedArrayView1D<const Matrix3x3<Float>>& matrices, const Containers::StridedArrayView1D<Matrix3x3<Float>>& u, const Containers::StridedArrayView1D<Vector3<Float>>& w, const Containers::StridedArrayView1D<Matrix3x3<Float>>& v);
+
+}}}
+
+#endif
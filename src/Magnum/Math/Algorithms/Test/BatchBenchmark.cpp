@@ -0,0 +1,114 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <random>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix.h"
+#include "Magnum/Math/Algorithms/GramSchmidt.h"
+#include "Magnum/Math/Algorithms/GramSchmidtBatch.h"
+#include "Magnum/Math/Algorithms/Svd.h"
+#include "Magnum/Math/Algorithms/SvdBatch.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test { namespace {
+
+using Magnum::Matrix3x3;
+using Magnum::Vector3;
+
+struct BatchBenchmark: TestSuite::Tester {
+    explicit BatchBenchmark();
+
+    void svdBaseline();
+    void svdBatch();
+    void gramSchmidtOrthonormalizeBaseline();
+    void gramSchmidtOrthonormalizeBatch();
+
+    private:
+        Containers::Array<Matrix3x3> _matrices;
+        Containers::Array<Matrix3x3> _u, _v;
+        Containers::Array<Vector3> _w;
+};
+
+constexpr std::size_t BatchSize = 100000;
+
+BatchBenchmark::BatchBenchmark() {
+    addBenchmarks({&BatchBenchmark::svdBaseline,
+                   &BatchBenchmark::svdBatch,
+                   &BatchBenchmark::gramSchmidtOrthonormalizeBaseline,
+                   &BatchBenchmark::gramSchmidtOrthonormalizeBatch}, 10);
+
+    std::mt19937 g;
+    std::uniform_real_distribution<Float> d{-1.0f, 1.0f};
+    _matrices = Containers::Array<Matrix3x3>{Magnum::NoInit, BatchSize};
+    for(Matrix3x3& i: _matrices)
+        i = Matrix3x3{Vector3{d(g), d(g), d(g)},
+                      Vector3{d(g), d(g), d(g)},
+                      Vector3{d(g), d(g), d(g)}};
+    _u = Containers::Array<Matrix3x3>{Magnum::NoInit, BatchSize};
+    _v = Containers::Array<Matrix3x3>{Magnum::NoInit, BatchSize};
+    _w = Containers::Array<Vector3>{Magnum::NoInit, BatchSize};
+}
+
+void BatchBenchmark::svdBaseline() {
+    CORRADE_BENCHMARK(1) for(std::size_t i = 0; i != BatchSize; ++i) {
+        Containers::Optional<Containers::Triple<RectangularMatrix<3, 3, Float>, Math::Vector<3, Float>, Matrix3x3>> uwv = svd(_matrices[i]);
+        _u[i] = uwv->first();
+        _w[i] = uwv->second();
+        _v[i] = uwv->third();
+    }
+
+    CORRADE_VERIFY(_u[0].isOrthogonal());
+}
+
+void BatchBenchmark::svdBatch() {
+    CORRADE_BENCHMARK(1) {
+        svdInto(_matrices, _u, _w, _v);
+    }
+
+    CORRADE_VERIFY(_u[0].isOrthogonal());
+}
+
+void BatchBenchmark::gramSchmidtOrthonormalizeBaseline() {
+    CORRADE_BENCHMARK(1) for(std::size_t i = 0; i != BatchSize; ++i) {
+        _u[i] = gramSchmidtOrthonormalize(_matrices[i]);
+    }
+
+    CORRADE_VERIFY(_u[0].isOrthogonal());
+}
+
+void BatchBenchmark::gramSchmidtOrthonormalizeBatch() {
+    CORRADE_BENCHMARK(1) {
+        gramSchmidtOrthonormalizeInto(_matrices, _u);
+    }
+
+    CORRADE_VERIFY(_u[0].isOrthogonal());
+}
+
+}}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::BatchBenchmark)
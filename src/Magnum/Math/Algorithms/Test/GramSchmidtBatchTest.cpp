@@ -0,0 +1,132 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Algorithms/GramSchmidt.h"
+#include "Magnum/Math/Algorithms/GramSchmidtBatch.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test { namespace {
+
+struct GramSchmidtBatchTest: TestSuite::Tester {
+    explicit GramSchmidtBatchTest();
+
+    void orthonormalize();
+    void orthonormalizeInPlace();
+    void empty();
+
+    void assertions();
+};
+
+GramSchmidtBatchTest::GramSchmidtBatchTest() {
+    addTests({&GramSchmidtBatchTest::orthonormalize,
+              &GramSchmidtBatchTest::orthonormalizeInPlace,
+              &GramSchmidtBatchTest::empty,
+
+              &GramSchmidtBatchTest::assertions});
+}
+
+using Magnum::Matrix3x3;
+using Magnum::Matrix4;
+using Magnum::Vector3;
+
+using namespace Literals;
+
+const Matrix3x3 Matrices[]{
+    Matrix3x3{Vector3{3.0f, 5.0f, 1.0f},
+              Vector3{4.0f, 4.0f, 7.0f},
+              Vector3{7.0f, 1.0f, 8.0f}},
+    (Matrix4::scaling({2.0f, 0.5f, 1.5f})*Matrix4::rotationZ(-120.0_degf)).rotationScaling(),
+    (Matrix4::rotation(77.0_degf, Vector3{1.0f, -1.0f, 2.0f}.normalized())*Matrix4::scaling({3.0f, -0.5f, 1.0f})).rotationScaling(),
+    Matrix3x3{Math::IdentityInit},
+    Matrix3x3{Vector3{1.0e3f, 2.0f, -0.5f},
+              Vector3{-0.3f, 1.0e-2f, 4.0f},
+              Vector3{7.0f, 1.0e2f, 8.0f}},
+};
+
+void GramSchmidtBatchTest::orthonormalize() {
+    /* Interleaved with other data and an odd count to verify strides and
+       remainder handling are correct */
+    struct Data {
+        Matrix3x3 src;
+        Int padding;
+        Matrix3x3 dst;
+    } data[Containers::arraySize(Matrices)];
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i)
+        data[i].src = Matrices[i];
+
+    Containers::StridedArrayView1D<Data> view = data;
+    gramSchmidtOrthonormalizeInto(view.slice(&Data::src), view.slice(&Data::dst));
+
+    /* Ensure the results are consistent with non-batch APIs */
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(data[i].dst, gramSchmidtOrthonormalize(data[i].src));
+        CORRADE_VERIFY(data[i].dst.isOrthogonal());
+    }
+}
+
+void GramSchmidtBatchTest::orthonormalizeInPlace() {
+    Matrix3x3 matrices[Containers::arraySize(Matrices)];
+    Matrix3x3 expected[Containers::arraySize(Matrices)];
+    for(std::size_t i = 0; i != Containers::arraySize(Matrices); ++i) {
+        matrices[i] = Matrices[i];
+        expected[i] = gramSchmidtOrthonormalize(Matrices[i]);
+    }
+
+    gramSchmidtOrthonormalizeInto(matrices, matrices);
+    CORRADE_COMPARE_AS(Containers::arrayView(matrices),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void GramSchmidtBatchTest::empty() {
+    /* Shouldn't crash or assert */
+    gramSchmidtOrthonormalizeInto(nullptr, nullptr);
+    CORRADE_VERIFY(true);
+}
+
+void GramSchmidtBatchTest::assertions() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Matrix3x3 matrices[3];
+    Matrix3x3 matricesWrongCount[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    gramSchmidtOrthonormalizeInto(matrices, matricesWrongCount);
+    CORRADE_COMPARE(out.str(),
+        "Math::Algorithms::gramSchmidtOrthonormalizeInto(): wrong destination size, got 2 but expected 3\n");
+}
+
+}}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::GramSchmidtBatchTest)
@@ -25,8 +25,11 @@
 */
 
 #include <numeric>
+#include <sstream>
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Algorithms/KahanSum.h"
@@ -40,20 +43,39 @@ struct KahanSumTest: TestSuite::Tester {
     void integers();
     void iterative();
 
+    void chunkCount();
+    void chunk();
+    void chunked();
+    void chunkedEmpty();
+    void chunkedOrderIndependent();
+    void partialsEmpty();
+    void chunkSizeZero();
+    void chunkOutOfRange();
+
     void accumulate100kFloats();
     void accumulate100kDoubles();
     void kahan100kFloats();
-
+    void kahanChunked100kFloats();
 };
 
 KahanSumTest::KahanSumTest() {
     addTests({&KahanSumTest::floats,
               &KahanSumTest::integers,
-              &KahanSumTest::iterative});
+              &KahanSumTest::iterative,
+
+              &KahanSumTest::chunkCount,
+              &KahanSumTest::chunk,
+              &KahanSumTest::chunked,
+              &KahanSumTest::chunkedEmpty,
+              &KahanSumTest::chunkedOrderIndependent,
+              &KahanSumTest::partialsEmpty,
+              &KahanSumTest::chunkSizeZero,
+              &KahanSumTest::chunkOutOfRange});
 
     addBenchmarks({&KahanSumTest::accumulate100kFloats,
                    &KahanSumTest::accumulate100kDoubles,
-                   &KahanSumTest::kahan100kFloats}, 50);
+                   &KahanSumTest::kahan100kFloats,
+                   &KahanSumTest::kahanChunked100kFloats}, 50);
 }
 
 /* Custom iterator class to avoid allocating half a gigabyte for hundred
@@ -143,6 +165,102 @@ void KahanSumTest::iterative() {
     }
 }
 
+void KahanSumTest::chunkCount() {
+    CORRADE_COMPARE(kahanSumChunkCount(0), 0);
+    CORRADE_COMPARE(kahanSumChunkCount(1), 1);
+    CORRADE_COMPARE(kahanSumChunkCount(16384), 1);
+    CORRADE_COMPARE(kahanSumChunkCount(16385), 2);
+    CORRADE_COMPARE(kahanSumChunkCount(10, 3), 4);
+    CORRADE_COMPARE(kahanSumChunkCount(9, 3), 3);
+}
+
+void KahanSumTest::chunk() {
+    Containers::Array<Float> data{NoInit, 10};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = Float(i) + 0.5f;
+
+    /* The last chunk is smaller */
+    CORRADE_COMPARE(kahanSumChunk<Float>(data, 0, 4), 0.5f + 1.5f + 2.5f + 3.5f);
+    CORRADE_COMPARE(kahanSumChunk<Float>(data, 1, 4), 4.5f + 5.5f + 6.5f + 7.5f);
+    CORRADE_COMPARE(kahanSumChunk<Float>(data, 2, 4), 8.5f + 9.5f);
+}
+
+void KahanSumTest::chunked() {
+    /* Values with no exact float representation and a count that's larger
+       than what plain float accumulation can handle */
+    Containers::Array<Float> data{DirectInit, 10000000, 0.1f};
+
+    Float sum = kahanSumChunked(Containers::StridedArrayView1D<const Float>{data});
+    CORRADE_COMPARE(sum, Float(10000000*Double(0.1f)));
+
+    /* Should be the same with a mutable view and also roughly the same with
+       a different chunk size */
+    CORRADE_COMPARE(kahanSumChunked(Containers::stridedArrayView(data)), sum);
+    CORRADE_COMPARE(kahanSumChunked(Containers::stridedArrayView(data), 1000), sum);
+
+    /* Plain accumulation is significantly off */
+    CORRADE_VERIFY(std::accumulate(data.begin(), data.end(), 0.0f) != sum);
+}
+
+void KahanSumTest::chunkedEmpty() {
+    CORRADE_COMPARE(kahanSumChunked(Containers::StridedArrayView1D<const Float>{}), 0.0f);
+}
+
+void KahanSumTest::chunkedOrderIndependent() {
+    /* Values of wildly different magnitudes to make the roundoff errors
+       matter */
+    Containers::Array<Float> data{NoInit, 100003};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = Float((i*7919) % 1000)*(i % 3 ? 0.001f : 1000.0f);
+
+    const std::size_t chunkSize = 1024;
+    const std::size_t chunkCount = kahanSumChunkCount(data.size(), chunkSize);
+    CORRADE_COMPARE(chunkCount, 98);
+
+    /* Calculating the partials in a different order, simulating them being
+       calculated from multiple threads. There's no difference compared to
+       calculating them in order, but it verifies that there's no hidden
+       state. */
+    Containers::Array<Float> partials{NoInit, chunkCount};
+    for(std::size_t i = 0; i != chunkCount; ++i) {
+        const std::size_t chunk = (i*37) % chunkCount;
+        partials[chunk] = kahanSumChunk<Float>(data, chunk, chunkSize);
+    }
+
+    /* The result should be bit-exact with the serial variant */
+    const Float sum = kahanSumPartials<Float>(partials);
+    const Float sumChunked = kahanSumChunked(Containers::stridedArrayView(data), chunkSize);
+    CORRADE_VERIFY(sum == sumChunked);
+
+    Double expected = 0.0;
+    for(Float i: data) expected += i;
+    CORRADE_COMPARE(sum, Float(expected));
+}
+
+void KahanSumTest::partialsEmpty() {
+    CORRADE_COMPARE(kahanSumPartials(Containers::StridedArrayView1D<const Float>{}), 0.0f);
+}
+
+void KahanSumTest::chunkSizeZero() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    kahanSumChunkCount(10, 0);
+    CORRADE_COMPARE(out.str(), "Math::Algorithms::kahanSumChunkCount(): expected non-zero chunk size\n");
+}
+
+void KahanSumTest::chunkOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Float data[10]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    kahanSumChunk<Float>(data, 3, 4);
+    CORRADE_COMPARE(out.str(), "Math::Algorithms::kahanSumChunk(): index 3 out of range for 3 chunks\n");
+}
+
 void KahanSumTest::accumulate100kFloats() {
     Containers::Array<Float> data(DirectInit, 100000, 1.0f);
 
@@ -176,6 +294,17 @@ void KahanSumTest::kahan100kFloats() {
     CORRADE_COMPARE(Float(a), 100000.0f);
 }
 
+void KahanSumTest::kahanChunked100kFloats() {
+    Containers::Array<Float> data(DirectInit, 100000, 1.0f);
+
+    volatile Float a; /* to avoid optimizing the loop out */
+    CORRADE_BENCHMARK(10) {
+        a = kahanSumChunked(Containers::stridedArrayView(data));
+    }
+
+    CORRADE_COMPARE(Float(a), 100000.0f);
+}
+
 }}}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::KahanSumTest)
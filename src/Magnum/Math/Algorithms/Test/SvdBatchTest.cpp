@@ -0,0 +1,254 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <utility>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Algorithms/Svd.h"
+#include "Magnum/Math/Algorithms/SvdBatch.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test { namespace {
+
+struct SvdBatchTest: TestSuite::Tester {
+    explicit SvdBatchTest();
+
+    void decompose();
+    void singularValues();
+    void rotation();
+    void inPlace();
+    void empty();
+
+    void assertions();
+};
+
+SvdBatchTest::SvdBatchTest() {
+    addTests({&SvdBatchTest::decompose,
+              &SvdBatchTest::singularValues,
+              &SvdBatchTest::rotation,
+              &SvdBatchTest::inPlace,
+              &SvdBatchTest::empty,
+
+              &SvdBatchTest::assertions});
+}
+
+using Magnum::Matrix3x3;
+using Magnum::Matrix4;
+using Magnum::Vector3;
+
+using namespace Literals;
+
+const Matrix3x3 Matrices[]{
+    /* Rotation and scaling */
+    (Matrix4::rotationZ(35.0_degf)*Matrix4::scaling({1.5f, 2.0f, 1.0f})).rotationScaling(),
+    /* Scaling and rotation, resulting in a shear */
+    (Matrix4::scaling({1.5f, 2.0f, 1.0f})*Matrix4::rotationZ(35.0_degf)).rotationScaling(),
+    /* A reflection, i.e. a negative determinant */
+    (Matrix4::rotation(77.0_degf, Vector3{1.0f, -1.0f, 2.0f}.normalized())*Matrix4::scaling({3.0f, -0.5f, 1.0f})).rotationScaling(),
+    /* Rank-deficient, the third column is a multiple of the first */
+    Matrix3x3{Vector3{1.0f, 2.0f, -3.0f},
+              Vector3{0.5f, -4.0f, 1.0f},
+              Vector3{2.0f, 4.0f, -6.0f}},
+    /* Zero */
+    Matrix3x3{Math::ZeroInit},
+    /* Identity */
+    Matrix3x3{Math::IdentityInit},
+    /* Large scale, with no particular structure */
+    Matrix3x3{Vector3{1.0e6f, -3.0e5f, 2.5e6f},
+              Vector3{7.0e5f, 1.5e6f, -2.0e5f},
+              Vector3{-4.0e5f, 9.0e5f, 1.0e6f}},
+};
+
+/* Largest absolute difference between the matrices relative to the largest
+   absolute element of the first */
+Float relativeError(const Matrix3x3& actual, const Matrix3x3& expected) {
+    const Float scale = Math::abs(expected.toVector()).max();
+    const Float error = Math::abs((actual - expected).toVector()).max();
+    return scale == 0.0f ? error : error/scale;
+}
+
+void SvdBatchTest::decompose() {
+    /* Interleaved with other data and an odd count to verify strides and
+       remainder handling are correct */
+    struct Data {
+        Matrix3x3 m;
+        Int padding;
+        Matrix3x3 u;
+        Vector3 w;
+        Matrix3x3 v;
+    } data[Containers::arraySize(Matrices)];
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i)
+        data[i].m = Matrices[i];
+
+    Containers::StridedArrayView1D<Data> view = data;
+    svdInto(view.slice(&Data::m), view.slice(&Data::u), view.slice(&Data::w), view.slice(&Data::v));
+
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+
+        /* U and V are rotations */
+        CORRADE_VERIFY(data[i].u.isOrthogonal());
+        CORRADE_VERIFY(data[i].v.isOrthogonal());
+        CORRADE_COMPARE(data[i].u.determinant(), 1.0f);
+        CORRADE_COMPARE(data[i].v.determinant(), 1.0f);
+
+        /* The singular values are sorted by absolute value, only the last
+           one can be negative */
+        CORRADE_COMPARE_AS(data[i].w[1], 0.0f,
+            TestSuite::Compare::GreaterOrEqual);
+        CORRADE_COMPARE_AS(data[i].w[0], data[i].w[1]*(1.0f - 1.0e-5f),
+            TestSuite::Compare::GreaterOrEqual);
+        CORRADE_COMPARE_AS(data[i].w[1], Math::abs(data[i].w[2])*(1.0f - 1.0e-5f),
+            TestSuite::Compare::GreaterOrEqual);
+
+        /* Composing it back gives the original matrix */
+        CORRADE_COMPARE_AS(relativeError(data[i].u*Matrix3x3::fromDiagonal(data[i].w)*data[i].v.transposed(), data[i].m), 1.0e-5f,
+            TestSuite::Compare::Less);
+    }
+}
+
+void SvdBatchTest::singularValues() {
+    Vector3 w[Containers::arraySize(Matrices)];
+    Matrix3x3 u[Containers::arraySize(Matrices)];
+    Matrix3x3 v[Containers::arraySize(Matrices)];
+    svdInto(Matrices, u, w, v);
+
+    CORRADE_COMPARE(w[0], (Vector3{2.0f, 1.5f, 1.0f}));
+    CORRADE_COMPARE(w[1], (Vector3{2.0f, 1.5f, 1.0f}));
+    CORRADE_COMPARE(w[2], (Vector3{3.0f, 1.0f, -0.5f}));
+    CORRADE_COMPARE(w[4], Vector3{});
+    CORRADE_COMPARE(w[5], Vector3{1.0f});
+
+    /* Ensure the results are consistent with svd() up to the sign and
+       order */
+    for(std::size_t i = 0; i != Containers::arraySize(Matrices); ++i) {
+        CORRADE_ITERATION(i);
+        Containers::Optional<Containers::Triple<RectangularMatrix<3, 3, Float>, Math::Vector<3, Float>, Matrix3x3>> expected = svd(Matrices[i]);
+        CORRADE_VERIFY(expected);
+
+        Vector3 sorted = expected->second();
+        if(sorted[0] < sorted[1]) std::swap(sorted[0], sorted[1]);
+        if(sorted[0] < sorted[2]) std::swap(sorted[0], sorted[2]);
+        if(sorted[1] < sorted[2]) std::swap(sorted[1], sorted[2]);
+        CORRADE_COMPARE_AS(Math::abs(Math::abs(w[i]) - sorted).max(), 1.0e-5f*sorted[0],
+            TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void SvdBatchTest::rotation() {
+    /* Rotation extraction as done in shape matching. With the matrix being a
+       rotation multiplied by a symmetric positive matrix, U*V^T gives back
+       the rotation. */
+    const Matrix4 rotations[]{
+        Matrix4::rotationZ(35.0_degf),
+        Matrix4::rotation(-120.0_degf, Vector3{1.0f, 2.0f, -0.5f}.normalized()),
+        Matrix4::rotationX(170.0_degf)*Matrix4::rotationY(15.0_degf),
+        Matrix4{Math::IdentityInit},
+        Matrix4::rotationY(90.0_degf),
+    };
+    const Matrix3x3 stretch = (Matrix4::rotationX(20.0_degf)*Matrix4::scaling({1.2f, 0.7f, 1.0f})*Matrix4::rotationX(-20.0_degf)).rotationScaling();
+
+    Matrix3x3 matrices[Containers::arraySize(rotations)];
+    for(std::size_t i = 0; i != Containers::arraySize(rotations); ++i)
+        matrices[i] = rotations[i].rotationScaling()*stretch;
+
+    Matrix3x3 u[Containers::arraySize(rotations)];
+    Vector3 w[Containers::arraySize(rotations)];
+    Matrix3x3 v[Containers::arraySize(rotations)];
+    svdInto(matrices, u, w, v);
+
+    for(std::size_t i = 0; i != Containers::arraySize(rotations); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(u[i]*v[i].transposed(), rotations[i].rotationScaling());
+    }
+}
+
+void SvdBatchTest::inPlace() {
+    Matrix3x3 uv[Containers::arraySize(Matrices)];
+    Matrix3x3 expectedU[Containers::arraySize(Matrices)];
+    Matrix3x3 expectedV[Containers::arraySize(Matrices)];
+    Vector3 w[Containers::arraySize(Matrices)];
+    Vector3 expectedW[Containers::arraySize(Matrices)];
+    for(std::size_t i = 0; i != Containers::arraySize(Matrices); ++i)
+        uv[i] = Matrices[i];
+    svdInto(Matrices, expectedU, expectedW, expectedV);
+
+    /* Aliasing the input with U, the results should be the same as when not
+       aliased. Aliasing both U and V is obviously not possible. */
+    Matrix3x3 v[Containers::arraySize(Matrices)];
+    svdInto(uv, uv, w, v);
+    for(std::size_t i = 0; i != Containers::arraySize(Matrices); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(uv[i], expectedU[i]);
+        CORRADE_COMPARE(w[i], expectedW[i]);
+        CORRADE_COMPARE(v[i], expectedV[i]);
+    }
+
+    /* Aliasing the input with V */
+    Matrix3x3 u[Containers::arraySize(Matrices)];
+    for(std::size_t i = 0; i != Containers::arraySize(Matrices); ++i)
+        uv[i] = Matrices[i];
+    svdInto(uv, u, w, uv);
+    for(std::size_t i = 0; i != Containers::arraySize(Matrices); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(u[i], expectedU[i]);
+        CORRADE_COMPARE(w[i], expectedW[i]);
+        CORRADE_COMPARE(uv[i], expectedV[i]);
+    }
+}
+
+void SvdBatchTest::empty() {
+    /* Shouldn't crash or assert */
+    svdInto(nullptr, nullptr, nullptr, nullptr);
+    CORRADE_VERIFY(true);
+}
+
+void SvdBatchTest::assertions() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Matrix3x3 matrices[3];
+    Matrix3x3 matricesWrongCount[2];
+    Vector3 w[3];
+    Vector3 wWrongCount[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    svdInto(matrices, matricesWrongCount, w, matrices);
+    svdInto(matrices, matrices, wWrongCount, matrices);
+    svdInto(matrices, matrices, w, matricesWrongCount);
+    CORRADE_COMPARE(out.str(),
+        "Math::Algorithms::svdInto(): expected U view to have 3 items but got 2\n"
+        "Math::Algorithms::svdInto(): expected W view to have 3 items but got 2\n"
+        "Math::Algorithms::svdInto(): expected V view to have 3 items but got 2\n");
+}
+
+}}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::SvdBatchTest)
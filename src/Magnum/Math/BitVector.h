@@ -33,6 +33,7 @@
 
 /* std::declval() is said to be in <utility> but libstdc++, libc++ and MSVC STL
    all have it directly in <type_traits> because it just makes sense */
+#include <cstring>
 #include <type_traits>
 #include <Corrade/Containers/sequenceHelpers.h>
 #ifndef CORRADE_SINGLES_NO_DEBUG
@@ -40,6 +41,7 @@
 #endif
 
 #include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
 #include "Magnum/Math/Math.h"
 #include "Magnum/Math/Tags.h"
 
@@ -51,6 +53,37 @@ namespace Implementation {
     template<class T> constexpr T repeat(T value, std::size_t) { return value; }
 }
 
+#ifndef DOXYGEN_GENERATING_OUTPUT
+/* Functions.h includes this header so it can't be included here. On GCC and
+   Clang the builtins are used directly, elsewhere the popcount() declared
+   here is the exported one from Functions.cpp. */
+#if !defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+MAGNUM_EXPORT UnsignedInt popcount(UnsignedLong number);
+#endif
+
+namespace Implementation {
+    inline UnsignedInt bitVectorPopcount(UnsignedLong value) {
+        #if defined(CORRADE_TARGET_GCC) || defined(CORRADE_TARGET_CLANG)
+        return __builtin_popcountll(value);
+        #else
+        return popcount(value);
+        #endif
+    }
+
+    /* Undefined for zero, same as the builtin */
+    inline UnsignedInt bitVectorTrailingZeros(UnsignedLong value) {
+        #if defined(CORRADE_TARGET_GCC) || defined(CORRADE_TARGET_CLANG)
+        return __builtin_ctzll(value);
+        #else
+        /* Isolating the lowest set bit and counting the ones below it. Could
+           use _BitScanForward64() on MSVC, but that's not available on 32-bit
+           targets. */
+        return popcount((value & (~value + 1)) - 1);
+        #endif
+    }
+}
+#endif
+
 /**
 @brief Vector of bits
 @tparam size    Bit count
@@ -58,8 +91,15 @@ namespace Implementation {
 
 Result of component-wise comparison from @ref Vector. The boolean values are
 stored as bits in array of unsigned bytes, unused bits have undefined value
-which doesn't affect comparison or @ref all() / @ref none() / @ref any()
-functions. See also @ref matrix-vector for brief introduction.
+which doesn't affect comparison, @ref all() / @ref none() / @ref any(),
+@ref count() or @ref firstSet() / @ref nextSet() functions. See also
+@ref matrix-vector for brief introduction.
+
+Comparison, bitwise operations and the above queries process the storage
+64 bits at a time, with only the remaining bytes at the end processed one by
+one. For small vectors this compiles down to the same code as a plain byte
+loop, while for large masks, such as per-object visibility or feature flags,
+it makes the operations several times faster.
 
 @section Math-BitVector-indexing Bit indexing
 
@@ -83,6 +123,16 @@ the same way as if the variables were just scalars:
 
 @snippet Math.cpp BitVector-boolean
 
+@section Math-BitVector-iteration Iterating set bits
+
+Instead of checking every bit with @ref operator[](), the @ref firstSet() and
+@ref nextSet() functions can be used to skip directly to the bits that are
+set. Each step counts trailing zeros of a 64-bit word, so sparse masks are
+iterated in time proportional to the storage size divided by 64 plus the
+number of set bits:
+
+@snippet Math.cpp BitVector-iteration
+
 @see @ref Magnum::BitVector2, @ref Magnum::BitVector3, @ref Magnum::BitVector4
 */
 template<std::size_t size> class BitVector {
@@ -223,6 +273,37 @@ template<std::size_t size> class BitVector {
          */
         bool any() const { return !none(); }
 
+        /**
+         * @brief Count of bits set
+         * @m_since_latest
+         *
+         * Uses a popcount instruction on each 64-bit word of the storage
+         * where available.
+         * @see @ref popcount(), @ref all(), @ref none()
+         */
+        std::size_t count() const;
+
+        /**
+         * @brief Position of the first set bit
+         * @m_since_latest
+         *
+         * Returns @ref Size if no bits are set. Equivalent to calling
+         * @ref nextSet() with @cpp 0 @ce. See @ref Math-BitVector-iteration
+         * for an example.
+         */
+        std::size_t firstSet() const { return nextSet(0); }
+
+        /**
+         * @brief Position of the first set bit at or after given position
+         * @m_since_latest
+         *
+         * Returns @ref Size if no bits at position @p i or after are set or
+         * if @p i is not less than @ref Size. See
+         * @ref Math-BitVector-iteration for an example.
+         * @see @ref firstSet()
+         */
+        std::size_t nextSet(std::size_t i) const;
+
         /** @brief Bitwise inversion */
         BitVector<size> operator~() const;
 
@@ -241,7 +322,9 @@ template<std::size_t size> class BitVector {
          * The computation is done in-place.
          */
         BitVector<size>& operator&=(const BitVector<size>& other) {
-            for(std::size_t i = 0; i != DataSize; ++i)
+            for(std::size_t i = 0; i != FullWordCount; ++i)
+                storeWord(i, loadWord(i) & other.loadWord(i));
+            for(std::size_t i = FullWordCount*8; i != DataSize; ++i)
                 _data[i] &= other._data[i];
 
             return *this;
@@ -273,7 +356,9 @@ template<std::size_t size> class BitVector {
          * The computation is done in-place.
          */
         BitVector<size>& operator|=(const BitVector<size>& other) {
-            for(std::size_t i = 0; i != DataSize; ++i)
+            for(std::size_t i = 0; i != FullWordCount; ++i)
+                storeWord(i, loadWord(i) | other.loadWord(i));
+            for(std::size_t i = FullWordCount*8; i != DataSize; ++i)
                 _data[i] |= other._data[i];
 
             return *this;
@@ -305,7 +390,9 @@ template<std::size_t size> class BitVector {
          * The computation is done in-place.
          */
         BitVector<size>& operator^=(const BitVector<size>& other) {
-            for(std::size_t i = 0; i != DataSize; ++i)
+            for(std::size_t i = 0; i != FullWordCount; ++i)
+                storeWord(i, loadWord(i) ^ other.loadWord(i));
+            for(std::size_t i = FullWordCount*8; i != DataSize; ++i)
                 _data[i] ^= other._data[i];
 
             return *this;
@@ -322,10 +409,33 @@ template<std::size_t size> class BitVector {
 
     private:
         enum: UnsignedByte {
-            FullSegmentMask = 0xFF,
-            LastSegmentMask = (1 << size%8) - 1
+            FullSegmentMask = 0xFF
         };
 
+        enum: std::size_t {
+            /* Count of 64-bit words fully covered by the storage, the
+               remaining DataSize%8 bytes are processed one by one */
+            FullWordCount = DataSize/8,
+            /* Count of 64-bit words including the partial one */
+            WordCount = (DataSize + 7)/8
+        };
+
+        /* Raw load and store of a full 64-bit word, bit order dependent on
+           platform endianness. Used for bitwise operations where the order
+           doesn't matter. */
+        UnsignedLong loadWord(std::size_t i) const {
+            UnsignedLong out;
+            std::memcpy(&out, _data + i*8, 8);
+            return out;
+        }
+        void storeWord(std::size_t i, UnsignedLong value) {
+            std::memcpy(_data + i*8, &value, 8);
+        }
+
+        /* Word i with bit n corresponding to bit i*64 + n and unused bits
+           masked away, used for comparison and queries */
+        UnsignedLong word(std::size_t i) const;
+
         /* Implementation for Vector<size, T>::Vector(U) */
         template<std::size_t ...sequence> constexpr explicit BitVector(Containers::Implementation::Sequence<sequence...>, UnsignedByte value): _data{Implementation::repeat(value, sequence)...} {}
 
@@ -376,45 +486,86 @@ template<std::size_t size> Debug& operator<<(Debug& debug, const BitVector<size>
 }
 #endif
 
-template<std::size_t size> inline bool BitVector<size>::operator==(const BitVector<size>& other) const {
-    for(std::size_t i = 0; i != size/8; ++i)
-        if(_data[i] != other._data[i]) return false;
+template<std::size_t size> inline UnsignedLong BitVector<size>::word(const std::size_t i) const {
+    UnsignedLong out;
+
+    /* Full words are loaded directly on little-endian platforms, the partial
+       word at the end and all words on big-endian platforms are assembled
+       byte by byte */
+    #ifndef CORRADE_TARGET_BIG_ENDIAN
+    if(i < FullWordCount) out = loadWord(i);
+    else
+    #endif
+    {
+        out = 0;
+        const std::size_t end = i*8 + 8 < DataSize ? i*8 + 8 : DataSize;
+        for(std::size_t j = i*8; j != end; ++j)
+            out |= UnsignedLong(_data[j]) << (j - i*8)*8;
+    }
 
-    /* Check last segment */
-    if(size%8 && (_data[DataSize-1] & LastSegmentMask) != (other._data[DataSize-1] & LastSegmentMask))
-        return false;
+    /* Mask away unused bits in the last word */
+    if(size%64 && i == WordCount - 1)
+        out &= (UnsignedLong{1} << size%64) - 1;
+
+    return out;
+}
+
+template<std::size_t size> inline bool BitVector<size>::operator==(const BitVector<size>& other) const {
+    for(std::size_t i = 0; i != WordCount; ++i)
+        if(word(i) != other.word(i)) return false;
 
     return true;
 }
 
 template<std::size_t size> inline bool BitVector<size>::all() const {
-    /* Check all full segments */
-    for(std::size_t i = 0; i != size/8; ++i)
-        if(_data[i] != FullSegmentMask) return false;
+    /* Check all full words */
+    for(std::size_t i = 0; i != size/64; ++i)
+        if(word(i) != ~UnsignedLong{}) return false;
 
-    /* Check last segment */
-    if(size%8 && (_data[DataSize-1] & LastSegmentMask) != LastSegmentMask)
+    /* Check last word */
+    if(size%64 && word(WordCount - 1) != (UnsignedLong{1} << size%64) - 1)
         return false;
 
     return true;
 }
 
 template<std::size_t size> inline bool BitVector<size>::none() const {
-    /* Check all full segments */
-    for(std::size_t i = 0; i != size/8; ++i)
-        if(_data[i]) return false;
-
-    /* Check last segment */
-    if(size%8 && (_data[DataSize-1] & LastSegmentMask))
-        return false;
+    for(std::size_t i = 0; i != WordCount; ++i)
+        if(word(i)) return false;
 
     return true;
 }
 
+template<std::size_t size> inline std::size_t BitVector<size>::count() const {
+    std::size_t out = 0;
+    for(std::size_t i = 0; i != WordCount; ++i)
+        out += Implementation::bitVectorPopcount(word(i));
+
+    return out;
+}
+
+template<std::size_t size> inline std::size_t BitVector<size>::nextSet(const std::size_t i) const {
+    if(i >= size) return size;
+
+    /* Mask away bits before i in the first word, then find the first
+       non-zero word. Unused bits in the last word are masked away by word()
+       so the result is never out of bounds. */
+    std::size_t w = i/64;
+    UnsignedLong value = word(w) & (~UnsignedLong{} << i%64);
+    while(!value) {
+        if(++w == WordCount) return size;
+        value = word(w);
+    }
+
+    return w*64 + Implementation::bitVectorTrailingZeros(value);
+}
+
 template<std::size_t size> inline BitVector<size> BitVector<size>::operator~() const {
     BitVector<size> out{Magnum::NoInit};
 
-    for(std::size_t i = 0; i != DataSize; ++i)
+    for(std::size_t i = 0; i != FullWordCount; ++i)
+        out.storeWord(i, ~loadWord(i));
+    for(std::size_t i = FullWordCount*8; i != DataSize; ++i)
         out._data[i] = ~_data[i];
 
     return out;
@@ -26,10 +26,21 @@
 
 #include "ColorBatch.h"
 
+#include <cmath>
 #include <cstring>
+#include <type_traits>
+#include <Corrade/Cpu.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
 
-#include "Magnum/Magnum.h"
+#include "Magnum/Math/Color.h"
+
+#ifdef CORRADE_ENABLE_SSE2
+#include <Corrade/Utility/IntrinsicsSse2.h>
+#endif
+#ifdef CORRADE_ENABLE_NEON
+#include <arm_neon.h>
+#endif
 
 namespace Magnum { namespace Math {
 
@@ -236,4 +247,613 @@ void yFlipBc5InPlace(const Containers::StridedArrayView4D<char>& blocks) {
     );
 }
 
+namespace {
+
+/* All conversion kernels operate on a single row of pixels, given as
+   type-erased pointers and strides, the public APIs then iterate over the
+   rows. This allows the same signature to be shared by all variants. */
+typedef void(*ConvertFunction)(const char*, std::ptrdiff_t, char*, std::ptrdiff_t, std::size_t);
+
+template<class T, class U> void convertRows(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<U>& dst, const ConvertFunction function) {
+    const char* srcRow = static_cast<const char*>(src.data());
+    char* dstRow = static_cast<char*>(dst.data());
+    for(std::size_t i = 0, rows = src.size()[0]; i != rows; ++i) {
+        function(srcRow, src.stride()[1], dstRow, dst.stride()[1], src.size()[1]);
+        srcRow += src.stride()[0];
+        dstRow += dst.stride()[0];
+    }
+}
+
+/* Same formulas as in Color3::fromSrgb() and Color3::toSrgb(), just for a
+   single component */
+inline Float fromSrgbComponent(const Float srgb) {
+    return srgb > 0.04045f ? std::pow((srgb + 0.055f)/1.055f, 2.4f) : srgb/12.92f;
+}
+
+inline Float toSrgbComponent(const Float linear) {
+    return linear > 0.0031308f ? 1.055f*std::pow(linear, 1.0f/2.4f) - 0.055f : linear*12.92f;
+}
+
+/* Unlike pack(), which doesn't range-check the input, the 8-bit output is
+   clamped */
+inline UnsignedByte packClamped(const Float value) {
+    return UnsignedByte(std::floor(Math::clamp(value, 0.0f, 1.0f)*255.0f + 0.5f));
+}
+
+/* 8-bit sRGB input is converted via a lookup table, there's no point in
+   having SIMD variants as there's no gather instruction in SSE2 or NEON
+   anyway */
+struct FromSrgbTable {
+    explicit FromSrgbTable() {
+        for(std::size_t i = 0; i != 256; ++i)
+            data[i] = fromSrgbComponent(unpack<Float>(UnsignedByte(i)));
+    }
+
+    Float data[256];
+};
+
+const Float* fromSrgbTable() {
+    /* Calculated on first use, the static initialization is thread-safe */
+    static const FromSrgbTable table;
+    return table.data;
+}
+
+template<std::size_t components> void fromSrgb8Scalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    const Float* const table = fromSrgbTable();
+    for(std::size_t i = 0; i != size; ++i) {
+        const UnsignedByte* const s = reinterpret_cast<const UnsignedByte*>(src);
+        Float* const d = reinterpret_cast<Float*>(dst);
+        d[0] = table[s[0]];
+        d[1] = table[s[1]];
+        d[2] = table[s[2]];
+        /* Alpha is linear */
+        if(components == 4) d[3] = unpack<Float>(s[3]);
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+template<std::size_t components, Float(*convert)(Float)> void convertScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Float* const s = reinterpret_cast<const Float*>(src);
+        Float* const d = reinterpret_cast<Float*>(dst);
+        /* Alpha is linear. Copied first in case this operates in-place. */
+        if(components == 4) d[3] = s[3];
+        d[0] = convert(s[0]);
+        d[1] = convert(s[1]);
+        d[2] = convert(s[2]);
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+template<std::size_t components> void toSrgb8Scalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Float* const s = reinterpret_cast<const Float*>(src);
+        UnsignedByte* const d = reinterpret_cast<UnsignedByte*>(dst);
+        d[0] = packClamped(toSrgbComponent(s[0]));
+        d[1] = packClamped(toSrgbComponent(s[1]));
+        d[2] = packClamped(toSrgbComponent(s[2]));
+        /* Alpha is linear */
+        if(components == 4) d[3] = packClamped(s[3]);
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+void premultiplyAlphaScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Color4<Float>& s = *reinterpret_cast<const Color4<Float>*>(src);
+        *reinterpret_cast<Color4<Float>*>(dst) = Color4<Float>{s.rgb()*s.a(), s.a()};
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+void unpremultiplyAlphaScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Color4<Float>& s = *reinterpret_cast<const Color4<Float>*>(src);
+        *reinterpret_cast<Color4<Float>*>(dst) = s.a() == 0.0f ?
+            Color4<Float>{0.0f, 0.0f, 0.0f, s.a()} :
+            Color4<Float>{s.rgb()/s.a(), s.a()};
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+/* Calculates round(c*a/255) exactly, without a division */
+inline UnsignedByte multiplyUnorm8(const UnsignedInt c, const UnsignedInt a) {
+    const UnsignedInt t = c*a + 128;
+    return UnsignedByte((t + (t >> 8)) >> 8);
+}
+
+void premultiplyAlpha8Scalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const UnsignedByte* const s = reinterpret_cast<const UnsignedByte*>(src);
+        UnsignedByte* const d = reinterpret_cast<UnsignedByte*>(dst);
+        const UnsignedByte a = s[3];
+        d[0] = multiplyUnorm8(s[0], a);
+        d[1] = multiplyUnorm8(s[1], a);
+        d[2] = multiplyUnorm8(s[2], a);
+        d[3] = a;
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+/* There's no integer division in SSE2 or NEON, so this one is scalar only */
+void unpremultiplyAlpha8Scalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const UnsignedByte* const s = reinterpret_cast<const UnsignedByte*>(src);
+        UnsignedByte* const d = reinterpret_cast<UnsignedByte*>(dst);
+        const UnsignedInt a = s[3];
+        for(std::size_t j = 0; j != 3; ++j)
+            d[j] = a ? UnsignedByte(Math::min((s[j]*255u + a/2)/a, 255u)) : 0;
+        d[3] = UnsignedByte(a);
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+/* The SIMD variants process one pixel at a time, with the red, green, blue
+   and alpha channels in the four lanes, which makes them independent of the
+   pixel stride. The sRGB curve is calculated as pow(x, y) = exp2(y*log2(x)),
+   with log2() being an odd polynomial of (m - 1)/(m + 1) for a mantissa m in
+   [sqrt(0.5), sqrt(2)) and exp2() a polynomial of a fractional part in
+   [-0.5, 0.5] multiplied with an integer power of two. Both are truncated
+   Taylor series, which gives a relative error below 1e-6 compared to
+   std::pow(). */
+constexpr Float Log2C1 = 2.885390082f; /* 2/ln(2) */
+constexpr Float Log2C3 = 0.9617966939f; /* 2/(3 ln(2)) */
+constexpr Float Log2C5 = 0.5770780164f; /* 2/(5 ln(2)) */
+constexpr Float Log2C7 = 0.4121985831f; /* 2/(7 ln(2)) */
+constexpr Float Exp2C1 = 0.6931471806f; /* ln(2) */
+constexpr Float Exp2C2 = 0.2402265070f; /* ln(2)^2/2! */
+constexpr Float Exp2C3 = 0.05550410866f; /* ln(2)^3/3! */
+constexpr Float Exp2C4 = 0.009618129108f; /* ln(2)^4/4! */
+constexpr Float Exp2C5 = 0.001333355815f; /* ln(2)^5/5! */
+constexpr Float Exp2C6 = 0.0001540353039f; /* ln(2)^6/6! */
+/* Bit representation of sqrt(0.5) */
+constexpr Int SqrtHalfBits = 0x3f3504f3;
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_ENABLE_SSE2 inline __m128 log2Sse2(const __m128 x) {
+    /* Subtracting the bit representation of sqrt(0.5) makes the exponent
+       field contain the power of two for a mantissa in [sqrt(0.5), sqrt(2)) */
+    const __m128i bits = _mm_sub_epi32(_mm_castps_si128(x), _mm_set1_epi32(SqrtHalfBits));
+    const __m128 exponent = _mm_cvtepi32_ps(_mm_srai_epi32(bits, 23));
+    const __m128 m = _mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(SqrtHalfBits)));
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 t = _mm_div_ps(_mm_sub_ps(m, one), _mm_add_ps(m, one));
+    const __m128 t2 = _mm_mul_ps(t, t);
+    __m128 p = _mm_add_ps(_mm_mul_ps(t2, _mm_set1_ps(Log2C7)), _mm_set1_ps(Log2C5));
+    p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(Log2C3));
+    p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(Log2C1));
+    return _mm_add_ps(exponent, _mm_mul_ps(p, t));
+}
+
+CORRADE_ENABLE_SSE2 inline __m128 exp2Sse2(__m128 y) {
+    /* Clamped to the range of normal floats */
+    y = _mm_min_ps(_mm_max_ps(y, _mm_set1_ps(-126.0f)), _mm_set1_ps(127.0f));
+    const __m128i i = _mm_cvtps_epi32(y);
+    const __m128 f = _mm_sub_ps(y, _mm_cvtepi32_ps(i));
+    __m128 p = _mm_add_ps(_mm_mul_ps(f, _mm_set1_ps(Exp2C6)), _mm_set1_ps(Exp2C5));
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(Exp2C4));
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(Exp2C3));
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(Exp2C2));
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(Exp2C1));
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(1.0f));
+    return _mm_mul_ps(p, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(i, _mm_set1_epi32(127)), 23)));
+}
+
+CORRADE_ENABLE_SSE2 inline __m128 selectSse2(const __m128 mask, const __m128 a, const __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+/* The power is calculated for all lanes, values where it's a NaN are then
+   replaced with the linear part */
+CORRADE_ENABLE_SSE2 inline __m128 fromSrgbSse2(const __m128 srgb) {
+    const __m128 curve = exp2Sse2(_mm_mul_ps(_mm_set1_ps(2.4f), log2Sse2(_mm_mul_ps(_mm_add_ps(srgb, _mm_set1_ps(0.055f)), _mm_set1_ps(1.0f/1.055f)))));
+    return selectSse2(_mm_cmpgt_ps(srgb, _mm_set1_ps(0.04045f)), curve, _mm_div_ps(srgb, _mm_set1_ps(12.92f)));
+}
+
+CORRADE_ENABLE_SSE2 inline __m128 toSrgbSse2(const __m128 linear) {
+    const __m128 curve = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(1.055f), exp2Sse2(_mm_mul_ps(_mm_set1_ps(1.0f/2.4f), log2Sse2(linear)))), _mm_set1_ps(0.055f));
+    return selectSse2(_mm_cmpgt_ps(linear, _mm_set1_ps(0.0031308f)), curve, _mm_mul_ps(linear, _mm_set1_ps(12.92f)));
+}
+
+CORRADE_ENABLE_SSE2 inline __m128 alphaMaskSse2() {
+    return _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+}
+
+CORRADE_ENABLE_SSE2 inline __m128 loadPixelSse2(const char* const data, std::integral_constant<std::size_t, 3>) {
+    const Float* const d = reinterpret_cast<const Float*>(data);
+    return _mm_setr_ps(d[0], d[1], d[2], 0.0f);
+}
+
+CORRADE_ENABLE_SSE2 inline __m128 loadPixelSse2(const char* const data, std::integral_constant<std::size_t, 4>) {
+    return _mm_loadu_ps(reinterpret_cast<const Float*>(data));
+}
+
+CORRADE_ENABLE_SSE2 inline void storePixelSse2(char* const data, const __m128 value, std::integral_constant<std::size_t, 3>) {
+    alignas(16) Float out[4];
+    _mm_store_ps(out, value);
+    std::memcpy(data, out, 3*sizeof(Float));
+}
+
+CORRADE_ENABLE_SSE2 inline void storePixelSse2(char* const data, const __m128 value, std::integral_constant<std::size_t, 4>) {
+    _mm_storeu_ps(reinterpret_cast<Float*>(data), value);
+}
+
+template<std::size_t components, __m128(*convert)(__m128)> CORRADE_ENABLE_SSE2 void convertSse2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    const std::integral_constant<std::size_t, components> c{};
+    for(std::size_t i = 0; i != size; ++i) {
+        const __m128 pixel = loadPixelSse2(src, c);
+        /* Alpha is linear, kept as-is */
+        storePixelSse2(dst, selectSse2(alphaMaskSse2(), pixel, convert(pixel)), c);
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+template<std::size_t components> CORRADE_ENABLE_SSE2 void toSrgb8Sse2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    const std::integral_constant<std::size_t, components> c{};
+    for(std::size_t i = 0; i != size; ++i) {
+        const __m128 pixel = loadPixelSse2(src, c);
+        /* Alpha is linear, kept as-is. Then the same as packClamped(), the
+           value is positive so truncation after adding 0.5 is rounding. */
+        const __m128 value = selectSse2(alphaMaskSse2(), pixel, toSrgbSse2(pixel));
+        const __m128 clamped = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+        const __m128i integers = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(clamped, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+        const __m128i shorts = _mm_packs_epi32(integers, integers);
+        const Int bytes = _mm_cvtsi128_si32(_mm_packus_epi16(shorts, shorts));
+        std::memcpy(dst, &bytes, components);
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+CORRADE_ENABLE_SSE2 void premultiplyAlphaSse2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const __m128 pixel = _mm_loadu_ps(reinterpret_cast<const Float*>(src));
+        /* Multiplying alpha by itself would change it, so using 1 there */
+        const __m128 alpha = selectSse2(alphaMaskSse2(), _mm_set1_ps(1.0f), _mm_shuffle_ps(pixel, pixel, _MM_SHUFFLE(3, 3, 3, 3)));
+        _mm_storeu_ps(reinterpret_cast<Float*>(dst), _mm_mul_ps(pixel, alpha));
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+CORRADE_ENABLE_SSE2 void unpremultiplyAlphaSse2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const __m128 pixel = _mm_loadu_ps(reinterpret_cast<const Float*>(src));
+        const __m128 alpha = _mm_shuffle_ps(pixel, pixel, _MM_SHUFFLE(3, 3, 3, 3));
+        /* Zero alpha results in a zero color, alpha itself is kept */
+        const __m128 color = _mm_andnot_ps(_mm_cmpeq_ps(alpha, _mm_setzero_ps()), _mm_div_ps(pixel, alpha));
+        _mm_storeu_ps(reinterpret_cast<Float*>(dst), selectSse2(alphaMaskSse2(), pixel, color));
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+CORRADE_ENABLE_SSE2 void premultiplyAlpha8Sse2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    /* Four pixels at a time if the pixels are contiguous, otherwise
+       everything goes through the scalar variant */
+    std::size_t i = 0;
+    if(srcStride == 4 && dstStride == 4) {
+        const __m128i zero = _mm_setzero_si128();
+        /* Alpha channel multiplied by 255 to keep it unchanged */
+        const __m128i colorMask = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+        const __m128i alphaOne = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+        const __m128i half = _mm_set1_epi16(128);
+        for(; i + 4 <= size; i += 4) {
+            const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            __m128i halves[2]{_mm_unpacklo_epi8(pixels, zero),
+                              _mm_unpackhi_epi8(pixels, zero)};
+            for(__m128i& h: halves) {
+                const __m128i alpha = _mm_or_si128(_mm_and_si128(_mm_shufflehi_epi16(_mm_shufflelo_epi16(h, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3)), colorMask), alphaOne);
+                /* Same as multiplyUnorm8(), there's no overflow as
+                   255*255 + 128 + 254 still fits into 16 bits */
+                const __m128i t = _mm_add_epi16(_mm_mullo_epi16(h, alpha), half);
+                h = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(halves[0], halves[1]));
+            src += 4*srcStride;
+            dst += 4*dstStride;
+        }
+    }
+
+    /* Remaining items */
+    premultiplyAlpha8Scalar(src, srcStride, dst, dstStride, size - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_NEON
+/* There's no division on ARMv7, using the reciprocal estimate refined with
+   two Newton-Raphson steps instead */
+CORRADE_ENABLE_NEON inline float32x4_t reciprocalNeon(const float32x4_t a) {
+    float32x4_t y = vrecpeq_f32(a);
+    y = vmulq_f32(y, vrecpsq_f32(a, y));
+    y = vmulq_f32(y, vrecpsq_f32(a, y));
+    return y;
+}
+
+CORRADE_ENABLE_NEON inline float32x4_t log2Neon(const float32x4_t x) {
+    /* Subtracting the bit representation of sqrt(0.5) makes the exponent
+       field contain the power of two for a mantissa in [sqrt(0.5), sqrt(2)) */
+    const int32x4_t bits = vsubq_s32(vreinterpretq_s32_f32(x), vdupq_n_s32(SqrtHalfBits));
+    const float32x4_t exponent = vcvtq_f32_s32(vshrq_n_s32(bits, 23));
+    const float32x4_t m = vreinterpretq_f32_s32(vaddq_s32(vandq_s32(bits, vdupq_n_s32(0x007fffff)), vdupq_n_s32(SqrtHalfBits)));
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t t = vmulq_f32(vsubq_f32(m, one), reciprocalNeon(vaddq_f32(m, one)));
+    const float32x4_t t2 = vmulq_f32(t, t);
+    float32x4_t p = vmlaq_f32(vdupq_n_f32(Log2C5), t2, vdupq_n_f32(Log2C7));
+    p = vmlaq_f32(vdupq_n_f32(Log2C3), p, t2);
+    p = vmlaq_f32(vdupq_n_f32(Log2C1), p, t2);
+    return vmlaq_f32(exponent, p, t);
+}
+
+CORRADE_ENABLE_NEON inline float32x4_t exp2Neon(float32x4_t y) {
+    /* Clamped to the range of normal floats. There's no rounding conversion
+       on ARMv7, the value is made positive so truncation is flooring. */
+    y = vminq_f32(vmaxq_f32(y, vdupq_n_f32(-126.0f)), vdupq_n_f32(127.0f));
+    const int32x4_t i = vsubq_s32(vcvtq_s32_f32(vaddq_f32(y, vdupq_n_f32(126.5f))), vdupq_n_s32(126));
+    const float32x4_t f = vsubq_f32(y, vcvtq_f32_s32(i));
+    float32x4_t p = vmlaq_f32(vdupq_n_f32(Exp2C5), f, vdupq_n_f32(Exp2C6));
+    p = vmlaq_f32(vdupq_n_f32(Exp2C4), p, f);
+    p = vmlaq_f32(vdupq_n_f32(Exp2C3), p, f);
+    p = vmlaq_f32(vdupq_n_f32(Exp2C2), p, f);
+    p = vmlaq_f32(vdupq_n_f32(Exp2C1), p, f);
+    p = vmlaq_f32(vdupq_n_f32(1.0f), p, f);
+    return vmulq_f32(p, vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(i, vdupq_n_s32(127)), 23)));
+}
+
+CORRADE_ENABLE_NEON inline float32x4_t fromSrgbNeon(const float32x4_t srgb) {
+    const float32x4_t curve = exp2Neon(vmulq_f32(vdupq_n_f32(2.4f), log2Neon(vmulq_f32(vaddq_f32(srgb, vdupq_n_f32(0.055f)), vdupq_n_f32(1.0f/1.055f)))));
+    return vbslq_f32(vcgtq_f32(srgb, vdupq_n_f32(0.04045f)), curve, vmulq_f32(srgb, vdupq_n_f32(1.0f/12.92f)));
+}
+
+CORRADE_ENABLE_NEON inline float32x4_t toSrgbNeon(const float32x4_t linear) {
+    const float32x4_t curve = vsubq_f32(vmulq_f32(vdupq_n_f32(1.055f), exp2Neon(vmulq_f32(vdupq_n_f32(1.0f/2.4f), log2Neon(linear)))), vdupq_n_f32(0.055f));
+    return vbslq_f32(vcgtq_f32(linear, vdupq_n_f32(0.0031308f)), curve, vmulq_f32(linear, vdupq_n_f32(12.92f)));
+}
+
+CORRADE_ENABLE_NEON inline uint32x4_t alphaMaskNeon() {
+    const UnsignedInt mask[]{0, 0, 0, 0xffffffffu};
+    return vld1q_u32(mask);
+}
+
+CORRADE_ENABLE_NEON inline float32x4_t loadPixelNeon(const char* const data, std::integral_constant<std::size_t, 3>) {
+    const Float* const d = reinterpret_cast<const Float*>(data);
+    return vcombine_f32(vld1_f32(d), vset_lane_f32(d[2], vdup_n_f32(0.0f), 0));
+}
+
+CORRADE_ENABLE_NEON inline float32x4_t loadPixelNeon(const char* const data, std::integral_constant<std::size_t, 4>) {
+    return vld1q_f32(reinterpret_cast<const Float*>(data));
+}
+
+CORRADE_ENABLE_NEON inline void storePixelNeon(char* const data, const float32x4_t value, std::integral_constant<std::size_t, 3>) {
+    Float* const d = reinterpret_cast<Float*>(data);
+    vst1_f32(d, vget_low_f32(value));
+    d[2] = vgetq_lane_f32(value, 2);
+}
+
+CORRADE_ENABLE_NEON inline void storePixelNeon(char* const data, const float32x4_t value, std::integral_constant<std::size_t, 4>) {
+    vst1q_f32(reinterpret_cast<Float*>(data), value);
+}
+
+template<std::size_t components, float32x4_t(*convert)(float32x4_t)> CORRADE_ENABLE_NEON void convertNeon(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    const std::integral_constant<std::size_t, components> c{};
+    for(std::size_t i = 0; i != size; ++i) {
+        const float32x4_t pixel = loadPixelNeon(src, c);
+        /* Alpha is linear, kept as-is */
+        storePixelNeon(dst, vbslq_f32(alphaMaskNeon(), pixel, convert(pixel)), c);
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+template<std::size_t components> CORRADE_ENABLE_NEON void toSrgb8Neon(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    const std::integral_constant<std::size_t, components> c{};
+    for(std::size_t i = 0; i != size; ++i) {
+        const float32x4_t pixel = loadPixelNeon(src, c);
+        /* Alpha is linear, kept as-is. Then the same as packClamped(), the
+           value is positive so truncation after adding 0.5 is rounding. */
+        const float32x4_t value = vbslq_f32(alphaMaskNeon(), pixel, toSrgbNeon(pixel));
+        const float32x4_t clamped = vminq_f32(vmaxq_f32(value, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f));
+        const uint32x4_t integers = vcvtq_u32_f32(vmlaq_f32(vdupq_n_f32(0.5f), clamped, vdupq_n_f32(255.0f)));
+        const uint16x4_t shorts = vmovn_u32(integers);
+        const uint8x8_t bytes = vmovn_u16(vcombine_u16(shorts, shorts));
+        UnsignedByte out[8];
+        vst1_u8(out, bytes);
+        std::memcpy(dst, out, components);
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+CORRADE_ENABLE_NEON void premultiplyAlphaNeon(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const float32x4_t pixel = vld1q_f32(reinterpret_cast<const Float*>(src));
+        /* Multiplying alpha by itself would change it, so using 1 there */
+        const float32x4_t alpha = vbslq_f32(alphaMaskNeon(), vdupq_n_f32(1.0f), vdupq_lane_f32(vget_high_f32(pixel), 1));
+        vst1q_f32(reinterpret_cast<Float*>(dst), vmulq_f32(pixel, alpha));
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+CORRADE_ENABLE_NEON void unpremultiplyAlphaNeon(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const float32x4_t pixel = vld1q_f32(reinterpret_cast<const Float*>(src));
+        const float32x4_t alpha = vdupq_lane_f32(vget_high_f32(pixel), 1);
+        /* Zero alpha results in a zero color, alpha itself is kept */
+        const float32x4_t color = vbslq_f32(vceqq_f32(alpha, vdupq_n_f32(0.0f)), vdupq_n_f32(0.0f), vmulq_f32(pixel, reciprocalNeon(alpha)));
+        vst1q_f32(reinterpret_cast<Float*>(dst), vbslq_f32(alphaMaskNeon(), pixel, color));
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+CORRADE_ENABLE_NEON void premultiplyAlpha8Neon(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    /* Eight pixels at a time if the pixels are contiguous, otherwise
+       everything goes through the scalar variant */
+    std::size_t i = 0;
+    if(srcStride == 4 && dstStride == 4) {
+        for(; i + 8 <= size; i += 8) {
+            uint8x8x4_t pixels = vld4_u8(reinterpret_cast<const UnsignedByte*>(src));
+            for(std::size_t j = 0; j != 3; ++j) {
+                /* Same as multiplyUnorm8() */
+                const uint16x8_t t = vaddq_u16(vmull_u8(pixels.val[j], pixels.val[3]), vdupq_n_u16(128));
+                pixels.val[j] = vshrn_n_u16(vsraq_n_u16(t, t, 8), 8);
+            }
+            vst4_u8(reinterpret_cast<UnsignedByte*>(dst), pixels);
+            src += 8*srcStride;
+            dst += 8*dstStride;
+        }
+    }
+
+    /* Remaining items */
+    premultiplyAlpha8Scalar(src, srcStride, dst, dstStride, size - i);
+}
+#endif
+
+struct Kernels {
+    ConvertFunction fromSrgb3;
+    ConvertFunction fromSrgb4;
+    ConvertFunction toSrgb3;
+    ConvertFunction toSrgb4;
+    ConvertFunction toSrgb8Bit3;
+    ConvertFunction toSrgb8Bit4;
+    ConvertFunction premultiplyAlpha;
+    ConvertFunction unpremultiplyAlpha;
+    ConvertFunction premultiplyAlpha8Bit;
+};
+
+Kernels kernelsFor(const Cpu::Features features) {
+    Kernels out{
+        convertScalar<3, fromSrgbComponent>,
+        convertScalar<4, fromSrgbComponent>,
+        convertScalar<3, toSrgbComponent>,
+        convertScalar<4, toSrgbComponent>,
+        toSrgb8Scalar<3>,
+        toSrgb8Scalar<4>,
+        premultiplyAlphaScalar,
+        unpremultiplyAlphaScalar,
+        premultiplyAlpha8Scalar
+    };
+
+    #ifdef CORRADE_ENABLE_SSE2
+    if(features & Cpu::Sse2) {
+        out.fromSrgb3 = convertSse2<3, fromSrgbSse2>;
+        out.fromSrgb4 = convertSse2<4, fromSrgbSse2>;
+        out.toSrgb3 = convertSse2<3, toSrgbSse2>;
+        out.toSrgb4 = convertSse2<4, toSrgbSse2>;
+        out.toSrgb8Bit3 = toSrgb8Sse2<3>;
+        out.toSrgb8Bit4 = toSrgb8Sse2<4>;
+        out.premultiplyAlpha = premultiplyAlphaSse2;
+        out.unpremultiplyAlpha = unpremultiplyAlphaSse2;
+        out.premultiplyAlpha8Bit = premultiplyAlpha8Sse2;
+    }
+    #endif
+    #ifdef CORRADE_ENABLE_NEON
+    if(features & Cpu::Neon) {
+        out.fromSrgb3 = convertNeon<3, fromSrgbNeon>;
+        out.fromSrgb4 = convertNeon<4, fromSrgbNeon>;
+        out.toSrgb3 = convertNeon<3, toSrgbNeon>;
+        out.toSrgb4 = convertNeon<4, toSrgbNeon>;
+        out.toSrgb8Bit3 = toSrgb8Neon<3>;
+        out.toSrgb8Bit4 = toSrgb8Neon<4>;
+        out.premultiplyAlpha = premultiplyAlphaNeon;
+        out.unpremultiplyAlpha = unpremultiplyAlphaNeon;
+        out.premultiplyAlpha8Bit = premultiplyAlpha8Neon;
+    }
+    #endif
+
+    /* Silence unused variable warnings on platforms with no SIMD variant */
+    static_cast<void>(features);
+
+    return out;
+}
+
+const Kernels& kernels() {
+    /* Picked on first use, the static initialization is thread-safe */
+    static const Kernels out = kernelsFor(Cpu::runtimeFeatures());
+    return out;
+}
+
+}
+
+void fromSrgbInto(const Containers::StridedArrayView2D<const Vector3<UnsignedByte>>& src, const Containers::StridedArrayView2D<Color3<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::fromSrgbInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    convertRows(src, dst, fromSrgb8Scalar<3>);
+}
+
+void fromSrgbAlphaInto(const Containers::StridedArrayView2D<const Vector4<UnsignedByte>>& src, const Containers::StridedArrayView2D<Color4<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::fromSrgbAlphaInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    convertRows(src, dst, fromSrgb8Scalar<4>);
+}
+
+void fromSrgbInto(const Containers::StridedArrayView2D<const Vector3<Float>>& src, const Containers::StridedArrayView2D<Color3<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::fromSrgbInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    convertRows(src, dst, kernels().fromSrgb3);
+}
+
+void fromSrgbAlphaInto(const Containers::StridedArrayView2D<const Vector4<Float>>& src, const Containers::StridedArrayView2D<Color4<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::fromSrgbAlphaInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    convertRows(src, dst, kernels().fromSrgb4);
+}
+
+void toSrgbInto(const Containers::StridedArrayView2D<const Color3<Float>>& src, const Containers::StridedArrayView2D<Vector3<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::toSrgbInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    convertRows(src, dst, kernels().toSrgb3);
+}
+
+void toSrgbAlphaInto(const Containers::StridedArrayView2D<const Color4<Float>>& src, const Containers::StridedArrayView2D<Vector4<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::toSrgbAlphaInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    convertRows(src, dst, kernels().toSrgb4);
+}
+
+void toSrgbInto(const Containers::StridedArrayView2D<const Color3<Float>>& src, const Containers::StridedArrayView2D<Vector3<UnsignedByte>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::toSrgbInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    convertRows(src, dst, kernels().toSrgb8Bit3);
+}
+
+void toSrgbAlphaInto(const Containers::StridedArrayView2D<const Color4<Float>>& src, const Containers::StridedArrayView2D<Vector4<UnsignedByte>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::toSrgbAlphaInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    convertRows(src, dst, kernels().toSrgb8Bit4);
+}
+
+void premultiplyAlphaInto(const Containers::StridedArrayView2D<const Color4<Float>>& src, const Containers::StridedArrayView2D<Color4<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::premultiplyAlphaInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    convertRows(src, dst, kernels().premultiplyAlpha);
+}
+
+void premultiplyAlphaInto(const Containers::StridedArrayView2D<const Color4<UnsignedByte>>& src, const Containers::StridedArrayView2D<Color4<UnsignedByte>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::premultiplyAlphaInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    convertRows(src, dst, kernels().premultiplyAlpha8Bit);
+}
+
+void unpremultiplyAlphaInto(const Containers::StridedArrayView2D<const Color4<Float>>& src, const Containers::StridedArrayView2D<Color4<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::unpremultiplyAlphaInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    convertRows(src, dst, kernels().unpremultiplyAlpha);
+}
+
+void unpremultiplyAlphaInto(const Containers::StridedArrayView2D<const Color4<UnsignedByte>>& src, const Containers::StridedArrayView2D<Color4<UnsignedByte>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::unpremultiplyAlphaInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    convertRows(src, dst, unpremultiplyAlpha8Scalar);
+}
+
 }}
@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::Math::yFlipBc1InPlace(), @ref Magnum::Math::yFlipBc3InPlace(), @ref Magnum::Math::yFlipBc4InPlace(), @ref Magnum::Math::yFlipBc5InPlace()
+ * @brief Function @ref Magnum::Math::yFlipBc1InPlace(), @ref Magnum::Math::yFlipBc3InPlace(), @ref Magnum::Math::yFlipBc4InPlace(), @ref Magnum::Math::yFlipBc5InPlace(), @ref Magnum::Math::fromSrgbInto(), @ref Magnum::Math::fromSrgbAlphaInto(), @ref Magnum::Math::toSrgbInto(), @ref Magnum::Math::toSrgbAlphaInto(), @ref Magnum::Math::premultiplyAlphaInto(), @ref Magnum::Math::unpremultiplyAlphaInto()
  * @m_since_latest
  */
 
@@ -140,6 +140,182 @@ halves of each block.
 */
 MAGNUM_EXPORT void yFlipBc5InPlace(const Containers::StridedArrayView4D<char>& blocks);
 
+/**
+@{ @name Batch color conversion functions
+
+These functions process an unbounded range of pixels, as opposed to single
+colors. The first dimension is expected to be image rows and the second
+pixels in a row, for example a view returned from
+@ref ImageView::pixels(). Except for the 8-bit sRGB to linear conversion,
+which goes through a lookup table, and the 8-bit alpha unpremultiplication,
+which has no SIMD variant, the implementation is picked at runtime on first use
+based on instruction sets available on the CPU, with an SSE2 variant on x86 and
+a NEON variant on ARM.
+
+In the SIMD variants the sRGB curve is calculated using a polynomial
+approximation of @f$ x^y @f$, with a relative error below @f$ 10^{-6} @f$
+compared to @ref Color3::fromSrgb() and @ref Color3::toSrgb(). For an 8-bit
+output this can cause the result to differ by one in rare cases where the
+exact value lies very close to the midpoint between two integers.
+*/
+
+/**
+@brief Convert 8-bit sRGB pixels to linear RGB
+@param[in]  src     Source pixels
+@param[out] dst     Destination pixels
+@m_since_latest
+
+Equivalent to calling @ref Color3::fromSrgb(const Vector3<Integral>&) on all
+pixels. Uses a precalculated lookup table. Expects that @p src and @p dst have
+the same size.
+*/
+MAGNUM_EXPORT void fromSrgbInto(const Containers::StridedArrayView2D<const Vector3<UnsignedByte>>& src, const Containers::StridedArrayView2D<Color3<Float>>& dst);
+
+/**
+@brief Convert 8-bit sRGB + alpha pixels to linear RGBA
+@param[in]  src     Source pixels
+@param[out] dst     Destination pixels
+@m_since_latest
+
+Equivalent to calling @ref Color4::fromSrgbAlpha(const Vector4<Integral>&)
+on all pixels. Uses a precalculated lookup table for the color channels, the
+alpha channel is converted linearly. Expects that @p src and @p dst have the
+same size.
+*/
+MAGNUM_EXPORT void fromSrgbAlphaInto(const Containers::StridedArrayView2D<const Vector4<UnsignedByte>>& src, const Containers::StridedArrayView2D<Color4<Float>>& dst);
+
+/**
+@brief Convert sRGB pixels to linear RGB
+@param[in]  src     Source pixels
+@param[out] dst     Destination pixels
+@m_since_latest
+
+Equivalent to calling @ref Color3::fromSrgb(const Vector3<FloatingPointType>&)
+on all pixels. Expects that @p src and @p dst have the same size. The @p dst
+view is allowed to point to the same memory as @p src to perform the
+operation in-place, partial overlaps are not allowed.
+*/
+MAGNUM_EXPORT void fromSrgbInto(const Containers::StridedArrayView2D<const Vector3<Float>>& src, const Containers::StridedArrayView2D<Color3<Float>>& dst);
+
+/**
+@brief Convert sRGB + alpha pixels to linear RGBA
+@param[in]  src     Source pixels
+@param[out] dst     Destination pixels
+@m_since_latest
+
+Equivalent to calling @ref Color4::fromSrgbAlpha(const Vector4<FloatingPointType>&)
+on all pixels. The alpha channel is kept as-is. Expects that @p src and @p dst
+have the same size. The @p dst view is allowed to point to the same memory as
+@p src to perform the operation in-place, partial overlaps are not allowed.
+*/
+MAGNUM_EXPORT void fromSrgbAlphaInto(const Containers::StridedArrayView2D<const Vector4<Float>>& src, const Containers::StridedArrayView2D<Color4<Float>>& dst);
+
+/**
+@brief Convert linear RGB pixels to sRGB
+@param[in]  src     Source pixels
+@param[out] dst     Destination pixels
+@m_since_latest
+
+Equivalent to calling @ref Color3::toSrgb() on all pixels. Expects that
+@p src and @p dst have the same size. The @p dst view is allowed to point to
+the same memory as @p src to perform the operation in-place, partial overlaps
+are not allowed.
+*/
+MAGNUM_EXPORT void toSrgbInto(const Containers::StridedArrayView2D<const Color3<Float>>& src, const Containers::StridedArrayView2D<Vector3<Float>>& dst);
+
+/**
+@brief Convert linear RGBA pixels to sRGB + alpha
+@param[in]  src     Source pixels
+@param[out] dst     Destination pixels
+@m_since_latest
+
+Equivalent to calling @ref Color4::toSrgbAlpha() on all pixels. The alpha
+channel is kept as-is. Expects that @p src and @p dst have the same size. The
+@p dst view is allowed to point to the same memory as @p src to perform the
+operation in-place, partial overlaps are not allowed.
+*/
+MAGNUM_EXPORT void toSrgbAlphaInto(const Containers::StridedArrayView2D<const Color4<Float>>& src, const Containers::StridedArrayView2D<Vector4<Float>>& dst);
+
+/**
+@brief Convert linear RGB pixels to 8-bit sRGB
+@param[in]  src     Source pixels
+@param[out] dst     Destination pixels
+@m_since_latest
+
+Equivalent to calling @ref Color3::toSrgb() on all pixels and packing the
+result. Unlike @ref Color3::toSrgb<Integral>(), the values are clamped to the
+@f$ [0, 1] @f$ range before packing. Expects that @p src and @p dst have the
+same size.
+*/
+MAGNUM_EXPORT void toSrgbInto(const Containers::StridedArrayView2D<const Color3<Float>>& src, const Containers::StridedArrayView2D<Vector3<UnsignedByte>>& dst);
+
+/**
+@brief Convert linear RGBA pixels to 8-bit sRGB + alpha
+@param[in]  src     Source pixels
+@param[out] dst     Destination pixels
+@m_since_latest
+
+Equivalent to calling @ref Color4::toSrgbAlpha() on all pixels and packing
+the result. Unlike @ref Color4::toSrgbAlpha<Integral>(), the values are
+clamped to the @f$ [0, 1] @f$ range before packing. Expects that @p src and
+@p dst have the same size.
+*/
+MAGNUM_EXPORT void toSrgbAlphaInto(const Containers::StridedArrayView2D<const Color4<Float>>& src, const Containers::StridedArrayView2D<Vector4<UnsignedByte>>& dst);
+
+/**
+@brief Premultiply pixels with alpha
+@param[in]  src     Source pixels
+@param[out] dst     Destination pixels
+@m_since_latest
+
+Multiplies the RGB channels of each pixel with its alpha channel, the alpha
+channel is kept unchanged. Expects that @p src and @p dst have the same size.
+The @p dst view is allowed to point to the same memory as @p src to perform
+the operation in-place, partial overlaps are not allowed.
+@see @ref unpremultiplyAlphaInto()
+*/
+MAGNUM_EXPORT void premultiplyAlphaInto(const Containers::StridedArrayView2D<const Color4<Float>>& src, const Containers::StridedArrayView2D<Color4<Float>>& dst);
+
+/**
+@brief Premultiply 8-bit pixels with alpha
+@m_since_latest
+
+Same as @ref premultiplyAlphaInto(const Containers::StridedArrayView2D<const Color4<Float>>&, const Containers::StridedArrayView2D<Color4<Float>>&),
+with the result being calculated as @f$ \operatorname{round}(ca/255) @f$
+exactly, without any intermediate floating-point conversion. The SIMD
+variants are used only if the pixels in a row are contiguous.
+*/
+MAGNUM_EXPORT void premultiplyAlphaInto(const Containers::StridedArrayView2D<const Color4<UnsignedByte>>& src, const Containers::StridedArrayView2D<Color4<UnsignedByte>>& dst);
+
+/**
+@brief Unpremultiply pixels with alpha
+@param[in]  src     Source pixels
+@param[out] dst     Destination pixels
+@m_since_latest
+
+Divides the RGB channels of each pixel with its alpha channel, the alpha
+channel is kept unchanged. Pixels with a zero alpha are set to a zero color.
+Expects that @p src and @p dst have the same size. The @p dst view is allowed
+to point to the same memory as @p src to perform the operation in-place,
+partial overlaps are not allowed.
+@see @ref premultiplyAlphaInto()
+*/
+MAGNUM_EXPORT void unpremultiplyAlphaInto(const Containers::StridedArrayView2D<const Color4<Float>>& src, const Containers::StridedArrayView2D<Color4<Float>>& dst);
+
+/**
+@brief Unpremultiply 8-bit pixels with alpha
+@m_since_latest
+
+Same as @ref unpremultiplyAlphaInto(const Containers::StridedArrayView2D<const Color4<Float>>&, const Containers::StridedArrayView2D<Color4<Float>>&),
+with the result being calculated as @f$ \operatorname{min}(\operatorname{round}(255c/a), 255) @f$
+exactly, without any intermediate floating-point conversion.
+*/
+MAGNUM_EXPORT void unpremultiplyAlphaInto(const Containers::StridedArrayView2D<const Color4<UnsignedByte>>& src, const Containers::StridedArrayView2D<Color4<UnsignedByte>>& dst);
+
+/**
+ * @}
+ */
+
 }}
 
 #endif
@@ -68,7 +68,15 @@ bottom (index `2`), top (index `3`), near (index `4`) and far (index `5`).
 */
 template<class T> class Frustum {
     public:
-        /** @brief Create a frustum from a projection matrix */
+        /**
+         * @brief Create a frustum from a projection matrix
+         *
+         * Assumes the projection maps the visible volume to a
+         * @f$ [-1, 1] @f$ depth range, such as matrices created with
+         * @ref Matrix4::perspectiveProjection() or
+         * @ref Matrix4::orthographicProjection().
+         * @see @ref fromMatrixReverseZ()
+         */
         static Frustum<T> fromMatrix(const Matrix4<T>& m) {
             return {m.row(3) + m.row(0),
                     m.row(3) - m.row(0),
@@ -78,6 +86,26 @@ template<class T> class Frustum {
                     m.row(3) - m.row(2)};
         }
 
+        /**
+         * @brief Create a frustum from a reverse-Z projection matrix
+         * @m_since_latest
+         *
+         * Assumes the projection maps the near plane to a depth of @f$ 1 @f$
+         * and the far plane to a depth of @f$ 0 @f$, such as matrices created
+         * with @ref Matrix4::perspectiveProjectionReverseZ(). The side planes
+         * are the same as with @ref fromMatrix(). If the projection has an
+         * infinite far plane, the far plane equation has a zero normal and a
+         * positive distance, i.e. every point is in front of it.
+         */
+        static Frustum<T> fromMatrixReverseZ(const Matrix4<T>& m) {
+            return {m.row(3) + m.row(0),
+                    m.row(3) - m.row(0),
+                    m.row(3) + m.row(1),
+                    m.row(3) - m.row(1),
+                    m.row(3) - m.row(2),
+                    m.row(2)};
+        }
+
         /**
          * @brief Default constructor
          *
@@ -0,0 +1,459 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FunctionsBatch.h"
+
+#include <Corrade/Cpu.h>
+
+#include "Magnum/Math/Constants.h"
+
+#ifdef CORRADE_ENABLE_SSE2
+#include <Corrade/Utility/IntrinsicsSse2.h>
+#endif
+#ifdef CORRADE_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Magnum { namespace Math { namespace Implementation {
+
+namespace {
+
+/* All kernels operate on a pointer to the first item, a stride between items
+   and a component count between 1 and 4. The min / max arrays are expected to
+   contain the initial values, as described in the header. */
+typedef void(*MinmaxFunction)(const char*, std::ptrdiff_t, std::size_t, std::size_t, Float*, Float*);
+typedef UnsignedInt(*TestFunction)(const char*, std::ptrdiff_t, std::size_t, std::size_t, UnsignedInt);
+
+template<bool computeMin, bool computeMax> void minmaxScalar(const char* data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, Float* const min, Float* const max) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Float* const item = reinterpret_cast<const Float*>(data);
+        for(std::size_t c = 0; c != components; ++c) {
+            /* Same comparisons as Math::min() and Math::max(), so NaNs in the
+               input are ignored */
+            if(computeMin && item[c] < min[c]) min[c] = item[c];
+            if(computeMax && max[c] < item[c]) max[c] = item[c];
+        }
+        data += stride;
+    }
+}
+
+/* Mask is the result accumulated so far, returns once bits for all
+   components are set */
+template<bool nan> UnsignedInt testScalar(const char* data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, UnsignedInt mask) {
+    const UnsignedInt all = (1 << components) - 1;
+    for(std::size_t i = 0; i != size && mask != all; ++i) {
+        const Float* const item = reinterpret_cast<const Float*>(data);
+        for(std::size_t c = 0; c != components; ++c)
+            if(nan ? Math::isNan(item[c]) : Math::isInf(item[c]))
+                mask |= 1 << c;
+        data += stride;
+    }
+    return mask;
+}
+
+/* Contiguous data are processed as a flat array in blocks of 12 floats,
+   which is a multiple of every supported component count. Lane j of register
+   k in a block then always contains component (4*k + j) % components. */
+constexpr std::size_t BlockSize = 12;
+
+inline UnsignedInt componentMask(const UnsignedInt laneMask, const std::size_t components) {
+    UnsignedInt out = 0;
+    for(std::size_t i = 0; i != BlockSize; ++i)
+        if(laneMask & (1 << i)) out |= 1 << (i % components);
+    return out;
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+/* Loads an item, with the lanes past the component count zeroed */
+template<std::size_t components> __m128 loadItemSse2(const Float* data);
+template<> CORRADE_ENABLE_SSE2 inline __m128 loadItemSse2<1>(const Float* const data) {
+    return _mm_load_ss(data);
+}
+template<> CORRADE_ENABLE_SSE2 inline __m128 loadItemSse2<2>(const Float* const data) {
+    return _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(data)));
+}
+template<> CORRADE_ENABLE_SSE2 inline __m128 loadItemSse2<3>(const Float* const data) {
+    return _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(data))), _mm_load_ss(data + 2));
+}
+template<> CORRADE_ENABLE_SSE2 inline __m128 loadItemSse2<4>(const Float* const data) {
+    return _mm_loadu_ps(data);
+}
+
+/* The operand order matters, minps / maxps return the second operand if
+   either is NaN */
+template<bool computeMin, bool computeMax> CORRADE_ENABLE_SSE2 inline void minmaxStepSse2(const __m128 value, __m128& min, __m128& max) {
+    if(computeMin) min = _mm_min_ps(value, min);
+    if(computeMax) max = _mm_max_ps(value, max);
+}
+
+template<std::size_t components, bool computeMin, bool computeMax> CORRADE_ENABLE_SSE2 void minmaxStridedSse2(const char* data, const std::ptrdiff_t stride, const std::size_t size, Float* const min, Float* const max) {
+    Float minData[4]{}, maxData[4]{};
+    for(std::size_t c = 0; c != components; ++c) {
+        if(computeMin) minData[c] = min[c];
+        if(computeMax) maxData[c] = max[c];
+    }
+
+    __m128 minValue = _mm_loadu_ps(minData);
+    __m128 maxValue = _mm_loadu_ps(maxData);
+    for(std::size_t i = 0; i != size; ++i) {
+        minmaxStepSse2<computeMin, computeMax>(loadItemSse2<components>(reinterpret_cast<const Float*>(data)), minValue, maxValue);
+        data += stride;
+    }
+
+    _mm_storeu_ps(minData, minValue);
+    _mm_storeu_ps(maxData, maxValue);
+    for(std::size_t c = 0; c != components; ++c) {
+        if(computeMin) min[c] = minData[c];
+        if(computeMax) max[c] = maxData[c];
+    }
+}
+
+template<bool computeMin, bool computeMax> CORRADE_ENABLE_SSE2 void minmaxSse2(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, Float* const min, Float* const max) {
+    if(stride != std::ptrdiff_t(components*sizeof(Float))) switch(components) {
+        case 1: return minmaxStridedSse2<1, computeMin, computeMax>(data, stride, size, min, max);
+        case 2: return minmaxStridedSse2<2, computeMin, computeMax>(data, stride, size, min, max);
+        case 3: return minmaxStridedSse2<3, computeMin, computeMax>(data, stride, size, min, max);
+        case 4: return minmaxStridedSse2<4, computeMin, computeMax>(data, stride, size, min, max);
+    }
+
+    /* Contiguous, spread the initial values to all lanes */
+    Float minData[BlockSize]{}, maxData[BlockSize]{};
+    for(std::size_t i = 0; i != BlockSize; ++i) {
+        if(computeMin) minData[i] = min[i % components];
+        if(computeMax) maxData[i] = max[i % components];
+    }
+
+    __m128 min0 = _mm_loadu_ps(minData + 0);
+    __m128 min1 = _mm_loadu_ps(minData + 4);
+    __m128 min2 = _mm_loadu_ps(minData + 8);
+    __m128 max0 = _mm_loadu_ps(maxData + 0);
+    __m128 max1 = _mm_loadu_ps(maxData + 4);
+    __m128 max2 = _mm_loadu_ps(maxData + 8);
+
+    const Float* floats = reinterpret_cast<const Float*>(data);
+    const std::size_t count = size*components;
+    std::size_t i = 0;
+    for(; i + BlockSize <= count; i += BlockSize) {
+        minmaxStepSse2<computeMin, computeMax>(_mm_loadu_ps(floats + i + 0), min0, max0);
+        minmaxStepSse2<computeMin, computeMax>(_mm_loadu_ps(floats + i + 4), min1, max1);
+        minmaxStepSse2<computeMin, computeMax>(_mm_loadu_ps(floats + i + 8), min2, max2);
+    }
+
+    /* Reduce the lanes back to components. The lanes are NaN only if the
+       initial value was NaN, which means all items are NaN in given
+       component, so the scalar comparison is fine. */
+    _mm_storeu_ps(minData + 0, min0);
+    _mm_storeu_ps(minData + 4, min1);
+    _mm_storeu_ps(minData + 8, min2);
+    _mm_storeu_ps(maxData + 0, max0);
+    _mm_storeu_ps(maxData + 4, max1);
+    _mm_storeu_ps(maxData + 8, max2);
+    for(std::size_t j = 0; j != BlockSize; ++j) {
+        if(computeMin && minData[j] < min[j % components])
+            min[j % components] = minData[j];
+        if(computeMax && max[j % components] < maxData[j])
+            max[j % components] = maxData[j];
+    }
+
+    /* The remainder is always whole items */
+    minmaxScalar<computeMin, computeMax>(data + i*sizeof(Float), stride, (count - i)/components, components, min, max);
+}
+
+template<bool nan> CORRADE_ENABLE_SSE2 inline __m128 testValueSse2(const __m128 value) {
+    return nan ? _mm_cmpunord_ps(value, value) :
+        _mm_cmpeq_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), value), _mm_set1_ps(Constants<Float>::inf()));
+}
+
+template<std::size_t components, bool nan> CORRADE_ENABLE_SSE2 UnsignedInt testStridedSse2(const char* data, const std::ptrdiff_t stride, const std::size_t size) {
+    const int all = (1 << components) - 1;
+    __m128 mask = _mm_setzero_ps();
+    for(std::size_t i = 0; i != size; ++i) {
+        mask = _mm_or_ps(mask, testValueSse2<nan>(loadItemSse2<components>(reinterpret_cast<const Float*>(data))));
+        if((_mm_movemask_ps(mask) & all) == all) break;
+        data += stride;
+    }
+    return _mm_movemask_ps(mask) & all;
+}
+
+template<bool nan> CORRADE_ENABLE_SSE2 UnsignedInt testSse2(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, UnsignedInt) {
+    if(stride != std::ptrdiff_t(components*sizeof(Float))) switch(components) {
+        case 1: return testStridedSse2<1, nan>(data, stride, size);
+        case 2: return testStridedSse2<2, nan>(data, stride, size);
+        case 3: return testStridedSse2<3, nan>(data, stride, size);
+        case 4: return testStridedSse2<4, nan>(data, stride, size);
+    }
+
+    const UnsignedInt all = (1 << components) - 1;
+    UnsignedInt mask = 0;
+    __m128 mask0 = _mm_setzero_ps();
+    __m128 mask1 = _mm_setzero_ps();
+    __m128 mask2 = _mm_setzero_ps();
+
+    const Float* floats = reinterpret_cast<const Float*>(data);
+    const std::size_t count = size*components;
+    std::size_t i = 0;
+    for(; i + BlockSize <= count; i += BlockSize) {
+        mask0 = _mm_or_ps(mask0, testValueSse2<nan>(_mm_loadu_ps(floats + i + 0)));
+        mask1 = _mm_or_ps(mask1, testValueSse2<nan>(_mm_loadu_ps(floats + i + 4)));
+        mask2 = _mm_or_ps(mask2, testValueSse2<nan>(_mm_loadu_ps(floats + i + 8)));
+
+        /* Calculating the component mask only once anything is found */
+        if(_mm_movemask_ps(_mm_or_ps(_mm_or_ps(mask0, mask1), mask2))) {
+            mask = componentMask(_mm_movemask_ps(mask0)|(_mm_movemask_ps(mask1) << 4)|(_mm_movemask_ps(mask2) << 8), components);
+            if(mask == all) return mask;
+        }
+    }
+
+    /* The remainder is always whole items */
+    return testScalar<nan>(data + i*sizeof(Float), stride, (count - i)/components, components, mask);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_NEON
+/* Loads an item, with the lanes past the component count zeroed */
+template<std::size_t components> float32x4_t loadItemNeon(const Float* data);
+template<> CORRADE_ENABLE_NEON inline float32x4_t loadItemNeon<1>(const Float* const data) {
+    return vld1q_lane_f32(data, vdupq_n_f32(0.0f), 0);
+}
+template<> CORRADE_ENABLE_NEON inline float32x4_t loadItemNeon<2>(const Float* const data) {
+    return vcombine_f32(vld1_f32(data), vdup_n_f32(0.0f));
+}
+template<> CORRADE_ENABLE_NEON inline float32x4_t loadItemNeon<3>(const Float* const data) {
+    return vcombine_f32(vld1_f32(data), vld1_lane_f32(data + 2, vdup_n_f32(0.0f), 0));
+}
+template<> CORRADE_ENABLE_NEON inline float32x4_t loadItemNeon<4>(const Float* const data) {
+    return vld1q_f32(data);
+}
+
+/* Equivalent of _mm_movemask_ps(), without relying on AArch64-only
+   horizontal adds */
+CORRADE_ENABLE_NEON inline UnsignedInt movemaskNeon(const uint32x4_t mask) {
+    const uint32_t bitsData[4]{1, 2, 4, 8};
+    const uint32x4_t bits = vandq_u32(mask, vld1q_u32(bitsData));
+    uint32x2_t sum = vpadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+    sum = vpadd_u32(sum, sum);
+    return vget_lane_u32(sum, 0);
+}
+
+/* Not using vminq_f32() / vmaxq_f32(), as those propagate NaNs instead of
+   ignoring them */
+template<bool computeMin, bool computeMax> CORRADE_ENABLE_NEON inline void minmaxStepNeon(const float32x4_t value, float32x4_t& min, float32x4_t& max) {
+    if(computeMin) min = vbslq_f32(vcltq_f32(value, min), value, min);
+    if(computeMax) max = vbslq_f32(vcltq_f32(max, value), value, max);
+}
+
+template<std::size_t components, bool computeMin, bool computeMax> CORRADE_ENABLE_NEON void minmaxStridedNeon(const char* data, const std::ptrdiff_t stride, const std::size_t size, Float* const min, Float* const max) {
+    Float minData[4]{}, maxData[4]{};
+    for(std::size_t c = 0; c != components; ++c) {
+        if(computeMin) minData[c] = min[c];
+        if(computeMax) maxData[c] = max[c];
+    }
+
+    float32x4_t minValue = vld1q_f32(minData);
+    float32x4_t maxValue = vld1q_f32(maxData);
+    for(std::size_t i = 0; i != size; ++i) {
+        minmaxStepNeon<computeMin, computeMax>(loadItemNeon<components>(reinterpret_cast<const Float*>(data)), minValue, maxValue);
+        data += stride;
+    }
+
+    vst1q_f32(minData, minValue);
+    vst1q_f32(maxData, maxValue);
+    for(std::size_t c = 0; c != components; ++c) {
+        if(computeMin) min[c] = minData[c];
+        if(computeMax) max[c] = maxData[c];
+    }
+}
+
+template<bool computeMin, bool computeMax> CORRADE_ENABLE_NEON void minmaxNeon(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, Float* const min, Float* const max) {
+    if(stride != std::ptrdiff_t(components*sizeof(Float))) switch(components) {
+        case 1: return minmaxStridedNeon<1, computeMin, computeMax>(data, stride, size, min, max);
+        case 2: return minmaxStridedNeon<2, computeMin, computeMax>(data, stride, size, min, max);
+        case 3: return minmaxStridedNeon<3, computeMin, computeMax>(data, stride, size, min, max);
+        case 4: return minmaxStridedNeon<4, computeMin, computeMax>(data, stride, size, min, max);
+    }
+
+    /* Contiguous, spread the initial values to all lanes */
+    Float minData[BlockSize]{}, maxData[BlockSize]{};
+    for(std::size_t i = 0; i != BlockSize; ++i) {
+        if(computeMin) minData[i] = min[i % components];
+        if(computeMax) maxData[i] = max[i % components];
+    }
+
+    float32x4_t min0 = vld1q_f32(minData + 0);
+    float32x4_t min1 = vld1q_f32(minData + 4);
+    float32x4_t min2 = vld1q_f32(minData + 8);
+    float32x4_t max0 = vld1q_f32(maxData + 0);
+    float32x4_t max1 = vld1q_f32(maxData + 4);
+    float32x4_t max2 = vld1q_f32(maxData + 8);
+
+    const Float* floats = reinterpret_cast<const Float*>(data);
+    const std::size_t count = size*components;
+    std::size_t i = 0;
+    for(; i + BlockSize <= count; i += BlockSize) {
+        minmaxStepNeon<computeMin, computeMax>(vld1q_f32(floats + i + 0), min0, max0);
+        minmaxStepNeon<computeMin, computeMax>(vld1q_f32(floats + i + 4), min1, max1);
+        minmaxStepNeon<computeMin, computeMax>(vld1q_f32(floats + i + 8), min2, max2);
+    }
+
+    /* Reduce the lanes back to components, same as in the SSE2 variant */
+    vst1q_f32(minData + 0, min0);
+    vst1q_f32(minData + 4, min1);
+    vst1q_f32(minData + 8, min2);
+    vst1q_f32(maxData + 0, max0);
+    vst1q_f32(maxData + 4, max1);
+    vst1q_f32(maxData + 8, max2);
+    for(std::size_t j = 0; j != BlockSize; ++j) {
+        if(computeMin && minData[j] < min[j % components])
+            min[j % components] = minData[j];
+        if(computeMax && max[j % components] < maxData[j])
+            max[j % components] = maxData[j];
+    }
+
+    /* The remainder is always whole items */
+    minmaxScalar<computeMin, computeMax>(data + i*sizeof(Float), stride, (count - i)/components, components, min, max);
+}
+
+template<bool nan> CORRADE_ENABLE_NEON inline uint32x4_t testValueNeon(const float32x4_t value) {
+    return nan ? vmvnq_u32(vceqq_f32(value, value)) :
+        vceqq_f32(vabsq_f32(value), vdupq_n_f32(Constants<Float>::inf()));
+}
+
+template<std::size_t components, bool nan> CORRADE_ENABLE_NEON UnsignedInt testStridedNeon(const char* data, const std::ptrdiff_t stride, const std::size_t size) {
+    const UnsignedInt all = (1 << components) - 1;
+    uint32x4_t mask = vdupq_n_u32(0);
+    for(std::size_t i = 0; i != size; ++i) {
+        mask = vorrq_u32(mask, testValueNeon<nan>(loadItemNeon<components>(reinterpret_cast<const Float*>(data))));
+        if((movemaskNeon(mask) & all) == all) break;
+        data += stride;
+    }
+    return movemaskNeon(mask) & all;
+}
+
+template<bool nan> CORRADE_ENABLE_NEON UnsignedInt testNeon(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, UnsignedInt) {
+    if(stride != std::ptrdiff_t(components*sizeof(Float))) switch(components) {
+        case 1: return testStridedNeon<1, nan>(data, stride, size);
+        case 2: return testStridedNeon<2, nan>(data, stride, size);
+        case 3: return testStridedNeon<3, nan>(data, stride, size);
+        case 4: return testStridedNeon<4, nan>(data, stride, size);
+    }
+
+    const UnsignedInt all = (1 << components) - 1;
+    UnsignedInt mask = 0;
+    uint32x4_t mask0 = vdupq_n_u32(0);
+    uint32x4_t mask1 = vdupq_n_u32(0);
+    uint32x4_t mask2 = vdupq_n_u32(0);
+
+    const Float* floats = reinterpret_cast<const Float*>(data);
+    const std::size_t count = size*components;
+    std::size_t i = 0;
+    for(; i + BlockSize <= count; i += BlockSize) {
+        mask0 = vorrq_u32(mask0, testValueNeon<nan>(vld1q_f32(floats + i + 0)));
+        mask1 = vorrq_u32(mask1, testValueNeon<nan>(vld1q_f32(floats + i + 4)));
+        mask2 = vorrq_u32(mask2, testValueNeon<nan>(vld1q_f32(floats + i + 8)));
+
+        /* Calculating the component mask only once anything is found */
+        if(movemaskNeon(vorrq_u32(vorrq_u32(mask0, mask1), mask2))) {
+            mask = componentMask(movemaskNeon(mask0)|(movemaskNeon(mask1) << 4)|(movemaskNeon(mask2) << 8), components);
+            if(mask == all) return mask;
+        }
+    }
+
+    /* The remainder is always whole items */
+    return testScalar<nan>(data + i*sizeof(Float), stride, (count - i)/components, components, mask);
+}
+#endif
+
+struct Kernels {
+    MinmaxFunction min;
+    MinmaxFunction max;
+    MinmaxFunction minmax;
+    TestFunction isInf;
+    TestFunction isNan;
+};
+
+Kernels kernelsFor(const Cpu::Features features) {
+    Kernels out{
+        minmaxScalar<true, false>,
+        minmaxScalar<false, true>,
+        minmaxScalar<true, true>,
+        testScalar<false>,
+        testScalar<true>
+    };
+
+    #ifdef CORRADE_ENABLE_SSE2
+    if(features & Cpu::Sse2) {
+        out.min = minmaxSse2<true, false>;
+        out.max = minmaxSse2<false, true>;
+        out.minmax = minmaxSse2<true, true>;
+        out.isInf = testSse2<false>;
+        out.isNan = testSse2<true>;
+    }
+    #endif
+    #ifdef CORRADE_ENABLE_NEON
+    if(features & Cpu::Neon) {
+        out.min = minmaxNeon<true, false>;
+        out.max = minmaxNeon<false, true>;
+        out.minmax = minmaxNeon<true, true>;
+        out.isInf = testNeon<false>;
+        out.isNan = testNeon<true>;
+    }
+    #endif
+
+    /* Silence unused variable warnings on platforms with no SIMD variant */
+    static_cast<void>(features);
+
+    return out;
+}
+
+const Kernels& kernels() {
+    /* Picked on first use, the static initialization is thread-safe */
+    static const Kernels out = kernelsFor(Cpu::runtimeFeatures());
+    return out;
+}
+
+}
+
+UnsignedInt isInfFloat(const Containers::StridedArrayView2D<const Float>& range) {
+    return kernels().isInf(static_cast<const char*>(range.data()), range.stride()[0], range.size()[0], range.size()[1], 0);
+}
+
+UnsignedInt isNanFloat(const Containers::StridedArrayView2D<const Float>& range) {
+    return kernels().isNan(static_cast<const char*>(range.data()), range.stride()[0], range.size()[0], range.size()[1], 0);
+}
+
+void minFloat(const Containers::StridedArrayView2D<const Float>& range, Float* const min) {
+    kernels().min(static_cast<const char*>(range.data()), range.stride()[0], range.size()[0], range.size()[1], min, nullptr);
+}
+
+void maxFloat(const Containers::StridedArrayView2D<const Float>& range, Float* const max) {
+    kernels().max(static_cast<const char*>(range.data()), range.stride()[0], range.size()[0], range.size()[1], nullptr, max);
+}
+
+void minmaxFloat(const Containers::StridedArrayView2D<const Float>& range, Float* const min, Float* const max) {
+    kernels().minmax(static_cast<const char*>(range.data()), range.stride()[0], range.size()[0], range.size()[1], min, max);
+}
+
+}}}
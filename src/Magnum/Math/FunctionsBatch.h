@@ -37,6 +37,7 @@
 #include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/Math/Functions.h"
+#include "Magnum/visibility.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 /* Some APIs returned std::pair before */
@@ -53,15 +54,78 @@ template<class T, class View = decltype(Containers::Implementation::ErasedArrayV
 template<class T> static typename std::remove_const<T>::type stridedArrayViewTypeFor(const Containers::ArrayView<T>&);
 template<class T> static typename std::remove_const<T>::type stridedArrayViewTypeFor(const Containers::StridedArrayView1D<T>&);
 
+/* Floats and float vectors of up to four components are delegated to
+   SIMD-optimized implementations in FunctionsBatch.cpp. Gives back the
+   component count, or 0 for types that go through the generic code. */
+std::integral_constant<std::size_t, 1> batchFloatComponents(const Float*);
+template<std::size_t size> std::integral_constant<std::size_t, (size <= 4 ? size : 0)> batchFloatComponents(const Vector<size, Float>*);
+std::integral_constant<std::size_t, 0> batchFloatComponents(const void*);
+template<class T> using BatchFloatComponents = decltype(batchFloatComponents(static_cast<const T*>(nullptr)));
+
+/* These return a mask with bit i set if component i is infinite / NaN in
+   any item */
+MAGNUM_EXPORT UnsignedInt isInfFloat(const Containers::StridedArrayView2D<const Float>& range);
+MAGNUM_EXPORT UnsignedInt isNanFloat(const Containers::StridedArrayView2D<const Float>& range);
+/* These expect min / max to be filled with the initial value, which should
+   be NaN only in components that are NaN in all items */
+MAGNUM_EXPORT void minFloat(const Containers::StridedArrayView2D<const Float>& range, Float* min);
+MAGNUM_EXPORT void maxFloat(const Containers::StridedArrayView2D<const Float>& range, Float* max);
+MAGNUM_EXPORT void minmaxFloat(const Containers::StridedArrayView2D<const Float>& range, Float* min, Float* max);
+
+inline bool batchMaskResult(const UnsignedInt mask, bool*) {
+    return mask;
+}
+template<std::size_t size> inline BitVector<size> batchMaskResult(const UnsignedInt mask, BitVector<size>*) {
+    return BitVector<size>{UnsignedByte(mask)};
+}
+
 }
 
 /**
 @{ @name Batch functions
 
 These functions process an ubounded range of values, as opposed to single
-vectors or scalars.
+vectors or scalars. For @relativeref{Magnum,Float} and float vectors of up to
+four components, the implementation is picked at runtime on first use based on
+instruction sets available on the CPU, with a SSE2 variant on x86 and a NEON
+variant on ARM. Contiguous ranges are processed several items at a time
+regardless of the component count. The results are the same as with the
+generic implementation used for other types, except for the sign of zero
+when both @cpp -0.0f @ce and @cpp 0.0f @ce compare as the minimum or maximum.
 */
 
+namespace Implementation {
+    template<class T> auto isInfImplementation(const Containers::StridedArrayView1D<const T>& range, std::integral_constant<std::size_t, 0>) -> decltype(isInf(std::declval<T>())) {
+        /* For scalars, this loop exits once any value is infinity. For
+           vectors the loop accumulates the bits and exits as soon as all bits
+           are set or the input is exhausted */
+        auto out = isInf(range[0]); /* bool or BitVector */
+        for(std::size_t i = 1; i != range.size(); ++i) {
+            if(out) break;
+            out = out || isInf(range[i]);
+        }
+
+        return out;
+    }
+    template<class T, std::size_t size> inline auto isInfImplementation(const Containers::StridedArrayView1D<const T>& range, std::integral_constant<std::size_t, size>) -> decltype(isInf(std::declval<T>())) {
+        return batchMaskResult(isInfFloat(Containers::arrayCast<2, const Float>(range)), static_cast<decltype(isInf(std::declval<T>()))*>(nullptr));
+    }
+
+    template<class T> auto isNanImplementation(const Containers::StridedArrayView1D<const T>& range, std::integral_constant<std::size_t, 0>) -> decltype(isNan(std::declval<T>())) {
+        /* Same as in isInfImplementation() above */
+        auto out = isNan(range[0]); /* bool or BitVector */
+        for(std::size_t i = 1; i != range.size(); ++i) {
+            if(out) break;
+            out = out || isNan(range[i]);
+        }
+
+        return out;
+    }
+    template<class T, std::size_t size> inline auto isNanImplementation(const Containers::StridedArrayView1D<const T>& range, std::integral_constant<std::size_t, size>) -> decltype(isNan(std::declval<T>())) {
+        return batchMaskResult(isNanFloat(Containers::arrayCast<2, const Float>(range)), static_cast<decltype(isNan(std::declval<T>()))*>(nullptr));
+    }
+}
+
 /**
 @brief If any number in the range is a positive or negative infinity
 
@@ -74,16 +138,7 @@ empty, returns @cpp false @ce or a @ref BitVector with no bits set.
 template<class T> auto isInf(const Containers::StridedArrayView1D<const T>& range) -> decltype(isInf(std::declval<T>())) {
     if(range.isEmpty()) return {};
 
-    /* For scalars, this loop exits once any value is infinity. For vectors
-       the loop accumulates the bits and exits as soon as all bits are set
-       or the input is exhausted */
-    auto out = isInf(range[0]); /* bool or BitVector */
-    for(std::size_t i = 1; i != range.size(); ++i) {
-        if(out) break;
-        out = out || isInf(range[i]);
-    }
-
-    return out;
+    return Implementation::isInfImplementation(range, Implementation::BatchFloatComponents<T>{});
 }
 
 /**
@@ -126,16 +181,7 @@ returns @cpp false @ce or a @ref BitVector with no bits set.
 template<class T> inline auto isNan(const Containers::StridedArrayView1D<const T>& range) -> decltype(isNan(std::declval<T>())) {
     if(range.isEmpty()) return {};
 
-    /* For scalars, this loop exits once any value is infinity. For vectors
-       the loop accumulates the bits and exits as soon as all bits are set
-       or the input is exhausted */
-    auto out = isNan(range[0]); /* bool or BitVector */
-    for(std::size_t i = 1; i != range.size(); ++i) {
-        if(out) break;
-        out = out || isNan(range[i]);
-    }
-
-    return out;
+    return Implementation::isNanImplementation(range, Implementation::BatchFloatComponents<T>{});
 }
 
 /**
@@ -199,6 +245,28 @@ namespace Implementation {
         }
         return {firstValid, out};
     }
+
+    template<class T> inline T minImplementation(const Containers::StridedArrayView1D<const T>& range, Containers::Pair<std::size_t, T> iOut, std::integral_constant<std::size_t, 0>) {
+        for(++iOut.first(); iOut.first() != range.size(); ++iOut.first())
+            iOut.second() = Math::min(iOut.second(), range[iOut.first()]);
+        return iOut.second();
+    }
+    template<class T, std::size_t size> inline T minImplementation(const Containers::StridedArrayView1D<const T>& range, const Containers::Pair<std::size_t, T>& iOut, std::integral_constant<std::size_t, size>) {
+        T out = iOut.second();
+        minFloat(Containers::arrayCast<2, const Float>(range.exceptPrefix(iOut.first() + 1)), reinterpret_cast<Float*>(&out));
+        return out;
+    }
+
+    template<class T> inline T maxImplementation(const Containers::StridedArrayView1D<const T>& range, Containers::Pair<std::size_t, T> iOut, std::integral_constant<std::size_t, 0>) {
+        for(++iOut.first(); iOut.first() != range.size(); ++iOut.first())
+            iOut.second() = Math::max(iOut.second(), range[iOut.first()]);
+        return iOut.second();
+    }
+    template<class T, std::size_t size> inline T maxImplementation(const Containers::StridedArrayView1D<const T>& range, const Containers::Pair<std::size_t, T>& iOut, std::integral_constant<std::size_t, size>) {
+        T out = iOut.second();
+        maxFloat(Containers::arrayCast<2, const Float>(range.exceptPrefix(iOut.first() + 1)), reinterpret_cast<Float*>(&out));
+        return out;
+    }
 }
 
 /**
@@ -211,11 +279,7 @@ ignored, unless the range is all <em>NaN</em>s.
 template<class T> inline T min(const Containers::StridedArrayView1D<const T>& range) {
     if(range.isEmpty()) return {};
 
-    Containers::Pair<std::size_t, T> iOut = Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
-    for(++iOut.first(); iOut.first() != range.size(); ++iOut.first())
-        iOut.second() = Math::min(iOut.second(), range[iOut.first()]);
-
-    return iOut.second();
+    return Implementation::minImplementation(range, Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{}), Implementation::BatchFloatComponents<T>{});
 }
 
 /**
@@ -256,11 +320,7 @@ ignored, unless the range is all <em>NaN</em>s.
 template<class T> inline T max(const Containers::StridedArrayView1D<const T>& range) {
     if(range.isEmpty()) return {};
 
-    Containers::Pair<std::size_t, T> iOut = Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
-    for(++iOut.first(); iOut.first() != range.size(); ++iOut.first())
-        iOut.second() = Math::max(iOut.second(), range[iOut.first()]);
-
-    return iOut.second();
+    return Implementation::maxImplementation(range, Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{}), Implementation::BatchFloatComponents<T>{});
 }
 
 /**
@@ -302,6 +362,18 @@ namespace Implementation {
         for(std::size_t i = 0; i != size; ++i)
             minmax(min[i], max[i], value[i]);
     }
+
+    template<class T> inline Containers::Pair<T, T> minmaxImplementation(const Containers::StridedArrayView1D<const T>& range, Containers::Pair<std::size_t, T> iOut, std::integral_constant<std::size_t, 0>) {
+        T min{iOut.second()}, max{iOut.second()};
+        for(++iOut.first(); iOut.first() != range.size(); ++iOut.first())
+            minmax(min, max, range[iOut.first()]);
+        return {min, max};
+    }
+    template<class T, std::size_t size> inline Containers::Pair<T, T> minmaxImplementation(const Containers::StridedArrayView1D<const T>& range, const Containers::Pair<std::size_t, T>& iOut, std::integral_constant<std::size_t, size>) {
+        T min{iOut.second()}, max{iOut.second()};
+        minmaxFloat(Containers::arrayCast<2, const Float>(range.exceptPrefix(iOut.first() + 1)), reinterpret_cast<Float*>(&min), reinterpret_cast<Float*>(&max));
+        return {min, max};
+    }
 }
 
 /**
@@ -316,12 +388,7 @@ ignored, unless the range is all <em>NaN</em>s.
 template<class T> inline Containers::Pair<T, T> minmax(const Containers::StridedArrayView1D<const T>& range) {
     if(range.isEmpty()) return {};
 
-    Containers::Pair<std::size_t, T> iOut = Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
-    T min{iOut.second()}, max{iOut.second()};
-    for(++iOut.first(); iOut.first() != range.size(); ++iOut.first())
-        Implementation::minmax(min, max, range[iOut.first()]);
-
-    return {min, max};
+    return Implementation::minmaxImplementation(range, Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{}), Implementation::BatchFloatComponents<T>{});
 }
 
 /**
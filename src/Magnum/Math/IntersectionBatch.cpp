@@ -0,0 +1,509 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "IntersectionBatch.h"
+
+#include <Corrade/Cpu.h>
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Intersection.h"
+
+#ifdef CORRADE_ENABLE_SSE2
+#include <Corrade/Utility/IntrinsicsSse2.h>
+#endif
+#ifdef CORRADE_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Magnum { namespace Math { namespace Intersection {
+
+namespace {
+
+/* All kernels operate on type-erased pointers and strides so the same
+   signature can be shared by all variants. The frustum is passed as 24
+   consecutive floats, six planes with the normal in the first three
+   components, the cone as origin, normal, sine and the tangent term, eight
+   floats in total. */
+typedef void(*RangeFrustumFunction)(const Float*, const char*, std::ptrdiff_t, const Containers::MutableBitArrayView&);
+typedef void(*VolumeFrustumFunction)(const Float*, const char*, std::ptrdiff_t, const char*, std::ptrdiff_t, const Containers::MutableBitArrayView&);
+typedef VolumeFrustumFunction SphereConeFunction;
+
+inline void setBit(const Containers::MutableBitArrayView& out, const std::size_t i, const bool value) {
+    if(value) out.set(i);
+    else out.reset(i);
+}
+
+/* Writes four consecutive results, the mask has a bit set for each volume
+   that was culled */
+inline void setBits4(const Containers::MutableBitArrayView& out, const std::size_t i, const unsigned culledMask) {
+    for(std::size_t j = 0; j != 4; ++j)
+        setBit(out, i + j, !(culledMask & (1 << j)));
+}
+
+void rangeFrustumScalar(const Float* const frustum, const char* ranges, const std::ptrdiff_t rangeStride, const Containers::MutableBitArrayView& out) {
+    const Frustum<Float>& f = *reinterpret_cast<const Frustum<Float>*>(frustum);
+    for(std::size_t i = 0, size = out.size(); i != size; ++i) {
+        setBit(out, i, rangeFrustum(*reinterpret_cast<const Range3D<Float>*>(ranges), f));
+        ranges += rangeStride;
+    }
+}
+
+void aabbFrustumScalar(const Float* const frustum, const char* centers, const std::ptrdiff_t centerStride, const char* extents, const std::ptrdiff_t extentStride, const Containers::MutableBitArrayView& out) {
+    const Frustum<Float>& f = *reinterpret_cast<const Frustum<Float>*>(frustum);
+    for(std::size_t i = 0, size = out.size(); i != size; ++i) {
+        setBit(out, i, aabbFrustum(*reinterpret_cast<const Vector3<Float>*>(centers), *reinterpret_cast<const Vector3<Float>*>(extents), f));
+        centers += centerStride;
+        extents += extentStride;
+    }
+}
+
+void sphereFrustumScalar(const Float* const frustum, const char* centers, const std::ptrdiff_t centerStride, const char* radii, const std::ptrdiff_t radiusStride, const Containers::MutableBitArrayView& out) {
+    const Frustum<Float>& f = *reinterpret_cast<const Frustum<Float>*>(frustum);
+    for(std::size_t i = 0, size = out.size(); i != size; ++i) {
+        setBit(out, i, sphereFrustum(*reinterpret_cast<const Vector3<Float>*>(centers), *reinterpret_cast<const Float*>(radii), f));
+        centers += centerStride;
+        radii += radiusStride;
+    }
+}
+
+void sphereConeScalar(const Float* const cone, const char* centers, const std::ptrdiff_t centerStride, const char* radii, const std::ptrdiff_t radiusStride, const Containers::MutableBitArrayView& out) {
+    const Vector3<Float>& origin = Vector3<Float>::from(cone);
+    const Vector3<Float>& normal = Vector3<Float>::from(cone + 3);
+    for(std::size_t i = 0, size = out.size(); i != size; ++i) {
+        setBit(out, i, sphereCone(*reinterpret_cast<const Vector3<Float>*>(centers), *reinterpret_cast<const Float*>(radii), origin, normal, cone[6], cone[7]));
+        centers += centerStride;
+        radii += radiusStride;
+    }
+}
+
+/* The SIMD variants process four volumes at a time, with the X, Y and Z
+   components of four volumes gathered into separate registers, and fall back
+   to the scalar code for the remainder. The operations are done in the same
+   order as in the scalar code so the results are bit-exact. */
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_ENABLE_SSE2 inline void loadVector3Sse2(const char* const data, const std::ptrdiff_t stride, __m128& x, __m128& y, __m128& z) {
+    const Float* const a = reinterpret_cast<const Float*>(data);
+    const Float* const b = reinterpret_cast<const Float*>(data + stride);
+    const Float* const c = reinterpret_cast<const Float*>(data + 2*stride);
+    const Float* const d = reinterpret_cast<const Float*>(data + 3*stride);
+    x = _mm_setr_ps(a[0], b[0], c[0], d[0]);
+    y = _mm_setr_ps(a[1], b[1], c[1], d[1]);
+    z = _mm_setr_ps(a[2], b[2], c[2], d[2]);
+}
+
+CORRADE_ENABLE_SSE2 inline __m128 loadFloatSse2(const char* const data, const std::ptrdiff_t stride) {
+    return _mm_setr_ps(
+        *reinterpret_cast<const Float*>(data),
+        *reinterpret_cast<const Float*>(data + stride),
+        *reinterpret_cast<const Float*>(data + 2*stride),
+        *reinterpret_cast<const Float*>(data + 3*stride));
+}
+
+CORRADE_ENABLE_SSE2 inline __m128 absSse2(const __m128 a) {
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+}
+
+/* Culled mask of four boxes against all frustum planes, with the plane
+   distance multiplied by wScale */
+CORRADE_ENABLE_SSE2 inline unsigned boxFrustumSse2(const Float* const frustum, const Float wScale, const __m128 cx, const __m128 cy, const __m128 cz, const __m128 ex, const __m128 ey, const __m128 ez) {
+    __m128 culled = _mm_setzero_ps();
+    for(std::size_t p = 0; p != 6; ++p) {
+        const Float* const plane = frustum + p*4;
+        const __m128 nx = _mm_set1_ps(plane[0]);
+        const __m128 ny = _mm_set1_ps(plane[1]);
+        const __m128 nz = _mm_set1_ps(plane[2]);
+        const __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, nx), _mm_mul_ps(cy, ny)), _mm_mul_ps(cz, nz));
+        const __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ex, absSse2(nx)), _mm_mul_ps(ey, absSse2(ny))), _mm_mul_ps(ez, absSse2(nz)));
+        culled = _mm_or_ps(culled, _mm_cmplt_ps(_mm_add_ps(d, r), _mm_set1_ps(wScale*plane[3])));
+    }
+    return _mm_movemask_ps(culled);
+}
+
+CORRADE_ENABLE_SSE2 void rangeFrustumSse2(const Float* const frustum, const char* ranges, const std::ptrdiff_t rangeStride, const Containers::MutableBitArrayView& out) {
+    const std::size_t size = out.size();
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        __m128 minX, minY, minZ, maxX, maxY, maxZ;
+        loadVector3Sse2(ranges, rangeStride, minX, minY, minZ);
+        loadVector3Sse2(ranges + sizeof(Vector3<Float>), rangeStride, maxX, maxY, maxZ);
+        setBits4(out, i, boxFrustumSse2(frustum, -2.0f,
+            _mm_add_ps(minX, maxX), _mm_add_ps(minY, maxY), _mm_add_ps(minZ, maxZ),
+            _mm_sub_ps(maxX, minX), _mm_sub_ps(maxY, minY), _mm_sub_ps(maxZ, minZ)));
+        ranges += 4*rangeStride;
+    }
+
+    rangeFrustumScalar(frustum, ranges, rangeStride, out.exceptPrefix(i));
+}
+
+CORRADE_ENABLE_SSE2 void aabbFrustumSse2(const Float* const frustum, const char* centers, const std::ptrdiff_t centerStride, const char* extents, const std::ptrdiff_t extentStride, const Containers::MutableBitArrayView& out) {
+    const std::size_t size = out.size();
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        __m128 cx, cy, cz, ex, ey, ez;
+        loadVector3Sse2(centers, centerStride, cx, cy, cz);
+        loadVector3Sse2(extents, extentStride, ex, ey, ez);
+        setBits4(out, i, boxFrustumSse2(frustum, -1.0f, cx, cy, cz, ex, ey, ez));
+        centers += 4*centerStride;
+        extents += 4*extentStride;
+    }
+
+    aabbFrustumScalar(frustum, centers, centerStride, extents, extentStride, out.exceptPrefix(i));
+}
+
+CORRADE_ENABLE_SSE2 void sphereFrustumSse2(const Float* const frustum, const char* centers, const std::ptrdiff_t centerStride, const char* radii, const std::ptrdiff_t radiusStride, const Containers::MutableBitArrayView& out) {
+    const std::size_t size = out.size();
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        __m128 cx, cy, cz;
+        loadVector3Sse2(centers, centerStride, cx, cy, cz);
+        const __m128 r = loadFloatSse2(radii, radiusStride);
+        const __m128 negativeRadiusSq = _mm_xor_ps(_mm_mul_ps(r, r), _mm_set1_ps(-0.0f));
+
+        __m128 culled = _mm_setzero_ps();
+        for(std::size_t p = 0; p != 6; ++p) {
+            const Float* const plane = frustum + p*4;
+            const __m128 d = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane[0]), cx), _mm_mul_ps(_mm_set1_ps(plane[1]), cy)), _mm_mul_ps(_mm_set1_ps(plane[2]), cz)), _mm_set1_ps(plane[3]));
+            culled = _mm_or_ps(culled, _mm_cmplt_ps(d, negativeRadiusSq));
+        }
+
+        setBits4(out, i, _mm_movemask_ps(culled));
+        centers += 4*centerStride;
+        radii += 4*radiusStride;
+    }
+
+    sphereFrustumScalar(frustum, centers, centerStride, radii, radiusStride, out.exceptPrefix(i));
+}
+
+CORRADE_ENABLE_SSE2 void sphereConeSse2(const Float* const cone, const char* centers, const std::ptrdiff_t centerStride, const char* radii, const std::ptrdiff_t radiusStride, const Containers::MutableBitArrayView& out) {
+    const __m128 ox = _mm_set1_ps(cone[0]);
+    const __m128 oy = _mm_set1_ps(cone[1]);
+    const __m128 oz = _mm_set1_ps(cone[2]);
+    const __m128 nx = _mm_set1_ps(cone[3]);
+    const __m128 ny = _mm_set1_ps(cone[4]);
+    const __m128 nz = _mm_set1_ps(cone[5]);
+    const __m128 sinAngle = _mm_set1_ps(cone[6]);
+    const __m128 tanAngleSqPlusOne = _mm_set1_ps(cone[7]);
+
+    const std::size_t size = out.size();
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        __m128 cx, cy, cz;
+        loadVector3Sse2(centers, centerStride, cx, cy, cz);
+        const __m128 r = loadFloatSse2(radii, radiusStride);
+
+        const __m128 dx = _mm_sub_ps(cx, ox);
+        const __m128 dy = _mm_sub_ps(cy, oy);
+        const __m128 dz = _mm_sub_ps(cz, oz);
+
+        /* Point - cone test, selected for spheres in front of the offset
+           plane */
+        const __m128 rSinAngle = _mm_mul_ps(r, sinAngle);
+        const __m128 front = _mm_cmpgt_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(_mm_sub_ps(dx, _mm_mul_ps(rSinAngle, nx)), nx),
+            _mm_mul_ps(_mm_sub_ps(dy, _mm_mul_ps(rSinAngle, ny)), ny)),
+            _mm_mul_ps(_mm_sub_ps(dz, _mm_mul_ps(rSinAngle, nz)), nz)),
+            _mm_setzero_ps());
+        const __m128 px = _mm_add_ps(_mm_mul_ps(sinAngle, dx), _mm_mul_ps(nx, r));
+        const __m128 py = _mm_add_ps(_mm_mul_ps(sinAngle, dy), _mm_mul_ps(ny, r));
+        const __m128 pz = _mm_add_ps(_mm_mul_ps(sinAngle, dz), _mm_mul_ps(nz, r));
+        const __m128 lenA = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, nx), _mm_mul_ps(py, ny)), _mm_mul_ps(pz, nz));
+        const __m128 pointCone = _mm_cmple_ps(
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, px), _mm_mul_ps(py, py)), _mm_mul_ps(pz, pz)),
+            _mm_mul_ps(_mm_mul_ps(lenA, lenA), tanAngleSqPlusOne));
+
+        /* Simple sphere point check otherwise */
+        const __m128 spherePoint = _mm_cmple_ps(
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)),
+            _mm_mul_ps(r, r));
+
+        const __m128 intersects = _mm_or_ps(_mm_and_ps(front, pointCone), _mm_andnot_ps(front, spherePoint));
+        setBits4(out, i, ~_mm_movemask_ps(intersects) & 0xf);
+        centers += 4*centerStride;
+        radii += 4*radiusStride;
+    }
+
+    sphereConeScalar(cone, centers, centerStride, radii, radiusStride, out.exceptPrefix(i));
+}
+#endif
+
+#ifdef CORRADE_ENABLE_NEON
+CORRADE_ENABLE_NEON inline float32x4_t gatherNeon(const Float a, const Float b, const Float c, const Float d) {
+    const Float data[4]{a, b, c, d};
+    return vld1q_f32(data);
+}
+
+CORRADE_ENABLE_NEON inline void loadVector3Neon(const char* const data, const std::ptrdiff_t stride, float32x4_t& x, float32x4_t& y, float32x4_t& z) {
+    const Float* const a = reinterpret_cast<const Float*>(data);
+    const Float* const b = reinterpret_cast<const Float*>(data + stride);
+    const Float* const c = reinterpret_cast<const Float*>(data + 2*stride);
+    const Float* const d = reinterpret_cast<const Float*>(data + 3*stride);
+    x = gatherNeon(a[0], b[0], c[0], d[0]);
+    y = gatherNeon(a[1], b[1], c[1], d[1]);
+    z = gatherNeon(a[2], b[2], c[2], d[2]);
+}
+
+CORRADE_ENABLE_NEON inline float32x4_t loadFloatNeon(const char* const data, const std::ptrdiff_t stride) {
+    return gatherNeon(
+        *reinterpret_cast<const Float*>(data),
+        *reinterpret_cast<const Float*>(data + stride),
+        *reinterpret_cast<const Float*>(data + 2*stride),
+        *reinterpret_cast<const Float*>(data + 3*stride));
+}
+
+/* Equivalent of _mm_movemask_ps(), without relying on AArch64-only
+   horizontal adds */
+CORRADE_ENABLE_NEON inline unsigned movemaskNeon(const uint32x4_t mask) {
+    const uint32_t bitsData[4]{1, 2, 4, 8};
+    const uint32x4_t bits = vandq_u32(mask, vld1q_u32(bitsData));
+    uint32x2_t sum = vpadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+    sum = vpadd_u32(sum, sum);
+    return vget_lane_u32(sum, 0);
+}
+
+/* Explicit multiplies and adds instead of vmlaq_f32(), which may get fused
+   and thus give different results than the scalar code */
+CORRADE_ENABLE_NEON inline float32x4_t dotNeon(const float32x4_t ax, const float32x4_t ay, const float32x4_t az, const float32x4_t bx, const float32x4_t by, const float32x4_t bz) {
+    return vaddq_f32(vaddq_f32(vmulq_f32(ax, bx), vmulq_f32(ay, by)), vmulq_f32(az, bz));
+}
+
+CORRADE_ENABLE_NEON inline unsigned boxFrustumNeon(const Float* const frustum, const Float wScale, const float32x4_t cx, const float32x4_t cy, const float32x4_t cz, const float32x4_t ex, const float32x4_t ey, const float32x4_t ez) {
+    uint32x4_t culled = vdupq_n_u32(0);
+    for(std::size_t p = 0; p != 6; ++p) {
+        const Float* const plane = frustum + p*4;
+        const float32x4_t nx = vdupq_n_f32(plane[0]);
+        const float32x4_t ny = vdupq_n_f32(plane[1]);
+        const float32x4_t nz = vdupq_n_f32(plane[2]);
+        const float32x4_t d = dotNeon(cx, cy, cz, nx, ny, nz);
+        const float32x4_t r = dotNeon(ex, ey, ez, vabsq_f32(nx), vabsq_f32(ny), vabsq_f32(nz));
+        culled = vorrq_u32(culled, vcltq_f32(vaddq_f32(d, r), vdupq_n_f32(wScale*plane[3])));
+    }
+    return movemaskNeon(culled);
+}
+
+CORRADE_ENABLE_NEON void rangeFrustumNeon(const Float* const frustum, const char* ranges, const std::ptrdiff_t rangeStride, const Containers::MutableBitArrayView& out) {
+    const std::size_t size = out.size();
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        float32x4_t minX, minY, minZ, maxX, maxY, maxZ;
+        loadVector3Neon(ranges, rangeStride, minX, minY, minZ);
+        loadVector3Neon(ranges + sizeof(Vector3<Float>), rangeStride, maxX, maxY, maxZ);
+        setBits4(out, i, boxFrustumNeon(frustum, -2.0f,
+            vaddq_f32(minX, maxX), vaddq_f32(minY, maxY), vaddq_f32(minZ, maxZ),
+            vsubq_f32(maxX, minX), vsubq_f32(maxY, minY), vsubq_f32(maxZ, minZ)));
+        ranges += 4*rangeStride;
+    }
+
+    rangeFrustumScalar(frustum, ranges, rangeStride, out.exceptPrefix(i));
+}
+
+CORRADE_ENABLE_NEON void aabbFrustumNeon(const Float* const frustum, const char* centers, const std::ptrdiff_t centerStride, const char* extents, const std::ptrdiff_t extentStride, const Containers::MutableBitArrayView& out) {
+    const std::size_t size = out.size();
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        float32x4_t cx, cy, cz, ex, ey, ez;
+        loadVector3Neon(centers, centerStride, cx, cy, cz);
+        loadVector3Neon(extents, extentStride, ex, ey, ez);
+        setBits4(out, i, boxFrustumNeon(frustum, -1.0f, cx, cy, cz, ex, ey, ez));
+        centers += 4*centerStride;
+        extents += 4*extentStride;
+    }
+
+    aabbFrustumScalar(frustum, centers, centerStride, extents, extentStride, out.exceptPrefix(i));
+}
+
+CORRADE_ENABLE_NEON void sphereFrustumNeon(const Float* const frustum, const char* centers, const std::ptrdiff_t centerStride, const char* radii, const std::ptrdiff_t radiusStride, const Containers::MutableBitArrayView& out) {
+    const std::size_t size = out.size();
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        float32x4_t cx, cy, cz;
+        loadVector3Neon(centers, centerStride, cx, cy, cz);
+        const float32x4_t r = loadFloatNeon(radii, radiusStride);
+        const float32x4_t negativeRadiusSq = vnegq_f32(vmulq_f32(r, r));
+
+        uint32x4_t culled = vdupq_n_u32(0);
+        for(std::size_t p = 0; p != 6; ++p) {
+            const Float* const plane = frustum + p*4;
+            const float32x4_t d = vaddq_f32(dotNeon(vdupq_n_f32(plane[0]), vdupq_n_f32(plane[1]), vdupq_n_f32(plane[2]), cx, cy, cz), vdupq_n_f32(plane[3]));
+            culled = vorrq_u32(culled, vcltq_f32(d, negativeRadiusSq));
+        }
+
+        setBits4(out, i, movemaskNeon(culled));
+        centers += 4*centerStride;
+        radii += 4*radiusStride;
+    }
+
+    sphereFrustumScalar(frustum, centers, centerStride, radii, radiusStride, out.exceptPrefix(i));
+}
+
+CORRADE_ENABLE_NEON void sphereConeNeon(const Float* const cone, const char* centers, const std::ptrdiff_t centerStride, const char* radii, const std::ptrdiff_t radiusStride, const Containers::MutableBitArrayView& out) {
+    const float32x4_t ox = vdupq_n_f32(cone[0]);
+    const float32x4_t oy = vdupq_n_f32(cone[1]);
+    const float32x4_t oz = vdupq_n_f32(cone[2]);
+    const float32x4_t nx = vdupq_n_f32(cone[3]);
+    const float32x4_t ny = vdupq_n_f32(cone[4]);
+    const float32x4_t nz = vdupq_n_f32(cone[5]);
+    const float32x4_t sinAngle = vdupq_n_f32(cone[6]);
+    const float32x4_t tanAngleSqPlusOne = vdupq_n_f32(cone[7]);
+
+    const std::size_t size = out.size();
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        float32x4_t cx, cy, cz;
+        loadVector3Neon(centers, centerStride, cx, cy, cz);
+        const float32x4_t r = loadFloatNeon(radii, radiusStride);
+
+        const float32x4_t dx = vsubq_f32(cx, ox);
+        const float32x4_t dy = vsubq_f32(cy, oy);
+        const float32x4_t dz = vsubq_f32(cz, oz);
+
+        /* Point - cone test, selected for spheres in front of the offset
+           plane */
+        const float32x4_t rSinAngle = vmulq_f32(r, sinAngle);
+        const uint32x4_t front = vcgtq_f32(dotNeon(
+            vsubq_f32(dx, vmulq_f32(rSinAngle, nx)),
+            vsubq_f32(dy, vmulq_f32(rSinAngle, ny)),
+            vsubq_f32(dz, vmulq_f32(rSinAngle, nz)), nx, ny, nz),
+            vdupq_n_f32(0.0f));
+        const float32x4_t px = vaddq_f32(vmulq_f32(sinAngle, dx), vmulq_f32(nx, r));
+        const float32x4_t py = vaddq_f32(vmulq_f32(sinAngle, dy), vmulq_f32(ny, r));
+        const float32x4_t pz = vaddq_f32(vmulq_f32(sinAngle, dz), vmulq_f32(nz, r));
+        const float32x4_t lenA = dotNeon(px, py, pz, nx, ny, nz);
+        const uint32x4_t pointCone = vcleq_f32(
+            dotNeon(px, py, pz, px, py, pz),
+            vmulq_f32(vmulq_f32(lenA, lenA), tanAngleSqPlusOne));
+
+        /* Simple sphere point check otherwise */
+        const uint32x4_t spherePoint = vcleq_f32(
+            dotNeon(dx, dy, dz, dx, dy, dz), vmulq_f32(r, r));
+
+        const uint32x4_t intersects = vbslq_u32(front, pointCone, spherePoint);
+        setBits4(out, i, ~movemaskNeon(intersects) & 0xf);
+        centers += 4*centerStride;
+        radii += 4*radiusStride;
+    }
+
+    sphereConeScalar(cone, centers, centerStride, radii, radiusStride, out.exceptPrefix(i));
+}
+#endif
+
+struct Kernels {
+    RangeFrustumFunction rangeFrustum;
+    VolumeFrustumFunction aabbFrustum;
+    VolumeFrustumFunction sphereFrustum;
+    SphereConeFunction sphereCone;
+};
+
+Kernels kernelsFor(const Cpu::Features features) {
+    Kernels out{
+        rangeFrustumScalar,
+        aabbFrustumScalar,
+        sphereFrustumScalar,
+        sphereConeScalar
+    };
+
+    #ifdef CORRADE_ENABLE_SSE2
+    if(features & Cpu::Sse2) {
+        out.rangeFrustum = rangeFrustumSse2;
+        out.aabbFrustum = aabbFrustumSse2;
+        out.sphereFrustum = sphereFrustumSse2;
+        out.sphereCone = sphereConeSse2;
+    }
+    #endif
+    #ifdef CORRADE_ENABLE_NEON
+    if(features & Cpu::Neon) {
+        out.rangeFrustum = rangeFrustumNeon;
+        out.aabbFrustum = aabbFrustumNeon;
+        out.sphereFrustum = sphereFrustumNeon;
+        out.sphereCone = sphereConeNeon;
+    }
+    #endif
+
+    /* Silence unused variable warnings on platforms with no SIMD variant */
+    static_cast<void>(features);
+
+    return out;
+}
+
+const Kernels& kernels() {
+    /* Picked on first use, the static initialization is thread-safe */
+    static const Kernels out = kernelsFor(Cpu::runtimeFeatures());
+    return out;
+}
+
+}
+
+void rangeFrustum(const Containers::StridedArrayView1D<const Range3D<Float>>& ranges, const Frustum<Float>& frustum, const Containers::MutableBitArrayView intersects) {
+    CORRADE_ASSERT(ranges.size() == intersects.size(),
+        "Math::Intersection::rangeFrustum(): wrong output size, got" << intersects.size() << "but expected" << ranges.size(), );
+
+    kernels().rangeFrustum(frustum.data(), static_cast<const char*>(ranges.data()), ranges.stride(), intersects);
+}
+
+void aabbFrustum(const Containers::StridedArrayView1D<const Vector3<Float>>& aabbCenters, const Containers::StridedArrayView1D<const Vector3<Float>>& aabbExtents, const Frustum<Float>& frustum, const Containers::MutableBitArrayView intersects) {
+    CORRADE_ASSERT(aabbCenters.size() == aabbExtents.size(),
+        "Math::Intersection::aabbFrustum(): expected extents view to have" << aabbCenters.size() << "items but got" << aabbExtents.size(), );
+    CORRADE_ASSERT(aabbCenters.size() == intersects.size(),
+        "Math::Intersection::aabbFrustum(): wrong output size, got" << intersects.size() << "but expected" << aabbCenters.size(), );
+
+    kernels().aabbFrustum(frustum.data(), static_cast<const char*>(aabbCenters.data()), aabbCenters.stride(), static_cast<const char*>(aabbExtents.data()), aabbExtents.stride(), intersects);
+}
+
+void sphereFrustum(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Frustum<Float>& frustum, const Containers::MutableBitArrayView intersects) {
+    CORRADE_ASSERT(sphereCenters.size() == sphereRadii.size(),
+        "Math::Intersection::sphereFrustum(): expected radii view to have" << sphereCenters.size() << "items but got" << sphereRadii.size(), );
+    CORRADE_ASSERT(sphereCenters.size() == intersects.size(),
+        "Math::Intersection::sphereFrustum(): wrong output size, got" << intersects.size() << "but expected" << sphereCenters.size(), );
+
+    kernels().sphereFrustum(frustum.data(), static_cast<const char*>(sphereCenters.data()), sphereCenters.stride(), static_cast<const char*>(sphereRadii.data()), sphereRadii.stride(), intersects);
+}
+
+void sphereCone(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Vector3<Float>& coneOrigin, const Vector3<Float>& coneNormal, const Rad<Float> coneAngle, const Containers::MutableBitArrayView intersects) {
+    /* Same as in the single-value variant */
+    const Rad<Float> halfAngle = coneAngle*0.5f;
+    const Float sinAngle = Math::sin(halfAngle);
+    const Float tanAngleSqPlusOne = 1.0f + Math::pow<Float>(Math::tan<Float>(halfAngle), 2.0f);
+
+    sphereCone(sphereCenters, sphereRadii, coneOrigin, coneNormal, sinAngle, tanAngleSqPlusOne, intersects);
+}
+
+void sphereCone(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Vector3<Float>& coneOrigin, const Vector3<Float>& coneNormal, const Float sinAngle, const Float tanAngleSqPlusOne, const Containers::MutableBitArrayView intersects) {
+    CORRADE_ASSERT(sphereCenters.size() == sphereRadii.size(),
+        "Math::Intersection::sphereCone(): expected radii view to have" << sphereCenters.size() << "items but got" << sphereRadii.size(), );
+    CORRADE_ASSERT(sphereCenters.size() == intersects.size(),
+        "Math::Intersection::sphereCone(): wrong output size, got" << intersects.size() << "but expected" << sphereCenters.size(), );
+
+    const Float cone[]{
+        coneOrigin.x(), coneOrigin.y(), coneOrigin.z(),
+        coneNormal.x(), coneNormal.y(), coneNormal.z(),
+        sinAngle, tanAngleSqPlusOne
+    };
+    kernels().sphereCone(cone, static_cast<const char*>(sphereCenters.data()), sphereCenters.stride(), static_cast<const char*>(sphereRadii.data()), sphereRadii.stride(), intersects);
+}
+
+}}}
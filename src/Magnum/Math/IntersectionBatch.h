@@ -0,0 +1,139 @@
+#ifndef Magnum_Math_IntersectionBatch_h
+#define Magnum_Math_IntersectionBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Intersection::rangeFrustum(), @ref Magnum::Math::Intersection::aabbFrustum(), @ref Magnum::Math::Intersection::sphereFrustum(), @ref Magnum::Math::Intersection::sphereCone() batch variants
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math { namespace Intersection {
+
+/**
+@{ @name Batch intersection functions
+
+These functions test an unbounded range of bounding volumes against a single
+frustum or cone, as opposed to single values, and write the results into a bit
+view. They're meant for culling large amounts of objects at once, the volumes
+are processed several at a time with the implementation picked at runtime on
+first use based on instruction sets available on the CPU, with a SSE2 variant
+on x86 and a NEON variant on ARM. Results are the same as when calling the
+single-value variants in a loop.
+*/
+
+/**
+@brief Intersection of a batch of ranges and a frustum
+@param[in]  ranges      Ranges
+@param[in]  frustum     Frustum planes with normals pointing outwards
+@param[out] intersects  Where to put the results
+@m_since_latest
+
+Equivalent to calling @ref rangeFrustum(const Range3D<T>&, const Frustum<T>&)
+for all items, setting the corresponding bit in @p intersects if the range
+intersects the frustum and resetting it otherwise. Expects that @p ranges and
+@p intersects have the same size.
+*/
+MAGNUM_EXPORT void rangeFrustum(const Containers::StridedArrayView1D<const Range3D<Float>>& ranges, const Frustum<Float>& frustum, Containers::MutableBitArrayView intersects);
+
+/**
+@brief Intersection of a batch of axis-aligned boxes and a frustum
+@param[in]  aabbCenters Box centers
+@param[in]  aabbExtents Box (half-)extents
+@param[in]  frustum     Frustum planes with normals pointing outwards
+@param[out] intersects  Where to put the results
+@m_since_latest
+
+Equivalent to calling @ref aabbFrustum(const Vector3<T>&, const Vector3<T>&, const Frustum<T>&)
+for all items, setting the corresponding bit in @p intersects if the box
+intersects the frustum and resetting it otherwise. Expects that
+@p aabbCenters, @p aabbExtents and @p intersects have the same size. Having the
+centers and extents in separate views allows the data to be stored as a
+structure of arrays.
+*/
+MAGNUM_EXPORT void aabbFrustum(const Containers::StridedArrayView1D<const Vector3<Float>>& aabbCenters, const Containers::StridedArrayView1D<const Vector3<Float>>& aabbExtents, const Frustum<Float>& frustum, Containers::MutableBitArrayView intersects);
+
+/**
+@brief Intersection of a batch of spheres and a frustum
+@param[in]  sphereCenters Sphere centers
+@param[in]  sphereRadii Sphere radii
+@param[in]  frustum     Frustum planes with normals pointing outwards
+@param[out] intersects  Where to put the results
+@m_since_latest
+
+Equivalent to calling @ref sphereFrustum(const Vector3<T>&, T, const Frustum<T>&)
+for all items, setting the corresponding bit in @p intersects if the sphere
+intersects the frustum and resetting it otherwise. Expects that
+@p sphereCenters, @p sphereRadii and @p intersects have the same size.
+*/
+MAGNUM_EXPORT void sphereFrustum(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Frustum<Float>& frustum, Containers::MutableBitArrayView intersects);
+
+/**
+@brief Intersection of a batch of spheres and a cone
+@param[in]  sphereCenters Sphere centers
+@param[in]  sphereRadii Sphere radii
+@param[in]  coneOrigin  Cone origin
+@param[in]  coneNormal  Cone normal
+@param[in]  coneAngle   Apex angle of the cone (@f$ 0 < \Theta < \pi @f$)
+@param[out] intersects  Where to put the results
+@m_since_latest
+
+Precomputes a portion of the intersection equation from @p coneAngle and calls
+@ref sphereCone(const Containers::StridedArrayView1D<const Vector3<Float>>&, const Containers::StridedArrayView1D<const Float>&, const Vector3<Float>&, const Vector3<Float>&, Float, Float, Containers::MutableBitArrayView).
+*/
+MAGNUM_EXPORT void sphereCone(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Vector3<Float>& coneOrigin, const Vector3<Float>& coneNormal, Rad<Float> coneAngle, Containers::MutableBitArrayView intersects);
+
+/**
+@brief Intersection of a batch of spheres and a cone using precomputed values
+@param[in]  sphereCenters Sphere centers
+@param[in]  sphereRadii Sphere radii
+@param[in]  coneOrigin  Cone origin
+@param[in]  coneNormal  Cone normal
+@param[in]  sinAngle    Precomputed sine of half the cone's opening angle
+@param[in]  tanAngleSqPlusOne Precomputed portion of the cone intersection
+    equation
+@param[out] intersects  Where to put the results
+@m_since_latest
+
+Equivalent to calling @ref sphereCone(const Vector3<T>&, T, const Vector3<T>&, const Vector3<T>&, T, T)
+for all items, setting the corresponding bit in @p intersects if the sphere
+intersects the cone and resetting it otherwise. Expects that
+@p sphereCenters, @p sphereRadii and @p intersects have the same size.
+*/
+MAGNUM_EXPORT void sphereCone(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Vector3<Float>& coneOrigin, const Vector3<Float>& coneNormal, Float sinAngle, Float tanAngleSqPlusOne, Containers::MutableBitArrayView intersects);
+
+/**
+ * @}
+ */
+
+}}}
+
+#endif
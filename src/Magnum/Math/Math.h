@@ -91,6 +91,11 @@ template<class> class Vector2;
 template<class> class Vector3;
 template<class> class Vector4;
 
+template<std::size_t, class> class VectorSoA;
+template<class T> using Vector2SoA = VectorSoA<2, T>;
+template<class T> using Vector3SoA = VectorSoA<3, T>;
+template<class T> using Vector4SoA = VectorSoA<4, T>;
+
 template<class> struct ColorHsv;
 template<class> class Color3;
 template<class> class Color4;
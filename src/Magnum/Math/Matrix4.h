@@ -507,6 +507,92 @@ template<class T> class Matrix4: public Matrix4x4<T> {
          */
         static Matrix4<T> perspectiveProjection(const Vector2<T>& bottomLeft, const Vector2<T>& topRight, T near, T far);
 
+        /**
+         * @brief 3D reverse-Z perspective projection matrix
+         * @param size      Size of near clipping plane
+         * @param near      Distance to near clipping plane, positive is ahead
+         * @param far       Distance to far clipping plane, positive is ahead
+         * @m_since_latest
+         *
+         * Compared to @ref perspectiveProjection(const Vector2<T>&, T, T),
+         * maps the near plane to a depth of @f$ 1 @f$ and the far plane to a
+         * depth of @f$ 0 @f$ instead of @f$ [-1, 1] @f$. Combined with a
+         * floating-point depth buffer this distributes the depth precision
+         * nearly uniformly across the whole view range. If @p far is finite,
+         * the result is: @f[
+         *      \boldsymbol{A} = \begin{pmatrix}
+         *          \frac{2n}{s_x} & 0 & 0 & 0 \\
+         *          0 & \frac{2n}{s_y} & 0 & 0 \\
+         *          0 & 0 & \frac{n}{f - n} & \frac{nf}{f - n} \\
+         *          0 & 0 & -1 & 0
+         *      \end{pmatrix}
+         * @f]
+         *
+         * For infinite @p far, the result is: @f[
+         *      \boldsymbol{A} = \begin{pmatrix}
+         *          \frac{2n}{s_x} & 0 & 0 & 0 \\
+         *          0 & \frac{2n}{s_y} & 0 & 0 \\
+         *          0 & 0 & 0 & n \\
+         *          0 & 0 & -1 & 0
+         *      \end{pmatrix}
+         * @f]
+         *
+         * The matrix is meant to be used with a @f$ [0, 1] @f$ clip depth
+         * range, a @ref Magnum::GL::Renderer::StencilFunction::Greater "Greater"
+         * or @ref Magnum::GL::Renderer::StencilFunction::GreaterOrEqual "GreaterOrEqual"
+         * depth function and depth cleared to @cpp 0.0f @ce. In OpenGL the
+         * depth range is set up with
+         * @ref Magnum::GL::Renderer::setClipControl() and
+         * @ref Magnum::GL::Renderer::ClipDepth::ZeroToOne. For culling,
+         * extract the frustum planes with @ref Frustum::fromMatrixReverseZ().
+         * @see @ref perspectiveProjectionReverseZ(Rad<T>, T, T, T),
+         *      @ref perspectiveProjectionReverseZ(const Vector2<T>&, const Vector2<T>&, T, T),
+         *      @ref Constants::inf()
+         */
+        static Matrix4<T> perspectiveProjectionReverseZ(const Vector2<T>& size, T near, T far);
+
+        /**
+         * @brief 3D reverse-Z perspective projection matrix
+         * @param fov           Horizontal field of view angle @f$ \theta @f$
+         * @param aspectRatio   Horizontal:vertical aspect ratio @f$ a @f$
+         * @param near          Near clipping plane @f$ n @f$
+         * @param far           Far clipping plane @f$ f @f$
+         * @m_since_latest
+         *
+         * Equivalent to calling
+         * @ref perspectiveProjectionReverseZ(const Vector2<T>&, T, T) with
+         * the @p size parameter calculated the same way as in
+         * @ref perspectiveProjection(Rad<T>, T, T, T).
+         */
+        static Matrix4<T> perspectiveProjectionReverseZ(Rad<T> fov, T aspectRatio, T near, T far) {
+            return perspectiveProjectionReverseZ(T(2)*near*std::tan(T(fov)*T(0.5))*Vector2<T>::yScale(T(1)/aspectRatio), near, far);
+        }
+
+        /**
+         * @brief 3D off-center reverse-Z perspective projection matrix
+         * @param bottomLeft    Bottom left corner of the near clipping plane
+         * @param topRight      Top right corner of the near clipping plane
+         * @param near          Distance to near clipping plane, positive is
+         *      ahead
+         * @param far           Distance to far clipping plane, positive is
+         *      ahead
+         * @m_since_latest
+         *
+         * If @p far is finite, the result is: @f[
+         *      \boldsymbol{A} = \begin{pmatrix}
+         *          \frac{2n}{r - l} & 0 & \frac{r + l}{r - l} & 0 \\
+         *          0 & \frac{2n}{t - b} & \frac{t + b}{t - b} & 0 \\
+         *          0 & 0 & \frac{n}{f - n} & \frac{nf}{f - n} \\
+         *          0 & 0 & -1 & 0
+         *      \end{pmatrix}
+         * @f]
+         *
+         * For infinite @p far, the third row is @f$ (0, 0, 0, n) @f$. See
+         * @ref perspectiveProjectionReverseZ(const Vector2<T>&, T, T) for
+         * more information.
+         */
+        static Matrix4<T> perspectiveProjectionReverseZ(const Vector2<T>& bottomLeft, const Vector2<T>& topRight, T near, T far);
+
         /**
          * @brief Matrix oriented towards a specific point
          * @param eye       Location to place the matrix
@@ -1329,6 +1415,46 @@ template<class T> Matrix4<T> Matrix4<T>::perspectiveProjection(const Vector2<T>&
             {        T(0),         T(0), m32,  T(0)}};
 }
 
+template<class T> Matrix4<T> Matrix4<T>::perspectiveProjectionReverseZ(const Vector2<T>& size, const T near, const T far) {
+    const Vector2<T> xyScale = 2*near/size;
+
+    T m22, m32;
+    if(far == Constants<T>::inf()) {
+        m22 = T(0);
+        m32 = near;
+    } else {
+        const T zScale = near/(far-near);
+        m22 = zScale;
+        m32 = far*zScale;
+    }
+
+    return {{xyScale.x(),        T(0), T(0),  T(0)},
+            {       T(0), xyScale.y(), T(0),  T(0)},
+            {       T(0),        T(0), m22,  T(-1)},
+            {       T(0),        T(0), m32,  T(0)}};
+}
+
+template<class T> Matrix4<T> Matrix4<T>::perspectiveProjectionReverseZ(const Vector2<T>& bottomLeft, const Vector2<T>& topRight, const T near, const T far) {
+    const Vector2<T> xyDifference = topRight - bottomLeft;
+    const Vector2<T> xyScale = 2*near/xyDifference;
+    const Vector2<T> xyOffset = (topRight + bottomLeft)/xyDifference;
+
+    T m22, m32;
+    if(far == Constants<T>::inf()) {
+        m22 = T(0);
+        m32 = near;
+    } else {
+        const T zScale = near/(far-near);
+        m22 = zScale;
+        m32 = far*zScale;
+    }
+
+    return {{ xyScale.x(),         T(0), T(0),  T(0)},
+            {        T(0),  xyScale.y(), T(0),  T(0)},
+            {xyOffset.x(), xyOffset.y(), m22,  T(-1)},
+            {        T(0),         T(0), m32,  T(0)}};
+}
+
 template<class T> Matrix4<T> Matrix4<T>::lookAt(const Vector3<T>& eye, const Vector3<T>& target, const Vector3<T>& up) {
     const Vector3<T> backward = (eye - target).normalized();
     const Vector3<T> right = cross(up, backward).normalized();
@@ -0,0 +1,391 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MatrixBatch.h"
+
+#include <Corrade/Cpu.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Matrix4.h"
+
+#ifdef CORRADE_ENABLE_SSE2
+#include <Corrade/Utility/IntrinsicsSse2.h>
+#endif
+#ifdef CORRADE_ENABLE_AVX
+#include <Corrade/Utility/IntrinsicsAvx.h>
+#endif
+#ifdef CORRADE_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Magnum { namespace Math {
+
+namespace {
+
+/* All kernels operate on type-erased pointers and strides so the same
+   signature can be shared by all variants. Matrices are column-major, i.e.
+   16 consecutive floats with columns at offsets 0, 4, 8 and 12. */
+typedef void(*MultiplyMatrixFunction)(const char*, std::ptrdiff_t, const char*, std::ptrdiff_t, char*, std::ptrdiff_t, std::size_t);
+typedef void(*TransformFunction)(const Float*, const char*, std::ptrdiff_t, char*, std::ptrdiff_t, std::size_t);
+
+void multiplyMatrixScalar(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        /* Going through a temporary to allow in-place operation */
+        const Matrix4<Float> result = *reinterpret_cast<const Matrix4<Float>*>(a)**reinterpret_cast<const Matrix4<Float>*>(b);
+        *reinterpret_cast<Matrix4<Float>*>(dst) = result;
+        a += aStride;
+        b += bStride;
+        dst += dstStride;
+    }
+}
+
+void multiplyVector4Scalar(const Float* const matrix, const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    const Matrix4<Float>& m = *reinterpret_cast<const Matrix4<Float>*>(matrix);
+    for(std::size_t i = 0; i != size; ++i) {
+        const Vector4<Float> result = m**reinterpret_cast<const Vector4<Float>*>(src);
+        *reinterpret_cast<Vector4<Float>*>(dst) = result;
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+template<bool point> void transformVector3Scalar(const Float* const matrix, const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    /* Caching the matrix elements in locals to avoid repeated loads through
+       the potentially aliased destination pointer */
+    const Float m00 = matrix[0], m01 = matrix[1], m02 = matrix[2],
+                m10 = matrix[4], m11 = matrix[5], m12 = matrix[6],
+                m20 = matrix[8], m21 = matrix[9], m22 = matrix[10],
+                m30 = point ? matrix[12] : 0.0f,
+                m31 = point ? matrix[13] : 0.0f,
+                m32 = point ? matrix[14] : 0.0f;
+    for(std::size_t i = 0; i != size; ++i) {
+        const Float* s = reinterpret_cast<const Float*>(src);
+        const Float x = s[0], y = s[1], z = s[2];
+        Float* d = reinterpret_cast<Float*>(dst);
+        d[0] = m00*x + m10*y + m20*z + m30;
+        d[1] = m01*x + m11*y + m21*z + m31;
+        d[2] = m02*x + m12*y + m22*z + m32;
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_ENABLE_SSE2 void multiplyMatrixSse2(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Float* aa = reinterpret_cast<const Float*>(a);
+        const Float* bb = reinterpret_cast<const Float*>(b);
+        Float* d = reinterpret_cast<Float*>(dst);
+
+        /* Load all of A first so the destination can alias it. Each result
+           column j is then a linear combination of A columns weighted by
+           elements of B column j, which is read fully before the result
+           column is written, so the destination can alias B as well. */
+        const __m128 a0 = _mm_loadu_ps(aa + 0);
+        const __m128 a1 = _mm_loadu_ps(aa + 4);
+        const __m128 a2 = _mm_loadu_ps(aa + 8);
+        const __m128 a3 = _mm_loadu_ps(aa + 12);
+        for(std::size_t j = 0; j != 4; ++j) {
+            const __m128 bj = _mm_loadu_ps(bb + 4*j);
+            __m128 r = _mm_mul_ps(a0, _mm_shuffle_ps(bj, bj, _MM_SHUFFLE(0, 0, 0, 0)));
+            r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_shuffle_ps(bj, bj, _MM_SHUFFLE(1, 1, 1, 1))));
+            r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_shuffle_ps(bj, bj, _MM_SHUFFLE(2, 2, 2, 2))));
+            r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_shuffle_ps(bj, bj, _MM_SHUFFLE(3, 3, 3, 3))));
+            _mm_storeu_ps(d + 4*j, r);
+        }
+
+        a += aStride;
+        b += bStride;
+        dst += dstStride;
+    }
+}
+
+CORRADE_ENABLE_SSE2 void multiplyVector4Sse2(const Float* const matrix, const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    const __m128 c0 = _mm_loadu_ps(matrix + 0);
+    const __m128 c1 = _mm_loadu_ps(matrix + 4);
+    const __m128 c2 = _mm_loadu_ps(matrix + 8);
+    const __m128 c3 = _mm_loadu_ps(matrix + 12);
+    for(std::size_t i = 0; i != size; ++i) {
+        const __m128 v = _mm_loadu_ps(reinterpret_cast<const Float*>(src));
+        __m128 r = _mm_mul_ps(c0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+        r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+        r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+        r = _mm_add_ps(r, _mm_mul_ps(c3, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+        _mm_storeu_ps(reinterpret_cast<Float*>(dst), r);
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+/* Vector3 items are not padded, so it's not possible to use a four-component
+   load or store without touching memory that possibly belongs to the next
+   item or is past the end of the view. Loading and storing the components
+   separately instead. */
+template<bool point> CORRADE_ENABLE_SSE2 void transformVector3Sse2(const Float* const matrix, const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    const __m128 c0 = _mm_loadu_ps(matrix + 0);
+    const __m128 c1 = _mm_loadu_ps(matrix + 4);
+    const __m128 c2 = _mm_loadu_ps(matrix + 8);
+    const __m128 c3 = point ? _mm_loadu_ps(matrix + 12) : _mm_setzero_ps();
+    for(std::size_t i = 0; i != size; ++i) {
+        const Float* s = reinterpret_cast<const Float*>(src);
+        __m128 r = _mm_add_ps(c3, _mm_mul_ps(c0, _mm_set1_ps(s[0])));
+        r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_set1_ps(s[1])));
+        r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(s[2])));
+        Float* d = reinterpret_cast<Float*>(dst);
+        _mm_storel_pi(reinterpret_cast<__m64*>(d), r);
+        _mm_store_ss(d + 2, _mm_movehl_ps(r, r));
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+/* The AVX variants process two columns or two vectors at a time, with the
+   matrix columns duplicated to both 128-bit lanes and the per-lane
+   _mm256_permute_ps() acting as a broadcast of given input component. Only
+   floating-point AVX instructions are used, so this doesn't need AVX2. */
+CORRADE_ENABLE_AVX void multiplyMatrixAvx(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Float* aa = reinterpret_cast<const Float*>(a);
+        const Float* bb = reinterpret_cast<const Float*>(b);
+        Float* d = reinterpret_cast<Float*>(dst);
+
+        /* Same as in the SSE2 variant, all of A and both B columns for given
+           pair of result columns are loaded before a store so the
+           destination can alias either of the inputs */
+        const __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(aa + 0));
+        const __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(aa + 4));
+        const __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(aa + 8));
+        const __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(aa + 12));
+        const __m256 b01 = _mm256_loadu_ps(bb + 0);
+        const __m256 b23 = _mm256_loadu_ps(bb + 8);
+
+        __m256 r01 = _mm256_mul_ps(a0, _mm256_permute_ps(b01, _MM_SHUFFLE(0, 0, 0, 0)));
+        r01 = _mm256_add_ps(r01, _mm256_mul_ps(a1, _mm256_permute_ps(b01, _MM_SHUFFLE(1, 1, 1, 1))));
+        r01 = _mm256_add_ps(r01, _mm256_mul_ps(a2, _mm256_permute_ps(b01, _MM_SHUFFLE(2, 2, 2, 2))));
+        r01 = _mm256_add_ps(r01, _mm256_mul_ps(a3, _mm256_permute_ps(b01, _MM_SHUFFLE(3, 3, 3, 3))));
+
+        __m256 r23 = _mm256_mul_ps(a0, _mm256_permute_ps(b23, _MM_SHUFFLE(0, 0, 0, 0)));
+        r23 = _mm256_add_ps(r23, _mm256_mul_ps(a1, _mm256_permute_ps(b23, _MM_SHUFFLE(1, 1, 1, 1))));
+        r23 = _mm256_add_ps(r23, _mm256_mul_ps(a2, _mm256_permute_ps(b23, _MM_SHUFFLE(2, 2, 2, 2))));
+        r23 = _mm256_add_ps(r23, _mm256_mul_ps(a3, _mm256_permute_ps(b23, _MM_SHUFFLE(3, 3, 3, 3))));
+
+        _mm256_storeu_ps(d + 0, r01);
+        _mm256_storeu_ps(d + 8, r23);
+
+        a += aStride;
+        b += bStride;
+        dst += dstStride;
+    }
+}
+
+CORRADE_ENABLE_AVX void multiplyVector4Avx(const Float* const matrix, const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    const __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 0));
+    const __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 4));
+    const __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 8));
+    const __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 12));
+
+    /* Two vectors at a time, the stride between them is arbitrary so they
+       have to be loaded and stored as two separate halves */
+    std::size_t i = 0;
+    for(; i + 2 <= size; i += 2) {
+        const __m256 v = _mm256_insertf128_ps(_mm256_castps128_ps256(
+            _mm_loadu_ps(reinterpret_cast<const Float*>(src))),
+            _mm_loadu_ps(reinterpret_cast<const Float*>(src + srcStride)), 1);
+        __m256 r = _mm256_mul_ps(c0, _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+        r = _mm256_add_ps(r, _mm256_mul_ps(c1, _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1))));
+        r = _mm256_add_ps(r, _mm256_mul_ps(c2, _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2))));
+        r = _mm256_add_ps(r, _mm256_mul_ps(c3, _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3))));
+        _mm_storeu_ps(reinterpret_cast<Float*>(dst), _mm256_castps256_ps128(r));
+        _mm_storeu_ps(reinterpret_cast<Float*>(dst + dstStride), _mm256_extractf128_ps(r, 1));
+        src += 2*srcStride;
+        dst += 2*dstStride;
+    }
+
+    /* Remaining odd vector, if any */
+    if(i != size) {
+        const __m128 v = _mm_loadu_ps(reinterpret_cast<const Float*>(src));
+        __m128 r = _mm_mul_ps(_mm256_castps256_ps128(c0), _mm_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm256_castps256_ps128(c1), _mm_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1))));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm256_castps256_ps128(c2), _mm_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2))));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm256_castps256_ps128(c3), _mm_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3))));
+        _mm_storeu_ps(reinterpret_cast<Float*>(dst), r);
+    }
+}
+#endif
+
+#ifdef CORRADE_ENABLE_NEON
+CORRADE_ENABLE_NEON void multiplyMatrixNeon(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Float* aa = reinterpret_cast<const Float*>(a);
+        const Float* bb = reinterpret_cast<const Float*>(b);
+        Float* d = reinterpret_cast<Float*>(dst);
+
+        /* Same aliasing considerations as in the SSE2 variant */
+        const float32x4_t a0 = vld1q_f32(aa + 0);
+        const float32x4_t a1 = vld1q_f32(aa + 4);
+        const float32x4_t a2 = vld1q_f32(aa + 8);
+        const float32x4_t a3 = vld1q_f32(aa + 12);
+        for(std::size_t j = 0; j != 4; ++j) {
+            const float32x4_t bj = vld1q_f32(bb + 4*j);
+            float32x4_t r = vmulq_lane_f32(a0, vget_low_f32(bj), 0);
+            r = vmlaq_lane_f32(r, a1, vget_low_f32(bj), 1);
+            r = vmlaq_lane_f32(r, a2, vget_high_f32(bj), 0);
+            r = vmlaq_lane_f32(r, a3, vget_high_f32(bj), 1);
+            vst1q_f32(d + 4*j, r);
+        }
+
+        a += aStride;
+        b += bStride;
+        dst += dstStride;
+    }
+}
+
+CORRADE_ENABLE_NEON void multiplyVector4Neon(const Float* const matrix, const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    const float32x4_t c0 = vld1q_f32(matrix + 0);
+    const float32x4_t c1 = vld1q_f32(matrix + 4);
+    const float32x4_t c2 = vld1q_f32(matrix + 8);
+    const float32x4_t c3 = vld1q_f32(matrix + 12);
+    for(std::size_t i = 0; i != size; ++i) {
+        const float32x4_t v = vld1q_f32(reinterpret_cast<const Float*>(src));
+        float32x4_t r = vmulq_lane_f32(c0, vget_low_f32(v), 0);
+        r = vmlaq_lane_f32(r, c1, vget_low_f32(v), 1);
+        r = vmlaq_lane_f32(r, c2, vget_high_f32(v), 0);
+        r = vmlaq_lane_f32(r, c3, vget_high_f32(v), 1);
+        vst1q_f32(reinterpret_cast<Float*>(dst), r);
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+/* See the SSE2 variant for why the components are loaded and stored
+   separately */
+template<bool point> CORRADE_ENABLE_NEON void transformVector3Neon(const Float* const matrix, const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    const float32x4_t c0 = vld1q_f32(matrix + 0);
+    const float32x4_t c1 = vld1q_f32(matrix + 4);
+    const float32x4_t c2 = vld1q_f32(matrix + 8);
+    const float32x4_t c3 = point ? vld1q_f32(matrix + 12) : vdupq_n_f32(0.0f);
+    for(std::size_t i = 0; i != size; ++i) {
+        const Float* s = reinterpret_cast<const Float*>(src);
+        float32x4_t r = vmlaq_n_f32(c3, c0, s[0]);
+        r = vmlaq_n_f32(r, c1, s[1]);
+        r = vmlaq_n_f32(r, c2, s[2]);
+        Float* d = reinterpret_cast<Float*>(dst);
+        vst1_f32(d, vget_low_f32(r));
+        vst1q_lane_f32(d + 2, r, 2);
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+#endif
+
+struct Kernels {
+    MultiplyMatrixFunction multiplyMatrix;
+    TransformFunction multiplyVector4;
+    TransformFunction transformPoints;
+    TransformFunction transformVectors;
+};
+
+Kernels kernelsFor(const Cpu::Features features) {
+    Kernels out{
+        multiplyMatrixScalar,
+        multiplyVector4Scalar,
+        transformVector3Scalar<true>,
+        transformVector3Scalar<false>
+    };
+
+    #ifdef CORRADE_ENABLE_SSE2
+    if(features & Cpu::Sse2) {
+        out.multiplyMatrix = multiplyMatrixSse2;
+        out.multiplyVector4 = multiplyVector4Sse2;
+        out.transformPoints = transformVector3Sse2<true>;
+        out.transformVectors = transformVector3Sse2<false>;
+    }
+    #endif
+    /* There's no AVX variant for the Vector3 transformations as there it's
+       the separate component loads and stores that are the bottleneck */
+    #ifdef CORRADE_ENABLE_AVX
+    if(features & Cpu::Avx) {
+        out.multiplyMatrix = multiplyMatrixAvx;
+        out.multiplyVector4 = multiplyVector4Avx;
+    }
+    #endif
+    #ifdef CORRADE_ENABLE_NEON
+    if(features & Cpu::Neon) {
+        out.multiplyMatrix = multiplyMatrixNeon;
+        out.multiplyVector4 = multiplyVector4Neon;
+        out.transformPoints = transformVector3Neon<true>;
+        out.transformVectors = transformVector3Neon<false>;
+    }
+    #endif
+
+    /* Silence unused variable warnings on platforms with no SIMD variant */
+    static_cast<void>(features);
+
+    return out;
+}
+
+const Kernels& kernels() {
+    /* Picked on first use, the static initialization is thread-safe */
+    static const Kernels out = kernelsFor(Cpu::runtimeFeatures());
+    return out;
+}
+
+}
+
+void multiplyInto(const Containers::StridedArrayView1D<const Matrix4<Float>>& a, const Containers::StridedArrayView1D<const Matrix4<Float>>& b, const Containers::StridedArrayView1D<Matrix4<Float>>& dst) {
+    CORRADE_ASSERT(a.size() == b.size(),
+        "Math::multiplyInto(): expected second view to have" << a.size() << "items but got" << b.size(), );
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::multiplyInto(): wrong destination size, got" << dst.size() << "but expected" << a.size(), );
+
+    kernels().multiplyMatrix(static_cast<const char*>(a.data()), a.stride(), static_cast<const char*>(b.data()), b.stride(), static_cast<char*>(dst.data()), dst.stride(), a.size());
+}
+
+void multiplyInto(const Matrix4<Float>& matrix, const Containers::StridedArrayView1D<const Vector4<Float>>& src, const Containers::StridedArrayView1D<Vector4<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::multiplyInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+
+    kernels().multiplyVector4(matrix.data(), static_cast<const char*>(src.data()), src.stride(), static_cast<char*>(dst.data()), dst.stride(), src.size());
+}
+
+void transformPointsInto(const Matrix4<Float>& matrix, const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformPointsInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+
+    kernels().transformPoints(matrix.data(), static_cast<const char*>(src.data()), src.stride(), static_cast<char*>(dst.data()), dst.stride(), src.size());
+}
+
+void transformVectorsInto(const Matrix4<Float>& matrix, const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformVectorsInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+
+    kernels().transformVectors(matrix.data(), static_cast<const char*>(src.data()), src.stride(), static_cast<char*>(dst.data()), dst.stride(), src.size());
+}
+
+}}
@@ -0,0 +1,117 @@
+#ifndef Magnum_Math_MatrixBatch_h
+#define Magnum_Math_MatrixBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::multiplyInto(), @ref Magnum::Math::transformPointsInto(), @ref Magnum::Math::transformVectorsInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@{ @name Batch matrix functions
+
+These functions process an unbounded range of matrices or vectors, as opposed
+to single values. The implementation is picked at runtime on first use based
+on instruction sets available on the CPU, with SSE2 and AVX variants on x86
+and a NEON variant on ARM.
+*/
+
+/**
+@brief Multiply matrices pairwise
+@param[in]  a       First matrices
+@param[in]  b       Second matrices
+@param[out] dst     Destination matrices
+@m_since_latest
+
+Equivalent to calculating @cpp dst[i] = a[i]*b[i] @ce for all items. Expects
+that all views have the same size. The @p dst view is allowed to be the same as
+@p a or @p b to perform the operation in-place, partial overlaps are not
+allowed.
+@see @ref Matrix4::operator*(const RectangularMatrix<size, cols, T>&) const
+*/
+MAGNUM_EXPORT void multiplyInto(const Containers::StridedArrayView1D<const Matrix4<Float>>& a, const Containers::StridedArrayView1D<const Matrix4<Float>>& b, const Containers::StridedArrayView1D<Matrix4<Float>>& dst);
+
+/**
+@brief Multiply vectors with a matrix
+@param[in]  matrix  Matrix
+@param[in]  src     Source vectors
+@param[out] dst     Destination vectors
+@m_since_latest
+
+Equivalent to calculating @cpp dst[i] = matrix*src[i] @ce for all items.
+Expects that @p src and @p dst have the same size. The @p dst view is allowed
+to be the same as @p src to perform the operation in-place, partial overlaps
+are not allowed.
+*/
+MAGNUM_EXPORT void multiplyInto(const Matrix4<Float>& matrix, const Containers::StridedArrayView1D<const Vector4<Float>>& src, const Containers::StridedArrayView1D<Vector4<Float>>& dst);
+
+/**
+@brief Transform points with a matrix
+@param[in]  matrix  Transformation matrix
+@param[in]  src     Source points
+@param[out] dst     Destination points
+@m_since_latest
+
+Equivalent to calling @ref Matrix4::transformPoint() for all items. Unlike
+@ref Matrix4::transformPoint() doesn't perform the projective divide, i.e.
+the bottom row of the matrix is assumed to be @f$ (0, 0, 0, 1) @f$. Expects
+that @p src and @p dst have the same size. The @p dst view is allowed to be the
+same as @p src to perform the operation in-place, partial overlaps are not
+allowed.
+@see @ref transformVectorsInto()
+*/
+MAGNUM_EXPORT void transformPointsInto(const Matrix4<Float>& matrix, const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst);
+
+/**
+@brief Transform vectors with a matrix
+@param[in]  matrix  Transformation matrix
+@param[in]  src     Source vectors
+@param[out] dst     Destination vectors
+@m_since_latest
+
+Equivalent to calling @ref Matrix4::transformVector() for all items, i.e.
+the translation part of the matrix is ignored. Expects that @p src and @p dst
+have the same size. The @p dst view is allowed to be the same as @p src to
+perform the operation in-place, partial overlaps are not allowed.
+@see @ref transformPointsInto()
+*/
+MAGNUM_EXPORT void transformVectorsInto(const Matrix4<Float>& matrix, const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst);
+
+/**
+ * @}
+ */
+
+}}
+
+#endif
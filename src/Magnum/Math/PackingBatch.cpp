@@ -26,6 +26,8 @@
 
 #include "PackingBatch.h"
 
+#include <cstring>
+#include <Corrade/Cpu.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Assert.h>
@@ -33,52 +35,270 @@
 #include "Magnum/Math/Packing.h"
 #include "Magnum/Math/Implementation/halfTables.hpp"
 
+#ifdef CORRADE_ENABLE_SSE41
+#include <Corrade/Utility/IntrinsicsSse4.h>
+#endif
+#ifdef CORRADE_ENABLE_AVX_F16C
+#include <Corrade/Utility/IntrinsicsAvx.h>
+#endif
+#ifdef CORRADE_ENABLE_NEON_FP16
+#include <arm_neon.h>
+#endif
+
 namespace Magnum { namespace Math {
 
 namespace {
 
-template<class T> inline void unpackUnsignedIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    CORRADE_ASSERT(src.size() == dst.size(),
-        "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
-    CORRADE_ASSERT(src.template isContiguous<1>(),
-        "Math::unpackInto(): second source view dimension is not contiguous", );
-    CORRADE_ASSERT(dst.isContiguous<1>(),
-        "Math::unpackInto(): second destination view dimension is not contiguous", );
-
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
+/* Each conversion is implemented as a kernel operating on a contiguous run of
+   values, which is then called either once for the whole view if both views
+   are contiguous, or for each row of the second dimension otherwise. */
+template<class T, class U> void runContiguous(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<U>& dst, void(*const run)(const T*, U*, std::size_t)) {
+    if(src.isContiguous() && dst.isContiguous()) {
+        run(static_cast<const T*>(src.data()), static_cast<U*>(dst.data()), src.size()[0]*src.size()[1]);
+        return;
+    }
 
-    /* Caching values to avoid inline function calls in ebug builds */
-    constexpr Float bitMax = Implementation::bitMax<T>();
+    /* Caching values to avoid inline function calls in debug builds */
     const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
     const std::ptrdiff_t srcStride = src.stride()[0];
     const std::ptrdiff_t dstStride = dst.stride()[0];
     const std::size_t maxJ = src.size()[1];
     for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
-        Float* dstPtrI = reinterpret_cast<Float*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j)
-            *dstPtrI++ = *srcPtrI++/bitMax;
-
+        run(reinterpret_cast<const T*>(srcPtr), reinterpret_cast<U*>(dstPtr), maxJ);
         srcPtr += srcStride;
         dstPtr += dstStride;
     }
 }
 
+template<class T> void unpackUnsignedScalar(const T* const src, Float* const dst, const std::size_t count) {
+    constexpr Float bitMax = Implementation::bitMax<T>();
+    for(std::size_t i = 0; i != count; ++i)
+        dst[i] = src[i]/bitMax;
 }
 
-void unpackInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    unpackUnsignedIntoImplementation(src, dst);
+template<class T> void unpackSignedScalar(const T* const src, Float* const dst, const std::size_t count) {
+    constexpr Float bitMax = Implementation::bitMax<T>();
+    for(std::size_t i = 0; i != count; ++i) {
+        const Float value = src[i]/bitMax;
+        /* Avoiding a max() call in Debug */
+        dst[i] = value < -1.0f ? -1.0f : value;
+    }
 }
 
-void unpackInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    unpackUnsignedIntoImplementation(src, dst);
+template<class T> void packScalar(const Float* const src, T* const dst, const std::size_t count) {
+    constexpr Float bitMax = Implementation::bitMax<T>();
+    for(std::size_t i = 0; i != count; ++i)
+        /** @todo provide a version that doesn't do rounding */
+        dst[i] = std::round(src[i]*bitMax);
 }
 
-namespace {
+inline UnsignedInt unpackHalfTable(const UnsignedShort h) {
+    return HalfMantissaTable[HalfOffsetTable[h >> 10] + (h & 0x3ff)] + HalfExponentTable[h >> 10];
+}
+
+inline UnsignedShort packHalfTable(const UnsignedInt f) {
+    return HalfBaseTable[(f >> 23) & 0x1ff] + ((f & 0x007fffff) >> HalfShiftTable[(f >> 23) & 0x1ff]);
+}
+
+void unpackHalfScalar(const UnsignedShort* const src, Float* const dst, const std::size_t count) {
+    UnsignedInt* const dstBits = reinterpret_cast<UnsignedInt*>(dst);
+    for(std::size_t i = 0; i != count; ++i)
+        dstBits[i] = unpackHalfTable(src[i]);
+}
+
+void packHalfScalar(const Float* const src, UnsignedShort* const dst, const std::size_t count) {
+    const UnsignedInt* const srcBits = reinterpret_cast<const UnsignedInt*>(src);
+    for(std::size_t i = 0; i != count; ++i)
+        dst[i] = packHalfTable(srcBits[i]);
+}
+
+#ifdef CORRADE_ENABLE_SSE41
+/* Loading four 8- or 16-bit values and extending them to 32 bits, and storing
+   four 32-bit values narrowed to 8- or 16-bit. The 8-bit values are loaded
+   and stored through a 32-bit integer to avoid touching memory outside of the
+   four values. */
+template<class T> __m128i loadExtendedSse41(const T* src);
+template<> CORRADE_ENABLE_SSE41 inline __m128i loadExtendedSse41(const UnsignedByte* const src) {
+    Int in;
+    std::memcpy(&in, src, 4);
+    return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(in));
+}
+template<> CORRADE_ENABLE_SSE41 inline __m128i loadExtendedSse41(const Byte* const src) {
+    Int in;
+    std::memcpy(&in, src, 4);
+    return _mm_cvtepi8_epi32(_mm_cvtsi32_si128(in));
+}
+template<> CORRADE_ENABLE_SSE41 inline __m128i loadExtendedSse41(const UnsignedShort* const src) {
+    return _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+}
+template<> CORRADE_ENABLE_SSE41 inline __m128i loadExtendedSse41(const Short* const src) {
+    return _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+}
+
+template<class T> void storeNarrowedSse41(T* dst, __m128i value);
+template<> CORRADE_ENABLE_SSE41 inline void storeNarrowedSse41(UnsignedByte* const dst, const __m128i value) {
+    const Int out = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(value, value), value));
+    std::memcpy(dst, &out, 4);
+}
+template<> CORRADE_ENABLE_SSE41 inline void storeNarrowedSse41(Byte* const dst, const __m128i value) {
+    const Int out = _mm_cvtsi128_si32(_mm_packs_epi16(_mm_packs_epi32(value, value), value));
+    std::memcpy(dst, &out, 4);
+}
+template<> CORRADE_ENABLE_SSE41 inline void storeNarrowedSse41(UnsignedShort* const dst, const __m128i value) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi32(value, value));
+}
+template<> CORRADE_ENABLE_SSE41 inline void storeNarrowedSse41(Short* const dst, const __m128i value) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(value, value));
+}
+
+/* Dividing instead of multiplying with a reciprocal to have the output
+   bit-exact with the scalar variant */
+template<class T> CORRADE_ENABLE_SSE41 void unpackUnsignedSse41(const T* const src, Float* const dst, const std::size_t count) {
+    const __m128 bitMax = _mm_set1_ps(Implementation::bitMax<T>());
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+        _mm_storeu_ps(dst + i, _mm_div_ps(_mm_cvtepi32_ps(loadExtendedSse41(src + i)), bitMax));
+    unpackUnsignedScalar(src + i, dst + i, count - i);
+}
+
+template<class T> CORRADE_ENABLE_SSE41 void unpackSignedSse41(const T* const src, Float* const dst, const std::size_t count) {
+    const __m128 bitMax = _mm_set1_ps(Implementation::bitMax<T>());
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+        _mm_storeu_ps(dst + i, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(loadExtendedSse41(src + i)), bitMax), minusOne));
+    unpackSignedScalar(src + i, dst + i, count - i);
+}
+
+/* The scalar variant uses std::round(), which rounds halfway cases away from
+   zero, unlike _mm_round_ps() that rounds them to even. To match, a value
+   just below 0.5 with the sign of the input is added and the result is
+   truncated, which for the value range of at most 16-bit integers gives the
+   same result. */
+template<class T> CORRADE_ENABLE_SSE41 void packSse41(const Float* const src, T* const dst, const std::size_t count) {
+    const __m128 bitMax = _mm_set1_ps(Implementation::bitMax<T>());
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 almostHalf = _mm_set1_ps(0.49999997f);
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m128 value = _mm_mul_ps(_mm_loadu_ps(src + i), bitMax);
+        const __m128 offset = _mm_or_ps(almostHalf, _mm_and_ps(value, signMask));
+        storeNarrowedSse41(dst + i, _mm_cvttps_epi32(_mm_add_ps(value, offset)));
+    }
+    packScalar(src + i, dst + i, count - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX_F16C
+/* The half -> float conversion is exact, so the output matches the
+   table-based variant */
+CORRADE_ENABLE_AVX_F16C void unpackHalfF16c(const UnsignedShort* const src, Float* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+    for(; i + 4 <= count; i += 4)
+        _mm_storeu_ps(dst + i, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i))));
+    unpackHalfScalar(src + i, dst + i, count - i);
+}
+
+/* The table-based variant truncates the mantissa, which is the same as
+   rounding towards zero. The only difference is with values that are too
+   large to be represented, for which the table gives an infinity but
+   rounding towards zero gives the largest representable value, so such
+   values are replaced with an infinity of the same sign before the
+   conversion. NaNs compare as false, so are passed through unchanged. */
+CORRADE_ENABLE_AVX_F16C void packHalfF16c(const Float* const src, UnsignedShort* const dst, const std::size_t count) {
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 infinity = _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000));
+    const __m256 overflow = _mm256_set1_ps(65536.0f);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m256 value = _mm256_loadu_ps(src + i);
+        const __m256 sign = _mm256_and_ps(value, signMask);
+        const __m256 isOverflow = _mm256_cmp_ps(_mm256_andnot_ps(signMask, value), overflow, _CMP_GE_OQ);
+        const __m256 clamped = _mm256_blendv_ps(value, _mm256_or_ps(infinity, sign), isOverflow);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_cvtps_ph(clamped, _MM_FROUND_TO_ZERO));
+    }
+    packHalfScalar(src + i, dst + i, count - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_NEON_FP16
+/* Only the half -> float direction has a NEON variant, as the float -> half
+   conversion instruction uses the current rounding mode, which would give
+   different results from the table-based variant that truncates */
+CORRADE_ENABLE_NEON_FP16 void unpackHalfNeonFp16(const UnsignedShort* const src, Float* const dst, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+    unpackHalfScalar(src + i, dst + i, count - i);
+}
+#endif
+
+struct Kernels {
+    void(*unpackUnsignedByte)(const UnsignedByte*, Float*, std::size_t);
+    void(*unpackUnsignedShort)(const UnsignedShort*, Float*, std::size_t);
+    void(*unpackByte)(const Byte*, Float*, std::size_t);
+    void(*unpackShort)(const Short*, Float*, std::size_t);
+    void(*packUnsignedByte)(const Float*, UnsignedByte*, std::size_t);
+    void(*packUnsignedShort)(const Float*, UnsignedShort*, std::size_t);
+    void(*packByte)(const Float*, Byte*, std::size_t);
+    void(*packShort)(const Float*, Short*, std::size_t);
+    void(*unpackHalf)(const UnsignedShort*, Float*, std::size_t);
+    void(*packHalf)(const Float*, UnsignedShort*, std::size_t);
+};
+
+Kernels kernelsFor(const Cpu::Features features) {
+    Kernels out{
+        unpackUnsignedScalar<UnsignedByte>,
+        unpackUnsignedScalar<UnsignedShort>,
+        unpackSignedScalar<Byte>,
+        unpackSignedScalar<Short>,
+        packScalar<UnsignedByte>,
+        packScalar<UnsignedShort>,
+        packScalar<Byte>,
+        packScalar<Short>,
+        unpackHalfScalar,
+        packHalfScalar
+    };
+
+    #ifdef CORRADE_ENABLE_SSE41
+    if(features & Cpu::Sse41) {
+        out.unpackUnsignedByte = unpackUnsignedSse41<UnsignedByte>;
+        out.unpackUnsignedShort = unpackUnsignedSse41<UnsignedShort>;
+        out.unpackByte = unpackSignedSse41<Byte>;
+        out.unpackShort = unpackSignedSse41<Short>;
+        out.packUnsignedByte = packSse41<UnsignedByte>;
+        out.packUnsignedShort = packSse41<UnsignedShort>;
+        out.packByte = packSse41<Byte>;
+        out.packShort = packSse41<Short>;
+    }
+    #endif
+    #ifdef CORRADE_ENABLE_AVX_F16C
+    if(features & Cpu::AvxF16c) {
+        out.unpackHalf = unpackHalfF16c;
+        out.packHalf = packHalfF16c;
+    }
+    #endif
+    #ifdef CORRADE_ENABLE_NEON_FP16
+    if(features & Cpu::NeonFp16)
+        out.unpackHalf = unpackHalfNeonFp16;
+    #endif
+
+    /* Silence unused variable warnings on platforms with no SIMD variant */
+    static_cast<void>(features);
+
+    return out;
+}
 
-template<class T> inline void unpackSignedIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst) {
+const Kernels& kernels() {
+    /* Picked on first use, the static initialization is thread-safe */
+    static const Kernels out = kernelsFor(Cpu::runtimeFeatures());
+    return out;
+}
+
+template<class T> inline void unpackIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst, void(*const run)(const T*, Float*, std::size_t)) {
     CORRADE_ASSERT(src.size() == dst.size(),
         "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
     CORRADE_ASSERT(src.template isContiguous<1>(),
@@ -86,43 +306,30 @@ template<class T> inline void unpackSignedIntoImplementation(const Containers::S
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::unpackInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
+    runContiguous(src, dst, run);
+}
 
-    /* Caching values to avoid inline function calls in debug builds */
-    constexpr Float bitMax = Implementation::bitMax<T>();
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
-        Float* dstPtrI = reinterpret_cast<Float*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
-            const Float value = *srcPtrI++/bitMax;
-            /* Avoiding a max() call in Debug */
-            *dstPtrI++ = value < -1.0f ? -1.0f : value;
-        }
+}
 
-        srcPtr += srcStride;
-        dstPtr += dstStride;
-    }
+void unpackInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    unpackIntoImplementation(src, dst, kernels().unpackUnsignedByte);
 }
 
+void unpackInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    unpackIntoImplementation(src, dst, kernels().unpackUnsignedShort);
 }
 
 void unpackInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    unpackSignedIntoImplementation(src, dst);
+    unpackIntoImplementation(src, dst, kernels().unpackByte);
 }
 
 void unpackInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    unpackSignedIntoImplementation(src, dst);
+    unpackIntoImplementation(src, dst, kernels().unpackShort);
 }
 
 namespace {
 
-template<class T> inline void packIntoImplementation(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<T>& dst) {
+template<class T> inline void packIntoImplementation(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<T>& dst, void(*const run)(const Float*, T*, std::size_t)) {
     CORRADE_ASSERT(src.size() == dst.size(),
         "Math::packInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
     CORRADE_ASSERT(src.isContiguous<1>(),
@@ -130,44 +337,25 @@ template<class T> inline void packIntoImplementation(const Containers::StridedAr
     CORRADE_ASSERT(dst.template isContiguous<1>(),
         "Math::packInto(): second destination view dimension is not contiguous", );
 
-    /** @todo SSE/NEON implementations exploiting second dimension size/stride,
-        contiguity etc */
-
-    /* Caching values to avoid inline function calls in debug builds */
-    constexpr Float bitMax = Implementation::bitMax<T>();
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const Float* srcPtrI = reinterpret_cast<const Float*>(srcPtr);
-        T* dstPtrI = reinterpret_cast<T*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j)
-            /** @todo provide a version that doesn't do rounding */
-            *dstPtrI++ = std::round(*srcPtrI++*bitMax);
-
-        srcPtr += srcStride;
-        dstPtr += dstStride;
-    }
+    runContiguous(src, dst, run);
 }
 
 }
 
 void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
-    packIntoImplementation(src, dst);
+    packIntoImplementation(src, dst, kernels().packUnsignedByte);
 }
 
 void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
-    packIntoImplementation(src, dst);
+    packIntoImplementation(src, dst, kernels().packUnsignedShort);
 }
 
 void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Byte>& dst) {
-    packIntoImplementation(src, dst);
+    packIntoImplementation(src, dst, kernels().packByte);
 }
 
 void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Short>& dst) {
-    packIntoImplementation(src, dst);
+    packIntoImplementation(src, dst, kernels().packShort);
 }
 
 namespace {
@@ -475,23 +663,7 @@ void unpackHalfInto(const Containers::StridedArrayView2D<const UnsignedShort>& s
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::unpackHalfInto(): second destination view dimension is not contiguous", );
 
-    /* Caching values to avoid inline function calls in debug builds */
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const UnsignedShort* srcPtrI = reinterpret_cast<const UnsignedShort*>(srcPtr);
-        UnsignedInt* dstPtrI = reinterpret_cast<UnsignedInt*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
-            const UnsignedShort h = *srcPtrI++;
-            *dstPtrI++ = HalfMantissaTable[HalfOffsetTable[h >> 10] + (h & 0x3ff)] + HalfExponentTable[h >> 10];
-        }
-
-        srcPtr += srcStride;
-        dstPtr += dstStride;
-    }
+    runContiguous(src, dst, kernels().unpackHalf);
 }
 
 void packHalfInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
@@ -502,22 +674,94 @@ void packHalfInto(const Containers::StridedArrayView2D<const Float>& src, const
     CORRADE_ASSERT(dst.isContiguous<1>(),
         "Math::packHalfInto(): second destination view dimension is not contiguous", );
 
-    /* Caching values to avoid inline function calls in debug builds */
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const UnsignedInt* srcPtrI = reinterpret_cast<const UnsignedInt*>(srcPtr);
-        UnsignedShort* dstPtrI = reinterpret_cast<UnsignedShort*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
-            const UnsignedInt f = *srcPtrI++;
-            *dstPtrI++ = HalfBaseTable[(f >> 23) & 0x1ff] + ((f & 0x007fffff) >> HalfShiftTable[(f >> 23) & 0x1ff]);
-        }
+    runContiguous(src, dst, kernels().packHalf);
+}
 
-        srcPtr += srcStride;
-        dstPtr += dstStride;
+namespace {
+
+/* Signed 10-bit and 2-bit values are sign-extended by shifting them to the
+   top of a 32-bit value and then arithmetically back */
+inline Int signExtend(const UnsignedInt value, const UnsignedInt bits) {
+    return Int(value << (32 - bits)) >> (32 - bits);
+}
+
+}
+
+void packInt1010102Into(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView1D<UnsignedInt>& dst) {
+    CORRADE_ASSERT(src.size()[0] == dst.size(),
+        "Math::packInt1010102Into(): wrong destination size, got" << dst.size() << "but expected" << src.size()[0], );
+    CORRADE_ASSERT(src.size()[1] == 3 || src.size()[1] == 4,
+        "Math::packInt1010102Into(): expected source second dimension size to be 3 or 4 but got" << src.size()[1], );
+    CORRADE_ASSERT(src.isContiguous<1>(),
+        "Math::packInt1010102Into(): second source view dimension is not contiguous", );
+
+    const bool hasW = src.size()[1] == 4;
+    for(std::size_t i = 0; i != dst.size(); ++i) {
+        const Float* const in = static_cast<const Float*>(src[i].data());
+        UnsignedInt out = 0;
+        for(std::size_t j = 0; j != 3; ++j)
+            out |= (UnsignedInt(Int(round(clamp(in[j], -1.0f, 1.0f)*511.0f))) & 0x3ff) << 10*j;
+        if(hasW)
+            out |= (UnsignedInt(Int(round(clamp(in[3], -1.0f, 1.0f)))) & 0x3) << 30;
+        dst[i] = out;
+    }
+}
+
+void unpackInt1010102Into(const Containers::StridedArrayView1D<const UnsignedInt>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size()[0],
+        "Math::unpackInt1010102Into(): wrong destination size, got" << dst.size()[0] << "but expected" << src.size(), );
+    CORRADE_ASSERT(dst.size()[1] == 3 || dst.size()[1] == 4,
+        "Math::unpackInt1010102Into(): expected destination second dimension size to be 3 or 4 but got" << dst.size()[1], );
+    CORRADE_ASSERT(dst.isContiguous<1>(),
+        "Math::unpackInt1010102Into(): second destination view dimension is not contiguous", );
+
+    const bool hasW = dst.size()[1] == 4;
+    for(std::size_t i = 0; i != src.size(); ++i) {
+        const UnsignedInt in = src[i];
+        Float* const out = static_cast<Float*>(dst[i].data());
+        for(std::size_t j = 0; j != 3; ++j)
+            out[j] = max(Float(signExtend(in >> 10*j & 0x3ff, 10))/511.0f, -1.0f);
+        if(hasW)
+            out[3] = max(Float(signExtend(in >> 30, 2)), -1.0f);
+    }
+}
+
+void packUnsignedInt1010102Into(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView1D<UnsignedInt>& dst) {
+    CORRADE_ASSERT(src.size()[0] == dst.size(),
+        "Math::packUnsignedInt1010102Into(): wrong destination size, got" << dst.size() << "but expected" << src.size()[0], );
+    CORRADE_ASSERT(src.size()[1] == 3 || src.size()[1] == 4,
+        "Math::packUnsignedInt1010102Into(): expected source second dimension size to be 3 or 4 but got" << src.size()[1], );
+    CORRADE_ASSERT(src.isContiguous<1>(),
+        "Math::packUnsignedInt1010102Into(): second source view dimension is not contiguous", );
+
+    const bool hasW = src.size()[1] == 4;
+    for(std::size_t i = 0; i != dst.size(); ++i) {
+        const Float* const in = static_cast<const Float*>(src[i].data());
+        UnsignedInt out = 0;
+        for(std::size_t j = 0; j != 3; ++j)
+            out |= UnsignedInt(round(clamp(in[j], 0.0f, 1.0f)*1023.0f)) << 10*j;
+        if(hasW)
+            out |= UnsignedInt(round(clamp(in[3], 0.0f, 1.0f)*3.0f)) << 30;
+        dst[i] = out;
+    }
+}
+
+void unpackUnsignedInt1010102Into(const Containers::StridedArrayView1D<const UnsignedInt>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size()[0],
+        "Math::unpackUnsignedInt1010102Into(): wrong destination size, got" << dst.size()[0] << "but expected" << src.size(), );
+    CORRADE_ASSERT(dst.size()[1] == 3 || dst.size()[1] == 4,
+        "Math::unpackUnsignedInt1010102Into(): expected destination second dimension size to be 3 or 4 but got" << dst.size()[1], );
+    CORRADE_ASSERT(dst.isContiguous<1>(),
+        "Math::unpackUnsignedInt1010102Into(): second destination view dimension is not contiguous", );
+
+    const bool hasW = dst.size()[1] == 4;
+    for(std::size_t i = 0; i != src.size(); ++i) {
+        const UnsignedInt in = src[i];
+        Float* const out = static_cast<Float*>(dst[i].data());
+        for(std::size_t j = 0; j != 3; ++j)
+            out[j] = Float(in >> 10*j & 0x3ff)/1023.0f;
+        if(hasW)
+            out[3] = Float(in >> 30)/3.0f;
     }
 }
 
@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Functions @ref Magnum::Math::packInto(), @ref Magnum::Math::unpackInto(), @ref Magnum::Math::packHalfInto(), @ref Magnum::Math::unpackHalfInto(), @ref Magnum::Math::castInto()
+ * @brief Functions @ref Magnum::Math::packInto(), @ref Magnum::Math::unpackInto(), @ref Magnum::Math::packHalfInto(), @ref Magnum::Math::unpackHalfInto(), @ref Magnum::Math::packInt1010102Into(), @ref Magnum::Math::unpackInt1010102Into(), @ref Magnum::Math::packUnsignedInt1010102Into(), @ref Magnum::Math::unpackUnsignedInt1010102Into(), @ref Magnum::Math::castInto()
  * @m_since{2020,06}
  */
 
@@ -55,7 +55,9 @@ Converts integral values from full range of given *unsigned* integral type to
 floating-point values in range @f$ [0, 1] @f$. Second dimension is meant to
 contain vector/matrix components, or have a size of 1 for scalars. Expects that
 @p src and @p dst have the same size and that the second dimension in both is
-contiguous.
+contiguous. On x86 CPUs with SSE4.1, a SIMD implementation giving the same
+results is picked at runtime. It's the most efficient if both views are
+contiguous, as then the whole range is processed at once.
 @see @ref packInto(), @ref castInto(),
     @relativeref{Corrade,Containers::StridedArrayView::isContiguous()}
 */
@@ -77,7 +79,9 @@ Converts integral values from full range of given *signed* integral type to
 floating-point values in range @f$ [-1, 1] @f$. Second dimension is meant to
 contain vector/matrix components, or have a size of 1 for scalars. Expects that
 @p src and @p dst have the same size and that the second dimension in both is
-contiguous.
+contiguous. On x86 CPUs with SSE4.1, a SIMD implementation giving the same
+results is picked at runtime. It's the most efficient if both views are
+contiguous, as then the whole range is processed at once.
 @see @ref packInto(), @ref castInto(),
     @relativeref{Corrade,Containers::StridedArrayView::isContiguous()}
 */
@@ -100,7 +104,9 @@ given *unsigned* integral type or range @f$ [-1, 1] @f$ to full range of
 given *signed* integral type. Second dimension is meant to contain
 vector/matrix components, or have a size of 1 for scalars. Expects that @p src
 and @p dst have the same size and that the second dimension in both is
-contiguous.
+contiguous. On x86 CPUs with SSE4.1, a SIMD implementation giving the same
+results is picked at runtime. It's the most efficient if both views are
+contiguous, as then the whole range is processed at once.
 
 @attention Conversion result for floating-point numbers outside the normalized
     range is undefined.
@@ -142,7 +148,11 @@ and @p dst have the same size and that the second dimension in both is
 contiguous.
 
 Algorithm used: *Jeroen van der Zijp -- Fast Half Float Conversions, 2008,
-ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf*
+ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf*. On x86 CPUs with
+F16C, a SIMD implementation is picked at runtime instead, giving the same
+results except for payloads of NaN values. If both views are contiguous, the
+whole range is processed at once, otherwise the SIMD implementation is used
+for each row of the second dimension separately.
 @see @ref Half
 */
 MAGNUM_EXPORT void packHalfInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst);
@@ -161,11 +171,79 @@ thus more suitable for batch conversions of large data amounts. Expects that
 contiguous.
 
 Algorithm used: *Jeroen van der Zijp -- Fast Half Float Conversions, 2008,
-ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf*
+ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf*. On x86 CPUs with
+F16C and ARM CPUs with NEON FP16, a SIMD implementation is picked at runtime
+instead, giving the same results except for payloads of NaN values. If both
+views are contiguous, the whole range is processed at once, otherwise the SIMD
+implementation is used for each row of the second dimension separately.
 @see @ref Half
 */
 MAGNUM_EXPORT void unpackHalfInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst);
 
+/**
+@brief Pack floating-point values into a signed 10-10-10-2 representation
+@param[in]  src     Source floating-point values
+@param[out] dst     Destination packed values
+@m_since_latest
+
+Converts three or four floating-point values in range @f$ [-1, 1] @f$ into
+a single 32-bit value, with the first three components stored as 10-bit
+signed integers in range @f$ [-511, 511] @f$ starting from the lowest bits
+and the fourth as a 2-bit signed integer in range @f$ [-1, 1] @f$, matching
+@ref VertexFormat::Vector3i1010102Normalized and
+@ref VertexFormat::Vector4i1010102Normalized. If the second dimension of
+@p src has a size of 3, the top two bits are set to zero. Expects that the
+first dimension of @p src and @p dst has the same size, that the second
+dimension of @p src is either 3 or 4 and that it's contiguous.
+@see @ref unpackInt1010102Into(), @ref packUnsignedInt1010102Into()
+*/
+MAGNUM_EXPORT void packInt1010102Into(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView1D<UnsignedInt>& dst);
+
+/**
+@brief Unpack a signed 10-10-10-2 representation into floating-point values
+@param[in]  src     Source packed values
+@param[out] dst     Destination floating-point values
+@m_since_latest
+
+Inverse of @ref packInt1010102Into(), with the @f$ -512 @f$ and @f$ -2 @f$
+values clamped to @f$ -1.0 @f$ the same way as in @ref unpack(). If the second
+dimension of @p dst has a size of 3, the top two bits are ignored. Expects
+that the first dimension of @p src and @p dst has the same size, that the
+second dimension of @p dst is either 3 or 4 and that it's contiguous.
+*/
+MAGNUM_EXPORT void unpackInt1010102Into(const Containers::StridedArrayView1D<const UnsignedInt>& src, const Containers::StridedArrayView2D<Float>& dst);
+
+/**
+@brief Pack floating-point values into an unsigned 10-10-10-2 representation
+@param[in]  src     Source floating-point values
+@param[out] dst     Destination packed values
+@m_since_latest
+
+Converts three or four floating-point values in range @f$ [0, 1] @f$ into a
+single 32-bit value, with the first three components stored as 10-bit
+unsigned integers in range @f$ [0, 1023] @f$ starting from the lowest bits and
+the fourth as a 2-bit unsigned integer in range @f$ [0, 3] @f$, matching
+@ref VertexFormat::Vector4ui1010102Normalized. If the second dimension of
+@p src has a size of 3, the top two bits are set to zero. Expects that the
+first dimension of @p src and @p dst has the same size, that the second
+dimension of @p src is either 3 or 4 and that it's contiguous.
+@see @ref unpackUnsignedInt1010102Into(), @ref packInt1010102Into()
+*/
+MAGNUM_EXPORT void packUnsignedInt1010102Into(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView1D<UnsignedInt>& dst);
+
+/**
+@brief Unpack an unsigned 10-10-10-2 representation into floating-point values
+@param[in]  src     Source packed values
+@param[out] dst     Destination floating-point values
+@m_since_latest
+
+Inverse of @ref packUnsignedInt1010102Into(). If the second dimension of
+@p dst has a size of 3, the top two bits are ignored. Expects that the first
+dimension of @p src and @p dst has the same size, that the second dimension of
+@p dst is either 3 or 4 and that it's contiguous.
+*/
+MAGNUM_EXPORT void unpackUnsignedInt1010102Into(const Containers::StridedArrayView1D<const UnsignedInt>& src, const Containers::StridedArrayView2D<Float>& dst);
+
 /**
 @brief Cast integer values into a 32-bit floating-point representation
 @param[in]  src     Source integral values
@@ -0,0 +1,599 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "QuaternionBatch.h"
+
+#include <Corrade/Cpu.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/DualQuaternion.h"
+
+#ifdef CORRADE_ENABLE_SSE2
+#include <Corrade/Utility/IntrinsicsSse2.h>
+#endif
+#ifdef CORRADE_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Magnum { namespace Math {
+
+namespace {
+
+/* All kernels operate on type-erased pointers and strides so the same
+   signature can be shared by all variants. Quaternions are four consecutive
+   floats with the scalar part last, dual quaternions two quaternions with the
+   real part first. */
+typedef void(*InterpolateFunction)(const char*, std::ptrdiff_t, const char*, std::ptrdiff_t, const char*, std::ptrdiff_t, char*, std::ptrdiff_t, std::size_t);
+
+enum class Interpolation {
+    Lerp,
+    LerpShortestPath,
+    Slerp,
+    SlerpShortestPath
+};
+
+/* Same as the single-value variants, except for the normalization
+   assertions */
+template<Interpolation interpolation> void interpolateScalar(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const char* t, const std::ptrdiff_t tStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Quaternion<Float>& normalizedA = *reinterpret_cast<const Quaternion<Float>*>(a);
+        const Quaternion<Float>& normalizedB = *reinterpret_cast<const Quaternion<Float>*>(b);
+        const Float factor = *reinterpret_cast<const Float*>(t);
+        const Float cosHalfAngle = dot(normalizedA, normalizedB);
+
+        /* Going through a temporary to allow in-place operation */
+        Quaternion<Float> result{NoInit};
+        if(interpolation == Interpolation::Lerp) {
+            result = ((1.0f - factor)*normalizedA + factor*normalizedB).normalized();
+        } else if(interpolation == Interpolation::LerpShortestPath) {
+            const Quaternion<Float> shortestNormalizedA = cosHalfAngle < 0.0f ? -normalizedA : normalizedA;
+            result = ((1.0f - factor)*shortestNormalizedA + factor*normalizedB).normalized();
+        } else if(interpolation == Interpolation::Slerp) {
+            if(std::abs(cosHalfAngle) > 1.0f - 0.5f*TypeTraits<Float>::epsilon()) {
+                const Quaternion<Float> shortestNormalizedA = cosHalfAngle < 0.0f ? -normalizedA : normalizedA;
+                result = (1.0f - factor)*shortestNormalizedA + factor*normalizedB;
+            } else {
+                const Float angle = std::acos(cosHalfAngle);
+                result = (std::sin((1.0f - factor)*angle)*normalizedA + std::sin(factor*angle)*normalizedB)/std::sin(angle);
+            }
+        } else if(interpolation == Interpolation::SlerpShortestPath) {
+            const Quaternion<Float> shortestNormalizedA = cosHalfAngle < 0.0f ? -normalizedA : normalizedA;
+            if(std::abs(cosHalfAngle) >= 1.0f - TypeTraits<Float>::epsilon()) {
+                result = (1.0f - factor)*shortestNormalizedA + factor*normalizedB;
+            } else {
+                const Float angle = std::acos(std::abs(cosHalfAngle));
+                result = (std::sin((1.0f - factor)*angle)*shortestNormalizedA + std::sin(factor*angle)*normalizedB)/std::sin(angle);
+            }
+        }
+
+        *reinterpret_cast<Quaternion<Float>*>(dst) = result;
+        a += aStride;
+        b += bStride;
+        t += tStride;
+        dst += dstStride;
+    }
+}
+
+void blendDualScalar(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const char* t, const std::ptrdiff_t tStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const DualQuaternion<Float>& normalizedA = *reinterpret_cast<const DualQuaternion<Float>*>(a);
+        const DualQuaternion<Float>& normalizedB = *reinterpret_cast<const DualQuaternion<Float>*>(b);
+        const Float factor = *reinterpret_cast<const Float*>(t);
+        const Float weightA = dot(normalizedA.real(), normalizedB.real()) < 0.0f ? factor - 1.0f : 1.0f - factor;
+
+        const Quaternion<Float> real = weightA*normalizedA.real() + factor*normalizedB.real();
+        const Quaternion<Float> dual = weightA*normalizedA.dual() + factor*normalizedB.dual();
+        const Float lengthInverted = 1.0f/real.length();
+
+        *reinterpret_cast<DualQuaternion<Float>*>(dst) = DualQuaternion<Float>{real*lengthInverted, dual*lengthInverted};
+        a += aStride;
+        b += bStride;
+        t += tStride;
+        dst += dstStride;
+    }
+}
+
+/* The SIMD variants load four quaternions at a time and transpose them so
+   each register contains one component of all four, falling back to the
+   scalar code for the remainder. Both branches of the slerp are calculated
+   and the right one picked for each lane. The arccosine approximation is
+   from Abramowitz & Stegun 4.4.46, the sine is a Taylor series up to the
+   11th power evaluated on [0, π/2], both have an error bound well below
+   10⁻⁷ on the range used. */
+constexpr Float AcosCoefficients[]{
+    1.5707963050f, -0.2145988016f, 0.0889789874f, -0.0501743046f,
+    0.0308918810f, -0.0170881256f, 0.0066700901f, -0.0012624911f
+};
+constexpr Float SinCoefficients[]{
+    -1.0f/6.0f, 1.0f/120.0f, -1.0f/5040.0f, 1.0f/362880.0f, -1.0f/39916800.0f
+};
+
+#ifdef CORRADE_ENABLE_SSE2
+struct QuaternionsSse2 {
+    __m128 x, y, z, w;
+};
+
+CORRADE_ENABLE_SSE2 inline QuaternionsSse2 loadQuaternionsSse2(const char* const data, const std::ptrdiff_t stride) {
+    QuaternionsSse2 out{
+        _mm_loadu_ps(reinterpret_cast<const Float*>(data)),
+        _mm_loadu_ps(reinterpret_cast<const Float*>(data + stride)),
+        _mm_loadu_ps(reinterpret_cast<const Float*>(data + 2*stride)),
+        _mm_loadu_ps(reinterpret_cast<const Float*>(data + 3*stride))
+    };
+    _MM_TRANSPOSE4_PS(out.x, out.y, out.z, out.w);
+    return out;
+}
+
+CORRADE_ENABLE_SSE2 inline void storeQuaternionsSse2(char* const data, const std::ptrdiff_t stride, QuaternionsSse2 q) {
+    _MM_TRANSPOSE4_PS(q.x, q.y, q.z, q.w);
+    _mm_storeu_ps(reinterpret_cast<Float*>(data), q.x);
+    _mm_storeu_ps(reinterpret_cast<Float*>(data + stride), q.y);
+    _mm_storeu_ps(reinterpret_cast<Float*>(data + 2*stride), q.z);
+    _mm_storeu_ps(reinterpret_cast<Float*>(data + 3*stride), q.w);
+}
+
+CORRADE_ENABLE_SSE2 inline __m128 loadFloatsSse2(const char* const data, const std::ptrdiff_t stride) {
+    return _mm_setr_ps(
+        *reinterpret_cast<const Float*>(data),
+        *reinterpret_cast<const Float*>(data + stride),
+        *reinterpret_cast<const Float*>(data + 2*stride),
+        *reinterpret_cast<const Float*>(data + 3*stride));
+}
+
+CORRADE_ENABLE_SSE2 inline __m128 dotSse2(const QuaternionsSse2& a, const QuaternionsSse2& b) {
+    return _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(a.x, b.x), _mm_mul_ps(a.y, b.y)), _mm_mul_ps(a.z, b.z)), _mm_mul_ps(a.w, b.w));
+}
+
+/* a*wa + b*wb */
+CORRADE_ENABLE_SSE2 inline QuaternionsSse2 combineSse2(const QuaternionsSse2& a, const __m128 wa, const QuaternionsSse2& b, const __m128 wb) {
+    return {_mm_add_ps(_mm_mul_ps(a.x, wa), _mm_mul_ps(b.x, wb)),
+            _mm_add_ps(_mm_mul_ps(a.y, wa), _mm_mul_ps(b.y, wb)),
+            _mm_add_ps(_mm_mul_ps(a.z, wa), _mm_mul_ps(b.z, wb)),
+            _mm_add_ps(_mm_mul_ps(a.w, wa), _mm_mul_ps(b.w, wb))};
+}
+
+CORRADE_ENABLE_SSE2 inline QuaternionsSse2 multiplySse2(const QuaternionsSse2& a, const __m128 b) {
+    return {_mm_mul_ps(a.x, b), _mm_mul_ps(a.y, b), _mm_mul_ps(a.z, b), _mm_mul_ps(a.w, b)};
+}
+
+CORRADE_ENABLE_SSE2 inline __m128 selectSse2(const __m128 mask, const __m128 a, const __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+CORRADE_ENABLE_SSE2 inline QuaternionsSse2 selectSse2(const __m128 mask, const QuaternionsSse2& a, const QuaternionsSse2& b) {
+    return {selectSse2(mask, a.x, b.x),
+            selectSse2(mask, a.y, b.y),
+            selectSse2(mask, a.z, b.z),
+            selectSse2(mask, a.w, b.w)};
+}
+
+/* Expects the input in [0, 1] */
+CORRADE_ENABLE_SSE2 inline __m128 acosPositiveSse2(const __m128 x) {
+    __m128 p = _mm_set1_ps(AcosCoefficients[7]);
+    for(std::size_t i = 7; i != 0; --i)
+        p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(AcosCoefficients[i - 1]));
+    return _mm_mul_ps(p, _mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.0f), x)));
+}
+
+/* Expects the input in [0, π] */
+CORRADE_ENABLE_SSE2 inline __m128 sinSse2(const __m128 x) {
+    /* sin(x) = sin(π - x), reducing the range to [0, π/2] */
+    const __m128 y = _mm_min_ps(x, _mm_sub_ps(_mm_set1_ps(Constants<Float>::pi()), x));
+    const __m128 y2 = _mm_mul_ps(y, y);
+    __m128 p = _mm_set1_ps(SinCoefficients[4]);
+    for(std::size_t i = 4; i != 0; --i)
+        p = _mm_add_ps(_mm_mul_ps(p, y2), _mm_set1_ps(SinCoefficients[i - 1]));
+    return _mm_add_ps(y, _mm_mul_ps(_mm_mul_ps(y, y2), p));
+}
+
+template<Interpolation interpolation> CORRADE_ENABLE_SSE2 void interpolateSse2(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const char* t, const std::ptrdiff_t tStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        const QuaternionsSse2 normalizedA = loadQuaternionsSse2(a, aStride);
+        const QuaternionsSse2 normalizedB = loadQuaternionsSse2(b, bStride);
+        const __m128 factor = loadFloatsSse2(t, tStride);
+        const __m128 factorA = _mm_sub_ps(one, factor);
+        const __m128 cosHalfAngle = dotSse2(normalizedA, normalizedB);
+        const __m128 cosHalfAngleSign = _mm_and_ps(cosHalfAngle, signMask);
+        const __m128 absCosHalfAngle = _mm_xor_ps(cosHalfAngle, cosHalfAngleSign);
+
+        /* Negating the weight instead of the whole quaternion for the
+           shortest path. Unlike the scalar code this flips also -0.0f, which
+           doesn't matter. */
+        const __m128 shortestFactorA = _mm_xor_ps(factorA, cosHalfAngleSign);
+        const QuaternionsSse2 linear = combineSse2(normalizedA,
+            interpolation == Interpolation::Lerp ? factorA : shortestFactorA,
+            normalizedB, factor);
+
+        QuaternionsSse2 result;
+        if(interpolation == Interpolation::Lerp || interpolation == Interpolation::LerpShortestPath) {
+            result = multiplySse2(linear, _mm_div_ps(one, _mm_sqrt_ps(dotSse2(linear, linear))));
+        } else {
+            /* For the non-shortest slerp the angle is calculated from the
+               signed cosine, acos(-x) = π - acos(x) */
+            __m128 angle = acosPositiveSse2(absCosHalfAngle);
+            if(interpolation == Interpolation::Slerp)
+                angle = selectSse2(_mm_cmplt_ps(cosHalfAngle, _mm_setzero_ps()),
+                    _mm_sub_ps(_mm_set1_ps(Constants<Float>::pi()), angle), angle);
+
+            /* The sine of the angle is never negative. Calculating
+               1 - cos² as (1 - |cos|)(1 + |cos|) to avoid catastrophic
+               cancellation for small angles. */
+            const __m128 sinAngleInverted = _mm_div_ps(one, _mm_sqrt_ps(_mm_mul_ps(_mm_sub_ps(one, absCosHalfAngle), _mm_add_ps(one, absCosHalfAngle))));
+            const QuaternionsSse2 spherical = combineSse2(normalizedA,
+                _mm_xor_ps(_mm_mul_ps(sinSse2(_mm_mul_ps(factorA, angle)), sinAngleInverted),
+                    interpolation == Interpolation::Slerp ? _mm_setzero_ps() : cosHalfAngleSign),
+                normalizedB,
+                _mm_mul_ps(sinSse2(_mm_mul_ps(factor, angle)), sinAngleInverted));
+
+            const __m128 isLinear = interpolation == Interpolation::Slerp ?
+                _mm_cmpgt_ps(absCosHalfAngle, _mm_set1_ps(1.0f - 0.5f*TypeTraits<Float>::epsilon())) :
+                _mm_cmpge_ps(absCosHalfAngle, _mm_set1_ps(1.0f - TypeTraits<Float>::epsilon()));
+            result = selectSse2(isLinear, linear, spherical);
+        }
+
+        storeQuaternionsSse2(dst, dstStride, result);
+        a += 4*aStride;
+        b += 4*bStride;
+        t += 4*tStride;
+        dst += 4*dstStride;
+    }
+
+    interpolateScalar<interpolation>(a, aStride, b, bStride, t, tStride, dst, dstStride, size - i);
+}
+
+CORRADE_ENABLE_SSE2 void blendDualSse2(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const char* t, const std::ptrdiff_t tStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        const QuaternionsSse2 realA = loadQuaternionsSse2(a, aStride);
+        const QuaternionsSse2 dualA = loadQuaternionsSse2(a + sizeof(Quaternion<Float>), aStride);
+        const QuaternionsSse2 realB = loadQuaternionsSse2(b, bStride);
+        const QuaternionsSse2 dualB = loadQuaternionsSse2(b + sizeof(Quaternion<Float>), bStride);
+        const __m128 factor = loadFloatsSse2(t, tStride);
+        const __m128 factorA = _mm_xor_ps(_mm_sub_ps(one, factor),
+            _mm_and_ps(dotSse2(realA, realB), signMask));
+
+        const QuaternionsSse2 real = combineSse2(realA, factorA, realB, factor);
+        const QuaternionsSse2 dual = combineSse2(dualA, factorA, dualB, factor);
+        const __m128 lengthInverted = _mm_div_ps(one, _mm_sqrt_ps(dotSse2(real, real)));
+
+        storeQuaternionsSse2(dst, dstStride, multiplySse2(real, lengthInverted));
+        storeQuaternionsSse2(dst + sizeof(Quaternion<Float>), dstStride, multiplySse2(dual, lengthInverted));
+        a += 4*aStride;
+        b += 4*bStride;
+        t += 4*tStride;
+        dst += 4*dstStride;
+    }
+
+    blendDualScalar(a, aStride, b, bStride, t, tStride, dst, dstStride, size - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_NEON
+struct QuaternionsNeon {
+    float32x4_t x, y, z, w;
+};
+
+CORRADE_ENABLE_NEON inline QuaternionsNeon transposeNeon(const float32x4_t a, const float32x4_t b, const float32x4_t c, const float32x4_t d) {
+    const float32x4x2_t ab = vtrnq_f32(a, b);
+    const float32x4x2_t cd = vtrnq_f32(c, d);
+    return {vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0])),
+            vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1])),
+            vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0])),
+            vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]))};
+}
+
+CORRADE_ENABLE_NEON inline QuaternionsNeon loadQuaternionsNeon(const char* const data, const std::ptrdiff_t stride) {
+    return transposeNeon(
+        vld1q_f32(reinterpret_cast<const Float*>(data)),
+        vld1q_f32(reinterpret_cast<const Float*>(data + stride)),
+        vld1q_f32(reinterpret_cast<const Float*>(data + 2*stride)),
+        vld1q_f32(reinterpret_cast<const Float*>(data + 3*stride)));
+}
+
+CORRADE_ENABLE_NEON inline void storeQuaternionsNeon(char* const data, const std::ptrdiff_t stride, const QuaternionsNeon& q) {
+    const QuaternionsNeon out = transposeNeon(q.x, q.y, q.z, q.w);
+    vst1q_f32(reinterpret_cast<Float*>(data), out.x);
+    vst1q_f32(reinterpret_cast<Float*>(data + stride), out.y);
+    vst1q_f32(reinterpret_cast<Float*>(data + 2*stride), out.z);
+    vst1q_f32(reinterpret_cast<Float*>(data + 3*stride), out.w);
+}
+
+CORRADE_ENABLE_NEON inline float32x4_t loadFloatsNeon(const char* const data, const std::ptrdiff_t stride) {
+    const Float out[4]{
+        *reinterpret_cast<const Float*>(data),
+        *reinterpret_cast<const Float*>(data + stride),
+        *reinterpret_cast<const Float*>(data + 2*stride),
+        *reinterpret_cast<const Float*>(data + 3*stride)
+    };
+    return vld1q_f32(out);
+}
+
+CORRADE_ENABLE_NEON inline float32x4_t dotNeon(const QuaternionsNeon& a, const QuaternionsNeon& b) {
+    return vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(a.x, b.x), vmulq_f32(a.y, b.y)), vmulq_f32(a.z, b.z)), vmulq_f32(a.w, b.w));
+}
+
+/* a*wa + b*wb */
+CORRADE_ENABLE_NEON inline QuaternionsNeon combineNeon(const QuaternionsNeon& a, const float32x4_t wa, const QuaternionsNeon& b, const float32x4_t wb) {
+    return {vaddq_f32(vmulq_f32(a.x, wa), vmulq_f32(b.x, wb)),
+            vaddq_f32(vmulq_f32(a.y, wa), vmulq_f32(b.y, wb)),
+            vaddq_f32(vmulq_f32(a.z, wa), vmulq_f32(b.z, wb)),
+            vaddq_f32(vmulq_f32(a.w, wa), vmulq_f32(b.w, wb))};
+}
+
+CORRADE_ENABLE_NEON inline QuaternionsNeon multiplyNeon(const QuaternionsNeon& a, const float32x4_t b) {
+    return {vmulq_f32(a.x, b), vmulq_f32(a.y, b), vmulq_f32(a.z, b), vmulq_f32(a.w, b)};
+}
+
+CORRADE_ENABLE_NEON inline QuaternionsNeon selectNeon(const uint32x4_t mask, const QuaternionsNeon& a, const QuaternionsNeon& b) {
+    return {vbslq_f32(mask, a.x, b.x),
+            vbslq_f32(mask, a.y, b.y),
+            vbslq_f32(mask, a.z, b.z),
+            vbslq_f32(mask, a.w, b.w)};
+}
+
+/* Flips the sign of a where the sign bit is set in sign */
+CORRADE_ENABLE_NEON inline float32x4_t flipSignNeon(const float32x4_t a, const uint32x4_t sign) {
+    return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), sign));
+}
+
+/* Division and square root through reciprocal estimates with two
+   Newton-Raphson steps, as ARMv7 NEON has neither */
+CORRADE_ENABLE_NEON inline float32x4_t reciprocalNeon(const float32x4_t a) {
+    float32x4_t r = vrecpeq_f32(a);
+    r = vmulq_f32(vrecpsq_f32(a, r), r);
+    return vmulq_f32(vrecpsq_f32(a, r), r);
+}
+
+CORRADE_ENABLE_NEON inline float32x4_t sqrtInvertedNeon(const float32x4_t a) {
+    float32x4_t r = vrsqrteq_f32(a);
+    r = vmulq_f32(vrsqrtsq_f32(vmulq_f32(a, r), r), r);
+    return vmulq_f32(vrsqrtsq_f32(vmulq_f32(a, r), r), r);
+}
+
+/* Expects the input in [0, 1]. The square root of 1 - x is calculated as
+   (1 - x)/sqrt(1 - x), with a special case for 1 - x = 0 which would
+   otherwise result in a NaN. */
+CORRADE_ENABLE_NEON inline float32x4_t acosPositiveNeon(const float32x4_t x) {
+    float32x4_t p = vdupq_n_f32(AcosCoefficients[7]);
+    for(std::size_t i = 7; i != 0; --i)
+        p = vaddq_f32(vmulq_f32(p, x), vdupq_n_f32(AcosCoefficients[i - 1]));
+    const float32x4_t oneMinusX = vsubq_f32(vdupq_n_f32(1.0f), x);
+    const float32x4_t sqrtOneMinusX = vbslq_f32(vceqq_f32(oneMinusX, vdupq_n_f32(0.0f)), vdupq_n_f32(0.0f), vmulq_f32(oneMinusX, sqrtInvertedNeon(oneMinusX)));
+    return vmulq_f32(p, sqrtOneMinusX);
+}
+
+/* Expects the input in [0, π] */
+CORRADE_ENABLE_NEON inline float32x4_t sinNeon(const float32x4_t x) {
+    /* sin(x) = sin(π - x), reducing the range to [0, π/2] */
+    const float32x4_t y = vminq_f32(x, vsubq_f32(vdupq_n_f32(Constants<Float>::pi()), x));
+    const float32x4_t y2 = vmulq_f32(y, y);
+    float32x4_t p = vdupq_n_f32(SinCoefficients[4]);
+    for(std::size_t i = 4; i != 0; --i)
+        p = vaddq_f32(vmulq_f32(p, y2), vdupq_n_f32(SinCoefficients[i - 1]));
+    return vaddq_f32(y, vmulq_f32(vmulq_f32(y, y2), p));
+}
+
+template<Interpolation interpolation> CORRADE_ENABLE_NEON void interpolateNeon(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const char* t, const std::ptrdiff_t tStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    const uint32x4_t signMask = vdupq_n_u32(0x80000000u);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        const QuaternionsNeon normalizedA = loadQuaternionsNeon(a, aStride);
+        const QuaternionsNeon normalizedB = loadQuaternionsNeon(b, bStride);
+        const float32x4_t factor = loadFloatsNeon(t, tStride);
+        const float32x4_t factorA = vsubq_f32(one, factor);
+        const float32x4_t cosHalfAngle = dotNeon(normalizedA, normalizedB);
+        const uint32x4_t cosHalfAngleSign = vandq_u32(vreinterpretq_u32_f32(cosHalfAngle), signMask);
+        const float32x4_t absCosHalfAngle = vabsq_f32(cosHalfAngle);
+
+        /* Negating the weight instead of the whole quaternion for the
+           shortest path, same as in the SSE2 variant */
+        const QuaternionsNeon linear = combineNeon(normalizedA,
+            interpolation == Interpolation::Lerp ? factorA : flipSignNeon(factorA, cosHalfAngleSign),
+            normalizedB, factor);
+
+        QuaternionsNeon result;
+        if(interpolation == Interpolation::Lerp || interpolation == Interpolation::LerpShortestPath) {
+            result = multiplyNeon(linear, sqrtInvertedNeon(dotNeon(linear, linear)));
+        } else {
+            /* For the non-shortest slerp the angle is calculated from the
+               signed cosine, acos(-x) = π - acos(x) */
+            float32x4_t angle = acosPositiveNeon(absCosHalfAngle);
+            if(interpolation == Interpolation::Slerp)
+                angle = vbslq_f32(vcltq_f32(cosHalfAngle, vdupq_n_f32(0.0f)),
+                    vsubq_f32(vdupq_n_f32(Constants<Float>::pi()), angle), angle);
+
+            /* The sine of the angle is never negative, same as in the SSE2
+               variant */
+            const float32x4_t sinAngleInverted = sqrtInvertedNeon(vmulq_f32(vsubq_f32(one, absCosHalfAngle), vaddq_f32(one, absCosHalfAngle)));
+            const float32x4_t weightA = vmulq_f32(sinNeon(vmulq_f32(factorA, angle)), sinAngleInverted);
+            const QuaternionsNeon spherical = combineNeon(normalizedA,
+                interpolation == Interpolation::Slerp ? weightA : flipSignNeon(weightA, cosHalfAngleSign),
+                normalizedB,
+                vmulq_f32(sinNeon(vmulq_f32(factor, angle)), sinAngleInverted));
+
+            const uint32x4_t isLinear = interpolation == Interpolation::Slerp ?
+                vcgtq_f32(absCosHalfAngle, vdupq_n_f32(1.0f - 0.5f*TypeTraits<Float>::epsilon())) :
+                vcgeq_f32(absCosHalfAngle, vdupq_n_f32(1.0f - TypeTraits<Float>::epsilon()));
+            result = selectNeon(isLinear, linear, spherical);
+        }
+
+        storeQuaternionsNeon(dst, dstStride, result);
+        a += 4*aStride;
+        b += 4*bStride;
+        t += 4*tStride;
+        dst += 4*dstStride;
+    }
+
+    interpolateScalar<interpolation>(a, aStride, b, bStride, t, tStride, dst, dstStride, size - i);
+}
+
+CORRADE_ENABLE_NEON void blendDualNeon(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const char* t, const std::ptrdiff_t tStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    const uint32x4_t signMask = vdupq_n_u32(0x80000000u);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+
+    std::size_t i = 0;
+    for(; i + 4 <= size; i += 4) {
+        const QuaternionsNeon realA = loadQuaternionsNeon(a, aStride);
+        const QuaternionsNeon dualA = loadQuaternionsNeon(a + sizeof(Quaternion<Float>), aStride);
+        const QuaternionsNeon realB = loadQuaternionsNeon(b, bStride);
+        const QuaternionsNeon dualB = loadQuaternionsNeon(b + sizeof(Quaternion<Float>), bStride);
+        const float32x4_t factor = loadFloatsNeon(t, tStride);
+        const float32x4_t factorA = flipSignNeon(vsubq_f32(one, factor),
+            vandq_u32(vreinterpretq_u32_f32(dotNeon(realA, realB)), signMask));
+
+        const QuaternionsNeon real = combineNeon(realA, factorA, realB, factor);
+        const QuaternionsNeon dual = combineNeon(dualA, factorA, dualB, factor);
+        const float32x4_t lengthInverted = sqrtInvertedNeon(dotNeon(real, real));
+
+        storeQuaternionsNeon(dst, dstStride, multiplyNeon(real, lengthInverted));
+        storeQuaternionsNeon(dst + sizeof(Quaternion<Float>), dstStride, multiplyNeon(dual, lengthInverted));
+        a += 4*aStride;
+        b += 4*bStride;
+        t += 4*tStride;
+        dst += 4*dstStride;
+    }
+
+    blendDualScalar(a, aStride, b, bStride, t, tStride, dst, dstStride, size - i);
+}
+#endif
+
+struct Kernels {
+    InterpolateFunction lerp;
+    InterpolateFunction lerpShortestPath;
+    InterpolateFunction slerp;
+    InterpolateFunction slerpShortestPath;
+    InterpolateFunction blendDual;
+};
+
+Kernels kernelsFor(const Cpu::Features features) {
+    Kernels out{
+        interpolateScalar<Interpolation::Lerp>,
+        interpolateScalar<Interpolation::LerpShortestPath>,
+        interpolateScalar<Interpolation::Slerp>,
+        interpolateScalar<Interpolation::SlerpShortestPath>,
+        blendDualScalar
+    };
+
+    #ifdef CORRADE_ENABLE_SSE2
+    if(features & Cpu::Sse2) {
+        out.lerp = interpolateSse2<Interpolation::Lerp>;
+        out.lerpShortestPath = interpolateSse2<Interpolation::LerpShortestPath>;
+        out.slerp = interpolateSse2<Interpolation::Slerp>;
+        out.slerpShortestPath = interpolateSse2<Interpolation::SlerpShortestPath>;
+        out.blendDual = blendDualSse2;
+    }
+    #endif
+    #ifdef CORRADE_ENABLE_NEON
+    if(features & Cpu::Neon) {
+        out.lerp = interpolateNeon<Interpolation::Lerp>;
+        out.lerpShortestPath = interpolateNeon<Interpolation::LerpShortestPath>;
+        out.slerp = interpolateNeon<Interpolation::Slerp>;
+        out.slerpShortestPath = interpolateNeon<Interpolation::SlerpShortestPath>;
+        out.blendDual = blendDualNeon;
+    }
+    #endif
+
+    /* Silence unused variable warnings on platforms with no SIMD variant */
+    static_cast<void>(features);
+
+    return out;
+}
+
+const Kernels& kernels() {
+    /* Picked on first use, the static initialization is thread-safe */
+    static const Kernels out = kernelsFor(Cpu::runtimeFeatures());
+    return out;
+}
+
+}
+
+void lerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size(),
+        "Math::lerpInto(): expected second view to have" << normalizedA.size() << "items but got" << normalizedB.size(), );
+    CORRADE_ASSERT(normalizedA.size() == t.size(),
+        "Math::lerpInto(): expected interpolation phase view to have" << normalizedA.size() << "items but got" << t.size(), );
+    CORRADE_ASSERT(normalizedA.size() == dst.size(),
+        "Math::lerpInto(): wrong destination size, got" << dst.size() << "but expected" << normalizedA.size(), );
+
+    kernels().lerp(static_cast<const char*>(normalizedA.data()), normalizedA.stride(), static_cast<const char*>(normalizedB.data()), normalizedB.stride(), static_cast<const char*>(t.data()), t.stride(), static_cast<char*>(dst.data()), dst.stride(), normalizedA.size());
+}
+
+void lerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size(),
+        "Math::lerpShortestPathInto(): expected second view to have" << normalizedA.size() << "items but got" << normalizedB.size(), );
+    CORRADE_ASSERT(normalizedA.size() == t.size(),
+        "Math::lerpShortestPathInto(): expected interpolation phase view to have" << normalizedA.size() << "items but got" << t.size(), );
+    CORRADE_ASSERT(normalizedA.size() == dst.size(),
+        "Math::lerpShortestPathInto(): wrong destination size, got" << dst.size() << "but expected" << normalizedA.size(), );
+
+    kernels().lerpShortestPath(static_cast<const char*>(normalizedA.data()), normalizedA.stride(), static_cast<const char*>(normalizedB.data()), normalizedB.stride(), static_cast<const char*>(t.data()), t.stride(), static_cast<char*>(dst.data()), dst.stride(), normalizedA.size());
+}
+
+void slerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size(),
+        "Math::slerpInto(): expected second view to have" << normalizedA.size() << "items but got" << normalizedB.size(), );
+    CORRADE_ASSERT(normalizedA.size() == t.size(),
+        "Math::slerpInto(): expected interpolation phase view to have" << normalizedA.size() << "items but got" << t.size(), );
+    CORRADE_ASSERT(normalizedA.size() == dst.size(),
+        "Math::slerpInto(): wrong destination size, got" << dst.size() << "but expected" << normalizedA.size(), );
+
+    kernels().slerp(static_cast<const char*>(normalizedA.data()), normalizedA.stride(), static_cast<const char*>(normalizedB.data()), normalizedB.stride(), static_cast<const char*>(t.data()), t.stride(), static_cast<char*>(dst.data()), dst.stride(), normalizedA.size());
+}
+
+void slerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size(),
+        "Math::slerpShortestPathInto(): expected second view to have" << normalizedA.size() << "items but got" << normalizedB.size(), );
+    CORRADE_ASSERT(normalizedA.size() == t.size(),
+        "Math::slerpShortestPathInto(): expected interpolation phase view to have" << normalizedA.size() << "items but got" << t.size(), );
+    CORRADE_ASSERT(normalizedA.size() == dst.size(),
+        "Math::slerpShortestPathInto(): wrong destination size, got" << dst.size() << "but expected" << normalizedA.size(), );
+
+    kernels().slerpShortestPath(static_cast<const char*>(normalizedA.data()), normalizedA.stride(), static_cast<const char*>(normalizedB.data()), normalizedB.stride(), static_cast<const char*>(t.data()), t.stride(), static_cast<char*>(dst.data()), dst.stride(), normalizedA.size());
+}
+
+void lerpShortestPathInto(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const DualQuaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<DualQuaternion<Float>>& dst) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size(),
+        "Math::lerpShortestPathInto(): expected second view to have" << normalizedA.size() << "items but got" << normalizedB.size(), );
+    CORRADE_ASSERT(normalizedA.size() == t.size(),
+        "Math::lerpShortestPathInto(): expected interpolation phase view to have" << normalizedA.size() << "items but got" << t.size(), );
+    CORRADE_ASSERT(normalizedA.size() == dst.size(),
+        "Math::lerpShortestPathInto(): wrong destination size, got" << dst.size() << "but expected" << normalizedA.size(), );
+
+    kernels().blendDual(static_cast<const char*>(normalizedA.data()), normalizedA.stride(), static_cast<const char*>(normalizedB.data()), normalizedB.stride(), static_cast<const char*>(t.data()), t.stride(), static_cast<char*>(dst.data()), dst.stride(), normalizedA.size());
+}
+
+}}
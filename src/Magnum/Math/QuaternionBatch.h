@@ -0,0 +1,147 @@
+#ifndef Magnum_Math_QuaternionBatch_h
+#define Magnum_Math_QuaternionBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::lerpInto(), @ref Magnum::Math::lerpShortestPathInto(), @ref Magnum::Math::slerpInto(), @ref Magnum::Math::slerpShortestPathInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@{ @name Batch quaternion interpolation functions
+
+These functions interpolate an unbounded range of quaternion or dual quaternion
+pairs, as opposed to single values. The implementation is picked at runtime on
+first use based on instruction sets available on the CPU, with a SSE2 variant
+on x86 and a NEON variant on ARM, processing four items at a time.
+
+To interpolate all items with the same phase, pass a view with a zero stride
+as the @p t parameter, for example using
+@relativeref{Corrade,Containers::StridedArrayView::broadcasted()}. All views
+are allowed to have arbitrary strides. The @p dst view is allowed to be the same
+as @p normalizedA or @p normalizedB to perform the operation in-place, partial
+overlaps are not allowed. Unlike the single-value variants, the inputs are not
+checked for being normalized.
+*/
+
+/**
+@brief Normalized linear interpolation of quaternion pairs
+@param[in]  normalizedA First quaternions
+@param[in]  normalizedB Second quaternions
+@param[in]  t           Interpolation phases (from range @f$ [0; 1] @f$)
+@param[out] dst         Destination quaternions
+@m_since_latest
+
+Equivalent to calling @ref lerp(const Quaternion<T>&, const Quaternion<T>&, T)
+for all items. Expects that all views have the same size.
+*/
+MAGNUM_EXPORT void lerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst);
+
+/**
+@brief Normalized linear shortest-path interpolation of quaternion pairs
+@param[in]  normalizedA First quaternions
+@param[in]  normalizedB Second quaternions
+@param[in]  t           Interpolation phases (from range @f$ [0; 1] @f$)
+@param[out] dst         Destination quaternions
+@m_since_latest
+
+Equivalent to calling @ref lerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T)
+for all items. Expects that all views have the same size.
+*/
+MAGNUM_EXPORT void lerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst);
+
+/**
+@brief Spherical linear interpolation of quaternion pairs
+@param[in]  normalizedA First quaternions
+@param[in]  normalizedB Second quaternions
+@param[in]  t           Interpolation phases (from range @f$ [0; 1] @f$)
+@param[out] dst         Destination quaternions
+@m_since_latest
+
+Equivalent to calling @ref slerp(const Quaternion<T>&, const Quaternion<T>&, T)
+for all items. Expects that all views have the same size. The SIMD variants
+use polynomial approximations of @f$ \arccos @f$ and @f$ \sin @f$ instead of
+the standard library functions, with a maximal error in the order of
+@f$ 10^{-6} @f$ compared to the single-value variant.
+*/
+MAGNUM_EXPORT void slerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst);
+
+/**
+@brief Spherical linear shortest-path interpolation of quaternion pairs
+@param[in]  normalizedA First quaternions
+@param[in]  normalizedB Second quaternions
+@param[in]  t           Interpolation phases (from range @f$ [0; 1] @f$)
+@param[out] dst         Destination quaternions
+@m_since_latest
+
+Equivalent to calling @ref slerpShortestPath(const Quaternion<T>&, const Quaternion<T>&, T)
+for all items. Expects that all views have the same size. The SIMD variants
+have the same precision as in @ref slerpInto().
+*/
+MAGNUM_EXPORT void slerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst);
+
+/**
+@brief Linear shortest-path blending of dual quaternion pairs
+@param[in]  normalizedA First dual quaternions
+@param[in]  normalizedB Second dual quaternions
+@param[in]  t           Interpolation phases (from range @f$ [0; 1] @f$)
+@param[out] dst         Destination dual quaternions
+@m_since_latest
+
+Performs a dual quaternion linear blend, commonly used for skinning as a cheap
+alternative to @ref sclerpShortestPath(). The first dual quaternion is negated
+if the real parts point in opposite directions, and the result is normalized by
+the length of its real part: @f[
+    \begin{array}{rcl}
+        d & = & q_{A_0} \cdot q_{B_0} \\[5pt]
+        \hat q'_A & = & \begin{cases}
+                \phantom{-}\hat q_A, & d \ge 0 \\
+                -\hat q_A, & d < 0
+            \end{cases} \\[15pt]
+        \hat q_{DLB} & = & \cfrac{(1 - t) \hat q'_A + t \hat q_B}{|(1 - t) q'_{A_0} + t q_{B_0}|}
+    \end{array}
+@f]
+
+Expects that all views have the same size.
+@see @ref lerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>&, const Containers::StridedArrayView1D<const Quaternion<Float>>&, const Containers::StridedArrayView1D<const Float>&, const Containers::StridedArrayView1D<Quaternion<Float>>&)
+*/
+MAGNUM_EXPORT void lerpShortestPathInto(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const DualQuaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<DualQuaternion<Float>>& dst);
+
+/**
+ * @}
+ */
+
+}}
+
+#endif
@@ -0,0 +1,224 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/BitVector.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct BitVectorBenchmark: TestSuite::Tester {
+    explicit BitVectorBenchmark();
+
+    void allBaseline();
+    void all();
+    void noneBaseline();
+    void none();
+    void countBaseline();
+    void count();
+    void bitAndBaseline();
+    void bitAnd();
+    void compareBaseline();
+    void compare();
+    void iterateBaseline();
+    void iterate();
+};
+
+/* A culling mask for a moderately sized scene */
+typedef Math::BitVector<4096> Mask;
+
+enum: std::size_t { Repeats = 100 };
+
+BitVectorBenchmark::BitVectorBenchmark() {
+    addBenchmarks({&BitVectorBenchmark::allBaseline,
+                   &BitVectorBenchmark::all,
+                   &BitVectorBenchmark::noneBaseline,
+                   &BitVectorBenchmark::none,
+                   &BitVectorBenchmark::countBaseline,
+                   &BitVectorBenchmark::count,
+                   &BitVectorBenchmark::bitAndBaseline,
+                   &BitVectorBenchmark::bitAnd,
+                   &BitVectorBenchmark::compareBaseline,
+                   &BitVectorBenchmark::compare,
+                   &BitVectorBenchmark::iterateBaseline,
+                   &BitVectorBenchmark::iterate}, 100);
+}
+
+/* A sparse mask with every 61st bit set */
+Mask sparseMask() {
+    Mask out;
+    for(std::size_t i = 0; i < Mask::Size; i += 61)
+        out.set(i);
+    return out;
+}
+
+/* The baselines replicate the original byte-by-byte implementation or, for
+   operations that didn't exist before, a loop over all bits */
+
+void BitVectorBenchmark::allBaseline() {
+    const Mask a{true};
+
+    bool out = true;
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Mask::DataSize; ++i)
+            out = out && a.data()[i] == 0xff;
+    }
+
+    CORRADE_VERIFY(out);
+}
+
+void BitVectorBenchmark::all() {
+    const Mask a{true};
+
+    bool out = true;
+    CORRADE_BENCHMARK(Repeats) {
+        out = out && a.all();
+    }
+
+    CORRADE_VERIFY(out);
+}
+
+void BitVectorBenchmark::noneBaseline() {
+    const Mask a;
+
+    bool out = true;
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Mask::DataSize; ++i)
+            out = out && !a.data()[i];
+    }
+
+    CORRADE_VERIFY(out);
+}
+
+void BitVectorBenchmark::none() {
+    const Mask a;
+
+    bool out = true;
+    CORRADE_BENCHMARK(Repeats) {
+        out = out && a.none();
+    }
+
+    CORRADE_VERIFY(out);
+}
+
+void BitVectorBenchmark::countBaseline() {
+    const Mask a = sparseMask();
+
+    std::size_t out = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Mask::Size; ++i)
+            out += a[i];
+    }
+
+    CORRADE_COMPARE(out, Repeats*a.count());
+}
+
+void BitVectorBenchmark::count() {
+    const Mask a = sparseMask();
+
+    std::size_t out = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        out += a.count();
+    }
+
+    CORRADE_COMPARE(out, Repeats*68);
+}
+
+void BitVectorBenchmark::bitAndBaseline() {
+    const Mask a = sparseMask();
+    Mask out{true};
+
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Mask::DataSize; ++i)
+            out.data()[i] &= a.data()[i];
+    }
+
+    CORRADE_COMPARE(out, a);
+}
+
+void BitVectorBenchmark::bitAnd() {
+    const Mask a = sparseMask();
+    Mask out{true};
+
+    CORRADE_BENCHMARK(Repeats) {
+        out &= a;
+    }
+
+    CORRADE_COMPARE(out, a);
+}
+
+void BitVectorBenchmark::compareBaseline() {
+    const Mask a = sparseMask();
+    const Mask b = sparseMask();
+
+    bool out = true;
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Mask::DataSize; ++i)
+            out = out && a.data()[i] == b.data()[i];
+    }
+
+    CORRADE_VERIFY(out);
+}
+
+void BitVectorBenchmark::compare() {
+    const Mask a = sparseMask();
+    const Mask b = sparseMask();
+
+    bool out = true;
+    CORRADE_BENCHMARK(Repeats) {
+        out = out && a == b;
+    }
+
+    CORRADE_VERIFY(out);
+}
+
+void BitVectorBenchmark::iterateBaseline() {
+    const Mask a = sparseMask();
+
+    std::size_t out = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Mask::Size; ++i)
+            if(a[i]) out += i;
+    }
+
+    CORRADE_COMPARE(out, Repeats*138958);
+}
+
+void BitVectorBenchmark::iterate() {
+    const Mask a = sparseMask();
+
+    std::size_t out = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = a.firstSet(); i != Mask::Size; i = a.nextSet(i + 1))
+            out += i;
+    }
+
+    CORRADE_COMPARE(out, Repeats*138958);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::BitVectorBenchmark)
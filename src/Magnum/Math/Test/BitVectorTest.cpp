@@ -72,10 +72,18 @@ struct BitVectorTest: TestSuite::Tester {
     void all();
     void none();
     void any();
+    void count();
+    void firstNextSet();
+
+    void compareLarge();
+    void allNoneAnyLarge();
+    void countLarge();
+    void firstNextSetLarge();
 
     void bitInverse();
     void bitAndOrXor();
     void booleanOperationEquivalents();
+    void bitOperationsLarge();
 
     void strictWeakOrdering();
 
@@ -87,6 +95,9 @@ static_assert(BitVector<16>::DataSize == 2, "Improper DataSize");
 static_assert(BitVector<17>::DataSize == 3, "Improper DataSize");
 
 typedef Math::BitVector<19> BitVector19;
+/* Two full 64-bit words, a partial word with two full bytes and a partial
+   byte, to test all code paths */
+typedef Math::BitVector<64*2 + 19> BitVector147;
 
 BitVectorTest::BitVectorTest() {
     addTests({&BitVectorTest::construct,
@@ -105,10 +116,18 @@ BitVectorTest::BitVectorTest() {
               &BitVectorTest::all,
               &BitVectorTest::none,
               &BitVectorTest::any,
+              &BitVectorTest::count,
+              &BitVectorTest::firstNextSet,
+
+              &BitVectorTest::compareLarge,
+              &BitVectorTest::allNoneAnyLarge,
+              &BitVectorTest::countLarge,
+              &BitVectorTest::firstNextSetLarge,
 
               &BitVectorTest::bitInverse,
               &BitVectorTest::bitAndOrXor,
               &BitVectorTest::booleanOperationEquivalents,
+              &BitVectorTest::bitOperationsLarge,
 
               &BitVectorTest::strictWeakOrdering,
 
@@ -313,6 +332,109 @@ void BitVectorTest::any() {
     CORRADE_VERIFY(!BitVector19(0x00, 0x00, 0x08).any());
 }
 
+void BitVectorTest::count() {
+    CORRADE_COMPARE(BitVector19(0x00, 0x00, 0x00).count(), 0);
+    CORRADE_COMPARE(BitVector19(0xa5, 0x5f, 0x03).count(), 12);
+
+    /* Bits in the unused part of last segment are ignored */
+    CORRADE_COMPARE(BitVector19(0xff, 0xff, 0xff).count(), 19);
+}
+
+void BitVectorTest::firstNextSet() {
+    BitVector19 a(0x00, 0x81, 0x04);
+    CORRADE_COMPARE(a.firstSet(), 8);
+    CORRADE_COMPARE(a.nextSet(8), 8);
+    CORRADE_COMPARE(a.nextSet(9), 15);
+    CORRADE_COMPARE(a.nextSet(16), 18);
+    CORRADE_COMPARE(a.nextSet(19), 19);
+    CORRADE_COMPARE(a.nextSet(1000), 19);
+
+    /* Bits in the unused part of last segment are ignored */
+    CORRADE_COMPARE(BitVector19(0x00, 0x00, 0xf8).firstSet(), 19);
+    CORRADE_COMPARE(BitVector19(0x00, 0x00, 0x00).firstSet(), 19);
+
+    /* Iterating */
+    std::size_t positions[4];
+    std::size_t count = 0;
+    for(std::size_t i = a.firstSet(); i != BitVector19::Size; i = a.nextSet(i + 1))
+        positions[count++] = i;
+    CORRADE_COMPARE(count, 3);
+    CORRADE_COMPARE(positions[0], 8);
+    CORRADE_COMPARE(positions[1], 15);
+    CORRADE_COMPARE(positions[2], 18);
+}
+
+void BitVectorTest::compareLarge() {
+    BitVector147 a;
+    a.set(3).set(70).set(130).set(146);
+    CORRADE_VERIFY(a == a);
+
+    /* Change in a full word, in the partial word and in the last bit */
+    CORRADE_VERIFY(a != BitVector147{a}.set(5));
+    CORRADE_VERIFY(a != BitVector147{a}.reset(130));
+    CORRADE_VERIFY(a != BitVector147{a}.reset(146));
+
+    /* Change in unused part of last segment */
+    BitVector147 b = a;
+    b.data()[BitVector147::DataSize - 1] |= 0xf0;
+    CORRADE_VERIFY(a == b);
+}
+
+void BitVectorTest::allNoneAnyLarge() {
+    BitVector147 a{true};
+    CORRADE_VERIFY(a.all());
+    CORRADE_VERIFY(!a.none());
+    CORRADE_VERIFY(a.any());
+
+    /* A single bit missing in a full word and in the partial word */
+    CORRADE_VERIFY(!BitVector147{a}.reset(63).all());
+    CORRADE_VERIFY(!BitVector147{a}.reset(140).all());
+
+    BitVector147 b;
+    CORRADE_VERIFY(!b.all());
+    CORRADE_VERIFY(b.none());
+    CORRADE_VERIFY(!b.any());
+
+    /* Single bit set in a full word and in the partial word */
+    CORRADE_VERIFY(BitVector147{b}.set(64).any());
+    CORRADE_VERIFY(BitVector147{b}.set(146).any());
+
+    /* Bits in the unused part of last segment are ignored */
+    b.data()[BitVector147::DataSize - 1] = 0xf8;
+    CORRADE_VERIFY(b.none());
+    a.data()[BitVector147::DataSize - 1] = 0x07;
+    CORRADE_VERIFY(a.all());
+}
+
+void BitVectorTest::countLarge() {
+    BitVector147 a{true};
+    CORRADE_COMPARE(a.count(), 147);
+
+    a.reset(0).reset(64).reset(127).reset(128).reset(146);
+    CORRADE_COMPARE(a.count(), 142);
+
+    /* Bits in the unused part of last segment are ignored */
+    a.data()[BitVector147::DataSize - 1] = 0xff;
+    CORRADE_COMPARE(a.count(), 143);
+}
+
+void BitVectorTest::firstNextSetLarge() {
+    BitVector147 a;
+    CORRADE_COMPARE(a.firstSet(), 147);
+
+    /* Bits in the unused part of last segment are ignored */
+    a.data()[BitVector147::DataSize - 1] = 0xf8;
+    CORRADE_COMPARE(a.firstSet(), 147);
+
+    a.set(0).set(63).set(64).set(129).set(146);
+    CORRADE_COMPARE(a.firstSet(), 0);
+    CORRADE_COMPARE(a.nextSet(1), 63);
+    CORRADE_COMPARE(a.nextSet(64), 64);
+    CORRADE_COMPARE(a.nextSet(65), 129);
+    CORRADE_COMPARE(a.nextSet(130), 146);
+    CORRADE_COMPARE(a.nextSet(147), 147);
+}
+
 void BitVectorTest::bitInverse() {
     CORRADE_COMPARE(~BitVector19(0xa5, 0x5f, 0x03), BitVector19(0x5a, 0xa0, 0x04));
     CORRADE_COMPARE(!BitVector19(0xa5, 0x5f, 0x03), BitVector19(0x5a, 0xa0, 0x04));
@@ -340,6 +462,26 @@ void BitVectorTest::booleanOperationEquivalents() {
     CORRADE_COMPARE(!a && !b, ~a & ~b);
 }
 
+void BitVectorTest::bitOperationsLarge() {
+    BitVector147 a, b;
+    for(std::size_t i = 0; i != BitVector147::Size; ++i) {
+        a.set(i, i % 3 == 0);
+        b.set(i, i % 5 == 0);
+    }
+
+    BitVector147 inverse = ~a;
+    BitVector147 and_ = a & b;
+    BitVector147 or_ = a | b;
+    BitVector147 xor_ = a ^ b;
+    for(std::size_t i = 0; i != BitVector147::Size; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(inverse[i], i % 3 != 0);
+        CORRADE_COMPARE(and_[i], i % 15 == 0);
+        CORRADE_COMPARE(or_[i], i % 3 == 0 || i % 5 == 0);
+        CORRADE_COMPARE(xor_[i], (i % 3 == 0) != (i % 5 == 0));
+    }
+}
+
 void BitVectorTest::strictWeakOrdering() {
     BitVector<11> a, b, c;
 
@@ -0,0 +1,240 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/ColorBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct ColorBatchBenchmark: TestSuite::Tester {
+    explicit ColorBatchBenchmark();
+
+    void fromSrgb8BitBaseline();
+    void fromSrgb8Bit();
+    void fromSrgbBaseline();
+    void fromSrgb();
+    void toSrgbBaseline();
+    void toSrgb();
+    void toSrgb8BitBaseline();
+    void toSrgb8Bit();
+    void premultiplyAlphaBaseline();
+    void premultiplyAlpha();
+    void premultiplyAlpha8BitBaseline();
+    void premultiplyAlpha8Bit();
+};
+
+enum: std::size_t {
+    /* A 1024x1024 image */
+    Size = 1024
+};
+
+ColorBatchBenchmark::ColorBatchBenchmark() {
+    addBenchmarks({&ColorBatchBenchmark::fromSrgb8BitBaseline,
+                   &ColorBatchBenchmark::fromSrgb8Bit,
+                   &ColorBatchBenchmark::fromSrgbBaseline,
+                   &ColorBatchBenchmark::fromSrgb,
+                   &ColorBatchBenchmark::toSrgbBaseline,
+                   &ColorBatchBenchmark::toSrgb,
+                   &ColorBatchBenchmark::toSrgb8BitBaseline,
+                   &ColorBatchBenchmark::toSrgb8Bit,
+                   &ColorBatchBenchmark::premultiplyAlphaBaseline,
+                   &ColorBatchBenchmark::premultiplyAlpha,
+                   &ColorBatchBenchmark::premultiplyAlpha8BitBaseline,
+                   &ColorBatchBenchmark::premultiplyAlpha8Bit}, 5);
+}
+
+Containers::Array<Vector4<UnsignedByte>> srgb8BitData() {
+    Containers::Array<Vector4<UnsignedByte>> out{NoInit, Size*Size};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = {UnsignedByte(i*7), UnsignedByte(i*13), UnsignedByte(i*3), UnsignedByte(i*5)};
+    return out;
+}
+
+Containers::Array<Color4<Float>> floatData() {
+    Containers::Array<Color4<Float>> out{NoInit, Size*Size};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = {(i % 1013)/1013.0f, (i % 757)/757.0f, (i % 331)/331.0f, (i % 97)/97.0f};
+    return out;
+}
+
+template<class T> Containers::StridedArrayView2D<T> image(Containers::Array<T>& data) {
+    return Containers::StridedArrayView2D<T>{data, {Size, Size}};
+}
+
+void ColorBatchBenchmark::fromSrgb8BitBaseline() {
+    Containers::Array<Vector4<UnsignedByte>> src = srgb8BitData();
+    Containers::Array<Color4<Float>> dst{NoInit, Size*Size};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != src.size(); ++i)
+            dst[i] = Color4<Float>::fromSrgbAlpha(src[i]);
+    }
+
+    CORRADE_COMPARE(dst[Size*Size - 1], Color4<Float>::fromSrgbAlpha(src[Size*Size - 1]));
+}
+
+void ColorBatchBenchmark::fromSrgb8Bit() {
+    Containers::Array<Vector4<UnsignedByte>> src = srgb8BitData();
+    Containers::Array<Color4<Float>> dst{NoInit, Size*Size};
+
+    CORRADE_BENCHMARK(1) {
+        fromSrgbAlphaInto(image(src), image(dst));
+    }
+
+    CORRADE_COMPARE(dst[Size*Size - 1], Color4<Float>::fromSrgbAlpha(src[Size*Size - 1]));
+}
+
+void ColorBatchBenchmark::fromSrgbBaseline() {
+    Containers::Array<Color4<Float>> src = floatData();
+    Containers::Array<Color4<Float>> dst{NoInit, Size*Size};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != src.size(); ++i)
+            dst[i] = Color4<Float>::fromSrgbAlpha(src[i]);
+    }
+
+    CORRADE_COMPARE(dst[Size*Size - 1], Color4<Float>::fromSrgbAlpha(src[Size*Size - 1]));
+}
+
+void ColorBatchBenchmark::fromSrgb() {
+    Containers::Array<Color4<Float>> src = floatData();
+    Containers::Array<Color4<Float>> dst{NoInit, Size*Size};
+
+    CORRADE_BENCHMARK(1) {
+        fromSrgbAlphaInto(Containers::arrayCast<const Vector4<Float>>(image(src)), image(dst));
+    }
+
+    CORRADE_COMPARE(dst[Size*Size - 1], Color4<Float>::fromSrgbAlpha(src[Size*Size - 1]));
+}
+
+void ColorBatchBenchmark::toSrgbBaseline() {
+    Containers::Array<Color4<Float>> src = floatData();
+    Containers::Array<Vector4<Float>> dst{NoInit, Size*Size};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != src.size(); ++i)
+            dst[i] = src[i].toSrgbAlpha();
+    }
+
+    CORRADE_COMPARE(dst[Size*Size - 1], src[Size*Size - 1].toSrgbAlpha());
+}
+
+void ColorBatchBenchmark::toSrgb() {
+    Containers::Array<Color4<Float>> src = floatData();
+    Containers::Array<Vector4<Float>> dst{NoInit, Size*Size};
+
+    CORRADE_BENCHMARK(1) {
+        toSrgbAlphaInto(image(src), image(dst));
+    }
+
+    CORRADE_COMPARE(dst[Size*Size - 1], src[Size*Size - 1].toSrgbAlpha());
+}
+
+void ColorBatchBenchmark::toSrgb8BitBaseline() {
+    Containers::Array<Color4<Float>> src = floatData();
+    Containers::Array<Vector4<UnsignedByte>> dst{NoInit, Size*Size};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != src.size(); ++i)
+            dst[i] = src[i].toSrgbAlpha<UnsignedByte>();
+    }
+
+    CORRADE_COMPARE(dst[Size*Size - 1], src[Size*Size - 1].toSrgbAlpha<UnsignedByte>());
+}
+
+void ColorBatchBenchmark::toSrgb8Bit() {
+    Containers::Array<Color4<Float>> src = floatData();
+    Containers::Array<Vector4<UnsignedByte>> dst{NoInit, Size*Size};
+
+    CORRADE_BENCHMARK(1) {
+        toSrgbAlphaInto(image(src), image(dst));
+    }
+
+    CORRADE_COMPARE(dst[Size*Size - 1].w(), src[Size*Size - 1].toSrgbAlpha<UnsignedByte>().w());
+}
+
+void ColorBatchBenchmark::premultiplyAlphaBaseline() {
+    Containers::Array<Color4<Float>> src = floatData();
+    Containers::Array<Color4<Float>> dst{NoInit, Size*Size};
+
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != src.size(); ++i)
+            dst[i] = {src[i].rgb()*src[i].a(), src[i].a()};
+    }
+
+    CORRADE_COMPARE(dst[Size*Size - 1].a(), src[Size*Size - 1].a());
+}
+
+void ColorBatchBenchmark::premultiplyAlpha() {
+    Containers::Array<Color4<Float>> src = floatData();
+    Containers::Array<Color4<Float>> dst{NoInit, Size*Size};
+
+    CORRADE_BENCHMARK(1) {
+        premultiplyAlphaInto(image(src), image(dst));
+    }
+
+    CORRADE_COMPARE(dst[Size*Size - 1], (Color4<Float>{src[Size*Size - 1].rgb()*src[Size*Size - 1].a(), src[Size*Size - 1].a()}));
+}
+
+void ColorBatchBenchmark::premultiplyAlpha8BitBaseline() {
+    Containers::Array<Vector4<UnsignedByte>> data = srgb8BitData();
+    Containers::Array<Color4<UnsignedByte>> src{NoInit, Size*Size};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = data[i];
+    Containers::Array<Color4<UnsignedByte>> dst{NoInit, Size*Size};
+
+    /* The usual way, with a roundtrip through floats */
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != src.size(); ++i) {
+            const Color4<Float> c = Math::unpack<Color4<Float>>(src[i]);
+            dst[i] = Math::pack<Color4<UnsignedByte>>(Color4<Float>{c.rgb()*c.a(), c.a()});
+        }
+    }
+
+    CORRADE_COMPARE(dst[Size*Size - 1].a(), src[Size*Size - 1].a());
+}
+
+void ColorBatchBenchmark::premultiplyAlpha8Bit() {
+    Containers::Array<Vector4<UnsignedByte>> data = srgb8BitData();
+    Containers::Array<Color4<UnsignedByte>> src{NoInit, Size*Size};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = data[i];
+    Containers::Array<Color4<UnsignedByte>> dst{NoInit, Size*Size};
+
+    CORRADE_BENCHMARK(1) {
+        premultiplyAlphaInto(image(src), image(dst));
+    }
+
+    CORRADE_COMPARE(dst[Size*Size - 1].a(), src[Size*Size - 1].a());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::ColorBatchBenchmark)
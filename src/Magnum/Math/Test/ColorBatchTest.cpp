@@ -38,8 +38,8 @@
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/DebugTools/CompareImage.h"
+#include "Magnum/Math/Color.h"
 #include "Magnum/Math/ColorBatch.h"
-#include "Magnum/Math/Vector4.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/ImageData.h"
@@ -56,6 +56,23 @@ struct ColorBatchTest: TestSuite::Tester {
 
     void yFlipInvalidLastDimension();
 
+    void fromSrgb8Bit();
+    void fromSrgbAlpha8Bit();
+    void fromSrgb();
+    void fromSrgbAlpha();
+    void toSrgb();
+    void toSrgbAlpha();
+    void toSrgb8Bit();
+    void toSrgbAlpha8Bit();
+    void srgbInPlace();
+    void premultiplyAlpha();
+    void premultiplyAlpha8Bit();
+    void unpremultiplyAlpha();
+    void unpremultiplyAlpha8Bit();
+    void alphaInPlace();
+    void colorEmpty();
+    void colorWrongDestinationSize();
+
     PluginManager::Manager<Trade::AbstractImageConverter> _converterManager{MAGNUM_PLUGINS_IMAGECONVERTER_INSTALL_DIR};
     PluginManager::Manager<Trade::AbstractImporter> _importerManager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
 };
@@ -293,7 +310,24 @@ ColorBatchTest::ColorBatchTest() {
 
     addTests({&ColorBatchTest::yFlip3D,
 
-              &ColorBatchTest::yFlipInvalidLastDimension});
+              &ColorBatchTest::yFlipInvalidLastDimension,
+
+              &ColorBatchTest::fromSrgb8Bit,
+              &ColorBatchTest::fromSrgbAlpha8Bit,
+              &ColorBatchTest::fromSrgb,
+              &ColorBatchTest::fromSrgbAlpha,
+              &ColorBatchTest::toSrgb,
+              &ColorBatchTest::toSrgbAlpha,
+              &ColorBatchTest::toSrgb8Bit,
+              &ColorBatchTest::toSrgbAlpha8Bit,
+              &ColorBatchTest::srgbInPlace,
+              &ColorBatchTest::premultiplyAlpha,
+              &ColorBatchTest::premultiplyAlpha8Bit,
+              &ColorBatchTest::unpremultiplyAlpha,
+              &ColorBatchTest::unpremultiplyAlpha8Bit,
+              &ColorBatchTest::alphaInPlace,
+              &ColorBatchTest::colorEmpty,
+              &ColorBatchTest::colorWrongDestinationSize});
 }
 
 void ColorBatchTest::yFlip() {
@@ -378,6 +412,340 @@ void ColorBatchTest::yFlipInvalidLastDimension() {
         "Math::yFlipBc1InPlace(): last dimension is not contiguous\n");
 }
 
+/* The color conversion tests use an odd row length to test also the remainder
+   handling in the SIMD variants, and the data are interleaved with other
+   values to test arbitrary strides */
+enum: std::size_t { Rows = 3, Cols = 7 };
+
+template<class Src, class Dst> struct Pixel {
+    Src src;
+    UnsignedByte padding;
+    Dst dst;
+};
+
+template<class Src, class Dst> Containers::StridedArrayView2D<Pixel<Src, Dst>> pixelView(Pixel<Src, Dst>(&data)[Rows][Cols]) {
+    return Containers::StridedArrayView2D<Pixel<Src, Dst>>{Containers::arrayView(&data[0][0], Rows*Cols), {Rows, Cols}};
+}
+
+void ColorBatchTest::fromSrgb8Bit() {
+    Pixel<Vector3<UnsignedByte>, Color3<Float>> data[Rows][Cols];
+    auto view = pixelView(data);
+    for(std::size_t i = 0; i != Rows; ++i)
+        for(std::size_t j = 0; j != Cols; ++j)
+            view[i][j].src = {UnsignedByte(i*97 + j*13), UnsignedByte(255 - j*31), UnsignedByte(i*j*11)};
+
+    fromSrgbInto(view.slice(&Pixel<Vector3<UnsignedByte>, Color3<Float>>::src),
+                 view.slice(&Pixel<Vector3<UnsignedByte>, Color3<Float>>::dst));
+
+    for(std::size_t i = 0; i != Rows; ++i) for(std::size_t j = 0; j != Cols; ++j) {
+        CORRADE_ITERATION(i << j);
+        CORRADE_COMPARE(view[i][j].dst, Color3<Float>::fromSrgb(view[i][j].src));
+    }
+}
+
+void ColorBatchTest::fromSrgbAlpha8Bit() {
+    Pixel<Vector4<UnsignedByte>, Color4<Float>> data[Rows][Cols];
+    auto view = pixelView(data);
+    for(std::size_t i = 0; i != Rows; ++i)
+        for(std::size_t j = 0; j != Cols; ++j)
+            view[i][j].src = {UnsignedByte(i*97 + j*13), UnsignedByte(255 - j*31), UnsignedByte(i*j*11), UnsignedByte(j*40)};
+
+    fromSrgbAlphaInto(view.slice(&Pixel<Vector4<UnsignedByte>, Color4<Float>>::src),
+                      view.slice(&Pixel<Vector4<UnsignedByte>, Color4<Float>>::dst));
+
+    for(std::size_t i = 0; i != Rows; ++i) for(std::size_t j = 0; j != Cols; ++j) {
+        CORRADE_ITERATION(i << j);
+        CORRADE_COMPARE(view[i][j].dst, Color4<Float>::fromSrgbAlpha(view[i][j].src));
+    }
+}
+
+void ColorBatchTest::fromSrgb() {
+    Pixel<Vector3<Float>, Color3<Float>> data[Rows][Cols];
+    auto view = pixelView(data);
+    /* Covering both the linear and the power part of the curve */
+    for(std::size_t i = 0; i != Rows; ++i)
+        for(std::size_t j = 0; j != Cols; ++j)
+            view[i][j].src = {i*0.31f + j*0.013f, 1.0f - j*0.14f, i*j*0.002f};
+
+    fromSrgbInto(view.slice(&Pixel<Vector3<Float>, Color3<Float>>::src),
+                 view.slice(&Pixel<Vector3<Float>, Color3<Float>>::dst));
+
+    for(std::size_t i = 0; i != Rows; ++i) for(std::size_t j = 0; j != Cols; ++j) {
+        CORRADE_ITERATION(i << j);
+        CORRADE_COMPARE(view[i][j].dst, Color3<Float>::fromSrgb(view[i][j].src));
+    }
+}
+
+void ColorBatchTest::fromSrgbAlpha() {
+    Pixel<Vector4<Float>, Color4<Float>> data[Rows][Cols];
+    auto view = pixelView(data);
+    for(std::size_t i = 0; i != Rows; ++i)
+        for(std::size_t j = 0; j != Cols; ++j)
+            view[i][j].src = {i*0.31f + j*0.013f, 1.0f - j*0.14f, i*j*0.002f, j*0.15f};
+
+    fromSrgbAlphaInto(view.slice(&Pixel<Vector4<Float>, Color4<Float>>::src),
+                      view.slice(&Pixel<Vector4<Float>, Color4<Float>>::dst));
+
+    for(std::size_t i = 0; i != Rows; ++i) for(std::size_t j = 0; j != Cols; ++j) {
+        CORRADE_ITERATION(i << j);
+        CORRADE_COMPARE(view[i][j].dst, Color4<Float>::fromSrgbAlpha(view[i][j].src));
+        /* Alpha is passed through unchanged */
+        CORRADE_COMPARE(view[i][j].dst.a(), view[i][j].src.w());
+    }
+}
+
+void ColorBatchTest::toSrgb() {
+    Pixel<Color3<Float>, Vector3<Float>> data[Rows][Cols];
+    auto view = pixelView(data);
+    for(std::size_t i = 0; i != Rows; ++i)
+        for(std::size_t j = 0; j != Cols; ++j)
+            view[i][j].src = {i*0.31f + j*0.013f, 1.0f - j*0.14f, i*j*0.0002f};
+
+    toSrgbInto(view.slice(&Pixel<Color3<Float>, Vector3<Float>>::src),
+               view.slice(&Pixel<Color3<Float>, Vector3<Float>>::dst));
+
+    for(std::size_t i = 0; i != Rows; ++i) for(std::size_t j = 0; j != Cols; ++j) {
+        CORRADE_ITERATION(i << j);
+        CORRADE_COMPARE(view[i][j].dst, view[i][j].src.toSrgb());
+    }
+}
+
+void ColorBatchTest::toSrgbAlpha() {
+    Pixel<Color4<Float>, Vector4<Float>> data[Rows][Cols];
+    auto view = pixelView(data);
+    for(std::size_t i = 0; i != Rows; ++i)
+        for(std::size_t j = 0; j != Cols; ++j)
+            view[i][j].src = {i*0.31f + j*0.013f, 1.0f - j*0.14f, i*j*0.0002f, j*0.15f};
+
+    toSrgbAlphaInto(view.slice(&Pixel<Color4<Float>, Vector4<Float>>::src),
+                    view.slice(&Pixel<Color4<Float>, Vector4<Float>>::dst));
+
+    for(std::size_t i = 0; i != Rows; ++i) for(std::size_t j = 0; j != Cols; ++j) {
+        CORRADE_ITERATION(i << j);
+        CORRADE_COMPARE(view[i][j].dst, view[i][j].src.toSrgbAlpha());
+        CORRADE_COMPARE(view[i][j].dst.w(), view[i][j].src.a());
+    }
+}
+
+void ColorBatchTest::toSrgb8Bit() {
+    Pixel<Color3<Float>, Vector3<UnsignedByte>> data[Rows][Cols];
+    auto view = pixelView(data);
+    /* Converting from 8-bit sRGB values, which should then round-trip even
+       with the approximation in the SIMD variants */
+    for(std::size_t i = 0; i != Rows; ++i)
+        for(std::size_t j = 0; j != Cols; ++j)
+            view[i][j].src = Color3<Float>::fromSrgb(Vector3<UnsignedByte>{UnsignedByte(i*97 + j*13), UnsignedByte(255 - j*31), UnsignedByte(i*j*11)});
+    /* Out-of-range values get clamped */
+    view[1][3].src = {-0.5f, 1.5f, 0.0f};
+
+    toSrgbInto(view.slice(&Pixel<Color3<Float>, Vector3<UnsignedByte>>::src),
+               view.slice(&Pixel<Color3<Float>, Vector3<UnsignedByte>>::dst));
+
+    for(std::size_t i = 0; i != Rows; ++i) for(std::size_t j = 0; j != Cols; ++j) {
+        if(i == 1 && j == 3) continue;
+        CORRADE_ITERATION(i << j);
+        CORRADE_COMPARE(view[i][j].dst, (Vector3<UnsignedByte>{UnsignedByte(i*97 + j*13), UnsignedByte(255 - j*31), UnsignedByte(i*j*11)}));
+    }
+    CORRADE_COMPARE(view[1][3].dst, (Vector3<UnsignedByte>{0, 255, 0}));
+}
+
+void ColorBatchTest::toSrgbAlpha8Bit() {
+    Pixel<Color4<Float>, Vector4<UnsignedByte>> data[Rows][Cols];
+    auto view = pixelView(data);
+    for(std::size_t i = 0; i != Rows; ++i)
+        for(std::size_t j = 0; j != Cols; ++j)
+            view[i][j].src = Color4<Float>::fromSrgbAlpha(Vector4<UnsignedByte>{UnsignedByte(i*97 + j*13), UnsignedByte(255 - j*31), UnsignedByte(i*j*11), UnsignedByte(j*40)});
+    view[1][3].src = {-0.5f, 1.5f, 0.0f, 2.0f};
+
+    toSrgbAlphaInto(view.slice(&Pixel<Color4<Float>, Vector4<UnsignedByte>>::src),
+                    view.slice(&Pixel<Color4<Float>, Vector4<UnsignedByte>>::dst));
+
+    for(std::size_t i = 0; i != Rows; ++i) for(std::size_t j = 0; j != Cols; ++j) {
+        if(i == 1 && j == 3) continue;
+        CORRADE_ITERATION(i << j);
+        CORRADE_COMPARE(view[i][j].dst, (Vector4<UnsignedByte>{UnsignedByte(i*97 + j*13), UnsignedByte(255 - j*31), UnsignedByte(i*j*11), UnsignedByte(j*40)}));
+    }
+    CORRADE_COMPARE(view[1][3].dst, (Vector4<UnsignedByte>{0, 255, 0, 255}));
+}
+
+void ColorBatchTest::srgbInPlace() {
+    Color4<Float> data[Rows][Cols];
+    Containers::StridedArrayView2D<Color4<Float>> view{Containers::arrayView(&data[0][0], Rows*Cols), {Rows, Cols}};
+    for(std::size_t i = 0; i != Rows; ++i)
+        for(std::size_t j = 0; j != Cols; ++j)
+            view[i][j] = {i*0.31f + j*0.013f, 1.0f - j*0.14f, i*j*0.002f, j*0.15f};
+
+    /* Converting back and forth should result in the original values */
+    toSrgbAlphaInto(view, Containers::arrayCast<Vector4<Float>>(view));
+    fromSrgbAlphaInto(Containers::arrayCast<const Vector4<Float>>(view), view);
+
+    for(std::size_t i = 0; i != Rows; ++i) for(std::size_t j = 0; j != Cols; ++j) {
+        CORRADE_ITERATION(i << j);
+        CORRADE_COMPARE(view[i][j], (Color4<Float>{i*0.31f + j*0.013f, 1.0f - j*0.14f, i*j*0.002f, j*0.15f}));
+    }
+}
+
+void ColorBatchTest::premultiplyAlpha() {
+    Pixel<Color4<Float>, Color4<Float>> data[Rows][Cols];
+    auto view = pixelView(data);
+    for(std::size_t i = 0; i != Rows; ++i)
+        for(std::size_t j = 0; j != Cols; ++j)
+            view[i][j].src = {i*0.31f + j*0.013f, 1.0f - j*0.14f, i*j*0.002f, j*0.15f};
+
+    premultiplyAlphaInto(view.slice(&Pixel<Color4<Float>, Color4<Float>>::src),
+                         view.slice(&Pixel<Color4<Float>, Color4<Float>>::dst));
+
+    for(std::size_t i = 0; i != Rows; ++i) for(std::size_t j = 0; j != Cols; ++j) {
+        CORRADE_ITERATION(i << j);
+        const Color4<Float> src = view[i][j].src;
+        CORRADE_COMPARE(view[i][j].dst, (Color4<Float>{src.rgb()*src.a(), src.a()}));
+    }
+}
+
+void ColorBatchTest::premultiplyAlpha8Bit() {
+    /* All combinations of color and alpha, with every 256th pixel having an
+       arbitrary color and the alpha all 256 values. Testing both a contiguous
+       and a strided variant as the SIMD code is used only for the former. */
+    Containers::Array<Color4<UnsignedByte>> src{Magnum::NoInit, 256*256};
+    for(std::size_t i = 0; i != 256; ++i)
+        for(std::size_t j = 0; j != 256; ++j)
+            src[i*256 + j] = {UnsignedByte(j), UnsignedByte(255 - j), UnsignedByte(j*i), UnsignedByte(i)};
+    Containers::Array<Color4<UnsignedByte>> dst{Magnum::NoInit, 256*256};
+    Containers::Array<Color4<UnsignedByte>> dstStrided{Magnum::ValueInit, 256*256*2};
+
+    premultiplyAlphaInto(
+        Containers::StridedArrayView2D<const Color4<UnsignedByte>>{src, {256, 256}},
+        Containers::StridedArrayView2D<Color4<UnsignedByte>>{dst, {256, 256}});
+    premultiplyAlphaInto(
+        Containers::StridedArrayView2D<const Color4<UnsignedByte>>{src, {256, 256}},
+        Containers::StridedArrayView2D<Color4<UnsignedByte>>{dstStrided, {256, 256}, {256*2*4, 2*4}});
+
+    for(std::size_t i = 0; i != src.size(); ++i) {
+        CORRADE_ITERATION(i);
+        const UnsignedInt a = src[i].a();
+        /* c*a/255 is never exactly at a 0.5 boundary so rounding this way is
+           fine */
+        const Color4<UnsignedByte> expected{
+            UnsignedByte((src[i].r()*a + 127)/255),
+            UnsignedByte((src[i].g()*a + 127)/255),
+            UnsignedByte((src[i].b()*a + 127)/255),
+            UnsignedByte(a)};
+        CORRADE_COMPARE(dst[i], expected);
+        CORRADE_COMPARE(dstStrided[i*2], expected);
+    }
+}
+
+void ColorBatchTest::unpremultiplyAlpha() {
+    Pixel<Color4<Float>, Color4<Float>> data[Rows][Cols];
+    auto view = pixelView(data);
+    for(std::size_t i = 0; i != Rows; ++i)
+        for(std::size_t j = 0; j != Cols; ++j)
+            view[i][j].src = {i*0.031f + j*0.013f, 0.1f - j*0.014f, i*j*0.002f, 0.1f + j*0.15f};
+    /* Zero alpha results in a zero color */
+    view[2][5].src = {0.5f, 0.25f, 1.0f, 0.0f};
+
+    unpremultiplyAlphaInto(view.slice(&Pixel<Color4<Float>, Color4<Float>>::src),
+                           view.slice(&Pixel<Color4<Float>, Color4<Float>>::dst));
+
+    for(std::size_t i = 0; i != Rows; ++i) for(std::size_t j = 0; j != Cols; ++j) {
+        if(i == 2 && j == 5) continue;
+        CORRADE_ITERATION(i << j);
+        const Color4<Float> src = view[i][j].src;
+        CORRADE_COMPARE(view[i][j].dst, (Color4<Float>{src.rgb()/src.a(), src.a()}));
+    }
+    CORRADE_COMPARE(view[2][5].dst, (Color4<Float>{0.0f, 0.0f, 0.0f, 0.0f}));
+}
+
+void ColorBatchTest::unpremultiplyAlpha8Bit() {
+    Pixel<Color4<UnsignedByte>, Color4<UnsignedByte>> data[Rows][Cols];
+    auto view = pixelView(data);
+    view[0][0].src = {0, 0, 0, 0};
+    view[0][1].src = {128, 255, 12, 0};
+    view[0][2].src = {0, 128, 255, 255};
+    view[0][3].src = {64, 32, 1, 128};
+    view[0][4].src = {200, 100, 50, 100};
+    view[0][5].src = {1, 2, 3, 1};
+    view[0][6].src = {33, 66, 99, 200};
+    for(std::size_t i = 1; i != Rows; ++i)
+        for(std::size_t j = 0; j != Cols; ++j)
+            view[i][j].src = {UnsignedByte(i*j*7), UnsignedByte(j*11), UnsignedByte(i*5), UnsignedByte(i*50 + j*11)};
+
+    unpremultiplyAlphaInto(view.slice(&Pixel<Color4<UnsignedByte>, Color4<UnsignedByte>>::src),
+                           view.slice(&Pixel<Color4<UnsignedByte>, Color4<UnsignedByte>>::dst));
+
+    CORRADE_COMPARE(view[0][0].dst, (Color4<UnsignedByte>{0, 0, 0, 0}));
+    CORRADE_COMPARE(view[0][1].dst, (Color4<UnsignedByte>{0, 0, 0, 0}));
+    CORRADE_COMPARE(view[0][2].dst, (Color4<UnsignedByte>{0, 128, 255, 255}));
+    /* 64*255/128 = 127.5, 32*255/128 = 63.75, 1*255/128 = 1.99 */
+    CORRADE_COMPARE(view[0][3].dst, (Color4<UnsignedByte>{128, 64, 2, 128}));
+    /* Values larger than alpha get clamped */
+    CORRADE_COMPARE(view[0][4].dst, (Color4<UnsignedByte>{255, 255, 128, 100}));
+    CORRADE_COMPARE(view[0][5].dst, (Color4<UnsignedByte>{255, 255, 255, 1}));
+    /* 33*255/200 = 42.075, 66*255/200 = 84.15, 99*255/200 = 126.225 */
+    CORRADE_COMPARE(view[0][6].dst, (Color4<UnsignedByte>{42, 84, 126, 200}));
+
+    /* Premultiplying the result back gives the original values again if
+       nothing got clamped */
+    for(std::size_t i = 1; i != Rows; ++i) for(std::size_t j = 0; j != Cols; ++j) {
+        CORRADE_ITERATION(i << j);
+        const Color4<UnsignedByte> src = view[i][j].src;
+        if(src.r() > src.a() || src.g() > src.a() || src.b() > src.a())
+            continue;
+        const Color4<UnsignedByte> dst = view[i][j].dst;
+        CORRADE_COMPARE(dst.a(), src.a());
+        CORRADE_COMPARE((dst.r()*src.a() + 127)/255, UnsignedInt(src.r()));
+        CORRADE_COMPARE((dst.g()*src.a() + 127)/255, UnsignedInt(src.g()));
+        CORRADE_COMPARE((dst.b()*src.a() + 127)/255, UnsignedInt(src.b()));
+    }
+}
+
+void ColorBatchTest::alphaInPlace() {
+    Color4<UnsignedByte> data[Rows][Cols];
+    Containers::StridedArrayView2D<Color4<UnsignedByte>> view{Containers::arrayView(&data[0][0], Rows*Cols), {Rows, Cols}};
+    for(std::size_t i = 0; i != Rows; ++i)
+        for(std::size_t j = 0; j != Cols; ++j)
+            view[i][j] = {UnsignedByte(i*j*7), UnsignedByte(j*11), UnsignedByte(i*5), UnsignedByte(255 - j*3)};
+
+    /* With the colors not larger than alpha, unpremultiplying and then
+       premultiplying again is lossless */
+    unpremultiplyAlphaInto(view, view);
+    premultiplyAlphaInto(view, view);
+
+    for(std::size_t i = 0; i != Rows; ++i) for(std::size_t j = 0; j != Cols; ++j) {
+        CORRADE_ITERATION(i << j);
+        CORRADE_COMPARE(view[i][j], (Color4<UnsignedByte>{UnsignedByte(i*j*7), UnsignedByte(j*11), UnsignedByte(i*5), UnsignedByte(255 - j*3)}));
+    }
+}
+
+void ColorBatchTest::colorEmpty() {
+    /* Should not crash or assert */
+    fromSrgbInto(Containers::StridedArrayView2D<const Vector3<UnsignedByte>>{}, Containers::StridedArrayView2D<Color3<Float>>{});
+    fromSrgbAlphaInto(Containers::StridedArrayView2D<const Vector4<Float>>{}, Containers::StridedArrayView2D<Color4<Float>>{});
+    toSrgbInto(Containers::StridedArrayView2D<const Color3<Float>>{}, Containers::StridedArrayView2D<Vector3<UnsignedByte>>{});
+    premultiplyAlphaInto(Containers::StridedArrayView2D<const Color4<UnsignedByte>>{}, Containers::StridedArrayView2D<Color4<UnsignedByte>>{});
+    unpremultiplyAlphaInto(Containers::StridedArrayView2D<const Color4<Float>>{}, Containers::StridedArrayView2D<Color4<Float>>{});
+    CORRADE_VERIFY(true);
+}
+
+void ColorBatchTest::colorWrongDestinationSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Color4<Float> a[6];
+    Color4<UnsignedByte> b[6];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    fromSrgbAlphaInto(Containers::StridedArrayView2D<const Vector4<UnsignedByte>>{Containers::arrayCast<const Vector4<UnsignedByte>>(Containers::arrayView(b)), {2, 3}}, Containers::StridedArrayView2D<Color4<Float>>{a, {3, 2}});
+    toSrgbAlphaInto(Containers::StridedArrayView2D<const Color4<Float>>{a, {2, 3}}, Containers::StridedArrayView2D<Vector4<UnsignedByte>>{Containers::arrayCast<Vector4<UnsignedByte>>(Containers::arrayView(b)), {2, 2}});
+    premultiplyAlphaInto(Containers::StridedArrayView2D<const Color4<Float>>{a, {2, 3}}, Containers::StridedArrayView2D<Color4<Float>>{a, {1, 3}});
+    unpremultiplyAlphaInto(Containers::StridedArrayView2D<const Color4<UnsignedByte>>{b, {6, 1}}, Containers::StridedArrayView2D<Color4<UnsignedByte>>{b, {1, 6}});
+    CORRADE_COMPARE(out.str(),
+        "Math::fromSrgbAlphaInto(): wrong destination size, got {3, 2} but expected {2, 3}\n"
+        "Math::toSrgbAlphaInto(): wrong destination size, got {2, 2} but expected {2, 3}\n"
+        "Math::premultiplyAlphaInto(): wrong destination size, got {1, 3} but expected {2, 3}\n"
+        "Math::unpremultiplyAlphaInto(): wrong destination size, got {1, 6} but expected {6, 1}\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::ColorBatchTest)
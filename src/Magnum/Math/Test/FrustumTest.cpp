@@ -75,6 +75,7 @@ struct FrustumTest: TestSuite::Tester {
     void constructConversion();
     void constructCopy();
     void constructFromMatrix();
+    void constructFromMatrixReverseZ();
     void convert();
 
     void data();
@@ -91,6 +92,7 @@ struct FrustumTest: TestSuite::Tester {
 using Magnum::Vector4;
 using Magnum::Matrix4;
 using Magnum::Frustum;
+using Magnum::Constants;
 
 FrustumTest::FrustumTest() {
     addTests({&FrustumTest::construct,
@@ -99,6 +101,7 @@ FrustumTest::FrustumTest() {
               &FrustumTest::constructConversion,
               &FrustumTest::constructCopy,
               &FrustumTest::constructFromMatrix,
+              &FrustumTest::constructFromMatrixReverseZ,
               &FrustumTest::convert,
 
               &FrustumTest::data,
@@ -278,6 +281,35 @@ void FrustumTest::constructFromMatrix() {
     CORRADE_COMPARE(Frustum::fromMatrix({}), Frustum{});
 }
 
+void FrustumTest::constructFromMatrixReverseZ() {
+    using namespace Magnum::Math::Literals;
+
+    Frustum expected{
+        { 1.0f,  0.0f, -1.0f, 0.0f},
+        {-1.0f,  0.0f, -1.0f, 0.0f},
+        { 0.0f,  1.0f, -1.0f, 0.0f},
+        { 0.0f, -1.0f, -1.0f, 0.0f},
+        { 0.0f,  0.0f, -1.11111f, -1.11111f},
+        { 0.0f,  0.0f,  0.11111f,  1.11111f}};
+
+    const Frustum frustum = Frustum::fromMatrixReverseZ(
+            Matrix4::perspectiveProjectionReverseZ(90.0_degf, 1.0f, 1.0f, 10.0f));
+    CORRADE_COMPARE(frustum, expected);
+
+    /* The side planes are the same as for a regular projection */
+    const Frustum regular = Frustum::fromMatrix(
+            Matrix4::perspectiveProjection(90.0_degf, 1.0f, 1.0f, 10.0f));
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(frustum[i], regular[i]);
+    }
+
+    /* With an infinite far plane, every point is in front of the far plane */
+    const Frustum infinite = Frustum::fromMatrixReverseZ(
+            Matrix4::perspectiveProjectionReverseZ(90.0_degf, 1.0f, 1.0f, Constants::inf()));
+    CORRADE_COMPARE(infinite.far(), (Vector4{0.0f, 0.0f, 0.0f, 1.0f}));
+}
+
 void FrustumTest::convert() {
     constexpr Frstm a{{
         -1.0f,  2.0f, -3.0f, 0.1f,
@@ -30,7 +30,7 @@
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/FunctionsBatch.h"
-#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Vector4.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
 
@@ -47,6 +47,9 @@ struct FunctionsBatchTest: TestSuite::Tester {
     void nanIgnoring();
     void nanIgnoringVector();
 
+    template<class T> void isInfIsNanLarge();
+    template<class T> void minmaxLarge();
+
     void constIterable();
 };
 
@@ -55,6 +58,38 @@ using namespace Literals;
 using Magnum::Constants;
 using Magnum::Vector2;
 using Magnum::Vector3;
+using Magnum::Vector4;
+
+template<class> struct TypeName;
+template<> struct TypeName<Float> {
+    static const char* name() { return "Float"; }
+};
+template<> struct TypeName<Vector2> {
+    static const char* name() { return "Vector2"; }
+};
+template<> struct TypeName<Vector3> {
+    static const char* name() { return "Vector3"; }
+};
+template<> struct TypeName<Vector4> {
+    static const char* name() { return "Vector4"; }
+};
+
+Float& component(Float& value, std::size_t) { return value; }
+template<std::size_t size> Float& component(Vector<size, Float>& value, std::size_t i) { return value[i]; }
+
+/* Large enough to go through the SIMD code paths, with an odd size to test
+   the remainder handling as well */
+constexpr std::size_t LargeSize = 1003;
+
+bool expectedMask(bool*, std::size_t) { return true; }
+template<std::size_t size> BitVector<size> expectedMask(BitVector<size>*, std::size_t i) {
+    return BitVector<size>{}.set(i);
+}
+
+template<class T> struct Strided {
+    T value;
+    Int padding;
+};
 
 FunctionsBatchTest::FunctionsBatchTest() {
     addTests({&FunctionsBatchTest::isInf,
@@ -67,6 +102,15 @@ FunctionsBatchTest::FunctionsBatchTest() {
               &FunctionsBatchTest::nanIgnoring,
               &FunctionsBatchTest::nanIgnoringVector,
 
+              &FunctionsBatchTest::isInfIsNanLarge<Float>,
+              &FunctionsBatchTest::isInfIsNanLarge<Vector2>,
+              &FunctionsBatchTest::isInfIsNanLarge<Vector3>,
+              &FunctionsBatchTest::isInfIsNanLarge<Vector4>,
+              &FunctionsBatchTest::minmaxLarge<Float>,
+              &FunctionsBatchTest::minmaxLarge<Vector2>,
+              &FunctionsBatchTest::minmaxLarge<Vector3>,
+              &FunctionsBatchTest::minmaxLarge<Vector4>,
+
               &FunctionsBatchTest::constIterable});
 }
 
@@ -289,6 +333,96 @@ void FunctionsBatchTest::nanIgnoringVector() {
     CORRADE_COMPARE(Math::minmax(allNan).second()[1], Constants::nan());
 }
 
+template<class T> void FunctionsBatchTest::isInfIsNanLarge() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    constexpr std::size_t Components = sizeof(T)/sizeof(Float);
+    typedef decltype(Math::isNan(std::declval<T>())) Result;
+
+    Strided<T> data[LargeSize];
+    for(std::size_t i = 0; i != LargeSize; ++i)
+        for(std::size_t j = 0; j != Components; ++j)
+            component(data[i].value, j) = Float(i*Components + j);
+
+    Containers::StridedArrayView1D<Strided<T>> strided = data;
+    Containers::Array<T> contiguous{NoInit, LargeSize};
+    for(std::size_t i = 0; i != LargeSize; ++i)
+        contiguous[i] = data[i].value;
+
+    CORRADE_COMPARE(Math::isInf(contiguous), Result{});
+    CORRADE_COMPARE(Math::isNan(contiguous), Result{});
+    CORRADE_COMPARE(Math::isInf(strided.slice(&Strided<T>::value)), Result{});
+    CORRADE_COMPARE(Math::isNan(strided.slice(&Strided<T>::value)), Result{});
+
+    /* Special values in the first item, somewhere in the middle and in the
+       last item, which is in the remainder for all component counts. Each
+       is in a different component, testing the mask accumulation. */
+    for(std::size_t i: {std::size_t{0}, std::size_t{LargeSize/2 + 1}, LargeSize - 1}) {
+        CORRADE_ITERATION(i);
+
+        const std::size_t j = i % Components;
+        const Result expected = expectedMask(static_cast<Result*>(nullptr), j);
+
+        component(contiguous[i], j) = Constants::nan();
+        component(data[i].value, j) = Constants::nan();
+        CORRADE_COMPARE(Math::isNan(contiguous), expected);
+        CORRADE_COMPARE(Math::isNan(strided.slice(&Strided<T>::value)), expected);
+        CORRADE_COMPARE(Math::isInf(contiguous), Result{});
+        CORRADE_COMPARE(Math::isInf(strided.slice(&Strided<T>::value)), Result{});
+
+        component(contiguous[i], j) = -Constants::inf();
+        component(data[i].value, j) = -Constants::inf();
+        CORRADE_COMPARE(Math::isInf(contiguous), expected);
+        CORRADE_COMPARE(Math::isInf(strided.slice(&Strided<T>::value)), expected);
+        CORRADE_COMPARE(Math::isNan(contiguous), Result{});
+        CORRADE_COMPARE(Math::isNan(strided.slice(&Strided<T>::value)), Result{});
+
+        component(contiguous[i], j) = Float(i*Components + j);
+        component(data[i].value, j) = Float(i*Components + j);
+    }
+}
+
+template<class T> void FunctionsBatchTest::minmaxLarge() {
+    setTestCaseTemplateName(TypeName<T>::name());
+
+    constexpr std::size_t Components = sizeof(T)/sizeof(Float);
+
+    /* The minimum is in the last item, which is in the remainder for all
+       component counts, the maximum somewhere in the middle, with each
+       component being at a different place. The first item is all NaNs and
+       there are some NaNs in the middle, which should get ignored. */
+    Strided<T> data[LargeSize];
+    T expectedMin{}, expectedMax{};
+    for(std::size_t i = 0; i != LargeSize; ++i) {
+        for(std::size_t j = 0; j != Components; ++j) {
+            Float value = Float((i*7 + j*3) % 19) - 9.0f;
+            if(i == 0 || i == 333 + j) value = Constants::nan();
+            else if(i == LargeSize - 1 - j) value = -100.0f - Float(j);
+            else if(i == 500 + j*11) value = 100.0f + Float(j);
+            component(data[i].value, j) = value;
+        }
+    }
+    for(std::size_t j = 0; j != Components; ++j) {
+        component(expectedMin, j) = -100.0f - Float(j);
+        component(expectedMax, j) = 100.0f + Float(j);
+    }
+
+    Containers::StridedArrayView1D<Strided<T>> strided = data;
+    Containers::Array<T> contiguous{NoInit, LargeSize};
+    for(std::size_t i = 0; i != LargeSize; ++i)
+        contiguous[i] = data[i].value;
+
+    CORRADE_COMPARE(Math::min(contiguous), expectedMin);
+    CORRADE_COMPARE(Math::max(contiguous), expectedMax);
+    CORRADE_COMPARE(Math::minmax(contiguous), Containers::pair(expectedMin, expectedMax));
+    CORRADE_COMPARE(Math::min(strided.slice(&Strided<T>::value)), expectedMin);
+    CORRADE_COMPARE(Math::max(strided.slice(&Strided<T>::value)), expectedMax);
+    CORRADE_COMPARE(Math::minmax(strided.slice(&Strided<T>::value)), Containers::pair(expectedMin, expectedMax));
+
+    /* Reversed, negative stride */
+    CORRADE_COMPARE(Math::minmax(strided.slice(&Strided<T>::value).flipped<0>()), Containers::pair(expectedMin, expectedMax));
+}
+
 void FunctionsBatchTest::constIterable() {
     const Vector2 data[]{{5, -3}, {-2, 14}, {9, -5}};
 
@@ -24,10 +24,14 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Numeric.h>
 
 #include "Magnum/Math/Functions.h"
+#include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/Math/Vector3.h"
 
 #ifdef CORRADE_TARGET_SSE2
 #include <xmmintrin.h>
@@ -49,8 +53,21 @@ struct FunctionsBenchmark: TestSuite::Tester {
 
     void sinCosSeparate();
     void sinCosCombined();
+
+    void minmaxFloatBaseline();
+    void minmaxFloat();
+    void minmaxVector3Baseline();
+    void minmaxVector3();
+    void isNanVector3Baseline();
+    void isNanVector3();
+
+    private:
+        Containers::Array<Vector3<Float>> _positions;
 };
 
+/* Roughly the vertex count of a large scanned mesh */
+constexpr std::size_t BatchSize = 10000000;
+
 FunctionsBenchmark::FunctionsBenchmark() {
     addBenchmarks({
         &FunctionsBenchmark::sqrt,
@@ -67,6 +84,17 @@ FunctionsBenchmark::FunctionsBenchmark() {
 
     addBenchmarks({&FunctionsBenchmark::sinCosSeparate,
                    &FunctionsBenchmark::sinCosCombined}, 100);
+
+    addBenchmarks({&FunctionsBenchmark::minmaxFloatBaseline,
+                   &FunctionsBenchmark::minmaxFloat,
+                   &FunctionsBenchmark::minmaxVector3Baseline,
+                   &FunctionsBenchmark::minmaxVector3,
+                   &FunctionsBenchmark::isNanVector3Baseline,
+                   &FunctionsBenchmark::isNanVector3}, 5);
+
+    _positions = Containers::Array<Vector3<Float>>{NoInit, BatchSize};
+    for(std::size_t i = 0; i != BatchSize; ++i)
+        _positions[i] = {Float(i % 1777), -Float(i % 311), Float(i % 5003)*0.5f};
 }
 
 using Magnum::Constants;
@@ -225,6 +253,80 @@ void FunctionsBenchmark::sinCosCombined() {
 }
 
 
+void FunctionsBenchmark::minmaxFloatBaseline() {
+    const Containers::ArrayView<const Float> data = Containers::arrayCast<const Float>(_positions);
+
+    Containers::Pair<Float, Float> out;
+    CORRADE_BENCHMARK(1) {
+        /* What the generic implementation does, minus the NaN handling */
+        Float min = data[0], max = data[0];
+        for(std::size_t i = 1; i != data.size(); ++i) {
+            if(data[i] < min) min = data[i];
+            else if(data[i] > max) max = data[i];
+        }
+        out = {min, max};
+    }
+
+    CORRADE_COMPARE(out, Containers::pair(-310.0f, 2501.0f));
+}
+
+void FunctionsBenchmark::minmaxFloat() {
+    const Containers::ArrayView<const Float> data = Containers::arrayCast<const Float>(_positions);
+
+    Containers::Pair<Float, Float> out;
+    CORRADE_BENCHMARK(1) {
+        out = Math::minmax(data);
+    }
+
+    CORRADE_COMPARE(out, Containers::pair(-310.0f, 2501.0f));
+}
+
+void FunctionsBenchmark::minmaxVector3Baseline() {
+    Containers::Pair<Vector3<Float>, Vector3<Float>> out;
+    CORRADE_BENCHMARK(1) {
+        Vector3<Float> min = _positions[0], max = _positions[0];
+        for(std::size_t i = 1; i != _positions.size(); ++i) {
+            for(std::size_t j = 0; j != 3; ++j) {
+                if(_positions[i][j] < min[j]) min[j] = _positions[i][j];
+                else if(_positions[i][j] > max[j]) max[j] = _positions[i][j];
+            }
+        }
+        out = {min, max};
+    }
+
+    CORRADE_COMPARE(out, Containers::pair(Vector3<Float>{0.0f, -310.0f, 0.0f}, Vector3<Float>{1776.0f, 0.0f, 2501.0f}));
+}
+
+void FunctionsBenchmark::minmaxVector3() {
+    Containers::Pair<Vector3<Float>, Vector3<Float>> out;
+    CORRADE_BENCHMARK(1) {
+        out = Math::minmax(_positions);
+    }
+
+    CORRADE_COMPARE(out, Containers::pair(Vector3<Float>{0.0f, -310.0f, 0.0f}, Vector3<Float>{1776.0f, 0.0f, 2501.0f}));
+}
+
+void FunctionsBenchmark::isNanVector3Baseline() {
+    BitVector<3> out;
+    CORRADE_BENCHMARK(1) {
+        BitVector<3> nan;
+        for(const Vector3<Float>& i: _positions)
+            nan = nan || Math::isNan(i);
+        out = nan;
+    }
+
+    CORRADE_COMPARE(out, BitVector<3>{0});
+}
+
+void FunctionsBenchmark::isNanVector3() {
+    BitVector<3> out;
+    CORRADE_BENCHMARK(1) {
+        out = Math::isNan(_positions);
+    }
+
+    CORRADE_COMPARE(out, BitVector<3>{0});
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::FunctionsBenchmark)
@@ -24,6 +24,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 
 #ifndef CORRADE_NO_ASSERT
@@ -31,6 +33,7 @@
 #endif
 
 #include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/QuaternionBatch.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
 
@@ -44,6 +47,12 @@ struct InterpolationBenchmark: TestSuite::Tester {
     void quaternionSlerpShortestPath();
     void dualQuaternionSclerp();
     void dualQuaternionSclerpShortestPath();
+
+    void quaternionBatchBaseline();
+    void quaternionBatchLoop();
+    void quaternionBatch();
+    void dualQuaternionBatchLerpShortestPathLoop();
+    void dualQuaternionBatchLerpShortestPath();
 };
 
 using namespace Math::Literals;
@@ -52,6 +61,17 @@ using Magnum::Quaternion;
 using Magnum::DualQuaternion;
 using Magnum::Vector3;
 
+const struct {
+    const char* name;
+    Quaternion(*single)(const Quaternion&, const Quaternion&, Float);
+    void(*batch)(const Containers::StridedArrayView1D<const Quaternion>&, const Containers::StridedArrayView1D<const Quaternion>&, const Containers::StridedArrayView1D<const Float>&, const Containers::StridedArrayView1D<Quaternion>&);
+} QuaternionBatchData[]{
+    {"lerp", lerp<Float>, lerpInto},
+    {"lerp shortest path", lerpShortestPath<Float>, lerpShortestPathInto},
+    {"slerp", slerp<Float>, slerpInto},
+    {"slerp shortest path", slerpShortestPath<Float>, slerpShortestPathInto},
+};
+
 InterpolationBenchmark::InterpolationBenchmark() {
     addBenchmarks({&InterpolationBenchmark::baseline,
                    &InterpolationBenchmark::quaternionLerp,
@@ -60,6 +80,15 @@ InterpolationBenchmark::InterpolationBenchmark() {
                    &InterpolationBenchmark::quaternionSlerpShortestPath,
                    &InterpolationBenchmark::dualQuaternionSclerp,
                    &InterpolationBenchmark::dualQuaternionSclerpShortestPath}, 100);
+
+    addBenchmarks({&InterpolationBenchmark::quaternionBatchBaseline}, 10);
+
+    addInstancedBenchmarks({&InterpolationBenchmark::quaternionBatchLoop,
+                            &InterpolationBenchmark::quaternionBatch}, 10,
+        Containers::arraySize(QuaternionBatchData));
+
+    addBenchmarks({&InterpolationBenchmark::dualQuaternionBatchLerpShortestPathLoop,
+                   &InterpolationBenchmark::dualQuaternionBatchLerpShortestPath}, 10);
 }
 
 void InterpolationBenchmark::baseline() {
@@ -154,6 +183,101 @@ void InterpolationBenchmark::dualQuaternionSclerpShortestPath() {
     CORRADE_VERIFY(!c.isNormalized());
 }
 
+constexpr std::size_t BatchSize = 100000;
+
+/* Rotations around a varying axis spanning both the short and the long path,
+   with phases covering the whole range */
+struct QuaternionBatch {
+    explicit QuaternionBatch(): a{NoInit, BatchSize}, b{NoInit, BatchSize}, t{NoInit, BatchSize}, out{NoInit, BatchSize} {
+        for(std::size_t i = 0; i != BatchSize; ++i) {
+            const Vector3 axis = Vector3{Float(i%7) - 3.0f, 1.0f, Float(i%5) - 2.0f}.normalized();
+            a[i] = Quaternion::rotation(Deg<Float>{Float(i%360)}, axis);
+            b[i] = Quaternion::rotation(Deg<Float>{Float((i*7)%360)}, Vector3{axis.y(), axis.z(), axis.x()});
+            t[i] = Float(i%1000)/1000.0f;
+        }
+    }
+
+    Containers::Array<Quaternion> a, b;
+    Containers::Array<Float> t;
+    Containers::Array<Quaternion> out;
+};
+
+void InterpolationBenchmark::quaternionBatchBaseline() {
+    QuaternionBatch batch;
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            batch.out[i] = batch.a[i];
+    }
+
+    CORRADE_VERIFY(batch.out[BatchSize - 1].isNormalized());
+}
+
+void InterpolationBenchmark::quaternionBatchLoop() {
+    auto&& data = QuaternionBatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    QuaternionBatch batch;
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            batch.out[i] = data.single(batch.a[i], batch.b[i], batch.t[i]);
+    }
+
+    CORRADE_VERIFY(batch.out[BatchSize - 1].isNormalized());
+}
+
+void InterpolationBenchmark::quaternionBatch() {
+    auto&& data = QuaternionBatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    QuaternionBatch batch;
+    CORRADE_BENCHMARK(1) {
+        data.batch(batch.a, batch.b, batch.t, batch.out);
+    }
+
+    CORRADE_VERIFY(batch.out[BatchSize - 1].isNormalized());
+}
+
+struct DualQuaternionBatch {
+    explicit DualQuaternionBatch(): a{NoInit, BatchSize}, b{NoInit, BatchSize}, t{NoInit, BatchSize}, out{NoInit, BatchSize} {
+        for(std::size_t i = 0; i != BatchSize; ++i) {
+            const Vector3 axis = Vector3{Float(i%7) - 3.0f, 1.0f, Float(i%5) - 2.0f}.normalized();
+            a[i] = DualQuaternion::translation(axis)*DualQuaternion::rotation(Deg<Float>{Float(i%360)}, axis);
+            b[i] = DualQuaternion::rotation(Deg<Float>{Float((i*7)%360)}, Vector3{axis.y(), axis.z(), axis.x()})*DualQuaternion::translation({1.0f, 2.0f, 3.0f});
+            t[i] = Float(i%1000)/1000.0f;
+        }
+    }
+
+    Containers::Array<DualQuaternion> a, b;
+    Containers::Array<Float> t;
+    Containers::Array<DualQuaternion> out;
+};
+
+void InterpolationBenchmark::dualQuaternionBatchLerpShortestPathLoop() {
+    /* There's no single-value variant of the blend, so this implements it
+       directly */
+    DualQuaternionBatch batch;
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != BatchSize; ++i) {
+            const DualQuaternion& a = batch.a[i];
+            const DualQuaternion& b = batch.b[i];
+            const Float t = batch.t[i];
+            const DualQuaternion blended = (dot(a.real(), b.real()) < 0.0f ? -a : a)*(1.0f - t) + b*t;
+            batch.out[i] = blended/blended.real().length();
+        }
+    }
+
+    CORRADE_VERIFY(batch.out[BatchSize - 1].isNormalized());
+}
+
+void InterpolationBenchmark::dualQuaternionBatchLerpShortestPath() {
+    DualQuaternionBatch batch;
+    CORRADE_BENCHMARK(1) {
+        lerpShortestPathInto(batch.a, batch.b, batch.t, batch.out);
+    }
+
+    CORRADE_VERIFY(batch.out[BatchSize - 1].isNormalized());
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::InterpolationBenchmark)
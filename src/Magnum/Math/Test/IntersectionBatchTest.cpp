@@ -0,0 +1,230 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/IntersectionBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct IntersectionBatchTest: TestSuite::Tester {
+    explicit IntersectionBatchTest();
+
+    void rangeFrustum();
+    void aabbFrustum();
+    void sphereFrustum();
+    void sphereCone();
+    void empty();
+
+    void assertions();
+};
+
+IntersectionBatchTest::IntersectionBatchTest() {
+    addTests({&IntersectionBatchTest::rangeFrustum,
+              &IntersectionBatchTest::aabbFrustum,
+              &IntersectionBatchTest::sphereFrustum,
+              &IntersectionBatchTest::sphereCone,
+              &IntersectionBatchTest::empty,
+
+              &IntersectionBatchTest::assertions});
+}
+
+using Magnum::Frustum;
+using Magnum::Range3D;
+using Magnum::Vector3;
+
+using namespace Literals;
+
+const Frustum TestFrustum{
+    {1.0f, 0.0f, 0.0f, 0.0f},
+    {-1.0f, 0.0f, 0.0f, 5.0f},
+    {0.0f, 1.0f, 0.0f, 0.0f},
+    {0.0f, -1.0f, 0.0f, 1.0f},
+    {0.0f, 0.0f, 1.0f, 0.0f},
+    {0.0f, 0.0f, -1.0f, 10.0f}};
+
+/* Interleaved with other data and an odd count to verify strides and
+   remainder handling are correct */
+struct Volume {
+    Range3D range;
+    Int padding;
+    Vector3 center;
+    Vector3 extents;
+    Float radius;
+};
+
+/* Volumes scattered around the frustum, some of them inside, some outside
+   and some touching its planes */
+void fillVolumes(const Containers::ArrayView<Volume> volumes) {
+    for(std::size_t i = 0; i != volumes.size(); ++i) {
+        volumes[i].center = {Float(i % 7)*1.5f - 3.0f,
+                             Float(i % 5)*0.75f - 1.5f,
+                             Float(i % 3)*6.0f - 2.0f};
+        volumes[i].extents = Vector3{0.25f, 0.5f, 1.0f}*Float(i % 4);
+        volumes[i].range = Range3D::fromCenter(volumes[i].center, volumes[i].extents);
+        volumes[i].radius = Float(i % 4)*0.5f;
+    }
+}
+
+void IntersectionBatchTest::rangeFrustum() {
+    Volume data[23];
+    fillVolumes(data);
+
+    /* Starting at an unaligned bit offset, with the prefix bits set to verify
+       they don't get overwritten */
+    Containers::BitArray out{DirectInit, 3 + Containers::arraySize(data), true};
+    Intersection::rangeFrustum(Containers::stridedArrayView(data).slice(&Volume::range), TestFrustum, out.exceptPrefix(3));
+    CORRADE_VERIFY(out[0] && out[1] && out[2]);
+
+    /* Ensure the results are consistent with non-batch APIs */
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        const bool expected = Intersection::rangeFrustum(data[i].range, TestFrustum);
+        CORRADE_COMPARE(out[3 + i], expected);
+        if(expected) ++count;
+    }
+
+    /* Verify the data actually test both cases */
+    CORRADE_COMPARE_AS(count, std::size_t{0}, TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(count, Containers::arraySize(data), TestSuite::Compare::Less);
+}
+
+void IntersectionBatchTest::aabbFrustum() {
+    Volume data[23];
+    fillVolumes(data);
+
+    Containers::BitArray out{DirectInit, 3 + Containers::arraySize(data), true};
+    Containers::StridedArrayView1D<const Volume> view = data;
+    Intersection::aabbFrustum(view.slice(&Volume::center), view.slice(&Volume::extents), TestFrustum, out.exceptPrefix(3));
+    CORRADE_VERIFY(out[0] && out[1] && out[2]);
+
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        const bool expected = Intersection::aabbFrustum(data[i].center, data[i].extents, TestFrustum);
+        CORRADE_COMPARE(out[3 + i], expected);
+        if(expected) ++count;
+    }
+
+    CORRADE_COMPARE_AS(count, std::size_t{0}, TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(count, Containers::arraySize(data), TestSuite::Compare::Less);
+}
+
+void IntersectionBatchTest::sphereFrustum() {
+    Volume data[23];
+    fillVolumes(data);
+
+    Containers::BitArray out{DirectInit, 3 + Containers::arraySize(data), true};
+    Containers::StridedArrayView1D<const Volume> view = data;
+    Intersection::sphereFrustum(view.slice(&Volume::center), view.slice(&Volume::radius), TestFrustum, out.exceptPrefix(3));
+    CORRADE_VERIFY(out[0] && out[1] && out[2]);
+
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        const bool expected = Intersection::sphereFrustum(data[i].center, data[i].radius, TestFrustum);
+        CORRADE_COMPARE(out[3 + i], expected);
+        if(expected) ++count;
+    }
+
+    CORRADE_COMPARE_AS(count, std::size_t{0}, TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(count, Containers::arraySize(data), TestSuite::Compare::Less);
+}
+
+void IntersectionBatchTest::sphereCone() {
+    Volume data[23];
+    fillVolumes(data);
+
+    const Vector3 origin{-1.0f, 0.5f, -4.0f};
+    const Vector3 normal = Vector3{1.0f, 0.0f, 1.0f}.normalized();
+
+    Containers::BitArray out{DirectInit, 3 + Containers::arraySize(data), true};
+    Containers::StridedArrayView1D<const Volume> view = data;
+    Intersection::sphereCone(view.slice(&Volume::center), view.slice(&Volume::radius), origin, normal, 72.0_degf, out.exceptPrefix(3));
+    CORRADE_VERIFY(out[0] && out[1] && out[2]);
+
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        const bool expected = Intersection::sphereCone(data[i].center, data[i].radius, origin, normal, Math::Rad<Float>{72.0_degf});
+        CORRADE_COMPARE(out[3 + i], expected);
+        if(expected) ++count;
+    }
+
+    CORRADE_COMPARE_AS(count, std::size_t{0}, TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(count, Containers::arraySize(data), TestSuite::Compare::Less);
+}
+
+void IntersectionBatchTest::empty() {
+    /* Shouldn't crash or assert */
+    Intersection::rangeFrustum(nullptr, TestFrustum, nullptr);
+    Intersection::aabbFrustum(nullptr, nullptr, TestFrustum, nullptr);
+    Intersection::sphereFrustum(nullptr, nullptr, TestFrustum, nullptr);
+    Intersection::sphereCone(nullptr, nullptr, {}, Vector3::zAxis(), 72.0_degf, nullptr);
+    CORRADE_VERIFY(true);
+}
+
+void IntersectionBatchTest::assertions() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Range3D ranges[3];
+    Vector3 vectors[3];
+    Vector3 vectorsWrongCount[2];
+    Float radii[3];
+    Float radiiWrongCount[2];
+    Containers::BitArray bits{ValueInit, 3};
+    Containers::BitArray bitsWrongCount{ValueInit, 2};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Intersection::rangeFrustum(ranges, TestFrustum, bitsWrongCount);
+    Intersection::aabbFrustum(vectors, vectorsWrongCount, TestFrustum, bits);
+    Intersection::aabbFrustum(vectors, vectors, TestFrustum, bitsWrongCount);
+    Intersection::sphereFrustum(vectors, radiiWrongCount, TestFrustum, bits);
+    Intersection::sphereFrustum(vectors, radii, TestFrustum, bitsWrongCount);
+    Intersection::sphereCone(vectors, radiiWrongCount, {}, Vector3::zAxis(), 0.5f, 1.0f, bits);
+    Intersection::sphereCone(vectors, radii, {}, Vector3::zAxis(), 0.5f, 1.0f, bitsWrongCount);
+    CORRADE_COMPARE(out.str(),
+        "Math::Intersection::rangeFrustum(): wrong output size, got 2 but expected 3\n"
+        "Math::Intersection::aabbFrustum(): expected extents view to have 3 items but got 2\n"
+        "Math::Intersection::aabbFrustum(): wrong output size, got 2 but expected 3\n"
+        "Math::Intersection::sphereFrustum(): expected radii view to have 3 items but got 2\n"
+        "Math::Intersection::sphereFrustum(): wrong output size, got 2 but expected 3\n"
+        "Math::Intersection::sphereCone(): expected radii view to have 3 items but got 2\n"
+        "Math::Intersection::sphereCone(): wrong output size, got 2 but expected 3\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::IntersectionBatchTest)
@@ -26,10 +26,14 @@
 */
 
 #include <random>
+#include <Corrade/Containers/ArrayViewStl.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Angle.h"
 #include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/IntersectionBatch.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
 
@@ -111,6 +115,15 @@ struct IntersectionBenchmark: TestSuite::Tester {
     void sphereCone();
     void sphereConeView();
 
+    void rangeFrustumBatchBaseline();
+    void rangeFrustumBatch();
+    void aabbFrustumBatchBaseline();
+    void aabbFrustumBatch();
+    void sphereFrustumBatchBaseline();
+    void sphereFrustumBatch();
+    void sphereConeBatchBaseline();
+    void sphereConeBatch();
+
     Frustum _frustum;
     struct {
         Vector3 origin;
@@ -121,8 +134,19 @@ struct IntersectionBenchmark: TestSuite::Tester {
 
     std::vector<Range3D> _boxes;
     std::vector<Vector4> _spheres;
+
+    /* Large batch, stored as a structure of arrays */
+    std::vector<Range3D> _batchRanges;
+    std::vector<Vector3> _batchCenters;
+    std::vector<Vector3> _batchExtents;
+    std::vector<Float> _batchRadii;
+    Containers::BitArray _batchIntersects;
 };
 
+/* Roughly the amount of objects culled against a single view in a large
+   scene */
+constexpr std::size_t BatchSize = 200000;
+
 IntersectionBenchmark::IntersectionBenchmark() {
     addBenchmarks({&IntersectionBenchmark::rangeFrustumNaive,
                    &IntersectionBenchmark::rangeFrustum,
@@ -135,6 +159,15 @@ IntersectionBenchmark::IntersectionBenchmark() {
                    &IntersectionBenchmark::sphereCone,
                    &IntersectionBenchmark::sphereConeView}, 10);
 
+    addBenchmarks({&IntersectionBenchmark::rangeFrustumBatchBaseline,
+                   &IntersectionBenchmark::rangeFrustumBatch,
+                   &IntersectionBenchmark::aabbFrustumBatchBaseline,
+                   &IntersectionBenchmark::aabbFrustumBatch,
+                   &IntersectionBenchmark::sphereFrustumBatchBaseline,
+                   &IntersectionBenchmark::sphereFrustumBatch,
+                   &IntersectionBenchmark::sphereConeBatchBaseline,
+                   &IntersectionBenchmark::sphereConeBatch}, 5);
+
     /* Generate random data for the benchmarks */
     std::random_device rnd;
     std::mt19937 g(rnd());
@@ -157,6 +190,20 @@ IntersectionBenchmark::IntersectionBenchmark() {
         _boxes.emplace_back(center - extents, center + extents);
         _spheres.emplace_back(center, extents.length());
     }
+
+    _batchRanges.reserve(BatchSize);
+    _batchCenters.reserve(BatchSize);
+    _batchExtents.reserve(BatchSize);
+    _batchRadii.reserve(BatchSize);
+    for(std::size_t i = 0; i != BatchSize; ++i) {
+        Vector3 center{pd(g), pd(g), pd(g)};
+        Vector3 extents = Math::abs(Vector3{pd(g), pd(g), pd(g)})*0.1f;
+        _batchRanges.emplace_back(center - extents, center + extents);
+        _batchCenters.push_back(center);
+        _batchExtents.push_back(extents);
+        _batchRadii.push_back(extents.length());
+    }
+    _batchIntersects = Containers::BitArray{ValueInit, BatchSize};
 }
 
 void IntersectionBenchmark::rangeFrustumNaive() {
@@ -221,6 +268,68 @@ void IntersectionBenchmark::sphereConeView() {
     }
 }
 
+void IntersectionBenchmark::rangeFrustumBatchBaseline() {
+    CORRADE_BENCHMARK(1) for(std::size_t i = 0; i != BatchSize; ++i) {
+        if(Intersection::rangeFrustum(_batchRanges[i], _frustum))
+            _batchIntersects.set(i);
+        else _batchIntersects.reset(i);
+    }
+}
+
+void IntersectionBenchmark::rangeFrustumBatch() {
+    CORRADE_BENCHMARK(1) {
+        Intersection::rangeFrustum(_batchRanges, _frustum, _batchIntersects);
+    }
+}
+
+void IntersectionBenchmark::aabbFrustumBatchBaseline() {
+    CORRADE_BENCHMARK(1) for(std::size_t i = 0; i != BatchSize; ++i) {
+        if(Intersection::aabbFrustum(_batchCenters[i], _batchExtents[i], _frustum))
+            _batchIntersects.set(i);
+        else _batchIntersects.reset(i);
+    }
+}
+
+void IntersectionBenchmark::aabbFrustumBatch() {
+    CORRADE_BENCHMARK(1) {
+        Intersection::aabbFrustum(_batchCenters, _batchExtents, _frustum, _batchIntersects);
+    }
+}
+
+void IntersectionBenchmark::sphereFrustumBatchBaseline() {
+    CORRADE_BENCHMARK(1) for(std::size_t i = 0; i != BatchSize; ++i) {
+        if(Intersection::sphereFrustum(_batchCenters[i], _batchRadii[i], _frustum))
+            _batchIntersects.set(i);
+        else _batchIntersects.reset(i);
+    }
+}
+
+void IntersectionBenchmark::sphereFrustumBatch() {
+    CORRADE_BENCHMARK(1) {
+        Intersection::sphereFrustum(_batchCenters, _batchRadii, _frustum, _batchIntersects);
+    }
+}
+
+void IntersectionBenchmark::sphereConeBatchBaseline() {
+    const Float sinAngle = Math::sin(_cone.angle);
+    const Float tanAngle = Math::tan(_cone.angle);
+    const Float tanAngleSqPlusOne = tanAngle*tanAngle + 1.0f;
+    CORRADE_BENCHMARK(1) for(std::size_t i = 0; i != BatchSize; ++i) {
+        if(Intersection::sphereCone(_batchCenters[i], _batchRadii[i], _cone.origin, _cone.normal, sinAngle, tanAngleSqPlusOne))
+            _batchIntersects.set(i);
+        else _batchIntersects.reset(i);
+    }
+}
+
+void IntersectionBenchmark::sphereConeBatch() {
+    const Float sinAngle = Math::sin(_cone.angle);
+    const Float tanAngle = Math::tan(_cone.angle);
+    const Float tanAngleSqPlusOne = tanAngle*tanAngle + 1.0f;
+    CORRADE_BENCHMARK(1) {
+        Intersection::sphereCone(_batchCenters, _batchRadii, _cone.origin, _cone.normal, sinAngle, tanAngleSqPlusOne, _batchIntersects);
+    }
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::IntersectionBenchmark)
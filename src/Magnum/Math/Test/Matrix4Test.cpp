@@ -99,6 +99,10 @@ struct Matrix4Test: TestSuite::Tester {
     void perspectiveProjectionFovInfiniteFar();
     void perspectiveProjectionOffCenter();
     void perspectiveProjectionOffCenterInfiniteFar();
+    void perspectiveProjectionReverseZ();
+    void perspectiveProjectionReverseZInfiniteFar();
+    void perspectiveProjectionReverseZFov();
+    void perspectiveProjectionReverseZOffCenter();
     void lookAt();
 
     void fromParts();
@@ -177,6 +181,10 @@ Matrix4Test::Matrix4Test() {
               &Matrix4Test::perspectiveProjectionFovInfiniteFar,
               &Matrix4Test::perspectiveProjectionOffCenter,
               &Matrix4Test::perspectiveProjectionOffCenterInfiniteFar,
+              &Matrix4Test::perspectiveProjectionReverseZ,
+              &Matrix4Test::perspectiveProjectionReverseZInfiniteFar,
+              &Matrix4Test::perspectiveProjectionReverseZFov,
+              &Matrix4Test::perspectiveProjectionReverseZOffCenter,
               &Matrix4Test::lookAt,
 
               &Matrix4Test::fromParts,
@@ -752,6 +760,62 @@ void Matrix4Test::perspectiveProjectionOffCenterInfiniteFar() {
     CORRADE_COMPARE(actual.transformVector({0.0f, 0.0f, -1.0f}), Vector3(0.125f, 0.1111111f, +1.0f));
 }
 
+void Matrix4Test::perspectiveProjectionReverseZ() {
+    Matrix4 expected({4.0f,      0.0f,        0.0f,  0.0f},
+                     {0.0f, 7.111111f,        0.0f,  0.0f},
+                     {0.0f,      0.0f,  0.4705882f, -1.0f},
+                     {0.0f,      0.0f, 47.0588235f,  0.0f});
+    Matrix4 actual = Matrix4::perspectiveProjectionReverseZ({16.0f, 9.0f}, 32.0f, 100.0f);
+    CORRADE_COMPARE(actual, expected);
+
+    /* Point on near plane should be 1, far 0 */
+    CORRADE_COMPARE(actual.transformPoint({0.0f, 0.0f, -32.0f}), Vector3(0.0f, 0.0f, 1.0f));
+    CORRADE_COMPARE(actual.transformPoint({0.0f, 0.0f, -100.0f}), Vector3(0.0f, 0.0f, 0.0f));
+
+    /* The version with bottom/left/top/right should give the same result if
+       it's centered */
+    CORRADE_COMPARE(Matrix4::perspectiveProjectionReverseZ({-8.0f, -4.5f}, {8.0f, 4.5f}, 32.0f, 100.0f), expected);
+}
+
+void Matrix4Test::perspectiveProjectionReverseZInfiniteFar() {
+    Matrix4 expected({4.0f,      0.0f,  0.0f,  0.0f},
+                     {0.0f, 7.111111f,  0.0f,  0.0f},
+                     {0.0f,      0.0f,  0.0f, -1.0f},
+                     {0.0f,      0.0f, 32.0f,  0.0f});
+    Matrix4 actual = Matrix4::perspectiveProjectionReverseZ({16.0f, 9.0f}, 32.0f, Constants::inf());
+    CORRADE_COMPARE(actual, expected);
+
+    /* Point on near plane should be 1 and a *vector* in direction of far
+       plane 0 */
+    CORRADE_COMPARE(actual.transformPoint({0.0f, 0.0f, -32.0f}), Vector3(0.0f, 0.0f, 1.0f));
+    CORRADE_COMPARE(actual.transformVector({0.0f, 0.0f, -1.0f}), Vector3(0.0f, 0.0f, 0.0f));
+
+    /* The version with bottom/left/top/right should give the same result if
+       it's centered */
+    CORRADE_COMPARE(Matrix4::perspectiveProjectionReverseZ({-8.0f, -4.5f}, {8.0f, 4.5f}, 32.0f, Constants::inf()), expected);
+}
+
+void Matrix4Test::perspectiveProjectionReverseZFov() {
+    Matrix4 expected({4.1652994f,      0.0f,        0.0f,  0.0f},
+                     {      0.0f, 9.788454f,        0.0f,  0.0f},
+                     {      0.0f,      0.0f,  0.4705882f, -1.0f},
+                     {      0.0f,      0.0f, 47.0588235f,  0.0f});
+    CORRADE_COMPARE(Matrix4::perspectiveProjectionReverseZ(27.0_degf, 2.35f, 32.0f, 100.0f), expected);
+}
+
+void Matrix4Test::perspectiveProjectionReverseZOffCenter() {
+    Matrix4 expected({   4.0f,        0.0f,        0.0f,  0.0f},
+                     {   0.0f,   7.111111f,        0.0f,  0.0f},
+                     {-0.125f, -0.1111111f,  0.4705882f, -1.0f},
+                     {   0.0f,        0.0f, 47.0588235f,  0.0f});
+    /* Shifted by (-1, -0.5) compared to perspectiveProjectionReverseZ() */
+    Matrix4 actual = Matrix4::perspectiveProjectionReverseZ({-9.0f, -5.0f}, {7.0f, 4.0f}, 32.0f, 100.0f);
+    CORRADE_COMPARE(actual, expected);
+
+    CORRADE_COMPARE(actual.transformPoint({7.0f, 4.0f, -32.0f}), Vector3(1.0f, 1.0f, 1.0f));
+    CORRADE_COMPARE(actual.transformPoint({0.0f, 0.0f, -100.0f}), Vector3(0.125f, 0.1111111f, 0.0f));
+}
+
 void Matrix4Test::lookAt() {
     Vector3 translation{5.3f, -8.9f, -10.0f};
     Vector3 target{19.0f, 29.3f, 0.0f};
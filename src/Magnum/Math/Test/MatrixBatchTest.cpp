@@ -0,0 +1,277 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/MatrixBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct MatrixBatchTest: TestSuite::Tester {
+    explicit MatrixBatchTest();
+
+    void multiplyMatrix();
+    void multiplyMatrixInPlace();
+    void multiplyVector();
+    void transformPoints();
+    void transformVectors();
+    void transformInPlace();
+    void empty();
+
+    void assertions();
+};
+
+MatrixBatchTest::MatrixBatchTest() {
+    addTests({&MatrixBatchTest::multiplyMatrix,
+              &MatrixBatchTest::multiplyMatrixInPlace,
+              &MatrixBatchTest::multiplyVector,
+              &MatrixBatchTest::transformPoints,
+              &MatrixBatchTest::transformVectors,
+              &MatrixBatchTest::transformInPlace,
+              &MatrixBatchTest::empty,
+
+              &MatrixBatchTest::assertions});
+}
+
+using Magnum::Matrix4;
+using Magnum::Vector3;
+using Magnum::Vector4;
+
+using namespace Literals;
+
+const Matrix4 Matrices[]{
+    Matrix4::translation({1.0f, 2.0f, -3.0f})*Matrix4::rotationX(35.0_degf),
+    Matrix4::scaling({2.0f, 0.5f, 1.5f})*Matrix4::rotationZ(-120.0_degf),
+    Matrix4::perspectiveProjection(45.0_degf, 4.0f/3.0f, 0.1f, 100.0f),
+    Matrix4::rotation(77.0_degf, Vector3{1.0f, -1.0f, 2.0f}.normalized())*Matrix4::translation({0.5f, 0.0f, 7.0f}),
+    Matrix4{Math::IdentityInit},
+};
+
+void MatrixBatchTest::multiplyMatrix() {
+    /* Interleaved with other data and an odd count to verify strides and
+       remainder handling are correct */
+    struct Data {
+        Matrix4 a;
+        Int padding;
+        Matrix4 b;
+        Matrix4 dst;
+    } data[5];
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        data[i].a = Matrices[i];
+        data[i].b = Matrices[(i + 2) % Containers::arraySize(Matrices)];
+    }
+
+    Containers::StridedArrayView1D<Data> view = data;
+    multiplyInto(view.slice(&Data::a), view.slice(&Data::b), view.slice(&Data::dst));
+
+    /* Ensure the results are consistent with non-batch APIs */
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(data[i].dst, data[i].a*data[i].b);
+    }
+}
+
+void MatrixBatchTest::multiplyMatrixInPlace() {
+    Matrix4 a[5];
+    Matrix4 aCopy[5];
+    Matrix4 b[5];
+    Matrix4 expected[5];
+    for(std::size_t i = 0; i != Containers::arraySize(a); ++i) {
+        a[i] = aCopy[i] = Matrices[i];
+        b[i] = Matrices[(i + 3) % Containers::arraySize(Matrices)];
+        expected[i] = a[i]*b[i];
+    }
+
+    /* Aliasing the first input */
+    multiplyInto(aCopy, b, aCopy);
+    CORRADE_COMPARE_AS(Containers::arrayView(aCopy),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+
+    /* Aliasing the second input */
+    multiplyInto(a, b, b);
+    CORRADE_COMPARE_AS(Containers::arrayView(b),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void MatrixBatchTest::multiplyVector() {
+    const Matrix4 matrix = Matrices[0]*Matrices[2];
+
+    struct Data {
+        Vector4 src;
+        Byte padding;
+        Vector4 dst;
+    } data[]{
+        {{1.0f, 2.0f, 3.0f, 1.0f}, {}, {}},
+        {{-0.5f, 0.25f, 7.0f, 0.0f}, {}, {}},
+        {{0.0f, 0.0f, 0.0f, 1.0f}, {}, {}},
+        {{3.0f, -3.0f, 1.5f, 2.0f}, {}, {}},
+        {{100.0f, 0.1f, -25.0f, 1.0f}, {}, {}},
+    };
+
+    Containers::StridedArrayView1D<Data> view = data;
+    multiplyInto(matrix, view.slice(&Data::src), view.slice(&Data::dst));
+
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(data[i].dst, matrix*data[i].src);
+    }
+}
+
+void MatrixBatchTest::transformPoints() {
+    const Matrix4 matrix = Matrices[3]*Matrices[1];
+
+    struct Data {
+        Vector3 src;
+        Vector3 dst;
+    } data[]{
+        {{1.0f, 2.0f, 3.0f}, {}},
+        {{-0.5f, 0.25f, 7.0f}, {}},
+        {{0.0f, 0.0f, 0.0f}, {}},
+        {{3.0f, -3.0f, 1.5f}, {}},
+        {{100.0f, 0.1f, -25.0f}, {}},
+    };
+
+    Containers::StridedArrayView1D<Data> view = data;
+    transformPointsInto(matrix, view.slice(&Data::src), view.slice(&Data::dst));
+
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(data[i].dst, matrix.transformPoint(data[i].src));
+    }
+
+    /* Verify that the neighboring memory isn't overwritten by the
+       partial stores */
+    CORRADE_COMPARE(data[1].src, (Vector3{-0.5f, 0.25f, 7.0f}));
+}
+
+void MatrixBatchTest::transformVectors() {
+    const Matrix4 matrix = Matrices[3]*Matrices[1];
+
+    struct Data {
+        Vector3 src;
+        Vector3 dst;
+    } data[]{
+        {{1.0f, 2.0f, 3.0f}, {}},
+        {{-0.5f, 0.25f, 7.0f}, {}},
+        {{0.0f, 0.0f, 0.0f}, {}},
+        {{3.0f, -3.0f, 1.5f}, {}},
+        {{100.0f, 0.1f, -25.0f}, {}},
+    };
+
+    Containers::StridedArrayView1D<Data> view = data;
+    transformVectorsInto(matrix, view.slice(&Data::src), view.slice(&Data::dst));
+
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(data[i].dst, matrix.transformVector(data[i].src));
+    }
+
+    CORRADE_COMPARE(data[1].src, (Vector3{-0.5f, 0.25f, 7.0f}));
+}
+
+void MatrixBatchTest::transformInPlace() {
+    const Matrix4 matrix = Matrices[0];
+
+    Vector3 points[]{
+        {1.0f, 2.0f, 3.0f},
+        {-0.5f, 0.25f, 7.0f},
+        {3.0f, -3.0f, 1.5f},
+    };
+    Vector3 vectors[]{
+        {1.0f, 2.0f, 3.0f},
+        {-0.5f, 0.25f, 7.0f},
+        {3.0f, -3.0f, 1.5f},
+    };
+    Vector4 vectors4[]{
+        {1.0f, 2.0f, 3.0f, 1.0f},
+        {-0.5f, 0.25f, 7.0f, 0.0f},
+        {3.0f, -3.0f, 1.5f, 0.5f},
+    };
+    transformPointsInto(matrix, points, points);
+    transformVectorsInto(matrix, vectors, vectors);
+    multiplyInto(matrix, vectors4, vectors4);
+
+    CORRADE_COMPARE_AS(Containers::arrayView(points), Containers::arrayView<Vector3>({
+        matrix.transformPoint({1.0f, 2.0f, 3.0f}),
+        matrix.transformPoint({-0.5f, 0.25f, 7.0f}),
+        matrix.transformPoint({3.0f, -3.0f, 1.5f}),
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(vectors), Containers::arrayView<Vector3>({
+        matrix.transformVector({1.0f, 2.0f, 3.0f}),
+        matrix.transformVector({-0.5f, 0.25f, 7.0f}),
+        matrix.transformVector({3.0f, -3.0f, 1.5f}),
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(vectors4), Containers::arrayView<Vector4>({
+        matrix*Vector4{1.0f, 2.0f, 3.0f, 1.0f},
+        matrix*Vector4{-0.5f, 0.25f, 7.0f, 0.0f},
+        matrix*Vector4{3.0f, -3.0f, 1.5f, 0.5f},
+    }), TestSuite::Compare::Container);
+}
+
+void MatrixBatchTest::empty() {
+    /* Shouldn't crash or assert */
+    multiplyInto(Containers::StridedArrayView1D<const Matrix4>{}, nullptr, nullptr);
+    multiplyInto(Matrix4{}, Containers::StridedArrayView1D<const Vector4>{}, nullptr);
+    transformPointsInto(Matrix4{}, nullptr, nullptr);
+    transformVectorsInto(Matrix4{}, nullptr, nullptr);
+    CORRADE_VERIFY(true);
+}
+
+void MatrixBatchTest::assertions() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Matrix4 matrices[3];
+    Matrix4 matricesWrongCount[2];
+    Vector4 vectors4[3];
+    Vector4 vectors4WrongCount[2];
+    Vector3 vectors[3];
+    Vector3 vectorsWrongCount[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    multiplyInto(matrices, matricesWrongCount, matrices);
+    multiplyInto(matrices, matrices, matricesWrongCount);
+    multiplyInto(Matrix4{}, vectors4, vectors4WrongCount);
+    transformPointsInto(Matrix4{}, vectors, vectorsWrongCount);
+    transformVectorsInto(Matrix4{}, vectors, vectorsWrongCount);
+    CORRADE_COMPARE(out.str(),
+        "Math::multiplyInto(): expected second view to have 3 items but got 2\n"
+        "Math::multiplyInto(): wrong destination size, got 2 but expected 3\n"
+        "Math::multiplyInto(): wrong destination size, got 2 but expected 3\n"
+        "Math::transformPointsInto(): wrong destination size, got 2 but expected 3\n"
+        "Math::transformVectorsInto(): wrong destination size, got 2 but expected 3\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::MatrixBatchTest)
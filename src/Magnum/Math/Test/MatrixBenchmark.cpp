@@ -24,10 +24,13 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/MatrixBatch.h"
 #include "Magnum/Math/Algorithms/GaussJordan.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
@@ -53,6 +56,15 @@ struct MatrixBenchmark: TestSuite::Tester {
     void transformPoint3();
     void transformVector4();
     void transformPoint4();
+
+    void multiply4BatchBaseline();
+    void multiply4Batch();
+    void multiplyVector4BatchBaseline();
+    void multiplyVector4Batch();
+    void transformPoint4BatchBaseline();
+    void transformPoint4Batch();
+    void transformVector4BatchBaseline();
+    void transformVector4Batch();
 };
 
 MatrixBenchmark::MatrixBenchmark() {
@@ -74,6 +86,15 @@ MatrixBenchmark::MatrixBenchmark() {
                    &MatrixBenchmark::transformPoint3,
                    &MatrixBenchmark::transformVector4,
                    &MatrixBenchmark::transformPoint4}, 1000);
+
+    addBenchmarks({&MatrixBenchmark::multiply4BatchBaseline,
+                   &MatrixBenchmark::multiply4Batch,
+                   &MatrixBenchmark::multiplyVector4BatchBaseline,
+                   &MatrixBenchmark::multiplyVector4Batch,
+                   &MatrixBenchmark::transformPoint4BatchBaseline,
+                   &MatrixBenchmark::transformPoint4Batch,
+                   &MatrixBenchmark::transformVector4BatchBaseline,
+                   &MatrixBenchmark::transformVector4Batch}, 100);
 }
 
 using Magnum::Vector2;
@@ -82,7 +103,11 @@ using Magnum::Vector4;
 using Magnum::Matrix4;
 using Magnum::Matrix3;
 
-enum: std::size_t { Repeats = 10000 };
+enum: std::size_t {
+    Repeats = 10000,
+    BatchSize = 10000,
+    BatchRepeats = 10
+};
 
 using namespace Literals;
 
@@ -238,6 +263,92 @@ void MatrixBenchmark::transformPoint4() {
     CORRADE_VERIFY(a.sum() != 0);
 }
 
+void MatrixBenchmark::multiply4BatchBaseline() {
+    Containers::Array<Matrix4> a{DirectInit, BatchSize, Data4};
+    Containers::Array<Matrix4> b{DirectInit, BatchSize, Data4Rigid};
+    Containers::Array<Matrix4> out{NoInit, BatchSize};
+    CORRADE_BENCHMARK(BatchRepeats) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out[i] = a[i]*b[i];
+    }
+
+    CORRADE_COMPARE(out[BatchSize - 1], Data4*Data4Rigid);
+}
+
+void MatrixBenchmark::multiply4Batch() {
+    Containers::Array<Matrix4> a{DirectInit, BatchSize, Data4};
+    Containers::Array<Matrix4> b{DirectInit, BatchSize, Data4Rigid};
+    Containers::Array<Matrix4> out{NoInit, BatchSize};
+    CORRADE_BENCHMARK(BatchRepeats) {
+        Math::multiplyInto(a, b, out);
+    }
+
+    CORRADE_COMPARE(out[BatchSize - 1], Data4*Data4Rigid);
+}
+
+void MatrixBenchmark::multiplyVector4BatchBaseline() {
+    Containers::Array<Vector4> a{DirectInit, BatchSize, Vector4{1.0f, 3.0f, -2.2f, 1.0f}};
+    Containers::Array<Vector4> out{NoInit, BatchSize};
+    CORRADE_BENCHMARK(BatchRepeats) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out[i] = Data4*a[i];
+    }
+
+    CORRADE_COMPARE(out[BatchSize - 1], Data4*Vector4{1.0f, 3.0f, -2.2f, 1.0f});
+}
+
+void MatrixBenchmark::multiplyVector4Batch() {
+    Containers::Array<Vector4> a{DirectInit, BatchSize, Vector4{1.0f, 3.0f, -2.2f, 1.0f}};
+    Containers::Array<Vector4> out{NoInit, BatchSize};
+    CORRADE_BENCHMARK(BatchRepeats) {
+        Math::multiplyInto(Data4, a, out);
+    }
+
+    CORRADE_COMPARE(out[BatchSize - 1], Data4*Vector4{1.0f, 3.0f, -2.2f, 1.0f});
+}
+
+void MatrixBenchmark::transformPoint4BatchBaseline() {
+    Containers::Array<Vector3> a{DirectInit, BatchSize, Vector3{1.0f, 3.0f, -2.2f}};
+    Containers::Array<Vector3> out{NoInit, BatchSize};
+    CORRADE_BENCHMARK(BatchRepeats) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out[i] = Data4.transformPoint(a[i]);
+    }
+
+    CORRADE_COMPARE(out[BatchSize - 1], Data4.transformPoint({1.0f, 3.0f, -2.2f}));
+}
+
+void MatrixBenchmark::transformPoint4Batch() {
+    Containers::Array<Vector3> a{DirectInit, BatchSize, Vector3{1.0f, 3.0f, -2.2f}};
+    Containers::Array<Vector3> out{NoInit, BatchSize};
+    CORRADE_BENCHMARK(BatchRepeats) {
+        Math::transformPointsInto(Data4, a, out);
+    }
+
+    CORRADE_COMPARE(out[BatchSize - 1], Data4.transformPoint({1.0f, 3.0f, -2.2f}));
+}
+
+void MatrixBenchmark::transformVector4BatchBaseline() {
+    Containers::Array<Vector3> a{DirectInit, BatchSize, Vector3{1.0f, 3.0f, -2.2f}};
+    Containers::Array<Vector3> out{NoInit, BatchSize};
+    CORRADE_BENCHMARK(BatchRepeats) {
+        for(std::size_t i = 0; i != BatchSize; ++i)
+            out[i] = Data4.transformVector(a[i]);
+    }
+
+    CORRADE_COMPARE(out[BatchSize - 1], Data4.transformVector({1.0f, 3.0f, -2.2f}));
+}
+
+void MatrixBenchmark::transformVector4Batch() {
+    Containers::Array<Vector3> a{DirectInit, BatchSize, Vector3{1.0f, 3.0f, -2.2f}};
+    Containers::Array<Vector3> out{NoInit, BatchSize};
+    CORRADE_BENCHMARK(BatchRepeats) {
+        Math::transformVectorsInto(Data4, a, out);
+    }
+
+    CORRADE_COMPARE(out[BatchSize - 1], Data4.transformVector({1.0f, 3.0f, -2.2f}));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::MatrixBenchmark)
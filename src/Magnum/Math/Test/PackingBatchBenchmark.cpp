@@ -0,0 +1,172 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/PackingBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct PackingBatchBenchmark: TestSuite::Tester {
+    explicit PackingBatchBenchmark();
+
+    /* The throughput benchmarks rely on each case filling _bytes with the
+       total amount of data read and written during CORRADE_BENCHMARK() */
+    void throughputBegin();
+    std::uint64_t throughputEnd();
+
+    template<class T> void unpack();
+    template<class T> void pack();
+    void unpackHalf();
+    void packHalf();
+
+    private:
+        std::chrono::high_resolution_clock::time_point _begin;
+        std::size_t _bytes;
+};
+
+enum: std::size_t {
+    /* 16 MB of floats, i.e. 4M values */
+    Count = 4*1024*1024
+};
+
+PackingBatchBenchmark::PackingBatchBenchmark() {
+    addCustomBenchmarks({
+        &PackingBatchBenchmark::unpack<UnsignedByte>,
+        &PackingBatchBenchmark::unpack<Byte>,
+        &PackingBatchBenchmark::unpack<UnsignedShort>,
+        &PackingBatchBenchmark::unpack<Short>,
+        &PackingBatchBenchmark::pack<UnsignedByte>,
+        &PackingBatchBenchmark::pack<Byte>,
+        &PackingBatchBenchmark::pack<UnsignedShort>,
+        &PackingBatchBenchmark::pack<Short>,
+        &PackingBatchBenchmark::unpackHalf,
+        &PackingBatchBenchmark::packHalf}, 10,
+        &PackingBatchBenchmark::throughputBegin,
+        &PackingBatchBenchmark::throughputEnd,
+        BenchmarkUnits::Count);
+
+    /* Run all benchmarks again but with the usual time measurement */
+    addBenchmarks({
+        &PackingBatchBenchmark::unpack<UnsignedByte>,
+        &PackingBatchBenchmark::unpack<Byte>,
+        &PackingBatchBenchmark::unpack<UnsignedShort>,
+        &PackingBatchBenchmark::unpack<Short>,
+        &PackingBatchBenchmark::pack<UnsignedByte>,
+        &PackingBatchBenchmark::pack<Byte>,
+        &PackingBatchBenchmark::pack<UnsignedShort>,
+        &PackingBatchBenchmark::pack<Short>,
+        &PackingBatchBenchmark::unpackHalf,
+        &PackingBatchBenchmark::packHalf}, 10);
+}
+
+void PackingBatchBenchmark::throughputBegin() {
+    setBenchmarkName("MB/s");
+    _bytes = 0;
+    _begin = std::chrono::high_resolution_clock::now();
+}
+
+std::uint64_t PackingBatchBenchmark::throughputEnd() {
+    const std::uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - _begin).count();
+    /* If the test failed or was too fast to measure, exit early as
+       continuing would cause a division by zero */
+    if(!ns) return {};
+
+    /* Bytes per nanosecond is GB/s, multiplied by 1000 to get MB/s */
+    return _bytes*1000ull/ns;
+}
+
+template<class T> void PackingBatchBenchmark::unpack() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<T> src{NoInit, Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        src[i] = T(i*7);
+    Containers::Array<Float> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(1) {
+        unpackInto(Containers::arrayCast<2, T>(Containers::stridedArrayView(src)),
+                   Containers::arrayCast<2, Float>(Containers::stridedArrayView(dst)));
+        _bytes = Count*(sizeof(T) + sizeof(Float));
+    }
+
+    CORRADE_COMPARE(dst[Count - 1], Math::unpack<Float>(src[Count - 1]));
+}
+
+template<class T> void PackingBatchBenchmark::pack() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    Containers::Array<Float> src{NoInit, Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        src[i] = Math::unpack<Float>(T(i*7));
+    Containers::Array<T> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(1) {
+        packInto(Containers::arrayCast<2, Float>(Containers::stridedArrayView(src)),
+                 Containers::arrayCast<2, T>(Containers::stridedArrayView(dst)));
+        _bytes = Count*(sizeof(Float) + sizeof(T));
+    }
+
+    CORRADE_COMPARE(dst[Count - 1], Math::pack<T>(src[Count - 1]));
+}
+
+void PackingBatchBenchmark::unpackHalf() {
+    Containers::Array<UnsignedShort> src{NoInit, Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        src[i] = Math::packHalf(Float(i % 2048)*0.5f);
+    Containers::Array<Float> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(1) {
+        unpackHalfInto(Containers::arrayCast<2, UnsignedShort>(Containers::stridedArrayView(src)),
+                       Containers::arrayCast<2, Float>(Containers::stridedArrayView(dst)));
+        _bytes = Count*(sizeof(UnsignedShort) + sizeof(Float));
+    }
+
+    CORRADE_COMPARE(dst[Count - 1], Math::unpackHalf(src[Count - 1]));
+}
+
+void PackingBatchBenchmark::packHalf() {
+    Containers::Array<Float> src{NoInit, Count};
+    for(std::size_t i = 0; i != Count; ++i)
+        src[i] = Float(i % 2048)*0.5f;
+    Containers::Array<UnsignedShort> dst{NoInit, Count};
+
+    CORRADE_BENCHMARK(1) {
+        packHalfInto(Containers::arrayCast<2, Float>(Containers::stridedArrayView(src)),
+                     Containers::arrayCast<2, UnsignedShort>(Containers::stridedArrayView(dst)));
+        _bytes = Count*(sizeof(Float) + sizeof(UnsignedShort));
+    }
+
+    CORRADE_COMPARE(dst[Count - 1], Math::packHalf(src[Count - 1]));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::PackingBatchBenchmark)
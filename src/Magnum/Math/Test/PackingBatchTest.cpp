@@ -24,7 +24,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <limits>
 #include <sstream>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
@@ -52,6 +54,14 @@ struct PackingBatchTest: TestSuite::Tester {
     void unpackHalf();
     void packHalf();
 
+    void unpackInt1010102();
+    void packInt1010102();
+    void unpackUnsignedInt1010102();
+    void packUnsignedInt1010102();
+
+    template<class T> void packUnpackAllValues();
+    void packUnpackHalfAllValues();
+
     template<class FloatingPoint, class Integral> void castUnsignedFloatingPoint();
     template<class FloatingPoint, class Integral> void castSignedFloatingPoint();
 
@@ -61,6 +71,7 @@ struct PackingBatchTest: TestSuite::Tester {
 
     template<class T> void assertionsPackUnpack();
     void assertionsPackUnpackHalf();
+    void assertionsPackUnpack1010102();
     template<class U, class T> void assertionsCast();
 };
 
@@ -77,6 +88,17 @@ PackingBatchTest::PackingBatchTest() {
               &PackingBatchTest::unpackHalf,
               &PackingBatchTest::packHalf,
 
+              &PackingBatchTest::unpackInt1010102,
+              &PackingBatchTest::packInt1010102,
+              &PackingBatchTest::unpackUnsignedInt1010102,
+              &PackingBatchTest::packUnsignedInt1010102,
+
+              &PackingBatchTest::packUnpackAllValues<UnsignedByte>,
+              &PackingBatchTest::packUnpackAllValues<Byte>,
+              &PackingBatchTest::packUnpackAllValues<UnsignedShort>,
+              &PackingBatchTest::packUnpackAllValues<Short>,
+              &PackingBatchTest::packUnpackHalfAllValues,
+
               &PackingBatchTest::castUnsignedFloatingPoint<Float, UnsignedByte>,
               &PackingBatchTest::castUnsignedFloatingPoint<Float, UnsignedShort>,
               &PackingBatchTest::castUnsignedFloatingPoint<Float, UnsignedInt>,
@@ -119,6 +141,7 @@ PackingBatchTest::PackingBatchTest() {
               &PackingBatchTest::assertionsPackUnpack<UnsignedShort>,
               &PackingBatchTest::assertionsPackUnpack<Short>,
               &PackingBatchTest::assertionsPackUnpackHalf,
+              &PackingBatchTest::assertionsPackUnpack1010102,
               &PackingBatchTest::assertionsCast<Float, UnsignedByte>,
               &PackingBatchTest::assertionsCast<Float, Byte>,
               &PackingBatchTest::assertionsCast<Float, UnsignedShort>,
@@ -459,6 +482,183 @@ void PackingBatchTest::packHalf() {
         CORRADE_COMPARE(Math::packHalf(data[i].src), data[i].dst);
 }
 
+void PackingBatchTest::unpackInt1010102() {
+    const UnsignedInt src[]{
+        0xc00805ff,
+        0x70000100,
+        /* -512 and -2 get clamped to -1 */
+        0x80000200
+    };
+
+    Vector4 dst[3];
+    unpackInt1010102Into(src, Containers::arrayCast<2, Float>(Containers::arrayView(dst)));
+    CORRADE_COMPARE_AS(Containers::arrayView(dst), Containers::arrayView<Vector4>({
+        {1.0f, -1.0f, 0.0f, -1.0f},
+        {256.0f/511.0f, 0.0f, -256.0f/511.0f, 1.0f},
+        {-1.0f, 0.0f, 0.0f, -1.0f}
+    }), TestSuite::Compare::Container);
+
+    /* The top bits get ignored for three-component output */
+    Vector3 dst3[3];
+    unpackInt1010102Into(src, Containers::arrayCast<2, Float>(Containers::arrayView(dst3)));
+    CORRADE_COMPARE_AS(Containers::arrayView(dst3), Containers::arrayView<Vector3>({
+        {1.0f, -1.0f, 0.0f},
+        {256.0f/511.0f, 0.0f, -256.0f/511.0f},
+        {-1.0f, 0.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+}
+
+void PackingBatchTest::packInt1010102() {
+    const Vector4 src[]{
+        {1.0f, -1.0f, 0.0f, -1.0f},
+        {0.5f, 0.0f, -0.5f, 1.0f},
+        /* Out-of-range values get clamped */
+        {2.0f, -3.0f, 0.0f, 7.0f}
+    };
+
+    UnsignedInt dst[3];
+    packInt1010102Into(Containers::arrayCast<2, const Float>(Containers::arrayView(src)), dst);
+    CORRADE_COMPARE_AS(Containers::arrayView(dst), Containers::arrayView<UnsignedInt>({
+        0xc00805ff,
+        0x70000100,
+        0x400805ff
+    }), TestSuite::Compare::Container);
+
+    /* The top bits are zero for three-component input */
+    const Vector3 src3[]{
+        {1.0f, 1.0f, 1.0f},
+        {-1.0f, 0.0f, 0.0f}
+    };
+    UnsignedInt dst3[2];
+    packInt1010102Into(Containers::arrayCast<2, const Float>(Containers::arrayView(src3)), dst3);
+    CORRADE_COMPARE_AS(Containers::arrayView(dst3), Containers::arrayView<UnsignedInt>({
+        0x1ff7fdff,
+        0x00000201
+    }), TestSuite::Compare::Container);
+}
+
+void PackingBatchTest::unpackUnsignedInt1010102() {
+    const UnsignedInt src[]{
+        0xe00003ff,
+        0x400ffc00
+    };
+
+    Vector4 dst[2];
+    unpackUnsignedInt1010102Into(src, Containers::arrayCast<2, Float>(Containers::arrayView(dst)));
+    CORRADE_COMPARE_AS(Containers::arrayView(dst), Containers::arrayView<Vector4>({
+        {1.0f, 0.0f, 512.0f/1023.0f, 1.0f},
+        {0.0f, 1.0f, 0.0f, 1.0f/3.0f}
+    }), TestSuite::Compare::Container);
+
+    Vector3 dst3[2];
+    unpackUnsignedInt1010102Into(src, Containers::arrayCast<2, Float>(Containers::arrayView(dst3)));
+    CORRADE_COMPARE_AS(Containers::arrayView(dst3), Containers::arrayView<Vector3>({
+        {1.0f, 0.0f, 512.0f/1023.0f},
+        {0.0f, 1.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+}
+
+void PackingBatchTest::packUnsignedInt1010102() {
+    const Vector4 src[]{
+        {1.0f, 0.0f, 0.5f, 1.0f},
+        {0.0f, 1.0f, 0.0f, 1.0f/3.0f},
+        /* Out-of-range values get clamped */
+        {-1.0f, 2.0f, 0.0f, 5.0f}
+    };
+
+    UnsignedInt dst[3];
+    packUnsignedInt1010102Into(Containers::arrayCast<2, const Float>(Containers::arrayView(src)), dst);
+    CORRADE_COMPARE_AS(Containers::arrayView(dst), Containers::arrayView<UnsignedInt>({
+        0xe00003ff,
+        0x400ffc00,
+        0xc00ffc00
+    }), TestSuite::Compare::Container);
+
+    const Vector3 src3[]{
+        {1.0f, 1.0f, 1.0f}
+    };
+    UnsignedInt dst3[1];
+    packUnsignedInt1010102Into(Containers::arrayCast<2, const Float>(Containers::arrayView(src3)), dst3);
+    CORRADE_COMPARE(dst3[0], 0x3fffffff);
+}
+
+template<class T> void PackingBatchTest::packUnpackAllValues() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    /* All possible values, in a contiguous view so the whole range goes
+       through the SIMD implementation (if available) instead of just the
+       remainder. The count is not divisible by four nor eight so the scalar
+       remainder is tested as well. */
+    Containers::Array<T> src{NoInit, (std::size_t(1) << sizeof(T)*8) - 1};
+    for(std::size_t i = 0; i != src.size(); ++i)
+        src[i] = T(i + std::size_t(std::numeric_limits<T>::min()));
+
+    Containers::Array<Float> unpacked{NoInit, src.size()};
+    unpackInto(Containers::arrayCast<2, T>(Containers::stridedArrayView(src)),
+               Containers::arrayCast<2, Float>(Containers::stridedArrayView(unpacked)));
+
+    /* Ensure the results are consistent with non-batch APIs */
+    for(std::size_t i = 0; i != src.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(unpacked[i], Math::unpack<Float>(src[i]));
+    }
+
+    /* Packing back should result in the same values again */
+    Containers::Array<T> packed{NoInit, src.size()};
+    packInto(Containers::arrayCast<2, Float>(Containers::stridedArrayView(unpacked)),
+             Containers::arrayCast<2, T>(Containers::stridedArrayView(packed)));
+    /* The most negative value gets clamped to -1.0, which then packs to the
+       second most negative value */
+    if(std::is_signed<T>::value)
+        ++src[0];
+    CORRADE_COMPARE_AS(packed, src,
+        TestSuite::Compare::Container);
+}
+
+void PackingBatchTest::packUnpackHalfAllValues() {
+    /* All possible half-float values except NaNs, which aren't guaranteed to
+       preserve payload bits, in a contiguous view to go through the SIMD
+       implementation (if available) */
+    Containers::Array<UnsignedShort> src;
+    for(UnsignedInt i = 0; i != 65536; ++i) {
+        if((i & 0x7c00) == 0x7c00 && (i & 0x03ff))
+            continue;
+        arrayAppend(src, UnsignedShort(i));
+    }
+
+    Containers::Array<Float> unpacked{NoInit, src.size()};
+    unpackHalfInto(Containers::arrayCast<2, UnsignedShort>(Containers::stridedArrayView(src)),
+                   Containers::arrayCast<2, Float>(Containers::stridedArrayView(unpacked)));
+
+    /* Ensure the results are consistent with non-batch APIs */
+    for(std::size_t i = 0; i != src.size(); ++i) {
+        CORRADE_ITERATION(src[i]);
+        CORRADE_COMPARE(unpacked[i], Math::unpackHalf(src[i]));
+    }
+
+    /* All values are exactly representable, so packing back should result in
+       the same values again */
+    Containers::Array<UnsignedShort> packed{NoInit, src.size()};
+    packHalfInto(Containers::arrayCast<2, Float>(Containers::stridedArrayView(unpacked)),
+                 Containers::arrayCast<2, UnsignedShort>(Containers::stridedArrayView(packed)));
+    CORRADE_COMPARE_AS(packed, src,
+        TestSuite::Compare::Container);
+
+    /* Values that overflow the half-float range should become an infinity,
+       same as with the non-SIMD implementation */
+    const Float overflow[]{
+        65536.0f, -65536.0f, 1.0e10f, -Constants::inf(), 65519.0f,
+        70000.0f, 1.0f, 2.0f, 3.0f
+    };
+    UnsignedShort overflowPacked[Containers::arraySize(overflow)];
+    packHalfInto(Containers::arrayCast<2, const Float>(Containers::stridedArrayView(overflow)),
+                 Containers::arrayCast<2, UnsignedShort>(Containers::stridedArrayView(overflowPacked)));
+    CORRADE_COMPARE_AS(Containers::arrayView(overflowPacked), Containers::arrayView<UnsignedShort>({
+        0x7c00, 0xfc00, 0x7c00, 0xfc00, 0x7bff,
+        0x7c00, 0x3c00, 0x4000, 0x4200
+    }), TestSuite::Compare::Container);
+}
+
 template<class FloatingPoint, class Integral> void PackingBatchTest::castUnsignedFloatingPoint() {
     setTestCaseTemplateName({TypeTraits<FloatingPoint>::name(), TypeTraits<Integral>::name()});
 
@@ -739,6 +939,50 @@ void PackingBatchTest::assertionsPackUnpackHalf() {
         "Math::packHalfInto(): second destination view dimension is not contiguous\n");
 }
 
+void PackingBatchTest::assertionsPackUnpack1010102() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt packed[2]{};
+    Vector4 unpackedWrongCount[1]{};
+    Vector2 unpackedWrongVectorSize[2]{};
+    Float unpackedNonContiguous[2*6]{};
+
+    auto dstWrongCount = Containers::arrayCast<2, Float>(
+        Containers::arrayView(unpackedWrongCount));
+    auto dstWrongVectorSize = Containers::arrayCast<2, Float>(
+        Containers::arrayView(unpackedWrongVectorSize));
+    auto dstNotContiguous = Containers::StridedArrayView2D<Float>{
+        unpackedNonContiguous, {2, 6}}.every({1, 2});
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    unpackInt1010102Into(packed, dstWrongCount);
+    unpackInt1010102Into(packed, dstWrongVectorSize);
+    unpackInt1010102Into(packed, dstNotContiguous);
+    packInt1010102Into(dstWrongCount, packed);
+    packInt1010102Into(dstWrongVectorSize, packed);
+    packInt1010102Into(dstNotContiguous, packed);
+    unpackUnsignedInt1010102Into(packed, dstWrongCount);
+    unpackUnsignedInt1010102Into(packed, dstWrongVectorSize);
+    unpackUnsignedInt1010102Into(packed, dstNotContiguous);
+    packUnsignedInt1010102Into(dstWrongCount, packed);
+    packUnsignedInt1010102Into(dstWrongVectorSize, packed);
+    packUnsignedInt1010102Into(dstNotContiguous, packed);
+    CORRADE_COMPARE(out.str(),
+        "Math::unpackInt1010102Into(): wrong destination size, got 1 but expected 2\n"
+        "Math::unpackInt1010102Into(): expected destination second dimension size to be 3 or 4 but got 2\n"
+        "Math::unpackInt1010102Into(): second destination view dimension is not contiguous\n"
+        "Math::packInt1010102Into(): wrong destination size, got 2 but expected 1\n"
+        "Math::packInt1010102Into(): expected source second dimension size to be 3 or 4 but got 2\n"
+        "Math::packInt1010102Into(): second source view dimension is not contiguous\n"
+        "Math::unpackUnsignedInt1010102Into(): wrong destination size, got 1 but expected 2\n"
+        "Math::unpackUnsignedInt1010102Into(): expected destination second dimension size to be 3 or 4 but got 2\n"
+        "Math::unpackUnsignedInt1010102Into(): second destination view dimension is not contiguous\n"
+        "Math::packUnsignedInt1010102Into(): wrong destination size, got 2 but expected 1\n"
+        "Math::packUnsignedInt1010102Into(): expected source second dimension size to be 3 or 4 but got 2\n"
+        "Math::packUnsignedInt1010102Into(): second source view dimension is not contiguous\n");
+}
+
 template<class U, class T> void PackingBatchTest::assertionsCast() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -0,0 +1,267 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/QuaternionBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct QuaternionBatchTest: TestSuite::Tester {
+    explicit QuaternionBatchTest();
+
+    void interpolate();
+    void interpolateInPlace();
+    void interpolateBroadcastPhase();
+    void dualQuaternionLerpShortestPath();
+    void empty();
+
+    void assertions();
+};
+
+using Magnum::Quaternion;
+using Magnum::DualQuaternion;
+using Magnum::Vector3;
+
+using namespace Literals;
+
+const struct {
+    const char* name;
+    void(*batch)(const Containers::StridedArrayView1D<const Quaternion>&, const Containers::StridedArrayView1D<const Quaternion>&, const Containers::StridedArrayView1D<const Float>&, const Containers::StridedArrayView1D<Quaternion>&);
+    Quaternion(*single)(const Quaternion&, const Quaternion&, Float);
+} InterpolateData[]{
+    {"lerp", lerpInto, lerp<Float>},
+    {"lerp shortest path", lerpShortestPathInto, lerpShortestPath<Float>},
+    {"slerp", slerpInto, slerp<Float>},
+    {"slerp shortest path", slerpShortestPathInto, slerpShortestPath<Float>},
+};
+
+QuaternionBatchTest::QuaternionBatchTest() {
+    addInstancedTests({&QuaternionBatchTest::interpolate,
+                       &QuaternionBatchTest::interpolateInPlace,
+                       &QuaternionBatchTest::interpolateBroadcastPhase},
+        Containers::arraySize(InterpolateData));
+
+    addTests({&QuaternionBatchTest::dualQuaternionLerpShortestPath,
+              &QuaternionBatchTest::empty,
+
+              &QuaternionBatchTest::assertions});
+}
+
+/* Covering the general case, the same and opposite quaternions which trigger
+   the linear fallback in slerp, angles going both in the short and the long
+   direction, and a count that isn't divisible by four to test the remainder
+   handling */
+const Quaternion QuaternionsA[]{
+    Quaternion::rotation(15.0_degf, Vector3{1.0f, 2.0f, -1.0f}.normalized()),
+    Quaternion::rotation(225.0_degf, Vector3::zAxis()),
+    Quaternion::rotation(37.0_degf, Vector3::xAxis()),
+    Quaternion::rotation(-78.0_degf, Vector3{0.5f, 0.0f, 1.0f}.normalized()),
+    Quaternion::rotation(120.0_degf, Vector3::yAxis()),
+    Quaternion::rotation(45.0_degf, Vector3::zAxis()),
+    Quaternion{},
+};
+const Quaternion QuaternionsB[]{
+    Quaternion::rotation(170.0_degf, Vector3{-1.0f, 0.0f, 1.0f}.normalized()),
+    Quaternion::rotation(0.0_degf, Vector3::zAxis()),
+    Quaternion::rotation(37.0_degf, Vector3::xAxis()),
+    -Quaternion::rotation(-78.0_degf, Vector3{0.5f, 0.0f, 1.0f}.normalized()),
+    Quaternion::rotation(-150.0_degf, Vector3::yAxis()),
+    Quaternion::rotation(46.0_degf, Vector3::zAxis()),
+    Quaternion::rotation(90.0_degf, Vector3::xAxis()),
+};
+const Float Phases[]{
+    0.25f, 0.5f, 0.8f, 0.5f, 0.0f, 1.0f, 0.333f
+};
+
+void QuaternionBatchTest::interpolate() {
+    auto&& data = InterpolateData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Interleaved with other data to verify strides are correct */
+    struct Data {
+        Quaternion a;
+        Int padding;
+        Quaternion b;
+        Float t;
+        Quaternion dst;
+    } items[Containers::arraySize(QuaternionsA)];
+    for(std::size_t i = 0; i != Containers::arraySize(items); ++i) {
+        items[i].a = QuaternionsA[i];
+        items[i].b = QuaternionsB[i];
+        items[i].t = Phases[i];
+    }
+
+    Containers::StridedArrayView1D<Data> view = items;
+    data.batch(view.slice(&Data::a), view.slice(&Data::b), view.slice(&Data::t), view.slice(&Data::dst));
+
+    /* Ensure the results are consistent with non-batch APIs */
+    for(std::size_t i = 0; i != Containers::arraySize(items); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(items[i].dst, data.single(items[i].a, items[i].b, items[i].t));
+    }
+}
+
+void QuaternionBatchTest::interpolateInPlace() {
+    auto&& data = InterpolateData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Quaternion a[Containers::arraySize(QuaternionsA)];
+    Quaternion b[Containers::arraySize(QuaternionsB)];
+    Quaternion expected[Containers::arraySize(QuaternionsA)];
+    for(std::size_t i = 0; i != Containers::arraySize(a); ++i) {
+        a[i] = QuaternionsA[i];
+        b[i] = QuaternionsB[i];
+        expected[i] = data.single(a[i], b[i], Phases[i]);
+    }
+
+    /* Aliasing the first input */
+    data.batch(a, QuaternionsB, Phases, a);
+    CORRADE_COMPARE_AS(Containers::arrayView(a),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+
+    /* Aliasing the second input */
+    data.batch(QuaternionsA, b, Phases, b);
+    CORRADE_COMPARE_AS(Containers::arrayView(b),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void QuaternionBatchTest::interpolateBroadcastPhase() {
+    auto&& data = InterpolateData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Float t = 0.375f;
+    Quaternion dst[Containers::arraySize(QuaternionsA)];
+    data.batch(QuaternionsA, QuaternionsB, Containers::stridedArrayView(&t, 1).broadcasted<0>(Containers::arraySize(QuaternionsA)), dst);
+
+    for(std::size_t i = 0; i != Containers::arraySize(dst); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(dst[i], data.single(QuaternionsA[i], QuaternionsB[i], t));
+    }
+}
+
+void QuaternionBatchTest::dualQuaternionLerpShortestPath() {
+    struct Data {
+        DualQuaternion a;
+        Byte padding;
+        DualQuaternion b;
+        Float t;
+        DualQuaternion dst;
+    } items[Containers::arraySize(QuaternionsA)];
+    for(std::size_t i = 0; i != Containers::arraySize(items); ++i) {
+        items[i].a = DualQuaternion::translation({1.0f, -2.0f, Float(i)})*DualQuaternion{QuaternionsA[i]};
+        items[i].b = DualQuaternion{QuaternionsB[i]}*DualQuaternion::translation({0.5f, 3.0f, -1.0f});
+        items[i].t = Phases[i];
+    }
+
+    Containers::StridedArrayView1D<Data> view = items;
+    lerpShortestPathInto(view.slice(&Data::a), view.slice(&Data::b), view.slice(&Data::t), view.slice(&Data::dst));
+
+    for(std::size_t i = 0; i != Containers::arraySize(items); ++i) {
+        CORRADE_ITERATION(i);
+
+        /* There's no single-value API to compare to, calculate manually */
+        const DualQuaternion& a = items[i].a;
+        const DualQuaternion& b = items[i].b;
+        const Float t = items[i].t;
+        const DualQuaternion shortestA = dot(a.real(), b.real()) < 0.0f ? -a : a;
+        const DualQuaternion blended = shortestA*(1.0f - t) + b*t;
+        const DualQuaternion expected = blended/blended.real().length();
+        CORRADE_COMPARE(items[i].dst, expected);
+        CORRADE_VERIFY(items[i].dst.isNormalized());
+    }
+
+    /* For t = 1 it should give back the second input, for t = 0 the first
+       input negated as the two rotations are more than 180° apart */
+    CORRADE_COMPARE(items[5].dst, items[5].b);
+    CORRADE_COMPARE(items[4].dst, -items[4].a);
+}
+
+void QuaternionBatchTest::empty() {
+    /* Shouldn't crash or assert */
+    lerpInto(nullptr, nullptr, nullptr, nullptr);
+    lerpShortestPathInto(Containers::StridedArrayView1D<const Quaternion>{}, nullptr, nullptr, nullptr);
+    slerpInto(nullptr, nullptr, nullptr, nullptr);
+    slerpShortestPathInto(nullptr, nullptr, nullptr, nullptr);
+    lerpShortestPathInto(Containers::StridedArrayView1D<const DualQuaternion>{}, nullptr, nullptr, nullptr);
+    CORRADE_VERIFY(true);
+}
+
+void QuaternionBatchTest::assertions() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Quaternion quaternions[3];
+    Quaternion quaternionsWrongCount[2];
+    DualQuaternion dualQuaternions[3];
+    DualQuaternion dualQuaternionsWrongCount[2];
+    Float phases[3]{};
+    Float phasesWrongCount[2]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    lerpInto(quaternions, quaternionsWrongCount, phases, quaternions);
+    lerpInto(quaternions, quaternions, phasesWrongCount, quaternions);
+    lerpInto(quaternions, quaternions, phases, quaternionsWrongCount);
+    lerpShortestPathInto(quaternions, quaternionsWrongCount, phases, quaternions);
+    lerpShortestPathInto(quaternions, quaternions, phasesWrongCount, quaternions);
+    lerpShortestPathInto(quaternions, quaternions, phases, quaternionsWrongCount);
+    slerpInto(quaternions, quaternionsWrongCount, phases, quaternions);
+    slerpInto(quaternions, quaternions, phasesWrongCount, quaternions);
+    slerpInto(quaternions, quaternions, phases, quaternionsWrongCount);
+    slerpShortestPathInto(quaternions, quaternionsWrongCount, phases, quaternions);
+    slerpShortestPathInto(quaternions, quaternions, phasesWrongCount, quaternions);
+    slerpShortestPathInto(quaternions, quaternions, phases, quaternionsWrongCount);
+    lerpShortestPathInto(dualQuaternions, dualQuaternionsWrongCount, phases, dualQuaternions);
+    lerpShortestPathInto(dualQuaternions, dualQuaternions, phasesWrongCount, dualQuaternions);
+    lerpShortestPathInto(dualQuaternions, dualQuaternions, phases, dualQuaternionsWrongCount);
+    CORRADE_COMPARE(out.str(),
+        "Math::lerpInto(): expected second view to have 3 items but got 2\n"
+        "Math::lerpInto(): expected interpolation phase view to have 3 items but got 2\n"
+        "Math::lerpInto(): wrong destination size, got 2 but expected 3\n"
+        "Math::lerpShortestPathInto(): expected second view to have 3 items but got 2\n"
+        "Math::lerpShortestPathInto(): expected interpolation phase view to have 3 items but got 2\n"
+        "Math::lerpShortestPathInto(): wrong destination size, got 2 but expected 3\n"
+        "Math::slerpInto(): expected second view to have 3 items but got 2\n"
+        "Math::slerpInto(): expected interpolation phase view to have 3 items but got 2\n"
+        "Math::slerpInto(): wrong destination size, got 2 but expected 3\n"
+        "Math::slerpShortestPathInto(): expected second view to have 3 items but got 2\n"
+        "Math::slerpShortestPathInto(): expected interpolation phase view to have 3 items but got 2\n"
+        "Math::slerpShortestPathInto(): wrong destination size, got 2 but expected 3\n"
+        "Math::lerpShortestPathInto(): expected second view to have 3 items but got 2\n"
+        "Math::lerpShortestPathInto(): expected interpolation phase view to have 3 items but got 2\n"
+        "Math::lerpShortestPathInto(): wrong destination size, got 2 but expected 3\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::QuaternionBatchTest)
@@ -0,0 +1,333 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/VectorSoA.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct VectorSoATest: TestSuite::Tester {
+    explicit VectorSoATest();
+
+    void constructDefault();
+    void construct();
+    void constructNoInit();
+    void constructFromView();
+    void constructGeneric();
+    void constructMove();
+
+    void access();
+    void components();
+    void copyFrom();
+    void copyInto();
+
+    void componentOutOfRange();
+    void accessOutOfRange();
+    void copyWrongSize();
+};
+
+using Magnum::Vector2;
+using Magnum::Vector3;
+using Magnum::Vector4;
+
+VectorSoATest::VectorSoATest() {
+    addTests({&VectorSoATest::constructDefault,
+              &VectorSoATest::construct,
+              &VectorSoATest::constructNoInit,
+              &VectorSoATest::constructFromView,
+              &VectorSoATest::constructGeneric,
+              &VectorSoATest::constructMove,
+
+              &VectorSoATest::access,
+              &VectorSoATest::components,
+              &VectorSoATest::copyFrom,
+              &VectorSoATest::copyInto,
+
+              &VectorSoATest::componentOutOfRange,
+              &VectorSoATest::accessOutOfRange,
+              &VectorSoATest::copyWrongSize});
+}
+
+void VectorSoATest::constructDefault() {
+    Vector3SoA<Float> a;
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.paddedSize(), 0);
+    CORRADE_VERIFY(!a.data());
+    CORRADE_COMPARE(a.x().size(), 0);
+    CORRADE_COMPARE(a.z().size(), 0);
+}
+
+void VectorSoATest::construct() {
+    Vector4SoA<Int> a{5};
+    CORRADE_VERIFY(!a.isEmpty());
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_COMPARE(a.paddedSize(), 8);
+    CORRADE_COMPARE(a.data().size(), 4*8);
+
+    /* Everything including the padding is zero-initialized */
+    CORRADE_COMPARE_AS(a.data(),
+        Containers::arrayView<Int>({0, 0, 0, 0, 0, 0, 0, 0,
+                                    0, 0, 0, 0, 0, 0, 0, 0,
+                                    0, 0, 0, 0, 0, 0, 0, 0,
+                                    0, 0, 0, 0, 0, 0, 0, 0}),
+        TestSuite::Compare::Container);
+
+    /* Count divisible by four has no padding */
+    Vector2SoA<Int> b{8};
+    CORRADE_COMPARE(b.paddedSize(), 8);
+    CORRADE_COMPARE(b.data().size(), 2*8);
+}
+
+void VectorSoATest::constructNoInit() {
+    Vector3SoA<Float> a{Magnum::NoInit, 6};
+    CORRADE_COMPARE(a.size(), 6);
+    CORRADE_COMPARE(a.paddedSize(), 8);
+    CORRADE_COMPARE(a.data().size(), 3*8);
+
+    /* The padding is zero-initialized always */
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(a.data()[i*8 + 6], 0.0f);
+        CORRADE_COMPARE(a.data()[i*8 + 7], 0.0f);
+    }
+}
+
+void VectorSoATest::constructFromView() {
+    /* Interleaved with other data to verify strides are handled */
+    struct Data {
+        Vector3 position;
+        Int padding;
+    } data[]{
+        {{1.0f, 2.0f, 3.0f}, 0},
+        {{4.0f, 5.0f, 6.0f}, 0},
+        {{7.0f, 8.0f, 9.0f}, 0},
+        {{10.0f, 11.0f, 12.0f}, 0},
+        {{13.0f, 14.0f, 15.0f}, 0},
+    };
+
+    Vector3SoA<Float> a{Containers::stridedArrayView(data).slice(&Data::position)};
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_COMPARE(a.paddedSize(), 8);
+    CORRADE_COMPARE_AS(a.data(), Containers::arrayView<Float>({
+        1.0f, 4.0f, 7.0f, 10.0f, 13.0f, 0.0f, 0.0f, 0.0f,
+        2.0f, 5.0f, 8.0f, 11.0f, 14.0f, 0.0f, 0.0f, 0.0f,
+        3.0f, 6.0f, 9.0f, 12.0f, 15.0f, 0.0f, 0.0f, 0.0f
+    }), TestSuite::Compare::Container);
+}
+
+void VectorSoATest::constructGeneric() {
+    /* Sizes other than 2, 3 and 4 use the generic Vector type */
+    CORRADE_VERIFY(std::is_same<VectorSoA<5, Float>::VectorType, Vector<5, Float>>::value);
+    CORRADE_VERIFY(std::is_same<Vector2SoA<Float>::VectorType, Vector2>::value);
+    CORRADE_VERIFY(std::is_same<Vector3SoA<Float>::VectorType, Vector3>::value);
+    CORRADE_VERIFY(std::is_same<Vector4SoA<Float>::VectorType, Vector4>::value);
+    CORRADE_COMPARE(VectorSoA<5, Float>::Size, 5);
+
+    const Vector<5, Float> data[]{
+        {1.0f, 2.0f, 3.0f, 4.0f, 5.0f},
+        {6.0f, 7.0f, 8.0f, 9.0f, 10.0f},
+    };
+    VectorSoA<5, Float> a{data};
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE_AS(a.component(4),
+        Containers::arrayView<Float>({5.0f, 10.0f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(a[1], (Vector<5, Float>{6.0f, 7.0f, 8.0f, 9.0f, 10.0f}));
+}
+
+void VectorSoATest::constructMove() {
+    const Vector2 data[]{{1.0f, 2.0f}, {3.0f, 4.0f}};
+    Vector2SoA<Float> a{data};
+    const Float* dataPointer = a.data().data();
+
+    Vector2SoA<Float> b = Utility::move(a);
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE(b.data().data(), dataPointer);
+    CORRADE_COMPARE(b[1], (Vector2{3.0f, 4.0f}));
+
+    Vector2SoA<Float> c{3};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.size(), 2);
+    CORRADE_COMPARE(c.data().data(), dataPointer);
+
+    CORRADE_VERIFY(!std::is_copy_constructible<Vector2SoA<Float>>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<Vector2SoA<Float>>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<Vector2SoA<Float>>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<Vector2SoA<Float>>::value);
+}
+
+void VectorSoATest::access() {
+    const Vector4 data[]{
+        {1.0f, 2.0f, 3.0f, 4.0f},
+        {5.0f, 6.0f, 7.0f, 8.0f},
+        {9.0f, 10.0f, 11.0f, 12.0f},
+    };
+    Vector4SoA<Float> a{data};
+    const Vector4SoA<Float>& ca = a;
+
+    CORRADE_COMPARE_AS(a.x(), Containers::arrayView<Float>({1.0f, 5.0f, 9.0f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ca.y(), Containers::arrayView<Float>({2.0f, 6.0f, 10.0f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.z(), Containers::arrayView<Float>({3.0f, 7.0f, 11.0f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ca.w(), Containers::arrayView<Float>({4.0f, 8.0f, 12.0f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.component(2), Containers::arrayView<Float>({3.0f, 7.0f, 11.0f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ca.component<1>(), Containers::arrayView<Float>({2.0f, 6.0f, 10.0f}),
+        TestSuite::Compare::Container);
+
+    /* The component views are contiguous */
+    CORRADE_COMPARE(a.z().stride(), sizeof(Float));
+    CORRADE_VERIFY(a.z().isContiguous());
+
+    CORRADE_COMPARE(ca[0], (Vector4{1.0f, 2.0f, 3.0f, 4.0f}));
+    CORRADE_COMPARE(ca[2], (Vector4{9.0f, 10.0f, 11.0f, 12.0f}));
+
+    /* Modifying through the views */
+    a.y()[1] = 66.0f;
+    a.component(3)[2] = 122.0f;
+    CORRADE_COMPARE(ca[1], (Vector4{5.0f, 66.0f, 7.0f, 8.0f}));
+    CORRADE_COMPARE(ca[2], (Vector4{9.0f, 10.0f, 11.0f, 122.0f}));
+}
+
+void VectorSoATest::components() {
+    const Vector3 data[]{
+        {1.0f, 2.0f, 3.0f},
+        {4.0f, 5.0f, 6.0f},
+    };
+    Vector3SoA<Float> a{data};
+    const Vector3SoA<Float>& ca = a;
+
+    Containers::StridedArrayView2D<Float> components = a.components();
+    Containers::StridedArrayView2D<const Float> constComponents = ca.components();
+    CORRADE_COMPARE(components.size(), (Containers::Size2D{3, 2}));
+    CORRADE_COMPARE(components.stride(), (Containers::Stride2D{4*4, 4}));
+    CORRADE_COMPARE(constComponents.size(), (Containers::Size2D{3, 2}));
+    CORRADE_COMPARE(constComponents.data(), static_cast<const void*>(a.data().data()));
+    CORRADE_COMPARE_AS(constComponents[2],
+        Containers::arrayView<Float>({3.0f, 6.0f}),
+        TestSuite::Compare::Container);
+
+    components[1][0] = 22.0f;
+    CORRADE_COMPARE(a[0], (Vector3{1.0f, 22.0f, 3.0f}));
+}
+
+void VectorSoATest::copyFrom() {
+    Vector3SoA<Float> a{3};
+
+    const Vector3 data[]{
+        {1.0f, 2.0f, 3.0f},
+        {4.0f, 5.0f, 6.0f},
+        {7.0f, 8.0f, 9.0f},
+    };
+    a.copyFrom(data);
+    CORRADE_COMPARE_AS(a.data(), Containers::arrayView<Float>({
+        1.0f, 4.0f, 7.0f, 0.0f,
+        2.0f, 5.0f, 8.0f, 0.0f,
+        3.0f, 6.0f, 9.0f, 0.0f
+    }), TestSuite::Compare::Container);
+}
+
+void VectorSoATest::copyInto() {
+    const Vector3 data[]{
+        {1.0f, 2.0f, 3.0f},
+        {4.0f, 5.0f, 6.0f},
+        {7.0f, 8.0f, 9.0f},
+    };
+    const Vector3SoA<Float> a{data};
+
+    /* Interleaved with other data to verify strides are handled and the
+       neighboring memory isn't touched */
+    struct Data {
+        Int padding;
+        Vector3 position;
+    } out[]{
+        {17, {}},
+        {27, {}},
+        {37, {}},
+    };
+    a.copyInto(Containers::stridedArrayView(out).slice(&Data::position));
+    CORRADE_COMPARE(out[0].position, (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(out[1].position, (Vector3{4.0f, 5.0f, 6.0f}));
+    CORRADE_COMPARE(out[2].position, (Vector3{7.0f, 8.0f, 9.0f}));
+    CORRADE_COMPARE(out[0].padding, 17);
+    CORRADE_COMPARE(out[1].padding, 27);
+    CORRADE_COMPARE(out[2].padding, 37);
+}
+
+void VectorSoATest::componentOutOfRange() {
+    CORRADE_SKIP_IF_NO_DEBUG_ASSERT();
+
+    Vector3SoA<Float> a{2};
+    const Vector3SoA<Float>& ca = a;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.component(3);
+    ca.component(3);
+    CORRADE_COMPARE(out.str(),
+        "Math::VectorSoA::component(): index 3 out of range for 3 components\n"
+        "Math::VectorSoA::component(): index 3 out of range for 3 components\n");
+}
+
+void VectorSoATest::accessOutOfRange() {
+    CORRADE_SKIP_IF_NO_DEBUG_ASSERT();
+
+    Vector3SoA<Float> a{2};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a[2];
+    CORRADE_COMPARE(out.str(),
+        "Math::VectorSoA::operator[](): index 2 out of range for 2 vectors\n");
+}
+
+void VectorSoATest::copyWrongSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Vector3SoA<Float> a{3};
+    Vector3 data[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.copyFrom(data);
+    a.copyInto(data);
+    CORRADE_COMPARE(out.str(),
+        "Math::VectorSoA::copyFrom(): expected a view with 3 items but got 2\n"
+        "Math::VectorSoA::copyInto(): expected a view with 3 items but got 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::VectorSoATest)
@@ -0,0 +1,348 @@
+#ifndef Magnum_Math_VectorSoA_h
+#define Magnum_Math_VectorSoA_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Math::VectorSoA, alias @ref Magnum::Math::Vector2SoA, @ref Magnum::Math::Vector3SoA, @ref Magnum::Math::Vector4SoA
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace Math {
+
+namespace Implementation {
+    template<std::size_t size, class T> struct VectorSoATraits {
+        typedef Vector<size, T> Type;
+    };
+    template<class T> struct VectorSoATraits<2, T> {
+        typedef Vector2<T> Type;
+    };
+    template<class T> struct VectorSoATraits<3, T> {
+        typedef Vector3<T> Type;
+    };
+    template<class T> struct VectorSoATraits<4, T> {
+        typedef Vector4<T> Type;
+    };
+}
+
+/**
+@brief Structure-of-arrays vector container
+@tparam size    Vector size
+@tparam T       Underlying data type
+@m_since_latest
+
+Stores a list of @p size -component vectors with each component in a separate
+contiguous array, as opposed to the usual array-of-structures layout where
+all components of a vector are next to each other. Such layout allows
+vectorized algorithms to operate on several vectors at once without having to
+shuffle the data around first.
+
+All components are placed in a single allocation, one after another, with
+each component padded to a multiple of four items. The padding is always
+zero-initialized, which means SIMD code can process the last incomplete group
+of four items directly without a special case for the remainder. The
+per-component data are accessible as strided views through @ref component()
+and @ref x() / @ref y() / @ref z() / @ref w(), or all at once through
+@ref components(), with the first dimension being the component and the
+second the vector index.
+
+Conversion from and to the usual array-of-structures layout is done with the
+@ref VectorSoA(const Containers::StridedArrayView1D<const VectorType>&)
+constructor and the @ref copyFrom() and @ref copyInto() functions, which can
+be directly used with for example attribute views of a
+@ref Trade::MeshData. Use @ref MeshTools::positions3DSoA() and related
+functions to get a SoA copy of a mesh attribute in an arbitrary vertex format.
+
+@snippet Math.cpp VectorSoA
+
+@see @ref Magnum::Vector2SoA, @ref Magnum::Vector3SoA,
+    @ref Magnum::Vector4SoA
+*/
+template<std::size_t size, class T> class VectorSoA {
+    static_assert(size != 0, "VectorSoA cannot have zero components");
+
+    public:
+        /**
+         * @brief Vector type
+         *
+         * @ref Vector2, @ref Vector3 or @ref Vector4 for two-, three- and
+         * four-component vectors, @ref Vector otherwise.
+         */
+        typedef typename Implementation::VectorSoATraits<size, T>::Type VectorType;
+
+        /** @brief Underlying data type */
+        typedef T Type;
+
+        enum: std::size_t {
+            Size = size     /**< Vector size */
+        };
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty container with no allocation.
+         */
+        /*implicit*/ VectorSoA() noexcept: _size{}, _paddedSize{} {}
+
+        /**
+         * @brief Construct a zero-initialized container
+         *
+         * Allocates space for @p count vectors with all components set to
+         * zero.
+         */
+        explicit VectorSoA(std::size_t count): _data{Corrade::ValueInit, paddedSize(count)*size}, _size{count}, _paddedSize{paddedSize(count)} {}
+
+        /**
+         * @brief Construct an uninitialized container
+         *
+         * Allocates space for @p count vectors, leaving their contents
+         * uninitialized. The padding is zero-initialized.
+         */
+        explicit VectorSoA(Magnum::NoInitT, std::size_t count): _data{Corrade::NoInit, paddedSize(count)*size}, _size{count}, _paddedSize{paddedSize(count)} {
+            for(std::size_t i = 0; i != size; ++i)
+                for(std::size_t j = _size; j != _paddedSize; ++j)
+                    _data[i*_paddedSize + j] = T{};
+        }
+
+        /**
+         * @brief Construct from an array-of-structures view
+         *
+         * Allocates space for @p src.size() vectors and deinterleaves the
+         * contents of @p src into it.
+         * @see @ref copyFrom()
+         */
+        explicit VectorSoA(const Containers::StridedArrayView1D<const VectorType>& src): VectorSoA{Magnum::NoInit, src.size()} {
+            copyFrom(src);
+        }
+
+        /** @brief Vector count */
+        std::size_t size() const { return _size; }
+
+        /** @brief Whether the container is empty */
+        bool isEmpty() const { return !_size; }
+
+        /**
+         * @brief Padded vector count
+         *
+         * Count of items in each component including the padding, i.e.
+         * @ref size() rounded up to a multiple of four.
+         */
+        std::size_t paddedSize() const { return _paddedSize; }
+
+        /**
+         * @brief Raw data
+         *
+         * Contains all components one after another, each having
+         * @ref paddedSize() items.
+         */
+        Containers::ArrayView<T> data() { return _data; }
+        Containers::ArrayView<const T> data() const { return _data; } /**< @overload */
+
+        /**
+         * @brief All components
+         *
+         * The first dimension is the component, the second is the vector
+         * index. The second dimension is always contiguous. The padding is
+         * not included in the view.
+         */
+        Containers::StridedArrayView2D<T> components() {
+            return {_data, {size, _size}, {std::ptrdiff_t(_paddedSize*sizeof(T)), std::ptrdiff_t(sizeof(T))}};
+        }
+        /** @overload */
+        Containers::StridedArrayView2D<const T> components() const {
+            return {_data, {size, _size}, {std::ptrdiff_t(_paddedSize*sizeof(T)), std::ptrdiff_t(sizeof(T))}};
+        }
+
+        /**
+         * @brief Component at given position
+         *
+         * Expects that @p i is less than @ref Size. The view is always
+         * contiguous. The padding is not included in the view.
+         */
+        Containers::StridedArrayView1D<T> component(std::size_t i) {
+            CORRADE_DEBUG_ASSERT(i < size,
+                "Math::VectorSoA::component(): index" << i << "out of range for" << size << "components", {});
+            return _data.sliceSize(i*_paddedSize, _size);
+        }
+        /** @overload */
+        Containers::StridedArrayView1D<const T> component(std::size_t i) const {
+            CORRADE_DEBUG_ASSERT(i < size,
+                "Math::VectorSoA::component(): index" << i << "out of range for" << size << "components", {});
+            return _data.sliceSize(i*_paddedSize, _size);
+        }
+
+        /**
+         * @brief Component at given compile-time position
+         *
+         * Expects that @p i is less than @ref Size.
+         */
+        template<std::size_t i> Containers::StridedArrayView1D<T> component() {
+            static_assert(i < size, "index out of range");
+            return _data.sliceSize(i*_paddedSize, _size);
+        }
+        /** @overload */
+        template<std::size_t i> Containers::StridedArrayView1D<const T> component() const {
+            static_assert(i < size, "index out of range");
+            return _data.sliceSize(i*_paddedSize, _size);
+        }
+
+        /**
+         * @brief X component
+         *
+         * Equivalent to @ref component() "component<0>()".
+         */
+        Containers::StridedArrayView1D<T> x() { return component<0>(); }
+        Containers::StridedArrayView1D<const T> x() const { return component<0>(); } /**< @overload */
+
+        /**
+         * @brief Y component
+         *
+         * Equivalent to @ref component() "component<1>()". Available only
+         * for vectors with at least two components.
+         */
+        Containers::StridedArrayView1D<T> y() { return component<1>(); }
+        Containers::StridedArrayView1D<const T> y() const { return component<1>(); } /**< @overload */
+
+        /**
+         * @brief Z component
+         *
+         * Equivalent to @ref component() "component<2>()". Available only
+         * for vectors with at least three components.
+         */
+        Containers::StridedArrayView1D<T> z() { return component<2>(); }
+        Containers::StridedArrayView1D<const T> z() const { return component<2>(); } /**< @overload */
+
+        /**
+         * @brief W component
+         *
+         * Equivalent to @ref component() "component<3>()". Available only
+         * for vectors with at least four components.
+         */
+        Containers::StridedArrayView1D<T> w() { return component<3>(); }
+        Containers::StridedArrayView1D<const T> w() const { return component<3>(); } /**< @overload */
+
+        /**
+         * @brief Vector at given position
+         *
+         * Gathers the components of vector at position @p i. Expects that
+         * @p i is less than @ref size().
+         */
+        VectorType operator[](std::size_t i) const {
+            CORRADE_DEBUG_ASSERT(i < _size,
+                "Math::VectorSoA::operator[](): index" << i << "out of range for" << _size << "vectors", {});
+            VectorType out{Magnum::NoInit};
+            for(std::size_t c = 0; c != size; ++c)
+                out[c] = _data[c*_paddedSize + i];
+            return out;
+        }
+
+        /**
+         * @brief Copy from an array-of-structures view
+         *
+         * Deinterleaves @p src into the container. Expects that @p src has
+         * the same size as the container.
+         * @see @ref VectorSoA(const Containers::StridedArrayView1D<const VectorType>&)
+         */
+        void copyFrom(const Containers::StridedArrayView1D<const VectorType>& src) {
+            CORRADE_ASSERT(src.size() == _size,
+                "Math::VectorSoA::copyFrom(): expected a view with" << _size << "items but got" << src.size(), );
+            for(std::size_t c = 0; c != size; ++c) {
+                T* const dst = _data.data() + c*_paddedSize;
+                for(std::size_t i = 0; i != _size; ++i)
+                    dst[i] = src[i][c];
+            }
+        }
+
+        /**
+         * @brief Copy into an array-of-structures view
+         *
+         * Interleaves the container contents into @p dst. Expects that
+         * @p dst has the same size as the container.
+         */
+        void copyInto(const Containers::StridedArrayView1D<VectorType>& dst) const {
+            CORRADE_ASSERT(dst.size() == _size,
+                "Math::VectorSoA::copyInto(): expected a view with" << _size << "items but got" << dst.size(), );
+            for(std::size_t c = 0; c != size; ++c) {
+                const T* const src = _data.data() + c*_paddedSize;
+                for(std::size_t i = 0; i != _size; ++i)
+                    dst[i][c] = src[i];
+            }
+        }
+
+    private:
+        static std::size_t paddedSize(std::size_t count) {
+            return (count + 3) & ~std::size_t{3};
+        }
+
+        Containers::Array<T> _data;
+        std::size_t _size, _paddedSize;
+};
+
+/**
+@brief Two-component structure-of-arrays vector container
+@m_since_latest
+
+Convenience alternative to `VectorSoA<2, T>`. See @ref VectorSoA for
+more information.
+@see @ref Magnum::Vector2SoA
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using Vector2SoA = VectorSoA<2, T>;
+#endif
+
+/**
+@brief Three-component structure-of-arrays vector container
+@m_since_latest
+
+Convenience alternative to `VectorSoA<3, T>`. See @ref VectorSoA for
+more information.
+@see @ref Magnum::Vector3SoA
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using Vector3SoA = VectorSoA<3, T>;
+#endif
+
+/**
+@brief Four-component structure-of-arrays vector container
+@m_since_latest
+
+Convenience alternative to `VectorSoA<4, T>`. See @ref VectorSoA for
+more information.
+@see @ref Magnum::Vector4SoA
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using Vector4SoA = VectorSoA<4, T>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,506 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Bvh.h"
+
+#include <algorithm>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/GenerateIndices.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Count of bins along each axis for the surface area heuristic */
+constexpr UnsignedInt BvhBinCount = 16;
+
+/* Max triangle count of a subtree built by a single ParallelFor task */
+constexpr UnsignedInt BvhSubtreeSize = 8192;
+
+/* Size of a chunk of triangles processed by a single ParallelFor task when
+   calculating triangle bounds */
+constexpr std::size_t BvhChunkSize = 16384;
+
+/* Traversal stack size that's allocated on the stack, deeper trees allocate
+   it on the heap */
+constexpr UnsignedInt BvhStackSize = 64;
+
+inline Range3D emptyRange() {
+    return {Vector3{Constants::inf()}, Vector3{-Constants::inf()}};
+}
+
+/* Not using Math::join() as it treats zero-size ranges as empty, which
+   breaks for degenerate triangles */
+inline void joinInPlace(Range3D& range, const Range3D& other) {
+    range = {Math::min(range.min(), other.min()),
+             Math::max(range.max(), other.max())};
+}
+
+/* Half of the surface area, the factor of 2 doesn't matter for comparing
+   costs */
+inline Float halfArea(const Range3D& range) {
+    const Vector3 size = range.size();
+    return size.x()*size.y() + size.y()*size.z() + size.z()*size.x();
+}
+
+inline UnsignedInt binIndex(const Float value, const Float min, const Float scale) {
+    return Math::min(UnsignedInt((value - min)*scale), BvhBinCount - 1);
+}
+
+struct BvhBuildItem {
+    UnsignedInt node;
+    UnsignedInt begin;
+    UnsignedInt end;
+    UnsignedInt depth;
+};
+
+struct BvhBuildState {
+    Containers::StridedArrayView1D<const UnsignedInt> indices;
+    Containers::StridedArrayView1D<const Vector3> positions;
+    Containers::ArrayView<Range3D> bounds;
+    Containers::ArrayView<Vector3> centroids;
+    Containers::ArrayView<UnsignedInt> order;
+    UnsignedInt maxLeafSize;
+
+    /* Filled for the parallel subtree build */
+    Containers::ArrayView<const BvhBuildItem> subtrees;
+    Containers::ArrayView<Containers::Array<BvhNode>> subtreeNodes;
+    Containers::ArrayView<UnsignedInt> subtreeDepths;
+};
+
+/* Calculates bounds and centroids for a chunk of triangles */
+void bvhTriangleBounds(void* const state, const std::size_t chunk) {
+    const BvhBuildState& s = *static_cast<const BvhBuildState*>(state);
+    const std::size_t begin = chunk*BvhChunkSize;
+    const std::size_t end = Math::min(begin + BvhChunkSize, s.bounds.size());
+    for(std::size_t i = begin; i != end; ++i) {
+        const Vector3 a = s.positions[s.indices[i*3 + 0]];
+        const Vector3 b = s.positions[s.indices[i*3 + 1]];
+        const Vector3 c = s.positions[s.indices[i*3 + 2]];
+        s.bounds[i] = {Math::min(Math::min(a, b), c),
+                       Math::max(Math::max(a, b), c)};
+        s.centroids[i] = s.bounds[i].center();
+        s.order[i] = i;
+    }
+}
+
+/* Finds a split of given triangle range using binned SAH and partitions the
+   range accordingly. Returns the split position or begin if the range should
+   be a leaf. */
+UnsignedInt bvhSplit(const BvhBuildState& s, const Range3D& bounds, const UnsignedInt begin, const UnsignedInt end) {
+    const UnsignedInt count = end - begin;
+    if(count == 1) return begin;
+
+    Range3D centroidBounds{s.centroids[s.order[begin]], s.centroids[s.order[begin]]};
+    for(UnsignedInt i = begin + 1; i != end; ++i) {
+        const Vector3 centroid = s.centroids[s.order[i]];
+        centroidBounds = {Math::min(centroidBounds.min(), centroid),
+                          Math::max(centroidBounds.max(), centroid)};
+    }
+
+    Float bestCost = Constants::inf();
+    UnsignedInt bestAxis = 3;
+    UnsignedInt bestBin = 0;
+    for(UnsignedInt axis = 0; axis != 3; ++axis) {
+        const Float min = centroidBounds.min()[axis];
+        const Float extent = centroidBounds.max()[axis] - min;
+        if(!(extent > 0.0f)) continue;
+        const Float scale = BvhBinCount/extent;
+
+        Range3D binBounds[BvhBinCount];
+        UnsignedInt binCounts[BvhBinCount]{};
+        for(Range3D& i: binBounds) i = emptyRange();
+        for(UnsignedInt i = begin; i != end; ++i) {
+            const UnsignedInt triangle = s.order[i];
+            const UnsignedInt bin = binIndex(s.centroids[triangle][axis], min, scale);
+            ++binCounts[bin];
+            joinInPlace(binBounds[bin], s.bounds[triangle]);
+        }
+
+        /* Sweep from the right to get area and count of everything after
+           each candidate split, then from the left to evaluate the cost */
+        Float rightAreas[BvhBinCount - 1];
+        UnsignedInt rightCounts[BvhBinCount - 1];
+        Range3D right = emptyRange();
+        UnsignedInt rightCount = 0;
+        for(UnsignedInt bin = BvhBinCount - 1; bin != 0; --bin) {
+            joinInPlace(right, binBounds[bin]);
+            rightCount += binCounts[bin];
+            rightAreas[bin - 1] = rightCount ? halfArea(right) : 0.0f;
+            rightCounts[bin - 1] = rightCount;
+        }
+
+        Range3D left = emptyRange();
+        UnsignedInt leftCount = 0;
+        for(UnsignedInt bin = 0; bin != BvhBinCount - 1; ++bin) {
+            joinInPlace(left, binBounds[bin]);
+            leftCount += binCounts[bin];
+            if(!leftCount || !rightCounts[bin]) continue;
+
+            const Float cost = leftCount*halfArea(left) + rightCounts[bin]*rightAreas[bin];
+            if(cost < bestCost) {
+                bestCost = cost;
+                bestAxis = axis;
+                bestBin = bin;
+            }
+        }
+    }
+
+    /* All centroids are the same, there's no way to separate them spatially.
+       Split in the middle if the leaf would be too large. */
+    if(bestAxis == 3)
+        return count <= s.maxLeafSize ? begin : begin + count/2;
+
+    /* Cost of traversing a node is assumed to be the same as of testing a
+       single triangle. Nodes over the leaf size limit are split always. */
+    const Float area = halfArea(bounds);
+    if(count <= s.maxLeafSize && area + bestCost >= count*area)
+        return begin;
+
+    const Float min = centroidBounds.min()[bestAxis];
+    const Float scale = BvhBinCount/(centroidBounds.max()[bestAxis] - min);
+    UnsignedInt* const middle = std::partition(s.order.data() + begin, s.order.data() + end, [&](const UnsignedInt triangle) {
+        return binIndex(s.centroids[triangle][bestAxis], min, scale) <= bestBin;
+    });
+    return UnsignedInt(middle - s.order.data());
+}
+
+/* Builds a tree starting at given root item, which is expected to already
+   be in the nodes array. If subtrees is not null, ranges of at most
+   BvhSubtreeSize triangles are not processed further but put there. */
+void bvhBuild(const BvhBuildState& s, Containers::Array<BvhNode>& nodes, const BvhBuildItem& root, Containers::Array<BvhBuildItem>* const subtrees, UnsignedInt& depth) {
+    Containers::Array<BvhBuildItem> stack;
+    arrayAppend(stack, root);
+    while(!stack.isEmpty()) {
+        const BvhBuildItem item = stack.back();
+        arrayRemoveSuffix(stack);
+
+        Range3D bounds = emptyRange();
+        for(UnsignedInt i = item.begin; i != item.end; ++i)
+            joinInPlace(bounds, s.bounds[s.order[i]]);
+        nodes[item.node].bounds = bounds;
+
+        if(subtrees && item.end - item.begin <= BvhSubtreeSize) {
+            arrayAppend(*subtrees, item);
+            continue;
+        }
+
+        const UnsignedInt middle = bvhSplit(s, bounds, item.begin, item.end);
+        if(middle == item.begin) {
+            nodes[item.node].offset = item.begin;
+            nodes[item.node].count = item.end - item.begin;
+            depth = Math::max(depth, item.depth);
+            continue;
+        }
+
+        const UnsignedInt child = nodes.size();
+        arrayAppend(nodes, NoInit, 2);
+        nodes[item.node].offset = child;
+        nodes[item.node].count = 0;
+
+        /* Pushing the right child first so the left one is processed first
+           and the nodes are allocated in depth-first order */
+        arrayAppend(stack, BvhBuildItem{child + 1, middle, item.end, item.depth + 1});
+        arrayAppend(stack, BvhBuildItem{child, item.begin, middle, item.depth + 1});
+    }
+}
+
+/* Builds one subtree into a local node array, with the root at index 0 */
+void bvhBuildSubtree(void* const state, const std::size_t i) {
+    const BvhBuildState& s = *static_cast<const BvhBuildState*>(state);
+    const BvhBuildItem& subtree = s.subtrees[i];
+    Containers::Array<BvhNode>& nodes = s.subtreeNodes[i];
+    arrayAppend(nodes, NoInit, 1);
+    bvhBuild(s, nodes, BvhBuildItem{0, subtree.begin, subtree.end, subtree.depth}, nullptr, s.subtreeDepths[i]);
+}
+
+inline bool rayRange(const Vector3& origin, const Vector3& inverseDirection, const Range3D& range, const Float maxDistance) {
+    const Vector3 t0 = (range.min() - origin)*inverseDirection;
+    const Vector3 t1 = (range.max() - origin)*inverseDirection;
+    const Float tMin = Math::max(Math::min(t0, t1).max(), 0.0f);
+    const Float tMax = Math::min(Math::max(t0, t1).min(), maxDistance);
+    return tMin <= tMax;
+}
+
+inline Float rangeDistanceSquared(const Vector3& point, const Range3D& range) {
+    return Math::max(Math::max(range.min() - point, point - range.max()), Vector3{0.0f}).dot();
+}
+
+/* Real-Time Collision Detection, section 5.1.5 */
+Vector3 closestPointOnTriangle(const Vector3& p, const Vector3& a, const Vector3& b, const Vector3& c) {
+    const Vector3 ab = b - a;
+    const Vector3 ac = c - a;
+    const Vector3 ap = p - a;
+    const Float d1 = Math::dot(ab, ap);
+    const Float d2 = Math::dot(ac, ap);
+    if(d1 <= 0.0f && d2 <= 0.0f) return a;
+
+    const Vector3 bp = p - b;
+    const Float d3 = Math::dot(ab, bp);
+    const Float d4 = Math::dot(ac, bp);
+    if(d3 >= 0.0f && d4 <= d3) return b;
+
+    const Float vc = d1*d4 - d3*d2;
+    if(vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+        return a + ab*(d1/(d1 - d3));
+
+    const Vector3 cp = p - c;
+    const Float d5 = Math::dot(ab, cp);
+    const Float d6 = Math::dot(ac, cp);
+    if(d6 >= 0.0f && d5 <= d6) return c;
+
+    const Float vb = d5*d2 - d1*d6;
+    if(vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+        return a + ac*(d2/(d2 - d6));
+
+    const Float va = d3*d6 - d5*d4;
+    if(va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+        return b + (c - b)*((d4 - d3)/((d4 - d3) + (d5 - d6)));
+
+    /* Degenerate triangles with all of the above failing would divide by
+       zero, return the first vertex for those */
+    const Float sum = va + vb + vc;
+    if(sum == 0.0f) return a;
+    return a + ab*(vb/sum) + ac*(vc/sum);
+}
+
+}
+
+Bvh::Bvh(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxLeafSize, const ParallelFor parallelFor, void* const parallelForState): _depth{} {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::Bvh: index count not divisible by 3, got" << indices.size(), );
+    CORRADE_ASSERT(maxLeafSize,
+        "MeshTools::Bvh: expected max leaf size to be at least 1", );
+    #ifndef CORRADE_NO_ASSERT
+    for(const UnsignedInt index: indices)
+        CORRADE_ASSERT(index < positions.size(),
+            "MeshTools::Bvh: index" << index << "out of range for" << positions.size() << "vertices", );
+    #endif
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    Containers::Array<Range3D> bounds{NoInit, triangleCount};
+    Containers::Array<Vector3> centroids{NoInit, triangleCount};
+    Containers::Array<UnsignedInt> order{NoInit, triangleCount};
+    BvhBuildState state{indices, positions, bounds, centroids, order, maxLeafSize, {}, {}, {}};
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, (triangleCount + BvhChunkSize - 1)/BvhChunkSize, bvhTriangleBounds, &state);
+
+    /* Split the top of the tree serially until all remaining ranges are
+       small enough, and then build those in parallel. The subtree size
+       depends only on the input, so the result is the same for any executor
+       and the serial path goes through the same code. */
+    Containers::Array<BvhBuildItem> subtrees;
+    arrayReserve(_nodes, 2*triangleCount - 1);
+    arrayAppend(_nodes, NoInit, 1);
+    bvhBuild(state, _nodes, BvhBuildItem{0, 0, UnsignedInt(triangleCount), 1}, &subtrees, _depth);
+
+    Containers::Array<Containers::Array<BvhNode>> subtreeNodes{subtrees.size()};
+    Containers::Array<UnsignedInt> subtreeDepths{ValueInit, subtrees.size()};
+    state.subtrees = subtrees;
+    state.subtreeNodes = subtreeNodes;
+    state.subtreeDepths = subtreeDepths;
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, subtrees.size(), bvhBuildSubtree, &state);
+
+    /* Merge the subtrees in order. The subtree root replaces its placeholder
+       node in the top part of the tree, the rest is appended at the end with
+       child offsets adjusted. */
+    for(std::size_t i = 0; i != subtrees.size(); ++i) {
+        const Containers::ArrayView<const BvhNode> nodes = subtreeNodes[i];
+        const UnsignedInt base = _nodes.size() - 1;
+        const auto fixup = [base](BvhNode node) {
+            if(!node.count) node.offset += base;
+            return node;
+        };
+        _nodes[subtrees[i].node] = fixup(nodes[0]);
+        for(const BvhNode& node: nodes.exceptPrefix(1))
+            arrayAppend(_nodes, fixup(node));
+        _depth = Math::max(_depth, subtreeDepths[i]);
+    }
+
+    /* Copy the triangle IDs and positions in leaf order */
+    _triangles = Utility::move(order);
+    _positions = Containers::Array<Vector3>{NoInit, triangleCount*3};
+    for(std::size_t i = 0; i != triangleCount; ++i)
+        for(std::size_t j = 0; j != 3; ++j)
+            _positions[i*3 + j] = positions[indices[_triangles[i]*3 + j]];
+}
+
+Bvh::Bvh(const Trade::MeshData& mesh, const UnsignedInt maxLeafSize, const ParallelFor parallelFor, void* const parallelForState): _depth{} {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles ||
+                   mesh.primitive() == MeshPrimitive::TriangleStrip ||
+                   mesh.primitive() == MeshPrimitive::TriangleFan,
+        "MeshTools::Bvh: expected a triangle primitive, got" << mesh.primitive(), );
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::Bvh: the mesh has no positions", );
+
+    Containers::Array<UnsignedInt> indices;
+    if(mesh.primitive() == MeshPrimitive::Triangles) {
+        if(mesh.isIndexed())
+            indices = mesh.indicesAsArray();
+        else
+            indices = generateTrivialIndices(mesh.vertexCount());
+    } else if(mesh.primitive() == MeshPrimitive::TriangleStrip) {
+        if(mesh.isIndexed())
+            indices = generateTriangleStripIndices(mesh.indices());
+        else
+            indices = generateTriangleStripIndices(mesh.vertexCount());
+    } else if(mesh.primitive() == MeshPrimitive::TriangleFan) {
+        if(mesh.isIndexed())
+            indices = generateTriangleFanIndices(mesh.indices());
+        else
+            indices = generateTriangleFanIndices(mesh.vertexCount());
+    } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+    *this = Bvh{indices, mesh.positions3DAsArray(), maxLeafSize, parallelFor, parallelForState};
+}
+
+Bvh::Bvh(Bvh&&) noexcept = default;
+
+Bvh::~Bvh() = default;
+
+Bvh& Bvh::operator=(Bvh&&) noexcept = default;
+
+Containers::Optional<BvhRayHit> Bvh::castRay(const Vector3& origin, const Vector3& direction, const Float maxDistance) const {
+    const Vector3 inverseDirection = 1.0f/direction;
+    if(_nodes.isEmpty() || !rayRange(origin, inverseDirection, _nodes[0].bounds, maxDistance))
+        return {};
+
+    UnsignedInt stackStorage[BvhStackSize];
+    Containers::Array<UnsignedInt> heapStack;
+    Containers::ArrayView<UnsignedInt> stack = stackStorage;
+    if(_depth > BvhStackSize) {
+        heapStack = Containers::Array<UnsignedInt>{NoInit, _depth};
+        stack = heapStack;
+    }
+
+    Float closest = maxDistance;
+    UnsignedInt hit = ~UnsignedInt{};
+    Vector3 barycentric;
+    std::size_t stackSize = 0;
+    stack[stackSize++] = 0;
+    while(stackSize) {
+        const BvhNode& node = _nodes[stack[--stackSize]];
+
+        /* The closest hit may have gotten closer since the node was pushed */
+        if(!rayRange(origin, inverseDirection, node.bounds, closest))
+            continue;
+
+        if(!node.count) {
+            stack[stackSize++] = node.offset + 1;
+            stack[stackSize++] = node.offset;
+            continue;
+        }
+
+        /* Möller-Trumbore */
+        for(UnsignedInt i = node.offset, end = node.offset + node.count; i != end; ++i) {
+            const Vector3 a = _positions[i*3 + 0];
+            const Vector3 ab = _positions[i*3 + 1] - a;
+            const Vector3 ac = _positions[i*3 + 2] - a;
+            const Vector3 p = Math::cross(direction, ac);
+            const Float determinant = Math::dot(ab, p);
+            if(determinant == 0.0f) continue;
+
+            const Float inverseDeterminant = 1.0f/determinant;
+            const Vector3 s = origin - a;
+            const Float u = Math::dot(s, p)*inverseDeterminant;
+            if(u < 0.0f || u > 1.0f) continue;
+
+            const Vector3 q = Math::cross(s, ab);
+            const Float v = Math::dot(direction, q)*inverseDeterminant;
+            if(v < 0.0f || u + v > 1.0f) continue;
+
+            const Float t = Math::dot(ac, q)*inverseDeterminant;
+            if(t >= 0.0f && t < closest) {
+                closest = t;
+                hit = i;
+                barycentric = {1.0f - u - v, u, v};
+            }
+        }
+    }
+
+    if(hit == ~UnsignedInt{}) return {};
+    return BvhRayHit{_triangles[hit], closest, barycentric};
+}
+
+Containers::Optional<BvhClosestPoint> Bvh::closestPoint(const Vector3& point, const Float maxDistance) const {
+    const Float maxDistanceSquared = maxDistance*maxDistance;
+    if(_nodes.isEmpty() || rangeDistanceSquared(point, _nodes[0].bounds) >= maxDistanceSquared)
+        return {};
+
+    UnsignedInt stackStorage[BvhStackSize];
+    Containers::Array<UnsignedInt> heapStack;
+    Containers::ArrayView<UnsignedInt> stack = stackStorage;
+    if(_depth > BvhStackSize) {
+        heapStack = Containers::Array<UnsignedInt>{NoInit, _depth};
+        stack = heapStack;
+    }
+
+    Float closestSquared = maxDistanceSquared;
+    UnsignedInt hit = ~UnsignedInt{};
+    Vector3 result;
+    std::size_t stackSize = 0;
+    stack[stackSize++] = 0;
+    while(stackSize) {
+        const BvhNode& node = _nodes[stack[--stackSize]];
+        if(rangeDistanceSquared(point, node.bounds) >= closestSquared)
+            continue;
+
+        if(!node.count) {
+            /* Push the farther child first so the nearer one is visited
+               first and prunes more */
+            const UnsignedInt first = node.offset;
+            const UnsignedInt second = node.offset + 1;
+            if(rangeDistanceSquared(point, _nodes[first].bounds) <= rangeDistanceSquared(point, _nodes[second].bounds)) {
+                stack[stackSize++] = second;
+                stack[stackSize++] = first;
+            } else {
+                stack[stackSize++] = first;
+                stack[stackSize++] = second;
+            }
+            continue;
+        }
+
+        for(UnsignedInt i = node.offset, end = node.offset + node.count; i != end; ++i) {
+            const Vector3 candidate = closestPointOnTriangle(point, _positions[i*3 + 0], _positions[i*3 + 1], _positions[i*3 + 2]);
+            const Float distanceSquared = (candidate - point).dot();
+            if(distanceSquared < closestSquared) {
+                closestSquared = distanceSquared;
+                hit = i;
+                result = candidate;
+            }
+        }
+    }
+
+    if(hit == ~UnsignedInt{}) return {};
+    return BvhClosestPoint{_triangles[hit], Math::sqrt(closestSquared), result};
+}
+
+}}
@@ -0,0 +1,261 @@
+#ifndef Magnum_MeshTools_Bvh_h
+#define Magnum_MeshTools_Bvh_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::MeshTools::Bvh, struct @ref Magnum::MeshTools::BvhNode, @ref Magnum::MeshTools::BvhRayHit, @ref Magnum::MeshTools::BvhClosestPoint
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/MeshTools/Parallel.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Bounding volume hierarchy node
+@m_since_latest
+
+A single node of a @ref Bvh. If @ref count is @cpp 0 @ce, the node is an inner
+node and @ref offset is the index of its first child in @ref Bvh::nodes(),
+with the second child directly following it. Otherwise the node is a leaf and
+contains @ref count triangles starting at @ref offset in @ref Bvh::triangles().
+
+The structure is 32 bytes large with all members tightly packed in the order
+listed here, suitable for copying directly into a GPU buffer with a matching
+layout.
+*/
+struct BvhNode {
+    /** @brief Bounds of all triangles in the subtree */
+    Range3D bounds;
+
+    /**
+     * @brief Offset
+     *
+     * Index of the first child in @ref Bvh::nodes() for an inner node,
+     * offset of the first triangle in @ref Bvh::triangles() for a leaf.
+     */
+    UnsignedInt offset;
+
+    /** @brief Triangle count or @cpp 0 @ce for an inner node */
+    UnsignedInt count;
+};
+
+/**
+@brief Ray hit returned from @ref Bvh::castRay()
+@m_since_latest
+*/
+struct BvhRayHit {
+    /** @brief Triangle ID in the original index buffer */
+    UnsignedInt triangle;
+
+    /**
+     * @brief Hit distance
+     *
+     * In multiples of the ray direction length, i.e. the hit point is
+     * @cpp origin + direction*distance @ce.
+     */
+    Float distance;
+
+    /**
+     * @brief Barycentric coordinates of the hit point
+     *
+     * Weights of the first, second and third triangle vertex, summing to
+     * @cpp 1.0f @ce.
+     */
+    Vector3 barycentric;
+};
+
+/**
+@brief Closest point returned from @ref Bvh::closestPoint()
+@m_since_latest
+*/
+struct BvhClosestPoint {
+    /** @brief Triangle ID in the original index buffer */
+    UnsignedInt triangle;
+
+    /** @brief Distance from the query point */
+    Float distance;
+
+    /** @brief Closest point on the triangle */
+    Vector3 point;
+};
+
+/**
+@brief Bounding volume hierarchy over a triangle mesh
+@m_since_latest
+
+Binary tree of axis-aligned bounding boxes with triangles in its leaves, for
+accelerating ray casts and closest point queries on static geometry.
+
+The tree is built top-down, splitting each node with a surface area heuristic
+evaluated on 16 bins along each axis of the triangle centroid bounds. Nodes
+with at most @p maxLeafSize triangles become leaves if splitting them isn't
+cheaper, larger nodes are always split, falling back to splitting in the
+middle of the triangle list if all centroids are the same.
+
+The nodes are stored flattened in a single array in @ref nodes(), with the
+root at index @cpp 0 @ce and both children of a node adjacent to each other.
+Vertex positions of all triangles are copied and stored in the order of
+@ref triangles(), so the queries touch only contiguous memory and don't need
+the original mesh to be kept around.
+
+@section MeshTools-Bvh-parallel Parallel construction
+
+If a @ref ParallelFor is passed to the constructor, the tree is first split
+serially into subtrees of at most 8192 triangles, which are then built through
+@p parallelFor and merged together in order. The resulting tree is the same as
+with @ref parallelForSerial(), regardless of the order in which the subtrees
+are processed and the count of threads used.
+*/
+class MAGNUM_MESHTOOLS_EXPORT Bvh {
+    public:
+        /**
+         * @brief Construct from an indexed triangle mesh
+         * @param indices           Triangle indices
+         * @param positions         Vertex positions
+         * @param maxLeafSize       Max triangle count in a leaf that doesn't
+         *      need to be split further
+         * @param parallelFor       Parallel loop executor or @cpp nullptr @ce
+         * @param parallelForState  State pointer passed to @p parallelFor
+         *
+         * Expects that @p indices size is divisible by @cpp 3 @ce, all
+         * indices are in bounds for @p positions and @p maxLeafSize is at
+         * least @cpp 1 @ce.
+         */
+        explicit Bvh(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxLeafSize = 4, ParallelFor parallelFor = parallelForSerial, void* parallelForState = nullptr);
+
+        /**
+         * @brief Construct from a triangle mesh
+         *
+         * Takes indices of @p mesh via @ref Trade::MeshData::indicesAsArray(),
+         * or creates them with @ref generateTriangleStripIndices(),
+         * @ref generateTriangleFanIndices() or @ref generateTrivialIndices()
+         * for @ref MeshPrimitive::TriangleStrip,
+         * @ref MeshPrimitive::TriangleFan and non-indexed meshes,
+         * respectively. Positions are taken via
+         * @ref Trade::MeshData::positions3DAsArray(). The result is then
+         * passed to @ref Bvh(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt, ParallelFor, void*).
+         *
+         * Expects that the mesh is a @ref MeshPrimitive::Triangles,
+         * @relativeref{MeshPrimitive,TriangleStrip} or
+         * @relativeref{MeshPrimitive,TriangleFan} and has a
+         * @ref Trade::MeshAttribute::Position attribute.
+         */
+        explicit Bvh(const Trade::MeshData& mesh, UnsignedInt maxLeafSize = 4, ParallelFor parallelFor = parallelForSerial, void* parallelForState = nullptr);
+
+        /** @brief Copying is not allowed */
+        Bvh(const Bvh&) = delete;
+
+        /** @brief Move constructor */
+        Bvh(Bvh&&) noexcept;
+
+        ~Bvh();
+
+        /** @brief Copying is not allowed */
+        Bvh& operator=(const Bvh&) = delete;
+
+        /** @brief Move assignment */
+        Bvh& operator=(Bvh&&) noexcept;
+
+        /**
+         * @brief Nodes
+         *
+         * The root node is at index @cpp 0 @ce. Empty if the mesh has no
+         * triangles.
+         */
+        Containers::ArrayView<const BvhNode> nodes() const { return _nodes; }
+
+        /**
+         * @brief Triangles
+         *
+         * IDs of triangles in the original index buffer, in the order
+         * referenced by @ref BvhNode::offset and @ref BvhNode::count of the
+         * leaf nodes.
+         */
+        Containers::ArrayView<const UnsignedInt> triangles() const { return _triangles; }
+
+        /**
+         * @brief Triangle vertex positions
+         *
+         * Three positions for each item in @ref triangles().
+         */
+        Containers::ArrayView<const Vector3> positions() const { return _positions; }
+
+        /**
+         * @brief Tree depth
+         *
+         * Count of nodes on the longest path from the root to a leaf, or
+         * @cpp 0 @ce if the mesh has no triangles.
+         */
+        UnsignedInt depth() const { return _depth; }
+
+        /**
+         * @brief Cast a ray
+         * @param origin        Ray origin
+         * @param direction     Ray direction, doesn't need to be normalized
+         * @param maxDistance   Max hit distance in multiples of
+         *      @p direction length
+         *
+         * Returns the closest triangle hit in range
+         * @cpp [0, maxDistance) @ce, or @relativeref{Corrade,Containers::NullOpt}
+         * if there's none. Both front and back faces are hit, triangles
+         * parallel to the ray are never hit. If several triangles are hit at
+         * exactly the same distance, the first one found during the traversal
+         * is returned.
+         */
+        Containers::Optional<BvhRayHit> castRay(const Vector3& origin, const Vector3& direction, Float maxDistance = Constants::inf()) const;
+
+        /**
+         * @brief Find a closest point on the mesh
+         * @param point         Query point
+         * @param maxDistance   Max distance from @p point
+         *
+         * Returns the closest point on the mesh surface in distance less than
+         * @p maxDistance, or @relativeref{Corrade,Containers::NullOpt} if
+         * there's none. If several triangles are at exactly the same distance,
+         * the first one found during the traversal is returned.
+         */
+        Containers::Optional<BvhClosestPoint> closestPoint(const Vector3& point, Float maxDistance = Constants::inf()) const;
+
+    private:
+        Containers::Array<BvhNode> _nodes;
+        Containers::Array<UnsignedInt> _triangles;
+        Containers::Array<Vector3> _positions;
+        UnsignedInt _depth;
+};
+
+}}
+
+#endif
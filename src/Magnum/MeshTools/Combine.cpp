@@ -40,18 +40,54 @@ namespace Magnum { namespace MeshTools {
 
 namespace {
 
+/* Count of vertices duplicated by a single ParallelFor task */
+constexpr std::size_t CombineChunkSize = 65536;
+
+struct CombineState {
+    Containers::StridedArrayView2D<const char> combinedIndices;
+    const Containers::Iterable<const Trade::MeshData>* meshes;
+    Trade::MeshData* out;
+};
+
+/* Duplicates attributes of all meshes for a chunk of the output vertices.
+   The chunks are disjoint, so they can be processed in any order. */
+void combineChunk(void* const state, const std::size_t chunk) {
+    const CombineState& s = *static_cast<const CombineState*>(state);
+    const std::size_t begin = chunk*CombineChunkSize;
+    const std::size_t end = Math::min(begin + CombineChunkSize, s.combinedIndices.size()[0]);
+
+    UnsignedInt indexOffset = 0;
+    UnsignedInt attributeOffset = 0;
+    for(const Trade::MeshData& mesh: *s.meshes) {
+        const UnsignedInt indexSize = mesh.isIndexed() ?
+            meshIndexTypeSize(mesh.indexType()) : 4;
+        const Containers::StridedArrayView2D<const char> indices = s.combinedIndices.sliceSize(
+            {begin, indexOffset},
+            {end - begin, indexSize});
+
+        for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i)
+            duplicateInto(indices,
+                mesh.attribute(i),
+                s.out->mutableAttribute(attributeOffset++).slice(begin, end));
+
+        indexOffset += indexSize;
+    }
+}
+
 Trade::MeshData combineIndexedImplementation(
     #if !defined(CORRADE_NO_ASSERT) && !defined(CORRADE_STANDARD_ASSERT)
     const char* assertPrefix,
     #endif
-    const MeshPrimitive primitive, const Containers::StridedArrayView2D<char>& combinedIndices, const Containers::Iterable<const Trade::MeshData>& meshes)
+    const MeshPrimitive primitive, const Containers::StridedArrayView2D<char>& combinedIndices, const Containers::Iterable<const Trade::MeshData>& meshes, const ParallelFor parallelFor, void* const parallelForState)
 {
-    /* Make the combined index array unique */
+    /* Make the combined index array unique. The serial variant is used if no
+       executor is passed as it doesn't need to allocate the hashes and
+       per-chunk tables. */
     Containers::Array<char> indexData{NoInit, combinedIndices.size()[0]*sizeof(UnsignedInt)};
     const auto indexDataI = Containers::arrayCast<UnsignedInt>(indexData);
-    const UnsignedInt vertexCount = removeDuplicatesInPlaceInto(
-        combinedIndices,
-        indexDataI);
+    const UnsignedInt vertexCount = parallelFor ?
+        removeDuplicatesInPlaceInto(combinedIndices, indexDataI, parallelFor, parallelForState) :
+        removeDuplicatesInPlaceInto(combinedIndices, indexDataI);
 
     /* Gather attributes of all input meshes together */
     Containers::Array<Trade::MeshAttributeData> attributes;
@@ -85,25 +121,10 @@ Trade::MeshData combineIndexedImplementation(
         not as extras? */
     Trade::MeshData out = interleavedLayout(Trade::MeshData{primitive, 0}, vertexCount, attributes, InterleaveFlags{});
 
-    /* Duplicate the attributes there according to the combined index buffer */
-    {
-        UnsignedInt indexOffset = 0;
-        UnsignedInt attributeOffset = 0;
-        for(const Trade::MeshData& mesh: meshes) {
-            const UnsignedInt indexSize = mesh.isIndexed() ?
-                meshIndexTypeSize(mesh.indexType()) : 4;
-            Containers::StridedArrayView2D<const char> indices = combinedIndices.sliceSize(
-                {0, indexOffset},
-                {vertexCount, indexSize});
-
-            for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i)
-                duplicateInto(indices,
-                    mesh.attribute(i),
-                    out.mutableAttribute(attributeOffset++));
-
-            indexOffset += indexSize;
-        }
-    }
+    /* Duplicate the attributes there according to the combined index buffer,
+       in chunks of vertices */
+    CombineState state{combinedIndices.prefix(vertexCount), &meshes, &out};
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, (vertexCount + CombineChunkSize - 1)/CombineChunkSize, combineChunk, &state);
 
     /* Combine the index buffer in */
     return Trade::MeshData{primitive,
@@ -111,9 +132,7 @@ Trade::MeshData combineIndexedImplementation(
         out.releaseVertexData(), out.releaseAttributeData(), vertexCount};
 }
 
-}
-
-Trade::MeshData combineIndexedAttributes(const Containers::Iterable<const Trade::MeshData>& meshes) {
+Trade::MeshData combineIndexedAttributesImplementation(const Containers::Iterable<const Trade::MeshData>& meshes, const ParallelFor parallelFor, void* const parallelForState) {
     CORRADE_ASSERT(!meshes.isEmpty(),
         "MeshTools::combineIndexedAttributes(): no meshes passed",
         (Trade::MeshData{MeshPrimitive{}, 0}));
@@ -169,10 +188,11 @@ Trade::MeshData combineIndexedAttributes(const Containers::Iterable<const Trade:
         #if !defined(CORRADE_NO_ASSERT) && !defined(CORRADE_STANDARD_ASSERT)
         "MeshTools::combineIndexedAttributes():",
         #endif
-        primitive, combinedIndices, meshes);
+        primitive, combinedIndices, meshes, parallelFor, parallelForState);
 }
 
-Trade::MeshData combineFaceAttributes(const Trade::MeshData& mesh, const Trade::MeshData& faceAttributes) {
+Trade::MeshData combineFaceAttributesImplementation(const Trade::MeshData& mesh, const Trade::MeshData& faceAttributes, const ParallelFor parallelFor, void* const parallelForState) {
+
     CORRADE_ASSERT(mesh.isIndexed(),
         "MeshTools::combineFaceAttributes(): vertex mesh is not indexed",
         (Trade::MeshData{MeshPrimitive{}, 0}));
@@ -219,7 +239,11 @@ Trade::MeshData combineFaceAttributes(const Trade::MeshData& mesh, const Trade::
         CORRADE_ASSERT(isInterleaved(faceAttributes),
             "MeshTools::combineFaceAttributes(): face attributes are not interleaved",
             (Trade::MeshData{MeshPrimitive{}, 0}));
-        removeDuplicatesInto(interleavedData(faceAttributes), Containers::arrayCast<1, UnsignedInt>(combinedFaceIndices[0]));
+        const Containers::StridedArrayView1D<UnsignedInt> faceIndices = Containers::arrayCast<1, UnsignedInt>(combinedFaceIndices[0]);
+        if(parallelFor)
+            removeDuplicatesInto(interleavedData(faceAttributes), faceIndices, parallelFor, parallelForState);
+        else
+            removeDuplicatesInto(interleavedData(faceAttributes), faceIndices);
 
     /* Otherwise, simply copy the indices directly */
     } else Utility::copy(faceAttributes.indices(), combinedFaceIndices[0]);
@@ -235,10 +259,10 @@ Trade::MeshData combineFaceAttributes(const Trade::MeshData& mesh, const Trade::
         #endif
         mesh.primitive(), combinedIndices, {
             mesh, faceAttributes
-        });
+        }, parallelFor, parallelForState);
 }
 
-Trade::MeshData combineFaceAttributes(const Trade::MeshData& mesh, Containers::ArrayView<const Trade::MeshAttributeData> faceAttributes) {
+Trade::MeshData combineFaceAttributesImplementation(const Trade::MeshData& mesh, const Containers::ArrayView<const Trade::MeshAttributeData> faceAttributes, const ParallelFor parallelFor, void* const parallelForState) {
     #ifndef CORRADE_NO_ASSERT
     for(std::size_t i = 0; i != faceAttributes.size(); ++i)
         CORRADE_ASSERT(!faceAttributes[i].isOffsetOnly(),
@@ -246,11 +270,37 @@ Trade::MeshData combineFaceAttributes(const Trade::MeshData& mesh, Containers::A
                 (Trade::MeshData{MeshPrimitive::Triangles, 0}));
     #endif
 
-    return combineFaceAttributes(mesh, Trade::MeshData{MeshPrimitive::Faces,
+    return combineFaceAttributesImplementation(mesh, Trade::MeshData{MeshPrimitive::Faces,
         /* Supply a vertex data view spanning the whole memory. It's not used
            directly and this shuts off asserts for attribute bounds */
         {}, {nullptr, ~std::size_t{}},
-        Trade::meshAttributeDataNonOwningArray(faceAttributes)});
+        Trade::meshAttributeDataNonOwningArray(faceAttributes)}, parallelFor, parallelForState);
+}
+
+}
+
+Trade::MeshData combineIndexedAttributes(const Containers::Iterable<const Trade::MeshData>& meshes) {
+    return combineIndexedAttributesImplementation(meshes, nullptr, nullptr);
+}
+
+Trade::MeshData combineIndexedAttributes(const Containers::Iterable<const Trade::MeshData>& meshes, const ParallelFor parallelFor, void* const parallelForState) {
+    return combineIndexedAttributesImplementation(meshes, parallelFor, parallelForState);
+}
+
+Trade::MeshData combineFaceAttributes(const Trade::MeshData& mesh, const Trade::MeshData& faceAttributes) {
+    return combineFaceAttributesImplementation(mesh, faceAttributes, nullptr, nullptr);
+}
+
+Trade::MeshData combineFaceAttributes(const Trade::MeshData& mesh, const Trade::MeshData& faceAttributes, const ParallelFor parallelFor, void* const parallelForState) {
+    return combineFaceAttributesImplementation(mesh, faceAttributes, parallelFor, parallelForState);
+}
+
+Trade::MeshData combineFaceAttributes(const Trade::MeshData& mesh, const Containers::ArrayView<const Trade::MeshAttributeData> faceAttributes) {
+    return combineFaceAttributesImplementation(mesh, faceAttributes, nullptr, nullptr);
+}
+
+Trade::MeshData combineFaceAttributes(const Trade::MeshData& mesh, const Containers::ArrayView<const Trade::MeshAttributeData> faceAttributes, const ParallelFor parallelFor, void* const parallelForState) {
+    return combineFaceAttributesImplementation(mesh, faceAttributes, parallelFor, parallelForState);
 }
 
 Trade::MeshData combineFaceAttributes(const Trade::MeshData& mesh, std::initializer_list<Trade::MeshAttributeData> faceAttributes) {
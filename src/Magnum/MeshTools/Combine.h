@@ -33,6 +33,7 @@
 
 #include <initializer_list>
 
+#include "Magnum/MeshTools/Parallel.h"
 #include "Magnum/MeshTools/visibility.h"
 #include "Magnum/Trade/Trade.h"
 
@@ -98,6 +99,21 @@ implementation-specific format.
 */
 MAGNUM_MESHTOOLS_EXPORT Trade::MeshData combineIndexedAttributes(const Containers::Iterable<const Trade::MeshData>& meshes);
 
+/**
+@brief Combine differently indexed attributes into a single mesh in parallel
+@m_since_latest
+
+Same as @ref combineIndexedAttributes(const Containers::Iterable<const Trade::MeshData>&),
+but with the duplicate removal done using
+@ref removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<UnsignedInt>&, ParallelFor, void*)
+and the attributes then copied to the output in chunks of 65536 vertices, all
+executed through @p parallelFor, to which @p parallelForState is passed. The
+output is the same as with the serial variant, regardless of the order in
+which the chunks were processed.
+@see @ref ParallelFor, @ref parallelForSerial()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData combineIndexedAttributes(const Containers::Iterable<const Trade::MeshData>& meshes, ParallelFor parallelFor, void* parallelForState);
+
 /**
 @brief Combine per-face attributes into an existing mesh
 @m_since{2020,06}
@@ -119,6 +135,19 @@ have an implementation-specific format.
 */
 MAGNUM_MESHTOOLS_EXPORT Trade::MeshData combineFaceAttributes(const Trade::MeshData& mesh, const Trade::MeshData& faceAttributes);
 
+/**
+@brief Combine per-face attributes into an existing mesh in parallel
+@m_since_latest
+
+Same as @ref combineFaceAttributes(const Trade::MeshData&, const Trade::MeshData&),
+but with the duplicate removal of non-indexed @p faceAttributes and the
+subsequent combining done through @p parallelFor, to which
+@p parallelForState is passed. See
+@ref combineIndexedAttributes(const Containers::Iterable<const Trade::MeshData>&, ParallelFor, void*)
+for more information.
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData combineFaceAttributes(const Trade::MeshData& mesh, const Trade::MeshData& faceAttributes, ParallelFor parallelFor, void* parallelForState);
+
 /**
 @overload
 @m_since{2020,06}
@@ -131,6 +160,16 @@ Same as above with @p faceAttributes wrapped in a @ref Trade::MeshData with
 */
 MAGNUM_MESHTOOLS_EXPORT Trade::MeshData combineFaceAttributes(const Trade::MeshData& mesh, Containers::ArrayView<const Trade::MeshAttributeData> faceAttributes);
 
+/**
+@overload
+@m_since_latest
+
+Same as @ref combineFaceAttributes(const Trade::MeshData&, Containers::ArrayView<const Trade::MeshAttributeData>),
+but executed in parallel as described in
+@ref combineFaceAttributes(const Trade::MeshData&, const Trade::MeshData&, ParallelFor, void*).
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData combineFaceAttributes(const Trade::MeshData& mesh, Containers::ArrayView<const Trade::MeshAttributeData> faceAttributes, ParallelFor parallelFor, void* parallelForState);
+
 /**
  * @overload
  * @m_since{2020,06}
@@ -31,6 +31,7 @@
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StaticArray.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
 
 #include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/Mesh.h"
@@ -266,6 +267,46 @@ GL::Mesh compileInternal(const Trade::MeshData& meshData, const CompileFlags fla
     return compileInternal(meshData, Utility::move(indices), Utility::move(vertices), flags);
 }
 
+template<class T, class U> void widenIndicesInto(const Containers::StridedArrayView1D<const T>& src, const Containers::StridedArrayView1D<U>& dst) {
+    for(std::size_t i = 0; i != src.size(); ++i)
+        dst[i] = U(src[i]);
+}
+
+/* The output type is the largest among all meshes, so the input is never
+   larger than the output */
+template<class T> void widenIndicesInto(const Trade::MeshData& mesh, const Containers::StridedArrayView1D<T>& out) {
+    if(mesh.indexType() == MeshIndexType::UnsignedInt)
+        widenIndicesInto(mesh.indices<UnsignedInt>(), out);
+    else if(mesh.indexType() == MeshIndexType::UnsignedShort)
+        widenIndicesInto(mesh.indices<UnsignedShort>(), out);
+    else
+        widenIndicesInto(mesh.indices<UnsignedByte>(), out);
+}
+
+/* Copies indices of all meshes into a single array, widening them to given
+   type. They're not rebased, the vertex offsets are used as a base vertex
+   instead. */
+Containers::Array<char> concatenateIndices(const Containers::Iterable<const Trade::MeshData>& meshes, const MeshIndexType indexType, const std::size_t indexCount, const Containers::StridedArrayView1D<UnsignedInt>& indexOffsets) {
+    const UnsignedInt indexTypeSize = meshIndexTypeSize(indexType);
+    Containers::Array<char> indexData{NoInit, indexCount*indexTypeSize};
+    std::size_t indexOffset = 0;
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        const Trade::MeshData& mesh = meshes[i];
+        const Containers::ArrayView<char> out = indexData.sliceSize(indexOffset*indexTypeSize, mesh.indexCount()*indexTypeSize);
+        if(indexType == MeshIndexType::UnsignedInt)
+            widenIndicesInto(mesh, Containers::StridedArrayView1D<UnsignedInt>{Containers::arrayCast<UnsignedInt>(out)});
+        else if(indexType == MeshIndexType::UnsignedShort)
+            widenIndicesInto(mesh, Containers::StridedArrayView1D<UnsignedShort>{Containers::arrayCast<UnsignedShort>(out)});
+        else
+            widenIndicesInto(mesh, Containers::StridedArrayView1D<UnsignedByte>{Containers::arrayCast<UnsignedByte>(out)});
+
+        indexOffsets[i] = indexOffset*indexTypeSize;
+        indexOffset += mesh.indexCount();
+    }
+
+    return indexData;
+}
+
 }
 
 GL::Mesh compile(const Trade::MeshData& mesh, GL::Buffer&& indices, GL::Buffer&& vertices) {
@@ -339,6 +380,132 @@ GL::Mesh compile(const Trade::MeshData& mesh, CompileFlags flags) {
     return compileInternal(mesh, flags);
 }
 
+GL::Mesh compile(const Containers::Iterable<const Trade::MeshData>& meshes, const Containers::StridedArrayView1D<UnsignedInt>& counts, const Containers::StridedArrayView1D<UnsignedInt>& vertexOffsets, const Containers::StridedArrayView1D<UnsignedInt>& indexOffsets, const CompileFlags flags) {
+    CORRADE_ASSERT(!meshes.isEmpty(),
+        "MeshTools::compile(): no meshes passed", GL::Mesh{});
+    CORRADE_ASSERT(!(flags & ~CompileFlag::NoWarnOnCustomAttributes),
+        "MeshTools::compile(): normal generation is not supported when compiling multiple meshes", GL::Mesh{});
+
+    const Trade::MeshData& first = meshes.front();
+    const bool indexed = first.isIndexed();
+    CORRADE_ASSERT(counts.size() == meshes.size() && vertexOffsets.size() == meshes.size() && (indexOffsets.size() == meshes.size() || (!indexed && indexOffsets.isEmpty())),
+        "MeshTools::compile(): expected" << meshes.size() << "counts, vertex offsets and index offsets but got" << counts.size() << Debug::nospace << "," << vertexOffsets.size() << "and" << indexOffsets.size(), GL::Mesh{});
+
+    /* Check that the meshes are compatible, calculate the ranges and pick the
+       largest index type */
+    std::size_t indexCount = 0;
+    std::size_t vertexCount = 0;
+    MeshIndexType indexType{};
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        const Trade::MeshData& mesh = meshes[i];
+        CORRADE_ASSERT(mesh.primitive() == first.primitive(),
+            "MeshTools::compile(): expected mesh" << i << "to be" << first.primitive() << "but got" << mesh.primitive(), GL::Mesh{});
+        CORRADE_ASSERT(mesh.isIndexed() == indexed,
+            "MeshTools::compile(): expected mesh" << i << "to be" << (indexed ? "indexed" : "non-indexed"), GL::Mesh{});
+        CORRADE_ASSERT(mesh.attributeCount() == first.attributeCount(),
+            "MeshTools::compile(): expected mesh" << i << "to have" << first.attributeCount() << "attributes but got" << mesh.attributeCount(), GL::Mesh{});
+        #ifndef CORRADE_NO_ASSERT
+        for(UnsignedInt j = 0; j != first.attributeCount(); ++j) {
+            CORRADE_ASSERT(mesh.attributeName(j) == first.attributeName(j) &&
+                           mesh.attributeFormat(j) == first.attributeFormat(j) &&
+                           mesh.attributeArraySize(j) == first.attributeArraySize(j) &&
+                           mesh.attributeMorphTargetId(j) == first.attributeMorphTargetId(j),
+                "MeshTools::compile(): expected attribute" << j << "of mesh" << i << "to be" << first.attributeName(j) << "of" << first.attributeFormat(j) << "with array size" << first.attributeArraySize(j) << "and morph target ID" << first.attributeMorphTargetId(j) << "but got" << mesh.attributeName(j) << "of" << mesh.attributeFormat(j) << "with array size" << mesh.attributeArraySize(j) << "and morph target ID" << mesh.attributeMorphTargetId(j), GL::Mesh{});
+        }
+        #endif
+
+        if(indexed) {
+            CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+                "MeshTools::compile(): mesh" << i << "has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), GL::Mesh{});
+            if(UnsignedInt(mesh.indexType()) > UnsignedInt(indexType))
+                indexType = mesh.indexType();
+            counts[i] = mesh.indexCount();
+            indexCount += mesh.indexCount();
+        } else counts[i] = mesh.vertexCount();
+
+        vertexOffsets[i] = vertexCount;
+        vertexCount += mesh.vertexCount();
+    }
+
+    /* Copy the indices, widening them to the common type */
+    Containers::Array<char> indexData;
+    Trade::MeshIndexData indices;
+    if(indexed) {
+        indexData = concatenateIndices(meshes, indexType, indexCount, indexOffsets);
+        indices = Trade::MeshIndexData{indexType, indexData};
+    }
+
+    /* Copy the attributes into a tightly packed interleaved layout based on
+       the first mesh */
+    Trade::MeshData layout = interleavedLayout(first, UnsignedInt(vertexCount), Containers::ArrayView<const Trade::MeshAttributeData>{}, InterleaveFlags{});
+    std::size_t vertexOffset = 0;
+    for(const Trade::MeshData& mesh: meshes) {
+        for(UnsignedInt i = 0; i != layout.attributeCount(); ++i)
+            Utility::copy(mesh.attribute(i), layout.mutableAttribute(i).sliceSize(vertexOffset, mesh.vertexCount()));
+        vertexOffset += mesh.vertexCount();
+    }
+
+    Containers::Array<char> vertexData = layout.releaseVertexData();
+    Containers::Array<Trade::MeshAttributeData> attributeData = layout.releaseAttributeData();
+    const Trade::MeshData combined{first.primitive(),
+        Utility::move(indexData), indices,
+        Utility::move(vertexData), Utility::move(attributeData),
+        UnsignedInt(vertexCount)};
+    return compileInternal(combined, flags);
+}
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+Containers::Pair<GL::Mesh, VertexPullingLayout> compileVertexPulling(const Containers::Iterable<const Trade::MeshData>& meshes, GL::Buffer& vertices, const Containers::StridedArrayView1D<UnsignedInt>& counts, const Containers::StridedArrayView1D<UnsignedInt>& vertexOffsets, const Containers::StridedArrayView1D<UnsignedInt>& indexOffsets) {
+    CORRADE_ASSERT(!meshes.isEmpty(),
+        "MeshTools::compileVertexPulling(): no meshes passed", {});
+
+    const Trade::MeshData& first = meshes.front();
+    const bool indexed = first.isIndexed();
+    CORRADE_ASSERT(counts.size() == meshes.size() && vertexOffsets.size() == meshes.size() && (indexOffsets.size() == meshes.size() || (!indexed && indexOffsets.isEmpty())),
+        "MeshTools::compileVertexPulling(): expected" << meshes.size() << "counts, vertex offsets and index offsets but got" << counts.size() << Debug::nospace << "," << vertexOffsets.size() << "and" << indexOffsets.size(), {});
+
+    /* Check that the meshes are compatible and pick the largest index type.
+       Attributes don't need to match, vertexPullingData() stores each
+       separately. */
+    std::size_t indexCount = 0;
+    std::size_t vertexCount = 0;
+    MeshIndexType indexType{};
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        const Trade::MeshData& mesh = meshes[i];
+        CORRADE_ASSERT(mesh.primitive() == first.primitive(),
+            "MeshTools::compileVertexPulling(): expected mesh" << i << "to be" << first.primitive() << "but got" << mesh.primitive(), {});
+        CORRADE_ASSERT(mesh.isIndexed() == indexed,
+            "MeshTools::compileVertexPulling(): expected mesh" << i << "to be" << (indexed ? "indexed" : "non-indexed"), {});
+
+        if(indexed) {
+            CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+                "MeshTools::compileVertexPulling(): mesh" << i << "has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), {});
+            if(UnsignedInt(mesh.indexType()) > UnsignedInt(indexType))
+                indexType = mesh.indexType();
+            counts[i] = mesh.indexCount();
+            indexCount += mesh.indexCount();
+        } else counts[i] = mesh.vertexCount();
+
+        vertexCount += mesh.vertexCount();
+    }
+
+    /* Vertex offsets get filled by vertexPullingData() */
+    Containers::Pair<Containers::Array<char>, VertexPullingLayout> data = vertexPullingData(meshes, vertexOffsets);
+    vertices.setData(data.first());
+
+    GL::Mesh mesh;
+    mesh.setPrimitive(first.primitive());
+    if(indexed) {
+        GL::Buffer indices{GL::Buffer::TargetHint::ElementArray};
+        indices.setData(concatenateIndices(meshes, indexType, indexCount, indexOffsets));
+        mesh.setIndexBuffer(Utility::move(indices), 0, indexType)
+            .setCount(indexCount);
+    } else mesh.setCount(vertexCount);
+
+    return {Utility::move(mesh), data.second()};
+}
+#endif
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 CORRADE_IGNORE_DEPRECATED_PUSH
 GL::Mesh compile(const Trade::MeshData2D& meshData) {
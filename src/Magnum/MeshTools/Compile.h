@@ -27,19 +27,24 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::compile()
+ * @brief Function @ref Magnum::MeshTools::compile(), @ref Magnum::MeshTools::compileVertexPulling()
  */
 
 #include "Magnum/configure.h"
 
 #ifdef MAGNUM_TARGET_GL
 #include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/Iterable.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/GL/GL.h"
 #include "Magnum/Trade/Trade.h"
 #include "Magnum/MeshTools/visibility.h"
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/MeshTools/VertexPulling.h"
+#endif
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 #include <Corrade/Utility/Macros.h>
 #endif
@@ -226,6 +231,109 @@ MAGNUM_MESHTOOLS_EXPORT GL::Mesh compile(const Trade::MeshData& mesh, GL::Buffer
  */
 MAGNUM_MESHTOOLS_EXPORT GL::Mesh compile(const Trade::MeshData& mesh, GL::Buffer&& indices, GL::Buffer&& vertices);
 
+/**
+@brief Compile multiple meshes into shared buffers
+@param[in]  meshes          Meshes to compile
+@param[out] counts          Index counts for indexed meshes, vertex counts
+    for non-indexed meshes
+@param[out] vertexOffsets   Base vertex for indexed meshes, offset of the
+    first vertex for non-indexed meshes
+@param[out] indexOffsets    Offsets into the index buffer for indexed meshes,
+    *in bytes*. Can be empty if the meshes are not indexed.
+@param[in]  flags           Compilation flags
+@m_since_latest
+
+Uploads index and vertex data of all @p meshes into a single index and a
+single vertex buffer and sets up one @ref GL::Mesh referencing them, instead
+of allocating a pair of buffers and a vertex array object for each mesh as
+@ref compile(const Trade::MeshData&, CompileFlags) would do. Attribute binding
+follows the same rules as in @ref compile(const Trade::MeshData&, CompileFlags).
+The ranges of particular meshes are written into @p counts, @p vertexOffsets
+and @p indexOffsets, which are expected to have the same size as @p meshes,
+and can be passed directly to
+@ref GL::AbstractShaderProgram::draw(GL::Mesh&, const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const UnsignedInt>&)
+to draw all of them, or a subset, with a single multi-draw call. Alternatively,
+each range can be drawn separately using a @ref GL::MeshView with
+@relativeref{GL::MeshView,setCount()},
+@relativeref{GL::MeshView,setBaseVertex()} and, for indexed meshes,
+@relativeref{GL::MeshView,setIndexOffset()} set to the byte offset divided by
+index type size. The returned mesh itself has count set to cover vertices or
+indices of all meshes together.
+
+Indices are not rebased, which means indexed meshes need base vertex support
+to be drawn. The index type of the shared index buffer is the largest index
+type among all @p meshes, smaller index types are widened. The vertex data
+are interleaved and tightly packed with the layout of the first mesh, all
+meshes are expected to have the same primitive, either all or none of them be
+indexed and have the same attributes in the same order, with equal formats
+and array sizes. Implementation-specific index types and vertex formats are
+not supported.
+
+Only @ref CompileFlag::NoWarnOnCustomAttributes is allowed in @p flags,
+normals have to be generated on the meshes beforehand if needed.
+@see @ref concatenate()
+@requires_gl32 Extension @gl_extension{ARB,draw_elements_base_vertex} for
+    drawing indexed meshes with a non-zero base vertex.
+@requires_es_extension Extension @gl_extension{OES,draw_elements_base_vertex}
+    or @gl_extension{EXT,draw_elements_base_vertex} for drawing indexed
+    meshes with a non-zero base vertex.
+@requires_webgl_extension Extension
+    @webgl_extension{WEBGL,multi_draw_instanced_base_vertex_base_instance} for
+    drawing indexed meshes with a non-zero base vertex.
+*/
+MAGNUM_MESHTOOLS_EXPORT GL::Mesh compile(const Containers::Iterable<const Trade::MeshData>& meshes, const Containers::StridedArrayView1D<UnsignedInt>& counts, const Containers::StridedArrayView1D<UnsignedInt>& vertexOffsets, const Containers::StridedArrayView1D<UnsignedInt>& indexOffsets, CompileFlags flags = {});
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/**
+@brief Compile multiple meshes for vertex pulling
+@param[in]  meshes          Meshes to compile
+@param[in]  vertices        Buffer to upload the vertex data to
+@param[out] counts          Where to put index or vertex count of each mesh
+@param[out] vertexOffsets   Where to put offset of the first vertex of each
+    mesh
+@param[out] indexOffsets    Where to put byte offset of the first index of
+    each mesh. Can be empty if @p meshes are not indexed.
+@return Mesh with no vertex attributes and the vertex data layout
+@m_since_latest
+
+Similar to @ref compile(const Containers::Iterable<const Trade::MeshData>&, const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<UnsignedInt>&, CompileFlags),
+but instead of setting up vertex attribute bindings, vertex data of all
+@p meshes are converted with @ref vertexPullingData() and uploaded to
+@p vertices, which is meant to be bound as a shader storage buffer with
+@ref Shaders::FlatGL::bindVertexBuffer() or
+@ref Shaders::PhongGL::bindVertexBuffer() to a shader created with
+@ref Shaders::FlatGL::Flag::VertexPulling or
+@ref Shaders::PhongGL::Flag::VertexPulling. The shader then fetches the
+attributes based on the vertex ID, which in case of indexed draws already
+includes the base vertex, so no attribute state is needed. The returned mesh
+contains only the primitive, the index buffer, if the meshes are indexed, and
+count covering indices or vertices of all meshes together. Since all meshes
+drawn with a vertex pulling shader look the same from the vertex array point
+of view, a single such mesh can be used for all of them, eliminating vertex
+array switches between draws entirely:
+
+@snippet Shaders-gl.cpp compileVertexPulling
+
+The ranges in @p counts, @p vertexOffsets and @p indexOffsets are the same as
+with the @ref compile(const Containers::Iterable<const Trade::MeshData>&, const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<UnsignedInt>&, CompileFlags) "compile() overload"
+above, indices are not rebased and are widened to the largest index type among
+all @p meshes. All meshes are expected to have the same primitive and either
+all or none of them be indexed, the attributes don't need to match as they're
+stored separately. See @ref vertexPullingData() for additional restrictions.
+
+@note This function is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
+    for more information.
+
+@requires_gl43 Extension @gl_extension{ARB,shader_storage_buffer_object} for
+    the shader-side vertex fetching.
+@requires_gles31 Shader storage buffers are not available in OpenGL ES 3.0
+    and older.
+@requires_gles Shader storage buffers are not available in WebGL.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<GL::Mesh, VertexPullingLayout> compileVertexPulling(const Containers::Iterable<const Trade::MeshData>& meshes, GL::Buffer& vertices, const Containers::StridedArrayView1D<UnsignedInt>& counts, const Containers::StridedArrayView1D<UnsignedInt>& vertexOffsets, const Containers::StridedArrayView1D<UnsignedInt>& indexOffsets);
+#endif
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /**
 @brief Compile 2D mesh data
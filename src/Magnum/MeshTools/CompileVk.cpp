@@ -0,0 +1,102 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CompileVk.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Vk/BufferCreateInfo.h"
+#include "Magnum/Vk/Mesh.h"
+#include "Magnum/Vk/StagingUploader.h"
+
+namespace Magnum { namespace MeshTools {
+
+Vk::Mesh compile(Vk::StagingUploader& uploader, const Trade::MeshData& mesh, const Containers::ArrayView<const Containers::Pair<Trade::MeshAttribute, UnsignedInt>> locations) {
+    Vk::Device& device = uploader.device();
+
+    /* Put each attribute into its own binding, with the attribute offset
+       being the buffer binding offset. That way it works for both interleaved
+       and non-interleaved data. */
+    Vk::MeshLayout layout{mesh.primitive()};
+    Containers::Array<Containers::Optional<UnsignedInt>> ids{locations.size()};
+    Containers::Optional<UnsignedInt> lastBinding;
+    for(UnsignedInt i = 0; i != locations.size(); ++i) {
+        const Containers::Optional<UnsignedInt> id = mesh.findAttributeId(locations[i].first());
+        if(!id) continue;
+
+        CORRADE_ASSERT(!mesh.attributeArraySize(*id),
+            "MeshTools::compile(): array attributes not supported, got" << mesh.attributeName(*id), Vk::Mesh{Utility::move(layout)});
+        CORRADE_ASSERT(mesh.attributeStride(*id) >= 0,
+            "MeshTools::compile():" << mesh.attributeName(*id) << "stride expected to be non-negative but got" << mesh.attributeStride(*id), Vk::Mesh{Utility::move(layout)});
+
+        layout.addBinding(i, mesh.attributeStride(*id))
+              .addAttribute(locations[i].second(), i, mesh.attributeFormat(*id), 0);
+        ids[i] = id;
+        lastBinding = i;
+    }
+
+    Vk::Mesh out{Utility::move(layout)};
+
+    /* If there are no attributes to use, the vertex buffer would get
+       destroyed right after the upload is recorded, so skip it altogether.
+       Zero-sized buffers are not allowed either. */
+    if(lastBinding && !mesh.vertexData().isEmpty()) {
+        Vk::Buffer vertices{device, Vk::BufferCreateInfo{
+            Vk::BufferUsage::VertexBuffer|Vk::BufferUsage::TransferDestination,
+            mesh.vertexData().size()
+        }, Vk::MemoryFlag::DeviceLocal};
+        uploader.upload(vertices, 0, mesh.vertexData());
+
+        /* Reference the buffer from all bindings except the last, which takes
+           over the ownership */
+        for(UnsignedInt i = 0; i != *lastBinding; ++i)
+            if(ids[i]) out.addVertexBuffer(i, vertices, mesh.attributeOffset(*ids[i]));
+        out.addVertexBuffer(*lastBinding, Utility::move(vertices), mesh.attributeOffset(*ids[*lastBinding]));
+    }
+
+    if(mesh.isIndexed()) {
+        if(!mesh.indexData().isEmpty()) {
+            Vk::Buffer indices{device, Vk::BufferCreateInfo{
+                Vk::BufferUsage::IndexBuffer|Vk::BufferUsage::TransferDestination,
+                mesh.indexData().size()
+            }, Vk::MemoryFlag::DeviceLocal};
+            uploader.upload(indices, 0, mesh.indexData());
+            out.setIndexBuffer(Utility::move(indices), mesh.indexOffset(), mesh.indexType());
+        }
+        out.setCount(mesh.indexCount());
+    } else out.setCount(mesh.vertexCount());
+
+    return out;
+}
+
+Vk::Mesh compile(Vk::StagingUploader& uploader, const Trade::MeshData& mesh, const std::initializer_list<Containers::Pair<Trade::MeshAttribute, UnsignedInt>> locations) {
+    return compile(uploader, mesh, Containers::arrayView(locations));
+}
+
+}}
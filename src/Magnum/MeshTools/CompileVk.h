@@ -0,0 +1,94 @@
+#ifndef Magnum_MeshTools_CompileVk_h
+#define Magnum_MeshTools_CompileVk_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::compile(Vk::StagingUploader&, const Trade::MeshData&, Containers::ArrayView<const Containers::Pair<Trade::MeshAttribute, UnsignedInt>>)
+ * @m_since_latest
+ */
+
+#include "Magnum/configure.h"
+
+#ifdef MAGNUM_TARGET_VK
+#include <initializer_list>
+#include <Corrade/Containers/Pair.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Compile mesh data to a Vulkan mesh
+@param uploader     Staging uploader to upload the mesh data with
+@param mesh         Mesh data
+@param locations    Shader locations for particular attributes
+@m_since_latest
+
+Creates a @ref Vk::MemoryFlag::DeviceLocal vertex buffer containing
+@ref Trade::MeshData::vertexData() and, if the mesh is indexed, a device-local
+index buffer containing @ref Trade::MeshData::indexData(), and records their
+upload to @p uploader. The data are usable only once the batch containing the
+uploads completes, see @ref Vk::StagingUploader::submit() for more
+information.
+
+The returned mesh owns both buffers and its @ref Vk::MeshLayout, available
+through @ref Vk::Mesh::layout() for creating a compatible pipeline, has the
+primitive set to @ref Trade::MeshData::primitive(). For each item in
+@p locations, the first attribute of given name is added to the layout at given
+shader location, each in its own binding with the binding index corresponding
+to position of the item in @p locations, so attributes in both interleaved and
+non-interleaved layouts are supported. Attributes that are not present in
+@p mesh are skipped, as are attributes not listed in @p locations. Array
+attributes are not supported.
+
+If the mesh is indexed, the @ref Vk::Mesh::count() is set to
+@ref Trade::MeshData::indexCount(), otherwise to
+@ref Trade::MeshData::vertexCount().
+
+@snippet MeshTools-vk.cpp compile
+
+@note This function is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_VK enabled (done by default when building the
+    @ref Vk library). See @ref building-features for more information.
+*/
+MAGNUM_MESHTOOLS_EXPORT Vk::Mesh compile(Vk::StagingUploader& uploader, const Trade::MeshData& mesh, Containers::ArrayView<const Containers::Pair<Trade::MeshAttribute, UnsignedInt>> locations);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Vk::Mesh compile(Vk::StagingUploader& uploader, const Trade::MeshData& mesh, std::initializer_list<Containers::Pair<Trade::MeshAttribute, UnsignedInt>> locations);
+
+}}
+#else
+#error this header is available only in the Vulkan build
+#endif
+
+#endif
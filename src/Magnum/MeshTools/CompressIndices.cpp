@@ -44,47 +44,64 @@ namespace Magnum { namespace MeshTools {
 
 namespace {
 
-template<class T, class U> inline Containers::Array<char> compress(const Containers::StridedArrayView1D<const U>& indices, Long offset) {
+template<class T, class U> inline void compressInto(const Containers::StridedArrayView1D<const U>& indices, const Containers::StridedArrayView1D<T>& out, Long offset) {
     /* Can't use Math::castInto() here because we're subtracting an offset in
        addition */
-    Containers::Array<char> buffer{NoInit, indices.size()*sizeof(T)};
-    const Containers::ArrayView<T> view = Containers::arrayCast<T>(buffer);
     for(std::size_t i = 0; i != indices.size(); ++i)
-        view[i] = indices[i] - offset;
+        out[i] = indices[i] - offset;
+}
 
+template<class T, class U> inline Containers::Array<char> compress(const Containers::StridedArrayView1D<const U>& indices, Long offset) {
+    Containers::Array<char> buffer{NoInit, indices.size()*sizeof(T)};
+    compressInto(indices, Containers::StridedArrayView1D<T>{Containers::arrayCast<T>(buffer)}, offset);
     return buffer;
 }
 
-template<class T> Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndicesImplementation(const Containers::StridedArrayView1D<const T>& indices, const MeshIndexType atLeast, const Long offset) {
-    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(atLeast),
-        "MeshTools::compressIndices(): can't compress to an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(atLeast),
-        (Containers::Pair<Containers::Array<char>, MeshIndexType>{nullptr, MeshIndexType::UnsignedInt}));
-
+template<class T> MeshIndexType compressedIndexTypeImplementation(const Containers::StridedArrayView1D<const T>& indices, const MeshIndexType atLeast, const Long offset) {
     const UnsignedInt max = Math::max(indices) - offset;
-    Containers::Array<char> out;
-    MeshIndexType type;
     const UnsignedInt log = Math::log(256, max);
 
     /* If it fits into 8 bytes and 8 bytes are allowed, pack into 8 */
-    if(log == 0 && atLeast == MeshIndexType::UnsignedByte) {
-        out = compress<UnsignedByte>(indices, offset);
-        type = MeshIndexType::UnsignedByte;
+    if(log == 0 && atLeast == MeshIndexType::UnsignedByte)
+        return MeshIndexType::UnsignedByte;
 
     /* Otherwise, if it fits into either 8 or 16 bytes and we allow either 8 or
        16, pack into 16 */
-    } else if(log <= 1 && atLeast != MeshIndexType::UnsignedInt) {
-        out = compress<UnsignedShort>(indices, offset);
-        type = MeshIndexType::UnsignedShort;
+    if(log <= 1 && atLeast != MeshIndexType::UnsignedInt)
+        return MeshIndexType::UnsignedShort;
 
     /* Otherwise pack into 32 */
-    } else {
+    return MeshIndexType::UnsignedInt;
+}
+
+template<class T> Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndicesImplementation(const Containers::StridedArrayView1D<const T>& indices, const MeshIndexType atLeast, const Long offset) {
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(atLeast),
+        "MeshTools::compressIndices(): can't compress to an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(atLeast),
+        (Containers::Pair<Containers::Array<char>, MeshIndexType>{nullptr, MeshIndexType::UnsignedInt}));
+
+    const MeshIndexType type = compressedIndexTypeImplementation(indices, atLeast, offset);
+    Containers::Array<char> out;
+    if(type == MeshIndexType::UnsignedByte)
+        out = compress<UnsignedByte>(indices, offset);
+    else if(type == MeshIndexType::UnsignedShort)
+        out = compress<UnsignedShort>(indices, offset);
+    else
         out = compress<UnsignedInt>(indices, offset);
-        type = MeshIndexType::UnsignedInt;
-    }
 
     return {Utility::move(out), type};
 }
 
+template<class T> void compressIndicesIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView2D<char>& out, const Long offset) {
+    if(out.size()[1] == 4)
+        compressInto(indices, Containers::arrayCast<1, UnsignedInt>(out), offset);
+    else if(out.size()[1] == 2)
+        compressInto(indices, Containers::arrayCast<1, UnsignedShort>(out), offset);
+    else {
+        CORRADE_ASSERT(out.size()[1] == 1, "MeshTools::compressIndicesInto(): expected output index type size 1, 2 or 4 but got" << out.size()[1], );
+        compressInto(indices, Containers::arrayCast<1, UnsignedByte>(out), offset);
+    }
+}
+
 }
 
 Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const MeshIndexType atLeast, const Long offset) {
@@ -127,6 +144,35 @@ Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndices(const C
     return compressIndices(indices, MeshIndexType::UnsignedShort, offset);
 }
 
+MeshIndexType compressedIndexType(const Containers::StridedArrayView2D<const char>& indices, const MeshIndexType atLeast, const Long offset) {
+    CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(atLeast),
+        "MeshTools::compressedIndexType(): can't compress to an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(atLeast), {});
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::compressedIndexType(): second view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return compressedIndexTypeImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), atLeast, offset);
+    else if(indices.size()[1] == 2)
+        return compressedIndexTypeImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), atLeast, offset);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::compressedIndexType(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return compressedIndexTypeImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), atLeast, offset);
+    }
+}
+
+void compressIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView2D<char>& out, const Long offset) {
+    CORRADE_ASSERT(indices.size()[0] == out.size()[0],
+        "MeshTools::compressIndicesInto(): expected output view with" << indices.size()[0] << "elements but got" << out.size()[0], );
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::compressIndicesInto(): second index view dimension is not contiguous", );
+    CORRADE_ASSERT(out.isContiguous<1>(), "MeshTools::compressIndicesInto(): second output view dimension is not contiguous", );
+    if(indices.size()[1] == 4)
+        compressIndicesIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), out, offset);
+    else if(indices.size()[1] == 2)
+        compressIndicesIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), out, offset);
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::compressIndicesInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+        compressIndicesIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), out, offset);
+    }
+}
+
 Trade::MeshData compressIndices(Trade::MeshData&& mesh, MeshIndexType atLeast) {
     CORRADE_ASSERT(mesh.isIndexed(), "MeshTools::compressIndices(): mesh data not indexed", (Trade::MeshData{MeshPrimitive::Triangles, 0}));
 
@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::compressIndices()
+ * @brief Function @ref Magnum::MeshTools::compressIndices(), @ref Magnum::MeshTools::compressedIndexType(), @ref Magnum::MeshTools::compressIndicesInto()
  */
 
 #include <Corrade/Containers/Containers.h>
@@ -146,6 +146,40 @@ with @p atLeast set to @ref MeshIndexType::UnsignedShort.
 */
 MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndices(const Containers::StridedArrayView2D<const char>& indices, Long offset);
 
+/**
+@brief Smallest index type a type-erased index array can be compressed to
+@m_since_latest
+
+Calculates the type @ref compressIndices(const Containers::StridedArrayView2D<const char>&, MeshIndexType, Long)
+would compress @p indices to, without allocating or writing anything. Together
+with @ref compressIndicesInto() it allows compressing index arrays that don't
+fit into memory, for example ones referenced by a @ref Trade::MeshData
+deserialized from a memory-mapped file, as both functions make just a single
+linear pass over the data:
+
+@snippet MeshTools.cpp compressIndicesInto
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. The @p atLeast parameter is expected to not
+be an implementation-specific type.
+@see @ref isMeshIndexTypeImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT MeshIndexType compressedIndexType(const Containers::StridedArrayView2D<const char>& indices, MeshIndexType atLeast = MeshIndexType::UnsignedShort, Long offset = 0);
+
+/**
+@brief Compress a type-erased index array into an existing location
+@m_since_latest
+
+Subtracts @p offset from each index in @p indices and writes it into @p out.
+Expects that @p indices and @p out have the same size, that the second
+dimension of both is contiguous and represents the actual 1/2/4-byte index
+type, and that all indices fit into the output type after subtracting
+@p offset, which is the case if the output type is the one returned from
+@ref compressedIndexType(). Unlike @ref compressIndices(), this function
+doesn't allocate, so @p out can point for example to a memory-mapped file.
+*/
+MAGNUM_MESHTOOLS_EXPORT void compressIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView2D<char>& out, Long offset = 0);
+
 /**
 @brief Compress mesh data indices
 @m_since{2020,06}
@@ -34,6 +34,89 @@
 
 namespace Magnum { namespace MeshTools {
 
+namespace {
+
+/* Copies indices and attributes of a single mesh to given index and vertex
+   offset in out, expanding the indices to 32 bits and adjusting them for the
+   vertex offset. Used by both concatenate() and MeshConcatenator::add().
+   Returns false if an assertion fired. */
+bool concatenateMesh(Trade::MeshData& out, const Containers::ArrayView<UnsignedInt> indices, const Trade::MeshData& mesh, const std::size_t i, std::size_t& indexOffset, const std::size_t vertexOffset, const char* const assertPrefix) {
+    #if defined(CORRADE_NO_ASSERT) || defined(CORRADE_STANDARD_ASSERT)
+    static_cast<void>(i);
+    static_cast<void>(assertPrefix);
+    #endif
+
+    /* This won't fire for the first mesh in concatenate(), as that's where
+       out.primitive() comes from */
+    CORRADE_ASSERT(mesh.primitive() == out.primitive(),
+        assertPrefix << "expected" << out.primitive() << "but got" << mesh.primitive() << "in mesh" << i,
+        false);
+
+    /* If the mesh is indexed, copy the indices over, expanded to 32bit */
+    if(mesh.isIndexed()) {
+        CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+            assertPrefix << "mesh" << i << "has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+            false);
+
+        Containers::ArrayView<UnsignedInt> dst = indices.slice(indexOffset, indexOffset + mesh.indexCount());
+        mesh.indicesInto(dst);
+        indexOffset += mesh.indexCount();
+
+        /* Adjust indices for current vertex offset */
+        for(UnsignedInt& index: dst) index += vertexOffset;
+
+    /* Otherwise, if we need an index buffer (meaning at least one of the
+       meshes is indexed), generate a trivial index buffer */
+    } else if(!indices.isEmpty()) {
+        std::iota(indices + indexOffset, indices + indexOffset + mesh.vertexCount(), UnsignedInt(vertexOffset));
+        indexOffset += mesh.vertexCount();
+    }
+
+    /* Copy attributes to their destination, skipping ones that don't have
+       any equivalent in the destination mesh */
+    for(UnsignedInt src = 0; src != mesh.attributeCount(); ++src) {
+        /* Try to find a matching attribute in the destination mesh (same
+           name, same set, same morph target ID). Skip if no such attribute
+           is found. This is a O(m + n) complexity (linear lookup in both
+           the source and the output mesh), but given the assumption that
+           meshes rarely have more than 8-16 attributes it should still be
+           faster than building a hashmap first and then doing a complex
+           lookup in it (which is how it used to be before, using
+           std::unordered_multimap). */
+        const Containers::Optional<UnsignedInt> dst = out.findAttributeId(mesh.attributeName(src), mesh.attributeId(src), mesh.attributeMorphTargetId(src));
+        if(!dst)
+            continue;
+
+        /* Check format compatibility. This won't fire for the first mesh
+           in concatenate(), as that's where the layout comes from */
+        CORRADE_ASSERT(out.attributeFormat(*dst) == mesh.attributeFormat(src),
+            assertPrefix << "expected" << out.attributeFormat(*dst) << "for attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ") but got" << mesh.attributeFormat(src) << "in mesh" << i << "attribute" << src,
+            false);
+        CORRADE_ASSERT(!out.attributeArraySize(*dst) == !mesh.attributeArraySize(src),
+            assertPrefix << "attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ")" << (out.attributeArraySize(*dst) ? "is" : "isn't") << "an array but attribute" << src << "in mesh" << i << (mesh.attributeArraySize(src) ? "is" : "isn't"),
+            false);
+        CORRADE_ASSERT(out.attributeArraySize(*dst) >= mesh.attributeArraySize(src),
+            assertPrefix << "expected array size" << out.attributeArraySize(*dst) << "or less for attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ") but got" << mesh.attributeArraySize(src) << "in mesh" << i << "attribute" << src,
+            false);
+
+        const Containers::StridedArrayView2D<const char> srcAttribute = mesh.attribute(src);
+        const Containers::StridedArrayView2D<char> dstAttribute = out.mutableAttribute(*dst);
+
+        /* Copy the data to a slice of the output. For non-array attributes
+           the second dimension should be matching (because the format is
+           matching), for array attributes we may be copying to just a
+           prefix of the elements in dstAttribute. */
+        CORRADE_INTERNAL_ASSERT(out.attributeArraySize(*dst) || srcAttribute.size()[1] == dstAttribute.size()[1]);
+        Utility::copy(srcAttribute, dstAttribute.sliceSize(
+            {vertexOffset, 0},
+            {mesh.vertexCount(), srcAttribute.size()[1]}));
+    }
+
+    return true;
+}
+
+}
+
 namespace Implementation {
 
 Containers::Pair<UnsignedInt, UnsignedInt> concatenateIndexVertexCount(const Containers::Iterable<const Trade::MeshData>& meshes) {
@@ -92,76 +175,11 @@ Trade::MeshData concatenate(Containers::Array<char>&& indexData, const UnsignedI
     std::size_t indexOffset = 0;
     std::size_t vertexOffset = 0;
     for(std::size_t i = 0; i != meshes.size(); ++i) {
-        const Trade::MeshData& mesh = meshes[i];
-
-        /* This won't fire for i == ~std::size_t{}, as that's where
-           out.primitive() comes from */
-        CORRADE_ASSERT(mesh.primitive() == out.primitive(),
-            assertPrefix << "expected" << out.primitive() << "but got" << mesh.primitive() << "in mesh" << i,
-            (Trade::MeshData{MeshPrimitive{}, 0}));
-
-        /* If the mesh is indexed, copy the indices over, expanded to 32bit */
-        if(mesh.isIndexed()) {
-            CORRADE_ASSERT(!isMeshIndexTypeImplementationSpecific(mesh.indexType()),
-                assertPrefix << "mesh" << i << "has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
-                (Trade::MeshData{MeshPrimitive{}, 0}));
-
-            Containers::ArrayView<UnsignedInt> dst = indices.slice(indexOffset, indexOffset + mesh.indexCount());
-            mesh.indicesInto(dst);
-            indexOffset += mesh.indexCount();
-
-            /* Adjust indices for current vertex offset */
-            for(UnsignedInt& index: dst) index += vertexOffset;
-
-        /* Otherwise, if we need an index buffer (meaning at least one of the
-           meshes is indexed), generate a trivial index buffer */
-        } else if(!indices.isEmpty()) {
-            std::iota(indices + indexOffset, indices + indexOffset + mesh.vertexCount(), UnsignedInt(vertexOffset));
-            indexOffset += mesh.vertexCount();
-        }
-
-        /* Copy attributes to their destination, skipping ones that don't have
-           any equivalent in the destination mesh */
-        for(UnsignedInt src = 0; src != mesh.attributeCount(); ++src) {
-            /* Try to find a matching attribute in the destination mesh (same
-               name, same set, same morph target ID). Skip if no such attribute
-               is found. This is a O(m + n) complexity (linear lookup in both
-               the source and the output mesh), but given the assumption that
-               meshes rarely have more than 8-16 attributes it should still be
-               faster than building a hashmap first and then doing a complex
-               lookup in it (which is how it used to be before, using
-               std::unordered_multimap). */
-            const Containers::Optional<UnsignedInt> dst = out.findAttributeId(mesh.attributeName(src), mesh.attributeId(src), mesh.attributeMorphTargetId(src));
-            if(!dst)
-                continue;
-
-            /* Check format compatibility. This won't fire for i == 0, as
-               that's where out.primitive() comes from */
-            CORRADE_ASSERT(out.attributeFormat(*dst) == mesh.attributeFormat(src),
-                assertPrefix << "expected" << out.attributeFormat(*dst) << "for attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ") but got" << mesh.attributeFormat(src) << "in mesh" << i << "attribute" << src,
-                (Trade::MeshData{MeshPrimitive{}, 0}));
-            CORRADE_ASSERT(!out.attributeArraySize(*dst) == !mesh.attributeArraySize(src),
-                assertPrefix << "attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ")" << (out.attributeArraySize(*dst) ? "is" : "isn't") << "an array but attribute" << src << "in mesh" << i << (mesh.attributeArraySize(src) ? "is" : "isn't"),
-                (Trade::MeshData{MeshPrimitive{}, 0}));
-            CORRADE_ASSERT(out.attributeArraySize(*dst) >= mesh.attributeArraySize(src),
-                assertPrefix << "expected array size" << out.attributeArraySize(*dst) << "or less for attribute" << dst << "(" << Debug::nospace << out.attributeName(*dst) << Debug::nospace << ") but got" << mesh.attributeArraySize(src) << "in mesh" << i << "attribute" << src,
-                (Trade::MeshData{MeshPrimitive{}, 0}));
-
-            const Containers::StridedArrayView2D<const char> srcAttribute = mesh.attribute(src);
-            const Containers::StridedArrayView2D<char> dstAttribute = out.mutableAttribute(*dst);
-
-            /* Copy the data to a slice of the output. For non-array attributes
-               the second dimension should be matching (because the format is
-               matching), for array attributes we may be copying to just a
-               prefix of the elements in dstAttribute. */
-            CORRADE_INTERNAL_ASSERT(out.attributeArraySize(*dst) || srcAttribute.size()[1] == dstAttribute.size()[1]);
-            Utility::copy(srcAttribute, dstAttribute.sliceSize(
-                {vertexOffset, 0},
-                {mesh.vertexCount(), srcAttribute.size()[1]}));
-        }
+        if(!concatenateMesh(out, indices, meshes[i], i, indexOffset, vertexOffset, assertPrefix))
+            return Trade::MeshData{MeshPrimitive{}, 0};
 
         /* Update vertex offset for the next mesh */
-        vertexOffset += mesh.vertexCount();
+        vertexOffset += meshes[i].vertexCount();
     }
 
     return out;
@@ -169,6 +187,99 @@ Trade::MeshData concatenate(Containers::Array<char>&& indexData, const UnsignedI
 
 }
 
+MeshConcatenator::MeshConcatenator(const Trade::MeshData& layout, const InterleaveFlags flags): _primitive{layout.primitive()}, _indexed{}, _vertexCount{}, _stride{}, _meshCount{} {
+    /* Only list primitives are supported currently, same as in
+       concatenate() */
+    CORRADE_ASSERT(
+        layout.primitive() != MeshPrimitive::LineStrip &&
+        layout.primitive() != MeshPrimitive::LineLoop &&
+        layout.primitive() != MeshPrimitive::TriangleStrip &&
+        layout.primitive() != MeshPrimitive::TriangleFan,
+        "MeshTools::MeshConcatenator:" << layout.primitive() << "is not supported, turn it into a plain indexed mesh first", );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != layout.attributeCount(); ++i) {
+        const VertexFormat format = layout.attributeFormat(i);
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            "MeshTools::MeshConcatenator: attribute" << i << "of the layout mesh has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format), );
+    }
+    #endif
+
+    /* Make a non-owning copy of the attribute data to avoid
+       interleavedLayout() stealing the original. The result is offset-only
+       with zero vertex count, and gets remapped to the actual vertex data in
+       add() and finish(). */
+    if(layout.attributeCount()) {
+        _attributes = Implementation::interleavedLayout(Trade::MeshData{layout.primitive(),
+            {}, layout.vertexData(),
+            Trade::meshAttributeDataNonOwningArray(layout.attributeData())}, {}, flags);
+        _stride = _attributes[0].stride();
+    }
+}
+
+MeshConcatenator::MeshConcatenator(MeshConcatenator&&) noexcept = default;
+
+MeshConcatenator::~MeshConcatenator() = default;
+
+MeshConcatenator& MeshConcatenator::operator=(MeshConcatenator&&) noexcept = default;
+
+MeshConcatenator& MeshConcatenator::reserve(const UnsignedInt indexCount, const UnsignedInt vertexCount) {
+    arrayReserve(_indexData, std::size_t(indexCount)*sizeof(UnsignedInt));
+    /* A cast to std::size_t is needed in order to allow sizes over 4 GB on
+       64-bit */
+    arrayReserve(_vertexData, std::size_t(_stride)*vertexCount);
+    return *this;
+}
+
+MeshConcatenator& MeshConcatenator::add(const Trade::MeshData& mesh) {
+    const std::size_t vertexOffset = _vertexCount;
+    std::size_t indexOffset = _indexData.size()/sizeof(UnsignedInt);
+
+    /* If this is the first indexed mesh, generate a trivial index buffer for
+       all previously added vertices */
+    if(mesh.isIndexed() && !_indexed) {
+        _indexed = true;
+        const Containers::ArrayView<UnsignedInt> trivialIndices = Containers::arrayCast<UnsignedInt>(arrayAppend(_indexData, NoInit, vertexOffset*sizeof(UnsignedInt)));
+        std::iota(trivialIndices.begin(), trivialIndices.end(), 0u);
+        indexOffset = vertexOffset;
+    }
+
+    /* Grow the buffers. Index data are overwritten fully, vertex data get
+       zero-initialized as they may have holes for missing attributes. */
+    if(_indexed)
+        arrayAppend(_indexData, NoInit, (mesh.isIndexed() ? mesh.indexCount() : mesh.vertexCount())*sizeof(UnsignedInt));
+    arrayAppend(_vertexData, ValueInit, std::size_t(_stride)*mesh.vertexCount());
+    _vertexCount += mesh.vertexCount();
+
+    /* Make a temporary view on the data to copy the mesh into */
+    Containers::Array<Trade::MeshAttributeData> attributes{_attributes.size()};
+    for(std::size_t i = 0; i != _attributes.size(); ++i)
+        attributes[i] = Implementation::remapAttributeData(_attributes[i], _vertexCount, _vertexData, _vertexData);
+    Trade::MeshData out{_primitive, Trade::DataFlag::Mutable, Containers::arrayView(_vertexData), Utility::move(attributes), _vertexCount};
+
+    if(concatenateMesh(out, Containers::arrayCast<UnsignedInt>(_indexData), mesh, _meshCount, indexOffset, vertexOffset, "MeshTools::MeshConcatenator::add():"))
+        ++_meshCount;
+    return *this;
+}
+
+Trade::MeshData MeshConcatenator::finish() {
+    Containers::Array<Trade::MeshAttributeData> attributes{_attributes.size()};
+    for(std::size_t i = 0; i != _attributes.size(); ++i)
+        attributes[i] = Implementation::remapAttributeData(_attributes[i], _vertexCount, _vertexData, _vertexData);
+
+    const Trade::MeshIndexData indices = _indexed ?
+        Trade::MeshIndexData{Containers::arrayCast<UnsignedInt>(_indexData)} : Trade::MeshIndexData{};
+    Trade::MeshData out{_primitive,
+        Utility::move(_indexData), indices,
+        Utility::move(_vertexData), Utility::move(attributes), _vertexCount};
+
+    /* Reset to an empty state. The arrays are empty after being moved
+       from. */
+    _indexed = false;
+    _vertexCount = 0;
+    _meshCount = 0;
+    return out;
+}
+
 Trade::MeshData concatenate(const Containers::Iterable<const Trade::MeshData>& meshes, const InterleaveFlags flags) {
     CORRADE_ASSERT(!meshes.isEmpty(),
         "MeshTools::concatenate(): expected at least one mesh",
@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::concatenate(), @ref Magnum::MeshTools::concatenateInto()
+ * @brief Function @ref Magnum::MeshTools::concatenate(), @ref Magnum::MeshTools::concatenateInto(), class @ref Magnum::MeshTools::MeshConcatenator
  * @m_since{2020,06}
  */
 
@@ -82,7 +82,8 @@ description.
 If an index buffer is needed, @ref MeshIndexType::UnsignedInt is always used.
 Call @ref compressIndices(const Trade::MeshData&, MeshIndexType) on the result
 to compress it to a smaller type, if desired.
-@see @ref concatenateInto(), @ref isMeshIndexTypeImplementationSpecific(),
+@see @ref concatenateInto(), @ref MeshConcatenator,
+    @ref isMeshIndexTypeImplementationSpecific(),
     @ref isVertexFormatImplementationSpecific(),
     @ref SceneTools::flattenMeshHierarchy2D(),
     @ref SceneTools::flattenMeshHierarchy3D()
@@ -143,6 +144,134 @@ template<template<class> class Allocator = Containers::ArrayAllocator> void conc
     destination = Implementation::concatenate(Utility::move(indexData), indexVertexCount.second(), Utility::move(vertexData), Utility::move(attributeData), meshes, "MeshTools::concatenateInto():");
 }
 
+/**
+@brief Incremental mesh concatenator
+@m_since_latest
+
+Compared to @ref concatenate(const Containers::Iterable<const Trade::MeshData>&, InterleaveFlags),
+which needs all input meshes to be present at once, meshes are added one by
+one with @ref add() and copied to growable index and vertex buffers right
+away, so each input can be discarded as soon as it's added. The peak memory
+use is thus bounded by the size of the output instead of the size of the
+output and all inputs together. Use @ref reserve() if the total index and
+vertex count is known upfront to avoid reallocations and growth overhead.
+
+The attribute layout and primitive of the output are taken from a mesh passed
+to the constructor, with the layout calculated by @ref interleavedLayout().
+Only attributes are used from the layout mesh, not its data, so it can be
+for example the first of the meshes passed to @ref add(). Each added mesh is
+then treated the same way as in @ref concatenate() --- matching attributes are
+copied, superfluous attributes ignored and missing attributes zeroed out. If
+any added mesh is indexed, the output is indexed as well, with a trivial
+index buffer generated for all non-indexed meshes including the ones added
+before.
+
+The result is retrieved with @ref finish(), after which the concatenator is
+empty again with the same layout, ready to produce another mesh. The output
+is the same as if all meshes were passed to @ref concatenate() with the layout
+mesh being the first of them.
+*/
+class MAGNUM_MESHTOOLS_EXPORT MeshConcatenator {
+    public:
+        /**
+         * @brief Constructor
+         * @param layout    Mesh to take the primitive and attribute layout
+         *      from
+         * @param flags     Flags to pass to @ref interleavedLayout()
+         *
+         * Expects that @p layout isn't @ref MeshPrimitive::LineStrip,
+         * @ref MeshPrimitive::LineLoop, @ref MeshPrimitive::TriangleStrip
+         * or @ref MeshPrimitive::TriangleFan and its attributes don't have
+         * an implementation-specific format.
+         */
+        explicit MeshConcatenator(const Trade::MeshData& layout, InterleaveFlags flags = InterleaveFlag::PreserveInterleavedAttributes);
+
+        /** @brief Copying is not allowed */
+        MeshConcatenator(const MeshConcatenator&) = delete;
+
+        /** @brief Move constructor */
+        MeshConcatenator(MeshConcatenator&&) noexcept;
+
+        ~MeshConcatenator();
+
+        /** @brief Copying is not allowed */
+        MeshConcatenator& operator=(const MeshConcatenator&) = delete;
+
+        /** @brief Move assignment */
+        MeshConcatenator& operator=(MeshConcatenator&&) noexcept;
+
+        /** @brief Primitive */
+        MeshPrimitive primitive() const { return _primitive; }
+
+        /** @brief Count of meshes added so far */
+        std::size_t meshCount() const { return _meshCount; }
+
+        /**
+         * @brief Whether the output is indexed
+         *
+         * Becomes @cpp true @ce once an indexed mesh is added.
+         */
+        bool isIndexed() const { return _indexed; }
+
+        /**
+         * @brief Count of indices added so far
+         *
+         * Including indices generated for non-indexed meshes, or
+         * @cpp 0 @ce if the output isn't indexed.
+         */
+        UnsignedInt indexCount() const { return _indexData.size()/sizeof(UnsignedInt); }
+
+        /** @brief Count of vertices added so far */
+        UnsignedInt vertexCount() const { return _vertexCount; }
+
+        /**
+         * @brief Reserve memory for given total index and vertex count
+         * @return Reference to self (for method chaining)
+         *
+         * The @p indexCount is only used once the output becomes indexed,
+         * so pass @cpp 0 @ce if none of the meshes is expected to be
+         * indexed.
+         */
+        MeshConcatenator& reserve(UnsignedInt indexCount, UnsignedInt vertexCount);
+
+        /**
+         * @brief Add a mesh
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p mesh has the same primitive as the layout mesh,
+         * doesn't have an implementation-specific index type, and that its
+         * attributes matching the layout have the same format and the same
+         * or smaller array size. See
+         * @ref concatenate(const Containers::Iterable<const Trade::MeshData>&, InterleaveFlags)
+         * for more information.
+         */
+        MeshConcatenator& add(const Trade::MeshData& mesh);
+
+        /**
+         * @brief Finish the mesh
+         *
+         * Returns all meshes added so far concatenated together, with
+         * @ref MeshIndexType::UnsignedInt indices if any of them was
+         * indexed. Both index and vertex data have
+         * @ref Trade::DataFlag::Owned and @ref Trade::DataFlag::Mutable set.
+         * The data are allocated with @ref Containers::ArrayAllocator and
+         * thus may have some unused capacity at the end unless
+         * @ref reserve() was used. After calling this function the
+         * concatenator is empty again, with the same layout.
+         */
+        Trade::MeshData finish();
+
+    private:
+        MeshPrimitive _primitive;
+        bool _indexed;
+        UnsignedInt _vertexCount;
+        UnsignedInt _stride;
+        std::size_t _meshCount;
+        Containers::Array<Trade::MeshAttributeData> _attributes;
+        Containers::Array<char> _indexData;
+        Containers::Array<char> _vertexData;
+};
+
 }}
 
 #endif
@@ -0,0 +1,444 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Encode.h"
+
+#include <cstring>
+#include <limits>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/VertexFormat.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+void writeVarint(Containers::Array<char>& out, UnsignedLong value) {
+    while(value >= 0x80) {
+        arrayAppend(out, char((value & 0x7f)|0x80));
+        value >>= 7;
+    }
+    arrayAppend(out, char(value));
+}
+
+bool readVarint(const Containers::ArrayView<const char> data, std::size_t& position, UnsignedLong& value) {
+    value = 0;
+    for(UnsignedInt shift = 0; shift < 64; shift += 7) {
+        if(position == data.size()) return false;
+        const UnsignedByte byte = data[position++];
+        value |= UnsignedLong(byte & 0x7f) << shift;
+        if(!(byte & 0x80)) return true;
+    }
+
+    /* More than ten bytes, can't be a valid 64-bit value */
+    return false;
+}
+
+void writeChunk(Containers::Array<char>& out, const Containers::ArrayView<const char> chunk) {
+    writeVarint(out, chunk.size());
+    arrayAppend(out, chunk);
+}
+
+bool readChunk(const Containers::ArrayView<const char> data, std::size_t& position, Containers::ArrayView<const char>& chunk) {
+    UnsignedLong size;
+    if(!readVarint(data, position, size) || size > data.size() - position)
+        return false;
+    chunk = data.slice(position, position + size);
+    position += size;
+    return true;
+}
+
+template<class T> Containers::Array<char> encodeIndicesImplementation(const Containers::StridedArrayView1D<const T>& indices) {
+    Containers::Array<char> out;
+    arrayReserve(out, indices.size() + indices.size()/2);
+
+    UnsignedInt previous = 0;
+    for(const T index: indices) {
+        /* Wrapping around is fine, the decoder wraps back the same way */
+        const Int delta = Int(UnsignedInt(index) - previous);
+        writeVarint(out, (UnsignedInt(delta) << 1) ^ UnsignedInt(delta >> 31));
+        previous = index;
+    }
+
+    /* Convert back to a default deleter to make the data usable without
+       referencing the growable deleter function */
+    arrayShrink(out, DefaultInit);
+    return out;
+}
+
+template<class T> bool decodeIndicesIntoImplementation(const Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<T>& out) {
+    std::size_t position = 0;
+    UnsignedInt previous = 0;
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        UnsignedLong value;
+        if(!readVarint(data, position, value) || value > 0xffffffffull) {
+            Error{} << "MeshTools::decodeIndicesInto(): invalid or truncated data for index" << i << "out of" << out.size();
+            return false;
+        }
+
+        const UnsignedInt zigzag = UnsignedInt(value);
+        const UnsignedInt index = previous + ((zigzag >> 1) ^ (0u - (zigzag & 1)));
+        if(index > std::numeric_limits<T>::max()) {
+            Error{} << "MeshTools::decodeIndicesInto(): index" << i << "with value" << index << "doesn't fit into a" << sizeof(T)*8 << Debug::nospace << "-bit type";
+            return false;
+        }
+
+        out[i] = T(index);
+        previous = index;
+    }
+
+    if(position != data.size()) {
+        Error{} << "MeshTools::decodeIndicesInto(): expected" << position << "bytes for" << out.size() << "indices but got" << data.size();
+        return false;
+    }
+
+    return true;
+}
+
+constexpr char MeshMagic[]{'M', 'M', 'S', 'H'};
+constexpr UnsignedInt MeshVersion = 1;
+
+}
+
+Containers::Array<char> encodeIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices) {
+    return encodeIndicesImplementation(indices);
+}
+
+Containers::Array<char> encodeIndices(const Containers::StridedArrayView1D<const UnsignedShort>& indices) {
+    return encodeIndicesImplementation(indices);
+}
+
+Containers::Array<char> encodeIndices(const Containers::StridedArrayView1D<const UnsignedByte>& indices) {
+    return encodeIndicesImplementation(indices);
+}
+
+Containers::Array<char> encodeIndices(const Containers::StridedArrayView2D<const char>& indices) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::encodeIndices(): second view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return encodeIndicesImplementation(Containers::arrayCast<1, const UnsignedInt>(indices));
+    else if(indices.size()[1] == 2)
+        return encodeIndicesImplementation(Containers::arrayCast<1, const UnsignedShort>(indices));
+    else {
+        CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::encodeIndices(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+        return encodeIndicesImplementation(Containers::arrayCast<1, const UnsignedByte>(indices));
+    }
+}
+
+bool decodeIndicesInto(const Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedInt>& out) {
+    return decodeIndicesIntoImplementation(data, out);
+}
+
+bool decodeIndicesInto(const Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedShort>& out) {
+    return decodeIndicesIntoImplementation(data, out);
+}
+
+bool decodeIndicesInto(const Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedByte>& out) {
+    return decodeIndicesIntoImplementation(data, out);
+}
+
+Containers::Array<char> encodeVertices(const Containers::StridedArrayView2D<const char>& data) {
+    Containers::Array<char> out;
+    arrayReserve(out, data.size()[0]*data.size()[1]);
+
+    /* Go column by column, i.e. first bytes of all vertices, then second
+       bytes and so on. Zero runs can span across columns. */
+    const Containers::StridedArrayView2D<const char> transposed = data.transposed<0, 1>();
+    UnsignedLong zeros = 0;
+    for(std::size_t i = 0; i != transposed.size()[0]; ++i) {
+        UnsignedByte previous = 0;
+        for(const char byte: transposed[i]) {
+            const UnsignedByte delta = UnsignedByte(UnsignedByte(byte) - previous);
+            previous = byte;
+            if(!delta) {
+                ++zeros;
+                continue;
+            }
+
+            if(zeros) {
+                arrayAppend(out, '\0');
+                writeVarint(out, zeros - 1);
+                zeros = 0;
+            }
+            arrayAppend(out, char(delta));
+        }
+    }
+
+    if(zeros) {
+        arrayAppend(out, '\0');
+        writeVarint(out, zeros - 1);
+    }
+
+    /* Convert back to a default deleter to make the data usable without
+       referencing the growable deleter function */
+    arrayShrink(out, DefaultInit);
+    return out;
+}
+
+bool decodeVerticesInto(const Containers::ArrayView<const char> data, const Containers::StridedArrayView2D<char>& out) {
+    std::size_t position = 0;
+    UnsignedLong zeros = 0;
+    const Containers::StridedArrayView2D<char> transposed = out.transposed<0, 1>();
+    for(std::size_t i = 0; i != transposed.size()[0]; ++i) {
+        UnsignedByte previous = 0;
+        for(char& byte: transposed[i]) {
+            if(zeros) --zeros;
+            else {
+                if(position == data.size()) {
+                    Error{} << "MeshTools::decodeVerticesInto(): expected more than" << data.size() << "bytes for" << out.size()[0] << "vertices of" << out.size()[1] << "bytes";
+                    return false;
+                }
+
+                const UnsignedByte delta = data[position++];
+                if(delta) previous += delta;
+                else if(!readVarint(data, position, zeros)) {
+                    Error{} << "MeshTools::decodeVerticesInto(): invalid or truncated run length at byte" << position;
+                    return false;
+                }
+            }
+
+            byte = previous;
+        }
+    }
+
+    if(zeros || position != data.size()) {
+        Error{} << "MeshTools::decodeVerticesInto(): data larger than expected for" << out.size()[0] << "vertices of" << out.size()[1] << "bytes";
+        return false;
+    }
+
+    return true;
+}
+
+Containers::Array<char> encodeMesh(const Trade::MeshData& mesh) {
+    CORRADE_ASSERT(!mesh.isIndexed() || !isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::encodeMesh(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), {});
+
+    Containers::Array<char> out;
+    arrayAppend(out, Containers::arrayView(MeshMagic));
+    writeVarint(out, MeshVersion);
+    writeVarint(out, UnsignedInt(mesh.primitive()));
+    writeVarint(out, mesh.isIndexed() ? UnsignedInt(mesh.indexType()) : 0);
+    writeVarint(out, mesh.isIndexed() ? mesh.indexCount() : 0);
+    writeVarint(out, mesh.vertexCount());
+    writeVarint(out, mesh.attributeCount());
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat format = mesh.attributeFormat(i);
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            "MeshTools::encodeMesh(): attribute" << i << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format), {});
+        writeVarint(out, UnsignedShort(mesh.attributeName(i)));
+        writeVarint(out, UnsignedInt(format));
+        writeVarint(out, mesh.attributeArraySize(i));
+        /* Shifted by one so -1 is stored as 0 */
+        writeVarint(out, UnsignedInt(mesh.attributeMorphTargetId(i) + 1));
+    }
+
+    if(mesh.isIndexed())
+        writeChunk(out, encodeIndices(mesh.indices()));
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i)
+        writeChunk(out, encodeVertices(mesh.attribute(i)));
+
+    /* Convert back to a default deleter to make the data usable without
+       referencing the growable deleter function */
+    arrayShrink(out, DefaultInit);
+    return out;
+}
+
+Containers::Optional<Trade::MeshData> decodeMesh(const Containers::ArrayView<const char> data) {
+    if(data.size() < sizeof(MeshMagic) || std::memcmp(data.data(), MeshMagic, sizeof(MeshMagic)) != 0) {
+        Error{} << "MeshTools::decodeMesh(): invalid signature";
+        return {};
+    }
+
+    std::size_t position = sizeof(MeshMagic);
+    UnsignedLong version, primitive, indexType, indexCount, vertexCount, attributeCount;
+    if(!readVarint(data, position, version) ||
+       !readVarint(data, position, primitive) ||
+       !readVarint(data, position, indexType) ||
+       !readVarint(data, position, indexCount) ||
+       !readVarint(data, position, vertexCount) ||
+       !readVarint(data, position, attributeCount)) {
+        Error{} << "MeshTools::decodeMesh(): truncated header";
+        return {};
+    }
+    if(version != MeshVersion) {
+        Error{} << "MeshTools::decodeMesh(): unsupported version" << version;
+        return {};
+    }
+    if(!primitive || primitive > 0xffffffffull) {
+        Error{} << "MeshTools::decodeMesh(): invalid primitive" << Debug::hex << primitive;
+        return {};
+    }
+    if(indexType > UnsignedInt(MeshIndexType::UnsignedInt) || (!indexType && indexCount)) {
+        Error{} << "MeshTools::decodeMesh(): invalid index type" << indexType;
+        return {};
+    }
+    if(indexCount > 0xffffffffull || vertexCount > 0xffffffffull) {
+        Error{} << "MeshTools::decodeMesh(): expected index and vertex count to fit into 32 bits but got" << indexCount << "and" << vertexCount;
+        return {};
+    }
+    /* Each attribute takes at least four bytes of the header, check the count
+       before allocating anything based on it */
+    if(attributeCount > (data.size() - position)/4) {
+        Error{} << "MeshTools::decodeMesh(): invalid attribute count" << attributeCount;
+        return {};
+    }
+
+    /* Parse the attribute metadata and calculate the interleaved layout */
+    struct Attribute {
+        Trade::MeshAttribute name;
+        VertexFormat format;
+        UnsignedShort arraySize;
+        Int morphTargetId;
+        std::size_t offset;
+        std::size_t size;
+    };
+    Containers::Array<Attribute> attributes{NoInit, std::size_t(attributeCount)};
+    std::size_t stride = 0;
+    for(std::size_t i = 0; i != attributes.size(); ++i) {
+        UnsignedLong name, format, arraySize, morphTargetId;
+        if(!readVarint(data, position, name) ||
+           !readVarint(data, position, format) ||
+           !readVarint(data, position, arraySize) ||
+           !readVarint(data, position, morphTargetId)) {
+            Error{} << "MeshTools::decodeMesh(): truncated header";
+            return {};
+        }
+
+        if(!name || name > 0xffff || (name > UnsignedShort(Trade::MeshAttribute::ObjectId) && !Trade::isMeshAttributeCustom(Trade::MeshAttribute(name)))) {
+            Error{} << "MeshTools::decodeMesh(): invalid attribute" << i << "name" << Debug::hex << name;
+            return {};
+        }
+        if(!format || format > UnsignedInt(VertexFormat::Vector4ui1010102Normalized)) {
+            Error{} << "MeshTools::decodeMesh(): invalid attribute" << i << "format" << Debug::hex << format;
+            return {};
+        }
+
+        const Trade::MeshAttribute attributeName = Trade::MeshAttribute(name);
+        const VertexFormat attributeFormat = VertexFormat(format);
+        if(!Trade::Implementation::isVertexFormatCompatibleWithAttribute(attributeName, attributeFormat)) {
+            Error{} << "MeshTools::decodeMesh():" << attributeFormat << "is not a valid format for" << attributeName;
+            return {};
+        }
+        if(arraySize > 0xffff ||
+           (arraySize && !Trade::Implementation::isAttributeArrayAllowed(attributeName)) ||
+           (!arraySize && Trade::Implementation::isAttributeArrayExpected(attributeName))) {
+            Error{} << "MeshTools::decodeMesh(): invalid array size" << arraySize << "for" << attributeName;
+            return {};
+        }
+        if(morphTargetId > 128 || (morphTargetId && !Trade::Implementation::isMorphTargetAllowed(attributeName))) {
+            Error{} << "MeshTools::decodeMesh(): invalid morph target ID" << Long(morphTargetId) - 1 << "for" << attributeName;
+            return {};
+        }
+
+        attributes[i].name = attributeName;
+        attributes[i].format = attributeFormat;
+        attributes[i].arraySize = UnsignedShort(arraySize);
+        attributes[i].morphTargetId = Int(morphTargetId) - 1;
+        attributes[i].offset = stride;
+        attributes[i].size = vertexFormatSize(attributeFormat)*(arraySize ? arraySize : 1);
+        /* Pad to four bytes to satisfy alignment requirements of GPU APIs */
+        stride += (attributes[i].size + 3) & ~std::size_t{3};
+    }
+
+    if(stride > 32767) {
+        Error{} << "MeshTools::decodeMesh(): expected vertex stride to fit into 16 bits but got" << stride;
+        return {};
+    }
+
+    /* Decode the index buffer */
+    Containers::Array<char> indexData;
+    if(indexType) {
+        Containers::ArrayView<const char> chunk;
+        if(!readChunk(data, position, chunk)) {
+            Error{} << "MeshTools::decodeMesh(): truncated index data";
+            return {};
+        }
+
+        const MeshIndexType type = MeshIndexType(indexType);
+        indexData = Containers::Array<char>{NoInit, std::size_t(indexCount)*meshIndexTypeSize(type)};
+        bool decoded;
+        if(type == MeshIndexType::UnsignedInt)
+            decoded = decodeIndicesInto(chunk, Containers::arrayCast<UnsignedInt>(indexData));
+        else if(type == MeshIndexType::UnsignedShort)
+            decoded = decodeIndicesInto(chunk, Containers::arrayCast<UnsignedShort>(indexData));
+        else
+            decoded = decodeIndicesInto(chunk, Containers::arrayCast<UnsignedByte>(indexData));
+        if(!decoded) return {};
+    }
+
+    /* Decode all attributes. Value-initialized to have the padding zeroed
+       out. */
+    Containers::Array<char> vertexData{ValueInit, std::size_t(vertexCount)*stride};
+    Containers::Array<Trade::MeshAttributeData> attributeData{std::size_t(attributeCount)};
+    for(std::size_t i = 0; i != attributes.size(); ++i) {
+        const Attribute& attribute = attributes[i];
+        Containers::ArrayView<const char> chunk;
+        if(!readChunk(data, position, chunk)) {
+            Error{} << "MeshTools::decodeMesh(): truncated data for attribute" << i;
+            return {};
+        }
+
+        /* Not creating the view for an empty vertex data as that would mean
+           offsetting a null pointer */
+        if(vertexCount) {
+            const Containers::StridedArrayView2D<char> out{vertexData,
+                vertexData.data() + attribute.offset,
+                {std::size_t(vertexCount), attribute.size},
+                {std::ptrdiff_t(stride), 1}};
+            if(!decodeVerticesInto(chunk, out)) return {};
+        } else if(!chunk.isEmpty()) {
+            Error{} << "MeshTools::decodeMesh(): expected no data for attribute" << i << "of an empty mesh but got" << chunk.size() << "bytes";
+            return {};
+        }
+
+        attributeData[i] = Trade::MeshAttributeData{attribute.name,
+            attribute.format, attribute.offset, UnsignedInt(vertexCount),
+            std::ptrdiff_t(stride), attribute.arraySize,
+            attribute.morphTargetId};
+    }
+
+    if(position != data.size()) {
+        Error{} << "MeshTools::decodeMesh(): expected" << position << "bytes but got" << data.size();
+        return {};
+    }
+
+    if(!indexType)
+        return Trade::MeshData{MeshPrimitive(primitive),
+            Utility::move(vertexData), Utility::move(attributeData),
+            UnsignedInt(vertexCount)};
+
+    const Trade::MeshIndexData indices{MeshIndexType(indexType), indexData};
+    return Trade::MeshData{MeshPrimitive(primitive),
+        Utility::move(indexData), indices,
+        Utility::move(vertexData), Utility::move(attributeData),
+        UnsignedInt(vertexCount)};
+}
+
+}}
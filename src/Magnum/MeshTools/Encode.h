@@ -0,0 +1,177 @@
+#ifndef Magnum_MeshTools_Encode_h
+#define Magnum_MeshTools_Encode_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::encodeIndices(), @ref Magnum::MeshTools::decodeIndicesInto(), @ref Magnum::MeshTools::encodeVertices(), @ref Magnum::MeshTools::decodeVerticesInto(), @ref Magnum::MeshTools::encodeMesh(), @ref Magnum::MeshTools::decodeMesh()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Encode an index array
+@m_since_latest
+
+Stores each index as a difference to the previous index, with the first index
+being relative to zero. The differences are zigzag-encoded and written as
+little-endian base-128 variable-length integers, so values within
+@f$ [-64, 63] @f$ of the previous index take a single byte and at most five
+bytes are used for any 32-bit index. This works best on index buffers
+optimized for vertex locality such as with @ref tipsify(), where most
+differences are small. As the encoded bytes are highly repetitive, the output
+is also well suited for further compression with a general-purpose compressor.
+
+Use @ref decodeIndicesInto() to decode the data back.
+@see @ref compressIndices(), @ref encodeMesh()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeIndices(const Containers::StridedArrayView1D<const UnsignedShort>& indices);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeIndices(const Containers::StridedArrayView1D<const UnsignedByte>& indices);
+
+/**
+@brief Encode a type-erased index array
+@m_since_latest
+
+Expects that the second dimension of @p indices is contiguous and represents
+the actual 1/2/4-byte index type. Based on its size then calls one of the
+@ref encodeIndices(const Containers::StridedArrayView1D<const UnsignedInt>&)
+etc. overloads.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeIndices(const Containers::StridedArrayView2D<const char>& indices);
+
+/**
+@brief Decode an index array
+@m_since_latest
+
+Decodes @p data produced by @ref encodeIndices() into @p out, which is
+expected to have the same size as the originally encoded index array. If the
+data are truncated, contain extra bytes after the last index or an index
+doesn't fit into the output type, prints a message to @relativeref{Magnum,Error}
+and returns @cpp false @ce, in which case contents of @p out are unspecified.
+*/
+MAGNUM_MESHTOOLS_EXPORT bool decodeIndicesInto(Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedInt>& out);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT bool decodeIndicesInto(Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedShort>& out);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT bool decodeIndicesInto(Containers::ArrayView<const char> data, const Containers::StridedArrayView1D<UnsignedByte>& out);
+
+/**
+@brief Encode a vertex array
+@m_since_latest
+
+The first dimension of @p data is vertices, the second dimension bytes of each
+vertex. Each byte is stored as a difference to the same byte of the previous
+vertex, with the differences transposed so all first bytes of every vertex are
+next to each other, followed by all second bytes and so on. Runs of zero
+differences, which are common for example for upper bytes of slowly changing
+values or for constant attributes, are stored as a single zero byte followed
+by a base-128 variable-length run length. The resulting data thus often end up
+being smaller than the input, and the grouping makes them considerably better
+compressible by a general-purpose compressor as well.
+
+Encoding each attribute of a mesh separately yields better results than
+encoding an interleaved vertex buffer, as the byte differences are then not
+mixed across unrelated attributes. Use @ref decodeVerticesInto() to decode
+the data back.
+@see @ref encodeMesh(), @ref quantize()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeVertices(const Containers::StridedArrayView2D<const char>& data);
+
+/**
+@brief Decode a vertex array
+@m_since_latest
+
+Decodes @p data produced by @ref encodeVertices() into @p out, which is
+expected to have the same size as the originally encoded vertex array. If the
+data are truncated or contain extra bytes at the end, prints a message to
+@relativeref{Magnum,Error} and returns @cpp false @ce, in which case contents
+of @p out are unspecified.
+*/
+MAGNUM_MESHTOOLS_EXPORT bool decodeVerticesInto(Containers::ArrayView<const char> data, const Containers::StridedArrayView2D<char>& out);
+
+/**
+@brief Encode a mesh
+@m_since_latest
+
+Serializes the mesh primitive, index type, attribute layout and metadata into
+a compact header and then stores the index buffer encoded with
+@ref encodeIndices() and each attribute encoded separately with
+@ref encodeVertices(). All header values are stored as variable-length
+integers, making the output independent of platform endianness. In
+combination with @ref quantize() and @ref tipsify() this is meant for
+streaming meshes over the network or storing them on disk with the smallest
+possible size and a fast decoder, see @ref decodeMesh().
+
+Expects that the mesh doesn't have an implementation-specific index type and
+no attributes with implementation-specific formats. The original vertex
+layout isn't preserved, the decoded mesh is always interleaved, with each
+attribute padded to a multiple of four bytes.
+@see @ref isMeshIndexTypeImplementationSpecific(),
+    @ref isVertexFormatImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<char> encodeMesh(const Trade::MeshData& mesh);
+
+/**
+@brief Decode a mesh
+@m_since_latest
+
+Decodes @p data produced by @ref encodeMesh(). The returned mesh is always
+interleaved, with each attribute padded to a multiple of four bytes, and has
+the indices in their original type. If the
+data are not a valid encoded mesh, prints a message to
+@relativeref{Magnum,Error} and returns @relativeref{Corrade,Containers::NullOpt}.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Optional<Trade::MeshData> decodeMesh(Containers::ArrayView<const char> data);
+
+}}
+
+#endif
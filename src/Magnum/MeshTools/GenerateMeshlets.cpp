@@ -0,0 +1,254 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2022 Pablo Escobar <mail@rvrs.in>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateMeshlets.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/BoundingVolume.h"
+#include "Magnum/MeshTools/GenerateIndices.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+MeshletData::MeshletData(Containers::Array<Meshlet>&& meshlets, Containers::Array<UnsignedInt>&& vertices, Containers::Array<Vector3ub>&& triangles) noexcept: _meshlets{Utility::move(meshlets)}, _vertices{Utility::move(vertices)}, _triangles{Utility::move(triangles)} {}
+
+MeshletData::MeshletData(MeshletData&&) noexcept = default;
+
+MeshletData::~MeshletData() = default;
+
+MeshletData& MeshletData::operator=(MeshletData&&) noexcept = default;
+
+Containers::ArrayView<const UnsignedInt> MeshletData::vertices(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _meshlets.size(),
+        "MeshTools::MeshletData::vertices(): index" << id << "out of range for" << _meshlets.size() << "meshlets", {});
+    return _vertices.sliceSize(_meshlets[id].vertexOffset, _meshlets[id].vertexCount);
+}
+
+Containers::ArrayView<const Vector3ub> MeshletData::triangles(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _meshlets.size(),
+        "MeshTools::MeshletData::triangles(): index" << id << "out of range for" << _meshlets.size() << "meshlets", {});
+    return _triangles.sliceSize(_meshlets[id].triangleOffset, _meshlets[id].triangleCount);
+}
+
+Containers::Array<Meshlet> MeshletData::releaseMeshlets() {
+    return Utility::move(_meshlets);
+}
+
+Containers::Array<UnsignedInt> MeshletData::releaseVertices() {
+    return Utility::move(_vertices);
+}
+
+Containers::Array<Vector3ub> MeshletData::releaseTriangles() {
+    return Utility::move(_triangles);
+}
+
+namespace {
+
+/* Marks a vertex that's not in the current meshlet. Local indices are at most
+   255, so anything larger works. */
+constexpr UnsignedShort NotInMeshlet = 0xffff;
+
+void finishMeshlet(Meshlet& meshlet, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::ArrayView<const UnsignedInt> vertices, const Containers::ArrayView<const Vector3ub> triangles, const Containers::ArrayView<Vector3> positionScratch, const Containers::ArrayView<Vector3> normalScratch) {
+    /* Bounding sphere of the meshlet vertices */
+    for(std::size_t i = 0; i != vertices.size(); ++i)
+        positionScratch[i] = positions[vertices[i]];
+    const Containers::Pair<Vector3, Float> sphere = boundingSphereBouncingBubble(positionScratch.prefix(vertices.size()));
+    meshlet.center = sphere.first();
+    meshlet.radius = sphere.second();
+
+    /* Normalized triangle normals and their average. Degenerate triangles
+       get a zero normal and are skipped in the calculations below as they
+       don't contribute to the visible surface. */
+    Vector3 axis;
+    for(std::size_t i = 0; i != triangles.size(); ++i) {
+        const Vector3 a = positionScratch[triangles[i][0]];
+        const Vector3 normal = Math::cross(positionScratch[triangles[i][1]] - a, positionScratch[triangles[i][2]] - a);
+        const Float length = normal.length();
+        normalScratch[i] = length == 0.0f ? Vector3{} : normal/length;
+        axis += normalScratch[i];
+    }
+
+    const Float axisLength = axis.length();
+    if(axisLength == 0.0f) {
+        meshlet.coneApex = meshlet.center;
+        meshlet.coneAxis = {};
+        meshlet.coneCutoff = 1.0f;
+        return;
+    }
+    axis /= axisLength;
+    meshlet.coneAxis = axis;
+
+    /* Cosine of the largest angle between the axis and the normals. If the
+       cone is wider than ~84 degrees, it's not useful for culling anymore, and
+       the apex calculation below would be numerically unstable. */
+    Float minDot = 1.0f;
+    for(std::size_t i = 0; i != triangles.size(); ++i)
+        if(!normalScratch[i].isZero())
+            minDot = Math::min(minDot, Math::dot(axis, normalScratch[i]));
+    if(minDot <= 0.1f) {
+        meshlet.coneApex = meshlet.center;
+        meshlet.coneCutoff = 1.0f;
+        return;
+    }
+    meshlet.coneCutoff = Math::sqrt(1.0f - minDot*minDot);
+
+    /* Move the apex back along the axis so that all triangle planes are in
+       front of it, which makes the cone test conservative for a perspective
+       projection */
+    Float maxT = 0.0f;
+    for(std::size_t i = 0; i != triangles.size(); ++i) {
+        const Vector3& normal = normalScratch[i];
+        if(normal.isZero()) continue;
+
+        const Vector3 a = positionScratch[triangles[i][0]];
+        maxT = Math::max(maxT, Math::dot(meshlet.center - a, normal)/Math::dot(axis, normal));
+    }
+    meshlet.coneApex = meshlet.center - axis*maxT;
+}
+
+}
+
+MeshletData generateMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt maxVertices, const UnsignedInt maxTriangles) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::generateMeshlets(): index count not divisible by 3, got" << indices.size(),
+        (MeshletData{{}, {}, {}}));
+    CORRADE_ASSERT(maxVertices >= 3 && maxVertices <= 256,
+        "MeshTools::generateMeshlets(): expected max vertex count to be between 3 and 256, got" << maxVertices,
+        (MeshletData{{}, {}, {}}));
+    CORRADE_ASSERT(maxTriangles,
+        "MeshTools::generateMeshlets(): expected max triangle count to be at least 1", (MeshletData{{}, {}, {}}));
+
+    const std::size_t triangleCount = indices.size()/3;
+
+    /* The triangle array has the final size right from the start, the vertex
+       and meshlet arrays are growable. */
+    Containers::Array<Meshlet> meshlets;
+    Containers::Array<UnsignedInt> vertices;
+    Containers::Array<Vector3ub> triangles{NoInit, triangleCount};
+    arrayReserve(vertices, triangleCount);
+
+    /* Local index of each vertex in the current meshlet and scratch memory
+       for bounds calculation */
+    Containers::Array<UnsignedShort> localIndices{DirectInit, positions.size(), NotInMeshlet};
+    Containers::Array<Vector3> positionScratch{NoInit, maxVertices};
+    Containers::Array<Vector3> normalScratch{NoInit, maxTriangles};
+
+    Meshlet current{};
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        const UnsignedInt triangle[3]{indices[i*3 + 0], indices[i*3 + 1], indices[i*3 + 2]};
+
+        /* Count vertices that aren't in the meshlet yet, taking care of
+           degenerate triangles that reference the same vertex twice */
+        UnsignedInt newVertexCount = 0;
+        for(std::size_t j = 0; j != 3; ++j) {
+            CORRADE_ASSERT(triangle[j] < positions.size(),
+                "MeshTools::generateMeshlets(): index" << triangle[j] << "out of range for" << positions.size() << "vertices",
+                (MeshletData{{}, {}, {}}));
+            if(localIndices[triangle[j]] == NotInMeshlet &&
+               (j < 1 || triangle[j] != triangle[0]) &&
+               (j < 2 || triangle[j] != triangle[1]))
+                ++newVertexCount;
+        }
+
+        /* If the triangle doesn't fit, finish the current meshlet and start a
+           new one */
+        if(current.vertexCount + newVertexCount > maxVertices ||
+           current.triangleCount == maxTriangles) {
+            const Containers::ArrayView<const UnsignedInt> meshletVertices = vertices.sliceSize(current.vertexOffset, current.vertexCount);
+            finishMeshlet(current, positions, meshletVertices, triangles.sliceSize(current.triangleOffset, current.triangleCount), positionScratch, normalScratch);
+            arrayAppend(meshlets, current);
+            for(const UnsignedInt vertex: meshletVertices)
+                localIndices[vertex] = NotInMeshlet;
+
+            current = Meshlet{};
+            current.vertexOffset = vertices.size();
+            current.triangleOffset = i;
+        }
+
+        /* Add the triangle, and its vertices if not already there */
+        Vector3ub& local = triangles[i];
+        for(std::size_t j = 0; j != 3; ++j) {
+            UnsignedShort& localIndex = localIndices[triangle[j]];
+            if(localIndex == NotInMeshlet) {
+                localIndex = current.vertexCount++;
+                arrayAppend(vertices, triangle[j]);
+            }
+            local[j] = localIndex;
+        }
+        ++current.triangleCount;
+    }
+
+    /* Finish the last meshlet, if there's any */
+    if(current.triangleCount) {
+        finishMeshlet(current, positions, vertices.sliceSize(current.vertexOffset, current.vertexCount), triangles.sliceSize(current.triangleOffset, current.triangleCount), positionScratch, normalScratch);
+        arrayAppend(meshlets, current);
+    }
+
+    /* Convert the growable arrays back to default deleters so the result is
+       safe to pass across library boundaries */
+    arrayShrink(meshlets, DefaultInit);
+    arrayShrink(vertices, DefaultInit);
+
+    return MeshletData{Utility::move(meshlets), Utility::move(vertices), Utility::move(triangles)};
+}
+
+MeshletData generateMeshlets(const Trade::MeshData& mesh, const UnsignedInt maxVertices, const UnsignedInt maxTriangles) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles ||
+                   mesh.primitive() == MeshPrimitive::TriangleStrip ||
+                   mesh.primitive() == MeshPrimitive::TriangleFan,
+        "MeshTools::generateMeshlets(): expected a triangle primitive, got" << mesh.primitive(),
+        (MeshletData{{}, {}, {}}));
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        "MeshTools::generateMeshlets(): the mesh has no positions",
+        (MeshletData{{}, {}, {}}));
+
+    Containers::Array<UnsignedInt> indices;
+    if(mesh.primitive() == MeshPrimitive::Triangles) {
+        if(mesh.isIndexed())
+            indices = mesh.indicesAsArray();
+        else
+            indices = generateTrivialIndices(mesh.vertexCount());
+    } else if(mesh.primitive() == MeshPrimitive::TriangleStrip) {
+        if(mesh.isIndexed())
+            indices = generateTriangleStripIndices(mesh.indices());
+        else
+            indices = generateTriangleStripIndices(mesh.vertexCount());
+    } else if(mesh.primitive() == MeshPrimitive::TriangleFan) {
+        if(mesh.isIndexed())
+            indices = generateTriangleFanIndices(mesh.indices());
+        else
+            indices = generateTriangleFanIndices(mesh.vertexCount());
+    } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+    return generateMeshlets(indices, mesh.positions3DAsArray(), maxVertices, maxTriangles);
+}
+
+}}
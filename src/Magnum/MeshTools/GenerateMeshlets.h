@@ -0,0 +1,263 @@
+#ifndef Magnum_MeshTools_GenerateMeshlets_h
+#define Magnum_MeshTools_GenerateMeshlets_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2022 Pablo Escobar <mail@rvrs.in>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::Meshlet, class @ref Magnum::MeshTools::MeshletData, function @ref Magnum::MeshTools::generateMeshlets()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Meshlet
+@m_since_latest
+
+A single meshlet produced by @ref generateMeshlets(). Vertices of the meshlet
+are @ref vertexCount items starting at @ref vertexOffset in
+@ref MeshletData::vertices(), each being an index into the original mesh
+vertices. Triangles of the meshlet are @ref triangleCount items starting at
+@ref triangleOffset in @ref MeshletData::triangles(), each being a triplet of
+indices into the meshlet vertices.
+
+The structure is 60 bytes large with all members tightly packed in the order
+listed here, suitable for copying directly into a GPU buffer with a matching
+layout.
+
+@section MeshTools-Meshlet-culling Culling
+
+A meshlet is outside of a view frustum if the sphere defined by @ref center
+and @ref radius is, which can be tested for example with
+@ref Math::Intersection::sphereFrustum(). It's also entirely back-facing when
+viewed from a camera position @f$ \boldsymbol{c} @f$ if the following holds
+for the normal cone defined by @ref coneApex, @ref coneAxis and
+@ref coneCutoff. If the triangles in the meshlet face too many directions for
+the cone to be useful, the cutoff is @cpp 1.0f @ce, and the test never passes
+except for the camera being exactly on the cone axis: @f[
+    \frac{\boldsymbol{a} - \boldsymbol{c}}{|\boldsymbol{a} - \boldsymbol{c}|} \cdot \boldsymbol{n} \geq t
+@f]
+*/
+struct Meshlet {
+    /** @brief Offset of the first vertex in @ref MeshletData::vertices() */
+    UnsignedInt vertexOffset;
+
+    /** @brief Vertex count */
+    UnsignedInt vertexCount;
+
+    /**
+     * @brief Offset of the first triangle in @ref MeshletData::triangles()
+     */
+    UnsignedInt triangleOffset;
+
+    /** @brief Triangle count */
+    UnsignedInt triangleCount;
+
+    /** @brief Bounding sphere center */
+    Vector3 center;
+
+    /** @brief Bounding sphere radius */
+    Float radius;
+
+    /**
+     * @brief Normal cone apex
+     *
+     * The @f$ \boldsymbol{a} @f$ in the equation in
+     * @ref MeshTools-Meshlet-culling.
+     */
+    Vector3 coneApex;
+
+    /**
+     * @brief Normal cone axis
+     *
+     * Normalized average direction of the triangle normals, or a zero vector
+     * if the meshlet has no non-degenerate triangles. The
+     * @f$ \boldsymbol{n} @f$ in the equation in
+     * @ref MeshTools-Meshlet-culling.
+     */
+    Vector3 coneAxis;
+
+    /**
+     * @brief Normal cone cutoff
+     *
+     * Sine of the largest angle between @ref coneAxis and a triangle normal,
+     * or @cpp 1.0f @ce if the cone isn't usable for culling. The
+     * @f$ t @f$ in the equation in @ref MeshTools-Meshlet-culling.
+     */
+    Float coneCutoff;
+};
+
+/**
+@brief Meshlet data
+@m_since_latest
+
+Returned from @ref generateMeshlets(). Contains the meshlets themselves, the
+vertex indices they reference and the per-meshlet triangle indices, each as a
+contiguous array suitable for uploading to a GPU buffer as-is.
+*/
+class MAGNUM_MESHTOOLS_EXPORT MeshletData {
+    public:
+        /**
+         * @brief Constructor
+         * @param meshlets      Meshlets
+         * @param vertices      Meshlet vertices, indexing the original mesh
+         * @param triangles     Meshlet triangles, indexing @p vertices
+         *      relative to @ref Meshlet::vertexOffset
+         */
+        explicit MeshletData(Containers::Array<Meshlet>&& meshlets, Containers::Array<UnsignedInt>&& vertices, Containers::Array<Vector3ub>&& triangles) noexcept;
+
+        /** @brief Copying is not allowed */
+        MeshletData(const MeshletData&) = delete;
+
+        /** @brief Move constructor */
+        MeshletData(MeshletData&&) noexcept;
+
+        ~MeshletData();
+
+        /** @brief Copying is not allowed */
+        MeshletData& operator=(const MeshletData&) = delete;
+
+        /** @brief Move assignment */
+        MeshletData& operator=(MeshletData&&) noexcept;
+
+        /** @brief Meshlets */
+        Containers::ArrayView<const Meshlet> meshlets() const { return _meshlets; }
+
+        /**
+         * @brief Meshlet vertices
+         *
+         * Indices into vertices of the original mesh, referenced by
+         * @ref Meshlet::vertexOffset and @ref Meshlet::vertexCount.
+         */
+        Containers::ArrayView<const UnsignedInt> vertices() const { return _vertices; }
+
+        /**
+         * @brief Vertices of given meshlet
+         *
+         * Expects that @p id is less than size of @ref meshlets().
+         */
+        Containers::ArrayView<const UnsignedInt> vertices(UnsignedInt id) const;
+
+        /**
+         * @brief Meshlet triangles
+         *
+         * Triplets of indices into @ref vertices(), relative to
+         * @ref Meshlet::vertexOffset of the meshlet the triangle belongs to.
+         * Referenced by @ref Meshlet::triangleOffset and
+         * @ref Meshlet::triangleCount.
+         */
+        Containers::ArrayView<const Vector3ub> triangles() const { return _triangles; }
+
+        /**
+         * @brief Triangles of given meshlet
+         *
+         * Expects that @p id is less than size of @ref meshlets().
+         */
+        Containers::ArrayView<const Vector3ub> triangles(UnsignedInt id) const;
+
+        /**
+         * @brief Release meshlets
+         *
+         * The @ref meshlets() list is empty after calling this function.
+         */
+        Containers::Array<Meshlet> releaseMeshlets();
+
+        /**
+         * @brief Release meshlet vertices
+         *
+         * The @ref vertices() list is empty after calling this function.
+         */
+        Containers::Array<UnsignedInt> releaseVertices();
+
+        /**
+         * @brief Release meshlet triangles
+         *
+         * The @ref triangles() list is empty after calling this function.
+         */
+        Containers::Array<Vector3ub> releaseTriangles();
+
+    private:
+        Containers::Array<Meshlet> _meshlets;
+        Containers::Array<UnsignedInt> _vertices;
+        Containers::Array<Vector3ub> _triangles;
+};
+
+/**
+@brief Split an indexed triangle mesh into meshlets
+@param indices          Triangle indices
+@param positions        Vertex positions
+@param maxVertices      Max vertex count in a meshlet
+@param maxTriangles     Max triangle count in a meshlet
+@m_since_latest
+
+Goes through the triangles in order and adds them to the current meshlet until
+either @p maxVertices or @p maxTriangles would be exceeded, after which a new
+meshlet is started. The order of triangles is preserved, so for best results
+the index buffer should be optimized for vertex locality first, for example
+with @ref tipsifyInPlace(). The defaults of 64 vertices and 124 triangles are
+a good fit for mesh shaders on most current hardware.
+
+For each meshlet, the bounding sphere is calculated using
+@ref boundingSphereBouncingBubble() and the normal cone from normalized
+normals of its triangles, with degenerate triangles ignored. See
+@ref MeshTools-Meshlet-culling for how to use the result.
+
+Expects that @p indices size is divisible by @cpp 3 @ce, all indices are in
+bounds for @p positions, @p maxVertices is at least @cpp 3 @ce and at most
+@cpp 256 @ce and @p maxTriangles is at least @cpp 1 @ce.
+*/
+MAGNUM_MESHTOOLS_EXPORT MeshletData generateMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxVertices = 64, UnsignedInt maxTriangles = 124);
+
+/**
+@brief Split a triangle mesh into meshlets
+@m_since_latest
+
+Takes indices of @p mesh via @ref Trade::MeshData::indicesAsArray(), or
+creates them with @ref generateTriangleStripIndices(),
+@ref generateTriangleFanIndices() or @ref generateTrivialIndices() for
+@ref MeshPrimitive::TriangleStrip, @ref MeshPrimitive::TriangleFan and
+non-indexed meshes, respectively. Positions are taken via
+@ref Trade::MeshData::positions3DAsArray(). The result is then passed to
+@ref generateMeshlets(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt, UnsignedInt).
+
+Expects that the mesh is a @ref MeshPrimitive::Triangles,
+@relativeref{MeshPrimitive,TriangleStrip} or
+@relativeref{MeshPrimitive,TriangleFan} and has a
+@ref Trade::MeshAttribute::Position attribute.
+*/
+MAGNUM_MESHTOOLS_EXPORT MeshletData generateMeshlets(const Trade::MeshData& mesh, UnsignedInt maxVertices = 64, UnsignedInt maxTriangles = 124);
+
+}}
+
+#endif
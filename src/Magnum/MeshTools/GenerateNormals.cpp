@@ -32,6 +32,7 @@
 
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Parallel.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 #include <vector>
@@ -100,63 +101,31 @@ namespace {
 using namespace Math::Literals;
 #endif
 
-template<class T> inline void generateSmoothNormalsIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    CORRADE_ASSERT(indices.size() % 3 == 0,
-        "MeshTools::generateSmoothNormalsInto(): index count not divisible by 3", );
-    CORRADE_ASSERT(normals.size() == positions.size(),
-        "MeshTools::generateSmoothNormalsInto(): bad output size, expected" << positions.size() << "but got" << normals.size(), );
-
-    if(indices.isEmpty()) return;
-
-    /* Gather count of triangles for every vertex. This abuses the output
-       storage to avoid extra allocations, zero-initialize it first to avoid
-       random memory getting used. */
-    Containers::StridedArrayView1D<UnsignedInt> triangleCount =
-        Containers::arrayCast<UnsignedInt>(normals);
-    for(UnsignedInt& i: triangleCount) i = 0;
-    for(const T index: indices) {
-        CORRADE_ASSERT(index < positions.size(), "MeshTools::generateSmoothNormalsInto(): index" << index << "out of range for" << positions.size() << "elements", );
-        ++triangleCount[index];
-    }
-
-    /* Turn that into a running offset array:
-       triangleOffset[i + 1] - triangleOffset[i] is triangle count for vertex i
-       triangleOffset[i] is offset into an triangle ID array for vertex i */
-    Containers::Array<UnsignedInt> triangleOffset{NoInit, positions.size() + 1};
-    triangleOffset[0] = 0;
-    for(std::size_t i = 0; i != triangleCount.size(); ++i)
-        triangleOffset[i + 1] = triangleOffset[i] + triangleCount[i];
-
-    CORRADE_INTERNAL_ASSERT(triangleOffset.back() == indices.size());
-
-    /* Gather triangle IDs for every vertex. For vertex i,
-       triangleIds[triangleOffset[i]] until triangleIds[triangleOffset[i + 1]]
-       contains IDs of triangles that contain it. */
-    Containers::Array<T> triangleIds{NoInit, indices.size()};
-    for(std::size_t i = 0; i != indices.size(); ++i) {
-        const T triangleId = i/3;
-        const T vertexId = indices[i];
-
-        /* How many triangle IDs is still left to be written, which also means
-           the offset where we put the ID. Decrement that for the next run. */
-        const std::size_t triangleIdsLeftForVertex = triangleCount[vertexId]--;
-        triangleIds[triangleOffset[vertexId + 1] - triangleIdsLeftForVertex] = triangleId;
-    }
-
-    /* Now, triangleCount should be all zeros, we don't need it anymore and the
-       underlying `normals` array is ready to get filled with real output. */
-
-    /* Precalculate cross product and interior angles of each face --- the loop
-       below would otherwise calculate it for every vertex, which is at least
-       3x as much work */
-    Containers::Array<Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles{NoInit, indices.size()/3};
-    for(std::size_t i = 0; i != crossAngles.size(); ++i) {
-        const Vector3 v0 = positions[indices[i*3 + 0]];
-        const Vector3 v1 = positions[indices[i*3 + 1]];
-        const Vector3 v2 = positions[indices[i*3 + 2]];
+/* Size of a chunk of triangles or vertices processed by a single
+   ParallelFor task */
+constexpr std::size_t SmoothNormalsChunkSize = 16384;
+
+template<class T> struct SmoothNormalsState {
+    Containers::StridedArrayView1D<const T> indices;
+    Containers::StridedArrayView1D<const Vector3> positions;
+    Containers::StridedArrayView1D<Vector3> normals;
+    Containers::ArrayView<const UnsignedInt> triangleOffset;
+    Containers::ArrayView<const T> triangleIds;
+    Containers::ArrayView<Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles;
+};
+
+/* Calculates cross product and interior angles for a chunk of triangles */
+template<class T> void smoothNormalsCrossAngles(void* const state, const std::size_t chunk) {
+    const SmoothNormalsState<T>& s = *static_cast<const SmoothNormalsState<T>*>(state);
+    const std::size_t begin = chunk*SmoothNormalsChunkSize;
+    const std::size_t end = Math::min(begin + SmoothNormalsChunkSize, s.crossAngles.size());
+    for(std::size_t i = begin; i != end; ++i) {
+        const Vector3 v0 = s.positions[s.indices[i*3 + 0]];
+        const Vector3 v1 = s.positions[s.indices[i*3 + 1]];
+        const Vector3 v2 = s.positions[s.indices[i*3 + 2]];
 
         /* Cross product */
-        crossAngles[i].first() = Math::cross(v2 - v1, v0 - v1);
+        s.crossAngles[i].first() = Math::cross(v2 - v1, v0 - v1);
 
         /* If any of the vectors is zero, the normalization would result in a
            NaN and the angle calculation will assert. This happens also when
@@ -170,7 +139,7 @@ template<class T> inline void generateSmoothNormalsIntoImplementation(const Cont
         const Vector3 v20n = (v2 - v0).normalized();
         const Vector3 v21n = (v2 - v1).normalized();
         if(Math::isNan(v10n) || Math::isNan(v20n) || Math::isNan(v21n)) {
-            crossAngles[i].second() = Math::Vector3<Rad>{Math::ZeroInit};
+            s.crossAngles[i].second() = Math::Vector3<Rad>{Math::ZeroInit};
             continue;
         }
 
@@ -179,28 +148,34 @@ template<class T> inline void generateSmoothNormalsIntoImplementation(const Cont
         /* This using namespace doesn't work with MSVC2019 with /permissive-
            (it gets lost when instantiating?!), so it's duplicated above */
         using namespace Math::Literals;
-        crossAngles[i].second()[0] = Math::angle(v10n, v20n);
-        crossAngles[i].second()[1] = Math::angle(-v10n, v21n);
-        crossAngles[i].second()[2] = Rad(180.0_degf)
-            - crossAngles[i].second()[0] - crossAngles[i].second()[1];
+        s.crossAngles[i].second()[0] = Math::angle(v10n, v20n);
+        s.crossAngles[i].second()[1] = Math::angle(-v10n, v21n);
+        s.crossAngles[i].second()[2] = Rad(180.0_degf)
+            - s.crossAngles[i].second()[0] - s.crossAngles[i].second()[1];
     }
+}
 
-    /* For every vertex v, calculate normals from all faces it belongs to and
-       average them */
-    for(std::size_t v = 0; v != positions.size(); ++v) {
+/* Accumulates normals for a chunk of vertices. Each vertex is written by
+   exactly one task and its triangles are always visited in the same order,
+   so the result doesn't depend on how the chunks are scheduled. */
+template<class T> void smoothNormalsAccumulate(void* const state, const std::size_t chunk) {
+    const SmoothNormalsState<T>& s = *static_cast<const SmoothNormalsState<T>*>(state);
+    const std::size_t begin = chunk*SmoothNormalsChunkSize;
+    const std::size_t end = Math::min(begin + SmoothNormalsChunkSize, s.positions.size());
+    for(std::size_t v = begin; v != end; ++v) {
         /* normals are an external memory, ensure we accumulate from zero */
-        normals[v] = Vector3{Math::ZeroInit};
+        s.normals[v] = Vector3{Math::ZeroInit};
 
         /* Go through all triangles sharing this vertex */
-        for(std::size_t t = triangleOffset[v]; t != triangleOffset[v + 1]; ++t) {
-            const std::size_t baseIndex = triangleIds[t]*3;
-            const T v0i = indices[baseIndex + 0];
-            const T v1i = indices[baseIndex + 1];
-            const T v2i = indices[baseIndex + 2];
+        for(std::size_t t = s.triangleOffset[v]; t != s.triangleOffset[v + 1]; ++t) {
+            const std::size_t baseIndex = s.triangleIds[t]*3;
+            const T v0i = s.indices[baseIndex + 0];
+            const T v1i = s.indices[baseIndex + 1];
+            const T v2i = s.indices[baseIndex + 2];
 
             /* Cross product is a vector in direction of the normal with length
                equal to size of the parallelogram */
-            const Containers::Pair<Vector3, Math::Vector3<Rad>>& crossAngle = crossAngles[triangleIds[t]];
+            const Containers::Pair<Vector3, Math::Vector3<Rad>>& crossAngle = s.crossAngles[s.triangleIds[t]];
 
             /* Angle between two sides of the triangle that share vertex `v`.
                The shared vertex can be one of the three. */
@@ -218,12 +193,70 @@ template<class T> inline void generateSmoothNormalsIntoImplementation(const Cont
                that as well. Finally we need to weight by the angle, and in
                that case only the ratio is important as well, so it doesn't
                matter if degrees or radians. */
-            normals[v] += crossAngle.first()*Float(angle);
+            s.normals[v] += crossAngle.first()*Float(angle);
         }
 
         /* Normalize the accumulated direction */
-        normals[v] = normals[v].normalized();
+        s.normals[v] = s.normals[v].normalized();
+    }
+}
+
+template<class T> inline void generateSmoothNormalsIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const ParallelFor parallelFor, void* const parallelForState) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::generateSmoothNormalsInto(): index count not divisible by 3", );
+    CORRADE_ASSERT(normals.size() == positions.size(),
+        "MeshTools::generateSmoothNormalsInto(): bad output size, expected" << positions.size() << "but got" << normals.size(), );
+
+    if(indices.isEmpty()) return;
+
+    /* Gather count of triangles for every vertex. This abuses the output
+       storage to avoid extra allocations, zero-initialize it first to avoid
+       random memory getting used. */
+    Containers::StridedArrayView1D<UnsignedInt> triangleCount =
+        Containers::arrayCast<UnsignedInt>(normals);
+    for(UnsignedInt& i: triangleCount) i = 0;
+    for(const T index: indices) {
+        CORRADE_ASSERT(index < positions.size(), "MeshTools::generateSmoothNormalsInto(): index" << index << "out of range for" << positions.size() << "elements", );
+        ++triangleCount[index];
+    }
+
+    /* Turn that into a running offset array:
+       triangleOffset[i + 1] - triangleOffset[i] is triangle count for vertex i
+       triangleOffset[i] is offset into an triangle ID array for vertex i */
+    Containers::Array<UnsignedInt> triangleOffset{NoInit, positions.size() + 1};
+    triangleOffset[0] = 0;
+    for(std::size_t i = 0; i != triangleCount.size(); ++i)
+        triangleOffset[i + 1] = triangleOffset[i] + triangleCount[i];
+
+    CORRADE_INTERNAL_ASSERT(triangleOffset.back() == indices.size());
+
+    /* Gather triangle IDs for every vertex. For vertex i,
+       triangleIds[triangleOffset[i]] until triangleIds[triangleOffset[i + 1]]
+       contains IDs of triangles that contain it. */
+    Containers::Array<T> triangleIds{NoInit, indices.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const T triangleId = i/3;
+        const T vertexId = indices[i];
+
+        /* How many triangle IDs is still left to be written, which also means
+           the offset where we put the ID. Decrement that for the next run. */
+        const std::size_t triangleIdsLeftForVertex = triangleCount[vertexId]--;
+        triangleIds[triangleOffset[vertexId + 1] - triangleIdsLeftForVertex] = triangleId;
     }
+
+    /* Now, triangleCount should be all zeros, we don't need it anymore and the
+       underlying `normals` array is ready to get filled with real output. */
+
+    /* Precalculate cross product and interior angles of each face --- the
+       accumulation would otherwise calculate it for every vertex, which is at
+       least 3x as much work */
+    Containers::Array<Containers::Pair<Vector3, Math::Vector3<Rad>>> crossAngles{NoInit, indices.size()/3};
+    SmoothNormalsState<T> state{indices, positions, normals, triangleOffset, triangleIds, crossAngles};
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, (crossAngles.size() + SmoothNormalsChunkSize - 1)/SmoothNormalsChunkSize, smoothNormalsCrossAngles<T>, &state);
+
+    /* For every vertex v, calculate normals from all faces it belongs to and
+       average them */
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, (positions.size() + SmoothNormalsChunkSize - 1)/SmoothNormalsChunkSize, smoothNormalsAccumulate<T>, &state);
 }
 
 }
@@ -232,32 +265,46 @@ template<class T> inline void generateSmoothNormalsIntoImplementation(const Cont
    figure out on its own which overload to use when indices are not already a
    strided arrray view */
 void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    generateSmoothNormalsIntoImplementation(indices, positions, normals);
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, parallelForSerial, nullptr);
 }
 void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    generateSmoothNormalsIntoImplementation(indices, positions, normals);
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, parallelForSerial, nullptr);
 }
 void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
-    generateSmoothNormalsIntoImplementation(indices, positions, normals);
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, parallelForSerial, nullptr);
 }
 
 void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals) {
+    generateSmoothNormalsInto(indices, positions, normals, parallelForSerial, nullptr);
+}
+
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const ParallelFor parallelFor, void* const parallelForState) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, parallelFor, parallelForState);
+}
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const ParallelFor parallelFor, void* const parallelForState) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, parallelFor, parallelForState);
+}
+void generateSmoothNormalsInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const ParallelFor parallelFor, void* const parallelForState) {
+    generateSmoothNormalsIntoImplementation(indices, positions, normals, parallelFor, parallelForState);
+}
+
+void generateSmoothNormalsInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const ParallelFor parallelFor, void* const parallelForState) {
     CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateSmoothNormalsInto(): second index view dimension is not contiguous", );
     if(indices.size()[1] == 4)
-        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, normals);
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), positions, normals, parallelFor, parallelForState);
     else if(indices.size()[1] == 2)
-        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, normals);
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), positions, normals, parallelFor, parallelForState);
     else {
         CORRADE_ASSERT(indices.size()[1] == 1, "MeshTools::generateSmoothNormalsInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
-        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, normals);
+        return generateSmoothNormalsIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), positions, normals, parallelFor, parallelForState);
     }
 }
 
 namespace {
 
-template<class T> inline Containers::Array<Vector3> generateSmoothNormalsImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
+template<class T> inline Containers::Array<Vector3> generateSmoothNormalsImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const ParallelFor parallelFor, void* const parallelForState) {
     Containers::Array<Vector3> out{NoInit, positions.size()};
-    generateSmoothNormalsInto(indices, positions, out);
+    generateSmoothNormalsInto(indices, positions, out, parallelFor, parallelForState);
     return out;
 }
 
@@ -267,18 +314,32 @@ template<class T> inline Containers::Array<Vector3> generateSmoothNormalsImpleme
    figure out on its own which overload to use when indices are not already a
    strided arrray view */
 Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
-    return generateSmoothNormalsImplementation(indices, positions);
+    return generateSmoothNormalsImplementation(indices, positions, parallelForSerial, nullptr);
 }
 Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
-    return generateSmoothNormalsImplementation(indices, positions);
+    return generateSmoothNormalsImplementation(indices, positions, parallelForSerial, nullptr);
 }
 Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
-    return generateSmoothNormalsImplementation(indices, positions);
+    return generateSmoothNormalsImplementation(indices, positions, parallelForSerial, nullptr);
 }
 
 Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions) {
+    return generateSmoothNormals(indices, positions, parallelForSerial, nullptr);
+}
+
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const ParallelFor parallelFor, void* const parallelForState) {
+    return generateSmoothNormalsImplementation(indices, positions, parallelFor, parallelForState);
+}
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const ParallelFor parallelFor, void* const parallelForState) {
+    return generateSmoothNormalsImplementation(indices, positions, parallelFor, parallelForState);
+}
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const ParallelFor parallelFor, void* const parallelForState) {
+    return generateSmoothNormalsImplementation(indices, positions, parallelFor, parallelForState);
+}
+
+Containers::Array<Vector3> generateSmoothNormals(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const ParallelFor parallelFor, void* const parallelForState) {
     Containers::Array<Vector3> out{NoInit, positions.size()};
-    generateSmoothNormalsInto(indices, positions, out);
+    generateSmoothNormalsInto(indices, positions, out, parallelFor, parallelForState);
     return out;
 }
 
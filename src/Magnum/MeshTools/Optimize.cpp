@@ -0,0 +1,307 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Optimize.h"
+
+#include <algorithm>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Copy.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Simulates a FIFO post-transform vertex cache, calling `miss` for each
+   triangle with the count of its vertices that weren't in the cache. Returns
+   false if an index is out of range, in which case an assertion message was
+   printed. */
+template<class T, class F> bool simulateVertexCache(const Containers::StridedArrayView1D<const T>& indices, const std::size_t vertexCount, const std::size_t cacheSize, const char* const assertPrefix, F&& miss) {
+    #ifdef CORRADE_NO_ASSERT
+    static_cast<void>(assertPrefix);
+    #endif
+
+    /* Vertex is in the cache if it missed less than cacheSize misses ago. The
+       time starts past the cache size so nothing is in the cache initially. */
+    Containers::Array<std::size_t> timestamp{ValueInit, vertexCount};
+    std::size_t time = cacheSize + 1;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        UnsignedInt misses = 0;
+        for(std::size_t j = 0; j != 3; ++j) {
+            const T index = indices[i + j];
+            CORRADE_ASSERT(index < vertexCount,
+                assertPrefix << "index" << index << "out of range for" << vertexCount << "vertices", false);
+            if(time - timestamp[index] > cacheSize) {
+                timestamp[index] = time++;
+                ++misses;
+            }
+        }
+        miss(i/3, misses);
+    }
+
+    return true;
+}
+
+template<class T> VertexCacheStatistics analyzeVertexCacheImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::analyzeVertexCache(): index count not divisible by 3, got" << indices.size(), {});
+
+    std::size_t totalMisses = 0;
+    if(!simulateVertexCache(indices, vertexCount, cacheSize, "MeshTools::analyzeVertexCache():", [&](std::size_t, UnsignedInt misses) {
+        totalMisses += misses;
+    })) return {};
+
+    if(indices.isEmpty()) return {0.0f, 0.0f};
+
+    /* Every referenced vertex is a miss the first time it's used, so the
+       unique vertex count is the count of first-time misses. Calculate it
+       separately to not depend on the cache size. */
+    Containers::Array<bool> used{ValueInit, vertexCount};
+    std::size_t usedCount = 0;
+    for(const T index: indices) {
+        if(used[index]) continue;
+        used[index] = true;
+        ++usedCount;
+    }
+
+    return {Float(totalMisses)/(indices.size()/3),
+            Float(totalMisses)/usedCount};
+}
+
+template<class T> void optimizeOverdrawInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::optimizeOverdrawInPlace(): index count not divisible by 3, got" << indices.size(), );
+    CORRADE_ASSERT(threshold >= 1.0f,
+        "MeshTools::optimizeOverdrawInPlace(): expected threshold to be at least 1, got" << threshold, );
+
+    const std::size_t triangleCount = indices.size()/3;
+    Containers::Array<UnsignedByte> misses{NoInit, triangleCount};
+    if(!simulateVertexCache(Containers::StridedArrayView1D<const T>{indices}, positions.size(), cacheSize, "MeshTools::optimizeOverdrawInPlace():", [&](std::size_t triangle, UnsignedInt triangleMisses) {
+        misses[triangle] = UnsignedByte(triangleMisses);
+    })) return;
+
+    /* Cluster boundaries. A hard boundary is where all vertices of a triangle
+       miss the cache, which is where tipsifyInPlace() jumped to a
+       non-adjacent part of the mesh. Inside such cluster, a soft boundary is
+       placed at triangles that restart the cache, as long as the cache miss
+       ratio of the cluster so far isn't worse than threshold times the cache
+       miss ratio of the whole hard cluster. */
+    Containers::Array<UnsignedInt> clusters;
+    for(std::size_t begin = 0; begin != triangleCount; ) {
+        std::size_t end = begin + 1;
+        std::size_t clusterMisses = misses[begin];
+        for(; end != triangleCount && misses[end] != 3; ++end)
+            clusterMisses += misses[end];
+        const Float acmr = Float(clusterMisses)/(end - begin);
+
+        arrayAppend(clusters, UnsignedInt(begin));
+        std::size_t softBegin = begin;
+        std::size_t softMisses = 0;
+        for(std::size_t i = begin; i != end; ++i) {
+            if(i != softBegin && misses[i] >= 2 && Float(softMisses)/(i - softBegin) <= threshold*acmr) {
+                arrayAppend(clusters, UnsignedInt(i));
+                softBegin = i;
+                softMisses = 0;
+            }
+            softMisses += misses[i];
+        }
+
+        begin = end;
+    }
+    const std::size_t clusterCount = clusters.size();
+    arrayAppend(clusters, UnsignedInt(triangleCount));
+
+    /* Area-weighted centroid and normal of each cluster, and the centroid of
+       the whole mesh. The cross product length is twice the triangle area,
+       which doesn't matter for the weighting. */
+    Containers::Array<Vector3> clusterCentroids{ValueInit, clusterCount};
+    Containers::Array<Vector3> clusterNormals{ValueInit, clusterCount};
+    Containers::Array<Float> clusterAreas{ValueInit, clusterCount};
+    Vector3 meshCentroid;
+    Float meshArea = 0.0f;
+    for(std::size_t i = 0; i != clusterCount; ++i) {
+        for(std::size_t j = clusters[i]; j != clusters[i + 1]; ++j) {
+            const Vector3 a = positions[indices[j*3 + 0]];
+            const Vector3 b = positions[indices[j*3 + 1]];
+            const Vector3 c = positions[indices[j*3 + 2]];
+            const Vector3 normal = Math::cross(b - a, c - a);
+            const Float area = normal.length();
+            clusterCentroids[i] += (a + b + c)*area/3.0f;
+            clusterNormals[i] += normal;
+            clusterAreas[i] += area;
+        }
+
+        meshCentroid += clusterCentroids[i];
+        meshArea += clusterAreas[i];
+    }
+    if(meshArea > 0.0f) meshCentroid /= meshArea;
+
+    /* Clusters that face away from the mesh centroid the most are the most
+       likely to occlude other clusters, so they go first */
+    Containers::Array<Float> occlusion{NoInit, clusterCount};
+    for(std::size_t i = 0; i != clusterCount; ++i) {
+        const Float normalLength = clusterNormals[i].length();
+        if(clusterAreas[i] == 0.0f || normalLength == 0.0f) {
+            occlusion[i] = 0.0f;
+            continue;
+        }
+
+        occlusion[i] = Math::dot(clusterCentroids[i]/clusterAreas[i] - meshCentroid, clusterNormals[i]/normalLength);
+    }
+
+    Containers::Array<UnsignedInt> order{NoInit, clusterCount};
+    for(std::size_t i = 0; i != clusterCount; ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&occlusion](UnsignedInt a, UnsignedInt b) {
+        return occlusion[a] > occlusion[b];
+    });
+
+    Containers::Array<T> outputIndices{NoInit, indices.size()};
+    std::size_t outputIndex = 0;
+    for(const UnsignedInt cluster: order)
+        for(std::size_t i = clusters[cluster]*3; i != clusters[cluster + 1]*3; ++i)
+            outputIndices[outputIndex++] = indices[i];
+    CORRADE_INTERNAL_ASSERT(outputIndex == indices.size());
+
+    Utility::copy(outputIndices, indices);
+}
+
+template<class T> std::size_t optimizeVertexFetchInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const Containers::StridedArrayView2D<char>& data) {
+    const std::size_t vertexCount = data.size()[0];
+
+    /* Remap the indices to the order of first use, remembering which original
+       vertex is at which new position */
+    Containers::Array<UnsignedInt> remap{DirectInit, vertexCount, ~UnsignedInt{}};
+    Containers::Array<UnsignedInt> vertices{NoInit, vertexCount};
+    std::size_t usedCount = 0;
+    for(T& index: indices) {
+        CORRADE_ASSERT(index < vertexCount,
+            "MeshTools::optimizeVertexFetchInPlace(): index" << index << "out of range for" << vertexCount << "vertices", {});
+        UnsignedInt& mapped = remap[index];
+        if(mapped == ~UnsignedInt{}) {
+            mapped = usedCount;
+            vertices[usedCount++] = index;
+        }
+        index = T(mapped);
+    }
+
+    /* Gather the used vertices into a temporary copy and then put them back */
+    Containers::Array<char> gathered{NoInit, usedCount*data.size()[1]};
+    const Containers::StridedArrayView2D<char> gatheredView{gathered, {usedCount, data.size()[1]}};
+    for(std::size_t i = 0; i != usedCount; ++i)
+        Utility::copy(data[vertices[i]], gatheredView[i]);
+    Utility::copy(gatheredView, data.prefix(usedCount));
+
+    return usedCount;
+}
+
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    return analyzeVertexCacheImplementation(indices, vertexCount, cacheSize);
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    return analyzeVertexCacheImplementation(indices, vertexCount, cacheSize);
+}
+
+VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    return analyzeVertexCacheImplementation(indices, vertexCount, cacheSize);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, cacheSize, threshold);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, cacheSize, threshold);
+}
+
+void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    optimizeOverdrawInPlaceImplementation(indices, positions, cacheSize, threshold);
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return optimizeVertexFetchInPlaceImplementation(indices, data);
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return optimizeVertexFetchInPlaceImplementation(indices, data);
+}
+
+std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data) {
+    return optimizeVertexFetchInPlaceImplementation(indices, data);
+}
+
+Trade::MeshData optimizeVertexFetch(const Trade::MeshData& mesh) {
+    CORRADE_ASSERT(!mesh.isIndexed() || !isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::optimizeVertexFetch(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+        (Trade::MeshData{MeshPrimitive::Points, 0}));
+    #ifndef CORRADE_NO_ASSERT
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat format = mesh.attributeFormat(i);
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            "MeshTools::optimizeVertexFetch(): attribute" << i << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format),
+            (Trade::MeshData{MeshPrimitive::Points, 0}));
+    }
+    #endif
+
+    if(!mesh.isIndexed()) return copy(mesh);
+
+    const Containers::Array<UnsignedInt> indices = mesh.indicesAsArray();
+    Containers::Array<UnsignedInt> remap{DirectInit, mesh.vertexCount(), ~UnsignedInt{}};
+    Containers::Array<UnsignedInt> vertices{NoInit, mesh.vertexCount()};
+    Containers::Array<char> indexData{NoInit, indices.size()*sizeof(UnsignedInt)};
+    const Containers::ArrayView<UnsignedInt> outputIndices = Containers::arrayCast<UnsignedInt>(indexData);
+    UnsignedInt vertexCount = 0;
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        UnsignedInt& mapped = remap[indices[i]];
+        if(mapped == ~UnsignedInt{}) {
+            mapped = vertexCount;
+            vertices[vertexCount++] = indices[i];
+        }
+        outputIndices[i] = mapped;
+    }
+
+    /* Gather the used vertices by treating the list of them as an index
+       buffer to duplicate the attributes with */
+    const Containers::ArrayView<const UnsignedInt> usedVertices = vertices.prefix(vertexCount);
+    Trade::MeshData gathered = duplicate(Trade::MeshData{mesh.primitive(),
+        {}, usedVertices, Trade::MeshIndexData{usedVertices},
+        {}, mesh.vertexData(), Trade::meshAttributeDataNonOwningArray(mesh.attributeData()),
+        mesh.vertexCount()});
+
+    return Trade::MeshData{mesh.primitive(),
+        Utility::move(indexData), Trade::MeshIndexData{outputIndices},
+        gathered.releaseVertexData(), gathered.releaseAttributeData(),
+        vertexCount};
+}
+
+}}
@@ -0,0 +1,186 @@
+#ifndef Magnum_MeshTools_Optimize_h
+#define Magnum_MeshTools_Optimize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::VertexCacheStatistics, function @ref Magnum::MeshTools::analyzeVertexCache(), @ref Magnum::MeshTools::optimizeOverdrawInPlace(), @ref Magnum::MeshTools::optimizeVertexFetchInPlace(), @ref Magnum::MeshTools::optimizeVertexFetch()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Post-transform vertex cache statistics
+@m_since_latest
+
+@see @ref analyzeVertexCache()
+*/
+struct VertexCacheStatistics {
+    /**
+     * @brief Average cache miss ratio
+     *
+     * Count of vertex shader invocations per triangle. Ranges from
+     * @cpp 3.0f @ce in the worst case to about @cpp 0.5f @ce for an ideally
+     * ordered large regular grid.
+     */
+    Float acmr;
+
+    /**
+     * @brief Average transformed vertex ratio
+     *
+     * Count of vertex shader invocations per vertex referenced by the index
+     * buffer. Is @cpp 1.0f @ce in the ideal case, when each vertex gets
+     * transformed exactly once.
+     */
+    Float atvr;
+};
+
+/**
+@brief Analyze post-transform vertex cache efficiency of an index buffer
+@param indices      Triangle indices
+@param vertexCount  Vertex count
+@param cacheSize    Post-transform vertex cache size
+@m_since_latest
+
+Simulates a FIFO cache of @p cacheSize vertices, which is a reasonable
+approximation of the behavior of most GPUs, and counts cache misses. Use to
+measure the effect of @ref tipsifyInPlace() and @ref optimizeOverdrawInPlace().
+If @p indices are empty, both ratios are @cpp 0.0f @ce.
+
+Expects that @p indices size is divisible by @cpp 3 @ce and all indices are
+less than @p vertexCount.
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+@brief Reorder triangle clusters to reduce overdraw in-place
+@param[in,out] indices  Triangle indices to operate on
+@param[in] positions    Vertex positions
+@param[in] cacheSize    Post-transform vertex cache size
+@param[in] threshold    Max allowed degradation of the average cache miss
+    ratio
+@m_since_latest
+
+Meant to be used after @ref tipsifyInPlace() with the same @p cacheSize.
+Splits the index buffer into clusters at places where the simulated vertex
+cache gets fully flushed, further subdivides them as long as that doesn't make
+their average cache miss ratio worse than @p threshold times the original, and
+then sorts the clusters so the ones facing outwards from the mesh center get
+drawn first, occluding the others. Triangles inside each cluster keep their
+order. Algorithm used: *Pedro V. Sander, Diego Nehab, and Joshua Barczak ---
+Fast Triangle Reordering for Vertex Locality and Reduced Overdraw, SIGGRAPH
+2007, https://gfx.cs.princeton.edu/pubs/Sander_2007_%3eTR/tipsy.pdf*.
+
+Expects that @p indices size is divisible by @cpp 3 @ce, all indices are in
+bounds for @p positions and @p threshold is at least @cpp 1.0f @ce.
+@see @ref analyzeVertexCache()
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t cacheSize, Float threshold = 1.05f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t cacheSize, Float threshold = 1.05f);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdrawInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t cacheSize, Float threshold = 1.05f);
+
+/**
+@brief Reorder vertex data to the order of first use in-place
+@param[in,out] indices  Index array to operate on
+@param[in,out] data     Vertex data array
+@return Count of vertices referenced by @p indices
+@m_since_latest
+
+Moves the vertices in @p data so they're in the order in which they're first
+referenced by @p indices and updates @p indices accordingly, which improves
+locality of vertex fetch. Vertices not referenced by @p indices are cut away,
+so only a prefix of @p data of the returned size is valid after calling this
+function. Should be done as the last step after all other index buffer
+reordering operations such as @ref tipsifyInPlace() or
+@ref optimizeOverdrawInPlace().
+
+Expects that all indices are in bounds for the first dimension of @p data.
+@see @ref optimizeVertexFetch(const Trade::MeshData&)
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const Containers::StridedArrayView2D<char>& data);
+
+/**
+@brief Reorder mesh vertices to the order of first use
+@m_since_latest
+
+Returns a copy of @p mesh with vertices not referenced by the index buffer
+removed and the rest interleaved and put in order of their first use in the
+index buffer. The index type is always @ref MeshIndexType::UnsignedInt, use
+@ref compressIndices() to compress it to a smaller type, if desired. If
+@p mesh is not indexed, it's passed through @ref copy(const Trade::MeshData&),
+as the vertices are already in the order of their use.
+
+Expects that the mesh doesn't have an implementation-specific index type and
+no attributes with implementation-specific formats.
+@see @ref optimizeVertexFetchInPlace(), @ref tipsifyInPlace(),
+    @ref optimizeOverdrawInPlace()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData optimizeVertexFetch(const Trade::MeshData& mesh);
+
+}}
+
+#endif
@@ -0,0 +1,198 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Quantize.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/PackingBatch.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+VertexFormat quantizedFormat(const Trade::MeshAttribute name, const VertexFormat format) {
+    if(name == Trade::MeshAttribute::Position) {
+        if(format == VertexFormat::Vector2)
+            return VertexFormat::Vector2sNormalized;
+        if(format == VertexFormat::Vector3)
+            return VertexFormat::Vector3sNormalized;
+    } else if(name == Trade::MeshAttribute::Normal ||
+              name == Trade::MeshAttribute::Tangent ||
+              name == Trade::MeshAttribute::Bitangent) {
+        if(format == VertexFormat::Vector3)
+            return VertexFormat::Vector3sNormalized;
+        /* Only tangents can be four-component, no need to check the name */
+        if(format == VertexFormat::Vector4)
+            return VertexFormat::Vector4sNormalized;
+    } else if(name == Trade::MeshAttribute::TextureCoordinates) {
+        if(format == VertexFormat::Vector2)
+            return VertexFormat::Vector2h;
+    }
+
+    return format;
+}
+
+}
+
+Containers::Pair<Trade::MeshData, Matrix4> quantize(const Trade::MeshData& mesh) {
+    CORRADE_ASSERT(!mesh.isIndexed() || !isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        "MeshTools::quantize(): mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+        (Containers::Pair<Trade::MeshData, Matrix4>{Trade::MeshData{MeshPrimitive::Points, 0}, Matrix4{}}));
+    #ifndef CORRADE_NO_ASSERT
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat format = mesh.attributeFormat(i);
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            "MeshTools::quantize(): attribute" << i << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format),
+            (Containers::Pair<Trade::MeshData, Matrix4>{Trade::MeshData{MeshPrimitive::Points, 0}, Matrix4{}}));
+    }
+    #endif
+
+    const UnsignedInt vertexCount = mesh.vertexCount();
+
+    /* Decide on the output formats. Morph targets are kept as-is, as they're
+       usually displacements relative to the base attribute; if there are
+       position morph targets, the positions are kept as-is as well because
+       the dequantization matrix would get applied to the displacements. */
+    bool quantizePositions = true;
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        if(mesh.attributeName(i) == Trade::MeshAttribute::Position && mesh.attributeMorphTargetId(i) != -1) {
+            quantizePositions = false;
+            break;
+        }
+    }
+    Containers::Array<VertexFormat> formats{NoInit, mesh.attributeCount()};
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const Trade::MeshAttribute name = mesh.attributeName(i);
+        formats[i] = mesh.attributeMorphTargetId(i) != -1 ||
+            (name == Trade::MeshAttribute::Position && !quantizePositions) ?
+                mesh.attributeFormat(i) :
+                quantizedFormat(name, mesh.attributeFormat(i));
+    }
+
+    /* Bounding range of all quantized positions, so all position attributes
+       can share a single dequantization matrix */
+    Range3D bounds{Math::ZeroInit};
+    bool hasBounds = false;
+    for(UnsignedInt i = 0; i != mesh.attributeCount() && vertexCount; ++i) {
+        if(mesh.attributeName(i) != Trade::MeshAttribute::Position || formats[i] == mesh.attributeFormat(i))
+            continue;
+
+        Range3D range{Math::ZeroInit};
+        if(mesh.attributeFormat(i) == VertexFormat::Vector2) {
+            const Range2D range2D = Math::minmax(mesh.attribute<Vector2>(i));
+            range = {Vector3{range2D.min(), 0.0f}, Vector3{range2D.max(), 0.0f}};
+        } else range = Math::minmax(mesh.attribute<Vector3>(i));
+
+        bounds = hasBounds ? Math::join(bounds, range) : range;
+        hasBounds = true;
+    }
+
+    /* Positions are mapped from the bounding range to [-1, 1] in every
+       dimension, avoid a division by zero for flat meshes */
+    const Vector3 center = bounds.center();
+    Vector3 halfSize = bounds.size()/2.0f;
+    for(std::size_t i = 0; i != 3; ++i)
+        if(halfSize[i] == 0.0f) halfSize[i] = 1.0f;
+    const Matrix4 dequantization = Matrix4::translation(center)*Matrix4::scaling(halfSize);
+
+    /* Calculate the interleaved layout, with every attribute padded to four
+       bytes */
+    Containers::Array<std::size_t> offsets{NoInit, mesh.attributeCount()};
+    std::size_t stride = 0;
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        offsets[i] = stride;
+        const std::size_t size = vertexFormatSize(formats[i])*Math::max(mesh.attributeArraySize(i), UnsignedShort{1});
+        stride += (size + 3) & ~std::size_t{3};
+    }
+
+    /* Zero-initialized so the padding isn't random */
+    Containers::Array<char> vertexData{ValueInit, stride*vertexCount};
+    Containers::Array<Trade::MeshAttributeData> attributeData{mesh.attributeCount()};
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const Trade::MeshAttribute name = mesh.attributeName(i);
+        const VertexFormat format = mesh.attributeFormat(i);
+        const Containers::StridedArrayView2D<const char> src = mesh.attribute(i);
+        const Containers::StridedArrayView2D<char> dst{vertexData,
+            vertexData.data() + offsets[i],
+            {vertexCount, vertexFormatSize(formats[i])*Math::max(mesh.attributeArraySize(i), UnsignedShort{1})},
+            {std::ptrdiff_t(stride), 1}};
+
+        if(formats[i] == format)
+            Utility::copy(src, dst);
+        else if(name == Trade::MeshAttribute::Position && format == VertexFormat::Vector2) {
+            Containers::Array<Vector2> normalized{NoInit, vertexCount};
+            const Containers::StridedArrayView1D<const Vector2> positions = mesh.attribute<Vector2>(i);
+            for(std::size_t j = 0; j != vertexCount; ++j)
+                normalized[j] = (positions[j] - center.xy())/halfSize.xy();
+            Math::packInto(Containers::arrayCast<2, const Float>(Containers::stridedArrayView(normalized)), Containers::arrayCast<2, Short>(dst));
+        } else if(name == Trade::MeshAttribute::Position) {
+            Containers::Array<Vector3> normalized{NoInit, vertexCount};
+            const Containers::StridedArrayView1D<const Vector3> positions = mesh.attribute<Vector3>(i);
+            for(std::size_t j = 0; j != vertexCount; ++j)
+                normalized[j] = (positions[j] - center)/halfSize;
+            Math::packInto(Containers::arrayCast<2, const Float>(Containers::stridedArrayView(normalized)), Containers::arrayCast<2, Short>(dst));
+        } else if(formats[i] == VertexFormat::Vector2h)
+            Math::packHalfInto(Containers::arrayCast<2, const Float>(src), Containers::arrayCast<2, UnsignedShort>(dst));
+        else
+            Math::packInto(Containers::arrayCast<2, const Float>(src), Containers::arrayCast<2, Short>(dst));
+
+        attributeData[i] = Trade::MeshAttributeData{name, formats[i],
+            Containers::StridedArrayView1D<const void>{vertexData,
+                vertexData.data() + offsets[i], vertexCount,
+                std::ptrdiff_t(stride)},
+            mesh.attributeArraySize(i), mesh.attributeMorphTargetId(i)};
+    }
+
+    /* Copy the index buffer as-is */
+    Containers::Array<char> indexData;
+    Trade::MeshIndexData indices;
+    if(mesh.isIndexed()) {
+        indexData = Containers::Array<char>{NoInit, mesh.indexData().size()};
+        indices = Trade::MeshIndexData{
+            mesh.indexType(),
+            Containers::StridedArrayView1D<const void>{
+                indexData,
+                indexData.data() + mesh.indexOffset(),
+                mesh.indexCount(),
+                mesh.indexStride()}};
+        Utility::copy(mesh.indexData(), indexData);
+    }
+
+    return {Trade::MeshData{mesh.primitive(),
+        Utility::move(indexData), indices,
+        Utility::move(vertexData), Utility::move(attributeData),
+        vertexCount}, dequantization};
+}
+
+}}
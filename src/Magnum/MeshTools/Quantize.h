@@ -0,0 +1,87 @@
+#ifndef Magnum_MeshTools_Quantize_h
+#define Magnum_MeshTools_Quantize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::quantize()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Quantize mesh vertex attributes
+@return The quantized mesh and a matrix for the position dequantization
+@m_since_latest
+
+Returns a copy of @p mesh with floating-point attributes converted to packed
+formats:
+
+-   @ref Trade::MeshAttribute::Position in @ref VertexFormat::Vector2 or
+    @ref VertexFormat::Vector3 is normalized to the bounding range of all
+    position attributes in the mesh and stored as
+    @ref VertexFormat::Vector2sNormalized or
+    @ref VertexFormat::Vector3sNormalized. The returned matrix transforms the
+    normalized positions back to the original range, i.e. it's meant to be
+    multiplied with the object transformation. For 2D positions the Z
+    coordinate of the matrix is an identity.
+-   @ref Trade::MeshAttribute::Normal, @ref Trade::MeshAttribute::Tangent and
+    @ref Trade::MeshAttribute::Bitangent in @ref VertexFormat::Vector3 or
+    @ref VertexFormat::Vector4 are stored as
+    @ref VertexFormat::Vector3sNormalized or
+    @ref VertexFormat::Vector4sNormalized. The values are expected to be in the
+    @f$ [-1, 1] @f$ range.
+-   @ref Trade::MeshAttribute::TextureCoordinates in
+    @ref VertexFormat::Vector2 are stored as @ref VertexFormat::Vector2h.
+
+Other attributes, including the above in other formats, are copied unchanged.
+The output is always interleaved, with each attribute padded to a multiple of
+four bytes to satisfy alignment requirements of common GPU APIs. A mesh with
+@ref VertexFormat::Vector3 positions, normals and @ref VertexFormat::Vector2
+texture coordinates thus shrinks from 32 to 20 bytes per vertex. The index
+buffer, if present, is copied unchanged.
+
+Note that @ref Trade::MeshAttribute::Normal supports only three-component
+formats and so octahedral encoding of normals isn't possible with builtin
+attributes.
+
+Expects that the mesh doesn't have an implementation-specific index type and
+no attributes with implementation-specific formats.
+@see @ref isVertexFormatNormalized(), @ref Math::packInto(),
+    @ref Math::packHalfInto()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Trade::MeshData, Matrix4> quantize(const Trade::MeshData& mesh);
+
+}}
+
+#endif
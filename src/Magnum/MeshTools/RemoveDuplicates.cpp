@@ -36,6 +36,7 @@
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/MurmurHash2.h>
 
+#include "Magnum/Math/Constants.h"
 #include "Magnum/Math/FunctionsBatch.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/MeshTools/Copy.h"
@@ -66,6 +67,139 @@ struct ArrayHash {
     private: std::size_t _size;
 };
 
+namespace {
+
+/* Hashes a contiguous key eight bytes at a time instead of byte-by-byte as
+   MurmurHash2 does, which makes a significant difference for the typical
+   vertex sizes of 12 to 64 bytes. The per-word mixing and the finalizer are
+   taken from the 64-bit MurmurHash3. */
+inline UnsignedLong hashKey(const char* const data, const std::size_t size) {
+    UnsignedLong h = size*0x9e3779b97f4a7c15ull;
+    const auto mix = [&h](UnsignedLong k) {
+        k *= 0x87c37b91114253d5ull;
+        k = (k << 31)|(k >> 33);
+        k *= 0x4cf5ad432745937full;
+        h ^= k;
+        h = ((h << 27)|(h >> 37))*5 + 0x52dce729;
+    };
+
+    std::size_t i = 0;
+    for(; i + 8 <= size; i += 8) {
+        /* Going through memcpy() as the data may not be aligned */
+        UnsignedLong k;
+        std::memcpy(&k, data + i, 8);
+        mix(k);
+    }
+    if(i != size) {
+        UnsignedLong k = 0;
+        std::memcpy(&k, data + i, size - i);
+        mix(k);
+    }
+
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+/* Slot of an open-addressing hash table. Keys have a runtime size so the
+   table doesn't store them, only an index into the data array where the key
+   is. Upper 32 bits of the hash are stored alongside to avoid most of the
+   memcmp() calls on collisions. */
+struct Slot {
+    UnsignedInt hash;
+    /* Index of the key in the data array plus one, zero if the slot is
+       empty */
+    UnsignedInt index;
+};
+
+/* Power-of-two capacity that keeps the load factor at or below 50% even if
+   all entries are unique, to keep the linear probe sequences short */
+inline std::size_t tableCapacity(const std::size_t size) {
+    std::size_t capacity = 16;
+    while(capacity < size*2) capacity <<= 1;
+    return capacity;
+}
+
+/* Looks up given key in the table. If it's not there, inserts it with given
+   index, which is expected to point to a copy of the key in the data array
+   that won't change anymore. Returns the index of the first occurrence,
+   which is either the existing entry or the newly inserted one. */
+template<class T> UnsignedInt findOrInsert(const Containers::ArrayView<Slot> slots, const Containers::StridedArrayView2D<T>& data, const UnsignedLong hash, const void* const key, const UnsignedInt index) {
+    const std::size_t mask = slots.size() - 1;
+    const UnsignedInt hash32 = UnsignedInt(hash >> 32);
+    const std::size_t keySize = data.size()[1];
+    for(std::size_t i = std::size_t(hash) & mask; ; i = (i + 1) & mask) {
+        Slot& slot = slots[i];
+        if(!slot.index) {
+            slot.hash = hash32;
+            slot.index = index + 1;
+            return index;
+        }
+
+        if(slot.hash == hash32 && std::memcmp(data[slot.index - 1].data(), key, keySize) == 0)
+            return slot.index - 1;
+    }
+}
+
+/* Count of items hashed and deduplicated by a single ParallelFor task. Chosen
+   so the per-task table fits into L2 cache. */
+constexpr std::size_t RemoveDuplicatesChunkSize = 65536;
+
+struct RemoveDuplicatesState {
+    Containers::StridedArrayView2D<const char> data;
+    Containers::StridedArrayView1D<UnsignedInt> indices;
+    Containers::ArrayView<UnsignedLong> hashes;
+};
+
+/* Hashes a chunk of items and deduplicates them against a chunk-local
+   table. Every item then points to the first occurrence within the chunk, and
+   because a global first occurrence is always a first occurrence in its
+   chunk as well, only these need to be looked up in the global table
+   afterwards. */
+void removeDuplicatesChunk(void* const state, const std::size_t chunk) {
+    const RemoveDuplicatesState& s = *static_cast<const RemoveDuplicatesState*>(state);
+    const std::size_t begin = chunk*RemoveDuplicatesChunkSize;
+    const std::size_t end = Math::min(begin + RemoveDuplicatesChunkSize, s.data.size()[0]);
+    const std::size_t keySize = s.data.size()[1];
+
+    Containers::Array<Slot> slots{ValueInit, tableCapacity(end - begin)};
+    for(std::size_t i = begin; i != end; ++i) {
+        const void* const key = s.data[i].data();
+        const UnsignedLong hash = hashKey(static_cast<const char*>(key), keySize);
+        s.hashes[i] = hash;
+        s.indices[i] = findOrInsert(slots, s.data, hash, key, UnsignedInt(i));
+    }
+}
+
+std::size_t removeDuplicatesIntoImplementation(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const ParallelFor parallelFor, void* const parallelForState) {
+    const std::size_t dataSize = data.size()[0];
+
+    /* Hash and deduplicate all chunks in parallel */
+    Containers::Array<UnsignedLong> hashes{NoInit, dataSize};
+    RemoveDuplicatesState state{data, indices, hashes};
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, (dataSize + RemoveDuplicatesChunkSize - 1)/RemoveDuplicatesChunkSize, removeDuplicatesChunk, &state);
+
+    /* Merge the chunks in order. First occurrences within a chunk get looked
+       up in the global table, the rest points to an earlier item that's
+       already resolved to its global first occurrence. Going in order
+       ensures the result is the same as with the serial variant. */
+    Containers::Array<Slot> slots{ValueInit, tableCapacity(dataSize)};
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != dataSize; ++i) {
+        if(indices[i] == i) {
+            indices[i] = findOrInsert(slots, data, hashes[i], data[i].data(), UnsignedInt(i));
+            if(indices[i] == i) ++count;
+        } else indices[i] = indices[indices[i]];
+    }
+
+    return count;
+}
+
+}
+
 std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
     /* Assuming the second dimension is contiguous so we can calculate the
        hashes easily */
@@ -77,27 +211,33 @@ std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char
         "MeshTools::removeDuplicatesInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
 
     /* Table containing index of first occurrence for each unique entry.
-       Reserving more buckets than necessary (i.e. as if each entry was
+       Reserving more slots than necessary (i.e. as if each entry was
        unique). */
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]},
-        ArrayEqual{data.size()[1]}};
+    Containers::Array<Slot> slots{ValueInit, tableCapacity(dataSize)};
+    const std::size_t keySize = data.size()[1];
 
     /* Go through all entries */
+    std::size_t count = 0;
     for(std::size_t i = 0; i != dataSize; ++i) {
         /* Try to insert new entry into the table. The inserted index points
-           into the original unchanged data array. */
-        const Containers::ArrayView<const char> entry = data[i].asContiguous();
-        const auto result = table.emplace(entry, i);
-
-        /* Put the (either new or already existing) index into the output
-           index array */
-        indices[i] = result.first->second;
+           into the original unchanged data array. Put the (either new or
+           already existing) index into the output index array. */
+        const void* const key = data[i].data();
+        indices[i] = findOrInsert(slots, data, hashKey(static_cast<const char*>(key), keySize), key, UnsignedInt(i));
+        if(indices[i] == i) ++count;
     }
 
-    CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
-    return table.size();
+    CORRADE_INTERNAL_ASSERT(dataSize >= count);
+    return count;
+}
+
+std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const ParallelFor parallelFor, void* const parallelForState) {
+    CORRADE_ASSERT(data.isEmpty()[0] || data.isContiguous<1>(),
+        "MeshTools::removeDuplicatesInto(): second data view dimension is not contiguous", {});
+    CORRADE_ASSERT(indices.size() == data.size()[0],
+        "MeshTools::removeDuplicatesInto(): output index array has" << indices.size() << "elements but expected" << data.size()[0], {});
+
+    return removeDuplicatesIntoImplementation(data, indices, parallelFor, parallelForState);
 }
 
 Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(const Containers::StridedArrayView2D<const char>& data) {
@@ -106,6 +246,12 @@ Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(c
     return {Utility::move(indices), size};
 }
 
+Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(const Containers::StridedArrayView2D<const char>& data, const ParallelFor parallelFor, void* const parallelForState) {
+    Containers::Array<UnsignedInt> indices{NoInit, data.size()[0]};
+    const std::size_t size = removeDuplicatesInto(data, indices, parallelFor, parallelForState);
+    return {Utility::move(indices), size};
+}
+
 std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
     /* Assuming the second dimension is contiguous so we can calculate the
        hashes easily */
@@ -117,45 +263,69 @@ std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<cha
         "MeshTools::removeDuplicatesInPlaceInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
 
     /* Table containing index of first occurrence for each unique entry.
-       Reserving more buckets than necessary (i.e. as if each entry was
+       Reserving more slots than necessary (i.e. as if each entry was
        unique). */
-    std::unordered_map<const void*, UnsignedInt, ArrayHash, ArrayEqual> table{
-        dataSize,
-        ArrayHash{data.size()[1]},
-        ArrayEqual{data.size()[1]}};
+    Containers::Array<Slot> slots{ValueInit, tableCapacity(dataSize)};
+    const std::size_t keySize = data.size()[1];
 
     /* Go through all entries and insert them into the table. Because the keys
-       have runtime size, the table doesn't store a copy of the keys, only a
-       reference. The reference is to the original data that we mutate
-       in-place, so extra care needs to be taken to prevent already-inserted
-       keys from getting modified. */
+       have runtime size, the table doesn't store a copy of the keys, only an
+       index. The index is to the original data that we mutate in-place, so
+       extra care needs to be taken to prevent already-inserted keys from
+       getting modified. */
+    std::size_t count = 0;
     for(std::size_t i = 0; i != dataSize; ++i) {
         /* First copy the key data to a potentially final no-longer-mutable
            place (except if the source and target location is the same). Data
-           in [table.size()-1, i) is already present in the [0, table.size()-1)
-           range from previous iterations so we aren't overwriting anything. If
-           insertion succeeds, this location will not be touched ever again; if
-           it fails the location isn't used as a key anywhere and so it can be
-           reused next time for a different key.
-
-           Alternatively we could first call find() and only then conditionally
-           do a copy() and emplace(), but that means the hash & search would be
-           performed twice, which is never faster than a plain memory copy. */
-        const Containers::ArrayView<char> dst = data[table.size()].asContiguous();
-        if(i != table.size())
+           in [count, i) is already present in the [0, count) range from
+           previous iterations so we aren't overwriting anything. If insertion
+           succeeds, this location will not be touched ever again; if it fails
+           the location isn't used as a key anywhere and so it can be reused
+           next time for a different key.
+
+           Alternatively we could first do a lookup and only then
+           conditionally do a copy() and insertion, but that means the hash &
+           search would be performed twice, which is never faster than a plain
+           memory copy. */
+        const Containers::ArrayView<char> dst = data[count].asContiguous();
+        if(i != count)
             Utility::copy(data[i].asContiguous(), dst);
 
         /* Insert the new entry into the table. If it succeeds, dst is
-           guaranteed to not change anymore. */
-        const auto result = table.emplace(dst, table.size());
+           guaranteed to not change anymore. Put the (either new or already
+           existing) index into the output index array. */
+        indices[i] = findOrInsert(slots, data, hashKey(dst.data(), keySize), dst.data(), UnsignedInt(count));
+        if(indices[i] == count) ++count;
+    }
 
-        /* Put the (either new or already existing) index into the output index
-           array */
-        indices[i] = result.first->second;
+    CORRADE_INTERNAL_ASSERT(dataSize >= count);
+    return count;
+}
+
+std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const ParallelFor parallelFor, void* const parallelForState) {
+    CORRADE_ASSERT(data.isEmpty()[0] || data.isContiguous<1>(),
+        "MeshTools::removeDuplicatesInPlaceInto(): second data view dimension is not contiguous", {});
+
+    const std::size_t dataSize = data.size()[0];
+    CORRADE_ASSERT(indices.size() == dataSize,
+        "MeshTools::removeDuplicatesInPlaceInto(): output index array has" << indices.size() << "elements but expected" << dataSize, {});
+
+    /* Deduplicate without touching the data first, then compact the unique
+       items to the front. Each unique item is moved to a location that's
+       either a duplicate or an unique item that's already moved, and the
+       remaining items are remapped using the already remapped index of their
+       first occurrence. */
+    removeDuplicatesIntoImplementation(data, indices, parallelFor, parallelForState);
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != dataSize; ++i) {
+        if(indices[i] == i) {
+            if(i != count)
+                Utility::copy(data[i].asContiguous(), data[count].asContiguous());
+            indices[i] = count++;
+        } else indices[i] = indices[indices[i]];
     }
 
-    CORRADE_INTERNAL_ASSERT(dataSize >= table.size());
-    return table.size();
+    return count;
 }
 
 Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>& data) {
@@ -164,6 +334,12 @@ Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesIn
     return {Utility::move(indices), size};
 }
 
+Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>& data, const ParallelFor parallelFor, void* const parallelForState) {
+    Containers::Array<UnsignedInt> indices{NoInit, data.size()[0]};
+    const std::size_t size = removeDuplicatesInPlaceInto(data, indices, parallelFor, parallelForState);
+    return {Utility::move(indices), size};
+}
+
 namespace {
 
 template<class IndexType> std::size_t removeDuplicatesIndexedInPlaceImplementation(const Containers::StridedArrayView1D<IndexType>& indices, const Containers::StridedArrayView2D<char>& data) {
@@ -377,6 +553,198 @@ std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2
 
 namespace {
 
+/* Cell of a spatial hash grid over the first (up to) three dimensions of the
+   data */
+struct GridCell {
+    Long coordinates[3];
+    /* Index of the most recently added unique item in this cell plus one,
+       zero if the slot is empty. The remaining items in the cell are then
+       linked from it. */
+    UnsignedInt last;
+};
+
+/* Linear probing in the same way as findOrInsert() above, returns either the
+   existing cell or an empty slot where the cell should be put */
+GridCell& findCell(const Containers::ArrayView<GridCell> cells, const Long(&coordinates)[3]) {
+    const std::size_t mask = cells.size() - 1;
+    const UnsignedLong hash = hashKey(reinterpret_cast<const char*>(coordinates), sizeof(coordinates));
+    for(std::size_t i = std::size_t(hash) & mask; ; i = (i + 1) & mask) {
+        GridCell& cell = cells[i];
+        if(!cell.last || (cell.coordinates[0] == coordinates[0] &&
+                          cell.coordinates[1] == coordinates[1] &&
+                          cell.coordinates[2] == coordinates[2]))
+            return cell;
+    }
+}
+
+template<class T> std::size_t removeDuplicatesFuzzyGridInPlaceIntoImplementation(const Containers::StridedArrayView2D<T>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const T epsilon) {
+    CORRADE_ASSERT(indices.size() == data.size()[0],
+        "MeshTools::removeDuplicatesFuzzyGridInPlaceInto(): output index array has" << indices.size() << "elements but expected" << data.size()[0], {});
+    CORRADE_ASSERT(epsilon >= T(0),
+        "MeshTools::removeDuplicatesFuzzyGridInPlaceInto(): expected a non-negative epsilon but got" << epsilon, {});
+
+    const std::size_t dataSize = data.size()[0];
+    if(!dataSize) return 0;
+
+    /* Items with a NaN or an infinity in any dimension can't be within
+       epsilon of anything, so they're kept out of the grid altogether.
+       Otherwise they'd all end up in a single cell, making the lookup
+       quadratic, and infinities would blow up the cell size calculation
+       below. */
+    const std::size_t vectorSize = data.size()[1];
+    const auto isFinite = [vectorSize](const Containers::StridedArrayView1D<T>& entry) {
+        for(std::size_t j = 0; j != vectorSize; ++j)
+            /* Written this way so it's false for NaNs as well */
+            if(!(Math::abs(entry[j]) < Math::Constants<T>::inf())) return false;
+        return true;
+    };
+
+    /* Calculate extent of the finite items in every dimension */
+    Containers::Array<Math::Range1D<T>> extents{DirectInit, vectorSize, Math::Constants<T>::inf(), -Math::Constants<T>::inf()};
+    for(std::size_t i = 0; i != dataSize; ++i) {
+        const Containers::StridedArrayView1D<T> entry = data[i];
+        if(!isFinite(entry)) continue;
+        for(std::size_t j = 0; j != vectorSize; ++j) {
+            extents[j].min() = Math::min(extents[j].min(), entry[j]);
+            extents[j].max() = Math::max(extents[j].max(), entry[j]);
+        }
+    }
+
+    /* The grid is built only over three dimensions, as the count of neighbor
+       cells grows exponentially with the dimension count, and the remaining
+       dimensions are then compared directly. Pick the dimensions with the
+       largest extent, so for example vertex data with many items sharing the
+       same position but differing in other attributes get spread over the
+       cells as well. */
+    const std::size_t gridSize = Math::min(vectorSize, std::size_t{3});
+    std::size_t gridDimensions[3]{};
+    T offsets[3]{};
+    T range = T(0.0);
+    for(std::size_t i = 0; i != gridSize; ++i) {
+        std::size_t largest = ~std::size_t{};
+        for(std::size_t j = 0; j != vectorSize; ++j) {
+            if((i > 0 && gridDimensions[0] == j) || (i > 1 && gridDimensions[1] == j))
+                continue;
+            if(largest == ~std::size_t{} || extents[j].size() > extents[largest].size())
+                largest = j;
+        }
+        gridDimensions[i] = largest;
+        /* If there are no finite items at all, the extents stay inverted,
+           which doesn't matter as the grid isn't used in that case */
+        offsets[i] = extents[largest].min();
+        range = Math::max(extents[largest].size(), range);
+    }
+
+    /* Make the cells slightly larger than epsilon so rounding errors don't
+       cause items that are epsilon apart to end up two cells apart, and large
+       enough that the cell coordinates don't overflow */
+    const T cellSize = Math::max(epsilon*T(1.001), range/T(1ull << 60));
+    const auto cellCoordinate = [&](const T value, const std::size_t dimension) -> Long {
+        if(cellSize == T(0.0)) return 0;
+        return Long(Math::floor((value - offsets[dimension])/cellSize));
+    };
+
+    /* There's at most as many cells as there are unique items, reserving as
+       if each item was unique */
+    Containers::Array<GridCell> cells{ValueInit, tableCapacity(dataSize)};
+    Containers::Array<UnsignedInt> previousInCell{NoInit, dataSize};
+    std::size_t neighborCount = 1;
+    for(std::size_t i = 0; i != gridSize; ++i) neighborCount *= 3;
+
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != dataSize; ++i) {
+        const Containers::StridedArrayView1D<T> entry = data[i];
+
+        /* Non-finite items are always unique, put them to the unique prefix
+           without adding them to the grid */
+        if(!isFinite(entry)) {
+            if(i != count)
+                Utility::copy(entry, data[count]);
+            indices[i] = UnsignedInt(count);
+            ++count;
+            continue;
+        }
+
+        Long coordinates[3]{};
+        for(std::size_t j = 0; j != gridSize; ++j)
+            coordinates[j] = cellCoordinate(entry[gridDimensions[j]], j);
+
+        /* Go through all unique items in this and all neighbor cells and pick
+           the earliest one that's within epsilon in all dimensions. Unique
+           items are never within epsilon of each other, so unless the data
+           differ mostly in dimensions that aren't a part of the grid, there's
+           just a handful of candidates in each cell. Picking the earliest
+           makes the result independent of the order in which the candidates
+           are visited. */
+        UnsignedInt found = ~UnsignedInt{};
+        for(std::size_t neighbor = 0; neighbor != neighborCount; ++neighbor) {
+            Long neighborCoordinates[3]{};
+            for(std::size_t j = 0, digits = neighbor; j != gridSize; ++j, digits /= 3)
+                neighborCoordinates[j] = coordinates[j] + Long(digits % 3) - 1;
+
+            for(UnsignedInt candidate = findCell(cells, neighborCoordinates).last; candidate; candidate = previousInCell[candidate - 1]) {
+                if(candidate - 1 >= found) continue;
+
+                const Containers::StridedArrayView1D<T> unique = data[candidate - 1];
+                bool close = true;
+                for(std::size_t j = 0; j != vectorSize; ++j) {
+                    if(Math::abs(entry[j] - unique[j]) > epsilon) {
+                        close = false;
+                        break;
+                    }
+                }
+                if(close) found = candidate - 1;
+            }
+        }
+
+        if(found != ~UnsignedInt{}) {
+            indices[i] = found;
+            continue;
+        }
+
+        /* Otherwise it's a new unique item. Copy it to the unique prefix,
+           data in [count, i) are already present in the [0, count) range from
+           previous iterations so we aren't overwriting anything. */
+        if(i != count)
+            Utility::copy(entry, data[count]);
+        GridCell& cell = findCell(cells, coordinates);
+        for(std::size_t j = 0; j != 3; ++j)
+            cell.coordinates[j] = coordinates[j];
+        previousInCell[count] = cell.last;
+        cell.last = UnsignedInt(count + 1);
+        indices[i] = UnsignedInt(count);
+        ++count;
+    }
+
+    return count;
+}
+
+template<class T> Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyGridInPlaceImplementation(const Containers::StridedArrayView2D<T>& data, const T epsilon) {
+    Containers::Array<UnsignedInt> indices{NoInit, data.size()[0]};
+    const std::size_t size = removeDuplicatesFuzzyGridInPlaceIntoImplementation(data, indices, epsilon);
+    return {Utility::move(indices), size};
+}
+
+}
+
+Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyGridInPlace(const Containers::StridedArrayView2D<Float>& data, const Float epsilon) {
+    return removeDuplicatesFuzzyGridInPlaceImplementation(data, epsilon);
+}
+
+Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyGridInPlace(const Containers::StridedArrayView2D<Double>& data, const Double epsilon) {
+    return removeDuplicatesFuzzyGridInPlaceImplementation(data, epsilon);
+}
+
+std::size_t removeDuplicatesFuzzyGridInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Float epsilon) {
+    return removeDuplicatesFuzzyGridInPlaceIntoImplementation(data, indices, epsilon);
+}
+
+std::size_t removeDuplicatesFuzzyGridInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, const Double epsilon) {
+    return removeDuplicatesFuzzyGridInPlaceIntoImplementation(data, indices, epsilon);
+}
+
+namespace {
+
 template<class T> std::size_t removeDuplicatesFuzzyIndexedInPlaceImplementation(const Containers::StridedArrayView2D<char>& indices, const Containers::StridedArrayView2D<T>& data, const T epsilon) {
     CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): second index view dimension is not contiguous", {});
     if(indices.size()[1] == 4)
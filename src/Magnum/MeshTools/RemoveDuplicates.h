@@ -32,6 +32,7 @@
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/TypeTraits.h"
+#include "Magnum/MeshTools/Parallel.h"
 #include "Magnum/MeshTools/visibility.h"
 #include "Magnum/Trade/Trade.h"
 
@@ -72,6 +73,18 @@ an index array pointing to original data locations.
 */
 MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>& data);
 
+/**
+@brief Remove duplicate data from given array in-place in parallel
+@m_since_latest
+
+Same as @ref removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>&),
+but with the hashing executed through @p parallelFor, to which
+@p parallelForState is passed. See
+@ref removeDuplicatesInto(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView1D<UnsignedInt>&, ParallelFor, void*)
+for more information.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>& data, ParallelFor parallelFor, void* parallelForState);
+
 /**
 @brief Remove duplicate data from given array in-place into given output index array
 @param[in,out] data     Data array, duplicate items will be cut away with order
@@ -86,6 +99,19 @@ Same as above, except that the index array is not allocated but put into
 */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices);
 
+/**
+@brief Remove duplicate data from given array in-place into given output index array in parallel
+@m_since_latest
+
+Same as @ref removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>&, const Containers::StridedArrayView1D<UnsignedInt>&),
+but with the hashing executed through @p parallelFor, to which
+@p parallelForState is passed. The unique items are compacted to the front of
+@p data in a serial pass afterwards. See
+@ref removeDuplicatesInto(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView1D<UnsignedInt>&, ParallelFor, void*)
+for more information.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInPlaceInto(const Containers::StridedArrayView2D<char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, ParallelFor parallelFor, void* parallelForState);
+
 /**
 @brief Remove duplicate data from given array
 @param[in] data     Data array
@@ -99,6 +125,18 @@ returns an index array pointing to original data locations.
 */
 MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(const Containers::StridedArrayView2D<const char>& data);
 
+/**
+@brief Remove duplicate data from given array in parallel
+@m_since_latest
+
+Same as @ref removeDuplicates(const Containers::StridedArrayView2D<const char>&),
+but with the hashing executed through @p parallelFor, to which
+@p parallelForState is passed. See
+@ref removeDuplicatesInto(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView1D<UnsignedInt>&, ParallelFor, void*)
+for more information.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicates(const Containers::StridedArrayView2D<const char>& data, ParallelFor parallelFor, void* parallelForState);
+
 /**
 @brief Remove duplicate data from given array into given output index array
 @param[in]  data    Data array
@@ -112,6 +150,23 @@ makes an index array pointing to original data locations.
 */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices);
 
+/**
+@brief Remove duplicate data from given array into given output index array in parallel
+@m_since_latest
+
+Same as @ref removeDuplicatesInto(const Containers::StridedArrayView2D<const char>&, const Containers::StridedArrayView1D<UnsignedInt>&),
+but with the data split into chunks of 65536 items that are hashed and
+deduplicated against each other through @p parallelFor, to which
+@p parallelForState is passed. The chunks are then merged into a single
+table on the calling thread, which only has to look up the first occurrence
+within each chunk. The result is the same as with the serial variant,
+regardless of the order in which the chunks were processed. Compared to the
+serial variant, this function additionally allocates an array of 64-bit
+hashes for all items and a table for every chunk.
+@see @ref ParallelFor, @ref parallelForSerial()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesInto(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, ParallelFor parallelFor, void* parallelForState);
+
 /**
 @brief Remove duplicates from indexed data in-place
 @param[in,out] indices  Index array, which will get remapped to list just
@@ -167,6 +222,12 @@ floating-point data (or generally with non-zero @p epsilon), for data where
 bit-exact matching is sufficient use @ref removeDuplicatesInPlace(const Containers::StridedArrayView2D<char>&)
 instead.
 
+As items close to each other can end up in different buckets, the result
+isn't guaranteed to have an item collapsed even if there's a unique item
+within @p epsilon. Use
+@ref removeDuplicatesFuzzyGridInPlace(const Containers::StridedArrayView2D<Float>&, Float)
+if you need such a guarantee.
+
 If you want to remove duplicate data from an already indexed array, use
 @ref removeDuplicatesFuzzyIndexedInPlace(const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView2D<Float>&, Float)
 and friends instead.
@@ -204,6 +265,73 @@ MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Conta
  */
 MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Double epsilon = Math::TypeTraits<Double>::epsilon());
 
+/**
+@brief Remove duplicate data from given array using a spatial grid in-place
+@param[in,out] data Data array, duplicate items will be cut away with order
+    preserved
+@param[in] epsilon  Epsilon value, data closer than this distance in every
+    dimension will be melt together
+@return The resulting index array and size of unique prefix in the cleaned up
+    @p data array
+@m_since_latest
+
+Compared to @ref removeDuplicatesFuzzyInPlace(const Containers::StridedArrayView2D<Float>&, Float),
+which collapses the data into discrete buckets and thus can miss items that
+are close to each other but on the opposite sides of a bucket boundary, this
+function guarantees that each item is at most @p epsilon away in every
+dimension from the unique item it got replaced with, and that no two unique
+items are within @p epsilon of each other. The items are processed in order
+and each is replaced with the earliest unique item close enough to it, if
+there's any, no interpolation is done.
+
+Note that this doesn't mean all items within @p epsilon of each other get
+collapsed together. Closeness isn't transitive --- if an item @f$ b @f$ is
+close to both @f$ a @f$ and @f$ c @f$ but @f$ a @f$ isn't close to
+@f$ c @f$, the result depends on the order of the items. With @f$ a, b, c @f$
+the item @f$ b @f$ gets collapsed to @f$ a @f$ and @f$ c @f$ stays unique,
+while with @f$ b, a, c @f$ both @f$ a @f$ and @f$ c @f$ get collapsed to
+@f$ b @f$.
+
+The lookup uses a hash grid with cells of size @p epsilon over the three
+dimensions with the largest extent, checking all neighboring cells, with the
+remaining dimensions compared directly. The time complexity is linear in the
+item count as long as the unique items are spread out in those three
+dimensions. In the worst case, when many unique items are within @p epsilon
+of each other in the three grid dimensions and differ only in the remaining
+ones, they all fall into the same cell and it degrades to quadratic. Items containing NaNs or infinities are
+never close to anything, so they're always kept as unique and excluded from
+the grid. The function allocates a table for the grid cells and an
+additional index array. Expects that @p epsilon isn't negative.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyGridInPlace(const Containers::StridedArrayView2D<Float>& data, Float epsilon = Math::TypeTraits<Float>::epsilon());
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> removeDuplicatesFuzzyGridInPlace(const Containers::StridedArrayView2D<Double>& data, Double epsilon = Math::TypeTraits<Double>::epsilon());
+
+/**
+@brief Remove duplicate data from given array using a spatial grid in-place into given output index array
+@param[in,out] data Data array, duplicate items will be cut away with order
+    preserved
+@param[out] indices Where to put the resulting index array
+@param[in] epsilon  Epsilon value, data closer than this distance in every
+    dimension will be melt together
+@return Size of unique prefix in the cleaned up @p data array
+@m_since_latest
+
+Same as above, except that the index array is not allocated but put into
+@p indices instead. Expects that @p indices has the same size as @p data.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyGridInPlaceInto(const Containers::StridedArrayView2D<Float>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Float epsilon = Math::TypeTraits<Float>::epsilon());
+
+/**
+ * @overload
+ * @m_since_latest
+ */
+MAGNUM_MESHTOOLS_EXPORT std::size_t removeDuplicatesFuzzyGridInPlaceInto(const Containers::StridedArrayView2D<Double>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices, Double epsilon = Math::TypeTraits<Double>::epsilon());
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /**
 @brief Remove duplicate data from a STL vector using fuzzy comparison in-place
@@ -0,0 +1,417 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Simplify.h"
+
+#include <algorithm>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/MeshTools/Concatenate.h"
+#include "Magnum/MeshTools/GenerateIndices.h"
+#include "Magnum/MeshTools/Optimize.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Symmetric 3x3 matrix A, vector b and scalar c of the quadric
+   p^T A p + 2 b^T p + c, together with the accumulated weight */
+struct Quadric {
+    Float a00, a11, a22, a10, a20, a21;
+    Float b0, b1, b2;
+    Float c;
+    Float w;
+};
+
+Quadric planeQuadric(const Vector3& normal, const Float d, const Float w) {
+    return {
+        w*normal.x()*normal.x(), w*normal.y()*normal.y(), w*normal.z()*normal.z(),
+        w*normal.y()*normal.x(), w*normal.z()*normal.x(), w*normal.z()*normal.y(),
+        w*d*normal.x(), w*d*normal.y(), w*d*normal.z(),
+        w*d*d,
+        w
+    };
+}
+
+void addQuadric(Quadric& a, const Quadric& b) {
+    a.a00 += b.a00;
+    a.a11 += b.a11;
+    a.a22 += b.a22;
+    a.a10 += b.a10;
+    a.a20 += b.a20;
+    a.a21 += b.a21;
+    a.b0 += b.b0;
+    a.b1 += b.b1;
+    a.b2 += b.b2;
+    a.c += b.c;
+    a.w += b.w;
+}
+
+/* Weighted average of squared distances of p from the planes accumulated in
+   the quadric */
+Float quadricError(const Quadric& q, const Vector3& p) {
+    const Float rx = q.a00*p.x() + q.a10*p.y() + q.a20*p.z() + q.b0;
+    const Float ry = q.a10*p.x() + q.a11*p.y() + q.a21*p.z() + q.b1;
+    const Float rz = q.a20*p.x() + q.a21*p.y() + q.a22*p.z() + q.b2;
+    const Float r = rx*p.x() + ry*p.y() + rz*p.z() +
+        q.b0*p.x() + q.b1*p.y() + q.b2*p.z() + q.c;
+    return q.w == 0.0f ? 0.0f : Math::abs(r)/q.w;
+}
+
+/* Collapse of vertex `from` onto vertex `to` */
+struct Collapse {
+    UnsignedInt from, to;
+    Float error;
+};
+
+/* Fills `offsets` and `triangles` so that triangles referencing a canonical
+   vertex `i` are `triangles[offsets[i]]` to `triangles[offsets[i + 1]]` */
+void buildAdjacency(const Containers::ArrayView<const UnsignedInt> indices, const Containers::ArrayView<const UnsignedInt> canonical, const Containers::ArrayView<UnsignedInt> offsets, const Containers::ArrayView<UnsignedInt> triangles) {
+    for(UnsignedInt& i: offsets) i = 0;
+    for(const UnsignedInt index: indices)
+        ++offsets[canonical[index] + 1];
+    for(std::size_t i = 1; i != offsets.size(); ++i)
+        offsets[i] += offsets[i - 1];
+
+    /* Fill the triangles, advancing the offsets by one vertex forward in the
+       process, then shift them back */
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        triangles[offsets[canonical[indices[i]]]++] = i/3;
+    for(std::size_t i = offsets.size() - 1; i != 0; --i)
+        offsets[i] = offsets[i - 1];
+    offsets[0] = 0;
+}
+
+}
+
+Containers::Array<UnsignedInt> simplify(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const UnsignedInt targetIndexCount, const Float targetError) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::simplify(): index count not divisible by 3, got" << indices.size(), {});
+
+    const std::size_t vertexCount = positions.size();
+
+    /* Vertices at the same position get the same canonical vertex, which is
+       the first of them. The topology is then tracked on canonical vertices,
+       while the output references the original ones. */
+    Containers::Array<UnsignedInt> canonical{NoInit, vertexCount};
+    removeDuplicatesInto(Containers::arrayCast<2, const char>(positions), canonical);
+
+    /* Copy the indices, dropping triangles that are degenerate already */
+    Containers::Array<UnsignedInt> result{NoInit, indices.size()};
+    std::size_t indexCount = 0;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        for(std::size_t j = 0; j != 3; ++j)
+            CORRADE_ASSERT(indices[i + j] < vertexCount,
+                "MeshTools::simplify(): index" << indices[i + j] << "out of range for" << vertexCount << "vertices", {});
+
+        const UnsignedInt a = canonical[indices[i + 0]];
+        const UnsignedInt b = canonical[indices[i + 1]];
+        const UnsignedInt c = canonical[indices[i + 2]];
+        if(a == b || a == c || b == c) continue;
+
+        for(std::size_t j = 0; j != 3; ++j)
+            result[indexCount++] = indices[i + j];
+    }
+
+    /* Positions normalized to the largest bounding box dimension, so the
+       error is relative to the mesh size */
+    const Containers::Pair<Vector3, Vector3> minmax = Math::minmax(positions);
+    const Float size = (minmax.second() - minmax.first()).max();
+    const Float scale = size > 0.0f ? 1.0f/size : 1.0f;
+    Containers::Array<Vector3> normalized{NoInit, vertexCount};
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        normalized[i] = (positions[i] - minmax.first())*scale;
+
+    Containers::Array<UnsignedInt> adjacencyOffsets{NoInit, vertexCount + 1};
+    Containers::Array<UnsignedInt> adjacency{NoInit, indexCount};
+    buildAdjacency(result.prefix(indexCount), canonical, adjacencyOffsets, adjacency);
+
+    /* Vertices sharing a position with other vertices are on an attribute
+       seam and thus can't be moved. The same goes for vertices on a border
+       or on a non-manifold edge, which is where a neighbor vertex is shared
+       by other than exactly two triangles around. */
+    Containers::BitArray locked{ValueInit, vertexCount};
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        if(canonical[i] != i) locked.set(canonical[i]);
+    Containers::Array<UnsignedInt> mark{DirectInit, vertexCount, ~UnsignedInt{}};
+    {
+        Containers::Array<UnsignedInt> neighborTriangleCount{NoInit, vertexCount};
+        for(UnsignedInt i = 0; i != vertexCount; ++i) {
+            if(canonical[i] != i || locked[i]) continue;
+
+            const Containers::ArrayView<const UnsignedInt> triangles = adjacency.slice(adjacencyOffsets[i], adjacencyOffsets[i + 1]);
+            for(const UnsignedInt triangle: triangles) {
+                for(std::size_t j = 0; j != 3; ++j) {
+                    const UnsignedInt neighbor = canonical[result[triangle*3 + j]];
+                    if(neighbor == i) continue;
+                    if(mark[neighbor] != i) {
+                        mark[neighbor] = i;
+                        neighborTriangleCount[neighbor] = 0;
+                    }
+                    ++neighborTriangleCount[neighbor];
+                }
+            }
+            for(const UnsignedInt triangle: triangles) {
+                for(std::size_t j = 0; j != 3; ++j) {
+                    const UnsignedInt neighbor = canonical[result[triangle*3 + j]];
+                    if(neighbor != i && neighborTriangleCount[neighbor] != 2)
+                        locked.set(i);
+                }
+            }
+        }
+    }
+
+    /* Area-weighted quadrics of planes of all triangles around each canonical
+       vertex */
+    Containers::Array<Quadric> quadrics{ValueInit, vertexCount};
+    for(std::size_t i = 0; i != indexCount; i += 3) {
+        const Vector3 a = normalized[result[i + 0]];
+        const Vector3 normal = Math::cross(normalized[result[i + 1]] - a, normalized[result[i + 2]] - a);
+        const Float length = normal.length();
+        if(length == 0.0f) continue;
+
+        const Quadric quadric = planeQuadric(normal/length, -Math::dot(normal, a)/length, length*0.5f);
+        for(std::size_t j = 0; j != 3; ++j)
+            addQuadric(quadrics[canonical[result[i + j]]], quadric);
+    }
+
+    /* Each pass gathers all possible collapses, sorts them by the error and
+       performs as many of them as possible, skipping ones which would touch
+       triangles that were already modified in this pass. The adjacency and
+       the collapse errors are then recalculated for the next pass. */
+    const Float maxError = targetError*targetError;
+    Containers::Array<Collapse> collapses{NoInit, indexCount*2};
+    Containers::BitArray touched{NoInit, vertexCount};
+    Containers::BitArray removed{NoInit, indexCount/3};
+    UnsignedInt stamp = 0;
+    while(indexCount > targetIndexCount) {
+        std::size_t collapseCount = 0;
+        for(std::size_t i = 0; i != indexCount; i += 3) {
+            for(std::size_t j = 0; j != 3; ++j) {
+                const UnsignedInt edge[2]{result[i + j], result[i + (j + 1) % 3]};
+                for(std::size_t k = 0; k != 2; ++k) {
+                    const UnsignedInt from = edge[k], to = edge[k ^ 1];
+                    /* A vertex that isn't locked is its own canonical
+                       vertex, as there's no other vertex at the same
+                       position */
+                    if(locked[canonical[from]]) continue;
+
+                    Quadric quadric = quadrics[from];
+                    addQuadric(quadric, quadrics[canonical[to]]);
+                    collapses[collapseCount++] = {from, to, quadricError(quadric, normalized[to])};
+                }
+            }
+        }
+
+        std::sort(collapses.begin(), collapses.begin() + collapseCount, [](const Collapse& a, const Collapse& b) {
+            return a.error < b.error;
+        });
+
+        touched.resetAll();
+        removed.resetAll();
+        std::size_t remainingIndexCount = indexCount;
+        std::size_t collapsedCount = 0;
+        for(std::size_t i = 0; i != collapseCount && remainingIndexCount > targetIndexCount; ++i) {
+            const Collapse& collapse = collapses[i];
+            if(collapse.error > maxError) break;
+
+            const UnsignedInt from = collapse.from;
+            const UnsignedInt to = canonical[collapse.to];
+            if(touched[from] || touched[to]) continue;
+
+            const Containers::ArrayView<const UnsignedInt> fromTriangles = adjacency.slice(adjacencyOffsets[from], adjacencyOffsets[from + 1]);
+            const Containers::ArrayView<const UnsignedInt> toTriangles = adjacency.slice(adjacencyOffsets[to], adjacencyOffsets[to + 1]);
+
+            /* The vertices can have only the two vertices opposite to the
+               collapsed edge as common neighbors, otherwise the collapse
+               would make the topology non-manifold */
+            stamp += 2;
+            for(const UnsignedInt triangle: fromTriangles)
+                for(std::size_t j = 0; j != 3; ++j)
+                    mark[canonical[result[triangle*3 + j]]] = stamp;
+            std::size_t commonNeighborCount = 0;
+            for(const UnsignedInt triangle: toTriangles) {
+                for(std::size_t j = 0; j != 3; ++j) {
+                    const UnsignedInt neighbor = canonical[result[triangle*3 + j]];
+                    if(neighbor == to || neighbor == from || mark[neighbor] != stamp) continue;
+                    mark[neighbor] = stamp + 1;
+                    ++commonNeighborCount;
+                }
+            }
+            if(commonNeighborCount != 2) continue;
+
+            /* Triangles that stay shouldn't flip or become degenerate, and
+               triangles that get removed should all refer to the same
+               vertex on a seam, otherwise moving the remaining ones to it
+               would break the seam */
+            bool valid = true;
+            for(const UnsignedInt triangle: fromTriangles) {
+                const UnsignedInt* const t = result.data() + triangle*3;
+                const std::size_t k = t[0] == from ? 0 : t[1] == from ? 1 : 2;
+                const UnsignedInt b = t[(k + 1) % 3];
+                const UnsignedInt c = t[(k + 2) % 3];
+                if(canonical[b] == to || canonical[c] == to) {
+                    if((canonical[b] == to && b != collapse.to) ||
+                       (canonical[c] == to && c != collapse.to)) {
+                        valid = false;
+                        break;
+                    }
+                    continue;
+                }
+
+                const Vector3 normal = Math::cross(normalized[b] - normalized[from], normalized[c] - normalized[from]);
+                const Vector3 collapsedNormal = Math::cross(normalized[b] - normalized[to], normalized[c] - normalized[to]);
+                if(Math::dot(normal, collapsedNormal) <= 0.0f) {
+                    valid = false;
+                    break;
+                }
+            }
+            if(!valid) continue;
+
+            /* Perform the collapse, marking all affected vertices as touched
+               and removing the triangles that became degenerate */
+            for(const UnsignedInt triangle: fromTriangles) {
+                UnsignedInt* const t = result.data() + triangle*3;
+                bool degenerate = false;
+                for(std::size_t j = 0; j != 3; ++j) {
+                    const UnsignedInt vertex = canonical[t[j]];
+                    touched.set(vertex);
+                    if(vertex == to) degenerate = true;
+                }
+
+                if(degenerate) {
+                    removed.set(triangle);
+                    remainingIndexCount -= 3;
+                } else for(std::size_t j = 0; j != 3; ++j) {
+                    if(t[j] == from) t[j] = collapse.to;
+                }
+            }
+            addQuadric(quadrics[to], quadrics[from]);
+            ++collapsedCount;
+        }
+
+        /* Nothing more to collapse within the error limit */
+        if(!collapsedCount) break;
+
+        /* Compact the index buffer and update the adjacency for the next
+           pass */
+        std::size_t newIndexCount = 0;
+        for(std::size_t i = 0; i != indexCount/3; ++i) {
+            if(removed[i]) continue;
+            for(std::size_t j = 0; j != 3; ++j)
+                result[newIndexCount++] = result[i*3 + j];
+        }
+        CORRADE_INTERNAL_ASSERT(newIndexCount == remainingIndexCount);
+        indexCount = newIndexCount;
+        buildAdjacency(result.prefix(indexCount), canonical, adjacencyOffsets, adjacency.prefix(indexCount));
+    }
+
+    Containers::Array<UnsignedInt> out{NoInit, indexCount};
+    Utility::copy(result.prefix(indexCount), out);
+    return out;
+}
+
+namespace {
+
+#ifndef CORRADE_NO_ASSERT
+bool checkMesh(const Trade::MeshData& mesh, const char* const assertPrefix) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        assertPrefix << "expected a triangle mesh, got" << mesh.primitive(), false);
+    CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+        assertPrefix << "the mesh has no positions", false);
+    CORRADE_ASSERT(!mesh.isIndexed() || !isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+        assertPrefix << "mesh has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), false);
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const VertexFormat format = mesh.attributeFormat(i);
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            assertPrefix << "attribute" << i << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format), false);
+    }
+    return true;
+}
+#endif
+
+Containers::Array<UnsignedInt> meshIndices(const Trade::MeshData& mesh) {
+    return mesh.isIndexed() ?
+        mesh.indicesAsArray() : generateTrivialIndices(mesh.vertexCount());
+}
+
+/* Creates a mesh with only the vertices referenced by `indices`, in order of
+   their first use */
+Trade::MeshData compactMesh(const Trade::MeshData& mesh, const Containers::ArrayView<const UnsignedInt> indices) {
+    return optimizeVertexFetch(Trade::MeshData{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, mesh.vertexData(), Trade::meshAttributeDataNonOwningArray(mesh.attributeData()),
+        mesh.vertexCount()});
+}
+
+}
+
+Trade::MeshData simplify(const Trade::MeshData& mesh, const UnsignedInt targetIndexCount, const Float targetError) {
+    #ifndef CORRADE_NO_ASSERT
+    if(!checkMesh(mesh, "MeshTools::simplify():"))
+        return Trade::MeshData{MeshPrimitive::Triangles, 0};
+    #endif
+
+    return compactMesh(mesh, simplify(meshIndices(mesh), mesh.positions3DAsArray(), targetIndexCount, targetError));
+}
+
+Containers::Pair<Trade::MeshData, Containers::Array<UnsignedInt>> generateLodChain(const Trade::MeshData& mesh, const UnsignedInt levelCount, const Float ratio, const Float targetError) {
+    #ifndef CORRADE_NO_ASSERT
+    if(!checkMesh(mesh, "MeshTools::generateLodChain():"))
+        return {Trade::MeshData{MeshPrimitive::Triangles, 0}, {}};
+    #endif
+    CORRADE_ASSERT(levelCount,
+        "MeshTools::generateLodChain(): expected at least one level",
+        (Containers::Pair<Trade::MeshData, Containers::Array<UnsignedInt>>{Trade::MeshData{MeshPrimitive::Triangles, 0}, {}}));
+    CORRADE_ASSERT(ratio > 0.0f && ratio <= 1.0f,
+        "MeshTools::generateLodChain(): expected ratio to be greater than 0 and at most 1, got" << ratio,
+        (Containers::Pair<Trade::MeshData, Containers::Array<UnsignedInt>>{Trade::MeshData{MeshPrimitive::Triangles, 0}, {}}));
+
+    const Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    Containers::Array<UnsignedInt> indices = meshIndices(mesh);
+
+    /* Each level is simplified from the previous one */
+    Containers::Array<Trade::MeshData> levels;
+    arrayReserve(levels, levelCount);
+    Containers::Array<UnsignedInt> offsets{NoInit, levelCount + 1};
+    offsets[0] = 0;
+    for(UnsignedInt i = 0; i != levelCount; ++i) {
+        if(i) indices = simplify(indices, positions, UnsignedInt(indices.size()*ratio)/3*3, targetError);
+        offsets[i + 1] = offsets[i] + indices.size();
+        arrayAppend(levels, compactMesh(mesh, indices));
+    }
+
+    return {concatenate(levels), Utility::move(offsets)};
+}
+
+}}
@@ -0,0 +1,126 @@
+#ifndef Magnum_MeshTools_Simplify_h
+#define Magnum_MeshTools_Simplify_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::simplify(), @ref Magnum::MeshTools::generateLodChain()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Simplify an indexed triangle mesh
+@param indices          Triangle indices
+@param positions        Vertex positions
+@param targetIndexCount Index count to reduce the mesh to
+@param targetError      Max error relative to the mesh size
+@return Indices of the simplified mesh, referencing the original vertices
+@m_since_latest
+
+Repeatedly collapses edges in the order of the smallest error calculated from
+area-weighted quadric error metrics, until the index count is at or below
+@p targetIndexCount, or until no edge can be collapsed without the error
+exceeding @p targetError. The error is a distance relative to the largest
+dimension of the mesh bounding box, so for example @cpp 0.01f @ce allows the
+surface to deviate by at most roughly 1% of the mesh size. Collapses that would
+flip a triangle or make the topology non-manifold are skipped.
+
+Each collapse moves one vertex onto another existing vertex, so the returned
+indices reference a subset of the original vertices and no vertex data need to
+be modified. Vertices that share a position with another vertex, such as ones
+on texture coordinate or normal seams, vertices on mesh borders and vertices
+on non-manifold edges are never moved, which preserves attribute seams and
+mesh outlines at the cost of limiting how much can such meshes be simplified.
+For non-indexed meshes or meshes with duplicate vertices, use
+@ref removeDuplicates() first, as otherwise each vertex would be treated as
+lying on a seam. Degenerate triangles are removed from the output.
+
+Expects that @p indices size is divisible by @cpp 3 @ce and all indices are in
+bounds for @p positions.
+@see @ref generateLodChain()
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> simplify(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt targetIndexCount, Float targetError = 0.01f);
+
+/**
+@brief Simplify a triangle mesh
+@m_since_latest
+
+Takes indices of @p mesh via @ref Trade::MeshData::indicesAsArray(), or
+creates them with @ref generateTrivialIndices() if the mesh is not indexed,
+and positions via @ref Trade::MeshData::positions3DAsArray(). The result is
+passed to @ref simplify(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt, Float).
+The returned mesh has all attributes of the original, with vertices no longer
+referenced by the simplified indices removed and the rest put in order of
+their first use using @ref optimizeVertexFetch(). The index type is always
+@ref MeshIndexType::UnsignedInt, use @ref compressIndices() to compress it to
+a smaller type, if desired.
+
+Expects that the mesh is a @ref MeshPrimitive::Triangles, has a
+@ref Trade::MeshAttribute::Position attribute and no attributes with
+implementation-specific formats.
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData simplify(const Trade::MeshData& mesh, UnsignedInt targetIndexCount, Float targetError = 0.01f);
+
+/**
+@brief Generate a level-of-detail chain of a triangle mesh
+@param mesh         Input mesh
+@param levelCount   Count of levels including the original mesh
+@param ratio        Ratio of index count of each level compared to the
+    previous one
+@param targetError  Max error of each level compared to the previous one,
+    relative to the mesh size
+@return Mesh with all levels concatenated together and an array of
+    @cpp levelCount + 1 @ce index offsets
+@m_since_latest
+
+The first level is the original mesh, each following level is made with
+@ref simplify(const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const Vector3>&, UnsignedInt, Float)
+from indices of the previous level, aiming to have @p ratio times its index
+count. Vertices unused by given level are dropped and the levels are then
+joined together with @ref concatenate(), resulting in a single mesh that can
+be uploaded to the GPU at once. Level @cpp i @ce is drawn with the index range
+from offset @cpp i @ce to offset @cpp i + 1 @ce in the returned array. If a
+level couldn't be simplified any further within @p targetError, it's repeated
+for all remaining levels.
+
+Expects that the mesh satisfies the requirements of
+@ref simplify(const Trade::MeshData&, UnsignedInt, Float), that
+@p levelCount is at least @cpp 1 @ce and @p ratio is greater than
+@cpp 0.0f @ce and less than or equal to @cpp 1.0f @ce.
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Trade::MeshData, Containers::Array<UnsignedInt>> generateLodChain(const Trade::MeshData& mesh, UnsignedInt levelCount, Float ratio = 0.5f, Float targetError = 0.01f);
+
+}}
+
+#endif
@@ -0,0 +1,78 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SoA.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* If the attribute is already in the desired format, deinterleave it directly
+   instead of unpacking to a temporary first. If it's not present at all, the
+   *AsArray() fallback takes care of the assertion. */
+template<class T> Containers::Optional<Containers::StridedArrayView1D<const T>> attributeIfFormat(const Trade::MeshData& mesh, const Trade::MeshAttribute name, const VertexFormat format, const UnsignedInt id, const Int morphTargetId) {
+    const Containers::Optional<UnsignedInt> attributeId = mesh.findAttributeId(name, id, morphTargetId);
+    if(attributeId && mesh.attributeFormat(*attributeId) == format)
+        return mesh.attribute<T>(*attributeId);
+    return {};
+}
+
+}
+
+Vector2SoA positions2DSoA(const Trade::MeshData& mesh, const UnsignedInt id, const Int morphTargetId) {
+    if(const Containers::Optional<Containers::StridedArrayView1D<const Vector2>> positions = attributeIfFormat<Vector2>(mesh, Trade::MeshAttribute::Position, VertexFormat::Vector2, id, morphTargetId))
+        return Vector2SoA{*positions};
+    const Containers::Array<Vector2> unpacked = mesh.positions2DAsArray(id, morphTargetId);
+    return Vector2SoA{unpacked};
+}
+
+Vector3SoA positions3DSoA(const Trade::MeshData& mesh, const UnsignedInt id, const Int morphTargetId) {
+    if(const Containers::Optional<Containers::StridedArrayView1D<const Vector3>> positions = attributeIfFormat<Vector3>(mesh, Trade::MeshAttribute::Position, VertexFormat::Vector3, id, morphTargetId))
+        return Vector3SoA{*positions};
+    const Containers::Array<Vector3> unpacked = mesh.positions3DAsArray(id, morphTargetId);
+    return Vector3SoA{unpacked};
+}
+
+Vector3SoA normalsSoA(const Trade::MeshData& mesh, const UnsignedInt id, const Int morphTargetId) {
+    if(const Containers::Optional<Containers::StridedArrayView1D<const Vector3>> normals = attributeIfFormat<Vector3>(mesh, Trade::MeshAttribute::Normal, VertexFormat::Vector3, id, morphTargetId))
+        return Vector3SoA{*normals};
+    const Containers::Array<Vector3> unpacked = mesh.normalsAsArray(id, morphTargetId);
+    return Vector3SoA{unpacked};
+}
+
+Vector2SoA textureCoordinates2DSoA(const Trade::MeshData& mesh, const UnsignedInt id, const Int morphTargetId) {
+    if(const Containers::Optional<Containers::StridedArrayView1D<const Vector2>> textureCoordinates = attributeIfFormat<Vector2>(mesh, Trade::MeshAttribute::TextureCoordinates, VertexFormat::Vector2, id, morphTargetId))
+        return Vector2SoA{*textureCoordinates};
+    const Containers::Array<Vector2> unpacked = mesh.textureCoordinates2DAsArray(id, morphTargetId);
+    return Vector2SoA{unpacked};
+}
+
+}}
@@ -0,0 +1,108 @@
+#ifndef Magnum_MeshTools_SoA_h
+#define Magnum_MeshTools_SoA_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::positions2DSoA(), @ref Magnum::MeshTools::positions3DSoA(), @ref Magnum::MeshTools::normalsSoA(), @ref Magnum::MeshTools::textureCoordinates2DSoA()
+ * @m_since_latest
+ */
+
+#include "Magnum/Math/VectorSoA.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Structure-of-arrays copy of 2D mesh positions
+@param mesh             Input mesh
+@param id               Position attribute ID
+@param morphTargetId    Morph target ID or @cpp -1 @ce for the base
+    attributes
+@m_since_latest
+
+If the attribute is in @ref VertexFormat::Vector2, it's deinterleaved directly
+into the output, otherwise it's unpacked with
+@ref Trade::MeshData::positions2DAsArray() first. Expectations are the same as
+for @ref Trade::MeshData::positions2DAsArray(). To put the data back, use
+@ref Math::VectorSoA::copyInto() together with
+@ref Trade::MeshData::mutableAttribute().
+@see @ref positions3DSoA()
+*/
+MAGNUM_MESHTOOLS_EXPORT Vector2SoA positions2DSoA(const Trade::MeshData& mesh, UnsignedInt id = 0, Int morphTargetId = -1);
+
+/**
+@brief Structure-of-arrays copy of 3D mesh positions
+@param mesh             Input mesh
+@param id               Position attribute ID
+@param morphTargetId    Morph target ID or @cpp -1 @ce for the base
+    attributes
+@m_since_latest
+
+If the attribute is in @ref VertexFormat::Vector3, it's deinterleaved directly
+into the output, otherwise it's unpacked with
+@ref Trade::MeshData::positions3DAsArray() first. Expectations are the same as
+for @ref Trade::MeshData::positions3DAsArray(). To put the data back, use
+@ref Math::VectorSoA::copyInto() together with
+@ref Trade::MeshData::mutableAttribute().
+@see @ref positions2DSoA()
+*/
+MAGNUM_MESHTOOLS_EXPORT Vector3SoA positions3DSoA(const Trade::MeshData& mesh, UnsignedInt id = 0, Int morphTargetId = -1);
+
+/**
+@brief Structure-of-arrays copy of mesh normals
+@param mesh             Input mesh
+@param id               Normal attribute ID
+@param morphTargetId    Morph target ID or @cpp -1 @ce for the base
+    attributes
+@m_since_latest
+
+If the attribute is in @ref VertexFormat::Vector3, it's deinterleaved directly
+into the output, otherwise it's unpacked with
+@ref Trade::MeshData::normalsAsArray() first. Expectations are the same as for
+@ref Trade::MeshData::normalsAsArray().
+*/
+MAGNUM_MESHTOOLS_EXPORT Vector3SoA normalsSoA(const Trade::MeshData& mesh, UnsignedInt id = 0, Int morphTargetId = -1);
+
+/**
+@brief Structure-of-arrays copy of 2D mesh texture coordinates
+@param mesh             Input mesh
+@param id               Texture coordinate attribute ID
+@param morphTargetId    Morph target ID or @cpp -1 @ce for the base
+    attributes
+@m_since_latest
+
+If the attribute is in @ref VertexFormat::Vector2, it's deinterleaved directly
+into the output, otherwise it's unpacked with
+@ref Trade::MeshData::textureCoordinates2DAsArray() first. Expectations are the
+same as for @ref Trade::MeshData::textureCoordinates2DAsArray().
+*/
+MAGNUM_MESHTOOLS_EXPORT Vector2SoA textureCoordinates2DSoA(const Trade::MeshData& mesh, UnsignedInt id = 0, Int morphTargetId = -1);
+
+}}
+
+#endif
@@ -0,0 +1,673 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <random>
+#include <sstream>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Bvh.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Test/parallelFor.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct BvhTest: TestSuite::Tester {
+    explicit BvhTest();
+
+    void construct();
+    void constructEmpty();
+    void constructSingleTriangle();
+    void constructDegenerate();
+    void constructMove();
+    void constructInvalid();
+
+    void constructMeshData();
+    void constructMeshDataNotIndexed();
+    void constructMeshDataInvalid();
+
+    void constructParallel();
+
+    void castRay();
+    void castRayMiss();
+    void castRayMaxDistance();
+    void closestPoint();
+    void closestPointMaxDistance();
+    void queryEmpty();
+
+    void benchmarkBuild();
+    void benchmarkBuildParallel();
+    void benchmarkCastRay();
+    void benchmarkCastRayBruteForce();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt maxLeafSize;
+} ConstructData[]{
+    {"max leaf size 1", 1},
+    {"max leaf size 4", 4},
+    {"max leaf size 16", 16}
+};
+
+BvhTest::BvhTest() {
+    addInstancedTests({&BvhTest::construct},
+        Containers::arraySize(ConstructData));
+
+    addTests({&BvhTest::constructEmpty,
+              &BvhTest::constructSingleTriangle,
+              &BvhTest::constructDegenerate,
+              &BvhTest::constructMove,
+              &BvhTest::constructInvalid,
+
+              &BvhTest::constructMeshData,
+              &BvhTest::constructMeshDataNotIndexed,
+              &BvhTest::constructMeshDataInvalid,
+
+              &BvhTest::constructParallel});
+
+    addInstancedTests({&BvhTest::castRay,
+                       &BvhTest::closestPoint},
+        Containers::arraySize(ConstructData));
+
+    addTests({&BvhTest::castRayMiss,
+              &BvhTest::castRayMaxDistance,
+              &BvhTest::closestPointMaxDistance,
+              &BvhTest::queryEmpty});
+
+    addBenchmarks({&BvhTest::benchmarkBuild,
+                   &BvhTest::benchmarkBuildParallel,
+                   &BvhTest::benchmarkCastRay,
+                   &BvhTest::benchmarkCastRayBruteForce}, 5);
+}
+
+using Magnum::Test::parallelForReverse;
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+using Magnum::Test::parallelForThreads;
+#endif
+
+/* Verifies that the tree is well-formed -- every triangle is referenced by
+   exactly one leaf, children are contained in parents and positions
+   correspond to the triangle IDs */
+void verifyTree(const Bvh& bvh, const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, UnsignedInt maxLeafSize, bool& ok) {
+    ok = false;
+    const std::size_t triangleCount = indices.size()/3;
+    CORRADE_COMPARE(bvh.triangles().size(), triangleCount);
+    CORRADE_COMPARE(bvh.positions().size(), triangleCount*3);
+    CORRADE_VERIFY(bvh.nodes().size() <= 2*triangleCount - 1);
+
+    Containers::Array<UnsignedInt> triangleUsed{ValueInit, triangleCount};
+    for(UnsignedInt triangle: bvh.triangles()) {
+        CORRADE_VERIFY(triangle < triangleCount);
+        ++triangleUsed[triangle];
+    }
+    for(UnsignedInt i: triangleUsed)
+        CORRADE_COMPARE(i, 1);
+
+    for(std::size_t i = 0; i != bvh.triangles().size(); ++i)
+        for(std::size_t j = 0; j != 3; ++j)
+            CORRADE_COMPARE(bvh.positions()[i*3 + j], positions[indices[bvh.triangles()[i]*3 + j]]);
+
+    /* Walk the tree, checking each node is visited once and each triangle
+       range once */
+    Containers::Array<UnsignedInt> nodeUsed{ValueInit, bvh.nodes().size()};
+    Containers::Array<UnsignedInt> leafTriangleUsed{ValueInit, triangleCount};
+    Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> stack;
+    UnsignedInt depth = 0;
+    arrayAppend(stack, InPlaceInit, 0u, 1u);
+    while(!stack.isEmpty()) {
+        const UnsignedInt id = stack.back().first();
+        const UnsignedInt nodeDepth = stack.back().second();
+        arrayRemoveSuffix(stack);
+        CORRADE_ITERATION(id);
+        CORRADE_VERIFY(id < bvh.nodes().size());
+        ++nodeUsed[id];
+
+        const BvhNode& node = bvh.nodes()[id];
+        if(node.count) {
+            CORRADE_VERIFY(node.offset + node.count <= triangleCount);
+            /* Leaves over the limit are possible only if all centroids are
+               the same, which isn't the case for any data tested here */
+            CORRADE_VERIFY(node.count <= maxLeafSize);
+            Range3D bounds{bvh.positions()[node.offset*3], bvh.positions()[node.offset*3]};
+            for(UnsignedInt i = node.offset; i != node.offset + node.count; ++i) {
+                ++leafTriangleUsed[i];
+                for(std::size_t j = 0; j != 3; ++j) {
+                    const Vector3 position = bvh.positions()[i*3 + j];
+                    bounds = {Math::min(bounds.min(), position),
+                              Math::max(bounds.max(), position)};
+                }
+            }
+            CORRADE_COMPARE(node.bounds, bounds);
+            depth = Math::max(depth, nodeDepth);
+        } else {
+            CORRADE_VERIFY(node.offset + 2 <= bvh.nodes().size());
+            for(UnsignedInt child: {node.offset, node.offset + 1}) {
+                const Range3D& childBounds = bvh.nodes()[child].bounds;
+                CORRADE_VERIFY((childBounds.min() >= node.bounds.min()).all());
+                CORRADE_VERIFY((childBounds.max() <= node.bounds.max()).all());
+                arrayAppend(stack, InPlaceInit, child, nodeDepth + 1);
+            }
+        }
+    }
+    for(UnsignedInt i: nodeUsed)
+        CORRADE_COMPARE(i, 1);
+    for(UnsignedInt i: leafTriangleUsed)
+        CORRADE_COMPARE(i, 1);
+    CORRADE_COMPARE(bvh.depth(), depth);
+    ok = true;
+}
+
+void compareTrees(const Bvh& actual, const Bvh& expected, bool& ok) {
+    ok = false;
+    CORRADE_COMPARE_AS(actual.triangles(), expected.triangles(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(actual.positions(), expected.positions(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(actual.nodes().size(), expected.nodes().size());
+    for(std::size_t i = 0; i != expected.nodes().size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(actual.nodes()[i].bounds, expected.nodes()[i].bounds);
+        CORRADE_COMPARE(actual.nodes()[i].offset, expected.nodes()[i].offset);
+        CORRADE_COMPARE(actual.nodes()[i].count, expected.nodes()[i].count);
+    }
+    CORRADE_COMPARE(actual.depth(), expected.depth());
+    ok = true;
+}
+
+void BvhTest::construct() {
+    auto&& data = ConstructData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData sphere = Primitives::icosphereSolid(3);
+    const Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+    const Containers::StridedArrayView1D<const Vector3> positions = sphere.attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    Bvh bvh{indices, positions, data.maxLeafSize};
+    CORRADE_VERIFY(bvh.nodes().size() > 1);
+    CORRADE_COMPARE(bvh.nodes()[0].bounds, (Range3D{Vector3{-1.0f}, Vector3{1.0f}}));
+
+    bool ok;
+    verifyTree(bvh, indices, positions, data.maxLeafSize, ok);
+    CORRADE_VERIFY(ok);
+}
+
+void BvhTest::constructEmpty() {
+    Bvh bvh{Containers::StridedArrayView1D<const UnsignedInt>{}, Containers::StridedArrayView1D<const Vector3>{}};
+    CORRADE_VERIFY(bvh.nodes().isEmpty());
+    CORRADE_VERIFY(bvh.triangles().isEmpty());
+    CORRADE_VERIFY(bvh.positions().isEmpty());
+    CORRADE_COMPARE(bvh.depth(), 0);
+}
+
+void BvhTest::constructSingleTriangle() {
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 2.0f, 0.0f}
+    };
+    const UnsignedInt indices[]{2, 0, 1};
+
+    Bvh bvh{indices, positions};
+    CORRADE_COMPARE(bvh.nodes().size(), 1);
+    CORRADE_COMPARE(bvh.nodes()[0].bounds, (Range3D{{}, {1.0f, 2.0f, 0.0f}}));
+    CORRADE_COMPARE(bvh.nodes()[0].offset, 0);
+    CORRADE_COMPARE(bvh.nodes()[0].count, 1);
+    CORRADE_COMPARE(bvh.depth(), 1);
+    CORRADE_COMPARE_AS(bvh.triangles(), Containers::arrayView<UnsignedInt>({
+        0
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(bvh.positions(), Containers::arrayView<Vector3>({
+        {0.0f, 2.0f, 0.0f},
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+}
+
+void BvhTest::constructDegenerate() {
+    /* All triangles collapsed to the same point, there's nothing to split
+       spatially so it picks the middle to respect the leaf size */
+    const Vector3 positions[]{
+        {1.0f, 2.0f, 3.0f}
+    };
+    const UnsignedInt indices[3*10]{};
+
+    Bvh bvh{indices, positions, 4};
+    CORRADE_COMPARE(bvh.nodes()[0].bounds, (Range3D{{1.0f, 2.0f, 3.0f}, {1.0f, 2.0f, 3.0f}}));
+
+    UnsignedInt leafTriangles = 0;
+    for(const BvhNode& node: bvh.nodes()) {
+        CORRADE_VERIFY(node.count <= 4);
+        leafTriangles += node.count;
+    }
+    CORRADE_COMPARE(leafTriangles, 10);
+
+    /* A ray through the point doesn't hit anything, the triangles have no
+       area */
+    CORRADE_VERIFY(!bvh.castRay({1.0f, 2.0f, 0.0f}, Vector3::zAxis()));
+
+    /* The closest point is the point itself */
+    Containers::Optional<BvhClosestPoint> closest = bvh.closestPoint({1.0f, 2.0f, 0.0f});
+    CORRADE_VERIFY(closest);
+    CORRADE_COMPARE(closest->distance, 3.0f);
+    CORRADE_COMPARE(closest->point, (Vector3{1.0f, 2.0f, 3.0f}));
+}
+
+void BvhTest::constructMove() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(1);
+    Bvh a{sphere};
+    const BvhNode* nodes = a.nodes().data();
+    const UnsignedInt* triangles = a.triangles().data();
+    const UnsignedInt depth = a.depth();
+
+    Bvh b = Utility::move(a);
+    CORRADE_COMPARE(b.nodes().data(), nodes);
+    CORRADE_COMPARE(b.triangles().data(), triangles);
+    CORRADE_COMPARE(b.depth(), depth);
+    CORRADE_VERIFY(a.nodes().isEmpty());
+
+    Bvh c{Containers::StridedArrayView1D<const UnsignedInt>{}, Containers::StridedArrayView1D<const Vector3>{}};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.nodes().data(), nodes);
+    CORRADE_COMPARE(c.triangles().data(), triangles);
+    CORRADE_COMPARE(c.depth(), depth);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<Bvh>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<Bvh>::value);
+    CORRADE_VERIFY(!std::is_copy_constructible<Bvh>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<Bvh>::value);
+}
+
+void BvhTest::constructInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+    const UnsignedInt indices[]{0, 1, 2, 0, 1, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Bvh{Containers::arrayView(indices).prefix(5), positions};
+    Bvh{indices, positions, 0};
+    Bvh{indices, positions};
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::Bvh: index count not divisible by 3, got 5\n"
+        "MeshTools::Bvh: expected max leaf size to be at least 1\n"
+        "MeshTools::Bvh: index 3 out of range for 3 vertices\n");
+}
+
+void BvhTest::constructMeshData() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(2);
+
+    Bvh bvh{sphere, 2};
+    Bvh expected{sphere.indicesAsArray(), sphere.attribute<Vector3>(Trade::MeshAttribute::Position), 2};
+    CORRADE_COMPARE(bvh.triangles().size(), sphere.indexCount()/3);
+
+    bool ok;
+    compareTrees(bvh, expected, ok);
+    CORRADE_VERIFY(ok);
+}
+
+void BvhTest::constructMeshDataNotIndexed() {
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {5.0f, 0.0f, 0.0f},
+        {6.0f, 0.0f, 0.0f},
+        {5.0f, 1.0f, 0.0f}
+    };
+
+    Bvh bvh{Trade::MeshData{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }}, 1};
+    CORRADE_COMPARE(bvh.triangles().size(), 2);
+    CORRADE_COMPARE(bvh.nodes().size(), 3);
+
+    Containers::Optional<BvhRayHit> hit = bvh.castRay({5.25f, 0.25f, 1.0f}, -Vector3::zAxis());
+    CORRADE_VERIFY(hit);
+    CORRADE_COMPARE(hit->triangle, 1);
+    CORRADE_COMPARE(hit->distance, 1.0f);
+}
+
+void BvhTest::constructMeshDataInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Bvh{Trade::MeshData{MeshPrimitive::Lines, 2}};
+    Bvh{Trade::MeshData{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, Containers::arrayView(positions)}
+    }}};
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::Bvh: expected a triangle primitive, got MeshPrimitive::Lines\n"
+        "MeshTools::Bvh: the mesh has no positions\n");
+}
+
+void BvhTest::constructParallel() {
+    /* 20480 triangles, enough to get split into several subtrees */
+    const Trade::MeshData sphere = Primitives::icosphereSolid(5);
+    const Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+    const Containers::StridedArrayView1D<const Vector3> positions = sphere.attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    CORRADE_COMPARE(indices.size(), 20480*3);
+
+    Bvh expected{indices, positions};
+    bool ok;
+    verifyTree(expected, indices, positions, 4, ok);
+    CORRADE_VERIFY(ok);
+
+    /* The output should be the same as with the serial variant regardless of
+       the execution order */
+    {
+        Bvh reverse{indices, positions, 4, parallelForReverse, nullptr};
+        compareTrees(reverse, expected, ok);
+        CORRADE_VERIFY(ok);
+    }
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    {
+        std::size_t threadCount = 4;
+        Bvh threaded{indices, positions, 4, parallelForThreads, &threadCount};
+        compareTrees(threaded, expected, ok);
+        CORRADE_VERIFY(ok);
+    }
+    #endif
+}
+
+/* Independent brute-force implementations to compare against -- ray-plane
+   intersection with an inside test, and the closest of a plane projection
+   and edge projections */
+Containers::Optional<BvhRayHit> castRayBruteForce(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Vector3& origin, const Vector3& direction) {
+    Containers::Optional<BvhRayHit> out;
+    for(UnsignedInt i = 0; i != indices.size()/3; ++i) {
+        const Vector3 a = positions[indices[i*3 + 0]];
+        const Vector3 b = positions[indices[i*3 + 1]];
+        const Vector3 c = positions[indices[i*3 + 2]];
+        const Vector3 normal = Math::cross(b - a, c - a);
+        const Float denominator = Math::dot(normal, direction);
+        if(denominator == 0.0f) continue;
+        const Float t = Math::dot(normal, a - origin)/denominator;
+        if(t < 0.0f || (out && t >= out->distance)) continue;
+
+        const Vector3 p = origin + direction*t;
+        if(Math::dot(Math::cross(b - a, p - a), normal) < 0.0f ||
+           Math::dot(Math::cross(c - b, p - b), normal) < 0.0f ||
+           Math::dot(Math::cross(a - c, p - c), normal) < 0.0f) continue;
+
+        out = BvhRayHit{i, t, {}};
+    }
+    return out;
+}
+
+Vector3 closestPointOnSegment(const Vector3& p, const Vector3& a, const Vector3& b) {
+    const Vector3 ab = b - a;
+    const Float t = Math::clamp(Math::dot(p - a, ab)/ab.dot(), 0.0f, 1.0f);
+    return a + ab*t;
+}
+
+Float closestPointBruteForce(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<const Vector3>& positions, const Vector3& point) {
+    Float out = Constants::inf();
+    for(UnsignedInt i = 0; i != indices.size()/3; ++i) {
+        const Vector3 a = positions[indices[i*3 + 0]];
+        const Vector3 b = positions[indices[i*3 + 1]];
+        const Vector3 c = positions[indices[i*3 + 2]];
+        const Vector3 normal = Math::cross(b - a, c - a).normalized();
+        const Vector3 projected = point - normal*Math::dot(point - a, normal);
+        if(Math::dot(Math::cross(b - a, projected - a), normal) >= 0.0f &&
+           Math::dot(Math::cross(c - b, projected - b), normal) >= 0.0f &&
+           Math::dot(Math::cross(a - c, projected - c), normal) >= 0.0f) {
+            out = Math::min(out, (projected - point).length());
+            continue;
+        }
+
+        out = Math::min({out,
+            (closestPointOnSegment(point, a, b) - point).length(),
+            (closestPointOnSegment(point, b, c) - point).length(),
+            (closestPointOnSegment(point, c, a) - point).length()});
+    }
+    return out;
+}
+
+Vector3 randomUnitVector(std::minstd_rand& random) {
+    std::uniform_real_distribution<Float> distribution{-1.0f, 1.0f};
+    for(;;) {
+        const Vector3 v{distribution(random), distribution(random), distribution(random)};
+        const Float length = v.dot();
+        if(length > 0.01f && length <= 1.0f)
+            return v/Math::sqrt(length);
+    }
+}
+
+void BvhTest::castRay() {
+    auto&& data = ConstructData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData sphere = Primitives::icosphereSolid(3);
+    const Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+    const Containers::StridedArrayView1D<const Vector3> positions = sphere.attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    Bvh bvh{indices, positions, data.maxLeafSize};
+
+    /* Rays from outside aiming at a random point around the center, and
+       rays from inside going in a random direction. All should hit. */
+    std::minstd_rand random;
+    for(std::size_t i = 0; i != 200; ++i) {
+        CORRADE_ITERATION(i);
+
+        Vector3 origin, direction;
+        if(i % 2) {
+            origin = randomUnitVector(random)*3.0f;
+            direction = randomUnitVector(random)*0.5f - origin;
+        } else {
+            origin = randomUnitVector(random)*0.5f;
+            direction = randomUnitVector(random)*2.0f;
+        }
+
+        Containers::Optional<BvhRayHit> expected = castRayBruteForce(indices, positions, origin, direction);
+        CORRADE_VERIFY(expected);
+
+        Containers::Optional<BvhRayHit> hit = bvh.castRay(origin, direction);
+        CORRADE_VERIFY(hit);
+        CORRADE_COMPARE(hit->triangle, expected->triangle);
+        CORRADE_COMPARE(hit->distance, expected->distance);
+        CORRADE_COMPARE(hit->barycentric.sum(), 1.0f);
+
+        const Vector3 a = positions[indices[hit->triangle*3 + 0]];
+        const Vector3 b = positions[indices[hit->triangle*3 + 1]];
+        const Vector3 c = positions[indices[hit->triangle*3 + 2]];
+        CORRADE_COMPARE(a*hit->barycentric[0] + b*hit->barycentric[1] + c*hit->barycentric[2], origin + direction*hit->distance);
+    }
+}
+
+void BvhTest::castRayMiss() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(2);
+    Bvh bvh{sphere};
+
+    /* Pointing away */
+    CORRADE_VERIFY(!bvh.castRay({0.0f, 0.0f, 3.0f}, Vector3::zAxis()));
+
+    /* Passing by */
+    CORRADE_VERIFY(!bvh.castRay({0.0f, 1.5f, 3.0f}, -Vector3::zAxis()));
+
+    /* Going through the bounding box corner but not the sphere */
+    CORRADE_VERIFY(!bvh.castRay({0.95f, 0.95f, 3.0f}, -Vector3::zAxis()));
+}
+
+void BvhTest::castRayMaxDistance() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(2);
+    Bvh bvh{sphere};
+
+    /* Slightly off the pole vertex to not hit exactly an edge. The sphere is
+       hit at distance of roughly 2 for a unit direction and roughly 1 for a
+       direction twice as long. */
+    const Vector3 origin{0.01f, 0.02f, 3.0f};
+    Containers::Optional<BvhRayHit> hit = bvh.castRay(origin, -Vector3::zAxis());
+    CORRADE_VERIFY(hit);
+    CORRADE_VERIFY(Math::abs(hit->distance - 2.0f) < 0.01f);
+
+    hit = bvh.castRay(origin, -Vector3::zAxis()*2.0f);
+    CORRADE_VERIFY(hit);
+    CORRADE_VERIFY(Math::abs(hit->distance - 1.0f) < 0.005f);
+
+    CORRADE_VERIFY(!bvh.castRay(origin, -Vector3::zAxis(), 1.9f));
+    CORRADE_VERIFY(bvh.castRay(origin, -Vector3::zAxis(), 2.1f));
+}
+
+void BvhTest::closestPoint() {
+    auto&& data = ConstructData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Trade::MeshData sphere = Primitives::icosphereSolid(3);
+    const Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+    const Containers::StridedArrayView1D<const Vector3> positions = sphere.attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    Bvh bvh{indices, positions, data.maxLeafSize};
+
+    std::minstd_rand random;
+    std::uniform_real_distribution<Float> distance{0.0f, 2.5f};
+    for(std::size_t i = 0; i != 200; ++i) {
+        CORRADE_ITERATION(i);
+
+        const Vector3 point = randomUnitVector(random)*distance(random);
+        Containers::Optional<BvhClosestPoint> closest = bvh.closestPoint(point);
+        CORRADE_VERIFY(closest);
+
+        /* The triangle ID isn't compared as the closest point is often on an
+           edge or a vertex shared by several triangles */
+        CORRADE_COMPARE(closest->distance, closestPointBruteForce(indices, positions, point));
+        CORRADE_COMPARE((closest->point - point).length(), closest->distance);
+
+        /* The point should lie on the reported triangle */
+        const Vector3 a = positions[indices[closest->triangle*3 + 0]];
+        const Vector3 b = positions[indices[closest->triangle*3 + 1]];
+        const Vector3 c = positions[indices[closest->triangle*3 + 2]];
+        CORRADE_VERIFY(Math::abs(Math::dot(closest->point - a, Math::cross(b - a, c - a).normalized())) < 1.0e-5f);
+    }
+}
+
+void BvhTest::closestPointMaxDistance() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(2);
+    Bvh bvh{sphere};
+
+    Containers::Optional<BvhClosestPoint> closest = bvh.closestPoint({0.0f, 0.0f, 3.0f});
+    CORRADE_VERIFY(closest);
+    CORRADE_COMPARE(closest->distance, 2.0f);
+    CORRADE_COMPARE(closest->point, Vector3::zAxis());
+
+    CORRADE_VERIFY(!bvh.closestPoint({0.0f, 0.0f, 3.0f}, 1.9f));
+    CORRADE_VERIFY(bvh.closestPoint({0.0f, 0.0f, 3.0f}, 2.1f));
+
+    /* Outside of the bounding box */
+    CORRADE_VERIFY(!bvh.closestPoint({5.0f, 0.0f, 0.0f}, 3.0f));
+}
+
+void BvhTest::queryEmpty() {
+    Bvh bvh{Containers::StridedArrayView1D<const UnsignedInt>{}, Containers::StridedArrayView1D<const Vector3>{}};
+    CORRADE_VERIFY(!bvh.castRay({}, Vector3::zAxis()));
+    CORRADE_VERIFY(!bvh.closestPoint({}));
+}
+
+void BvhTest::benchmarkBuild() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(7);
+    const Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+    const Containers::StridedArrayView1D<const Vector3> positions = sphere.attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    std::size_t nodeCount = 0;
+    CORRADE_BENCHMARK(1) {
+        Bvh bvh{indices, positions};
+        nodeCount += bvh.nodes().size();
+    }
+
+    CORRADE_VERIFY(nodeCount);
+}
+
+void BvhTest::benchmarkBuildParallel() {
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_SKIP("Threads not used on Emscripten.");
+    #else
+    const Trade::MeshData sphere = Primitives::icosphereSolid(7);
+    const Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+    const Containers::StridedArrayView1D<const Vector3> positions = sphere.attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    std::size_t threadCount = Math::max(std::thread::hardware_concurrency(), 1u);
+    std::size_t nodeCount = 0;
+    CORRADE_BENCHMARK(1) {
+        Bvh bvh{indices, positions, 4, parallelForThreads, &threadCount};
+        nodeCount += bvh.nodes().size();
+    }
+
+    CORRADE_VERIFY(nodeCount);
+    #endif
+}
+
+void BvhTest::benchmarkCastRay() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(5);
+    Bvh bvh{sphere};
+
+    std::minstd_rand random;
+    Float distance = 0.0f;
+    CORRADE_BENCHMARK(1000) {
+        const Vector3 origin = randomUnitVector(random)*3.0f;
+        if(Containers::Optional<BvhRayHit> hit = bvh.castRay(origin, -origin))
+            distance += hit->distance;
+    }
+
+    CORRADE_VERIFY(distance);
+}
+
+void BvhTest::benchmarkCastRayBruteForce() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(5);
+    const Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+    const Containers::StridedArrayView1D<const Vector3> positions = sphere.attribute<Vector3>(Trade::MeshAttribute::Position);
+
+    std::minstd_rand random;
+    Float distance = 0.0f;
+    CORRADE_BENCHMARK(1000) {
+        const Vector3 origin = randomUnitVector(random)*3.0f;
+        if(Containers::Optional<BvhRayHit> hit = castRayBruteForce(indices, positions, origin, -origin))
+            distance += hit->distance;
+    }
+
+    CORRADE_VERIFY(distance);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::BvhTest)
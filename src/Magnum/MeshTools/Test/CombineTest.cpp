@@ -26,13 +26,16 @@
 
 #include <sstream>
 #include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
 #include <Corrade/Utility/DebugStl.h>
 
 #include "Magnum/Math/Color.h"
 #include "Magnum/MeshTools/Combine.h"
+#include "Magnum/Test/parallelFor.h"
 #include "Magnum/Trade/MeshData.h"
 
 namespace Magnum { namespace MeshTools { namespace Test { namespace {
@@ -43,6 +46,7 @@ struct CombineTest: TestSuite::Tester {
     void indexedAttributes();
     void indexedAttributesIndicesOnly();
     void indexedAttributesSingleMesh();
+    void indexedAttributesParallel();
 
     void indexedAttributesNoMeshes();
     void indexedAttributesNotIndexed();
@@ -52,6 +56,7 @@ struct CombineTest: TestSuite::Tester {
     void indexedAttributesImplementationSpecificVertexFormat();
 
     void faceAttributes();
+    void faceAttributesParallel();
     void faceAttributesMeshNotIndexed();
     void faceAttributesUnexpectedPrimitive();
     void faceAttributesUnexpectedFaceCount();
@@ -69,10 +74,13 @@ constexpr struct {
     {"indexed faces", true}
 };
 
+using Magnum::Test::parallelForReverse;
+
 CombineTest::CombineTest() {
     addTests({&CombineTest::indexedAttributes,
               &CombineTest::indexedAttributesIndicesOnly,
               &CombineTest::indexedAttributesSingleMesh,
+              &CombineTest::indexedAttributesParallel,
 
               &CombineTest::indexedAttributesNoMeshes,
               &CombineTest::indexedAttributesNotIndexed,
@@ -81,7 +89,8 @@ CombineTest::CombineTest() {
               &CombineTest::indexedAttributesImplementationSpecificIndexType,
               &CombineTest::indexedAttributesImplementationSpecificVertexFormat});
 
-    addInstancedTests({&CombineTest::faceAttributes},
+    addInstancedTests({&CombineTest::faceAttributes,
+                       &CombineTest::faceAttributesParallel},
         Containers::arraySize(CombineFaceAttributesData));
 
     addTests({&CombineTest::faceAttributesMeshNotIndexed,
@@ -188,6 +197,53 @@ void CombineTest::indexedAttributesSingleMesh() {
         TestSuite::Compare::Container);
 }
 
+void CombineTest::indexedAttributesParallel() {
+    /* Large enough to be split into multiple chunks both in the duplicate
+       removal and in the attribute copy */
+    Containers::Array<UnsignedInt> indicesA{NoInit, 300000};
+    Containers::Array<UnsignedShort> indicesB{NoInit, 300000};
+    for(std::size_t i = 0; i != indicesA.size(); ++i) {
+        indicesA[i] = (i/2*7919) % 1000;
+        indicesB[i] = (i/2*104729) % 499;
+    }
+    Containers::Array<Vector3> positions{NoInit, 1000};
+    for(std::size_t i = 0; i != positions.size(); ++i)
+        positions[i] = Vector3{Float(i)};
+    Containers::Array<Vector2> textureCoordinates{NoInit, 499};
+    for(std::size_t i = 0; i != textureCoordinates.size(); ++i)
+        textureCoordinates[i] = Vector2{-Float(i)};
+
+    Trade::MeshData a{MeshPrimitive::Triangles,
+        {}, Containers::arrayView(indicesA), Trade::MeshIndexData{Containers::stridedArrayView(indicesA)},
+        {}, Containers::arrayView(positions), {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+        }};
+    Trade::MeshData b{MeshPrimitive::Triangles,
+        {}, Containers::arrayView(indicesB), Trade::MeshIndexData{Containers::stridedArrayView(indicesB)},
+        {}, Containers::arrayView(textureCoordinates), {
+            Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, Containers::arrayView(textureCoordinates)}
+        }};
+
+    Trade::MeshData expected = combineIndexedAttributes({a, b});
+    /* Every combination is there exactly twice */
+    CORRADE_COMPARE(expected.vertexCount(), 150000);
+
+    /* The output should be the same as with the serial variant regardless of
+       the execution order */
+    Trade::MeshData result = combineIndexedAttributes({a, b}, parallelForReverse, nullptr);
+    CORRADE_COMPARE(result.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(result.vertexCount(), expected.vertexCount());
+    CORRADE_COMPARE_AS(result.indices<UnsignedInt>(),
+        expected.indices<UnsignedInt>(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(result.attribute<Vector3>(Trade::MeshAttribute::Position),
+        expected.attribute<Vector3>(Trade::MeshAttribute::Position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(result.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+        expected.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+        TestSuite::Compare::Container);
+}
+
 void CombineTest::indexedAttributesNoMeshes() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -410,6 +466,73 @@ void CombineTest::faceAttributes() {
         }), TestSuite::Compare::Container);
 }
 
+void CombineTest::faceAttributesParallel() {
+    auto&& data = CombineFaceAttributesData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* A strip of triangles sharing vertices, with every face having one of
+       37 colors. Large enough to be split into multiple chunks both in the
+       duplicate removal and in the attribute copy. */
+    constexpr std::size_t FaceCount = 100000;
+    Containers::Array<UnsignedInt> indices{NoInit, FaceCount*3};
+    for(std::size_t i = 0; i != FaceCount; ++i) {
+        indices[i*3 + 0] = i;
+        indices[i*3 + 1] = i + 1;
+        indices[i*3 + 2] = i + 2;
+    }
+    Containers::Array<Vector2> positions{NoInit, FaceCount + 2};
+    for(std::size_t i = 0; i != positions.size(); ++i)
+        positions[i] = {Float(i/2), Float(i % 2)};
+
+    Containers::Array<Color3> faceColors{NoInit, FaceCount};
+    for(std::size_t i = 0; i != faceColors.size(); ++i)
+        faceColors[i] = Color3{Float((i*13) % 37)};
+    Containers::Array<UnsignedByte> faceIndices{NoInit, FaceCount};
+    for(std::size_t i = 0; i != faceIndices.size(); ++i)
+        faceIndices[i] = (i*13) % 37;
+    Containers::Array<Color3> faceColorsIndexed{NoInit, 37};
+    for(std::size_t i = 0; i != faceColorsIndexed.size(); ++i)
+        faceColorsIndexed[i] = Color3{Float(i)};
+
+    const Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, Containers::arrayView(indices), Trade::MeshIndexData{Containers::stridedArrayView(indices)},
+        {}, Containers::arrayView(positions), {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                Containers::arrayView(positions)}
+        }};
+    const Trade::MeshData faceAttributes = data.indexed ?
+        Trade::MeshData{MeshPrimitive::Faces,
+            {}, Containers::arrayView(faceIndices), Trade::MeshIndexData{Containers::stridedArrayView(faceIndices)},
+            {}, Containers::arrayView(faceColorsIndexed), {
+                Trade::MeshAttributeData{Trade::MeshAttribute::Color,
+                    Containers::arrayView(faceColorsIndexed)}
+            }} :
+        Trade::MeshData{MeshPrimitive::Faces,
+            {}, Containers::arrayView(faceColors), {
+                Trade::MeshAttributeData{Trade::MeshAttribute::Color,
+                    Containers::arrayView(faceColors)}
+            }};
+
+    Trade::MeshData expected = combineFaceAttributes(mesh, faceAttributes);
+    CORRADE_COMPARE_AS(expected.vertexCount(), 65536*2,
+        TestSuite::Compare::Greater);
+
+    /* The output should be the same as with the serial variant regardless of
+       the execution order */
+    Trade::MeshData result = combineFaceAttributes(mesh, faceAttributes, parallelForReverse, nullptr);
+    CORRADE_COMPARE(result.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(result.vertexCount(), expected.vertexCount());
+    CORRADE_COMPARE_AS(result.indices<UnsignedInt>(),
+        expected.indices<UnsignedInt>(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(result.attribute<Vector2>(Trade::MeshAttribute::Position),
+        expected.attribute<Vector2>(Trade::MeshAttribute::Position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(result.attribute<Color3>(Trade::MeshAttribute::Color),
+        expected.attribute<Color3>(Trade::MeshAttribute::Color),
+        TestSuite::Compare::Container);
+}
+
 void CombineTest::faceAttributesMeshNotIndexed() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
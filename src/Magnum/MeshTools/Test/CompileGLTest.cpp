@@ -29,6 +29,7 @@
 #include <Corrade/Containers/EnumSet.h>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/PluginManager/Manager.h>
@@ -41,9 +42,11 @@
 #include "Magnum/Mesh.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/DebugTools/CompareImage.h"
+#include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/MeshView.h"
 #include "Magnum/GL/OpenGLTester.h"
 #include "Magnum/GL/Framebuffer.h"
 #include "Magnum/GL/Renderbuffer.h"
@@ -132,6 +135,14 @@ struct CompileGLTest: GL::OpenGLTester {
     void externalBuffers();
     void externalBuffersInvalid();
 
+    void sharedBuffers();
+    void sharedBuffersInvalid();
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void vertexPulling();
+    void vertexPullingInvalid();
+    #endif
+
     private:
         PluginManager::Manager<Trade::AbstractImporter> _manager{"nonexistent"};
 
@@ -411,6 +422,14 @@ constexpr struct {
     {"move both", true, true, true}
 };
 
+constexpr struct {
+    const char* name;
+    bool indexed;
+} DataShared[] {
+    {"indexed", true},
+    {"", false}
+};
+
 using namespace Math::Literals;
 
 constexpr Color4ub ImageData[] {
@@ -496,6 +515,20 @@ CompileGLTest::CompileGLTest() {
 
     addTests({&CompileGLTest::externalBuffersInvalid});
 
+    addInstancedTests({&CompileGLTest::sharedBuffers},
+        Containers::arraySize(DataShared),
+        &CompileGLTest::renderSetup,
+        &CompileGLTest::renderTeardown);
+
+    addTests({&CompileGLTest::sharedBuffersInvalid});
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    addInstancedTests({&CompileGLTest::vertexPulling},
+        Containers::arraySize(DataShared));
+
+    addTests({&CompileGLTest::vertexPullingInvalid});
+    #endif
+
     /* Load the plugins directly from the build tree. Otherwise they're either
        static and already loaded or not present in the build tree */
     #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
@@ -1824,6 +1857,289 @@ void CompileGLTest::externalBuffersInvalid() {
         "MeshTools::compile(): invalid external buffer(s)\n");
 }
 
+void CompileGLTest::sharedBuffers() {
+    auto&& data = DataShared[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #if defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2)
+    if(data.indexed)
+        CORRADE_SKIP("Base vertex is not supported on WebGL 1.");
+    #elif !defined(MAGNUM_TARGET_GLES)
+    if(data.indexed && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::draw_elements_base_vertex>())
+        CORRADE_SKIP(GL::Extensions::ARB::draw_elements_base_vertex::string() << "is not supported.");
+    #elif !defined(MAGNUM_TARGET_WEBGL)
+    if(data.indexed &&
+       !GL::Context::current().isExtensionSupported<GL::Extensions::OES::draw_elements_base_vertex>() &&
+       !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::draw_elements_base_vertex>())
+        CORRADE_SKIP("Neither" << GL::Extensions::OES::draw_elements_base_vertex::string() << "nor" << GL::Extensions::EXT::draw_elements_base_vertex::string() << "is supported.");
+    #else
+    if(data.indexed && !GL::Context::current().isExtensionSupported<GL::Extensions::WEBGL::draw_instanced_base_vertex_base_instance>())
+        CORRADE_SKIP(GL::Extensions::WEBGL::draw_instanced_base_vertex_base_instance::string() << "is not supported.");
+    #endif
+
+    /* The same grid as in externalBuffers(), but split into two meshes with
+       the bottom and top row, each with a different index type
+
+        3-----4-----5
+        |    /|    /|
+        |  /  |  /  |
+        |/    |/    |
+        0-----1-----2
+    */
+    Vector2 positionsBottom[] {
+        {-0.75f, -0.75f},
+        { 0.00f, -0.75f},
+        { 0.75f, -0.75f},
+
+        {-0.75f,  0.00f},
+        { 0.00f,  0.00f},
+        { 0.75f,  0.00f}
+    };
+    Vector2 positionsTop[] {
+        {-0.75f,  0.00f},
+        { 0.00f,  0.00f},
+        { 0.75f,  0.00f},
+
+        {-0.75f,  0.75f},
+        { 0.0f,   0.75f},
+        { 0.75f,  0.75f}
+    };
+    const UnsignedByte indicesBottom[]{
+        0, 1, 4, 0, 4, 3,
+        1, 2, 5, 1, 5, 4
+    };
+    const UnsignedShort indicesTop[]{
+        0, 1, 4, 0, 4, 3,
+        1, 2, 5, 1, 5, 4
+    };
+
+    Trade::MeshData meshes[]{
+        Trade::MeshData{MeshPrimitive::Triangles,
+            {}, indicesBottom, Trade::MeshIndexData{indicesBottom},
+            {}, positionsBottom, {
+                Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                    Containers::arrayView(positionsBottom)}
+            }},
+        Trade::MeshData{MeshPrimitive::Triangles,
+            {}, indicesTop, Trade::MeshIndexData{indicesTop},
+            {}, positionsTop, {
+                Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                    Containers::arrayView(positionsTop)}
+            }}
+    };
+
+    /* Duplicate everything if data is non-indexed */
+    if(!data.indexed) for(Trade::MeshData& mesh: meshes)
+        mesh = duplicate(mesh);
+
+    UnsignedInt counts[2];
+    UnsignedInt vertexOffsets[2];
+    UnsignedInt indexOffsets[2];
+    GL::Mesh mesh = compile(meshes, counts, vertexOffsets, indexOffsets);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE(mesh.count(), 24);
+    CORRADE_COMPARE_AS(Containers::arrayView(counts),
+        Containers::arrayView<UnsignedInt>({12, 12}),
+        TestSuite::Compare::Container);
+    if(data.indexed) {
+        CORRADE_VERIFY(mesh.isIndexed());
+        CORRADE_COMPARE(mesh.indexType(), GL::MeshIndexType::UnsignedShort);
+        CORRADE_COMPARE_AS(Containers::arrayView(vertexOffsets),
+            Containers::arrayView<UnsignedInt>({0, 6}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(Containers::arrayView(indexOffsets),
+            Containers::arrayView<UnsignedInt>({0, 24}),
+            TestSuite::Compare::Container);
+    } else {
+        CORRADE_VERIFY(!mesh.isIndexed());
+        CORRADE_COMPARE_AS(Containers::arrayView(vertexOffsets),
+            Containers::arrayView<UnsignedInt>({0, 12}),
+            TestSuite::Compare::Container);
+    }
+
+    if(!(_manager.loadState("AnyImageImporter") & PluginManager::LoadState::Loaded) ||
+       !(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("AnyImageImporter / TgaImporter plugins not found.");
+
+    _framebuffer.clear(GL::FramebufferClear::Color);
+    _flat2D.setColor(0xff3366_rgbf);
+    for(std::size_t i = 0; i != 2; ++i) {
+        GL::MeshView view{mesh};
+        view.setCount(counts[i])
+            .setBaseVertex(vertexOffsets[i]);
+        if(data.indexed)
+            view.setIndexOffset(Int(indexOffsets[i]/sizeof(UnsignedShort)));
+        _flat2D.draw(view);
+    }
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_WITH(
+        _framebuffer.read({{}, {32, 32}}, {PixelFormat::RGBA8Unorm}),
+        Utility::Path::join(MESHTOOLS_TEST_DIR, "CompileTestFiles/flat2D.tga"),
+        (DebugTools::CompareImageToFile{_manager}));
+}
+
+void CompileGLTest::sharedBuffersInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MeshData a{MeshPrimitive::Triangles, 3};
+    const Trade::MeshData b{MeshPrimitive::Lines, 3};
+    const Trade::MeshData indexed{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{MeshIndexType::UnsignedInt, nullptr},
+        3};
+    const Trade::MeshData positions{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector2, nullptr}
+    }};
+    const Trade::MeshData positions3D{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr}
+    }};
+    UnsignedInt counts[2];
+    UnsignedInt vertexOffsets[2];
+    UnsignedInt indexOffsets[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    compile(Containers::Iterable<const Trade::MeshData>{}, nullptr, nullptr, nullptr);
+    compile({a, a}, counts, vertexOffsets, nullptr, CompileFlag::GenerateFlatNormals);
+    compile({a, a}, Containers::arrayView(counts).prefix(1), vertexOffsets, nullptr);
+    compile({indexed, indexed}, counts, vertexOffsets, nullptr);
+    compile({a, b}, counts, vertexOffsets, nullptr);
+    compile({a, indexed}, counts, vertexOffsets, indexOffsets);
+    compile({positions, a}, counts, vertexOffsets, nullptr);
+    compile({positions, positions3D}, counts, vertexOffsets, nullptr);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::compile(): no meshes passed\n"
+        "MeshTools::compile(): normal generation is not supported when compiling multiple meshes\n"
+        "MeshTools::compile(): expected 2 counts, vertex offsets and index offsets but got 1, 2 and 0\n"
+        "MeshTools::compile(): expected 2 counts, vertex offsets and index offsets but got 2, 2 and 0\n"
+        "MeshTools::compile(): expected mesh 1 to be MeshPrimitive::Triangles but got MeshPrimitive::Lines\n"
+        "MeshTools::compile(): expected mesh 1 to be non-indexed\n"
+        "MeshTools::compile(): expected mesh 1 to have 1 attributes but got 0\n"
+        "MeshTools::compile(): expected attribute 0 of mesh 1 to be Trade::MeshAttribute::Position of VertexFormat::Vector2 with array size 0 and morph target ID -1 but got Trade::MeshAttribute::Position of VertexFormat::Vector3 with array size 0 and morph target ID -1\n");
+}
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void CompileGLTest::vertexPulling() {
+    auto&& data = DataShared[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Vector2 positionsA[]{
+        {-0.75f, -0.75f},
+        { 0.75f, -0.75f},
+        { 0.00f,  0.75f}
+    };
+    const UnsignedByte indicesA[]{
+        0, 1, 2
+    };
+    const struct VertexB {
+        Vector3 position;
+        Vector2 textureCoordinates;
+    } verticesB[]{
+        {{-0.5f, -0.5f, 0.0f}, {0.0f, 0.0f}},
+        {{ 0.5f, -0.5f, 0.0f}, {1.0f, 0.0f}},
+        {{-0.5f,  0.5f, 0.0f}, {0.0f, 1.0f}},
+        {{ 0.5f,  0.5f, 0.0f}, {1.0f, 1.0f}}
+    };
+    const UnsignedShort indicesB[]{
+        0, 1, 2, 2, 1, 3
+    };
+    const Containers::StridedArrayView1D<const VertexB> viewB = verticesB;
+
+    /* The attributes don't need to match */
+    Trade::MeshData meshes[]{
+        Trade::MeshData{MeshPrimitive::Triangles,
+            {}, indicesA, Trade::MeshIndexData{indicesA},
+            {}, positionsA, {
+                Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                    Containers::arrayView(positionsA)}
+            }},
+        Trade::MeshData{MeshPrimitive::Triangles,
+            {}, indicesB, Trade::MeshIndexData{indicesB},
+            {}, verticesB, {
+                Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                    viewB.slice(&VertexB::position)},
+                Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+                    viewB.slice(&VertexB::textureCoordinates)}
+            }}
+    };
+
+    /* Duplicate everything if data is non-indexed */
+    if(!data.indexed) for(Trade::MeshData& mesh: meshes)
+        mesh = duplicate(mesh);
+
+    GL::Buffer vertices{GL::Buffer::TargetHint::ShaderStorage};
+    UnsignedInt counts[2];
+    UnsignedInt vertexOffsets[2];
+    UnsignedInt indexOffsets[2];
+    Containers::Pair<GL::Mesh, VertexPullingLayout> out = compileVertexPulling(meshes, vertices, counts, vertexOffsets, indexOffsets);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    const UnsignedInt vertexCount = data.indexed ? 7 : 9;
+    CORRADE_COMPARE(out.first().primitive(), GL::MeshPrimitive::Triangles);
+    CORRADE_COMPARE(out.first().count(), 9);
+    CORRADE_COMPARE_AS(Containers::arrayView(counts),
+        Containers::arrayView<UnsignedInt>({3, 6}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(vertexOffsets),
+        Containers::arrayView<UnsignedInt>({0, 3}),
+        TestSuite::Compare::Container);
+    if(data.indexed) {
+        CORRADE_VERIFY(out.first().isIndexed());
+        CORRADE_COMPARE(out.first().indexType(), GL::MeshIndexType::UnsignedShort);
+        CORRADE_COMPARE_AS(Containers::arrayView(indexOffsets),
+            Containers::arrayView<UnsignedInt>({0, 6}),
+            TestSuite::Compare::Container);
+    } else CORRADE_VERIFY(!out.first().isIndexed());
+
+    CORRADE_COMPARE(out.second().vertexCount, vertexCount);
+    CORRADE_COMPARE(out.second().position, 0);
+    CORRADE_COMPARE(out.second().normal, ~UnsignedInt{});
+    CORRADE_COMPARE(out.second().tangent, ~UnsignedInt{});
+    CORRADE_COMPARE(out.second().bitangent, ~UnsignedInt{});
+    CORRADE_COMPARE(out.second().textureCoordinates, vertexCount*3);
+    CORRADE_COMPARE(out.second().color, ~UnsignedInt{});
+    CORRADE_COMPARE(vertices.size(), VertexPullingHeaderSize + vertexCount*5*4);
+}
+
+void CompileGLTest::vertexPullingInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MeshData a{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector2, nullptr}
+    }};
+    const Trade::MeshData b{MeshPrimitive::Lines, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector2, nullptr}
+    }};
+    const Trade::MeshData indexed{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{MeshIndexType::UnsignedInt, nullptr},
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector2, nullptr}
+        }};
+    const Trade::MeshData noPositions{MeshPrimitive::Triangles, 3};
+    GL::Buffer vertices{GL::Buffer::TargetHint::ShaderStorage};
+    UnsignedInt counts[2];
+    UnsignedInt vertexOffsets[2];
+    UnsignedInt indexOffsets[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    compileVertexPulling(Containers::Iterable<const Trade::MeshData>{}, vertices, nullptr, nullptr, nullptr);
+    compileVertexPulling({a, a}, vertices, Containers::arrayView(counts).prefix(1), vertexOffsets, nullptr);
+    compileVertexPulling({indexed, indexed}, vertices, counts, vertexOffsets, nullptr);
+    compileVertexPulling({a, b}, vertices, counts, vertexOffsets, nullptr);
+    compileVertexPulling({a, indexed}, vertices, counts, vertexOffsets, indexOffsets);
+    compileVertexPulling({a, noPositions}, vertices, counts, vertexOffsets, nullptr);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::compileVertexPulling(): no meshes passed\n"
+        "MeshTools::compileVertexPulling(): expected 2 counts, vertex offsets and index offsets but got 1, 2 and 0\n"
+        "MeshTools::compileVertexPulling(): expected 2 counts, vertex offsets and index offsets but got 2, 2 and 0\n"
+        "MeshTools::compileVertexPulling(): expected mesh 1 to be MeshPrimitive::Triangles but got MeshPrimitive::Lines\n"
+        "MeshTools::compileVertexPulling(): expected mesh 1 to be non-indexed\n"
+        "MeshTools::vertexPullingData(): mesh 1 has no positions\n");
+}
+#endif
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CompileGLTest)
@@ -0,0 +1,131 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/CompileVk.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/Mesh.h"
+#include "Magnum/Vk/StagingUploader.h"
+#include "Magnum/Vk/VulkanTester.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct CompileVkTest: Vk::VulkanTester {
+    explicit CompileVkTest();
+
+    void nonIndexed();
+    void indexed();
+};
+
+CompileVkTest::CompileVkTest() {
+    addTests({&CompileVkTest::nonIndexed,
+              &CompileVkTest::indexed});
+}
+
+const struct Vertex {
+    Vector3 position;
+    Vector3 normal;
+} Vertices[]{
+    {{-1.0f, -1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+    {{ 1.0f, -1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+    {{ 0.0f,  1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}
+};
+
+void CompileVkTest::nonIndexed() {
+    Trade::MeshData data{MeshPrimitive::Triangles, {}, Vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            Containers::stridedArrayView(Vertices).slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal,
+            Containers::stridedArrayView(Vertices).slice(&Vertex::normal)}
+    }};
+
+    Vk::StagingUploader uploader{device(), queue(), device().properties().pickQueueFamily(Vk::QueueFlag::Graphics)};
+
+    /* Texture coordinates aren't present in the mesh and thus skipped */
+    Vk::Mesh mesh = compile(uploader, data, {
+        {Trade::MeshAttribute::Position, 0},
+        {Trade::MeshAttribute::TextureCoordinates, 5},
+        {Trade::MeshAttribute::Normal, 1}
+    });
+    uploader.finish();
+
+    const VkPipelineVertexInputStateCreateInfo& vertexInfo = mesh.layout().vkPipelineVertexInputStateCreateInfo();
+    CORRADE_COMPARE(vertexInfo.vertexBindingDescriptionCount, 2);
+    CORRADE_COMPARE(vertexInfo.pVertexBindingDescriptions[0].binding, 0);
+    CORRADE_COMPARE(vertexInfo.pVertexBindingDescriptions[0].stride, sizeof(Vertex));
+    CORRADE_COMPARE(vertexInfo.pVertexBindingDescriptions[1].binding, 2);
+    CORRADE_COMPARE(vertexInfo.pVertexBindingDescriptions[1].stride, sizeof(Vertex));
+    CORRADE_COMPARE(vertexInfo.vertexAttributeDescriptionCount, 2);
+    CORRADE_COMPARE(vertexInfo.pVertexAttributeDescriptions[0].location, 0);
+    CORRADE_COMPARE(vertexInfo.pVertexAttributeDescriptions[0].binding, 0);
+    CORRADE_COMPARE(vertexInfo.pVertexAttributeDescriptions[0].format, VK_FORMAT_R32G32B32_SFLOAT);
+    CORRADE_COMPARE(vertexInfo.pVertexAttributeDescriptions[1].location, 1);
+    CORRADE_COMPARE(vertexInfo.pVertexAttributeDescriptions[1].binding, 2);
+    CORRADE_COMPARE(vertexInfo.pVertexAttributeDescriptions[1].format, VK_FORMAT_R32G32B32_SFLOAT);
+
+    CORRADE_COMPARE(mesh.vertexBuffers().size(), 2);
+    CORRADE_VERIFY(mesh.vertexBuffers()[0]);
+    CORRADE_COMPARE(mesh.vertexBuffers()[1], mesh.vertexBuffers()[0]);
+    CORRADE_COMPARE(mesh.vertexBufferOffsets()[0], 0);
+    CORRADE_COMPARE(mesh.vertexBufferOffsets()[1], sizeof(Vector3));
+
+    CORRADE_VERIFY(!mesh.isIndexed());
+    CORRADE_COMPARE(mesh.count(), 3);
+}
+
+void CompileVkTest::indexed() {
+    const UnsignedShort indices[]{0, 1, 2, 2, 1, 0};
+    Trade::MeshData data{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, Vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                Containers::stridedArrayView(Vertices).slice(&Vertex::position)}
+        }};
+
+    Vk::StagingUploader uploader{device(), queue(), device().properties().pickQueueFamily(Vk::QueueFlag::Graphics)};
+
+    Vk::Mesh mesh = compile(uploader, data, {
+        {Trade::MeshAttribute::Position, 0}
+    });
+    uploader.finish();
+
+    CORRADE_COMPARE(mesh.layout().vkPipelineVertexInputStateCreateInfo().vertexBindingDescriptionCount, 1);
+    CORRADE_COMPARE(mesh.vertexBuffers().size(), 1);
+    CORRADE_VERIFY(mesh.vertexBuffers()[0]);
+
+    CORRADE_VERIFY(mesh.isIndexed());
+    CORRADE_VERIFY(mesh.indexBuffer());
+    CORRADE_COMPARE(mesh.indexBufferOffset(), 0);
+    CORRADE_COMPARE(mesh.indexType(), Vk::MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(mesh.count(), 6);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CompileVkTest)
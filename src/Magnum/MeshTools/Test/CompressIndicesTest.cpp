@@ -55,6 +55,12 @@ struct CompressIndicesTest: TestSuite::Tester {
     /* No compressErased(), as that's tested in the templates above */
     void compressErasedNonContiguous();
     void compressErasedWrongIndexSize();
+    void compressedIndexType();
+    void compressedIndexTypeOffset();
+    void compressedIndexTypeInvalid();
+    template<class T> void compressInto();
+    void compressIntoOffset();
+    void compressIntoInvalid();
     #ifdef MAGNUM_BUILD_DEPRECATED
     void compressDeprecated();
     #endif
@@ -84,6 +90,14 @@ CompressIndicesTest::CompressIndicesTest() {
               &CompressIndicesTest::compressOffsetNegative<UnsignedInt>,
               &CompressIndicesTest::compressErasedNonContiguous,
               &CompressIndicesTest::compressErasedWrongIndexSize,
+              &CompressIndicesTest::compressedIndexType,
+              &CompressIndicesTest::compressedIndexTypeOffset,
+              &CompressIndicesTest::compressedIndexTypeInvalid,
+              &CompressIndicesTest::compressInto<UnsignedByte>,
+              &CompressIndicesTest::compressInto<UnsignedShort>,
+              &CompressIndicesTest::compressInto<UnsignedInt>,
+              &CompressIndicesTest::compressIntoOffset,
+              &CompressIndicesTest::compressIntoInvalid,
               #ifdef MAGNUM_BUILD_DEPRECATED
               &CompressIndicesTest::compressDeprecated,
               #endif
@@ -237,6 +251,100 @@ void CompressIndicesTest::compressErasedWrongIndexSize() {
         "MeshTools::compressIndices(): expected index type size 1, 2 or 4 but got 3\n");
 }
 
+void CompressIndicesTest::compressedIndexType() {
+    const UnsignedByte indicesByte[]{1, 2, 3, 0, 4};
+    const UnsignedShort indicesShort[]{1, 256, 0, 5};
+    const UnsignedInt indicesInt[]{65536, 3, 2};
+    Containers::StridedArrayView2D<const char> byte = Containers::arrayCast<2, const char>(Containers::stridedArrayView(indicesByte));
+    Containers::StridedArrayView2D<const char> short_ = Containers::arrayCast<2, const char>(Containers::stridedArrayView(indicesShort));
+    Containers::StridedArrayView2D<const char> int_ = Containers::arrayCast<2, const char>(Containers::stridedArrayView(indicesInt));
+
+    /* Same as what compressIndices() picks */
+    CORRADE_COMPARE(MeshTools::compressedIndexType(byte), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(MeshTools::compressedIndexType(byte, MeshIndexType::UnsignedByte), MeshIndexType::UnsignedByte);
+    CORRADE_COMPARE(MeshTools::compressedIndexType(short_, MeshIndexType::UnsignedByte), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(MeshTools::compressedIndexType(short_, MeshIndexType::UnsignedInt), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE(MeshTools::compressedIndexType(int_, MeshIndexType::UnsignedByte), MeshIndexType::UnsignedInt);
+}
+
+void CompressIndicesTest::compressedIndexTypeOffset() {
+    const UnsignedInt indices[]{75000 + 1, 75000 + 256, 75000 + 0, 75000 + 5};
+    Containers::StridedArrayView2D<const char> view = Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices));
+
+    CORRADE_COMPARE(MeshTools::compressedIndexType(view, MeshIndexType::UnsignedByte), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE(MeshTools::compressedIndexType(view, MeshIndexType::UnsignedByte, 75000), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(MeshTools::compressedIndexType(view, MeshIndexType::UnsignedByte, 75001), MeshIndexType::UnsignedByte);
+}
+
+void CompressIndicesTest::compressedIndexTypeInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*4]{};
+
+    std::stringstream out;
+    Error redirectError{&out};
+    MeshTools::compressedIndexType(Containers::StridedArrayView2D<const char>{indices, {6, 4}}, meshIndexTypeWrap(0xcaca));
+    MeshTools::compressedIndexType(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}});
+    MeshTools::compressedIndexType(Containers::StridedArrayView2D<const char>{indices, {6, 3}});
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::compressedIndexType(): can't compress to an implementation-specific index type 0xcaca\n"
+        "MeshTools::compressedIndexType(): second view dimension is not contiguous\n"
+        "MeshTools::compressedIndexType(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+template<class T> void CompressIndicesTest::compressInto() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const UnsignedShort indices[]{1, 2, 3, 0, 4};
+    /* Writing to a strided output, such as an interleaved location in a
+       larger buffer */
+    struct Vertex {
+        T index;
+        Int other;
+    } out[5]{};
+    Containers::StridedArrayView1D<T> outIndices = Containers::stridedArrayView(out).slice(&Vertex::index);
+
+    MeshTools::compressIndicesInto(
+        Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)),
+        Containers::arrayCast<2, char>(outIndices));
+    CORRADE_COMPARE_AS(outIndices,
+        Containers::arrayView<T>({1, 2, 3, 0, 4}),
+        TestSuite::Compare::Container);
+}
+
+void CompressIndicesTest::compressIntoOffset() {
+    const UnsignedInt indices[]{75000 + 1, 75000 + 256, 75000 + 0, 75000 + 5};
+    UnsignedShort out[4]{};
+
+    MeshTools::compressIndicesInto(
+        Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(out)), 75000);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView<UnsignedShort>({1, 256, 0, 5}),
+        TestSuite::Compare::Container);
+}
+
+void CompressIndicesTest::compressIntoInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*4]{};
+    char output[6*4];
+
+    std::stringstream out;
+    Error redirectError{&out};
+    MeshTools::compressIndicesInto(Containers::StridedArrayView2D<const char>{indices, {6, 4}}, Containers::StridedArrayView2D<char>{output, {5, 4}});
+    MeshTools::compressIndicesInto(Containers::StridedArrayView2D<const char>{indices, {6, 2}, {4, 2}}, Containers::StridedArrayView2D<char>{output, {6, 2}});
+    MeshTools::compressIndicesInto(Containers::StridedArrayView2D<const char>{indices, {6, 2}}, Containers::StridedArrayView2D<char>{output, {6, 2}, {4, 2}});
+    MeshTools::compressIndicesInto(Containers::StridedArrayView2D<const char>{indices, {6, 3}}, Containers::StridedArrayView2D<char>{output, {6, 2}});
+    MeshTools::compressIndicesInto(Containers::StridedArrayView2D<const char>{indices, {6, 2}}, Containers::StridedArrayView2D<char>{output, {6, 3}});
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::compressIndicesInto(): expected output view with 6 elements but got 5\n"
+        "MeshTools::compressIndicesInto(): second index view dimension is not contiguous\n"
+        "MeshTools::compressIndicesInto(): second output view dimension is not contiguous\n"
+        "MeshTools::compressIndicesInto(): expected index type size 1, 2 or 4 but got 3\n"
+        "MeshTools::compressIndicesInto(): expected output index type size 1, 2 or 4 but got 3\n");
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 void CompressIndicesTest::compressDeprecated() {
     Containers::Array<char> data;
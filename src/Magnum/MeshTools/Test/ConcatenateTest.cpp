@@ -50,6 +50,13 @@ struct ConcatenateTest: TestSuite::Tester {
     void concatenateIntoNoIndexArray();
     void concatenateIntoNonOwnedAttributeArray();
 
+    void concatenator();
+    void concatenatorNotIndexed();
+    void concatenatorNoAttributes();
+    void concatenatorReserve();
+    void concatenatorReuse();
+    void concatenatorMove();
+
     void concatenateUnsupportedPrimitive();
     void concatenateInconsistentPrimitive();
     void concatenateInconsistentAttributeFormat();
@@ -82,6 +89,13 @@ ConcatenateTest::ConcatenateTest() {
               &ConcatenateTest::concatenateIntoNoIndexArray,
               &ConcatenateTest::concatenateIntoNonOwnedAttributeArray,
 
+              &ConcatenateTest::concatenator,
+              &ConcatenateTest::concatenatorNotIndexed,
+              &ConcatenateTest::concatenatorNoAttributes,
+              &ConcatenateTest::concatenatorReserve,
+              &ConcatenateTest::concatenatorReuse,
+              &ConcatenateTest::concatenatorMove,
+
               &ConcatenateTest::concatenateUnsupportedPrimitive,
               &ConcatenateTest::concatenateInconsistentPrimitive,
               &ConcatenateTest::concatenateInconsistentAttributeFormat,
@@ -636,6 +650,260 @@ void ConcatenateTest::concatenateIntoNonOwnedAttributeArray() {
     CORRADE_COMPARE(dst.vertexData().data(), vertexDataPointer);
 }
 
+/* First is non-indexed and interleaved, this layout will be used. Second is
+   indexed and has the texture coordinates missing, which will get
+   zero-filled. Third has the attributes in a different order. */
+const struct ConcatenatorVertexA {
+    Vector3 position;
+    Vector2 textureCoordinates;
+} ConcatenatorVertexDataA[]{
+    {{1.0f, 2.0f, 3.0f}, {0.1f, 0.2f}},
+    {{4.0f, 5.0f, 6.0f}, {0.3f, 0.4f}}
+};
+const Vector3 ConcatenatorPositionsB[]{
+    {7.0f, 8.0f, 9.0f},
+    {10.0f, 11.0f, 12.0f},
+    {13.0f, 14.0f, 15.0f}
+};
+const UnsignedByte ConcatenatorIndicesB[]{2, 0, 1, 1};
+const struct ConcatenatorVertexC {
+    Vector2 textureCoordinates;
+    Vector3 position;
+} ConcatenatorVertexDataC[]{
+    {{0.5f, 0.6f}, {16.0f, 17.0f, 18.0f}}
+};
+
+Trade::MeshData concatenatorMeshA() {
+    Containers::StridedArrayView1D<const ConcatenatorVertexA> vertices = ConcatenatorVertexDataA;
+    return Trade::MeshData{MeshPrimitive::Points, {}, ConcatenatorVertexDataA, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            vertices.slice(&ConcatenatorVertexA::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+            vertices.slice(&ConcatenatorVertexA::textureCoordinates)}
+    }};
+}
+
+Trade::MeshData concatenatorMeshB() {
+    return Trade::MeshData{MeshPrimitive::Points,
+        {}, ConcatenatorIndicesB, Trade::MeshIndexData{ConcatenatorIndicesB},
+        {}, ConcatenatorPositionsB, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                Containers::arrayView(ConcatenatorPositionsB)}
+        }};
+}
+
+Trade::MeshData concatenatorMeshC() {
+    Containers::StridedArrayView1D<const ConcatenatorVertexC> vertices = ConcatenatorVertexDataC;
+    return Trade::MeshData{MeshPrimitive::Points, {}, ConcatenatorVertexDataC, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+            vertices.slice(&ConcatenatorVertexC::textureCoordinates)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            vertices.slice(&ConcatenatorVertexC::position)}
+    }};
+}
+
+void ConcatenateTest::concatenator() {
+    const Trade::MeshData a = concatenatorMeshA();
+    const Trade::MeshData b = concatenatorMeshB();
+    const Trade::MeshData c = concatenatorMeshC();
+
+    MeshConcatenator concatenator{a};
+    CORRADE_COMPARE(concatenator.primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE(concatenator.meshCount(), 0);
+    CORRADE_COMPARE(concatenator.vertexCount(), 0);
+    CORRADE_COMPARE(concatenator.indexCount(), 0);
+    CORRADE_VERIFY(!concatenator.isIndexed());
+
+    concatenator.add(a);
+    CORRADE_COMPARE(concatenator.meshCount(), 1);
+    CORRADE_COMPARE(concatenator.vertexCount(), 2);
+    CORRADE_COMPARE(concatenator.indexCount(), 0);
+    CORRADE_VERIFY(!concatenator.isIndexed());
+
+    /* Adding an indexed mesh generates trivial indices for the first */
+    concatenator.add(b);
+    CORRADE_COMPARE(concatenator.meshCount(), 2);
+    CORRADE_COMPARE(concatenator.vertexCount(), 5);
+    CORRADE_COMPARE(concatenator.indexCount(), 6);
+    CORRADE_VERIFY(concatenator.isIndexed());
+
+    concatenator.add(c);
+    CORRADE_COMPARE(concatenator.meshCount(), 3);
+    CORRADE_COMPARE(concatenator.vertexCount(), 6);
+    CORRADE_COMPARE(concatenator.indexCount(), 7);
+
+    Trade::MeshData dst = concatenator.finish();
+    CORRADE_COMPARE(dst.primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE(dst.attributeCount(), 2);
+    CORRADE_COMPARE_AS(dst.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {1.0f, 2.0f, 3.0f},
+            {4.0f, 5.0f, 6.0f},
+            {7.0f, 8.0f, 9.0f},
+            {10.0f, 11.0f, 12.0f},
+            {13.0f, 14.0f, 15.0f},
+            {16.0f, 17.0f, 18.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(dst.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+        Containers::arrayView<Vector2>({
+            {0.1f, 0.2f},
+            {0.3f, 0.4f},
+            {}, {}, {}, /* Missing in the second mesh */
+            {0.5f, 0.6f}
+        }), TestSuite::Compare::Container);
+    CORRADE_VERIFY(dst.isIndexed());
+    CORRADE_COMPARE(dst.indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(dst.indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({
+            0, 1,           /* implicit for the first nonindexed mesh */
+            4, 2, 3, 3,     /* offset for the second indexed mesh */
+            5               /* implicit + offset for the third mesh */
+        }), TestSuite::Compare::Container);
+    CORRADE_VERIFY(isInterleaved(dst));
+    CORRADE_COMPARE(dst.indexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(dst.vertexDataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+
+    /* The output should be exactly the same as with concatenate() */
+    Trade::MeshData expected = MeshTools::concatenate({a, b, c});
+    CORRADE_COMPARE(dst.attributeStride(0), expected.attributeStride(0));
+    CORRADE_COMPARE(dst.attributeOffset(0), expected.attributeOffset(0));
+    CORRADE_COMPARE(dst.attributeOffset(1), expected.attributeOffset(1));
+    CORRADE_COMPARE_AS(dst.vertexData(), expected.vertexData(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(dst.indexData(), expected.indexData(),
+        TestSuite::Compare::Container);
+}
+
+void ConcatenateTest::concatenatorNotIndexed() {
+    const Trade::MeshData a = concatenatorMeshA();
+    const Trade::MeshData c = concatenatorMeshC();
+
+    Trade::MeshData dst = MeshConcatenator{a}
+        .add(a)
+        .add(c)
+        .finish();
+    CORRADE_VERIFY(!dst.isIndexed());
+    CORRADE_COMPARE(dst.vertexCount(), 3);
+    CORRADE_COMPARE_AS(dst.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {1.0f, 2.0f, 3.0f},
+            {4.0f, 5.0f, 6.0f},
+            {16.0f, 17.0f, 18.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(dst.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+        Containers::arrayView<Vector2>({
+            {0.1f, 0.2f},
+            {0.3f, 0.4f},
+            {0.5f, 0.6f}
+        }), TestSuite::Compare::Container);
+}
+
+void ConcatenateTest::concatenatorNoAttributes() {
+    const UnsignedInt indices[]{1, 0, 1, 2};
+
+    Trade::MeshData dst = MeshConcatenator{Trade::MeshData{MeshPrimitive::Lines, 0}}
+        .add(Trade::MeshData{MeshPrimitive::Lines, 2})
+        .add(Trade::MeshData{MeshPrimitive::Lines,
+            {}, indices, Trade::MeshIndexData{indices}, 3})
+        .finish();
+    CORRADE_COMPARE(dst.attributeCount(), 0);
+    CORRADE_COMPARE(dst.vertexCount(), 5);
+    CORRADE_VERIFY(dst.vertexData().isEmpty());
+    CORRADE_VERIFY(dst.isIndexed());
+    CORRADE_COMPARE_AS(dst.indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({
+            0, 1, 3, 2, 3, 4
+        }), TestSuite::Compare::Container);
+}
+
+void ConcatenateTest::concatenatorReserve() {
+    const Trade::MeshData a = concatenatorMeshA();
+    const Trade::MeshData b = concatenatorMeshB();
+    const Trade::MeshData c = concatenatorMeshC();
+
+    /* With the exact counts reserved, there should be no spare capacity */
+    Trade::MeshData dst = MeshConcatenator{a}
+        .reserve(7, 6)
+        .add(a)
+        .add(b)
+        .add(c)
+        .finish();
+    CORRADE_COMPARE(dst.vertexCount(), 6);
+    CORRADE_COMPARE(dst.indexCount(), 7);
+
+    Containers::Array<char> vertexData = dst.releaseVertexData();
+    Containers::Array<char> indexData = dst.releaseIndexData();
+    CORRADE_COMPARE(arrayCapacity(vertexData), 6*sizeof(ConcatenatorVertexA));
+    CORRADE_COMPARE(arrayCapacity(indexData), 7*sizeof(UnsignedInt));
+}
+
+void ConcatenateTest::concatenatorReuse() {
+    const Trade::MeshData a = concatenatorMeshA();
+    const Trade::MeshData b = concatenatorMeshB();
+    const Trade::MeshData c = concatenatorMeshC();
+
+    MeshConcatenator concatenator{a};
+    Trade::MeshData first = concatenator
+        .add(a)
+        .add(b)
+        .finish();
+    CORRADE_VERIFY(first.isIndexed());
+    CORRADE_COMPARE(first.vertexCount(), 5);
+
+    /* After finishing, the state is reset and the next mesh is again
+       non-indexed unless an indexed mesh is added */
+    CORRADE_COMPARE(concatenator.meshCount(), 0);
+    CORRADE_COMPARE(concatenator.vertexCount(), 0);
+    CORRADE_COMPARE(concatenator.indexCount(), 0);
+    CORRADE_VERIFY(!concatenator.isIndexed());
+
+    Trade::MeshData second = concatenator
+        .add(c)
+        .finish();
+    CORRADE_VERIFY(!second.isIndexed());
+    CORRADE_COMPARE(second.attributeCount(), 2);
+    CORRADE_COMPARE_AS(second.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {16.0f, 17.0f, 18.0f}
+        }), TestSuite::Compare::Container);
+
+    /* The first mesh isn't affected by this */
+    CORRADE_COMPARE_AS(first.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {1.0f, 2.0f, 3.0f},
+            {4.0f, 5.0f, 6.0f},
+            {7.0f, 8.0f, 9.0f},
+            {10.0f, 11.0f, 12.0f},
+            {13.0f, 14.0f, 15.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void ConcatenateTest::concatenatorMove() {
+    const Trade::MeshData a = concatenatorMeshA();
+    const Trade::MeshData b = concatenatorMeshB();
+
+    MeshConcatenator concatenator{a};
+    concatenator.add(a);
+
+    MeshConcatenator moved{Utility::move(concatenator)};
+    CORRADE_COMPARE(moved.meshCount(), 1);
+    CORRADE_COMPARE(moved.vertexCount(), 2);
+
+    MeshConcatenator assigned{Trade::MeshData{MeshPrimitive::Lines, 0}};
+    assigned = Utility::move(moved);
+    CORRADE_COMPARE(assigned.primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE(assigned.meshCount(), 1);
+
+    Trade::MeshData dst = assigned.add(b).finish();
+    CORRADE_COMPARE(dst.vertexCount(), 5);
+    CORRADE_COMPARE(dst.indexCount(), 6);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<MeshConcatenator>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<MeshConcatenator>::value);
+    CORRADE_VERIFY(!std::is_copy_constructible<MeshConcatenator>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<MeshConcatenator>::value);
+}
+
 void ConcatenateTest::concatenateUnsupportedPrimitive() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -644,9 +912,11 @@ void ConcatenateTest::concatenateUnsupportedPrimitive() {
     std::ostringstream out;
     Error redirectError{&out};
     MeshTools::concatenate({a});
+    MeshConcatenator{a};
     MeshTools::concatenateInto(a, {a});
     CORRADE_COMPARE(out.str(),
         "MeshTools::concatenate(): MeshPrimitive::TriangleStrip is not supported, turn it into a plain indexed mesh first\n"
+        "MeshTools::MeshConcatenator: MeshPrimitive::TriangleStrip is not supported, turn it into a plain indexed mesh first\n"
         "MeshTools::concatenateInto(): MeshPrimitive::TriangleStrip is not supported, turn it into a plain indexed mesh first\n");
 }
 
@@ -660,9 +930,11 @@ void ConcatenateTest::concatenateInconsistentPrimitive() {
     std::ostringstream out;
     Error redirectError{&out};
     MeshTools::concatenate({a, a, b});
+    MeshConcatenator{a}.add(a).add(b);
     MeshTools::concatenateInto(a, {a, b});
     CORRADE_COMPARE(out.str(),
         "MeshTools::concatenate(): expected MeshPrimitive::Triangles but got MeshPrimitive::Lines in mesh 2\n"
+        "MeshTools::MeshConcatenator::add(): expected MeshPrimitive::Triangles but got MeshPrimitive::Lines in mesh 1\n"
         "MeshTools::concatenateInto(): expected MeshPrimitive::Triangles but got MeshPrimitive::Lines in mesh 1\n");
 }
 
@@ -688,9 +960,11 @@ void ConcatenateTest::concatenateInconsistentAttributeFormat() {
     std::ostringstream out;
     Error redirectError{&out};
     MeshTools::concatenate({a, a, a, a, b});
+    MeshConcatenator{a}.add(a).add(a).add(b);
     MeshTools::concatenateInto(a, {a, a, a, b});
     CORRADE_COMPARE(out.str(),
         "MeshTools::concatenate(): expected VertexFormat::Vector3ubNormalized for attribute 2 (Trade::MeshAttribute::Color) but got VertexFormat::Vector3usNormalized in mesh 4 attribute 1\n"
+        "MeshTools::MeshConcatenator::add(): expected VertexFormat::Vector3ubNormalized for attribute 2 (Trade::MeshAttribute::Color) but got VertexFormat::Vector3usNormalized in mesh 2 attribute 1\n"
         "MeshTools::concatenateInto(): expected VertexFormat::Vector3ubNormalized for attribute 2 (Trade::MeshAttribute::Color) but got VertexFormat::Vector3usNormalized in mesh 3 attribute 1\n");
 }
 
@@ -727,11 +1001,15 @@ void ConcatenateTest::concatenateInconsistentArrayAttribute() {
     Error redirectError{&out};
     MeshTools::concatenate({a, a, a, a, b});
     MeshTools::concatenate({b, b, b, b, a});
+    MeshConcatenator{a}.add(a).add(b);
+    MeshConcatenator{b}.add(b).add(a);
     MeshTools::concatenateInto(a2, {a, a, a, b});
     MeshTools::concatenateInto(b, {b, b, b, a});
     CORRADE_COMPARE_AS(out.str(),
         "MeshTools::concatenate(): attribute 2 (Trade::MeshAttribute::Custom(42)) is an array but attribute 1 in mesh 4 isn't\n"
         "MeshTools::concatenate(): attribute 1 (Trade::MeshAttribute::Custom(42)) isn't an array but attribute 2 in mesh 4 is\n"
+        "MeshTools::MeshConcatenator::add(): attribute 2 (Trade::MeshAttribute::Custom(42)) is an array but attribute 1 in mesh 1 isn't\n"
+        "MeshTools::MeshConcatenator::add(): attribute 1 (Trade::MeshAttribute::Custom(42)) isn't an array but attribute 2 in mesh 1 is\n"
         "MeshTools::concatenateInto(): attribute 2 (Trade::MeshAttribute::Custom(42)) is an array but attribute 1 in mesh 3 isn't\n"
         "MeshTools::concatenateInto(): attribute 1 (Trade::MeshAttribute::Custom(42)) isn't an array but attribute 2 in mesh 3 is\n",
         TestSuite::Compare::String);
@@ -763,9 +1041,11 @@ void ConcatenateTest::concatenateTooLargeAttributeArraySize() {
     std::ostringstream out;
     Error redirectError{&out};
     MeshTools::concatenate({a, a, a, a, b});
+    MeshConcatenator{a}.add(b);
     MeshTools::concatenateInto(a, {a, a, a, b});
     CORRADE_COMPARE_AS(out.str(),
         "MeshTools::concatenate(): expected array size 4 or less for attribute 2 (Trade::MeshAttribute::Custom(42)) but got 5 in mesh 4 attribute 1\n"
+        "MeshTools::MeshConcatenator::add(): expected array size 4 or less for attribute 2 (Trade::MeshAttribute::Custom(42)) but got 5 in mesh 0 attribute 1\n"
         "MeshTools::concatenateInto(): expected array size 4 or less for attribute 2 (Trade::MeshAttribute::Custom(42)) but got 5 in mesh 3 attribute 1\n",
         TestSuite::Compare::String);
 }
@@ -798,9 +1078,11 @@ void ConcatenateTest::concatenateImplementationSpecificIndexType() {
     std::ostringstream out;
     Error redirectError{&out};
     MeshTools::concatenate({a, b});
+    MeshConcatenator{a}.add(a).add(b);
     MeshTools::concatenateInto(a, {b});
     CORRADE_COMPARE(out.str(),
         "MeshTools::concatenate(): mesh 1 has an implementation-specific index type 0xcaca\n"
+        "MeshTools::MeshConcatenator::add(): mesh 1 has an implementation-specific index type 0xcaca\n"
         "MeshTools::concatenateInto(): mesh 0 has an implementation-specific index type 0xcaca\n");
 }
 
@@ -826,9 +1108,11 @@ void ConcatenateTest::concatenateImplementationSpecificVertexFormat() {
     std::ostringstream out;
     Error redirectError{&out};
     MeshTools::concatenate({a, b});
+    MeshConcatenator{a};
     MeshTools::concatenateInto(a, {b});
     CORRADE_COMPARE(out.str(),
         "MeshTools::concatenate(): attribute 2 of the first mesh has an implementation-specific format 0xcaca\n"
+        "MeshTools::MeshConcatenator: attribute 2 of the layout mesh has an implementation-specific format 0xcaca\n"
         "MeshTools::concatenateInto(): attribute 2 of the destination mesh has an implementation-specific format 0xcaca\n");
 }
 
@@ -0,0 +1,428 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/FormatStl.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Encode.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct EncodeTest: TestSuite::Tester {
+    explicit EncodeTest();
+
+    void encodeIndices();
+    template<class T> void encodeDecodeIndices();
+    void encodeIndicesTypeErased();
+    void encodeIndicesTypeErasedNotContiguous();
+    void encodeIndicesTypeErasedInvalidSize();
+    void decodeIndicesInvalid();
+
+    void encodeVertices();
+    void encodeDecodeVertices();
+    void encodeDecodeVerticesEmpty();
+    void decodeVerticesInvalid();
+
+    void encodeDecodeMesh();
+    void encodeDecodeMeshNotIndexed();
+    void encodeDecodeMeshEmpty();
+    void encodeMeshImplementationSpecificIndexType();
+    void encodeMeshImplementationSpecificVertexFormat();
+    void decodeMeshInvalid();
+};
+
+using namespace Containers::Literals;
+
+const struct {
+    const char* name;
+    Containers::StringView data;
+    const char* message;
+} DecodeMeshInvalidData[]{
+    {"empty", ""_s,
+        "invalid signature"},
+    {"invalid signature", "MMSh\x01\x01\x00\x00\x00\x00"_s,
+        "invalid signature"},
+    {"truncated header", "MMSH\x01\x01\x00\x00"_s,
+        "truncated header"},
+    {"unsupported version", "MMSH\x02\x01\x00\x00\x00\x00"_s,
+        "unsupported version 2"},
+    {"invalid primitive", "MMSH\x01\x00\x00\x00\x00\x00"_s,
+        "invalid primitive 0x0"},
+    {"invalid index type", "MMSH\x01\x01\x04\x00\x00\x00"_s,
+        "invalid index type 4"},
+    {"index count but no index type", "MMSH\x01\x01\x00\x03\x00\x00"_s,
+        "invalid index type 0"},
+    {"too large index count", "MMSH\x01\x01\x01\x80\x80\x80\x80\x10\x00\x00"_s,
+        "expected index and vertex count to fit into 32 bits but got 4294967296 and 0"},
+    {"too many attributes", "MMSH\x01\x01\x00\x00\x00\x05\x01\x01\x00\x00"_s,
+        "invalid attribute count 5"},
+    {"truncated attribute header", "MMSH\x01\x01\x00\x00\x00\x01\x80\x80\x02\x01"_s,
+        "truncated header"},
+    {"invalid attribute name", "MMSH\x01\x01\x00\x00\x00\x01\x00\x01\x00\x00"_s,
+        "invalid attribute 0 name 0x0"},
+    {"invalid builtin attribute name", "MMSH\x01\x01\x00\x00\x00\x01\x7f\x01\x00\x00"_s,
+        "invalid attribute 0 name 0x7f"},
+    {"invalid attribute format", "MMSH\x01\x01\x00\x00\x00\x01\x80\x80\x02\x00\x00\x00"_s,
+        "invalid attribute 0 format 0x0"},
+    {"incompatible attribute format", "MMSH\x01\x01\x00\x00\x00\x01\x01\x01\x00\x00"_s,
+        "VertexFormat::Float is not a valid format for Trade::MeshAttribute::Position"},
+    {"array not allowed", "MMSH\x01\x01\x00\x00\x00\x01\x09\x0c\x03\x00"_s,
+        "invalid array size 3 for Trade::MeshAttribute::ObjectId"},
+    {"array expected", "MMSH\x01\x01\x00\x00\x00\x01\x08\x01\x00\x00"_s,
+        "invalid array size 0 for Trade::MeshAttribute::Weights"},
+    {"morph target not allowed", "MMSH\x01\x01\x00\x00\x00\x01\x09\x0c\x00\x01"_s,
+        "invalid morph target ID 0 for Trade::MeshAttribute::ObjectId"},
+    {"morph target ID too large", "MMSH\x01\x01\x00\x00\x00\x01\x80\x80\x02\x01\x00\x81\x01"_s,
+        "invalid morph target ID 128 for Trade::MeshAttribute::Custom(0)"},
+    {"truncated index data", "MMSH\x01\x01\x02\x02\x00\x00\x03\x00\x00"_s,
+        "truncated index data"},
+    {"truncated attribute data", "MMSH\x01\x01\x00\x00\x02\x01\x80\x80\x02\x01\x00\x00\x03\x01"_s,
+        "truncated data for attribute 0"},
+    {"empty mesh with attribute data", "MMSH\x01\x01\x00\x00\x00\x01\x80\x80\x02\x01\x00\x00\x01\x01"_s,
+        "expected no data for attribute 0 of an empty mesh but got 1 bytes"},
+    {"trailing data", "MMSH\x01\x01\x00\x00\x00\x00\x00"_s,
+        "expected 10 bytes but got 11"},
+};
+
+EncodeTest::EncodeTest() {
+    addTests({&EncodeTest::encodeIndices,
+              &EncodeTest::encodeDecodeIndices<UnsignedInt>,
+              &EncodeTest::encodeDecodeIndices<UnsignedShort>,
+              &EncodeTest::encodeDecodeIndices<UnsignedByte>,
+              &EncodeTest::encodeIndicesTypeErased,
+              &EncodeTest::encodeIndicesTypeErasedNotContiguous,
+              &EncodeTest::encodeIndicesTypeErasedInvalidSize,
+              &EncodeTest::decodeIndicesInvalid,
+
+              &EncodeTest::encodeVertices,
+              &EncodeTest::encodeDecodeVertices,
+              &EncodeTest::encodeDecodeVerticesEmpty,
+              &EncodeTest::decodeVerticesInvalid,
+
+              &EncodeTest::encodeDecodeMesh,
+              &EncodeTest::encodeDecodeMeshNotIndexed,
+              &EncodeTest::encodeDecodeMeshEmpty,
+              &EncodeTest::encodeMeshImplementationSpecificIndexType,
+              &EncodeTest::encodeMeshImplementationSpecificVertexFormat});
+
+    addInstancedTests({&EncodeTest::decodeMeshInvalid},
+        Containers::arraySize(DecodeMeshInvalidData));
+}
+
+void EncodeTest::encodeIndices() {
+    const UnsignedInt indices[]{0, 1, 2, 2, 1, 3, 200};
+    Containers::Array<char> encoded = MeshTools::encodeIndices(indices);
+
+    /* Differences 0, 1, 1, 0, -1, 2, 197, zigzag-encoded to 0, 2, 2, 0, 1, 4,
+       394, the last taking two bytes */
+    CORRADE_COMPARE(Containers::StringView{encoded},
+        "\x00\x02\x02\x00\x01\x04\x8a\x03"_s);
+}
+
+template<class T> void EncodeTest::encodeDecodeIndices() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Covering wraparound and both extremes of the range */
+    const T indices[]{
+        0, 1, 2, 2, 1, 3,
+        T(~T{}), 0, T(~T{}), T(~T{} - 1), 5, 5, 5
+    };
+    Containers::Array<char> encoded = MeshTools::encodeIndices(indices);
+    CORRADE_COMPARE_AS(encoded.size(), Containers::arraySize(indices)*5,
+        TestSuite::Compare::LessOrEqual);
+
+    T decoded[Containers::arraySize(indices)];
+    CORRADE_VERIFY(decodeIndicesInto(encoded, decoded));
+    CORRADE_COMPARE_AS(Containers::arrayView(decoded),
+        Containers::arrayView(indices),
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::encodeIndicesTypeErased() {
+    const UnsignedShort indices[]{0, 1, 2, 2, 1, 3, 200};
+    Containers::Array<char> encoded = MeshTools::encodeIndices(Containers::arrayCast<2, const char>(Containers::stridedArrayView(indices)));
+    CORRADE_COMPARE(Containers::StringView{encoded},
+        "\x00\x02\x02\x00\x01\x04\x8a\x03"_s);
+}
+
+void EncodeTest::encodeIndicesTypeErasedNotContiguous() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*4]{};
+    Containers::StridedArrayView2D<const char> indicesNonContiguous{indices, {6, 2}, {4, 2}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::encodeIndices(indicesNonContiguous);
+    CORRADE_COMPARE(out.str(), "MeshTools::encodeIndices(): second view dimension is not contiguous\n");
+}
+
+void EncodeTest::encodeIndicesTypeErasedInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char indices[6*3]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::encodeIndices(Containers::StridedArrayView2D<const char>{indices, {6, 3}});
+    CORRADE_COMPARE(out.str(), "MeshTools::encodeIndices(): expected index type size 1, 2 or 4 but got 3\n");
+}
+
+void EncodeTest::decodeIndicesInvalid() {
+    UnsignedInt indices[2];
+    UnsignedByte indices8[1];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!decodeIndicesInto("\x02\x80"_s, indices));
+    CORRADE_VERIFY(!decodeIndicesInto("\xff\xff\xff\xff\x7f"_s, Containers::arrayView(indices).prefix(1)));
+    CORRADE_VERIFY(!decodeIndicesInto("\x02\x02\x02"_s, indices));
+    CORRADE_VERIFY(!decodeIndicesInto("\x80\x04"_s, indices8));
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::decodeIndicesInto(): invalid or truncated data for index 1 out of 2\n"
+        "MeshTools::decodeIndicesInto(): invalid or truncated data for index 0 out of 1\n"
+        "MeshTools::decodeIndicesInto(): expected 2 bytes for 2 indices but got 3\n"
+        "MeshTools::decodeIndicesInto(): index 0 with value 256 doesn't fit into a 8-bit type\n");
+}
+
+void EncodeTest::encodeVertices() {
+    const char vertices[]{
+        1, 0,
+        2, 0,
+        2, 0
+    };
+    Containers::Array<char> encoded = MeshTools::encodeVertices(Containers::StridedArrayView2D<const char>{vertices, {3, 2}});
+
+    /* Differences of the first bytes are 1, 1, 0, of the second bytes 0, 0,
+       0, with the four zeros collapsed into a single run */
+    CORRADE_COMPARE(Containers::StringView{encoded},
+        "\x01\x01\x00\x03"_s);
+}
+
+void EncodeTest::encodeDecodeVertices() {
+    struct Vertex {
+        Vector3 position;
+        UnsignedInt objectId;
+    } vertices[100];
+    for(std::size_t i = 0; i != Containers::arraySize(vertices); ++i) {
+        vertices[i].position = {Float(i)*0.25f, 1.0f, -Float(i)};
+        vertices[i].objectId = 0xdeadbeef;
+    }
+
+    /* Encoding just the positions from the strided view */
+    const Containers::StridedArrayView2D<const char> positions = Containers::arrayCast<2, const char>(Containers::stridedArrayView(vertices).slice(&Vertex::position));
+    Containers::Array<char> encoded = MeshTools::encodeVertices(positions);
+
+    /* The Y coordinate is constant and the others are slowly changing, so the
+       output should be smaller */
+    CORRADE_COMPARE_AS(encoded.size(), sizeof(Vector3)*Containers::arraySize(vertices),
+        TestSuite::Compare::Less);
+
+    Vector3 decoded[Containers::arraySize(vertices)];
+    CORRADE_VERIFY(decodeVerticesInto(encoded, Containers::arrayCast<2, char>(Containers::stridedArrayView(decoded))));
+    CORRADE_COMPARE_AS(Containers::arrayView(decoded),
+        Containers::stridedArrayView(vertices).slice(&Vertex::position),
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::encodeDecodeVerticesEmpty() {
+    Containers::Array<char> encoded = MeshTools::encodeVertices(Containers::StridedArrayView2D<const char>{nullptr, {0, 4}});
+    CORRADE_COMPARE(encoded.size(), 0);
+
+    CORRADE_VERIFY(decodeVerticesInto(encoded, Containers::StridedArrayView2D<char>{nullptr, {0, 4}}));
+}
+
+void EncodeTest::decodeVerticesInvalid() {
+    char vertices[2];
+    const Containers::StridedArrayView2D<char> view{vertices, {2, 1}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!decodeVerticesInto("\x01"_s, view));
+    CORRADE_VERIFY(!decodeVerticesInto("\x00"_s, view));
+    CORRADE_VERIFY(!decodeVerticesInto("\x00\x05"_s, view));
+    CORRADE_VERIFY(!decodeVerticesInto("\x01\x01\x01"_s, view));
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::decodeVerticesInto(): expected more than 1 bytes for 2 vertices of 1 bytes\n"
+        "MeshTools::decodeVerticesInto(): invalid or truncated run length at byte 1\n"
+        "MeshTools::decodeVerticesInto(): data larger than expected for 2 vertices of 1 bytes\n"
+        "MeshTools::decodeVerticesInto(): data larger than expected for 2 vertices of 1 bytes\n");
+}
+
+void EncodeTest::encodeDecodeMesh() {
+    const Trade::MeshData mesh = Primitives::icosphereSolid(2);
+    CORRADE_VERIFY(mesh.isIndexed());
+
+    Containers::Array<char> encoded = encodeMesh(mesh);
+    CORRADE_COMPARE_AS(encoded.size(), mesh.indexData().size() + mesh.vertexData().size(),
+        TestSuite::Compare::Less);
+
+    Containers::Optional<Trade::MeshData> decoded = decodeMesh(encoded);
+    CORRADE_VERIFY(decoded);
+    CORRADE_COMPARE(decoded->primitive(), mesh.primitive());
+    CORRADE_VERIFY(decoded->isIndexed());
+    CORRADE_COMPARE(decoded->indexType(), mesh.indexType());
+    CORRADE_COMPARE_AS(decoded->indicesAsArray(),
+        mesh.indicesAsArray(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(decoded->vertexCount(), mesh.vertexCount());
+    CORRADE_COMPARE(decoded->attributeCount(), mesh.attributeCount());
+    CORRADE_COMPARE_AS(decoded->positions3DAsArray(),
+        mesh.positions3DAsArray(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(decoded->normalsAsArray(),
+        mesh.normalsAsArray(),
+        TestSuite::Compare::Container);
+}
+
+void EncodeTest::encodeDecodeMeshNotIndexed() {
+    const struct Vertex {
+        Vector3 position;
+        UnsignedByte custom[3];
+        Vector3 positionMorphTarget;
+    } vertices[]{
+        {{1.0f, 2.0f, 3.0f}, {1, 2, 3}, {4.0f, 5.0f, 6.0f}},
+        {{1.5f, 2.0f, 3.0f}, {1, 2, 4}, {4.5f, 5.0f, 6.0f}},
+        {{2.0f, 2.0f, 3.0f}, {1, 3, 5}, {5.0f, 5.0f, 6.0f}},
+    };
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+    const Trade::MeshData mesh{MeshPrimitive::Lines, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::meshAttributeCustom(17), VertexFormat::UnsignedByte, view.slice(&Vertex::custom), 3},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::positionMorphTarget), 0},
+    }};
+
+    Containers::Optional<Trade::MeshData> decoded = decodeMesh(encodeMesh(mesh));
+    CORRADE_VERIFY(decoded);
+    CORRADE_COMPARE(decoded->primitive(), MeshPrimitive::Lines);
+    CORRADE_VERIFY(!decoded->isIndexed());
+    CORRADE_COMPARE(decoded->vertexCount(), 3);
+    CORRADE_COMPARE(decoded->attributeCount(), 3);
+
+    /* The layout is interleaved with the three-byte attribute padded to four
+       bytes */
+    CORRADE_COMPARE(decoded->attributeName(0), Trade::MeshAttribute::Position);
+    CORRADE_COMPARE(decoded->attributeFormat(0), VertexFormat::Vector3);
+    CORRADE_COMPARE(decoded->attributeOffset(0), 0);
+    CORRADE_COMPARE(decoded->attributeStride(0), 28);
+    CORRADE_COMPARE(decoded->attributeMorphTargetId(0), -1);
+
+    CORRADE_COMPARE(decoded->attributeName(1), Trade::meshAttributeCustom(17));
+    CORRADE_COMPARE(decoded->attributeFormat(1), VertexFormat::UnsignedByte);
+    CORRADE_COMPARE(decoded->attributeArraySize(1), 3);
+    CORRADE_COMPARE(decoded->attributeOffset(1), 12);
+    CORRADE_COMPARE(decoded->attributeStride(1), 28);
+
+    CORRADE_COMPARE(decoded->attributeName(2), Trade::MeshAttribute::Position);
+    CORRADE_COMPARE(decoded->attributeOffset(2), 16);
+    CORRADE_COMPARE(decoded->attributeStride(2), 28);
+    CORRADE_COMPARE(decoded->attributeMorphTargetId(2), 0);
+
+    CORRADE_COMPARE_AS(decoded->attribute<Vector3>(0),
+        view.slice(&Vertex::position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(decoded->attribute<Vector3>(2),
+        view.slice(&Vertex::positionMorphTarget),
+        TestSuite::Compare::Container);
+    const Containers::StridedArrayView2D<const UnsignedByte> custom = decoded->attribute<UnsignedByte[]>(1);
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(custom[i][0], vertices[i].custom[0]);
+        CORRADE_COMPARE(custom[i][1], vertices[i].custom[1]);
+        CORRADE_COMPARE(custom[i][2], vertices[i].custom[2]);
+    }
+}
+
+void EncodeTest::encodeDecodeMeshEmpty() {
+    const Trade::MeshData mesh{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{MeshIndexType::UnsignedShort, nullptr},
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr}
+        }};
+
+    Containers::Optional<Trade::MeshData> decoded = decodeMesh(encodeMesh(mesh));
+    CORRADE_VERIFY(decoded);
+    CORRADE_COMPARE(decoded->primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(decoded->isIndexed());
+    CORRADE_COMPARE(decoded->indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(decoded->indexCount(), 0);
+    CORRADE_COMPARE(decoded->vertexCount(), 0);
+    CORRADE_COMPARE(decoded->attributeCount(), 1);
+    CORRADE_COMPARE(decoded->attributeFormat(0), VertexFormat::Vector3);
+}
+
+void EncodeTest::encodeMeshImplementationSpecificIndexType() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MeshData mesh{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}},
+        nullptr, {}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    encodeMesh(mesh);
+    CORRADE_COMPARE(out.str(), "MeshTools::encodeMesh(): mesh has an implementation-specific index type 0xcaca\n");
+}
+
+void EncodeTest::encodeMeshImplementationSpecificVertexFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MeshData mesh{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, vertexFormatWrap(0xcaca), nullptr}
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    encodeMesh(mesh);
+    CORRADE_COMPARE(out.str(), "MeshTools::encodeMesh(): attribute 1 has an implementation-specific format 0xcaca\n");
+}
+
+void EncodeTest::decodeMeshInvalid() {
+    auto&& data = DecodeMeshInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!decodeMesh(data.data));
+    CORRADE_COMPARE(out.str(), Utility::formatString("MeshTools::decodeMesh(): {}\n", data.message));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::EncodeTest)
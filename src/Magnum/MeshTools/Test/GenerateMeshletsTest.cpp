@@ -0,0 +1,522 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2022 Pablo Escobar <mail@rvrs.in>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/GenerateIndices.h"
+#include "Magnum/MeshTools/GenerateMeshlets.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+using namespace Math::Literals;
+
+struct GenerateMeshletsTest: TestSuite::Tester {
+    explicit GenerateMeshletsTest();
+
+    void meshletData();
+    void meshletDataInvalidId();
+
+    void generate();
+    void generateEmpty();
+    void generateVertexLimit();
+    void generateTriangleLimit();
+    void generateDegenerateTriangles();
+    void generateBoundsFlat();
+    void generateBoundsWide();
+    void generateInvalid();
+
+    void generateMeshData();
+    void generateMeshDataNotIndexed();
+    void generateMeshDataTriangleStrip();
+    void generateMeshDataInvalid();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt maxVertices, maxTriangles;
+} GenerateData[]{
+    {"defaults", 64, 124},
+    {"vertex-limited", 32, 124},
+    {"triangle-limited", 256, 16},
+    {"minimal", 3, 1}
+};
+
+GenerateMeshletsTest::GenerateMeshletsTest() {
+    addTests({&GenerateMeshletsTest::meshletData,
+              &GenerateMeshletsTest::meshletDataInvalidId});
+
+    addInstancedTests({&GenerateMeshletsTest::generate},
+        Containers::arraySize(GenerateData));
+
+    addTests({&GenerateMeshletsTest::generateEmpty,
+              &GenerateMeshletsTest::generateVertexLimit,
+              &GenerateMeshletsTest::generateTriangleLimit,
+              &GenerateMeshletsTest::generateDegenerateTriangles,
+              &GenerateMeshletsTest::generateBoundsFlat,
+              &GenerateMeshletsTest::generateBoundsWide,
+              &GenerateMeshletsTest::generateInvalid,
+
+              &GenerateMeshletsTest::generateMeshData,
+              &GenerateMeshletsTest::generateMeshDataNotIndexed,
+              &GenerateMeshletsTest::generateMeshDataTriangleStrip,
+              &GenerateMeshletsTest::generateMeshDataInvalid});
+}
+
+void GenerateMeshletsTest::meshletData() {
+    Containers::Array<Meshlet> meshlets{InPlaceInit, {
+        {0, 3, 0, 1, {}, 1.0f, {}, {}, 1.0f},
+        {3, 4, 1, 2, {}, 1.0f, {}, {}, 1.0f}
+    }};
+    Containers::Array<UnsignedInt> vertices{InPlaceInit, {
+        5, 6, 7, 1, 2, 3, 4
+    }};
+    Containers::Array<Vector3ub> triangles{InPlaceInit, {
+        {0, 1, 2}, {0, 1, 2}, {2, 3, 0}
+    }};
+    const Meshlet* meshletPointer = meshlets.data();
+    const UnsignedInt* vertexPointer = vertices.data();
+    const Vector3ub* trianglePointer = triangles.data();
+
+    MeshletData a{Utility::move(meshlets), Utility::move(vertices), Utility::move(triangles)};
+    CORRADE_COMPARE(a.meshlets().data(), meshletPointer);
+    CORRADE_COMPARE(a.vertices().data(), vertexPointer);
+    CORRADE_COMPARE(a.triangles().data(), trianglePointer);
+    CORRADE_COMPARE_AS(a.vertices(1), Containers::arrayView<UnsignedInt>({
+        1, 2, 3, 4
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.triangles(1), Containers::arrayView<Vector3ub>({
+        {0, 1, 2}, {2, 3, 0}
+    }), TestSuite::Compare::Container);
+
+    /* Move */
+    MeshletData b = Utility::move(a);
+    CORRADE_COMPARE(b.meshlets().data(), meshletPointer);
+    CORRADE_VERIFY(a.meshlets().isEmpty());
+
+    MeshletData c{{}, {}, {}};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.meshlets().data(), meshletPointer);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<MeshletData>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<MeshletData>::value);
+    CORRADE_VERIFY(!std::is_copy_constructible<MeshletData>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<MeshletData>::value);
+
+    /* Release */
+    Containers::Array<Meshlet> releasedMeshlets = c.releaseMeshlets();
+    Containers::Array<UnsignedInt> releasedVertices = c.releaseVertices();
+    Containers::Array<Vector3ub> releasedTriangles = c.releaseTriangles();
+    CORRADE_COMPARE(releasedMeshlets.data(), meshletPointer);
+    CORRADE_COMPARE(releasedVertices.data(), vertexPointer);
+    CORRADE_COMPARE(releasedTriangles.data(), trianglePointer);
+    CORRADE_VERIFY(c.meshlets().isEmpty());
+    CORRADE_VERIFY(c.vertices().isEmpty());
+    CORRADE_VERIFY(c.triangles().isEmpty());
+}
+
+void GenerateMeshletsTest::meshletDataInvalidId() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    MeshletData data{Containers::Array<Meshlet>{1}, {}, {}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    data.vertices(1);
+    data.triangles(1);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::MeshletData::vertices(): index 1 out of range for 1 meshlets\n"
+        "MeshTools::MeshletData::triangles(): index 1 out of range for 1 meshlets\n");
+}
+
+/* A 60x60 degree patch of a unit sphere around +Z, made of 16x16 quads
+   ordered row by row. Every subset of it has a normal cone narrow enough to
+   be usable for culling. */
+enum: UnsignedInt { PatchSize = 16 };
+
+Containers::Array<Vector3> patchPositions() {
+    Containers::Array<Vector3> out{NoInit, (PatchSize + 1)*(PatchSize + 1)};
+    for(UnsignedInt y = 0; y != PatchSize + 1; ++y) {
+        for(UnsignedInt x = 0; x != PatchSize + 1; ++x) {
+            const Rad longitude = Rad{Deg(-30.0f + 60.0f*x/PatchSize)};
+            const Rad latitude = Rad{Deg(-30.0f + 60.0f*y/PatchSize)};
+            out[y*(PatchSize + 1) + x] = {
+                Math::sin(longitude)*Math::cos(latitude),
+                Math::sin(latitude),
+                Math::cos(longitude)*Math::cos(latitude)
+            };
+        }
+    }
+    return out;
+}
+
+Containers::Array<UnsignedInt> patchIndices() {
+    Containers::Array<UnsignedInt> out{NoInit, PatchSize*PatchSize*6};
+    for(UnsignedInt y = 0; y != PatchSize; ++y) {
+        for(UnsignedInt x = 0; x != PatchSize; ++x) {
+            const UnsignedInt i = y*(PatchSize + 1) + x;
+            UnsignedInt* quad = out.data() + (y*PatchSize + x)*6;
+            quad[0] = i;
+            quad[1] = i + 1;
+            quad[2] = i + PatchSize + 1;
+            quad[3] = i + PatchSize + 1;
+            quad[4] = i + 1;
+            quad[5] = i + PatchSize + 2;
+        }
+    }
+    return out;
+}
+
+void GenerateMeshletsTest::generate() {
+    auto&& data = GenerateData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<UnsignedInt> indices = patchIndices();
+    const Containers::Array<Vector3> positions = patchPositions();
+
+    MeshletData meshlets = generateMeshlets(indices, positions, data.maxVertices, data.maxTriangles);
+    CORRADE_VERIFY(!meshlets.meshlets().isEmpty());
+    CORRADE_COMPARE(meshlets.triangles().size(), indices.size()/3);
+
+    UnsignedInt vertexOffset = 0;
+    UnsignedInt triangleOffset = 0;
+    for(std::size_t i = 0; i != meshlets.meshlets().size(); ++i) {
+        CORRADE_ITERATION(i);
+        const Meshlet& meshlet = meshlets.meshlets()[i];
+
+        /* Meshlets are tightly packed and within limits */
+        CORRADE_COMPARE(meshlet.vertexOffset, vertexOffset);
+        CORRADE_COMPARE(meshlet.triangleOffset, triangleOffset);
+        CORRADE_COMPARE_AS(meshlet.vertexCount, data.maxVertices,
+            TestSuite::Compare::LessOrEqual);
+        CORRADE_COMPARE_AS(meshlet.triangleCount, data.maxTriangles,
+            TestSuite::Compare::LessOrEqual);
+        CORRADE_COMPARE_AS(meshlet.triangleCount, 0,
+            TestSuite::Compare::Greater);
+        vertexOffset += meshlet.vertexCount;
+        triangleOffset += meshlet.triangleCount;
+
+        /* Triangles map back to the original indices in the same order */
+        const Containers::ArrayView<const UnsignedInt> vertices = meshlets.vertices(i);
+        const Containers::ArrayView<const Vector3ub> triangles = meshlets.triangles(i);
+        for(std::size_t j = 0; j != triangles.size(); ++j) for(std::size_t k = 0; k != 3; ++k) {
+            CORRADE_COMPARE_AS(triangles[j][k], meshlet.vertexCount,
+                TestSuite::Compare::Less);
+            CORRADE_COMPARE(vertices[triangles[j][k]], indices[(meshlet.triangleOffset + j)*3 + k]);
+        }
+
+        /* All vertices are inside the bounding sphere */
+        for(const UnsignedInt vertex: vertices)
+            CORRADE_COMPARE_AS((positions[vertex] - meshlet.center).length(), meshlet.radius*1.0001f,
+                TestSuite::Compare::LessOrEqual);
+
+        /* The normal cone should be usable, with all triangle normals within
+           it. The minimal variant has just one triangle per meshlet. */
+        CORRADE_COMPARE(meshlet.coneAxis.length(), 1.0f);
+        CORRADE_COMPARE_AS(meshlet.coneCutoff, 1.0f,
+            TestSuite::Compare::Less);
+        const Float cosine = Math::sqrt(1.0f - meshlet.coneCutoff*meshlet.coneCutoff);
+        for(const Vector3ub& triangle: triangles) {
+            const Vector3 a = positions[vertices[triangle[0]]];
+            const Vector3 normal = Math::cross(positions[vertices[triangle[1]]] - a, positions[vertices[triangle[2]]] - a).normalized();
+            CORRADE_COMPARE_AS(Math::dot(normal, meshlet.coneAxis), cosine*0.9999f,
+                TestSuite::Compare::GreaterOrEqual);
+
+            /* And the apex is behind all triangle planes */
+            CORRADE_COMPARE_AS(Math::dot(meshlet.coneApex - a, normal), 1.0e-5f,
+                TestSuite::Compare::LessOrEqual);
+        }
+
+        /* The patch is convex and centered at origin, so the cone axis
+           points roughly away from the origin */
+        CORRADE_COMPARE_AS(Math::dot(meshlet.coneAxis, meshlet.center.normalized()), 0.9f,
+            TestSuite::Compare::Greater);
+    }
+
+    CORRADE_COMPARE(vertexOffset, meshlets.vertices().size());
+    CORRADE_COMPARE(triangleOffset, meshlets.triangles().size());
+}
+
+void GenerateMeshletsTest::generateEmpty() {
+    MeshletData meshlets = generateMeshlets(Containers::StridedArrayView1D<const UnsignedInt>{}, Containers::StridedArrayView1D<const Vector3>{});
+    CORRADE_VERIFY(meshlets.meshlets().isEmpty());
+    CORRADE_VERIFY(meshlets.vertices().isEmpty());
+    CORRADE_VERIFY(meshlets.triangles().isEmpty());
+}
+
+/* A flat strip of quads in the XY plane facing +Z, 2*n + 2 vertices */
+Containers::Array<Vector3> stripPositions(UnsignedInt quadCount) {
+    Containers::Array<Vector3> out{NoInit, quadCount*2 + 2};
+    for(UnsignedInt i = 0; i != quadCount + 1; ++i) {
+        out[i*2 + 0] = {Float(i), 0.0f, 0.0f};
+        out[i*2 + 1] = {Float(i), 1.0f, 0.0f};
+    }
+    return out;
+}
+
+Containers::Array<UnsignedInt> stripIndices(UnsignedInt quadCount) {
+    Containers::Array<UnsignedInt> out{NoInit, quadCount*6};
+    for(UnsignedInt i = 0; i != quadCount; ++i) {
+        out[i*6 + 0] = i*2 + 0;
+        out[i*6 + 1] = i*2 + 2;
+        out[i*6 + 2] = i*2 + 1;
+        out[i*6 + 3] = i*2 + 1;
+        out[i*6 + 4] = i*2 + 2;
+        out[i*6 + 5] = i*2 + 3;
+    }
+    return out;
+}
+
+void GenerateMeshletsTest::generateVertexLimit() {
+    /* Each quad adds two new vertices, the first triangle of a quad one and
+       the second another one. With a limit of 6 vertices, a meshlet fits
+       two quads, which is just 4 triangles. */
+    MeshletData meshlets = generateMeshlets(stripIndices(5), stripPositions(5), 6, 124);
+    CORRADE_COMPARE(meshlets.meshlets().size(), 3);
+    CORRADE_COMPARE(meshlets.meshlets()[0].vertexCount, 6);
+    CORRADE_COMPARE(meshlets.meshlets()[0].triangleCount, 4);
+    /* The next meshlet has to start from scratch */
+    CORRADE_COMPARE(meshlets.meshlets()[1].vertexCount, 6);
+    CORRADE_COMPARE(meshlets.meshlets()[1].triangleCount, 4);
+    CORRADE_COMPARE(meshlets.meshlets()[2].vertexCount, 4);
+    CORRADE_COMPARE(meshlets.meshlets()[2].triangleCount, 2);
+
+    CORRADE_COMPARE_AS(meshlets.vertices(1), Containers::arrayView<UnsignedInt>({
+        4, 6, 5, 7, 8, 9
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.triangles(1), Containers::arrayView<Vector3ub>({
+        {0, 1, 2}, {2, 1, 3}, {1, 4, 3}, {3, 4, 5}
+    }), TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::generateTriangleLimit() {
+    MeshletData meshlets = generateMeshlets(stripIndices(5), stripPositions(5), 64, 3);
+    CORRADE_COMPARE(meshlets.meshlets().size(), 4);
+    CORRADE_COMPARE(meshlets.meshlets()[0].vertexCount, 5);
+    CORRADE_COMPARE(meshlets.meshlets()[0].triangleCount, 3);
+    CORRADE_COMPARE(meshlets.meshlets()[1].vertexCount, 5);
+    CORRADE_COMPARE(meshlets.meshlets()[1].triangleCount, 3);
+    CORRADE_COMPARE(meshlets.meshlets()[2].vertexCount, 5);
+    CORRADE_COMPARE(meshlets.meshlets()[2].triangleCount, 3);
+    CORRADE_COMPARE(meshlets.meshlets()[3].vertexCount, 3);
+    CORRADE_COMPARE(meshlets.meshlets()[3].triangleCount, 1);
+}
+
+void GenerateMeshletsTest::generateDegenerateTriangles() {
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f}
+    };
+    /* The first triangle references the same vertex twice, so it adds just
+       two new vertices. With a limit of three vertices, the next triangle
+       thus fits as well. */
+    const UnsignedInt indices[]{
+        0, 1, 1,
+        0, 1, 2,
+        2, 1, 3
+    };
+    MeshletData meshlets = generateMeshlets(indices, positions, 3, 124);
+    CORRADE_COMPARE(meshlets.meshlets().size(), 2);
+    CORRADE_COMPARE(meshlets.meshlets()[0].vertexCount, 3);
+    CORRADE_COMPARE(meshlets.meshlets()[0].triangleCount, 2);
+    CORRADE_COMPARE_AS(meshlets.triangles(0), Containers::arrayView<Vector3ub>({
+        {0, 1, 1}, {0, 1, 2}
+    }), TestSuite::Compare::Container);
+
+    /* The degenerate triangle is ignored for the cone */
+    CORRADE_COMPARE(meshlets.meshlets()[0].coneAxis, Vector3::zAxis());
+    CORRADE_COMPARE(meshlets.meshlets()[0].coneCutoff, 0.0f);
+
+    /* A meshlet consisting of just degenerate triangles has no usable cone */
+    const UnsignedInt degenerateIndices[]{
+        0, 1, 1,
+        2, 2, 2
+    };
+    MeshletData degenerate = generateMeshlets(degenerateIndices, positions);
+    CORRADE_COMPARE(degenerate.meshlets().size(), 1);
+    CORRADE_COMPARE(degenerate.meshlets()[0].vertexCount, 3);
+    CORRADE_COMPARE(degenerate.meshlets()[0].coneAxis, Vector3{});
+    CORRADE_COMPARE(degenerate.meshlets()[0].coneCutoff, 1.0f);
+}
+
+void GenerateMeshletsTest::generateBoundsFlat() {
+    MeshletData meshlets = generateMeshlets(stripIndices(2), stripPositions(2));
+    CORRADE_COMPARE(meshlets.meshlets().size(), 1);
+
+    /* All normals are the same, so the cone has zero width and the apex is
+       directly in the plane */
+    const Meshlet& meshlet = meshlets.meshlets()[0];
+    CORRADE_COMPARE(meshlet.coneAxis, Vector3::zAxis());
+    CORRADE_COMPARE(meshlet.coneCutoff, 0.0f);
+    CORRADE_COMPARE(meshlet.coneApex, meshlet.center);
+    /* The bounding sphere isn't minimal, so just check that it encloses the
+       2x1 rectangle */
+    CORRADE_COMPARE_AS(meshlet.radius, Vector2{1.0f, 0.5f}.length(),
+        TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE(meshlet.center.z(), 0.0f);
+}
+
+void GenerateMeshletsTest::generateBoundsWide() {
+    /* Two triangles facing opposite directions */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f},
+    };
+    const UnsignedInt indices[]{
+        0, 1, 2,
+        0, 2, 1,
+    };
+    MeshletData opposite = generateMeshlets(indices, positions);
+    CORRADE_COMPARE(opposite.meshlets().size(), 1);
+    CORRADE_COMPARE(opposite.meshlets()[0].coneAxis, Vector3{});
+    CORRADE_COMPARE(opposite.meshlets()[0].coneCutoff, 1.0f);
+
+    /* Two triangles at a right angle, the cone has a 45 degree half-angle */
+    const UnsignedInt rightAngleIndices[]{
+        0, 1, 2,
+        0, 3, 1,
+    };
+    MeshletData rightAngle = generateMeshlets(rightAngleIndices, positions);
+    CORRADE_COMPARE(rightAngle.meshlets().size(), 1);
+    CORRADE_COMPARE(rightAngle.meshlets()[0].coneAxis, (Vector3{0.0f, 1.0f, 1.0f}.normalized()));
+    CORRADE_COMPARE(rightAngle.meshlets()[0].coneCutoff, Math::sin(45.0_degf));
+
+    /* Triangles facing +Z, +Y and -Z, the cone would be a half-space, which
+       is too wide to be useful for culling */
+    const UnsignedInt halfSpaceIndices[]{
+        0, 1, 2,
+        0, 3, 1,
+        0, 2, 1,
+    };
+    MeshletData halfSpace = generateMeshlets(halfSpaceIndices, positions);
+    CORRADE_COMPARE(halfSpace.meshlets().size(), 1);
+    CORRADE_COMPARE(halfSpace.meshlets()[0].coneAxis, Vector3::yAxis());
+    CORRADE_COMPARE(halfSpace.meshlets()[0].coneCutoff, 1.0f);
+    CORRADE_COMPARE(halfSpace.meshlets()[0].coneApex, halfSpace.meshlets()[0].center);
+}
+
+void GenerateMeshletsTest::generateInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+    const UnsignedInt indices[]{0, 1, 2, 0, 1, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    generateMeshlets(Containers::arrayView(indices).prefix(5), positions);
+    generateMeshlets(indices, positions, 2, 124);
+    generateMeshlets(indices, positions, 257, 124);
+    generateMeshlets(indices, positions, 64, 0);
+    generateMeshlets(indices, positions);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::generateMeshlets(): index count not divisible by 3, got 5\n"
+        "MeshTools::generateMeshlets(): expected max vertex count to be between 3 and 256, got 2\n"
+        "MeshTools::generateMeshlets(): expected max vertex count to be between 3 and 256, got 257\n"
+        "MeshTools::generateMeshlets(): expected max triangle count to be at least 1\n"
+        "MeshTools::generateMeshlets(): index 3 out of range for 3 vertices\n");
+}
+
+void GenerateMeshletsTest::generateMeshData() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(2);
+
+    MeshletData meshlets = generateMeshlets(sphere, 32, 48);
+    MeshletData expected = generateMeshlets(sphere.indicesAsArray(), sphere.attribute<Vector3>(Trade::MeshAttribute::Position), 32, 48);
+    CORRADE_COMPARE(meshlets.meshlets().size(), expected.meshlets().size());
+    CORRADE_COMPARE_AS(meshlets.vertices(), expected.vertices(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(meshlets.triangles(), expected.triangles(),
+        TestSuite::Compare::Container);
+    for(std::size_t i = 0; i != meshlets.meshlets().size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(meshlets.meshlets()[i].center, expected.meshlets()[i].center);
+        CORRADE_COMPARE(meshlets.meshlets()[i].coneAxis, expected.meshlets()[i].coneAxis);
+    }
+}
+
+void GenerateMeshletsTest::generateMeshDataNotIndexed() {
+    const Containers::Array<Vector3> positions = stripPositions(3);
+    const Trade::MeshData mesh{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    /* Every vertex is referenced once, so the vertices are just a trivial
+       sequence */
+    MeshletData meshlets = generateMeshlets(mesh);
+    CORRADE_COMPARE(meshlets.meshlets().size(), 1);
+    CORRADE_COMPARE_AS(meshlets.vertices(),
+        generateTrivialIndices(positions.size()),
+        TestSuite::Compare::Container);
+}
+
+void GenerateMeshletsTest::generateMeshDataTriangleStrip() {
+    const Containers::Array<Vector3> positions = stripPositions(3);
+    const Trade::MeshData mesh{MeshPrimitive::TriangleStrip, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    MeshletData meshlets = generateMeshlets(mesh, 4, 124);
+    /* Each strip triangle after the second one adds a single vertex, so with
+       a limit of 4 vertices each meshlet has two triangles */
+    CORRADE_COMPARE(meshlets.meshlets().size(), 3);
+    CORRADE_COMPARE(meshlets.triangles().size(), 6);
+    CORRADE_COMPARE(meshlets.meshlets()[0].triangleCount, 2);
+    CORRADE_COMPARE(meshlets.meshlets()[1].triangleCount, 2);
+    CORRADE_COMPARE(meshlets.meshlets()[2].triangleCount, 2);
+}
+
+void GenerateMeshletsTest::generateMeshDataInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    generateMeshlets(Trade::MeshData{MeshPrimitive::Lines, 2});
+    generateMeshlets(Trade::MeshData{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, Containers::arrayView(positions)}
+    }});
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::generateMeshlets(): expected a triangle primitive, got MeshPrimitive::Lines\n"
+        "MeshTools::generateMeshlets(): the mesh has no positions\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateMeshletsTest)
@@ -25,6 +25,7 @@
 */
 
 #include <sstream>
+#include <cstring>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/ArrayViewStl.h>
 #include <Corrade/Containers/StridedArrayView.h>
@@ -37,6 +38,8 @@
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/MeshTools/GenerateNormals.h"
 #include "Magnum/Primitives/Cylinder.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Test/parallelFor.h"
 #include "Magnum/Trade/MeshData.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -69,6 +72,8 @@ struct GenerateNormalsTest: TestSuite::Tester {
     void smoothErasedNonContiguous();
     void smoothErasedWrongIndexSize();
 
+    void smoothParallel();
+
     void benchmarkFlat();
     void benchmarkSmooth();
 };
@@ -97,7 +102,9 @@ GenerateNormalsTest::GenerateNormalsTest() {
               &GenerateNormalsTest::smoothErased<UnsignedShort>,
               &GenerateNormalsTest::smoothErased<UnsignedInt>,
               &GenerateNormalsTest::smoothErasedNonContiguous,
-              &GenerateNormalsTest::smoothErasedWrongIndexSize});
+              &GenerateNormalsTest::smoothErasedWrongIndexSize,
+
+              &GenerateNormalsTest::smoothParallel});
 
     addBenchmarks({&GenerateNormalsTest::benchmarkFlat,
                    &GenerateNormalsTest::benchmarkSmooth}, 150);
@@ -441,6 +448,40 @@ void GenerateNormalsTest::benchmarkFlat() {
     CORRADE_COMPARE(Math::min(normals), (Vector3{-1.0f, -1.0f, -1.0f}));
 }
 
+using Magnum::Test::parallelForReverse;
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+using Magnum::Test::parallelForThreads;
+#endif
+
+void GenerateNormalsTest::smoothParallel() {
+    /* Over 40k vertices and 80k triangles, so it gets split into several
+       chunks */
+    const Trade::MeshData sphere = Primitives::icosphereSolid(6);
+    const Containers::StridedArrayView1D<const Vector3> positions = sphere.attribute<Vector3>(Trade::MeshAttribute::Position);
+    const Containers::StridedArrayView2D<const char> indices = sphere.indices();
+
+    Containers::Array<Vector3> expected = generateSmoothNormals(indices, positions);
+
+    /* The output should be bit-exact with the serial variant regardless of
+       the execution order */
+    Containers::Array<Vector3> serial = generateSmoothNormals(indices, positions, parallelForSerial, nullptr);
+    CORRADE_VERIFY(std::memcmp(serial.data(), expected.data(), expected.size()*sizeof(Vector3)) == 0);
+
+    /* Null executor is equivalent to parallelForSerial() */
+    Containers::Array<Vector3> null = generateSmoothNormals(indices, positions, nullptr, nullptr);
+    CORRADE_VERIFY(std::memcmp(null.data(), expected.data(), expected.size()*sizeof(Vector3)) == 0);
+
+    Containers::Array<Vector3> reverse{NoInit, positions.size()};
+    generateSmoothNormalsInto(indices, positions, reverse, parallelForReverse, nullptr);
+    CORRADE_VERIFY(std::memcmp(reverse.data(), expected.data(), expected.size()*sizeof(Vector3)) == 0);
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::size_t threadCount = 4;
+    Containers::Array<Vector3> threaded = generateSmoothNormals(indices, positions, parallelForThreads, &threadCount);
+    CORRADE_VERIFY(std::memcmp(threaded.data(), expected.data(), expected.size()*sizeof(Vector3)) == 0);
+    #endif
+}
+
 void GenerateNormalsTest::benchmarkSmooth() {
     Containers::Array<Vector3> normals{NoInit, Containers::arraySize(BeveledCubePositions)};
     CORRADE_BENCHMARK(10) {
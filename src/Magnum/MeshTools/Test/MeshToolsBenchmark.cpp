@@ -0,0 +1,163 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/CompressIndices.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/GenerateNormals.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Tipsify.h"
+#include "Magnum/MeshTools/Transform.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+/* Covers the commonly used operations of a mesh import pipeline on a
+   medium-sized mesh, to catch performance regressions in the whole library
+   rather than in particular algorithms */
+
+struct MeshToolsBenchmark: TestSuite::Tester {
+    explicit MeshToolsBenchmark();
+
+    void generateFlatNormals();
+    void generateSmoothNormals();
+    void duplicate();
+    void removeDuplicates();
+    void removeDuplicatesFuzzy();
+    void compressIndices();
+    void interleave();
+    void tipsify();
+    void transform3D();
+
+    /* Indexed, 2562 vertices and 5120 triangles */
+    Trade::MeshData _mesh{MeshPrimitive::Triangles, 0};
+    /* The above, non-indexed */
+    Trade::MeshData _duplicated{MeshPrimitive::Triangles, 0};
+};
+
+using namespace Math::Literals;
+
+MeshToolsBenchmark::MeshToolsBenchmark() {
+    addBenchmarks({&MeshToolsBenchmark::generateFlatNormals,
+                   &MeshToolsBenchmark::generateSmoothNormals,
+                   &MeshToolsBenchmark::duplicate,
+                   &MeshToolsBenchmark::removeDuplicates,
+                   &MeshToolsBenchmark::removeDuplicatesFuzzy,
+                   &MeshToolsBenchmark::compressIndices,
+                   &MeshToolsBenchmark::interleave,
+                   &MeshToolsBenchmark::tipsify,
+                   &MeshToolsBenchmark::transform3D}, 10);
+
+    _mesh = Primitives::icosphereSolid(4);
+    _duplicated = MeshTools::duplicate(_mesh);
+}
+
+void MeshToolsBenchmark::generateFlatNormals() {
+    Containers::Array<Vector3> normals{NoInit, _duplicated.vertexCount()};
+    CORRADE_BENCHMARK(10)
+        generateFlatNormalsInto(_duplicated.attribute<Vector3>(Trade::MeshAttribute::Position), normals);
+
+    CORRADE_COMPARE(normals.size(), 15360);
+}
+
+void MeshToolsBenchmark::generateSmoothNormals() {
+    Containers::Array<Vector3> normals{NoInit, _mesh.vertexCount()};
+    CORRADE_BENCHMARK(10)
+        generateSmoothNormalsInto(_mesh.indices<UnsignedInt>(), _mesh.attribute<Vector3>(Trade::MeshAttribute::Position), normals);
+
+    CORRADE_COMPARE(normals.size(), 2562);
+}
+
+void MeshToolsBenchmark::duplicate() {
+    UnsignedInt vertexCount = 0;
+    CORRADE_BENCHMARK(10)
+        vertexCount += MeshTools::duplicate(_mesh).vertexCount();
+
+    CORRADE_COMPARE(vertexCount, 10*15360);
+}
+
+void MeshToolsBenchmark::removeDuplicates() {
+    UnsignedInt vertexCount = 0;
+    CORRADE_BENCHMARK(10)
+        vertexCount += MeshTools::removeDuplicates(_duplicated).vertexCount();
+
+    CORRADE_COMPARE(vertexCount, 10*2562);
+}
+
+void MeshToolsBenchmark::removeDuplicatesFuzzy() {
+    UnsignedInt vertexCount = 0;
+    CORRADE_BENCHMARK(10)
+        vertexCount += MeshTools::removeDuplicatesFuzzy(_duplicated).vertexCount();
+
+    CORRADE_COMPARE(vertexCount, 10*2562);
+}
+
+void MeshToolsBenchmark::compressIndices() {
+    UnsignedInt indexTypeSize = 0;
+    CORRADE_BENCHMARK(10)
+        indexTypeSize += meshIndexTypeSize(MeshTools::compressIndices(_mesh).indexType());
+
+    CORRADE_COMPARE(indexTypeSize, 10*2);
+}
+
+void MeshToolsBenchmark::interleave() {
+    UnsignedInt stride = 0;
+    CORRADE_BENCHMARK(10)
+        stride += MeshTools::interleave(_mesh, {}, {}).attributeStride(0);
+
+    CORRADE_COMPARE(stride, 10*24);
+}
+
+void MeshToolsBenchmark::tipsify() {
+    Containers::Array<UnsignedInt> indices{NoInit, _mesh.indexCount()};
+    CORRADE_BENCHMARK(10) {
+        Utility::copy(_mesh.indices<UnsignedInt>(), Containers::stridedArrayView(indices));
+        tipsifyInPlace(indices, _mesh.vertexCount(), 24);
+    }
+
+    CORRADE_COMPARE(indices.size(), 15360);
+}
+
+void MeshToolsBenchmark::transform3D() {
+    UnsignedInt vertexCount = 0;
+    CORRADE_BENCHMARK(10)
+        vertexCount += MeshTools::transform3D(_mesh, Matrix4::rotationX(35.0_degf)*Matrix4::scaling(Vector3{2.0f})).vertexCount();
+
+    CORRADE_COMPARE(vertexCount, 10*2562);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::MeshToolsBenchmark)
@@ -0,0 +1,296 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2022 Pablo Escobar <mail@rvrs.in>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Optimize.h"
+#include "Magnum/MeshTools/Tipsify.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct OptimizeTest: TestSuite::Tester {
+    explicit OptimizeTest();
+
+    template<class T> void analyzeVertexCache();
+    void analyzeVertexCacheEmpty();
+    void analyzeVertexCacheInvalid();
+
+    template<class T> void optimizeOverdraw();
+    void optimizeOverdrawPermutation();
+    void optimizeOverdrawInvalid();
+
+    template<class T> void optimizeVertexFetch();
+    void optimizeVertexFetchInvalid();
+    void optimizeVertexFetchMeshData();
+    void optimizeVertexFetchMeshDataNotIndexed();
+    void optimizeVertexFetchMeshDataInvalid();
+};
+
+OptimizeTest::OptimizeTest() {
+    addTests({&OptimizeTest::analyzeVertexCache<UnsignedInt>,
+              &OptimizeTest::analyzeVertexCache<UnsignedShort>,
+              &OptimizeTest::analyzeVertexCache<UnsignedByte>,
+              &OptimizeTest::analyzeVertexCacheEmpty,
+              &OptimizeTest::analyzeVertexCacheInvalid,
+
+              &OptimizeTest::optimizeOverdraw<UnsignedInt>,
+              &OptimizeTest::optimizeOverdraw<UnsignedShort>,
+              &OptimizeTest::optimizeOverdraw<UnsignedByte>,
+              &OptimizeTest::optimizeOverdrawPermutation,
+              &OptimizeTest::optimizeOverdrawInvalid,
+
+              &OptimizeTest::optimizeVertexFetch<UnsignedInt>,
+              &OptimizeTest::optimizeVertexFetch<UnsignedShort>,
+              &OptimizeTest::optimizeVertexFetch<UnsignedByte>,
+              &OptimizeTest::optimizeVertexFetchInvalid,
+              &OptimizeTest::optimizeVertexFetchMeshData,
+              &OptimizeTest::optimizeVertexFetchMeshDataNotIndexed,
+              &OptimizeTest::optimizeVertexFetchMeshDataInvalid});
+}
+
+template<class T> void OptimizeTest::analyzeVertexCache() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Two triangles sharing an edge */
+    const T indices[]{0, 1, 2, 2, 1, 3};
+
+    /* With a large enough cache each vertex is transformed just once */
+    VertexCacheStatistics large = MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), 4, 3);
+    CORRADE_COMPARE(large.acmr, 2.0f);
+    CORRADE_COMPARE(large.atvr, 1.0f);
+
+    /* With a single-vertex cache only the second use of vertex 2 is a hit */
+    VertexCacheStatistics small = MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), 4, 1);
+    CORRADE_COMPARE(small.acmr, 2.5f);
+    CORRADE_COMPARE(small.atvr, 1.25f);
+}
+
+void OptimizeTest::analyzeVertexCacheEmpty() {
+    VertexCacheStatistics statistics = MeshTools::analyzeVertexCache(Containers::StridedArrayView1D<const UnsignedInt>{}, 0, 16);
+    CORRADE_COMPARE(statistics.acmr, 0.0f);
+    CORRADE_COMPARE(statistics.atvr, 0.0f);
+}
+
+void OptimizeTest::analyzeVertexCacheInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt indices[]{0, 1, 2, 0, 1, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices).prefix(5), 4, 16);
+    MeshTools::analyzeVertexCache(Containers::stridedArrayView(indices), 3, 16);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::analyzeVertexCache(): index count not divisible by 3, got 5\n"
+        "MeshTools::analyzeVertexCache(): index 3 out of range for 3 vertices\n");
+}
+
+template<class T> void OptimizeTest::optimizeOverdraw() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Two disconnected triangles facing -Z, one in front of the other when
+       looking from -Z. The one at Z = -1 faces away from the mesh center and
+       thus should be drawn first. */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, -1.0f},
+        {0.0f, 1.0f, -1.0f},
+        {1.0f, 0.0f, -1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 1.0f},
+        {1.0f, 0.0f, 1.0f},
+    };
+    T indices[]{3, 4, 5, 0, 1, 2};
+
+    MeshTools::optimizeOverdrawInPlace(Containers::stridedArrayView(indices), positions, 16);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<T>({
+        0, 1, 2, 3, 4, 5
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeOverdrawPermutation() {
+    Trade::MeshData sphere = Primitives::icosphereSolid(3);
+    Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+    tipsifyInPlace(indices, sphere.vertexCount(), 24);
+
+    const Float acmr = MeshTools::analyzeVertexCache(indices, sphere.vertexCount(), 24).acmr;
+    Containers::Array<UnsignedInt> triangleUseCount{ValueInit, sphere.vertexCount()};
+    for(const UnsignedInt index: indices)
+        ++triangleUseCount[index];
+
+    MeshTools::optimizeOverdrawInPlace(indices, sphere.attribute<Vector3>(Trade::MeshAttribute::Position), 24, 1.05f);
+
+    /* The triangles only get reordered, so each vertex is still referenced
+       the same number of times */
+    for(const UnsignedInt index: indices)
+        --triangleUseCount[index];
+    for(std::size_t i = 0; i != triangleUseCount.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(triangleUseCount[i], 0);
+    }
+
+    /* The cache efficiency gets worse only slightly. The threshold applies to
+       the clusters in isolation, cache contents lost at cluster boundaries
+       after reordering add a bit more on top. */
+    CORRADE_COMPARE_AS(MeshTools::analyzeVertexCache(indices, sphere.vertexCount(), 24).acmr, acmr*1.5f,
+        TestSuite::Compare::LessOrEqual);
+}
+
+void OptimizeTest::optimizeOverdrawInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+    UnsignedInt indices[]{0, 1, 2, 0, 1, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::optimizeOverdrawInPlace(Containers::stridedArrayView(indices).prefix(5), positions, 16);
+    MeshTools::optimizeOverdrawInPlace(Containers::stridedArrayView(indices), positions, 16, 0.9f);
+    MeshTools::optimizeOverdrawInPlace(Containers::stridedArrayView(indices), positions, 16);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::optimizeOverdrawInPlace(): index count not divisible by 3, got 5\n"
+        "MeshTools::optimizeOverdrawInPlace(): expected threshold to be at least 1, got 0.9\n"
+        "MeshTools::optimizeOverdrawInPlace(): index 3 out of range for 3 vertices\n");
+}
+
+template<class T> void OptimizeTest::optimizeVertexFetch() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Vertex 1 is unused */
+    T indices[]{2, 0, 3, 3, 0, 4};
+    Int data[]{10, 11, 12, 13, 14};
+
+    std::size_t count = MeshTools::optimizeVertexFetchInPlace(Containers::stridedArrayView(indices), Containers::arrayCast<2, char>(Containers::stridedArrayView(data)));
+    CORRADE_COMPARE(count, 4);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices), Containers::arrayView<T>({
+        0, 1, 2, 2, 1, 3
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(count), Containers::arrayView({
+        12, 10, 13, 14
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeVertexFetchInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[]{0, 1, 3};
+    Int data[3]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetchInPlace(Containers::stridedArrayView(indices), Containers::arrayCast<2, char>(Containers::stridedArrayView(data)));
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::optimizeVertexFetchInPlace(): index 3 out of range for 3 vertices\n");
+}
+
+void OptimizeTest::optimizeVertexFetchMeshData() {
+    const UnsignedShort indices[]{2, 0, 3, 3, 0, 4};
+    const struct Vertex {
+        Vector3 position;
+        Int id;
+    } vertices[]{
+        {{0.0f, 0.0f, 0.0f}, 10},
+        {{1.0f, 0.0f, 0.0f}, 11},
+        {{2.0f, 0.0f, 0.0f}, 12},
+        {{3.0f, 0.0f, 0.0f}, 13},
+        {{4.0f, 0.0f, 0.0f}, 14},
+    };
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+    const Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+            Trade::MeshAttributeData{Trade::meshAttributeCustom(0), view.slice(&Vertex::id)}
+        }};
+
+    Trade::MeshData optimized = MeshTools::optimizeVertexFetch(mesh);
+    CORRADE_COMPARE(optimized.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(optimized.indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(optimized.indices<UnsignedInt>(), Containers::arrayView<UnsignedInt>({
+        0, 1, 2, 2, 1, 3
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(optimized.vertexCount(), 4);
+    CORRADE_COMPARE_AS(optimized.attribute<Vector3>(Trade::MeshAttribute::Position), Containers::arrayView<Vector3>({
+        {2.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 0.0f},
+        {3.0f, 0.0f, 0.0f},
+        {4.0f, 0.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(optimized.attribute<Int>(Trade::meshAttributeCustom(0)), Containers::arrayView({
+        12, 10, 13, 14
+    }), TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeVertexFetchMeshDataNotIndexed() {
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {2.0f, 0.0f, 0.0f}
+    };
+    const Trade::MeshData mesh{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    Trade::MeshData optimized = MeshTools::optimizeVertexFetch(mesh);
+    CORRADE_VERIFY(!optimized.isIndexed());
+    CORRADE_COMPARE_AS(optimized.attribute<Vector3>(Trade::MeshAttribute::Position), Containers::arrayView(positions),
+        TestSuite::Compare::Container);
+}
+
+void OptimizeTest::optimizeVertexFetchMeshDataInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::optimizeVertexFetch(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}},
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                VertexFormat::Vector3, nullptr}
+        }});
+    MeshTools::optimizeVertexFetch(Trade::MeshData{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            VertexFormat::Vector3, nullptr},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal,
+            vertexFormatWrap(0xcaca), nullptr}
+    }});
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::optimizeVertexFetch(): mesh has an implementation-specific index type 0xcaca\n"
+        "MeshTools::optimizeVertexFetch(): attribute 1 has an implementation-specific format 0xcaca\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeTest)
@@ -0,0 +1,259 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/Quantize.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct QuantizeTest: TestSuite::Tester {
+    explicit QuantizeTest();
+
+    void quantize();
+    void quantize2D();
+    void quantizeFlat();
+    void quantizeMorphTargets();
+    void quantizeEmpty();
+    void quantizeInvalid();
+};
+
+QuantizeTest::QuantizeTest() {
+    addTests({&QuantizeTest::quantize,
+              &QuantizeTest::quantize2D,
+              &QuantizeTest::quantizeFlat,
+              &QuantizeTest::quantizeMorphTargets,
+              &QuantizeTest::quantizeEmpty,
+              &QuantizeTest::quantizeInvalid});
+}
+
+void QuantizeTest::quantize() {
+    const UnsignedShort indices[]{0, 1, 2, 2, 1, 3};
+    const struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+        Vector2 textureCoordinates;
+        UnsignedInt objectId;
+    } vertices[]{
+        {{-1.0f, 0.0f,  2.0f}, { 0.0f, 0.0f,  1.0f}, {0.0f, 0.0f}, 3},
+        {{ 3.0f, 0.0f,  2.0f}, { 1.0f, 0.0f,  0.0f}, {0.5f, 0.0f}, 5},
+        {{ 3.0f, 4.0f,  2.0f}, { 0.0f, 1.0f,  0.0f}, {1.0f, 1.0f}, 7},
+        {{-1.0f, 4.0f, -2.0f}, { 0.0f, 0.0f, -1.0f}, {0.25f, 0.75f}, 11},
+    };
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+    const Trade::MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{indices},
+        {}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, view.slice(&Vertex::textureCoordinates)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::ObjectId, view.slice(&Vertex::objectId)}
+        }};
+
+    Containers::Pair<Trade::MeshData, Matrix4> result = MeshTools::quantize(mesh);
+    const Trade::MeshData& quantized = result.first();
+    CORRADE_COMPARE(quantized.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(quantized.vertexCount(), 4);
+
+    /* Vector3sNormalized is padded to eight bytes */
+    CORRADE_COMPARE(quantized.attributeCount(), 4);
+    CORRADE_COMPARE(quantized.attributeFormat(0), VertexFormat::Vector3sNormalized);
+    CORRADE_COMPARE(quantized.attributeFormat(1), VertexFormat::Vector3sNormalized);
+    CORRADE_COMPARE(quantized.attributeFormat(2), VertexFormat::Vector2h);
+    CORRADE_COMPARE(quantized.attributeFormat(3), VertexFormat::UnsignedInt);
+    CORRADE_COMPARE(quantized.attributeOffset(0), 0);
+    CORRADE_COMPARE(quantized.attributeOffset(1), 8);
+    CORRADE_COMPARE(quantized.attributeOffset(2), 16);
+    CORRADE_COMPARE(quantized.attributeOffset(3), 20);
+    CORRADE_COMPARE(quantized.attributeStride(0), 24);
+    CORRADE_COMPARE(quantized.vertexData().size(), 4*24);
+
+    /* The values are chosen so they're representable exactly */
+    CORRADE_COMPARE(result.second(),
+        Matrix4::translation({1.0f, 2.0f, 0.0f})*Matrix4::scaling(Vector3{2.0f}));
+    CORRADE_COMPARE_AS(quantized.positions3DAsArray(), Containers::arrayView<Vector3>({
+        {-1.0f, -1.0f,  1.0f},
+        { 1.0f, -1.0f,  1.0f},
+        { 1.0f,  1.0f,  1.0f},
+        {-1.0f,  1.0f, -1.0f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(result.second().transformPoint(quantized.positions3DAsArray()[3]), vertices[3].position);
+    CORRADE_COMPARE_AS(quantized.normalsAsArray(), Containers::arrayView<Vector3>({
+        { 0.0f, 0.0f,  1.0f},
+        { 1.0f, 0.0f,  0.0f},
+        { 0.0f, 1.0f,  0.0f},
+        { 0.0f, 0.0f, -1.0f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(quantized.textureCoordinates2DAsArray(), Containers::arrayView<Vector2>({
+        {0.0f, 0.0f},
+        {0.5f, 0.0f},
+        {1.0f, 1.0f},
+        {0.25f, 0.75f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(quantized.objectIdsAsArray(), Containers::arrayView<UnsignedInt>({
+        3, 5, 7, 11
+    }), TestSuite::Compare::Container);
+
+    CORRADE_VERIFY(quantized.isIndexed());
+    CORRADE_COMPARE(quantized.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(quantized.indicesAsArray(),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 2, 1, 3}),
+        TestSuite::Compare::Container);
+}
+
+void QuantizeTest::quantize2D() {
+    const Vector2 positions[]{
+        {0.0f, 0.0f},
+        {4.0f, 2.0f},
+        {1.0f, 1.5f}
+    };
+    const Trade::MeshData mesh{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    Containers::Pair<Trade::MeshData, Matrix4> result = MeshTools::quantize(mesh);
+    const Trade::MeshData& quantized = result.first();
+    CORRADE_VERIFY(!quantized.isIndexed());
+    CORRADE_COMPARE(quantized.attributeFormat(0), VertexFormat::Vector2sNormalized);
+    CORRADE_COMPARE(quantized.attributeStride(0), 4);
+
+    /* Z is kept as an identity */
+    CORRADE_COMPARE(result.second(),
+        Matrix4::translation({2.0f, 1.0f, 0.0f})*Matrix4::scaling({2.0f, 1.0f, 1.0f}));
+    CORRADE_COMPARE_AS(quantized.positions2DAsArray(), Containers::arrayView<Vector2>({
+        {-1.0f, -1.0f},
+        { 1.0f,  1.0f},
+        {-0.5f,  0.5f}
+    }), TestSuite::Compare::Container);
+}
+
+void QuantizeTest::quantizeFlat() {
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 5.0f},
+        {2.0f, 2.0f, 5.0f},
+        {2.0f, 0.0f, 5.0f}
+    };
+    const Trade::MeshData mesh{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    /* There should be no division by zero in the flat dimension */
+    Containers::Pair<Trade::MeshData, Matrix4> result = MeshTools::quantize(mesh);
+    CORRADE_COMPARE(result.second(),
+        Matrix4::translation({1.0f, 1.0f, 5.0f})*Matrix4::scaling({1.0f, 1.0f, 1.0f}));
+    CORRADE_COMPARE_AS(result.first().positions3DAsArray(), Containers::arrayView<Vector3>({
+        {-1.0f, -1.0f, 0.0f},
+        { 1.0f,  1.0f, 0.0f},
+        { 1.0f, -1.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+}
+
+void QuantizeTest::quantizeMorphTargets() {
+    const struct Vertex {
+        Vector3 position;
+        Vector3 positionMorphTarget;
+        Vector3 normal;
+    } vertices[]{
+        {{0.0f, 0.0f, 5.0f}, {0.0f, 0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+        {{2.0f, 2.0f, 5.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}
+    };
+    const Containers::StridedArrayView1D<const Vertex> view = vertices;
+    const Trade::MeshData mesh{MeshPrimitive::Triangles, {}, vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::positionMorphTarget), 0},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)}
+    }};
+
+    /* Positions are kept as-is because the dequantization matrix would get
+       applied to the morph target displacements as well, the rest is
+       quantized */
+    Containers::Pair<Trade::MeshData, Matrix4> result = MeshTools::quantize(mesh);
+    const Trade::MeshData& quantized = result.first();
+    CORRADE_COMPARE(result.second(), Matrix4{});
+    CORRADE_COMPARE(quantized.attributeFormat(0), VertexFormat::Vector3);
+    CORRADE_COMPARE(quantized.attributeFormat(1), VertexFormat::Vector3);
+    CORRADE_COMPARE(quantized.attributeMorphTargetId(1), 0);
+    CORRADE_COMPARE(quantized.attributeFormat(2), VertexFormat::Vector3sNormalized);
+    CORRADE_COMPARE(quantized.attributeStride(0), 32);
+    CORRADE_COMPARE_AS(quantized.positions3DAsArray(), Containers::arrayView<Vector3>({
+        {0.0f, 0.0f, 5.0f},
+        {2.0f, 2.0f, 5.0f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(quantized.positions3DAsArray(0, 0), Containers::arrayView<Vector3>({
+        {0.0f, 0.5f, 0.0f},
+        {0.0f, 0.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(quantized.normalsAsArray(), Containers::arrayView<Vector3>({
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+}
+
+void QuantizeTest::quantizeEmpty() {
+    const Trade::MeshData mesh{MeshPrimitive::Points, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr}
+    }};
+
+    Containers::Pair<Trade::MeshData, Matrix4> result = MeshTools::quantize(mesh);
+    CORRADE_COMPARE(result.second(), Matrix4{});
+    CORRADE_VERIFY(!result.first().isIndexed());
+    CORRADE_COMPARE(result.first().vertexCount(), 0);
+    CORRADE_COMPARE(result.first().attributeFormat(0), VertexFormat::Vector3sNormalized);
+}
+
+void QuantizeTest::quantizeInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::quantize(Trade::MeshData{MeshPrimitive::Triangles,
+        nullptr, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::StridedArrayView1D<const void>{}},
+        nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                VertexFormat::Vector3, nullptr}
+        }});
+    MeshTools::quantize(Trade::MeshData{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            VertexFormat::Vector3, nullptr},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal,
+            vertexFormatWrap(0xcaca), nullptr}
+    }});
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::quantize(): mesh has an implementation-specific index type 0xcaca\n"
+        "MeshTools::quantize(): attribute 1 has an implementation-specific format 0xcaca\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::QuantizeTest)
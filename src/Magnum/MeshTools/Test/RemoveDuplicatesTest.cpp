@@ -25,18 +25,30 @@
 */
 
 #include <algorithm> /* std::shuffle() */
+#include <cstring>
 #include <random> /* random device for std::shuffle() */
 #include <sstream>
+#include <unordered_map>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/MurmurHash2.h>
 
-#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/Test/parallelFor.h"
 #include "Magnum/Trade/MeshData.h"
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
 namespace Magnum { namespace MeshTools { namespace Test { namespace {
 
 struct RemoveDuplicatesTest: TestSuite::Tester {
@@ -46,6 +58,7 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     void removeDuplicates();
     void removeDuplicatesNonContiguous();
     void removeDuplicatesIntoWrongOutputSize();
+    void removeDuplicatesParallel();
 
     template<class T> void removeDuplicatesIndexedInPlace();
     void removeDuplicatesIndexedInPlaceSmallType();
@@ -70,6 +83,14 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     void removeDuplicatesFuzzyIndexedInPlaceErasedNonContiguous();
     void removeDuplicatesFuzzyIndexedInPlaceErasedWrongIndexSize();
 
+    template<class T> void removeDuplicatesFuzzyGridInPlace();
+    template<class T> void removeDuplicatesFuzzyGridInPlaceInto();
+    template<class T> void removeDuplicatesFuzzyGridInPlaceGuarantees();
+    template<class T> void removeDuplicatesFuzzyGridInPlaceNonFinite();
+    void removeDuplicatesFuzzyGridInPlaceSameGridDimensions();
+    void removeDuplicatesFuzzyGridInPlaceEmpty();
+    void removeDuplicatesFuzzyGridInPlaceInvalid();
+
     /* this is additionally regression-tested in PrimitivesIcosphereTest */
 
     void removeDuplicatesMeshData();
@@ -89,6 +110,20 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
 
     void benchmark();
     void benchmarkFuzzy();
+    void benchmarkFuzzyGrid();
+
+    void benchmarkLargeReference();
+    void benchmarkLarge();
+    void benchmarkLargeParallel();
+};
+
+const struct {
+    const char* name;
+    std::size_t count;
+} BenchmarkLargeData[]{
+    /* Larger counts would make the test run too long on the CI */
+    {"100k", 100000},
+    {"1M", 1000000}
 };
 
 const struct {
@@ -200,6 +235,7 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
     addTests({&RemoveDuplicatesTest::removeDuplicates,
               &RemoveDuplicatesTest::removeDuplicatesNonContiguous,
               &RemoveDuplicatesTest::removeDuplicatesIntoWrongOutputSize,
+              &RemoveDuplicatesTest::removeDuplicatesParallel,
               &RemoveDuplicatesTest::removeDuplicatesIndexedInPlace<UnsignedByte>,
               &RemoveDuplicatesTest::removeDuplicatesIndexedInPlace<UnsignedShort>,
               &RemoveDuplicatesTest::removeDuplicatesIndexedInPlace<UnsignedInt>,
@@ -238,7 +274,19 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
               &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceErased<UnsignedInt, Float>,
               &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceErased<UnsignedInt, Double>,
               &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceErasedNonContiguous,
-              &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceErasedWrongIndexSize});
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceErasedWrongIndexSize,
+
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlace<Float>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlace<Double>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceInto<Float>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceInto<Double>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceGuarantees<Float>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceGuarantees<Double>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceNonFinite<Float>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceNonFinite<Double>,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceSameGridDimensions,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceEmpty,
+              &RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceInvalid});
 
     addInstancedTests({&RemoveDuplicatesTest::removeDuplicatesMeshData},
         Containers::arraySize(RemoveDuplicatesMeshDataData));
@@ -262,7 +310,13 @@ RemoveDuplicatesTest::RemoveDuplicatesTest() {
                       &RemoveDuplicatesTest::soakTestFuzzy}, 10);
 
     addBenchmarks({&RemoveDuplicatesTest::benchmark,
-                   &RemoveDuplicatesTest::benchmarkFuzzy}, 10);
+                   &RemoveDuplicatesTest::benchmarkFuzzy,
+                   &RemoveDuplicatesTest::benchmarkFuzzyGrid}, 10);
+
+    addInstancedBenchmarks({&RemoveDuplicatesTest::benchmarkLargeReference,
+                            &RemoveDuplicatesTest::benchmarkLarge,
+                            &RemoveDuplicatesTest::benchmarkLargeParallel}, 5,
+        Containers::arraySize(BenchmarkLargeData));
 }
 
 void RemoveDuplicatesTest::removeDuplicates() {
@@ -294,7 +348,11 @@ void RemoveDuplicatesTest::removeDuplicatesNonContiguous() {
     Error redirectError{&out};
     MeshTools::removeDuplicates(Containers::arrayCast<2, const char>(Containers::arrayView(data)).every({1, 2}));
     MeshTools::removeDuplicatesInPlace(Containers::arrayCast<2, char>(Containers::arrayView(data)).every({1, 2}));
+    MeshTools::removeDuplicates(Containers::arrayCast<2, const char>(Containers::arrayView(data)).every({1, 2}), parallelForSerial, nullptr);
+    MeshTools::removeDuplicatesInPlace(Containers::arrayCast<2, char>(Containers::arrayView(data)).every({1, 2}), parallelForSerial, nullptr);
     CORRADE_COMPARE(out.str(),
+        "MeshTools::removeDuplicatesInto(): second data view dimension is not contiguous\n"
+        "MeshTools::removeDuplicatesInPlaceInto(): second data view dimension is not contiguous\n"
         "MeshTools::removeDuplicatesInto(): second data view dimension is not contiguous\n"
         "MeshTools::removeDuplicatesInPlaceInto(): second data view dimension is not contiguous\n");
 }
@@ -313,11 +371,80 @@ void RemoveDuplicatesTest::removeDuplicatesIntoWrongOutputSize() {
     MeshTools::removeDuplicatesInPlaceInto(
         Containers::arrayCast<2, char>(Containers::arrayView(data)),
         output);
+    MeshTools::removeDuplicatesInto(
+        Containers::arrayCast<2, const char>(Containers::arrayView(data)),
+        output, parallelForSerial, nullptr);
+    MeshTools::removeDuplicatesInPlaceInto(
+        Containers::arrayCast<2, char>(Containers::arrayView(data)),
+        output, parallelForSerial, nullptr);
     CORRADE_COMPARE(out.str(),
+        "MeshTools::removeDuplicatesInto(): output index array has 7 elements but expected 8\n"
+        "MeshTools::removeDuplicatesInPlaceInto(): output index array has 7 elements but expected 8\n"
         "MeshTools::removeDuplicatesInto(): output index array has 7 elements but expected 8\n"
         "MeshTools::removeDuplicatesInPlaceInto(): output index array has 7 elements but expected 8\n");
 }
 
+using Magnum::Test::parallelForReverse;
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+using Magnum::Test::parallelForThreads;
+#endif
+
+/* Given count of items with every unique item repeated the given amount of
+   times, shuffled with a fixed seed so the duplicates are spread across all
+   chunks the parallel variant splits the data into */
+Containers::Array<Vector3i> largeData(std::size_t count, std::size_t duplicates) {
+    Containers::Array<Vector3i> data{NoInit, count};
+    for(std::size_t i = 0; i != count; ++i)
+        data[i] = {Int(i/duplicates), Int(i/duplicates)*7, -Int(i/duplicates)};
+    std::shuffle(data.begin(), data.end(), std::minstd_rand{});
+    return data;
+}
+
+void RemoveDuplicatesTest::removeDuplicatesParallel() {
+    const Containers::Array<Vector3i> data = largeData(200000, 4);
+    const Containers::StridedArrayView2D<const char> view = Containers::arrayCast<2, const char>(Containers::stridedArrayView(data));
+
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> expected = MeshTools::removeDuplicates(view);
+    CORRADE_COMPARE(expected.second(), 50000);
+
+    /* The output should be the same as with the serial variant regardless of
+       the execution order */
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> serial = MeshTools::removeDuplicates(view, parallelForSerial, nullptr);
+    CORRADE_COMPARE(serial.second(), expected.second());
+    CORRADE_COMPARE_AS(Containers::arrayView(serial.first()), Containers::arrayView(expected.first()),
+        TestSuite::Compare::Container);
+
+    Containers::Array<UnsignedInt> reverse{NoInit, data.size()};
+    CORRADE_COMPARE(MeshTools::removeDuplicatesInto(view, reverse, parallelForReverse, nullptr), expected.second());
+    CORRADE_COMPARE_AS(Containers::arrayView(reverse), Containers::arrayView(expected.first()),
+        TestSuite::Compare::Container);
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::size_t threadCount = 4;
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> threaded = MeshTools::removeDuplicates(view, parallelForThreads, &threadCount);
+    CORRADE_COMPARE(threaded.second(), expected.second());
+    CORRADE_COMPARE_AS(Containers::arrayView(threaded.first()), Containers::arrayView(expected.first()),
+        TestSuite::Compare::Container);
+    #endif
+
+    /* The in-place variant should result in the same indices and data as
+       well */
+    Containers::Array<Vector3i> expectedInPlaceData{NoInit, data.size()};
+    Utility::copy(Containers::arrayView(data), Containers::arrayView(expectedInPlaceData));
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> expectedInPlace = MeshTools::removeDuplicatesInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(expectedInPlaceData)));
+    CORRADE_COMPARE(expectedInPlace.second(), expected.second());
+
+    Containers::Array<Vector3i> inPlaceData{NoInit, data.size()};
+    Utility::copy(Containers::arrayView(data), Containers::arrayView(inPlaceData));
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> inPlace = MeshTools::removeDuplicatesInPlace(Containers::arrayCast<2, char>(Containers::stridedArrayView(inPlaceData)), parallelForReverse, nullptr);
+    CORRADE_COMPARE(inPlace.second(), expectedInPlace.second());
+    CORRADE_COMPARE_AS(Containers::arrayView(inPlace.first()), Containers::arrayView(expectedInPlace.first()),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(inPlaceData.prefix(inPlace.second()),
+        expectedInPlaceData.prefix(expectedInPlace.second()),
+        TestSuite::Compare::Container);
+}
+
 template<class T> void RemoveDuplicatesTest::removeDuplicatesIndexedInPlace() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -633,6 +760,175 @@ void RemoveDuplicatesTest::removeDuplicatesFuzzyIndexedInPlaceErasedWrongIndexSi
         "MeshTools::removeDuplicatesFuzzyIndexedInPlace(): expected index type size 1, 2 or 4 but got 3\n");
 }
 
+template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlace() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* The second and third, fourth and fifth and seventh and eighth item are
+       close to each other but in different cells. The ninth is close to the
+       eighth but not to the seventh it got collapsed with, so it's kept. */
+    Math::Vector2<T> data[]{
+        {T(0.0), T(0.0)},
+        {T(0.19), T(0.0)},
+        {T(0.21), T(0.05)},
+        {T(0.95), T(1.0)},
+        {T(1.04), T(1.0)},
+        {T(0.0), T(0.0)},
+        {T(0.5), T(0.5)},
+        {T(0.5), T(0.58)},
+        {T(0.5), T(0.66)}
+    };
+
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> result = MeshTools::removeDuplicatesFuzzyGridInPlace(
+        Containers::arrayCast<2, T>(Containers::stridedArrayView(data)), T(0.1));
+    CORRADE_COMPARE_AS(Containers::arrayView(result.first()),
+        Containers::arrayView<UnsignedInt>({0, 1, 1, 2, 2, 0, 3, 3, 4}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(data).prefix(result.second()),
+        (Containers::arrayView<Math::Vector2<T>>({
+            {T(0.0), T(0.0)},
+            {T(0.19), T(0.0)},
+            {T(0.95), T(1.0)},
+            {T(0.5), T(0.5)},
+            {T(0.5), T(0.66)}
+        })), TestSuite::Compare::Container);
+}
+
+template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceInto() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* The third item differs from the first only in the last dimension, the
+       fifth is in a different cell */
+    Math::Vector4<T> data[]{
+        {T(1.0), T(0.0), T(0.0), T(1.0)},
+        {T(0.0), T(1.0), T(0.0), T(1.0)},
+        {T(1.0), T(0.0), T(0.0), T(1.0) + Math::TypeTraits<T>::epsilon()/T(2.0)},
+        {T(0.0), T(1.0), T(0.0), T(2.0)},
+        {T(1.0), T(0.0) - Math::TypeTraits<T>::epsilon()/T(2.0), T(0.0), T(1.0)}
+    };
+
+    UnsignedInt indices[5];
+    std::size_t count = MeshTools::removeDuplicatesFuzzyGridInPlaceInto(
+        Containers::arrayCast<2, T>(Containers::stridedArrayView(data)),
+        indices);
+    CORRADE_COMPARE_AS(Containers::arrayView(indices),
+        Containers::arrayView<UnsignedInt>({0, 1, 0, 2, 0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(count, 3);
+    CORRADE_COMPARE(data[2], (Math::Vector4<T>{T(0.0), T(1.0), T(0.0), T(2.0)}));
+}
+
+template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceGuarantees() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Random points in a unit hypercube, with four dimensions to test also
+       the dimensions that aren't a part of the grid */
+    std::minstd_rand rand;
+    std::uniform_real_distribution<T> distribution{T(0.0), T(1.0)};
+    Math::Vector4<T> data[1000];
+    for(Math::Vector4<T>& i: data)
+        i = {distribution(rand), distribution(rand), distribution(rand), distribution(rand)/T(10.0)};
+    Math::Vector4<T> original[Containers::arraySize(data)];
+    Utility::copy(Containers::arrayView(data), Containers::arrayView(original));
+
+    const T epsilon = T(0.05);
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> result = MeshTools::removeDuplicatesFuzzyGridInPlace(
+        Containers::arrayCast<2, T>(Containers::stridedArrayView(data)), epsilon);
+    CORRADE_VERIFY(result.second() < Containers::arraySize(data));
+
+    /* Every item is at most epsilon away from its replacement */
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(result.first()[i] < result.second());
+        CORRADE_COMPARE_AS(Math::abs(original[i] - data[result.first()[i]]).max(), epsilon,
+            TestSuite::Compare::LessOrEqual);
+    }
+
+    /* No two unique items are within epsilon */
+    for(std::size_t i = 0; i != result.second(); ++i) {
+        CORRADE_ITERATION(i);
+        for(std::size_t j = i + 1; j != result.second(); ++j) {
+            CORRADE_ITERATION(j);
+            CORRADE_COMPARE_AS(Math::abs(data[i] - data[j]).max(), epsilon,
+                TestSuite::Compare::Greater);
+        }
+    }
+}
+
+template<class T> void RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceNonFinite() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Items with a NaN or an infinity anywhere are never close to anything,
+       not even to themselves, and they shouldn't affect the grid size for the
+       remaining items either */
+    const T nan = Math::Constants<T>::nan();
+    const T inf = Math::Constants<T>::inf();
+    Math::Vector4<T> data[]{
+        {T(0.0), T(0.0), T(0.0), T(0.0)},
+        {nan, T(0.0), T(0.0), T(0.0)},
+        {T(0.0), T(0.0), T(0.0), nan},
+        {inf, T(0.0), T(0.0), T(0.0)},
+        {T(0.05), T(0.0), T(0.0), T(0.0)},
+        {nan, T(0.0), T(0.0), T(0.0)},
+        {T(0.0), -inf, T(0.0), T(0.0)},
+        {T(1.0), T(1.0), T(1.0), T(1.0)},
+        {inf, T(0.0), T(0.0), T(0.0)},
+        {T(0.95), T(1.0), T(1.0), T(1.0)}
+    };
+
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> result = MeshTools::removeDuplicatesFuzzyGridInPlace(
+        Containers::arrayCast<2, T>(Containers::stridedArrayView(data)), T(0.1));
+    CORRADE_COMPARE_AS(Containers::arrayView(result.first()),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 3, 0, 4, 5, 6, 7, 6}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(result.second(), 8);
+    CORRADE_COMPARE(data[6], (Math::Vector4<T>{T(1.0), T(1.0), T(1.0), T(1.0)}));
+    CORRADE_COMPARE(data[7], (Math::Vector4<T>{inf, T(0.0), T(0.0), T(0.0)}));
+}
+
+void RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceSameGridDimensions() {
+    /* Items sharing the first three dimensions and differing only in the
+       remaining ones, such as vertices with the same position but different
+       texture coordinates. The grid should get built over the dimensions
+       that actually differ instead of putting everything into a single
+       cell. */
+    Containers::Array<Math::Vector<5, Float>> data{NoInit, 20000};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = {1.0f, 2.0f, 3.0f, Float(i % 10000), Float(i % 10000)*0.5f};
+
+    Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> result = MeshTools::removeDuplicatesFuzzyGridInPlace(
+        Containers::arrayCast<2, Float>(Containers::stridedArrayView(data)), 0.1f);
+    CORRADE_COMPARE(result.second(), 10000);
+    for(std::size_t i = 0; i != data.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(result.first()[i], UnsignedInt(i % 10000));
+    }
+}
+
+void RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceEmpty() {
+    CORRADE_COMPARE(MeshTools::removeDuplicatesFuzzyGridInPlaceInto(
+        Containers::StridedArrayView2D<Float>{}, nullptr), 0);
+}
+
+void RemoveDuplicatesTest::removeDuplicatesFuzzyGridInPlaceInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Vector3 data[8]{};
+    UnsignedInt indices[7];
+    UnsignedInt indicesCorrect[8];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::removeDuplicatesFuzzyGridInPlaceInto(
+        Containers::arrayCast<2, Float>(Containers::arrayView(data)),
+        indices);
+    MeshTools::removeDuplicatesFuzzyGridInPlaceInto(
+        Containers::arrayCast<2, Float>(Containers::arrayView(data)),
+        indicesCorrect, -0.5f);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::removeDuplicatesFuzzyGridInPlaceInto(): output index array has 7 elements but expected 8\n"
+        "MeshTools::removeDuplicatesFuzzyGridInPlaceInto(): expected a non-negative epsilon but got -0.5\n");
+}
+
 void RemoveDuplicatesTest::removeDuplicatesMeshData() {
     auto&& data = RemoveDuplicatesMeshDataData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -1271,6 +1567,97 @@ void RemoveDuplicatesTest::benchmarkFuzzy() {
     CORRADE_COMPARE(count, 100);
 }
 
+void RemoveDuplicatesTest::benchmarkFuzzyGrid() {
+    /* Array of 100 unique items with 100 duplicates each, shuffled */
+    Vector3 data[10000];
+    for(std::size_t i = 0; i != Containers::arraySize(data); ++i)
+        data[i].x() = i/100;
+    std::shuffle(std::begin(data), std::end(data), std::minstd_rand{std::random_device{}()});
+
+    std::size_t count = 0;
+    UnsignedInt indices[10000];
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesFuzzyGridInPlaceInto(
+            Containers::arrayCast<2, Float>(Containers::arrayView(data)),
+            indices);
+
+    CORRADE_COMPARE(count, 100);
+}
+
+/* The original std::unordered_map-based implementation, for comparison */
+std::size_t removeDuplicatesIntoReference(const Containers::StridedArrayView2D<const char>& data, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    const std::size_t size = data.size()[1];
+    const auto hash = [size](const void* a) {
+        return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(static_cast<const char*>(a), size).byteArray());
+    };
+    const auto equal = [size](const void* a, const void* b) {
+        return std::memcmp(a, b, size) == 0;
+    };
+    std::unordered_map<const void*, UnsignedInt, decltype(hash), decltype(equal)> table{data.size()[0], hash, equal};
+    for(std::size_t i = 0; i != data.size()[0]; ++i)
+        indices[i] = table.emplace(data[i].data(), UnsignedInt(i)).first->second;
+    return table.size();
+}
+
+void RemoveDuplicatesTest::benchmarkLargeReference() {
+    auto&& data = BenchmarkLargeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Each unique item is present six times, which is the usual ratio for a
+       triangle mesh before indexing */
+    const Containers::Array<Vector3i> input = largeData(data.count, 6);
+    Containers::Array<UnsignedInt> indices{NoInit, data.count};
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count = removeDuplicatesIntoReference(
+            Containers::arrayCast<2, const char>(Containers::stridedArrayView(input)),
+            indices);
+
+    CORRADE_COMPARE(count, (data.count + 5)/6);
+}
+
+void RemoveDuplicatesTest::benchmarkLarge() {
+    auto&& data = BenchmarkLargeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<Vector3i> input = largeData(data.count, 6);
+    Containers::Array<UnsignedInt> indices{NoInit, data.count};
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesInto(
+            Containers::arrayCast<2, const char>(Containers::stridedArrayView(input)),
+            indices);
+
+    CORRADE_COMPARE(count, (data.count + 5)/6);
+}
+
+void RemoveDuplicatesTest::benchmarkLargeParallel() {
+    auto&& data = BenchmarkLargeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<Vector3i> input = largeData(data.count, 6);
+    Containers::Array<UnsignedInt> indices{NoInit, data.count};
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::size_t threadCount = Math::max(std::thread::hardware_concurrency(), 1u);
+    const ParallelFor parallelFor = parallelForThreads;
+    void* const parallelForState = &threadCount;
+    #else
+    const ParallelFor parallelFor = parallelForSerial;
+    void* const parallelForState = nullptr;
+    #endif
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count = MeshTools::removeDuplicatesInto(
+            Containers::arrayCast<2, const char>(Containers::stridedArrayView(input)),
+            indices, parallelFor, parallelForState);
+
+    CORRADE_COMPARE(count, (data.count + 5)/6);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::RemoveDuplicatesTest)
@@ -0,0 +1,329 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2022 Pablo Escobar <mail@rvrs.in>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Simplify.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct SimplifyTest: TestSuite::Tester {
+    explicit SimplifyTest();
+
+    void flat();
+    void curved();
+    void curvedNoError();
+    void targetNotReached();
+    void seams();
+    void empty();
+    void invalid();
+
+    void meshData();
+    void meshDataNotIndexed();
+    void meshDataInvalid();
+
+    void lodChain();
+    void lodChainSingleLevel();
+    void lodChainInvalid();
+};
+
+SimplifyTest::SimplifyTest() {
+    addTests({&SimplifyTest::flat,
+              &SimplifyTest::curved,
+              &SimplifyTest::curvedNoError,
+              &SimplifyTest::targetNotReached,
+              &SimplifyTest::seams,
+              &SimplifyTest::empty,
+              &SimplifyTest::invalid,
+
+              &SimplifyTest::meshData,
+              &SimplifyTest::meshDataNotIndexed,
+              &SimplifyTest::meshDataInvalid,
+
+              &SimplifyTest::lodChain,
+              &SimplifyTest::lodChainSingleLevel,
+              &SimplifyTest::lodChainInvalid});
+}
+
+/* No degenerate triangles and all indices in bounds */
+bool isValid(const Containers::ArrayView<const UnsignedInt> indices, const std::size_t vertexCount) {
+    if(indices.size() % 3) return false;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        for(std::size_t j = 0; j != 3; ++j)
+            if(indices[i + j] >= vertexCount) return false;
+        if(indices[i + 0] == indices[i + 1] ||
+           indices[i + 0] == indices[i + 2] ||
+           indices[i + 1] == indices[i + 2]) return false;
+    }
+    return true;
+}
+
+void SimplifyTest::flat() {
+    /* 8x8 vertices, 98 triangles, of which 28 vertices are on the border */
+    const Trade::MeshData grid = Primitives::grid3DSolid({6, 6});
+    const Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+    const Containers::StridedArrayView1D<const Vector3> positions = grid.attribute<Vector3>(Trade::MeshAttribute::Position);
+    CORRADE_COMPARE(indices.size(), 98*3);
+
+    /* All interior vertices can be collapsed with zero error */
+    Containers::Array<UnsignedInt> simplified = simplify(indices, positions, 0, 0.0f);
+    CORRADE_VERIFY(isValid(simplified, positions.size()));
+    CORRADE_COMPARE_AS(simplified.size(), std::size_t{98*3/2},
+        TestSuite::Compare::Less);
+
+    /* The border vertices are locked, so all of them stay */
+    Containers::BitArray used{ValueInit, positions.size()};
+    for(const UnsignedInt index: simplified)
+        used.set(index);
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        if(Math::abs(positions[i]).max() < 1.0f - 0.001f) continue;
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(used[i]);
+    }
+}
+
+void SimplifyTest::curved() {
+    /* 320 triangles */
+    const Trade::MeshData sphere = Primitives::icosphereSolid(2);
+    const Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+    const Containers::StridedArrayView1D<const Vector3> positions = sphere.attribute<Vector3>(Trade::MeshAttribute::Position);
+    CORRADE_COMPARE(indices.size(), 320*3);
+
+    /* With a generous error limit the target gets reached */
+    Containers::Array<UnsignedInt> simplified = simplify(indices, positions, 160*3, 1.0f);
+    CORRADE_VERIFY(isValid(simplified, positions.size()));
+    CORRADE_COMPARE_AS(simplified.size(), std::size_t{160*3},
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_VERIFY(!simplified.isEmpty());
+}
+
+void SimplifyTest::curvedNoError() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(2);
+    const Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+
+    /* Any collapse on a curved surface introduces an error, so nothing
+       gets collapsed */
+    Containers::Array<UnsignedInt> simplified = simplify(indices, sphere.attribute<Vector3>(Trade::MeshAttribute::Position), 0, 0.0f);
+    CORRADE_COMPARE_AS(simplified, indices,
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::targetNotReached() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(2);
+    const Containers::Array<UnsignedInt> indices = sphere.indicesAsArray();
+
+    /* The target is already satisfied, nothing to do */
+    Containers::Array<UnsignedInt> simplified = simplify(indices, sphere.attribute<Vector3>(Trade::MeshAttribute::Position), indices.size(), 1.0f);
+    CORRADE_COMPARE_AS(simplified, indices,
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::seams() {
+    /* Each triangle has its own vertices, so every vertex lies on a seam and
+       nothing can be collapsed even though the mesh is flat */
+    const Trade::MeshData grid = Primitives::grid3DSolid({4, 4});
+    const Containers::Array<UnsignedInt> indices = grid.indicesAsArray();
+    const Containers::StridedArrayView1D<const Vector3> gridPositions = grid.attribute<Vector3>(Trade::MeshAttribute::Position);
+    Containers::Array<Vector3> positions{NoInit, indices.size()};
+    Containers::Array<UnsignedInt> trivialIndices{NoInit, indices.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        positions[i] = gridPositions[indices[i]];
+        trivialIndices[i] = i;
+    }
+
+    Containers::Array<UnsignedInt> simplified = simplify(trivialIndices, positions, 0, 1.0f);
+    CORRADE_COMPARE_AS(simplified, trivialIndices,
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::empty() {
+    CORRADE_COMPARE(simplify(Containers::ArrayView<const UnsignedInt>{}, Containers::ArrayView<const Vector3>{}, 0).size(), 0);
+}
+
+void SimplifyTest::invalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+    const UnsignedInt indices[]{0, 1, 2, 0, 1, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    simplify(Containers::arrayView(indices).prefix(5), positions, 0);
+    simplify(indices, positions, 0);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::simplify(): index count not divisible by 3, got 5\n"
+        "MeshTools::simplify(): index 3 out of range for 3 vertices\n");
+}
+
+void SimplifyTest::meshData() {
+    const Trade::MeshData grid = Primitives::grid3DSolid({6, 6}, Primitives::GridFlag::Normals|Primitives::GridFlag::TextureCoordinates);
+
+    Trade::MeshData simplified = simplify(grid, 0, 0.0f);
+    CORRADE_COMPARE(simplified.primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(simplified.isIndexed());
+    CORRADE_COMPARE(simplified.indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE(simplified.attributeCount(), grid.attributeCount());
+
+    /* The index count is the same as with the index-based variant, unused
+       vertices got removed */
+    Containers::Array<UnsignedInt> expected = simplify(grid.indicesAsArray(), grid.attribute<Vector3>(Trade::MeshAttribute::Position), 0, 0.0f);
+    CORRADE_COMPARE(simplified.indexCount(), expected.size());
+    CORRADE_COMPARE_AS(simplified.vertexCount(), grid.vertexCount(),
+        TestSuite::Compare::Less);
+    CORRADE_VERIFY(isValid(simplified.indicesAsArray(), simplified.vertexCount()));
+
+    /* Vertices are in order of first use */
+    CORRADE_COMPARE(simplified.indices<UnsignedInt>()[0], 0);
+
+    /* The remaining vertices have their attributes preserved */
+    const Containers::StridedArrayView1D<const Vector3> positions = simplified.attribute<Vector3>(Trade::MeshAttribute::Position);
+    const Containers::StridedArrayView1D<const Vector2> textureCoordinates = simplified.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates);
+    for(std::size_t i = 0; i != simplified.indexCount(); ++i) {
+        CORRADE_ITERATION(i);
+        const UnsignedInt index = simplified.indices<UnsignedInt>()[i];
+        const UnsignedInt original = expected[i];
+        CORRADE_COMPARE(positions[index], grid.attribute<Vector3>(Trade::MeshAttribute::Position)[original]);
+        CORRADE_COMPARE(textureCoordinates[index], grid.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates)[original]);
+    }
+    for(const Vector3& normal: simplified.attribute<Vector3>(Trade::MeshAttribute::Normal))
+        CORRADE_COMPARE(normal, Vector3::zAxis());
+}
+
+void SimplifyTest::meshDataNotIndexed() {
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+    };
+    const Trade::MeshData mesh{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    /* A single triangle can't be simplified further */
+    Trade::MeshData simplified = simplify(mesh, 0);
+    CORRADE_COMPARE(simplified.vertexCount(), 3);
+    CORRADE_COMPARE_AS(simplified.indices<UnsignedInt>(), Containers::arrayView<UnsignedInt>({
+        0, 1, 2
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(simplified.attribute<Vector3>(Trade::MeshAttribute::Position), Containers::arrayView(positions),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::meshDataInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector3 positions[3]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    simplify(Trade::MeshData{MeshPrimitive::Lines, 2}, 0);
+    simplify(Trade::MeshData{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, Containers::arrayView(positions)}
+    }}, 0);
+    simplify(Trade::MeshData{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            VertexFormat::Vector3, nullptr},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal,
+            vertexFormatWrap(0xcaca), nullptr}
+    }}, 0);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::simplify(): expected a triangle mesh, got MeshPrimitive::Lines\n"
+        "MeshTools::simplify(): the mesh has no positions\n"
+        "MeshTools::simplify(): attribute 1 has an implementation-specific format 0xcaca\n");
+}
+
+void SimplifyTest::lodChain() {
+    const Trade::MeshData grid = Primitives::grid3DSolid({6, 6});
+
+    Containers::Pair<Trade::MeshData, Containers::Array<UnsignedInt>> chain = generateLodChain(grid, 3, 0.5f, 0.0f);
+    const Trade::MeshData& mesh = chain.first();
+    const Containers::ArrayView<const UnsignedInt> offsets = chain.second();
+    CORRADE_COMPARE(offsets.size(), 4);
+    CORRADE_COMPARE(mesh.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(mesh.attributeCount(), grid.attributeCount());
+    CORRADE_COMPARE(mesh.indexCount(), offsets[3]);
+    CORRADE_VERIFY(isValid(mesh.indicesAsArray(), mesh.vertexCount()));
+
+    /* The first level is the original mesh, every next at most half the size
+       of the previous */
+    CORRADE_COMPARE(offsets[0], 0);
+    CORRADE_COMPARE(offsets[1], grid.indexCount());
+    CORRADE_COMPARE_AS(offsets[2] - offsets[1], (offsets[1] - offsets[0])/2,
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(offsets[3] - offsets[2], (offsets[2] - offsets[1])/2,
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_VERIFY(offsets[3] - offsets[2]);
+    CORRADE_COMPARE_AS(mesh.indicesAsArray().prefix(offsets[1]), grid.indicesAsArray(),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::lodChainSingleLevel() {
+    const Trade::MeshData sphere = Primitives::icosphereSolid(1);
+
+    Containers::Pair<Trade::MeshData, Containers::Array<UnsignedInt>> chain = generateLodChain(sphere, 1);
+    CORRADE_COMPARE_AS(chain.second(), Containers::arrayView<UnsignedInt>({
+        0, sphere.indexCount()
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(chain.first().vertexCount(), sphere.vertexCount());
+    CORRADE_COMPARE_AS(chain.first().indicesAsArray(), sphere.indicesAsArray(),
+        TestSuite::Compare::Container);
+}
+
+void SimplifyTest::lodChainInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MeshData sphere = Primitives::icosphereSolid(0);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    generateLodChain(Trade::MeshData{MeshPrimitive::Lines, 2}, 2);
+    generateLodChain(sphere, 0);
+    generateLodChain(sphere, 2, 0.0f);
+    generateLodChain(sphere, 2, 1.5f);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::generateLodChain(): expected a triangle mesh, got MeshPrimitive::Lines\n"
+        "MeshTools::generateLodChain(): expected at least one level\n"
+        "MeshTools::generateLodChain(): expected ratio to be greater than 0 and at most 1, got 0\n"
+        "MeshTools::generateLodChain(): expected ratio to be greater than 0 and at most 1, got 1.5\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SimplifyTest)
@@ -0,0 +1,255 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/SoA.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct SoATest: TestSuite::Tester {
+    explicit SoATest();
+
+    void positions2D();
+    void positions2DPacked();
+    void positions3D();
+    void positions3DPacked();
+    void positions3DMorphTarget();
+    void normals();
+    void normalsPacked();
+    void textureCoordinates2D();
+    void textureCoordinates2DPacked();
+    void empty();
+};
+
+SoATest::SoATest() {
+    addTests({&SoATest::positions2D,
+              &SoATest::positions2DPacked,
+              &SoATest::positions3D,
+              &SoATest::positions3DPacked,
+              &SoATest::positions3DMorphTarget,
+              &SoATest::normals,
+              &SoATest::normalsPacked,
+              &SoATest::textureCoordinates2D,
+              &SoATest::textureCoordinates2DPacked,
+              &SoATest::empty});
+}
+
+/* Five vertices to have a count that's not divisible by four, each attribute
+   interleaved with others to verify strides are handled */
+const struct Vertex {
+    Vector3 position;
+    Vector3 normal;
+    Vector2 textureCoordinates;
+    Vector3s positionPacked;
+    Vector3b normalPacked;
+    Vector2ub textureCoordinatesPacked;
+} Vertices[]{
+    {{1.0f, 2.0f, 3.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.5f},
+     {1, 2, 3}, {127, 0, 0}, {0, 255}},
+    {{4.0f, 5.0f, 6.0f}, {0.0f, -1.0f, 0.0f}, {1.0f, 0.0f},
+     {4, 5, 6}, {0, -127, 0}, {255, 0}},
+    {{-7.0f, 8.0f, 9.0f}, {0.0f, 0.0f, 1.0f}, {0.25f, 0.75f},
+     {-7, 8, 9}, {0, 0, 127}, {0, 0}},
+    {{10.0f, -11.0f, 12.0f}, {-1.0f, 0.0f, 0.0f}, {1.0f, 1.0f},
+     {10, -11, 12}, {-127, 0, 0}, {255, 255}},
+    {{13.0f, 14.0f, -15.0f}, {0.0f, 1.0f, 0.0f}, {0.5f, 0.5f},
+     {13, 14, -15}, {0, 127, 0}, {0, 255}},
+};
+
+void SoATest::positions2D() {
+    Containers::StridedArrayView1D<const Vertex> view = Vertices;
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, Vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector2, view.slice(&Vertex::position)}
+    }};
+
+    Vector2SoA soa = positions2DSoA(mesh);
+    CORRADE_COMPARE(soa.size(), 5);
+    CORRADE_COMPARE_AS(soa.x(), Containers::arrayView<Float>({
+        1.0f, 4.0f, -7.0f, 10.0f, 13.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(soa.y(), Containers::arrayView<Float>({
+        2.0f, 5.0f, 8.0f, -11.0f, 14.0f
+    }), TestSuite::Compare::Container);
+}
+
+void SoATest::positions2DPacked() {
+    Containers::StridedArrayView1D<const Vertex> view = Vertices;
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, Vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector2s, view.slice(&Vertex::positionPacked)}
+    }};
+
+    Vector2SoA soa = positions2DSoA(mesh);
+    CORRADE_COMPARE(soa.size(), 5);
+    CORRADE_COMPARE_AS(soa.x(), Containers::arrayView<Float>({
+        1.0f, 4.0f, -7.0f, 10.0f, 13.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(soa.y(), Containers::arrayView<Float>({
+        2.0f, 5.0f, 8.0f, -11.0f, 14.0f
+    }), TestSuite::Compare::Container);
+}
+
+void SoATest::positions3D() {
+    Containers::StridedArrayView1D<const Vertex> view = Vertices;
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, Vertices, {
+        /* Testing also the ID */
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::positionPacked)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::normal)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position)}
+    }};
+
+    Vector3SoA soa = positions3DSoA(mesh, 2);
+    CORRADE_COMPARE(soa.size(), 5);
+    CORRADE_COMPARE_AS(soa.x(), Containers::arrayView<Float>({
+        1.0f, 4.0f, -7.0f, 10.0f, 13.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(soa.y(), Containers::arrayView<Float>({
+        2.0f, 5.0f, 8.0f, -11.0f, 14.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(soa.z(), Containers::arrayView<Float>({
+        3.0f, 6.0f, 9.0f, 12.0f, -15.0f
+    }), TestSuite::Compare::Container);
+}
+
+void SoATest::positions3DPacked() {
+    Containers::StridedArrayView1D<const Vertex> view = Vertices;
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, Vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::positionPacked)}
+    }};
+
+    Vector3SoA soa = positions3DSoA(mesh);
+    CORRADE_COMPARE(soa.size(), 5);
+    CORRADE_COMPARE_AS(soa.x(), Containers::arrayView<Float>({
+        1.0f, 4.0f, -7.0f, 10.0f, 13.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(soa.y(), Containers::arrayView<Float>({
+        2.0f, 5.0f, 8.0f, -11.0f, 14.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(soa.z(), Containers::arrayView<Float>({
+        3.0f, 6.0f, 9.0f, 12.0f, -15.0f
+    }), TestSuite::Compare::Container);
+}
+
+void SoATest::positions3DMorphTarget() {
+    Containers::StridedArrayView1D<const Vertex> view = Vertices;
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, Vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::normal)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, view.slice(&Vertex::position), 37}
+    }};
+
+    Vector3SoA soa = positions3DSoA(mesh, 0, 37);
+    CORRADE_COMPARE(soa.size(), 5);
+    CORRADE_COMPARE_AS(soa.z(), Containers::arrayView<Float>({
+        3.0f, 6.0f, 9.0f, 12.0f, -15.0f
+    }), TestSuite::Compare::Container);
+}
+
+void SoATest::normals() {
+    Containers::StridedArrayView1D<const Vertex> view = Vertices;
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, Vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, view.slice(&Vertex::normal)}
+    }};
+
+    Vector3SoA soa = normalsSoA(mesh);
+    CORRADE_COMPARE(soa.size(), 5);
+    CORRADE_COMPARE_AS(soa.x(), Containers::arrayView<Float>({
+        1.0f, 0.0f, 0.0f, -1.0f, 0.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(soa.y(), Containers::arrayView<Float>({
+        0.0f, -1.0f, 0.0f, 0.0f, 1.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(soa.z(), Containers::arrayView<Float>({
+        0.0f, 0.0f, 1.0f, 0.0f, 0.0f
+    }), TestSuite::Compare::Container);
+}
+
+void SoATest::normalsPacked() {
+    Containers::StridedArrayView1D<const Vertex> view = Vertices;
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, Vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, VertexFormat::Vector3bNormalized, view.slice(&Vertex::normalPacked)}
+    }};
+
+    Vector3SoA soa = normalsSoA(mesh);
+    CORRADE_COMPARE(soa.size(), 5);
+    CORRADE_COMPARE_AS(soa.x(), Containers::arrayView<Float>({
+        1.0f, 0.0f, 0.0f, -1.0f, 0.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(soa.y(), Containers::arrayView<Float>({
+        0.0f, -1.0f, 0.0f, 0.0f, 1.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(soa.z(), Containers::arrayView<Float>({
+        0.0f, 0.0f, 1.0f, 0.0f, 0.0f
+    }), TestSuite::Compare::Container);
+}
+
+void SoATest::textureCoordinates2D() {
+    Containers::StridedArrayView1D<const Vertex> view = Vertices;
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, Vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, view.slice(&Vertex::textureCoordinates)}
+    }};
+
+    Vector2SoA soa = textureCoordinates2DSoA(mesh);
+    CORRADE_COMPARE(soa.size(), 5);
+    CORRADE_COMPARE_AS(soa.x(), Containers::arrayView<Float>({
+        0.0f, 1.0f, 0.25f, 1.0f, 0.5f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(soa.y(), Containers::arrayView<Float>({
+        0.5f, 0.0f, 0.75f, 1.0f, 0.5f
+    }), TestSuite::Compare::Container);
+}
+
+void SoATest::textureCoordinates2DPacked() {
+    Containers::StridedArrayView1D<const Vertex> view = Vertices;
+    Trade::MeshData mesh{MeshPrimitive::Points, {}, Vertices, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, VertexFormat::Vector2ubNormalized, view.slice(&Vertex::textureCoordinatesPacked)}
+    }};
+
+    Vector2SoA soa = textureCoordinates2DSoA(mesh);
+    CORRADE_COMPARE(soa.size(), 5);
+    CORRADE_COMPARE_AS(soa.x(), Containers::arrayView<Float>({
+        0.0f, 1.0f, 0.0f, 1.0f, 0.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(soa.y(), Containers::arrayView<Float>({
+        1.0f, 0.0f, 0.0f, 1.0f, 1.0f
+    }), TestSuite::Compare::Container);
+}
+
+void SoATest::empty() {
+    Trade::MeshData mesh{MeshPrimitive::Points, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr}
+    }};
+
+    Vector3SoA soa = positions3DSoA(mesh);
+    CORRADE_VERIFY(soa.isEmpty());
+    CORRADE_COMPARE(soa.paddedSize(), 0);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SoATest)
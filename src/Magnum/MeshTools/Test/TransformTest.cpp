@@ -28,6 +28,7 @@
 #include <sstream>
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/Algorithms.h>
@@ -50,6 +51,8 @@ struct TransformTest: TestSuite::Tester {
 
     void transformPoints2D();
     void transformPoints3D();
+    void transformVectorsPoints3DStrided();
+    void transformPoints3DProjective();
 
     template<class T> void meshData2D();
     void meshData2DNoPosition();
@@ -97,6 +100,10 @@ struct TransformTest: TestSuite::Tester {
     void meshDataTextureCoordinates2DInPlaceNotMutable();
     void meshDataTextureCoordinates2DInPlaceNoCoordinates();
     void meshDataTextureCoordinates2DInPlaceWrongFormat();
+
+    void benchmarkTransformPoints3DLoop();
+    void benchmarkTransformPoints3D();
+    void benchmarkMeshData3DInPlace();
 };
 
 using namespace Math::Literals;
@@ -316,7 +323,9 @@ TransformTest::TransformTest() {
               &TransformTest::transformVectors3D,
 
               &TransformTest::transformPoints2D,
-              &TransformTest::transformPoints3D});
+              &TransformTest::transformPoints3D,
+              &TransformTest::transformVectorsPoints3DStrided,
+              &TransformTest::transformPoints3DProjective});
 
     addInstancedTests<TransformTest>({
         &TransformTest::meshData2D<Float>,
@@ -411,6 +420,10 @@ TransformTest::TransformTest() {
         Containers::arraySize(NoAttributeData));
 
     addTests({&TransformTest::meshDataTextureCoordinates2DInPlaceWrongFormat});
+
+    addBenchmarks({&TransformTest::benchmarkTransformPoints3DLoop,
+                   &TransformTest::benchmarkTransformPoints3D,
+                   &TransformTest::benchmarkMeshData3DInPlace}, 5);
 }
 
 constexpr static std::array<Vector2, 2> points2D{{
@@ -479,6 +492,89 @@ void TransformTest::transformPoints3D() {
     CORRADE_COMPARE(quaternion, points3DRotatedTranslated);
 }
 
+void TransformTest::transformVectorsPoints3DStrided() {
+    /* Strided views and arrays go through the batch Math::transformPointsInto()
+       and transformVectorsInto() kernels, verify those give the same result.
+       Using more items than the SIMD width to cover the remainder loop. */
+    struct Vertex {
+        Vector3 position;
+        Int somethingElse;
+    } vertices[11];
+    Containers::Array<Vector3> expectedPoints{NoInit, 11};
+    Containers::Array<Vector3> expectedVectors{NoInit, 11};
+    const Matrix4 transformation = Matrix4::translation({1.0f, -2.0f, 0.5f})*
+        Matrix4::rotationZ(Deg(90.0f))*Matrix4::scaling({2.0f, 1.0f, 3.0f});
+    for(std::size_t i = 0; i != 11; ++i) {
+        vertices[i].position = {Float(i), 1.0f - Float(i), Float(i)*0.5f};
+        vertices[i].somethingElse = Int(i);
+        expectedPoints[i] = transformation.transformPoint(vertices[i].position);
+        expectedVectors[i] = transformation.transformVector(vertices[i].position);
+    }
+
+    Containers::Array<Vector3> vectors{NoInit, 11};
+    for(std::size_t i = 0; i != 11; ++i)
+        vectors[i] = vertices[i].position;
+    transformVectorsInPlace(transformation, vectors);
+    CORRADE_COMPARE_AS(vectors, expectedVectors,
+        TestSuite::Compare::Container);
+
+    Containers::StridedArrayView1D<Vector3> positions = Containers::stridedArrayView(vertices).slice(&Vertex::position);
+    transformPointsInPlace(transformation, positions);
+    CORRADE_COMPARE_AS(positions, Containers::stridedArrayView(expectedPoints),
+        TestSuite::Compare::Container);
+
+    /* The other members shouldn't be touched */
+    for(std::size_t i = 0; i != 11; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(vertices[i].somethingElse, Int(i));
+    }
+}
+
+void TransformTest::transformPoints3DProjective() {
+    /* The batch Math::transformPointsInto() doesn't do the projective divide,
+       verify that projective matrices give the same result regardless of
+       whether the container is batch-transformable or not. Using more items
+       than the SIMD width to cover the remainder loop. */
+    const Matrix4 transformation = Matrix4::perspectiveProjection(Deg(60.0f), 4.0f/3.0f, 0.1f, 100.0f)*Matrix4::translation(Vector3::zAxis(-5.0f));
+    std::array<Vector3, 11> points;
+    Containers::Array<Vector3> expected{NoInit, 11};
+    for(std::size_t i = 0; i != 11; ++i) {
+        points[i] = {Float(i)*0.25f, 1.0f - Float(i)*0.5f, -Float(i)};
+        expected[i] = transformation.transformPoint(points[i]);
+    }
+
+    /* Sanity check that the divide actually matters for these points */
+    CORRADE_VERIFY(expected[3] != (transformation*Vector4{points[3], 1.0f}).xyz());
+
+    /* Containers::Array is convertible to a strided view and would otherwise
+       go through the batch kernel */
+    Containers::Array<Vector3> batch{NoInit, 11};
+    for(std::size_t i = 0; i != 11; ++i)
+        batch[i] = points[i];
+    transformPointsInPlace(transformation, batch);
+    CORRADE_COMPARE_AS(batch, expected,
+        TestSuite::Compare::Container);
+
+    /* std::array isn't, so it's a plain loop */
+    std::array<Vector3, 11> loop = points;
+    transformPointsInPlace(transformation, loop);
+    CORRADE_COMPARE_AS(Containers::arrayView(loop), expected,
+        TestSuite::Compare::Container);
+
+    /* transform3DInPlace() has its own batch path for positions */
+    Containers::Array<char> vertexData{NoInit, 11*sizeof(Vector3)};
+    Containers::ArrayView<Vector3> vertices = Containers::arrayCast<Vector3>(vertexData);
+    for(std::size_t i = 0; i != 11; ++i)
+        vertices[i] = points[i];
+    Trade::MeshData mesh{MeshPrimitive::Points, Utility::move(vertexData), {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, vertices}
+        }};
+    transform3DInPlace(mesh, transformation);
+    CORRADE_COMPARE_AS(mesh.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::stridedArrayView(expected),
+        TestSuite::Compare::Container);
+}
+
 template<class T> void TransformTest::meshData2D() {
     auto&& data = MeshData2DData[testCaseInstanceId()];
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
@@ -1816,6 +1912,55 @@ void TransformTest::meshDataTextureCoordinates2DInPlaceWrongFormat() {
     CORRADE_COMPARE(out.str(), "MeshTools::transformTextureCoordinates2DInPlace(): expected VertexFormat::Vector2 texture coordinates but got VertexFormat::Vector2us\n");
 }
 
+constexpr std::size_t BenchmarkVertexCount = 10000000;
+
+const Matrix4 BenchmarkTransformation = Matrix4::translation({1.0f, -2.0f, 0.5f})*
+    Matrix4::rotation(35.0_degf, Vector3{1.0f, 1.0f, 0.0f}.normalized())*
+    Matrix4::scaling({2.0f, 1.0f, 3.0f});
+
+void TransformTest::benchmarkTransformPoints3DLoop() {
+    Containers::Array<Vector3> points{DirectInit, BenchmarkVertexCount, 1.0f, 2.0f, 3.0f};
+
+    /* Reference for the batch variant below, doing the same as what
+       transformPointsInPlace() did before */
+    CORRADE_BENCHMARK(1) {
+        for(Vector3& point: points)
+            point = BenchmarkTransformation.transformPoint(point);
+    }
+
+    CORRADE_VERIFY(points[BenchmarkVertexCount/2] != Vector3{});
+}
+
+void TransformTest::benchmarkTransformPoints3D() {
+    Containers::Array<Vector3> points{DirectInit, BenchmarkVertexCount, 1.0f, 2.0f, 3.0f};
+
+    CORRADE_BENCHMARK(1)
+        transformPointsInPlace(BenchmarkTransformation, points);
+
+    CORRADE_VERIFY(points[BenchmarkVertexCount/2] != Vector3{});
+}
+
+void TransformTest::benchmarkMeshData3DInPlace() {
+    struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+    };
+    Containers::Array<char> vertexData{NoInit, BenchmarkVertexCount*sizeof(Vertex)};
+    Containers::StridedArrayView1D<Vertex> vertices = Containers::arrayCast<Vertex>(vertexData);
+    for(Vertex& vertex: vertices)
+        vertex = {{1.0f, 2.0f, 3.0f}, Vector3::zAxis()};
+
+    Trade::MeshData mesh{MeshPrimitive::Triangles, Utility::move(vertexData), {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, vertices.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, vertices.slice(&Vertex::normal)}
+    }};
+
+    CORRADE_BENCHMARK(1)
+        transform3DInPlace(mesh, BenchmarkTransformation);
+
+    CORRADE_VERIFY(mesh.attribute<Vector3>(Trade::MeshAttribute::Normal)[BenchmarkVertexCount/2] != Vector3{});
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TransformTest)
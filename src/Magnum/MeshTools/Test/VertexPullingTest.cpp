@@ -0,0 +1,245 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/MeshTools/VertexPulling.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct VertexPullingTest: TestSuite::Tester {
+    explicit VertexPullingTest();
+
+    void data();
+    void positionsOnly();
+
+    void noMeshes();
+    void wrongVertexOffsetCount();
+    void noPositions();
+};
+
+VertexPullingTest::VertexPullingTest() {
+    addTests({&VertexPullingTest::data,
+              &VertexPullingTest::positionsOnly,
+
+              &VertexPullingTest::noMeshes,
+              &VertexPullingTest::wrongVertexOffsetCount,
+              &VertexPullingTest::noPositions});
+}
+
+using namespace Math::Literals;
+
+void VertexPullingTest::data() {
+    /* 2D positions, three-component tangents and colors */
+    const struct VertexA {
+        Vector2 position;
+        Vector3 tangent;
+        Color3 color;
+    } verticesA[]{
+        {{1.0f, 2.0f}, {1.0f, 0.0f, 0.0f}, 0xff3366_rgbf},
+        {{3.0f, 4.0f}, {0.0f, 1.0f, 0.0f}, 0x3366ff_rgbf}
+    };
+    const Containers::StridedArrayView1D<const VertexA> viewA = verticesA;
+    const Trade::MeshData a{MeshPrimitive::Triangles, {}, verticesA, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            viewA.slice(&VertexA::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Tangent,
+            viewA.slice(&VertexA::tangent)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Color,
+            viewA.slice(&VertexA::color)}
+    }};
+
+    /* 3D positions, normals, four-component tangents and texture coordinates,
+       the index buffer is ignored */
+    const struct VertexB {
+        Vector3 position;
+        Vector3 normal;
+        Vector4 tangent;
+        Vector2 textureCoordinates;
+    } verticesB[]{
+        {{5.0f, 6.0f, 7.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f, -1.0f}, {0.25f, 0.5f}},
+        {{8.0f, 9.0f, 10.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f, 1.0f}, {0.75f, 1.0f}},
+        {{11.0f, 12.0f, 13.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f, -1.0f}, {0.0f, 0.125f}}
+    };
+    const UnsignedShort indicesB[]{2, 1, 0};
+    const Containers::StridedArrayView1D<const VertexB> viewB = verticesB;
+    const Trade::MeshData b{MeshPrimitive::Triangles,
+        {}, indicesB, Trade::MeshIndexData{indicesB},
+        {}, verticesB, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                viewB.slice(&VertexB::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal,
+                viewB.slice(&VertexB::normal)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Tangent,
+                viewB.slice(&VertexB::tangent)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+                viewB.slice(&VertexB::textureCoordinates)}
+        }};
+
+    UnsignedInt vertexOffsets[2];
+    Containers::Pair<Containers::Array<char>, VertexPullingLayout> out = vertexPullingData({a, b}, vertexOffsets);
+    CORRADE_COMPARE_AS(Containers::arrayView(vertexOffsets),
+        Containers::arrayView<UnsignedInt>({0, 2}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(out.second().vertexCount, 5);
+    CORRADE_COMPARE(out.second().position, 0);
+    CORRADE_COMPARE(out.second().normal, 15);
+    CORRADE_COMPARE(out.second().tangent, 30);
+    CORRADE_COMPARE(out.second().bitangent, ~UnsignedInt{});
+    CORRADE_COMPARE(out.second().textureCoordinates, 50);
+    CORRADE_COMPARE(out.second().color, 60);
+    CORRADE_COMPARE(out.first().size(), VertexPullingHeaderSize + 80*4);
+
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedInt>(out.first().prefix(VertexPullingHeaderSize)),
+        Containers::arrayView<UnsignedInt>({
+            0, 15, 30, ~UnsignedInt{}, 50, 60, 5, 0
+        }), TestSuite::Compare::Container);
+
+    const Containers::ArrayView<const Float> data = Containers::arrayCast<const Float>(out.first().exceptPrefix(VertexPullingHeaderSize));
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Vector3>(data.sliceSize(0, 15)),
+        Containers::arrayView<Vector3>({
+            {1.0f, 2.0f, 0.0f},
+            {3.0f, 4.0f, 0.0f},
+            {5.0f, 6.0f, 7.0f},
+            {8.0f, 9.0f, 10.0f},
+            {11.0f, 12.0f, 13.0f}
+        }), TestSuite::Compare::Container);
+    /* The first mesh doesn't have normals, so they're zero */
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Vector3>(data.sliceSize(15, 15)),
+        Containers::arrayView<Vector3>({
+            {},
+            {},
+            {0.0f, 0.0f, 1.0f},
+            {0.0f, 1.0f, 0.0f},
+            {1.0f, 0.0f, 0.0f}
+        }), TestSuite::Compare::Container);
+    /* Three-component tangents get the bitangent sign set to 1 */
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Vector4>(data.sliceSize(30, 20)),
+        Containers::arrayView<Vector4>({
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {0.0f, 1.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, -1.0f},
+            {0.0f, 0.0f, 1.0f, 1.0f},
+            {0.0f, 1.0f, 0.0f, -1.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Vector2>(data.sliceSize(50, 10)),
+        Containers::arrayView<Vector2>({
+            {},
+            {},
+            {0.25f, 0.5f},
+            {0.75f, 1.0f},
+            {0.0f, 0.125f}
+        }), TestSuite::Compare::Container);
+    /* Three-component colors get alpha set to 1, missing colors are
+       opaque black */
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color4>(data.sliceSize(60, 20)),
+        Containers::arrayView<Color4>({
+            0xff3366ff_rgbaf,
+            0x3366ffff_rgbaf,
+            0x000000ff_rgbaf,
+            0x000000ff_rgbaf,
+            0x000000ff_rgbaf
+        }), TestSuite::Compare::Container);
+}
+
+void VertexPullingTest::positionsOnly() {
+    const Vector3 positions[]{
+        {1.0f, 2.0f, 3.0f},
+        {4.0f, 5.0f, 6.0f}
+    };
+    const Trade::MeshData mesh{MeshPrimitive::Points, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            Containers::arrayView(positions)}
+    }};
+
+    UnsignedInt vertexOffsets[1];
+    Containers::Pair<Containers::Array<char>, VertexPullingLayout> out = vertexPullingData({mesh}, vertexOffsets);
+    CORRADE_COMPARE(vertexOffsets[0], 0);
+    CORRADE_COMPARE(out.second().vertexCount, 2);
+    CORRADE_COMPARE(out.second().position, 0);
+    CORRADE_COMPARE(out.second().normal, ~UnsignedInt{});
+    CORRADE_COMPARE(out.second().tangent, ~UnsignedInt{});
+    CORRADE_COMPARE(out.second().bitangent, ~UnsignedInt{});
+    CORRADE_COMPARE(out.second().textureCoordinates, ~UnsignedInt{});
+    CORRADE_COMPARE(out.second().color, ~UnsignedInt{});
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Vector3>(out.first().exceptPrefix(VertexPullingHeaderSize)),
+        Containers::arrayView(positions),
+        TestSuite::Compare::Container);
+}
+
+void VertexPullingTest::noMeshes() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    vertexPullingData(Containers::Iterable<const Trade::MeshData>{}, nullptr);
+    CORRADE_COMPARE(out.str(), "MeshTools::vertexPullingData(): no meshes passed\n");
+}
+
+void VertexPullingTest::wrongVertexOffsetCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MeshData mesh{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr}
+    }};
+    UnsignedInt vertexOffsets[3];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    vertexPullingData({mesh, mesh}, vertexOffsets);
+    CORRADE_COMPARE(out.str(), "MeshTools::vertexPullingData(): expected 2 vertex offsets but got 3\n");
+}
+
+void VertexPullingTest::noPositions() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::MeshData a{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr}
+    }};
+    const Trade::MeshData b{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, VertexFormat::Vector3, nullptr}
+    }};
+    UnsignedInt vertexOffsets[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    vertexPullingData({a, b}, vertexOffsets);
+    CORRADE_COMPARE(out.str(), "MeshTools::vertexPullingData(): mesh 1 has no positions\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::VertexPullingTest)
@@ -284,32 +284,39 @@ void transform3DInPlace(Trade::MeshData& mesh, const Matrix4& transformation, co
     CORRADE_ASSERT(!normalAttributeId || mesh.attributeFormat(*normalAttributeId) == VertexFormat::Vector3,
         "MeshTools::transform3DInPlace(): expected" << VertexFormat::Vector3 << "normals but got" << mesh.attributeFormat(*normalAttributeId), );
 
-    /** @todo this needs a proper batch implementation */
-    for(Vector3& position: mesh.mutableAttribute<Vector3>(*positionAttributeId))
+    /* Affine transformations go directly through the batch implementation in
+       MatrixBatch.h, which is allowed to operate in-place. It doesn't do the
+       projective divide, so projective matrices use the plain loop. */
+    const Containers::StridedArrayView1D<Vector3> positions = mesh.mutableAttribute<Vector3>(*positionAttributeId);
+    if(transformation.row(3) == Vector4{0.0f, 0.0f, 0.0f, 1.0f})
+        Math::transformPointsInto(transformation, positions, positions);
+    else for(Vector3& position: positions)
         position = transformation.transformPoint(position);
 
     /* If no other attributes are present, nothing to do */
     if(!tangentAttributeId && !bitangentAttributeId && !normalAttributeId)
         return;
 
-    const Matrix3x3 normalMatrix = transformation.normalMatrix();
+    /* The TBN attributes are transformed with the normal matrix, expanded
+       back to a Matrix4 with no translation to reuse the same batch
+       implementation */
+    const Matrix4 normalMatrix = Matrix4::from(transformation.normalMatrix(), {});
     if(tangentAttributeId) {
-    /** @todo this needs a proper batch implementation */
-        if(tangentAttributeFormat == VertexFormat::Vector3)
-            for(Vector3& tangent: mesh.mutableAttribute<Vector3>(*tangentAttributeId))
-                tangent = normalMatrix*tangent;
-        else for(Vector4& tangent: mesh.mutableAttribute<Vector4>(*tangentAttributeId)) {
-            tangent.xyz() = normalMatrix*tangent.xyz();
-            /** @todo figure out the fourth component, probably has to get
-                flipped when the scale changes handedness? */
-        }
+        const Containers::StridedArrayView1D<Vector3> tangents = tangentAttributeFormat == VertexFormat::Vector3 ?
+            mesh.mutableAttribute<Vector3>(*tangentAttributeId) :
+            mesh.mutableAttribute<Vector4>(*tangentAttributeId).slice(&Vector4::xyz);
+        /** @todo figure out the fourth component, probably has to get
+            flipped when the scale changes handedness? */
+        Math::transformVectorsInto(normalMatrix, tangents, tangents);
+    }
+    if(bitangentAttributeId) {
+        const Containers::StridedArrayView1D<Vector3> bitangents = mesh.mutableAttribute<Vector3>(*bitangentAttributeId);
+        Math::transformVectorsInto(normalMatrix, bitangents, bitangents);
+    }
+    if(normalAttributeId) {
+        const Containers::StridedArrayView1D<Vector3> normals = mesh.mutableAttribute<Vector3>(*normalAttributeId);
+        Math::transformVectorsInto(normalMatrix, normals, normals);
     }
-    /** @todo this needs a proper batch implementation */
-    if(bitangentAttributeId) for(Vector3& bitangent: mesh.mutableAttribute<Vector3>(*bitangentAttributeId))
-        bitangent = normalMatrix*bitangent;
-    /** @todo this needs a proper batch implementation */
-    if(normalAttributeId) for(Vector3& normal: mesh.mutableAttribute<Vector3>(*normalAttributeId))
-        normal = normalMatrix*normal;
 }
 
 Trade::MeshData transformTextureCoordinates2D(const Trade::MeshData& mesh, const Matrix3& transformation, const UnsignedInt id, const Int morphTargetId, const InterleaveFlags flags) {
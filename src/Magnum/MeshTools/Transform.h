@@ -30,14 +30,44 @@
  * @brief Function @ref Magnum::MeshTools::transformVectorsInPlace(), @ref Magnum::MeshTools::transformVectors(), @ref Magnum::MeshTools::transformPointsInPlace(), @ref Magnum::MeshTools::transformPoints(), @ref Magnum::MeshTools::transform2D(), @ref Magnum::MeshTools::transform2DInPlace(), @ref Magnum::MeshTools::transform3D(), @ref Magnum::MeshTools::transform3DInPlace(), @ref Magnum::MeshTools::transformTextureCoordinates2D(), @ref Magnum::MeshTools::transformTextureCoordinates2DInPlace()
  */
 
+#include <Corrade/Containers/StridedArrayView.h>
+
 #include "Magnum/Math/DualQuaternion.h"
 #include "Magnum/Math/DualComplex.h"
+#include "Magnum/Math/MatrixBatch.h"
 #include "Magnum/MeshTools/InterleaveFlags.h"
 #include "Magnum/MeshTools/visibility.h"
 #include "Magnum/Trade/Trade.h"
 
 namespace Magnum { namespace MeshTools {
 
+namespace Implementation {
+    /* Matrix4<Float> with anything convertible to a strided view of Vector3
+       goes to the batch implementation in MatrixBatch.h, everything else is
+       a plain loop */
+    template<class T, class U> using IsBatchTransformable = std::integral_constant<bool, std::is_same<T, Float>::value && std::is_convertible<U&, Containers::StridedArrayView1D<Math::Vector3<Float>>>::value>;
+
+    template<class T, class U> void transformVectorsInPlace(const Math::Matrix4<T>& matrix, U& vectors, std::false_type) {
+        for(auto& vector: vectors) vector = matrix.transformVector(vector);
+    }
+    template<class T, class U> void transformVectorsInPlace(const Math::Matrix4<T>& matrix, U& vectors, std::true_type) {
+        const Containers::StridedArrayView1D<Math::Vector3<Float>> view = vectors;
+        Math::transformVectorsInto(matrix, view, view);
+    }
+    template<class T, class U> void transformPointsInPlace(const Math::Matrix4<T>& matrix, U& points, std::false_type) {
+        for(auto& point: points) point = matrix.transformPoint(point);
+    }
+    template<class T, class U> void transformPointsInPlace(const Math::Matrix4<T>& matrix, U& points, std::true_type) {
+        const Containers::StridedArrayView1D<Math::Vector3<Float>> view = points;
+        /* The batch implementation doesn't do the projective divide, so
+           non-affine matrices have to go through the plain loop */
+        if(matrix.row(3) == Math::Vector4<T>{T(0), T(0), T(0), T(1)})
+            Math::transformPointsInto(matrix, view, view);
+        else for(Math::Vector3<Float>& point: view)
+            point = matrix.transformPoint(point);
+    }
+}
+
 /**
 @brief Transform vectors in-place using given transformation
 
@@ -50,6 +80,11 @@ representations.
 Unlike in @ref transformPointsInPlace(), the transformation does not involve
 translation.
 
+If @p matrix is a @ref Matrix4 and @p vectors are convertible to a
+@ref Corrade::Containers::StridedArrayView1D "Containers::StridedArrayView1D<Vector3>",
+the operation is delegated to the SIMD-optimized
+@ref Math::transformVectorsInto().
+
 Example usage:
 
 @snippet MeshTools.cpp transformVectors
@@ -61,7 +96,7 @@ Example usage:
 @todo GPU transform feedback implementation (otherwise this is only bad joke)
 */
 template<class T, class U> void transformVectorsInPlace(const Math::Matrix4<T>& matrix, U&& vectors) {
-    for(auto& vector: vectors) vector = matrix.transformVector(vector);
+    Implementation::transformVectorsInPlace(matrix, vectors, Implementation::IsBatchTransformable<T, typename std::remove_reference<U>::type>{});
 }
 
 /** @overload */
@@ -104,6 +139,14 @@ requirements are for other transformation representations.
 Unlike in @ref transformVectorsInPlace(), the transformation also involves
 translation.
 
+If @p matrix is an affine @ref Matrix4 (i.e., its bottom row is
+@cpp {0.0f, 0.0f, 0.0f, 1.0f} @ce) and @p points are convertible to a
+@ref Corrade::Containers::StridedArrayView1D "Containers::StridedArrayView1D<Vector3>",
+the operation is delegated to the SIMD-optimized
+@ref Math::transformPointsInto(). Projective matrices are applied point by
+point with @ref Matrix4::transformPoint() in order to preserve the
+projective divide.
+
 Example usage:
 
 @snippet MeshTools.cpp transformPoints
@@ -114,7 +157,7 @@ Example usage:
     @ref DualQuaternion::transformPointNormalized()
 */
 template<class T, class U> void transformPointsInPlace(const Math::Matrix4<T>& matrix, U&& points) {
-    for(auto& point: points) point = matrix.transformPoint(point);
+    Implementation::transformPointsInPlace(matrix, points, Implementation::IsBatchTransformable<T, typename std::remove_reference<U>::type>{});
 }
 
 /** @overload */
@@ -0,0 +1,144 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "VertexPulling.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/VertexFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+Containers::Pair<Containers::Array<char>, VertexPullingLayout> vertexPullingData(const Containers::Iterable<const Trade::MeshData>& meshes, const Containers::StridedArrayView1D<UnsignedInt>& vertexOffsets) {
+    CORRADE_ASSERT(!meshes.isEmpty(),
+        "MeshTools::vertexPullingData(): no meshes passed", {});
+    CORRADE_ASSERT(vertexOffsets.size() == meshes.size(),
+        "MeshTools::vertexPullingData(): expected" << meshes.size() << "vertex offsets but got" << vertexOffsets.size(), {});
+
+    /* Calculate the vertex ranges and decide which attributes get stored.
+       If an attribute is in at least one mesh, it's stored for all. */
+    std::size_t vertexCount = 0;
+    bool hasNormals = false;
+    bool hasTangents = false;
+    bool hasBitangents = false;
+    bool hasTextureCoordinates = false;
+    bool hasColors = false;
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        const Trade::MeshData& mesh = meshes[i];
+        CORRADE_ASSERT(mesh.hasAttribute(Trade::MeshAttribute::Position),
+            "MeshTools::vertexPullingData(): mesh" << i << "has no positions", {});
+        hasNormals = hasNormals || mesh.hasAttribute(Trade::MeshAttribute::Normal);
+        hasTangents = hasTangents || mesh.hasAttribute(Trade::MeshAttribute::Tangent);
+        hasBitangents = hasBitangents || mesh.hasAttribute(Trade::MeshAttribute::Bitangent);
+        hasTextureCoordinates = hasTextureCoordinates || mesh.hasAttribute(Trade::MeshAttribute::TextureCoordinates);
+        hasColors = hasColors || mesh.hasAttribute(Trade::MeshAttribute::Color);
+
+        vertexOffsets[i] = vertexCount;
+        vertexCount += mesh.vertexCount();
+    }
+
+    /* Allocate the attribute arrays one after another */
+    std::size_t size = 0;
+    const auto allocate = [&](const bool present, const std::size_t componentCount) {
+        if(!present) return ~UnsignedInt{};
+        const UnsignedInt offset = size;
+        size += vertexCount*componentCount;
+        return offset;
+    };
+    VertexPullingLayout layout;
+    layout.vertexCount = vertexCount;
+    layout.position = allocate(true, 3);
+    layout.normal = allocate(hasNormals, 3);
+    layout.tangent = allocate(hasTangents, 4);
+    layout.bitangent = allocate(hasBitangents, 3);
+    layout.textureCoordinates = allocate(hasTextureCoordinates, 2);
+    layout.color = allocate(hasColors, 4);
+    /* ~UnsignedInt{} is reserved for attributes that aren't present, so the
+       largest allowed size is one less */
+    CORRADE_ASSERT(size < ~UnsignedInt{},
+        "MeshTools::vertexPullingData(): expected less than 4294967295 values in total but got" << size, {});
+
+    /* Zero-initialized, so meshes that don't have given attribute only need
+       to have the fourth component set if there's any */
+    Containers::Array<char> out{ValueInit, VertexPullingHeaderSize + size*sizeof(Float)};
+
+    const Containers::ArrayView<UnsignedInt> header = Containers::arrayCast<UnsignedInt>(out.prefix(VertexPullingHeaderSize));
+    header[0] = layout.position;
+    header[1] = layout.normal;
+    header[2] = layout.tangent;
+    header[3] = layout.bitangent;
+    header[4] = layout.textureCoordinates;
+    header[5] = layout.color;
+    header[6] = layout.vertexCount;
+    /* header[7] is padding, zero */
+
+    const Containers::ArrayView<Float> data = Containers::arrayCast<Float>(out.exceptPrefix(VertexPullingHeaderSize));
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        const Trade::MeshData& mesh = meshes[i];
+        const std::size_t offset = vertexOffsets[i];
+        const std::size_t count = mesh.vertexCount();
+
+        mesh.positions3DInto(Containers::arrayCast<Vector3>(data.sliceSize(layout.position + offset*3, count*3)));
+
+        if(hasNormals && mesh.hasAttribute(Trade::MeshAttribute::Normal))
+            mesh.normalsInto(Containers::arrayCast<Vector3>(data.sliceSize(layout.normal + offset*3, count*3)));
+
+        if(hasTangents) {
+            const Containers::StridedArrayView1D<Vector4> tangents = Containers::arrayCast<Vector4>(data.sliceSize(layout.tangent + offset*4, count*4));
+            const Containers::StridedArrayView1D<Float> bitangentSigns = Containers::arrayCast<2, Float>(tangents).transposed<0, 1>()[3];
+            if(mesh.hasAttribute(Trade::MeshAttribute::Tangent)) {
+                mesh.tangentsInto(Containers::arrayCast<Vector3>(tangents));
+                if(vertexFormatComponentCount(mesh.attributeFormat(Trade::MeshAttribute::Tangent)) == 4)
+                    mesh.bitangentSignsInto(bitangentSigns);
+                else for(Float& i: bitangentSigns) i = 1.0f;
+            } else for(Float& i: bitangentSigns) i = 1.0f;
+        }
+
+        if(hasBitangents && mesh.hasAttribute(Trade::MeshAttribute::Bitangent))
+            mesh.bitangentsInto(Containers::arrayCast<Vector3>(data.sliceSize(layout.bitangent + offset*3, count*3)));
+
+        if(hasTextureCoordinates && mesh.hasAttribute(Trade::MeshAttribute::TextureCoordinates))
+            mesh.textureCoordinates2DInto(Containers::arrayCast<Vector2>(data.sliceSize(layout.textureCoordinates + offset*2, count*2)));
+
+        if(hasColors) {
+            const Containers::ArrayView<Color4> colors = Containers::arrayCast<Color4>(data.sliceSize(layout.color + offset*4, count*4));
+            /* colorsInto() already sets alpha to 1 for three-component
+               colors */
+            if(mesh.hasAttribute(Trade::MeshAttribute::Color))
+                mesh.colorsInto(colors);
+            else for(Color4& i: colors) i.a() = 1.0f;
+        }
+    }
+
+    return {Utility::move(out), layout};
+}
+
+}}
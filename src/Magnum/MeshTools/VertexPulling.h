@@ -0,0 +1,151 @@
+#ifndef Magnum_MeshTools_VertexPulling_h
+#define Magnum_MeshTools_VertexPulling_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::VertexPullingLayout, function @ref Magnum::MeshTools::vertexPullingData()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Vertex pulling buffer layout
+@m_since_latest
+
+Describes data produced by @ref vertexPullingData() and
+@ref compileVertexPulling(). The attribute offsets are in 32-bit units and
+relative to the start of the vertex data, i.e. right after the
+@ref VertexPullingHeaderSize "32-byte header". All attributes are stored as
+tightly packed 32-bit floats, attributes that are not present in any of the
+meshes have the offset set to @cpp 0xffffffffu @ce.
+*/
+struct VertexPullingLayout {
+    /**
+     * @brief Total vertex count
+     *
+     * Sum of vertex counts of all meshes.
+     */
+    UnsignedInt vertexCount;
+
+    /**
+     * @brief Position offset
+     *
+     * Three floats per vertex, 2D positions have the Z component set to
+     * @cpp 0.0f @ce. Always present, always @cpp 0 @ce.
+     */
+    UnsignedInt position;
+
+    /** @brief Normal offset, three floats per vertex */
+    UnsignedInt normal;
+
+    /**
+     * @brief Tangent offset
+     *
+     * Four floats per vertex, the last component is a bitangent sign.
+     * Three-component tangents have it set to @cpp 1.0f @ce.
+     */
+    UnsignedInt tangent;
+
+    /** @brief Bitangent offset, three floats per vertex */
+    UnsignedInt bitangent;
+
+    /** @brief Texture coordinate offset, two floats per vertex */
+    UnsignedInt textureCoordinates;
+
+    /**
+     * @brief Color offset
+     *
+     * Four floats per vertex, three-component colors have alpha set to
+     * @cpp 1.0f @ce.
+     */
+    UnsignedInt color;
+};
+
+/**
+@brief Size of the vertex pulling buffer header
+@m_since_latest
+
+The header is at the start of data produced by @ref vertexPullingData() and
+contains eight 32-bit unsigned integers --- @ref VertexPullingLayout::position,
+@relativeref{VertexPullingLayout,normal},
+@relativeref{VertexPullingLayout,tangent},
+@relativeref{VertexPullingLayout,bitangent},
+@relativeref{VertexPullingLayout,textureCoordinates},
+@relativeref{VertexPullingLayout,color},
+@relativeref{VertexPullingLayout,vertexCount} and a zero padding, in that
+order.
+*/
+constexpr UnsignedInt VertexPullingHeaderSize = 32;
+
+/**
+@brief Vertex pulling data for a set of meshes
+@param[in]  meshes          Meshes to put into a single buffer
+@param[out] vertexOffsets   Where to put offset of the first vertex of each
+    mesh
+@return Buffer data and their layout
+@m_since_latest
+
+Concatenates all vertices of all @p meshes into separate per-attribute arrays
+converted to 32-bit floats, suitable for fetching from a shader storage buffer
+based on vertex ID instead of going through vertex attribute bindings. This is
+what @ref Shaders::FlatGL::Flag::VertexPulling and
+@ref Shaders::PhongGL::Flag::VertexPulling consume, see
+@ref compileVertexPulling() for a function that uploads the data to a GL
+buffer and creates a mesh with a matching index buffer.
+
+Only the first @ref Trade::MeshAttribute::Position,
+@relativeref{Trade::MeshAttribute,Normal},
+@relativeref{Trade::MeshAttribute,Tangent},
+@relativeref{Trade::MeshAttribute,Bitangent},
+@relativeref{Trade::MeshAttribute,TextureCoordinates} and
+@relativeref{Trade::MeshAttribute,Color} attribute of each mesh is taken,
+other attributes, morph targets and index data are ignored. If an attribute is
+present in at least one mesh, it's stored for all vertices of all meshes, with
+meshes that don't have it getting zeros in place of all components except the
+fourth, which is set to @cpp 1.0f @ce --- i.e., the same default that an
+unbound vertex attribute gets in GL. If it isn't present in any mesh, it's
+omitted from the output altogether.
+
+Expects that @p meshes is not empty, that all meshes have a position attribute,
+that none of the taken attributes has an implementation-specific format and
+that @p vertexOffsets has the same size as @p meshes. As the data are indexed
+with a 32-bit vertex ID and offsets, the total size is expected to fit into
+32 bits.
+@see @ref VertexPullingHeaderSize
+*/
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, VertexPullingLayout> vertexPullingData(const Containers::Iterable<const Trade::MeshData>& meshes, const Containers::StridedArrayView1D<UnsignedInt>& vertexOffsets);
+
+}}
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef Magnum_Parallel_h
+#define Magnum_Parallel_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Typedef @ref Magnum::ParallelFor, function @ref Magnum::parallelForSerial()
+ * @m_since_latest
+ */
+
+#include <cstddef>
+
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Parallel loop executor
+@param state        State pointer passed alongside the executor to the
+    algorithm
+@param count        Count of iterations
+@param task         Task to execute for every iteration
+@param taskState    State pointer to pass to @p task
+@m_since_latest
+
+Algorithms in @ref MeshTools, @ref SceneTools, @ref TextureTools,
+@ref MaterialTools, @ref Animation, @ref SceneGraph, @ref Text and plugins in
+@ref Trade that are able to make use of multiple threads don't spawn any
+threads on their own but instead take a function of this signature, together
+with a @p state pointer, that is the integration point with an arbitrary
+thread pool or task scheduler in the application. Each of these libraries
+has its own alias to this type, and since this header is standalone, none of
+them need to depend on each other because of it. Pass
+@ref ThreadPool::parallelFor() together with a pointer to a
+@ref ThreadPool instance to use the thread pool provided by Magnum.
+
+The function is expected to call @p task with @p taskState and each value in
+range @cpp [0, count) @ce exactly once, in any order and possibly concurrently
+from multiple threads, and return only after all calls finished. The
+algorithms are designed in a way that the result doesn't depend on the order
+of the calls or on the count of threads used.
+
+Passing @cpp nullptr @ce in place of a @ref ParallelFor to any of these
+algorithms is equivalent to passing @ref parallelForSerial(), i.e. everything
+is executed on the calling thread.
+*/
+typedef void(*ParallelFor)(void* state, std::size_t count, void(*task)(void* taskState, std::size_t i), void* taskState);
+
+/**
+@brief Serial loop executor
+@m_since_latest
+
+A @ref ParallelFor implementation that calls @p task for all values in range
+@cpp [0, count) @ce in order on the calling thread. The @p state is ignored.
+Each library that takes a @ref ParallelFor has an alias to this function next
+to its @ref ParallelFor alias.
+*/
+MAGNUM_EXPORT void parallelForSerial(void* state, std::size_t count, void(*task)(void* taskState, std::size_t i), void* taskState);
+
+}
+
+#endif
@@ -38,6 +38,7 @@
 #include <Corrade/Utility/Debug.h>
 
 #include "Magnum/Math/ConfigurationValue.h"
+#include "Magnum/Math/Time.h"
 #include "Magnum/Platform/ScreenedApplication.hpp"
 #include "Magnum/Platform/Implementation/DpiScaling.h"
 
@@ -60,12 +61,19 @@ extern "C" {
 namespace Magnum { namespace Platform {
 
 using namespace Containers::Literals;
+using namespace Math::Literals;
 
 enum class EmscriptenApplication::Flag: UnsignedByte {
     Redraw = 1 << 0,
     TextInputActive = 1 << 1,
     ExitRequested = 1 << 2,
-    LoopActive = 1 << 3
+    LoopActive = 1 << 3,
+    /* Set by redraw() and canvas resize, otherwise only the damaged region
+       accumulated by redraw(const Range2Di&) is meant to be redrawn */
+    FullRedraw = 1 << 4,
+    /* Whether the WebGL context preserves the drawing buffer, i.e. whether
+       a partial redraw makes sense at all */
+    PreserveDrawingBuffer = 1 << 5
 };
 
 namespace {
@@ -216,7 +224,7 @@ EmscriptenApplication::EmscriptenApplication(const Arguments& arguments, const C
 #endif
 
 EmscriptenApplication::EmscriptenApplication(const Arguments& arguments, NoCreateT):
-    _flags{Flag::Redraw}
+    _flags{Flag::Redraw|Flag::FullRedraw}
 {
     Utility::Arguments args{Implementation::windowScalingArguments()};
     #ifdef MAGNUM_TARGET_GL
@@ -362,6 +370,8 @@ bool EmscriptenApplication::tryCreate(const Configuration& configuration, const
         !!(glConfiguration.flags() & GLConfiguration::Flag::PremultipliedAlpha);
     attrs.preserveDrawingBuffer =
         !!(glConfiguration.flags() & GLConfiguration::Flag::PreserveDrawingBuffer);
+    if(attrs.preserveDrawingBuffer)
+        _flags |= Flag::PreserveDrawingBuffer;
     if(glConfiguration.flags() & GLConfiguration::Flag::PowerPreferenceLowPower)
         attrs.powerPreference = EM_WEBGL_POWER_PREFERENCE_LOW_POWER;
     else if(glConfiguration.flags() & GLConfiguration::Flag::PowerPreferenceHighPerformance)
@@ -497,6 +507,7 @@ void EmscriptenApplication::handleCanvasResize(const EmscriptenUiEvent* event) {
         /* Can't say just _flags | Flag::Redraw because in case the
            requestAnimationFrame callback is not set up at the moment it would
            never up this change. */
+        markActivity();
         redraw();
     }
 }
@@ -635,6 +646,7 @@ void EmscriptenApplication::setupCallbacks(bool resizable) {
     const auto mousedown =
         [](int, const EmscriptenMouseEvent* event, void* userData) -> EM_BOOL {
             auto& app = *static_cast<EmscriptenApplication*>(userData);
+            app.markActivity();
 
             #if __EMSCRIPTEN_major__*10000 + __EMSCRIPTEN_minor__*100 + __EMSCRIPTEN_tiny__ >= 20027
             /* If the event timestamp is the same (bit-exact, in fact) as the
@@ -675,6 +687,7 @@ void EmscriptenApplication::setupCallbacks(bool resizable) {
     const auto mouseup =
         [](int, const EmscriptenMouseEvent* event, void* userData) -> EM_BOOL {
             auto& app = *static_cast<EmscriptenApplication*>(userData);
+            app.markActivity();
 
             #if __EMSCRIPTEN_major__*10000 + __EMSCRIPTEN_minor__*100 + __EMSCRIPTEN_tiny__ >= 20027
             /* If the event timestamp is the same (bit-exact, in fact) as the
@@ -710,6 +723,7 @@ void EmscriptenApplication::setupCallbacks(bool resizable) {
     emscripten_set_mousemove_callback(_canvasTarget.data(), this, false,
         ([](int, const EmscriptenMouseEvent* event, void* userData) -> EM_BOOL {
             auto& app = *static_cast<EmscriptenApplication*>(userData);
+            app.markActivity();
             const Pointers pointers = buttonsToPointers(event->buttons);
             const Modifiers modifiers = eventModifiers(*event);
             const Vector2 position = eventTargetPosition(*event);
@@ -727,8 +741,10 @@ void EmscriptenApplication::setupCallbacks(bool resizable) {
 
     emscripten_set_wheel_callback(_canvasTarget.data(), this, false,
         ([](int, const EmscriptenWheelEvent* event, void* userData) -> EM_BOOL {
+            auto& app = *static_cast<EmscriptenApplication*>(userData);
+            app.markActivity();
             ScrollEvent e{*event};
-            static_cast<EmscriptenApplication*>(userData)->scrollEvent(e);
+            app.scrollEvent(e);
             return e.isAccepted();
         }));
 
@@ -741,6 +757,7 @@ void EmscriptenApplication::setupCallbacks(bool resizable) {
     emscripten_set_touchstart_callback(_canvasTarget.data(), this, false,
         ([](int, const EmscriptenTouchEvent* event, void* userData) -> EM_BOOL {
             auto& app = *static_cast<EmscriptenApplication*>(userData);
+            app.markActivity();
             /** @todo somehow desktop Chrome doesn't populate these for touch
                 events, is that a browser bug? Emscripten seems to fill them in
                 https://github.com/emscripten-core/emscripten/blob/10cb9d46cdd17e7a96de68137c9649d9a630fbc7/src/library_html5.js#L1930-L1933
@@ -787,6 +804,7 @@ void EmscriptenApplication::setupCallbacks(bool resizable) {
     emscripten_set_touchend_callback(_canvasTarget.data(), this, false,
         ([](int, const EmscriptenTouchEvent* event, void* userData) -> EM_BOOL {
             auto& app = *static_cast<EmscriptenApplication*>(userData);
+            app.markActivity();
             /** @todo somehow desktop Chrome doesn't populate these for touch
                 events, see above */
             const Modifiers modifiers = eventModifiers(*event);
@@ -839,6 +857,7 @@ void EmscriptenApplication::setupCallbacks(bool resizable) {
     emscripten_set_touchmove_callback(_canvasTarget.data(), this, false,
         ([](int, const EmscriptenTouchEvent* event, void* userData) -> EM_BOOL {
             auto& app = *static_cast<EmscriptenApplication*>(userData);
+            app.markActivity();
             /** @todo somehow desktop Chrome doesn't populate these for touch
                 events, see above */
             const Modifiers modifiers = eventModifiers(*event);
@@ -900,6 +919,7 @@ void EmscriptenApplication::setupCallbacks(bool resizable) {
     emscripten_set_keydown_callback(keyboardListeningElement, this, false,
         ([](int, const EmscriptenKeyboardEvent* event, void* userData) -> EM_BOOL {
             EmscriptenApplication& app = *static_cast<EmscriptenApplication*>(userData);
+            app.markActivity();
             const Containers::StringView key = event->key;
             KeyEvent e{*event};
             app.keyPressEvent(e);
@@ -922,8 +942,10 @@ void EmscriptenApplication::setupCallbacks(bool resizable) {
 
     emscripten_set_keyup_callback(keyboardListeningElement, this, false,
         ([](int, const EmscriptenKeyboardEvent* event, void* userData) -> EM_BOOL {
+            auto& app = *static_cast<EmscriptenApplication*>(userData);
+            app.markActivity();
             KeyEvent e{*event};
-            static_cast<EmscriptenApplication*>(userData)->keyReleaseEvent(e);
+            app.keyReleaseEvent(e);
             return e.isAccepted();
         }));
 }
@@ -938,10 +960,10 @@ void EmscriptenApplication::setupAnimationFrame(bool forceAnimationFrame) {
                 return false;
             }
 
-            if(app._flags & Flag::Redraw) {
-                app._flags &= ~Flag::Redraw;
-                app.drawEvent();
-            }
+            /* With idle throttling, the frame is skipped if it's too early
+               to draw again. The loop itself continues as it's forced. */
+            if((app._flags & Flag::Redraw) && app.idleThrottleDelay() == 0.0)
+                app.callDrawEvent();
 
             return true;
         };
@@ -950,8 +972,24 @@ void EmscriptenApplication::setupAnimationFrame(bool forceAnimationFrame) {
             auto& app = *static_cast<EmscriptenApplication*>(userData);
 
             if((app._flags & Flag::Redraw) && !(app._flags & Flag::ExitRequested)) {
-                app._flags &= ~Flag::Redraw;
-                app.drawEvent();
+                /* If it's too early to draw again due to idle throttling, stop
+                   the animation frame loop altogether so the browser doesn't
+                   need to wake up every frame, and resume it after the
+                   remaining time. The redraw flag stays set. If an input
+                   event comes in the meantime and the application calls
+                   redraw(), the loop gets resumed earlier. */
+                const Double delay = app.idleThrottleDelay();
+                if(delay > 0.0) {
+                    app._flags &= ~Flag::LoopActive;
+                    emscripten_async_call([](void* userData) {
+                        auto& app = *static_cast<EmscriptenApplication*>(userData);
+                        if(app._flags & Flag::Redraw)
+                            app.startAnimationFrameLoop();
+                    }, &app, Int(Math::ceil(delay)));
+                    return false;
+                }
+
+                app.callDrawEvent();
             }
 
             /* If redraw is requested, we will not cancel the already requested
@@ -1172,13 +1210,29 @@ int EmscriptenApplication::exec() {
        without calling anything else */
     if(_flags & Flag::ExitRequested) return 0;
 
+    markActivity();
     redraw();
     return 0;
 }
 
 void EmscriptenApplication::redraw() {
+    _flags |= Flag::Redraw|Flag::FullRedraw;
+    startAnimationFrameLoop();
+}
+
+#ifdef MAGNUM_TARGET_GL
+void EmscriptenApplication::redraw(const Range2Di& region) {
     _flags |= Flag::Redraw;
+    _pendingDamage = Math::join(_pendingDamage, region);
+    startAnimationFrameLoop();
+}
+
+Range2Di EmscriptenApplication::damagedRegion() const {
+    return _currentDamage;
+}
+#endif
 
+void EmscriptenApplication::startAnimationFrameLoop() {
     /* Loop already running, no need to start,
        Note that should javascript runtimes ever be multithreaded, we
        will have a reentrancy issue here. */
@@ -1189,6 +1243,58 @@ void EmscriptenApplication::redraw() {
     magnumPlatformRequestAnimationFrame(_callback, this);
 }
 
+void EmscriptenApplication::callDrawEvent() {
+    _flags &= ~Flag::Redraw;
+
+    #ifdef MAGNUM_TARGET_GL
+    /* Without a preserved drawing buffer the browser discards the contents
+       after every frame, so everything has to be redrawn */
+    const Range2Di framebufferRange{{}, framebufferSize()};
+    if((_flags & Flag::FullRedraw) || !(_flags & Flag::PreserveDrawingBuffer))
+        _currentDamage = framebufferRange;
+    else
+        _currentDamage = Math::intersect(_pendingDamage, framebufferRange);
+    _pendingDamage = {};
+    #endif
+    _flags &= ~Flag::FullRedraw;
+
+    _lastDrawTime = emscripten_get_now();
+    drawEvent();
+}
+
+void EmscriptenApplication::markActivity() {
+    _lastActivityTime = emscripten_get_now();
+}
+
+Double EmscriptenApplication::idleThrottleDelay() const {
+    if(_idleFramePeriod == 0.0) return 0.0;
+
+    const Double now = emscripten_get_now();
+    if(now - _lastActivityTime < _idleTimeout) return 0.0;
+
+    return Math::max(_lastDrawTime + _idleFramePeriod - now, 0.0);
+}
+
+Nanoseconds EmscriptenApplication::idleTimeout() const {
+    return Long(_idleTimeout*1000000.0)*1_nsec;
+}
+
+void EmscriptenApplication::setIdleTimeout(const Nanoseconds timeout) {
+    CORRADE_ASSERT(timeout >= 0_nsec,
+        "Platform::EmscriptenApplication::setIdleTimeout(): expected non-negative time, got" << timeout, );
+    _idleTimeout = Long(timeout)/1000000.0;
+}
+
+Nanoseconds EmscriptenApplication::idleFramePeriod() const {
+    return Long(_idleFramePeriod*1000000.0)*1_nsec;
+}
+
+void EmscriptenApplication::setIdleFramePeriod(const Nanoseconds period) {
+    CORRADE_ASSERT(period >= 0_nsec,
+        "Platform::EmscriptenApplication::setIdleFramePeriod(): expected non-negative time, got" << period, );
+    _idleFramePeriod = Long(period)/1000000.0;
+}
+
 void EmscriptenApplication::exit(int) {
     _flags |= Flag::ExitRequested;
 }
@@ -42,6 +42,7 @@
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Tags.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Math/Vector4.h"
 #include "Magnum/Platform/Platform.h"
 
@@ -268,6 +269,56 @@ application has to redraw all the time anyway this can be disabled using
 @ref Configuration::WindowFlag::AlwaysRequestAnimationFrame. Setting the flag
 will make the main loop behave equivalently to @ref Sdl2Application.
 
+@subsection Platform-EmscriptenApplication-browser-partial-redraw Partial redraw
+
+For mostly static content such as dashboards, where only a small part of the
+view changes at a time, the application can call @ref redraw(const Range2Di&)
+with just the changed region instead of @ref redraw(). The regions get joined
+until the next @ref drawEvent(), where @ref damagedRegion() can be used to
+restrict both the clear and the drawing to given area using the scissor test:
+
+@code{.cpp}
+void MyApplication::drawEvent() {
+    GL::Renderer::enable(GL::Renderer::Feature::ScissorTest);
+    GL::Renderer::setScissor(damagedRegion());
+    GL::defaultFramebuffer.clear(GL::FramebufferClear::Color);
+
+    // Draw only what intersects damagedRegion() ...
+
+    GL::Renderer::disable(GL::Renderer::Feature::ScissorTest);
+    swapBuffers();
+}
+@endcode
+
+For this to work, the context has to be created with
+@ref GLConfiguration::Flag::PreserveDrawingBuffer, as otherwise the browser
+discards the framebuffer contents after each frame is composited. Without the
+flag, @ref damagedRegion() always returns the whole framebuffer, so the above
+code behaves the same as a full redraw. Note that preserving the drawing
+buffer may have a performance cost on some platforms, so it's worth enabling
+only if the redrawn regions are significantly smaller than the whole canvas.
+
+@subsection Platform-EmscriptenApplication-browser-idle-throttling Idle throttling
+
+Applications that animate continuously, either by calling @ref redraw() from
+every @ref drawEvent() or by using
+@ref Configuration::WindowFlag::AlwaysRequestAnimationFrame, can reduce their
+CPU and GPU usage when the user isn't interacting with them by calling
+@ref setIdleFramePeriod(). When there was no input or canvas resize event for
+longer than @ref idleTimeout(), @ref drawEvent() is then called at most once
+per given period, and any subsequent input event restores the full frame rate
+immediately:
+
+@code{.cpp}
+/* Draw at 4 FPS after five seconds without any input */
+setIdleTimeout(5.0_sec);
+setIdleFramePeriod(250.0_msec);
+@endcode
+
+Unless @ref Configuration::WindowFlag::AlwaysRequestAnimationFrame is set, the
+animation frame loop is stopped while waiting, so the browser doesn't need to
+wake up the application every frame.
+
 @section Platform-EmscriptenApplication-webgl WebGL-specific behavior
 
 While WebGL itself requires all extensions to be
@@ -646,6 +697,90 @@ class EmscriptenApplication {
         /** @copydoc Sdl2Application::redraw() */
         void redraw();
 
+        #if defined(MAGNUM_TARGET_GL) || defined(DOXYGEN_GENERATING_OUTPUT)
+        /**
+         * @brief Redraw a part of the framebuffer
+         * @m_since_latest
+         *
+         * Like @ref redraw(), but marks only @p region as changed. Regions
+         * passed to all calls until the next @ref drawEvent() are joined
+         * together and made available through @ref damagedRegion(). A call
+         * to @ref redraw() without a region, as well as a canvas resize,
+         * marks the whole framebuffer as changed. The region is in
+         * framebuffer pixels with origin in the bottom left corner, matching
+         * @ref GL::Renderer::setScissor(). See
+         * @ref Platform-EmscriptenApplication-browser-partial-redraw for more
+         * information.
+         *
+         * @note This function is available only if Magnum is compiled with
+         *      @ref MAGNUM_TARGET_GL enabled (done by default). See
+         *      @ref building-features for more information.
+         */
+        void redraw(const Range2Di& region);
+
+        /**
+         * @brief Framebuffer region to redraw
+         * @m_since_latest
+         *
+         * Meant to be called from @ref drawEvent(). Returns a join of all
+         * regions passed to @ref redraw(const Range2Di&) since the previous
+         * @ref drawEvent(), clamped to @ref framebufferSize(). If the whole
+         * framebuffer is meant to be redrawn, or if the context was created
+         * without @ref GLConfiguration::Flag::PreserveDrawingBuffer, in which
+         * case the browser discards framebuffer contents after each frame,
+         * returns a range spanning the whole framebuffer.
+         *
+         * @note This function is available only if Magnum is compiled with
+         *      @ref MAGNUM_TARGET_GL enabled (done by default). See
+         *      @ref building-features for more information.
+         */
+        Range2Di damagedRegion() const;
+        #endif
+
+        /**
+         * @brief Idle timeout
+         * @m_since_latest
+         *
+         * @see @ref setIdleTimeout(), @ref idleFramePeriod()
+         */
+        Nanoseconds idleTimeout() const;
+
+        /**
+         * @brief Set idle timeout
+         * @m_since_latest
+         *
+         * Time after the last input or resize event after which the
+         * application is considered idle and @ref drawEvent() calls get
+         * throttled to @ref idleFramePeriod(). Expects that the value is
+         * non-negative. Default is one second. See
+         * @ref Platform-EmscriptenApplication-browser-idle-throttling for
+         * more information.
+         */
+        void setIdleTimeout(Nanoseconds timeout);
+
+        /**
+         * @brief Idle frame period
+         * @m_since_latest
+         *
+         * @see @ref setIdleFramePeriod(), @ref idleTimeout()
+         */
+        Nanoseconds idleFramePeriod() const;
+
+        /**
+         * @brief Set idle frame period
+         * @m_since_latest
+         *
+         * When the application is idle for longer than @ref idleTimeout(),
+         * @ref drawEvent() is called at most once per @p period, even if
+         * @ref redraw() gets called every frame. Any input or resize event
+         * restores the full frame rate immediately. Expects that the value
+         * is non-negative, @cpp 0_nsec @ce disables the throttling. Default
+         * is @cpp 0_nsec @ce. See
+         * @ref Platform-EmscriptenApplication-browser-idle-throttling for
+         * more information.
+         */
+        void setIdleFramePeriod(Nanoseconds period);
+
     private:
         /**
          * @brief Viewport event
@@ -1114,6 +1249,16 @@ class EmscriptenApplication {
         /* Sorry, but can't use Configuration::WindowFlags here :( */
         void setupCallbacks(bool resizable);
         void setupAnimationFrame(bool ForceAnimationFrame);
+        /* Clears the redraw flags, calculates damagedRegion() and calls
+           drawEvent() */
+        void callDrawEvent();
+        /* Requests an animation frame if the loop isn't active already */
+        void startAnimationFrameLoop();
+        /* Records an input or resize event for idle throttling */
+        void markActivity();
+        /* Whether drawEvent() should be postponed due to idle throttling,
+           returns the remaining time in milliseconds or 0 */
+        Double idleThrottleDelay() const;
 
         Vector2i _lastKnownCanvasSize;
         Vector2 _previousMouseMovePosition{Constants::nan()};
@@ -1154,6 +1299,18 @@ class EmscriptenApplication {
 
         /* Animation frame callback */
         int (*_callback)(void*);
+
+        #ifdef MAGNUM_TARGET_GL
+        /* Damage accumulated since the last drawEvent() and damage for the
+           drawEvent() currently being executed. Unused if Flag::FullRedraw
+           is set. */
+        Range2Di _pendingDamage, _currentDamage;
+        #endif
+
+        /* All in milliseconds as returned by emscripten_get_now(). Not using
+           Nanoseconds as that would require including Time.h. */
+        Double _idleTimeout{1000.0}, _idleFramePeriod{},
+            _lastActivityTime{}, _lastDrawTime{};
 };
 
 /**
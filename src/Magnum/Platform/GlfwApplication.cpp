@@ -42,6 +42,7 @@
 #include "Magnum/Math/Time.h"
 #include "Magnum/Platform/ScreenedApplication.hpp"
 #include "Magnum/Platform/Implementation/DpiScaling.h"
+#include "Magnum/Platform/Implementation/FramePacing.h"
 
 #ifdef MAGNUM_TARGET_GL
 #include "Magnum/GL/Version.h"
@@ -799,7 +800,31 @@ Vector2 GlfwApplication::dpiScaling() const {
     return dpiScalingInternal(_configurationDpiScalingPolicy, _configurationDpiScaling);
 }
 
+void GlfwApplication::swapBuffers() {
+    glfwSwapBuffers(_window);
+
+    const Long now = Implementation::framePacingNow();
+    if(_lastSwapNanoseconds)
+        _presentIntervalNanoseconds = now - _lastSwapNanoseconds;
+    _lastSwapNanoseconds = now;
+}
+
+Nanoseconds GlfwApplication::presentInterval() const {
+    return _presentIntervalNanoseconds*1_nsec;
+}
+
 void GlfwApplication::setSwapInterval(const Int interval) {
+    /* Adaptive VSync is an extension that's not supported everywhere, and
+       GLFW doesn't check that on its own, fall back to the regular one in
+       that case */
+    if(interval < 0 &&
+       !glfwExtensionSupported("WGL_EXT_swap_control_tear") &&
+       !glfwExtensionSupported("GLX_EXT_swap_control_tear"))
+    {
+        Warning() << "Platform::GlfwApplication::setSwapInterval(): adaptive swap interval not supported, falling back to" << -interval;
+        return setSwapInterval(-interval);
+    }
+
     glfwSwapInterval(interval);
 
     /* Remember whether VSync is enabled for mainLoopIteration() to use
@@ -816,6 +841,18 @@ void GlfwApplication::setMinimalLoopPeriod(const Nanoseconds time) {
     _minimalLoopPeriodNanoseconds = Long(time);
 }
 
+Nanoseconds GlfwApplication::targetFramePeriod() const {
+    return _targetFramePeriodNanoseconds*1_nsec;
+}
+
+void GlfwApplication::setTargetFramePeriod(const Nanoseconds period) {
+    CORRADE_ASSERT(period >= 0_nsec,
+        "Platform::GlfwApplication::setTargetFramePeriod(): expected non-negative time, got" << period, );
+    _targetFramePeriodNanoseconds = Long(period);
+    /* Start a new schedule with the next frame */
+    _nextFrameDeadlineNanoseconds = 0;
+}
+
 void GlfwApplication::redraw() { _flags |= Flag::Redraw; }
 
 int GlfwApplication::exec() {
@@ -865,8 +902,13 @@ bool GlfwApplication::mainLoopIteration() {
         _flags &= ~Flag::Redraw;
         drawEvent();
 
+        /* If frame pacing is enabled, wait until the next frame is due. This
+           supersedes the minimal loop period. */
+        if(_targetFramePeriodNanoseconds)
+            _nextFrameDeadlineNanoseconds = Implementation::framePacingWait(_nextFrameDeadlineNanoseconds, _targetFramePeriodNanoseconds);
+
         /* If VSync is not enabled, delay to prevent CPU hogging (if set) */
-        if(!(_flags & Flag::VSyncEnabled) && _minimalLoopPeriodNanoseconds) {
+        else if(!(_flags & Flag::VSyncEnabled) && _minimalLoopPeriodNanoseconds) {
             const Nanoseconds loopTime = glfwGetTime()*1.0_sec - timeBefore;
             if(loopTime < _minimalLoopPeriodNanoseconds*1_nsec)
                 Utility::System::sleep((_minimalLoopPeriodNanoseconds*1_nsec - loopTime)/1.0_msec);
@@ -578,15 +578,35 @@ class GlfwApplication {
          * @brief Swap buffers
          *
          * Paints currently rendered framebuffer on screen.
+         * @see @ref setSwapInterval(), @ref presentInterval()
          */
-        void swapBuffers() { glfwSwapBuffers(_window); }
+        void swapBuffers();
+
+        /**
+         * @brief Present interval
+         * @m_since_latest
+         *
+         * Time between the two most recent @ref swapBuffers() calls, measured
+         * on the CPU with a monotonic clock right after each swap returns.
+         * With VSync enabled the swap usually blocks until the frame is
+         * presented, making this a good approximation of the
+         * present-to-present time. Returns @cpp 0_nsec @ce until
+         * @ref swapBuffers() was called at least twice. Include
+         * @ref Magnum/Math/Time.h to operate with the returned value.
+         * @see @ref setTargetFramePeriod()
+         */
+        Nanoseconds presentInterval() const;
 
         /**
          * @brief Set swap interval
          *
          * Set @cpp 0 @ce for no VSync, @cpp 1 @ce for enabled VSync. Some
-         * platforms support @cpp -1 @ce for late swap tearing. Default is
-         * driver-dependent.
+         * platforms support @cpp -1 @ce for adaptive VSync, also called late
+         * swap tearing, which waits for VSync only if the frame was finished
+         * in time and presents it immediately otherwise, avoiding a stutter
+         * down to half the refresh rate. If a negative interval isn't
+         * supported, the function prints a warning and falls back to a
+         * corresponding positive interval. Default is driver-dependent.
          *
          * @note Unlike SDL2, GLFW doesn't provide any getter for the swap
          *      interval, so this class doesn't provide any equivalent to
@@ -609,10 +629,39 @@ class GlfwApplication {
          * Note that as the VSync default is driver-dependent,
          * @ref setSwapInterval() has to be explicitly called to make the
          * interaction between the two work correctly.
-         * @see @ref setSwapInterval()
+         * @see @ref setSwapInterval(), @ref setTargetFramePeriod()
          */
         void setMinimalLoopPeriod(Nanoseconds time);
 
+        /**
+         * @brief Target frame period
+         * @m_since_latest
+         */
+        Nanoseconds targetFramePeriod() const;
+
+        /**
+         * @brief Set target frame period
+         * @m_since_latest
+         *
+         * If non-zero, every @ref drawEvent() is followed by a wait until the
+         * next frame is due, so frames are delivered at a consistent rate of
+         * one per @p period. The schedule is kept on a fixed grid to not
+         * accumulate drift, and if the application falls behind by a whole
+         * period or more, it's restarted instead of catching up with a burst
+         * of frames. The wait sleeps for most of the remaining time and spins
+         * for the last two milliseconds, making it independent of the OS
+         * scheduler granularity. As input events are processed right after
+         * the wait, pacing the frames this way also has a lower input latency
+         * than waiting for VSync in @ref swapBuffers().
+         *
+         * Unlike @ref setMinimalLoopPeriod() this is applied also with VSync
+         * enabled, which can be used to cap the frame rate below the display
+         * refresh rate. The @p period is expected to be non-negative, default
+         * is @cpp 0_nsec @ce (i.e., no pacing). Use @ref presentInterval() to
+         * verify the achieved frame timing.
+         */
+        void setTargetFramePeriod(Nanoseconds period);
+
         /** @copydoc Sdl2Application::redraw() */
         void redraw();
 
@@ -1004,6 +1053,10 @@ class GlfwApplication {
         GLFWwindow* _window{nullptr};
         /* Not using Nanoseconds as that would require including Time.h */
         UnsignedInt _minimalLoopPeriodNanoseconds{};
+        Long _targetFramePeriodNanoseconds{};
+        Long _nextFrameDeadlineNanoseconds{};
+        Long _lastSwapNanoseconds{};
+        Long _presentIntervalNanoseconds{};
         Flags _flags;
         #ifdef MAGNUM_TARGET_GL
         /* Has to be in an Optional because we delay-create it in a constructor
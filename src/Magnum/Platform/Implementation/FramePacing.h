@@ -0,0 +1,76 @@
+#ifndef Magnum_Platform_Implementation_FramePacing_h
+#define Magnum_Platform_Implementation_FramePacing_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include <thread>
+
+#include "Magnum/Magnum.h"
+
+/* Frame pacing logic shared by Sdl2Application and GlfwApplication. Times
+   are in nanoseconds to avoid having to include Time.h in the public
+   headers, where the state is stored. */
+
+namespace Magnum { namespace Platform { namespace Implementation {
+
+/* The wait sleeps only until this long before the deadline and spins for the
+   rest, as sleep granularity is commonly a millisecond or more and the thread
+   may get woken up even later than that */
+constexpr Long FramePacingSpinThreshold = 2000000;
+
+inline Long framePacingNow() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* Deadline for the next frame after a wait for `deadline` finished at `now`.
+   The schedule is kept on a fixed grid so small wakeup jitter doesn't
+   accumulate, but if the loop fell behind by a whole period or more, it's
+   restarted from `now` instead of catching up with a burst of unpaced
+   frames. A zero `deadline` means no frame was paced yet. */
+inline Long framePacingNextDeadline(const Long now, const Long deadline, const Long period) {
+    if(!deadline || now - deadline >= period)
+        return now + period;
+    return deadline + period;
+}
+
+/* Waits until `deadline` with a sleep + spin hybrid and returns the deadline
+   for the next frame */
+inline Long framePacingWait(const Long deadline, const Long period) {
+    Long now = framePacingNow();
+    if(deadline && now < deadline) {
+        if(deadline - now > FramePacingSpinThreshold)
+            std::this_thread::sleep_for(std::chrono::nanoseconds{deadline - now - FramePacingSpinThreshold});
+        while((now = framePacingNow()) < deadline)
+            std::this_thread::yield();
+    }
+
+    return framePacingNextDeadline(now, deadline, period);
+}
+
+}}}
+
+#endif
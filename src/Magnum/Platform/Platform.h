@@ -49,6 +49,9 @@ class TwoFingerGesture;
 
 #ifdef MAGNUM_TARGET_GL
 class GLContext;
+#ifndef MAGNUM_TARGET_WEBGL
+template<class> class SharedGLContextThread;
+#endif
 #endif
 
 }}
@@ -43,6 +43,7 @@
 #include <emscripten/emscripten.h>
 #include <emscripten/html5.h>
 #endif
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Arguments.h>
 
@@ -57,6 +58,7 @@
 #endif
 #include "Magnum/Platform/ScreenedApplication.hpp"
 #include "Magnum/Platform/Implementation/DpiScaling.h"
+#include "Magnum/Platform/Implementation/FramePacing.h"
 
 #ifdef MAGNUM_TARGET_GL
 #include "Magnum/GL/Version.h"
@@ -106,7 +108,7 @@ Sdl2Application::Modifiers fixedModifiers(Uint16 mod) {
 
 }
 
-enum class Sdl2Application::Flag: UnsignedByte {
+enum class Sdl2Application::Flag: UnsignedShort {
     Redraw = 1 << 0,
     VSyncEnabled = 1 << 1,
     NoTickEvent = 1 << 2,
@@ -117,8 +119,9 @@ enum class Sdl2Application::Flag: UnsignedByte {
     Resizable = 1 << 6,
     #endif
     #ifdef CORRADE_TARGET_APPLE
-    HiDpiWarningPrinted = 1 << 7
+    HiDpiWarningPrinted = 1 << 7,
     #endif
+    EventCoalescing = 1 << 8
 };
 
 Containers::StringView Sdl2Application::keyName(const Key key) {
@@ -857,6 +860,15 @@ void Sdl2Application::swapBuffers() {
     #else
     SDL_Flip(_surface);
     #endif
+
+    const Long now = Implementation::framePacingNow();
+    if(_lastSwapNanoseconds)
+        _presentIntervalNanoseconds = now - _lastSwapNanoseconds;
+    _lastSwapNanoseconds = now;
+}
+
+Nanoseconds Sdl2Application::presentInterval() const {
+    return _presentIntervalNanoseconds*1_nsec;
 }
 
 Int Sdl2Application::swapInterval() const {
@@ -865,6 +877,13 @@ Int Sdl2Application::swapInterval() const {
 
 bool Sdl2Application::setSwapInterval(const Int interval) {
     if(SDL_GL_SetSwapInterval(interval) == -1) {
+        /* Adaptive VSync is an extension that's not supported everywhere,
+           fall back to the regular one in that case */
+        if(interval < 0) {
+            Warning() << "Platform::Sdl2Application::setSwapInterval(): adaptive swap interval not supported, falling back to" << -interval;
+            return setSwapInterval(-interval);
+        }
+
         Error() << "Platform::Sdl2Application::setSwapInterval(): cannot set swap interval:" << SDL_GetError();
         _flags &= ~Flag::VSyncEnabled;
         return false;
@@ -896,6 +915,18 @@ void Sdl2Application::setMinimalLoopPeriod(const UnsignedInt milliseconds) {
     _minimalLoopPeriodMilliseconds = milliseconds;
 }
 #endif
+
+Nanoseconds Sdl2Application::targetFramePeriod() const {
+    return _targetFramePeriodNanoseconds*1_nsec;
+}
+
+void Sdl2Application::setTargetFramePeriod(const Nanoseconds period) {
+    CORRADE_ASSERT(period >= 0_nsec,
+        "Platform::Sdl2Application::setTargetFramePeriod(): expected non-negative time, got" << period, );
+    _targetFramePeriodNanoseconds = Long(period);
+    /* Start a new schedule with the next frame */
+    _nextFrameDeadlineNanoseconds = 0;
+}
 #endif
 
 void Sdl2Application::redraw() { _flags |= Flag::Redraw; }
@@ -986,6 +1017,36 @@ Sdl2Application::Pointers buttonsToPointers(const Uint32 buttons) {
 
 }
 
+void Sdl2Application::motionOrScrollEvent(const Containers::ArrayView<const SDL_Event> events) {
+    const SDL_Event& last = events.back();
+
+    if(last.type == SDL_MOUSEWHEEL) {
+        Vector2 offset;
+        for(const SDL_Event& event: events)
+            offset += Vector2{Float(event.wheel.x), Float(event.wheel.y)};
+        ScrollEvent e{last, offset, events};
+        scrollEvent(e);
+        return;
+    }
+
+    CORRADE_INTERNAL_ASSERT(last.type == SDL_MOUSEMOTION);
+    Vector2 relativePosition;
+    for(const SDL_Event& event: events)
+        relativePosition += Vector2{Float(event.motion.xrel), Float(event.motion.yrel)};
+    PointerMoveEvent e{last, PointerEventSource::Mouse, {}, buttonsToPointers(last.motion.state), true,
+        #ifdef CORRADE_TARGET_EMSCRIPTEN
+        0,
+        /* Since 2.0.22, added w/ SDL_HINT_MOUSE_TOUCH_EVENTS */
+        #elif defined(SDL_MOUSE_TOUCHID)
+        SDL_MOUSE_TOUCHID,
+        #else
+        -1,
+        #endif
+        {Float(last.motion.x), Float(last.motion.y)},
+        relativePosition, events};
+    pointerMoveEvent(e);
+}
+
 bool Sdl2Application::mainLoopIteration() {
     /* If exit was requested directly in the constructor, exit immediately
        without calling anything else */
@@ -1029,6 +1090,18 @@ bool Sdl2Application::mainLoopIteration() {
 
     SDL_Event event;
     while(SDL_PollEvent(&event)) {
+        /* If coalescing is enabled, collect consecutive mouse motion or wheel
+           events and dispatch them together once an event of a different
+           type arrives or the queue gets empty */
+        if(!_coalescedEvents.isEmpty() && (_coalescedEvents.back().type != event.type || !(_flags & Flag::EventCoalescing))) {
+            motionOrScrollEvent(_coalescedEvents);
+            arrayResize(_coalescedEvents, NoInit, 0);
+        }
+        if((_flags & Flag::EventCoalescing) && (event.type == SDL_MOUSEMOTION || event.type == SDL_MOUSEWHEEL)) {
+            arrayAppend(_coalescedEvents, event);
+            continue;
+        }
+
         switch(event.type) {
             case SDL_WINDOWEVENT:
                 switch(event.window.event) {
@@ -1094,7 +1167,7 @@ bool Sdl2Application::mainLoopIteration() {
                         #else
                         -1,
                         #endif
-                        position, {}};
+                        position, {}, {&event, 1}};
                     pointerMoveEvent(e);
                 } else {
                     PointerEvent e{event, PointerEventSource::Mouse, pointer, true,
@@ -1116,25 +1189,10 @@ bool Sdl2Application::mainLoopIteration() {
                 }
             } break;
 
-            case SDL_MOUSEWHEEL: {
-                ScrollEvent e{event, {Float(event.wheel.x), Float(event.wheel.y)}};
-                scrollEvent(e);
-            } break;
-
-            case SDL_MOUSEMOTION: {
-                PointerMoveEvent e{event, PointerEventSource::Mouse, {}, buttonsToPointers(event.motion.state), true,
-                    #ifdef CORRADE_TARGET_EMSCRIPTEN
-                    0,
-                    /* Since 2.0.22, added w/ SDL_HINT_MOUSE_TOUCH_EVENTS */
-                    #elif defined(SDL_MOUSE_TOUCHID)
-                    SDL_MOUSE_TOUCHID,
-                    #else
-                    -1,
-                    #endif
-                    {Float(event.motion.x), Float(event.motion.y)},
-                    {Float(event.motion.xrel), Float(event.motion.yrel)}};
-                pointerMoveEvent(e);
-            } break;
+            case SDL_MOUSEWHEEL:
+            case SDL_MOUSEMOTION:
+                motionOrScrollEvent({&event, 1});
+                break;
 
             #ifndef CORRADE_TARGET_EMSCRIPTEN
             case SDL_FINGERDOWN:
@@ -1206,7 +1264,8 @@ bool Sdl2Application::mainLoopIteration() {
                 PointerMoveEvent e{event, PointerEventSource::Touch, {},
                     Pointer::Finger, primary, event.tfinger.fingerId,
                     Vector2{event.tfinger.x, event.tfinger.y}*scale,
-                    Vector2{event.tfinger.dx, event.tfinger.dy}*scale};
+                    Vector2{event.tfinger.dx, event.tfinger.dy}*scale,
+                    {&event, 1}};
                 pointerMoveEvent(e);
                 break;
             }
@@ -1252,6 +1311,12 @@ bool Sdl2Application::mainLoopIteration() {
         }
     }
 
+    /* Dispatch the remaining coalesced events, if any */
+    if(!_coalescedEvents.isEmpty()) {
+        motionOrScrollEvent(_coalescedEvents);
+        arrayResize(_coalescedEvents, NoInit, 0);
+    }
+
     /* Tick event */
     if(!(_flags & Flag::NoTickEvent)) tickEvent();
 
@@ -1261,8 +1326,13 @@ bool Sdl2Application::mainLoopIteration() {
         drawEvent();
 
         #ifndef CORRADE_TARGET_EMSCRIPTEN
+        /* If frame pacing is enabled, wait until the next frame is due. This
+           supersedes the minimal loop period. */
+        if(_targetFramePeriodNanoseconds)
+            _nextFrameDeadlineNanoseconds = Implementation::framePacingWait(_nextFrameDeadlineNanoseconds, _targetFramePeriodNanoseconds);
+
         /* If VSync is not enabled, delay to prevent CPU hogging (if set) */
-        if(!(_flags & Flag::VSyncEnabled) && _minimalLoopPeriodMilliseconds) {
+        else if(!(_flags & Flag::VSyncEnabled) && _minimalLoopPeriodMilliseconds) {
             const Nanoseconds loopTime = SDL_GetTicks()*1.0_msec - timeBefore;
             if(loopTime < _minimalLoopPeriodMilliseconds*1.0_msec)
                 SDL_Delay(_minimalLoopPeriodMilliseconds - loopTime/1.0_msec);
@@ -1393,6 +1463,15 @@ void Sdl2Application::setMouseLocked(bool enabled) {
 }
 #endif
 
+bool Sdl2Application::isEventCoalescingEnabled() const {
+    return !!(_flags & Flag::EventCoalescing);
+}
+
+void Sdl2Application::setEventCoalescingEnabled(const bool enabled) {
+    if(enabled) _flags |= Flag::EventCoalescing;
+    else _flags &= ~Flag::EventCoalescing;
+}
+
 bool Sdl2Application::isTextInputActive() {
     #ifndef CORRADE_TARGET_EMSCRIPTEN
     return SDL_IsTextInputActive();
@@ -32,6 +32,7 @@
  * @brief Class @ref Magnum::Platform::Sdl2Application, macro @ref MAGNUM_SDL2APPLICATION_MAIN()
  */
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/EnumSet.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h> /** @todo PIMPL Configuration instead? */
@@ -335,6 +336,28 @@ handling pointer input in a portable way. There's also a
 @ref Platform::TwoFingerGesture helper for recognition of common two-finger
 gestures for zoom, rotation and pan.
 
+@section Platform-Sdl2Application-coalescing Event coalescing
+
+High-frequency input devices such as 1000 Hz gaming mice can generate many
+move events per frame, each of which results in a @ref pointerMoveEvent() call
+and thus potentially expensive hit testing in the application. With
+@ref setEventCoalescingEnabled(), consecutive mouse move events and
+consecutive scroll events arriving within one main loop iteration are merged
+into a single event instead. The merged @ref PointerMoveEvent reports position
+and pressed pointers of the last event in the sequence and a
+@relativeref{PointerMoveEvent,relativePosition()} that's a sum of all merged
+events, similarly @ref ScrollEvent::offset() is a sum of all merged offsets.
+Any other event, such as a button press, ends the sequence, so the relative
+order of events is preserved.
+
+Applications that need the full history, such as drawing tools, can access all
+merged events through @ref PointerMoveEvent::coalescedEvents() and
+@ref ScrollEvent::coalescedEvents():
+
+@snippet Platform.cpp Sdl2Application-coalescing
+
+Touch events aren't coalesced.
+
 @section Platform-Sdl2Application-platform-specific Platform-specific behavior
 
 @subsection Platform-Sdl2Application-platform-specific-power Power management
@@ -1027,10 +1050,25 @@ class Sdl2Application {
          * @brief Swap buffers
          *
          * Paints currently rendered framebuffer on screen.
-         * @see @ref setSwapInterval()
+         * @see @ref setSwapInterval(), @ref presentInterval()
          */
         void swapBuffers();
 
+        /**
+         * @brief Present interval
+         * @m_since_latest
+         *
+         * Time between the two most recent @ref swapBuffers() calls, measured
+         * on the CPU with a monotonic clock right after each swap returns.
+         * With VSync enabled the swap usually blocks until the frame is
+         * presented, making this a good approximation of the
+         * present-to-present time. Returns @cpp 0_nsec @ce until
+         * @ref swapBuffers() was called at least twice. Include
+         * @ref Magnum/Math/Time.h to operate with the returned value.
+         * @see @ref setTargetFramePeriod()
+         */
+        Nanoseconds presentInterval() const;
+
         /** @brief Swap interval */
         Int swapInterval() const;
 
@@ -1038,11 +1076,16 @@ class Sdl2Application {
          * @brief Set swap interval
          *
          * Set @cpp 0 @ce for no VSync, @cpp 1 @ce for enabled VSync. Some
-         * platforms support @cpp -1 @ce for late swap tearing. Prints error
-         * message and returns @cpp false @ce if swap interval cannot be set,
-         * @cpp true @ce otherwise. Default is driver-dependent, you can query
-         * the value with @ref swapInterval().
-         * @see @ref setMinimalLoopPeriod()
+         * platforms support @cpp -1 @ce for adaptive VSync, also called late
+         * swap tearing, which waits for VSync only if the frame was finished
+         * in time and presents it immediately otherwise, avoiding a stutter
+         * down to half the refresh rate. If a negative interval isn't
+         * supported, the function prints a warning and falls back to a
+         * corresponding positive interval. Prints error message and returns
+         * @cpp false @ce if swap interval cannot be set, @cpp true @ce
+         * otherwise. Default is driver-dependent, you can query the value with
+         * @ref swapInterval().
+         * @see @ref setMinimalLoopPeriod(), @ref setTargetFramePeriod()
          */
         bool setSwapInterval(Int interval);
 
@@ -1078,6 +1121,41 @@ class Sdl2Application {
          */
         CORRADE_DEPRECATED("use setMinimalLoopPeriod(Nanoseconds) instead") void setMinimalLoopPeriod(UnsignedInt milliseconds);
         #endif
+
+        /**
+         * @brief Target frame period
+         * @m_since_latest
+         *
+         * @note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten",
+         *      the browser is managing the frequency instead.
+         */
+        Nanoseconds targetFramePeriod() const;
+
+        /**
+         * @brief Set target frame period
+         * @m_since_latest
+         *
+         * If non-zero, every @ref drawEvent() is followed by a wait until the
+         * next frame is due, so frames are delivered at a consistent rate of
+         * one per @p period. The schedule is kept on a fixed grid to not
+         * accumulate drift, and if the application falls behind by a whole
+         * period or more, it's restarted instead of catching up with a burst
+         * of frames. The wait sleeps for most of the remaining time and spins
+         * for the last two milliseconds, making it independent of the
+         * millisecond resolution of SDL timers and of the OS scheduler
+         * granularity. As input events are processed right after the wait,
+         * pacing the frames this way also has a lower input latency than
+         * waiting for VSync in @ref swapBuffers().
+         *
+         * Unlike @ref setMinimalLoopPeriod() this is applied also with VSync
+         * enabled, which can be used to cap the frame rate below the display
+         * refresh rate. The @p period is expected to be non-negative, default
+         * is @cpp 0_nsec @ce (i.e., no pacing). Use @ref presentInterval() to
+         * verify the achieved frame timing.
+         * @note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten",
+         *      the browser is managing the frequency instead.
+         */
+        void setTargetFramePeriod(Nanoseconds period);
         #endif
 
         /**
@@ -1233,6 +1311,26 @@ class Sdl2Application {
         CORRADE_DEPRECATED("use setCursor() together with Cursor::HiddenLocked instead") void setMouseLocked(bool enabled);
         #endif
 
+        /**
+         * @brief Whether event coalescing is enabled
+         * @m_since_latest
+         *
+         * @see @ref setEventCoalescingEnabled()
+         */
+        bool isEventCoalescingEnabled() const;
+
+        /**
+         * @brief Enable or disable event coalescing
+         * @m_since_latest
+         *
+         * If enabled, consecutive mouse move events and consecutive scroll
+         * events arriving within one main loop iteration are merged into a
+         * single @ref pointerMoveEvent() or @ref scrollEvent() call. See
+         * @ref Platform-Sdl2Application-coalescing for more information.
+         * Disabled by default.
+         */
+        void setEventCoalescingEnabled(bool enabled);
+
     private:
         /**
          * @brief Pointer press event
@@ -1523,10 +1621,14 @@ class Sdl2Application {
         template<class, bool> friend struct Implementation::ApplicationScrollEventMixin;
         #endif
 
-        enum class Flag: UnsignedByte;
+        enum class Flag: UnsignedShort;
         typedef Containers::EnumSet<Flag> Flags;
         CORRADE_ENUMSET_FRIEND_OPERATORS(Flags)
 
+        /* Dispatches a sequence of SDL_MOUSEMOTION or SDL_MOUSEWHEEL events
+           as a single pointer move or scroll event */
+        void motionOrScrollEvent(Containers::ArrayView<const SDL_Event> events);
+
         Vector2 dpiScalingInternal(Implementation::Sdl2DpiScalingPolicy configurationDpiScalingPolicy, const Vector2& configurationDpiScaling) const;
 
         #ifndef CORRADE_TARGET_EMSCRIPTEN
@@ -1546,6 +1648,8 @@ class Sdl2Application {
         Long _primaryFingerId = ~Long{};
         /* Not using Nanoseconds as that would require including Time.h */
         UnsignedInt _minimalLoopPeriodMilliseconds{};
+        Long _targetFramePeriodNanoseconds{};
+        Long _nextFrameDeadlineNanoseconds{};
         #else
         SDL_Surface* _surface{};
         Vector2i _lastKnownCanvasSize;
@@ -1561,6 +1665,13 @@ class Sdl2Application {
         Containers::Optional<Platform::GLContext> _context;
         #endif
 
+        /* Mouse motion or wheel events waiting to be coalesced. Capacity is
+           kept between frames to avoid allocations. */
+        Containers::Array<SDL_Event> _coalescedEvents;
+
+        Long _lastSwapNanoseconds{};
+        Long _presentIntervalNanoseconds{};
+
         Flags _flags;
 
         int _exitCode = 0;
@@ -3245,6 +3356,20 @@ class Sdl2Application::PointerMoveEvent: public InputEvent {
          */
         Vector2 relativePosition() const { return _relativePosition; }
 
+        /**
+         * @brief Coalesced events
+         * @m_since_latest
+         *
+         * If @ref setEventCoalescingEnabled() is enabled, contains all
+         * `SDL_MouseMotionEvent`s merged into this event, in the order they
+         * arrived. The last item is the same as @ref event(). If coalescing
+         * is disabled or this is a touch event, contains just @ref event().
+         * See @ref Platform-Sdl2Application-coalescing for more information.
+         */
+        Containers::ArrayView<const SDL_Event> coalescedEvents() const {
+            return _coalescedEvents;
+        }
+
         /**
          * @brief Keyboard modifiers
          *
@@ -3255,7 +3380,7 @@ class Sdl2Application::PointerMoveEvent: public InputEvent {
     private:
         friend Sdl2Application;
 
-        explicit PointerMoveEvent(const SDL_Event& event, PointerEventSource source, Containers::Optional<Pointer> pointer, Pointers pointers, bool primary, Long id, const Vector2& position, const Vector2& relativePosition): InputEvent{event}, _source{source}, _pointer{pointer}, _pointers{pointers}, _primary{primary}, _id{id}, _position{position}, _relativePosition{relativePosition} {}
+        explicit PointerMoveEvent(const SDL_Event& event, PointerEventSource source, Containers::Optional<Pointer> pointer, Pointers pointers, bool primary, Long id, const Vector2& position, const Vector2& relativePosition, Containers::ArrayView<const SDL_Event> coalescedEvents): InputEvent{event}, _source{source}, _pointer{pointer}, _pointers{pointers}, _primary{primary}, _id{id}, _position{position}, _relativePosition{relativePosition}, _coalescedEvents{coalescedEvents} {}
 
         const PointerEventSource _source;
         const Containers::Optional<Pointer> _pointer;
@@ -3264,6 +3389,7 @@ class Sdl2Application::PointerMoveEvent: public InputEvent {
         Containers::Optional<Sdl2Application::Modifiers> _modifiers;
         const Long _id;
         const Vector2 _position, _relativePosition;
+        const Containers::ArrayView<const SDL_Event> _coalescedEvents;
 };
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -3356,6 +3482,20 @@ class Sdl2Application::ScrollEvent: public Sdl2Application::InputEvent {
          */
         Vector2 position();
 
+        /**
+         * @brief Coalesced events
+         * @m_since_latest
+         *
+         * If @ref setEventCoalescingEnabled() is enabled, contains all
+         * `SDL_MouseWheelEvent`s merged into this event, in the order they
+         * arrived. The last item is the same as @ref event(). If coalescing
+         * is disabled, contains just @ref event(). See
+         * @ref Platform-Sdl2Application-coalescing for more information.
+         */
+        Containers::ArrayView<const SDL_Event> coalescedEvents() const {
+            return _coalescedEvents;
+        }
+
         /**
          * @brief Keyboard modifiers
          *
@@ -3366,9 +3506,10 @@ class Sdl2Application::ScrollEvent: public Sdl2Application::InputEvent {
     private:
         friend Sdl2Application;
 
-        explicit ScrollEvent(const SDL_Event& event, const Vector2& offset): InputEvent{event}, _offset{offset} {}
+        explicit ScrollEvent(const SDL_Event& event, const Vector2& offset, Containers::ArrayView<const SDL_Event> coalescedEvents): InputEvent{event}, _offset{offset}, _coalescedEvents{coalescedEvents} {}
 
         const Vector2 _offset;
+        const Containers::ArrayView<const SDL_Event> _coalescedEvents;
         Containers::Optional<Vector2> _position;
         Containers::Optional<Sdl2Application::Modifiers> _modifiers;
 };
@@ -0,0 +1,262 @@
+#ifndef Magnum_Platform_SharedGLContextThread_h
+#define Magnum_Platform_SharedGLContextThread_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::Platform::SharedGLContextThread
+ * @m_since_latest
+ */
+#endif
+
+#include "Magnum/configure.h"
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_WEBGL)
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/Platform/GLContext.h"
+
+namespace Magnum { namespace Platform {
+
+/**
+@brief Worker thread with a GL context shared with the current one
+@m_since_latest
+
+Creates a windowless context of type @p WindowlessContext that shares
+objects with the context current on the constructing thread, and runs a
+worker thread with the context current and a @ref GLContext created on it.
+Jobs submitted via @ref submit() are then executed on the worker, which is
+useful for moving texture and mesh uploads off the render thread.
+
+The shared context is set up using
+@relativeref{WindowlessEglContext,Configuration::shareWithCurrentContext()},
+which is provided by @ref WindowlessEglContext, @ref WindowlessGlxContext,
+@ref WindowlessWglContext and @ref WindowlessCglContext, so this works with
+any of the windowless applications and also with windowed applications such
+as @ref Sdl2Application or @ref GlfwApplication, as long as the windowless
+context uses the same underlying API as the application --- GLX or EGL on
+Linux depending on how the toolkit was built, WGL on Windows and CGL on macOS.
+If just one windowless application header is included, the
+@cpp Platform::WindowlessGLContext @ce typedef can be used to pick the
+matching one:
+
+@snippet Platform-windowless-thread.cpp SharedGLContextThread
+
+After each job, @ref GL::Renderer::finish() is called on the worker, so once
+@ref wait() returns, all objects modified by the jobs are complete and can be
+used by the render thread after they're bound again. OpenGL objects that
+contain references to other objects, such as @ref GL::Mesh vertex array
+objects or @ref GL::Framebuffer, aren't shared among contexts, so only
+buffers and textures should be created on the worker. See also
+@ref GL-Context-multithreading.
+
+@note This class is header-only and requires the application to link to
+    a threading library, for example `Threads::Threads` in CMake. It's
+    available only if Magnum is compiled with @ref MAGNUM_TARGET_GL enabled
+    and is not available on @ref MAGNUM_TARGET_WEBGL "WebGL", as context
+    sharing isn't possible there. See @ref building-features for more
+    information.
+*/
+template<class WindowlessContext> class SharedGLContextThread {
+    public:
+        /**
+         * @brief Job function
+         *
+         * Receives the state pointer passed to @ref submit().
+         */
+        typedef void(*Job)(void*);
+
+        /**
+         * @brief Constructor
+         * @param configuration     Context configuration. The shared context
+         *      is replaced with the context current on the calling thread.
+         *
+         * Creates the shared context on the calling thread and then blocks
+         * until the worker makes it current and creates a @ref GLContext on
+         * it. Use @ref isCreated() to check whether it succeeded.
+         */
+        explicit SharedGLContextThread(typename WindowlessContext::Configuration configuration = typename WindowlessContext::Configuration{});
+
+        /** @brief Copying is not allowed */
+        SharedGLContextThread(const SharedGLContextThread<WindowlessContext>&) = delete;
+
+        /** @brief Moving is not allowed */
+        SharedGLContextThread(SharedGLContextThread<WindowlessContext>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for all submitted jobs to finish, destroys the
+         * @ref GLContext on the worker, joins it and then destroys the
+         * shared context.
+         */
+        ~SharedGLContextThread();
+
+        /** @brief Copying is not allowed */
+        SharedGLContextThread<WindowlessContext>& operator=(const SharedGLContextThread<WindowlessContext>&) = delete;
+
+        /** @brief Moving is not allowed */
+        SharedGLContextThread<WindowlessContext>& operator=(SharedGLContextThread<WindowlessContext>&&) = delete;
+
+        /** @brief Whether the shared context was successfully created */
+        bool isCreated() const { return _created; }
+
+        /**
+         * @brief Submit a job
+         *
+         * Jobs are executed in the order they were submitted. Expects that
+         * @ref isCreated() is @cpp true @ce and @p job is not
+         * @cpp nullptr @ce.
+         */
+        void submit(Job job, void* state);
+
+        /** @brief Count of jobs that are queued or currently executing */
+        std::size_t pendingCount() const;
+
+        /**
+         * @brief Wait for all submitted jobs to finish
+         *
+         * Once this function returns, results of all submitted jobs are
+         * visible to other contexts in the share group.
+         */
+        void wait();
+
+    private:
+        struct Task {
+            Job job;
+            void* state;
+        };
+
+        void run(const GL::Context::Configuration& configuration);
+
+        WindowlessContext _glContext{NoCreate};
+        mutable std::mutex _mutex;
+        std::condition_variable _jobCondition, _doneCondition;
+        std::deque<Task> _queue;
+        std::size_t _running = 0;
+        bool _initialized = false, _created = false, _quit = false;
+        std::thread _thread;
+};
+
+template<class WindowlessContext> SharedGLContextThread<WindowlessContext>::SharedGLContextThread(typename WindowlessContext::Configuration configuration) {
+    /* Context creation is not thread-safe everywhere, so create it here and
+       only make it current on the worker */
+    configuration.shareWithCurrentContext();
+    _glContext = WindowlessContext{configuration};
+
+    _thread = std::thread{&SharedGLContextThread<WindowlessContext>::run, this, configuration};
+
+    std::unique_lock<std::mutex> lock{_mutex};
+    _doneCondition.wait(lock, [this]{ return _initialized; });
+}
+
+template<class WindowlessContext> SharedGLContextThread<WindowlessContext>::~SharedGLContextThread() {
+    {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _quit = true;
+    }
+    /* The worker drains all jobs that are still queued before exiting */
+    _jobCondition.notify_all();
+    _thread.join();
+}
+
+template<class WindowlessContext> void SharedGLContextThread<WindowlessContext>::run(const GL::Context::Configuration& configuration) {
+    GLContext magnumContext{NoCreate};
+    const bool created = _glContext.isCreated() && _glContext.makeCurrent() && magnumContext.tryCreate(configuration);
+
+    {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _initialized = true;
+        _created = created;
+    }
+    _doneCondition.notify_all();
+
+    if(created) for(;;) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            _jobCondition.wait(lock, [this]{ return _quit || !_queue.empty(); });
+            if(_queue.empty()) break;
+
+            task = _queue.front();
+            _queue.pop_front();
+            ++_running;
+        }
+
+        task.job(task.state);
+
+        /* Make the results visible to other contexts in the share group */
+        GL::Renderer::finish();
+
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            --_running;
+            if(!_running && _queue.empty())
+                _doneCondition.notify_all();
+        }
+    }
+
+    /* Release the context so it can be destroyed on the constructing
+       thread */
+    if(_glContext.isCreated()) _glContext.release();
+}
+
+template<class WindowlessContext> void SharedGLContextThread<WindowlessContext>::submit(const Job job, void* const state) {
+    CORRADE_ASSERT(_created,
+        "Platform::SharedGLContextThread::submit(): the context wasn't created", );
+    CORRADE_ASSERT(job,
+        "Platform::SharedGLContextThread::submit(): job is null", );
+    {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _queue.push_back({job, state});
+    }
+    _jobCondition.notify_one();
+}
+
+template<class WindowlessContext> std::size_t SharedGLContextThread<WindowlessContext>::pendingCount() const {
+    std::unique_lock<std::mutex> lock{_mutex};
+    return _queue.size() + _running;
+}
+
+template<class WindowlessContext> void SharedGLContextThread<WindowlessContext>::wait() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _doneCondition.wait(lock, [this]{
+        return _queue.empty() && !_running;
+    });
+}
+
+}}
+#else
+#error this header is available only in the OpenGL build and not on WebGL
+#endif
+
+#endif
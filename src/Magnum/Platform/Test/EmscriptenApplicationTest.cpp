@@ -35,6 +35,8 @@
 #include "Magnum/GL/Mesh.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/ConfigurationValue.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Time.h"
 
 /* The __EMSCRIPTEN_major__ etc macros used to be passed implicitly, version
    3.1.4 moved them to a version header and version 3.1.23 dropped the
@@ -295,11 +297,19 @@ struct EmscriptenApplicationTest: Platform::Application {
     explicit EmscriptenApplicationTest(const Arguments& arguments);
 
     void drawEvent() override {
-        Debug() << "draw event";
+        Debug() << "draw event, damaged region" << damagedRegion();
         #ifdef CUSTOM_CLEAR_COLOR
         GL::Renderer::setClearColor(CUSTOM_CLEAR_COLOR);
         #endif
+        /* For testing partial redraw, alternate the clear color so it's
+           visible which part got redrawn */
+        if(_partialRedraws & 1)
+            GL::Renderer::setClearColor(0x2f83cc_rgbf);
+        GL::Renderer::enable(GL::Renderer::Feature::ScissorTest);
+        GL::Renderer::setScissor(damagedRegion());
         GL::defaultFramebuffer.clear(GL::FramebufferClear::Color);
+        GL::Renderer::disable(GL::Renderer::Feature::ScissorTest);
+        GL::Renderer::setClearColor(0x000000_rgbf);
 
         swapBuffers();
 
@@ -389,6 +399,15 @@ struct EmscriptenApplicationTest: Platform::Application {
         } else if(event.key() == Key::H) {
             Debug{} << "toggling hand cursor";
             setCursor(cursor() == Cursor::Arrow ? Cursor::Hand : Cursor::Arrow);
+        } else if(event.key() == Key::R) {
+            Debug{} << "redrawing a 64x64 region in the bottom left corner";
+            ++_partialRedraws;
+            redraw({{16, 16}, {80, 80}});
+        } else if(event.key() == Key::I) {
+            const bool enabled = idleFramePeriod() == 0_nsec;
+            Debug{} << "idle throttling" << (enabled ? "enabled" : "disabled");
+            setIdleTimeout(2.0_sec);
+            setIdleFramePeriod(enabled ? 500.0_msec : 0_nsec);
         }
 
         event.setAccepted();
@@ -409,6 +428,7 @@ struct EmscriptenApplicationTest: Platform::Application {
     private:
         bool _fullscreen = false;
         bool _redraw = false;
+        UnsignedInt _partialRedraws = 0;
 };
 
 EmscriptenApplicationTest::EmscriptenApplicationTest(const Arguments& arguments): Platform::Application{arguments, NoCreate} {
@@ -417,6 +437,7 @@ EmscriptenApplicationTest::EmscriptenApplicationTest(const Arguments& arguments)
         .addSkippedPrefix("magnum", "engine-specific options")
         .addBooleanOption("exit-immediately").setHelp("exit-immediately", "exit the application immediately from the constructor, to test that the app doesn't run any event handlers after")
         .addBooleanOption("quiet").setHelp("quiet", "like --magnum-log quiet, but specified via a Context::Configuration instead")
+        .addBooleanOption("preserve-drawing-buffer").setHelp("preserve-drawing-buffer", "preserve the drawing buffer, to test partial redraw")
         .parse(arguments.argc, arguments.argv);
 
     /* Useful for bisecting Emscripten regressions, because they happen WAY TOO
@@ -438,6 +459,8 @@ EmscriptenApplicationTest::EmscriptenApplicationTest(const Arguments& arguments)
     GLConfiguration glConf;
     if(args.isSet("quiet"))
         glConf.addFlags(GLConfiguration::Flag::QuietLog);
+    if(args.isSet("preserve-drawing-buffer"))
+        glConf.addFlags(GLConfiguration::Flag::PreserveDrawingBuffer);
     /* No GL-specific verbose log in EmscriptenApplication that we'd need to
        handle explicitly */
     /* No GPU validation on WebGL */
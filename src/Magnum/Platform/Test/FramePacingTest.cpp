@@ -0,0 +1,109 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Platform/Implementation/FramePacing.h"
+
+namespace Magnum { namespace Platform { namespace Test { namespace {
+
+struct FramePacingTest: TestSuite::Tester {
+    explicit FramePacingTest();
+
+    void nextDeadlineFirst();
+    void nextDeadlineOnTime();
+    void nextDeadlineLate();
+    void nextDeadlineBehind();
+
+    void wait();
+    void waitLate();
+};
+
+FramePacingTest::FramePacingTest() {
+    addTests({&FramePacingTest::nextDeadlineFirst,
+              &FramePacingTest::nextDeadlineOnTime,
+              &FramePacingTest::nextDeadlineLate,
+              &FramePacingTest::nextDeadlineBehind,
+
+              &FramePacingTest::wait,
+              &FramePacingTest::waitLate});
+}
+
+void FramePacingTest::nextDeadlineFirst() {
+    /* With no previous deadline the schedule starts from now */
+    CORRADE_COMPARE(Implementation::framePacingNextDeadline(1000, 0, 16), 1016);
+}
+
+void FramePacingTest::nextDeadlineOnTime() {
+    /* Woken up exactly at or slightly after the deadline, the next one is
+       on the same grid so the jitter doesn't accumulate */
+    CORRADE_COMPARE(Implementation::framePacingNextDeadline(1000, 1000, 16), 1016);
+    CORRADE_COMPARE(Implementation::framePacingNextDeadline(1003, 1000, 16), 1016);
+}
+
+void FramePacingTest::nextDeadlineLate() {
+    /* Late by less than a period, still catching up on the same grid */
+    CORRADE_COMPARE(Implementation::framePacingNextDeadline(1015, 1000, 16), 1016);
+}
+
+void FramePacingTest::nextDeadlineBehind() {
+    /* Late by a whole period or more, the schedule restarts from now instead
+       of producing a burst of frames */
+    CORRADE_COMPARE(Implementation::framePacingNextDeadline(1016, 1000, 16), 1032);
+    CORRADE_COMPARE(Implementation::framePacingNextDeadline(5000, 1000, 16), 5016);
+}
+
+void FramePacingTest::wait() {
+    /* 5 ms, which is enough to exercise both the sleep and the spin */
+    const Long period = 5000000;
+    const Long start = Implementation::framePacingNow();
+    const Long deadline = start + period;
+
+    const Long next = Implementation::framePacingWait(deadline, period);
+    const Long end = Implementation::framePacingNow();
+
+    /* It should never wake up early. The upper bound isn't checked as it
+       depends on the system load. */
+    CORRADE_COMPARE_AS(end, deadline,
+        TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE_AS(next, deadline + period,
+        TestSuite::Compare::GreaterOrEqual);
+}
+
+void FramePacingTest::waitLate() {
+    /* A deadline in the past doesn't wait at all and restarts the schedule */
+    const Long period = 5000000;
+    const Long start = Implementation::framePacingNow();
+
+    const Long next = Implementation::framePacingWait(start - 3*period, period);
+    CORRADE_COMPARE_AS(next, start + period,
+        TestSuite::Compare::GreaterOrEqual);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Platform::Test::FramePacingTest)
@@ -293,6 +293,7 @@ struct GlfwApplicationTest: Platform::Application {
     void drawEvent() override {
         Debug{} << "draw";
         swapBuffers();
+        Debug{} << "present interval:" << Seconds{presentInterval()};
 
         if(_redraw)
             redraw();
@@ -316,6 +317,14 @@ struct GlfwApplicationTest: Platform::Application {
             _vsync = !_vsync;
             Debug{} << "vsync" << (_vsync? "on" : "off");
             setSwapInterval(_vsync ? 1 : 0);
+        } else if(event.key() == Key::A) {
+            Debug{} << "adaptive vsync";
+            _vsync = true;
+            setSwapInterval(-1);
+        } else if(event.key() == Key::P) {
+            _paced = !_paced;
+            Debug{} << "frame pacing" << (_paced ? "at 30 FPS" : "off");
+            setTargetFramePeriod(_paced ? 1.0_sec/30 : 0_nsec);
         } else if(event.key() == Key::Esc) {
             Debug{} << "stopping text input";
             stopTextInput();
@@ -396,6 +405,7 @@ struct GlfwApplicationTest: Platform::Application {
     private:
         bool _redraw = false;
         bool _vsync = false;
+        bool _paced = false;
 };
 
 GlfwApplicationTest::GlfwApplicationTest(const Arguments& arguments): Platform::Application{arguments, NoCreate} {
@@ -335,6 +335,7 @@ struct Sdl2ApplicationTest: Platform::Application {
         #endif
 
         swapBuffers();
+        Debug{} << "present interval:" << Seconds{presentInterval()};
 
         if(_redraw)
             redraw();
@@ -349,10 +350,10 @@ struct Sdl2ApplicationTest: Platform::Application {
         Debug{} << "pointer release:" << event.source() << event.pointer() << (event.isPrimary() ? "primary" : "secondary") << event.id() << event.modifiers() << Debug::packed << event.position();
     }
     void pointerMoveEvent(PointerMoveEvent& event) override {
-        Debug{} << "pointer move:" << event.source() << event.pointer() << event.pointers() << (event.isPrimary() ? "primary" : "secondary") << event.id() << event.modifiers() << Debug::packed << event.position() << Debug::packed << event.relativePosition();
+        Debug{} << "pointer move:" << event.source() << event.pointer() << event.pointers() << (event.isPrimary() ? "primary" : "secondary") << event.id() << event.modifiers() << Debug::packed << event.position() << Debug::packed << event.relativePosition() << "coalesced:" << event.coalescedEvents().size();
     }
     void scrollEvent(ScrollEvent& event) override {
-        Debug{} << "scroll:" << event.modifiers() << Debug::packed << event.offset() << Debug::packed << event.position();
+        Debug{} << "scroll:" << event.modifiers() << Debug::packed << event.offset() << Debug::packed << event.position() << "coalesced:" << event.coalescedEvents().size();
     }
     #else
     CORRADE_IGNORE_DEPRECATED_PUSH
@@ -399,9 +400,20 @@ struct Sdl2ApplicationTest: Platform::Application {
             _vsync = !_vsync;
             Debug{} << "vsync" << (_vsync? "on" : "off");
             setSwapInterval(_vsync ? 1 : 0);
+        } else if(event.key() == Key::A) {
+            Debug{} << "adaptive vsync";
+            _vsync = true;
+            setSwapInterval(-1);
+        } else if(event.key() == Key::P) {
+            _paced = !_paced;
+            Debug{} << "frame pacing" << (_paced ? "at 30 FPS" : "off");
+            setTargetFramePeriod(_paced ? 1.0_sec/30 : 0_nsec);
         }
         #endif
-        else if(event.key() == Key::Esc) {
+        else if(event.key() == Key::C) {
+            setEventCoalescingEnabled(!isEventCoalescingEnabled());
+            Debug{} << "event coalescing" << (isEventCoalescingEnabled() ? "enabled" : "disabled");
+        } else if(event.key() == Key::Esc) {
             Debug{} << "stopping text input";
             stopTextInput();
         } else if(event.key() == Key::T) {
@@ -502,6 +514,7 @@ struct Sdl2ApplicationTest: Platform::Application {
         bool _redraw = false;
         #ifndef CORRADE_TARGET_EMSCRIPTEN
         bool _vsync = false;
+        bool _paced = false;
         #endif
 };
 
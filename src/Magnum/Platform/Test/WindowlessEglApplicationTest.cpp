@@ -26,6 +26,8 @@
 
 #include <Corrade/Utility/Arguments.h>
 
+#include "Magnum/GL/Context.h"
+
 #include "Magnum/Platform/WindowlessEglApplication.h"
 
 namespace Magnum { namespace Platform { namespace Test { namespace {
@@ -41,6 +43,9 @@ WindowlessEglApplicationTest::WindowlessEglApplicationTest(const Arguments& argu
         .addBooleanOption("quiet").setHelp("quiet", "like --magnum-log quiet, but specified via a Context::Configuration instead")
         .addBooleanOption("verbose").setHelp("verbose", "like --magnum-log verbose, but specified via a Context::Configuration instead")
         .addBooleanOption("gpu-validation").setHelp("gpu-validation", "like --magnum-gpu-validation, but specified via a Context::Configuration instead")
+        #ifndef MAGNUM_TARGET_WEBGL
+        .addBooleanOption("pool").setHelp("pool", "additionally create a context pool on all EGL devices and run a job on each")
+        #endif
         .parse(arguments.argc, arguments.argv);
 
     Configuration conf;
@@ -56,6 +61,16 @@ WindowlessEglApplicationTest::WindowlessEglApplicationTest(const Arguments& argu
 
     #ifndef MAGNUM_TARGET_WEBGL
     Debug{} << "GL context flags:" << GL::Context::current().flags();
+
+    if(args.isSet("pool")) {
+        Platform::WindowlessEglContextPool pool{conf};
+        Debug{} << "Context pool with" << pool.contextCount() << "contexts out of" << Platform::WindowlessEglContextPool::deviceCount() << "EGL devices";
+        for(UnsignedInt device: pool.devices())
+            pool.submit(device, [](UnsignedInt device, void*) {
+                Debug{} << "Device" << device << "renderer:" << GL::Context::current().rendererString();
+            }, nullptr);
+        pool.wait();
+    }
     #endif
 }
 
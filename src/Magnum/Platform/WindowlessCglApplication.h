@@ -269,6 +269,21 @@ class WindowlessCglContext::Configuration: public GL::Context::Configuration {
             return *this;
         }
 
+        /**
+         * @brief Create a context shared with the current one
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref setSharedContext() with
+         * @cpp CGLGetCurrentContext() @ce, i.e. sharing with whatever CGL
+         * context is current on the calling thread, including contexts
+         * created by windowed applications. If no CGL context is current,
+         * this results in no sharing. See also @ref SharedGLContextThread.
+         */
+        Configuration& shareWithCurrentContext() {
+            return setSharedContext(CGLGetCurrentContext());
+        }
+
         /**
          * @brief Shared context
          * @m_since{2020,06}
@@ -33,6 +33,14 @@
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 #include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Macros.h> /* CORRADE_THREAD_LOCAL */
+
+#ifndef MAGNUM_TARGET_WEBGL
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
 
 #include "Magnum/GL/Version.h"
 
@@ -746,6 +754,231 @@ auto WindowlessEglContext::Configuration::setSharedContext(EGLDisplay display, E
 }
 #endif
 
+#ifndef MAGNUM_TARGET_WEBGL
+namespace {
+
+CORRADE_THREAD_LOCAL Int currentPoolDevice = -1;
+
+}
+
+struct WindowlessEglContextPool::State {
+    struct Task {
+        Job job;
+        void* state;
+        /* -1 if it can be executed on any device */
+        Int device;
+    };
+
+    void worker(std::size_t slot, const GL::Context::Configuration& configuration);
+
+    /* Mutable so pendingCount() can be const */
+    mutable std::mutex mutex;
+    std::condition_variable jobCondition, doneCondition;
+    std::deque<Task> queue;
+    std::size_t running = 0;
+    std::size_t initialized = 0;
+    bool quit = false;
+
+    /* EGL context for every device, and whether the Magnum context got
+       created on it by the worker. The successfully created ones are then
+       compacted to devices. */
+    Containers::Array<WindowlessEglContext> glContexts;
+    Containers::Array<bool> slotCreated;
+    Containers::Array<UnsignedInt> devices;
+
+    /* Joined explicitly in the pool destructor, before any of the above
+       gets destroyed */
+    Containers::Array<std::thread> threads;
+};
+
+void WindowlessEglContextPool::State::worker(const std::size_t slot, const GL::Context::Configuration& configuration) {
+    const UnsignedInt device = slot;
+
+    /* The EGL context is created on the main thread, but the Magnum context
+       lives on this thread for the whole lifetime of the pool, which makes
+       GL::Context::current() on this thread point to it */
+    WindowlessEglContext& glContext = glContexts[slot];
+    GLContext magnumContext{NoCreate};
+    const bool created = glContext.isCreated() && glContext.makeCurrent() && magnumContext.tryCreate(configuration);
+    if(!created)
+        Error{} << "Platform::WindowlessEglContextPool: cannot create a context on EGL device" << device << Debug::nospace << ", skipping";
+
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        slotCreated[slot] = created;
+        ++initialized;
+    }
+    doneCondition.notify_all();
+    if(!created) {
+        if(glContext.isCreated()) glContext.release();
+        return;
+    }
+
+    currentPoolDevice = device;
+    for(;;) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            std::deque<Task>::iterator found;
+            jobCondition.wait(lock, [&]{
+                for(found = queue.begin(); found != queue.end(); ++found)
+                    if(found->device == -1 || UnsignedInt(found->device) == device)
+                        return true;
+                return quit;
+            });
+            if(found == queue.end()) break;
+
+            task = *found;
+            queue.erase(found);
+            ++running;
+        }
+
+        task.job(device, task.state);
+
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            --running;
+            if(!running && queue.empty())
+                doneCondition.notify_all();
+        }
+    }
+    currentPoolDevice = -1;
+
+    /* Release the EGL context so it can be destroyed from the main thread */
+    glContext.release();
+}
+
+UnsignedInt WindowlessEglContextPool::deviceCount() {
+    /* Same extension requirements as for device selection in the
+       WindowlessEglContext constructor. If not satisfied, only the default
+       display is available. */
+    const char* const extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if(!extensions ||
+        !(extensionSupported(extensions, "EGL_EXT_device_enumeration") || extensionSupported(extensions, "EGL_EXT_device_base")) ||
+        !extensionSupported(extensions, "EGL_EXT_platform_base") ||
+        !extensionSupported(extensions, "EGL_EXT_platform_device"))
+        return 1;
+
+    EGLint count;
+    auto eglQueryDevices = reinterpret_cast<EGLBoolean(*)(EGLint, EGLDeviceEXT*, EGLint*)>(eglGetProcAddress("eglQueryDevicesEXT"));
+    if(!eglQueryDevices(0, nullptr, &count)) {
+        Error{} << "Platform::WindowlessEglContextPool::deviceCount(): cannot query EGL devices:" << Implementation::eglErrorString(eglGetError());
+        return 0;
+    }
+
+    return count;
+}
+
+Int WindowlessEglContextPool::currentDevice() {
+    return currentPoolDevice;
+}
+
+WindowlessEglContextPool::WindowlessEglContextPool(const WindowlessEglContext::Configuration& configuration, UnsignedInt count): _state{InPlaceInit} {
+    const UnsignedInt availableCount = deviceCount();
+    if(!count) count = availableCount;
+    CORRADE_ASSERT(count <= availableCount,
+        "Platform::WindowlessEglContextPool: requested" << count << "devices but found only" << availableCount, );
+
+    /* Context creation is not thread-safe everywhere, so create the EGL
+       contexts here and only make them current on the workers */
+    State& state = *_state;
+    state.glContexts = Containers::Array<WindowlessEglContext>{DirectInit, count, NoCreate};
+    for(UnsignedInt i = 0; i != count; ++i) {
+        WindowlessEglContext::Configuration deviceConfiguration{configuration};
+        deviceConfiguration
+            .setDevice(i)
+            .setCudaDevice(~UnsignedInt{});
+        state.glContexts[i] = WindowlessEglContext{deviceConfiguration};
+    }
+
+    state.slotCreated = Containers::Array<bool>{ValueInit, count};
+    state.threads = Containers::Array<std::thread>{count};
+    for(std::size_t i = 0; i != count; ++i)
+        state.threads[i] = std::thread{&State::worker, &state, i, configuration};
+
+    /* Wait until all workers either create their context or fail */
+    {
+        std::unique_lock<std::mutex> lock{state.mutex};
+        state.doneCondition.wait(lock, [&]{
+            return state.initialized == count;
+        });
+    }
+
+    std::size_t createdCount = 0;
+    for(const bool created: state.slotCreated)
+        if(created) ++createdCount;
+    state.devices = Containers::Array<UnsignedInt>{NoInit, createdCount};
+    for(std::size_t i = 0, j = 0; i != count; ++i)
+        if(state.slotCreated[i]) state.devices[j++] = i;
+}
+
+WindowlessEglContextPool::~WindowlessEglContextPool() {
+    {
+        std::unique_lock<std::mutex> lock{_state->mutex};
+        _state->quit = true;
+    }
+    /* Workers drain all jobs that are still queued before exiting */
+    _state->jobCondition.notify_all();
+    for(std::thread& thread: _state->threads)
+        if(thread.joinable()) thread.join();
+}
+
+UnsignedInt WindowlessEglContextPool::contextCount() const {
+    return _state->devices.size();
+}
+
+Containers::ArrayView<const UnsignedInt> WindowlessEglContextPool::devices() const {
+    return _state->devices;
+}
+
+void WindowlessEglContextPool::submit(const Job job, void* const state) {
+    CORRADE_ASSERT(!_state->devices.isEmpty(),
+        "Platform::WindowlessEglContextPool::submit(): no contexts in the pool", );
+    CORRADE_ASSERT(job,
+        "Platform::WindowlessEglContextPool::submit(): job is null", );
+    {
+        std::unique_lock<std::mutex> lock{_state->mutex};
+        _state->queue.push_back({job, state, -1});
+    }
+    _state->jobCondition.notify_one();
+}
+
+void WindowlessEglContextPool::submit(const UnsignedInt device, const Job job, void* const state) {
+    #ifndef CORRADE_NO_ASSERT
+    bool found = false;
+    for(const UnsignedInt i: _state->devices) if(i == device) {
+        found = true;
+        break;
+    }
+    #endif
+    CORRADE_ASSERT(found,
+        "Platform::WindowlessEglContextPool::submit(): no context on EGL device" << device, );
+    CORRADE_ASSERT(job,
+        "Platform::WindowlessEglContextPool::submit(): job is null", );
+    {
+        std::unique_lock<std::mutex> lock{_state->mutex};
+        _state->queue.push_back({job, state, Int(device)});
+    }
+    /* The job can be picked up only by one particular worker, so wake all of
+       them to ensure it isn't the wrong one that gets the notification */
+    _state->jobCondition.notify_all();
+}
+
+std::size_t WindowlessEglContextPool::pendingCount() const {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    return _state->queue.size() + _state->running;
+}
+
+void WindowlessEglContextPool::wait() {
+    CORRADE_ASSERT(currentPoolDevice == -1,
+        "Platform::WindowlessEglContextPool::wait(): can't be called from within a job", );
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    _state->doneCondition.wait(lock, [&]{
+        return _state->queue.empty() && !_state->running;
+    });
+}
+#endif
+
 WindowlessEglApplication::~WindowlessEglApplication() = default;
 
 }}
@@ -50,8 +50,10 @@
 #undef Button3
 #undef Button4
 #undef Button5
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/EnumSet.h>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pointer.h>
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
 /* Unfortunately Xlib *needs* the Bool type, so provide a typedef instead */
@@ -389,6 +391,23 @@ class WindowlessEglContext::Configuration: public GL::Context::Configuration {
          */
         Configuration& setSharedContext(EGLDisplay display, EGLContext context);
 
+        /**
+         * @brief Create a context shared with the current one
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref setSharedContext() with
+         * @cpp eglGetCurrentDisplay() @ce and @cpp eglGetCurrentContext() @ce,
+         * i.e. sharing with whatever EGL context is current on the calling
+         * thread, including contexts created by windowed applications that
+         * use EGL underneath. If no EGL context is current, this results in
+         * no sharing. See also @ref SharedGLContextThread.
+         * @requires_gles Context sharing is not available in WebGL.
+         */
+        Configuration& shareWithCurrentContext() {
+            return setSharedContext(eglGetCurrentDisplay(), eglGetCurrentContext());
+        }
+
         /**
          * @brief Shared display
          * @m_since{2020,06}
@@ -425,6 +444,147 @@ class WindowlessEglContext::Configuration: public GL::Context::Configuration {
 CORRADE_ENUMSET_OPERATORS(WindowlessEglContext::Configuration::Flags)
 #endif
 
+#ifndef MAGNUM_TARGET_WEBGL
+/**
+@brief Pool of windowless EGL contexts across all devices
+@m_since_latest
+
+Creates one @ref WindowlessEglContext for each EGL device in the system and
+a dedicated worker thread for each, on which the context is made current and
+a @ref GLContext is created for the whole lifetime of the pool. Jobs
+submitted via @ref submit() are then distributed among the workers, allowing
+a single process to saturate all GPUs in the machine instead of having to run
+one process per device with @cb{.sh} --magnum-device @ce.
+
+@snippet Platform-windowless-pool.cpp WindowlessEglContextPool
+
+Each job is executed on a thread where @ref GL::Context::current() refers
+to the context of the device the job runs on, so any GL objects it creates
+belong to that device and have to be destroyed within the same job or in
+another job submitted to the same device with @ref submit(UnsignedInt, Job, void*).
+Use @ref currentDevice() to query the device from within a job.
+
+Devices on which the context creation fails are skipped with a message
+printed to the error output and aren't counted in @ref contextCount().
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled and is not available on
+    @ref MAGNUM_TARGET_WEBGL "WebGL". See @ref building-features for more
+    information.
+*/
+class WindowlessEglContextPool {
+    public:
+        /**
+         * @brief Job function
+         *
+         * Receives the EGL device index the job runs on and the state
+         * pointer passed to @ref submit().
+         */
+        typedef void(*Job)(UnsignedInt, void*);
+
+        /**
+         * @brief Count of EGL devices available in the system
+         *
+         * Returns @cpp 1 @ce if device enumeration isn't supported by the
+         * EGL implementation, in which case only the default display can be
+         * used, and @cpp 0 @ce if querying the devices failed.
+         */
+        static UnsignedInt deviceCount();
+
+        /**
+         * @brief Device the calling thread renders on
+         *
+         * Returns the EGL device index if called from a job executed by any
+         * pool, @cpp -1 @ce otherwise.
+         */
+        static Int currentDevice();
+
+        /**
+         * @brief Constructor
+         * @param configuration     Context configuration. The
+         *      @ref WindowlessEglContext::Configuration::setDevice() "device"
+         *      and @ref WindowlessEglContext::Configuration::setCudaDevice() "CUDA device"
+         *      values are ignored and replaced with each device in turn.
+         * @param count             Count of devices to use. If @cpp 0 @ce,
+         *      all devices reported by @ref deviceCount() are used, otherwise
+         *      only the first @p count.
+         *
+         * Blocks until contexts on all workers are created or failed to be
+         * created.
+         */
+        explicit WindowlessEglContextPool(const WindowlessEglContext::Configuration& configuration = WindowlessEglContext::Configuration{}, UnsignedInt count = 0);
+
+        /** @brief Copying is not allowed */
+        WindowlessEglContextPool(const WindowlessEglContextPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        WindowlessEglContextPool(WindowlessEglContextPool&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for all submitted jobs to finish, destroys the
+         * @ref GLContext instances on their worker threads, joins them and
+         * then destroys the EGL contexts.
+         */
+        ~WindowlessEglContextPool();
+
+        /** @brief Copying is not allowed */
+        WindowlessEglContextPool& operator=(const WindowlessEglContextPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        WindowlessEglContextPool& operator=(WindowlessEglContextPool&&) = delete;
+
+        /**
+         * @brief Count of successfully created contexts
+         *
+         * Can be less than the device count passed to the constructor if
+         * context creation failed on some devices.
+         */
+        UnsignedInt contextCount() const;
+
+        /**
+         * @brief Devices the contexts were created on
+         *
+         * Returns EGL device indices corresponding to each of the
+         * @ref contextCount() contexts, in an increasing order.
+         */
+        Containers::ArrayView<const UnsignedInt> devices() const;
+
+        /**
+         * @brief Submit a job to any device
+         *
+         * The job gets executed on the first worker that becomes idle. Jobs
+         * are started in the order they were submitted. Expects that
+         * @ref contextCount() is not zero and @p job is not
+         * @cpp nullptr @ce.
+         */
+        void submit(Job job, void* state);
+
+        /**
+         * @brief Submit a job to a concrete device
+         *
+         * Like @ref submit(Job, void*), but the job is executed only on
+         * @p device, which is expected to be one of @ref devices().
+         */
+        void submit(UnsignedInt device, Job job, void* state);
+
+        /** @brief Count of jobs that are queued or currently executing */
+        std::size_t pendingCount() const;
+
+        /**
+         * @brief Wait for all submitted jobs to finish
+         *
+         * Expects to not be called from within a job.
+         */
+        void wait();
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+#endif
+
 /**
 @brief Windowless EGL application
 
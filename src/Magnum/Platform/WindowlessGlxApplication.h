@@ -323,6 +323,22 @@ class WindowlessGlxContext::Configuration: public GL::Context::Configuration {
             return *this;
         }
 
+        /**
+         * @brief Create a context shared with the current one
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref setSharedContext() with
+         * @cpp glXGetCurrentContext() @ce, i.e. sharing with whatever GLX
+         * context is current on the calling thread, including contexts
+         * created by windowed applications that use GLX underneath. If no GLX
+         * context is current, this results in no sharing. See also
+         * @ref SharedGLContextThread.
+         */
+        Configuration& shareWithCurrentContext() {
+            return setSharedContext(glXGetCurrentContext());
+        }
+
         /**
          * @brief Shared context
          * @m_since{2020,06}
@@ -310,6 +310,21 @@ class WindowlessWglContext::Configuration: public GL::Context::Configuration {
             return *this;
         }
 
+        /**
+         * @brief Create a context shared with the current one
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref setSharedContext() with
+         * @cpp wglGetCurrentContext() @ce, i.e. sharing with whatever WGL
+         * context is current on the calling thread, including contexts
+         * created by windowed applications. If no WGL context is current,
+         * this results in no sharing. See also @ref SharedGLContextThread.
+         */
+        Configuration& shareWithCurrentContext() {
+            return setSharedContext(wglGetCurrentContext());
+        }
+
         /**
          * @brief Shared context
          * @m_since{2020,06}
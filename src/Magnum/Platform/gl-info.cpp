@@ -24,6 +24,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <chrono>
 #include <Corrade/Cpu.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Utility/Arguments.h>
@@ -59,6 +60,7 @@
 #include "Magnum/GL/TextureArray.h"
 #include "Magnum/GL/TransformFeedback.h"
 #endif
+#include "Magnum/Math/Time.h"
 
 #ifdef MAGNUM_TARGET_EGL
 #include "Magnum/Platform/WindowlessEglApplication.h"
@@ -111,7 +113,7 @@ See @ref building, @ref cmake and the @ref GL namespace for more information.
 
 @code{.sh}
 magnum-gl-info [--magnum-...] [-h|--help] [-s|--short] [--extension-strings]
-    [--all-extensions] [--limits]
+    [--all-extensions] [--limits] [--timing]
 @endcode
 
 Arguments:
@@ -122,6 +124,8 @@ Arguments:
     (implies `--short`)
 -   `--all-extensions` --- display extensions also for fully supported versions
 -   `--limits` --- display also limits and implementation-defined values
+-   `--timing` --- display time spent in individual context creation phases,
+    see @ref GL::Context::creationDuration() for details
 -   `--magnum-...` --- engine-specific options (see
     @ref GL-Context-usage-command-line for details)
 
@@ -217,6 +221,7 @@ MagnumInfo::MagnumInfo(const Arguments& arguments): Platform::WindowlessApplicat
         .addBooleanOption("extension-strings").setHelp("extension-strings", "list all extension strings provided by the driver (implies --short)")
         .addBooleanOption("all-extensions").setHelp("all-extensions", "display extensions also for fully supported versions")
         .addBooleanOption("limits").setHelp("limits", "display also limits and implementation-defined values")
+        .addBooleanOption("timing").setHelp("timing", "display time spent in individual context creation phases")
         .addSkippedPrefix("magnum", "engine-specific options")
         .setGlobalHelp("Displays information about Magnum engine and OpenGL capabilities.");
 
@@ -368,7 +373,9 @@ MagnumInfo::MagnumInfo(const Arguments& arguments): Platform::WindowlessApplicat
 
     /* Create context here, so the context creation info is displayed at proper
        place */
+    const std::chrono::steady_clock::time_point creationStart = std::chrono::steady_clock::now();
     createContext();
+    const Long creationTotal = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - creationStart).count();
     GL::Context& c = GL::Context::current();
 
     Debug{} << "";
@@ -381,6 +388,26 @@ MagnumInfo::MagnumInfo(const Arguments& arguments): Platform::WindowlessApplicat
     #endif
     Debug{} << "Detected driver:" << Debug::packed << c.detectedDriver();
 
+    if(args.isSet("timing")) {
+        /* The remainder is spent in the platform-specific code creating the
+           GL context itself */
+        Long magnumTotal = 0;
+        Debug{} << "Context creation timing:";
+        for(const GL::Context::CreationPhase phase: {
+            GL::Context::CreationPhase::FunctionLoading,
+            GL::Context::CreationPhase::ExtensionDetection,
+            GL::Context::CreationPhase::DriverWorkarounds,
+            GL::Context::CreationPhase::StateInitialization,
+            GL::Context::CreationPhase::Finalization
+        }) {
+            const Long duration = Long(c.creationDuration(phase));
+            magnumTotal += duration;
+            Debug{} << "   " << Debug::packed << phase << Debug::nospace << ":" << duration/1.0e6 << "ms";
+        }
+        Debug{} << "    platform context creation:" << (creationTotal - magnumTotal)/1.0e6 << "ms";
+        Debug{} << "    total:" << creationTotal/1.0e6 << "ms";
+    }
+
     Debug{} << "Supported GLSL versions:";
     Debug{} << "   " << ", "_s.joinWithoutEmptyParts(c.shadingLanguageVersionStrings());
 
@@ -29,6 +29,7 @@
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Color.h"
 #include "Magnum/Mesh.h"
+#include "Magnum/Primitives/Static.h"
 #include "Magnum/Trade/MeshData.h"
 
 namespace Magnum { namespace Primitives {
@@ -116,38 +117,60 @@ Trade::MeshData circle2DWireframe(const UnsignedInt segments) {
         Trade::meshAttributeDataNonOwningArray(AttributeData2D), UnsignedInt(positions.size())};
 }
 
-Trade::MeshData circle3DSolid(const UnsignedInt segments, const Circle3DFlags flags) {
-    CORRADE_ASSERT(segments >= 3, "Primitives::circle3DSolid(): segments must be >= 3",
-        (Trade::MeshData{MeshPrimitive::TriangleFan, 0}));
+UnsignedInt circle3DSolidVertexCount(const UnsignedInt segments) {
+    return segments + 2;
+}
 
-    /* Calculate attribute count and vertex size */
-    std::size_t stride = sizeof(Vector3) + sizeof(Vector3);
-    std::size_t attributeCount = 2;
-    if(flags & Circle3DFlag::Tangents) {
-        stride += sizeof(Vector4);
-        ++attributeCount;
-    }
-    if(flags & Circle3DFlag::TextureCoordinates) {
-        stride += sizeof(Vector2);
-        ++attributeCount;
+void circle3DSolidInto(const UnsignedInt segments, const Containers::StridedArrayView1D<Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Containers::StridedArrayView1D<Vector4>& tangents, const Containers::StridedArrayView1D<Vector2>& textureCoordinates) {
+    CORRADE_ASSERT(segments >= 3, "Primitives::circle3DSolidInto(): segments must be >= 3", );
+    const std::size_t vertexCount = circle3DSolidVertexCount(segments);
+    CORRADE_ASSERT(positions.size() == vertexCount && normals.size() == vertexCount,
+        "Primitives::circle3DSolidInto(): expected" << vertexCount << "positions and normals but got" << positions.size() << "and" << normals.size(), );
+    CORRADE_ASSERT(tangents.isEmpty() || tangents.size() == vertexCount,
+        "Primitives::circle3DSolidInto(): expected" << vertexCount << "tangents but got" << tangents.size(), );
+    CORRADE_ASSERT(textureCoordinates.isEmpty() || textureCoordinates.size() == vertexCount,
+        "Primitives::circle3DSolidInto(): expected" << vertexCount << "texture coordinates but got" << textureCoordinates.size(), );
+
+    /* First is center, the first/last point on the edge is twice to close the
+       circle properly. */
+    positions[0] = {};
+    const Rad angleIncrement(Constants::tau()/segments);
+    for(UnsignedInt i = 1; i != vertexCount; ++i) {
+        const Rad angle(Float(i - 1)*angleIncrement);
+        const Containers::Pair<Float, Float> sincos = Math::sincos(angle);
+        positions[i] = {sincos.second(), sincos.first(), 0.0f};
     }
 
+    /* Normals and tangents are the same for all */
+    for(Vector3& i: normals) i = Vector3::zAxis(1.0f);
+    for(Vector4& i: tangents) i = {1.0f, 0.0f, 0.0f, 1.0f};
+
+    for(std::size_t i = 0; i != textureCoordinates.size(); ++i)
+        textureCoordinates[i] = positions[i].xy()*0.5f + Vector2{0.5f};
+}
+
+namespace Implementation {
+
+void circle3DSolidInterleavedInto(const UnsignedInt segments, const Circle3DFlags flags, const Containers::ArrayView<char> vertexData, const Containers::ArrayView<Trade::MeshAttributeData> attributeData) {
+    const std::size_t vertexCount = circle3DSolidVertexCount(segments);
+    const std::size_t stride = circle3DSolidVertexSize(flags)*sizeof(Float);
+    CORRADE_INTERNAL_ASSERT(vertexData.size() == vertexCount*stride);
+    CORRADE_INTERNAL_ASSERT(attributeData.size() == circle3DSolidAttributeCount(flags));
+
     /* Set up the layout */
-    Containers::Array<char> vertexData{NoInit, (segments + 2)*stride};
-    Containers::Array<Trade::MeshAttributeData> attributeData{attributeCount};
     std::size_t attributeIndex = 0;
     std::size_t attributeOffset = 0;
 
     Containers::StridedArrayView1D<Vector3> positions{vertexData,
         reinterpret_cast<Vector3*>(vertexData.data() + attributeOffset),
-        segments + 2, std::ptrdiff_t(stride)};
+        vertexCount, std::ptrdiff_t(stride)};
     attributeData[attributeIndex++] = Trade::MeshAttributeData{
         Trade::MeshAttribute::Position, positions};
     attributeOffset += sizeof(Vector3);
 
     Containers::StridedArrayView1D<Vector3> normals{vertexData,
         reinterpret_cast<Vector3*>(vertexData.data() + attributeOffset),
-        segments + 2, std::ptrdiff_t(stride)};
+        vertexCount, std::ptrdiff_t(stride)};
     attributeData[attributeIndex++] = Trade::MeshAttributeData{
         Trade::MeshAttribute::Normal, normals};
     attributeOffset += sizeof(Vector3);
@@ -156,7 +179,7 @@ Trade::MeshData circle3DSolid(const UnsignedInt segments, const Circle3DFlags fl
     if(flags & Circle3DFlag::Tangents) {
         tangents = Containers::StridedArrayView1D<Vector4>{vertexData,
             reinterpret_cast<Vector4*>(vertexData.data() + attributeOffset),
-            segments + 2, std::ptrdiff_t(stride)};
+            vertexCount, std::ptrdiff_t(stride)};
         attributeData[attributeIndex++] = Trade::MeshAttributeData{
             Trade::MeshAttribute::Tangent, tangents};
         attributeOffset += sizeof(Vector4);
@@ -166,35 +189,27 @@ Trade::MeshData circle3DSolid(const UnsignedInt segments, const Circle3DFlags fl
     if(flags & Circle3DFlag::TextureCoordinates) {
         textureCoordinates = Containers::StridedArrayView1D<Vector2>{vertexData,
             reinterpret_cast<Vector2*>(vertexData.data() + attributeOffset),
-            segments + 2, std::ptrdiff_t(stride)};
+            vertexCount, std::ptrdiff_t(stride)};
         attributeData[attributeIndex++] = Trade::MeshAttributeData{
             Trade::MeshAttribute::TextureCoordinates, textureCoordinates};
         attributeOffset += sizeof(Vector2);
     }
 
-    CORRADE_INTERNAL_ASSERT(attributeIndex == attributeCount);
+    CORRADE_INTERNAL_ASSERT(attributeIndex == attributeData.size());
     CORRADE_INTERNAL_ASSERT(attributeOffset == stride);
 
-    /* Fill the data. First is center, the first/last point on the edge is
-       twice to close the circle properly. */
-    positions[0] = {};
-    normals[0] = {0.0f, 0.0f, 1.0f};
-    if(flags & Circle3DFlag::Tangents)
-        tangents[0] = {1.0f, 0.0f, 0.0f, 1.0f};
-    if(flags & Circle3DFlag::TextureCoordinates)
-        textureCoordinates[0] = {0.5f, 0.5f};
-    const Rad angleIncrement(Constants::tau()/segments);
-    for(UnsignedInt i = 1; i != segments + 2; ++i) {
-        const Rad angle(Float(i - 1)*angleIncrement);
-        const Containers::Pair<Float, Float> sincos = Math::sincos(angle);
+    Primitives::circle3DSolidInto(segments, positions, normals, tangents, textureCoordinates);
+}
 
-        positions[i] = {sincos.second(), sincos.first(), 0.0f};
-        normals[i] = {0.0f, 0.0f, 1.0f};
-        if(flags & Circle3DFlag::Tangents)
-            tangents[i] = {1.0f, 0.0f, 0.0f, 1.0f};
-        if(flags & Circle3DFlag::TextureCoordinates)
-            textureCoordinates[i] = positions[i].xy()*0.5f + Vector2{0.5f};
-    }
+}
+
+Trade::MeshData circle3DSolid(const UnsignedInt segments, const Circle3DFlags flags) {
+    CORRADE_ASSERT(segments >= 3, "Primitives::circle3DSolid(): segments must be >= 3",
+        (Trade::MeshData{MeshPrimitive::TriangleFan, 0}));
+
+    Containers::Array<char> vertexData{NoInit, circle3DSolidVertexCount(segments)*Implementation::circle3DSolidVertexSize(flags)*sizeof(Float)};
+    Containers::Array<Trade::MeshAttributeData> attributeData{Implementation::circle3DSolidAttributeCount(flags)};
+    Implementation::circle3DSolidInterleavedInto(segments, flags, vertexData, attributeData);
 
     return Trade::MeshData{MeshPrimitive::TriangleFan,
         Utility::move(vertexData), Utility::move(attributeData)};
@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::Primitives::circle2DSolid(), @ref Magnum::Primitives::circle2DWireframe(), @ref Magnum::Primitives::circle3DSolid(), @ref Magnum::Primitives::circle3DWireframe()
+ * @brief Function @ref Magnum::Primitives::circle2DSolid(), @ref Magnum::Primitives::circle2DWireframe(), @ref Magnum::Primitives::circle3DSolid(), @ref Magnum::Primitives::circle3DSolidInto(), @ref Magnum::Primitives::circle3DSolidVertexCount(), @ref Magnum::Primitives::circle3DWireframe()
  */
 
 #include <Corrade/Containers/EnumSet.h>
@@ -157,7 +157,7 @@ positive Z direction, optional @ref VertexFormat::Vector4 tangents and optional
 @image html primitives-circle3dsolid.png width=256px
 
 @see @ref circle3DWireframe(), @ref circle2DSolid(),
-    @ref MeshTools::generateTriangleFanIndices()
+    @ref circle3DSolidInto(), @ref MeshTools::generateTriangleFanIndices()
 */
 MAGNUM_PRIMITIVES_EXPORT Trade::MeshData circle3DSolid(UnsignedInt segments, Circle3DFlags flags = {});
 
@@ -172,6 +172,36 @@ MAGNUM_PRIMITIVES_EXPORT CORRADE_DEPRECATED("use circle3DSolid() with Circle2DFl
 CORRADE_IGNORE_DEPRECATED_POP
 #endif
 
+/**
+@brief Vertex count of a solid 3D circle
+@m_since_latest
+
+Returns @cpp segments + 2 @ce, i.e. the size of views expected by
+@ref circle3DSolidInto().
+*/
+MAGNUM_PRIMITIVES_EXPORT UnsignedInt circle3DSolidVertexCount(UnsignedInt segments);
+
+/**
+@brief Fill a solid 3D circle into existing views
+@param[in]  segments    Number of segments. Must be greater or equal to
+    @cpp 3 @ce.
+@param[out] positions   Where to put positions
+@param[out] normals     Where to put normals
+@param[out] tangents    Where to put tangents. Can be empty, in which case
+    tangents aren't generated.
+@param[out] textureCoordinates Where to put texture coordinates. Can be
+    empty, in which case texture coordinates aren't generated.
+@m_since_latest
+
+Produces the same vertices as @ref circle3DSolid(), but instead of allocating
+a @ref Trade::MeshData writes them directly to given views, which can point
+for example to a mapped GPU buffer. The @p positions, @p normals and all
+non-empty views are expected to have @ref circle3DSolidVertexCount() items.
+The vertices are meant to be drawn as a @ref MeshPrimitive::TriangleFan.
+@see @ref uvSphereSolidInto(), @ref grid3DSolidInto()
+*/
+MAGNUM_PRIMITIVES_EXPORT void circle3DSolidInto(UnsignedInt segments, const Containers::StridedArrayView1D<Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Containers::StridedArrayView1D<Vector4>& tangents, const Containers::StridedArrayView1D<Vector2>& textureCoordinates);
+
 /**
 @brief Wireframe 3D circle
 @param segments  Number of segments. Must be greater or equal to @cpp 3 @ce.
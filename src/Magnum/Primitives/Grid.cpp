@@ -28,17 +28,34 @@
 
 #include "Magnum/Mesh.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Primitives/Static.h"
 #include "Magnum/Trade/MeshData.h"
 
 namespace Magnum { namespace Primitives {
 
-Trade::MeshData grid3DSolid(const Vector2i& subdivisions, const GridFlags flags) {
+UnsignedInt grid3DSolidVertexCount(const Vector2i& subdivisions) {
+    return (subdivisions + Vector2i{2}).product();
+}
+
+UnsignedInt grid3DSolidIndexCount(const Vector2i& subdivisions) {
+    return (subdivisions + Vector2i{1}).product()*6;
+}
+
+void grid3DSolidInto(const Vector2i& subdivisions, const Containers::ArrayView<UnsignedInt>& indices, const Containers::StridedArrayView1D<Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Containers::StridedArrayView1D<Vector4>& tangents, const Containers::StridedArrayView1D<Vector2>& textureCoordinates) {
     const Vector2i vertexCount = subdivisions + Vector2i{2};
     const Vector2i faceCount = subdivisions + Vector2i{1};
+    CORRADE_ASSERT(indices.size() == grid3DSolidIndexCount(subdivisions),
+        "Primitives::grid3DSolidInto(): expected" << grid3DSolidIndexCount(subdivisions) << "indices but got" << indices.size(), );
+    CORRADE_ASSERT(positions.size() == std::size_t(vertexCount.product()),
+        "Primitives::grid3DSolidInto(): expected" << vertexCount.product() << "positions but got" << positions.size(), );
+    CORRADE_ASSERT(normals.isEmpty() || normals.size() == positions.size(),
+        "Primitives::grid3DSolidInto(): expected" << positions.size() << "normals but got" << normals.size(), );
+    CORRADE_ASSERT(tangents.isEmpty() || tangents.size() == positions.size(),
+        "Primitives::grid3DSolidInto(): expected" << positions.size() << "tangents but got" << tangents.size(), );
+    CORRADE_ASSERT(textureCoordinates.isEmpty() || textureCoordinates.size() == positions.size(),
+        "Primitives::grid3DSolidInto(): expected" << positions.size() << "texture coordinates but got" << textureCoordinates.size(), );
 
     /* Indices */
-    Containers::Array<char> indexData{std::size_t(faceCount.product()*6)*sizeof(UnsignedInt)};
-    auto indices = Containers::arrayCast<UnsignedInt>(indexData);
     {
         std::size_t i = 0;
         for(Int y = 0; y != faceCount.y(); ++y) {
@@ -57,74 +74,89 @@ Trade::MeshData grid3DSolid(const Vector2i& subdivisions, const GridFlags flags)
         }
     }
 
-    /* Calculate attribute count and vertex size */
-    std::size_t stride = sizeof(Vector3);
-    std::size_t attributeCount = 1;
-    if(flags & GridFlag::Normals) {
-        stride += sizeof(Vector3);
-        ++attributeCount;
-    }
-    if(flags & GridFlag::Tangents) {
-        stride += sizeof(Vector4);
-        ++attributeCount;
-    }
-    if(flags & GridFlag::TextureCoordinates) {
-        stride += sizeof(Vector2);
-        ++attributeCount;
+    /* Positions */
+    {
+        std::size_t i = 0;
+        for(Int y = 0; y != vertexCount.y(); ++y)
+            for(Int x = 0; x != vertexCount.x(); ++x)
+                positions[i++] = {(Vector2(x, y)/Vector2(faceCount))*2.0f - Vector2{1.0f}, 0.0f};
     }
-    Containers::Array<char> vertexData{stride*vertexCount.product()};
-    Containers::Array<Trade::MeshAttributeData> attributes{attributeCount};
+
+    /* Normals and tangents, if any. Those are the same for all. */
+    for(Vector3& i: normals) i = Vector3::zAxis(1.0f);
+    for(Vector4& i: tangents) i = {1.0f, 0.0f, 0.0f, 1.0f};
+
+    /* Texture coordinates, if any */
+    for(std::size_t i = 0; i != textureCoordinates.size(); ++i)
+        textureCoordinates[i] = positions[i].xy()*0.5f + Vector2{0.5f};
+}
+
+namespace Implementation {
+
+void grid3DSolidInterleavedInto(const Vector2i& subdivisions, const GridFlags flags, const Containers::ArrayView<UnsignedInt> indices, const Containers::ArrayView<char> vertexData, const Containers::ArrayView<Trade::MeshAttributeData> attributes) {
+    const std::size_t vertexCount = grid3DSolidVertexCount(subdivisions);
+    const std::size_t stride = grid3DSolidVertexSize(flags)*sizeof(Float);
+    CORRADE_INTERNAL_ASSERT(vertexData.size() == stride*vertexCount);
+    CORRADE_INTERNAL_ASSERT(attributes.size() == grid3DSolidAttributeCount(flags));
+
     std::size_t attributeIndex = 0;
     std::size_t attributeOffset = 0;
 
-    /* Fill positions */
     Containers::StridedArrayView1D<Vector3> positions{vertexData,
         reinterpret_cast<Vector3*>(vertexData.begin()),
-        std::size_t(vertexCount.product()), std::ptrdiff_t(stride)};
+        vertexCount, std::ptrdiff_t(stride)};
     attributes[attributeIndex++] =
         Trade::MeshAttributeData{Trade::MeshAttribute::Position, positions};
     attributeOffset += sizeof(Vector3);
-    {
-        std::size_t i = 0;
-        for(Int y = 0; y != vertexCount.y(); ++y)
-            for(Int x = 0; x != vertexCount.x(); ++x)
-                positions[i++] = {(Vector2(x, y)/Vector2(faceCount))*2.0f - Vector2{1.0f}, 0.0f};
-    }
 
-    /* Fill normals and tangents, if any. Those are the same for all. */
+    Containers::StridedArrayView1D<Vector3> normals;
     if(flags & GridFlag::Normals) {
-        Containers::StridedArrayView1D<Vector3> normals{vertexData,
+        normals = Containers::StridedArrayView1D<Vector3>{vertexData,
             reinterpret_cast<Vector3*>(vertexData.begin() + attributeOffset),
-            std::size_t(vertexCount.product()), std::ptrdiff_t(stride)};
+            vertexCount, std::ptrdiff_t(stride)};
         attributes[attributeIndex++] =
             Trade::MeshAttributeData{Trade::MeshAttribute::Normal, normals};
         attributeOffset += sizeof(Vector3);
-        for(auto&& i: normals) i = Vector3::zAxis(1.0f);
     }
+
+    Containers::StridedArrayView1D<Vector4> tangents;
     if(flags & GridFlag::Tangents) {
-        Containers::StridedArrayView1D<Vector4> tangents{vertexData,
+        tangents = Containers::StridedArrayView1D<Vector4>{vertexData,
             reinterpret_cast<Vector4*>(vertexData.begin() + attributeOffset),
-            std::size_t(vertexCount.product()), std::ptrdiff_t(stride)};
+            vertexCount, std::ptrdiff_t(stride)};
         attributes[attributeIndex++] =
             Trade::MeshAttributeData{Trade::MeshAttribute::Tangent, tangents};
         attributeOffset += sizeof(Vector4);
-        for(auto&& i: tangents) i = {1.0f, 0.0f, 0.0f, 1.0f};
     }
 
+    Containers::StridedArrayView1D<Vector2> textureCoordinates;
     if(flags & GridFlag::TextureCoordinates) {
-        Containers::StridedArrayView1D<Vector2> textureCoords{vertexData,
+        textureCoordinates = Containers::StridedArrayView1D<Vector2>{vertexData,
             reinterpret_cast<Vector2*>(vertexData.begin() + attributeOffset),
-            std::size_t(vertexCount.product()), std::ptrdiff_t(stride)};
+            vertexCount, std::ptrdiff_t(stride)};
         attributes[attributeIndex++] =
-            Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, textureCoords};
+            Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, textureCoordinates};
         attributeOffset += sizeof(Vector2);
-        for(std::size_t i = 0; i != positions.size(); ++i)
-            textureCoords[i] = positions[i].xy()*0.5f + Vector2{0.5f};
     }
 
-    CORRADE_INTERNAL_ASSERT(attributeIndex == attributeCount);
+    CORRADE_INTERNAL_ASSERT(attributeIndex == attributes.size());
     CORRADE_INTERNAL_ASSERT(attributeOffset == stride);
 
+    Primitives::grid3DSolidInto(subdivisions, indices, positions, normals, tangents, textureCoordinates);
+}
+
+}
+
+Trade::MeshData grid3DSolid(const Vector2i& subdivisions, const GridFlags flags) {
+    const std::size_t vertexCount = grid3DSolidVertexCount(subdivisions);
+    const std::size_t indexCount = grid3DSolidIndexCount(subdivisions);
+
+    Containers::Array<char> indexData{NoInit, indexCount*sizeof(UnsignedInt)};
+    Containers::Array<char> vertexData{ValueInit, vertexCount*Implementation::grid3DSolidVertexSize(flags)*sizeof(Float)};
+    Containers::Array<Trade::MeshAttributeData> attributes{Implementation::grid3DSolidAttributeCount(flags)};
+    const Containers::ArrayView<UnsignedInt> indices = Containers::arrayCast<UnsignedInt>(indexData);
+    Implementation::grid3DSolidInterleavedInto(subdivisions, flags, indices, vertexData, attributes);
+
     return Trade::MeshData{MeshPrimitive::Triangles,
         Utility::move(indexData), Trade::MeshIndexData{indices},
         Utility::move(vertexData), Utility::move(attributes)};
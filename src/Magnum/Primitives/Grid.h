@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::Primitives::grid3DSolid(), @ref Magnum::Primitives::grid3DWireframe()
+ * @brief Function @ref Magnum::Primitives::grid3DSolid(), @ref Magnum::Primitives::grid3DSolidInto(), @ref Magnum::Primitives::grid3DSolidVertexCount(), @ref Magnum::Primitives::grid3DSolidIndexCount(), @ref Magnum::Primitives::grid3DWireframe()
  */
 
 #include <Corrade/Containers/EnumSet.h>
@@ -108,10 +108,51 @@ each direction. Specifying @cpp {0, 0} @ce will make the result an (indexed)
 equivalent to @ref planeSolid(); @cpp {5, 3} @ce will make the grid have 6
 cells horizontally and 4 vertically. In particular, this is different from the
 `subdivisions` parameter in @ref icosphereSolid().
-@see @ref grid3DWireframe()
+@see @ref grid3DWireframe(), @ref grid3DSolidInto()
 */
 MAGNUM_PRIMITIVES_EXPORT Trade::MeshData grid3DSolid(const Vector2i& subdivisions, GridFlags flags = GridFlag::Normals);
 
+/**
+@brief Vertex count of a solid 3D grid
+@m_since_latest
+
+Returns @cpp (subdivisions + 2).product() @ce, i.e. the size of vertex views
+expected by @ref grid3DSolidInto().
+*/
+MAGNUM_PRIMITIVES_EXPORT UnsignedInt grid3DSolidVertexCount(const Vector2i& subdivisions);
+
+/**
+@brief Index count of a solid 3D grid
+@m_since_latest
+
+Returns @cpp (subdivisions + 1).product()*6 @ce, i.e. the size of the index
+view expected by @ref grid3DSolidInto().
+*/
+MAGNUM_PRIMITIVES_EXPORT UnsignedInt grid3DSolidIndexCount(const Vector2i& subdivisions);
+
+/**
+@brief Fill a solid 3D grid into existing views
+@param[in]  subdivisions Subdivisions, see @ref grid3DSolid() for details
+@param[out] indices     Where to put indices
+@param[out] positions   Where to put positions
+@param[out] normals     Where to put normals. Can be empty, in which case
+    normals aren't generated.
+@param[out] tangents    Where to put tangents. Can be empty, in which case
+    tangents aren't generated.
+@param[out] textureCoordinates Where to put texture coordinates. Can be
+    empty, in which case texture coordinates aren't generated.
+@m_since_latest
+
+Produces the same data as @ref grid3DSolid(), but instead of allocating a
+@ref Trade::MeshData writes them directly to given views, which can point for
+example to a mapped GPU buffer. The @p indices view is expected to have
+@ref grid3DSolidIndexCount() items, @p positions and all non-empty vertex
+views @ref grid3DSolidVertexCount() items. The indices describe a
+@ref MeshPrimitive::Triangles mesh.
+@see @ref circle3DSolidInto(), @ref uvSphereSolidInto()
+*/
+MAGNUM_PRIMITIVES_EXPORT void grid3DSolidInto(const Vector2i& subdivisions, const Containers::ArrayView<UnsignedInt>& indices, const Containers::StridedArrayView1D<Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Containers::StridedArrayView1D<Vector4>& tangents, const Containers::StridedArrayView1D<Vector2>& textureCoordinates);
+
 /**
 @brief Wireframe 3D grid
 
@@ -27,6 +27,7 @@
 #include "Spheroid.h"
 
 #include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Utility/Algorithms.h>
 
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Color.h"
@@ -36,7 +37,7 @@
 
 namespace Magnum { namespace Primitives { namespace Implementation {
 
-Spheroid::Spheroid(UnsignedInt segments, Flags flags): _segments(segments), _flags{flags}, _stride{sizeof(Vector3) + sizeof(Vector3)}, _attributeCount{2} {
+Spheroid::Spheroid(UnsignedInt segments, Flags flags): _segments(segments), _flags{flags}, _stride{sizeof(Vector3) + sizeof(Vector3)}, _attributeCount{2}, _external{} {
     if(_flags & Flag::Tangents) {
         _tangentOffset = _stride;
         _stride += sizeof(Vector4);
@@ -50,39 +51,74 @@ Spheroid::Spheroid(UnsignedInt segments, Flags flags): _segments(segments), _fla
     } else _textureCoordinateOffset = ~std::size_t{};
 }
 
+Spheroid::Spheroid(const UnsignedInt segments, const Containers::ArrayView<UnsignedInt>& indices, const Containers::StridedArrayView1D<Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Containers::StridedArrayView1D<Vector4>& tangents, const Containers::StridedArrayView1D<Vector2>& textureCoordinates): Spheroid{segments,
+    (tangents.isEmpty() ? Flags{} : Flag::Tangents)|
+    (textureCoordinates.isEmpty() ? Flags{} : Flag::TextureCoordinates)}
+{
+    _external = true;
+    _indices = indices;
+    _positions = positions;
+    _normals = normals;
+    _tangents = tangents;
+    _textureCoordinates = textureCoordinates;
+}
+
 void Spheroid::append(const Vector3& position, const Vector3& normal) {
-    Containers::arrayAppend<Trade::ArrayAllocator>(_vertexData,
-        Containers::arrayCast<const char>(Containers::arrayView(&position, 1)));
-    Containers::arrayAppend<Trade::ArrayAllocator>(_vertexData,
-        Containers::arrayCast<const char>(Containers::arrayView(&normal, 1)));
-    if(_flags & Flag::Tangents) {
-        /** @todo make arrayGrow() a public API instead of this */
-        constexpr const char empty[sizeof(Vector4)]{};
-        Containers::arrayAppend<Trade::ArrayAllocator>(_vertexData,
-            Containers::arrayView(empty));
+    if(_external) {
+        CORRADE_INTERNAL_ASSERT(_vertexCount < _positions.size());
+    } else {
+        /* Tangents and texture coordinates get filled by the caller */
+        for(char& i: Containers::arrayAppend<Trade::ArrayAllocator>(_vertexData, NoInit, _stride)) i = 0;
+
+        /* The array might have been reallocated, update the views */
+        const std::size_t count = _vertexData.size()/_stride;
+        _positions = Containers::StridedArrayView1D<Vector3>{_vertexData,
+            reinterpret_cast<Vector3*>(_vertexData.data()),
+            count, std::ptrdiff_t(_stride)};
+        _normals = Containers::StridedArrayView1D<Vector3>{_vertexData,
+            reinterpret_cast<Vector3*>(_vertexData.data() + sizeof(Vector3)),
+            count, std::ptrdiff_t(_stride)};
+        if(_flags & Flag::Tangents)
+            _tangents = Containers::StridedArrayView1D<Vector4>{_vertexData,
+                reinterpret_cast<Vector4*>(_vertexData.data() + _tangentOffset),
+                count, std::ptrdiff_t(_stride)};
+        if(_flags & Flag::TextureCoordinates)
+            _textureCoordinates = Containers::StridedArrayView1D<Vector2>{_vertexData,
+                reinterpret_cast<Vector2*>(_vertexData.data() + _textureCoordinateOffset),
+                count, std::ptrdiff_t(_stride)};
     }
-    if(_flags & Flag::TextureCoordinates) {
-        /** @todo make arrayGrow() a public API instead */
-        constexpr const char empty[sizeof(Vector2)]{};
-        Containers::arrayAppend<Trade::ArrayAllocator>(_vertexData,
-            Containers::arrayView(empty));
+
+    _positions[_vertexCount] = position;
+    _normals[_vertexCount] = normal;
+    ++_vertexCount;
+}
+
+void Spheroid::appendIndices(const std::initializer_list<UnsignedInt> indices) {
+    const Containers::ArrayView<const UnsignedInt> view{indices.begin(), indices.size()};
+    if(_external) {
+        CORRADE_INTERNAL_ASSERT(_indexCount + view.size() <= _indices.size());
+        Utility::copy(view, _indices.sliceSize(_indexCount, view.size()));
+    } else {
+        Containers::arrayAppend<Trade::ArrayAllocator>(_indexData, view);
+        _indices = _indexData;
     }
+    _indexCount += view.size();
 }
 
 Vector3 Spheroid::lastVertexPosition(const std::size_t offsetFromEnd) {
-    return Containers::arrayCast<Vector3>(_vertexData.slice<sizeof(Vector3)>(_vertexData.size() - _stride*offsetFromEnd))[0];
+    return _positions[_vertexCount - offsetFromEnd];
 }
 
 Vector3 Spheroid::lastVertexNormal(const std::size_t offsetFromEnd) {
-    return Containers::arrayCast<Vector3>(_vertexData.slice<sizeof(Vector3)>(_vertexData.size() - _stride*offsetFromEnd + sizeof(Vector3)))[0];
+    return _normals[_vertexCount - offsetFromEnd];
 }
 
 Vector4& Spheroid::lastVertexTangent(const std::size_t offsetFromEnd) {
-    return Containers::arrayCast<Vector4>(_vertexData.slice<sizeof(Vector4)>(_vertexData.size() - _stride*offsetFromEnd + _tangentOffset))[0];
+    return _tangents[_vertexCount - offsetFromEnd];
 }
 
 Vector2& Spheroid::lastVertexTextureCoords(const std::size_t offsetFromEnd) {
-    return Containers::arrayCast<Vector2>(_vertexData.slice<sizeof(Vector2)>(_vertexData.size() - _stride*offsetFromEnd + _textureCoordinateOffset))[0];
+    return _textureCoordinates[_vertexCount - offsetFromEnd];
 }
 
 void Spheroid::capVertex(Float y, Float normalY, Float textureCoordsV) {
@@ -159,7 +195,7 @@ void Spheroid::cylinderVertexRings(const UnsignedInt count, const Float startY,
 
 void Spheroid::bottomFaceRing() {
     for(UnsignedInt j = 0; j != _segments; ++j) {
-        Containers::arrayAppend<Trade::ArrayAllocator>(_indexData, {
+        appendIndices({
             /* Bottom vertex */
             0u,
 
@@ -184,7 +220,7 @@ void Spheroid::faceRings(UnsignedInt count, UnsignedInt offset) {
             const UnsignedInt topLeft = bottomLeft+vertexSegments;
             const UnsignedInt topRight = bottomRight+vertexSegments;
 
-            Containers::arrayAppend<Trade::ArrayAllocator>(_indexData, {
+            appendIndices({
                 bottomLeft,
                 bottomRight,
                 topRight,
@@ -199,10 +235,10 @@ void Spheroid::faceRings(UnsignedInt count, UnsignedInt offset) {
 void Spheroid::topFaceRing() {
     const UnsignedInt vertexSegments = _segments + (_flags & (Flag::TextureCoordinates|Flag::Tangents) ? 1 : 0);
 
-    const UnsignedInt vertexCount = _vertexData.size()/_stride;
+    const UnsignedInt vertexCount = _vertexCount;
 
     for(UnsignedInt j = 0; j != _segments; ++j) {
-        Containers::arrayAppend<Trade::ArrayAllocator>(_indexData, {
+        appendIndices({
             /* Bottom left vertex */
             vertexCount - vertexSegments + j - 1,
 
@@ -242,33 +278,22 @@ void Spheroid::capVertexRing(Float y, Float textureCoordsV, const Vector3& norma
 }
 
 Trade::MeshData Spheroid::finalize() {
+    CORRADE_INTERNAL_ASSERT(!_external);
+
     Trade::MeshIndexData indices{_indexData};
 
     std::size_t attributeOffset = 0;
     Containers::Array<Trade::MeshAttributeData> attributes{_attributeCount};
     attributes[attributeOffset++] = Trade::MeshAttributeData{
-        Trade::MeshAttribute::Position, VertexFormat::Vector3,
-        Containers::StridedArrayView1D<const void>{_vertexData,
-            _vertexData.data(),
-            _vertexData.size()/_stride, std::ptrdiff_t(_stride)}};
+        Trade::MeshAttribute::Position, _positions};
     attributes[attributeOffset++] = Trade::MeshAttributeData{
-        Trade::MeshAttribute::Normal, VertexFormat::Vector3,
-        Containers::StridedArrayView1D<const void>{_vertexData,
-            _vertexData.data() + sizeof(Vector3),
-            _vertexData.size()/_stride, std::ptrdiff_t(_stride)}};
-
+        Trade::MeshAttribute::Normal, _normals};
     if(_flags & Flag::Tangents)
         attributes[attributeOffset++] = Trade::MeshAttributeData{
-            Trade::MeshAttribute::Tangent, VertexFormat::Vector4,
-            Containers::StridedArrayView1D<const void>{_vertexData,
-                _vertexData.data() + _tangentOffset,
-                _vertexData.size()/_stride, std::ptrdiff_t(_stride)}};
+            Trade::MeshAttribute::Tangent, _tangents};
     if(_flags & Flag::TextureCoordinates)
         attributes[attributeOffset++] = Trade::MeshAttributeData{
-            Trade::MeshAttribute::TextureCoordinates, VertexFormat::Vector2,
-            Containers::StridedArrayView1D<const void>{_vertexData,
-                _vertexData.data() + _textureCoordinateOffset,
-                _vertexData.size()/_stride, std::ptrdiff_t(_stride)}};
+            Trade::MeshAttribute::TextureCoordinates, _textureCoordinates};
 
     CORRADE_INTERNAL_ASSERT(attributeOffset == _attributeCount);
 
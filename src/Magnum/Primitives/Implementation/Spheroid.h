@@ -26,11 +26,13 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <initializer_list>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/EnumSet.h>
 #include <Corrade/Containers/StridedArrayView.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector4.h"
 #include "Magnum/Trade/Trade.h"
 
 namespace Magnum { namespace Primitives { namespace Implementation {
@@ -46,6 +48,12 @@ class Spheroid {
 
         explicit Spheroid(UnsignedInt segments, Flags flags);
 
+        /* Writes into given views instead of allocating, which are expected
+           to be large enough. Flags are derived from tangent and texture
+           coordinate views being non-empty. Used by the *Into() primitive
+           variants, finalize() can't be called in this case. */
+        explicit Spheroid(UnsignedInt segments, const Containers::ArrayView<UnsignedInt>& indices, const Containers::StridedArrayView1D<Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Containers::StridedArrayView1D<Vector4>& tangents, const Containers::StridedArrayView1D<Vector2>& textureCoordinates);
+
         void capVertex(Float y, Float normalY, Float textureCoordsV);
         void hemisphereVertexRings(UnsignedInt count, Float centerY, Rad startRingAngle, Rad ringAngleIncrement, Float startTextureCoordsV, Float textureCoordsVIncrement);
         void cylinderVertexRings(UnsignedInt count, Float startY, const Vector2& increment, Float startTextureCoordsV, Float textureCoordsVIncrement);
@@ -64,10 +72,20 @@ class Spheroid {
             _tangentOffset;
         std::size_t _attributeCount;
 
+        /* Used only if not writing to external views */
         Containers::Array<UnsignedInt> _indexData;
         Containers::Array<char> _vertexData;
 
+        /* Either external or pointing to the arrays above */
+        bool _external;
+        Containers::ArrayView<UnsignedInt> _indices;
+        Containers::StridedArrayView1D<Vector3> _positions, _normals;
+        Containers::StridedArrayView1D<Vector4> _tangents;
+        Containers::StridedArrayView1D<Vector2> _textureCoordinates;
+        std::size_t _indexCount{}, _vertexCount{};
+
         void append(const Vector3& position, const Vector3& normal);
+        void appendIndices(std::initializer_list<UnsignedInt> indices);
         Vector3 lastVertexPosition(std::size_t offsetFromEnd);
         Vector3 lastVertexNormal(std::size_t offsetFromEnd);
         Vector4& lastVertexTangent(std::size_t offsetFromEnd);
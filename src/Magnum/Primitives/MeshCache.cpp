@@ -0,0 +1,125 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshCache.h"
+
+#include <cstring>
+#include <unordered_map>
+#include <Corrade/Utility/MurmurHash2.h>
+
+#include "Magnum/MeshTools/Copy.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace Primitives {
+
+namespace {
+
+enum class Primitive: UnsignedInt {
+    UVSphereSolid,
+    IcosphereSolid,
+    CylinderSolid,
+    Capsule3DSolid
+};
+
+/* All members are four bytes so there's no padding and the whole struct can
+   be hashed and compared as a memory block. Unused parameters are zero. */
+struct Key {
+    Primitive primitive;
+    UnsignedInt parameters[3];
+    Float halfLength;
+    UnsignedInt flags;
+};
+
+static_assert(sizeof(Key) == 6*4, "unexpected padding in Key");
+
+struct KeyHash {
+    std::size_t operator()(const Key& key) const {
+        return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(reinterpret_cast<const char*>(&key), sizeof(Key)).byteArray());
+    }
+};
+
+struct KeyEqual {
+    bool operator()(const Key& a, const Key& b) const {
+        return std::memcmp(&a, &b, sizeof(Key)) == 0;
+    }
+};
+
+}
+
+struct MeshCache::State {
+    /* Node-based so the stored data don't move when the map grows */
+    std::unordered_map<Key, Trade::MeshData, KeyHash, KeyEqual> meshes;
+
+    template<class Generator> Trade::MeshData get(const Key& key, Generator generator) {
+        auto found = meshes.find(key);
+        if(found == meshes.end())
+            found = meshes.emplace(key, generator()).first;
+        return MeshTools::reference(found->second);
+    }
+};
+
+MeshCache::MeshCache(): _state{InPlaceInit} {}
+
+MeshCache::MeshCache(MeshCache&&) noexcept = default;
+
+MeshCache::~MeshCache() = default;
+
+MeshCache& MeshCache::operator=(MeshCache&&) noexcept = default;
+
+std::size_t MeshCache::size() const {
+    return _state->meshes.size();
+}
+
+void MeshCache::clear() {
+    _state->meshes.clear();
+}
+
+Trade::MeshData MeshCache::uvSphereSolid(const UnsignedInt rings, const UnsignedInt segments, const UVSphereFlags flags) {
+    return _state->get({Primitive::UVSphereSolid, {rings, segments, 0}, 0.0f, UnsignedInt(UnsignedByte(flags))}, [&]{
+        return Primitives::uvSphereSolid(rings, segments, flags);
+    });
+}
+
+Trade::MeshData MeshCache::icosphereSolid(const UnsignedInt subdivisions) {
+    return _state->get({Primitive::IcosphereSolid, {subdivisions, 0, 0}, 0.0f, 0}, [&]{
+        return Primitives::icosphereSolid(subdivisions);
+    });
+}
+
+Trade::MeshData MeshCache::cylinderSolid(const UnsignedInt rings, const UnsignedInt segments, const Float halfLength, const CylinderFlags flags) {
+    return _state->get({Primitive::CylinderSolid, {rings, segments, 0}, halfLength, UnsignedInt(UnsignedByte(flags))}, [&]{
+        return Primitives::cylinderSolid(rings, segments, halfLength, flags);
+    });
+}
+
+Trade::MeshData MeshCache::capsule3DSolid(const UnsignedInt hemisphereRings, const UnsignedInt cylinderRings, const UnsignedInt segments, const Float halfLength, const CapsuleFlags flags) {
+    return _state->get({Primitive::Capsule3DSolid, {hemisphereRings, cylinderRings, segments}, halfLength, UnsignedInt(UnsignedByte(flags))}, [&]{
+        return Primitives::capsule3DSolid(hemisphereRings, cylinderRings, segments, halfLength, flags);
+    });
+}
+
+}}
@@ -0,0 +1,136 @@
+#ifndef Magnum_Primitives_MeshCache_h
+#define Magnum_Primitives_MeshCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Primitives::MeshCache
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Primitives/Capsule.h"
+#include "Magnum/Primitives/Cylinder.h"
+#include "Magnum/Primitives/UVSphere.h"
+
+namespace Magnum { namespace Primitives {
+
+/**
+@brief Primitive mesh cache
+@m_since_latest
+
+Memoizes results of primitive generators. The first call with a particular
+combination of parameters and flags generates the mesh and stores it in the
+cache, subsequent calls with the same parameters return a
+@ref MeshTools::reference() to the stored data instead of generating it again.
+Useful for example for debug draws or gizmos that request the same primitives
+many times:
+
+@snippet Primitives.cpp MeshCache
+
+The returned @ref Trade::MeshData instances are non-owning and immutable, with
+@ref Trade::MeshData::indexDataFlags() and
+@ref Trade::MeshData::vertexDataFlags() being empty. They stay valid until
+@ref clear() is called or the cache is destroyed. If you need to modify the
+data, make a copy using @ref MeshTools::copy(). To avoid uploading the same
+data to the GPU multiple times, store the @ref MeshTools::compile() output
+alongside, for example in a @ref ResourceManager.
+
+The class isn't thread-safe, use a separate instance for each thread or guard
+the access externally.
+*/
+class MAGNUM_PRIMITIVES_EXPORT MeshCache {
+    public:
+        /** @brief Constructor */
+        explicit MeshCache();
+
+        /** @brief Copying is not allowed */
+        MeshCache(const MeshCache&) = delete;
+
+        /** @brief Move constructor */
+        MeshCache(MeshCache&&) noexcept;
+
+        ~MeshCache();
+
+        /** @brief Copying is not allowed */
+        MeshCache& operator=(const MeshCache&) = delete;
+
+        /** @brief Move assignment */
+        MeshCache& operator=(MeshCache&&) noexcept;
+
+        /** @brief Count of cached meshes */
+        std::size_t size() const;
+
+        /**
+         * @brief Clear the cache
+         *
+         * All meshes previously returned from this instance become invalid.
+         */
+        void clear();
+
+        /**
+         * @brief Cached @ref Primitives::uvSphereSolid()
+         *
+         * Returns a non-owning reference to a mesh in the cache, generating
+         * it first if not present yet.
+         */
+        Trade::MeshData uvSphereSolid(UnsignedInt rings, UnsignedInt segments, UVSphereFlags flags = {});
+
+        /**
+         * @brief Cached @ref Primitives::icosphereSolid()
+         *
+         * Returns a non-owning reference to a mesh in the cache, generating
+         * it first if not present yet.
+         */
+        Trade::MeshData icosphereSolid(UnsignedInt subdivisions);
+
+        /**
+         * @brief Cached @ref Primitives::cylinderSolid()
+         *
+         * Returns a non-owning reference to a mesh in the cache, generating
+         * it first if not present yet. The @p halfLength is compared
+         * bitwise.
+         */
+        Trade::MeshData cylinderSolid(UnsignedInt rings, UnsignedInt segments, Float halfLength, CylinderFlags flags = {});
+
+        /**
+         * @brief Cached @ref Primitives::capsule3DSolid()
+         *
+         * Returns a non-owning reference to a mesh in the cache, generating
+         * it first if not present yet. The @p halfLength is compared
+         * bitwise.
+         */
+        Trade::MeshData capsule3DSolid(UnsignedInt hemisphereRings, UnsignedInt cylinderRings, UnsignedInt segments, Float halfLength, CapsuleFlags flags = {});
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
@@ -0,0 +1,192 @@
+#ifndef Magnum_Primitives_Static_h
+#define Magnum_Primitives_Static_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Primitives::circle3DSolid(), @ref Magnum::Primitives::grid3DSolid(), @ref Magnum::Primitives::uvSphereSolid() with static storage
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Primitives/Circle.h"
+#include "Magnum/Primitives/Grid.h"
+#include "Magnum/Primitives/UVSphere.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace Primitives {
+
+namespace Implementation {
+    /* Combines a pack of enum values into an enum set in a constexpr
+       context */
+    template<class T> constexpr T enumSet() { return T{}; }
+    template<class T, class U, class ...V> constexpr T enumSet(U first, V... next) {
+        return T{first}|enumSet<T>(next...);
+    }
+
+    /* Vertex sizes are in floats, as all attributes are float-based and the
+       static storage is a float array to have it properly aligned */
+    constexpr UnsignedInt circle3DSolidVertexSize(Circle3DFlags flags) {
+        return 6 + (flags & Circle3DFlag::Tangents ? 4 : 0) + (flags & Circle3DFlag::TextureCoordinates ? 2 : 0);
+    }
+    constexpr UnsignedInt circle3DSolidAttributeCount(Circle3DFlags flags) {
+        return 2 + (flags & Circle3DFlag::Tangents ? 1 : 0) + (flags & Circle3DFlag::TextureCoordinates ? 1 : 0);
+    }
+    MAGNUM_PRIMITIVES_EXPORT void circle3DSolidInterleavedInto(UnsignedInt segments, Circle3DFlags flags, Containers::ArrayView<char> vertexData, Containers::ArrayView<Trade::MeshAttributeData> attributeData);
+
+    constexpr UnsignedInt grid3DSolidVertexSize(GridFlags flags) {
+        return 3 + (flags & GridFlag::Normals ? 3 : 0) + (flags & GridFlag::Tangents ? 4 : 0) + (flags & GridFlag::TextureCoordinates ? 2 : 0);
+    }
+    constexpr UnsignedInt grid3DSolidAttributeCount(GridFlags flags) {
+        return 1 + (flags & GridFlag::Normals ? 1 : 0) + (flags & GridFlag::Tangents ? 1 : 0) + (flags & GridFlag::TextureCoordinates ? 1 : 0);
+    }
+    MAGNUM_PRIMITIVES_EXPORT void grid3DSolidInterleavedInto(const Vector2i& subdivisions, GridFlags flags, Containers::ArrayView<UnsignedInt> indexData, Containers::ArrayView<char> vertexData, Containers::ArrayView<Trade::MeshAttributeData> attributeData);
+
+    /* The first vertex of each ring is duplicated if there are texture
+       coordinates or tangents, to have a seam */
+    constexpr UnsignedInt uvSphereSolidVertexCount(UnsignedInt rings, UnsignedInt segments, UVSphereFlags flags) {
+        return 2 + (rings - 1)*(segments + (flags & (UVSphereFlag::TextureCoordinates|UVSphereFlag::Tangents) ? 1 : 0));
+    }
+    constexpr UnsignedInt uvSphereSolidVertexSize(UVSphereFlags flags) {
+        return 6 + (flags & UVSphereFlag::Tangents ? 4 : 0) + (flags & UVSphereFlag::TextureCoordinates ? 2 : 0);
+    }
+    constexpr UnsignedInt uvSphereSolidAttributeCount(UVSphereFlags flags) {
+        return 2 + (flags & UVSphereFlag::Tangents ? 1 : 0) + (flags & UVSphereFlag::TextureCoordinates ? 1 : 0);
+    }
+    MAGNUM_PRIMITIVES_EXPORT void uvSphereSolidInterleavedInto(UnsignedInt rings, UnsignedInt segments, UVSphereFlags flags, Containers::ArrayView<UnsignedInt> indexData, Containers::ArrayView<char> vertexData, Containers::ArrayView<Trade::MeshAttributeData> attributeData);
+}
+
+/**
+@brief Solid 3D circle with static storage
+@tparam segments    Number of segments. Must be greater or equal to
+    @cpp 3 @ce.
+@tparam flags       Flags
+@m_since_latest
+
+Equivalent to @ref circle3DSolid(UnsignedInt, Circle3DFlags), but the data are
+stored in a statically allocated memory sized at compile time. They get filled
+on the first call with given template parameters, subsequent calls only return
+a new non-owning @ref Trade::MeshData referencing the same memory. No heap
+allocation is done at any point, which makes this variant suitable for
+embedded targets. The returned instance has @ref Trade::DataFlag::Global set
+for vertex data:
+
+@snippet Primitives.cpp circle3DSolid-static
+
+@see @ref grid3DSolid(), @ref uvSphereSolid()
+*/
+template<UnsignedInt segments, Circle3DFlag ...flags> Trade::MeshData circle3DSolid() {
+    static_assert(segments >= 3, "Primitives::circle3DSolid(): segments must be >= 3");
+
+    struct Storage {
+        explicit Storage() {
+            Implementation::circle3DSolidInterleavedInto(segments, Implementation::enumSet<Circle3DFlags>(flags...), Containers::arrayCast<char>(Containers::arrayView(vertexData)), attributeData);
+        }
+
+        Float vertexData[(segments + 2)*Implementation::circle3DSolidVertexSize(Implementation::enumSet<Circle3DFlags>(flags...))];
+        Trade::MeshAttributeData attributeData[Implementation::circle3DSolidAttributeCount(Implementation::enumSet<Circle3DFlags>(flags...))];
+    };
+    static const Storage storage;
+
+    return Trade::MeshData{MeshPrimitive::TriangleFan,
+        Trade::DataFlag::Global, Containers::arrayView(storage.vertexData),
+        Trade::meshAttributeDataNonOwningArray(storage.attributeData)};
+}
+
+/**
+@brief Solid 3D grid with static storage
+@tparam subdivisionsX   Count of subdivisions in the X direction
+@tparam subdivisionsY   Count of subdivisions in the Y direction
+@tparam flags           Flags
+@m_since_latest
+
+Equivalent to @ref grid3DSolid(const Vector2i&, GridFlags), but the data are
+stored in a statically allocated memory sized at compile time. See
+@ref circle3DSolid() for more information. Note that, unlike in the runtime
+variant, @ref GridFlag::Normals isn't implicitly enabled here and has to be
+listed explicitly.
+@see @ref uvSphereSolid()
+*/
+template<UnsignedInt subdivisionsX, UnsignedInt subdivisionsY, GridFlag ...flags> Trade::MeshData grid3DSolid() {
+    struct Storage {
+        explicit Storage() {
+            Implementation::grid3DSolidInterleavedInto({Int(subdivisionsX), Int(subdivisionsY)}, Implementation::enumSet<GridFlags>(flags...), indexData, Containers::arrayCast<char>(Containers::arrayView(vertexData)), attributeData);
+        }
+
+        UnsignedInt indexData[(subdivisionsX + 1)*(subdivisionsY + 1)*6];
+        Float vertexData[(subdivisionsX + 2)*(subdivisionsY + 2)*Implementation::grid3DSolidVertexSize(Implementation::enumSet<GridFlags>(flags...))];
+        Trade::MeshAttributeData attributeData[Implementation::grid3DSolidAttributeCount(Implementation::enumSet<GridFlags>(flags...))];
+    };
+    static const Storage storage;
+
+    return Trade::MeshData{MeshPrimitive::Triangles,
+        Trade::DataFlag::Global, Containers::arrayView(storage.indexData),
+        Trade::MeshIndexData{storage.indexData},
+        Trade::DataFlag::Global, Containers::arrayView(storage.vertexData),
+        Trade::meshAttributeDataNonOwningArray(storage.attributeData)};
+}
+
+/**
+@brief Solid 3D UV sphere with static storage
+@tparam rings       Number of (face) rings. Must be larger or equal to
+    @cpp 2 @ce.
+@tparam segments    Number of (face) segments. Must be larger or equal to
+    @cpp 3 @ce.
+@tparam flags       Flags
+@m_since_latest
+
+Equivalent to @ref uvSphereSolid(UnsignedInt, UnsignedInt, UVSphereFlags), but
+the data are stored in a statically allocated memory sized at compile time.
+See @ref circle3DSolid() for more information.
+@see @ref grid3DSolid()
+*/
+template<UnsignedInt rings, UnsignedInt segments, UVSphereFlag ...flags> Trade::MeshData uvSphereSolid() {
+    static_assert(rings >= 2 && segments >= 3, "Primitives::uvSphereSolid(): at least two rings and three segments expected");
+
+    struct Storage {
+        explicit Storage() {
+            Implementation::uvSphereSolidInterleavedInto(rings, segments, Implementation::enumSet<UVSphereFlags>(flags...), indexData, Containers::arrayCast<char>(Containers::arrayView(vertexData)), attributeData);
+        }
+
+        UnsignedInt indexData[6*segments*(rings - 1)];
+        Float vertexData[Implementation::uvSphereSolidVertexCount(rings, segments, Implementation::enumSet<UVSphereFlags>(flags...))*Implementation::uvSphereSolidVertexSize(Implementation::enumSet<UVSphereFlags>(flags...))];
+        Trade::MeshAttributeData attributeData[Implementation::uvSphereSolidAttributeCount(Implementation::enumSet<UVSphereFlags>(flags...))];
+    };
+    static const Storage storage;
+
+    return Trade::MeshData{MeshPrimitive::Triangles,
+        Trade::DataFlag::Global, Containers::arrayView(storage.indexData),
+        Trade::MeshIndexData{storage.indexData},
+        Trade::DataFlag::Global, Containers::arrayView(storage.vertexData),
+        Trade::meshAttributeDataNonOwningArray(storage.attributeData)};
+}
+
+}}
+
+#endif
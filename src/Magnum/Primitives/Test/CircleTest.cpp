@@ -24,6 +24,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 
@@ -39,6 +41,7 @@ struct CircleTest: TestSuite::Tester {
 
     void solid2D();
     void solid3D();
+    void solid3DInto();
 
     void wireframe2D();
     void wireframe3D();
@@ -66,7 +69,8 @@ CircleTest::CircleTest() {
     addInstancedTests({&CircleTest::solid2D},
         Containers::arraySize(Solid2DData));
 
-    addInstancedTests({&CircleTest::solid3D},
+    addInstancedTests({&CircleTest::solid3D,
+                       &CircleTest::solid3DInto},
         Containers::arraySize(Solid3DData));
 
     addTests({&CircleTest::wireframe2D,
@@ -172,6 +176,32 @@ void CircleTest::solid3D() {
     }
 }
 
+void CircleTest::solid3DInto() {
+    auto&& data = Solid3DData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::MeshData expected = Primitives::circle3DSolid(8, data.flags);
+
+    const UnsignedInt vertexCount = circle3DSolidVertexCount(8);
+    Containers::Array<Vector3> positions{vertexCount};
+    Containers::Array<Vector3> normals{vertexCount};
+    Containers::Array<Vector4> tangents{data.flags & Circle3DFlag::Tangents ? vertexCount : 0};
+    Containers::Array<Vector2> textureCoordinates{data.flags & Circle3DFlag::TextureCoordinates ? vertexCount : 0};
+    circle3DSolidInto(8, positions, normals, tangents, textureCoordinates);
+
+    CORRADE_COMPARE(vertexCount, expected.vertexCount());
+    CORRADE_COMPARE_AS(positions, expected.attribute<Vector3>(Trade::MeshAttribute::Position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(normals, expected.attribute<Vector3>(Trade::MeshAttribute::Normal),
+        TestSuite::Compare::Container);
+    if(data.flags & Circle3DFlag::Tangents)
+        CORRADE_COMPARE_AS(tangents, expected.attribute<Vector4>(Trade::MeshAttribute::Tangent),
+            TestSuite::Compare::Container);
+    if(data.flags & Circle3DFlag::TextureCoordinates)
+        CORRADE_COMPARE_AS(textureCoordinates, expected.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+            TestSuite::Compare::Container);
+}
+
 void CircleTest::wireframe2D() {
     Trade::MeshData circle = Primitives::circle2DWireframe(8);
 
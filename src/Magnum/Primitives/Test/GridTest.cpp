@@ -24,6 +24,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 
@@ -37,6 +39,7 @@ struct GridTest: TestSuite::Tester {
     explicit GridTest();
 
     void solid3D();
+    void solid3DInto();
     void wireframe3D();
 };
 
@@ -53,7 +56,8 @@ constexpr struct {
 };
 
 GridTest::GridTest() {
-    addInstancedTests({&GridTest::solid3D},
+    addInstancedTests({&GridTest::solid3D,
+                       &GridTest::solid3DInto},
         Containers::arraySize(Solid3DData));
 
     addTests({&GridTest::wireframe3D});
@@ -286,6 +290,36 @@ void GridTest::solid3D() {
     }), TestSuite::Compare::Container);
 }
 
+void GridTest::solid3DInto() {
+    auto&& data = Solid3DData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::MeshData expected = grid3DSolid({5, 3}, data.flags);
+
+    Containers::Array<UnsignedInt> indices{grid3DSolidIndexCount({5, 3})};
+    const UnsignedInt vertexCount = grid3DSolidVertexCount({5, 3});
+    Containers::Array<Vector3> positions{vertexCount};
+    Containers::Array<Vector3> normals{data.flags & GridFlag::Normals ? vertexCount : 0};
+    Containers::Array<Vector4> tangents{data.flags & GridFlag::Tangents ? vertexCount : 0};
+    Containers::Array<Vector2> textureCoordinates{data.flags & GridFlag::TextureCoordinates ? vertexCount : 0};
+    grid3DSolidInto({5, 3}, indices, positions, normals, tangents, textureCoordinates);
+
+    CORRADE_COMPARE(vertexCount, expected.vertexCount());
+    CORRADE_COMPARE_AS(indices, expected.indices<UnsignedInt>(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(positions, expected.attribute<Vector3>(Trade::MeshAttribute::Position),
+        TestSuite::Compare::Container);
+    if(data.flags & GridFlag::Normals)
+        CORRADE_COMPARE_AS(normals, expected.attribute<Vector3>(Trade::MeshAttribute::Normal),
+            TestSuite::Compare::Container);
+    if(data.flags & GridFlag::Tangents)
+        CORRADE_COMPARE_AS(tangents, expected.attribute<Vector4>(Trade::MeshAttribute::Tangent),
+            TestSuite::Compare::Container);
+    if(data.flags & GridFlag::TextureCoordinates)
+        CORRADE_COMPARE_AS(textureCoordinates, expected.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+            TestSuite::Compare::Container);
+}
+
 void GridTest::wireframe3D() {
     Trade::MeshData grid = grid3DWireframe({5, 3});
 
@@ -0,0 +1,183 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <type_traits>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Primitives/MeshCache.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace Primitives { namespace Test { namespace {
+
+struct MeshCacheTest: TestSuite::Tester {
+    explicit MeshCacheTest();
+
+    void uvSphereSolid();
+    void icosphereSolid();
+    void cylinderSolid();
+    void capsule3DSolid();
+
+    void differentPrimitives();
+    void clear();
+    void move();
+};
+
+MeshCacheTest::MeshCacheTest() {
+    addTests({&MeshCacheTest::uvSphereSolid,
+              &MeshCacheTest::icosphereSolid,
+              &MeshCacheTest::cylinderSolid,
+              &MeshCacheTest::capsule3DSolid,
+
+              &MeshCacheTest::differentPrimitives,
+              &MeshCacheTest::clear,
+              &MeshCacheTest::move});
+}
+
+void MeshCacheTest::uvSphereSolid() {
+    MeshCache cache;
+    CORRADE_COMPARE(cache.size(), 0);
+
+    Trade::MeshData a = cache.uvSphereSolid(3, 4);
+    CORRADE_COMPARE(cache.size(), 1);
+    CORRADE_COMPARE(a.indexDataFlags(), Trade::DataFlags{});
+    CORRADE_COMPARE(a.vertexDataFlags(), Trade::DataFlags{});
+
+    /* Same as generating it directly */
+    Trade::MeshData expected = Primitives::uvSphereSolid(3, 4);
+    CORRADE_COMPARE_AS(a.indices<UnsignedInt>(),
+        expected.indices<UnsignedInt>(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(a.attribute<Vector3>(Trade::MeshAttribute::Position),
+        expected.attribute<Vector3>(Trade::MeshAttribute::Position),
+        TestSuite::Compare::Container);
+
+    /* Same parameters return the same data */
+    Trade::MeshData b = cache.uvSphereSolid(3, 4);
+    CORRADE_COMPARE(cache.size(), 1);
+    CORRADE_COMPARE(b.vertexData().data(), a.vertexData().data());
+    CORRADE_COMPARE(b.indexData().data(), a.indexData().data());
+
+    /* Different parameters or flags are a different mesh */
+    Trade::MeshData c = cache.uvSphereSolid(4, 3);
+    Trade::MeshData d = cache.uvSphereSolid(3, 4, UVSphereFlag::TextureCoordinates);
+    CORRADE_COMPARE(cache.size(), 3);
+    CORRADE_VERIFY(c.vertexData().data() != a.vertexData().data());
+    CORRADE_VERIFY(d.vertexData().data() != a.vertexData().data());
+    CORRADE_VERIFY(d.hasAttribute(Trade::MeshAttribute::TextureCoordinates));
+}
+
+void MeshCacheTest::icosphereSolid() {
+    MeshCache cache;
+
+    Trade::MeshData a = cache.icosphereSolid(1);
+    Trade::MeshData b = cache.icosphereSolid(1);
+    Trade::MeshData c = cache.icosphereSolid(0);
+    CORRADE_COMPARE(cache.size(), 2);
+    CORRADE_COMPARE(b.vertexData().data(), a.vertexData().data());
+    CORRADE_COMPARE(a.vertexCount(), Primitives::icosphereSolid(1).vertexCount());
+    CORRADE_COMPARE(c.vertexCount(), 12);
+}
+
+void MeshCacheTest::cylinderSolid() {
+    MeshCache cache;
+
+    Trade::MeshData a = cache.cylinderSolid(2, 3, 1.5f, CylinderFlag::CapEnds);
+    Trade::MeshData b = cache.cylinderSolid(2, 3, 1.5f, CylinderFlag::CapEnds);
+    Trade::MeshData c = cache.cylinderSolid(2, 3, 1.5f);
+    Trade::MeshData d = cache.cylinderSolid(2, 3, 0.5f, CylinderFlag::CapEnds);
+    CORRADE_COMPARE(cache.size(), 3);
+    CORRADE_COMPARE(b.vertexData().data(), a.vertexData().data());
+    CORRADE_COMPARE(a.vertexCount(), Primitives::cylinderSolid(2, 3, 1.5f, CylinderFlag::CapEnds).vertexCount());
+    CORRADE_VERIFY(c.vertexCount() < a.vertexCount());
+    CORRADE_VERIFY(d.vertexData().data() != a.vertexData().data());
+}
+
+void MeshCacheTest::capsule3DSolid() {
+    MeshCache cache;
+
+    Trade::MeshData a = cache.capsule3DSolid(2, 3, 4, 0.5f);
+    Trade::MeshData b = cache.capsule3DSolid(2, 3, 4, 0.5f);
+    /* The same parameters in a different order are a different mesh */
+    Trade::MeshData c = cache.capsule3DSolid(3, 2, 4, 0.5f);
+    CORRADE_COMPARE(cache.size(), 2);
+    CORRADE_COMPARE(b.vertexData().data(), a.vertexData().data());
+    CORRADE_VERIFY(c.vertexData().data() != a.vertexData().data());
+    CORRADE_COMPARE(a.vertexCount(), Primitives::capsule3DSolid(2, 3, 4, 0.5f).vertexCount());
+}
+
+void MeshCacheTest::differentPrimitives() {
+    MeshCache cache;
+
+    /* Same parameter values for different primitives shouldn't collide */
+    Trade::MeshData a = cache.uvSphereSolid(3, 4);
+    Trade::MeshData b = cache.cylinderSolid(3, 4, 0.0f);
+    CORRADE_COMPARE(cache.size(), 2);
+    CORRADE_VERIFY(b.vertexData().data() != a.vertexData().data());
+}
+
+void MeshCacheTest::clear() {
+    MeshCache cache;
+    cache.uvSphereSolid(3, 4);
+    cache.icosphereSolid(0);
+    CORRADE_COMPARE(cache.size(), 2);
+
+    cache.clear();
+    CORRADE_COMPARE(cache.size(), 0);
+
+    /* Generated again after clearing */
+    Trade::MeshData a = cache.icosphereSolid(0);
+    CORRADE_COMPARE(cache.size(), 1);
+    CORRADE_COMPARE(a.vertexCount(), 12);
+}
+
+void MeshCacheTest::move() {
+    MeshCache a;
+    Trade::MeshData mesh = a.icosphereSolid(0);
+
+    /* The data stay at the same location after a move */
+    MeshCache b = Utility::move(a);
+    CORRADE_COMPARE(b.size(), 1);
+    CORRADE_COMPARE(b.icosphereSolid(0).vertexData().data(), mesh.vertexData().data());
+
+    MeshCache c;
+    c.uvSphereSolid(3, 4);
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.size(), 1);
+    CORRADE_COMPARE(c.icosphereSolid(0).vertexData().data(), mesh.vertexData().data());
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<MeshCache>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<MeshCache>::value);
+    CORRADE_VERIFY(!std::is_copy_constructible<MeshCache>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<MeshCache>::value);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Primitives::Test::MeshCacheTest)
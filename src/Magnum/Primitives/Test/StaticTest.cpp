@@ -0,0 +1,135 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Primitives/Static.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace Primitives { namespace Test { namespace {
+
+struct StaticTest: TestSuite::Tester {
+    explicit StaticTest();
+
+    void circle3DSolid();
+    void circle3DSolidFlags();
+    void grid3DSolid();
+    void grid3DSolidFlags();
+    void uvSphereSolid();
+    void uvSphereSolidFlags();
+
+    void sameStorage();
+
+    void compare(const Trade::MeshData& actual, const Trade::MeshData& expected);
+};
+
+StaticTest::StaticTest() {
+    addTests({&StaticTest::circle3DSolid,
+              &StaticTest::circle3DSolidFlags,
+              &StaticTest::grid3DSolid,
+              &StaticTest::grid3DSolidFlags,
+              &StaticTest::uvSphereSolid,
+              &StaticTest::uvSphereSolidFlags,
+
+              &StaticTest::sameStorage});
+}
+
+void StaticTest::compare(const Trade::MeshData& actual, const Trade::MeshData& expected) {
+    CORRADE_COMPARE(actual.primitive(), expected.primitive());
+    CORRADE_COMPARE(actual.vertexDataFlags(), Trade::DataFlag::Global);
+    CORRADE_COMPARE(actual.vertexCount(), expected.vertexCount());
+    CORRADE_COMPARE(actual.isIndexed(), expected.isIndexed());
+    if(expected.isIndexed()) {
+        CORRADE_COMPARE(actual.indexDataFlags(), Trade::DataFlag::Global);
+        CORRADE_COMPARE_AS(actual.indices<UnsignedInt>(),
+            expected.indices<UnsignedInt>(),
+            TestSuite::Compare::Container);
+    }
+
+    CORRADE_COMPARE(actual.attributeCount(), expected.attributeCount());
+    for(UnsignedInt i = 0; i != expected.attributeCount(); ++i) {
+        CORRADE_ITERATION(expected.attributeName(i));
+        CORRADE_COMPARE(actual.attributeName(i), expected.attributeName(i));
+        CORRADE_COMPARE(actual.attributeFormat(i), expected.attributeFormat(i));
+        CORRADE_COMPARE(actual.attributeOffset(i), expected.attributeOffset(i));
+        CORRADE_COMPARE(actual.attributeStride(i), expected.attributeStride(i));
+    }
+
+    CORRADE_COMPARE_AS(actual.vertexData(),
+        expected.vertexData(),
+        TestSuite::Compare::Container);
+}
+
+void StaticTest::circle3DSolid() {
+    compare(Primitives::circle3DSolid<8>(),
+            Primitives::circle3DSolid(8));
+}
+
+void StaticTest::circle3DSolidFlags() {
+    compare(Primitives::circle3DSolid<5, Circle3DFlag::TextureCoordinates, Circle3DFlag::Tangents>(),
+            Primitives::circle3DSolid(5, Circle3DFlag::TextureCoordinates|Circle3DFlag::Tangents));
+}
+
+void StaticTest::grid3DSolid() {
+    /* Unlike the runtime variant, there are no implicit normals */
+    compare(Primitives::grid3DSolid<5, 3>(),
+            Primitives::grid3DSolid({5, 3}, {}));
+}
+
+void StaticTest::grid3DSolidFlags() {
+    compare(Primitives::grid3DSolid<2, 4, GridFlag::Normals, GridFlag::TextureCoordinates, GridFlag::Tangents>(),
+            Primitives::grid3DSolid({2, 4}, GridFlag::Normals|GridFlag::TextureCoordinates|GridFlag::Tangents));
+}
+
+void StaticTest::uvSphereSolid() {
+    compare(Primitives::uvSphereSolid<3, 4>(),
+            Primitives::uvSphereSolid(3, 4));
+}
+
+void StaticTest::uvSphereSolidFlags() {
+    compare(Primitives::uvSphereSolid<4, 5, UVSphereFlag::TextureCoordinates>(),
+            Primitives::uvSphereSolid(4, 5, UVSphereFlag::TextureCoordinates));
+    compare(Primitives::uvSphereSolid<4, 5, UVSphereFlag::Tangents, UVSphereFlag::TextureCoordinates>(),
+            Primitives::uvSphereSolid(4, 5, UVSphereFlag::TextureCoordinates|UVSphereFlag::Tangents));
+}
+
+void StaticTest::sameStorage() {
+    /* Same parameters reference the same memory */
+    Trade::MeshData a = Primitives::uvSphereSolid<3, 4>();
+    Trade::MeshData b = Primitives::uvSphereSolid<3, 4>();
+    CORRADE_COMPARE(a.vertexData().data(), b.vertexData().data());
+    CORRADE_COMPARE(a.indexData().data(), b.indexData().data());
+
+    /* Different flags don't */
+    Trade::MeshData c = Primitives::uvSphereSolid<3, 4, UVSphereFlag::TextureCoordinates>();
+    CORRADE_VERIFY(c.vertexData().data() != a.vertexData().data());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Primitives::Test::StaticTest)
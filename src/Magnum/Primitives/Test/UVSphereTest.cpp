@@ -24,8 +24,12 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
 
 #include "Magnum/Math/Vector4.h"
 #include "Magnum/Primitives/UVSphere.h"
@@ -38,6 +42,8 @@ struct UVSphereTest: TestSuite::Tester {
 
     void solidWithoutTextureCoordinates();
     void solidWithTextureCoordinatesOrTangents();
+    void solidInto();
+    void solidIntoInvalidSize();
     void wireframe();
 };
 
@@ -50,13 +56,28 @@ constexpr struct {
     {"both", UVSphereFlag::TextureCoordinates|UVSphereFlag::Tangents}
 };
 
+constexpr struct {
+    const char* name;
+    UVSphereFlags flags;
+} SolidIntoData[] {
+    {"", {}},
+    {"texture coordinates", UVSphereFlag::TextureCoordinates},
+    {"tangents", UVSphereFlag::Tangents},
+    {"both", UVSphereFlag::TextureCoordinates|UVSphereFlag::Tangents}
+};
+
 UVSphereTest::UVSphereTest() {
     addTests({&UVSphereTest::solidWithoutTextureCoordinates});
 
     addInstancedTests({&UVSphereTest::solidWithTextureCoordinatesOrTangents},
         Containers::arraySize(TextureCoordinatesOrTangentsData));
 
-    addTests({&UVSphereTest::wireframe});
+    addInstancedTests({&UVSphereTest::solidInto},
+        Containers::arraySize(SolidIntoData));
+
+    addTests({&UVSphereTest::solidIntoInvalidSize,
+
+              &UVSphereTest::wireframe});
 }
 
 void UVSphereTest::solidWithoutTextureCoordinates() {
@@ -182,6 +203,65 @@ void UVSphereTest::solidWithTextureCoordinatesOrTangents() {
     }), TestSuite::Compare::Container);
 }
 
+void UVSphereTest::solidInto() {
+    auto&& data = SolidIntoData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::MeshData expected = uvSphereSolid(5, 7, data.flags);
+
+    /* Deliberately not interleaved to verify arbitrary layouts work */
+    Containers::Array<UnsignedInt> indices{uvSphereSolidIndexCount(5, 7)};
+    const UnsignedInt vertexCount = uvSphereSolidVertexCount(5, 7, data.flags);
+    Containers::Array<Vector3> positions{vertexCount};
+    Containers::Array<Vector3> normals{vertexCount};
+    Containers::Array<Vector4> tangents{data.flags & UVSphereFlag::Tangents ? vertexCount : 0};
+    Containers::Array<Vector2> textureCoordinates{data.flags & UVSphereFlag::TextureCoordinates ? vertexCount : 0};
+    uvSphereSolidInto(5, 7, indices, positions, normals, tangents, textureCoordinates);
+
+    CORRADE_COMPARE(indices.size(), expected.indexCount());
+    CORRADE_COMPARE(vertexCount, expected.vertexCount());
+    CORRADE_COMPARE_AS(indices, expected.indices<UnsignedInt>(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(positions, expected.attribute<Vector3>(Trade::MeshAttribute::Position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(normals, expected.attribute<Vector3>(Trade::MeshAttribute::Normal),
+        TestSuite::Compare::Container);
+    if(data.flags & UVSphereFlag::Tangents)
+        CORRADE_COMPARE_AS(tangents, expected.attribute<Vector4>(Trade::MeshAttribute::Tangent),
+            TestSuite::Compare::Container);
+    if(data.flags & UVSphereFlag::TextureCoordinates)
+        CORRADE_COMPARE_AS(textureCoordinates, expected.attribute<Vector2>(Trade::MeshAttribute::TextureCoordinates),
+            TestSuite::Compare::Container);
+}
+
+void UVSphereTest::solidIntoInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UnsignedInt indices[36];
+    UnsignedInt indicesInvalid[35];
+    Vector3 positions[8];
+    Vector3 positionsInvalid[9];
+    Vector3 normals[8];
+    Vector4 tangents[11];
+    Vector2 textureCoordinates[11];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    uvSphereSolidInto(1, 3, indices, positions, normals, nullptr, nullptr);
+    uvSphereSolidInto(3, 3, indicesInvalid, positions, normals, nullptr, nullptr);
+    uvSphereSolidInto(3, 3, indices, positionsInvalid, normals, nullptr, nullptr);
+    /* The view sizes are fine for a sphere without tangents or texture
+       coordinates, but not with them */
+    uvSphereSolidInto(3, 3, indices, positions, normals, tangents, nullptr);
+    uvSphereSolidInto(3, 3, indices, positions, normals, nullptr, textureCoordinates);
+    CORRADE_COMPARE(out.str(),
+        "Primitives::uvSphereSolidInto(): at least two rings and three segments expected\n"
+        "Primitives::uvSphereSolidInto(): expected 36 indices but got 35\n"
+        "Primitives::uvSphereSolidInto(): expected 8 positions and normals but got 9 and 8\n"
+        "Primitives::uvSphereSolidInto(): expected 10 positions and normals but got 8 and 8\n"
+        "Primitives::uvSphereSolidInto(): expected 10 positions and normals but got 8 and 8\n");
+}
+
 void UVSphereTest::wireframe() {
     Trade::MeshData sphere = uvSphereWireframe(6, 8);
 
@@ -30,17 +30,14 @@
 #include "Magnum/Math/Color.h"
 #include "Magnum/Primitives/Implementation/Spheroid.h"
 #include "Magnum/Primitives/Implementation/WireframeSpheroid.h"
+#include "Magnum/Primitives/Static.h"
 #include "Magnum/Trade/MeshData.h"
 
 namespace Magnum { namespace Primitives {
 
-Trade::MeshData uvSphereSolid(const UnsignedInt rings, const UnsignedInt segments, const UVSphereFlags flags) {
-    CORRADE_ASSERT(rings >= 2 && segments >= 3,
-        "Primitives::uvSphereSolid(): at least two rings and three segments expected",
-        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
-
-    Implementation::Spheroid sphere(segments, Implementation::Spheroid::Flag(UnsignedByte(flags)));
+namespace {
 
+void fillUVSphereSolid(Implementation::Spheroid& sphere, const UnsignedInt rings) {
     Float textureCoordsVIncrement = 1.0f/rings;
     Rad ringAngleIncrement(Constants::pi()/rings);
 
@@ -57,7 +54,100 @@ Trade::MeshData uvSphereSolid(const UnsignedInt rings, const UnsignedInt segment
     sphere.bottomFaceRing();
     sphere.faceRings(rings-2);
     sphere.topFaceRing();
+}
+
+}
+
+UnsignedInt uvSphereSolidVertexCount(const UnsignedInt rings, const UnsignedInt segments, const UVSphereFlags flags) {
+    return Implementation::uvSphereSolidVertexCount(rings, segments, flags);
+}
+
+UnsignedInt uvSphereSolidIndexCount(const UnsignedInt rings, const UnsignedInt segments) {
+    return 6*segments*(rings - 1);
+}
 
+void uvSphereSolidInto(const UnsignedInt rings, const UnsignedInt segments, const Containers::ArrayView<UnsignedInt>& indices, const Containers::StridedArrayView1D<Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Containers::StridedArrayView1D<Vector4>& tangents, const Containers::StridedArrayView1D<Vector2>& textureCoordinates) {
+    CORRADE_ASSERT(rings >= 2 && segments >= 3,
+        "Primitives::uvSphereSolidInto(): at least two rings and three segments expected", );
+    #ifndef CORRADE_NO_ASSERT
+    const UnsignedInt indexCount = uvSphereSolidIndexCount(rings, segments);
+    const UnsignedInt vertexCount = uvSphereSolidVertexCount(rings, segments,
+        (tangents.isEmpty() ? UVSphereFlags{} : UVSphereFlag::Tangents)|
+        (textureCoordinates.isEmpty() ? UVSphereFlags{} : UVSphereFlag::TextureCoordinates));
+    #endif
+    CORRADE_ASSERT(indices.size() == indexCount,
+        "Primitives::uvSphereSolidInto(): expected" << indexCount << "indices but got" << indices.size(), );
+    CORRADE_ASSERT(positions.size() == vertexCount && normals.size() == vertexCount,
+        "Primitives::uvSphereSolidInto(): expected" << vertexCount << "positions and normals but got" << positions.size() << "and" << normals.size(), );
+    CORRADE_ASSERT(tangents.isEmpty() || tangents.size() == vertexCount,
+        "Primitives::uvSphereSolidInto(): expected" << vertexCount << "tangents but got" << tangents.size(), );
+    CORRADE_ASSERT(textureCoordinates.isEmpty() || textureCoordinates.size() == vertexCount,
+        "Primitives::uvSphereSolidInto(): expected" << vertexCount << "texture coordinates but got" << textureCoordinates.size(), );
+
+    Implementation::Spheroid sphere{segments, indices, positions, normals, tangents, textureCoordinates};
+    fillUVSphereSolid(sphere, rings);
+}
+
+namespace Implementation {
+
+void uvSphereSolidInterleavedInto(const UnsignedInt rings, const UnsignedInt segments, const UVSphereFlags flags, const Containers::ArrayView<UnsignedInt> indexData, const Containers::ArrayView<char> vertexData, const Containers::ArrayView<Trade::MeshAttributeData> attributeData) {
+    const std::size_t vertexCount = uvSphereSolidVertexCount(rings, segments, flags);
+    const std::size_t stride = uvSphereSolidVertexSize(flags)*sizeof(Float);
+    CORRADE_INTERNAL_ASSERT(vertexData.size() == vertexCount*stride);
+    CORRADE_INTERNAL_ASSERT(attributeData.size() == uvSphereSolidAttributeCount(flags));
+
+    std::size_t attributeIndex = 0;
+    std::size_t attributeOffset = 0;
+
+    Containers::StridedArrayView1D<Vector3> positions{vertexData,
+        reinterpret_cast<Vector3*>(vertexData.data() + attributeOffset),
+        vertexCount, std::ptrdiff_t(stride)};
+    attributeData[attributeIndex++] = Trade::MeshAttributeData{
+        Trade::MeshAttribute::Position, positions};
+    attributeOffset += sizeof(Vector3);
+
+    Containers::StridedArrayView1D<Vector3> normals{vertexData,
+        reinterpret_cast<Vector3*>(vertexData.data() + attributeOffset),
+        vertexCount, std::ptrdiff_t(stride)};
+    attributeData[attributeIndex++] = Trade::MeshAttributeData{
+        Trade::MeshAttribute::Normal, normals};
+    attributeOffset += sizeof(Vector3);
+
+    Containers::StridedArrayView1D<Vector4> tangents;
+    if(flags & UVSphereFlag::Tangents) {
+        tangents = Containers::StridedArrayView1D<Vector4>{vertexData,
+            reinterpret_cast<Vector4*>(vertexData.data() + attributeOffset),
+            vertexCount, std::ptrdiff_t(stride)};
+        attributeData[attributeIndex++] = Trade::MeshAttributeData{
+            Trade::MeshAttribute::Tangent, tangents};
+        attributeOffset += sizeof(Vector4);
+    }
+
+    Containers::StridedArrayView1D<Vector2> textureCoordinates;
+    if(flags & UVSphereFlag::TextureCoordinates) {
+        textureCoordinates = Containers::StridedArrayView1D<Vector2>{vertexData,
+            reinterpret_cast<Vector2*>(vertexData.data() + attributeOffset),
+            vertexCount, std::ptrdiff_t(stride)};
+        attributeData[attributeIndex++] = Trade::MeshAttributeData{
+            Trade::MeshAttribute::TextureCoordinates, textureCoordinates};
+        attributeOffset += sizeof(Vector2);
+    }
+
+    CORRADE_INTERNAL_ASSERT(attributeIndex == attributeData.size());
+    CORRADE_INTERNAL_ASSERT(attributeOffset == stride);
+
+    Primitives::uvSphereSolidInto(rings, segments, indexData, positions, normals, tangents, textureCoordinates);
+}
+
+}
+
+Trade::MeshData uvSphereSolid(const UnsignedInt rings, const UnsignedInt segments, const UVSphereFlags flags) {
+    CORRADE_ASSERT(rings >= 2 && segments >= 3,
+        "Primitives::uvSphereSolid(): at least two rings and three segments expected",
+        (Trade::MeshData{MeshPrimitive::Triangles, 0}));
+
+    Implementation::Spheroid sphere(segments, Implementation::Spheroid::Flag(UnsignedByte(flags)));
+    fillUVSphereSolid(sphere, rings);
     return sphere.finalize();
 }
 
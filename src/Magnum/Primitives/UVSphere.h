@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::Primitives::uvSphereSolid(), @ref Magnum::Primitives::uvSphereWireframe()
+ * @brief Class @ref Magnum::Primitives::uvSphereSolid(), @ref Magnum::Primitives::uvSphereSolidInto(), @ref Magnum::Primitives::uvSphereSolidVertexCount(), @ref Magnum::Primitives::uvSphereSolidIndexCount(), @ref Magnum::Primitives::uvSphereWireframe()
  */
 
 #include <Corrade/Containers/EnumSet.h>
@@ -84,10 +84,60 @@ generated, vertices of one segment are duplicated for texture wrapping.
 
 @image html primitives-uvspheresolid.png width=256px
 
-@see @ref icosphereSolid()
+@see @ref icosphereSolid(), @ref uvSphereSolidInto()
 */
 MAGNUM_PRIMITIVES_EXPORT Trade::MeshData uvSphereSolid(UnsignedInt rings, UnsignedInt segments, UVSphereFlags flags = {});
 
+/**
+@brief Vertex count of a solid 3D UV sphere
+@m_since_latest
+
+If @p flags contain @ref UVSphereFlag::TextureCoordinates or
+@ref UVSphereFlag::Tangents, vertices of one segment are duplicated, which is
+accounted for in the returned value. Used for sizing views passed to
+@ref uvSphereSolidInto().
+*/
+MAGNUM_PRIMITIVES_EXPORT UnsignedInt uvSphereSolidVertexCount(UnsignedInt rings, UnsignedInt segments, UVSphereFlags flags = {});
+
+/**
+@brief Index count of a solid 3D UV sphere
+@m_since_latest
+
+Returns @cpp 6*segments*(rings - 1) @ce, i.e. the size of the index view
+expected by @ref uvSphereSolidInto().
+*/
+MAGNUM_PRIMITIVES_EXPORT UnsignedInt uvSphereSolidIndexCount(UnsignedInt rings, UnsignedInt segments);
+
+/**
+@brief Fill a solid 3D UV sphere into existing views
+@param[in]  rings       Number of (face) rings. Must be larger or equal to
+    @cpp 2 @ce.
+@param[in]  segments    Number of (face) segments. Must be larger or equal to
+    @cpp 3 @ce.
+@param[out] indices     Where to put indices
+@param[out] positions   Where to put positions
+@param[out] normals     Where to put normals
+@param[out] tangents    Where to put tangents. Can be empty, in which case
+    tangents aren't generated.
+@param[out] textureCoordinates Where to put texture coordinates. Can be
+    empty, in which case texture coordinates aren't generated.
+@m_since_latest
+
+Produces the same data as @ref uvSphereSolid(), but instead of allocating a
+@ref Trade::MeshData and interleaving the attributes writes them directly to
+given views, which can point for example to a mapped GPU buffer. The
+@p indices view is expected to have @ref uvSphereSolidIndexCount() items,
+@p positions, @p normals and all non-empty vertex views
+@ref uvSphereSolidVertexCount() items, with @ref UVSphereFlag::Tangents and
+@ref UVSphereFlag::TextureCoordinates included in the flags if the
+@p tangents or @p textureCoordinates views are non-empty. The indices
+describe a @ref MeshPrimitive::Triangles mesh.
+
+@snippet Primitives.cpp uvSphereSolidInto
+@see @ref circle3DSolidInto(), @ref grid3DSolidInto()
+*/
+MAGNUM_PRIMITIVES_EXPORT void uvSphereSolidInto(UnsignedInt rings, UnsignedInt segments, const Containers::ArrayView<UnsignedInt>& indices, const Containers::StridedArrayView1D<Vector3>& positions, const Containers::StridedArrayView1D<Vector3>& normals, const Containers::StridedArrayView1D<Vector4>& tangents, const Containers::StridedArrayView1D<Vector2>& textureCoordinates);
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /**
 @brief Whether to generate UV sphere texture coordinates
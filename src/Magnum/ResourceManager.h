@@ -30,7 +30,7 @@
  * @brief Class @ref Magnum::ResourceManager, @ref Magnum::ResourceDataState, @ref Magnum::ResourcePolicy
  */
 
-#include <unordered_map>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Pointer.h>
 
 #include "Magnum/Resource.h"
@@ -87,7 +87,18 @@ enum class ResourcePolicy: UnsignedByte {
     Manual,
 
     /** The resource will be unloaded when last reference to it is gone. */
-    ReferenceCounted
+    ReferenceCounted,
+
+    /**
+     * The resource will stay loaded after the last reference to it is gone
+     * and will be unloaded only if the memory budget for given resource
+     * type is exceeded, with the least recently released resources
+     * unloaded first. It can be also unloaded by calling
+     * @ref ResourceManager::free() if nothing references it. See
+     * @ref ResourceManager-memory-budget for more information.
+     * @m_since_latest
+     */
+    Cached
 };
 
 template<class> class AbstractResourceLoader;
@@ -111,7 +122,7 @@ template<class T> class ResourceManagerData {
 
         std::size_t lastChange() const { return _lastChange; }
 
-        std::size_t count() const { return _data.size(); }
+        std::size_t count() const { return _count; }
 
         std::size_t referenceCount(ResourceKey key) const;
 
@@ -119,7 +130,15 @@ template<class T> class ResourceManagerData {
 
         template<class U> Resource<T, U> get(ResourceKey key);
 
-        void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy);
+        void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size = 0);
+
+        std::size_t size(ResourceKey key) const;
+
+        std::size_t memoryUsage() const { return _memoryUsage; }
+
+        std::size_t memoryBudget() const { return _memoryBudget; }
+
+        void setMemoryBudget(std::size_t budget);
 
         T* fallback() { return _fallback; }
         const T* fallback() const { return _fallback; }
@@ -128,7 +147,7 @@ template<class T> class ResourceManagerData {
 
         void free();
 
-        void clear() { _data.clear(); }
+        void clear();
 
         AbstractResourceLoader<T>* loader() { return _loader; }
         const AbstractResourceLoader<T>* loader() const { return _loader; }
@@ -138,23 +157,62 @@ template<class T> class ResourceManagerData {
         void setLoader(AbstractResourceLoader<T>* loader);
 
     protected:
-        ResourceManagerData(): _fallback(nullptr), _loader(nullptr), _lastChange(0) {}
+        ResourceManagerData(): _count(0), _fallback(nullptr), _loader(nullptr), _lastChange(0), _memoryUsage(0), _memoryBudget(~std::size_t{}), _lastRelease(0) {}
 
     private:
         struct Data;
 
-        const Data& data(ResourceKey key) { return _data[key]; }
+        /* Marks an empty bucket in _index or a missing resource */
+        enum: UnsignedInt { NoSlot = ~UnsignedInt{} };
+
+        static std::size_t hash(ResourceKey key) {
+            return std::hash<ResourceKey>{}(key);
+        }
 
-        void incrementReferenceCount(ResourceKey key) {
-            ++_data[key].referenceCount;
+        /* Returns NoSlot if the key isn't there */
+        UnsignedInt find(ResourceKey key) const;
+        UnsignedInt findOrInsert(ResourceKey key);
+        void erase(UnsignedInt slot);
+        /* Rebuilds _index with given power-of-two bucket count */
+        void rehash(std::size_t bucketCount);
+
+        const Data& data(UnsignedInt slot) const { return _slots[slot]; }
+
+        /* Used by Resource, which then refers to the resource by the slot
+           index and doesn't need to hash the key anymore */
+        UnsignedInt referenceSlot(ResourceKey key) {
+            const UnsignedInt slot = findOrInsert(key);
+            ++_slots[slot].referenceCount;
+            return slot;
         }
 
-        void decrementReferenceCount(ResourceKey key);
+        void incrementReferenceCount(UnsignedInt slot) {
+            ++_slots[slot].referenceCount;
+        }
 
-        std::unordered_map<ResourceKey, Data> _data;
+        void decrementReferenceCount(UnsignedInt slot);
+
+        /* Unloads least recently released unreferenced cached resources
+           until the usage fits into the budget */
+        void evict();
+
+        /* Resource data. Indices are stable for the whole lifetime of the
+           resource, which is guaranteed to be alive at least as long as
+           anything references it. Unused slots are in _freeSlots. */
+        Containers::Array<Data> _slots;
+        Containers::Array<UnsignedInt> _freeSlots;
+        /* Open-addressing hash table with linear probing, containing
+           indices into _slots. Bucket count is a power of two and the table
+           is at most half full. */
+        Containers::Array<UnsignedInt> _index;
+        std::size_t _count;
         T* _fallback;
         AbstractResourceLoader<T>* _loader;
         std::size_t _lastChange;
+        std::size_t _memoryUsage, _memoryBudget;
+        /* Incremented every time a cached resource loses its last
+           reference, used for LRU ordering */
+        std::size_t _lastRelease;
 };
 
 /* Helper class for defining which real types are in the type pack */
@@ -186,7 +244,9 @@ The resources can be managed in three ways - resident resources, which stay in
 memory for whole lifetime of the manager, manually managed resources, which
 can be deleted by calling @ref free() if nothing references them anymore, and
 reference counted resources, which are deleted as soon as the last reference
-to them is removed.
+to them is removed. Additionally, cached resources stay in memory after the
+last reference is removed and are deleted only when exceeding a memory budget,
+see @ref ResourceManager-memory-budget below.
 
 Resource state and policy is configured when setting the resource data in
 @ref set() and can be changed each time the data are updated, although already
@@ -219,6 +279,28 @@ Basic usage is:
 </li>
 </ul>
 
+@section ResourceManager-memory-budget Memory budget and cached resources
+
+Resources with @ref ResourcePolicy::ReferenceCounted get deleted as soon as
+nothing references them, which may lead to the same resource being loaded
+over and over again if it's used only intermittently.
+@ref ResourcePolicy::Manual resources on the other hand stay in memory until
+@ref free() is called, potentially taking up more memory than desired.
+
+@ref ResourcePolicy::Cached resources are a middle ground --- they stay in
+memory after the last reference is gone, but if the total size of resources of
+given type exceeds a budget set via @ref setMemoryBudget(), unreferenced cached
+resources are deleted in the order they were released, oldest first. The
+resource size is passed to @ref set() and the total is available through
+@ref memoryUsage():
+
+@snippet Magnum.cpp ResourceManager-memory-budget
+
+Sizes of resources with other policies are counted into the usage as well, but
+only cached resources are deleted when the budget is exceeded, so the usage
+can still stay above the budget if the remaining resources are referenced or
+resident.
+
 @see @ref AbstractResourceLoader
 */
 /* Due to too much work involved with explicit template instantiation (all
@@ -275,6 +357,58 @@ template<class... Types> class ResourceManager: private Implementation::Resource
             return this->Implementation::ResourceManagerData<T>::state(key);
         }
 
+        /**
+         * @brief Size of given resource
+         * @m_since_latest
+         *
+         * Size passed to @ref set(), or @cpp 0 @ce if the resource isn't
+         * loaded or no size was passed for it.
+         * @see @ref memoryUsage()
+         */
+        template<class T> std::size_t size(ResourceKey key) const {
+            return this->Implementation::ResourceManagerData<T>::size(key);
+        }
+
+        /**
+         * @brief Memory usage of resources of given type
+         * @m_since_latest
+         *
+         * Sum of sizes passed to @ref set() for all currently loaded
+         * resources of given type, regardless of their policy.
+         * @see @ref size(), @ref memoryBudget()
+         */
+        template<class T> std::size_t memoryUsage() const {
+            return this->Implementation::ResourceManagerData<T>::memoryUsage();
+        }
+
+        /**
+         * @brief Memory budget for resources of given type
+         * @m_since_latest
+         *
+         * @see @ref setMemoryBudget()
+         */
+        template<class T> std::size_t memoryBudget() const {
+            return this->Implementation::ResourceManagerData<T>::memoryBudget();
+        }
+
+        /**
+         * @brief Set memory budget for resources of given type
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * If @ref memoryUsage() exceeds @p bytes, unreferenced resources with
+         * @ref ResourcePolicy::Cached are deleted, least recently released
+         * first, until the usage fits into the budget. This is done
+         * immediately in this function and then every time the usage grows
+         * or a cached resource loses its last reference. Default is
+         * unlimited, i.e. @cpp ~std::size_t{} @ce. See
+         * @ref ResourceManager-memory-budget for more information.
+         */
+        template<class T> ResourceManager<Types...>& setMemoryBudget(std::size_t bytes) {
+            this->Implementation::ResourceManagerData<T>::setMemoryBudget(bytes);
+            return *this;
+        }
+
         /**
          * @brief Set resource data
          * @return Reference to self (for method chaining)
@@ -292,6 +426,31 @@ template<class... Types> class ResourceManager: private Implementation::Resource
             return *this;
         }
 
+        /**
+         * @brief Set resource data with a size
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Same as @ref set(ResourceKey, T*, ResourceDataState, ResourcePolicy),
+         * but additionally records @p size of the resource, which is then
+         * counted into @ref memoryUsage(). Note that setting the size makes
+         * sense only if the data are not @cpp nullptr @ce.
+         * @see @ref ResourceManager-memory-budget
+         */
+        template<class T> ResourceManager<Types...>& set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size) {
+            this->Implementation::ResourceManagerData<T>::set(key, data, state, policy, size);
+            return *this;
+        }
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        template<class T> ResourceManager<Types...>& set(ResourceKey key, Containers::Pointer<T>&& data, ResourceDataState state, ResourcePolicy policy, std::size_t size) {
+            set(key, data.release(), state, policy, size);
+            return *this;
+        }
+
         /**
          * @overload
          * @m_since{2019,10}
@@ -464,65 +623,200 @@ template<class T> ResourceManagerData<T>::~ResourceManagerData() {
     safeDelete(_fallback);
 }
 
+template<class T> UnsignedInt ResourceManagerData<T>::find(const ResourceKey key) const {
+    if(_index.isEmpty()) return NoSlot;
+
+    const std::size_t mask = _index.size() - 1;
+    for(std::size_t i = hash(key) & mask; ; i = (i + 1) & mask) {
+        const UnsignedInt slot = _index[i];
+        if(slot == NoSlot || _slots[slot].key == key) return slot;
+    }
+}
+
+template<class T> UnsignedInt ResourceManagerData<T>::findOrInsert(const ResourceKey key) {
+    const UnsignedInt found = find(key);
+    if(found != NoSlot) return found;
+
+    /* Keep the table at most half full */
+    if((_count + 1)*2 > _index.size())
+        rehash(_index.isEmpty() ? 16 : _index.size()*2);
+
+    /* Reuse a free slot, if there's any */
+    UnsignedInt slot;
+    if(!_freeSlots.isEmpty()) {
+        slot = _freeSlots[_freeSlots.size() - 1];
+        arrayRemoveSuffix(_freeSlots);
+    } else {
+        slot = UnsignedInt(_slots.size());
+        arrayAppend(_slots, InPlaceInit);
+    }
+    _slots[slot].key = key;
+    _slots[slot].used = true;
+    ++_count;
+
+    const std::size_t mask = _index.size() - 1;
+    std::size_t i = hash(key) & mask;
+    while(_index[i] != NoSlot) i = (i + 1) & mask;
+    _index[i] = slot;
+
+    return slot;
+}
+
+template<class T> void ResourceManagerData<T>::rehash(const std::size_t bucketCount) {
+    _index = Containers::Array<UnsignedInt>{DirectInit, bucketCount, UnsignedInt(NoSlot)};
+
+    const std::size_t mask = bucketCount - 1;
+    for(std::size_t slot = 0; slot != _slots.size(); ++slot) {
+        if(!_slots[slot].used) continue;
+
+        std::size_t i = hash(_slots[slot].key) & mask;
+        while(_index[i] != NoSlot) i = (i + 1) & mask;
+        _index[i] = UnsignedInt(slot);
+    }
+}
+
+template<class T> void ResourceManagerData<T>::erase(const UnsignedInt slot) {
+    Data& data = _slots[slot];
+    const std::size_t mask = _index.size() - 1;
+
+    std::size_t i = hash(data.key) & mask;
+    while(_index[i] != slot) i = (i + 1) & mask;
+
+    /* Backward shift deletion -- move all following entries of the probe
+       sequence that aren't in their home bucket to the hole, so there's no
+       need for tombstones */
+    for(std::size_t j = i; ; ) {
+        j = (j + 1) & mask;
+        if(_index[j] == NoSlot) break;
+
+        /* Move the entry if its home bucket isn't cyclically in (i, j] */
+        const std::size_t home = hash(_slots[_index[j]].key) & mask;
+        if(i <= j ? (home <= i || home > j) : (home <= i && home > j)) {
+            _index[i] = _index[j];
+            i = j;
+        }
+    }
+    _index[i] = NoSlot;
+
+    _memoryUsage -= data.size;
+    data.reset();
+    arrayAppend(_freeSlots, slot);
+    --_count;
+}
+
 template<class T> std::size_t ResourceManagerData<T>::referenceCount(const ResourceKey key) const {
-    auto it = _data.find(key);
-    if(it == _data.end()) return 0;
-    return it->second.referenceCount;
+    const UnsignedInt slot = find(key);
+    if(slot == NoSlot) return 0;
+    return _slots[slot].referenceCount;
 }
 
 template<class T> ResourceState ResourceManagerData<T>::state(const ResourceKey key) const {
-    const auto it = _data.find(key);
+    const UnsignedInt slot = find(key);
+    const Data* const data = slot == NoSlot ? nullptr : &_slots[slot];
 
     /* Resource not loaded */
-    if(it == _data.end() || !it->second.data) {
+    if(!data || !data->data) {
         /* Fallback found, add *Fallback to state */
         if(_fallback) {
-            if(it != _data.end() && it->second.state == ResourceDataState::Loading)
+            if(data && data->state == ResourceDataState::Loading)
                 return ResourceState::LoadingFallback;
-            else if(it != _data.end() && it->second.state == ResourceDataState::NotFound)
+            else if(data && data->state == ResourceDataState::NotFound)
                 return ResourceState::NotFoundFallback;
             else return ResourceState::NotLoadedFallback;
         }
 
         /* Fallback not found, loading didn't start yet */
-        if(it == _data.end() || (it->second.state != ResourceDataState::Loading && it->second.state != ResourceDataState::NotFound))
+        if(!data || (data->state != ResourceDataState::Loading && data->state != ResourceDataState::NotFound))
             return ResourceState::NotLoaded;
     }
 
     /* Loading / NotFound without fallback, Mutable / Final */
-    return static_cast<ResourceState>(it->second.state);
+    return static_cast<ResourceState>(data->state);
 }
 
 template<class T> template<class U> Resource<T, U> ResourceManagerData<T>::get(ResourceKey key) {
-    /* Ask loader for the data, if they aren't there yet */
-    if(_loader && _data.find(key) == _data.end())
-        _loader->load(key);
+    /* Ask loader for the data, if they aren't there yet. If they're being
+       loaded already, for example because they were only prefetched, let
+       the loader know they're needed now. */
+    if(_loader) {
+        const UnsignedInt found = find(key);
+        if(found == NoSlot)
+            _loader->load(key);
+        else if(_slots[found].state == ResourceDataState::Loading)
+            _loader->promote(key);
+    }
 
     return Resource<T, U>(this, key);
 }
 
-template<class T> void ResourceManagerData<T>::set(const ResourceKey key, T* const data, const ResourceDataState state, const ResourcePolicy policy) {
-    auto it = _data.find(key);
+template<class T> void ResourceManagerData<T>::set(const ResourceKey key, T* const data, const ResourceDataState state, const ResourcePolicy policy, const std::size_t size) {
+    const UnsignedInt found = find(key);
 
     /* NotFound / Loading state shouldn't have any data */
     CORRADE_ASSERT((data == nullptr) == (state == ResourceDataState::NotFound || state == ResourceDataState::Loading),
         "ResourceManager::set(): data should be null if and only if state is NotFound or Loading", );
 
     /* Cannot change resource with already final state */
-    CORRADE_ASSERT(it == _data.end() || it->second.state != ResourceDataState::Final,
+    CORRADE_ASSERT(found == NoSlot || _slots[found].state != ResourceDataState::Final,
         "ResourceManager::set(): cannot change already final resource" << key, );
 
+    /* Size of a null resource makes no sense */
+    CORRADE_ASSERT(data || !size,
+        "ResourceManager::set(): size should be zero if data is null", );
+
     /* Insert the resource, if not already there */
-    if(it == _data.end())
-        it = _data.emplace(key, Data()).first;
+    const UnsignedInt slot = found == NoSlot ? findOrInsert(key) : found;
+    Data& d = _slots[slot];
 
     /* Otherwise delete previous data */
-    else safeDelete(it->second.data);
+    if(found != NoSlot) {
+        safeDelete(d.data);
+        _memoryUsage -= d.size;
+    }
 
-    it->second.data = data;
-    it->second.state = state;
-    it->second.policy = policy;
+    d.data = data;
+    d.state = state;
+    d.policy = policy;
+    d.size = size;
+    _memoryUsage += size;
+    /* A cached resource that's not referenced yet is treated as released
+       right now, so it doesn't get evicted before older ones */
+    if(!d.referenceCount) d.lastRelease = ++_lastRelease;
     ++_lastChange;
+
+    if(_memoryUsage > _memoryBudget) evict();
+}
+
+template<class T> std::size_t ResourceManagerData<T>::size(const ResourceKey key) const {
+    const UnsignedInt slot = find(key);
+    if(slot == NoSlot) return 0;
+    return _slots[slot].size;
+}
+
+template<class T> void ResourceManagerData<T>::setMemoryBudget(const std::size_t budget) {
+    _memoryBudget = budget;
+    if(_memoryUsage > _memoryBudget) evict();
+}
+
+template<class T> void ResourceManagerData<T>::evict() {
+    while(_memoryUsage > _memoryBudget) {
+        /* Find the least recently released unreferenced cached resource. A
+           linear scan, assuming the evictions are rare compared to lookups
+           and thus not worth maintaining a separate LRU list for. */
+        UnsignedInt lru = NoSlot;
+        for(std::size_t slot = 0; slot != _slots.size(); ++slot) {
+            const Data& d = _slots[slot];
+            if(!d.used || d.policy != ResourcePolicy::Cached || d.referenceCount || !d.data)
+                continue;
+            if(lru == NoSlot || d.lastRelease < _slots[lru].lastRelease)
+                lru = UnsignedInt(slot);
+        }
+
+        /* Nothing else to evict, the rest is referenced or not cached */
+        if(lru == NoSlot) break;
+
+        erase(lru);
+    }
 }
 
 template<class T> void ResourceManagerData<T>::setFallback(T* const data) {
@@ -535,13 +829,21 @@ template<class T> void ResourceManagerData<T>::setFallback(T* const data) {
 
 template<class T> void ResourceManagerData<T>::free() {
     /* Delete all non-referenced non-resident resources */
-    for(auto it = _data.begin(); it != _data.end(); ) {
-        if(it->second.policy != ResourcePolicy::Resident && !it->second.referenceCount)
-            it = _data.erase(it);
-        else ++it;
+    for(std::size_t slot = 0; slot != _slots.size(); ++slot) {
+        const Data& d = _slots[slot];
+        if(d.used && d.policy != ResourcePolicy::Resident && !d.referenceCount)
+            erase(UnsignedInt(slot));
     }
 }
 
+template<class T> void ResourceManagerData<T>::clear() {
+    _slots = {};
+    _freeSlots = {};
+    _index = {};
+    _count = 0;
+    _memoryUsage = 0;
+}
+
 template<class T> void ResourceManagerData<T>::setLoader(AbstractResourceLoader<T>* const loader) {
     /* Delete previous loader */
     delete _loader;
@@ -557,23 +859,33 @@ template<class T> void ResourceManagerData<T>::freeLoader() {
     delete _loader;
 }
 
-template<class T> void ResourceManagerData<T>::decrementReferenceCount(ResourceKey key) {
-    auto it = _data.find(key);
-    CORRADE_INTERNAL_ASSERT(it != _data.end());
+template<class T> void ResourceManagerData<T>::decrementReferenceCount(const UnsignedInt slot) {
+    CORRADE_INTERNAL_ASSERT(slot < _slots.size() && _slots[slot].used);
+    Data& d = _slots[slot];
+
+    if(--d.referenceCount) return;
 
     /* Free the resource if it is reference counted */
-    if(--it->second.referenceCount == 0 && it->second.policy == ResourcePolicy::ReferenceCounted)
-        _data.erase(it);
+    if(d.policy == ResourcePolicy::ReferenceCounted) {
+        erase(slot);
+
+    /* Or remember when it was released if it's cached, and evict the least
+       recently released ones if over the budget */
+    } else if(d.policy == ResourcePolicy::Cached) {
+        d.lastRelease = ++_lastRelease;
+        if(_memoryUsage > _memoryBudget) evict();
+    }
 }
 
 template<class T> struct ResourceManagerData<T>::Data {
-    Data(): data(nullptr), state(ResourceDataState::Mutable), policy(ResourcePolicy::Manual), referenceCount(0) {}
+    Data(): data(nullptr), state(ResourceDataState::Mutable), policy(ResourcePolicy::Manual), referenceCount(0), size(0), lastRelease(0), used(false) {}
 
     Data(const Data&) = delete;
 
-    Data(Data&& other) noexcept: data{other.data}, state{other.state}, policy{other.policy}, referenceCount{other.referenceCount} {
+    Data(Data&& other) noexcept: key{other.key}, data{other.data}, state{other.state}, policy{other.policy}, referenceCount{other.referenceCount}, size{other.size}, lastRelease{other.lastRelease}, used{other.used} {
         other.data = nullptr;
         other.referenceCount = 0;
+        other.size = 0;
     }
 
     ~Data();
@@ -581,10 +893,26 @@ template<class T> struct ResourceManagerData<T>::Data {
     Data& operator=(const Data&) = delete;
     Data& operator=(Data&&) = delete;
 
+    /* Deletes the data and puts the slot back into the unused state */
+    void reset() {
+        safeDelete(data);
+        key = {};
+        data = nullptr;
+        state = ResourceDataState::Mutable;
+        policy = ResourcePolicy::Manual;
+        size = 0;
+        lastRelease = 0;
+        used = false;
+    }
+
+    ResourceKey key;
     T* data;
     ResourceDataState state;
     ResourcePolicy policy;
     std::size_t referenceCount;
+    std::size_t size;
+    std::size_t lastRelease;
+    bool used;
 };
 
 template<class T> inline ResourceManagerData<T>::Data::~Data() {
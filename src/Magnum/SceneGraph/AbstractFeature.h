@@ -276,6 +276,7 @@ template<UnsignedInt dimensions, class T> class AbstractFeature
         friend Containers::LinkedList<AbstractFeature<dimensions, T>>;
         friend Containers::LinkedListItem<AbstractFeature<dimensions, T>, AbstractObject<dimensions, T>>;
         template<class> friend class Object;
+        template<class> friend class BasicFlatObject3D;
         #endif
 
         CachedTransformations _cachedTransformations;
@@ -32,9 +32,12 @@
 
 #include <functional>
 #include <vector>
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/LinkedList.h>
+#include <Corrade/Containers/Reference.h>
 
 #include "Magnum/DimensionTraits.h"
+#include "Magnum/SceneGraph/Parallel.h"
 #include "Magnum/SceneGraph/SceneGraph.h"
 #include "Magnum/SceneGraph/visibility.h"
 
@@ -186,6 +189,22 @@ template<UnsignedInt dimensions, class T> class AbstractObject
             return doTransformationMatrices(objects, finalTransformationMatrix);
         }
 
+        /**
+         * @brief Transformation matrices of given set of objects relative to this object into an existing array
+         * @m_since_latest
+         *
+         * Like @ref transformationMatrices(), but puts the result into
+         * @p transformationMatrices, which is expected to have the same size
+         * as @p objects. See @ref Object::transformationsInto() for details
+         * about the calculation and the @p parallelFor parameter.
+         * @warning This function cannot check if all objects are of the same
+         *      @ref Object type, use typesafe
+         *      @ref Object::transformationMatricesInto() when possible.
+         */
+        void transformationMatricesInto(const Containers::ArrayView<const Containers::Reference<AbstractObject<dimensions, T>>>& objects, const Containers::StridedArrayView1D<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix = MatrixType(), ParallelFor parallelFor = nullptr, void* parallelForState = nullptr) const {
+            doTransformationMatricesInto(objects, transformationMatrices, finalTransformationMatrix, parallelFor, parallelForState);
+        }
+
         /* Since 1.8.17, the original short-hand group closing doesn't work
            anymore. FFS. */
         /**
@@ -211,6 +230,24 @@ template<UnsignedInt dimensions, class T> class AbstractObject
             objects.front().get().doSetClean(objects);
         }
 
+        /**
+         * @brief Clean absolute transformations of given set of objects, optionally in parallel
+         * @m_since_latest
+         *
+         * Like @ref setClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>&),
+         * but takes a view instead of a @ref std::vector and calculates the
+         * absolute transformations using @ref Object::transformationsInto(),
+         * passing @p parallelFor through. See @ref Object::setClean(const Containers::ArrayView<const Containers::Reference<Object<Transformation>>>&, ParallelFor, void*)
+         * for more information.
+         * @warning This function cannot check if all objects are of the same
+         *      @ref Object type, use typesafe @ref Object::setClean() when
+         *      possible.
+         */
+        static void setClean(const Containers::ArrayView<const Containers::Reference<AbstractObject<dimensions, T>>>& objects, ParallelFor parallelFor, void* parallelForState = nullptr) {
+            if(objects.isEmpty()) return;
+            objects[0]->doSetClean(objects, parallelFor, parallelForState);
+        }
+
         /**
          * @brief Whether absolute transformation is dirty
          *
@@ -271,11 +308,13 @@ template<UnsignedInt dimensions, class T> class AbstractObject
         virtual MatrixType doTransformationMatrix() const = 0;
         virtual MatrixType doAbsoluteTransformationMatrix() const = 0;
         virtual std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& finalTransformationMatrix) const = 0;
+        virtual void doTransformationMatricesInto(const Containers::ArrayView<const Containers::Reference<AbstractObject<dimensions, T>>>& objects, const Containers::StridedArrayView1D<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix, ParallelFor parallelFor, void* parallelForState) const = 0;
 
         virtual bool doIsDirty() const = 0;
         virtual void doSetDirty() = 0;
         virtual void doSetClean() = 0;
         virtual void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) = 0;
+        virtual void doSetClean(const Containers::ArrayView<const Containers::Reference<AbstractObject<dimensions, T>>>& objects, ParallelFor parallelFor, void* parallelForState) = 0;
 };
 
 /**
@@ -107,6 +107,18 @@ just puts itself to rest and waits until some animation changes its state to
 permanently running into separate group, they will not be traversed every time
 the @ref AnimableGroup::step() gets called, saving precious frame time.
 
+@section SceneGraph-Animable-parallel Stepping animations in parallel
+
+With thousands of running animables the serial @ref animationStep() calls can
+dominate the frame. Animables that only touch their own state can be marked
+with @ref setThreadSafe() and the group stepped with
+@ref AnimableGroup::step(Float, Float, ParallelFor, void*), which dispatches
+steps of these animables to a @ref ParallelFor executor. State transitions,
+the state change callbacks and steps of animables that aren't marked as
+thread-safe are still processed on the calling thread, and the function
+returns only after all steps finished, so transformations can be safely read
+right after.
+
 @section SceneGraph-Animable-explicit-specializations Explicit template specializations
 
 The following specializations are explicitly compiled into @ref SceneGraph
@@ -202,6 +214,35 @@ template<UnsignedInt dimensions, class T> class Animable: public AbstractGrouped
             return *this;
         }
 
+        /**
+         * @brief Whether the animation step is thread-safe
+         * @m_since_latest
+         *
+         * @see @ref setThreadSafe()
+         */
+        bool isThreadSafe() const { return _threadSafe; }
+
+        /**
+         * @brief Mark the animation step as thread-safe
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * If enabled, @ref AnimableGroup::step(Float, Float, ParallelFor, void*)
+         * is allowed to call @ref animationStep() of this animable from a
+         * worker thread, concurrently with steps of other thread-safe
+         * animables in the same group. The implementation is then expected to
+         * touch only state owned by this animable --- in particular it
+         * shouldn't add, remove or reparent objects, change state of other
+         * animables or modify transformations of objects that other
+         * animables modify as well. State change callbacks such as
+         * @ref animationStarted() are always called from the calling thread.
+         * Default is @cpp false @ce.
+         */
+        Animable<dimensions, T>& setThreadSafe(bool threadSafe) {
+            _threadSafe = threadSafe;
+            return *this;
+        }
+
         /**
          * @brief Group containing this animable
          *
@@ -300,6 +341,7 @@ template<UnsignedInt dimensions, class T> class Animable: public AbstractGrouped
         Float _startTime, _pauseTime;
         AnimationState _previousState, _currentState;
         bool _repeated;
+        bool _threadSafe;
         UnsignedShort _repeatCount;
         UnsignedShort _repeats;
 };
@@ -30,14 +30,17 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Animable.h and @ref AnimableGroup.h
  */
 
+#include <Corrade/Containers/GrowableArray.h>
+
 #include "Magnum/Timeline.h"
 #include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/SceneGraph/AnimableGroup.h"
 #include "Magnum/SceneGraph/Animable.h"
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>{object, group}, _duration{0.0f}, _startTime{Constants::inf()}, _pauseTime{-Constants::inf()}, _previousState{AnimationState::Stopped}, _currentState{AnimationState::Stopped}, _repeated{false}, _repeatCount{0}, _repeats{0} {}
+template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>{object, group}, _duration{0.0f}, _startTime{Constants::inf()}, _pauseTime{-Constants::inf()}, _previousState{AnimationState::Stopped}, _currentState{AnimationState::Stopped}, _repeated{false}, _threadSafe{false}, _repeatCount{0}, _repeats{0} {}
 
 template<UnsignedInt dimensions, class T> Animable<dimensions, T>::~Animable() {
     /* Update count of running animations when deleting an animable that's
@@ -67,10 +70,16 @@ template<UnsignedInt dimensions, class T> const AnimableGroup<dimensions, T>* An
     return static_cast<const AnimableGroup<dimensions, T>*>(AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>::group());
 }
 
-template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::step(const Float time, const Float delta) {
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::step(const Float time, const Float delta, const ParallelFor parallelFor, void* const parallelForState) {
     if(!_runningCount && !wakeUp) return;
     wakeUp = false;
 
+    /* Running thread-safe animables get collected here if stepping in
+       parallel. Reusing the allocation from previous frames. */
+    std::size_t parallelCount = 0;
+    if(parallelFor && _parallelAnimables.size() < AnimableGroup<dimensions, T>::size())
+        arrayResize(_parallelAnimables, NoInit, AnimableGroup<dimensions, T>::size());
+
     for(std::size_t i = 0; i != AnimableGroup<dimensions, T>::size(); ++i) {
         Animable<dimensions, T>& animable = (*this)[i];
 
@@ -136,7 +145,31 @@ template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::ste
             "SceneGraph::AnimableGroup::step(): animation was started in future - probably wrong time passed", );
         CORRADE_ASSERT(delta >= 0.0f,
             "SceneGraph::AnimableGroup::step(): negative delta passed", );
-        animable.animationStep(time - animable._startTime, delta);
+        if(parallelFor && animable._threadSafe)
+            _parallelAnimables[parallelCount++] = &animable;
+        else animable.animationStep(time - animable._startTime, delta);
+    }
+
+    /* Step the collected animables in parallel. Each of them touches only its
+       own state, so the result doesn't depend on how the executor splits and
+       orders the work. */
+    if(parallelCount) {
+        struct State {
+            Containers::ArrayView<Animable<dimensions, T>* const> animables;
+            Float time, delta;
+        } state{_parallelAnimables.prefix(parallelCount), time, delta};
+
+        /* Animables are split into chunks of this size */
+        constexpr std::size_t ChunkSize = 64;
+
+        parallelFor(parallelForState, (parallelCount + ChunkSize - 1)/ChunkSize, [](void* taskState, std::size_t chunk) {
+            const State& state = *static_cast<const State*>(taskState);
+            const std::size_t end = Math::min((chunk + 1)*ChunkSize, state.animables.size());
+            for(std::size_t i = chunk*ChunkSize; i != end; ++i) {
+                Animable<dimensions, T>& animable = *state.animables[i];
+                animable.animationStep(state.time - animable._startTime, state.delta);
+            }
+        }, &state);
     }
 
     CORRADE_INTERNAL_ASSERT((_runningCount <= AnimableGroup<dimensions, T>::size()));
@@ -30,8 +30,11 @@
  * @brief Class @ref Magnum::SceneGraph::AnimableGroup, alias @ref Magnum::SceneGraph::BasicAnimableGroup2D, @ref Magnum::SceneGraph::BasicAnimableGroup3D, typedef @ref Magnum::SceneGraph::AnimableGroup2D, @ref Magnum::SceneGraph::AnimableGroup3D
  */
 
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/SceneGraph/Animable.h"
 #include "Magnum/SceneGraph/FeatureGroup.h"
+#include "Magnum/SceneGraph/Parallel.h"
 #include "Magnum/SceneGraph/visibility.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -65,13 +68,43 @@ template<UnsignedInt dimensions, class T> class AnimableGroup: public FeatureGro
          * @param delta     Time delta for current frame (e.g. @ref Timeline::previousFrameDuration())
          *
          * If there are no running animations the function does nothing.
+         * Equivalent to calling @ref step(Float, Float, ParallelFor, void*)
+         * with @cpp nullptr @ce for @p parallelFor.
          * @see @ref runningCount()
          */
-        void step(Float time, Float delta);
+        void step(Float time, Float delta) {
+            step(time, delta, nullptr, nullptr);
+        }
+
+        /**
+         * @brief Perform animation step, optionally in parallel
+         * @param time              Absolute time (e.g. @ref Timeline::previousFrameTime())
+         * @param delta             Time delta for current frame (e.g. @ref Timeline::previousFrameDuration())
+         * @param parallelFor       Parallel loop executor or @cpp nullptr @ce
+         * @param parallelForState  State pointer passed to @p parallelFor
+         * @m_since_latest
+         *
+         * State transitions, state change callbacks and steps of animables
+         * that aren't marked with @ref Animable::setThreadSafe() are
+         * processed serially on the calling thread in the order the
+         * animables were added to the group. If @p parallelFor is not
+         * @cpp nullptr @ce, the @ref Animable::animationStep() calls of
+         * running thread-safe animables are then split into chunks and
+         * dispatched to it. As @p parallelFor is expected to return only
+         * after all tasks finished, the results are visible to the caller
+         * once this function returns. If @p parallelFor is
+         * @cpp nullptr @ce, all steps are executed serially, the same as with
+         * @ref step(Float, Float).
+         * @see @ref SceneGraph-Animable-parallel
+         */
+        void step(Float time, Float delta, ParallelFor parallelFor, void* parallelForState = nullptr);
 
     private:
         std::size_t _runningCount;
         bool wakeUp;
+        /* Running thread-safe animables collected in step(), kept to avoid
+           reallocation every frame */
+        Containers::Array<Animable<dimensions, T>*> _parallelAnimables;
 };
 
 /**
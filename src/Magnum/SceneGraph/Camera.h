@@ -33,6 +33,7 @@
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/Parallel.h"
 #include "Magnum/SceneGraph/visibility.h"
 
 #ifdef CORRADE_TARGET_WINDOWS /* I so HATE windef.h */
@@ -197,6 +198,21 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
          */
         std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> drawableTransformations(DrawableGroup<dimensions, T>& group);
 
+        /**
+         * @brief Calculate drawable transformations into a view
+         * @m_since_latest
+         *
+         * Like @ref drawableTransformations(), but puts the camera-relative
+         * transformations into a view with size equal to
+         * @ref DrawableGroup::size(), in the same order as drawables in the
+         * group, and calculates them in a single batch using
+         * @ref Object::transformationsInto(). The @p parallelFor and
+         * @p parallelForState is passed through to it. Useful in combination
+         * with @ref draw(DrawableGroup<dimensions, T>&, const Containers::StridedArrayView1D<const MatrixTypeFor<dimensions, T>>&)
+         * to reuse the transformations across several frames or passes.
+         */
+        void drawableTransformationsInto(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, T>>& transformations, ParallelFor parallelFor = nullptr, void* parallelForState = nullptr);
+
         /**
          * @brief Draw
          *
@@ -205,6 +221,72 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
          */
         void draw(DrawableGroup<dimensions, T>& group);
 
+        /**
+         * @brief Draw given group of drawables with precalculated transformations
+         * @m_since_latest
+         *
+         * Expects that @p transformations has the same size as @p group,
+         * the transformations are expected to be calculated for example
+         * with @ref drawableTransformationsInto().
+         */
+        void draw(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const MatrixTypeFor<dimensions, T>>& transformations);
+
+        /**
+         * @brief Draw given group of drawables, culling ones outside of the projection
+         * @param group                  Drawable group
+         * @param boundingSphereCenters  Bounding sphere center for each
+         *      drawable, relative to its object
+         * @param boundingSphereRadii    Bounding sphere radius for each
+         *      drawable, relative to its object
+         * @return Count of drawables that were culled
+         * @m_since_latest
+         *
+         * Expects that @p boundingSphereCenters and @p boundingSphereRadii
+         * have the same size as @p group, in the same order as drawables in
+         * the group. The bounding spheres are transformed with the
+         * camera-relative drawable transformations, with the radius scaled
+         * by the largest scaling of the transformation, and drawables whose
+         * spheres don't intersect the @ref projectionMatrix() are skipped.
+         * In 3D the spheres are tested against a @ref Math::Frustum
+         * extracted from the projection matrix using
+         * @ref Math::Intersection::sphereFrustum(), batched for
+         * @relativeref{Magnum,Float}. In 2D the circles are tested against
+         * the @f$ [-1, 1] @f$ square in normalized device coordinates.
+         *
+         * The returned count is meant mainly for profiling purposes. The
+         * culling is conservative, so some drawables may be drawn even if
+         * they're not visible.
+         */
+        std::size_t draw(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const VectorTypeFor<dimensions, T>>& boundingSphereCenters, const Containers::StridedArrayView1D<const T>& boundingSphereRadii);
+
+        /**
+         * @brief Draw given group of drawables sorted by a key
+         * @param group     Drawable group
+         * @param sortKeys  Sort key for each drawable
+         * @m_since_latest
+         *
+         * Expects that @p sortKeys has the same size as @p group, in the same
+         * order as drawables in the group. The drawables are drawn in an
+         * ascending order of the keys, which are sorted using a stable radix
+         * sort, i.e. drawables with equal keys are drawn in the order they
+         * are in the group. Byte positions in which all keys are the same are
+         * skipped during sorting. Use @ref drawableSortKey() to make keys
+         * that group drawables by shader, material, mesh and depth. See
+         * @ref SceneGraph-Drawable-state-sorting for more information.
+         */
+        void drawSorted(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const UnsignedLong>& sortKeys);
+
+        /**
+         * @brief Draw given group of drawables sorted by a key, culling ones outside of the projection
+         * @return Count of drawables that were culled
+         * @m_since_latest
+         *
+         * Combination of @ref drawSorted(DrawableGroup<dimensions, T>&, const Containers::StridedArrayView1D<const UnsignedLong>&)
+         * and @ref draw(DrawableGroup<dimensions, T>&, const Containers::StridedArrayView1D<const VectorTypeFor<dimensions, T>>&, const Containers::StridedArrayView1D<const T>&),
+         * culling the drawables first and sorting only the visible ones.
+         */
+        std::size_t drawSorted(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const UnsignedLong>& sortKeys, const Containers::StridedArrayView1D<const VectorTypeFor<dimensions, T>>& boundingSphereCenters, const Containers::StridedArrayView1D<const T>& boundingSphereRadii);
+
         /**
          * @brief Draw given drawables with transformations
          *
@@ -30,7 +30,18 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Camera.h
  */
 
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Reference.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include <utility> /* std::swap() */
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/BitArrayView.h>
+
+#include "Magnum/Math/Frustum.h"
 #include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/IntersectionBatch.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
 
@@ -54,6 +65,94 @@ template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRat
         Math::Vector2<T>(T(1), relativeAspectRatio.x()/relativeAspectRatio.y()), T(1)));
 }
 
+/* Culling of camera-relative bounding spheres against the projection. In 2D
+   the projection is affine, so the circle is conservatively tested against
+   the [-1, 1] square in normalized device coordinates. */
+template<UnsignedInt dimensions, class T> struct CameraCulling;
+template<class T> struct CameraCulling<2, T> {
+    static void cull(const Math::Matrix3<T>& projectionMatrix, const Containers::StridedArrayView1D<const Math::Vector2<T>>& centers, const Containers::StridedArrayView1D<const T>& radii, const Containers::MutableBitArrayView visible) {
+        const T scaling = Math::sqrt(projectionMatrix.scalingSquared().max());
+        for(std::size_t i = 0; i != centers.size(); ++i) {
+            const Math::Vector2<T> center = projectionMatrix.transformPoint(centers[i]);
+            const T radius = radii[i]*scaling;
+            visible.set(i, Math::abs(center.x()) <= T(1) + radius &&
+                           Math::abs(center.y()) <= T(1) + radius);
+        }
+    }
+};
+template<class T> struct CameraCulling<3, T> {
+    static void cull(const Math::Matrix4<T>& projectionMatrix, const Containers::StridedArrayView1D<const Math::Vector3<T>>& centers, const Containers::StridedArrayView1D<const T>& radii, const Containers::MutableBitArrayView visible) {
+        const Math::Frustum<T> frustum = Math::Frustum<T>::fromMatrix(projectionMatrix);
+        for(std::size_t i = 0; i != centers.size(); ++i)
+            visible.set(i, Math::Intersection::sphereFrustum(centers[i], radii[i], frustum));
+    }
+};
+/* Float has a batch variant of the frustum test */
+template<> struct CameraCulling<3, Float> {
+    static void cull(const Matrix4& projectionMatrix, const Containers::StridedArrayView1D<const Vector3>& centers, const Containers::StridedArrayView1D<const Float>& radii, const Containers::MutableBitArrayView visible) {
+        Math::Intersection::sphereFrustum(centers, radii, Frustum::fromMatrix(projectionMatrix), visible);
+    }
+};
+
+/* Transforms the bounding spheres to camera space and culls them. The radius
+   is scaled by the largest scaling in the transformation so the sphere stays
+   conservative even for non-uniform scaling. */
+template<UnsignedInt dimensions, class T> void cullDrawables(const MatrixTypeFor<dimensions, T>& projectionMatrix, const Containers::ArrayView<const MatrixTypeFor<dimensions, T>> transformations, const Containers::StridedArrayView1D<const VectorTypeFor<dimensions, T>>& boundingSphereCenters, const Containers::StridedArrayView1D<const T>& boundingSphereRadii, const Containers::MutableBitArrayView visible) {
+    Containers::Array<VectorTypeFor<dimensions, T>> centers{NoInit, transformations.size()};
+    Containers::Array<T> radii{NoInit, transformations.size()};
+    for(std::size_t i = 0; i != transformations.size(); ++i) {
+        centers[i] = transformations[i].transformPoint(boundingSphereCenters[i]);
+        radii[i] = boundingSphereRadii[i]*Math::sqrt(transformations[i].scalingSquared().max());
+    }
+
+    CameraCulling<dimensions, T>::cull(projectionMatrix, centers, radii, visible);
+}
+
+/* Stable LSD radix sort of drawable indices by their keys, one byte at a
+   time. Bytes that are the same in all keys are skipped, so for example keys
+   that use just the upper 16 bits take only two passes. */
+inline void radixSortDrawables(const Containers::StridedArrayView1D<const UnsignedLong>& sortKeys, const Containers::ArrayView<UnsignedInt> indices) {
+    if(indices.size() < 2) return;
+
+    Containers::Array<UnsignedLong> keys{NoInit, indices.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        keys[i] = sortKeys[indices[i]];
+
+    Containers::Array<UnsignedLong> keysScratch{NoInit, indices.size()};
+    Containers::Array<UnsignedInt> indicesScratch{NoInit, indices.size()};
+    Containers::ArrayView<UnsignedLong> keysIn = keys, keysOut = keysScratch;
+    Containers::ArrayView<UnsignedInt> indicesIn = indices, indicesOut = indicesScratch;
+    for(UnsignedInt shift = 0; shift != 64; shift += 8) {
+        std::size_t offsets[256]{};
+        for(const UnsignedLong key: keysIn)
+            ++offsets[(key >> shift) & 0xff];
+
+        /* All keys have the same value in this byte, nothing to do */
+        if(offsets[(keysIn[0] >> shift) & 0xff] == keysIn.size()) continue;
+
+        std::size_t offset = 0;
+        for(std::size_t& i: offsets) {
+            const std::size_t count = i;
+            i = offset;
+            offset += count;
+        }
+
+        for(std::size_t i = 0; i != keysIn.size(); ++i) {
+            const std::size_t out = offsets[(keysIn[i] >> shift) & 0xff]++;
+            keysOut[out] = keysIn[i];
+            indicesOut[out] = indicesIn[i];
+        }
+
+        std::swap(keysIn, keysOut);
+        std::swap(indicesIn, indicesOut);
+    }
+
+    /* If the result ended up in the scratch memory, copy it back */
+    if(indicesIn.data() != indices.data())
+        for(std::size_t i = 0; i != indices.size(); ++i)
+            indices[i] = indicesIn[i];
+}
+
 }
 
 template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved) {
@@ -107,26 +206,103 @@ template<UnsignedInt dimensions, class T> std::vector<std::pair<std::reference_w
     return combined;
 }
 
-template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group) {
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::drawableTransformationsInto(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, T>>& transformations, const ParallelFor parallelFor, void* const parallelForState) {
     AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object().scene();
-    CORRADE_ASSERT(scene, "SceneGraph::Camera::draw(): cannot draw when camera is not part of any scene", );
+    CORRADE_ASSERT(scene, "SceneGraph::Camera::drawableTransformationsInto(): camera is not part of any scene", );
+    CORRADE_ASSERT(transformations.size() == group.size(),
+        "SceneGraph::Camera::drawableTransformationsInto(): expected" << group.size() << "transformations but got" << transformations.size(), );
 
     /* Compute camera matrix */
     AbstractFeature<dimensions, T>::object().setClean();
 
-    /* Compute transformations of all objects in the group relative to the camera */
-    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
-    objects.reserve(group.size());
+    /* Compute transformations of all objects in the group relative to the
+       camera */
+    Containers::Array<Containers::Reference<AbstractObject<dimensions, T>>> objects;
+    arrayReserve(objects, group.size());
     for(std::size_t i = 0; i != group.size(); ++i)
-        objects.push_back(group[i].object());
-    std::vector<MatrixTypeFor<dimensions, T>> transformations =
-        scene->transformationMatrices(objects, _cameraMatrix);
+        arrayAppend(objects, InPlaceInit, group[i].object());
+    scene->transformationMatricesInto(objects, transformations, _cameraMatrix, parallelFor, parallelForState);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group) {
+    CORRADE_ASSERT(AbstractFeature<dimensions, T>::object().scene(), "SceneGraph::Camera::draw(): cannot draw when camera is not part of any scene", );
+
+    Containers::Array<MatrixTypeFor<dimensions, T>> transformations{NoInit, group.size()};
+    drawableTransformationsInto(group, transformations);
+    draw(group, transformations);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const MatrixTypeFor<dimensions, T>>& transformations) {
+    CORRADE_ASSERT(transformations.size() == group.size(),
+        "SceneGraph::Camera::draw(): expected" << group.size() << "transformations but got" << transformations.size(), );
 
-    /* Perform the drawing */
     for(std::size_t i = 0; i != transformations.size(); ++i)
         group[i].draw(transformations[i], *this);
 }
 
+template<UnsignedInt dimensions, class T> std::size_t Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const VectorTypeFor<dimensions, T>>& boundingSphereCenters, const Containers::StridedArrayView1D<const T>& boundingSphereRadii) {
+    CORRADE_ASSERT(AbstractFeature<dimensions, T>::object().scene(), "SceneGraph::Camera::draw(): cannot draw when camera is not part of any scene", {});
+    CORRADE_ASSERT(boundingSphereCenters.size() == group.size() && boundingSphereRadii.size() == group.size(),
+        "SceneGraph::Camera::draw(): expected" << group.size() << "bounding spheres but got" << boundingSphereCenters.size() << "centers and" << boundingSphereRadii.size() << "radii", {});
+
+    Containers::Array<MatrixTypeFor<dimensions, T>> transformations{NoInit, group.size()};
+    drawableTransformationsInto(group, transformations);
+
+    Containers::BitArray visible{NoInit, group.size()};
+    Implementation::cullDrawables<dimensions, T>(_projectionMatrix, transformations, boundingSphereCenters, boundingSphereRadii, visible);
+
+    std::size_t culled = 0;
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        if(visible[i]) group[i].draw(transformations[i], *this);
+        else ++culled;
+    }
+
+    return culled;
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::drawSorted(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const UnsignedLong>& sortKeys) {
+    CORRADE_ASSERT(AbstractFeature<dimensions, T>::object().scene(), "SceneGraph::Camera::drawSorted(): cannot draw when camera is not part of any scene", );
+    CORRADE_ASSERT(sortKeys.size() == group.size(),
+        "SceneGraph::Camera::drawSorted(): expected" << group.size() << "sort keys but got" << sortKeys.size(), );
+
+    Containers::Array<MatrixTypeFor<dimensions, T>> transformations{NoInit, group.size()};
+    drawableTransformationsInto(group, transformations);
+
+    Containers::Array<UnsignedInt> indices{NoInit, group.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        indices[i] = i;
+    Implementation::radixSortDrawables(sortKeys, indices);
+
+    for(const UnsignedInt i: indices)
+        group[i].draw(transformations[i], *this);
+}
+
+template<UnsignedInt dimensions, class T> std::size_t Camera<dimensions, T>::drawSorted(DrawableGroup<dimensions, T>& group, const Containers::StridedArrayView1D<const UnsignedLong>& sortKeys, const Containers::StridedArrayView1D<const VectorTypeFor<dimensions, T>>& boundingSphereCenters, const Containers::StridedArrayView1D<const T>& boundingSphereRadii) {
+    CORRADE_ASSERT(AbstractFeature<dimensions, T>::object().scene(), "SceneGraph::Camera::drawSorted(): cannot draw when camera is not part of any scene", {});
+    CORRADE_ASSERT(sortKeys.size() == group.size(),
+        "SceneGraph::Camera::drawSorted(): expected" << group.size() << "sort keys but got" << sortKeys.size(), {});
+    CORRADE_ASSERT(boundingSphereCenters.size() == group.size() && boundingSphereRadii.size() == group.size(),
+        "SceneGraph::Camera::drawSorted(): expected" << group.size() << "bounding spheres but got" << boundingSphereCenters.size() << "centers and" << boundingSphereRadii.size() << "radii", {});
+
+    Containers::Array<MatrixTypeFor<dimensions, T>> transformations{NoInit, group.size()};
+    drawableTransformationsInto(group, transformations);
+
+    Containers::BitArray visible{NoInit, group.size()};
+    Implementation::cullDrawables<dimensions, T>(_projectionMatrix, transformations, boundingSphereCenters, boundingSphereRadii, visible);
+
+    /* Sort only the visible drawables */
+    Containers::Array<UnsignedInt> indices{NoInit, group.size()};
+    std::size_t visibleCount = 0;
+    for(std::size_t i = 0; i != group.size(); ++i)
+        if(visible[i]) indices[visibleCount++] = i;
+    Implementation::radixSortDrawables(sortKeys, indices.prefix(visibleCount));
+
+    for(const UnsignedInt i: indices.prefix(visibleCount))
+        group[i].draw(transformations[i], *this);
+
+    return group.size() - visibleCount;
+}
+
 template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(const std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>>& drawableTransformations) {
     for(auto&& drawableTransformation: drawableTransformations)
         drawableTransformation.first.get().draw(drawableTransformation.second, *this);
@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::SceneGraph::Drawable, @ref Magnum::SceneGraph::DrawableGroup, alias @ref Magnum::SceneGraph::BasicDrawable2D, @ref Magnum::SceneGraph::BasicDrawable3D, @ref Magnum::SceneGraph::BasicDrawableGroup2D, @ref Magnum::SceneGraph::BasicDrawableGroup3D, typedef @ref Magnum::SceneGraph::Drawable2D, @ref Magnum::SceneGraph::Drawable3D, @ref Magnum::SceneGraph::DrawableGroup2D, @ref Magnum::SceneGraph::DrawableGroup3D
+ * @brief Class @ref Magnum::SceneGraph::Drawable, @ref Magnum::SceneGraph::DrawableGroup, function @ref Magnum::SceneGraph::drawableSortKey(), alias @ref Magnum::SceneGraph::BasicDrawable2D, @ref Magnum::SceneGraph::BasicDrawable3D, @ref Magnum::SceneGraph::BasicDrawableGroup2D, @ref Magnum::SceneGraph::BasicDrawableGroup3D, typedef @ref Magnum::SceneGraph::Drawable2D, @ref Magnum::SceneGraph::Drawable3D, @ref Magnum::SceneGraph::DrawableGroup2D, @ref Magnum::SceneGraph::DrawableGroup3D
  */
 
 #include "Magnum/SceneGraph/AbstractGroupedFeature.h"
@@ -134,6 +134,30 @@ get used in any way except being passed to the draw function:
 
 @snippet SceneGraph.cpp Drawable-culling
 
+Alternatively, @ref Camera::draw(DrawableGroup<dimensions, T>&, const Containers::StridedArrayView1D<const VectorTypeFor<dimensions, T>>&, const Containers::StridedArrayView1D<const T>&)
+takes a bounding sphere for each drawable and culls the drawables without
+having to go through the intermediate vector.
+
+@section SceneGraph-Drawable-state-sorting State-sorted drawing
+
+To minimize GPU state changes, @ref Camera::drawSorted() draws the group in
+an order given by a 64-bit sort key for each drawable. The keys are sorted in
+an ascending order with a stable radix sort, so drawables sharing the same
+state are drawn in a single run. The @ref drawableSortKey() helper packs
+shader, material, mesh and depth identifiers into a key, with the shader in
+the most significant bits, which means shader changes are the least frequent:
+
+@code{.cpp}
+Containers::Array<UnsignedLong> keys{NoInit, drawables.size()};
+for(std::size_t i = 0; i != drawables.size(); ++i) {
+    auto& drawable = static_cast<MyDrawable&>(drawables[i]);
+    keys[i] = SceneGraph::drawableSortKey(drawable.shaderId(),
+        drawable.materialId(), drawable.meshId(), 0);
+}
+
+camera.drawSorted(drawables, keys);
+@endcode
+
 @section SceneGraph-Drawable-explicit-specializations Explicit template specializations
 
 The following specializations are explicitly compiled into @ref SceneGraph
@@ -273,6 +297,29 @@ template<class T> using BasicDrawableGroup3D = DrawableGroup<3, T>;
 */
 typedef BasicDrawableGroup3D<Float> DrawableGroup3D;
 
+/**
+@brief Make a drawable sort key
+@param shader       Shader ID
+@param material     Material ID
+@param mesh         Mesh ID
+@param depth        Quantized depth
+@m_since_latest
+
+Packs the values into a 64-bit key for @ref Camera::drawSorted(), with
+@p shader in the top 16 bits, followed by @p material, @p mesh and @p depth
+in the lowest 16 bits. Sorting by such key thus groups drawables by shader
+first, then by material and mesh, and finally orders drawables sharing all
+three by depth. For back-to-front ordering of transparent objects, pass an
+inverted depth value instead. See @ref SceneGraph-Drawable-state-sorting for
+more information.
+*/
+constexpr UnsignedLong drawableSortKey(UnsignedShort shader, UnsignedShort material, UnsignedShort mesh, UnsignedShort depth) {
+    return UnsignedLong(shader) << 48|
+           UnsignedLong(material) << 32|
+           UnsignedLong(mesh) << 16|
+           UnsignedLong(depth);
+}
+
 #if defined(CORRADE_TARGET_WINDOWS) && !(defined(CORRADE_TARGET_MINGW) && !defined(CORRADE_TARGET_CLANG))
 extern template class MAGNUM_SCENEGRAPH_EXPORT Drawable<2, Float>;
 extern template class MAGNUM_SCENEGRAPH_EXPORT Drawable<3, Float>;
@@ -0,0 +1,492 @@
+#ifndef Magnum_SceneGraph_FlatScene_h
+#define Magnum_SceneGraph_FlatScene_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BasicFlatScene3D, @ref Magnum::SceneGraph::BasicFlatObject3D, typedef @ref Magnum::SceneGraph::FlatScene3D, @ref Magnum::SceneGraph::FlatObject3D
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Three-dimensional scene with contiguous transformation storage
+@m_since_latest
+
+Alternative to @ref Scene and @ref Object for large scenes. A regular
+@ref Object is a separately allocated node that contains its transformation
+and links to its parent, siblings and children, which means traversing the
+hierarchy involves a lot of pointer chasing. Here, the hierarchy and the
+transformations of all objects are instead stored in contiguous arrays owned
+by the scene and indexed by @ref BasicFlatObject3D::id(), similarly to how
+@ref Trade::SceneData stores them. The @ref BasicFlatObject3D instances are
+just lightweight handles into the scene, deriving from @ref AbstractObject so
+features such as @ref Drawable, @ref Animable or @ref Camera can be attached
+to them the same way as to a regular @ref Object:
+
+@code{.cpp}
+SceneGraph::FlatScene3D scene;
+
+SceneGraph::FlatObject3D& object = *new SceneGraph::FlatObject3D{scene};
+object.translate(Vector3::zAxis(-5.0f));
+new MyDrawable{object, &drawables};
+
+SceneGraph::FlatObject3D cameraObject{scene};
+SceneGraph::Camera3D camera{cameraObject};
+
+// every frame
+scene.updateAbsoluteTransformations();
+camera.draw(drawables);
+@endcode
+
+The transformations are stored as a @ref Math::Matrix4. Marking an object
+dirty marks all its children dirty as well, same as with @ref Object. Call
+@ref updateAbsoluteTransformations() to recalculate absolute transformations
+of all dirty objects in a single pass over the arrays, optionally in parallel,
+and clean their features. Absolute transformations of clean objects are then
+simply fetched from the array, which makes for example
+@ref Camera::draw() significantly faster compared to a regular @ref Object
+hierarchy, where all transformations are recalculated every time.
+
+@section SceneGraph-BasicFlatScene3D-ownership Object ownership
+
+Similarly to @ref Object, objects own their children and the scene owns all
+top-level objects, deleting them on destruction. Objects allocated on stack
+are supported as well, as long as they're destructed before their parent. IDs
+of destructed objects are reused for newly created objects.
+
+@section SceneGraph-BasicFlatScene3D-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref FlatScene.hpp implementation file to avoid linker
+errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref FlatScene3D
+
+@see @ref FlatScene3D, @ref BasicFlatObject3D
+*/
+template<class T> class BasicFlatScene3D: public AbstractObject<3, T> {
+    public:
+        /** @brief Matrix type */
+        typedef Math::Matrix4<T> MatrixType;
+
+        /** @brief Constructor */
+        explicit BasicFlatScene3D();
+
+        /** @brief Copying is not allowed */
+        BasicFlatScene3D(const BasicFlatScene3D<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        BasicFlatScene3D(BasicFlatScene3D<T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes all top-level objects, which in turn delete their children.
+         */
+        ~BasicFlatScene3D();
+
+        /** @brief Copying is not allowed */
+        BasicFlatScene3D<T>& operator=(const BasicFlatScene3D<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        BasicFlatScene3D<T>& operator=(BasicFlatScene3D<T>&&) = delete;
+
+        /**
+         * @brief Object ID bound
+         *
+         * Upper bound on object IDs in the scene, i.e. size of the
+         * @ref transformations() and @ref absoluteTransformations() arrays.
+         * Can be larger than @ref objectCount() if some objects were
+         * destructed.
+         */
+        std::size_t objectBound() const { return _objects.size(); }
+
+        /** @brief Count of objects in the scene */
+        std::size_t objectCount() const { return _objectCount; }
+
+        /**
+         * @brief Object with given ID
+         *
+         * Expects that @p id is less than @ref objectBound(). Returns
+         * @cpp nullptr @ce if there's no object with given ID.
+         */
+        BasicFlatObject3D<T>* object(UnsignedInt id);
+        const BasicFlatObject3D<T>* object(UnsignedInt id) const; /**< @overload */
+
+        /**
+         * @brief Object transformations
+         *
+         * Transformations relative to object parent, indexed by object ID.
+         * Items corresponding to IDs that don't have an object have
+         * unspecified contents.
+         */
+        Containers::ArrayView<const MatrixType> transformations() const {
+            return _transformations;
+        }
+
+        /**
+         * @brief Absolute object transformations
+         *
+         * Transformations relative to the scene, indexed by object ID. Items
+         * corresponding to dirty objects or IDs that don't have an object
+         * have unspecified contents, call @ref updateAbsoluteTransformations()
+         * to make all objects clean.
+         */
+        Containers::ArrayView<const MatrixType> absoluteTransformations() const {
+            return _absoluteTransformations;
+        }
+
+        /**
+         * @brief Update absolute transformations of all dirty objects
+         * @param parallelFor       Parallel loop executor
+         * @param parallelForState  State pointer to pass to @p parallelFor
+         *
+         * Calculates absolute transformations of all dirty objects in a
+         * single pass, going through the objects in an order where each
+         * parent is before its children. If @p parallelFor is not
+         * @cpp nullptr @ce, all objects at the same depth in the hierarchy are
+         * processed in parallel using it. Then, features of all dirty objects
+         * are cleaned with @ref AbstractFeature::clean() and
+         * @ref AbstractFeature::cleanInverted() serially on the calling
+         * thread, and the objects marked as clean.
+         *
+         * The traversal order is calculated on first call and then cached
+         * until the hierarchy changes.
+         */
+        void updateAbsoluteTransformations(ParallelFor parallelFor = nullptr, void* parallelForState = nullptr);
+
+    private:
+        #ifndef DOXYGEN_GENERATING_OUTPUT /* https://bugzilla.gnome.org/show_bug.cgi?id=776986 */
+        friend BasicFlatObject3D<T>;
+        #endif
+
+        AbstractObject<3, T>* doScene() override final { return this; }
+        const AbstractObject<3, T>* doScene() const override final { return this; }
+
+        AbstractObject<3, T>* doParent() override final { return nullptr; }
+        const AbstractObject<3, T>* doParent() const override final { return nullptr; }
+
+        MatrixType doTransformationMatrix() const override final { return {}; }
+        MatrixType doAbsoluteTransformationMatrix() const override final { return {}; }
+        std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<3, T>>>& objects, const MatrixType& finalTransformationMatrix) const override final;
+        void doTransformationMatricesInto(const Containers::ArrayView<const Containers::Reference<AbstractObject<3, T>>>& objects, const Containers::StridedArrayView1D<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix, ParallelFor parallelFor, void* parallelForState) const override final;
+
+        bool doIsDirty() const override final { return false; }
+        void doSetDirty() override final {}
+        void doSetClean() override final {}
+        void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<3, T>>>& objects) override final;
+        void doSetClean(const Containers::ArrayView<const Containers::Reference<AbstractObject<3, T>>>& objects, ParallelFor parallelFor, void* parallelForState) override final;
+
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL absoluteTransformationOf(const AbstractObject<3, T>& object) const;
+        void MAGNUM_SCENEGRAPH_LOCAL updateOrder();
+
+        /* Hierarchy, with ~UnsignedInt{} denoting no object. The _parents
+           entry is ~UnsignedInt{} also for top-level objects, first and last
+           top-level object is in _firstChild and _lastChild. */
+        Containers::Array<BasicFlatObject3D<T>*> _objects;
+        Containers::Array<UnsignedInt> _parents;
+        Containers::Array<UnsignedInt> _firstChildren;
+        Containers::Array<UnsignedInt> _lastChildren;
+        Containers::Array<UnsignedInt> _previousSiblings;
+        Containers::Array<UnsignedInt> _nextSiblings;
+        Containers::Array<MatrixType> _transformations;
+        Containers::Array<MatrixType> _absoluteTransformations;
+        Containers::Array<bool> _dirty;
+        Containers::Array<UnsignedInt> _freeIds;
+
+        /* Objects ordered by depth, with offsets where each depth level
+           starts. Recalculated when _orderDirty is set. */
+        Containers::Array<UnsignedInt> _order;
+        Containers::Array<UnsignedInt> _levelOffsets;
+
+        std::size_t _objectCount;
+        UnsignedInt _firstChild, _lastChild;
+        bool _orderDirty;
+};
+
+/**
+@brief Object in a three-dimensional scene with contiguous transformation storage
+@m_since_latest
+
+A lightweight handle to an object stored in a @ref BasicFlatScene3D, see its
+documentation for more information. Provides the usual object transformation
+interface, with the transformation stored as a @ref Math::Matrix4 in the
+scene.
+
+@section SceneGraph-BasicFlatObject3D-explicit-specializations Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref FlatScene.hpp implementation file to avoid linker
+errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref FlatObject3D
+
+@see @ref FlatObject3D
+*/
+template<class T> class BasicFlatObject3D: public AbstractObject<3, T> {
+    public:
+        /** @brief Matrix type */
+        typedef Math::Matrix4<T> MatrixType;
+
+        /**
+         * @brief Constructor
+         * @param scene     Scene to add the object to
+         * @param parent    Parent object or @cpp nullptr @ce for a top-level
+         *      object
+         *
+         * Expects that @p parent, if not @cpp nullptr @ce, is a part of
+         * @p scene. The object is created with an identity transformation
+         * and marked as dirty.
+         */
+        explicit BasicFlatObject3D(BasicFlatScene3D<T>& scene, BasicFlatObject3D<T>* parent = nullptr);
+
+        /** @brief Copying is not allowed */
+        BasicFlatObject3D(const BasicFlatObject3D<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        BasicFlatObject3D(BasicFlatObject3D<T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes all children and removes itself from the scene, making its
+         * ID available for reuse.
+         */
+        ~BasicFlatObject3D();
+
+        /** @brief Copying is not allowed */
+        BasicFlatObject3D<T>& operator=(const BasicFlatObject3D<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        BasicFlatObject3D<T>& operator=(BasicFlatObject3D<T>&&) = delete;
+
+        /**
+         * @brief Object ID
+         *
+         * Index into @ref BasicFlatScene3D::transformations() and
+         * @ref BasicFlatScene3D::absoluteTransformations().
+         */
+        UnsignedInt id() const { return _id; }
+
+        /** @brief Scene */
+        BasicFlatScene3D<T>* scene() { return &_scene; }
+        const BasicFlatScene3D<T>* scene() const { return &_scene; } /**< @overload */
+
+        /**
+         * @brief Parent object
+         *
+         * Returns @cpp nullptr @ce for top-level objects.
+         */
+        BasicFlatObject3D<T>* parent();
+        const BasicFlatObject3D<T>* parent() const; /**< @overload */
+
+        /**
+         * @brief Set parent object
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p parent, if not @cpp nullptr @ce, is a part of the
+         * same scene and isn't this object or any of its children. Passing
+         * @cpp nullptr @ce makes the object a top-level object.
+         */
+        BasicFlatObject3D<T>& setParent(BasicFlatObject3D<T>* parent);
+
+        /** @brief Object transformation */
+        MatrixType transformation() const {
+            return _scene._transformations[_id];
+        }
+
+        /**
+         * @brief Set transformation
+         * @return Reference to self (for method chaining)
+         */
+        BasicFlatObject3D<T>& setTransformation(const MatrixType& transformation);
+
+        /**
+         * @brief Reset object transformation
+         * @return Reference to self (for method chaining)
+         */
+        BasicFlatObject3D<T>& resetTransformation() {
+            return setTransformation({});
+        }
+
+        /**
+         * @brief Transform the object
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref transformLocal()
+         */
+        BasicFlatObject3D<T>& transform(const MatrixType& transformation) {
+            return setTransformation(transformation*this->transformation());
+        }
+
+        /**
+         * @brief Transform the object as a local transformation
+         * @return Reference to self (for method chaining)
+         *
+         * Similar to the above, except that the transformation is applied
+         * before all others.
+         */
+        BasicFlatObject3D<T>& transformLocal(const MatrixType& transformation) {
+            return setTransformation(this->transformation()*transformation);
+        }
+
+        /**
+         * @brief Translate the object
+         * @return Reference to self (for method chaining)
+         *
+         * Same as calling @ref transform() with
+         * @ref Math::Matrix4::translation().
+         */
+        BasicFlatObject3D<T>& translate(const Math::Vector3<T>& vector) {
+            return transform(MatrixType::translation(vector));
+        }
+
+        /**
+         * @brief Rotate the object
+         * @param angle             Angle (counterclockwise)
+         * @param normalizedAxis    Normalized rotation axis
+         * @return Reference to self (for method chaining)
+         *
+         * Same as calling @ref transform() with
+         * @ref Math::Matrix4::rotation().
+         */
+        BasicFlatObject3D<T>& rotate(Math::Rad<T> angle, const Math::Vector3<T>& normalizedAxis) {
+            return transform(MatrixType::rotation(angle, normalizedAxis));
+        }
+
+        /**
+         * @brief Scale the object
+         * @return Reference to self (for method chaining)
+         *
+         * Same as calling @ref transform() with
+         * @ref Math::Matrix4::scaling().
+         */
+        BasicFlatObject3D<T>& scale(const Math::Vector3<T>& vector) {
+            return transform(MatrixType::scaling(vector));
+        }
+
+        /**
+         * @brief Transformation relative to the scene
+         *
+         * If the object is clean, the value is fetched from
+         * @ref BasicFlatScene3D::absoluteTransformations(), otherwise it's
+         * calculated by going up the hierarchy.
+         */
+        MatrixType absoluteTransformation() const;
+
+        /**
+         * @brief Whether absolute transformation is dirty
+         *
+         * @see @ref setDirty(), @ref setClean(),
+         *      @ref BasicFlatScene3D::updateAbsoluteTransformations()
+         */
+        bool isDirty() const { return _scene._dirty[_id]; }
+
+        /**
+         * @brief Set object absolute transformation as dirty
+         *
+         * Calls @ref AbstractFeature::markDirty() on all object features and
+         * recursively calls @ref setDirty() on every child object which is
+         * not already dirty. If the object is already marked as dirty, the
+         * function does nothing. Called implicitly when the transformation
+         * or parent is changed.
+         */
+        void setDirty();
+
+        /**
+         * @brief Clean object absolute transformation
+         *
+         * Calculates absolute transformation of this object and all its dirty
+         * parents, cleans their features and marks them as clean. If the
+         * object is already clean, the function does nothing. Prefer to use
+         * @ref BasicFlatScene3D::updateAbsoluteTransformations() when
+         * cleaning many objects at once.
+         */
+        void setClean();
+
+    private:
+        #ifndef DOXYGEN_GENERATING_OUTPUT /* https://bugzilla.gnome.org/show_bug.cgi?id=776986 */
+        friend BasicFlatScene3D<T>;
+        #endif
+
+        AbstractObject<3, T>* doScene() override final { return &_scene; }
+        const AbstractObject<3, T>* doScene() const override final { return &_scene; }
+
+        AbstractObject<3, T>* doParent() override final;
+        const AbstractObject<3, T>* doParent() const override final;
+
+        MatrixType doTransformationMatrix() const override final { return transformation(); }
+        MatrixType doAbsoluteTransformationMatrix() const override final { return absoluteTransformation(); }
+        std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<3, T>>>& objects, const MatrixType& finalTransformationMatrix) const override final;
+        void doTransformationMatricesInto(const Containers::ArrayView<const Containers::Reference<AbstractObject<3, T>>>& objects, const Containers::StridedArrayView1D<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix, ParallelFor parallelFor, void* parallelForState) const override final;
+
+        bool doIsDirty() const override final { return isDirty(); }
+        void doSetDirty() override final { setDirty(); }
+        void doSetClean() override final { setClean(); }
+        void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<3, T>>>& objects) override final;
+        void doSetClean(const Containers::ArrayView<const Containers::Reference<AbstractObject<3, T>>>& objects, ParallelFor parallelFor, void* parallelForState) override final;
+
+        void MAGNUM_SCENEGRAPH_LOCAL unlink();
+        void MAGNUM_SCENEGRAPH_LOCAL link(UnsignedInt parent);
+        void MAGNUM_SCENEGRAPH_LOCAL cleanInternal(const MatrixType& absoluteTransformation);
+
+        BasicFlatScene3D<T>& _scene;
+        UnsignedInt _id;
+};
+
+/**
+@brief Three-dimensional float scene with contiguous transformation storage
+@m_since_latest
+
+@see @ref FlatObject3D
+*/
+typedef BasicFlatScene3D<Float> FlatScene3D;
+
+/**
+@brief Object in a three-dimensional float scene with contiguous transformation storage
+@m_since_latest
+
+@see @ref FlatScene3D
+*/
+typedef BasicFlatObject3D<Float> FlatObject3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !(defined(CORRADE_TARGET_MINGW) && !defined(CORRADE_TARGET_CLANG))
+extern template class MAGNUM_SCENEGRAPH_EXPORT BasicFlatScene3D<Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT BasicFlatObject3D<Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,432 @@
+#ifndef Magnum_SceneGraph_FlatScene_hpp
+#define Magnum_SceneGraph_FlatScene_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref FlatScene.h
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Reference.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/FlatScene.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<class T> BasicFlatScene3D<T>::BasicFlatScene3D(): _objectCount{}, _firstChild{~UnsignedInt{}}, _lastChild{~UnsignedInt{}}, _orderDirty{true} {}
+
+template<class T> BasicFlatScene3D<T>::~BasicFlatScene3D() {
+    /* Deleting the object removes it from the list, so the first child is
+       always a different one. Objects that aren't top-level get deleted
+       recursively by their parents. */
+    while(_firstChild != ~UnsignedInt{})
+        delete _objects[_firstChild];
+}
+
+template<class T> BasicFlatObject3D<T>* BasicFlatScene3D<T>::object(const UnsignedInt id) {
+    CORRADE_ASSERT(id < _objects.size(),
+        "SceneGraph::FlatScene3D::object(): index" << id << "out of range for" << _objects.size() << "objects", {});
+    return _objects[id];
+}
+
+template<class T> const BasicFlatObject3D<T>* BasicFlatScene3D<T>::object(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _objects.size(),
+        "SceneGraph::FlatScene3D::object(): index" << id << "out of range for" << _objects.size() << "objects", {});
+    return _objects[id];
+}
+
+template<class T> void BasicFlatScene3D<T>::updateOrder() {
+    /* Breadth-first traversal, which puts the objects in an order where all
+       objects at the same depth are next to each other and after all their
+       parents */
+    arrayResize(_order, NoInit, _objectCount);
+    arrayResize(_levelOffsets, NoInit, 1);
+    _levelOffsets[0] = 0;
+
+    std::size_t end = 0;
+    for(UnsignedInt i = _firstChild; i != ~UnsignedInt{}; i = _nextSiblings[i])
+        _order[end++] = i;
+    arrayAppend(_levelOffsets, UnsignedInt(end));
+
+    std::size_t levelBegin = 0;
+    while(levelBegin != end) {
+        const std::size_t levelEnd = end;
+        for(std::size_t j = levelBegin; j != levelEnd; ++j)
+            for(UnsignedInt i = _firstChildren[_order[j]]; i != ~UnsignedInt{}; i = _nextSiblings[i])
+                _order[end++] = i;
+        if(end != levelEnd)
+            arrayAppend(_levelOffsets, UnsignedInt(end));
+        levelBegin = levelEnd;
+    }
+
+    CORRADE_INTERNAL_ASSERT(end == _objectCount);
+    _orderDirty = false;
+}
+
+template<class T> void BasicFlatScene3D<T>::updateAbsoluteTransformations(const ParallelFor parallelFor, void* const parallelForState) {
+    if(_orderDirty) updateOrder();
+
+    /* Calculate the absolute transformations. As all children of a dirty
+       object are dirty as well, the parent transformation is always up to
+       date when calculating a dirty object. */
+    if(!parallelFor) {
+        for(const UnsignedInt i: _order) {
+            if(!_dirty[i]) continue;
+            const UnsignedInt parent = _parents[i];
+            _absoluteTransformations[i] = parent == ~UnsignedInt{} ?
+                _transformations[i] :
+                _absoluteTransformations[parent]*_transformations[i];
+        }
+
+    /* In parallel, process each depth level separately, as there are no
+       dependencies between objects in the same level */
+    } else {
+        struct State {
+            Containers::ArrayView<const UnsignedInt> order;
+            Containers::ArrayView<const UnsignedInt> parents;
+            Containers::ArrayView<const bool> dirty;
+            Containers::ArrayView<const MatrixType> transformations;
+            Containers::ArrayView<MatrixType> absoluteTransformations;
+            std::size_t begin, end;
+        } state{_order, _parents, _dirty, _transformations, _absoluteTransformations, 0, 0};
+
+        /* Objects in a level are split into chunks of this size */
+        constexpr std::size_t ChunkSize = 1024;
+
+        for(std::size_t level = 0; level + 1 < _levelOffsets.size(); ++level) {
+            state.begin = _levelOffsets[level];
+            state.end = _levelOffsets[level + 1];
+            parallelFor(parallelForState, (state.end - state.begin + ChunkSize - 1)/ChunkSize, [](void* taskState, std::size_t chunk) {
+                const State& state = *static_cast<const State*>(taskState);
+                const std::size_t end = Math::min(state.begin + (chunk + 1)*ChunkSize, state.end);
+                for(std::size_t j = state.begin + chunk*ChunkSize; j != end; ++j) {
+                    const UnsignedInt i = state.order[j];
+                    if(!state.dirty[i]) continue;
+                    const UnsignedInt parent = state.parents[i];
+                    state.absoluteTransformations[i] = parent == ~UnsignedInt{} ?
+                        state.transformations[i] :
+                        state.absoluteTransformations[parent]*state.transformations[i];
+                }
+            }, &state);
+        }
+    }
+
+    /* Clean the features. This calls into user code, which isn't required to
+       be thread-safe, so it's done serially. */
+    for(const UnsignedInt i: _order) {
+        if(!_dirty[i]) continue;
+        _objects[i]->cleanInternal(_absoluteTransformations[i]);
+    }
+}
+
+template<class T> auto BasicFlatScene3D<T>::absoluteTransformationOf(const AbstractObject<3, T>& object) const -> MatrixType {
+    /* The scene itself has an identity transformation */
+    if(&object == this) return {};
+
+    /** @todo Ensure this doesn't crash, somehow */
+    const BasicFlatObject3D<T>& flatObject = static_cast<const BasicFlatObject3D<T>&>(object);
+    CORRADE_ASSERT(&flatObject._scene == this,
+        "SceneGraph::FlatScene3D::transformationMatrices(): the objects are not part of the same scene", {});
+    return flatObject.absoluteTransformation();
+}
+
+template<class T> auto BasicFlatScene3D<T>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<3, T>>>& objects, const MatrixType& finalTransformationMatrix) const -> std::vector<MatrixType> {
+    std::vector<MatrixType> transformationMatrices;
+    transformationMatrices.reserve(objects.size());
+    for(const AbstractObject<3, T>& object: objects)
+        transformationMatrices.push_back(finalTransformationMatrix*absoluteTransformationOf(object));
+    return transformationMatrices;
+}
+
+template<class T> void BasicFlatScene3D<T>::doTransformationMatricesInto(const Containers::ArrayView<const Containers::Reference<AbstractObject<3, T>>>& objects, const Containers::StridedArrayView1D<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix, const ParallelFor parallelFor, void* const parallelForState) const {
+    CORRADE_ASSERT(transformationMatrices.size() == objects.size(),
+        "SceneGraph::FlatScene3D::transformationMatricesInto(): expected" << objects.size() << "transformations but got" << transformationMatrices.size(), );
+
+    if(!parallelFor) {
+        for(std::size_t i = 0; i != objects.size(); ++i)
+            transformationMatrices[i] = finalTransformationMatrix*absoluteTransformationOf(objects[i]);
+        return;
+    }
+
+    /* For clean objects it's just a lookup and a multiplication, for dirty
+       objects a walk up the hierarchy that only reads the data, so it's safe
+       to be done in parallel */
+    struct State {
+        const BasicFlatScene3D<T>& scene;
+        const Containers::ArrayView<const Containers::Reference<AbstractObject<3, T>>>& objects;
+        const Containers::StridedArrayView1D<MatrixType>& transformationMatrices;
+        const MatrixType& finalTransformationMatrix;
+    } state{*this, objects, transformationMatrices, finalTransformationMatrix};
+
+    /* Objects are split into chunks of this size */
+    constexpr std::size_t ChunkSize = 1024;
+
+    parallelFor(parallelForState, (objects.size() + ChunkSize - 1)/ChunkSize, [](void* taskState, std::size_t chunk) {
+        const State& state = *static_cast<const State*>(taskState);
+        const std::size_t end = Math::min((chunk + 1)*ChunkSize, state.objects.size());
+        for(std::size_t i = chunk*ChunkSize; i != end; ++i)
+            state.transformationMatrices[i] = state.finalTransformationMatrix*state.scene.absoluteTransformationOf(state.objects[i]);
+    }, &state);
+}
+
+template<class T> void BasicFlatScene3D<T>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<3, T>>>& objects) {
+    for(AbstractObject<3, T>& object: objects)
+        object.setClean();
+}
+
+template<class T> void BasicFlatScene3D<T>::doSetClean(const Containers::ArrayView<const Containers::Reference<AbstractObject<3, T>>>& objects, ParallelFor, void*) {
+    for(const Containers::Reference<AbstractObject<3, T>>& object: objects)
+        object->setClean();
+}
+
+template<class T> BasicFlatObject3D<T>::BasicFlatObject3D(BasicFlatScene3D<T>& scene, BasicFlatObject3D<T>* const parent): _scene(scene) {
+    /* Reuse a free ID, if there's any */
+    if(!scene._freeIds.isEmpty()) {
+        _id = scene._freeIds.back();
+        arrayRemoveSuffix(scene._freeIds);
+        scene._objects[_id] = this;
+        scene._transformations[_id] = {};
+    } else {
+        _id = scene._objects.size();
+        arrayAppend(scene._objects, this);
+        arrayAppend(scene._parents, ~UnsignedInt{});
+        arrayAppend(scene._firstChildren, ~UnsignedInt{});
+        arrayAppend(scene._lastChildren, ~UnsignedInt{});
+        arrayAppend(scene._previousSiblings, ~UnsignedInt{});
+        arrayAppend(scene._nextSiblings, ~UnsignedInt{});
+        arrayAppend(scene._transformations, InPlaceInit);
+        arrayAppend(scene._absoluteTransformations, InPlaceInit);
+        arrayAppend(scene._dirty, true);
+    }
+
+    scene._dirty[_id] = true;
+    ++scene._objectCount;
+
+    /* The object is added to the scene even if the parent is invalid so the
+       destructor doesn't need to handle a partially constructed instance */
+    link(parent && &parent->_scene == &scene ? parent->_id : ~UnsignedInt{});
+    CORRADE_ASSERT(!parent || &parent->_scene == &scene,
+        "SceneGraph::FlatObject3D: parent is not a part of the scene", );
+}
+
+template<class T> BasicFlatObject3D<T>::~BasicFlatObject3D() {
+    /* Delete all children. Deleting removes the child from the list, so the
+       first child is always a different one. */
+    while(_scene._firstChildren[_id] != ~UnsignedInt{})
+        delete _scene._objects[_scene._firstChildren[_id]];
+
+    unlink();
+    _scene._objects[_id] = nullptr;
+    arrayAppend(_scene._freeIds, _id);
+    --_scene._objectCount;
+}
+
+template<class T> void BasicFlatObject3D<T>::unlink() {
+    const UnsignedInt parent = _scene._parents[_id];
+    const UnsignedInt previous = _scene._previousSiblings[_id];
+    const UnsignedInt next = _scene._nextSiblings[_id];
+
+    if(previous != ~UnsignedInt{}) _scene._nextSiblings[previous] = next;
+    else if(parent != ~UnsignedInt{}) _scene._firstChildren[parent] = next;
+    else _scene._firstChild = next;
+
+    if(next != ~UnsignedInt{}) _scene._previousSiblings[next] = previous;
+    else if(parent != ~UnsignedInt{}) _scene._lastChildren[parent] = previous;
+    else _scene._lastChild = previous;
+
+    _scene._parents[_id] = ~UnsignedInt{};
+    _scene._previousSiblings[_id] = ~UnsignedInt{};
+    _scene._nextSiblings[_id] = ~UnsignedInt{};
+    _scene._orderDirty = true;
+}
+
+template<class T> void BasicFlatObject3D<T>::link(const UnsignedInt parent) {
+    /* Append as the last child */
+    UnsignedInt& last = parent == ~UnsignedInt{} ? _scene._lastChild : _scene._lastChildren[parent];
+    if(last != ~UnsignedInt{}) _scene._nextSiblings[last] = _id;
+    else (parent == ~UnsignedInt{} ? _scene._firstChild : _scene._firstChildren[parent]) = _id;
+
+    _scene._parents[_id] = parent;
+    _scene._previousSiblings[_id] = last;
+    _scene._nextSiblings[_id] = ~UnsignedInt{};
+    last = _id;
+    _scene._orderDirty = true;
+}
+
+template<class T> BasicFlatObject3D<T>* BasicFlatObject3D<T>::parent() {
+    const UnsignedInt parent = _scene._parents[_id];
+    return parent == ~UnsignedInt{} ? nullptr : _scene._objects[parent];
+}
+
+template<class T> const BasicFlatObject3D<T>* BasicFlatObject3D<T>::parent() const {
+    const UnsignedInt parent = _scene._parents[_id];
+    return parent == ~UnsignedInt{} ? nullptr : _scene._objects[parent];
+}
+
+template<class T> AbstractObject<3, T>* BasicFlatObject3D<T>::doParent() {
+    /* Top-level objects have the scene as a parent, same as Object */
+    BasicFlatObject3D<T>* const parent = this->parent();
+    return parent ? static_cast<AbstractObject<3, T>*>(parent) : &_scene;
+}
+
+template<class T> const AbstractObject<3, T>* BasicFlatObject3D<T>::doParent() const {
+    const BasicFlatObject3D<T>* const parent = this->parent();
+    return parent ? static_cast<const AbstractObject<3, T>*>(parent) : &_scene;
+}
+
+template<class T> BasicFlatObject3D<T>& BasicFlatObject3D<T>::setParent(BasicFlatObject3D<T>* const parent) {
+    CORRADE_ASSERT(!parent || &parent->_scene == &_scene,
+        "SceneGraph::FlatObject3D::setParent(): the parent is not a part of the same scene", *this);
+
+    /* Skip if the parent is already the same */
+    if(parent == this->parent()) return *this;
+
+    /* Object cannot be a parent of itself or of any of its parents */
+    for(const BasicFlatObject3D<T>* p = parent; p; p = p->parent())
+        CORRADE_ASSERT(p != this, "SceneGraph::FlatObject3D::setParent(): the object is the new parent or one of its parents", *this);
+
+    unlink();
+    link(parent ? parent->_id : ~UnsignedInt{});
+    setDirty();
+    return *this;
+}
+
+template<class T> BasicFlatObject3D<T>& BasicFlatObject3D<T>::setTransformation(const MatrixType& transformation) {
+    _scene._transformations[_id] = transformation;
+    setDirty();
+    return *this;
+}
+
+template<class T> auto BasicFlatObject3D<T>::absoluteTransformation() const -> MatrixType {
+    /* Clean objects have the transformation calculated already */
+    if(!isDirty()) return _scene._absoluteTransformations[_id];
+
+    /* Otherwise go up until a clean parent or the scene is found. All
+       children of a dirty object are dirty as well, so there's no need to
+       check anything else. */
+    MatrixType transformation = _scene._transformations[_id];
+    for(UnsignedInt i = _scene._parents[_id]; i != ~UnsignedInt{}; i = _scene._parents[i]) {
+        if(!_scene._dirty[i]) {
+            transformation = _scene._absoluteTransformations[i]*transformation;
+            break;
+        }
+
+        transformation = _scene._transformations[i]*transformation;
+    }
+
+    return transformation;
+}
+
+template<class T> void BasicFlatObject3D<T>::setDirty() {
+    /* The transformation of this object (and all children) is already dirty,
+       nothing to do */
+    if(_scene._dirty[_id]) return;
+
+    /* Make all features dirty */
+    for(AbstractFeature<3, T>& feature: this->features())
+        feature.markDirty();
+
+    /* Make all children dirty */
+    for(UnsignedInt i = _scene._firstChildren[_id]; i != ~UnsignedInt{}; i = _scene._nextSiblings[i])
+        _scene._objects[i]->setDirty();
+
+    /* Mark object as dirty */
+    _scene._dirty[_id] = true;
+}
+
+template<class T> void BasicFlatObject3D<T>::setClean() {
+    /* The object (and all its parents) are already clean, nothing to do */
+    if(!isDirty()) return;
+
+    /* Collect all dirty parents, as all children of a dirty object are dirty
+       as well, they're all directly above this object */
+    Containers::Array<BasicFlatObject3D<T>*> objects;
+    for(BasicFlatObject3D<T>* o = this; o && o->isDirty(); o = o->parent())
+        arrayAppend(objects, o);
+
+    /* Calculate the transformations from the top and clean the objects */
+    for(std::size_t i = objects.size(); i != 0; --i) {
+        BasicFlatObject3D<T>& o = *objects[i - 1];
+        const UnsignedInt parent = _scene._parents[o._id];
+        _scene._absoluteTransformations[o._id] = parent == ~UnsignedInt{} ?
+            _scene._transformations[o._id] :
+            _scene._absoluteTransformations[parent]*_scene._transformations[o._id];
+        o.cleanInternal(_scene._absoluteTransformations[o._id]);
+    }
+}
+
+template<class T> void BasicFlatObject3D<T>::cleanInternal(const MatrixType& absoluteTransformation) {
+    /* "Lazy storage" for inverted transformation matrix */
+    bool invertedCalculated = false;
+    MatrixType invertedMatrix;
+
+    /* Clean all features */
+    for(AbstractFeature<3, T>& feature: this->features()) {
+        if(feature.cachedTransformations() & CachedTransformation::Absolute)
+            feature.clean(absoluteTransformation);
+
+        /* Cached inverse absolute transformation, compute it if it wasn't
+            computed already */
+        if(feature.cachedTransformations() & CachedTransformation::InvertedAbsolute) {
+            if(!invertedCalculated) {
+                invertedCalculated = true;
+                invertedMatrix = absoluteTransformation.inverted();
+            }
+
+            feature.cleanInverted(invertedMatrix);
+        }
+    }
+
+    /* Mark object as clean */
+    _scene._dirty[_id] = false;
+}
+
+template<class T> auto BasicFlatObject3D<T>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<3, T>>>&, const MatrixType&) const -> std::vector<MatrixType> {
+    CORRADE_ASSERT_UNREACHABLE("SceneGraph::FlatObject3D::transformationMatrices(): currently implemented only for FlatScene3D", {});
+}
+
+template<class T> void BasicFlatObject3D<T>::doTransformationMatricesInto(const Containers::ArrayView<const Containers::Reference<AbstractObject<3, T>>>&, const Containers::StridedArrayView1D<MatrixType>&, const MatrixType&, ParallelFor, void*) const {
+    CORRADE_ASSERT_UNREACHABLE("SceneGraph::FlatObject3D::transformationMatricesInto(): currently implemented only for FlatScene3D", );
+}
+
+template<class T> void BasicFlatObject3D<T>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<3, T>>>& objects) {
+    for(AbstractObject<3, T>& object: objects)
+        object.setClean();
+}
+
+template<class T> void BasicFlatObject3D<T>::doSetClean(const Containers::ArrayView<const Containers::Reference<AbstractObject<3, T>>>& objects, ParallelFor, void*) {
+    for(const Containers::Reference<AbstractObject<3, T>>& object: objects)
+        object->setClean();
+}
+
+}}
+
+#endif
@@ -317,6 +317,55 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
             #endif
             ) const;
 
+        /**
+         * @brief Transformations of given group of objects relative to this object into an existing array
+         * @param[in]  objects              Objects to calculate the
+         *      transformations for
+         * @param[out] transformations      Where to put the calculated
+         *      transformations
+         * @param[in]  finalTransformation  Transformation to apply on the
+         *      left-most side
+         * @param[in]  parallelFor          Parallel loop executor
+         * @param[in]  parallelForState     State pointer to pass to
+         *      @p parallelFor
+         * @m_since_latest
+         *
+         * Like @ref transformations(), but takes a view instead of a
+         * @ref std::vector and puts the result into @p transformations, which
+         * is expected to have the same size as @p objects. The objects and
+         * all their parents are first collected into a contiguous array
+         * ordered so each parent is before its children, and the absolute
+         * transformations are then calculated in a single linear pass over
+         * it, calculating the transformation of each object exactly once.
+         *
+         * If @p parallelFor is not @cpp nullptr @ce, the collected objects
+         * are additionally sorted by their depth in the hierarchy and each
+         * level is processed in parallel using @p parallelFor, as the parents
+         * of all objects in a level are already calculated in the levels
+         * before. The result is the same regardless of the count of threads
+         * used. Deep and narrow hierarchies gain little from this, wide
+         * hierarchies with many objects at the same depth benefit the most.
+         * @see @ref transformationMatricesInto()
+         */
+        void transformationsInto(const Containers::ArrayView<const Containers::Reference<Object<Transformation>>>& objects, const Containers::StridedArrayView1D<typename Transformation::DataType>& transformations, const typename Transformation::DataType& finalTransformation =
+            #ifndef CORRADE_MSVC2015_COMPATIBILITY /* I hate this inconsistency */
+            typename Transformation::DataType()
+            #else
+            Transformation::DataType()
+            #endif
+            , ParallelFor parallelFor = nullptr, void* parallelForState = nullptr) const;
+
+        /**
+         * @brief Transformation matrices of given set of objects relative to this object into an existing array
+         * @m_since_latest
+         *
+         * Calls @ref transformationsInto() and converts the result to
+         * matrices. The @p transformationMatrices view is expected to have
+         * the same size as @p objects.
+         * @see @ref transformationMatrices()
+         */
+        void transformationMatricesInto(const Containers::ArrayView<const Containers::Reference<Object<Transformation>>>& objects, const Containers::StridedArrayView1D<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix = MatrixType(), ParallelFor parallelFor = nullptr, void* parallelForState = nullptr) const;
+
         /* Since 1.8.17, the original short-hand group closing doesn't work
            anymore. FFS. */
         /**
@@ -338,6 +387,22 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         /* `objects` passed by copy intentionally (to avoid copy internally) */
         static void setClean(std::vector<std::reference_wrapper<Object<Transformation>>> objects);
 
+        /**
+         * @brief Clean absolute transformations of given set of objects, optionally in parallel
+         * @m_since_latest
+         *
+         * Like @ref setClean(std::vector<std::reference_wrapper<Object<Transformation>>>),
+         * but takes a view instead of a @ref std::vector and calculates the
+         * absolute transformations of all dirty objects and their dirty
+         * parents using @ref transformationsInto(), passing @p parallelFor
+         * through. If @p parallelFor is @cpp nullptr @ce, the calculation is
+         * done serially. Calling @ref AbstractFeature::clean() and
+         * @ref AbstractFeature::cleanInverted() on the features is always
+         * done serially on the calling thread, as the features aren't
+         * required to be thread-safe.
+         */
+        static void setClean(const Containers::ArrayView<const Containers::Reference<Object<Transformation>>>& objects, ParallelFor parallelFor, void* parallelForState = nullptr);
+
         /** @copydoc AbstractObject::isDirty() */
         bool isDirty() const { return !!(flags & Flag::Dirty); }
 
@@ -401,6 +466,7 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         }
 
         std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& finalTransformationMatrix) const override final;
+        void doTransformationMatricesInto(const Containers::ArrayView<const Containers::Reference<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const Containers::StridedArrayView1D<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix, ParallelFor parallelFor, void* parallelForState) const override final;
 
         typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& finalTransformation) const;
 
@@ -408,6 +474,7 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final { setDirty(); }
         void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final { setClean(); }
         void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) override final;
+        void doSetClean(const Containers::ArrayView<const Containers::Reference<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, ParallelFor parallelFor, void* parallelForState) override final;
 
         void MAGNUM_SCENEGRAPH_LOCAL setCleanInternal(const typename Transformation::DataType& absoluteTransformation);
 
@@ -32,6 +32,10 @@
 
 #include <algorithm> /* std::remove_if() */
 #include <stack>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Functions.h"
 
 #include "Magnum/SceneGraph/AbstractTransformation.h"
 #include "Magnum/SceneGraph/Object.h"
@@ -335,6 +339,164 @@ template<class Transformation> typename Transformation::DataType Object<Transfor
     }
 }
 
+template<class Transformation> void Object<Transformation>::doTransformationMatricesInto(const Containers::ArrayView<const Containers::Reference<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const Containers::StridedArrayView1D<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix, const ParallelFor parallelFor, void* const parallelForState) const {
+    Containers::Array<Containers::Reference<Object<Transformation>>> castObjects;
+    arrayReserve(castObjects, objects.size());
+    /** @todo Ensure this doesn't crash, somehow */
+    for(const Containers::Reference<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>& o: objects)
+        arrayAppend(castObjects, InPlaceInit, static_cast<Object<Transformation>&>(*o));
+
+    transformationMatricesInto(castObjects, transformationMatrices, finalTransformationMatrix, parallelFor, parallelForState);
+}
+
+template<class Transformation> void Object<Transformation>::transformationMatricesInto(const Containers::ArrayView<const Containers::Reference<Object<Transformation>>>& objects, const Containers::StridedArrayView1D<MatrixType>& transformationMatrices, const MatrixType& finalTransformationMatrix, const ParallelFor parallelFor, void* const parallelForState) const {
+    CORRADE_ASSERT(transformationMatrices.size() == objects.size(),
+        "SceneGraph::Object::transformationMatricesInto(): expected" << objects.size() << "transformations but got" << transformationMatrices.size(), );
+
+    Containers::Array<typename Transformation::DataType> transformations{NoInit, objects.size()};
+    transformationsInto(objects, transformations, Implementation::Transformation<Transformation>::fromMatrix(finalTransformationMatrix), parallelFor, parallelForState);
+    for(std::size_t i = 0; i != objects.size(); ++i)
+        transformationMatrices[i] = Implementation::Transformation<Transformation>::toMatrix(transformations[i]);
+}
+
+/*
+Computing absolute transformations for given list of objects in batches
+
+Compared to transformations(), all objects and their parents are first
+collected into a flat array, with parents always before their children. Each
+entry references its parent by an index, so the absolute transformations can
+be then calculated in a single linear pass over contiguous memory without
+any recursion. For the parallel variant the entries are additionally sorted
+by depth and each depth level is processed as a whole, as there are no
+dependencies between objects of the same level.
+*/
+template<class Transformation> void Object<Transformation>::transformationsInto(const Containers::ArrayView<const Containers::Reference<Object<Transformation>>>& objects, const Containers::StridedArrayView1D<typename Transformation::DataType>& transformations, const typename Transformation::DataType& finalTransformation, const ParallelFor parallelFor, void* const parallelForState) const {
+    CORRADE_ASSERT(transformations.size() == objects.size(),
+        "SceneGraph::Object::transformationsInto(): expected" << objects.size() << "transformations but got" << transformations.size(), );
+
+    /* Nearest common ancestor not yet implemented - assert this is done on
+       scene */
+    #ifndef CORRADE_NO_ASSERT
+    const Scene<Transformation>* scene = this->scene();
+    #endif
+    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationsInto(): currently implemented only for Scene", );
+
+    /* Collect all objects and their parents. Every object is added only once,
+       the Visited flag marks objects that are already in the list and the
+       counter is the index in it. */
+    Containers::Array<Object<Transformation>*> nodes;
+    Containers::Array<UnsignedInt> parents;
+    Containers::Array<UnsignedInt> depths;
+    Containers::Array<Object<Transformation>*> path;
+    for(const Containers::Reference<Object<Transformation>>& object: objects) {
+        /* Go up until an already added object or the root is found */
+        arrayResize(path, 0);
+        Object<Transformation>* o = &object.get();
+        while(o && !(o->flags & Flag::Visited)) {
+            o->flags |= Flag::Visited;
+            arrayAppend(path, o);
+            o = o->parent();
+        }
+
+        /* If the root was reached, it has to be this object. If not, clean up
+           the marks first so the objects are usable after a graceful
+           assert. */
+        #ifndef CORRADE_NO_ASSERT
+        const bool sameTree = o || path.back() == this;
+        if(!sameTree) {
+            for(Object<Transformation>* i: nodes) {
+                i->flags &= ~Flag::Visited;
+                i->counter = ~UnsignedInt{};
+            }
+            for(Object<Transformation>* i: path)
+                i->flags &= ~Flag::Visited;
+        }
+        CORRADE_ASSERT(sameTree,
+            "SceneGraph::Object::transformationsInto(): the objects are not part of the same tree", );
+        #endif
+
+        /* Add the path in reverse, i.e. going from the parent down */
+        for(std::size_t i = path.size(); i != 0; --i) {
+            Object<Transformation>* const p = path[i - 1];
+            const UnsignedInt parent = i != path.size() ? UnsignedInt(nodes.size() - 1) :
+                o ? o->counter : ~UnsignedInt{};
+            p->counter = nodes.size();
+            arrayAppend(nodes, p);
+            arrayAppend(parents, parent);
+            arrayAppend(depths, parent == ~UnsignedInt{} ? 0 : depths[parent] + 1);
+        }
+    }
+
+    /* Calculate the absolute transformations. Serially it's just a linear
+       pass as parents are always before children. */
+    Containers::Array<typename Transformation::DataType> absolute{NoInit, nodes.size()};
+    if(!parallelFor) {
+        for(std::size_t i = 0; i != nodes.size(); ++i)
+            absolute[i] = Implementation::Transformation<Transformation>::compose(
+                parents[i] == ~UnsignedInt{} ? finalTransformation : absolute[parents[i]],
+                nodes[i]->transformation());
+
+    /* In parallel, sort the nodes by depth using a counting sort and process
+       each level separately */
+    } else {
+        UnsignedInt maxDepth = 0;
+        for(const UnsignedInt depth: depths)
+            maxDepth = Math::max(maxDepth, depth);
+        Containers::Array<UnsignedInt> levelOffsets{ValueInit, std::size_t(maxDepth) + 2};
+        for(const UnsignedInt depth: depths)
+            ++levelOffsets[depth + 1];
+        for(std::size_t i = 1; i != levelOffsets.size(); ++i)
+            levelOffsets[i] += levelOffsets[i - 1];
+        Containers::Array<UnsignedInt> order{NoInit, nodes.size()};
+        {
+            Containers::Array<UnsignedInt> levelFill{NoInit, levelOffsets.size() - 1};
+            for(std::size_t i = 0; i != levelFill.size(); ++i)
+                levelFill[i] = levelOffsets[i];
+            for(std::size_t i = 0; i != nodes.size(); ++i)
+                order[levelFill[depths[i]]++] = i;
+        }
+
+        struct State {
+            Containers::ArrayView<Object<Transformation>* const> nodes;
+            Containers::ArrayView<const UnsignedInt> parents;
+            Containers::ArrayView<const UnsignedInt> order;
+            Containers::ArrayView<typename Transformation::DataType> absolute;
+            const typename Transformation::DataType* finalTransformation;
+            std::size_t begin, end;
+        } state{nodes, parents, order, absolute, &finalTransformation, 0, 0};
+
+        /* Objects in a level are split into chunks of this size */
+        constexpr std::size_t ChunkSize = 1024;
+
+        for(std::size_t level = 0; level != levelOffsets.size() - 1; ++level) {
+            state.begin = levelOffsets[level];
+            state.end = levelOffsets[level + 1];
+            parallelFor(parallelForState, (state.end - state.begin + ChunkSize - 1)/ChunkSize, [](void* taskState, std::size_t chunk) {
+                const State& state = *static_cast<const State*>(taskState);
+                const std::size_t end = Math::min(state.begin + (chunk + 1)*ChunkSize, state.end);
+                for(std::size_t j = state.begin + chunk*ChunkSize; j != end; ++j) {
+                    const UnsignedInt i = state.order[j];
+                    const UnsignedInt parent = state.parents[i];
+                    state.absolute[i] = Implementation::Transformation<Transformation>::compose(
+                        parent == ~UnsignedInt{} ? *state.finalTransformation : state.absolute[parent],
+                        state.nodes[i]->transformation());
+                }
+            }, &state);
+        }
+    }
+
+    /* Copy the transformations out. Duplicate objects are handled implicitly
+       as they all point to the same node. */
+    for(std::size_t i = 0; i != objects.size(); ++i)
+        transformations[i] = absolute[objects[i]->counter];
+
+    /* Clean up all marks */
+    for(Object<Transformation>* i: nodes) {
+        i->flags &= ~Flag::Visited;
+        i->counter = ~UnsignedInt{};
+    }
+}
+
 template<class Transformation> void Object<Transformation>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) {
     std::vector<std::reference_wrapper<Object<Transformation>>> castObjects;
     castObjects.reserve(objects.size());
@@ -383,6 +545,50 @@ template<class Transformation> void Object<Transformation>::setClean(std::vector
     }
 }
 
+template<class Transformation> void Object<Transformation>::doSetClean(const Containers::ArrayView<const Containers::Reference<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const ParallelFor parallelFor, void* const parallelForState) {
+    Containers::Array<Containers::Reference<Object<Transformation>>> castObjects;
+    arrayReserve(castObjects, objects.size());
+    /** @todo Ensure this doesn't crash, somehow */
+    for(const Containers::Reference<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>& o: objects)
+        arrayAppend(castObjects, InPlaceInit, static_cast<Object<Transformation>&>(*o));
+
+    setClean(castObjects, parallelFor, parallelForState);
+}
+
+template<class Transformation> void Object<Transformation>::setClean(const Containers::ArrayView<const Containers::Reference<Object<Transformation>>>& objects, const ParallelFor parallelFor, void* const parallelForState) {
+    /* Collect all dirty objects and their dirty parents. Mark each added
+       object as visited, so they aren't added more than once. */
+    Containers::Array<Containers::Reference<Object<Transformation>>> dirtyObjects;
+    for(const Containers::Reference<Object<Transformation>>& object: objects) {
+        Object<Transformation>* o = &object.get();
+        while(o && !(o->flags & Flag::Visited) && o->isDirty()) {
+            o->flags |= Flag::Visited;
+            arrayAppend(dirtyObjects, InPlaceInit, *o);
+            o = o->parent();
+        }
+    }
+
+    /* Cleanup all marks */
+    for(const Containers::Reference<Object<Transformation>>& o: dirtyObjects)
+        o->flags &= ~Flag::Visited;
+
+    /* No dirty objects, done */
+    if(dirtyObjects.isEmpty()) return;
+
+    /* Compute absolute transformations */
+    Scene<Transformation>* scene = dirtyObjects[0]->scene();
+    CORRADE_ASSERT(scene, "SceneGraph::Object::setClean(): objects must be part of some scene", );
+    Containers::Array<typename Transformation::DataType> transformations{NoInit, dirtyObjects.size()};
+    scene->transformationsInto(dirtyObjects, transformations, typename Transformation::DataType(), parallelFor, parallelForState);
+
+    /* Go through all objects and clean them. This calls into features, which
+       aren't required to be thread-safe, so it's done serially. */
+    for(std::size_t i = 0; i != dirtyObjects.size(); ++i) {
+        dirtyObjects[i]->setCleanInternal(transformations[i]);
+        CORRADE_ASSERT(!dirtyObjects[i]->isDirty(), "SceneGraph::Object::setClean(): original implementation was not called", );
+    }
+}
+
 template<class Transformation> void Object<Transformation>::setCleanInternal(const typename Transformation::DataType& absoluteTransformation) {
     /* "Lazy storage" for transformation matrix and inverted transformation matrix */
     CachedTransformations cached;
@@ -124,6 +124,11 @@ template<class T> using BasicDrawableGroup3D = DrawableGroup<3, T>;
 typedef BasicDrawableGroup2D<Float> DrawableGroup2D;
 typedef BasicDrawableGroup3D<Float> DrawableGroup3D;
 
+template<class> class BasicFlatObject3D;
+template<class> class BasicFlatScene3D;
+typedef BasicFlatObject3D<Float> FlatObject3D;
+typedef BasicFlatScene3D<Float> FlatScene3D;
+
 template<class> class BasicMatrixTransformation2D;
 template<class> class BasicMatrixTransformation3D;
 typedef BasicMatrixTransformation2D<Float> MatrixTransformation2D;
@@ -25,6 +25,8 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/DebugStl.h>
 
@@ -46,6 +48,7 @@ struct AnimableTest: TestSuite::Tester {
     template<class T> void repeat();
     template<class T> void stop();
     template<class T> void pause();
+    template<class T> void stepParallel();
 
     void deleteWhileRunning();
 
@@ -65,6 +68,8 @@ AnimableTest::AnimableTest() {
               &AnimableTest::stop<Double>,
               &AnimableTest::pause<Float>,
               &AnimableTest::pause<Double>,
+              &AnimableTest::stepParallel<Float>,
+              &AnimableTest::stepParallel<Double>,
 
               &AnimableTest::deleteWhileRunning,
 
@@ -378,6 +383,70 @@ template<class T> void AnimableTest::pause() {
     CORRADE_COMPARE(animable.time, 2.0f);
 }
 
+/* Executes the tasks serially in reverse order and counts the calls, to
+   verify the result doesn't depend on the iteration order */
+void reverseParallelFor(void* state, std::size_t count, void(*task)(void*, std::size_t), void* taskState) {
+    ++*static_cast<std::size_t*>(state);
+    for(std::size_t i = count; i != 0; --i)
+        task(taskState, i - 1);
+}
+
+template<class T> void AnimableTest::stepParallel() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Object3D<T> object;
+    BasicAnimableGroup3D<T> group;
+
+    /* More animables than a single chunk, every third not thread-safe */
+    Containers::Array<Containers::Pointer<OneShotAnimable<T>>> animables{200};
+    for(std::size_t i = 0; i != animables.size(); ++i) {
+        animables[i].emplace(object, &group);
+        animables[i]->setThreadSafe(i % 3 != 0);
+    }
+    CORRADE_VERIFY(!animables[0]->isThreadSafe());
+    CORRADE_VERIFY(animables[1]->isThreadSafe());
+
+    /* Passing a null executor steps everything serially */
+    group.step(1.0f, 0.5f, nullptr);
+    CORRADE_COMPARE(group.runningCount(), 200);
+    for(std::size_t i = 0; i != animables.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(animables[i]->time, 0.0f);
+        CORRADE_COMPARE(animables[i]->stateChanges, "started;");
+    }
+
+    /* Stepping in parallel gives the same result for all of them */
+    std::size_t calls = 0;
+    group.step(3.0f, 0.5f, reverseParallelFor, &calls);
+    CORRADE_COMPARE(calls, 1);
+    for(std::size_t i = 0; i != animables.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(animables[i]->time, 2.0f);
+    }
+
+    /* State transitions are still processed, stopped animables are not
+       stepped */
+    animables[1]->setState(AnimationState::Stopped);
+    animables[3]->setState(AnimationState::Stopped);
+    group.step(4.0f, 0.5f, reverseParallelFor, &calls);
+    CORRADE_COMPARE(calls, 2);
+    CORRADE_COMPARE(group.runningCount(), 198);
+    CORRADE_COMPARE(animables[1]->stateChanges, "started;stopped;");
+    CORRADE_COMPARE(animables[1]->time, 2.0f);
+    CORRADE_COMPARE(animables[3]->stateChanges, "started;stopped;");
+    CORRADE_COMPARE(animables[3]->time, 2.0f);
+    CORRADE_COMPARE(animables[2]->time, 3.0f);
+    CORRADE_COMPARE(animables[6]->time, 3.0f);
+
+    /* If there are no thread-safe animables running, the executor isn't
+       called at all */
+    for(std::size_t i = 0; i != animables.size(); ++i)
+        animables[i]->setThreadSafe(false);
+    group.step(5.0f, 0.5f, reverseParallelFor, &calls);
+    CORRADE_COMPARE(calls, 2);
+    CORRADE_COMPARE(animables[2]->time, 4.0f);
+}
+
 void AnimableTest::deleteWhileRunning() {
     Object3D<Float> object;
     AnimableGroup3D group;
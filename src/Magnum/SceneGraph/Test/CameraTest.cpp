@@ -25,6 +25,8 @@
 */
 
 #include <algorithm> /* std::sort() */
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 
@@ -54,6 +56,15 @@ struct CameraTest: TestSuite::Tester {
 
     template<class T> void draw();
     template<class T> void drawOrdered();
+    template<class T> void drawPrecalculated();
+    template<class T> void drawPrecalculatedWrongSize();
+    template<class T> void drawCulled2D();
+    template<class T> void drawCulled3D();
+    template<class T> void drawCulledWrongSize();
+    template<class T> void drawSorted();
+    template<class T> void drawSortedCulled();
+    template<class T> void drawSortedWrongSize();
+    void drawableSortKey();
 };
 
 CameraTest::CameraTest() {
@@ -78,11 +89,29 @@ CameraTest::CameraTest() {
         &CameraTest::draw<Float>,
         &CameraTest::draw<Double>,
         &CameraTest::drawOrdered<Float>,
-        &CameraTest::drawOrdered<Double>});
+        &CameraTest::drawOrdered<Double>,
+        &CameraTest::drawPrecalculated<Float>,
+        &CameraTest::drawPrecalculated<Double>,
+        &CameraTest::drawPrecalculatedWrongSize<Float>,
+        &CameraTest::drawPrecalculatedWrongSize<Double>,
+        &CameraTest::drawCulled2D<Float>,
+        &CameraTest::drawCulled2D<Double>,
+        &CameraTest::drawCulled3D<Float>,
+        &CameraTest::drawCulled3D<Double>,
+        &CameraTest::drawCulledWrongSize<Float>,
+        &CameraTest::drawCulledWrongSize<Double>,
+        &CameraTest::drawSorted<Float>,
+        &CameraTest::drawSorted<Double>,
+        &CameraTest::drawSortedCulled<Float>,
+        &CameraTest::drawSortedCulled<Double>,
+        &CameraTest::drawSortedWrongSize<Float>,
+        &CameraTest::drawSortedWrongSize<Double>,
+        &CameraTest::drawableSortKey});
 }
 
 template<class T> using Object2D = SceneGraph::Object<SceneGraph::BasicMatrixTransformation2D<T>>;
 template<class T> using Object3D = SceneGraph::Object<SceneGraph::BasicMatrixTransformation3D<T>>;
+template<class T> using Scene2D = SceneGraph::Scene<SceneGraph::BasicMatrixTransformation2D<T>>;
 template<class T> using Scene3D = SceneGraph::Scene<SceneGraph::BasicMatrixTransformation3D<T>>;
 
 template<class T> void CameraTest::fixAspectRatio() {
@@ -303,6 +332,355 @@ template<class T> void CameraTest::drawOrdered() {
     }), TestSuite::Compare::Container);
 }
 
+template<class T> void CameraTest::drawPrecalculated() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            Drawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group, std::vector<Math::Matrix4<T>>& result): SceneGraph::BasicDrawable3D<T>{object, group}, _result(result) {}
+
+        protected:
+            void draw(const Math::Matrix4<T>& transformationMatrix, BasicCamera3D<T>&) override {
+                _result.push_back(transformationMatrix);
+            }
+
+        private:
+            std::vector<Math::Matrix4<T>>& _result;
+    };
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+
+    std::vector<Math::Matrix4<T>> drawn;
+
+    Object3D<T> first{&scene};
+    first.scale(Math::Vector3<T>{T(5.0)});
+    new Drawable{first, &group, drawn};
+
+    Object3D<T> second{&scene};
+    second.translate(Math::Vector3<T>::yAxis(T(3.0)));
+    new Drawable{second, &group, drawn};
+
+    Object3D<T> third{&second};
+    third.translate(Math::Vector3<T>::zAxis(T(-1.5)));
+    new Drawable{third, &group, drawn};
+
+    BasicCamera3D<T> camera{third};
+
+    Math::Matrix4<T> transformations[3];
+    camera.drawableTransformationsInto(group, transformations);
+    CORRADE_COMPARE_AS(Containers::arrayView(transformations), Containers::arrayView<Math::Matrix4<T>>({
+        Math::Matrix4<T>::translation({T(0.0), T(-3.0), T(1.5)})*Math::Matrix4<T>::scaling(Math::Vector3<T>(T(5.0))),
+        Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(1.5))),
+        Math::Matrix4<T>{}
+    }), TestSuite::Compare::Container);
+
+    /* Drawing the same transformations twice, such as for two passes */
+    camera.draw(group, transformations);
+    camera.draw(group, transformations);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Math::Matrix4<T>>{
+        transformations[0], transformations[1], transformations[2],
+        transformations[0], transformations[1], transformations[2]
+    }), TestSuite::Compare::Container);
+}
+
+template<class T> void CameraTest::drawPrecalculatedWrongSize() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            Drawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group): SceneGraph::BasicDrawable3D<T>{object, group} {}
+
+        protected:
+            void draw(const Math::Matrix4<T>&, BasicCamera3D<T>&) override {}
+    };
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+    Object3D<T> object{&scene};
+    new Drawable{object, &group};
+    new Drawable{object, &group};
+    BasicCamera3D<T> camera{object};
+
+    Math::Matrix4<T> transformations[3];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    camera.drawableTransformationsInto(group, transformations);
+    camera.draw(group, Containers::arrayView(transformations).prefix(1));
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::Camera::drawableTransformationsInto(): expected 2 transformations but got 3\n"
+        "SceneGraph::Camera::draw(): expected 2 transformations but got 1\n");
+}
+
+template<class T> void CameraTest::drawCulled2D() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable2D<T> {
+        public:
+            Drawable(AbstractBasicObject2D<T>& object, BasicDrawableGroup2D<T>* group, std::vector<Int>& result, Int id): SceneGraph::BasicDrawable2D<T>{object, group}, _result(result), _id{id} {}
+
+        protected:
+            void draw(const Math::Matrix3<T>&, BasicCamera2D<T>&) override {
+                _result.push_back(_id);
+            }
+
+        private:
+            std::vector<Int>& _result;
+            Int _id;
+    };
+
+    BasicDrawableGroup2D<T> group;
+    Scene2D<T> scene;
+    std::vector<Int> drawn;
+
+    /* Inside */
+    Object2D<T> first{&scene};
+    first.translate({T(1.0), T(-1.0)});
+    new Drawable{first, &group, drawn, 0};
+
+    /* Outside */
+    Object2D<T> second{&scene};
+    second.translate(Math::Vector2<T>::xAxis(T(10.0)));
+    new Drawable{second, &group, drawn, 1};
+
+    /* Outside, but scaled so the bounding circle reaches inside */
+    Object2D<T> third{&scene};
+    third.scale(Math::Vector2<T>::yScale(T(3.0)))
+        .translate(Math::Vector2<T>::xAxis(T(-5.5)));
+    new Drawable{third, &group, drawn, 2};
+
+    Object2D<T> cameraObject{&scene};
+    BasicCamera2D<T> camera{cameraObject};
+    camera.setProjectionMatrix(Math::Matrix3<T>::projection({T(8.0), T(8.0)}));
+
+    const Math::Vector2<T> centers[]{
+        {}, {}, {}
+    };
+    const T radii[]{T(1.0), T(1.0), T(1.0)};
+    CORRADE_COMPARE(camera.draw(group, centers, radii), 1);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 2}),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void CameraTest::drawCulled3D() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            Drawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group, std::vector<Int>& result, Int id): SceneGraph::BasicDrawable3D<T>{object, group}, _result(result), _id{id} {}
+
+        protected:
+            void draw(const Math::Matrix4<T>&, BasicCamera3D<T>&) override {
+                _result.push_back(_id);
+            }
+
+        private:
+            std::vector<Int>& _result;
+            Int _id;
+    };
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+    std::vector<Int> drawn;
+
+    /* In front of the camera */
+    Object3D<T> first{&scene};
+    first.translate(Math::Vector3<T>::zAxis(T(-5.0)));
+    new Drawable{first, &group, drawn, 0};
+
+    /* Behind the camera */
+    Object3D<T> second{&scene};
+    second.translate(Math::Vector3<T>::zAxis(T(5.0)));
+    new Drawable{second, &group, drawn, 1};
+
+    /* Far to the side */
+    Object3D<T> third{&scene};
+    third.translate({T(100.0), T(0.0), T(-5.0)});
+    new Drawable{third, &group, drawn, 2};
+
+    /* Bounding sphere center offset into the view */
+    Object3D<T> fourth{&scene};
+    fourth.translate({T(100.0), T(0.0), T(-5.0)});
+    new Drawable{fourth, &group, drawn, 3};
+
+    /* Beyond the far plane */
+    Object3D<T> fifth{&scene};
+    fifth.translate(Math::Vector3<T>::zAxis(T(-500.0)));
+    new Drawable{fifth, &group, drawn, 4};
+
+    Object3D<T> cameraObject{&scene};
+    BasicCamera3D<T> camera{cameraObject};
+    camera.setProjectionMatrix(Math::Matrix4<T>::perspectiveProjection(Math::Deg<T>{T(90.0)}, T(1.0), T(0.1), T(100.0)));
+
+    const Math::Vector3<T> centers[]{
+        {}, {}, {}, {T(-100.0), T(0.0), T(0.0)}, {}
+    };
+    const T radii[]{T(1.0), T(1.0), T(1.0), T(1.0), T(1.0)};
+    CORRADE_COMPARE(camera.draw(group, centers, radii), 3);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 3}),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void CameraTest::drawCulledWrongSize() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    class Drawable: public SceneGraph::BasicDrawable3D<T> {
+        public:
+            Drawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group): SceneGraph::BasicDrawable3D<T>{object, group} {}
+
+        protected:
+            void draw(const Math::Matrix4<T>&, BasicCamera3D<T>&) override {}
+    };
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+    Object3D<T> object{&scene};
+    new Drawable{object, &group};
+    new Drawable{object, &group};
+    BasicCamera3D<T> camera{object};
+
+    Math::Vector3<T> centers[3];
+    T radii[3]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    camera.draw(group, Containers::arrayView(centers).prefix(2), radii);
+    camera.draw(group, centers, Containers::arrayView(radii).prefix(2));
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::Camera::draw(): expected 2 bounding spheres but got 2 centers and 3 radii\n"
+        "SceneGraph::Camera::draw(): expected 2 bounding spheres but got 3 centers and 2 radii\n");
+}
+
+template<class T> class IdDrawable: public SceneGraph::BasicDrawable3D<T> {
+    public:
+        IdDrawable(AbstractBasicObject3D<T>& object, BasicDrawableGroup3D<T>* group, std::vector<Int>& result, Int id): SceneGraph::BasicDrawable3D<T>{object, group}, _result(result), _id{id} {}
+
+    protected:
+        void draw(const Math::Matrix4<T>&, BasicCamera3D<T>&) override {
+            _result.push_back(_id);
+        }
+
+    private:
+        std::vector<Int>& _result;
+        Int _id;
+};
+
+template<class T> void CameraTest::drawSorted() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+    std::vector<Int> drawn;
+
+    Object3D<T> object{&scene};
+    for(Int i = 0; i != 7; ++i)
+        new IdDrawable<T>{object, &group, drawn, i};
+
+    BasicCamera3D<T> camera{object};
+
+    /* Keys differing in various bytes, with duplicates that should keep the
+       original order */
+    const UnsignedLong keys[]{
+        0x0003000000000000ull,
+        0x0001000000000005ull,
+        0x0001000000000005ull,
+        0x0000ff0000000000ull,
+        0x0001000000000001ull,
+        0x0000ff0000000000ull,
+        0x0001000000010000ull,
+    };
+    camera.drawSorted(group, keys);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{3, 5, 4, 1, 2, 6, 0}),
+        TestSuite::Compare::Container);
+
+    /* All keys the same, should be drawn in the original order */
+    drawn.clear();
+    const UnsignedLong sameKeys[]{3, 3, 3, 3, 3, 3, 3};
+    camera.drawSorted(group, sameKeys);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{0, 1, 2, 3, 4, 5, 6}),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void CameraTest::drawSortedCulled() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+    std::vector<Int> drawn;
+
+    Object3D<T> visible{&scene};
+    visible.translate(Math::Vector3<T>::zAxis(T(-5.0)));
+    Object3D<T> invisible{&scene};
+    invisible.translate(Math::Vector3<T>::zAxis(T(5.0)));
+
+    new IdDrawable<T>{visible, &group, drawn, 0};
+    new IdDrawable<T>{invisible, &group, drawn, 1};
+    new IdDrawable<T>{visible, &group, drawn, 2};
+    new IdDrawable<T>{invisible, &group, drawn, 3};
+    new IdDrawable<T>{visible, &group, drawn, 4};
+
+    Object3D<T> cameraObject{&scene};
+    BasicCamera3D<T> camera{cameraObject};
+    camera.setProjectionMatrix(Math::Matrix4<T>::perspectiveProjection(Math::Deg<T>{T(90.0)}, T(1.0), T(0.1), T(100.0)));
+
+    const UnsignedLong keys[]{
+        SceneGraph::drawableSortKey(2, 0, 0, 0),
+        SceneGraph::drawableSortKey(0, 0, 0, 0),
+        SceneGraph::drawableSortKey(1, 3, 0, 0),
+        SceneGraph::drawableSortKey(1, 0, 0, 0),
+        SceneGraph::drawableSortKey(1, 2, 0, 0),
+    };
+    const Math::Vector3<T> centers[5]{};
+    const T radii[]{T(1.0), T(1.0), T(1.0), T(1.0), T(1.0)};
+    CORRADE_COMPARE(camera.drawSorted(group, keys, centers, radii), 2);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Int>{4, 2, 0}),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void CameraTest::drawSortedWrongSize() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    BasicDrawableGroup3D<T> group;
+    Scene3D<T> scene;
+    std::vector<Int> drawn;
+    Object3D<T> object{&scene};
+    new IdDrawable<T>{object, &group, drawn, 0};
+    new IdDrawable<T>{object, &group, drawn, 1};
+    BasicCamera3D<T> camera{object};
+
+    UnsignedLong keys[3]{};
+    Math::Vector3<T> centers[3];
+    T radii[3]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    camera.drawSorted(group, keys);
+    camera.drawSorted(group, keys, Containers::arrayView(centers).prefix(2), Containers::arrayView(radii).prefix(2));
+    camera.drawSorted(group, Containers::arrayView(keys).prefix(2), centers, Containers::arrayView(radii).prefix(2));
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::Camera::drawSorted(): expected 2 sort keys but got 3\n"
+        "SceneGraph::Camera::drawSorted(): expected 2 sort keys but got 3\n"
+        "SceneGraph::Camera::drawSorted(): expected 2 bounding spheres but got 3 centers and 2 radii\n");
+    CORRADE_VERIFY(drawn.empty());
+}
+
+void CameraTest::drawableSortKey() {
+    constexpr UnsignedLong key = SceneGraph::drawableSortKey(0x1234, 0x5678, 0x9abc, 0xdef0);
+    CORRADE_COMPARE(key, 0x123456789abcdef0ull);
+
+    /* Shader is the most significant */
+    CORRADE_VERIFY(SceneGraph::drawableSortKey(1, 0, 0, 0) > SceneGraph::drawableSortKey(0, 0xffff, 0xffff, 0xffff));
+    CORRADE_VERIFY(SceneGraph::drawableSortKey(0, 1, 0, 0) > SceneGraph::drawableSortKey(0, 0, 0xffff, 0xffff));
+    CORRADE_VERIFY(SceneGraph::drawableSortKey(0, 0, 1, 0) > SceneGraph::drawableSortKey(0, 0, 0, 0xffff));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CameraTest)
@@ -0,0 +1,540 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/Reference.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/SceneGraph/AbstractFeature.hpp"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.hpp"
+#include "Magnum/SceneGraph/FeatureGroup.hpp"
+#include "Magnum/SceneGraph/FlatScene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test { namespace {
+
+using namespace Math::Literals;
+
+struct FlatSceneTest: TestSuite::Tester {
+    explicit FlatSceneTest();
+
+    void construct();
+    void constructParentFromDifferentScene();
+    void destructChildren();
+    void destructReuseId();
+
+    void setParent();
+    void setParentInvalid();
+
+    void transformation();
+    void absoluteTransformationDirty();
+    void setDirty();
+    void setClean();
+    void updateAbsoluteTransformations();
+    void updateAbsoluteTransformationsParallel();
+    void updateAbsoluteTransformationsAfterSetParent();
+
+    void featureClean();
+    void cameraDraw();
+};
+
+FlatSceneTest::FlatSceneTest() {
+    addTests({&FlatSceneTest::construct,
+              &FlatSceneTest::constructParentFromDifferentScene,
+              &FlatSceneTest::destructChildren,
+              &FlatSceneTest::destructReuseId,
+
+              &FlatSceneTest::setParent,
+              &FlatSceneTest::setParentInvalid,
+
+              &FlatSceneTest::transformation,
+              &FlatSceneTest::absoluteTransformationDirty,
+              &FlatSceneTest::setDirty,
+              &FlatSceneTest::setClean,
+              &FlatSceneTest::updateAbsoluteTransformations,
+              &FlatSceneTest::updateAbsoluteTransformationsParallel,
+              &FlatSceneTest::updateAbsoluteTransformationsAfterSetParent,
+
+              &FlatSceneTest::featureClean,
+              &FlatSceneTest::cameraDraw});
+}
+
+void FlatSceneTest::construct() {
+    FlatScene3D scene;
+    CORRADE_COMPARE(scene.objectCount(), 0);
+    CORRADE_COMPARE(scene.objectBound(), 0);
+    CORRADE_VERIFY(static_cast<AbstractObject3D&>(scene).scene() == &scene);
+    CORRADE_VERIFY(!static_cast<AbstractObject3D&>(scene).parent());
+    CORRADE_VERIFY(!static_cast<AbstractObject3D&>(scene).isDirty());
+
+    FlatObject3D a{scene};
+    FlatObject3D b{scene, &a};
+    CORRADE_COMPARE(a.id(), 0);
+    CORRADE_COMPARE(b.id(), 1);
+    CORRADE_COMPARE(scene.objectCount(), 2);
+    CORRADE_COMPARE(scene.objectBound(), 2);
+    CORRADE_COMPARE(scene.object(0), &a);
+    CORRADE_COMPARE(scene.object(1), &b);
+    CORRADE_VERIFY(a.scene() == &scene);
+    CORRADE_VERIFY(b.scene() == &scene);
+    CORRADE_VERIFY(!a.parent());
+    CORRADE_VERIFY(b.parent() == &a);
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_COMPARE(a.transformation(), Matrix4{});
+
+    /* Through the abstract interface, a top-level object has the scene as a
+       parent, same as with Object */
+    CORRADE_VERIFY(static_cast<AbstractObject3D&>(a).parent() == &scene);
+    CORRADE_VERIFY(static_cast<AbstractObject3D&>(b).parent() == &a);
+    CORRADE_VERIFY(static_cast<AbstractObject3D&>(b).scene() == &scene);
+}
+
+void FlatSceneTest::constructParentFromDifferentScene() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FlatScene3D scene1;
+    FlatScene3D scene2;
+    FlatObject3D a{scene1};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    FlatObject3D b{scene2, &a};
+    CORRADE_COMPARE(out.str(), "SceneGraph::FlatObject3D: parent is not a part of the scene\n");
+}
+
+void FlatSceneTest::destructChildren() {
+    FlatScene3D scene;
+    {
+        FlatObject3D a{scene};
+        FlatObject3D* b = new FlatObject3D{scene, &a};
+        new FlatObject3D{scene, b};
+        new FlatObject3D{scene, &a};
+        FlatObject3D c{scene};
+        CORRADE_COMPARE(scene.objectCount(), 5);
+    }
+
+    /* All children got deleted */
+    CORRADE_COMPARE(scene.objectCount(), 0);
+    CORRADE_COMPARE(scene.objectBound(), 5);
+    for(UnsignedInt i = 0; i != 5; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(!scene.object(i));
+    }
+
+    /* Heap-allocated top-level objects are deleted by the scene, verified by
+       a leak checker */
+    new FlatObject3D{scene};
+}
+
+void FlatSceneTest::destructReuseId() {
+    FlatScene3D scene;
+    FlatObject3D a{scene};
+    FlatObject3D* b = new FlatObject3D{scene};
+    b->translate(Vector3::xAxis(5.0f));
+    FlatObject3D c{scene};
+    delete b;
+    CORRADE_COMPARE(scene.objectCount(), 2);
+    CORRADE_COMPARE(scene.objectBound(), 3);
+    CORRADE_VERIFY(!scene.object(1));
+
+    /* The ID gets reused, with the transformation reset */
+    FlatObject3D d{scene, &c};
+    CORRADE_COMPARE(d.id(), 1);
+    CORRADE_COMPARE(scene.objectCount(), 3);
+    CORRADE_COMPARE(scene.objectBound(), 3);
+    CORRADE_COMPARE(scene.object(1), &d);
+    CORRADE_COMPARE(d.transformation(), Matrix4{});
+    CORRADE_VERIFY(d.parent() == &c);
+}
+
+void FlatSceneTest::setParent() {
+    FlatScene3D scene;
+    FlatObject3D a{scene};
+    a.translate(Vector3::xAxis(1.0f));
+    FlatObject3D b{scene};
+    b.translate(Vector3::yAxis(2.0f));
+    FlatObject3D c{scene, &a};
+    c.translate(Vector3::zAxis(3.0f));
+    scene.updateAbsoluteTransformations();
+    CORRADE_VERIFY(!c.isDirty());
+
+    c.setParent(&b);
+    CORRADE_VERIFY(c.parent() == &b);
+    CORRADE_VERIFY(c.isDirty());
+    CORRADE_COMPARE(c.absoluteTransformation(), Matrix4::translation({0.0f, 2.0f, 3.0f}));
+
+    c.setParent(nullptr);
+    CORRADE_VERIFY(!c.parent());
+    CORRADE_COMPARE(c.absoluteTransformation(), Matrix4::translation({0.0f, 0.0f, 3.0f}));
+
+    /* Making an object a child of an object with higher ID */
+    a.setParent(&c);
+    CORRADE_VERIFY(a.parent() == &c);
+    scene.updateAbsoluteTransformations();
+    CORRADE_COMPARE(a.absoluteTransformation(), Matrix4::translation({1.0f, 0.0f, 3.0f}));
+}
+
+void FlatSceneTest::setParentInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FlatScene3D scene1;
+    FlatScene3D scene2;
+    FlatObject3D a{scene1};
+    FlatObject3D b{scene1, &a};
+    FlatObject3D c{scene2};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.setParent(&c);
+    a.setParent(&a);
+    a.setParent(&b);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::FlatObject3D::setParent(): the parent is not a part of the same scene\n"
+        "SceneGraph::FlatObject3D::setParent(): the object is the new parent or one of its parents\n"
+        "SceneGraph::FlatObject3D::setParent(): the object is the new parent or one of its parents\n");
+}
+
+void FlatSceneTest::transformation() {
+    FlatScene3D scene;
+    FlatObject3D a{scene};
+    FlatObject3D b{scene};
+
+    a.setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)))
+        .transform(Matrix4::scaling(Vector3{2.0f}))
+        .transformLocal(Matrix4::rotationZ(90.0_degf));
+    b.translate(Vector3::yAxis(1.0f))
+        .rotate(90.0_degf, Vector3::zAxis())
+        .scale(Vector3{3.0f});
+
+    CORRADE_COMPARE(a.transformation(),
+        Matrix4::scaling(Vector3{2.0f})*
+        Matrix4::translation(Vector3::xAxis(1.0f))*
+        Matrix4::rotationZ(90.0_degf));
+    CORRADE_COMPARE(b.transformation(),
+        Matrix4::scaling(Vector3{3.0f})*
+        Matrix4::rotation(90.0_degf, Vector3::zAxis())*
+        Matrix4::translation(Vector3::yAxis(1.0f)));
+    CORRADE_COMPARE(static_cast<AbstractObject3D&>(b).transformationMatrix(), b.transformation());
+
+    /* The transformations are stored contiguously */
+    CORRADE_COMPARE_AS(scene.transformations(), Containers::arrayView<Matrix4>({
+        a.transformation(),
+        b.transformation()
+    }), TestSuite::Compare::Container);
+
+    b.resetTransformation();
+    CORRADE_COMPARE(b.transformation(), Matrix4{});
+}
+
+void FlatSceneTest::absoluteTransformationDirty() {
+    FlatScene3D scene;
+    FlatObject3D a{scene};
+    a.translate(Vector3::xAxis(1.0f));
+    FlatObject3D b{scene, &a};
+    b.scale(Vector3{2.0f});
+    FlatObject3D c{scene, &b};
+    c.translate(Vector3::yAxis(3.0f));
+
+    const Matrix4 expected = Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::scaling(Vector3{2.0f})*Matrix4::translation(Vector3::yAxis(3.0f));
+
+    /* Calculated by going up the hierarchy */
+    CORRADE_VERIFY(c.isDirty());
+    CORRADE_COMPARE(c.absoluteTransformation(), expected);
+    CORRADE_COMPARE(static_cast<AbstractObject3D&>(c).absoluteTransformationMatrix(), expected);
+
+    /* Partially from a clean parent */
+    a.setClean();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(c.isDirty());
+    CORRADE_COMPARE(c.absoluteTransformation(), expected);
+
+    /* Fetched from the array */
+    c.setClean();
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_COMPARE(scene.absoluteTransformations()[c.id()], expected);
+    CORRADE_COMPARE(c.absoluteTransformation(), expected);
+}
+
+void FlatSceneTest::setDirty() {
+    FlatScene3D scene;
+    FlatObject3D a{scene};
+    FlatObject3D b{scene, &a};
+    FlatObject3D c{scene, &b};
+    FlatObject3D d{scene};
+    scene.updateAbsoluteTransformations();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_VERIFY(!d.isDirty());
+
+    /* Marks all children dirty as well */
+    b.translate(Vector3::xAxis(1.0f));
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_VERIFY(c.isDirty());
+    CORRADE_VERIFY(!d.isDirty());
+
+    a.setDirty();
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_VERIFY(!d.isDirty());
+}
+
+void FlatSceneTest::setClean() {
+    FlatScene3D scene;
+    FlatObject3D a{scene};
+    a.translate(Vector3::xAxis(1.0f));
+    FlatObject3D b{scene, &a};
+    FlatObject3D c{scene, &b};
+    c.translate(Vector3::zAxis(1.0f));
+    FlatObject3D d{scene, &a};
+
+    /* Cleans just the object and its parents */
+    c.setClean();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_VERIFY(d.isDirty());
+    CORRADE_COMPARE(scene.absoluteTransformations()[c.id()], Matrix4::translation({1.0f, 0.0f, 1.0f}));
+
+    /* Through the abstract interface */
+    Containers::Reference<AbstractObject3D> objects[]{d};
+    AbstractObject3D::setClean(objects, nullptr);
+    CORRADE_VERIFY(!d.isDirty());
+    CORRADE_COMPARE(scene.absoluteTransformations()[d.id()], Matrix4::translation({1.0f, 0.0f, 0.0f}));
+}
+
+void FlatSceneTest::updateAbsoluteTransformations() {
+    FlatScene3D scene;
+    FlatObject3D a{scene};
+    a.translate(Vector3::xAxis(1.0f));
+    FlatObject3D b{scene, &a};
+    b.scale(Vector3{2.0f});
+    FlatObject3D c{scene};
+    c.translate(Vector3::yAxis(2.0f));
+    FlatObject3D d{scene, &b};
+    d.translate(Vector3::zAxis(3.0f));
+
+    scene.updateAbsoluteTransformations();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_VERIFY(!d.isDirty());
+    CORRADE_COMPARE_AS(scene.absoluteTransformations(), Containers::arrayView<Matrix4>({
+        Matrix4::translation(Vector3::xAxis(1.0f)),
+        Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::scaling(Vector3{2.0f}),
+        Matrix4::translation(Vector3::yAxis(2.0f)),
+        Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::scaling(Vector3{2.0f})*Matrix4::translation(Vector3::zAxis(3.0f))
+    }), TestSuite::Compare::Container);
+
+    /* Updating just a part */
+    b.resetTransformation();
+    scene.updateAbsoluteTransformations();
+    CORRADE_COMPARE_AS(scene.absoluteTransformations(), Containers::arrayView<Matrix4>({
+        Matrix4::translation(Vector3::xAxis(1.0f)),
+        Matrix4::translation(Vector3::xAxis(1.0f)),
+        Matrix4::translation(Vector3::yAxis(2.0f)),
+        Matrix4::translation({1.0f, 0.0f, 3.0f})
+    }), TestSuite::Compare::Container);
+
+    /* Calling on an empty scene is fine */
+    FlatScene3D empty;
+    empty.updateAbsoluteTransformations();
+}
+
+/* Executes the tasks serially, but records how many times it was called */
+struct SerialParallelFor {
+    std::size_t callCount = 0;
+    std::size_t taskCount = 0;
+};
+
+void serialParallelFor(void* state, std::size_t count, void(*task)(void*, std::size_t), void* taskState) {
+    SerialParallelFor& s = *static_cast<SerialParallelFor*>(state);
+    ++s.callCount;
+    s.taskCount += count;
+    for(std::size_t i = 0; i != count; ++i)
+        task(taskState, i);
+}
+
+void FlatSceneTest::updateAbsoluteTransformationsParallel() {
+    FlatScene3D scene;
+    FlatObject3D a{scene};
+    a.translate(Vector3::xAxis(1.0f));
+    FlatObject3D b{scene, &a};
+    b.scale(Vector3{2.0f});
+    FlatObject3D c{scene};
+    c.translate(Vector3::yAxis(2.0f));
+    FlatObject3D d{scene, &b};
+    d.translate(Vector3::zAxis(3.0f));
+
+    SerialParallelFor state;
+    scene.updateAbsoluteTransformations(serialParallelFor, &state);
+
+    /* One call for each depth level */
+    CORRADE_COMPARE(state.callCount, 3);
+    CORRADE_COMPARE(state.taskCount, 3);
+    CORRADE_VERIFY(!d.isDirty());
+    CORRADE_COMPARE_AS(scene.absoluteTransformations(), Containers::arrayView<Matrix4>({
+        Matrix4::translation(Vector3::xAxis(1.0f)),
+        Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::scaling(Vector3{2.0f}),
+        Matrix4::translation(Vector3::yAxis(2.0f)),
+        Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::scaling(Vector3{2.0f})*Matrix4::translation(Vector3::zAxis(3.0f))
+    }), TestSuite::Compare::Container);
+
+    /* Parallel transformation queries on the scene give the same result */
+    Containers::Reference<AbstractObject3D> objects[]{d, scene, b};
+    Matrix4 transformations[3];
+    SerialParallelFor queryState;
+    static_cast<AbstractObject3D&>(scene).transformationMatricesInto(objects, transformations, Matrix4::translation(Vector3::zAxis(-1.0f)), serialParallelFor, &queryState);
+    CORRADE_COMPARE(queryState.callCount, 1);
+    CORRADE_COMPARE_AS(Containers::arrayView(transformations), Containers::arrayView<Matrix4>({
+        Matrix4::translation(Vector3::zAxis(-1.0f))*scene.absoluteTransformations()[d.id()],
+        Matrix4::translation(Vector3::zAxis(-1.0f)),
+        Matrix4::translation(Vector3::zAxis(-1.0f))*scene.absoluteTransformations()[b.id()]
+    }), TestSuite::Compare::Container);
+}
+
+void FlatSceneTest::updateAbsoluteTransformationsAfterSetParent() {
+    FlatScene3D scene;
+    FlatObject3D a{scene};
+    a.translate(Vector3::xAxis(1.0f));
+    FlatObject3D b{scene};
+    b.translate(Vector3::yAxis(1.0f));
+    scene.updateAbsoluteTransformations();
+
+    /* The cached traversal order has to be updated so the parent is
+       calculated first */
+    b.setTransformation(Matrix4::translation(Vector3::yAxis(2.0f)));
+    a.setParent(&b);
+    scene.updateAbsoluteTransformations();
+    CORRADE_COMPARE(scene.absoluteTransformations()[a.id()], Matrix4::translation({1.0f, 2.0f, 0.0f}));
+
+    /* Same with a newly added object */
+    FlatObject3D c{scene};
+    c.translate(Vector3::zAxis(1.0f));
+    b.setParent(&c);
+    scene.updateAbsoluteTransformations();
+    CORRADE_COMPARE(scene.absoluteTransformations()[a.id()], Matrix4::translation({1.0f, 2.0f, 1.0f}));
+}
+
+class CachingFeature: public AbstractFeature3D {
+    public:
+        explicit CachingFeature(AbstractObject3D& object): AbstractFeature3D{object} {
+            setCachedTransformations(CachedTransformation::Absolute|CachedTransformation::InvertedAbsolute);
+        }
+
+        Int dirtyCount = 0, cleanCount = 0;
+        Matrix4 absolute, invertedAbsolute;
+
+    private:
+        void markDirty() override { ++dirtyCount; }
+        void clean(const Matrix4& absoluteTransformationMatrix) override {
+            ++cleanCount;
+            absolute = absoluteTransformationMatrix;
+        }
+        void cleanInverted(const Matrix4& invertedAbsoluteTransformationMatrix) override {
+            invertedAbsolute = invertedAbsoluteTransformationMatrix;
+        }
+};
+
+void FlatSceneTest::featureClean() {
+    FlatScene3D scene;
+    FlatObject3D a{scene};
+    a.translate(Vector3::xAxis(1.0f));
+    FlatObject3D b{scene, &a};
+    b.translate(Vector3::yAxis(2.0f));
+    CachingFeature& feature = b.addFeature<CachingFeature>();
+
+    scene.updateAbsoluteTransformations();
+    CORRADE_COMPARE(feature.cleanCount, 1);
+    CORRADE_COMPARE(feature.absolute, Matrix4::translation({1.0f, 2.0f, 0.0f}));
+    CORRADE_COMPARE(feature.invertedAbsolute, Matrix4::translation({-1.0f, -2.0f, 0.0f}));
+
+    /* Clean objects are not cleaned again */
+    scene.updateAbsoluteTransformations();
+    CORRADE_COMPARE(feature.cleanCount, 1);
+
+    /* Changing the parent marks the feature dirty */
+    a.translate(Vector3::zAxis(3.0f));
+    CORRADE_COMPARE(feature.dirtyCount, 1);
+    scene.updateAbsoluteTransformations();
+    CORRADE_COMPARE(feature.cleanCount, 2);
+    CORRADE_COMPARE(feature.absolute, Matrix4::translation({1.0f, 2.0f, 3.0f}));
+}
+
+void FlatSceneTest::cameraDraw() {
+    class Drawable: public Drawable3D {
+        public:
+            explicit Drawable(AbstractObject3D& object, DrawableGroup3D& group, std::vector<Matrix4>& result): Drawable3D{object, &group}, _result(result) {}
+
+        private:
+            void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+                _result.push_back(transformationMatrix);
+            }
+
+            std::vector<Matrix4>& _result;
+    };
+
+    FlatScene3D scene;
+    DrawableGroup3D drawables;
+    std::vector<Matrix4> drawn;
+
+    FlatObject3D& a = *new FlatObject3D{scene};
+    a.scale(Vector3{5.0f});
+    new Drawable{a, drawables, drawn};
+
+    FlatObject3D& b = *new FlatObject3D{scene};
+    b.translate(Vector3::yAxis(3.0f));
+    new Drawable{b, drawables, drawn};
+
+    FlatObject3D& cameraObject = *new FlatObject3D{scene, &b};
+    cameraObject.translate(Vector3::zAxis(-1.5f));
+    Camera3D camera{cameraObject};
+
+    scene.updateAbsoluteTransformations();
+    camera.draw(drawables);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Matrix4>{
+        Matrix4::translation({0.0f, -3.0f, 1.5f})*Matrix4::scaling(Vector3{5.0f}),
+        Matrix4::translation(Vector3::zAxis(1.5f))
+    }), TestSuite::Compare::Container);
+
+    /* Works also with dirty objects */
+    drawn.clear();
+    a.translate(Vector3::xAxis(1.0f));
+    camera.draw(drawables);
+    CORRADE_COMPARE_AS(drawn, (std::vector<Matrix4>{
+        Matrix4::translation({1.0f, -3.0f, 1.5f})*Matrix4::scaling(Vector3{5.0f}),
+        Matrix4::translation(Vector3::zAxis(1.5f))
+    }), TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatSceneTest)
@@ -26,7 +26,10 @@
 
 #include <sstream>
 #include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/Reference.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/DebugStl.h>
 #include <Corrade/Utility/FormatStl.h>
 
@@ -54,9 +57,14 @@ struct ObjectTest: TestSuite::Tester {
     template<class T> void transformationsRelative();
     template<class T> void transformationsOrphan();
     template<class T> void transformationsDuplicate();
+    template<class T> void transformationsInto();
+    template<class T> void transformationsIntoParallel();
+    template<class T> void transformationsIntoOrphan();
+    template<class T> void transformationsIntoWrongSize();
     template<class T> void setClean();
     template<class T> void setCleanListHierarchy();
     template<class T> void setCleanListBulk();
+    template<class T> void setCleanListBulkParallel();
 
     template<class T> void rangeBasedForChildren();
     template<class T> void rangeBasedForFeatures();
@@ -93,12 +101,22 @@ ObjectTest::ObjectTest() {
         &ObjectTest::transformationsOrphan<Double>,
         &ObjectTest::transformationsDuplicate<Float>,
         &ObjectTest::transformationsDuplicate<Double>,
+        &ObjectTest::transformationsInto<Float>,
+        &ObjectTest::transformationsInto<Double>,
+        &ObjectTest::transformationsIntoParallel<Float>,
+        &ObjectTest::transformationsIntoParallel<Double>,
+        &ObjectTest::transformationsIntoOrphan<Float>,
+        &ObjectTest::transformationsIntoOrphan<Double>,
+        &ObjectTest::transformationsIntoWrongSize<Float>,
+        &ObjectTest::transformationsIntoWrongSize<Double>,
         &ObjectTest::setClean<Float>,
         &ObjectTest::setClean<Double>,
         &ObjectTest::setCleanListHierarchy<Float>,
         &ObjectTest::setCleanListHierarchy<Double>,
         &ObjectTest::setCleanListBulk<Float>,
         &ObjectTest::setCleanListBulk<Double>,
+        &ObjectTest::setCleanListBulkParallel<Float>,
+        &ObjectTest::setCleanListBulkParallel<Double>,
 
         &ObjectTest::rangeBasedForChildren<Float>,
         &ObjectTest::rangeBasedForChildren<Double>,
@@ -418,6 +436,152 @@ template<class T> void ObjectTest::transformationsDuplicate() {
     }));
 }
 
+/* Executes the tasks serially, but records how many times it was called */
+struct SerialParallelFor {
+    std::size_t callCount = 0;
+    std::size_t taskCount = 0;
+};
+
+void serialParallelFor(void* state, std::size_t count, void(*task)(void*, std::size_t), void* taskState) {
+    SerialParallelFor& s = *static_cast<SerialParallelFor*>(state);
+    ++s.callCount;
+    s.taskCount += count;
+    for(std::size_t i = 0; i != count; ++i)
+        task(taskState, i);
+}
+
+template<class T> void ObjectTest::transformationsInto() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Scene3D<T> s;
+
+    Math::Matrix4<T> initial = Math::Matrix4<T>::rotationX(Math::Deg<T>{90.0}).inverted();
+
+    /* Empty list */
+    s.transformationsInto({}, {}, initial);
+
+    Object3D<T> first(&s);
+    first.rotateZ(Math::Deg<T>{30.0});
+    Object3D<T> second(&first);
+    second.scale(Math::Vector3<T>(T(0.5)));
+    Object3D<T> third(&first);
+    third.translate(Math::Vector3<T>::xAxis(T(5.0)));
+
+    /* Objects in random order, including the scene and duplicates */
+    Containers::Reference<Object3D<T>> objects[]{
+        third, second, s, first, second, third
+    };
+    Math::Matrix4<T> transformations[6];
+    s.transformationsInto(objects, transformations, initial);
+
+    /* Should give the same result as the vector-based API */
+    std::vector<Math::Matrix4<T>> expected = s.transformations({third, second, s, first, second, third}, initial);
+    CORRADE_COMPARE_AS(Containers::arrayView(transformations),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(transformations[1], initial*Math::Matrix4<T>::rotationZ(Math::Deg<T>{30.0})*Math::Matrix4<T>::scaling(Math::Vector3<T>(T(0.5))));
+    CORRADE_COMPARE(transformations[2], initial);
+
+    /* Calculating again gives the same result, i.e. no stale marks were left
+       on the objects */
+    Math::Matrix4<T> transformations2[6];
+    s.transformationsInto(objects, transformations2, initial);
+    CORRADE_COMPARE_AS(Containers::arrayView(transformations2),
+        Containers::arrayView(transformations),
+        TestSuite::Compare::Container);
+
+    /* Type-erased variant through AbstractObject */
+    Containers::Reference<AbstractBasicObject3D<T>> abstractObjects[]{
+        third, second, s, first, second, third
+    };
+    Math::Matrix4<T> transformations3[6];
+    static_cast<AbstractBasicObject3D<T>&>(s).transformationMatricesInto(abstractObjects, transformations3, initial);
+    CORRADE_COMPARE_AS(Containers::arrayView(transformations3),
+        Containers::arrayView(transformations),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void ObjectTest::transformationsIntoParallel() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    Scene3D<T> s;
+    Object3D<T> first(&s);
+    first.rotateZ(Math::Deg<T>{30.0});
+    Object3D<T> second(&first);
+    second.scale(Math::Vector3<T>(T(0.5)));
+    Object3D<T> third(&first);
+    third.translate(Math::Vector3<T>::xAxis(T(5.0)));
+    Object3D<T> fourth(&third);
+    fourth.rotateX(Math::Deg<T>{15.0});
+    Object3D<T> fifth(&s);
+    fifth.translate(Math::Vector3<T>::yAxis(T(-1.0)));
+
+    Containers::Reference<Object3D<T>> objects[]{
+        fourth, second, fifth, third, fourth
+    };
+    Math::Matrix4<T> transformations[5];
+    SerialParallelFor state;
+    s.transformationsInto(objects, transformations, {}, serialParallelFor, &state);
+
+    /* Scene, first + fifth, second + third, fourth */
+    CORRADE_COMPARE(state.callCount, 4);
+    CORRADE_COMPARE(state.taskCount, 4);
+
+    Math::Matrix4<T> expected[5];
+    s.transformationsInto(objects, expected);
+    CORRADE_COMPARE_AS(Containers::arrayView(transformations),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+template<class T> void ObjectTest::transformationsIntoOrphan() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Scene3D<T> s;
+    Object3D<T> first(&s);
+    Object3D<T> orphan;
+    Object3D<T> orphanChild(&orphan);
+
+    Containers::Reference<Object3D<T>> objects[]{first, orphanChild};
+    Math::Matrix4<T> transformations[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    s.transformationsInto(objects, transformations);
+    orphanChild.transformationsInto(objects, transformations);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::Object::transformationsInto(): the objects are not part of the same tree\n"
+        "SceneGraph::Object::transformationsInto(): currently implemented only for Scene\n");
+
+    /* The objects should stay usable after the assertion */
+    Containers::Reference<Object3D<T>> sceneObjects[]{first, first};
+    s.transformationsInto(sceneObjects, transformations);
+    CORRADE_COMPARE(transformations[0], Math::Matrix4<T>{});
+    CORRADE_COMPARE(transformations[1], Math::Matrix4<T>{});
+}
+
+template<class T> void ObjectTest::transformationsIntoWrongSize() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Scene3D<T> s;
+    Object3D<T> first(&s);
+
+    Containers::Reference<Object3D<T>> objects[]{first, s};
+    Math::Matrix4<T> transformations[3];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    s.transformationsInto(objects, Containers::arrayView(transformations));
+    s.transformationMatricesInto(objects, Containers::arrayView(transformations).prefix(1));
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::Object::transformationsInto(): expected 2 transformations but got 3\n"
+        "SceneGraph::Object::transformationMatricesInto(): expected 2 transformations but got 1\n");
+}
+
 template<class T> void ObjectTest::setClean() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -604,6 +768,49 @@ template<class T> void ObjectTest::setCleanListBulk() {
     CORRADE_COMPARE(d.cleanedAbsoluteTransformation, Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(3.0)))*Math::Matrix4<T>::scaling(Math::Vector3<T>(T(-2.0))));
 }
 
+template<class T> void ObjectTest::setCleanListBulkParallel() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    /* Verify it doesn't crash when passed empty list */
+    SerialParallelFor state;
+    Object3D<T>::setClean(nullptr, serialParallelFor, &state);
+    CORRADE_COMPARE(state.callCount, 0);
+
+    Scene3D<T> scene;
+    Object3D<T> a(&scene);
+    Object3D<T> b(&scene);
+    b.setClean();
+    Object3D<T> c(&scene);
+    c.translate(Math::Vector3<T>::zAxis(T(3.0)));
+    CachingObject<T> d(&c);
+    d.scale(Math::Vector3<T>(T(-2.0)));
+    Object3D<T> e(&scene);
+
+    /* All objects should be cleaned, including the parent of d, which isn't
+       in the list */
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(c.isDirty());
+    CORRADE_VERIFY(d.isDirty());
+    CORRADE_VERIFY(e.isDirty());
+    Containers::Reference<Object3D<T>> objects[]{a, b, d, e, d};
+    Object3D<T>::setClean(objects, serialParallelFor, &state);
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_VERIFY(!d.isDirty());
+    CORRADE_VERIFY(!e.isDirty());
+    CORRADE_VERIFY(state.callCount);
+
+    /* Verify that right transformation was passed */
+    CORRADE_COMPARE(d.cleanedAbsoluteTransformation, Math::Matrix4<T>::translation(Math::Vector3<T>::zAxis(T(3.0)))*Math::Matrix4<T>::scaling(Math::Vector3<T>(T(-2.0))));
+
+    /* Calling it again on clean objects does nothing */
+    state.callCount = 0;
+    Object3D<T>::setClean(objects, serialParallelFor, &state);
+    CORRADE_COMPARE(state.callCount, 0);
+}
+
 template<class T> void ObjectTest::rangeBasedForChildren() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -0,0 +1,231 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BoundingVolumeHierarchy.h"
+
+#include <algorithm>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+namespace {
+
+/* Should be enough for any balanced tree, as the depth is logarithmic */
+constexpr std::size_t MaxDepth = 64;
+constexpr UnsignedInt MaxLeafSize = 4;
+
+/* Axis-aligned box containing a transformed box, done by transforming the
+   center and calculating the new half-size from absolute values of the
+   rotation and scaling part instead of transforming all eight corners */
+Range3D transformBounds(const Matrix4& transformation, const Range3D& bounds) {
+    const Vector3 halfSize = bounds.size()*0.5f;
+    Vector3 extent;
+    for(std::size_t i = 0; i != 3; ++i)
+        extent += Math::abs(transformation[i].xyz())*halfSize[i];
+    return Range3D::fromCenter(transformation.transformPoint(bounds.center()), extent);
+}
+
+}
+
+BoundingVolumeHierarchy3D::BoundingVolumeHierarchy3D(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const Range3D>& meshBounds, const Matrix4& globalTransformation): _objectCount{std::size_t(scene.mappingBound())} {
+    CORRADE_ASSERT(scene.is3D(),
+        "SceneTools::BoundingVolumeHierarchy3D: the scene is not 3D", );
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Parent),
+        "SceneTools::BoundingVolumeHierarchy3D: the scene has no hierarchy", );
+
+    if(!scene.hasField(Trade::SceneField::Mesh))
+        return;
+
+    const std::size_t size = scene.fieldSize(Trade::SceneField::Mesh);
+    _objects = Containers::Array<UnsignedInt>{NoInit, size};
+    _meshes = Containers::Array<UnsignedInt>{NoInit, size};
+    scene.meshesMaterialsInto(_objects, _meshes, nullptr);
+
+    _meshBounds = Containers::Array<Range3D>{NoInit, size};
+    for(std::size_t i = 0; i != size; ++i) {
+        CORRADE_ASSERT(_meshes[i] < meshBounds.size(),
+            "SceneTools::BoundingVolumeHierarchy3D: mesh" << _meshes[i] << "out of range for" << meshBounds.size() << "mesh bounds", );
+        _meshBounds[i] = meshBounds[_meshes[i]];
+    }
+
+    _bounds = Containers::Array<Range3D>{NoInit, size};
+    const Containers::Array<Matrix4> transformations = absoluteFieldTransformations3D(scene, Trade::SceneField::Mesh, globalTransformation);
+    for(std::size_t i = 0; i != size; ++i)
+        _bounds[i] = transformBounds(transformations[i], _meshBounds[i]);
+
+    /* Nothing else to do for an empty field */
+    if(!size)
+        return;
+
+    /* Build the tree top-down. The ranges to process are kept on a stack
+       together with the parent node that should get the index of the right
+       child, which makes the nodes end up in a depth-first order with the
+       left child always directly after its parent. */
+    _order = Containers::Array<UnsignedInt>{NoInit, size};
+    for(std::size_t i = 0; i != size; ++i)
+        _order[i] = i;
+    struct Range {
+        UnsignedInt begin, end;
+        /* Parent whose right child this is, ~UnsignedInt{} if not */
+        UnsignedInt parent;
+    } stack[MaxDepth];
+    std::size_t stackSize = 0;
+    stack[stackSize++] = {0, UnsignedInt(size), ~UnsignedInt{}};
+    while(stackSize) {
+        const Range range = stack[--stackSize];
+        if(range.parent != ~UnsignedInt{})
+            _nodes[range.parent].first = _nodes.size();
+
+        Range3D bounds = _bounds[_order[range.begin]];
+        Range3D centers{bounds.center(), bounds.center()};
+        for(UnsignedInt i = range.begin + 1; i != range.end; ++i) {
+            bounds = Math::join(bounds, _bounds[_order[i]]);
+            centers = Math::join(centers, _bounds[_order[i]].center());
+        }
+
+        if(range.end - range.begin <= MaxLeafSize) {
+            arrayAppend(_nodes, Node{bounds, range.begin, range.end - range.begin});
+            continue;
+        }
+
+        /* Split at the median of the centers along the longest axis */
+        const Vector3 centerSize = centers.size();
+        const std::size_t axis =
+            centerSize.x() >= centerSize.y() && centerSize.x() >= centerSize.z() ? 0 :
+            centerSize.y() >= centerSize.z() ? 1 : 2;
+        const UnsignedInt middle = range.begin + (range.end - range.begin)/2;
+        std::nth_element(_order.data() + range.begin, _order.data() + middle, _order.data() + range.end, [&](UnsignedInt a, UnsignedInt b) {
+            return _bounds[a].center()[axis] < _bounds[b].center()[axis];
+        });
+
+        /* The right child index gets filled once it's popped from the stack.
+           Push it first so the left child is processed right after. */
+        const UnsignedInt node = _nodes.size();
+        arrayAppend(_nodes, Node{bounds, 0, 0});
+        CORRADE_INTERNAL_ASSERT(stackSize + 2 <= MaxDepth);
+        stack[stackSize++] = {middle, range.end, node};
+        stack[stackSize++] = {range.begin, middle, ~UnsignedInt{}};
+    }
+
+    /* Release the extra capacity so the array has a default deleter */
+    arrayShrink(_nodes, DefaultInit);
+}
+
+BoundingVolumeHierarchy3D::BoundingVolumeHierarchy3D(BoundingVolumeHierarchy3D&&) noexcept = default;
+
+BoundingVolumeHierarchy3D::~BoundingVolumeHierarchy3D() = default;
+
+BoundingVolumeHierarchy3D& BoundingVolumeHierarchy3D::operator=(BoundingVolumeHierarchy3D&&) noexcept = default;
+
+Range3D BoundingVolumeHierarchy3D::sceneBounds() const {
+    return _nodes.isEmpty() ? Range3D{} : _nodes[0].bounds;
+}
+
+BoundingVolumeHierarchy3D& BoundingVolumeHierarchy3D::refit(const Containers::StridedArrayView1D<const Matrix4>& absoluteTransformations) {
+    CORRADE_ASSERT(absoluteTransformations.size() == _objectCount,
+        "SceneTools::BoundingVolumeHierarchy3D::refit(): expected" << _objectCount << "transformations but got" << absoluteTransformations.size(), *this);
+
+    for(std::size_t i = 0; i != _bounds.size(); ++i)
+        _bounds[i] = transformBounds(absoluteTransformations[_objects[i]], _meshBounds[i]);
+    refitNodes();
+    return *this;
+}
+
+BoundingVolumeHierarchy3D& BoundingVolumeHierarchy3D::refitEntries(const Containers::StridedArrayView1D<const Matrix4>& absoluteTransformations) {
+    CORRADE_ASSERT(absoluteTransformations.size() == _bounds.size(),
+        "SceneTools::BoundingVolumeHierarchy3D::refitEntries(): expected" << _bounds.size() << "transformations but got" << absoluteTransformations.size(), *this);
+
+    for(std::size_t i = 0; i != _bounds.size(); ++i)
+        _bounds[i] = transformBounds(absoluteTransformations[i], _meshBounds[i]);
+    refitNodes();
+    return *this;
+}
+
+void BoundingVolumeHierarchy3D::refitNodes() {
+    /* Children are always after their parents, so going backwards ensures
+       children are updated before their parents */
+    for(std::size_t i = _nodes.size(); i != 0; --i) {
+        Node& node = _nodes[i - 1];
+        if(node.count) {
+            node.bounds = _bounds[_order[node.first]];
+            for(UnsignedInt j = node.first + 1, jMax = node.first + node.count; j != jMax; ++j)
+                node.bounds = Math::join(node.bounds, _bounds[_order[j]]);
+        } else node.bounds = Math::join(_nodes[i].bounds, _nodes[node.first].bounds);
+    }
+}
+
+std::size_t BoundingVolumeHierarchy3D::cull(const Frustum& frustum, const Containers::MutableBitArrayView& visible) const {
+    CORRADE_ASSERT(visible.size() == _bounds.size(),
+        "SceneTools::BoundingVolumeHierarchy3D::cull(): expected" << _bounds.size() << "bits but got" << visible.size(), {});
+
+    visible.resetAll();
+    if(_nodes.isEmpty())
+        return 0;
+
+    std::size_t count = 0;
+    UnsignedInt stack[MaxDepth];
+    std::size_t stackSize = 0;
+    stack[stackSize++] = 0;
+    while(stackSize) {
+        const UnsignedInt nodeId = stack[--stackSize];
+        const Node& node = _nodes[nodeId];
+        if(!Math::Intersection::rangeFrustum(node.bounds, frustum))
+            continue;
+
+        if(node.count) {
+            for(UnsignedInt j = node.first, jMax = node.first + node.count; j != jMax; ++j) {
+                /* A single entry in a leaf has the same bounds as the leaf,
+                   no need to test again */
+                if(node.count == 1 || Math::Intersection::rangeFrustum(_bounds[_order[j]], frustum)) {
+                    visible.set(_order[j]);
+                    ++count;
+                }
+            }
+        } else {
+            CORRADE_INTERNAL_ASSERT(stackSize + 2 <= MaxDepth);
+            stack[stackSize++] = node.first;
+            stack[stackSize++] = nodeId + 1;
+        }
+    }
+
+    return count;
+}
+
+Containers::BitArray BoundingVolumeHierarchy3D::cull(const Frustum& frustum) const {
+    Containers::BitArray out{NoInit, _bounds.size()};
+    cull(frustum, out);
+    return out;
+}
+
+}}
@@ -0,0 +1,223 @@
+#ifndef Magnum_SceneTools_BoundingVolumeHierarchy_h
+#define Magnum_SceneTools_BoundingVolumeHierarchy_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneTools::BoundingVolumeHierarchy3D
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Bounding volume hierarchy over mesh instances in a 3D scene
+@m_since_latest
+
+Calculates absolute axis-aligned bounds of all @ref Trade::SceneField::Mesh
+entries in a scene from per-mesh bounds, such as ones calculated with
+@ref MeshTools::boundingRange(), and organizes them into a binary tree for
+efficient view frustum culling with @ref cull().
+
+The tree is built top-down by splitting entries at the median of their bound
+centers along the longest axis, until there's at most four entries in a leaf,
+resulting in a balanced tree with nodes stored in a depth-first order. When
+objects move, the entry bounds and bounds of all nodes can be updated with
+@ref refit() or @ref refitEntries(), which keeps the tree structure and thus
+is considerably cheaper than building the tree from scratch, but the culling
+efficiency may degrade over time if objects move significantly relative to
+each other. In that case it's better to construct a new instance.
+
+Entries of the hierarchy correspond to entries of the
+@ref Trade::SceneField::Mesh field in the scene passed to the constructor,
+bits in the output of @ref cull() are then in the same order as well.
+
+@experimental
+*/
+class MAGNUM_SCENETOOLS_EXPORT BoundingVolumeHierarchy3D {
+    public:
+        /**
+         * @brief Constructor
+         * @param scene                 Input scene
+         * @param meshBounds            Bounds of meshes referenced by the
+         *      scene
+         * @param globalTransformation  Global transformation to prepend
+         *
+         * Expects that @p scene is 3D, has a @ref Trade::SceneField::Parent
+         * field satisfying the conditions of
+         * @ref absoluteFieldTransformations3D() and that @p meshBounds is
+         * large enough to contain all IDs referenced by the
+         * @ref Trade::SceneField::Mesh field. If the scene has no mesh field,
+         * the hierarchy is empty. Bounds of each entry are calculated by
+         * transforming @p meshBounds of given mesh with its absolute
+         * transformation and taking an axis-aligned box containing the result.
+         *
+         * The operation is done in an @f$ \mathcal{O}(n \log n) @f$
+         * execution time and @f$ \mathcal{O}(n) @f$ memory complexity, with
+         * @f$ n @f$ being the mesh field size.
+         */
+        explicit BoundingVolumeHierarchy3D(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const Range3D>& meshBounds, const Matrix4& globalTransformation = {});
+
+        /** @brief Copying is not allowed */
+        BoundingVolumeHierarchy3D(const BoundingVolumeHierarchy3D&) = delete;
+
+        /** @brief Move constructor */
+        BoundingVolumeHierarchy3D(BoundingVolumeHierarchy3D&&) noexcept;
+
+        ~BoundingVolumeHierarchy3D();
+
+        /** @brief Copying is not allowed */
+        BoundingVolumeHierarchy3D& operator=(const BoundingVolumeHierarchy3D&) = delete;
+
+        /** @brief Move assignment */
+        BoundingVolumeHierarchy3D& operator=(BoundingVolumeHierarchy3D&&) noexcept;
+
+        /**
+         * @brief Object count
+         *
+         * Equal to @ref Trade::SceneData::mappingBound() of the scene passed
+         * to the constructor.
+         */
+        std::size_t objectCount() const { return _objectCount; }
+
+        /**
+         * @brief Entry count
+         *
+         * Equal to size of the @ref Trade::SceneField::Mesh field of the
+         * scene passed to the constructor.
+         */
+        std::size_t entryCount() const { return _objects.size(); }
+
+        /**
+         * @brief Object ID for each entry
+         *
+         * Size is equal to @ref entryCount().
+         */
+        Containers::ArrayView<const UnsignedInt> objects() const { return _objects; }
+
+        /**
+         * @brief Mesh ID for each entry
+         *
+         * Size is equal to @ref entryCount().
+         */
+        Containers::ArrayView<const UnsignedInt> meshes() const { return _meshes; }
+
+        /**
+         * @brief Absolute bounds of each entry
+         *
+         * Size is equal to @ref entryCount().
+         */
+        Containers::ArrayView<const Range3D> bounds() const { return _bounds; }
+
+        /**
+         * @brief Bounds of the whole hierarchy
+         *
+         * If the hierarchy is empty, returns a default-constructed range.
+         */
+        Range3D sceneBounds() const;
+
+        /** @brief Count of nodes in the tree */
+        std::size_t nodeCount() const { return _nodes.size(); }
+
+        /**
+         * @brief Refit the hierarchy to new absolute object transformations
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p absoluteTransformations has @ref objectCount()
+         * items, indexed by object ID, such as
+         * @ref TransformationCache3D::absoluteTransformations(). Recalculates
+         * bounds of all entries and then bounds of all nodes, keeping the
+         * tree structure unchanged. The operation is done in an
+         * @f$ \mathcal{O}(n) @f$ execution time.
+         * @see @ref refitEntries()
+         */
+        BoundingVolumeHierarchy3D& refit(const Containers::StridedArrayView1D<const Matrix4>& absoluteTransformations);
+
+        /**
+         * @brief Refit the hierarchy to new absolute entry transformations
+         * @return Reference to self (for method chaining)
+         *
+         * Like @ref refit(), but expects that @p absoluteTransformations has
+         * @ref entryCount() items, one for each @ref Trade::SceneField::Mesh
+         * entry, such as the output of @ref absoluteFieldTransformations3D().
+         */
+        BoundingVolumeHierarchy3D& refitEntries(const Containers::StridedArrayView1D<const Matrix4>& absoluteTransformations);
+
+        /**
+         * @brief Cull entries against a frustum
+         * @param[in]  frustum      Frustum to cull against
+         * @param[out] visible      Where to put visibility of each entry
+         * @return Count of visible entries
+         *
+         * Expects that @p visible has @ref entryCount() bits. A bit is set
+         * if the entry bounds intersect the frustum according to
+         * @ref Math::Intersection::rangeFrustum() and reset otherwise.
+         * Subtrees with bounds outside of the frustum are skipped as a whole.
+         */
+        std::size_t cull(const Frustum& frustum, const Containers::MutableBitArrayView& visible) const;
+
+        /**
+         * @brief Cull entries against a frustum
+         *
+         * Like @ref cull(const Frustum&, const Containers::MutableBitArrayView&) const,
+         * but returns a newly allocated bit array.
+         */
+        Containers::BitArray cull(const Frustum& frustum) const;
+
+    private:
+        /* Inner nodes have count set to zero, left child is the next node and
+           right child is at `first`. Leaf nodes have entries in the
+           [first, first + count) range of _order. */
+        struct Node {
+            Range3D bounds;
+            UnsignedInt first;
+            UnsignedInt count;
+        };
+
+        MAGNUM_SCENETOOLS_LOCAL void refitNodes();
+
+        std::size_t _objectCount;
+        Containers::Array<UnsignedInt> _objects;
+        Containers::Array<UnsignedInt> _meshes;
+        /* Mesh bounds for each entry, to not need to keep the meshBounds
+           view passed to the constructor */
+        Containers::Array<Range3D> _meshBounds;
+        Containers::Array<Range3D> _bounds;
+        /* Entry indices ordered so each leaf references a contiguous range */
+        Containers::Array<UnsignedInt> _order;
+        Containers::Array<Node> _nodes;
+};
+
+}}
+
+#endif
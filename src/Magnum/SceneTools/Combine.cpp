@@ -49,4 +49,57 @@ Trade::SceneData combineFields(const Trade::SceneData& scene) {
     return combineFields(scene.mappingType(), scene.mappingBound(), fields);
 }
 
+std::size_t combineFieldsDataSize(const Trade::SceneMappingType mappingType, const Containers::ArrayView<const Trade::SceneFieldData> fields) {
+    Implementation::CombineLayout layout;
+    if(!Implementation::combineFieldsLayout("SceneTools::combineFieldsDataSize():", mappingType, fields, layout))
+        return {};
+
+    return Implementation::combineFieldsPlace(layout.items, nullptr, nullptr);
+}
+
+std::size_t combineFieldsDataSize(const Trade::SceneMappingType mappingType, const std::initializer_list<Trade::SceneFieldData> fields) {
+    return combineFieldsDataSize(mappingType, Containers::arrayView(fields));
+}
+
+Trade::SceneData combineFieldsInto(const Trade::SceneMappingType mappingType, const UnsignedLong mappingBound, const Containers::ArrayView<const Trade::SceneFieldData> fields, const Containers::ArrayView<char> data) {
+    CORRADE_ASSERT(reinterpret_cast<std::uintptr_t>(data.data()) % Implementation::CombineDataAlignment == 0,
+        "SceneTools::combineFieldsInto(): expected data to be aligned to" << Implementation::CombineDataAlignment << "bytes but got" << reinterpret_cast<const void*>(data.data()),
+        (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+
+    Implementation::CombineLayout layout;
+    if(!Implementation::combineFieldsLayout("SceneTools::combineFieldsInto():", mappingType, fields, layout))
+        return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}};
+
+    const std::size_t size = Implementation::combineFieldsPlace(layout.items, nullptr, nullptr);
+    CORRADE_ASSERT(data.size() >= size,
+        "SceneTools::combineFieldsInto(): expected data of at least" << size << "bytes but got" << data.size(),
+        (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+
+    Containers::Array<Implementation::CombineItemView> itemViews{layout.items.size()};
+    Implementation::combineFieldsPlace(layout.items, data.data(), itemViews);
+
+    Containers::Array<Trade::SceneFieldData> outFields = Implementation::combineFieldsCopy(mappingType, fields, itemViews, layout.itemMappings);
+    return Trade::SceneData{mappingType, mappingBound, Trade::DataFlag::Mutable, data.prefix(size), Utility::move(outFields)};
+}
+
+Trade::SceneData combineFieldsInto(const Trade::SceneMappingType mappingType, const UnsignedLong mappingBound, const std::initializer_list<Trade::SceneFieldData> fields, const Containers::ArrayView<char> data) {
+    return combineFieldsInto(mappingType, mappingBound, Containers::arrayView(fields), data);
+}
+
+Trade::SceneData combineFieldsReference(const Trade::SceneData& scene, const Trade::SceneMappingType mappingType) {
+    /* If the mapping type matches, the data can be referenced directly.
+       Offset-only fields are fine in this case as they're relative to the
+       same data. */
+    if(scene.mappingType() == mappingType)
+        return Trade::SceneData{mappingType, scene.mappingBound(),
+            {}, scene.data(),
+            Trade::sceneFieldDataNonOwningArray(scene.fieldData())};
+
+    /* Can't just pass scene.fieldData() directly as those can be offset-only */
+    Containers::Array<Trade::SceneFieldData> fields{NoInit, scene.fieldCount()};
+    for(std::size_t i = 0; i != fields.size(); ++i)
+        fields[i] = scene.fieldData(i);
+    return combineFields(mappingType, scene.mappingBound(), fields);
+}
+
 }}
@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::SceneTools::combineFields()
+ * @brief Function @ref Magnum::SceneTools::combineFields(), @ref Magnum::SceneTools::combineFieldsDataSize(), @ref Magnum::SceneTools::combineFieldsInto(), @ref Magnum::SceneTools::combineFieldsReference()
  * @m_since_latest
  */
 
@@ -62,6 +62,7 @@ used to calculate the total string data size. Note that offset-only
 The resulting fields are always tightly packed (not interleaved). Returned data
 flags have both @ref Trade::DataFlag::Mutable and @ref Trade::DataFlag::Owned,
 so mutable attribute access is guaranteed.
+@see @ref combineFieldsInto(), @ref combineFieldsReference()
 */
 MAGNUM_SCENETOOLS_EXPORT Trade::SceneData combineFields(Trade::SceneMappingType mappingType, UnsignedLong mappingBound, Containers::ArrayView<const Trade::SceneFieldData> fields);
 
@@ -84,6 +85,62 @@ by any field.
 */
 MAGNUM_SCENETOOLS_EXPORT Trade::SceneData combineFields(const Trade::SceneData& scene);
 
+/**
+@brief Size of data needed for combining scene fields
+@m_since_latest
+
+Returns the size of a data view to pass to
+@ref combineFieldsInto(Trade::SceneMappingType, UnsignedLong, Containers::ArrayView<const Trade::SceneFieldData>, Containers::ArrayView<char>)
+for given @p fields, assuming the view is aligned to 8 bytes. The same
+restrictions as in @ref combineFields(Trade::SceneMappingType, UnsignedLong, Containers::ArrayView<const Trade::SceneFieldData>)
+apply to @p fields.
+*/
+MAGNUM_SCENETOOLS_EXPORT std::size_t combineFieldsDataSize(Trade::SceneMappingType mappingType, Containers::ArrayView<const Trade::SceneFieldData> fields);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_SCENETOOLS_EXPORT std::size_t combineFieldsDataSize(Trade::SceneMappingType mappingType, std::initializer_list<Trade::SceneFieldData> fields);
+
+/**
+@brief Combine scene fields together into an existing memory
+@m_since_latest
+
+Like @ref combineFields(Trade::SceneMappingType, UnsignedLong, Containers::ArrayView<const Trade::SceneFieldData>),
+but instead of allocating a new array puts the data into the @p data view,
+which is expected to be aligned to 8 bytes and have at least the size returned
+by @ref combineFieldsDataSize(). Useful for example for putting multiple
+scenes into a single caller-owned arena. The returned instance references
+a prefix of @p data that has exactly the size returned by
+@ref combineFieldsDataSize() and has only @ref Trade::DataFlag::Mutable set,
+the caller is responsible for keeping @p data in scope for as long as the
+returned instance is used.
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData combineFieldsInto(Trade::SceneMappingType mappingType, UnsignedLong mappingBound, Containers::ArrayView<const Trade::SceneFieldData> fields, Containers::ArrayView<char> data);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData combineFieldsInto(Trade::SceneMappingType mappingType, UnsignedLong mappingBound, std::initializer_list<Trade::SceneFieldData> fields, Containers::ArrayView<char> data);
+
+/**
+@brief Combine scene fields, referencing the original data if possible
+@m_since_latest
+
+If @p scene already has given @p mappingType, returns a @ref Trade::SceneData
+instance referencing its data and fields without copying anything, with
+@ref Trade::SceneData::dataFlags() being empty. The original @p scene is then
+expected to stay in scope for as long as the returned instance is used.
+Otherwise calls @ref combineFields(Trade::SceneMappingType, UnsignedLong, Containers::ArrayView<const Trade::SceneFieldData>)
+with fields coming from @p scene, returning an owned copy with all fields
+converted to @p mappingType. Useful for example for importer output that
+already has the desired mapping type, where a full copy would be a waste.
+@see @ref copy(const Trade::SceneData&)
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData combineFieldsReference(const Trade::SceneData& scene, Trade::SceneMappingType mappingType);
+
 }}
 
 #endif
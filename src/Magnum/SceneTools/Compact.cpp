@@ -0,0 +1,317 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Compact.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Complex.h"
+#include "Magnum/Math/DualComplex.h"
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/Combine.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+Trade::SceneMappingType compactMappingType(const UnsignedLong mappingBound) {
+    if(mappingBound <= 0x100ull)
+        return Trade::SceneMappingType::UnsignedByte;
+    if(mappingBound <= 0x10000ull)
+        return Trade::SceneMappingType::UnsignedShort;
+    if(mappingBound <= 0x100000000ull)
+        return Trade::SceneMappingType::UnsignedInt;
+    return Trade::SceneMappingType::UnsignedLong;
+}
+
+namespace {
+
+template<class T> void indexFieldRange(const Containers::StridedArrayView1D<const T>& field, Long& min, Long& max) {
+    for(const T i: field) {
+        if(Long(i) < min) min = i;
+        if(Long(i) > max) max = i;
+    }
+}
+
+template<class T> void indexFieldInto(const Containers::StridedArrayView1D<const T>& field, const Containers::StridedArrayView1D<Long>& destination) {
+    for(std::size_t i = 0; i != field.size(); ++i)
+        destination[i] = field[i];
+}
+
+template<class T> void indexFieldFrom(const Containers::StridedArrayView1D<const Long>& field, const Containers::StridedArrayView1D<T>& destination) {
+    for(std::size_t i = 0; i != field.size(); ++i)
+        destination[i] = T(field[i]);
+}
+
+template<class T> bool isAffine(const Containers::StridedArrayView1D<const Math::Matrix<3, T>>& field) {
+    for(const Math::Matrix<3, T>& i: field)
+        if(i.row(2) != Math::Vector3<T>{T(0), T(0), T(1)}) return false;
+    return true;
+}
+
+template<class T> bool isAffine(const Containers::StridedArrayView1D<const Math::Matrix<4, T>>& field) {
+    for(const Math::Matrix<4, T>& i: field)
+        if(i.row(3) != Math::Vector4<T>{T(0), T(0), T(0), T(1)}) return false;
+    return true;
+}
+
+/* Slices the matrix to the destination size in the original precision first
+   and then converts the underlying type */
+template<class T, class U> void matrixInto(const Containers::StridedArrayView1D<const T>& field, const Containers::StridedArrayView1D<U>& destination) {
+    for(std::size_t i = 0; i != field.size(); ++i)
+        destination[i] = U{Math::RectangularMatrix<U::Cols, U::Rows, typename T::Type>{field[i]}};
+}
+
+template<class T, class U> void convertInto(const Containers::StridedArrayView1D<const T>& field, const Containers::StridedArrayView1D<U>& destination) {
+    for(std::size_t i = 0; i != field.size(); ++i)
+        destination[i] = U{field[i]};
+}
+
+bool isIndexField(const Trade::SceneField name) {
+    return name == Trade::SceneField::Parent ||
+           name == Trade::SceneField::Mesh ||
+           name == Trade::SceneField::MeshMaterial ||
+           name == Trade::SceneField::Light ||
+           name == Trade::SceneField::Camera ||
+           name == Trade::SceneField::Skin;
+}
+
+Trade::SceneFieldType compactIndexFieldType(const Trade::SceneData& scene, const UnsignedInt fieldId) {
+    const Trade::SceneField name = scene.fieldName(fieldId);
+    const Trade::SceneFieldType type = scene.fieldType(fieldId);
+
+    Long min = 0, max = 0;
+    switch(type) {
+        #define _c(type)                                                    \
+            case Trade::SceneFieldType::type:                               \
+                indexFieldRange(scene.field<type>(fieldId), min, max);      \
+                break;
+        _c(UnsignedByte)
+        _c(UnsignedShort)
+        _c(UnsignedInt)
+        _c(Byte)
+        _c(Short)
+        _c(Int)
+        _c(Long)
+        #undef _c
+        /* Builtin index fields can't have any other type */
+        default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+
+    /* Parent and MeshMaterial are signed, with -1 meaning "no parent" or "no
+       material". Parent can additionally be 64-bit. */
+    if(name == Trade::SceneField::Parent ||
+       name == Trade::SceneField::MeshMaterial) {
+        if(min >= -0x80ll && max <= 0x7fll)
+            return Trade::SceneFieldType::Byte;
+        if(min >= -0x8000ll && max <= 0x7fffll)
+            return Trade::SceneFieldType::Short;
+        if(min >= -0x80000000ll && max <= 0x7fffffffll)
+            return Trade::SceneFieldType::Int;
+        return Trade::SceneFieldType::Long;
+    }
+
+    if(max <= 0xffll)
+        return Trade::SceneFieldType::UnsignedByte;
+    if(max <= 0xffffll)
+        return Trade::SceneFieldType::UnsignedShort;
+    return Trade::SceneFieldType::UnsignedInt;
+}
+
+Trade::SceneFieldType compactTransformationFieldType(const Trade::SceneData& scene, const UnsignedInt fieldId, const CompactFieldsFlags flags) {
+    const bool toFloats = flags >= CompactFieldsFlag::DoublesToFloats;
+    switch(scene.fieldType(fieldId)) {
+        case Trade::SceneFieldType::Matrix3x3:
+            return isAffine(scene.field<Matrix3x3>(fieldId)) ?
+                Trade::SceneFieldType::Matrix3x2 :
+                Trade::SceneFieldType::Matrix3x3;
+        case Trade::SceneFieldType::Matrix4x4:
+            return isAffine(scene.field<Matrix4x4>(fieldId)) ?
+                Trade::SceneFieldType::Matrix4x3 :
+                Trade::SceneFieldType::Matrix4x4;
+        case Trade::SceneFieldType::Matrix3x3d:
+            if(isAffine(scene.field<Matrix3x3d>(fieldId)))
+                return toFloats ? Trade::SceneFieldType::Matrix3x2 :
+                                  Trade::SceneFieldType::Matrix3x2d;
+            return toFloats ? Trade::SceneFieldType::Matrix3x3 :
+                              Trade::SceneFieldType::Matrix3x3d;
+        case Trade::SceneFieldType::Matrix4x4d:
+            if(isAffine(scene.field<Matrix4x4d>(fieldId)))
+                return toFloats ? Trade::SceneFieldType::Matrix4x3 :
+                                  Trade::SceneFieldType::Matrix4x3d;
+            return toFloats ? Trade::SceneFieldType::Matrix4x4 :
+                              Trade::SceneFieldType::Matrix4x4d;
+        #define _c(type, floatType)                                         \
+            case Trade::SceneFieldType::type:                               \
+                return toFloats ? Trade::SceneFieldType::floatType :        \
+                                  Trade::SceneFieldType::type;
+        _c(Matrix3x2d, Matrix3x2)
+        _c(Matrix4x3d, Matrix4x3)
+        _c(DualComplexd, DualComplex)
+        _c(DualQuaterniond, DualQuaternion)
+        _c(Vector2d, Vector2)
+        _c(Vector3d, Vector3)
+        _c(Complexd, Complex)
+        _c(Quaterniond, Quaternion)
+        #undef _c
+        default:
+            return scene.fieldType(fieldId);
+    }
+}
+
+/* Fills the fields with placeholders for everything that needs to be
+   converted and returns the target mapping type */
+Trade::SceneMappingType compactLayout(const Trade::SceneData& scene, const CompactFieldsFlags flags, const Containers::ArrayView<Trade::SceneFieldData> fields) {
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        const Trade::SceneField name = scene.fieldName(i);
+
+        /* Only builtin fields have their types compacted, custom fields can
+           be anything and are thus copied verbatim. Builtin fields can't be
+           arrays. */
+        Trade::SceneFieldType type = scene.fieldType(i);
+        if(isIndexField(name))
+            type = compactIndexFieldType(scene, i);
+        else if(name == Trade::SceneField::Transformation ||
+                name == Trade::SceneField::Translation ||
+                name == Trade::SceneField::Rotation ||
+                name == Trade::SceneField::Scaling)
+            type = compactTransformationFieldType(scene, i, flags);
+
+        /* If the type stays the same, grab the field in full. This will also
+           convert offset-only fields to absolute. */
+        if(type == scene.fieldType(i)) {
+            fields[i] = scene.fieldData(i);
+            continue;
+        }
+
+        fields[i] = Trade::SceneFieldData{name,
+            scene.mapping(i), type,
+            Containers::StridedArrayView2D<const char>{{nullptr, ~std::size_t{}}, {scene.fieldSize(i), Trade::sceneFieldTypeSize(type)}},
+            /* No field entries are removed nor the mapping is modified in any
+               way, so the flags can be passed through in full */
+            scene.fieldFlags(i)};
+    }
+
+    return compactMappingType(scene.mappingBound());
+}
+
+void compactIndexFieldInto(const Trade::SceneData& scene, Trade::SceneData& out, const UnsignedInt fieldId) {
+    Containers::Array<Long> values{NoInit, scene.fieldSize(fieldId)};
+    switch(scene.fieldType(fieldId)) {
+        #define _c(type)                                                    \
+            case Trade::SceneFieldType::type:                               \
+                indexFieldInto(scene.field<type>(fieldId), Containers::stridedArrayView(values)); \
+                break;
+        _c(UnsignedByte)
+        _c(UnsignedShort)
+        _c(UnsignedInt)
+        _c(Byte)
+        _c(Short)
+        _c(Int)
+        _c(Long)
+        #undef _c
+        default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+
+    switch(out.fieldType(fieldId)) {
+        #define _c(type)                                                    \
+            case Trade::SceneFieldType::type:                               \
+                indexFieldFrom<type>(Containers::stridedArrayView(values), out.mutableField<type>(fieldId)); \
+                break;
+        _c(UnsignedByte)
+        _c(UnsignedShort)
+        _c(UnsignedInt)
+        _c(Byte)
+        _c(Short)
+        _c(Int)
+        _c(Long)
+        #undef _c
+        default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+}
+
+void compactTransformationFieldInto(const Trade::SceneData& scene, Trade::SceneData& out, const UnsignedInt fieldId) {
+    const Trade::SceneFieldType sourceType = scene.fieldType(fieldId);
+    const Trade::SceneFieldType destinationType = out.fieldType(fieldId);
+
+    #define _c(sourceType_, destinationType_, function)                     \
+        if(sourceType == Trade::SceneFieldType::sourceType_ &&              \
+           destinationType == Trade::SceneFieldType::destinationType_)      \
+            return function(scene.field<sourceType_>(fieldId),              \
+                out.mutableField<destinationType_>(fieldId));
+    _c(Matrix3x3, Matrix3x2, matrixInto)
+    _c(Matrix3x3d, Matrix3x2d, matrixInto)
+    _c(Matrix3x3d, Matrix3x2, matrixInto)
+    _c(Matrix3x3d, Matrix3x3, matrixInto)
+    _c(Matrix3x2d, Matrix3x2, matrixInto)
+    _c(Matrix4x4, Matrix4x3, matrixInto)
+    _c(Matrix4x4d, Matrix4x3d, matrixInto)
+    _c(Matrix4x4d, Matrix4x3, matrixInto)
+    _c(Matrix4x4d, Matrix4x4, matrixInto)
+    _c(Matrix4x3d, Matrix4x3, matrixInto)
+    _c(DualComplexd, DualComplex, convertInto)
+    _c(DualQuaterniond, DualQuaternion, convertInto)
+    _c(Vector2d, Vector2, convertInto)
+    _c(Vector3d, Vector3, convertInto)
+    _c(Complexd, Complex, convertInto)
+    _c(Quaterniond, Quaternion, convertInto)
+    #undef _c
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+}
+
+Trade::SceneData compactFields(const Trade::SceneData& scene, const CompactFieldsFlags flags) {
+    Containers::Array<Trade::SceneFieldData> fields{NoInit, scene.fieldCount()};
+    const Trade::SceneMappingType mappingType = compactLayout(scene, flags, fields);
+
+    /* Copy everything that can be copied as-is and the mapping of all fields,
+       then convert the data of fields that changed type into the placeholder
+       locations */
+    Trade::SceneData out = combineFields(mappingType, scene.mappingBound(), fields);
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        if(out.fieldType(i) == scene.fieldType(i))
+            continue;
+
+        if(isIndexField(scene.fieldName(i)))
+            compactIndexFieldInto(scene, out, i);
+        else
+            compactTransformationFieldInto(scene, out, i);
+    }
+
+    return out;
+}
+
+std::size_t compactFieldsDataSize(const Trade::SceneData& scene, const CompactFieldsFlags flags) {
+    Containers::Array<Trade::SceneFieldData> fields{NoInit, scene.fieldCount()};
+    const Trade::SceneMappingType mappingType = compactLayout(scene, flags, fields);
+    return combineFieldsDataSize(mappingType, fields);
+}
+
+}}
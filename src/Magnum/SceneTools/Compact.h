@@ -0,0 +1,140 @@
+#ifndef Magnum_SceneTools_Compact_h
+#define Magnum_SceneTools_Compact_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Function @ref Magnum::SceneTools::compactMappingType(), @ref Magnum::SceneTools::compactFields(), @ref Magnum::SceneTools::compactFieldsDataSize(), enum @ref Magnum::SceneTools::CompactFieldsFlag, enum set @ref Magnum::SceneTools::CompactFieldsFlags
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Scene field compaction flag
+@m_since_latest
+
+@see @ref CompactFieldsFlags, @ref compactFields(),
+    @ref compactFieldsDataSize()
+*/
+enum class CompactFieldsFlag: UnsignedByte {
+    /**
+     * Convert double-precision @ref Trade::SceneField::Transformation,
+     * @relativeref{Trade::SceneField,Translation},
+     * @relativeref{Trade::SceneField,Rotation} and
+     * @relativeref{Trade::SceneField,Scaling} fields to single precision.
+     * Unlike all other operations done by @ref compactFields() this is lossy
+     * and thus isn't done by default.
+     */
+    DoublesToFloats = 1 << 0
+};
+
+/**
+@brief Scene field compaction flags
+@m_since_latest
+
+@see @ref compactFields(), @ref compactFieldsDataSize()
+*/
+typedef Containers::EnumSet<CompactFieldsFlag> CompactFieldsFlags;
+
+CORRADE_ENUMSET_OPERATORS(CompactFieldsFlags)
+
+/**
+@brief Smallest mapping type able to represent given mapping bound
+@m_since_latest
+
+Returns @ref Trade::SceneMappingType::UnsignedByte if @p mappingBound is at
+most @cpp 256 @ce, @relativeref{Trade::SceneMappingType,UnsignedShort} if it's
+at most @cpp 65536 @ce, @relativeref{Trade::SceneMappingType,UnsignedInt} if
+it's at most @cpp 4294967296 @ce and
+@relativeref{Trade::SceneMappingType,UnsignedLong} otherwise.
+@see @ref compactFields()
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneMappingType compactMappingType(UnsignedLong mappingBound);
+
+/**
+@brief Compact scene fields to the narrowest types
+@m_since_latest
+
+Returns a copy of @p scene with the mapping converted to a type returned by
+@ref compactMappingType() for @ref Trade::SceneData::mappingBound() and with
+builtin fields converted to the smallest type that can represent their
+contents without a loss of precision:
+
+-   @ref Trade::SceneField::Parent and
+    @relativeref{Trade::SceneField,MeshMaterial} are converted to the smallest
+    signed type that fits the range of their values, including the
+    @cpp -1 @ce placeholders,
+-   @ref Trade::SceneField::Mesh, @relativeref{Trade::SceneField,Light},
+    @relativeref{Trade::SceneField,Camera} and
+    @relativeref{Trade::SceneField,Skin} are converted to the smallest
+    unsigned type that fits their maximum value,
+-   @ref Trade::SceneField::Transformation matrices that have the last row
+    equal to @cpp {0, 0, 1} @ce in 2D or @cpp {0, 0, 0, 1} @ce in 3D for all
+    entries are converted from @ref Trade::SceneFieldType::Matrix3x3 to
+    @relativeref{Trade::SceneFieldType,Matrix3x2} and from
+    @relativeref{Trade::SceneFieldType,Matrix4x4} to
+    @relativeref{Trade::SceneFieldType,Matrix4x3} or their double-precision
+    variants. The comparison is done with fuzzy precision as defined by
+    @ref Math::TypeTraits.
+
+If @ref CompactFieldsFlag::DoublesToFloats is set, double-precision
+transformation, translation, rotation and scaling fields are additionally
+converted to single precision. Other fields, including custom ones, are
+copied unchanged. Sharing of mapping views among fields is preserved in the
+same way as in @ref combineFields(Trade::SceneMappingType, UnsignedLong, Containers::ArrayView<const Trade::SceneFieldData>),
+the resulting fields are tightly packed and the returned data flags have both
+@ref Trade::DataFlag::Mutable and @ref Trade::DataFlag::Owned set.
+
+The half-float and quantized variants of translation, rotation and scaling
+are not among the types @ref Trade::SceneData accepts for builtin fields, and
+so aren't considered. To see how much memory the compaction saves compared to
+a tightly-packed copy without a need to perform it, compare
+@ref compactFieldsDataSize() to the size of @ref combineFields(const Trade::SceneData&)
+output or to @ref Trade::SceneData::data() of the original.
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData compactFields(const Trade::SceneData& scene, CompactFieldsFlags flags = {});
+
+/**
+@brief Size of data produced by scene field compaction
+@m_since_latest
+
+Returns the size of @ref Trade::SceneData::data() of a scene that
+@ref compactFields() would produce for @p scene and @p flags. Performs the same
+analysis of field contents as @ref compactFields() but doesn't allocate or copy
+any field data.
+*/
+MAGNUM_SCENETOOLS_EXPORT std::size_t compactFieldsDataSize(const Trade::SceneData& scene, CompactFieldsFlags flags = {});
+
+}}
+
+#endif
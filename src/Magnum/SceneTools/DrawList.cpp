@@ -0,0 +1,128 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DrawList.h"
+
+#include <algorithm>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+namespace {
+
+template<class T> Containers::Pair<Containers::Array<Containers::Pair<Int, UnsignedInt>>, Containers::Array<Containers::Pair<UnsignedInt, T>>> meshDrawListImplementation(const Trade::SceneData& scene, const Containers::Array<T>& transformations) {
+    const Containers::Array<Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>> meshesMaterials = scene.meshesMaterialsAsArray();
+
+    /* Sort the entries by material and mesh, keeping the original order for
+       entries that have both the same */
+    Containers::Array<UnsignedInt> entries{NoInit, meshesMaterials.size()};
+    for(std::size_t i = 0; i != entries.size(); ++i)
+        entries[i] = i;
+    std::stable_sort(entries.begin(), entries.end(), [&](UnsignedInt a, UnsignedInt b) {
+        const Containers::Pair<UnsignedInt, Int>& meshMaterialA = meshesMaterials[a].second();
+        const Containers::Pair<UnsignedInt, Int>& meshMaterialB = meshesMaterials[b].second();
+        return meshMaterialA.second() < meshMaterialB.second() ||
+              (meshMaterialA.second() == meshMaterialB.second() &&
+               meshMaterialA.first() < meshMaterialB.first());
+    });
+
+    /* Count consecutive runs of the same material and gather the draws */
+    Containers::Array<Containers::Pair<Int, UnsignedInt>> batches;
+    Containers::Array<Containers::Pair<UnsignedInt, T>> draws{NoInit, entries.size()};
+    for(std::size_t i = 0; i != entries.size(); ++i) {
+        const UnsignedInt entry = entries[i];
+        const Containers::Pair<UnsignedInt, Int>& meshMaterial = meshesMaterials[entry].second();
+        if(batches.isEmpty() || batches.back().first() != meshMaterial.second())
+            arrayAppend(batches, InPlaceInit, meshMaterial.second(), 0u);
+        ++batches.back().second();
+        draws[i] = {meshMaterial.first(), transformations[entry]};
+    }
+
+    /* Convert back to a default deleter to make this usable in plugins */
+    arrayShrink(batches, DefaultInit);
+
+    return {Utility::move(batches), Utility::move(draws)};
+}
+
+}
+
+Containers::Pair<Containers::Array<Containers::Pair<Int, UnsignedInt>>, Containers::Array<Containers::Pair<UnsignedInt, Matrix3>>> meshDrawList2D(const Trade::SceneData& scene, const Matrix3& globalTransformation) {
+    /* Checking here to not have the assertion message mention
+       absoluteFieldTransformations2D() */
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Mesh),
+        "SceneTools::meshDrawList2D(): the scene has no meshes", {});
+
+    return meshDrawListImplementation(scene, absoluteFieldTransformations2D(scene, Trade::SceneField::Mesh, globalTransformation));
+}
+
+Containers::Pair<Containers::Array<Containers::Pair<Int, UnsignedInt>>, Containers::Array<Containers::Pair<UnsignedInt, Matrix3>>> meshDrawList2D(const Trade::SceneData& scene) {
+    return meshDrawList2D(scene, {});
+}
+
+Containers::Pair<Containers::Array<Containers::Pair<Int, UnsignedInt>>, Containers::Array<Containers::Pair<UnsignedInt, Matrix4>>> meshDrawList3D(const Trade::SceneData& scene, const Matrix4& globalTransformation) {
+    /* Checking here to not have the assertion message mention
+       absoluteFieldTransformations3D() */
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Mesh),
+        "SceneTools::meshDrawList3D(): the scene has no meshes", {});
+
+    return meshDrawListImplementation(scene, absoluteFieldTransformations3D(scene, Trade::SceneField::Mesh, globalTransformation));
+}
+
+Containers::Pair<Containers::Array<Containers::Pair<Int, UnsignedInt>>, Containers::Array<Containers::Pair<UnsignedInt, Matrix4>>> meshDrawList3D(const Trade::SceneData& scene) {
+    return meshDrawList3D(scene, {});
+}
+
+void meshDrawRangesInto(const Containers::StridedArrayView1D<const UnsignedInt>& meshes, const Containers::StridedArrayView1D<const UnsignedInt>& meshCounts, const Containers::StridedArrayView1D<const UnsignedInt>& meshVertexOffsets, const Containers::StridedArrayView1D<const UnsignedInt>& meshIndexOffsets, const Containers::StridedArrayView1D<UnsignedInt>& counts, const Containers::StridedArrayView1D<UnsignedInt>& vertexOffsets, const Containers::StridedArrayView1D<UnsignedInt>& indexOffsets) {
+    CORRADE_ASSERT(meshVertexOffsets.size() == meshCounts.size() && (meshIndexOffsets.isEmpty() || meshIndexOffsets.size() == meshCounts.size()),
+        "SceneTools::meshDrawRangesInto(): expected mesh vertex and index offset views to have" << meshCounts.size() << "elements but got" << meshVertexOffsets.size() << "and" << meshIndexOffsets.size(), );
+    CORRADE_ASSERT(counts.size() == meshes.size() && vertexOffsets.size() == meshes.size(),
+        "SceneTools::meshDrawRangesInto(): expected count and vertex offset views to have" << meshes.size() << "elements but got" << counts.size() << "and" << vertexOffsets.size(), );
+    #ifndef CORRADE_NO_ASSERT
+    const std::size_t expectedIndexOffsetCount = meshIndexOffsets.isEmpty() ? 0 : meshes.size();
+    #endif
+    CORRADE_ASSERT(indexOffsets.size() == expectedIndexOffsetCount,
+        "SceneTools::meshDrawRangesInto(): expected index offset view to have" << expectedIndexOffsetCount << "elements but got" << indexOffsets.size(), );
+
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        const UnsignedInt mesh = meshes[i];
+        CORRADE_ASSERT(mesh < meshCounts.size(),
+            "SceneTools::meshDrawRangesInto(): mesh" << mesh << "out of range for" << meshCounts.size() << "meshes at index" << i, );
+        counts[i] = meshCounts[mesh];
+        vertexOffsets[i] = meshVertexOffsets[mesh];
+        if(!indexOffsets.isEmpty())
+            indexOffsets[i] = meshIndexOffsets[mesh];
+    }
+}
+
+}}
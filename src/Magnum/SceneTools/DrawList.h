@@ -0,0 +1,144 @@
+#ifndef Magnum_SceneTools_DrawList_h
+#define Magnum_SceneTools_DrawList_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::SceneTools::meshDrawList2D(), @ref Magnum::SceneTools::meshDrawList3D(), @ref Magnum::SceneTools::meshDrawRangesInto()
+ * @m_since_latest
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Compile a 2D scene into a flat draw list
+@m_since_latest
+
+Like @ref meshDrawList3D(), but for 2D scenes. Transformations are calculated
+using @ref absoluteFieldTransformations2D().
+
+Expects that the scene is 2D, has a @ref Trade::SceneField::Mesh field and
+satisfies the conditions of @ref absoluteFieldTransformations2D().
+@experimental
+
+@see @ref Trade::SceneData::is2D()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+MAGNUM_SCENETOOLS_EXPORT Containers::Pair<Containers::Array<Containers::Pair<Int, UnsignedInt>>, Containers::Array<Containers::Pair<UnsignedInt, Matrix3>>> meshDrawList2D(const Trade::SceneData& scene, const Matrix3& globalTransformation = {});
+#else
+/* To avoid including Matrix3 */
+MAGNUM_SCENETOOLS_EXPORT Containers::Pair<Containers::Array<Containers::Pair<Int, UnsignedInt>>, Containers::Array<Containers::Pair<UnsignedInt, Matrix3>>> meshDrawList2D(const Trade::SceneData& scene, const Matrix3& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT Containers::Pair<Containers::Array<Containers::Pair<Int, UnsignedInt>>, Containers::Array<Containers::Pair<UnsignedInt, Matrix3>>> meshDrawList2D(const Trade::SceneData& scene);
+#endif
+
+/**
+@brief Compile a 3D scene into a flat draw list
+@m_since_latest
+
+Returns a list of (material ID, draw count) batches sorted by the material
+ID, and a list of (mesh ID, absolute transformation) pairs for all draws in
+the batch order --- i.e., the first batch is formed by the first
+@cpp drawCount @ce draws, second batch by the next @cpp drawCount @ce draws
+etc. Draws in each batch are sorted by mesh ID, preserving the relative order
+of entries that reference the same mesh. The draws are taken from the
+@ref Trade::SceneField::Mesh and @relativeref{Trade::SceneField,MeshMaterial}
+fields, with absolute transformations calculated using
+@ref absoluteFieldTransformations3D() with @p globalTransformation prepended.
+If the @relativeref{Trade::SceneField,MeshMaterial} field isn't present, the
+whole draw list is a single batch with material ID @cpp -1 @ce.
+
+Compared to creating a @ref SceneGraph object for each mesh, the draw list is
+meant for static content, where the transformations get uploaded once and
+all draws are then submitted with just a few multi-draw calls. Together with
+@ref MeshTools::compile(const Containers::Iterable<const Trade::MeshData>&, const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<UnsignedInt>&, CompileFlags)
+putting all meshes into a shared vertex and index buffer and
+@ref meshDrawRangesInto() converting the per-mesh ranges into per-draw
+ranges, the output can be directly consumed by a
+@ref Shaders::PhongGL created with
+@ref Shaders::PhongGL::Flag::UniformBuffers and
+@relativeref{Shaders::PhongGL,Flag::MultiDraw}. The draws are then submitted
+in chunks of at most @ref Shaders::PhongGL::drawCount() items, with material
+IDs coming from @ref Shaders::PhongDrawUniform::materialId:
+
+@snippet Shaders-gl.cpp meshDrawList3D
+
+If materials use different textures, the batches tell where the texture
+bindings have to change. Otherwise, if all materials are expressible with
+just uniforms or the textures are in a texture array, the batches can be
+ignored and the draw list submitted as a whole.
+
+Expects that the scene is 3D, has a @ref Trade::SceneField::Mesh field and
+satisfies the conditions of @ref absoluteFieldTransformations3D(). The
+operation is done in an @f$ \mathcal{O}(n \log n) @f$ execution time and
+@f$ \mathcal{O}(n) @f$ memory complexity, with @f$ n @f$ being the mesh field
+size.
+@experimental
+
+@see @ref Trade::SceneData::is3D(), @ref meshInstanceTransformations3D()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+MAGNUM_SCENETOOLS_EXPORT Containers::Pair<Containers::Array<Containers::Pair<Int, UnsignedInt>>, Containers::Array<Containers::Pair<UnsignedInt, Matrix4>>> meshDrawList3D(const Trade::SceneData& scene, const Matrix4& globalTransformation = {});
+#else
+/* To avoid including Matrix4 */
+MAGNUM_SCENETOOLS_EXPORT Containers::Pair<Containers::Array<Containers::Pair<Int, UnsignedInt>>, Containers::Array<Containers::Pair<UnsignedInt, Matrix4>>> meshDrawList3D(const Trade::SceneData& scene, const Matrix4& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT Containers::Pair<Containers::Array<Containers::Pair<Int, UnsignedInt>>, Containers::Array<Containers::Pair<UnsignedInt, Matrix4>>> meshDrawList3D(const Trade::SceneData& scene);
+#endif
+
+/**
+@brief Convert per-mesh ranges to per-draw ranges
+@param[in]  meshes              Mesh IDs of all draws
+@param[in]  meshCounts          Index or vertex counts of all meshes
+@param[in]  meshVertexOffsets   Vertex offsets of all meshes
+@param[in]  meshIndexOffsets    Index offsets of all meshes
+@param[out] counts              Where to put index or vertex counts of all
+    draws
+@param[out] vertexOffsets       Where to put vertex offsets of all draws
+@param[out] indexOffsets        Where to put index offsets of all draws
+@m_since_latest
+
+For each draw, copies the range of the mesh referenced from @p meshes to
+@p counts, @p vertexOffsets and @p indexOffsets. Meant to be used with mesh IDs returned
+from @ref meshDrawList3D() or @ref meshDrawList2D() and per-mesh ranges
+returned from @ref MeshTools::compile(const Containers::Iterable<const Trade::MeshData>&, const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<UnsignedInt>&, CompileFlags),
+with the output being directly usable in
+@ref GL::AbstractShaderProgram::draw(GL::Mesh&, const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const UnsignedInt>&, const Containers::StridedArrayView1D<const UnsignedInt>&).
+
+Expects that @p meshCounts, @p meshVertexOffsets and @p meshIndexOffsets have
+the same size, that @p counts, @p vertexOffsets and @p indexOffsets have the
+same size as @p meshes and that all IDs in @p meshes are in bounds for the
+per-mesh ranges. If the meshes aren't indexed, @p meshIndexOffsets and
+@p indexOffsets can be both empty.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT void meshDrawRangesInto(const Containers::StridedArrayView1D<const UnsignedInt>& meshes, const Containers::StridedArrayView1D<const UnsignedInt>& meshCounts, const Containers::StridedArrayView1D<const UnsignedInt>& meshVertexOffsets, const Containers::StridedArrayView1D<const UnsignedInt>& meshIndexOffsets, const Containers::StridedArrayView1D<UnsignedInt>& counts, const Containers::StridedArrayView1D<UnsignedInt>& vertexOffsets, const Containers::StridedArrayView1D<UnsignedInt>& indexOffsets);
+
+}}
+
+#endif
@@ -78,44 +78,53 @@ Trade::SceneData filterExceptFields(const Trade::SceneData& scene, std::initiali
     return filterExceptFields(scene, Containers::arrayView(fields));
 }
 
-Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep) {
-    /* Track unique mapping views (pointer, size, stride) so fields that shared
-       a mapping before stay shared after as well -- if they're filtered, they
-       will have the mapping allocated in SharedMapping::filteredMapping()
-       instead of just a null placeholder when passing the filtered fields to
-       combineFields(), which will ensure they stay shared. If they're not
-       filtered, the original field view will get passed through, which ensures
-       the same. This also conveniently handles all cases of enforced mapping
-       such as for TRS fields so we don't need to special-case that here again. */
-    struct SharedMapping {
-        /* How many times given mapping is shared */
-        UnsignedInt count = 1;
-        /* How many times given mapping is filtered. Should be either 0 or same
-           as `count`. */
-        UnsignedInt filteredCount = 0;
-        #ifndef CORRADE_NO_ASSERT
-        /* Index in `entriesToKeep` that contains the filtering mask. All other
-           entries should use the same view (same pointer, offset and size). */
-        UnsignedInt maskIndex = ~UnsignedInt{};
-        #endif
-        /* Data array allocated for this mapping, in order to have
-           combineFields() preserve their sharing in the output. Doesn't
-           contain any actual data, it's used just to have a unique
-           (pointer, size, stride) combination. */
-        /** @todo any idea how to do this without the throwaway allocations? */
-        Containers::Array<char> filteredMapping;
-    };
-    /* A map<tuple> is used because it has conveniently implemented ordering,
-       an unordered_map couldn't be used without manually implementing a
-       std::tuple hash because STL DOES NOT HAVE IT, UGH. */
-    std::map<std::tuple<const void*, std::size_t, std::ptrdiff_t>, SharedMapping> uniqueMappings;
+namespace {
+
+/* Tracks unique mapping views (pointer, size, stride) so fields that shared a
+   mapping before stay shared after as well -- if they're filtered, they will
+   have the mapping allocated in SharedMapping::filteredMapping() instead of
+   just a null placeholder when passing the filtered fields to combineFields(),
+   which will ensure they stay shared. If they're not filtered, the original
+   field view will get passed through, which ensures the same. This also
+   conveniently handles all cases of enforced mapping such as for TRS fields so
+   we don't need to special-case that here again. */
+struct SharedMapping {
+    /* How many times given mapping is shared */
+    UnsignedInt count = 1;
+    /* How many times given mapping is filtered. Should be either 0 or same as
+       `count`. */
+    UnsignedInt filteredCount = 0;
+    #ifndef CORRADE_NO_ASSERT
+    /* Index in `entriesToKeep` that contains the filtering mask. All other
+       entries should use the same view (same pointer, offset and size). */
+    UnsignedInt maskIndex = ~UnsignedInt{};
+    #endif
+    /* Data array allocated for this mapping, in order to have combineFields()
+       preserve their sharing in the output. Doesn't contain any actual data,
+       it's used just to have a unique (pointer, size, stride) combination. */
+    /** @todo any idea how to do this without the throwaway allocations? */
+    Containers::Array<char> filteredMapping;
+};
+
+/* A map<tuple> is used because it has conveniently implemented ordering, an
+   unordered_map couldn't be used without manually implementing a std::tuple
+   hash because STL DOES NOT HAVE IT, UGH. */
+typedef std::map<std::tuple<const void*, std::size_t, std::ptrdiff_t>, SharedMapping> SharedMappings;
+
+/* Calculates the list of fields to pass to combineFields(), with filtered
+   fields turned into placeholders. Returns false if an assertion fails. */
+bool filterFieldEntriesFields(const char* const messagePrefix, const Trade::SceneData& scene, const Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep, SharedMappings& uniqueMappings, Containers::Array<Trade::SceneFieldData>& fields) {
+    #if defined(CORRADE_NO_ASSERT) || defined(CORRADE_STANDARD_ASSERT)
+    static_cast<void>(messagePrefix);
+    #endif
+
     for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
         /* Skip empty fields as those make no sense to include for sharing */
         if(!scene.fieldSize(i))
             continue;
 
         const Containers::StridedArrayView2D<const char> mapping = scene.mapping(i);
-        const std::pair<std::map<std::tuple<const void*, std::size_t, std::ptrdiff_t>, SharedMapping>::iterator, bool> inserted = uniqueMappings.emplace(std::make_tuple(mapping.data(), mapping.size()[0], mapping.stride()[0]), SharedMapping{});
+        const std::pair<SharedMappings::iterator, bool> inserted = uniqueMappings.emplace(std::make_tuple(mapping.data(), mapping.size()[0], mapping.stride()[0]), SharedMapping{});
         if(!inserted.second)
             ++inserted.first->second.count;
     }
@@ -123,7 +132,7 @@ Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Contain
     /* Copy all field metadata. By default, if the field isn't referenced, it's
        kept in full. Can't use Utility::copy() on the whole fieldData() array
        as those can be offset-only. */
-    Containers::Array<Trade::SceneFieldData> fields{ValueInit, scene.fieldCount()};
+    fields = Containers::Array<Trade::SceneFieldData>{ValueInit, scene.fieldCount()};
     for(std::size_t i = 0; i != scene.fieldCount(); ++i)
         fields[i] = scene.fieldData(i);
 
@@ -139,21 +148,20 @@ Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Contain
         const Containers::BitArrayView mask = entriesToKeep[i].second();
 
         CORRADE_ASSERT(fieldId < scene.fieldCount(),
-            "SceneTools::filterFieldEntries(): index" << fieldId << "out of range for" << scene.fieldCount() << "fields", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+            messagePrefix << "index" << fieldId << "out of range for" << scene.fieldCount() << "fields", false);
         CORRADE_ASSERT(!usedFields[fieldId],
-            "SceneTools::filterFieldEntries(): field" << scene.fieldName(fieldId) << "listed more than once", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+            messagePrefix << "field" << scene.fieldName(fieldId) << "listed more than once", false);
         #ifndef CORRADE_NO_ASSERT
         usedFields.set(fieldId);
         #endif
         CORRADE_ASSERT(scene.fieldSize(fieldId) == mask.size(),
-            "SceneTools::filterFieldEntries(): expected" << scene.fieldSize(fieldId) << "bits for" << scene.fieldName(fieldId) << "but got" << mask.size(),
-            (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+            messagePrefix << "expected" << scene.fieldSize(fieldId) << "bits for" << scene.fieldName(fieldId) << "but got" << mask.size(), false);
 
         const Trade::SceneFieldType fieldType = scene.fieldType(fieldId);
         CORRADE_ASSERT(!Trade::Implementation::isSceneFieldTypeString(fieldType),
-            "SceneTools::filterFieldEntries(): filtering string fields is not implemented yet, sorry", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+            messagePrefix << "filtering string fields is not implemented yet, sorry", false);
         CORRADE_ASSERT(fieldType != Trade::SceneFieldType::Bit,
-            "SceneTools::filterFieldEntries(): filtering bit fields is not implemented yet, sorry", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+            messagePrefix << "filtering bit fields is not implemented yet, sorry", false);
 
         /* Skip empty fields as there's nothing to do for them and they don't
            even have an entry in the uniqueMappings map. But do that only after
@@ -190,8 +198,7 @@ Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Contain
                     originalMask.data() == mask.data() &&
                     originalMask.offset() == mask.offset() &&
                     originalMask.size() == mask.size(),
-                    "SceneTools::filterFieldEntries(): field" << scene.fieldName(fieldId) << "shares mapping with" << scene.fieldName(originalFieldId) << "but was passed a different mask view",
-                    (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+                    messagePrefix << "field" << scene.fieldName(fieldId) << "shares mapping with" << scene.fieldName(originalFieldId) << "but was passed a different mask view", false);
             }
             #endif
 
@@ -218,13 +225,17 @@ Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Contain
     #ifndef CORRADE_NO_ASSERT
     for(const std::pair<const std::tuple<const void*, std::size_t, std::ptrdiff_t>, SharedMapping>& i: uniqueMappings) {
         CORRADE_ASSERT(!i.second.filteredCount || i.second.count == i.second.filteredCount,
-            "SceneTools::filterFieldEntries(): field" << scene.fieldName(entriesToKeep[i.second.maskIndex].first()) << "shares mapping with" << i.second.count << "fields but only" << i.second.filteredCount << "are filtered",
-            (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+            messagePrefix << "field" << scene.fieldName(entriesToKeep[i.second.maskIndex].first()) << "shares mapping with" << i.second.count << "fields but only" << i.second.filteredCount << "are filtered", false);
     }
     #endif
 
-    Trade::SceneData out = combineFields(scene.mappingType(), scene.mappingBound(), fields);
+    return true;
+}
 
+/* Copies filtered entries into the placeholders in the combined output. Goes
+   through a single field at a time, reading only its source mapping and
+   data. */
+void filterFieldEntriesCopy(const Trade::SceneData& scene, const Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep, const SharedMappings& uniqueMappings, Trade::SceneData& out) {
     for(const Containers::Pair<UnsignedInt, Containers::BitArrayView>& i: entriesToKeep) {
         /* Skip empty fields as there's nothing to do for them and they don't
            even have an entry in the uniqueMappings map */
@@ -239,7 +250,18 @@ Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Contain
 
         Utility::copyMasked(scene.field(i.first()), i.second(), out.mutableField(i.first()));
     }
+}
 
+}
+
+Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep) {
+    SharedMappings uniqueMappings;
+    Containers::Array<Trade::SceneFieldData> fields;
+    if(!filterFieldEntriesFields("SceneTools::filterFieldEntries():", scene, entriesToKeep, uniqueMappings, fields))
+        return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}};
+
+    Trade::SceneData out = combineFields(scene.mappingType(), scene.mappingBound(), fields);
+    filterFieldEntriesCopy(scene, entriesToKeep, uniqueMappings, out);
     return out;
 }
 
@@ -263,6 +285,40 @@ Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const std::in
     return filterFieldEntries(scene, Containers::arrayView(entriesToKeep));
 }
 
+std::size_t filterFieldEntriesDataSize(const Trade::SceneData& scene, const Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep) {
+    SharedMappings uniqueMappings;
+    Containers::Array<Trade::SceneFieldData> fields;
+    if(!filterFieldEntriesFields("SceneTools::filterFieldEntriesDataSize():", scene, entriesToKeep, uniqueMappings, fields))
+        return {};
+
+    return combineFieldsDataSize(scene.mappingType(), fields);
+}
+
+std::size_t filterFieldEntriesDataSize(const Trade::SceneData& scene, const std::initializer_list<Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep) {
+    return filterFieldEntriesDataSize(scene, Containers::arrayView(entriesToKeep));
+}
+
+Trade::SceneData filterFieldEntriesInto(const Trade::SceneData& scene, const Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep, const Containers::ArrayView<char> data) {
+    SharedMappings uniqueMappings;
+    Containers::Array<Trade::SceneFieldData> fields;
+    if(!filterFieldEntriesFields("SceneTools::filterFieldEntriesInto():", scene, entriesToKeep, uniqueMappings, fields))
+        return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}};
+
+    Trade::SceneData out = combineFieldsInto(scene.mappingType(), scene.mappingBound(), fields, data);
+    #ifdef CORRADE_GRACEFUL_ASSERT
+    /* If the data view was too small or misaligned, combineFieldsInto()
+       returned an empty instance. Exit to avoid asserting again below. */
+    if(out.fieldCount() != fields.size())
+        return out;
+    #endif
+    filterFieldEntriesCopy(scene, entriesToKeep, uniqueMappings, out);
+    return out;
+}
+
+Trade::SceneData filterFieldEntriesInto(const Trade::SceneData& scene, const std::initializer_list<Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep, const Containers::ArrayView<char> data) {
+    return filterFieldEntriesInto(scene, Containers::arrayView(entriesToKeep), data);
+}
+
 namespace {
 
 template<class T> std::size_t filterObjectsImplementation(const Trade::SceneData& scene, const Containers::ArrayView<Containers::Pair<UnsignedInt, Containers::BitArrayView>> fieldStorage, const Containers::MutableBitArrayView maskStorage, const Containers::BitArrayView objects, std::map<std::tuple<const void*, std::size_t, std::ptrdiff_t>, Containers::Optional<UnsignedInt>>& uniqueMappings) {
@@ -327,12 +383,10 @@ template<class T> std::size_t filterObjectsImplementation(const Trade::SceneData
     return fieldOffset;
 }
 
-}
-
-Trade::SceneData filterObjects(const Trade::SceneData& scene, const Containers::BitArrayView objects) {
-    CORRADE_ASSERT(objects.size() == scene.mappingBound(),
-        "SceneTools::filterObjects(): expected" << scene.mappingBound() << "bits but got" << objects.size(), (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
-
+/* Calculates masks for all fields that have entries mapped to filtered-out
+   objects. Returns the allocated storage, with `entriesToKeep` pointing into
+   it. */
+Containers::Array<char> filterObjectsEntries(const Trade::SceneData& scene, const Containers::BitArrayView objects, Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>>& entriesToKeep) {
     /** @todo while a BitArrayView is certainly faster for lookup than an
         unordered list of IDs, it might become rather problematic in cases
         where the mapping bound is sparse and *really huge* (i.e., storing
@@ -388,8 +442,38 @@ Trade::SceneData filterObjects(const Trade::SceneData& scene, const Containers::
     }
     CORRADE_INTERNAL_ASSERT(fieldCount != ~std::size_t{});
 
+    entriesToKeep = fieldStorage.prefix(fieldCount);
+    return Utility::move(storage);
+}
+
+}
+
+Trade::SceneData filterObjects(const Trade::SceneData& scene, const Containers::BitArrayView objects) {
+    CORRADE_ASSERT(objects.size() == scene.mappingBound(),
+        "SceneTools::filterObjects(): expected" << scene.mappingBound() << "bits but got" << objects.size(), (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+
     /* Delegate the rest to the low-level field entry filtering API */
-    return filterFieldEntries(scene, fieldStorage.prefix(fieldCount));
+    Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep;
+    const Containers::Array<char> storage = filterObjectsEntries(scene, objects, entriesToKeep);
+    return filterFieldEntries(scene, entriesToKeep);
+}
+
+std::size_t filterObjectsDataSize(const Trade::SceneData& scene, const Containers::BitArrayView objects) {
+    CORRADE_ASSERT(objects.size() == scene.mappingBound(),
+        "SceneTools::filterObjectsDataSize(): expected" << scene.mappingBound() << "bits but got" << objects.size(), {});
+
+    Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep;
+    const Containers::Array<char> storage = filterObjectsEntries(scene, objects, entriesToKeep);
+    return filterFieldEntriesDataSize(scene, entriesToKeep);
+}
+
+Trade::SceneData filterObjectsInto(const Trade::SceneData& scene, const Containers::BitArrayView objects, const Containers::ArrayView<char> data) {
+    CORRADE_ASSERT(objects.size() == scene.mappingBound(),
+        "SceneTools::filterObjectsInto(): expected" << scene.mappingBound() << "bits but got" << objects.size(), (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+
+    Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep;
+    const Containers::Array<char> storage = filterObjectsEntries(scene, objects, entriesToKeep);
+    return filterFieldEntriesInto(scene, entriesToKeep, data);
 }
 
 }}
@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::SceneTools::filterFields(), @ref Magnum::SceneTools::filterOnlyFields(), @ref Magnum::SceneTools::filterExceptFields(), @ref Magnum::SceneTools::filterFieldEntries()
+ * @brief Function @ref Magnum::SceneTools::filterFields(), @ref Magnum::SceneTools::filterOnlyFields(), @ref Magnum::SceneTools::filterExceptFields(), @ref Magnum::SceneTools::filterFieldEntries(), @ref Magnum::SceneTools::filterFieldEntriesDataSize(), @ref Magnum::SceneTools::filterFieldEntriesInto(), @ref Magnum::SceneTools::filterObjects(), @ref Magnum::SceneTools::filterObjectsDataSize(), @ref Magnum::SceneTools::filterObjectsInto()
  * @m_since_latest
  */
 
@@ -167,6 +167,51 @@ MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterFieldEntries(const Trade::SceneD
 */
 MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, std::initializer_list<Containers::Pair<Trade::SceneField, Containers::BitArrayView>> entriesToKeep);
 
+/**
+@brief Size of data needed for filtering individual entries of fields in a scene
+@m_since_latest
+
+Returns the size of a data view to pass to
+@ref filterFieldEntriesInto() for given @p scene and @p entriesToKeep. See
+@ref filterFieldEntries(const Trade::SceneData&, Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>>)
+for expectations on @p entriesToKeep and @ref combineFieldsDataSize() for more
+information.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT std::size_t filterFieldEntriesDataSize(const Trade::SceneData& scene, Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_SCENETOOLS_EXPORT std::size_t filterFieldEntriesDataSize(const Trade::SceneData& scene, std::initializer_list<Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep);
+
+/**
+@brief Filter individual entries of fields in a scene into an existing memory
+@m_since_latest
+
+Like @ref filterFieldEntries(const Trade::SceneData&, Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>>),
+but puts the output into @p data using @ref combineFieldsInto() instead of
+allocating a new array. The @p data is expected to be aligned to 8 bytes and
+have at least the size returned by @ref filterFieldEntriesDataSize(). The
+returned instance has only @ref Trade::DataFlag::Mutable set, the caller is
+responsible for keeping @p data in scope for as long as the returned instance
+is used.
+
+The fields are processed one after another, with each accessing just its own
+source and destination memory. Thus, when both @p scene and @p data are
+memory-mapped files, the amount of memory that needs to be resident at a time
+is proportional to the largest field, not to the whole scene.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterFieldEntriesInto(const Trade::SceneData& scene, Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep, Containers::ArrayView<char> data);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterFieldEntriesInto(const Trade::SceneData& scene, std::initializer_list<Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep, Containers::ArrayView<char> data);
+
 /**
 @brief Filter objects in a scene
 @m_since_latest
@@ -191,6 +236,32 @@ the returned data may end up being unusable.
 */
 MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterObjects(const Trade::SceneData& scene, Containers::BitArrayView objectsToKeep);
 
+/**
+@brief Size of data needed for filtering objects in a scene
+@m_since_latest
+
+Returns the size of a data view to pass to @ref filterObjectsInto() for given
+@p scene and @p objectsToKeep. The size of @p objectsToKeep is expected to be
+equal to @ref Trade::SceneData::mappingBound().
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT std::size_t filterObjectsDataSize(const Trade::SceneData& scene, Containers::BitArrayView objectsToKeep);
+
+/**
+@brief Filter objects in a scene into an existing memory
+@m_since_latest
+
+Like @ref filterObjects(), but puts the output into @p data using
+@ref filterFieldEntriesInto() instead of allocating a new array, see its
+documentation for more information. The @p data is expected to be aligned to
+8 bytes and have at least the size returned by @ref filterObjectsDataSize().
+Apart from @p data, the temporary memory used is a single bit for each field
+entry in @p scene and a copy of mappings that are shared among multiple
+filtered fields.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterObjectsInto(const Trade::SceneData& scene, Containers::BitArrayView objectsToKeep, Containers::ArrayView<char> data);
+
 }}
 
 #endif
@@ -28,12 +28,15 @@
 
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/ArrayTuple.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/BitArrayView.h>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/Triple.h>
 
 #include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Trade/SceneData.h"
@@ -278,7 +281,45 @@ template<> struct SceneDataDimensionTraits<3> {
     }
 };
 
-template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementation(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& outputTransformations, const MatrixTypeFor<dimensions, Float>& globalTransformation) {
+/* Count of objects or field entries processed by a single parallel task. Big
+   enough for the task overhead to not matter compared to the matrix
+   multiplications. */
+constexpr std::size_t AbsoluteTransformationsChunkSize = 4096;
+
+template<UnsignedInt dimensions> struct AbsoluteTransformationsState {
+    /* Range of orderedClusteredParents of the level currently processed */
+    Containers::ArrayView<const Containers::Pair<UnsignedInt, Int>> level;
+    Containers::ArrayView<MatrixTypeFor<dimensions, Float>> absoluteTransformations;
+    Containers::StridedArrayView1D<const UnsignedInt> mapping;
+    Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>> outputTransformations;
+};
+
+template<UnsignedInt dimensions> void absoluteTransformationsLevel(void* const statePointer, const std::size_t chunk) {
+    const AbsoluteTransformationsState<dimensions>& state = *static_cast<const AbsoluteTransformationsState<dimensions>*>(statePointer);
+    const std::size_t begin = chunk*AbsoluteTransformationsChunkSize;
+    const std::size_t end = Math::min(begin + AbsoluteTransformationsChunkSize, state.level.size());
+    for(const Containers::Pair<UnsignedInt, Int>& parentOffset: state.level.slice(begin, end)) {
+        state.absoluteTransformations[parentOffset.first() + 1] =
+            state.absoluteTransformations[parentOffset.second() + 1]*
+            state.absoluteTransformations[parentOffset.first() + 1];
+    }
+}
+
+template<UnsignedInt dimensions> void absoluteTransformationsOutput(void* const statePointer, const std::size_t chunk) {
+    const AbsoluteTransformationsState<dimensions>& state = *static_cast<const AbsoluteTransformationsState<dimensions>*>(statePointer);
+    const std::size_t begin = chunk*AbsoluteTransformationsChunkSize;
+    const std::size_t end = Math::min(begin + AbsoluteTransformationsChunkSize, state.outputTransformations.size());
+    /* The mapping aliases the output in the same way as in the serial variant
+       below, each mapping entry is read before the output at the same index
+       gets overwritten */
+    for(std::size_t i = begin; i != end; ++i)
+        state.outputTransformations[i] = state.absoluteTransformations[state.mapping[i] + 1];
+}
+
+/* If objects is non-null, only field entries attached to objects enabled in
+   it are written. Not combined with the parallel variant. */
+template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementation(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::BitArrayView* const objects, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& outputTransformations, const MatrixTypeFor<dimensions, Float>& globalTransformation, const ParallelFor parallelFor, void* const parallelForState) {
+    CORRADE_INTERNAL_ASSERT(!objects || !parallelFor);
     CORRADE_ASSERT(SceneDataDimensionTraits<dimensions>::isDimensions(scene),
         "SceneTools::absoluteFieldTransformations(): the scene is not" << dimensions << Debug::nospace << "D", );
     CORRADE_ASSERT(fieldId < scene.fieldCount(),
@@ -288,18 +329,28 @@ template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementa
         "SceneTools::absoluteFieldTransformations(): the scene has no hierarchy", );
     CORRADE_ASSERT(outputTransformations.size() == scene.fieldSize(fieldId),
         "SceneTools::absoluteFieldTransformationsInto(): bad output size, expected" << scene.fieldSize(fieldId) << "but got" << outputTransformations.size(), );
+    CORRADE_ASSERT(!objects || objects->size() == scene.mappingBound(),
+        "SceneTools::absoluteFieldTransformationsInto(): expected object mask to have" << scene.mappingBound() << "bits but got" << objects->size(), );
 
     /* Allocate a single storage for all temporary data */
     Containers::ArrayView<Containers::Pair<UnsignedInt, Int>> orderedClusteredParents;
     Containers::ArrayView<Containers::Pair<UnsignedInt, MatrixTypeFor<dimensions, Float>>> transformations;
     Containers::ArrayView<MatrixTypeFor<dimensions, Float>> absoluteTransformations;
+    Containers::ArrayView<UnsignedInt> depths;
+    Containers::ArrayView<UnsignedInt> mapping;
     Containers::ArrayTuple storage{
         /* Output of parentsBreadthFirstInto() */
         {NoInit, scene.fieldSize(*parentFieldId), orderedClusteredParents},
         /* Output of scene.transformationsXDInto() */
         {NoInit, scene.transformationFieldSize(), transformations},
         /* Above transformations but indexed by object ID */
-        {ValueInit, std::size_t(scene.mappingBound() + 1), absoluteTransformations}
+        {ValueInit, std::size_t(scene.mappingBound() + 1), absoluteTransformations},
+        /* Depth of each object in the hierarchy, indexed by object ID, used
+           only to split the objects into levels for the parallel variant */
+        {NoInit, parallelFor ? std::size_t(scene.mappingBound() + 1) : 0, depths},
+        /* Field object mapping for the masked variant, where the output can't
+           be used for it as not all its entries get overwritten */
+        {NoInit, objects ? scene.fieldSize(fieldId) : 0, mapping}
     };
     parentsBreadthFirstInto(scene,
         stridedArrayView(orderedClusteredParents).slice(&decltype(orderedClusteredParents)::Type::first),
@@ -318,116 +369,244 @@ template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementa
         absoluteTransformations[transformation.first() + 1] = transformation.second();
     }
 
+    /* For the masked variant, go through the parents in reverse, i.e. with
+       children always before their parents, and mark all ancestors of the
+       enabled objects. Then calculate absolute transformations only for the
+       enabled objects and their ancestors and assign them only to field
+       entries attached to the enabled objects. */
+    if(objects) {
+        Containers::BitArray ancestors{ValueInit, std::size_t(scene.mappingBound())};
+        for(std::size_t i = orderedClusteredParents.size(); i != 0; --i) {
+            const Containers::Pair<UnsignedInt, Int>& parentOffset = orderedClusteredParents[i - 1];
+            if(parentOffset.second() != -1 && ((*objects)[parentOffset.first()] || ancestors[parentOffset.first()]))
+                ancestors.set(parentOffset.second());
+        }
+
+        for(const Containers::Pair<UnsignedInt, Int>& parentOffset: orderedClusteredParents) {
+            if(!(*objects)[parentOffset.first()] && !ancestors[parentOffset.first()])
+                continue;
+            absoluteTransformations[parentOffset.first() + 1] =
+                absoluteTransformations[parentOffset.second() + 1]*
+                absoluteTransformations[parentOffset.first() + 1];
+        }
+
+        scene.mappingInto(fieldId, mapping);
+        for(std::size_t i = 0; i != mapping.size(); ++i) {
+            CORRADE_INTERNAL_ASSERT(mapping[i] < scene.mappingBound());
+            if((*objects)[mapping[i]])
+                outputTransformations[i] = absoluteTransformations[mapping[i] + 1];
+        }
+
+        return;
+    }
+
     /* Turn the transformations into absolute */
-    for(const Containers::Pair<UnsignedInt, Int>& parentOffset: orderedClusteredParents) {
-        absoluteTransformations[parentOffset.first() + 1] =
-            absoluteTransformations[parentOffset.second() + 1]*
-            absoluteTransformations[parentOffset.first() + 1];
+    if(!parallelFor) {
+        for(const Containers::Pair<UnsignedInt, Int>& parentOffset: orderedClusteredParents) {
+            absoluteTransformations[parentOffset.first() + 1] =
+                absoluteTransformations[parentOffset.second() + 1]*
+                absoluteTransformations[parentOffset.first() + 1];
+        }
+
+    /* In the parallel variant, split the objects into runs of the same depth.
+       Parents of all objects in a run are in some run before, so objects in
+       a single run can be processed independently of each other. */
+    } else {
+        AbsoluteTransformationsState<dimensions> state{{}, absoluteTransformations, {}, {}};
+        depths[0] = 0;
+        std::size_t levelBegin = 0;
+        for(std::size_t i = 0; i != orderedClusteredParents.size() + 1; ++i) {
+            if(i != orderedClusteredParents.size()) {
+                const Containers::Pair<UnsignedInt, Int>& parentOffset = orderedClusteredParents[i];
+                depths[parentOffset.first() + 1] = depths[parentOffset.second() + 1] + 1;
+                if(i == levelBegin || depths[parentOffset.first() + 1] == depths[orderedClusteredParents[levelBegin].first() + 1])
+                    continue;
+            }
+
+            /* Depth changed or we're at the end, process the whole level */
+            state.level = orderedClusteredParents.slice(levelBegin, i);
+            const std::size_t chunkCount = (state.level.size() + AbsoluteTransformationsChunkSize - 1)/AbsoluteTransformationsChunkSize;
+            /* Avoid the executor overhead for tiny levels */
+            if(chunkCount == 1)
+                absoluteTransformationsLevel<dimensions>(&state, 0);
+            else if(chunkCount)
+                parallelFor(parallelForState, chunkCount, absoluteTransformationsLevel<dimensions>, &state);
+            levelBegin = i;
+        }
     }
 
     /* Allocate the output array, retrieve mesh & material IDs and assign
        absolute transformations to each. The matrix location is abused for
        object mapping, which is subsequently replaced by the absolute object
        transformation for given mesh. */
-    const auto mapping = Containers::arrayCast<UnsignedInt>(outputTransformations);
-    scene.mappingInto(fieldId, mapping);
-    for(std::size_t i = 0; i != mapping.size(); ++i) {
-        CORRADE_INTERNAL_ASSERT(mapping[i] < scene.mappingBound());
-        outputTransformations[i] = absoluteTransformations[mapping[i] + 1];
+    const auto outputMapping = Containers::arrayCast<UnsignedInt>(outputTransformations);
+    scene.mappingInto(fieldId, outputMapping);
+    if(!parallelFor) {
+        for(std::size_t i = 0; i != outputMapping.size(); ++i) {
+            CORRADE_INTERNAL_ASSERT(outputMapping[i] < scene.mappingBound());
+            outputTransformations[i] = absoluteTransformations[outputMapping[i] + 1];
+        }
+    } else {
+        AbsoluteTransformationsState<dimensions> state{{}, absoluteTransformations, outputMapping, outputTransformations};
+        parallelFor(parallelForState, (outputMapping.size() + AbsoluteTransformationsChunkSize - 1)/AbsoluteTransformationsChunkSize, absoluteTransformationsOutput<dimensions>, &state);
     }
 }
 
-template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementation(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& outputTransformations, const MatrixTypeFor<dimensions, Float>& globalTransformation) {
+template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementation(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::BitArrayView* const objects, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& outputTransformations, const MatrixTypeFor<dimensions, Float>& globalTransformation, const ParallelFor parallelFor, void* const parallelForState) {
     const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(field);
     CORRADE_ASSERT(fieldId,
         "SceneTools::absoluteFieldTransformationsInto(): field" << field << "not found", );
 
-    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, *fieldId, outputTransformations, globalTransformation);
+    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, *fieldId, objects, outputTransformations, globalTransformation, parallelFor, parallelForState);
 }
 
-template<UnsignedInt dimensions> Containers::Array<MatrixTypeFor<dimensions, Float>> absoluteFieldTransformationsImplementation(const Trade::SceneData& scene, const UnsignedInt fieldId, const MatrixTypeFor<dimensions, Float>& globalTransformation) {
+template<UnsignedInt dimensions> Containers::Array<MatrixTypeFor<dimensions, Float>> absoluteFieldTransformationsImplementation(const Trade::SceneData& scene, const UnsignedInt fieldId, const MatrixTypeFor<dimensions, Float>& globalTransformation, const ParallelFor parallelFor, void* const parallelForState) {
     CORRADE_ASSERT(fieldId < scene.fieldCount(),
         "SceneTools::absoluteFieldTransformations(): index" << fieldId << "out of range for" << scene.fieldCount() << "fields", {});
 
     Containers::Array<MatrixTypeFor<dimensions, Float>> out{NoInit, scene.fieldSize(fieldId)};
-    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, fieldId, out, globalTransformation);
+    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, fieldId, nullptr, out, globalTransformation, parallelFor, parallelForState);
     return out;
 }
 
-template<UnsignedInt dimensions> Containers::Array<MatrixTypeFor<dimensions, Float>> absoluteFieldTransformationsImplementation(const Trade::SceneData& scene, const Trade::SceneField field, const MatrixTypeFor<dimensions, Float>& globalTransformation) {
+template<UnsignedInt dimensions> Containers::Array<MatrixTypeFor<dimensions, Float>> absoluteFieldTransformationsImplementation(const Trade::SceneData& scene, const Trade::SceneField field, const MatrixTypeFor<dimensions, Float>& globalTransformation, const ParallelFor parallelFor, void* const parallelForState) {
     const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(field);
     CORRADE_ASSERT(fieldId,
         "SceneTools::absoluteFieldTransformations(): field" << field << "not found", {});
 
     Containers::Array<MatrixTypeFor<dimensions, Float>> out{NoInit, scene.fieldSize(*fieldId)};
-    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, *fieldId, out, globalTransformation);
+    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, *fieldId, nullptr, out, globalTransformation, parallelFor, parallelForState);
     return out;
 }
 
 }
 
 Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const Trade::SceneField field, const Matrix3& globalTransformation) {
-    return absoluteFieldTransformationsImplementation<2>(scene, field, globalTransformation);
+    return absoluteFieldTransformationsImplementation<2>(scene, field, globalTransformation, nullptr, nullptr);
 }
 
 Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const Trade::SceneField field) {
-    return absoluteFieldTransformationsImplementation<2>(scene, field, {});
+    return absoluteFieldTransformationsImplementation<2>(scene, field, {}, nullptr, nullptr);
 }
 
 Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const UnsignedInt fieldId, const Matrix3& globalTransformation) {
-    return absoluteFieldTransformationsImplementation<2>(scene, fieldId, globalTransformation);
+    return absoluteFieldTransformationsImplementation<2>(scene, fieldId, globalTransformation, nullptr, nullptr);
 }
 
 Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const UnsignedInt fieldId) {
-    return absoluteFieldTransformationsImplementation<2>(scene, fieldId, {});
+    return absoluteFieldTransformationsImplementation<2>(scene, fieldId, {}, nullptr, nullptr);
 }
 
 void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation) {
-    return absoluteFieldTransformationsIntoImplementation<2>(scene, field, transformations, globalTransformation);
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, field, nullptr, transformations, globalTransformation, nullptr, nullptr);
 }
 
 void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations) {
-    return absoluteFieldTransformationsIntoImplementation<2>(scene, field, transformations, {});
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, field, nullptr, transformations, {}, nullptr, nullptr);
 }
 
 void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation) {
-    return absoluteFieldTransformationsIntoImplementation<2>(scene, fieldId, transformations, globalTransformation);
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, fieldId, nullptr, transformations, globalTransformation, nullptr, nullptr);
 }
 
 void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations) {
-    return absoluteFieldTransformationsIntoImplementation<2>(scene, fieldId, transformations, {});
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, fieldId, nullptr, transformations, {}, nullptr, nullptr);
 }
 
 Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const Trade::SceneField field, const Matrix4& globalTransformation) {
-    return absoluteFieldTransformationsImplementation<3>(scene, field, globalTransformation);
+    return absoluteFieldTransformationsImplementation<3>(scene, field, globalTransformation, nullptr, nullptr);
 }
 
 Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const Trade::SceneField field) {
-    return absoluteFieldTransformationsImplementation<3>(scene, field, {});
+    return absoluteFieldTransformationsImplementation<3>(scene, field, {}, nullptr, nullptr);
 }
 
 Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const UnsignedInt fieldId, const Matrix4& globalTransformation) {
-    return absoluteFieldTransformationsImplementation<3>(scene, fieldId, globalTransformation);
+    return absoluteFieldTransformationsImplementation<3>(scene, fieldId, globalTransformation, nullptr, nullptr);
 }
 
 Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const UnsignedInt fieldId) {
-    return absoluteFieldTransformationsImplementation<3>(scene, fieldId, {});
+    return absoluteFieldTransformationsImplementation<3>(scene, fieldId, {}, nullptr, nullptr);
 }
 
 void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation) {
-    return absoluteFieldTransformationsIntoImplementation<3>(scene, field, transformations, globalTransformation);
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, field, nullptr, transformations, globalTransformation, nullptr, nullptr);
 }
 
 void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations) {
-    return absoluteFieldTransformationsIntoImplementation<3>(scene, field, transformations, {});
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, field, nullptr, transformations, {}, nullptr, nullptr);
 }
 
 void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation) {
-    return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, transformations, globalTransformation);
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, nullptr, transformations, globalTransformation, nullptr, nullptr);
 }
 
 void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations) {
-    return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, transformations, {});
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, nullptr, transformations, {}, nullptr, nullptr);
+}
+
+Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const Trade::SceneField field, const Matrix3& globalTransformation, const ParallelFor parallelFor, void* const parallelForState) {
+    return absoluteFieldTransformationsImplementation<2>(scene, field, globalTransformation, parallelFor, parallelForState);
+}
+
+Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const UnsignedInt fieldId, const Matrix3& globalTransformation, const ParallelFor parallelFor, void* const parallelForState) {
+    return absoluteFieldTransformationsImplementation<2>(scene, fieldId, globalTransformation, parallelFor, parallelForState);
+}
+
+void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation, const ParallelFor parallelFor, void* const parallelForState) {
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, field, nullptr, transformations, globalTransformation, parallelFor, parallelForState);
+}
+
+void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation, const ParallelFor parallelFor, void* const parallelForState) {
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, fieldId, nullptr, transformations, globalTransformation, parallelFor, parallelForState);
+}
+
+Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const Trade::SceneField field, const Matrix4& globalTransformation, const ParallelFor parallelFor, void* const parallelForState) {
+    return absoluteFieldTransformationsImplementation<3>(scene, field, globalTransformation, parallelFor, parallelForState);
+}
+
+Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const UnsignedInt fieldId, const Matrix4& globalTransformation, const ParallelFor parallelFor, void* const parallelForState) {
+    return absoluteFieldTransformationsImplementation<3>(scene, fieldId, globalTransformation, parallelFor, parallelForState);
+}
+
+void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation, const ParallelFor parallelFor, void* const parallelForState) {
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, field, nullptr, transformations, globalTransformation, parallelFor, parallelForState);
+}
+
+void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation, const ParallelFor parallelFor, void* const parallelForState) {
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, nullptr, transformations, globalTransformation, parallelFor, parallelForState);
+}
+
+void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation) {
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, field, &objects, transformations, globalTransformation, nullptr, nullptr);
+}
+
+void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix3>& transformations) {
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, field, &objects, transformations, {}, nullptr, nullptr);
+}
+
+void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation) {
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, fieldId, &objects, transformations, globalTransformation, nullptr, nullptr);
+}
+
+void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix3>& transformations) {
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, fieldId, &objects, transformations, {}, nullptr, nullptr);
+}
+
+void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation) {
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, field, &objects, transformations, globalTransformation, nullptr, nullptr);
+}
+
+void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix4>& transformations) {
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, field, &objects, transformations, {}, nullptr, nullptr);
+}
+
+void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation) {
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, &objects, transformations, globalTransformation, nullptr, nullptr);
+}
+
+void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix4>& transformations) {
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, &objects, transformations, {}, nullptr, nullptr);
 }
 
 }}
@@ -32,6 +32,7 @@
  */
 
 #include "Magnum/Magnum.h"
+#include "Magnum/SceneTools/Parallel.h"
 #include "Magnum/SceneTools/visibility.h"
 #include "Magnum/Trade/Trade.h"
 
@@ -229,6 +230,116 @@ MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::Sc
 MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations);
 #endif
 
+/**
+@brief Calculate absolute 2D transformations for a subset of given field into an existing array
+@param[in]  scene           Input scene
+@param[in]  fieldId         Field to calculate the transformations for
+@param[in]  objects         Objects to calculate the transformations for
+@param[out] transformations Where to put the calculated transformations
+@param[in]  globalTransformation Global transformation to prepend
+@m_since_latest
+
+Like @ref absoluteFieldTransformations2DInto(const Trade::SceneData&, UnsignedInt, const Containers::StridedArrayView1D<Matrix3>&, const Matrix3&),
+but writes only entries of @p transformations that correspond to field entries
+attached to objects enabled in @p objects, leaving the remaining entries
+untouched. The @p objects view is expected to have the same size as
+@ref Trade::SceneData::mappingBound(). Absolute transformations are
+calculated only for the enabled objects and their ancestors, which makes this
+variant suitable for per-frame updates of a small part of a large scene.
+
+Together with @ref Trade::SceneData::meshesMaterialsInto() this can be used to
+flatten a mesh hierarchy into caller-provided memory.
+@experimental
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, UnsignedInt fieldId, Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation = {});
+#else
+/* To avoid including Matrix3 */
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, UnsignedInt fieldId, Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, UnsignedInt fieldId, Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix3>& transformations);
+#endif
+
+/**
+@brief Calculate absolute 2D transformations for a subset of given named field into an existing array
+@m_since_latest
+
+Translates @p field to a field ID using @ref Trade::SceneData::fieldId() and
+delegates to @ref absoluteFieldTransformations2DInto(const Trade::SceneData&, UnsignedInt, Containers::BitArrayView, const Containers::StridedArrayView1D<Matrix3>&, const Matrix3&).
+The @p field is expected to exist in @p scene.
+@experimental
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, Trade::SceneField field, Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation = {});
+#else
+/* To avoid including Matrix3 */
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, Trade::SceneField field, Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, Trade::SceneField field, Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix3>& transformations);
+#endif
+
+/**
+@brief Calculate absolute 2D transformations for given field in parallel
+@param[in]  scene           Input scene
+@param[in]  fieldId         Field to calculate the transformations for
+@param[in]  globalTransformation Global transformation to prepend
+@param[in]  parallelFor     Parallel loop executor
+@param[in]  parallelForState State pointer to pass to @p parallelFor
+@m_since_latest
+
+Same as @ref absoluteFieldTransformations2D(const Trade::SceneData&, UnsignedInt, const Matrix3&),
+but the objects returned by @ref parentsBreadthFirst() are split into
+levels of the same depth in the hierarchy and each level is then processed in
+parallel using @p parallelFor, as all parents of a level are already
+calculated in the levels before. The final assignment of the transformations
+to field entries is parallelized as well. The output is the same as with the
+serial variant regardless of the order of calls or count of threads used.
+Deep and narrow hierarchies gain little from this variant, wide hierarchies
+with many objects at the same depth benefit the most. If @p parallelFor is
+@cpp nullptr @ce, the calculation is done serially on the calling thread.
+@see @ref absoluteFieldTransformations2DInto(const Trade::SceneData&, UnsignedInt, const Containers::StridedArrayView1D<Matrix3>&, const Matrix3&, ParallelFor, void*)
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix3& globalTransformation, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+/**
+@brief Calculate absolute 2D transformations for given named field in parallel
+@m_since_latest
+
+Translates @p field to a field ID using @ref Trade::SceneData::fieldId() and
+delegates to @ref absoluteFieldTransformations2D(const Trade::SceneData&, UnsignedInt, const Matrix3&, ParallelFor, void*).
+The @p field is expected to exist in @p scene.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix3& globalTransformation, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+/**
+@brief Calculate absolute 2D transformations for given field into an existing array in parallel
+@param[in]  scene           Input scene
+@param[in]  fieldId         Field to calculate the transformations for
+@param[out] transformations Where to put the calculated transformations
+@param[in]  globalTransformation Global transformation to prepend
+@param[in]  parallelFor     Parallel loop executor
+@param[in]  parallelForState State pointer to pass to @p parallelFor
+@m_since_latest
+
+A variant of @ref absoluteFieldTransformations2D(const Trade::SceneData&, UnsignedInt, const Matrix3&, ParallelFor, void*)
+that fills existing memory instead of allocating a new array. The
+@p transformations array is expected to have the same size as the @p fieldId.
+@see @ref Trade::SceneData::fieldSize()
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+/**
+@brief Calculate absolute 2D transformations for given named field into an existing array in parallel
+@m_since_latest
+
+Translates @p field to a field ID using @ref Trade::SceneData::fieldId() and
+delegates to @ref absoluteFieldTransformations2DInto(const Trade::SceneData&, UnsignedInt, const Containers::StridedArrayView1D<Matrix3>&, const Matrix3&, ParallelFor, void*).
+The @p field is expected to exist in @p scene.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation, ParallelFor parallelFor, void* parallelForState = nullptr);
+
 /**
 @brief Calculate absolute 2D transformations for given field
 @m_since_latest
@@ -327,6 +438,116 @@ MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::Sc
 MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations);
 #endif
 
+/**
+@brief Calculate absolute 3D transformations for a subset of given field into an existing array
+@param[in]  scene           Input scene
+@param[in]  fieldId         Field to calculate the transformations for
+@param[in]  objects         Objects to calculate the transformations for
+@param[out] transformations Where to put the calculated transformations
+@param[in]  globalTransformation Global transformation to prepend
+@m_since_latest
+
+Like @ref absoluteFieldTransformations3DInto(const Trade::SceneData&, UnsignedInt, const Containers::StridedArrayView1D<Matrix4>&, const Matrix4&),
+but writes only entries of @p transformations that correspond to field entries
+attached to objects enabled in @p objects, leaving the remaining entries
+untouched. The @p objects view is expected to have the same size as
+@ref Trade::SceneData::mappingBound(). Absolute transformations are
+calculated only for the enabled objects and their ancestors, which makes this
+variant suitable for per-frame updates of a small part of a large scene.
+
+Together with @ref Trade::SceneData::meshesMaterialsInto() this can be used to
+flatten a mesh hierarchy into caller-provided memory.
+@experimental
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation = {});
+#else
+/* To avoid including Matrix4 */
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix4>& transformations);
+#endif
+
+/**
+@brief Calculate absolute 3D transformations for a subset of given named field into an existing array
+@m_since_latest
+
+Translates @p field to a field ID using @ref Trade::SceneData::fieldId() and
+delegates to @ref absoluteFieldTransformations3DInto(const Trade::SceneData&, UnsignedInt, Containers::BitArrayView, const Containers::StridedArrayView1D<Matrix4>&, const Matrix4&).
+The @p field is expected to exist in @p scene.
+@experimental
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation = {});
+#else
+/* To avoid including Matrix4 */
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, Containers::BitArrayView objects, const Containers::StridedArrayView1D<Matrix4>& transformations);
+#endif
+
+/**
+@brief Calculate absolute 3D transformations for given field in parallel
+@param[in]  scene           Input scene
+@param[in]  fieldId         Field to calculate the transformations for
+@param[in]  globalTransformation Global transformation to prepend
+@param[in]  parallelFor     Parallel loop executor
+@param[in]  parallelForState State pointer to pass to @p parallelFor
+@m_since_latest
+
+Same as @ref absoluteFieldTransformations3D(const Trade::SceneData&, UnsignedInt, const Matrix4&),
+but the objects returned by @ref parentsBreadthFirst() are split into
+levels of the same depth in the hierarchy and each level is then processed in
+parallel using @p parallelFor, as all parents of a level are already
+calculated in the levels before. The final assignment of the transformations
+to field entries is parallelized as well. The output is the same as with the
+serial variant regardless of the order of calls or count of threads used.
+Deep and narrow hierarchies gain little from this variant, wide hierarchies
+with many objects at the same depth benefit the most. If @p parallelFor is
+@cpp nullptr @ce, the calculation is done serially on the calling thread.
+@see @ref absoluteFieldTransformations3DInto(const Trade::SceneData&, UnsignedInt, const Containers::StridedArrayView1D<Matrix4>&, const Matrix4&, ParallelFor, void*)
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix4& globalTransformation, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+/**
+@brief Calculate absolute 3D transformations for given named field in parallel
+@m_since_latest
+
+Translates @p field to a field ID using @ref Trade::SceneData::fieldId() and
+delegates to @ref absoluteFieldTransformations3D(const Trade::SceneData&, UnsignedInt, const Matrix4&, ParallelFor, void*).
+The @p field is expected to exist in @p scene.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix4& globalTransformation, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+/**
+@brief Calculate absolute 3D transformations for given field into an existing array in parallel
+@param[in]  scene           Input scene
+@param[in]  fieldId         Field to calculate the transformations for
+@param[out] transformations Where to put the calculated transformations
+@param[in]  globalTransformation Global transformation to prepend
+@param[in]  parallelFor     Parallel loop executor
+@param[in]  parallelForState State pointer to pass to @p parallelFor
+@m_since_latest
+
+A variant of @ref absoluteFieldTransformations3D(const Trade::SceneData&, UnsignedInt, const Matrix4&, ParallelFor, void*)
+that fills existing memory instead of allocating a new array. The
+@p transformations array is expected to have the same size as the @p fieldId.
+@see @ref Trade::SceneData::fieldSize()
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+/**
+@brief Calculate absolute 3D transformations for given named field into an existing array in parallel
+@m_since_latest
+
+Translates @p field to a field ID using @ref Trade::SceneData::fieldId() and
+delegates to @ref absoluteFieldTransformations3DInto(const Trade::SceneData&, UnsignedInt, const Containers::StridedArrayView1D<Matrix4>&, const Matrix4&, ParallelFor, void*).
+The @p field is expected to exist in @p scene.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation, ParallelFor parallelFor, void* parallelForState = nullptr);
+
 }}
 
 #endif
@@ -0,0 +1,141 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "allocationProfiler.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <Corrade/Utility/Macros.h> /* CORRADE_THREAD_LOCAL */
+
+#if defined(CORRADE_TARGET_APPLE)
+#include <malloc/malloc.h>
+#elif defined(CORRADE_TARGET_WINDOWS) || defined(__GLIBC__) || defined(CORRADE_TARGET_ANDROID) || defined(CORRADE_TARGET_EMSCRIPTEN)
+#include <malloc.h>
+#endif
+
+namespace Magnum { namespace SceneTools { namespace Implementation {
+
+namespace {
+
+bool enabled = false;
+
+#ifdef CORRADE_BUILD_MULTITHREADED
+CORRADE_THREAD_LOCAL
+#endif
+AllocationCounters threadCounters{};
+
+std::atomic<std::size_t> processCount{0};
+std::atomic<std::size_t> processBytes{0};
+std::atomic<Long> processCurrent{0};
+std::atomic<Long> processPeak{0};
+
+/* Actual size of an allocation, which is used to track the amount of memory
+   currently allocated. The size passed to operator delete isn't usable for
+   that, as the sized variant isn't guaranteed to be called, so it's queried
+   from the allocator instead. On platforms where that isn't possible the
+   current and peak amounts stay at zero. */
+std::size_t allocationSize(void* const pointer) {
+    #if defined(CORRADE_TARGET_APPLE)
+    return malloc_size(pointer);
+    #elif defined(CORRADE_TARGET_WINDOWS)
+    return _msize(pointer);
+    #elif defined(__GLIBC__) || defined(CORRADE_TARGET_ANDROID) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    return malloc_usable_size(pointer);
+    #else
+    static_cast<void>(pointer);
+    return 0;
+    #endif
+}
+
+void* allocate(const std::size_t size) {
+    void* const out = std::malloc(size ? size : 1);
+    if(!out) throw std::bad_alloc{};
+    if(!enabled) return out;
+
+    const Long actualSize = Long(allocationSize(out));
+    ++threadCounters.count;
+    threadCounters.bytes += size;
+    threadCounters.current += actualSize;
+    threadCounters.peak = Math::max(threadCounters.peak, threadCounters.current);
+
+    processCount.fetch_add(1, std::memory_order_relaxed);
+    processBytes.fetch_add(size, std::memory_order_relaxed);
+    const Long current = processCurrent.fetch_add(actualSize, std::memory_order_relaxed) + actualSize;
+    Long peak = processPeak.load(std::memory_order_relaxed);
+    while(current > peak && !processPeak.compare_exchange_weak(peak, current, std::memory_order_relaxed));
+
+    return out;
+}
+
+void deallocate(void* const pointer) {
+    if(!pointer) return;
+    if(enabled) {
+        const Long actualSize = Long(allocationSize(pointer));
+        threadCounters.current -= actualSize;
+        processCurrent.fetch_sub(actualSize, std::memory_order_relaxed);
+    }
+    std::free(pointer);
+}
+
+}
+
+void enableAllocationCounting() {
+    enabled = true;
+}
+
+AllocationCounters& threadAllocationCounters() {
+    return threadCounters;
+}
+
+AllocationCounters processAllocationCounters() {
+    return {processCount.load(std::memory_order_relaxed),
+            processBytes.load(std::memory_order_relaxed),
+            processCurrent.load(std::memory_order_relaxed),
+            processPeak.load(std::memory_order_relaxed)};
+}
+
+}}}
+
+/* The nothrow and sized variants are left as they are, the standard library
+   implements them either on top of these or with plain malloc() and free(),
+   which is compatible. The aligned variants are left as well, as they're
+   paired with their own deallocation functions. */
+void* operator new(std::size_t size) {
+    return Magnum::SceneTools::Implementation::allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return Magnum::SceneTools::Implementation::allocate(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    Magnum::SceneTools::Implementation::deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    Magnum::SceneTools::Implementation::deallocate(pointer);
+}
@@ -0,0 +1,133 @@
+#ifndef Magnum_SceneTools_Implementation_allocationProfiler_h
+#define Magnum_SceneTools_Implementation_allocationProfiler_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <mutex>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StringView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
+
+/* Counting of allocations done through the global operator new, which is
+   replaced in allocationProfiler.cpp. Used by magnum-sceneconverter --profile
+   and compiled directly into it, as the replacement has to be in the
+   executable. Allocations done directly with malloc() aren't counted, and on
+   Windows neither are allocations done inside DLLs. */
+
+namespace Magnum { namespace SceneTools { namespace Implementation {
+
+struct AllocationCounters {
+    std::size_t count;
+    std::size_t bytes;
+    /* Bytes allocated minus bytes freed. Can go negative if a thread frees
+       memory that was allocated by another thread or before the counting was
+       enabled. */
+    Long current;
+    /* Maximum of current since the last reset */
+    Long peak;
+};
+
+/* Until called, the replaced operator new only forwards to malloc(). Expected
+   to be called before any threads are spawned. */
+void enableAllocationCounting();
+
+/* Counters of the calling thread */
+AllocationCounters& threadAllocationCounters();
+
+/* Counters of the whole process since enableAllocationCounting() */
+AllocationCounters processAllocationCounters();
+
+struct AllocationStatistics {
+    /* Only a view, usually on a string literal */
+    Containers::StringView name;
+    std::size_t calls;
+    std::size_t count;
+    std::size_t bytes;
+    Long peak;
+};
+
+/* Allocation statistics of named calls. Multiple calls of the same name get
+   merged, with the count and bytes summed and the peak being the maximum of
+   all. Can be added to from multiple threads. */
+class AllocationProfile {
+    public:
+        void add(Containers::StringView name, std::size_t count, std::size_t bytes, Long peak) {
+            std::lock_guard<std::mutex> lock{_mutex};
+            for(AllocationStatistics& i: _statistics) if(i.name == name) {
+                ++i.calls;
+                i.count += count;
+                i.bytes += bytes;
+                i.peak = Math::max(i.peak, peak);
+                return;
+            }
+            arrayAppend(_statistics, InPlaceInit, name, std::size_t{1}, count, bytes, peak);
+        }
+
+        Containers::ArrayView<const AllocationStatistics> statistics() const {
+            return _statistics;
+        }
+
+    private:
+        std::mutex _mutex;
+        Containers::Array<AllocationStatistics> _statistics;
+};
+
+/* Counts allocations done by the calling thread until its destruction and
+   adds them to the profile under given name. The peak is the maximum of bytes
+   allocated at once relative to the start of the scope, so a call that
+   creates a temporary copy of its input shows a peak higher than the size of
+   its output. If the profile is null, does nothing. */
+class AllocationScope {
+    public:
+        explicit AllocationScope(AllocationProfile* const profile, const Containers::StringView name): _profile{profile}, _name{name} {
+            if(!_profile) return;
+            AllocationCounters& counters = threadAllocationCounters();
+            _start = counters;
+            counters.peak = counters.current;
+        }
+
+        ~AllocationScope() {
+            if(!_profile) return;
+            AllocationCounters& counters = threadAllocationCounters();
+            const std::size_t count = counters.count - _start.count;
+            const std::size_t bytes = counters.bytes - _start.bytes;
+            const Long peak = counters.peak - _start.current;
+            /* Restore the peak for an outer scope, if any */
+            counters.peak = Math::max(counters.peak, _start.peak);
+            _profile->add(_name, count, bytes, peak);
+        }
+
+    private:
+        AllocationProfile* _profile;
+        Containers::StringView _name;
+        AllocationCounters _start;
+};
+
+}}}
+
+#endif
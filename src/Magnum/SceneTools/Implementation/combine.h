@@ -27,7 +27,6 @@
 */
 
 #include <map>
-#include <Corrade/Containers/ArrayTuple.h>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedBitArrayView.h>
@@ -112,14 +111,45 @@ template<class T> std::size_t stringRangeNullTerminatedFieldSize(const char* str
     return max + 1;
 }
 
-inline Trade::SceneData combineFields(const Trade::SceneMappingType mappingType, const UnsignedLong mappingBound, const Containers::ArrayView<const Trade::SceneFieldData> fields) {
+/* Description of a single allocation in the combined data. Each item
+   corresponds to exactly one CombineItemView, the data layout gets calculated
+   only once all items are known so the data can be placed either into a newly
+   allocated array or into a caller-provided memory. */
+struct CombineItem {
+    enum class Type: UnsignedByte {
+        Types, Bits, Strings
+    } type;
+    /* Item count, or byte count for strings */
+    std::size_t size;
+    /* Byte size of an item for types, bit count of an item for bits, unused
+       for strings */
+    std::size_t itemSize;
+    std::size_t alignment;
+};
+
+struct CombineLayout {
+    Containers::Array<CombineItem> items;
+    /* For each field index of a mapping, data and string data item */
+    Containers::Array<Containers::Triple<UnsignedInt, UnsignedInt, UnsignedInt>> itemMappings;
+};
+
+/* Alignment the data passed to combineFieldsPlace() is expected to have, in
+   order to have the calculated size match. It's the largest alignment of all
+   mapping and field types. */
+constexpr std::size_t CombineDataAlignment = 8;
+
+inline bool combineFieldsLayout(const char* const messagePrefix, const Trade::SceneMappingType mappingType, const Containers::ArrayView<const Trade::SceneFieldData> fields, CombineLayout& layout) {
+    #if defined(CORRADE_NO_ASSERT) || defined(CORRADE_STANDARD_ASSERT)
+    static_cast<void>(messagePrefix);
+    #endif
+
     #ifndef CORRADE_NO_ASSERT
     /* Offset-only fields are not allowed as there's no data to refer them to.
        This has to be checked before shared scene field mapping, otherwise it'd
        assert there first, leading to confusion. */
     for(std::size_t i = 0; i != fields.size(); ++i) {
         CORRADE_ASSERT(!(fields[i].flags() & Trade::SceneFieldFlag::OffsetOnly),
-            "SceneTools::combineFields(): field" << i << "is offset-only", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+            messagePrefix << "field" << i << "is offset-only", false);
     }
     #endif
 
@@ -130,24 +160,18 @@ inline Trade::SceneData combineFields(const Trade::SceneMappingType mappingType,
        begin, size and stride. As offset-only fields are disallowed, the data
        pointer can be whatever, just needs to be large enough. */
     #ifndef CORRADE_NO_ASSERT
-    if(!checkSharedSceneFieldMapping("SceneTools::combineFields():", sharedSceneFieldIds, {nullptr, ~std::size_t{}}, fields))
-        return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}};
+    if(!checkSharedSceneFieldMapping(messagePrefix, sharedSceneFieldIds, {nullptr, ~std::size_t{}}, fields))
+        return false;
     #endif
 
-    Containers::Array<Containers::ArrayTuple::Item> items;
-    Containers::Array<Containers::Triple<UnsignedInt, UnsignedInt, UnsignedInt>> itemViewMappings{NoInit, fields.size()};
-
-    /* The item views are referenced from ArrayTuple::Item. It's either of the
-       three views in the union --- from the group of (up to) 3 views per
-       field, first is for the mapping (unless shared with another view) and is
-       always `types`, second for the data (either `types` or `bits`) and third
-       for the string data (`strings`, if the field is a string). In most cases
-       they array won't be fully used but we need to avoid accidental
-       reallocation so the array is made with an upper bound on size. */
-    /** @todo once never-reallocating allocators are present, use them instead
-        of the manual offset */
-    Containers::Array<CombineItemView> itemViews{fields.size()*3};
-    std::size_t itemViewOffset = 0;
+    /* Each item is either of the three views in the CombineItemView union ---
+       from the group of (up to) 3 items per field, first is for the mapping
+       (unless shared with another view) and is always `types`, second for the
+       data (either `types` or `bits`) and third for the string data
+       (`strings`, if the field is a string). */
+    Containers::Array<CombineItem>& items = layout.items;
+    Containers::Array<Containers::Triple<UnsignedInt, UnsignedInt, UnsignedInt>>& itemViewMappings = layout.itemMappings;
+    itemViewMappings = Containers::Array<Containers::Triple<UnsignedInt, UnsignedInt, UnsignedInt>>{NoInit, fields.size()};
 
     const std::size_t mappingTypeSize = sceneMappingTypeSize(mappingType);
     const std::size_t mappingTypeAlignment = sceneMappingTypeAlignment(mappingType);
@@ -157,25 +181,19 @@ inline Trade::SceneData combineFields(const Trade::SceneMappingType mappingType,
        for it -- it'll get picked up below */
     Containers::Optional<UnsignedInt> sharedTrsMapping;
     if(sharedSceneFieldIds.trs[0] != ~UnsignedInt{} && !fields[sharedSceneFieldIds.trs[0]].mappingData().data()) {
-        sharedTrsMapping = itemViewOffset;
-        arrayAppend(items, InPlaceInit,
-            NoInit,
+        sharedTrsMapping = items.size();
+        arrayAppend(items, CombineItem{CombineItem::Type::Types,
             fields[sharedSceneFieldIds.trs[0]].size(),
             mappingTypeSize,
-            mappingTypeAlignment,
-            itemViews[itemViewOffset].types);
-        ++itemViewOffset;
+            mappingTypeAlignment});
     }
     Containers::Optional<UnsignedInt> sharedMeshMaterialMapping;
     if(sharedSceneFieldIds.meshMaterial[0] != ~UnsignedInt{} && !fields[sharedSceneFieldIds.meshMaterial[0]].mappingData().data()) {
-        sharedMeshMaterialMapping = itemViewOffset;
-        arrayAppend(items, InPlaceInit,
-            NoInit,
+        sharedMeshMaterialMapping = items.size();
+        arrayAppend(items, CombineItem{CombineItem::Type::Types,
             fields[sharedSceneFieldIds.meshMaterial[0]].size(),
             mappingTypeSize,
-            mappingTypeAlignment,
-            itemViews[itemViewOffset].types);
-        ++itemViewOffset;
+            mappingTypeAlignment});
     }
 
     /* Track unique mapping views (pointer, size, stride) so fields that shared
@@ -185,7 +203,7 @@ inline Trade::SceneData combineFields(const Trade::SceneMappingType mappingType,
        NOT HAVE IT, UGH. */
     std::map<std::tuple<const void*, std::size_t, std::ptrdiff_t>, UnsignedInt> uniqueMappings;
 
-    /* Go through all fields and collect ArrayTuple allocations for these */
+    /* Go through all fields and collect allocations for these */
     for(std::size_t i = 0; i != fields.size(); ++i) {
         const Trade::SceneFieldData& field = fields[i];
 
@@ -193,7 +211,7 @@ inline Trade::SceneData combineFields(const Trade::SceneMappingType mappingType,
            shared with an existing view already, and insert it if not. */
         std::pair<std::map<std::tuple<const void*, std::size_t, std::ptrdiff_t>, UnsignedInt>::iterator, bool> inserted;
         if(field.mappingData().data())
-            inserted = uniqueMappings.emplace(std::make_tuple(field.mappingData().data(), field.mappingData().size(), field.mappingData().stride()), itemViewOffset);
+            inserted = uniqueMappings.emplace(std::make_tuple(field.mappingData().data(), field.mappingData().size(), field.mappingData().stride()), items.size());
 
         /* If it's shared (inserting failed), remember the field ID it's shared
            with. We don't need the original size or stride for anything after
@@ -216,37 +234,31 @@ inline Trade::SceneData combineFields(const Trade::SceneMappingType mappingType,
 
         /* If it's not shared or it's a placeholder, allocate a new mapping
            view of given size by adding a new item to the list of views to
-           allocate by an ArrayTuple. */
+           allocate. */
         } else {
-            itemViewMappings[i].first() = itemViewOffset;
-            arrayAppend(items, InPlaceInit,
-                NoInit,
+            itemViewMappings[i].first() = items.size();
+            arrayAppend(items, CombineItem{CombineItem::Type::Types,
                 field.size(),
                 mappingTypeSize,
-                mappingTypeAlignment,
-                itemViews[itemViewOffset].types);
-            ++itemViewOffset;
+                mappingTypeAlignment});
         }
 
         /* Field data, just allocate space for it. No extra logic needed -- no
            aliasing here right now, no sharing between mapping and field data
            either. */
         /** @todo field aliasing might be useful at some point */
-        itemViewMappings[i].second() = itemViewOffset;
+        itemViewMappings[i].second() = items.size();
         const Trade::SceneFieldType fieldType = field.fieldType();
         if(fieldType == Trade::SceneFieldType::Bit) {
-            arrayAppend(items, InPlaceInit,
-                NoInit,
-                Containers::Size2D{field.size(), field.fieldArraySize() ? field.fieldArraySize() : 1},
-                itemViews[itemViewOffset].bits);
-            ++itemViewOffset;
+            arrayAppend(items, CombineItem{CombineItem::Type::Bits,
+                field.size(),
+                field.fieldArraySize() ? field.fieldArraySize() : 1,
+                1});
         } else {
-            arrayAppend(items, InPlaceInit,
-                NoInit,
-                field.size(), sceneFieldTypeSize(fieldType)*(field.fieldArraySize() ? field.fieldArraySize() : 1),
-                sceneFieldTypeAlignment(fieldType),
-                itemViews[itemViewOffset].types);
-            ++itemViewOffset;
+            arrayAppend(items, CombineItem{CombineItem::Type::Types,
+                field.size(),
+                sceneFieldTypeSize(fieldType)*(field.fieldArraySize() ? field.fieldArraySize() : 1),
+                sceneFieldTypeAlignment(fieldType)});
 
             /* For string fields we need to allocate also for the actual string
                data. For space reasons the SceneFieldData stores only the data
@@ -255,11 +267,11 @@ inline Trade::SceneData combineFields(const Trade::SceneMappingType mappingType,
             if(Trade::Implementation::isSceneFieldTypeString(fieldType)) {
                 const Containers::StridedArrayView1D<const void> fieldData = field.fieldData();
                 CORRADE_ASSERT(!field.size() || fieldData.data(),
-                    "SceneTools::combineFields(): string field" << i << "has a placeholder data", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+                    messagePrefix << "string field" << i << "has a placeholder data", false);
 
                 const char* const stringData = field.stringData();
                 CORRADE_ASSERT(!field.size() || stringData,
-                    "SceneTools::combineFields(): string field" << i << "has a placeholder string data", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+                    messagePrefix << "string field" << i << "has a placeholder string data", false);
 
                 std::size_t size;
                 if(field.size() == 0)
@@ -290,22 +302,51 @@ inline Trade::SceneData combineFields(const Trade::SceneMappingType mappingType,
                     size = stringRangeNullTerminatedFieldSize<UnsignedLong>(stringData, fieldData);
                 else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 
-                itemViewMappings[i].third() = itemViewOffset;
-                arrayAppend(items, InPlaceInit,
-                    NoInit,
-                    size,
-                    itemViews[itemViewOffset].strings);
-                ++itemViewOffset;
+                itemViewMappings[i].third() = items.size();
+                arrayAppend(items, CombineItem{CombineItem::Type::Strings,
+                    size, 1, 1});
             }
         }
     }
 
-    CORRADE_INTERNAL_ASSERT(itemViewOffset <= itemViews.size());
+    return true;
+}
+
+/* Calculates the total data size for given items. If itemViews are
+   non-empty, data is expected to be aligned to CombineDataAlignment and large
+   enough, and views into it are written to itemViews. Passing an empty
+   itemViews only calculates the size. */
+inline std::size_t combineFieldsPlace(const Containers::ArrayView<const CombineItem> items, char* const data, const Containers::ArrayView<CombineItemView> itemViews) {
+    std::size_t offset = 0;
+    for(std::size_t i = 0; i != items.size(); ++i) {
+        const CombineItem& item = items[i];
+        offset = (offset + item.alignment - 1)/item.alignment*item.alignment;
+
+        std::size_t size;
+        if(item.type == CombineItem::Type::Types)
+            size = item.size*item.itemSize;
+        else if(item.type == CombineItem::Type::Bits)
+            size = (item.size*item.itemSize + 7)/8;
+        else if(item.type == CombineItem::Type::Strings)
+            size = item.size;
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+        if(!itemViews.isEmpty()) {
+            if(item.type == CombineItem::Type::Types)
+                itemViews[i].types = Containers::StridedArrayView2D<char>{{data + offset, size}, {item.size, item.itemSize}};
+            else if(item.type == CombineItem::Type::Bits)
+                itemViews[i].bits = Containers::MutableStridedBitArrayView2D{Containers::MutableBitArrayView{data + offset, 0, item.size*item.itemSize}, {item.size, item.itemSize}, {std::ptrdiff_t(item.itemSize), 1}};
+            else
+                itemViews[i].strings = Containers::MutableStringView{data + offset, size};
+        }
 
-    /* Allocate the data */
-    Containers::Array<char> outData = Containers::ArrayTuple{items};
-    CORRADE_INTERNAL_ASSERT(!outData.deleter());
+        offset += size;
+    }
+
+    return offset;
+}
 
+inline Containers::Array<Trade::SceneFieldData> combineFieldsCopy(const Trade::SceneMappingType mappingType, const Containers::ArrayView<const Trade::SceneFieldData> fields, const Containers::ArrayView<const CombineItemView> itemViews, const Containers::ArrayView<const Containers::Triple<UnsignedInt, UnsignedInt, UnsignedInt>> itemViewMappings) {
     /* Copy the mapping data over and cast them as necessary */
     if(mappingType == Trade::SceneMappingType::UnsignedByte)
         combineCopyMappings<UnsignedByte>(fields, itemViews, itemViewMappings);
@@ -389,6 +430,21 @@ inline Trade::SceneData combineFields(const Trade::SceneMappingType mappingType,
         }
     }
 
+    return outFields;
+}
+
+inline Trade::SceneData combineFields(const Trade::SceneMappingType mappingType, const UnsignedLong mappingBound, const Containers::ArrayView<const Trade::SceneFieldData> fields) {
+    CombineLayout layout;
+    if(!combineFieldsLayout("SceneTools::combineFields():", mappingType, fields, layout))
+        return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}};
+
+    /* Allocate the data. The default new[] alignment is enough for all
+       mapping and field types. */
+    Containers::Array<CombineItemView> itemViews{layout.items.size()};
+    Containers::Array<char> outData{NoInit, combineFieldsPlace(layout.items, nullptr, nullptr)};
+    combineFieldsPlace(layout.items, outData.data(), itemViews);
+
+    Containers::Array<Trade::SceneFieldData> outFields = combineFieldsCopy(mappingType, fields, itemViews, layout.itemMappings);
     return Trade::SceneData{mappingType, mappingBound, Utility::move(outData), Utility::move(outFields)};
 }
 
@@ -0,0 +1,118 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Instances.h"
+
+#include <algorithm>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/Triple.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<UnsignedInt>> meshInstanceGroups(const Trade::SceneData& scene) {
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Mesh),
+        "SceneTools::meshInstanceGroups(): the scene has no meshes", {});
+
+    const Containers::Array<Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>> meshesMaterials = scene.meshesMaterialsAsArray();
+
+    /* Sort the entries by mesh and material, keeping the original order for
+       entries that have both the same */
+    Containers::Array<UnsignedInt> entries{NoInit, meshesMaterials.size()};
+    for(std::size_t i = 0; i != entries.size(); ++i)
+        entries[i] = i;
+    std::stable_sort(entries.begin(), entries.end(), [&](UnsignedInt a, UnsignedInt b) {
+        const Containers::Pair<UnsignedInt, Int>& meshMaterialA = meshesMaterials[a].second();
+        const Containers::Pair<UnsignedInt, Int>& meshMaterialB = meshesMaterials[b].second();
+        return meshMaterialA.first() < meshMaterialB.first() ||
+              (meshMaterialA.first() == meshMaterialB.first() &&
+               meshMaterialA.second() < meshMaterialB.second());
+    });
+
+    /* Count consecutive runs of the same mesh and material */
+    Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>> groups;
+    for(const UnsignedInt entry: entries) {
+        const Containers::Pair<UnsignedInt, Int>& meshMaterial = meshesMaterials[entry].second();
+        if(groups.isEmpty() ||
+           groups.back().first() != meshMaterial.first() ||
+           groups.back().second() != meshMaterial.second())
+            arrayAppend(groups, InPlaceInit, meshMaterial.first(), meshMaterial.second(), 0u);
+        ++groups.back().third();
+    }
+
+    /* Convert back to a default deleter to make this usable in plugins */
+    arrayShrink(groups, DefaultInit);
+
+    return {Utility::move(groups), Utility::move(entries)};
+}
+
+namespace {
+
+template<class T> Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<T>> meshInstanceTransformationsImplementation(const Trade::SceneData& scene, const Containers::Array<T>& transformations) {
+    Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<UnsignedInt>> groups = meshInstanceGroups(scene);
+
+    Containers::Array<T> out{NoInit, groups.second().size()};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = transformations[groups.second()[i]];
+
+    return {Utility::move(groups.first()), Utility::move(out)};
+}
+
+}
+
+Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<Matrix3>> meshInstanceTransformations2D(const Trade::SceneData& scene, const Matrix3& globalTransformation) {
+    /* Checking here to not have the assertion message mention
+       absoluteFieldTransformations2D() */
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Mesh),
+        "SceneTools::meshInstanceTransformations2D(): the scene has no meshes", {});
+
+    return meshInstanceTransformationsImplementation(scene, absoluteFieldTransformations2D(scene, Trade::SceneField::Mesh, globalTransformation));
+}
+
+Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<Matrix3>> meshInstanceTransformations2D(const Trade::SceneData& scene) {
+    return meshInstanceTransformations2D(scene, {});
+}
+
+Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<Matrix4>> meshInstanceTransformations3D(const Trade::SceneData& scene, const Matrix4& globalTransformation) {
+    /* Checking here to not have the assertion message mention
+       absoluteFieldTransformations3D() */
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Mesh),
+        "SceneTools::meshInstanceTransformations3D(): the scene has no meshes", {});
+
+    return meshInstanceTransformationsImplementation(scene, absoluteFieldTransformations3D(scene, Trade::SceneField::Mesh, globalTransformation));
+}
+
+Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<Matrix4>> meshInstanceTransformations3D(const Trade::SceneData& scene) {
+    return meshInstanceTransformations3D(scene, {});
+}
+
+}}
@@ -0,0 +1,126 @@
+#ifndef Magnum_SceneTools_Instances_h
+#define Magnum_SceneTools_Instances_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::SceneTools::meshInstanceGroups(), @ref Magnum::SceneTools::meshInstanceTransformations2D(), @ref Magnum::SceneTools::meshInstanceTransformations3D()
+ * @m_since_latest
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Group mesh instances by mesh and material
+@m_since_latest
+
+Returns a list of unique (mesh, material, instance count) triplets referenced
+by the @ref Trade::SceneField::Mesh and @relativeref{Trade::SceneField,MeshMaterial}
+fields, sorted by mesh ID and then by material ID, and a list of
+@ref Trade::SceneField::Mesh entry indices grouped in the same order --- i.e.,
+the first group is formed by the first @cpp instanceCount @ce entry indices,
+second group by the next @cpp instanceCount @ce entry indices etc. Relative
+order of entries in each group is preserved. If the
+@relativeref{Trade::SceneField,MeshMaterial} field isn't present, the material
+ID is @cpp -1 @ce for all groups.
+
+Drawing each group with a single instanced draw reduces the draw count from
+@ref Trade::SceneData::fieldSize() of @ref Trade::SceneField::Mesh to the
+count of groups. See @ref meshInstanceTransformations3D() for a variant
+that directly returns transformations for each instance, suitable for example
+for @ref Shaders::PhongGL::Flag::InstancedTransformation.
+
+Expects that the scene has a @ref Trade::SceneField::Mesh field. The operation
+is done in an @f$ \mathcal{O}(n \log n) @f$ execution time and
+@f$ \mathcal{O}(n) @f$ memory complexity, with @f$ n @f$ being the mesh field
+size.
+@experimental
+
+@see @ref Trade::SceneData::meshesMaterialsAsArray()
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<UnsignedInt>> meshInstanceGroups(const Trade::SceneData& scene);
+
+/**
+@brief Group 2D mesh instances by mesh and material and calculate their transformations
+@m_since_latest
+
+Returns the same groups as @ref meshInstanceGroups() together with absolute
+transformations of all instances in the group order, calculated using
+@ref absoluteFieldTransformations2D() with @p globalTransformation prepended.
+Transformations of the first group are the first @cpp instanceCount @ce items,
+transformations of the second group the next @cpp instanceCount @ce items
+etc., making each range directly usable as a per-instance buffer for an
+instanced draw, such as with @ref Shaders::FlatGL::Flag::InstancedTransformation.
+
+Expects that the scene is 2D, has a @ref Trade::SceneField::Mesh field and
+satisfies the conditions of @ref absoluteFieldTransformations2D().
+@experimental
+
+@see @ref Trade::SceneData::is2D()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+MAGNUM_SCENETOOLS_EXPORT Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<Matrix3>> meshInstanceTransformations2D(const Trade::SceneData& scene, const Matrix3& globalTransformation = {});
+#else
+/* To avoid including Matrix3 */
+MAGNUM_SCENETOOLS_EXPORT Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<Matrix3>> meshInstanceTransformations2D(const Trade::SceneData& scene, const Matrix3& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<Matrix3>> meshInstanceTransformations2D(const Trade::SceneData& scene);
+#endif
+
+/**
+@brief Group 3D mesh instances by mesh and material and calculate their transformations
+@m_since_latest
+
+Returns the same groups as @ref meshInstanceGroups() together with absolute
+transformations of all instances in the group order, calculated using
+@ref absoluteFieldTransformations3D() with @p globalTransformation prepended.
+Transformations of the first group are the first @cpp instanceCount @ce items,
+transformations of the second group the next @cpp instanceCount @ce items
+etc., making each range directly usable as a per-instance buffer for an
+instanced draw, such as with @ref Shaders::PhongGL::Flag::InstancedTransformation:
+
+@snippet SceneTools.cpp meshInstanceTransformations3D
+
+Expects that the scene is 3D, has a @ref Trade::SceneField::Mesh field and
+satisfies the conditions of @ref absoluteFieldTransformations3D().
+@experimental
+
+@see @ref Trade::SceneData::is3D()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+MAGNUM_SCENETOOLS_EXPORT Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<Matrix4>> meshInstanceTransformations3D(const Trade::SceneData& scene, const Matrix4& globalTransformation = {});
+#else
+/* To avoid including Matrix4 */
+MAGNUM_SCENETOOLS_EXPORT Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<Matrix4>> meshInstanceTransformations3D(const Trade::SceneData& scene, const Matrix4& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<Matrix4>> meshInstanceTransformations3D(const Trade::SceneData& scene);
+#endif
+
+}}
+
+#endif
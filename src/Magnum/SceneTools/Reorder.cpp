@@ -0,0 +1,177 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Reorder.h"
+
+#include <map>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/SceneTools/Combine.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/SceneTools/Map.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+Containers::Array<UnsignedInt> breadthFirstObjectMapping(const Trade::SceneData& scene) {
+    /* Checking here as well to not have the assertion message mention
+       parentsBreadthFirst() */
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Parent),
+        "SceneTools::breadthFirstObjectMapping(): the scene has no hierarchy", {});
+
+    const Containers::Array<Containers::Pair<UnsignedInt, Int>> parents = parentsBreadthFirst(scene);
+
+    /* Objects in the hierarchy get numbered in the breadth-first order, the
+       rest is appended after in the original order */
+    Containers::Array<UnsignedInt> out{NoInit, std::size_t(scene.mappingBound())};
+    Containers::BitArray numbered{ValueInit, out.size()};
+    UnsignedInt next = 0;
+    for(const Containers::Pair<UnsignedInt, Int>& i: parents) {
+        out[i.first()] = next++;
+        numbered.set(i.first());
+    }
+    for(std::size_t i = 0; i != out.size(); ++i)
+        if(!numbered[i]) out[i] = next++;
+
+    CORRADE_INTERNAL_ASSERT(next == out.size());
+    return out;
+}
+
+Trade::SceneData reorderObjects(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const UnsignedInt>& mapping) {
+    CORRADE_ASSERT(mapping.size() == scene.mappingBound(),
+        "SceneTools::reorderObjects(): expected" << scene.mappingBound() << "mapping items but got" << mapping.size(),
+        (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+    #ifndef CORRADE_NO_ASSERT
+    {
+        Containers::BitArray used{ValueInit, mapping.size()};
+        for(std::size_t i = 0; i != mapping.size(); ++i) {
+            CORRADE_ASSERT(mapping[i] < mapping.size() && !used[mapping[i]],
+                "SceneTools::reorderObjects(): mapping" << mapping[i] << "for object" << i << "is out of range or not unique",
+                (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+            used.set(mapping[i]);
+        }
+    }
+    #endif
+
+    /* Fields that shared a mapping before should stay shared after as well,
+       so calculate the new order just once for each unique mapping view
+       (pointer, size, stride) and pass the same reordered mapping array to
+       combineFields() for all of them, which will then preserve the sharing.
+       The std::map is used for the same reason as in filterFieldEntries(). */
+    struct Reordered {
+        /* Index of the original field entry for each output entry */
+        Containers::Array<UnsignedInt> order;
+        /* New object ID for each output entry */
+        Containers::Array<UnsignedInt> mapping;
+    };
+    std::map<std::tuple<const void*, std::size_t, std::ptrdiff_t>, Reordered> uniqueMappings;
+    Containers::Array<const Reordered*> fieldReordered{NoInit, scene.fieldCount()};
+    Containers::Array<Trade::SceneFieldData> fields{ValueInit, scene.fieldCount()};
+    Containers::Array<UnsignedInt> counts{NoInit, mapping.size() + 1};
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        const Trade::SceneFieldType fieldType = scene.fieldType(i);
+        CORRADE_ASSERT(!Trade::Implementation::isSceneFieldTypeString(fieldType),
+            "SceneTools::reorderObjects(): reordering string fields is not implemented yet, sorry", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+        CORRADE_ASSERT(fieldType != Trade::SceneFieldType::Bit,
+            "SceneTools::reorderObjects(): reordering bit fields is not implemented yet, sorry", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+
+        const std::size_t size = scene.fieldSize(i);
+        const Containers::StridedArrayView2D<const char> originalMapping = scene.mapping(i);
+        const std::pair<std::map<std::tuple<const void*, std::size_t, std::ptrdiff_t>, Reordered>::iterator, bool> inserted = uniqueMappings.emplace(std::make_tuple(originalMapping.data(), size, originalMapping.stride()[0]), Reordered{});
+        Reordered& reordered = inserted.first->second;
+        if(inserted.second) {
+            const Containers::Array<UnsignedInt> objects = scene.mappingAsArray(i);
+            reordered.order = Containers::Array<UnsignedInt>{NoInit, size};
+            reordered.mapping = Containers::Array<UnsignedInt>{NoInit, size};
+
+            /* Counting sort by the new object ID. It's stable, so multiple
+               entries for the same object stay in their original relative
+               order. */
+            for(UnsignedInt& j: counts) j = 0;
+            for(const UnsignedInt object: objects)
+                ++counts[mapping[object] + 1];
+            for(std::size_t j = 1; j != counts.size(); ++j)
+                counts[j] += counts[j - 1];
+            for(std::size_t j = 0; j != size; ++j) {
+                const UnsignedInt newObject = mapping[objects[j]];
+                const UnsignedInt position = counts[newObject]++;
+                reordered.order[position] = j;
+                reordered.mapping[position] = newObject;
+            }
+        }
+        fieldReordered[i] = &reordered;
+
+        /* The mapping is sorted now, but unless the permutation is an
+           identity it's not implicit anymore. Offset-only fields are turned
+           into absolute ones by combineFields(). */
+        const Trade::SceneFieldFlags flags = (scene.fieldFlags(i) & ~(Trade::SceneFieldFlag::ImplicitMapping|Trade::SceneFieldFlag::OffsetOnly))|Trade::SceneFieldFlag::OrderedMapping;
+
+        const UnsignedShort arraySize = scene.fieldArraySize(i);
+        const std::size_t rowSize = Trade::sceneFieldTypeSize(fieldType)*(arraySize ? arraySize : 1);
+        fields[i] = Trade::SceneFieldData{scene.fieldName(i),
+            Trade::SceneMappingType::UnsignedInt, Containers::StridedArrayView1D<const UnsignedInt>{reordered.mapping},
+            fieldType, Containers::StridedArrayView1D<const void>{{nullptr, rowSize*size}, size, std::ptrdiff_t(rowSize)}, arraySize, flags};
+    }
+
+    /* Create a new SceneData with the reordered mapping and placeholder
+       field data, copy the field data there in the new order */
+    Trade::SceneData out = combineFields(Trade::SceneMappingType::UnsignedInt, scene.mappingBound(), fields);
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        const Containers::StridedArrayView2D<const char> src = scene.field(i);
+        const Containers::StridedArrayView2D<char> dst = out.mutableField(i);
+        const Containers::ArrayView<const UnsignedInt> order = fieldReordered[i]->order;
+        for(std::size_t j = 0; j != order.size(); ++j)
+            Utility::copy(src[order[j]], dst[j]);
+    }
+
+    /* The parent field references objects, so it has to be remapped as well.
+       The mapIndexFieldInPlace() utility doesn't support 64-bit types, so
+       handle that directly. */
+    if(const Containers::Optional<UnsignedInt> parentFieldId = out.findFieldId(Trade::SceneField::Parent)) {
+        if(out.fieldType(*parentFieldId) == Trade::SceneFieldType::Long) {
+            for(Long& parent: out.mutableField<Long>(*parentFieldId))
+                if(parent != -1) parent = mapping[std::size_t(parent)];
+        } else mapIndexFieldInPlace(out, *parentFieldId, mapping);
+    }
+
+    return out;
+}
+
+Trade::SceneData reorderObjects(const Trade::SceneData& scene) {
+    /* Checking here as well to not have the assertion message mention
+       breadthFirstObjectMapping() */
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Parent),
+        "SceneTools::reorderObjects(): the scene has no hierarchy",
+        (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+
+    return reorderObjects(scene, breadthFirstObjectMapping(scene));
+}
+
+}}
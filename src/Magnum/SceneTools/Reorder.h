@@ -0,0 +1,97 @@
+#ifndef Magnum_SceneTools_Reorder_h
+#define Magnum_SceneTools_Reorder_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::SceneTools::breadthFirstObjectMapping(), @ref Magnum::SceneTools::reorderObjects()
+ * @m_since_latest
+ */
+
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Calculate a breadth-first object mapping
+@m_since_latest
+
+Returns an array of @ref Trade::SceneData::mappingBound() items where
+@cpp mapping[i] @ce is a new ID of object @cpp i @ce such that objects listed
+in the @ref Trade::SceneField::Parent field are numbered in the order returned
+by @ref parentsBreadthFirst() --- i.e., parents always have a lower ID than
+their children and all children of a particular parent have consecutive IDs.
+Objects that aren't a part of the hierarchy are numbered after, in their
+original order. The result can be passed to @ref reorderObjects(const Trade::SceneData&, const Containers::StridedArrayView1D<const UnsignedInt>&).
+
+Expects that the scene has a @ref Trade::SceneField::Parent field, see
+@ref parentsBreadthFirst() for further expectations.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<UnsignedInt> breadthFirstObjectMapping(const Trade::SceneData& scene);
+
+/**
+@brief Reorder objects in a scene
+@m_since_latest
+
+Returns a copy of @p scene with object @cpp i @ce renamed to
+@cpp mapping[i] @ce in all fields. Entries of every field are additionally
+sorted by the new object ID, so a traversal of the fields in a new object order
+accesses memory linearly. Values of the @ref Trade::SceneField::Parent field,
+if present, are remapped with @ref mapIndexFieldInPlace(), with
+@cpp -1 @ce preserved. Fields that share the object mapping view, such as
+@ref Trade::SceneField::Mesh and @relativeref{Trade::SceneField,MeshMaterial},
+stay shared in the output.
+
+The output always has a @ref Trade::SceneMappingType::UnsignedInt mapping type
+and the same @ref Trade::SceneData::mappingBound() as @p scene. All fields are
+marked with @ref Trade::SceneFieldFlag::OrderedMapping, other flags are
+preserved.
+
+Expects that @p mapping has @ref Trade::SceneData::mappingBound() items, all
+values are less than the mapping bound and unique. String and bit fields are
+not supported at the moment.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData reorderObjects(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const UnsignedInt>& mapping);
+
+/**
+@brief Reorder objects in a scene breadth-first
+@m_since_latest
+
+Equivalent to calling @ref reorderObjects(const Trade::SceneData&, const Containers::StridedArrayView1D<const UnsignedInt>&)
+with a mapping produced by @ref breadthFirstObjectMapping(). The resulting
+scene has parents always preceding their children, with siblings being
+contiguous, which makes passes such as @ref absoluteFieldTransformations3D()
+or @ref parentsBreadthFirst() go through memory in a linear order.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData reorderObjects(const Trade::SceneData& scene);
+
+}}
+
+#endif
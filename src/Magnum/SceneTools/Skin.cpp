@@ -0,0 +1,116 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Instances.h"
+
+#include "Skin.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/MatrixBatch.h"
+#include "Magnum/Trade/SkinData.h"
+
+namespace Magnum { namespace SceneTools {
+
+namespace {
+
+template<UnsignedInt dimensions> std::size_t skinJointCountImplementation(const Containers::Iterable<const Trade::SkinData<dimensions>>& skins) {
+    std::size_t count = 0;
+    for(const Trade::SkinData<dimensions>& skin: skins)
+        count += skin.joints().size();
+    return count;
+}
+
+/* There's no batch variant for 3x3 matrices, so 2D goes through a plain
+   loop */
+void multiplyInverseBindMatrices(const Containers::StridedArrayView1D<Matrix3>& jointMatrices, const Containers::StridedArrayView1D<const Matrix3>& inverseBindMatrices) {
+    for(std::size_t i = 0; i != jointMatrices.size(); ++i)
+        jointMatrices[i] = jointMatrices[i]*inverseBindMatrices[i];
+}
+
+void multiplyInverseBindMatrices(const Containers::StridedArrayView1D<Matrix4>& jointMatrices, const Containers::StridedArrayView1D<const Matrix4>& inverseBindMatrices) {
+    Math::multiplyInto(jointMatrices, inverseBindMatrices, jointMatrices);
+}
+
+template<UnsignedInt dimensions> void skinJointMatricesIntoImplementation(const char* const messagePrefix, const Containers::Iterable<const Trade::SkinData<dimensions>>& skins, const Containers::StridedArrayView1D<const MatrixTypeFor<dimensions, Float>>& absoluteTransformations, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& jointMatrices) {
+    #ifndef CORRADE_NO_ASSERT
+    const std::size_t jointCount = skinJointCountImplementation(skins);
+    CORRADE_ASSERT(jointMatrices.size() == jointCount,
+        messagePrefix << "expected output view to have" << jointCount << "elements but got" << jointMatrices.size(), );
+    #endif
+
+    /* For each skin, gather the absolute joint transformations into the
+       output first and then multiply them with the inverse bind matrices in
+       place, which for 3D uses the batch Math::multiplyInto() */
+    std::size_t offset = 0;
+    for(std::size_t i = 0; i != skins.size(); ++i) {
+        const Trade::SkinData<dimensions>& skin = skins[i];
+        const Containers::ArrayView<const UnsignedInt> joints = skin.joints();
+        const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>> skinJointMatrices = jointMatrices.sliceSize(offset, joints.size());
+        for(std::size_t j = 0; j != joints.size(); ++j) {
+            CORRADE_ASSERT(joints[j] < absoluteTransformations.size(),
+                messagePrefix << "joint" << j << "of skin" << i << "references object" << joints[j] << "but only" << absoluteTransformations.size() << "absolute transformations were passed", );
+            skinJointMatrices[j] = absoluteTransformations[joints[j]];
+        }
+        multiplyInverseBindMatrices(skinJointMatrices, skin.inverseBindMatrices());
+        offset += joints.size();
+    }
+}
+}
+
+std::size_t skinJointCount2D(const Containers::Iterable<const Trade::SkinData2D>& skins) {
+    return skinJointCountImplementation(skins);
+}
+
+std::size_t skinJointCount3D(const Containers::Iterable<const Trade::SkinData3D>& skins) {
+    return skinJointCountImplementation(skins);
+}
+
+void skinJointMatrices2DInto(const Containers::Iterable<const Trade::SkinData2D>& skins, const Containers::StridedArrayView1D<const Matrix3>& absoluteTransformations, const Containers::StridedArrayView1D<Matrix3>& jointMatrices) {
+    skinJointMatricesIntoImplementation("SceneTools::skinJointMatrices2DInto():", skins, absoluteTransformations, jointMatrices);
+}
+
+void skinJointMatrices3DInto(const Containers::Iterable<const Trade::SkinData3D>& skins, const Containers::StridedArrayView1D<const Matrix4>& absoluteTransformations, const Containers::StridedArrayView1D<Matrix4>& jointMatrices) {
+    skinJointMatricesIntoImplementation("SceneTools::skinJointMatrices3DInto():", skins, absoluteTransformations, jointMatrices);
+}
+
+Containers::Array<Matrix3> skinJointMatrices2D(const Containers::Iterable<const Trade::SkinData2D>& skins, const Containers::StridedArrayView1D<const Matrix3>& absoluteTransformations) {
+    Containers::Array<Matrix3> out{NoInit, skinJointCount2D(skins)};
+    skinJointMatricesIntoImplementation("SceneTools::skinJointMatrices2D():", skins, absoluteTransformations, Containers::stridedArrayView(out));
+    return out;
+}
+
+Containers::Array<Matrix4> skinJointMatrices3D(const Containers::Iterable<const Trade::SkinData3D>& skins, const Containers::StridedArrayView1D<const Matrix4>& absoluteTransformations) {
+    Containers::Array<Matrix4> out{NoInit, skinJointCount3D(skins)};
+    skinJointMatricesIntoImplementation("SceneTools::skinJointMatrices3D():", skins, absoluteTransformations, Containers::stridedArrayView(out));
+    return out;
+}
+
+}}
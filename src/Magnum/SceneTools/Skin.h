@@ -0,0 +1,126 @@
+#ifndef Magnum_SceneTools_Skin_h
+#define Magnum_SceneTools_Skin_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Instances.h"
+
+/** @file
+ * @brief Function @ref Magnum::SceneTools::skinJointCount2D(), @ref Magnum::SceneTools::skinJointCount3D(), @ref Magnum::SceneTools::skinJointMatrices2D(), @ref Magnum::SceneTools::skinJointMatrices3D(), @ref Magnum::SceneTools::skinJointMatrices2DInto(), @ref Magnum::SceneTools::skinJointMatrices3DInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Total joint count of a list of 2D skins
+@m_since_latest
+
+Sum of @ref Trade::SkinData::joints() sizes of all @p skins. Joint matrices of
+a particular skin in the output of @ref skinJointMatrices2D() start at an
+offset equal to the joint count of all skins before it.
+@experimental
+
+@see @ref skinJointCount3D()
+*/
+MAGNUM_SCENETOOLS_EXPORT std::size_t skinJointCount2D(const Containers::Iterable<const Trade::SkinData2D>& skins);
+
+/**
+@brief Total joint count of a list of 3D skins
+@m_since_latest
+
+Sum of @ref Trade::SkinData::joints() sizes of all @p skins. Joint matrices of
+a particular skin in the output of @ref skinJointMatrices3D() start at an
+offset equal to the joint count of all skins before it, which is directly
+usable as @ref Shaders::PhongDrawUniform::jointOffset.
+@experimental
+
+@see @ref skinJointCount2D()
+*/
+MAGNUM_SCENETOOLS_EXPORT std::size_t skinJointCount3D(const Containers::Iterable<const Trade::SkinData3D>& skins);
+
+/**
+@brief Calculate joint matrices for a list of 2D skins
+@m_since_latest
+
+Allocates an array of size given by @ref skinJointCount2D() and calls
+@ref skinJointMatrices2DInto() with it. See its documentation for more
+information.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> skinJointMatrices2D(const Containers::Iterable<const Trade::SkinData2D>& skins, const Containers::StridedArrayView1D<const Matrix3>& absoluteTransformations);
+
+/**
+@brief Calculate joint matrices for a list of 3D skins
+@m_since_latest
+
+Allocates an array of size given by @ref skinJointCount3D() and calls
+@ref skinJointMatrices3DInto() with it. See its documentation for more
+information.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> skinJointMatrices3D(const Containers::Iterable<const Trade::SkinData3D>& skins, const Containers::StridedArrayView1D<const Matrix4>& absoluteTransformations);
+
+/**
+@brief Calculate joint matrices for a list of 2D skins into an existing array
+@m_since_latest
+
+Like @ref skinJointMatrices3DInto(), but for 2D skins.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT void skinJointMatrices2DInto(const Containers::Iterable<const Trade::SkinData2D>& skins, const Containers::StridedArrayView1D<const Matrix3>& absoluteTransformations, const Containers::StridedArrayView1D<Matrix3>& jointMatrices);
+
+/**
+@brief Calculate joint matrices for a list of 3D skins into an existing array
+@m_since_latest
+
+For every skin in @p skins and every joint in it calculates the joint matrix as
+the absolute transformation of the joint object multiplied by the
+corresponding inverse bind matrix, i.e. @cpp absoluteTransformations[joints()[i]]*inverseBindMatrices()[i] @ce,
+and puts the joint matrices of all skins consecutively into
+@p jointMatrices. The @p absoluteTransformations view is indexed by object ID,
+for example @ref TransformationCache3D::absoluteTransformations(). The result
+is directly usable for @ref Shaders::PhongGL::setJointMatrices() or for
+filling a joint matrix uniform buffer, with joint offset of each skin given by
+the joint count of all skins before it. The multiplication is done with
+@ref Math::multiplyInto(), which picks a SIMD implementation based on the
+CPU the code runs on.
+
+Expects that @p jointMatrices size is equal to @ref skinJointCount3D() and
+that all joint IDs are less than @p absoluteTransformations size.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT void skinJointMatrices3DInto(const Containers::Iterable<const Trade::SkinData3D>& skins, const Containers::StridedArrayView1D<const Matrix4>& absoluteTransformations, const Containers::StridedArrayView1D<Matrix4>& jointMatrices);
+
+}}
+
+#endif
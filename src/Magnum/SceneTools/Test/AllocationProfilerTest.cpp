@@ -0,0 +1,155 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <new>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/SceneTools/Implementation/allocationProfiler.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct AllocationProfilerTest: TestSuite::Tester {
+    explicit AllocationProfilerTest();
+
+    void scope();
+    void scopeNested();
+    void scopeMerged();
+    void scopeNoProfile();
+};
+
+using namespace Containers::Literals;
+
+/* Calling the allocation functions directly instead of using a new
+   expression, as the compiler is allowed to elide those */
+struct Allocation {
+    explicit Allocation(std::size_t size): data{::operator new(size)} {}
+    ~Allocation() { ::operator delete(data); }
+
+    void* data;
+};
+
+AllocationProfilerTest::AllocationProfilerTest() {
+    addTests({&AllocationProfilerTest::scope,
+              &AllocationProfilerTest::scopeNested,
+              &AllocationProfilerTest::scopeMerged,
+              &AllocationProfilerTest::scopeNoProfile});
+
+    Implementation::enableAllocationCounting();
+}
+
+void AllocationProfilerTest::scope() {
+    Implementation::AllocationProfile profile;
+    {
+        Implementation::AllocationScope scope{&profile, "scope"_s};
+        Allocation a{100};
+        Allocation b{50};
+    }
+
+    CORRADE_COMPARE(profile.statistics().size(), 1);
+    CORRADE_COMPARE(profile.statistics()[0].name, "scope");
+    CORRADE_COMPARE(profile.statistics()[0].calls, 1);
+    CORRADE_COMPARE(profile.statistics()[0].count, 2);
+    CORRADE_COMPARE(profile.statistics()[0].bytes, 150);
+    /* The peak is calculated from the actual allocation sizes, which may be
+       larger, and is zero on platforms where they can't be queried */
+    if(profile.statistics()[0].peak)
+        CORRADE_COMPARE_AS(profile.statistics()[0].peak, 150,
+            TestSuite::Compare::GreaterOrEqual);
+}
+
+void AllocationProfilerTest::scopeNested() {
+    Implementation::AllocationProfile profile;
+    {
+        Implementation::AllocationScope outer{&profile, "outer"_s};
+        {
+            Allocation a{1000};
+        }
+        Allocation b{10};
+        {
+            Implementation::AllocationScope inner{&profile, "inner"_s};
+            Allocation c{100};
+        }
+    }
+
+    /* The inner scope ends first, so it's added first */
+    CORRADE_COMPARE(profile.statistics().size(), 2);
+    CORRADE_COMPARE(profile.statistics()[0].name, "inner");
+    CORRADE_COMPARE(profile.statistics()[0].count, 1);
+    CORRADE_COMPARE(profile.statistics()[0].bytes, 100);
+    CORRADE_COMPARE(profile.statistics()[1].name, "outer");
+    CORRADE_COMPARE(profile.statistics()[1].count, 3);
+    CORRADE_COMPARE(profile.statistics()[1].bytes, 1110);
+
+    /* The inner peak is relative to the start of the inner scope, and the
+       inner scope doesn't reset the larger peak of the outer scope */
+    if(profile.statistics()[0].peak) {
+        CORRADE_COMPARE_AS(profile.statistics()[0].peak, 100,
+            TestSuite::Compare::GreaterOrEqual);
+        CORRADE_COMPARE_AS(profile.statistics()[0].peak, 1000,
+            TestSuite::Compare::Less);
+        CORRADE_COMPARE_AS(profile.statistics()[1].peak, 1000,
+            TestSuite::Compare::GreaterOrEqual);
+    }
+}
+
+void AllocationProfilerTest::scopeMerged() {
+    Implementation::AllocationProfile profile;
+    {
+        Implementation::AllocationScope scope{&profile, "scope"_s};
+        Allocation a{1000};
+    } {
+        Implementation::AllocationScope scope{&profile, "scope"_s};
+        Allocation a{100};
+        Allocation b{100};
+    }
+
+    CORRADE_COMPARE(profile.statistics().size(), 1);
+    CORRADE_COMPARE(profile.statistics()[0].name, "scope");
+    CORRADE_COMPARE(profile.statistics()[0].calls, 2);
+    CORRADE_COMPARE(profile.statistics()[0].count, 3);
+    CORRADE_COMPARE(profile.statistics()[0].bytes, 1200);
+    /* The peak is the maximum of both */
+    if(profile.statistics()[0].peak)
+        CORRADE_COMPARE_AS(profile.statistics()[0].peak, 1000,
+            TestSuite::Compare::GreaterOrEqual);
+}
+
+void AllocationProfilerTest::scopeNoProfile() {
+    const std::size_t count = Implementation::threadAllocationCounters().count;
+    {
+        Implementation::AllocationScope scope{nullptr, "scope"_s};
+        Allocation a{100};
+    }
+
+    /* Allocations are still counted, just not added anywhere */
+    CORRADE_COMPARE(Implementation::threadAllocationCounters().count, count + 1);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::AllocationProfilerTest)
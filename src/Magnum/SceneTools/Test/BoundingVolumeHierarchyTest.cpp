@@ -0,0 +1,406 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/BoundingVolumeHierarchy.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct BoundingVolumeHierarchyTest: TestSuite::Tester {
+    explicit BoundingVolumeHierarchyTest();
+
+    void construct();
+    void constructNoMeshField();
+    void constructNot3D();
+    void constructNoParentField();
+    void constructMeshOutOfRange();
+    void constructCopy();
+    void constructMove();
+
+    void cull();
+    void cullInvalidSize();
+
+    void refit();
+    void refitEntries();
+    void refitInvalidSize();
+};
+
+/* Object 1 is a child of 0, 2 and 3 are roots. Object 3 has two meshes
+   assigned. */
+struct Scene {
+    struct Parent {
+        UnsignedInt object;
+        Int parent;
+    } parents[4];
+
+    struct Transformation {
+        UnsignedInt object;
+        Matrix4 transformation;
+    } transformations[3];
+
+    struct Mesh {
+        UnsignedInt object;
+        UnsignedInt mesh;
+    } meshes[4];
+};
+
+Scene data() {
+    return Scene{{
+        {0, -1},
+        {1, 0},
+        {2, -1},
+        {3, -1}
+    }, {
+        {0, Matrix4::translation({10.0f, 0.0f, 0.0f})},
+        {1, Matrix4::translation({0.0f, 5.0f, 0.0f})},
+        {3, Matrix4::translation({-10.0f, 0.0f, 0.0f})}
+    }, {
+        {1, 0},
+        {2, 1},
+        {3, 0},
+        {3, 1}
+    }};
+}
+
+Trade::SceneData sceneData(const Scene& data) {
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 4, {}, Containers::arrayView(&data, 1), {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(data.parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(data.parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(data.transformations)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(data.transformations)
+                .slice(&Scene::Transformation::transformation)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(data.meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(data.meshes)
+                .slice(&Scene::Mesh::mesh)}
+    }};
+}
+
+const Range3D MeshBounds[]{
+    {{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}},
+    {{0.0f, 0.0f, 0.0f}, {2.0f, 1.0f, 1.0f}}
+};
+
+/* A row of 100 root objects along X, three units apart, each with a 2x2x2
+   cube. Big enough to result in more than one node. */
+struct RowScene {
+    UnsignedInt objects[100];
+    Int parents[100];
+    Matrix4 transformations[100];
+    UnsignedInt meshes[100];
+};
+
+Containers::Pointer<RowScene> rowData() {
+    Containers::Pointer<RowScene> data{InPlaceInit};
+    for(UnsignedInt i = 0; i != 100; ++i) {
+        data->objects[i] = i;
+        data->parents[i] = -1;
+        data->transformations[i] = Matrix4::translation({i*3.0f, 0.0f, 0.0f});
+        data->meshes[i] = 0;
+    }
+    return data;
+}
+
+Trade::SceneData rowSceneData(const RowScene& data) {
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 100, {}, Containers::arrayView(&data, 1), {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(data.objects),
+            Containers::arrayView(data.parents)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::arrayView(data.objects),
+            Containers::arrayView(data.transformations)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data.objects),
+            Containers::arrayView(data.meshes)}
+    }};
+}
+
+/* Planes with normals pointing inside, covering X from 20 to 40 and Y and Z
+   from -10 to 10. In the row scene that's objects 7 to 13. */
+const Frustum RowFrustum{
+    { 1.0f,  0.0f,  0.0f, -20.0f},
+    {-1.0f,  0.0f,  0.0f,  40.0f},
+    { 0.0f,  1.0f,  0.0f,  10.0f},
+    { 0.0f, -1.0f,  0.0f,  10.0f},
+    { 0.0f,  0.0f,  1.0f,  10.0f},
+    { 0.0f,  0.0f, -1.0f,  10.0f}
+};
+
+BoundingVolumeHierarchyTest::BoundingVolumeHierarchyTest() {
+    addTests({&BoundingVolumeHierarchyTest::construct,
+              &BoundingVolumeHierarchyTest::constructNoMeshField,
+              &BoundingVolumeHierarchyTest::constructNot3D,
+              &BoundingVolumeHierarchyTest::constructNoParentField,
+              &BoundingVolumeHierarchyTest::constructMeshOutOfRange,
+              &BoundingVolumeHierarchyTest::constructCopy,
+              &BoundingVolumeHierarchyTest::constructMove,
+
+              &BoundingVolumeHierarchyTest::cull,
+              &BoundingVolumeHierarchyTest::cullInvalidSize,
+
+              &BoundingVolumeHierarchyTest::refit,
+              &BoundingVolumeHierarchyTest::refitEntries,
+              &BoundingVolumeHierarchyTest::refitInvalidSize});
+}
+
+void BoundingVolumeHierarchyTest::construct() {
+    const Scene scene = data();
+    BoundingVolumeHierarchy3D bvh{sceneData(scene), MeshBounds};
+    CORRADE_COMPARE(bvh.objectCount(), 4);
+    CORRADE_COMPARE(bvh.entryCount(), 4);
+    CORRADE_COMPARE_AS(bvh.objects(), Containers::arrayView<UnsignedInt>({
+        1, 2, 3, 3
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(bvh.meshes(), Containers::arrayView<UnsignedInt>({
+        0, 1, 0, 1
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(bvh.bounds(), Containers::arrayView<Range3D>({
+        {{9.0f, 4.0f, -1.0f}, {11.0f, 6.0f, 1.0f}},
+        {{0.0f, 0.0f, 0.0f}, {2.0f, 1.0f, 1.0f}},
+        {{-11.0f, -1.0f, -1.0f}, {-9.0f, 1.0f, 1.0f}},
+        {{-10.0f, 0.0f, 0.0f}, {-8.0f, 1.0f, 1.0f}},
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(bvh.sceneBounds(), (Range3D{{-11.0f, -1.0f, -1.0f}, {11.0f, 6.0f, 1.0f}}));
+    /* Few enough entries to fit into a single leaf */
+    CORRADE_COMPARE(bvh.nodeCount(), 1);
+}
+
+void BoundingVolumeHierarchyTest::constructNoMeshField() {
+    const Scene scene = data();
+    Trade::SceneData sceneNoMeshes{Trade::SceneMappingType::UnsignedInt, 4, {}, Containers::arrayView(&scene, 1), {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(scene.parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(scene.parents)
+                .slice(&Scene::Parent::parent)},
+        /* To mark the scene as 3D */
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(scene.transformations)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(scene.transformations)
+                .slice(&Scene::Transformation::transformation)},
+    }};
+
+    BoundingVolumeHierarchy3D bvh{sceneNoMeshes, MeshBounds};
+    CORRADE_COMPARE(bvh.objectCount(), 4);
+    CORRADE_COMPARE(bvh.entryCount(), 0);
+    CORRADE_COMPARE(bvh.nodeCount(), 0);
+    CORRADE_COMPARE(bvh.sceneBounds(), Range3D{});
+    CORRADE_COMPARE(bvh.cull(RowFrustum, nullptr), 0);
+}
+
+void BoundingVolumeHierarchyTest::constructNot3D() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Int, nullptr}
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    BoundingVolumeHierarchy3D{scene, MeshBounds};
+    CORRADE_COMPARE(out.str(), "SceneTools::BoundingVolumeHierarchy3D: the scene is not 3D\n");
+}
+
+void BoundingVolumeHierarchyTest::constructNoParentField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix4x4, nullptr}
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    BoundingVolumeHierarchy3D{scene, MeshBounds};
+    CORRADE_COMPARE(out.str(), "SceneTools::BoundingVolumeHierarchy3D: the scene has no hierarchy\n");
+}
+
+void BoundingVolumeHierarchyTest::constructMeshOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Scene scene = data();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    BoundingVolumeHierarchy3D{sceneData(scene), Containers::arrayView(MeshBounds).prefix(1)};
+    CORRADE_COMPARE(out.str(), "SceneTools::BoundingVolumeHierarchy3D: mesh 1 out of range for 1 mesh bounds\n");
+}
+
+void BoundingVolumeHierarchyTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<BoundingVolumeHierarchy3D>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<BoundingVolumeHierarchy3D>{});
+}
+
+void BoundingVolumeHierarchyTest::constructMove() {
+    Containers::Pointer<RowScene> scene = rowData();
+    BoundingVolumeHierarchy3D a{rowSceneData(*scene), MeshBounds};
+    const std::size_t nodeCount = a.nodeCount();
+
+    BoundingVolumeHierarchy3D b{Utility::move(a)};
+    CORRADE_COMPARE(b.entryCount(), 100);
+    CORRADE_COMPARE(b.nodeCount(), nodeCount);
+    CORRADE_COMPARE(b.cull(RowFrustum).count(), 7);
+
+    const Scene scene2 = data();
+    BoundingVolumeHierarchy3D c{sceneData(scene2), MeshBounds};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.entryCount(), 100);
+    CORRADE_COMPARE(c.nodeCount(), nodeCount);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<BoundingVolumeHierarchy3D>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<BoundingVolumeHierarchy3D>::value);
+}
+
+void BoundingVolumeHierarchyTest::cull() {
+    Containers::Pointer<RowScene> scene = rowData();
+    BoundingVolumeHierarchy3D bvh{rowSceneData(*scene), MeshBounds};
+    CORRADE_COMPARE(bvh.entryCount(), 100);
+    CORRADE_COMPARE(bvh.sceneBounds(), (Range3D{{-1.0f, -1.0f, -1.0f}, {298.0f, 1.0f, 1.0f}}));
+    CORRADE_COMPARE_AS(bvh.nodeCount(), 1,
+        TestSuite::Compare::Greater);
+
+    Containers::BitArray visible{DirectInit, 100, true};
+    CORRADE_COMPARE(bvh.cull(RowFrustum, visible), 7);
+    for(std::size_t i = 0; i != 100; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(visible[i], i >= 7 && i <= 13);
+    }
+
+    /* The result should be the same as testing all entries one by one */
+    for(std::size_t i = 0; i != 100; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(visible[i], Math::Intersection::rangeFrustum(bvh.bounds()[i], RowFrustum));
+    }
+
+    /* The allocating variant should give back the same */
+    Containers::BitArray visible2 = bvh.cull(RowFrustum);
+    CORRADE_COMPARE(visible2.size(), 100);
+    CORRADE_COMPARE(visible2.count(), 7);
+    for(std::size_t i = 0; i != 100; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(visible2[i], visible[i]);
+    }
+}
+
+void BoundingVolumeHierarchyTest::cullInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Scene scene = data();
+    BoundingVolumeHierarchy3D bvh{sceneData(scene), MeshBounds};
+
+    Containers::BitArray visible{ValueInit, 5};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    bvh.cull(RowFrustum, visible);
+    CORRADE_COMPARE(out.str(), "SceneTools::BoundingVolumeHierarchy3D::cull(): expected 4 bits but got 5\n");
+}
+
+void BoundingVolumeHierarchyTest::refit() {
+    Containers::Pointer<RowScene> scene = rowData();
+    BoundingVolumeHierarchy3D bvh{rowSceneData(*scene), MeshBounds};
+    const std::size_t nodeCount = bvh.nodeCount();
+
+    /* Move everything by 30 units. Then objects 0 to 3 are visible. */
+    Matrix4 transformations[100];
+    for(std::size_t i = 0; i != 100; ++i)
+        transformations[i] = Matrix4::translation({i*3.0f + 30.0f, 0.0f, 0.0f});
+    CORRADE_COMPARE(&bvh.refit(transformations), &bvh);
+    CORRADE_COMPARE(bvh.nodeCount(), nodeCount);
+    CORRADE_COMPARE(bvh.bounds()[5], (Range3D{{44.0f, -1.0f, -1.0f}, {46.0f, 1.0f, 1.0f}}));
+    CORRADE_COMPARE(bvh.sceneBounds(), (Range3D{{29.0f, -1.0f, -1.0f}, {328.0f, 1.0f, 1.0f}}));
+
+    Containers::BitArray visible = bvh.cull(RowFrustum);
+    CORRADE_COMPARE(visible.count(), 4);
+    for(std::size_t i = 0; i != 100; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(visible[i], i <= 3);
+    }
+}
+
+void BoundingVolumeHierarchyTest::refitEntries() {
+    const Scene scene = data();
+    BoundingVolumeHierarchy3D bvh{sceneData(scene), MeshBounds};
+
+    /* Entries are (object, mesh) pairs, object 3 is listed twice */
+    const Matrix4 transformations[]{
+        Matrix4::translation({0.0f, 0.0f, 5.0f}),
+        Matrix4::scaling({2.0f, 1.0f, 1.0f}),
+        Matrix4::rotationZ(Deg(90.0f)),
+        Matrix4::rotationZ(Deg(90.0f))
+    };
+    CORRADE_COMPARE(&bvh.refitEntries(transformations), &bvh);
+    CORRADE_COMPARE_AS(bvh.bounds(), Containers::arrayView<Range3D>({
+        {{-1.0f, -1.0f, 4.0f}, {1.0f, 1.0f, 6.0f}},
+        {{0.0f, 0.0f, 0.0f}, {4.0f, 1.0f, 1.0f}},
+        {{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}},
+        {{-1.0f, 0.0f, 0.0f}, {0.0f, 2.0f, 1.0f}},
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(bvh.sceneBounds(), (Range3D{{-1.0f, -1.0f, -1.0f}, {4.0f, 2.0f, 6.0f}}));
+}
+
+void BoundingVolumeHierarchyTest::refitInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Scene scene = data();
+    BoundingVolumeHierarchy3D bvh{sceneData(scene), MeshBounds};
+
+    const Matrix4 transformations[5];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    bvh.refit(Containers::arrayView(transformations).prefix(3));
+    bvh.refitEntries(transformations);
+    CORRADE_COMPARE_AS(out.str(),
+        "SceneTools::BoundingVolumeHierarchy3D::refit(): expected 4 transformations but got 3\n"
+        "SceneTools::BoundingVolumeHierarchy3D::refitEntries(): expected 4 transformations but got 5\n",
+        TestSuite::Compare::String);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::BoundingVolumeHierarchyTest)
@@ -35,6 +35,7 @@
 #include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/TestSuite/Compare/Numeric.h>
 #include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Format.h>
 
 #include "Magnum/Math/Complex.h"
 #include "Magnum/Math/Vector2.h"
@@ -60,6 +61,11 @@ struct CombineTest: TestSuite::Tester {
     void fieldsStringPlaceholder();
     void fieldsOffsetOnly();
     void fieldsFromDataOffsetOnly();
+
+    void fieldsInto();
+    void fieldsIntoInvalidData();
+    void fieldsReference();
+    void fieldsReferenceDifferentMappingType();
 };
 
 using namespace Containers::Literals;
@@ -174,7 +180,12 @@ CombineTest::CombineTest() {
     addTests({&CombineTest::fieldsSharedMappingExpected,
               &CombineTest::fieldsStringPlaceholder,
               &CombineTest::fieldsOffsetOnly,
-              &CombineTest::fieldsFromDataOffsetOnly});
+              &CombineTest::fieldsFromDataOffsetOnly,
+
+              &CombineTest::fieldsInto,
+              &CombineTest::fieldsIntoInvalidData,
+              &CombineTest::fieldsReference,
+              &CombineTest::fieldsReferenceDifferentMappingType});
 }
 
 using namespace Math::Literals;
@@ -1137,6 +1148,130 @@ void CombineTest::fieldsFromDataOffsetOnly() {
         TestSuite::Compare::Container);
 }
 
+void CombineTest::fieldsInto() {
+    const UnsignedShort meshMappingData[]{15, 23, 47};
+    const UnsignedByte meshFieldData[]{0, 1, 2};
+    const UnsignedShort translationMappingData[]{5};
+    const Vector2d translationFieldData[]{{1.5, 3.0}};
+
+    const Trade::SceneFieldData fields[]{
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(meshMappingData),
+            Containers::arrayView(meshFieldData)},
+        Trade::SceneFieldData{Trade::SceneField::Translation,
+            Containers::arrayView(translationMappingData),
+            Containers::arrayView(translationFieldData)}
+    };
+
+    /* Same layout as in fieldsAlignment() */
+    std::size_t size = combineFieldsDataSize(Trade::SceneMappingType::UnsignedShort, fields);
+    CORRADE_COMPARE(size, 3*2 + 3 + 1 + 2 + 4 + 16);
+    CORRADE_COMPARE(size, combineFields(Trade::SceneMappingType::UnsignedShort, 167, fields).data().size());
+
+    /* Put it at an offset into a larger arena, with some extra space at the
+       end */
+    alignas(8) char arena[64];
+    Trade::SceneData scene = combineFieldsInto(Trade::SceneMappingType::UnsignedShort, 167, fields, Containers::arrayView(arena).exceptPrefix(8));
+
+    CORRADE_COMPARE(scene.dataFlags(), Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(scene.data().data(), static_cast<const void*>(arena + 8));
+    CORRADE_COMPARE(scene.data().size(), size);
+    CORRADE_COMPARE(scene.mappingType(), Trade::SceneMappingType::UnsignedShort);
+    CORRADE_COMPARE(scene.mappingBound(), 167);
+    CORRADE_COMPARE(scene.fieldCount(), 2);
+
+    CORRADE_COMPARE(scene.fieldName(0), Trade::SceneField::Mesh);
+    CORRADE_COMPARE_AS(scene.mapping<UnsignedShort>(0),
+        Containers::arrayView(meshMappingData),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.field<UnsignedByte>(0),
+        Containers::arrayView(meshFieldData),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(scene.fieldName(1), Trade::SceneField::Translation);
+    CORRADE_COMPARE_AS(scene.mapping<UnsignedShort>(1),
+        Containers::arrayView(translationMappingData),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.field<Vector2d>(1),
+        Containers::arrayView(translationFieldData),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(scene.field(1).data(), static_cast<const void*>(arena + 8 + 3*2 + 3 + 1 + 2 + 4));
+}
+
+void CombineTest::fieldsIntoInvalidData() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedShort meshMappingData[]{15, 23, 47};
+    const UnsignedByte meshFieldData[]{0, 1, 2};
+    const Trade::SceneFieldData fields[]{
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(meshMappingData),
+            Containers::arrayView(meshFieldData)}
+    };
+
+    alignas(8) char data[16];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    combineFieldsInto(Trade::SceneMappingType::UnsignedInt, 167, fields, Containers::arrayView(data).prefix(14));
+    combineFieldsInto(Trade::SceneMappingType::UnsignedInt, 167, fields, Containers::arrayView(data).exceptPrefix(4));
+    CORRADE_COMPARE(out.str(), Utility::formatString(
+        "SceneTools::combineFieldsInto(): expected data of at least 15 bytes but got 14\n"
+        "SceneTools::combineFieldsInto(): expected data to be aligned to 8 bytes but got 0x{:x}\n", reinterpret_cast<std::uintptr_t>(data + 4)));
+}
+
+void CombineTest::fieldsReference() {
+    const struct {
+        UnsignedInt meshMapping[3];
+        UnsignedByte meshField[3];
+    } data{
+        {15, 23, 47},
+        {0, 1, 2}
+    };
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 167, {}, Containers::ArrayView<const void>{&data, sizeof(data)}, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data.meshMapping),
+            Containers::arrayView(data.meshField)}
+    }};
+
+    Trade::SceneData referenced = combineFieldsReference(scene, Trade::SceneMappingType::UnsignedInt);
+    CORRADE_COMPARE(referenced.dataFlags(), Trade::DataFlags{});
+    CORRADE_COMPARE(referenced.data().data(), static_cast<const void*>(&data));
+    CORRADE_COMPARE(referenced.mappingType(), Trade::SceneMappingType::UnsignedInt);
+    CORRADE_COMPARE(referenced.mappingBound(), 167);
+    CORRADE_COMPARE(referenced.fieldCount(), 1);
+    CORRADE_COMPARE(referenced.mapping(0).data(), static_cast<const void*>(data.meshMapping));
+    CORRADE_COMPARE(referenced.field(0).data(), static_cast<const void*>(data.meshField));
+}
+
+void CombineTest::fieldsReferenceDifferentMappingType() {
+    const struct {
+        UnsignedInt meshMapping[3];
+        UnsignedByte meshField[3];
+    } data{
+        {15, 23, 47},
+        {0, 1, 2}
+    };
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 167, {}, Containers::ArrayView<const void>{&data, sizeof(data)}, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data.meshMapping),
+            Containers::arrayView(data.meshField)}
+    }};
+
+    Trade::SceneData combined = combineFieldsReference(scene, Trade::SceneMappingType::UnsignedByte);
+    CORRADE_COMPARE(combined.dataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(combined.mappingType(), Trade::SceneMappingType::UnsignedByte);
+    CORRADE_COMPARE(combined.mappingBound(), 167);
+    CORRADE_COMPARE_AS(combined.mapping<UnsignedByte>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedByte>({15, 23, 47}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(combined.field<UnsignedByte>(Trade::SceneField::Mesh),
+        Containers::arrayView(data.meshField),
+        TestSuite::Compare::Container);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneTools::Test::CombineTest)
@@ -0,0 +1,384 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h> /** @todo remove once Debug is stream-free */
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Complex.h"
+#include "Magnum/SceneTools/Combine.h"
+#include "Magnum/SceneTools/Compact.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+using namespace Math::Literals;
+
+struct CompactTest: TestSuite::Tester {
+    explicit CompactTest();
+
+    void mappingType();
+
+    void indexFields();
+    void indexFieldsLarge();
+    void transformations();
+    void transformationsNotAffine();
+    void transformationsDoublesToFloats();
+    void customFields();
+    void empty();
+};
+
+const struct {
+    const char* name;
+    UnsignedLong mappingBound;
+    Trade::SceneMappingType expected;
+} MappingTypeData[]{
+    {"zero", 0, Trade::SceneMappingType::UnsignedByte},
+    {"8-bit", 256, Trade::SceneMappingType::UnsignedByte},
+    {"16-bit", 257, Trade::SceneMappingType::UnsignedShort},
+    {"16-bit max", 65536, Trade::SceneMappingType::UnsignedShort},
+    {"32-bit", 65537, Trade::SceneMappingType::UnsignedInt},
+    {"32-bit max", 4294967296ull, Trade::SceneMappingType::UnsignedInt},
+    {"64-bit", 4294967297ull, Trade::SceneMappingType::UnsignedLong},
+};
+
+CompactTest::CompactTest() {
+    addInstancedTests({&CompactTest::mappingType},
+        Containers::arraySize(MappingTypeData));
+
+    addTests({&CompactTest::indexFields,
+              &CompactTest::indexFieldsLarge,
+              &CompactTest::transformations,
+              &CompactTest::transformationsNotAffine,
+              &CompactTest::transformationsDoublesToFloats,
+              &CompactTest::customFields,
+              &CompactTest::empty});
+}
+
+void CompactTest::mappingType() {
+    auto&& data = MappingTypeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    CORRADE_COMPARE(compactMappingType(data.mappingBound), data.expected);
+}
+
+void CompactTest::indexFields() {
+    struct {
+        UnsignedLong parentMapping[4];
+        Long parent[4];
+        UnsignedLong meshMaterialMapping[3];
+        UnsignedInt mesh[3];
+        Int meshMaterial[3];
+        UnsignedLong cameraMapping[2];
+        UnsignedInt camera[2];
+    } sceneData[]{{
+        {0, 1, 2, 3},
+        {-1, 0, 1, 1},
+        {1, 3, 2},
+        {300, 0, 17},
+        {5, -1, 2},
+        {0, 3},
+        {1, 0}
+    }};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedLong, 4, {}, sceneData, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(sceneData->parentMapping),
+            Containers::arrayView(sceneData->parent)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(sceneData->meshMaterialMapping),
+            Containers::arrayView(sceneData->mesh),
+            /* Verify that the flags get preserved */
+            Trade::SceneFieldFlag::MultiEntry},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::arrayView(sceneData->meshMaterialMapping),
+            Containers::arrayView(sceneData->meshMaterial),
+            Trade::SceneFieldFlag::MultiEntry},
+        Trade::SceneFieldData{Trade::SceneField::Camera,
+            Containers::arrayView(sceneData->cameraMapping),
+            Containers::arrayView(sceneData->camera)},
+    }};
+
+    Trade::SceneData compacted = compactFields(scene);
+    CORRADE_COMPARE(compacted.dataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(compacted.mappingType(), Trade::SceneMappingType::UnsignedByte);
+    CORRADE_COMPARE(compacted.mappingBound(), 4);
+    CORRADE_COMPARE(compacted.fieldCount(), 4);
+    CORRADE_COMPARE(compacted.data().size(), compactFieldsDataSize(scene));
+    CORRADE_COMPARE_AS(compacted.data().size(), scene.data().size(),
+        TestSuite::Compare::Less);
+
+    CORRADE_COMPARE(compacted.fieldType(Trade::SceneField::Parent), Trade::SceneFieldType::Byte);
+    CORRADE_COMPARE_AS(compacted.mapping<UnsignedByte>(Trade::SceneField::Parent),
+        Containers::arrayView<UnsignedByte>({0, 1, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(compacted.field<Byte>(Trade::SceneField::Parent),
+        Containers::arrayView<Byte>({-1, 0, 1, 1}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(compacted.fieldType(Trade::SceneField::Mesh), Trade::SceneFieldType::UnsignedShort);
+    CORRADE_COMPARE(compacted.fieldFlags(Trade::SceneField::Mesh), Trade::SceneFieldFlag::MultiEntry);
+    CORRADE_COMPARE_AS(compacted.mapping<UnsignedByte>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedByte>({1, 3, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(compacted.field<UnsignedShort>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedShort>({300, 0, 17}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(compacted.fieldType(Trade::SceneField::MeshMaterial), Trade::SceneFieldType::Byte);
+    CORRADE_COMPARE_AS(compacted.field<Byte>(Trade::SceneField::MeshMaterial),
+        Containers::arrayView<Byte>({5, -1, 2}),
+        TestSuite::Compare::Container);
+
+    /* The mesh and material mapping sharing is preserved */
+    CORRADE_COMPARE(compacted.mapping(Trade::SceneField::Mesh).data(),
+                    compacted.mapping(Trade::SceneField::MeshMaterial).data());
+
+    CORRADE_COMPARE(compacted.fieldType(Trade::SceneField::Camera), Trade::SceneFieldType::UnsignedByte);
+    CORRADE_COMPARE_AS(compacted.mapping<UnsignedByte>(Trade::SceneField::Camera),
+        Containers::arrayView<UnsignedByte>({0, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(compacted.field<UnsignedByte>(Trade::SceneField::Camera),
+        Containers::arrayView<UnsignedByte>({1, 0}),
+        TestSuite::Compare::Container);
+}
+
+void CompactTest::indexFieldsLarge() {
+    struct {
+        UnsignedInt mapping[2];
+        Int parent[2];
+        UnsignedInt mesh[2];
+    } sceneData[]{{
+        {0, 70000},
+        {-1, 40000},
+        {70000, 3}
+    }};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 70001, {}, sceneData, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(sceneData->mapping),
+            Containers::arrayView(sceneData->parent)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(sceneData->mapping),
+            Containers::arrayView(sceneData->mesh)},
+    }};
+
+    /* Nothing can be made smaller here */
+    Trade::SceneData compacted = compactFields(scene);
+    CORRADE_COMPARE(compacted.mappingType(), Trade::SceneMappingType::UnsignedInt);
+    CORRADE_COMPARE(compacted.fieldType(Trade::SceneField::Parent), Trade::SceneFieldType::Int);
+    CORRADE_COMPARE(compacted.fieldType(Trade::SceneField::Mesh), Trade::SceneFieldType::UnsignedInt);
+    CORRADE_COMPARE_AS(compacted.field<Int>(Trade::SceneField::Parent),
+        Containers::arrayView<Int>({-1, 40000}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(compacted.field<UnsignedInt>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedInt>({70000, 3}),
+        TestSuite::Compare::Container);
+}
+
+void CompactTest::transformations() {
+    struct {
+        UnsignedShort mapping[2];
+        Matrix4 transformation[2];
+    } sceneData[]{{
+        {0, 1},
+        {Matrix4::translation({1.0f, 2.0f, 3.0f}),
+         Matrix4::rotationX(35.0_degf)*Matrix4::scaling({2.0f, 3.0f, 4.0f})}
+    }};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 2, {}, sceneData, {
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::arrayView(sceneData->mapping),
+            Containers::arrayView(sceneData->transformation)},
+    }};
+
+    Trade::SceneData compacted = compactFields(scene);
+    CORRADE_COMPARE(compacted.mappingType(), Trade::SceneMappingType::UnsignedByte);
+    CORRADE_COMPARE(compacted.fieldType(Trade::SceneField::Transformation), Trade::SceneFieldType::Matrix4x3);
+    CORRADE_COMPARE(compacted.data().size(), compactFieldsDataSize(scene));
+    CORRADE_COMPARE_AS(compacted.field<Matrix4x3>(Trade::SceneField::Transformation),
+        Containers::arrayView<Matrix4x3>({
+            Matrix4x3{sceneData->transformation[0]},
+            Matrix4x3{sceneData->transformation[1]}
+        }), TestSuite::Compare::Container);
+
+    /* The convenience accessor expands the matrices back */
+    CORRADE_COMPARE_AS(compacted.transformations3DAsArray(),
+        Containers::arrayView(sceneData->transformation),
+        TestSuite::Compare::Container);
+}
+
+void CompactTest::transformationsNotAffine() {
+    struct {
+        UnsignedByte mapping[2];
+        Matrix3 transformation[2];
+    } sceneData[]{{
+        {0, 1},
+        {Matrix3::translation({1.0f, 2.0f}),
+         Matrix3{Vector3{1.0f, 0.0f, 0.0f},
+                 Vector3{0.0f, 1.0f, 0.5f},
+                 Vector3{0.0f, 0.0f, 1.0f}}}
+    }};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedByte, 2, {}, sceneData, {
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::arrayView(sceneData->mapping),
+            Containers::arrayView(sceneData->transformation)},
+    }};
+
+    /* One projective matrix is enough to keep the full type */
+    Trade::SceneData compacted = compactFields(scene);
+    CORRADE_COMPARE(compacted.fieldType(Trade::SceneField::Transformation), Trade::SceneFieldType::Matrix3x3);
+    CORRADE_COMPARE_AS(compacted.field<Matrix3>(Trade::SceneField::Transformation),
+        Containers::arrayView(sceneData->transformation),
+        TestSuite::Compare::Container);
+}
+
+void CompactTest::transformationsDoublesToFloats() {
+    struct {
+        UnsignedInt mapping[2];
+        Matrix3d transformation[2];
+        Vector2d translation[2];
+        Complexd rotation[2];
+    } sceneData[]{{
+        {0, 1},
+        {Matrix3d::translation({1.0, 2.0}),
+         Matrix3d::rotation(35.0_deg)},
+        {{1.0, 2.0}, {3.0, 4.0}},
+        {Complexd::rotation(15.0_deg), Complexd::rotation(-30.0_deg)}
+    }};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 2, {}, sceneData, {
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::arrayView(sceneData->mapping),
+            Containers::arrayView(sceneData->transformation)},
+        Trade::SceneFieldData{Trade::SceneField::Translation,
+            Containers::arrayView(sceneData->mapping),
+            Containers::arrayView(sceneData->translation)},
+        Trade::SceneFieldData{Trade::SceneField::Rotation,
+            Containers::arrayView(sceneData->mapping),
+            Containers::arrayView(sceneData->rotation)},
+    }};
+
+    /* Without the flag, only the matrix gets sliced */
+    {
+        Trade::SceneData compacted = compactFields(scene);
+        CORRADE_COMPARE(compacted.fieldType(Trade::SceneField::Transformation), Trade::SceneFieldType::Matrix3x2d);
+        CORRADE_COMPARE(compacted.fieldType(Trade::SceneField::Translation), Trade::SceneFieldType::Vector2d);
+        CORRADE_COMPARE(compacted.fieldType(Trade::SceneField::Rotation), Trade::SceneFieldType::Complexd);
+        CORRADE_COMPARE_AS(compacted.field<Matrix3x2d>(Trade::SceneField::Transformation),
+            Containers::arrayView<Matrix3x2d>({
+                Matrix3x2d{sceneData->transformation[0]},
+                Matrix3x2d{sceneData->transformation[1]}
+            }), TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(compacted.field<Vector2d>(Trade::SceneField::Translation),
+            Containers::arrayView(sceneData->translation),
+            TestSuite::Compare::Container);
+    }
+
+    /* With the flag, everything gets converted to floats */
+    {
+        Trade::SceneData compacted = compactFields(scene, CompactFieldsFlag::DoublesToFloats);
+        CORRADE_COMPARE(compacted.data().size(), compactFieldsDataSize(scene, CompactFieldsFlag::DoublesToFloats));
+        CORRADE_COMPARE(compacted.fieldType(Trade::SceneField::Transformation), Trade::SceneFieldType::Matrix3x2);
+        CORRADE_COMPARE(compacted.fieldType(Trade::SceneField::Translation), Trade::SceneFieldType::Vector2);
+        CORRADE_COMPARE(compacted.fieldType(Trade::SceneField::Rotation), Trade::SceneFieldType::Complex);
+        CORRADE_COMPARE_AS(compacted.field<Matrix3x2>(Trade::SceneField::Transformation),
+            Containers::arrayView<Matrix3x2>({
+                Matrix3x2{Matrix3x2d{sceneData->transformation[0]}},
+                Matrix3x2{Matrix3x2d{sceneData->transformation[1]}}
+            }), TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(compacted.field<Vector2>(Trade::SceneField::Translation),
+            Containers::arrayView<Vector2>({{1.0f, 2.0f}, {3.0f, 4.0f}}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(compacted.field<Complex>(Trade::SceneField::Rotation),
+            Containers::arrayView<Complex>({
+                Complex::rotation(15.0_degf),
+                Complex::rotation(-30.0_degf)
+            }), TestSuite::Compare::Container);
+
+        /* The three fields share the mapping */
+        CORRADE_COMPARE(compacted.mapping(Trade::SceneField::Transformation).data(),
+                        compacted.mapping(Trade::SceneField::Translation).data());
+        CORRADE_COMPARE(compacted.mapping(Trade::SceneField::Transformation).data(),
+                        compacted.mapping(Trade::SceneField::Rotation).data());
+    }
+}
+
+void CompactTest::customFields() {
+    struct {
+        UnsignedInt mapping[3];
+        UnsignedInt custom[3];
+        Double customMatrix[3][2];
+    } sceneData[]{{
+        {0, 1, 2},
+        {1, 2, 3},
+        {{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}}
+    }};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 3, {}, sceneData, {
+        Trade::SceneFieldData{Trade::sceneFieldCustom(15),
+            Containers::arrayView(sceneData->mapping),
+            Containers::arrayView(sceneData->custom)},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(16),
+            Trade::SceneMappingType::UnsignedInt,
+            Containers::arrayView(sceneData->mapping),
+            Trade::SceneFieldType::Double,
+            Containers::arrayView(sceneData->customMatrix), 2},
+    }};
+
+    /* Only the mapping gets compacted, custom fields are kept as-is even with
+       the doubles-to-floats flag */
+    Trade::SceneData compacted = compactFields(scene, CompactFieldsFlag::DoublesToFloats);
+    CORRADE_COMPARE(compacted.mappingType(), Trade::SceneMappingType::UnsignedByte);
+    CORRADE_COMPARE(compacted.fieldType(Trade::sceneFieldCustom(15)), Trade::SceneFieldType::UnsignedInt);
+    CORRADE_COMPARE(compacted.fieldType(Trade::sceneFieldCustom(16)), Trade::SceneFieldType::Double);
+    CORRADE_COMPARE(compacted.fieldArraySize(Trade::sceneFieldCustom(16)), 2);
+    CORRADE_COMPARE_AS(compacted.field<UnsignedInt>(Trade::sceneFieldCustom(15)),
+        Containers::arrayView(sceneData->custom),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(compacted.field<Double[]>(Trade::sceneFieldCustom(16)).transposed<0, 1>()[1],
+        Containers::arrayView<Double>({2.0, 4.0, 6.0}),
+        TestSuite::Compare::Container);
+}
+
+void CompactTest::empty() {
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedLong, 0, nullptr, {}};
+
+    Trade::SceneData compacted = compactFields(scene);
+    CORRADE_COMPARE(compacted.mappingType(), Trade::SceneMappingType::UnsignedByte);
+    CORRADE_COMPARE(compacted.mappingBound(), 0);
+    CORRADE_COMPARE(compacted.fieldCount(), 0);
+    CORRADE_COMPARE(compactFieldsDataSize(scene), 0);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::CompactTest)
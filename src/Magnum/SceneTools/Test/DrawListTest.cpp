@@ -0,0 +1,340 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/DrawList.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct DrawListTest: TestSuite::Tester {
+    explicit DrawListTest();
+
+    void drawList2D();
+    void drawList3D();
+    void drawList3DNoMaterials();
+    void drawListEmpty();
+    void drawListNoMeshField();
+
+    void ranges();
+    void rangesNonIndexed();
+    void rangesInvalidSize();
+    void rangesMeshOutOfRange();
+};
+
+/* Object 1 is a child of 0, the rest are roots. Object 2 has two meshes
+   assigned. */
+struct Scene {
+    struct Parent {
+        UnsignedInt object;
+        Int parent;
+    } parents[6];
+
+    struct Transformation {
+        UnsignedInt object;
+        Matrix4 transformation;
+    } transformations[6];
+
+    struct Mesh {
+        UnsignedInt object;
+        UnsignedInt mesh;
+        Int meshMaterial;
+    } meshes[7];
+};
+
+Scene data() {
+    return Scene{{
+        {0, -1},
+        {1, 0},
+        {2, -1},
+        {3, -1},
+        {4, -1},
+        {5, -1}
+    }, {
+        {0, Matrix4::translation({0.0f, 10.0f, 0.0f})},
+        {1, Matrix4::translation({1.0f, 0.0f, 0.0f})},
+        {2, Matrix4::translation({2.0f, 0.0f, 0.0f})},
+        {3, Matrix4::translation({3.0f, 0.0f, 0.0f})},
+        {4, Matrix4::translation({4.0f, 0.0f, 0.0f})},
+        {5, Matrix4::translation({5.0f, 0.0f, 0.0f})}
+    }, {
+        {2, 1, 0},
+        {0, 1, 2},
+        {3, 1, 0},
+        {1, 0, 2},
+        {4, 0, -1},
+        {5, 1, 1},
+        {2, 0, 2}
+    }};
+}
+
+Trade::SceneData sceneData(const Scene& data, bool materials = true) {
+    Trade::SceneFieldData fields[]{
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(data.parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(data.parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(data.transformations)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(data.transformations)
+                .slice(&Scene::Transformation::transformation)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(data.meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(data.meshes)
+                .slice(&Scene::Mesh::mesh)},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::stridedArrayView(data.meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(data.meshes)
+                .slice(&Scene::Mesh::meshMaterial)}
+    };
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 6, {}, Containers::arrayView(&data, 1), Trade::sceneFieldDataNonOwningArray(Containers::arrayView(fields).prefix(materials ? 4 : 3))};
+}
+
+DrawListTest::DrawListTest() {
+    addTests({&DrawListTest::drawList2D,
+              &DrawListTest::drawList3D,
+              &DrawListTest::drawList3DNoMaterials,
+              &DrawListTest::drawListEmpty,
+              &DrawListTest::drawListNoMeshField,
+
+              &DrawListTest::ranges,
+              &DrawListTest::rangesNonIndexed,
+              &DrawListTest::rangesInvalidSize,
+              &DrawListTest::rangesMeshOutOfRange});
+}
+
+void DrawListTest::drawList2D() {
+    const struct Data {
+        UnsignedInt mapping[3];
+        Int parents[3];
+        Matrix3 transformations[3];
+        UnsignedInt meshes[3];
+        Int meshMaterials[3];
+    } data[]{{
+        {0, 1, 2},
+        {-1, 0, -1},
+        {Matrix3::translation({0.0f, 10.0f}),
+         Matrix3::translation({1.0f, 0.0f}),
+         Matrix3::translation({2.0f, 0.0f})},
+        {3, 0, 3},
+        {1, 1, 0}
+    }};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 3, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->parents)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->transformations)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->meshes)},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->meshMaterials)},
+    }};
+
+    const Matrix3 global = Matrix3::scaling(Vector2{2.0f});
+    Containers::Pair<Containers::Array<Containers::Pair<Int, UnsignedInt>>, Containers::Array<Containers::Pair<UnsignedInt, Matrix3>>> out = meshDrawList2D(scene, global);
+    CORRADE_COMPARE_AS(out.first(), (Containers::arrayView<Containers::Pair<Int, UnsignedInt>>({
+        {0, 1},
+        {1, 2}
+    })), TestSuite::Compare::Container);
+    /* Objects 2, 1, 0 */
+    CORRADE_COMPARE_AS(out.second(), (Containers::arrayView<Containers::Pair<UnsignedInt, Matrix3>>({
+        {3, global*Matrix3::translation({2.0f, 0.0f})},
+        {0, global*Matrix3::translation({1.0f, 10.0f})},
+        {3, global*Matrix3::translation({0.0f, 10.0f})}
+    })), TestSuite::Compare::Container);
+}
+
+void DrawListTest::drawList3D() {
+    const Scene scene = data();
+    const Matrix4 global = Matrix4::scaling(Vector3{2.0f});
+    Containers::Pair<Containers::Array<Containers::Pair<Int, UnsignedInt>>, Containers::Array<Containers::Pair<UnsignedInt, Matrix4>>> out = meshDrawList3D(sceneData(scene), global);
+
+    /* Seven draws in four material batches */
+    CORRADE_COMPARE_AS(out.first(), (Containers::arrayView<Containers::Pair<Int, UnsignedInt>>({
+        {-1, 1},
+        {0, 2},
+        {1, 1},
+        {2, 3}
+    })), TestSuite::Compare::Container);
+    /* Entries 4, 0, 2, 5, 3, 6, 1, which are objects 4, 2, 3, 5, 1, 2, 0.
+       Sorted by mesh in each batch, relative order of the same meshes is
+       preserved. */
+    CORRADE_COMPARE_AS(out.second(), (Containers::arrayView<Containers::Pair<UnsignedInt, Matrix4>>({
+        {0, global*Matrix4::translation({4.0f, 0.0f, 0.0f})},
+        {1, global*Matrix4::translation({2.0f, 0.0f, 0.0f})},
+        {1, global*Matrix4::translation({3.0f, 0.0f, 0.0f})},
+        {1, global*Matrix4::translation({5.0f, 0.0f, 0.0f})},
+        {0, global*Matrix4::translation({1.0f, 10.0f, 0.0f})},
+        {0, global*Matrix4::translation({2.0f, 0.0f, 0.0f})},
+        {1, global*Matrix4::translation({0.0f, 10.0f, 0.0f})}
+    })), TestSuite::Compare::Container);
+}
+
+void DrawListTest::drawList3DNoMaterials() {
+    const Scene scene = data();
+    Containers::Pair<Containers::Array<Containers::Pair<Int, UnsignedInt>>, Containers::Array<Containers::Pair<UnsignedInt, Matrix4>>> out = meshDrawList3D(sceneData(scene, false));
+
+    CORRADE_COMPARE_AS(out.first(), (Containers::arrayView<Containers::Pair<Int, UnsignedInt>>({
+        {-1, 7}
+    })), TestSuite::Compare::Container);
+    /* Entries 3, 4, 6, 0, 1, 2, 5, which are objects 1, 4, 2, 2, 0, 3, 5 */
+    CORRADE_COMPARE_AS(out.second(), (Containers::arrayView<Containers::Pair<UnsignedInt, Matrix4>>({
+        {0, Matrix4::translation({1.0f, 10.0f, 0.0f})},
+        {0, Matrix4::translation({4.0f, 0.0f, 0.0f})},
+        {0, Matrix4::translation({2.0f, 0.0f, 0.0f})},
+        {1, Matrix4::translation({2.0f, 0.0f, 0.0f})},
+        {1, Matrix4::translation({0.0f, 10.0f, 0.0f})},
+        {1, Matrix4::translation({3.0f, 0.0f, 0.0f})},
+        {1, Matrix4::translation({5.0f, 0.0f, 0.0f})}
+    })), TestSuite::Compare::Container);
+}
+
+void DrawListTest::drawListEmpty() {
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Int, nullptr},
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix4x4, nullptr},
+        Trade::SceneFieldData{Trade::SceneField::Mesh, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::UnsignedInt, nullptr}
+    }};
+
+    Containers::Pair<Containers::Array<Containers::Pair<Int, UnsignedInt>>, Containers::Array<Containers::Pair<UnsignedInt, Matrix4>>> out = meshDrawList3D(scene);
+    CORRADE_COMPARE(out.first().size(), 0);
+    CORRADE_COMPARE(out.second().size(), 0);
+}
+
+void DrawListTest::drawListNoMeshField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    meshDrawList2D(scene);
+    meshDrawList3D(scene);
+    CORRADE_COMPARE_AS(out.str(),
+        "SceneTools::meshDrawList2D(): the scene has no meshes\n"
+        "SceneTools::meshDrawList3D(): the scene has no meshes\n",
+        TestSuite::Compare::String);
+}
+
+void DrawListTest::ranges() {
+    const UnsignedInt meshCounts[]{36, 6, 120};
+    const UnsignedInt meshVertexOffsets[]{0, 24, 28};
+    const UnsignedInt meshIndexOffsets[]{0, 72, 84};
+    const UnsignedInt meshes[]{2, 0, 0, 1};
+
+    UnsignedInt counts[4];
+    UnsignedInt vertexOffsets[4];
+    UnsignedInt indexOffsets[4];
+    meshDrawRangesInto(meshes, meshCounts, meshVertexOffsets, meshIndexOffsets, counts, vertexOffsets, indexOffsets);
+    CORRADE_COMPARE_AS(Containers::arrayView(counts),
+        Containers::arrayView<UnsignedInt>({120, 36, 36, 6}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(vertexOffsets),
+        Containers::arrayView<UnsignedInt>({28, 0, 0, 24}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(indexOffsets),
+        Containers::arrayView<UnsignedInt>({84, 0, 0, 72}),
+        TestSuite::Compare::Container);
+}
+
+void DrawListTest::rangesNonIndexed() {
+    const UnsignedInt meshCounts[]{36, 6};
+    const UnsignedInt meshVertexOffsets[]{0, 36};
+    const UnsignedInt meshes[]{1, 0, 1};
+
+    UnsignedInt counts[3];
+    UnsignedInt vertexOffsets[3];
+    meshDrawRangesInto(meshes, meshCounts, meshVertexOffsets, nullptr, counts, vertexOffsets, nullptr);
+    CORRADE_COMPARE_AS(Containers::arrayView(counts),
+        Containers::arrayView<UnsignedInt>({6, 36, 6}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(vertexOffsets),
+        Containers::arrayView<UnsignedInt>({36, 0, 36}),
+        TestSuite::Compare::Container);
+}
+
+void DrawListTest::rangesInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt meshRanges[3]{};
+    const UnsignedInt meshes[4]{};
+    UnsignedInt ranges[4];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    meshDrawRangesInto(meshes, meshRanges, Containers::arrayView(meshRanges).exceptSuffix(1), meshRanges, ranges, ranges, ranges);
+    meshDrawRangesInto(meshes, meshRanges, meshRanges, Containers::arrayView(meshRanges).exceptSuffix(1), ranges, ranges, ranges);
+    meshDrawRangesInto(meshes, meshRanges, meshRanges, meshRanges, Containers::arrayView(ranges).exceptSuffix(1), ranges, ranges);
+    meshDrawRangesInto(meshes, meshRanges, meshRanges, meshRanges, ranges, Containers::arrayView(ranges).exceptSuffix(1), ranges);
+    meshDrawRangesInto(meshes, meshRanges, meshRanges, meshRanges, ranges, ranges, Containers::arrayView(ranges).exceptSuffix(1));
+    /* Non-indexed meshes need an empty index offset output */
+    meshDrawRangesInto(meshes, meshRanges, meshRanges, nullptr, ranges, ranges, ranges);
+    CORRADE_COMPARE_AS(out.str(),
+        "SceneTools::meshDrawRangesInto(): expected mesh vertex and index offset views to have 3 elements but got 2 and 3\n"
+        "SceneTools::meshDrawRangesInto(): expected mesh vertex and index offset views to have 3 elements but got 3 and 2\n"
+        "SceneTools::meshDrawRangesInto(): expected count and vertex offset views to have 4 elements but got 3 and 4\n"
+        "SceneTools::meshDrawRangesInto(): expected count and vertex offset views to have 4 elements but got 4 and 3\n"
+        "SceneTools::meshDrawRangesInto(): expected index offset view to have 4 elements but got 3\n"
+        "SceneTools::meshDrawRangesInto(): expected index offset view to have 0 elements but got 4\n",
+        TestSuite::Compare::String);
+}
+
+void DrawListTest::rangesMeshOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedInt meshRanges[3]{};
+    const UnsignedInt meshes[]{2, 0, 3, 1};
+    UnsignedInt ranges[4];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    meshDrawRangesInto(meshes, meshRanges, meshRanges, meshRanges, ranges, ranges, ranges);
+    CORRADE_COMPARE_AS(out.str(),
+        "SceneTools::meshDrawRangesInto(): mesh 3 out of range for 3 meshes at index 2\n",
+        TestSuite::Compare::String);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::DrawListTest)
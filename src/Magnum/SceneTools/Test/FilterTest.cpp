@@ -61,11 +61,16 @@ struct FilterTest: TestSuite::Tester {
     void fieldEntriesSharedMapping();
     void fieldEntriesSharedMappingInvalid();
 
+    void fieldEntriesInto();
+    void fieldEntriesIntoTooSmall();
+
     template<class T> void objects();
     void objectsUnchangedFields();
     void objectsSharedMapping();
     void objectsSharedMappingAllRemoved();
     void objectsWrongBitCount();
+
+    void objectsInto();
 };
 
 using namespace Math::Literals;
@@ -100,6 +105,9 @@ FilterTest::FilterTest() {
               &FilterTest::fieldEntriesSharedMapping,
               &FilterTest::fieldEntriesSharedMappingInvalid,
 
+              &FilterTest::fieldEntriesInto,
+              &FilterTest::fieldEntriesIntoTooSmall,
+
               &FilterTest::objects<UnsignedByte>,
               &FilterTest::objects<UnsignedShort>,
               &FilterTest::objects<UnsignedInt>,
@@ -107,7 +115,9 @@ FilterTest::FilterTest() {
               &FilterTest::objectsUnchangedFields,
               &FilterTest::objectsSharedMapping,
               &FilterTest::objectsSharedMappingAllRemoved,
-              &FilterTest::objectsWrongBitCount});
+              &FilterTest::objectsWrongBitCount,
+
+              &FilterTest::objectsInto});
 }
 
 void FilterTest::fields() {
@@ -789,6 +799,88 @@ void FilterTest::fieldEntriesSharedMappingInvalid() {
         "SceneTools::filterFieldEntries(): field Trade::SceneField::Custom(1) shares mapping with 3 fields but only 2 are filtered\n");
 }
 
+void FilterTest::fieldEntriesInto() {
+    const struct {
+        UnsignedInt meshMapping[4]{3, 7, 1, 5};
+        UnsignedByte mesh[4]{0, 1, 2, 3};
+        UnsignedInt lightMapping[3]{2, 4, 6};
+        UnsignedShort light[3]{15, 16, 17};
+    } data[1]{};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 8, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->meshMapping),
+            Containers::arrayView(data->mesh)},
+        Trade::SceneFieldData{Trade::SceneField::Light,
+            Containers::arrayView(data->lightMapping),
+            Containers::arrayView(data->light)},
+    }};
+
+    const bool meshesToKeep[]{true, false, false, true};
+
+    /* The lights are passed through. Two mesh mapping entries, two meshes,
+       two bytes padding, three light mapping entries, three lights. */
+    std::size_t size = filterFieldEntriesDataSize(scene, {
+        {0, Containers::stridedArrayView(meshesToKeep).sliceBit(0)}
+    });
+    CORRADE_COMPARE(size, 2*4 + 2*1 + 2 + 3*4 + 3*2);
+
+    alignas(8) char arena[64];
+    Trade::SceneData filtered = filterFieldEntriesInto(scene, {
+        {0, Containers::stridedArrayView(meshesToKeep).sliceBit(0)}
+    }, Containers::arrayView(arena).exceptPrefix(16));
+    CORRADE_COMPARE(filtered.dataFlags(), Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(filtered.data().data(), static_cast<const void*>(arena + 16));
+    CORRADE_COMPARE(filtered.data().size(), size);
+    CORRADE_COMPARE(filtered.fieldCount(), 2);
+    CORRADE_COMPARE_AS(filtered.mapping<UnsignedInt>(Trade::SceneField::Mesh),
+        Containers::arrayView({3u, 5u}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(filtered.field<UnsignedByte>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedByte>({0, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(filtered.mapping<UnsignedInt>(Trade::SceneField::Light),
+        Containers::arrayView(data->lightMapping),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(filtered.field<UnsignedShort>(Trade::SceneField::Light),
+        Containers::arrayView(data->light),
+        TestSuite::Compare::Container);
+}
+
+void FilterTest::fieldEntriesIntoTooSmall() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const struct {
+        UnsignedInt meshMapping[4]{3, 7, 1, 5};
+        UnsignedByte mesh[4]{0, 1, 2, 3};
+    } data[1]{};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 8, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->meshMapping),
+            Containers::arrayView(data->mesh)},
+    }};
+
+    const bool meshesToKeep[]{true, false, false, true};
+    alignas(8) char arena[16];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    filterFieldEntriesDataSize(scene, {
+        {1, Containers::stridedArrayView(meshesToKeep).sliceBit(0)}
+    });
+    filterFieldEntriesInto(scene, {
+        {1, Containers::stridedArrayView(meshesToKeep).sliceBit(0)}
+    }, arena);
+    filterFieldEntriesInto(scene, {
+        {0, Containers::stridedArrayView(meshesToKeep).sliceBit(0)}
+    }, Containers::arrayView(arena).prefix(9));
+    CORRADE_COMPARE(out.str(),
+        "SceneTools::filterFieldEntriesDataSize(): index 1 out of range for 1 fields\n"
+        "SceneTools::filterFieldEntriesInto(): index 1 out of range for 1 fields\n"
+        "SceneTools::combineFieldsInto(): expected data of at least 10 bytes but got 9\n");
+}
+
 template<class T> void FilterTest::objects() {
     setTestCaseTemplateName(Math::TypeTraits<T>::name());
 
@@ -1093,7 +1185,75 @@ void FilterTest::objectsWrongBitCount() {
     std::ostringstream out;
     Error redirectError{&out};
     filterObjects(scene, Containers::BitArray{ValueInit, 177});
-    CORRADE_COMPARE(out.str(), "SceneTools::filterObjects(): expected 176 bits but got 177\n");
+    filterObjectsDataSize(scene, Containers::BitArray{ValueInit, 177});
+    filterObjectsInto(scene, Containers::BitArray{ValueInit, 177}, nullptr);
+    CORRADE_COMPARE(out.str(),
+        "SceneTools::filterObjects(): expected 176 bits but got 177\n"
+        "SceneTools::filterObjectsDataSize(): expected 176 bits but got 177\n"
+        "SceneTools::filterObjectsInto(): expected 176 bits but got 177\n");
+}
+
+void FilterTest::objectsInto() {
+    const struct {
+        UnsignedShort meshMaterialMapping[5]{7, 8, 15, 3, 2};
+        UnsignedByte mesh[5]{2, 222, 3, 222, 222};
+        Byte meshMaterial[5]{-1, 111, 7, 111, 111};
+        UnsignedShort lightMapping[2]{3, 15};
+        UnsignedInt light[2]{66666, 25};
+    } data[1]{};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 76, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->meshMaterialMapping),
+            Containers::arrayView(data->mesh)},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::arrayView(data->meshMaterialMapping),
+            Containers::arrayView(data->meshMaterial)},
+        Trade::SceneFieldData{Trade::SceneField::Light,
+            Containers::arrayView(data->lightMapping),
+            Containers::arrayView(data->light)},
+    }};
+
+    Containers::BitArray objectsToKeep{DirectInit, std::size_t(scene.mappingBound()), true};
+    objectsToKeep.reset(8);
+    objectsToKeep.reset(3);
+    objectsToKeep.reset(2);
+
+    /* Two shared mesh & material mapping entries, two mesh, two material,
+       one light mapping, two bytes padding, one light */
+    std::size_t size = filterObjectsDataSize(scene, objectsToKeep);
+    CORRADE_COMPARE(size, 2*2 + 2*1 + 2*1 + 2 + 2 + 4);
+    CORRADE_COMPARE(size, filterObjects(scene, objectsToKeep).data().size());
+
+    alignas(8) char arena[32];
+    Trade::SceneData filtered = filterObjectsInto(scene, objectsToKeep, arena);
+    CORRADE_COMPARE(filtered.dataFlags(), Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(filtered.data().data(), static_cast<const void*>(arena));
+    CORRADE_COMPARE(filtered.data().size(), size);
+    CORRADE_COMPARE(filtered.fieldCount(), 3);
+    CORRADE_COMPARE(filtered.mappingType(), Trade::SceneMappingType::UnsignedShort);
+    CORRADE_COMPARE(filtered.mappingBound(), 76);
+
+    CORRADE_COMPARE_AS(filtered.mapping<UnsignedShort>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedShort>({7, 15}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(filtered.field<UnsignedByte>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedByte>({2, 3}),
+        TestSuite::Compare::Container);
+
+    /* Mapping shared with Mesh */
+    CORRADE_COMPARE(filtered.mapping(Trade::SceneField::MeshMaterial).data(),
+        filtered.mapping(Trade::SceneField::Mesh).data());
+    CORRADE_COMPARE_AS(filtered.field<Byte>(Trade::SceneField::MeshMaterial),
+        Containers::arrayView<Byte>({-1, 7}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE_AS(filtered.mapping<UnsignedShort>(Trade::SceneField::Light),
+        Containers::arrayView<UnsignedShort>({15}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(filtered.field<UnsignedInt>(Trade::SceneField::Light),
+        Containers::arrayView<UnsignedInt>({25}),
+        TestSuite::Compare::Container);
 }
 
 }}}}
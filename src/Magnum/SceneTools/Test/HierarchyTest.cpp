@@ -25,15 +25,22 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/BitArray.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/Triple.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/DebugStl.h>
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/Test/parallelFor.h"
 #include "Magnum/Trade/SceneData.h"
 
 namespace Magnum { namespace SceneTools { namespace Test { namespace {
@@ -65,6 +72,16 @@ struct HierarchyTest: TestSuite::Tester {
     void absoluteFieldTransformationsInto2D();
     void absoluteFieldTransformationsInto3D();
     void absoluteFieldTransformationsIntoInvalidSize();
+
+    void absoluteFieldTransformationsIntoSubset2D();
+    void absoluteFieldTransformationsIntoSubset3D();
+    void absoluteFieldTransformationsIntoSubsetInvalidSize();
+
+    void absoluteFieldTransformationsParallel2D();
+    void absoluteFieldTransformationsParallel3D();
+
+    void benchmarkAbsoluteFieldTransformations3D();
+    void benchmarkAbsoluteFieldTransformations3DParallel();
 };
 
 using namespace Math::Literals;
@@ -118,6 +135,80 @@ const struct {
         5},
 };
 
+const struct {
+    const char* name;
+    bool fieldIdInsteadOfName;
+    bool threads;
+} ParallelData[]{
+    {"reverse order", false, false},
+    {"reverse order, field ID", true, false},
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    {"threads", false, true},
+    {"threads, field ID", true, true},
+    #endif
+};
+
+/* A wide hierarchy where each object has eight children, with the last level
+   large enough to be split into multiple parallel tasks. The objects are
+   listed in a shuffled order to not have the parent field already sorted. */
+constexpr UnsignedInt WideHierarchyObjectCount = 20000;
+
+struct WideHierarchy {
+    struct Object {
+        UnsignedInt object;
+        Int parent;
+        Matrix3 transformation2D;
+        Matrix4 transformation3D;
+        UnsignedInt mesh;
+    };
+
+    explicit WideHierarchy(UnsignedInt objectCount): objects{NoInit, objectCount} {
+        for(UnsignedInt i = 0; i != objectCount; ++i) {
+            /* Visit the objects with a stride coprime with the count */
+            const UnsignedInt object = UnsignedInt((std::size_t(i)*7919) % objectCount);
+            objects[i].object = object;
+            objects[i].parent = object == 0 ? -1 : Int((object - 1)/8);
+            objects[i].transformation2D =
+                Matrix3::translation({Float(object % 5), 0.5f})*
+                Matrix3::rotation(Deg(Float(object % 7)));
+            objects[i].transformation3D =
+                Matrix4::translation({Float(object % 5), 0.5f, -0.25f})*
+                Matrix4::rotationY(Deg(Float(object % 7)));
+            objects[i].mesh = object;
+        }
+    }
+
+    Trade::SceneData scene2D() const {
+        return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, objects.size(), {}, objects, {
+            Trade::SceneFieldData{Trade::SceneField::Parent,
+                Containers::stridedArrayView(objects).slice(&Object::object),
+                Containers::stridedArrayView(objects).slice(&Object::parent)},
+            Trade::SceneFieldData{Trade::SceneField::Transformation,
+                Containers::stridedArrayView(objects).slice(&Object::object),
+                Containers::stridedArrayView(objects).slice(&Object::transformation2D)},
+            Trade::SceneFieldData{Trade::SceneField::Mesh,
+                Containers::stridedArrayView(objects).slice(&Object::object),
+                Containers::stridedArrayView(objects).slice(&Object::mesh)}
+        }};
+    }
+
+    Trade::SceneData scene3D() const {
+        return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, objects.size(), {}, objects, {
+            Trade::SceneFieldData{Trade::SceneField::Parent,
+                Containers::stridedArrayView(objects).slice(&Object::object),
+                Containers::stridedArrayView(objects).slice(&Object::parent)},
+            Trade::SceneFieldData{Trade::SceneField::Transformation,
+                Containers::stridedArrayView(objects).slice(&Object::object),
+                Containers::stridedArrayView(objects).slice(&Object::transformation3D)},
+            Trade::SceneFieldData{Trade::SceneField::Mesh,
+                Containers::stridedArrayView(objects).slice(&Object::object),
+                Containers::stridedArrayView(objects).slice(&Object::mesh)}
+        }};
+    }
+
+    Containers::Array<Object> objects;
+};
+
 HierarchyTest::HierarchyTest() {
     addTests({&HierarchyTest::parentsBreadthFirstChildrenDepthFirst,
               &HierarchyTest::parentsBreadthFirstChildrenDepthFirstSingleBranch,
@@ -145,9 +236,25 @@ HierarchyTest::HierarchyTest() {
                        &HierarchyTest::absoluteFieldTransformationsInto3D},
         Containers::arraySize(IntoData));
 
-    addTests({&HierarchyTest::absoluteFieldTransformationsIntoInvalidSize});
+    addTests({&HierarchyTest::absoluteFieldTransformationsIntoInvalidSize,
+
+              &HierarchyTest::absoluteFieldTransformationsIntoSubset2D,
+              &HierarchyTest::absoluteFieldTransformationsIntoSubset3D,
+              &HierarchyTest::absoluteFieldTransformationsIntoSubsetInvalidSize});
+
+    addInstancedTests({&HierarchyTest::absoluteFieldTransformationsParallel2D,
+                       &HierarchyTest::absoluteFieldTransformationsParallel3D},
+        Containers::arraySize(ParallelData));
+
+    addBenchmarks({&HierarchyTest::benchmarkAbsoluteFieldTransformations3D,
+                   &HierarchyTest::benchmarkAbsoluteFieldTransformations3DParallel}, 5);
 }
 
+using Magnum::Test::parallelForReverse;
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+using Magnum::Test::parallelForThreads;
+#endif
+
 void HierarchyTest::parentsBreadthFirstChildrenDepthFirst() {
     struct Field {
         /* To verify we don't have unnecessarily hardcoded 32-bit types */
@@ -890,6 +997,253 @@ void HierarchyTest::absoluteFieldTransformationsIntoInvalidSize() {
         "SceneTools::absoluteFieldTransformationsInto(): bad output size, expected 5 but got 4\n");
 }
 
+void HierarchyTest::absoluteFieldTransformationsIntoSubset2D() {
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 33, {}, Data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::transformation2D)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::mesh)}
+    }};
+
+    /* Only objects 3 and 16, entries for other objects stay untouched */
+    Containers::BitArray objects{ValueInit, 33};
+    objects.set(3);
+    objects.set(16);
+
+    const Matrix3 untouched = Matrix3::translation(Vector2{100.0f});
+    const Matrix3 global = Matrix3::scaling(Vector2{0.5f});
+    Matrix3 out[5]{untouched, untouched, untouched, untouched, untouched};
+    Matrix3 outFieldId[5]{untouched, untouched, untouched, untouched, untouched};
+    /* To test both overloads */
+    absoluteFieldTransformations2DInto(scene, Trade::SceneField::Mesh, objects, out);
+    absoluteFieldTransformations2DInto(scene, 2, objects, outFieldId, global);
+
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView<Matrix3>({
+        untouched,
+        Matrix3::translation({1.0f, -1.5f})*
+            Matrix3::rotation(35.0_degf),
+        untouched,
+        Matrix3::translation({1.0f, -1.5f})*
+            Matrix3::rotation(35.0_degf),
+        Matrix3::translation({1.0f, -1.5f})*
+            Matrix3::scaling({3.0f, 5.0f})
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(outFieldId), Containers::arrayView<Matrix3>({
+        untouched,
+        global*
+            Matrix3::translation({1.0f, -1.5f})*
+            Matrix3::rotation(35.0_degf),
+        untouched,
+        global*
+            Matrix3::translation({1.0f, -1.5f})*
+            Matrix3::rotation(35.0_degf),
+        global*
+            Matrix3::translation({1.0f, -1.5f})*
+            Matrix3::scaling({3.0f, 5.0f})
+    }), TestSuite::Compare::Container);
+}
+
+void HierarchyTest::absoluteFieldTransformationsIntoSubset3D() {
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 33, {}, Data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(Data->parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(Data->transforms)
+                .slice(&Scene::Transformation::transformation3D)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(Data->meshes)
+                .slice(&Scene::Mesh::mesh)}
+    }};
+
+    /* Only objects 3 and 16, entries for other objects stay untouched */
+    Containers::BitArray objects{ValueInit, 33};
+    objects.set(3);
+    objects.set(16);
+
+    const Matrix4 untouched = Matrix4::translation(Vector3{100.0f});
+    const Matrix4 global = Matrix4::scaling(Vector3{0.5f});
+    Matrix4 out[5]{untouched, untouched, untouched, untouched, untouched};
+    Matrix4 outFieldId[5]{untouched, untouched, untouched, untouched, untouched};
+    /* To test both overloads */
+    absoluteFieldTransformations3DInto(scene, Trade::SceneField::Mesh, objects, out);
+    absoluteFieldTransformations3DInto(scene, 2, objects, outFieldId, global);
+
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView<Matrix4>({
+        untouched,
+        Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::rotationZ(35.0_degf),
+        untouched,
+        Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::rotationZ(35.0_degf),
+        Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::scaling({3.0f, 5.0f, 2.0f})
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(outFieldId), Containers::arrayView<Matrix4>({
+        untouched,
+        global*
+            Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::rotationZ(35.0_degf),
+        untouched,
+        global*
+            Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::rotationZ(35.0_degf),
+        global*
+            Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::scaling({3.0f, 5.0f, 2.0f})
+    }), TestSuite::Compare::Container);
+}
+
+void HierarchyTest::absoluteFieldTransformationsIntoSubsetInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct Data {
+        UnsignedInt mapping;
+        UnsignedInt mesh;
+    } data[5]{};
+
+    Trade::SceneData scene2D{Trade::SceneMappingType::UnsignedInt, 3, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Int, nullptr},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(data).slice(&Data::mapping),
+            Containers::stridedArrayView(data).slice(&Data::mesh)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix3x3, nullptr}
+    }};
+    Trade::SceneData scene3D{Trade::SceneMappingType::UnsignedInt, 3, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Int, nullptr},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(data).slice(&Data::mapping),
+            Containers::stridedArrayView(data).slice(&Data::mesh)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix4x4, nullptr}
+    }};
+
+    Containers::BitArray objects{ValueInit, 4};
+    Matrix3 transformations2D[5];
+    Matrix4 transformations3D[5];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    absoluteFieldTransformations2DInto(scene2D, Trade::SceneField::Mesh, objects, transformations2D);
+    absoluteFieldTransformations2DInto(scene2D, 1, objects, transformations2D);
+    absoluteFieldTransformations3DInto(scene3D, Trade::SceneField::Mesh, objects, transformations3D);
+    absoluteFieldTransformations3DInto(scene3D, 1, objects, transformations3D);
+    CORRADE_COMPARE(out.str(),
+        "SceneTools::absoluteFieldTransformationsInto(): expected object mask to have 3 bits but got 4\n"
+        "SceneTools::absoluteFieldTransformationsInto(): expected object mask to have 3 bits but got 4\n"
+        "SceneTools::absoluteFieldTransformationsInto(): expected object mask to have 3 bits but got 4\n"
+        "SceneTools::absoluteFieldTransformationsInto(): expected object mask to have 3 bits but got 4\n");
+}
+
+void HierarchyTest::absoluteFieldTransformationsParallel2D() {
+    auto&& data = ParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    WideHierarchy hierarchy{WideHierarchyObjectCount};
+    Trade::SceneData scene = hierarchy.scene2D();
+    const Matrix3 globalTransformation = Matrix3::scaling(Vector2{0.5f});
+
+    Containers::Array<Matrix3> expected = absoluteFieldTransformations2D(scene, Trade::SceneField::Mesh, globalTransformation);
+
+    ParallelFor parallelFor = parallelForReverse;
+    std::size_t threadCount = 4;
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    if(data.threads) parallelFor = parallelForThreads;
+    #endif
+
+    /* The output should be exactly the same as with the serial variant
+       regardless of the execution order, test both the allocating and the
+       *Into() variant */
+    Containers::Array<Matrix3> out = data.fieldIdInsteadOfName ?
+        absoluteFieldTransformations2D(scene, 2, globalTransformation, parallelFor, &threadCount) :
+        absoluteFieldTransformations2D(scene, Trade::SceneField::Mesh, globalTransformation, parallelFor, &threadCount);
+    CORRADE_COMPARE_AS(out, expected, TestSuite::Compare::Container);
+
+    Containers::Array<Matrix3> outInto{NoInit, expected.size()};
+    if(data.fieldIdInsteadOfName)
+        absoluteFieldTransformations2DInto(scene, 2, outInto, globalTransformation, parallelFor, &threadCount);
+    else
+        absoluteFieldTransformations2DInto(scene, Trade::SceneField::Mesh, outInto, globalTransformation, parallelFor, &threadCount);
+    CORRADE_COMPARE_AS(outInto, expected, TestSuite::Compare::Container);
+}
+
+void HierarchyTest::absoluteFieldTransformationsParallel3D() {
+    auto&& data = ParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    WideHierarchy hierarchy{WideHierarchyObjectCount};
+    Trade::SceneData scene = hierarchy.scene3D();
+    const Matrix4 globalTransformation = Matrix4::scaling(Vector3{0.5f});
+
+    Containers::Array<Matrix4> expected = absoluteFieldTransformations3D(scene, Trade::SceneField::Mesh, globalTransformation);
+
+    ParallelFor parallelFor = parallelForReverse;
+    std::size_t threadCount = 4;
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    if(data.threads) parallelFor = parallelForThreads;
+    #endif
+
+    /* The output should be exactly the same as with the serial variant
+       regardless of the execution order, test both the allocating and the
+       *Into() variant */
+    Containers::Array<Matrix4> out = data.fieldIdInsteadOfName ?
+        absoluteFieldTransformations3D(scene, 2, globalTransformation, parallelFor, &threadCount) :
+        absoluteFieldTransformations3D(scene, Trade::SceneField::Mesh, globalTransformation, parallelFor, &threadCount);
+    CORRADE_COMPARE_AS(out, expected, TestSuite::Compare::Container);
+
+    Containers::Array<Matrix4> outInto{NoInit, expected.size()};
+    if(data.fieldIdInsteadOfName)
+        absoluteFieldTransformations3DInto(scene, 2, outInto, globalTransformation, parallelFor, &threadCount);
+    else
+        absoluteFieldTransformations3DInto(scene, Trade::SceneField::Mesh, outInto, globalTransformation, parallelFor, &threadCount);
+    CORRADE_COMPARE_AS(outInto, expected, TestSuite::Compare::Container);
+}
+
+void HierarchyTest::benchmarkAbsoluteFieldTransformations3D() {
+    WideHierarchy hierarchy{1000000};
+    Trade::SceneData scene = hierarchy.scene3D();
+    Containers::Array<Matrix4> out{NoInit, scene.fieldSize(Trade::SceneField::Mesh)};
+
+    CORRADE_BENCHMARK(1)
+        absoluteFieldTransformations3DInto(scene, Trade::SceneField::Mesh, out);
+
+    /* The root object is the first mesh, with no parent transformation */
+    CORRADE_COMPARE(out[0], hierarchy.objects[0].transformation3D);
+}
+
+void HierarchyTest::benchmarkAbsoluteFieldTransformations3DParallel() {
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_SKIP("Threads not used on Emscripten.");
+    #else
+    WideHierarchy hierarchy{1000000};
+    Trade::SceneData scene = hierarchy.scene3D();
+    Containers::Array<Matrix4> out{NoInit, scene.fieldSize(Trade::SceneField::Mesh)};
+
+    std::size_t threadCount = Math::max(std::thread::hardware_concurrency(), 1u);
+    CORRADE_BENCHMARK(1)
+        absoluteFieldTransformations3DInto(scene, Trade::SceneField::Mesh, out, {}, parallelForThreads, &threadCount);
+
+    /* The root object is the first mesh, with no parent transformation */
+    CORRADE_COMPARE(out[0], hierarchy.objects[0].transformation3D);
+    #endif
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneTools::Test::HierarchyTest)
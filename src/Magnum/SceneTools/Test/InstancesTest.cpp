@@ -0,0 +1,264 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/Triple.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/Instances.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct InstancesTest: TestSuite::Tester {
+    explicit InstancesTest();
+
+    void groups();
+    void groupsNoMaterials();
+    void groupsEmpty();
+    void groupsNoMeshField();
+
+    void transformations2D();
+    void transformations3D();
+};
+
+/* Object 1 is a child of 0, the rest are roots. Object 2 has two meshes
+   assigned. */
+struct Scene {
+    struct Parent {
+        UnsignedInt object;
+        Int parent;
+    } parents[6];
+
+    struct Transformation {
+        UnsignedInt object;
+        Matrix4 transformation;
+    } transformations[6];
+
+    struct Mesh {
+        UnsignedInt object;
+        UnsignedInt mesh;
+        Int meshMaterial;
+    } meshes[7];
+};
+
+Scene data() {
+    return Scene{{
+        {0, -1},
+        {1, 0},
+        {2, -1},
+        {3, -1},
+        {4, -1},
+        {5, -1}
+    }, {
+        {0, Matrix4::translation({0.0f, 10.0f, 0.0f})},
+        {1, Matrix4::translation({1.0f, 0.0f, 0.0f})},
+        {2, Matrix4::translation({2.0f, 0.0f, 0.0f})},
+        {3, Matrix4::translation({3.0f, 0.0f, 0.0f})},
+        {4, Matrix4::translation({4.0f, 0.0f, 0.0f})},
+        {5, Matrix4::translation({5.0f, 0.0f, 0.0f})}
+    }, {
+        {2, 1, 0},
+        {0, 0, 2},
+        {3, 1, 0},
+        {1, 0, 2},
+        {4, 0, -1},
+        {5, 1, 1},
+        {2, 0, 2}
+    }};
+}
+
+Trade::SceneData sceneData(const Scene& data, bool materials = true) {
+    Trade::SceneFieldData fields[]{
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(data.parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(data.parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(data.transformations)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(data.transformations)
+                .slice(&Scene::Transformation::transformation)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(data.meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(data.meshes)
+                .slice(&Scene::Mesh::mesh)},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::stridedArrayView(data.meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(data.meshes)
+                .slice(&Scene::Mesh::meshMaterial)}
+    };
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 6, {}, Containers::arrayView(&data, 1), Trade::sceneFieldDataNonOwningArray(Containers::arrayView(fields).prefix(materials ? 4 : 3))};
+}
+
+InstancesTest::InstancesTest() {
+    addTests({&InstancesTest::groups,
+              &InstancesTest::groupsNoMaterials,
+              &InstancesTest::groupsEmpty,
+              &InstancesTest::groupsNoMeshField,
+
+              &InstancesTest::transformations2D,
+              &InstancesTest::transformations3D});
+}
+
+void InstancesTest::groups() {
+    const Scene scene = data();
+    Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<UnsignedInt>> out = meshInstanceGroups(sceneData(scene));
+
+    /* Seven draws reduced to four */
+    CORRADE_COMPARE_AS(out.first(), (Containers::arrayView<Containers::Triple<UnsignedInt, Int, UnsignedInt>>({
+        {0, -1, 1},
+        {0, 2, 3},
+        {1, 0, 2},
+        {1, 1, 1}
+    })), TestSuite::Compare::Container);
+    /* Relative order in each group is preserved */
+    CORRADE_COMPARE_AS(out.second(), Containers::arrayView<UnsignedInt>({
+        4,
+        1, 3, 6,
+        0, 2,
+        5
+    }), TestSuite::Compare::Container);
+}
+
+void InstancesTest::groupsNoMaterials() {
+    const Scene scene = data();
+    Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<UnsignedInt>> out = meshInstanceGroups(sceneData(scene, false));
+
+    CORRADE_COMPARE_AS(out.first(), (Containers::arrayView<Containers::Triple<UnsignedInt, Int, UnsignedInt>>({
+        {0, -1, 4},
+        {1, -1, 3}
+    })), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.second(), Containers::arrayView<UnsignedInt>({
+        1, 3, 4, 6,
+        0, 2, 5
+    }), TestSuite::Compare::Container);
+}
+
+void InstancesTest::groupsEmpty() {
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::UnsignedInt, nullptr}
+    }};
+
+    Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<UnsignedInt>> out = meshInstanceGroups(scene);
+    CORRADE_COMPARE(out.first().size(), 0);
+    CORRADE_COMPARE(out.second().size(), 0);
+}
+
+void InstancesTest::groupsNoMeshField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    meshInstanceGroups(scene);
+    meshInstanceTransformations2D(scene);
+    meshInstanceTransformations3D(scene);
+    CORRADE_COMPARE_AS(out.str(),
+        "SceneTools::meshInstanceGroups(): the scene has no meshes\n"
+        "SceneTools::meshInstanceTransformations2D(): the scene has no meshes\n"
+        "SceneTools::meshInstanceTransformations3D(): the scene has no meshes\n",
+        TestSuite::Compare::String);
+}
+
+void InstancesTest::transformations2D() {
+    const struct Data {
+        UnsignedInt mapping[3];
+        Int parents[3];
+        Matrix3 transformations[3];
+        UnsignedInt meshes[3];
+    } data[]{{
+        {0, 1, 2},
+        {-1, 0, -1},
+        {Matrix3::translation({0.0f, 10.0f}),
+         Matrix3::translation({1.0f, 0.0f}),
+         Matrix3::translation({2.0f, 0.0f})},
+        {3, 0, 3}
+    }};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 3, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->parents)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->transformations)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->meshes)},
+    }};
+
+    const Matrix3 global = Matrix3::scaling(Vector2{2.0f});
+    Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<Matrix3>> out = meshInstanceTransformations2D(scene, global);
+    CORRADE_COMPARE_AS(out.first(), (Containers::arrayView<Containers::Triple<UnsignedInt, Int, UnsignedInt>>({
+        {0, -1, 1},
+        {3, -1, 2}
+    })), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.second(), Containers::arrayView({
+        global*Matrix3::translation({1.0f, 10.0f}),
+        global*Matrix3::translation({0.0f, 10.0f}),
+        global*Matrix3::translation({2.0f, 0.0f})
+    }), TestSuite::Compare::Container);
+}
+
+void InstancesTest::transformations3D() {
+    const Scene scene = data();
+    const Matrix4 global = Matrix4::scaling(Vector3{2.0f});
+    Containers::Pair<Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>>, Containers::Array<Matrix4>> out = meshInstanceTransformations3D(sceneData(scene), global);
+
+    CORRADE_COMPARE_AS(out.first(), (Containers::arrayView<Containers::Triple<UnsignedInt, Int, UnsignedInt>>({
+        {0, -1, 1},
+        {0, 2, 3},
+        {1, 0, 2},
+        {1, 1, 1}
+    })), TestSuite::Compare::Container);
+    /* Entries 4, 1, 3, 6, 0, 2, 5, which are objects 4, 0, 1, 2, 2, 3, 5 */
+    CORRADE_COMPARE_AS(out.second(), Containers::arrayView({
+        global*Matrix4::translation({4.0f, 0.0f, 0.0f}),
+        global*Matrix4::translation({0.0f, 10.0f, 0.0f}),
+        global*Matrix4::translation({1.0f, 10.0f, 0.0f}),
+        global*Matrix4::translation({2.0f, 0.0f, 0.0f}),
+        global*Matrix4::translation({2.0f, 0.0f, 0.0f}),
+        global*Matrix4::translation({3.0f, 0.0f, 0.0f}),
+        global*Matrix4::translation({5.0f, 0.0f, 0.0f})
+    }), TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::InstancesTest)
@@ -0,0 +1,320 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream> /** @todo remove once Debug is stream-free */
+#include <Corrade/Containers/StridedBitArrayView.h>
+#include <Corrade/Containers/StringStl.h> /** @todo remove once Debug is stream-free */
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/DebugStl.h> /** @todo remove once Debug is stream-free */
+
+#include "Magnum/SceneTools/Reorder.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct ReorderTest: TestSuite::Tester {
+    explicit ReorderTest();
+
+    void breadthFirstObjectMapping();
+    void breadthFirstObjectMappingNoHierarchy();
+
+    void objects();
+    void objectsLongParent();
+    void objectsNoHierarchy();
+    void objectsInvalidMapping();
+    void objectsStringField();
+    void objectsBitField();
+};
+
+const struct {
+    const char* name;
+    bool breadthFirst;
+} ObjectsData[]{
+    {"explicit mapping", false},
+    {"breadth-first", true}
+};
+
+ReorderTest::ReorderTest() {
+    addTests({&ReorderTest::breadthFirstObjectMapping,
+              &ReorderTest::breadthFirstObjectMappingNoHierarchy});
+
+    addInstancedTests({&ReorderTest::objects},
+        Containers::arraySize(ObjectsData));
+
+    addTests({&ReorderTest::objectsLongParent,
+              &ReorderTest::objectsNoHierarchy,
+              &ReorderTest::objectsInvalidMapping,
+              &ReorderTest::objectsStringField,
+              &ReorderTest::objectsBitField});
+}
+
+/* Objects 5 and 6 are roots, 2 and 0 are children of 5, 3 is a child of 2.
+   Objects 1 and 4 aren't a part of the hierarchy. Breadth-first that's 5, 6,
+   2, 0, 3, followed by 1 and 4. */
+const struct {
+    UnsignedShort parentMapping[5];
+    Int parents[5];
+    UnsignedShort meshMaterialMapping[4];
+    UnsignedInt meshes[4];
+    Int meshMaterials[4];
+    UnsignedShort customArrayMapping[2];
+    Short customArray[2][2];
+    UnsignedShort customImplicitMapping[3];
+    Float customImplicit[3];
+} HierarchyData[]{{
+    {5, 2, 6, 0, 3},
+    {-1, 5, -1, 5, 2},
+    {3, 5, 3, 1},
+    {10, 20, 30, 40},
+    {-1, 7, 8, 9},
+    {4, 0},
+    {{1, 2}, {3, 4}},
+    {0, 1, 2},
+    {0.5f, 1.5f, 2.5f}
+}};
+
+constexpr UnsignedInt BreadthFirstMapping[]{3, 5, 2, 4, 6, 0, 1};
+
+void ReorderTest::breadthFirstObjectMapping() {
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 7, {}, HierarchyData, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(HierarchyData->parentMapping),
+            Containers::arrayView(HierarchyData->parents)},
+    }};
+
+    CORRADE_COMPARE_AS(SceneTools::breadthFirstObjectMapping(scene),
+        Containers::arrayView(BreadthFirstMapping),
+        TestSuite::Compare::Container);
+}
+
+void ReorderTest::breadthFirstObjectMappingNoHierarchy() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    SceneTools::breadthFirstObjectMapping(scene);
+    CORRADE_COMPARE(out.str(), "SceneTools::breadthFirstObjectMapping(): the scene has no hierarchy\n");
+}
+
+void ReorderTest::objects() {
+    auto&& data = ObjectsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::StridedArrayView1D<const UnsignedShort> meshMaterialMapping = HierarchyData->meshMaterialMapping;
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 7, {}, HierarchyData, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(HierarchyData->parentMapping),
+            Containers::arrayView(HierarchyData->parents)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            meshMaterialMapping,
+            Containers::arrayView(HierarchyData->meshes),
+            /* Verify that other flags get preserved */
+            Trade::SceneFieldFlag::MultiEntry},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            meshMaterialMapping,
+            Containers::arrayView(HierarchyData->meshMaterials)},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(0),
+            Trade::SceneMappingType::UnsignedShort,
+            Containers::arrayView(HierarchyData->customArrayMapping),
+            Trade::SceneFieldType::Short,
+            Containers::arrayView(HierarchyData->customArray), 2},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(1),
+            Containers::arrayView(HierarchyData->customImplicitMapping),
+            Containers::arrayView(HierarchyData->customImplicit),
+            Trade::SceneFieldFlag::ImplicitMapping},
+    }};
+
+    Trade::SceneData reordered = data.breadthFirst ?
+        reorderObjects(scene) :
+        reorderObjects(scene, BreadthFirstMapping);
+    CORRADE_COMPARE(reordered.mappingType(), Trade::SceneMappingType::UnsignedInt);
+    CORRADE_COMPARE(reordered.mappingBound(), 7);
+    CORRADE_COMPARE(reordered.fieldCount(), 5);
+
+    /* Parents are now before their children and siblings are next to each
+       other */
+    CORRADE_COMPARE(reordered.fieldName(0), Trade::SceneField::Parent);
+    CORRADE_COMPARE(reordered.fieldFlags(0), Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE_AS(reordered.mapping<UnsignedInt>(0), Containers::arrayView<UnsignedInt>({
+        0, 1, 2, 3, 4
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(reordered.field<Int>(0), Containers::arrayView<Int>({
+        -1, -1, 0, 0, 2
+    }), TestSuite::Compare::Container);
+
+    /* Order of multiple entries for the same object is preserved, the mapping
+       stays shared */
+    CORRADE_COMPARE(reordered.fieldName(1), Trade::SceneField::Mesh);
+    CORRADE_COMPARE(reordered.fieldFlags(1), Trade::SceneFieldFlag::OrderedMapping|Trade::SceneFieldFlag::MultiEntry);
+    CORRADE_COMPARE_AS(reordered.mapping<UnsignedInt>(1), Containers::arrayView<UnsignedInt>({
+        0, 4, 4, 5
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(reordered.field<UnsignedInt>(1), Containers::arrayView<UnsignedInt>({
+        20, 10, 30, 40
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(reordered.fieldName(2), Trade::SceneField::MeshMaterial);
+    CORRADE_COMPARE(reordered.fieldFlags(2), Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE(reordered.mapping(2).data(), reordered.mapping(1).data());
+    CORRADE_COMPARE_AS(reordered.field<Int>(2), Containers::arrayView<Int>({
+        7, -1, 8, 9
+    }), TestSuite::Compare::Container);
+
+    /* Array fields are reordered as whole */
+    CORRADE_COMPARE(reordered.fieldName(3), Trade::sceneFieldCustom(0));
+    CORRADE_COMPARE(reordered.fieldArraySize(3), 2);
+    CORRADE_COMPARE_AS(reordered.mapping<UnsignedInt>(3), Containers::arrayView<UnsignedInt>({
+        3, 6
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS((reordered.field<Short[]>(3).transposed<0, 1>()[0]), Containers::arrayView<Short>({
+        3, 1
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS((reordered.field<Short[]>(3).transposed<0, 1>()[1]), Containers::arrayView<Short>({
+        4, 2
+    }), TestSuite::Compare::Container);
+
+    /* Implicit mapping is only ordered now */
+    CORRADE_COMPARE(reordered.fieldName(4), Trade::sceneFieldCustom(1));
+    CORRADE_COMPARE(reordered.fieldFlags(4), Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE_AS(reordered.mapping<UnsignedInt>(4), Containers::arrayView<UnsignedInt>({
+        2, 3, 5
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(reordered.field<Float>(4), Containers::arrayView<Float>({
+        2.5f, 0.5f, 1.5f
+    }), TestSuite::Compare::Container);
+}
+
+void ReorderTest::objectsLongParent() {
+    const struct {
+        UnsignedInt mapping[3];
+        Long parents[3];
+    } data[]{{
+        {2, 0, 1},
+        {-1, 2, 0}
+    }};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 3, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->parents)},
+    }};
+
+    Trade::SceneData reordered = reorderObjects(scene);
+    CORRADE_COMPARE(reordered.fieldType(Trade::SceneField::Parent), Trade::SceneFieldType::Long);
+    CORRADE_COMPARE_AS(reordered.mapping<UnsignedInt>(Trade::SceneField::Parent), Containers::arrayView<UnsignedInt>({
+        0, 1, 2
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(reordered.field<Long>(Trade::SceneField::Parent), Containers::arrayView<Long>({
+        -1, 0, 1
+    }), TestSuite::Compare::Container);
+}
+
+void ReorderTest::objectsNoHierarchy() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    reorderObjects(scene);
+    CORRADE_COMPARE(out.str(), "SceneTools::reorderObjects(): the scene has no hierarchy\n");
+}
+
+void ReorderTest::objectsInvalidMapping() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 3, nullptr, {}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    reorderObjects(scene, Containers::arrayView<UnsignedInt>({0, 1}));
+    reorderObjects(scene, Containers::arrayView<UnsignedInt>({0, 3, 1}));
+    reorderObjects(scene, Containers::arrayView<UnsignedInt>({2, 0, 2}));
+    CORRADE_COMPARE_AS(out.str(),
+        "SceneTools::reorderObjects(): expected 3 mapping items but got 2\n"
+        "SceneTools::reorderObjects(): mapping 3 for object 1 is out of range or not unique\n"
+        "SceneTools::reorderObjects(): mapping 2 for object 2 is out of range or not unique\n",
+        TestSuite::Compare::String);
+}
+
+void ReorderTest::objectsStringField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const struct {
+        UnsignedShort meshMapping[5];
+        UnsignedByte mesh[5];
+        UnsignedShort nameMapping[2];
+        UnsignedInt nameRangeNullTerminated[2];
+        char nameString[1];
+    } data[1]{};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 3, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->meshMapping),
+            Containers::arrayView(data->mesh)},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(15),
+            Containers::arrayView(data->nameMapping),
+            data->nameString, Trade::SceneFieldType::StringRangeNullTerminated32,
+            Containers::arrayView(data->nameRangeNullTerminated)},
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    reorderObjects(scene, Containers::arrayView<UnsignedInt>({2, 1, 0}));
+    CORRADE_COMPARE(out.str(), "SceneTools::reorderObjects(): reordering string fields is not implemented yet, sorry\n");
+}
+
+void ReorderTest::objectsBitField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const struct {
+        UnsignedShort meshMapping[5];
+        UnsignedByte mesh[5];
+        UnsignedShort visibilityMapping[2];
+        bool visible[2];
+    } data[1]{};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 3, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->meshMapping),
+            Containers::arrayView(data->mesh)},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(15),
+            Containers::arrayView(data->visibilityMapping),
+            Containers::stridedArrayView(data->visible).sliceBit(0)},
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    reorderObjects(scene, Containers::arrayView<UnsignedInt>({2, 1, 0}));
+    CORRADE_COMPARE(out.str(), "SceneTools::reorderObjects(): reordering bit fields is not implemented yet, sorry\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::ReorderTest)
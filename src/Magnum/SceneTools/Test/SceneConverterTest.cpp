@@ -599,6 +599,47 @@ const struct {
         "    65536 -> 65536 covered pixels\n"
         "    overdraw 1 -> 1\n"
         "Trade::AbstractSceneConverter::addImporterContents(): adding scene 0 out of 1\n"},
+    {"mesh converter, two meshes, two threads, verbose", {InPlaceInit, {
+            /* Removing the generator identifier for a smaller file */
+            "-I", "GltfImporter", "-C", "GltfSceneConverter", "-c", "generator=",
+            "-M", "MeshOptimizerSceneConverter", "--threads", "2", "-v",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/two-quads.gltf"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/two-quads.gltf")
+        }},
+        "GltfImporter", nullptr, "GltfSceneConverter",
+        {}, "MeshOptimizerSceneConverter",
+        "two-quads.gltf", "two-quads.bin",
+        /* The output is buffered and printed in order, so it's the same as
+           with a single thread */
+        "Processing mesh 0 with MeshOptimizerSceneConverter...\n"
+        "Trade::MeshOptimizerSceneConverter::convert(): processing stats:\n"
+        "  vertex cache:\n"
+        "    4 -> 4 transformed vertices\n"
+        "    1 -> 1 executed warps\n"
+        "    ACMR 2 -> 2\n"
+        "    ATVR 1 -> 1\n"
+        "  vertex fetch:\n"
+        "    64 -> 64 bytes fetched\n"
+        "    overfetch 1.33333 -> 1.33333\n"
+        "  overdraw:\n"
+        "    65536 -> 65536 shaded pixels\n"
+        "    65536 -> 65536 covered pixels\n"
+        "    overdraw 1 -> 1\n"
+        "Processing mesh 1 with MeshOptimizerSceneConverter...\n"
+        "Trade::MeshOptimizerSceneConverter::convert(): processing stats:\n"
+        "  vertex cache:\n"
+        "    4 -> 4 transformed vertices\n"
+        "    1 -> 1 executed warps\n"
+        "    ACMR 2 -> 2\n"
+        "    ATVR 1 -> 1\n"
+        "  vertex fetch:\n"
+        "    64 -> 64 bytes fetched\n"
+        "    overfetch 1.33333 -> 1.33333\n"
+        "  overdraw:\n"
+        "    65536 -> 65536 shaded pixels\n"
+        "    65536 -> 65536 covered pixels\n"
+        "    overdraw 1 -> 1\n"
+        "Trade::AbstractSceneConverter::addImporterContents(): adding scene 0 out of 1\n"},
     {"two mesh converters, two options, one mesh, verbose", {InPlaceInit, {
             /* Unfortunately *have to* use an option to make the output
                predictable. Using --set instead of -c as that's less context
@@ -688,6 +729,22 @@ const struct {
         "Processing 2D image 0 with StbResizeImageConverter...\n"
         "Trade::AnyImageImporter::openFile(): using PngImporter\n"
         "Processing 2D image 1 with StbResizeImageConverter...\n"},
+    {"2D image converter, two images, two threads, verbose", {InPlaceInit, {
+            "-I", "GltfImporter", "-C", "GltfSceneConverter",
+            "-P", "StbResizeImageConverter", "-p", "size=\"1 1\"",
+            /* Removing the generator identifier for a smaller file, bundling
+               the images to avoid having too many files */
+            "-c", "bundleImages,generator=", "--threads", "2", "-v",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/images-2d.gltf"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/images-2d-1x1.gltf")
+        }},
+        "GltfImporter", "PngImporter", "GltfSceneConverter",
+        {"StbResizeImageConverter", "PngImageConverter"}, nullptr,
+        "images-2d-1x1.gltf", "images-2d-1x1.bin",
+        "Trade::AnyImageImporter::openFile(): using PngImporter\n"
+        "Processing 2D image 0 with StbResizeImageConverter...\n"
+        "Trade::AnyImageImporter::openFile(): using PngImporter\n"
+        "Processing 2D image 1 with StbResizeImageConverter...\n"},
     {"two 2D image converters, two images, verbose", {InPlaceInit, {
             "-I", "GltfImporter", "-C", "GltfSceneConverter",
             "-P", "StbResizeImageConverter", "-p", "size=\"2 2\"",
@@ -780,9 +837,8 @@ const struct {
         }},
         "UfbxImporter", "PngImporter", "GltfSceneConverter", {"PngImageConverter", nullptr}, nullptr,
         "materials-pbr.gltf", nullptr,
-        "Converting material 0 to PBR\n"
+        "Converting 2 materials to PBR\n"
         "MaterialTools::phongToPbrMetallicRoughness(): unconvertible Trade::MaterialAttribute::AmbientColor attribute, skipping\n"
-        "Converting material 1 to PBR\n"
         "Trade::AbstractSceneConverter::addImporterContents(): adding 2D image 0 out of 2\n"
         "Trade::AnyImageImporter::openFile(): using PngImporter\n"
         "Trade::AbstractSceneConverter::addImporterContents(): adding 2D image 1 out of 2\n"
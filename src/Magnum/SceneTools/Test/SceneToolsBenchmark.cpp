@@ -0,0 +1,155 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/Triple.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/Filter.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/SceneTools/Instances.h"
+#include "Magnum/SceneTools/Reorder.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+/* Covers the operations done on a scene after import on a scene with a
+   moderately deep hierarchy, to catch performance regressions in the whole
+   library rather than in particular algorithms */
+
+struct SceneToolsBenchmark: TestSuite::Tester {
+    explicit SceneToolsBenchmark();
+
+    void parentsBreadthFirst();
+    void childrenDepthFirst();
+    void absoluteFieldTransformations3D();
+    void meshInstanceTransformations3D();
+    void reorderObjects();
+    void filterExceptFields();
+
+    struct Object {
+        UnsignedInt object;
+        Int parent;
+        Matrix4 transformation;
+        UnsignedInt mesh;
+    };
+
+    Containers::Array<Object> _objects;
+    Trade::SceneData _scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}};
+};
+
+enum: std::size_t { ObjectCount = 10000 };
+
+SceneToolsBenchmark::SceneToolsBenchmark() {
+    addBenchmarks({&SceneToolsBenchmark::parentsBreadthFirst,
+                   &SceneToolsBenchmark::childrenDepthFirst,
+                   &SceneToolsBenchmark::absoluteFieldTransformations3D,
+                   &SceneToolsBenchmark::meshInstanceTransformations3D,
+                   &SceneToolsBenchmark::reorderObjects,
+                   &SceneToolsBenchmark::filterExceptFields}, 10);
+
+    /* Each object has eight children. The objects are stored in reverse
+       order so the parents are always after their children, which is the
+       worst case for the hierarchy processing. */
+    _objects = Containers::Array<Object>{NoInit, ObjectCount};
+    for(std::size_t i = 0; i != ObjectCount; ++i) {
+        const UnsignedInt object = ObjectCount - i - 1;
+        _objects[i].object = object;
+        _objects[i].parent = object == 0 ? -1 : Int((object - 1)/8);
+        _objects[i].transformation =
+            Matrix4::translation({Float(object % 5), 0.5f, -0.25f})*
+            Matrix4::rotationY(Deg(Float(object % 7)));
+        _objects[i].mesh = object % 17;
+    }
+
+    const Containers::StridedArrayView1D<const Object> objects = _objects;
+    _scene = Trade::SceneData{Trade::SceneMappingType::UnsignedInt, ObjectCount, {}, _objects, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            objects.slice(&Object::object),
+            objects.slice(&Object::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            objects.slice(&Object::object),
+            objects.slice(&Object::transformation)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            objects.slice(&Object::object),
+            objects.slice(&Object::mesh)}
+    }};
+}
+
+void SceneToolsBenchmark::parentsBreadthFirst() {
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(10)
+        count += SceneTools::parentsBreadthFirst(_scene).size();
+
+    CORRADE_COMPARE(count, 10*ObjectCount);
+}
+
+void SceneToolsBenchmark::childrenDepthFirst() {
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(10)
+        count += SceneTools::childrenDepthFirst(_scene).size();
+
+    CORRADE_COMPARE(count, 10*ObjectCount);
+}
+
+void SceneToolsBenchmark::absoluteFieldTransformations3D() {
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(10)
+        count += SceneTools::absoluteFieldTransformations3D(_scene, Trade::SceneField::Mesh).size();
+
+    CORRADE_COMPARE(count, 10*ObjectCount);
+}
+
+void SceneToolsBenchmark::meshInstanceTransformations3D() {
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(10)
+        count += SceneTools::meshInstanceTransformations3D(_scene).second().size();
+
+    CORRADE_COMPARE(count, 10*ObjectCount);
+}
+
+void SceneToolsBenchmark::reorderObjects() {
+    UnsignedLong mappingBound = 0;
+    CORRADE_BENCHMARK(10)
+        mappingBound += SceneTools::reorderObjects(_scene).mappingBound();
+
+    CORRADE_COMPARE(mappingBound, 10*ObjectCount);
+}
+
+void SceneToolsBenchmark::filterExceptFields() {
+    UnsignedInt fieldCount = 0;
+    CORRADE_BENCHMARK(10)
+        fieldCount += SceneTools::filterExceptFields(_scene, {Trade::SceneField::Mesh}).fieldCount();
+
+    CORRADE_COMPARE(fieldCount, 10*2);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::SceneToolsBenchmark)
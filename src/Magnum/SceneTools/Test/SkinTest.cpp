@@ -0,0 +1,219 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Instances.h"
+
+#include <sstream>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/Skin.h"
+#include "Magnum/Trade/SkinData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+using namespace Math::Literals;
+
+struct SkinTest: TestSuite::Tester {
+    explicit SkinTest();
+
+    void jointCount();
+
+    void jointMatrices2D();
+    void jointMatrices3D();
+    void jointMatricesInto();
+    void jointMatricesEmpty();
+
+    void jointMatricesInvalidSize();
+    void jointMatricesJointOutOfBounds();
+};
+
+SkinTest::SkinTest() {
+    addTests({&SkinTest::jointCount,
+
+              &SkinTest::jointMatrices2D,
+              &SkinTest::jointMatrices3D,
+              &SkinTest::jointMatricesInto,
+              &SkinTest::jointMatricesEmpty,
+
+              &SkinTest::jointMatricesInvalidSize,
+              &SkinTest::jointMatricesJointOutOfBounds});
+}
+
+void SkinTest::jointCount() {
+    const Trade::SkinData2D skins2D[]{
+        Trade::SkinData2D{{0, 1}, {{}, {}}},
+        Trade::SkinData2D{{}, {}},
+        Trade::SkinData2D{{3, 1, 2}, {{}, {}, {}}}
+    };
+    const Trade::SkinData3D skins3D[]{
+        Trade::SkinData3D{{5}, {{}}},
+        Trade::SkinData3D{{0, 1, 2, 3}, {{}, {}, {}, {}}}
+    };
+    CORRADE_COMPARE(skinJointCount2D(skins2D), 5);
+    CORRADE_COMPARE(skinJointCount3D(skins3D), 5);
+    CORRADE_COMPARE(skinJointCount3D(nullptr), 0);
+}
+
+void SkinTest::jointMatrices2D() {
+    const Matrix3 absolute[]{
+        Matrix3::translation({1.0f, 0.0f}),
+        Matrix3::translation({0.0f, 2.0f}),
+        Matrix3::scaling(Vector2{3.0f}),
+    };
+    const Trade::SkinData2D skins[]{
+        Trade::SkinData2D{{2, 0}, {
+            Matrix3::translation({-1.0f, 0.0f}),
+            Matrix3::rotation(90.0_degf)
+        }},
+        Trade::SkinData2D{{1}, {
+            Matrix3::scaling(Vector2{0.5f})
+        }}
+    };
+
+    CORRADE_COMPARE_AS(skinJointMatrices2D(skins, absolute), Containers::arrayView({
+        Matrix3::scaling(Vector2{3.0f})*Matrix3::translation({-1.0f, 0.0f}),
+        Matrix3::translation({1.0f, 0.0f})*Matrix3::rotation(90.0_degf),
+        Matrix3::translation({0.0f, 2.0f})*Matrix3::scaling(Vector2{0.5f})
+    }), TestSuite::Compare::Container);
+}
+
+void SkinTest::jointMatrices3D() {
+    const Matrix4 absolute[]{
+        Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        Matrix4::translation({0.0f, 2.0f, 0.0f}),
+        Matrix4::scaling(Vector3{3.0f}),
+        Matrix4::rotationZ(45.0_degf)
+    };
+    const Trade::SkinData3D skins[]{
+        Trade::SkinData3D{{3, 0}, {
+            Matrix4::translation({-1.0f, 0.0f, 0.0f}),
+            Matrix4::rotationX(90.0_degf)
+        }},
+        Trade::SkinData3D{{}, {}},
+        Trade::SkinData3D{{1, 2, 1}, {
+            Matrix4::scaling(Vector3{0.5f}),
+            Matrix4::translation({0.0f, 0.0f, 5.0f}),
+            Matrix4{}
+        }}
+    };
+
+    CORRADE_COMPARE_AS(skinJointMatrices3D(skins, absolute), Containers::arrayView({
+        Matrix4::rotationZ(45.0_degf)*Matrix4::translation({-1.0f, 0.0f, 0.0f}),
+        Matrix4::translation({1.0f, 0.0f, 0.0f})*Matrix4::rotationX(90.0_degf),
+        Matrix4::translation({0.0f, 2.0f, 0.0f})*Matrix4::scaling(Vector3{0.5f}),
+        Matrix4::scaling(Vector3{3.0f})*Matrix4::translation({0.0f, 0.0f, 5.0f}),
+        Matrix4::translation({0.0f, 2.0f, 0.0f})
+    }), TestSuite::Compare::Container);
+}
+
+void SkinTest::jointMatricesInto() {
+    /* Absolute transformations coming from a strided view, such as a field in
+       a larger struct */
+    const struct Object {
+        UnsignedInt id;
+        Matrix4 transformation;
+    } objects[]{
+        {0, Matrix4::translation({1.0f, 0.0f, 0.0f})},
+        {1, Matrix4::scaling(Vector3{2.0f})}
+    };
+    const Trade::SkinData3D skins[]{
+        Trade::SkinData3D{{1, 0}, {
+            Matrix4::translation({0.0f, 1.0f, 0.0f}),
+            Matrix4::translation({0.0f, 0.0f, 1.0f})
+        }}
+    };
+
+    Matrix4 out[2];
+    skinJointMatrices3DInto(skins, Containers::stridedArrayView(objects).slice(&Object::transformation), out);
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({
+        Matrix4::scaling(Vector3{2.0f})*Matrix4::translation({0.0f, 1.0f, 0.0f}),
+        Matrix4::translation({1.0f, 0.0f, 1.0f})
+    }), TestSuite::Compare::Container);
+}
+
+void SkinTest::jointMatricesEmpty() {
+    CORRADE_COMPARE(skinJointMatrices2D(nullptr, nullptr).size(), 0);
+    CORRADE_COMPARE(skinJointMatrices3D(nullptr, nullptr).size(), 0);
+}
+
+void SkinTest::jointMatricesInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::SkinData2D skins2D[]{
+        Trade::SkinData2D{{0, 0}, {{}, {}}}
+    };
+    const Trade::SkinData3D skins3D[]{
+        Trade::SkinData3D{{0}, {{}}},
+        Trade::SkinData3D{{0, 0}, {{}, {}}}
+    };
+    const Matrix3 absolute2D[1];
+    const Matrix4 absolute3D[1];
+    Matrix3 out2D[3];
+    Matrix4 out3D[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    skinJointMatrices2DInto(skins2D, absolute2D, out2D);
+    skinJointMatrices3DInto(skins3D, absolute3D, out3D);
+    CORRADE_COMPARE_AS(out.str(),
+        "SceneTools::skinJointMatrices2DInto(): expected output view to have 2 elements but got 3\n"
+        "SceneTools::skinJointMatrices3DInto(): expected output view to have 3 elements but got 2\n",
+        TestSuite::Compare::String);
+}
+
+void SkinTest::jointMatricesJointOutOfBounds() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Trade::SkinData2D skins2D[]{
+        Trade::SkinData2D{{0, 3}, {{}, {}}}
+    };
+    const Trade::SkinData3D skins3D[]{
+        Trade::SkinData3D{{0}, {{}}},
+        Trade::SkinData3D{{1, 2}, {{}, {}}}
+    };
+    const Matrix3 absolute2D[3];
+    const Matrix4 absolute3D[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    skinJointMatrices2D(skins2D, absolute2D);
+    skinJointMatrices3D(skins3D, absolute3D);
+    CORRADE_COMPARE_AS(out.str(),
+        "SceneTools::skinJointMatrices2D(): joint 1 of skin 0 references object 3 but only 3 absolute transformations were passed\n"
+        "SceneTools::skinJointMatrices3D(): joint 1 of skin 1 references object 2 but only 2 absolute transformations were passed\n",
+        TestSuite::Compare::String);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::SkinTest)
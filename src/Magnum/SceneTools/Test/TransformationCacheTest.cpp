@@ -0,0 +1,380 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/TransformationCache.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct TransformationCacheTest: TestSuite::Tester {
+    explicit TransformationCacheTest();
+
+    void construct();
+    void constructNot3D();
+    void constructNoParentField();
+    void constructCopy();
+    void constructMove();
+
+    void setTransformation();
+    void setTransformationNested();
+    void setTransformationNotInHierarchy();
+    void setTransformationOutOfRange();
+    void setTransformations();
+    void setTransformationsInvalidSize();
+    void setGlobalTransformation();
+};
+
+using namespace Math::Literals;
+
+/* Object 2 is a child of 1, which is a child of 0 together with 3. Object 4
+   is another root, 5 has a transformation but isn't in the hierarchy and 6
+   has neither. */
+struct Scene {
+    struct Parent {
+        UnsignedInt object;
+        Int parent;
+    } parents[5];
+
+    struct Transformation {
+        UnsignedInt object;
+        Matrix4 transformation;
+    } transformations[6];
+};
+
+Scene data() {
+    return Scene{{
+        {3, 0},
+        {0, -1},
+        {2, 1},
+        {4, -1},
+        {1, 0}
+    }, {
+        {0, Matrix4::translation({1.0f, -1.5f, 0.5f})},
+        {1, Matrix4::rotationZ(35.0_degf)},
+        {2, Matrix4::scaling({3.0f, 5.0f, 2.0f})},
+        {3, Matrix4::translation({0.0f, 2.0f, 0.0f})},
+        {4, Matrix4::rotationX(90.0_degf)},
+        {5, Matrix4::translation({7.0f, 0.0f, 0.0f})}
+    }};
+}
+
+Trade::SceneData sceneData(const Scene& data) {
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 7, {}, Containers::arrayView(&data, 1), {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(data.parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(data.parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(data.transformations)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(data.transformations)
+                .slice(&Scene::Transformation::transformation)}
+    }};
+}
+
+TransformationCacheTest::TransformationCacheTest() {
+    addTests({&TransformationCacheTest::construct,
+              &TransformationCacheTest::constructNot3D,
+              &TransformationCacheTest::constructNoParentField,
+              &TransformationCacheTest::constructCopy,
+              &TransformationCacheTest::constructMove,
+
+              &TransformationCacheTest::setTransformation,
+              &TransformationCacheTest::setTransformationNested,
+              &TransformationCacheTest::setTransformationNotInHierarchy,
+              &TransformationCacheTest::setTransformationOutOfRange,
+              &TransformationCacheTest::setTransformations,
+              &TransformationCacheTest::setTransformationsInvalidSize,
+              &TransformationCacheTest::setGlobalTransformation});
+}
+
+void TransformationCacheTest::construct() {
+    const Scene scene = data();
+    const Matrix4 global = Matrix4::scaling(Vector3{0.5f});
+    TransformationCache3D cache{sceneData(scene), global};
+    CORRADE_COMPARE(cache.objectCount(), 7);
+    CORRADE_COMPARE(cache.globalTransformation(), global);
+    CORRADE_VERIFY(!cache.isDirty());
+
+    CORRADE_COMPARE_AS(cache.transformations(), Containers::arrayView({
+        Matrix4::translation({1.0f, -1.5f, 0.5f}),
+        Matrix4::rotationZ(35.0_degf),
+        Matrix4::scaling({3.0f, 5.0f, 2.0f}),
+        Matrix4::translation({0.0f, 2.0f, 0.0f}),
+        Matrix4::rotationX(90.0_degf),
+        Matrix4::translation({7.0f, 0.0f, 0.0f}),
+        Matrix4{}
+    }), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE_AS(cache.absoluteTransformations(), Containers::arrayView({
+        global*
+            Matrix4::translation({1.0f, -1.5f, 0.5f}),
+        global*
+            Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::rotationZ(35.0_degf),
+        global*
+            Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::rotationZ(35.0_degf)*
+            Matrix4::scaling({3.0f, 5.0f, 2.0f}),
+        global*
+            Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::translation({0.0f, 2.0f, 0.0f}),
+        global*
+            Matrix4::rotationX(90.0_degf),
+        /* Not a part of the hierarchy, global transformation not applied */
+        Matrix4::translation({7.0f, 0.0f, 0.0f}),
+        Matrix4{}
+    }), TestSuite::Compare::Container);
+}
+
+void TransformationCacheTest::constructNot3D() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Int, nullptr}
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    TransformationCache3D{scene};
+    CORRADE_COMPARE(out.str(), "SceneTools::TransformationCache3D: the scene is not 3D\n");
+}
+
+void TransformationCacheTest::constructNoParentField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix4x4, nullptr}
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    TransformationCache3D{scene};
+    CORRADE_COMPARE(out.str(), "SceneTools::TransformationCache3D: the scene has no hierarchy\n");
+}
+
+void TransformationCacheTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<TransformationCache3D>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<TransformationCache3D>{});
+}
+
+void TransformationCacheTest::constructMove() {
+    const Scene scene = data();
+    TransformationCache3D a{sceneData(scene)};
+    a.setTransformation(1, Matrix4::scaling(Vector3{2.0f}));
+
+    TransformationCache3D b{Utility::move(a)};
+    CORRADE_COMPARE(b.objectCount(), 7);
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_COMPARE(b.update(), 2);
+    CORRADE_COMPARE(b.absoluteTransformations()[1],
+        Matrix4::translation({1.0f, -1.5f, 0.5f})*
+        Matrix4::scaling(Vector3{2.0f}));
+
+    const Scene scene2 = data();
+    TransformationCache3D c{sceneData(scene2)};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.objectCount(), 7);
+    CORRADE_VERIFY(!c.isDirty());
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<TransformationCache3D>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<TransformationCache3D>::value);
+}
+
+void TransformationCacheTest::setTransformation() {
+    const Scene scene = data();
+    TransformationCache3D cache{sceneData(scene)};
+
+    const Matrix4 transformation = Matrix4::translation({0.0f, 0.0f, 3.0f});
+    CORRADE_COMPARE(&cache.setTransformation(1, transformation), &cache);
+    CORRADE_VERIFY(cache.isDirty());
+    CORRADE_COMPARE(cache.transformations()[1], transformation);
+
+    /* The absolute transformation isn't updated until update() is called */
+    CORRADE_COMPARE(cache.absoluteTransformations()[1],
+        Matrix4::translation({1.0f, -1.5f, 0.5f})*
+        Matrix4::rotationZ(35.0_degf));
+
+    /* Only the object and its single child get updated */
+    CORRADE_COMPARE(cache.update(), 2);
+    CORRADE_VERIFY(!cache.isDirty());
+    CORRADE_COMPARE_AS(cache.absoluteTransformations(), Containers::arrayView({
+        Matrix4::translation({1.0f, -1.5f, 0.5f}),
+        Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            transformation,
+        Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            transformation*
+            Matrix4::scaling({3.0f, 5.0f, 2.0f}),
+        Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::translation({0.0f, 2.0f, 0.0f}),
+        Matrix4::rotationX(90.0_degf),
+        Matrix4::translation({7.0f, 0.0f, 0.0f}),
+        Matrix4{}
+    }), TestSuite::Compare::Container);
+
+    /* Updating again does nothing */
+    CORRADE_COMPARE(cache.update(), 0);
+}
+
+void TransformationCacheTest::setTransformationNested() {
+    const Scene scene = data();
+    TransformationCache3D cache{sceneData(scene)};
+
+    /* Object 2 is in the subtree of 0 and thus gets updated only once, same
+       for the duplicate 0 */
+    cache.setTransformation(2, Matrix4::scaling(Vector3{2.0f}))
+         .setTransformation(0, Matrix4::translation({0.0f, 1.0f, 0.0f}))
+         .setTransformation(4, Matrix4::rotationY(90.0_degf))
+         .setTransformation(0, Matrix4::translation({1.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(cache.update(), 5);
+    CORRADE_COMPARE_AS(cache.absoluteTransformations(), Containers::arrayView({
+        Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        Matrix4::translation({1.0f, 0.0f, 0.0f})*
+            Matrix4::rotationZ(35.0_degf),
+        Matrix4::translation({1.0f, 0.0f, 0.0f})*
+            Matrix4::rotationZ(35.0_degf)*
+            Matrix4::scaling(Vector3{2.0f}),
+        Matrix4::translation({1.0f, 0.0f, 0.0f})*
+            Matrix4::translation({0.0f, 2.0f, 0.0f}),
+        Matrix4::rotationY(90.0_degf),
+        Matrix4::translation({7.0f, 0.0f, 0.0f}),
+        Matrix4{}
+    }), TestSuite::Compare::Container);
+}
+
+void TransformationCacheTest::setTransformationNotInHierarchy() {
+    const Scene scene = data();
+    TransformationCache3D cache{sceneData(scene), Matrix4::scaling(Vector3{0.5f})};
+
+    /* Objects outside of the hierarchy get updated right away, without the
+       global transformation applied */
+    cache.setTransformation(5, Matrix4::translation({0.0f, 7.0f, 0.0f}))
+         .setTransformation(6, Matrix4::rotationX(45.0_degf));
+    CORRADE_VERIFY(!cache.isDirty());
+    CORRADE_COMPARE(cache.absoluteTransformations()[5], Matrix4::translation({0.0f, 7.0f, 0.0f}));
+    CORRADE_COMPARE(cache.absoluteTransformations()[6], Matrix4::rotationX(45.0_degf));
+    CORRADE_COMPARE(cache.update(), 0);
+}
+
+void TransformationCacheTest::setTransformationOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Scene scene = data();
+    TransformationCache3D cache{sceneData(scene)};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    cache.setTransformation(7, {});
+    CORRADE_COMPARE(out.str(), "SceneTools::TransformationCache3D::setTransformation(): index 7 out of range for 7 objects\n");
+}
+
+void TransformationCacheTest::setTransformations() {
+    const Scene scene = data();
+    TransformationCache3D cache{sceneData(scene)};
+
+    const UnsignedInt objects[]{5, 1, 3};
+    const Matrix4 transformations[]{
+        Matrix4::translation({0.0f, 7.0f, 0.0f}),
+        Matrix4::scaling(Vector3{2.0f}),
+        Matrix4::rotationY(90.0_degf)
+    };
+    CORRADE_COMPARE(&cache.setTransformations(objects, transformations), &cache);
+    CORRADE_VERIFY(cache.isDirty());
+    CORRADE_COMPARE(cache.update(), 3);
+    CORRADE_COMPARE_AS(cache.absoluteTransformations(), Containers::arrayView({
+        Matrix4::translation({1.0f, -1.5f, 0.5f}),
+        Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::scaling(Vector3{2.0f}),
+        Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::scaling(Vector3{2.0f})*
+            Matrix4::scaling({3.0f, 5.0f, 2.0f}),
+        Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::rotationY(90.0_degf),
+        Matrix4::rotationX(90.0_degf),
+        Matrix4::translation({0.0f, 7.0f, 0.0f}),
+        Matrix4{}
+    }), TestSuite::Compare::Container);
+}
+
+void TransformationCacheTest::setTransformationsInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Scene scene = data();
+    TransformationCache3D cache{sceneData(scene)};
+
+    const UnsignedInt objects[3]{};
+    const Matrix4 transformations[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    cache.setTransformations(objects, transformations);
+    CORRADE_COMPARE(out.str(), "SceneTools::TransformationCache3D::setTransformations(): expected the object and transformation views to have the same size but got 3 and 2\n");
+}
+
+void TransformationCacheTest::setGlobalTransformation() {
+    const Scene scene = data();
+    TransformationCache3D cache{sceneData(scene)};
+
+    const Matrix4 global = Matrix4::scaling(Vector3{0.5f});
+    CORRADE_COMPARE(&cache.setGlobalTransformation(global), &cache);
+    CORRADE_COMPARE(cache.globalTransformation(), global);
+    CORRADE_VERIFY(cache.isDirty());
+
+    /* The whole hierarchy gets updated, objects outside of it not */
+    CORRADE_COMPARE(cache.update(), 5);
+    CORRADE_VERIFY(!cache.isDirty());
+    CORRADE_COMPARE_AS(cache.absoluteTransformations(), Containers::arrayView({
+        global*
+            Matrix4::translation({1.0f, -1.5f, 0.5f}),
+        global*
+            Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::rotationZ(35.0_degf),
+        global*
+            Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::rotationZ(35.0_degf)*
+            Matrix4::scaling({3.0f, 5.0f, 2.0f}),
+        global*
+            Matrix4::translation({1.0f, -1.5f, 0.5f})*
+            Matrix4::translation({0.0f, 2.0f, 0.0f}),
+        global*
+            Matrix4::rotationX(90.0_degf),
+        Matrix4::translation({7.0f, 0.0f, 0.0f}),
+        Matrix4{}
+    }), TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::TransformationCacheTest)
@@ -0,0 +1,151 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TransformationCache.h"
+
+#include <algorithm>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+TransformationCache3D::TransformationCache3D(const Trade::SceneData& scene, const Matrix4& globalTransformation): _globalTransformation{globalTransformation} {
+    CORRADE_ASSERT(scene.is3D(),
+        "SceneTools::TransformationCache3D: the scene is not 3D", );
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Parent),
+        "SceneTools::TransformationCache3D: the scene has no hierarchy", );
+
+    const std::size_t objectCount = scene.mappingBound();
+    _childrenDepthFirst = childrenDepthFirst(scene);
+
+    _depthFirstPositions = Containers::Array<UnsignedInt>{DirectInit, objectCount, ~UnsignedInt{}};
+    for(std::size_t i = 0; i != _childrenDepthFirst.size(); ++i)
+        _depthFirstPositions[_childrenDepthFirst[i].first()] = i;
+
+    /* Objects that aren't in the hierarchy stay at -1, which is fine as
+       their parent is never queried */
+    _parents = Containers::Array<Int>{DirectInit, objectCount, -1};
+    for(const Containers::Pair<UnsignedInt, Int>& parent: scene.parentsAsArray())
+        _parents[parent.first()] = parent.second();
+
+    /* Objects without a transformation are identity */
+    _transformations = Containers::Array<Matrix4>{ValueInit, objectCount};
+    for(const Containers::Pair<UnsignedInt, Matrix4>& transformation: scene.transformations3DAsArray())
+        _transformations[transformation.first()] = transformation.second();
+
+    /* Objects outside of the hierarchy have the local transformation as the
+       absolute one, the rest gets calculated below */
+    _absoluteTransformations = Containers::Array<Matrix4>{NoInit, objectCount};
+    Utility::copy(_transformations, _absoluteTransformations);
+    updateRange(0, _childrenDepthFirst.size());
+}
+
+TransformationCache3D::TransformationCache3D(TransformationCache3D&&) noexcept = default;
+
+TransformationCache3D::~TransformationCache3D() = default;
+
+TransformationCache3D& TransformationCache3D::operator=(TransformationCache3D&&) noexcept = default;
+
+TransformationCache3D& TransformationCache3D::setGlobalTransformation(const Matrix4& transformation) {
+    _globalTransformation = transformation;
+    _globalTransformationDirty = true;
+    return *this;
+}
+
+TransformationCache3D& TransformationCache3D::setTransformation(const UnsignedInt object, const Matrix4& transformation) {
+    CORRADE_ASSERT(object < _transformations.size(),
+        "SceneTools::TransformationCache3D::setTransformation(): index" << object << "out of range for" << _transformations.size() << "objects", *this);
+
+    _transformations[object] = transformation;
+
+    /* If the object isn't a part of the hierarchy, there's nothing to
+       propagate to, update the absolute transformation directly */
+    const UnsignedInt position = _depthFirstPositions[object];
+    if(position == ~UnsignedInt{})
+        _absoluteTransformations[object] = transformation;
+    else arrayAppend(_dirty, position);
+
+    return *this;
+}
+
+TransformationCache3D& TransformationCache3D::setTransformations(const Containers::StridedArrayView1D<const UnsignedInt>& objects, const Containers::StridedArrayView1D<const Matrix4>& transformations) {
+    CORRADE_ASSERT(objects.size() == transformations.size(),
+        "SceneTools::TransformationCache3D::setTransformations(): expected the object and transformation views to have the same size but got" << objects.size() << "and" << transformations.size(), *this);
+
+    arrayReserve(_dirty, _dirty.size() + objects.size());
+    for(std::size_t i = 0; i != objects.size(); ++i)
+        setTransformation(objects[i], transformations[i]);
+
+    return *this;
+}
+
+void TransformationCache3D::updateRange(const std::size_t begin, const std::size_t end) {
+    /* The depth-first order has parents always before children, so parent
+       absolute transformations are already up to date when reaching a child.
+       The parent of the first object in the range is outside of it and isn't
+       dirty, or is the root. */
+    for(std::size_t i = begin; i != end; ++i) {
+        const UnsignedInt object = _childrenDepthFirst[i].first();
+        const Int parent = _parents[object];
+        _absoluteTransformations[object] = (parent == -1 ?
+            _globalTransformation : _absoluteTransformations[parent])*
+            _transformations[object];
+    }
+}
+
+std::size_t TransformationCache3D::update() {
+    /* If the global transformation changed, everything is dirty */
+    if(_globalTransformationDirty) {
+        updateRange(0, _childrenDepthFirst.size());
+        _globalTransformationDirty = false;
+        arrayClear(_dirty);
+        return _childrenDepthFirst.size();
+    }
+
+    /* Sort the dirty positions so subtrees nested in an already processed
+       subtree can be skipped. A subtree of an object at position i occupies
+       the range [i, i + childCount + 1). Duplicates are skipped the same
+       way. */
+    std::sort(_dirty.begin(), _dirty.end());
+    std::size_t count = 0;
+    std::size_t end = 0;
+    for(const UnsignedInt position: _dirty) {
+        if(position < end) continue;
+
+        end = position + _childrenDepthFirst[position].second() + 1;
+        updateRange(position, end);
+        count += end - position;
+    }
+
+    arrayClear(_dirty);
+    return count;
+}
+
+}}
@@ -0,0 +1,203 @@
+#ifndef Magnum_SceneTools_TransformationCache_h
+#define Magnum_SceneTools_TransformationCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneTools::TransformationCache3D
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Incrementally updated absolute 3D transformations
+@m_since_latest
+
+Caches absolute transformations of all objects in a 3D scene and after local
+transformations of a set of objects are changed, recalculates only the
+subtrees that are affected by the change, instead of the whole hierarchy as
+with @ref absoluteFieldTransformations3D(). This makes it suitable for
+interactive editing of large scenes, where only a few objects are moved every
+frame.
+
+The hierarchy is taken from @ref childrenDepthFirst() on construction, with
+every subtree occupying a contiguous range in the depth-first order. Calling
+@ref setTransformation() marks the object as dirty and @ref update() then
+recalculates the subtree range of each dirty object, skipping subtrees that are
+already contained in a range of another dirty object. The hierarchy itself
+can't be changed after construction.
+
+Absolute transformations of objects that are not a part of the hierarchy, but
+have a transformation assigned, are equal to their local transformation, with
+the global transformation not applied --- the same as in
+@ref absoluteFieldTransformations3D(). Objects that have neither a parent nor
+a transformation have an identity absolute transformation.
+
+@experimental
+*/
+class MAGNUM_SCENETOOLS_EXPORT TransformationCache3D {
+    public:
+        /**
+         * @brief Constructor
+         * @param scene                 Input scene
+         * @param globalTransformation  Global transformation to prepend
+         *
+         * Expects that @p scene is 3D and has a @ref Trade::SceneField::Parent
+         * field satisfying the conditions of @ref childrenDepthFirst().
+         * Calculates absolute transformations of all objects, the cache is
+         * thus not dirty after construction.
+         *
+         * The operation is done in an @f$ \mathcal{O}(n) @f$ execution time
+         * and memory complexity, with @f$ n @f$ being
+         * @ref Trade::SceneData::mappingBound().
+         */
+        explicit TransformationCache3D(const Trade::SceneData& scene, const Matrix4& globalTransformation = {});
+
+        /** @brief Copying is not allowed */
+        TransformationCache3D(const TransformationCache3D&) = delete;
+
+        /** @brief Move constructor */
+        TransformationCache3D(TransformationCache3D&&) noexcept;
+
+        ~TransformationCache3D();
+
+        /** @brief Copying is not allowed */
+        TransformationCache3D& operator=(const TransformationCache3D&) = delete;
+
+        /** @brief Move assignment */
+        TransformationCache3D& operator=(TransformationCache3D&&) noexcept;
+
+        /**
+         * @brief Object count
+         *
+         * Equal to @ref Trade::SceneData::mappingBound() of the scene passed
+         * to the constructor.
+         */
+        std::size_t objectCount() const { return _transformations.size(); }
+
+        /** @brief Global transformation */
+        Matrix4 globalTransformation() const { return _globalTransformation; }
+
+        /**
+         * @brief Set global transformation
+         * @return Reference to self (for method chaining)
+         *
+         * Marks the whole hierarchy as dirty.
+         */
+        TransformationCache3D& setGlobalTransformation(const Matrix4& transformation);
+
+        /**
+         * @brief Local transformations
+         *
+         * Indexed by object ID, with size equal to @ref objectCount().
+         * Objects that don't have a transformation in the scene are identity.
+         */
+        Containers::ArrayView<const Matrix4> transformations() const { return _transformations; }
+
+        /**
+         * @brief Set local transformation of an object
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p object is less than @ref objectCount(). If the
+         * object is a part of the hierarchy, it's marked as dirty and its
+         * absolute transformation, as well as transformations of all its
+         * children, get recalculated in the next @ref update() call.
+         * Otherwise the absolute transformation is updated directly.
+         */
+        TransformationCache3D& setTransformation(UnsignedInt object, const Matrix4& transformation);
+
+        /**
+         * @brief Set local transformations of multiple objects
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to calling @ref setTransformation() for each item of
+         * @p objects and @p transformations, which are expected to have the
+         * same size.
+         */
+        TransformationCache3D& setTransformations(const Containers::StridedArrayView1D<const UnsignedInt>& objects, const Containers::StridedArrayView1D<const Matrix4>& transformations);
+
+        /**
+         * @brief Whether there are any dirty objects
+         *
+         * If @cpp true @ce, @ref absoluteTransformations() are out of date and
+         * @ref update() should be called.
+         */
+        bool isDirty() const { return _globalTransformationDirty || !_dirty.isEmpty(); }
+
+        /**
+         * @brief Recalculate absolute transformations of dirty objects
+         * @return Count of objects for which the absolute transformation got
+         *      recalculated
+         *
+         * Recalculates subtrees of all objects passed to
+         * @ref setTransformation() since the last call, or the whole
+         * hierarchy if @ref setGlobalTransformation() was called. The
+         * operation is done in an @f$ \mathcal{O}(d \log d + m) @f$
+         * execution time, where @f$ d @f$ is the count of dirty objects and
+         * @f$ m @f$ is the count of objects in their subtrees. Does nothing
+         * if the cache isn't dirty.
+         */
+        std::size_t update();
+
+        /**
+         * @brief Absolute transformations
+         *
+         * Indexed by object ID, with size equal to @ref objectCount(). Up to
+         * date only if @ref isDirty() is @cpp false @ce. To get absolute
+         * transformations for entries of a particular field, index this view
+         * with @ref Trade::SceneData::mappingAsArray() of given field.
+         */
+        Containers::ArrayView<const Matrix4> absoluteTransformations() const { return _absoluteTransformations; }
+
+    private:
+        MAGNUM_SCENETOOLS_LOCAL void updateRange(std::size_t begin, std::size_t end);
+
+        Matrix4 _globalTransformation;
+        bool _globalTransformationDirty{};
+        /* Output of childrenDepthFirst() */
+        Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> _childrenDepthFirst;
+        /* Position of each object in _childrenDepthFirst, or ~UnsignedInt{}
+           if the object isn't a part of the hierarchy */
+        Containers::Array<UnsignedInt> _depthFirstPositions;
+        Containers::Array<Int> _parents;
+        Containers::Array<Matrix4> _transformations;
+        Containers::Array<Matrix4> _absoluteTransformations;
+        /* Positions in _childrenDepthFirst of objects marked as dirty */
+        Containers::Array<UnsignedInt> _dirty;
+};
+
+}}
+
+#endif
@@ -34,11 +34,14 @@
 #include <Corrade/Utility/Path.h>
 #include <Corrade/Utility/String.h> /* parseNumberSequence() */
 
+#include "Magnum/Math/Functions.h"
 #include "Magnum/MaterialTools/PhongToPbrMetallicRoughness.h"
 #include "Magnum/MaterialTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Concatenate.h"
 #include "Magnum/MeshTools/Copy.h"
+#include "Magnum/MeshTools/Optimize.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Tipsify.h"
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/SceneTools/Hierarchy.h"
 #include "Magnum/SceneTools/Map.h"
@@ -48,8 +51,20 @@
 #include "Magnum/Trade/AbstractSceneConverter.h"
 
 #include "Magnum/Implementation/converterUtilities.h"
+#include "Magnum/SceneTools/Implementation/allocationProfiler.h"
 #include "Magnum/SceneTools/Implementation/sceneConverterUtilities.h"
 
+#if defined(CORRADE_BUILD_MULTITHREADED) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Magnum/ThreadPool.h"
+
+#define MAGNUM_SCENECONVERTER_THREADS
+#endif
+
 namespace Magnum {
 
 /** @page magnum-sceneconverter Scene conversion utility
@@ -185,8 +200,8 @@ magnum-sceneconverter [-h|--help] [-I|--importer PLUGIN]
     [-M|--mesh-converter PLUGIN]... [--plugin-dir DIR]
     [--prefer alias:plugin1,plugin2,…]... [--set plugin:key=val,key2=val2,…]...
     [--map] [--only-mesh-attributes N1,N2-N3…] [--remove-duplicate-vertices]
-    [--remove-duplicate-vertices-fuzzy EPSILON] [--phong-to-pbr]
-    [--remove-duplicate-materials]
+    [--remove-duplicate-vertices-fuzzy EPSILON] [--optimize-meshes]
+    [--phong-to-pbr] [--remove-duplicate-materials]
     [-i|--importer-options key=val,key2=val2,…]
     [-c|--converter-options key=val,key2=val2,…]...
     [-p|--image-converter-options key=val,key2=val2,…]...
@@ -198,7 +213,8 @@ magnum-sceneconverter [-h|--help] [-I|--importer PLUGIN]
     [--info-images] [--info-lights] [--info-cameras] [--info-materials]
     [--info-meshes] [--info-objects] [--info-scenes] [--info-skins]
     [--info-textures] [--info] [--color on|4bit|off|auto] [--bounds]
-    [--object-hierarchy] [-v|--verbose] [--profile] [--] input output
+    [--object-hierarchy] [--threads N] [-v|--verbose] [--profile] [--]
+    input output
 @endcode
 
 Arguments:
@@ -229,6 +245,10 @@ Arguments:
 -   `--remove-duplicate-vertices-fuzzy EPSILON` --- remove duplicate vertices
     using @ref MeshTools::removeDuplicatesFuzzy(const Trade::MeshData&, Float, Double)
     in all meshes after import
+-   `--optimize-meshes` --- optimize indexed triangle meshes for vertex cache
+    efficiency, overdraw and vertex fetch using @ref MeshTools::tipsifyInPlace(),
+    @ref MeshTools::optimizeOverdrawInPlace() and
+    @ref MeshTools::optimizeVertexFetch()
 -   `--phong-to-pbr` --- convert Phong materials to PBR metallic/roughness
     using @ref MaterialTools::phongToPbrMetallicRoughness()
 -   `--remove-duplicate-materials` --- remove duplicate materials using
@@ -271,8 +291,10 @@ Arguments:
 -   `--color` --- colored output for `--info` (default: `auto`)
 -   `--bounds` --- show bounds of known attributes in `--info` output
 -   `--object-hierarchy` --- visualize object hierarchy in `--info` output
+-   `--threads N` --- number of threads to use for processing images, meshes
+    and materials, `0` for all available (default: `1`)
 -   `-v`, `--verbose` --- verbose output from importer and converter plugins
--   `--profile` --- measure import and conversion time
+-   `--profile` --- measure import and conversion time and count allocations
 
 If any of the `--info-importer`, `--info-converter` or `--info-image-converter`
 options are given, the utility will print information about given plugin
@@ -314,9 +336,37 @@ feature for given image dimensions, all mesh converters in the chain have to
 support the ConvertMesh feature. If no `-P` / `-M` is specified, the imported
 images / meshes are passed directly to the scene converter.
 
-The `--remove-duplicate-vertices`, `--phong-to-pbr` and
+The `--remove-duplicate-vertices`, `--optimize-meshes`, `--phong-to-pbr` and
 `--remove-duplicate-materials` operations are performed on meshes and materials
-before passing them to any converter.
+before passing them to any converter. Mesh optimization is done after
+duplicate removal.
+
+If `--threads` is set to a value other than `1`, images and meshes are
+imported one by one on the main thread, as importer plugins aren't
+thread-safe, and each imported image or mesh is then immediately run through
+the `--image-converter` / mesh processing operations and `--mesh-converter`
+chains on one of the worker threads. Every worker thread has its own instance
+of each converter plugin in the chain. Output of the processing is buffered and
+printed in the original order once all images or meshes are processed, and the
+processed data are passed to the scene converter in the original order as
+well, so the result is the same as with a single thread. With `--profile`, the
+time spent by import and processing of images and meshes is printed
+separately, with conversion time being summed across all threads. The
+`--phong-to-pbr` conversion is done on all imported materials at once, split
+into contiguous ranges across the threads, with output again printed in the
+original order. Parallel processing isn't available on platforms without
+thread support.
+
+With `--profile`, allocations done through @cpp operator new @ce are counted
+as well. For each library and plugin API called by the utility, such as
+@ref Trade::AbstractImporter::mesh() or @ref MeshTools::concatenate(), the
+count of calls, allocations and allocated bytes is printed, together with the
+peak amount of memory allocated at once during a single call relative to its
+start. A peak significantly larger than the size of the output usually points
+to temporary copies. Allocations done directly with @cpp malloc() @ce aren't
+counted, and on Windows neither are allocations done inside DLLs. Amounts of
+memory allocated at once are calculated on Linux, Android, Emscripten, macOS
+and Windows only, elsewhere the peaks are always zero.
 
 If `--concatenate-meshes` is given, all meshes of the input file are
 first concatenated into a single mesh using @ref MeshTools::concatenate(), with
@@ -354,7 +404,50 @@ bool isDataInfoRequested(const Utility::Arguments& args) {
            args.isSet("info");
 }
 
-template<UnsignedInt dimensions> bool runImageConverters(PluginManager::Manager<Trade::AbstractImageConverter>& imageConverterManager, const Utility::Arguments& args, const UnsignedInt i, Containers::Optional<Trade::ImageData<dimensions>>& image) {
+Containers::Pointer<Trade::AbstractImageConverter> instantiateImageConverter(PluginManager::Manager<Trade::AbstractImageConverter>& imageConverterManager, const Utility::Arguments& args, const std::size_t j) {
+    Containers::Pointer<Trade::AbstractImageConverter> imageConverter = imageConverterManager.loadAndInstantiate(args.arrayValue<Containers::StringView>("image-converter", j));
+    if(!imageConverter) {
+        Debug{} << "Available image converter plugins:" << ", "_s.join(imageConverterManager.aliasList());
+        return {};
+    }
+
+    /* Set options, if passed. The AnyImageConverter check makes no sense
+       here, is just there because the helper wants it */
+    if(args.isSet("verbose")) imageConverter->addFlags(Trade::ImageConverterFlag::Verbose);
+    if(j < args.arrayValueCount("image-converter-options"))
+        Implementation::setOptions(*imageConverter, "AnyImageConverter", args.arrayValue("image-converter-options", j));
+
+    return imageConverter;
+}
+
+Containers::Pointer<Trade::AbstractSceneConverter> instantiateMeshConverter(PluginManager::Manager<Trade::AbstractSceneConverter>& converterManager, const Utility::Arguments& args, const std::size_t j) {
+    Containers::Pointer<Trade::AbstractSceneConverter> meshConverter = converterManager.loadAndInstantiate(args.arrayValue<Containers::StringView>("mesh-converter", j));
+    if(!meshConverter) {
+        Debug{} << "Available mesh converter plugins:" << ", "_s.join(converterManager.aliasList());
+        return {};
+    }
+
+    /* Set options, if passed. The AnySceneConverter check makes no sense
+       here, is just there because the helper wants it */
+    if(args.isSet("verbose")) meshConverter->addFlags(Trade::SceneConverterFlag::Verbose);
+    if(j < args.arrayValueCount("mesh-converter-options"))
+        Implementation::setOptions(*meshConverter, "AnySceneConverter", args.arrayValue("mesh-converter-options", j));
+
+    return meshConverter;
+}
+
+/* Prints statistics gathered by AllocationScope instances with --profile */
+void printAllocationProfile(const SceneTools::Implementation::AllocationProfile& profile) {
+    for(const SceneTools::Implementation::AllocationStatistics& i: profile.statistics())
+        Debug{} << i.name << "made" << i.count << "allocations of" << Utility::format("{:.1f}", i.bytes/1048576.0) << "MB in" << i.calls << (i.calls == 1 ? "call," : "calls,") << "peak" << Utility::format("{:.1f}", Math::max(i.peak, Long{})/1048576.0) << "MB";
+
+    const SceneTools::Implementation::AllocationCounters total = SceneTools::Implementation::processAllocationCounters();
+    Debug{} << "Made" << total.count << "allocations of" << Utility::format("{:.1f}", total.bytes/1048576.0) << "MB in total, peak" << Utility::format("{:.1f}", total.peak/1048576.0) << "MB";
+}
+
+/* If imageConverters is empty, the converters are instantiated from the
+   manager for each image, otherwise the passed instances are used */
+template<UnsignedInt dimensions> bool runImageConverters(PluginManager::Manager<Trade::AbstractImageConverter>& imageConverterManager, const Containers::ArrayView<const Containers::Pointer<Trade::AbstractImageConverter>> imageConverters, const Utility::Arguments& args, const UnsignedInt i, Containers::Optional<Trade::ImageData<dimensions>>& image, std::chrono::high_resolution_clock::duration& conversionTime, SceneTools::Implementation::AllocationProfile* const allocations) {
     const bool passthroughOnConversionFailure = args.isSet("passthrough-on-image-converter-failure");
 
     for(std::size_t j = 0, imageConverterCount = args.arrayValueCount("image-converter"); j != imageConverterCount; ++j) {
@@ -367,17 +460,13 @@ template<UnsignedInt dimensions> bool runImageConverters(PluginManager::Manager<
             d << "with" << imageConverterName << Debug::nospace << "...";
         }
 
-        Containers::Pointer<Trade::AbstractImageConverter> imageConverter = imageConverterManager.loadAndInstantiate(imageConverterName);
-        if(!imageConverter) {
-            Debug{} << "Available image converter plugins:" << ", "_s.join(imageConverterManager.aliasList());
-            return false;
-        }
-
-        /* Set options, if passed. The AnyImageConverter check makes no
-            sense here, is just there because the helper wants it */
-        if(args.isSet("verbose")) imageConverter->addFlags(Trade::ImageConverterFlag::Verbose);
-        if(j < args.arrayValueCount("image-converter-options"))
-            Implementation::setOptions(*imageConverter, "AnyImageConverter", args.arrayValue("image-converter-options", j));
+        Containers::Pointer<Trade::AbstractImageConverter> instantiated;
+        Trade::AbstractImageConverter* imageConverter;
+        if(imageConverters.isEmpty()) {
+            if(!(instantiated = instantiateImageConverter(imageConverterManager, args, j)))
+                return false;
+            imageConverter = instantiated.get();
+        } else imageConverter = imageConverters[j].get();
 
         Trade::ImageConverterFeatures expectedFeatures;
         if(dimensions == 2) {
@@ -403,7 +492,13 @@ template<UnsignedInt dimensions> bool runImageConverters(PluginManager::Manager<
         /** @todo handle image levels here, once GltfSceneConverter is capable
             of converting them (which needs AbstractImageConverter to be
             reworked around ImageData) */
-        if(Containers::Optional<Trade::ImageData<dimensions>> converted = imageConverter->convert(*image)) {
+        Containers::Optional<Trade::ImageData<dimensions>> converted;
+        {
+            Trade::Implementation::Duration d{conversionTime};
+            SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractImageConverter::convert()"_s};
+            converted = imageConverter->convert(*image);
+        }
+        if(converted) {
             image = Utility::move(converted);
         } else if(passthroughOnConversionFailure) {
             Warning{} << "Cannot process" << dimensions << Debug::nospace << "D image" << i << "with" << imageConverterName << Debug::nospace << ", passing the original through";
@@ -416,6 +511,270 @@ template<UnsignedInt dimensions> bool runImageConverters(PluginManager::Manager<
     return true;
 }
 
+/* Duplicate removal, optimization and mesh converters for a single mesh.
+   Returns a non-zero exit code on failure. If meshConverters is empty, the
+   converters are instantiated from the manager for each mesh, otherwise the
+   passed instances are used. */
+int processMesh(PluginManager::Manager<Trade::AbstractSceneConverter>& converterManager, const Containers::ArrayView<const Containers::Pointer<Trade::AbstractSceneConverter>> meshConverters, const Utility::Arguments& args, const bool singleMesh, const UnsignedInt i, Containers::Optional<Trade::MeshData>& mesh, std::chrono::high_resolution_clock::duration& conversionTime, SceneTools::Implementation::AllocationProfile* const allocations) {
+    const bool passthroughOnConversionFailure = args.isSet("passthrough-on-mesh-converter-failure");
+
+    /* Duplicate removal */
+    if(args.isSet("remove-duplicate-vertices") ||
+       args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy"))
+    {
+        const UnsignedInt beforeVertexCount = mesh->vertexCount();
+        const bool fuzzy = !!args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy");
+
+        /** @todo accept two values for float and double fuzzy comparison,
+            or maybe also different for positions, normals and texcoords?
+            ugh... */
+        if(fuzzy) {
+            Trade::Implementation::Duration d{conversionTime};
+            SceneTools::Implementation::AllocationScope a{allocations, "MeshTools::removeDuplicatesFuzzy()"_s};
+            mesh = MeshTools::removeDuplicatesFuzzy(*Utility::move(mesh), args.value<Float>("remove-duplicate-vertices-fuzzy"));
+        } else {
+            Trade::Implementation::Duration d{conversionTime};
+            SceneTools::Implementation::AllocationScope a{allocations, "MeshTools::removeDuplicates()"_s};
+            mesh = MeshTools::removeDuplicates(*Utility::move(mesh));
+        }
+
+        if(args.isSet("verbose")) {
+            Debug d;
+            /* Mesh index 0 would be confusing in case of --concatenate-meshes
+               and plain wrong with --mesh, so don't even print it */
+            if(singleMesh)
+                d << (fuzzy ? "Fuzzy duplicate removal:" : "Duplicate removal:");
+            else
+                d << "Mesh" << i << (fuzzy ? "fuzzy duplicate removal:" : "duplicate removal:");
+            d << beforeVertexCount << "->" << mesh->vertexCount() << "vertices";
+        }
+    }
+
+    /* Vertex cache, overdraw and vertex fetch optimization. Only indexed
+       triangle meshes are optimized, other primitives would need conversion
+       to triangles first. */
+    if(args.isSet("optimize-meshes")) {
+        if(mesh->primitive() != MeshPrimitive::Triangles || !mesh->isIndexed() || !mesh->hasAttribute(Trade::MeshAttribute::Position)) {
+            if(args.isSet("verbose")) {
+                if(singleMesh)
+                    Debug{} << "Skipping optimization of a non-indexed or non-triangle mesh";
+                else
+                    Debug{} << "Skipping optimization of a non-indexed or non-triangle mesh" << i;
+            }
+        } else {
+            /** @todo make the cache size configurable? */
+            constexpr std::size_t CacheSize = 24;
+            Containers::Array<UnsignedInt> indices = mesh->indicesAsArray();
+            const MeshTools::VertexCacheStatistics before = MeshTools::analyzeVertexCache(indices, mesh->vertexCount(), CacheSize);
+
+            {
+                Trade::Implementation::Duration d{conversionTime};
+                {
+                    SceneTools::Implementation::AllocationScope a{allocations, "MeshTools::tipsifyInPlace()"_s};
+                    MeshTools::tipsifyInPlace(indices, mesh->vertexCount(), CacheSize);
+                }
+                {
+                    SceneTools::Implementation::AllocationScope a{allocations, "MeshTools::optimizeOverdrawInPlace()"_s};
+                    MeshTools::optimizeOverdrawInPlace(indices, mesh->positions3DAsArray(), CacheSize);
+                }
+                SceneTools::Implementation::AllocationScope a{allocations, "MeshTools::optimizeVertexFetch()"_s};
+                mesh = MeshTools::optimizeVertexFetch(Trade::MeshData{mesh->primitive(),
+                    {}, Containers::arrayView(indices), Trade::MeshIndexData{Containers::arrayView(indices)},
+                    {}, mesh->vertexData(), Trade::meshAttributeDataNonOwningArray(mesh->attributeData()),
+                    mesh->vertexCount()});
+            }
+
+            if(args.isSet("verbose")) {
+                const MeshTools::VertexCacheStatistics after = MeshTools::analyzeVertexCache(mesh->indices<UnsignedInt>(), mesh->vertexCount(), CacheSize);
+                Debug d;
+                if(singleMesh)
+                    d << "Optimization:";
+                else
+                    d << "Mesh" << i << "optimization:";
+                d << "ACMR" << before.acmr << "->" << after.acmr << Debug::nospace << ", ATVR" << before.atvr << "->" << after.atvr;
+            }
+        }
+    }
+
+    /* Arbitrary mesh converters */
+    for(std::size_t j = 0, meshConverterCount = args.arrayValueCount("mesh-converter"); j != meshConverterCount; ++j) {
+        const Containers::StringView meshConverterName = args.arrayValue<Containers::StringView>("mesh-converter", j);
+        if(args.isSet("verbose")) {
+            Debug d;
+            d << "Processing mesh" << i;
+            if(meshConverterCount > 1)
+                d << "(" << Debug::nospace << (j+1) << Debug::nospace << "/" << Debug::nospace << meshConverterCount << Debug::nospace << ")";
+            d << "with" << meshConverterName << Debug::nospace << "...";
+        }
+
+        Containers::Pointer<Trade::AbstractSceneConverter> instantiated;
+        Trade::AbstractSceneConverter* meshConverter;
+        if(meshConverters.isEmpty()) {
+            if(!(instantiated = instantiateMeshConverter(converterManager, args, j)))
+                return 2;
+            meshConverter = instantiated.get();
+        } else meshConverter = meshConverters[j].get();
+
+        if(!(meshConverter->features() & (Trade::SceneConverterFeature::ConvertMesh))) {
+            Error{} << meshConverterName << "doesn't support mesh conversion, only" << Debug::packed << meshConverter->features();
+            return 1;
+        }
+
+        /** @todo handle mesh levels here, once any plugin is capable of
+            converting them */
+        Containers::Optional<Trade::MeshData> converted;
+        {
+            Trade::Implementation::Duration d{conversionTime};
+            SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractSceneConverter::convert()"_s};
+            converted = meshConverter->convert(*mesh);
+        }
+        if(converted) {
+            mesh = Utility::move(converted);
+        } else if(passthroughOnConversionFailure) {
+            Warning{} << "Cannot process mesh" << i << "with" << meshConverterName << Debug::nospace << ", passing the original through";
+        } else {
+            Error{} << "Cannot process mesh" << i << "with" << meshConverterName;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+#ifdef MAGNUM_SCENECONVERTER_THREADS
+/* Captured diagnostic output and exit code for a single item processed by
+   importAndProcessParallel() */
+struct ParallelItemOutput {
+    std::ostringstream debug, error;
+    int result;
+};
+
+/* Imports items one by one on the calling thread, as importer instances
+   aren't thread-safe, and processes each imported item on one of the worker
+   threads. Diagnostic output of each item is captured and then printed in the
+   original order, stopping at the first failure, so the output is the same as
+   when processing serially. The import function returns an Optional, the
+   process function gets a thread ID in addition to the item ID and returns a
+   non-zero exit code on failure. */
+template<class T, class Import, class Process> int importAndProcessParallel(const std::size_t threadCount, const std::size_t count, Containers::Array<T>& out, std::chrono::high_resolution_clock::duration& importTime, std::chrono::high_resolution_clock::duration& conversionTime, Import import, Process process) {
+    Containers::Array<Containers::Optional<T>> items{count};
+    Containers::Array<ParallelItemOutput> outputs{ValueInit, count};
+    /* Each thread measures its own conversion time, summed at the end */
+    Containers::Array<std::chrono::high_resolution_clock::duration> threadConversionTimes{ValueInit, threadCount};
+
+    /* The importedCount and importDone are guarded by the mutex, the workers
+       wait until the item they picked is imported */
+    std::mutex mutex;
+    std::condition_variable itemImported;
+    std::size_t importedCount = 0;
+    bool importDone = false;
+    std::atomic<std::size_t> next{0};
+    std::atomic<bool> failed{false};
+
+    Containers::Array<std::thread> threads{threadCount};
+    for(std::size_t t = 0; t != threadCount; ++t) threads[t] = std::thread{[&, t]() {
+        /* Every item picked is processed, even if another item failed in the
+           meantime. That way all items before the first failed one are
+           always processed and their output can be printed. */
+        while(!failed) {
+            const std::size_t i = next++;
+            if(i >= count) break;
+
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                itemImported.wait(lock, [&]() { return importedCount > i || importDone; });
+                /* Import stopped before reaching this item */
+                if(importedCount <= i) break;
+            }
+
+            ParallelItemOutput& output = outputs[i];
+            Debug redirectDebug{&output.debug};
+            Warning redirectWarning{&output.error};
+            Error redirectError{&output.error};
+            if((output.result = process(t, i, items[i], threadConversionTimes[t])))
+                failed = true;
+        }
+    }};
+
+    for(std::size_t i = 0; i != count && !failed; ++i) {
+        ParallelItemOutput& output = outputs[i];
+        {
+            Debug redirectDebug{&output.debug};
+            Warning redirectWarning{&output.error};
+            Error redirectError{&output.error};
+            Trade::Implementation::Duration d{importTime};
+            items[i] = import(i);
+        }
+
+        if(!items[i]) {
+            output.result = 1;
+            break;
+        }
+
+        std::lock_guard<std::mutex> lock{mutex};
+        ++importedCount;
+        itemImported.notify_all();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        importDone = true;
+        itemImported.notify_all();
+    }
+
+    for(std::thread& thread: threads) thread.join();
+    for(const std::chrono::high_resolution_clock::duration& i: threadConversionTimes)
+        conversionTime += i;
+
+    arrayReserve(out, count);
+    for(std::size_t i = 0; i != count; ++i) {
+        const std::string debug = outputs[i].debug.str();
+        const std::string error = outputs[i].error.str();
+        if(!debug.empty()) Debug{Debug::Flag::NoNewlineAtTheEnd} << debug;
+        if(!error.empty()) Error{Debug::Flag::NoNewlineAtTheEnd} << error;
+        if(outputs[i].result) return outputs[i].result;
+
+        CORRADE_INTERNAL_ASSERT(items[i]);
+        arrayAppend(out, *Utility::move(items[i]));
+    }
+
+    return 0;
+}
+
+/* MaterialTools::ParallelFor executing the tasks on a ThreadPool passed in
+   the state. The items are split into a contiguous range for each pool thread
+   and the diagnostic output of each range is captured and printed in the
+   range order once all of them finish, so the output is the same as when
+   processing serially. */
+void parallelForThreads(void* const state, const std::size_t count, void(*const task)(void*, std::size_t), void* const taskState) {
+    struct Ranges {
+        std::size_t count;
+        std::size_t rangeCount;
+        void(*task)(void*, std::size_t);
+        void* taskState;
+        Containers::Array<ParallelItemOutput> outputs;
+    } ranges{count, Math::min(std::size_t(static_cast<ThreadPool*>(state)->threadCount()), count), task, taskState, {}};
+    ranges.outputs = Containers::Array<ParallelItemOutput>{ValueInit, ranges.rangeCount};
+
+    ThreadPool::parallelFor(state, ranges.rangeCount, [](void* const rangesState, const std::size_t r) {
+        Ranges& data = *static_cast<Ranges*>(rangesState);
+        ParallelItemOutput& output = data.outputs[r];
+        Debug redirectDebug{&output.debug};
+        Warning redirectWarning{&output.error};
+        Error redirectError{&output.error};
+        for(std::size_t i = data.count*r/data.rangeCount, end = data.count*(r + 1)/data.rangeCount; i != end; ++i)
+            data.task(data.taskState, i);
+    }, &ranges);
+
+    for(const ParallelItemOutput& output: ranges.outputs) {
+        const std::string debug = output.debug.str();
+        const std::string error = output.error.str();
+        if(!debug.empty()) Debug{Debug::Flag::NoNewlineAtTheEnd} << debug;
+        if(!error.empty()) Error{Debug::Flag::NoNewlineAtTheEnd} << error;
+    }
+}
+#endif
+
 }
 
 int main(int argc, char** argv) {
@@ -437,6 +796,7 @@ int main(int argc, char** argv) {
         .addOption("only-mesh-attributes").setHelp("only-mesh-attributes", "include only mesh attributes of given IDs in the output", "N1,N2-N3…")
         .addBooleanOption("remove-duplicate-vertices").setHelp("remove-duplicate-vertices", "remove duplicate vertices in all meshes after import")
         .addOption("remove-duplicate-vertices-fuzzy").setHelp("remove-duplicate-vertices-fuzzy", "remove duplicate vertices with fuzzy comparison in all meshes after import", "EPSILON")
+        .addBooleanOption("optimize-meshes").setHelp("optimize-meshes", "optimize indexed triangle meshes for vertex cache, overdraw and vertex fetch")
         .addBooleanOption("phong-to-pbr").setHelp("phong-to-pbr", "convert Phong materials to PBR metallic/roughness")
         .addBooleanOption("remove-duplicate-materials").setHelp("remove-duplicate-materials", "remove duplicate materials")
         .addOption('i', "importer-options").setHelp("importer-options", "configuration options to pass to the importer", "key=val,key2=val2,…")
@@ -465,8 +825,9 @@ int main(int argc, char** argv) {
         .addOption("color", "auto").setHelp("color", "colored output for --info", "on|4bit|off|auto")
         .addBooleanOption("bounds").setHelp("bounds", "show bounds of known attributes in --info output")
         .addBooleanOption("object-hierarchy").setHelp("object-hierarchy", "visualize object hierarchy in --info output")
+        .addOption("threads", "1").setHelp("threads", "number of threads to use for processing images, meshes and materials, 0 for all available", "N")
         .addBooleanOption('v', "verbose").setHelp("verbose", "verbose output from importer and converter plugins")
-        .addBooleanOption("profile").setHelp("profile", "measure import and conversion time")
+        .addBooleanOption("profile").setHelp("profile", "measure import and conversion time and count allocations")
         .setParseErrorCallback([](const Utility::Arguments& args, Utility::Arguments::ParseError error, const std::string& key) {
             /* If --info for plugins is passed, we don't need the input */
             if(error == Utility::Arguments::ParseError::MissingArgument &&
@@ -517,9 +878,17 @@ feature for given image dimensions, all mesh converters in the chain have to
 support the ConvertMesh feature. If no -P / -M is specified, the imported
 images / meshes are passed directly to the scene converter.
 
-The --remove-duplicate-vertices, --phong-to-pbr and
+The --remove-duplicate-vertices, --optimize-meshes, --phong-to-pbr and
 --remove-duplicate-materials operations are performed on meshes and materials
-before passing them to any converter.
+before passing them to any converter. Mesh optimization is done after
+duplicate removal.
+
+If --threads is set to a value other than 1, images and meshes are imported
+one by one on the main thread and then processed in parallel on worker
+threads, each having its own instance of every image and mesh converter. The
+--phong-to-pbr conversion is split across the worker threads as well. The
+output and the order of data passed to the scene converter stays the same as
+with a single thread.
 
 If --concatenate-meshes is given, all meshes of the input file are first
 concatenated into a single mesh, with the scene hierarchy transformation baked
@@ -752,6 +1121,12 @@ well, the IDs reference attributes of the first mesh.)")
     if(args.isSet("verbose")) importer->addFlags(Trade::ImporterFlag::Verbose);
     Implementation::setOptions(*importer, "AnySceneImporter", args.value("importer-options"));
 
+    /* Allocation counting for --profile, enabled before any worker threads get
+       spawned */
+    SceneTools::Implementation::AllocationProfile allocationProfile;
+    SceneTools::Implementation::AllocationProfile* const allocations = args.isSet("profile") ? &allocationProfile : nullptr;
+    if(allocations) SceneTools::Implementation::enableAllocationCounting();
+
     /* Wow, C++, you suck. This implicitly initializes to random shit?!
 
        Also, because of addSupportedImporterContents() it's not really possible
@@ -765,6 +1140,7 @@ well, the IDs reference attributes of the first mesh.)")
     Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mapped;
     if(args.isSet("map")) {
         Trade::Implementation::Duration d{importConversionTime};
+        SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractImporter::openMemory()"_s};
         if(!(mapped = Utility::Path::mapRead(args.value("input"))) || !importer->openMemory(*mapped)) {
             Error() << "Cannot memory-map file" << args.value("input");
             return 3;
@@ -773,6 +1149,7 @@ well, the IDs reference attributes of the first mesh.)")
     #endif
     {
         Trade::Implementation::Duration d{importConversionTime};
+        SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractImporter::openFile()"_s};
         if(!importer->openFile(args.value("input"))) {
             Error() << "Cannot open file" << args.value("input");
             return 3;
@@ -785,6 +1162,7 @@ well, the IDs reference attributes of the first mesh.)")
 
         if(args.isSet("profile")) {
             Debug{} << "Import took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(importConversionTime).count())/1.0e3f << "seconds";
+            printAllocationProfile(allocationProfile);
         }
 
         return error ? 1 : 0;
@@ -792,6 +1170,31 @@ well, the IDs reference attributes of the first mesh.)")
 
     /* Wow, C++, you suck. This implicitly initializes to random shit?! */
     std::chrono::high_resolution_clock::duration conversionTime{};
+    /* Total time spent importing and processing images and meshes, including
+       time spent waiting for worker threads */
+    std::chrono::high_resolution_clock::duration imageProcessingTime{};
+    std::chrono::high_resolution_clock::duration meshProcessingTime{};
+
+    /* Threads for image and mesh processing */
+    std::size_t threadCount = args.value<UnsignedInt>("threads");
+    #ifdef MAGNUM_SCENECONVERTER_THREADS
+    if(!threadCount) {
+        const UnsignedInt hardwareConcurrency = std::thread::hardware_concurrency();
+        threadCount = hardwareConcurrency ? hardwareConcurrency : 1;
+    }
+
+    /* Shared by all processing steps that take a ParallelFor. The import
+       pipelines in importAndProcessParallel() interleave the import on the
+       main thread with processing on workers so they use their own threads
+       instead. Created only if there's actually more than one thread. */
+    Containers::Optional<ThreadPool> threadPool;
+    if(threadCount > 1) threadPool.emplace(UnsignedInt(threadCount));
+    #else
+    if(threadCount != 1) {
+        Warning{} << "Parallel processing isn't available on this platform, ignoring --threads";
+        threadCount = 1;
+    }
+    #endif
 
     /* Import all scenes, in case something later needs to modify them. There's
        currently no other operations done on those. */
@@ -803,6 +1206,7 @@ well, the IDs reference attributes of the first mesh.)")
             Containers::Optional<Trade::SceneData> scene;
             {
                 Trade::Implementation::Duration d{importConversionTime};
+                SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractImporter::scene()"_s};
                 if(!(scene = importer->scene(i))) {
                     Error{} << "Cannot import scene" << i;
                     return 1;
@@ -839,6 +1243,7 @@ well, the IDs reference attributes of the first mesh.)")
                 importing them */
             for(std::size_t i = 0, iMax = importer->meshCount(); i != iMax; ++i) {
                 Trade::Implementation::Duration d{importConversionTime};
+                SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractImporter::mesh()"_s};
                 Containers::Optional<Trade::MeshData> meshToConcatenate = importer->mesh(i);
                 if(!meshToConcatenate) {
                     Error{} << "Cannot import mesh" << i;
@@ -860,6 +1265,7 @@ well, the IDs reference attributes of the first mesh.)")
                         except meshes and scene hierarchy is filtered away */
                     const UnsignedInt defaultScene = importer->defaultScene() == -1 ? 0 : importer->defaultScene();
                     Trade::Implementation::Duration d{importConversionTime};
+                    SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractImporter::scene()"_s};
                     if(!(scene = importer->scene(defaultScene))) {
                         Error{} << "Cannot import scene" << defaultScene << "for mesh concatenation";
                         return 1;
@@ -868,13 +1274,17 @@ well, the IDs reference attributes of the first mesh.)")
 
                 Containers::Array<Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>>
                     meshesMaterials = scene->meshesMaterialsAsArray();
-                Containers::Array<Matrix4> transformations =
-                    SceneTools::absoluteFieldTransformations3D(*scene, Trade::SceneField::Mesh);
+                Containers::Array<Matrix4> transformations;
+                {
+                    SceneTools::Implementation::AllocationScope a{allocations, "SceneTools::absoluteFieldTransformations3D()"_s};
+                    transformations = SceneTools::absoluteFieldTransformations3D(*scene, Trade::SceneField::Mesh);
+                }
                 Containers::Array<Trade::MeshData> flattenedMeshes;
                 {
                     Trade::Implementation::Duration d{conversionTime};
                     /** @todo once there are 2D scenes, check the scene is 3D */
                     for(std::size_t i = 0; i != meshesMaterials.size(); ++i) {
+                        SceneTools::Implementation::AllocationScope a{allocations, "MeshTools::transform3D()"_s};
                         arrayAppend(flattenedMeshes, MeshTools::transform3D(
                             meshes[meshesMaterials[i].second().first()], transformations[i]));
                     }
@@ -884,6 +1294,7 @@ well, the IDs reference attributes of the first mesh.)")
 
             {
                 Trade::Implementation::Duration d{conversionTime};
+                SceneTools::Implementation::AllocationScope a{allocations, "MeshTools::concatenate()"_s};
                 /** @todo this will assert if the meshes have incompatible primitives
                     (such as some triangles, some lines), or if they have
                     loops/strips/fans -- handle that explicitly */
@@ -893,6 +1304,7 @@ well, the IDs reference attributes of the first mesh.)")
         /* Otherwise import just one */
         } else {
             Trade::Implementation::Duration d{importConversionTime};
+            SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractImporter::mesh()"_s};
             if(!(mesh = importer->mesh(args.value<UnsignedInt>("mesh"), args.value<UnsignedInt>("mesh-level")))) {
                 Error{} << "Cannot import the mesh";
                 return 4;
@@ -981,6 +1393,8 @@ well, the IDs reference attributes of the first mesh.)")
     Containers::Array<Trade::ImageData2D> images2D;
     Containers::Array<Trade::ImageData3D> images3D;
     if(args.arrayValueCount("image-converter")) {
+        Trade::Implementation::Duration stageDuration{imageProcessingTime};
+
         /** @todo implement once there's any file format capable of storing
             these */
         if(importer->image1DCount()) {
@@ -988,44 +1402,89 @@ well, the IDs reference attributes of the first mesh.)")
             return 1;
         }
 
-        for(UnsignedInt i = 0; i != importer->image2DCount(); ++i) {
-            Containers::Optional<Trade::ImageData2D> image;
-            {
-                /** @todo handle image levels once GltfSceneConverter can save
-                    them (which needs AbstractImageConverter to be reworked
-                    around ImageData) -- there could be an image2DOffsets
-                    array saying which subrange is levels for which image */
-                Trade::Implementation::Duration d{importConversionTime};
-                if(!(image = importer->image2D(i))) {
-                    Error{} << "Cannot import 2D image" << i;
-                    return 1;
-                }
+        #ifdef MAGNUM_SCENECONVERTER_THREADS
+        if(threadCount > 1) {
+            /* Each thread gets its own instance of every converter in the
+               chain. Instantiated upfront as the plugin manager isn't
+               thread-safe, option diagnostics are printed only once. */
+            const std::size_t imageConverterCount = args.arrayValueCount("image-converter");
+            Containers::Array<Containers::Pointer<Trade::AbstractImageConverter>> imageConverters{threadCount*imageConverterCount};
+            for(std::size_t t = 0; t != threadCount; ++t) {
+                Warning redirectWarning{t ? nullptr : Warning::output()};
+                for(std::size_t j = 0; j != imageConverterCount; ++j)
+                    if(!(imageConverters[t*imageConverterCount + j] = instantiateImageConverter(imageConverterManager, args, j)))
+                        return 1;
             }
 
-            if(!runImageConverters(imageConverterManager, args, i, image))
-                return 1;
-
-            arrayAppend(images2D, *Utility::move(image));
-        }
+            /** @todo handle image levels once GltfSceneConverter can save
+                them, same as in the serial variant below */
+            if(const int result = importAndProcessParallel(threadCount, importer->image2DCount(), images2D, importConversionTime, conversionTime,
+                [&](const std::size_t i) {
+                    SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractImporter::image2D()"_s};
+                    Containers::Optional<Trade::ImageData2D> image = importer->image2D(i);
+                    if(!image) Error{} << "Cannot import 2D image" << i;
+                    return image;
+                },
+                [&](const std::size_t t, const std::size_t i, Containers::Optional<Trade::ImageData2D>& image, std::chrono::high_resolution_clock::duration& threadConversionTime) {
+                    return runImageConverters(imageConverterManager, imageConverters.slice(t*imageConverterCount, (t + 1)*imageConverterCount), args, i, image, threadConversionTime, allocations) ? 0 : 1;
+                }))
+                return result;
+
+            if(const int result = importAndProcessParallel(threadCount, importer->image3DCount(), images3D, importConversionTime, conversionTime,
+                [&](const std::size_t i) {
+                    SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractImporter::image3D()"_s};
+                    Containers::Optional<Trade::ImageData3D> image = importer->image3D(i);
+                    if(!image) Error{} << "Cannot import 3D image" << i;
+                    return image;
+                },
+                [&](const std::size_t t, const std::size_t i, Containers::Optional<Trade::ImageData3D>& image, std::chrono::high_resolution_clock::duration& threadConversionTime) {
+                    return runImageConverters(imageConverterManager, imageConverters.slice(t*imageConverterCount, (t + 1)*imageConverterCount), args, i, image, threadConversionTime, allocations) ? 0 : 1;
+                }))
+                return result;
+        } else
+        #endif
+        {
+            for(UnsignedInt i = 0; i != importer->image2DCount(); ++i) {
+                Containers::Optional<Trade::ImageData2D> image;
+                {
+                    /** @todo handle image levels once GltfSceneConverter can save
+                        them (which needs AbstractImageConverter to be reworked
+                        around ImageData) -- there could be an image2DOffsets
+                        array saying which subrange is levels for which image */
+                    Trade::Implementation::Duration d{importConversionTime};
+                    SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractImporter::image2D()"_s};
+                    if(!(image = importer->image2D(i))) {
+                        Error{} << "Cannot import 2D image" << i;
+                        return 1;
+                    }
+                }
 
-        for(UnsignedInt i = 0; i != importer->image3DCount(); ++i) {
-            Containers::Optional<Trade::ImageData3D> image;
-            {
-                /** @todo handle image levels once GltfSceneConverter can save
-                    them (which needs AbstractImageConverter to be reworked
-                    around ImageData) -- there could be an image2DOffsets
-                    array saying which subrange is levels for which image */
-                Trade::Implementation::Duration d{importConversionTime};
-                if(!(image = importer->image3D(i))) {
-                    Error{} << "Cannot import 3D image" << i;
+                if(!runImageConverters(imageConverterManager, {}, args, i, image, conversionTime, allocations))
                     return 1;
-                }
+
+                arrayAppend(images2D, *Utility::move(image));
             }
 
-            if(!runImageConverters(imageConverterManager, args, i, image))
-                return 1;
+            for(UnsignedInt i = 0; i != importer->image3DCount(); ++i) {
+                Containers::Optional<Trade::ImageData3D> image;
+                {
+                    /** @todo handle image levels once GltfSceneConverter can save
+                        them (which needs AbstractImageConverter to be reworked
+                        around ImageData) -- there could be an image2DOffsets
+                        array saying which subrange is levels for which image */
+                    Trade::Implementation::Duration d{importConversionTime};
+                    SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractImporter::image3D()"_s};
+                    if(!(image = importer->image3D(i))) {
+                        Error{} << "Cannot import 3D image" << i;
+                        return 1;
+                    }
+                }
+
+                if(!runImageConverters(imageConverterManager, {}, args, i, image, conversionTime, allocations))
+                    return 1;
 
-            arrayAppend(images3D, *Utility::move(image));
+                arrayAppend(images3D, *Utility::move(image));
+            }
         }
     }
 
@@ -1034,96 +1493,60 @@ well, the IDs reference attributes of the first mesh.)")
     Containers::Array<Trade::MeshData> meshes;
     if(args.isSet("remove-duplicate-vertices") ||
        args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy") ||
+       args.isSet("optimize-meshes") ||
        args.arrayValueCount("mesh-converter"))
     {
-        const bool passthroughOnConversionFailure = args.isSet("passthrough-on-mesh-converter-failure");
+        Trade::Implementation::Duration stageDuration{meshProcessingTime};
 
         arrayReserve(meshes, importer->meshCount());
 
-        for(UnsignedInt i = 0; i != importer->meshCount(); ++i) {
-            Containers::Optional<Trade::MeshData> mesh;
-            {
-                /** @todo handle mesh levels here, once any plugin is capable
-                    of importing them */
-                Trade::Implementation::Duration d{importConversionTime};
-                if(!(mesh = importer->mesh(i))) {
-                    Error{} << "Cannot import mesh" << i;
-                    return 1;
-                }
+        #ifdef MAGNUM_SCENECONVERTER_THREADS
+        if(threadCount > 1) {
+            /* Same as with images above, each thread gets its own instance of
+               every converter in the chain */
+            const std::size_t meshConverterCount = args.arrayValueCount("mesh-converter");
+            Containers::Array<Containers::Pointer<Trade::AbstractSceneConverter>> meshConverters{threadCount*meshConverterCount};
+            for(std::size_t t = 0; t != threadCount; ++t) {
+                Warning redirectWarning{t ? nullptr : Warning::output()};
+                for(std::size_t j = 0; j != meshConverterCount; ++j)
+                    if(!(meshConverters[t*meshConverterCount + j] = instantiateMeshConverter(converterManager, args, j)))
+                        return 2;
             }
 
-            /* Duplicate removal */
-            if(args.isSet("remove-duplicate-vertices") ||
-               args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy"))
-            {
-                const UnsignedInt beforeVertexCount = mesh->vertexCount();
-                const bool fuzzy = !!args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy");
-
-                /** @todo accept two values for float and double fuzzy
-                    comparison, or maybe also different for positions, normals
-                    and texcoords? ugh... */
-                if(fuzzy) {
-                    Trade::Implementation::Duration d{conversionTime};
-                    mesh = MeshTools::removeDuplicatesFuzzy(*Utility::move(mesh), args.value<Float>("remove-duplicate-vertices-fuzzy"));
-                } else {
-                    Trade::Implementation::Duration d{conversionTime};
-                    mesh = MeshTools::removeDuplicates(*Utility::move(mesh));
-                }
-
-                if(args.isSet("verbose")) {
-                    Debug d;
-                    /* Mesh index 0 would be confusing in case of
-                        --concatenate-meshes and plain wrong with --mesh, so
-                        don't even print it */
-                    if(singleMesh)
-                        d << (fuzzy ? "Fuzzy duplicate removal:" : "Duplicate removal:");
-                    else
-                        d << "Mesh" << i << (fuzzy ? "fuzzy duplicate removal:" : "duplicate removal:");
-                    d << beforeVertexCount << "->" << mesh->vertexCount() << "vertices";
-                }
-            }
-
-            /* Arbitrary mesh converters */
-            for(std::size_t j = 0, meshConverterCount = args.arrayValueCount("mesh-converter"); j != meshConverterCount; ++j) {
-                const Containers::StringView meshConverterName = args.arrayValue<Containers::StringView>("mesh-converter", j);
-                if(args.isSet("verbose")) {
-                    Debug d;
-                    d << "Processing mesh" << i;
-                    if(meshConverterCount > 1)
-                        d << "(" << Debug::nospace << (j+1) << Debug::nospace << "/" << Debug::nospace << meshConverterCount << Debug::nospace << ")";
-                    d << "with" << meshConverterName << Debug::nospace << "...";
-                }
-
-                Containers::Pointer<Trade::AbstractSceneConverter> meshConverter = converterManager.loadAndInstantiate(meshConverterName);
-                if(!meshConverter) {
-                    Debug{} << "Available mesh converter plugins:" << ", "_s.join(converterManager.aliasList());
-                    return 2;
+            /** @todo handle mesh levels here, once any plugin is capable of
+                importing them */
+            if(const int result = importAndProcessParallel(threadCount, importer->meshCount(), meshes, importConversionTime, conversionTime,
+                [&](const std::size_t i) {
+                    SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractImporter::mesh()"_s};
+                    Containers::Optional<Trade::MeshData> mesh = importer->mesh(i);
+                    if(!mesh) Error{} << "Cannot import mesh" << i;
+                    return mesh;
+                },
+                [&](const std::size_t t, const std::size_t i, Containers::Optional<Trade::MeshData>& mesh, std::chrono::high_resolution_clock::duration& threadConversionTime) {
+                    return processMesh(converterManager, meshConverters.slice(t*meshConverterCount, (t + 1)*meshConverterCount), args, singleMesh, i, mesh, threadConversionTime, allocations);
+                }))
+                return result;
+        } else
+        #endif
+        {
+            for(UnsignedInt i = 0; i != importer->meshCount(); ++i) {
+                Containers::Optional<Trade::MeshData> mesh;
+                {
+                    /** @todo handle mesh levels here, once any plugin is capable
+                        of importing them */
+                    Trade::Implementation::Duration d{importConversionTime};
+                    SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractImporter::mesh()"_s};
+                    if(!(mesh = importer->mesh(i))) {
+                        Error{} << "Cannot import mesh" << i;
+                        return 1;
+                    }
                 }
 
-                /* Set options, if passed. The AnySceneConverter check makes no
-                   sense here, is just there because the helper wants it */
-                if(args.isSet("verbose")) meshConverter->addFlags(Trade::SceneConverterFlag::Verbose);
-                if(j < args.arrayValueCount("mesh-converter-options"))
-                    Implementation::setOptions(*meshConverter, "AnySceneConverter", args.arrayValue("mesh-converter-options", j));
-
-                if(!(meshConverter->features() & (Trade::SceneConverterFeature::ConvertMesh))) {
-                    Error{} << meshConverterName << "doesn't support mesh conversion, only" << Debug::packed << meshConverter->features();
-                    return 1;
-                }
+                if(const int result = processMesh(converterManager, {}, args, singleMesh, i, mesh, conversionTime, allocations))
+                    return result;
 
-                /** @todo handle mesh levels here, once any plugin is capable
-                    of converting them */
-                if(Containers::Optional<Trade::MeshData> converted = meshConverter->convert(*mesh)) {
-                    mesh = Utility::move(converted);
-                } else if(passthroughOnConversionFailure) {
-                    Warning{} << "Cannot process mesh" << i << "with" << meshConverterName << Debug::nospace << ", passing the original through";
-                } else {
-                    Error{} << "Cannot process mesh" << i << "with" << meshConverterName;
-                    return 1;
-                }
+                arrayAppend(meshes, *Utility::move(mesh));
             }
-
-            arrayAppend(meshes, *Utility::move(mesh));
         }
     }
 
@@ -1131,6 +1554,9 @@ well, the IDs reference attributes of the first mesh.)")
        any, materials are supplied manually to the converter from the array
        below. */
     Containers::Array<Trade::MaterialData> materials;
+    /* Storage for materials produced by the Phong to PBR conversion, which
+       the above then references */
+    Containers::Array<Trade::MaterialData> convertedMaterials;
     if(args.isSet("phong-to-pbr") ||
        args.isSet("remove-duplicate-materials"))
     {
@@ -1140,30 +1566,46 @@ well, the IDs reference attributes of the first mesh.)")
             Containers::Optional<Trade::MaterialData> material;
             {
                 Trade::Implementation::Duration d{importConversionTime};
+                SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractImporter::material()"_s};
                 if(!(material = importer->material(i))) {
                     Error{} << "Cannot import material" << i;
                     return 1;
                 }
             }
 
-            /* Phong to PBR conversion */
-            if(args.isSet("phong-to-pbr")) {
-                if(args.isSet("verbose"))
-                    Debug{} << "Converting material" << i << "to PBR";
+            arrayAppend(materials, *Utility::move(material));
+        }
 
-                Trade::Implementation::Duration d{conversionTime};
-                /** @todo make the flags configurable as well? then the below
-                    assert can actually fire, convert to a runtime error */
-                material = MaterialTools::phongToPbrMetallicRoughness(*material, MaterialTools::PhongToPbrMetallicRoughnessFlag::DropUnconvertibleAttributes);
-                CORRADE_INTERNAL_ASSERT(material);
-            }
+        /* Phong to PBR conversion, done on all materials at once */
+        if(args.isSet("phong-to-pbr")) {
+            if(args.isSet("verbose"))
+                Debug{} << "Converting" << materials.size() << "materials to PBR";
 
-            arrayAppend(materials, *Utility::move(material));
+            Trade::Implementation::Duration d{conversionTime};
+            SceneTools::Implementation::AllocationScope a{allocations, "MaterialTools::phongToPbrMetallicRoughness()"_s};
+            /** @todo make the flags configurable as well? then the below
+                assert can actually fire, convert to a runtime error */
+            Containers::Optional<Containers::Array<Trade::MaterialData>> converted =
+                #ifdef MAGNUM_SCENECONVERTER_THREADS
+                threadCount > 1 ?
+                    MaterialTools::phongToPbrMetallicRoughness(materials, MaterialTools::PhongToPbrMetallicRoughnessFlag::DropUnconvertibleAttributes, parallelForThreads, &*threadPool) :
+                #endif
+                    MaterialTools::phongToPbrMetallicRoughness(materials, MaterialTools::PhongToPbrMetallicRoughnessFlag::DropUnconvertibleAttributes);
+            CORRADE_INTERNAL_ASSERT(converted);
+            convertedMaterials = *Utility::move(converted);
+
+            /* The converted materials live in a single allocation owned by
+               the array. Make the imported materials non-owning references to
+               them so they can be freely moved around by the duplicate
+               removal below. */
+            for(std::size_t i = 0; i != materials.size(); ++i)
+                materials[i] = Trade::MaterialData{convertedMaterials[i].types(), {}, convertedMaterials[i].attributeData(), {}, convertedMaterials[i].layerData()};
         }
 
         /* Duplicate removal */
         if(args.isSet("remove-duplicate-materials")) {
             Trade::Implementation::Duration d{conversionTime};
+            SceneTools::Implementation::AllocationScope a{allocations, "MaterialTools::removeDuplicatesInPlace()"_s};
 
             Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> mapping = MaterialTools::removeDuplicatesInPlace(materials);
             if(args.isSet("verbose"))
@@ -1228,6 +1670,7 @@ well, the IDs reference attributes of the first mesh.)")
         if(isLastConverter) {
             {
                 Trade::Implementation::Duration d{conversionTime};
+                SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractSceneConverter::beginFile()"_s};
                 if(!converter->beginFile(args.value("output"))) {
                     Error{} << "Cannot begin conversion of file" << args.value("output");
                     return 1;
@@ -1245,6 +1688,7 @@ well, the IDs reference attributes of the first mesh.)")
 
             {
                 Trade::Implementation::Duration d{conversionTime};
+                SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractSceneConverter::begin()"_s};
                 if(!converter->begin()) {
                     Error{} << "Cannot begin importer conversion";
                     return 1;
@@ -1269,6 +1713,7 @@ well, the IDs reference attributes of the first mesh.)")
                 Warning{} << "Ignoring" << images2D.size() << "2D images not supported by the converter";
             } else for(UnsignedInt j = 0; j != images2D.size(); ++j) {
                 Trade::Implementation::Duration d{conversionTime};
+                SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractSceneConverter::add()"_s};
                 if(!converter->add(images2D[j], contents & Trade::SceneContent::Names ? importer->image2DName(j) : Containers::String{})) {
                     Error{} << "Cannot add 2D image" << j;
                     return 1;
@@ -1292,6 +1737,7 @@ well, the IDs reference attributes of the first mesh.)")
                 Warning{} << "Ignoring" << images3D.size() << "3D images not supported by the converter";
             } else for(UnsignedInt j = 0; j != images3D.size(); ++j) {
                 Trade::Implementation::Duration d{conversionTime};
+                SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractSceneConverter::add()"_s};
                 if(!converter->add(images3D[j], contents & Trade::SceneContent::Names ? importer->image3DName(j) : Containers::String{})) {
                     Error{} << "Cannot add 3D image" << j;
                     return 1;
@@ -1321,6 +1767,7 @@ well, the IDs reference attributes of the first mesh.)")
                 Warning{} << "Ignoring" << meshes.size() << "meshes not supported by the converter";
             } else for(UnsignedInt j = 0; j != meshes.size(); ++j) {
                 Trade::Implementation::Duration d{conversionTime};
+                SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractSceneConverter::add()"_s};
 
                 const Trade::MeshData& mesh = meshes[j];
 
@@ -1378,6 +1825,7 @@ well, the IDs reference attributes of the first mesh.)")
                      Trade::SceneContent::Names);
 
                 Trade::Implementation::Duration d{importConversionTime};
+                SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractSceneConverter::addSupportedImporterContents()"_s};
                 if(!converter->addSupportedImporterContents(*importer, materialDependencies)) {
                     Error{} << "Cannot add material dependencies";
                     return 5;
@@ -1393,6 +1841,7 @@ well, the IDs reference attributes of the first mesh.)")
                 Warning{} << "Ignoring" << materials.size() << "materials not supported by the converter";
             } else for(UnsignedInt j = 0; j != materials.size(); ++j) {
                 Trade::Implementation::Duration d{conversionTime};
+                SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractSceneConverter::add()"_s};
 
                 if(!converter->add(materials[j], contents & Trade::SceneContent::Names ? importer->materialName(j) : Containers::String{})) {
                     Error{} << "Cannot add material" << j;
@@ -1430,6 +1879,7 @@ well, the IDs reference attributes of the first mesh.)")
                       Trade::SceneContent::Animations);
 
                 Trade::Implementation::Duration d{importConversionTime};
+                SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractSceneConverter::addSupportedImporterContents()"_s};
                 if(!converter->addSupportedImporterContents(*importer, sceneDependencies)) {
                     Error{} << "Cannot add scene dependencies";
                     return 5;
@@ -1445,6 +1895,7 @@ well, the IDs reference attributes of the first mesh.)")
                 Warning{} << "Ignoring" << scenes.size() << "scenes not supported by the converter";
             } else for(UnsignedInt j = 0; j != scenes.size(); ++j) {
                 Trade::Implementation::Duration d{conversionTime};
+                SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractSceneConverter::add()"_s};
 
                 if(!converter->add(scenes[j], contents & Trade::SceneContent::Names ? importer->sceneName(j) : Containers::String{})) {
                     Error{} << "Cannot add scene" << j;
@@ -1469,6 +1920,7 @@ well, the IDs reference attributes of the first mesh.)")
 
         {
             Trade::Implementation::Duration d{importConversionTime};
+            SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractSceneConverter::addSupportedImporterContents()"_s};
             if(!converter->addSupportedImporterContents(*importer, contents)) {
                 Error{} << "Cannot add importer contents";
                 return 5;
@@ -1479,6 +1931,7 @@ well, the IDs reference attributes of the first mesh.)")
            the end), end the file and exit the loop */
         if(isLastConverter) {
             Trade::Implementation::Duration d{conversionTime};
+            SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractSceneConverter::endFile()"_s};
             if(!converter->endFile()) {
                 Error{} << "Cannot end conversion of file" << args.value("output");
                 return 5;
@@ -1494,6 +1947,7 @@ well, the IDs reference attributes of the first mesh.)")
            returned from it. */
         } else {
             Trade::Implementation::Duration d{conversionTime};
+            SceneTools::Implementation::AllocationScope a{allocations, "Trade::AbstractSceneConverter::end()"_s};
             if(!(importer = converter->end())) {
                 Error{} << "Cannot end importer conversion";
                 return 1;
@@ -1502,7 +1956,14 @@ well, the IDs reference attributes of the first mesh.)")
     }
 
     if(args.isSet("profile")) {
+        if(args.arrayValueCount("image-converter"))
+            Debug{} << "Image import and processing took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(imageProcessingTime).count())/1.0e3f << "seconds";
+        if(meshProcessingTime != std::chrono::high_resolution_clock::duration{})
+            Debug{} << "Mesh import and processing took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(meshProcessingTime).count())/1.0e3f << "seconds";
+        if(threadCount > 1)
+            Debug{} << "Processing used" << threadCount << "threads, conversion time is summed across all threads";
         Debug{} << "Import and conversion took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(importConversionTime).count())/1.0e3f << "seconds, conversion"
             << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(conversionTime).count())/1.0e3f << "seconds";
+        printAllocationProfile(allocationProfile);
     }
 }
@@ -33,8 +33,12 @@
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once file callbacks are <string>-free */
+#include <Corrade/Containers/Reference.h>
 #include <Corrade/PluginManager/Manager.hpp>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/Path.h>
+#include <Corrade/Utility/Sha1.h>
 
 #include "Magnum/FileCallback.h"
 
@@ -79,15 +83,31 @@ Containers::Array<Containers::String> AbstractConverter::pluginSearchPaths() {
 }
 #endif
 
+struct AbstractConverter::CacheState {
+    Containers::String directory;
+    /* These are passed directly to the implementation, so they're remembered
+       here in order to be a part of the cache key. Each is serialized with
+       sizes of all strings to avoid different splits of the same
+       concatenated string resulting in the same key. */
+    Containers::String inputFormat, outputFormat, definitions, specializationConstants, optimizationLevel, debugInfoLevel;
+};
+
 AbstractConverter::AbstractConverter() = default;
 
 AbstractConverter::AbstractConverter(PluginManager::Manager<AbstractConverter>& manager): PluginManager::AbstractManagingPlugin<AbstractConverter>{manager} {}
 
 AbstractConverter::AbstractConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): PluginManager::AbstractManagingPlugin<AbstractConverter>{manager, plugin} {}
 
+AbstractConverter::~AbstractConverter() = default;
+
+AbstractConverter::CacheState& AbstractConverter::cacheState() {
+    if(!_cacheState) _cacheState.emplace();
+    return *_cacheState;
+}
+
 ConverterFeatures AbstractConverter::features() const {
     const ConverterFeatures features = doFeatures();
-    CORRADE_ASSERT(features & ~(ConverterFeature::InputFileCallback|ConverterFeature::Preprocess|ConverterFeature::Optimize|ConverterFeature::DebugInfo),
+    CORRADE_ASSERT(features & ~(ConverterFeature::InputFileCallback|ConverterFeature::SpecializationConstants|ConverterFeature::Optimize|ConverterFeature::DebugInfo),
         "ShaderTools::AbstractConverter::features(): implementation reported no features", {});
     return features;
 }
@@ -126,6 +146,7 @@ void AbstractConverter::setInputFileCallback(Containers::Optional<Containers::Ar
 void AbstractConverter::doSetInputFileCallback(Containers::Optional<Containers::ArrayView<const char>>(*)(const std::string&, InputFileCallbackPolicy, void*), void*) {}
 
 void AbstractConverter::setInputFormat(const Format format, const Containers::StringView version) {
+    cacheState().inputFormat = Utility::format("{}:{}:{}", UnsignedInt(format), version.size(), version);
     return doSetInputFormat(format, version);
 }
 
@@ -134,6 +155,7 @@ void AbstractConverter::setInputFormat(const Format format) {
 }
 
 void AbstractConverter::setOutputFormat(const Format format, const Containers::StringView version) {
+    cacheState().outputFormat = Utility::format("{}:{}:{}", UnsignedInt(format), version.size(), version);
     return doSetOutputFormat(format, version);
 }
 
@@ -144,6 +166,16 @@ void AbstractConverter::setOutputFormat(const Format format) {
 void AbstractConverter::setDefinitions(const Containers::ArrayView<const Containers::Pair<Containers::StringView, Containers::StringView>> definitions) {
     CORRADE_ASSERT(features() & ConverterFeature::Preprocess,
         "ShaderTools::AbstractConverter::setDefinitions(): feature not supported", );
+
+    /* A null value is an #undef, which is different from an empty value */
+    Containers::String serialized;
+    for(const Containers::Pair<Containers::StringView, Containers::StringView>& definition: definitions)
+        serialized = serialized + Utility::format("{}:{}{}{}:{}",
+            definition.first().size(), definition.first(),
+            definition.second().data() ? "=" : "!",
+            definition.second().size(), definition.second());
+    cacheState().definitions = Utility::move(serialized);
+
     doSetDefinitions(definitions);
 }
 
@@ -155,9 +187,37 @@ void AbstractConverter::doSetDefinitions(Containers::ArrayView<const Containers:
     CORRADE_ASSERT_UNREACHABLE("ShaderTools::AbstractConverter::setDefinitions(): feature advertised but not implemented", );
 }
 
+void AbstractConverter::setSpecializationConstants(const Containers::ArrayView<const Containers::Pair<Containers::StringView, UnsignedInt>> constants) {
+    CORRADE_ASSERT(features() >= ConverterFeature::SpecializationConstants,
+        "ShaderTools::AbstractConverter::setSpecializationConstants(): feature not supported", );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != constants.size(); ++i)
+        for(std::size_t j = 0; j != i; ++j)
+            CORRADE_ASSERT(constants[j].second() != constants[i].second(),
+                "ShaderTools::AbstractConverter::setSpecializationConstants(): constant ID" << constants[i].second() << "used for both" << constants[j].first() << "and" << constants[i].first(), );
+    #endif
+
+    Containers::String serialized;
+    for(const Containers::Pair<Containers::StringView, UnsignedInt>& constant: constants)
+        serialized = serialized + Utility::format("{}:{}={}:",
+            constant.first().size(), constant.first(), constant.second());
+    cacheState().specializationConstants = Utility::move(serialized);
+
+    doSetSpecializationConstants(constants);
+}
+
+void AbstractConverter::setSpecializationConstants(std::initializer_list<Containers::Pair<Containers::StringView, UnsignedInt>> constants) {
+    return setSpecializationConstants(Containers::arrayView(constants));
+}
+
+void AbstractConverter::doSetSpecializationConstants(Containers::ArrayView<const Containers::Pair<Containers::StringView, UnsignedInt>>) {
+    CORRADE_ASSERT_UNREACHABLE("ShaderTools::AbstractConverter::setSpecializationConstants(): feature advertised but not implemented", );
+}
+
 void AbstractConverter::setOptimizationLevel(const Containers::StringView level) {
     CORRADE_ASSERT(features() & ConverterFeature::Optimize,
         "ShaderTools::AbstractConverter::setOptimizationLevel(): feature not supported", );
+    cacheState().optimizationLevel = Containers::String{level};
     doSetOptimizationLevel(level);
 }
 
@@ -168,6 +228,7 @@ void AbstractConverter::doSetOptimizationLevel(Containers::StringView) {
 void AbstractConverter::setDebugInfoLevel(const Containers::StringView level) {
     CORRADE_ASSERT(features() & ConverterFeature::DebugInfo,
         "ShaderTools::AbstractConverter::setDebugInfoLevel(): feature not supported", );
+    cacheState().debugInfoLevel = Containers::String{level};
     doSetDebugInfoLevel(level);
 }
 
@@ -175,6 +236,116 @@ void AbstractConverter::doSetDebugInfoLevel(Containers::StringView) {
     CORRADE_ASSERT_UNREACHABLE("ShaderTools::AbstractConverter::setDebugInfoLevel(): feature advertised but not implemented", );
 }
 
+Containers::StringView AbstractConverter::cacheDirectory() const {
+    return _cacheState ? Containers::StringView{_cacheState->directory} : Containers::StringView{};
+}
+
+void AbstractConverter::setCacheDirectory(const Containers::StringView directory) {
+    cacheState().directory = Containers::String::nullTerminatedGlobalView(directory);
+}
+
+namespace {
+
+void hashString(Utility::Sha1& hash, const Containers::StringView string) {
+    /* Prefix with the size to avoid different splits of the same
+       concatenated string resulting in the same key */
+    const std::size_t size = string.size();
+    hash << Containers::arrayView(reinterpret_cast<const char*>(&size), sizeof(std::size_t))
+         << Containers::arrayView(string.data(), string.size());
+}
+
+void hashConfiguration(Utility::Sha1& hash, const Utility::ConfigurationGroup& group) {
+    for(const Containers::Pair<Containers::StringView, Containers::StringView> value: group.values()) {
+        hashString(hash, value.first());
+        hashString(hash, value.second());
+    }
+    for(const Containers::Pair<Containers::StringView, Containers::Reference<const Utility::ConfigurationGroup>> subgroup: group.groups()) {
+        /* Delimit the subgroup so its values can't be confused with values
+           of the parent */
+        hashString(hash, "["_s);
+        hashString(hash, subgroup.first());
+        hashConfiguration(hash, subgroup.second());
+        hashString(hash, "]"_s);
+    }
+}
+
+}
+
+Containers::String AbstractConverter::cacheKey(const Stage stage, const Containers::StringView filename, const Containers::ArrayView<const char> data) {
+    if(!_cacheState || _cacheState->directory.isEmpty()) return {};
+
+    Utility::Sha1 hash;
+    hashString(hash, pluginInterface());
+    hashString(hash, plugin());
+    hashConfiguration(hash, configuration());
+
+    /* Quiet and Verbose affect only the messages, not the output */
+    const UnsignedInt flags = UnsignedInt(_flags & ~(ConverterFlag::Quiet|ConverterFlag::Verbose));
+    const UnsignedInt stageValue = UnsignedInt(stage);
+    hash << Containers::arrayView(reinterpret_cast<const char*>(&flags), sizeof(UnsignedInt))
+         << Containers::arrayView(reinterpret_cast<const char*>(&stageValue), sizeof(UnsignedInt));
+
+    for(const Containers::StringView string: {
+        Containers::StringView{_cacheState->inputFormat},
+        Containers::StringView{_cacheState->outputFormat},
+        Containers::StringView{_cacheState->definitions},
+        Containers::StringView{_cacheState->specializationConstants},
+        Containers::StringView{_cacheState->optimizationLevel},
+        Containers::StringView{_cacheState->debugInfoLevel},
+        filename
+    }) hashString(hash, string);
+
+    hashString(hash, Containers::StringView{data.data(), data.size()});
+
+    constexpr const char Hex[]{"0123456789abcdef"};
+    const Utility::Sha1::Digest digest = hash.digest();
+    Containers::String key{NoInit, Utility::Sha1::DigestSize*2};
+    for(std::size_t i = 0; i != Utility::Sha1::DigestSize; ++i) {
+        const UnsignedByte byte = digest.byteArray()[i];
+        key[i*2 + 0] = Hex[byte >> 4];
+        key[i*2 + 1] = Hex[byte & 0xf];
+    }
+    return key;
+}
+
+Containers::String AbstractConverter::cacheFileKey(const Stage stage, const Containers::StringView filename) {
+    if(!_cacheState || _cacheState->directory.isEmpty()) return {};
+
+    /* If the file can't be read, the conversion itself will fail and print
+       a message, so don't print anything here */
+    if(_inputFileCallback) {
+        const Containers::Optional<Containers::ArrayView<const char>> data = _inputFileCallback(filename, InputFileCallbackPolicy::LoadTemporary, _inputFileCallbackUserData);
+        if(!data) return {};
+        Containers::String key = cacheKey(stage, filename, *data);
+        _inputFileCallback(filename, InputFileCallbackPolicy::Close, _inputFileCallbackUserData);
+        return key;
+    }
+
+    if(!Utility::Path::exists(filename)) return {};
+    const Containers::Optional<Containers::Array<char>> data = Utility::Path::read(filename);
+    if(!data) return {};
+    return cacheKey(stage, filename, *data);
+}
+
+Containers::Optional<Containers::Array<char>> AbstractConverter::cacheLoad(const Containers::StringView key) {
+    const Containers::String filename = Utility::Path::join(_cacheState->directory, key);
+    if(!Utility::Path::exists(filename)) return {};
+    return Utility::Path::read(filename);
+}
+
+void AbstractConverter::cacheStore(const Containers::StringView key, const Containers::ArrayView<const char> data) {
+    /* Failures are printed by the Path APIs already and aren't fatal, the
+       conversion result is returned regardless */
+    if(!Utility::Path::make(_cacheState->directory)) return;
+
+    /* Write to a temporary file first and then rename it so another process
+       sharing the cache never sees a partially written file */
+    const Containers::String filename = Utility::Path::join(_cacheState->directory, key);
+    const Containers::String temporaryFilename = filename + ".tmp"_s;
+    if(Utility::Path::write(temporaryFilename, data))
+        Utility::Path::move(temporaryFilename, filename);
+}
+
 Containers::Pair<bool, Containers::String> AbstractConverter::validateData(const Stage stage, const Containers::ArrayView<const void> data) {
     CORRADE_ASSERT(features() & ConverterFeature::ValidateData,
         "ShaderTools::AbstractConverter::validateData(): feature not supported", {});
@@ -272,9 +443,22 @@ AbstractConverter::convertDataToData(const Stage stage, const Containers::ArrayV
         "ShaderTools::AbstractConverter::convertDataToData(): feature not supported", {});
 
     /* Cast to a non-void type for more convenience */
-    Containers::Optional<Containers::Array<char>> out = doConvertDataToData(stage, Containers::arrayCast<const char>(data));
+    const Containers::ArrayView<const char> dataChar = Containers::arrayCast<const char>(data);
+
+    /* Serve from the cache, if there */
+    const Containers::String key = cacheKey(stage, {}, dataChar);
+    if(!key.isEmpty()) if(Containers::Optional<Containers::Array<char>> cached = cacheLoad(key)) {
+        #ifdef MAGNUM_BUILD_DEPRECATED
+        return Implementation::OptionalButAlsoArray<char>{Utility::move(cached)};
+        #else
+        return cached;
+        #endif
+    }
+
+    Containers::Optional<Containers::Array<char>> out = doConvertDataToData(stage, dataChar);
     CORRADE_ASSERT(!out || !out->deleter(),
         "ShaderTools::AbstractConverter::convertDataToData(): implementation is not allowed to use a custom Array deleter", {});
+    if(!key.isEmpty() && out) cacheStore(key, *out);
 
     /* GCC 4.8 needs an explicit conversion here */
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -295,8 +479,17 @@ bool AbstractConverter::convertDataToFile(const Stage stage, const Containers::A
     /** @todo this needs expansion once output callbacks are supported as well */
 
     /* Cast to a non-void type for more convenience */
-    const Containers::Optional<Containers::Array<char>> out = doConvertDataToData(stage, Containers::arrayCast<const char>(data));
-    if(!out) return false;
+    const Containers::ArrayView<const char> dataChar = Containers::arrayCast<const char>(data);
+
+    /* Take the output from the cache, if there */
+    const Containers::String key = cacheKey(stage, {}, dataChar);
+    Containers::Optional<Containers::Array<char>> out;
+    if(!key.isEmpty()) out = cacheLoad(key);
+    if(!out) {
+        out = doConvertDataToData(stage, dataChar);
+        if(!out) return false;
+        if(!key.isEmpty()) cacheStore(key, *out);
+    }
 
     if(!Utility::Path::write(filename, *out)) {
         Error{} << "ShaderTools::AbstractConverter::convertDataToFile(): cannot write to file" << filename;
@@ -323,10 +516,28 @@ bool AbstractConverter::convertFileToFile(const Stage stage, const Containers::S
 
     /** @todo this needs expansion once output callbacks are supported as well */
 
+    /* Take the output from the cache, if there */
+    const Containers::String key = cacheFileKey(stage, from);
+    if(!key.isEmpty()) if(const Containers::Optional<Containers::Array<char>> cached = cacheLoad(key)) {
+        if(!Utility::Path::write(to, *cached)) {
+            Error{} << "ShaderTools::AbstractConverter::convertFileToFile(): cannot write to file" << to;
+            return false;
+        }
+
+        return true;
+    }
+
     /* If input file callbacks are not set or the converter supports handling
        them directly, call into the implementation */
     if(!_inputFileCallback || (doFeatures() & ConverterFeature::InputFileCallback)) {
-        return doConvertFileToFile(stage, from, to);
+        if(!doConvertFileToFile(stage, from, to)) return false;
+
+        /* The implementation wrote the output directly, read it back in
+           order to put it into the cache */
+        if(!key.isEmpty()) if(const Containers::Optional<Containers::Array<char>> out = Utility::Path::read(to))
+            cacheStore(key, *out);
+
+        return true;
 
     /* Otherwise, if converting data is supported, use the callback and pass
        the data through to convertDataToData(). Mark the file as ready to be
@@ -344,6 +555,7 @@ bool AbstractConverter::convertFileToFile(const Stage stage, const Containers::S
               branch is never taken in that case) */
         const Containers::Optional<Containers::Array<char>> out = convertDataToDataUsingInputFileCallbacks("ShaderTools::AbstractConverter::convertFileToFile():", stage, from);
         if(!out) return false;
+        if(!key.isEmpty()) cacheStore(key, *out);
 
         if(!Utility::Path::write(to, *out)) {
             Error{} << "ShaderTools::AbstractConverter::convertFileToFile(): cannot write to file" << to;
@@ -397,6 +609,16 @@ AbstractConverter::convertFileToData(const Stage stage, const Containers::String
     CORRADE_ASSERT(features() >= ConverterFeature::ConvertData,
         "ShaderTools::AbstractConverter::convertFileToData(): feature not supported", {});
 
+    /* Serve from the cache, if there */
+    const Containers::String key = cacheFileKey(stage, filename);
+    if(!key.isEmpty()) if(Containers::Optional<Containers::Array<char>> cached = cacheLoad(key)) {
+        #ifdef MAGNUM_BUILD_DEPRECATED
+        return Implementation::OptionalButAlsoArray<char>{Utility::move(cached)};
+        #else
+        return cached;
+        #endif
+    }
+
     Containers::Optional<Containers::Array<char>> out;
 
     /* If input file callbacks are not set or the converter supports handling
@@ -423,6 +645,7 @@ AbstractConverter::convertFileToData(const Stage stage, const Containers::String
 
     CORRADE_ASSERT(!out || !out->deleter(),
         "ShaderTools::AbstractConverter::convertFileToData(): implementation is not allowed to use a custom Array deleter", {});
+    if(!key.isEmpty() && out) cacheStore(key, *out);
 
     /* GCC 4.8 needs an explicit conversion here */
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -746,6 +969,7 @@ Debug& operator<<(Debug& debug, const ConverterFeature value) {
         _c(LinkFile)
         _c(InputFileCallback)
         _c(Preprocess)
+        _c(SpecializationConstants)
         _c(Optimize)
         _c(DebugInfo)
         #undef _c
@@ -767,6 +991,8 @@ Debug& operator<<(Debug& debug, const ConverterFeatures value) {
         /* Implied by LinkData, has to be after */
         ConverterFeature::LinkFile,
         ConverterFeature::InputFileCallback,
+        ConverterFeature::SpecializationConstants,
+        /* Implied by SpecializationConstants, has to be after */
         ConverterFeature::Preprocess,
         ConverterFeature::Optimize,
         ConverterFeature::DebugInfo
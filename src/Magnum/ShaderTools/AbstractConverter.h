@@ -32,6 +32,7 @@
  */
 
 #include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/Pointer.h>
 #include <Corrade/PluginManager/AbstractManagingPlugin.h>
 #include <Corrade/Utility/StlForwardString.h> /** @todo remove once file callbacks are std::string-free */
 
@@ -129,7 +130,15 @@ enum class ConverterFeature: UnsignedInt {
      * Control amount of debug info present in the output using
      * @ref AbstractConverter::setDebugInfoLevel()
      */
-    DebugInfo = 1 << 9
+    DebugInfo = 1 << 9,
+
+    /**
+     * Turn selected preprocessor definitions into specialization constants
+     * using @ref AbstractConverter::setSpecializationConstants(). Implies
+     * @ref ConverterFeature::Preprocess.
+     * @m_since_latest
+     */
+    SpecializationConstants = Preprocess|(1 << 10)
 };
 
 /**
@@ -365,6 +374,21 @@ produce the usual assertions.
     (providing the particular converter implementation supports preprocessor
     includes).
 
+@subsection ShaderTools-AbstractConverter-usage-specialization Reducing shader variant count
+
+Compiling a separate module for every combination of preprocessor definitions
+quickly leads to a combinatorial explosion. For converters that support
+@ref ConverterFeature::SpecializationConstants, selected definitions can be
+turned into SPIR-V specialization constants with
+@ref setSpecializationConstants() instead. The value set via
+@ref setDefinitions() then becomes just the default, and a single module can be
+specialized at pipeline creation time using
+@ref Vk::ShaderSet::addSpecializations(). Combined with
+@ref setOptimizationLevel(), dead code depending on the constants gets
+eliminated by the driver once the pipeline is created:
+
+@snippet ShaderTools.cpp AbstractConverter-usage-specialization
+
 @subsection ShaderTools-AbstractConverter-usage-validation Shader validation
 
 As is common with other plugin interfaces, the
@@ -439,6 +463,27 @@ The input file callback signature is the same for
 @ref ShaderTools::AbstractConverter, @ref Trade::AbstractImporter and
 @ref Text::AbstractFont to allow code reuse.
 
+@subsection ShaderTools-AbstractConverter-usage-cache Conversion cache
+
+Compiling a large amount of shader variants can take a significant time. By
+setting a directory with @ref setCacheDirectory(), results of
+@ref convertDataToData(), @ref convertDataToFile(), @ref convertFileToData()
+and @ref convertFileToFile() get stored there and subsequent conversions of
+the same input with the same setup are served from the cache without calling
+into the plugin implementation:
+
+@snippet ShaderTools.cpp AbstractConverter-usage-cache
+
+The cache key is a SHA-1 hash of the input data, the input filename for file
+conversions, @ref Stage, plugin name, @ref pluginInterface() string, plugin
+configuration, flags except @ref ConverterFlag::Quiet and
+@ref ConverterFlag::Verbose and everything passed to @ref setInputFormat(),
+@ref setOutputFormat(), @ref setDefinitions(), @ref setOptimizationLevel() and
+@ref setDebugInfoLevel(). Files pulled in through @cpp #include @ce
+directives aren't a part of the key and neither is a version of the plugin
+or the underlying library, so clear the cache directory when those change.
+Failed conversions aren't cached.
+
 @section ShaderTools-AbstractConverter-data-dependency Data dependency
 
 The instances returned from various functions *by design* have no dependency on
@@ -528,6 +573,8 @@ class MAGNUM_SHADERTOOLS_EXPORT AbstractConverter: public PluginManager::Abstrac
            header. */
         explicit AbstractConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
 
+        ~AbstractConverter();
+
         /** @brief Features supported by this converter */
         ConverterFeatures features() const;
 
@@ -737,6 +784,30 @@ class MAGNUM_SHADERTOOLS_EXPORT AbstractConverter: public PluginManager::Abstrac
         /** @overload */
         void setDefinitions(std::initializer_list<Containers::Pair<Containers::StringView, Containers::StringView>> definitions);
 
+        /**
+         * @brief Set definitions to be turned into specialization constants
+         * @m_since_latest
+         *
+         * Available only if @ref ConverterFeature::SpecializationConstants
+         * is supported. First string is macro name, second a specialization
+         * constant ID. Instead of being substituted by the preprocessor, each
+         * listed macro is emitted as a specialization constant with given ID,
+         * with its value from @ref setDefinitions() used as the default. The
+         * IDs are expected to be unique.
+         *
+         * Calling this function replaces the previous set, calling it with an
+         * empty list will turn all definitions back into preprocessor
+         * macros. See @ref ShaderTools-AbstractConverter-usage-specialization
+         * for an example.
+         *
+         * Corresponds to the `--specialize` option in
+         * @ref magnum-shaderconverter "magnum-shaderconverter".
+         */
+        void setSpecializationConstants(Containers::ArrayView<const Containers::Pair<Containers::StringView, UnsignedInt>> constants);
+
+        /** @overload */
+        void setSpecializationConstants(std::initializer_list<Containers::Pair<Containers::StringView, UnsignedInt>> constants);
+
         /**
          * @brief Set optimization level
          *
@@ -773,6 +844,32 @@ class MAGNUM_SHADERTOOLS_EXPORT AbstractConverter: public PluginManager::Abstrac
          */
         void setDebugInfoLevel(Containers::StringView level);
 
+        /**
+         * @brief Conversion cache directory
+         * @m_since_latest
+         *
+         * Empty if the cache is disabled, which is the default.
+         * @see @ref setCacheDirectory()
+         */
+        Containers::StringView cacheDirectory() const;
+
+        /**
+         * @brief Set conversion cache directory
+         * @m_since_latest
+         *
+         * If non-empty, @ref convertDataToData(), @ref convertDataToFile(),
+         * @ref convertFileToData() and @ref convertFileToFile() look for a
+         * result of an equivalent conversion in @p directory first and store
+         * successful results there. The directory is created on first use
+         * if it doesn't exist. Pass an empty string to disable the cache
+         * again. See @ref ShaderTools-AbstractConverter-usage-cache for more
+         * information.
+         *
+         * Corresponds to the `--cache-dir` option in
+         * @ref magnum-shaderconverter "magnum-shaderconverter".
+         */
+        void setCacheDirectory(Containers::StringView directory);
+
         /**
          * @brief Validate a shader
          *
@@ -1114,6 +1211,21 @@ class MAGNUM_SHADERTOOLS_EXPORT AbstractConverter: public PluginManager::Abstrac
          */
         virtual void doSetDefinitions(Containers::ArrayView<const Containers::Pair<Containers::StringView, Containers::StringView>> definitions);
 
+        /**
+         * @brief Implementation for @ref setSpecializationConstants()
+         * @m_since_latest
+         *
+         * Has to be implemented if
+         * @ref ConverterFeature::SpecializationConstants is supported. This
+         * function isn't expected to fail --- if a constant doesn't
+         * correspond to any definition or the definition can't be expressed
+         * as a specialization constant, the following
+         * @ref convertDataToData(), @ref convertDataToFile(),
+         * @ref convertFileToFile() or @ref convertFileToData() should fail
+         * instead.
+         */
+        virtual void doSetSpecializationConstants(Containers::ArrayView<const Containers::Pair<Containers::StringView, UnsignedInt>> constants);
+
         /**
          * @brief Implementation for @ref setOptimizationLevel()
          *
@@ -1178,8 +1290,24 @@ class MAGNUM_SHADERTOOLS_EXPORT AbstractConverter: public PluginManager::Abstrac
          */
         virtual Containers::Optional<Containers::Array<char>> doLinkDataToData(Containers::ArrayView<const Containers::Pair<Stage, Containers::ArrayView<const char>>> data);
 
+        struct CacheState;
+
+        MAGNUM_SHADERTOOLS_LOCAL CacheState& cacheState();
+        /* Returns an empty string if the cache isn't enabled. The filename
+           is empty for data conversion. */
+        MAGNUM_SHADERTOOLS_LOCAL Containers::String cacheKey(Stage stage, Containers::StringView filename, Containers::ArrayView<const char> data);
+        /* Reads the file in order to calculate the key. Returns an empty
+           string also if the file can't be read. */
+        MAGNUM_SHADERTOOLS_LOCAL Containers::String cacheFileKey(Stage stage, Containers::StringView filename);
+        MAGNUM_SHADERTOOLS_LOCAL Containers::Optional<Containers::Array<char>> cacheLoad(Containers::StringView key);
+        MAGNUM_SHADERTOOLS_LOCAL void cacheStore(Containers::StringView key, Containers::ArrayView<const char> data);
+
         ConverterFlags _flags;
 
+        /* Set up lazily, holds also everything that's a part of the cache
+           key but isn't stored anywhere else */
+        Containers::Pointer<CacheState> _cacheState;
+
         Containers::Optional<Containers::ArrayView<const char>>(*_inputFileCallback)(const std::string&, InputFileCallbackPolicy, void*){};
         void* _inputFileCallbackUserData{};
 
@@ -1209,7 +1337,7 @@ updated interface string.
 */
 /* Silly indentation to make the string appear in pluginInterface() docs */
 #define MAGNUM_SHADERTOOLS_ABSTRACTCONVERTER_PLUGIN_INTERFACE /* [interface] */ \
-"cz.mosra.magnum.ShaderTools.AbstractConverter/0.1.1"
+"cz.mosra.magnum.ShaderTools.AbstractConverter/0.1.3"
 /* [interface] */
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -62,6 +62,11 @@ struct AbstractConverterTest: TestSuite::Tester {
     void setDefinitionsNotSupported();
     void setDefinitionsNotImplemented();
 
+    void setSpecializationConstants();
+    void setSpecializationConstantsNotSupported();
+    void setSpecializationConstantsNotImplemented();
+    void setSpecializationConstantsDuplicateId();
+
     void setOptimizationLevel();
     void setOptimizationLevelNotSupported();
     void setOptimizationLevelNotImplemented();
@@ -114,6 +119,10 @@ struct AbstractConverterTest: TestSuite::Tester {
     void convertFileToDataNotImplemented();
     void convertFileToDataCustomDeleter();
 
+    void cacheDataToData();
+    void cacheFileToFile();
+    void cacheFileToData();
+
     void linkDataToData();
     void linkDataToDataFailed();
     void linkDataToDataNotSupported();
@@ -214,6 +223,11 @@ AbstractConverterTest::AbstractConverterTest() {
               &AbstractConverterTest::setDefinitionsNotSupported,
               &AbstractConverterTest::setDefinitionsNotImplemented,
 
+              &AbstractConverterTest::setSpecializationConstants,
+              &AbstractConverterTest::setSpecializationConstantsNotSupported,
+              &AbstractConverterTest::setSpecializationConstantsNotImplemented,
+              &AbstractConverterTest::setSpecializationConstantsDuplicateId,
+
               &AbstractConverterTest::setOptimizationLevel,
               &AbstractConverterTest::setOptimizationLevelNotSupported,
               &AbstractConverterTest::setOptimizationLevelNotImplemented,
@@ -266,6 +280,10 @@ AbstractConverterTest::AbstractConverterTest() {
               &AbstractConverterTest::convertFileToDataNotImplemented,
               &AbstractConverterTest::convertFileToDataCustomDeleter,
 
+              &AbstractConverterTest::cacheDataToData,
+              &AbstractConverterTest::cacheFileToFile,
+              &AbstractConverterTest::cacheFileToData,
+
               &AbstractConverterTest::linkDataToData,
               &AbstractConverterTest::linkDataToDataFailed,
               &AbstractConverterTest::linkDataToDataNotSupported,
@@ -571,6 +589,96 @@ void AbstractConverterTest::setDefinitionsNotImplemented() {
     CORRADE_COMPARE(out.str(), "ShaderTools::AbstractConverter::setDefinitions(): feature advertised but not implemented\n");
 }
 
+void AbstractConverterTest::setSpecializationConstants() {
+    struct: AbstractConverter {
+        ConverterFeatures doFeatures() const override {
+            return ConverterFeature::SpecializationConstants|ConverterFeature::ConvertData;
+        }
+        void doSetInputFormat(Format, Containers::StringView) override {}
+        void doSetOutputFormat(Format, Containers::StringView) override {}
+        void doSetDefinitions(Containers::ArrayView<const Containers::Pair<Containers::StringView, Containers::StringView>>) override {}
+
+        void doSetSpecializationConstants(Containers::ArrayView<const Containers::Pair<Containers::StringView, UnsignedInt>> constants) override {
+            howManyIsThere = constants.size();
+            lastId = constants.back().second();
+        }
+
+        std::size_t howManyIsThere = 0;
+        UnsignedInt lastId = 0;
+    } converter;
+
+    /* Preprocess is implied */
+    CORRADE_VERIFY(converter.features() >= ConverterFeature::Preprocess);
+    converter.setDefinitions({
+        {"LIGHT_COUNT", "3"},
+        {"TEXTURED", "0"}
+    });
+
+    converter.setSpecializationConstants({
+        {"LIGHT_COUNT", 0},
+        {"TEXTURED", 7}
+    });
+    CORRADE_COMPARE(converter.howManyIsThere, 2);
+    CORRADE_COMPARE(converter.lastId, 7);
+}
+
+void AbstractConverterTest::setSpecializationConstantsNotSupported() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractConverter {
+        ConverterFeatures doFeatures() const override {
+            /* Preprocess alone isn't enough */
+            return ConverterFeature::Preprocess|ConverterFeature::ConvertData;
+        }
+        void doSetInputFormat(Format, Containers::StringView) override {}
+        void doSetOutputFormat(Format, Containers::StringView) override {}
+    } converter;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.setSpecializationConstants({});
+    CORRADE_COMPARE(out.str(), "ShaderTools::AbstractConverter::setSpecializationConstants(): feature not supported\n");
+}
+
+void AbstractConverterTest::setSpecializationConstantsNotImplemented() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractConverter {
+        ConverterFeatures doFeatures() const override {
+            return ConverterFeature::SpecializationConstants|ConverterFeature::ConvertData;
+        }
+        void doSetInputFormat(Format, Containers::StringView) override {}
+        void doSetOutputFormat(Format, Containers::StringView) override {}
+    } converter;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.setSpecializationConstants({});
+    CORRADE_COMPARE(out.str(), "ShaderTools::AbstractConverter::setSpecializationConstants(): feature advertised but not implemented\n");
+}
+
+void AbstractConverterTest::setSpecializationConstantsDuplicateId() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractConverter {
+        ConverterFeatures doFeatures() const override {
+            return ConverterFeature::SpecializationConstants|ConverterFeature::ConvertData;
+        }
+        void doSetInputFormat(Format, Containers::StringView) override {}
+        void doSetOutputFormat(Format, Containers::StringView) override {}
+        void doSetSpecializationConstants(Containers::ArrayView<const Containers::Pair<Containers::StringView, UnsignedInt>>) override {}
+    } converter;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.setSpecializationConstants({
+        {"LIGHT_COUNT", 0},
+        {"TEXTURED", 3},
+        {"SKINNED", 3}
+    });
+    CORRADE_COMPARE(out.str(), "ShaderTools::AbstractConverter::setSpecializationConstants(): constant ID 3 used for both TEXTURED and SKINNED\n");
+}
+
 void AbstractConverterTest::setOptimizationLevel() {
     struct: AbstractConverter {
         ConverterFeatures doFeatures() const override {
@@ -1460,6 +1568,160 @@ void AbstractConverterTest::convertFileToDataCustomDeleter() {
     CORRADE_COMPARE(out.str(), "ShaderTools::AbstractConverter::convertFileToData(): implementation is not allowed to use a custom Array deleter\n");
 }
 
+Containers::String emptyCacheDirectory(const Containers::StringView name) {
+    const Containers::String directory = Utility::Path::join(SHADERTOOLS_TEST_OUTPUT_DIR, name);
+    if(Utility::Path::exists(directory)) {
+        Containers::Optional<Containers::Array<Containers::String>> files = Utility::Path::list(directory, Utility::Path::ListFlag::SkipDirectories|Utility::Path::ListFlag::SkipDotAndDotDot);
+        CORRADE_INTERNAL_ASSERT(files);
+        for(const Containers::String& file: *files)
+            CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Path::remove(Utility::Path::join(directory, file)));
+    }
+    return directory;
+}
+
+void AbstractConverterTest::cacheDataToData() {
+    struct: AbstractConverter {
+        ConverterFeatures doFeatures() const override {
+            return ConverterFeature::ConvertData|ConverterFeature::Preprocess;
+        }
+        void doSetInputFormat(Format, Containers::StringView) override {}
+        void doSetOutputFormat(Format, Containers::StringView) override {}
+        void doSetDefinitions(Containers::ArrayView<const Containers::Pair<Containers::StringView, Containers::StringView>>) override {}
+
+        Containers::Optional<Containers::Array<char>> doConvertDataToData(Stage, Containers::ArrayView<const char> data) override {
+            ++calls;
+            if(data.front() == 'X') return {};
+            return Containers::array({data.back(), data.front()});
+        }
+
+        Int calls = 0;
+    } converter;
+
+    /* Disabled by default */
+    CORRADE_COMPARE(converter.cacheDirectory(), "");
+
+    const Containers::String directory = emptyCacheDirectory("cache-data");
+    converter.setCacheDirectory(directory);
+    CORRADE_COMPARE(converter.cacheDirectory(), directory);
+
+    /* The first conversion calls into the implementation, the second is
+       served from the cache */
+    const char data[] = {'S', 'P', 'I', 'R', 'V'};
+    for(std::size_t i: {0, 1}) {
+        CORRADE_ITERATION(i);
+        Containers::Optional<Containers::Array<char>> out = converter.convertDataToData({}, data);
+        CORRADE_VERIFY(out);
+        CORRADE_COMPARE_AS(*out, Containers::arrayView({'V', 'S'}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE(converter.calls, 1);
+    }
+
+    /* Different stage, definitions or an undefine instead of an empty
+       define are all different keys */
+    CORRADE_VERIFY(converter.convertDataToData(Stage::Fragment, data));
+    CORRADE_COMPARE(converter.calls, 2);
+    converter.setDefinitions({{"A", ""}});
+    CORRADE_VERIFY(converter.convertDataToData({}, data));
+    CORRADE_COMPARE(converter.calls, 3);
+    converter.setDefinitions({{"A", nullptr}});
+    CORRADE_VERIFY(converter.convertDataToData({}, data));
+    CORRADE_COMPARE(converter.calls, 4);
+
+    /* Data to file uses the same cache */
+    const Containers::String filename = Utility::Path::join(SHADERTOOLS_TEST_OUTPUT_DIR, "file.out");
+    CORRADE_VERIFY(converter.convertDataToFile({}, data, filename));
+    CORRADE_COMPARE(converter.calls, 4);
+    CORRADE_COMPARE_AS(filename, "VS",
+        TestSuite::Compare::FileToString);
+
+    /* Failures aren't cached */
+    const char invalid[] = {'X', 'Y'};
+    CORRADE_VERIFY(!converter.convertDataToData({}, invalid));
+    CORRADE_VERIFY(!converter.convertDataToData({}, invalid));
+    CORRADE_COMPARE(converter.calls, 6);
+
+    /* Disabling the cache calls into the implementation again */
+    converter.setCacheDirectory({});
+    CORRADE_COMPARE(converter.cacheDirectory(), "");
+    CORRADE_VERIFY(converter.convertDataToData({}, data));
+    CORRADE_COMPARE(converter.calls, 7);
+}
+
+void AbstractConverterTest::cacheFileToFile() {
+    struct: AbstractConverter {
+        ConverterFeatures doFeatures() const override {
+            return ConverterFeature::ConvertFile;
+        }
+        void doSetInputFormat(Format, Containers::StringView) override {}
+        void doSetOutputFormat(Format, Containers::StringView) override {}
+
+        bool doConvertFileToFile(Stage, const Containers::StringView from, const Containers::StringView to) override {
+            ++calls;
+            Containers::Optional<Containers::Array<char>> data = Utility::Path::read(from);
+            CORRADE_VERIFY(data);
+            return Utility::Path::write(to, Containers::array({data->back(), data->front()}));
+        }
+
+        Int calls = 0;
+    } converter;
+
+    converter.setCacheDirectory(emptyCacheDirectory("cache-file-to-file"));
+
+    /* The second conversion is served from the cache, even though the
+       implementation writes the file directly */
+    const Containers::String filename = Utility::Path::join(SHADERTOOLS_TEST_OUTPUT_DIR, "file.out");
+    for(std::size_t i: {0, 1}) {
+        CORRADE_ITERATION(i);
+        if(Utility::Path::exists(filename))
+            CORRADE_VERIFY(Utility::Path::remove(filename));
+
+        CORRADE_VERIFY(converter.convertFileToFile({}, Utility::Path::join(SHADERTOOLS_TEST_DIR, "file.dat"), filename));
+        CORRADE_COMPARE_AS(filename, "VS",
+            TestSuite::Compare::FileToString);
+        CORRADE_COMPARE(converter.calls, 1);
+    }
+
+    /* A different file is a different key */
+    CORRADE_VERIFY(converter.convertFileToFile({}, Utility::Path::join(SHADERTOOLS_TEST_DIR, "another.dat"), filename));
+    CORRADE_COMPARE_AS(filename, "\nV",
+        TestSuite::Compare::FileToString);
+    CORRADE_COMPARE(converter.calls, 2);
+}
+
+void AbstractConverterTest::cacheFileToData() {
+    struct: AbstractConverter {
+        ConverterFeatures doFeatures() const override {
+            return ConverterFeature::ConvertData;
+        }
+        void doSetInputFormat(Format, Containers::StringView) override {}
+        void doSetOutputFormat(Format, Containers::StringView) override {}
+
+        Containers::Optional<Containers::Array<char>> doConvertDataToData(Stage, Containers::ArrayView<const char> data) override {
+            ++calls;
+            return Containers::array({data.back(), data.front()});
+        }
+
+        Int calls = 0;
+    } converter;
+
+    converter.setCacheDirectory(emptyCacheDirectory("cache-file-to-data"));
+
+    for(std::size_t i: {0, 1}) {
+        CORRADE_ITERATION(i);
+        Containers::Optional<Containers::Array<char>> out = converter.convertFileToData({}, Utility::Path::join(SHADERTOOLS_TEST_DIR, "file.dat"));
+        CORRADE_VERIFY(out);
+        CORRADE_COMPARE_AS(*out, Containers::arrayView({'V', 'S'}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE(converter.calls, 1);
+    }
+
+    /* Converting the same contents from data is a different key, as the
+       filename may affect the output */
+    const char data[] = {'S', 'P', 'I', 'R', 'V'};
+    CORRADE_VERIFY(converter.convertDataToData({}, data));
+    CORRADE_COMPARE(converter.calls, 2);
+}
+
 void AbstractConverterTest::linkDataToData() {
     struct: AbstractConverter {
         ConverterFeatures doFeatures() const override {
@@ -3579,6 +3841,13 @@ void AbstractConverterTest::debugFeaturesSupersets() {
         std::ostringstream out;
         Debug{&out} << (ConverterFeature::LinkData|ConverterFeature::LinkFile);
         CORRADE_COMPARE(out.str(), "ShaderTools::ConverterFeature::LinkData\n");
+
+    /* SpecializationConstants is a superset of Preprocess, so only one should
+       be printed */
+    } {
+        std::ostringstream out;
+        Debug{&out} << (ConverterFeature::SpecializationConstants|ConverterFeature::Preprocess);
+        CORRADE_COMPARE(out.str(), "ShaderTools::ConverterFeature::SpecializationConstants\n");
     }
 }
 
@@ -24,12 +24,21 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/StaticArray.h>
+#include <Corrade/Containers/String.h>
 #include <Corrade/Utility/Arguments.h>
+#include <Corrade/Utility/Configuration.h>
 #include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/Path.h>
 
 #include "Magnum/Implementation/converterUtilities.h"
@@ -86,6 +95,13 @@ magnum-shaderconverter phong.frag phong.frag.spv \
     --input-version "410 core" --output-version opengl4.5
 @endcode
 
+Compiling all shader variants listed in a manifest file on all available
+cores, with results cached between runs:
+
+@code{.sh}
+magnum-shaderconverter --batch shaders.conf --cache-dir build/shader-cache
+@endcode
+
 @section magnum-shaderconverter-usage Full usage documentation
 
 @code{.sh}
@@ -93,10 +109,11 @@ magnum-shaderconverter [-h|--help] [--validate] [--link]
     [-C|--converter NAME]... [--plugin-dir DIR]
     [-c|--converter-options key=val,key2=val2,…]... [--info] [-q|--quiet]
     [-v|--verbose] [--warning-as-error] [-E|--preprocess-only]
-    [-D|--define name=value]... [-U|--undefine name]... [-O|--optimize LEVEL]
-    [-g|--debug-info LEVEL] [--input-format glsl|spv|spvasm|hlsl|metal]...
+    [-D|--define name=value]... [-U|--undefine name]...
+    [--specialize name=id]... [-O|--optimize LEVEL] [-g|--debug-info LEVEL] [--input-format glsl|spv|spvasm|hlsl|metal]...
     [--output-format glsl|spv|spvasm|hlsl|metal]...
     [--input-version VERSION]... [--output-version VERSION]...
+    [--cache-dir DIR] [--batch MANIFEST] [-j|--threads N]
     [--] input... output
 @endcode
 
@@ -129,6 +146,10 @@ Arguments:
     the @ref ShaderTools::AbstractConverter::setDefinitions() function.
 -   `-U`, `--undefine name` --- undefine a preprocessor macro. Corresponds to
     the @ref ShaderTools::AbstractConverter::setDefinitions() function.
+-   `--specialize name=id` --- turn a preprocessor macro into a
+    specialization constant with given ID. Corresponds to the
+    @ref ShaderTools::AbstractConverter::setSpecializationConstants()
+    function.
 -   `-O`, `--optimize LEVEL` --- optimization level to use. Corresponds to the
     @ref ShaderTools::AbstractConverter::setOptimizationLevel() function.
 -   `-g`, `--debug-info LEVEL` --- debug info level to use. Corresponds to the
@@ -139,6 +160,13 @@ Arguments:
     converter
 -   `--input-version VERSION` --- input format version for each converter
 -   `--output-version VERSION` --- output format version for each converter
+-   `--cache-dir DIR` --- cache conversion results in given directory.
+    Corresponds to the @ref ShaderTools::AbstractConverter::setCacheDirectory()
+    function.
+-   `--batch MANIFEST` --- convert or validate all shaders listed in a
+    manifest file instead of `input` and `output`
+-   `-j`, `--threads N` --- thread count for `--batch`. If `0`, all available
+    cores are used. Default is `0`.
 
 If `--validate` is given, the utility will validate the `input` file using
 passed `--converter` (or @ref ShaderTools::AnyConverter "AnyShaderConverter" if
@@ -166,9 +194,9 @@ converter it's enough for it to support
 @ref ShaderTools::ConverterFeature::ConvertFile. If no `-C` / `--converter` is
 specified, @ref ShaderTools::AnyConverter "AnyShaderConverter" is used.
 
-The `-D` / `--define`, `-U` / `--undefine`, `-O` / `--optimize`, `-g` /
-`--debug-info`, `-E` / `--preprocess-only` arguments apply only to the first
-converter. Split the conversion to multiple passes if you need to pass those to
+The `-D` / `--define`, `-U` / `--undefine`, `--specialize`, `-O` /
+`--optimize`, `-g` / `--debug-info`, `-E` / `--preprocess-only` arguments apply
+only to the first converter. Split the conversion to multiple passes if you need to pass those to
 converters later in the chain.
 
 Values accepted by `-O` / `--optimize`, `-g` / `--debug-info`, `--input-format`,
@@ -176,6 +204,53 @@ Values accepted by `-O` / `--optimize`, `-g` / `--debug-info`, `--input-format`,
 converter-specific, see documentation of a particular converter for more
 information.
 
+If `--cache-dir` is given, results of each conversion are stored in given
+directory and an equivalent conversion later is served from there without
+invoking the converter. See @ref ShaderTools-AbstractConverter-usage-cache for
+what's a part of the cache key.
+
+@section magnum-shaderconverter-batch Batch mode
+
+If `--batch` is given, the `input` and `output` arguments are taken from a
+manifest file instead, which is a @ref Corrade::Utility::Configuration file
+with one `[shader]` group for each conversion. Relative paths are taken
+relative to the manifest file location:
+
+@code{.ini}
+[shader]
+input=phong.frag
+output=phong.frag.spv
+# Optional, if not present it's detected from the file extension
+stage=fragment
+# Optional, multiple values allowed. Applied after the -D / --define and
+# -U / --undefine options.
+define=DIFFUSE_TEXTURE
+define=LIGHT_COUNT=3
+undefine=NORMAL_TEXTURE
+# Optional, multiple values allowed. Applied after the --specialize options.
+specialize=LIGHT_COUNT=0
+
+[shader]
+input=phong.vert
+output=phong.vert.spv
+@endcode
+
+Recognized `stage` values are `vertex`, `fragment`, `geometry`,
+`tessellation-control`, `tessellation-evaluation`, `compute`,
+`ray-generation`, `ray-any-hit`, `ray-closest-hit`, `ray-miss`,
+`ray-intersection`, `ray-callable`, `mesh-task`, `mesh` and `kernel`. The
+converter plugin is loaded just once and each of the `-j` / `--threads` worker
+threads gets its own instance of it, which is then used for all shaders
+processed by given thread. All other options apply to every listed shader,
+the output is omitted with `--validate`. Only a single `-C` / `--converter` is
+allowed in this mode and `--link`, `--info` and `-E` / `--preprocess-only`
+aren't supported.
+
+After everything is processed, the utility prints how many shaders succeeded
+and failed, the wall time and the total time spent in the converter, and the
+slowest shader. With `-v` / `--verbose`, time spent on each shader is printed
+as well. The utility exits with a non-zero code if any shader failed.
+
 */
 
 }
@@ -236,6 +311,297 @@ void printSpirvInfo(Containers::ArrayView<const UnsignedInt> data) {
     }
 }
 
+Containers::Optional<ShaderTools::Format> parseFormat(const Containers::StringView format) {
+    if(format == ""_s) return ShaderTools::Format::Unspecified;
+    if(format == "glsl"_s) return ShaderTools::Format::Glsl;
+    if(format == "spv"_s) return ShaderTools::Format::Spirv;
+    if(format == "spvasm"_s) return ShaderTools::Format::SpirvAssembly;
+    if(format == "hlsl"_s) return ShaderTools::Format::Hlsl;
+    if(format == "metal"_s) return ShaderTools::Format::Msl;
+    /** @todo wgsl and dxil once i figure out the extensions */
+
+    Error{} << "Unrecognized format" << format << Debug::nospace << ", expected glsl, spv, spvasm, hlsl or metal";
+    return {};
+}
+
+Containers::Optional<ShaderTools::Stage> parseStage(const Containers::StringView stage) {
+    if(stage == ""_s) return ShaderTools::Stage::Unspecified;
+    if(stage == "vertex"_s) return ShaderTools::Stage::Vertex;
+    if(stage == "fragment"_s) return ShaderTools::Stage::Fragment;
+    if(stage == "geometry"_s) return ShaderTools::Stage::Geometry;
+    if(stage == "tessellation-control"_s) return ShaderTools::Stage::TessellationControl;
+    if(stage == "tessellation-evaluation"_s) return ShaderTools::Stage::TessellationEvaluation;
+    if(stage == "compute"_s) return ShaderTools::Stage::Compute;
+    if(stage == "ray-generation"_s) return ShaderTools::Stage::RayGeneration;
+    if(stage == "ray-any-hit"_s) return ShaderTools::Stage::RayAnyHit;
+    if(stage == "ray-closest-hit"_s) return ShaderTools::Stage::RayClosestHit;
+    if(stage == "ray-miss"_s) return ShaderTools::Stage::RayMiss;
+    if(stage == "ray-intersection"_s) return ShaderTools::Stage::RayIntersection;
+    if(stage == "ray-callable"_s) return ShaderTools::Stage::RayCallable;
+    if(stage == "mesh-task"_s) return ShaderTools::Stage::MeshTask;
+    if(stage == "mesh"_s) return ShaderTools::Stage::Mesh;
+    if(stage == "kernel"_s) return ShaderTools::Stage::Kernel;
+
+    Error{} << "Unrecognized stage" << stage;
+    return {};
+}
+
+Containers::Optional<Containers::Pair<Containers::StringView, UnsignedInt>> parseSpecialization(const Containers::StringView specialization) {
+    const Containers::Array3<Containers::StringView> nameId = specialization.partition('=');
+    bool valid = !nameId[0].isEmpty() && !nameId[2].isEmpty() && nameId[2].size() <= 9;
+    UnsignedInt id = 0;
+    for(const char c: nameId[2]) {
+        if(c < '0' || c > '9') {
+            valid = false;
+            break;
+        }
+        id = id*10 + (c - '0');
+    }
+    if(!valid) {
+        Error{} << "Invalid specialization" << specialization << Debug::nospace << ", expected name=id";
+        return {};
+    }
+
+    return Containers::pair(nameId[0], id);
+}
+
+struct BatchDefinition {
+    Containers::String name, value;
+    bool undefine;
+};
+
+struct BatchJob {
+    Containers::String input, output;
+    ShaderTools::Stage stage;
+    Containers::Array<BatchDefinition> definitions;
+    Containers::Array<Containers::Pair<Containers::String, UnsignedInt>> specializations;
+
+    /* Filled by the workers */
+    bool succeeded;
+    std::chrono::steady_clock::duration duration;
+    Containers::String message;
+};
+
+void appendDefinition(Containers::Array<BatchDefinition>& definitions, const Containers::StringView define, const bool undefine) {
+    if(undefine) {
+        arrayAppend(definitions, InPlaceInit, define, Containers::String{}, true);
+    } else {
+        const Containers::Array3<Containers::StringView> nameValue = define.partition('=');
+        arrayAppend(definitions, InPlaceInit, nameValue[0], nameValue[2], false);
+    }
+}
+
+int runBatch(const Utility::Arguments& args, PluginManager::Manager<ShaderTools::AbstractConverter>& converterManager) {
+    /* Parse the manifest first so we don't load any plugins if it's
+       broken */
+    const Containers::StringView manifestFilename = args.value<Containers::StringView>("batch");
+    const Utility::Configuration manifest{manifestFilename, Utility::Configuration::Flag::ReadOnly};
+    if(!manifest.isValid()) {
+        Error{} << "Cannot open manifest" << manifestFilename;
+        return 26;
+    }
+    const Containers::StringView manifestDirectory = Utility::Path::split(manifestFilename).first();
+
+    const bool validate = args.isSet("validate");
+    Containers::Array<BatchJob> jobs;
+    arrayReserve(jobs, manifest.groupCount("shader"));
+    for(std::size_t i = 0; i != manifest.groupCount("shader"); ++i) {
+        const Utility::ConfigurationGroup& group = *manifest.group("shader", i);
+
+        const Containers::StringView input = group.value<Containers::StringView>("input");
+        const Containers::StringView output = group.value<Containers::StringView>("output");
+        if(input.isEmpty() || (output.isEmpty() && !validate)) {
+            Error{} << "Shader" << i << "in" << manifestFilename << "has no input or output set";
+            return 26;
+        }
+
+        const Containers::Optional<ShaderTools::Stage> stage = parseStage(group.value<Containers::StringView>("stage"));
+        if(!stage) return 26;
+
+        /* Global definitions first so the per-shader ones override them */
+        Containers::Array<BatchDefinition> definitions;
+        for(std::size_t j = 0; j != args.arrayValueCount("define"); ++j)
+            appendDefinition(definitions, args.arrayValue<Containers::StringView>("define", j), false);
+        for(std::size_t j = 0; j != args.arrayValueCount("undefine"); ++j)
+            appendDefinition(definitions, args.arrayValue<Containers::StringView>("undefine", j), true);
+        for(std::size_t j = 0; j != group.valueCount("define"); ++j)
+            appendDefinition(definitions, group.value<Containers::StringView>("define", j), false);
+        for(std::size_t j = 0; j != group.valueCount("undefine"); ++j)
+            appendDefinition(definitions, group.value<Containers::StringView>("undefine", j), true);
+
+        Containers::Array<Containers::Pair<Containers::String, UnsignedInt>> specializations;
+        for(std::size_t j = 0, globalCount = args.arrayValueCount("specialize"), count = globalCount + group.valueCount("specialize"); j != count; ++j) {
+            const Containers::Optional<Containers::Pair<Containers::StringView, UnsignedInt>> specialization = parseSpecialization(j < globalCount ?
+                args.arrayValue<Containers::StringView>("specialize", j) :
+                group.value<Containers::StringView>("specialize", j - globalCount));
+            if(!specialization) return 26;
+            arrayAppend(specializations, InPlaceInit, specialization->first(), specialization->second());
+        }
+
+        arrayAppend(jobs, InPlaceInit,
+            Utility::Path::join(manifestDirectory, input),
+            output.isEmpty() ? Containers::String{} : Utility::Path::join(manifestDirectory, output),
+            *stage, Utility::move(definitions), Utility::move(specializations),
+            false, std::chrono::steady_clock::duration{}, Containers::String{});
+    }
+
+    bool hasDefinitions = false, hasSpecializations = false;
+    for(const BatchJob& job: jobs) {
+        if(!job.definitions.isEmpty()) hasDefinitions = true;
+        if(!job.specializations.isEmpty()) hasSpecializations = true;
+    }
+
+    std::size_t threadCount = args.value<std::size_t>("threads");
+    if(!threadCount) threadCount = std::thread::hardware_concurrency();
+    /* hardware_concurrency() returns 0 if the value can't be determined */
+    threadCount = Math::max(Math::min(threadCount, jobs.size()), std::size_t{1});
+
+    /* The plugin gets loaded just once by the first instantiation, each
+       thread then gets its own instance as the instances aren't
+       thread-safe */
+    const std::string converterName = args.arrayValueCount("converter") ?
+        args.arrayValue("converter", 0) : "AnyShaderConverter";
+    ShaderTools::Format inputFormat{}, outputFormat{};
+    if(args.arrayValueCount("input-format")) {
+        if(const Containers::Optional<ShaderTools::Format> format = parseFormat(args.arrayValue<Containers::StringView>("input-format", 0)))
+            inputFormat = *format;
+        else return 8;
+    }
+    if(args.arrayValueCount("output-format")) {
+        if(const Containers::Optional<ShaderTools::Format> format = parseFormat(args.arrayValue<Containers::StringView>("output-format", 0)))
+            outputFormat = *format;
+        else return 9;
+    }
+    ShaderTools::ConverterFlags flags;
+    if(args.isSet("quiet")) flags |= ShaderTools::ConverterFlag::Quiet;
+    if(args.isSet("verbose")) flags |= ShaderTools::ConverterFlag::Verbose;
+    if(args.isSet("warning-as-error")) flags |= ShaderTools::ConverterFlag::WarningAsError;
+
+    Containers::Array<Containers::Pointer<ShaderTools::AbstractConverter>> converters{threadCount};
+    for(Containers::Pointer<ShaderTools::AbstractConverter>& converter: converters) {
+        converter = converterManager.loadAndInstantiate(converterName);
+        if(!converter) {
+            Debug{} << "Available converter plugins:" << ", "_s.join(converterManager.aliasList());
+            return 7;
+        }
+
+        if(args.arrayValueCount("converter-options"))
+            Implementation::setOptions(*converter, "AnyShaderConverter", args.arrayValue("converter-options", 0));
+
+        converter->setInputFormat(inputFormat, args.arrayValueCount("input-version") ? args.arrayValue<Containers::StringView>("input-version", 0) : Containers::StringView{});
+        converter->setOutputFormat(outputFormat, args.arrayValueCount("output-version") ? args.arrayValue<Containers::StringView>("output-version", 0) : Containers::StringView{});
+        converter->setCacheDirectory(args.value<Containers::StringView>("cache-dir"));
+
+        if(!args.value<Containers::StringView>("optimize").isEmpty()) {
+            if(!(converter->features() >= ShaderTools::ConverterFeature::Optimize)) {
+                Error{} << "The -O option is set, but" << converterName << "doesn't support optimization";
+                return 11;
+            }
+            converter->setOptimizationLevel(args.value<Containers::StringView>("optimize"));
+        }
+        if(!args.value<Containers::StringView>("debug-info").isEmpty()) {
+            if(!(converter->features() >= ShaderTools::ConverterFeature::DebugInfo)) {
+                Error{} << "The -g option is set, but" << converterName << "doesn't support debug info";
+                return 12;
+            }
+            converter->setDebugInfoLevel(args.value<Containers::StringView>("debug-info"));
+        }
+
+        if(validate && !(converter->features() >= ShaderTools::ConverterFeature::ValidateFile)) {
+            Error{} << converterName << "doesn't support file validation";
+            return 13;
+        }
+        if(!validate && !(converter->features() >= ShaderTools::ConverterFeature::ConvertFile)) {
+            Error{} << converterName << "doesn't support file conversion";
+            return 15;
+        }
+        if(hasDefinitions && !(converter->features() >= ShaderTools::ConverterFeature::Preprocess)) {
+            Error{} << "Preprocessor definitions are set, but" << converterName << "doesn't support preprocessing";
+            return 10;
+        }
+        if(hasSpecializations && !(converter->features() >= ShaderTools::ConverterFeature::SpecializationConstants)) {
+            Error{} << "Specializations are set, but" << converterName << "doesn't support specialization constants";
+            return 29;
+        }
+
+        converter->addFlags(flags);
+    }
+
+    /* Each worker picks the next unprocessed job until there's none left */
+    std::atomic<std::size_t> next{0};
+    auto work = [&](ShaderTools::AbstractConverter& converter) {
+        for(std::size_t i; (i = next++) < jobs.size(); ) {
+            BatchJob& job = jobs[i];
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+            /* Definitions are set for every job, with an empty list
+               resetting the ones from the previous job */
+            if(hasDefinitions) {
+                Containers::Array<Containers::Pair<Containers::StringView, Containers::StringView>> definitions{ValueInit, job.definitions.size()};
+                for(std::size_t j = 0; j != job.definitions.size(); ++j)
+                    definitions[j] = {job.definitions[j].name, job.definitions[j].undefine ? Containers::StringView{nullptr} : Containers::StringView{job.definitions[j].value}};
+                converter.setDefinitions(definitions);
+            }
+            if(hasSpecializations) {
+                Containers::Array<Containers::Pair<Containers::StringView, UnsignedInt>> specializations{ValueInit, job.specializations.size()};
+                for(std::size_t j = 0; j != job.specializations.size(); ++j)
+                    specializations[j] = {job.specializations[j].first(), job.specializations[j].second()};
+                converter.setSpecializationConstants(specializations);
+            }
+
+            if(validate) {
+                Containers::Pair<bool, Containers::String> out = converter.validateFile(job.stage, job.input);
+                job.succeeded = out.first();
+                job.message = Utility::move(out.second());
+            } else job.succeeded = converter.convertFileToFile(job.stage, job.input, job.output);
+
+            job.duration = std::chrono::steady_clock::now() - start;
+        }
+    };
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    {
+        /* The main thread is one of the workers as well */
+        Containers::Array<std::thread> threads{threadCount - 1};
+        for(std::size_t i = 0; i != threads.size(); ++i)
+            threads[i] = std::thread{work, std::ref(*converters[i + 1])};
+        work(*converters[0]);
+        for(std::thread& thread: threads) thread.join();
+    }
+    const std::chrono::steady_clock::duration wallTime = std::chrono::steady_clock::now() - start;
+
+    /* Report failures and per-shader timing in the manifest order */
+    const auto milliseconds = [](std::chrono::steady_clock::duration duration) {
+        return std::chrono::duration<Double, std::milli>(duration).count();
+    };
+    std::size_t failedCount = 0;
+    std::chrono::steady_clock::duration totalTime{};
+    const BatchJob* slowest = nullptr;
+    for(const BatchJob& job: jobs) {
+        totalTime += job.duration;
+        if(!slowest || job.duration > slowest->duration) slowest = &job;
+
+        if(!job.succeeded) {
+            ++failedCount;
+            Error e;
+            e << (validate ? "Validation of" : "Cannot convert") << job.input << (validate ? "failed" : "to") << Debug::nospace;
+            if(!validate) e << "" << job.output;
+            if(!job.message.isEmpty()) e << Debug::nospace << ":" << Debug::newline << job.message;
+        } else if(validate && !job.message.isEmpty())
+            Warning{} << "Validation of" << job.input << "succeeded with warnings:" << Debug::newline << job.message;
+
+        if(args.isSet("verbose"))
+            Debug{} << Utility::format("{:8.2f} ms", milliseconds(job.duration)) << job.input;
+    }
+
+    Debug d;
+    d << (validate ? "Validated" : "Converted") << jobs.size() - failedCount << "of" << jobs.size() << "shaders with" << threadCount << (threadCount == 1 ? "thread" : "threads") << "in" << Utility::format("{:.2f} ms", milliseconds(wallTime)) << Debug::nospace << "," << Utility::format("{:.2f} ms", milliseconds(totalTime)) << "in total";
+    if(slowest)
+        d << Debug::newline << "  slowest:" << slowest->input << Utility::format("({:.2f} ms)", milliseconds(slowest->duration));
+
+    return failedCount ? 27 : 0;
+}
+
 }
 
 int main(int argc, char** argv) {
@@ -256,6 +622,7 @@ int main(int argc, char** argv) {
         .addBooleanOption('E', "preprocess-only").setHelp("preprocess-only", "preprocess the input file and exit")
         .addArrayOption('D', "define").setHelp("define", "define a preprocessor macro", "name=value")
         .addArrayOption('U', "undefine").setHelp("undefine", "undefine a preprocessor macro", "name")
+        .addArrayOption("specialize").setHelp("specialize", "turn a preprocessor macro into a specialization constant", "name=id")
         .addOption('O', "optimize").setHelp("optimize", "optimization level to use", "LEVEL")
         .addOption('g', "debug-info").setHelp("debug-info", "debug info level to use", "LEVEL")
         /** @todo what the heck is the extension for wgsl and dxil?! */
@@ -263,6 +630,9 @@ int main(int argc, char** argv) {
         .addArrayOption("output-format").setHelp("output-format", "output format for each converter", "glsl|spv|spvasm|hlsl|metal")
         .addArrayOption("input-version").setHelp("input-version", "input format version for each converter", "VERSION")
         .addArrayOption("output-version").setHelp("output-version", "output format version for each converter", "VERSION")
+        .addOption("cache-dir").setHelp("cache-dir", "cache conversion results in given directory", "DIR")
+        .addOption("batch").setHelp("batch", "convert or validate all shaders listed in a manifest file", "MANIFEST")
+        .addOption('j', "threads", "0").setHelp("threads", "thread count for --batch, 0 means all available cores", "N")
         .setParseErrorCallback([](const Utility::Arguments& args, Utility::Arguments::ParseError error, const std::string& key) {
             /* If --info / --validate is passed, we don't need the output
                argument */
@@ -270,6 +640,11 @@ int main(int argc, char** argv) {
                key == "output" && (args.isSet("info") || args.isSet("validate")))
                 return true;
 
+            /* In batch mode the inputs and outputs come from the manifest */
+            if(error == Utility::Arguments::ParseError::MissingArgument &&
+               (key == "input" || key == "output") && !args.value("batch").empty())
+                return true;
+
             /* Handle all other errors as usual */
             return false;
         })
@@ -300,16 +675,45 @@ All converters in the chain have to support the ConvertData feature, if there's
 just one converter it's enough for it to support ConvertFile. If no -C /
 --converter is specified, AnyShaderConverter is used.
 
-The -D / --define, -U / --undefine, -O / --optimize, -g / --debug-info, -E /
---preprocess-only arguments apply only to the first converter. Split the
+The -D / --define, -U / --undefine, --specialize, -O / --optimize, -g /
+--debug-info, -E / --preprocess-only arguments apply only to the first
+converter. Split the
 conversion to multiple passes if you need to pass those to converters later in
 the chain.
 
 Values accepted by -O / --optimize, -g / --debug-info, --input-format,
 --output-format, --input-version and --output-version are converter-specific,
-see documentation of a particular converter for more information.)")
+see documentation of a particular converter for more information.
+
+If --cache-dir is given, results of each conversion are stored in given
+directory and an equivalent conversion later is served from there without
+invoking the converter.
+
+If --batch is given, input and output are taken from a manifest file, which
+contains a [shader] group with input, output and optionally stage and
+(multiple) define, undefine and specialize values for each conversion. Relative paths are
+taken relative to the manifest. All listed shaders are processed on
+-j / --threads worker threads, each with its own instance of a single
+--converter, and the utility prints timing statistics at the end.)")
         .parse(argc, argv);
 
+    /* Batch mode checks */
+    const bool batch = !args.value<Containers::StringView>("batch").isEmpty();
+    if(batch) {
+        if(args.arrayValueCount("input") || !args.value<Containers::StringView>("output").isEmpty()) {
+            Error{} << "Input and output files shouldn't be set for --batch";
+            return 25;
+        }
+        if(args.isSet("link") || args.isSet("info") || args.isSet("preprocess-only")) {
+            Error{} << "The --link, --info and --preprocess-only options aren't allowed for --batch";
+            return 25;
+        }
+        if(args.arrayValueCount("converter") > 1) {
+            Error{} << "Cannot use multiple converters with --batch";
+            return 25;
+        }
+    }
+
     /* Generic checks */
     if(!args.value<Containers::StringView>("output").isEmpty()) {
         if(args.isSet("validate")) {
@@ -323,7 +727,7 @@ see documentation of a particular converter for more information.)")
         if(args.isSet("info"))
             Warning{} << "Ignoring output file for --info:" << args.value<Containers::StringView>("output");
     }
-    if(!args.isSet("link"))  {
+    if(!args.isSet("link") && !batch)  {
         if(args.arrayValueCount("input") != 1) {
             Error{} << "Multiple input files are allowed only for --link";
             return 3;
@@ -373,6 +777,8 @@ see documentation of a particular converter for more information.)")
         #endif
     };
 
+    if(batch) return runBatch(args, converterManager);
+
     /* Data passed from one converter to another in case there's more than one */
     Containers::Array<char> data;
 
@@ -395,18 +801,6 @@ see documentation of a particular converter for more information.)")
         ShaderTools::Format inputFormat{}, outputFormat{};
         if(args.isSet("info"))
             outputFormat = ShaderTools::Format::Spirv;
-        auto parseFormat = [](Containers::StringView format) -> Containers::Optional<ShaderTools::Format> {
-            if(format == ""_s) return ShaderTools::Format::Unspecified;
-            if(format == "glsl"_s) return ShaderTools::Format::Glsl;
-            if(format == "spv"_s) return ShaderTools::Format::Spirv;
-            if(format == "spvasm"_s) return ShaderTools::Format::SpirvAssembly;
-            if(format == "hlsl"_s) return ShaderTools::Format::Hlsl;
-            if(format == "metal"_s) return ShaderTools::Format::Msl;
-            /** @todo wgsl and dxil once i figure out the extensions */
-
-            Error{} << "Unrecognized format" << format << Debug::nospace << ", expected glsl, spv, spvasm, hlsl or metal";
-            return {};
-        };
         if(i < args.arrayValueCount("input-format")) {
             if(const Containers::Optional<ShaderTools::Format> format = parseFormat(args.arrayValue<Containers::StringView>("input-format", i)))
                 inputFormat = *format;
@@ -430,6 +824,8 @@ see documentation of a particular converter for more information.)")
         converter->setInputFormat(inputFormat, inputVersion);
         converter->setOutputFormat(outputFormat, outputVersion);
 
+        converter->setCacheDirectory(args.value<Containers::StringView>("cache-dir"));
+
         ShaderTools::ConverterFlags flags;
 
         /* Global flags, applied for all converters */
@@ -466,6 +862,23 @@ see documentation of a particular converter for more information.)")
                 converter->setDefinitions(definitions);
             }
 
+            if(args.arrayValueCount("specialize")) {
+                if(!(converter->features() >= ShaderTools::ConverterFeature::SpecializationConstants)) {
+                    Error{} << "The --specialize option is set, but" << converterName << "doesn't support specialization constants";
+                    return 29;
+                }
+
+                Containers::Array<Containers::Pair<Containers::StringView, UnsignedInt>> specializations;
+                arrayReserve(specializations, args.arrayValueCount("specialize"));
+                for(std::size_t j = 0; j != args.arrayValueCount("specialize"); ++j) {
+                    const Containers::Optional<Containers::Pair<Containers::StringView, UnsignedInt>> specialization = parseSpecialization(args.arrayValue<Containers::StringView>("specialize", j));
+                    if(!specialization) return 28;
+                    arrayAppend(specializations, *specialization);
+                }
+
+                converter->setSpecializationConstants(specializations);
+            }
+
             if(!args.value<Containers::StringView>("optimize").isEmpty()) {
                 if(!(converter->features() >= ShaderTools::ConverterFeature::Optimize)) {
                     Error{} << "The -O option is set, but" << converterName << "doesn't support optimization";
@@ -175,7 +175,13 @@ void main() {
     lowp const vec2 outlineRange = materials[materialId].material_outlineRange;
     #endif
 
+    #ifdef MULTI_CHANNEL
+    /* Median of the three channels */
+    lowp vec3 channels = texture(vectorTexture, interpolatedTextureCoordinates).rgb;
+    lowp float intensity = max(min(channels.r, channels.g), min(max(channels.r, channels.g), channels.b));
+    #else
     lowp float intensity = texture(vectorTexture, interpolatedTextureCoordinates).r;
+    #endif
 
     /* Fill color */
     fragmentColor = smoothstep(outlineRange.x-smoothness, outlineRange.x+smoothness, intensity)*color;
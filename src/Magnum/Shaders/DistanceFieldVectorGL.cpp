@@ -159,7 +159,8 @@ template<UnsignedInt dimensions> typename DistanceFieldVectorGL<dimensions>::Com
         .submitCompile();
 
     GL::Shader frag{version, GL::Shader::Type::Fragment};
-    frag.addSource(rs.getString("compatibility.glsl"_s));
+    frag.addSource(rs.getString("compatibility.glsl"_s))
+        .addSource(configuration.flags() & Flag::MultiChannel ? "#define MULTI_CHANNEL\n"_s : ""_s);
     #ifndef MAGNUM_TARGET_GLES2
     if(configuration.flags() >= Flag::UniformBuffers) {
         #ifndef MAGNUM_TARGET_WEBGL
@@ -517,6 +518,7 @@ Debug& operator<<(Debug& debug, const DistanceFieldVectorGLFlag value) {
         /* LCOV_EXCL_START */
         #define _c(v) case DistanceFieldVectorGLFlag::v: return debug << "::" #v;
         _c(TextureTransformation)
+        _c(MultiChannel)
         #ifndef MAGNUM_TARGET_GLES2
         _c(UniformBuffers)
         #ifndef MAGNUM_TARGET_WEBGL
@@ -534,6 +536,7 @@ Debug& operator<<(Debug& debug, const DistanceFieldVectorGLFlag value) {
 Debug& operator<<(Debug& debug, const DistanceFieldVectorGLFlags value) {
     return Containers::enumSetDebugOutput(debug, value, "Shaders::DistanceFieldVectorGL::Flags{}", {
         DistanceFieldVectorGLFlag::TextureTransformation,
+        DistanceFieldVectorGLFlag::MultiChannel,
         #ifndef MAGNUM_TARGET_GLES2
         #ifndef MAGNUM_TARGET_WEBGL
         /* Both are a superset of UniformBuffers, meaning printing just one
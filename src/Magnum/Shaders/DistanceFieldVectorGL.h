@@ -45,6 +45,7 @@ namespace Magnum { namespace Shaders {
 namespace Implementation {
     enum class DistanceFieldVectorGLFlag: UnsignedByte {
         TextureTransformation = 1 << 0,
+        MultiChannel = 1 << 4,
         #ifndef MAGNUM_TARGET_GLES2
         UniformBuffers = 1 << 1,
         #ifndef MAGNUM_TARGET_WEBGL
@@ -176,6 +177,18 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT DistanceFieldVector
              */
             TextureTransformation = 1 << 0,
 
+            /**
+             * Interpret the texture as a multi-channel signed distance field
+             * and take a median of its red, green and blue channels instead
+             * of using just the red channel. Such a texture preserves sharp
+             * corners at a significantly lower resolution than a
+             * single-channel distance field. See
+             * @ref TextureTools::multiChannelDistanceFieldInto() for a way to
+             * generate it.
+             * @m_since_latest
+             */
+            MultiChannel = 1 << 4,
+
             #ifndef MAGNUM_TARGET_GLES2
             /**
              * Use uniform buffers. Expects that uniform data are supplied via
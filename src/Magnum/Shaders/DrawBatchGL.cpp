@@ -0,0 +1,166 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DrawBatchGL.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Iterable.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/MeshView.h"
+#include "Magnum/GL/StreamingBuffer.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Shaders/FlatGL.h"
+#include "Magnum/Shaders/MeshVisualizerGL.h"
+#include "Magnum/Shaders/PhongGL.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+
+/* Only the transformation buffer binding differs in name among the shaders,
+   the rest is the same */
+void bindTransformationBuffer(PhongGL& shader, GL::Buffer& buffer, GLintptr offset, GLsizeiptr size) {
+    shader.bindTransformationBuffer(buffer, offset, size);
+}
+template<UnsignedInt dimensions> void bindTransformationBuffer(FlatGL<dimensions>& shader, GL::Buffer& buffer, GLintptr offset, GLsizeiptr size) {
+    shader.bindTransformationProjectionBuffer(buffer, offset, size);
+}
+void bindTransformationBuffer(MeshVisualizerGL2D& shader, GL::Buffer& buffer, GLintptr offset, GLsizeiptr size) {
+    shader.bindTransformationProjectionBuffer(buffer, offset, size);
+}
+void bindTransformationBuffer(MeshVisualizerGL3D& shader, GL::Buffer& buffer, GLintptr offset, GLsizeiptr size) {
+    shader.bindTransformationBuffer(buffer, offset, size);
+}
+
+}
+
+template<class Shader> UnsignedInt DrawBatchGL<Shader>::maxDrawCount() {
+    const std::size_t maxUniformSize = Math::max(Math::max(sizeof(TransformationUniform), sizeof(DrawUniform)), sizeof(TextureTransformationUniform));
+    return GL::AbstractShaderProgram::maxUniformBlockSize()/maxUniformSize;
+}
+
+template<class Shader> DrawBatchGL<Shader>::DrawBatchGL(Shader& shader, GL::StreamingBuffer& buffer): _shader{&shader}, _buffer{&buffer} {
+    CORRADE_ASSERT(shader.flags() >= Shader::Flag::UniformBuffers,
+        "Shaders::DrawBatchGL: the shader was not created with uniform buffers enabled", );
+}
+
+template<class Shader> DrawBatchGL<Shader>::DrawBatchGL(DrawBatchGL<Shader>&&) noexcept = default;
+
+template<class Shader> DrawBatchGL<Shader>::~DrawBatchGL() = default;
+
+template<class Shader> DrawBatchGL<Shader>& DrawBatchGL<Shader>::operator=(DrawBatchGL<Shader>&&) noexcept = default;
+
+template<class Shader> UnsignedInt DrawBatchGL<Shader>::batchSize() const {
+    /* Shader storage buffers have unbounded per-draw arrays, so everything
+       can go in a single batch */
+    if(_shader->flags() >= Shader::Flag::ShaderStorageBuffers)
+        return Math::max(UnsignedInt(_meshes.size()), 1u);
+    return _shader->drawCount();
+}
+
+template<class Shader> DrawBatchGL<Shader>& DrawBatchGL<Shader>::add(GL::MeshView& mesh, const TransformationUniform& transformation, const DrawUniform& draw) {
+    CORRADE_ASSERT(!(_shader->flags() & Shader::Flag::TextureTransformation),
+        "Shaders::DrawBatchGL::add(): the shader was created with texture transformation enabled, a texture transformation has to be passed as well", *this);
+    arrayAppend(_meshes, mesh);
+    arrayAppend(_transformations, transformation);
+    arrayAppend(_draws, draw);
+    return *this;
+}
+
+template<class Shader> DrawBatchGL<Shader>& DrawBatchGL<Shader>::add(GL::MeshView& mesh, const TransformationUniform& transformation, const DrawUniform& draw, const TextureTransformationUniform& textureTransformation) {
+    CORRADE_ASSERT(_shader->flags() & Shader::Flag::TextureTransformation,
+        "Shaders::DrawBatchGL::add(): the shader was not created with texture transformation enabled", *this);
+    arrayAppend(_meshes, mesh);
+    arrayAppend(_transformations, transformation);
+    arrayAppend(_draws, draw);
+    arrayAppend(_textureTransformations, textureTransformation);
+    return *this;
+}
+
+template<class Shader> DrawBatchGL<Shader>& DrawBatchGL<Shader>::draw() {
+    const std::size_t count = _meshes.size();
+    if(!count) return *this;
+
+    const bool shaderStorage = _shader->flags() >= Shader::Flag::ShaderStorageBuffers;
+    const bool textureTransformation = !!(_shader->flags() & Shader::Flag::TextureTransformation);
+    const bool multiDraw = _shader->flags() >= Shader::Flag::MultiDraw;
+    const std::size_t batchSize = this->batchSize();
+    const std::size_t alignment = shaderStorage ?
+        GL::Buffer::shaderStorageOffsetAlignment() :
+        GL::Buffer::uniformOffsetAlignment();
+
+    /* The bound uniform buffer ranges have to cover the whole uniform block,
+       so pad the last batch to a full size. Not needed for shader storage,
+       where everything is a single batch anyway. */
+    const std::size_t paddedCount = (count + batchSize - 1)/batchSize*batchSize;
+    arrayResize(_transformations, paddedCount);
+    arrayResize(_draws, paddedCount);
+    if(textureTransformation)
+        arrayResize(_textureTransformations, paddedCount);
+
+    GL::Buffer& buffer = _buffer->buffer();
+    for(std::size_t offset = 0; offset < count; offset += batchSize) {
+        const std::size_t transformationOffset = _buffer->write(_transformations.slice(offset, offset + batchSize), alignment);
+        bindTransformationBuffer(*_shader, buffer, transformationOffset, batchSize*sizeof(TransformationUniform));
+
+        const std::size_t drawOffset = _buffer->write(_draws.slice(offset, offset + batchSize), alignment);
+        _shader->bindDrawBuffer(buffer, drawOffset, batchSize*sizeof(DrawUniform));
+
+        if(textureTransformation) {
+            const std::size_t textureTransformationOffset = _buffer->write(_textureTransformations.slice(offset, offset + batchSize), alignment);
+            _shader->bindTextureTransformationBuffer(buffer, textureTransformationOffset, batchSize*sizeof(TextureTransformationUniform));
+        }
+
+        const Containers::ArrayView<const Containers::Reference<GL::MeshView>> meshes = _meshes.slice(offset, Math::min(offset + batchSize, count));
+        if(multiDraw) {
+            _shader->setDrawOffset(0);
+            _shader->draw(Containers::Iterable<GL::MeshView>{meshes});
+        } else for(std::size_t i = 0; i != meshes.size(); ++i) {
+            GL::MeshView& mesh = meshes[i];
+            _shader->setDrawOffset(i);
+            _shader->draw(mesh);
+        }
+    }
+
+    _shader->setDrawOffset(0);
+
+    /* Keep the memory for the next frame */
+    arrayResize(_meshes, NoInit, 0);
+    arrayResize(_transformations, NoInit, 0);
+    arrayResize(_draws, NoInit, 0);
+    arrayResize(_textureTransformations, NoInit, 0);
+    return *this;
+}
+
+template class MAGNUM_SHADERS_EXPORT DrawBatchGL<PhongGL>;
+template class MAGNUM_SHADERS_EXPORT DrawBatchGL<FlatGL2D>;
+template class MAGNUM_SHADERS_EXPORT DrawBatchGL<FlatGL3D>;
+template class MAGNUM_SHADERS_EXPORT DrawBatchGL<MeshVisualizerGL2D>;
+template class MAGNUM_SHADERS_EXPORT DrawBatchGL<MeshVisualizerGL3D>;
+
+}}
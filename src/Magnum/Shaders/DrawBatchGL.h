@@ -0,0 +1,232 @@
+#ifndef Magnum_Shaders_DrawBatchGL_h
+#define Magnum_Shaders_DrawBatchGL_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::Shaders::DrawBatchGL
+ * @m_since_latest
+ */
+#endif
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Reference.h>
+
+#include "Magnum/GL/GL.h"
+#include "Magnum/Shaders/Flat.h"
+#include "Magnum/Shaders/Generic.h"
+#include "Magnum/Shaders/MeshVisualizer.h"
+#include "Magnum/Shaders/Phong.h"
+#include "Magnum/Shaders/visibility.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum { namespace Shaders {
+
+namespace Implementation {
+    template<class> struct DrawBatchTraits;
+}
+
+/**
+@brief Batched per-draw uniform upload for shaders with uniform buffers
+@m_since_latest
+
+Accumulates per-draw transformation, draw and optionally texture
+transformation uniforms for many meshes and submits them to a shader created
+with @ref PhongGL::Flag::UniformBuffers or its equivalent in other shaders.
+Supported @p Shader types are @ref PhongGL, @ref FlatGL2D, @ref FlatGL3D,
+@ref MeshVisualizerGL2D and @ref MeshVisualizerGL3D. Use the
+@ref TransformationUniform, @ref DrawUniform and
+@ref TextureTransformationUniform typedefs to get the uniform structures
+corresponding to given shader.
+
+@section Shaders-DrawBatchGL-usage Usage
+
+The shader is expected to be created with a draw count of at most
+@ref maxDrawCount(), which is the largest count for which all per-draw
+uniform arrays fit into @ref GL::AbstractShaderProgram::maxUniformBlockSize().
+Each frame, meshes are added with @ref add() and then submitted with
+@ref draw(). That splits the draws into batches of
+@ref PhongGL::drawCount() "Shader::drawCount()" items, copies the uniforms of
+each batch into a @ref GL::StreamingBuffer, binds the corresponding ranges to
+the shader and draws the batch. If the shader was created with
+@ref PhongGL::Flag::MultiDraw "Flag::MultiDraw", each batch is a single
+multi-draw call, otherwise the meshes are drawn one by one with
+@ref PhongGL::setDrawOffset() "setDrawOffset()" updated for each.
+
+@snippet Shaders-gl.cpp DrawBatchGL-usage
+
+Material, light, projection and other buffers that aren't per-draw aren't
+managed by this class and have to be bound by the user. The streaming buffer
+region has to be large enough to hold uniforms of all draws submitted in a
+frame, including padding to @ref GL::Buffer::uniformOffsetAlignment(), or
+@ref GL::Buffer::shaderStorageOffsetAlignment() if the shader uses shader
+storage buffers. The last batch is padded with default-constructed uniforms
+to a full @ref PhongGL::drawCount() "Shader::drawCount()" as the bound
+ranges have to cover whole uniform blocks.
+@requires_gl31 Extension @gl_extension{ARB,uniform_buffer_object}
+@requires_gles30 Uniform buffers are not available in OpenGL ES 2.0.
+@requires_gles @ref GL::StreamingBuffer is not available in WebGL.
+*/
+template<class Shader> class MAGNUM_SHADERS_EXPORT DrawBatchGL {
+    public:
+        /** @brief Per-draw transformation uniform */
+        typedef typename Implementation::DrawBatchTraits<Shader>::TransformationUniform TransformationUniform;
+
+        /** @brief Per-draw draw uniform */
+        typedef typename Implementation::DrawBatchTraits<Shader>::DrawUniform DrawUniform;
+
+        /** @brief Per-draw texture transformation uniform */
+        typedef Shaders::TextureTransformationUniform TextureTransformationUniform;
+
+        /**
+         * @brief Max draw count
+         *
+         * Largest draw count for which all per-draw uniform arrays fit into
+         * @ref GL::AbstractShaderProgram::maxUniformBlockSize(). Pass it,
+         * or a smaller value, to @ref PhongGL::Configuration::setDrawCount()
+         * "Shader::Configuration::setDrawCount()".
+         */
+        static UnsignedInt maxDrawCount();
+
+        /**
+         * @brief Constructor
+         * @param shader        Shader to draw with
+         * @param buffer        Buffer to stream the uniforms through
+         *
+         * Expects that @p shader was created with uniform buffers enabled.
+         * Both @p shader and @p buffer are expected to stay in scope for
+         * the whole lifetime of the batch.
+         */
+        explicit DrawBatchGL(Shader& shader, GL::StreamingBuffer& buffer);
+
+        /** @brief Copying is not allowed */
+        DrawBatchGL(const DrawBatchGL<Shader>&) = delete;
+
+        /** @brief Move constructor */
+        DrawBatchGL(DrawBatchGL<Shader>&&) noexcept;
+
+        ~DrawBatchGL();
+
+        /** @brief Copying is not allowed */
+        DrawBatchGL<Shader>& operator=(const DrawBatchGL<Shader>&) = delete;
+
+        /** @brief Move assignment */
+        DrawBatchGL<Shader>& operator=(DrawBatchGL<Shader>&&) noexcept;
+
+        /** @brief Shader */
+        Shader& shader() { return *_shader; }
+
+        /** @brief Streaming buffer */
+        GL::StreamingBuffer& buffer() { return *_buffer; }
+
+        /**
+         * @brief Batch size
+         *
+         * Count of draws submitted in a single batch. Same as
+         * @ref PhongGL::drawCount() "Shader::drawCount()" if the shader uses
+         * uniform buffers, or @ref drawCount() if the shader uses shader
+         * storage buffers with an unbounded draw count.
+         */
+        UnsignedInt batchSize() const;
+
+        /**
+         * @brief Count of draws added since the last @ref draw()
+         */
+        std::size_t drawCount() const { return _meshes.size(); }
+
+        /**
+         * @brief Add a draw
+         * @return Reference to self (for method chaining)
+         *
+         * The @p mesh is expected to stay in scope until @ref draw() is
+         * called. Expects that the shader wasn't created with
+         * @ref PhongGL::Flag::TextureTransformation "Flag::TextureTransformation",
+         * use @ref add(GL::MeshView&, const TransformationUniform&, const DrawUniform&, const TextureTransformationUniform&)
+         * otherwise.
+         */
+        DrawBatchGL<Shader>& add(GL::MeshView& mesh, const TransformationUniform& transformation, const DrawUniform& draw);
+
+        /**
+         * @brief Add a draw with a texture transformation
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the shader was created with
+         * @ref PhongGL::Flag::TextureTransformation "Flag::TextureTransformation".
+         */
+        DrawBatchGL<Shader>& add(GL::MeshView& mesh, const TransformationUniform& transformation, const DrawUniform& draw, const TextureTransformationUniform& textureTransformation);
+
+        /**
+         * @brief Upload and draw all added meshes
+         * @return Reference to self (for method chaining)
+         *
+         * Splits the draws into batches of @ref batchSize() items as
+         * described in the @ref Shaders-DrawBatchGL-usage "class documentation"
+         * and then clears the added draws, keeping the allocated memory for
+         * the next frame. The draw offset of the shader is reset back to
+         * @cpp 0 @ce at the end. Call @ref GL::StreamingBuffer::nextFrame()
+         * on the buffer once all draws for given frame are submitted.
+         */
+        DrawBatchGL<Shader>& draw();
+
+    private:
+        Shader* _shader;
+        GL::StreamingBuffer* _buffer;
+        Containers::Array<Containers::Reference<GL::MeshView>> _meshes;
+        Containers::Array<TransformationUniform> _transformations;
+        Containers::Array<DrawUniform> _draws;
+        Containers::Array<TextureTransformationUniform> _textureTransformations;
+};
+
+namespace Implementation {
+    template<> struct DrawBatchTraits<PhongGL> {
+        typedef TransformationUniform3D TransformationUniform;
+        typedef PhongDrawUniform DrawUniform;
+    };
+    template<> struct DrawBatchTraits<FlatGL<2>> {
+        typedef TransformationProjectionUniform2D TransformationUniform;
+        typedef FlatDrawUniform DrawUniform;
+    };
+    template<> struct DrawBatchTraits<FlatGL<3>> {
+        typedef TransformationProjectionUniform3D TransformationUniform;
+        typedef FlatDrawUniform DrawUniform;
+    };
+    template<> struct DrawBatchTraits<MeshVisualizerGL2D> {
+        typedef TransformationProjectionUniform2D TransformationUniform;
+        typedef MeshVisualizerDrawUniform2D DrawUniform;
+    };
+    template<> struct DrawBatchTraits<MeshVisualizerGL3D> {
+        typedef TransformationUniform3D TransformationUniform;
+        typedef MeshVisualizerDrawUniform3D DrawUniform;
+    };
+}
+
+}}
+#else
+#error this header is not available in the OpenGL ES 2.0 and WebGL build
+#endif
+
+#endif
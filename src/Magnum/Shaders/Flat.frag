@@ -32,6 +32,10 @@
 #extension GL_ARB_shader_storage_buffer_object: require
 #endif
 
+#ifdef BINDLESS_TEXTURES
+#extension GL_ARB_bindless_texture: require
+#endif
+
 #ifndef NEW_GLSL
 #define fragmentColor gl_FragColor
 #define texture texture2D
@@ -133,11 +137,28 @@ layout(std140
 ) BUFFER_OR_UNIFORM Material {
     BUFFER_READONLY MaterialUniform materials[MATERIAL_COUNT];
 };
+
+#ifdef BINDLESS_TEXTURES
+/* Each handle is a 64-bit value, split into two 32-bit halves */
+struct TextureHandleUniform {
+    highp uvec4 textureObjectIdTexture;
+    #define textureHandle_texture textureObjectIdTexture.xy
+    #define textureHandle_objectIdTexture textureObjectIdTexture.zw
+};
+
+layout(std140
+    #if defined(EXPLICIT_BINDING) || defined(SHADER_STORAGE_BUFFERS)
+    , binding = 7
+    #endif
+) BUFFER_OR_UNIFORM TextureHandle {
+    BUFFER_READONLY TextureHandleUniform textureHandles[MATERIAL_COUNT];
+};
+#endif
 #endif
 
 /* Textures */
 
-#ifdef TEXTURED
+#if defined(TEXTURED) && !defined(BINDLESS_TEXTURES)
 #ifdef EXPLICIT_BINDING
 layout(binding = 0)
 #endif
@@ -150,7 +171,7 @@ uniform lowp
     textureData;
 #endif
 
-#ifdef OBJECT_ID_TEXTURE
+#if defined(OBJECT_ID_TEXTURE) && !defined(BINDLESS_TEXTURES)
 #ifdef EXPLICIT_BINDING
 layout(binding = 5)
 #endif
@@ -221,6 +242,23 @@ void main() {
     #endif
     #endif
 
+    #ifdef BINDLESS_TEXTURES
+    #ifdef TEXTURED
+    #ifndef TEXTURE_ARRAYS
+    sampler2D textureData = sampler2D(textureHandles[materialId].textureHandle_texture);
+    #else
+    sampler2DArray textureData = sampler2DArray(textureHandles[materialId].textureHandle_texture);
+    #endif
+    #endif
+    #ifdef OBJECT_ID_TEXTURE
+    #ifndef TEXTURE_ARRAYS
+    usampler2D objectIdTextureData = usampler2D(textureHandles[materialId].textureHandle_objectIdTexture);
+    #else
+    usampler2DArray objectIdTextureData = usampler2DArray(textureHandles[materialId].textureHandle_objectIdTexture);
+    #endif
+    #endif
+    #endif
+
     fragmentColor =
         #ifdef TEXTURED
         texture(textureData, interpolatedTextureCoordinates)*
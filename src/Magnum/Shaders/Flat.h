@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Struct @ref Magnum::Shaders::FlatDrawUniform, @ref Magnum::Shaders::FlatMaterialUniform
+ * @brief Struct @ref Magnum::Shaders::FlatDrawUniform, @ref Magnum::Shaders::FlatMaterialUniform, @ref Magnum::Shaders::FlatTextureHandleUniform
  */
 
 #include "Magnum/Magnum.h"
@@ -274,6 +274,73 @@ struct FlatMaterialUniform {
     #endif
 };
 
+/**
+@brief Texture handle uniform for flat shaders
+@m_since_latest
+
+Describes bindless texture handles used by a material, indexed by the same
+@ref FlatDrawUniform::materialId as @ref FlatMaterialUniform. Used only if
+@ref FlatGL::Flag::BindlessTextures is enabled.
+@see @ref FlatGL::bindTextureHandleBuffer(), @ref GL::AbstractTexture::handle()
+*/
+struct FlatTextureHandleUniform {
+    /** @brief Construct with default parameters */
+    constexpr explicit FlatTextureHandleUniform(DefaultInitT = DefaultInit) noexcept: texture{0}, objectIdTexture{0} {}
+
+    /** @brief Construct without initializing the contents */
+    explicit FlatTextureHandleUniform(NoInitT) noexcept {}
+
+    /** @{
+     * @name Convenience setters
+     *
+     * Provided to allow the use of method chaining for populating a structure
+     * in a single expression, otherwise equivalent to accessing the fields
+     * directly. Also guaranteed to provide backwards compatibility when
+     * packing of the actual fields changes.
+     */
+
+    /**
+     * @brief Set the @ref texture field
+     * @return Reference to self (for method chaining)
+     */
+    FlatTextureHandleUniform& setTexture(UnsignedLong handle) {
+        texture = handle;
+        return *this;
+    }
+
+    /**
+     * @brief Set the @ref objectIdTexture field
+     * @return Reference to self (for method chaining)
+     */
+    FlatTextureHandleUniform& setObjectIdTexture(UnsignedLong handle) {
+        objectIdTexture = handle;
+        return *this;
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @brief Color texture handle
+     *
+     * Default value is @cpp 0 @ce. Used only if @ref FlatGL::Flag::Textured
+     * is enabled, ignored otherwise. The handle is expected to be resident.
+     * @see @ref GL::AbstractTexture::makeHandleResident()
+     */
+    UnsignedLong texture;
+
+    /**
+     * @brief Object ID texture handle
+     *
+     * Default value is @cpp 0 @ce. Used only if
+     * @ref FlatGL::Flag::ObjectIdTexture is enabled, ignored otherwise. The
+     * handle is expected to be resident.
+     * @see @ref GL::AbstractTexture::makeHandleResident()
+     */
+    UnsignedLong objectIdTexture;
+};
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /** @brief @copybrief FlatGL
  * @m_deprecated_since_latest Use @ref FlatGL instead.
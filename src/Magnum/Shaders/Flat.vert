@@ -239,6 +239,7 @@ layout(std140
 
 /* Inputs */
 
+#ifndef VERTEX_PULLING
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = POSITION_ATTRIBUTE_LOCATION)
 #endif
@@ -264,6 +265,18 @@ layout(location = COLOR_ATTRIBUTE_LOCATION)
 in lowp vec4 vertexColor;
 #endif
 
+#else
+/* Per-vertex attributes fetched from a buffer based on the vertex ID, in a
+   layout matching MeshTools::vertexPullingData(). The header contains offsets
+   of the attribute arrays, with 0xffffffffu for attributes that aren't
+   present, and the total vertex count. */
+layout(std430, binding = 10) readonly buffer Vertices {
+    highp uvec4 vertexOffsetsPositionNormalTangentBitangent;
+    highp uvec4 vertexOffsetsTextureCoordinatesColorCountReserved;
+    highp float vertexData[];
+};
+#endif
+
 #ifdef JOINT_COUNT
 #if PER_VERTEX_JOINT_COUNT
 #ifdef EXPLICIT_ATTRIB_LOCATION
@@ -348,6 +361,29 @@ flat out highp uint drawId;
 #endif
 
 void main() {
+    #ifdef VERTEX_PULLING
+    /* With indexed draws the vertex ID includes the base vertex already */
+    highp const uint vertexId = uint(gl_VertexID);
+    highp const uint positionOffset = vertexOffsetsPositionNormalTangentBitangent.x + vertexId*3u;
+    #ifdef TWO_DIMENSIONS
+    highp const vec2 position = vec2(vertexData[positionOffset], vertexData[positionOffset + 1u]);
+    #elif defined(THREE_DIMENSIONS)
+    highp const vec4 position = vec4(vertexData[positionOffset], vertexData[positionOffset + 1u], vertexData[positionOffset + 2u], 1.0);
+    #else
+    #error
+    #endif
+    #ifdef TEXTURED
+    highp const uint textureCoordinatesOffset = vertexOffsetsTextureCoordinatesColorCountReserved.x + vertexId*2u;
+    mediump const vec2 textureCoordinates = vertexOffsetsTextureCoordinatesColorCountReserved.x == 0xffffffffu ? vec2(0.0) :
+        vec2(vertexData[textureCoordinatesOffset], vertexData[textureCoordinatesOffset + 1u]);
+    #endif
+    #ifdef VERTEX_COLOR
+    highp const uint colorOffset = vertexOffsetsTextureCoordinatesColorCountReserved.y + vertexId*4u;
+    lowp const vec4 vertexColor = vertexOffsetsTextureCoordinatesColorCountReserved.y == 0xffffffffu ? vec4(0.0, 0.0, 0.0, 1.0) :
+        vec4(vertexData[colorOffset], vertexData[colorOffset + 1u], vertexData[colorOffset + 2u], vertexData[colorOffset + 3u]);
+    #endif
+    #endif
+
     #ifdef UNIFORM_BUFFERS
     #ifdef MULTI_DRAW
     drawId = drawOffset + uint(
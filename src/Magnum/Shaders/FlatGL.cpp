@@ -78,6 +78,13 @@ namespace {
         MaterialBufferBinding = 4,
         /* 5 unused */
         JointBufferBinding = 6,
+        #ifndef MAGNUM_TARGET_GLES
+        TextureHandleBufferBinding = 7, /* shared with Phong */
+        #endif
+        /* 8 and 9 used by light clusters in Phong */
+        #ifndef MAGNUM_TARGET_WEBGL
+        VertexBufferBinding = 10 /* shared with Phong */
+        #endif
     };
     #endif
 }
@@ -116,6 +123,20 @@ template<UnsignedInt dimensions> typename FlatGL<dimensions>::CompileState FlatG
         "Shaders::FlatGL: texture arrays require texture transformation enabled as well if uniform buffers are used", CompileState{NoCreate});
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(configuration.flags() & Flag::BindlessTextures) || configuration.flags() >= Flag::UniformBuffers,
+        "Shaders::FlatGL: bindless textures require uniform buffers to be enabled", CompileState{NoCreate});
+    CORRADE_ASSERT(!(configuration.flags() & Flag::BindlessTextures) || configuration.flags() & Flag::Textured || configuration.flags() >= Flag::ObjectIdTexture,
+        "Shaders::FlatGL: bindless textures enabled but the shader is not textured", CompileState{NoCreate});
+    #endif
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    CORRADE_ASSERT(!(configuration.flags() & Flag::VertexPulling) || configuration.flags() >= Flag::ShaderStorageBuffers,
+        "Shaders::FlatGL: vertex pulling requires shader storage buffers to be enabled", CompileState{NoCreate});
+    CORRADE_ASSERT(!(configuration.flags() & Flag::VertexPulling) || (!configuration.perVertexJointCount() && !configuration.secondaryPerVertexJointCount()),
+        "Shaders::FlatGL: vertex pulling can't be used together with skinning", CompileState{NoCreate});
+    #endif
+
     #ifndef MAGNUM_TARGET_GLES2
     CORRADE_ASSERT(!(configuration.flags() & Flag::DynamicPerVertexJointCount) || (configuration.perVertexJointCount() || configuration.secondaryPerVertexJointCount()),
         "Shaders::FlatGL: dynamic per-vertex joint count enabled for zero joints", CompileState{NoCreate});
@@ -152,6 +173,8 @@ template<UnsignedInt dimensions> typename FlatGL<dimensions>::CompileState FlatG
     #ifndef MAGNUM_TARGET_GLES
     if(configuration.flags() >= Flag::TextureArrays)
         MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::EXT::texture_array);
+    if(configuration.flags() >= Flag::BindlessTextures)
+        MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::bindless_texture);
     #endif
 
     #ifdef MAGNUM_BUILD_STATIC
@@ -164,7 +187,10 @@ template<UnsignedInt dimensions> typename FlatGL<dimensions>::CompileState FlatG
     const GL::Context& context = GL::Context::current();
 
     #ifndef MAGNUM_TARGET_GLES
-    const GL::Version version = context.supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300, GL::Version::GL210});
+    /* The bindless texture GLSL extension is written against GLSL 4.00, and
+       the extension requires GL 4.0 anyway */
+    const GL::Version version = configuration.flags() >= Flag::BindlessTextures ? GL::Version::GL400 :
+        context.supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300, GL::Version::GL210});
     #else
     const GL::Version version = context.supportedVersion({
         #ifndef MAGNUM_TARGET_WEBGL
@@ -277,7 +303,8 @@ template<UnsignedInt dimensions> typename FlatGL<dimensions>::CompileState FlatG
         if(configuration.flags() >= Flag::ShaderStorageBuffers) {
             vert.addSource(
                 "#define UNIFORM_BUFFERS\n"
-                "#define SHADER_STORAGE_BUFFERS\n"_s);
+                "#define SHADER_STORAGE_BUFFERS\n"_s)
+                .addSource(configuration.flags() & Flag::VertexPulling ? "#define VERTEX_PULLING\n"_s : ""_s);
         } else
         #endif
         {
@@ -306,6 +333,9 @@ template<UnsignedInt dimensions> typename FlatGL<dimensions>::CompileState FlatG
         .addSource(configuration.flags() >= Flag::InstancedObjectId ? "#define INSTANCED_OBJECT_ID\n"_s : ""_s)
         .addSource(configuration.flags() >= Flag::ObjectIdTexture ? "#define OBJECT_ID_TEXTURE\n"_s : ""_s)
         #endif
+        #ifndef MAGNUM_TARGET_GLES
+        .addSource(configuration.flags() >= Flag::BindlessTextures ? "#define BINDLESS_TEXTURES\n"_s : ""_s)
+        #endif
         ;
     #ifndef MAGNUM_TARGET_GLES2
     if(configuration.flags() >= Flag::UniformBuffers) {
@@ -459,9 +489,17 @@ template<UnsignedInt dimensions> FlatGL<dimensions>::FlatGL(CompileState&& state
     if(state._version < GL::Version::GLES310)
     #endif
     {
-        if(_flags & Flag::Textured) setUniform(uniformLocation("textureData"_s), TextureUnit);
+        #ifndef MAGNUM_TARGET_GLES
+        /* With bindless textures there are no sampler uniforms */
+        if(!(_flags >= Flag::BindlessTextures))
+        #endif
+        {
+            if(_flags & Flag::Textured) setUniform(uniformLocation("textureData"_s), TextureUnit);
+            #ifndef MAGNUM_TARGET_GLES2
+            if(_flags >= Flag::ObjectIdTexture) setUniform(uniformLocation("objectIdTextureData"_s), ObjectIdTextureUnit);
+            #endif
+        }
         #ifndef MAGNUM_TARGET_GLES2
-        if(_flags >= Flag::ObjectIdTexture) setUniform(uniformLocation("objectIdTextureData"_s), ObjectIdTextureUnit);
         /* SSBOs have bindings defined in the source always */
         if(_flags >= Flag::UniformBuffers
             #ifndef MAGNUM_TARGET_WEBGL
@@ -475,6 +513,10 @@ template<UnsignedInt dimensions> FlatGL<dimensions>::FlatGL(CompileState&& state
             setUniformBlockBinding(uniformBlockIndex("Material"_s), MaterialBufferBinding);
             if(_jointCount)
                 setUniformBlockBinding(uniformBlockIndex("Joint"_s), JointBufferBinding);
+            #ifndef MAGNUM_TARGET_GLES
+            if(_flags >= Flag::BindlessTextures)
+                setUniformBlockBinding(uniformBlockIndex("TextureHandle"_s), TextureHandleBufferBinding);
+            #endif
         }
         #endif
     }
@@ -762,9 +804,45 @@ template<UnsignedInt dimensions> FlatGL<dimensions>& FlatGL<dimensions>::bindJoi
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+template<UnsignedInt dimensions> FlatGL<dimensions>& FlatGL<dimensions>::bindVertexBuffer(GL::Buffer& buffer) {
+    CORRADE_ASSERT(_flags & Flag::VertexPulling,
+        "Shaders::FlatGL::bindVertexBuffer(): the shader was not created with vertex pulling enabled", *this);
+    buffer.bind(GL::Buffer::Target::ShaderStorage, VertexBufferBinding);
+    return *this;
+}
+
+template<UnsignedInt dimensions> FlatGL<dimensions>& FlatGL<dimensions>::bindVertexBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    CORRADE_ASSERT(_flags & Flag::VertexPulling,
+        "Shaders::FlatGL::bindVertexBuffer(): the shader was not created with vertex pulling enabled", *this);
+    buffer.bind(GL::Buffer::Target::ShaderStorage, VertexBufferBinding, offset, size);
+    return *this;
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES
+template<UnsignedInt dimensions> FlatGL<dimensions>& FlatGL<dimensions>::bindTextureHandleBuffer(GL::Buffer& buffer) {
+    CORRADE_ASSERT(_flags >= Flag::BindlessTextures,
+        "Shaders::FlatGL::bindTextureHandleBuffer(): the shader was not created with bindless textures enabled", *this);
+    buffer.bind(_flags >= Flag::ShaderStorageBuffers ? GL::Buffer::Target::ShaderStorage : GL::Buffer::Target::Uniform, TextureHandleBufferBinding);
+    return *this;
+}
+
+template<UnsignedInt dimensions> FlatGL<dimensions>& FlatGL<dimensions>::bindTextureHandleBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    CORRADE_ASSERT(_flags >= Flag::BindlessTextures,
+        "Shaders::FlatGL::bindTextureHandleBuffer(): the shader was not created with bindless textures enabled", *this);
+    buffer.bind(_flags >= Flag::ShaderStorageBuffers ? GL::Buffer::Target::ShaderStorage : GL::Buffer::Target::Uniform, TextureHandleBufferBinding, offset, size);
+    return *this;
+}
+#endif
+
 template<UnsignedInt dimensions> FlatGL<dimensions>& FlatGL<dimensions>::bindTexture(GL::Texture2D& texture) {
     CORRADE_ASSERT(_flags & Flag::Textured,
         "Shaders::FlatGL::bindTexture(): the shader was not created with texturing enabled", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags >= Flag::BindlessTextures),
+        "Shaders::FlatGL::bindTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead", *this);
+    #endif
     #ifndef MAGNUM_TARGET_GLES2
     CORRADE_ASSERT(!(_flags & Flag::TextureArrays),
         "Shaders::FlatGL::bindTexture(): the shader was created with texture arrays enabled, use a Texture2DArray instead", *this);
@@ -777,6 +855,10 @@ template<UnsignedInt dimensions> FlatGL<dimensions>& FlatGL<dimensions>::bindTex
 template<UnsignedInt dimensions> FlatGL<dimensions>& FlatGL<dimensions>::bindTexture(GL::Texture2DArray& texture) {
     CORRADE_ASSERT(_flags & Flag::Textured,
         "Shaders::FlatGL::bindTexture(): the shader was not created with texturing enabled", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags >= Flag::BindlessTextures),
+        "Shaders::FlatGL::bindTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead", *this);
+    #endif
     CORRADE_ASSERT(_flags & Flag::TextureArrays,
         "Shaders::FlatGL::bindTexture(): the shader was not created with texture arrays enabled, use a Texture2D instead", *this);
     texture.bind(TextureUnit);
@@ -788,6 +870,10 @@ template<UnsignedInt dimensions> FlatGL<dimensions>& FlatGL<dimensions>::bindTex
 template<UnsignedInt dimensions> FlatGL<dimensions>& FlatGL<dimensions>::bindObjectIdTexture(GL::Texture2D& texture) {
     CORRADE_ASSERT(_flags >= Flag::ObjectIdTexture,
         "Shaders::FlatGL::bindObjectIdTexture(): the shader was not created with object ID texture enabled", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags >= Flag::BindlessTextures),
+        "Shaders::FlatGL::bindObjectIdTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead", *this);
+    #endif
     #ifndef MAGNUM_TARGET_GLES2
     CORRADE_ASSERT(!(_flags & Flag::TextureArrays),
         "Shaders::FlatGL::bindObjectIdTexture(): the shader was created with texture arrays enabled, use a Texture2DArray instead", *this);
@@ -799,6 +885,10 @@ template<UnsignedInt dimensions> FlatGL<dimensions>& FlatGL<dimensions>::bindObj
 template<UnsignedInt dimensions> FlatGL<dimensions>& FlatGL<dimensions>::bindObjectIdTexture(GL::Texture2DArray& texture) {
     CORRADE_ASSERT(_flags >= Flag::ObjectIdTexture,
         "Shaders::FlatGL::bindObjectIdTexture(): the shader was not created with object ID texture enabled", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags >= Flag::BindlessTextures),
+        "Shaders::FlatGL::bindObjectIdTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead", *this);
+    #endif
     CORRADE_ASSERT(_flags & Flag::TextureArrays,
         "Shaders::FlatGL::bindObjectIdTexture(): the shader was not created with texture arrays enabled, use a Texture2D instead", *this);
     texture.bind(ObjectIdTextureUnit);
@@ -865,6 +955,12 @@ Debug& operator<<(Debug& debug, const FlatGLFlag value) {
         _c(TextureArrays)
         _c(DynamicPerVertexJointCount)
         #endif
+        #ifndef MAGNUM_TARGET_GLES
+        _c(BindlessTextures)
+        #endif
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        _c(VertexPulling)
+        #endif
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -903,6 +999,12 @@ Debug& operator<<(Debug& debug, const FlatGLFlags value) {
         FlatGLFlag::TextureArrays,
         FlatGLFlag::DynamicPerVertexJointCount,
         #endif
+        #ifndef MAGNUM_TARGET_GLES
+        FlatGLFlag::BindlessTextures,
+        #endif
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        FlatGLFlag::VertexPulling,
+        #endif
     });
 }
 
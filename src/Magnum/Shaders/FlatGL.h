@@ -66,7 +66,13 @@ namespace Implementation {
         #endif
         MultiDraw = UniformBuffers|(1 << 9),
         TextureArrays = 1 << 10,
-        DynamicPerVertexJointCount = 1 << 12
+        DynamicPerVertexJointCount = 1 << 12,
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        BindlessTextures = 1 << 14,
+        #endif
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        VertexPulling = 1 << 15
         #endif
     };
     typedef Containers::EnumSet<FlatGLFlag> FlatGLFlags;
@@ -231,6 +237,19 @@ For a multidraw workflow enable @ref Flag::MultiDraw (and possibly
 texture offsets/layers for every draw. The usage is similar for all shaders,
 see @ref shaders-usage-multidraw for an example.
 
+On desktop GL with @gl_extension{ARB,bindless_texture}, enabling
+@ref Flag::BindlessTextures replaces texture binding with a per-material
+@ref FlatTextureHandleUniform buffer bound with @ref bindTextureHandleBuffer().
+Each material then references its own textures, which means a multidraw can
+sample a different texture in every draw without having to pack all textures
+into a single texture array.
+
+With @ref Flag::ShaderStorageBuffers, enabling @ref Flag::VertexPulling makes
+the shader fetch per-vertex attributes from a buffer bound with
+@ref bindVertexBuffer() instead of from vertex attributes. Together with
+@ref MeshTools::compileVertexPulling() all meshes can then be drawn through a
+single attribute-less mesh, making multidraw independent of the vertex layout.
+
 For skinning, joint matrices are supplied via a @ref TransformationUniform2D /
 @ref TransformationUniform3D buffer bound with @ref bindJointBuffer(). In an
 instanced scenario the per-instance joint count is supplied via
@@ -696,6 +715,53 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT FlatGL: public GL::
              */
             DynamicPerVertexJointCount = 1 << 12,
             #endif
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * Use bindless textures. Instead of binding textures with
+             * @ref bindTexture() and @ref bindObjectIdTexture(), resident
+             * texture handles are read from a @ref FlatTextureHandleUniform
+             * buffer bound with @ref bindTextureHandleBuffer(), indexed by
+             * @ref FlatDrawUniform::materialId. Together with
+             * @ref Flag::MultiDraw this allows a single draw call to use a
+             * different texture for each draw without any texture binding in
+             * between. Expects that @ref Flag::UniformBuffers is enabled
+             * and that at least one of @ref Flag::Textured and
+             * @ref Flag::ObjectIdTexture is enabled.
+             * @see @ref GL::AbstractTexture::handle(),
+             *      @ref GL::AbstractTexture::makeHandleResident()
+             * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+             * @requires_gl Bindless textures are not available in OpenGL ES
+             *      and WebGL.
+             * @m_since_latest
+             */
+            BindlessTextures = 1 << 14,
+            #endif
+
+            #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+            /**
+             * Vertex pulling. Instead of going through vertex attributes,
+             * @ref Position, @ref TextureCoordinates and @ref Color4 are
+             * fetched from a shader storage buffer bound with
+             * @ref bindVertexBuffer(), indexed with the vertex ID. The buffer
+             * is usually filled with @ref MeshTools::compileVertexPulling(),
+             * which concatenates multiple meshes, and as the vertex ID
+             * includes the base vertex, a single mesh with no vertex
+             * attributes can be then used to draw all of them. Together with
+             * @ref Flag::MultiDraw this makes it possible to draw arbitrary
+             * meshes in a single call without any vertex array switches.
+             * Instanced attributes are still taken from vertex buffers.
+             * Expects that @ref Flag::ShaderStorageBuffers is enabled and
+             * that skinning isn't used.
+             * @requires_gl43 Extension @gl_extension{ARB,shader_storage_buffer_object}
+             * @requires_gles31 Shader storage buffers are not available in
+             *      OpenGL ES 3.0 and older.
+             * @requires_gles Shader storage buffers are not available in
+             *      WebGL.
+             * @m_since_latest
+             */
+            VertexPulling = 1 << 15,
+            #endif
         };
 
         /**
@@ -1254,6 +1320,57 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT FlatGL: public GL::
          */
         FlatGL<dimensions>& bindJointBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Bind a texture handle uniform / shader storage buffer
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that @ref Flag::BindlessTextures is set. The buffer is
+         * expected to contain @ref materialCount() instances of
+         * @ref FlatTextureHandleUniform, with all referenced handles being
+         * resident.
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES and
+         *      WebGL.
+         */
+        FlatGL<dimensions>& bindTextureHandleBuffer(GL::Buffer& buffer);
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        FlatGL<dimensions>& bindTextureHandleBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+        #endif
+
+        #ifndef MAGNUM_TARGET_WEBGL
+        /**
+         * @brief Bind a vertex shader storage buffer
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that @ref Flag::VertexPulling is set. The buffer is
+         * expected to contain data in a layout described by
+         * @ref MeshTools::VertexPullingLayout, usually filled by
+         * @ref MeshTools::compileVertexPulling(). Positions are always
+         * taken, texture coordinates only if @ref Flag::Textured or
+         * @ref Flag::ObjectIdTexture is enabled and colors only if
+         * @ref Flag::VertexColor is enabled. If the buffer doesn't contain
+         * given attribute, a default of @cpp (0, 0, 0, 1) @ce is used,
+         * consistently with vertex attributes that aren't bound.
+         * @requires_gl43 Extension @gl_extension{ARB,shader_storage_buffer_object}
+         * @requires_gles31 Shader storage buffers are not available in
+         *      OpenGL ES 3.0 and older.
+         * @requires_gles Shader storage buffers are not available in
+         *      WebGL.
+         */
+        FlatGL<dimensions>& bindVertexBuffer(GL::Buffer& buffer);
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        FlatGL<dimensions>& bindVertexBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+        #endif
+
         /**
          * @}
          */
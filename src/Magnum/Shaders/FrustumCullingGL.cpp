@@ -0,0 +1,247 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2022 Vladislav Oleshko <vladislav.oleshko@gmail.com>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FrustumCullingGL.h"
+
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Matrix4.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+static void importShaderResources() {
+    CORRADE_RESOURCE_INITIALIZE(MagnumShaders_RESOURCES_GL)
+}
+#endif
+
+namespace Magnum { namespace Shaders {
+
+using namespace Containers::Literals;
+
+namespace {
+    enum: Int {
+        FrustumUniform = 0,
+        InstanceCountUniform = 6,
+        InstanceStrideUniform = 7,
+        DrawCommandOffsetUniform = 8,
+        HierarchicalZMatrixUniform = 9
+    };
+
+    enum: Int {
+        InstanceBufferBinding = 0,
+        BoundsBufferBinding = 1,
+        OutputInstanceBufferBinding = 2,
+        DrawCommandBufferBinding = 3
+    };
+
+    enum: Int { HierarchicalZTextureUnit = 0 };
+
+    /* Has to match local_size_x in the shader */
+    constexpr UnsignedInt WorkgroupSize = 64;
+}
+
+FrustumCullingGL::CompileState FrustumCullingGL::compile(const Configuration& configuration) {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL430);
+    const GL::Version version = GL::Version::GL430;
+    #else
+    MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GLES310);
+    const GL::Version version = GL::Version::GLES310;
+    #endif
+
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumShadersGL"_s))
+        importShaderResources();
+    #endif
+    Utility::Resource rs("MagnumShadersGL"_s);
+
+    GL::Shader comp{version, GL::Shader::Type::Compute};
+    comp.addSource(rs.getString("compatibility.glsl"_s))
+        .addSource(configuration.flags() >= Flag::HierarchicalZ ? "#define HIERARCHICAL_Z\n"_s : ""_s)
+        .addSource(rs.getString("FrustumCulling.comp"_s))
+        .submitCompile();
+
+    FrustumCullingGL out{NoInit};
+    out._flags = configuration.flags();
+
+    out.attachShader(comp);
+    out.submitLink();
+
+    return CompileState{Utility::move(out), Utility::move(comp)};
+}
+
+FrustumCullingGL::CompileState FrustumCullingGL::compile() {
+    return compile(Configuration{});
+}
+
+FrustumCullingGL::FrustumCullingGL(CompileState&& state): FrustumCullingGL{static_cast<FrustumCullingGL&&>(Utility::move(state))} {
+    #ifdef CORRADE_GRACEFUL_ASSERT
+    /* When graceful assertions fire from within compile(), we get a NoCreate'd
+       CompileState. Exiting makes it possible to test the assert. */
+    if(!id()) return;
+    #endif
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(checkLink({GL::Shader(state._comp)}));
+
+    /* Set defaults in OpenGL ES (for desktop they are set in shader code
+       itself) */
+    #ifdef MAGNUM_TARGET_GLES
+    setFrustum(Frustum{Math::IdentityInit});
+    setInstanceStride(64);
+    /* Draw command offset is zero by default */
+    if(_flags >= Flag::HierarchicalZ)
+        setHierarchicalZMatrix(Matrix4{Math::IdentityInit});
+    #endif
+}
+
+FrustumCullingGL::FrustumCullingGL(const Configuration& configuration): FrustumCullingGL{compile(configuration)} {}
+
+FrustumCullingGL::FrustumCullingGL(): FrustumCullingGL{compile()} {}
+
+FrustumCullingGL::FrustumCullingGL(NoInitT) {}
+
+FrustumCullingGL& FrustumCullingGL::setFrustum(const Frustum& frustum) {
+    /* Normalizing the planes on the CPU so the shader can compare the plane
+       distance directly against the bounding sphere radius */
+    Math::Vector<4, Float> planes[6];
+    for(std::size_t i = 0; i != 6; ++i)
+        planes[i] = frustum[i]/frustum[i].xyz().length();
+    setUniform(FrustumUniform, Containers::arrayView(planes));
+    return *this;
+}
+
+FrustumCullingGL& FrustumCullingGL::setInstanceStride(const UnsignedInt stride) {
+    CORRADE_ASSERT(stride % 4 == 0 && stride >= 64,
+        "Shaders::FrustumCullingGL::setInstanceStride(): expected a multiple of 4 and at least 64 bytes, got" << stride, *this);
+    setUniform(InstanceStrideUniform, stride/4);
+    return *this;
+}
+
+FrustumCullingGL& FrustumCullingGL::setDrawCommandOffset(const UnsignedInt offset) {
+    CORRADE_ASSERT(offset % 4 == 0,
+        "Shaders::FrustumCullingGL::setDrawCommandOffset(): expected a multiple of 4, got" << offset, *this);
+    setUniform(DrawCommandOffsetUniform, offset/4);
+    return *this;
+}
+
+FrustumCullingGL& FrustumCullingGL::setHierarchicalZMatrix(const Matrix4& matrix) {
+    CORRADE_ASSERT(_flags >= Flag::HierarchicalZ,
+        "Shaders::FrustumCullingGL::setHierarchicalZMatrix(): the shader was not created with hierarchical Z enabled", *this);
+    setUniform(HierarchicalZMatrixUniform, matrix);
+    return *this;
+}
+
+FrustumCullingGL& FrustumCullingGL::bindInstanceBuffer(GL::Buffer& buffer) {
+    buffer.bind(GL::Buffer::Target::ShaderStorage, InstanceBufferBinding);
+    return *this;
+}
+
+FrustumCullingGL& FrustumCullingGL::bindInstanceBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    buffer.bind(GL::Buffer::Target::ShaderStorage, InstanceBufferBinding, offset, size);
+    return *this;
+}
+
+FrustumCullingGL& FrustumCullingGL::bindBoundsBuffer(GL::Buffer& buffer) {
+    buffer.bind(GL::Buffer::Target::ShaderStorage, BoundsBufferBinding);
+    return *this;
+}
+
+FrustumCullingGL& FrustumCullingGL::bindBoundsBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    buffer.bind(GL::Buffer::Target::ShaderStorage, BoundsBufferBinding, offset, size);
+    return *this;
+}
+
+FrustumCullingGL& FrustumCullingGL::bindOutputInstanceBuffer(GL::Buffer& buffer) {
+    buffer.bind(GL::Buffer::Target::ShaderStorage, OutputInstanceBufferBinding);
+    return *this;
+}
+
+FrustumCullingGL& FrustumCullingGL::bindOutputInstanceBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    buffer.bind(GL::Buffer::Target::ShaderStorage, OutputInstanceBufferBinding, offset, size);
+    return *this;
+}
+
+FrustumCullingGL& FrustumCullingGL::bindDrawCommandBuffer(GL::Buffer& buffer) {
+    buffer.bind(GL::Buffer::Target::ShaderStorage, DrawCommandBufferBinding);
+    return *this;
+}
+
+FrustumCullingGL& FrustumCullingGL::bindHierarchicalZTexture(GL::Texture2D& texture) {
+    CORRADE_ASSERT(_flags >= Flag::HierarchicalZ,
+        "Shaders::FrustumCullingGL::bindHierarchicalZTexture(): the shader was not created with hierarchical Z enabled", *this);
+    texture.bind(HierarchicalZTextureUnit);
+    return *this;
+}
+
+FrustumCullingGL& FrustumCullingGL::cull(const UnsignedInt instanceCount) {
+    if(!instanceCount) return *this;
+
+    setUniform(InstanceCountUniform, instanceCount);
+    dispatchCompute({(instanceCount + WorkgroupSize - 1)/WorkgroupSize, 1, 1});
+
+    /* The draw command buffer is consumed as an indirect buffer, output
+       instances as vertex attributes, and both may get read by subsequent
+       compute dispatches as well */
+    GL::Renderer::setMemoryBarrier(
+        GL::Renderer::MemoryBarrier::Command|
+        GL::Renderer::MemoryBarrier::VertexAttributeArray|
+        GL::Renderer::MemoryBarrier::ShaderStorage);
+    return *this;
+}
+
+Debug& operator<<(Debug& debug, const FrustumCullingGL::Flag value) {
+    debug << "Shaders::FrustumCullingGL::Flag" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case FrustumCullingGL::Flag::v: return debug << "::" #v;
+        _c(HierarchicalZ)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const FrustumCullingGL::Flags value) {
+    return Containers::enumSetDebugOutput(debug, value, "Shaders::FrustumCullingGL::Flags{}", {
+        FrustumCullingGL::Flag::HierarchicalZ
+    });
+}
+
+}}
@@ -0,0 +1,394 @@
+#ifndef Magnum_Shaders_FrustumCullingGL_h
+#define Magnum_Shaders_FrustumCullingGL_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::Shaders::FrustumCullingGL
+ * @m_since_latest
+ */
+#endif
+
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/Shaders/glShaderWrapper.h"
+#include "Magnum/Shaders/visibility.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum { namespace Shaders {
+
+/**
+@brief GPU frustum culling OpenGL compute shader
+@m_since_latest
+
+Takes per-instance data and bounding spheres in buffers, culls them against a
+frustum and optionally a hierarchical depth buffer, and writes the visible
+instances into a compacted buffer together with an instance count of an
+indirect draw command. The output can be then directly consumed by an
+instanced shader such as @ref PhongGL with
+@ref PhongGL::Flag::InstancedTransformation drawn using
+@ref GL::AbstractShaderProgram::draw(GL::Mesh&, GL::Buffer&, GLintptr, UnsignedInt, UnsignedInt),
+without the instance data ever going through the CPU.
+
+@section Shaders-FrustumCullingGL-usage Usage
+
+Each instance is a record of @ref setInstanceStride() bytes in a buffer bound
+with @ref bindInstanceBuffer(). The record is expected to start with a
+column-major @ref Matrix4 transformation, which is used to transform the
+instance bounding sphere, the rest is arbitrary and gets copied to the output
+as-is. For @ref PhongGL that's commonly the @ref PhongGL::TransformationMatrix
+followed by @ref PhongGL::NormalMatrix and optionally
+@ref PhongGL::TextureOffset, tightly packed. Bounding spheres are a
+@ref Vector4 per instance in a buffer bound with @ref bindBoundsBuffer(), with
+the sphere center in the XYZ components and radius in the W component, both
+in the space the instance transformation is applied to.
+
+The visible instances are written to a buffer bound with
+@ref bindOutputInstanceBuffer() in the same layout, which can be then added to
+a mesh as an instanced vertex buffer. The draw command buffer bound with
+@ref bindDrawCommandBuffer() is expected to contain a
+@ref GL::DrawArraysIndirectCommand or @ref GL::DrawElementsIndirectCommand at
+@ref setDrawCommandOffset(), with all fields filled in. The shader atomically
+increments its @ref GL::DrawElementsIndirectCommand::instanceCount "instanceCount"
+for every visible instance, so it has to be reset to zero before each
+@ref cull() call. The culling is then done against a frustum set with
+@ref setFrustum(), in the same space as the instance transformations get
+converted to. The @ref cull() function dispatches the computation and issues a
+memory barrier so the results can be directly used for drawing:
+
+@snippet Shaders-gl.cpp FrustumCullingGL-usage
+
+@section Shaders-FrustumCullingGL-hierarchical-z Hierarchical depth culling
+
+If @ref Flag::HierarchicalZ is enabled, instances that passed the frustum test
+are additionally tested against a hierarchical depth buffer bound with
+@ref bindHierarchicalZTexture(). It's expected to be a single-channel floating
+point texture with a full mip chain where each texel contains the farthest
+depth of the corresponding 2x2 texels in the previous level, for example
+generated from the previous frame depth buffer. The texture is expected to
+have @ref GL::SamplerFilter::Nearest and @ref GL::SamplerMipmap::Nearest
+filtering. The bounding spheres are projected to the depth buffer space using
+a matrix set with @ref setHierarchicalZMatrix(), which is usually the same
+projection and camera matrix the frustum was created from. Bounds crossing
+the near plane are always treated as visible.
+
+@requires_gl43 Extension @gl_extension{ARB,compute_shader} and
+    @gl_extension{ARB,shader_storage_buffer_object}
+@requires_gles31 Compute shaders are not available in OpenGL ES 3.0 and older.
+@requires_gles Compute shaders are not available in WebGL.
+*/
+class MAGNUM_SHADERS_EXPORT FrustumCullingGL: public GL::AbstractShaderProgram {
+    public:
+        class Configuration;
+        class CompileState;
+
+        /**
+         * @brief Flag
+         *
+         * @see @ref Flags, @ref flags(), @ref Configuration::setFlags()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * Additionally cull the instances against a hierarchical depth
+             * buffer. See @ref Shaders-FrustumCullingGL-hierarchical-z for
+             * more information.
+             */
+            HierarchicalZ = 1 << 0
+        };
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref flags(), @ref Configuration::setFlags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+
+        /**
+         * @brief Compile asynchronously
+         *
+         * Compared to @ref FrustumCullingGL(const Configuration&) can perform
+         * an asynchronous compilation and linking. See @ref shaders-async for
+         * more information.
+         * @see @ref FrustumCullingGL(CompileState&&)
+         */
+        static CompileState compile(const Configuration& configuration);
+
+        /** @overload */
+        static CompileState compile();
+
+        /**
+         * @brief Constructor
+         *
+         * Equivalent to calling @ref compile() followed by
+         * @ref FrustumCullingGL(CompileState&&).
+         */
+        explicit FrustumCullingGL(const Configuration& configuration);
+
+        /** @overload */
+        explicit FrustumCullingGL();
+
+        /**
+         * @brief Finalize an asynchronous compilation
+         *
+         * Takes an asynchronous compilation state returned by @ref compile()
+         * and forms a ready-to-use shader object. See @ref shaders-async for
+         * more information.
+         */
+        explicit FrustumCullingGL(CompileState&& state);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to a moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         * However note that this is a low-level and a potentially dangerous
+         * API, see the documentation of @ref NoCreate for alternatives.
+         */
+        explicit FrustumCullingGL(NoCreateT) noexcept: AbstractShaderProgram{NoCreate} {}
+
+        /** @brief Copying is not allowed */
+        FrustumCullingGL(const FrustumCullingGL&) = delete;
+
+        /** @brief Move constructor */
+        FrustumCullingGL(FrustumCullingGL&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        FrustumCullingGL& operator=(const FrustumCullingGL&) = delete;
+
+        /** @brief Move assignment */
+        FrustumCullingGL& operator=(FrustumCullingGL&&) noexcept = default;
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref Configuration::setFlags()
+         */
+        Flags flags() const { return _flags; }
+
+        /**
+         * @brief Set the culling frustum
+         * @return Reference to self (for method chaining)
+         *
+         * The frustum is expected to be in the space the instance
+         * transformations transform to, for example created with
+         * @ref Frustum::fromMatrix() from a projection matrix multiplied with
+         * a camera matrix. The planes are normalized before upload. Initial
+         * value is an identity frustum.
+         */
+        FrustumCullingGL& setFrustum(const Frustum& frustum);
+
+        /**
+         * @brief Set instance stride
+         * @return Reference to self (for method chaining)
+         *
+         * Size of a single instance record in both the input and output
+         * instance buffer, in bytes. Expected to be a multiple of
+         * @cpp 4 @ce and at least @cpp 64 @ce, to contain the leading
+         * @ref Matrix4 transformation. Initial value is @cpp 64 @ce.
+         */
+        FrustumCullingGL& setInstanceStride(UnsignedInt stride);
+
+        /**
+         * @brief Set draw command offset
+         * @return Reference to self (for method chaining)
+         *
+         * Byte offset of the @ref GL::DrawArraysIndirectCommand or
+         * @ref GL::DrawElementsIndirectCommand in the buffer bound with
+         * @ref bindDrawCommandBuffer(). Expected to be a multiple of
+         * @cpp 4 @ce. Initial value is @cpp 0 @ce.
+         */
+        FrustumCullingGL& setDrawCommandOffset(UnsignedInt offset);
+
+        /**
+         * @brief Set hierarchical depth projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Matrix projecting the instance bounds to the hierarchical depth
+         * buffer bound with @ref bindHierarchicalZTexture(). Expects that
+         * @ref Flag::HierarchicalZ is enabled. Initial value is an identity
+         * matrix.
+         */
+        FrustumCullingGL& setHierarchicalZMatrix(const Matrix4& matrix);
+
+        /**
+         * @brief Bind an instance buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Records of @ref setInstanceStride() bytes, each starting with a
+         * @ref Matrix4 transformation.
+         */
+        FrustumCullingGL& bindInstanceBuffer(GL::Buffer& buffer);
+        /**
+         * @overload
+         *
+         * The @p offset is expected to be aligned to
+         * @ref GL::Buffer::shaderStorageOffsetAlignment().
+         */
+        FrustumCullingGL& bindInstanceBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+
+        /**
+         * @brief Bind a bounds buffer
+         * @return Reference to self (for method chaining)
+         *
+         * A @ref Vector4 per instance with a bounding sphere center in the
+         * XYZ components and radius in the W component.
+         */
+        FrustumCullingGL& bindBoundsBuffer(GL::Buffer& buffer);
+        /**
+         * @overload
+         *
+         * The @p offset is expected to be aligned to
+         * @ref GL::Buffer::shaderStorageOffsetAlignment().
+         */
+        FrustumCullingGL& bindBoundsBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+
+        /**
+         * @brief Bind an output instance buffer
+         * @return Reference to self (for method chaining)
+         *
+         * The visible instance records get written here, in the same layout
+         * as the input. Has to be large enough to fit all instances. Order of
+         * the records isn't guaranteed to match the input order.
+         */
+        FrustumCullingGL& bindOutputInstanceBuffer(GL::Buffer& buffer);
+        /**
+         * @overload
+         *
+         * The @p offset is expected to be aligned to
+         * @ref GL::Buffer::shaderStorageOffsetAlignment().
+         */
+        FrustumCullingGL& bindOutputInstanceBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+
+        /**
+         * @brief Bind a draw command buffer
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref setDrawCommandOffset() for the expected layout.
+         */
+        FrustumCullingGL& bindDrawCommandBuffer(GL::Buffer& buffer);
+
+        /**
+         * @brief Bind a hierarchical depth texture
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @ref Flag::HierarchicalZ is enabled. See
+         * @ref Shaders-FrustumCullingGL-hierarchical-z for the expected
+         * texture contents.
+         */
+        FrustumCullingGL& bindHierarchicalZTexture(GL::Texture2D& texture);
+
+        /**
+         * @brief Cull instances
+         * @return Reference to self (for method chaining)
+         *
+         * Dispatches the compute shader for @p instanceCount instances and
+         * issues a @ref GL::Renderer::MemoryBarrier::Command and
+         * @relativeref{GL::Renderer::MemoryBarrier,VertexAttributeArray}
+         * barrier so the output can be directly used for drawing. Does
+         * nothing if @p instanceCount is zero.
+         */
+        FrustumCullingGL& cull(UnsignedInt instanceCount);
+
+    private:
+        /* Creates the GL shader program object but does nothing else.
+           Internal, used by compile(). */
+        explicit FrustumCullingGL(NoInitT);
+
+        /* Prevent accidentally calling irrelevant functions */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        using GL::AbstractShaderProgram::drawTransformFeedback;
+        using GL::AbstractShaderProgram::dispatchCompute;
+        #endif
+
+        Flags _flags;
+};
+
+CORRADE_ENUMSET_OPERATORS(FrustumCullingGL::Flags)
+
+/**
+@brief Configuration
+@m_since_latest
+
+@see @ref FrustumCullingGL(const Configuration&),
+    @ref compile(const Configuration&)
+*/
+class FrustumCullingGL::Configuration {
+    public:
+        explicit Configuration() = default;
+
+        /** @brief Flags */
+        Flags flags() const { return _flags; }
+
+        /**
+         * @brief Set flags
+         *
+         * No flags are set by default.
+         * @see @ref FrustumCullingGL::flags()
+         */
+        Configuration& setFlags(Flags flags) {
+            _flags = flags;
+            return *this;
+        }
+
+    private:
+        Flags _flags;
+};
+
+/**
+@brief Asynchronous compilation state
+@m_since_latest
+
+Returned by @ref compile(). See @ref shaders-async for more information.
+*/
+class FrustumCullingGL::CompileState: public FrustumCullingGL {
+    /* Everything deliberately private except for the inheritance */
+    friend class FrustumCullingGL;
+
+    explicit CompileState(NoCreateT): FrustumCullingGL{NoCreate}, _comp{NoCreate} {}
+
+    explicit CompileState(FrustumCullingGL&& shader, GL::Shader&& comp): FrustumCullingGL{Utility::move(shader)}, _comp{Utility::move(comp)} {}
+
+    Implementation::GLShaderWrapper _comp;
+};
+
+/** @debugoperatorclassenum{FrustumCullingGL,FrustumCullingGL::Flag} */
+MAGNUM_SHADERS_EXPORT Debug& operator<<(Debug& debug, FrustumCullingGL::Flag value);
+
+/** @debugoperatorclassenum{FrustumCullingGL,FrustumCullingGL::Flags} */
+MAGNUM_SHADERS_EXPORT Debug& operator<<(Debug& debug, FrustumCullingGL::Flags value);
+
+}}
+#else
+#error this header is not available in the OpenGL ES 2.0 and WebGL build
+#endif
+
+#endif
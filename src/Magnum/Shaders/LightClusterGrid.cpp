@@ -0,0 +1,206 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "LightClusterGrid.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Shaders {
+
+LightClusterGrid::LightClusterGrid(const Vector3ui& size, const Vector2i& viewportSize, const Matrix4& projection): _viewportSize{viewportSize}, _projection{projection}, _grid{NoInit} {
+    CORRADE_ASSERT(size.product(),
+        "Shaders::LightClusterGrid: expected a non-zero grid size, got" << Debug::packed << size, );
+    CORRADE_ASSERT(viewportSize.product(),
+        "Shaders::LightClusterGrid: expected a non-zero viewport size, got" << Debug::packed << viewportSize, );
+
+    /* Extract near and far plane distances from a projection created with
+       Matrix4::perspectiveProjection(). For an infinite far plane the
+       [2][2] element is -1, which makes the far plane calculation blow up. */
+    _near = projection[3][2]/(projection[2][2] - 1.0f);
+    _far = projection[3][2]/(projection[2][2] + 1.0f);
+    CORRADE_ASSERT(projection[2][3] == -1.0f && _near > 0.0f && _far > _near && _far != Constants::inf(),
+        "Shaders::LightClusterGrid: expected a perspective projection with a finite far plane", );
+
+    /* Depth slices are distributed logarithmically, slice(near) == 0 and
+       slice(far) == size.z() */
+    const Float logFarNear = Math::log(_far/_near);
+    _grid.size = size;
+    _grid.tileSize = Vector2{viewportSize}/Vector2{size.xy()};
+    _grid.depthScale = size.z()/logFarNear;
+    _grid.depthBias = size.z()*Math::log(_near)/logFarNear;
+
+    /* Calculate camera-space bounds of all clusters. A point on the near
+       plane unprojected from given NDC coordinates gets scaled to given depth
+       to be on the same ray. */
+    const Matrix4 projectionInverted = projection.inverted();
+    _clusterBounds = Containers::Array<Range3D>{NoInit, size.product()};
+    for(UnsignedInt z = 0; z != size.z(); ++z) {
+        const Float depths[]{
+            _near*Math::pow(_far/_near, Float(z)/size.z()),
+            _near*Math::pow(_far/_near, Float(z + 1)/size.z())
+        };
+        for(UnsignedInt y = 0; y != size.y(); ++y) {
+            for(UnsignedInt x = 0; x != size.x(); ++x) {
+                const Vector2 ndcMin = Vector2{Vector2ui{x, y}}*2.0f/Vector2{size.xy()} - Vector2{1.0f};
+                const Vector2 ndcMax = Vector2{Vector2ui{x + 1, y + 1}}*2.0f/Vector2{size.xy()} - Vector2{1.0f};
+
+                Range3D bounds{Vector3{Constants::inf()}, Vector3{-Constants::inf()}};
+                for(const Vector2 ndc: {ndcMin, Vector2{ndcMax.x(), ndcMin.y()}, Vector2{ndcMin.x(), ndcMax.y()}, ndcMax}) {
+                    const Vector3 point = projectionInverted.transformPoint({ndc, -1.0f});
+                    for(const Float depth: depths) {
+                        const Vector3 scaled = point*(depth/-point.z());
+                        bounds = Math::join(bounds, Range3D{scaled, scaled});
+                    }
+                }
+
+                _clusterBounds[(z*size.y() + y)*size.x() + x] = bounds;
+            }
+        }
+    }
+
+    /* Cluster data is the grid header followed by offset + count pairs, all
+       zero initially */
+    _clusterData = Containers::Array<char>{ValueInit, sizeof(PhongLightClusterGridUniform) + size.product()*sizeof(Vector2ui)};
+    *reinterpret_cast<PhongLightClusterGridUniform*>(_clusterData.data()) = _grid;
+    arrayAppend(_lightIndices, 0u);
+}
+
+LightClusterGrid::LightClusterGrid(LightClusterGrid&&) noexcept = default;
+
+LightClusterGrid::~LightClusterGrid() = default;
+
+LightClusterGrid& LightClusterGrid::operator=(LightClusterGrid&&) noexcept = default;
+
+Containers::ArrayView<const Vector2ui> LightClusterGrid::clusters() const {
+    return Containers::arrayCast<const Vector2ui>(_clusterData.exceptPrefix(sizeof(PhongLightClusterGridUniform)));
+}
+
+void LightClusterGrid::assign(const Containers::StridedArrayView1D<const Vector4>& positions, const Containers::StridedArrayView1D<const Float>& ranges) {
+    CORRADE_ASSERT(positions.size() == ranges.size(),
+        "Shaders::LightClusterGrid::assign(): expected position and range views to have the same size, got" << positions.size() << "and" << ranges.size(), );
+
+    const Vector3ui size = _grid.size;
+
+    /* Gather (cluster, light) pairs first */
+    arrayClear(_scratch);
+    for(UnsignedInt i = 0; i != positions.size(); ++i) {
+        const Vector4& position = positions[i];
+        const Float range = ranges[i];
+
+        /* Directional lights and lights with infinite range affect
+           everything */
+        if(position.w() == 0.0f || range == Constants::inf()) {
+            for(UnsignedInt cluster = 0; cluster != _clusterBounds.size(); ++cluster)
+                arrayAppend(_scratch, InPlaceInit, cluster, i);
+            continue;
+        }
+
+        const Vector3 center = position.xyz();
+        const Float depth = -center.z();
+
+        /* Skip lights that are entirely in front of the near plane or behind
+           the far plane */
+        if(depth + range < _near || depth - range > _far) continue;
+
+        /* Depth slice range */
+        const UnsignedInt zMin = depth - range <= _near ? 0 :
+            UnsignedInt(Math::clamp(Math::log(depth - range)*_grid.depthScale - _grid.depthBias, 0.0f, Float(size.z() - 1)));
+        const UnsignedInt zMax = depth + range >= _far ? size.z() - 1 :
+            UnsignedInt(Math::clamp(Math::log(depth + range)*_grid.depthScale - _grid.depthBias, 0.0f, Float(size.z() - 1)));
+
+        /* Screen-space tile range. If the light bounding box is entirely in
+           front of the near plane, project its corners, otherwise it could
+           cover anything. */
+        Vector2ui xyMin{0};
+        Vector2ui xyMax = size.xy() - Vector2ui{1};
+        if(depth - range > _near) {
+            Range2D ndc{Vector2{Constants::inf()}, Vector2{-Constants::inf()}};
+            for(UnsignedInt corner = 0; corner != 8; ++corner) {
+                const Vector3 point = center + Vector3{
+                    corner & 1 ? range : -range,
+                    corner & 2 ? range : -range,
+                    corner & 4 ? range : -range};
+                const Vector2 projected = _projection.transformPoint(point).xy();
+                ndc = Math::join(ndc, Range2D{projected, projected});
+            }
+
+            /* Entirely outside of the viewport */
+            if(ndc.min().x() > 1.0f || ndc.min().y() > 1.0f ||
+               ndc.max().x() < -1.0f || ndc.max().y() < -1.0f) continue;
+
+            const Vector2 sizeXY{size.xy()};
+            xyMin = Vector2ui{Math::clamp((ndc.min() + Vector2{1.0f})*0.5f*sizeXY, Vector2{0.0f}, sizeXY - Vector2{1.0f})};
+            xyMax = Vector2ui{Math::clamp((ndc.max() + Vector2{1.0f})*0.5f*sizeXY, Vector2{0.0f}, sizeXY - Vector2{1.0f})};
+        }
+
+        /* Test the sphere against bounds of each candidate cluster */
+        const Float rangeSquared = range*range;
+        for(UnsignedInt z = zMin; z <= zMax; ++z) {
+            for(UnsignedInt y = xyMin.y(); y <= xyMax.y(); ++y) {
+                for(UnsignedInt x = xyMin.x(); x <= xyMax.x(); ++x) {
+                    const UnsignedInt cluster = (z*size.y() + y)*size.x() + x;
+                    const Range3D& bounds = _clusterBounds[cluster];
+                    const Vector3 closest = Math::clamp(center, bounds.min(), bounds.max());
+                    if((closest - center).dot() <= rangeSquared)
+                        arrayAppend(_scratch, InPlaceInit, cluster, i);
+                }
+            }
+        }
+    }
+
+    /* Count lights in each cluster and convert the counts to offsets */
+    Containers::ArrayView<Vector2ui> clusters = Containers::arrayCast<Vector2ui>(_clusterData.exceptPrefix(sizeof(PhongLightClusterGridUniform)));
+    for(Vector2ui& cluster: clusters) cluster = {};
+    for(const Vector2ui& pair: _scratch) ++clusters[pair.x()].y();
+    UnsignedInt offset = 0;
+    for(Vector2ui& cluster: clusters) {
+        cluster.x() = offset;
+        offset += cluster.y();
+        cluster.y() = 0;
+    }
+
+    /* Fill the indices, reusing the count as a cursor. As the pairs are
+       ordered by light, indices in each cluster end up sorted. Binding an
+       empty buffer isn't allowed, so there's always at least one item. */
+    arrayResize(_lightIndices, NoInit, Math::max(offset, 1u));
+    _lightIndices[0] = 0;
+    for(const Vector2ui& pair: _scratch) {
+        Vector2ui& cluster = clusters[pair.x()];
+        _lightIndices[cluster.x() + cluster.y()++] = pair.y();
+    }
+}
+
+void LightClusterGrid::assign(const Containers::ArrayView<const PhongLightUniform> lights) {
+    const Containers::StridedArrayView1D<const PhongLightUniform> lightsStrided = lights;
+    assign(lightsStrided.slice(&PhongLightUniform::position),
+           lightsStrided.slice(&PhongLightUniform::range));
+}
+
+}}
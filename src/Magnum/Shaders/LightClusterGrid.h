@@ -0,0 +1,191 @@
+#ifndef Magnum_Shaders_LightClusterGrid_h
+#define Magnum_Shaders_LightClusterGrid_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::LightClusterGrid
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Shaders/Phong.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Light cluster grid for clustered forward shading
+@m_since_latest
+
+Subdivides a perspective view frustum into a grid of clusters --- screen-space
+tiles in the X and Y direction and logarithmically distributed slices in
+depth --- and assigns lights to clusters they affect. The result is meant to
+be uploaded to buffers bound with @ref PhongGL::bindLightClusterBuffer() and
+@ref PhongGL::bindLightClusterIndexBuffer() for use with
+@ref PhongGL::Flag::ClusteredLights. See
+@ref Shaders-PhongGL-clustered-lights for a usage example.
+
+Each light is tested only against clusters in its depth slice range and in
+the screen-space rectangle covered by its bounding box, and then against the
+camera-space bounding box of each such cluster. The assignment is thus
+conservative, a cluster may list a light that doesn't actually affect any of
+its pixels, but never the other way around. Directional lights and lights
+with infinite range are assigned to all clusters.
+
+The calculation happens on the CPU and doesn't need any GPU API.
+*/
+class MAGNUM_SHADERS_EXPORT LightClusterGrid {
+    public:
+        /**
+         * @brief Constructor
+         * @param size          Cluster count in the X, Y and depth direction
+         * @param viewportSize  Viewport size in pixels
+         * @param projection    Perspective projection matrix
+         *
+         * Expects that all @p size components are non-zero, that
+         * @p viewportSize is non-zero and that @p projection is a perspective
+         * projection with a finite far plane, such as one created with
+         * @ref Matrix4::perspectiveProjection(). Cluster bounds are
+         * calculated upfront, the grid has to be recreated when the
+         * projection or viewport size changes.
+         */
+        explicit LightClusterGrid(const Vector3ui& size, const Vector2i& viewportSize, const Matrix4& projection);
+
+        /** @brief Copying is not allowed */
+        LightClusterGrid(const LightClusterGrid&) = delete;
+
+        /** @brief Move constructor */
+        LightClusterGrid(LightClusterGrid&&) noexcept;
+
+        ~LightClusterGrid();
+
+        /** @brief Copying is not allowed */
+        LightClusterGrid& operator=(const LightClusterGrid&) = delete;
+
+        /** @brief Move assignment */
+        LightClusterGrid& operator=(LightClusterGrid&&) noexcept;
+
+        /** @brief Cluster count in the X, Y and depth direction */
+        Vector3ui size() const { return _grid.size; }
+
+        /** @brief Total cluster count */
+        std::size_t clusterCount() const { return _clusterBounds.size(); }
+
+        /** @brief Viewport size */
+        Vector2i viewportSize() const { return _viewportSize; }
+
+        /** @brief Near plane distance extracted from the projection */
+        Float near() const { return _near; }
+
+        /** @brief Far plane distance extracted from the projection */
+        Float far() const { return _far; }
+
+        /**
+         * @brief Grid parameters
+         *
+         * Same as the header of @ref clusterData().
+         */
+        const PhongLightClusterGridUniform& gridUniform() const { return _grid; }
+
+        /**
+         * @brief Camera-space bounds of all clusters
+         *
+         * Ordered with X changing the fastest and depth the slowest, with
+         * the first cluster being in the bottom left corner at the near
+         * plane.
+         */
+        Containers::ArrayView<const Range3D> clusterBounds() const { return _clusterBounds; }
+
+        /**
+         * @brief Assign lights to clusters
+         * @param positions     Camera-space light positions
+         * @param ranges        Light ranges
+         *
+         * Expects that both views have the same size. The positions and ranges
+         * have the same meaning as @ref PhongLightUniform::position and
+         * @ref PhongLightUniform::range, light indices stored in
+         * @ref lightIndices() are indices into these views. Memory allocated
+         * by the previous call is reused.
+         */
+        void assign(const Containers::StridedArrayView1D<const Vector4>& positions, const Containers::StridedArrayView1D<const Float>& ranges);
+
+        /**
+         * @brief Assign lights to clusters
+         *
+         * Equivalent to calling @ref assign(const Containers::StridedArrayView1D<const Vector4>&, const Containers::StridedArrayView1D<const Float>&)
+         * with @ref PhongLightUniform::position and
+         * @ref PhongLightUniform::range fields of @p lights.
+         */
+        void assign(Containers::ArrayView<const PhongLightUniform> lights);
+
+        /**
+         * @brief Light offset and count for each cluster
+         *
+         * The first component is an offset into @ref lightIndices(), the
+         * second a count of lights affecting the cluster. Ordered the same
+         * as @ref clusterBounds(), all counts are zero until @ref assign() is
+         * called.
+         */
+        Containers::ArrayView<const Vector2ui> clusters() const;
+
+        /**
+         * @brief Data for the light cluster buffer
+         *
+         * Contains @ref gridUniform() followed by @ref clusters(), suitable
+         * for uploading to a buffer bound with
+         * @ref PhongGL::bindLightClusterBuffer().
+         */
+        Containers::ArrayView<const char> clusterData() const { return _clusterData; }
+
+        /**
+         * @brief Light indices
+         *
+         * Indices of lights passed to @ref assign(), referenced by
+         * @ref clusters(). Suitable for uploading to a buffer bound with
+         * @ref PhongGL::bindLightClusterIndexBuffer(). Always contains at
+         * least one item, as binding an empty buffer isn't allowed.
+         */
+        Containers::ArrayView<const UnsignedInt> lightIndices() const { return _lightIndices; }
+
+    private:
+        Vector2i _viewportSize;
+        Float _near, _far;
+        Matrix4 _projection;
+        PhongLightClusterGridUniform _grid;
+        Containers::Array<Range3D> _clusterBounds;
+        Containers::Array<char> _clusterData;
+        Containers::Array<UnsignedInt> _lightIndices;
+        Containers::Array<Vector2ui> _scratch;
+};
+
+}}
+
+#endif
@@ -196,8 +196,16 @@ layout(std140
 };
 #endif
 
+#ifdef VERTEX_PULLING
+#ifdef EXPLICIT_BINDING
+layout(binding = 8)
+#endif
+uniform highp samplerBuffer vertexPullingPositions;
+#endif
+
 /* Inputs */
 
+#ifndef VERTEX_PULLING
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = POSITION_ATTRIBUTE_LOCATION)
 #endif
@@ -232,14 +240,18 @@ in highp vec3 nextPosition;
 #error
 #endif
 
+#endif
+
 /* Point annotation, matching the LineVertexAnnotation enum bits */
 #define ANNOTATION_UP_MASK 1u
 #define ANNOTATION_JOIN_MASK 2u
 #define ANNOTATION_BEGIN_MASK 4u
+#ifndef VERTEX_PULLING
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = LINE_ANNOTATION_ATTRIBUTE_LOCATION)
 #endif
 in lowp uint annotation;
+#endif
 
 #ifdef VERTEX_COLOR
 #ifdef EXPLICIT_ATTRIB_LOCATION
@@ -297,6 +309,20 @@ vec2 perpendicular(vec2 a) {
     return vec2(-a.y, a.x);
 }
 
+#ifdef VERTEX_PULLING
+#ifdef TWO_DIMENSIONS
+highp vec2 fetchPoint(highp int id) {
+    return texelFetch(vertexPullingPositions, id).xy;
+}
+#elif defined(THREE_DIMENSIONS)
+highp vec3 fetchPoint(highp int id) {
+    return texelFetch(vertexPullingPositions, id).xyz;
+}
+#else
+#error
+#endif
+#endif
+
 void main() {
     #ifdef UNIFORM_BUFFERS
     #ifdef MULTI_DRAW
@@ -330,6 +356,49 @@ void main() {
     highp const float miterLimit = materials[materialId].material_miterLimit;
     #endif
 
+    #ifdef VERTEX_PULLING
+    /* Each segment of the line strip is made of twelve vertices. First six
+       form the segment quad from corners 2 0 1 and 1 3 2, with the same corner
+       numbering as in the diagram below, corners 0 and 1 coming from point A
+       and 2 and 3 from point B. The other six fill the join with the next
+       segment with corners 2 3 4 and 4 3 5, where 4 and 5 are corners 0 and 1
+       of the next segment. This is the same triangulation as done by
+       MeshTools::compileLines(). The first point has a cap on the A side and
+       the last on the B side, all other points are joins. */
+    highp const int pointCount = textureSize(vertexPullingPositions);
+    highp const int segmentId = gl_VertexID/12;
+    const int corners[12] = int[12](2, 0, 1, 1, 3, 2, 2, 3, 4, 4, 3, 5);
+    mediump int corner = corners[gl_VertexID - segmentId*12];
+    highp int quadSegmentId = segmentId;
+    if(corner >= 4) {
+        /* The last segment has no join, collapse the triangles to a single
+           point */
+        if(segmentId + 2 >= pointCount) {
+            corner = 2;
+        } else {
+            corner -= 4;
+            ++quadSegmentId;
+        }
+    }
+    const bool begin = corner < 2;
+    highp const int pointId = begin ? quadSegmentId : quadSegmentId + 1;
+    lowp const uint annotation =
+        (corner == 0 || corner == 2 ? ANNOTATION_UP_MASK : 0u)|
+        (begin ? ANNOTATION_BEGIN_MASK : 0u)|
+        (pointId > 0 && pointId + 1 < pointCount ? ANNOTATION_JOIN_MASK : 0u);
+
+    #ifdef TWO_DIMENSIONS
+    highp const vec2
+    #elif defined(THREE_DIMENSIONS)
+    highp const vec3
+    #else
+    #error
+    #endif
+        position = fetchPoint(pointId),
+        previousPosition = fetchPoint(max(pointId - 1, 0)),
+        nextPosition = fetchPoint(min(pointId + 1, pointCount - 1));
+    #endif
+
     #ifdef TWO_DIMENSIONS
     highp const vec2 transformedPosition = (transformationProjectionMatrix*
         #ifdef INSTANCED_TRANSFORMATION
@@ -42,6 +42,10 @@
 #include "Magnum/Shaders/Line.h"
 #include "Magnum/Shaders/Implementation/lineMiterLimit.h"
 
+#ifndef MAGNUM_TARGET_WEBGL
+#include "Magnum/GL/BufferTexture.h"
+#endif
+
 #ifdef MAGNUM_BUILD_STATIC
 static void importShaderResources() {
     CORRADE_RESOURCE_INITIALIZE(MagnumShaders_RESOURCES_GL)
@@ -57,7 +61,10 @@ namespace {
     enum: Int {
         /* 0/1/2/3 taken by Phong (A/D/S/N), 4 by MeshVisualizer colormap, 5 by
            object ID textures, 6 by Vector */
-        TextureUnit = 7
+        TextureUnit = 7,
+        #ifndef MAGNUM_TARGET_WEBGL
+        VertexPullingTextureUnit = 8
+        #endif
     };
 
     enum: Int {
@@ -82,6 +89,10 @@ template<UnsignedInt dimensions> typename LineGL<dimensions>::CompileState LineG
             "Shaders::LineGL: draw count can't be zero", CompileState{NoCreate});
     }
     #endif
+    #ifndef MAGNUM_TARGET_WEBGL
+    CORRADE_ASSERT(!(configuration.flags() & Flag::VertexPulling) || !(configuration.flags() & Flag::VertexColor),
+        "Shaders::LineGL: vertex pulling can't be combined with vertex colors", CompileState{NoCreate});
+    #endif
 
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::EXT::gpu_shader4);
@@ -106,6 +117,17 @@ template<UnsignedInt dimensions> typename LineGL<dimensions>::CompileState LineG
         MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::WEBGL::multi_draw);
         #endif
     }
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(configuration.flags() & Flag::VertexPulling) {
+        /* Not checking just for ARB_texture_buffer_object as texelFetch() on
+           buffer samplers is only in GLSL 1.40 */
+        #ifndef MAGNUM_TARGET_GLES
+        MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL310);
+        #else
+        MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GLES320);
+        #endif
+    }
+    #endif
 
     #ifdef MAGNUM_BUILD_STATIC
     /* Import resources on static build, if not already */
@@ -118,7 +140,10 @@ template<UnsignedInt dimensions> typename LineGL<dimensions>::CompileState LineG
     const GL::Context& context = GL::Context::current();
     const GL::Version version = context.supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300, GL::Version::GL210});
     #elif !defined(MAGNUM_TARGET_WEBGL)
-    const GL::Version version = GL::Context::current().supportedVersion({GL::Version::GLES310, GL::Version::GLES300});
+    /* Buffer textures need GLSL ES 3.20, otherwise stay on the lowest
+       version that supports everything else */
+    const GL::Version version = configuration.flags() & Flag::VertexPulling ? GL::Version::GLES320 :
+        GL::Context::current().supportedVersion({GL::Version::GLES310, GL::Version::GLES300});
     #else
     constexpr GL::Version version = GL::Version::GLES300;
     #endif
@@ -158,7 +183,11 @@ template<UnsignedInt dimensions> typename LineGL<dimensions>::CompileState LineG
         .addSource(configuration.flags() & Flag::VertexColor ? "#define VERTEX_COLOR\n"_s : ""_s)
         .addSource(dimensions == 2 ? "#define TWO_DIMENSIONS\n"_s : "#define THREE_DIMENSIONS\n"_s)
         .addSource(configuration.flags() >= Flag::InstancedObjectId ? "#define INSTANCED_OBJECT_ID\n"_s : ""_s)
-        .addSource(configuration.flags() & Flag::InstancedTransformation ? "#define INSTANCED_TRANSFORMATION\n"_s : ""_s);
+        .addSource(configuration.flags() & Flag::InstancedTransformation ? "#define INSTANCED_TRANSFORMATION\n"_s : ""_s)
+        #ifndef MAGNUM_TARGET_WEBGL
+        .addSource(configuration.flags() & Flag::VertexPulling ? "#define VERTEX_PULLING\n"_s : ""_s)
+        #endif
+        ;
     if(configuration.flags() >= Flag::UniformBuffers) {
         #ifndef MAGNUM_TARGET_WEBGL
         /* SSBOs have unbounded per-draw arrays so just a plain string can be
@@ -227,10 +256,12 @@ template<UnsignedInt dimensions> typename LineGL<dimensions>::CompileState LineG
        bindFragmentDataLocation() */
     #ifndef MAGNUM_TARGET_GLES
     if(!context.isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version)) {
-        out.bindAttributeLocation(Position::Location, "position"_s);
-        out.bindAttributeLocation(PreviousPosition::Location, "previousPosition"_s);
-        out.bindAttributeLocation(NextPosition::Location, "nextPosition"_s);
-        out.bindAttributeLocation(Annotation::Location, "annotation"_s);
+        if(!(configuration.flags() & Flag::VertexPulling)) {
+            out.bindAttributeLocation(Position::Location, "position"_s);
+            out.bindAttributeLocation(PreviousPosition::Location, "previousPosition"_s);
+            out.bindAttributeLocation(NextPosition::Location, "nextPosition"_s);
+            out.bindAttributeLocation(Annotation::Location, "annotation"_s);
+        }
         if(configuration.flags() & Flag::VertexColor)
             out.bindAttributeLocation(Color3::Location, "vertexColor"_s); /* Color4 is the same */
         if(configuration.flags() & Flag::ObjectId) {
@@ -295,6 +326,10 @@ template<UnsignedInt dimensions> LineGL<dimensions>::LineGL(CompileState&& state
     if(state._version < GL::Version::GLES310)
     #endif
     {
+        #ifndef MAGNUM_TARGET_WEBGL
+        if(_flags & Flag::VertexPulling)
+            setUniform(uniformLocation("vertexPullingPositions"_s), VertexPullingTextureUnit);
+        #endif
         /* SSBOs have bindings defined in the source always */
         if(_flags >= Flag::UniformBuffers
             #ifndef MAGNUM_TARGET_WEBGL
@@ -478,6 +513,15 @@ template<UnsignedInt dimensions> LineGL<dimensions>& LineGL<dimensions>::bindMat
     return *this;
 }
 
+#ifndef MAGNUM_TARGET_WEBGL
+template<UnsignedInt dimensions> LineGL<dimensions>& LineGL<dimensions>::bindVertexPullingPositionTexture(GL::BufferTexture& texture) {
+    CORRADE_ASSERT(_flags & Flag::VertexPulling,
+        "Shaders::LineGL::bindVertexPullingPositionTexture(): the shader was not created with vertex pulling enabled", *this);
+    texture.bind(VertexPullingTextureUnit);
+    return *this;
+}
+#endif
+
 template<UnsignedInt dimensions> LineGL<dimensions>::Configuration::Configuration(): _capStyle{LineCapStyle::Square}, _joinStyle{LineJoinStyle::Miter} {}
 
 template class MAGNUM_SHADERS_EXPORT LineGL<2>;
@@ -508,6 +552,9 @@ Debug& operator<<(Debug& debug, const LineGLFlag value) {
         _c(ShaderStorageBuffers)
         #endif
         _c(MultiDraw)
+        #ifndef MAGNUM_TARGET_WEBGL
+        _c(VertexPulling)
+        #endif
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -531,7 +578,10 @@ Debug& operator<<(Debug& debug, const LineGLFlags value) {
         #ifndef MAGNUM_TARGET_WEBGL
         LineGLFlag::ShaderStorageBuffers, /* Superset of UniformBuffers */
         #endif
-        LineGLFlag::UniformBuffers
+        LineGLFlag::UniformBuffers,
+        #ifndef MAGNUM_TARGET_WEBGL
+        LineGLFlag::VertexPulling
+        #endif
     });
 }
 
@@ -54,7 +54,10 @@ namespace Implementation {
         #ifndef MAGNUM_TARGET_WEBGL
         ShaderStorageBuffers = UniformBuffers|(1 << 6),
         #endif
-        MultiDraw = UniformBuffers|(1 << 5)
+        MultiDraw = UniformBuffers|(1 << 5),
+        #ifndef MAGNUM_TARGET_WEBGL
+        VertexPulling = 1 << 7
+        #endif
     };
     typedef Containers::EnumSet<LineGLFlag> LineGLFlags;
     CORRADE_ENUMSET_OPERATORS(LineGLFlags)
@@ -239,6 +242,40 @@ material references. Besides that, the usage is similar for all shaders, see
 @requires_webgl_extension Extension @webgl_extension{ANGLE,multi_draw} for
     multidraw.
 
+@section Shaders-LineGL-vertex-pulling GPU-side line strip expansion
+
+With the mesh representation described below, each point of a line strip is
+present four times in the vertex data, together with its neighbors. If the
+line data change often, such as with a live-updated chart, the CPU-side
+expansion with @ref MeshTools::generateLines() and the subsequent upload can
+become a bottleneck. Enabling @ref Flag::VertexPulling makes the shader fetch
+the line strip points directly from a buffer texture bound with
+@ref bindVertexPullingPositionTexture() instead, with the mesh having no
+attributes at all. Updating the line then only means updating the point
+buffer:
+
+@snippet Shaders-gl.cpp LineGL-vertex-pulling
+
+The texture is expected to contain the points of a single line strip, with
+@ref GL::BufferTextureFormat::RG32F used in 2D and
+@ref GL::BufferTextureFormat::RGBA32F or
+@relativeref{GL::BufferTextureFormat,RGB32F} in 3D. Caps are placed at the
+first and last point, all other points are joins. Each segment is drawn as two
+triangles for the segment itself and two triangles filling the join with the
+next segment, thus the count passed to @ref GL::Mesh::setCount() is
+@cpp 12*(pointCount - 1) @ce, with the join triangles of the last segment
+being degenerate. Drawing fewer segments than the texture contains is
+possible, but the last drawn point then won't get a cap.
+@ref Flag::VertexColor isn't supported in this mode as it relies on a
+per-vertex attribute.
+
+@requires_gl31 Vertex pulling needs buffer texture support in GLSL 1.40,
+    which is not available in OpenGL 3.0.
+@requires_gles32 Buffer textures, and thus vertex pulling, are not available
+    in OpenGL ES 3.1 and older.
+@requires_gles Buffer textures, and thus vertex pulling, are not available in
+    WebGL.
+
 @section Shaders-LineGL-mesh-representation Line mesh representation
 
 In order to avoid performing expensive CPU-side expansion of the quads every
@@ -618,7 +655,27 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT LineGL: public GL::
              *      alone needs only WebGL 1.0, the shader implementation
              *      relies on uniform buffers, which require WebGL 2.0.
              */
-            MultiDraw = UniformBuffers|(1 << 5)
+            MultiDraw = UniformBuffers|(1 << 5),
+
+            #ifndef MAGNUM_TARGET_WEBGL
+            /**
+             * Expand line strips on the GPU. Instead of taking the
+             * @ref Position, @ref PreviousPosition, @ref NextPosition and
+             * @ref Annotation attributes, points of a line strip are fetched
+             * from a buffer texture bound with
+             * @ref bindVertexPullingPositionTexture() and the quads are
+             * formed directly in the vertex shader. Mutually exclusive with
+             * @ref Flag::VertexColor. See @ref Shaders-LineGL-vertex-pulling
+             * for more information.
+             * @requires_gl31 Buffer texture support in GLSL 1.40, not
+             *      available in OpenGL 3.0.
+             * @requires_gles32 Buffer textures are not available in OpenGL ES
+             *      3.1 and older.
+             * @requires_gles Buffer textures are not available in WebGL.
+             * @m_since_latest
+             */
+            VertexPulling = 1 << 7
+            #endif
         };
 
         /**
@@ -970,6 +1027,36 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT LineGL: public GL::
          * @}
          */
 
+        #ifndef MAGNUM_TARGET_WEBGL
+        /** @{
+         * @name Texture binding
+         */
+
+        /**
+         * @brief Bind a vertex pulling position texture
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that the shader was created with @ref Flag::VertexPulling
+         * enabled. The texture is expected to contain points of a line strip
+         * in a @ref GL::BufferTextureFormat::RG32F format in 2D and either
+         * @relativeref{GL::BufferTextureFormat,RGB32F} or
+         * @relativeref{GL::BufferTextureFormat,RGBA32F} in 3D, with the
+         * fourth component ignored in the latter case. See
+         * @ref Shaders-LineGL-vertex-pulling for more information.
+         * @requires_gl31 Buffer texture support in GLSL 1.40, not available
+         *      in OpenGL 3.0.
+         * @requires_gles32 Buffer textures are not available in OpenGL ES
+         *      3.1 and older.
+         * @requires_gles Buffer textures are not available in WebGL.
+         */
+        LineGL<dimensions>& bindVertexPullingPositionTexture(GL::BufferTexture& texture);
+
+        /**
+         * @}
+         */
+        #endif
+
         MAGNUM_GL_ABSTRACTSHADERPROGRAM_SUBCLASS_DRAW_IMPLEMENTATION(LineGL<dimensions>)
 
     private:
@@ -327,8 +327,21 @@ layout(std140
 #endif
 #endif
 
+#ifdef VERTEX_PULLING
+#ifdef EXPLICIT_BINDING
+layout(binding = 6)
+#endif
+uniform highp usamplerBuffer vertexPullingIndices;
+
+#ifdef EXPLICIT_BINDING
+layout(binding = 7)
+#endif
+uniform highp samplerBuffer vertexPullingPositions;
+#endif
+
 /* Inputs */
 
+#ifndef VERTEX_PULLING
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = POSITION_ATTRIBUTE_LOCATION)
 #endif
@@ -339,6 +352,7 @@ in highp vec4 position;
 #else
 #error
 #endif
+#endif
 
 #if defined(TANGENT_DIRECTION) || defined(BITANGENT_FROM_TANGENT_DIRECTION)
 #ifdef EXPLICIT_ATTRIB_LOCATION
@@ -602,6 +616,15 @@ void main() {
     #endif
     #endif
 
+    #ifdef VERTEX_PULLING
+    /* Each vertex of a non-indexed draw fetches its index and then the
+       position it refers to. The barycentric coordinates and primitive ID
+       below are still calculated from gl_VertexID, while the vertex ID
+       visualization shows the original, pulled index. */
+    highp const int pulledVertexId = int(texelFetch(vertexPullingIndices, gl_VertexID).r);
+    highp const vec4 position = vec4(texelFetch(vertexPullingPositions, pulledVertexId).xyz, 1.0);
+    #endif
+
     #ifdef TWO_DIMENSIONS
     gl_Position.xywz = vec4(transformationProjectionMatrix*
         #ifdef INSTANCED_TRANSFORMATION
@@ -711,7 +734,13 @@ void main() {
     #else
     interpolatedVsMappedVertexId
     #endif
-        = colorMapOffset + float(gl_VertexID)*colorMapScale;
+        = colorMapOffset + float(
+            #ifdef VERTEX_PULLING
+            pulledVertexId
+            #else
+            gl_VertexID
+            #endif
+        )*colorMapScale;
     #endif
     #ifdef PRIMITIVE_ID_FROM_VERTEX_ID
     #ifdef NO_GEOMETRY_SHADER
@@ -48,6 +48,10 @@
 #include "Magnum/GL/TextureArray.h"
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/GL/BufferTexture.h"
+#endif
+
 #ifdef MAGNUM_BUILD_STATIC
 static void importShaderResources() {
     CORRADE_RESOURCE_INITIALIZE(MagnumShaders_RESOURCES_GL)
@@ -62,7 +66,11 @@ namespace {
     enum: Int {
         /* First four taken by Phong (A/D/S/N) */
         ColorMapTextureUnit = 4,
-        ObjectIdTextureUnit = 5 /* shared with Flat and Phong */
+        ObjectIdTextureUnit = 5, /* shared with Flat and Phong */
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        VertexPullingIndexTextureUnit = 6,
+        VertexPullingPositionTextureUnit = 7
+        #endif
     };
 
     #ifndef MAGNUM_TARGET_GLES2
@@ -1092,6 +1100,17 @@ MeshVisualizerGL3D::CompileState MeshVisualizerGL3D::compile(const Configuration
     #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
     CORRADE_ASSERT(!(configuration.flags() >= Flag::InstancedObjectId) || !(configuration.flags() & Flag::BitangentDirection),
         "Shaders::MeshVisualizerGL3D: Bitangent attribute binding conflicts with the ObjectId attribute, use a Tangent4 attribute with instanced object ID rendering instead", CompileState{NoCreate});
+    CORRADE_ASSERT(!(configuration.flags() >= Flag::VertexPulling) || (!(configuration.flags() >= Flag::ObjectIdTexture) && !configuration.jointCount()),
+        "Shaders::MeshVisualizerGL3D: vertex pulling can't be combined with object ID textures or skinning", CompileState{NoCreate});
+    if(configuration.flags() >= Flag::VertexPulling) {
+        #ifndef MAGNUM_TARGET_GLES
+        /* Not checking just for ARB_texture_buffer_object as texelFetch() on
+           buffer samplers is only in GLSL 1.40 */
+        MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GL310);
+        #else
+        MAGNUM_ASSERT_GL_VERSION_SUPPORTED(GL::Version::GLES320);
+        #endif
+    }
     #endif
 
     /* Has to be here and not in the base class in order to have it exit the
@@ -1171,6 +1190,7 @@ MeshVisualizerGL3D::CompileState MeshVisualizerGL3D::compile(const Configuration
         .addSource(configuration.flags() & Flag::BitangentFromTangentDirection ? "#define BITANGENT_FROM_TANGENT_DIRECTION\n"_s : ""_s)
         .addSource(configuration.flags() & Flag::BitangentDirection ? "#define BITANGENT_DIRECTION\n"_s : ""_s)
         .addSource(configuration.flags() & Flag::NormalDirection ? "#define NORMAL_DIRECTION\n"_s : ""_s)
+        .addSource(configuration.flags() >= Flag::VertexPulling ? "#define VERTEX_PULLING\n"_s : ""_s)
         #endif
         ;
     vert.addSource(rs.getString("generic.glsl"_s))
@@ -1459,6 +1479,12 @@ MeshVisualizerGL3D::MeshVisualizerGL3D(CompileState&& state): MeshVisualizerGL3D
         #ifndef MAGNUM_TARGET_GLES2
         if(flags() >= Flag::ObjectIdTexture)
             setUniform(uniformLocation("objectIdTextureData"_s), ObjectIdTextureUnit);
+        #ifndef MAGNUM_TARGET_WEBGL
+        if(flags() >= Flag::VertexPulling) {
+            setUniform(uniformLocation("vertexPullingIndices"_s), VertexPullingIndexTextureUnit);
+            setUniform(uniformLocation("vertexPullingPositions"_s), VertexPullingPositionTextureUnit);
+        }
+        #endif
         /* SSBOs have bindings defined in the source always */
         if(flags() >= Flag::UniformBuffers
             #ifndef MAGNUM_TARGET_WEBGL
@@ -1729,6 +1755,22 @@ MeshVisualizerGL3D& MeshVisualizerGL3D::bindDrawBuffer(GL::Buffer& buffer, const
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+MeshVisualizerGL3D& MeshVisualizerGL3D::bindVertexPullingIndexTexture(GL::BufferTexture& texture) {
+    CORRADE_ASSERT(flags() >= Flag::VertexPulling,
+        "Shaders::MeshVisualizerGL3D::bindVertexPullingIndexTexture(): the shader was not created with vertex pulling enabled", *this);
+    texture.bind(VertexPullingIndexTextureUnit);
+    return *this;
+}
+
+MeshVisualizerGL3D& MeshVisualizerGL3D::bindVertexPullingPositionTexture(GL::BufferTexture& texture) {
+    CORRADE_ASSERT(flags() >= Flag::VertexPulling,
+        "Shaders::MeshVisualizerGL3D::bindVertexPullingPositionTexture(): the shader was not created with vertex pulling enabled", *this);
+    texture.bind(VertexPullingPositionTextureUnit);
+    return *this;
+}
+#endif
+
 #ifndef MAGNUM_TARGET_GLES2
 MeshVisualizerGL3D::Configuration& MeshVisualizerGL3D::Configuration::setJointCount(UnsignedInt count, UnsignedInt perVertexCount, UnsignedInt secondaryPerVertexCount) {
     CORRADE_ASSERT(perVertexCount <= 4,
@@ -1847,6 +1889,9 @@ Debug& operator<<(Debug& debug, const MeshVisualizerGL3D::Flag value) {
         _c(TextureArrays)
         _c(DynamicPerVertexJointCount)
         #endif
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        _c(VertexPulling)
+        #endif
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -1899,6 +1944,9 @@ Debug& operator<<(Debug& debug, const MeshVisualizerGL2D::Flags value) {
 Debug& operator<<(Debug& debug, const MeshVisualizerGL3D::Flags value) {
     return Containers::enumSetDebugOutput(debug, value, "Shaders::MeshVisualizerGL3D::Flags{}", {
         MeshVisualizerGL3D::Flag::Wireframe,
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        MeshVisualizerGL3D::Flag::VertexPulling, /* Superset of NoGeometryShader */
+        #endif
         /* Wireframe contains this on ES2 and WebGL 1 so it's not reported
            there */
         MeshVisualizerGL3D::Flag::NoGeometryShader,
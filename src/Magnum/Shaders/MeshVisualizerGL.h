@@ -1482,6 +1482,25 @@ addition to the above*:
 
 Rendering setup the same as above.
 
+@subsection Shaders-MeshVisualizerGL3D-wireframe-vertex-pulling Wireframe visualization of indexed meshes with vertex pulling
+
+With @ref Flag::VertexPulling, the index and position data are read from
+buffer textures and the mesh is drawn without any attributes as a non-indexed
+mesh with the count equal to the index count. That avoids both the geometry
+shader and making the mesh non-indexed with @ref MeshTools::duplicate(), as
+the barycentric coordinates are calculated from @glsl gl_VertexID @ce. Only
+32-bit indices are supported, the index and position buffers can be the same
+as used for regular rendering of the mesh:
+
+@snippet Shaders-gl.cpp MeshVisualizerGL3D-usage-vertex-pulling
+
+@requires_gl31 Vertex pulling needs buffer texture support in GLSL 1.40,
+    which is not available in OpenGL 3.0.
+@requires_gles32 Buffer textures, and thus vertex pulling, are not available
+    in OpenGL ES 3.1 and older.
+@requires_gles Buffer textures, and thus vertex pulling, are not available in
+    WebGL.
+
 @section Shaders-MeshVisualizerGL3D-tbn Tangent space visualization
 
 On platforms with geometry shaders (desktop GL, OpenGL ES 3.2), the shader is
@@ -2299,6 +2318,32 @@ class MAGNUM_SHADERS_EXPORT MeshVisualizerGL3D: public Implementation::MeshVisua
              * @m_since_latest
              */
             DynamicPerVertexJointCount = 1 << 18,
+
+            #ifndef MAGNUM_TARGET_WEBGL
+            /**
+             * Fetch vertex positions from buffer textures instead of vertex
+             * attributes. Implies @ref Flag::NoGeometryShader. The mesh is
+             * drawn as non-indexed with the count equal to the index count,
+             * and each vertex fetches its index from a texture bound with
+             * @ref bindVertexPullingIndexTexture() and then the position
+             * from a texture bound with
+             * @ref bindVertexPullingPositionTexture(). Compared to
+             * @ref Flag::NoGeometryShader alone this doesn't need the mesh to
+             * be made non-indexed with @ref MeshTools::duplicate(). See
+             * @ref Shaders-MeshVisualizerGL3D-wireframe-vertex-pulling for
+             * more information.
+             *
+             * Mutually exclusive with @ref Flag::ObjectIdTexture and
+             * skinning, as those need other per-vertex attributes.
+             * @requires_gl31 Buffer texture support in GLSL 1.40, not
+             *      available in OpenGL 3.0.
+             * @requires_gles32 Buffer textures are not available in OpenGL ES
+             *      3.1 and older.
+             * @requires_gles Buffer textures are not available in WebGL.
+             * @m_since_latest
+             */
+            VertexPulling = NoGeometryShader|(1 << 20),
+            #endif
             #endif
         };
 
@@ -3169,6 +3214,47 @@ class MAGNUM_SHADERS_EXPORT MeshVisualizerGL3D: public Implementation::MeshVisua
         }
         #endif
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Bind a vertex pulling index texture
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that the shader was created with @ref Flag::VertexPulling
+         * enabled. The texture is expected to have a
+         * @ref GL::BufferTextureFormat::R32UI format and contain a
+         * triangle index list.
+         * @see @ref bindVertexPullingPositionTexture()
+         * @requires_gl31 Buffer texture support in GLSL 1.40, not
+         *      available in OpenGL 3.0.
+         * @requires_gles32 Buffer textures are not available in OpenGL ES
+         *      3.1 and older.
+         * @requires_gles Buffer textures are not available in WebGL.
+         */
+        MeshVisualizerGL3D& bindVertexPullingIndexTexture(GL::BufferTexture& texture);
+
+        /**
+         * @brief Bind a vertex pulling position texture
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that the shader was created with @ref Flag::VertexPulling
+         * enabled. The texture is expected to have either a
+         * @ref GL::BufferTextureFormat::RGB32F or
+         * @relativeref{GL::BufferTextureFormat,RGBA32F} format, with the
+         * fourth component ignored in the latter case.
+         * @see @ref bindVertexPullingIndexTexture()
+         * @requires_gl40 Extension @gl_extension{ARB,texture_buffer_object_rgb32}
+         *      for @ref GL::BufferTextureFormat::RGB32F, otherwise
+         *      @gl_extension{ARB,texture_buffer_object} for
+         *      @relativeref{GL::BufferTextureFormat,RGBA32F}
+         * @requires_gles32 Buffer textures are not available in OpenGL ES
+         *      3.1 and older.
+         * @requires_gles Buffer textures are not available in WebGL.
+         */
+        MeshVisualizerGL3D& bindVertexPullingPositionTexture(GL::BufferTexture& texture);
+        #endif
+
         /**
          * @}
          */
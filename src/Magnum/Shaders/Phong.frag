@@ -24,6 +24,12 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+/* The depth-only variant has no inputs and no outputs, depth gets written
+   implicitly */
+#ifdef DEPTH_ONLY
+void main() {}
+#else
+
 #if defined(OBJECT_ID) && !defined(GL_ES) && !defined(NEW_GLSL)
 #extension GL_EXT_gpu_shader4: require
 #endif
@@ -32,6 +38,10 @@
 #extension GL_ARB_shader_storage_buffer_object: require
 #endif
 
+#ifdef BINDLESS_TEXTURES
+#extension GL_ARB_bindless_texture: require
+#endif
+
 #ifndef NEW_GLSL
 #define in varying
 #define fragmentColor gl_FragColor
@@ -256,10 +266,54 @@ layout(std140
     BUFFER_READONLY LightUniform lights[LIGHT_COUNT];
 };
 #endif
+
+#ifdef CLUSTERED_LIGHTS
+/* Unlike the rest these are only ever SSBOs, so they can use the tighter
+   std430 packing */
+layout(std430, binding = 8) buffer LightCluster {
+    readonly highp uvec4 lightClusterSizeReserved;
+    #define lightCluster_size lightClusterSizeReserved.xyz
+    readonly highp vec4 lightClusterTileSizeDepthScaleBias;
+    #define lightCluster_tileSize lightClusterTileSizeDepthScaleBias.xy
+    #define lightCluster_depthScale lightClusterTileSizeDepthScaleBias.z
+    #define lightCluster_depthBias lightClusterTileSizeDepthScaleBias.w
+    /* Offset into lightClusterIndices and light count for each cluster */
+    readonly highp uvec2 lightClusters[];
+};
+
+layout(std430, binding = 9) buffer LightClusterIndex {
+    readonly highp uint lightClusterIndices[];
+};
+#endif
+
+#ifdef BINDLESS_TEXTURES
+/* Each handle is a 64-bit value, split into two 32-bit halves */
+struct TextureHandleUniform {
+    highp uvec4 ambientTextureDiffuseTexture;
+    #define textureHandle_ambientTexture ambientTextureDiffuseTexture.xy
+    #define textureHandle_diffuseTexture ambientTextureDiffuseTexture.zw
+    highp uvec4 specularTextureNormalTexture;
+    #define textureHandle_specularTexture specularTextureNormalTexture.xy
+    #define textureHandle_normalTexture specularTextureNormalTexture.zw
+    highp uvec4 objectIdTextureReserved;
+    #define textureHandle_objectIdTexture objectIdTextureReserved.xy
+};
+
+layout(std140
+    #if defined(EXPLICIT_BINDING) || defined(SHADER_STORAGE_BUFFERS)
+    , binding = 7
+    #endif
+) BUFFER_OR_UNIFORM TextureHandle {
+    BUFFER_READONLY TextureHandleUniform textureHandles[MATERIAL_COUNT];
+};
+#endif
 #endif
 
 /* Textures */
 
+/* With bindless textures the samplers are created from handles in main() */
+#ifndef BINDLESS_TEXTURES
+
 #ifdef AMBIENT_TEXTURE
 #ifdef EXPLICIT_BINDING
 layout(binding = 0)
@@ -326,6 +380,7 @@ uniform lowp
     #endif
     objectIdTextureData;
 #endif
+#endif
 
 /* Inputs */
 
@@ -409,6 +464,43 @@ void main() {
     #ifdef LIGHT_CULLING
     mediump const uint lightCount = draws[drawId].draw_lightOffsetLightCount >> 16 & 0xffffu;
     #endif
+    #ifdef CLUSTERED_LIGHTS
+    /* Pick the cluster based on the window-space position and a logarithmic
+       depth slice. The max() avoids a NaN for fragments at or behind the
+       camera, which then end up in the first slice. */
+    highp const uvec3 clusterSize = lightCluster_size;
+    highp const uvec3 clusterId = uvec3(
+        min(uvec2(gl_FragCoord.xy/lightCluster_tileSize), clusterSize.xy - uvec2(1u)),
+        uint(clamp(log(max(-transformedPosition.z, 1.0e-6))*lightCluster_depthScale - lightCluster_depthBias, 0.0, float(clusterSize.z - 1u))));
+    highp const uvec2 cluster = lightClusters[(clusterId.z*clusterSize.y + clusterId.y)*clusterSize.x + clusterId.x];
+    #endif
+    #endif
+    #endif
+
+    #ifdef BINDLESS_TEXTURES
+    #ifndef TEXTURE_ARRAYS
+    #define SAMPLER sampler2D
+    #define USAMPLER usampler2D
+    #else
+    #define SAMPLER sampler2DArray
+    #define USAMPLER usampler2DArray
+    #endif
+    #ifdef AMBIENT_TEXTURE
+    SAMPLER ambientTexture = SAMPLER(textureHandles[materialId].textureHandle_ambientTexture);
+    #endif
+    #if PER_DRAW_LIGHT_COUNT
+    #ifdef DIFFUSE_TEXTURE
+    SAMPLER diffuseTexture = SAMPLER(textureHandles[materialId].textureHandle_diffuseTexture);
+    #endif
+    #ifdef SPECULAR_TEXTURE
+    SAMPLER specularTexture = SAMPLER(textureHandles[materialId].textureHandle_specularTexture);
+    #endif
+    #ifdef NORMAL_TEXTURE
+    SAMPLER normalTexture = SAMPLER(textureHandles[materialId].textureHandle_normalTexture);
+    #endif
+    #endif
+    #ifdef OBJECT_ID_TEXTURE
+    USAMPLER objectIdTextureData = USAMPLER(textureHandles[materialId].textureHandle_objectIdTexture);
     #endif
     #endif
 
@@ -471,12 +563,17 @@ void main() {
     highp const vec3 cameraDirection = normalize(-transformedPosition);
 
     /* Add diffuse color for each light */
-    #ifndef LIGHT_CULLING
+    #ifdef CLUSTERED_LIGHTS
+    for(uint clusterLight = 0u; clusterLight < cluster.y; ++clusterLight)
+    #elif !defined(LIGHT_CULLING)
     for(int i = 0; i < PER_DRAW_LIGHT_COUNT; ++i)
     #else
     for(uint i = 0u, actualLightCount = min(uint(PER_DRAW_LIGHT_COUNT), lightCount); i < actualLightCount; ++i)
     #endif
     {
+        #ifdef CLUSTERED_LIGHTS
+        highp const uint i = lightClusterIndices[cluster.x + clusterLight];
+        #endif
         lowp const vec3 lightColor =
             #ifndef UNIFORM_BUFFERS
             lightColors[i]
@@ -573,3 +670,5 @@ void main() {
         objectId;
     #endif
 }
+
+#endif
@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Struct @ref Magnum::Shaders::PhongDrawUniform, @ref Magnum::Shaders::PhongMaterialUniform, @ref Magnum::Shaders::PhongLightUniform
+ * @brief Struct @ref Magnum::Shaders::PhongDrawUniform, @ref Magnum::Shaders::PhongMaterialUniform, @ref Magnum::Shaders::PhongTextureHandleUniform, @ref Magnum::Shaders::PhongLightUniform, @ref Magnum::Shaders::PhongLightClusterGridUniform
  */
 
 #include "Magnum/Magnum.h"
@@ -424,6 +424,139 @@ struct PhongMaterialUniform {
     #endif
 };
 
+/**
+@brief Texture handle uniform for Phong shaders
+@m_since_latest
+
+Describes bindless texture handles used by a material, indexed by the same
+@ref PhongDrawUniform::materialId as @ref PhongMaterialUniform. Used only if
+@ref PhongGL::Flag::BindlessTextures is enabled.
+@see @ref PhongGL::bindTextureHandleBuffer(),
+    @ref GL::AbstractTexture::handle()
+*/
+struct PhongTextureHandleUniform {
+    /** @brief Construct with default parameters */
+    constexpr explicit PhongTextureHandleUniform(DefaultInitT = DefaultInit) noexcept: ambientTexture{0}, diffuseTexture{0}, specularTexture{0}, normalTexture{0}, objectIdTexture{0} {}
+
+    /** @brief Construct without initializing the contents */
+    explicit PhongTextureHandleUniform(NoInitT) noexcept {}
+
+    /** @{
+     * @name Convenience setters
+     *
+     * Provided to allow the use of method chaining for populating a structure
+     * in a single expression, otherwise equivalent to accessing the fields
+     * directly. Also guaranteed to provide backwards compatibility when
+     * packing of the actual fields changes.
+     */
+
+    /**
+     * @brief Set the @ref ambientTexture field
+     * @return Reference to self (for method chaining)
+     */
+    PhongTextureHandleUniform& setAmbientTexture(UnsignedLong handle) {
+        ambientTexture = handle;
+        return *this;
+    }
+
+    /**
+     * @brief Set the @ref diffuseTexture field
+     * @return Reference to self (for method chaining)
+     */
+    PhongTextureHandleUniform& setDiffuseTexture(UnsignedLong handle) {
+        diffuseTexture = handle;
+        return *this;
+    }
+
+    /**
+     * @brief Set the @ref specularTexture field
+     * @return Reference to self (for method chaining)
+     */
+    PhongTextureHandleUniform& setSpecularTexture(UnsignedLong handle) {
+        specularTexture = handle;
+        return *this;
+    }
+
+    /**
+     * @brief Set the @ref normalTexture field
+     * @return Reference to self (for method chaining)
+     */
+    PhongTextureHandleUniform& setNormalTexture(UnsignedLong handle) {
+        normalTexture = handle;
+        return *this;
+    }
+
+    /**
+     * @brief Set the @ref objectIdTexture field
+     * @return Reference to self (for method chaining)
+     */
+    PhongTextureHandleUniform& setObjectIdTexture(UnsignedLong handle) {
+        objectIdTexture = handle;
+        return *this;
+    }
+
+    /**
+     * @}
+     */
+
+    /**
+     * @brief Ambient texture handle
+     *
+     * Default value is @cpp 0 @ce. Used only if
+     * @ref PhongGL::Flag::AmbientTexture is enabled, ignored otherwise. The
+     * handle is expected to be resident.
+     * @see @ref GL::AbstractTexture::makeHandleResident()
+     */
+    UnsignedLong ambientTexture;
+
+    /**
+     * @brief Diffuse texture handle
+     *
+     * Default value is @cpp 0 @ce. Used only if
+     * @ref PhongGL::Flag::DiffuseTexture is enabled, ignored otherwise. The
+     * handle is expected to be resident.
+     * @see @ref GL::AbstractTexture::makeHandleResident()
+     */
+    UnsignedLong diffuseTexture;
+
+    /**
+     * @brief Specular texture handle
+     *
+     * Default value is @cpp 0 @ce. Used only if
+     * @ref PhongGL::Flag::SpecularTexture is enabled, ignored otherwise. The
+     * handle is expected to be resident.
+     * @see @ref GL::AbstractTexture::makeHandleResident()
+     */
+    UnsignedLong specularTexture;
+
+    /**
+     * @brief Normal texture handle
+     *
+     * Default value is @cpp 0 @ce. Used only if
+     * @ref PhongGL::Flag::NormalTexture is enabled, ignored otherwise. The
+     * handle is expected to be resident.
+     * @see @ref GL::AbstractTexture::makeHandleResident()
+     */
+    UnsignedLong normalTexture;
+
+    /**
+     * @brief Object ID texture handle
+     *
+     * Default value is @cpp 0 @ce. Used only if
+     * @ref PhongGL::Flag::ObjectIdTexture is enabled, ignored otherwise. The
+     * handle is expected to be resident.
+     * @see @ref GL::AbstractTexture::makeHandleResident()
+     */
+    UnsignedLong objectIdTexture;
+
+    /* warning: Member __pad0__ is not documented. FFS DOXYGEN WHY DO YOU THINK
+       I MADE THOSE UNNAMED, YOU DUMB FOOL */
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    Int:32;
+    Int:32;
+    #endif
+};
+
 /**
 @brief Light parameters for Phong shaders
 @m_since_latest
@@ -549,6 +682,62 @@ struct PhongLightUniform {
     #endif
 };
 
+/**
+@brief Light cluster grid parameters for Phong shaders
+@m_since_latest
+
+Header of the buffer bound with @ref PhongGL::bindLightClusterBuffer(),
+followed by a @relativeref{Magnum,Vector2ui} offset and count pair for each
+cluster. Used only if @ref PhongGL::Flag::ClusteredLights is enabled. Usually
+you don't fill this structure directly but let @ref LightClusterGrid
+calculate it.
+*/
+struct PhongLightClusterGridUniform {
+    /** @brief Construct with default parameters */
+    constexpr explicit PhongLightClusterGridUniform(DefaultInitT = DefaultInit) noexcept: size{1, 1, 1}, tileSize{Constants::inf()}, depthScale{0.0f}, depthBias{0.0f} {}
+
+    /** @brief Construct without initializing the contents */
+    explicit PhongLightClusterGridUniform(NoInitT) noexcept: size{NoInit}, tileSize{NoInit} {}
+
+    /**
+     * @brief Grid size
+     *
+     * Count of clusters in the X, Y and depth direction. Default value is
+     * @cpp {1, 1, 1} @ce, i.e. a single cluster.
+     */
+    Vector3ui size;
+
+    /* warning: Member __pad0__ is not documented. FFS DOXYGEN WHY DO YOU THINK
+       I MADE THOSE UNNAMED, YOU DUMB FOOL */
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    Int:32;
+    #endif
+
+    /**
+     * @brief Cluster size in pixels
+     *
+     * Default value is @ref Constants::inf(), i.e. a single cluster covering
+     * the whole viewport.
+     */
+    Vector2 tileSize;
+
+    /**
+     * @brief Depth slice scale
+     *
+     * A fragment at camera-space depth @f$ d @f$ belongs to the depth slice
+     * @f$ \lfloor \log(d) s - b \rfloor @f$, where @f$ s @f$ is this value
+     * and @f$ b @f$ is @ref depthBias. Default value is @cpp 0.0f @ce.
+     */
+    Float depthScale;
+
+    /**
+     * @brief Depth slice bias
+     *
+     * See @ref depthScale for details. Default value is @cpp 0.0f @ce.
+     */
+    Float depthBias;
+};
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /** @brief @copybrief PhongGL
  * @m_deprecated_since_latest Use @ref PhongGL instead.
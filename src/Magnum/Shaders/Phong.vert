@@ -244,6 +244,7 @@ layout(std140
 
 /* Inputs */
 
+#ifndef VERTEX_PULLING
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = POSITION_ATTRIBUTE_LOCATION)
 #endif
@@ -290,6 +291,18 @@ layout(location = COLOR_ATTRIBUTE_LOCATION)
 in lowp vec4 vertexColor;
 #endif
 
+#else
+/* Per-vertex attributes fetched from a buffer based on the vertex ID, in a
+   layout matching MeshTools::vertexPullingData(). The header contains offsets
+   of the attribute arrays, with 0xffffffffu for attributes that aren't
+   present, and the total vertex count. */
+layout(std430, binding = 10) readonly buffer Vertices {
+    highp uvec4 vertexOffsetsPositionNormalTangentBitangent;
+    highp uvec4 vertexOffsetsTextureCoordinatesColorCountReserved;
+    highp float vertexData[];
+};
+#endif
+
 #ifdef JOINT_COUNT
 #if PER_VERTEX_JOINT_COUNT
 #ifdef EXPLICIT_ATTRIB_LOCATION
@@ -383,13 +396,56 @@ out mediump vec3 transformedBitangent;
 out highp vec3 transformedPosition;
 #endif
 
-#ifdef MULTI_DRAW
+/* Guarantees the depth-only variant produces the exact same depth as the
+   color variant, as both share the same position calculation */
+invariant gl_Position;
+
+/* The depth-only variant has no fragment inputs, the draw ID is only local */
+#if defined(MULTI_DRAW) && !defined(DEPTH_ONLY)
 flat out highp uint drawId;
 #endif
 
 void main() {
+    #ifdef VERTEX_PULLING
+    /* With indexed draws the vertex ID includes the base vertex already */
+    highp const uint vertexId = uint(gl_VertexID);
+    highp const uint positionOffset = vertexOffsetsPositionNormalTangentBitangent.x + vertexId*3u;
+    highp const vec4 position = vec4(vertexData[positionOffset], vertexData[positionOffset + 1u], vertexData[positionOffset + 2u], 1.0);
+    #ifdef HAS_LIGHTS
+    highp const uint normalOffset = vertexOffsetsPositionNormalTangentBitangent.y + vertexId*3u;
+    mediump const vec3 normal = vertexOffsetsPositionNormalTangentBitangent.y == 0xffffffffu ? vec3(0.0) :
+        vec3(vertexData[normalOffset], vertexData[normalOffset + 1u], vertexData[normalOffset + 2u]);
+    #ifdef NORMAL_TEXTURE
+    highp const uint tangentOffset = vertexOffsetsPositionNormalTangentBitangent.z + vertexId*4u;
+    #ifndef BITANGENT
+    mediump const vec4 tangent = vertexOffsetsPositionNormalTangentBitangent.z == 0xffffffffu ? vec4(0.0, 0.0, 0.0, 1.0) :
+        vec4(vertexData[tangentOffset], vertexData[tangentOffset + 1u], vertexData[tangentOffset + 2u], vertexData[tangentOffset + 3u]);
+    #else
+    mediump const vec3 tangent = vertexOffsetsPositionNormalTangentBitangent.z == 0xffffffffu ? vec3(0.0) :
+        vec3(vertexData[tangentOffset], vertexData[tangentOffset + 1u], vertexData[tangentOffset + 2u]);
+    highp const uint bitangentOffset = vertexOffsetsPositionNormalTangentBitangent.w + vertexId*3u;
+    mediump const vec3 bitangent = vertexOffsetsPositionNormalTangentBitangent.w == 0xffffffffu ? vec3(0.0) :
+        vec3(vertexData[bitangentOffset], vertexData[bitangentOffset + 1u], vertexData[bitangentOffset + 2u]);
+    #endif
+    #endif
+    #endif
+    #ifdef TEXTURED
+    highp const uint textureCoordinatesOffset = vertexOffsetsTextureCoordinatesColorCountReserved.x + vertexId*2u;
+    mediump const vec2 textureCoordinates = vertexOffsetsTextureCoordinatesColorCountReserved.x == 0xffffffffu ? vec2(0.0) :
+        vec2(vertexData[textureCoordinatesOffset], vertexData[textureCoordinatesOffset + 1u]);
+    #endif
+    #ifdef VERTEX_COLOR
+    highp const uint colorOffset = vertexOffsetsTextureCoordinatesColorCountReserved.y + vertexId*4u;
+    lowp const vec4 vertexColor = vertexOffsetsTextureCoordinatesColorCountReserved.y == 0xffffffffu ? vec4(0.0, 0.0, 0.0, 1.0) :
+        vec4(vertexData[colorOffset], vertexData[colorOffset + 1u], vertexData[colorOffset + 2u], vertexData[colorOffset + 3u]);
+    #endif
+    #endif
+
     #ifdef UNIFORM_BUFFERS
     #ifdef MULTI_DRAW
+    #ifdef DEPTH_ONLY
+    highp uint
+    #endif
     drawId = drawOffset + uint(
         #ifndef GL_ES
         gl_DrawIDARB /* Using GL_ARB_shader_draw_parameters, not GLSL 4.6 */
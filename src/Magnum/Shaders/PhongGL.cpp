@@ -82,11 +82,38 @@ namespace {
         MaterialBufferBinding = 4,
         LightBufferBinding = 5,
         JointBufferBinding = 6,
+        #ifndef MAGNUM_TARGET_GLES
+        TextureHandleBufferBinding = 7, /* shared with Flat */
+        #endif
+        #ifndef MAGNUM_TARGET_WEBGL
+        LightClusterBufferBinding = 8,
+        LightClusterIndexBufferBinding = 9,
+        VertexBufferBinding = 10 /* shared with Flat */
+        #endif
     };
     #endif
+
+    /* Flags affecting the vertex position, which are the only ones allowed
+       together with Flag::DepthOnly */
+    constexpr PhongGL::Flags DepthOnlyFlags = PhongGL::Flag::DepthOnly|PhongGL::Flag::InstancedTransformation
+        #ifndef MAGNUM_TARGET_GLES2
+        |PhongGL::Flag::DynamicPerVertexJointCount|PhongGL::Flag::MultiDraw
+        #ifndef MAGNUM_TARGET_WEBGL
+        |PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::VertexPulling
+        #endif
+        #endif
+        ;
 }
 
 PhongGL::CompileState PhongGL::compile(const Configuration& configuration) {
+    CORRADE_ASSERT(!(configuration.flags() & Flag::DepthOnly) || !(configuration.flags() & ~DepthOnlyFlags),
+        "Shaders::PhongGL: depth-only variant can't be combined with" << (configuration.flags() & ~DepthOnlyFlags), CompileState{NoCreate});
+
+    /* Lights don't affect the depth-only variant in any way, compile it as if
+       there were none to not have any light-related inputs or uniforms */
+    if((configuration.flags() & Flag::DepthOnly) && configuration.lightCount())
+        return compile(Configuration{configuration}.setLightCount(0));
+
     #ifndef CORRADE_NO_ASSERT
     {
         const bool textureTransformationNotEnabledOrTextured = !(configuration.flags() & Flag::TextureTransformation) || (configuration.flags() & (Flag::AmbientTexture|Flag::DiffuseTexture|Flag::SpecularTexture|Flag::NormalTexture))
@@ -129,6 +156,25 @@ PhongGL::CompileState PhongGL::compile(const Configuration& configuration) {
         "Shaders::PhongGL: texture arrays require texture transformation enabled as well if uniform buffers are used", CompileState{NoCreate});
     CORRADE_ASSERT(!(configuration.flags() & Flag::LightCulling) || (configuration.flags() & Flag::UniformBuffers),
         "Shaders::PhongGL: light culling requires uniform buffers to be enabled", CompileState{NoCreate});
+    #ifndef MAGNUM_TARGET_WEBGL
+    CORRADE_ASSERT(!(configuration.flags() & Flag::ClusteredLights) || configuration.flags() >= Flag::ShaderStorageBuffers,
+        "Shaders::PhongGL: clustered lights require shader storage buffers to be enabled", CompileState{NoCreate});
+    CORRADE_ASSERT(!(configuration.flags() & Flag::ClusteredLights) || !(configuration.flags() & Flag::LightCulling),
+        "Shaders::PhongGL: clustered lights and light culling are mutually exclusive", CompileState{NoCreate});
+    CORRADE_ASSERT(!(configuration.flags() & Flag::ClusteredLights) || configuration.perDrawLightCount(),
+        "Shaders::PhongGL: clustered lights require a non-zero per-draw light count", CompileState{NoCreate});
+    CORRADE_ASSERT(!(configuration.flags() & Flag::VertexPulling) || configuration.flags() >= Flag::ShaderStorageBuffers,
+        "Shaders::PhongGL: vertex pulling requires shader storage buffers to be enabled", CompileState{NoCreate});
+    CORRADE_ASSERT(!(configuration.flags() & Flag::VertexPulling) || (!configuration.perVertexJointCount() && !configuration.secondaryPerVertexJointCount()),
+        "Shaders::PhongGL: vertex pulling can't be used together with skinning", CompileState{NoCreate});
+    #endif
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(configuration.flags() & Flag::BindlessTextures) || configuration.flags() >= Flag::UniformBuffers,
+        "Shaders::PhongGL: bindless textures require uniform buffers to be enabled", CompileState{NoCreate});
+    CORRADE_ASSERT(!(configuration.flags() & Flag::BindlessTextures) || (configuration.flags() & (Flag::AmbientTexture|Flag::DiffuseTexture|Flag::SpecularTexture|Flag::NormalTexture)) || configuration.flags() >= Flag::ObjectIdTexture,
+        "Shaders::PhongGL: bindless textures enabled but the shader is not textured", CompileState{NoCreate});
     #endif
 
     CORRADE_ASSERT(!(configuration.flags() & Flag::SpecularTexture) || !(configuration.flags() & (Flag::NoSpecular)),
@@ -170,6 +216,8 @@ PhongGL::CompileState PhongGL::compile(const Configuration& configuration) {
     #ifndef MAGNUM_TARGET_GLES
     if(configuration.flags() >= Flag::TextureArrays)
         MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::EXT::texture_array);
+    if(configuration.flags() >= Flag::BindlessTextures)
+        MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::bindless_texture);
     #endif
 
     #ifdef MAGNUM_BUILD_STATIC
@@ -182,7 +230,10 @@ PhongGL::CompileState PhongGL::compile(const Configuration& configuration) {
     const GL::Context& context = GL::Context::current();
 
     #ifndef MAGNUM_TARGET_GLES
-    const GL::Version version = context.supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300, GL::Version::GL210});
+    /* The bindless texture GLSL extension is written against GLSL 4.00, and
+       the extension requires GL 4.0 anyway */
+    const GL::Version version = configuration.flags() >= Flag::BindlessTextures ? GL::Version::GL400 :
+        context.supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300, GL::Version::GL210});
     #else
     const GL::Version version = context.supportedVersion({
         #ifndef MAGNUM_TARGET_WEBGL
@@ -251,7 +302,8 @@ PhongGL::CompileState PhongGL::compile(const Configuration& configuration) {
         .addSource(configuration.flags() >= Flag::InstancedObjectId ? "#define INSTANCED_OBJECT_ID\n"_s : ""_s)
         #endif
         .addSource(configuration.flags() & Flag::InstancedTransformation ? "#define INSTANCED_TRANSFORMATION\n"_s : ""_s)
-        .addSource(configuration.flags() >= Flag::InstancedTextureOffset ? "#define INSTANCED_TEXTURE_OFFSET\n"_s : ""_s);
+        .addSource(configuration.flags() >= Flag::InstancedTextureOffset ? "#define INSTANCED_TEXTURE_OFFSET\n"_s : ""_s)
+        .addSource(configuration.flags() & Flag::DepthOnly ? "#define DEPTH_ONLY\n"_s : ""_s);
     #ifndef MAGNUM_TARGET_GLES2
     if(configuration.perVertexJointCount() || configuration.secondaryPerVertexJointCount()) {
         #ifndef MAGNUM_TARGET_WEBGL
@@ -327,7 +379,8 @@ PhongGL::CompileState PhongGL::compile(const Configuration& configuration) {
         if(configuration.flags() >= Flag::ShaderStorageBuffers) {
             vert.addSource(
                 "#define UNIFORM_BUFFERS\n"
-                "#define SHADER_STORAGE_BUFFERS\n"_s);
+                "#define SHADER_STORAGE_BUFFERS\n"_s)
+                .addSource(configuration.flags() & Flag::VertexPulling ? "#define VERTEX_PULLING\n"_s : ""_s);
         } else
         #endif
         {
@@ -362,6 +415,10 @@ PhongGL::CompileState PhongGL::compile(const Configuration& configuration) {
         .addSource(configuration.flags() >= Flag::ObjectIdTexture ? "#define OBJECT_ID_TEXTURE\n"_s : ""_s)
         #endif
         .addSource(configuration.flags() & Flag::NoSpecular ? "#define NO_SPECULAR\n"_s : ""_s)
+        .addSource(configuration.flags() & Flag::DepthOnly ? "#define DEPTH_ONLY\n"_s : ""_s)
+        #ifndef MAGNUM_TARGET_GLES
+        .addSource(configuration.flags() >= Flag::BindlessTextures ? "#define BINDLESS_TEXTURES\n"_s : ""_s)
+        #endif
         ;
     #ifndef MAGNUM_TARGET_GLES2
     if(configuration.flags() >= Flag::UniformBuffers) {
@@ -384,6 +441,9 @@ PhongGL::CompileState PhongGL::compile(const Configuration& configuration) {
                 configuration.perDrawLightCount()));
         frag.addSource(configuration.flags() >= Flag::MultiDraw ? "#define MULTI_DRAW\n"_s : ""_s)
             .addSource(configuration.flags() >= Flag::LightCulling ? "#define LIGHT_CULLING\n"_s : ""_s);
+        #ifndef MAGNUM_TARGET_WEBGL
+        frag.addSource(configuration.flags() >= Flag::ClusteredLights ? "#define CLUSTERED_LIGHTS\n"_s : ""_s);
+        #endif
     } else
     #endif
     {
@@ -577,14 +637,22 @@ PhongGL::PhongGL(CompileState&& state): PhongGL{static_cast<PhongGL&&>(Utility::
     if(state._version < GL::Version::GLES310)
     #endif
     {
-        if(_flags & Flag::AmbientTexture) setUniform(uniformLocation("ambientTexture"_s), AmbientTextureUnit);
-        if(_perDrawLightCount) {
-            if(_flags & Flag::DiffuseTexture) setUniform(uniformLocation("diffuseTexture"_s), DiffuseTextureUnit);
-            if(_flags & Flag::SpecularTexture) setUniform(uniformLocation("specularTexture"_s), SpecularTextureUnit);
-            if(_flags & Flag::NormalTexture) setUniform(uniformLocation("normalTexture"_s), NormalTextureUnit);
+        #ifndef MAGNUM_TARGET_GLES
+        /* With bindless textures there are no sampler uniforms */
+        if(!(_flags >= Flag::BindlessTextures))
+        #endif
+        {
+            if(_flags & Flag::AmbientTexture) setUniform(uniformLocation("ambientTexture"_s), AmbientTextureUnit);
+            if(_perDrawLightCount) {
+                if(_flags & Flag::DiffuseTexture) setUniform(uniformLocation("diffuseTexture"_s), DiffuseTextureUnit);
+                if(_flags & Flag::SpecularTexture) setUniform(uniformLocation("specularTexture"_s), SpecularTextureUnit);
+                if(_flags & Flag::NormalTexture) setUniform(uniformLocation("normalTexture"_s), NormalTextureUnit);
+            }
+            #ifndef MAGNUM_TARGET_GLES2
+            if(_flags >= Flag::ObjectIdTexture) setUniform(uniformLocation("objectIdTextureData"_s), ObjectIdTextureUnit);
+            #endif
         }
         #ifndef MAGNUM_TARGET_GLES2
-        if(_flags >= Flag::ObjectIdTexture) setUniform(uniformLocation("objectIdTextureData"_s), ObjectIdTextureUnit);
         /* SSBOs have bindings defined in the source always */
         if(_flags >= Flag::UniformBuffers
             #ifndef MAGNUM_TARGET_WEBGL
@@ -593,14 +661,22 @@ PhongGL::PhongGL(CompileState&& state): PhongGL{static_cast<PhongGL&&>(Utility::
         ) {
             setUniformBlockBinding(uniformBlockIndex("Projection"_s), ProjectionBufferBinding);
             setUniformBlockBinding(uniformBlockIndex("Transformation"_s), TransformationBufferBinding);
-            setUniformBlockBinding(uniformBlockIndex("Draw"_s), DrawBufferBinding);
-            setUniformBlockBinding(uniformBlockIndex("Material"_s), MaterialBufferBinding);
+            /* The depth-only variant uses the draw buffer only for the joint
+               offset and has no material buffer */
+            if(!(_flags & Flag::DepthOnly) || _jointCount)
+                setUniformBlockBinding(uniformBlockIndex("Draw"_s), DrawBufferBinding);
+            if(!(_flags & Flag::DepthOnly))
+                setUniformBlockBinding(uniformBlockIndex("Material"_s), MaterialBufferBinding);
             if(_flags & Flag::TextureTransformation)
                 setUniformBlockBinding(uniformBlockIndex("TextureTransformation"_s), TextureTransformationBufferBinding);
             if(_lightCount)
                 setUniformBlockBinding(uniformBlockIndex("Light"_s), LightBufferBinding);
             if(_jointCount)
                 setUniformBlockBinding(uniformBlockIndex("Joint"_s), JointBufferBinding);
+            #ifndef MAGNUM_TARGET_GLES
+            if(_flags >= Flag::BindlessTextures)
+                setUniformBlockBinding(uniformBlockIndex("TextureHandle"_s), TextureHandleBufferBinding);
+            #endif
         }
         #endif
     }
@@ -617,8 +693,10 @@ PhongGL::PhongGL(CompileState&& state): PhongGL{static_cast<PhongGL&&>(Utility::
     } else
     #endif
     {
-        /* Default to fully opaque white so we can see the textures */
-        if(_flags & Flag::AmbientTexture) setAmbientColor(Magnum::Color4{1.0f});
+        /* Default to fully opaque white so we can see the textures. The
+           depth-only variant has no ambient color uniform. */
+        if(_flags & Flag::DepthOnly) {}
+        else if(_flags & Flag::AmbientTexture) setAmbientColor(Magnum::Color4{1.0f});
         else setAmbientColor(Magnum::Color4{0.0f});
         setTransformationMatrix(Matrix4{Math::IdentityInit});
         setProjectionMatrix(Matrix4{Math::IdentityInit});
@@ -690,7 +768,7 @@ PhongGL& PhongGL::setAmbientColor(const Magnum::Color4& color) {
     CORRADE_ASSERT(!(_flags >= Flag::UniformBuffers),
         "Shaders::PhongGL::setAmbientColor(): the shader was created with uniform buffers enabled", *this);
     #endif
-    setUniform(_ambientColorUniform, color);
+    if(!(_flags & Flag::DepthOnly)) setUniform(_ambientColorUniform, color);
     return *this;
 }
 
@@ -1157,6 +1235,50 @@ PhongGL& PhongGL::bindLightBuffer(GL::Buffer& buffer, const GLintptr offset, con
     return *this;
 }
 
+#ifndef MAGNUM_TARGET_WEBGL
+PhongGL& PhongGL::bindLightClusterBuffer(GL::Buffer& buffer) {
+    CORRADE_ASSERT(_flags >= Flag::ClusteredLights,
+        "Shaders::PhongGL::bindLightClusterBuffer(): the shader was not created with clustered lights enabled", *this);
+    buffer.bind(GL::Buffer::Target::ShaderStorage, LightClusterBufferBinding);
+    return *this;
+}
+
+PhongGL& PhongGL::bindLightClusterBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    CORRADE_ASSERT(_flags >= Flag::ClusteredLights,
+        "Shaders::PhongGL::bindLightClusterBuffer(): the shader was not created with clustered lights enabled", *this);
+    buffer.bind(GL::Buffer::Target::ShaderStorage, LightClusterBufferBinding, offset, size);
+    return *this;
+}
+
+PhongGL& PhongGL::bindLightClusterIndexBuffer(GL::Buffer& buffer) {
+    CORRADE_ASSERT(_flags >= Flag::ClusteredLights,
+        "Shaders::PhongGL::bindLightClusterIndexBuffer(): the shader was not created with clustered lights enabled", *this);
+    buffer.bind(GL::Buffer::Target::ShaderStorage, LightClusterIndexBufferBinding);
+    return *this;
+}
+
+PhongGL& PhongGL::bindLightClusterIndexBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    CORRADE_ASSERT(_flags >= Flag::ClusteredLights,
+        "Shaders::PhongGL::bindLightClusterIndexBuffer(): the shader was not created with clustered lights enabled", *this);
+    buffer.bind(GL::Buffer::Target::ShaderStorage, LightClusterIndexBufferBinding, offset, size);
+    return *this;
+}
+
+PhongGL& PhongGL::bindVertexBuffer(GL::Buffer& buffer) {
+    CORRADE_ASSERT(_flags & Flag::VertexPulling,
+        "Shaders::PhongGL::bindVertexBuffer(): the shader was not created with vertex pulling enabled", *this);
+    buffer.bind(GL::Buffer::Target::ShaderStorage, VertexBufferBinding);
+    return *this;
+}
+
+PhongGL& PhongGL::bindVertexBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    CORRADE_ASSERT(_flags & Flag::VertexPulling,
+        "Shaders::PhongGL::bindVertexBuffer(): the shader was not created with vertex pulling enabled", *this);
+    buffer.bind(GL::Buffer::Target::ShaderStorage, VertexBufferBinding, offset, size);
+    return *this;
+}
+#endif
+
 PhongGL& PhongGL::bindJointBuffer(GL::Buffer& buffer) {
     CORRADE_ASSERT(_flags >= Flag::UniformBuffers,
         "Shaders::PhongGL::bindJointBuffer(): the shader was not created with uniform buffers enabled", *this);
@@ -1180,9 +1302,29 @@ PhongGL& PhongGL::bindJointBuffer(GL::Buffer& buffer, const GLintptr offset, con
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+PhongGL& PhongGL::bindTextureHandleBuffer(GL::Buffer& buffer) {
+    CORRADE_ASSERT(_flags >= Flag::BindlessTextures,
+        "Shaders::PhongGL::bindTextureHandleBuffer(): the shader was not created with bindless textures enabled", *this);
+    buffer.bind(_flags >= Flag::ShaderStorageBuffers ? GL::Buffer::Target::ShaderStorage : GL::Buffer::Target::Uniform, TextureHandleBufferBinding);
+    return *this;
+}
+
+PhongGL& PhongGL::bindTextureHandleBuffer(GL::Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    CORRADE_ASSERT(_flags >= Flag::BindlessTextures,
+        "Shaders::PhongGL::bindTextureHandleBuffer(): the shader was not created with bindless textures enabled", *this);
+    buffer.bind(_flags >= Flag::ShaderStorageBuffers ? GL::Buffer::Target::ShaderStorage : GL::Buffer::Target::Uniform, TextureHandleBufferBinding, offset, size);
+    return *this;
+}
+#endif
+
 PhongGL& PhongGL::bindAmbientTexture(GL::Texture2D& texture) {
     CORRADE_ASSERT(_flags & Flag::AmbientTexture,
         "Shaders::PhongGL::bindAmbientTexture(): the shader was not created with ambient texture enabled", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags >= Flag::BindlessTextures),
+        "Shaders::PhongGL::bindAmbientTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead", *this);
+    #endif
     #ifndef MAGNUM_TARGET_GLES2
     CORRADE_ASSERT(!(_flags & Flag::TextureArrays),
         "Shaders::PhongGL::bindAmbientTexture(): the shader was created with texture arrays enabled, use a Texture2DArray instead", *this);
@@ -1195,6 +1337,10 @@ PhongGL& PhongGL::bindAmbientTexture(GL::Texture2D& texture) {
 PhongGL& PhongGL::bindAmbientTexture(GL::Texture2DArray& texture) {
     CORRADE_ASSERT(_flags & Flag::AmbientTexture,
         "Shaders::PhongGL::bindAmbientTexture(): the shader was not created with ambient texture enabled", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags >= Flag::BindlessTextures),
+        "Shaders::PhongGL::bindAmbientTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead", *this);
+    #endif
     CORRADE_ASSERT(_flags & Flag::TextureArrays,
         "Shaders::PhongGL::bindAmbientTexture(): the shader was not created with texture arrays enabled, use a Texture2D instead", *this);
     texture.bind(AmbientTextureUnit);
@@ -1205,6 +1351,10 @@ PhongGL& PhongGL::bindAmbientTexture(GL::Texture2DArray& texture) {
 PhongGL& PhongGL::bindDiffuseTexture(GL::Texture2D& texture) {
     CORRADE_ASSERT(_flags & Flag::DiffuseTexture,
         "Shaders::PhongGL::bindDiffuseTexture(): the shader was not created with diffuse texture enabled", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags >= Flag::BindlessTextures),
+        "Shaders::PhongGL::bindDiffuseTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead", *this);
+    #endif
     #ifndef MAGNUM_TARGET_GLES2
     CORRADE_ASSERT(!(_flags & Flag::TextureArrays),
         "Shaders::PhongGL::bindDiffuseTexture(): the shader was created with texture arrays enabled, use a Texture2DArray instead", *this);
@@ -1217,6 +1367,10 @@ PhongGL& PhongGL::bindDiffuseTexture(GL::Texture2D& texture) {
 PhongGL& PhongGL::bindDiffuseTexture(GL::Texture2DArray& texture) {
     CORRADE_ASSERT(_flags & Flag::DiffuseTexture,
         "Shaders::PhongGL::bindDiffuseTexture(): the shader was not created with diffuse texture enabled", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags >= Flag::BindlessTextures),
+        "Shaders::PhongGL::bindDiffuseTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead", *this);
+    #endif
     CORRADE_ASSERT(_flags & Flag::TextureArrays,
         "Shaders::PhongGL::bindDiffuseTexture(): the shader was not created with texture arrays enabled, use a Texture2D instead", *this);
     if(_perDrawLightCount) texture.bind(DiffuseTextureUnit);
@@ -1227,6 +1381,10 @@ PhongGL& PhongGL::bindDiffuseTexture(GL::Texture2DArray& texture) {
 PhongGL& PhongGL::bindSpecularTexture(GL::Texture2D& texture) {
     CORRADE_ASSERT(_flags & Flag::SpecularTexture,
         "Shaders::PhongGL::bindSpecularTexture(): the shader was not created with specular texture enabled", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags >= Flag::BindlessTextures),
+        "Shaders::PhongGL::bindSpecularTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead", *this);
+    #endif
     #ifndef MAGNUM_TARGET_GLES2
     CORRADE_ASSERT(!(_flags & Flag::TextureArrays),
         "Shaders::PhongGL::bindSpecularTexture(): the shader was created with texture arrays enabled, use a Texture2DArray instead", *this);
@@ -1239,6 +1397,10 @@ PhongGL& PhongGL::bindSpecularTexture(GL::Texture2D& texture) {
 PhongGL& PhongGL::bindSpecularTexture(GL::Texture2DArray& texture) {
     CORRADE_ASSERT(_flags & Flag::SpecularTexture,
         "Shaders::PhongGL::bindSpecularTexture(): the shader was not created with specular texture enabled", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags >= Flag::BindlessTextures),
+        "Shaders::PhongGL::bindSpecularTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead", *this);
+    #endif
     CORRADE_ASSERT(_flags & Flag::TextureArrays,
         "Shaders::PhongGL::bindSpecularTexture(): the shader was not created with texture arrays enabled, use a Texture2D instead", *this);
     if(_perDrawLightCount) texture.bind(SpecularTextureUnit);
@@ -1249,6 +1411,10 @@ PhongGL& PhongGL::bindSpecularTexture(GL::Texture2DArray& texture) {
 PhongGL& PhongGL::bindNormalTexture(GL::Texture2D& texture) {
     CORRADE_ASSERT(_flags & Flag::NormalTexture,
         "Shaders::PhongGL::bindNormalTexture(): the shader was not created with normal texture enabled", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags >= Flag::BindlessTextures),
+        "Shaders::PhongGL::bindNormalTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead", *this);
+    #endif
     #ifndef MAGNUM_TARGET_GLES2
     CORRADE_ASSERT(!(_flags & Flag::TextureArrays),
         "Shaders::PhongGL::bindNormalTexture(): the shader was created with texture arrays enabled, use a Texture2DArray instead", *this);
@@ -1261,6 +1427,10 @@ PhongGL& PhongGL::bindNormalTexture(GL::Texture2D& texture) {
 PhongGL& PhongGL::bindNormalTexture(GL::Texture2DArray& texture) {
     CORRADE_ASSERT(_flags & Flag::NormalTexture,
         "Shaders::PhongGL::bindNormalTexture(): the shader was not created with normal texture enabled", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags >= Flag::BindlessTextures),
+        "Shaders::PhongGL::bindNormalTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead", *this);
+    #endif
     CORRADE_ASSERT(_flags & Flag::TextureArrays,
         "Shaders::PhongGL::bindNormalTexture(): the shader was not created with texture arrays enabled, use a Texture2D instead", *this);
     if(_perDrawLightCount) texture.bind(NormalTextureUnit);
@@ -1272,6 +1442,10 @@ PhongGL& PhongGL::bindNormalTexture(GL::Texture2DArray& texture) {
 PhongGL& PhongGL::bindObjectIdTexture(GL::Texture2D& texture) {
     CORRADE_ASSERT(_flags >= Flag::ObjectIdTexture,
         "Shaders::PhongGL::bindObjectIdTexture(): the shader was not created with object ID texture enabled", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags >= Flag::BindlessTextures),
+        "Shaders::PhongGL::bindObjectIdTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead", *this);
+    #endif
     #ifndef MAGNUM_TARGET_GLES2
     CORRADE_ASSERT(!(_flags & Flag::TextureArrays),
         "Shaders::PhongGL::bindObjectIdTexture(): the shader was created with texture arrays enabled, use a Texture2DArray instead", *this);
@@ -1283,6 +1457,10 @@ PhongGL& PhongGL::bindObjectIdTexture(GL::Texture2D& texture) {
 PhongGL& PhongGL::bindObjectIdTexture(GL::Texture2DArray& texture) {
     CORRADE_ASSERT(_flags >= Flag::ObjectIdTexture,
         "Shaders::PhongGL::bindObjectIdTexture(): the shader was not created with object ID texture enabled", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags >= Flag::BindlessTextures),
+        "Shaders::PhongGL::bindObjectIdTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead", *this);
+    #endif
     CORRADE_ASSERT(_flags & Flag::TextureArrays,
         "Shaders::PhongGL::bindObjectIdTexture(): the shader was not created with texture arrays enabled, use a Texture2D instead", *this);
     texture.bind(ObjectIdTextureUnit);
@@ -1293,6 +1471,10 @@ PhongGL& PhongGL::bindObjectIdTexture(GL::Texture2DArray& texture) {
 PhongGL& PhongGL::bindTextures(GL::Texture2D* ambient, GL::Texture2D* diffuse, GL::Texture2D* specular, GL::Texture2D* normal) {
     CORRADE_ASSERT(_flags & (Flag::AmbientTexture|Flag::DiffuseTexture|Flag::SpecularTexture|Flag::NormalTexture),
         "Shaders::PhongGL::bindTextures(): the shader was not created with any textures enabled", *this);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(_flags >= Flag::BindlessTextures),
+        "Shaders::PhongGL::bindTextures(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead", *this);
+    #endif
     #ifndef MAGNUM_TARGET_GLES2
     CORRADE_ASSERT(!(_flags & Flag::TextureArrays),
         "Shaders::PhongGL::bindTextures(): the shader was created with texture arrays enabled, use a Texture2DArray instead", *this);
@@ -1309,6 +1491,14 @@ PhongGL::Configuration& PhongGL::Configuration::setLightCount(const UnsignedInt
     return *this;
 }
 
+PhongGL::Configuration PhongGL::Configuration::depthOnlyVariant() const {
+    Configuration out{*this};
+    out._flags = (_flags & DepthOnlyFlags)|Flag::DepthOnly;
+    out._lightCount = 0;
+    out._perDrawLightCount = 0;
+    return out;
+}
+
 #ifndef MAGNUM_TARGET_GLES2
 PhongGL::Configuration& PhongGL::Configuration::setJointCount(UnsignedInt count, UnsignedInt perVertexCount, UnsignedInt secondaryPerVertexCount) {
     CORRADE_ASSERT(perVertexCount <= 4,
@@ -1367,11 +1557,21 @@ Debug& operator<<(Debug& debug, const PhongGL::Flag value) {
         _c(MultiDraw)
         _c(TextureArrays)
         _c(LightCulling)
+        #ifndef MAGNUM_TARGET_WEBGL
+        _c(ClusteredLights)
+        #endif
         #endif
         _c(NoSpecular)
         #ifndef MAGNUM_TARGET_GLES2
         _c(DynamicPerVertexJointCount)
         #endif
+        #ifndef MAGNUM_TARGET_GLES
+        _c(BindlessTextures)
+        #endif
+        _c(DepthOnly)
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        _c(VertexPulling)
+        #endif
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -1414,11 +1614,21 @@ Debug& operator<<(Debug& debug, const PhongGL::Flags value) {
         PhongGL::Flag::UniformBuffers,
         PhongGL::Flag::TextureArrays,
         PhongGL::Flag::LightCulling,
+        #ifndef MAGNUM_TARGET_WEBGL
+        PhongGL::Flag::ClusteredLights,
+        #endif
         #endif
         PhongGL::Flag::NoSpecular,
         #ifndef MAGNUM_TARGET_GLES2
         PhongGL::Flag::DynamicPerVertexJointCount,
         #endif
+        #ifndef MAGNUM_TARGET_GLES
+        PhongGL::Flag::BindlessTextures,
+        #endif
+        PhongGL::Flag::DepthOnly,
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        PhongGL::Flag::VertexPulling
+        #endif
     });
 }
 
@@ -290,6 +290,26 @@ to offset the per-vertex joint IDs with
 @requires_webgl20 Extension @webgl_extension{ANGLE,instanced_arrays} in WebGL
     1.0.
 
+@section Shaders-PhongGL-depth-only Depth-only rendering
+
+For a depth prepass or shadow map rendering, enabling @ref Flag::DepthOnly
+creates a variant that only transforms the vertex position, with no inputs
+other than the @ref Position attribute, no data passed to the fragment shader
+and no fragment outputs. The position is calculated with the same code as in
+the color variant, so instanced transformation, skinning and uniform buffers
+work the same. The output position is marked as @glsl invariant @ce, so the
+resulting depth values are bit-exact between the two, allowing the color
+pass to use @ref GL::Renderer::DepthFunction::LessOrEqual or
+@relativeref{GL::Renderer::DepthFunction,Equal} and shade each pixel only
+once. Instead of picking the right subset of flags manually,
+@ref Configuration::depthOnlyVariant() derives it from the configuration of
+the color variant:
+
+@snippet Shaders-gl.cpp PhongGL-depth-only
+
+All uniforms, buffers and attributes that affect only the color output are
+ignored by the depth-only variant, and setting them has no effect.
+
 @section Shaders-PhongGL-ubo Uniform buffers
 
 See @ref shaders-usage-ubo for a high-level overview that applies to all
@@ -321,6 +341,13 @@ into the @ref PhongLightUniform array using @ref PhongDrawUniform::lightOffset
 and @relativeref{PhongDrawUniform,lightCount}. Besides that, the usage is
 similar for all shaders, see @ref shaders-usage-multidraw for an example.
 
+On desktop GL with @gl_extension{ARB,bindless_texture}, enabling
+@ref Flag::BindlessTextures replaces texture binding with a per-material
+@ref PhongTextureHandleUniform buffer bound with
+@ref bindTextureHandleBuffer(). Each material then references its own
+textures, which means a multidraw can sample different textures in every draw
+without having to pack all textures into texture arrays.
+
 For skinning, joint matrices are supplied via a @ref TransformationUniform3D
 buffer bound with @ref bindJointBuffer(). In an instanced scenario the
 per-instance joint count is supplied via
@@ -346,6 +373,41 @@ doesn't need to vary per draw.
 @requires_webgl_extension Extension @webgl_extension{ANGLE,multi_draw} for
     multidraw.
 
+@subsection Shaders-PhongGL-clustered-lights Clustered lights
+
+With thousands of lights, going through even a culled per-draw light range
+for every fragment gets prohibitively expensive. Enabling
+@ref Flag::ClusteredLights together with @ref Flag::ShaderStorageBuffers
+makes the shader pick the light list from a grid of clusters instead, with
+the grid subdividing the view frustum into screen-space tiles and
+logarithmically distributed depth slices. The grid is calculated on the CPU
+with @ref LightClusterGrid from the same camera-space light positions and
+ranges that are uploaded into the @ref PhongLightUniform buffer, and supplied
+via @ref bindLightClusterBuffer() and @ref bindLightClusterIndexBuffer():
+
+@snippet Shaders-gl.cpp PhongGL-clustered-lights
+
+The grid depends on the projection and viewport size, which is assumed to
+start at the framebuffer origin. The light list has to be rebuilt whenever
+the lights or the camera move.
+
+@requires_gl43 Extension @gl_extension{ARB,shader_storage_buffer_object} for
+    clustered lights.
+@requires_gles31 Shader storage buffers, and thus clustered lights, are not
+    available in OpenGL ES 3.0 and older.
+@requires_gles Shader storage buffers, and thus clustered lights, are not
+    available in WebGL.
+
+@subsection Shaders-PhongGL-vertex-pulling Vertex pulling
+
+With @ref Flag::ShaderStorageBuffers, enabling @ref Flag::VertexPulling makes
+the shader fetch per-vertex attributes from a buffer bound with
+@ref bindVertexBuffer() instead of from vertex attributes. Together with
+@ref MeshTools::compileVertexPulling() all meshes can then be drawn through a
+single attribute-less mesh, making multidraw independent of the vertex layout:
+
+@snippet Shaders-gl.cpp compileVertexPulling
+
 @see @ref shaders
 */
 class MAGNUM_SHADERS_EXPORT PhongGL: public GL::AbstractShaderProgram {
@@ -932,6 +994,98 @@ class MAGNUM_SHADERS_EXPORT PhongGL: public GL::AbstractShaderProgram {
              */
             DynamicPerVertexJointCount = 1 << 18,
             #endif
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * Use bindless textures. Instead of binding textures with
+             * @ref bindAmbientTexture(), @ref bindDiffuseTexture(),
+             * @ref bindSpecularTexture(), @ref bindNormalTexture(),
+             * @ref bindObjectIdTexture() or @ref bindTextures(), resident
+             * texture handles are read from a @ref PhongTextureHandleUniform
+             * buffer bound with @ref bindTextureHandleBuffer(), indexed by
+             * @ref PhongDrawUniform::materialId. Together with
+             * @ref Flag::MultiDraw this allows a single draw call to use
+             * different textures for each draw without any texture binding in
+             * between. Expects that @ref Flag::UniformBuffers is enabled and
+             * that at least one texture is enabled.
+             * @see @ref GL::AbstractTexture::handle(),
+             *      @ref GL::AbstractTexture::makeHandleResident()
+             * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+             * @requires_gl Bindless textures are not available in OpenGL ES
+             *      and WebGL.
+             * @m_since_latest
+             */
+            BindlessTextures = 1 << 21,
+            #endif
+
+            #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+            /**
+             * Clustered light assignment. Instead of going through
+             * @ref perDrawLightCount() lights for every fragment, the light
+             * list is picked from a cluster grid based on the fragment
+             * window-space position and camera-space depth, making the
+             * shading cost depend on local light density instead of the total
+             * light count. The grid is supplied via
+             * @ref bindLightClusterBuffer() and
+             * @ref bindLightClusterIndexBuffer() and is usually calculated
+             * with @ref LightClusterGrid. See
+             * @ref Shaders-PhongGL-clustered-lights for more information.
+             * Expects that @ref Flag::ShaderStorageBuffers is enabled, that
+             * @ref Flag::LightCulling isn't and that
+             * @ref Configuration::setLightCount() "per-draw light count" is
+             * non-zero, as otherwise the lighting calculation is compiled out.
+             * @requires_gl43 Extension @gl_extension{ARB,shader_storage_buffer_object}
+             * @requires_gles31 Shader storage buffers are not available in
+             *      OpenGL ES 3.0 and older.
+             * @requires_gles Shader storage buffers are not available in
+             *      WebGL.
+             * @m_since_latest
+             */
+            ClusteredLights = 1 << 22,
+            #endif
+
+            /**
+             * Depth-only variant. Only the vertex position gets transformed
+             * and there are no fragment outputs, useful for a depth prepass
+             * or shadow map rendering. Can be combined only with
+             * @ref Flag::InstancedTransformation,
+             * @ref Flag::DynamicPerVertexJointCount,
+             * @ref Flag::UniformBuffers, @ref Flag::ShaderStorageBuffers,
+             * @ref Flag::MultiDraw and @ref Flag::VertexPulling, light count
+             * set in @ref Configuration::setLightCount() is ignored. Use
+             * @ref Configuration::depthOnlyVariant() to derive a depth-only
+             * configuration from a configuration used for rendering color.
+             * See @ref Shaders-PhongGL-depth-only for more information.
+             * @m_since_latest
+             */
+            DepthOnly = 1 << 23,
+
+            #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+            /**
+             * Vertex pulling. Instead of going through vertex attributes,
+             * @ref Position, @ref Normal, @ref Tangent / @ref Tangent4,
+             * @ref Bitangent, @ref TextureCoordinates and @ref Color4 are
+             * fetched from a shader storage buffer bound with
+             * @ref bindVertexBuffer(), indexed with the vertex ID. The buffer
+             * is usually filled with @ref MeshTools::compileVertexPulling(),
+             * which concatenates multiple meshes, and as the vertex ID
+             * includes the base vertex, a single mesh with no vertex
+             * attributes can be then used to draw all of them. Together with
+             * @ref Flag::MultiDraw this makes it possible to draw arbitrary
+             * meshes in a single call without any vertex array switches.
+             * Instanced attributes are still taken from vertex buffers.
+             * Expects that @ref Flag::ShaderStorageBuffers is enabled and
+             * that skinning isn't used. Can be combined with
+             * @ref Flag::DepthOnly.
+             * @requires_gl43 Extension @gl_extension{ARB,shader_storage_buffer_object}
+             * @requires_gles31 Shader storage buffers are not available in
+             *      OpenGL ES 3.0 and older.
+             * @requires_gles Shader storage buffers are not available in
+             *      WebGL.
+             * @m_since_latest
+             */
+            VertexPulling = 1 << 24
+            #endif
         };
 
         /**
@@ -1901,6 +2055,100 @@ class MAGNUM_SHADERS_EXPORT PhongGL: public GL::AbstractShaderProgram {
          */
         PhongGL& bindJointBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
 
+        #ifndef MAGNUM_TARGET_WEBGL
+        /**
+         * @brief Bind a light cluster shader storage buffer
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that @ref Flag::ClusteredLights is set. The buffer is
+         * expected to contain a @ref PhongLightClusterGridUniform followed
+         * by an offset and count pair for each cluster, such as
+         * @ref LightClusterGrid::clusterData().
+         * @requires_gl43 Extension @gl_extension{ARB,shader_storage_buffer_object}
+         * @requires_gles31 Shader storage buffers are not available in
+         *      OpenGL ES 3.0 and older.
+         * @requires_gles Shader storage buffers are not available in WebGL.
+         */
+        PhongGL& bindLightClusterBuffer(GL::Buffer& buffer);
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        PhongGL& bindLightClusterBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+
+        /**
+         * @brief Bind a light cluster index shader storage buffer
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that @ref Flag::ClusteredLights is set. The buffer is
+         * expected to contain 32-bit indices into the buffer bound with
+         * @ref bindLightBuffer(), referenced by the ranges in
+         * @ref bindLightClusterBuffer(), such as
+         * @ref LightClusterGrid::lightIndices().
+         * @requires_gl43 Extension @gl_extension{ARB,shader_storage_buffer_object}
+         * @requires_gles31 Shader storage buffers are not available in
+         *      OpenGL ES 3.0 and older.
+         * @requires_gles Shader storage buffers are not available in WebGL.
+         */
+        PhongGL& bindLightClusterIndexBuffer(GL::Buffer& buffer);
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        PhongGL& bindLightClusterIndexBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+
+        /**
+         * @brief Bind a vertex shader storage buffer
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that @ref Flag::VertexPulling is set. The buffer is
+         * expected to contain data in a layout described by
+         * @ref MeshTools::VertexPullingLayout, usually filled by
+         * @ref MeshTools::compileVertexPulling(). Positions are always
+         * taken, normals only if there are lights, tangents and bitangents
+         * only if @ref Flag::NormalTexture is enabled, texture coordinates
+         * only if the shader is textured and colors only if
+         * @ref Flag::VertexColor is enabled. If the buffer doesn't contain
+         * given attribute, a default of @cpp (0, 0, 0, 1) @ce is used,
+         * consistently with vertex attributes that aren't bound.
+         * @requires_gl43 Extension @gl_extension{ARB,shader_storage_buffer_object}
+         * @requires_gles31 Shader storage buffers are not available in
+         *      OpenGL ES 3.0 and older.
+         * @requires_gles Shader storage buffers are not available in WebGL.
+         */
+        PhongGL& bindVertexBuffer(GL::Buffer& buffer);
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        PhongGL& bindVertexBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+        #endif
+
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Bind a texture handle uniform / shader storage buffer
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that @ref Flag::BindlessTextures is set. The buffer is
+         * expected to contain @ref materialCount() instances of
+         * @ref PhongTextureHandleUniform, with all referenced handles being
+         * resident.
+         * @requires_extension Extension @gl_extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES and
+         *      WebGL.
+         */
+        PhongGL& bindTextureHandleBuffer(GL::Buffer& buffer);
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        PhongGL& bindTextureHandleBuffer(GL::Buffer& buffer, GLintptr offset, GLsizeiptr size);
+        #endif
+
         /**
          * @}
          */
@@ -2375,6 +2623,18 @@ class MAGNUM_SHADERS_EXPORT PhongGL::Configuration {
         }
         #endif
 
+        /**
+         * @brief Depth-only variant of this configuration
+         *
+         * Returns a copy with @ref Flag::DepthOnly added, all flags that
+         * don't affect the vertex position removed and the light count set
+         * to @cpp 0 @ce. The resulting shader uses the same vertex
+         * transformation as a shader created from this configuration, with
+         * the same attribute locations and uniform / buffer bindings. See
+         * @ref Shaders-PhongGL-depth-only for more information.
+         */
+        Configuration depthOnlyVariant() const;
+
     private:
         Flags _flags;
         UnsignedInt _lightCount = 1,
@@ -0,0 +1,204 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ShaderCacheGL.h"
+
+#include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Shaders/DistanceFieldVectorGL.h"
+#include "Magnum/Shaders/FlatGL.h"
+#include "Magnum/Shaders/MeshVisualizerGL.h"
+#include "Magnum/Shaders/PhongGL.h"
+#include "Magnum/Shaders/VectorGL.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/Shaders/LineGL.h"
+#endif
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+
+/* Everything that affects the compiled program. Unused values stay zero. */
+struct Key {
+    UnsignedLong flags;
+    UnsignedInt values[7];
+};
+
+bool operator==(const Key& a, const Key& b) {
+    if(a.flags != b.flags) return false;
+    for(std::size_t i = 0; i != Containers::arraySize(a.values); ++i)
+        if(a.values[i] != b.values[i]) return false;
+    return true;
+}
+
+template<class> struct ShaderCacheTraits;
+template<> struct ShaderCacheTraits<PhongGL> {
+    static Key key(const PhongGL::Configuration& configuration) {
+        return {Containers::enumCastUnderlyingType(configuration.flags()), {
+            configuration.lightCount(),
+            configuration.perDrawLightCount(),
+            #ifndef MAGNUM_TARGET_GLES2
+            configuration.jointCount(),
+            configuration.perVertexJointCount(),
+            configuration.secondaryPerVertexJointCount(),
+            configuration.materialCount(),
+            configuration.drawCount()
+            #endif
+        }};
+    }
+};
+/* FlatGL and the two MeshVisualizerGL variants have the same set of
+   configuration options */
+template<class Shader> struct ShaderCacheTraitsSkinned {
+    static Key key(const typename Shader::Configuration& configuration) {
+        return {Containers::enumCastUnderlyingType(configuration.flags()), {
+            #ifndef MAGNUM_TARGET_GLES2
+            configuration.jointCount(),
+            configuration.perVertexJointCount(),
+            configuration.secondaryPerVertexJointCount(),
+            configuration.materialCount(),
+            configuration.drawCount()
+            #endif
+        }};
+    }
+};
+template<UnsignedInt dimensions> struct ShaderCacheTraits<FlatGL<dimensions>>: ShaderCacheTraitsSkinned<FlatGL<dimensions>> {};
+template<> struct ShaderCacheTraits<MeshVisualizerGL2D>: ShaderCacheTraitsSkinned<MeshVisualizerGL2D> {};
+template<> struct ShaderCacheTraits<MeshVisualizerGL3D>: ShaderCacheTraitsSkinned<MeshVisualizerGL3D> {};
+/* VectorGL and DistanceFieldVectorGL as well */
+template<class Shader> struct ShaderCacheTraitsVector {
+    static Key key(const typename Shader::Configuration& configuration) {
+        return {Containers::enumCastUnderlyingType(configuration.flags()), {
+            #ifndef MAGNUM_TARGET_GLES2
+            configuration.materialCount(),
+            configuration.drawCount()
+            #endif
+        }};
+    }
+};
+template<UnsignedInt dimensions> struct ShaderCacheTraits<VectorGL<dimensions>>: ShaderCacheTraitsVector<VectorGL<dimensions>> {};
+template<UnsignedInt dimensions> struct ShaderCacheTraits<DistanceFieldVectorGL<dimensions>>: ShaderCacheTraitsVector<DistanceFieldVectorGL<dimensions>> {};
+#ifndef MAGNUM_TARGET_GLES2
+template<UnsignedInt dimensions> struct ShaderCacheTraits<LineGL<dimensions>> {
+    static Key key(const typename LineGL<dimensions>::Configuration& configuration) {
+        return {Containers::enumCastUnderlyingType(configuration.flags()), {
+            UnsignedInt(configuration.capStyle()),
+            UnsignedInt(configuration.joinStyle()),
+            configuration.materialCount(),
+            configuration.drawCount()
+        }};
+    }
+};
+#endif
+
+}
+
+template<class Shader> struct ShaderCacheGL<Shader>::State {
+    struct Entry {
+        Key key;
+        /* Non-null until the shader is created from it */
+        Containers::Pointer<typename Shader::CompileState> compileState;
+        Containers::Pointer<Shader> shader;
+    };
+
+    Entry* find(const Key& key) {
+        for(Entry& entry: entries)
+            if(entry.key == key) return &entry;
+        return nullptr;
+    }
+
+    Entry& findOrCompile(const Configuration& configuration) {
+        const Key key = ShaderCacheTraits<Shader>::key(configuration);
+        if(Entry* const found = find(key)) return *found;
+        return arrayAppend(entries, InPlaceInit, key,
+            Containers::pointer<typename Shader::CompileState>(Shader::compile(configuration)),
+            nullptr);
+    }
+
+    Containers::Array<Entry> entries;
+};
+
+template<class Shader> ShaderCacheGL<Shader>::ShaderCacheGL(): _state{InPlaceInit} {}
+
+template<class Shader> ShaderCacheGL<Shader>::ShaderCacheGL(ShaderCacheGL<Shader>&&) noexcept = default;
+
+template<class Shader> ShaderCacheGL<Shader>::~ShaderCacheGL() = default;
+
+template<class Shader> ShaderCacheGL<Shader>& ShaderCacheGL<Shader>::operator=(ShaderCacheGL<Shader>&&) noexcept = default;
+
+template<class Shader> std::size_t ShaderCacheGL<Shader>::size() const {
+    return _state->entries.size();
+}
+
+template<class Shader> bool ShaderCacheGL<Shader>::contains(const Configuration& configuration) const {
+    const Key key = ShaderCacheTraits<Shader>::key(configuration);
+    for(const typename State::Entry& entry: _state->entries)
+        if(entry.key == key) return true;
+    return false;
+}
+
+template<class Shader> Shader* ShaderCacheGL<Shader>::find(const Configuration& configuration) {
+    typename State::Entry& entry = _state->findOrCompile(configuration);
+    if(!entry.shader) {
+        if(!entry.compileState->isLinkFinished()) return nullptr;
+        entry.shader = Containers::pointer<Shader>(Utility::move(*entry.compileState));
+        entry.compileState = nullptr;
+    }
+    return entry.shader.get();
+}
+
+template<class Shader> Shader& ShaderCacheGL<Shader>::get(const Configuration& configuration) {
+    typename State::Entry& entry = _state->findOrCompile(configuration);
+    if(!entry.shader) {
+        /* The constructor waits for the compilation and linking to finish */
+        entry.shader = Containers::pointer<Shader>(Utility::move(*entry.compileState));
+        entry.compileState = nullptr;
+    }
+    return *entry.shader;
+}
+
+template<class Shader> void ShaderCacheGL<Shader>::clear() {
+    arrayClear(_state->entries);
+}
+
+template class MAGNUM_SHADERS_EXPORT ShaderCacheGL<PhongGL>;
+template class MAGNUM_SHADERS_EXPORT ShaderCacheGL<FlatGL2D>;
+template class MAGNUM_SHADERS_EXPORT ShaderCacheGL<FlatGL3D>;
+template class MAGNUM_SHADERS_EXPORT ShaderCacheGL<MeshVisualizerGL2D>;
+template class MAGNUM_SHADERS_EXPORT ShaderCacheGL<MeshVisualizerGL3D>;
+#ifndef MAGNUM_TARGET_GLES2
+template class MAGNUM_SHADERS_EXPORT ShaderCacheGL<LineGL2D>;
+template class MAGNUM_SHADERS_EXPORT ShaderCacheGL<LineGL3D>;
+#endif
+template class MAGNUM_SHADERS_EXPORT ShaderCacheGL<VectorGL2D>;
+template class MAGNUM_SHADERS_EXPORT ShaderCacheGL<VectorGL3D>;
+template class MAGNUM_SHADERS_EXPORT ShaderCacheGL<DistanceFieldVectorGL2D>;
+template class MAGNUM_SHADERS_EXPORT ShaderCacheGL<DistanceFieldVectorGL3D>;
+
+}}
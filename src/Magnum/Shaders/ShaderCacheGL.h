@@ -0,0 +1,166 @@
+#ifndef Magnum_Shaders_ShaderCacheGL_h
+#define Magnum_Shaders_ShaderCacheGL_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::ShaderCacheGL
+ * @m_since_latest
+ */
+
+#include <cstddef>
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Cache of shader variants
+@m_since_latest
+
+Keeps one shader instance for each distinct @ref PhongGL::Configuration
+"Shader::Configuration" it was asked for, so a material system creating the
+same configuration repeatedly compiles and links it only once. Supported
+@p Shader types are @ref PhongGL, @ref FlatGL2D, @ref FlatGL3D,
+@ref MeshVisualizerGL2D, @ref MeshVisualizerGL3D, @ref LineGL2D,
+@ref LineGL3D, @ref VectorGL2D, @ref VectorGL3D, @ref DistanceFieldVectorGL2D
+and @ref DistanceFieldVectorGL3D.
+
+@section Shaders-ShaderCacheGL-usage Usage
+
+The first lookup of a configuration submits the shader for compilation using
+@ref PhongGL::compile() "Shader::compile()", making use of
+@ref shaders-async "async compilation and linking" if the driver supports it.
+The @ref find() function then returns @cpp nullptr @ce until the program is
+linked, which means it never blocks and the application can for example
+draw with a fallback shader or skip the draw in the meantime. The
+@ref get() function instead waits for the compilation to finish:
+
+@snippet Shaders-gl.cpp ShaderCacheGL-usage
+
+Returned shader references stay valid until the cache is destroyed or
+@ref clear() is called. As the cached shaders are shared by all users, the
+uniforms and bindings of a shader returned from the cache have to be set
+before every draw.
+
+@section Shaders-ShaderCacheGL-context Relation to GL contexts
+
+Shader programs belong to the GL context that was current when they were
+created. Magnum doesn't provide any way to attach user data to a
+@ref GL::Context, so instead of a hidden global the cache is a regular object
+that the application creates for each context, next to the context itself,
+and destroys while the context is still current. The cache isn't
+thread-safe. Cached variants are looked up with a linear search, which is
+cheap for the usual amount of variants in a scene but isn't meant for
+thousands of them.
+*/
+template<class Shader> class MAGNUM_SHADERS_EXPORT ShaderCacheGL {
+    public:
+        /** @brief Shader configuration */
+        typedef typename Shader::Configuration Configuration;
+
+        /**
+         * @brief Constructor
+         *
+         * Creates an empty cache. Doesn't create any GL objects.
+         */
+        explicit ShaderCacheGL();
+
+        /** @brief Copying is not allowed */
+        ShaderCacheGL(const ShaderCacheGL<Shader>&) = delete;
+
+        /** @brief Move constructor */
+        ShaderCacheGL(ShaderCacheGL<Shader>&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys all cached shaders, expected to be called with the
+         * context the shaders were created in being current.
+         */
+        ~ShaderCacheGL();
+
+        /** @brief Copying is not allowed */
+        ShaderCacheGL<Shader>& operator=(const ShaderCacheGL<Shader>&) = delete;
+
+        /** @brief Move assignment */
+        ShaderCacheGL<Shader>& operator=(ShaderCacheGL<Shader>&&) noexcept;
+
+        /**
+         * @brief Count of cached variants
+         *
+         * Includes also variants for which the compilation didn't finish
+         * yet.
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief Whether given configuration is cached
+         *
+         * Doesn't submit anything for compilation. Returns @cpp true @ce
+         * also if the compilation didn't finish yet.
+         */
+        bool contains(const Configuration& configuration) const;
+
+        /**
+         * @brief Find a shader without blocking
+         *
+         * If @p configuration isn't cached yet, submits it for compilation
+         * and returns @cpp nullptr @ce. If it is, but the compilation and
+         * linking didn't finish yet, returns @cpp nullptr @ce as well.
+         * Otherwise returns the cached shader.
+         * @see @ref GL::AbstractShaderProgram::isLinkFinished()
+         */
+        Shader* find(const Configuration& configuration);
+
+        /**
+         * @brief Get a shader
+         *
+         * If @p configuration isn't cached yet, compiles it. If the
+         * compilation and linking didn't finish yet, waits for it. Returns
+         * the cached shader.
+         */
+        Shader& get(const Configuration& configuration);
+
+        /**
+         * @brief Clear the cache
+         *
+         * Destroys all cached shaders, including those for which the
+         * compilation didn't finish yet. References returned from
+         * @ref find() and @ref get() become invalid.
+         */
+        void clear();
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
@@ -57,8 +57,15 @@ typedef CORRADE_DEPRECATED("use FlatGL2D instead") FlatGL2D Flat2D;
 typedef CORRADE_DEPRECATED("use FlatGL3D instead") FlatGL3D Flat3D;
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+template<class> class DrawBatchGL;
+class FrustumCullingGL;
+#endif
+
 /* Generic is used only statically */
 
+class LightClusterGrid;
+
 #ifndef MAGNUM_TARGET_GLES2
 enum class LineCapStyle: UnsignedByte;
 enum class LineJoinStyle: UnsignedByte;
@@ -77,10 +84,17 @@ typedef CORRADE_DEPRECATED("use MeshVisualizerGL3D instead") MeshVisualizerGL3D
 #endif
 
 class PhongGL;
+struct PhongMaterialUniform;
 #ifdef MAGNUM_BUILD_DEPRECATED
 typedef CORRADE_DEPRECATED("use PhongGL instead") PhongGL Phong;
 #endif
 
+template<class> class ShaderCacheGL;
+
+#ifndef MAGNUM_TARGET_GLES2
+class SkinningGL;
+#endif
+
 template<UnsignedInt> class VectorGL;
 typedef VectorGL<2> VectorGL2D;
 typedef VectorGL<3> VectorGL3D;
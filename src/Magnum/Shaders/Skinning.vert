@@ -0,0 +1,127 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef RUNTIME_CONST
+#define const
+#endif
+
+/* Uniforms */
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 0)
+#endif
+uniform highp mat4 jointMatrices[JOINT_COUNT]
+    #ifdef JOINT_MATRIX_INITIALIZER
+    = mat4[](JOINT_MATRIX_INITIALIZER)
+    #endif
+    ;
+
+/* Inputs */
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = POSITION_ATTRIBUTE_LOCATION)
+#endif
+in highp vec4 position;
+
+#ifdef NORMAL
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = NORMAL_ATTRIBUTE_LOCATION)
+#endif
+in mediump vec3 normal;
+#endif
+
+#ifdef TANGENT
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = TANGENT_ATTRIBUTE_LOCATION)
+#endif
+in mediump vec4 tangent;
+#endif
+
+#if PER_VERTEX_JOINT_COUNT
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = WEIGHTS_ATTRIBUTE_LOCATION)
+#endif
+in mediump vec4 weights;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = JOINTIDS_ATTRIBUTE_LOCATION)
+#endif
+in mediump uvec4 jointIds;
+#endif
+
+#if SECONDARY_PER_VERTEX_JOINT_COUNT
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = SECONDARY_WEIGHTS_ATTRIBUTE_LOCATION)
+#endif
+in mediump vec4 secondaryWeights;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = SECONDARY_JOINTIDS_ATTRIBUTE_LOCATION)
+#endif
+in mediump uvec4 secondaryJointIds;
+#endif
+
+/* Outputs, captured with transform feedback */
+
+out highp vec3 skinnedPosition;
+
+#ifdef NORMAL
+out mediump vec3 skinnedNormal;
+#endif
+
+#ifdef TANGENT
+out mediump vec4 skinnedTangent;
+#endif
+
+void main() {
+    highp mat4 skinMatrix = mat4(0.0);
+    #if PER_VERTEX_JOINT_COUNT
+    for(uint i = 0u; i != PER_VERTEX_JOINT_COUNT; ++i)
+        skinMatrix += weights[i]*jointMatrices[jointIds[i]];
+    #endif
+    #if SECONDARY_PER_VERTEX_JOINT_COUNT
+    for(uint i = 0u; i != SECONDARY_PER_VERTEX_JOINT_COUNT; ++i)
+        skinMatrix += secondaryWeights[i]*jointMatrices[secondaryJointIds[i]];
+    #endif
+
+    highp vec4 skinnedPosition4 = skinMatrix*position;
+    skinnedPosition = skinnedPosition4.xyz/skinnedPosition4.w;
+
+    /* Assuming the joint transformations don't have non-uniform scaling, so
+       the upper 3x3 part can be used for normals as well */
+    #if defined(NORMAL) || defined(TANGENT)
+    mediump const mat3 skinRotationScaling = mat3(skinMatrix);
+    #endif
+    #ifdef NORMAL
+    skinnedNormal = normalize(skinRotationScaling*normal);
+    #endif
+    #ifdef TANGENT
+    skinnedTangent = vec4(normalize(skinRotationScaling*tangent.xyz), tangent.w);
+    #endif
+
+    /* Nothing is rasterized, but a position has to be written anyway */
+    gl_Position = vec4(0.0, 0.0, 0.0, 1.0);
+}
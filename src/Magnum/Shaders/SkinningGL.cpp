@@ -0,0 +1,249 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SkinningGL.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/GL/TransformFeedback.h"
+#include "Magnum/Math/Matrix4.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+static void importShaderResources() {
+    CORRADE_RESOURCE_INITIALIZE(MagnumShaders_RESOURCES_GL)
+}
+#endif
+
+namespace Magnum { namespace Shaders {
+
+using namespace Containers::Literals;
+
+SkinningGL::CompileState SkinningGL::compile(const Configuration& configuration) {
+    CORRADE_ASSERT(configuration.jointCount(),
+        "Shaders::SkinningGL: joint count can't be zero", CompileState{NoCreate});
+
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::transform_feedback2);
+    #endif
+
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumShadersGL"_s))
+        importShaderResources();
+    #endif
+    Utility::Resource rs("MagnumShadersGL"_s);
+
+    const GL::Context& context = GL::Context::current();
+
+    #ifndef MAGNUM_TARGET_GLES
+    const GL::Version version = context.supportedVersion({GL::Version::GL320, GL::Version::GL310, GL::Version::GL300});
+    #else
+    const GL::Version version = context.supportedVersion({
+        #ifndef MAGNUM_TARGET_WEBGL
+        GL::Version::GLES310,
+        #endif
+        GL::Version::GLES300});
+    #endif
+
+    GL::Shader vert{version, GL::Shader::Type::Vertex};
+    vert.addSource(rs.getString("compatibility.glsl"_s))
+        .addSource(configuration.flags() & Flag::Normal ? "#define NORMAL\n"_s : ""_s)
+        .addSource(configuration.flags() & Flag::Tangent4 ? "#define TANGENT\n"_s : ""_s)
+        .addSource(Utility::format(
+            "#define JOINT_COUNT {}\n"
+            "#define PER_VERTEX_JOINT_COUNT {}u\n"
+            "#define SECONDARY_PER_VERTEX_JOINT_COUNT {}u\n"
+            #ifndef MAGNUM_TARGET_GLES
+            "#define JOINT_MATRIX_INITIALIZER {}\n"
+            #endif
+            ,
+            configuration.jointCount(),
+            configuration.perVertexJointCount(),
+            configuration.secondaryPerVertexJointCount()
+            #ifndef MAGNUM_TARGET_GLES
+            , ("mat4(1.0), "_s*configuration.jointCount()).exceptSuffix(2)
+            #endif
+            ))
+        .addSource(rs.getString("generic.glsl"_s))
+        .addSource(rs.getString("Skinning.vert"_s))
+        .submitCompile();
+
+    /* Nothing gets rasterized, but ES requires a fragment shader to be
+       present in order to link */
+    GL::Shader frag{version, GL::Shader::Type::Fragment};
+    frag.addSource(rs.getString("compatibility.glsl"_s))
+        .addSource(rs.getString("generic.glsl"_s))
+        .addSource(rs.getString("Skinning.frag"_s))
+        .submitCompile();
+
+    SkinningGL out{NoInit};
+    out._flags = configuration.flags();
+    out._jointCount = configuration.jointCount();
+    out._perVertexJointCount = configuration.perVertexJointCount();
+    out._secondaryPerVertexJointCount = configuration.secondaryPerVertexJointCount();
+
+    out.attachShaders({vert, frag});
+
+    /* ES3 has this done in the shader directly */
+    #ifndef MAGNUM_TARGET_GLES
+    if(!context.isExtensionSupported<GL::Extensions::ARB::explicit_attrib_location>(version)) {
+        out.bindAttributeLocation(Position::Location, "position"_s);
+        if(configuration.flags() & Flag::Normal)
+            out.bindAttributeLocation(Normal::Location, "normal"_s);
+        if(configuration.flags() & Flag::Tangent4)
+            out.bindAttributeLocation(Tangent4::Location, "tangent"_s);
+        if(configuration.perVertexJointCount()) {
+            out.bindAttributeLocation(Weights::Location, "weights"_s);
+            out.bindAttributeLocation(JointIds::Location, "jointIds"_s);
+        }
+        if(configuration.secondaryPerVertexJointCount()) {
+            out.bindAttributeLocation(SecondaryWeights::Location, "secondaryWeights"_s);
+            out.bindAttributeLocation(SecondaryJointIds::Location, "secondaryJointIds"_s);
+        }
+    }
+    #endif
+
+    /* The output layout documented in the class docs */
+    Containers::StringView outputs[3]{"skinnedPosition"_s};
+    std::size_t outputCount = 1;
+    if(configuration.flags() & Flag::Normal)
+        outputs[outputCount++] = "skinnedNormal"_s;
+    if(configuration.flags() & Flag::Tangent4)
+        outputs[outputCount++] = "skinnedTangent"_s;
+    out.setTransformFeedbackOutputs(Containers::ArrayView<const Containers::StringView>{outputs, outputCount}, TransformFeedbackBufferMode::InterleavedAttributes);
+
+    out.submitLink();
+
+    return CompileState{Utility::move(out), Utility::move(vert), Utility::move(frag), version};
+}
+
+SkinningGL::SkinningGL(CompileState&& state): SkinningGL{static_cast<SkinningGL&&>(Utility::move(state))} {
+    #ifdef CORRADE_GRACEFUL_ASSERT
+    /* When graceful assertions fire from within compile(), we get a NoCreate'd
+       CompileState. Exiting makes it possible to test the assert. */
+    if(!id()) return;
+    #endif
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(checkLink({GL::Shader(state._vert), GL::Shader(state._frag)}));
+
+    #ifndef MAGNUM_TARGET_GLES
+    const GL::Context& context = GL::Context::current();
+    if(!context.isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>(state._version))
+    #elif !defined(MAGNUM_TARGET_WEBGL)
+    if(state._version < GL::Version::GLES310)
+    #endif
+    {
+        _jointMatricesUniform = uniformLocation("jointMatrices"_s);
+    }
+
+    /* Set defaults in OpenGL ES (for desktop they are set in shader code
+       itself) */
+    #ifdef MAGNUM_TARGET_GLES
+    setJointMatrices(Containers::Array<Matrix4>{DirectInit, _jointCount, Math::IdentityInit});
+    #endif
+}
+
+SkinningGL::SkinningGL(const Configuration& configuration): SkinningGL{compile(configuration)} {}
+
+SkinningGL::SkinningGL(NoInitT) {}
+
+SkinningGL& SkinningGL::setJointMatrices(const Containers::ArrayView<const Matrix4> matrices) {
+    CORRADE_ASSERT(matrices.size() <= _jointCount,
+        "Shaders::SkinningGL::setJointMatrices(): expected at most" << _jointCount << "items but got" << matrices.size(), *this);
+    setUniform(_jointMatricesUniform, matrices);
+    return *this;
+}
+
+SkinningGL& SkinningGL::setJointMatrices(const std::initializer_list<Matrix4> matrices) {
+    return setJointMatrices(Containers::arrayView(matrices));
+}
+
+SkinningGL& SkinningGL::setJointMatrix(const UnsignedInt id, const Matrix4& matrix) {
+    CORRADE_ASSERT(id < _jointCount,
+        "Shaders::SkinningGL::setJointMatrix(): joint ID" << id << "is out of range for" << _jointCount << "joints", *this);
+    setUniform(_jointMatricesUniform + id, matrix);
+    return *this;
+}
+
+SkinningGL& SkinningGL::skin(GL::Mesh& mesh, GL::TransformFeedback& transformFeedback) {
+    CORRADE_ASSERT(!mesh.isIndexed() && mesh.primitive() == GL::MeshPrimitive::Points,
+        "Shaders::SkinningGL::skin(): expected a non-indexed mesh with" << GL::MeshPrimitive::Points << "but got" << (mesh.isIndexed() ? "an indexed mesh with" : "a non-indexed mesh with") << mesh.primitive(), *this);
+
+    GL::Renderer::enable(GL::Renderer::Feature::RasterizerDiscard);
+    transformFeedback.begin(*this, GL::TransformFeedback::PrimitiveMode::Points);
+    draw(mesh);
+    transformFeedback.end();
+    GL::Renderer::disable(GL::Renderer::Feature::RasterizerDiscard);
+    return *this;
+}
+
+SkinningGL::Configuration& SkinningGL::Configuration::setJointCount(UnsignedInt count, UnsignedInt perVertexCount, UnsignedInt secondaryPerVertexCount) {
+    CORRADE_ASSERT(perVertexCount <= 4,
+        "Shaders::SkinningGL::Configuration::setJointCount(): expected at most 4 per-vertex joints, got" << perVertexCount, *this);
+    CORRADE_ASSERT(secondaryPerVertexCount <= 4,
+        "Shaders::SkinningGL::Configuration::setJointCount(): expected at most 4 secondary per-vertex joints, got" << secondaryPerVertexCount, *this);
+    CORRADE_ASSERT(perVertexCount || secondaryPerVertexCount || !count,
+        "Shaders::SkinningGL::Configuration::setJointCount(): count has to be zero if per-vertex joint count is zero", *this);
+    _jointCount = count;
+    _perVertexJointCount = perVertexCount;
+    _secondaryPerVertexJointCount = secondaryPerVertexCount;
+    return *this;
+}
+
+Debug& operator<<(Debug& debug, const SkinningGL::Flag value) {
+    debug << "Shaders::SkinningGL::Flag" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case SkinningGL::Flag::v: return debug << "::" #v;
+        _c(Normal)
+        _c(Tangent4)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const SkinningGL::Flags value) {
+    return Containers::enumSetDebugOutput(debug, value, "Shaders::SkinningGL::Flags{}", {
+        SkinningGL::Flag::Normal,
+        SkinningGL::Flag::Tangent4
+    });
+}
+
+}}
@@ -0,0 +1,394 @@
+#ifndef Magnum_Shaders_SkinningGL_h
+#define Magnum_Shaders_SkinningGL_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::SkinningGL
+ * @m_since_latest
+ */
+#endif
+
+#include <initializer_list>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/Shaders/GenericGL.h"
+#include "Magnum/Shaders/glShaderWrapper.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Vertex pre-skinning OpenGL shader
+@m_since_latest
+
+Skins mesh vertices once and captures the result into a buffer using
+@ref GL::TransformFeedback. Compared to skinning directly in
+@ref PhongGL, @ref FlatGL or @ref MeshVisualizerGL3D using
+@ref PhongGL::setJointMatrices() and friends, the skinning cost is paid only
+once per frame and not in every pass that draws the mesh, such as depth
+prepass, shadow map passes and the final color pass.
+
+@section Shaders-SkinningGL-usage Usage
+
+The input is a non-indexed @ref MeshPrimitive::Points mesh with the
+@ref Position, @ref JointIds and @ref Weights attributes and optionally also
+@ref SecondaryJointIds / @ref SecondaryWeights, @ref Normal and
+@ref Tangent4, with one point for each vertex. It can share vertex buffers with
+the mesh that's used for drawing. The @ref skin() function then writes
+skinned vertices into a buffer attached to a @ref GL::TransformFeedback at
+index @cpp 0 @ce, interleaved in the following order:
+
+-   @ref Magnum::Vector3 "Vector3" position
+-   @ref Magnum::Vector3 "Vector3" normal, if @ref Flag::Normal is enabled
+-   @ref Magnum::Vector4 "Vector4" tangent, if @ref Flag::Tangent4 is
+    enabled
+
+The output buffer can be then used as a vertex buffer for the mesh that gets
+drawn with a regular non-skinned shader:
+
+@snippet Shaders-gl.cpp SkinningGL-usage
+
+Normals and tangents are transformed with the upper 3x3 part of the skinning
+matrix and renormalized, which assumes the joint transformations don't
+contain non-uniform scaling.
+
+@requires_gl40 Extension @gl_extension{ARB,transform_feedback2}
+@requires_gles30 Transform feedback is not available in OpenGL ES 2.0.
+@requires_webgl20 Transform feedback is not available in WebGL 1.0.
+*/
+class MAGNUM_SHADERS_EXPORT SkinningGL: public GL::AbstractShaderProgram {
+    public:
+        class Configuration;
+        class CompileState;
+
+        /**
+         * @brief Vertex position
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @relativeref{Magnum,Vector3}.
+         */
+        typedef GenericGL3D::Position Position;
+
+        /**
+         * @brief Normal direction
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @relativeref{Magnum,Vector3}. Used only if @ref Flag::Normal is
+         * set.
+         */
+        typedef GenericGL3D::Normal Normal;
+
+        /**
+         * @brief Tangent direction with a bitangent sign
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @relativeref{Magnum,Vector4}. Used only if @ref Flag::Tangent4 is
+         * set.
+         */
+        typedef GenericGL3D::Tangent4 Tangent4;
+
+        /**
+         * @brief Joint ids
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @relativeref{Magnum,Vector4ui}. Used only if
+         * @ref perVertexJointCount() isn't @cpp 0 @ce.
+         */
+        typedef GenericGL3D::JointIds JointIds;
+
+        /**
+         * @brief Weights
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @relativeref{Magnum,Vector4}. Used only if
+         * @ref perVertexJointCount() isn't @cpp 0 @ce.
+         */
+        typedef GenericGL3D::Weights Weights;
+
+        /**
+         * @brief Secondary joint ids
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @relativeref{Magnum,Vector4ui}. Used only if
+         * @ref secondaryPerVertexJointCount() isn't @cpp 0 @ce.
+         */
+        typedef GenericGL3D::SecondaryJointIds SecondaryJointIds;
+
+        /**
+         * @brief Secondary weights
+         *
+         * @ref shaders-generic "Generic attribute",
+         * @relativeref{Magnum,Vector4}. Used only if
+         * @ref secondaryPerVertexJointCount() isn't @cpp 0 @ce.
+         */
+        typedef GenericGL3D::SecondaryWeights SecondaryWeights;
+
+        /**
+         * @brief Flag
+         *
+         * @see @ref Flags, @ref flags(), @ref Configuration::setFlags()
+         */
+        enum class Flag: UnsignedByte {
+            /** Skin also the @ref Normal attribute */
+            Normal = 1 << 0,
+
+            /** Skin also the @ref Tangent4 attribute */
+            Tangent4 = 1 << 1
+        };
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref flags(), @ref Configuration::setFlags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+
+        /**
+         * @brief Compile asynchronously
+         *
+         * Compared to @ref SkinningGL(const Configuration&) can perform an
+         * asynchronous compilation and linking. See @ref shaders-async for
+         * more information.
+         * @see @ref SkinningGL(CompileState&&)
+         */
+        static CompileState compile(const Configuration& configuration);
+
+        /**
+         * @brief Constructor
+         *
+         * Equivalent to calling @ref compile() followed by
+         * @ref SkinningGL(CompileState&&).
+         */
+        explicit SkinningGL(const Configuration& configuration);
+
+        /**
+         * @brief Finalize an asynchronous compilation
+         *
+         * Takes an asynchronous compilation state returned by @ref compile()
+         * and forms a ready-to-use shader object. See @ref shaders-async for
+         * more information.
+         */
+        explicit SkinningGL(CompileState&& state);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to a moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         * However note that this is a low-level and a potentially dangerous
+         * API, see the documentation of @ref NoCreate for alternatives.
+         */
+        explicit SkinningGL(NoCreateT) noexcept: AbstractShaderProgram{NoCreate} {}
+
+        /** @brief Copying is not allowed */
+        SkinningGL(const SkinningGL&) = delete;
+
+        /** @brief Move constructor */
+        SkinningGL(SkinningGL&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        SkinningGL& operator=(const SkinningGL&) = delete;
+
+        /** @brief Move assignment */
+        SkinningGL& operator=(SkinningGL&&) noexcept = default;
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref Configuration::setFlags()
+         */
+        Flags flags() const { return _flags; }
+
+        /**
+         * @brief Joint count
+         *
+         * @see @ref Configuration::setJointCount()
+         */
+        UnsignedInt jointCount() const { return _jointCount; }
+
+        /**
+         * @brief Per-vertex joint count
+         *
+         * @see @ref Configuration::setJointCount()
+         */
+        UnsignedInt perVertexJointCount() const { return _perVertexJointCount; }
+
+        /**
+         * @brief Secondary per-vertex joint count
+         *
+         * @see @ref Configuration::setJointCount()
+         */
+        UnsignedInt secondaryPerVertexJointCount() const { return _secondaryPerVertexJointCount; }
+
+        /**
+         * @brief Set joint matrices
+         * @return Reference to self (for method chaining)
+         *
+         * Initial values are identity transformations. Expects that the size
+         * of the @p matrices array is not larger than @ref jointCount().
+         * @see @ref setJointMatrix()
+         */
+        SkinningGL& setJointMatrices(Containers::ArrayView<const Matrix4> matrices);
+
+        /** @overload */
+        SkinningGL& setJointMatrices(std::initializer_list<Matrix4> matrices);
+
+        /**
+         * @brief Set joint matrix for given joint
+         * @return Reference to self (for method chaining)
+         *
+         * Unlike @ref setJointMatrices() updates just a single joint matrix.
+         * Expects that @p id is less than @ref jointCount().
+         */
+        SkinningGL& setJointMatrix(UnsignedInt id, const Matrix4& matrix);
+
+        /**
+         * @brief Skin a mesh
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p mesh is a non-indexed @ref MeshPrimitive::Points
+         * mesh. Enables @ref GL::Renderer::Feature::RasterizerDiscard,
+         * draws @p mesh with @p transformFeedback active and disables the
+         * feature again. See @ref Shaders-SkinningGL-usage for the output
+         * layout.
+         */
+        SkinningGL& skin(GL::Mesh& mesh, GL::TransformFeedback& transformFeedback);
+
+    private:
+        /* Creates the GL shader program object but does nothing else.
+           Internal, used by compile(). */
+        explicit SkinningGL(NoInitT);
+
+        /* Prevent accidentally calling irrelevant functions */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        using GL::AbstractShaderProgram::drawTransformFeedback;
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        using GL::AbstractShaderProgram::dispatchCompute;
+        #endif
+        #endif
+
+        Flags _flags;
+        UnsignedInt _jointCount{},
+            _perVertexJointCount{},
+            _secondaryPerVertexJointCount{};
+        Int _jointMatricesUniform{0};
+};
+
+CORRADE_ENUMSET_OPERATORS(SkinningGL::Flags)
+
+/**
+@brief Configuration
+@m_since_latest
+
+@see @ref SkinningGL(const Configuration&), @ref compile(const Configuration&)
+*/
+class SkinningGL::Configuration {
+    public:
+        explicit Configuration() = default;
+
+        /** @brief Flags */
+        Flags flags() const { return _flags; }
+
+        /**
+         * @brief Set flags
+         *
+         * No flags are set by default.
+         * @see @ref SkinningGL::flags()
+         */
+        Configuration& setFlags(Flags flags) {
+            _flags = flags;
+            return *this;
+        }
+
+        /** @brief Joint count */
+        UnsignedInt jointCount() const { return _jointCount; }
+
+        /** @brief Per-vertex joint count */
+        UnsignedInt perVertexJointCount() const { return _perVertexJointCount; }
+
+        /** @brief Secondary per-vertex joint count */
+        UnsignedInt secondaryPerVertexJointCount() const { return _secondaryPerVertexJointCount; }
+
+        /**
+         * @brief Set joint count
+         *
+         * The @p count describes an upper bound on how many joint matrices
+         * get supplied with @ref setJointMatrices() / @ref setJointMatrix().
+         * The @p perVertexCount and @p secondaryPerVertexCount parameters
+         * describe how many components are taken from @ref JointIds /
+         * @ref Weights and @ref SecondaryJointIds / @ref SecondaryWeights
+         * attributes, same as in @ref PhongGL::Configuration::setJointCount().
+         * Both are expected to be at most @cpp 4 @ce, and at least one of them
+         * together with @p count has to be non-zero when compiling the
+         * shader. Default value for all three is @cpp 0 @ce.
+         */
+        Configuration& setJointCount(UnsignedInt count, UnsignedInt perVertexCount, UnsignedInt secondaryPerVertexCount = 0);
+
+    private:
+        Flags _flags;
+        UnsignedInt _jointCount{},
+            _perVertexJointCount{},
+            _secondaryPerVertexJointCount{};
+};
+
+/**
+@brief Asynchronous compilation state
+@m_since_latest
+
+Returned by @ref compile(). See @ref shaders-async for more information.
+*/
+class SkinningGL::CompileState: public SkinningGL {
+    /* Everything deliberately private except for the inheritance */
+    friend class SkinningGL;
+
+    explicit CompileState(NoCreateT): SkinningGL{NoCreate}, _vert{NoCreate}, _frag{NoCreate} {}
+
+    explicit CompileState(SkinningGL&& shader, GL::Shader&& vert, GL::Shader&& frag, GL::Version version): SkinningGL{Utility::move(shader)}, _vert{Utility::move(vert)}, _frag{Utility::move(frag)}, _version{version} {}
+
+    Implementation::GLShaderWrapper _vert, _frag;
+    GL::Version _version;
+};
+
+/** @debugoperatorclassenum{SkinningGL,SkinningGL::Flag} */
+MAGNUM_SHADERS_EXPORT Debug& operator<<(Debug& debug, SkinningGL::Flag value);
+
+/** @debugoperatorclassenum{SkinningGL,SkinningGL::Flags} */
+MAGNUM_SHADERS_EXPORT Debug& operator<<(Debug& debug, SkinningGL::Flags value);
+
+}}
+#else
+#error this header is not available in the OpenGL ES 2.0 / WebGL 1.0 build
+#endif
+
+#endif
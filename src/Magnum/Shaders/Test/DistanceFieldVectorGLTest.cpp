@@ -124,6 +124,8 @@ struct DistanceFieldVectorGLTest: GL::OpenGLTester {
     template<DistanceFieldVectorGL2D::Flag flag = DistanceFieldVectorGL2D::Flag{}> void render2D();
     template<DistanceFieldVectorGL3D::Flag flag = DistanceFieldVectorGL3D::Flag{}> void render3D();
 
+    void renderMultiChannel2D();
+
     #ifndef MAGNUM_TARGET_GLES2
     void renderMulti2D();
     void renderMulti3D();
@@ -174,7 +176,8 @@ constexpr struct {
     DistanceFieldVectorGL2D::Flags flags;
 } ConstructData[]{
     {"", {}},
-    {"texture transformation", DistanceFieldVectorGL2D::Flag::TextureTransformation}
+    {"texture transformation", DistanceFieldVectorGL2D::Flag::TextureTransformation},
+    {"multi-channel", DistanceFieldVectorGL2D::Flag::MultiChannel}
 };
 
 #ifndef MAGNUM_TARGET_GLES2
@@ -186,6 +189,7 @@ constexpr struct {
     {"classic fallback", {}, 1, 1},
     {"", DistanceFieldVectorGL2D::Flag::UniformBuffers, 1, 1},
     {"texture transformation", DistanceFieldVectorGL2D::Flag::UniformBuffers|DistanceFieldVectorGL2D::Flag::TextureTransformation, 1, 1},
+    {"multi-channel", DistanceFieldVectorGL2D::Flag::UniformBuffers|DistanceFieldVectorGL2D::Flag::MultiChannel, 1, 1},
     /* SwiftShader has 256 uniform vectors at most, per-draw is 4+1 in 3D case
        and 3+1 in 2D, per-material 4 */
     {"multiple materials, draws", DistanceFieldVectorGL2D::Flag::UniformBuffers, 16, 48},
@@ -373,6 +377,10 @@ DistanceFieldVectorGLTest::DistanceFieldVectorGLTest() {
         &DistanceFieldVectorGLTest::renderSetup,
         &DistanceFieldVectorGLTest::renderTeardown);
 
+    addTests({&DistanceFieldVectorGLTest::renderMultiChannel2D},
+        &DistanceFieldVectorGLTest::renderSetup,
+        &DistanceFieldVectorGLTest::renderTeardown);
+
     #ifndef MAGNUM_TARGET_GLES2
     addInstancedTests({&DistanceFieldVectorGLTest::renderMulti2D,
                        &DistanceFieldVectorGLTest::renderMulti3D},
@@ -1134,6 +1142,70 @@ template<DistanceFieldVectorGL2D::Flag flag> void DistanceFieldVectorGLTest::ren
         (DebugTools::CompareImageToFile{_manager, maxThreshold, meanThreshold}));
 }
 
+void DistanceFieldVectorGLTest::renderMultiChannel2D() {
+    /* Like render2D() with the "smooth0.1" case, but with the single-channel
+       distance field replicated to three channels. As the median of three
+       equal values is the value itself, the output should be the same. */
+
+    if(!(_manager.loadState("AnyImageImporter") & PluginManager::LoadState::Loaded) ||
+       !(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("AnyImageImporter / TgaImporter plugins not found.");
+
+    GL::Mesh square = MeshTools::compile(Primitives::squareSolid(Primitives::SquareFlag::TextureCoordinates));
+
+    Containers::Pointer<Trade::AbstractImporter> importer = _manager.loadAndInstantiate("AnyImageImporter");
+    CORRADE_VERIFY(importer);
+
+    Containers::Optional<Trade::ImageData2D> image;
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(_testDir, "TestFiles/vector-distancefield.tga")) && (image = importer->image2D(0)));
+    CORRADE_COMPARE(image->format(), PixelFormat::R8Unorm);
+
+    Image2D imageRgba{PixelFormat::RGBA8Unorm, image->size(), Containers::Array<char>{NoInit, std::size_t(image->size().product()*4)}};
+    const Containers::StridedArrayView2D<const UnsignedByte> src = image->pixels<UnsignedByte>();
+    const Containers::StridedArrayView2D<Color4ub> dst = imageRgba.pixels<Color4ub>();
+    for(std::size_t y = 0; y != src.size()[0]; ++y)
+        for(std::size_t x = 0; x != src.size()[1]; ++x)
+            dst[y][x] = {src[y][x], src[y][x], src[y][x], 255};
+
+    GL::Texture2D texture;
+    texture.setMinificationFilter(GL::SamplerFilter::Linear)
+        .setMagnificationFilter(GL::SamplerFilter::Linear)
+        .setWrapping(GL::SamplerWrapping::ClampToEdge);
+    #ifdef MAGNUM_TARGET_GLES2
+    texture.setImage(0, GL::TextureFormat::RGBA, imageRgba);
+    #else
+    texture.setStorage(1, GL::TextureFormat::RGBA8, imageRgba.size())
+        .setSubImage(0, {}, imageRgba);
+    #endif
+
+    DistanceFieldVectorGL2D shader{DistanceFieldVectorGL2D::Configuration{}
+        .setFlags(DistanceFieldVectorGL2D::Flag::MultiChannel)};
+    shader.bindVectorTexture(texture)
+        .setTransformationProjectionMatrix(Matrix3::projection({2.1f, 2.1f}))
+        .setColor(0xffff99_rgbf)
+        .setOutlineColor(0x9999ff_rgbf)
+        .setOutlineRange(0.5f, 1.0f)
+        .setSmoothness(0.1f)
+        .draw(square);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Image2D rendered = _framebuffer.read(_framebuffer.viewport(), {PixelFormat::RGBA8Unorm});
+    /* Dropping the alpha channel, as it's always 1.0 */
+    Containers::StridedArrayView2D<Color3ub> pixels =
+        Containers::arrayCast<Color3ub>(rendered.pixels<Color4ub>());
+
+    /* Same as in render2D() */
+    #if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
+    const Float maxThreshold = 32.0f, meanThreshold = 0.942f;
+    #else
+    const Float maxThreshold = 32.0f, meanThreshold = 2.386f;
+    #endif
+    CORRADE_COMPARE_WITH(pixels,
+        Utility::Path::join({_testDir, "VectorTestFiles", "smooth0.1-2D.tga"}),
+        (DebugTools::CompareImageToFile{_manager, maxThreshold, meanThreshold}));
+}
+
 template<DistanceFieldVectorGL3D::Flag flag> void DistanceFieldVectorGLTest::render3D() {
     auto&& data = RenderData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
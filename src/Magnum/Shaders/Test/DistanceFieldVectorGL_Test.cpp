@@ -94,8 +94,8 @@ void DistanceFieldVectorGL_Test::debugFlag() {
 void DistanceFieldVectorGL_Test::debugFlags() {
     std::ostringstream out;
 
-    Debug{&out} << DistanceFieldVectorGL3D::Flags{DistanceFieldVectorGL3D::Flag::TextureTransformation|DistanceFieldVectorGL3D::Flag(0xf0)} << DistanceFieldVectorGL3D::Flags{};
-    CORRADE_COMPARE(out.str(), "Shaders::DistanceFieldVectorGL::Flag::TextureTransformation|Shaders::DistanceFieldVectorGL::Flag(0xf0) Shaders::DistanceFieldVectorGL::Flags{}\n");
+    Debug{&out} << DistanceFieldVectorGL3D::Flags{DistanceFieldVectorGL3D::Flag::TextureTransformation|DistanceFieldVectorGL3D::Flag::MultiChannel|DistanceFieldVectorGL3D::Flag(0xe0)} << DistanceFieldVectorGL3D::Flags{};
+    CORRADE_COMPARE(out.str(), "Shaders::DistanceFieldVectorGL::Flag::TextureTransformation|Shaders::DistanceFieldVectorGL::Flag::MultiChannel|Shaders::DistanceFieldVectorGL::Flag(0xe0) Shaders::DistanceFieldVectorGL::Flags{}\n");
 }
 
 #ifndef MAGNUM_TARGET_GLES2
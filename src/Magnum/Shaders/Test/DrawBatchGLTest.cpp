@@ -0,0 +1,292 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/MeshView.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Renderbuffer.h"
+#include "Magnum/GL/RenderbufferFormat.h"
+#include "Magnum/GL/Sampler.h"
+#include "Magnum/GL/StreamingBuffer.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Shaders/DrawBatchGL.h"
+#include "Magnum/Shaders/FlatGL.h"
+#include "Magnum/Shaders/PhongGL.h"
+
+namespace Magnum { namespace Shaders { namespace Test { namespace {
+
+struct DrawBatchGLTest: GL::OpenGLTester {
+    explicit DrawBatchGLTest();
+
+    void maxDrawCount();
+
+    void constructNoUniformBuffers();
+    void constructMove();
+
+    void addTextureTransformationMismatch();
+
+    void draw();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    FlatGL2D::Flags flags;
+} DrawData[]{
+    {"", FlatGL2D::Flag::UniformBuffers},
+    {"multidraw", FlatGL2D::Flag::MultiDraw},
+    {"texture transformation", FlatGL2D::Flag::UniformBuffers|FlatGL2D::Flag::Textured|FlatGL2D::Flag::TextureTransformation},
+    {"shader storage", FlatGL2D::Flag::ShaderStorageBuffers},
+};
+
+DrawBatchGLTest::DrawBatchGLTest() {
+    addTests({&DrawBatchGLTest::maxDrawCount,
+
+              &DrawBatchGLTest::constructNoUniformBuffers,
+              &DrawBatchGLTest::constructMove,
+
+              &DrawBatchGLTest::addTextureTransformationMismatch});
+
+    addInstancedTests({&DrawBatchGLTest::draw},
+        Containers::arraySize(DrawData));
+}
+
+void DrawBatchGLTest::maxDrawCount() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::uniform_buffer_object::string() << "is not supported.");
+    #endif
+
+    const std::size_t maxUniformBlockSize = GL::AbstractShaderProgram::maxUniformBlockSize();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* All per-draw arrays have to fit, but a single extra item shouldn't */
+    const std::size_t count = DrawBatchGL<PhongGL>::maxDrawCount();
+    CORRADE_VERIFY(count > 0);
+    CORRADE_COMPARE_AS(count*sizeof(TransformationUniform3D), maxUniformBlockSize, TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(count*sizeof(PhongDrawUniform), maxUniformBlockSize, TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(count*sizeof(TextureTransformationUniform), maxUniformBlockSize, TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS((count + 1)*Math::max({sizeof(TransformationUniform3D), sizeof(PhongDrawUniform), sizeof(TextureTransformationUniform)}), maxUniformBlockSize, TestSuite::Compare::Greater);
+}
+
+void DrawBatchGLTest::constructNoUniformBuffers() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FlatGL2D shader;
+    GL::StreamingBuffer buffer{GL::Buffer::TargetHint::Uniform, 1024};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    DrawBatchGL<FlatGL2D>{shader, buffer};
+    CORRADE_COMPARE(out.str(), "Shaders::DrawBatchGL: the shader was not created with uniform buffers enabled\n");
+}
+
+void DrawBatchGLTest::constructMove() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::uniform_buffer_object::string() << "is not supported.");
+    #endif
+
+    FlatGL2D shader{FlatGL2D::Configuration{}
+        .setFlags(FlatGL2D::Flag::UniformBuffers)
+        .setDrawCount(4)};
+    GL::StreamingBuffer buffer{GL::Buffer::TargetHint::Uniform, 1024};
+    GL::Mesh mesh;
+    GL::MeshView view{mesh};
+
+    DrawBatchGL<FlatGL2D> a{shader, buffer};
+    a.add(view, TransformationProjectionUniform2D{}, FlatDrawUniform{});
+
+    DrawBatchGL<FlatGL2D> b{Utility::move(a)};
+    CORRADE_COMPARE(&b.shader(), &shader);
+    CORRADE_COMPARE(&b.buffer(), &buffer);
+    CORRADE_COMPARE(b.batchSize(), 4);
+    CORRADE_COMPARE(b.drawCount(), 1);
+
+    FlatGL2D shader2{FlatGL2D::Configuration{}
+        .setFlags(FlatGL2D::Flag::UniformBuffers)
+        .setDrawCount(2)};
+    DrawBatchGL<FlatGL2D> c{shader2, buffer};
+    c = Utility::move(b);
+    CORRADE_COMPARE(&c.shader(), &shader);
+    CORRADE_COMPARE(c.drawCount(), 1);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<DrawBatchGL<FlatGL2D>>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<DrawBatchGL<FlatGL2D>>::value);
+}
+
+void DrawBatchGLTest::addTextureTransformationMismatch() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::uniform_buffer_object::string() << "is not supported.");
+    #endif
+
+    FlatGL2D shader{FlatGL2D::Configuration{}
+        .setFlags(FlatGL2D::Flag::UniformBuffers)};
+    FlatGL2D shaderTextureTransformation{FlatGL2D::Configuration{}
+        .setFlags(FlatGL2D::Flag::UniformBuffers|FlatGL2D::Flag::TextureTransformation|FlatGL2D::Flag::Textured)};
+    GL::StreamingBuffer buffer{GL::Buffer::TargetHint::Uniform, 1024};
+    GL::Mesh mesh;
+    GL::MeshView view{mesh};
+
+    DrawBatchGL<FlatGL2D> batch{shader, buffer};
+    DrawBatchGL<FlatGL2D> batchTextureTransformation{shaderTextureTransformation, buffer};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    batch.add(view, TransformationProjectionUniform2D{}, FlatDrawUniform{}, TextureTransformationUniform{});
+    batchTextureTransformation.add(view, TransformationProjectionUniform2D{}, FlatDrawUniform{});
+    CORRADE_COMPARE(out.str(),
+        "Shaders::DrawBatchGL::add(): the shader was not created with texture transformation enabled\n"
+        "Shaders::DrawBatchGL::add(): the shader was created with texture transformation enabled, a texture transformation has to be passed as well\n");
+}
+
+void DrawBatchGLTest::draw() {
+    auto&& data = DrawData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::uniform_buffer_object::string() << "is not supported.");
+    #endif
+
+    if(data.flags >= FlatGL2D::Flag::ShaderStorageBuffers) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shader_storage_buffer_object>())
+            CORRADE_SKIP(GL::Extensions::ARB::shader_storage_buffer_object::string() << "is not supported.");
+        #else
+        if(!GL::Context::current().isVersionSupported(GL::Version::GLES310))
+            CORRADE_SKIP(GL::Version::GLES310 << "is not supported.");
+        #endif
+    }
+
+    if(data.flags >= FlatGL2D::Flag::MultiDraw) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shader_draw_parameters>())
+            CORRADE_SKIP(GL::Extensions::ARB::shader_draw_parameters::string() << "is not supported.");
+        #else
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ANGLE::multi_draw>())
+            CORRADE_SKIP(GL::Extensions::ANGLE::multi_draw::string() << "is not supported.");
+        #endif
+    }
+
+    /* Three draws into a 4x1 framebuffer, each covering one pixel with a
+       different material. With a draw count of 2 it's split into two
+       batches, the last one padded. */
+    GL::Renderbuffer color;
+    color.setStorage(GL::RenderbufferFormat::RGBA8, {4, 1});
+    GL::Framebuffer framebuffer{{{}, {4, 1}}};
+    framebuffer.attachRenderbuffer(GL::Framebuffer::ColorAttachment{0}, color)
+        .clearColor(0, 0x000000ff_rgbaf)
+        .bind();
+
+    const Vector2 positions[]{
+        {-1.0f, -1.0f}, {1.0f, -1.0f}, {-1.0f, 1.0f}, {1.0f, 1.0f}
+    };
+    GL::Mesh mesh{GL::MeshPrimitive::TriangleStrip};
+    mesh.setCount(4)
+        .addVertexBuffer(GL::Buffer{positions}, 0, FlatGL2D::Position{});
+    GL::MeshView view{mesh};
+    view.setCount(4);
+
+    GL::Buffer materials{GL::Buffer::TargetHint::Uniform, {
+        FlatMaterialUniform{}.setColor(0xff0000ff_rgbaf),
+        FlatMaterialUniform{}.setColor(0x00ff00ff_rgbaf),
+        FlatMaterialUniform{}.setColor(0x0000ffff_rgbaf)
+    }};
+
+    FlatGL2D shader{FlatGL2D::Configuration{}
+        .setFlags(data.flags)
+        .setMaterialCount(3)
+        .setDrawCount(2)};
+    shader.bindMaterialBuffer(materials);
+
+    /* A white texture so the textured variant produces the same output */
+    GL::Texture2D texture{NoCreate};
+    if(data.flags & FlatGL2D::Flag::Textured) {
+        const Color4ub white[]{0xffffffff_rgba};
+        texture = GL::Texture2D{};
+        texture.setMinificationFilter(GL::SamplerFilter::Nearest)
+            .setMagnificationFilter(GL::SamplerFilter::Nearest)
+            .setStorage(1, GL::TextureFormat::RGBA8, {1, 1})
+            .setSubImage(0, {}, ImageView2D{PixelFormat::RGBA8Unorm, {1, 1}, white});
+        shader.bindTexture(texture);
+    }
+
+    GL::StreamingBuffer buffer{GL::Buffer::TargetHint::Uniform, 4096};
+    DrawBatchGL<FlatGL2D> batch{shader, buffer};
+    for(UnsignedInt i = 0; i != 3; ++i) {
+        const TransformationProjectionUniform2D transformation = TransformationProjectionUniform2D{}
+            .setTransformationProjectionMatrix(
+                Matrix3::translation(Vector2::xAxis(-0.75f + 0.5f*i))*
+                Matrix3::scaling({0.25f, 1.0f}));
+        const FlatDrawUniform draw = FlatDrawUniform{}.setMaterialId(i);
+        if(data.flags & FlatGL2D::Flag::TextureTransformation)
+            batch.add(view, transformation, draw, TextureTransformationUniform{});
+        else
+            batch.add(view, transformation, draw);
+    }
+    CORRADE_COMPARE(batch.drawCount(), 3);
+    CORRADE_COMPARE(batch.batchSize(), data.flags >= FlatGL2D::Flag::ShaderStorageBuffers ? 3 : 2);
+
+    batch.draw();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(batch.drawCount(), 0);
+
+    Image2D image = framebuffer.read({{}, {4, 1}}, {PixelFormat::RGBA8Unorm});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE_AS(image.pixels<Color4ub>()[0], Containers::arrayView<Color4ub>({
+        0xff0000ff_rgba,
+        0x00ff00ff_rgba,
+        0x0000ffff_rgba,
+        0x000000ff_rgba
+    }), TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::DrawBatchGLTest)
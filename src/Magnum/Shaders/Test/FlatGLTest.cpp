@@ -119,6 +119,13 @@ struct FlatGLTest: GL::OpenGLTester {
     #ifndef MAGNUM_TARGET_GLES2
     template<UnsignedInt dimensions> void bindTextureArraysInvalid();
     #endif
+    #ifndef MAGNUM_TARGET_GLES
+    template<UnsignedInt dimensions> void bindTextureHandleBufferNotEnabled();
+    template<UnsignedInt dimensions> void bindTexturesBindlessEnabled();
+    #endif
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    template<UnsignedInt dimensions> void bindVertexBufferNotEnabled();
+    #endif
     template<UnsignedInt dimensions> void setAlphaMaskNotEnabled();
     template<UnsignedInt dimensions> void setTextureMatrixNotEnabled();
     #ifndef MAGNUM_TARGET_GLES2
@@ -317,6 +324,12 @@ constexpr struct {
         1, 1, 32, 3, 2},
     {"skinning, dynamic per-vertex sets", FlatGL2D::Flag::UniformBuffers|FlatGL2D::Flag::DynamicPerVertexJointCount,
         1, 1, 32, 3, 4},
+    #ifndef MAGNUM_TARGET_GLES
+    {"bindless textures", FlatGL2D::Flag::UniformBuffers|FlatGL2D::Flag::Textured|FlatGL2D::Flag::BindlessTextures,
+        8, 48, 0, 0, 0},
+    {"bindless texture arrays + object ID texture", FlatGL2D::Flag::MultiDraw|FlatGL2D::Flag::Textured|FlatGL2D::Flag::ObjectIdTexture|FlatGL2D::Flag::TextureArrays|FlatGL2D::Flag::TextureTransformation|FlatGL2D::Flag::BindlessTextures,
+        8, 48, 0, 0, 0},
+    #endif
     {"multidraw with all the things except secondary per-vertex sets", FlatGL2D::Flag::MultiDraw|FlatGL2D::Flag::TextureTransformation|FlatGL2D::Flag::Textured|FlatGL2D::Flag::TextureArrays|FlatGL2D::Flag::AlphaMask|FlatGL2D::Flag::ObjectId|FlatGL2D::Flag::InstancedTextureOffset|FlatGL2D::Flag::InstancedTransformation|FlatGL2D::Flag::InstancedObjectId|FlatGL2D::Flag::DynamicPerVertexJointCount,
         8, 48, 16, 4, 0},
     {"multidraw with all the things except instancing", FlatGL2D::Flag::MultiDraw|FlatGL2D::Flag::TextureTransformation|FlatGL2D::Flag::Textured|FlatGL2D::Flag::TextureArrays|FlatGL2D::Flag::AlphaMask|FlatGL2D::Flag::ObjectId|FlatGL2D::Flag::DynamicPerVertexJointCount,
@@ -325,7 +338,9 @@ constexpr struct {
     {"shader storage + multidraw with all the things except secondary per-vertex sets", FlatGL2D::Flag::ShaderStorageBuffers|FlatGL2D::Flag::MultiDraw|FlatGL2D::Flag::TextureTransformation|FlatGL2D::Flag::Textured|FlatGL2D::Flag::TextureArrays|FlatGL2D::Flag::AlphaMask|FlatGL2D::Flag::ObjectId|FlatGL2D::Flag::InstancedTextureOffset|FlatGL2D::Flag::InstancedTransformation|FlatGL2D::Flag::InstancedObjectId|FlatGL2D::Flag::DynamicPerVertexJointCount,
         0, 0, 0, 4, 0},
     {"shader storage + multidraw with all the things except instancing", FlatGL2D::Flag::ShaderStorageBuffers|FlatGL2D::Flag::MultiDraw|FlatGL2D::Flag::TextureTransformation|FlatGL2D::Flag::Textured|FlatGL2D::Flag::TextureArrays|FlatGL2D::Flag::AlphaMask|FlatGL2D::Flag::ObjectId|FlatGL2D::Flag::DynamicPerVertexJointCount,
-        0, 0, 0, 3, 4}
+        0, 0, 0, 3, 4},
+    {"shader storage + multidraw + vertex pulling", FlatGL2D::Flag::ShaderStorageBuffers|FlatGL2D::Flag::MultiDraw|FlatGL2D::Flag::Textured|FlatGL2D::Flag::VertexColor|FlatGL2D::Flag::InstancedTransformation|FlatGL2D::Flag::VertexPulling,
+        0, 0, 0, 0, 0}
     #endif
 };
 #endif
@@ -360,7 +375,19 @@ constexpr struct {
     {"instancing together with secondary per-vertex sets",
         FlatGL2D::Flag::InstancedTransformation,
         10, 4, 1,
-        "TransformationMatrix attribute binding conflicts with the SecondaryJointIds / SecondaryWeights attributes, use a non-instanced rendering with secondary weights instead"}
+        "TransformationMatrix attribute binding conflicts with the SecondaryJointIds / SecondaryWeights attributes, use a non-instanced rendering with secondary weights instead"},
+    #endif
+    #ifndef MAGNUM_TARGET_GLES
+    {"bindless textures but no uniform buffers",
+        FlatGL2D::Flag::BindlessTextures|FlatGL2D::Flag::Textured,
+        0, 0, 0,
+        "bindless textures require uniform buffers to be enabled"},
+    #endif
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    {"vertex pulling but no shader storage buffers",
+        FlatGL2D::Flag::VertexPulling,
+        0, 0, 0,
+        "vertex pulling requires shader storage buffers to be enabled"},
     #endif
 };
 
@@ -392,6 +419,24 @@ constexpr struct {
     {"secondary per-vertex joint count but no joint count", FlatGL2D::Flag::UniformBuffers,
         0, 0, 3, 1, 1,
         "joint count can't be zero if per-vertex joint count is non-zero"},
+    #ifndef MAGNUM_TARGET_GLES
+    {"bindless textures but not textured",
+        /* ObjectId shares bits with ObjectIdTexture but should still trigger
+           the assert */
+        FlatGL2D::Flag::UniformBuffers|FlatGL2D::Flag::BindlessTextures|FlatGL2D::Flag::ObjectId,
+        0, 0, 0, 1, 1,
+        "bindless textures enabled but the shader is not textured"},
+    #endif
+    #ifndef MAGNUM_TARGET_WEBGL
+    {"vertex pulling but only uniform buffers",
+        FlatGL2D::Flag::UniformBuffers|FlatGL2D::Flag::VertexPulling,
+        0, 0, 0, 1, 1,
+        "vertex pulling requires shader storage buffers to be enabled"},
+    {"vertex pulling with skinning",
+        FlatGL2D::Flag::ShaderStorageBuffers|FlatGL2D::Flag::VertexPulling,
+        10, 4, 0, 1, 1,
+        "vertex pulling can't be used together with skinning"},
+    #endif
 };
 #endif
 
@@ -913,6 +958,20 @@ FlatGLTest::FlatGLTest() {
         Containers::arraySize(BindTextureArraysInvalidData));
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES
+    addTests<FlatGLTest>({
+        &FlatGLTest::bindTextureHandleBufferNotEnabled<2>,
+        &FlatGLTest::bindTextureHandleBufferNotEnabled<3>,
+        &FlatGLTest::bindTexturesBindlessEnabled<2>,
+        &FlatGLTest::bindTexturesBindlessEnabled<3>});
+    #endif
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    addTests<FlatGLTest>({
+        &FlatGLTest::bindVertexBufferNotEnabled<2>,
+        &FlatGLTest::bindVertexBufferNotEnabled<3>});
+    #endif
+
     addTests<FlatGLTest>({
         &FlatGLTest::setAlphaMaskNotEnabled<2>,
         &FlatGLTest::setAlphaMaskNotEnabled<3>,
@@ -1281,6 +1340,8 @@ template<UnsignedInt dimensions> void FlatGLTest::constructUniformBuffers() {
         CORRADE_SKIP(GL::Extensions::EXT::gpu_shader4::string() << "is not supported.");
     if((data.flags & FlatGL2D::Flag::TextureArrays) && !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
         CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() << "is not supported.");
+    if((data.flags & FlatGL2D::Flag::BindlessTextures) && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::bindless_texture>())
+        CORRADE_SKIP(GL::Extensions::ARB::bindless_texture::string() << "is not supported.");
     #endif
 
     #ifndef MAGNUM_TARGET_WEBGL
@@ -1641,6 +1702,65 @@ template<UnsignedInt dimensions> void FlatGLTest::bindTextureArraysInvalid() {
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+template<UnsignedInt dimensions> void FlatGLTest::bindTextureHandleBufferNotEnabled() {
+    setTestCaseTemplateName(Utility::format("{}", dimensions));
+
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    GL::Buffer buffer;
+    FlatGL<dimensions> shader;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    shader.bindTextureHandleBuffer(buffer)
+          .bindTextureHandleBuffer(buffer, 0, 16);
+    CORRADE_COMPARE(out.str(),
+        "Shaders::FlatGL::bindTextureHandleBuffer(): the shader was not created with bindless textures enabled\n"
+        "Shaders::FlatGL::bindTextureHandleBuffer(): the shader was not created with bindless textures enabled\n");
+}
+
+template<UnsignedInt dimensions> void FlatGLTest::bindTexturesBindlessEnabled() {
+    setTestCaseTemplateName(Utility::format("{}", dimensions));
+
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::bindless_texture>())
+        CORRADE_SKIP(GL::Extensions::ARB::bindless_texture::string() << "is not supported.");
+
+    GL::Texture2D texture;
+    FlatGL<dimensions> shader{typename FlatGL<dimensions>::Configuration{}
+        .setFlags(FlatGL<dimensions>::Flag::UniformBuffers|FlatGL<dimensions>::Flag::Textured|FlatGL<dimensions>::Flag::ObjectIdTexture|FlatGL<dimensions>::Flag::BindlessTextures)};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    shader.bindTexture(texture)
+          .bindObjectIdTexture(texture);
+    CORRADE_COMPARE(out.str(),
+        "Shaders::FlatGL::bindTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead\n"
+        "Shaders::FlatGL::bindObjectIdTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead\n");
+}
+#endif
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+template<UnsignedInt dimensions> void FlatGLTest::bindVertexBufferNotEnabled() {
+    setTestCaseTemplateName(Utility::format("{}", dimensions));
+
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    GL::Buffer buffer;
+    FlatGL<dimensions> shader;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    shader.bindVertexBuffer(buffer)
+          .bindVertexBuffer(buffer, 0, 16);
+    CORRADE_COMPARE(out.str(),
+        "Shaders::FlatGL::bindVertexBuffer(): the shader was not created with vertex pulling enabled\n"
+        "Shaders::FlatGL::bindVertexBuffer(): the shader was not created with vertex pulling enabled\n");
+}
+#endif
+
 template<UnsignedInt dimensions> void FlatGLTest::setAlphaMaskNotEnabled() {
     setTestCaseTemplateName(Utility::format("{}", dimensions));
 
@@ -44,6 +44,11 @@ struct FlatTest: TestSuite::Tester {
     void materialUniformConstructDefault();
     void materialUniformConstructNoInit();
     void materialUniformSetters();
+
+    void textureHandleUniformSizeAlignment();
+    void textureHandleUniformConstructDefault();
+    void textureHandleUniformConstructNoInit();
+    void textureHandleUniformSetters();
 };
 
 FlatTest::FlatTest() {
@@ -57,7 +62,12 @@ FlatTest::FlatTest() {
 
               &FlatTest::materialUniformConstructDefault,
               &FlatTest::materialUniformConstructNoInit,
-              &FlatTest::materialUniformSetters});
+              &FlatTest::materialUniformSetters,
+
+              &FlatTest::textureHandleUniformSizeAlignment,
+              &FlatTest::textureHandleUniformConstructDefault,
+              &FlatTest::textureHandleUniformConstructNoInit,
+              &FlatTest::textureHandleUniformSetters});
 }
 
 using namespace Math::Literals;
@@ -222,6 +232,67 @@ void FlatTest::materialUniformSetters() {
     CORRADE_COMPARE(a.alphaMask, 0.7f);
 }
 
+void FlatTest::textureHandleUniformSizeAlignment() {
+    /* Unlike other uniform structures this one consists of 64-bit handles,
+       so the alignment is 8 and not 4 */
+    CORRADE_COMPARE(sizeof(FlatTextureHandleUniform) % sizeof(Vector4), 0);
+    CORRADE_COMPARE(256 % sizeof(FlatTextureHandleUniform), 0);
+    CORRADE_COMPARE(alignof(FlatTextureHandleUniform), 8);
+}
+
+void FlatTest::textureHandleUniformConstructDefault() {
+    FlatTextureHandleUniform a;
+    FlatTextureHandleUniform b{DefaultInit};
+    CORRADE_COMPARE(a.texture, 0);
+    CORRADE_COMPARE(b.texture, 0);
+    CORRADE_COMPARE(a.objectIdTexture, 0);
+    CORRADE_COMPARE(b.objectIdTexture, 0);
+
+    constexpr FlatTextureHandleUniform ca;
+    constexpr FlatTextureHandleUniform cb{DefaultInit};
+    CORRADE_COMPARE(ca.texture, 0);
+    CORRADE_COMPARE(cb.texture, 0);
+    CORRADE_COMPARE(ca.objectIdTexture, 0);
+    CORRADE_COMPARE(cb.objectIdTexture, 0);
+
+    CORRADE_VERIFY(std::is_nothrow_default_constructible<FlatTextureHandleUniform>::value);
+    CORRADE_VERIFY(std::is_nothrow_constructible<FlatTextureHandleUniform, DefaultInitT>::value);
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<DefaultInitT, FlatTextureHandleUniform>::value);
+}
+
+void FlatTest::textureHandleUniformConstructNoInit() {
+    FlatTextureHandleUniform a;
+    a.texture = 0x100000001ull;
+    a.objectIdTexture = 0x200000002ull;
+
+    new(&a) FlatTextureHandleUniform{NoInit};
+    {
+        /* Explicitly check we're not on Clang because certain Clang-based IDEs
+           inherit __GNUC__ if GCC is used instead of leaving it at 4 like
+           Clang itself does */
+        #if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG) && __GNUC__*100 + __GNUC_MINOR__ >= 601 && __OPTIMIZE__
+        CORRADE_EXPECT_FAIL("GCC 6.1+ misoptimizes and overwrites the value.");
+        #endif
+        CORRADE_COMPARE(a.texture, 0x100000001ull);
+        CORRADE_COMPARE(a.objectIdTexture, 0x200000002ull);
+    }
+
+    CORRADE_VERIFY(std::is_nothrow_constructible<FlatTextureHandleUniform, NoInitT>::value);
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<NoInitT, FlatTextureHandleUniform>::value);
+}
+
+void FlatTest::textureHandleUniformSetters() {
+    FlatTextureHandleUniform a;
+    a.setTexture(0x100000001ull)
+     .setObjectIdTexture(0x200000002ull);
+    CORRADE_COMPARE(a.texture, 0x100000001ull);
+    CORRADE_COMPARE(a.objectIdTexture, 0x200000002ull);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Shaders::Test::FlatTest)
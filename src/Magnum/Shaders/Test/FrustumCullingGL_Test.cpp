@@ -0,0 +1,87 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Shaders/FrustumCullingGL.h"
+
+namespace Magnum { namespace Shaders { namespace Test { namespace {
+
+/* There's an underscore between GL and Test to disambiguate from GLTest, which
+   is a common suffix used to mark tests that need a GL context. Ugly, I know. */
+struct FrustumCullingGL_Test: TestSuite::Tester {
+    explicit FrustumCullingGL_Test();
+
+    void constructNoCreate();
+    void constructCopy();
+
+    void debugFlag();
+    void debugFlags();
+};
+
+FrustumCullingGL_Test::FrustumCullingGL_Test() {
+    addTests({&FrustumCullingGL_Test::constructNoCreate,
+              &FrustumCullingGL_Test::constructCopy,
+
+              &FrustumCullingGL_Test::debugFlag,
+              &FrustumCullingGL_Test::debugFlags});
+}
+
+void FrustumCullingGL_Test::constructNoCreate() {
+    {
+        FrustumCullingGL shader{NoCreate};
+        CORRADE_COMPARE(shader.id(), 0);
+        CORRADE_COMPARE(shader.flags(), FrustumCullingGL::Flags{});
+    }
+
+    CORRADE_VERIFY(true);
+}
+
+void FrustumCullingGL_Test::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<FrustumCullingGL>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<FrustumCullingGL>{});
+}
+
+void FrustumCullingGL_Test::debugFlag() {
+    std::ostringstream out;
+
+    Debug{&out} << FrustumCullingGL::Flag::HierarchicalZ << FrustumCullingGL::Flag(0xf0);
+    CORRADE_COMPARE(out.str(), "Shaders::FrustumCullingGL::Flag::HierarchicalZ Shaders::FrustumCullingGL::Flag(0xf0)\n");
+}
+
+void FrustumCullingGL_Test::debugFlags() {
+    std::ostringstream out;
+
+    Debug{&out} << (FrustumCullingGL::Flag::HierarchicalZ|FrustumCullingGL::Flag(0xf0)) << FrustumCullingGL::Flags{};
+    CORRADE_COMPARE(out.str(), "Shaders::FrustumCullingGL::Flag::HierarchicalZ|Shaders::FrustumCullingGL::Flag(0xf0) Shaders::FrustumCullingGL::Flags{}\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::FrustumCullingGL_Test)
@@ -0,0 +1,305 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Shaders/LightClusterGrid.h"
+
+namespace Magnum { namespace Shaders { namespace Test { namespace {
+
+struct LightClusterGridTest: TestSuite::Tester {
+    explicit LightClusterGridTest();
+
+    void construct();
+    void constructInvalidSize();
+    void constructInvalidViewportSize();
+    void constructInvalidProjection();
+    void constructMove();
+
+    void clusterBounds();
+
+    void assign();
+    void assignOutsideView();
+    void assignEmpty();
+    void assignReassign();
+    void assignInvalidSize();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    Matrix4 projection;
+} ConstructInvalidProjectionData[]{
+    {"orthographic", Matrix4::orthographicProjection({4.0f, 4.0f}, 0.5f, 50.0f)},
+    {"infinite far plane", Matrix4::perspectiveProjection(90.0_degf, 1.0f, 0.5f, Constants::inf())},
+};
+
+LightClusterGridTest::LightClusterGridTest() {
+    addTests({&LightClusterGridTest::construct,
+              &LightClusterGridTest::constructInvalidSize,
+              &LightClusterGridTest::constructInvalidViewportSize});
+
+    addInstancedTests({&LightClusterGridTest::constructInvalidProjection},
+        Containers::arraySize(ConstructInvalidProjectionData));
+
+    addTests({&LightClusterGridTest::constructMove,
+
+              &LightClusterGridTest::clusterBounds,
+
+              &LightClusterGridTest::assign,
+              &LightClusterGridTest::assignOutsideView,
+              &LightClusterGridTest::assignEmpty,
+              &LightClusterGridTest::assignReassign,
+              &LightClusterGridTest::assignInvalidSize});
+}
+
+/* 90° field of view with a square aspect ratio makes the cluster bounds easy
+   to calculate by hand */
+const Matrix4 Projection = Matrix4::perspectiveProjection(90.0_degf, 1.0f, 0.5f, 50.0f);
+
+void LightClusterGridTest::construct() {
+    LightClusterGrid grid{{4, 4, 8}, {400, 200}, Projection};
+    CORRADE_COMPARE(grid.size(), (Vector3ui{4, 4, 8}));
+    CORRADE_COMPARE(grid.clusterCount(), 128);
+    CORRADE_COMPARE(grid.viewportSize(), (Vector2i{400, 200}));
+    CORRADE_COMPARE(grid.near(), 0.5f);
+    CORRADE_COMPARE(grid.far(), 50.0f);
+    CORRADE_COMPARE(grid.clusterBounds().size(), 128);
+
+    CORRADE_COMPARE(grid.gridUniform().size, (Vector3ui{4, 4, 8}));
+    CORRADE_COMPARE(grid.gridUniform().tileSize, (Vector2{100.0f, 50.0f}));
+    CORRADE_COMPARE(grid.gridUniform().depthScale, 8.0f/Math::log(100.0f));
+    CORRADE_COMPARE(grid.gridUniform().depthBias, 8.0f*Math::log(0.5f)/Math::log(100.0f));
+
+    /* The cluster data starts with the grid uniform, followed by a zero
+       offset and count for every cluster */
+    CORRADE_COMPARE(grid.clusterData().size(), sizeof(PhongLightClusterGridUniform) + 128*sizeof(Vector2ui));
+    const auto& header = *reinterpret_cast<const PhongLightClusterGridUniform*>(grid.clusterData().data());
+    CORRADE_COMPARE(header.size, (Vector3ui{4, 4, 8}));
+    CORRADE_COMPARE(header.tileSize, (Vector2{100.0f, 50.0f}));
+    CORRADE_COMPARE(header.depthScale, grid.gridUniform().depthScale);
+    CORRADE_COMPARE(header.depthBias, grid.gridUniform().depthBias);
+    CORRADE_COMPARE(grid.clusters().size(), 128);
+    CORRADE_COMPARE(static_cast<const void*>(grid.clusters().data()), grid.clusterData().data() + sizeof(PhongLightClusterGridUniform));
+    for(const Vector2ui& cluster: grid.clusters())
+        CORRADE_COMPARE(cluster, Vector2ui{});
+
+    /* There's always at least one index */
+    CORRADE_COMPARE_AS(grid.lightIndices(), Containers::arrayView({0u}),
+        TestSuite::Compare::Container);
+}
+
+void LightClusterGridTest::constructInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    LightClusterGrid{{4, 0, 8}, {400, 200}, Projection};
+    CORRADE_COMPARE(out.str(), "Shaders::LightClusterGrid: expected a non-zero grid size, got {4, 0, 8}\n");
+}
+
+void LightClusterGridTest::constructInvalidViewportSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    LightClusterGrid{{4, 4, 8}, {0, 200}, Projection};
+    CORRADE_COMPARE(out.str(), "Shaders::LightClusterGrid: expected a non-zero viewport size, got {0, 200}\n");
+}
+
+void LightClusterGridTest::constructInvalidProjection() {
+    auto&& data = ConstructInvalidProjectionData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    LightClusterGrid{{4, 4, 8}, {400, 200}, data.projection};
+    CORRADE_COMPARE(out.str(), "Shaders::LightClusterGrid: expected a perspective projection with a finite far plane\n");
+}
+
+void LightClusterGridTest::constructMove() {
+    LightClusterGrid a{{4, 4, 8}, {400, 200}, Projection};
+    const Range3D* bounds = a.clusterBounds().data();
+
+    LightClusterGrid b{Utility::move(a)};
+    CORRADE_COMPARE(b.size(), (Vector3ui{4, 4, 8}));
+    CORRADE_COMPARE(b.clusterBounds().data(), bounds);
+
+    LightClusterGrid c{{1, 1, 1}, {10, 10}, Projection};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.size(), (Vector3ui{4, 4, 8}));
+    CORRADE_COMPARE(c.clusterBounds().data(), bounds);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<LightClusterGrid>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<LightClusterGrid>::value);
+}
+
+void LightClusterGridTest::clusterBounds() {
+    LightClusterGrid grid{{4, 4, 8}, {400, 400}, Projection};
+
+    /* With 90° FoV, at depth d the frustum spans [-d, d] in X and Y. Slice
+       boundaries are at 0.5*100^(z/8). */
+    const Float d0 = 0.5f;
+    const Float d1 = 0.5f*Math::pow(100.0f, 1.0f/8.0f);
+    const Float d7 = 0.5f*Math::pow(100.0f, 7.0f/8.0f);
+    const Float d8 = 50.0f;
+
+    /* Bottom left, nearest */
+    CORRADE_COMPARE(grid.clusterBounds()[0], (Range3D{
+        {-d1, -d1, -d1},
+        {-0.5f*d0, -0.5f*d0, -d0}}));
+
+    /* Top right, farthest */
+    CORRADE_COMPARE(grid.clusterBounds()[127], (Range3D{
+        {0.5f*d7, 0.5f*d7, -d8},
+        {d8, d8, -d7}}));
+
+    /* Second column, second row, nearest, touches the center */
+    CORRADE_COMPARE(grid.clusterBounds()[5], (Range3D{
+        {-0.5f*d1, -0.5f*d1, -d1},
+        {0.0f, 0.0f, -d0}}));
+}
+
+void LightClusterGridTest::assign() {
+    LightClusterGrid grid{{4, 4, 8}, {400, 400}, Projection};
+
+    PhongLightUniform lights[3];
+    /* Behind the camera, not assigned anywhere */
+    lights[0].setPosition({0.0f, 0.0f, 5.0f, 1.0f})
+             .setRange(1.0f);
+    /* In the center at depth 3, which is in slice 3 spanning from ~2.81 to
+       5. Touches the four center tiles. */
+    lights[1].setPosition({0.0f, 0.0f, -3.0f, 1.0f})
+             .setRange(0.1f);
+    /* Directional, assigned everywhere */
+    lights[2].setPosition({0.0f, 0.0f, 1.0f, 0.0f});
+
+    grid.assign(lights);
+
+    /* 128 clusters for the directional light, 4 for the point light */
+    CORRADE_COMPARE(grid.lightIndices().size(), 132);
+
+    /* Clusters before the first affected by the point light have just the
+       directional light */
+    for(UnsignedInt i = 0; i != 53; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(grid.clusters()[i], (Vector2ui{i, 1}));
+        CORRADE_COMPARE(grid.lightIndices()[i], 2);
+    }
+
+    /* Clusters {1, 1, 3}, {2, 1, 3}, {1, 2, 3} and {2, 2, 3} have both,
+       sorted by light index */
+    CORRADE_COMPARE(grid.clusters()[53], (Vector2ui{53, 2}));
+    CORRADE_COMPARE(grid.clusters()[54], (Vector2ui{55, 2}));
+    CORRADE_COMPARE(grid.clusters()[55], (Vector2ui{57, 1}));
+    CORRADE_COMPARE(grid.clusters()[56], (Vector2ui{58, 1}));
+    CORRADE_COMPARE(grid.clusters()[57], (Vector2ui{59, 2}));
+    CORRADE_COMPARE(grid.clusters()[58], (Vector2ui{61, 2}));
+    CORRADE_COMPARE(grid.clusters()[59], (Vector2ui{63, 1}));
+    CORRADE_COMPARE(grid.clusters()[127], (Vector2ui{131, 1}));
+    CORRADE_COMPARE_AS(grid.lightIndices().slice(53, 63), Containers::arrayView<UnsignedInt>({
+        1, 2,
+        1, 2,
+        2,
+        2,
+        1, 2,
+        1, 2
+    }), TestSuite::Compare::Container);
+}
+
+void LightClusterGridTest::assignOutsideView() {
+    LightClusterGrid grid{{4, 4, 8}, {400, 400}, Projection};
+
+    const Vector4 positions[]{
+        /* Right of the frustum */
+        {10.0f, 0.0f, -3.0f, 1.0f},
+        /* Beyond the far plane */
+        {0.0f, 0.0f, -60.0f, 1.0f},
+        /* In front of the near plane */
+        {0.0f, 0.0f, -0.2f, 1.0f},
+    };
+    const Float ranges[]{0.1f, 5.0f, 0.1f};
+    grid.assign(positions, ranges);
+
+    for(const Vector2ui& cluster: grid.clusters())
+        CORRADE_COMPARE(cluster.y(), 0);
+    CORRADE_COMPARE_AS(grid.lightIndices(), Containers::arrayView({0u}),
+        TestSuite::Compare::Container);
+}
+
+void LightClusterGridTest::assignEmpty() {
+    LightClusterGrid grid{{4, 4, 8}, {400, 400}, Projection};
+    grid.assign(Containers::ArrayView<const PhongLightUniform>{});
+
+    for(const Vector2ui& cluster: grid.clusters())
+        CORRADE_COMPARE(cluster, Vector2ui{});
+    CORRADE_COMPARE_AS(grid.lightIndices(), Containers::arrayView({0u}),
+        TestSuite::Compare::Container);
+}
+
+void LightClusterGridTest::assignReassign() {
+    LightClusterGrid grid{{2, 2, 2}, {400, 400}, Projection};
+
+    /* A light covering the whole frustum, infinite range */
+    PhongLightUniform lights[2];
+    lights[0].setPosition({0.0f, 0.0f, -3.0f, 1.0f});
+    lights[1].setPosition({0.0f, 0.0f, -3.0f, 1.0f});
+    grid.assign(lights);
+    CORRADE_COMPARE(grid.lightIndices().size(), 16);
+    CORRADE_COMPARE(grid.clusters()[7], (Vector2ui{14, 2}));
+
+    /* Assigning again replaces the previous contents */
+    grid.assign(Containers::arrayView(lights).prefix(1));
+    CORRADE_COMPARE(grid.lightIndices().size(), 8);
+    CORRADE_COMPARE(grid.clusters()[7], (Vector2ui{7, 1}));
+}
+
+void LightClusterGridTest::assignInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    LightClusterGrid grid{{4, 4, 8}, {400, 400}, Projection};
+
+    const Vector4 positions[3]{};
+    const Float ranges[2]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    grid.assign(positions, ranges);
+    CORRADE_COMPARE(out.str(), "Shaders::LightClusterGrid::assign(): expected position and range views to have the same size, got 3 and 2\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::LightClusterGridTest)
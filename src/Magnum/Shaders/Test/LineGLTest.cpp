@@ -62,6 +62,11 @@
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/MeshData.h"
 
+#ifndef MAGNUM_TARGET_WEBGL
+#include "Magnum/GL/BufferTexture.h"
+#include "Magnum/GL/BufferTextureFormat.h"
+#endif
+
 #include "configure.h"
 
 namespace Magnum { namespace Shaders { namespace Test { namespace {
@@ -77,8 +82,9 @@ struct LineGLTest: GL::OpenGLTester {
     template<UnsignedInt dimensions> void constructMove();
     template<UnsignedInt dimensions> void constructMoveUniformBuffers();
 
-    /* No constructInvalid() as there isn't any assertion in the constructor
-       that wouldn't be related to UBOs */
+    #ifndef MAGNUM_TARGET_WEBGL
+    template<UnsignedInt dimensions> void constructVertexPullingInvalid();
+    #endif
     template<UnsignedInt dimensions> void constructUniformBuffersInvalid();
 
     template<UnsignedInt dimensions> void setUniformUniformBuffersEnabled();
@@ -87,6 +93,9 @@ struct LineGLTest: GL::OpenGLTester {
     template<UnsignedInt dimensions> void setMiterAngleLimitInvalid();
     template<UnsignedInt dimensions> void setObjectIdNotEnabled();
     template<UnsignedInt dimensions> void setWrongDrawOffset();
+    #ifndef MAGNUM_TARGET_WEBGL
+    template<UnsignedInt dimensions> void bindVertexPullingTextureNotEnabled();
+    #endif
 
     void renderSetupLarge();
     void renderSetupSmall();
@@ -116,6 +125,10 @@ struct LineGLTest: GL::OpenGLTester {
     void renderMulti2D();
     void renderMulti3D();
 
+    #ifndef MAGNUM_TARGET_WEBGL
+    void renderVertexPulling2D();
+    #endif
+
     private:
         PluginManager::Manager<Trade::AbstractImporter> _manager{"nonexistent"};
 
@@ -411,6 +424,12 @@ LineGLTest::LineGLTest() {
         &LineGLTest::constructMoveUniformBuffers<2>,
         &LineGLTest::constructMoveUniformBuffers<3>});
 
+    #ifndef MAGNUM_TARGET_WEBGL
+    addTests<LineGLTest>({
+        &LineGLTest::constructVertexPullingInvalid<2>,
+        &LineGLTest::constructVertexPullingInvalid<3>});
+    #endif
+
     addInstancedTests<LineGLTest>({
         &LineGLTest::constructUniformBuffersInvalid<2>,
         &LineGLTest::constructUniformBuffersInvalid<3>},
@@ -436,7 +455,12 @@ LineGLTest::LineGLTest() {
         &LineGLTest::setObjectIdNotEnabled<2>,
         &LineGLTest::setObjectIdNotEnabled<3>,
         &LineGLTest::setWrongDrawOffset<2>,
-        &LineGLTest::setWrongDrawOffset<3>});
+        &LineGLTest::setWrongDrawOffset<3>,
+        #ifndef MAGNUM_TARGET_WEBGL
+        &LineGLTest::bindVertexPullingTextureNotEnabled<2>,
+        &LineGLTest::bindVertexPullingTextureNotEnabled<3>
+        #endif
+        });
 
     /* MSVC needs explicit type due to default template args */
     addTests<LineGLTest>({
@@ -549,6 +573,12 @@ LineGLTest::LineGLTest() {
         &LineGLTest::renderSetupSmall,
         &LineGLTest::renderTeardown);
 
+    #ifndef MAGNUM_TARGET_WEBGL
+    addTests({&LineGLTest::renderVertexPulling2D},
+        &LineGLTest::renderSetupSmall,
+        &LineGLTest::renderTeardown);
+    #endif
+
     /* Load the plugins directly from the build tree. Otherwise they're either
        static and already loaded or not present in the build tree */
     #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
@@ -786,6 +816,21 @@ template<UnsignedInt dimensions> void LineGLTest::constructMoveUniformBuffers()
     CORRADE_VERIFY(!b.id());
 }
 
+#ifndef MAGNUM_TARGET_WEBGL
+template<UnsignedInt dimensions> void LineGLTest::constructVertexPullingInvalid() {
+    setTestCaseTemplateName(Utility::format("{}", dimensions));
+
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    LineGL<dimensions>{typename LineGL<dimensions>::Configuration{}
+        .setFlags(LineGL<dimensions>::Flag::VertexPulling|LineGL<dimensions>::Flag::VertexColor)};
+    CORRADE_COMPARE(out.str(),
+        "Shaders::LineGL: vertex pulling can't be combined with vertex colors\n");
+}
+#endif
+
 template<UnsignedInt dimensions> void LineGLTest::constructUniformBuffersInvalid() {
     auto&& data = ConstructUniformBuffersInvalidData[testCaseInstanceId()];
     setTestCaseTemplateName(Utility::format("{}", dimensions));
@@ -970,6 +1015,28 @@ template<UnsignedInt dimensions> void LineGLTest::setWrongDrawOffset() {
         "Shaders::LineGL::setDrawOffset(): draw offset 5 is out of range for 5 draws\n");
 }
 
+#ifndef MAGNUM_TARGET_WEBGL
+template<UnsignedInt dimensions> void LineGLTest::bindVertexPullingTextureNotEnabled() {
+    setTestCaseTemplateName(Utility::format("{}", dimensions));
+
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::gpu_shader4>())
+        CORRADE_SKIP(GL::Extensions::EXT::gpu_shader4::string() << "is not supported.");
+    #endif
+
+    LineGL<dimensions> shader;
+    GL::BufferTexture texture;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    shader.bindVertexPullingPositionTexture(texture);
+    CORRADE_COMPARE(out.str(),
+        "Shaders::LineGL::bindVertexPullingPositionTexture(): the shader was not created with vertex pulling enabled\n");
+}
+#endif
+
 constexpr Vector2i RenderSizeLarge{128, 128};
 
 void LineGLTest::renderSetupLarge() {
@@ -3108,6 +3175,72 @@ void LineGLTest::renderMulti3D() {
     }
 }
 
+#ifndef MAGNUM_TARGET_WEBGL
+void LineGLTest::renderVertexPulling2D() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isVersionSupported(GL::Version::GL310))
+        CORRADE_SKIP(GL::Version::GL310 << "is not supported.");
+    #else
+    if(!GL::Context::current().isVersionSupported(GL::Version::GLES320))
+        CORRADE_SKIP(GL::Version::GLES320 << "is not supported.");
+    #endif
+
+    /* A line strip with sharp and shallow joins, both ends capped */
+    const Vector2 points[]{
+        {-0.8f, -0.6f},
+        {-0.4f, 0.5f},
+        {0.0f, -0.5f},
+        {0.4f, -0.3f},
+        {0.7f, 0.6f}
+    };
+
+    /* Reference rendering with the line expanded on the CPU, neighboring
+       segments sharing an endpoint get joined */
+    Vector2 segments[2*(Containers::arraySize(points) - 1)];
+    for(std::size_t i = 0; i != Containers::arraySize(points) - 1; ++i) {
+        segments[i*2 + 0] = points[i];
+        segments[i*2 + 1] = points[i + 1];
+    }
+    GL::Mesh lines = generateLineMesh<2>(segments);
+
+    LineGL2D shader;
+    shader.setViewportSize(Vector2{RenderSizeSmall})
+        .setWidth(6.0f)
+        .setSmoothness(1.0f)
+        .draw(lines);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Image2D expected = _framebuffer.read(_framebuffer.viewport(), {PixelFormat::RGBA8Unorm});
+
+    /* Same line expanded on the GPU from just the points */
+    _framebuffer.clear(GL::FramebufferClear::Color);
+
+    GL::Buffer pointBuffer{points};
+    GL::BufferTexture pointTexture;
+    pointTexture.setBuffer(GL::BufferTextureFormat::RG32F, pointBuffer);
+
+    GL::Mesh mesh;
+    mesh.setCount(12*(Containers::arraySize(points) - 1));
+
+    LineGL2D vertexPullingShader{LineGL2D::Configuration{}
+        .setFlags(LineGL2D::Flag::VertexPulling)};
+    vertexPullingShader.setViewportSize(Vector2{RenderSizeSmall})
+        .setWidth(6.0f)
+        .setSmoothness(1.0f)
+        .bindVertexPullingPositionTexture(pointTexture)
+        .draw(mesh);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    Image2D actual = _framebuffer.read(_framebuffer.viewport(), {PixelFormat::RGBA8Unorm});
+
+    /* The inputs are bit-exact, so should be the output */
+    CORRADE_COMPARE_WITH(actual, expected,
+        (DebugTools::CompareImage{0.0f, 0.0f}));
+}
+#endif
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Shaders::Test::LineGLTest)
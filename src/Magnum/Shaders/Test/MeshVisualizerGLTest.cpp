@@ -87,6 +87,10 @@
 #include "Magnum/Shaders/MeshVisualizer.h"
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/GL/BufferTexture.h"
+#endif
+
 #include "configure.h"
 
 namespace Magnum { namespace Shaders { namespace Test { namespace {
@@ -157,6 +161,7 @@ struct MeshVisualizerGLTest: GL::OpenGLTester {
     #endif
     #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
     void setTangentBitangentNormalNotEnabled3D();
+    void bindVertexPullingTexturesNotEnabled3D();
     #endif
     #ifndef MAGNUM_TARGET_GLES2
     void setWrongJointCountOrId2D();
@@ -615,6 +620,14 @@ constexpr struct {
         MeshVisualizerGL3D::Flag::BitangentDirection|MeshVisualizerGL3D::Flag::InstancedObjectId,
         0, 0, 0,
         "3D: Bitangent attribute binding conflicts with the ObjectId attribute, use a Tangent4 attribute with instanced object ID rendering instead"},
+    {"vertex pulling with object ID texture",
+        MeshVisualizerGL3D::Flag::Wireframe|MeshVisualizerGL3D::Flag::VertexPulling|MeshVisualizerGL3D::Flag::ObjectIdTexture,
+        0, 0, 0,
+        "3D: vertex pulling can't be combined with object ID textures or skinning"},
+    {"vertex pulling with skinning",
+        MeshVisualizerGL3D::Flag::Wireframe|MeshVisualizerGL3D::Flag::VertexPulling,
+        10, 4, 0,
+        "3D: vertex pulling can't be combined with object ID textures or skinning"},
     #endif
     #ifndef MAGNUM_TARGET_GLES2
     {"dynamic per-vertex joint count but no static per-vertex joint count",
@@ -1515,6 +1528,7 @@ MeshVisualizerGLTest::MeshVisualizerGLTest() {
         #endif
         #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
         &MeshVisualizerGLTest::setTangentBitangentNormalNotEnabled3D,
+        &MeshVisualizerGLTest::bindVertexPullingTexturesNotEnabled3D,
         #endif
         #ifndef MAGNUM_TARGET_GLES2
         &MeshVisualizerGLTest::setWrongJointCountOrId2D,
@@ -3064,6 +3078,23 @@ void MeshVisualizerGLTest::setTangentBitangentNormalNotEnabled3D() {
         "Shaders::MeshVisualizerGL3D::setLineWidth(): the shader was not created with TBN direction enabled\n"
         "Shaders::MeshVisualizerGL3D::setLineLength(): the shader was not created with TBN direction enabled\n");
 }
+
+void MeshVisualizerGLTest::bindVertexPullingTexturesNotEnabled3D() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    MeshVisualizerGL3D shader{MeshVisualizerGL3D::Configuration{}
+        .setFlags(MeshVisualizerGL3D::Flag::Wireframe|MeshVisualizerGL3D::Flag::NoGeometryShader)};
+
+    GL::BufferTexture texture;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    shader.bindVertexPullingIndexTexture(texture)
+        .bindVertexPullingPositionTexture(texture);
+    CORRADE_COMPARE(out.str(),
+        "Shaders::MeshVisualizerGL3D::bindVertexPullingIndexTexture(): the shader was not created with vertex pulling enabled\n"
+        "Shaders::MeshVisualizerGL3D::bindVertexPullingPositionTexture(): the shader was not created with vertex pulling enabled\n");
+}
 #endif
 
 #ifndef MAGNUM_TARGET_GLES2
@@ -303,6 +303,14 @@ void MeshVisualizerGL_Test::debugFlagsSupersets3D() {
         Debug{&out} << (MeshVisualizerGL3D::Flag::MultiDraw|MeshVisualizerGL3D::Flag::ShaderStorageBuffers|MeshVisualizerGL3D::Flag::UniformBuffers);
         CORRADE_COMPARE(out.str(), "Shaders::MeshVisualizerGL3D::Flag::MultiDraw|Shaders::MeshVisualizerGL3D::Flag::ShaderStorageBuffers\n");
     }
+
+    /* VertexPulling is a superset of NoGeometryShader so only one should be
+       printed */
+    {
+        std::ostringstream out;
+        Debug{&out} << (MeshVisualizerGL3D::Flag::Wireframe|MeshVisualizerGL3D::Flag::VertexPulling|MeshVisualizerGL3D::Flag::NoGeometryShader);
+        CORRADE_COMPARE(out.str(), "Shaders::MeshVisualizerGL3D::Flag::Wireframe|Shaders::MeshVisualizerGL3D::Flag::VertexPulling\n");
+    }
     #endif
 }
 #endif
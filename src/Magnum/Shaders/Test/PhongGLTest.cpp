@@ -98,6 +98,8 @@ struct PhongGLTest: GL::OpenGLTester {
     void constructUniformBuffersAsync();
     #endif
 
+    void constructDepthOnlyNoLights();
+
     void constructMove();
     #ifndef MAGNUM_TARGET_GLES2
     void constructMoveUniformBuffers();
@@ -119,6 +121,10 @@ struct PhongGLTest: GL::OpenGLTester {
     #ifndef MAGNUM_TARGET_GLES2
     void bindTextureArraysInvalid();
     #endif
+    #ifndef MAGNUM_TARGET_GLES
+    void bindTextureHandleBufferNotEnabled();
+    void bindTexturesBindlessEnabled();
+    #endif
     void setAlphaMaskNotEnabled();
     void setSpecularDisabled();
     void setTextureMatrixNotEnabled();
@@ -176,6 +182,8 @@ struct PhongGLTest: GL::OpenGLTester {
     /* This tests something that's irrelevant to UBOs */
     void renderDoubleSided();
 
+    void renderDepthOnlyPrepass();
+
     #ifndef MAGNUM_TARGET_GLES2
     template<PhongGL::Flag flag = PhongGL::Flag{}> void renderSkinning();
     #endif
@@ -279,6 +287,8 @@ constexpr struct {
     {"zero lights", {}, 0, 0},
     {"instanced transformation", PhongGL::Flag::InstancedTransformation, 3, 3},
     {"instanced transformation, zero lights", PhongGL::Flag::InstancedTransformation, 0, 0},
+    {"depth only", PhongGL::Flag::DepthOnly, 0, 0},
+    {"depth only, instanced transformation", PhongGL::Flag::DepthOnly|PhongGL::Flag::InstancedTransformation, 0, 0},
     {"instanced specular texture offset", PhongGL::Flag::SpecularTexture|PhongGL::Flag::InstancedTextureOffset, 3, 3},
     {"instanced normal texture offset", PhongGL::Flag::NormalTexture|PhongGL::Flag::InstancedTextureOffset, 3, 3},
     #ifndef MAGNUM_TARGET_GLES2
@@ -361,10 +371,20 @@ constexpr struct {
         1, 1, 1, 1, 0, 0, 0},
     {"no specular", PhongGL::Flag::UniformBuffers|PhongGL::Flag::NoSpecular,
         1, 1, 1, 1, 0, 0, 0},
+    #ifndef MAGNUM_TARGET_GLES
+    {"bindless ambient + diffuse + specular + normal texture", PhongGL::Flag::UniformBuffers|PhongGL::Flag::AmbientTexture|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::SpecularTexture|PhongGL::Flag::NormalTexture|PhongGL::Flag::BindlessTextures,
+        8, 8, 8, 24, 0, 0, 0},
+    {"bindless texture arrays + object ID texture", PhongGL::Flag::MultiDraw|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::ObjectIdTexture|PhongGL::Flag::TextureArrays|PhongGL::Flag::TextureTransformation|PhongGL::Flag::BindlessTextures,
+        8, 8, 8, 24, 0, 0, 0},
+    #endif
     {"skinning", PhongGL::Flag::UniformBuffers,
         1, 1, 1, 1, 32, 3, 2},
     {"skinning, dynamic per-vertex sets", PhongGL::Flag::UniformBuffers|PhongGL::Flag::DynamicPerVertexJointCount,
         1, 1, 1, 1, 32, 3, 4},
+    {"depth only", PhongGL::Flag::UniformBuffers|PhongGL::Flag::DepthOnly,
+        0, 0, 1, 1, 0, 0, 0},
+    {"depth only, multidraw with instancing and skinning", PhongGL::Flag::MultiDraw|PhongGL::Flag::DepthOnly|PhongGL::Flag::InstancedTransformation|PhongGL::Flag::DynamicPerVertexJointCount,
+        0, 0, 1, 24, 16, 4, 0},
     {"multidraw with all the things except secondary per-vertex sets", PhongGL::Flag::MultiDraw|PhongGL::Flag::TextureTransformation|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::AmbientTexture|PhongGL::Flag::SpecularTexture|PhongGL::Flag::NormalTexture|PhongGL::Flag::TextureArrays|PhongGL::Flag::AlphaMask|PhongGL::Flag::ObjectId|PhongGL::Flag::InstancedTextureOffset|PhongGL::Flag::InstancedTransformation|PhongGL::Flag::InstancedObjectId|PhongGL::Flag::LightCulling|PhongGL::Flag::DynamicPerVertexJointCount,
         8, 4, 16, 24, 16, 4, 0},
     {"multidraw with all the things except instancing", PhongGL::Flag::MultiDraw|PhongGL::Flag::TextureTransformation|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::AmbientTexture|PhongGL::Flag::SpecularTexture|PhongGL::Flag::NormalTexture|PhongGL::Flag::TextureArrays|PhongGL::Flag::AlphaMask|PhongGL::Flag::ObjectId|PhongGL::Flag::LightCulling|PhongGL::Flag::DynamicPerVertexJointCount,
@@ -374,6 +394,12 @@ constexpr struct {
         0, 4, 0, 0, 0, 4, 0},
     {"shader storage + multidraw with all the things except instancing", PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::MultiDraw|PhongGL::Flag::TextureTransformation|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::AmbientTexture|PhongGL::Flag::SpecularTexture|PhongGL::Flag::NormalTexture|PhongGL::Flag::TextureArrays|PhongGL::Flag::AlphaMask|PhongGL::Flag::ObjectId|PhongGL::Flag::LightCulling|PhongGL::Flag::DynamicPerVertexJointCount,
         0, 4, 0, 0, 0, 3, 4},
+    {"shader storage + multidraw + vertex pulling with normal texture and separate bitangents", PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::MultiDraw|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::NormalTexture|PhongGL::Flag::Bitangent|PhongGL::Flag::VertexColor|PhongGL::Flag::InstancedTransformation|PhongGL::Flag::VertexPulling,
+        0, 4, 0, 0, 0, 0, 0},
+    {"shader storage + multidraw + vertex pulling with normal texture", PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::MultiDraw|PhongGL::Flag::NormalTexture|PhongGL::Flag::VertexPulling,
+        0, 4, 0, 0, 0, 0, 0},
+    {"depth only, shader storage + multidraw + vertex pulling", PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::MultiDraw|PhongGL::Flag::DepthOnly|PhongGL::Flag::VertexPulling,
+        0, 0, 0, 0, 0, 0, 0},
     #endif
 };
 #endif
@@ -412,6 +438,10 @@ constexpr struct {
         PhongGL::Flag::SpecularTexture|PhongGL::Flag::NoSpecular,
         1, 1, 0, 0, 0,
         "specular texture requires the shader to not have specular disabled"},
+    {"depth only with textures and vertex colors",
+        PhongGL::Flag::DepthOnly|PhongGL::Flag::InstancedTransformation|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::VertexColor,
+        1, 1, 0, 0, 0,
+        "depth-only variant can't be combined with Shaders::PhongGL::Flag::DiffuseTexture|Shaders::PhongGL::Flag::VertexColor"},
     #ifndef MAGNUM_TARGET_GLES2
     {"dynamic per-vertex joint count but no static per-vertex joint count",
         PhongGL::Flag::DynamicPerVertexJointCount,
@@ -420,7 +450,19 @@ constexpr struct {
     {"instancing together with secondary per-vertex sets",
         PhongGL::Flag::InstancedTransformation,
         1, 1, 10, 4, 1,
-        "TransformationMatrix attribute binding conflicts with the SecondaryJointIds / SecondaryWeights attributes, use a non-instanced rendering with secondary weights instead"}
+        "TransformationMatrix attribute binding conflicts with the SecondaryJointIds / SecondaryWeights attributes, use a non-instanced rendering with secondary weights instead"},
+    #endif
+    #ifndef MAGNUM_TARGET_GLES
+    {"bindless textures but no uniform buffers",
+        PhongGL::Flag::BindlessTextures|PhongGL::Flag::DiffuseTexture,
+        1, 1, 0, 0, 0,
+        "bindless textures require uniform buffers to be enabled"},
+    #endif
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    {"vertex pulling but no shader storage buffers",
+        PhongGL::Flag::VertexPulling,
+        1, 1, 0, 0, 0,
+        "vertex pulling requires shader storage buffers to be enabled"},
     #endif
 };
 
@@ -452,6 +494,28 @@ constexpr struct {
         PhongGL::Flag::LightCulling,
         1, 1, 0, 0, 0, 1, 1,
         "light culling requires uniform buffers to be enabled"},
+    #ifndef MAGNUM_TARGET_WEBGL
+    {"clustered lights but no SSBOs",
+        PhongGL::Flag::UniformBuffers|PhongGL::Flag::ClusteredLights,
+        1, 1, 0, 0, 0, 1, 1,
+        "clustered lights require shader storage buffers to be enabled"},
+    {"clustered lights together with light culling",
+        PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::ClusteredLights|PhongGL::Flag::LightCulling,
+        1, 1, 0, 0, 0, 1, 1,
+        "clustered lights and light culling are mutually exclusive"},
+    {"clustered lights but zero per-draw light count",
+        PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::ClusteredLights,
+        0, 0, 0, 0, 0, 1, 1,
+        "clustered lights require a non-zero per-draw light count"},
+    {"vertex pulling but no SSBOs",
+        PhongGL::Flag::UniformBuffers|PhongGL::Flag::VertexPulling,
+        1, 1, 0, 0, 0, 1, 1,
+        "vertex pulling requires shader storage buffers to be enabled"},
+    {"vertex pulling with skinning",
+        PhongGL::Flag::ShaderStorageBuffers|PhongGL::Flag::VertexPulling,
+        1, 1, 10, 4, 0, 1, 1,
+        "vertex pulling can't be used together with skinning"},
+    #endif
     /* These two fail for UBOs but not SSBOs */
     {"per-vertex joint count but no joint count",
         PhongGL::Flag::UniformBuffers,
@@ -461,6 +525,14 @@ constexpr struct {
         PhongGL::Flag::UniformBuffers,
         1, 1, 0, 0, 3, 1, 1,
         "joint count can't be zero if per-vertex joint count is non-zero"},
+    #ifndef MAGNUM_TARGET_GLES
+    {"bindless textures but not textured",
+        /* ObjectId shares bits with ObjectIdTexture but should still trigger
+           the assert */
+        PhongGL::Flag::UniformBuffers|PhongGL::Flag::BindlessTextures|PhongGL::Flag::ObjectId,
+        1, 1, 0, 0, 0, 1, 1,
+        "bindless textures enabled but the shader is not textured"},
+    #endif
 };
 #endif
 
@@ -1263,6 +1335,8 @@ PhongGLTest::PhongGLTest() {
     #endif
 
     addTests({
+        &PhongGLTest::constructDepthOnlyNoLights,
+
         &PhongGLTest::constructMove,
         #ifndef MAGNUM_TARGET_GLES2
         &PhongGLTest::constructMoveUniformBuffers,
@@ -1292,6 +1366,11 @@ PhongGLTest::PhongGLTest() {
         Containers::arraySize(BindTextureArraysInvalidData));
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES
+    addTests({&PhongGLTest::bindTextureHandleBufferNotEnabled,
+              &PhongGLTest::bindTexturesBindlessEnabled});
+    #endif
+
     addTests({
         &PhongGLTest::setAlphaMaskNotEnabled,
         &PhongGLTest::setSpecularDisabled,
@@ -1490,6 +1569,10 @@ PhongGLTest::PhongGLTest() {
         &PhongGLTest::renderSetup,
         &PhongGLTest::renderTeardown);
 
+    addTests({&PhongGLTest::renderDepthOnlyPrepass},
+        &PhongGLTest::renderSetup,
+        &PhongGLTest::renderTeardown);
+
     #ifndef MAGNUM_TARGET_GLES2
     /* MSVC needs explicit type due to default template args */
     addInstancedTests<PhongGLTest>({
@@ -1667,6 +1750,8 @@ void PhongGLTest::constructUniformBuffers() {
         CORRADE_SKIP(GL::Extensions::EXT::gpu_shader4::string() << "is not supported.");
     if((data.flags & PhongGL::Flag::TextureArrays) && !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_array>())
         CORRADE_SKIP(GL::Extensions::EXT::texture_array::string() << "is not supported.");
+    if((data.flags & PhongGL::Flag::BindlessTextures) && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::bindless_texture>())
+        CORRADE_SKIP(GL::Extensions::ARB::bindless_texture::string() << "is not supported.");
     #endif
 
     #ifndef MAGNUM_TARGET_WEBGL
@@ -1843,6 +1928,22 @@ void PhongGLTest::constructMoveUniformBuffers() {
 }
 #endif
 
+void PhongGLTest::constructDepthOnlyNoLights() {
+    /* The light count is implicitly reset to zero, the default is 1 */
+    PhongGL shader{PhongGL::Configuration{}
+        .setFlags(PhongGL::Flag::DepthOnly)};
+    CORRADE_COMPARE(shader.flags(), PhongGL::Flag::DepthOnly);
+    CORRADE_COMPARE(shader.lightCount(), 0);
+    CORRADE_COMPARE(shader.perDrawLightCount(), 0);
+    CORRADE_VERIFY(shader.id());
+
+    /* Setting the color-only uniforms is a no-op */
+    shader.setAmbientColor(0xff3366_rgbf)
+        .setDiffuseColor(0x3366ff_rgbf);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
 void PhongGLTest::constructInvalid() {
     auto&& data = ConstructInvalidData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -2000,6 +2101,14 @@ void PhongGLTest::bindBufferUniformBuffersNotEnabled() {
           .bindLightBuffer(buffer, 0, 16)
           .bindJointBuffer(buffer)
           .bindJointBuffer(buffer, 0, 16)
+          #ifndef MAGNUM_TARGET_WEBGL
+          .bindLightClusterBuffer(buffer)
+          .bindLightClusterBuffer(buffer, 0, 16)
+          .bindLightClusterIndexBuffer(buffer)
+          .bindLightClusterIndexBuffer(buffer, 0, 16)
+          .bindVertexBuffer(buffer)
+          .bindVertexBuffer(buffer, 0, 16)
+          #endif
           .setDrawOffset(0);
     CORRADE_COMPARE(out.str(),
         "Shaders::PhongGL::bindProjectionBuffer(): the shader was not created with uniform buffers enabled\n"
@@ -2016,6 +2125,14 @@ void PhongGLTest::bindBufferUniformBuffersNotEnabled() {
         "Shaders::PhongGL::bindLightBuffer(): the shader was not created with uniform buffers enabled\n"
         "Shaders::PhongGL::bindJointBuffer(): the shader was not created with uniform buffers enabled\n"
         "Shaders::PhongGL::bindJointBuffer(): the shader was not created with uniform buffers enabled\n"
+        #ifndef MAGNUM_TARGET_WEBGL
+        "Shaders::PhongGL::bindLightClusterBuffer(): the shader was not created with clustered lights enabled\n"
+        "Shaders::PhongGL::bindLightClusterBuffer(): the shader was not created with clustered lights enabled\n"
+        "Shaders::PhongGL::bindLightClusterIndexBuffer(): the shader was not created with clustered lights enabled\n"
+        "Shaders::PhongGL::bindLightClusterIndexBuffer(): the shader was not created with clustered lights enabled\n"
+        "Shaders::PhongGL::bindVertexBuffer(): the shader was not created with vertex pulling enabled\n"
+        "Shaders::PhongGL::bindVertexBuffer(): the shader was not created with vertex pulling enabled\n"
+        #endif
         "Shaders::PhongGL::setDrawOffset(): the shader was not created with uniform buffers enabled\n");
 }
 #endif
@@ -2076,6 +2193,50 @@ void PhongGLTest::bindTextureArraysInvalid() {
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+void PhongGLTest::bindTextureHandleBufferNotEnabled() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    GL::Buffer buffer;
+    PhongGL shader;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    shader.bindTextureHandleBuffer(buffer)
+          .bindTextureHandleBuffer(buffer, 0, 48);
+    CORRADE_COMPARE(out.str(),
+        "Shaders::PhongGL::bindTextureHandleBuffer(): the shader was not created with bindless textures enabled\n"
+        "Shaders::PhongGL::bindTextureHandleBuffer(): the shader was not created with bindless textures enabled\n");
+}
+
+void PhongGLTest::bindTexturesBindlessEnabled() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::bindless_texture>())
+        CORRADE_SKIP(GL::Extensions::ARB::bindless_texture::string() << "is not supported.");
+
+    GL::Texture2D texture;
+    PhongGL shader{PhongGL::Configuration{}
+        .setFlags(PhongGL::Flag::UniformBuffers|PhongGL::Flag::AmbientTexture|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::SpecularTexture|PhongGL::Flag::NormalTexture|PhongGL::Flag::ObjectIdTexture|PhongGL::Flag::BindlessTextures)};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    shader.bindAmbientTexture(texture)
+          .bindDiffuseTexture(texture)
+          .bindSpecularTexture(texture)
+          .bindNormalTexture(texture)
+          .bindObjectIdTexture(texture)
+          .bindTextures(&texture, &texture, &texture, &texture);
+    CORRADE_COMPARE(out.str(),
+        "Shaders::PhongGL::bindAmbientTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead\n"
+        "Shaders::PhongGL::bindDiffuseTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead\n"
+        "Shaders::PhongGL::bindSpecularTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead\n"
+        "Shaders::PhongGL::bindNormalTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead\n"
+        "Shaders::PhongGL::bindObjectIdTexture(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead\n"
+        "Shaders::PhongGL::bindTextures(): the shader was created with bindless textures enabled, use bindTextureHandleBuffer() instead\n");
+}
+#endif
+
 void PhongGLTest::setAlphaMaskNotEnabled() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -4484,6 +4645,70 @@ template<PhongGL::Flag flag> void PhongGLTest::renderZeroLights() {
     #endif
 }
 
+void PhongGLTest::renderDepthOnlyPrepass() {
+    /* Same as the first renderColored() case, but with a depth prepass done
+       by the depth-only variant and the color pass passing the depth test
+       only where the depth is equal to the prepass. If the depth values
+       wouldn't match, the output would be missing pixels. */
+    GL::Renderbuffer depth;
+    depth.setStorage(GL::RenderbufferFormat::DepthComponent16, RenderSize);
+    _framebuffer.attachRenderbuffer(GL::Framebuffer::BufferAttachment::Depth, depth)
+        .clear(GL::FramebufferClear::Depth);
+    GL::Renderer::enable(GL::Renderer::Feature::DepthTest);
+
+    GL::Mesh sphere = MeshTools::compile(Primitives::uvSphereSolid(16, 32));
+    const Matrix4 transformation = Matrix4::translation(Vector3::zAxis(-2.15f));
+    const Matrix4 projection = Matrix4::perspectiveProjection(60.0_degf, 1.0f, 0.1f, 10.0f);
+
+    PhongGL::Configuration configuration;
+    configuration.setLightCount(2);
+    PhongGL shader{configuration};
+    PhongGL depthShader{configuration.depthOnlyVariant()};
+    CORRADE_COMPARE(depthShader.flags(), PhongGL::Flag::DepthOnly);
+
+    GL::Renderer::setColorMask(false, false, false, false);
+    depthShader
+        .setTransformationMatrix(transformation)
+        .setProjectionMatrix(projection)
+        .draw(sphere);
+
+    GL::Renderer::setColorMask(true, true, true, true);
+    GL::Renderer::setDepthFunction(GL::Renderer::DepthFunction::Equal);
+    shader
+        .setLightColors({0x993366_rgbf, 0x669933_rgbf})
+        .setLightPositions({{-3.0f, -3.0f, 2.0f, 0.0f},
+                            { 3.0f, -3.0f, 2.0f, 0.0f}})
+        .setAmbientColor(0x330033_rgbf)
+        .setDiffuseColor(0xccffcc_rgbf)
+        .setSpecularColor(0x6666ff_rgbf)
+        .setTransformationMatrix(transformation)
+        .setNormalMatrix(transformation.normalMatrix())
+        .setProjectionMatrix(projection)
+        .draw(sphere);
+
+    GL::Renderer::setDepthFunction(GL::Renderer::DepthFunction::Less);
+    GL::Renderer::disable(GL::Renderer::Feature::DepthTest);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    if(!(_manager.loadState("AnyImageImporter") & PluginManager::LoadState::Loaded) ||
+       !(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("AnyImageImporter / TgaImporter plugins not found.");
+
+    #if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
+    /* Same thresholds as in renderColored() */
+    const Float maxThreshold = 12.67f, meanThreshold = 0.121f;
+    #else
+    /* WebGL 1 doesn't have 8bit renderbuffer storage, so it's way worse */
+    const Float maxThreshold = 15.34f, meanThreshold = 3.33f;
+    #endif
+    CORRADE_COMPARE_WITH(
+        /* Dropping the alpha channel, as it's always 1.0 */
+        Containers::arrayCast<Color3ub>(_framebuffer.read(_framebuffer.viewport(), {PixelFormat::RGBA8Unorm}).pixels<Color4ub>()),
+        Utility::Path::join(_testDir, "PhongTestFiles/colored.tga"),
+        (DebugTools::CompareImageToFile{_manager, maxThreshold, meanThreshold}));
+}
+
 void PhongGLTest::renderDoubleSided() {
     auto&& data = RenderDoubleSidedData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
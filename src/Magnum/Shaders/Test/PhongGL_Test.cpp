@@ -42,6 +42,7 @@ struct PhongGL_Test: TestSuite::Tester {
     #ifndef MAGNUM_TARGET_GLES2
     void configurationSetJointCountInvalid();
     #endif
+    void configurationDepthOnlyVariant();
 
     void constructNoCreate();
     void constructCopy();
@@ -94,7 +95,9 @@ PhongGL_Test::PhongGL_Test() {
         Containers::arraySize(ConfigurationSetJointCountInvalidData));
     #endif
 
-    addTests({&PhongGL_Test::constructNoCreate,
+    addTests({&PhongGL_Test::configurationDepthOnlyVariant,
+
+              &PhongGL_Test::constructNoCreate,
               &PhongGL_Test::constructCopy,
 
               &PhongGL_Test::debugFlag,
@@ -132,6 +135,39 @@ void PhongGL_Test::configurationSetJointCountInvalid() {
 }
 #endif
 
+void PhongGL_Test::configurationDepthOnlyVariant() {
+    PhongGL::Configuration configuration;
+    configuration
+        .setFlags(PhongGL::Flag::DiffuseTexture|PhongGL::Flag::NormalTexture|PhongGL::Flag::InstancedTransformation|PhongGL::Flag::VertexColor)
+        .setLightCount(3);
+    #ifndef MAGNUM_TARGET_GLES2
+    configuration
+        .setFlags(configuration.flags()|PhongGL::Flag::MultiDraw)
+        .setMaterialCount(4)
+        .setDrawCount(16)
+        .setJointCount(8, 4, 2);
+    #endif
+
+    PhongGL::Configuration depthOnly = configuration.depthOnlyVariant();
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_COMPARE(depthOnly.flags(), PhongGL::Flag::DepthOnly|PhongGL::Flag::InstancedTransformation|PhongGL::Flag::MultiDraw);
+    #else
+    CORRADE_COMPARE(depthOnly.flags(), PhongGL::Flag::DepthOnly|PhongGL::Flag::InstancedTransformation);
+    #endif
+    CORRADE_COMPARE(depthOnly.lightCount(), 0);
+    CORRADE_COMPARE(depthOnly.perDrawLightCount(), 0);
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_COMPARE(depthOnly.materialCount(), 4);
+    CORRADE_COMPARE(depthOnly.drawCount(), 16);
+    CORRADE_COMPARE(depthOnly.jointCount(), 8);
+    CORRADE_COMPARE(depthOnly.perVertexJointCount(), 4);
+    CORRADE_COMPARE(depthOnly.secondaryPerVertexJointCount(), 2);
+    #endif
+
+    /* The original is left untouched */
+    CORRADE_COMPARE(configuration.lightCount(), 3);
+}
+
 void PhongGL_Test::constructNoCreate() {
     {
         PhongGL shader{NoCreate};
@@ -49,12 +49,21 @@ struct PhongTest: TestSuite::Tester {
     void lightUniformConstructDefault();
     void lightUniformConstructNoInit();
     void lightUniformSetters();
+
+    void lightClusterGridUniformConstructDefault();
+    void lightClusterGridUniformConstructNoInit();
+
+    void textureHandleUniformSizeAlignment();
+    void textureHandleUniformConstructDefault();
+    void textureHandleUniformConstructNoInit();
+    void textureHandleUniformSetters();
 };
 
 PhongTest::PhongTest() {
     addTests({&PhongTest::uniformSizeAlignment<PhongDrawUniform>,
               &PhongTest::uniformSizeAlignment<PhongMaterialUniform>,
               &PhongTest::uniformSizeAlignment<PhongLightUniform>,
+              &PhongTest::uniformSizeAlignment<PhongLightClusterGridUniform>,
 
               &PhongTest::drawUniformConstructDefault,
               &PhongTest::drawUniformConstructNoInit,
@@ -67,7 +76,15 @@ PhongTest::PhongTest() {
 
               &PhongTest::lightUniformConstructDefault,
               &PhongTest::lightUniformConstructNoInit,
-              &PhongTest::lightUniformSetters});
+              &PhongTest::lightUniformSetters,
+
+              &PhongTest::lightClusterGridUniformConstructDefault,
+              &PhongTest::lightClusterGridUniformConstructNoInit,
+
+              &PhongTest::textureHandleUniformSizeAlignment,
+              &PhongTest::textureHandleUniformConstructDefault,
+              &PhongTest::textureHandleUniformConstructNoInit,
+              &PhongTest::textureHandleUniformSetters});
 }
 
 using namespace Math::Literals;
@@ -82,6 +99,9 @@ template<> struct UniformTraits<PhongMaterialUniform> {
 template<> struct UniformTraits<PhongLightUniform> {
     static const char* name() { return "PhongLightUniform"; }
 };
+template<> struct UniformTraits<PhongLightClusterGridUniform> {
+    static const char* name() { return "PhongLightClusterGridUniform"; }
+};
 
 template<class T> void PhongTest::uniformSizeAlignment() {
     setTestCaseTemplateName(UniformTraits<T>::name());
@@ -372,6 +392,135 @@ void PhongTest::lightUniformSetters() {
     CORRADE_COMPARE(a.range, 7.0f);
 }
 
+void PhongTest::lightClusterGridUniformConstructDefault() {
+    PhongLightClusterGridUniform a;
+    PhongLightClusterGridUniform b{DefaultInit};
+    CORRADE_COMPARE(a.size, (Vector3ui{1, 1, 1}));
+    CORRADE_COMPARE(b.size, (Vector3ui{1, 1, 1}));
+    CORRADE_COMPARE(a.tileSize, Vector2{Constants::inf()});
+    CORRADE_COMPARE(b.tileSize, Vector2{Constants::inf()});
+    CORRADE_COMPARE(a.depthScale, 0.0f);
+    CORRADE_COMPARE(b.depthScale, 0.0f);
+    CORRADE_COMPARE(a.depthBias, 0.0f);
+    CORRADE_COMPARE(b.depthBias, 0.0f);
+
+    constexpr PhongLightClusterGridUniform ca;
+    constexpr PhongLightClusterGridUniform cb{DefaultInit};
+    CORRADE_COMPARE(ca.size, (Vector3ui{1, 1, 1}));
+    CORRADE_COMPARE(cb.size, (Vector3ui{1, 1, 1}));
+    CORRADE_COMPARE(ca.tileSize, Vector2{Constants::inf()});
+    CORRADE_COMPARE(cb.tileSize, Vector2{Constants::inf()});
+    CORRADE_COMPARE(ca.depthScale, 0.0f);
+    CORRADE_COMPARE(cb.depthScale, 0.0f);
+    CORRADE_COMPARE(ca.depthBias, 0.0f);
+    CORRADE_COMPARE(cb.depthBias, 0.0f);
+
+    CORRADE_VERIFY(std::is_nothrow_default_constructible<PhongLightClusterGridUniform>::value);
+    CORRADE_VERIFY(std::is_nothrow_constructible<PhongLightClusterGridUniform, DefaultInitT>::value);
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<DefaultInitT, PhongLightClusterGridUniform>::value);
+}
+
+void PhongTest::lightClusterGridUniformConstructNoInit() {
+    /* Testing only some fields, should be enough */
+    PhongLightClusterGridUniform a;
+    a.size = {16, 9, 24};
+    a.depthScale = 3.5f;
+
+    new(&a) PhongLightClusterGridUniform{NoInit};
+    {
+        /* Explicitly check we're not on Clang because certain Clang-based IDEs
+           inherit __GNUC__ if GCC is used instead of leaving it at 4 like
+           Clang itself does */
+        #if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG) && __GNUC__*100 + __GNUC_MINOR__ >= 601 && __OPTIMIZE__
+        CORRADE_EXPECT_FAIL("GCC 6.1+ misoptimizes and overwrites the value.");
+        #endif
+        CORRADE_COMPARE(a.size, (Vector3ui{16, 9, 24}));
+        CORRADE_COMPARE(a.depthScale, 3.5f);
+    }
+
+    CORRADE_VERIFY(std::is_nothrow_constructible<PhongLightClusterGridUniform, NoInitT>::value);
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<NoInitT, PhongLightClusterGridUniform>::value);
+}
+
+void PhongTest::textureHandleUniformSizeAlignment() {
+    /* Unlike other uniform structures this one consists of 64-bit handles,
+       so the alignment is 8 and not 4. It's 48 bytes, so it fits only into
+       768-byte UBO alignment. */
+    CORRADE_COMPARE(sizeof(PhongTextureHandleUniform) % sizeof(Vector4), 0);
+    CORRADE_COMPARE(768 % sizeof(PhongTextureHandleUniform), 0);
+    CORRADE_COMPARE(alignof(PhongTextureHandleUniform), 8);
+}
+
+void PhongTest::textureHandleUniformConstructDefault() {
+    PhongTextureHandleUniform a;
+    PhongTextureHandleUniform b{DefaultInit};
+    CORRADE_COMPARE(a.ambientTexture, 0);
+    CORRADE_COMPARE(b.ambientTexture, 0);
+    CORRADE_COMPARE(a.diffuseTexture, 0);
+    CORRADE_COMPARE(b.diffuseTexture, 0);
+    CORRADE_COMPARE(a.specularTexture, 0);
+    CORRADE_COMPARE(b.specularTexture, 0);
+    CORRADE_COMPARE(a.normalTexture, 0);
+    CORRADE_COMPARE(b.normalTexture, 0);
+    CORRADE_COMPARE(a.objectIdTexture, 0);
+    CORRADE_COMPARE(b.objectIdTexture, 0);
+
+    constexpr PhongTextureHandleUniform ca;
+    constexpr PhongTextureHandleUniform cb{DefaultInit};
+    CORRADE_COMPARE(ca.ambientTexture, 0);
+    CORRADE_COMPARE(cb.ambientTexture, 0);
+    CORRADE_COMPARE(ca.objectIdTexture, 0);
+    CORRADE_COMPARE(cb.objectIdTexture, 0);
+
+    CORRADE_VERIFY(std::is_nothrow_default_constructible<PhongTextureHandleUniform>::value);
+    CORRADE_VERIFY(std::is_nothrow_constructible<PhongTextureHandleUniform, DefaultInitT>::value);
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<DefaultInitT, PhongTextureHandleUniform>::value);
+}
+
+void PhongTest::textureHandleUniformConstructNoInit() {
+    /* Testing only some fields, should be enough */
+    PhongTextureHandleUniform a;
+    a.diffuseTexture = 0x100000001ull;
+    a.normalTexture = 0x200000002ull;
+
+    new(&a) PhongTextureHandleUniform{NoInit};
+    {
+        /* Explicitly check we're not on Clang because certain Clang-based IDEs
+           inherit __GNUC__ if GCC is used instead of leaving it at 4 like
+           Clang itself does */
+        #if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG) && __GNUC__*100 + __GNUC_MINOR__ >= 601 && __OPTIMIZE__
+        CORRADE_EXPECT_FAIL("GCC 6.1+ misoptimizes and overwrites the value.");
+        #endif
+        CORRADE_COMPARE(a.diffuseTexture, 0x100000001ull);
+        CORRADE_COMPARE(a.normalTexture, 0x200000002ull);
+    }
+
+    CORRADE_VERIFY(std::is_nothrow_constructible<PhongTextureHandleUniform, NoInitT>::value);
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<NoInitT, PhongTextureHandleUniform>::value);
+}
+
+void PhongTest::textureHandleUniformSetters() {
+    PhongTextureHandleUniform a;
+    a.setAmbientTexture(0x100000001ull)
+     .setDiffuseTexture(0x200000002ull)
+     .setSpecularTexture(0x300000003ull)
+     .setNormalTexture(0x400000004ull)
+     .setObjectIdTexture(0x500000005ull);
+    CORRADE_COMPARE(a.ambientTexture, 0x100000001ull);
+    CORRADE_COMPARE(a.diffuseTexture, 0x200000002ull);
+    CORRADE_COMPARE(a.specularTexture, 0x300000003ull);
+    CORRADE_COMPARE(a.normalTexture, 0x400000004ull);
+    CORRADE_COMPARE(a.objectIdTexture, 0x500000005ull);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Shaders::Test::PhongTest)
@@ -0,0 +1,200 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Utility/Move.h>
+#include <Corrade/Utility/System.h>
+
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/Shaders/FlatGL.h"
+#include "Magnum/Shaders/PhongGL.h"
+#include "Magnum/Shaders/ShaderCacheGL.h"
+
+namespace Magnum { namespace Shaders { namespace Test { namespace {
+
+struct ShaderCacheGLTest: GL::OpenGLTester {
+    explicit ShaderCacheGLTest();
+
+    void construct();
+    void constructMove();
+
+    void get();
+    void getDifferentConfiguration();
+    void find();
+    void findThenGet();
+    void clear();
+};
+
+ShaderCacheGLTest::ShaderCacheGLTest() {
+    addTests({&ShaderCacheGLTest::construct,
+              &ShaderCacheGLTest::constructMove,
+
+              &ShaderCacheGLTest::get,
+              &ShaderCacheGLTest::getDifferentConfiguration,
+              &ShaderCacheGLTest::find,
+              &ShaderCacheGLTest::findThenGet,
+              &ShaderCacheGLTest::clear});
+}
+
+void ShaderCacheGLTest::construct() {
+    ShaderCacheGL<PhongGL> cache;
+    CORRADE_COMPARE(cache.size(), 0);
+    CORRADE_VERIFY(!cache.contains(PhongGL::Configuration{}));
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ShaderCacheGLTest::constructMove() {
+    ShaderCacheGL<FlatGL2D> a;
+    FlatGL2D& shader = a.get(FlatGL2D::Configuration{});
+
+    ShaderCacheGL<FlatGL2D> b{Utility::move(a)};
+    CORRADE_COMPARE(b.size(), 1);
+    CORRADE_COMPARE(&b.get(FlatGL2D::Configuration{}), &shader);
+
+    ShaderCacheGL<FlatGL2D> c;
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.size(), 1);
+    CORRADE_COMPARE(&c.get(FlatGL2D::Configuration{}), &shader);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<ShaderCacheGL<FlatGL2D>>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<ShaderCacheGL<FlatGL2D>>::value);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ShaderCacheGLTest::get() {
+    ShaderCacheGL<PhongGL> cache;
+
+    PhongGL& shader = cache.get(PhongGL::Configuration{}
+        .setFlags(PhongGL::Flag::DiffuseTexture)
+        .setLightCount(3));
+    CORRADE_COMPARE(cache.size(), 1);
+    CORRADE_VERIFY(cache.contains(PhongGL::Configuration{}
+        .setFlags(PhongGL::Flag::DiffuseTexture)
+        .setLightCount(3)));
+    CORRADE_VERIFY(shader.id());
+    CORRADE_VERIFY(shader.isLinkFinished());
+    CORRADE_COMPARE(shader.flags(), PhongGL::Flag::DiffuseTexture);
+    CORRADE_COMPARE(shader.lightCount(), 3);
+
+    /* Same configuration gives back the same instance */
+    CORRADE_COMPARE(&cache.get(PhongGL::Configuration{}
+        .setFlags(PhongGL::Flag::DiffuseTexture)
+        .setLightCount(3)), &shader);
+    CORRADE_COMPARE(cache.size(), 1);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ShaderCacheGLTest::getDifferentConfiguration() {
+    ShaderCacheGL<PhongGL> cache;
+
+    PhongGL& a = cache.get(PhongGL::Configuration{}
+        .setFlags(PhongGL::Flag::DiffuseTexture)
+        .setLightCount(3));
+    /* Same flags, different light count */
+    PhongGL& b = cache.get(PhongGL::Configuration{}
+        .setFlags(PhongGL::Flag::DiffuseTexture)
+        .setLightCount(2));
+    /* Same light count, different flags */
+    PhongGL& c = cache.get(PhongGL::Configuration{}
+        .setFlags(PhongGL::Flag::AmbientTexture)
+        .setLightCount(3));
+    CORRADE_COMPARE(cache.size(), 3);
+    CORRADE_VERIFY(&a != &b);
+    CORRADE_VERIFY(&a != &c);
+    CORRADE_VERIFY(&b != &c);
+    CORRADE_COMPARE(b.lightCount(), 2);
+    CORRADE_COMPARE(c.flags(), PhongGL::Flag::AmbientTexture);
+
+    /* Earlier references are still valid after more variants got added */
+    CORRADE_COMPARE(a.lightCount(), 3);
+    CORRADE_COMPARE(a.flags(), PhongGL::Flag::DiffuseTexture);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ShaderCacheGLTest::find() {
+    ShaderCacheGL<FlatGL3D> cache;
+
+    /* The first call submits the shader for compilation, which may or may
+       not be finished right away */
+    FlatGL3D* shader = cache.find(FlatGL3D::Configuration{}
+        .setFlags(FlatGL3D::Flag::VertexColor));
+    CORRADE_COMPARE(cache.size(), 1);
+    while(!shader) {
+        Utility::System::sleep(100);
+        shader = cache.find(FlatGL3D::Configuration{}
+            .setFlags(FlatGL3D::Flag::VertexColor));
+    }
+    CORRADE_COMPARE(cache.size(), 1);
+    CORRADE_VERIFY(shader->id());
+    CORRADE_COMPARE(shader->flags(), FlatGL3D::Flag::VertexColor);
+
+    /* Once ready, it's returned right away */
+    CORRADE_COMPARE(cache.find(FlatGL3D::Configuration{}
+        .setFlags(FlatGL3D::Flag::VertexColor)), shader);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ShaderCacheGLTest::findThenGet() {
+    ShaderCacheGL<FlatGL3D> cache;
+
+    cache.find(FlatGL3D::Configuration{}
+        .setFlags(FlatGL3D::Flag::Textured));
+    CORRADE_COMPARE(cache.size(), 1);
+
+    /* Waits for the compilation submitted by find() */
+    FlatGL3D& shader = cache.get(FlatGL3D::Configuration{}
+        .setFlags(FlatGL3D::Flag::Textured));
+    CORRADE_COMPARE(cache.size(), 1);
+    CORRADE_VERIFY(shader.id());
+    CORRADE_COMPARE(shader.flags(), FlatGL3D::Flag::Textured);
+
+    CORRADE_COMPARE(cache.find(FlatGL3D::Configuration{}
+        .setFlags(FlatGL3D::Flag::Textured)), &shader);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+void ShaderCacheGLTest::clear() {
+    ShaderCacheGL<FlatGL3D> cache;
+    cache.get(FlatGL3D::Configuration{});
+    cache.find(FlatGL3D::Configuration{}
+        .setFlags(FlatGL3D::Flag::Textured));
+    CORRADE_COMPARE(cache.size(), 2);
+
+    cache.clear();
+    CORRADE_COMPARE(cache.size(), 0);
+    CORRADE_VERIFY(!cache.contains(FlatGL3D::Configuration{}));
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::ShaderCacheGLTest)
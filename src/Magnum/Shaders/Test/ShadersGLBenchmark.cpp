@@ -24,6 +24,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Iterable.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/Utility/Format.h>
@@ -36,6 +38,7 @@
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Framebuffer.h"
 #include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/MeshView.h"
 #include "Magnum/GL/OpenGLTester.h"
 #include "Magnum/GL/Renderbuffer.h"
 #include "Magnum/GL/RenderbufferFormat.h"
@@ -90,8 +93,35 @@ namespace Magnum { namespace Shaders { namespace Test { namespace {
     -   if instancing features are enabled, there's exactly one instance
     -   if alpha mask is enabled, it's 0.0
     -   uniforms / binding overhead is not included in the benchmark
+
+    The drawScaling*() benchmarks are an exception to the last two points --
+    there the mesh is split into equally-sized chunks submitted either as
+    separate draws, instances, UBO draws or a single multidraw, with the
+    submission cost included, so the paths can be compared against each other
+    at various draw counts. Each is measured both in CPU and GPU time.
 */
 
+enum class DrawPath {
+    /* A draw() per chunk, with the transformation set via uniform setters */
+    Uniforms,
+    /* A single instanced draw(), with the transformation coming from a
+       per-instance attribute */
+    Instanced,
+    #ifndef MAGNUM_TARGET_GLES2
+    /* A draw() per chunk, with setDrawOffset() into uniform buffers */
+    UniformBuffers,
+    /* A single multidraw of all chunks, with uniform buffers */
+    MultiDraw
+    #endif
+};
+
+struct DrawScalingMeshes {
+    /* Used by all paths except DrawPath::Instanced */
+    Containers::Array<GL::MeshView> views;
+    /* Used by DrawPath::Instanced */
+    GL::Mesh instanced{NoCreate};
+};
+
 struct ShadersGLBenchmark: GL::OpenGLTester {
     explicit ShadersGLBenchmark();
 
@@ -108,7 +138,15 @@ struct ShadersGLBenchmark: GL::OpenGLTester {
     void meshVisualizer2D();
     void meshVisualizer3D();
 
+    void drawScalingFlat();
+    void drawScalingPhong();
+    #ifndef MAGNUM_TARGET_GLES2
+    void drawScalingMeshVisualizer3D();
+    #endif
+
     private:
+        DrawScalingMeshes drawScalingMeshes(DrawPath path, UnsignedInt drawCount);
+
         PluginManager::Manager<Trade::AbstractImporter> _manager{"nonexistent"};
 
         GL::Renderbuffer _color;
@@ -119,6 +157,8 @@ struct ShadersGLBenchmark: GL::OpenGLTester {
 
         GL::Buffer _indices, _vertices;
         GL::Mesh _mesh, _meshInstanced, _meshDuplicated;
+        /* Kept for creating instanced meshes with more than one instance */
+        Trade::MeshData _meshData{MeshPrimitive::Triangles, 0};
 
         GL::Texture2D _textureWhite, _textureBlue;
         #ifndef MAGNUM_TARGET_GLES2
@@ -347,6 +387,36 @@ const struct {
     #endif
 };
 
+/* The draw counts have to divide the grid into whole rows or integer fractions
+   of a row, see drawScalingMeshes(). 256 draws is also the most that fits into
+   the minimal guaranteed 16 kB uniform buffer size with 64-byte per-draw
+   uniforms. */
+const struct {
+    const char* name;
+    DrawPath path;
+    bool textureArrays;
+    UnsignedInt drawCount;
+} DrawScalingData[] {
+    {"uniforms, 16 draws", DrawPath::Uniforms, false, 16},
+    {"uniforms, 64 draws", DrawPath::Uniforms, false, 64},
+    {"uniforms, 256 draws", DrawPath::Uniforms, false, 256},
+    {"instanced, 16 instances", DrawPath::Instanced, false, 16},
+    {"instanced, 64 instances", DrawPath::Instanced, false, 64},
+    {"instanced, 256 instances", DrawPath::Instanced, false, 256},
+    #ifndef MAGNUM_TARGET_GLES2
+    {"uniforms, texture arrays, 256 draws", DrawPath::Uniforms, true, 256},
+    {"instanced, texture arrays, 256 instances", DrawPath::Instanced, true, 256},
+    {"UBO, 16 draws", DrawPath::UniformBuffers, false, 16},
+    {"UBO, 64 draws", DrawPath::UniformBuffers, false, 64},
+    {"UBO, 256 draws", DrawPath::UniformBuffers, false, 256},
+    {"UBO, texture arrays, 256 draws", DrawPath::UniformBuffers, true, 256},
+    {"multidraw, 16 draws", DrawPath::MultiDraw, false, 16},
+    {"multidraw, 64 draws", DrawPath::MultiDraw, false, 64},
+    {"multidraw, 256 draws", DrawPath::MultiDraw, false, 256},
+    {"multidraw, texture arrays, 256 draws", DrawPath::MultiDraw, true, 256},
+    #endif
+};
+
 ShadersGLBenchmark::ShadersGLBenchmark(): _framebuffer{{{}, RenderSize}} {
     addInstancedBenchmarks({&ShadersGLBenchmark::flat<2>,
                             &ShadersGLBenchmark::flat<3>},
@@ -394,6 +464,20 @@ ShadersGLBenchmark::ShadersGLBenchmark(): _framebuffer{{{}, RenderSize}} {
         &ShadersGLBenchmark::renderTeardown,
         BenchmarkType::GpuTime);
 
+    /* CPU time to measure the submission overhead, GPU time (which is
+       measured with a GL::TimeQuery) to see how well it all gets executed */
+    for(BenchmarkType type: {BenchmarkType::CpuTime, BenchmarkType::GpuTime})
+        addInstancedBenchmarks({&ShadersGLBenchmark::drawScalingFlat,
+                                &ShadersGLBenchmark::drawScalingPhong,
+                                #ifndef MAGNUM_TARGET_GLES2
+                                &ShadersGLBenchmark::drawScalingMeshVisualizer3D
+                                #endif
+                                },
+            BenchmarkRepeats, Containers::arraySize(DrawScalingData),
+            &ShadersGLBenchmark::renderSetup,
+            &ShadersGLBenchmark::renderTeardown,
+            type);
+
     /* Set up the framebuffer */
     _color.setStorage(
         #if !defined(MAGNUM_TARGET_GLES2) || !defined(MAGNUM_TARGET_WEBGL)
@@ -478,6 +562,8 @@ ShadersGLBenchmark::ShadersGLBenchmark(): _framebuffer{{{}, RenderSize}} {
 
         /* Non-indexed variant for GS-less wireframe drawing */
         _meshDuplicated = MeshTools::compile(MeshTools::duplicate(dataWithVertexColors));
+
+        _meshData = Utility::move(dataWithVertexColors);
     }
 
     /* Set up the textures */
@@ -1343,6 +1429,395 @@ void ShadersGLBenchmark::meshVisualizer3D() {
         DebugTools::CompareImageToFile{_manager});
 }
 
+DrawScalingMeshes ShadersGLBenchmark::drawScalingMeshes(const DrawPath path, const UnsignedInt drawCount) {
+    DrawScalingMeshes out;
+
+    #ifndef MAGNUM_TARGET_GLES2
+    if(path == DrawPath::MultiDraw) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shader_draw_parameters>())
+            CORRADE_SKIP(GL::Extensions::ARB::shader_draw_parameters::string() << "is not supported.");
+        #elif !defined(MAGNUM_TARGET_WEBGL)
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ANGLE::multi_draw>())
+            CORRADE_SKIP(GL::Extensions::ANGLE::multi_draw::string() << "is not supported.");
+        #else
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::WEBGL::multi_draw>())
+            CORRADE_SKIP(GL::Extensions::WEBGL::multi_draw::string() << "is not supported.");
+        #endif
+    }
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES
+    if((path == DrawPath::UniformBuffers || path == DrawPath::MultiDraw) && !GL::Context::current().isExtensionSupported<GL::Extensions::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(GL::Extensions::ARB::uniform_buffer_object::string() << "is not supported.");
+    #endif
+
+    /* Each chunk is either a whole number of grid rows or an integer fraction
+       of a row, so the instanced variant below can draw just the first chunk
+       and shift it to where the other chunks would be */
+    const Int chunkQuadCount = GridSubdivisions.product()/drawCount;
+    CORRADE_INTERNAL_ASSERT(chunkQuadCount*drawCount == UnsignedInt(GridSubdivisions.product()) && (chunkQuadCount % GridSubdivisions.x() == 0 || GridSubdivisions.x() % chunkQuadCount == 0));
+
+    if(path == DrawPath::Instanced) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::instanced_arrays>())
+            CORRADE_SKIP(GL::Extensions::ARB::instanced_arrays::string() << "is not supported.");
+        #elif defined(MAGNUM_TARGET_GLES2)
+        #ifndef MAGNUM_TARGET_WEBGL
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ANGLE::instanced_arrays>() &&
+        !GL::Context::current().isExtensionSupported<GL::Extensions::EXT::instanced_arrays>() &&
+        !GL::Context::current().isExtensionSupported<GL::Extensions::NV::instanced_arrays>())
+            CORRADE_SKIP("Required extension is not available.");
+        #else
+        if(!GL::Context::current().isExtensionSupported<GL::Extensions::ANGLE::instanced_arrays>())
+            CORRADE_SKIP(GL::Extensions::ANGLE::instanced_arrays::string() << "is not supported.");
+        #endif
+        #endif
+
+        struct Instance {
+            Matrix4 transformation;
+            Matrix3x3 normalMatrix;
+        };
+        Containers::Array<Instance> instanceData{drawCount};
+        for(UnsignedInt i = 0; i != drawCount; ++i) {
+            const Int firstQuad = Int(i)*chunkQuadCount;
+            const Vector2i offset{firstQuad % GridSubdivisions.x(),
+                                  firstQuad/GridSubdivisions.x()};
+            /* The grid spans [-1, 1] in both directions */
+            instanceData[i].transformation = Matrix4::translation(Vector3{2.0f*Vector2{offset}/Vector2{GridSubdivisions}, 0.0f});
+        }
+
+        out.instanced = MeshTools::compile(_meshData, _indices, _vertices);
+        out.instanced
+            .setCount(chunkQuadCount*6)
+            .setInstanceCount(Int(drawCount))
+            .addVertexBufferInstanced(GL::Buffer{instanceData}, 1, 0,
+                GenericGL3D::TransformationMatrix{},
+                GenericGL3D::NormalMatrix{});
+    } else {
+        for(UnsignedInt i = 0; i != drawCount; ++i)
+            arrayAppend(out.views, InPlaceInit, _mesh)
+                .setCount(chunkQuadCount*6)
+                .setIndexOffset(Int(i)*chunkQuadCount*6);
+    }
+
+    return out;
+}
+
+void ShadersGLBenchmark::drawScalingFlat() {
+    auto&& data = DrawScalingData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_manager.loadState("AnyImageImporter") & PluginManager::LoadState::Loaded) ||
+       !(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("AnyImageImporter / TgaImporter plugins not found.");
+
+    FlatGL3D::Flags flags;
+    if(data.path == DrawPath::Instanced)
+        flags |= FlatGL3D::Flag::InstancedTransformation;
+    #ifndef MAGNUM_TARGET_GLES2
+    else if(data.path == DrawPath::UniformBuffers)
+        flags |= FlatGL3D::Flag::UniformBuffers;
+    else if(data.path == DrawPath::MultiDraw)
+        flags |= FlatGL3D::Flag::MultiDraw;
+    if(data.textureArrays) {
+        flags |= FlatGL3D::Flag::Textured|FlatGL3D::Flag::TextureArrays;
+        /* The layer comes from the texture transformation buffer */
+        if(flags & FlatGL3D::Flag::UniformBuffers)
+            flags |= FlatGL3D::Flag::TextureTransformation;
+    }
+    #endif
+
+    DrawScalingMeshes meshes = drawScalingMeshes(data.path, data.drawCount);
+
+    FlatGL3D shader{FlatGL3D::Configuration{}
+        .setFlags(flags)
+        #ifndef MAGNUM_TARGET_GLES2
+        .setDrawCount(flags & FlatGL3D::Flag::UniformBuffers ? data.drawCount : 1)
+        #endif
+    };
+
+    #ifndef MAGNUM_TARGET_GLES2
+    GL::Buffer transformationProjectionUniform{NoCreate};
+    GL::Buffer drawUniform{NoCreate};
+    GL::Buffer textureTransformationUniform{NoCreate};
+    GL::Buffer materialUniform{NoCreate};
+    if(flags & FlatGL3D::Flag::UniformBuffers) {
+        transformationProjectionUniform = GL::Buffer{GL::Buffer::TargetHint::Uniform, Containers::Array<TransformationProjectionUniform3D>{data.drawCount}};
+        drawUniform = GL::Buffer{GL::Buffer::TargetHint::Uniform, Containers::Array<FlatDrawUniform>{data.drawCount}};
+        materialUniform = GL::Buffer{GL::Buffer::TargetHint::Uniform, {
+            FlatMaterialUniform{}
+        }};
+        shader.bindTransformationProjectionBuffer(transformationProjectionUniform)
+            .bindDrawBuffer(drawUniform)
+            .bindMaterialBuffer(materialUniform);
+        if(flags & FlatGL3D::Flag::TextureTransformation) {
+            textureTransformationUniform = GL::Buffer{GL::Buffer::TargetHint::Uniform, Containers::Array<TextureTransformationUniform>{data.drawCount}};
+            shader.bindTextureTransformationBuffer(textureTransformationUniform);
+        }
+    }
+    if(data.textureArrays)
+        shader.bindTexture(_textureWhiteArray);
+    #endif
+
+    auto submit = [&]() {
+        switch(data.path) {
+            case DrawPath::Uniforms:
+                for(GL::MeshView& view: meshes.views) {
+                    shader.setTransformationProjectionMatrix(Matrix4{});
+                    #ifndef MAGNUM_TARGET_GLES2
+                    if(data.textureArrays)
+                        shader.setTextureLayer(0);
+                    #endif
+                    shader.draw(view);
+                }
+                return;
+            case DrawPath::Instanced:
+                shader.draw(meshes.instanced);
+                return;
+            #ifndef MAGNUM_TARGET_GLES2
+            case DrawPath::UniformBuffers:
+                for(UnsignedInt i = 0; i != data.drawCount; ++i)
+                    shader.setDrawOffset(i)
+                        .draw(meshes.views[i]);
+                return;
+            case DrawPath::MultiDraw:
+                shader.draw(meshes.views);
+                return;
+            #endif
+        }
+        CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    };
+
+    /* Warmup run */
+    /** @todo make this possible to do inside CORRADE_BENCHMARK() */
+    for(std::size_t i = 0; i != WarmupIterations; ++i)
+        submit();
+
+    CORRADE_BENCHMARK(BenchmarkIterations)
+        submit();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE_WITH(_framebuffer.read(_framebuffer.viewport(), {PixelFormat::RGBA8Unorm}),
+        Utility::Path::join(SHADERS_TEST_DIR, "BenchmarkFiles/trivial.tga"),
+        DebugTools::CompareImageToFile{_manager});
+}
+
+void ShadersGLBenchmark::drawScalingPhong() {
+    auto&& data = DrawScalingData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_manager.loadState("AnyImageImporter") & PluginManager::LoadState::Loaded) ||
+       !(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("AnyImageImporter / TgaImporter plugins not found.");
+
+    PhongGL::Flags flags;
+    if(data.path == DrawPath::Instanced)
+        flags |= PhongGL::Flag::InstancedTransformation;
+    #ifndef MAGNUM_TARGET_GLES2
+    else if(data.path == DrawPath::UniformBuffers)
+        flags |= PhongGL::Flag::UniformBuffers;
+    else if(data.path == DrawPath::MultiDraw)
+        flags |= PhongGL::Flag::MultiDraw;
+    if(data.textureArrays) {
+        flags |= PhongGL::Flag::AmbientTexture|PhongGL::Flag::DiffuseTexture|PhongGL::Flag::TextureArrays;
+        /* The layer comes from the texture transformation buffer */
+        if(flags & PhongGL::Flag::UniformBuffers)
+            flags |= PhongGL::Flag::TextureTransformation;
+    }
+    #endif
+
+    DrawScalingMeshes meshes = drawScalingMeshes(data.path, data.drawCount);
+
+    PhongGL shader{PhongGL::Configuration{}
+        .setFlags(flags)
+        #ifndef MAGNUM_TARGET_GLES2
+        .setDrawCount(flags & PhongGL::Flag::UniformBuffers ? data.drawCount : 1)
+        #endif
+    };
+
+    #ifndef MAGNUM_TARGET_GLES2
+    GL::Buffer projectionUniform{NoCreate};
+    GL::Buffer transformationUniform{NoCreate};
+    GL::Buffer drawUniform{NoCreate};
+    GL::Buffer textureTransformationUniform{NoCreate};
+    GL::Buffer materialUniform{NoCreate};
+    GL::Buffer lightUniform{NoCreate};
+    if(flags & PhongGL::Flag::UniformBuffers) {
+        projectionUniform = GL::Buffer{GL::Buffer::TargetHint::Uniform, {
+            ProjectionUniform3D{}
+        }};
+        transformationUniform = GL::Buffer{GL::Buffer::TargetHint::Uniform, Containers::Array<TransformationUniform3D>{data.drawCount}};
+        drawUniform = GL::Buffer{GL::Buffer::TargetHint::Uniform, Containers::Array<PhongDrawUniform>{data.drawCount}};
+        materialUniform = GL::Buffer{GL::Buffer::TargetHint::Uniform, {
+            /* White ambient so we always have a white output */
+            PhongMaterialUniform{}
+                .setAmbientColor(0xffffffff_rgbaf)
+        }};
+        lightUniform = GL::Buffer{GL::Buffer::TargetHint::Uniform, {
+            PhongLightUniform{}
+        }};
+        shader.bindProjectionBuffer(projectionUniform)
+            .bindTransformationBuffer(transformationUniform)
+            .bindDrawBuffer(drawUniform)
+            .bindMaterialBuffer(materialUniform)
+            .bindLightBuffer(lightUniform);
+        if(flags & PhongGL::Flag::TextureTransformation) {
+            textureTransformationUniform = GL::Buffer{GL::Buffer::TargetHint::Uniform, Containers::Array<TextureTransformationUniform>{data.drawCount}};
+            shader.bindTextureTransformationBuffer(textureTransformationUniform);
+        }
+    } else
+    #endif
+    {
+        /* White ambient so we always have a white output */
+        shader.setAmbientColor(0xffffffff_rgbaf);
+    }
+    #ifndef MAGNUM_TARGET_GLES2
+    if(data.textureArrays)
+        shader.bindAmbientTexture(_textureWhiteArray)
+            .bindDiffuseTexture(_textureWhiteArray);
+    #endif
+
+    auto submit = [&]() {
+        switch(data.path) {
+            case DrawPath::Uniforms:
+                for(GL::MeshView& view: meshes.views) {
+                    shader
+                        .setTransformationMatrix(Matrix4{})
+                        .setNormalMatrix(Matrix3x3{});
+                    #ifndef MAGNUM_TARGET_GLES2
+                    if(data.textureArrays)
+                        shader.setTextureLayer(0);
+                    #endif
+                    shader.draw(view);
+                }
+                return;
+            case DrawPath::Instanced:
+                shader.draw(meshes.instanced);
+                return;
+            #ifndef MAGNUM_TARGET_GLES2
+            case DrawPath::UniformBuffers:
+                for(UnsignedInt i = 0; i != data.drawCount; ++i)
+                    shader.setDrawOffset(i)
+                        .draw(meshes.views[i]);
+                return;
+            case DrawPath::MultiDraw:
+                shader.draw(meshes.views);
+                return;
+            #endif
+        }
+        CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    };
+
+    /* Warmup run */
+    /** @todo make this possible to do inside CORRADE_BENCHMARK() */
+    for(std::size_t i = 0; i != WarmupIterations; ++i)
+        submit();
+
+    CORRADE_BENCHMARK(BenchmarkIterations)
+        submit();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE_WITH(_framebuffer.read(_framebuffer.viewport(), {PixelFormat::RGBA8Unorm}),
+        Utility::Path::join(SHADERS_TEST_DIR, "BenchmarkFiles/trivial.tga"),
+        DebugTools::CompareImageToFile{_manager});
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void ShadersGLBenchmark::drawScalingMeshVisualizer3D() {
+    auto&& data = DrawScalingData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_manager.loadState("AnyImageImporter") & PluginManager::LoadState::Loaded) ||
+       !(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("AnyImageImporter / TgaImporter plugins not found.");
+
+    if(data.textureArrays)
+        CORRADE_SKIP("No texture array support in MeshVisualizerGL3D.");
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isVersionSupported(GL::Version::GL300))
+    #else
+    if(!GL::Context::current().isVersionSupported(GL::Version::GLES300))
+    #endif
+        CORRADE_SKIP("gl_VertexID not supported.");
+
+    /* Vertex ID visualization as it doesn't need a geometry shader or a
+       non-indexed mesh, and a white color map makes the output trivial */
+    MeshVisualizerGL3D::Flags flags = MeshVisualizerGL3D::Flag::VertexId;
+    if(data.path == DrawPath::Instanced)
+        flags |= MeshVisualizerGL3D::Flag::InstancedTransformation;
+    else if(data.path == DrawPath::UniformBuffers)
+        flags |= MeshVisualizerGL3D::Flag::UniformBuffers;
+    else if(data.path == DrawPath::MultiDraw)
+        flags |= MeshVisualizerGL3D::Flag::MultiDraw;
+
+    DrawScalingMeshes meshes = drawScalingMeshes(data.path, data.drawCount);
+
+    MeshVisualizerGL3D shader{MeshVisualizerGL3D::Configuration{}
+        .setFlags(flags)
+        .setDrawCount(flags & MeshVisualizerGL3D::Flag::UniformBuffers ? data.drawCount : 1)};
+    shader.bindColorMapTexture(_textureWhite);
+
+    GL::Buffer projectionUniform{NoCreate};
+    GL::Buffer transformationUniform{NoCreate};
+    GL::Buffer drawUniform{NoCreate};
+    GL::Buffer materialUniform{NoCreate};
+    if(flags & MeshVisualizerGL3D::Flag::UniformBuffers) {
+        projectionUniform = GL::Buffer{GL::Buffer::TargetHint::Uniform, {
+            ProjectionUniform3D{}
+        }};
+        transformationUniform = GL::Buffer{GL::Buffer::TargetHint::Uniform, Containers::Array<TransformationUniform3D>{data.drawCount}};
+        drawUniform = GL::Buffer{GL::Buffer::TargetHint::Uniform, Containers::Array<MeshVisualizerDrawUniform3D>{data.drawCount}};
+        materialUniform = GL::Buffer{GL::Buffer::TargetHint::Uniform, {
+            MeshVisualizerMaterialUniform{}
+        }};
+        shader.bindProjectionBuffer(projectionUniform)
+            .bindTransformationBuffer(transformationUniform)
+            .bindDrawBuffer(drawUniform)
+            .bindMaterialBuffer(materialUniform);
+    }
+
+    auto submit = [&]() {
+        switch(data.path) {
+            case DrawPath::Uniforms:
+                for(GL::MeshView& view: meshes.views)
+                    shader.setTransformationMatrix(Matrix4{})
+                        .draw(view);
+                return;
+            case DrawPath::Instanced:
+                shader.draw(meshes.instanced);
+                return;
+            case DrawPath::UniformBuffers:
+                for(UnsignedInt i = 0; i != data.drawCount; ++i)
+                    shader.setDrawOffset(i)
+                        .draw(meshes.views[i]);
+                return;
+            case DrawPath::MultiDraw:
+                shader.draw(meshes.views);
+                return;
+        }
+        CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    };
+
+    /* Warmup run */
+    /** @todo make this possible to do inside CORRADE_BENCHMARK() */
+    for(std::size_t i = 0; i != WarmupIterations; ++i)
+        submit();
+
+    CORRADE_BENCHMARK(BenchmarkIterations)
+        submit();
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    CORRADE_COMPARE_WITH(_framebuffer.read(_framebuffer.viewport(), {PixelFormat::RGBA8Unorm}),
+        Utility::Path::join(SHADERS_TEST_DIR, "BenchmarkFiles/trivial.tga"),
+        DebugTools::CompareImageToFile{_manager});
+}
+#endif
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Shaders::Test::ShadersGLBenchmark)
@@ -0,0 +1,90 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Shaders/SkinningGL.h"
+
+namespace Magnum { namespace Shaders { namespace Test { namespace {
+
+/* There's an underscore between GL and Test to disambiguate from GLTest, which
+   is a common suffix used to mark tests that need a GL context. Ugly, I know. */
+struct SkinningGL_Test: TestSuite::Tester {
+    explicit SkinningGL_Test();
+
+    void constructNoCreate();
+    void constructCopy();
+
+    void debugFlag();
+    void debugFlags();
+};
+
+SkinningGL_Test::SkinningGL_Test() {
+    addTests({&SkinningGL_Test::constructNoCreate,
+              &SkinningGL_Test::constructCopy,
+
+              &SkinningGL_Test::debugFlag,
+              &SkinningGL_Test::debugFlags});
+}
+
+void SkinningGL_Test::constructNoCreate() {
+    {
+        SkinningGL shader{NoCreate};
+        CORRADE_COMPARE(shader.id(), 0);
+        CORRADE_COMPARE(shader.flags(), SkinningGL::Flags{});
+        CORRADE_COMPARE(shader.jointCount(), 0);
+        CORRADE_COMPARE(shader.perVertexJointCount(), 0);
+        CORRADE_COMPARE(shader.secondaryPerVertexJointCount(), 0);
+    }
+
+    CORRADE_VERIFY(true);
+}
+
+void SkinningGL_Test::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<SkinningGL>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<SkinningGL>{});
+}
+
+void SkinningGL_Test::debugFlag() {
+    std::ostringstream out;
+
+    Debug{&out} << SkinningGL::Flag::Tangent4 << SkinningGL::Flag(0xf0);
+    CORRADE_COMPARE(out.str(), "Shaders::SkinningGL::Flag::Tangent4 Shaders::SkinningGL::Flag(0xf0)\n");
+}
+
+void SkinningGL_Test::debugFlags() {
+    std::ostringstream out;
+
+    Debug{&out} << (SkinningGL::Flag::Normal|SkinningGL::Flag::Tangent4|SkinningGL::Flag(0xf0)) << SkinningGL::Flags{};
+    CORRADE_COMPARE(out.str(), "Shaders::SkinningGL::Flag::Normal|Shaders::SkinningGL::Flag::Tangent4|Shaders::SkinningGL::Flag(0xf0) Shaders::SkinningGL::Flags{}\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::SkinningGL_Test)
@@ -46,6 +46,7 @@
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/DebugTools/CompareImage.h"
+#include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/Framebuffer.h"
 #include "Magnum/GL/Mesh.h"
 #include "Magnum/GL/OpenGLTester.h"
@@ -173,7 +174,9 @@ constexpr struct {
     VectorGL2D::Flags flags;
 } ConstructData[]{
     {"", {}},
-    {"texture transformation", VectorGL2D::Flag::TextureTransformation}
+    {"texture transformation", VectorGL2D::Flag::TextureTransformation},
+    {"vertex color", VectorGL2D::Flag::VertexColor},
+    {"vertex color + texture transformation", VectorGL2D::Flag::VertexColor|VectorGL2D::Flag::TextureTransformation}
 };
 
 #ifndef MAGNUM_TARGET_GLES2
@@ -185,6 +188,7 @@ constexpr struct {
     {"classic fallback", {}, 1, 1},
     {"", VectorGL2D::Flag::UniformBuffers, 1, 1},
     {"texture transformation", VectorGL2D::Flag::UniformBuffers|VectorGL2D::Flag::TextureTransformation, 1, 1},
+    {"vertex color", VectorGL2D::Flag::UniformBuffers|VectorGL2D::Flag::VertexColor, 1, 1},
     /* SwiftShader has 256 uniform vectors at most, per-draw is 4+1 in 3D case
        and 3+1 in 2D, per-material 3 */
     {"multiple materials, draws", VectorGL2D::Flag::UniformBuffers, 15, 42},
@@ -224,6 +228,11 @@ const struct {
         0x00000000_rgbaf, 0xffffff_rgbf,
         "defaults.tga", "defaults.tga", true},
     {"", {}, {}, 0x9999ff_rgbf, 0xffff99_rgbf,
+        "vector2D.tga", "vector3D.tga", false},
+    /* The color is supplied via the vertex attribute with the uniform being
+       white, should result in the same output */
+    {"vertex color", VectorGL2D::Flag::VertexColor, {},
+        0x9999ff_rgbf, 0xffff99_rgbf,
         "vector2D.tga", "vector3D.tga", false}
 };
 
@@ -1016,6 +1025,18 @@ template<VectorGL2D::Flag flag> void VectorGLTest::render2D() {
 
     GL::Mesh square = MeshTools::compile(Primitives::squareSolid(Primitives::SquareFlag::TextureCoordinates));
 
+    /* With vertex colors the fill color comes from the attribute and the
+       uniform is white */
+    GL::Buffer vertexColors{NoCreate};
+    Color4 color = data.color;
+    if(data.flags & VectorGL2D::Flag::VertexColor) {
+        vertexColors = GL::Buffer{GL::Buffer::TargetHint::Array, {
+            data.color, data.color, data.color, data.color
+        }};
+        square.addVertexBuffer(vertexColors, 0, VectorGL2D::Color4{});
+        color = 0xffffffff_rgbaf;
+    }
+
     Containers::Pointer<Trade::AbstractImporter> importer = _manager.loadAndInstantiate("AnyImageImporter");
     CORRADE_VERIFY(importer);
 
@@ -1041,7 +1062,7 @@ template<VectorGL2D::Flag flag> void VectorGLTest::render2D() {
 
     if(flag == VectorGL2D::Flag{}) {
         shader.setBackgroundColor(data.backgroundColor)
-            .setColor(data.color);
+            .setColor(color);
         if(data.textureTransformation != Matrix3{})
             shader.setTextureMatrix(data.textureTransformation);
         else shader.setTransformationProjectionMatrix(
@@ -1074,7 +1095,7 @@ template<VectorGL2D::Flag flag> void VectorGLTest::render2D() {
         GL::Buffer materialUniform{GL::Buffer::TargetHint::Uniform, {
             VectorMaterialUniform{}
                 .setBackgroundColor(data.backgroundColor)
-                .setColor(data.color)
+                .setColor(color)
         }};
         if(data.flags & VectorGL2D::Flag::TextureTransformation)
             shader.bindTextureTransformationBuffer(textureTransformationUniform);
@@ -1144,6 +1165,18 @@ template<VectorGL3D::Flag flag> void VectorGLTest::render3D() {
 
     GL::Mesh plane = MeshTools::compile(Primitives::planeSolid(Primitives::PlaneFlag::TextureCoordinates));
 
+    /* With vertex colors the fill color comes from the attribute and the
+       uniform is white */
+    GL::Buffer vertexColors{NoCreate};
+    Color4 color = data.color;
+    if(data.flags & VectorGL3D::Flag::VertexColor) {
+        vertexColors = GL::Buffer{GL::Buffer::TargetHint::Array, {
+            data.color, data.color, data.color, data.color
+        }};
+        plane.addVertexBuffer(vertexColors, 0, VectorGL3D::Color4{});
+        color = 0xffffffff_rgbaf;
+    }
+
     Containers::Pointer<Trade::AbstractImporter> importer = _manager.loadAndInstantiate("AnyImageImporter");
     CORRADE_VERIFY(importer);
 
@@ -1169,7 +1202,7 @@ template<VectorGL3D::Flag flag> void VectorGLTest::render3D() {
 
     if(flag == VectorGL3D::Flag{}) {
         shader.setBackgroundColor(data.backgroundColor)
-            .setColor(data.color);
+            .setColor(color);
         if(data.textureTransformation != Matrix3{})
             shader.setTextureMatrix(data.textureTransformation);
         else shader.setTransformationProjectionMatrix(
@@ -1206,7 +1239,7 @@ template<VectorGL3D::Flag flag> void VectorGLTest::render3D() {
         GL::Buffer materialUniform{GL::Buffer::TargetHint::Uniform, {
             VectorMaterialUniform{}
                 .setBackgroundColor(data.backgroundColor)
-                .setColor(data.color)
+                .setColor(color)
         }};
         if(data.flags & VectorGL3D::Flag::TextureTransformation)
             shader.bindTextureTransformationBuffer(textureTransformationUniform);
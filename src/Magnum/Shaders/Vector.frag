@@ -126,6 +126,10 @@ uniform lowp sampler2D vectorTexture;
 
 in mediump vec2 interpolatedTextureCoordinates;
 
+#ifdef VERTEX_COLOR
+in lowp vec4 interpolatedVertexColor;
+#endif
+
 #ifdef MULTI_DRAW
 flat in highp uint drawId;
 #endif
@@ -153,5 +157,9 @@ void main() {
     #endif
 
     lowp float intensity = texture(vectorTexture, interpolatedTextureCoordinates).r;
-    fragmentColor = mix(backgroundColor, color, intensity);
+    fragmentColor = mix(backgroundColor,
+        #ifdef VERTEX_COLOR
+        interpolatedVertexColor*
+        #endif
+        color, intensity);
 }
@@ -159,10 +159,21 @@ layout(location = TEXTURECOORDINATES_ATTRIBUTE_LOCATION)
 #endif
 in mediump vec2 textureCoordinates;
 
+#ifdef VERTEX_COLOR
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = COLOR_ATTRIBUTE_LOCATION)
+#endif
+in lowp vec4 vertexColor;
+#endif
+
 /* Outputs */
 
 out mediump vec2 interpolatedTextureCoordinates;
 
+#ifdef VERTEX_COLOR
+out lowp vec4 interpolatedVertexColor;
+#endif
+
 #ifdef MULTI_DRAW
 flat out highp uint drawId;
 #endif
@@ -208,4 +219,9 @@ void main() {
         textureCoordinates
         #endif
         ;
+
+    #ifdef VERTEX_COLOR
+    /* Vertex colors, if enabled */
+    interpolatedVertexColor = vertexColor;
+    #endif
 }
@@ -133,6 +133,7 @@ template<UnsignedInt dimensions> typename VectorGL<dimensions>::CompileState Vec
     GL::Shader vert{version, GL::Shader::Type::Vertex};
     vert.addSource(rs.getString("compatibility.glsl"_s))
         .addSource(configuration.flags() & Flag::TextureTransformation ? "#define TEXTURE_TRANSFORMATION\n"_s : ""_s)
+        .addSource(configuration.flags() & Flag::VertexColor ? "#define VERTEX_COLOR\n"_s : ""_s)
         .addSource(dimensions == 2 ? "#define TWO_DIMENSIONS\n"_s : "#define THREE_DIMENSIONS\n"_s);
     #ifndef MAGNUM_TARGET_GLES2
     if(configuration.flags() >= Flag::UniformBuffers) {
@@ -159,7 +160,8 @@ template<UnsignedInt dimensions> typename VectorGL<dimensions>::CompileState Vec
         .submitCompile();
 
     GL::Shader frag{version, GL::Shader::Type::Fragment};
-    frag.addSource(rs.getString("compatibility.glsl"_s));
+    frag.addSource(rs.getString("compatibility.glsl"_s))
+        .addSource(configuration.flags() & Flag::VertexColor ? "#define VERTEX_COLOR\n"_s : ""_s);
     #ifndef MAGNUM_TARGET_GLES2
     if(configuration.flags() >= Flag::UniformBuffers) {
         #ifndef MAGNUM_TARGET_WEBGL
@@ -203,6 +205,8 @@ template<UnsignedInt dimensions> typename VectorGL<dimensions>::CompileState Vec
     {
         out.bindAttributeLocation(Position::Location, "position"_s);
         out.bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates"_s);
+        if(configuration.flags() & Flag::VertexColor)
+            out.bindAttributeLocation(Color3::Location, "vertexColor"_s); /* Color4 is the same */
     }
     #endif
 
@@ -496,6 +500,7 @@ Debug& operator<<(Debug& debug, const VectorGLFlag value) {
         /* LCOV_EXCL_START */
         #define _c(v) case VectorGLFlag::v: return debug << "::" #v;
         _c(TextureTransformation)
+        _c(VertexColor)
         #ifndef MAGNUM_TARGET_GLES2
         _c(UniformBuffers)
         #ifndef MAGNUM_TARGET_WEBGL
@@ -513,6 +518,7 @@ Debug& operator<<(Debug& debug, const VectorGLFlag value) {
 Debug& operator<<(Debug& debug, const VectorGLFlags value) {
     return Containers::enumSetDebugOutput(debug, value, "Shaders::VectorGL::Flags{}", {
         VectorGLFlag::TextureTransformation,
+        VectorGLFlag::VertexColor,
         #ifndef MAGNUM_TARGET_GLES2
         #ifndef MAGNUM_TARGET_WEBGL
         /* Both are a superset of UniformBuffers, meaning printing just one
@@ -45,6 +45,7 @@ namespace Magnum { namespace Shaders {
 namespace Implementation {
     enum class VectorGLFlag: UnsignedByte {
         TextureTransformation = 1 << 0,
+        VertexColor = 1 << 4,
         #ifndef MAGNUM_TARGET_GLES2
         UniformBuffers = 1 << 1,
         #ifndef MAGNUM_TARGET_WEBGL
@@ -146,6 +147,26 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT VectorGL: public GL
          */
         typedef typename GenericGL<dimensions>::TextureCoordinates TextureCoordinates;
 
+        /**
+         * @brief Three-component vertex color
+         * @m_since_latest
+         *
+         * @ref shaders-generic "Generic attribute", @ref Magnum::Color3. Use
+         * either this or the @ref Color4 attribute. Used only if
+         * @ref Flag::VertexColor is set.
+         */
+        typedef typename GenericGL<dimensions>::Color3 Color3;
+
+        /**
+         * @brief Four-component vertex color
+         * @m_since_latest
+         *
+         * @ref shaders-generic "Generic attribute", @ref Magnum::Color4. Use
+         * either this or the @ref Color3 attribute. Used only if
+         * @ref Flag::VertexColor is set.
+         */
+        typedef typename GenericGL<dimensions>::Color4 Color4;
+
         enum: UnsignedInt {
             /**
              * Color shader output. @ref shaders-generic "Generic output",
@@ -170,6 +191,16 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT VectorGL: public GL
              */
             TextureTransformation = 1 << 0,
 
+            /**
+             * Multiply the fill color with a color coming from the
+             * @ref Color3 or @ref Color4 attribute. The background color is
+             * left unaffected. Useful for drawing many differently colored
+             * texts in a single draw call, see
+             * @ref Text::BatchRenderer for an example.
+             * @m_since_latest
+             */
+            VertexColor = 1 << 4,
+
             #ifndef MAGNUM_TARGET_GLES2
             /**
              * Use uniform buffers. Expects that uniform data are supplied via
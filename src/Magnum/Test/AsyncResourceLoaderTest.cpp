@@ -0,0 +1,319 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/AsyncResourceLoader.h"
+
+namespace Magnum { namespace Test { namespace {
+
+struct AsyncResourceLoaderTest: TestSuite::Tester {
+    explicit AsyncResourceLoaderTest();
+
+    void construct();
+    void constructDefaultThreadCount();
+    void constructNullLoader();
+
+    void load();
+    void priority();
+    void prefetch();
+    void dependencies();
+    void destructUnpublished();
+};
+
+struct Data {
+    static std::size_t count;
+
+    explicit Data(Int value): value{value} { ++count; }
+    ~Data() { --count; }
+
+    Int value;
+};
+
+std::size_t Data::count = 0;
+
+typedef Magnum::ResourceManager<Data> ResourceManager;
+
+AsyncResourceLoaderTest::AsyncResourceLoaderTest() {
+    addTests({&AsyncResourceLoaderTest::construct,
+              &AsyncResourceLoaderTest::constructDefaultThreadCount,
+              &AsyncResourceLoaderTest::constructNullLoader,
+
+              &AsyncResourceLoaderTest::load,
+              &AsyncResourceLoaderTest::priority,
+              &AsyncResourceLoaderTest::prefetch,
+              &AsyncResourceLoaderTest::dependencies,
+              &AsyncResourceLoaderTest::destructUnpublished});
+}
+
+Containers::Pointer<Data> loadData(const ResourceKey key, void*) {
+    if(key == ResourceKey{"missing"}) return nullptr;
+    if(key == ResourceKey{"hello"}) return Containers::pointer<Data>(1337);
+    return Containers::pointer<Data>(42);
+}
+
+void AsyncResourceLoaderTest::construct() {
+    AsyncResourceLoader<Data> loader{loadData, nullptr, 3};
+    CORRADE_COMPARE(loader.threadCount(), 3);
+    CORRADE_COMPARE(loader.pendingCount(), 0);
+    CORRADE_COMPARE(loader.requestedCount(), 0);
+
+    /* Nothing to publish */
+    CORRADE_COMPARE(loader.update(), 0);
+
+    /* Shouldn't block */
+    loader.wait();
+}
+
+void AsyncResourceLoaderTest::constructDefaultThreadCount() {
+    AsyncResourceLoader<Data> loader{loadData, nullptr};
+    CORRADE_COMPARE_AS(loader.threadCount(), 1,
+        TestSuite::Compare::GreaterOrEqual);
+}
+
+void AsyncResourceLoaderTest::constructNullLoader() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    AsyncResourceLoader<Data> loader{nullptr, nullptr};
+    CORRADE_COMPARE(out.str(), "AsyncResourceLoader: loader is null\n");
+}
+
+void AsyncResourceLoaderTest::load() {
+    {
+        ResourceManager rm;
+        Containers::Pointer<AsyncResourceLoader<Data>> loaderPtr{InPlaceInit, loadData, nullptr, 2};
+        AsyncResourceLoader<Data>& loader = *loaderPtr;
+        rm.setLoader<Data>(Utility::move(loaderPtr));
+
+        Resource<Data> hello = rm.get<Data>("hello");
+        Resource<Data> world = rm.get<Data>("world");
+        Resource<Data> missing = rm.get<Data>("missing");
+        CORRADE_COMPARE(loader.requestedCount(), 3);
+
+        /* Nothing gets published until update() is called, no matter how
+           fast the workers are */
+        loader.wait();
+        CORRADE_COMPARE(hello.state(), ResourceState::Loading);
+        CORRADE_COMPARE(world.state(), ResourceState::Loading);
+        CORRADE_COMPARE(missing.state(), ResourceState::Loading);
+        CORRADE_COMPARE(loader.pendingCount(), 3);
+        CORRADE_COMPARE(loader.loadedCount(), 0);
+        CORRADE_COMPARE(Data::count, 2);
+
+        CORRADE_COMPARE(loader.update(), 3);
+        CORRADE_COMPARE(loader.pendingCount(), 0);
+        CORRADE_COMPARE(loader.loadedCount(), 2);
+        CORRADE_COMPARE(loader.notFoundCount(), 1);
+        CORRADE_COMPARE(hello.state(), ResourceState::Final);
+        CORRADE_COMPARE(hello->value, 1337);
+        CORRADE_COMPARE(world.state(), ResourceState::Final);
+        CORRADE_COMPARE(world->value, 42);
+        CORRADE_COMPARE(missing.state(), ResourceState::NotFound);
+
+        /* A resource that's already loaded isn't requested again */
+        Resource<Data> hello2 = rm.get<Data>("hello");
+        CORRADE_COMPARE(loader.requestedCount(), 3);
+        CORRADE_COMPARE(hello2->value, 1337);
+
+        /* Nothing more to publish */
+        CORRADE_COMPARE(loader.update(), 0);
+    }
+
+    CORRADE_COMPARE(Data::count, 0);
+}
+
+/* The first resource blocks the only worker until all other requests are
+   queued, the rest records the order */
+struct OrderedState {
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool started = false, released = false;
+    std::vector<Int> order;
+};
+
+Containers::Pointer<Data> loadOrdered(const ResourceKey key, void* statePointer) {
+    OrderedState& state = *static_cast<OrderedState*>(statePointer);
+    std::unique_lock<std::mutex> lock{state.mutex};
+    Int value = -1;
+    if(key == ResourceKey{"first"}) {
+        value = 0;
+        state.started = true;
+        state.condition.notify_all();
+        state.condition.wait(lock, [&state]{ return state.released; });
+    }
+    else if(key == ResourceKey{"a"}) value = 1;
+    else if(key == ResourceKey{"b"}) value = 2;
+    else if(key == ResourceKey{"c"}) value = 3;
+    else if(key == ResourceKey{"d"}) value = 4;
+    state.order.push_back(value);
+    return Containers::pointer<Data>(value);
+}
+
+void waitForFirst(ResourceManager& rm, OrderedState& state) {
+    rm.get<Data>("first");
+    std::unique_lock<std::mutex> lock{state.mutex};
+    state.condition.wait(lock, [&state]{ return state.started; });
+}
+
+void releaseFirst(OrderedState& state) {
+    {
+        std::unique_lock<std::mutex> lock{state.mutex};
+        state.released = true;
+    }
+    state.condition.notify_all();
+}
+
+void AsyncResourceLoaderTest::priority() {
+    OrderedState state;
+
+    ResourceManager rm;
+    Containers::Pointer<AsyncResourceLoader<Data>> loaderPtr{InPlaceInit, loadOrdered, &state, 1};
+    AsyncResourceLoader<Data>& loader = *loaderPtr;
+    rm.setLoader<Data>(Utility::move(loaderPtr));
+
+    waitForFirst(rm, state);
+
+    /* Priority set before the request */
+    loader.setPriority("c", 5);
+    Resource<Data> a = rm.get<Data>("a");
+    Resource<Data> b = rm.get<Data>("b");
+    Resource<Data> c = rm.get<Data>("c");
+    Resource<Data> d = rm.get<Data>("d");
+    /* Priority changed while queued. Same priority as c, which was queued
+       with it already, so it goes after */
+    loader.setPriority("b", 5);
+    /* Lower than the default */
+    loader.setPriority("a", -1);
+
+    releaseFirst(state);
+
+    loader.wait();
+    CORRADE_COMPARE(loader.update(), 5);
+    CORRADE_COMPARE_AS(state.order,
+        (std::vector<Int>{0, 3, 2, 4, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(a->value, 1);
+    CORRADE_COMPARE(d->value, 4);
+}
+
+void AsyncResourceLoaderTest::prefetch() {
+    OrderedState state;
+
+    ResourceManager rm;
+    Containers::Pointer<AsyncResourceLoader<Data>> loaderPtr{InPlaceInit, loadOrdered, &state, 1};
+    AsyncResourceLoader<Data>& loader = *loaderPtr;
+    rm.setLoader<Data>(Utility::move(loaderPtr));
+
+    waitForFirst(rm, state);
+
+    /* Prefetched resources go after regular requests even if they have a
+       higher priority */
+    loader.setPriority("b", 5);
+    loader.prefetch({"a", "b"});
+    Resource<Data> c = rm.get<Data>("c");
+    Resource<Data> d = rm.get<Data>("d");
+    CORRADE_COMPARE(loader.requestedCount(), 5);
+    CORRADE_COMPARE(loader.pendingCount(), 5);
+
+    /* Requesting a prefetched resource moves it among the regular
+       requests */
+    Resource<Data> a = rm.get<Data>("a");
+    CORRADE_COMPARE(loader.requestedCount(), 5);
+
+    releaseFirst(state);
+
+    loader.wait();
+    CORRADE_COMPARE(loader.update(), 5);
+    CORRADE_COMPARE_AS(state.order,
+        (std::vector<Int>{0, 3, 4, 1, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(a->value, 1);
+    CORRADE_COMPARE(rm.state<Data>("b"), ResourceState::Final);
+}
+
+void AsyncResourceLoaderTest::dependencies() {
+    OrderedState state;
+
+    ResourceManager rm;
+    Containers::Pointer<AsyncResourceLoader<Data>> loaderPtr{InPlaceInit, loadOrdered, &state, 1};
+    AsyncResourceLoader<Data>& loader = *loaderPtr;
+    rm.setLoader<Data>(Utility::move(loaderPtr));
+
+    waitForFirst(rm, state);
+
+    /* b gets requested before a, but with a lower priority it's queued after
+       it. The worker should skip a and load c first, then b and only then
+       a. */
+    loader.addDependency("a", "b");
+    loader.setPriority("b", -1);
+    Resource<Data> a = rm.get<Data>("a");
+    Resource<Data> c = rm.get<Data>("c");
+    CORRADE_COMPARE(rm.state<Data>("b"), ResourceState::Loading);
+    CORRADE_COMPARE(loader.requestedCount(), 4);
+
+    releaseFirst(state);
+
+    loader.wait();
+    CORRADE_COMPARE(loader.update(), 4);
+    CORRADE_COMPARE_AS(state.order,
+        (std::vector<Int>{0, 3, 2, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(a->value, 1);
+    CORRADE_COMPARE(c->value, 3);
+    CORRADE_COMPARE(rm.state<Data>("b"), ResourceState::Final);
+}
+
+void AsyncResourceLoaderTest::destructUnpublished() {
+    {
+        ResourceManager rm;
+        Containers::Pointer<AsyncResourceLoader<Data>> loaderPtr{InPlaceInit, loadData, nullptr, 2};
+        AsyncResourceLoader<Data>& loader = *loaderPtr;
+        rm.setLoader<Data>(Utility::move(loaderPtr));
+
+        Resource<Data> hello = rm.get<Data>("hello");
+        Resource<Data> world = rm.get<Data>("world");
+        loader.wait();
+        CORRADE_COMPARE(Data::count, 2);
+
+        /* The manager destroys the loader, which should delete the
+           resources that were never published */
+    }
+
+    CORRADE_COMPARE(Data::count, 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Test::AsyncResourceLoaderTest)
@@ -0,0 +1,127 @@
+#ifndef Magnum_Test_BenchmarkTester_h
+#define Magnum_Test_BenchmarkTester_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+/* Tester base for plugin benchmarks measuring throughput and allocation count
+   in addition to wall time. Test-only, not installed. As it replaces the
+   global operator new and delete, it has to be included from exactly one
+   file in each executable. */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <Corrade/TestSuite/Tester.h>
+
+namespace Magnum { namespace Test { namespace Implementation {
+
+/* Allocations done through the global operator new, replaced below. On
+   Windows, allocations inside a dynamic plugin aren't counted as the DLL has
+   its own operator new. Allocations done directly with malloc() aren't
+   counted either. The benchmarks are single-threaded, so it doesn't need to
+   be atomic. Wrapped in a function to not need a separate definition. */
+inline std::size_t& allocationCount() {
+    static std::size_t count = 0;
+    return count;
+}
+
+}}}
+
+void* operator new(std::size_t size) {
+    ++Magnum::Test::Implementation::allocationCount();
+    if(void* const out = std::malloc(size ? size : 1))
+        return out;
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+namespace Magnum { namespace Test {
+
+struct BenchmarkTester: Corrade::TestSuite::Tester {
+    /* Runs the benchmarks measuring MB/s. They're expected to call
+       setThroughputBytes() with the size of the processed data inside
+       CORRADE_BENCHMARK(). */
+    template<class Derived> void addThroughputBenchmarks(std::initializer_list<void(Derived::*)()> benchmarks, std::size_t batchCount) {
+        addCustomBenchmarks<Derived>(benchmarks, batchCount, &BenchmarkTester::throughputBegin, &BenchmarkTester::throughputEnd, BenchmarkUnits::Count);
+    }
+    template<class Derived> void addInstancedThroughputBenchmarks(std::initializer_list<void(Derived::*)()> benchmarks, std::size_t batchCount, std::size_t instanceCount) {
+        addCustomInstancedBenchmarks<Derived>(benchmarks, batchCount, instanceCount, &BenchmarkTester::throughputBegin, &BenchmarkTester::throughputEnd, BenchmarkUnits::Count);
+    }
+
+    /* Runs the benchmarks counting allocations done through operator new */
+    template<class Derived> void addAllocationBenchmarks(std::initializer_list<void(Derived::*)()> benchmarks, std::size_t batchCount) {
+        addCustomBenchmarks<Derived>(benchmarks, batchCount, &BenchmarkTester::allocationsBegin, &BenchmarkTester::allocationsEnd, BenchmarkUnits::Count);
+    }
+    template<class Derived> void addInstancedAllocationBenchmarks(std::initializer_list<void(Derived::*)()> benchmarks, std::size_t batchCount, std::size_t instanceCount) {
+        addCustomInstancedBenchmarks<Derived>(benchmarks, batchCount, instanceCount, &BenchmarkTester::allocationsBegin, &BenchmarkTester::allocationsEnd, BenchmarkUnits::Count);
+    }
+
+    void setThroughputBytes(std::size_t bytes) { _bytes = bytes; }
+
+    private:
+        void throughputBegin() {
+            setBenchmarkName("MB/s");
+            _bytes = 0;
+            _begin = std::chrono::high_resolution_clock::now();
+        }
+
+        std::uint64_t throughputEnd() {
+            const std::uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - _begin).count();
+            /* If the test failed or was too fast to measure, exit early as
+               continuing would cause a division by zero */
+            if(!ns) return {};
+
+            /* Bytes per nanosecond is GB/s, multiplied by 1000 to get MB/s */
+            return _bytes*1000ull/ns;
+        }
+
+        void allocationsBegin() {
+            setBenchmarkName("allocations");
+            _allocations = Implementation::allocationCount();
+        }
+
+        std::uint64_t allocationsEnd() {
+            return Implementation::allocationCount() - _allocations;
+        }
+
+        std::chrono::high_resolution_clock::time_point _begin;
+        std::size_t _bytes, _allocations;
+};
+
+}}
+
+#endif
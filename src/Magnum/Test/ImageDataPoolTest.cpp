@@ -0,0 +1,239 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageDataPool.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Vector2.h"
+
+namespace Magnum { namespace Test { namespace {
+
+struct ImageDataPoolTest: TestSuite::Tester {
+    explicit ImageDataPoolTest();
+
+    void construct();
+    void constructMove();
+
+    void allocate();
+    void allocateEmpty();
+    void reuse();
+    void reuseSmall();
+    void reuseDifferentSizeClass();
+    void maxCachedSize();
+    void trim();
+    void destroyWithLiveAllocations();
+
+    void image();
+};
+
+ImageDataPoolTest::ImageDataPoolTest() {
+    addTests({&ImageDataPoolTest::construct,
+              &ImageDataPoolTest::constructMove,
+
+              &ImageDataPoolTest::allocate,
+              &ImageDataPoolTest::allocateEmpty,
+              &ImageDataPoolTest::reuse,
+              &ImageDataPoolTest::reuseSmall,
+              &ImageDataPoolTest::reuseDifferentSizeClass,
+              &ImageDataPoolTest::maxCachedSize,
+              &ImageDataPoolTest::trim,
+              &ImageDataPoolTest::destroyWithLiveAllocations,
+
+              &ImageDataPoolTest::image});
+}
+
+void ImageDataPoolTest::construct() {
+    ImageDataPool pool;
+    CORRADE_COMPARE(pool.maxCachedSize(), 256*1024*1024);
+    CORRADE_COMPARE(pool.cachedSize(), 0);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+    CORRADE_COMPARE(pool.reuseCount(), 0);
+}
+
+void ImageDataPoolTest::constructMove() {
+    ImageDataPool a;
+    a.setMaxCachedSize(16384);
+    Containers::Array<char> data = a.allocate(100);
+
+    ImageDataPool b{Utility::move(a)};
+    CORRADE_COMPARE(b.maxCachedSize(), 16384);
+    CORRADE_COMPARE(b.allocationCount(), 1);
+
+    ImageDataPool c;
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.maxCachedSize(), 16384);
+    CORRADE_COMPARE(c.allocationCount(), 1);
+
+    data = nullptr;
+    CORRADE_COMPARE(c.allocationCount(), 0);
+    CORRADE_COMPARE(c.cachedSize(), 4096);
+}
+
+void ImageDataPoolTest::allocate() {
+    ImageDataPool pool;
+    Containers::Array<char> data = pool.allocate(5000);
+    CORRADE_COMPARE(data.size(), 5000);
+    CORRADE_VERIFY(data.deleter());
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(data.data()) % alignof(std::max_align_t), 0);
+    CORRADE_COMPARE(pool.allocationCount(), 1);
+    CORRADE_COMPARE(pool.cachedSize(), 0);
+
+    /* The whole allocation should be writable */
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = char(i);
+    CORRADE_COMPARE(data[4999], char(4999));
+
+    data = nullptr;
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+    /* Rounded up to a quarter of a power of two */
+    CORRADE_COMPARE(pool.cachedSize(), 5120);
+}
+
+void ImageDataPoolTest::allocateEmpty() {
+    ImageDataPool pool;
+    Containers::Array<char> data = pool.allocate(0);
+    CORRADE_VERIFY(!data.data());
+    CORRADE_COMPARE(data.size(), 0);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+}
+
+void ImageDataPoolTest::reuse() {
+    ImageDataPool pool;
+    Containers::Array<char> a = pool.allocate(5000);
+    const char* pointer = a.data();
+    a = nullptr;
+
+    /* Same size class */
+    Containers::Array<char> b = pool.allocate(5120);
+    CORRADE_COMPARE(b.data(), pointer);
+    CORRADE_COMPARE(b.size(), 5120);
+    CORRADE_COMPARE(pool.reuseCount(), 1);
+    CORRADE_COMPARE(pool.cachedSize(), 0);
+    CORRADE_COMPARE(pool.allocationCount(), 1);
+}
+
+void ImageDataPoolTest::reuseSmall() {
+    ImageDataPool pool;
+    Containers::Array<char> a = pool.allocate(10);
+    const char* pointer = a.data();
+    a = nullptr;
+    CORRADE_COMPARE(pool.cachedSize(), 4096);
+
+    /* All allocations up to 4 kB are in the same class */
+    Containers::Array<char> b = pool.allocate(4096);
+    CORRADE_COMPARE(b.data(), pointer);
+    CORRADE_COMPARE(pool.reuseCount(), 1);
+}
+
+void ImageDataPoolTest::reuseDifferentSizeClass() {
+    ImageDataPool pool;
+    Containers::Array<char> a = pool.allocate(5000);
+    a = nullptr;
+
+    /* 6144 is the next size class, and 8192 the one after, which is a power
+       of two again */
+    Containers::Array<char> b = pool.allocate(5121);
+    Containers::Array<char> c = pool.allocate(7000);
+    CORRADE_COMPARE(pool.reuseCount(), 0);
+    CORRADE_COMPARE(pool.cachedSize(), 5120);
+
+    b = nullptr;
+    c = nullptr;
+    CORRADE_COMPARE(pool.cachedSize(), 5120 + 6144 + 8192);
+}
+
+void ImageDataPoolTest::maxCachedSize() {
+    ImageDataPool pool;
+    pool.setMaxCachedSize(8192);
+
+    Containers::Array<char> a = pool.allocate(4096);
+    Containers::Array<char> b = pool.allocate(4096);
+    Containers::Array<char> c = pool.allocate(4096);
+    a = nullptr;
+    b = nullptr;
+    c = nullptr;
+    /* The third allocation doesn't fit anymore and gets freed directly */
+    CORRADE_COMPARE(pool.cachedSize(), 8192);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+
+    /* Lowering the limit frees the excess */
+    pool.setMaxCachedSize(5000);
+    CORRADE_COMPARE(pool.maxCachedSize(), 5000);
+    CORRADE_COMPARE(pool.cachedSize(), 4096);
+}
+
+void ImageDataPoolTest::trim() {
+    ImageDataPool pool;
+    Containers::Array<char> a = pool.allocate(100000);
+    Containers::Array<char> b = pool.allocate(100);
+    a = nullptr;
+    CORRADE_COMPARE_AS(pool.cachedSize(), 100000, TestSuite::Compare::GreaterOrEqual);
+
+    pool.trim();
+    CORRADE_COMPARE(pool.cachedSize(), 0);
+    CORRADE_COMPARE(pool.allocationCount(), 1);
+}
+
+void ImageDataPoolTest::destroyWithLiveAllocations() {
+    Containers::Array<char> data;
+    {
+        ImageDataPool pool;
+        data = pool.allocate(100);
+        Containers::Array<char> other = pool.allocate(200);
+    }
+
+    /* The data should be still valid after the pool is gone, and get freed
+       properly after. Verified by ASan / Valgrind. */
+    data[99] = 'a';
+    CORRADE_COMPARE(data[99], 'a');
+    data = nullptr;
+}
+
+void ImageDataPoolTest::image() {
+    ImageDataPool pool;
+
+    const char* pointer;
+    {
+        Image2D image{PixelFormat::RGBA8Unorm, {32, 16}, pool.allocate(32*16*4)};
+        CORRADE_COMPARE(image.data().size(), 32*16*4);
+        pointer = image.data().data();
+    }
+    /* Falls into the smallest, 4 kB size class */
+    CORRADE_COMPARE(pool.cachedSize(), 4096);
+
+    Image2D image{PixelFormat::RGBA8Unorm, {16, 32}, pool.allocate(16*32*4)};
+    CORRADE_COMPARE(image.data().data(), pointer);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Test::ImageDataPoolTest)
@@ -0,0 +1,68 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+    Copyright © 2022 Pablo Escobar <mail@rvrs.in>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Parallel.h"
+
+namespace Magnum { namespace Test { namespace {
+
+struct ParallelTest: TestSuite::Tester {
+    explicit ParallelTest();
+
+    void serial();
+    void serialEmpty();
+};
+
+ParallelTest::ParallelTest() {
+    addTests({&ParallelTest::serial,
+              &ParallelTest::serialEmpty});
+}
+
+void ParallelTest::serial() {
+    Containers::Array<std::size_t> calls;
+    parallelForSerial(nullptr, 4, [](void* state, std::size_t i) {
+        arrayAppend(*static_cast<Containers::Array<std::size_t>*>(state), i);
+    }, &calls);
+    CORRADE_COMPARE_AS(calls, Containers::arrayView<std::size_t>({
+        0, 1, 2, 3
+    }), TestSuite::Compare::Container);
+}
+
+void ParallelTest::serialEmpty() {
+    std::size_t callCount = 0;
+    parallelForSerial(nullptr, 0, [](void* state, std::size_t) {
+        ++*static_cast<std::size_t*>(state);
+    }, &callCount);
+    CORRADE_COMPARE(callCount, 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Test::ParallelTest)
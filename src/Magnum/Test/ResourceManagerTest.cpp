@@ -26,7 +26,10 @@
 */
 
 #include <sstream>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
 #include <Corrade/Utility/FormatStl.h>
 
 #include "Magnum/AbstractResourceLoader.h"
@@ -51,12 +54,21 @@ struct ResourceManagerTest: TestSuite::Tester {
     void residentPolicy();
     void referenceCountedPolicy();
     void manualPolicy();
+    void cachedPolicy();
+    void memoryUsage();
+    void memoryBudgetReferenced();
+    void setSizeNullData();
     void defaults();
     void clear();
     void clearWhileReferenced();
+    void manyResources();
 
     void loader();
     void loaderSetNullptr();
+    void loaderPrefetch();
+    void loaderPrefetchList();
+    void loaderDependencies();
+    void loaderDependencyCycle();
 
     void debugResourceState();
     void debugResourceKey();
@@ -88,12 +100,21 @@ ResourceManagerTest::ResourceManagerTest() {
               &ResourceManagerTest::residentPolicy,
               &ResourceManagerTest::referenceCountedPolicy,
               &ResourceManagerTest::manualPolicy,
+              &ResourceManagerTest::cachedPolicy,
+              &ResourceManagerTest::memoryUsage,
+              &ResourceManagerTest::memoryBudgetReferenced,
+              &ResourceManagerTest::setSizeNullData,
               &ResourceManagerTest::defaults,
               &ResourceManagerTest::clear,
               &ResourceManagerTest::clearWhileReferenced,
+              &ResourceManagerTest::manyResources,
 
               &ResourceManagerTest::loader,
               &ResourceManagerTest::loaderSetNullptr,
+              &ResourceManagerTest::loaderPrefetch,
+              &ResourceManagerTest::loaderPrefetchList,
+              &ResourceManagerTest::loaderDependencies,
+              &ResourceManagerTest::loaderDependencyCycle,
 
               &ResourceManagerTest::debugResourceState,
               &ResourceManagerTest::debugResourceKey});
@@ -366,6 +387,121 @@ void ResourceManagerTest::referenceCountedPolicy() {
     CORRADE_COMPARE(rm.referenceCount<Data>(dataRefCountKey), 0);
 }
 
+void ResourceManagerTest::cachedPolicy() {
+    ResourceManager rm;
+    CORRADE_COMPARE(rm.memoryBudget<Data>(), ~std::size_t{});
+
+    /* Cached resources stay after all references are removed if there's no
+       budget */
+    rm.set("a", Containers::pointer<Data>(), ResourceDataState::Final, ResourcePolicy::Cached, 100);
+    {
+        Resource<Data> a = rm.get<Data>("a");
+        CORRADE_COMPARE(a.state(), ResourceState::Final);
+    }
+    CORRADE_COMPARE(rm.count<Data>(), 1);
+    CORRADE_COMPARE(Data::count, 1);
+
+    rm.set("b", Containers::pointer<Data>(), ResourceDataState::Final, ResourcePolicy::Cached, 100);
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 200);
+
+    /* Use "a" again, which makes "b" the least recently released */
+    {
+        Resource<Data> a = rm.get<Data>("a");
+    }
+
+    /* Exceeding the budget evicts "b" */
+    rm.setMemoryBudget<Data>(250);
+    CORRADE_COMPARE(rm.memoryBudget<Data>(), 250);
+    CORRADE_COMPARE(rm.count<Data>(), 2);
+    rm.set("c", Containers::pointer<Data>(), ResourceDataState::Final, ResourcePolicy::Cached, 100);
+    CORRADE_COMPARE(rm.count<Data>(), 2);
+    CORRADE_COMPARE(Data::count, 2);
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 200);
+    CORRADE_COMPARE(rm.state<Data>("a"), ResourceState::Final);
+    CORRADE_COMPARE(rm.state<Data>("b"), ResourceState::NotLoaded);
+    CORRADE_COMPARE(rm.state<Data>("c"), ResourceState::Final);
+
+    /* Lowering the budget evicts immediately, "a" first as it was released
+       before "c" was set */
+    rm.setMemoryBudget<Data>(150);
+    CORRADE_COMPARE(rm.count<Data>(), 1);
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 100);
+    CORRADE_COMPARE(rm.state<Data>("a"), ResourceState::NotLoaded);
+    CORRADE_COMPARE(rm.state<Data>("c"), ResourceState::Final);
+
+    /* free() deletes unreferenced cached resources as well */
+    rm.free();
+    CORRADE_COMPARE(rm.count<Data>(), 0);
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 0);
+    CORRADE_COMPARE(Data::count, 0);
+}
+
+void ResourceManagerTest::memoryUsage() {
+    ResourceManager rm;
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 0);
+    CORRADE_COMPARE(rm.size<Data>("a"), 0);
+
+    /* Sizes of all policies are counted */
+    rm.set("a", Containers::pointer<Data>(), ResourceDataState::Mutable, ResourcePolicy::Resident, 1000);
+    rm.set("b", Containers::pointer<Data>(), ResourceDataState::Final, ResourcePolicy::ReferenceCounted, 200);
+    rm.set("c", Containers::pointer<Data>(), ResourceDataState::Final, ResourcePolicy::Manual);
+    CORRADE_COMPARE(rm.size<Data>("a"), 1000);
+    CORRADE_COMPARE(rm.size<Data>("b"), 200);
+    CORRADE_COMPARE(rm.size<Data>("c"), 0);
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 1200);
+
+    /* Replacing the data replaces the size */
+    rm.set("a", Containers::pointer<Data>(), ResourceDataState::Final, ResourcePolicy::Resident, 300);
+    CORRADE_COMPARE(rm.size<Data>("a"), 300);
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 500);
+
+    /* Releasing a reference counted resource subtracts its size */
+    {
+        Resource<Data> b = rm.get<Data>("b");
+    }
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 300);
+
+    /* Budget doesn't affect other than cached resources */
+    rm.setMemoryBudget<Data>(10);
+    CORRADE_COMPARE(rm.count<Data>(), 2);
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 300);
+
+    /* Usage of other types is tracked separately */
+    rm.set("a", 5, ResourceDataState::Final, ResourcePolicy::Resident);
+    CORRADE_COMPARE(rm.memoryUsage<Int>(), 0);
+
+    rm.clear();
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 0);
+}
+
+void ResourceManagerTest::memoryBudgetReferenced() {
+    ResourceManager rm;
+    rm.setMemoryBudget<Data>(50);
+
+    /* The resource is referenced, so it stays even though over the budget */
+    Resource<Data> a = rm.get<Data>("a");
+    rm.set("a", Containers::pointer<Data>(), ResourceDataState::Final, ResourcePolicy::Cached, 100);
+    CORRADE_COMPARE(a.state(), ResourceState::Final);
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 100);
+
+    /* Once released, it gets evicted */
+    a = Resource<Data>{};
+    CORRADE_COMPARE(rm.count<Data>(), 0);
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 0);
+    CORRADE_COMPARE(Data::count, 0);
+}
+
+void ResourceManagerTest::setSizeNullData() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    ResourceManager rm;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    rm.set<Data>("a", nullptr, ResourceDataState::Loading, ResourcePolicy::Cached, 100);
+    CORRADE_COMPARE(out.str(), "ResourceManager::set(): size should be zero if data is null\n");
+}
+
 void ResourceManagerTest::manualPolicy() {
     ResourceManager rm;
 
@@ -427,6 +563,48 @@ void ResourceManagerTest::clearWhileReferenced() {
     CORRADE_COMPARE(out.str(), "ResourceManager: cleared/destroyed while data are still referenced\n");
 }
 
+void ResourceManagerTest::manyResources() {
+    /* Exercises growth and deletion in the internal hash table */
+    ResourceManager rm;
+    for(std::size_t i = 0; i != 1000; ++i)
+        rm.set(ResourceKey{i}, Int(i), ResourceDataState::Mutable, ResourcePolicy::Manual);
+    CORRADE_COMPARE(rm.count<Int>(), 1000);
+
+    /* Reference every third, free the rest */
+    std::vector<Resource<Int>> referenced;
+    for(std::size_t i = 0; i < 1000; i += 3)
+        referenced.push_back(rm.get<Int>(ResourceKey{i}));
+    rm.free();
+    CORRADE_COMPARE(rm.count<Int>(), 334);
+
+    for(std::size_t i = 0; i != 1000; ++i) {
+        CORRADE_ITERATION(i);
+        if(i % 3 == 0) {
+            CORRADE_COMPARE(rm.state<Int>(ResourceKey{i}), ResourceState::Mutable);
+            CORRADE_COMPARE(rm.referenceCount<Int>(ResourceKey{i}), 1);
+            CORRADE_COMPARE(*referenced[i/3], Int(i));
+        } else CORRADE_COMPARE(rm.state<Int>(ResourceKey{i}), ResourceState::NotLoaded);
+    }
+
+    /* Adding new resources reuses the freed storage, the referenced ones
+       stay intact */
+    for(std::size_t i = 1000; i != 1500; ++i)
+        rm.set(ResourceKey{i}, Int(i), ResourceDataState::Final, ResourcePolicy::Manual);
+    CORRADE_COMPARE(rm.count<Int>(), 834);
+    for(std::size_t i = 1000; i != 1500; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(*rm.get<Int>(ResourceKey{i}), Int(i));
+    }
+
+    /* Updating a referenced resource is visible through the reference */
+    rm.set(ResourceKey{999}, 7, ResourceDataState::Final, ResourcePolicy::Manual);
+    CORRADE_COMPARE(*referenced.back(), 7);
+
+    referenced.clear();
+    rm.free();
+    CORRADE_COMPARE(rm.count<Int>(), 0);
+}
+
 void ResourceManagerTest::loader() {
     class IntResourceLoader: public AbstractResourceLoader<Int> {
         public:
@@ -531,6 +709,170 @@ void ResourceManagerTest::loaderSetNullptr() {
     CORRADE_COMPARE(*world, 42);
 }
 
+/* Records what the base asked the loader to do */
+class RecordingResourceLoader: public AbstractResourceLoader<Int> {
+    public:
+        std::vector<std::string> calls;
+
+        void finish(ResourceKey key, Int value) {
+            set(key, value, ResourceDataState::Final, ResourcePolicy::Resident);
+        }
+
+    private:
+        static std::string keyName(ResourceKey key) {
+            for(const char* name: {"a", "b", "c", "d", "e"})
+                if(key == ResourceKey{name}) return name;
+            return "?";
+        }
+
+        void doLoad(ResourceKey key) override {
+            calls.push_back("load " + keyName(key));
+        }
+        void doPrefetch(ResourceKey key) override {
+            calls.push_back("prefetch " + keyName(key));
+        }
+        void doPromote(ResourceKey key) override {
+            calls.push_back("promote " + keyName(key));
+        }
+};
+
+void ResourceManagerTest::loaderPrefetch() {
+    ResourceManager rm;
+    Containers::Pointer<RecordingResourceLoader> loaderPtr{InPlaceInit};
+    RecordingResourceLoader& loader = *loaderPtr;
+    rm.setLoader<Int>(std::move(loaderPtr));
+
+    loader.prefetch("a");
+    CORRADE_COMPARE(rm.state<Int>("a"), ResourceState::Loading);
+    CORRADE_COMPARE(loader.requestedCount(), 1);
+
+    /* Prefetching again or prefetching something that's already there does
+       nothing */
+    rm.set<Int>("b", 3);
+    loader.prefetch("a");
+    loader.prefetch("b");
+    CORRADE_COMPARE(loader.requestedCount(), 1);
+
+    /* Requesting a prefetched resource that's still loading promotes it,
+       a loaded resource isn't promoted */
+    Resource<Int> a = rm.get<Int>("a");
+    Resource<Int> b = rm.get<Int>("b");
+    CORRADE_COMPARE(loader.requestedCount(), 1);
+    CORRADE_COMPARE_AS(loader.calls, (std::vector<std::string>{
+        "prefetch a",
+        "promote a"
+    }), TestSuite::Compare::Container);
+
+    loader.finish("a", 7);
+    CORRADE_COMPARE(a.state(), ResourceState::Final);
+    CORRADE_COMPARE(*a, 7);
+    CORRADE_COMPARE(loader.loadedCount(), 1);
+}
+
+void ResourceManagerTest::loaderPrefetchList() {
+    ResourceManager rm;
+    Containers::Pointer<RecordingResourceLoader> loaderPtr{InPlaceInit};
+    RecordingResourceLoader& loader = *loaderPtr;
+    rm.setLoader<Int>(std::move(loaderPtr));
+
+    /* Default doPrefetch() implementation delegates to doLoad() */
+    class ResourceLoader: public AbstractResourceLoader<Int> {
+        public:
+            std::vector<ResourceKey> loaded;
+
+        private:
+            void doLoad(ResourceKey key) override {
+                loaded.push_back(key);
+            }
+    };
+
+    ResourceManager rm2;
+    Containers::Pointer<ResourceLoader> loader2Ptr{InPlaceInit};
+    ResourceLoader& loader2 = *loader2Ptr;
+    rm2.setLoader<Int>(std::move(loader2Ptr));
+
+    loader.prefetch({"a", "b", "a", "c"});
+    CORRADE_COMPARE(loader.requestedCount(), 3);
+    CORRADE_COMPARE_AS(loader.calls, (std::vector<std::string>{
+        "prefetch a",
+        "prefetch b",
+        "prefetch c"
+    }), TestSuite::Compare::Container);
+
+    const ResourceKey keys[]{"a", "b"};
+    loader2.prefetch(keys);
+    CORRADE_COMPARE(rm2.state<Int>("a"), ResourceState::Loading);
+    CORRADE_COMPARE(rm2.state<Int>("b"), ResourceState::Loading);
+    CORRADE_COMPARE_AS(loader2.loaded, (std::vector<ResourceKey>{
+        "a", "b"
+    }), TestSuite::Compare::Container);
+}
+
+void ResourceManagerTest::loaderDependencies() {
+    ResourceManager rm;
+    Containers::Pointer<RecordingResourceLoader> loaderPtr{InPlaceInit};
+    RecordingResourceLoader& loader = *loaderPtr;
+    rm.setLoader<Int>(std::move(loaderPtr));
+
+    /* a depends on b and c, c depends on d */
+    loader.addDependency("a", "b");
+    loader.addDependency("a", "c");
+    loader.addDependency("c", "d");
+    /* Adding the same dependency again does nothing */
+    loader.addDependency("a", "b");
+    CORRADE_COMPARE_AS(loader.dependencies("a"), Containers::arrayView<ResourceKey>({
+        "b", "c"
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(loader.dependencies("c"), Containers::arrayView<ResourceKey>({
+        "d"
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(loader.dependencies("d").size(), 0);
+
+    /* Dependencies get prefetched before the resource, d is there already
+       so it isn't requested */
+    rm.set<Int>("d", 1);
+    loader.prefetch("c");
+    CORRADE_COMPARE(loader.requestedCount(), 1);
+
+    /* Loading a requests b and promotes the prefetched c */
+    Resource<Int> a = rm.get<Int>("a");
+    CORRADE_COMPARE(loader.requestedCount(), 3);
+    CORRADE_COMPARE(rm.state<Int>("b"), ResourceState::Loading);
+    CORRADE_COMPARE_AS(loader.calls, (std::vector<std::string>{
+        "prefetch c",
+        "load b",
+        "promote c",
+        "load a"
+    }), TestSuite::Compare::Container);
+
+    /* Requesting a resource that's still loading promotes the dependencies
+       that are still loading as well */
+    loader.calls.clear();
+    loader.finish("b", 2);
+    Resource<Int> a2 = rm.get<Int>("a");
+    CORRADE_COMPARE_AS(loader.calls, (std::vector<std::string>{
+        "promote a",
+        "promote c"
+    }), TestSuite::Compare::Container);
+}
+
+void ResourceManagerTest::loaderDependencyCycle() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    RecordingResourceLoader loader;
+    loader.addDependency("a", "b");
+    loader.addDependency("b", "c");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    loader.addDependency("a", "a");
+    loader.addDependency("c", "a");
+    CORRADE_COMPARE(out.str(), Utility::formatString(
+        "AbstractResourceLoader::addDependency(): dependency of ResourceKey(0x{0}) on ResourceKey(0x{0}) would create a cycle\n"
+        "AbstractResourceLoader::addDependency(): dependency of ResourceKey(0x{1}) on ResourceKey(0x{0}) would create a cycle\n",
+        ResourceKey{"a"}.hexString(), ResourceKey{"c"}.hexString()));
+}
+
 void ResourceManagerTest::debugResourceState() {
     std::ostringstream out;
     Debug{&out} << ResourceState::Loading << ResourceState(0xbe);
@@ -0,0 +1,162 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/ThreadPool.h"
+
+namespace Magnum { namespace Test { namespace {
+
+struct ThreadPoolTest: TestSuite::Tester {
+    explicit ThreadPoolTest();
+
+    void construct();
+    void constructDefaultThreadCount();
+
+    void parallelFor();
+    void parallelForUneven();
+    void parallelForNested();
+    void parallelForConcurrent();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+    std::size_t count;
+} ParallelForData[]{
+    {"single thread", 1, 1000},
+    {"empty", 4, 0},
+    {"single iteration", 4, 1},
+    {"less iterations than threads", 8, 3},
+    {"two threads", 2, 1000},
+    {"eight threads", 8, 100000},
+};
+
+ThreadPoolTest::ThreadPoolTest() {
+    addTests({&ThreadPoolTest::construct,
+              &ThreadPoolTest::constructDefaultThreadCount});
+
+    addInstancedTests({&ThreadPoolTest::parallelFor},
+        Containers::arraySize(ParallelForData));
+
+    addTests({&ThreadPoolTest::parallelForUneven,
+              &ThreadPoolTest::parallelForNested,
+              &ThreadPoolTest::parallelForConcurrent});
+}
+
+void ThreadPoolTest::construct() {
+    ThreadPool pool{3};
+    CORRADE_COMPARE(pool.threadCount(), 3);
+}
+
+void ThreadPoolTest::constructDefaultThreadCount() {
+    ThreadPool pool;
+    const UnsignedInt hardwareConcurrency = std::thread::hardware_concurrency();
+    CORRADE_COMPARE(pool.threadCount(), hardwareConcurrency ? hardwareConcurrency : 1);
+}
+
+/* Counts how many times each iteration was executed */
+void countIteration(void* const state, const std::size_t i) {
+    ++static_cast<std::atomic<UnsignedInt>*>(state)[i];
+}
+
+void ThreadPoolTest::parallelFor() {
+    auto&& data = ParallelForData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ThreadPool pool{data.threadCount};
+    Containers::Array<std::atomic<UnsignedInt>> counts{data.count};
+    ThreadPool::parallelFor(&pool, data.count, countIteration, counts.data());
+
+    std::size_t wrong = 0;
+    for(const std::atomic<UnsignedInt>& i: counts)
+        if(i != 1) ++wrong;
+    CORRADE_COMPARE(wrong, 0);
+}
+
+void ThreadPoolTest::parallelForUneven() {
+    /* All the expensive iterations are in the first range, they should get
+       stolen by other threads. Not testing timing, only that every
+       iteration is still executed exactly once. */
+    ThreadPool pool{4};
+    Containers::Array<std::atomic<UnsignedInt>> counts{1000};
+    ThreadPool::parallelFor(&pool, counts.size(), [](void* const state, const std::size_t i) {
+        if(i < 100) std::this_thread::sleep_for(std::chrono::microseconds{100});
+        countIteration(state, i);
+    }, counts.data());
+
+    std::size_t wrong = 0;
+    for(const std::atomic<UnsignedInt>& i: counts)
+        if(i != 1) ++wrong;
+    CORRADE_COMPARE(wrong, 0);
+}
+
+void ThreadPoolTest::parallelForNested() {
+    ThreadPool pool{4};
+    struct State {
+        ThreadPool* pool;
+        Containers::Array<std::atomic<UnsignedInt>> counts{100*50};
+    } state;
+    state.pool = &pool;
+
+    /* Each outer iteration executes an inner loop on the same pool, which
+       shouldn't deadlock even if all workers are busy */
+    ThreadPool::parallelFor(&pool, 100, [](void* const state, const std::size_t i) {
+        State& s = *static_cast<State*>(state);
+        ThreadPool::parallelFor(s.pool, 50, countIteration, s.counts.data() + i*50);
+    }, &state);
+
+    std::size_t wrong = 0;
+    for(const std::atomic<UnsignedInt>& i: state.counts)
+        if(i != 1) ++wrong;
+    CORRADE_COMPARE(wrong, 0);
+}
+
+void ThreadPoolTest::parallelForConcurrent() {
+    ThreadPool pool{4};
+    Containers::Array<std::atomic<UnsignedInt>> counts{4*10000};
+
+    /* Multiple external threads submitting to the same pool at once */
+    Containers::Array<std::thread> threads{4};
+    for(std::size_t t = 0; t != threads.size(); ++t) threads[t] = std::thread{[&pool, &counts, t]() {
+        ThreadPool::parallelFor(&pool, 10000, countIteration, counts.data() + t*10000);
+    }};
+    for(std::thread& thread: threads) thread.join();
+
+    std::size_t wrong = 0;
+    for(const std::atomic<UnsignedInt>& i: counts)
+        if(i != 1) ++wrong;
+    CORRADE_COMPARE(wrong, 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Test::ThreadPoolTest)
@@ -0,0 +1,198 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/TiledImageView.h"
+#include "Magnum/Math/Color.h"
+
+namespace Magnum { namespace Test { namespace {
+
+struct TiledImageViewTest: TestSuite::Tester {
+    explicit TiledImageViewTest();
+
+    void construct();
+    void constructMutable();
+    void construct3D();
+
+    void constructInvalidTileSize();
+    void constructWrongTileCount();
+    void tileOutOfRange();
+    void tileNotResident();
+};
+
+TiledImageViewTest::TiledImageViewTest() {
+    addTests({&TiledImageViewTest::construct,
+              &TiledImageViewTest::constructMutable,
+              &TiledImageViewTest::construct3D,
+
+              &TiledImageViewTest::constructInvalidTileSize,
+              &TiledImageViewTest::constructWrongTileCount,
+              &TiledImageViewTest::tileOutOfRange,
+              &TiledImageViewTest::tileNotResident});
+}
+
+void TiledImageViewTest::construct() {
+    /* 5x3 image in 4x2 tiles, so the right and top tiles are only partially
+       covered */
+    const Color3ub tile00[8]{
+        {0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0},
+        {0, 1, 0}, {1, 1, 0}, {2, 1, 0}, {3, 1, 0}
+    };
+    const Color3ub tile11[8]{
+        {4, 2, 0}, {}, {}, {},
+        {}, {}, {}, {}
+    };
+    const char* const tiles[]{
+        reinterpret_cast<const char*>(tile00), nullptr,
+        nullptr, reinterpret_cast<const char*>(tile11)
+    };
+
+    TiledImageView2D view{PixelFormat::RGB8Unorm, {5, 3}, {4, 2}, tiles};
+    CORRADE_COMPARE(view.format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(view.pixelSize(), 3);
+    CORRADE_COMPARE(view.size(), (Vector2i{5, 3}));
+    CORRADE_COMPARE(view.tileSize(), (Vector2i{4, 2}));
+    CORRADE_COMPARE(view.tileCount(), (Vector2i{2, 2}));
+    CORRADE_COMPARE(view.tileDataSize(), 24);
+    CORRADE_COMPARE(view.tiles().data(), static_cast<const void*>(tiles));
+    CORRADE_COMPARE(view.residentTileCount(), 2);
+
+    CORRADE_VERIFY(view.isTileResident({0, 0}));
+    CORRADE_VERIFY(!view.isTileResident({1, 0}));
+    CORRADE_VERIFY(!view.isTileResident({0, 1}));
+    CORRADE_VERIFY(view.isTileResident({1, 1}));
+
+    CORRADE_COMPARE(view.tileRange({0, 0}), (Range2Di{{0, 0}, {4, 2}}));
+    CORRADE_COMPARE(view.tileRange({1, 0}), (Range2Di{{4, 0}, {5, 2}}));
+    CORRADE_COMPARE(view.tileRange({1, 1}), (Range2Di{{4, 2}, {5, 3}}));
+
+    ImageView2D first = view.tile({0, 0});
+    CORRADE_COMPARE(first.format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(first.size(), (Vector2i{4, 2}));
+    CORRADE_COMPARE(first.data().data(), static_cast<const void*>(tile00));
+    CORRADE_COMPARE(first.pixels<Color3ub>()[1][2], (Color3ub{2, 1, 0}));
+
+    /* The edge tile is smaller but the rows are still the whole tile wide */
+    ImageView2D last = view.tile({1, 1});
+    CORRADE_COMPARE(last.size(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(last.storage().rowLength(), 4);
+    CORRADE_COMPARE(last.data().data(), static_cast<const void*>(tile11));
+    CORRADE_COMPARE(last.pixels<Color3ub>()[0][0], (Color3ub{4, 2, 0}));
+}
+
+void TiledImageViewTest::constructMutable() {
+    UnsignedByte tile0[4]{};
+    UnsignedByte tile1[4]{};
+    char* const tiles[]{
+        reinterpret_cast<char*>(tile0), reinterpret_cast<char*>(tile1)
+    };
+
+    MutableTiledImageView2D view{PixelFormat::R8Unorm, {4, 2}, {2, 2}, tiles};
+    MutableImageView2D second = view.tile({1, 0});
+    second.pixels<UnsignedByte>()[1][0] = 37;
+    CORRADE_COMPARE(tile1[2], 37);
+}
+
+void TiledImageViewTest::construct3D() {
+    UnsignedShort tile[8]{0, 1, 2, 3, 4, 5, 6, 7};
+    const char* const tiles[]{
+        nullptr, nullptr, nullptr, reinterpret_cast<const char*>(tile)
+    };
+
+    TiledImageView3D view{PixelFormat::R16Unorm, {3, 4, 2}, {2, 2, 2}, tiles};
+    CORRADE_COMPARE(view.tileCount(), (Vector3i{2, 2, 1}));
+    CORRADE_COMPARE(view.tileDataSize(), 16);
+    CORRADE_VERIFY(!view.isTileResident({1, 0, 0}));
+    CORRADE_VERIFY(view.isTileResident({1, 1, 0}));
+
+    /* Slices are the whole tile high */
+    ImageView3D last = view.tile({1, 1, 0});
+    CORRADE_COMPARE(last.size(), (Vector3i{1, 2, 2}));
+    CORRADE_COMPARE(last.storage().imageHeight(), 2);
+    CORRADE_COMPARE(last.pixels<UnsignedShort>()[1][1][0], 6);
+}
+
+void TiledImageViewTest::constructInvalidTileSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    TiledImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, {4, 0}, nullptr};
+    CORRADE_COMPARE(out.str(), "TiledImageView: expected a positive tile size but got {4, 0}\n");
+}
+
+void TiledImageViewTest::constructWrongTileCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char* const tiles[3]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    TiledImageView2D{PixelFormat::RGBA8Unorm, {5, 4}, {4, 2}, tiles};
+    CORRADE_COMPARE(out.str(), "TiledImageView: expected 4 tiles for a {5, 4} image with {4, 2} tiles but got 3\n");
+}
+
+void TiledImageViewTest::tileOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    /* The first tile is resident so the out-of-range tile() call doesn't
+       additionally complain about it not being resident */
+    const char data[32]{};
+    const char* const tiles[]{data, nullptr, nullptr, nullptr};
+    TiledImageView2D view{PixelFormat::RGBA8Unorm, {5, 4}, {4, 2}, tiles};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    view.isTileResident({2, 0});
+    view.tileRange({0, -1});
+    view.tile({1, 2});
+    CORRADE_COMPARE(out.str(),
+        "TiledImageView::isTileResident(): tile {2, 0} out of range for {2, 2} tiles\n"
+        "TiledImageView::tileRange(): tile {0, -1} out of range for {2, 2} tiles\n"
+        "TiledImageView::tile(): tile {1, 2} out of range for {2, 2} tiles\n");
+}
+
+void TiledImageViewTest::tileNotResident() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[32]{};
+    const char* const tiles[]{data, nullptr};
+    TiledImageView2D view{PixelFormat::RGBA8Unorm, {4, 2}, {2, 2}, tiles};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    view.tile({1, 0});
+    CORRADE_COMPARE(out.str(), "TiledImageView::tile(): tile {1, 0} is not resident\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Test::TiledImageViewTest)
@@ -24,23 +24,44 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
 #include <Corrade/Utility/System.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Timeline.h"
+#include "Magnum/Math/Time.h"
 
 namespace Magnum { namespace Test { namespace {
 
+using namespace Math::Literals;
+
 struct TimelineTest: TestSuite::Tester {
     explicit TimelineTest();
 
     void test();
+    void smoothedFrameDuration();
+    void fixedStep();
+    void fixedStepMaxCount();
+    void fixedStepDisabled();
+
+    void setFrameDurationSmoothingInvalid();
+    void setFixedTimeStepInvalid();
+    void setMaxFixedStepCountInvalid();
 };
 
 TimelineTest::TimelineTest() {
-    addTests({&TimelineTest::test});
+    addTests({&TimelineTest::test,
+              &TimelineTest::smoothedFrameDuration,
+              &TimelineTest::fixedStep,
+              &TimelineTest::fixedStepMaxCount,
+              &TimelineTest::fixedStepDisabled,
+
+              &TimelineTest::setFrameDurationSmoothingInvalid,
+              &TimelineTest::setFixedTimeStepInvalid,
+              &TimelineTest::setMaxFixedStepCountInvalid});
 }
 
 void TimelineTest::test() {
@@ -168,6 +189,159 @@ void TimelineTest::test() {
     CORRADE_COMPARE(timeline.currentFrameDuration(), 0.0f);
 }
 
+void TimelineTest::smoothedFrameDuration() {
+    constexpr std::size_t ms = 50;
+    constexpr Float s = 0.001f*ms;
+    constexpr Float epsilon = 0.01f;
+
+    Timeline timeline;
+    CORRADE_COMPARE(timeline.frameDurationSmoothing(), 0.1f);
+    CORRADE_COMPARE(timeline.smoothedFrameDuration(), 0.0f);
+    CORRADE_COMPARE(timeline.previousFrameDurationNanoseconds(), 0_nsec);
+
+    timeline.setFrameDurationSmoothing(0.25f);
+    CORRADE_COMPARE(timeline.frameDurationSmoothing(), 0.25f);
+
+    /* The first frame initializes the average */
+    timeline.start();
+    Utility::System::sleep(ms);
+    timeline.nextFrame();
+    CORRADE_COMPARE(timeline.smoothedFrameDuration(), timeline.previousFrameDuration());
+    CORRADE_COMPARE_AS(timeline.previousFrameDurationNanoseconds(), (s - epsilon)*1.0_sec,
+        TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE_WITH(Float(Double(timeline.previousFrameDurationNanoseconds())/1.0e9),
+        timeline.previousFrameDuration(),
+        TestSuite::Compare::around(0.0001f));
+
+    /* A very short frame makes the average go down only by a fraction */
+    const Float first = timeline.smoothedFrameDuration();
+    timeline.nextFrame();
+    CORRADE_COMPARE_AS(timeline.smoothedFrameDuration(), first,
+        TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(timeline.smoothedFrameDuration(), first*0.75f - epsilon,
+        TestSuite::Compare::GreaterOrEqual);
+
+    /* Stopping resets it */
+    timeline.stop();
+    CORRADE_COMPARE(timeline.smoothedFrameDuration(), 0.0f);
+    CORRADE_COMPARE(timeline.previousFrameDurationNanoseconds(), 0_nsec);
+}
+
+void TimelineTest::fixedStep() {
+    constexpr std::size_t ms = 50;
+
+    Timeline timeline;
+    CORRADE_COMPARE(timeline.fixedTimeStep(), 0.0f);
+    CORRADE_COMPARE(timeline.maxFixedStepCount(), 8);
+    CORRADE_COMPARE(timeline.fixedStepCount(), 0);
+    CORRADE_COMPARE(timeline.fixedStepInterpolation(), 0.0f);
+
+    timeline.setFixedTimeStep(0.02f);
+    CORRADE_COMPARE(timeline.fixedTimeStep(), 0.02f);
+
+    /* Nothing accumulated right after start */
+    timeline.start();
+    CORRADE_COMPARE(timeline.fixedStepCount(), 0);
+    CORRADE_COMPARE(timeline.fixedStepInterpolation(), 0.0f);
+
+    /* At least 50 ms elapsed, so at least two 20 ms steps. Can't reliably
+       test an upper bound, same as in test() above. */
+    Utility::System::sleep(ms);
+    timeline.nextFrame();
+    CORRADE_COMPARE_AS(timeline.fixedStepCount(), 2,
+        TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE_AS(timeline.fixedStepInterpolation(), 0.0f,
+        TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE_AS(timeline.fixedStepInterpolation(), 1.0f,
+        TestSuite::Compare::Less);
+
+    /* The steps and the remainder add up to the frame duration, unless the
+       max step count was hit */
+    if(timeline.fixedStepCount() < timeline.maxFixedStepCount())
+        CORRADE_COMPARE_WITH(
+            (timeline.fixedStepCount() + timeline.fixedStepInterpolation())*timeline.fixedTimeStep(),
+            timeline.previousFrameDuration(),
+            TestSuite::Compare::around(0.0001f));
+
+    /* Stopping resets the accumulator */
+    timeline.stop();
+    CORRADE_COMPARE(timeline.fixedStepCount(), 0);
+    CORRADE_COMPARE(timeline.fixedStepInterpolation(), 0.0f);
+}
+
+void TimelineTest::fixedStepMaxCount() {
+    constexpr std::size_t ms = 50;
+
+    Timeline timeline;
+    timeline
+        .setFixedTimeStep(0.005f)
+        .setMaxFixedStepCount(3);
+    CORRADE_COMPARE(timeline.maxFixedStepCount(), 3);
+
+    /* At least ten steps elapsed, but only three are reported and the rest
+       is discarded */
+    timeline.start();
+    Utility::System::sleep(ms);
+    timeline.nextFrame();
+    CORRADE_COMPARE(timeline.fixedStepCount(), 3);
+    CORRADE_COMPARE_AS(timeline.fixedStepInterpolation(), 1.0f,
+        TestSuite::Compare::Less);
+
+    /* Changing the step resets the accumulator */
+    timeline.setFixedTimeStep(0.01f);
+    CORRADE_COMPARE(timeline.fixedStepCount(), 0);
+    CORRADE_COMPARE(timeline.fixedStepInterpolation(), 0.0f);
+}
+
+void TimelineTest::fixedStepDisabled() {
+    constexpr std::size_t ms = 50;
+
+    Timeline timeline;
+    timeline.start();
+    Utility::System::sleep(ms);
+    timeline.nextFrame();
+    CORRADE_COMPARE(timeline.fixedStepCount(), 0);
+    CORRADE_COMPARE(timeline.fixedStepInterpolation(), 0.0f);
+}
+
+void TimelineTest::setFrameDurationSmoothingInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Timeline timeline;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    timeline.setFrameDurationSmoothing(0.0f);
+    timeline.setFrameDurationSmoothing(1.5f);
+    CORRADE_COMPARE(out.str(),
+        "Timeline::setFrameDurationSmoothing(): expected factor in range (0, 1], got 0\n"
+        "Timeline::setFrameDurationSmoothing(): expected factor in range (0, 1], got 1.5\n");
+}
+
+void TimelineTest::setFixedTimeStepInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Timeline timeline;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    timeline.setFixedTimeStep(-0.5f);
+    CORRADE_COMPARE(out.str(),
+        "Timeline::setFixedTimeStep(): expected a non-negative value, got -0.5\n");
+}
+
+void TimelineTest::setMaxFixedStepCountInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Timeline timeline;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    timeline.setMaxFixedStepCount(0);
+    CORRADE_COMPARE(out.str(),
+        "Timeline::setMaxFixedStepCount(): expected a non-zero count\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Test::TimelineTest)
@@ -68,6 +68,7 @@ struct VertexFormatTest: TestSuite::Tester {
     void assemble();
     void assembleRoundtrip();
     void assembleCantNormalize();
+    void assemblePacked();
     void assembleInvalidComponentCount();
     void assembleImplementationSpecific();
 
@@ -161,6 +162,7 @@ VertexFormatTest::VertexFormatTest() {
         Containers::arraySize(AssembleRoundtripData));
 
     addTests({&VertexFormatTest::assembleCantNormalize,
+              &VertexFormatTest::assemblePacked,
               &VertexFormatTest::assembleInvalidComponentCount,
               &VertexFormatTest::assembleImplementationSpecific,
 
@@ -269,6 +271,10 @@ void VertexFormatTest::size() {
     /* Aligned types */
     CORRADE_COMPARE(vertexFormatSize(VertexFormat::Matrix2x2bNormalized), sizeof(Matrix2x2b));
     CORRADE_COMPARE(vertexFormatSize(VertexFormat::Matrix2x2bNormalizedAligned), sizeof(Matrix2x4b));
+
+    /* Packed types */
+    CORRADE_COMPARE(vertexFormatSize(VertexFormat::Vector3i1010102Normalized), 4);
+    CORRADE_COMPARE(vertexFormatSize(VertexFormat::Vector4ui1010102Normalized), 4);
 }
 
 void VertexFormatTest::sizeInvalid() {
@@ -306,6 +312,11 @@ void VertexFormatTest::componentCount() {
     /* Aligned types return used component count, w/o padding */
     CORRADE_COMPARE(vertexFormatComponentCount(VertexFormat::Matrix2x3sNormalized), 3);
     CORRADE_COMPARE(vertexFormatComponentCount(VertexFormat::Matrix2x3sNormalizedAligned), 3);
+
+    /* Packed types return the logical component count */
+    CORRADE_COMPARE(vertexFormatComponentCount(VertexFormat::Vector3i1010102Normalized), 3);
+    CORRADE_COMPARE(vertexFormatComponentCount(VertexFormat::Vector4i1010102Normalized), 4);
+    CORRADE_COMPARE(vertexFormatComponentCount(VertexFormat::Vector4ui1010102Normalized), 4);
 }
 
 void VertexFormatTest::componentCountInvalid() {
@@ -351,6 +362,10 @@ void VertexFormatTest::componentFormat() {
     CORRADE_COMPARE(vertexFormatComponentFormat(VertexFormat::Matrix4x2bNormalizedAligned), VertexFormat::Byte);
     CORRADE_COMPARE(vertexFormatComponentFormat(VertexFormat::Matrix2x3sNormalized), VertexFormat::Short);
     CORRADE_COMPARE(vertexFormatComponentFormat(VertexFormat::Matrix2x3sNormalizedAligned), VertexFormat::Short);
+
+    /* Packed types return themselves */
+    CORRADE_COMPARE(vertexFormatComponentFormat(VertexFormat::Vector3i1010102Normalized), VertexFormat::Vector3i1010102Normalized);
+    CORRADE_COMPARE(vertexFormatComponentFormat(VertexFormat::Vector4ui1010102Normalized), VertexFormat::Vector4ui1010102Normalized);
 }
 
 void VertexFormatTest::componentFormatInvalid() {
@@ -387,6 +402,8 @@ void VertexFormatTest::vectorCount() {
     CORRADE_COMPARE(vertexFormatVectorCount(VertexFormat::Matrix3x2bNormalized), 3);
     CORRADE_COMPARE(vertexFormatVectorCount(VertexFormat::Matrix3x2bNormalizedAligned), 3);
     CORRADE_COMPARE(vertexFormatVectorCount(VertexFormat::Matrix4x3), 4);
+
+    CORRADE_COMPARE(vertexFormatVectorCount(VertexFormat::Vector3i1010102Normalized), 1);
 }
 
 void VertexFormatTest::vectorCountInvalid() {
@@ -425,6 +442,9 @@ void VertexFormatTest::vectorStride() {
     /* Aligned formats */
     CORRADE_COMPARE(vertexFormatVectorStride(VertexFormat::Matrix3x2bNormalized), 2);
     CORRADE_COMPARE(vertexFormatVectorStride(VertexFormat::Matrix3x2bNormalizedAligned), 4);
+
+    /* Packed formats */
+    CORRADE_COMPARE(vertexFormatVectorStride(VertexFormat::Vector3i1010102Normalized), 4);
 }
 
 void VertexFormatTest::vectorStrideInvalid() {
@@ -459,6 +479,9 @@ void VertexFormatTest::isNormalized() {
 
     CORRADE_VERIFY(!isVertexFormatNormalized(VertexFormat::Matrix2x2h));
     CORRADE_VERIFY(isVertexFormatNormalized(VertexFormat::Matrix2x3bNormalized));
+
+    CORRADE_VERIFY(isVertexFormatNormalized(VertexFormat::Vector4i1010102Normalized));
+    CORRADE_VERIFY(isVertexFormatNormalized(VertexFormat::Vector4ui1010102Normalized));
 }
 
 void VertexFormatTest::isNormalizedInvalid() {
@@ -533,6 +556,16 @@ void VertexFormatTest::assembleCantNormalize() {
         "vertexFormat(): VertexFormat::Vector2 can't be made normalized\n");
 }
 
+void VertexFormatTest::assemblePacked() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    vertexFormat(VertexFormat::Vector4ui1010102Normalized, 3, false);
+    CORRADE_COMPARE(out.str(),
+        "vertexFormat(): can't assemble a format out of a packed format VertexFormat::Vector4ui1010102Normalized\n");
+}
+
 void VertexFormatTest::assembleInvalidComponentCount() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -0,0 +1,66 @@
+#ifndef Magnum_Test_parallelFor_h
+#define Magnum_Test_parallelFor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Executors for testing the ParallelFor integration points of MeshTools,
+   SceneTools, TextureTools and other libraries. Test-only, not installed. */
+
+#include <cstddef>
+#include <Corrade/Corrade.h>
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <atomic>
+#include <thread>
+#include <Corrade/Containers/Array.h>
+#endif
+
+namespace Magnum { namespace Test {
+
+/* Executes the tasks in reverse order to verify the result doesn't depend on
+   it */
+inline void parallelForReverse(void*, std::size_t count, void(*task)(void*, std::size_t), void* taskState) {
+    for(std::size_t i = count; i != 0; --i)
+        task(taskState, i - 1);
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+/* Executes the tasks on as many threads as is passed in the state, each
+   picking the next unprocessed task */
+inline void parallelForThreads(void* state, std::size_t count, void(*task)(void*, std::size_t), void* taskState) {
+    std::atomic<std::size_t> next{0};
+    Corrade::Containers::Array<std::thread> threads{*static_cast<std::size_t*>(state)};
+    for(std::thread& thread: threads) thread = std::thread{[&]() {
+        for(std::size_t i; (i = next++) < count; )
+            task(taskState, i);
+    }};
+    for(std::thread& thread: threads) thread.join();
+}
+#endif
+
+}}
+
+#endif
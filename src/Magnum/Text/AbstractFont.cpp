@@ -493,6 +493,7 @@ Debug& operator<<(Debug& debug, const FontFeature value) {
         _c(OpenData)
         _c(FileCallback)
         _c(PreparedGlyphCache)
+        _c(ConcurrentShaping)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -504,7 +505,8 @@ Debug& operator<<(Debug& debug, const FontFeatures value) {
     return Containers::enumSetDebugOutput(debug, value, debug.immediateFlags() >= Debug::Flag::Packed ? "{}" : "Text::FontFeatures{}", {
         FontFeature::OpenData,
         FontFeature::FileCallback,
-        FontFeature::PreparedGlyphCache});
+        FontFeature::PreparedGlyphCache,
+        FontFeature::ConcurrentShaping});
 }
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -77,6 +77,18 @@ enum class FontFeature: UnsignedByte {
      */
     PreparedGlyphCache = 1 << 2,
 
+    /**
+     * Different @ref AbstractShaper instances returned from
+     * @ref AbstractFont::createShaper() can be used concurrently from
+     * multiple threads, as long as each instance is used only from a single
+     * thread at a time and the font itself isn't modified, closed or
+     * destroyed meanwhile. Creating the shapers themselves isn't guaranteed
+     * to be thread-safe.
+     * @see @ref Text-AbstractShaper-usage-threads, @ref shapeRuns()
+     * @m_since_latest
+     */
+    ConcurrentShaping = 1 << 3,
+
     /* Glyph names are not exposed as a feature because even though the
        implementation may support these, a particular font file may not, and
        it'd give a false impression. */
@@ -26,16 +26,20 @@
 
 #include "AbstractGlyphCache.h"
 
+#include <algorithm> /* std::partial_sort() */
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/Triple.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Move.h>
 
 #include "Magnum/Image.h"
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/TextureTools/Atlas.h"
 
@@ -120,6 +124,23 @@ struct AbstractGlyphCache::State {
        practice, in which case the type would simply get changed to a 32-bit
        one (and the assertion in addGlyph() then removed). */
     Containers::Array<UnsignedShort> fontGlyphMapping;
+
+    /* Index of the item is ID of the glyph in the cache, same as in the
+       `glyphs` array. First element is index into `fontGlyphMapping` the
+       glyph is referenced from, or ~UnsignedInt{} if the glyph was evicted
+       (and for the invalid glyph), second is the value of `useCounter` at
+       the time the glyph was last marked as used. */
+    Containers::Array<Containers::Pair<UnsignedInt, UnsignedLong>> glyphUsage;
+    /* IDs of evicted glyphs that get reused by next addGlyph() calls */
+    Containers::Array<UnsignedInt> freeGlyphs;
+    UnsignedLong useCounter = 0;
+
+    /* Padded rectangles of glyphs added since they were last flushed. During
+       doSetImage() the `flushedGlyphRectangles` view points to a suffix of it
+       that contains the ones intersecting the flushed range, clipped to it,
+       which gets removed right after. */
+    Containers::Array<Range3Di> dirtyGlyphRectangles;
+    Containers::ArrayView<const Range3Di> flushedGlyphRectangles;
 };
 
 AbstractGlyphCache::AbstractGlyphCache(const PixelFormat format, const Vector3i& size, const PixelFormat processedFormat, const Vector2i& processedSize, const Vector2i& padding) {
@@ -132,8 +153,9 @@ AbstractGlyphCache::AbstractGlyphCache(const PixelFormat format, const Vector3i&
        assert on zero size as well */
     _state.emplace(format, size, processedFormat, processedSize, padding);
 
-    /* Default invalid glyph -- empty / zero-area */
+    /* Default invalid glyph -- empty / zero-area, never evicted */
     arrayAppend(_state->glyphs, InPlaceInit);
+    arrayAppend(_state->glyphUsage, InPlaceInit, ~UnsignedInt{}, UnsignedLong{});
 
     /* There are no fonts yet */
     arrayAppend(_state->fonts, InPlaceInit, 0u, nullptr);
@@ -344,13 +366,31 @@ UnsignedInt AbstractGlyphCache::addGlyph(const UnsignedInt fontId, const Unsigne
     CORRADE_ASSERT(UnsignedInt(layer) < UnsignedInt(state.image.size().z()) && (rectangleu.min() <= rectangleu.max()).all() && (rectanglePaddedu.min() <= Vector2ui{state.image.size().xy()}).all() && (rectanglePaddedu.max() <= Vector2ui{state.image.size().xy()}).all(),
         "Text::AbstractGlyphCache::addGlyph(): layer" << layer << "and rectangle" << Debug::packed << rectangle << "out of range for size" << Debug::packed << state.image.size() << "and padding" << Debug::packed << state.padding, {});
 
-    const UnsignedInt glyphId = state.glyphs.size();
-    /* The fontGlyphMapping entries are 16-bit to save memory, can't have IDs
-       beyond that. See its documentation for more reasoning. */
-    CORRADE_ASSERT(glyphId < 65536,
-        "Text::AbstractGlyphCache::addGlyph(): only at most 65536 glyphs can be added", {});
+    /* Reuse IDs of evicted glyphs first */
+    UnsignedInt glyphId;
+    if(!state.freeGlyphs.isEmpty()) {
+        glyphId = state.freeGlyphs.back();
+        arrayRemoveSuffix(state.freeGlyphs);
+        state.glyphs[glyphId] = {offset - _state->padding, layer, rectangle.padded(_state->padding)};
+        state.glyphUsage[glyphId] = {fontOffset + fontGlyphId, state.useCounter};
+    } else {
+        glyphId = state.glyphs.size();
+        /* The fontGlyphMapping entries are 16-bit to save memory, can't have
+           IDs beyond that. See its documentation for more reasoning. */
+        CORRADE_ASSERT(glyphId < 65536,
+            "Text::AbstractGlyphCache::addGlyph(): only at most 65536 glyphs can be added", {});
+        arrayAppend(state.glyphs, InPlaceInit, offset - _state->padding, layer, rectangle.padded(_state->padding));
+        arrayAppend(state.glyphUsage, InPlaceInit, fontOffset + fontGlyphId, state.useCounter);
+    }
     state.fontGlyphMapping[fontOffset + fontGlyphId] = glyphId;
-    arrayAppend(state.glyphs, InPlaceInit, offset - _state->padding, layer, rectangle.padded(_state->padding));
+
+    /* Remember the glyph area for the next flushImage(). Empty glyphs have
+       nothing to process so they're not remembered. */
+    const Range2Di& rectanglePadded = state.glyphs[glyphId].third();
+    if(rectanglePadded.sizeX() && rectanglePadded.sizeY())
+        arrayAppend(state.dirtyGlyphRectangles, InPlaceInit,
+            Vector3i{rectanglePadded.min(), layer},
+            Vector3i{rectanglePadded.max(), layer + 1});
     return glyphId;
 }
 
@@ -387,6 +427,69 @@ void AbstractGlyphCache::insert(const UnsignedInt glyph, const Vector2i& offset,
 }
 #endif
 
+void AbstractGlyphCache::markGlyphsUsed(const Containers::StridedArrayView1D<const UnsignedInt>& glyphIds) {
+    State& state = *_state;
+    ++state.useCounter;
+    for(std::size_t i = 0; i != glyphIds.size(); ++i) {
+        const UnsignedInt glyphId = glyphIds[i];
+        CORRADE_DEBUG_ASSERT(glyphId < state.glyphs.size(),
+            "Text::AbstractGlyphCache::markGlyphsUsed(): glyph" << i << "index" << glyphId << "out of range for" << state.glyphs.size() << "glyphs", );
+        state.glyphUsage[glyphId].second() = state.useCounter;
+    }
+}
+
+void AbstractGlyphCache::markGlyphsUsed(const std::initializer_list<UnsignedInt> glyphIds) {
+    markGlyphsUsed(Containers::arrayView(glyphIds));
+}
+
+UnsignedInt AbstractGlyphCache::evictGlyphs(const UnsignedInt count) {
+    State& state = *_state;
+
+    /* Gather all glyphs that can be evicted, i.e. not the invalid glyph and
+       not glyphs that were evicted already, and sort them by last use. Glyph
+       ID is used as a secondary key to have the order deterministic. */
+    Containers::Array<Containers::Pair<UnsignedLong, UnsignedInt>> candidates;
+    arrayReserve(candidates, state.glyphs.size() - state.freeGlyphs.size() - 1);
+    for(UnsignedInt i = 1; i != state.glyphUsage.size(); ++i)
+        if(state.glyphUsage[i].first() != ~UnsignedInt{})
+            arrayAppend(candidates, InPlaceInit, state.glyphUsage[i].second(), i);
+    const std::size_t evictedCount = Math::min(std::size_t{count}, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + evictedCount, candidates.end(), [](const Containers::Pair<UnsignedLong, UnsignedInt>& a, const Containers::Pair<UnsignedLong, UnsignedInt>& b) {
+        return a.first() == b.first() ? a.second() < b.second() : a.first() < b.first();
+    });
+
+    for(const Containers::Pair<UnsignedLong, UnsignedInt>& candidate: candidates.prefix(evictedCount)) {
+        const UnsignedInt glyphId = candidate.second();
+        Containers::Triple<Vector2i, Int, Range2Di>& glyph = state.glyphs[glyphId];
+
+        /* Give the area back to the atlas packer and clear it in the image,
+           so when it gets reused by another glyph, its padding doesn't
+           contain leftovers from the evicted one. The GPU-side data don't
+           need to be updated, as the area gets uploaded again on
+           flushImage() once it's reused. */
+        state.atlas.remove(glyph.second(), glyph.third());
+        const Containers::StridedArrayView3D<char> pixels = state.image.pixels()[glyph.second()];
+        for(Containers::StridedArrayView2D<char> row: pixels.sliceSize(
+            {std::size_t(glyph.third().min().y()),
+             std::size_t(glyph.third().min().x()), 0},
+            {std::size_t(glyph.third().sizeY()),
+             std::size_t(glyph.third().sizeX()), pixels.size()[2]}))
+            for(Containers::StridedArrayView1D<char> pixel: row)
+                for(char& byte: pixel)
+                    byte = 0;
+
+        /* Make the font glyph map to the invalid glyph again, reset the glyph
+           properties to make stale references to it render as empty and put
+           its ID to the free list */
+        state.fontGlyphMapping[state.glyphUsage[glyphId].first()] = 0;
+        state.glyphUsage[glyphId].first() = ~UnsignedInt{};
+        glyph = {};
+        arrayAppend(state.freeGlyphs, glyphId);
+    }
+
+    return evictedCount;
+}
+
 MutableImageView3D AbstractGlyphCache::image() {
     return _state->image;
 }
@@ -418,11 +521,34 @@ void AbstractGlyphCache::flushImage(const Range3Di& range) {
        cause errors on ES2 that doesn't support this pixel storage state */
     if(state.image.size().z() != 1)
         storage.setImageHeight(state.image.size().y());
+
+    /* Move rectangles of glyphs added since the last flush that intersect the
+       flushed range to the end, clipped to it, so the implementation can
+       process just those if it wants to. The remaining ones stay for a later
+       flush. */
+    const Range3Di paddedRange{paddedMin, paddedMax};
+    std::size_t flushedOffset = state.dirtyGlyphRectangles.size();
+    for(std::size_t i = state.dirtyGlyphRectangles.size(); i != 0; --i) {
+        Range3Di& rectangle = state.dirtyGlyphRectangles[i - 1];
+        if(!(rectangle.min() < paddedMax).all() || !(rectangle.max() > paddedMin).all())
+            continue;
+        rectangle = Math::intersect(rectangle, paddedRange);
+        Utility::swap(rectangle, state.dirtyGlyphRectangles[--flushedOffset]);
+    }
+    state.flushedGlyphRectangles = state.dirtyGlyphRectangles.exceptPrefix(flushedOffset);
+
     doSetImage(paddedMin, ImageView3D{
         storage,
         state.image.format(),
         paddedMax - paddedMin,
         state.image.data()});
+
+    state.flushedGlyphRectangles = {};
+    arrayRemoveSuffix(state.dirtyGlyphRectangles, state.dirtyGlyphRectangles.size() - flushedOffset);
+}
+
+Containers::ArrayView<const Range3Di> AbstractGlyphCache::flushedGlyphRectangles() const {
+    return _state->flushedGlyphRectangles;
 }
 
 void AbstractGlyphCache::flushImage(Int layer, const Range2Di& range) {
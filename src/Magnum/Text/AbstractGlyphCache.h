@@ -211,6 +211,24 @@ However, note that packing the atlas with all glyphs from all fonts just once
 will always result in a more optimal layout of the glyph data than adding the
 glyphs incrementally.
 
+@subsection Text-AbstractGlyphCache-filling-eviction Evicting unused glyphs
+
+With large alphabets and arbitrary text, such as user-generated content in CJK
+languages, incremental population will eventually fill the whole cache. To keep
+the cache size bounded, glyphs used by currently rendered text can be marked
+with @ref markGlyphsUsed() and once the @ref atlas() is full,
+@ref evictGlyphs() removes the least recently used ones. Their area is then
+reused by glyphs added afterwards and only the areas of newly added glyphs get
+uploaded to the GPU with @ref flushImage():
+
+@snippet Text.cpp AbstractGlyphCache-filling-eviction
+
+As the evicted glyphs go back to being mapped to the invalid glyph, text
+that used them has to be updated again after they get rasterized to the cache
+again. Evicting a larger batch of glyphs at once, such as a quarter of the
+cache in the above snippet, makes that happen less often than evicting just
+enough glyphs to fit the new ones.
+
 @subsection Text-AbstractGlyphCache-filling-invalid-glyph Setting a custom invalid glyph
 
 By default, to denote an invalid glyph, i.e. a glyph that isn't present in the
@@ -285,6 +303,11 @@ download the processed image as well, it should  advertise
 The public @ref flushImage() function already does checking for rectangle
 bounds so it's not needed to do it again inside @ref doSetImage(), similarly
 the bounds checking is done for @ref doSetProcessedImage().
+
+If the image processing is expensive, the implementation can use
+@ref flushedGlyphRectangles() inside @ref doSetImage() to restrict the
+processing to just the glyphs that were added since the previous flush instead
+of the whole flushed range.
 */
 class MAGNUM_TEXT_EXPORT AbstractGlyphCache {
     public:
@@ -523,7 +546,10 @@ class MAGNUM_TEXT_EXPORT AbstractGlyphCache {
          * The returned count is a sum across all fonts present in the cache.
          * It's not possible to query count of added glyphs for a just single
          * font, the @ref fontGlyphCount() query returns an upper bound for a
-         * font-specific glyph ID.
+         * font-specific glyph ID. Glyphs removed with @ref evictGlyphs() are
+         * still included in the count until their IDs get reused by
+         * @ref addGlyph(), so the returned value is always an upper bound for
+         * a cache-global glyph ID.
          * @see @ref addGlyph(), @ref fontCount()
          */
         UnsignedInt glyphCount() const;
@@ -692,6 +718,62 @@ class MAGNUM_TEXT_EXPORT AbstractGlyphCache {
          */
         UnsignedInt addGlyph(UnsignedInt fontId, UnsignedInt fontGlyphId, const Vector2i& offset, const Range2Di& rectangle);
 
+        /**
+         * @brief Mark glyphs as used
+         * @m_since_latest
+         *
+         * Expects that all @p glyphIds are less than @ref glyphCount(). Marks
+         * the glyphs as most recently used, which affects the order in which
+         * they get evicted by @ref evictGlyphs(). Each call is treated as a
+         * new point in time, glyphs added with @ref addGlyph() are treated as
+         * used at the time of the last call to this function. The
+         * @p glyphIds are usually the output of @ref glyphIdsInto() for text
+         * that's being rendered. The invalid glyph ID @cpp 0 @ce is allowed
+         * to be present and is ignored.
+         *
+         * The operation is done with an @f$ \mathcal{O}(n) @f$ complexity
+         * with @f$ n @f$ being size of the @p glyphIds array.
+         * @see @ref Text-AbstractGlyphCache-filling-eviction
+         */
+        void markGlyphsUsed(const Containers::StridedArrayView1D<const UnsignedInt>& glyphIds);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        void markGlyphsUsed(std::initializer_list<UnsignedInt> glyphIds);
+
+        /**
+         * @brief Evict least recently used glyphs
+         * @return Count of actually evicted glyphs
+         * @m_since_latest
+         *
+         * Removes at most @p count glyphs that were least recently marked
+         * as used with @ref markGlyphsUsed(), excluding the invalid glyph
+         * and glyphs that were evicted already. Returns less than @p count if
+         * there aren't enough glyphs to evict. For each evicted glyph:
+         *
+         * -    its area including padding is removed from @ref atlas() with
+         *      @ref TextureTools::AtlasLandfill::remove(), so it can be reused
+         *      by subsequently added glyphs. The glyph is thus expected to be
+         *      placed in the cache using @ref atlas();
+         * -    its area including padding is cleared to zeros in
+         *      @ref image(). As the area gets uploaded again on
+         *      @ref flushImage() once a new glyph is placed there, no GPU-side
+         *      update is done;
+         * -    @ref glyphId() for the font glyph starts returning @cpp 0 @ce
+         *      again and the glyph can be added again with @ref addGlyph();
+         * -    its cache-global ID is reused by subsequent @ref addGlyph()
+         *      calls. Until then, its @ref glyph() properties are all zeros.
+         *
+         * Glyph IDs retrieved before the eviction are thus no longer valid
+         * for evicted glyphs and text using them has to be updated. The
+         * operation is done with an @f$ \mathcal{O}(n \log{} n) @f$
+         * complexity with @f$ n @f$ being @ref glyphCount().
+         * @see @ref Text-AbstractGlyphCache-filling-eviction
+         */
+        UnsignedInt evictGlyphs(UnsignedInt count);
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         /**
          * @brief Add a glyph
@@ -747,6 +829,13 @@ class MAGNUM_TEXT_EXPORT AbstractGlyphCache {
          * data get copied to the GPU including the padding to make sure the
          * padded glyph area doesn't contain leftovers of uninitialized GPU
          * memory.
+         *
+         * Padded rectangles of glyphs added with @ref addGlyph() since the
+         * previous flush that intersect @p range are made available to the
+         * implementation through @ref flushedGlyphRectangles(), which may use
+         * them to process just the newly added glyphs. Image data of glyphs
+         * that were flushed already are then assumed to be unchanged --- if
+         * you modify those, flush them in a separate call.
          */
         void flushImage(const Range3Di& range);
 
@@ -962,6 +1051,24 @@ class MAGNUM_TEXT_EXPORT AbstractGlyphCache {
         CORRADE_DEPRECATED("use glyph() instead") std::pair<Vector2i, Range2Di> operator[](UnsignedInt glyphId) const;
         #endif
 
+    protected:
+        /**
+         * @brief Rectangles of glyphs being flushed
+         * @m_since_latest
+         *
+         * Meant to be called from @ref doSetImage() implementations. Returns
+         * padded rectangles of glyphs added with @ref addGlyph() since the
+         * previous @ref flushImage() call that intersect the flushed range,
+         * clipped to the range including @ref padding(). The depth of each
+         * rectangle is the glyph layer. Calling this function outside of
+         * @ref doSetImage() returns an empty view.
+         *
+         * If the view is empty, the implementation should treat the whole
+         * image passed to @ref doSetImage() as changed, as that means the
+         * flush was done for data other than newly added glyphs.
+         */
+        Containers::ArrayView<const Range3Di> flushedGlyphRectangles() const;
+
     private:
         /** @brief Implementation for @ref features() */
         virtual GlyphCacheFeatures doFeatures() const = 0;
@@ -134,6 +134,20 @@ every time. Or for example have a few persistent @ref AbstractShaper instances
 for dynamic text that changes every frame, or have dedicated preconfigured
 per-font, per-script or per-language instances.
 
+@subsection Text-AbstractShaper-usage-threads Shaping on multiple threads
+
+A single @ref AbstractShaper instance can't be used from multiple threads at
+the same time. If the originating font advertises
+@ref FontFeature::ConcurrentShaping, however, separate instances created from
+it can be used concurrently, each from a single thread at a time. The
+instances have to be created upfront on the thread that owns the font, and the
+font isn't allowed to be modified, closed or destroyed while the shapers are
+in use. The @ref shapeRuns() utility builds on this, shaping independent runs
+of a long text on an application-provided thread pool and merging the result
+into a single glyph array:
+
+@snippet Text.cpp shapeRuns
+
 @subsection Text-AbstractShaper-usage-clusters Mapping between input text and shaped glyphs
 
 For implementing text selection or editing, mapping from screen position to
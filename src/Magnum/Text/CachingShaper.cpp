@@ -0,0 +1,263 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CachingShaper.h"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Text/Direction.h"
+#include "Magnum/Text/Feature.h"
+#include "Magnum/Text/Script.h"
+
+namespace Magnum { namespace Text {
+
+namespace {
+
+struct Entry {
+    Containers::Array<UnsignedInt> ids;
+    Containers::Array<Vector2> offsets;
+    Containers::Array<Vector2> advances;
+    Containers::Array<UnsignedInt> clusters;
+    Script script;
+    Containers::String language;
+    ShapeDirection direction;
+    UnsignedLong lastUse;
+    std::size_t memory;
+};
+
+template<class T> void appendKey(std::string& key, const T& value) {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+}
+
+struct CachingShaper::State {
+    explicit State(AbstractShaper& shaper, std::size_t memoryLimit): shaper(shaper), memoryLimit{memoryLimit} {}
+
+    AbstractShaper& shaper;
+    std::size_t memoryLimit;
+    std::size_t memoryUsage = 0;
+    UnsignedLong hitCount = 0,
+        missCount = 0,
+        useCounter = 0;
+
+    /* Values passed to setScript(), setLanguage() and setDirection(), part
+       of the cache key */
+    Script script = Script::Unspecified;
+    Containers::String language;
+    ShapeDirection direction = ShapeDirection::Unspecified;
+
+    std::unordered_map<std::string, Entry> entries;
+    /* Reused across shape() calls to avoid allocations on cache hits */
+    std::string key;
+
+    /* Entry the glyph data are retrieved from, either pointing into entries
+       or to detached if the cache got cleared after the last shape() */
+    Entry* current = nullptr;
+    Entry detached;
+};
+
+CachingShaper::CachingShaper(AbstractShaper& shaper, const std::size_t memoryLimit): AbstractShaper{shaper.font()}, _state{InPlaceInit, shaper, memoryLimit} {}
+
+CachingShaper::CachingShaper(CachingShaper&&) noexcept = default;
+
+CachingShaper::~CachingShaper() = default;
+
+CachingShaper& CachingShaper::operator=(CachingShaper&&) noexcept = default;
+
+AbstractShaper& CachingShaper::shaper() {
+    return _state->shaper;
+}
+
+const AbstractShaper& CachingShaper::shaper() const {
+    return _state->shaper;
+}
+
+std::size_t CachingShaper::memoryLimit() const {
+    return _state->memoryLimit;
+}
+
+std::size_t CachingShaper::memoryUsage() const {
+    return _state->memoryUsage;
+}
+
+std::size_t CachingShaper::entryCount() const {
+    return _state->entries.size();
+}
+
+UnsignedLong CachingShaper::hitCount() const {
+    return _state->hitCount;
+}
+
+UnsignedLong CachingShaper::missCount() const {
+    return _state->missCount;
+}
+
+void CachingShaper::clear() {
+    State& state = *_state;
+
+    /* Keep the data from the last shape() call retrievable */
+    if(state.current && state.current != &state.detached) {
+        state.detached = Utility::move(*state.current);
+        state.current = &state.detached;
+    }
+
+    state.entries.clear();
+    state.memoryUsage = 0;
+    state.hitCount = 0;
+    state.missCount = 0;
+}
+
+bool CachingShaper::doSetScript(const Script script) {
+    _state->script = script;
+    return _state->shaper.setScript(script);
+}
+
+bool CachingShaper::doSetLanguage(const Containers::StringView language) {
+    /* The view may point to the language of the current entry, so make a
+       copy before passing it anywhere */
+    _state->language = Containers::String{language};
+    return _state->shaper.setLanguage(_state->language);
+}
+
+bool CachingShaper::doSetDirection(const ShapeDirection direction) {
+    _state->direction = direction;
+    return _state->shaper.setDirection(direction);
+}
+
+UnsignedInt CachingShaper::doShape(const Containers::StringView text, const UnsignedInt begin, const UnsignedInt end, const Containers::ArrayView<const FeatureRange> features) {
+    State& state = *_state;
+
+    /* Assemble the key from everything that affects the output. The font is
+       implicit, as the wrapped shaper is tied to a single font. */
+    std::string& key = state.key;
+    key.clear();
+    appendKey(key, state.script);
+    appendKey(key, state.direction);
+    appendKey(key, UnsignedInt(state.language.size()));
+    key.append(state.language.data(), state.language.size());
+    appendKey(key, begin);
+    appendKey(key, end);
+    appendKey(key, UnsignedInt(features.size()));
+    for(const FeatureRange& feature: features) {
+        appendKey(key, feature.feature());
+        appendKey(key, feature.value());
+        appendKey(key, feature.begin());
+        appendKey(key, feature.end());
+    }
+    key.append(text.data(), text.size());
+
+    ++state.useCounter;
+
+    /* Cache hit, just remember the entry to copy the data from */
+    const auto found = state.entries.find(key);
+    if(found != state.entries.end()) {
+        ++state.hitCount;
+        found->second.lastUse = state.useCounter;
+        state.current = &found->second;
+        return found->second.ids.size();
+    }
+
+    /* Cache miss, shape the text and retrieve everything, as the wrapped
+       shaper state gets overwritten by the next shape() call */
+    ++state.missCount;
+    const UnsignedInt glyphCount = state.shaper.shape(text, begin, end, features);
+    Entry entry;
+    entry.ids = Containers::Array<UnsignedInt>{NoInit, glyphCount};
+    entry.offsets = Containers::Array<Vector2>{NoInit, glyphCount};
+    entry.advances = Containers::Array<Vector2>{NoInit, glyphCount};
+    entry.clusters = Containers::Array<UnsignedInt>{NoInit, glyphCount};
+    state.shaper.glyphIdsInto(entry.ids);
+    state.shaper.glyphOffsetsAdvancesInto(entry.offsets, entry.advances);
+    state.shaper.glyphClustersInto(entry.clusters);
+    entry.script = state.shaper.script();
+    entry.language = Containers::String{state.shaper.language()};
+    entry.direction = state.shaper.direction();
+    entry.lastUse = state.useCounter;
+    entry.memory = sizeof(Entry) + key.size() + entry.language.size() +
+        glyphCount*(2*sizeof(UnsignedInt) + 2*sizeof(Vector2));
+
+    state.memoryUsage += entry.memory;
+    Entry& inserted = state.entries.emplace(key, Utility::move(entry)).first->second;
+    state.current = &inserted;
+
+    /* If over the limit, evict least recently used entries except the one
+       just added until at three quarters of the limit, to not have to do this
+       on every following miss */
+    if(state.memoryUsage > state.memoryLimit) {
+        std::vector<std::unordered_map<std::string, Entry>::iterator> candidates;
+        candidates.reserve(state.entries.size());
+        for(auto it = state.entries.begin(); it != state.entries.end(); ++it)
+            if(&it->second != &inserted) candidates.push_back(it);
+        std::sort(candidates.begin(), candidates.end(), [](const std::unordered_map<std::string, Entry>::iterator& a, const std::unordered_map<std::string, Entry>::iterator& b) {
+            return a->second.lastUse < b->second.lastUse;
+        });
+
+        const std::size_t target = state.memoryLimit/4*3;
+        for(const auto& it: candidates) {
+            if(state.memoryUsage <= target) break;
+            state.memoryUsage -= it->second.memory;
+            state.entries.erase(it);
+        }
+    }
+
+    return glyphCount;
+}
+
+Script CachingShaper::doScript() const {
+    return _state->current ? _state->current->script : Script::Unspecified;
+}
+
+Containers::StringView CachingShaper::doLanguage() const {
+    return _state->current ? Containers::StringView{_state->current->language} : Containers::StringView{};
+}
+
+ShapeDirection CachingShaper::doDirection() const {
+    return _state->current ? _state->current->direction : ShapeDirection::Unspecified;
+}
+
+void CachingShaper::doGlyphIdsInto(const Containers::StridedArrayView1D<UnsignedInt>& ids) const {
+    Utility::copy(Containers::arrayView(_state->current->ids), ids);
+}
+
+void CachingShaper::doGlyphOffsetsAdvancesInto(const Containers::StridedArrayView1D<Vector2>& offsets, const Containers::StridedArrayView1D<Vector2>& advances) const {
+    Utility::copy(Containers::arrayView(_state->current->offsets), offsets);
+    Utility::copy(Containers::arrayView(_state->current->advances), advances);
+}
+
+void CachingShaper::doGlyphClustersInto(const Containers::StridedArrayView1D<UnsignedInt>& clusters) const {
+    Utility::copy(Containers::arrayView(_state->current->clusters), clusters);
+}
+
+}}
@@ -0,0 +1,159 @@
+#ifndef Magnum_Text_CachingShaper_h
+#define Magnum_Text_CachingShaper_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Text::CachingShaper
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Text/AbstractShaper.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Shaper caching results of another shaper
+@m_since_latest
+
+Wraps an @ref AbstractShaper instance and remembers glyph IDs, offsets,
+advances and clusters produced by it, together with the script, language and
+direction detected during shaping. Shaping the same text with the same
+script, language, direction, begin / end range and features again is then
+just a copy of the cached data instead of a call into the font plugin, which
+is useful for user interfaces where most of the text doesn't change from frame
+to frame.
+
+@section Text-CachingShaper-usage Usage
+
+Create a shaper from an @ref AbstractFont and pass it to the constructor
+together with a memory limit. The instance can be then used in place of the
+original shaper:
+
+@snippet Text.cpp CachingShaper-usage
+
+The cache is per-shaper, and thus per-font, as a shaper is always tied to the
+@ref AbstractFont it originated from. Calls to @ref setScript(),
+@ref setLanguage() and @ref setDirection() are passed through to the wrapped
+shaper and the values set become a part of the cache key.
+
+@section Text-CachingShaper-memory Memory limit
+
+Every entry accounts for the key data, which is mostly the shaped text itself,
+and for the glyph data. Once @ref memoryUsage() exceeds @ref memoryLimit(),
+least recently used entries get evicted until the usage drops to three
+quarters of the limit. The entry produced by the current @ref shape() call is
+never evicted, meaning that a single text larger than the limit still gets
+shaped correctly. Use
+@ref hitCount() and @ref missCount() to tune the limit for given workload.
+*/
+class MAGNUM_TEXT_EXPORT CachingShaper: public AbstractShaper {
+    public:
+        /**
+         * @brief Constructor
+         * @param shaper        Shaper to cache the results of
+         * @param memoryLimit   Memory limit in bytes
+         *
+         * The @p shaper is expected to stay in scope for at least as long as
+         * the @ref CachingShaper is alive.
+         */
+        explicit CachingShaper(AbstractShaper& shaper, std::size_t memoryLimit);
+
+        /** @brief Copying is not allowed */
+        CachingShaper(CachingShaper&) = delete;
+
+        /** @brief Move constructor */
+        CachingShaper(CachingShaper&&) noexcept;
+
+        ~CachingShaper();
+
+        /** @brief Copying is not allowed */
+        CachingShaper& operator=(CachingShaper&) = delete;
+
+        /** @brief Move assignment */
+        CachingShaper& operator=(CachingShaper&&) noexcept;
+
+        /** @brief Wrapped shaper */
+        AbstractShaper& shaper();
+        const AbstractShaper& shaper() const; /**< @overload */
+
+        /** @brief Memory limit in bytes */
+        std::size_t memoryLimit() const;
+
+        /**
+         * @brief Memory used by cached entries in bytes
+         *
+         * Approximate, doesn't include the hash table overhead.
+         */
+        std::size_t memoryUsage() const;
+
+        /** @brief Count of cached entries */
+        std::size_t entryCount() const;
+
+        /**
+         * @brief Count of @ref shape() calls that were served from the cache
+         *
+         * @see @ref missCount()
+         */
+        UnsignedLong hitCount() const;
+
+        /**
+         * @brief Count of @ref shape() calls that called into the wrapped shaper
+         *
+         * @see @ref hitCount()
+         */
+        UnsignedLong missCount() const;
+
+        /**
+         * @brief Remove all cached entries
+         *
+         * Resets also @ref hitCount() and @ref missCount(). Doesn't affect
+         * data retrieved from the last @ref shape() call.
+         */
+        void clear();
+
+    private:
+        struct State;
+
+        MAGNUM_TEXT_LOCAL bool doSetScript(Script script) override;
+        MAGNUM_TEXT_LOCAL bool doSetLanguage(Containers::StringView language) override;
+        MAGNUM_TEXT_LOCAL bool doSetDirection(ShapeDirection direction) override;
+        MAGNUM_TEXT_LOCAL UnsignedInt doShape(Containers::StringView text, UnsignedInt begin, UnsignedInt end, Containers::ArrayView<const FeatureRange> features) override;
+        MAGNUM_TEXT_LOCAL Script doScript() const override;
+        MAGNUM_TEXT_LOCAL Containers::StringView doLanguage() const override;
+        MAGNUM_TEXT_LOCAL ShapeDirection doDirection() const override;
+        MAGNUM_TEXT_LOCAL void doGlyphIdsInto(const Containers::StridedArrayView1D<UnsignedInt>& ids) const override;
+        MAGNUM_TEXT_LOCAL void doGlyphOffsetsAdvancesInto(const Containers::StridedArrayView1D<Vector2>& offsets, const Containers::StridedArrayView1D<Vector2>& advances) const override;
+        MAGNUM_TEXT_LOCAL void doGlyphClustersInto(const Containers::StridedArrayView1D<UnsignedInt>& clusters) const override;
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
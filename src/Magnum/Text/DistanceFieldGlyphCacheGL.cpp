@@ -26,6 +26,7 @@
 
 #include "DistanceFieldGlyphCacheGL.h"
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Optional.h>
 
 #include "Magnum/ImageView.h"
@@ -99,6 +100,18 @@ void DistanceFieldGlyphCacheGL::doSetImage(const Vector2i& offset, const ImageVi
     CORRADE_INTERNAL_ASSERT(size().xy() % processedSize().xy() == Vector2i{0});
     const Vector2i ratio = size().xy()/processedSize().xy();
 
+    /* Process just the padded rectangles of newly added glyphs instead of the
+       whole flushed range, all in a single draw. The rectangles get rounded
+       outwards to whole output pixels, the extra pixels get the same values
+       as if the whole range was processed. If there are no glyph rectangles,
+       the flush was done for something else than newly added glyphs and the
+       whole range has to be processed. */
+    const Containers::ArrayView<const Range3Di> glyphRectangles = flushedGlyphRectangles();
+    Containers::Array<Range2Di> rectangles{NoInit, glyphRectangles.size()};
+    for(std::size_t i = 0; i != glyphRectangles.size(); ++i)
+        rectangles[i] = {glyphRectangles[i].min().xy()/ratio,
+                         (glyphRectangles[i].max().xy() + ratio - Vector2i{1})/ratio};
+
     /* Upload the input texture and create a distance field from it. On ES2
        without EXT_unpack_subimage and on WebGL 1 there's no possibility to
        upload just a slice of the input, upload the whole image instead by
@@ -110,7 +123,10 @@ void DistanceFieldGlyphCacheGL::doSetImage(const Vector2i& offset, const ImageVi
     #endif
     {
         input.setImage(0, GL::textureFormat(image.format()), ImageView2D{image.format(), size().xy(), image.data()});
-        _distanceField(input, texture(), {{}, size().xy()/ratio}, size().xy());
+        if(rectangles.isEmpty())
+            _distanceField(input, texture(), {{}, size().xy()/ratio}, size().xy());
+        else
+            _distanceField(input, texture(), {{}, size().xy()/ratio}, rectangles, size().xy());
         #ifdef MAGNUM_TARGET_WEBGL
         static_cast<void>(offset);
         #endif
@@ -150,7 +166,11 @@ void DistanceFieldGlyphCacheGL::doSetImage(const Vector2i& offset, const ImageVi
             image.data()};
 
         input.setImage(0, GL::textureFormat(paddedImage.format()), paddedImage);
-        _distanceField(input, texture(), Range2Di::fromSize(paddedMinRounded/ratio, paddedImage.size()/ratio), paddedImage.size());
+        const Range2Di rectangle = Range2Di::fromSize(paddedMinRounded/ratio, paddedImage.size()/ratio);
+        if(rectangles.isEmpty())
+            _distanceField(input, texture(), rectangle, paddedImage.size());
+        else
+            _distanceField(input, texture(), rectangle, rectangles, paddedImage.size());
     }
     #endif
 }
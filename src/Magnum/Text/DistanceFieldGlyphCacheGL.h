@@ -71,6 +71,18 @@ channels.
 
 @snippet Text-gl.cpp DistanceFieldGlyphCacheGL-usage
 
+The distance field conversion is done on the GPU with
+@ref TextureTools::DistanceFieldGL. Only the padded rectangles of glyphs added
+since the previous @ref flushImage() call are processed, so incrementally
+populating the cache with a few glyphs at a time doesn't reprocess the whole
+flushed range. See @ref flushedGlyphRectangles() for details. If it's desirable to calculate the
+distance field elsewhere, for example on a build machine without a GPU, the
+@ref TextureTools::distanceFieldInto() function gives the same output on the
+CPU. The result can be then uploaded directly with @ref setProcessedImage(),
+bypassing the GPU processing:
+
+@snippet Text-gl.cpp DistanceFieldGlyphCacheGL-cpu
+
 See the @ref Renderer class for information about text rendering. The
 @ref AbstractGlyphCache base class has more information about general glyph
 cache usage.
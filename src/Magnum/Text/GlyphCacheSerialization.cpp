@@ -0,0 +1,347 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GlyphCacheSerialization.h"
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/Triple.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/AbstractGlyphCache.h"
+#include "Magnum/TextureTools/Atlas.h"
+
+namespace Magnum { namespace Text {
+
+namespace {
+
+/* Little-endian, laid out as the header, followed by fontCount
+   SerializedFont items, glyphCount SerializedGlyph items with the first one
+   being the cache-global invalid glyph, source image pixels tightly packed
+   and then, if processedPixelSize is non-zero, processed image pixels
+   tightly packed. All items are four-byte aligned, image data are padded to
+   four bytes. */
+struct SerializedHeader {
+    char magic[8];              /* MGNGLCH\0 */
+    UnsignedInt version;        /* 1 */
+    UnsignedInt format;
+    UnsignedInt pixelSize;
+    UnsignedInt processedFormat;
+    /* Zero if there's no processed image */
+    UnsignedInt processedPixelSize;
+    Vector3i size;
+    Vector3i processedSize;
+    Vector2i padding;
+    UnsignedInt fontCount;
+    UnsignedInt glyphCount;
+};
+
+struct SerializedFont {
+    UnsignedInt glyphCount;
+    /* Zero if the font pointer was null */
+    Float size;
+};
+
+/* Glyph properties as returned from AbstractGlyphCache::glyph(), i.e. with
+   padding applied */
+struct SerializedGlyph {
+    UnsignedInt fontId;
+    UnsignedInt fontGlyphId;
+    Vector2i offset;
+    Int layer;
+    Range2Di rectangle;
+};
+
+static_assert(sizeof(SerializedHeader) == 68, "SerializedHeader size is not 68 bytes");
+static_assert(sizeof(SerializedFont) == 8, "SerializedFont size is not 8 bytes");
+static_assert(sizeof(SerializedGlyph) == 36, "SerializedGlyph size is not 36 bytes");
+
+constexpr char SerializedMagic[]{'M', 'G', 'N', 'G', 'L', 'C', 'H', '\0'};
+
+inline std::size_t alignedImageDataSize(const Vector3i& size, const UnsignedInt pixelSize) {
+    return (std::size_t(size.product())*pixelSize + 3) & ~std::size_t{3};
+}
+
+}
+
+Containers::Optional<Containers::Array<char>> serializeGlyphCache(AbstractGlyphCache& cache) {
+    #ifdef CORRADE_TARGET_BIG_ENDIAN
+    static_cast<void>(cache);
+    Error{} << "Text::serializeGlyphCache(): serialization is not supported on Big-Endian platforms";
+    return {};
+    #else
+    const bool hasProcessedImage = cache.features() & GlyphCacheFeature::ImageProcessing;
+    if(hasProcessedImage && !(cache.features() >= GlyphCacheFeature::ProcessedImageDownload)) {
+        Error{} << "Text::serializeGlyphCache(): glyph cache has image processing but doesn't support image download";
+        return {};
+    }
+
+    /* Gather glyphs that are actually present, i.e. skipping evicted ones.
+       The invalid glyph is always first. */
+    std::size_t glyphCount = 1;
+    for(UnsignedInt fontId = 0; fontId != cache.fontCount(); ++fontId)
+        for(UnsignedInt fontGlyphId = 0; fontGlyphId != cache.fontGlyphCount(fontId); ++fontGlyphId)
+            if(cache.glyphId(fontId, fontGlyphId))
+                ++glyphCount;
+
+    const ImageView3D image = cache.image();
+    Containers::Optional<Image3D> processedImage;
+    if(hasProcessedImage)
+        processedImage = cache.processedImage();
+
+    const std::size_t fontOffset = sizeof(SerializedHeader);
+    const std::size_t glyphOffset = fontOffset + cache.fontCount()*sizeof(SerializedFont);
+    const std::size_t imageOffset = glyphOffset + glyphCount*sizeof(SerializedGlyph);
+    const std::size_t processedImageOffset = imageOffset + alignedImageDataSize(image.size(), image.pixelSize());
+    const std::size_t size = processedImageOffset + (processedImage ? alignedImageDataSize(processedImage->size(), processedImage->pixelSize()) : 0);
+    /* Zero-init to have the image data padding deterministic */
+    Containers::Array<char> out{ValueInit, size};
+
+    SerializedHeader header{};
+    std::memcpy(header.magic, SerializedMagic, sizeof(header.magic));
+    header.version = 1;
+    header.format = UnsignedInt(cache.format());
+    header.pixelSize = image.pixelSize();
+    header.processedFormat = UnsignedInt(cache.processedFormat());
+    header.processedPixelSize = processedImage ? processedImage->pixelSize() : 0;
+    header.size = cache.size();
+    header.processedSize = cache.processedSize();
+    header.padding = cache.padding();
+    header.fontCount = cache.fontCount();
+    header.glyphCount = glyphCount;
+    std::memcpy(out.data(), &header, sizeof(header));
+
+    const Containers::ArrayView<SerializedFont> fonts = Containers::arrayCast<SerializedFont>(out.slice(fontOffset, glyphOffset));
+    for(UnsignedInt fontId = 0; fontId != cache.fontCount(); ++fontId) {
+        const AbstractFont* const font = cache.fontPointer(fontId);
+        fonts[fontId] = {cache.fontGlyphCount(fontId), font ? font->size() : 0.0f};
+    }
+
+    const Containers::ArrayView<SerializedGlyph> glyphs = Containers::arrayCast<SerializedGlyph>(out.slice(glyphOffset, imageOffset));
+    {
+        const Containers::Triple<Vector2i, Int, Range2Di> invalid = cache.glyph(0);
+        glyphs[0] = {~UnsignedInt{}, 0, invalid.first(), invalid.second(), invalid.third()};
+    }
+    std::size_t i = 1;
+    for(UnsignedInt fontId = 0; fontId != cache.fontCount(); ++fontId) {
+        for(UnsignedInt fontGlyphId = 0; fontGlyphId != cache.fontGlyphCount(fontId); ++fontGlyphId) {
+            if(!cache.glyphId(fontId, fontGlyphId))
+                continue;
+            const Containers::Triple<Vector2i, Int, Range2Di> glyph = cache.glyph(fontId, fontGlyphId);
+            glyphs[i++] = {fontId, fontGlyphId, glyph.first(), glyph.second(), glyph.third()};
+        }
+    }
+    CORRADE_INTERNAL_ASSERT(i == glyphCount);
+
+    /* Copy the image pixels, dropping any row padding */
+    Utility::copy(image.pixels(), Containers::StridedArrayView4D<char>{out.exceptPrefix(imageOffset), {
+        std::size_t(image.size().z()),
+        std::size_t(image.size().y()),
+        std::size_t(image.size().x()),
+        image.pixelSize()}});
+    if(processedImage)
+        Utility::copy(processedImage->pixels(), Containers::StridedArrayView4D<char>{out.exceptPrefix(processedImageOffset), {
+            std::size_t(processedImage->size().z()),
+            std::size_t(processedImage->size().y()),
+            std::size_t(processedImage->size().x()),
+            processedImage->pixelSize()}});
+
+    return Containers::optional(Utility::move(out));
+    #endif
+}
+
+bool deserializeGlyphCacheInto(AbstractGlyphCache& cache, const Containers::ArrayView<const void> data, const Containers::ArrayView<const AbstractFont* const> fonts) {
+    CORRADE_ASSERT(!cache.fontCount(),
+        "Text::deserializeGlyphCacheInto(): expected an empty cache but it has" << cache.fontCount() << "fonts", {});
+
+    #ifdef CORRADE_TARGET_BIG_ENDIAN
+    static_cast<void>(data);
+    static_cast<void>(fonts);
+    Error{} << "Text::deserializeGlyphCacheInto(): deserialization is not supported on Big-Endian platforms";
+    return {};
+    #else
+    const Containers::ArrayView<const char> bytes{static_cast<const char*>(data.data()), data.size()};
+    if(bytes.size() < sizeof(SerializedHeader)) {
+        Error{} << "Text::deserializeGlyphCacheInto(): data too short, expected at least" << sizeof(SerializedHeader) << "bytes but got" << bytes.size();
+        return {};
+    }
+
+    SerializedHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if(std::memcmp(header.magic, SerializedMagic, sizeof(header.magic)) != 0) {
+        Error{} << "Text::deserializeGlyphCacheInto(): invalid file signature";
+        return {};
+    }
+    if(header.version != 1) {
+        Error{} << "Text::deserializeGlyphCacheInto(): unsupported version" << header.version;
+        return {};
+    }
+
+    /* Properties of the cache have to match */
+    const bool hasProcessedImage = cache.features() & GlyphCacheFeature::ImageProcessing;
+    if(PixelFormat(header.format) != cache.format() || header.size != cache.size() || header.padding != cache.padding() || header.pixelSize != cache.image().pixelSize()) {
+        Error{} << "Text::deserializeGlyphCacheInto(): expected a" << PixelFormat(header.format) << "cache of size" << Debug::packed << header.size << "and padding" << Debug::packed << header.padding << "but got" << cache.format() << Debug::nospace << "," << Debug::packed << cache.size() << "and" << Debug::packed << cache.padding();
+        return {};
+    }
+    if(hasProcessedImage && (PixelFormat(header.processedFormat) != cache.processedFormat() || header.processedSize != cache.processedSize())) {
+        Error{} << "Text::deserializeGlyphCacheInto(): expected a processed" << PixelFormat(header.processedFormat) << "image of size" << Debug::packed << header.processedSize << "but got" << cache.processedFormat() << "and" << Debug::packed << cache.processedSize();
+        return {};
+    }
+    if(hasProcessedImage != !!header.processedPixelSize) {
+        Error{} << "Text::deserializeGlyphCacheInto(): serialized cache" << (header.processedPixelSize ? "has" : "doesn't have") << "a processed image but the cache" << (hasProcessedImage ? "has" : "doesn't have") << "image processing";
+        return {};
+    }
+
+    const std::size_t fontOffset = sizeof(SerializedHeader);
+    const std::size_t glyphOffset = fontOffset + std::size_t{header.fontCount}*sizeof(SerializedFont);
+    const std::size_t imageOffset = glyphOffset + std::size_t{header.glyphCount}*sizeof(SerializedGlyph);
+    const std::size_t processedImageOffset = imageOffset + alignedImageDataSize(header.size, header.pixelSize);
+    const std::size_t size = processedImageOffset + (header.processedPixelSize ? alignedImageDataSize(header.processedSize, header.processedPixelSize) : 0);
+    if(!header.glyphCount || bytes.size() != size) {
+        Error{} << "Text::deserializeGlyphCacheInto(): expected" << size << "bytes for" << header.fontCount << "fonts and" << header.glyphCount << "glyphs but got" << bytes.size();
+        return {};
+    }
+
+    /* Check the fonts */
+    if(fonts.size() != header.fontCount) {
+        Error{} << "Text::deserializeGlyphCacheInto(): expected" << header.fontCount << "fonts but got" << fonts.size();
+        return {};
+    }
+    const Containers::ArrayView<const SerializedFont> serializedFonts = Containers::arrayCast<const SerializedFont>(bytes.slice(fontOffset, glyphOffset));
+    std::size_t totalFontGlyphCount = 0;
+    for(std::size_t i = 0; i != fonts.size(); ++i) {
+        if(fonts[i] && (fonts[i]->glyphCount() != serializedFonts[i].glyphCount || fonts[i]->size() != serializedFonts[i].size)) {
+            Error{} << "Text::deserializeGlyphCacheInto(): expected font" << i << "to have" << serializedFonts[i].glyphCount << "glyphs and size" << serializedFonts[i].size << "but got" << fonts[i]->glyphCount() << "and" << fonts[i]->size();
+            return {};
+        }
+        totalFontGlyphCount += serializedFonts[i].glyphCount;
+    }
+
+    /* Check the glyphs before modifying the cache in any way, so it doesn't
+       get left in a partially filled state or hit an assertion in
+       addGlyph() */
+    const Containers::ArrayView<const SerializedGlyph> glyphs = Containers::arrayCast<const SerializedGlyph>(bytes.slice(glyphOffset, imageOffset));
+    Containers::Array<std::size_t> fontGlyphOffsets{NoInit, serializedFonts.size()};
+    {
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i != serializedFonts.size(); ++i) {
+            fontGlyphOffsets[i] = offset;
+            offset += serializedFonts[i].glyphCount;
+        }
+    }
+    Containers::BitArray glyphPresent{ValueInit, totalFontGlyphCount};
+    for(std::size_t i = 0; i != glyphs.size(); ++i) {
+        const SerializedGlyph& glyph = glyphs[i];
+        if(i && (glyph.fontId >= serializedFonts.size() || glyph.fontGlyphId >= serializedFonts[glyph.fontId].glyphCount || glyphPresent[fontGlyphOffsets[glyph.fontId] + glyph.fontGlyphId])) {
+            Error{} << "Text::deserializeGlyphCacheInto(): invalid font glyph" << glyph.fontId << glyph.fontGlyphId << "for glyph" << i;
+            return {};
+        }
+        /* The default invalid glyph is all zeros, without padding applied */
+        if(!i && glyph.offset == Vector2i{} && glyph.layer == 0 && glyph.rectangle == Range2Di{})
+            continue;
+        const Range2Di rectangle = glyph.rectangle.padded(-header.padding);
+        if(UnsignedInt(glyph.layer) >= UnsignedInt(header.size.z()) || !(glyph.rectangle.min() >= Vector2i{}).all() || !(rectangle.min() <= rectangle.max()).all() || !(glyph.rectangle.max() <= header.size.xy()).all()) {
+            Error{} << "Text::deserializeGlyphCacheInto(): glyph" << i << "layer" << glyph.layer << "and rectangle" << Debug::packed << glyph.rectangle << "out of range for size" << Debug::packed << header.size;
+            return {};
+        }
+        if(i)
+            glyphPresent.set(fontGlyphOffsets[glyph.fontId] + glyph.fontGlyphId);
+    }
+
+    /* Everything is valid, fill the cache */
+    for(std::size_t i = 0; i != fonts.size(); ++i)
+        cache.addFont(serializedFonts[i].glyphCount, fonts[i]);
+    if(glyphs[0].offset != Vector2i{} || glyphs[0].layer != 0 || glyphs[0].rectangle != Range2Di{})
+        cache.setInvalidGlyph(glyphs[0].offset + header.padding, glyphs[0].layer, glyphs[0].rectangle.padded(-header.padding));
+    for(const SerializedGlyph& glyph: glyphs.exceptPrefix(1))
+        cache.addGlyph(glyph.fontId, glyph.fontGlyphId, glyph.offset + header.padding, glyph.layer, glyph.rectangle.padded(-header.padding));
+
+    /* Reserve the area up to the topmost glyph in the atlas packer. Layers
+       are filled in order, so all layers before the last used one are
+       reserved completely. Rotations are temporarily disabled so the
+       full-width items don't get rotated and fail to fit. */
+    {
+        Int lastLayer = -1;
+        Int lastLayerHeight = 0;
+        for(const SerializedGlyph& glyph: glyphs.exceptPrefix(1)) {
+            const Int height = glyph.rectangle.max().y();
+            if(glyph.layer > lastLayer) {
+                lastLayer = glyph.layer;
+                lastLayerHeight = height;
+            } else if(glyph.layer == lastLayer)
+                lastLayerHeight = Math::max(lastLayerHeight, height);
+        }
+
+        TextureTools::AtlasLandfill& atlas = cache.atlas();
+        const TextureTools::AtlasLandfillFlags previousFlags = atlas.flags();
+        atlas.clearFlags(TextureTools::AtlasLandfillFlag::RotatePortrait|
+                         TextureTools::AtlasLandfillFlag::RotateLandscape);
+        Vector3i offset[1];
+        for(Int layer = 0; layer <= lastLayer; ++layer) {
+            const Int height = layer == lastLayer ? lastLayerHeight : header.size.y();
+            CORRADE_INTERNAL_ASSERT_OUTPUT(atlas.add({
+                {header.size.x() - 2*header.padding.x(),
+                 Math::max(height - 2*header.padding.y(), 0)}
+            }, offset));
+        }
+        atlas.setFlags(previousFlags);
+    }
+
+    /* Copy the image and either upload the processed image or flush the
+       whole source image, letting the cache process it */
+    const MutableImageView3D image = cache.image();
+    Utility::copy(Containers::StridedArrayView4D<const char>{bytes.exceptPrefix(imageOffset), {
+        std::size_t(header.size.z()),
+        std::size_t(header.size.y()),
+        std::size_t(header.size.x()),
+        header.pixelSize}}, image.pixels());
+    if(header.processedPixelSize) {
+        cache.setProcessedImage(Vector3i{}, ImageView3D{
+            PixelStorage{}.setAlignment(1),
+            PixelFormat(header.processedFormat), 0, header.processedPixelSize,
+            header.processedSize,
+            bytes.slice(processedImageOffset, processedImageOffset + std::size_t(header.processedSize.product())*header.processedPixelSize)});
+    } else cache.flushImage({{}, header.size});
+
+    return true;
+    #endif
+}
+
+bool deserializeGlyphCacheInto(AbstractGlyphCache& cache, const Containers::ArrayView<const void> data, const std::initializer_list<const AbstractFont*> fonts) {
+    return deserializeGlyphCacheInto(cache, data, Containers::arrayView(fonts));
+}
+
+}}
@@ -0,0 +1,112 @@
+#ifndef Magnum_Text_GlyphCacheSerialization_h
+#define Magnum_Text_GlyphCacheSerialization_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Text::serializeGlyphCache(), @ref Magnum::Text::deserializeGlyphCacheInto()
+ * @m_since_latest
+ */
+
+#include <initializer_list>
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Text/Text.h"
+#include "Magnum/Text/visibility.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Serialize a glyph cache
+@m_since_latest
+
+Saves the source @ref AbstractGlyphCache::image(), font glyph counts and
+sizes, and properties of all glyphs including the cache-global invalid glyph
+into a binary blob that can be restored with @ref deserializeGlyphCacheInto().
+If the cache advertises @ref GlyphCacheFeature::ImageProcessing, the
+@ref AbstractGlyphCache::processedImage() is saved as well, so the processing
+doesn't need to be done again on load. Glyphs that were evicted with
+@ref AbstractGlyphCache::evictGlyphs() aren't saved.
+
+The data only identify the fonts by their index, glyph count and size. It's
+up to the application to associate the blob with a particular font file, for
+example by naming it after a hash of the font file contents and the size the
+font was opened with.
+
+If the cache has image processing but doesn't support
+@ref GlyphCacheFeature::ProcessedImageDownload, prints a message to
+@relativeref{Magnum,Error} and returns @relativeref{Corrade,Containers::NullOpt}.
+The output is little-endian and serialization isn't supported on Big-Endian
+platforms.
+*/
+MAGNUM_TEXT_EXPORT Containers::Optional<Containers::Array<char>> serializeGlyphCache(AbstractGlyphCache& cache);
+
+/**
+@brief Deserialize a glyph cache
+@param cache    Glyph cache to fill
+@param data     Data produced by @ref serializeGlyphCache()
+@param fonts    Fonts to associate with the cache
+@m_since_latest
+
+Expects that @p cache has no fonts added yet. The cache
+@ref AbstractGlyphCache::format() "format()",
+@relativeref{AbstractGlyphCache,size()},
+@relativeref{AbstractGlyphCache,padding()} and, if the cache has image
+processing, @relativeref{AbstractGlyphCache,processedFormat()} and
+@relativeref{AbstractGlyphCache,processedSize()} have to match the serialized
+cache, and @p fonts has to have the same size as the count of serialized
+fonts. Fonts that are non-@cpp nullptr @ce are expected to be opened and are
+checked to have the same glyph count and size as the serialized ones,
+@cpp nullptr @ce fonts aren't checked. If any of those doesn't match or the data
+are invalid, prints a message to @relativeref{Magnum,Error}, leaves @p cache
+untouched and returns @cpp false @ce.
+
+On success, the fonts are added with @ref AbstractGlyphCache::addFont(), the
+glyphs with @ref AbstractGlyphCache::addGlyph() and the source image is copied
+to @ref AbstractGlyphCache::image(). If the serialized data contain a processed
+image, it's uploaded with @ref AbstractGlyphCache::setProcessedImage(),
+otherwise the whole image is passed to @ref AbstractGlyphCache::flushImage().
+Cache-global glyph IDs aren't preserved, as the saved cache could have had
+gaps after evicted glyphs.
+
+The glyph positions aren't known to the @ref AbstractGlyphCache::atlas()
+packer. To make it possible to add further glyphs without overlapping the
+restored ones, all layers before the last used one are reserved in the packer
+completely, and in the last used layer the full-width area up to the topmost
+restored glyph including padding is reserved.
+*/
+MAGNUM_TEXT_EXPORT bool deserializeGlyphCacheInto(AbstractGlyphCache& cache, Containers::ArrayView<const void> data, Containers::ArrayView<const AbstractFont* const> fonts);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_TEXT_EXPORT bool deserializeGlyphCacheInto(AbstractGlyphCache& cache, Containers::ArrayView<const void> data, std::initializer_list<const AbstractFont*> fonts);
+
+}}
+
+#endif
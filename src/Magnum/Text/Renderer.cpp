@@ -40,12 +40,15 @@
 #ifdef MAGNUM_TARGET_GL
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/ArrayViewStl.h> /** @todo remove once Renderer is STL-free */
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once Renderer is STL-free */
+#include <Corrade/Utility/Algorithms.h>
 
 #include "Magnum/Mesh.h"
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/Mesh.h"
+#include "Magnum/Math/Color.h"
 #include "Magnum/Shaders/GenericGL.h"
 #include "Magnum/Text/AbstractShaper.h"
 #endif
@@ -718,6 +721,196 @@ void AbstractRenderer::render(const std::string& text) {
 template class MAGNUM_TEXT_EXPORT Renderer<2>;
 template class MAGNUM_TEXT_EXPORT Renderer<3>;
 #endif
+
+struct AbstractBatchRenderer::GlyphVertex {
+    Vector2 position, textureCoordinates;
+    Color4 color;
+};
+
+struct AbstractBatchRenderer::String {
+    UnsignedInt glyphOffset, glyphCapacity;
+    Vector2 offset;
+    Color4 color;
+    /* Without the offset applied */
+    Range2D rectangle;
+};
+
+AbstractBatchRenderer::AbstractBatchRenderer(AbstractFont& font, const AbstractGlyphCache& cache, const Float size, const Alignment alignment): _vertexBuffer{GL::Buffer::TargetHint::Array}, _indexBuffer{GL::Buffer::TargetHint::ElementArray}, _font(font), _cache(cache), _fontSize{size}, _alignment{alignment} {
+    /* Vertex buffer configuration depends on dimension count, done in subclass */
+    _mesh.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(0);
+}
+
+AbstractBatchRenderer::~AbstractBatchRenderer() = default;
+
+UnsignedInt AbstractBatchRenderer::stringCount() const {
+    return _strings.size();
+}
+
+void AbstractBatchRenderer::reserve(const UnsignedInt glyphCapacity, const GL::BufferUsage vertexBufferUsage, const GL::BufferUsage indexBufferUsage) {
+    CORRADE_ASSERT(glyphCapacity >= _glyphCount,
+        "Text::BatchRenderer::reserve(): capacity" << glyphCapacity << "too small for" << _glyphCount << "already added glyphs", );
+
+    const UnsignedInt vertexCount = glyphCapacity*4;
+
+    /* Preserve the already added strings, the rest is zero-initialized */
+    Containers::Array<Vector2> positions{ValueInit, vertexCount};
+    Containers::Array<GlyphVertex> vertices{ValueInit, vertexCount};
+    Utility::copy(_positions.prefix(_glyphCount*4), positions.prefix(_glyphCount*4));
+    Utility::copy(_vertices.prefix(_glyphCount*4), vertices.prefix(_glyphCount*4));
+    _positions = Utility::move(positions);
+    _vertices = Utility::move(vertices);
+    _capacity = glyphCapacity;
+
+    /* Allocate the vertex buffer and mark all existing strings for upload */
+    _vertexBuffer.setData({nullptr, vertexCount*sizeof(GlyphVertex)}, vertexBufferUsage);
+    _dirtyBegin = 0;
+    _dirtyEnd = _glyphCount;
+
+    /* Render indices for the whole capacity, these are shared by all strings
+       and don't change until next reserve() */
+    Containers::Array<char> indexData;
+    MeshIndexType indexType;
+    std::tie(indexData, indexType) = renderIndicesInternal(glyphCapacity);
+    _indexBuffer.setData(indexData, indexBufferUsage);
+    _mesh.setIndexBuffer(_indexBuffer, 0, indexType, 0, vertexCount);
+}
+
+UnsignedInt AbstractBatchRenderer::add(const std::string& text, const Vector2& offset, const Color4& color, UnsignedInt glyphCapacity) {
+    std::vector<Vertex> vertices;
+    Range2D rectangle;
+    std::tie(vertices, rectangle) = renderVerticesInternal(_font, _cache, _fontSize, text, _alignment);
+
+    const UnsignedInt glyphCount = vertices.size()/4;
+    if(!glyphCapacity) glyphCapacity = glyphCount;
+    CORRADE_ASSERT(glyphCount <= glyphCapacity,
+        "Text::BatchRenderer::add(): string capacity" << glyphCapacity << "too small to render" << glyphCount << "glyphs", {});
+    CORRADE_ASSERT(_glyphCount + glyphCapacity <= _capacity,
+        "Text::BatchRenderer::add(): capacity" << _capacity << "too small to add" << glyphCapacity << "glyphs to" << _glyphCount << "already added", {});
+
+    const UnsignedInt id = _strings.size();
+    arrayAppend(_strings, String{_glyphCount, glyphCapacity, offset, color, {}});
+    _glyphCount += glyphCapacity;
+
+    const Containers::StridedArrayView1D<const Vertex> vertexView = Containers::stridedArrayView(vertices);
+    setTextInternal(id, vertexView.slice(&Vertex::position), vertexView.slice(&Vertex::textureCoordinates), rectangle);
+    return id;
+}
+
+Vector2 AbstractBatchRenderer::offset(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _strings.size(),
+        "Text::BatchRenderer::offset(): index" << id << "out of range for" << _strings.size() << "strings", {});
+    return _strings[id].offset;
+}
+
+Color4 AbstractBatchRenderer::color(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _strings.size(),
+        "Text::BatchRenderer::color(): index" << id << "out of range for" << _strings.size() << "strings", {});
+    return _strings[id].color;
+}
+
+Range2D AbstractBatchRenderer::rectangle(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _strings.size(),
+        "Text::BatchRenderer::rectangle(): index" << id << "out of range for" << _strings.size() << "strings", {});
+    return _strings[id].rectangle.translated(_strings[id].offset);
+}
+
+AbstractBatchRenderer& AbstractBatchRenderer::setText(const UnsignedInt id, const std::string& text) {
+    CORRADE_ASSERT(id < _strings.size(),
+        "Text::BatchRenderer::setText(): index" << id << "out of range for" << _strings.size() << "strings", *this);
+
+    std::vector<Vertex> vertices;
+    Range2D rectangle;
+    std::tie(vertices, rectangle) = renderVerticesInternal(_font, _cache, _fontSize, text, _alignment);
+
+    CORRADE_ASSERT(vertices.size()/4 <= _strings[id].glyphCapacity,
+        "Text::BatchRenderer::setText(): string" << id << "capacity" << _strings[id].glyphCapacity << "too small to render" << vertices.size()/4 << "glyphs", *this);
+
+    const Containers::StridedArrayView1D<const Vertex> vertexView = Containers::stridedArrayView(vertices);
+    setTextInternal(id, vertexView.slice(&Vertex::position), vertexView.slice(&Vertex::textureCoordinates), rectangle);
+    return *this;
+}
+
+AbstractBatchRenderer& AbstractBatchRenderer::setOffset(const UnsignedInt id, const Vector2& offset) {
+    CORRADE_ASSERT(id < _strings.size(),
+        "Text::BatchRenderer::setOffset(): index" << id << "out of range for" << _strings.size() << "strings", *this);
+    _strings[id].offset = offset;
+    updateVertices(id);
+    return *this;
+}
+
+AbstractBatchRenderer& AbstractBatchRenderer::setColor(const UnsignedInt id, const Color4& color) {
+    CORRADE_ASSERT(id < _strings.size(),
+        "Text::BatchRenderer::setColor(): index" << id << "out of range for" << _strings.size() << "strings", *this);
+    _strings[id].color = color;
+    updateVertices(id);
+    return *this;
+}
+
+void AbstractBatchRenderer::setTextInternal(const UnsignedInt id, const Containers::StridedArrayView1D<const Vector2>& positions, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Range2D& rectangle) {
+    String& string = _strings[id];
+    string.rectangle = rectangle;
+
+    /* Copy the new glyphs, reset the unused remainder of the capacity to
+       degenerate quads */
+    const std::size_t begin = string.glyphOffset*4;
+    const std::size_t end = begin + string.glyphCapacity*4;
+    const std::size_t used = begin + positions.size();
+    const Containers::StridedArrayView1D<GlyphVertex> vertices = Containers::stridedArrayView(_vertices);
+    Utility::copy(positions, Containers::stridedArrayView(_positions).slice(begin, used));
+    Utility::copy(textureCoordinates, vertices.slice(begin, used).slice(&GlyphVertex::textureCoordinates));
+    for(std::size_t i = used; i != end; ++i) {
+        _positions[i] = {};
+        _vertices[i].textureCoordinates = {};
+    }
+
+    updateVertices(id);
+}
+
+void AbstractBatchRenderer::updateVertices(const UnsignedInt id) {
+    const String& string = _strings[id];
+    const std::size_t begin = string.glyphOffset*4;
+    const std::size_t end = begin + string.glyphCapacity*4;
+    for(std::size_t i = begin; i != end; ++i) {
+        _vertices[i].position = _positions[i] + string.offset;
+        _vertices[i].color = string.color;
+    }
+
+    _dirtyBegin = Math::min(_dirtyBegin, string.glyphOffset);
+    _dirtyEnd = Math::max(_dirtyEnd, string.glyphOffset + string.glyphCapacity);
+}
+
+void AbstractBatchRenderer::clear() {
+    arrayResize(_strings, 0);
+    _glyphCount = 0;
+    _dirtyBegin = ~UnsignedInt{};
+    _dirtyEnd = 0;
+    _mesh.setCount(0);
+}
+
+void AbstractBatchRenderer::update() {
+    if(_dirtyBegin < _dirtyEnd) {
+        _vertexBuffer.setSubData(_dirtyBegin*4*sizeof(GlyphVertex), _vertices.slice(_dirtyBegin*4, _dirtyEnd*4));
+        _dirtyBegin = ~UnsignedInt{};
+        _dirtyEnd = 0;
+    }
+
+    _mesh.setCount(_glyphCount*6);
+}
+
+template<UnsignedInt dimensions> BatchRenderer<dimensions>::BatchRenderer(AbstractFont& font, const AbstractGlyphCache& cache, const Float size, const Alignment alignment): AbstractBatchRenderer{font, cache, size, alignment} {
+    /* Finalize mesh configuration */
+    _mesh.addVertexBuffer(_vertexBuffer, 0,
+        typename Shaders::GenericGL<dimensions>::Position(
+            Shaders::GenericGL<dimensions>::Position::Components::Two),
+        typename Shaders::GenericGL<dimensions>::TextureCoordinates(),
+        typename Shaders::GenericGL<dimensions>::Color4());
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template class MAGNUM_TEXT_EXPORT BatchRenderer<2>;
+template class MAGNUM_TEXT_EXPORT BatchRenderer<3>;
+#endif
 #endif
 
 }}
@@ -27,7 +27,7 @@
 */
 
 /** @file Text/Renderer.h
- * @brief Class @ref Magnum::Text::AbstractRenderer, @ref Magnum::Text::Renderer, typedef @ref Magnum::Text::Renderer2D, @ref Magnum::Text::Renderer3D, function @ref Magnum::Text::renderLineGlyphPositionsInto(), @ref Magnum::Text::renderGlyphQuadsInto(), @ref Magnum::Text::alignRenderedLine(), @ref Magnum::Text::alignRenderedBlock(), @ref Magnum::Text::renderGlyphQuadIndicesInto()
+ * @brief Class @ref Magnum::Text::AbstractRenderer, @ref Magnum::Text::Renderer, @ref Magnum::Text::AbstractBatchRenderer, @ref Magnum::Text::BatchRenderer, typedef @ref Magnum::Text::Renderer2D, @ref Magnum::Text::Renderer3D, @ref Magnum::Text::BatchRenderer2D, @ref Magnum::Text::BatchRenderer3D, function @ref Magnum::Text::renderLineGlyphPositionsInto(), @ref Magnum::Text::renderGlyphQuadsInto(), @ref Magnum::Text::alignRenderedLine(), @ref Magnum::Text::alignRenderedBlock(), @ref Magnum::Text::renderGlyphQuadIndicesInto()
  */
 
 #include "Magnum/Magnum.h"
@@ -43,11 +43,9 @@
 #include "Magnum/Math/Range.h"
 #include "Magnum/GL/Buffer.h"
 #include "Magnum/GL/Mesh.h"
-#include "Magnum/Text/Alignment.h"
-
-#ifdef CORRADE_TARGET_EMSCRIPTEN
 #include <Corrade/Containers/Array.h>
-#endif
+
+#include "Magnum/Text/Alignment.h"
 #endif
 
 namespace Magnum { namespace Text {
@@ -628,6 +626,287 @@ typedef Renderer<2> Renderer2D;
     for more information.
 */
 typedef Renderer<3> Renderer3D;
+
+/**
+@brief Base for batch text renderers
+@m_since_latest
+
+Not meant to be used directly, see the @ref BatchRenderer class for more
+information.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
+    for more information.
+
+@see @ref BatchRenderer2D, @ref BatchRenderer3D
+*/
+class MAGNUM_TEXT_EXPORT AbstractBatchRenderer {
+    public:
+        /** @brief Copying is not allowed */
+        AbstractBatchRenderer(const AbstractBatchRenderer&) = delete;
+
+        /**
+         * @brief Moving is not allowed
+         *
+         * The mesh references the vertex and index buffer owned by the
+         * instance.
+         */
+        AbstractBatchRenderer(AbstractBatchRenderer&&) = delete;
+
+        /** @brief Copying is not allowed */
+        AbstractBatchRenderer& operator=(const AbstractBatchRenderer&) = delete;
+
+        /** @brief Moving is not allowed */
+        AbstractBatchRenderer& operator=(AbstractBatchRenderer&&) = delete;
+
+        /** @brief Font size in points */
+        Float fontSize() const { return _fontSize; }
+
+        /**
+         * @brief Capacity for rendered glyphs
+         *
+         * Total count of glyphs all strings can occupy.
+         * @see @ref reserve(), @ref glyphCount()
+         */
+        UnsignedInt capacity() const { return _capacity; }
+
+        /**
+         * @brief Count of glyphs occupied by all strings
+         *
+         * Sum of glyph capacities of all strings added with @ref add(). Not
+         * larger than @ref capacity().
+         */
+        UnsignedInt glyphCount() const { return _glyphCount; }
+
+        /**
+         * @brief Count of added strings
+         *
+         * @see @ref add(), @ref clear()
+         */
+        UnsignedInt stringCount() const;
+
+        /** @brief Vertex buffer */
+        GL::Buffer& vertexBuffer() { return _vertexBuffer; }
+
+        /** @brief Index buffer */
+        GL::Buffer& indexBuffer() { return _indexBuffer; }
+
+        /**
+         * @brief Mesh
+         *
+         * Contains all strings added with @ref add(). The index count gets
+         * updated in @ref update().
+         */
+        GL::Mesh& mesh() { return _mesh; }
+
+        /**
+         * @brief Reserve capacity for rendered glyphs
+         *
+         * Reallocates memory in buffers to hold @p glyphCapacity glyphs,
+         * preserving all strings added so far, and prefills the index buffer.
+         * Expects that @p glyphCapacity is not less than @ref glyphCount().
+         * The vertex buffer is updated only in parts that changed, so the
+         * @p vertexBufferUsage should reflect how often the strings change.
+         * The index buffer is changed only by calling this function.
+         *
+         * Initially zero capacity is reserved.
+         * @see @ref capacity()
+         */
+        void reserve(UnsignedInt glyphCapacity, GL::BufferUsage vertexBufferUsage, GL::BufferUsage indexBufferUsage);
+
+        /**
+         * @brief Add a string
+         * @param text          Text to render
+         * @param offset        Offset at which to place the string
+         * @param color         String color
+         * @param glyphCapacity Count of glyphs to reserve for this string.
+         *      If @cpp 0 @ce, the glyph count of @p text is used.
+         * @return ID of the added string, to be used in @ref setText(),
+         *      @ref setOffset() and @ref setColor()
+         *
+         * Expects that the glyph count of @p text isn't larger than
+         * @p glyphCapacity and that @ref glyphCount() together with
+         * @p glyphCapacity fits into @ref capacity(). Glyph slots not used by
+         * the text are filled with degenerate quads, meaning they're not
+         * drawn. The data get uploaded to the GPU on the next @ref update()
+         * call.
+         */
+        UnsignedInt add(const std::string& text, const Vector2& offset, const Color4& color, UnsignedInt glyphCapacity = 0);
+
+        /**
+         * @brief String offset
+         *
+         * Expects that @p id is less than @ref stringCount().
+         */
+        Vector2 offset(UnsignedInt id) const;
+
+        /**
+         * @brief String color
+         *
+         * Expects that @p id is less than @ref stringCount().
+         */
+        Color4 color(UnsignedInt id) const;
+
+        /**
+         * @brief Rectangle spanning the string
+         *
+         * Includes the offset set in @ref add() or @ref setOffset(). Expects
+         * that @p id is less than @ref stringCount().
+         */
+        Range2D rectangle(UnsignedInt id) const;
+
+        /**
+         * @brief Change string text
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p id is less than @ref stringCount() and that glyph
+         * count of @p text fits into the glyph capacity the string was added
+         * with. Only the glyph range belonging to given string is
+         * re-rendered, the data get uploaded to the GPU on the next
+         * @ref update() call.
+         */
+        AbstractBatchRenderer& setText(UnsignedInt id, const std::string& text);
+
+        /**
+         * @brief Change string offset
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p id is less than @ref stringCount(). Doesn't
+         * re-render the text, the data get uploaded to the GPU on the next
+         * @ref update() call.
+         */
+        AbstractBatchRenderer& setOffset(UnsignedInt id, const Vector2& offset);
+
+        /**
+         * @brief Change string color
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p id is less than @ref stringCount(). Doesn't
+         * re-render the text, the data get uploaded to the GPU on the next
+         * @ref update() call.
+         */
+        AbstractBatchRenderer& setColor(UnsignedInt id, const Color4& color);
+
+        /**
+         * @brief Remove all strings
+         *
+         * Sets @ref stringCount() and @ref glyphCount() to zero, the
+         * @ref capacity() and buffer contents are kept.
+         */
+        void clear();
+
+        /**
+         * @brief Upload changed strings to the GPU
+         *
+         * Uploads a single contiguous range of the vertex buffer that spans
+         * all strings added or changed since the last call and updates the
+         * index count of @ref mesh(). If nothing changed, the buffer isn't
+         * touched.
+         */
+        void update();
+
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    protected:
+    #else
+    private:
+    #endif
+        explicit MAGNUM_TEXT_LOCAL AbstractBatchRenderer(AbstractFont& font, const AbstractGlyphCache& cache, Float size, Alignment alignment);
+
+        ~AbstractBatchRenderer();
+
+        GL::Buffer _vertexBuffer, _indexBuffer;
+        GL::Mesh _mesh;
+
+    private:
+        struct GlyphVertex;
+        struct String;
+
+        MAGNUM_TEXT_LOCAL void setTextInternal(UnsignedInt id, const Containers::StridedArrayView1D<const Vector2>& positions, const Containers::StridedArrayView1D<const Vector2>& textureCoordinates, const Range2D& rectangle);
+        MAGNUM_TEXT_LOCAL void updateVertices(UnsignedInt id);
+
+        AbstractFont& _font;
+        const AbstractGlyphCache& _cache;
+        Float _fontSize;
+        Alignment _alignment;
+        UnsignedInt _capacity{}, _glyphCount{};
+        /* Glyph range modified since last update(), empty if begin >= end */
+        UnsignedInt _dirtyBegin{~UnsignedInt{}}, _dirtyEnd{};
+        /* Positions without the per-string offset applied, so changing the
+           offset doesn't need to re-render the text */
+        Containers::Array<Vector2> _positions;
+        Containers::Array<GlyphVertex> _vertices;
+        Containers::Array<String> _strings;
+};
+
+/**
+@brief Batch text renderer
+@m_since_latest
+
+Lays out many strings into a single shared vertex buffer, drawn with a single
+shared index buffer and hence a single draw call. Compared to having a
+@ref Renderer instance for each string, which results in one buffer pair and
+one draw call per string, this is suited for scenarios with many small labels
+such as HUDs or annotations.
+
+@section Text-BatchRenderer-usage Usage
+
+Reserve the total glyph capacity first, then add strings with a per-string
+offset and color. Each string gets a contiguous glyph range in the vertex
+buffer sized either by its initial text or by an explicitly passed glyph
+capacity, which makes it possible to change the text later as long as it fits.
+Changes are collected on the CPU side and uploaded on @ref update(), which
+touches only the part of the vertex buffer spanning the changed strings. The
+per-string color is stored in the vertex data, so the shader needs to have
+@ref Shaders::VectorGL::Flag::VertexColor enabled:
+
+@snippet Text-gl.cpp BatchRenderer-usage
+
+The vertex buffer contains a 2D position, 2D texture coordinates and a
+four-component color for each vertex, meaning the mesh is usable with
+@ref Shaders::VectorGL with @ref Shaders::VectorGL::Flag::VertexColor. Glyph
+slots not occupied by the string text are filled with degenerate quads, and
+thus draw nothing. Like with @ref Renderer, array glyph caches are not
+supported.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
+    for more information.
+
+@see @ref BatchRenderer2D, @ref BatchRenderer3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_TEXT_EXPORT BatchRenderer: public AbstractBatchRenderer {
+    public:
+        /**
+         * @brief Constructor
+         * @param font          Font
+         * @param cache         Glyph cache
+         * @param size          Font size
+         * @param alignment     Text alignment, applied to each string
+         *      relative to its offset
+         */
+        explicit BatchRenderer(AbstractFont& font, const AbstractGlyphCache& cache, Float size, Alignment alignment = Alignment::LineLeft);
+        BatchRenderer(AbstractFont&, AbstractGlyphCache&&, Float, Alignment alignment = Alignment::LineLeft) = delete; /**< @overload */
+};
+
+/**
+@brief Two-dimensional batch text renderer
+@m_since_latest
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
+    for more information.
+*/
+typedef BatchRenderer<2> BatchRenderer2D;
+
+/**
+@brief Three-dimensional batch text renderer
+@m_since_latest
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
+    for more information.
+*/
+typedef BatchRenderer<3> BatchRenderer3D;
 #endif
 
 }}
@@ -0,0 +1,163 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ShapeRuns.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/AbstractShaper.h"
+#include "Magnum/Text/Feature.h"
+
+namespace Magnum { namespace Text {
+
+namespace {
+
+/* Creating a shaper isn't free, so there's at most this many of them, each
+   processing a contiguous chunk of runs. Enough to keep a few dozen threads
+   busy even if the runs have uneven sizes. */
+constexpr std::size_t MaxChunkCount = 64;
+
+struct ShapeRunsState {
+    Containers::StringView text;
+    Containers::ArrayView<const Containers::Pair<UnsignedInt, UnsignedInt>> runs;
+    Containers::ArrayView<const FeatureRange> features;
+    Containers::ArrayView<UnsignedInt> runGlyphOffsets;
+    std::size_t runsPerChunk;
+    Containers::ArrayView<Containers::Pointer<AbstractShaper>> shapers;
+    Containers::ArrayView<Containers::Array<ShapedGlyph>> chunkGlyphs;
+    Containers::ArrayView<ShapedGlyph> out;
+};
+
+/* Shapes runs of given chunk into a chunk-local array, saving glyph count of
+   each run to runGlyphOffsets[i + 1] */
+void shapeChunk(void* const state, const std::size_t chunk) {
+    ShapeRunsState& s = *static_cast<ShapeRunsState*>(state);
+    AbstractShaper& shaper = *s.shapers[chunk];
+    Containers::Array<ShapedGlyph>& glyphs = s.chunkGlyphs[chunk];
+    const std::size_t runBegin = chunk*s.runsPerChunk;
+    const std::size_t runEnd = Math::min(runBegin + s.runsPerChunk, s.runs.size());
+    for(std::size_t i = runBegin; i != runEnd; ++i) {
+        const UnsignedInt glyphCount = shaper.shape(s.text, s.runs[i].first(), s.runs[i].second(), s.features);
+        const Containers::StridedArrayView1D<ShapedGlyph> runGlyphs = arrayAppend(glyphs, NoInit, glyphCount);
+        shaper.glyphIdsInto(runGlyphs.slice(&ShapedGlyph::id));
+        shaper.glyphOffsetsAdvancesInto(
+            runGlyphs.slice(&ShapedGlyph::offset),
+            runGlyphs.slice(&ShapedGlyph::advance));
+        shaper.glyphClustersInto(runGlyphs.slice(&ShapedGlyph::cluster));
+        s.runGlyphOffsets[i + 1] = glyphCount;
+    }
+}
+
+/* Copies the chunk-local array to its place in the output */
+void copyChunk(void* const state, const std::size_t chunk) {
+    ShapeRunsState& s = *static_cast<ShapeRunsState*>(state);
+    const Containers::ArrayView<const ShapedGlyph> glyphs = s.chunkGlyphs[chunk];
+    Utility::copy(glyphs, s.out.sliceSize(s.runGlyphOffsets[chunk*s.runsPerChunk], glyphs.size()));
+}
+
+}
+
+Containers::Array<ShapedGlyph> shapeRuns(AbstractFont& font, const Containers::StringView text, const Containers::ArrayView<const Containers::Pair<UnsignedInt, UnsignedInt>> runs, const Containers::ArrayView<const FeatureRange> features, const Containers::ArrayView<UnsignedInt> runGlyphOffsets, const ParallelFor parallelFor, void* const parallelForState) {
+    CORRADE_ASSERT(font.isOpened(),
+        "Text::shapeRuns(): no font opened", {});
+    CORRADE_ASSERT(runs.isEmpty() ? runGlyphOffsets.isEmpty() : runGlyphOffsets.size() == runs.size() + 1,
+        "Text::shapeRuns(): expected run glyph offsets to have" << (runs.isEmpty() ? 0 : runs.size() + 1) << "elements but got" << runGlyphOffsets.size(), {});
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != runs.size(); ++i) {
+        CORRADE_ASSERT(runs[i].first() <= runs[i].second() && runs[i].second() <= text.size(),
+            "Text::shapeRuns(): run" << i << "begin" << runs[i].first() << "and end" << runs[i].second() << "out of range for a text of" << text.size() << "bytes", {});
+    }
+    #endif
+    if(runs.isEmpty())
+        return {};
+
+    /* If the shapers can't be used concurrently, do everything in a single
+       chunk directly on this thread */
+    const bool concurrent = !!(font.features() & FontFeature::ConcurrentShaping);
+    const std::size_t runsPerChunk = concurrent ? (runs.size() + MaxChunkCount - 1)/MaxChunkCount : runs.size();
+    const std::size_t chunkCount = (runs.size() + runsPerChunk - 1)/runsPerChunk;
+
+    /* The shapers are created here and not in the tasks, as createShaper()
+       itself isn't guaranteed to be thread-safe */
+    Containers::Array<Containers::Pointer<AbstractShaper>> shapers{chunkCount};
+    for(Containers::Pointer<AbstractShaper>& shaper: shapers)
+        shaper = font.createShaper();
+    Containers::Array<Containers::Array<ShapedGlyph>> chunkGlyphs{chunkCount};
+
+    ShapeRunsState state{text, runs, features, runGlyphOffsets, runsPerChunk,
+        shapers, chunkGlyphs, nullptr};
+    if(concurrent)
+        (parallelFor ? parallelFor : parallelForSerial)(parallelForState, chunkCount, shapeChunk, &state);
+    else
+        shapeChunk(&state, 0);
+
+    /* Convert the per-run glyph counts to offsets */
+    runGlyphOffsets[0] = 0;
+    for(std::size_t i = 0; i != runs.size(); ++i)
+        runGlyphOffsets[i + 1] += runGlyphOffsets[i];
+
+    /* Copy the chunks to their final place. Done even for the serial case
+       to not return an array with a growable deleter. */
+    Containers::Array<ShapedGlyph> out{NoInit, runGlyphOffsets.back()};
+    state.out = out;
+    if(concurrent)
+        (parallelFor ? parallelFor : parallelForSerial)(parallelForState, chunkCount, copyChunk, &state);
+    else
+        copyChunk(&state, 0);
+    return out;
+}
+
+Containers::Array<ShapedGlyph> shapeRuns(AbstractFont& font, const Containers::StringView text, const Containers::ArrayView<const Containers::Pair<UnsignedInt, UnsignedInt>> runs, const std::initializer_list<FeatureRange> features, const Containers::ArrayView<UnsignedInt> runGlyphOffsets, const ParallelFor parallelFor, void* const parallelForState) {
+    return shapeRuns(font, text, runs, Containers::arrayView(features), runGlyphOffsets, parallelFor, parallelForState);
+}
+
+Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> textLineRuns(const Containers::StringView text) {
+    Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> out;
+    UnsignedInt begin = 0;
+    for(;;) {
+        const Containers::StringView newline = text.exceptPrefix(begin).find('\n');
+        if(newline.isEmpty()) break;
+
+        const UnsignedInt end = newline.data() - text.data();
+        arrayAppend(out, InPlaceInit, begin, end);
+        begin = end + 1;
+    }
+    arrayAppend(out, InPlaceInit, begin, UnsignedInt(text.size()));
+
+    /* Convert back to a default deleter to make the returned array usable
+       even after the library is unloaded */
+    arrayShrink(out, DefaultInit);
+    return out;
+}
+
+}}
@@ -0,0 +1,130 @@
+#ifndef Magnum_Text_ShapeRuns_h
+#define Magnum_Text_ShapeRuns_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Struct @ref Magnum::Text::ShapedGlyph, function @ref Magnum::Text::shapeRuns(), @ref Magnum::Text::textLineRuns()
+ * @m_since_latest
+ */
+
+#include <initializer_list>
+
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Text/Parallel.h"
+#include "Magnum/Text/Text.h"
+#include "Magnum/Text/visibility.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Shaped glyph
+@m_since_latest
+
+Output of @ref shapeRuns(). Contains the same information as retrieved from
+@ref AbstractShaper::glyphIdsInto(),
+@ref AbstractShaper::glyphOffsetsAdvancesInto() and
+@ref AbstractShaper::glyphClustersInto(), interleaved.
+*/
+struct ShapedGlyph {
+    /** @brief Glyph ID */
+    UnsignedInt id;
+
+    /**
+     * @brief Cluster
+     *
+     * Byte position in the whole text passed to @ref shapeRuns().
+     */
+    UnsignedInt cluster;
+
+    /** @brief Glyph offset */
+    Vector2 offset;
+
+    /** @brief Glyph advance */
+    Vector2 advance;
+};
+
+/**
+@brief Shape text runs, potentially on multiple threads
+@param[in]  font            Font to shape with
+@param[in]  text            Text to shape
+@param[in]  runs            Byte ranges of independent runs in @p text
+@param[in]  features        Typographic features to apply, with ranges in
+    bytes of the whole @p text
+@param[out] runGlyphOffsets Where to put glyph offsets of each run in the
+    returned array
+@param[in]  parallelFor     Parallel loop executor or @cpp nullptr @ce
+@param[in]  parallelForState State pointer passed to @p parallelFor
+@return Shaped glyphs of all runs, concatenated in the order of @p runs
+@m_since_latest
+
+Each run is shaped separately with the whole @p text passed to
+@ref AbstractShaper::shape() and the run as its begin and end, so the shaper
+can make decisions based on surrounding context and the cluster IDs in the
+output are relative to the whole @p text. Script, language and direction are
+autodetected for each run. Glyphs of the @cpp i @ce-th run are then at the
+@cpp [runGlyphOffsets[i], runGlyphOffsets[i + 1]) @ce range of the returned
+array.
+
+If @p font advertises @ref FontFeature::ConcurrentShaping, the runs are
+distributed into at most 64 chunks, a dedicated @ref AbstractShaper instance
+is created for each chunk on the calling thread and the chunks are shaped and
+then copied to the output via @p parallelFor. Otherwise the runs are shaped
+serially on the calling thread with a single @ref AbstractShaper instance and
+@p parallelFor isn't called at all. In both cases the output is the same. See
+@ref Text-AbstractShaper-usage-threads for details about the threading
+guarantees.
+
+Expects that @p font is opened, that all @p runs are in bounds of @p text
+with begin not larger than end, and that @p runGlyphOffsets has size of
+@p runs plus one, or is empty if @p runs are empty. A suitable split of a text
+into runs can be made for example with @ref textLineRuns().
+@see @ref Text-AbstractShaper-usage
+*/
+MAGNUM_TEXT_EXPORT Containers::Array<ShapedGlyph> shapeRuns(AbstractFont& font, Containers::StringView text, Containers::ArrayView<const Containers::Pair<UnsignedInt, UnsignedInt>> runs, Containers::ArrayView<const FeatureRange> features, Containers::ArrayView<UnsignedInt> runGlyphOffsets, ParallelFor parallelFor, void* parallelForState);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_TEXT_EXPORT Containers::Array<ShapedGlyph> shapeRuns(AbstractFont& font, Containers::StringView text, Containers::ArrayView<const Containers::Pair<UnsignedInt, UnsignedInt>> runs, std::initializer_list<FeatureRange> features, Containers::ArrayView<UnsignedInt> runGlyphOffsets, ParallelFor parallelFor, void* parallelForState);
+
+/**
+@brief Split a text into runs at line breaks
+@m_since_latest
+
+Returns a byte range for each line in @p text, excluding the @cpp '\n' @ce
+characters. An empty text or a text ending with a @cpp '\n' @ce produces an
+empty run at the end. The output is suitable to be passed to @ref shapeRuns(),
+as line breaks are a natural boundary where the shaping context doesn't need to
+carry over.
+*/
+MAGNUM_TEXT_EXPORT Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> textLineRuns(Containers::StringView text);
+
+}}
+
+#endif
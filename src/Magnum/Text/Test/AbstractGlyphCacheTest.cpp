@@ -108,6 +108,10 @@ struct AbstractGlyphCacheTest: TestSuite::Tester {
     void addGlyphTooMany();
     void addGlyph2DNot2D();
 
+    void evictGlyphs();
+    void evictGlyphsEmpty();
+    void markGlyphsUsedOutOfRange();
+
     #ifdef MAGNUM_BUILD_DEPRECATED
     void insert();
     void insertNot2D();
@@ -119,6 +123,7 @@ struct AbstractGlyphCacheTest: TestSuite::Tester {
     void flushImageLayer();
     void flushImage2D();
     void flushImage2DPassthrough2D();
+    void flushImageGlyphRectangles();
     void flushImageNotImplemented();
     void flushImagePassthrough2DNotImplemented();
     void flushImageOutOfRange();
@@ -236,6 +241,10 @@ AbstractGlyphCacheTest::AbstractGlyphCacheTest() {
               &AbstractGlyphCacheTest::addGlyphTooMany,
               &AbstractGlyphCacheTest::addGlyph2DNot2D,
 
+              &AbstractGlyphCacheTest::evictGlyphs,
+              &AbstractGlyphCacheTest::evictGlyphsEmpty,
+              &AbstractGlyphCacheTest::markGlyphsUsedOutOfRange,
+
               #ifdef MAGNUM_BUILD_DEPRECATED
               &AbstractGlyphCacheTest::insert,
               &AbstractGlyphCacheTest::insertNot2D,
@@ -250,7 +259,8 @@ AbstractGlyphCacheTest::AbstractGlyphCacheTest() {
                        &AbstractGlyphCacheTest::flushImage2DPassthrough2D},
         Containers::arraySize(FlushImageData));
 
-    addTests({&AbstractGlyphCacheTest::flushImageNotImplemented,
+    addTests({&AbstractGlyphCacheTest::flushImageGlyphRectangles,
+              &AbstractGlyphCacheTest::flushImageNotImplemented,
               &AbstractGlyphCacheTest::flushImagePassthrough2DNotImplemented});
 
     addInstancedTests({&AbstractGlyphCacheTest::flushImageOutOfRange},
@@ -1081,6 +1091,93 @@ void AbstractGlyphCacheTest::addGlyph2DNot2D() {
     CORRADE_COMPARE(out.str(), "Text::AbstractGlyphCache::addGlyph(): use the layer overload for an array glyph cache\n");
 }
 
+void AbstractGlyphCacheTest::evictGlyphs() {
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {16, 8}, {1, 1}};
+    UnsignedInt fontId = cache.addFont(5);
+
+    /* Four glyphs, placed next to each other including padding */
+    Vector2i offsets[4];
+    CORRADE_VERIFY(cache.atlas().add({{2, 2}, {2, 2}, {2, 2}, {2, 2}}, offsets));
+    for(UnsignedInt i = 0; i != 4; ++i)
+        CORRADE_COMPARE(cache.addGlyph(fontId, i, {}, Range2Di::fromSize(offsets[i], {2, 2})), i + 1);
+    CORRADE_COMPARE(cache.glyphCount(), 5);
+    for(char& i: cache.image().data())
+        i = '\xff';
+
+    /* Glyph 2 is used the least recently, as it wasn't marked at all, then
+       glyph 1. Glyphs 3 and 4 were marked in the same call, the invalid glyph
+       is ignored. */
+    cache.markGlyphsUsed({1, 3});
+    cache.markGlyphsUsed({0, 4, 3});
+
+    CORRADE_COMPARE(cache.evictGlyphs(2), 2);
+    CORRADE_COMPARE(cache.glyphCount(), 5);
+    CORRADE_COMPARE(cache.glyphId(fontId, 0), 0);
+    CORRADE_COMPARE(cache.glyphId(fontId, 1), 0);
+    CORRADE_COMPARE(cache.glyphId(fontId, 2), 3);
+    CORRADE_COMPARE(cache.glyphId(fontId, 3), 4);
+    CORRADE_COMPARE(cache.glyph(1), Containers::triple(Vector2i{}, 0, Range2Di{}));
+    CORRADE_COMPARE(cache.glyph(2), Containers::triple(Vector2i{}, 0, Range2Di{}));
+    CORRADE_COMPARE(cache.glyph(3), Containers::triple(
+        Vector2i{-1, -1},
+        0,
+        Range2Di{{8, 0}, {12, 4}}));
+
+    /* The evicted area including padding is cleared, the rest is kept */
+    Containers::StridedArrayView2D<const UnsignedByte> pixels = cache.image().pixels<UnsignedByte>()[0];
+    CORRADE_COMPARE_AS(pixels[3], Containers::arrayView<UnsignedByte>({
+        0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(pixels[4], Containers::arrayView<UnsignedByte>({
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    }), TestSuite::Compare::Container);
+
+    /* The area is given back to the atlas, so the next glyph gets placed to
+       where the first evicted was. IDs of the evicted glyphs get reused, the
+       most recently evicted first. */
+    CORRADE_VERIFY(cache.atlas().add({{2, 2}}, Containers::arrayView(offsets).prefix(1)));
+    CORRADE_COMPARE(offsets[0], (Vector2i{1, 1}));
+    CORRADE_COMPARE(cache.addGlyph(fontId, 4, {}, Range2Di::fromSize(offsets[0], {2, 2})), 1);
+    CORRADE_COMPARE(cache.addGlyph(fontId, 1, {}, {{5, 1}, {7, 3}}), 2);
+    CORRADE_COMPARE(cache.glyphId(fontId, 4), 1);
+    CORRADE_COMPARE(cache.glyphId(fontId, 1), 2);
+    CORRADE_COMPARE(cache.glyphCount(), 5);
+
+    /* Only after that new IDs get allocated */
+    CORRADE_COMPARE(cache.addGlyph(fontId, 0, {}, {{1, 5}, {3, 7}}), 5);
+    CORRADE_COMPARE(cache.glyphCount(), 6);
+
+    /* Evicting more than there is evicts just what's there */
+    CORRADE_COMPARE(cache.evictGlyphs(100), 5);
+    for(UnsignedInt i = 0; i != 5; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(cache.glyphId(fontId, i), 0);
+    }
+    CORRADE_COMPARE(cache.evictGlyphs(1), 0);
+}
+
+void AbstractGlyphCacheTest::evictGlyphsEmpty() {
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {16, 8}};
+
+    /* The invalid glyph is never evicted */
+    CORRADE_COMPARE(cache.evictGlyphs(1), 0);
+    CORRADE_COMPARE(cache.glyphCount(), 1);
+}
+
+void AbstractGlyphCacheTest::markGlyphsUsedOutOfRange() {
+    CORRADE_SKIP_IF_NO_DEBUG_ASSERT();
+
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {16, 8}};
+    UnsignedInt fontId = cache.addFont(3);
+    cache.addGlyph(fontId, 1, {}, {{1, 1}, {3, 3}});
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    cache.markGlyphsUsed({1, 0, 2});
+    CORRADE_COMPARE(out.str(),
+        "Text::AbstractGlyphCache::markGlyphsUsed(): glyph 2 index 2 out of range for 2 glyphs\n");
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 void AbstractGlyphCacheTest::insert() {
     DummyGlyphCache cache{PixelFormat::R8Unorm, {100, 200}, {2, 3}};
@@ -1438,6 +1535,58 @@ void AbstractGlyphCacheTest::flushImage2D() {
     CORRADE_VERIFY(cache.called);
 }
 
+void AbstractGlyphCacheTest::flushImageGlyphRectangles() {
+    struct Cache: AbstractGlyphCache {
+        using AbstractGlyphCache::AbstractGlyphCache;
+        using AbstractGlyphCache::flushedGlyphRectangles;
+
+        GlyphCacheFeatures doFeatures() const override { return {}; }
+        void doSetImage(const Vector3i&, const ImageView3D&) override {
+            rectangles = Containers::Array<Range3Di>{NoInit, flushedGlyphRectangles().size()};
+            Utility::copy(flushedGlyphRectangles(), rectangles);
+        }
+
+        Containers::Array<Range3Di> rectangles;
+    } cache{PixelFormat::R8Unorm, {45, 35, 2}, {1, 2}};
+
+    /* Nothing outside of a flush */
+    CORRADE_VERIFY(cache.flushedGlyphRectangles().isEmpty());
+
+    cache.addFont(3);
+    cache.addGlyph(0, 0, {}, 0, {{5, 5}, {8, 9}});
+    cache.addGlyph(0, 1, {}, 1, {{20, 10}, {25, 12}});
+    cache.addGlyph(0, 2, {}, 0, {{30, 20}, {33, 22}});
+    CORRADE_VERIFY(cache.flushedGlyphRectangles().isEmpty());
+
+    /* The first glyph is inside the padded range, the second is clipped to
+       it, the third is outside */
+    cache.flushImage({{4, 4, 0}, {22, 12, 2}});
+    CORRADE_COMPARE_AS(cache.rectangles, Containers::arrayView<Range3Di>({
+        {{4, 3, 0}, {9, 11, 1}},
+        {{19, 8, 1}, {23, 14, 2}},
+    }), TestSuite::Compare::Container);
+    CORRADE_VERIFY(cache.flushedGlyphRectangles().isEmpty());
+
+    /* Flushing the same range again has no glyphs, meaning the whole range
+       should be processed */
+    cache.flushImage({{4, 4, 0}, {22, 12, 2}});
+    CORRADE_COMPARE_AS(cache.rectangles,
+        Containers::ArrayView<const Range3Di>{},
+        TestSuite::Compare::Container);
+
+    /* The remaining glyph is flushed with the whole area */
+    cache.flushImage({{}, {45, 35, 2}});
+    CORRADE_COMPARE_AS(cache.rectangles, Containers::arrayView<Range3Di>({
+        {{29, 18, 0}, {34, 24, 1}},
+    }), TestSuite::Compare::Container);
+
+    /* And then there's nothing again */
+    cache.flushImage({{}, {45, 35, 2}});
+    CORRADE_COMPARE_AS(cache.rectangles,
+        Containers::ArrayView<const Range3Di>{},
+        TestSuite::Compare::Container);
+}
+
 void AbstractGlyphCacheTest::flushImage2DPassthrough2D() {
     auto&& data = FlushImageData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -0,0 +1,407 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringStl.h> /** @todo remove once Debug is stream-free */
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h> /** @todo remove once Debug is stream-free */
+
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Text/CachingShaper.h"
+#include "Magnum/Text/Direction.h"
+#include "Magnum/Text/Feature.h"
+#include "Magnum/Text/Script.h"
+
+namespace Magnum { namespace Text { namespace Test { namespace {
+
+struct CachingShaperTest: TestSuite::Tester {
+    explicit CachingShaperTest();
+
+    void construct();
+    void constructCopy();
+    void constructMove();
+
+    void shape();
+    void shapeDifferentKey();
+    void setScriptLanguageDirection();
+
+    void evict();
+    void evictLargerThanLimit();
+    void clear();
+};
+
+CachingShaperTest::CachingShaperTest() {
+    addTests({&CachingShaperTest::construct,
+              &CachingShaperTest::constructCopy,
+              &CachingShaperTest::constructMove,
+
+              &CachingShaperTest::shape,
+              &CachingShaperTest::shapeDifferentKey,
+              &CachingShaperTest::setScriptLanguageDirection,
+
+              &CachingShaperTest::evict,
+              &CachingShaperTest::evictLargerThanLimit,
+              &CachingShaperTest::clear});
+}
+
+using namespace Containers::Literals;
+
+AbstractFont& FakeFont = *reinterpret_cast<AbstractFont*>(std::size_t{0xdeadbeef});
+
+/* Glyph IDs are the input bytes, clusters the byte positions and the Y
+   advance is the byte value again to be able to distinguish the data */
+struct CountingShaper: AbstractShaper {
+    using AbstractShaper::AbstractShaper;
+
+    bool doSetScript(Script script) override {
+        _script = script;
+        return true;
+    }
+    bool doSetLanguage(Containers::StringView language) override {
+        _language = language;
+        return true;
+    }
+    bool doSetDirection(ShapeDirection direction) override {
+        _direction = direction;
+        return true;
+    }
+
+    UnsignedInt doShape(Containers::StringView text, UnsignedInt begin, UnsignedInt end, Containers::ArrayView<const FeatureRange>) override {
+        ++shapeCount;
+        if(end == ~UnsignedInt{}) end = text.size();
+        _text = text.slice(begin, end);
+        _begin = begin;
+        return end - begin;
+    }
+
+    Script doScript() const override {
+        return _script == Script::Unspecified ? Script::Latin : _script;
+    }
+    Containers::StringView doLanguage() const override {
+        return _language.isEmpty() ? "en"_s : Containers::StringView{_language};
+    }
+    ShapeDirection doDirection() const override {
+        return _direction == ShapeDirection::Unspecified ? ShapeDirection::LeftToRight : _direction;
+    }
+
+    void doGlyphIdsInto(const Containers::StridedArrayView1D<UnsignedInt>& ids) const override {
+        for(std::size_t i = 0; i != ids.size(); ++i)
+            ids[i] = _text[i];
+    }
+    void doGlyphOffsetsAdvancesInto(const Containers::StridedArrayView1D<Vector2>& offsets, const Containers::StridedArrayView1D<Vector2>& advances) const override {
+        for(std::size_t i = 0; i != offsets.size(); ++i) {
+            offsets[i] = {Float(i), 0.0f};
+            advances[i] = {1.0f, Float(_text[i])};
+        }
+    }
+    void doGlyphClustersInto(const Containers::StridedArrayView1D<UnsignedInt>& clusters) const override {
+        for(std::size_t i = 0; i != clusters.size(); ++i)
+            clusters[i] = _begin + i;
+    }
+
+    Int shapeCount = 0;
+
+    private:
+        Script _script = Script::Unspecified;
+        Containers::String _language;
+        ShapeDirection _direction = ShapeDirection::Unspecified;
+        Containers::StringView _text;
+        UnsignedInt _begin;
+};
+
+void CachingShaperTest::construct() {
+    CountingShaper wrapped{FakeFont};
+    CachingShaper shaper{wrapped, 1024};
+    CORRADE_COMPARE(&shaper.font(), &FakeFont);
+    CORRADE_COMPARE(&shaper.shaper(), &wrapped);
+    CORRADE_COMPARE(shaper.memoryLimit(), 1024);
+    CORRADE_COMPARE(shaper.memoryUsage(), 0);
+    CORRADE_COMPARE(shaper.entryCount(), 0);
+    CORRADE_COMPARE(shaper.hitCount(), 0);
+    CORRADE_COMPARE(shaper.missCount(), 0);
+    CORRADE_COMPARE(shaper.glyphCount(), 0);
+    CORRADE_COMPARE(shaper.script(), Script::Unspecified);
+    CORRADE_COMPARE(shaper.language(), ""_s);
+    CORRADE_COMPARE(shaper.direction(), ShapeDirection::Unspecified);
+
+    /* Const overloads */
+    const CachingShaper& cshaper = shaper;
+    CORRADE_COMPARE(&cshaper.shaper(), &wrapped);
+}
+
+void CachingShaperTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<CachingShaper>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<CachingShaper>{});
+}
+
+void CachingShaperTest::constructMove() {
+    CountingShaper wrapped{FakeFont};
+    CachingShaper a{wrapped, 1024};
+    a.shape("hello");
+
+    CachingShaper b = Utility::move(a);
+    CORRADE_COMPARE(&b.shaper(), &wrapped);
+    CORRADE_COMPARE(b.memoryLimit(), 1024);
+    CORRADE_COMPARE(b.entryCount(), 1);
+    CORRADE_COMPARE(b.glyphCount(), 5);
+
+    CountingShaper wrapped2{FakeFont};
+    CachingShaper c{wrapped2, 2048};
+    c = Utility::move(b);
+    CORRADE_COMPARE(&c.shaper(), &wrapped);
+    CORRADE_COMPARE(c.memoryLimit(), 1024);
+    CORRADE_COMPARE(c.entryCount(), 1);
+    CORRADE_COMPARE(c.glyphCount(), 5);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<CachingShaper>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<CachingShaper>::value);
+}
+
+void CachingShaperTest::shape() {
+    CountingShaper wrapped{FakeFont};
+    CachingShaper shaper{wrapped, 1024};
+
+    /* First call goes to the wrapped shaper, second is served from the cache
+       with a different text in between to verify the data aren't just left
+       over in the wrapped instance */
+    CORRADE_COMPARE(shaper.shape("hello world", 6, 11), 5);
+    CORRADE_COMPARE(shaper.shape("abc"), 3);
+    CORRADE_COMPARE(shaper.shape("hello world", 6, 11), 5);
+    CORRADE_COMPARE(wrapped.shapeCount, 2);
+    CORRADE_COMPARE(shaper.hitCount(), 1);
+    CORRADE_COMPARE(shaper.missCount(), 2);
+    CORRADE_COMPARE(shaper.entryCount(), 2);
+    CORRADE_VERIFY(shaper.memoryUsage() > 0);
+    CORRADE_COMPARE(shaper.glyphCount(), 5);
+    CORRADE_COMPARE(shaper.script(), Script::Latin);
+    CORRADE_COMPARE(shaper.language(), "en"_s);
+    CORRADE_COMPARE(shaper.direction(), ShapeDirection::LeftToRight);
+
+    UnsignedInt ids[5];
+    Vector2 offsets[5];
+    Vector2 advances[5];
+    UnsignedInt clusters[5];
+    shaper.glyphIdsInto(ids);
+    shaper.glyphOffsetsAdvancesInto(offsets, advances);
+    shaper.glyphClustersInto(clusters);
+    CORRADE_COMPARE_AS(Containers::arrayView(ids), Containers::arrayView<UnsignedInt>({
+        'w', 'o', 'r', 'l', 'd'
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(offsets), Containers::arrayView<Vector2>({
+        {0.0f, 0.0f}, {1.0f, 0.0f}, {2.0f, 0.0f}, {3.0f, 0.0f}, {4.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(advances), Containers::arrayView<Vector2>({
+        {1.0f, 'w'}, {1.0f, 'o'}, {1.0f, 'r'}, {1.0f, 'l'}, {1.0f, 'd'}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(clusters), Containers::arrayView<UnsignedInt>({
+        6, 7, 8, 9, 10
+    }), TestSuite::Compare::Container);
+}
+
+void CachingShaperTest::shapeDifferentKey() {
+    CountingShaper wrapped{FakeFont};
+    CachingShaper shaper{wrapped, 4096};
+
+    shaper.shape("hello world");
+    CORRADE_COMPARE(wrapped.shapeCount, 1);
+
+    /* Different range of the same text */
+    shaper.shape("hello world", 0, 5);
+    CORRADE_COMPARE(wrapped.shapeCount, 2);
+
+    /* Same range specified differently */
+    shaper.shape("hello world", 0, 11);
+    CORRADE_COMPARE(wrapped.shapeCount, 3);
+
+    /* Features */
+    shaper.shape("hello world", {{Feature::Kerning, false}});
+    CORRADE_COMPARE(wrapped.shapeCount, 4);
+    shaper.shape("hello world", {{Feature::Kerning, true}});
+    CORRADE_COMPARE(wrapped.shapeCount, 5);
+    shaper.shape("hello world", {{Feature::Kerning, 2, 5, false}});
+    CORRADE_COMPARE(wrapped.shapeCount, 6);
+
+    /* All of the above are cached now */
+    shaper.shape("hello world");
+    shaper.shape("hello world", 0, 5);
+    shaper.shape("hello world", 0, 11);
+    shaper.shape("hello world", {{Feature::Kerning, false}});
+    shaper.shape("hello world", {{Feature::Kerning, true}});
+    shaper.shape("hello world", {{Feature::Kerning, 2, 5, false}});
+    CORRADE_COMPARE(wrapped.shapeCount, 6);
+    CORRADE_COMPARE(shaper.hitCount(), 6);
+    CORRADE_COMPARE(shaper.missCount(), 6);
+    CORRADE_COMPARE(shaper.entryCount(), 6);
+}
+
+void CachingShaperTest::setScriptLanguageDirection() {
+    CountingShaper wrapped{FakeFont};
+    CachingShaper shaper{wrapped, 4096};
+
+    shaper.shape("hello");
+    CORRADE_COMPARE(shaper.script(), Script::Latin);
+    CORRADE_COMPARE(wrapped.shapeCount, 1);
+
+    /* Passed through to the wrapped shaper and becomes a part of the key */
+    CORRADE_VERIFY(shaper.setScript(Script::Greek));
+    shaper.shape("hello");
+    CORRADE_COMPARE(wrapped.shapeCount, 2);
+    CORRADE_COMPARE(shaper.script(), Script::Greek);
+
+    CORRADE_VERIFY(shaper.setLanguage("el"));
+    shaper.shape("hello");
+    CORRADE_COMPARE(wrapped.shapeCount, 3);
+    CORRADE_COMPARE(shaper.language(), "el"_s);
+
+    CORRADE_VERIFY(shaper.setDirection(ShapeDirection::RightToLeft));
+    shaper.shape("hello");
+    CORRADE_COMPARE(wrapped.shapeCount, 4);
+    CORRADE_COMPARE(shaper.direction(), ShapeDirection::RightToLeft);
+
+    /* Going back to the original values is served from the cache, including
+       the detected properties */
+    shaper.setScript(Script::Unspecified);
+    /* Passing the view returned from language() should work too */
+    shaper.shape("hello");
+    shaper.setLanguage(shaper.language());
+    CORRADE_COMPARE(wrapped.shapeCount, 5);
+    shaper.setLanguage({});
+    shaper.setDirection(ShapeDirection::Unspecified);
+    shaper.shape("hello");
+    CORRADE_COMPARE(wrapped.shapeCount, 5);
+    CORRADE_COMPARE(shaper.script(), Script::Latin);
+    CORRADE_COMPARE(shaper.language(), "en"_s);
+    CORRADE_COMPARE(shaper.direction(), ShapeDirection::LeftToRight);
+}
+
+void CachingShaperTest::evict() {
+    /* Figure out how much a single entry takes */
+    std::size_t entrySize;
+    {
+        CountingShaper wrapped{FakeFont};
+        CachingShaper shaper{wrapped, 4096};
+        shaper.shape("aaaa");
+        entrySize = shaper.memoryUsage();
+    }
+    CORRADE_VERIFY(entrySize > 0);
+
+    /* The limit fits exactly three entries of the same size */
+    CountingShaper wrapped{FakeFont};
+    CachingShaper shaper{wrapped, entrySize*3};
+    shaper.shape("aaaa");
+    shaper.shape("bbbb");
+    shaper.shape("cccc");
+    CORRADE_COMPARE(shaper.entryCount(), 3);
+    CORRADE_COMPARE(shaper.memoryUsage(), entrySize*3);
+    CORRADE_COMPARE(wrapped.shapeCount, 3);
+
+    /* Make the first one most recently used */
+    shaper.shape("aaaa");
+    CORRADE_COMPARE(wrapped.shapeCount, 3);
+
+    /* Adding a fourth goes over the limit, evicting least recently used ones
+       until at three quarters of the limit, i.e. the second and third */
+    shaper.shape("dddd");
+    CORRADE_COMPARE(wrapped.shapeCount, 4);
+    CORRADE_COMPARE(shaper.entryCount(), 2);
+    CORRADE_COMPARE(shaper.memoryUsage(), entrySize*2);
+
+    /* The last shaped data are still there */
+    UnsignedInt ids[4];
+    shaper.glyphIdsInto(ids);
+    CORRADE_COMPARE_AS(Containers::arrayView(ids), Containers::arrayView<UnsignedInt>({
+        'd', 'd', 'd', 'd'
+    }), TestSuite::Compare::Container);
+
+    shaper.shape("aaaa");
+    shaper.shape("dddd");
+    CORRADE_COMPARE(wrapped.shapeCount, 4);
+    shaper.shape("bbbb");
+    CORRADE_COMPARE(wrapped.shapeCount, 5);
+}
+
+void CachingShaperTest::evictLargerThanLimit() {
+    CountingShaper wrapped{FakeFont};
+    CachingShaper shaper{wrapped, 1};
+
+    shaper.shape("hello");
+    CORRADE_COMPARE(shaper.entryCount(), 1);
+
+    /* The new entry is kept, the previous one evicted */
+    shaper.shape("world");
+    CORRADE_COMPARE(shaper.entryCount(), 1);
+    CORRADE_COMPARE(wrapped.shapeCount, 2);
+    CORRADE_COMPARE(shaper.glyphCount(), 5);
+
+    UnsignedInt ids[5];
+    shaper.glyphIdsInto(ids);
+    CORRADE_COMPARE_AS(Containers::arrayView(ids), Containers::arrayView<UnsignedInt>({
+        'w', 'o', 'r', 'l', 'd'
+    }), TestSuite::Compare::Container);
+
+    shaper.shape("world");
+    CORRADE_COMPARE(wrapped.shapeCount, 2);
+    shaper.shape("hello");
+    CORRADE_COMPARE(wrapped.shapeCount, 3);
+}
+
+void CachingShaperTest::clear() {
+    CountingShaper wrapped{FakeFont};
+    CachingShaper shaper{wrapped, 4096};
+
+    shaper.shape("hello");
+    shaper.shape("world");
+    shaper.shape("hello");
+    CORRADE_COMPARE(shaper.entryCount(), 2);
+    CORRADE_COMPARE(shaper.hitCount(), 1);
+
+    shaper.clear();
+    CORRADE_COMPARE(shaper.entryCount(), 0);
+    CORRADE_COMPARE(shaper.memoryUsage(), 0);
+    CORRADE_COMPARE(shaper.hitCount(), 0);
+    CORRADE_COMPARE(shaper.missCount(), 0);
+
+    /* Data from the last shape() call are still retrievable */
+    CORRADE_COMPARE(shaper.glyphCount(), 5);
+    CORRADE_COMPARE(shaper.language(), "en"_s);
+    UnsignedInt ids[5];
+    shaper.glyphIdsInto(ids);
+    CORRADE_COMPARE_AS(Containers::arrayView(ids), Containers::arrayView<UnsignedInt>({
+        'h', 'e', 'l', 'l', 'o'
+    }), TestSuite::Compare::Container);
+
+    shaper.shape("hello");
+    CORRADE_COMPARE(wrapped.shapeCount, 3);
+    CORRADE_COMPARE(shaper.missCount(), 1);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::CachingShaperTest)
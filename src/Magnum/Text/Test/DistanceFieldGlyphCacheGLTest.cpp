@@ -63,6 +63,7 @@ struct DistanceFieldGlyphCacheGLTest: GL::OpenGLTester {
     void constructMove();
 
     void setImage();
+    void setImageGlyphRectangles();
 
     void setProcessedImage();
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -123,6 +124,8 @@ DistanceFieldGlyphCacheGLTest::DistanceFieldGlyphCacheGLTest() {
     addInstancedTests({&DistanceFieldGlyphCacheGLTest::setImage},
         Containers::arraySize(SetImageData));
 
+    addTests({&DistanceFieldGlyphCacheGLTest::setImageGlyphRectangles});
+
     #ifndef MAGNUM_BUILD_DEPRECATED
     addTests({&DistanceFieldGlyphCacheGLTest::setProcessedImage});
     #else
@@ -279,6 +282,87 @@ void DistanceFieldGlyphCacheGLTest::setImage() {
         (DebugTools::CompareImageToFile{_manager, 1.0f, 0.178f}));
 }
 
+void DistanceFieldGlyphCacheGLTest::setImageGlyphRectangles() {
+    DistanceFieldGlyphCacheGL cache({128, 64}, {32, 16}, 4);
+    CORRADE_COMPARE(cache.padding(), Vector2i{4});
+
+    #ifdef MAGNUM_TARGET_GLES2
+    /* Same as in setProcessedImage() */
+    if(cache.processedFormat() == PixelFormat::RGBA8Unorm)
+        CORRADE_SKIP("A four-component input is expected on ES2, skipping due to developer laziness.");
+    #endif
+
+    /* Fill the processed image with a marker value to see which parts got
+       overwritten. The input image is all zeros, resulting in the distance
+       field being all zeros as well. */
+    UnsignedByte marker[32*16];
+    for(UnsignedByte& i: marker) i = 0x33;
+    cache.setProcessedImage({}, ImageView2D{PixelFormat::R8Unorm, {32, 16}, marker});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* The padded glyph rectangle is {4, 4} to {20, 20}, i.e. {1, 1} to
+       {5, 5} in the processed image. Flushing the whole image should process
+       just that. */
+    cache.addFont(1);
+    cache.addGlyph(0, 0, {}, {{8, 8}, {16, 16}});
+    cache.flushImage({{}, {128, 64}});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Same as in setProcessedImage() */
+    #ifndef MAGNUM_TARGET_GLES
+    Image3D actual3 = cache.processedImage();
+    /** @todo ugh have slicing on images directly already */
+    MutableImageView2D actual{actual3.format(), actual3.size().xy(), actual3.data()};
+    #elif !defined(MAGNUM_TARGET_GLES2)
+    Image2D actual = DebugTools::textureSubImage(cache.texture(), 0, {{}, {32, 16}}, cache.processedFormat());
+    #else
+    Image2D actualGLFormat = DebugTools::textureSubImage(cache.texture(), 0, {{}, {32, 16}},
+        #ifndef MAGNUM_TARGET_WEBGL
+        cache.processedFormat() == PixelFormat::R8Unorm ?
+            Image2D{GL::PixelFormat::Red, GL::PixelType::UnsignedByte} :
+        #endif
+            Image2D{cache.processedFormat()}
+    );
+    ImageView2D actual{actualGLFormat.storage(), PixelFormat::R8Unorm, actualGLFormat.size(), actualGLFormat.data()};
+    #endif
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    UnsignedByte expected[32*16];
+    for(UnsignedByte& i: expected) i = 0x33;
+    for(std::size_t y = 1; y != 5; ++y)
+        for(std::size_t x = 1; x != 5; ++x)
+            expected[y*32 + x] = 0;
+    CORRADE_COMPARE_AS(actual,
+        (ImageView2D{PixelFormat::R8Unorm, {32, 16}, expected}),
+        DebugTools::CompareImage);
+
+    /* Flushing again without any new glyphs processes the whole range */
+    cache.flushImage({{}, {128, 64}});
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    #ifndef MAGNUM_TARGET_GLES
+    actual3 = cache.processedImage();
+    actual = MutableImageView2D{actual3.format(), actual3.size().xy(), actual3.data()};
+    #elif !defined(MAGNUM_TARGET_GLES2)
+    actual = DebugTools::textureSubImage(cache.texture(), 0, {{}, {32, 16}}, cache.processedFormat());
+    #else
+    actualGLFormat = DebugTools::textureSubImage(cache.texture(), 0, {{}, {32, 16}},
+        #ifndef MAGNUM_TARGET_WEBGL
+        cache.processedFormat() == PixelFormat::R8Unorm ?
+            Image2D{GL::PixelFormat::Red, GL::PixelType::UnsignedByte} :
+        #endif
+            Image2D{cache.processedFormat()}
+    );
+    actual = ImageView2D{actualGLFormat.storage(), PixelFormat::R8Unorm, actualGLFormat.size(), actualGLFormat.data()};
+    #endif
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    UnsignedByte zeros[32*16]{};
+    CORRADE_COMPARE_AS(actual,
+        (ImageView2D{PixelFormat::R8Unorm, {32, 16}, zeros}),
+        DebugTools::CompareImage);
+}
+
 void DistanceFieldGlyphCacheGLTest::setProcessedImage() {
     #ifdef MAGNUM_BUILD_DEPRECATED
     auto&& data = SetProcessedImageData[testCaseInstanceId()];
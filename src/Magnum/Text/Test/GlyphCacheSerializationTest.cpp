@@ -0,0 +1,411 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StringStl.h> /**< @todo drop once Debug is stream-free */
+#include <Corrade/Containers/Triple.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/DebugStl.h> /**< @todo drop once Debug is stream-free */
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/AbstractGlyphCache.h"
+#include "Magnum/Text/GlyphCacheSerialization.h"
+#include "Magnum/TextureTools/Atlas.h"
+
+namespace Magnum { namespace Text { namespace Test { namespace {
+
+struct GlyphCacheSerializationTest: TestSuite::Tester {
+    explicit GlyphCacheSerializationTest();
+
+    void roundTrip();
+    void roundTripArray();
+    void roundTripEvicted();
+    void roundTripInvalidGlyph();
+    void roundTripProcessed();
+
+    void serializeNoProcessedImageDownload();
+
+    void deserializeNotEmpty();
+    void deserializeInvalid();
+    void deserializeCacheMismatch();
+    void deserializeFontMismatch();
+};
+
+const struct {
+    const char* name;
+    std::size_t size;
+    std::size_t offset;
+    char value;
+    const char* message;
+} DeserializeInvalidData[]{
+    {"too short", 67, 0, 0,
+        "data too short, expected at least 68 bytes but got 67\n"},
+    {"invalid signature", ~std::size_t{}, 3, 'X',
+        "invalid file signature\n"},
+    {"unsupported version", ~std::size_t{}, 8, 2,
+        "unsupported version 2\n"},
+    {"size mismatch", 300, 0, 0,
+        "expected 312 bytes for 1 fonts and 3 glyphs but got 300\n"},
+    /* Font ID of the second glyph */
+    {"font out of range", ~std::size_t{}, 68 + 8 + 36*2, 1,
+        "invalid font glyph 1 3 for glyph 2\n"},
+    /* Font glyph ID of the second glyph */
+    {"font glyph out of range", ~std::size_t{}, 68 + 8 + 36*2 + 4, 5,
+        "invalid font glyph 0 5 for glyph 2\n"},
+    {"duplicate font glyph", ~std::size_t{}, 68 + 8 + 36*2 + 4, 1,
+        "invalid font glyph 0 1 for glyph 2\n"},
+    /* Layer of the second glyph */
+    {"layer out of range", ~std::size_t{}, 68 + 8 + 36*2 + 16, 1,
+        "glyph 2 layer 1 and rectangle {{0, 0}, {4, 6}} out of range for size {16, 8, 1}\n"},
+    /* Max X of the second glyph rectangle */
+    {"rectangle out of range", ~std::size_t{}, 68 + 8 + 36*2 + 28, 17,
+        "glyph 2 layer 0 and rectangle {{0, 0}, {17, 6}} out of range for size {16, 8, 1}\n"},
+};
+
+GlyphCacheSerializationTest::GlyphCacheSerializationTest() {
+    addTests({&GlyphCacheSerializationTest::roundTrip,
+              &GlyphCacheSerializationTest::roundTripArray,
+              &GlyphCacheSerializationTest::roundTripEvicted,
+              &GlyphCacheSerializationTest::roundTripInvalidGlyph,
+              &GlyphCacheSerializationTest::roundTripProcessed,
+
+              &GlyphCacheSerializationTest::serializeNoProcessedImageDownload,
+
+              &GlyphCacheSerializationTest::deserializeNotEmpty});
+
+    addInstancedTests({&GlyphCacheSerializationTest::deserializeInvalid},
+        Containers::arraySize(DeserializeInvalidData));
+
+    addTests({&GlyphCacheSerializationTest::deserializeCacheMismatch,
+              &GlyphCacheSerializationTest::deserializeFontMismatch});
+}
+
+struct DummyGlyphCache: AbstractGlyphCache {
+    using AbstractGlyphCache::AbstractGlyphCache;
+
+    GlyphCacheFeatures doFeatures() const override { return {}; }
+    void doSetImage(const Vector3i& offset, const ImageView3D& image) override {
+        flushed = {offset, offset + image.size()};
+    }
+
+    Range3Di flushed;
+};
+
+struct DummyProcessingGlyphCache: AbstractGlyphCache {
+    explicit DummyProcessingGlyphCache(GlyphCacheFeatures features, PixelFormat format, const Vector2i& size, PixelFormat processedFormat, const Vector2i& processedSize): AbstractGlyphCache{format, size, processedFormat, processedSize}, features{features}, processed{processedFormat, {processedSize, 1}, Containers::Array<char>{ValueInit, std::size_t(4*((processedSize.x()*pixelFormatSize(processedFormat) + 3)/4)*processedSize.y())}} {}
+
+    GlyphCacheFeatures doFeatures() const override { return features; }
+    void doSetImage(const Vector3i& offset, const ImageView3D& image) override {
+        flushed = {offset, offset + image.size()};
+    }
+    Image3D doProcessedImage() override {
+        Image3D out{processed.format(), processed.size(), Containers::Array<char>{NoInit, processed.data().size()}};
+        Utility::copy(processed.data(), out.mutableData());
+        return out;
+    }
+    void doSetProcessedImage(const Vector3i& offset, const ImageView3D& image) override {
+        CORRADE_COMPARE(offset, Vector3i{});
+        for(std::size_t y = 0; y != std::size_t(image.size().y()); ++y)
+            for(std::size_t x = 0; x != std::size_t(image.size().x()); ++x)
+                processed.pixels<UnsignedByte>()[0][y][x] = image.pixels<UnsignedByte>()[0][y][x];
+    }
+
+    GlyphCacheFeatures features;
+    Image3D processed;
+    Range3Di flushed;
+};
+
+struct DummyFont: AbstractFont {
+    explicit DummyFont(UnsignedInt glyphCount, Float size): _glyphCount{glyphCount} {
+        openData(nullptr, size);
+    }
+
+    FontFeatures doFeatures() const override { return FontFeature::OpenData; }
+    bool doIsOpened() const override { return _opened; }
+    void doClose() override { _opened = false; }
+
+    Properties doOpenData(Containers::ArrayView<const char>, Float size) override {
+        _opened = true;
+        return {size, 1.0f, 2.0f, 3.0f, _glyphCount};
+    }
+
+    void doGlyphIdsInto(const Containers::StridedArrayView1D<const char32_t>&, const Containers::StridedArrayView1D<UnsignedInt>&) override {}
+    Vector2 doGlyphSize(UnsignedInt) override { return {}; }
+    Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+    Containers::Pointer<AbstractShaper> doCreateShaper() override { return {}; }
+
+    private:
+        UnsignedInt _glyphCount;
+        bool _opened = false;
+};
+
+/* A cache with one font of 4 glyphs, two of them added. Serialized size is
+   68 bytes of the header, 8 bytes for the font, 3*36 bytes for the glyphs
+   including the invalid one and then the image. Glyphs are saved ordered by
+   the font glyph ID, so font glyph 3 is the third saved glyph. */
+void fillCache(AbstractGlyphCache& cache, const AbstractFont* font) {
+    UnsignedInt fontId = cache.addFont(4, font);
+    cache.addGlyph(fontId, 3, {1, 2}, {{1, 1}, {3, 5}});
+    cache.addGlyph(fontId, 1, {-1, 0}, {{5, 1}, {7, 3}});
+    for(std::size_t y = 0; y != std::size_t(cache.size().y()); ++y)
+        for(std::size_t x = 0; x != std::size_t(cache.size().x()); ++x)
+            cache.image().pixels<UnsignedByte>()[0][y][x] = y*8 + x;
+}
+
+void GlyphCacheSerializationTest::roundTrip() {
+    DummyFont font{4, 12.0f};
+
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {16, 16}};
+    fillCache(cache, &font);
+
+    Containers::Optional<Containers::Array<char>> data = serializeGlyphCache(cache);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->size(), 68 + 8 + 3*36 + 16*16);
+
+    DummyGlyphCache out{PixelFormat::R8Unorm, {16, 16}};
+    CORRADE_VERIFY(deserializeGlyphCacheInto(out, *data, {&font}));
+    CORRADE_COMPARE(out.fontCount(), 1);
+    CORRADE_COMPARE(out.fontGlyphCount(0), 4);
+    CORRADE_COMPARE(out.fontPointer(0), &font);
+    CORRADE_COMPARE(out.glyphCount(), 3);
+    CORRADE_COMPARE(out.glyphId(0, 0), 0);
+    CORRADE_COMPARE(out.glyphId(0, 2), 0);
+    CORRADE_COMPARE(out.glyph(0, 3), cache.glyph(0, 3));
+    CORRADE_COMPARE(out.glyph(0, 1), cache.glyph(0, 1));
+    CORRADE_COMPARE(out.glyph(0), cache.glyph(0));
+    CORRADE_COMPARE_AS(out.image().data(),
+        cache.image().data(),
+        TestSuite::Compare::Container);
+
+    /* The whole image got uploaded */
+    CORRADE_COMPARE(out.flushed, (Range3Di{{}, {16, 16, 1}}));
+
+    /* The atlas has everything up to the topmost glyph including padding
+       reserved, so a next glyph gets placed above it */
+    CORRADE_COMPARE(out.atlas().filledSize(), (Vector3i{16, 6, 1}));
+    Vector2i offset[1];
+    CORRADE_VERIFY(out.atlas().add({{2, 2}}, offset));
+    CORRADE_COMPARE(offset[0], (Vector2i{1, 7}));
+}
+
+void GlyphCacheSerializationTest::roundTripArray() {
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {16, 8, 3}, {}};
+    UnsignedInt fontId = cache.addFont(2);
+    cache.addGlyph(fontId, 0, {}, 0, {{0, 0}, {16, 8}});
+    cache.addGlyph(fontId, 1, {}, 1, {{0, 0}, {4, 3}});
+
+    Containers::Optional<Containers::Array<char>> data = serializeGlyphCache(cache);
+    CORRADE_VERIFY(data);
+
+    DummyGlyphCache out{PixelFormat::R8Unorm, {16, 8, 3}, {}};
+    CORRADE_VERIFY(deserializeGlyphCacheInto(out, *data, {nullptr}));
+    CORRADE_COMPARE(out.glyph(0, 0), cache.glyph(0, 0));
+    CORRADE_COMPARE(out.glyph(0, 1), cache.glyph(0, 1));
+
+    /* The first layer is reserved completely, the second up to the topmost
+       glyph */
+    CORRADE_COMPARE(out.atlas().filledSize(), (Vector3i{16, 8, 2}));
+    Vector3i offset[1];
+    CORRADE_VERIFY(out.atlas().add({{16, 5}}, offset));
+    CORRADE_COMPARE(offset[0], (Vector3i{0, 3, 1}));
+}
+
+void GlyphCacheSerializationTest::roundTripEvicted() {
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {16, 8}};
+    fillCache(cache, nullptr);
+    /* Font glyph 3 is used, font glyph 1 gets evicted */
+    cache.markGlyphsUsed({1});
+    CORRADE_COMPARE(cache.evictGlyphs(1), 1);
+
+    /* The evicted glyph isn't saved */
+    Containers::Optional<Containers::Array<char>> data = serializeGlyphCache(cache);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->size(), 68 + 8 + 2*36 + 16*8);
+
+    DummyGlyphCache out{PixelFormat::R8Unorm, {16, 8}};
+    CORRADE_VERIFY(deserializeGlyphCacheInto(out, *data, {nullptr}));
+    CORRADE_COMPARE(out.glyphCount(), 2);
+    CORRADE_COMPARE(out.glyphId(0, 1), 0);
+    CORRADE_COMPARE(out.glyph(0, 3), cache.glyph(0, 3));
+}
+
+void GlyphCacheSerializationTest::roundTripInvalidGlyph() {
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {16, 8}};
+    fillCache(cache, nullptr);
+    cache.setInvalidGlyph({3, 4}, {{9, 1}, {11, 3}});
+
+    Containers::Optional<Containers::Array<char>> data = serializeGlyphCache(cache);
+    CORRADE_VERIFY(data);
+
+    DummyGlyphCache out{PixelFormat::R8Unorm, {16, 8}};
+    CORRADE_VERIFY(deserializeGlyphCacheInto(out, *data, {nullptr}));
+    CORRADE_COMPARE(out.glyph(0), cache.glyph(0));
+}
+
+void GlyphCacheSerializationTest::roundTripProcessed() {
+    DummyProcessingGlyphCache cache{GlyphCacheFeature::ImageProcessing|GlyphCacheFeature::ProcessedImageDownload, PixelFormat::R8Unorm, {16, 8}, PixelFormat::R8Unorm, {4, 2}};
+    fillCache(cache, nullptr);
+    for(std::size_t i = 0; i != 8; ++i)
+        cache.processed.pixels<UnsignedByte>()[0][i/4][i%4] = 0xa0 + i;
+
+    Containers::Optional<Containers::Array<char>> data = serializeGlyphCache(cache);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->size(), 68 + 8 + 3*36 + 16*8 + 4*2);
+
+    DummyProcessingGlyphCache out{GlyphCacheFeature::ImageProcessing, PixelFormat::R8Unorm, {16, 8}, PixelFormat::R8Unorm, {4, 2}};
+    CORRADE_VERIFY(deserializeGlyphCacheInto(out, *data, {nullptr}));
+    CORRADE_COMPARE_AS(out.image().data(),
+        cache.image().data(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.processed.data(),
+        cache.processed.data(),
+        TestSuite::Compare::Container);
+
+    /* The source image isn't processed again */
+    CORRADE_COMPARE(out.flushed, Range3Di{});
+}
+
+void GlyphCacheSerializationTest::serializeNoProcessedImageDownload() {
+    DummyProcessingGlyphCache cache{GlyphCacheFeature::ImageProcessing, PixelFormat::R8Unorm, {16, 8}, PixelFormat::R8Unorm, {4, 2}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!serializeGlyphCache(cache));
+    CORRADE_COMPARE(out.str(), "Text::serializeGlyphCache(): glyph cache has image processing but doesn't support image download\n");
+}
+
+void GlyphCacheSerializationTest::deserializeNotEmpty() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {16, 8}};
+    cache.addFont(3);
+    cache.addFont(4);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    deserializeGlyphCacheInto(cache, nullptr, {});
+    CORRADE_COMPARE(out.str(), "Text::deserializeGlyphCacheInto(): expected an empty cache but it has 2 fonts\n");
+}
+
+void GlyphCacheSerializationTest::deserializeInvalid() {
+    auto&& data = DeserializeInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {16, 8}};
+    fillCache(cache, nullptr);
+    Containers::Optional<Containers::Array<char>> serialized = serializeGlyphCache(cache);
+    CORRADE_VERIFY(serialized);
+    if(data.offset || data.value)
+        (*serialized)[data.offset] = data.value;
+
+    DummyGlyphCache out{PixelFormat::R8Unorm, {16, 8}};
+
+    std::ostringstream outString;
+    Error redirectError{&outString};
+    CORRADE_VERIFY(!deserializeGlyphCacheInto(out, serialized->prefix(Math::min(data.size, serialized->size())), {nullptr}));
+    CORRADE_COMPARE(outString.str(), Utility::formatString("Text::deserializeGlyphCacheInto(): {}", data.message));
+
+    /* The cache is left untouched */
+    CORRADE_COMPARE(out.fontCount(), 0);
+    CORRADE_COMPARE(out.glyphCount(), 1);
+}
+
+void GlyphCacheSerializationTest::deserializeCacheMismatch() {
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {16, 8}};
+    Containers::Optional<Containers::Array<char>> data = serializeGlyphCache(cache);
+    CORRADE_VERIFY(data);
+
+    DummyProcessingGlyphCache processingCache{GlyphCacheFeature::ImageProcessing|GlyphCacheFeature::ProcessedImageDownload, PixelFormat::R8Unorm, {16, 8}, PixelFormat::R8Unorm, {4, 2}};
+    Containers::Optional<Containers::Array<char>> processingData = serializeGlyphCache(processingCache);
+    CORRADE_VERIFY(processingData);
+
+    DummyGlyphCache differentFormat{PixelFormat::R8Srgb, {16, 8}};
+    DummyGlyphCache differentSize{PixelFormat::R8Unorm, {16, 8, 2}};
+    DummyGlyphCache differentPadding{PixelFormat::R8Unorm, {16, 8}, {2, 1}};
+    DummyProcessingGlyphCache differentProcessedSize{GlyphCacheFeature::ImageProcessing, PixelFormat::R8Unorm, {16, 8}, PixelFormat::R8Unorm, {4, 4}};
+    DummyProcessingGlyphCache processing{GlyphCacheFeature::ImageProcessing, PixelFormat::R8Unorm, {16, 8}, PixelFormat::R8Unorm, {16, 8}};
+    DummyGlyphCache notProcessing{PixelFormat::R8Unorm, {16, 8}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!deserializeGlyphCacheInto(differentFormat, *data, {}));
+    CORRADE_VERIFY(!deserializeGlyphCacheInto(differentSize, *data, {}));
+    CORRADE_VERIFY(!deserializeGlyphCacheInto(differentPadding, *data, {}));
+    CORRADE_VERIFY(!deserializeGlyphCacheInto(differentProcessedSize, *processingData, {}));
+    CORRADE_VERIFY(!deserializeGlyphCacheInto(processing, *data, {}));
+    CORRADE_VERIFY(!deserializeGlyphCacheInto(notProcessing, *processingData, {}));
+    CORRADE_COMPARE_AS(out.str(),
+        "Text::deserializeGlyphCacheInto(): expected a PixelFormat::R8Unorm cache of size {16, 8, 1} and padding {1, 1} but got PixelFormat::R8Srgb, {16, 8, 1} and {1, 1}\n"
+        "Text::deserializeGlyphCacheInto(): expected a PixelFormat::R8Unorm cache of size {16, 8, 1} and padding {1, 1} but got PixelFormat::R8Unorm, {16, 8, 2} and {1, 1}\n"
+        "Text::deserializeGlyphCacheInto(): expected a PixelFormat::R8Unorm cache of size {16, 8, 1} and padding {1, 1} but got PixelFormat::R8Unorm, {16, 8, 1} and {2, 1}\n"
+        "Text::deserializeGlyphCacheInto(): expected a processed PixelFormat::R8Unorm image of size {4, 2, 1} but got PixelFormat::R8Unorm and {4, 4, 1}\n"
+        "Text::deserializeGlyphCacheInto(): serialized cache doesn't have a processed image but the cache has image processing\n"
+        "Text::deserializeGlyphCacheInto(): serialized cache has a processed image but the cache doesn't have image processing\n",
+        TestSuite::Compare::String);
+}
+
+void GlyphCacheSerializationTest::deserializeFontMismatch() {
+    DummyFont font{4, 12.0f};
+    DummyFont differentGlyphCount{5, 12.0f};
+    DummyFont differentSize{4, 16.0f};
+
+    DummyGlyphCache cache{PixelFormat::R8Unorm, {16, 8}};
+    fillCache(cache, &font);
+    Containers::Optional<Containers::Array<char>> data = serializeGlyphCache(cache);
+    CORRADE_VERIFY(data);
+
+    DummyGlyphCache out{PixelFormat::R8Unorm, {16, 8}};
+
+    std::ostringstream outString;
+    Error redirectError{&outString};
+    CORRADE_VERIFY(!deserializeGlyphCacheInto(out, *data, {}));
+    CORRADE_VERIFY(!deserializeGlyphCacheInto(out, *data, {&font, &font}));
+    CORRADE_VERIFY(!deserializeGlyphCacheInto(out, *data, {&differentGlyphCount}));
+    CORRADE_VERIFY(!deserializeGlyphCacheInto(out, *data, {&differentSize}));
+    CORRADE_COMPARE_AS(outString.str(),
+        "Text::deserializeGlyphCacheInto(): expected 1 fonts but got 0\n"
+        "Text::deserializeGlyphCacheInto(): expected 1 fonts but got 2\n"
+        "Text::deserializeGlyphCacheInto(): expected font 0 to have 4 glyphs and size 12 but got 5 and 12\n"
+        "Text::deserializeGlyphCacheInto(): expected font 0 to have 4 glyphs and size 12 but got 4 and 16\n",
+        TestSuite::Compare::String);
+
+    /* Null fonts aren't checked */
+    CORRADE_VERIFY(deserializeGlyphCacheInto(out, *data, {nullptr}));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::GlyphCacheSerializationTest)
@@ -35,6 +35,7 @@
 #include "Magnum/GL/Context.h"
 #include "Magnum/GL/Extensions.h"
 #include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/Math/Color.h"
 #include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Text/AbstractShaper.h"
 #include "Magnum/Text/GlyphCacheGL.h"
@@ -48,12 +49,18 @@ struct RendererGLTest: GL::OpenGLTester {
     void renderMesh();
     void renderMeshIndexType();
     void mutableText();
+
+    void batchRenderer();
+    void batchRendererInvalid();
 };
 
 RendererGLTest::RendererGLTest() {
     addTests({&RendererGLTest::renderMesh,
               &RendererGLTest::renderMeshIndexType,
-              &RendererGLTest::mutableText});
+              &RendererGLTest::mutableText,
+
+              &RendererGLTest::batchRenderer,
+              &RendererGLTest::batchRendererInvalid});
 }
 
 struct TestShaper: AbstractShaper {
@@ -303,6 +310,205 @@ void RendererGLTest::mutableText() {
     #endif
 }
 
+void RendererGLTest::batchRenderer() {
+    TestFont font;
+    font.openFile({}, 0.5f);
+    GlyphCacheGL cache = testGlyphCache(font);
+    BatchRenderer2D renderer{font, cache, 0.25f, Alignment::MiddleCenter};
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.fontSize(), 0.25f);
+    CORRADE_COMPARE(renderer.capacity(), 0);
+    CORRADE_COMPARE(renderer.glyphCount(), 0);
+    CORRADE_COMPARE(renderer.stringCount(), 0);
+
+    renderer.reserve(8, GL::BufferUsage::DynamicDraw, GL::BufferUsage::StaticDraw);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.capacity(), 8);
+    CORRADE_COMPARE(renderer.glyphCount(), 0);
+
+    /* The strings should be laid out the same as with the regular renderer,
+       just with the offset applied */
+    std::vector<Vector2> abcPositions, abcTextureCoordinates, abPositions, abTextureCoordinates;
+    Range2D abcRectangle, abRectangle;
+    std::tie(abcPositions, abcTextureCoordinates, std::ignore, abcRectangle) = AbstractRenderer::render(font, cache, 0.25f, "abc", Alignment::MiddleCenter);
+    std::tie(abPositions, abTextureCoordinates, std::ignore, abRectangle) = AbstractRenderer::render(font, cache, 0.25f, "ab", Alignment::MiddleCenter);
+    CORRADE_COMPARE(abcPositions.size(), 3*4);
+    CORRADE_COMPARE(abPositions.size(), 2*4);
+
+    /* The second string has space for two more glyphs */
+    CORRADE_COMPARE(renderer.add("abc", {10.0f, 20.0f}, 0xff3366ff_rgbaf), 0);
+    CORRADE_COMPARE(renderer.add("ab", {-5.0f, 0.0f}, 0x3366ff99_rgbaf, 4), 1);
+    CORRADE_COMPARE(renderer.glyphCount(), 7);
+    CORRADE_COMPARE(renderer.stringCount(), 2);
+    CORRADE_COMPARE(renderer.offset(0), (Vector2{10.0f, 20.0f}));
+    CORRADE_COMPARE(renderer.offset(1), (Vector2{-5.0f, 0.0f}));
+    CORRADE_COMPARE(renderer.color(0), 0xff3366ff_rgbaf);
+    CORRADE_COMPARE(renderer.color(1), 0x3366ff99_rgbaf);
+    CORRADE_COMPARE(renderer.rectangle(0), abcRectangle.translated({10.0f, 20.0f}));
+    CORRADE_COMPARE(renderer.rectangle(1), abRectangle.translated({-5.0f, 0.0f}));
+
+    /* Nothing is drawn until the data get uploaded */
+    CORRADE_COMPARE(renderer.mesh().count(), 0);
+    renderer.update();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.mesh().count(), 7*6);
+
+    struct Vertex {
+        Vector2 position, textureCoordinates;
+        Color4 color;
+    };
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    {
+        Containers::Array<char> indices = renderer.indexBuffer().data();
+        CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(indices).prefix(18),
+            Containers::arrayView<UnsignedByte>({
+                0,  1,  2,  2,  1,  3,
+                4,  5,  6,  6,  5,  7,
+                8,  9, 10, 10,  9, 11,
+            }), TestSuite::Compare::Container);
+        CORRADE_COMPARE(indices.size(), 8*6);
+
+        Containers::Array<char> data = renderer.vertexBuffer().data();
+        Containers::StridedArrayView1D<const Vertex> vertices = Containers::arrayCast<const Vertex>(data);
+        CORRADE_COMPARE(vertices.size(), 8*4);
+
+        Containers::Array<Vector2> expectedPositions{ValueInit, 7*4};
+        Containers::Array<Vector2> expectedTextureCoordinates{ValueInit, 7*4};
+        Containers::Array<Color4> expectedColors{ValueInit, 7*4};
+        for(std::size_t i = 0; i != 3*4; ++i) {
+            expectedPositions[i] = abcPositions[i] + Vector2{10.0f, 20.0f};
+            expectedTextureCoordinates[i] = abcTextureCoordinates[i];
+            expectedColors[i] = 0xff3366ff_rgbaf;
+        }
+        /* The unused glyphs are degenerate, at the string offset */
+        for(std::size_t i = 0; i != 4*4; ++i) {
+            expectedPositions[3*4 + i] = (i < 2*4 ? abPositions[i] : Vector2{}) + Vector2{-5.0f, 0.0f};
+            expectedTextureCoordinates[3*4 + i] = i < 2*4 ? abTextureCoordinates[i] : Vector2{};
+            expectedColors[3*4 + i] = 0x3366ff99_rgbaf;
+        }
+        CORRADE_COMPARE_AS(vertices.slice(&Vertex::position).prefix(7*4),
+            Containers::arrayView(expectedPositions),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(vertices.slice(&Vertex::textureCoordinates).prefix(7*4),
+            Containers::arrayView(expectedTextureCoordinates),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(vertices.slice(&Vertex::color).prefix(7*4),
+            Containers::arrayView(expectedColors),
+            TestSuite::Compare::Container);
+    }
+    #endif
+
+    /* Change text of the second string to fill the whole capacity, move and
+       recolor the first */
+    renderer.setText(1, "abca")
+        .setOffset(0, {0.0f, -1.0f})
+        .setColor(0, 0x00ff00ff_rgbaf);
+    CORRADE_COMPARE(renderer.offset(0), (Vector2{0.0f, -1.0f}));
+    CORRADE_COMPARE(renderer.color(0), 0x00ff00ff_rgbaf);
+    CORRADE_COMPARE(renderer.rectangle(0), abcRectangle.translated({0.0f, -1.0f}));
+
+    std::vector<Vector2> abcaPositions, abcaTextureCoordinates;
+    Range2D abcaRectangle;
+    std::tie(abcaPositions, abcaTextureCoordinates, std::ignore, abcaRectangle) = AbstractRenderer::render(font, cache, 0.25f, "abca", Alignment::MiddleCenter);
+    CORRADE_COMPARE(renderer.rectangle(1), abcaRectangle.translated({-5.0f, 0.0f}));
+
+    renderer.update();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.mesh().count(), 7*6);
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    {
+        Containers::Array<char> data = renderer.vertexBuffer().data();
+        Containers::StridedArrayView1D<const Vertex> vertices = Containers::arrayCast<const Vertex>(data);
+
+        Containers::Array<Vector2> expectedPositions{NoInit, 7*4};
+        Containers::Array<Color4> expectedColors{NoInit, 7*4};
+        for(std::size_t i = 0; i != 3*4; ++i) {
+            expectedPositions[i] = abcPositions[i] + Vector2{0.0f, -1.0f};
+            expectedColors[i] = 0x00ff00ff_rgbaf;
+        }
+        for(std::size_t i = 0; i != 4*4; ++i) {
+            expectedPositions[3*4 + i] = abcaPositions[i] + Vector2{-5.0f, 0.0f};
+            expectedColors[3*4 + i] = 0x3366ff99_rgbaf;
+        }
+        CORRADE_COMPARE_AS(vertices.slice(&Vertex::position).prefix(7*4),
+            Containers::arrayView(expectedPositions),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(vertices.slice(&Vertex::textureCoordinates).slice(3*4, 7*4),
+            Containers::arrayView(abcaTextureCoordinates),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(vertices.slice(&Vertex::color).prefix(7*4),
+            Containers::arrayView(expectedColors),
+            TestSuite::Compare::Container);
+    }
+    #endif
+
+    /* Growing the capacity preserves the strings */
+    renderer.reserve(16, GL::BufferUsage::DynamicDraw, GL::BufferUsage::StaticDraw);
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(renderer.capacity(), 16);
+    CORRADE_COMPARE(renderer.glyphCount(), 7);
+    CORRADE_COMPARE(renderer.stringCount(), 2);
+    renderer.update();
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    {
+        Containers::Array<char> data = renderer.vertexBuffer().data();
+        Containers::StridedArrayView1D<const Vertex> vertices = Containers::arrayCast<const Vertex>(data);
+        CORRADE_COMPARE(vertices.size(), 16*4);
+        CORRADE_COMPARE(vertices[0].position, abcPositions[0] + Vector2{0.0f, -1.0f});
+        CORRADE_COMPARE(vertices[3*4].position, abcaPositions[0] + Vector2{-5.0f, 0.0f});
+    }
+    #endif
+
+    /* Clearing keeps the capacity */
+    renderer.clear();
+    CORRADE_COMPARE(renderer.capacity(), 16);
+    CORRADE_COMPARE(renderer.glyphCount(), 0);
+    CORRADE_COMPARE(renderer.stringCount(), 0);
+    CORRADE_COMPARE(renderer.mesh().count(), 0);
+}
+
+void RendererGLTest::batchRendererInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    TestFont font;
+    font.openFile({}, 0.5f);
+    GlyphCacheGL cache = testGlyphCache(font);
+    BatchRenderer2D renderer{font, cache, 0.25f};
+    renderer.reserve(4, GL::BufferUsage::DynamicDraw, GL::BufferUsage::StaticDraw);
+    renderer.add("ab", {}, {}, 3);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    renderer.reserve(2, GL::BufferUsage::DynamicDraw, GL::BufferUsage::StaticDraw);
+    renderer.add("abc", {}, {}, 2);
+    renderer.add("ab", {}, {});
+    renderer.offset(1);
+    renderer.color(1);
+    renderer.rectangle(1);
+    renderer.setText(1, "a");
+    renderer.setText(0, "abcd");
+    renderer.setOffset(1, {});
+    renderer.setColor(1, {});
+    CORRADE_COMPARE(out.str(),
+        "Text::BatchRenderer::reserve(): capacity 2 too small for 3 already added glyphs\n"
+        "Text::BatchRenderer::add(): string capacity 2 too small to render 3 glyphs\n"
+        "Text::BatchRenderer::add(): capacity 4 too small to add 2 glyphs to 3 already added\n"
+        "Text::BatchRenderer::offset(): index 1 out of range for 1 strings\n"
+        "Text::BatchRenderer::color(): index 1 out of range for 1 strings\n"
+        "Text::BatchRenderer::rectangle(): index 1 out of range for 1 strings\n"
+        "Text::BatchRenderer::setText(): index 1 out of range for 1 strings\n"
+        "Text::BatchRenderer::setText(): string 0 capacity 3 too small to render 4 glyphs\n"
+        "Text::BatchRenderer::setOffset(): index 1 out of range for 1 strings\n"
+        "Text::BatchRenderer::setColor(): index 1 out of range for 1 strings\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Text::Test::RendererGLTest)
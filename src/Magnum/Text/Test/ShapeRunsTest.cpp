@@ -0,0 +1,322 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <string>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StringStl.h> /** @todo remove once Debug is stream-free */
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h> /** @todo remove once Debug is stream-free */
+
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Test/parallelFor.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/AbstractShaper.h"
+#include "Magnum/Text/Feature.h"
+#include "Magnum/Text/ShapeRuns.h"
+
+namespace Magnum { namespace Text { namespace Test { namespace {
+
+struct ShapeRunsTest: TestSuite::Tester {
+    explicit ShapeRunsTest();
+
+    void shape();
+    void shapeFeatures();
+    void shapeEmpty();
+    void shapeParallel();
+    void shapeInvalid();
+
+    void textLineRuns();
+    void textLineRunsEmpty();
+};
+
+const struct {
+    const char* name;
+    FontFeatures features;
+    bool parallelForCalled;
+} ShapeData[]{
+    {"", {}, false},
+    {"concurrent shaping", FontFeature::ConcurrentShaping, true},
+};
+
+ShapeRunsTest::ShapeRunsTest() {
+    addInstancedTests({&ShapeRunsTest::shape},
+        Containers::arraySize(ShapeData));
+
+    addTests({&ShapeRunsTest::shapeFeatures,
+              &ShapeRunsTest::shapeEmpty,
+              &ShapeRunsTest::shapeParallel,
+              &ShapeRunsTest::shapeInvalid,
+
+              &ShapeRunsTest::textLineRuns,
+              &ShapeRunsTest::textLineRunsEmpty});
+}
+
+using namespace Containers::Literals;
+
+/* Glyph IDs are the input bytes, clusters the byte positions, offsets the
+   position in the shaped range and the Y advance is the count of features
+   passed */
+struct ByteShaper: AbstractShaper {
+    using AbstractShaper::AbstractShaper;
+
+    UnsignedInt doShape(Containers::StringView text, UnsignedInt begin, UnsignedInt end, Containers::ArrayView<const FeatureRange> features) override {
+        _text = text.slice(begin, end);
+        _begin = begin;
+        _featureCount = features.size();
+        return end - begin;
+    }
+
+    void doGlyphIdsInto(const Containers::StridedArrayView1D<UnsignedInt>& ids) const override {
+        for(std::size_t i = 0; i != ids.size(); ++i)
+            ids[i] = _text[i];
+    }
+    void doGlyphOffsetsAdvancesInto(const Containers::StridedArrayView1D<Vector2>& offsets, const Containers::StridedArrayView1D<Vector2>& advances) const override {
+        for(std::size_t i = 0; i != offsets.size(); ++i) {
+            offsets[i] = {Float(i), 0.0f};
+            advances[i] = {1.0f, Float(_featureCount)};
+        }
+    }
+    void doGlyphClustersInto(const Containers::StridedArrayView1D<UnsignedInt>& clusters) const override {
+        for(std::size_t i = 0; i != clusters.size(); ++i)
+            clusters[i] = _begin + i;
+    }
+
+    private:
+        Containers::StringView _text;
+        UnsignedInt _begin;
+        std::size_t _featureCount;
+};
+
+struct ByteFont: AbstractFont {
+    explicit ByteFont(FontFeatures features = {}): _features{features} {}
+
+    FontFeatures doFeatures() const override { return _features; }
+    bool doIsOpened() const override { return _opened; }
+    void doClose() override { _opened = false; }
+
+    void doGlyphIdsInto(const Containers::StridedArrayView1D<const char32_t>&, const Containers::StridedArrayView1D<UnsignedInt>&) override {}
+    Vector2 doGlyphSize(UnsignedInt) override { return {}; }
+    Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+    Containers::Pointer<AbstractShaper> doCreateShaper() override {
+        ++shaperCount;
+        return Containers::Pointer<AbstractShaper>{new ByteShaper{*this}};
+    }
+
+    std::size_t shaperCount = 0;
+
+    private:
+        FontFeatures _features;
+        bool _opened = true;
+};
+
+/* Records the call, executes serially */
+void parallelForCounting(void* state, std::size_t count, void(*task)(void*, std::size_t), void* taskState) {
+    ++*static_cast<std::size_t*>(state);
+    for(std::size_t i = 0; i != count; ++i)
+        task(taskState, i);
+}
+
+using Magnum::Test::parallelForReverse;
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+using Magnum::Test::parallelForThreads;
+#endif
+
+void ShapeRunsTest::shape() {
+    auto&& data = ShapeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ByteFont font{data.features};
+
+    /* The third run is empty, the last one doesn't include the final
+       character */
+    Containers::StringView text = "hello\nworld\n\nab!"_s;
+    const Containers::Pair<UnsignedInt, UnsignedInt> runs[]{
+        {0, 5},
+        {6, 11},
+        {12, 12},
+        {13, 15},
+    };
+
+    UnsignedInt runGlyphOffsets[5];
+    std::size_t parallelForCallCount = 0;
+    Containers::Array<ShapedGlyph> glyphs = shapeRuns(font, text, runs, {}, runGlyphOffsets, parallelForCounting, &parallelForCallCount);
+    CORRADE_COMPARE(parallelForCallCount, data.parallelForCalled ? 2 : 0);
+    /* One shaper per chunk, which is a single run in the concurrent case */
+    CORRADE_COMPARE(font.shaperCount, data.parallelForCalled ? 4 : 1);
+
+    CORRADE_COMPARE_AS(Containers::arrayView(runGlyphOffsets), Containers::arrayView<UnsignedInt>({
+        0, 5, 10, 10, 12
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(stridedArrayView(glyphs).slice(&ShapedGlyph::id), Containers::arrayView<UnsignedInt>({
+        'h', 'e', 'l', 'l', 'o',
+        'w', 'o', 'r', 'l', 'd',
+        'a', 'b'
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(stridedArrayView(glyphs).slice(&ShapedGlyph::cluster), Containers::arrayView<UnsignedInt>({
+        0, 1, 2, 3, 4,
+        6, 7, 8, 9, 10,
+        13, 14
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(stridedArrayView(glyphs).slice(&ShapedGlyph::offset), Containers::arrayView<Vector2>({
+        {0.0f, 0.0f}, {1.0f, 0.0f}, {2.0f, 0.0f}, {3.0f, 0.0f}, {4.0f, 0.0f},
+        {0.0f, 0.0f}, {1.0f, 0.0f}, {2.0f, 0.0f}, {3.0f, 0.0f}, {4.0f, 0.0f},
+        {0.0f, 0.0f}, {1.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+}
+
+void ShapeRunsTest::shapeFeatures() {
+    ByteFont font;
+
+    const Containers::Pair<UnsignedInt, UnsignedInt> runs[]{
+        {0, 2}
+    };
+
+    UnsignedInt runGlyphOffsets[2];
+    Containers::Array<ShapedGlyph> glyphs = shapeRuns(font, "hey", runs, {
+        Feature::SmallCapitals,
+        {Feature::Kerning, false}
+    }, runGlyphOffsets, parallelForReverse, nullptr);
+    CORRADE_COMPARE_AS(stridedArrayView(glyphs).slice(&ShapedGlyph::advance), Containers::arrayView<Vector2>({
+        {1.0f, 2.0f}, {1.0f, 2.0f}
+    }), TestSuite::Compare::Container);
+}
+
+void ShapeRunsTest::shapeEmpty() {
+    ByteFont font{FontFeature::ConcurrentShaping};
+
+    std::size_t parallelForCallCount = 0;
+    Containers::Array<ShapedGlyph> glyphs = shapeRuns(font, "hello", {}, {}, {}, parallelForCounting, &parallelForCallCount);
+    CORRADE_COMPARE(glyphs.size(), 0);
+    CORRADE_COMPARE(parallelForCallCount, 0);
+    CORRADE_COMPARE(font.shaperCount, 0);
+}
+
+void ShapeRunsTest::shapeParallel() {
+    /* Way more lines than the max chunk count, so each chunk gets more than
+       one run and the last chunk is partially filled */
+    std::string text;
+    for(std::size_t i = 0; i != 1000; ++i) {
+        text += "line ";
+        text.append("abcdefghij", i % 10 + 1);
+        text += '\n';
+    }
+    Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> runs = Text::textLineRuns(text);
+    CORRADE_COMPARE(runs.size(), 1001);
+
+    ByteFont serialFont;
+    Containers::Array<UnsignedInt> expectedRunGlyphOffsets{NoInit, runs.size() + 1};
+    Containers::Array<ShapedGlyph> expected = shapeRuns(serialFont, text, runs, {}, expectedRunGlyphOffsets, nullptr, nullptr);
+    CORRADE_COMPARE(serialFont.shaperCount, 1);
+
+    ByteFont font{FontFeature::ConcurrentShaping};
+
+    /* The output should be the same as the serial variant regardless of the
+       execution order */
+    {
+        Containers::Array<UnsignedInt> runGlyphOffsets{NoInit, runs.size() + 1};
+        Containers::Array<ShapedGlyph> glyphs = shapeRuns(font, text, runs, {}, runGlyphOffsets, parallelForReverse, nullptr);
+        /* 1001 runs are split into chunks of 16, which is 63 chunks */
+        CORRADE_COMPARE(font.shaperCount, 63);
+        CORRADE_COMPARE_AS(runGlyphOffsets, expectedRunGlyphOffsets, TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(stridedArrayView(glyphs).slice(&ShapedGlyph::id), stridedArrayView(expected).slice(&ShapedGlyph::id), TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(stridedArrayView(glyphs).slice(&ShapedGlyph::cluster), stridedArrayView(expected).slice(&ShapedGlyph::cluster), TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(stridedArrayView(glyphs).slice(&ShapedGlyph::offset), stridedArrayView(expected).slice(&ShapedGlyph::offset), TestSuite::Compare::Container);
+    }
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    {
+        std::size_t threadCount = 4;
+        Containers::Array<UnsignedInt> runGlyphOffsets{NoInit, runs.size() + 1};
+        Containers::Array<ShapedGlyph> glyphs = shapeRuns(font, text, runs, {}, runGlyphOffsets, parallelForThreads, &threadCount);
+        CORRADE_COMPARE_AS(runGlyphOffsets, expectedRunGlyphOffsets, TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(stridedArrayView(glyphs).slice(&ShapedGlyph::id), stridedArrayView(expected).slice(&ShapedGlyph::id), TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(stridedArrayView(glyphs).slice(&ShapedGlyph::cluster), stridedArrayView(expected).slice(&ShapedGlyph::cluster), TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(stridedArrayView(glyphs).slice(&ShapedGlyph::offset), stridedArrayView(expected).slice(&ShapedGlyph::offset), TestSuite::Compare::Container);
+    }
+    #endif
+}
+
+void ShapeRunsTest::shapeInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    ByteFont font;
+    ByteFont closedFont;
+    closedFont.close();
+
+    const Containers::Pair<UnsignedInt, UnsignedInt> runs[]{
+        {0, 3},
+        {3, 5},
+    };
+    const Containers::Pair<UnsignedInt, UnsignedInt> runsOutOfRange[]{
+        {0, 3},
+        {3, 6},
+    };
+    const Containers::Pair<UnsignedInt, UnsignedInt> runsReversed[]{
+        {3, 2},
+    };
+    UnsignedInt runGlyphOffsets[3];
+    UnsignedInt runGlyphOffsetsInvalid[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    shapeRuns(closedFont, "hello", runs, {}, runGlyphOffsets, nullptr, nullptr);
+    shapeRuns(font, "hello", runs, {}, runGlyphOffsetsInvalid, nullptr, nullptr);
+    shapeRuns(font, "hello", {}, {}, runGlyphOffsetsInvalid, nullptr, nullptr);
+    shapeRuns(font, "hello", runsOutOfRange, {}, runGlyphOffsets, nullptr, nullptr);
+    shapeRuns(font, "hello", runsReversed, {}, runGlyphOffsetsInvalid, nullptr, nullptr);
+    CORRADE_COMPARE(out.str(),
+        "Text::shapeRuns(): no font opened\n"
+        "Text::shapeRuns(): expected run glyph offsets to have 3 elements but got 2\n"
+        "Text::shapeRuns(): expected run glyph offsets to have 0 elements but got 2\n"
+        "Text::shapeRuns(): run 1 begin 3 and end 6 out of range for a text of 5 bytes\n"
+        "Text::shapeRuns(): run 0 begin 3 and end 2 out of range for a text of 5 bytes\n");
+}
+
+void ShapeRunsTest::textLineRuns() {
+    Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> runs = Text::textLineRuns("hello\nworld\n\nab!\n");
+    CORRADE_COMPARE_AS(runs, (Containers::arrayView<Containers::Pair<UnsignedInt, UnsignedInt>>({
+        {0, 5},
+        {6, 11},
+        {12, 12},
+        {13, 16},
+        {17, 17}
+    })), TestSuite::Compare::Container);
+}
+
+void ShapeRunsTest::textLineRunsEmpty() {
+    Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> runs = Text::textLineRuns("");
+    CORRADE_COMPARE_AS(runs, (Containers::arrayView<Containers::Pair<UnsignedInt, UnsignedInt>>({
+        {0, 0}
+    })), TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::ShapeRunsTest)
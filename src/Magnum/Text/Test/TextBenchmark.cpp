@@ -0,0 +1,249 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/AbstractGlyphCache.h"
+#include "Magnum/Text/AbstractShaper.h"
+#include "Magnum/Text/Alignment.h"
+#include "Magnum/Text/CachingShaper.h"
+#include "Magnum/Text/Direction.h"
+#include "Magnum/Text/Renderer.h"
+
+namespace Magnum { namespace Text { namespace Test { namespace {
+
+/* Covers the shaping and rendering steps of a text, with a trivial font
+   that maps bytes directly to glyph IDs, so the results measure the library
+   overhead and not a particular font plugin */
+
+struct TextBenchmark: TestSuite::Tester {
+    explicit TextBenchmark();
+
+    void shape();
+    void shapeCaching();
+    void renderLineGlyphPositions();
+    void renderGlyphQuads();
+    void renderGlyphQuadIndices();
+    void alignBlock();
+};
+
+using namespace Containers::Literals;
+
+struct BenchmarkShaper: AbstractShaper {
+    using AbstractShaper::AbstractShaper;
+
+    UnsignedInt doShape(Containers::StringView text, UnsignedInt begin, UnsignedInt end, Containers::ArrayView<const FeatureRange>) override {
+        _text = text.slice(begin, end == ~UnsignedInt{} ? text.size() : end);
+        return _text.size();
+    }
+
+    void doGlyphIdsInto(const Containers::StridedArrayView1D<UnsignedInt>& ids) const override {
+        for(std::size_t i = 0; i != ids.size(); ++i)
+            ids[i] = UnsignedByte(_text[i]) & 0x7f;
+    }
+    void doGlyphOffsetsAdvancesInto(const Containers::StridedArrayView1D<Vector2>& offsets, const Containers::StridedArrayView1D<Vector2>& advances) const override {
+        for(std::size_t i = 0; i != offsets.size(); ++i) {
+            offsets[i] = {};
+            advances[i] = {8.0f, 0.0f};
+        }
+    }
+    void doGlyphClustersInto(const Containers::StridedArrayView1D<UnsignedInt>& clusters) const override {
+        for(std::size_t i = 0; i != clusters.size(); ++i)
+            clusters[i] = UnsignedInt(i);
+    }
+
+    Containers::StringView _text;
+};
+
+struct BenchmarkFont: AbstractFont {
+    FontFeatures doFeatures() const override { return {}; }
+
+    bool doIsOpened() const override { return _opened; }
+    void doClose() override { _opened = false; }
+
+    Properties doOpenFile(Containers::StringView, Float size) override {
+        _opened = true;
+        return {size, 12.0f, -4.0f, 16.0f, 128};
+    }
+
+    void doGlyphIdsInto(const Containers::StridedArrayView1D<const char32_t>& characters, const Containers::StridedArrayView1D<UnsignedInt>& glyphs) override {
+        for(std::size_t i = 0; i != characters.size(); ++i)
+            glyphs[i] = characters[i] & 0x7f;
+    }
+    Vector2 doGlyphSize(UnsignedInt) override { return {8.0f, 16.0f}; }
+    Vector2 doGlyphAdvance(UnsignedInt) override { return {8.0f, 0.0f}; }
+
+    Containers::Pointer<AbstractShaper> doCreateShaper() override {
+        return Containers::pointer<BenchmarkShaper>(*this);
+    }
+
+    bool _opened = false;
+};
+
+struct BenchmarkGlyphCache: AbstractGlyphCache {
+    using AbstractGlyphCache::AbstractGlyphCache;
+
+    GlyphCacheFeatures doFeatures() const override { return {}; }
+    void doSetImage(const Vector2i&, const ImageView2D&) override {}
+};
+
+/* A paragraph of text, repeated to get to about 4 kB */
+Containers::String benchmarkText() {
+    const Containers::StringView paragraph = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. "_s;
+    Containers::String out{NoInit, paragraph.size()*32};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = paragraph[i % paragraph.size()];
+    return out;
+}
+
+TextBenchmark::TextBenchmark() {
+    addBenchmarks({&TextBenchmark::shape,
+                   &TextBenchmark::shapeCaching,
+                   &TextBenchmark::renderLineGlyphPositions,
+                   &TextBenchmark::renderGlyphQuads,
+                   &TextBenchmark::renderGlyphQuadIndices,
+                   &TextBenchmark::alignBlock}, 10);
+}
+
+void TextBenchmark::shape() {
+    BenchmarkFont font;
+    font.openFile({}, 16.0f);
+    Containers::Pointer<AbstractShaper> shaper = font.createShaper();
+    const Containers::String text = benchmarkText();
+
+    Containers::Array<UnsignedInt> glyphIds{NoInit, text.size()};
+    Containers::Array<Vector2> offsets{NoInit, text.size()};
+    Containers::Array<Vector2> advances{NoInit, text.size()};
+    UnsignedInt glyphCount = 0;
+    CORRADE_BENCHMARK(10) {
+        glyphCount += shaper->shape(text);
+        shaper->glyphIdsInto(glyphIds);
+        shaper->glyphOffsetsAdvancesInto(offsets, advances);
+    }
+
+    CORRADE_COMPARE(glyphCount, 10*text.size());
+}
+
+void TextBenchmark::shapeCaching() {
+    BenchmarkFont font;
+    font.openFile({}, 16.0f);
+    Containers::Pointer<AbstractShaper> shaper = font.createShaper();
+    CachingShaper cachingShaper{*shaper, 1024*1024};
+    const Containers::String text = benchmarkText();
+
+    /* Populate the cache so the benchmark measures only the hits */
+    cachingShaper.shape(text);
+
+    Containers::Array<UnsignedInt> glyphIds{NoInit, text.size()};
+    Containers::Array<Vector2> offsets{NoInit, text.size()};
+    Containers::Array<Vector2> advances{NoInit, text.size()};
+    UnsignedInt glyphCount = 0;
+    CORRADE_BENCHMARK(10) {
+        glyphCount += cachingShaper.shape(text);
+        cachingShaper.glyphIdsInto(glyphIds);
+        cachingShaper.glyphOffsetsAdvancesInto(offsets, advances);
+    }
+
+    CORRADE_COMPARE(glyphCount, 10*text.size());
+    CORRADE_COMPARE(cachingShaper.hitCount(), 10);
+}
+
+void TextBenchmark::renderLineGlyphPositions() {
+    BenchmarkFont font;
+    font.openFile({}, 16.0f);
+    const std::size_t glyphCount = benchmarkText().size();
+
+    Containers::Array<Vector2> offsets{ValueInit, glyphCount};
+    Containers::Array<Vector2> advances{DirectInit, glyphCount, 8.0f, 0.0f};
+    Containers::Array<Vector2> positions{NoInit, glyphCount};
+    Range2D rectangle;
+    CORRADE_BENCHMARK(10) {
+        Vector2 cursor;
+        rectangle = renderLineGlyphPositionsInto(font, 8.0f, LayoutDirection::HorizontalTopToBottom, offsets, advances, cursor, positions);
+    }
+
+    CORRADE_COMPARE(rectangle.sizeX(), glyphCount*4.0f);
+}
+
+void TextBenchmark::renderGlyphQuads() {
+    BenchmarkFont font;
+    font.openFile({}, 16.0f);
+    BenchmarkGlyphCache cache{PixelFormat::R8Unorm, {512, 256}};
+    const UnsignedInt fontId = cache.addFont(font.glyphCount(), &font);
+    for(UnsignedInt i = 0; i != 128; ++i)
+        cache.addGlyph(fontId, i, {}, Range2Di::fromSize({Int(i%16)*32, Int(i/16)*32}, {8, 16}));
+
+    const Containers::String text = benchmarkText();
+    Containers::Array<Vector2> glyphPositions{NoInit, text.size()};
+    Containers::Array<UnsignedInt> fontGlyphIds{NoInit, text.size()};
+    for(std::size_t i = 0; i != text.size(); ++i) {
+        glyphPositions[i] = {Float(i)*8.0f, 0.0f};
+        fontGlyphIds[i] = UnsignedByte(text[i]) & 0x7f;
+    }
+
+    Containers::Array<Vector2> vertexPositions{NoInit, text.size()*4};
+    Containers::Array<Vector2> vertexTextureCoordinates{NoInit, text.size()*4};
+    Range2D rectangle;
+    CORRADE_BENCHMARK(10)
+        rectangle = renderGlyphQuadsInto(font, 16.0f, cache, glyphPositions, fontGlyphIds, vertexPositions, vertexTextureCoordinates);
+
+    CORRADE_COMPARE(rectangle.sizeY(), 16.0f);
+}
+
+void TextBenchmark::renderGlyphQuadIndices() {
+    Containers::Array<UnsignedInt> indices{NoInit, benchmarkText().size()*6};
+    CORRADE_BENCHMARK(10)
+        renderGlyphQuadIndicesInto(0, indices);
+
+    CORRADE_COMPARE(indices[7], 5);
+}
+
+void TextBenchmark::alignBlock() {
+    const std::size_t glyphCount = benchmarkText().size();
+    Containers::Array<Vector2> positions{NoInit, glyphCount*4};
+    for(std::size_t i = 0; i != positions.size(); ++i)
+        positions[i] = {Float(i/4)*8.0f + Float(i & 1)*8.0f, Float(i & 2)*8.0f};
+    const Range2D rectangle{{}, {glyphCount*8.0f, 16.0f}};
+
+    Range2D aligned;
+    CORRADE_BENCHMARK(10)
+        aligned = alignRenderedBlock(rectangle, LayoutDirection::HorizontalTopToBottom, Alignment::MiddleCenter, positions);
+
+    /* The positions get moved by half the size each time */
+    CORRADE_COMPARE(aligned.size(), rectangle.size());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::TextBenchmark)
@@ -44,6 +44,8 @@ class AbstractFontConverter;
 class AbstractGlyphCache;
 class AbstractLayouter;
 class AbstractShaper;
+class CachingShaper;
+struct ShapedGlyph;
 
 enum class Alignment: UnsignedByte;
 enum class ShapeDirection: UnsignedByte;
@@ -67,6 +69,10 @@ class AbstractRenderer;
 template<UnsignedInt> class Renderer;
 typedef Renderer<2> Renderer2D;
 typedef Renderer<3> Renderer3D;
+class AbstractBatchRenderer;
+template<UnsignedInt> class BatchRenderer;
+typedef BatchRenderer<2> BatchRenderer2D;
+typedef BatchRenderer<3> BatchRenderer3D;
 #endif
 
 }}
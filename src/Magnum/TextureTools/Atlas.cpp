@@ -33,15 +33,16 @@
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Move.h>
 
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/FunctionsBatch.h"
+#include "Magnum/Math/Range.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 #include <vector>
-
-#include "Magnum/Math/Range.h"
 #endif
 
 namespace Magnum { namespace TextureTools {
@@ -86,6 +87,9 @@ struct AtlasLandfillState {
     Containers::Array<Slice> slices;
     /* One entry for every size.x() */
     Containers::Array<UnsignedShort> yOffsets;
+    /* Areas below the filled height freed with remove(), including padding,
+       each together with the slice it's in */
+    Containers::Array<Containers::Pair<Int, Range2Di>> freed;
     /* X = MAX and z = 1 is for 2D unbounded, z = MAX is for 3D unbounded */
     Vector3i size;
     AtlasLandfillFlags flags = AtlasLandfillFlag::RotatePortrait|AtlasLandfillFlag::WidestFirst;
@@ -96,20 +100,19 @@ struct AtlasLandfillState {
 
 namespace {
 
-bool atlasLandfillAddSortedFlipped(Implementation::AtlasLandfillState& state, const Int slice, const Containers::StridedArrayView1D<const Containers::Pair<Vector2i, UnsignedInt>> sortedFlippedSizes, const Containers::StridedArrayView1D<Vector2i> offsets, const Containers::StridedArrayView1D<Int> zOffsets, const Containers::BitArrayView rotations) {
-    /* Add a new slice if not there yet, extend the yOffsets array */
-    if(UnsignedInt(slice) >= state.slices.size()) {
-        CORRADE_INTERNAL_ASSERT(UnsignedInt(slice) == state.slices.size());
-        CORRADE_INTERNAL_ASSERT(state.yOffsets.size() == state.slices.size()*state.size.x());
+void atlasLandfillAppendSlices(Implementation::AtlasLandfillState& state, const std::size_t count) {
+    CORRADE_INTERNAL_ASSERT(state.yOffsets.size() == state.slices.size()*state.size.x());
+    for(std::size_t i = 0; i != count; ++i)
         arrayAppend(state.slices, InPlaceInit);
-        /** @todo have an option to always start at the last tile so it doesn't
-            use a ton of memory when not filling incrementally and doesn't take
-            ages when incrementally filling a deep array */
-        /** @todo Utility::fill() */
-        for(UnsignedShort& i: arrayAppend(state.yOffsets, NoInit, state.size.x()))
-            i = 0;
-    }
+    /** @todo Utility::fill() */
+    for(UnsignedShort& i: arrayAppend(state.yOffsets, NoInit, count*state.size.x()))
+        i = 0;
+}
 
+/* Places as many items as possible into given slice, returns how many fit.
+   Touches only state of given slice and the outputs for items that fit, so
+   it's safe to be called for different slices concurrently. */
+std::size_t atlasLandfillAddSortedFlippedInto(Implementation::AtlasLandfillState& state, const Int slice, const Containers::StridedArrayView1D<const Containers::Pair<Vector2i, UnsignedInt>> sortedFlippedSizes, const Containers::StridedArrayView1D<Vector2i> offsets, const Containers::StridedArrayView1D<Int> zOffsets, const Containers::BitArrayView rotations) {
     Implementation::AtlasLandfillState::Slice& sliceState = state.slices[slice];
 
     /* View on the Y offsets in current slice and in current fill direction */
@@ -176,6 +179,21 @@ bool atlasLandfillAddSortedFlipped(Implementation::AtlasLandfillState& state, co
     if(zOffsets) for(std::size_t j = 0; j != i; ++j)
         zOffsets[sortedFlippedSizes[j].second()] = slice;
 
+    return i;
+}
+
+bool atlasLandfillAddSortedFlipped(Implementation::AtlasLandfillState& state, const Int slice, const Containers::StridedArrayView1D<const Containers::Pair<Vector2i, UnsignedInt>> sortedFlippedSizes, const Containers::StridedArrayView1D<Vector2i> offsets, const Containers::StridedArrayView1D<Int> zOffsets, const Containers::BitArrayView rotations) {
+    /* Add a new slice if not there yet, extend the yOffsets array */
+    /** @todo have an option to always start at the last tile so it doesn't
+        use a ton of memory when not filling incrementally and doesn't take
+        ages when incrementally filling a deep array */
+    if(UnsignedInt(slice) >= state.slices.size()) {
+        CORRADE_INTERNAL_ASSERT(UnsignedInt(slice) == state.slices.size());
+        atlasLandfillAppendSlices(state, 1);
+    }
+
+    const std::size_t i = atlasLandfillAddSortedFlippedInto(state, slice, sortedFlippedSizes, offsets, zOffsets, rotations);
+
     /* If there are items that didn't fit, recurse to the next slice. This
        should only happen if the Y size is bounded. */
     if(i < sortedFlippedSizes.size()) {
@@ -252,14 +270,107 @@ AtlasLandfill& AtlasLandfill::setFlags(AtlasLandfillFlags flags) {
 
 namespace {
 
-bool atlasLandfillAdd(Implementation::AtlasLandfillState& state, const Containers::StridedArrayView1D<const Vector2i> sizes, const Containers::StridedArrayView1D<Vector2i> offsets, const Containers::StridedArrayView1D<Int> zOffsets, const Containers::MutableBitArrayView rotations) {
+struct AtlasLandfillParallelState {
+    Implementation::AtlasLandfillState& state;
+    Int firstSlice;
+    std::size_t sliceCount;
+    Containers::ArrayView<const Containers::Pair<Vector2i, UnsignedInt>> partitionedSizes;
+    Containers::StridedArrayView1D<Vector2i> offsets;
+    Containers::StridedArrayView1D<Int> zOffsets;
+    Containers::BitArrayView rotations;
+    Containers::ArrayView<std::size_t> placed;
+};
+
+/* Items are distributed to slices in a round-robin fashion, so the first
+   count % sliceCount slices get one item more */
+std::size_t atlasLandfillParallelSliceOffset(const std::size_t count, const std::size_t sliceCount, const std::size_t slice) {
+    return slice*(count/sliceCount) + std::min(slice, count % sliceCount);
+}
+
+void atlasLandfillParallelTask(void* const taskState, const std::size_t i) {
+    AtlasLandfillParallelState& parallelState = *static_cast<AtlasLandfillParallelState*>(taskState);
+    const std::size_t count = parallelState.partitionedSizes.size();
+    const std::size_t begin = atlasLandfillParallelSliceOffset(count, parallelState.sliceCount, i);
+    const std::size_t end = atlasLandfillParallelSliceOffset(count, parallelState.sliceCount, i + 1);
+    parallelState.placed[i] = atlasLandfillAddSortedFlippedInto(parallelState.state, parallelState.firstSlice + Int(i), parallelState.partitionedSizes.slice(begin, end), parallelState.offsets, parallelState.zOffsets, parallelState.rotations);
+}
+
+/* Splits the sorted items across new slices, packs the slices through the
+   executor and then serially places items that didn't fit into their
+   slice */
+bool atlasLandfillAddSortedFlippedParallel(Implementation::AtlasLandfillState& state, const Containers::ArrayView<Containers::Pair<Vector2i, UnsignedInt>> sortedFlippedSizes, const Containers::StridedArrayView1D<Vector2i> offsets, const Containers::StridedArrayView1D<Int> zOffsets, const Containers::BitArrayView rotations, const ParallelFor parallelFor, void* const parallelForState) {
+    /* Fill the slices that already exist serially first, exactly as the
+       serial variant would */
+    Containers::ArrayView<Containers::Pair<Vector2i, UnsignedInt>> remaining = sortedFlippedSizes;
+    for(std::size_t slice = 0; slice != state.slices.size() && !remaining.isEmpty(); ++slice)
+        remaining = remaining.exceptPrefix(atlasLandfillAddSortedFlippedInto(state, Int(slice), remaining, offsets, zOffsets, rotations));
+    if(remaining.isEmpty())
+        return true;
+
+    /* Estimate the count of new slices from the total area. It's a lower
+       bound, so the slices get filled as much as possible and the items that
+       don't fit are placed serially at the end. */
+    const Int firstSlice = Int(state.slices.size());
+    if(firstSlice == state.size.z())
+        return false;
+    UnsignedLong area = 0;
+    for(const Containers::Pair<Vector2i, UnsignedInt>& i: remaining)
+        area += UnsignedLong(i.first().x())*i.first().y();
+    const UnsignedLong sliceArea = UnsignedLong(state.size.x())*state.size.y();
+    const std::size_t sliceCount = std::max(std::size_t(std::min((area + sliceArea - 1)/sliceArea, UnsignedLong(state.size.z() - firstSlice))), std::size_t{1});
+    atlasLandfillAppendSlices(state, sliceCount);
+
+    /* Distribute the items to slices in a round-robin fashion, which keeps
+       them sorted in each slice and gives each slice a similar mix of
+       sizes */
+    Containers::Array<Containers::Pair<Vector2i, UnsignedInt>> partitionedSizes{NoInit, remaining.size()};
+    for(std::size_t i = 0; i != remaining.size(); ++i)
+        partitionedSizes[atlasLandfillParallelSliceOffset(remaining.size(), sliceCount, i % sliceCount) + i/sliceCount] = remaining[i];
+
+    Containers::Array<std::size_t> placed{NoInit, sliceCount};
+    AtlasLandfillParallelState parallelState{state, firstSlice, sliceCount, partitionedSizes, offsets, zOffsets, rotations, placed};
+    parallelFor(parallelForState, sliceCount, atlasLandfillParallelTask, &parallelState);
+
+    /* Gather items that didn't fit into their slice, in the original sorted
+       order, and place them serially, starting from the first new slice */
+    std::size_t leftover = 0;
+    for(std::size_t i = 0; i != remaining.size(); ++i) {
+        const std::size_t slice = i % sliceCount;
+        if(i/sliceCount >= placed[slice])
+            remaining[leftover++] = partitionedSizes[atlasLandfillParallelSliceOffset(remaining.size(), sliceCount, slice) + i/sliceCount];
+    }
+
+    return !leftover || atlasLandfillAddSortedFlipped(state, firstSlice, remaining.prefix(leftover), offsets, zOffsets, rotations);
+}
+
+bool atlasLandfillAdd(Implementation::AtlasLandfillState& state, const char* const messagePrefix, const Containers::StridedArrayView1D<const Vector2i> sizes, const Containers::StridedArrayView1D<Vector2i> offsets, const Containers::StridedArrayView1D<Int> zOffsets, const Containers::MutableBitArrayView rotations, const ParallelFor parallelFor = nullptr, void* const parallelForState = nullptr) {
+    #if defined(CORRADE_NO_ASSERT) || defined(CORRADE_STANDARD_ASSERT)
+    static_cast<void>(messagePrefix);
+    #endif
+
     CORRADE_ASSERT(offsets.size() == sizes.size(),
-        "TextureTools::AtlasLandfill::add(): expected sizes and offsets views to have the same size, got" << sizes.size() << "and" << offsets.size(), {});
+        messagePrefix << "expected sizes and offsets views to have the same size, got" << sizes.size() << "and" << offsets.size(), {});
     CORRADE_ASSERT((!(state.flags & (AtlasLandfillFlag::RotatePortrait|AtlasLandfillFlag::RotateLandscape)) && rotations.isEmpty()) || rotations.size() == sizes.size(),
-        "TextureTools::AtlasLandfill::add(): expected sizes and rotations views to have the same size, got" << sizes.size() << "and" << rotations.size(), {});
+        messagePrefix << "expected sizes and rotations views to have the same size, got" << sizes.size() << "and" << rotations.size(), {});
     /* These are sliced internally from a Vector3i input, so should match */
     CORRADE_INTERNAL_ASSERT(!zOffsets || zOffsets.size() == sizes.size());
 
+    /* If the size is bounded, the items may not fit. Make a copy of the
+       state in that case to restore it on failure, so the items that got
+       placed before the failure don't occupy the atlas. */
+    Containers::Array<Implementation::AtlasLandfillState::Slice> previousSlices;
+    Containers::Array<UnsignedShort> previousYOffsets;
+    Containers::Array<Containers::Pair<Int, Range2Di>> previousFreed;
+    const bool bounded = state.size.y() != 0x7fffffff;
+    if(bounded) {
+        previousSlices = Containers::Array<Implementation::AtlasLandfillState::Slice>{NoInit, state.slices.size()};
+        previousYOffsets = Containers::Array<UnsignedShort>{NoInit, state.yOffsets.size()};
+        previousFreed = Containers::Array<Containers::Pair<Int, Range2Di>>{NoInit, state.freed.size()};
+        Utility::copy(state.slices, previousSlices);
+        Utility::copy(state.yOffsets, previousYOffsets);
+        Utility::copy(state.freed, previousFreed);
+    }
+
     /* Nothing is flipped by default */
     rotations.resetAll();
 
@@ -305,10 +416,10 @@ bool atlasLandfillAdd(Implementation::AtlasLandfillState& state, const Container
         #ifndef CORRADE_NO_ASSERT
         if(state.padding.isZero())
             CORRADE_ASSERT((sizePadded <= state.size.xy()).all(),
-                "TextureTools::AtlasLandfill::add(): expected size" << i << "to be not larger than" << Debug::packed << state.size.xy() << "but got" << Debug::packed << size, {});
+                messagePrefix << "expected size" << i << "to be not larger than" << Debug::packed << state.size.xy() << "but got" << Debug::packed << size, {});
         else
             CORRADE_ASSERT((sizePadded <= state.size.xy()).all(),
-                "TextureTools::AtlasLandfill::add(): expected size" << i << "to be not larger than" << Debug::packed << state.size.xy() << "but got" << Debug::packed << size << "and padding" << Debug::packed << padding, {});
+                messagePrefix << "expected size" << i << "to be not larger than" << Debug::packed << state.size.xy() << "but got" << Debug::packed << size << "and padding" << Debug::packed << padding, {});
         #endif
 
         sortedFlippedSizes[i] = {sizePadded, UnsignedInt(i)};
@@ -337,13 +448,83 @@ bool atlasLandfillAdd(Implementation::AtlasLandfillState& state, const Container
             return a.first().y() > b.first().y();
         });
 
-    return atlasLandfillAddSortedFlipped(state, 0, sortedFlippedSizes, offsets, zOffsets, rotations);
+    /* If there are areas freed by remove(), try to place the items there
+       first, picking the smallest area the item fits into. Items that don't
+       fit into any are moved to the front of the array, preserving their
+       order, and go through the regular process below. */
+    std::size_t remaining = sortedFlippedSizes.size();
+    if(!state.freed.isEmpty()) {
+        remaining = 0;
+        for(std::size_t i = 0; i != sortedFlippedSizes.size(); ++i) {
+            const Vector2i size = sortedFlippedSizes[i].first();
+
+            std::size_t best = ~std::size_t{};
+            for(std::size_t j = 0; j != state.freed.size(); ++j) {
+                const Vector2i freedSize = state.freed[j].second().size();
+                if((size <= freedSize).all() && (best == ~std::size_t{} ||
+                   freedSize.product() < state.freed[best].second().size().product()))
+                    best = j;
+            }
+
+            if(best == ~std::size_t{}) {
+                sortedFlippedSizes[remaining++] = sortedFlippedSizes[i];
+                continue;
+            }
+
+            /* Place the item to the bottom left corner of the area, handling
+               padding the same way as in atlasLandfillAddSortedFlipped() */
+            const Int slice = state.freed[best].first();
+            const Range2Di freed = state.freed[best].second();
+            const UnsignedInt index = sortedFlippedSizes[i].second();
+            const Vector2i padding = !rotations.isEmpty() && rotations[index] ?
+                state.padding.flipped() : state.padding;
+            offsets[index] = freed.min() + padding;
+            if(zOffsets)
+                zOffsets[index] = slice;
+
+            /* Split the rest of the area in two, with the larger leftover
+               dimension spanning the whole area. The first replaces the
+               original area, the second is appended, empty ones are
+               dropped. */
+            Range2Di a, b;
+            if(freed.sizeX() - size.x() > freed.sizeY() - size.y()) {
+                a = {{freed.min().x() + size.x(), freed.min().y()}, freed.max()};
+                b = {{freed.min().x(), freed.min().y() + size.y()},
+                     {freed.min().x() + size.x(), freed.max().y()}};
+            } else {
+                a = {{freed.min().x(), freed.min().y() + size.y()}, freed.max()};
+                b = {{freed.min().x() + size.x(), freed.min().y()},
+                     {freed.max().x(), freed.min().y() + size.y()}};
+            }
+            if(a.size().product()) {
+                state.freed[best].second() = a;
+            } else {
+                state.freed[best] = state.freed.back();
+                arrayRemoveSuffix(state.freed);
+            }
+            if(b.size().product())
+                arrayAppend(state.freed, InPlaceInit, slice, b);
+        }
+    }
+
+    /* A non-array atlas has just a single slice to fill, so there's nothing
+       to parallelize */
+    if(parallelFor && state.size.z() != 1 ?
+        atlasLandfillAddSortedFlippedParallel(state, sortedFlippedSizes.prefix(remaining), offsets, zOffsets, rotations, parallelFor, parallelForState) :
+        atlasLandfillAddSortedFlipped(state, 0, sortedFlippedSizes.prefix(remaining), offsets, zOffsets, rotations))
+        return true;
+
+    CORRADE_INTERNAL_ASSERT(bounded);
+    state.slices = Utility::move(previousSlices);
+    state.yOffsets = Utility::move(previousYOffsets);
+    state.freed = Utility::move(previousFreed);
+    return false;
 }
 
 }
 
 bool AtlasLandfill::add(const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector3i>& offsets, Containers::MutableBitArrayView flips) {
-    return atlasLandfillAdd(*_state, sizes, offsets.slice(&Vector3i::xy), offsets.slice(&Vector3i::z), flips);
+    return atlasLandfillAdd(*_state, "TextureTools::AtlasLandfill::add():", sizes, offsets.slice(&Vector3i::xy), offsets.slice(&Vector3i::z), flips);
 }
 
 bool AtlasLandfill::add(const std::initializer_list<Vector2i> sizes, const Containers::StridedArrayView1D<Vector3i>& offsets, Containers::MutableBitArrayView flips) {
@@ -360,10 +541,18 @@ bool AtlasLandfill::add(const std::initializer_list<Vector2i> sizes, const Conta
     return add(Containers::stridedArrayView(sizes), offsets);
 }
 
+bool AtlasLandfill::add(const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector3i>& offsets, Containers::MutableBitArrayView flips, const ParallelFor parallelFor, void* const parallelForState) {
+    return atlasLandfillAdd(*_state, "TextureTools::AtlasLandfill::add():", sizes, offsets.slice(&Vector3i::xy), offsets.slice(&Vector3i::z), flips, parallelFor ? parallelFor : parallelForSerial, parallelForState);
+}
+
+bool AtlasLandfill::add(const std::initializer_list<Vector2i> sizes, const Containers::StridedArrayView1D<Vector3i>& offsets, Containers::MutableBitArrayView flips, const ParallelFor parallelFor, void* const parallelForState) {
+    return add(Containers::stridedArrayView(sizes), offsets, flips, parallelFor, parallelForState);
+}
+
 bool AtlasLandfill::add(const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector2i>& offsets, Containers::MutableBitArrayView flips) {
     CORRADE_ASSERT(_state->size.z() == 1,
         "TextureTools::AtlasLandfill::add(): use the three-component overload for an array atlas", {});
-    return atlasLandfillAdd(*_state, sizes, offsets, nullptr, flips);
+    return atlasLandfillAdd(*_state, "TextureTools::AtlasLandfill::add():", sizes, offsets, nullptr, flips);
 }
 
 bool AtlasLandfill::add(const std::initializer_list<Vector2i> sizes, const Containers::StridedArrayView1D<Vector2i>& offsets, Containers::MutableBitArrayView flips) {
@@ -380,6 +569,99 @@ bool AtlasLandfill::add(const std::initializer_list<Vector2i> sizes, const Conta
     return add(Containers::stridedArrayView(sizes), offsets);
 }
 
+namespace {
+
+bool atlasLandfillCompact(Implementation::AtlasLandfillState& state, const Containers::StridedArrayView1D<const Vector2i> sizes, const Containers::StridedArrayView1D<Vector2i> offsets, const Containers::StridedArrayView1D<Int> zOffsets, const Containers::MutableBitArrayView rotations) {
+    /* Start from an empty state, keeping the original one to restore it if
+       the items don't fit */
+    Containers::Array<Implementation::AtlasLandfillState::Slice> previousSlices = Utility::move(state.slices);
+    Containers::Array<UnsignedShort> previousYOffsets = Utility::move(state.yOffsets);
+    Containers::Array<Containers::Pair<Int, Range2Di>> previousFreed = Utility::move(state.freed);
+
+    if(atlasLandfillAdd(state, "TextureTools::AtlasLandfill::compact():", sizes, offsets, zOffsets, rotations))
+        return true;
+
+    state.slices = Utility::move(previousSlices);
+    state.yOffsets = Utility::move(previousYOffsets);
+    state.freed = Utility::move(previousFreed);
+    return false;
+}
+
+}
+
+bool AtlasLandfill::compact(const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector3i>& offsets, Containers::MutableBitArrayView rotations) {
+    return atlasLandfillCompact(*_state, sizes, offsets.slice(&Vector3i::xy), offsets.slice(&Vector3i::z), rotations);
+}
+
+bool AtlasLandfill::compact(const std::initializer_list<Vector2i> sizes, const Containers::StridedArrayView1D<Vector3i>& offsets, Containers::MutableBitArrayView rotations) {
+    return compact(Containers::stridedArrayView(sizes), offsets, rotations);
+}
+
+bool AtlasLandfill::compact(const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector3i>& offsets) {
+    CORRADE_ASSERT(!(_state->flags & (AtlasLandfillFlag::RotatePortrait|AtlasLandfillFlag::RotateLandscape)),
+        "TextureTools::AtlasLandfill::compact():" << (_state->flags & (AtlasLandfillFlag::RotatePortrait|AtlasLandfillFlag::RotateLandscape)) << "set, expected a rotations view", {});
+    return compact(sizes, offsets, nullptr);
+}
+
+bool AtlasLandfill::compact(const std::initializer_list<Vector2i> sizes, const Containers::StridedArrayView1D<Vector3i>& offsets) {
+    return compact(Containers::stridedArrayView(sizes), offsets);
+}
+
+bool AtlasLandfill::compact(const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector2i>& offsets, Containers::MutableBitArrayView rotations) {
+    CORRADE_ASSERT(_state->size.z() == 1,
+        "TextureTools::AtlasLandfill::compact(): use the three-component overload for an array atlas", {});
+    return atlasLandfillCompact(*_state, sizes, offsets, nullptr, rotations);
+}
+
+bool AtlasLandfill::compact(const std::initializer_list<Vector2i> sizes, const Containers::StridedArrayView1D<Vector2i>& offsets, Containers::MutableBitArrayView rotations) {
+    return compact(Containers::stridedArrayView(sizes), offsets, rotations);
+}
+
+bool AtlasLandfill::compact(const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector2i>& offsets) {
+    CORRADE_ASSERT(!(_state->flags & (AtlasLandfillFlag::RotatePortrait|AtlasLandfillFlag::RotateLandscape)),
+        "TextureTools::AtlasLandfill::compact():" << (_state->flags & (AtlasLandfillFlag::RotatePortrait|AtlasLandfillFlag::RotateLandscape)) << "set, expected a rotations view", {});
+    return compact(sizes, offsets, nullptr);
+}
+
+bool AtlasLandfill::compact(const std::initializer_list<Vector2i> sizes, const Containers::StridedArrayView1D<Vector2i>& offsets) {
+    return compact(Containers::stridedArrayView(sizes), offsets);
+}
+
+AtlasLandfill& AtlasLandfill::remove(const Int slice, const Range2Di& rectangle) {
+    Implementation::AtlasLandfillState& state = *_state;
+    #ifndef CORRADE_NO_ASSERT
+    const Range2Dui rectangleu{rectangle};
+    #endif
+    CORRADE_ASSERT(UnsignedInt(slice) < state.slices.size() && (rectangleu.min() <= rectangleu.max()).all() && (rectangleu.max() <= Vector2ui{state.size.xy()}).all(),
+        "TextureTools::AtlasLandfill::remove(): slice" << slice << "and rectangle" << Debug::packed << rectangle << "out of range for" << state.slices.size() << "slices of size" << Debug::packed << size().xy(), *this);
+
+    /* Zero-area rectangles don't occupy anything */
+    if(!rectangle.size().product())
+        return *this;
+
+    /* If the rectangle is at the top of the filled area, simply lower the
+       filled height. Otherwise remember it for reuse in next add(). */
+    const Containers::ArrayView<UnsignedShort> yOffsets = state.yOffsets.sliceSize(slice*state.size.x() + rectangle.min().x(), rectangle.sizeX());
+    bool top = true;
+    for(const UnsignedShort yOffset: yOffsets) if(yOffset != rectangle.max().y()) {
+        top = false;
+        break;
+    }
+    if(top) {
+        /** @todo Utility::fill() */
+        for(UnsignedShort& yOffset: yOffsets)
+            yOffset = rectangle.min().y();
+    } else arrayAppend(state.freed, InPlaceInit, slice, rectangle);
+
+    return *this;
+}
+
+AtlasLandfill& AtlasLandfill::remove(const Range2Di& rectangle) {
+    CORRADE_ASSERT(_state->size.z() == 1,
+        "TextureTools::AtlasLandfill::remove(): use the slice overload for an array atlas", *this);
+    return remove(0, rectangle);
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 std::vector<Range2Di> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
     if(sizes.empty()) return {};
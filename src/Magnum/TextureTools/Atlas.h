@@ -33,6 +33,7 @@
 #include <Corrade/Containers/Pointer.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/Parallel.h"
 #include "Magnum/TextureTools/visibility.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -204,6 +205,49 @@ slice, finding the first that can fit the first (sorted) item. Then it attempts
 to place as many items as possible and on overflow continues searching for the
 next slice that can fit the first remaining item. If all slices are exhausted,
 adds a new one for as long as the depth (if bounded) allows.
+
+@section TextureTools-AtlasLandfill-parallel Parallel packing of array atlases
+
+With an array atlas, the slices are independent of each other, which allows
+@ref add(const Containers::StridedArrayView1D<const Vector2i>&, const Containers::StridedArrayView1D<Vector3i>&, Containers::MutableBitArrayView, ParallelFor, void*)
+to fill them concurrently through a @ref ParallelFor executor. After sorting
+and filling the already existing slices, the count of new slices is estimated
+from the total area of the remaining items. The sorted items are then
+distributed to the new slices in a round-robin fashion, so each slice gets a
+similar mix of sizes, and each slice is filled as described above in a
+separate task. Items that didn't fit into their slice are finally placed
+serially, starting from the first new slice.
+
+The result doesn't depend on the order in which the tasks are executed or on
+the count of threads used. It's usually slightly different from the serial
+variant, with the total count of slices being the same or larger by one.
+
+@snippet TextureTools.cpp AtlasLandfill-usage-array-parallel
+
+@section TextureTools-AtlasLandfill-remove Removing items
+
+Items that are no longer needed can be removed with @ref remove(), which makes
+their area available for subsequent @ref add() calls. If the removed area is at
+the top of the filled height, the filled height is lowered back. Otherwise the
+area is remembered and next @ref add() attempts to place items into the
+smallest remembered area they fit into first, splitting the leftover space, and
+only the items that don't fit into any go through the regular process
+described above. This allows for example a glyph cache to have a bounded size
+while glyphs get continuously added and evicted, see
+@ref Text::AbstractGlyphCache::evictGlyphs() for an example.
+
+Removed areas aren't merged together, so with a lot of additions and removals
+of differently sized items the free space gets gradually fragmented. Complexity
+of placing an item into a removed area is @f$ \mathcal{O}(f) @f$ with
+@f$ f @f$ being the count of currently remembered areas.
+
+If the fragmentation becomes too high, @ref compact() places all items that
+are still in use anew, as if they were added to an empty atlas in a single
+@ref add() call. It's then up to the caller to move the data of items whose
+placement changed, which is usually cheaper than rebuilding the atlas from
+scratch as the item data don't need to be generated again:
+
+@snippet TextureTools.cpp AtlasLandfill-compact
 */
 class MAGNUM_TEXTURETOOLS_EXPORT AtlasLandfill {
     public:
@@ -365,8 +409,10 @@ class MAGNUM_TEXTURETOOLS_EXPORT AtlasLandfill {
          *
          * On success returns @cpp true @ce and updates @ref filledSize(). If
          * @ref size() is bounded, can return @cpp false @ce if the items
-         * didn't fit, in which case the internals and contents of @p offsets
-         * and @p rotations are left in an undefined state. For an unbounded
+         * didn't fit, in which case the contents of @p offsets and
+         * @p rotations are left in an undefined state. The atlas itself is
+         * left in the state before the call, so it's possible to for example
+         * @ref remove() some items and try again. For an unbounded
          * @ref size() returns @cpp true @ce always.
          * @see @ref setFlags(), @ref setPadding()
          */
@@ -389,6 +435,34 @@ class MAGNUM_TEXTURETOOLS_EXPORT AtlasLandfill {
         /** @overload */
         bool add(std::initializer_list<Vector2i> sizes, const Containers::StridedArrayView1D<Vector3i>& offsets);
 
+        /**
+         * @brief Add textures to an array atlas using a parallel executor
+         * @param[in]  sizes        Texture sizes
+         * @param[out] offsets      Resulting offsets in the atlas
+         * @param[out] rotations    Which textures got rotated
+         * @param[in]  parallelFor  Parallel loop executor or @cpp nullptr @ce
+         * @param[in]  parallelForState State pointer passed to @p parallelFor
+         * @m_since_latest
+         *
+         * Same as @ref add(const Containers::StridedArrayView1D<const Vector2i>&, const Containers::StridedArrayView1D<Vector3i>&, Containers::MutableBitArrayView),
+         * but the items that don't fit into already existing slices are
+         * distributed across new slices and the slices are then filled
+         * concurrently through @p parallelFor. See
+         * @ref TextureTools-AtlasLandfill-parallel for details. Pass an empty
+         * @p rotations view if neither
+         * @ref AtlasLandfillFlag::RotatePortrait nor
+         * @relativeref{AtlasLandfillFlag,RotateLandscape} is set. If
+         * @ref size() depth is @cpp 1 @ce, there's nothing to parallelize
+         * and the function behaves the same as the serial variant.
+         */
+        bool add(const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector3i>& offsets, Containers::MutableBitArrayView rotations, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        bool add(std::initializer_list<Vector2i> sizes, const Containers::StridedArrayView1D<Vector3i>& offsets, Containers::MutableBitArrayView rotations, ParallelFor parallelFor, void* parallelForState = nullptr);
+
         /**
          * @brief Add textures to a non-array atlas
          *
@@ -414,6 +488,107 @@ class MAGNUM_TEXTURETOOLS_EXPORT AtlasLandfill {
         /** @overload */
         bool add(std::initializer_list<Vector2i> sizes, const Containers::StridedArrayView1D<Vector2i>& offsets);
 
+        /**
+         * @brief Remove a texture from the atlas
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * The @p rectangle is expected to include padding, i.e. be the
+         * offset returned from @ref add() and the (potentially rotated) size
+         * padded with @ref padding() (flipped, if the item was rotated).
+         * The @p slice is expected to be less than @ref filledSize() depth
+         * and the @p rectangle within @ref size(). The area is made available
+         * for subsequent @ref add() calls, see
+         * @ref TextureTools-AtlasLandfill-remove for more information. Zero-area
+         * rectangles are ignored. Removing an area that isn't occupied by any
+         * item or removing the same area twice results in overlapping items
+         * being placed in a subsequent @ref add().
+         */
+        AtlasLandfill& remove(Int slice, const Range2Di& rectangle);
+
+        /**
+         * @brief Remove a texture from a non-array atlas
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref remove(Int, const Range2Di&) with
+         * @p slice set to @cpp 0 @ce. Can be called only if @ref size() depth
+         * is @cpp 1 @ce.
+         */
+        AtlasLandfill& remove(const Range2Di& rectangle);
+
+        /**
+         * @brief Compact the atlas
+         * @param[in] sizes     Sizes of all items currently in the atlas
+         * @param[out] offsets  Resulting offsets in the atlas
+         * @param[out] rotations  Which items got rotated
+         * @return Whether the items fit
+         * @m_since_latest
+         *
+         * Discards all state including areas remembered by @ref remove()
+         * and places the @p sizes anew as if they were passed to a single
+         * @ref add() call on an empty atlas, which removes fragmentation
+         * caused by a long sequence of additions and removals. The @p sizes
+         * are expected to be the original unrotated sizes of all items that
+         * are currently in the atlas, the same constraints as in @ref add()
+         * apply to them. Items whose offset or rotation differs from the one
+         * they had before were moved and their data need to be copied to
+         * the new location, in case of overlapping moves through a temporary
+         * copy. See @ref TextureTools-AtlasLandfill-remove for more
+         * information.
+         *
+         * If the size is bounded and the items don't fit, returns
+         * @cpp false @ce and the original state, including the remembered
+         * removed areas, is left untouched. The @p offsets and
+         * @p rotations may be modified even in that case.
+         */
+        bool compact(const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector3i>& offsets, Containers::MutableBitArrayView rotations);
+
+        /** @overload */
+        bool compact(std::initializer_list<Vector2i> sizes, const Containers::StridedArrayView1D<Vector3i>& offsets, Containers::MutableBitArrayView rotations);
+
+        /**
+         * @brief Compact the atlas with rotations disabled
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref compact(const Containers::StridedArrayView1D<const Vector2i>&, const Containers::StridedArrayView1D<Vector3i>&, Containers::MutableBitArrayView)
+         * with the @p rotations view being empty. Can be called only if
+         * neither @ref AtlasLandfillFlag::RotatePortrait nor
+         * @relativeref{AtlasLandfillFlag,RotateLandscape} is set.
+         */
+        bool compact(const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector3i>& offsets);
+
+        /** @overload */
+        bool compact(std::initializer_list<Vector2i> sizes, const Containers::StridedArrayView1D<Vector3i>& offsets);
+
+        /**
+         * @brief Compact a non-array atlas
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref compact(const Containers::StridedArrayView1D<const Vector2i>&, const Containers::StridedArrayView1D<Vector3i>&, Containers::MutableBitArrayView)
+         * with the third component of @p offsets omitted. Can be called only
+         * if @ref size() depth is @cpp 1 @ce.
+         */
+        bool compact(const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector2i>& offsets, Containers::MutableBitArrayView rotations);
+
+        /** @overload */
+        bool compact(std::initializer_list<Vector2i> sizes, const Containers::StridedArrayView1D<Vector2i>& offsets, Containers::MutableBitArrayView rotations);
+
+        /**
+         * @brief Compact a non-array atlas with rotations disabled
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref compact(const Containers::StridedArrayView1D<const Vector2i>&, const Containers::StridedArrayView1D<Vector2i>&, Containers::MutableBitArrayView)
+         * with the @p rotations view being empty. Can be called only if
+         * @ref size() depth is @cpp 1 @ce and neither
+         * @ref AtlasLandfillFlag::RotatePortrait nor
+         * @relativeref{AtlasLandfillFlag,RotateLandscape} is set.
+         */
+        bool compact(const Containers::StridedArrayView1D<const Vector2i>& sizes, const Containers::StridedArrayView1D<Vector2i>& offsets);
+
+        /** @overload */
+        bool compact(std::initializer_list<Vector2i> sizes, const Containers::StridedArrayView1D<Vector2i>& offsets);
+
     private:
         Containers::Pointer<Implementation::AtlasLandfillState> _state;
 };
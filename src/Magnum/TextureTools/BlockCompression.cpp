@@ -0,0 +1,904 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BlockCompression.h"
+
+#include <algorithm> /* std::min() on std::size_t */
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+enum class BlockType: UnsignedByte {
+    /* BC1 without alpha, always in the four-color mode */
+    Bc1,
+    /* BC1 with a punch-through alpha, switching to the three-color mode
+       for blocks with transparent pixels */
+    Bc1Alpha,
+    /* BC4 alpha block followed by a four-color BC1 block */
+    Bc3,
+    Bc4,
+    /* Two BC4 blocks */
+    Bc5,
+    /* ETC2 RGB block in the ETC1-compatible individual or differential
+       mode */
+    Etc2,
+    /* EAC alpha block followed by an ETC2 RGB block */
+    Etc2Eac,
+    /* EAC block with 11-bit values */
+    EacR11,
+    /* Two EAC blocks with 11-bit values */
+    EacRG11,
+    /* BC7 block, always in mode 6 */
+    Bc7
+};
+
+/* Color block of BC1 and BC3 */
+struct ColorBlock {
+    UnsignedShort color0, color1;
+    UnsignedInt indices;
+};
+
+UnsignedShort packRgb565(const Vector3& color) {
+    const Vector3 c = Math::clamp(color, 0.0f, 255.0f);
+    return (UnsignedShort(c.x()*31.0f/255.0f + 0.5f) << 11)|
+           (UnsignedShort(c.y()*63.0f/255.0f + 0.5f) << 5)|
+            UnsignedShort(c.z()*31.0f/255.0f + 0.5f);
+}
+
+Vector3 unpackRgb565(const UnsignedShort color) {
+    const UnsignedInt r = color >> 11;
+    const UnsignedInt g = (color >> 5) & 0x3f;
+    const UnsignedInt b = color & 0x1f;
+    return {Float((r << 3)|(r >> 2)),
+            Float((g << 2)|(g >> 4)),
+            Float((b << 3)|(b >> 2))};
+}
+
+/* Picks the nearest palette entry for every pixel with a bit set in `mask`,
+   pixels outside of the mask get index 3, which is transparent in the
+   three-color mode. Returns the total squared error. */
+Float assignColorIndices(const Vector3(&pixels)[16], const UnsignedShort mask, const UnsignedShort color0, const UnsignedShort color1, const bool threeColor, UnsignedInt& indices) {
+    Vector3 palette[4];
+    palette[0] = unpackRgb565(color0);
+    palette[1] = unpackRgb565(color1);
+    UnsignedInt paletteSize;
+    if(threeColor) {
+        palette[2] = (palette[0] + palette[1])*0.5f;
+        paletteSize = 3;
+    } else {
+        palette[2] = (palette[0]*2.0f + palette[1])/3.0f;
+        palette[3] = (palette[0] + palette[1]*2.0f)/3.0f;
+        paletteSize = 4;
+    }
+
+    indices = 0;
+    Float error = 0.0f;
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        if(!(mask & (1 << i))) {
+            indices |= 3u << 2*i;
+            continue;
+        }
+
+        UnsignedInt best = 0;
+        Float bestError = (pixels[i] - palette[0]).dot();
+        for(UnsignedInt j = 1; j != paletteSize; ++j) {
+            const Float e = (pixels[i] - palette[j]).dot();
+            if(e < bestError) {
+                best = j;
+                bestError = e;
+            }
+        }
+
+        indices |= best << 2*i;
+        error += bestError;
+    }
+
+    return error;
+}
+
+/* Endpoints at the pixels that are farthest apart along the principal axis
+   of the pixels in `mask` */
+void principalAxisEndpoints(const Vector3(&pixels)[16], const UnsignedShort mask, Vector3& a, Vector3& b) {
+    Vector3 mean;
+    Vector3 min{255.0f};
+    Vector3 max{0.0f};
+    Float count = 0.0f;
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        if(!(mask & (1 << i))) continue;
+        mean += pixels[i];
+        min = Math::min(min, pixels[i]);
+        max = Math::max(max, pixels[i]);
+        count += 1.0f;
+    }
+    mean /= count;
+
+    /* Upper triangle of the covariance matrix */
+    Float xx{}, xy{}, xz{}, yy{}, yz{}, zz{};
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        if(!(mask & (1 << i))) continue;
+        const Vector3 d = pixels[i] - mean;
+        xx += d.x()*d.x();
+        xy += d.x()*d.y();
+        xz += d.x()*d.z();
+        yy += d.y()*d.y();
+        yz += d.y()*d.z();
+        zz += d.z()*d.z();
+    }
+
+    /* A few power iterations starting from the bounding box diagonal are
+       enough for the precision needed here */
+    Vector3 axis = max - min;
+    for(UnsignedInt i = 0; i != 4; ++i) {
+        axis = {xx*axis.x() + xy*axis.y() + xz*axis.z(),
+                xy*axis.x() + yy*axis.y() + yz*axis.z(),
+                xz*axis.x() + yz*axis.y() + zz*axis.z()};
+        const Float length = Math::abs(axis).max();
+        if(length == 0.0f) break;
+        axis /= length;
+    }
+
+    Float minProjection = Constants::inf();
+    Float maxProjection = -Constants::inf();
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        if(!(mask & (1 << i))) continue;
+        const Float projection = Math::dot(pixels[i], axis);
+        if(projection < minProjection) {
+            minProjection = projection;
+            b = pixels[i];
+        }
+        if(projection > maxProjection) {
+            maxProjection = projection;
+            a = pixels[i];
+        }
+    }
+}
+
+/* Least-squares endpoints for given palette indices. Returns false if the
+   system is singular, i.e. all pixels use the same palette weights. */
+bool leastSquaresEndpoints(const Vector3(&pixels)[16], const UnsignedShort mask, const UnsignedInt indices, const bool threeColor, Vector3& a, Vector3& b) {
+    /* Weight of the first endpoint for each palette index */
+    constexpr Float FourColorWeights[]{1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f};
+    constexpr Float ThreeColorWeights[]{1.0f, 0.0f, 0.5f, 0.0f};
+    const Float* const weights = threeColor ? ThreeColorWeights : FourColorWeights;
+
+    Float aa{}, ab{}, bb{};
+    Vector3 ax, bx;
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        if(!(mask & (1 << i))) continue;
+        const Float alpha = weights[(indices >> 2*i) & 3];
+        const Float beta = 1.0f - alpha;
+        aa += alpha*alpha;
+        ab += alpha*beta;
+        bb += beta*beta;
+        ax += alpha*pixels[i];
+        bx += beta*pixels[i];
+    }
+
+    const Float determinant = aa*bb - ab*ab;
+    if(Math::abs(determinant) < 1.0e-6f)
+        return false;
+
+    a = (ax*bb - bx*ab)/determinant;
+    b = (bx*aa - ax*ab)/determinant;
+    return true;
+}
+
+ColorBlock encodeColorBlock(const Vector3(&pixels)[16], const UnsignedShort mask, const bool threeColor) {
+    /* All pixels transparent */
+    if(!mask)
+        return {0, 0, 0xffffffffu};
+
+    Vector3 a, b;
+    principalAxisEndpoints(pixels, mask, a, b);
+    ColorBlock out{packRgb565(a), packRgb565(b), 0};
+    Float error = assignColorIndices(pixels, mask, out.color0, out.color1, threeColor, out.indices);
+
+    /* Refine the endpoints to fit the assigned indices, keep them if
+       better */
+    if(error > 0.0f && leastSquaresEndpoints(pixels, mask, out.indices, threeColor, a, b)) {
+        ColorBlock refined{packRgb565(a), packRgb565(b), 0};
+        if(assignColorIndices(pixels, mask, refined.color0, refined.color1, threeColor, refined.indices) < error)
+            out = refined;
+    }
+
+    /* The mode is given by the endpoint order. In the three-color mode swap
+       indices 0 and 1 and keep 2 and 3, in the four-color mode swap 0 with 1
+       and 2 with 3. Equal endpoints would mean a three-color mode, so pick
+       just the first palette entry instead. */
+    if(threeColor) {
+        if(out.color0 > out.color1) {
+            Utility::swap(out.color0, out.color1);
+            out.indices ^= ~(out.indices >> 1) & 0x55555555u;
+        }
+    } else {
+        if(out.color0 < out.color1) {
+            Utility::swap(out.color0, out.color1);
+            out.indices ^= 0x55555555u;
+        } else if(out.color0 == out.color1)
+            out.indices = 0;
+    }
+
+    return out;
+}
+
+void writeColorBlock(const ColorBlock& block, char* const out) {
+    out[0] = char(block.color0 & 0xff);
+    out[1] = char(block.color0 >> 8);
+    out[2] = char(block.color1 & 0xff);
+    out[3] = char(block.color1 >> 8);
+    for(UnsignedInt i = 0; i != 4; ++i)
+        out[4 + i] = char((block.indices >> 8*i) & 0xff);
+}
+
+/* BC4 block from the channel minimum and maximum, always in the eight-value
+   mode unless all values are the same */
+void encodeSingleChannelBlock(const UnsignedByte(&values)[16], char* const out) {
+    UnsignedByte min = 255;
+    UnsignedByte max = 0;
+    for(const UnsignedByte i: values) {
+        min = Math::min(min, i);
+        max = Math::max(max, i);
+    }
+
+    out[0] = char(max);
+    out[1] = char(min);
+    for(UnsignedInt i = 2; i != 8; ++i)
+        out[i] = 0;
+    if(min == max)
+        return;
+
+    Int palette[8];
+    palette[0] = max;
+    palette[1] = min;
+    for(Int i = 1; i != 7; ++i)
+        palette[i + 1] = ((7 - i)*max + i*min + 3)/7;
+
+    UnsignedLong bits = 0;
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        UnsignedInt best = 0;
+        Int bestError = Math::abs(values[i] - palette[0]);
+        for(UnsignedInt j = 1; j != 8; ++j) {
+            const Int e = Math::abs(values[i] - palette[j]);
+            if(e < bestError) {
+                best = j;
+                bestError = e;
+            }
+        }
+        bits |= UnsignedLong(best) << 3*i;
+    }
+
+    for(UnsignedInt i = 0; i != 6; ++i)
+        out[2 + i] = char((bits >> 8*i) & 0xff);
+}
+
+/* Intensity modifiers of the ETC2 individual and differential mode, indexed
+   by the table codeword and the pixel index value */
+constexpr Int EtcModifiers[8][4]{
+    {2, 8, -2, -8},
+    {5, 17, -5, -17},
+    {9, 29, -9, -29},
+    {13, 42, -13, -42},
+    {18, 60, -18, -60},
+    {24, 80, -24, -80},
+    {33, 106, -33, -106},
+    {47, 183, -47, -183}
+};
+
+/* Picks the modifier table with the lowest error for pixels with a bit set in
+   `mask` and a subblock base color, putting the pixel index values to
+   `indices`, two bits per pixel in row-major order. Returns the total squared
+   error. */
+UnsignedInt assignEtcIndices(const Vector3i(&pixels)[16], const UnsignedShort mask, const Vector3i& base, UnsignedInt& table, UnsignedInt& indices) {
+    UnsignedInt bestError = ~UnsignedInt{};
+    for(UnsignedInt t = 0; t != 8; ++t) {
+        Vector3i palette[4];
+        for(UnsignedInt j = 0; j != 4; ++j)
+            palette[j] = Math::clamp(base + Vector3i{EtcModifiers[t][j]}, 0, 255);
+
+        UnsignedInt tableIndices = 0;
+        UnsignedInt error = 0;
+        for(UnsignedInt i = 0; i != 16; ++i) {
+            if(!(mask & (1 << i))) continue;
+
+            UnsignedInt best = 0;
+            Int bestPixelError = (pixels[i] - palette[0]).dot();
+            for(UnsignedInt j = 1; j != 4; ++j) {
+                const Int e = (pixels[i] - palette[j]).dot();
+                if(e < bestPixelError) {
+                    best = j;
+                    bestPixelError = e;
+                }
+            }
+
+            tableIndices |= best << 2*i;
+            error += bestPixelError;
+        }
+
+        if(error < bestError) {
+            bestError = error;
+            table = t;
+            indices = tableIndices;
+        }
+    }
+
+    return bestError;
+}
+
+/* Pixel index bits of an ETC2 RGB block. The pixels are in column-major
+   order, most significant bits of all pixels are in the upper half. */
+UnsignedLong etcIndexBits(const UnsignedInt indices) {
+    UnsignedLong out = 0;
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        const UnsignedInt value = (indices >> 2*i) & 3;
+        const UnsignedInt bit = (i%4)*4 + i/4;
+        out |= UnsignedLong(value >> 1) << (16 + bit);
+        out |= UnsignedLong(value & 1) << bit;
+    }
+    return out;
+}
+
+/* ETC2 RGB block using just the individual and differential modes, which are
+   shared with ETC1. Both subblock orientations and both modes are tried with
+   the subblock average as the base color, keeping the one with the lowest
+   error. The differential mode is used only if the base colors are close
+   enough to not overflow into the other ETC2 modes. */
+void encodeEtcColorBlock(const Vector3i(&pixels)[16], char* const out) {
+    /* Subblock pixels with the flip bit unset (two 2x4 blocks side by side)
+       and set (two 4x2 blocks on top of each other) */
+    constexpr UnsignedShort SubblockMasks[2][2]{
+        {0x3333, 0xcccc},
+        {0x00ff, 0xff00}
+    };
+
+    UnsignedLong bits = 0;
+    UnsignedInt bestError = ~UnsignedInt{};
+    for(UnsignedInt flip = 0; flip != 2; ++flip) {
+        Vector3i average[2];
+        for(UnsignedInt s = 0; s != 2; ++s) {
+            for(UnsignedInt i = 0; i != 16; ++i)
+                if(SubblockMasks[flip][s] & (1 << i))
+                    average[s] += pixels[i];
+            average[s] = (average[s] + Vector3i{4})/8;
+        }
+
+        UnsignedInt table[2];
+        UnsignedInt indices[2];
+
+        /* Individual mode, 4-bit base colors */
+        {
+            Vector3i color[2];
+            UnsignedInt error = 0;
+            for(UnsignedInt s = 0; s != 2; ++s) {
+                color[s] = (average[s]*15 + Vector3i{127})/255;
+                error += assignEtcIndices(pixels, SubblockMasks[flip][s], color[s]*17, table[s], indices[s]);
+            }
+
+            if(error < bestError) {
+                bestError = error;
+                bits = (UnsignedLong(color[0].x()) << 60)|
+                       (UnsignedLong(color[1].x()) << 56)|
+                       (UnsignedLong(color[0].y()) << 52)|
+                       (UnsignedLong(color[1].y()) << 48)|
+                       (UnsignedLong(color[0].z()) << 44)|
+                       (UnsignedLong(color[1].z()) << 40)|
+                       (UnsignedLong(table[0]) << 37)|
+                       (UnsignedLong(table[1]) << 34)|
+                       (UnsignedLong(flip) << 32)|
+                       etcIndexBits(indices[0]|indices[1]);
+            }
+        }
+
+        /* Differential mode, 5-bit base color and a 3-bit signed difference
+           for the second subblock */
+        {
+            Vector3i color[2];
+            for(UnsignedInt s = 0; s != 2; ++s)
+                color[s] = (average[s]*31 + Vector3i{127})/255;
+            const Vector3i delta = color[1] - color[0];
+            if(delta.min() < -4 || delta.max() > 3)
+                continue;
+
+            UnsignedInt error = 0;
+            for(UnsignedInt s = 0; s != 2; ++s)
+                error += assignEtcIndices(pixels, SubblockMasks[flip][s], color[s]*8 + color[s]/4, table[s], indices[s]);
+
+            if(error < bestError) {
+                bestError = error;
+                bits = (UnsignedLong(color[0].x()) << 59)|
+                       (UnsignedLong(delta.x() & 7) << 56)|
+                       (UnsignedLong(color[0].y()) << 51)|
+                       (UnsignedLong(delta.y() & 7) << 48)|
+                       (UnsignedLong(color[0].z()) << 43)|
+                       (UnsignedLong(delta.z() & 7) << 40)|
+                       (UnsignedLong(table[0]) << 37)|
+                       (UnsignedLong(table[1]) << 34)|
+                       (UnsignedLong(1) << 33)|
+                       (UnsignedLong(flip) << 32)|
+                       etcIndexBits(indices[0]|indices[1]);
+            }
+        }
+    }
+
+    /* Stored as big endian */
+    for(UnsignedInt i = 0; i != 8; ++i)
+        out[i] = char((bits >> (56 - 8*i)) & 0xff);
+}
+
+/* Modifiers of EAC blocks, indexed by the table index and the pixel index
+   value */
+constexpr Int EacModifiers[16][8]{
+    {-3, -6, -9, -15, 2, 5, 8, 14},
+    {-3, -7, -10, -13, 2, 6, 9, 12},
+    {-2, -5, -8, -13, 1, 4, 7, 12},
+    {-2, -4, -6, -13, 1, 3, 5, 12},
+    {-3, -6, -8, -12, 2, 5, 7, 11},
+    {-3, -7, -9, -11, 2, 6, 8, 10},
+    {-4, -7, -8, -11, 3, 6, 7, 10},
+    {-3, -5, -8, -11, 2, 4, 7, 10},
+    {-2, -6, -8, -10, 1, 5, 7, 9},
+    {-2, -5, -8, -10, 1, 4, 7, 9},
+    {-2, -4, -8, -10, 1, 3, 7, 9},
+    {-2, -5, -7, -10, 1, 4, 6, 9},
+    {-3, -4, -7, -10, 2, 3, 6, 9},
+    {-1, -2, -3, -10, 0, 1, 2, 9},
+    {-4, -6, -8, -9, 3, 5, 7, 8},
+    {-3, -5, -7, -9, 2, 4, 6, 8}
+};
+
+/* EAC block, either the 8-bit variant used for ETC2 alpha or the 11-bit
+   variant of R11 and RG11. For every modifier table a multiplier spanning the
+   value range and a base in the middle of it is calculated, trying also the
+   neighboring multipliers, and the combination with the lowest error is
+   kept. */
+void encodeEacBlock(const UnsignedByte(&values)[16], const bool elevenBit, char* const out) {
+    /* The error is calculated in the output precision. The 11-bit variant
+       scales the base and the multiplier by 8 and offsets the base by 4,
+       a zero multiplier there means the modifiers are used unscaled. */
+    const Int scale = elevenBit ? 8 : 1;
+    const Int offset = elevenBit ? 4 : 0;
+    const Int limit = elevenBit ? 2047 : 255;
+    const Int minMultiplier = elevenBit ? 0 : 1;
+
+    Int targets[16];
+    Int min = limit;
+    Int max = 0;
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        targets[i] = elevenBit ? (values[i]*2047 + 127)/255 : values[i];
+        min = Math::min(min, targets[i]);
+        max = Math::max(max, targets[i]);
+    }
+
+    UnsignedLong bits = 0;
+    UnsignedInt bestError = ~UnsignedInt{};
+    for(UnsignedInt table = 0; table != 16; ++table) {
+        const Int* const modifiers = EacModifiers[table];
+        const Int tableMin = modifiers[3];
+        const Int tableMax = modifiers[7];
+        const Int tableRange = tableMax - tableMin;
+        const Int multiplier = ((max - min)/scale + tableRange/2)/tableRange;
+
+        for(Int m = Math::max(multiplier - 1, minMultiplier), mEnd = Math::min(multiplier + 1, 15); m <= mEnd; ++m) {
+            const Int step = m ? m*scale : 1;
+            const Int base = Math::clamp(((min + max)/2 - offset - (tableMin + tableMax)*step/2 + scale/2)/scale, 0, 255);
+
+            Int palette[8];
+            for(UnsignedInt j = 0; j != 8; ++j)
+                palette[j] = Math::clamp(base*scale + offset + modifiers[j]*step, 0, limit);
+
+            UnsignedLong candidateBits = (UnsignedLong(base) << 56)|
+                                         (UnsignedLong(m) << 52)|
+                                         (UnsignedLong(table) << 48);
+            UnsignedInt error = 0;
+            for(UnsignedInt i = 0; i != 16; ++i) {
+                UnsignedInt best = 0;
+                Int bestPixelError = Math::abs(targets[i] - palette[0]);
+                for(UnsignedInt j = 1; j != 8; ++j) {
+                    const Int e = Math::abs(targets[i] - palette[j]);
+                    if(e < bestPixelError) {
+                        best = j;
+                        bestPixelError = e;
+                    }
+                }
+
+                /* Pixels are in column-major order, the first in the most
+                   significant bits */
+                candidateBits |= UnsignedLong(best) << (45 - 3*((i%4)*4 + i/4));
+                error += bestPixelError*bestPixelError;
+            }
+
+            if(error < bestError) {
+                bestError = error;
+                bits = candidateBits;
+            }
+        }
+    }
+
+    /* Stored as big endian */
+    for(UnsignedInt i = 0; i != 8; ++i)
+        out[i] = char((bits >> (56 - 8*i)) & 0xff);
+}
+
+/* Interpolation weights of the four-bit BC7 indices, out of 64 */
+constexpr Int Bc7Weights[]{0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+/* Quantizes an endpoint to the seven bits per channel and a shared p-bit of
+   BC7 mode 6, picking the p-bit with the lower error. The result is the
+   endpoint expanded back to eight bits, i.e. with the p-bit in the LSB. */
+Vector4i quantizeBc7Mode6Endpoint(const Vector4& endpoint) {
+    Vector4i out;
+    Float bestError = Constants::inf();
+    for(Int p = 0; p != 2; ++p) {
+        Vector4i candidate;
+        Float error = 0.0f;
+        for(UnsignedInt i = 0; i != 4; ++i) {
+            candidate[i] = Math::clamp(Int(Math::round((endpoint[i] - Float(p))*0.5f)), 0, 127)*2 + p;
+            const Float d = endpoint[i] - Float(candidate[i]);
+            error += d*d;
+        }
+
+        if(error < bestError) {
+            bestError = error;
+            out = candidate;
+        }
+    }
+
+    return out;
+}
+
+/* Assigns the nearest of the 16 interpolated colors to each pixel, returns
+   the total squared error */
+UnsignedInt assignBc7Mode6Indices(const Vector4i(&pixels)[16], const Vector4i& color0, const Vector4i& color1, UnsignedByte(&indices)[16]) {
+    Vector4i palette[16];
+    for(UnsignedInt i = 0; i != 16; ++i)
+        palette[i] = (color0*(64 - Bc7Weights[i]) + color1*Bc7Weights[i] + Vector4i{32})/64;
+
+    UnsignedInt error = 0;
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        UnsignedInt bestPixelError = ~UnsignedInt{};
+        for(UnsignedInt j = 0; j != 16; ++j) {
+            const Vector4i d = pixels[i] - palette[j];
+            const UnsignedInt e = Math::dot(d, d);
+            if(e < bestPixelError) {
+                indices[i] = j;
+                bestPixelError = e;
+            }
+        }
+        error += bestPixelError;
+    }
+
+    return error;
+}
+
+/* Appends `count` lowest bits of `value` to a 128-bit little-endian block */
+void appendBits(UnsignedLong(&bits)[2], UnsignedInt& offset, const UnsignedLong value, const UnsignedInt count) {
+    bits[offset/64] |= value << (offset % 64);
+    if(offset % 64 + count > 64)
+        bits[offset/64 + 1] |= value >> (64 - offset % 64);
+    offset += count;
+}
+
+/* BC7 block in mode 6, i.e. a single RGBA subset with seven-bit endpoints,
+   a p-bit for each and four-bit indices. Endpoints are picked along the
+   principal axis of the pixels, quantized and then refined with a
+   least-squares fit to the assigned indices. */
+void encodeBc7Mode6Block(const Vector4i(&pixels)[16], char* const out) {
+    Vector4 mean;
+    Vector4 min{255.0f};
+    Vector4 max{0.0f};
+    for(const Vector4i& pixel: pixels) {
+        const Vector4 p{pixel};
+        mean += p;
+        min = Math::min(min, p);
+        max = Math::max(max, p);
+    }
+    mean /= 16.0f;
+
+    Matrix4 covariance{Math::ZeroInit};
+    for(const Vector4i& pixel: pixels) {
+        const Vector4 d = Vector4{pixel} - mean;
+        for(UnsignedInt col = 0; col != 4; ++col)
+            for(UnsignedInt row = 0; row != 4; ++row)
+                covariance[col][row] += d[col]*d[row];
+    }
+
+    /* Same as in principalAxisEndpoints(), just in four dimensions */
+    Vector4 axis = max - min;
+    for(UnsignedInt i = 0; i != 4; ++i) {
+        axis = covariance*axis;
+        const Float length = Math::abs(axis).max();
+        if(length == 0.0f) break;
+        axis /= length;
+    }
+
+    Vector4 a, b;
+    Float minProjection = Constants::inf();
+    Float maxProjection = -Constants::inf();
+    for(const Vector4i& pixel: pixels) {
+        const Vector4 p{pixel};
+        const Float projection = Math::dot(p, axis);
+        if(projection < minProjection) {
+            minProjection = projection;
+            a = p;
+        }
+        if(projection > maxProjection) {
+            maxProjection = projection;
+            b = p;
+        }
+    }
+
+    Vector4i color0 = quantizeBc7Mode6Endpoint(a);
+    Vector4i color1 = quantizeBc7Mode6Endpoint(b);
+    UnsignedByte indices[16];
+    UnsignedInt error = assignBc7Mode6Indices(pixels, color0, color1, indices);
+
+    /* Refine the endpoints to fit the assigned indices, keep them if
+       better. Like in leastSquaresEndpoints(), just with the BC7 weights. */
+    if(error) {
+        Float aa{}, ab{}, bb{};
+        Vector4 ax, bx;
+        for(UnsignedInt i = 0; i != 16; ++i) {
+            const Float beta = Bc7Weights[indices[i]]/64.0f;
+            const Float alpha = 1.0f - beta;
+            aa += alpha*alpha;
+            ab += alpha*beta;
+            bb += beta*beta;
+            ax += alpha*Vector4{pixels[i]};
+            bx += beta*Vector4{pixels[i]};
+        }
+
+        const Float determinant = aa*bb - ab*ab;
+        if(Math::abs(determinant) >= 1.0e-6f) {
+            const Vector4i refined0 = quantizeBc7Mode6Endpoint((ax*bb - bx*ab)/determinant);
+            const Vector4i refined1 = quantizeBc7Mode6Endpoint((bx*aa - ax*ab)/determinant);
+            UnsignedByte refinedIndices[16];
+            const UnsignedInt refinedError = assignBc7Mode6Indices(pixels, refined0, refined1, refinedIndices);
+            if(refinedError < error) {
+                color0 = refined0;
+                color1 = refined1;
+                for(UnsignedInt i = 0; i != 16; ++i)
+                    indices[i] = refinedIndices[i];
+            }
+        }
+    }
+
+    /* The first index is stored with its highest bit implicitly zero, swap
+       the endpoints and invert the indices if it's not */
+    if(indices[0] & 8) {
+        Utility::swap(color0, color1);
+        for(UnsignedByte& i: indices)
+            i = 15 - i;
+    }
+
+    /* Mode 6 is denoted by six zero bits followed by a one, then the
+       endpoint channels are stored interleaved, followed by the p-bits and
+       indices */
+    UnsignedLong bits[2]{};
+    UnsignedInt offset = 0;
+    appendBits(bits, offset, 1 << 6, 7);
+    for(UnsignedInt i = 0; i != 4; ++i) {
+        appendBits(bits, offset, color0[i] >> 1, 7);
+        appendBits(bits, offset, color1[i] >> 1, 7);
+    }
+    appendBits(bits, offset, color0[0] & 1, 1);
+    appendBits(bits, offset, color1[0] & 1, 1);
+    for(UnsignedInt i = 0; i != 16; ++i)
+        appendBits(bits, offset, indices[i], i ? 4 : 3);
+    CORRADE_INTERNAL_ASSERT(offset == 128);
+
+    for(UnsignedInt i = 0; i != 16; ++i)
+        out[i] = char((bits[i/8] >> 8*(i % 8)) & 0xff);
+}
+
+struct State {
+    BlockType type;
+    std::size_t blockSize;
+    std::size_t blockCountX;
+    Containers::StridedArrayView3D<const char> pixels;
+    char* output;
+};
+
+/* Compresses a single row of blocks */
+void compressBlockRow(void* const state, const std::size_t blockY) {
+    const State& s = *static_cast<const State*>(state);
+    const std::size_t channelCount = s.pixels.size()[2];
+    const std::size_t lastY = s.pixels.size()[0] - 1;
+    const std::size_t lastX = s.pixels.size()[1] - 1;
+
+    for(std::size_t blockX = 0; blockX != s.blockCountX; ++blockX) {
+        /* Gather the block, clamping to the image edge. Channels that aren't
+           in the input are opaque. */
+        UnsignedByte block[16][4];
+        for(std::size_t y = 0; y != 4; ++y) {
+            const Containers::StridedArrayView2D<const char> row = s.pixels[std::min(blockY*4 + y, lastY)];
+            for(std::size_t x = 0; x != 4; ++x) {
+                const Containers::StridedArrayView1D<const char> pixel = row[std::min(blockX*4 + x, lastX)];
+                UnsignedByte* const out = block[y*4 + x];
+                out[3] = 255;
+                for(std::size_t i = 0; i != channelCount; ++i)
+                    out[i] = pixel[i];
+            }
+        }
+
+        char* const out = s.output + (blockY*s.blockCountX + blockX)*s.blockSize;
+
+        /* Single-channel blocks, red and green for BC4, BC5, EAC R11 and
+           RG11, alpha for BC3 and ETC2 with alpha */
+        std::size_t first = 0;
+        std::size_t count = 0;
+        if(s.type == BlockType::Bc4 || s.type == BlockType::EacR11)
+            count = 1;
+        else if(s.type == BlockType::Bc5 || s.type == BlockType::EacRG11)
+            count = 2;
+        else if(s.type == BlockType::Bc3 || s.type == BlockType::Etc2Eac) {
+            first = 3;
+            count = 1;
+        }
+        for(std::size_t c = 0; c != count; ++c) {
+            UnsignedByte values[16];
+            for(std::size_t i = 0; i != 16; ++i)
+                values[i] = block[i][first + c];
+            if(s.type == BlockType::Bc3 || s.type == BlockType::Bc4 || s.type == BlockType::Bc5)
+                encodeSingleChannelBlock(values, out + c*8);
+            else
+                encodeEacBlock(values, s.type != BlockType::Etc2Eac, out + c*8);
+        }
+
+        if(s.type == BlockType::Bc1 || s.type == BlockType::Bc1Alpha || s.type == BlockType::Bc3) {
+            Vector3 pixels[16];
+            UnsignedShort mask = 0;
+            for(std::size_t i = 0; i != 16; ++i) {
+                pixels[i] = Vector3{Float(block[i][0]), Float(block[i][1]), Float(block[i][2])};
+                if(s.type != BlockType::Bc1Alpha || block[i][3] >= 128)
+                    mask |= 1 << i;
+            }
+
+            writeColorBlock(encodeColorBlock(pixels, mask, mask != 0xffff), out + (s.type == BlockType::Bc3 ? 8 : 0));
+
+        } else if(s.type == BlockType::Etc2 || s.type == BlockType::Etc2Eac) {
+            Vector3i pixels[16];
+            for(std::size_t i = 0; i != 16; ++i)
+                pixels[i] = Vector3i{block[i][0], block[i][1], block[i][2]};
+
+            encodeEtcColorBlock(pixels, out + (s.type == BlockType::Etc2Eac ? 8 : 0));
+
+        } else if(s.type == BlockType::Bc7) {
+            Vector4i pixels[16];
+            for(std::size_t i = 0; i != 16; ++i)
+                pixels[i] = Vector4i{block[i][0], block[i][1], block[i][2], block[i][3]};
+
+            encodeBc7Mode6Block(pixels, out);
+        }
+    }
+}
+
+}
+
+CompressedImage2D compressBlocks(const ImageView2D& image, const CompressedPixelFormat format) {
+    return compressBlocks(image, format, parallelForSerial, nullptr);
+}
+
+CompressedImage2D compressBlocks(const ImageView2D& image, const CompressedPixelFormat format, const ParallelFor parallelFor, void* const parallelForState) {
+    CORRADE_ASSERT(image.size().product(),
+        "TextureTools::compressBlocks(): expected a non-empty image, got" << Debug::packed << image.size(), {});
+
+    BlockType type;
+    bool formatMatches;
+    switch(format) {
+        case CompressedPixelFormat::Bc1RGBUnorm:
+            type = BlockType::Bc1;
+            formatMatches = image.format() == PixelFormat::RGB8Unorm || image.format() == PixelFormat::RGBA8Unorm;
+            break;
+        case CompressedPixelFormat::Bc1RGBSrgb:
+            type = BlockType::Bc1;
+            formatMatches = image.format() == PixelFormat::RGB8Srgb || image.format() == PixelFormat::RGBA8Srgb;
+            break;
+        case CompressedPixelFormat::Bc1RGBAUnorm:
+            type = BlockType::Bc1Alpha;
+            formatMatches = image.format() == PixelFormat::RGBA8Unorm;
+            break;
+        case CompressedPixelFormat::Bc1RGBASrgb:
+            type = BlockType::Bc1Alpha;
+            formatMatches = image.format() == PixelFormat::RGBA8Srgb;
+            break;
+        case CompressedPixelFormat::Bc3RGBAUnorm:
+            type = BlockType::Bc3;
+            formatMatches = image.format() == PixelFormat::RGBA8Unorm;
+            break;
+        case CompressedPixelFormat::Bc3RGBASrgb:
+            type = BlockType::Bc3;
+            formatMatches = image.format() == PixelFormat::RGBA8Srgb;
+            break;
+        case CompressedPixelFormat::Bc4RUnorm:
+            type = BlockType::Bc4;
+            formatMatches = image.format() == PixelFormat::R8Unorm;
+            break;
+        case CompressedPixelFormat::Bc5RGUnorm:
+            type = BlockType::Bc5;
+            formatMatches = image.format() == PixelFormat::RG8Unorm;
+            break;
+        case CompressedPixelFormat::Bc7RGBAUnorm:
+            type = BlockType::Bc7;
+            formatMatches = image.format() == PixelFormat::RGB8Unorm || image.format() == PixelFormat::RGBA8Unorm;
+            break;
+        case CompressedPixelFormat::Bc7RGBASrgb:
+            type = BlockType::Bc7;
+            formatMatches = image.format() == PixelFormat::RGB8Srgb || image.format() == PixelFormat::RGBA8Srgb;
+            break;
+        case CompressedPixelFormat::Etc2RGB8Unorm:
+            type = BlockType::Etc2;
+            formatMatches = image.format() == PixelFormat::RGB8Unorm || image.format() == PixelFormat::RGBA8Unorm;
+            break;
+        case CompressedPixelFormat::Etc2RGB8Srgb:
+            type = BlockType::Etc2;
+            formatMatches = image.format() == PixelFormat::RGB8Srgb || image.format() == PixelFormat::RGBA8Srgb;
+            break;
+        case CompressedPixelFormat::Etc2RGBA8Unorm:
+            type = BlockType::Etc2Eac;
+            formatMatches = image.format() == PixelFormat::RGBA8Unorm;
+            break;
+        case CompressedPixelFormat::Etc2RGBA8Srgb:
+            type = BlockType::Etc2Eac;
+            formatMatches = image.format() == PixelFormat::RGBA8Srgb;
+            break;
+        case CompressedPixelFormat::EacR11Unorm:
+            type = BlockType::EacR11;
+            formatMatches = image.format() == PixelFormat::R8Unorm;
+            break;
+        case CompressedPixelFormat::EacRG11Unorm:
+            type = BlockType::EacRG11;
+            formatMatches = image.format() == PixelFormat::RG8Unorm;
+            break;
+        default:
+            CORRADE_ASSERT_UNREACHABLE("TextureTools::compressBlocks(): unsupported format" << format, {});
+    }
+    CORRADE_ASSERT(formatMatches,
+        "TextureTools::compressBlocks():" << image.format() << "can't be compressed to" << format, {});
+    #if defined(CORRADE_NO_ASSERT) || defined(CORRADE_STANDARD_ASSERT)
+    static_cast<void>(formatMatches);
+    #endif
+
+    const std::size_t blockSize = type == BlockType::Bc3 || type == BlockType::Bc5 || type == BlockType::Etc2Eac || type == BlockType::EacRG11 || type == BlockType::Bc7 ? 16 : 8;
+    const Vector2i blockCount = (image.size() + Vector2i{3})/4;
+    Containers::Array<char> data{NoInit, std::size_t(blockCount.product())*blockSize};
+
+    State state{type, blockSize, std::size_t(blockCount.x()), image.pixels(), data.data()};
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, blockCount.y(), compressBlockRow, &state);
+
+    return CompressedImage2D{format, image.size(), Utility::move(data)};
+}
+
+}}
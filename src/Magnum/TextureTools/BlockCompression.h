@@ -0,0 +1,137 @@
+#ifndef Magnum_TextureTools_BlockCompression_h
+#define Magnum_TextureTools_BlockCompression_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::compressBlocks()
+ * @m_since_latest
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/Parallel.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Compress an image to a block-compressed format
+@param image    Input image
+@param format   Output format
+@m_since_latest
+
+The @p image is expected to be non-empty and have a format matching @p format:
+
+-   @ref PixelFormat::RGB8Unorm or @relativeref{PixelFormat,RGBA8Unorm} for
+    @ref CompressedPixelFormat::Bc1RGBUnorm, alpha is ignored
+-   @ref PixelFormat::RGB8Srgb or @relativeref{PixelFormat,RGBA8Srgb} for
+    @ref CompressedPixelFormat::Bc1RGBSrgb, alpha is ignored
+-   @ref PixelFormat::RGBA8Unorm for
+    @ref CompressedPixelFormat::Bc1RGBAUnorm and
+    @relativeref{CompressedPixelFormat,Bc3RGBAUnorm}
+-   @ref PixelFormat::RGBA8Srgb for
+    @ref CompressedPixelFormat::Bc1RGBASrgb and
+    @relativeref{CompressedPixelFormat,Bc3RGBASrgb}
+-   @ref PixelFormat::R8Unorm for @ref CompressedPixelFormat::Bc4RUnorm and
+    @relativeref{CompressedPixelFormat,EacR11Unorm}
+-   @ref PixelFormat::RG8Unorm for @ref CompressedPixelFormat::Bc5RGUnorm and
+    @relativeref{CompressedPixelFormat,EacRG11Unorm}
+-   @ref PixelFormat::RGB8Unorm or @relativeref{PixelFormat,RGBA8Unorm} for
+    @ref CompressedPixelFormat::Etc2RGB8Unorm, alpha is ignored
+-   @ref PixelFormat::RGB8Srgb or @relativeref{PixelFormat,RGBA8Srgb} for
+    @ref CompressedPixelFormat::Etc2RGB8Srgb, alpha is ignored
+-   @ref PixelFormat::RGBA8Unorm for
+    @ref CompressedPixelFormat::Etc2RGBA8Unorm
+-   @ref PixelFormat::RGBA8Srgb for @ref CompressedPixelFormat::Etc2RGBA8Srgb
+-   @ref PixelFormat::RGB8Unorm or @relativeref{PixelFormat,RGBA8Unorm} for
+    @ref CompressedPixelFormat::Bc7RGBAUnorm, alpha is @cpp 255 @ce if not
+    present
+-   @ref PixelFormat::RGB8Srgb or @relativeref{PixelFormat,RGBA8Srgb} for
+    @ref CompressedPixelFormat::Bc7RGBASrgb, alpha is @cpp 255 @ce if not
+    present
+
+Each 4x4 block is encoded independently. Color endpoints are picked along
+the principal axis of the block colors and then refined with a least-squares
+fit to the assigned palette indices, keeping whichever of the two has a lower
+error. Single-channel blocks use the channel minimum and maximum as
+endpoints. For @ref CompressedPixelFormat::Bc1RGBAUnorm and
+@relativeref{CompressedPixelFormat,Bc1RGBASrgb}, blocks having any pixels
+with alpha below @cpp 128 @ce are encoded in the three-color mode with such
+pixels made fully transparent. For sRGB formats the endpoints are calculated
+on the sRGB-encoded values.
+
+ETC2 color blocks are encoded using only the individual and differential
+modes that ETC2 shares with ETC1, trying both subblock orientations with the
+subblock average as the base color and picking the modifier tables and mode
+with the lowest error. The T, H and planar modes aren't used. EAC blocks, for
+the alpha of @ref CompressedPixelFormat::Etc2RGBA8Unorm /
+@relativeref{CompressedPixelFormat,Etc2RGBA8Srgb} as well as for
+@relativeref{CompressedPixelFormat,EacR11Unorm} and
+@relativeref{CompressedPixelFormat,EacRG11Unorm}, pick for each modifier table
+a multiplier and a base covering the value range and keep the combination
+with the lowest error. The signed EAC formats and
+@relativeref{CompressedPixelFormat,Etc2RGB8A1Unorm} /
+@relativeref{CompressedPixelFormat,Etc2RGB8A1Srgb} with a punch-through alpha
+aren't supported.
+
+BC7 blocks are always encoded in mode 6, i.e. with a single RGBA subset,
+seven-bit endpoints with a p-bit each and four-bit indices. The endpoints are
+picked along the principal axis of the block colors including alpha, with the
+p-bit chosen for each endpoint to minimize the quantization error, and
+refined with a least-squares fit the same way as for BC1. The remaining
+modes, with multiple subsets or separate color and alpha, aren't used.
+@relativeref{CompressedPixelFormat,Bc6hRGBUfloat} and
+@relativeref{CompressedPixelFormat,Bc6hRGBSfloat} aren't supported.
+
+If the image size isn't a multiple of the block size, the edge blocks are
+padded by repeating the last row and column. The output has the same size
+as @p image and a default @ref CompressedPixelStorage.
+
+This overload processes everything serially on the calling thread, use
+@ref compressBlocks(const ImageView2D&, CompressedPixelFormat, ParallelFor, void*)
+to spread the work across multiple threads.
+@see @ref Trade::BcnImageConverter
+*/
+MAGNUM_TEXTURETOOLS_EXPORT CompressedImage2D compressBlocks(const ImageView2D& image, CompressedPixelFormat format);
+
+/**
+@brief Compress an image to a block-compressed format using a parallel executor
+@param image            Input image
+@param format           Output format
+@param parallelFor      Parallel loop executor or @cpp nullptr @ce
+@param parallelForState State pointer passed to @p parallelFor
+@m_since_latest
+
+Same as @ref compressBlocks(const ImageView2D&, CompressedPixelFormat), but
+with the work split into tasks by block rows and executed through
+@p parallelFor. The output is the same regardless of how the tasks get
+executed.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT CompressedImage2D compressBlocks(const ImageView2D& image, CompressedPixelFormat format, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+}}
+
+#endif
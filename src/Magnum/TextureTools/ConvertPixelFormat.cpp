@@ -0,0 +1,319 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ConvertPixelFormat.h"
+
+#include <cmath>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/ColorBatch.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/PackingBatch.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* Rough count of pixels processed by a single task, so narrow images don't
+   get split into too many tiny tasks */
+constexpr std::size_t PixelsPerTask = 16384;
+
+enum class ChannelType: UnsignedByte {
+    Unsupported,
+    UnsignedNormalized8,
+    Normalized8,
+    UnsignedNormalized16,
+    Normalized16,
+    Srgb8,
+    Half,
+    Float
+};
+
+ChannelType channelType(const PixelFormat format) {
+    if(isPixelFormatImplementationSpecific(format) || isPixelFormatDepthOrStencil(format))
+        return ChannelType::Unsupported;
+
+    switch(pixelFormatChannelFormat(format)) {
+        case PixelFormat::R8Unorm: return ChannelType::UnsignedNormalized8;
+        case PixelFormat::R8Snorm: return ChannelType::Normalized8;
+        case PixelFormat::R16Unorm: return ChannelType::UnsignedNormalized16;
+        case PixelFormat::R16Snorm: return ChannelType::Normalized16;
+        case PixelFormat::R8Srgb: return ChannelType::Srgb8;
+        case PixelFormat::R16F: return ChannelType::Half;
+        case PixelFormat::R32F: return ChannelType::Float;
+        default: return ChannelType::Unsupported;
+    }
+}
+
+bool isSwizzleValid(const Containers::StringView swizzle, const std::size_t channelCount) {
+    if(!swizzle.isEmpty() && swizzle.size() != channelCount)
+        return false;
+    for(const char c: swizzle)
+        if(c != 'r' && c != 'g' && c != 'b' && c != 'a' && c != '0' && c != '1')
+            return false;
+    return true;
+}
+
+Float srgbToLinear(const Float value) {
+    return value <= 0.04045f ? value/12.92f : std::pow((value + 0.055f)/1.055f, 2.4f);
+}
+
+Float linearToSrgb(const Float value) {
+    return value <= 0.0031308f ? value*12.92f : 1.055f*std::pow(value, 1.0f/2.4f) - 0.055f;
+}
+
+struct State {
+    ChannelType srcType, dstType;
+    std::size_t srcChannelCount, dstChannelCount;
+    std::size_t rowsPerTask;
+    /* Input channel index for each output channel or -1 if it's a constant,
+       in which case it's taken from swizzleConstants */
+    Int swizzle[4];
+    Float swizzleConstants[4];
+    /* If set, the output channels are the same as the first input channels
+       and the swizzle step can be skipped */
+    bool swizzleIdentity;
+    Containers::StridedArrayView3D<const char> src;
+    Containers::StridedArrayView3D<char> dst;
+    Float srgbToLinearTable[256];
+};
+
+/* Views a single row of pixels as a [pixel][channel] view of given type */
+template<class T, class U> Containers::StridedArrayView2D<T> channels(const Containers::StridedArrayView3D<U>& row) {
+    return Containers::arrayCast<T>(row.every({1, 1, sizeof(T)}))[0];
+}
+
+/* Views a row of scratch RGBA pixels as a [pixel][channel] view */
+Containers::StridedArrayView2D<Float> channels(const Containers::ArrayView<Color4> pixels, const std::size_t channelCount) {
+    return Containers::arrayCast<2, Float>(Containers::stridedArrayView(pixels)).prefix({pixels.size(), channelCount});
+}
+
+void clampChannels(const Containers::StridedArrayView2D<Float>& channels, const Float min, const Float max) {
+    for(const Containers::StridedArrayView1D<Float> pixel: channels)
+        for(Float& channel: pixel)
+            channel = Math::clamp(channel, min, max);
+}
+
+/* Decodes a row to linear floats, only the first srcChannelCount channels
+   of each dst pixel are written */
+void decodeRow(const State& s, const Containers::StridedArrayView3D<const char>& src, const Containers::ArrayView<Color4> dst) {
+    const Containers::StridedArrayView2D<Float> dstChannels = channels(dst, s.srcChannelCount);
+    switch(s.srcType) {
+        case ChannelType::UnsignedNormalized8:
+            return Math::unpackInto(channels<const UnsignedByte>(src), dstChannels);
+        case ChannelType::Normalized8:
+            return Math::unpackInto(channels<const Byte>(src), dstChannels);
+        case ChannelType::UnsignedNormalized16:
+            return Math::unpackInto(channels<const UnsignedShort>(src), dstChannels);
+        case ChannelType::Normalized16:
+            return Math::unpackInto(channels<const Short>(src), dstChannels);
+        case ChannelType::Half:
+            return Math::unpackHalfInto(channels<const UnsignedShort>(src), dstChannels);
+        case ChannelType::Float:
+            return Utility::copy(channels<const Float>(src), dstChannels);
+        case ChannelType::Srgb8: {
+            /* Same as Math::fromSrgbInto() it goes through a lookup table,
+               but works for one- and two-channel formats as well. Alpha is
+               always linear. */
+            const Containers::StridedArrayView2D<const UnsignedByte> srcChannels = channels<const UnsignedByte>(src);
+            for(std::size_t i = 0; i != srcChannels.size()[0]; ++i)
+                for(std::size_t j = 0; j != s.srcChannelCount; ++j)
+                    dstChannels[i][j] = j < 3 ?
+                        s.srgbToLinearTable[srcChannels[i][j]] :
+                        Math::unpack<Float>(srcChannels[i][j]);
+        } return;
+        case ChannelType::Unsupported:
+            break;
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+void swizzleRow(const State& s, const Containers::ArrayView<const Color4> src, const Containers::ArrayView<Color4> dst) {
+    for(std::size_t i = 0; i != src.size(); ++i)
+        for(std::size_t j = 0; j != s.dstChannelCount; ++j)
+            dst[i][j] = s.swizzle[j] == -1 ?
+                s.swizzleConstants[j] : src[i][s.swizzle[j]];
+}
+
+/* Clamps and encodes first dstChannelCount channels of src pixels, the src
+   is modified in the process */
+void encodeRow(const State& s, const Containers::ArrayView<Color4> src, const Containers::StridedArrayView3D<char>& dst) {
+    const Containers::StridedArrayView2D<Float> srcChannels = channels(src, s.dstChannelCount);
+    switch(s.dstType) {
+        case ChannelType::UnsignedNormalized8:
+            clampChannels(srcChannels, 0.0f, 1.0f);
+            return Math::packInto(srcChannels, channels<UnsignedByte>(dst));
+        case ChannelType::Normalized8:
+            clampChannels(srcChannels, -1.0f, 1.0f);
+            return Math::packInto(srcChannels, channels<Byte>(dst));
+        case ChannelType::UnsignedNormalized16:
+            clampChannels(srcChannels, 0.0f, 1.0f);
+            return Math::packInto(srcChannels, channels<UnsignedShort>(dst));
+        case ChannelType::Normalized16:
+            clampChannels(srcChannels, -1.0f, 1.0f);
+            return Math::packInto(srcChannels, channels<Short>(dst));
+        case ChannelType::Half:
+            return Math::packHalfInto(srcChannels, channels<UnsignedShort>(dst));
+        case ChannelType::Float:
+            return Utility::copy(srcChannels, channels<Float>(dst));
+        case ChannelType::Srgb8: {
+            /* The batch sRGB functions clamp on their own */
+            const Containers::StridedArrayView2D<const Color4> srcPixels{src, {1, src.size()}};
+            if(s.dstChannelCount == 4)
+                return Math::toSrgbAlphaInto(srcPixels, Containers::arrayCast<2, Vector4ub>(dst));
+            if(s.dstChannelCount == 3)
+                return Math::toSrgbInto(Containers::arrayCast<const Color3>(srcPixels), Containers::arrayCast<2, Vector3ub>(dst));
+
+            /* There's no batch variant for one- and two-channel formats */
+            const Containers::StridedArrayView2D<UnsignedByte> dstChannels = channels<UnsignedByte>(dst);
+            for(std::size_t i = 0; i != dstChannels.size()[0]; ++i)
+                for(std::size_t j = 0; j != s.dstChannelCount; ++j)
+                    dstChannels[i][j] = Math::pack<UnsignedByte>(Math::clamp(linearToSrgb(Math::max(srcChannels[i][j], 0.0f)), 0.0f, 1.0f));
+        } return;
+        case ChannelType::Unsupported:
+            break;
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+void convertRows(void* const state, const std::size_t task) {
+    const State& s = *static_cast<const State*>(state);
+    const std::size_t width = s.src.size()[1];
+    const std::size_t rowBegin = task*s.rowsPerTask;
+    const std::size_t rowEnd = Math::min(rowBegin + s.rowsPerTask, s.src.size()[0]);
+
+    /* Decoded and swizzled pixels of a single row. Always with four channels
+       so the batch sRGB functions can operate on them directly. */
+    Containers::Array<Color4> scratch{NoInit, s.swizzleIdentity ? width : width*2};
+    const Containers::ArrayView<Color4> decoded = scratch.prefix(width);
+    const Containers::ArrayView<Color4> swizzled = s.swizzleIdentity ?
+        decoded : scratch.exceptPrefix(width);
+
+    for(std::size_t y = rowBegin; y != rowEnd; ++y) {
+        decodeRow(s, s.src.slice(y, y + 1), decoded);
+        if(!s.swizzleIdentity)
+            swizzleRow(s, decoded, swizzled);
+        encodeRow(s, swizzled, s.dst.slice(y, y + 1));
+    }
+}
+
+/* Assumes the formats and swizzle were already checked */
+void convert(const ImageView2D& src, const MutableImageView2D& dst, const Containers::StringView swizzle, const ParallelFor parallelFor, void* const parallelForState) {
+    const std::size_t width = src.size().x();
+    const std::size_t height = src.size().y();
+    if(!width || !height)
+        return;
+
+    State state;
+    state.srcType = channelType(src.format());
+    state.dstType = channelType(dst.format());
+    state.srcChannelCount = pixelFormatChannelCount(src.format());
+    state.dstChannelCount = pixelFormatChannelCount(dst.format());
+    state.rowsPerTask = Math::max(PixelsPerTask/width, std::size_t{1});
+    state.src = src.pixels();
+    state.dst = dst.pixels();
+
+    /* Channels not present in the input are 0 for G and B and 1 for A */
+    constexpr const char DefaultSwizzle[]{'r', 'g', 'b', 'a'};
+    state.swizzleIdentity = true;
+    for(std::size_t i = 0; i != state.dstChannelCount; ++i) {
+        const char c = swizzle.isEmpty() ? DefaultSwizzle[i] : swizzle[i];
+        Int channel = -1;
+        Float constant = 0.0f;
+        if(c == 'r') channel = 0;
+        else if(c == 'g') channel = 1;
+        else if(c == 'b') channel = 2;
+        else if(c == 'a') channel = 3;
+        else if(c == '1') constant = 1.0f;
+        if(channel >= Int(state.srcChannelCount)) {
+            if(channel == 3) constant = 1.0f;
+            channel = -1;
+        }
+
+        state.swizzle[i] = channel;
+        state.swizzleConstants[i] = constant;
+        if(channel != Int(i))
+            state.swizzleIdentity = false;
+    }
+
+    if(state.srcType == ChannelType::Srgb8) for(std::size_t i = 0; i != 256; ++i)
+        state.srgbToLinearTable[i] = srgbToLinear(Math::unpack<Float>(UnsignedByte(i)));
+
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, (height + state.rowsPerTask - 1)/state.rowsPerTask, convertRows, &state);
+}
+
+}
+
+bool isPixelFormatConvertible(const PixelFormat format) {
+    return channelType(format) != ChannelType::Unsupported;
+}
+
+Image2D convertPixelFormat(const ImageView2D& image, const PixelFormat format, const Containers::StringView swizzle) {
+    return convertPixelFormat(image, format, swizzle, parallelForSerial, nullptr);
+}
+
+Image2D convertPixelFormat(const ImageView2D& image, const PixelFormat format, const Containers::StringView swizzle, const ParallelFor parallelFor, void* const parallelForState) {
+    CORRADE_ASSERT(isPixelFormatConvertible(image.format()),
+        "TextureTools::convertPixelFormat(): unsupported input format" << image.format(), (Image2D{format}));
+    CORRADE_ASSERT(isPixelFormatConvertible(format),
+        "TextureTools::convertPixelFormat(): unsupported output format" << format, (Image2D{format}));
+    CORRADE_ASSERT(isSwizzleValid(swizzle, pixelFormatChannelCount(format)),
+        "TextureTools::convertPixelFormat(): invalid swizzle" << swizzle << "for" << format, (Image2D{format}));
+
+    const std::size_t rowStride = (image.size().x()*pixelFormatSize(format) + 3)/4*4;
+    Image2D out{format, image.size(), Containers::Array<char>{NoInit, rowStride*image.size().y()}};
+    convert(image, out, swizzle, parallelFor, parallelForState);
+    return out;
+}
+
+void convertPixelFormatInto(const ImageView2D& src, const MutableImageView2D& dst, const Containers::StringView swizzle) {
+    convertPixelFormatInto(src, dst, swizzle, parallelForSerial, nullptr);
+}
+
+void convertPixelFormatInto(const ImageView2D& src, const MutableImageView2D& dst, const Containers::StringView swizzle, const ParallelFor parallelFor, void* const parallelForState) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "TextureTools::convertPixelFormatInto(): expected output size to be" << Debug::packed << src.size() << "but got" << Debug::packed << dst.size(), );
+    CORRADE_ASSERT(isPixelFormatConvertible(src.format()),
+        "TextureTools::convertPixelFormatInto(): unsupported input format" << src.format(), );
+    CORRADE_ASSERT(isPixelFormatConvertible(dst.format()),
+        "TextureTools::convertPixelFormatInto(): unsupported output format" << dst.format(), );
+    CORRADE_ASSERT(isSwizzleValid(swizzle, pixelFormatChannelCount(dst.format())),
+        "TextureTools::convertPixelFormatInto(): invalid swizzle" << swizzle << "for" << dst.format(), );
+
+    convert(src, dst, swizzle, parallelFor, parallelForState);
+}
+
+}}
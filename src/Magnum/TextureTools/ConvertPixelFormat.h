@@ -0,0 +1,152 @@
+#ifndef Magnum_TextureTools_ConvertPixelFormat_h
+#define Magnum_TextureTools_ConvertPixelFormat_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::convertPixelFormat(), @ref Magnum::TextureTools::convertPixelFormatInto(), @ref Magnum::TextureTools::isPixelFormatConvertible()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/StringView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/Parallel.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Whether a pixel format can be used with @ref convertPixelFormat()
+@m_since_latest
+
+Returns @cpp true @ce for all one- to four-channel normalized, sRGB and
+floating-point formats, i.e. the @ref PixelFormat::R8Unorm,
+@relativeref{PixelFormat,R8Snorm}, @relativeref{PixelFormat,R8Srgb},
+@relativeref{PixelFormat,R16Unorm}, @relativeref{PixelFormat,R16Snorm},
+@relativeref{PixelFormat,R16F} and @relativeref{PixelFormat,R32F} formats
+and their two-, three- and four-channel variants, @cpp false @ce for
+integral, depth / stencil and implementation-specific formats. Any
+convertible format can be converted to any other.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT bool isPixelFormatConvertible(PixelFormat format);
+
+/**
+@brief Convert an image to a different pixel format
+@param image    Input image
+@param format   Output format
+@param swizzle  Output channel swizzle
+@m_since_latest
+
+The @p image is expected to be non-empty and both its format and @p format
+are expected to be convertible, see @ref isPixelFormatConvertible(). The
+output has the same size as @p image and a default @ref PixelStorage.
+
+All pixels are decoded to linear floating-point RGBA values, normalized
+formats to the @f$ [0, 1] @f$ or @f$ [-1, 1] @f$ range and sRGB formats with
+the color channels converted to linear, with the alpha channel staying
+linear. Channels not present in the input are filled with @cpp 0.0f @ce for
+G and B and @cpp 1.0f @ce for A. If @p swizzle is non-empty, it's expected to
+have exactly as many characters as there's channels in @p format, each
+being one of @cpp 'r' @ce, @cpp 'g' @ce, @cpp 'b' @ce, @cpp 'a' @ce,
+@cpp '0' @ce or @cpp '1' @ce, picking given output channel from given input
+channel or a constant. Empty @p swizzle is equivalent to @cpp "r" @ce,
+@cpp "rg" @ce, @cpp "rgb" @ce or @cpp "rgba" @ce based on the output channel
+count. Finally the values are clamped to the range of @p format if it's
+normalized or sRGB and encoded.
+
+The work is done row by row, with the decoding and encoding going through
+@ref Math::unpackInto(), @ref Math::packInto(), @ref Math::unpackHalfInto(),
+@ref Math::packHalfInto(), @ref Math::toSrgbInto() and
+@ref Math::toSrgbAlphaInto(), which pick a SIMD implementation at runtime
+where available. Decoding of sRGB values goes through a lookup table. Output
+to one- and two-channel sRGB formats is done without SIMD, as there's no
+batch function for those. This overload processes
+everything serially on the calling thread, use
+@ref convertPixelFormat(const ImageView2D&, PixelFormat, Containers::StringView, ParallelFor, void*)
+to spread the work across multiple threads.
+
+@snippet TextureTools.cpp convertPixelFormat
+
+@see @ref convertPixelFormatInto(), @ref Trade::PixelFormatImageConverter
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Image2D convertPixelFormat(const ImageView2D& image, PixelFormat format, Containers::StringView swizzle = {});
+
+/**
+@brief Convert an image to a different pixel format using a parallel executor
+@param image            Input image
+@param format           Output format
+@param swizzle          Output channel swizzle
+@param parallelFor      Parallel loop executor or @cpp nullptr @ce
+@param parallelForState State pointer passed to @p parallelFor
+@m_since_latest
+
+Same as @ref convertPixelFormat(const ImageView2D&, PixelFormat, Containers::StringView),
+but with the work split into tasks by rows and executed through
+@p parallelFor. The output is the same regardless of how the tasks get
+executed.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Image2D convertPixelFormat(const ImageView2D& image, PixelFormat format, Containers::StringView swizzle, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+/**
+@brief Convert an image to a different pixel format into an existing image
+@param[in]  src     Input image
+@param[out] dst     Output image
+@param[in]  swizzle Output channel swizzle
+@m_since_latest
+
+Like @ref convertPixelFormat(const ImageView2D&, PixelFormat, Containers::StringView),
+but puts the output into @p dst, which is expected to have the same size as
+@p src. Its format, as well as the format of @p src, is expected to be
+convertible, see @ref isPixelFormatConvertible(). The @p src and @p dst
+views are allowed to have arbitrary @ref PixelStorage. They aren't allowed
+to overlap.
+
+This overload processes everything serially on the calling thread, use
+@ref convertPixelFormatInto(const ImageView2D&, const MutableImageView2D&, Containers::StringView, ParallelFor, void*)
+to spread the work across multiple threads.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void convertPixelFormatInto(const ImageView2D& src, const MutableImageView2D& dst, Containers::StringView swizzle = {});
+
+/**
+@brief Convert an image to a different pixel format into an existing image using a parallel executor
+@param[in]  src              Input image
+@param[out] dst              Output image
+@param[in]  swizzle          Output channel swizzle
+@param[in]  parallelFor      Parallel loop executor or @cpp nullptr @ce
+@param[in]  parallelForState State pointer passed to @p parallelFor
+@m_since_latest
+
+Same as @ref convertPixelFormatInto(const ImageView2D&, const MutableImageView2D&, Containers::StringView),
+but with the work split into tasks by rows and executed through
+@p parallelFor. The output is the same regardless of how the tasks get
+executed.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void convertPixelFormatInto(const ImageView2D& src, const MutableImageView2D& dst, Containers::StringView swizzle, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+}}
+
+#endif
@@ -0,0 +1,155 @@
+#ifndef Magnum_TextureTools_DepthPyramidGL_h
+#define Magnum_TextureTools_DepthPyramidGL_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::TextureTools::DepthPyramidGL
+ * @m_since_latest
+ */
+
+#include "Magnum/configure.h"
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2)
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/GL/GL.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Generate a hierarchical depth pyramid using OpenGL
+@m_since_latest
+
+Builds a min/max depth mip chain, also known as Hi-Z buffer, from a depth
+texture. The pyramid is useful for GPU occlusion culling, where a bounding
+volume projected to screen is tested against the farthest depth of the
+smallest level that covers it in at most a few texels, and for screen-space
+effects such as SSAO that need a conservative depth at a coarser resolution.
+
+Level @cpp 0 @ce of the output is a copy of the input depth, each following
+level then contains the minimum of the corresponding input texels in the red
+channel and the maximum in the green channel. For odd sizes the output texel
+includes also the third input texel in given direction that's only partially
+covered by it, so the result is always conservative. With a regular depth
+range the farthest depth is the maximum, with a reverse-Z projection such as
+@ref Matrix4::perspectiveProjectionReverseZ() it's the minimum.
+
+Each level is rendered with a fragment shader that reads the previous level
+using @glsl texelFetch() @ce, similarly to @ref MipmapGL. Compared to a
+single-pass compute shader it needs a draw per level, but works on OpenGL ES
+3.0 and WebGL 2.0 as well.
+
+@attention This is a GPU-only implementation, so it expects an active GL
+    context.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default) and not on OpenGL ES 2.0
+    and WebGL 1.0. See @ref building-features for more information.
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT DepthPyramidGL {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Prepares the shader and other internal state.
+         */
+        explicit DepthPyramidGL();
+
+        /**
+         * @brief Construct without creating the internal OpenGL state
+         *
+         * The constructed instance is equivalent to moved-from state, i.e. no
+         * APIs can be safely called on the object. Useful in cases where you
+         * will overwrite the instance later anyway. Move another object over
+         * it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         * However note that this is a low-level and a potentially dangerous
+         * API, see the documentation of @ref NoCreate for alternatives.
+         */
+        explicit DepthPyramidGL(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        DepthPyramidGL(const DepthPyramidGL&) = delete;
+
+        /**
+         * @brief Move constructor
+         *
+         * Performs a destructive move, i.e. the original object isn't usable
+         * afterwards anymore.
+         */
+        DepthPyramidGL(DepthPyramidGL&&) noexcept;
+
+        ~DepthPyramidGL();
+
+        /** @brief Copying is not allowed */
+        DepthPyramidGL& operator=(const DepthPyramidGL&) = delete;
+
+        /** @brief Move assignment */
+        DepthPyramidGL& operator=(DepthPyramidGL&&) noexcept;
+
+        /**
+         * @brief Generate a depth pyramid
+         * @param depth         Input depth texture
+         * @param size          Size of the input texture
+         * @param output        Output texture
+         * @param levelCount    Count of output levels to fill
+         *
+         * Fills levels @cpp 0 @ce to @cpp levelCount - 1 @ce of @p output
+         * from level @cpp 0 @ce of @p depth. The @p depth texture is
+         * expected to be complete, have a depth format such as
+         * @ref GL::TextureFormat::DepthComponent32F and no depth comparison
+         * mode set. The @p output is expected to have storage for at least
+         * @p levelCount levels allocated with a size of @p size and a
+         * @ref GL::TextureFormat::RG32F format, which on OpenGL ES and WebGL
+         * requires @gl_extension{EXT,color_buffer_float} for rendering to it.
+         * The @p levelCount is expected to be at least @cpp 1 @ce and not
+         * larger than the level count implied by @p size. Level @cpp i @ce
+         * has a size of @cpp size >> i @ce, but at least @cpp 1 @ce.
+         *
+         * Base and max level of @p output is modified during the operation
+         * and reset to @cpp 0 @ce and @cpp 1000 @ce, which are the defaults,
+         * at the end. Temporary framebuffers are used for rendering each
+         * level, so the previously bound framebuffer has to be bound again
+         * afterwards.
+         */
+        void operator()(GL::Texture2D& depth, const Vector2i& size, GL::Texture2D& output, Int levelCount);
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+#else
+#error this header is available only in the desktop OpenGL, OpenGL ES 3.0+ and WebGL 2.0 builds
+#endif
+
+#endif
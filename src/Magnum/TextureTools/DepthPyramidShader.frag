@@ -0,0 +1,71 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifdef EXPLICIT_BINDING
+layout(binding = 7)
+#endif
+uniform highp sampler2D textureData;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 0)
+#endif
+uniform highp ivec2 inputSize;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 1)
+#endif
+uniform lowp int copyDepth;
+
+out highp vec2 fragmentDepth;
+
+void main() {
+    highp ivec2 outputPosition = ivec2(gl_FragCoord.xy);
+
+    /* The first level is a plain copy of the depth, which is in the red
+       channel of a depth texture */
+    if(copyDepth != 0) {
+        highp float depth = texelFetch(textureData, outputPosition, 0).r;
+        fragmentDepth = vec2(depth, depth);
+        return;
+    }
+
+    /* For an odd input size the output pixel i partially covers also the
+       input pixel 2i + 2, include it to stay conservative. Taps are clamped
+       to the edge, which for a size of 1 makes them all read the same pixel.
+       The sampler is expected to have base and max level set to the level
+       being reduced, so fetching from level 0 of it. */
+    highp ivec2 base = outputPosition*2;
+    highp ivec2 extent = ivec2(2) + (inputSize & ivec2(1));
+    highp vec2 minMax = texelFetch(textureData, min(base, inputSize - ivec2(1)), 0).rg;
+    for(int y = 0; y != extent.y; ++y) {
+        for(int x = 0; x != extent.x; ++x) {
+            highp vec2 value = texelFetch(textureData, min(base + ivec2(x, y), inputSize - ivec2(1)), 0).rg;
+            minMax = vec2(min(minMax.x, value.x), max(minMax.y, value.y));
+        }
+    }
+
+    fragmentDepth = minMax;
+}
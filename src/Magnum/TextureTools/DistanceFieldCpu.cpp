@@ -0,0 +1,352 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DistanceFieldCpu.h"
+
+#include <cmath>
+#include <Corrade/Cpu.h>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Vector2.h"
+
+#ifdef CORRADE_ENABLE_SSE2
+#include <Corrade/Utility/IntrinsicsSse2.h>
+#endif
+#ifdef CORRADE_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* Count of input columns processed by a single task in the first pass */
+constexpr std::size_t ColumnsPerTask = 64;
+
+/* Row index used for columns with no set pixel found yet. Far enough to
+   always get capped by the radius, close enough to not overflow when
+   doubled. */
+constexpr Int FarAway = 1 << 28;
+
+/* Returns the minimum of `minDistanceSquared` and squared distances to the
+   nearest set / unset pixels in columns [columnBegin, columnEnd), with the
+   `nearest` array offset by one to include the virtual pixels outside of the
+   image */
+typedef UnsignedInt(*MinDistanceSquaredFunction)(const UnsignedInt*, Int, Int, Int, UnsignedInt);
+
+UnsignedInt minDistanceSquaredScalar(const UnsignedInt* const nearest, const Int columnBegin, const Int columnEnd, const Int center, UnsignedInt minDistanceSquared) {
+    for(Int column = columnBegin; column != columnEnd; ++column) {
+        const Int distance = 2*column - center;
+        minDistanceSquared = Math::min(minDistanceSquared, UnsignedInt(distance*distance) + nearest[column + 1]);
+    }
+    return minDistanceSquared;
+}
+
+/* The SIMD variants process four consecutive columns at a time. The squared
+   horizontal distances are calculated incrementally, as the distance grows by
+   8 for each step, i.e. (d + 8)² = d² + 16d + 64, which avoids a 32-bit
+   multiplication that SSE2 doesn't have. The result is bit-exact with the
+   scalar variant. */
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_ENABLE_SSE2 UnsignedInt minDistanceSquaredSse2(const UnsignedInt* const nearest, Int column, const Int columnEnd, const Int center, UnsignedInt minDistanceSquared) {
+    if(columnEnd - column >= 4) {
+        /* SSE2 has only a signed 32-bit comparison, flipping the top bit
+           makes it behave like an unsigned one */
+        const __m128i bias = _mm_set1_epi32(Int(0x80000000u));
+        const Int d = 2*column - center;
+        __m128i distance = _mm_setr_epi32(d, d + 2, d + 4, d + 6);
+        __m128i distanceSquared = _mm_setr_epi32(d*d, (d + 2)*(d + 2), (d + 4)*(d + 4), (d + 6)*(d + 6));
+        __m128i min = _mm_set1_epi32(Int(minDistanceSquared ^ 0x80000000u));
+        for(; column + 4 <= columnEnd; column += 4) {
+            const __m128i candidate = _mm_xor_si128(bias, _mm_add_epi32(distanceSquared, _mm_loadu_si128(reinterpret_cast<const __m128i*>(nearest + column + 1))));
+            const __m128i less = _mm_cmplt_epi32(candidate, min);
+            min = _mm_or_si128(_mm_and_si128(less, candidate), _mm_andnot_si128(less, min));
+            distanceSquared = _mm_add_epi32(distanceSquared, _mm_add_epi32(_mm_slli_epi32(distance, 4), _mm_set1_epi32(64)));
+            distance = _mm_add_epi32(distance, _mm_set1_epi32(8));
+        }
+
+        alignas(16) UnsignedInt lanes[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), min);
+        for(const UnsignedInt lane: lanes)
+            minDistanceSquared = Math::min(minDistanceSquared, lane ^ 0x80000000u);
+    }
+
+    /* Remaining columns */
+    return minDistanceSquaredScalar(nearest, column, columnEnd, center, minDistanceSquared);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_NEON
+CORRADE_ENABLE_NEON UnsignedInt minDistanceSquaredNeon(const UnsignedInt* const nearest, Int column, const Int columnEnd, const Int center, UnsignedInt minDistanceSquared) {
+    if(columnEnd - column >= 4) {
+        /* NEON has both an unsigned minimum and a 32-bit multiply-add, so
+           the squares are calculated directly */
+        const Int d = 2*column - center;
+        const UnsignedInt initial[]{UnsignedInt(d), UnsignedInt(d + 2), UnsignedInt(d + 4), UnsignedInt(d + 6)};
+        uint32x4_t distance = vld1q_u32(initial);
+        uint32x4_t min = vdupq_n_u32(minDistanceSquared);
+        for(; column + 4 <= columnEnd; column += 4) {
+            min = vminq_u32(min, vmlaq_u32(vld1q_u32(nearest + column + 1), distance, distance));
+            distance = vaddq_u32(distance, vdupq_n_u32(8));
+        }
+
+        minDistanceSquared = Math::min(minDistanceSquared, Math::min(
+            Math::min(vgetq_lane_u32(min, 0), vgetq_lane_u32(min, 1)),
+            Math::min(vgetq_lane_u32(min, 2), vgetq_lane_u32(min, 3))));
+    }
+
+    /* Remaining columns */
+    return minDistanceSquaredScalar(nearest, column, columnEnd, center, minDistanceSquared);
+}
+#endif
+
+struct Kernels {
+    MinDistanceSquaredFunction minDistanceSquared;
+};
+
+Kernels kernelsFor(const Cpu::Features features) {
+    Kernels out{
+        minDistanceSquaredScalar
+    };
+
+    #ifdef CORRADE_ENABLE_SSE2
+    if(features & Cpu::Sse2)
+        out.minDistanceSquared = minDistanceSquaredSse2;
+    #endif
+    #ifdef CORRADE_ENABLE_NEON
+    if(features & Cpu::Neon)
+        out.minDistanceSquared = minDistanceSquaredNeon;
+    #endif
+
+    /* Silence unused variable warnings on platforms with no SIMD variant */
+    static_cast<void>(features);
+
+    return out;
+}
+
+const Kernels& kernels() {
+    /* Picked on first use, the static initialization is thread-safe */
+    static const Kernels out = kernelsFor(Cpu::runtimeFeatures());
+    return out;
+}
+
+struct State {
+    Containers::StridedArrayView2D<const UnsignedByte> input;
+    Containers::StridedArrayView2D<UnsignedByte> output;
+    Vector2i ratio;
+    Int radius;
+    /* Squared distance from the output pixel center to the nearest opposite
+       pixel is never more than this, in units of half a pixel. Equivalent to
+       the initial minDistanceSquared in the GL shader. */
+    UnsignedInt maxDistanceSquared;
+    /* For each output row and each input column, squared vertical distance
+       from the output row center to the nearest set / unset pixel in given
+       column, in units of half a pixel. Each row has an extra item on both
+       sides for the virtual unset pixels outside of the input. */
+    Containers::ArrayView<UnsignedInt> nearestSet, nearestUnset;
+    /* Picked once for the whole call instead of for every output pixel */
+    MinDistanceSquaredFunction minDistanceSquared;
+};
+
+/* Output pixel centers are aligned with input pixel corners, i.e. between
+   input pixels `i` and `i + 1`, where `i` is what this function returns for
+   given axis. Matches the `position` calculation in the GL shader. */
+inline Int centerPixel(const std::size_t outputPixel, const Int ratio) {
+    return Int(outputPixel)*ratio + ratio/2 - 1;
+}
+
+inline UnsignedInt cappedDistanceSquared(const Int distance, const Int max) {
+    const Int capped = Math::min(distance, max);
+    return capped*capped;
+}
+
+/* Sweeps a group of input columns top-down and then bottom-up, remembering
+   the last set and unset pixel in each column and calculating the distance to
+   them for every output row center */
+void verticalPass(void* const state, const std::size_t task) {
+    const State& s = *static_cast<const State*>(state);
+    const std::size_t inputHeight = s.input.size()[0];
+    const std::size_t outputHeight = s.output.size()[0];
+    const std::size_t rowStride = s.input.size()[1] + 2;
+    const std::size_t columnBegin = task*ColumnsPerTask;
+    const std::size_t columnCount = Math::min(columnBegin + ColumnsPerTask, s.input.size()[1]) - columnBegin;
+    const Int maxDistance = 2*s.radius + 1;
+
+    Int lastSet[ColumnsPerTask];
+    Int lastUnset[ColumnsPerTask];
+
+    /* Top-down. Pixels above the image are treated as unset. */
+    for(std::size_t i = 0; i != columnCount; ++i) {
+        lastSet[i] = -FarAway;
+        lastUnset[i] = -1;
+    }
+    for(std::size_t y = 0, outputRow = 0; y != inputHeight && outputRow != outputHeight; ++y) {
+        const Containers::StridedArrayView1D<const UnsignedByte> row = s.input[y].sliceSize(columnBegin, columnCount);
+        for(std::size_t i = 0; i != columnCount; ++i) {
+            const bool set = row[i] >= 128;
+            lastSet[i] = set ? Int(y) : lastSet[i];
+            lastUnset[i] = set ? lastUnset[i] : Int(y);
+        }
+
+        if(Int(y) != centerPixel(outputRow, s.ratio.y()))
+            continue;
+
+        /* The output row center is between input rows y and y + 1, i.e. at
+           2*y + 1 in units of half a pixel */
+        const Int center = 2*Int(y) + 1;
+        UnsignedInt* const nearestSet = s.nearestSet.data() + outputRow*rowStride + columnBegin + 1;
+        UnsignedInt* const nearestUnset = s.nearestUnset.data() + outputRow*rowStride + columnBegin + 1;
+        for(std::size_t i = 0; i != columnCount; ++i) {
+            nearestSet[i] = cappedDistanceSquared(center - 2*lastSet[i], maxDistance);
+            nearestUnset[i] = cappedDistanceSquared(center - 2*lastUnset[i], maxDistance);
+        }
+        ++outputRow;
+    }
+
+    /* Bottom-up. Pixels below the image are treated as unset again. */
+    for(std::size_t i = 0; i != columnCount; ++i) {
+        lastSet[i] = FarAway;
+        lastUnset[i] = Int(inputHeight);
+    }
+    for(std::size_t y = inputHeight, outputRow = outputHeight; y != 0 && outputRow != 0; --y) {
+        const Containers::StridedArrayView1D<const UnsignedByte> row = s.input[y - 1].sliceSize(columnBegin, columnCount);
+        for(std::size_t i = 0; i != columnCount; ++i) {
+            const bool set = row[i] >= 128;
+            lastSet[i] = set ? Int(y - 1) : lastSet[i];
+            lastUnset[i] = set ? lastUnset[i] : Int(y - 1);
+        }
+
+        if(Int(y - 1) != centerPixel(outputRow - 1, s.ratio.y()) + 1)
+            continue;
+
+        --outputRow;
+        const Int center = 2*Int(y - 1) - 1;
+        UnsignedInt* const nearestSet = s.nearestSet.data() + outputRow*rowStride + columnBegin + 1;
+        UnsignedInt* const nearestUnset = s.nearestUnset.data() + outputRow*rowStride + columnBegin + 1;
+        for(std::size_t i = 0; i != columnCount; ++i) {
+            nearestSet[i] = Math::min(nearestSet[i], cappedDistanceSquared(2*lastSet[i] - center, maxDistance));
+            nearestUnset[i] = Math::min(nearestUnset[i], cappedDistanceSquared(2*lastUnset[i] - center, maxDistance));
+        }
+    }
+}
+
+/* Calculates the output for a single row, combining the vertical distances
+   from the first pass with horizontal distances for pixels that are fully
+   inside or outside */
+void horizontalPass(void* const state, const std::size_t outputRow) {
+    const State& s = *static_cast<const State*>(state);
+    const Int inputWidth = Int(s.input.size()[1]);
+    const std::size_t rowStride = inputWidth + 2;
+    const Int centerRow = centerPixel(outputRow, s.ratio.y());
+    const Containers::StridedArrayView1D<const UnsignedByte> rowBelow = s.input[std::size_t(centerRow)];
+    const Containers::StridedArrayView1D<const UnsignedByte> rowAbove = s.input[std::size_t(centerRow + 1)];
+    const UnsignedInt* const nearestSet = s.nearestSet.data() + outputRow*rowStride;
+    const UnsignedInt* const nearestUnset = s.nearestUnset.data() + outputRow*rowStride;
+    const Containers::StridedArrayView1D<UnsignedByte> output = s.output[outputRow];
+
+    for(std::size_t outputColumn = 0; outputColumn != output.size(); ++outputColumn) {
+        /* See the GL shader for a detailed description of the cases */
+        const Int centerColumn = centerPixel(outputColumn, s.ratio.x());
+        const bool i = rowBelow[centerColumn] >= 128;
+        const bool j = rowBelow[centerColumn + 1] >= 128;
+        const bool k = rowAbove[centerColumn] >= 128;
+        const bool l = rowAbove[centerColumn + 1] >= 128;
+
+        Float minDistance;
+        bool isInside;
+        const Int sum = Int(i) + Int(j) + Int(k) + Int(l);
+        if(sum == 3) {
+            isInside = false;
+            minDistance = 0.0f;
+        } else if(sum == 2) {
+            isInside = false;
+            if((i && l) || (j && k))
+                minDistance = 0.0f;
+            else
+                minDistance = 0.5f;
+        } else if(sum == 1) {
+            isInside = false;
+            minDistance = 0.7071067811865475f;
+        } else {
+            isInside = sum == 4;
+            const UnsignedInt* const nearest = isInside ? nearestUnset : nearestSet;
+
+            /* Only columns less than the radius away can be closer than the
+               max distance. The nearest arrays are offset by one to include
+               the virtual pixels outside of the image. */
+            const Int center = 2*centerColumn + 1;
+            const Int columnBegin = Math::max(centerColumn - s.radius + 1, -1);
+            const Int columnEnd = Math::min(centerColumn + s.radius, inputWidth) + 1;
+            const UnsignedInt minDistanceSquared = s.minDistanceSquared(nearest, columnBegin, columnEnd, center, s.maxDistanceSquared);
+            minDistance = std::sqrt(Float(minDistanceSquared)*0.25f);
+        }
+
+        /* Final signed distance, normalized from [-radius + 0.5, radius + 0.5]
+           to [0, 1], clamped like on a write to a normalized GL texture */
+        const Float halfSign = isInside ? 0.5f : -0.5f;
+        output[outputColumn] = Math::pack<UnsignedByte>(Math::clamp(halfSign*minDistance/(Float(s.radius) + 0.5f) + 0.5f, 0.0f, 1.0f));
+    }
+}
+
+}
+
+void distanceFieldInto(const Containers::StridedArrayView2D<const UnsignedByte>& input, const Containers::StridedArrayView2D<UnsignedByte>& output, const UnsignedInt radius) {
+    distanceFieldInto(input, output, radius, parallelForSerial, nullptr);
+}
+
+void distanceFieldInto(const Containers::StridedArrayView2D<const UnsignedByte>& input, const Containers::StridedArrayView2D<UnsignedByte>& output, const UnsignedInt radius, const ParallelFor parallelFor, void* const parallelForState) {
+    const Vector2i inputSize{Int(input.size()[1]), Int(input.size()[0])};
+    const Vector2i outputSize{Int(output.size()[1]), Int(output.size()[0])};
+    /* Same requirement as in DistanceFieldGL, causing output pixel centers to
+       be aligned with input pixel corners */
+    CORRADE_ASSERT(outputSize.product() && inputSize % outputSize == Vector2i{0} &&
+                   (inputSize/outputSize) % 2 == Vector2i{0},
+        "TextureTools::distanceFieldInto(): expected input and output size ratio to be a multiple of 2, got" << Debug::packed << inputSize << "and" << Debug::packed << outputSize, );
+
+    const std::size_t rowStride = inputSize.x() + 2;
+    Containers::Array<UnsignedInt> nearestSet{NoInit, outputSize.y()*rowStride};
+    Containers::Array<UnsignedInt> nearestUnset{NoInit, outputSize.y()*rowStride};
+
+    /* Virtual pixels on the left and right of the input are unset. As output
+       row centers are always half a pixel from the nearest input row, the
+       vertical distance to them is 1 in units of half a pixel. */
+    const Int maxDistance = 2*Int(radius) + 1;
+    for(std::size_t i = 0; i != std::size_t(outputSize.y()); ++i) {
+        nearestSet[i*rowStride] = nearestSet[i*rowStride + rowStride - 1] = maxDistance*maxDistance;
+        nearestUnset[i*rowStride] = nearestUnset[i*rowStride + rowStride - 1] = 1;
+    }
+
+    State state{input, output, inputSize/outputSize, Int(radius), UnsignedInt(maxDistance*maxDistance), nearestSet, nearestUnset, kernels().minDistanceSquared};
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, (inputSize.x() + ColumnsPerTask - 1)/ColumnsPerTask, verticalPass, &state);
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, outputSize.y(), horizontalPass, &state);
+}
+
+}}
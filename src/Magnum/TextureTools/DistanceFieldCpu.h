@@ -0,0 +1,95 @@
+#ifndef Magnum_TextureTools_DistanceFieldCpu_h
+#define Magnum_TextureTools_DistanceFieldCpu_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::distanceFieldInto()
+ * @m_since_latest
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/Parallel.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Create a signed distance field on the CPU
+@param[in]  input       Input binary image
+@param[in]  output      Where to put the distance field
+@param[in]  radius      Max lookup radius in the input image
+@m_since_latest
+
+A CPU counterpart to @ref DistanceFieldGL, producing the same output without
+requiring a GPU. The @p input pixels are treated as set if their value is
+@cpp 128 @ce or more, which corresponds to the @cpp > 0.5 @ce check on a
+@ref PixelFormat::R8Unorm texture done by @ref DistanceFieldGL. The
+@p output is filled with @ref PixelFormat::R8Unorm values, with the same
+interpretation as described in @ref TextureTools-DistanceFieldGL-algorithm.
+Pass a slice of a larger image to process just a sub-rectangle of it, and for
+an input or output image with more than one channel pass just a view on its
+first channel. Pixels outside of the @p input are treated as not set.
+
+As with @ref DistanceFieldGL, the ratio of the @p input and @p output size is
+expected to be a multiple of 2, which causes output pixel centers to be
+aligned with input pixel corners. Compared to the GPU implementation, which
+looks for the nearest pixel of opposite value in an area given by @p radius
+around each output pixel, this function calculates an exact Euclidean
+distance transform in two separable passes, one going over all input columns
+and one over all output rows, which makes it scale linearly with the
+@p input size and only slightly with @p radius. The inner loop looking for
+the nearest pixel in neighboring columns processes several columns at once
+using SIMD instructions, with the implementation picked at runtime on first
+use based on instruction sets available on the CPU --- an SSE2 variant on x86
+and a NEON variant on ARM. All variants give bit-exact results.
+
+This overload processes everything serially on the calling thread, use
+@ref distanceFieldInto(const Containers::StridedArrayView2D<const UnsignedByte>&, const Containers::StridedArrayView2D<UnsignedByte>&, UnsignedInt, ParallelFor, void*)
+to spread the work across multiple threads.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void distanceFieldInto(const Containers::StridedArrayView2D<const UnsignedByte>& input, const Containers::StridedArrayView2D<UnsignedByte>& output, UnsignedInt radius);
+
+/**
+@brief Create a signed distance field on the CPU using a parallel executor
+@param[in]  input       Input binary image
+@param[in]  output      Where to put the distance field
+@param[in]  radius      Max lookup radius in the input image
+@param[in]  parallelFor Parallel loop executor or @cpp nullptr @ce
+@param[in]  parallelForState State pointer passed to @p parallelFor
+@m_since_latest
+
+Same as @ref distanceFieldInto(const Containers::StridedArrayView2D<const UnsignedByte>&, const Containers::StridedArrayView2D<UnsignedByte>&, UnsignedInt),
+but with the first pass split into tasks by groups of input columns and the
+second pass by output rows, each pass executed through @p parallelFor. The
+output is the same regardless of how the tasks get executed.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void distanceFieldInto(const Containers::StridedArrayView2D<const UnsignedByte>& input, const Containers::StridedArrayView2D<UnsignedByte>& output, UnsignedInt radius, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+}}
+
+#endif
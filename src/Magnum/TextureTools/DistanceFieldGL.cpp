@@ -26,7 +26,9 @@
 
 #include "DistanceFieldGL.h"
 
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/Resource.h>
@@ -57,7 +59,9 @@ class DistanceFieldShader: public GL::AbstractShaderProgram {
     public:
         typedef GL::Attribute<0, Vector2> Position;
 
-        explicit DistanceFieldShader(UnsignedInt radius);
+        /* If rectangles is set, the position attribute is used always
+           instead of a vertex ID-based full-screen triangle */
+        explicit DistanceFieldShader(UnsignedInt radius, bool rectangles);
 
         DistanceFieldShader& setImageSizeInverted(const Vector2& size) {
             setUniform(_imageSizeInvertedUniform, size);
@@ -79,7 +83,7 @@ class DistanceFieldShader: public GL::AbstractShaderProgram {
         Int _imageSizeInvertedUniform{0};
 };
 
-DistanceFieldShader::DistanceFieldShader(const UnsignedInt radius) {
+DistanceFieldShader::DistanceFieldShader(const UnsignedInt radius, const bool rectangles) {
     #ifdef MAGNUM_BUILD_STATIC
     /* Import resources on static build, if not already */
     if(!Utility::Resource::hasGroup("MagnumTextureTools"_s))
@@ -98,9 +102,12 @@ DistanceFieldShader::DistanceFieldShader(const UnsignedInt radius) {
     #endif
 
     GL::Shader vert{v, GL::Shader::Type::Vertex};
-    vert.addSource(rs.getString("compatibility.glsl"_s))
-        .addSource(rs.getString("FullScreenTriangle.glsl"_s))
-        .addSource(rs.getString("DistanceFieldShader.vert"_s));
+    vert.addSource(rs.getString("compatibility.glsl"_s));
+    if(rectangles)
+        vert.addSource("#define RECTANGLES\n"_s);
+    else
+        vert.addSource(rs.getString("FullScreenTriangle.glsl"_s));
+    vert.addSource(rs.getString("DistanceFieldShader.vert"_s));
 
     GL::Shader frag{v, GL::Shader::Type::Fragment};
     frag.addSource(rs.getString("compatibility.glsl"_s))
@@ -112,7 +119,7 @@ DistanceFieldShader::DistanceFieldShader(const UnsignedInt radius) {
     attachShaders({vert, frag});
 
     #ifndef MAGNUM_TARGET_GLES2
-    if(!GL::Context::current().isExtensionSupported<GL::Extensions::MAGNUM::shader_vertex_id>())
+    if(rectangles || !GL::Context::current().isExtensionSupported<GL::Extensions::MAGNUM::shader_vertex_id>())
     #endif
     {
         bindAttributeLocation(Position::Location, "position"_s);
@@ -142,11 +149,19 @@ DistanceFieldShader::DistanceFieldShader(const UnsignedInt radius) {
 }
 
 struct DistanceFieldGL::State {
-    explicit State(UnsignedInt radius): shader{radius}, radius{radius} {}
+    explicit State(UnsignedInt radius): shader{radius, false}, radius{radius} {}
 
     DistanceFieldShader shader;
     UnsignedInt radius;
     GL::Mesh mesh;
+
+    /* Used by the variant processing just a set of rectangles, created on
+       first use. The vertex array is kept around to avoid allocating it on
+       every call. */
+    Containers::Optional<DistanceFieldShader> rectangleShader;
+    GL::Buffer rectangleBuffer{NoCreate};
+    GL::Mesh rectangleMesh{NoCreate};
+    Containers::Array<Vector2> rectangleVertices;
 };
 
 DistanceFieldGL::DistanceFieldGL(const UnsignedInt radius): _state{new State{radius}} {
@@ -221,7 +236,87 @@ void DistanceFieldGL::operator()(GL::Texture2D& input, GL::Framebuffer& output,
 
 #ifndef MAGNUM_TARGET_GLES
 void DistanceFieldGL::operator()(GL::Texture2D& input, GL::Framebuffer& output, const Range2Di& rectangle) {
-    return operator()(input, output, rectangle, {});
+    return operator()(input, output, rectangle, Vector2i{});
+}
+#endif
+
+void DistanceFieldGL::operator()(GL::Texture2D& input, GL::Framebuffer& output, const Range2Di& rectangle, const Containers::ArrayView<const Range2Di> subRectangles, const Vector2i&
+    #ifdef MAGNUM_TARGET_GLES
+    imageSize
+    #endif
+) {
+    State& state = *_state;
+
+    #ifndef MAGNUM_TARGET_GLES
+    Vector2i imageSize = input.imageSize(0);
+    #endif
+
+    CORRADE_ASSERT(output.checkStatus(GL::FramebufferTarget::Draw) == GL::Framebuffer::Status::Complete,
+        "TextureTools::DistanceFieldGL: output texture format not framebuffer-drawable:" << output.checkStatus(GL::FramebufferTarget::Draw), );
+    CORRADE_ASSERT(imageSize % rectangle.size() == Vector2i{0} &&
+                   (imageSize/rectangle.size()) % 2 == Vector2i{0},
+        "TextureTools::DistanceFieldGL: expected input and output size ratio to be a multiple of 2, got" << Debug::packed << imageSize << "and" << Debug::packed << rectangle.size(), );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != subRectangles.size(); ++i) {
+        CORRADE_ASSERT((subRectangles[i].min() >= rectangle.min()).all() &&
+                       (subRectangles[i].max() <= rectangle.max()).all(),
+            "TextureTools::DistanceFieldGL: sub-rectangle" << i << Debug::packed << subRectangles[i] << "out of range for" << Debug::packed << rectangle, );
+    }
+    #endif
+
+    /* Nothing to do */
+    if(subRectangles.isEmpty())
+        return;
+
+    /* Create the rectangle variant of the shader and the mesh on first use */
+    if(!state.rectangleShader) {
+        state.rectangleShader.emplace(state.radius, true);
+        state.rectangleBuffer = GL::Buffer{};
+        state.rectangleMesh = GL::Mesh{};
+        state.rectangleMesh.setPrimitive(GL::MeshPrimitive::Triangles)
+            .addVertexBuffer(state.rectangleBuffer, 0, DistanceFieldShader::Position());
+    }
+
+    /* Two triangles for each sub-rectangle, in normalized device coordinates
+       of a viewport covering the whole rectangle. The vertex shader then
+       calculates the input texture coordinates the same way as with the
+       full-screen triangle, so each processed output pixel is the same as
+       if the whole rectangle was processed. */
+    arrayResize(state.rectangleVertices, NoInit, subRectangles.size()*6);
+    const Vector2 scale = 2.0f/Vector2{rectangle.size()};
+    for(std::size_t i = 0; i != subRectangles.size(); ++i) {
+        const Vector2 min = Vector2{subRectangles[i].min() - rectangle.min()}*scale - Vector2{1.0f};
+        const Vector2 max = Vector2{subRectangles[i].max() - rectangle.min()}*scale - Vector2{1.0f};
+        Vector2* const vertices = state.rectangleVertices + i*6;
+        vertices[0] = {min.x(), min.y()};
+        vertices[1] = {max.x(), min.y()};
+        vertices[2] = {min.x(), max.y()};
+        vertices[3] = {min.x(), max.y()};
+        vertices[4] = {max.x(), min.y()};
+        vertices[5] = {max.x(), max.y()};
+    }
+    state.rectangleBuffer.setData(state.rectangleVertices, GL::BufferUsage::StreamDraw);
+    state.rectangleMesh.setCount(state.rectangleVertices.size());
+
+    /* Save existing viewport to restore it back after */
+    const Range2Di previousViewport = output.viewport();
+
+    output
+        .setViewport(rectangle)
+        .bind();
+
+    (*state.rectangleShader)
+        .bindTexture(input)
+        .setImageSizeInverted(1.0f/Vector2(imageSize))
+        .draw(state.rectangleMesh);
+
+    /* Restore the previous viewport */
+    output.setViewport(previousViewport);
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void DistanceFieldGL::operator()(GL::Texture2D& input, GL::Framebuffer& output, const Range2Di& rectangle, const Containers::ArrayView<const Range2Di> subRectangles) {
+    return operator()(input, output, rectangle, subRectangles, Vector2i{});
 }
 #endif
 
@@ -242,7 +337,28 @@ void DistanceFieldGL::operator()(GL::Texture2D& input, GL::Texture2D& output, co
 
 #ifndef MAGNUM_TARGET_GLES
 void DistanceFieldGL::operator()(GL::Texture2D& input, GL::Texture2D& output, const Range2Di& rectangle) {
-    return operator()(input, output, rectangle, {});
+    return operator()(input, output, rectangle, Vector2i{});
+}
+#endif
+
+void DistanceFieldGL::operator()(GL::Texture2D& input, GL::Texture2D& output, const Range2Di& rectangle, const Containers::ArrayView<const Range2Di> subRectangles, const Vector2i&
+    #ifdef MAGNUM_TARGET_GLES
+    imageSize
+    #endif
+) {
+    GL::Framebuffer framebuffer{rectangle};
+    framebuffer.attachTexture(GL::Framebuffer::ColorAttachment(0), output, 0);
+
+    operator()(input, framebuffer, rectangle, subRectangles
+        #ifdef MAGNUM_TARGET_GLES
+        , imageSize
+        #endif
+        );
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void DistanceFieldGL::operator()(GL::Texture2D& input, GL::Texture2D& output, const Range2Di& rectangle, const Containers::ArrayView<const Range2Di> subRectangles) {
+    return operator()(input, output, rectangle, subRectangles, Vector2i{});
 }
 #endif
 
@@ -77,7 +77,8 @@ and Special Effects, SIGGRAPH 2007,
 http://www.valvesoftware.com/publications/2007/SIGGRAPH2007_AlphaTestedMagnification.pdf*
 
 @attention This is a GPU-only implementation, so it expects an active GL
-    context.
+    context. See @ref distanceFieldInto() for a CPU implementation giving the
+    same output.
 
 @note This function is available only if Magnum is compiled with
     @ref MAGNUM_TARGET_GL enabled (done by default). See @ref building-features
@@ -175,6 +176,41 @@ class MAGNUM_TEXTURETOOLS_EXPORT DistanceFieldGL {
         #endif
         #endif
 
+        /**
+         * @brief Calculate the distance field for a set of sub-rectangles to a framebuffer
+         * @param input         Input texture
+         * @param output        Output framebuffer
+         * @param rectangle     Rectangle in output texture corresponding to
+         *      the whole @p input
+         * @param subRectangles Parts of @p rectangle to process
+         * @param imageSize     Input texture size. Needed only for OpenGL ES,
+         *      on desktop GL the information is gathered automatically using
+         *      @ref GL::Texture2D::imageSize().
+         * @m_since_latest
+         *
+         * Like @ref operator()(GL::Texture2D&, GL::Framebuffer&, const Range2Di&, const Vector2i&),
+         * but renders only the parts of @p rectangle covered by
+         * @p subRectangles, all in a single draw. The output pixels are the
+         * same as if the whole @p rectangle was processed, pixels outside of
+         * @p subRectangles are left untouched. Useful for example for
+         * updating just a few glyphs in a large glyph cache texture. The
+         * @p subRectangles are expected to be contained in @p rectangle, if
+         * the list is empty, the function is a no-op.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        void operator()(GL::Texture2D& input, GL::Framebuffer& output, const Range2Di& rectangle, Containers::ArrayView<const Range2Di> subRectangles, const Vector2i& imageSize
+            #ifndef MAGNUM_TARGET_GLES
+            = {}
+            #endif
+        );
+        #else
+        /* To avoid having to include Vector2 */
+        void operator()(GL::Texture2D& input, GL::Framebuffer& output, const Range2Di& rectangle, Containers::ArrayView<const Range2Di> subRectangles, const Vector2i& imageSize);
+        #ifndef MAGNUM_TARGET_GLES
+        void operator()(GL::Texture2D& input, GL::Framebuffer& output, const Range2Di& rectangle, Containers::ArrayView<const Range2Di> subRectangles);
+        #endif
+        #endif
+
         /**
          * @brief Calculate the distance field to a texture
          * @param input        Input texture
@@ -201,6 +237,35 @@ class MAGNUM_TEXTURETOOLS_EXPORT DistanceFieldGL {
         #endif
         #endif
 
+        /**
+         * @brief Calculate the distance field for a set of sub-rectangles to a texture
+         * @param input         Input texture
+         * @param output        Output texture
+         * @param rectangle     Rectangle in output texture corresponding to
+         *      the whole @p input
+         * @param subRectangles Parts of @p rectangle to process
+         * @param imageSize     Input texture size. Needed only for OpenGL ES,
+         *      on desktop GL the information is gathered automatically using
+         *      @ref GL::Texture2D::imageSize().
+         * @m_since_latest
+         *
+         * Creates a framebuffer with @p output attached and calls
+         * @ref operator()(GL::Texture2D&, GL::Framebuffer&, const Range2Di&, Containers::ArrayView<const Range2Di>, const Vector2i&).
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        void operator()(GL::Texture2D& input, GL::Texture2D& output, const Range2Di& rectangle, Containers::ArrayView<const Range2Di> subRectangles, const Vector2i& imageSize
+            #ifndef MAGNUM_TARGET_GLES
+            = {}
+            #endif
+        );
+        #else
+        /* To avoid having to include Vector2 */
+        void operator()(GL::Texture2D& input, GL::Texture2D& output, const Range2Di& rectangle, Containers::ArrayView<const Range2Di> subRectangles, const Vector2i& imageSize);
+        #ifndef MAGNUM_TARGET_GLES
+        void operator()(GL::Texture2D& input, GL::Texture2D& output, const Range2Di& rectangle, Containers::ArrayView<const Range2Di> subRectangles);
+        #endif
+        #endif
+
     private:
         struct State;
         Containers::Pointer<State> _state;
@@ -33,13 +33,26 @@ layout(location = 0)
 #endif
 uniform mediump vec2 imageSizeInverted;
 
+#ifdef RECTANGLES
+/* Quads covering just the processed rectangles inside the viewport.
+   FullScreenTriangle.glsl isn't included in this case. */
+#ifndef NEW_GLSL
+#define in attribute
+#endif
+in highp vec4 position;
+#endif
+
 #ifndef NEW_GLSL
 #define out varying
 #endif
 out mediump vec2 inputTextureCoordinates;
 
 void main() {
+    #ifdef RECTANGLES
+    gl_Position = position;
+    #else
     fullScreenTriangle();
+    #endif
     #ifdef TEXELFETCH_USABLE
     inputTextureCoordinates = (gl_Position.xy*0.5 + 0.5)/imageSizeInverted;
     #else
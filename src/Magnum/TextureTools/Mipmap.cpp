@@ -0,0 +1,523 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Mipmap.h"
+
+#include <cmath>
+#include <new>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+
+namespace Magnum { namespace TextureTools {
+
+Debug& operator<<(Debug& debug, const MipmapFilter value) {
+    debug << "TextureTools::MipmapFilter" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case MipmapFilter::v: return debug << "::" #v;
+        _c(Box)
+        _c(Kaiser)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const ResizeFilter value) {
+    debug << "TextureTools::ResizeFilter" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case ResizeFilter::v: return debug << "::" #v;
+        _c(Box)
+        _c(Bilinear)
+        _c(Lanczos)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const MipmapFlag value) {
+    debug << "TextureTools::MipmapFlag" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case MipmapFlag::v: return debug << "::" #v;
+        _c(PreserveAlphaCoverage)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const MipmapFlags value) {
+    return Containers::enumSetDebugOutput(debug, value, "TextureTools::MipmapFlags{}", {
+        MipmapFlag::PreserveAlphaCoverage
+    });
+}
+
+namespace {
+
+/* Kaiser window parameters, radius in output pixels and the shape parameter.
+   Same as the defaults in NVIDIA Texture Tools. */
+constexpr Float KaiserRadius = 3.0f;
+constexpr Float KaiserAlpha = 4.0f;
+
+/* Lanczos kernel radius in output pixels */
+constexpr Float LanczosRadius = 3.0f;
+
+/* Iterations of the alpha coverage threshold search, enough to get to the
+   float precision */
+constexpr UnsignedInt AlphaCoverageIterations = 24;
+
+enum class ChannelType: UnsignedByte {
+    Unorm,
+    Srgb,
+    Float,
+    Unsupported
+};
+
+/* Modified Bessel function of the first kind of order zero, as a power
+   series */
+Float besselI0(const Float x) {
+    Float sum = 1.0f;
+    Float term = 1.0f;
+    const Float xHalfSquared = x*x*0.25f;
+    for(Int i = 1; i != 32 && term > sum*1.0e-8f; ++i) {
+        term *= xHalfSquared/Float(i*i);
+        sum += term;
+    }
+    return sum;
+}
+
+Float kaiserSinc(const Float x) {
+    if(Math::abs(x) >= KaiserRadius)
+        return 0.0f;
+
+    const Float t = x/KaiserRadius;
+    const Float window = besselI0(KaiserAlpha*std::sqrt(1.0f - t*t))/besselI0(KaiserAlpha);
+    if(x == 0.0f)
+        return window;
+    const Float piX = Constants::pi()*x;
+    return window*std::sin(piX)/piX;
+}
+
+Float triangle(const Float x) {
+    return Math::max(1.0f - Math::abs(x), 0.0f);
+}
+
+Float lanczos(const Float x) {
+    if(Math::abs(x) >= LanczosRadius)
+        return 0.0f;
+    if(x == 0.0f)
+        return 1.0f;
+    const Float piX = Constants::pi()*x;
+    return LanczosRadius*std::sin(piX)*std::sin(piX/LanczosRadius)/(piX*piX);
+}
+
+ChannelType channelType(const PixelFormat format) {
+    switch(format) {
+        case PixelFormat::R8Unorm:
+        case PixelFormat::RG8Unorm:
+        case PixelFormat::RGB8Unorm:
+        case PixelFormat::RGBA8Unorm:
+            return ChannelType::Unorm;
+        case PixelFormat::R8Srgb:
+        case PixelFormat::RG8Srgb:
+        case PixelFormat::RGB8Srgb:
+        case PixelFormat::RGBA8Srgb:
+            return ChannelType::Srgb;
+        case PixelFormat::R32F:
+        case PixelFormat::RG32F:
+        case PixelFormat::RGB32F:
+        case PixelFormat::RGBA32F:
+            return ChannelType::Float;
+        default:
+            return ChannelType::Unsupported;
+    }
+}
+
+Float srgbToLinear(const Float value) {
+    return value <= 0.04045f ? value/12.92f : std::pow((value + 0.055f)/1.055f, 2.4f);
+}
+
+Float linearToSrgb(const Float value) {
+    return value <= 0.0031308f ? value*12.92f : 1.055f*std::pow(value, 1.0f/2.4f) - 0.055f;
+}
+
+inline Float channelToLinear(const UnsignedByte value, const std::size_t channel, const Float* const srgbToLinearTable) {
+    /* Alpha is always linear */
+    return srgbToLinearTable && channel < 3 ?
+        srgbToLinearTable[value] : Math::unpack<Float>(value);
+}
+
+inline Float channelToLinear(const Float value, std::size_t, const Float*) {
+    return value;
+}
+
+inline void channelFromLinear(const Float value, const bool srgb, UnsignedByte& out) {
+    out = Math::pack<UnsignedByte>(Math::clamp(srgb ? linearToSrgb(Math::max(value, 0.0f)) : value, 0.0f, 1.0f));
+}
+
+inline void channelFromLinear(const Float value, bool, Float& out) {
+    out = value;
+}
+
+/* Converts pixels to tightly packed floats, sRGB channels to linear if the
+   table is passed */
+template<std::size_t channelCount, class T> void importPixels(const Containers::StridedArrayView2D<const Math::Vector<channelCount, T>>& src, const Float* const srgbToLinearTable, const Containers::ArrayView<Float> dst) {
+    std::size_t o = 0;
+    for(const Containers::StridedArrayView1D<const Math::Vector<channelCount, T>> row: src)
+        for(const Math::Vector<channelCount, T>& pixel: row)
+            for(std::size_t i = 0; i != channelCount; ++i)
+                dst[o++] = channelToLinear(pixel[i], i, srgbToLinearTable);
+}
+
+template<class T> void importPixels(const ImageView2D& image, const Float* const srgbToLinearTable, const Containers::ArrayView<Float> dst) {
+    switch(pixelFormatChannelCount(image.format())) {
+        case 1: return importPixels(image.pixels<Math::Vector<1, T>>(), srgbToLinearTable, dst);
+        case 2: return importPixels(image.pixels<Math::Vector<2, T>>(), srgbToLinearTable, dst);
+        case 3: return importPixels(image.pixels<Math::Vector<3, T>>(), srgbToLinearTable, dst);
+        case 4: return importPixels(image.pixels<Math::Vector<4, T>>(), srgbToLinearTable, dst);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+/* Converts tightly packed floats back to pixels, applying the alpha scale and
+   converting to sRGB if requested */
+template<std::size_t channelCount, class T> void exportPixels(const Containers::ArrayView<const Float> src, const bool srgb, const Float alphaScale, const Containers::StridedArrayView2D<Math::Vector<channelCount, T>>& dst) {
+    std::size_t o = 0;
+    for(const Containers::StridedArrayView1D<Math::Vector<channelCount, T>> row: dst)
+        for(Math::Vector<channelCount, T>& pixel: row)
+            for(std::size_t i = 0; i != channelCount; ++i) {
+                Float value = src[o++];
+                if(i == 3 && alphaScale != 1.0f)
+                    value = Math::min(value*alphaScale, 1.0f);
+                channelFromLinear(value, srgb && i < 3, pixel[i]);
+            }
+}
+
+template<class T> void exportPixels(const Containers::ArrayView<const Float> src, const bool srgb, const Float alphaScale, const MutableImageView2D& image) {
+    switch(pixelFormatChannelCount(image.format())) {
+        case 1: return exportPixels(src, srgb, alphaScale, image.pixels<Math::Vector<1, T>>());
+        case 2: return exportPixels(src, srgb, alphaScale, image.pixels<Math::Vector<2, T>>());
+        case 3: return exportPixels(src, srgb, alphaScale, image.pixels<Math::Vector<3, T>>());
+        case 4: return exportPixels(src, srgb, alphaScale, image.pixels<Math::Vector<4, T>>());
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+/* For every output pixel along one axis, `taps` input pixel indices, clamped
+   to the input range, and corresponding normalized weights */
+struct FilterWeights {
+    std::size_t taps;
+    Containers::Array<std::size_t> indices;
+    Containers::Array<Float> weights;
+};
+
+/* A null kernel means a box filter, for which the weight is the length of the
+   input pixel covered by the output pixel. Other kernels are evaluated at the
+   input pixel center, in output pixel units when downsampling and in input
+   pixel units when upsampling. */
+FilterWeights filterWeights(Float(*const kernel)(Float), const Float kernelRadius, const std::size_t inputSize, const std::size_t outputSize) {
+    /* Input pixels per output pixel and the filter radius in input pixels */
+    const Float scale = Float(inputSize)/Float(outputSize);
+    const Float kernelScale = Math::max(scale, 1.0f);
+    const Float radius = kernel ? kernelRadius*kernelScale : scale*0.5f;
+
+    FilterWeights out;
+    out.taps = std::size_t(std::ceil(2.0f*radius)) + 1;
+    out.indices = Containers::Array<std::size_t>{NoInit, outputSize*out.taps};
+    out.weights = Containers::Array<Float>{NoInit, outputSize*out.taps};
+    for(std::size_t i = 0; i != outputSize; ++i) {
+        const Float center = (Float(i) + 0.5f)*scale;
+        const Int first = Int(std::floor(center - radius));
+        std::size_t* const indices = out.indices + i*out.taps;
+        Float* const weights = out.weights + i*out.taps;
+
+        Float sum = 0.0f;
+        for(std::size_t j = 0; j != out.taps; ++j) {
+            const Int index = first + Int(j);
+
+            Float weight;
+            if(!kernel)
+                weight = Math::max(Math::min(Float(index + 1), center + radius) - Math::max(Float(index), center - radius), 0.0f);
+            else
+                weight = kernel((Float(index) + 0.5f - center)/kernelScale);
+
+            indices[j] = std::size_t(Math::clamp(index, 0, Int(inputSize) - 1));
+            weights[j] = weight;
+            sum += weight;
+        }
+
+        for(std::size_t j = 0; j != out.taps; ++j)
+            weights[j] /= sum;
+    }
+
+    return out;
+}
+
+FilterWeights filterWeights(const MipmapFilter filter, const std::size_t inputSize, const std::size_t outputSize) {
+    return filter == MipmapFilter::Box ?
+        filterWeights(nullptr, 0.0f, inputSize, outputSize) :
+        filterWeights(kaiserSinc, KaiserRadius, inputSize, outputSize);
+}
+
+FilterWeights filterWeights(const ResizeFilter filter, const std::size_t inputSize, const std::size_t outputSize) {
+    switch(filter) {
+        case ResizeFilter::Box:
+            return filterWeights(nullptr, 0.0f, inputSize, outputSize);
+        case ResizeFilter::Bilinear:
+            return filterWeights(triangle, 1.0f, inputSize, outputSize);
+        case ResizeFilter::Lanczos:
+            return filterWeights(lanczos, LanczosRadius, inputSize, outputSize);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+struct State {
+    std::size_t channelCount;
+    Vector2i inputSize, outputSize;
+    FilterWeights weightsX, weightsY;
+    /* Tightly packed rows of floats, the intermediate has input height and
+       output width */
+    Containers::ArrayView<const Float> input;
+    Containers::ArrayView<Float> intermediate;
+    Containers::ArrayView<Float> output;
+};
+
+/* Filters a single input row horizontally */
+void horizontalPass(void* const state, const std::size_t inputRow) {
+    const State& s = *static_cast<const State*>(state);
+    const std::size_t c = s.channelCount;
+    const Float* const input = s.input.data() + inputRow*s.inputSize.x()*c;
+    Float* const output = s.intermediate.data() + inputRow*s.outputSize.x()*c;
+
+    for(std::size_t x = 0; x != std::size_t(s.outputSize.x()); ++x) {
+        const std::size_t* const indices = s.weightsX.indices + x*s.weightsX.taps;
+        const Float* const weights = s.weightsX.weights + x*s.weightsX.taps;
+        Float* const pixel = output + x*c;
+        for(std::size_t i = 0; i != c; ++i)
+            pixel[i] = 0.0f;
+        for(std::size_t j = 0; j != s.weightsX.taps; ++j) {
+            const Float* const inputPixel = input + indices[j]*c;
+            for(std::size_t i = 0; i != c; ++i)
+                pixel[i] += weights[j]*inputPixel[i];
+        }
+    }
+}
+
+/* Filters a single output row vertically, going over whole intermediate
+   rows at once */
+void verticalPass(void* const state, const std::size_t outputRow) {
+    const State& s = *static_cast<const State*>(state);
+    const std::size_t rowSize = s.outputSize.x()*s.channelCount;
+    const std::size_t* const indices = s.weightsY.indices + outputRow*s.weightsY.taps;
+    const Float* const weights = s.weightsY.weights + outputRow*s.weightsY.taps;
+    Float* const output = s.output.data() + outputRow*rowSize;
+
+    for(std::size_t i = 0; i != rowSize; ++i)
+        output[i] = 0.0f;
+    for(std::size_t j = 0; j != s.weightsY.taps; ++j) {
+        const Float weight = weights[j];
+        const Float* const input = s.intermediate.data() + indices[j]*rowSize;
+        for(std::size_t i = 0; i != rowSize; ++i)
+            output[i] += weight*input[i];
+    }
+}
+
+/* Fraction of pixels with alpha above `reference` */
+Float alphaCoverage(const Containers::StridedArrayView1D<const Float>& alpha, const Float reference) {
+    std::size_t count = 0;
+    for(const Float i: alpha)
+        if(i > reference) ++count;
+    return Float(count)/Float(alpha.size());
+}
+
+}
+
+Containers::Array<Image2D> mipmaps(const ImageView2D& image, const MipmapFilter filter, const MipmapFlags flags, const Float alphaReference) {
+    return mipmaps(image, filter, flags, alphaReference, parallelForSerial, nullptr);
+}
+
+Containers::Array<Image2D> mipmaps(const ImageView2D& image, const MipmapFilter filter, const MipmapFlags flags, const Float alphaReference, const ParallelFor parallelFor, void* const parallelForState) {
+    CORRADE_ASSERT(image.size().product(),
+        "TextureTools::mipmaps(): expected a non-empty image, got" << Debug::packed << image.size(), {});
+
+    const ChannelType type = channelType(image.format());
+    CORRADE_ASSERT(type != ChannelType::Unsupported,
+        "TextureTools::mipmaps(): unsupported format" << image.format(), {});
+
+    const std::size_t channelCount = pixelFormatChannelCount(image.format());
+    CORRADE_ASSERT(!(flags & MipmapFlag::PreserveAlphaCoverage) || channelCount == 4,
+        "TextureTools::mipmaps(): alpha coverage preservation requires a four-channel format, got" << image.format(), {});
+
+    Float srgbToLinearTable[256];
+    if(type == ChannelType::Srgb) for(std::size_t i = 0; i != 256; ++i)
+        srgbToLinearTable[i] = srgbToLinear(Math::unpack<Float, UnsignedByte>(UnsignedByte(i)));
+
+    /* Count of levels excluding the input */
+    std::size_t levelCount = 0;
+    for(Vector2i size = image.size(); size != Vector2i{1}; size = Math::max(size/2, Vector2i{1}))
+        ++levelCount;
+    /* Image2D has no default constructor, the levels get constructed in
+       place below */
+    Containers::Array<Image2D> out{NoInit, levelCount};
+    if(!levelCount)
+        return out;
+
+    /* Convert the input to tightly packed linear floats */
+    Containers::Array<Float> input{NoInit, std::size_t(image.size().product())*channelCount};
+    if(type == ChannelType::Float)
+        importPixels<Float>(image, nullptr, input);
+    else
+        importPixels<UnsignedByte>(image, type == ChannelType::Srgb ? srgbToLinearTable : nullptr, input);
+
+    /* Coverage of the input, which all levels should match */
+    Float targetCoverage{};
+    if(flags & MipmapFlag::PreserveAlphaCoverage)
+        targetCoverage = alphaCoverage(Containers::stridedArrayView(input).slice(3, input.size()).every(4), alphaReference);
+
+    Vector2i inputSize = image.size();
+    Containers::Array<Float> intermediate;
+    Containers::Array<Float> output;
+    for(std::size_t level = 0; level != levelCount; ++level) {
+        const Vector2i outputSize = Math::max(inputSize/2, Vector2i{1});
+        intermediate = Containers::Array<Float>{NoInit, std::size_t(inputSize.y()*outputSize.x())*channelCount};
+        output = Containers::Array<Float>{NoInit, std::size_t(outputSize.product())*channelCount};
+
+        State state{channelCount, inputSize, outputSize,
+            filterWeights(filter, inputSize.x(), outputSize.x()),
+            filterWeights(filter, inputSize.y(), outputSize.y()),
+            input, intermediate, output};
+        (parallelFor ? parallelFor : parallelForSerial)(parallelForState, inputSize.y(), horizontalPass, &state);
+        (parallelFor ? parallelFor : parallelForSerial)(parallelForState, outputSize.y(), verticalPass, &state);
+
+        /* Find how much alpha needs to be scaled to match the input coverage.
+           If it matches already, nothing needs to be done. Otherwise, as the
+           coverage gets lower with increasing threshold, search for a
+           threshold that gives the closest coverage and scale alpha so that
+           threshold maps to the reference value. The unscaled values are
+           used for calculating the next level. */
+        Float alphaScale = 1.0f;
+        if(flags & MipmapFlag::PreserveAlphaCoverage) {
+            const Containers::StridedArrayView1D<const Float> alpha = Containers::stridedArrayView(output).slice(3, output.size()).every(4);
+            if(alphaCoverage(alpha, alphaReference) != targetCoverage) {
+                Float min = 0.0f;
+                Float max = 1.0f;
+                for(UnsignedInt i = 0; i != AlphaCoverageIterations; ++i) {
+                    const Float threshold = (min + max)*0.5f;
+                    if(alphaCoverage(alpha, threshold) > targetCoverage)
+                        min = threshold;
+                    else
+                        max = threshold;
+                }
+
+                const Float threshold =
+                    Math::abs(alphaCoverage(alpha, min) - targetCoverage) <
+                    Math::abs(alphaCoverage(alpha, max) - targetCoverage) ?
+                        min : max;
+                if(threshold > 0.0f)
+                    alphaScale = alphaReference/threshold;
+            }
+        }
+
+        /* Convert to the output format */
+        const std::size_t pixelSize = image.pixelSize();
+        const std::size_t rowStride = (outputSize.x()*pixelSize + 3)/4*4;
+        Image2D& outputImage = *new(&out[level]) Image2D{image.format(), outputSize, Containers::Array<char>{NoInit, rowStride*outputSize.y()}};
+        if(type == ChannelType::Float)
+            exportPixels<Float>(output, false, alphaScale, outputImage);
+        else
+            exportPixels<UnsignedByte>(output, type == ChannelType::Srgb, alphaScale, outputImage);
+
+        /* The output is the input for the next level */
+        input = Utility::move(output);
+        inputSize = outputSize;
+    }
+
+    return out;
+}
+
+void resizeInto(const ImageView2D& src, const MutableImageView2D& dst, const ResizeFilter filter) {
+    resizeInto(src, dst, filter, parallelForSerial, nullptr);
+}
+
+void resizeInto(const ImageView2D& src, const MutableImageView2D& dst, const ResizeFilter filter, const ParallelFor parallelFor, void* const parallelForState) {
+    CORRADE_ASSERT(src.size().product() && dst.size().product(),
+        "TextureTools::resizeInto(): expected non-empty images, got" << Debug::packed << src.size() << "and" << Debug::packed << dst.size(), );
+    CORRADE_ASSERT(src.format() == dst.format(),
+        "TextureTools::resizeInto(): source format" << src.format() << "doesn't match destination format" << dst.format(), );
+    const ChannelType type = channelType(src.format());
+    CORRADE_ASSERT(type != ChannelType::Unsupported,
+        "TextureTools::resizeInto(): unsupported format" << src.format(), );
+
+    Float srgbToLinearTable[256];
+    if(type == ChannelType::Srgb) for(std::size_t i = 0; i != 256; ++i)
+        srgbToLinearTable[i] = srgbToLinear(Math::unpack<Float, UnsignedByte>(UnsignedByte(i)));
+
+    /* Convert the input to tightly packed linear floats */
+    const std::size_t channelCount = pixelFormatChannelCount(src.format());
+    Containers::Array<Float> input{NoInit, std::size_t(src.size().product())*channelCount};
+    if(type == ChannelType::Float)
+        importPixels<Float>(src, nullptr, input);
+    else
+        importPixels<UnsignedByte>(src, type == ChannelType::Srgb ? srgbToLinearTable : nullptr, input);
+
+    Containers::Array<Float> intermediate{NoInit, std::size_t(src.size().y()*dst.size().x())*channelCount};
+    Containers::Array<Float> output{NoInit, std::size_t(dst.size().product())*channelCount};
+    State state{channelCount, src.size(), dst.size(),
+        filterWeights(filter, src.size().x(), dst.size().x()),
+        filterWeights(filter, src.size().y(), dst.size().y()),
+        input, intermediate, output};
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, src.size().y(), horizontalPass, &state);
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, dst.size().y(), verticalPass, &state);
+
+    /* Convert to the output format */
+    if(type == ChannelType::Float)
+        exportPixels<Float>(output, false, 1.0f, dst);
+    else
+        exportPixels<UnsignedByte>(output, type == ChannelType::Srgb, 1.0f, dst);
+}
+
+}}
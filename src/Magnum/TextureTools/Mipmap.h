@@ -0,0 +1,243 @@
+#ifndef Magnum_TextureTools_Mipmap_h
+#define Magnum_TextureTools_Mipmap_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::mipmaps(), @ref Magnum::TextureTools::resizeInto(), enum @ref Magnum::TextureTools::MipmapFilter, @ref Magnum::TextureTools::MipmapFlag, @ref Magnum::TextureTools::ResizeFilter, enum set @ref Magnum::TextureTools::MipmapFlags
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/Parallel.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Mip level downsampling filter
+@m_since_latest
+
+@see @ref mipmaps()
+*/
+enum class MipmapFilter: UnsignedByte {
+    /**
+     * Box filter. Each output pixel is an average of the input pixels it
+     * covers, weighted by the covered area. For power-of-two sizes it's an
+     * average of 2x2 input pixels, equivalent to what most drivers do in
+     * @ref GL::Texture::generateMipmap(). Fast, but results in slightly
+     * blurry and aliased mip levels.
+     */
+    Box,
+
+    /**
+     * Kaiser-windowed sinc filter with a radius of three output pixels.
+     * Preserves more detail than @ref MipmapFilter::Box and has less
+     * aliasing, at the cost of being considerably slower and possibly
+     * introducing a slight ringing around sharp edges.
+     */
+    Kaiser
+};
+
+/** @debugoperatorenum{MipmapFilter} */
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& output, MipmapFilter value);
+
+/**
+@brief Image resize filter
+@m_since_latest
+
+When downsampling, the filters are stretched to cover the whole footprint of
+an output pixel, so there's no aliasing even for large scale factors.
+@see @ref resizeInto()
+*/
+enum class ResizeFilter: UnsignedByte {
+    /**
+     * Box filter. When downsampling, each output pixel is an average of the
+     * input pixels it covers, weighted by the covered area, same as
+     * @ref MipmapFilter::Box. When upsampling, it's a nearest-neighbor
+     * filter with pixels on boundaries averaged. Fastest, suitable for
+     * downsampling by large factors.
+     */
+    Box,
+
+    /**
+     * Bilinear filter, i.e. a triangle filter with a radius of one pixel.
+     * When upsampling, it's equivalent to a bilinear texture lookup.
+     */
+    Bilinear,
+
+    /**
+     * Lanczos filter with a radius of three pixels. Preserves the most
+     * detail, at the cost of being the slowest and introducing a slight
+     * ringing around sharp edges. Values in 8-bit formats are clamped to the
+     * representable range, floating-point values can get outside of the input
+     * range.
+     */
+    Lanczos
+};
+
+/** @debugoperatorenum{ResizeFilter} */
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& output, ResizeFilter value);
+
+/**
+@brief Mip level generation flag
+@m_since_latest
+
+@see @ref MipmapFlags, @ref mipmaps()
+*/
+enum class MipmapFlag: UnsignedByte {
+    /**
+     * Scale alpha of each mip level so the fraction of pixels with alpha
+     * above the reference value is the same as in the input image. Without
+     * this flag, alpha-tested textures such as foliage or fences get
+     * progressively thinner in smaller mip levels. Can be used only with
+     * four-channel pixel formats.
+     */
+    PreserveAlphaCoverage = 1 << 0
+};
+
+/** @debugoperatorenum{MipmapFlag} */
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& output, MipmapFlag value);
+
+/**
+@brief Mip level generation flags
+@m_since_latest
+
+@see @ref mipmaps()
+*/
+typedef Containers::EnumSet<MipmapFlag> MipmapFlags;
+
+CORRADE_ENUMSET_OPERATORS(MipmapFlags)
+
+/** @debugoperatorenum{MipmapFlags} */
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& output, MipmapFlags value);
+
+/**
+@brief Generate a mip chain on the CPU
+@param image            Input image
+@param filter           Downsampling filter
+@param flags            Flags
+@param alphaReference   Reference alpha value for
+    @ref MipmapFlag::PreserveAlphaCoverage, usually the same as the alpha
+    test threshold used when rendering. Ignored if the flag isn't set.
+@m_since_latest
+
+Returns all mip levels except the first one, i.e. for a @cpp {256, 64} @ce
+image it returns eight images from @cpp {128, 32} @ce down to
+@cpp {1, 1} @ce. Size of each level is half of the previous rounded down,
+but at least @cpp 1 @ce. For a @cpp {1, 1} @ce image returns an empty array.
+The levels have the same pixel format as @p image and a default
+@ref PixelStorage.
+
+The @p image is expected to be non-empty and in one of the
+@ref PixelFormat::R8Unorm, @relativeref{PixelFormat,RG8Unorm},
+@relativeref{PixelFormat,RGB8Unorm}, @relativeref{PixelFormat,RGBA8Unorm},
+@relativeref{PixelFormat,R8Srgb}, @relativeref{PixelFormat,RG8Srgb},
+@relativeref{PixelFormat,RGB8Srgb}, @relativeref{PixelFormat,RGBA8Srgb},
+@relativeref{PixelFormat,R32F}, @relativeref{PixelFormat,RG32F},
+@relativeref{PixelFormat,RGB32F} or @relativeref{PixelFormat,RGBA32F}
+formats. The filtering is done on floating-point values, with each level
+calculated from the previous, unrounded, one. Values in sRGB formats are
+converted to linear before filtering and back to sRGB after, except for the
+alpha channel of @relativeref{PixelFormat,RGBA8Srgb} which is linear. Pixels
+outside of the image are treated as a copy of the nearest edge pixel.
+
+Both filters are separable, with the first pass going over input rows and
+the second over output rows. The inner loops operate on consecutive values
+and are written to be friendly to compiler autovectorization. This overload
+processes everything serially on the calling thread, use
+@ref mipmaps(const ImageView2D&, MipmapFilter, MipmapFlags, Float, ParallelFor, void*)
+to spread the work across multiple threads.
+
+@snippet TextureTools.cpp mipmaps
+
+@see @ref MipmapGL
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Containers::Array<Image2D> mipmaps(const ImageView2D& image, MipmapFilter filter = MipmapFilter::Box, MipmapFlags flags = {}, Float alphaReference = 0.5f);
+
+/**
+@brief Generate a mip chain on the CPU using a parallel executor
+@param image            Input image
+@param filter           Downsampling filter
+@param flags            Flags
+@param alphaReference   Reference alpha value for
+    @ref MipmapFlag::PreserveAlphaCoverage
+@param parallelFor      Parallel loop executor or @cpp nullptr @ce
+@param parallelForState State pointer passed to @p parallelFor
+@m_since_latest
+
+Same as @ref mipmaps(const ImageView2D&, MipmapFilter, MipmapFlags, Float),
+but with both filter passes of each level split into tasks by rows and
+executed through @p parallelFor. The output is the same regardless of how the
+tasks get executed.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Containers::Array<Image2D> mipmaps(const ImageView2D& image, MipmapFilter filter, MipmapFlags flags, Float alphaReference, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+/**
+@brief Resize an image on the CPU
+@param src      Source image
+@param dst      Destination image
+@param filter   Resize filter
+@m_since_latest
+
+Resamples the whole @p src to the whole @p dst, which can be both larger and
+smaller than the source, and have a different aspect ratio. Both images are
+expected to be non-empty and have the same format, which is expected to be one
+of the formats supported by @ref mipmaps(). Same as with @ref mipmaps(),
+filtering is done on floating-point values, sRGB values are converted to linear
+before filtering and back after, and pixels outside of the image are treated
+as a copy of the nearest edge pixel.
+
+Internally it uses the same separable filtering code as @ref mipmaps(). This
+overload processes everything serially on the calling thread, use
+@ref resizeInto(const ImageView2D&, const MutableImageView2D&, ResizeFilter, ParallelFor, void*)
+to spread the work across multiple threads.
+
+@snippet TextureTools.cpp resizeInto
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void resizeInto(const ImageView2D& src, const MutableImageView2D& dst, ResizeFilter filter = ResizeFilter::Bilinear);
+
+/**
+@brief Resize an image on the CPU using a parallel executor
+@param src              Source image
+@param dst              Destination image
+@param filter           Resize filter
+@param parallelFor      Parallel loop executor or @cpp nullptr @ce
+@param parallelForState State pointer passed to @p parallelFor
+@m_since_latest
+
+Same as @ref resizeInto(const ImageView2D&, const MutableImageView2D&, ResizeFilter),
+but with both filter passes split into tasks by rows and executed through
+@p parallelFor. The output is the same regardless of how the tasks get
+executed.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void resizeInto(const ImageView2D& src, const MutableImageView2D& dst, ResizeFilter filter, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+}}
+
+#endif
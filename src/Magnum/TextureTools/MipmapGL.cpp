@@ -0,0 +1,220 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MipmapGL.h"
+
+#include <Corrade/Containers/String.h>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/GL/AbstractShaderProgram.h"
+#include "Magnum/GL/Buffer.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/Framebuffer.h"
+#include "Magnum/GL/Mesh.h"
+#include "Magnum/GL/Renderer.h"
+#include "Magnum/GL/Shader.h"
+#include "Magnum/GL/Texture.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+static void importTextureToolResources() {
+    CORRADE_RESOURCE_INITIALIZE(MagnumTextureTools_RESOURCES)
+}
+#endif
+
+namespace Magnum { namespace TextureTools {
+
+using namespace Containers::Literals;
+
+namespace {
+
+class MipmapShader: public GL::AbstractShaderProgram {
+    public:
+        typedef GL::Attribute<0, Vector2> Position;
+
+        explicit MipmapShader();
+
+        MipmapShader& setInputSize(const Vector2i& size) {
+            setUniform(_inputSizeUniform, size);
+            return *this;
+        }
+
+        MipmapShader& bindTexture(GL::Texture2D& texture) {
+            texture.bind(TextureUnit);
+            return *this;
+        }
+
+    private:
+        /* Same unit as used by DistanceFieldGL, see the comment there */
+        enum: Int { TextureUnit = 7 };
+
+        Int _inputSizeUniform{0};
+};
+
+MipmapShader::MipmapShader() {
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumTextureTools"_s))
+        importTextureToolResources();
+    #endif
+    Utility::Resource rs("MagnumTextureTools"_s);
+
+    #ifndef MAGNUM_TARGET_GLES
+    const GL::Version v = GL::Context::current().supportedVersion({GL::Version::GL320, GL::Version::GL300});
+    #else
+    const GL::Version v = GL::Context::current().supportedVersion({
+        #ifndef MAGNUM_TARGET_WEBGL
+        GL::Version::GLES310,
+        #endif
+        GL::Version::GLES300});
+    #endif
+
+    GL::Shader vert{v, GL::Shader::Type::Vertex};
+    vert.addSource(rs.getString("compatibility.glsl"_s))
+        .addSource(rs.getString("FullScreenTriangle.glsl"_s))
+        .addSource(rs.getString("MipmapShader.vert"_s));
+
+    GL::Shader frag{v, GL::Shader::Type::Fragment};
+    frag.addSource(rs.getString("compatibility.glsl"_s))
+        .addSource(rs.getString("MipmapShader.frag"_s));
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(vert.compile() && frag.compile());
+
+    attachShaders({vert, frag});
+
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::MAGNUM::shader_vertex_id>())
+        bindAttributeLocation(Position::Location, "position"_s);
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::explicit_uniform_location>())
+    #elif !defined(MAGNUM_TARGET_WEBGL)
+    if(v < GL::Version::GLES310)
+    #endif
+    {
+        _inputSizeUniform = uniformLocation("inputSize"_s);
+    }
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::ARB::shading_language_420pack>())
+    #elif !defined(MAGNUM_TARGET_WEBGL)
+    if(v < GL::Version::GLES310)
+    #endif
+    {
+        setUniform(uniformLocation("textureData"_s), TextureUnit);
+    }
+}
+
+}
+
+struct MipmapGL::State {
+    MipmapShader shader;
+    GL::Mesh mesh;
+};
+
+MipmapGL::MipmapGL(): _state{new State} {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_GL_EXTENSION_SUPPORTED(GL::Extensions::ARB::framebuffer_object);
+    #endif
+
+    _state->mesh.setPrimitive(GL::MeshPrimitive::Triangles)
+        .setCount(3);
+
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::MAGNUM::shader_vertex_id>()) {
+        constexpr Vector2 triangle[]{
+            {-1.0f,  1.0f},
+            {-1.0f, -3.0f},
+            { 3.0f,  1.0f}
+        };
+        GL::Buffer buffer;
+        buffer.setData(triangle, GL::BufferUsage::StaticDraw);
+        _state->mesh.addVertexBuffer(Utility::move(buffer), 0, MipmapShader::Position());
+    }
+}
+
+MipmapGL::MipmapGL(NoCreateT) noexcept {}
+
+MipmapGL::MipmapGL(MipmapGL&&) noexcept = default;
+
+MipmapGL::~MipmapGL() = default;
+
+MipmapGL& MipmapGL::operator=(MipmapGL&&) noexcept = default;
+
+void MipmapGL::operator()(GL::Texture2D& texture, const Vector2i& size, const Int levelCount) {
+    CORRADE_ASSERT(size.product(),
+        "TextureTools::MipmapGL: expected a non-empty size, got" << Debug::packed << size, );
+    #ifndef CORRADE_NO_ASSERT
+    const Int maxLevelCount = Math::log2(UnsignedInt(size.max())) + 1;
+    #endif
+    CORRADE_ASSERT(levelCount >= 1 && levelCount <= maxLevelCount,
+        "TextureTools::MipmapGL: expected level count to be between 1 and" << maxLevelCount << "for size" << Debug::packed << size << "but got" << levelCount, );
+
+    /** @todo Disable depth test, blending and then enable it back (if was
+        previously) */
+
+    #ifndef MAGNUM_TARGET_GLES
+    /* Convert linear values back to sRGB on write. On ES and WebGL it's
+       enabled always. */
+    GL::Renderer::enable(GL::Renderer::Feature::FramebufferSrgb);
+    #endif
+
+    Vector2i inputSize = size;
+    for(Int level = 1; level < levelCount; ++level) {
+        const Vector2i outputSize = Math::max(inputSize/2, Vector2i{1});
+
+        /* Restrict the sampled level range to just the previous level to
+           not have a feedback loop with the level being rendered to */
+        texture
+            .setBaseLevel(level - 1)
+            .setMaxLevel(level - 1);
+
+        GL::Framebuffer framebuffer{{{}, outputSize}};
+        framebuffer.attachTexture(GL::Framebuffer::ColorAttachment(0), texture, level);
+        CORRADE_ASSERT(framebuffer.checkStatus(GL::FramebufferTarget::Draw) == GL::Framebuffer::Status::Complete,
+            "TextureTools::MipmapGL: texture format not framebuffer-drawable:" << framebuffer.checkStatus(GL::FramebufferTarget::Draw), );
+        framebuffer.bind();
+
+        _state->shader
+            .bindTexture(texture)
+            .setInputSize(inputSize)
+            .draw(_state->mesh);
+
+        inputSize = outputSize;
+    }
+
+    texture
+        .setBaseLevel(0)
+        .setMaxLevel(1000);
+
+    #ifndef MAGNUM_TARGET_GLES
+    GL::Renderer::disable(GL::Renderer::Feature::FramebufferSrgb);
+    #endif
+}
+
+}}
@@ -0,0 +1,154 @@
+#ifndef Magnum_TextureTools_MipmapGL_h
+#define Magnum_TextureTools_MipmapGL_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::TextureTools::MipmapGL
+ * @m_since_latest
+ */
+
+#include "Magnum/configure.h"
+
+#if defined(MAGNUM_TARGET_GL) && !defined(MAGNUM_TARGET_GLES2)
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/GL/GL.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Generate a mip chain using OpenGL
+@m_since_latest
+
+Fills mip levels of a texture from its first level with a box filter, similar
+to @ref GL::Texture::generateMipmap() but with well-defined results ---
+the filtering done by @fn_gl{GenerateMipmap} is implementation-defined and
+some drivers filter sRGB textures without converting them to linear first,
+or just pick a single pixel for odd-sized levels.
+
+Each level is rendered with a fragment shader that reads the previous level
+using @glsl texelFetch() @ce, weighting the input pixels by how much of them
+is covered by the output pixel. Thus for odd sizes the output pixel gets
+contribution from three input pixels in given direction instead of just
+two. For sRGB textures the conversion to linear space and back is done by
+the hardware on fetch and framebuffer write. On desktop GL
+@ref GL::Renderer::Feature::FramebufferSrgb is enabled for that during the
+operation and disabled again at the end, which is the default state; on
+OpenGL ES and WebGL the sRGB conversion on write is always enabled.
+
+The result matches @ref mipmaps() with @ref MipmapFilter::Box except for
+rounding, as each level is calculated from the previous one stored in the
+texture format instead of from unrounded floating-point values. Filters other
+than box and @ref MipmapFlag::PreserveAlphaCoverage are available only in the
+CPU implementation.
+
+@attention This is a GPU-only implementation, so it expects an active GL
+    context.
+
+@note This class is available only if Magnum is compiled with
+    @ref MAGNUM_TARGET_GL enabled (done by default) and not on OpenGL ES 2.0
+    and WebGL 1.0. See @ref building-features for more information.
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT MipmapGL {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Prepares the shader and other internal state.
+         */
+        explicit MipmapGL();
+
+        /**
+         * @brief Construct without creating the internal OpenGL state
+         *
+         * The constructed instance is equivalent to moved-from state, i.e. no
+         * APIs can be safely called on the object. Useful in cases where you
+         * will overwrite the instance later anyway. Move another object over
+         * it to make it useful.
+         *
+         * This function can be safely used for constructing (and later
+         * destructing) objects even without any OpenGL context being active.
+         * However note that this is a low-level and a potentially dangerous
+         * API, see the documentation of @ref NoCreate for alternatives.
+         */
+        explicit MipmapGL(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        MipmapGL(const MipmapGL&) = delete;
+
+        /**
+         * @brief Move constructor
+         *
+         * Performs a destructive move, i.e. the original object isn't usable
+         * afterwards anymore.
+         */
+        MipmapGL(MipmapGL&&) noexcept;
+
+        ~MipmapGL();
+
+        /** @brief Copying is not allowed */
+        MipmapGL& operator=(const MipmapGL&) = delete;
+
+        /** @brief Move assignment */
+        MipmapGL& operator=(MipmapGL&&) noexcept;
+
+        /**
+         * @brief Generate mip levels of a texture
+         * @param texture       Texture to fill
+         * @param size          Size of the first level
+         * @param levelCount    Total count of levels, including the first
+         *
+         * Fills levels @cpp 1 @ce to @cpp levelCount - 1 @ce of @p texture
+         * from level @cpp 0 @ce. The @p texture is expected to have storage
+         * for all levels allocated, with a framebuffer-drawable
+         * @ref GL::TextureFormat such as @ref GL::TextureFormat::RGBA8 or
+         * @ref GL::TextureFormat::SRGB8Alpha8, and @p levelCount is expected
+         * to be at least @cpp 1 @ce and not larger than the level count
+         * implied by @p size. Level @cpp i @ce has a size of
+         * @cpp size >> i @ce, but at least @cpp 1 @ce.
+         *
+         * Base and max level of @p texture is modified during the operation
+         * and reset to @cpp 0 @ce and @cpp 1000 @ce, which are the defaults,
+         * at the end. Temporary framebuffers are used for rendering each
+         * level, so the previously bound framebuffer has to be bound again
+         * afterwards.
+         */
+        void operator()(GL::Texture2D& texture, const Vector2i& size, Int levelCount);
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+#else
+#error this header is available only in the desktop OpenGL, OpenGL ES 3.0+ and WebGL 2.0 builds
+#endif
+
+#endif
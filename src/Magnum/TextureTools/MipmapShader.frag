@@ -0,0 +1,72 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifdef EXPLICIT_BINDING
+layout(binding = 7)
+#endif
+uniform mediump sampler2D textureData;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 0)
+#endif
+uniform highp ivec2 inputSize;
+
+out mediump vec4 fragmentColor;
+
+/* Box filter weights of the up to three input pixels covered by an output
+   pixel along one axis. For an even input size it's exactly two pixels, for
+   an odd size 2n + 1 the output pixel i covers a part of pixel 2i, the whole
+   pixel 2i + 1 and a part of pixel 2i + 2. */
+mediump vec3 weights(highp int inSize, highp int outSize, highp int i) {
+    if(inSize == 1)
+        return vec3(1.0, 0.0, 0.0);
+    if(inSize == 2*outSize)
+        return vec3(0.5, 0.5, 0.0);
+    return vec3(float(outSize - i),
+                float(outSize),
+                float(i + 1))/float(inSize);
+}
+
+void main() {
+    highp ivec2 outputPosition = ivec2(gl_FragCoord.xy);
+    highp ivec2 outputSize = max(inputSize/2, ivec2(1));
+    highp ivec2 base = min(outputPosition*2, inputSize - ivec2(1));
+    mediump vec3 weightsX = weights(inputSize.x, outputSize.x, outputPosition.x);
+    mediump vec3 weightsY = weights(inputSize.y, outputSize.y, outputPosition.y);
+
+    /* The sampler is expected to have base and max level set to the level
+       being downsampled, so fetching from level 0 of it. Taps with zero
+       weight are clamped to the edge to not read outside of the level. */
+    mediump vec4 color = vec4(0.0);
+    for(int y = 0; y != 3; ++y) {
+        mediump vec4 row = vec4(0.0);
+        for(int x = 0; x != 3; ++x)
+            row += weightsX[x]*texelFetch(textureData, min(base + ivec2(x, y), inputSize - ivec2(1)), 0);
+        color += weightsY[y]*row;
+    }
+
+    fragmentColor = color;
+}
@@ -0,0 +1,269 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MultiChannelDistanceField.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* Channel subsets assigned to edges. White edges contribute to all three
+   channels, the others are switched between at corners. */
+enum: UnsignedByte {
+    Red = 1 << 0,
+    Green = 1 << 1,
+    Blue = 1 << 2,
+    Cyan = Green|Blue,
+    Magenta = Red|Blue,
+    Yellow = Red|Green,
+    White = Red|Green|Blue
+};
+
+struct Edge {
+    Vector2 a, b;
+    UnsignedByte channels;
+};
+
+/* Sine of the angle between two consecutive edge directions above which
+   their shared vertex is treated as a corner. Corresponds to about 8
+   degrees. */
+constexpr Float CornerCrossThreshold = 0.1411f;
+
+/* Cycles between the three two-channel subsets, skipping `banned` */
+UnsignedByte switchChannels(const UnsignedByte channels, const UnsignedByte banned) {
+    UnsignedByte next = channels == Cyan ? Magenta :
+                        channels == Magenta ? Yellow : Cyan;
+    if(next == banned)
+        next = next == Cyan ? Magenta :
+               next == Magenta ? Yellow : Cyan;
+    return next;
+}
+
+/* Splits `count` items into three roughly equal consecutive parts, returning
+   -1, 0 or 1 */
+Int trichotomy(const std::size_t position, const std::size_t count) {
+    return Int(3 + 2.875f*position/(count - 1) - 1.4375f + 0.5f) - 3;
+}
+
+void colorContourEdges(const Containers::ArrayView<Edge> edges) {
+    /* Find corners, i.e. edges whose start vertex is a corner */
+    Containers::Array<std::size_t> corners;
+    for(std::size_t i = 0; i != edges.size(); ++i) {
+        const Edge& prev = edges[i ? i - 1 : edges.size() - 1];
+        const Vector2 prevDirection = (prev.b - prev.a).normalized();
+        const Vector2 direction = (edges[i].b - edges[i].a).normalized();
+        if(Math::dot(prevDirection, direction) <= 0.0f ||
+           Math::abs(Math::cross(prevDirection, direction)) > CornerCrossThreshold)
+            arrayAppend(corners, i);
+    }
+
+    /* A smooth contour, all channels have the same distance */
+    if(corners.isEmpty()) {
+        for(Edge& edge: edges)
+            edge.channels = White;
+
+    /* A teardrop shape, split the contour into three parts with the middle
+       one being white. The caller ensures there's at least three edges in
+       this case. */
+    } else if(corners.size() == 1) {
+        const UnsignedByte channels[]{Cyan, White, Magenta};
+        for(std::size_t i = 0; i != edges.size(); ++i)
+            edges[(corners[0] + i) % edges.size()].channels = channels[1 + trichotomy(i, edges.size())];
+
+    /* Switch the channels at each corner, making sure the last part doesn't
+       have the same channels as the first */
+    } else {
+        const UnsignedByte initial = switchChannels(White, 0);
+        UnsignedByte channels = initial;
+        std::size_t corner = 0;
+        for(std::size_t i = 0; i != edges.size(); ++i) {
+            const std::size_t index = (corners[0] + i) % edges.size();
+            if(corner + 1 < corners.size() && corners[corner + 1] == index) {
+                ++corner;
+                channels = switchChannels(channels, corner == corners.size() - 1 ? initial : 0);
+            }
+            edges[index].channels = channels;
+        }
+    }
+}
+
+/* Distance to an edge, compared by the absolute value first and then by how
+   orthogonal is the direction to the nearest point, which disambiguates
+   equal distances to a vertex shared by two edges */
+struct EdgeDistance {
+    Float distance;
+    Float orthogonality;
+    /* Position of the nearest point along the edge, unclamped */
+    Float t;
+};
+
+inline bool operator<(const EdgeDistance& a, const EdgeDistance& b) {
+    const Float absA = Math::abs(a.distance), absB = Math::abs(b.distance);
+    return absA < absB || (absA == absB && a.orthogonality < b.orthogonality);
+}
+
+EdgeDistance edgeDistance(const Edge& edge, const Vector2& point) {
+    const Vector2 ab = edge.b - edge.a;
+    const Vector2 ap = point - edge.a;
+    const Float t = Math::dot(ap, ab)/ab.dot();
+
+    /* Take the endpoint directly instead of interpolating to it, so the
+       distance to a shared vertex is bit-exact for both edges */
+    Vector2 nearest;
+    Float orthogonality;
+    if(t <= 0.0f) {
+        nearest = edge.a;
+        orthogonality = Math::abs(Math::dot(ab.normalized(), (point - nearest).normalized()));
+    } else if(t >= 1.0f) {
+        nearest = edge.b;
+        orthogonality = Math::abs(Math::dot(ab.normalized(), (point - nearest).normalized()));
+    } else {
+        nearest = edge.a + t*ab;
+        orthogonality = 0.0f;
+    }
+
+    /* Points on the left side of the edge are inside */
+    const Float distance = (point - nearest).length();
+    return {Math::cross(ab, ap) > 0.0f ? distance : -distance, orthogonality, t};
+}
+
+/* If the nearest point is an endpoint, a distance to the edge line extended
+   beyond it is used instead if it's closer. That's what keeps the corners
+   sharp after taking the median of the channels. */
+Float edgePseudoDistance(const Edge& edge, const EdgeDistance& distance, const Vector2& point) {
+    if(distance.t > 0.0f && distance.t < 1.0f)
+        return distance.distance;
+
+    const Vector2 direction = (edge.b - edge.a).normalized();
+    const Vector2 endpoint = distance.t <= 0.0f ? edge.a : edge.b;
+    const Float pseudoDistance = Math::cross(direction, point - endpoint);
+    return Math::abs(pseudoDistance) <= Math::abs(distance.distance) ?
+        pseudoDistance : distance.distance;
+}
+
+inline void setTrueDistance(Color3ub&, UnsignedByte) {}
+inline void setTrueDistance(Color4ub& out, const UnsignedByte value) {
+    out.a() = value;
+}
+
+inline Float median(const Float a, const Float b, const Float c) {
+    return Math::max(Math::min(a, b), Math::min(Math::max(a, b), c));
+}
+
+template<class T> void multiChannelDistanceFieldIntoImplementation(const Containers::Iterable<const Containers::StridedArrayView1D<const Vector2>>& contours, const Containers::StridedArrayView2D<T>& output, const Float radius) {
+    /* Gather edges of all contours, dropping zero-length ones, and assign
+       channels to them */
+    Containers::Array<Edge> edges;
+    for(const Containers::StridedArrayView1D<const Vector2>& contour: contours) {
+        const std::size_t contourBegin = edges.size();
+        for(std::size_t i = 0; i != contour.size(); ++i) {
+            const Vector2 a = contour[i];
+            const Vector2 b = contour[i + 1 == contour.size() ? 0 : i + 1];
+            if(a != b)
+                arrayAppend(edges, Edge{a, b, 0});
+        }
+
+        /* If there's less than three edges, split each of them into three
+           so the channels can be assigned in a way that preserves corners */
+        const std::size_t contourEdgeCount = edges.size() - contourBegin;
+        if(!contourEdgeCount)
+            continue;
+        if(contourEdgeCount < 3) {
+            for(std::size_t i = 0; i != contourEdgeCount; ++i) {
+                const Edge edge = edges[contourBegin + i*3];
+                const Vector2 ab = edge.b - edge.a;
+                edges[contourBegin + i*3].b = edge.a + ab/3.0f;
+                arrayInsert(edges, contourBegin + i*3 + 1, Edge{edge.a + ab/3.0f, edge.a + ab*2.0f/3.0f, 0});
+                arrayInsert(edges, contourBegin + i*3 + 2, Edge{edge.a + ab*2.0f/3.0f, edge.b, 0});
+            }
+        }
+
+        colorContourEdges(edges.exceptPrefix(contourBegin));
+    }
+
+    constexpr Float Infinity = Constants::inf();
+    for(std::size_t y = 0; y != output.size()[0]; ++y) {
+        for(std::size_t x = 0; x != output.size()[1]; ++x) {
+            const Vector2 point{x + 0.5f, y + 0.5f};
+
+            /* Nearest edge overall and for each channel */
+            EdgeDistance nearest{-Infinity, 0.0f, 0.0f};
+            EdgeDistance nearestChannel[3]{nearest, nearest, nearest};
+            const Edge* nearestChannelEdge[3]{};
+            for(const Edge& edge: edges) {
+                const EdgeDistance distance = edgeDistance(edge, point);
+                if(distance < nearest)
+                    nearest = distance;
+                for(std::size_t i = 0; i != 3; ++i) {
+                    if((edge.channels & (1 << i)) && distance < nearestChannel[i]) {
+                        nearestChannel[i] = distance;
+                        nearestChannelEdge[i] = &edge;
+                    }
+                }
+            }
+
+            Vector3 distance;
+            for(std::size_t i = 0; i != 3; ++i)
+                distance[i] = nearestChannelEdge[i] ? edgePseudoDistance(*nearestChannelEdge[i], nearestChannel[i], point) : -Infinity;
+
+            /* If the median ends up on the other side of the outline than
+               the actual nearest edge, it'd cause artifacts. Use the true
+               distance for all channels in that case. */
+            if((median(distance[0], distance[1], distance[2]) > 0.0f) != (nearest.distance > 0.0f))
+                distance = Vector3{nearest.distance};
+
+            T& out = output[y][x];
+            const Vector3 value = Math::clamp(Vector3{0.5f} + distance/(2.0f*radius), 0.0f, 1.0f);
+            out.r() = Math::pack<UnsignedByte>(value[0]);
+            out.g() = Math::pack<UnsignedByte>(value[1]);
+            out.b() = Math::pack<UnsignedByte>(value[2]);
+            /* True distance for the alpha channel, if there's any */
+            setTrueDistance(out, Math::pack<UnsignedByte>(Math::clamp(0.5f + nearest.distance/(2.0f*radius), 0.0f, 1.0f)));
+        }
+    }
+}
+
+}
+
+void multiChannelDistanceFieldInto(const Containers::Iterable<const Containers::StridedArrayView1D<const Vector2>>& contours, const Containers::StridedArrayView2D<Color3ub>& output, const Float radius) {
+    multiChannelDistanceFieldIntoImplementation(contours, output, radius);
+}
+
+void multiChannelDistanceFieldInto(const Containers::Iterable<const Containers::StridedArrayView1D<const Vector2>>& contours, const Containers::StridedArrayView2D<Color4ub>& output, const Float radius) {
+    multiChannelDistanceFieldIntoImplementation(contours, output, radius);
+}
+
+}}
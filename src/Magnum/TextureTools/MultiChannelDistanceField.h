@@ -0,0 +1,101 @@
+#ifndef Magnum_TextureTools_MultiChannelDistanceField_h
+#define Magnum_TextureTools_MultiChannelDistanceField_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::multiChannelDistanceFieldInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Create a multi-channel signed distance field from polygon contours
+@param[in]  contours    Closed polygon contours
+@param[in]  output      Where to put the distance field
+@param[in]  radius      Distance range in output pixels
+@m_since_latest
+
+Compared to @ref distanceFieldInto() and @ref DistanceFieldGL, which create a
+single-channel distance field from a rasterized binary image, this function
+works directly on the shape outline and produces a three-channel distance
+field where each channel is a distance to a different subset of the outline
+edges. A median of the three channels, calculated in the
+@ref Shaders::DistanceFieldVectorGL shader if
+@ref Shaders::DistanceFieldVectorGL::Flag::MultiChannel is enabled,
+reconstructs sharp corners even at very low resolutions, meaning the same
+visual quality can be achieved with a significantly smaller output than with a
+single-channel distance field.
+
+The @p contours are expected to be in the output pixel coordinates with Y up,
+i.e. with @cpp {0.5f, 0.5f} @ce being the center of the first pixel of the
+first row of @p output, which matches the convention used by @ref Image. Each
+contour is a list of polygon vertices, implicitly closed, with outer contours
+being in a counterclockwise order and holes in a clockwise order. Curved
+outlines are expected to be flattened to line segments first. Consecutive
+duplicate vertices are ignored, contours with less than two distinct vertices
+are skipped.
+
+Edges of each contour are assigned a subset of the three channels based on
+corners, which are places where the outline direction changes by more than
+about 8 degrees from a straight line. Each output channel then contains a
+signed distance to the nearest edge having that channel, with the distance
+measured to the edge line extended beyond its endpoints if that's closer,
+which is what makes the corners sharp. Positive values are inside. Distance
+of @cpp 0 @ce maps to a value of @cpp 0.5 @ce, distance of @p radius inside
+to @cpp 1.0 @ce and distance of @p radius outside to @cpp 0.0 @ce. Pixels
+where the median of the three channels would be on the opposite side of the
+outline than the actual nearest edge get all three channels set to the actual
+distance to avoid artifacts.
+
+The calculation is done for every pixel and every edge, so it's meant to be
+used for small outputs such as individual glyphs.
+@see @ref Text::GlyphCacheGL
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void multiChannelDistanceFieldInto(const Containers::Iterable<const Containers::StridedArrayView1D<const Vector2>>& contours, const Containers::StridedArrayView2D<Color3ub>& output, Float radius);
+
+/**
+@brief Create a multi-channel signed distance field with a true distance in the alpha channel
+@m_since_latest
+
+Same as @ref multiChannelDistanceFieldInto(const Containers::Iterable<const Containers::StridedArrayView1D<const Vector2>>&, const Containers::StridedArrayView2D<Color3ub>&, Float),
+but additionally puts a true signed distance to the nearest edge into the
+alpha channel. It can be used for effects that need a distance without sharp
+corners, such as rounded outlines or shadows. The mapping is the same as for
+the other channels.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void multiChannelDistanceFieldInto(const Containers::Iterable<const Containers::StridedArrayView1D<const Vector2>>& contours, const Containers::StridedArrayView2D<Color4ub>& output, Float radius);
+
+}}
+
+#endif
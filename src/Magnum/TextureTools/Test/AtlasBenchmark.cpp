@@ -101,6 +101,7 @@ struct AtlasBenchmark: TestSuite::Tester {
     std::uint64_t benchmarkEnd();
 
     void landfill();
+    void landfillChurn();
     void stbRectPack();
 
     private:
@@ -169,6 +170,44 @@ const struct {
         {8192, 8192}, {}},
 };
 
+const struct {
+    const char* name;
+    const char* filename;
+    const char* image;
+    Int width;
+    Containers::Optional<AtlasLandfillFlags> flags;
+    Float removed;
+    UnsignedInt iterations;
+    bool compact;
+} LandfillChurnData[]{
+    {"Oxygen.ttf, 25% removed, 10 iterations",
+        "oxygen-glyphs.bin",
+        "oxygen-glyphs-landfill-churn.tga",
+        512, {}, 0.25f, 10, false},
+    {"Oxygen.ttf, 25% removed, 10 iterations, compact",
+        "oxygen-glyphs.bin",
+        "oxygen-glyphs-landfill-churn-compact.tga",
+        512, {}, 0.25f, 10, true},
+    {"Noto Serif Tangut, 25% removed, 10 iterations",
+        "noto-serif-tangut-glyphs.bin",
+        "noto-serif-tangut-glyphs-landfill-churn.tga",
+        2048, {}, 0.25f, 10, false},
+    {"Noto Serif Tangut, 25% removed, 10 iterations, compact",
+        "noto-serif-tangut-glyphs.bin",
+        "noto-serif-tangut-glyphs-landfill-churn-compact.tga",
+        2048, {}, 0.25f, 10, true},
+    {"FP 102344349, landscape, 50% removed, 5 iterations",
+        "fp-102344349-textures.bin",
+        "fp-102344349-textures-landfill-churn.tga",
+        2048, AtlasLandfillFlag::RotateLandscape|AtlasLandfillFlag::WidestFirst,
+        0.5f, 5, false},
+    {"FP 102344349, landscape, 50% removed, 5 iterations, compact",
+        "fp-102344349-textures.bin",
+        "fp-102344349-textures-landfill-churn-compact.tga",
+        2048, AtlasLandfillFlag::RotateLandscape|AtlasLandfillFlag::WidestFirst,
+        0.5f, 5, true},
+};
+
 const struct {
     const char* name;
     const char* filename;
@@ -226,6 +265,12 @@ AtlasBenchmark::AtlasBenchmark() {
         &AtlasBenchmark::benchmarkEnd,
         BenchmarkUnits::PercentageThousandths);
 
+    addCustomInstancedBenchmarks({&AtlasBenchmark::landfillChurn}, 1,
+        Containers::arraySize(LandfillChurnData),
+        &AtlasBenchmark::benchmarkBegin,
+        &AtlasBenchmark::benchmarkEnd,
+        BenchmarkUnits::PercentageThousandths);
+
     addCustomInstancedBenchmarks({&AtlasBenchmark::stbRectPack}, 1,
         Containers::arraySize(StbRectPackData),
         &AtlasBenchmark::benchmarkBegin,
@@ -237,6 +282,9 @@ AtlasBenchmark::AtlasBenchmark() {
     addInstancedBenchmarks({&AtlasBenchmark::landfill}, 5,
         Containers::arraySize(LandfillData));
 
+    addInstancedBenchmarks({&AtlasBenchmark::landfillChurn}, 5,
+        Containers::arraySize(LandfillChurnData));
+
     addInstancedBenchmarks({&AtlasBenchmark::stbRectPack}, 5,
         Containers::arraySize(StbRectPackData));
 }
@@ -385,6 +433,73 @@ void AtlasBenchmark::landfill() {
         (CompareAtlasPacking{data.image, atlas.filledSize().xy()}));
 }
 
+void AtlasBenchmark::landfillChurn() {
+    auto&& data = LandfillChurnData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Optional<Containers::Array<char>> sizeData = Utility::Path::read(Utility::Path::join({TEXTURETOOLS_TEST_DIR, "AtlasTestFiles", data.filename}));
+    CORRADE_VERIFY(sizeData);
+
+    auto sizes16 = Containers::arrayCast<Vector2s>(*sizeData);
+    Containers::Array<Vector2i> sizes{NoInit, sizes16.size()};
+    Math::castInto(
+        Containers::arrayCast<2, const Short>(stridedArrayView(sizes16)),
+        Containers::arrayCast<2, Int>(stridedArrayView(sizes)));
+    _sizes = sizes;
+
+    /* Unbounded height, as the items may not end up in the same places after
+       being removed and added again */
+    AtlasLandfill atlas{{data.width, 0}};
+    if(data.flags)
+        atlas.setFlags(*data.flags);
+
+    Containers::Array<Vector2i> offsets{NoInit, _sizes.size()};
+    Containers::BitArray flips{NoInit, _sizes.size()};
+    CORRADE_VERIFY(atlas.add(_sizes, offsets, flips));
+
+    /* Same random sequence every time so the runs are comparable */
+    std::mt19937 rd;
+    Containers::Array<UnsignedInt> indices{NoInit, _sizes.size()};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        indices[i] = i;
+
+    const std::size_t removedCount = std::size_t(_sizes.size()*data.removed);
+    Containers::Array<Vector2i> removedSizes{NoInit, removedCount};
+    Containers::Array<Vector2i> removedOffsets{NoInit, removedCount};
+    Containers::BitArray removedFlips{NoInit, removedCount};
+    CORRADE_BENCHMARK(1) {
+        for(UnsignedInt iteration = 0; iteration != data.iterations; ++iteration) {
+            /* Remove a random subset of the items */
+            std::shuffle(indices.begin(), indices.end(), rd);
+            for(std::size_t i = 0; i != removedCount; ++i) {
+                const UnsignedInt index = indices[i];
+                const Vector2i size = flips[index] ? _sizes[index].flipped() : _sizes[index];
+                atlas.remove({offsets[index], offsets[index] + size});
+                removedSizes[i] = _sizes[index];
+            }
+
+            /* Add them back, which reuses the freed space */
+            CORRADE_VERIFY(atlas.add(removedSizes, removedOffsets, removedFlips));
+            for(std::size_t i = 0; i != removedCount; ++i) {
+                const UnsignedInt index = indices[i];
+                offsets[index] = removedOffsets[i];
+                flips.set(index, removedFlips[i]);
+            }
+
+            /* Optionally repack everything from scratch */
+            if(data.compact)
+                CORRADE_VERIFY(atlas.compact(_sizes, offsets, flips));
+        }
+
+        _filledArea = atlas.filledSize().product();
+    }
+
+    CORRADE_COMPARE_WITH(
+        Containers::pair(Containers::StridedArrayView1D<const Vector2i>{offsets}, Containers::BitArrayView{flips}),
+        _sizes,
+        (CompareAtlasPacking{data.image, atlas.filledSize().xy()}));
+}
+
 void AtlasBenchmark::stbRectPack() {
     auto&& data = StbRectPackData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
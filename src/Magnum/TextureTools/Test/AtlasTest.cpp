@@ -37,12 +37,12 @@
 #include <Corrade/Utility/FormatStl.h>
 
 #include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Test/parallelFor.h"
 #include "Magnum/TextureTools/Atlas.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 #include <vector>
-
-#include "Magnum/Math/Range.h"
 #endif
 
 namespace Magnum { namespace TextureTools { namespace Test { namespace {
@@ -66,6 +66,17 @@ struct AtlasTest: TestSuite::Tester {
     void landfillArrayIncremental();
     void landfillArrayPadded();
     void landfillArrayNoFit();
+    void landfillArrayParallel();
+    void landfillArrayParallelIncremental();
+    void landfillArrayParallelLeftover();
+    void landfillArrayParallelNoFit();
+
+    void landfillRemove();
+    void landfillRemovePadded();
+    void landfillArrayRemove();
+    void landfillCompact();
+    void landfillCompactNoFit();
+    void landfillArrayCompact();
 
     void landfillInvalidSize();
     void landfillSetFlagsInvalid();
@@ -74,6 +85,8 @@ struct AtlasTest: TestSuite::Tester {
     void landfillAddTwoComponentForArray();
     void landfillAddTooLargeElement();
     void landfillAddTooLargeElementPadded();
+    void landfillRemoveInvalid();
+    void landfillCompactInvalid();
 
     #ifdef MAGNUM_BUILD_DEPRECATED
     void deprecatedBasic();
@@ -497,6 +510,8 @@ const struct {
     {"zero", {1024, 0}, "{1024, 0}"},
 };
 
+using Magnum::Test::parallelForReverse;
+
 AtlasTest::AtlasTest() {
     addTests({&AtlasTest::debugLandfillFlag,
               &AtlasTest::debugLandfillFlags,
@@ -520,6 +535,17 @@ AtlasTest::AtlasTest() {
     addTests({&AtlasTest::landfillArrayIncremental,
               &AtlasTest::landfillArrayPadded,
               &AtlasTest::landfillArrayNoFit,
+              &AtlasTest::landfillArrayParallel,
+              &AtlasTest::landfillArrayParallelIncremental,
+              &AtlasTest::landfillArrayParallelLeftover,
+              &AtlasTest::landfillArrayParallelNoFit,
+
+              &AtlasTest::landfillRemove,
+              &AtlasTest::landfillRemovePadded,
+              &AtlasTest::landfillArrayRemove,
+              &AtlasTest::landfillCompact,
+              &AtlasTest::landfillCompactNoFit,
+              &AtlasTest::landfillArrayCompact,
 
               &AtlasTest::landfillInvalidSize,
               &AtlasTest::landfillSetFlagsInvalid,
@@ -528,6 +554,8 @@ AtlasTest::AtlasTest() {
               &AtlasTest::landfillAddTwoComponentForArray,
               &AtlasTest::landfillAddTooLargeElement,
               &AtlasTest::landfillAddTooLargeElementPadded,
+              &AtlasTest::landfillRemoveInvalid,
+              &AtlasTest::landfillCompactInvalid,
 
               #ifdef MAGNUM_BUILD_DEPRECATED
               &AtlasTest::deprecatedBasic,
@@ -783,6 +811,9 @@ void AtlasTest::landfillNoFit() {
     UnsignedByte rotationData[2];
     Containers::MutableBitArrayView rotations{rotationData, 0, Containers::arraySize(LandfillSizes)};
     CORRADE_VERIFY(!atlas.add(LandfillSizes, offsets, rotations));
+
+    /* The atlas is left in the original state, not partially filled */
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{11, 0, 1}));
 }
 
 void AtlasTest::landfillCopy() {
@@ -1015,6 +1046,275 @@ void AtlasTest::landfillArrayNoFit() {
     UnsignedByte rotationData[2];
     Containers::MutableBitArrayView rotations{rotationData, 0, Containers::arraySize(LandfillArraySizes)};
     CORRADE_VERIFY(!atlas.add(LandfillArraySizes, offsets, rotations));
+
+    /* The atlas is left in the original state, not partially filled */
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{11, 6, 0}));
+}
+
+void AtlasTest::landfillArrayParallel() {
+    /* The 16 items fill exactly one slice when added serially */
+    Vector2i sizes[64];
+    for(Vector2i& i: sizes)
+        i = {16, 16};
+    Vector3i expected[16];
+    {
+        AtlasLandfill atlas{{64, 64, 0}};
+        atlas.clearFlags(AtlasLandfillFlag::RotatePortrait);
+        CORRADE_VERIFY(atlas.add(Containers::arrayView(sizes).prefix(16), expected));
+        CORRADE_COMPARE(atlas.filledSize(), (Vector3i{64, 64, 1}));
+    }
+
+    /* All 64 items are distributed round-robin to four slices, each getting
+       filled the same as the single slice above */
+    AtlasLandfill atlas{{64, 64, 0}};
+    atlas.clearFlags(AtlasLandfillFlag::RotatePortrait);
+    Vector3i offsets[64];
+    CORRADE_VERIFY(atlas.add(sizes, offsets, nullptr, parallelForReverse));
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{64, 64, 4}));
+    for(std::size_t i = 0; i != Containers::arraySize(offsets); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(offsets[i], (Vector3i{expected[i/4].xy(), Int(i % 4)}));
+    }
+
+    /* The order of task execution doesn't matter */
+    AtlasLandfill atlasSerial{{64, 64, 0}};
+    atlasSerial.clearFlags(AtlasLandfillFlag::RotatePortrait);
+    Vector3i offsetsSerial[64];
+    CORRADE_VERIFY(atlasSerial.add(sizes, offsetsSerial, nullptr, parallelForSerial));
+    CORRADE_COMPARE_AS(Containers::arrayView(offsetsSerial),
+        Containers::arrayView(offsets),
+        TestSuite::Compare::Container);
+
+    /* Null executor is equivalent to parallelForSerial() */
+    AtlasLandfill atlasNull{{64, 64, 0}};
+    atlasNull.clearFlags(AtlasLandfillFlag::RotatePortrait);
+    Vector3i offsetsNull[64];
+    CORRADE_VERIFY(atlasNull.add(sizes, offsetsNull, nullptr, nullptr));
+    CORRADE_COMPARE_AS(Containers::arrayView(offsetsNull),
+        Containers::arrayView(offsets),
+        TestSuite::Compare::Container);
+}
+
+void AtlasTest::landfillArrayParallelIncremental() {
+    AtlasLandfill atlas{{8, 8, 0}};
+    atlas.clearFlags(AtlasLandfillFlag::RotatePortrait);
+
+    Vector3i offsets[3];
+    CORRADE_VERIFY(atlas.add({{8, 4}}, Containers::arrayView(offsets).prefix(1)));
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{8, 8, 1}));
+
+    /* The existing slice is filled first, only the rest goes to new slices */
+    CORRADE_VERIFY(atlas.add({{8, 4}, {8, 4}, {8, 4}}, offsets, nullptr, parallelForReverse));
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{8, 8, 2}));
+    CORRADE_COMPARE_AS(Containers::arrayView(offsets), Containers::arrayView<Vector3i>({
+        {0, 4, 0},
+        {0, 0, 1},
+        {0, 4, 1}
+    }), TestSuite::Compare::Container);
+}
+
+void AtlasTest::landfillArrayParallelLeftover() {
+    AtlasLandfill atlas{{8, 8, 0}};
+    atlas.clearFlags(AtlasLandfillFlag::RotatePortrait);
+
+    /* The total area is estimated to need two slices. The third item doesn't
+       fit into the first slice along with the first one, so it's placed
+       serially afterwards, ending up in a new slice. */
+    Vector3i offsets[3];
+    CORRADE_VERIFY(atlas.add({{6, 6}, {6, 6}, {6, 6}}, offsets, nullptr, parallelForReverse));
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{8, 8, 3}));
+    CORRADE_COMPARE_AS(Containers::arrayView(offsets), Containers::arrayView<Vector3i>({
+        {0, 0, 0},
+        {0, 0, 1},
+        {0, 0, 2}
+    }), TestSuite::Compare::Container);
+}
+
+void AtlasTest::landfillArrayParallelNoFit() {
+    /* Same as landfillArrayParallelLeftover() but with the depth limited to
+       two slices */
+    AtlasLandfill atlas{{8, 8, 2}};
+    atlas.clearFlags(AtlasLandfillFlag::RotatePortrait);
+
+    Vector3i offsets[3];
+    CORRADE_VERIFY(!atlas.add({{6, 6}, {6, 6}, {6, 6}}, offsets, nullptr, parallelForReverse));
+
+    /* The atlas is left in the original state, not partially filled */
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{8, 8, 0}));
+}
+
+void AtlasTest::landfillRemove() {
+    AtlasLandfill atlas{{8, 8}};
+    atlas.clearFlags(AtlasLandfillFlag::RotatePortrait);
+
+    Vector2i offsets[3];
+    CORRADE_VERIFY(atlas.add({{4, 4}, {4, 4}, {8, 2}}, offsets));
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{8, 6, 1}));
+    CORRADE_COMPARE_AS(Containers::arrayView(offsets), Containers::arrayView<Vector2i>({
+        {0, 0},
+        {4, 0},
+        {0, 4}
+    }), TestSuite::Compare::Container);
+
+    /* Removing an item that's not at the top only remembers the area,
+       zero-area removals are ignored */
+    atlas.remove({{0, 0}, {4, 4}})
+         .remove({{5, 5}, {5, 7}});
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{8, 6, 1}));
+
+    /* Removing the topmost item lowers the filled height back */
+    atlas.remove({{0, 4}, {8, 6}});
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{8, 4, 1}));
+
+    /* Next additions get put into the remembered area */
+    CORRADE_VERIFY(atlas.add({{2, 3}, {1, 4}}, offsets));
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{8, 4, 1}));
+    /* 1...
+       122.
+       122.
+       122. */
+    CORRADE_COMPARE_AS(Containers::arrayView(offsets).prefix(2), Containers::arrayView<Vector2i>({
+        {1, 0},
+        {0, 0}
+    }), TestSuite::Compare::Container);
+
+    /* The leftover 3x1 and 1x3 areas get picked by the best fit, whatever
+       doesn't fit anywhere goes on top */
+    CORRADE_VERIFY(atlas.add({{1, 3}, {3, 1}, {2, 2}}, offsets));
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{8, 6, 1}));
+    CORRADE_COMPARE_AS(Containers::arrayView(offsets), Containers::arrayView<Vector2i>({
+        {3, 0},
+        {1, 3},
+        {0, 4}
+    }), TestSuite::Compare::Container);
+}
+
+void AtlasTest::landfillRemovePadded() {
+    AtlasLandfill atlas{{8, 8}};
+    atlas.clearFlags(AtlasLandfillFlag::RotatePortrait)
+         .setPadding({1, 1});
+
+    Vector2i offsets[3];
+    CORRADE_VERIFY(atlas.add({{2, 2}, {2, 2}, {6, 2}}, offsets));
+    CORRADE_COMPARE_AS(Containers::arrayView(offsets), Containers::arrayView<Vector2i>({
+        {5, 5},
+        {1, 5},
+        {1, 1}
+    }), TestSuite::Compare::Container);
+
+    /* The removed area is expected to include the padding */
+    atlas.remove(Range2Di::fromSize(offsets[2], {6, 2}).padded({1, 1}));
+
+    /* The higher second item goes to the bottom left corner, leaving a 5x4
+       area on the right where the first item goes */
+    CORRADE_VERIFY(atlas.add({{3, 1}, {1, 2}}, offsets));
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{8, 8, 1}));
+    CORRADE_COMPARE_AS(Containers::arrayView(offsets).prefix(2), Containers::arrayView<Vector2i>({
+        {4, 1},
+        {1, 1}
+    }), TestSuite::Compare::Container);
+}
+
+void AtlasTest::landfillArrayRemove() {
+    AtlasLandfill atlas{{4, 4, 2}};
+    atlas.clearFlags(AtlasLandfillFlag::RotatePortrait);
+
+    Vector3i offsets[4];
+    CORRADE_VERIFY(atlas.add({{4, 2}, {4, 2}, {4, 2}, {4, 2}}, offsets));
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{4, 4, 2}));
+    CORRADE_COMPARE_AS(Containers::arrayView(offsets), Containers::arrayView<Vector3i>({
+        {0, 0, 0},
+        {0, 2, 0},
+        {0, 0, 1},
+        {0, 2, 1}
+    }), TestSuite::Compare::Container);
+
+    /* Removing the bottom item in the second slice remembers the area,
+       removing the top one lowers the filled height of the second slice. The
+       first slice is still full, so the item that doesn't fit into the
+       remembered area gets placed on top in the second slice. */
+    atlas.remove(1, {{0, 0}, {4, 2}})
+         .remove(1, {{0, 2}, {4, 4}});
+    CORRADE_VERIFY(atlas.add({{3, 1}, {4, 2}}, Containers::arrayView(offsets).prefix(2)));
+    CORRADE_COMPARE_AS(Containers::arrayView(offsets).prefix(2), Containers::arrayView<Vector3i>({
+        {0, 2, 1},
+        {0, 0, 1}
+    }), TestSuite::Compare::Container);
+}
+
+void AtlasTest::landfillCompact() {
+    AtlasLandfill atlas{{8, 8}};
+    atlas.clearFlags(AtlasLandfillFlag::RotatePortrait);
+
+    Vector2i offsets[3];
+    CORRADE_VERIFY(atlas.add({{4, 4}, {4, 4}, {8, 2}}, offsets));
+    CORRADE_COMPARE_AS(Containers::arrayView(offsets), Containers::arrayView<Vector2i>({
+        {0, 0},
+        {4, 0},
+        {0, 4}
+    }), TestSuite::Compare::Container);
+
+    /* Remove the first item, which remembers the area */
+    atlas.remove({{0, 0}, {4, 4}});
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{8, 6, 1}));
+
+    /* Compacting the remaining two moves the first one to the freed area */
+    CORRADE_VERIFY(atlas.compact({{4, 4}, {8, 2}}, Containers::arrayView(offsets).prefix(2)));
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{8, 6, 1}));
+    CORRADE_COMPARE_AS(Containers::arrayView(offsets).prefix(2), Containers::arrayView<Vector2i>({
+        {0, 0},
+        {0, 4}
+    }), TestSuite::Compare::Container);
+
+    /* The remembered area is discarded, so a next addition goes on top
+       instead of overlapping the moved item */
+    CORRADE_VERIFY(atlas.add({{2, 2}}, Containers::arrayView(offsets).prefix(1)));
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{8, 8, 1}));
+    CORRADE_COMPARE(offsets[0], (Vector2i{0, 6}));
+}
+
+void AtlasTest::landfillCompactNoFit() {
+    AtlasLandfill atlas{{4, 4}};
+    atlas.clearFlags(AtlasLandfillFlag::RotatePortrait);
+
+    Vector2i offsets[3];
+    CORRADE_VERIFY(atlas.add({{2, 2}, {2, 2}, {4, 2}}, offsets));
+    CORRADE_COMPARE_AS(Containers::arrayView(offsets), Containers::arrayView<Vector2i>({
+        {2, 2},
+        {0, 2},
+        {0, 0}
+    }), TestSuite::Compare::Container);
+    atlas.remove({{0, 0}, {4, 2}});
+
+    /* The items don't fit, the state is left untouched */
+    CORRADE_VERIFY(!atlas.compact({{4, 4}, {4, 4}}, Containers::arrayView(offsets).prefix(2)));
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{4, 4, 1}));
+
+    /* Including the remembered removed area */
+    CORRADE_VERIFY(atlas.add({{4, 2}}, Containers::arrayView(offsets).prefix(1)));
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{4, 4, 1}));
+    CORRADE_COMPARE(offsets[0], (Vector2i{0, 0}));
+}
+
+void AtlasTest::landfillArrayCompact() {
+    AtlasLandfill atlas{{4, 4, 2}};
+    atlas.clearFlags(AtlasLandfillFlag::RotatePortrait);
+
+    Vector3i offsets[4];
+    CORRADE_VERIFY(atlas.add({{4, 2}, {4, 2}, {4, 2}, {4, 2}}, offsets));
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{4, 4, 2}));
+
+    /* Remove the bottom item from each slice */
+    atlas.remove(0, {{0, 0}, {4, 2}})
+         .remove(1, {{0, 0}, {4, 2}});
+
+    /* Compacting the remaining two puts them into the first slice */
+    CORRADE_VERIFY(atlas.compact({{4, 2}, {4, 2}}, Containers::arrayView(offsets).prefix(2)));
+    CORRADE_COMPARE(atlas.filledSize(), (Vector3i{4, 4, 1}));
+    CORRADE_COMPARE_AS(Containers::arrayView(offsets).prefix(2), Containers::arrayView<Vector3i>({
+        {0, 0, 0},
+        {0, 2, 0}
+    }), TestSuite::Compare::Container);
 }
 
 void AtlasTest::landfillInvalidSize() {
@@ -1202,6 +1502,70 @@ void AtlasTest::landfillAddTooLargeElementPadded() {
 }
 
 #ifdef MAGNUM_BUILD_DEPRECATED
+void AtlasTest::landfillCompactInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    AtlasLandfill atlas{{16, 23}};
+    AtlasLandfill array{{16, 23, 3}};
+    Vector2i sizes[2];
+    Vector2i offsets[2];
+    Vector2i offsetsInvalid[3];
+    Vector3i offsets3[2];
+    UnsignedByte rotationsData[1];
+    Containers::MutableBitArrayView rotations{rotationsData, 0, 2};
+    Containers::MutableBitArrayView rotationsInvalid{rotationsData, 0, 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    atlas.compact(sizes, offsetsInvalid, rotations);
+    atlas.compact(sizes, offsets, rotationsInvalid);
+    atlas.compact(sizes, offsets);
+    atlas.compact(sizes, offsets3);
+    array.compact(sizes, offsets, rotations);
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::AtlasLandfill::compact(): expected sizes and offsets views to have the same size, got 2 and 3\n"
+        "TextureTools::AtlasLandfill::compact(): expected sizes and rotations views to have the same size, got 2 and 3\n"
+        "TextureTools::AtlasLandfill::compact(): TextureTools::AtlasLandfillFlag::RotatePortrait set, expected a rotations view\n"
+        "TextureTools::AtlasLandfill::compact(): TextureTools::AtlasLandfillFlag::RotatePortrait set, expected a rotations view\n"
+        "TextureTools::AtlasLandfill::compact(): use the three-component overload for an array atlas\n");
+}
+
+void AtlasTest::landfillRemoveInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    AtlasLandfill atlas{{8, 6}};
+    AtlasLandfill array{{8, 6, 2}};
+    atlas.clearFlags(AtlasLandfillFlag::RotatePortrait);
+    array.clearFlags(AtlasLandfillFlag::RotatePortrait);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    /* Nothing added yet */
+    atlas.remove({{0, 0}, {1, 1}});
+
+    Vector2i offsets[1];
+    Vector3i offsets3[1];
+    CORRADE_VERIFY(atlas.add({{8, 6}}, offsets));
+    CORRADE_VERIFY(array.add({{8, 6}}, offsets3));
+    atlas.remove(1, {{0, 0}, {1, 1}});
+    atlas.remove({{-1, 0}, {1, 1}});
+    atlas.remove({{2, 0}, {1, 1}});
+    atlas.remove({{0, 0}, {9, 6}});
+    atlas.remove({{0, 0}, {8, 7}});
+    array.remove(1, {{0, 0}, {1, 1}});
+    array.remove({{0, 0}, {1, 1}});
+    CORRADE_COMPARE_AS(out.str(),
+        "TextureTools::AtlasLandfill::remove(): slice 0 and rectangle {{0, 0}, {1, 1}} out of range for 0 slices of size {8, 6}\n"
+        "TextureTools::AtlasLandfill::remove(): slice 1 and rectangle {{0, 0}, {1, 1}} out of range for 1 slices of size {8, 6}\n"
+        "TextureTools::AtlasLandfill::remove(): slice 0 and rectangle {{-1, 0}, {1, 1}} out of range for 1 slices of size {8, 6}\n"
+        "TextureTools::AtlasLandfill::remove(): slice 0 and rectangle {{2, 0}, {1, 1}} out of range for 1 slices of size {8, 6}\n"
+        "TextureTools::AtlasLandfill::remove(): slice 0 and rectangle {{0, 0}, {9, 6}} out of range for 1 slices of size {8, 6}\n"
+        "TextureTools::AtlasLandfill::remove(): slice 0 and rectangle {{0, 0}, {8, 7}} out of range for 1 slices of size {8, 6}\n"
+        "TextureTools::AtlasLandfill::remove(): slice 1 and rectangle {{0, 0}, {1, 1}} out of range for 1 slices of size {8, 6}\n"
+        "TextureTools::AtlasLandfill::remove(): use the slice overload for an array atlas\n",
+        TestSuite::Compare::String);
+}
+
 void AtlasTest::deprecatedBasic() {
     CORRADE_IGNORE_DEPRECATED_PUSH
     std::vector<Range2Di> atlas = TextureTools::atlas({64, 64}, {
@@ -0,0 +1,655 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Test/parallelFor.h"
+#include "Magnum/TextureTools/BlockCompression.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct BlockCompressionTest: TestSuite::Tester {
+    explicit BlockCompressionTest();
+
+    void bc1Solid();
+    void bc1AlphaPunchThrough();
+    void bc1AlphaTransparent();
+    void bc3Solid();
+    void bc4Solid();
+    void bc5Solid();
+
+    void bc1Gradient();
+    void bc4Gradient();
+
+    void etc2Solid();
+    void etc2Flip();
+    void etc2Differential();
+    void etc2AlphaSolid();
+    void eacR11Gradient();
+    void eacRG11Solid();
+
+    void bc7Solid();
+    void bc7Gradient();
+
+    void edgeClamp();
+    void parallel();
+
+    void invalid();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    PixelFormat format;
+    CompressedPixelFormat compressedFormat;
+    UnsignedInt pixelSize;
+} ParallelData[]{
+    {"BC1", PixelFormat::RGB8Unorm, CompressedPixelFormat::Bc1RGBUnorm, 3},
+    {"BC1 with alpha", PixelFormat::RGBA8Srgb, CompressedPixelFormat::Bc1RGBASrgb, 4},
+    {"BC3", PixelFormat::RGBA8Unorm, CompressedPixelFormat::Bc3RGBAUnorm, 4},
+    {"BC4", PixelFormat::R8Unorm, CompressedPixelFormat::Bc4RUnorm, 1},
+    {"BC5", PixelFormat::RG8Unorm, CompressedPixelFormat::Bc5RGUnorm, 2},
+    {"ETC2", PixelFormat::RGBA8Srgb, CompressedPixelFormat::Etc2RGB8Srgb, 4},
+    {"ETC2 with alpha", PixelFormat::RGBA8Unorm, CompressedPixelFormat::Etc2RGBA8Unorm, 4},
+    {"EAC R11", PixelFormat::R8Unorm, CompressedPixelFormat::EacR11Unorm, 1},
+    {"EAC RG11", PixelFormat::RG8Unorm, CompressedPixelFormat::EacRG11Unorm, 2},
+    {"BC7", PixelFormat::RGBA8Unorm, CompressedPixelFormat::Bc7RGBAUnorm, 4},
+};
+
+BlockCompressionTest::BlockCompressionTest() {
+    addTests({&BlockCompressionTest::bc1Solid,
+              &BlockCompressionTest::bc1AlphaPunchThrough,
+              &BlockCompressionTest::bc1AlphaTransparent,
+              &BlockCompressionTest::bc3Solid,
+              &BlockCompressionTest::bc4Solid,
+              &BlockCompressionTest::bc5Solid,
+
+              &BlockCompressionTest::bc1Gradient,
+              &BlockCompressionTest::bc4Gradient,
+
+              &BlockCompressionTest::etc2Solid,
+              &BlockCompressionTest::etc2Flip,
+              &BlockCompressionTest::etc2Differential,
+              &BlockCompressionTest::etc2AlphaSolid,
+              &BlockCompressionTest::eacR11Gradient,
+              &BlockCompressionTest::eacRG11Solid,
+
+              &BlockCompressionTest::bc7Solid,
+              &BlockCompressionTest::bc7Gradient,
+
+              &BlockCompressionTest::edgeClamp});
+
+    addInstancedTests({&BlockCompressionTest::parallel},
+        Containers::arraySize(ParallelData));
+
+    addTests({&BlockCompressionTest::invalid});
+}
+
+using Magnum::Test::parallelForReverse;
+
+/* Minimal reference decoders, following the BCn specification */
+Color3ub unpackRgb565(const UnsignedShort color) {
+    const UnsignedInt r = color >> 11;
+    const UnsignedInt g = (color >> 5) & 0x3f;
+    const UnsignedInt b = color & 0x1f;
+    return {UnsignedByte((r << 3)|(r >> 2)),
+            UnsignedByte((g << 2)|(g >> 4)),
+            UnsignedByte((b << 3)|(b >> 2))};
+}
+
+void decodeBc1Block(const char* const in, Color4ub(&out)[16]) {
+    const UnsignedShort color0 = UnsignedByte(in[0])|(UnsignedByte(in[1]) << 8);
+    const UnsignedShort color1 = UnsignedByte(in[2])|(UnsignedByte(in[3]) << 8);
+    const Vector3i c0{unpackRgb565(color0)};
+    const Vector3i c1{unpackRgb565(color1)};
+    Color4ub palette[4];
+    palette[0] = {Color3ub{c0}, 255};
+    palette[1] = {Color3ub{c1}, 255};
+    if(color0 > color1) {
+        palette[2] = {Color3ub{(c0*2 + c1)/3}, 255};
+        palette[3] = {Color3ub{(c0 + c1*2)/3}, 255};
+    } else {
+        palette[2] = {Color3ub{(c0 + c1)/2}, 255};
+        palette[3] = {0, 0, 0, 0};
+    }
+
+    for(UnsignedInt i = 0; i != 16; ++i)
+        out[i] = palette[(UnsignedByte(in[4 + i/4]) >> 2*(i%4)) & 3];
+}
+
+void decodeBc4Block(const char* const in, UnsignedByte(&out)[16]) {
+    const Int value0 = UnsignedByte(in[0]);
+    const Int value1 = UnsignedByte(in[1]);
+    Int palette[8];
+    palette[0] = value0;
+    palette[1] = value1;
+    if(value0 > value1) {
+        for(Int i = 1; i != 7; ++i)
+            palette[i + 1] = ((7 - i)*value0 + i*value1)/7;
+    } else {
+        for(Int i = 1; i != 5; ++i)
+            palette[i + 1] = ((5 - i)*value0 + i*value1)/5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    UnsignedLong bits = 0;
+    for(UnsignedInt i = 0; i != 6; ++i)
+        bits |= UnsignedLong(UnsignedByte(in[2 + i])) << 8*i;
+    for(UnsignedInt i = 0; i != 16; ++i)
+        out[i] = palette[(bits >> 3*i) & 7];
+}
+
+/* Minimal reference decoders for the ETC2 individual and differential modes
+   and for EAC, following the ETC2 specification. The 11-bit EAC values are
+   converted back to 8 bits. */
+UnsignedLong readBigEndian(const char* const in) {
+    UnsignedLong out = 0;
+    for(UnsignedInt i = 0; i != 8; ++i)
+        out = (out << 8)|UnsignedByte(in[i]);
+    return out;
+}
+
+void decodeEtc2Block(const char* const in, Color3ub(&out)[16]) {
+    constexpr Int Modifiers[8][4]{
+        {2, 8, -2, -8},
+        {5, 17, -5, -17},
+        {9, 29, -9, -29},
+        {13, 42, -13, -42},
+        {18, 60, -18, -60},
+        {24, 80, -24, -80},
+        {33, 106, -33, -106},
+        {47, 183, -47, -183}
+    };
+
+    const UnsignedLong bits = readBigEndian(in);
+    Vector3i base[2];
+    if(bits & (UnsignedLong(1) << 33)) {
+        const Vector3i color{Int((bits >> 59) & 0x1f), Int((bits >> 51) & 0x1f), Int((bits >> 43) & 0x1f)};
+        /* Sign-extend the 3-bit difference */
+        const Vector3i delta{Int((bits >> 56) & 7), Int((bits >> 48) & 7), Int((bits >> 40) & 7)};
+        const Vector3i color1 = color + delta - 8*Vector3i{delta.x() > 3, delta.y() > 3, delta.z() > 3};
+        base[0] = color*8 + color/4;
+        base[1] = color1*8 + color1/4;
+    } else {
+        base[0] = 17*Vector3i{Int((bits >> 60) & 0xf), Int((bits >> 52) & 0xf), Int((bits >> 44) & 0xf)};
+        base[1] = 17*Vector3i{Int((bits >> 56) & 0xf), Int((bits >> 48) & 0xf), Int((bits >> 40) & 0xf)};
+    }
+    const UnsignedInt table[]{UnsignedInt((bits >> 37) & 7), UnsignedInt((bits >> 34) & 7)};
+    const bool flip = bits & (UnsignedLong(1) << 32);
+
+    for(UnsignedInt y = 0; y != 4; ++y) {
+        for(UnsignedInt x = 0; x != 4; ++x) {
+            const UnsignedInt subblock = flip ? y/2 : x/2;
+            const UnsignedInt bit = x*4 + y;
+            const UnsignedInt index = (((bits >> (16 + bit)) & 1) << 1)|((bits >> bit) & 1);
+            out[y*4 + x] = Color3ub{Math::clamp(base[subblock] + Vector3i{Modifiers[table[subblock]][index]}, 0, 255)};
+        }
+    }
+}
+
+void decodeEacBlock(const char* const in, const bool elevenBit, UnsignedByte(&out)[16]) {
+    constexpr Int Modifiers[16][8]{
+        {-3, -6, -9, -15, 2, 5, 8, 14},
+        {-3, -7, -10, -13, 2, 6, 9, 12},
+        {-2, -5, -8, -13, 1, 4, 7, 12},
+        {-2, -4, -6, -13, 1, 3, 5, 12},
+        {-3, -6, -8, -12, 2, 5, 7, 11},
+        {-3, -7, -9, -11, 2, 6, 8, 10},
+        {-4, -7, -8, -11, 3, 6, 7, 10},
+        {-3, -5, -8, -11, 2, 4, 7, 10},
+        {-2, -6, -8, -10, 1, 5, 7, 9},
+        {-2, -5, -8, -10, 1, 4, 7, 9},
+        {-2, -4, -8, -10, 1, 3, 7, 9},
+        {-2, -5, -7, -10, 1, 4, 6, 9},
+        {-3, -4, -7, -10, 2, 3, 6, 9},
+        {-1, -2, -3, -10, 0, 1, 2, 9},
+        {-4, -6, -8, -9, 3, 5, 7, 8},
+        {-3, -5, -7, -9, 2, 4, 6, 8}
+    };
+
+    const UnsignedLong bits = readBigEndian(in);
+    const Int base = bits >> 56;
+    const Int multiplier = (bits >> 52) & 0xf;
+    const Int* const modifiers = Modifiers[(bits >> 48) & 0xf];
+    for(UnsignedInt y = 0; y != 4; ++y) {
+        for(UnsignedInt x = 0; x != 4; ++x) {
+            const Int modifier = modifiers[(bits >> (45 - 3*(x*4 + y))) & 7];
+            if(elevenBit) {
+                const Int value = Math::clamp(base*8 + 4 + modifier*(multiplier ? multiplier*8 : 1), 0, 2047);
+                out[y*4 + x] = UnsignedByte((value*255 + 1023)/2047);
+            } else out[y*4 + x] = UnsignedByte(Math::clamp(base + modifier*multiplier, 0, 255));
+        }
+    }
+}
+
+/* Handles just mode 6, which is the only mode compressBlocks() produces */
+void decodeBc7Block(const char* const in, Color4ub(&out)[16]) {
+    constexpr Int Weights[16]{0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+    /* Skipping the 7 mode bits, the tests check the first byte directly */
+    UnsignedInt offset = 7;
+    auto read = [&](UnsignedInt count) {
+        UnsignedInt value = 0;
+        for(UnsignedInt i = 0; i != count; ++i, ++offset)
+            value |= ((UnsignedByte(in[offset/8]) >> (offset%8)) & 1) << i;
+        return value;
+    };
+
+    Vector4i endpoints[2];
+    for(UnsignedInt channel = 0; channel != 4; ++channel)
+        for(Vector4i& endpoint: endpoints)
+            endpoint[channel] = read(7) << 1;
+    for(Vector4i& endpoint: endpoints)
+        endpoint += Vector4i{Int(read(1))};
+
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        const Int weight = Weights[read(i == 0 ? 3 : 4)];
+        out[i] = Color4ub{((64 - weight)*endpoints[0] + weight*endpoints[1] + Vector4i{32})/64};
+    }
+}
+
+void BlockCompressionTest::bc1Solid() {
+    Color3ub data[16];
+    for(Color3ub& i: data) i = 0xff0000_rgb;
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {4, 4}, data}, CompressedPixelFormat::Bc1RGBUnorm);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc1RGBUnorm);
+    CORRADE_COMPARE(out.size(), (Vector2i{4, 4}));
+    /* Both endpoints are pure red in RGB565, all indices pointing to the
+       first one */
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x00', '\xf8', '\x00', '\xf8', '\x00', '\x00', '\x00', '\x00'
+    }), TestSuite::Compare::Container);
+}
+
+void BlockCompressionTest::bc1AlphaPunchThrough() {
+    /* Top half opaque, bottom half transparent */
+    Color4ub data[16];
+    for(std::size_t i = 0; i != 16; ++i)
+        data[i] = i < 8 ? 0xff0000ff_rgba : 0x00ff0000_rgba;
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}, CompressedPixelFormat::Bc1RGBAUnorm);
+    /* Equal endpoints mean the three-color mode, transparent pixels use
+       index 3 */
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x00', '\xf8', '\x00', '\xf8', '\x00', '\x00', '\xff', '\xff'
+    }), TestSuite::Compare::Container);
+
+    Color4ub decoded[16];
+    decodeBc1Block(out.data(), decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(decoded[i], i < 8 ? 0xff0000ff_rgba : 0x00000000_rgba);
+    }
+}
+
+void BlockCompressionTest::bc1AlphaTransparent() {
+    const Color4ub data[16]{};
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}, CompressedPixelFormat::Bc1RGBAUnorm);
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x00', '\x00', '\x00', '\x00', '\xff', '\xff', '\xff', '\xff'
+    }), TestSuite::Compare::Container);
+}
+
+void BlockCompressionTest::bc3Solid() {
+    Color4ub data[16];
+    for(Color4ub& i: data) i = 0x00ff0080_rgba;
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::RGBA8Srgb, {4, 4}, data}, CompressedPixelFormat::Bc3RGBASrgb);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc3RGBASrgb);
+    /* Alpha block first, then the color block */
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x80', '\x80', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+        '\xe0', '\x07', '\xe0', '\x07', '\x00', '\x00', '\x00', '\x00'
+    }), TestSuite::Compare::Container);
+}
+
+void BlockCompressionTest::bc4Solid() {
+    UnsignedByte data[16];
+    for(UnsignedByte& i: data) i = 0x80;
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::R8Unorm, {4, 4}, data}, CompressedPixelFormat::Bc4RUnorm);
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x80', '\x80', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00'
+    }), TestSuite::Compare::Container);
+}
+
+void BlockCompressionTest::bc5Solid() {
+    Vector2ub data[16];
+    for(Vector2ub& i: data) i = {10, 200};
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::RG8Unorm, {4, 4}, data}, CompressedPixelFormat::Bc5RGUnorm);
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x0a', '\x0a', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+        '\xc8', '\xc8', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00'
+    }), TestSuite::Compare::Container);
+}
+
+void BlockCompressionTest::bc1Gradient() {
+    /* Colors on a line in each block, which BC1 can represent with just the
+       interpolation and RGB565 quantization error */
+    Color3ub data[8*8];
+    for(std::size_t y = 0; y != 8; ++y) {
+        for(std::size_t x = 0; x != 8; ++x) {
+            const UnsignedByte t = (x + y*8)*4;
+            data[y*8 + x] = {t, UnsignedByte(t/2), UnsignedByte(255 - t)};
+        }
+    }
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {8, 8}, data}, CompressedPixelFormat::Bc1RGBUnorm);
+    CORRADE_COMPARE(out.data().size(), 4*8);
+
+    for(std::size_t block = 0; block != 4; ++block) {
+        CORRADE_ITERATION(block);
+        Color4ub decoded[16];
+        decodeBc1Block(out.data() + block*8, decoded);
+
+        /* The block spans a quarter of the whole range in each channel, so
+           the interpolated palette should be within a sixth of it */
+        for(std::size_t i = 0; i != 16; ++i) {
+            CORRADE_ITERATION(i);
+            const Color3ub expected = data[((block/2)*4 + i/4)*8 + (block%2)*4 + i%4];
+            CORRADE_COMPARE(decoded[i].a(), 255);
+            CORRADE_COMPARE_AS((Math::abs(Vector3i{decoded[i].rgb()} - Vector3i{expected})).max(), 24,
+                TestSuite::Compare::LessOrEqual);
+        }
+    }
+}
+
+void BlockCompressionTest::bc4Gradient() {
+    UnsignedByte data[16];
+    for(std::size_t i = 0; i != 16; ++i)
+        data[i] = 20 + i*14;
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::R8Unorm, {4, 4}, data}, CompressedPixelFormat::Bc4RUnorm);
+    /* Maximum first to select the eight-value mode */
+    CORRADE_COMPARE(UnsignedByte(out.data()[0]), 230);
+    CORRADE_COMPARE(UnsignedByte(out.data()[1]), 20);
+
+    UnsignedByte decoded[16];
+    decodeBc4Block(out.data(), decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        /* Palette values are 30 apart, plus a rounding error */
+        CORRADE_COMPARE_AS(Math::abs(Int(decoded[i]) - Int(data[i])), 16,
+            TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void BlockCompressionTest::etc2Solid() {
+    Color3ub data[16];
+    for(Color3ub& i: data) i = 0x336699_rgb;
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {4, 4}, data}, CompressedPixelFormat::Etc2RGB8Unorm);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Etc2RGB8Unorm);
+    CORRADE_COMPARE(out.size(), (Vector2i{4, 4}));
+    /* The color is exactly representable with 4-bit base colors in the
+       individual mode, all pixels then use the smallest modifier */
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x33', '\x66', '\x99', '\x00', '\x00', '\x00', '\x00', '\x00'
+    }), TestSuite::Compare::Container);
+
+    Color3ub decoded[16];
+    decodeEtc2Block(out.data(), decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(decoded[i], 0x35689b_rgb);
+    }
+}
+
+void BlockCompressionTest::etc2Flip() {
+    /* Top half red, bottom half blue, alpha ignored */
+    Color4ub data[16];
+    for(std::size_t i = 0; i != 16; ++i)
+        data[i] = i < 8 ? 0xff000000_rgba : 0x0000ffff_rgba;
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}, CompressedPixelFormat::Etc2RGB8Unorm);
+    /* The colors are too far apart for the differential mode, the subblocks
+       are on top of each other, so the flip bit is set */
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\xf0', '\x00', '\x0f', '\x01', '\xff', '\xff', '\x00', '\x00'
+    }), TestSuite::Compare::Container);
+
+    Color3ub decoded[16];
+    decodeEtc2Block(out.data(), decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(decoded[i], i < 8 ? 0xfd0000_rgb : 0x0000fd_rgb);
+    }
+}
+
+void BlockCompressionTest::etc2Differential() {
+    /* A smooth gradient, which should pick the differential mode with its
+       higher base color precision */
+    Color3ub data[16];
+    for(UnsignedByte y = 0; y != 4; ++y)
+        for(UnsignedByte x = 0; x != 4; ++x)
+            data[y*4 + x] = {UnsignedByte(100 + x*2 + y), UnsignedByte(60 + x*2 + y), UnsignedByte(40 + x + y)};
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Srgb, {4, 4}, data}, CompressedPixelFormat::Etc2RGB8Srgb);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Etc2RGB8Srgb);
+    CORRADE_VERIFY(out.data()[3] & 0x02);
+
+    Color3ub decoded[16];
+    decodeEtc2Block(out.data(), decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS((Math::abs(Vector3i{decoded[i]} - Vector3i{data[i]})).max(), 5,
+            TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void BlockCompressionTest::etc2AlphaSolid() {
+    Color4ub data[16];
+    for(Color4ub& i: data) i = 0x00ff0080_rgba;
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::RGBA8Srgb, {4, 4}, data}, CompressedPixelFormat::Etc2RGBA8Srgb);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Etc2RGBA8Srgb);
+    /* EAC alpha block first, with the alpha as a base and all pixels using a
+       zero modifier, then the color block */
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x80', '\x1d', '\x92', '\x49', '\x24', '\x92', '\x49', '\x24',
+        '\x00', '\xff', '\x00', '\x00', '\xff', '\xff', '\x00', '\x00'
+    }), TestSuite::Compare::Container);
+
+    UnsignedByte decodedAlpha[16];
+    Color3ub decoded[16];
+    decodeEacBlock(out.data(), false, decodedAlpha);
+    decodeEtc2Block(out.data() + 8, decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(decodedAlpha[i], 0x80);
+        CORRADE_COMPARE(decoded[i], 0x00fd00_rgb);
+    }
+}
+
+void BlockCompressionTest::eacR11Gradient() {
+    UnsignedByte data[16];
+    for(std::size_t i = 0; i != 16; ++i)
+        data[i] = 20 + i*14;
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::R8Unorm, {4, 4}, data}, CompressedPixelFormat::EacR11Unorm);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::EacR11Unorm);
+    CORRADE_COMPARE(out.data().size(), 8);
+
+    UnsignedByte decoded[16];
+    decodeEacBlock(out.data(), true, decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        /* Eight evenly spaced values would be 30 apart, the modifier tables
+           aren't even, so allow for the whole half of that */
+        CORRADE_COMPARE_AS(Math::abs(Int(decoded[i]) - Int(data[i])), 15,
+            TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void BlockCompressionTest::eacRG11Solid() {
+    Vector2ub data[16];
+    for(Vector2ub& i: data) i = {10, 200};
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::RG8Unorm, {4, 4}, data}, CompressedPixelFormat::EacRG11Unorm);
+    /* A zero multiplier uses the modifiers unscaled, which is enough to hit
+       both values exactly in 11 bits */
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x0a', '\x03', '\x24', '\x92', '\x49', '\x24', '\x92', '\x49',
+        '\xc8', '\x02', '\x92', '\x49', '\x24', '\x92', '\x49', '\x24'
+    }), TestSuite::Compare::Container);
+
+    UnsignedByte decoded[2][16];
+    decodeEacBlock(out.data(), true, decoded[0]);
+    decodeEacBlock(out.data() + 8, true, decoded[1]);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(decoded[0][i], 10);
+        CORRADE_COMPARE(decoded[1][i], 200);
+    }
+}
+
+void BlockCompressionTest::bc7Solid() {
+    Color4ub data[16];
+    for(Color4ub& i: data) i = 0x346698aa_rgba;
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}, CompressedPixelFormat::Bc7RGBAUnorm);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc7RGBAUnorm);
+    CORRADE_COMPARE(out.size(), (Vector2i{4, 4}));
+    /* Mode 6, all channels are even so both endpoints are the color with a
+       zero P-bit, and all indices zero */
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x40', '\x8d', '\x66', '\x36', '\x63', '\x32', '\xab', '\x55',
+        '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00'
+    }), TestSuite::Compare::Container);
+
+    Color4ub decoded[16];
+    decodeBc7Block(out.data(), decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(decoded[i], 0x346698aa_rgba);
+    }
+}
+
+void BlockCompressionTest::bc7Gradient() {
+    /* RGB input, which gets an opaque alpha */
+    Color3ub data[16];
+    for(std::size_t i = 0; i != 16; ++i)
+        data[i] = Color3ub(100 + i*6, 60 + i*4, 40 + i*2);
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {4, 4}, data}, CompressedPixelFormat::Bc7RGBAUnorm);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc7RGBAUnorm);
+    CORRADE_COMPARE(out.data().size(), 16);
+
+    Color4ub decoded[16];
+    decodeBc7Block(out.data(), decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_ITERATION(i);
+        /* The gradient lies on a line in the color space, so it's mostly
+           just the 7-bit endpoint quantization that causes errors */
+        CORRADE_COMPARE_AS((Math::abs(Vector4i{decoded[i]} - Vector4i{Color4ub{data[i], 255}})).max(), 2,
+            TestSuite::Compare::LessOrEqual);
+    }
+}
+
+void BlockCompressionTest::edgeClamp() {
+    /* 5x3 image, the last column differs, which should make the second block
+       filled with just that value */
+    UnsignedByte data[8*3];
+    for(std::size_t y = 0; y != 3; ++y)
+        for(std::size_t x = 0; x != 8; ++x)
+            data[y*8 + x] = x < 4 ? 10 : x == 4 ? 200 : 0xee;
+
+    CompressedImage2D out = compressBlocks(ImageView2D{PixelFormat::R8Unorm, {5, 3}, data}, CompressedPixelFormat::Bc4RUnorm);
+    CORRADE_COMPARE(out.size(), (Vector2i{5, 3}));
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x0a', '\x0a', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00',
+        '\xc8', '\xc8', '\x00', '\x00', '\x00', '\x00', '\x00', '\x00'
+    }), TestSuite::Compare::Container);
+}
+
+void BlockCompressionTest::parallel() {
+    auto&& data = ParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Pseudo-random contents with a size that isn't a multiple of the block
+       size */
+    const Vector2i size{13, 9};
+    Containers::Array<char> pixels{NoInit, std::size_t(size.product())*data.pixelSize};
+    UnsignedInt state = 1234;
+    for(char& i: pixels) {
+        state = state*1103515245u + 12345u;
+        i = char(state >> 16);
+    }
+
+    const ImageView2D image{PixelStorage{}.setAlignment(1), data.format, size, pixels};
+    CompressedImage2D expected = compressBlocks(image, data.compressedFormat);
+    CompressedImage2D actual = compressBlocks(image, data.compressedFormat, parallelForReverse);
+    CORRADE_COMPARE(actual.format(), data.compressedFormat);
+    CORRADE_COMPARE(actual.size(), size);
+    CORRADE_COMPARE_AS(actual.data(), expected.data(),
+        TestSuite::Compare::Container);
+
+    /* Null executor is equivalent to parallelForSerial() */
+    CompressedImage2D null = compressBlocks(image, data.compressedFormat, nullptr);
+    CORRADE_COMPARE_AS(null.data(), expected.data(),
+        TestSuite::Compare::Container);
+}
+
+void BlockCompressionTest::invalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[64]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    compressBlocks(ImageView2D{PixelFormat::RGBA8Unorm, {4, 0}, data}, CompressedPixelFormat::Bc1RGBAUnorm);
+    compressBlocks(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}, CompressedPixelFormat::Bc6hRGBUfloat);
+    compressBlocks(ImageView2D{PixelFormat::RGB8Unorm, {4, 4}, data}, CompressedPixelFormat::Bc3RGBAUnorm);
+    compressBlocks(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}, CompressedPixelFormat::Bc1RGBASrgb);
+    compressBlocks(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}, CompressedPixelFormat::EacR11Snorm);
+    compressBlocks(ImageView2D{PixelFormat::RGB8Unorm, {4, 4}, data}, CompressedPixelFormat::Etc2RGBA8Unorm);
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::compressBlocks(): expected a non-empty image, got {4, 0}\n"
+        "TextureTools::compressBlocks(): unsupported format CompressedPixelFormat::Bc6hRGBUfloat\n"
+        "TextureTools::compressBlocks(): PixelFormat::RGB8Unorm can't be compressed to CompressedPixelFormat::Bc3RGBAUnorm\n"
+        "TextureTools::compressBlocks(): PixelFormat::RGBA8Unorm can't be compressed to CompressedPixelFormat::Bc1RGBASrgb\n"
+        "TextureTools::compressBlocks(): unsupported format CompressedPixelFormat::EacR11Snorm\n"
+        "TextureTools::compressBlocks(): PixelFormat::RGB8Unorm can't be compressed to CompressedPixelFormat::Etc2RGBA8Unorm\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::BlockCompressionTest)
@@ -0,0 +1,341 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Test/parallelFor.h"
+#include "Magnum/TextureTools/ConvertPixelFormat.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct ConvertPixelFormatTest: TestSuite::Tester {
+    explicit ConvertPixelFormatTest();
+
+    void convertible();
+
+    void expandChannels();
+    void reduceChannels();
+    void swizzle();
+    void clamp();
+    void half();
+    void srgbRoundTrip();
+
+    void into();
+    void parallel();
+
+    void invalid();
+    void intoInvalid();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    PixelFormat format, intermediateFormat;
+} SrgbRoundTripData[]{
+    {"R8Srgb through R32F", PixelFormat::R8Srgb, PixelFormat::R32F},
+    {"RG8Srgb through RG16F", PixelFormat::RG8Srgb, PixelFormat::RG16F},
+    {"RGB8Srgb through RGB32F", PixelFormat::RGB8Srgb, PixelFormat::RGB32F},
+    {"RGBA8Srgb through RGBA16F", PixelFormat::RGBA8Srgb, PixelFormat::RGBA16F},
+};
+
+const struct {
+    const char* name;
+    PixelFormat format, outputFormat;
+    const char* swizzle;
+} ParallelData[]{
+    {"RGB8Unorm to RGBA8Srgb", PixelFormat::RGB8Unorm, PixelFormat::RGBA8Srgb, ""},
+    {"RGBA8Srgb to RGBA16F, swizzled", PixelFormat::RGBA8Srgb, PixelFormat::RGBA16F, "bgra"},
+    {"RG16Snorm to R8Unorm", PixelFormat::RG16Snorm, PixelFormat::R8Unorm, "g"},
+};
+
+ConvertPixelFormatTest::ConvertPixelFormatTest() {
+    addTests({&ConvertPixelFormatTest::convertible,
+
+              &ConvertPixelFormatTest::expandChannels,
+              &ConvertPixelFormatTest::reduceChannels,
+              &ConvertPixelFormatTest::swizzle,
+              &ConvertPixelFormatTest::clamp,
+              &ConvertPixelFormatTest::half});
+
+    addInstancedTests({&ConvertPixelFormatTest::srgbRoundTrip},
+        Containers::arraySize(SrgbRoundTripData));
+
+    addTests({&ConvertPixelFormatTest::into});
+
+    addInstancedTests({&ConvertPixelFormatTest::parallel},
+        Containers::arraySize(ParallelData));
+
+    addTests({&ConvertPixelFormatTest::invalid,
+              &ConvertPixelFormatTest::intoInvalid});
+}
+
+using Magnum::Test::parallelForReverse;
+
+void ConvertPixelFormatTest::convertible() {
+    CORRADE_VERIFY(isPixelFormatConvertible(PixelFormat::R8Unorm));
+    CORRADE_VERIFY(isPixelFormatConvertible(PixelFormat::RG8Snorm));
+    CORRADE_VERIFY(isPixelFormatConvertible(PixelFormat::RGB8Srgb));
+    CORRADE_VERIFY(isPixelFormatConvertible(PixelFormat::RGBA16Unorm));
+    CORRADE_VERIFY(isPixelFormatConvertible(PixelFormat::R16Snorm));
+    CORRADE_VERIFY(isPixelFormatConvertible(PixelFormat::RG16F));
+    CORRADE_VERIFY(isPixelFormatConvertible(PixelFormat::RGBA32F));
+
+    CORRADE_VERIFY(!isPixelFormatConvertible(PixelFormat::RGBA8UI));
+    CORRADE_VERIFY(!isPixelFormatConvertible(PixelFormat::R32I));
+    CORRADE_VERIFY(!isPixelFormatConvertible(PixelFormat::Depth32F));
+    CORRADE_VERIFY(!isPixelFormatConvertible(PixelFormat::Depth24UnormStencil8UI));
+    CORRADE_VERIFY(!isPixelFormatConvertible(pixelFormatWrap(0xdead)));
+}
+
+void ConvertPixelFormatTest::expandChannels() {
+    const Color3ub data[]{
+        0xff3366_rgb, 0x000000_rgb,
+        0x1020ff_rgb, 0xcafe00_rgb,
+    };
+
+    Image2D out = convertPixelFormat(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {2, 2}, data}, PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(out.format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(out.size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color4ub>(out.data()), Containers::arrayView<Color4ub>({
+        0xff3366ff_rgba, 0x000000ff_rgba,
+        0x1020ffff_rgba, 0xcafe00ff_rgba
+    }), TestSuite::Compare::Container);
+
+    /* Missing green and blue is filled with zeros */
+    const UnsignedByte dataR[]{0x33, 0xcc, 0, 0};
+    Image2D outR = convertPixelFormat(ImageView2D{PixelFormat::R8Unorm, {2, 1}, dataR}, PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const Color4ub>(outR.data()), Containers::arrayView<Color4ub>({
+        0x330000ff_rgba, 0xcc0000ff_rgba
+    }), TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::reduceChannels() {
+    const Color4ub data[]{
+        0xff336699_rgba, 0x102030ff_rgba
+    };
+
+    /* The output rows are padded to four bytes */
+    Image2D out = convertPixelFormat(ImageView2D{PixelFormat::RGBA8Unorm, {1, 2}, data}, PixelFormat::RG8Unorm);
+    CORRADE_COMPARE(out.format(), PixelFormat::RG8Unorm);
+    CORRADE_COMPARE(out.size(), (Vector2i{1, 2}));
+    CORRADE_COMPARE_AS(out.pixels<Vector2ub>().transposed<0, 1>()[0], Containers::stridedArrayView<Vector2ub>({
+        {0xff, 0x33}, {0x10, 0x20}
+    }), TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::swizzle() {
+    const Color3ub data[]{
+        0xff3366_rgb, 0x102030_rgb,
+    };
+    const ImageView2D image{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {2, 1}, data};
+
+    /* BGR to RGB */
+    Image2D bgr = convertPixelFormat(image, PixelFormat::RGB8Unorm, "bgr");
+    CORRADE_COMPARE_AS(bgr.pixels<Color3ub>()[0], Containers::stridedArrayView<Color3ub>({
+        0x6633ff_rgb, 0x302010_rgb
+    }), TestSuite::Compare::Container);
+
+    /* Alpha not present in the input is 1, constants */
+    Image2D constants = convertPixelFormat(image, PixelFormat::RGBA8Unorm, "a01g");
+    CORRADE_COMPARE_AS(constants.pixels<Color4ub>()[0], Containers::stridedArrayView<Color4ub>({
+        0xff00ff33_rgba, 0xff00ff20_rgba
+    }), TestSuite::Compare::Container);
+
+    /* Single channel broadcast */
+    Image2D broadcast = convertPixelFormat(image, PixelFormat::RGB8Unorm, "ggg");
+    CORRADE_COMPARE_AS(broadcast.pixels<Color3ub>()[0], Containers::stridedArrayView<Color3ub>({
+        0x333333_rgb, 0x202020_rgb
+    }), TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::clamp() {
+    const Vector2 data[]{
+        {-0.5f, 1.5f},
+        {0.5f, -2.0f}
+    };
+    const ImageView2D image{PixelFormat::RG32F, {2, 1}, data};
+
+    Image2D unsignedNormalized = convertPixelFormat(image, PixelFormat::RG8Unorm);
+    CORRADE_COMPARE_AS(unsignedNormalized.pixels<Vector2ub>()[0], Containers::stridedArrayView<Vector2ub>({
+        {0, 255}, {128, 0}
+    }), TestSuite::Compare::Container);
+
+    Image2D normalized = convertPixelFormat(image, PixelFormat::RG16Snorm);
+    CORRADE_COMPARE_AS(normalized.pixels<Vector2s>()[0], Containers::stridedArrayView<Vector2s>({
+        {-16384, 32767}, {16384, -32767}
+    }), TestSuite::Compare::Container);
+
+    Image2D srgb = convertPixelFormat(image, PixelFormat::RG8Srgb);
+    CORRADE_COMPARE_AS(srgb.pixels<Vector2ub>()[0], Containers::stridedArrayView<Vector2ub>({
+        {0, 255}, {188, 0}
+    }), TestSuite::Compare::Container);
+
+    /* Floating-point outputs aren't clamped */
+    Image2D floatingPoint = convertPixelFormat(image, PixelFormat::RG16F);
+    CORRADE_COMPARE_AS(floatingPoint.pixels<Vector2h>()[0], Containers::stridedArrayView<Vector2h>({
+        {-0.5_h, 1.5_h}, {0.5_h, -2.0_h}
+    }), TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::half() {
+    const Vector4h data[]{
+        {0.0_h, 0.25_h, 1.0_h, 0.5_h},
+        {2.0_h, -1.0_h, 0.75_h, 1.0_h}
+    };
+
+    Image2D out = convertPixelFormat(ImageView2D{PixelFormat::RGBA16F, {2, 1}, data}, PixelFormat::RGBA16Unorm);
+    CORRADE_COMPARE_AS(out.pixels<Vector4us>()[0], Containers::stridedArrayView<Vector4us>({
+        {0, 16384, 65535, 32768},
+        {65535, 0, 49151, 65535}
+    }), TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::srgbRoundTrip() {
+    auto&& data = SrgbRoundTripData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* All 256 values in each channel, with each channel shifted to not have
+       all of them equal */
+    const std::size_t channelCount = pixelFormatChannelCount(data.format);
+    Containers::Array<UnsignedByte> pixels{NoInit, 256*channelCount};
+    for(std::size_t i = 0; i != 256; ++i)
+        for(std::size_t j = 0; j != channelCount; ++j)
+            pixels[i*channelCount + j] = UnsignedByte(i + j*64);
+
+    const ImageView2D image{PixelStorage{}.setAlignment(1), data.format, {16, 16}, pixels};
+    Image2D intermediate = convertPixelFormat(image, data.intermediateFormat);
+    CORRADE_COMPARE(intermediate.format(), data.intermediateFormat);
+
+    Image2D out{PixelStorage{}.setAlignment(1), data.format, {16, 16}, Containers::Array<char>{NoInit, pixels.size()}};
+    convertPixelFormatInto(intermediate, out);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(out.data()), pixels,
+        TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::into() {
+    /* Input with padded rows and skipped pixels, output with an odd row
+       length */
+    const Color4ub data[]{
+        {}, 0x336699ff_rgba, 0x66993300_rgba, {},
+        {}, 0x99336680_rgba, 0xffffffff_rgba, {},
+    };
+    const ImageView2D src{PixelStorage{}.setRowLength(4).setSkip({1, 0, 0}), PixelFormat::RGBA8Unorm, {2, 2}, data};
+
+    UnsignedByte outData[]{
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee
+    };
+    const MutableImageView2D dst{PixelStorage{}.setAlignment(1).setRowLength(3).setSkip({0, 1, 0}), PixelFormat::R8Unorm, {2, 2}, outData};
+    convertPixelFormatInto(src, dst, "b");
+    CORRADE_COMPARE_AS(Containers::arrayView(outData), Containers::arrayView<UnsignedByte>({
+        0xee, 0xee, 0xee,
+        0x99, 0x33, 0xee,
+        0x66, 0xff, 0xee,
+        0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee
+    }), TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::parallel() {
+    auto&& data = ParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Pseudo-random contents, large enough to be split into more than one
+       task. The width is chosen so the output rows have no padding. */
+    const Vector2i size{1012, 67};
+    const std::size_t pixelSize = pixelFormatSize(data.format);
+    Containers::Array<char> pixels{NoInit, std::size_t(size.product())*pixelSize};
+    UnsignedInt state = 1234;
+    for(char& i: pixels) {
+        state = state*1103515245u + 12345u;
+        i = char(state >> 16);
+    }
+
+    const ImageView2D image{PixelStorage{}.setAlignment(1), data.format, size, pixels};
+    Image2D expected = convertPixelFormat(image, data.outputFormat, data.swizzle);
+    Image2D actual = convertPixelFormat(image, data.outputFormat, data.swizzle, parallelForReverse);
+    CORRADE_COMPARE(actual.format(), data.outputFormat);
+    CORRADE_COMPARE(actual.size(), size);
+    CORRADE_COMPARE_AS(actual.data(), expected.data(),
+        TestSuite::Compare::Container);
+
+    /* Null executor is equivalent to parallelForSerial() */
+    Image2D null = convertPixelFormat(image, data.outputFormat, data.swizzle, nullptr);
+    CORRADE_COMPARE_AS(null.data(), expected.data(),
+        TestSuite::Compare::Container);
+}
+
+void ConvertPixelFormatTest::invalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[64]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    convertPixelFormat(ImageView2D{PixelFormat::RGBA8UI, {4, 4}, data}, PixelFormat::RGBA8Unorm);
+    convertPixelFormat(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}, PixelFormat::Depth32F);
+    convertPixelFormat(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}, PixelFormat::RGB8Unorm, "rgba");
+    convertPixelFormat(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}, PixelFormat::RGB8Unorm, "rgx");
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::convertPixelFormat(): unsupported input format PixelFormat::RGBA8UI\n"
+        "TextureTools::convertPixelFormat(): unsupported output format PixelFormat::Depth32F\n"
+        "TextureTools::convertPixelFormat(): invalid swizzle rgba for PixelFormat::RGB8Unorm\n"
+        "TextureTools::convertPixelFormat(): invalid swizzle rgx for PixelFormat::RGB8Unorm\n");
+}
+
+void ConvertPixelFormatTest::intoInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[64]{};
+    char outData[64];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    convertPixelFormatInto(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}, MutableImageView2D{PixelFormat::RGBA8Unorm, {4, 3}, outData});
+    convertPixelFormatInto(ImageView2D{PixelFormat::R32UI, {4, 4}, data}, MutableImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, outData});
+    convertPixelFormatInto(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}, MutableImageView2D{PixelFormat::RGBA8I, {4, 4}, outData});
+    convertPixelFormatInto(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}, MutableImageView2D{PixelFormat::RG8Unorm, {4, 4}, outData}, "r");
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::convertPixelFormatInto(): expected output size to be {4, 4} but got {4, 3}\n"
+        "TextureTools::convertPixelFormatInto(): unsupported input format PixelFormat::R32UI\n"
+        "TextureTools::convertPixelFormatInto(): unsupported output format PixelFormat::RGBA8I\n"
+        "TextureTools::convertPixelFormatInto(): invalid swizzle r for PixelFormat::RG8Unorm\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::ConvertPixelFormatTest)
@@ -0,0 +1,189 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/DebugTools/TextureImage.h"
+#include "Magnum/GL/Context.h"
+#include "Magnum/GL/Extensions.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/TextureTools/DepthPyramidGL.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct DepthPyramidGLTest: GL::OpenGLTester {
+    explicit DepthPyramidGLTest();
+
+    void constructCopy();
+    void constructMove();
+
+    void run();
+
+    void invalidLevelCount();
+    void sameInputOutput();
+};
+
+const struct {
+    const char* name;
+    Vector2i size;
+    Int levelCount;
+} RunData[]{
+    {"", {16, 8}, 5},
+    {"odd size", {13, 7}, 4},
+    {"not all levels", {16, 8}, 3},
+};
+
+DepthPyramidGLTest::DepthPyramidGLTest() {
+    addTests({&DepthPyramidGLTest::constructCopy,
+              &DepthPyramidGLTest::constructMove});
+
+    addInstancedTests({&DepthPyramidGLTest::run},
+        Containers::arraySize(RunData));
+
+    addTests({&DepthPyramidGLTest::invalidLevelCount,
+              &DepthPyramidGLTest::sameInputOutput});
+}
+
+void DepthPyramidGLTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<DepthPyramidGL>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<DepthPyramidGL>{});
+}
+
+void DepthPyramidGLTest::constructMove() {
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<DepthPyramidGL>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<DepthPyramidGL>::value);
+}
+
+void DepthPyramidGLTest::run() {
+    auto&& data = RunData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifdef MAGNUM_TARGET_GLES
+    if(!GL::Context::current().isExtensionSupported<GL::Extensions::EXT::color_buffer_float>())
+        CORRADE_SKIP(GL::Extensions::EXT::color_buffer_float::string() << "is not supported.");
+    #endif
+
+    /* Values that are exactly representable so the comparison can be exact */
+    Containers::Array<Float> input{NoInit, std::size_t(data.size.product())};
+    for(std::size_t i = 0; i != input.size(); ++i)
+        input[i] = Float((i*37) % 256)/256.0f;
+
+    GL::Texture2D depth;
+    depth.setMinificationFilter(GL::SamplerFilter::Nearest)
+        .setMagnificationFilter(GL::SamplerFilter::Nearest)
+        .setStorage(1, GL::TextureFormat::DepthComponent32F, data.size)
+        .setSubImage(0, {}, ImageView2D{PixelFormat::Depth32F, data.size, input});
+
+    GL::Texture2D output;
+    output.setMinificationFilter(GL::SamplerFilter::Nearest, GL::SamplerMipmap::Nearest)
+        .setMagnificationFilter(GL::SamplerFilter::Nearest)
+        .setStorage(data.levelCount, GL::TextureFormat::RG32F, data.size);
+
+    DepthPyramidGL pyramid;
+    pyramid(depth, data.size, output, data.levelCount);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Calculate the expected levels on the CPU, with the odd sizes including
+       also the third partially covered pixel */
+    Containers::Array<Vector2> expected{NoInit, input.size()};
+    for(std::size_t i = 0; i != input.size(); ++i)
+        expected[i] = Vector2{input[i]};
+    Vector2i size = data.size;
+    for(Int level = 0; level != data.levelCount; ++level) {
+        CORRADE_ITERATION(level);
+
+        if(level) {
+            const Vector2i outputSize = Math::max(size/2, Vector2i{1});
+            const Vector2i extent = Vector2i{2} + (size & Vector2i{1});
+            Containers::Array<Vector2> reduced{NoInit, std::size_t(outputSize.product())};
+            for(Int y = 0; y != outputSize.y(); ++y) for(Int x = 0; x != outputSize.x(); ++x) {
+                Vector2 minMax = expected[Math::min(2*y, size.y() - 1)*size.x() + Math::min(2*x, size.x() - 1)];
+                for(Int j = 0; j != extent.y(); ++j) for(Int i = 0; i != extent.x(); ++i) {
+                    const Vector2 value = expected[Math::min(2*y + j, size.y() - 1)*size.x() + Math::min(2*x + i, size.x() - 1)];
+                    minMax = {Math::min(minMax.x(), value.x()),
+                              Math::max(minMax.y(), value.y())};
+                }
+                reduced[y*outputSize.x() + x] = minMax;
+            }
+            expected = Utility::move(reduced);
+            size = outputSize;
+        }
+
+        Image2D actual = DebugTools::textureSubImage(output, level, {{}, size}, Image2D{PixelFormat::RG32F});
+
+        MAGNUM_VERIFY_NO_GL_ERROR();
+
+        CORRADE_COMPARE_AS(actual.pixels<Vector2>().asContiguous(),
+            Containers::arrayView(expected),
+            TestSuite::Compare::Container);
+    }
+}
+
+void DepthPyramidGLTest::invalidLevelCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    GL::Texture2D depth, output;
+    DepthPyramidGL pyramid;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    pyramid(depth, {0, 4}, output, 1);
+    pyramid(depth, {16, 8}, output, 0);
+    pyramid(depth, {16, 8}, output, 6);
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::DepthPyramidGL: expected a non-empty size, got {0, 4}\n"
+        "TextureTools::DepthPyramidGL: expected level count to be between 1 and 5 for size {16, 8} but got 0\n"
+        "TextureTools::DepthPyramidGL: expected level count to be between 1 and 5 for size {16, 8} but got 6\n");
+}
+
+void DepthPyramidGLTest::sameInputOutput() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    GL::Texture2D texture;
+    DepthPyramidGL pyramid;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    pyramid(texture, {16, 8}, texture, 1);
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::DepthPyramidGL: the input and output texture can't be the same\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::DepthPyramidGLTest)
@@ -0,0 +1,405 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Path.h>
+
+#ifdef CORRADE_TARGET_APPLE
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Utility/System.h> /* isSandboxed() */
+#endif
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/DebugTools/CompareImage.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Test/parallelFor.h"
+#include "Magnum/TextureTools/DistanceFieldCpu.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct DistanceFieldCpuTest: TestSuite::Tester {
+    explicit DistanceFieldCpuTest();
+
+    void small();
+    void reference();
+    void run();
+    void parallel();
+    void sizeRatioNotMultipleOfTwo();
+
+    void benchmark();
+
+    private:
+        PluginManager::Manager<Trade::AbstractImporter> _manager{"nonexistent"};
+        Containers::String _testDir;
+};
+
+const struct {
+    const char* name;
+    Vector2i inputSize, outputSize;
+    UnsignedInt radius;
+} ReferenceData[]{
+    {"radius 1", {16, 16}, {8, 8}, 1},
+    {"radius 3, size ratio 4", {32, 32}, {8, 8}, 3},
+    /* Column ranges not aligned to four pixels and not a multiple of four
+       long, verifying the remainder handling in SIMD variants */
+    {"radius 6, odd output width", {46, 20}, {23, 10}, 6},
+    {"radius 13, different ratio on each axis", {60, 24}, {15, 12}, 13},
+    {"radius larger than the image", {24, 12}, {6, 6}, 40},
+};
+
+const struct {
+    const char* name;
+    Vector2i size;
+    Vector2i offset;
+    bool flipX, flipY;
+} RunData[]{
+    {"", {64, 64}, {}, false, false},
+    {"flipped on X", {64, 64}, {}, true, false},
+    {"flipped on Y", {64, 64}, {}, false, true},
+    {"with offset", {128, 96}, {64, 32}, false, false},
+};
+
+const struct {
+    const char* name;
+    std::size_t threadCount;
+} BenchmarkData[]{
+    {"serial", 0},
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    {"4 threads", 4},
+    #endif
+};
+
+DistanceFieldCpuTest::DistanceFieldCpuTest() {
+    addTests({&DistanceFieldCpuTest::small});
+
+    addInstancedTests({&DistanceFieldCpuTest::reference},
+        Containers::arraySize(ReferenceData));
+
+    addInstancedTests({&DistanceFieldCpuTest::run},
+        Containers::arraySize(RunData));
+
+    addTests({&DistanceFieldCpuTest::parallel,
+              &DistanceFieldCpuTest::sizeRatioNotMultipleOfTwo});
+
+    addInstancedBenchmarks({&DistanceFieldCpuTest::benchmark}, 10,
+        Containers::arraySize(BenchmarkData));
+
+    /* Load the plugin directly from the build tree. Otherwise it's either
+       static and already loaded or not present in the build tree */
+    #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(ANYIMAGEIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+    #ifdef TGAIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(TGAIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    #ifdef CORRADE_TARGET_APPLE
+    if(Utility::System::isSandboxed()
+        #if defined(CORRADE_TARGET_IOS) && defined(CORRADE_TESTSUITE_TARGET_XCTEST)
+        /** @todo Fix this once I persuade CMake to run XCTest tests properly */
+        && std::getenv("SIMULATOR_UDID")
+        #endif
+    ) {
+        _testDir = Utility::Path::join(Utility::Path::split(*Utility::Path::executableLocation()).first(), "DistanceFieldGLTestFiles");
+    } else
+    #endif
+    {
+        _testDir = Utility::Path::join(TEXTURETOOLS_TEST_DIR, "DistanceFieldGLTestFiles");
+    }
+}
+
+using Magnum::Test::parallelForReverse;
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+using Magnum::Test::parallelForThreads;
+#endif
+
+void DistanceFieldCpuTest::small() {
+    /* Rows are bottom to top, same as with GL textures. Pixels outside of the
+       image are treated as not set, so the fully inside output pixels are
+       affected by the image edges as well. */
+    const char input[]{
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 1, 0, 0, 0,
+        0, 0, 1, 1, 1, 1, 0, 0,
+        0, 0, 1, 1, 1, 1, 1, 0,
+        0, 0, 0, 1, 1, 1, 0, 0,
+        0, 0, 0, 0, 1, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+    };
+    UnsignedByte inputBytes[8*8];
+    for(std::size_t i = 0; i != Containers::arraySize(input); ++i)
+        inputBytes[i] = input[i] ? 0xff : 0x00;
+
+    UnsignedByte output[4*4];
+    distanceFieldInto(Containers::StridedArrayView2D<const UnsignedByte>{inputBytes, {8, 8}}, Containers::StridedArrayView2D<UnsignedByte>{output, {4, 4}}, 2);
+    CORRADE_COMPARE_AS(Containers::arrayView(output), Containers::arrayView<UnsignedByte>({
+         19,  91,  91,  19,
+         47, 208, 208,  91,
+         19,  91, 128,  47,
+          0,  19,  47,   0
+    }), TestSuite::Compare::Container);
+}
+
+/* Straightforward implementation going through all pixels in the radius for
+   every output pixel, against which the separable implementation with SIMD
+   inner loops is verified. The four cases are the same as in the GL shader,
+   distances are in units of half a pixel and capped to the radius on the
+   vertical axis. */
+void distanceFieldReference(const Containers::StridedArrayView2D<const UnsignedByte>& input, const Containers::StridedArrayView2D<UnsignedByte>& output, const Int radius) {
+    const Int width = input.size()[1];
+    const Int height = input.size()[0];
+    const Vector2i ratio{width/Int(output.size()[1]), height/Int(output.size()[0])};
+    /* Pixels outside of the image are treated as not set */
+    const auto isSet = [&](const Int x, const Int y) {
+        return x >= 0 && y >= 0 && x < width && y < height && input[y][x] >= 128;
+    };
+    const Int maxDistance = 2*radius + 1;
+
+    for(Int y = 0; y != Int(output.size()[0]); ++y) {
+        for(Int x = 0; x != Int(output.size()[1]); ++x) {
+            const Int centerColumn = x*ratio.x() + ratio.x()/2 - 1;
+            const Int centerRow = y*ratio.y() + ratio.y()/2 - 1;
+            const bool i = isSet(centerColumn, centerRow);
+            const bool l = isSet(centerColumn + 1, centerRow + 1);
+            const Int sum = Int(i) + Int(isSet(centerColumn + 1, centerRow)) + Int(isSet(centerColumn, centerRow + 1)) + Int(l);
+
+            const bool isInside = sum == 4;
+            Float minDistance;
+            if(sum == 3 || (sum == 2 && i == l))
+                minDistance = 0.0f;
+            else if(sum == 2)
+                minDistance = 0.5f;
+            else if(sum == 1)
+                minDistance = 0.7071067811865475f;
+            else {
+                UnsignedInt minDistanceSquared = maxDistance*maxDistance;
+                for(Int column = centerColumn - radius + 1; column <= centerColumn + radius; ++column) {
+                    for(Int row = -1; row <= height; ++row) {
+                        if(isSet(column, row) == isInside)
+                            continue;
+
+                        const Int distanceX = 2*(column - centerColumn) - 1;
+                        const Int distanceY = Math::min(Math::abs(2*(row - centerRow) - 1), maxDistance);
+                        minDistanceSquared = Math::min(minDistanceSquared, UnsignedInt(distanceX*distanceX + distanceY*distanceY));
+                    }
+                }
+                minDistance = std::sqrt(Float(minDistanceSquared)*0.25f);
+            }
+
+            const Float halfSign = isInside ? 0.5f : -0.5f;
+            output[y][x] = Math::pack<UnsignedByte>(Math::clamp(halfSign*minDistance/(Float(radius) + 0.5f) + 0.5f, 0.0f, 1.0f));
+        }
+    }
+}
+
+void DistanceFieldCpuTest::reference() {
+    auto&& data = ReferenceData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* A few overlapping circles and stripes, giving both large areas and
+       single-pixel details */
+    Containers::Array<UnsignedByte> inputData{NoInit, std::size_t(data.inputSize.product())};
+    const Containers::StridedArrayView2D<UnsignedByte> input{inputData, {std::size_t(data.inputSize.y()), std::size_t(data.inputSize.x())}};
+    for(Int y = 0; y != data.inputSize.y(); ++y) {
+        for(Int x = 0; x != data.inputSize.x(); ++x) {
+            const bool set =
+                (x - 10)*(x - 10) + (y - 6)*(y - 6) < 30 ||
+                (x - 31)*(x - 31) + (y - 13)*(y - 13) < 60 ||
+                (x + 2*y) % 17 == 0;
+            input[y][x] = set ? 0xff : 0x00;
+        }
+    }
+
+    Containers::Array<UnsignedByte> expected{NoInit, std::size_t(data.outputSize.product())};
+    Containers::Array<UnsignedByte> actual{NoInit, std::size_t(data.outputSize.product())};
+    const Containers::Size2D outputSize{std::size_t(data.outputSize.y()), std::size_t(data.outputSize.x())};
+    distanceFieldReference(input, Containers::StridedArrayView2D<UnsignedByte>{expected, outputSize}, data.radius);
+    distanceFieldInto(input, Containers::StridedArrayView2D<UnsignedByte>{actual, outputSize}, data.radius);
+    CORRADE_COMPARE_AS(actual, expected, TestSuite::Compare::Container);
+}
+
+void DistanceFieldCpuTest::run() {
+    auto&& data = RunData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<Trade::AbstractImporter> importer;
+    if(!(importer = _manager.loadAndInstantiate("TgaImporter")))
+        CORRADE_SKIP("TgaImporter plugin not found.");
+
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(_testDir, "input.tga")));
+    CORRADE_COMPARE(importer->image2DCount(), 1);
+    Containers::Optional<Trade::ImageData2D> inputImage = importer->image2D(0);
+    CORRADE_VERIFY(inputImage);
+    CORRADE_COMPARE(inputImage->format(), PixelFormat::R8Unorm);
+
+    /* Flip the input if desired */
+    if(data.flipX)
+        Utility::flipInPlace<1>(inputImage->mutablePixels());
+    if(data.flipY)
+        Utility::flipInPlace<0>(inputImage->mutablePixels());
+
+    /* Fill the output with some data to verify they aren't accidentally
+       overwritten when running on just a subrectangle */
+    Containers::Array<UnsignedByte> outputData{DirectInit, std::size_t(data.size.product()), UnsignedByte{0x66}};
+    const Containers::StridedArrayView2D<UnsignedByte> output{outputData, {std::size_t(data.size.y()), std::size_t(data.size.x())}};
+    const Containers::StridedArrayView2D<UnsignedByte> outputRectangle = output.sliceSize(
+        {std::size_t(data.offset.y()), std::size_t(data.offset.x())}, {64, 64});
+
+    distanceFieldInto(inputImage->pixels<UnsignedByte>(), outputRectangle, 32);
+
+    if(data.offset.product())
+        CORRADE_COMPARE(output[0][0], 0x66);
+
+    if(!(_manager.loadState("AnyImageImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("AnyImageImporter plugin not found.");
+
+    /* Flip the output back */
+    if(data.flipX)
+        Utility::flipInPlace<1>(outputRectangle);
+    if(data.flipY)
+        Utility::flipInPlace<0>(outputRectangle);
+
+    CORRADE_COMPARE_WITH(
+        Containers::StridedArrayView2D<const UnsignedByte>{outputRectangle},
+        Utility::Path::join(_testDir, "output.tga"),
+        /* The ground truth is generated by DistanceFieldGL, which differs by
+           one in a small amount of pixels, likely due to a different floating
+           point rounding on the GPU */
+        (DebugTools::CompareImageToFile{_manager, 1.0f, 0.01f}));
+}
+
+void DistanceFieldCpuTest::parallel() {
+    Containers::Pointer<Trade::AbstractImporter> importer;
+    if(!(importer = _manager.loadAndInstantiate("TgaImporter")))
+        CORRADE_SKIP("TgaImporter plugin not found.");
+
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(_testDir, "input.tga")));
+    Containers::Optional<Trade::ImageData2D> inputImage = importer->image2D(0);
+    CORRADE_VERIFY(inputImage);
+
+    UnsignedByte expected[64*64];
+    distanceFieldInto(inputImage->pixels<UnsignedByte>(), Containers::StridedArrayView2D<UnsignedByte>{expected, {64, 64}}, 32);
+
+    /* The output should be the same as the serial variant regardless of the
+       execution order */
+    UnsignedByte reverse[64*64];
+    distanceFieldInto(inputImage->pixels<UnsignedByte>(), Containers::StridedArrayView2D<UnsignedByte>{reverse, {64, 64}}, 32, parallelForReverse);
+    CORRADE_COMPARE_AS(Containers::arrayView(reverse), Containers::arrayView(expected), TestSuite::Compare::Container);
+
+    /* Null executor is equivalent to parallelForSerial() */
+    UnsignedByte null[64*64];
+    distanceFieldInto(inputImage->pixels<UnsignedByte>(), Containers::StridedArrayView2D<UnsignedByte>{null, {64, 64}}, 32, nullptr);
+    CORRADE_COMPARE_AS(Containers::arrayView(null), Containers::arrayView(expected), TestSuite::Compare::Container);
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::size_t threadCount = 4;
+    UnsignedByte threaded[64*64];
+    distanceFieldInto(inputImage->pixels<UnsignedByte>(), Containers::StridedArrayView2D<UnsignedByte>{threaded, {64, 64}}, 32, parallelForThreads, &threadCount);
+    CORRADE_COMPARE_AS(Containers::arrayView(threaded), Containers::arrayView(expected), TestSuite::Compare::Container);
+    #endif
+}
+
+void DistanceFieldCpuTest::sizeRatioNotMultipleOfTwo() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const UnsignedByte input[23*14*23*14]{};
+    UnsignedByte output[23*2*23*2];
+    const Containers::StridedArrayView2D<const UnsignedByte> inputView{input, {23*14, 23*14}};
+
+    /* This should be fine */
+    distanceFieldInto(inputView, Containers::StridedArrayView2D<UnsignedByte>{output, {23, 23}}, 4);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    distanceFieldInto(inputView, Containers::StridedArrayView2D<UnsignedByte>{output, {23*2, 23*2}}, 4);
+    /* Verify also just one axis wrong */
+    distanceFieldInto(inputView, Containers::StridedArrayView2D<UnsignedByte>{output, {23, 23*2}}, 4);
+    distanceFieldInto(inputView, Containers::StridedArrayView2D<UnsignedByte>{output, {23*2, 23}}, 4);
+    /* Almost correct except that it's not an integer multiply */
+    distanceFieldInto(inputView, Containers::StridedArrayView2D<UnsignedByte>{output, {23, 22}}, 4);
+    distanceFieldInto(inputView, Containers::StridedArrayView2D<UnsignedByte>{output, {22, 23}}, 4);
+    /* Empty output */
+    distanceFieldInto(inputView, Containers::StridedArrayView2D<UnsignedByte>{output, {0, 23}}, 4);
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::distanceFieldInto(): expected input and output size ratio to be a multiple of 2, got {322, 322} and {46, 46}\n"
+        "TextureTools::distanceFieldInto(): expected input and output size ratio to be a multiple of 2, got {322, 322} and {46, 23}\n"
+        "TextureTools::distanceFieldInto(): expected input and output size ratio to be a multiple of 2, got {322, 322} and {23, 46}\n"
+        "TextureTools::distanceFieldInto(): expected input and output size ratio to be a multiple of 2, got {322, 322} and {22, 23}\n"
+        "TextureTools::distanceFieldInto(): expected input and output size ratio to be a multiple of 2, got {322, 322} and {23, 22}\n"
+        "TextureTools::distanceFieldInto(): expected input and output size ratio to be a multiple of 2, got {322, 322} and {23, 0}\n");
+}
+
+void DistanceFieldCpuTest::benchmark() {
+    auto&& data = BenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Same as DistanceFieldGLTest::benchmark() to make the numbers
+       comparable */
+
+    Containers::Pointer<Trade::AbstractImporter> importer;
+    if(!(importer = _manager.loadAndInstantiate("TgaImporter")))
+        CORRADE_SKIP("TgaImporter plugin not found.");
+
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(_testDir, "input.tga")));
+    Containers::Optional<Trade::ImageData2D> inputImage = importer->image2D(0);
+    CORRADE_VERIFY(inputImage);
+
+    UnsignedByte output[64*64];
+    const Containers::StridedArrayView2D<UnsignedByte> outputView{output, {64, 64}};
+
+    CORRADE_BENCHMARK(50) {
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        if(data.threadCount) {
+            std::size_t threadCount = data.threadCount;
+            distanceFieldInto(inputImage->pixels<UnsignedByte>(), outputView, 32, parallelForThreads, &threadCount);
+        } else
+        #endif
+        {
+            distanceFieldInto(inputImage->pixels<UnsignedByte>(), outputView, 32);
+        }
+    }
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::DistanceFieldCpuTest)
@@ -68,9 +68,11 @@ struct DistanceFieldGLTest: GL::OpenGLTester {
 
     void runTexture();
     void runFramebuffer();
+    void runSubRectangles();
 
     void formatNotDrawable();
     void sizeRatioNotMultipleOfTwo();
+    void subRectangleOutOfRange();
 
     #ifndef MAGNUM_TARGET_WEBGL
     void benchmark();
@@ -104,8 +106,11 @@ DistanceFieldGLTest::DistanceFieldGLTest() {
                        &DistanceFieldGLTest::runFramebuffer},
         Containers::arraySize(RunData));
 
-    addTests({&DistanceFieldGLTest::formatNotDrawable,
-              &DistanceFieldGLTest::sizeRatioNotMultipleOfTwo});
+    addTests({&DistanceFieldGLTest::runSubRectangles,
+
+              &DistanceFieldGLTest::formatNotDrawable,
+              &DistanceFieldGLTest::sizeRatioNotMultipleOfTwo,
+              &DistanceFieldGLTest::subRectangleOutOfRange});
 
     #ifndef MAGNUM_TARGET_WEBGL
     addBenchmarks({&DistanceFieldGLTest::benchmark}, 10, BenchmarkType::GpuTime);
@@ -459,6 +464,138 @@ void DistanceFieldGLTest::runFramebuffer() {
         (DebugTools::CompareImageToFile{_manager, 1.0f, 0.178f}));
 }
 
+void DistanceFieldGLTest::runSubRectangles() {
+    /* Like runTexture() with an offset, but processing just two
+       sub-rectangles. The output in those should be the same as if the whole
+       rectangle was processed, the rest should be untouched. */
+
+    Containers::Pointer<Trade::AbstractImporter> importer;
+    if(!(importer = _manager.loadAndInstantiate("TgaImporter")))
+        CORRADE_SKIP("TgaImporter plugin not found.");
+
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(_testDir, "input.tga")));
+    CORRADE_COMPARE(importer->image2DCount(), 1);
+    Containers::Optional<Trade::ImageData2D> inputImage = importer->image2D(0);
+    CORRADE_VERIFY(inputImage);
+    CORRADE_COMPARE(inputImage->format(), PixelFormat::R8Unorm);
+
+    #ifndef MAGNUM_TARGET_GLES2
+    const GL::TextureFormat inputFormat = GL::TextureFormat::R8;
+    #elif !defined(MAGNUM_TARGET_WEBGL)
+    GL::TextureFormat inputFormat;
+    if(GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_rg>()) {
+        CORRADE_INFO("Using" << GL::Extensions::EXT::texture_rg::string());
+        inputFormat = GL::TextureFormat::R8;
+    } else {
+        inputFormat = GL::TextureFormat::Luminance; /** @todo Luminance8 */
+    }
+    #else
+    const GL::TextureFormat inputFormat = GL::TextureFormat::Luminance;
+    #endif
+
+    GL::Texture2D input;
+    input.setMinificationFilter(GL::SamplerFilter::Nearest, GL::SamplerMipmap::Base)
+        .setMagnificationFilter(GL::SamplerFilter::Nearest)
+        .setStorage(1, inputFormat, inputImage->size());
+
+    #if !defined(MAGNUM_TARGET_GLES2) || defined(MAGNUM_TARGET_WEBGL)
+    input.setSubImage(0, {}, *inputImage);
+    #else
+    if(GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_rg>())
+        input.setSubImage(0, {}, ImageView2D{inputImage->storage(), GL::PixelFormat::Red, GL::PixelType::UnsignedByte, inputImage->size(), inputImage->data()});
+    else
+        input.setSubImage(0, {}, *inputImage);
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES2
+    const GL::TextureFormat outputTextureFormat = GL::TextureFormat::R8;
+    const GL::PixelFormat outputPixelFormat = GL::PixelFormat::Red;
+    #elif !defined(MAGNUM_TARGET_WEBGL)
+    GL::TextureFormat outputTextureFormat;
+    GL::PixelFormat outputPixelFormat;
+    if(GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_rg>()) {
+        outputTextureFormat = GL::TextureFormat::R8;
+        outputPixelFormat = GL::PixelFormat::Red;
+    } else {
+        outputTextureFormat = GL::TextureFormat::RGBA;
+        outputPixelFormat = GL::PixelFormat::RGBA;
+    }
+    #else
+    const GL::TextureFormat outputTextureFormat = GL::TextureFormat::RGBA;
+    const GL::PixelFormat outputPixelFormat = GL::PixelFormat::RGBA;
+    #endif
+    const GL::PixelType outputPixelType = GL::PixelType::UnsignedByte;
+
+    const Vector2i size{128, 96};
+    const Vector2i offset{64, 32};
+
+    GL::Texture2D output;
+    output.setMinificationFilter(GL::SamplerFilter::Nearest, GL::SamplerMipmap::Base)
+        .setMagnificationFilter(GL::SamplerFilter::Nearest)
+        .setStorage(1, outputTextureFormat, size);
+    output.setSubImage(0, {}, ImageView2D{outputPixelFormat, outputPixelType, size,
+    Containers::Array<char>{DirectInit, std::size_t(size.product()*GL::pixelFormatSize(outputPixelFormat, outputPixelType)), '\x66'}});
+
+    DistanceFieldGL distanceField{32};
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    const Range2Di subRectangles[]{
+        {offset + Vector2i{0, 0}, offset + Vector2i{20, 30}},
+        {offset + Vector2i{36, 10}, offset + Vector2i{64, 64}},
+    };
+    distanceField(input, output, Range2Di::fromSize(offset, Vector2i{64}), subRectangles
+        #ifdef MAGNUM_TARGET_GLES
+        , inputImage->size()
+        #endif
+        );
+
+    Containers::Optional<Image2D> actualOutputImage;
+    #ifndef MAGNUM_TARGET_GLES2
+    actualOutputImage = Image2D{PixelFormat::R8Unorm};
+    #elif !defined(MAGNUM_TARGET_WEBGL)
+    if(GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_rg>())
+        actualOutputImage = Image2D{GL::PixelFormat::Red, GL::PixelType::UnsignedByte};
+    else
+        actualOutputImage = Image2D{PixelFormat::RGBA8Unorm};
+    #else
+    actualOutputImage = Image2D{PixelFormat::RGBA8Unorm};
+    #endif
+
+    DebugTools::textureSubImage(output, 0, Range2Di::fromSize(offset, Vector2i{64}), *actualOutputImage);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* Use just the first channel if the format is RGBA */
+    Containers::StridedArrayView2D<UnsignedByte> pixels;
+    if(actualOutputImage->format() == PixelFormat::RGBA8Unorm)
+        pixels = actualOutputImage->pixels<Color4ub>().slice(&Color4ub::r);
+    else
+        pixels = actualOutputImage->pixels<UnsignedByte>();
+
+    /* Expected output is the ground truth inside the sub-rectangles and the
+       original data outside */
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(_testDir, "output.tga")));
+    Containers::Optional<Trade::ImageData2D> expectedImage = importer->image2D(0);
+    CORRADE_VERIFY(expectedImage);
+    CORRADE_COMPARE(expectedImage->format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(expectedImage->size(), Vector2i{64});
+
+    Image2D expected{PixelFormat::R8Unorm, Vector2i{64}, Containers::Array<char>{DirectInit, 64*64, '\x66'}};
+    for(const Range2Di& subRectangle: subRectangles) {
+        const Range2Di rectangle = subRectangle.translated(-offset);
+        const Containers::Size2D sliceOffset{std::size_t(rectangle.min().y()), std::size_t(rectangle.min().x())};
+        const Containers::Size2D sliceSize{std::size_t(rectangle.sizeY()), std::size_t(rectangle.sizeX())};
+        Utility::copy(
+            expectedImage->pixels<UnsignedByte>().sliceSize(sliceOffset, sliceSize),
+            expected.pixels<UnsignedByte>().sliceSize(sliceOffset, sliceSize));
+    }
+
+    CORRADE_COMPARE_WITH(pixels, expected,
+        /* Same as in runTexture() */
+        (DebugTools::CompareImage{1.0f, 0.178f}));
+}
+
 void DistanceFieldGLTest::formatNotDrawable() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -594,6 +731,65 @@ void DistanceFieldGLTest::sizeRatioNotMultipleOfTwo() {
         "TextureTools::DistanceFieldGL: expected input and output size ratio to be a multiple of 2, got {322, 322} and {23, 22}\n");
 }
 
+void DistanceFieldGLTest::subRectangleOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    /* Same as in sizeRatioNotMultipleOfTwo() */
+    #ifndef MAGNUM_TARGET_GLES2
+    const GL::TextureFormat inputFormat = GL::TextureFormat::R8;
+    #elif !defined(MAGNUM_TARGET_WEBGL)
+    GL::TextureFormat inputFormat;
+    if(GL::Context::current().isExtensionSupported<GL::Extensions::EXT::texture_rg>()) {
+        CORRADE_INFO("Using" << GL::Extensions::EXT::texture_rg::string());
+        inputFormat = GL::TextureFormat::R8;
+    } else {
+        inputFormat = GL::TextureFormat::Luminance; /** @todo Luminance8 */
+    }
+    #else
+    const GL::TextureFormat inputFormat = GL::TextureFormat::Luminance;
+    #endif
+
+    GL::Texture2D input;
+    input.setStorage(1, inputFormat, {64, 64});
+
+    GL::Texture2D output;
+    #ifdef MAGNUM_TARGET_GLES2
+    output.setImage(0, GL::TextureFormat::RGBA, Image2D{GL::PixelFormat::RGBA, GL::PixelType::UnsignedByte, {32, 32}, Containers::Array<char>{NoInit, 32*32*4}});
+    #else
+    output.setStorage(1, GL::textureFormat(PixelFormat::RGBA8Unorm), {32, 32});
+    #endif
+
+    DistanceFieldGL distanceField{4};
+
+    /* This should be fine */
+    const Range2Di subRectangles[]{
+        {{16, 8}, {32, 24}},
+        {{24, 24}, {32, 32}},
+    };
+    distanceField(input, output, {{}, {32, 32}}, subRectangles
+        #ifdef MAGNUM_TARGET_GLES
+        , Vector2i{64}
+        #endif
+        );
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    distanceField(input, output, {{16, 16}, {32, 32}}, subRectangles
+        #ifdef MAGNUM_TARGET_GLES
+        , Vector2i{64}
+        #endif
+        );
+    distanceField(input, output, {{}, {16, 16}}, subRectangles
+        #ifdef MAGNUM_TARGET_GLES
+        , Vector2i{64}
+        #endif
+        );
+    MAGNUM_VERIFY_NO_GL_ERROR();
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::DistanceFieldGL: sub-rectangle 0 {{16, 8}, {32, 24}} out of range for {{16, 16}, {32, 32}}\n"
+        "TextureTools::DistanceFieldGL: sub-rectangle 0 {{16, 8}, {32, 24}} out of range for {{0, 0}, {16, 16}}\n");
+}
+
 #ifndef MAGNUM_TARGET_WEBGL
 void DistanceFieldGLTest::benchmark() {
     #ifdef MAGNUM_TARGET_GLES
@@ -0,0 +1,146 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/DebugTools/CompareImage.h"
+#include "Magnum/DebugTools/TextureImage.h"
+#include "Magnum/GL/OpenGLTester.h"
+#include "Magnum/GL/Texture.h"
+#include "Magnum/GL/TextureFormat.h"
+#include "Magnum/TextureTools/Mipmap.h"
+#include "Magnum/TextureTools/MipmapGL.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct MipmapGLTest: GL::OpenGLTester {
+    explicit MipmapGLTest();
+
+    void constructCopy();
+    void constructMove();
+
+    void run();
+
+    void invalidLevelCount();
+};
+
+const struct {
+    const char* name;
+    GL::TextureFormat textureFormat;
+    PixelFormat format;
+    Vector2i size;
+} RunData[]{
+    {"RGBA8", GL::TextureFormat::RGBA8, PixelFormat::RGBA8Unorm, {16, 8}},
+    {"RGBA8, odd size", GL::TextureFormat::RGBA8, PixelFormat::RGBA8Unorm, {13, 7}},
+    {"SRGB8Alpha8", GL::TextureFormat::SRGB8Alpha8, PixelFormat::RGBA8Srgb, {16, 8}},
+    {"SRGB8Alpha8, odd size", GL::TextureFormat::SRGB8Alpha8, PixelFormat::RGBA8Srgb, {13, 7}},
+};
+
+MipmapGLTest::MipmapGLTest() {
+    addTests({&MipmapGLTest::constructCopy,
+              &MipmapGLTest::constructMove});
+
+    addInstancedTests({&MipmapGLTest::run},
+        Containers::arraySize(RunData));
+
+    addTests({&MipmapGLTest::invalidLevelCount});
+}
+
+void MipmapGLTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<MipmapGL>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<MipmapGL>{});
+}
+
+void MipmapGLTest::constructMove() {
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<MipmapGL>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<MipmapGL>::value);
+}
+
+void MipmapGLTest::run() {
+    auto&& data = RunData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Color4ub> input{NoInit, std::size_t(data.size.product())};
+    for(std::size_t i = 0; i != input.size(); ++i)
+        input[i] = Color4ub{UnsignedByte(i*37), UnsignedByte(i*11), UnsignedByte(i*5), UnsignedByte(i*3)};
+    const ImageView2D image{data.format, data.size, input};
+
+    const Int levelCount = Math::log2(data.size.max()) + 1;
+    GL::Texture2D texture;
+    texture.setMinificationFilter(GL::SamplerFilter::Nearest, GL::SamplerMipmap::Nearest)
+        .setMagnificationFilter(GL::SamplerFilter::Nearest)
+        .setStorage(levelCount, data.textureFormat, data.size)
+        .setSubImage(0, {}, image);
+
+    MipmapGL mipmap;
+    mipmap(texture, data.size, levelCount);
+
+    MAGNUM_VERIFY_NO_GL_ERROR();
+
+    /* The GPU calculates each level from the previous rounded one, so allow
+       for a slight difference compared to the CPU implementation */
+    Containers::Array<Image2D> expected = mipmaps(image);
+    CORRADE_COMPARE(expected.size(), levelCount - 1);
+    for(std::size_t i = 0; i != expected.size(); ++i) {
+        CORRADE_ITERATION(i + 1);
+        Image2D actual = DebugTools::textureSubImage(texture, i + 1, {{}, expected[i].size()}, Image2D{data.format});
+
+        MAGNUM_VERIFY_NO_GL_ERROR();
+
+        CORRADE_COMPARE_WITH(actual, expected[i],
+            (DebugTools::CompareImage{2.0f, 0.75f}));
+    }
+}
+
+void MipmapGLTest::invalidLevelCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    GL::Texture2D texture;
+    MipmapGL mipmap;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    mipmap(texture, {0, 4}, 1);
+    mipmap(texture, {16, 8}, 0);
+    mipmap(texture, {16, 8}, 6);
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::MipmapGL: expected a non-empty size, got {0, 4}\n"
+        "TextureTools::MipmapGL: expected level count to be between 1 and 5 for size {16, 8} but got 0\n"
+        "TextureTools::MipmapGL: expected level count to be between 1 and 5 for size {16, 8} but got 6\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::MipmapGLTest)
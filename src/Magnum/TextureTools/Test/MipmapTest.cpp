@@ -0,0 +1,415 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Test/parallelFor.h"
+#include "Magnum/TextureTools/Mipmap.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct MipmapTest: TestSuite::Tester {
+    explicit MipmapTest();
+
+    void debugFilter();
+    void debugFlag();
+    void debugFlags();
+
+    void levelSizes();
+    void singlePixel();
+
+    void boxEven();
+    void boxOdd();
+    void boxSrgb();
+    void kaiserConstant();
+
+    void alphaCoverage();
+    void alphaCoverageDisabled();
+
+    void parallel();
+
+    void invalid();
+
+    void debugResizeFilter();
+
+    void resizeBoxDownsample();
+    void resizeBilinearUpsample();
+    void resizeSrgb();
+    void resizeConstant();
+    void resizeParallel();
+    void resizeInvalid();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    MipmapFilter filter;
+} ParallelData[]{
+    {"box", MipmapFilter::Box},
+    {"Kaiser", MipmapFilter::Kaiser},
+};
+
+const struct {
+    const char* name;
+    ResizeFilter filter;
+    Vector2i size;
+} ResizeData[]{
+    {"box, downsample", ResizeFilter::Box, {5, 3}},
+    {"box, upsample", ResizeFilter::Box, {27, 9}},
+    {"bilinear, downsample", ResizeFilter::Bilinear, {5, 3}},
+    {"bilinear, upsample", ResizeFilter::Bilinear, {27, 9}},
+    {"Lanczos, downsample", ResizeFilter::Lanczos, {5, 3}},
+    {"Lanczos, upsample", ResizeFilter::Lanczos, {27, 9}},
+};
+
+MipmapTest::MipmapTest() {
+    addTests({&MipmapTest::debugFilter,
+              &MipmapTest::debugFlag,
+              &MipmapTest::debugFlags,
+
+              &MipmapTest::levelSizes,
+              &MipmapTest::singlePixel,
+
+              &MipmapTest::boxEven,
+              &MipmapTest::boxOdd,
+              &MipmapTest::boxSrgb,
+              &MipmapTest::kaiserConstant,
+
+              &MipmapTest::alphaCoverage,
+              &MipmapTest::alphaCoverageDisabled});
+
+    addInstancedTests({&MipmapTest::parallel},
+        Containers::arraySize(ParallelData));
+
+    addTests({&MipmapTest::invalid,
+
+              &MipmapTest::debugResizeFilter,
+
+              &MipmapTest::resizeBoxDownsample,
+              &MipmapTest::resizeBilinearUpsample,
+              &MipmapTest::resizeSrgb});
+
+    addInstancedTests({&MipmapTest::resizeConstant,
+                       &MipmapTest::resizeParallel},
+        Containers::arraySize(ResizeData));
+
+    addTests({&MipmapTest::resizeInvalid});
+}
+
+using Magnum::Test::parallelForReverse;
+
+void MipmapTest::debugFilter() {
+    std::ostringstream out;
+    Debug{&out} << MipmapFilter::Kaiser << MipmapFilter(0xfe);
+    CORRADE_COMPARE(out.str(), "TextureTools::MipmapFilter::Kaiser TextureTools::MipmapFilter(0xfe)\n");
+}
+
+void MipmapTest::debugFlag() {
+    std::ostringstream out;
+    Debug{&out} << MipmapFlag::PreserveAlphaCoverage << MipmapFlag(0xf0);
+    CORRADE_COMPARE(out.str(), "TextureTools::MipmapFlag::PreserveAlphaCoverage TextureTools::MipmapFlag(0xf0)\n");
+}
+
+void MipmapTest::debugFlags() {
+    std::ostringstream out;
+    Debug{&out} << (MipmapFlag::PreserveAlphaCoverage|MipmapFlag(0xf0)) << MipmapFlags{};
+    CORRADE_COMPARE(out.str(), "TextureTools::MipmapFlag::PreserveAlphaCoverage|TextureTools::MipmapFlag(0xf0) TextureTools::MipmapFlags{}\n");
+}
+
+void MipmapTest::levelSizes() {
+    Color4ub data[5*3]{};
+    Containers::Array<Image2D> levels = mipmaps(ImageView2D{PixelFormat::RGBA8Unorm, {5, 3}, data});
+    CORRADE_COMPARE(levels.size(), 2);
+    CORRADE_COMPARE(levels[0].format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(levels[0].size(), (Vector2i{2, 1}));
+    CORRADE_COMPARE(levels[1].format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(levels[1].size(), (Vector2i{1, 1}));
+}
+
+void MipmapTest::singlePixel() {
+    Color4ub data[1]{};
+    CORRADE_COMPARE(mipmaps(ImageView2D{PixelFormat::RGBA8Unorm, {1, 1}, data}).size(), 0);
+}
+
+void MipmapTest::boxEven() {
+    const Color4ub data[]{
+        0x00000000_rgba, 0x40404040_rgba, 0x10203040_rgba, 0x30201000_rgba,
+        0x80808080_rgba, 0xc0c0c0c0_rgba, 0x10203040_rgba, 0x30201000_rgba
+    };
+    Containers::Array<Image2D> levels = mipmaps(ImageView2D{PixelFormat::RGBA8Unorm, {4, 2}, data});
+    CORRADE_COMPARE(levels.size(), 2);
+
+    /* Each output pixel is an average of a 2x2 block, rounded */
+    CORRADE_COMPARE(levels[0].size(), (Vector2i{2, 1}));
+    CORRADE_COMPARE_AS(levels[0].pixels<Color4ub>()[0], Containers::arrayView({
+        0x60606060_rgba, 0x20202020_rgba
+    }), TestSuite::Compare::Container);
+
+    /* The last level is calculated from the unrounded previous level */
+    CORRADE_COMPARE(levels[1].size(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(levels[1].pixels<Color4ub>()[0][0], 0x40404040_rgba);
+}
+
+void MipmapTest::boxOdd() {
+    /* Each output pixel covers two and a half input pixels */
+    const Float data[]{0.0f, 50.0f, 100.0f, 150.0f, 200.0f};
+    Containers::Array<Image2D> levels = mipmaps(ImageView2D{PixelFormat::R32F, {5, 1}, data});
+    CORRADE_COMPARE(levels.size(), 2);
+    CORRADE_COMPARE_AS(levels[0].pixels<Float>()[0], Containers::arrayView({
+        40.0f, 160.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(levels[1].pixels<Float>()[0][0], 100.0f);
+
+    /* A three-pixel input contributes to the output equally */
+    const Float data3[]{0.0f, 30.0f, 90.0f};
+    Containers::Array<Image2D> levels3 = mipmaps(ImageView2D{PixelFormat::R32F, {3, 1}, data3});
+    CORRADE_COMPARE(levels3.size(), 1);
+    CORRADE_COMPARE(levels3[0].pixels<Float>()[0][0], 40.0f);
+}
+
+void MipmapTest::boxSrgb() {
+    const Color4ub data[]{0x00000000_rgba, 0xffffffff_rgba};
+
+    /* Linear average of black and white is 0.5, which is 188 in sRGB. Alpha
+       is linear. */
+    Containers::Array<Image2D> srgb = mipmaps(ImageView2D{PixelFormat::RGBA8Srgb, {2, 1}, data});
+    CORRADE_COMPARE(srgb.size(), 1);
+    CORRADE_COMPARE(srgb[0].format(), PixelFormat::RGBA8Srgb);
+    CORRADE_COMPARE(srgb[0].pixels<Color4ub>()[0][0], 0xbcbcbc80_rgba);
+
+    /* Without sRGB it's a plain average */
+    Containers::Array<Image2D> unorm = mipmaps(ImageView2D{PixelFormat::RGBA8Unorm, {2, 1}, data});
+    CORRADE_COMPARE(unorm.size(), 1);
+    CORRADE_COMPARE(unorm[0].pixels<Color4ub>()[0][0], 0x80808080_rgba);
+
+    /* Three-channel sRGB has no alpha, so all channels are converted */
+    const Color3ub data3[]{0x000000_rgb, 0xffffff_rgb};
+    Containers::Array<Image2D> srgb3 = mipmaps(ImageView2D{PixelFormat::RGB8Srgb, {2, 1}, data3});
+    CORRADE_COMPARE(srgb3.size(), 1);
+    CORRADE_COMPARE(srgb3[0].pixels<Color3ub>()[0][0], 0xbcbcbc_rgb);
+}
+
+void MipmapTest::kaiserConstant() {
+    /* The filter weights are normalized and edges clamped, so a constant
+       image stays constant even though the kernel is wider than the image */
+    Color4ub data[8*8];
+    for(Color4ub& i: data)
+        i = 0x4080c0ff_rgba;
+    Containers::Array<Image2D> levels = mipmaps(ImageView2D{PixelFormat::RGBA8Unorm, {8, 8}, data}, MipmapFilter::Kaiser);
+    CORRADE_COMPARE(levels.size(), 3);
+    for(std::size_t i = 0; i != levels.size(); ++i) {
+        CORRADE_ITERATION(i);
+        for(const Containers::StridedArrayView1D<const Color4ub> row: levels[i].pixels<Color4ub>())
+            for(const Color4ub& pixel: row)
+                CORRADE_COMPARE(pixel, 0x4080c0ff_rgba);
+    }
+}
+
+/* A 4x4 image with 2x2 blocks having 2, 1, 3 and 1 opaque pixels out of 4,
+   so 7/16 of the pixels is above the reference */
+const Color4 AlphaCoverageData[]{
+    {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f, 1.0f, 0.0f},
+    {1.0f, 1.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f, 0.0f},
+    {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f, 1.0f, 0.0f},
+    {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f, 0.0f},
+};
+
+void MipmapTest::alphaCoverage() {
+    Containers::Array<Image2D> levels = mipmaps(ImageView2D{PixelFormat::RGBA32F, {4, 4}, AlphaCoverageData}, MipmapFilter::Box, MipmapFlag::PreserveAlphaCoverage, 0.55f);
+    CORRADE_COMPARE(levels.size(), 2);
+
+    /* The averages are 0.5, 0.25, 0.75 and 0.25. Scaling them so the 0.5
+       maps to the reference keeps two of the four pixels (instead of one)
+       passing the alpha test, which is the closest to 7/16. The color isn't
+       touched. */
+    Containers::StridedArrayView2D<const Color4> level1 = levels[0].pixels<Color4>();
+    CORRADE_COMPARE(level1[0][0], (Color4{1.0f, 0.55f}));
+    CORRADE_COMPARE(level1[0][1], (Color4{1.0f, 0.275f}));
+    CORRADE_COMPARE(level1[1][0], (Color4{1.0f, 0.825f}));
+    CORRADE_COMPARE(level1[1][1], (Color4{1.0f, 0.275f}));
+
+    /* The last level is calculated from the unscaled values, giving 7/16.
+       Having it pass the alpha test would be farther from the target
+       coverage, so it gets scaled to just the reference value. */
+    CORRADE_COMPARE(levels[1].pixels<Color4>()[0][0], (Color4{1.0f, 0.55f}));
+}
+
+void MipmapTest::alphaCoverageDisabled() {
+    Containers::Array<Image2D> levels = mipmaps(ImageView2D{PixelFormat::RGBA32F, {4, 4}, AlphaCoverageData}, MipmapFilter::Box, {}, 0.55f);
+    CORRADE_COMPARE(levels.size(), 2);
+
+    Containers::StridedArrayView2D<const Color4> level1 = levels[0].pixels<Color4>();
+    CORRADE_COMPARE(level1[0][0], (Color4{1.0f, 0.5f}));
+    CORRADE_COMPARE(level1[0][1], (Color4{1.0f, 0.25f}));
+    CORRADE_COMPARE(level1[1][0], (Color4{1.0f, 0.75f}));
+    CORRADE_COMPARE(level1[1][1], (Color4{1.0f, 0.25f}));
+    CORRADE_COMPARE(levels[1].pixels<Color4>()[0][0], (Color4{1.0f, 0.4375f}));
+}
+
+void MipmapTest::parallel() {
+    auto&& data = ParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Color4ub input[13*7];
+    for(std::size_t i = 0; i != Containers::arraySize(input); ++i)
+        input[i] = Color4ub{UnsignedByte(i*37), UnsignedByte(i*11), UnsignedByte(i*5), UnsignedByte(i*3)};
+    const ImageView2D image{PixelFormat::RGBA8Srgb, {13, 7}, input};
+
+    Containers::Array<Image2D> expected = mipmaps(image, data.filter, MipmapFlag::PreserveAlphaCoverage, 0.3f);
+    Containers::Array<Image2D> actual = mipmaps(image, data.filter, MipmapFlag::PreserveAlphaCoverage, 0.3f, parallelForReverse);
+    CORRADE_COMPARE(actual.size(), expected.size());
+    for(std::size_t i = 0; i != actual.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(actual[i].size(), expected[i].size());
+        CORRADE_COMPARE_AS(actual[i].data(), expected[i].data(),
+            TestSuite::Compare::Container);
+    }
+}
+
+void MipmapTest::invalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[16]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    mipmaps(ImageView2D{PixelFormat::RGBA8Unorm, {0, 4}, data});
+    mipmaps(ImageView2D{PixelFormat::RGBA16Unorm, {2, 1}, data});
+    mipmaps(ImageView2D{PixelFormat::RGB8Unorm, {1, 1}, data}, MipmapFilter::Box, MipmapFlag::PreserveAlphaCoverage);
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::mipmaps(): expected a non-empty image, got {0, 4}\n"
+        "TextureTools::mipmaps(): unsupported format PixelFormat::RGBA16Unorm\n"
+        "TextureTools::mipmaps(): alpha coverage preservation requires a four-channel format, got PixelFormat::RGB8Unorm\n");
+}
+
+void MipmapTest::debugResizeFilter() {
+    std::ostringstream out;
+    Debug{&out} << ResizeFilter::Lanczos << ResizeFilter(0xbe);
+    CORRADE_COMPARE(out.str(), "TextureTools::ResizeFilter::Lanczos TextureTools::ResizeFilter(0xbe)\n");
+}
+
+void MipmapTest::resizeBoxDownsample() {
+    /* Should give the same result as the first mip level */
+    const Float data[]{0.0f, 50.0f, 100.0f, 150.0f, 200.0f};
+    Float out[2];
+    resizeInto(ImageView2D{PixelFormat::R32F, {5, 1}, data}, MutableImageView2D{PixelFormat::R32F, {2, 1}, out}, ResizeFilter::Box);
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({
+        40.0f, 160.0f
+    }), TestSuite::Compare::Container);
+}
+
+void MipmapTest::resizeBilinearUpsample() {
+    /* Output pixel centers are at a quarter and three quarters of each input
+       pixel, edges are clamped */
+    const Float data[]{0.0f, 100.0f};
+    Float out[4];
+    resizeInto(ImageView2D{PixelFormat::R32F, {2, 1}, data}, MutableImageView2D{PixelFormat::R32F, {4, 1}, out}, ResizeFilter::Bilinear);
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({
+        0.0f, 25.0f, 75.0f, 100.0f
+    }), TestSuite::Compare::Container);
+}
+
+void MipmapTest::resizeSrgb() {
+    const Color4ub data[]{0x00000000_rgba, 0xffffffff_rgba};
+
+    /* Same as in boxSrgb(), the linear average is 188 in sRGB, alpha is
+       linear */
+    Color4ub srgb[1];
+    resizeInto(ImageView2D{PixelFormat::RGBA8Srgb, {2, 1}, data}, MutableImageView2D{PixelFormat::RGBA8Srgb, {1, 1}, srgb}, ResizeFilter::Box);
+    CORRADE_COMPARE(srgb[0], 0xbcbcbc80_rgba);
+
+    Color4ub unorm[1];
+    resizeInto(ImageView2D{PixelFormat::RGBA8Unorm, {2, 1}, data}, MutableImageView2D{PixelFormat::RGBA8Unorm, {1, 1}, unorm}, ResizeFilter::Box);
+    CORRADE_COMPARE(unorm[0], 0x80808080_rgba);
+}
+
+void MipmapTest::resizeConstant() {
+    auto&& data = ResizeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The filter weights are normalized and edges clamped, so a constant
+       image stays constant in both directions */
+    Color4ub input[13*7];
+    for(Color4ub& i: input)
+        i = 0x4080c0ff_rgba;
+    Containers::Array<Color4ub> output{NoInit, std::size_t(data.size.product())};
+    resizeInto(ImageView2D{PixelFormat::RGBA8Unorm, {13, 7}, input}, MutableImageView2D{PixelFormat::RGBA8Unorm, data.size, output}, data.filter);
+    for(const Color4ub& pixel: output)
+        CORRADE_COMPARE(pixel, 0x4080c0ff_rgba);
+}
+
+void MipmapTest::resizeParallel() {
+    auto&& data = ResizeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Color4ub input[13*7];
+    for(std::size_t i = 0; i != Containers::arraySize(input); ++i)
+        input[i] = Color4ub{UnsignedByte(i*37), UnsignedByte(i*11), UnsignedByte(i*5), UnsignedByte(i*3)};
+    const ImageView2D image{PixelFormat::RGBA8Srgb, {13, 7}, input};
+
+    Containers::Array<Color4ub> expected{NoInit, std::size_t(data.size.product())};
+    Containers::Array<Color4ub> actual{NoInit, std::size_t(data.size.product())};
+    resizeInto(image, MutableImageView2D{PixelFormat::RGBA8Srgb, data.size, expected}, data.filter);
+    resizeInto(image, MutableImageView2D{PixelFormat::RGBA8Srgb, data.size, actual}, data.filter, parallelForReverse);
+    CORRADE_COMPARE_AS(actual, expected,
+        TestSuite::Compare::Container);
+
+    /* Null executor is equivalent to parallelForSerial() */
+    resizeInto(image, MutableImageView2D{PixelFormat::RGBA8Srgb, data.size, actual}, data.filter, nullptr);
+    CORRADE_COMPARE_AS(actual, expected,
+        TestSuite::Compare::Container);
+}
+
+void MipmapTest::resizeInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[16]{};
+    char out[16];
+
+    std::ostringstream outStream;
+    Error redirectError{&outStream};
+    resizeInto(ImageView2D{PixelFormat::RGBA8Unorm, {2, 2}, data}, MutableImageView2D{PixelFormat::RGBA8Unorm, {2, 0}, out});
+    resizeInto(ImageView2D{PixelFormat::RGBA8Unorm, {2, 2}, data}, MutableImageView2D{PixelFormat::RGBA8Srgb, {2, 2}, out});
+    resizeInto(ImageView2D{PixelFormat::RGBA16Unorm, {2, 1}, data}, MutableImageView2D{PixelFormat::RGBA16Unorm, {2, 1}, out});
+    CORRADE_COMPARE(outStream.str(),
+        "TextureTools::resizeInto(): expected non-empty images, got {2, 2} and {2, 0}\n"
+        "TextureTools::resizeInto(): source format PixelFormat::RGBA8Unorm doesn't match destination format PixelFormat::RGBA8Srgb\n"
+        "TextureTools::resizeInto(): unsupported format PixelFormat::RGBA16Unorm\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::MipmapTest)
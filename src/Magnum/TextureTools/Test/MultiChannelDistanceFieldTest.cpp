@@ -0,0 +1,195 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/TextureTools/MultiChannelDistanceField.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct MultiChannelDistanceFieldTest: TestSuite::Tester {
+    explicit MultiChannelDistanceFieldTest();
+
+    void square();
+    void squareThreeChannel();
+    void degenerateEdges();
+    void hole();
+    void empty();
+};
+
+using namespace Math::Literals;
+
+MultiChannelDistanceFieldTest::MultiChannelDistanceFieldTest() {
+    addTests({&MultiChannelDistanceFieldTest::square,
+              &MultiChannelDistanceFieldTest::squareThreeChannel,
+              &MultiChannelDistanceFieldTest::degenerateEdges,
+              &MultiChannelDistanceFieldTest::hole,
+              &MultiChannelDistanceFieldTest::empty});
+}
+
+inline UnsignedByte median(const Color4ub& color) {
+    return Math::max(Math::min(color.r(), color.g()), Math::min(Math::max(color.r(), color.g()), color.b()));
+}
+
+void MultiChannelDistanceFieldTest::square() {
+    const Vector2 square[]{
+        {2.0f, 2.0f},
+        {6.0f, 2.0f},
+        {6.0f, 6.0f},
+        {2.0f, 6.0f}
+    };
+
+    Color4ub outData[64];
+    const Containers::StridedArrayView2D<Color4ub> out{outData, {8, 8}};
+    multiChannelDistanceFieldInto({Containers::stridedArrayView(square)}, out, 2.0f);
+
+    /* Inside, in the center of an edge, the channels agree */
+    CORRADE_COMPARE(out[3][3], 0xdfdfdfdf_rgba);
+    /* On an edge that differs from the others, one channel is different */
+    CORRADE_COMPARE(out[2][4], 0xdf9f9f9f_rgba);
+    CORRADE_COMPARE(out[4][0], 0x20df2020_rgba);
+
+    /* Outside of a corner, the true distance in alpha is rounded, while the
+       median of the channels keeps the corner sharp */
+    CORRADE_COMPARE(out[0][0], 0x20202000_rgba);
+    CORRADE_COMPARE(out[1][1], 0x60606052_rgba);
+
+    /* Distance grows the same way from all four sides */
+    for(std::size_t i = 0; i != 8; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(median(out[i][0]), 0x20);
+        CORRADE_COMPARE(median(out[i][7]), 0x20);
+        CORRADE_COMPARE(median(out[0][i]), 0x20);
+        CORRADE_COMPARE(median(out[7][i]), 0x20);
+    }
+}
+
+void MultiChannelDistanceFieldTest::squareThreeChannel() {
+    const Vector2 square[]{
+        {2.0f, 2.0f},
+        {6.0f, 2.0f},
+        {6.0f, 6.0f},
+        {2.0f, 6.0f}
+    };
+
+    Color4ub expectedData[64];
+    const Containers::StridedArrayView2D<Color4ub> expected{expectedData, {8, 8}};
+    multiChannelDistanceFieldInto({Containers::stridedArrayView(square)}, expected, 2.0f);
+
+    /* The RGB channels should be the same as with the four-channel output */
+    Color3ub outData[64];
+    const Containers::StridedArrayView2D<Color3ub> out{outData, {8, 8}};
+    multiChannelDistanceFieldInto({Containers::stridedArrayView(square)}, out, 2.0f);
+    for(std::size_t y = 0; y != 8; ++y) {
+        for(std::size_t x = 0; x != 8; ++x) {
+            CORRADE_ITERATION(Vector2i(x, y));
+            CORRADE_COMPARE(out[y][x], expected[y][x].rgb());
+        }
+    }
+}
+
+void MultiChannelDistanceFieldTest::degenerateEdges() {
+    const Vector2 square[]{
+        {2.0f, 2.0f},
+        {6.0f, 2.0f},
+        {6.0f, 6.0f},
+        {2.0f, 6.0f}
+    };
+    /* Duplicate vertices, including the first one repeated at the end, should
+       be ignored */
+    const Vector2 squareDuplicates[]{
+        {2.0f, 2.0f},
+        {6.0f, 2.0f},
+        {6.0f, 2.0f},
+        {6.0f, 6.0f},
+        {2.0f, 6.0f},
+        {2.0f, 2.0f}
+    };
+
+    Color4ub expectedData[64];
+    const Containers::StridedArrayView2D<Color4ub> expected{expectedData, {8, 8}};
+    multiChannelDistanceFieldInto({Containers::stridedArrayView(square)}, expected, 2.0f);
+
+    Color4ub outData[64];
+    const Containers::StridedArrayView2D<Color4ub> out{outData, {8, 8}};
+    multiChannelDistanceFieldInto({Containers::stridedArrayView(squareDuplicates)}, out, 2.0f);
+    for(std::size_t y = 0; y != 8; ++y) {
+        for(std::size_t x = 0; x != 8; ++x) {
+            CORRADE_ITERATION(Vector2i(x, y));
+            CORRADE_COMPARE(out[y][x], expected[y][x]);
+        }
+    }
+}
+
+void MultiChannelDistanceFieldTest::hole() {
+    const Vector2 outer[]{
+        {1.0f, 1.0f},
+        {7.0f, 1.0f},
+        {7.0f, 7.0f},
+        {1.0f, 7.0f}
+    };
+    /* Clockwise */
+    const Vector2 inner[]{
+        {3.0f, 3.0f},
+        {3.0f, 5.0f},
+        {5.0f, 5.0f},
+        {5.0f, 3.0f}
+    };
+
+    Color4ub outData[64];
+    const Containers::StridedArrayView2D<Color4ub> out{outData, {8, 8}};
+    multiChannelDistanceFieldInto({Containers::stridedArrayView(outer), Containers::stridedArrayView(inner)}, out, 2.0f);
+
+    /* Outside of the outer contour and inside the hole */
+    CORRADE_COMPARE(median(out[0][4]), 0x60);
+    CORRADE_COMPARE(median(out[4][4]), 0x60);
+    CORRADE_COMPARE(out[4][4].a(), 0x60);
+    /* In between the two */
+    CORRADE_COMPARE(median(out[2][4]), 0x9f);
+    CORRADE_COMPARE(median(out[4][1]), 0x9f);
+}
+
+void MultiChannelDistanceFieldTest::empty() {
+    Color4ub outData[16];
+    const Containers::StridedArrayView2D<Color4ub> out{outData, {4, 4}};
+    for(Color4ub& i: outData) i = 0xffffffff_rgba;
+
+    /* With no contours, everything is infinitely far outside */
+    multiChannelDistanceFieldInto({}, out, 2.0f);
+    for(std::size_t y = 0; y != 4; ++y) {
+        for(std::size_t x = 0; x != 4; ++x) {
+            CORRADE_ITERATION(Vector2i(x, y));
+            CORRADE_COMPARE(out[y][x], 0x00000000_rgba);
+        }
+    }
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::MultiChannelDistanceFieldTest)
@@ -0,0 +1,319 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/ColorBatch.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Test/parallelFor.h"
+#include "Magnum/TextureTools/Transform.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct TransformTest: TestSuite::Tester {
+    explicit TransformTest();
+
+    void debugRotation();
+
+    void xFlip();
+    void yFlip();
+    void yFlipCompressed();
+    void rotate();
+    void parallel();
+
+    void crop();
+    void cropMutable();
+
+    void yFlipCompressedInvalid();
+    void rotateInvalid();
+    void cropInvalid();
+};
+
+const struct {
+    const char* name;
+    CompressedPixelFormat format;
+    void(*flip)(const Containers::StridedArrayView4D<char>&);
+    Vector2i size;
+} YFlipCompressedData[]{
+    {"BC1, even block rows", CompressedPixelFormat::Bc1RGBAUnorm, Math::yFlipBc1InPlace, {8, 16}},
+    {"BC2, odd block rows", CompressedPixelFormat::Bc2RGBASrgb, Math::yFlipBc2InPlace, {12, 12}},
+    {"BC3, single block row", CompressedPixelFormat::Bc3RGBAUnorm, Math::yFlipBc3InPlace, {8, 4}},
+    {"BC4, incomplete blocks", CompressedPixelFormat::Bc4RSnorm, Math::yFlipBc4InPlace, {7, 10}},
+    {"BC5", CompressedPixelFormat::Bc5RGUnorm, Math::yFlipBc5InPlace, {16, 20}},
+};
+
+const struct {
+    const char* name;
+    ImageRotation rotation;
+    UnsignedByte expected[6];
+} RotateData[]{
+    {"clockwise", ImageRotation::Clockwise90, {
+        'c', 'f',
+        'b', 'e',
+        'a', 'd'
+    }},
+    {"180°", ImageRotation::Rotate180, {
+        'f', 'e', 'd',
+        'c', 'b', 'a'
+    }},
+    {"counterclockwise", ImageRotation::CounterClockwise90, {
+        'd', 'a',
+        'e', 'b',
+        'f', 'c'
+    }},
+};
+
+TransformTest::TransformTest() {
+    addTests({&TransformTest::debugRotation,
+
+              &TransformTest::xFlip,
+              &TransformTest::yFlip});
+
+    addInstancedTests({&TransformTest::yFlipCompressed},
+        Containers::arraySize(YFlipCompressedData));
+
+    addInstancedTests({&TransformTest::rotate},
+        Containers::arraySize(RotateData));
+
+    addTests({&TransformTest::parallel,
+
+              &TransformTest::crop,
+              &TransformTest::cropMutable,
+
+              &TransformTest::yFlipCompressedInvalid,
+              &TransformTest::rotateInvalid,
+              &TransformTest::cropInvalid});
+}
+
+using Magnum::Test::parallelForReverse;
+
+void TransformTest::debugRotation() {
+    std::ostringstream out;
+    Debug{&out} << ImageRotation::CounterClockwise90 << ImageRotation(0xde);
+    CORRADE_COMPARE(out.str(), "TextureTools::ImageRotation::CounterClockwise90 TextureTools::ImageRotation(0xde)\n");
+}
+
+void TransformTest::xFlip() {
+    /* Two-byte pixels to verify the pixel contents aren't reversed */
+    UnsignedByte data[]{
+        'a', 'A', 'b', 'B', 'c', 'C', 0, 0,
+        'd', 'D', 'e', 'E', 'f', 'F', 0, 0
+    };
+    xFlipInPlace(MutableImageView2D{PixelFormat::RG8Unorm, {3, 2}, data});
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<UnsignedByte>({
+        'c', 'C', 'b', 'B', 'a', 'A', 0, 0,
+        'f', 'F', 'e', 'E', 'd', 'D', 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void TransformTest::yFlip() {
+    /* Odd row count to verify the middle row stays in place, row padding
+       should stay untouched */
+    UnsignedByte data[]{
+        'a', 'b', 'c', 1,
+        'd', 'e', 'f', 2,
+        'g', 'h', 'i', 3
+    };
+    yFlipInPlace(MutableImageView2D{PixelFormat::R8Unorm, {3, 3}, data});
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<UnsignedByte>({
+        'g', 'h', 'i', 1,
+        'd', 'e', 'f', 2,
+        'a', 'b', 'c', 3
+    }), TestSuite::Compare::Container);
+}
+
+void TransformTest::yFlipCompressed() {
+    auto&& data = YFlipCompressedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Vector2i blockCount = (data.size + Vector2i{3})/4;
+    const std::size_t blockDataSize = compressedPixelFormatBlockDataSize(data.format);
+    Containers::Array<char> actual{NoInit, blockCount.product()*blockDataSize};
+    for(std::size_t i = 0; i != actual.size(); ++i)
+        actual[i] = char(i*37 + 11);
+
+    /* The Math variant flips block rows as well when given the whole image */
+    Containers::Array<char> expected{NoInit, actual.size()};
+    Utility::copy(actual, expected);
+    data.flip(Containers::StridedArrayView4D<char>{expected,
+        {1, std::size_t(blockCount.y()), std::size_t(blockCount.x()), blockDataSize}});
+
+    yFlipInPlace(MutableCompressedImageView2D{data.format, data.size, actual}, parallelForReverse);
+    CORRADE_COMPARE_AS(actual, expected, TestSuite::Compare::Container);
+}
+
+void TransformTest::rotate() {
+    auto&& data = RotateData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const UnsignedByte src[]{
+        'a', 'b', 'c',
+        'd', 'e', 'f'
+    };
+    UnsignedByte dst[6]{};
+    const Vector2i size = data.rotation == ImageRotation::Rotate180 ?
+        Vector2i{3, 2} : Vector2i{2, 3};
+    rotateInto(
+        ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, {3, 2}, src},
+        MutableImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, size, dst},
+        data.rotation);
+    CORRADE_COMPARE_AS(Containers::arrayView(dst),
+        Containers::arrayView(data.expected),
+        TestSuite::Compare::Container);
+}
+
+void TransformTest::parallel() {
+    /* Large enough to be split into multiple tasks */
+    const Vector2i size{1024, 171};
+    Containers::Array<Color4ub> data{NoInit, std::size_t(size.product())};
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = Color4ub{UnsignedByte(i), UnsignedByte(i >> 8), UnsignedByte(i >> 16), UnsignedByte(i*3)};
+
+    Containers::Array<Color4ub> expected{NoInit, data.size()};
+    Containers::Array<Color4ub> actual{NoInit, data.size()};
+    const ImageView2D image{PixelFormat::RGBA8Unorm, size, data};
+
+    Utility::copy(data, expected);
+    Utility::copy(data, actual);
+    xFlipInPlace(MutableImageView2D{PixelFormat::RGBA8Unorm, size, expected});
+    yFlipInPlace(MutableImageView2D{PixelFormat::RGBA8Unorm, size, expected});
+    xFlipInPlace(MutableImageView2D{PixelFormat::RGBA8Unorm, size, actual}, parallelForReverse);
+    yFlipInPlace(MutableImageView2D{PixelFormat::RGBA8Unorm, size, actual}, parallelForReverse);
+    CORRADE_COMPARE_AS(actual, expected, TestSuite::Compare::Container);
+
+    /* A 180° rotation is the same as flipping in both directions */
+    rotateInto(image, MutableImageView2D{PixelFormat::RGBA8Unorm, size, actual}, ImageRotation::Rotate180, parallelForReverse);
+    CORRADE_COMPARE_AS(actual, expected, TestSuite::Compare::Container);
+
+    rotateInto(image, MutableImageView2D{PixelFormat::RGBA8Unorm, size.flipped(), expected}, ImageRotation::Clockwise90);
+    rotateInto(image, MutableImageView2D{PixelFormat::RGBA8Unorm, size.flipped(), actual}, ImageRotation::Clockwise90, parallelForReverse);
+    CORRADE_COMPARE_AS(actual, expected, TestSuite::Compare::Container);
+
+    /* Null executor is equivalent to parallelForSerial() */
+    rotateInto(image, MutableImageView2D{PixelFormat::RGBA8Unorm, size.flipped(), actual}, ImageRotation::Clockwise90, nullptr);
+    CORRADE_COMPARE_AS(actual, expected, TestSuite::Compare::Container);
+}
+
+void TransformTest::crop() {
+    const UnsignedByte data[]{
+        'a', 'b', 'c', 'd',
+        'e', 'f', 'g', 'h',
+        'i', 'j', 'k', 'l'
+    };
+    const ImageView2D image{PixelFormat::R8Unorm, {4, 3}, data};
+
+    ImageView2D cropped = TextureTools::crop(image, Range2Di{{1, 1}, {3, 3}});
+    CORRADE_COMPARE(cropped.format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(cropped.size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE(cropped.data().data(), static_cast<const void*>(data));
+    Containers::StridedArrayView2D<const UnsignedByte> pixels = cropped.pixels<UnsignedByte>();
+    CORRADE_COMPARE(pixels[0][0], 'f');
+    CORRADE_COMPARE(pixels[0][1], 'g');
+    CORRADE_COMPARE(pixels[1][0], 'j');
+    CORRADE_COMPARE(pixels[1][1], 'k');
+
+    /* Cropping a cropped view offsets it further */
+    ImageView2D croppedTwice = TextureTools::crop(cropped, Range2Di{{1, 0}, {2, 1}});
+    CORRADE_COMPARE(croppedTwice.size(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(croppedTwice.pixels<UnsignedByte>()[0][0], 'g');
+}
+
+void TransformTest::cropMutable() {
+    UnsignedByte data[]{
+        'a', 'b', 'c', 'd',
+        'e', 'f', 'g', 'h',
+        'i', 'j', 'k', 'l'
+    };
+
+    /* Flipping the cropped view affects only the cropped area */
+    MutableImageView2D cropped = TextureTools::crop(MutableImageView2D{PixelFormat::R8Unorm, {4, 3}, data}, Range2Di{{1, 1}, {3, 3}});
+    xFlipInPlace(cropped);
+    yFlipInPlace(cropped);
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<UnsignedByte>({
+        'a', 'b', 'c', 'd',
+        'e', 'k', 'j', 'h',
+        'i', 'g', 'f', 'l'
+    }), TestSuite::Compare::Container);
+}
+
+void TransformTest::yFlipCompressedInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char data[64]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    yFlipInPlace(MutableCompressedImageView2D{CompressedPixelFormat::Bc6hRGBUfloat, {4, 4}, data});
+    yFlipInPlace(MutableCompressedImageView2D{CompressedPixelStorage{}.setSkip({0, 4, 0}), CompressedPixelFormat::Bc1RGBUnorm, {4, 4}, data});
+    yFlipInPlace(MutableCompressedImageView2D{CompressedPixelFormat::Bc3RGBAUnorm, {8, 12}, data});
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::yFlipInPlace(): unsupported format CompressedPixelFormat::Bc6hRGBUfloat\n"
+        "TextureTools::yFlipInPlace(): non-default compressed pixel storage is not supported\n"
+        "TextureTools::yFlipInPlace(): expected at least 96 bytes for a {8, 12} CompressedPixelFormat::Bc3RGBAUnorm image but got 64\n");
+}
+
+void TransformTest::rotateInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[64]{};
+    char outData[64];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    rotateInto(ImageView2D{PixelFormat::RGBA8Unorm, {4, 2}, data}, MutableImageView2D{PixelFormat::RG8Unorm, {2, 4}, outData}, ImageRotation::Clockwise90);
+    rotateInto(ImageView2D{PixelFormat::RGBA8Unorm, {4, 2}, data}, MutableImageView2D{PixelFormat::RGBA8Unorm, {4, 2}, outData}, ImageRotation::CounterClockwise90);
+    rotateInto(ImageView2D{PixelFormat::RGBA8Unorm, {4, 2}, data}, MutableImageView2D{PixelFormat::RGBA8Unorm, {2, 4}, outData}, ImageRotation::Rotate180);
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::rotateInto(): expected output pixel size to be 4 but got 2\n"
+        "TextureTools::rotateInto(): expected output size to be {2, 4} but got {4, 2}\n"
+        "TextureTools::rotateInto(): expected output size to be {4, 2} but got {2, 4}\n");
+}
+
+void TransformTest::cropInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[64]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    TextureTools::crop(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}, Range2Di{{-1, 0}, {2, 2}});
+    TextureTools::crop(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}, Range2Di{{1, 1}, {3, 5}});
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::crop(): rectangle {{-1, 0}, {2, 2}} out of range for an image of size {4, 4}\n"
+        "TextureTools::crop(): rectangle {{1, 1}, {3, 5}} out of range for an image of size {4, 4}\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::TransformTest)
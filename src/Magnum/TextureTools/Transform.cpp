@@ -0,0 +1,284 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Transform.h"
+
+#include <algorithm>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/ColorBatch.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace TextureTools {
+
+Debug& operator<<(Debug& debug, const ImageRotation value) {
+    debug << "TextureTools::ImageRotation" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case ImageRotation::v: return debug << "::" #v;
+        _c(Clockwise90)
+        _c(Rotate180)
+        _c(CounterClockwise90)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << ")";
+}
+
+namespace {
+
+/* Rough count of bytes processed by a single task, so narrow images don't
+   get split into too many tiny tasks */
+constexpr std::size_t BytesPerTask = 65536;
+
+std::size_t rowsPerTask(const std::size_t rowSize) {
+    return Math::max(BytesPerTask/Math::max(rowSize, std::size_t{1}), std::size_t{1});
+}
+
+struct XFlipState {
+    Containers::StridedArrayView3D<char> pixels;
+    std::size_t rowsPerTask;
+};
+
+void xFlipRows(void* const state, const std::size_t task) {
+    const XFlipState& s = *static_cast<const XFlipState*>(state);
+    const std::size_t rowBegin = task*s.rowsPerTask;
+    const std::size_t rowEnd = Math::min(rowBegin + s.rowsPerTask, s.pixels.size()[0]);
+    for(std::size_t y = rowBegin; y != rowEnd; ++y)
+        Utility::flipInPlace<0>(s.pixels[y]);
+}
+
+struct YFlipState {
+    /* Rows of pixels or blocks, with the second dimension contiguous */
+    Containers::StridedArrayView2D<char> rows;
+    std::size_t pairsPerTask;
+    /* For block-compressed images flips contents of a single row of blocks,
+       null otherwise */
+    void(*flipBlocks)(const Containers::StridedArrayView4D<char>&);
+    std::size_t blockDataSize;
+};
+
+void yFlipBlockRow(const YFlipState& s, const std::size_t row) {
+    const std::size_t rowSize = s.rows.size()[1];
+    char* const data = static_cast<char*>(s.rows[row].data());
+    s.flipBlocks(Containers::StridedArrayView4D<char>{
+        {data, rowSize}, data,
+        {1, 1, rowSize/s.blockDataSize, s.blockDataSize},
+        {std::ptrdiff_t(rowSize), std::ptrdiff_t(rowSize), std::ptrdiff_t(s.blockDataSize), 1}});
+}
+
+void yFlipRowPairs(void* const state, const std::size_t task) {
+    const YFlipState& s = *static_cast<const YFlipState*>(state);
+    const std::size_t rowCount = s.rows.size()[0];
+    const std::size_t rowSize = s.rows.size()[1];
+    const std::size_t pairBegin = task*s.pairsPerTask;
+    /* The middle row of an odd row count is a pair with itself, which only
+       needs its block contents flipped */
+    const std::size_t pairEnd = Math::min(pairBegin + s.pairsPerTask, (rowCount + 1)/2);
+    for(std::size_t top = pairBegin; top != pairEnd; ++top) {
+        const std::size_t bottom = rowCount - top - 1;
+        if(s.flipBlocks) {
+            yFlipBlockRow(s, top);
+            if(bottom != top) yFlipBlockRow(s, bottom);
+        }
+        if(bottom != top) {
+            char* const topData = static_cast<char*>(s.rows[top].data());
+            std::swap_ranges(topData, topData + rowSize, static_cast<char*>(s.rows[bottom].data()));
+        }
+    }
+}
+
+void yFlip(YFlipState& state, const ParallelFor parallelFor, void* const parallelForState) {
+    const std::size_t pairCount = (state.rows.size()[0] + 1)/2;
+    if(!pairCount || !state.rows.size()[1])
+        return;
+
+    /* Each pair touches two rows */
+    state.pairsPerTask = Math::max(rowsPerTask(state.rows.size()[1])/2, std::size_t{1});
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, (pairCount + state.pairsPerTask - 1)/state.pairsPerTask, yFlipRowPairs, &state);
+}
+
+struct RotateState {
+    Containers::StridedArrayView3D<const char> src;
+    Containers::StridedArrayView3D<char> dst;
+    std::size_t rowsPerTask;
+};
+
+void rotateRows(void* const state, const std::size_t task) {
+    const RotateState& s = *static_cast<const RotateState*>(state);
+    const std::size_t rowBegin = task*s.rowsPerTask;
+    const std::size_t rowEnd = Math::min(rowBegin + s.rowsPerTask, s.dst.size()[0]);
+    Utility::copy(s.src.slice(rowBegin, rowEnd), s.dst.slice(rowBegin, rowEnd));
+}
+
+template<class T> ImageView<2, T> cropImplementation(const ImageView<2, T>& image, const Range2Di& rectangle) {
+    CORRADE_ASSERT((rectangle.min() >= Vector2i{}).all() && (rectangle.max() <= image.size()).all() && (rectangle.min() <= rectangle.max()).all(),
+        "TextureTools::crop(): rectangle" << Debug::packed << rectangle << "out of range for an image of size" << Debug::packed << image.size(), (ImageView<2, T>{image.storage(), image.format(), image.formatExtra(), image.pixelSize(), {}, image.flags()}));
+
+    /* Keep the original row length so the cropped rows start at the same
+       offsets, and offset the view start by the rectangle origin */
+    PixelStorage storage = image.storage();
+    if(!storage.rowLength())
+        storage.setRowLength(image.size().x());
+    storage.setSkip(storage.skip() + Vector3i{rectangle.min(), 0});
+
+    return ImageView<2, T>{storage, image.format(), image.formatExtra(), image.pixelSize(), rectangle.size(), image.data(), image.flags()};
+}
+
+}
+
+void xFlipInPlace(const MutableImageView2D& image) {
+    xFlipInPlace(image, parallelForSerial, nullptr);
+}
+
+void xFlipInPlace(const MutableImageView2D& image, const ParallelFor parallelFor, void* const parallelForState) {
+    const std::size_t height = image.size().y();
+    if(!height || !image.size().x())
+        return;
+
+    XFlipState state;
+    state.pixels = image.pixels();
+    state.rowsPerTask = rowsPerTask(image.size().x()*image.pixelSize());
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, (height + state.rowsPerTask - 1)/state.rowsPerTask, xFlipRows, &state);
+}
+
+void yFlipInPlace(const MutableImageView2D& image) {
+    yFlipInPlace(image, parallelForSerial, nullptr);
+}
+
+void yFlipInPlace(const MutableImageView2D& image, const ParallelFor parallelFor, void* const parallelForState) {
+    const Containers::StridedArrayView3D<char> pixels = image.pixels();
+
+    YFlipState state;
+    /* Pixels in a row are always contiguous, so the row can be treated as a
+       contiguous range of bytes */
+    state.rows = Containers::StridedArrayView2D<char>{image.data(), static_cast<char*>(pixels.data()),
+        {pixels.size()[0], pixels.size()[1]*pixels.size()[2]},
+        {pixels.stride()[0], 1}};
+    state.flipBlocks = nullptr;
+    state.blockDataSize = 0;
+    yFlip(state, parallelFor, parallelForState);
+}
+
+void yFlipInPlace(const MutableCompressedImageView2D& image) {
+    yFlipInPlace(image, parallelForSerial, nullptr);
+}
+
+void yFlipInPlace(const MutableCompressedImageView2D& image, const ParallelFor parallelFor, void* const parallelForState) {
+    YFlipState state;
+    switch(image.format()) {
+        case CompressedPixelFormat::Bc1RGBUnorm:
+        case CompressedPixelFormat::Bc1RGBSrgb:
+        case CompressedPixelFormat::Bc1RGBAUnorm:
+        case CompressedPixelFormat::Bc1RGBASrgb:
+            state.flipBlocks = Math::yFlipBc1InPlace;
+            break;
+        case CompressedPixelFormat::Bc2RGBAUnorm:
+        case CompressedPixelFormat::Bc2RGBASrgb:
+            state.flipBlocks = Math::yFlipBc2InPlace;
+            break;
+        case CompressedPixelFormat::Bc3RGBAUnorm:
+        case CompressedPixelFormat::Bc3RGBASrgb:
+            state.flipBlocks = Math::yFlipBc3InPlace;
+            break;
+        case CompressedPixelFormat::Bc4RUnorm:
+        case CompressedPixelFormat::Bc4RSnorm:
+            state.flipBlocks = Math::yFlipBc4InPlace;
+            break;
+        case CompressedPixelFormat::Bc5RGUnorm:
+        case CompressedPixelFormat::Bc5RGSnorm:
+            state.flipBlocks = Math::yFlipBc5InPlace;
+            break;
+        default:
+            CORRADE_ASSERT_UNREACHABLE("TextureTools::yFlipInPlace(): unsupported format" << image.format(), );
+    }
+    CORRADE_ASSERT(!image.storage().rowLength() && image.storage().skip() == Vector3i{},
+        "TextureTools::yFlipInPlace(): non-default compressed pixel storage is not supported", );
+
+    const Vector2i blockSize = compressedPixelFormatBlockSize(image.format()).xy();
+    const Vector2i blockCount = (image.size() + blockSize - Vector2i{1})/blockSize;
+    state.blockDataSize = compressedPixelFormatBlockDataSize(image.format());
+    const std::size_t rowSize = blockCount.x()*state.blockDataSize;
+    CORRADE_ASSERT(image.data().size() >= blockCount.y()*rowSize,
+        "TextureTools::yFlipInPlace(): expected at least" << blockCount.y()*rowSize << "bytes for a" << Debug::packed << image.size() << image.format() << "image but got" << image.data().size(), );
+    state.rows = Containers::StridedArrayView2D<char>{image.data(), image.data().data(),
+        {std::size_t(blockCount.y()), rowSize},
+        {std::ptrdiff_t(rowSize), 1}};
+    yFlip(state, parallelFor, parallelForState);
+}
+
+void rotateInto(const ImageView2D& src, const MutableImageView2D& dst, const ImageRotation rotation) {
+    rotateInto(src, dst, rotation, parallelForSerial, nullptr);
+}
+
+void rotateInto(const ImageView2D& src, const MutableImageView2D& dst, const ImageRotation rotation, const ParallelFor parallelFor, void* const parallelForState) {
+    CORRADE_ASSERT(src.pixelSize() == dst.pixelSize(),
+        "TextureTools::rotateInto(): expected output pixel size to be" << src.pixelSize() << "but got" << dst.pixelSize(), );
+    const Vector2i expectedSize = rotation == ImageRotation::Rotate180 ?
+        src.size() : src.size().flipped();
+    CORRADE_ASSERT(dst.size() == expectedSize,
+        "TextureTools::rotateInto(): expected output size to be" << Debug::packed << expectedSize << "but got" << Debug::packed << dst.size(), );
+
+    const std::size_t height = dst.size().y();
+    if(!height || !dst.size().x())
+        return;
+
+    /* Pixel views are indexed by [y][x], with Y going up. A view on the
+       source that's indexed the same way as the destination is then just a
+       transposed and flipped source view. */
+    RotateState state;
+    switch(rotation) {
+        case ImageRotation::Clockwise90:
+            state.src = src.pixels().transposed<0, 1>().flipped<0>();
+            break;
+        case ImageRotation::Rotate180:
+            state.src = src.pixels().flipped<0>().flipped<1>();
+            break;
+        case ImageRotation::CounterClockwise90:
+            state.src = src.pixels().transposed<0, 1>().flipped<1>();
+            break;
+        default: CORRADE_ASSERT_UNREACHABLE("TextureTools::rotateInto(): invalid rotation" << rotation, );
+    }
+    state.dst = dst.pixels();
+    state.rowsPerTask = rowsPerTask(dst.size().x()*dst.pixelSize());
+    (parallelFor ? parallelFor : parallelForSerial)(parallelForState, (height + state.rowsPerTask - 1)/state.rowsPerTask, rotateRows, &state);
+}
+
+ImageView2D crop(const ImageView2D& image, const Range2Di& rectangle) {
+    return cropImplementation(image, rectangle);
+}
+
+MutableImageView2D crop(const MutableImageView2D& image, const Range2Di& rectangle) {
+    return cropImplementation(image, rectangle);
+}
+
+}}
@@ -0,0 +1,230 @@
+#ifndef Magnum_TextureTools_Transform_h
+#define Magnum_TextureTools_Transform_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::xFlipInPlace(), @ref Magnum::TextureTools::yFlipInPlace(), @ref Magnum::TextureTools::rotateInto(), @ref Magnum::TextureTools::crop(), enum @ref Magnum::TextureTools::ImageRotation
+ * @m_since_latest
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/Parallel.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Image rotation
+@m_since_latest
+
+@see @ref rotateInto()
+*/
+enum class ImageRotation: UnsignedByte {
+    /**
+     * Rotate by 90° clockwise. The output has width and height swapped
+     * compared to the input.
+     */
+    Clockwise90,
+
+    /** Rotate by 180°. The output has the same size as the input. */
+    Rotate180,
+
+    /**
+     * Rotate by 90° counterclockwise. The output has width and height
+     * swapped compared to the input.
+     */
+    CounterClockwise90
+};
+
+/**
+@debugoperatorenum{ImageRotation}
+@m_since_latest
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& output, ImageRotation value);
+
+/**
+@brief Flip an image horizontally in-place
+@m_since_latest
+
+Reverses the order of pixels in each row of @p image. The view is allowed to
+have arbitrary @ref PixelStorage. This overload processes everything
+serially on the calling thread, use
+@ref xFlipInPlace(const MutableImageView2D&, ParallelFor, void*) to spread
+the work across multiple threads.
+@see @ref yFlipInPlace(const MutableImageView2D&),
+    @ref Utility::flipInPlace()
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void xFlipInPlace(const MutableImageView2D& image);
+
+/**
+@brief Flip an image horizontally in-place using a parallel executor
+@param image            Image to flip
+@param parallelFor      Parallel loop executor or @cpp nullptr @ce
+@param parallelForState State pointer passed to @p parallelFor
+@m_since_latest
+
+Same as @ref xFlipInPlace(const MutableImageView2D&), but with the work split
+into tasks by rows and executed through @p parallelFor. The output is the
+same regardless of how the tasks get executed.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void xFlipInPlace(const MutableImageView2D& image, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+/**
+@brief Flip an image vertically in-place
+@m_since_latest
+
+Swaps the first row of @p image with the last, the second with the one
+before the last and so on. The view is allowed to have arbitrary
+@ref PixelStorage. This overload processes everything serially on the
+calling thread, use
+@ref yFlipInPlace(const MutableImageView2D&, ParallelFor, void*) to spread
+the work across multiple threads.
+@see @ref xFlipInPlace(const MutableImageView2D&),
+    @ref yFlipInPlace(const MutableCompressedImageView2D&)
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void yFlipInPlace(const MutableImageView2D& image);
+
+/**
+@brief Flip an image vertically in-place using a parallel executor
+@param image            Image to flip
+@param parallelFor      Parallel loop executor or @cpp nullptr @ce
+@param parallelForState State pointer passed to @p parallelFor
+@m_since_latest
+
+Same as @ref yFlipInPlace(const MutableImageView2D&), but with the work
+split into tasks by pairs of rows and executed through @p parallelFor. The
+output is the same regardless of how the tasks get executed.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void yFlipInPlace(const MutableImageView2D& image, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+/**
+@brief Flip a block-compressed image vertically in-place
+@m_since_latest
+
+Expects that @p image is in one of the @ref CompressedPixelFormat::Bc1RGBUnorm,
+@relativeref{CompressedPixelFormat,Bc1RGBSrgb},
+@relativeref{CompressedPixelFormat,Bc1RGBAUnorm},
+@relativeref{CompressedPixelFormat,Bc1RGBASrgb},
+@relativeref{CompressedPixelFormat,Bc2RGBAUnorm},
+@relativeref{CompressedPixelFormat,Bc2RGBASrgb},
+@relativeref{CompressedPixelFormat,Bc3RGBAUnorm},
+@relativeref{CompressedPixelFormat,Bc3RGBASrgb},
+@relativeref{CompressedPixelFormat,Bc4RUnorm},
+@relativeref{CompressedPixelFormat,Bc4RSnorm},
+@relativeref{CompressedPixelFormat,Bc5RGUnorm} or
+@relativeref{CompressedPixelFormat,Bc5RGSnorm} formats and has a default
+@ref CompressedPixelStorage. Rows of blocks are swapped the same way as
+rows of pixels in @ref yFlipInPlace(const MutableImageView2D&) and the
+contents of each block get flipped using @ref Math::yFlipBc1InPlace(),
+@relativeref{Math,yFlipBc2InPlace()}, @relativeref{Math,yFlipBc3InPlace()},
+@relativeref{Math,yFlipBc4InPlace()} or @relativeref{Math,yFlipBc5InPlace()}.
+
+As the operation is done on whole blocks, if the image height isn't
+whole blocks, the flipped data will be shifted by the height of the
+remaining pixels in the last block row. This overload processes everything
+serially on the calling thread, use
+@ref yFlipInPlace(const MutableCompressedImageView2D&, ParallelFor, void*)
+to spread the work across multiple threads.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void yFlipInPlace(const MutableCompressedImageView2D& image);
+
+/**
+@brief Flip a block-compressed image vertically in-place using a parallel executor
+@param image            Image to flip
+@param parallelFor      Parallel loop executor or @cpp nullptr @ce
+@param parallelForState State pointer passed to @p parallelFor
+@m_since_latest
+
+Same as @ref yFlipInPlace(const MutableCompressedImageView2D&), but with
+the work split into tasks by pairs of block rows and executed through
+@p parallelFor. The output is the same regardless of how the tasks get
+executed.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void yFlipInPlace(const MutableCompressedImageView2D& image, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+/**
+@brief Rotate an image into an existing image
+@param[in]  src         Input image
+@param[out] dst         Output image
+@param[in]  rotation    Rotation to perform
+@m_since_latest
+
+Expects that @p src and @p dst have the same pixel size and that @p dst has
+the size of @p src with width and height swapped for
+@ref ImageRotation::Clockwise90 and
+@relativeref{ImageRotation,CounterClockwise90} and the same size for
+@ref ImageRotation::Rotate180. The @p src and @p dst views are allowed to
+have arbitrary @ref PixelStorage. They aren't allowed to overlap. For
+a 180° rotation of an image in-place, call
+@ref xFlipInPlace(const MutableImageView2D&) and
+@ref yFlipInPlace(const MutableImageView2D&) on it.
+
+This overload processes everything serially on the calling thread, use
+@ref rotateInto(const ImageView2D&, const MutableImageView2D&, ImageRotation, ParallelFor, void*)
+to spread the work across multiple threads.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void rotateInto(const ImageView2D& src, const MutableImageView2D& dst, ImageRotation rotation);
+
+/**
+@brief Rotate an image into an existing image using a parallel executor
+@param[in]  src              Input image
+@param[out] dst              Output image
+@param[in]  rotation         Rotation to perform
+@param[in]  parallelFor      Parallel loop executor or @cpp nullptr @ce
+@param[in]  parallelForState State pointer passed to @p parallelFor
+@m_since_latest
+
+Same as @ref rotateInto(const ImageView2D&, const MutableImageView2D&, ImageRotation),
+but with the work split into tasks by output rows and executed through
+@p parallelFor. The output is the same regardless of how the tasks get
+executed.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT void rotateInto(const ImageView2D& src, const MutableImageView2D& dst, ImageRotation rotation, ParallelFor parallelFor, void* parallelForState = nullptr);
+
+/**
+@brief Crop an image
+@m_since_latest
+
+Returns a view on the @p rectangle of @p image without copying any data,
+with @ref PixelStorage::rowLength() and @ref PixelStorage::skip() adjusted
+accordingly. Expects that @p rectangle is contained in the image.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT ImageView2D crop(const ImageView2D& image, const Range2Di& rectangle);
+
+/**
+@brief Crop a mutable image
+@m_since_latest
+
+Same as @ref crop(const ImageView2D&, const Range2Di&), but returning a
+mutable view, which can be subsequently passed to for example
+@ref yFlipInPlace(const MutableImageView2D&).
+*/
+MAGNUM_TEXTURETOOLS_EXPORT MutableImageView2D crop(const MutableImageView2D& image, const Range2Di& rectangle);
+
+}}
+
+#endif
@@ -24,8 +24,10 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/DebugStl.h> /** @todo remove once Arguments is std::string-free */
 #include <Corrade/Utility/Path.h>
@@ -34,12 +36,14 @@
 #include "Magnum/Image.h"
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/ThreadPool.h"
 #include "Magnum/Math/ConfigurationValue.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/GL/Framebuffer.h"
 #include "Magnum/GL/Renderer.h"
 #include "Magnum/GL/Texture.h"
 #include "Magnum/GL/TextureFormat.h"
+#include "Magnum/TextureTools/DistanceFieldCpu.h"
 #include "Magnum/TextureTools/DistanceFieldGL.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
@@ -101,8 +105,8 @@ that can write PNG files.
 
 @code{.sh}
 magnum-distancefieldconverter [--magnum-...] [-h|--help] [--importer IMPORTER]
-    [--converter CONVERTER] [--plugin-dir DIR] --output-size "X Y" --radius N
-    [--] input output
+    [--converter CONVERTER] [--plugin-dir DIR] [--cpu] [--threads N]
+    --output-size "X Y" --radius N [--] input output
 @endcode
 
 Arguments:
@@ -115,10 +119,15 @@ Arguments:
 -   `--converter CONVERTER` --- image converter plugin (default:
     @ref Trade::AnyImageConverter "AnyImageConverter")
 -   `--plugin-dir DIR` --- override base plugin dir
+-   `--cpu` --- calculate the distance field on the CPU using
+    @ref TextureTools::distanceFieldInto() instead of
+    @ref TextureTools::DistanceFieldGL, without creating a GL context
+-   `--threads N` --- count of threads to use with `--cpu`. If `0`, uses the
+    count of hardware threads. (default: `0`)
 -   `--output-size "X Y"` --- size of output image
 -   `--radius N` --- distance field computation radius
 -   `--magnum-...` --- engine-specific options (see
-    @ref GL-Context-usage-command-line for details)
+    @ref GL-Context-usage-command-line for details), ignored with `--cpu`
 
 Images with @ref PixelFormat::R8Unorm, @ref PixelFormat::RGB8Unorm or
 @ref PixelFormat::RGBA8Unorm are accepted on input.
@@ -153,11 +162,14 @@ DistanceFieldConverter::DistanceFieldConverter(const Arguments& arguments): Plat
         #endif
         .addNamedArgument("output-size").setHelp("output-size", "size of output image", "\"X Y\"")
         .addNamedArgument("radius").setHelp("radius", "distance field computation radius", "N")
+        .addBooleanOption("cpu").setHelp("cpu", "calculate on the CPU without creating a GL context")
+        .addOption("threads", "0").setHelp("threads", "count of threads to use with --cpu, 0 for hardware thread count", "N")
         .addSkippedPrefix("magnum", "engine-specific options")
         .setGlobalHelp("Converts red channel of an image to distance field representation.")
         .parse(arguments.argc, arguments.argv);
 
-    createContext();
+    if(!args.isSet("cpu"))
+        createContext();
 }
 
 int DistanceFieldConverter::exec() {
@@ -200,6 +212,34 @@ int DistanceFieldConverter::exec() {
         return 5;
     }
 
+    /* Take just the first channel for the CPU calculation */
+    if(args.isSet("cpu")) {
+        if(image->format() != PixelFormat::R8Unorm &&
+           image->format() != PixelFormat::RGB8Unorm &&
+           image->format() != PixelFormat::RGBA8Unorm) {
+            Error() << "Unsupported image format" << image->format();
+            return 4;
+        }
+
+        const Containers::StridedArrayView3D<const char> pixels = image->pixels();
+        const Containers::StridedArrayView2D<const UnsignedByte> input = Containers::arrayCast<2, const UnsignedByte>(pixels.prefix({pixels.size()[0], pixels.size()[1], 1}));
+
+        Image2D result{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, outputSize, Containers::Array<char>{NoInit, std::size_t(outputSize.product())}};
+
+        /* Zero threads means the hardware concurrency */
+        ThreadPool threadPool{args.value<UnsignedInt>("threads")};
+
+        Debug() << "Converting image of size" << image->size() << "to distance field on" << threadPool.threadCount() << "threads...";
+        TextureTools::distanceFieldInto(input, result.pixels<UnsignedByte>(), args.value<UnsignedInt>("radius"), ThreadPool::parallelFor, &threadPool);
+
+        if(!converter->convertToFile(result, args.value("output"))) {
+            Error() << "Cannot save file" << args.value("output");
+            return 5;
+        }
+
+        return 0;
+    }
+
     /* Decide about internal format */
     /** @todo this doesn't work on ES2, the image pixel format is converted to
         a LUMINANCE which doesn't match GL_RED / GL_R8; it also doesn't check
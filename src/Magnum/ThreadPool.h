@@ -0,0 +1,327 @@
+#ifndef Magnum_ThreadPool_h
+#define Magnum_ThreadPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::ThreadPool
+ * @m_since_latest
+ */
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <Corrade/Containers/GrowableArray.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
+
+#if defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(__EMSCRIPTEN_PTHREADS__)
+#error this header requires Emscripten to be built with -pthread
+#endif
+
+namespace Magnum {
+
+/**
+@brief Work-stealing thread pool
+@m_since_latest
+
+Algorithms in @ref MeshTools, @ref SceneTools, @ref TextureTools,
+@ref MaterialTools, @ref Animation, @ref SceneGraph, @ref Text and
+@ref Trade that are able to make use of multiple threads take a
+@ref ParallelFor function together with a state pointer instead of spawning
+threads on their own. The signature of @ref parallelFor() matches it, so a
+single pool instance can be created by the application and passed to all of
+them, with a pointer to the pool being the state:
+
+@snippet MeshTools.cpp ThreadPool-usage
+
+If the application already has a job system, there's no need to use this
+class at all --- a function of the same signature that dispatches the
+iterations to it can be passed to the algorithms instead:
+
+@snippet MeshTools.cpp ThreadPool-custom
+
+@section ThreadPool-scheduling Scheduling
+
+The pool has @ref threadCount() minus one worker threads, the thread
+calling @ref parallelFor() is participating in the work as well and the
+function returns only once all iterations are done. The iteration range is
+initially split into contiguous parts, one for each thread. Every thread
+processes its part from the front in gradually smaller batches and once it
+runs out of work, it steals the back half of what's left in a part of
+another thread. That keeps the threads busy even if the iterations take
+very different time, while still processing mostly contiguous ranges on each
+thread.
+
+The @ref parallelFor() can be called from multiple threads at the same
+time, and also from inside a task that's itself running on the pool, in
+which case the nested iterations are distributed among the calling thread
+and any workers that are idle at the time. A worker is thus never blocked
+waiting for a task that another worker didn't start yet.
+
+@note This class is header-only and requires the application to link to a
+    threading library, for example `Threads::Threads` in CMake. On
+    @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" it's available only if
+    building with `-pthread`.
+*/
+class ThreadPool {
+    public:
+        /**
+         * @brief Constructor
+         * @param threadCount   Thread count, including the thread calling
+         *      @ref parallelFor(). If @cpp 0 @ce,
+         *      @ref std::thread::hardware_concurrency() is used.
+         *
+         * Spawns @p threadCount minus one worker threads. If
+         * @p threadCount is @cpp 1 @ce, no threads are spawned and
+         * @ref parallelFor() executes everything on the calling thread.
+         */
+        explicit ThreadPool(UnsignedInt threadCount = 0);
+
+        /** @brief Copying is not allowed */
+        ThreadPool(const ThreadPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ThreadPool(ThreadPool&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Joins the worker threads. Expects that no @ref parallelFor() call
+         * is in progress.
+         */
+        ~ThreadPool();
+
+        /** @brief Copying is not allowed */
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ThreadPool& operator=(ThreadPool&&) = delete;
+
+        /**
+         * @brief Thread count
+         *
+         * Count of worker threads plus one for the thread calling
+         * @ref parallelFor().
+         */
+        UnsignedInt threadCount() const { return UnsignedInt(_threads.size() + 1); }
+
+        /**
+         * @brief Execute a parallel loop
+         * @param state         Pointer to a @ref ThreadPool instance
+         * @param count         Count of iterations
+         * @param task          Task to execute for every iteration
+         * @param taskState     State pointer to pass to @p task
+         *
+         * Calls @p task with @p taskState and each value in range
+         * @cpp [0, count) @ce exactly once, distributed among the calling
+         * thread and the worker threads, and returns once all calls
+         * finished. The signature matches @ref ParallelFor, so this
+         * function can be passed directly to the algorithms taking it.
+         * See @ref ThreadPool-scheduling for more information.
+         */
+        static void parallelFor(void* state, std::size_t count, void(*task)(void* taskState, std::size_t i), void* taskState);
+
+    private:
+        struct Range {
+            std::mutex mutex;
+            std::size_t begin, end;
+        };
+
+        struct Job {
+            void(*task)(void*, std::size_t);
+            void* taskState;
+            Containers::Array<Range> ranges;
+            /* All guarded by the pool mutex */
+            std::size_t nextRange;
+            std::size_t activeThreads;
+            bool exhausted;
+        };
+
+        void run();
+        static bool takeFront(Range& range, std::size_t& begin, std::size_t& end);
+        static bool stealBack(Job& job, std::size_t thief, std::size_t& begin, std::size_t& end);
+        static void work(Job& job, std::size_t range);
+
+        Containers::Array<std::thread> _threads;
+        std::mutex _mutex;
+        std::condition_variable _jobAvailable, _jobFinished;
+        Containers::Array<Job*> _jobs;
+        bool _quit = false;
+};
+
+inline ThreadPool::ThreadPool(UnsignedInt threadCount) {
+    if(!threadCount) threadCount = std::thread::hardware_concurrency();
+    /* hardware_concurrency() returns 0 if the value can't be determined */
+    if(!threadCount) threadCount = 1;
+
+    _threads = Containers::Array<std::thread>{threadCount - 1};
+    for(std::thread& thread: _threads)
+        thread = std::thread{&ThreadPool::run, this};
+}
+
+inline ThreadPool::~ThreadPool() {
+    {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _quit = true;
+    }
+    _jobAvailable.notify_all();
+
+    for(std::thread& thread: _threads) thread.join();
+}
+
+inline void ThreadPool::parallelFor(void* const state, const std::size_t count, void(*const task)(void*, std::size_t), void* const taskState) {
+    ThreadPool& pool = *static_cast<ThreadPool*>(state);
+
+    /* Nothing to distribute, execute directly */
+    const std::size_t rangeCount = Math::min(std::size_t(pool.threadCount()), count);
+    if(rangeCount <= 1) {
+        for(std::size_t i = 0; i != count; ++i)
+            task(taskState, i);
+        return;
+    }
+
+    Job job{task, taskState, Containers::Array<Range>{rangeCount}, 1, 1, false};
+    for(std::size_t i = 0; i != rangeCount; ++i) {
+        job.ranges[i].begin = count*i/rangeCount;
+        job.ranges[i].end = count*(i + 1)/rangeCount;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock{pool._mutex};
+        arrayAppend(pool._jobs, &job);
+    }
+    pool._jobAvailable.notify_all();
+
+    /* The calling thread takes the first range */
+    work(job, 0);
+
+    /* There's nothing left to take, so remove the job to not have any more
+       workers join it and wait for those that are still executing their
+       last batch. The job is on the stack so nobody can touch it after. */
+    std::unique_lock<std::mutex> lock{pool._mutex};
+    job.exhausted = true;
+    for(std::size_t i = 0; i != pool._jobs.size(); ++i) if(pool._jobs[i] == &job) {
+        /* Keep the order, so workers join the oldest jobs first */
+        for(std::size_t j = i + 1; j != pool._jobs.size(); ++j)
+            pool._jobs[j - 1] = pool._jobs[j];
+        arrayRemoveSuffix(pool._jobs);
+        break;
+    }
+    --job.activeThreads;
+    pool._jobFinished.wait(lock, [&job]() { return !job.activeThreads; });
+}
+
+inline void ThreadPool::run() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    for(;;) {
+        Job* job = nullptr;
+        _jobAvailable.wait(lock, [this, &job]() {
+            for(Job* const i: _jobs) if(!i->exhausted) {
+                job = i;
+                return true;
+            }
+            return _quit;
+        });
+        if(!job) return;
+
+        /* Take the next range that isn't owned by anybody yet. If there's
+           none, which can happen with nested jobs having less ranges than
+           threads, the worker is only stealing. */
+        ++job->activeThreads;
+        const std::size_t range = job->nextRange < job->ranges.size() ? job->nextRange++ : ~std::size_t{};
+
+        lock.unlock();
+        work(*job, range);
+        lock.lock();
+
+        /* The worker didn't find anything more to steal, don't let others
+           join anymore */
+        job->exhausted = true;
+        if(!--job->activeThreads) _jobFinished.notify_all();
+    }
+}
+
+inline bool ThreadPool::takeFront(Range& range, std::size_t& begin, std::size_t& end) {
+    std::unique_lock<std::mutex> lock{range.mutex};
+    if(range.begin == range.end) return false;
+
+    /* Take an eighth of what's left, which makes the batches smaller towards
+       the end of the range, where thieves are more likely to arrive */
+    begin = range.begin;
+    end = range.begin + Math::max((range.end - range.begin)/8, std::size_t{1});
+    range.begin = end;
+    return true;
+}
+
+inline bool ThreadPool::stealBack(Job& job, const std::size_t thief, std::size_t& begin, std::size_t& end) {
+    /* Start with the range after the thief's own, so the thieves don't all
+       end up fighting over the first range */
+    const std::size_t rangeCount = job.ranges.size();
+    const std::size_t start = thief < rangeCount ? thief + 1 : 0;
+    for(std::size_t i = 0; i != rangeCount; ++i) {
+        Range& victim = job.ranges[(start + i) % rangeCount];
+        std::unique_lock<std::mutex> lock{victim.mutex};
+        if(victim.begin == victim.end) continue;
+
+        end = victim.end;
+        begin = victim.end - (victim.end - victim.begin + 1)/2;
+        victim.end = begin;
+        return true;
+    }
+
+    return false;
+}
+
+inline void ThreadPool::work(Job& job, const std::size_t range) {
+    for(;;) {
+        std::size_t begin, end;
+        if(range < job.ranges.size() && takeFront(job.ranges[range], begin, end)) {
+            for(std::size_t i = begin; i != end; ++i)
+                job.task(job.taskState, i);
+            continue;
+        }
+
+        if(!stealBack(job, range, begin, end)) return;
+
+        /* If the thief owns a range, put the stolen work there so it can be
+           processed in batches and stolen from again. Otherwise execute it
+           directly. */
+        if(range < job.ranges.size()) {
+            Range& own = job.ranges[range];
+            std::unique_lock<std::mutex> lock{own.mutex};
+            own.begin = begin;
+            own.end = end;
+        } else for(std::size_t i = begin; i != end; ++i)
+            job.task(job.taskState, i);
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,130 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TiledImageView.h"
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum {
+
+namespace {
+
+template<UnsignedInt dimensions> RangeTypeFor<dimensions, Int> rangeFor(const Math::Vector<dimensions, Int>& min, const Math::Vector<dimensions, Int>& max) {
+    return {min, max};
+}
+
+/* One-dimensional ranges are not using a vector type */
+template<> Range1Di rangeFor<1>(const Math::Vector<1, Int>& min, const Math::Vector<1, Int>& max) {
+    return {min[0], max[0]};
+}
+
+}
+
+template<UnsignedInt dimensions, class T> TiledImageView<dimensions, T>::TiledImageView(const PixelFormat format, const VectorTypeFor<dimensions, Int>& size, const VectorTypeFor<dimensions, Int>& tileSize, const Containers::ArrayView<T* const> tiles) noexcept: _format{format}, _pixelSize{pixelFormatSize(format)}, _size{size}, _tileSize{tileSize}, _tiles{tiles} {
+    CORRADE_ASSERT((Math::Vector<dimensions, Int>{tileSize} > Math::Vector<dimensions, Int>{0}).all(),
+        "TiledImageView: expected a positive tile size but got" << Debug::packed << tileSize, );
+    CORRADE_ASSERT(std::size_t(Math::Vector<dimensions, Int>{tileCount()}.product()) == tiles.size(),
+        "TiledImageView: expected" << Math::Vector<dimensions, Int>{tileCount()}.product() << "tiles for a" << Debug::packed << size << "image with" << Debug::packed << tileSize << "tiles but got" << tiles.size(), );
+}
+
+template<UnsignedInt dimensions, class T> VectorTypeFor<dimensions, Int> TiledImageView<dimensions, T>::tileCount() const {
+    const Math::Vector<dimensions, Int> tileSize{_tileSize};
+    return (Math::Vector<dimensions, Int>{_size} + tileSize - Math::Vector<dimensions, Int>{1})/tileSize;
+}
+
+template<UnsignedInt dimensions, class T> std::size_t TiledImageView<dimensions, T>::tileDataSize() const {
+    return std::size_t(Math::Vector<dimensions, Int>{_tileSize}.product())*_pixelSize;
+}
+
+template<UnsignedInt dimensions, class T> std::size_t TiledImageView<dimensions, T>::residentTileCount() const {
+    std::size_t count = 0;
+    for(T* const tile: _tiles)
+        if(tile) ++count;
+    return count;
+}
+
+template<UnsignedInt dimensions, class T> std::size_t TiledImageView<dimensions, T>::tileIndex(const char*
+    #ifndef CORRADE_NO_ASSERT
+    const function
+    #endif
+    , const VectorTypeFor<dimensions, Int>& tile) const
+{
+    const Math::Vector<dimensions, Int> count{tileCount()};
+    const Math::Vector<dimensions, Int> tile_{tile};
+    CORRADE_ASSERT((tile_ >= Math::Vector<dimensions, Int>{0}).all() && (tile_ < count).all(),
+        "TiledImageView::" << Debug::nospace << function << Debug::nospace << "(): tile" << Debug::packed << tile << "out of range for" << Debug::packed << tileCount() << "tiles", {});
+
+    /* Row-major, i.e. X changing the fastest */
+    std::size_t index = 0;
+    for(std::size_t i = dimensions; i != 0; --i)
+        index = index*count[i - 1] + tile_[i - 1];
+    return index;
+}
+
+template<UnsignedInt dimensions, class T> bool TiledImageView<dimensions, T>::isTileResident(const VectorTypeFor<dimensions, Int>& tile) const {
+    return _tiles[tileIndex("isTileResident", tile)];
+}
+
+template<UnsignedInt dimensions, class T> RangeTypeFor<dimensions, Int> TiledImageView<dimensions, T>::tileRange(const VectorTypeFor<dimensions, Int>& tile) const {
+    #ifndef CORRADE_NO_ASSERT
+    tileIndex("tileRange", tile);
+    #endif
+    const Math::Vector<dimensions, Int> tileSize{_tileSize};
+    const Math::Vector<dimensions, Int> min = Math::Vector<dimensions, Int>{tile}*tileSize;
+    return rangeFor<dimensions>(min, Math::min(min + tileSize, Math::Vector<dimensions, Int>{_size}));
+}
+
+template<UnsignedInt dimensions, class T> ImageView<dimensions, T> TiledImageView<dimensions, T>::tile(const VectorTypeFor<dimensions, Int>& tile) const {
+    const std::size_t index = tileIndex("tile", tile);
+    CORRADE_ASSERT(_tiles[index],
+        "TiledImageView::tile(): tile" << Debug::packed << tile << "is not resident", (ImageView<dimensions, T>{_format, VectorTypeFor<dimensions, Int>{}}));
+
+    const Math::Vector<dimensions, Int> tileSize{_tileSize};
+    const Math::Vector<dimensions, Int> min = Math::Vector<dimensions, Int>{tile}*tileSize;
+    const Math::Vector<dimensions, Int> max = Math::min(min + tileSize, Math::Vector<dimensions, Int>{_size});
+
+    /* Pixels are tightly packed in the whole tile, even if it's only
+       partially covered by the image */
+    const Vector3i paddedTileSize = Vector3i::pad(tileSize, 1);
+    PixelStorage storage;
+    storage.setAlignment(1)
+        .setRowLength(paddedTileSize.x())
+        .setImageHeight(paddedTileSize.y());
+
+    return ImageView<dimensions, T>{storage, _format, max - min, {_tiles[index], tileDataSize()}};
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template class MAGNUM_EXPORT TiledImageView<1, const char>;
+template class MAGNUM_EXPORT TiledImageView<2, const char>;
+template class MAGNUM_EXPORT TiledImageView<3, const char>;
+template class MAGNUM_EXPORT TiledImageView<1, char>;
+template class MAGNUM_EXPORT TiledImageView<2, char>;
+template class MAGNUM_EXPORT TiledImageView<3, char>;
+#endif
+
+}
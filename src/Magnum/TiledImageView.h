@@ -0,0 +1,230 @@
+#ifndef Magnum_TiledImageView_h
+#define Magnum_TiledImageView_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::TiledImageView, alias @ref Magnum::BasicTiledImageView, @ref Magnum::BasicMutableTiledImageView, typedef @ref Magnum::TiledImageView1D, @ref Magnum::TiledImageView2D, @ref Magnum::TiledImageView3D, @ref Magnum::MutableTiledImageView1D, @ref Magnum::MutableTiledImageView2D, @ref Magnum::MutableTiledImageView3D
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum {
+
+/**
+@brief Tiled image view
+@m_since_latest
+
+Non-owning view on an image split into a grid of equally-sized tiles, each
+tile stored in a separate memory location and each either resident, i.e.
+having its data present, or not. Useful for streaming very large (virtual)
+textures, where only a subset of the tiles is in memory at a time, for
+example together with sparse textures in @ref GL::Texture::setSparse().
+
+The tiles are described by a list of pointers in a row-major order, with
+non-resident tiles being @cpp nullptr @ce. The pixels in each tile are
+tightly packed with a row length equal to the tile width and image height
+equal to the tile height, including tiles on the right, bottom and back edge
+of the image, which may be only partially covered by the image. Data of a
+particular tile can be then accessed as a regular @ref ImageView through
+@ref tile(). Implementation-specific pixel formats are not supported.
+
+@see @ref TiledImageView1D, @ref TiledImageView2D, @ref TiledImageView3D,
+    @ref MutableTiledImageView1D, @ref MutableTiledImageView2D,
+    @ref MutableTiledImageView3D
+*/
+template<UnsignedInt dimensions, class T> class TiledImageView {
+    public:
+        enum: UnsignedInt {
+            Dimensions = dimensions /**< Image dimension count */
+        };
+
+        /**
+         * @brief Data type
+         *
+         * @cpp const char @ce for @ref BasicTiledImageView;
+         * @cpp char @ce for @ref BasicMutableTiledImageView.
+         */
+        typedef T Type;
+
+        /**
+         * @brief Constructor
+         * @param format    Format of pixel data
+         * @param size      Image size
+         * @param tileSize  Tile size
+         * @param tiles     Pointers to tile data. Non-resident tiles are
+         *      @cpp nullptr @ce.
+         *
+         * Expects that @p tileSize is positive in all dimensions and that
+         * @p tiles contains exactly @ref tileCount() items. Each non-null
+         * item is expected to point to @ref tileDataSize() bytes.
+         */
+        explicit TiledImageView(PixelFormat format, const VectorTypeFor<dimensions, Int>& size, const VectorTypeFor<dimensions, Int>& tileSize, Containers::ArrayView<T* const> tiles) noexcept;
+
+        /** @brief Format of pixel data */
+        PixelFormat format() const { return _format; }
+
+        /** @brief Pixel size (in bytes) */
+        UnsignedInt pixelSize() const { return _pixelSize; }
+
+        /** @brief Image size */
+        VectorTypeFor<dimensions, Int> size() const { return _size; }
+
+        /** @brief Tile size */
+        VectorTypeFor<dimensions, Int> tileSize() const { return _tileSize; }
+
+        /**
+         * @brief Tile count
+         *
+         * Image size divided by the tile size, rounded up.
+         */
+        VectorTypeFor<dimensions, Int> tileCount() const;
+
+        /**
+         * @brief Tile data size
+         *
+         * Size of data of a single tile, in bytes. Same for all tiles.
+         */
+        std::size_t tileDataSize() const;
+
+        /**
+         * @brief Tile data pointers
+         *
+         * In a row-major order, non-resident tiles are @cpp nullptr @ce.
+         */
+        Containers::ArrayView<T* const> tiles() const { return _tiles; }
+
+        /** @brief Count of resident tiles */
+        std::size_t residentTileCount() const;
+
+        /**
+         * @brief Whether a tile is resident
+         *
+         * Expects that @p tile is less than @ref tileCount().
+         */
+        bool isTileResident(const VectorTypeFor<dimensions, Int>& tile) const;
+
+        /**
+         * @brief Tile pixel range
+         *
+         * Range of pixels in the image covered by @p tile, clamped to the
+         * image size. Expects that @p tile is less than @ref tileCount().
+         */
+        RangeTypeFor<dimensions, Int> tileRange(const VectorTypeFor<dimensions, Int>& tile) const;
+
+        /**
+         * @brief Tile view
+         *
+         * Returns a view on the tile data, with size matching
+         * @ref tileRange() and @ref PixelStorage describing the tile layout.
+         * Expects that @p tile is less than @ref tileCount() and that it's
+         * resident.
+         */
+        ImageView<dimensions, T> tile(const VectorTypeFor<dimensions, Int>& tile) const;
+
+    private:
+        std::size_t tileIndex(const char* function, const VectorTypeFor<dimensions, Int>& tile) const;
+
+        PixelFormat _format;
+        UnsignedInt _pixelSize;
+        VectorTypeFor<dimensions, Int> _size, _tileSize;
+        Containers::ArrayView<T* const> _tiles;
+};
+
+/**
+@brief Const tiled image view
+@m_since_latest
+
+@see @ref TiledImageView1D, @ref TiledImageView2D, @ref TiledImageView3D,
+    @ref BasicMutableTiledImageView
+*/
+template<UnsignedInt dimensions> using BasicTiledImageView = TiledImageView<dimensions, const char>;
+
+/**
+@brief One-dimensional tiled image view
+@m_since_latest
+
+@see @ref MutableTiledImageView1D
+*/
+typedef BasicTiledImageView<1> TiledImageView1D;
+
+/**
+@brief Two-dimensional tiled image view
+@m_since_latest
+
+@see @ref MutableTiledImageView2D
+*/
+typedef BasicTiledImageView<2> TiledImageView2D;
+
+/**
+@brief Three-dimensional tiled image view
+@m_since_latest
+
+@see @ref MutableTiledImageView3D
+*/
+typedef BasicTiledImageView<3> TiledImageView3D;
+
+/**
+@brief Mutable tiled image view
+@m_since_latest
+
+@see @ref MutableTiledImageView1D, @ref MutableTiledImageView2D,
+    @ref MutableTiledImageView3D, @ref BasicTiledImageView
+*/
+template<UnsignedInt dimensions> using BasicMutableTiledImageView = TiledImageView<dimensions, char>;
+
+/**
+@brief One-dimensional mutable tiled image view
+@m_since_latest
+
+@see @ref TiledImageView1D
+*/
+typedef BasicMutableTiledImageView<1> MutableTiledImageView1D;
+
+/**
+@brief Two-dimensional mutable tiled image view
+@m_since_latest
+
+@see @ref TiledImageView2D
+*/
+typedef BasicMutableTiledImageView<2> MutableTiledImageView2D;
+
+/**
+@brief Three-dimensional mutable tiled image view
+@m_since_latest
+
+@see @ref TiledImageView3D
+*/
+typedef BasicMutableTiledImageView<3> MutableTiledImageView3D;
+
+}
+
+#endif
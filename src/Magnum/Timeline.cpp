@@ -27,10 +27,12 @@
 
 #include "Timeline.h"
 
+#include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 #include <Corrade/Utility/System.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Math/Time.h"
 
 using namespace std::chrono;
 
@@ -41,6 +43,10 @@ void Timeline::start() {
     _startTime = high_resolution_clock::now();
     _previousFrameTime = _startTime;
     _previousFrameDuration = 0;
+    _previousFrameDurationNanoseconds = 0;
+    _smoothedFrameDuration = 0;
+    _fixedStepAccumulator = 0;
+    _fixedStepCount = 0;
 }
 
 void Timeline::stop() {
@@ -48,15 +54,72 @@ void Timeline::stop() {
     _startTime = high_resolution_clock::time_point();
     _previousFrameTime = _startTime;
     _previousFrameDuration = 0;
+    _previousFrameDurationNanoseconds = 0;
+    _smoothedFrameDuration = 0;
+    _fixedStepAccumulator = 0;
+    _fixedStepCount = 0;
 }
 
 void Timeline::nextFrame() {
     if(!_running) return;
 
     auto now = high_resolution_clock::now();
-    auto duration = UnsignedInt(duration_cast<microseconds>(now-_previousFrameTime).count());
-    _previousFrameDuration = duration/1e6f;
+    _previousFrameDurationNanoseconds = duration_cast<nanoseconds>(now-_previousFrameTime).count();
+    _previousFrameDuration = _previousFrameDurationNanoseconds/1e9f;
     _previousFrameTime = now;
+
+    /* The first frame initializes the average, otherwise it'd take several
+       frames to converge from zero */
+    if(_smoothedFrameDuration == 0.0f)
+        _smoothedFrameDuration = _previousFrameDuration;
+    else
+        _smoothedFrameDuration += _frameDurationSmoothing*(_previousFrameDuration - _smoothedFrameDuration);
+
+    if(!_fixedTimeStep) return;
+
+    _fixedStepAccumulator += _previousFrameDurationNanoseconds;
+    const Long stepCount = _fixedStepAccumulator/_fixedTimeStep;
+    if(stepCount > _maxFixedStepCount) {
+        /* Discard the whole steps that didn't fit, but keep the fraction so
+           the interpolation stays continuous */
+        _fixedStepCount = _maxFixedStepCount;
+        _fixedStepAccumulator %= _fixedTimeStep;
+    } else {
+        _fixedStepCount = UnsignedInt(stepCount);
+        _fixedStepAccumulator -= stepCount*_fixedTimeStep;
+    }
+}
+
+Nanoseconds Timeline::previousFrameDurationNanoseconds() const {
+    return Nanoseconds{_previousFrameDurationNanoseconds};
+}
+
+Timeline& Timeline::setFrameDurationSmoothing(const Float factor) {
+    CORRADE_ASSERT(factor > 0.0f && factor <= 1.0f,
+        "Timeline::setFrameDurationSmoothing(): expected factor in range (0, 1], got" << factor, *this);
+    _frameDurationSmoothing = factor;
+    return *this;
+}
+
+Timeline& Timeline::setFixedTimeStep(const Float seconds) {
+    CORRADE_ASSERT(seconds >= 0.0f,
+        "Timeline::setFixedTimeStep(): expected a non-negative value, got" << seconds, *this);
+    _fixedTimeStep = Long(Double(seconds)*1.0e9);
+    _fixedStepAccumulator = 0;
+    _fixedStepCount = 0;
+    return *this;
+}
+
+Timeline& Timeline::setMaxFixedStepCount(const UnsignedInt count) {
+    CORRADE_ASSERT(count,
+        "Timeline::setMaxFixedStepCount(): expected a non-zero count", *this);
+    _maxFixedStepCount = count;
+    return *this;
+}
+
+Float Timeline::fixedStepInterpolation() const {
+    if(!_fixedTimeStep) return 0.0f;
+    return Float(Double(_fixedStepAccumulator)/Double(_fixedTimeStep));
 }
 
 Float Timeline::previousFrameTime() const {
@@ -33,7 +33,7 @@
 
 #include <chrono>
 
-#include "Magnum/Types.h"
+#include "Magnum/Magnum.h"
 #include "Magnum/visibility.h"
 
 namespace Magnum {
@@ -73,6 +73,35 @@ be used together with @ref Animation::Player for a more controlled behavior. In
 that case, it's recommended to never call @ref Timeline::stop() but control the
 player start/pause/stop state instead. See @ref Animation::Player documentation
 for more information.
+
+@section Timeline-fixed-step Fixed time step
+
+For simulations that need to be advanced in constant increments independently
+of the rendering rate, such as physics, set a fixed time step using
+@ref setFixedTimeStep(). Each @ref nextFrame() then adds the measured frame
+duration to an internal accumulator and calculates how many whole steps fit
+into it, which is available through @ref fixedStepCount(). The remaining
+fraction of a step is exposed as @ref fixedStepInterpolation() and can be used
+to interpolate the rendered state between the last two simulation steps:
+
+@snippet Magnum-application.cpp Timeline-fixed-step
+
+To avoid a spiral where a slow frame causes more simulation steps, which in
+turn make the next frame even slower, the step count is limited to
+@ref maxFixedStepCount() and the time that didn't fit is discarded.
+
+@section Timeline-statistics Frame duration statistics
+
+Frame duration is measured with a nanosecond precision, which is available
+through @ref previousFrameDurationNanoseconds(). Because the duration of
+individual frames fluctuates, @ref smoothedFrameDuration() provides an
+exponential moving average that's more suitable for example for displaying a
+FPS counter or adapting level of detail. The amount of smoothing can be
+controlled with @ref setFrameDurationSmoothing().
+
+The @ref previousFrameDurationNanoseconds() value can be directly fed to
+@ref DebugTools::FrameProfiler, see
+@ref DebugTools-FrameProfiler-setup-timeline for an example.
 */
 class MAGNUM_EXPORT Timeline {
     public:
@@ -123,7 +152,9 @@ class MAGNUM_EXPORT Timeline {
          * between @ref start() and @ref nextFrame(), if the previous frame
          * was the first. If the timeline is stopped, the function returns
          * @cpp 0.0f @ce.
-         * @đee @ref currentFrameDuration()
+         * @see @ref currentFrameDuration(),
+         *      @ref previousFrameDurationNanoseconds(),
+         *      @ref smoothedFrameDuration()
          */
         Float previousFrameDuration() const { return _previousFrameDuration; }
 
@@ -149,10 +180,124 @@ class MAGNUM_EXPORT Timeline {
          */
         Float currentFrameDuration() const;
 
+        /**
+         * @brief Duration of previous frame in nanoseconds
+         * @m_since_latest
+         *
+         * Same as @ref previousFrameDuration(), but with a full precision
+         * of the underlying clock. If the timeline is stopped, the function
+         * returns @cpp 0_nsec @ce. Use @ref Magnum/Math/Time.h to operate
+         * with the returned value.
+         */
+        Nanoseconds previousFrameDurationNanoseconds() const;
+
+        /**
+         * @brief Smoothed frame duration in seconds
+         * @m_since_latest
+         *
+         * Exponential moving average of @ref previousFrameDuration(),
+         * updated in every @ref nextFrame(). After @ref start() the average is
+         * initialized with the first measured frame duration. If the timeline
+         * is stopped, the function returns @cpp 0.0f @ce.
+         * @see @ref setFrameDurationSmoothing()
+         */
+        Float smoothedFrameDuration() const { return _smoothedFrameDuration; }
+
+        /**
+         * @brief Frame duration smoothing factor
+         * @m_since_latest
+         *
+         * @see @ref setFrameDurationSmoothing()
+         */
+        Float frameDurationSmoothing() const { return _frameDurationSmoothing; }
+
+        /**
+         * @brief Set frame duration smoothing factor
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Weight of the newest frame duration in @ref smoothedFrameDuration().
+         * Expected to be larger than @cpp 0.0f @ce and at most @cpp 1.0f @ce,
+         * which disables the smoothing. Default is @cpp 0.1f @ce.
+         */
+        Timeline& setFrameDurationSmoothing(Float factor);
+
+        /**
+         * @brief Fixed time step in seconds
+         * @m_since_latest
+         *
+         * @see @ref setFixedTimeStep()
+         */
+        Float fixedTimeStep() const { return _fixedTimeStep/1.0e9f; }
+
+        /**
+         * @brief Set fixed time step
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Expects that @p seconds is not negative. Setting a zero value
+         * disables the fixed step accumulator, which is the default. Resets
+         * the accumulated time, @ref fixedStepCount() and
+         * @ref fixedStepInterpolation() to zero. See @ref Timeline-fixed-step
+         * for more information.
+         */
+        Timeline& setFixedTimeStep(Float seconds);
+
+        /**
+         * @brief Max count of fixed steps per frame
+         * @m_since_latest
+         *
+         * @see @ref setMaxFixedStepCount()
+         */
+        UnsignedInt maxFixedStepCount() const { return _maxFixedStepCount; }
+
+        /**
+         * @brief Set max count of fixed steps per frame
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * If the accumulated time would result in more steps than @p count,
+         * @ref fixedStepCount() is clamped to @p count and the remaining
+         * whole steps are discarded. Expects that @p count is not zero.
+         * Default is @cpp 8 @ce.
+         */
+        Timeline& setMaxFixedStepCount(UnsignedInt count);
+
+        /**
+         * @brief Count of fixed steps to perform for previous frame
+         * @m_since_latest
+         *
+         * Calculated in every @ref nextFrame() from the accumulated time.
+         * Returns @cpp 0 @ce if the timeline is stopped or if
+         * @ref fixedTimeStep() is zero.
+         * @see @ref fixedStepInterpolation()
+         */
+        UnsignedInt fixedStepCount() const { return _fixedStepCount; }
+
+        /**
+         * @brief Interpolation factor between last two fixed steps
+         * @m_since_latest
+         *
+         * Fraction of a fixed step remaining in the accumulator after
+         * @ref fixedStepCount() steps were taken out of it, in range
+         * @f$ [0, 1) @f$. Returns @cpp 0.0f @ce if the timeline is stopped or
+         * if @ref fixedTimeStep() is zero.
+         */
+        Float fixedStepInterpolation() const;
+
     private:
         std::chrono::high_resolution_clock::time_point _startTime{};
         std::chrono::high_resolution_clock::time_point _previousFrameTime{};
         Float _previousFrameDuration{};
+        Float _smoothedFrameDuration{};
+        Float _frameDurationSmoothing{0.1f};
+        /* All in nanoseconds. Not using Nanoseconds in order to not need
+           Math/Time.h here. */
+        Long _previousFrameDurationNanoseconds{};
+        Long _fixedTimeStep{};
+        Long _fixedStepAccumulator{};
+        UnsignedInt _maxFixedStepCount{8};
+        UnsignedInt _fixedStepCount{};
 
         bool _running = false;
 };
@@ -30,13 +30,17 @@
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once file callbacks are <string>-free */
 #include <Corrade/PluginManager/Manager.hpp>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Path.h>
 
 #include "Magnum/FileCallback.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
 #include "Magnum/Trade/AnimationData.h"
 #include "Magnum/Trade/ArrayAllocator.h"
 #include "Magnum/Trade/CameraData.h"
@@ -114,11 +118,16 @@ AbstractImporter::AbstractImporter(PluginManager::Manager<AbstractImporter>& man
 
 AbstractImporter::AbstractImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): PluginManager::AbstractManagingPlugin<AbstractImporter>{manager, plugin} {}
 
-#ifdef MAGNUM_BUILD_DEPRECATED
-/* These twp needed because of the Array<CachedScenes> member */
+struct AbstractImporter::MappedFile {
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Array<const char, Utility::Path::MapDeleter> data;
+    #endif
+};
+
+/* These two needed because of the Pointer<MappedFile> and
+   Pointer<CachedScenes> members */
 AbstractImporter::AbstractImporter(AbstractImporter&&) noexcept = default;
 AbstractImporter::~AbstractImporter() = default;
-#endif
 
 void AbstractImporter::setFlags(ImporterFlags flags) {
     CORRADE_ASSERT(!isOpened(),
@@ -148,6 +157,29 @@ void AbstractImporter::setFileCallback(Containers::Optional<Containers::ArrayVie
 
 void AbstractImporter::doSetFileCallback(Containers::Optional<Containers::ArrayView<const char>>(*)(const std::string&, InputFileCallbackPolicy, void*), void*) {}
 
+void AbstractImporter::setAllocator(void*(*const allocator)(std::size_t, std::size_t, void*), void* const userData) {
+    _allocator = allocator;
+    _allocatorUserData = userData;
+}
+
+Containers::Array<char> AbstractImporter::allocateData(const std::size_t size, const std::size_t alignment) {
+    if(!_allocator)
+        return Containers::Array<char>{NoInit, size};
+
+    /* Not bothering the allocator with empty allocations */
+    if(!size) return nullptr;
+
+    void* const data = _allocator(size, alignment, _allocatorUserData);
+    if(!data) {
+        Error{} << "Trade::AbstractImporter::allocateData(): allocator failed to provide" << size << "bytes";
+        return nullptr;
+    }
+    CORRADE_ASSERT(reinterpret_cast<std::uintptr_t>(data) % alignment == 0,
+        "Trade::AbstractImporter::allocateData(): allocator returned a pointer not aligned to" << alignment << "bytes", nullptr);
+
+    return Containers::Array<char>{static_cast<char*>(data), size, Implementation::nonOwnedArrayDeleter};
+}
+
 bool AbstractImporter::openData(Containers::ArrayView<const void> data) {
     CORRADE_ASSERT(features() & ImporterFeature::OpenData,
         "Trade::AbstractImporter::openData(): feature not supported", {});
@@ -264,6 +296,25 @@ void AbstractImporter::doOpenFile(const Containers::StringView filename) {
 
     /* Otherwise open the file directly */
     } else {
+        /* If zero-copy import is requested, try to map the file first. If
+           that fails (for example because the file is empty, which is valid
+           for some formats), fall back to reading it, which will also produce
+           a proper error message if the file doesn't exist. */
+        #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+        if(_flags & ImporterFlag::ZeroCopy) {
+            Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mapped = Utility::Path::mapRead(filename);
+            if(mapped && !mapped->isEmpty()) {
+                _mappedFile.emplace();
+                _mappedFile->data = *Utility::move(mapped);
+                doOpenData(Containers::Array<char>{const_cast<char*>(_mappedFile->data.data()), _mappedFile->data.size(), Implementation::nonOwnedArrayDeleter}, DataFlag::ExternallyOwned);
+
+                /* Don't keep the mapping around if the opening failed */
+                if(!isOpened()) _mappedFile = nullptr;
+                return;
+            }
+        }
+        #endif
+
         Containers::Optional<Containers::Array<char>> data = Utility::Path::read(filename);
         if(!data) {
             Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
@@ -279,6 +330,9 @@ void AbstractImporter::close() {
         doClose();
         CORRADE_INTERNAL_ASSERT(!isOpened());
     }
+
+    /* Unmap the file only after the implementation stopped referencing it */
+    _mappedFile = nullptr;
 }
 
 Int AbstractImporter::defaultScene() const {
@@ -1538,6 +1592,118 @@ Containers::Optional<ImageData2D> AbstractImporter::image2D(const Containers::St
     return image2D(id, level);
 }
 
+Containers::Optional<ImageView2D> AbstractImporter::image2DLayout(const UnsignedInt id, const UnsignedInt level) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image2DLayout(): no file opened", {});
+    CORRADE_ASSERT(id < doImage2DCount(), "Trade::AbstractImporter::image2DLayout(): index" << id << "out of range for" << doImage2DCount() << "entries", {});
+    #ifndef CORRADE_NO_ASSERT
+    /* Same as in image2D() */
+    if(level) {
+        const UnsignedInt levelCount = doImage2DLevelCount(id);
+        CORRADE_ASSERT(levelCount, "Trade::AbstractImporter::image2DLayout(): implementation reported zero levels", {});
+        CORRADE_ASSERT(level < levelCount, "Trade::AbstractImporter::image2DLayout(): level" << level << "out of range for" << levelCount << "entries", {});
+    }
+    #endif
+    return doImage2DLayout(id, level);
+}
+
+Containers::Optional<ImageView2D> AbstractImporter::doImage2DLayout(const UnsignedInt id, const UnsignedInt level) {
+    /* Calling the implementation directly, the checks were done already */
+    Containers::Optional<ImageData2D> image = doImage2D(id, level);
+    if(!image) return {};
+    if(image->isCompressed()) {
+        Error{} << "Trade::AbstractImporter::image2DLayout(): compressed images are not supported";
+        return {};
+    }
+
+    return ImageView2D{image->storage(), image->format(), image->formatExtra(), image->pixelSize(), image->size(), image->flags()};
+}
+
+bool AbstractImporter::image2DInto(const UnsignedInt id, const MutableImageView2D& image, const UnsignedInt level) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image2DInto(): no file opened", {});
+    CORRADE_ASSERT(id < doImage2DCount(), "Trade::AbstractImporter::image2DInto(): index" << id << "out of range for" << doImage2DCount() << "entries", {});
+    #ifndef CORRADE_NO_ASSERT
+    /* Same as in image2D() */
+    if(level) {
+        const UnsignedInt levelCount = doImage2DLevelCount(id);
+        CORRADE_ASSERT(levelCount, "Trade::AbstractImporter::image2DInto(): implementation reported zero levels", {});
+        CORRADE_ASSERT(level < levelCount, "Trade::AbstractImporter::image2DInto(): level" << level << "out of range for" << levelCount << "entries", {});
+    }
+    #endif
+    CORRADE_ASSERT(image.data().data() || !image.size().product(),
+        "Trade::AbstractImporter::image2DInto(): the image has no data", {});
+    return doImage2DInto(id, level, image);
+}
+
+bool AbstractImporter::doImage2DInto(const UnsignedInt id, const UnsignedInt level, const MutableImageView2D& image) {
+    /* Calling the implementation directly, the checks were done already */
+    Containers::Optional<ImageData2D> imported = doImage2D(id, level);
+    if(!imported) return false;
+    if(imported->isCompressed()) {
+        Error{} << "Trade::AbstractImporter::image2DInto(): compressed images are not supported";
+        return false;
+    }
+    if(imported->format() != image.format() || imported->formatExtra() != image.formatExtra() || imported->pixelSize() != image.pixelSize() || imported->size() != image.size()) {
+        Error{} << "Trade::AbstractImporter::image2DInto(): expected a" << imported->format() << "image of size" << imported->size() << "but got" << image.format() << "and" << image.size();
+        return false;
+    }
+
+    Utility::copy(imported->pixels(), image.pixels());
+    return true;
+}
+
+namespace {
+
+struct Image2DLevelsState {
+    void(*callback)(UnsignedInt, ImageData2D&&, void*);
+    void* state;
+    /* One after the level the implementation is expected to deliver next */
+    UnsignedInt nextLevel;
+};
+
+}
+
+bool AbstractImporter::image2DLevels(const UnsignedInt id, const UnsignedInt levelBegin, const UnsignedInt levelEnd, void(*const callback)(UnsignedInt, ImageData2D&&, void*), void* const state) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image2DLevels(): no file opened", {});
+    CORRADE_ASSERT(id < doImage2DCount(), "Trade::AbstractImporter::image2DLevels(): index" << id << "out of range for" << doImage2DCount() << "entries", {});
+    CORRADE_ASSERT(callback, "Trade::AbstractImporter::image2DLevels(): callback can't be null", {});
+    #ifndef CORRADE_NO_ASSERT
+    const UnsignedInt levelCount = doImage2DLevelCount(id);
+    CORRADE_ASSERT(levelCount, "Trade::AbstractImporter::image2DLevels(): implementation reported zero levels", {});
+    CORRADE_ASSERT(levelBegin < levelEnd && levelEnd <= levelCount, "Trade::AbstractImporter::image2DLevels(): invalid level range [" << Debug::nospace << levelBegin << Debug::nospace << "," << levelEnd << Debug::nospace << ") for" << levelCount << "entries", {});
+    #endif
+
+    /* Wrapping the user callback to check what the implementation delivers */
+    Image2DLevelsState wrapperState{callback, state, levelEnd};
+    if(!doImage2DLevels(id, levelBegin, levelEnd, [](const UnsignedInt level, ImageData2D&& image, void* const levelsState) {
+        Image2DLevelsState& data = *static_cast<Image2DLevelsState*>(levelsState);
+        CORRADE_ASSERT(level + 1 == data.nextLevel, "Trade::AbstractImporter::image2DLevels(): implementation delivered level" << level << "but expected" << data.nextLevel - 1, );
+        CORRADE_ASSERT(!image._data.deleter() || image._data.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || image._data.deleter() == ArrayAllocator<char>::deleter, "Trade::AbstractImporter::image2DLevels(): implementation is not allowed to use a custom Array deleter", );
+        --data.nextLevel;
+        data.callback(level, Utility::move(image), data.state);
+    }, &wrapperState))
+        return false;
+
+    CORRADE_ASSERT(wrapperState.nextLevel == levelBegin, "Trade::AbstractImporter::image2DLevels(): implementation delivered only levels down to" << wrapperState.nextLevel << "but expected" << levelBegin, {});
+    return true;
+}
+
+bool AbstractImporter::image2DLevels(const UnsignedInt id, void(*const callback)(UnsignedInt, ImageData2D&&, void*), void* const state) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image2DLevels(): no file opened", {});
+    CORRADE_ASSERT(id < doImage2DCount(), "Trade::AbstractImporter::image2DLevels(): index" << id << "out of range for" << doImage2DCount() << "entries", {});
+    return image2DLevels(id, 0, doImage2DLevelCount(id), callback, state);
+}
+
+bool AbstractImporter::doImage2DLevels(const UnsignedInt id, const UnsignedInt levelBegin, const UnsignedInt levelEnd, void(*const callback)(UnsignedInt, ImageData2D&&, void*), void* const state) {
+    /* Calling the implementation directly, the checks were done already */
+    for(UnsignedInt level = levelEnd; level-- > levelBegin; ) {
+        Containers::Optional<ImageData2D> image = doImage2D(id, level);
+        if(!image) return false;
+        callback(level, *Utility::move(image), state);
+    }
+
+    return true;
+}
+
 UnsignedInt AbstractImporter::image3DCount() const {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image3DCount(): no file opened", {});
     return doImage3DCount();
@@ -1630,6 +1796,7 @@ Debug& operator<<(Debug& debug, const ImporterFeature value) {
         _c(OpenData)
         _c(OpenState)
         _c(FileCallback)
+        _c(ConcurrentImport)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -1641,7 +1808,8 @@ Debug& operator<<(Debug& debug, const ImporterFeatures value) {
     return Containers::enumSetDebugOutput(debug, value, debug.immediateFlags() >= Debug::Flag::Packed ? "{}" : "Trade::ImporterFeatures{}", {
         ImporterFeature::OpenData,
         ImporterFeature::OpenState,
-        ImporterFeature::FileCallback});
+        ImporterFeature::FileCallback,
+        ImporterFeature::ConcurrentImport});
 }
 
 Debug& operator<<(Debug& debug, const ImporterFlag value) {
@@ -1652,6 +1820,7 @@ Debug& operator<<(Debug& debug, const ImporterFlag value) {
         #define _c(v) case ImporterFlag::v: return debug << "::" #v;
         _c(Quiet)
         _c(Verbose)
+        _c(ZeroCopy)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -1662,7 +1831,8 @@ Debug& operator<<(Debug& debug, const ImporterFlag value) {
 Debug& operator<<(Debug& debug, const ImporterFlags value) {
     return Containers::enumSetDebugOutput(debug, value, "Trade::ImporterFlags{}", {
         ImporterFlag::Quiet,
-        ImporterFlag::Verbose});
+        ImporterFlag::Verbose,
+        ImporterFlag::ZeroCopy});
 }
 
 }}
@@ -31,6 +31,7 @@
  */
 
 #include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/Pointer.h>
 #include <Corrade/PluginManager/AbstractManagingPlugin.h>
 #include <Corrade/Utility/StlForwardString.h> /** @todo remove once file callbacks are std::string-free */
 
@@ -73,7 +74,16 @@ enum class ImporterFeature: UnsignedByte {
      * See @ref Trade-AbstractImporter-usage-callbacks and particular importer
      * documentation for more information.
      */
-    FileCallback = 1 << 2
+    FileCallback = 1 << 2,
+
+    /**
+     * Data import functions can be called concurrently from multiple
+     * threads on a single opened file. See
+     * @ref Trade-AbstractImporter-usage-threads for details about what's
+     * allowed.
+     * @m_since_latest
+     */
+    ConcurrentImport = 1 << 3
 };
 
 /**
@@ -125,12 +135,33 @@ enum class ImporterFlag: UnsignedByte {
      */
     Verbose = 1 << 0,
 
+    /**
+     * Avoid copying the input data where possible. If set,
+     * @ref AbstractImporter::openFile() memory-maps the file instead of
+     * reading it into an allocated array and passes it to the
+     * implementation with @ref DataFlag::ExternallyOwned, same as
+     * @ref AbstractImporter::openMemory() does. Importers that are able to
+     * then return @ref ImageData, @ref MeshData and other data referencing
+     * the input directly instead of a copy, with
+     * @ref ImageData::dataFlags() "dataFlags()" not containing
+     * @ref DataFlag::Owned --- consult documentation of a particular plugin
+     * for details. Such data are valid only until the importer is
+     * destructed, @ref AbstractImporter::close() is called or another file is
+     * opened.
+     *
+     * Memory mapping is used only if the file isn't loaded through
+     * @ref AbstractImporter::setFileCallback() "file callbacks" and the
+     * platform supports it, otherwise the file is read into memory as usual.
+     * @m_since_latest
+     */
+    ZeroCopy = 1 << 2,
+
     /** @todo is warning as error (like in ShaderConverter) usable for anything
         here? in case of a compiler it makes sense, in case of an importer not
         so much probably? it'd also mean expanding each and every Warning
         print (using Error, adding a return) which is a lot to maintain */
 
-    /** @todo ~~Y flip~~ Y up for images, "I want to import just once, don't copy" ... */
+    /** @todo ~~Y flip~~ Y up for images ... */
 };
 
 /**
@@ -365,6 +396,32 @@ Besides exposing internal state, importers that support the
 state using @ref openState(). See documentation of a particular importer for
 details about concrete types returned and accepted by these functions.
 
+@subsection Trade-AbstractImporter-usage-threads Importing from multiple threads
+
+By default, an importer instance isn't thread-safe and all access to it has to
+be serialized. If the importer advertises @ref ImporterFeature::ConcurrentImport,
+once a file is opened, the following functions can be called concurrently from
+multiple threads, even for the same ID, which allows loading individual assets
+in parallel from a thread pool or a job queue in the application without
+having to open the file once per thread:
+
+-   @ref mesh(UnsignedInt, UnsignedInt) "mesh()", @ref meshCount(),
+    @ref meshLevelCount()
+-   @ref material(UnsignedInt) "material()", @ref materialCount()
+-   @ref image1D(UnsignedInt, UnsignedInt) "image1D()",
+    @ref image2D(UnsignedInt, UnsignedInt) "image2D()",
+    @ref image3D(UnsignedInt, UnsignedInt) "image3D()" and the corresponding
+    count and level count queries
+
+The @ref isOpened(), @ref features() and @ref flags() queries are safe to call
+concurrently with the above as well. Other functions --- in particular
+@ref openFile(), @ref close(), @ref setFlags() or
+@ref setFileCallback() --- must not be called while any of the above is in
+progress, and the import functions taking a name instead of an ID aren't
+covered by this guarantee either. Messages printed by the importer go to the
+@relativeref{Magnum,Debug}, @relativeref{Magnum,Warning} and
+@relativeref{Magnum,Error} output redirected on the calling thread.
+
 @section Trade-AbstractImporter-data-dependency Data dependency
 
 The `*Data` instances returned from various functions *by design* have no
@@ -386,6 +443,11 @@ file is kept open. If the file gets closed or the importer instance deleted,
 the state pointers become dangling, and that's fine as long as you don't access
 them.
 
+Another exception is when @ref ImporterFlag::ZeroCopy is enabled. Importers
+that support it may then return data referencing the memory-mapped file or the
+memory passed to @ref openMemory() with @ref DataFlag::Owned not set, and these
+are again valid only as long as the file is kept open.
+
 @section Trade-AbstractImporter-subclassing Subclassing
 
 The plugin needs to implement the @ref doFeatures(), @ref doIsOpened()
@@ -401,6 +463,12 @@ base file path to pass correct paths to subsequent file callbacks. The
 @ref doSetFileCallback() can be overridden in case it's desired to respond to
 file loading callback setup, but doesn't have to be.
 
+In order to support @ref ImporterFeature::ConcurrentImport, the data access
+functions listed in @ref Trade-AbstractImporter-usage-threads must not modify
+any importer state, or have to synchronize such access internally --- for
+example when lazily parsing and caching parts of the file. Importers that
+delegate to other plugins can advertise it only if all their delegates do.
+
 For multi-data formats the file opening shouldn't take long and all parsing
 should be done in the data parsing functions instead, because the user might
 want to import only some data. This is obviously not the case for single-data
@@ -501,10 +569,10 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
            header. */
         explicit AbstractImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
 
-        #if defined(MAGNUM_BUILD_DEPRECATED) && !defined(DOXYGEN_GENERATING_OUTPUT)
-        /* These twp needed because of the Array<CachedScenes> member
-           (AnyImageImporter relies on the move), move assignment disabled by
-           AbstractPlugin already */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        /* These two needed because of the Pointer<MappedFile> and
+           Pointer<CachedScenes> members (AnyImageImporter relies on the
+           move), move assignment disabled by AbstractPlugin already */
         AbstractImporter(AbstractImporter&&) noexcept;
         ~AbstractImporter();
         #endif
@@ -643,6 +711,55 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         template<class Callback, class T> void setFileCallback(Callback callback, T& userData);
         #endif
 
+        /**
+         * @brief Data allocator function
+         * @m_since_latest
+         *
+         * @see @ref setAllocator()
+         */
+        auto allocator() const -> void*(*)(std::size_t, std::size_t, void*) { return _allocator; }
+
+        /**
+         * @brief Data allocator user data
+         * @m_since_latest
+         *
+         * @see @ref setAllocator()
+         */
+        void* allocatorUserData() const { return _allocatorUserData; }
+
+        /**
+         * @brief Set data allocator
+         * @m_since_latest
+         *
+         * If set, importers that support it take memory for image pixel data
+         * and mesh vertex and index data from @p allocator instead of
+         * allocating it on the heap, which allows importing directly into an
+         * arena, a staging buffer or a persistently-mapped GPU buffer without
+         * an extra copy. The @p allocator gets called with the byte size, the
+         * required alignment and @p userData and is expected to return a
+         * suitably aligned pointer, or @cpp nullptr @ce if the memory can't
+         * be provided, in which case the import fails.
+         *
+         * The importer never frees memory returned by the allocator, not even
+         * if the import fails after the allocation, and data returned from
+         * @ref image2D(), @ref mesh() etc. then don't have
+         * @ref DataFlag::Owned set, only @ref DataFlag::Mutable. Managing
+         * lifetime of the memory is up to the caller. Importers that don't
+         * support custom allocators ignore this setting and return data
+         * owned by the usual means, check @ref ImageData::dataFlags() /
+         * @ref MeshData::vertexDataFlags() to distinguish the two cases. If
+         * the importer supports @ref ImporterFeature::ConcurrentImport and
+         * data are imported from multiple threads, the allocator has to be
+         * thread-safe as well.
+         *
+         * In case @p allocator is @cpp nullptr @ce, the current allocator (if
+         * any) is reset. Unlike @ref setFileCallback(), this function can be
+         * called also while a file is opened, the new allocator gets used by
+         * subsequent data import calls.
+         * @see @ref allocateData()
+         */
+        void setAllocator(void*(*allocator)(std::size_t size, std::size_t alignment, void* userData), void* userData = nullptr);
+
         /**
          * @brief Whether any file is opened
          *
@@ -1708,6 +1825,88 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         Containers::Optional<ImageData2D> image2D(Containers::StringView name, UnsignedInt level = 0);
 
+        /**
+         * @brief Two-dimensional image layout
+         * @param id        Image ID, from range [0, @ref image2DCount()).
+         * @param level     Mip level, from range [0, @ref image2DLevelCount())
+         * @m_since_latest
+         *
+         * Returns storage parameters, format, size and flags the image would
+         * have when imported with @ref image2D(UnsignedInt, UnsignedInt), but
+         * without the actual pixel data --- the returned view has a
+         * @cpp nullptr @ce data pointer. Together with
+         * @ref image2DInto() this allows the application to allocate memory
+         * for the image, for example a GPU staging buffer, and then decode
+         * the image directly into it. Importers that implement this function
+         * natively parse just the image header, otherwise the image is fully
+         * imported and then discarded. Compressed images are not supported.
+         *
+         * On failure prints a message to @relativeref{Magnum,Error} and
+         * returns @relativeref{Corrade,Containers::NullOpt}. Expects that a
+         * file is opened.
+         * @see @ref ImageView::dataSize()
+         */
+        Containers::Optional<ImageView2D> image2DLayout(UnsignedInt id, UnsignedInt level = 0);
+
+        /**
+         * @brief Import a two-dimensional image into existing memory
+         * @param id        Image ID, from range [0, @ref image2DCount()).
+         * @param image     Destination image
+         * @param level     Mip level, from range [0, @ref image2DLevelCount())
+         * @m_since_latest
+         *
+         * Expects that @p image has the format and size returned by
+         * @ref image2DLayout(), otherwise prints a message to
+         * @relativeref{Magnum,Error} and returns @cpp false @ce. The storage
+         * parameters can differ, pixels are then placed according to the
+         * storage of @p image. Importers that implement this function
+         * natively decode the pixels directly into @p image, otherwise the
+         * image is imported with @ref image2D(UnsignedInt, UnsignedInt) and
+         * then copied. Compressed images are not supported.
+         *
+         * On failure prints a message to @relativeref{Magnum,Error} and
+         * returns @cpp false @ce, contents of @p image are unspecified in that
+         * case. Expects that a file is opened.
+         */
+        bool image2DInto(UnsignedInt id, const MutableImageView2D& image, UnsignedInt level = 0);
+
+        /**
+         * @brief Stream a range of two-dimensional image levels
+         * @param id            Image ID, from range [0, @ref image2DCount()).
+         * @param levelBegin    First level to import
+         * @param levelEnd      One after the last level to import, at most
+         *      @ref image2DLevelCount()
+         * @param callback      Function called with each imported level
+         * @param state         State pointer passed to @p callback
+         * @m_since_latest
+         *
+         * Imports levels in range @f$ [ \mathrm{levelBegin}, \mathrm{levelEnd} ) @f$
+         * and passes each to @p callback as soon as it's available, going
+         * from the smallest level to the largest, i.e. from
+         * @cpp levelEnd - 1 @ce down to @p levelBegin. This allows for
+         * example a texture streamer to upload low-resolution levels first
+         * and populate the higher-resolution ones later. Importers that
+         * implement this function natively parse the file just once for all
+         * levels, otherwise each level is imported separately with
+         * @ref image2D(UnsignedInt, UnsignedInt).
+         *
+         * On failure prints a message to @relativeref{Magnum,Error} and
+         * returns @cpp false @ce. Levels passed to @p callback before the
+         * failure aren't affected. Expects that a file is opened and that
+         * @p levelBegin is less than @p levelEnd.
+         */
+        bool image2DLevels(UnsignedInt id, UnsignedInt levelBegin, UnsignedInt levelEnd, void(*callback)(UnsignedInt level, ImageData2D&& image, void* state), void* state = nullptr);
+
+        /**
+         * @brief Stream all two-dimensional image levels
+         * @m_since_latest
+         *
+         * Equivalent to calling @ref image2DLevels(UnsignedInt, UnsignedInt, UnsignedInt, void(*)(UnsignedInt, ImageData2D&&, void*), void*)
+         * with @p levelBegin set to @cpp 0 @ce and @p levelEnd set to
+         * @ref image2DLevelCount().
+         */
+        bool image2DLevels(UnsignedInt id, void(*callback)(UnsignedInt level, ImageData2D&& image, void* state), void* state = nullptr);
+
         /**
          * @brief Three-dimensional image count
          *
@@ -1801,7 +2000,25 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
 
     protected:
         /**
-         * @brief Implementation for @ref openFile()
+         * @brief Allocate memory for imported data
+         * @m_since_latest
+         *
+         * Meant to be used by implementations for pixel, vertex and index
+         * data returned to the user. If an allocator is set via
+         * @ref setAllocator(), takes @p size bytes aligned to @p alignment
+         * from it and returns them wrapped in an array with a non-owning
+         * deleter --- the implementation is then expected to return the data
+         * to the user through a non-owning @ref ImageData / @ref MeshData
+         * constructor with @ref DataFlag::Mutable. If the allocator fails,
+         * prints a message to @relativeref{Magnum,Error} and returns a
+         * @cpp nullptr @ce array. If no allocator is set, returns a
+         * @relativeref{Corrade,NoInit} heap-allocated array.
+         *
+         * In both cases the memory is uninitialized.
+         */
+        Containers::Array<char> allocateData(std::size_t size, std::size_t alignment);
+
+
          *
          * If @ref ImporterFeature::OpenData is supported, default
          * implementation opens the file and calls @ref doOpenData() with its
@@ -2579,6 +2796,40 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Implementation for @ref image2D() */
         virtual Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level);
 
+        /**
+         * @brief Implementation for @ref image2DLayout()
+         * @m_since_latest
+         *
+         * Default implementation calls @ref doImage2D() and returns the layout
+         * of the imported image. Implement to provide the layout without
+         * decoding the pixel data.
+         */
+        virtual Containers::Optional<ImageView2D> doImage2DLayout(UnsignedInt id, UnsignedInt level);
+
+        /**
+         * @brief Implementation for @ref image2DInto()
+         * @m_since_latest
+         *
+         * Default implementation calls @ref doImage2D(), checks that the
+         * format and size matches @p image and copies the pixels to it.
+         * Implement to decode the pixel data directly into @p image.
+         */
+        virtual bool doImage2DInto(UnsignedInt id, UnsignedInt level, const MutableImageView2D& image);
+
+        /**
+         * @brief Implementation for @ref image2DLevels()
+         * @m_since_latest
+         *
+         * The @p levelBegin and @p levelEnd range is guaranteed to be
+         * non-empty and in bounds. Default implementation calls
+         * @ref doImage2D() for each level from @cpp levelEnd - 1 @ce down to
+         * @p levelBegin and passes the result to @p callback, stopping at the
+         * first failure. Implement to parse the file just once for all
+         * levels. The implementation is expected to call @p callback exactly
+         * once for each level in the range, in the same order.
+         */
+        virtual bool doImage2DLevels(UnsignedInt id, UnsignedInt levelBegin, UnsignedInt levelEnd, void(*callback)(UnsignedInt level, ImageData2D&& image, void* state), void* state);
+
         /**
          * @brief Implementation for @ref image3DCount()
          *
@@ -2623,6 +2874,9 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         Containers::Optional<Containers::ArrayView<const char>>(*_fileCallback)(const std::string&, InputFileCallbackPolicy, void*){};
         void* _fileCallbackUserData{};
 
+        void*(*_allocator)(std::size_t, std::size_t, void*){};
+        void* _allocatorUserData{};
+
         /* Used by the templated version only */
         struct FileCallbackTemplate {
             void(*callback)();
@@ -2630,6 +2884,11 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /* GCC 4.8 complains loudly about missing initializers otherwise */
         } _fileCallbackTemplate{nullptr, nullptr};
 
+        /* Memory-mapped file opened with ImporterFlag::ZeroCopy, released in
+           close() */
+        struct MappedFile;
+        Containers::Pointer<MappedFile> _mappedFile;
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         struct CachedScenes;
         Containers::Pointer<CachedScenes> _cachedScenes;
@@ -2655,7 +2914,7 @@ updated interface string.
 */
 /* Silly indentation to make the string appear in pluginInterface() docs */
 #define MAGNUM_TRADE_ABSTRACTIMPORTER_PLUGIN_INTERFACE /* [interface] */ \
-"cz.mosra.magnum.Trade.AbstractImporter/0.5.2"
+"cz.mosra.magnum.Trade.AbstractImporter/0.5.6"
 /* [interface] */
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
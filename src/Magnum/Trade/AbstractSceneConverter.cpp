@@ -29,11 +29,15 @@
 #include <Corrade/Containers/AnyReference.h>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Iterable.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/ScopeGuard.h>
 #include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringIterable.h>
 #include <Corrade/PluginManager/Manager.hpp>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/MurmurHash2.h>
 #include <Corrade/Utility/Path.h>
 
 #include "Magnum/ImageView.h"
@@ -151,7 +155,8 @@ struct AbstractSceneConverter::State {
     enum class Type {
         Convert,
         ConvertToData,
-        ConvertToFile
+        ConvertToFile,
+        UpdateFile
     };
 
     explicit State(Type type): type{type} {
@@ -159,7 +164,7 @@ struct AbstractSceneConverter::State {
             new(&converted.mesh) Containers::Optional<MeshData>{};
         else if(type == Type::ConvertToData)
             new(&converted.meshToData) Containers::Optional<Containers::Array<char>>{};
-        else if(type == Type::ConvertToFile)
+        else if(type == Type::ConvertToFile || type == Type::UpdateFile)
             new(&converted.meshToFile) bool{};
         else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
     }
@@ -169,7 +174,7 @@ struct AbstractSceneConverter::State {
             converted.mesh.~Optional();
         else if(type == Type::ConvertToData)
             converted.meshToData.~Optional();
-        else if(type == Type::ConvertToFile)
+        else if(type == Type::ConvertToFile || type == Type::UpdateFile)
             ;
         else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
     }
@@ -189,9 +194,19 @@ struct AbstractSceneConverter::State {
     UnsignedInt image2DCount = 0;
     UnsignedInt image3DCount = 0;
 
-    /* Used if type == Type::ConvertToFile. Could theoretically be in the same
-       allocation as State (ArrayTuple?), or at least reusing the space in
-       `converted`, but I don't think a single allocation matters that much. */
+    /* Content hashes of added meshes and materials, indexed by their IDs.
+       Recorded only if SceneConverterFeature::UpdateFile is supported, in
+       which case they're used by update() for change detection. For
+       type == Type::UpdateFile they're filled only if the hashes of the file
+       being updated are known, as indicated by hashesKnown. */
+    Containers::Array<std::size_t> meshHashes;
+    Containers::Array<std::size_t> materialHashes;
+    bool hashesKnown = false;
+
+    /* Used if type == Type::ConvertToFile or Type::UpdateFile. Could
+       theoretically be in the same allocation as State (ArrayTuple?), or at
+       least reusing the space in `converted`, but I don't think a single
+       allocation matters that much. */
     Containers::String filename;
 
     union Converted {
@@ -207,6 +222,92 @@ struct AbstractSceneConverter::State {
     } converted;
 };
 
+/* Content hashes of meshes and materials of the file written last, kept
+   across conversions to make change detection in update() possible. */
+struct AbstractSceneConverter::ContentHashes {
+    Containers::String filename;
+    Containers::Array<std::size_t> meshes;
+    Containers::Array<std::size_t> materials;
+};
+
+namespace {
+
+std::size_t hashBytes(const void* data, const std::size_t size) {
+    return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2{}(static_cast<const char*>(data), size).byteArray());
+}
+
+void hashCombine(std::size_t& seed, const std::size_t value) {
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+/* Used only for detecting changes, not for deduplication, so the whole index
+   and vertex buffers are hashed together with the layout. A change in bytes
+   that aren't referenced by any attribute is thus treated as a change as
+   well, which is harmless. */
+std::size_t meshContentHash(const MeshData& mesh) {
+    std::size_t seed = hashBytes(mesh.vertexData().data(), mesh.vertexData().size());
+    hashCombine(seed, std::size_t(mesh.primitive()));
+    hashCombine(seed, mesh.vertexCount());
+    if(mesh.isIndexed()) {
+        hashCombine(seed, hashBytes(mesh.indexData().data(), mesh.indexData().size()));
+        hashCombine(seed, std::size_t(mesh.indexType()));
+        hashCombine(seed, mesh.indexOffset());
+        hashCombine(seed, std::size_t(mesh.indexStride()));
+        hashCombine(seed, mesh.indexCount());
+    }
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        hashCombine(seed, std::size_t(mesh.attributeName(i)));
+        hashCombine(seed, std::size_t(mesh.attributeFormat(i)));
+        hashCombine(seed, mesh.attributeOffset(i));
+        hashCombine(seed, std::size_t(mesh.attributeStride(i)));
+        hashCombine(seed, mesh.attributeArraySize(i));
+        hashCombine(seed, std::size_t(mesh.attributeMorphTargetId(i)));
+    }
+    return seed;
+}
+
+std::size_t meshContentHash(const Containers::Iterable<const MeshData>& meshLevels) {
+    std::size_t seed = meshLevels.size();
+    for(const MeshData& mesh: meshLevels)
+        hashCombine(seed, meshContentHash(mesh));
+    return seed;
+}
+
+/* Unlike in MaterialTools::removeDuplicatesInPlace(), floating-point values
+   are hashed exactly as well, as any change in them should be detected */
+std::size_t materialContentHash(const MaterialData& material) {
+    std::size_t seed = std::size_t(UnsignedInt(material.types()));
+
+    const Containers::ArrayView<const UnsignedInt> layerData = material.layerData();
+    hashCombine(seed, hashBytes(layerData.data(), layerData.size()*sizeof(UnsignedInt)));
+
+    for(const MaterialAttributeData& attribute: material.attributeData()) {
+        const Containers::StringView name = attribute.name();
+        hashCombine(seed, hashBytes(name.data(), name.size()));
+        hashCombine(seed, std::size_t(attribute.type()));
+
+        if(attribute.type() == MaterialAttributeType::String) {
+            const Containers::StringView value = attribute.value<Containers::StringView>();
+            hashCombine(seed, hashBytes(value.data(), value.size()));
+        } else if(attribute.type() == MaterialAttributeType::Buffer) {
+            const Containers::ArrayView<const void> value = attribute.value<Containers::ArrayView<const void>>();
+            hashCombine(seed, hashBytes(value.data(), value.size()));
+        } else {
+            hashCombine(seed, hashBytes(attribute.value(), materialAttributeTypeSize(attribute.type())));
+        }
+    }
+
+    return seed;
+}
+
+Containers::Array<std::size_t> copyHashes(const Containers::ArrayView<const std::size_t> hashes) {
+    Containers::Array<std::size_t> out{NoInit, hashes.size()};
+    Utility::copy(hashes, out);
+    return out;
+}
+
+}
+
 Containers::StringView AbstractSceneConverter::pluginInterface() {
     return MAGNUM_TRADE_ABSTRACTSCENECONVERTER_PLUGIN_INTERFACE ""_s;
 }
@@ -263,6 +364,11 @@ void AbstractSceneConverter::clearFlags(SceneConverterFlags flags) {
     setFlags(_flags & ~flags);
 }
 
+void AbstractSceneConverter::setParallelFor(const ParallelFor parallelFor, void* const state) {
+    _parallelFor = parallelFor;
+    _parallelForState = state;
+}
+
 Containers::Optional<MeshData> AbstractSceneConverter::convert(const MeshData& mesh) {
     abort();
 
@@ -554,15 +660,33 @@ bool AbstractSceneConverter::doBeginFile(Containers::StringView) {
 }
 
 bool AbstractSceneConverter::endFile() {
-    CORRADE_ASSERT(_state && _state->type == State::Type::ConvertToFile,
+    CORRADE_ASSERT(_state && (_state->type == State::Type::ConvertToFile || _state->type == State::Type::UpdateFile),
         "Trade::AbstractSceneConverter::endFile(): no file conversion in progress", {});
 
     Containers::ScopeGuard deleteState{this, [](AbstractSceneConverter* self) {
         self->_state = {};
     }};
 
+    if(_state->type == State::Type::UpdateFile) {
+        const bool out = doEndUpdateFile(_state->filename);
+        /* Remember the hashes only if they were known for the whole file,
+           otherwise the file contents are unknown */
+        if(out && _state->hashesKnown)
+            updateContentHashes();
+        else
+            _contentHashes = nullptr;
+        return out;
+    }
+
     if(features() >= SceneConverterFeature::ConvertMultipleToFile) {
-        return doEndFile(_state->filename);
+        const bool out = doEndFile(_state->filename);
+        if(features() & SceneConverterFeature::UpdateFile) {
+            if(out)
+                updateContentHashes();
+            else
+                _contentHashes = nullptr;
+        }
+        return out;
 
     } else if(features() & SceneConverterFeature::ConvertMeshToFile) {
         if(_state->meshCount != 1) {
@@ -591,6 +715,99 @@ bool AbstractSceneConverter::doEndFile(const Containers::StringView filename) {
     return true;
 }
 
+void AbstractSceneConverter::updateContentHashes() {
+    if(!_contentHashes)
+        _contentHashes.emplace();
+    _contentHashes->filename = Utility::move(_state->filename);
+    _contentHashes->meshes = Utility::move(_state->meshHashes);
+    _contentHashes->materials = Utility::move(_state->materialHashes);
+}
+
+bool AbstractSceneConverter::beginUpdateFile(const Containers::StringView filename) {
+    CORRADE_ASSERT(features() & SceneConverterFeature::UpdateFile,
+        "Trade::AbstractSceneConverter::beginUpdateFile(): feature not supported", {});
+
+    abort();
+
+    _state.emplace(State::Type::UpdateFile);
+    _state->filename = Containers::String::nullTerminatedGlobalView(filename);
+
+    /* If the file is the one written last, take over its hashes. They're
+       copied and not moved, as an aborted update leaves the file intact. */
+    if(_contentHashes && _contentHashes->filename == _state->filename) {
+        _state->meshHashes = copyHashes(_contentHashes->meshes);
+        _state->materialHashes = copyHashes(_contentHashes->materials);
+        _state->meshCount = UnsignedInt(_state->meshHashes.size());
+        _state->materialCount = UnsignedInt(_state->materialHashes.size());
+        _state->hashesKnown = true;
+    }
+
+    if(!doBeginUpdateFile(_state->filename)) {
+        _state = {};
+        return false;
+    }
+
+    return true;
+}
+
+bool AbstractSceneConverter::doBeginUpdateFile(Containers::StringView) {
+    CORRADE_ASSERT_UNREACHABLE("Trade::AbstractSceneConverter::beginUpdateFile(): feature advertised but not implemented", {});
+}
+
+bool AbstractSceneConverter::doEndUpdateFile(Containers::StringView) {
+    CORRADE_ASSERT_UNREACHABLE("Trade::AbstractSceneConverter::endFile(): update advertised but not implemented", {});
+}
+
+bool AbstractSceneConverter::update(const UnsignedInt id, const MeshData& mesh) {
+    CORRADE_ASSERT(features() >= (SceneConverterFeature::UpdateFile|SceneConverterFeature::AddMeshes),
+        "Trade::AbstractSceneConverter::update(): mesh update not supported", {});
+    CORRADE_ASSERT(_state && _state->type == State::Type::UpdateFile,
+        "Trade::AbstractSceneConverter::update(): no update in progress", {});
+    CORRADE_ASSERT(!_state->hashesKnown || id < _state->meshCount,
+        "Trade::AbstractSceneConverter::update(): index" << id << "out of range for" << _state->meshCount << "meshes", {});
+
+    /* Without known hashes the implementation is responsible for checking
+       the ID and everything is passed through */
+    if(!_state->hashesKnown)
+        return doUpdate(id, mesh);
+
+    const std::size_t hash = meshContentHash(mesh);
+    if(_state->meshHashes[id] == hash)
+        return true;
+    if(!doUpdate(id, mesh))
+        return false;
+    _state->meshHashes[id] = hash;
+    return true;
+}
+
+bool AbstractSceneConverter::doUpdate(UnsignedInt, const MeshData&) {
+    CORRADE_ASSERT_UNREACHABLE("Trade::AbstractSceneConverter::update(): mesh update advertised but not implemented", {});
+}
+
+bool AbstractSceneConverter::update(const UnsignedInt id, const MaterialData& material) {
+    CORRADE_ASSERT(features() >= (SceneConverterFeature::UpdateFile|SceneConverterFeature::AddMaterials),
+        "Trade::AbstractSceneConverter::update(): material update not supported", {});
+    CORRADE_ASSERT(_state && _state->type == State::Type::UpdateFile,
+        "Trade::AbstractSceneConverter::update(): no update in progress", {});
+    CORRADE_ASSERT(!_state->hashesKnown || id < _state->materialCount,
+        "Trade::AbstractSceneConverter::update(): index" << id << "out of range for" << _state->materialCount << "materials", {});
+
+    if(!_state->hashesKnown)
+        return doUpdate(id, material);
+
+    const std::size_t hash = materialContentHash(material);
+    if(_state->materialHashes[id] == hash)
+        return true;
+    if(!doUpdate(id, material))
+        return false;
+    _state->materialHashes[id] = hash;
+    return true;
+}
+
+bool AbstractSceneConverter::doUpdate(UnsignedInt, const MaterialData&) {
+    CORRADE_ASSERT_UNREACHABLE("Trade::AbstractSceneConverter::update(): material update advertised but not implemented", {});
+}
+
 UnsignedInt AbstractSceneConverter::sceneCount() const {
     CORRADE_ASSERT(_state, "Trade::AbstractSceneConverter::sceneCount(): no conversion in progress", {});
     return _state->sceneCount;
@@ -796,6 +1013,8 @@ Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const MeshData& me
 
     if(features() >= SceneConverterFeature::AddMeshes) {
         if(!doAdd(_state->meshCount, mesh, name)) return {};
+        if(_state->type == State::Type::ConvertToFile && features() & SceneConverterFeature::UpdateFile)
+            arrayAppend(_state->meshHashes, meshContentHash(mesh));
 
     } else if(features() & (SceneConverterFeature::ConvertMesh|
                             SceneConverterFeature::ConvertMeshToData|
@@ -842,9 +1061,10 @@ Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const Containers::
     CORRADE_ASSERT(!meshLevels.isEmpty(),
         "Trade::AbstractSceneConverter::add(): at least one mesh level has to be specified", false);
 
-    if(doAdd(_state->meshCount, meshLevels, name))
-        return _state->meshCount++;
-    return {};
+    if(!doAdd(_state->meshCount, meshLevels, name)) return {};
+    if(_state->type == State::Type::ConvertToFile && features() & SceneConverterFeature::UpdateFile)
+        arrayAppend(_state->meshHashes, meshContentHash(meshLevels));
+    return _state->meshCount++;
 }
 
 Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const Containers::Iterable<const MeshData>& meshLevels) {
@@ -855,6 +1075,41 @@ bool AbstractSceneConverter::doAdd(UnsignedInt, const Containers::Iterable<const
     CORRADE_ASSERT_UNREACHABLE("Trade::AbstractSceneConverter::add(): multi-level mesh conversion advertised but not implemented", {});
 }
 
+Containers::Optional<UnsignedInt> AbstractSceneConverter::addMeshes(const Containers::Iterable<const MeshData>& meshes, const Containers::StringIterable& names) {
+    CORRADE_ASSERT(_state,
+        "Trade::AbstractSceneConverter::addMeshes(): no conversion in progress", {});
+    CORRADE_ASSERT(names.isEmpty() || names.size() == meshes.size(),
+        "Trade::AbstractSceneConverter::addMeshes(): expected either no or" << meshes.size() << "names but got" << names.size(), {});
+
+    const UnsignedInt id = _state->meshCount;
+
+    /* If the converter can't take the whole batch, delegate to add() one by
+       one, which also takes care of the single-mesh conversion proxies */
+    if(!(features() >= (SceneConverterFeature::AddMeshes|SceneConverterFeature::ConcurrentAdd))) {
+        for(std::size_t i = 0; i != meshes.size(); ++i)
+            if(!add(meshes[i], names.isEmpty() ? Containers::StringView{} : names[i]))
+                return {};
+        return id;
+    }
+
+    if(meshes.isEmpty()) return id;
+
+    if(!doAddMeshes(id, meshes, names)) return {};
+    if(_state->type == State::Type::ConvertToFile && features() & SceneConverterFeature::UpdateFile)
+        for(const MeshData& mesh: meshes)
+            arrayAppend(_state->meshHashes, meshContentHash(mesh));
+    _state->meshCount += meshes.size();
+    return id;
+}
+
+Containers::Optional<UnsignedInt> AbstractSceneConverter::addMeshes(const Containers::Iterable<const MeshData>& meshes) {
+    return addMeshes(meshes, {});
+}
+
+bool AbstractSceneConverter::doAddMeshes(UnsignedInt, const Containers::Iterable<const MeshData>&, const Containers::StringIterable&) {
+    CORRADE_ASSERT_UNREACHABLE("Trade::AbstractSceneConverter::addMeshes(): concurrent mesh conversion advertised but not implemented", {});
+}
+
 void AbstractSceneConverter::setMeshAttributeName(const MeshAttribute attribute, const Containers::StringView name) {
     CORRADE_ASSERT(features() & (SceneConverterFeature::AddMeshes|
                                  SceneConverterFeature::ConvertMesh|
@@ -888,9 +1143,10 @@ Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const MaterialData
     CORRADE_ASSERT(_state,
         "Trade::AbstractSceneConverter::add(): no conversion in progress", {});
 
-    if(doAdd(_state->materialCount, material, name))
-        return _state->materialCount++;
-    return {};
+    if(!doAdd(_state->materialCount, material, name)) return {};
+    if(_state->type == State::Type::ConvertToFile && features() & SceneConverterFeature::UpdateFile)
+        arrayAppend(_state->materialHashes, materialContentHash(material));
+    return _state->materialCount++;
 }
 
 Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const MaterialData& material) {
@@ -1092,6 +1348,49 @@ Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const Containers::
     return add(imageLevels, {});
 }
 
+Containers::Optional<UnsignedInt> AbstractSceneConverter::addImages(const Containers::Iterable<const ImageData1D>& images, const Containers::StringIterable& names) {
+    CORRADE_ASSERT(_state,
+        "Trade::AbstractSceneConverter::addImages(): no conversion in progress", {});
+    CORRADE_ASSERT(names.isEmpty() || names.size() == images.size(),
+        "Trade::AbstractSceneConverter::addImages(): expected either no or" << images.size() << "names but got" << names.size(), {});
+
+    const UnsignedInt id = _state->image1DCount;
+
+    /* If the converter can't take the whole batch, delegate to add() one by
+       one */
+    if(!(features() & SceneConverterFeature::ConcurrentAdd)) {
+        for(std::size_t i = 0; i != images.size(); ++i)
+            if(!add(images[i], names.isEmpty() ? Containers::StringView{} : names[i]))
+                return {};
+        return id;
+    }
+
+    if(images.isEmpty()) return id;
+
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != images.size(); ++i) {
+        CORRADE_ASSERT(features() & (images[i].isCompressed() ? SceneConverterFeature::AddCompressedImages1D : SceneConverterFeature::AddImages1D),
+            "Trade::AbstractSceneConverter::addImages():" << (images[i].isCompressed() ? "compressed 1D" : "1D") << "image conversion not supported", {});
+        /* Explicitly return if checks fail for CORRADE_GRACEFUL_ASSERT
+           builds */
+        if(!checkImageValidity("Trade::AbstractSceneConverter::addImages():", images[i]))
+            return {};
+    }
+    #endif
+
+    if(!doAddImages(id, images, names)) return {};
+    _state->image1DCount += images.size();
+    return id;
+}
+
+Containers::Optional<UnsignedInt> AbstractSceneConverter::addImages(const Containers::Iterable<const ImageData1D>& images) {
+    return addImages(images, {});
+}
+
+bool AbstractSceneConverter::doAddImages(UnsignedInt, const Containers::Iterable<const ImageData1D>&, const Containers::StringIterable&) {
+    CORRADE_ASSERT_UNREACHABLE("Trade::AbstractSceneConverter::addImages(): concurrent 1D image conversion advertised but not implemented", {});
+}
+
 UnsignedInt AbstractSceneConverter::image2DCount() const {
     CORRADE_ASSERT(_state, "Trade::AbstractSceneConverter::image2DCount(): no conversion in progress", {});
     return _state->image2DCount;
@@ -1193,6 +1492,49 @@ Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const Containers::
     return add(imageLevels, {});
 }
 
+Containers::Optional<UnsignedInt> AbstractSceneConverter::addImages(const Containers::Iterable<const ImageData2D>& images, const Containers::StringIterable& names) {
+    CORRADE_ASSERT(_state,
+        "Trade::AbstractSceneConverter::addImages(): no conversion in progress", {});
+    CORRADE_ASSERT(names.isEmpty() || names.size() == images.size(),
+        "Trade::AbstractSceneConverter::addImages(): expected either no or" << images.size() << "names but got" << names.size(), {});
+
+    const UnsignedInt id = _state->image2DCount;
+
+    /* If the converter can't take the whole batch, delegate to add() one by
+       one */
+    if(!(features() & SceneConverterFeature::ConcurrentAdd)) {
+        for(std::size_t i = 0; i != images.size(); ++i)
+            if(!add(images[i], names.isEmpty() ? Containers::StringView{} : names[i]))
+                return {};
+        return id;
+    }
+
+    if(images.isEmpty()) return id;
+
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != images.size(); ++i) {
+        CORRADE_ASSERT(features() & (images[i].isCompressed() ? SceneConverterFeature::AddCompressedImages2D : SceneConverterFeature::AddImages2D),
+            "Trade::AbstractSceneConverter::addImages():" << (images[i].isCompressed() ? "compressed 2D" : "2D") << "image conversion not supported", {});
+        /* Explicitly return if checks fail for CORRADE_GRACEFUL_ASSERT
+           builds */
+        if(!checkImageValidity("Trade::AbstractSceneConverter::addImages():", images[i]))
+            return {};
+    }
+    #endif
+
+    if(!doAddImages(id, images, names)) return {};
+    _state->image2DCount += images.size();
+    return id;
+}
+
+Containers::Optional<UnsignedInt> AbstractSceneConverter::addImages(const Containers::Iterable<const ImageData2D>& images) {
+    return addImages(images, {});
+}
+
+bool AbstractSceneConverter::doAddImages(UnsignedInt, const Containers::Iterable<const ImageData2D>&, const Containers::StringIterable&) {
+    CORRADE_ASSERT_UNREACHABLE("Trade::AbstractSceneConverter::addImages(): concurrent 2D image conversion advertised but not implemented", {});
+}
+
 UnsignedInt AbstractSceneConverter::image3DCount() const {
     CORRADE_ASSERT(_state, "Trade::AbstractSceneConverter::image3DCount(): no conversion in progress", {});
     return _state->image3DCount;
@@ -1294,6 +1636,49 @@ Containers::Optional<UnsignedInt> AbstractSceneConverter::add(const Containers::
     return add(imageLevels, {});
 }
 
+Containers::Optional<UnsignedInt> AbstractSceneConverter::addImages(const Containers::Iterable<const ImageData3D>& images, const Containers::StringIterable& names) {
+    CORRADE_ASSERT(_state,
+        "Trade::AbstractSceneConverter::addImages(): no conversion in progress", {});
+    CORRADE_ASSERT(names.isEmpty() || names.size() == images.size(),
+        "Trade::AbstractSceneConverter::addImages(): expected either no or" << images.size() << "names but got" << names.size(), {});
+
+    const UnsignedInt id = _state->image3DCount;
+
+    /* If the converter can't take the whole batch, delegate to add() one by
+       one */
+    if(!(features() & SceneConverterFeature::ConcurrentAdd)) {
+        for(std::size_t i = 0; i != images.size(); ++i)
+            if(!add(images[i], names.isEmpty() ? Containers::StringView{} : names[i]))
+                return {};
+        return id;
+    }
+
+    if(images.isEmpty()) return id;
+
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != images.size(); ++i) {
+        CORRADE_ASSERT(features() & (images[i].isCompressed() ? SceneConverterFeature::AddCompressedImages3D : SceneConverterFeature::AddImages3D),
+            "Trade::AbstractSceneConverter::addImages():" << (images[i].isCompressed() ? "compressed 3D" : "3D") << "image conversion not supported", {});
+        /* Explicitly return if checks fail for CORRADE_GRACEFUL_ASSERT
+           builds */
+        if(!checkImageValidity("Trade::AbstractSceneConverter::addImages():", images[i]))
+            return {};
+    }
+    #endif
+
+    if(!doAddImages(id, images, names)) return {};
+    _state->image3DCount += images.size();
+    return id;
+}
+
+Containers::Optional<UnsignedInt> AbstractSceneConverter::addImages(const Containers::Iterable<const ImageData3D>& images) {
+    return addImages(images, {});
+}
+
+bool AbstractSceneConverter::doAddImages(UnsignedInt, const Containers::Iterable<const ImageData3D>&, const Containers::StringIterable&) {
+    CORRADE_ASSERT_UNREACHABLE("Trade::AbstractSceneConverter::addImages(): concurrent 3D image conversion advertised but not implemented", {});
+}
+
 bool AbstractSceneConverter::addImporterContentsInternal(AbstractImporter& importer, const SceneContents contents, const bool noLevelsIfUnsupported) {
     CORRADE_ASSERT(isConverting(),
         "Trade::AbstractSceneConverter::addImporterContents(): no conversion in progress", {});
@@ -1749,6 +2134,8 @@ Debug& operator<<(Debug& debug, const SceneConverterFeature value) {
         _c(AddCompressedImages3D)
         _c(MeshLevels)
         _c(ImageLevels)
+        _c(ConcurrentAdd)
+        _c(UpdateFile)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -1783,7 +2170,9 @@ Debug& operator<<(Debug& debug, const SceneConverterFeatures value) {
         SceneConverterFeature::AddCompressedImages2D,
         SceneConverterFeature::AddCompressedImages3D,
         SceneConverterFeature::MeshLevels,
-        SceneConverterFeature::ImageLevels});
+        SceneConverterFeature::ImageLevels,
+        SceneConverterFeature::ConcurrentAdd,
+        SceneConverterFeature::UpdateFile});
 }
 
 Debug& operator<<(Debug& debug, const SceneConverterFlag value) {
@@ -35,6 +35,7 @@
 #include <Corrade/PluginManager/AbstractManagingPlugin.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Trade/Parallel.h"
 #include "Magnum/Trade/Trade.h"
 #include "Magnum/Trade/visibility.h"
 
@@ -262,7 +263,34 @@ enum class SceneConverterFeature: UnsignedInt {
      * supported.
      * @m_since_latest
      */
-    ImageLevels = 1 << 23
+    ImageLevels = 1 << 23,
+
+    /**
+     * Add multiple meshes or images at once with
+     * @ref AbstractSceneConverter::addMeshes() and
+     * @relativeref{AbstractSceneConverter,addImages()}, processing them
+     * concurrently using the executor passed to
+     * @ref AbstractSceneConverter::setParallelFor(). Implies that at least
+     * one of @ref SceneConverterFeature::AddMeshes,
+     * @relativeref{SceneConverterFeature,AddImages1D},
+     * @relativeref{SceneConverterFeature,AddImages2D},
+     * @relativeref{SceneConverterFeature,AddImages3D} or their compressed
+     * variants is supported as well.
+     * @m_since_latest
+     */
+    ConcurrentAdd = 1 << 24,
+
+    /**
+     * Update meshes and materials in a file written by a previous
+     * conversion with @ref AbstractSceneConverter::beginUpdateFile(),
+     * @relativeref{AbstractSceneConverter,update()} and
+     * @relativeref{AbstractSceneConverter,endFile()}, rewriting only the
+     * parts that changed. Updating meshes additionally requires
+     * @ref SceneConverterFeature::AddMeshes and updating materials
+     * @ref SceneConverterFeature::AddMaterials to be supported.
+     * @m_since_latest
+     */
+    UpdateFile = 1 << 25
 };
 
 /**
@@ -699,6 +727,23 @@ duplicates from all meshes before saving them to the output:
 
 @snippet Trade.cpp AbstractSceneConverter-usage-multiple-file-selective
 
+@subsection Trade-AbstractSceneConverter-usage-update Updating a file incrementally
+
+If the converter supports @ref SceneConverterFeature::UpdateFile, a file
+written by @ref beginFile() and @ref endFile() can be updated in place instead
+of being regenerated completely, which is useful for example in an editor
+hot-reload loop. The update is started with @ref beginUpdateFile(), changed
+meshes and materials are passed to @ref update() and the changes are written
+with @ref endFile():
+
+@snippet Trade.cpp AbstractSceneConverter-usage-update
+
+The converter instance remembers content hashes of meshes and materials in
+the file it wrote last. When updating the same file again, data that are the
+same as what's already in the file are skipped without calling into the
+plugin, so it's possible to pass everything to @ref update() and let the
+converter pick only what changed.
+
 <b></b>
 
 @m_class{m-note m-success}
@@ -781,6 +826,20 @@ checked by the implementation:
     Since file formats have varying requirements on image level sizes and their
     order and some don't impose any requirements at all, the plugin
     implementation is expected to check the sizes on its own.
+-   The @ref doBeginUpdateFile(), @ref doUpdate() and @ref doEndUpdateFile()
+    functions are called only if @ref SceneConverterFeature::UpdateFile is
+    supported, @ref doUpdate() additionally only if
+    @ref SceneConverterFeature::AddMeshes or
+    @relativeref{SceneConverterFeature,AddMaterials} is supported for given
+    data type and only if the data differ from what the converter wrote or
+    updated last in the same file, if that's known.
+-   The @ref doAddMeshes() and @ref doAddImages() functions are called only
+    if @ref SceneConverterFeature::ConcurrentAdd is supported, the list is
+    not empty, the names are either empty or have the same size as the list
+    and all images satisfy the same requirements as in the single-image
+    @ref doAdd() functions. Converters that don't implement them can still
+    be used through @ref addMeshes() and @ref addImages(), which then
+    delegate to @ref doAdd() for each item serially.
 
 For user convenience it's possible to use a single-mesh converter through the
 multi-mesh interface as well as use a multi-mesh converter through the
@@ -907,6 +966,37 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
          */
         void clearFlags(SceneConverterFlags flags);
 
+        /**
+         * @brief Parallel loop executor
+         * @m_since_latest
+         *
+         * @see @ref parallelForState(), @ref setParallelFor()
+         */
+        ParallelFor parallelFor() const { return _parallelFor; }
+
+        /**
+         * @brief Parallel loop executor state
+         * @m_since_latest
+         *
+         * @see @ref parallelFor(), @ref setParallelFor()
+         */
+        void* parallelForState() const { return _parallelForState; }
+
+        /**
+         * @brief Set parallel loop executor
+         * @m_since_latest
+         *
+         * The executor is used by converters that support
+         * @ref SceneConverterFeature::ConcurrentAdd to process meshes and
+         * images passed to @ref addMeshes() and @ref addImages() in parallel.
+         * The @p state is passed to @p parallelFor on every call. By default
+         * no executor is set, in which case the batches are processed serially
+         * on the calling thread. Can be called at any time, including in the
+         * middle of a conversion, but not concurrently with any other
+         * function on the same converter instance.
+         */
+        void setParallelFor(ParallelFor parallelFor, void* state = nullptr);
+
         /**
          * @brief Convert a mesh
          *
@@ -1140,9 +1230,73 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
          * delegated to @ref convertToFile(const MeshData&, Containers::StringView).
          * If no mesh was added, prints a message to @relativeref{Magnum,Error}
          * and returns @cpp false @ce.
+         *
+         * If @ref beginUpdateFile() was called before, finishes the update
+         * instead. In both cases, if @ref SceneConverterFeature::UpdateFile
+         * is supported and the operation succeeds, content hashes of all
+         * meshes and materials in the file are remembered for change
+         * detection in a subsequent @ref update().
          */
         bool endFile();
 
+        /**
+         * @brief Begin updating a file written by a previous conversion
+         * @m_since_latest
+         *
+         * Expects that @ref SceneConverterFeature::UpdateFile is supported.
+         * If a conversion is currently in progress, calls @ref abort() first.
+         * Meshes and materials in the file can be then replaced using
+         * @ref update(), the changes are written upon calling
+         * @ref endFile(). On failure, such as when the file doesn't exist or
+         * wasn't produced by this converter, prints a message to
+         * @relativeref{Magnum,Error} and returns @cpp false @ce.
+         *
+         * If @p filename is the same as in the last successful
+         * @ref beginFile() or @ref beginUpdateFile() on this instance, the
+         * content hashes of data in the file are known, @ref meshCount() and
+         * @ref materialCount() report the counts of data in the file and
+         * @ref update() skips data that didn't change. Otherwise both counts
+         * are @cpp 0 @ce and all data passed to @ref update() are passed to
+         * the implementation.
+         * @see @ref isConverting(), @ref features()
+         */
+        bool beginUpdateFile(Containers::StringView filename);
+
+        /**
+         * @brief Update a mesh in a file
+         * @m_since_latest
+         *
+         * Expects that @ref SceneConverterFeature::UpdateFile together with
+         * @relativeref{SceneConverterFeature,AddMeshes} is supported and
+         * @ref beginUpdateFile() was called before. If the content hashes of
+         * the file are known, expects that @p id is less than
+         * @ref meshCount() and if @p mesh is the same as the mesh already in
+         * the file, returns @cpp true @ce without doing anything. Otherwise
+         * replaces the mesh. On failure prints a message to
+         * @relativeref{Magnum,Error} and returns @cpp false @ce.
+         *
+         * The change detection is done by hashing the index and vertex data
+         * together with the mesh layout, so any change in the data or the
+         * layout is detected, including changes in data not referenced by
+         * any attribute.
+         */
+        bool update(UnsignedInt id, const MeshData& mesh);
+
+        /**
+         * @brief Update a material in a file
+         * @m_since_latest
+         *
+         * Expects that @ref SceneConverterFeature::UpdateFile together with
+         * @relativeref{SceneConverterFeature,AddMaterials} is supported and
+         * @ref beginUpdateFile() was called before. If the content hashes of
+         * the file are known, expects that @p id is less than
+         * @ref materialCount() and if @p material is the same as the
+         * material already in the file, returns @cpp true @ce without doing
+         * anything. Otherwise replaces the material. On failure prints a
+         * message to @relativeref{Magnum,Error} and returns @cpp false @ce.
+         */
+        bool update(UnsignedInt id, const MaterialData& material);
+
         /**
          * @brief Count of added scenes
          * @m_since_latest
@@ -1512,6 +1666,39 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
         Containers::Optional<UnsignedInt> add(const Containers::Iterable<const MeshData>& meshLevels);
         #endif
 
+        /**
+         * @brief Add multiple meshes at once
+         * @m_since_latest
+         *
+         * Expects that a conversion is currently in progress and that
+         * @p names is either empty or has the same size as @p meshes. The
+         * returned ID is implicitly equal to @ref meshCount() before calling
+         * this function, the meshes get consecutive IDs starting from it.
+         *
+         * If @ref SceneConverterFeature::ConcurrentAdd together with
+         * @relativeref{SceneConverterFeature,AddMeshes} is supported, the
+         * whole batch is passed to the converter at once, which processes it
+         * in parallel using the executor set with @ref setParallelFor(). On
+         * failure prints a message to @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt} --- the count of added
+         * meshes doesn't change in that case.
+         *
+         * Otherwise the function is equivalent to calling
+         * @ref add(const MeshData&, Containers::StringView) for each mesh in
+         * order. If adding any of them fails, returns
+         * @relativeref{Corrade,Containers::NullOpt} and meshes preceding the
+         * failed one stay added, which is reflected in @ref meshCount().
+         *
+         * If the converter doesn't support mesh naming, @p names are ignored.
+         * @see @ref isConverting(), @ref features()
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        Containers::Optional<UnsignedInt> addMeshes(const Containers::Iterable<const MeshData>& meshes, const Containers::StringIterable& names = {});
+        #else
+        Containers::Optional<UnsignedInt> addMeshes(const Containers::Iterable<const MeshData>& meshes, const Containers::StringIterable& names);
+        Containers::Optional<UnsignedInt> addMeshes(const Containers::Iterable<const MeshData>& meshes);
+        #endif
+
         /**
          * @brief Set name of a custom mesh attribute
          * @m_since_latest
@@ -1755,6 +1942,44 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
         Containers::Optional<UnsignedInt> add(const Containers::Iterable<const CompressedImageView1D>& imageLevels);
         #endif
 
+        /**
+         * @brief Add multiple 1D images at once
+         * @m_since_latest
+         *
+         * Expects that a conversion is currently in progress and that
+         * @p names is either empty or has the same size as @p images. The
+         * returned ID is implicitly equal to @ref image1DCount() before
+         * calling this function, the images get consecutive IDs starting from
+         * it.
+         *
+         * If @ref SceneConverterFeature::ConcurrentAdd is supported, expects
+         * that @ref SceneConverterFeature::AddImages1D or
+         * @relativeref{SceneConverterFeature,AddCompressedImages1D} is
+         * supported based on whether each image is compressed, and that the
+         * images satisfy the same requirements as in
+         * @ref add(const ImageData1D&, Containers::StringView). The whole
+         * batch is then passed to the converter at once, which processes it
+         * in parallel using the executor set with @ref setParallelFor(). On
+         * failure prints a message to @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt} --- the count of added
+         * images doesn't change in that case.
+         *
+         * Otherwise the function is equivalent to calling
+         * @ref add(const ImageData1D&, Containers::StringView) for each
+         * image in order. If adding any of them fails, returns
+         * @relativeref{Corrade,Containers::NullOpt} and images preceding the
+         * failed one stay added, which is reflected in @ref image1DCount().
+         *
+         * If the converter doesn't support image naming, @p names are ignored.
+         * @see @ref isConverting(), @ref features()
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        Containers::Optional<UnsignedInt> addImages(const Containers::Iterable<const ImageData1D>& images, const Containers::StringIterable& names = {});
+        #else
+        Containers::Optional<UnsignedInt> addImages(const Containers::Iterable<const ImageData1D>& images, const Containers::StringIterable& names);
+        Containers::Optional<UnsignedInt> addImages(const Containers::Iterable<const ImageData1D>& images);
+        #endif
+
         /**
          * @brief Count of added 2D images
          * @m_since_latest
@@ -1887,6 +2112,44 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
         Containers::Optional<UnsignedInt> add(const Containers::Iterable<const CompressedImageView2D>& imageLevels);
         #endif
 
+        /**
+         * @brief Add multiple 2D images at once
+         * @m_since_latest
+         *
+         * Expects that a conversion is currently in progress and that
+         * @p names is either empty or has the same size as @p images. The
+         * returned ID is implicitly equal to @ref image2DCount() before
+         * calling this function, the images get consecutive IDs starting from
+         * it.
+         *
+         * If @ref SceneConverterFeature::ConcurrentAdd is supported, expects
+         * that @ref SceneConverterFeature::AddImages2D or
+         * @relativeref{SceneConverterFeature,AddCompressedImages2D} is
+         * supported based on whether each image is compressed, and that the
+         * images satisfy the same requirements as in
+         * @ref add(const ImageData2D&, Containers::StringView). The whole
+         * batch is then passed to the converter at once, which processes it
+         * in parallel using the executor set with @ref setParallelFor(). On
+         * failure prints a message to @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt} --- the count of added
+         * images doesn't change in that case.
+         *
+         * Otherwise the function is equivalent to calling
+         * @ref add(const ImageData2D&, Containers::StringView) for each
+         * image in order. If adding any of them fails, returns
+         * @relativeref{Corrade,Containers::NullOpt} and images preceding the
+         * failed one stay added, which is reflected in @ref image2DCount().
+         *
+         * If the converter doesn't support image naming, @p names are ignored.
+         * @see @ref isConverting(), @ref features()
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        Containers::Optional<UnsignedInt> addImages(const Containers::Iterable<const ImageData2D>& images, const Containers::StringIterable& names = {});
+        #else
+        Containers::Optional<UnsignedInt> addImages(const Containers::Iterable<const ImageData2D>& images, const Containers::StringIterable& names);
+        Containers::Optional<UnsignedInt> addImages(const Containers::Iterable<const ImageData2D>& images);
+        #endif
+
         /**
          * @brief Count of added 3D images
          * @m_since_latest
@@ -2019,6 +2282,44 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
         Containers::Optional<UnsignedInt> add(const Containers::Iterable<const CompressedImageView3D>& imageLevels);
         #endif
 
+        /**
+         * @brief Add multiple 3D images at once
+         * @m_since_latest
+         *
+         * Expects that a conversion is currently in progress and that
+         * @p names is either empty or has the same size as @p images. The
+         * returned ID is implicitly equal to @ref image3DCount() before
+         * calling this function, the images get consecutive IDs starting from
+         * it.
+         *
+         * If @ref SceneConverterFeature::ConcurrentAdd is supported, expects
+         * that @ref SceneConverterFeature::AddImages3D or
+         * @relativeref{SceneConverterFeature,AddCompressedImages3D} is
+         * supported based on whether each image is compressed, and that the
+         * images satisfy the same requirements as in
+         * @ref add(const ImageData3D&, Containers::StringView). The whole
+         * batch is then passed to the converter at once, which processes it
+         * in parallel using the executor set with @ref setParallelFor(). On
+         * failure prints a message to @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt} --- the count of added
+         * images doesn't change in that case.
+         *
+         * Otherwise the function is equivalent to calling
+         * @ref add(const ImageData3D&, Containers::StringView) for each
+         * image in order. If adding any of them fails, returns
+         * @relativeref{Corrade,Containers::NullOpt} and images preceding the
+         * failed one stay added, which is reflected in @ref image3DCount().
+         *
+         * If the converter doesn't support image naming, @p names are ignored.
+         * @see @ref isConverting(), @ref features()
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        Containers::Optional<UnsignedInt> addImages(const Containers::Iterable<const ImageData3D>& images, const Containers::StringIterable& names = {});
+        #else
+        Containers::Optional<UnsignedInt> addImages(const Containers::Iterable<const ImageData3D>& images, const Containers::StringIterable& names);
+        Containers::Optional<UnsignedInt> addImages(const Containers::Iterable<const ImageData3D>& images);
+        #endif
+
         /**
          * @brief Add importer contents
          * @m_since_latest
@@ -2146,6 +2447,7 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
 
     private:
         struct State;
+        struct ContentHashes;
 
         /**
          * @brief Implementation for @ref features()
@@ -2351,6 +2653,26 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
          */
         virtual bool doAdd(UnsignedInt id, const Containers::Iterable<const MeshData>& meshLevels, Containers::StringView name);
 
+        /**
+         * @brief Implementation for @ref addMeshes()
+         * @m_since_latest
+         *
+         * Called only if @ref SceneConverterFeature::ConcurrentAdd together
+         * with @relativeref{SceneConverterFeature,AddMeshes} is supported.
+         * The @p id is equal to @ref meshCount() at the time this function
+         * is called, the meshes are expected to get consecutive IDs starting
+         * from it. The @p names are either empty or have the same size as
+         * @p meshes, and @p meshes is never empty.
+         *
+         * If @ref parallelFor() is not @cpp nullptr @ce, the implementation
+         * is expected to dispatch the processing of individual meshes to it,
+         * passing @ref parallelForState() as the first argument, and do the
+         * processing serially on the calling thread otherwise. If any of
+         * the meshes fails to be processed, the implementation is expected to
+         * discard the whole batch and return @cpp false @ce.
+         */
+        virtual bool doAddMeshes(UnsignedInt id, const Containers::Iterable<const MeshData>& meshes, const Containers::StringIterable& names);
+
         /**
          * @brief Implementation for @ref setMeshAttributeName()
          * @m_since_latest
@@ -2406,6 +2728,21 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
          */
         virtual bool doAdd(UnsignedInt id, const Containers::Iterable<const ImageData1D>& imageLevels, Containers::StringView name);
 
+        /**
+         * @brief Implementation for @ref addImages(const Containers::Iterable<const ImageData1D>&, const Containers::StringIterable&)
+         * @m_since_latest
+         *
+         * Called only if @ref SceneConverterFeature::ConcurrentAdd is
+         * supported. The @p id is equal to @ref image1DCount() at the time
+         * this function is called, the images are expected to get consecutive
+         * IDs starting from it. The @p names are either empty or have the
+         * same size as @p images, and @p images is never empty.
+         *
+         * Is expected to dispatch the work to @ref parallelFor() and report
+         * failures the same way as @ref doAddMeshes().
+         */
+        virtual bool doAddImages(UnsignedInt id, const Containers::Iterable<const ImageData1D>& images, const Containers::StringIterable& names);
+
         /**
          * @brief Implementation for @ref add(const ImageData2D&, Containers::StringView)
          * @m_since_latest
@@ -2434,6 +2771,21 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
          */
         virtual bool doAdd(UnsignedInt id, const Containers::Iterable<const ImageData2D>& imageLevels, Containers::StringView name);
 
+        /**
+         * @brief Implementation for @ref addImages(const Containers::Iterable<const ImageData2D>&, const Containers::StringIterable&)
+         * @m_since_latest
+         *
+         * Called only if @ref SceneConverterFeature::ConcurrentAdd is
+         * supported. The @p id is equal to @ref image2DCount() at the time
+         * this function is called, the images are expected to get consecutive
+         * IDs starting from it. The @p names are either empty or have the
+         * same size as @p images, and @p images is never empty.
+         *
+         * Is expected to dispatch the work to @ref parallelFor() and report
+         * failures the same way as @ref doAddMeshes().
+         */
+        virtual bool doAddImages(UnsignedInt id, const Containers::Iterable<const ImageData2D>& images, const Containers::StringIterable& names);
+
         /**
          * @brief Implementation for @ref add(const ImageData3D&, Containers::StringView)
          * @m_since_latest
@@ -2462,11 +2814,74 @@ class MAGNUM_TRADE_EXPORT AbstractSceneConverter: public PluginManager::Abstract
          */
         virtual bool doAdd(UnsignedInt id, const Containers::Iterable<const ImageData3D>& imageLevels, Containers::StringView name);
 
+        /**
+         * @brief Implementation for @ref addImages(const Containers::Iterable<const ImageData3D>&, const Containers::StringIterable&)
+         * @m_since_latest
+         *
+         * Called only if @ref SceneConverterFeature::ConcurrentAdd is
+         * supported. The @p id is equal to @ref image3DCount() at the time
+         * this function is called, the images are expected to get consecutive
+         * IDs starting from it. The @p names are either empty or have the
+         * same size as @p images, and @p images is never empty.
+         *
+         * Is expected to dispatch the work to @ref parallelFor() and report
+         * failures the same way as @ref doAddMeshes().
+         */
+        virtual bool doAddImages(UnsignedInt id, const Containers::Iterable<const ImageData3D>& images, const Containers::StringIterable& names);
+
+        /**
+         * @brief Implementation for @ref beginUpdateFile()
+         * @m_since_latest
+         *
+         * Expected to open the existing file for an update and fail if it
+         * can't be updated. The @p filename string is guaranteed to stay in
+         * scope until a call to @ref doEndUpdateFile(), with the same
+         * guarantees as in @ref doBeginFile().
+         */
+        virtual bool doBeginUpdateFile(Containers::StringView filename);
+
+        /**
+         * @brief Implementation for @ref update(UnsignedInt, const MeshData&)
+         * @m_since_latest
+         *
+         * Called only if the content hashes of the file are not known or the
+         * mesh differs from the one in the file. If the hashes aren't known,
+         * the implementation is expected to check that @p id is in range on
+         * its own.
+         */
+        virtual bool doUpdate(UnsignedInt id, const MeshData& mesh);
+
+        /**
+         * @brief Implementation for @ref update(UnsignedInt, const MaterialData&)
+         * @m_since_latest
+         *
+         * Called with the same guarantees as
+         * @ref doUpdate(UnsignedInt, const MeshData&).
+         */
+        virtual bool doUpdate(UnsignedInt id, const MaterialData& material);
+
+        /**
+         * @brief Implementation for @ref endFile() after @ref beginUpdateFile()
+         * @m_since_latest
+         *
+         * Receives the same @p filename as was passed to
+         * @ref doBeginUpdateFile() earlier. Expected to write the updated
+         * data and reset the internal state for a potential new conversion to
+         * happen.
+         */
+        virtual bool doEndUpdateFile(Containers::StringView filename);
+
         /* Called from addImporterContents() and addSupportedImporterContents() */
         MAGNUM_TRADE_LOCAL bool addImporterContentsInternal(AbstractImporter& importer, SceneContents contents, bool noLevelsIfUnsupported);
 
+        /* Called from endFile() */
+        MAGNUM_TRADE_LOCAL void updateContentHashes();
+
         SceneConverterFlags _flags;
+        ParallelFor _parallelFor{};
+        void* _parallelForState{};
         Containers::Pointer<State> _state;
+        Containers::Pointer<ContentHashes> _contentHashes;
 };
 
 /**
@@ -2487,7 +2902,7 @@ updated interface string.
 */
 /* Silly indentation to make the string appear in pluginInterface() docs */
 #define MAGNUM_TRADE_ABSTRACTSCENECONVERTER_PLUGIN_INTERFACE /* [interface] */ \
-"cz.mosra.magnum.Trade.AbstractSceneConverter/0.2.2"
+"cz.mosra.magnum.Trade.AbstractSceneConverter/0.2.4"
 /* [interface] */
 
 }}
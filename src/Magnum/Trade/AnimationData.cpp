@@ -26,11 +26,16 @@
 
 #include "AnimationData.h"
 
+#include <cstring>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Debug.h>
 
 #include "Magnum/Math/Vector4.h"
 #include "Magnum/Math/Quaternion.h"
+#include "Magnum/Animation/PackedQuaternion.h"
 #include "Magnum/Trade/Implementation/arrayUtilities.h"
+#include "Magnum/Trade/Implementation/dataChunk.h"
 
 namespace Magnum { namespace Trade {
 
@@ -67,6 +72,7 @@ Debug& operator<<(Debug& debug, const AnimationTrackType value) {
         _c(CubicHermite3D)
         _c(CubicHermiteComplex)
         _c(CubicHermiteQuaternion)
+        _c(PackedQuaternion)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -89,6 +95,8 @@ UnsignedInt animationTrackTypeSize(const AnimationTrackType type) {
         case AnimationTrackType::UnsignedInt:
         case AnimationTrackType::Int:
             return 4;
+        case AnimationTrackType::PackedQuaternion:
+            return 6;
         case AnimationTrackType::Vector2:
         case AnimationTrackType::Vector2ui:
         case AnimationTrackType::Vector2i:
@@ -132,6 +140,8 @@ UnsignedInt animationTrackTypeAlignment(const AnimationTrackType type) {
         case AnimationTrackType::BitVector3:
         case AnimationTrackType::BitVector4:
             return 1;
+        case AnimationTrackType::PackedQuaternion:
+            return 2;
         case AnimationTrackType::Float:
         case AnimationTrackType::UnsignedInt:
         case AnimationTrackType::Int:
@@ -240,6 +250,11 @@ auto animationInterpolatorFor(const Animation::Interpolation interpolation, cons
         _cr(CubicHermiteQuaternion, Quaternion)
         #undef _cr
         /* LCOV_EXCL_STOP */
+
+        case AnimationTrackType::PackedQuaternion:
+            if(resultType == AnimationTrackType::Quaternion)
+                return reinterpret_cast<void(*)()>(Trade::animationInterpolatorFor<Animation::PackedQuaternion, Quaternion>(interpolation));
+            break;
     }
 
     /** @todo this doesn't print the types when e.g. a spline interpolation is
@@ -371,6 +386,218 @@ Containers::Array<char> AnimationData::release() {
     return Utility::move(_data);
 }
 
+namespace {
+
+/* Followed by the track list and the keyframe data at the offsets stored in
+   the header. Offsets are relative to the chunk start. */
+struct AnimationDataChunkHeader: DataChunkHeader {
+    Range1D duration;
+    UnsignedInt trackCount;
+    /* 4 bytes padding on 64-bit */
+    std::size_t dataOffset;
+    std::size_t dataSize;
+};
+
+static_assert(sizeof(AnimationDataChunkHeader) % 8 == 0, "improper animation chunk header padding");
+
+/* AnimationTrackData contains pointers, so it's stored in this form instead.
+   Key and value offsets are relative to the data start, the interpolator
+   function is resolved from the interpolation on deserialization. */
+struct AnimationTrackDataChunk {
+    AnimationTrackType type, resultType;
+    AnimationTrackTarget targetName;
+    Animation::Interpolation interpolation;
+    Animation::Extrapolation before, after;
+    /* 1 byte padding */
+    UnsignedLong target;
+    UnsignedInt size;
+    Short keysStride;
+    Short valuesStride;
+    std::size_t keysOffset;
+    std::size_t valuesOffset;
+};
+
+static_assert(sizeof(AnimationTrackDataChunk) % 8 == 0, "improper animation track chunk padding");
+
+#ifndef CORRADE_NO_ASSERT
+/* Whether size items of itemSize bytes starting at begin and separated by
+   stride are all inside data */
+bool isTrackViewContained(const void* const begin, const UnsignedInt size, const Short stride, const std::size_t itemSize, const Containers::ArrayView<const char> data) {
+    if(!size) return true;
+    const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(begin);
+    const std::uintptr_t span = std::size_t(size - 1)*(stride < 0 ? -stride : stride);
+    const std::uintptr_t min = stride < 0 ? first - span : first;
+    const std::uintptr_t max = (stride < 0 ? first : first + span) + itemSize;
+    return min >= reinterpret_cast<std::uintptr_t>(data.begin()) &&
+        max <= reinterpret_cast<std::uintptr_t>(data.end());
+}
+#endif
+
+/* The cases handled by animationInterpolatorFor() above, checked upfront to
+   fail gracefully on deserialization instead of asserting there */
+bool isAnimationTrackInterpolationValid(const AnimationTrackType type, const AnimationTrackType resultType, const Animation::Interpolation interpolation) {
+    AnimationTrackType expectedResultType = type;
+    bool spline = false;
+    switch(type) {
+        case AnimationTrackType::CubicHermite1D:
+            expectedResultType = AnimationTrackType::Float;
+            spline = true;
+            break;
+        case AnimationTrackType::CubicHermite2D:
+            expectedResultType = AnimationTrackType::Vector2;
+            spline = true;
+            break;
+        case AnimationTrackType::CubicHermite3D:
+            expectedResultType = AnimationTrackType::Vector3;
+            spline = true;
+            break;
+        case AnimationTrackType::CubicHermiteComplex:
+            expectedResultType = AnimationTrackType::Complex;
+            spline = true;
+            break;
+        case AnimationTrackType::CubicHermiteQuaternion:
+            expectedResultType = AnimationTrackType::Quaternion;
+            spline = true;
+            break;
+        case AnimationTrackType::PackedQuaternion:
+            expectedResultType = AnimationTrackType::Quaternion;
+            break;
+        default:
+            break;
+    }
+
+    return resultType == expectedResultType &&
+        (interpolation == Animation::Interpolation::Constant ||
+         interpolation == Animation::Interpolation::Linear ||
+         (spline && interpolation == Animation::Interpolation::Spline));
+}
+
+}
+
+std::size_t AnimationData::serializedSize() const {
+    return sizeof(AnimationDataChunkHeader) +
+        _tracks.size()*sizeof(AnimationTrackDataChunk) +
+        Implementation::dataChunkAlign(_data.size());
+}
+
+std::size_t AnimationData::serializeInto(const Containers::ArrayView<char> out) const {
+    const std::size_t size = serializedSize();
+    CORRADE_ASSERT(reinterpret_cast<std::uintptr_t>(out.data()) % 8 == 0,
+        "Trade::AnimationData::serializeInto(): data not aligned to 8 bytes", {});
+    CORRADE_ASSERT(out.size() == size,
+        "Trade::AnimationData::serializeInto(): expected a view of" << size << "bytes but got" << out.size(), {});
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != _tracks.size(); ++i) {
+        const AnimationTrackData& track = _tracks[i];
+        CORRADE_ASSERT(track._interpolation != Animation::Interpolation::Custom,
+            "Trade::AnimationData::serializeInto(): can't serialize a custom interpolator of track" << i, {});
+        CORRADE_ASSERT(
+            isTrackViewContained(track._keysData, track._size, track._keysStride, sizeof(Float), _data) &&
+            isTrackViewContained(track._valuesData, track._size, track._valuesStride, animationTrackTypeSize(track._type), _data),
+            "Trade::AnimationData::serializeInto(): keys or values of track" << i << "are not contained in the data", {});
+    }
+    #endif
+
+    /* Zero-initialize the header and the track list first so the padding is
+       deterministic */
+    const std::size_t dataOffset = sizeof(AnimationDataChunkHeader) + _tracks.size()*sizeof(AnimationTrackDataChunk);
+    std::memset(out.data(), 0, dataOffset);
+    AnimationDataChunkHeader& header = *reinterpret_cast<AnimationDataChunkHeader*>(out.data());
+    Implementation::dataChunkHeaderSerializeInto(header, DataChunkType::Animation, 0, size);
+    header.duration = _duration;
+    header.trackCount = _tracks.size();
+    header.dataOffset = dataOffset;
+    header.dataSize = _data.size();
+
+    AnimationTrackDataChunk* const tracks = reinterpret_cast<AnimationTrackDataChunk*>(out.data() + sizeof(AnimationDataChunkHeader));
+    for(std::size_t i = 0; i != _tracks.size(); ++i) {
+        const AnimationTrackData& in = _tracks[i];
+        AnimationTrackDataChunk& track = tracks[i];
+        track.type = in._type;
+        track.resultType = in._resultType;
+        track.targetName = in._targetName;
+        track.interpolation = in._interpolation;
+        track.before = in._before;
+        track.after = in._after;
+        track.target = in._target;
+        track.size = in._size;
+        track.keysStride = in._keysStride;
+        track.valuesStride = in._valuesStride;
+        /* Empty views can have arbitrary pointers, store a zero offset for
+           those */
+        if(in._size) {
+            track.keysOffset = static_cast<const char*>(in._keysData) - _data.data();
+            track.valuesOffset = static_cast<const char*>(in._valuesData) - _data.data();
+        }
+    }
+
+    Utility::copy(_data, out.sliceSize(dataOffset, _data.size()));
+    std::memset(out.data() + dataOffset + _data.size(), 0, size - dataOffset - _data.size());
+
+    return size;
+}
+
+Containers::Array<char> AnimationData::serialize() const {
+    /* NoInit arrays are allocated with new[], which is guaranteed to be
+       aligned for any fundamental type */
+    Containers::Array<char> out{NoInit, serializedSize()};
+    serializeInto(out);
+    return out;
+}
+
+Containers::Optional<AnimationData> AnimationData::deserialize(const Containers::ArrayView<const void> data, const DataFlags dataFlags) {
+    CORRADE_ASSERT(!(dataFlags & DataFlag::Owned),
+        "Trade::AnimationData::deserialize(): can't reference non-owned data but got" << dataFlags, {});
+
+    const char* const messagePrefix = "Trade::AnimationData::deserialize():";
+    const AnimationDataChunkHeader* const header = Implementation::dataChunkDeserialize<AnimationDataChunkHeader>(data, DataChunkType::Animation, 0, messagePrefix);
+    if(!header) return {};
+
+    if(!Implementation::dataChunkCheckArrayRange(*header, sizeof(AnimationDataChunkHeader), header->trackCount, sizeof(AnimationTrackDataChunk), "track data", messagePrefix) ||
+       !Implementation::dataChunkCheckRange(*header, header->dataOffset, header->dataSize, "animation data", messagePrefix))
+        return {};
+
+    const char* const chunk = static_cast<const char*>(data.data());
+    const Containers::ArrayView<const char> animationData{chunk + header->dataOffset, header->dataSize};
+    const Containers::ArrayView<const AnimationTrackDataChunk> trackChunks{reinterpret_cast<const AnimationTrackDataChunk*>(chunk + sizeof(AnimationDataChunkHeader)), header->trackCount};
+
+    /* The AnimationTrackData constructor would only assert on the checks
+       below, which isn't desirable for data coming from a file */
+    Containers::Array<AnimationTrackData> tracks{header->trackCount};
+    for(std::size_t i = 0; i != trackChunks.size(); ++i) {
+        const AnimationTrackDataChunk& track = trackChunks[i];
+        if(track.type == AnimationTrackType{} || UnsignedByte(track.type) > UnsignedByte(AnimationTrackType::PackedQuaternion)) {
+            Error{} << messagePrefix << "invalid type" << track.type << "of track" << i;
+            return {};
+        }
+        if(!isAnimationTrackInterpolationValid(track.type, track.resultType, track.interpolation)) {
+            Error{} << messagePrefix << "invalid result type" << track.resultType << "or interpolation" << track.interpolation << "for" << track.type << "of track" << i;
+            return {};
+        }
+        if(UnsignedByte(track.before) > UnsignedByte(Animation::Extrapolation::DefaultConstructed) ||
+           UnsignedByte(track.after) > UnsignedByte(Animation::Extrapolation::DefaultConstructed)) {
+            Error{} << messagePrefix << "invalid extrapolation" << track.before << Debug::nospace << "," << track.after << "of track" << i;
+            return {};
+        }
+        if(!Implementation::dataChunkCheckStridedRange(header->dataSize, track.keysOffset, track.size, track.keysStride, sizeof(Float))) {
+            Error{} << messagePrefix << track.size << "keys of track" << i << "with a stride of" << track.keysStride << "at offset" << track.keysOffset << "out of range for" << header->dataSize << "bytes of animation data";
+            return {};
+        }
+        if(!Implementation::dataChunkCheckStridedRange(header->dataSize, track.valuesOffset, track.size, track.valuesStride, animationTrackTypeSize(track.type))) {
+            Error{} << messagePrefix << track.size << "values of track" << i << "with a stride of" << track.valuesStride << "at offset" << track.valuesOffset << "out of range for" << header->dataSize << "bytes of animation data";
+            return {};
+        }
+
+        tracks[i] = AnimationTrackData{track.targetName, track.target,
+            track.type, track.resultType,
+            Containers::StridedArrayView1D<const Float>{animationData, reinterpret_cast<const Float*>(animationData.data() + (track.size ? track.keysOffset : 0)), track.size, track.keysStride},
+            Containers::StridedArrayView1D<const void>{animationData, animationData.data() + (track.size ? track.valuesOffset : 0), track.size, track.valuesStride},
+            track.interpolation, track.before, track.after};
+    }
+
+    return AnimationData{dataFlags, animationData, Utility::move(tracks), header->duration};
+}
+
 template<class V, class R> auto animationInterpolatorFor(Animation::Interpolation interpolation) -> R(*)(const V&, const V&, Float) {
     return Animation::interpolatorFor<V, R>(interpolation);
 }
@@ -399,5 +626,6 @@ template MAGNUM_TRADE_EXPORT auto animationInterpolatorFor<CubicHermite2D, Math:
 template MAGNUM_TRADE_EXPORT auto animationInterpolatorFor<CubicHermite3D, Math::Vector3<Float>>(Animation::Interpolation) -> Math::Vector3<Float>(*)(const CubicHermite3D&, const CubicHermite3D&, Float);
 template MAGNUM_TRADE_EXPORT auto animationInterpolatorFor<CubicHermiteComplex, Complex>(Animation::Interpolation) -> Complex(*)(const CubicHermiteComplex&, const CubicHermiteComplex&, Float);
 template MAGNUM_TRADE_EXPORT auto animationInterpolatorFor<CubicHermiteQuaternion, Quaternion>(Animation::Interpolation) -> Quaternion(*)(const CubicHermiteQuaternion&, const CubicHermiteQuaternion&, Float);
+template MAGNUM_TRADE_EXPORT auto animationInterpolatorFor<Animation::PackedQuaternion, Quaternion>(Animation::Interpolation) -> Quaternion(*)(const Animation::PackedQuaternion&, const Animation::PackedQuaternion&, Float);
 
 }}
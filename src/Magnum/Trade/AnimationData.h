@@ -163,7 +163,15 @@ enum class AnimationTrackType: UnsignedByte {
      * @ref Magnum::CubicHermiteQuaternion "CubicHermiteQuaternion". Usually
      * used for spline-interpolated @ref AnimationTrackTarget::Rotation3D.
      */
-    CubicHermiteQuaternion
+    CubicHermiteQuaternion,
+
+    /**
+     * @ref Animation::PackedQuaternion, interpolated to a
+     * @ref AnimationTrackType::Quaternion. Usually used for memory-efficient
+     * @ref AnimationTrackTarget::Rotation3D.
+     * @m_since_latest
+     */
+    PackedQuaternion
 };
 
 /** @debugoperatorenum{AnimationTrackType} */
@@ -992,6 +1000,68 @@ class MAGNUM_TRADE_EXPORT AnimationData {
          */
         Containers::Array<char> release();
 
+        /**
+         * @brief Size of the serialized animation
+         * @m_since_latest
+         *
+         * Size of the data chunk produced by @ref serialize() and
+         * @ref serializeInto(), including the @ref DataChunkHeader. Always a
+         * multiple of 8 bytes.
+         */
+        std::size_t serializedSize() const;
+
+        /**
+         * @brief Serialize the animation into an existing memory
+         * @m_since_latest
+         *
+         * Expects that @p out is 8-byte aligned and exactly
+         * @ref serializedSize() bytes large, that keys and values of all
+         * tracks are contained in @ref data() and that no track uses
+         * @ref Animation::Interpolation::Custom. The data are copied as-is,
+         * tracks are stored with offsets relative to the data and only the
+         * @ref Animation::Interpolation value, as interpolator function
+         * pointers can't be serialized. Returns @ref serializedSize(). The
+         * @ref importerState() isn't serialized.
+         * @see @ref deserialize(), @ref DataChunkType::Animation
+         */
+        std::size_t serializeInto(Containers::ArrayView<char> out) const;
+
+        /**
+         * @brief Serialize the animation
+         * @m_since_latest
+         *
+         * Allocates an array of @ref serializedSize() bytes and calls
+         * @ref serializeInto() on it.
+         */
+        Containers::Array<char> serialize() const;
+
+        /**
+         * @brief Deserialize an animation
+         * @m_since_latest
+         *
+         * Expects that @p data is 8-byte aligned and starts with a valid
+         * @ref DataChunkType::Animation chunk produced by @ref serialize() on
+         * a platform with a matching @ref DataChunkSignature. Data past
+         * @ref DataChunkHeader::size are ignored. On failure prints a message
+         * to @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt}.
+         *
+         * Keyframe data aren't copied --- the returned instance references
+         * them in @p data, which is thus expected to stay in scope for as
+         * long as the instance is used, and @ref dataFlags() are set to
+         * @p dataFlags. Only the track list is allocated, with key and value
+         * offsets converted to pointers and interpolator functions resolved
+         * from the stored @ref Animation::Interpolation via
+         * @ref animationInterpolatorFor(). Track types, interpolation and
+         * extrapolation values and the ranges of all keys and values are
+         * validated so a corrupted chunk results in an error instead of an
+         * assertion or an out-of-bounds access. The keyframe values
+         * themselves are not validated.
+         *
+         * The @p dataFlags are expected to not contain @ref DataFlag::Owned.
+         */
+        static Containers::Optional<AnimationData> deserialize(Containers::ArrayView<const void> data, DataFlags dataFlags = {});
+
         /**
          * @brief Importer-specific state
          *
@@ -1068,6 +1138,7 @@ namespace Implementation {
     template<> constexpr AnimationTrackType animationTypeFor<CubicHermite3D>() { return AnimationTrackType::CubicHermite3D; }
     template<> constexpr AnimationTrackType animationTypeFor<CubicHermiteComplex>() { return AnimationTrackType::CubicHermiteComplex; }
     template<> constexpr AnimationTrackType animationTypeFor<CubicHermiteQuaternion>() { return AnimationTrackType::CubicHermiteQuaternion; }
+    template<> constexpr AnimationTrackType animationTypeFor<Animation::PackedQuaternion>() { return AnimationTrackType::PackedQuaternion; }
     /* LCOV_EXCL_STOP */
 }
 
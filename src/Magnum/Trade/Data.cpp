@@ -26,6 +26,7 @@
 
 #include "Data.h"
 
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/EnumSet.hpp>
 
 namespace Magnum { namespace Trade {
@@ -58,6 +59,103 @@ Debug& operator<<(Debug& debug, const DataFlags value) {
         DataFlag::Mutable});
 }
 
+Debug& operator<<(Debug& debug, const DataChunkSignature value) {
+    const bool packed = debug.immediateFlags() >= Debug::Flag::Packed;
+
+    if(!packed)
+        debug << "Trade::DataChunkSignature" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case DataChunkSignature::v: return debug << (packed ? "" : "::") << Debug::nospace << #v;
+        _c(Little32)
+        _c(Little64)
+        _c(Big32)
+        _c(Big64)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << (packed ? "" : "(") << Debug::nospace << Debug::hex << UnsignedInt(value) << Debug::nospace << (packed ? "" : ")");
+}
+
+Debug& operator<<(Debug& debug, const DataChunkType value) {
+    const bool packed = debug.immediateFlags() >= Debug::Flag::Packed;
+
+    if(!packed)
+        debug << "Trade::DataChunkType" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case DataChunkType::v: return debug << (packed ? "" : "::") << Debug::nospace << #v;
+        _c(Mesh)
+        _c(Scene)
+        _c(Material)
+        _c(Image)
+        _c(Animation)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << (packed ? "" : "(") << Debug::nospace << Debug::hex << UnsignedInt(value) << Debug::nospace << (packed ? "" : ")");
+}
+
+namespace {
+
+bool isDataChunkHeaderValid(const DataChunkHeader& header) {
+    return header.version == 128 &&
+        header.eolUnix[0] == '\n' &&
+        header.eolWindows[0] == '\r' && header.eolWindows[1] == '\n' &&
+        header.zero == 0;
+}
+
+}
+
+bool isDataChunk(const Containers::ArrayView<const void> data) {
+    if(data.size() < sizeof(DataChunkHeader)) return false;
+
+    const DataChunkHeader& header = *static_cast<const DataChunkHeader*>(data.data());
+    return isDataChunkHeaderValid(header) &&
+        header.signature == DataChunkSignature::Current &&
+        header.size >= sizeof(DataChunkHeader) && header.size % 8 == 0 &&
+        header.size <= data.size();
+}
+
+const DataChunkHeader* dataChunkHeaderDeserialize(const Containers::ArrayView<const void> data) {
+    if(reinterpret_cast<std::uintptr_t>(data.data()) % 8) {
+        Error{} << "Trade::dataChunkHeaderDeserialize(): data not aligned to 8 bytes";
+        return nullptr;
+    }
+
+    if(data.size() < sizeof(DataChunkHeader)) {
+        Error{} << "Trade::dataChunkHeaderDeserialize(): expected at least" << sizeof(DataChunkHeader) << "bytes for a header but got" << data.size();
+        return nullptr;
+    }
+
+    const DataChunkHeader& header = *static_cast<const DataChunkHeader*>(data.data());
+    if(!isDataChunkHeaderValid(header)) {
+        Error{} << "Trade::dataChunkHeaderDeserialize(): invalid header";
+        return nullptr;
+    }
+
+    if(header.signature != DataChunkSignature::Current) {
+        Error{} << "Trade::dataChunkHeaderDeserialize(): expected signature" << DataChunkSignature::Current << "but got" << header.signature;
+        return nullptr;
+    }
+
+    if(header.size < sizeof(DataChunkHeader) || header.size % 8) {
+        Error{} << "Trade::dataChunkHeaderDeserialize(): invalid chunk size" << header.size;
+        return nullptr;
+    }
+
+    if(header.size > data.size()) {
+        Error{} << "Trade::dataChunkHeaderDeserialize(): expected" << header.size << "bytes for a" << header.type << "chunk but got" << data.size();
+        return nullptr;
+    }
+
+    return &header;
+}
+
 namespace Implementation {
     void nonOwnedArrayDeleter(char*, std::size_t) {}
     void nonOwnedArrayDeleter(AnimationTrackData*, std::size_t) {}
@@ -32,6 +32,7 @@
  */
 
 #include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Utility/Endianness.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Trade/Trade.h"
@@ -115,6 +116,152 @@ CORRADE_ENUMSET_OPERATORS(DataFlags)
 */
 MAGNUM_TRADE_EXPORT Debug& operator<<(Debug& debug, DataFlags value);
 
+/**
+@brief Data chunk signature
+@m_since_latest
+
+Encodes endianness and pointer size of the platform the chunk was serialized
+on. As the serialized data are meant to be used directly without any
+conversion, a chunk can be deserialized only on a platform with a matching
+signature.
+@see @ref DataChunkHeader::signature
+*/
+enum class DataChunkSignature: UnsignedInt {
+    /** Little-endian 32-bit */
+    Little32 = Utility::Endianness::fourCC('B', 'l', 'o', 'b'),
+
+    /** Little-endian 64-bit */
+    Little64 = Utility::Endianness::fourCC('B', 'L', 'O', 'B'),
+
+    /** Big-endian 32-bit */
+    Big32 = Utility::Endianness::fourCC('b', 'o', 'l', 'B'),
+
+    /** Big-endian 64-bit */
+    Big64 = Utility::Endianness::fourCC('B', 'O', 'L', 'B'),
+
+    /**
+     * Signature matching the current platform. Alias to one of the above.
+     */
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    Current = Little64
+    #elif !defined(CORRADE_TARGET_BIG_ENDIAN)
+    Current = sizeof(std::size_t) == 8 ? Little64 : Little32
+    #else
+    Current = sizeof(std::size_t) == 8 ? Big64 : Big32
+    #endif
+};
+
+/**
+@debugoperatorenum{DataChunkSignature}
+@m_since_latest
+*/
+MAGNUM_TRADE_EXPORT Debug& operator<<(Debug& debug, DataChunkSignature value);
+
+/**
+@brief Data chunk type
+@m_since_latest
+
+@see @ref DataChunkHeader::type
+*/
+enum class DataChunkType: UnsignedInt {
+    /** Serialized @ref MeshData */
+    Mesh = Utility::Endianness::fourCC('M', 's', 'h', '\0'),
+
+    /** Serialized @ref SceneData */
+    Scene = Utility::Endianness::fourCC('S', 'c', 'n', '\0'),
+
+    /** Serialized @ref MaterialData */
+    Material = Utility::Endianness::fourCC('M', 't', 'l', '\0'),
+
+    /**
+     * Serialized @ref ImageData1D, @ref ImageData2D or @ref ImageData3D
+     */
+    Image = Utility::Endianness::fourCC('I', 'm', 'g', '\0'),
+
+    /** Serialized @ref AnimationData */
+    Animation = Utility::Endianness::fourCC('A', 'n', 'm', '\0')
+};
+
+/**
+@debugoperatorenum{DataChunkType}
+@m_since_latest
+*/
+MAGNUM_TRADE_EXPORT Debug& operator<<(Debug& debug, DataChunkType value);
+
+/**
+@brief Data chunk header
+@m_since_latest
+
+Header of a serialized data chunk, as produced for example by
+@ref MeshData::serialize(). The chunk data are stored in a platform-specific
+layout and are designed to be used directly from the memory, for example a
+memory-mapped file, without any copying or parsing --- only a few offsets are
+converted to pointers on deserialization. Multiple chunks can be concatenated
+together, @ref size is always a multiple of 8 bytes and all chunk contents
+are aligned to at least 8 bytes relative to the chunk start, assuming the
+chunk itself is 8-byte aligned.
+
+The first eight bytes are designed to detect a file corrupted by text
+conversion, truncation or a mismatch between the platform it was serialized
+on and the platform it's deserialized on. The header is followed by
+type-specific data.
+@see @ref isDataChunk(), @ref dataChunkHeaderDeserialize()
+*/
+struct DataChunkHeader {
+    /**
+     * Format version. Has the high bit set to detect 7-bit text conversions,
+     * currently @cpp 128 @ce.
+     */
+    UnsignedByte version;
+
+    /** Unix EOL, @cpp '\n' @ce, to detect line ending conversion */
+    char eolUnix[1];
+
+    /** Windows EOL, @cpp "\r\n" @ce, to detect line ending conversion */
+    char eolWindows[2];
+
+    /** Signature, matching endianness and pointer size of the platform */
+    DataChunkSignature signature;
+
+    /** Always zero, to detect null byte stripping */
+    UnsignedShort zero;
+
+    /** Version of the type-specific data layout */
+    UnsignedShort typeVersion;
+
+    /** Chunk type */
+    DataChunkType type;
+
+    /** Chunk size including the header, always a multiple of 8 */
+    std::size_t size;
+};
+
+/**
+@brief Check if given data blob is a valid data chunk
+@m_since_latest
+
+Returns @cpp true @ce if @p data is large enough to contain a
+@ref DataChunkHeader, the header is valid and matches the current platform and
+@ref DataChunkHeader::size is not larger than @p data, @cpp false @ce
+otherwise. Doesn't print any message.
+@see @ref dataChunkHeaderDeserialize()
+*/
+MAGNUM_TRADE_EXPORT bool isDataChunk(Containers::ArrayView<const void> data);
+
+/**
+@brief Deserialize a data chunk header
+@m_since_latest
+
+Checks that @p data is large enough to contain a @ref DataChunkHeader, that
+it's 8-byte aligned, the header is valid and matches the current platform and
+@ref DataChunkHeader::size is not larger than @p data. On failure prints a
+message to @relativeref{Magnum,Error} and returns @cpp nullptr @ce.
+Otherwise returns a pointer to the header, which is the same as
+@cpp data.data() @ce.
+@see @ref isDataChunk()
+*/
+MAGNUM_TRADE_EXPORT const DataChunkHeader* dataChunkHeaderDeserialize(Containers::ArrayView<const void> data);
+
 namespace Implementation {
     /* Used internally by AnimationData, MaterialData, MeshData, SceneData,
        SkinData -- we need them to be exported symbols in the Trade library and
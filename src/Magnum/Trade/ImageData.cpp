@@ -26,11 +26,15 @@
 
 #include "ImageData.h"
 
+#include <cstring>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
 
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/Implementation/ImageProperties.h"
+#include "Magnum/Trade/Implementation/dataChunk.h"
 
 namespace Magnum { namespace Trade {
 
@@ -223,6 +227,118 @@ template<UnsignedInt dimensions> Containers::Array<char> ImageData<dimensions>::
     return data;
 }
 
+namespace {
+
+/* Followed by the pixel data. Everything is stored as 3D, unused dimensions
+   are zero. */
+struct ImageDataChunkHeader: DataChunkHeader {
+    UnsignedByte dimensions;
+    bool compressed;
+    UnsignedShort flags;
+    /* PixelFormat or CompressedPixelFormat */
+    UnsignedInt format;
+    UnsignedInt formatExtra;
+    UnsignedInt pixelSize;
+    Int alignment;
+    Int rowLength;
+    Int imageHeight;
+    Vector3i skip;
+    Vector3i compressedBlockSize;
+    Int compressedBlockDataSize;
+    Vector3i size;
+    /* 4 bytes padding */
+    std::size_t dataSize;
+};
+
+static_assert(sizeof(ImageDataChunkHeader) % 8 == 0, "improper image chunk header padding");
+
+}
+
+template<UnsignedInt dimensions> std::size_t ImageData<dimensions>::serializedSize() const {
+    return sizeof(ImageDataChunkHeader) + Implementation::dataChunkAlign(_data.size());
+}
+
+template<UnsignedInt dimensions> std::size_t ImageData<dimensions>::serializeInto(const Containers::ArrayView<char> out) const {
+    const std::size_t size = serializedSize();
+    CORRADE_ASSERT(reinterpret_cast<std::uintptr_t>(out.data()) % 8 == 0,
+        "Trade::ImageData::serializeInto(): data not aligned to 8 bytes", {});
+    CORRADE_ASSERT(out.size() == size,
+        "Trade::ImageData::serializeInto(): expected a view of" << size << "bytes but got" << out.size(), {});
+
+    /* Zero-initialize the header first so the padding and the unused
+       dimensions are deterministic */
+    std::memset(out.data(), 0, sizeof(ImageDataChunkHeader));
+    ImageDataChunkHeader& header = *reinterpret_cast<ImageDataChunkHeader*>(out.data());
+    Implementation::dataChunkHeaderSerializeInto(header, DataChunkType::Image, 0, size);
+    header.dimensions = dimensions;
+    header.compressed = _compressed;
+    header.flags = UnsignedShort(typename ImageFlags<dimensions>::UnderlyingType(_flags));
+    const PixelStorage& storage = _compressed ? _compressedStorage : _storage;
+    header.alignment = storage.alignment();
+    header.rowLength = storage.rowLength();
+    header.imageHeight = storage.imageHeight();
+    header.skip = storage.skip();
+    if(_compressed) {
+        header.format = UnsignedInt(_compressedFormat);
+        header.compressedBlockSize = _compressedStorage.compressedBlockSize();
+        header.compressedBlockDataSize = _compressedStorage.compressedBlockDataSize();
+    } else {
+        header.format = UnsignedInt(_format);
+        header.formatExtra = _formatExtra;
+        header.pixelSize = _pixelSize;
+    }
+    header.size = Vector3i::pad(_size);
+    header.dataSize = _data.size();
+
+    Utility::copy(_data, out.sliceSize(sizeof(ImageDataChunkHeader), _data.size()));
+    std::memset(out.data() + sizeof(ImageDataChunkHeader) + _data.size(), 0, size - sizeof(ImageDataChunkHeader) - _data.size());
+
+    return size;
+}
+
+template<UnsignedInt dimensions> Containers::Array<char> ImageData<dimensions>::serialize() const {
+    /* NoInit arrays are allocated with new[], which is guaranteed to be
+       aligned for any fundamental type */
+    Containers::Array<char> out{NoInit, serializedSize()};
+    serializeInto(out);
+    return out;
+}
+
+template<UnsignedInt dimensions> Containers::Optional<ImageData<dimensions>> ImageData<dimensions>::deserialize(const Containers::ArrayView<const void> data) {
+    const char* const messagePrefix = "Trade::ImageData::deserialize():";
+    const ImageDataChunkHeader* const header = Implementation::dataChunkDeserialize<ImageDataChunkHeader>(data, DataChunkType::Image, 0, messagePrefix);
+    if(!header) return {};
+
+    if(header->dimensions != dimensions) {
+        Error{} << messagePrefix << "expected a" << dimensions << Debug::nospace << "D image but got" << header->dimensions << Debug::nospace << "D";
+        return {};
+    }
+    if(!Implementation::dataChunkCheckRange(*header, sizeof(ImageDataChunkHeader), header->dataSize, "image data", messagePrefix))
+        return {};
+
+    const Containers::ArrayView<const char> pixels{static_cast<const char*>(data.data()) + sizeof(ImageDataChunkHeader), header->dataSize};
+    const ImageFlags<dimensions> flags{typename ImageFlags<dimensions>::Type(header->flags)};
+    const VectorTypeFor<dimensions, Int> size = Math::Vector<dimensions, Int>::pad(header->size);
+
+    if(header->compressed) {
+        CompressedPixelStorage storage;
+        storage.setAlignment(header->alignment)
+            .setRowLength(header->rowLength)
+            .setImageHeight(header->imageHeight)
+            .setSkip(header->skip);
+        storage.setCompressedBlockSize(header->compressedBlockSize)
+            .setCompressedBlockDataSize(header->compressedBlockDataSize);
+        return ImageData<dimensions>{storage, CompressedPixelFormat(header->format), size, DataFlags{}, pixels, flags};
+    }
+
+    PixelStorage storage;
+    storage.setAlignment(header->alignment)
+        .setRowLength(header->rowLength)
+        .setImageHeight(header->imageHeight)
+        .setSkip(header->skip);
+    return ImageData<dimensions>{storage, PixelFormat(header->format), header->formatExtra, header->pixelSize, size, DataFlags{}, pixels, flags};
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_TRADE_EXPORT ImageData<1>;
 template class MAGNUM_TRADE_EXPORT ImageData<2>;
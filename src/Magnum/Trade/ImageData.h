@@ -898,6 +898,54 @@ template<UnsignedInt dimensions> class ImageData {
          */
         Containers::Array<char> release();
 
+        /**
+         * @brief Size of the serialized image
+         * @m_since_latest
+         *
+         * Size of the data chunk produced by @ref serialize() and
+         * @ref serializeInto(), including the @ref DataChunkHeader. Always a
+         * multiple of 8 bytes.
+         */
+        std::size_t serializedSize() const;
+
+        /**
+         * @brief Serialize the image into an existing memory
+         * @m_since_latest
+         *
+         * Expects that @p out is 8-byte aligned and exactly
+         * @ref serializedSize() bytes large. The data are copied as-is,
+         * together with the format, storage parameters and flags. Returns
+         * @ref serializedSize(). The @ref importerState() isn't serialized.
+         * @see @ref deserialize(), @ref DataChunkType::Image
+         */
+        std::size_t serializeInto(Containers::ArrayView<char> out) const;
+
+        /**
+         * @brief Serialize the image
+         * @m_since_latest
+         *
+         * Allocates an array of @ref serializedSize() bytes and calls
+         * @ref serializeInto() on it.
+         */
+        Containers::Array<char> serialize() const;
+
+        /**
+         * @brief Deserialize an image
+         * @m_since_latest
+         *
+         * Expects that @p data is 8-byte aligned and starts with a valid
+         * @ref DataChunkType::Image chunk of the same dimension count,
+         * produced by @ref serialize() on a platform with a matching
+         * @ref DataChunkSignature. Data past @ref DataChunkHeader::size are
+         * ignored. On failure prints a message to @relativeref{Magnum,Error}
+         * and returns @relativeref{Corrade,Containers::NullOpt}.
+         *
+         * Nothing is copied --- the returned instance references the pixel
+         * data in @p data, which is thus expected to stay in scope for as
+         * long as the instance is used, and @ref dataFlags() are empty.
+         */
+        static Containers::Optional<ImageData<dimensions>> deserialize(Containers::ArrayView<const void> data);
+
         /**
          * @brief Importer-specific state
          *
@@ -0,0 +1,119 @@
+#ifndef Magnum_Trade_Implementation_dataChunk_h
+#define Magnum_Trade_Implementation_dataChunk_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Trade/Data.h"
+
+namespace Magnum { namespace Trade { namespace Implementation {
+
+/* Used by serialize() / deserialize() of MeshData, SceneData, MaterialData,
+   ImageData and AnimationData. The type-specific header structs are derived
+   from DataChunkHeader and all chunk contents are placed at 8-byte aligned
+   offsets. */
+
+constexpr std::size_t dataChunkAlign(std::size_t size) {
+    return (size + 7) & ~std::size_t{7};
+}
+
+inline void dataChunkHeaderSerializeInto(DataChunkHeader& header, const DataChunkType type, const UnsignedShort typeVersion, const std::size_t size) {
+    header.version = 128;
+    header.eolUnix[0] = '\n';
+    header.eolWindows[0] = '\r';
+    header.eolWindows[1] = '\n';
+    header.signature = DataChunkSignature::Current;
+    header.zero = 0;
+    header.typeVersion = typeVersion;
+    header.type = type;
+    header.size = size;
+}
+
+/* Checks the generic header and then that it's of given type and version and
+   at least headerSize large. Prints a message and returns nullptr on
+   failure. */
+template<class T> const T* dataChunkDeserialize(const Containers::ArrayView<const void> data, const DataChunkType type, const UnsignedShort typeVersion, const char* const messagePrefix) {
+    const DataChunkHeader* const header = dataChunkHeaderDeserialize(data);
+    if(!header) return nullptr;
+
+    if(header->type != type) {
+        Error{} << messagePrefix << "expected a" << type << "chunk but got" << header->type;
+        return nullptr;
+    }
+    if(header->typeVersion != typeVersion) {
+        Error{} << messagePrefix << "invalid chunk type version" << header->typeVersion;
+        return nullptr;
+    }
+    if(header->size < sizeof(T)) {
+        Error{} << messagePrefix << "expected at least" << sizeof(T) << "bytes for a" << type << "chunk header but got" << header->size;
+        return nullptr;
+    }
+
+    return static_cast<const T*>(header);
+}
+
+/* Checks that a [offset, offset + size) range fits into the chunk and is
+   8-byte aligned */
+inline bool dataChunkCheckRange(const DataChunkHeader& header, const std::size_t offset, const std::size_t size, const char* const what, const char* const messagePrefix) {
+    if(offset % 8 || offset > header.size || size > header.size - offset) {
+        Error{} << messagePrefix << what << "of" << size << "bytes at offset" << offset << "out of range for a chunk of" << header.size << "bytes";
+        return false;
+    }
+    return true;
+}
+
+/* Like dataChunkCheckRange(), but for count items of given size, guarding
+   against the multiplication overflowing on 32-bit platforms */
+inline bool dataChunkCheckArrayRange(const DataChunkHeader& header, const std::size_t offset, const std::size_t count, const std::size_t itemSize, const char* const what, const char* const messagePrefix) {
+    if(count > header.size/itemSize) {
+        Error{} << messagePrefix << what << "of" << count << "items out of range for a chunk of" << header.size << "bytes";
+        return false;
+    }
+    return dataChunkCheckRange(header, offset, count*itemSize, what, messagePrefix);
+}
+
+/* Checks that count items of itemSize bytes, the first one at offset and the
+   others separated by a possibly negative stride, fit into dataSize bytes.
+   Empty views aren't checked, same as in the MeshData and SceneData
+   constructors. All arithmetic is done so it can't overflow even for
+   garbage input. */
+inline bool dataChunkCheckStridedRange(const UnsignedLong dataSize, const UnsignedLong offset, const UnsignedLong count, const Long stride, const UnsignedLong itemSize) {
+    if(!count) return true;
+    if(offset > dataSize || itemSize > dataSize - offset) return false;
+
+    const UnsignedLong absStride = stride < 0 ? -stride : stride;
+    if(absStride && count - 1 > dataSize/absStride) return false;
+    const UnsignedLong span = (count - 1)*absStride;
+    return stride < 0 ? span <= offset :
+        span <= dataSize - offset - itemSize;
+}
+
+}}}
+
+#endif
@@ -30,11 +30,14 @@
 #include <algorithm> /* std::sort() */
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/Algorithms.h>
 
 #include "Magnum/Math/Vector4.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Trade/Data.h"
 #include "Magnum/Trade/Implementation/arrayUtilities.h"
+#include "Magnum/Trade/Implementation/dataChunk.h"
 
 namespace Magnum { namespace Trade {
 
@@ -1148,6 +1151,162 @@ Containers::Array<MaterialAttributeData> MaterialData::releaseAttributeData() {
     return Utility::move(_data);
 }
 
+namespace {
+
+/* Followed by attributeCount MaterialAttributeData and then layerCount layer
+   offsets */
+struct MaterialDataChunkHeader: DataChunkHeader {
+    MaterialTypes types;
+    UnsignedInt attributeCount;
+    UnsignedInt layerCount;
+    /* 4 bytes padding */
+};
+
+static_assert(sizeof(MaterialDataChunkHeader) % 8 == 0, "improper material chunk header padding");
+
+}
+
+std::size_t MaterialData::serializedSize() const {
+    return sizeof(MaterialDataChunkHeader) +
+        Implementation::dataChunkAlign(_data.size()*sizeof(MaterialAttributeData)) +
+        Implementation::dataChunkAlign(_layerOffsets.size()*sizeof(UnsignedInt));
+}
+
+std::size_t MaterialData::serializeInto(const Containers::ArrayView<char> out) const {
+    const std::size_t size = serializedSize();
+    CORRADE_ASSERT(reinterpret_cast<std::uintptr_t>(out.data()) % 8 == 0,
+        "Trade::MaterialData::serializeInto(): data not aligned to 8 bytes", {});
+    CORRADE_ASSERT(out.size() == size,
+        "Trade::MaterialData::serializeInto(): expected a view of" << size << "bytes but got" << out.size(), {});
+
+    /* Pointers wouldn't survive a round trip */
+    for(const MaterialAttributeData& attribute: _data) {
+        if(attribute.type() == MaterialAttributeType::Pointer ||
+           attribute.type() == MaterialAttributeType::MutablePointer) {
+            Error{} << "Trade::MaterialData::serializeInto(): can't serialize a" << attribute.type() << "attribute" << attribute.name();
+            return {};
+        }
+    }
+
+    /* Zero-initialize the header first so the padding is deterministic */
+    std::memset(out.data(), 0, sizeof(MaterialDataChunkHeader));
+    MaterialDataChunkHeader& header = *reinterpret_cast<MaterialDataChunkHeader*>(out.data());
+    Implementation::dataChunkHeaderSerializeInto(header, DataChunkType::Material, 0, size);
+    header.types = _types;
+    header.attributeCount = _data.size();
+    header.layerCount = _layerOffsets.size();
+
+    const std::size_t attributeSize = _data.size()*sizeof(MaterialAttributeData);
+    const std::size_t layerOffset = sizeof(MaterialDataChunkHeader) + Implementation::dataChunkAlign(attributeSize);
+    const std::size_t layerSize = _layerOffsets.size()*sizeof(UnsignedInt);
+    Utility::copy(Containers::arrayCast<const char>(Containers::arrayView(_data)), out.sliceSize(sizeof(MaterialDataChunkHeader), attributeSize));
+    Utility::copy(Containers::arrayCast<const char>(Containers::arrayView(_layerOffsets)), out.sliceSize(layerOffset, layerSize));
+
+    /* Zero the padding as well */
+    std::memset(out.data() + sizeof(MaterialDataChunkHeader) + attributeSize, 0, layerOffset - sizeof(MaterialDataChunkHeader) - attributeSize);
+    std::memset(out.data() + layerOffset + layerSize, 0, size - layerOffset - layerSize);
+
+    return size;
+}
+
+Containers::Optional<Containers::Array<char>> MaterialData::serialize() const {
+    /* NoInit arrays are allocated with new[], which is guaranteed to be
+       aligned for any fundamental type */
+    Containers::Array<char> out{NoInit, serializedSize()};
+    if(!serializeInto(out)) return {};
+    return out;
+}
+
+Containers::Optional<MaterialData> MaterialData::deserialize(const Containers::ArrayView<const void> data) {
+    const char* const messagePrefix = "Trade::MaterialData::deserialize():";
+    const MaterialDataChunkHeader* const header = Implementation::dataChunkDeserialize<MaterialDataChunkHeader>(data, DataChunkType::Material, 0, messagePrefix);
+    if(!header) return {};
+
+    if(!Implementation::dataChunkCheckArrayRange(*header, sizeof(MaterialDataChunkHeader), header->attributeCount, sizeof(MaterialAttributeData), "attribute data", messagePrefix))
+        return {};
+    const std::size_t layerOffset = sizeof(MaterialDataChunkHeader) + Implementation::dataChunkAlign(header->attributeCount*sizeof(MaterialAttributeData));
+    if(!Implementation::dataChunkCheckArrayRange(*header, layerOffset, header->layerCount, sizeof(UnsignedInt), "layer data", messagePrefix))
+        return {};
+
+    const char* const chunk = static_cast<const char*>(data.data());
+    const Containers::ArrayView<const MaterialAttributeData> attributes{reinterpret_cast<const MaterialAttributeData*>(chunk + sizeof(MaterialDataChunkHeader)), header->attributeCount};
+    const Containers::ArrayView<const UnsignedInt> layers{reinterpret_cast<const UnsignedInt*>(chunk + layerOffset), header->layerCount};
+
+    /* The MaterialData constructor would only assert on the checks below,
+       which isn't desirable for data coming from a file. Each attribute has
+       to have a known type, a non-empty null-terminated name and the value
+       has to fit after it. */
+    for(std::size_t i = 0; i != attributes.size(); ++i) {
+        const MaterialAttributeData& attribute = attributes[i];
+        const MaterialAttributeType type = attribute._data.type;
+        if(UnsignedInt(type) - 1 > UnsignedInt(MaterialAttributeType::TextureSwizzle) - 1 ||
+           type == MaterialAttributeType::Pointer ||
+           type == MaterialAttributeType::MutablePointer) {
+            Error{} << messagePrefix << "invalid type" << type << "of attribute" << i;
+            return {};
+        }
+
+        const char* const nameEnd = Containers::Implementation::stringFindCharacter(attribute._data.data + 1, Implementation::MaterialAttributeDataSize - 1, '\0');
+        const std::size_t nameSize = nameEnd ? nameEnd - attribute._data.data - 1 : 0;
+        if(!nameSize) {
+            Error{} << messagePrefix << "invalid name of attribute" << i;
+            return {};
+        }
+
+        std::size_t valueSize;
+        if(type == MaterialAttributeType::String) {
+            /* The size is in the last byte, preceded by a null terminator */
+            valueSize = UnsignedByte(attribute._data.data[Implementation::MaterialAttributeDataSize - 1]) + 2;
+            if(nameSize + valueSize + 2 > Implementation::MaterialAttributeDataSize || attribute._data.data[Implementation::MaterialAttributeDataSize - 2] != '\0') {
+                Error{} << messagePrefix << "invalid string value of attribute" << attribute.name();
+                return {};
+            }
+        } else if(type == MaterialAttributeType::Buffer) {
+            /* The size is right after the name null terminator */
+            valueSize = nameSize + 2 < Implementation::MaterialAttributeDataSize ? UnsignedByte(attribute._data.data[nameSize + 2]) + 1 : Implementation::MaterialAttributeDataSize;
+            if(nameSize + valueSize + 2 > Implementation::MaterialAttributeDataSize) {
+                Error{} << messagePrefix << "invalid buffer value of attribute" << attribute.name();
+                return {};
+            }
+        } else {
+            valueSize = materialAttributeTypeSize(type);
+            if(nameSize + valueSize + 2 > Implementation::MaterialAttributeDataSize) {
+                Error{} << messagePrefix << "name" << attribute.name() << "too long for" << type;
+                return {};
+            }
+        }
+    }
+
+    /* Layer offsets have to be monotonic, cover all attributes and names
+       have to be sorted and unique within each layer, as non-owned data
+       can't be sorted in the constructor */
+    const UnsignedInt implicitLayerData[]{header->attributeCount};
+    const Containers::ArrayView<const UnsignedInt> layerOffsets = layers ? layers : Containers::arrayView(implicitLayerData);
+    UnsignedInt begin = 0;
+    for(std::size_t i = 0; i != layerOffsets.size(); ++i) {
+        const UnsignedInt end = layerOffsets[i];
+        if(begin > end || end > header->attributeCount) {
+            Error{} << messagePrefix << "invalid range (" << Debug::nospace << begin << Debug::nospace << "," << end << Debug::nospace <<") for layer" << i << "with" << header->attributeCount << "attributes in total";
+            return {};
+        }
+        for(std::size_t j = begin + 1; j < end; ++j) {
+            if(!(attributes[j - 1].name() < attributes[j].name())) {
+                Error{} << messagePrefix << "attribute" << attributes[j].name() << "in layer" << i << "is duplicate or not sorted";
+                return {};
+            }
+        }
+        begin = end;
+    }
+    if(layerOffsets.back() != header->attributeCount) {
+        Error{} << messagePrefix << "last layer offset" << layerOffsets.back() << "too short for" << header->attributeCount << "attributes in total";
+        return {};
+    }
+
+    return MaterialData{header->types,
+        DataFlags{}, attributes,
+        DataFlags{}, layers};
+}
+
 Debug& operator<<(Debug& debug, const MaterialLayer value) {
     debug << "Trade::MaterialLayer" << Debug::nospace;
 
@@ -1826,6 +1826,10 @@ given attribute is not found.
 It's also possible to iterate through all attributes using @ref attributeName(),
 @ref attributeType() and @ref attribute() taking indices instead of names, with
 @ref attributeCount() returning the total attribute count.
+When querying the same set of attributes from many materials, for example to
+fill a GPU-side material table, @ref MaterialTools::findAttributeIds() resolves
+all names to attribute IDs for all materials in a single pass, which can then
+be used for @f$ \mathcal{O}(1) @f$ access.
 
 @subsection Trade-MaterialData-usage-types Material types and convenience accessors
 
@@ -2539,7 +2543,8 @@ class MAGNUM_TRADE_EXPORT MaterialData {
          * to be smaller than @ref layerCount() const. The lookup is done in an
          * @f$ \mathcal{O}(\log n) @f$ complexity with @f$ n @f$ being
          * attribute count in given @p layer.
-         * @see @ref hasAttribute(), @ref attributeId()
+         * @see @ref hasAttribute(), @ref attributeId(),
+         *      @ref MaterialTools::findAttributeIds()
          */
         Containers::Optional<UnsignedInt> findAttributeId(UnsignedInt layer, Containers::StringView name) const;
         Containers::Optional<UnsignedInt> findAttributeId(UnsignedInt layer, MaterialAttribute name) const; /**< @overload */
@@ -3438,6 +3443,63 @@ class MAGNUM_TRADE_EXPORT MaterialData {
          */
         Containers::Array<MaterialAttributeData> releaseAttributeData();
 
+        /**
+         * @brief Size of the serialized material
+         * @m_since_latest
+         *
+         * Size of the data chunk produced by @ref serialize() and
+         * @ref serializeInto(), including the @ref DataChunkHeader. Always a
+         * multiple of 8 bytes.
+         */
+        std::size_t serializedSize() const;
+
+        /**
+         * @brief Serialize the material into an existing memory
+         * @m_since_latest
+         *
+         * Expects that @p out is 8-byte aligned and exactly
+         * @ref serializedSize() bytes large. Attribute and layer data are
+         * copied as-is. Materials containing
+         * @ref MaterialAttributeType::Pointer or
+         * @relativeref{MaterialAttributeType,MutablePointer} attributes can't
+         * be serialized, in that case prints a message to
+         * @relativeref{Magnum,Error} and returns @cpp 0 @ce, otherwise returns
+         * @ref serializedSize(). The @ref importerState() isn't serialized.
+         * @see @ref deserialize(), @ref DataChunkType::Material
+         */
+        std::size_t serializeInto(Containers::ArrayView<char> out) const;
+
+        /**
+         * @brief Serialize the material
+         * @m_since_latest
+         *
+         * Allocates an array of @ref serializedSize() bytes and calls
+         * @ref serializeInto() on it. If it fails, returns
+         * @relativeref{Corrade,Containers::NullOpt}.
+         */
+        Containers::Optional<Containers::Array<char>> serialize() const;
+
+        /**
+         * @brief Deserialize a material
+         * @m_since_latest
+         *
+         * Expects that @p data is 8-byte aligned and starts with a valid
+         * @ref DataChunkType::Material chunk produced by @ref serialize() on
+         * a platform with a matching @ref DataChunkSignature. Data past
+         * @ref DataChunkHeader::size are ignored. On failure prints a message
+         * to @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt}.
+         *
+         * Nothing is copied --- the returned instance references attribute
+         * and layer data in @p data, which is thus expected to stay in scope
+         * for as long as the instance is used, and both
+         * @ref attributeDataFlags() and @ref layerDataFlags() are empty.
+         * Attribute types, names, value sizes, attribute order and layer
+         * offsets are validated so a corrupted chunk results in an error
+         * instead of an assertion or an out-of-bounds access.
+         */
+        static Containers::Optional<MaterialData> deserialize(Containers::ArrayView<const void> data);
+
         /**
          * @brief Importer-specific state
          *
@@ -27,6 +27,8 @@
 
 #include "MeshData.h"
 
+#include <cstring>
+#include <new>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Utility/Algorithms.h>
 #ifndef CORRADE_NO_ASSERT
@@ -36,6 +38,7 @@
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/PackingBatch.h"
 #include "Magnum/Trade/Implementation/arrayUtilities.h"
+#include "Magnum/Trade/Implementation/dataChunk.h"
 
 namespace Magnum { namespace Trade {
 
@@ -761,6 +764,8 @@ void tangentsOrNormalsInto(const Containers::StridedArrayView1D<const void>& att
         Math::unpackInto(Containers::arrayCast<2, const Byte>(attributeData, 3), destination3f);
     else if(format == VertexFormat::Vector3sNormalized)
         Math::unpackInto(Containers::arrayCast<2, const Short>(attributeData, 3), destination3f);
+    else if(format == VertexFormat::Vector3i1010102Normalized)
+        Math::unpackInt1010102Into(Containers::arrayCast<const UnsignedInt>(attributeData), destination3f);
     else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 }
 
@@ -790,6 +795,8 @@ void MeshData::tangentsInto(const Containers::StridedArrayView1D<Vector3>& desti
         format = VertexFormat::Vector3bNormalized;
     else if(attribute._format == VertexFormat::Vector4sNormalized)
         format = VertexFormat::Vector3sNormalized;
+    else if(attribute._format == VertexFormat::Vector4i1010102Normalized)
+        format = VertexFormat::Vector3i1010102Normalized;
     else format = attribute._format;
     tangentsOrNormalsInto(attributeDataViewInternal(attribute), destination, format);
 }
@@ -823,7 +830,12 @@ void MeshData::bitangentSignsInto(const Containers::StridedArrayView1D<Float>& d
         Math::unpackInto(Containers::arrayCast<2, const Byte>(attributeData, 4).exceptPrefix({0, 3}), destination1f);
     else if(attribute._format == VertexFormat::Vector4sNormalized)
         Math::unpackInto(Containers::arrayCast<2, const Short>(attributeData, 4).exceptPrefix({0, 3}), destination1f);
-    else CORRADE_ASSERT_UNREACHABLE("Trade::MeshData::bitangentSignsInto(): expected four-component tangents, but got" << attribute._format, );
+    else if(attribute._format == VertexFormat::Vector4i1010102Normalized) {
+        /* The sign is in the top two bits, with both -2 and -1 being -1 */
+        const auto packed = Containers::arrayCast<const UnsignedInt>(attributeData);
+        for(std::size_t i = 0; i != packed.size(); ++i)
+            destination[i] = packed[i] >> 31 ? -1.0f : Float(packed[i] >> 30);
+    } else CORRADE_ASSERT_UNREACHABLE("Trade::MeshData::bitangentSignsInto(): expected four-component tangents, but got" << attribute._format, );
 }
 
 Containers::Array<Float> MeshData::bitangentSignsAsArray(const UnsignedInt id, const Int morphTargetId) const {
@@ -956,6 +968,8 @@ void MeshData::colorsInto(const Containers::StridedArrayView1D<Color4>& destinat
         Math::unpackInto(Containers::arrayCast<2, const UnsignedByte>(attributeData, 4), destination4f);
     else if(attribute._format == VertexFormat::Vector4usNormalized)
         Math::unpackInto(Containers::arrayCast<2, const UnsignedShort>(attributeData, 4), destination4f);
+    else if(attribute._format == VertexFormat::Vector4ui1010102Normalized)
+        Math::unpackUnsignedInt1010102Into(Containers::arrayCast<const UnsignedInt>(attributeData), destination4f);
     else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 
     /* For three-component colors finally fill the alpha with a single value */
@@ -1096,6 +1110,183 @@ Containers::Array<char> MeshData::releaseVertexData() {
     return out;
 }
 
+namespace {
+
+/* Followed by attributeCount offset-only MeshAttributeData, then index data
+   and vertex data at the offsets stored in the header. Offsets are relative
+   to the chunk start. */
+struct MeshDataChunkHeader: DataChunkHeader {
+    UnsignedInt indexCount;
+    UnsignedInt vertexCount;
+    MeshPrimitive primitive;
+    MeshIndexType indexType;
+    Short indexStride;
+    UnsignedShort attributeCount;
+    /* 4 bytes padding */
+    std::size_t indexOffset; /* relative to index data start */
+    std::size_t indexDataOffset;
+    std::size_t indexDataSize;
+    std::size_t vertexDataOffset;
+    std::size_t vertexDataSize;
+};
+
+static_assert(sizeof(MeshDataChunkHeader) % 8 == 0, "improper mesh chunk header padding");
+
+}
+
+std::size_t MeshData::serializedSize() const {
+    return sizeof(MeshDataChunkHeader) +
+        Implementation::dataChunkAlign(_attributes.size()*sizeof(MeshAttributeData)) +
+        Implementation::dataChunkAlign(_indexData.size()) +
+        Implementation::dataChunkAlign(_vertexData.size());
+}
+
+std::size_t MeshData::serializeInto(const Containers::ArrayView<char> out) const {
+    const std::size_t size = serializedSize();
+    CORRADE_ASSERT(reinterpret_cast<std::uintptr_t>(out.data()) % 8 == 0,
+        "Trade::MeshData::serializeInto(): data not aligned to 8 bytes", {});
+    CORRADE_ASSERT(out.size() == size,
+        "Trade::MeshData::serializeInto(): expected a view of" << size << "bytes but got" << out.size(), {});
+
+    /* Zero-initialize the header first so the padding is deterministic */
+    std::memset(out.data(), 0, sizeof(MeshDataChunkHeader));
+    MeshDataChunkHeader& header = *reinterpret_cast<MeshDataChunkHeader*>(out.data());
+    Implementation::dataChunkHeaderSerializeInto(header, DataChunkType::Mesh, 0, size);
+    header.indexCount = _indexCount;
+    header.vertexCount = _vertexCount;
+    header.primitive = _primitive;
+    header.indexType = _indexType;
+    header.indexStride = _indexStride;
+    header.attributeCount = _attributes.size();
+    header.indexOffset = _indices - _indexData.data();
+    header.indexDataOffset = sizeof(MeshDataChunkHeader) + Implementation::dataChunkAlign(_attributes.size()*sizeof(MeshAttributeData));
+    header.indexDataSize = _indexData.size();
+    header.vertexDataOffset = header.indexDataOffset + Implementation::dataChunkAlign(_indexData.size());
+    header.vertexDataSize = _vertexData.size();
+
+    /* Attributes are stored as offset-only so they don't need any patching
+       on deserialization */
+    MeshAttributeData* const attributes = reinterpret_cast<MeshAttributeData*>(out.data() + sizeof(MeshDataChunkHeader));
+    for(std::size_t i = 0; i != _attributes.size(); ++i)
+        new(attributes + i) MeshAttributeData{attributeName(i), attributeFormat(i), attributeOffset(i), _vertexCount, attributeStride(i), attributeArraySize(i), attributeMorphTargetId(i)};
+
+    Utility::copy(_indexData, out.sliceSize(header.indexDataOffset, _indexData.size()));
+    Utility::copy(_vertexData, out.sliceSize(header.vertexDataOffset, _vertexData.size()));
+
+    /* Zero the padding as well */
+    const std::size_t attributeEnd = sizeof(MeshDataChunkHeader) + _attributes.size()*sizeof(MeshAttributeData);
+    std::memset(out.data() + attributeEnd, 0, header.indexDataOffset - attributeEnd);
+    std::memset(out.data() + header.indexDataOffset + _indexData.size(), 0, header.vertexDataOffset - header.indexDataOffset - _indexData.size());
+    std::memset(out.data() + header.vertexDataOffset + _vertexData.size(), 0, size - header.vertexDataOffset - _vertexData.size());
+
+    return size;
+}
+
+Containers::Array<char> MeshData::serialize() const {
+    /* NoInit arrays are allocated with new[], which is guaranteed to be
+       aligned for any fundamental type */
+    Containers::Array<char> out{NoInit, serializedSize()};
+    serializeInto(out);
+    return out;
+}
+
+Containers::Optional<MeshData> MeshData::deserialize(const Containers::ArrayView<const void> data, const DataFlags dataFlags) {
+    CORRADE_ASSERT(!(dataFlags & DataFlag::Owned),
+        "Trade::MeshData::deserialize(): can't reference non-owned data but got" << dataFlags, {});
+
+    const char* const messagePrefix = "Trade::MeshData::deserialize():";
+    const MeshDataChunkHeader* const header = Implementation::dataChunkDeserialize<MeshDataChunkHeader>(data, DataChunkType::Mesh, 0, messagePrefix);
+    if(!header) return {};
+
+    if(!Implementation::dataChunkCheckArrayRange(*header, sizeof(MeshDataChunkHeader), header->attributeCount, sizeof(MeshAttributeData), "attribute data", messagePrefix) ||
+       !Implementation::dataChunkCheckRange(*header, header->indexDataOffset, header->indexDataSize, "index data", messagePrefix) ||
+       !Implementation::dataChunkCheckRange(*header, header->vertexDataOffset, header->vertexDataSize, "vertex data", messagePrefix))
+        return {};
+
+    const char* const chunk = static_cast<const char*>(data.data());
+    const Containers::ArrayView<const char> indexData{chunk + header->indexDataOffset, header->indexDataSize};
+    const Containers::ArrayView<const char> vertexData{chunk + header->vertexDataOffset, header->vertexDataSize};
+
+    /* The MeshData constructor would only assert on the checks below, which
+       isn't desirable for data coming from a file */
+    if(!header->indexCount && header->indexDataSize) {
+        Error{} << messagePrefix << "index data present for a mesh with no indices";
+        return {};
+    }
+    MeshIndexData indices;
+    if(header->indexType != MeshIndexType{}) {
+        if(!isMeshIndexTypeImplementationSpecific(header->indexType) && UnsignedInt(header->indexType) > UnsignedInt(MeshIndexType::UnsignedInt)) {
+            Error{} << messagePrefix << "invalid index type" << header->indexType;
+            return {};
+        }
+        const std::size_t indexTypeSize = isMeshIndexTypeImplementationSpecific(header->indexType) ? 0 : meshIndexTypeSize(header->indexType);
+        if(!Implementation::dataChunkCheckStridedRange(header->indexDataSize, header->indexOffset, header->indexCount, header->indexStride, indexTypeSize)) {
+            Error{} << messagePrefix << header->indexCount << "indices with a stride of" << header->indexStride << "at offset" << header->indexOffset << "out of range for" << header->indexDataSize << "bytes of index data";
+            return {};
+        }
+        indices = MeshIndexData{header->indexType, Containers::StridedArrayView1D<const void>{indexData, indexData.data() + (header->indexCount ? header->indexOffset : 0), header->indexCount, header->indexStride}};
+    }
+
+    const Containers::ArrayView<const MeshAttributeData> attributes{reinterpret_cast<const MeshAttributeData*>(chunk + sizeof(MeshDataChunkHeader)), header->attributeCount};
+    UnsignedInt jointIdAttributeCount = 0;
+    UnsignedInt weightAttributeCount = 0;
+    for(std::size_t i = 0; i != attributes.size(); ++i) {
+        const MeshAttributeData& attribute = attributes[i];
+        if(!attribute._isOffsetOnly) {
+            Error{} << messagePrefix << "attribute" << i << "is not offset-only";
+            return {};
+        }
+        if(attribute._format == VertexFormat{} || (!isVertexFormatImplementationSpecific(attribute._format) && UnsignedInt(attribute._format) > UnsignedInt(VertexFormat::Vector4ui1010102Normalized))) {
+            Error{} << messagePrefix << "invalid format" << attribute._format << "of attribute" << i;
+            return {};
+        }
+        if(attribute._vertexCount != header->vertexCount) {
+            Error{} << messagePrefix << "attribute" << i << "has" << attribute._vertexCount << "vertices but" << header->vertexCount << "expected";
+            return {};
+        }
+        if(attribute._morphTargetId < -1) {
+            Error{} << messagePrefix << "invalid morph target ID" << Int(attribute._morphTargetId) << "of attribute" << i;
+            return {};
+        }
+        const std::size_t typeSize =
+            isVertexFormatImplementationSpecific(attribute._format) ? 0 :
+            std::size_t(vertexFormatSize(attribute._format))*
+            (attribute._arraySize ? attribute._arraySize : 1);
+        if(!Implementation::dataChunkCheckStridedRange(header->vertexDataSize, attribute._data.offset, header->vertexCount, attribute._stride, typeSize)) {
+            Error{} << messagePrefix << "attribute" << i << "of" << header->vertexCount << "vertices with" << attribute._format << Debug::nospace << "[" << Debug::nospace << attribute._arraySize << Debug::nospace << "] and a stride of" << attribute._stride << "at offset" << attribute._data.offset << "out of range for" << header->vertexDataSize << "bytes of vertex data";
+            return {};
+        }
+
+        if(attribute._morphTargetId != -1) continue;
+        if(attribute._name == MeshAttribute::JointIds)
+            ++jointIdAttributeCount;
+        else if(attribute._name == MeshAttribute::Weights)
+            ++weightAttributeCount;
+    }
+
+    /* Joint IDs and weights have to be paired, the array sizes are checked
+       in the MeshData constructor only once the counts are known to match */
+    if(jointIdAttributeCount != weightAttributeCount) {
+        Error{} << messagePrefix << "expected" << jointIdAttributeCount << "weight attributes to match joint IDs but got" << weightAttributeCount;
+        return {};
+    }
+    for(UnsignedInt i = 0, jointIds = 0, weights = 0; i != jointIdAttributeCount; ++i) {
+        while(attributes[jointIds]._name != MeshAttribute::JointIds || attributes[jointIds]._morphTargetId != -1) ++jointIds;
+        while(attributes[weights]._name != MeshAttribute::Weights || attributes[weights]._morphTargetId != -1) ++weights;
+        if(attributes[jointIds]._arraySize != attributes[weights]._arraySize) {
+            Error{} << messagePrefix << "expected" << attributes[jointIds]._arraySize << "array items for weight attribute" << i << "to match joint IDs but got" << attributes[weights]._arraySize;
+            return {};
+        }
+        ++jointIds;
+        ++weights;
+    }
+
+    return MeshData{header->primitive,
+        dataFlags, indexData, indices,
+        dataFlags, vertexData, meshAttributeDataNonOwningArray(attributes),
+        header->vertexCount};
+}
+
 Debug& operator<<(Debug& debug, const MeshAttribute value) {
     const bool packed = debug.immediateFlags() >= Debug::Flag::Packed;
 
@@ -92,11 +92,13 @@ enum class MeshAttribute: UnsignedShort {
     /**
      * Tangent, optionally including bitangent sign. In the first case the type
      * is usually @ref VertexFormat::Vector3, but can be also
-     * @ref VertexFormat::Vector3h, @ref VertexFormat::Vector3bNormalized or
-     * @ref VertexFormat::Vector3sNormalized; in the second case the type is
-     * @ref VertexFormat::Vector4 (or @ref VertexFormat::Vector4h,
+     * @ref VertexFormat::Vector3h, @ref VertexFormat::Vector3bNormalized,
+     * @ref VertexFormat::Vector3sNormalized or
+     * @ref VertexFormat::Vector3i1010102Normalized; in the second case the
+     * type is @ref VertexFormat::Vector4 (or @ref VertexFormat::Vector4h,
      * @ref VertexFormat::Vector4bNormalized,
-     * @ref VertexFormat::Vector4sNormalized) and the fourth component is a
+     * @ref VertexFormat::Vector4sNormalized,
+     * @ref VertexFormat::Vector4i1010102Normalized) and the fourth component is a
      * sign value (@cpp -1.0f @ce or @cpp +1.0f @ce) defining handedness of the
      * tangent basis. Reconstructing the @ref MeshAttribute::Bitangent can be
      * then done like this:
@@ -116,8 +118,9 @@ enum class MeshAttribute: UnsignedShort {
 
     /**
      * Bitangent. Type is usually @ref VertexFormat::Vector3, but can be also
-     * @ref VertexFormat::Vector3h, @ref VertexFormat::Vector3bNormalized or
-     * @ref VertexFormat::Vector3sNormalized. For better storage efficiency,
+     * @ref VertexFormat::Vector3h, @ref VertexFormat::Vector3bNormalized,
+     * @ref VertexFormat::Vector3sNormalized or
+     * @ref VertexFormat::Vector3i1010102Normalized. For better storage efficiency,
      * the bitangent can be also reconstructed from the normal and tangent, see
      * @ref MeshAttribute::Tangent for more information.
      *
@@ -132,8 +135,9 @@ enum class MeshAttribute: UnsignedShort {
 
     /**
      * Normal. Type is usually @ref VertexFormat::Vector3, but can be also
-     * @ref VertexFormat::Vector3h, @ref VertexFormat::Vector3bNormalized or
-     * @ref VertexFormat::Vector3sNormalized. Corresponds to
+     * @ref VertexFormat::Vector3h, @ref VertexFormat::Vector3bNormalized,
+     * @ref VertexFormat::Vector3sNormalized or
+     * @ref VertexFormat::Vector3i1010102Normalized. Corresponds to
      * @ref Shaders::GenericGL::Normal.
      * @see @ref MeshData::normalsAsArray()
      */
@@ -157,8 +161,9 @@ enum class MeshAttribute: UnsignedShort {
      * @ref VertexFormat::Vector3h, @ref VertexFormat::Vector4h,
      * @ref VertexFormat::Vector3ubNormalized,
      * @ref VertexFormat::Vector3usNormalized,
-     * @ref VertexFormat::Vector4ubNormalized or
-     * @ref VertexFormat::Vector4usNormalized. Corresponds to
+     * @ref VertexFormat::Vector4ubNormalized,
+     * @ref VertexFormat::Vector4usNormalized or
+     * @ref VertexFormat::Vector4ui1010102Normalized. Corresponds to
      * @ref Shaders::GenericGL::Color3 or @ref Shaders::GenericGL::Color4.
      * @see @ref MeshData::colorsAsArray()
      */
@@ -2240,6 +2245,71 @@ class MAGNUM_TRADE_EXPORT MeshData {
          */
         Containers::Array<char> releaseVertexData();
 
+        /**
+         * @brief Size of the serialized mesh
+         * @m_since_latest
+         *
+         * Size of the data chunk produced by @ref serialize() and
+         * @ref serializeInto(), including the @ref DataChunkHeader. Always a
+         * multiple of 8 bytes.
+         */
+        std::size_t serializedSize() const;
+
+        /**
+         * @brief Serialize the mesh into an existing memory
+         * @m_since_latest
+         *
+         * Expects that @p out is 8-byte aligned and exactly
+         * @ref serializedSize() bytes large. Index and vertex data are copied
+         * as-is, attributes are stored as offset-only. Returns
+         * @ref serializedSize(). The @ref importerState() isn't serialized.
+         * @see @ref deserialize(), @ref DataChunkType::Mesh
+         */
+        std::size_t serializeInto(Containers::ArrayView<char> out) const;
+
+        /**
+         * @brief Serialize the mesh
+         * @m_since_latest
+         *
+         * Allocates an array of @ref serializedSize() bytes and calls
+         * @ref serializeInto() on it.
+         */
+        Containers::Array<char> serialize() const;
+
+        /**
+         * @brief Deserialize a mesh
+         * @m_since_latest
+         *
+         * Expects that @p data is 8-byte aligned and starts with a valid
+         * @ref DataChunkType::Mesh chunk produced by @ref serialize() on a
+         * platform with a matching @ref DataChunkSignature. Data past
+         * @ref DataChunkHeader::size are ignored. On failure prints a message
+         * to @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt}.
+         *
+         * Nothing is copied --- the returned instance references index,
+         * vertex and attribute data in @p data, which is thus expected to
+         * stay in scope for as long as the instance is used, and both
+         * @ref indexDataFlags() and @ref vertexDataFlags() are set to
+         * @p dataFlags. Index type, attribute formats and the ranges of all
+         * indices and attributes are validated against the data sizes so a
+         * corrupted chunk results in an error instead of an assertion or an
+         * out-of-bounds access. The actual index and attribute values are
+         * not validated.
+         *
+         * Passing @ref DataFlag::Mutable in @p dataFlags allows the mesh to
+         * be modified in-place, for example with
+         * @ref MeshTools::transform3DInPlace(). Together with
+         * @relativeref{Corrade,Utility::Path::map()} this can be used to
+         * process meshes larger than available memory, as the operating
+         * system then pages the data in and out as needed:
+         *
+         * @snippet Trade.cpp MeshData-deserialize-mapped
+         *
+         * The @p dataFlags are expected to not contain @ref DataFlag::Owned.
+         */
+        static Containers::Optional<MeshData> deserialize(Containers::ArrayView<const void> data, DataFlags dataFlags = {});
+
         /**
          * @brief Importer-specific state
          *
@@ -2531,12 +2601,15 @@ namespace Implementation {
                  format == VertexFormat::Vector4 ||
                  format == VertexFormat::Vector4h ||
                  format == VertexFormat::Vector4bNormalized ||
-                 format == VertexFormat::Vector4sNormalized)) ||
+                 format == VertexFormat::Vector4sNormalized ||
+                 format == VertexFormat::Vector3i1010102Normalized ||
+                 format == VertexFormat::Vector4i1010102Normalized)) ||
             ((name == MeshAttribute::Bitangent || name == MeshAttribute::Normal) &&
                 (format == VertexFormat::Vector3 ||
                  format == VertexFormat::Vector3h ||
                  format == VertexFormat::Vector3bNormalized ||
-                 format == VertexFormat::Vector3sNormalized)) ||
+                 format == VertexFormat::Vector3sNormalized ||
+                 format == VertexFormat::Vector3i1010102Normalized)) ||
             (name == MeshAttribute::Color &&
                 (format == VertexFormat::Vector3 ||
                  format == VertexFormat::Vector3h ||
@@ -2545,7 +2618,8 @@ namespace Implementation {
                  format == VertexFormat::Vector4 ||
                  format == VertexFormat::Vector4h ||
                  format == VertexFormat::Vector4ubNormalized ||
-                 format == VertexFormat::Vector4usNormalized)) ||
+                 format == VertexFormat::Vector4usNormalized ||
+                 format == VertexFormat::Vector4ui1010102Normalized)) ||
             (name == MeshAttribute::TextureCoordinates &&
                 (format == VertexFormat::Vector2 ||
                  format == VertexFormat::Vector2h ||
@@ -27,6 +27,8 @@
 #include "SceneData.h"
 
 #include <algorithm> /* std::lower_bound() */
+#include <cstring>
+#include <new>
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
@@ -46,6 +48,7 @@
 #include "Magnum/Math/PackingBatch.h"
 #include "Magnum/Trade/Implementation/arrayUtilities.h"
 #include "Magnum/Trade/Implementation/checkSharedSceneFieldMapping.h"
+#include "Magnum/Trade/Implementation/dataChunk.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 #include <vector>
@@ -2904,6 +2907,236 @@ std::vector<UnsignedInt> SceneData::children3D() const {
 }
 #endif
 
+namespace {
+
+/* Followed by fieldCount offset-only SceneFieldData and then the data at the
+   offset stored in the header, relative to the chunk start */
+struct SceneDataChunkHeader: DataChunkHeader {
+    UnsignedLong mappingBound;
+    SceneMappingType mappingType;
+    /* 3 bytes padding */
+    UnsignedInt fieldCount;
+    std::size_t dataOffset;
+    std::size_t dataSize;
+};
+
+static_assert(sizeof(SceneDataChunkHeader) % 8 == 0, "improper scene chunk header padding");
+
+}
+
+std::size_t SceneData::serializedSize() const {
+    return sizeof(SceneDataChunkHeader) +
+        Implementation::dataChunkAlign(_fields.size()*sizeof(SceneFieldData)) +
+        Implementation::dataChunkAlign(_data.size());
+}
+
+std::size_t SceneData::serializeInto(const Containers::ArrayView<char> out) const {
+    const std::size_t size = serializedSize();
+    CORRADE_ASSERT(reinterpret_cast<std::uintptr_t>(out.data()) % 8 == 0,
+        "Trade::SceneData::serializeInto(): data not aligned to 8 bytes", {});
+    CORRADE_ASSERT(out.size() == size,
+        "Trade::SceneData::serializeInto(): expected a view of" << size << "bytes but got" << out.size(), {});
+
+    /* Zero-initialize the header first so the padding is deterministic */
+    std::memset(out.data(), 0, sizeof(SceneDataChunkHeader));
+    SceneDataChunkHeader& header = *reinterpret_cast<SceneDataChunkHeader*>(out.data());
+    Implementation::dataChunkHeaderSerializeInto(header, DataChunkType::Scene, 0, size);
+    header.mappingBound = _mappingBound;
+    header.mappingType = _mappingType;
+    header.fieldCount = _fields.size();
+    header.dataOffset = sizeof(SceneDataChunkHeader) + Implementation::dataChunkAlign(_fields.size()*sizeof(SceneFieldData));
+    header.dataSize = _data.size();
+
+    /* Convert all fields to offset-only so they don't need any patching on
+       deserialization */
+    SceneFieldData* const fields = reinterpret_cast<SceneFieldData*>(out.data() + sizeof(SceneDataChunkHeader));
+    for(std::size_t i = 0; i != _fields.size(); ++i) {
+        SceneFieldData field = _fields[i];
+        if(!(field._flags & SceneFieldFlag::OffsetOnly)) {
+            const std::size_t fieldOffset = static_cast<const char*>(field._fieldData.pointer) - _data.data();
+            field._mappingData = SceneFieldData::Data{std::size_t(static_cast<const char*>(field._mappingData.pointer) - _data.data())};
+            field._fieldData = SceneFieldData::Data{fieldOffset};
+            /* String data offset is relative to the field pointer for
+               non-offset-only fields but absolute for offset-only */
+            if(field._mappingTypeStringType & Implementation::SceneMappingStringTypeMask)
+                field._field = SceneFieldData::Field{field._field.data.stride, extractStringFieldOffset(field._field.strideOffset) + Long(fieldOffset)};
+            field._flags |= SceneFieldFlag::OffsetOnly;
+        }
+        new(fields + i) SceneFieldData{field};
+    }
+
+    Utility::copy(_data, out.sliceSize(header.dataOffset, _data.size()));
+
+    /* Zero the padding as well */
+    const std::size_t fieldEnd = sizeof(SceneDataChunkHeader) + _fields.size()*sizeof(SceneFieldData);
+    std::memset(out.data() + fieldEnd, 0, header.dataOffset - fieldEnd);
+    std::memset(out.data() + header.dataOffset + _data.size(), 0, size - header.dataOffset - _data.size());
+
+    return size;
+}
+
+Containers::Array<char> SceneData::serialize() const {
+    /* NoInit arrays are allocated with new[], which is guaranteed to be
+       aligned for any fundamental type */
+    Containers::Array<char> out{NoInit, serializedSize()};
+    serializeInto(out);
+    return out;
+}
+
+Containers::Optional<SceneData> SceneData::deserialize(const Containers::ArrayView<const void> data) {
+    const char* const messagePrefix = "Trade::SceneData::deserialize():";
+    const SceneDataChunkHeader* const header = Implementation::dataChunkDeserialize<SceneDataChunkHeader>(data, DataChunkType::Scene, 0, messagePrefix);
+    if(!header) return {};
+
+    if(!Implementation::dataChunkCheckArrayRange(*header, sizeof(SceneDataChunkHeader), header->fieldCount, sizeof(SceneFieldData), "field data", messagePrefix) ||
+       !Implementation::dataChunkCheckRange(*header, header->dataOffset, header->dataSize, "data", messagePrefix))
+        return {};
+
+    /* The SceneData constructor would only assert on the checks below, which
+       isn't desirable for data coming from a file */
+    if(UnsignedInt(header->mappingType) - 1 > UnsignedInt(SceneMappingType::UnsignedLong) - 1) {
+        Error{} << messagePrefix << "invalid mapping type" << header->mappingType;
+        return {};
+    }
+    const UnsignedInt mappingTypeSize = sceneMappingTypeSize(header->mappingType);
+    if(mappingTypeSize < 8 && header->mappingBound > (1ull << mappingTypeSize*8) - 1) {
+        Error{} << messagePrefix << header->mappingType << "is too small for" << header->mappingBound << "objects";
+        return {};
+    }
+
+    const char* const chunk = static_cast<const char*>(data.data());
+    const Containers::ArrayView<const SceneFieldData> fields{reinterpret_cast<const SceneFieldData*>(chunk + sizeof(SceneDataChunkHeader)), header->fieldCount};
+    Math::BitVector<12> fieldsPresent; /** @todo some constant for this */
+    UnsignedInt dimensions = 0;
+    for(std::size_t i = 0; i != fields.size(); ++i) {
+        const SceneFieldData& field = fields[i];
+        if(!(field._flags & SceneFieldFlag::OffsetOnly)) {
+            Error{} << messagePrefix << "field" << i << "is not offset-only";
+            return {};
+        }
+        if(field.mappingType() != header->mappingType) {
+            Error{} << messagePrefix << "inconsistent mapping type, got" << field.mappingType() << "for field" << i << "but expected" << header->mappingType;
+            return {};
+        }
+
+        if(!isSceneFieldCustom(field._name)) {
+            if(field._name == SceneField{} || UnsignedInt(field._name) >= fieldsPresent.Size) {
+                Error{} << messagePrefix << "invalid name" << field._name << "of field" << i;
+                return {};
+            }
+            if(fieldsPresent[UnsignedInt(field._name)]) {
+                Error{} << messagePrefix << "duplicate field" << field._name;
+                return {};
+            }
+            fieldsPresent.set(UnsignedInt(field._name), true);
+        } else for(std::size_t j = 0; j != i; ++j) {
+            if(fields[j]._name == field._name) {
+                Error{} << messagePrefix << "duplicate field" << field._name;
+                return {};
+            }
+        }
+
+        /* String types are stored in the upper bits of the mapping type,
+           everything else in the field itself and has to be outside of the
+           range reserved for string types */
+        const bool isStringField = field._mappingTypeStringType & Implementation::SceneMappingStringTypeMask;
+        const SceneFieldType fieldType = field.fieldType();
+        if(isStringField ? UnsignedInt(fieldType) > UnsignedInt(SceneFieldType::StringRangeNullTerminated64) :
+           (UnsignedInt(fieldType) < UnsignedInt(SceneFieldType::Bit) || UnsignedInt(fieldType) > UnsignedInt(SceneFieldType::MutablePointer))) {
+            Error{} << messagePrefix << "invalid type" << fieldType << "of field" << i;
+            return {};
+        }
+        if(!Implementation::isSceneFieldTypeCompatibleWithField(field._name, fieldType)) {
+            Error{} << messagePrefix << fieldType << "is not a valid type for" << field._name;
+            return {};
+        }
+        if(field.fieldArraySize() && !Implementation::isSceneFieldArrayAllowed(field._name)) {
+            Error{} << messagePrefix << field._name << "can't be an array field";
+            return {};
+        }
+
+        /* Sizes, strides and array sizes are in bits for SceneFieldType::Bit,
+           additionally bit fields contain also bit offset in the first byte.
+           For those the range is checked in bits, relative to the field data
+           offset. */
+        const bool isBitField = fieldType == SceneFieldType::Bit;
+        const UnsignedShort fieldArraySize = field.fieldArraySize();
+        const std::size_t fieldTypeSize = (isBitField ? 1 : sceneFieldTypeSize(fieldType))*(fieldArraySize ? fieldArraySize : 1);
+        if(!Implementation::dataChunkCheckStridedRange(header->dataSize, field._mappingData.offset, field._size, field._mappingStride, mappingTypeSize)) {
+            Error{} << messagePrefix << "mapping data of field" << i << "with" << field._size << "entries and a stride of" << field._mappingStride << "at offset" << field._mappingData.offset << "out of range for" << header->dataSize << "bytes of data";
+            return {};
+        }
+        if(isBitField ? (field._fieldData.offset > header->dataSize || !Implementation::dataChunkCheckStridedRange(UnsignedLong(header->dataSize - field._fieldData.offset)*8, field._field.data.bitOffset, field._size, field._field.data.stride, fieldTypeSize)) : !Implementation::dataChunkCheckStridedRange(header->dataSize, field._fieldData.offset, field._size, field._field.data.stride, fieldTypeSize)) {
+            Error{} << messagePrefix << "field data of field" << i << "with" << field._size << "entries of" << fieldType << Debug::nospace << "[" << Debug::nospace << fieldArraySize << Debug::nospace << "] and a stride of" << field._field.data.stride << "at offset" << field._fieldData.offset << "out of range for" << header->dataSize << "bytes of data";
+            return {};
+        }
+
+        /* Not checking the offsets and sizes inside string fields, as that'd
+           be prohibitively expensive, same as in the constructor */
+        if(isStringField) {
+            const Long stringDataOffset = extractStringFieldOffset(field._field.strideOffset);
+            if(stringDataOffset < 0 || UnsignedLong(stringDataOffset) > header->dataSize) {
+                Error{} << messagePrefix << "string data offset" << stringDataOffset << "of field" << i << "out of range for" << header->dataSize << "bytes of data";
+                return {};
+            }
+        }
+
+        /* Transformation fields have to agree on the dimension count, a skin
+           needs at least one of them to be present */
+        UnsignedInt fieldDimensions = 0;
+        if(field._name == SceneField::Transformation ||
+           field._name == SceneField::Translation ||
+           field._name == SceneField::Rotation ||
+           field._name == SceneField::Scaling)
+            fieldDimensions =
+                fieldType == SceneFieldType::Matrix3x3 ||
+                fieldType == SceneFieldType::Matrix3x3d ||
+                fieldType == SceneFieldType::Matrix3x2 ||
+                fieldType == SceneFieldType::Matrix3x2d ||
+                fieldType == SceneFieldType::DualComplex ||
+                fieldType == SceneFieldType::DualComplexd ||
+                fieldType == SceneFieldType::Vector2 ||
+                fieldType == SceneFieldType::Vector2d ||
+                fieldType == SceneFieldType::Complex ||
+                fieldType == SceneFieldType::Complexd ? 2 : 3;
+        if(fieldDimensions) {
+            if(dimensions && dimensions != fieldDimensions) {
+                Error{} << messagePrefix << "expected a" << dimensions << Debug::nospace << "D" << field._name << "field but got" << fieldType;
+                return {};
+            }
+            dimensions = fieldDimensions;
+        }
+    }
+
+    if(fieldsPresent[UnsignedInt(SceneField::Skin)] && !dimensions) {
+        Error{} << messagePrefix << "a skin field requires some transformation field to be present in order to disambiguate between 2D and 3D";
+        return {};
+    }
+
+    /* Fields that are required to share the object mapping have to have the
+       same mapping view */
+    const Implementation::SharedSceneFieldIds sharedFields = Implementation::findSharedSceneFields(fields);
+    for(const Containers::ArrayView<const UnsignedInt> fieldIds: {
+        Containers::arrayView(sharedFields.trs),
+        Containers::arrayView(sharedFields.meshMaterial)
+    }) {
+        for(const UnsignedInt fieldId: fieldIds) {
+            if(fieldId == ~UnsignedInt{}) break;
+
+            const SceneFieldData& a = fields[fieldIds[0]];
+            const SceneFieldData& b = fields[fieldId];
+            if(a._mappingData.offset != b._mappingData.offset || a._size != b._size || a._mappingStride != b._mappingStride) {
+                Error{} << messagePrefix << b._name << "mapping data are different from" << a._name << "mapping data";
+                return {};
+            }
+        }
+    }
+
+    return SceneData{header->mappingType, header->mappingBound,
+        DataFlags{}, Containers::ArrayView<const char>{chunk + header->dataOffset, header->dataSize},
+        sceneFieldDataNonOwningArray(fields)};
+}
+
 Containers::Array<SceneFieldData> SceneData::releaseFieldData() {
     Containers::Array<SceneFieldData> out = Utility::move(_fields);
     _fields = {};
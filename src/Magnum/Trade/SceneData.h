@@ -3721,6 +3721,59 @@ class MAGNUM_TRADE_EXPORT SceneData {
          */
         Containers::Array<char> releaseData();
 
+        /**
+         * @brief Size of the serialized scene
+         * @m_since_latest
+         *
+         * Size of the data chunk produced by @ref serialize() and
+         * @ref serializeInto(), including the @ref DataChunkHeader. Always a
+         * multiple of 8 bytes.
+         */
+        std::size_t serializedSize() const;
+
+        /**
+         * @brief Serialize the scene into an existing memory
+         * @m_since_latest
+         *
+         * Expects that @p out is 8-byte aligned and exactly
+         * @ref serializedSize() bytes large. The data are copied as-is,
+         * fields are stored with @ref SceneFieldFlag::OffsetOnly set. Returns
+         * @ref serializedSize(). The @ref importerState() isn't serialized.
+         * @see @ref deserialize(), @ref DataChunkType::Scene
+         */
+        std::size_t serializeInto(Containers::ArrayView<char> out) const;
+
+        /**
+         * @brief Serialize the scene
+         * @m_since_latest
+         *
+         * Allocates an array of @ref serializedSize() bytes and calls
+         * @ref serializeInto() on it.
+         */
+        Containers::Array<char> serialize() const;
+
+        /**
+         * @brief Deserialize a scene
+         * @m_since_latest
+         *
+         * Expects that @p data is 8-byte aligned and starts with a valid
+         * @ref DataChunkType::Scene chunk produced by @ref serialize() on a
+         * platform with a matching @ref DataChunkSignature. Data past
+         * @ref DataChunkHeader::size are ignored. On failure prints a message
+         * to @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt}.
+         *
+         * Nothing is copied --- the returned instance references field
+         * metadata and data in @p data, which is thus expected to stay in
+         * scope for as long as the instance is used, and @ref dataFlags() are
+         * empty. Mapping and field types and the ranges of all fields are
+         * validated against the data size so a corrupted chunk results in an
+         * error instead of an assertion or an out-of-bounds access. The
+         * actual field values, such as string offsets or object IDs, are not
+         * validated.
+         */
+        static Containers::Optional<SceneData> deserialize(Containers::ArrayView<const void> data);
+
         /**
          * @brief Importer-specific state
          *
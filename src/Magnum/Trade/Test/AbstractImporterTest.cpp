@@ -36,6 +36,7 @@
 #include <Corrade/Utility/DebugStl.h>
 #include <Corrade/Utility/Path.h>
 
+#include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/FileCallback.h"
 #include "Magnum/Math/Matrix3.h"
@@ -90,6 +91,7 @@ struct AbstractImporterTest: TestSuite::Tester {
     void openFile();
     void openFileFailed();
     void openFileAsData();
+    void openFileAsDataZeroCopy();
     void openFileAsDataNotFound();
     void openState();
     void openStateFailed();
@@ -113,6 +115,10 @@ struct AbstractImporterTest: TestSuite::Tester {
     void setFileCallbackOpenFileAsData();
     void setFileCallbackOpenFileAsDataFailed();
 
+    void setAllocator();
+    void allocateDataNoAllocator();
+    void allocateDataFailed();
+
     void thingCountNotImplemented();
     void thingCountNoFile();
     void thingForNameNotImplemented();
@@ -357,6 +363,21 @@ struct AbstractImporterTest: TestSuite::Tester {
     void image2DNonOwningDeleter();
     void image2DGrowableDeleter();
     void image2DCustomDeleter();
+    void image2DLayout();
+    void image2DLayoutCompressed();
+    void image2DInto();
+    void image2DIntoCompressed();
+    void image2DIntoWrongFormat();
+    void image2DLayoutIntoOutOfRange();
+    void image2DIntoNoData();
+    void image2DLevels();
+    void image2DLevelsFailed();
+    void image2DLevelsImplementation();
+    void image2DLevelsOutOfRange();
+    void image2DLevelsNoCallback();
+    void image2DLevelsImplementationWrongLevel();
+    void image2DLevelsImplementationMissingLevels();
+    void image2DLevelsCustomDeleter();
 
     void image3D();
     void image3DFailed();
@@ -414,6 +435,7 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::openFile,
               &AbstractImporterTest::openFileFailed,
               &AbstractImporterTest::openFileAsData,
+              &AbstractImporterTest::openFileAsDataZeroCopy,
               &AbstractImporterTest::openFileAsDataNotFound,
               &AbstractImporterTest::openState,
               &AbstractImporterTest::openStateFailed,
@@ -437,6 +459,10 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::setFileCallbackOpenFileAsData,
               &AbstractImporterTest::setFileCallbackOpenFileAsDataFailed,
 
+              &AbstractImporterTest::setAllocator,
+              &AbstractImporterTest::allocateDataNoAllocator,
+              &AbstractImporterTest::allocateDataFailed,
+
               &AbstractImporterTest::thingCountNotImplemented,
               &AbstractImporterTest::thingCountNoFile,
               &AbstractImporterTest::thingForNameNotImplemented,
@@ -690,6 +716,21 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::image2DNonOwningDeleter,
               &AbstractImporterTest::image2DGrowableDeleter,
               &AbstractImporterTest::image2DCustomDeleter,
+              &AbstractImporterTest::image2DLayout,
+              &AbstractImporterTest::image2DLayoutCompressed,
+              &AbstractImporterTest::image2DInto,
+              &AbstractImporterTest::image2DIntoCompressed,
+              &AbstractImporterTest::image2DIntoWrongFormat,
+              &AbstractImporterTest::image2DLayoutIntoOutOfRange,
+              &AbstractImporterTest::image2DIntoNoData,
+              &AbstractImporterTest::image2DLevels,
+              &AbstractImporterTest::image2DLevelsFailed,
+              &AbstractImporterTest::image2DLevelsImplementation,
+              &AbstractImporterTest::image2DLevelsOutOfRange,
+              &AbstractImporterTest::image2DLevelsNoCallback,
+              &AbstractImporterTest::image2DLevelsImplementationWrongLevel,
+              &AbstractImporterTest::image2DLevelsImplementationMissingLevels,
+              &AbstractImporterTest::image2DLevelsCustomDeleter,
 
               &AbstractImporterTest::image3D,
               &AbstractImporterTest::image3DFailed,
@@ -994,6 +1035,45 @@ void AbstractImporterTest::openFileAsData() {
     CORRADE_VERIFY(!importer.isOpened());
 }
 
+void AbstractImporterTest::openFileAsDataZeroCopy() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return !!_in; }
+        void doClose() override { _in = nullptr; }
+
+        void doOpenData(Containers::Array<char>&& data, DataFlags dataFlags) override {
+            CORRADE_COMPARE_AS(data,
+                Containers::arrayView({'\xa5'}),
+                TestSuite::Compare::Container);
+            #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+            /* The file is mapped, so it's just a view */
+            CORRADE_COMPARE(dataFlags, DataFlag::ExternallyOwned);
+            CORRADE_VERIFY(data.deleter());
+            #else
+            CORRADE_COMPARE(dataFlags, DataFlag::Owned|DataFlag::Mutable);
+            #endif
+            _in = Utility::move(data);
+        }
+
+        Containers::Array<char> _in;
+    } importer;
+    importer.setFlags(ImporterFlag::ZeroCopy);
+
+    CORRADE_VERIFY(importer.openFile(Utility::Path::join(TRADE_TEST_DIR, "file.bin")));
+    CORRADE_VERIFY(importer.isOpened());
+
+    /* Opening the file again releases the previous mapping and creates a new
+       one */
+    CORRADE_VERIFY(importer.openFile(Utility::Path::join(TRADE_TEST_DIR, "file.bin")));
+    CORRADE_VERIFY(importer.isOpened());
+    CORRADE_COMPARE_AS(importer._in,
+        Containers::arrayView({'\xa5'}),
+        TestSuite::Compare::Container);
+
+    importer.close();
+    CORRADE_VERIFY(!importer.isOpened());
+}
+
 void AbstractImporterTest::openFileAsDataNotFound() {
     struct Importer: AbstractImporter {
         ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
@@ -1477,6 +1557,103 @@ void AbstractImporterTest::setFileCallbackOpenFileAsDataFailed() {
     CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::openFile(): cannot open file file.dat\n");
 }
 
+void AbstractImporterTest::setAllocator() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            Containers::Array<char> data = allocateData(24, 4);
+            if(!data) return {};
+            data[0] = 'a';
+            if(allocator())
+                return ImageData2D{PixelFormat::RGBA8Unorm, {3, 2}, DataFlag::Mutable, data};
+            return ImageData2D{PixelFormat::RGBA8Unorm, {3, 2}, Utility::move(data)};
+        }
+    } importer;
+
+    struct State {
+        alignas(4) char data[32];
+        std::size_t size, alignment;
+    } state{};
+
+    auto allocator = [](std::size_t size, std::size_t alignment, void* userData) -> void* {
+        State& state = *static_cast<State*>(userData);
+        state.size = size;
+        state.alignment = alignment;
+        return state.data;
+    };
+
+    CORRADE_VERIFY(!importer.allocator());
+    CORRADE_VERIFY(!importer.allocatorUserData());
+
+    /* Can be set even with a file opened */
+    importer.setAllocator(allocator, &state);
+    CORRADE_VERIFY(importer.allocator());
+    CORRADE_COMPARE(importer.allocatorUserData(), &state);
+
+    /* The non-owning deleter used for allocator-provided memory passes the
+       image2D() deleter check */
+    Containers::Optional<ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(state.size, 24);
+    CORRADE_COMPARE(state.alignment, 4);
+    CORRADE_COMPARE(image->dataFlags(), DataFlag::Mutable);
+    CORRADE_COMPARE(image->data().data(), state.data);
+    CORRADE_COMPARE(state.data[0], 'a');
+
+    /* Resetting goes back to owned heap allocations */
+    importer.setAllocator(nullptr);
+    CORRADE_VERIFY(!importer.allocator());
+    CORRADE_VERIFY(!importer.allocatorUserData());
+    image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_VERIFY(image->data().data() != state.data);
+}
+
+void AbstractImporterTest::allocateDataNoAllocator() {
+    struct Importer: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+
+        using AbstractImporter::allocateData;
+    } importer;
+
+    Containers::Array<char> data = importer.allocateData(17, 4);
+    CORRADE_COMPARE(data.size(), 17);
+    CORRADE_VERIFY(!data.deleter());
+}
+
+void AbstractImporterTest::allocateDataFailed() {
+    struct Importer: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+
+        using AbstractImporter::allocateData;
+    } importer;
+
+    int called = 0;
+    importer.setAllocator([](std::size_t, std::size_t, void* userData) -> void* {
+        ++*static_cast<int*>(userData);
+        return nullptr;
+    }, &called);
+
+    /* Empty allocations don't reach the allocator */
+    CORRADE_VERIFY(!importer.allocateData(0, 4));
+    CORRADE_COMPARE(called, 0);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer.allocateData(17, 4));
+    CORRADE_COMPARE(called, 1);
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::allocateData(): allocator failed to provide 17 bytes\n");
+}
+
 void AbstractImporterTest::thingCountNotImplemented() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override { return {}; }
@@ -1783,6 +1960,10 @@ void AbstractImporterTest::thingNoFile() {
     importer.image1D("foo");
     importer.image2D(42);
     importer.image2D("foo");
+    importer.image2DLayout(42);
+    importer.image2DInto(42, MutableImageView2D{PixelFormat::R8Unorm, {}});
+    importer.image2DLevels(42, 0, 1, [](UnsignedInt, ImageData2D&&, void*) {});
+    importer.image2DLevels(42, [](UnsignedInt, ImageData2D&&, void*) {});
     importer.image3D(42);
     importer.image3D("foo");
 
@@ -1815,6 +1996,10 @@ void AbstractImporterTest::thingNoFile() {
         "Trade::AbstractImporter::image1D(): no file opened\n"
         "Trade::AbstractImporter::image2D(): no file opened\n"
         "Trade::AbstractImporter::image2D(): no file opened\n"
+        "Trade::AbstractImporter::image2DLayout(): no file opened\n"
+        "Trade::AbstractImporter::image2DInto(): no file opened\n"
+        "Trade::AbstractImporter::image2DLevels(): no file opened\n"
+        "Trade::AbstractImporter::image2DLevels(): no file opened\n"
         "Trade::AbstractImporter::image3D(): no file opened\n"
         "Trade::AbstractImporter::image3D(): no file opened\n"
 
@@ -7433,6 +7618,387 @@ void AbstractImporterTest::image2DCustomDeleter() {
         "Trade::AbstractImporter::image2D(): implementation is not allowed to use a custom Array deleter\n");
 }
 
+void AbstractImporterTest::image2DLayout() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 8; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 3; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level) override {
+            if(id == 7 && level == 2) return ImageData2D{PixelStorage{}.setAlignment(1), PixelFormat::RG8Unorm, {3, 2}, Containers::Array<char>{ValueInit, 12}, ImageFlag2D::Array};
+            return {};
+        }
+    } importer;
+
+    /* The default implementation delegates to doImage2D() and discards the
+       data */
+    Containers::Optional<ImageView2D> layout = importer.image2DLayout(7, 2);
+    CORRADE_VERIFY(layout);
+    CORRADE_COMPARE(layout->storage().alignment(), 1);
+    CORRADE_COMPARE(layout->format(), PixelFormat::RG8Unorm);
+    CORRADE_COMPARE(layout->size(), (Vector2i{3, 2}));
+    CORRADE_COMPARE(layout->flags(), ImageFlag2D::Array);
+    CORRADE_VERIFY(!layout->data().data());
+
+    /* Failure is propagated */
+    CORRADE_VERIFY(!importer.image2DLayout(7, 1));
+}
+
+void AbstractImporterTest::image2DLayoutCompressed() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            return ImageData2D{CompressedPixelFormat::Bc1RGBAUnorm, {4, 4}, Containers::Array<char>{ValueInit, 8}};
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer.image2DLayout(0));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::image2DLayout(): compressed images are not supported\n");
+}
+
+void AbstractImporterTest::image2DInto() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 8; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 3; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level) override {
+            if(id == 7 && level == 2) {
+                Containers::Array<char> data{NoInit, 6};
+                for(std::size_t i = 0; i != data.size(); ++i)
+                    data[i] = 'a' + i;
+                return ImageData2D{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, {3, 2}, Utility::move(data)};
+            }
+            return {};
+        }
+    } importer;
+
+    /* The default implementation delegates to doImage2D() and copies the
+       pixels, honoring the storage of the destination */
+    char out[8]{};
+    CORRADE_VERIFY(importer.image2DInto(7, MutableImageView2D{PixelFormat::R8Unorm, {3, 2}, out}, 2));
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView<char>({
+        'a', 'b', 'c', '\0',
+        'd', 'e', 'f', '\0'
+    }), TestSuite::Compare::Container);
+
+    /* Failure is propagated */
+    CORRADE_VERIFY(!importer.image2DInto(7, MutableImageView2D{PixelFormat::R8Unorm, {3, 2}, out}, 1));
+}
+
+void AbstractImporterTest::image2DIntoCompressed() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            return ImageData2D{CompressedPixelFormat::Bc1RGBAUnorm, {4, 4}, Containers::Array<char>{ValueInit, 8}};
+        }
+    } importer;
+
+    char data[64];
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer.image2DInto(0, MutableImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, data}));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::image2DInto(): compressed images are not supported\n");
+}
+
+void AbstractImporterTest::image2DIntoWrongFormat() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            return ImageData2D{PixelFormat::RG8Unorm, {2, 2}, Containers::Array<char>{ValueInit, 8}};
+        }
+    } importer;
+
+    char data[32];
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer.image2DInto(0, MutableImageView2D{PixelFormat::RGBA8Unorm, {2, 2}, data}));
+    CORRADE_VERIFY(!importer.image2DInto(0, MutableImageView2D{PixelFormat::RG8Unorm, {2, 1}, data}));
+    CORRADE_COMPARE(out.str(),
+        "Trade::AbstractImporter::image2DInto(): expected a PixelFormat::RG8Unorm image of size Vector(2, 2) but got PixelFormat::RGBA8Unorm and Vector(2, 2)\n"
+        "Trade::AbstractImporter::image2DInto(): expected a PixelFormat::RG8Unorm image of size Vector(2, 2) but got PixelFormat::RG8Unorm and Vector(2, 1)\n");
+}
+
+void AbstractImporterTest::image2DLayoutIntoOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 8; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 3; }
+    } importer;
+
+    char data[4];
+    std::ostringstream out;
+    Error redirectError{&out};
+    importer.image2DLayout(8);
+    importer.image2DLayout(7, 3);
+    importer.image2DInto(8, MutableImageView2D{PixelFormat::R8Unorm, {2, 2}, data});
+    importer.image2DInto(7, MutableImageView2D{PixelFormat::R8Unorm, {2, 2}, data}, 3);
+    CORRADE_COMPARE(out.str(),
+        "Trade::AbstractImporter::image2DLayout(): index 8 out of range for 8 entries\n"
+        "Trade::AbstractImporter::image2DLayout(): level 3 out of range for 3 entries\n"
+        "Trade::AbstractImporter::image2DInto(): index 8 out of range for 8 entries\n"
+        "Trade::AbstractImporter::image2DInto(): level 3 out of range for 3 entries\n");
+}
+
+void AbstractImporterTest::image2DIntoNoData() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    importer.image2DInto(0, MutableImageView2D{PixelFormat::R8Unorm, {2, 2}});
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::image2DInto(): the image has no data\n");
+}
+
+namespace {
+
+struct LevelsState {
+    UnsignedInt levels[4];
+    Int sizes[4];
+    std::size_t count;
+};
+
+void recordLevel(UnsignedInt level, ImageData2D&& image, void* state) {
+    LevelsState& levelsState = *static_cast<LevelsState*>(state);
+    levelsState.levels[levelsState.count] = level;
+    levelsState.sizes[levelsState.count] = image.size().x();
+    ++levelsState.count;
+}
+
+}
+
+void AbstractImporterTest::image2DLevels() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 8; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 4; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level) override {
+            if(id == 7) return ImageData2D{PixelFormat::R8Unorm, {8 >> level, 1}, Containers::Array<char>{ValueInit, std::size_t(8 >> level)}};
+            return {};
+        }
+    } importer;
+
+    /* The default implementation delegates to doImage2D() for each level,
+       going from the smallest */
+    {
+        LevelsState state{};
+        CORRADE_VERIFY(importer.image2DLevels(7, 1, 3, recordLevel, &state));
+        CORRADE_COMPARE(state.count, 2);
+        CORRADE_COMPARE_AS(Containers::arrayView(state.levels).prefix(2), Containers::arrayView<UnsignedInt>({
+            2, 1
+        }), TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(Containers::arrayView(state.sizes).prefix(2), Containers::arrayView<Int>({
+            2, 4
+        }), TestSuite::Compare::Container);
+    } {
+        LevelsState state{};
+        CORRADE_VERIFY(importer.image2DLevels(7, recordLevel, &state));
+        CORRADE_COMPARE(state.count, 4);
+        CORRADE_COMPARE_AS(Containers::arrayView(state.levels), Containers::arrayView<UnsignedInt>({
+            3, 2, 1, 0
+        }), TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(Containers::arrayView(state.sizes), Containers::arrayView<Int>({
+            1, 2, 4, 8
+        }), TestSuite::Compare::Container);
+    }
+}
+
+void AbstractImporterTest::image2DLevelsFailed() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 4; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt level) override {
+            if(level == 1) return {};
+            return ImageData2D{PixelFormat::R8Unorm, {8 >> level, 1}, Containers::Array<char>{ValueInit, std::size_t(8 >> level)}};
+        }
+    } importer;
+
+    /* Levels before the failure are delivered, the rest isn't attempted */
+    LevelsState state{};
+    CORRADE_VERIFY(!importer.image2DLevels(0, recordLevel, &state));
+    CORRADE_COMPARE(state.count, 2);
+    CORRADE_COMPARE_AS(Containers::arrayView(state.levels).prefix(2), Containers::arrayView<UnsignedInt>({
+        3, 2
+    }), TestSuite::Compare::Container);
+}
+
+void AbstractImporterTest::image2DLevelsImplementation() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 4; }
+        bool doImage2DLevels(UnsignedInt, UnsignedInt levelBegin, UnsignedInt levelEnd, void(*callback)(UnsignedInt, ImageData2D&&, void*), void* state) override {
+            for(UnsignedInt level = levelEnd; level-- > levelBegin; )
+                callback(level, ImageData2D{PixelFormat::R8Unorm, {16 >> level, 1}, Containers::Array<char>{ValueInit, std::size_t(16 >> level)}}, state);
+            return true;
+        }
+    } importer;
+
+    /* doImage2D() isn't called at all */
+    LevelsState state{};
+    CORRADE_VERIFY(importer.image2DLevels(0, 0, 2, recordLevel, &state));
+    CORRADE_COMPARE(state.count, 2);
+    CORRADE_COMPARE_AS(Containers::arrayView(state.levels).prefix(2), Containers::arrayView<UnsignedInt>({
+        1, 0
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayView(state.sizes).prefix(2), Containers::arrayView<Int>({
+        8, 16
+    }), TestSuite::Compare::Container);
+}
+
+void AbstractImporterTest::image2DLevelsOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 8; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 3; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    importer.image2DLevels(8, 0, 1, recordLevel);
+    importer.image2DLevels(8, recordLevel);
+    importer.image2DLevels(7, 2, 2, recordLevel);
+    importer.image2DLevels(7, 1, 4, recordLevel);
+    CORRADE_COMPARE(out.str(),
+        "Trade::AbstractImporter::image2DLevels(): index 8 out of range for 8 entries\n"
+        "Trade::AbstractImporter::image2DLevels(): index 8 out of range for 8 entries\n"
+        "Trade::AbstractImporter::image2DLevels(): invalid level range [2, 2) for 3 entries\n"
+        "Trade::AbstractImporter::image2DLevels(): invalid level range [1, 4) for 3 entries\n");
+}
+
+void AbstractImporterTest::image2DLevelsNoCallback() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    importer.image2DLevels(0, nullptr);
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::image2DLevels(): callback can't be null\n");
+}
+
+void AbstractImporterTest::image2DLevelsImplementationWrongLevel() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 3; }
+        bool doImage2DLevels(UnsignedInt, UnsignedInt levelBegin, UnsignedInt, void(*callback)(UnsignedInt, ImageData2D&&, void*), void* state) override {
+            /* Delivering the largest level first */
+            callback(levelBegin, ImageData2D{PixelFormat::R8Unorm, {}, Containers::Array<char>{}}, state);
+            return true;
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    importer.image2DLevels(0, 0, 2, recordLevel);
+    CORRADE_COMPARE_AS(out.str(),
+        "Trade::AbstractImporter::image2DLevels(): implementation delivered level 0 but expected 1\n",
+        TestSuite::Compare::StringHasPrefix);
+}
+
+void AbstractImporterTest::image2DLevelsImplementationMissingLevels() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 3; }
+        bool doImage2DLevels(UnsignedInt, UnsignedInt, UnsignedInt levelEnd, void(*callback)(UnsignedInt, ImageData2D&&, void*), void* state) override {
+            /* Delivering just the smallest level */
+            callback(levelEnd - 1, ImageData2D{PixelFormat::R8Unorm, {}, Containers::Array<char>{}}, state);
+            return true;
+        }
+    } importer;
+
+    LevelsState state{};
+    std::ostringstream out;
+    Error redirectError{&out};
+    importer.image2DLevels(0, 0, 3, recordLevel, &state);
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::image2DLevels(): implementation delivered only levels down to 2 but expected 0\n");
+}
+
+void AbstractImporterTest::image2DLevelsCustomDeleter() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            return ImageData2D{PixelFormat::RGBA8Unorm, {}, Containers::Array<char>{nullptr, 0, [](char*, std::size_t) {}}};
+        }
+    } importer;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    importer.image2DLevels(0, recordLevel);
+    CORRADE_COMPARE_AS(out.str(),
+        "Trade::AbstractImporter::image2DLevels(): implementation is not allowed to use a custom Array deleter\n",
+        TestSuite::Compare::StringHasPrefix);
+}
+
 void AbstractImporterTest::image3D() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override { return {}; }
@@ -7778,8 +8344,8 @@ void AbstractImporterTest::importerStateNoFile() {
 void AbstractImporterTest::debugFeature() {
     std::ostringstream out;
 
-    Debug{&out} << ImporterFeature::OpenData << ImporterFeature(0xf0);
-    CORRADE_COMPARE(out.str(), "Trade::ImporterFeature::OpenData Trade::ImporterFeature(0xf0)\n");
+    Debug{&out} << ImporterFeature::OpenData << ImporterFeature::ConcurrentImport << ImporterFeature(0xf0);
+    CORRADE_COMPARE(out.str(), "Trade::ImporterFeature::OpenData Trade::ImporterFeature::ConcurrentImport Trade::ImporterFeature(0xf0)\n");
 }
 
 void AbstractImporterTest::debugFeaturePacked() {
@@ -7806,8 +8372,8 @@ void AbstractImporterTest::debugFeaturesPacked() {
 void AbstractImporterTest::debugFlag() {
     std::ostringstream out;
 
-    Debug{&out} << ImporterFlag::Verbose << ImporterFlag(0xf0);
-    CORRADE_COMPARE(out.str(), "Trade::ImporterFlag::Verbose Trade::ImporterFlag(0xf0)\n");
+    Debug{&out} << ImporterFlag::Verbose << ImporterFlag::ZeroCopy << ImporterFlag(0xf0);
+    CORRADE_COMPARE(out.str(), "Trade::ImporterFlag::Verbose Trade::ImporterFlag::ZeroCopy Trade::ImporterFlag(0xf0)\n");
 }
 
 void AbstractImporterTest::debugFlags() {
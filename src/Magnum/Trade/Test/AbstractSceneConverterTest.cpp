@@ -25,7 +25,10 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once Debug is stream-free */
 #include <Corrade/Containers/Optional.h>
@@ -213,6 +216,22 @@ struct AbstractSceneConverterTest: TestSuite::Tester {
 
     void addMeshThroughLevels();
 
+    void setParallelFor();
+    void addMeshes();
+    void addMeshesFailed();
+    void addMeshesConcurrent();
+    void addMeshesConcurrentFailed();
+    void addMeshesConcurrentNotImplemented();
+    void addMeshesInvalidNames();
+
+    void updateFile();
+    void updateFileUnknownHashes();
+    void updateFileFailed();
+    void updateFileNotSupported();
+    void updateFileNotImplemented();
+    void updateFileNoUpdateInProgress();
+    void updateFileOutOfRange();
+
     void setMeshAttributeName();
     void setMeshAttributeNameNotImplemented();
     void setMeshAttributeNameNotCustom();
@@ -241,6 +260,11 @@ struct AbstractSceneConverterTest: TestSuite::Tester {
     void addImage2DZeroSize();
     void addImage2DNullptr();
     void addImage2DNotImplemented();
+    void addImages2D();
+    void addImages2DConcurrent();
+    void addImages2DConcurrentNotSupported();
+    void addImages2DConcurrentInvalidImage();
+    void addImages2DConcurrentNotImplemented();
 
     void addImage3D();
     void addImage3DView();
@@ -775,7 +799,23 @@ AbstractSceneConverterTest::AbstractSceneConverterTest() {
               &AbstractSceneConverterTest::addMeshLevelsNoLevels,
               &AbstractSceneConverterTest::addMeshLevelsNotImplemented,
 
-              &AbstractSceneConverterTest::addMeshThroughLevels});
+              &AbstractSceneConverterTest::addMeshThroughLevels,
+
+              &AbstractSceneConverterTest::setParallelFor,
+              &AbstractSceneConverterTest::addMeshes,
+              &AbstractSceneConverterTest::addMeshesFailed,
+              &AbstractSceneConverterTest::addMeshesConcurrent,
+              &AbstractSceneConverterTest::addMeshesConcurrentFailed,
+              &AbstractSceneConverterTest::addMeshesConcurrentNotImplemented,
+              &AbstractSceneConverterTest::addMeshesInvalidNames,
+
+              &AbstractSceneConverterTest::updateFile,
+              &AbstractSceneConverterTest::updateFileUnknownHashes,
+              &AbstractSceneConverterTest::updateFileFailed,
+              &AbstractSceneConverterTest::updateFileNotSupported,
+              &AbstractSceneConverterTest::updateFileNotImplemented,
+              &AbstractSceneConverterTest::updateFileNoUpdateInProgress,
+              &AbstractSceneConverterTest::updateFileOutOfRange});
 
     addInstancedTests({&AbstractSceneConverterTest::setMeshAttributeName},
         Containers::arraySize(SetMeshAttributeData));
@@ -805,6 +845,11 @@ AbstractSceneConverterTest::AbstractSceneConverterTest() {
               &AbstractSceneConverterTest::addImage2DZeroSize,
               &AbstractSceneConverterTest::addImage2DNullptr,
               &AbstractSceneConverterTest::addImage2DNotImplemented,
+              &AbstractSceneConverterTest::addImages2D,
+              &AbstractSceneConverterTest::addImages2DConcurrent,
+              &AbstractSceneConverterTest::addImages2DConcurrentNotSupported,
+              &AbstractSceneConverterTest::addImages2DConcurrentInvalidImage,
+              &AbstractSceneConverterTest::addImages2DConcurrentNotImplemented,
 
               &AbstractSceneConverterTest::addImage3D,
               &AbstractSceneConverterTest::addImage3DView,
@@ -4204,6 +4249,494 @@ void AbstractSceneConverterTest::addMeshThroughLevels() {
     CORRADE_COMPARE(converter.meshCount(), 1);
 }
 
+/* Executes everything on the calling thread, counting how many times it was
+   called */
+void serialParallelFor(void* state, std::size_t count, void(*task)(void*, std::size_t), void* taskState) {
+    ++*static_cast<Int*>(state);
+    for(std::size_t i = 0; i != count; ++i)
+        task(taskState, i);
+}
+
+void AbstractSceneConverterTest::setParallelFor() {
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMesh;
+        }
+    } converter;
+
+    CORRADE_VERIFY(!converter.parallelFor());
+    CORRADE_COMPARE(converter.parallelForState(), static_cast<void*>(nullptr));
+
+    Int state;
+    converter.setParallelFor(serialParallelFor, &state);
+    CORRADE_VERIFY(converter.parallelFor() == serialParallelFor);
+    CORRADE_COMPARE(converter.parallelForState(), static_cast<void*>(&state));
+}
+
+void AbstractSceneConverterTest::addMeshes() {
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMultiple|
+                   SceneConverterFeature::AddMeshes;
+        }
+
+        bool doBegin() override { return true; }
+
+        bool doAdd(UnsignedInt id, const MeshData& mesh, Containers::StringView name) override {
+            CORRADE_COMPARE(id, meshCount());
+            CORRADE_COMPARE(mesh.vertexCount(), 10 + id);
+            names[id] = name;
+            return true;
+        }
+
+        Containers::StringView names[4];
+    } converter;
+
+    CORRADE_VERIFY(converter.begin());
+    CORRADE_COMPARE(converter.add(MeshData{MeshPrimitive::Triangles, 10}), 0);
+
+    /* Without ConcurrentAdd it's delegated to add() one by one */
+    CORRADE_COMPARE(converter.addMeshes({
+        MeshData{MeshPrimitive::Triangles, 11},
+        MeshData{MeshPrimitive::Triangles, 12},
+    }, {"a"_s, "b"_s}), 1);
+    CORRADE_COMPARE(converter.meshCount(), 3);
+    CORRADE_COMPARE(converter.names[1], "a");
+    CORRADE_COMPARE(converter.names[2], "b");
+
+    /* Names are optional */
+    CORRADE_COMPARE(converter.addMeshes({
+        MeshData{MeshPrimitive::Triangles, 13}
+    }), 3);
+    CORRADE_COMPARE(converter.meshCount(), 4);
+    CORRADE_COMPARE(converter.names[3], "");
+}
+
+void AbstractSceneConverterTest::addMeshesFailed() {
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMultiple|
+                   SceneConverterFeature::AddMeshes;
+        }
+
+        bool doBegin() override { return true; }
+
+        bool doAdd(UnsignedInt id, const MeshData&, Containers::StringView) override {
+            return id != 1;
+        }
+    } converter;
+
+    CORRADE_VERIFY(converter.begin());
+
+    /* The implementation is expected to print an error message on its own */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter.addMeshes({
+        MeshData{MeshPrimitive::Triangles, 0},
+        MeshData{MeshPrimitive::Triangles, 0},
+        MeshData{MeshPrimitive::Triangles, 0},
+    }));
+    CORRADE_COMPARE(out.str(), "");
+
+    /* The mesh preceding the failed one stays added */
+    CORRADE_COMPARE(converter.meshCount(), 1);
+}
+
+void AbstractSceneConverterTest::addMeshesConcurrent() {
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMultiple|
+                   SceneConverterFeature::AddMeshes|
+                   SceneConverterFeature::ConcurrentAdd;
+        }
+
+        bool doBegin() override { return true; }
+
+        bool doAdd(UnsignedInt, const MeshData&, Containers::StringView) override {
+            return true;
+        }
+
+        bool doAddMeshes(UnsignedInt id, const Containers::Iterable<const MeshData>& meshes, const Containers::StringIterable& names) override {
+            /* Mesh count should not be increased before the function
+               returns */
+            CORRADE_COMPARE(id, meshCount());
+            CORRADE_COMPARE(id, 1);
+            CORRADE_COMPARE(meshes.size(), 3);
+            CORRADE_COMPARE(names.size(), 3);
+            CORRADE_COMPARE(names[2], "c");
+
+            struct Task {
+                const Containers::Iterable<const MeshData>& meshes;
+                UnsignedInt* vertexCounts;
+            } task{meshes, vertexCounts};
+            parallelFor()(parallelForState(), meshes.size(), [](void* state, std::size_t i) {
+                Task& task = *static_cast<Task*>(state);
+                task.vertexCounts[i] = task.meshes[i].vertexCount();
+            }, &task);
+            return true;
+        }
+
+        UnsignedInt vertexCounts[3]{};
+    } converter;
+
+    Int parallelForCalled = 0;
+    converter.setParallelFor(serialParallelFor, &parallelForCalled);
+
+    CORRADE_VERIFY(converter.begin());
+    CORRADE_COMPARE(converter.add(MeshData{MeshPrimitive::Triangles, 0}), 0);
+    CORRADE_COMPARE(converter.addMeshes({
+        MeshData{MeshPrimitive::Triangles, 5},
+        MeshData{MeshPrimitive::Triangles, 6},
+        MeshData{MeshPrimitive::Triangles, 7}
+    }, {"a"_s, "b"_s, "c"_s}), 1);
+    CORRADE_COMPARE(parallelForCalled, 1);
+    CORRADE_COMPARE_AS(Containers::arrayView(converter.vertexCounts),
+        Containers::arrayView<UnsignedInt>({5, 6, 7}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(converter.meshCount(), 4);
+
+    /* An empty batch doesn't call into the implementation */
+    CORRADE_COMPARE(converter.addMeshes(Containers::Iterable<const MeshData>{}), 4);
+    CORRADE_COMPARE(converter.meshCount(), 4);
+}
+
+void AbstractSceneConverterTest::addMeshesConcurrentFailed() {
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMultiple|
+                   SceneConverterFeature::AddMeshes|
+                   SceneConverterFeature::ConcurrentAdd;
+        }
+
+        bool doBegin() override { return true; }
+
+        bool doAddMeshes(UnsignedInt, const Containers::Iterable<const MeshData>&, const Containers::StringIterable&) override {
+            return false;
+        }
+    } converter;
+
+    CORRADE_VERIFY(converter.begin());
+
+    /* The implementation is expected to print an error message on its own */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter.addMeshes({
+        MeshData{MeshPrimitive::Triangles, 0},
+        MeshData{MeshPrimitive::Triangles, 0}
+    }));
+    CORRADE_COMPARE(out.str(), "");
+
+    /* The whole batch is discarded */
+    CORRADE_COMPARE(converter.meshCount(), 0);
+}
+
+void AbstractSceneConverterTest::addMeshesConcurrentNotImplemented() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMultiple|
+                   SceneConverterFeature::AddMeshes|
+                   SceneConverterFeature::ConcurrentAdd;
+        }
+
+        bool doBegin() override { return true; }
+    } converter;
+
+    CORRADE_VERIFY(converter.begin());
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.addMeshes({
+        MeshData{MeshPrimitive::Triangles, 0}
+    });
+    CORRADE_COMPARE(out.str(), "Trade::AbstractSceneConverter::addMeshes(): concurrent mesh conversion advertised but not implemented\n");
+}
+
+void AbstractSceneConverterTest::addMeshesInvalidNames() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMultiple|
+                   SceneConverterFeature::AddMeshes;
+        }
+
+        bool doBegin() override { return true; }
+    } converter;
+
+    CORRADE_VERIFY(converter.begin());
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.addMeshes({
+        MeshData{MeshPrimitive::Triangles, 0},
+        MeshData{MeshPrimitive::Triangles, 0}
+    }, {"a"_s});
+    CORRADE_COMPARE(out.str(), "Trade::AbstractSceneConverter::addMeshes(): expected either no or 2 names but got 1\n");
+}
+
+struct UpdatingSceneConverter: AbstractSceneConverter {
+    SceneConverterFeatures doFeatures() const override {
+        return SceneConverterFeature::ConvertMultipleToFile|
+               SceneConverterFeature::AddMeshes|
+               SceneConverterFeature::AddMaterials|
+               SceneConverterFeature::UpdateFile;
+    }
+
+    bool doBeginFile(Containers::StringView) override { return true; }
+    bool doEndFile(Containers::StringView) override { return true; }
+
+    bool doAdd(UnsignedInt, const MeshData&, Containers::StringView) override {
+        return true;
+    }
+    bool doAdd(UnsignedInt, const MaterialData&, Containers::StringView) override {
+        return true;
+    }
+
+    bool doBeginUpdateFile(Containers::StringView filename) override {
+        updatedFilename = filename;
+        return true;
+    }
+
+    bool doUpdate(UnsignedInt id, const MeshData&) override {
+        arrayAppend(updatedMeshes, id);
+        return updateSucceeds;
+    }
+
+    bool doUpdate(UnsignedInt id, const MaterialData&) override {
+        arrayAppend(updatedMaterials, id);
+        return updateSucceeds;
+    }
+
+    bool doEndUpdateFile(Containers::StringView filename) override {
+        CORRADE_COMPARE(filename, updatedFilename);
+        return endUpdateSucceeds;
+    }
+
+    Containers::String updatedFilename;
+    Containers::Array<UnsignedInt> updatedMeshes;
+    Containers::Array<UnsignedInt> updatedMaterials;
+    bool updateSucceeds = true;
+    bool endUpdateSucceeds = true;
+};
+
+void AbstractSceneConverterTest::updateFile() {
+    UpdatingSceneConverter converter;
+
+    Vector3 positions[]{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}};
+    MeshData mesh{MeshPrimitive::Points, {}, positions, {
+        MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    CORRADE_VERIFY(converter.beginFile("file.bin"));
+    CORRADE_COMPARE(converter.add(MeshData{MeshPrimitive::Triangles, 10}), 0);
+    CORRADE_COMPARE(converter.add(mesh), 1);
+    CORRADE_COMPARE(converter.add(MaterialData{MaterialType::Phong, {
+        {MaterialAttribute::Shininess, 80.0f}
+    }}), 0);
+    CORRADE_VERIFY(converter.endFile());
+
+    CORRADE_VERIFY(converter.beginUpdateFile("file.bin"));
+    CORRADE_VERIFY(converter.isConverting());
+    CORRADE_COMPARE(converter.updatedFilename, "file.bin");
+    CORRADE_COMPARE(converter.meshCount(), 2);
+    CORRADE_COMPARE(converter.materialCount(), 1);
+
+    /* Same data are skipped */
+    CORRADE_VERIFY(converter.update(0, MeshData{MeshPrimitive::Triangles, 10}));
+    CORRADE_VERIFY(converter.update(1, mesh));
+    CORRADE_VERIFY(converter.update(0, MaterialData{MaterialType::Phong, {
+        {MaterialAttribute::Shininess, 80.0f}
+    }}));
+    CORRADE_VERIFY(converter.updatedMeshes.isEmpty());
+    CORRADE_VERIFY(converter.updatedMaterials.isEmpty());
+
+    /* Changed layout, data or attribute value is passed through */
+    positions[1].y() = 7.0f;
+    CORRADE_VERIFY(converter.update(0, MeshData{MeshPrimitive::Triangles, 11}));
+    CORRADE_VERIFY(converter.update(1, mesh));
+    CORRADE_VERIFY(converter.update(0, MaterialData{MaterialType::Phong, {
+        {MaterialAttribute::Shininess, 81.0f}
+    }}));
+    CORRADE_COMPARE_AS(converter.updatedMeshes,
+        Containers::arrayView<UnsignedInt>({0, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(converter.updatedMaterials,
+        Containers::arrayView<UnsignedInt>({0}),
+        TestSuite::Compare::Container);
+    CORRADE_VERIFY(converter.endFile());
+    CORRADE_VERIFY(!converter.isConverting());
+
+    /* The next update compares against the updated data */
+    arrayResize(converter.updatedMeshes, 0);
+    CORRADE_VERIFY(converter.beginUpdateFile("file.bin"));
+    CORRADE_VERIFY(converter.update(0, MeshData{MeshPrimitive::Triangles, 11}));
+    CORRADE_VERIFY(converter.update(1, mesh));
+    CORRADE_VERIFY(converter.update(0, MeshData{MeshPrimitive::Triangles, 10}));
+    CORRADE_COMPARE_AS(converter.updatedMeshes,
+        Containers::arrayView<UnsignedInt>({0}),
+        TestSuite::Compare::Container);
+    CORRADE_VERIFY(converter.endFile());
+}
+
+void AbstractSceneConverterTest::updateFileUnknownHashes() {
+    UpdatingSceneConverter converter;
+
+    CORRADE_VERIFY(converter.beginFile("file.bin"));
+    CORRADE_COMPARE(converter.add(MeshData{MeshPrimitive::Triangles, 10}), 0);
+    CORRADE_VERIFY(converter.endFile());
+
+    /* A different file, nothing is known about it so everything is passed
+       through and the implementation is responsible for range checks */
+    CORRADE_VERIFY(converter.beginUpdateFile("another.bin"));
+    CORRADE_COMPARE(converter.meshCount(), 0);
+    CORRADE_VERIFY(converter.update(0, MeshData{MeshPrimitive::Triangles, 10}));
+    CORRADE_VERIFY(converter.update(5, MeshData{MeshPrimitive::Triangles, 10}));
+    CORRADE_COMPARE_AS(converter.updatedMeshes,
+        Containers::arrayView<UnsignedInt>({0, 5}),
+        TestSuite::Compare::Container);
+    CORRADE_VERIFY(converter.endFile());
+
+    /* After updating an unknown file the previously remembered hashes are
+       forgotten as well */
+    CORRADE_VERIFY(converter.beginUpdateFile("file.bin"));
+    CORRADE_COMPARE(converter.meshCount(), 0);
+    CORRADE_VERIFY(converter.update(0, MeshData{MeshPrimitive::Triangles, 10}));
+    CORRADE_COMPARE_AS(converter.updatedMeshes,
+        Containers::arrayView<UnsignedInt>({0, 5, 0}),
+        TestSuite::Compare::Container);
+}
+
+void AbstractSceneConverterTest::updateFileFailed() {
+    UpdatingSceneConverter converter;
+
+    CORRADE_VERIFY(converter.beginFile("file.bin"));
+    CORRADE_COMPARE(converter.add(MeshData{MeshPrimitive::Triangles, 10}), 0);
+    CORRADE_VERIFY(converter.endFile());
+
+    /* A failed update doesn't record the new hash */
+    converter.updateSucceeds = false;
+    CORRADE_VERIFY(converter.beginUpdateFile("file.bin"));
+    CORRADE_VERIFY(!converter.update(0, MeshData{MeshPrimitive::Triangles, 11}));
+    converter.updateSucceeds = true;
+    CORRADE_VERIFY(converter.update(0, MeshData{MeshPrimitive::Triangles, 11}));
+    CORRADE_COMPARE_AS(converter.updatedMeshes,
+        Containers::arrayView<UnsignedInt>({0, 0}),
+        TestSuite::Compare::Container);
+
+    /* If writing the update fails, the file contents are unknown and the
+       hashes are forgotten */
+    converter.endUpdateSucceeds = false;
+    CORRADE_VERIFY(!converter.endFile());
+    CORRADE_VERIFY(!converter.isConverting());
+    CORRADE_VERIFY(converter.beginUpdateFile("file.bin"));
+    CORRADE_COMPARE(converter.meshCount(), 0);
+}
+
+void AbstractSceneConverterTest::updateFileNotSupported() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMultipleToFile|
+                   SceneConverterFeature::AddMeshes;
+        }
+    } converter;
+
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMultipleToFile|
+                   SceneConverterFeature::UpdateFile;
+        }
+
+        bool doBeginUpdateFile(Containers::StringView) override { return true; }
+    } converterNoData;
+
+    CORRADE_VERIFY(converterNoData.beginUpdateFile("file.bin"));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.beginUpdateFile("file.bin");
+    converterNoData.update(0, MeshData{MeshPrimitive::Triangles, 0});
+    converterNoData.update(0, MaterialData{{}, nullptr});
+    CORRADE_COMPARE(out.str(),
+        "Trade::AbstractSceneConverter::beginUpdateFile(): feature not supported\n"
+        "Trade::AbstractSceneConverter::update(): mesh update not supported\n"
+        "Trade::AbstractSceneConverter::update(): material update not supported\n");
+}
+
+void AbstractSceneConverterTest::updateFileNotImplemented() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMultipleToFile|
+                   SceneConverterFeature::AddMeshes|
+                   SceneConverterFeature::AddMaterials|
+                   SceneConverterFeature::UpdateFile;
+        }
+
+        bool doBeginUpdateFile(Containers::StringView filename) override {
+            /* Delegate to the default implementation, which asserts */
+            if(filename == "default.bin"_s)
+                return AbstractSceneConverter::doBeginUpdateFile(filename);
+            return true;
+        }
+    } converter;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.beginUpdateFile("default.bin");
+    CORRADE_VERIFY(converter.beginUpdateFile("file.bin"));
+    converter.update(0, MeshData{MeshPrimitive::Triangles, 0});
+    converter.update(0, MaterialData{{}, nullptr});
+    converter.endFile();
+    CORRADE_COMPARE(out.str(),
+        "Trade::AbstractSceneConverter::beginUpdateFile(): feature advertised but not implemented\n"
+        "Trade::AbstractSceneConverter::update(): mesh update advertised but not implemented\n"
+        "Trade::AbstractSceneConverter::update(): material update advertised but not implemented\n"
+        "Trade::AbstractSceneConverter::endFile(): update advertised but not implemented\n");
+}
+
+void AbstractSceneConverterTest::updateFileNoUpdateInProgress() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UpdatingSceneConverter converter;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.update(0, MeshData{MeshPrimitive::Triangles, 0});
+    /* A regular file conversion doesn't count */
+    CORRADE_VERIFY(converter.beginFile("file.bin"));
+    converter.update(0, MaterialData{{}, nullptr});
+    CORRADE_COMPARE(out.str(),
+        "Trade::AbstractSceneConverter::update(): no update in progress\n"
+        "Trade::AbstractSceneConverter::update(): no update in progress\n");
+}
+
+void AbstractSceneConverterTest::updateFileOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    UpdatingSceneConverter converter;
+
+    CORRADE_VERIFY(converter.beginFile("file.bin"));
+    CORRADE_COMPARE(converter.add(MeshData{MeshPrimitive::Triangles, 10}), 0);
+    CORRADE_COMPARE(converter.add(MeshData{MeshPrimitive::Triangles, 10}), 1);
+    CORRADE_COMPARE(converter.add(MaterialData{{}, nullptr}), 0);
+    CORRADE_VERIFY(converter.endFile());
+
+    CORRADE_VERIFY(converter.beginUpdateFile("file.bin"));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.update(2, MeshData{MeshPrimitive::Triangles, 0});
+    converter.update(1, MaterialData{{}, nullptr});
+    CORRADE_COMPARE(out.str(),
+        "Trade::AbstractSceneConverter::update(): index 2 out of range for 2 meshes\n"
+        "Trade::AbstractSceneConverter::update(): index 1 out of range for 1 materials\n");
+}
+
 void AbstractSceneConverterTest::setMeshAttributeName() {
     auto&& data = SetMeshAttributeData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -4835,6 +5368,159 @@ void AbstractSceneConverterTest::addImage2DNotImplemented() {
     CORRADE_COMPARE(out.str(), "Trade::AbstractSceneConverter::add(): 2D image conversion advertised but not implemented\n");
 }
 
+void AbstractSceneConverterTest::addImages2D() {
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMultiple|
+                   SceneConverterFeature::AddImages2D;
+        }
+
+        bool doBegin() override { return true; }
+
+        bool doAdd(UnsignedInt id, const ImageData2D& image, Containers::StringView name) override {
+            CORRADE_COMPARE(id, image2DCount());
+            CORRADE_COMPARE(image.size(), (Vector2i{1, Int(id + 1)}));
+            CORRADE_COMPARE(name, id ? "b" : "a");
+            return true;
+        }
+    } converter;
+
+    const char imageData[8]{};
+
+    CORRADE_VERIFY(converter.begin());
+
+    /* Without ConcurrentAdd it's delegated to add() one by one */
+    CORRADE_COMPARE(converter.addImages({
+        ImageData2D{PixelFormat::RGBA8Unorm, {1, 1}, DataFlags{}, imageData},
+        ImageData2D{PixelFormat::RGBA8Unorm, {1, 2}, DataFlags{}, imageData}
+    }, {"a"_s, "b"_s}), 0);
+    CORRADE_COMPARE(converter.image2DCount(), 2);
+}
+
+void AbstractSceneConverterTest::addImages2DConcurrent() {
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMultiple|
+                   SceneConverterFeature::AddImages2D|
+                   SceneConverterFeature::AddCompressedImages2D|
+                   SceneConverterFeature::ConcurrentAdd;
+        }
+
+        bool doBegin() override { return true; }
+
+        bool doAdd(UnsignedInt, const ImageData2D&, Containers::StringView) override {
+            return true;
+        }
+
+        bool doAddImages(UnsignedInt id, const Containers::Iterable<const ImageData2D>& images, const Containers::StringIterable& names) override {
+            /* Image count should not be increased before the function
+               returns */
+            CORRADE_COMPARE(id, image2DCount());
+            CORRADE_COMPARE(id, 1);
+            CORRADE_COMPARE(images.size(), 2);
+            CORRADE_VERIFY(names.isEmpty());
+            /* Mixing compressed and uncompressed images is fine, each is a
+               separate image */
+            CORRADE_VERIFY(!images[0].isCompressed());
+            CORRADE_VERIFY(images[1].isCompressed());
+
+            addImagesCalled = true;
+            return true;
+        }
+
+        bool addImagesCalled = false;
+    } converter;
+
+    const char imageData[16]{};
+
+    CORRADE_VERIFY(converter.begin());
+    CORRADE_COMPARE(converter.add(ImageData2D{PixelFormat::RGBA8Unorm, {1, 1}, DataFlags{}, imageData}), 0);
+    CORRADE_COMPARE(converter.addImages({
+        ImageData2D{PixelFormat::RGBA8Unorm, {2, 2}, DataFlags{}, imageData},
+        ImageData2D{CompressedPixelFormat::Bc1RGBAUnorm, {4, 4}, DataFlags{}, imageData}
+    }), 1);
+    CORRADE_VERIFY(converter.addImagesCalled);
+    CORRADE_COMPARE(converter.image2DCount(), 3);
+}
+
+void AbstractSceneConverterTest::addImages2DConcurrentNotSupported() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMultiple|
+                   SceneConverterFeature::AddImages2D|
+                   SceneConverterFeature::ConcurrentAdd;
+        }
+
+        bool doBegin() override { return true; }
+    } converter;
+
+    const char imageData[16]{};
+
+    CORRADE_VERIFY(converter.begin());
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.addImages({
+        ImageData2D{PixelFormat::RGBA8Unorm, {1, 1}, DataFlags{}, imageData},
+        ImageData2D{CompressedPixelFormat::Bc1RGBAUnorm, {4, 4}, DataFlags{}, imageData}
+    });
+    CORRADE_COMPARE(out.str(), "Trade::AbstractSceneConverter::addImages(): compressed 2D image conversion not supported\n");
+}
+
+void AbstractSceneConverterTest::addImages2DConcurrentInvalidImage() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMultiple|
+                   SceneConverterFeature::AddImages2D|
+                   SceneConverterFeature::ConcurrentAdd;
+        }
+
+        bool doBegin() override { return true; }
+    } converter;
+
+    const char imageData[4]{};
+
+    CORRADE_VERIFY(converter.begin());
+
+    /* Just verify that the same check as in add() is used */
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.addImages({
+        ImageData2D{PixelFormat::RGBA8Unorm, {1, 1}, DataFlags{}, imageData},
+        ImageData2D{PixelFormat::RGBA8Unorm, {4, 0}, DataFlags{}, imageData}
+    });
+    CORRADE_COMPARE(out.str(), "Trade::AbstractSceneConverter::addImages(): can't add image with a zero size: Vector(4, 0)\n");
+}
+
+void AbstractSceneConverterTest::addImages2DConcurrentNotImplemented() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractSceneConverter {
+        SceneConverterFeatures doFeatures() const override {
+            return SceneConverterFeature::ConvertMultiple|
+                   SceneConverterFeature::AddImages2D|
+                   SceneConverterFeature::ConcurrentAdd;
+        }
+
+        bool doBegin() override { return true; }
+    } converter;
+
+    const char imageData[4]{};
+
+    CORRADE_VERIFY(converter.begin());
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    converter.addImages({
+        ImageData2D{PixelFormat::RGBA8Unorm, {1, 1}, DataFlags{}, imageData}
+    });
+    CORRADE_COMPARE(out.str(), "Trade::AbstractSceneConverter::addImages(): concurrent 2D image conversion advertised but not implemented\n");
+}
+
 void AbstractSceneConverterTest::addImage3D() {
     struct: AbstractSceneConverter {
         SceneConverterFeatures doFeatures() const override {
@@ -6502,7 +7188,7 @@ void AbstractSceneConverterTest::addImporterContentsImportFail() {
         }
         Containers::Optional<MaterialData> doMaterial(UnsignedInt id) override {
             if(id == 2) return {};
-            return MaterialData{{}, {}};
+            return MaterialData{{}, nullptr};
         }
 
         UnsignedInt doTextureCount() const override {
@@ -6734,7 +7420,7 @@ void AbstractSceneConverterTest::addImporterContentsConversionFail() {
             return 4;
         }
         Containers::Optional<MaterialData> doMaterial(UnsignedInt) override {
-            return MaterialData{{}, {}};
+            return MaterialData{{}, nullptr};
         }
 
         UnsignedInt doTextureCount() const override {
@@ -7287,7 +7973,7 @@ void AbstractSceneConverterTest::addSupportedImporterContents() {
 
         UnsignedInt doMaterialCount() const override { return 9; }
         Containers::Optional<MaterialData> doMaterial(UnsignedInt) override {
-            return MaterialData{{}, {}};
+            return MaterialData{{}, nullptr};
         }
 
         UnsignedInt doTextureCount() const override { return 10; }
@@ -25,11 +25,15 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/DebugStl.h>
 
 #include "Magnum/Math/CubicHermite.h"
 #include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Animation/PackedQuaternion.h"
 #include "Magnum/Trade/AnimationData.h"
 
 namespace Magnum { namespace Trade { namespace Test { namespace {
@@ -84,11 +88,20 @@ struct AnimationDataTest: TestSuite::Tester {
     void mutableAccessNotAllowed();
 
     void trackCustomResultType();
+    void trackPackedQuaternion();
     void trackWrongIndex();
     void trackWrongType();
     void trackWrongResultType();
 
     void release();
+
+    void serialize();
+    void serializeEmpty();
+    void serializeCustomInterpolation();
+    void serializeTrackNotContained();
+    void deserializeInvalid();
+    void deserializeInvalidTrack();
+    void deserializeOwned();
 };
 
 struct {
@@ -150,11 +163,20 @@ AnimationDataTest::AnimationDataTest() {
               &AnimationDataTest::mutableAccessNotAllowed,
 
               &AnimationDataTest::trackCustomResultType,
+              &AnimationDataTest::trackPackedQuaternion,
               &AnimationDataTest::trackWrongIndex,
               &AnimationDataTest::trackWrongType,
               &AnimationDataTest::trackWrongResultType,
 
-              &AnimationDataTest::release});
+              &AnimationDataTest::release,
+
+              &AnimationDataTest::serialize,
+              &AnimationDataTest::serializeEmpty,
+              &AnimationDataTest::serializeCustomInterpolation,
+              &AnimationDataTest::serializeTrackNotContained,
+              &AnimationDataTest::deserializeInvalid,
+              &AnimationDataTest::deserializeInvalidTrack,
+              &AnimationDataTest::deserializeOwned});
 }
 
 using namespace Math::Literals;
@@ -171,11 +193,13 @@ void AnimationDataTest::trackTypeSizeAlignment() {
     CORRADE_COMPARE(animationTrackTypeSize(AnimationTrackType::CubicHermiteComplex), sizeof(CubicHermiteComplex));
     CORRADE_COMPARE(animationTrackTypeSize(AnimationTrackType::CubicHermite3D), sizeof(CubicHermite3D));
     CORRADE_COMPARE(animationTrackTypeSize(AnimationTrackType::CubicHermiteQuaternion), sizeof(CubicHermiteQuaternion));
+    CORRADE_COMPARE(animationTrackTypeSize(AnimationTrackType::PackedQuaternion), sizeof(Animation::PackedQuaternion));
 
     /* Alignment is 4 for most types, except for bit-sized ones */
     CORRADE_COMPARE(animationTrackTypeAlignment(AnimationTrackType::BitVector4), 1);
     CORRADE_COMPARE(animationTrackTypeAlignment(AnimationTrackType::Float), alignof(Float));
     CORRADE_COMPARE(animationTrackTypeAlignment(AnimationTrackType::CubicHermiteQuaternion), alignof(CubicHermiteQuaternion));
+    CORRADE_COMPARE(animationTrackTypeAlignment(AnimationTrackType::PackedQuaternion), alignof(Animation::PackedQuaternion));
 }
 
 void AnimationDataTest::trackTypeSizeAlignmentInvalid() {
@@ -1080,6 +1104,32 @@ void AnimationDataTest::trackCustomResultType() {
     CORRADE_COMPARE((data.track<Vector3i, Vector3>(0).at(2.5f)), (Vector3{1.65f, 0.8f, 0.55f}));
 }
 
+void AnimationDataTest::trackPackedQuaternion() {
+    struct Data {
+        Float time;
+        Animation::PackedQuaternion rotation;
+    };
+    Containers::Array<char> buffer{sizeof(Data)*3};
+    auto view = Containers::arrayCast<Data>(buffer);
+    view[0] = {0.0f, Animation::PackedQuaternion{Quaternion::rotation(0.0_degf, Vector3::xAxis())}};
+    view[1] = {2.0f, Animation::PackedQuaternion{Quaternion::rotation(90.0_degf, Vector3::xAxis())}};
+    view[2] = {4.0f, Animation::PackedQuaternion{Quaternion::rotation(180.0_degf, Vector3::xAxis())}};
+
+    AnimationData data{Utility::move(buffer), {
+        AnimationTrackData{AnimationTrackTarget::Rotation3D, 0,
+            Containers::stridedArrayView(view).slice(&Data::time),
+            Containers::stridedArrayView(view).slice(&Data::rotation),
+            Animation::Interpolation::Linear}
+        }};
+    CORRADE_COMPARE(data.trackType(0), AnimationTrackType::PackedQuaternion);
+    CORRADE_COMPARE(data.trackResultType(0), AnimationTrackType::Quaternion);
+    CORRADE_COMPARE(data.track(0).interpolator(), reinterpret_cast<void(*)()>(animationInterpolatorFor<Animation::PackedQuaternion>(Animation::Interpolation::Linear)));
+    CORRADE_COMPARE(data.track<Animation::PackedQuaternion>(0).at(1.0f),
+        Quaternion::rotation(45.0_degf, Vector3::xAxis()));
+    CORRADE_COMPARE(data.track<Animation::PackedQuaternion>(0).at(3.0f),
+        Quaternion::rotation(135.0_degf, Vector3::xAxis()));
+}
+
 void AnimationDataTest::trackWrongIndex() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -1153,6 +1203,237 @@ void AnimationDataTest::release() {
     CORRADE_COMPARE(static_cast<const void*>(released.data()), keyframes);
 }
 
+struct SerializeKeyframe {
+    Float time;
+    Vector2 position;
+};
+
+AnimationData serializeAnimation() {
+    Containers::Array<char> data{ValueInit, 3*sizeof(SerializeKeyframe)};
+    Containers::ArrayView<SerializeKeyframe> keyframeData = Containers::arrayCast<SerializeKeyframe>(data);
+    Utility::copy({
+        SerializeKeyframe{0.5f, {1.0f, 2.0f}},
+        SerializeKeyframe{1.0f, {3.0f, 4.0f}},
+        SerializeKeyframe{2.5f, {5.0f, 6.0f}}
+    }, keyframeData);
+    Containers::StridedArrayView1D<SerializeKeyframe> keyframes = keyframeData;
+
+    return AnimationData{Utility::move(data), {
+        AnimationTrackData{AnimationTrackTarget::Translation2D, 42,
+            keyframes.slice(&SerializeKeyframe::time),
+            keyframes.slice(&SerializeKeyframe::position),
+            Animation::Interpolation::Linear,
+            Animation::Extrapolation::Extrapolated,
+            Animation::Extrapolation::Constant},
+        /* Reversed to verify negative strides are preserved */
+        AnimationTrackData{animationTrackTargetCustom(3), 7,
+            keyframes.slice(&SerializeKeyframe::time).flipped<0>(),
+            keyframes.slice(&SerializeKeyframe::position).flipped<0>(),
+            Animation::Interpolation::Constant}
+    }, {0.0f, 3.0f}};
+}
+
+void AnimationDataTest::serialize() {
+    AnimationData animation = serializeAnimation();
+
+    Containers::Array<char> serialized = animation.serialize();
+    CORRADE_COMPARE(serialized.size(), animation.serializedSize());
+    CORRADE_COMPARE(serialized.size() % 8, 0);
+    CORRADE_VERIFY(isDataChunk(serialized));
+
+    Containers::Optional<AnimationData> deserialized = AnimationData::deserialize(serialized);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_COMPARE(deserialized->dataFlags(), DataFlags{});
+    CORRADE_COMPARE(deserialized->duration(), (Range1D{0.0f, 3.0f}));
+
+    /* The keyframe data aren't copied */
+    CORRADE_VERIFY(deserialized->data().data() > serialized.data());
+    CORRADE_VERIFY(deserialized->data().data() < serialized.end());
+
+    CORRADE_COMPARE(deserialized->trackCount(), 2);
+    CORRADE_COMPARE(deserialized->trackType(0), AnimationTrackType::Vector2);
+    CORRADE_COMPARE(deserialized->trackResultType(0), AnimationTrackType::Vector2);
+    CORRADE_COMPARE(deserialized->trackTargetName(0), AnimationTrackTarget::Translation2D);
+    CORRADE_COMPARE(deserialized->trackTarget(0), 42);
+    CORRADE_COMPARE(deserialized->trackTargetName(1), animationTrackTargetCustom(3));
+    CORRADE_COMPARE(deserialized->trackTarget(1), 7);
+
+    Animation::TrackView<const Float, const Vector2> track0 = deserialized->track<Vector2>(0);
+    CORRADE_COMPARE_AS(track0.keys(),
+        Containers::arrayView({0.5f, 1.0f, 2.5f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(track0.values(),
+        Containers::arrayView<Vector2>({{1.0f, 2.0f}, {3.0f, 4.0f}, {5.0f, 6.0f}}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(track0.interpolation(), Animation::Interpolation::Linear);
+    CORRADE_COMPARE(track0.before(), Animation::Extrapolation::Extrapolated);
+    CORRADE_COMPARE(track0.after(), Animation::Extrapolation::Constant);
+
+    /* The interpolator is resolved from the interpolation value */
+    CORRADE_VERIFY(track0.interpolator() == animationInterpolatorFor<Vector2>(Animation::Interpolation::Linear));
+    CORRADE_COMPARE(track0.at(1.5f), (Vector2{11.0f/3.0f, 14.0f/3.0f}));
+
+    Animation::TrackView<const Float, const Vector2> track1 = deserialized->track<Vector2>(1);
+    CORRADE_COMPARE_AS(track1.keys(),
+        Containers::arrayView({2.5f, 1.0f, 0.5f}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(track1.interpolation(), Animation::Interpolation::Constant);
+    CORRADE_VERIFY(track1.interpolator() == animationInterpolatorFor<Vector2>(Animation::Interpolation::Constant));
+
+    /* Serializing again gives the same output */
+    CORRADE_COMPARE_AS(deserialized->serialize(), serialized,
+        TestSuite::Compare::Container);
+}
+
+void AnimationDataTest::serializeEmpty() {
+    AnimationData animation{nullptr, nullptr};
+
+    Containers::Array<char> serialized = animation.serialize();
+    Containers::Optional<AnimationData> deserialized = AnimationData::deserialize(serialized, DataFlag::Mutable);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_COMPARE(deserialized->dataFlags(), DataFlag::Mutable);
+    CORRADE_COMPARE(deserialized->trackCount(), 0);
+    CORRADE_COMPARE(deserialized->duration(), Range1D{});
+}
+
+void AnimationDataTest::serializeCustomInterpolation() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    SerializeKeyframe keyframes[2]; /* {} makes GCC 4.8 crash */
+    AnimationData animation{{}, keyframes, {
+        AnimationTrackData{AnimationTrackTarget::Translation2D, 0,
+            Containers::stridedArrayView(keyframes).slice(&SerializeKeyframe::time),
+            Containers::stridedArrayView(keyframes).slice(&SerializeKeyframe::position),
+            Animation::Interpolation::Linear},
+        AnimationTrackData{AnimationTrackTarget::Translation2D, 1,
+            Containers::stridedArrayView(keyframes).slice(&SerializeKeyframe::time),
+            Containers::stridedArrayView(keyframes).slice(&SerializeKeyframe::position),
+            Math::select}
+    }};
+
+    Containers::Array<char> serialized{NoInit, animation.serializedSize()};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    animation.serializeInto(serialized);
+    CORRADE_COMPARE(out.str(), "Trade::AnimationData::serializeInto(): can't serialize a custom interpolator of track 1\n");
+}
+
+void AnimationDataTest::serializeTrackNotContained() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    SerializeKeyframe keyframes[2]; /* {} makes GCC 4.8 crash */
+    AnimationData animation{{}, Containers::arrayView(keyframes).exceptSuffix(1), {
+        AnimationTrackData{AnimationTrackTarget::Translation2D, 0,
+            Containers::stridedArrayView(keyframes).slice(&SerializeKeyframe::time),
+            Containers::stridedArrayView(keyframes).slice(&SerializeKeyframe::position),
+            Animation::Interpolation::Linear}
+    }};
+
+    Containers::Array<char> serialized{NoInit, animation.serializedSize()};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    animation.serializeInto(serialized);
+    CORRADE_COMPARE(out.str(), "Trade::AnimationData::serializeInto(): keys or values of track 0 are not contained in the data\n");
+}
+
+void AnimationDataTest::deserializeInvalid() {
+    Containers::Array<char> serialized = AnimationData{nullptr, nullptr}.serialize();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    /* Valid chunk of a different type */
+    reinterpret_cast<DataChunkHeader*>(serialized.data())->type = DataChunkType::Mesh;
+    CORRADE_VERIFY(!AnimationData::deserialize(serialized));
+
+    reinterpret_cast<DataChunkHeader*>(serialized.data())->type = DataChunkType::Animation;
+    reinterpret_cast<DataChunkHeader*>(serialized.data())->typeVersion = 1;
+    CORRADE_VERIFY(!AnimationData::deserialize(serialized));
+
+    CORRADE_COMPARE(out.str(),
+        "Trade::AnimationData::deserialize(): expected a Trade::DataChunkType::Animation chunk but got Trade::DataChunkType::Mesh\n"
+        "Trade::AnimationData::deserialize(): invalid chunk type version 1\n");
+}
+
+void AnimationDataTest::deserializeInvalidTrack() {
+    const AnimationData animation = serializeAnimation();
+    /* The two tracks are right after the header, followed by the keyframe
+       data padded to 8 bytes. Each track is 24 bytes of properties followed
+       by the key and value offsets. */
+    const std::size_t trackSize = 24 + 2*sizeof(std::size_t);
+    const std::size_t trackOffset = animation.serializedSize() - 2*trackSize - 40;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    /* Invalid type */
+    {
+        Containers::Array<char> serialized = animation.serialize();
+        serialized[trackOffset] = 0;
+        CORRADE_VERIFY(!AnimationData::deserialize(serialized));
+
+    /* Spline interpolation of a non-spline type */
+    } {
+        Containers::Array<char> serialized = animation.serialize();
+        serialized[trackOffset + 4] = char(Animation::Interpolation::Spline);
+        CORRADE_VERIFY(!AnimationData::deserialize(serialized));
+
+    /* Custom interpolation */
+    } {
+        Containers::Array<char> serialized = animation.serialize();
+        serialized[trackOffset + trackSize + 4] = char(Animation::Interpolation::Custom);
+        CORRADE_VERIFY(!AnimationData::deserialize(serialized));
+
+    /* Mismatched result type */
+    } {
+        Containers::Array<char> serialized = animation.serialize();
+        serialized[trackOffset + 1] = char(AnimationTrackType::Vector3);
+        CORRADE_VERIFY(!AnimationData::deserialize(serialized));
+
+    /* Invalid extrapolation */
+    } {
+        Containers::Array<char> serialized = animation.serialize();
+        serialized[trackOffset + 6] = 3;
+        CORRADE_VERIFY(!AnimationData::deserialize(serialized));
+
+    /* Key stride out of range */
+    } {
+        Containers::Array<char> serialized = animation.serialize();
+        *reinterpret_cast<Short*>(serialized.data() + trackOffset + 20) = 20;
+        CORRADE_VERIFY(!AnimationData::deserialize(serialized));
+
+    /* Value offset out of range. The second track goes backwards from the
+       last keyframe, so its offset is the largest. */
+    } {
+        Containers::Array<char> serialized = animation.serialize();
+        *reinterpret_cast<std::size_t*>(serialized.data() + trackOffset + trackSize + 24 + sizeof(std::size_t)) = 32;
+        CORRADE_VERIFY(!AnimationData::deserialize(serialized));
+    }
+
+    CORRADE_COMPARE(out.str(),
+        "Trade::AnimationData::deserialize(): invalid type Trade::AnimationTrackType(0x0) of track 0\n"
+        "Trade::AnimationData::deserialize(): invalid result type Trade::AnimationTrackType::Vector2 or interpolation Animation::Interpolation::Spline for Trade::AnimationTrackType::Vector2 of track 0\n"
+        "Trade::AnimationData::deserialize(): invalid result type Trade::AnimationTrackType::Vector2 or interpolation Animation::Interpolation::Custom for Trade::AnimationTrackType::Vector2 of track 1\n"
+        "Trade::AnimationData::deserialize(): invalid result type Trade::AnimationTrackType::Vector3 or interpolation Animation::Interpolation::Linear for Trade::AnimationTrackType::Vector2 of track 0\n"
+        "Trade::AnimationData::deserialize(): invalid extrapolation Animation::Extrapolation::Extrapolated, Animation::Extrapolation(0x3) of track 0\n"
+        "Trade::AnimationData::deserialize(): 3 keys of track 0 with a stride of 20 at offset 0 out of range for 36 bytes of animation data\n"
+        "Trade::AnimationData::deserialize(): 3 values of track 1 with a stride of -12 at offset 32 out of range for 36 bytes of animation data\n");
+}
+
+void AnimationDataTest::deserializeOwned() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::Array<char> serialized = AnimationData{nullptr, nullptr}.serialize();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    AnimationData::deserialize(serialized, DataFlag::Owned);
+    CORRADE_COMPARE(out.str(),
+        "Trade::AnimationData::deserialize(): can't reference non-owned data but got Trade::DataFlag::Owned\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::AnimationDataTest)
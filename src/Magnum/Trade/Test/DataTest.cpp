@@ -25,8 +25,10 @@
 */
 
 #include <sstream>
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/FormatStl.h>
 
 #include "Magnum/Trade/Data.h"
 
@@ -39,13 +41,25 @@ struct DataTest: TestSuite::Tester {
     void debugDataFlagPacked();
     void debugDataFlags();
     void debugDataFlagsPacked();
+
+    void debugDataChunkSignature();
+    void debugDataChunkType();
+
+    void dataChunkHeaderDeserialize();
+    void dataChunkHeaderDeserializeInvalid();
 };
 
 DataTest::DataTest() {
     addTests({&DataTest::debugDataFlag,
               &DataTest::debugDataFlagPacked,
               &DataTest::debugDataFlags,
-              &DataTest::debugDataFlagsPacked});
+              &DataTest::debugDataFlagsPacked,
+
+              &DataTest::debugDataChunkSignature,
+              &DataTest::debugDataChunkType,
+
+              &DataTest::dataChunkHeaderDeserialize,
+              &DataTest::dataChunkHeaderDeserializeInvalid});
 }
 
 void DataTest::debugDataFlag() {
@@ -76,6 +90,85 @@ void DataTest::debugDataFlagsPacked() {
     CORRADE_COMPARE(out.str(), "Owned|Mutable {} Trade::DataFlag::ExternallyOwned|Trade::DataFlag::Mutable\n");
 }
 
+void DataTest::debugDataChunkSignature() {
+    std::ostringstream out;
+
+    Debug{&out} << DataChunkSignature::Little64 << DataChunkSignature(0xdeadbeef);
+    CORRADE_COMPARE(out.str(), "Trade::DataChunkSignature::Little64 Trade::DataChunkSignature(0xdeadbeef)\n");
+}
+
+void DataTest::debugDataChunkType() {
+    std::ostringstream out;
+
+    Debug{&out} << DataChunkType::Mesh << DataChunkType(0xdeadbeef);
+    CORRADE_COMPARE(out.str(), "Trade::DataChunkType::Mesh Trade::DataChunkType(0xdeadbeef)\n");
+}
+
+void DataTest::dataChunkHeaderDeserialize() {
+    alignas(8) const DataChunkHeader headers[]{
+        {128, {'\n'}, {'\r', '\n'}, DataChunkSignature::Current, 0, 3, DataChunkType::Scene, sizeof(DataChunkHeader)},
+        /* Garbage after is ignored */
+        {}
+    };
+
+    CORRADE_VERIFY(isDataChunk(headers));
+    CORRADE_COMPARE(Trade::dataChunkHeaderDeserialize(headers), &headers[0]);
+    CORRADE_COMPARE(headers[0].type, DataChunkType::Scene);
+    CORRADE_COMPARE(headers[0].typeVersion, 3);
+}
+
+void DataTest::dataChunkHeaderDeserializeInvalid() {
+    const DataChunkHeader valid{128, {'\n'}, {'\r', '\n'}, DataChunkSignature::Current, 0, 0, DataChunkType::Mesh, sizeof(DataChunkHeader)};
+
+    alignas(8) DataChunkHeader headers[2];
+    headers[1] = valid;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const Containers::ArrayView<const char> bytes = Containers::arrayCast<const char>(Containers::arrayView(headers));
+
+    headers[0] = valid;
+    CORRADE_VERIFY(!isDataChunk(bytes.prefix(sizeof(DataChunkHeader) - 1)));
+    CORRADE_VERIFY(!Trade::dataChunkHeaderDeserialize(bytes.prefix(sizeof(DataChunkHeader) - 1)));
+
+    /* Unaligned */
+    CORRADE_VERIFY(!Trade::dataChunkHeaderDeserialize(bytes.slice(4, 4 + sizeof(DataChunkHeader))));
+
+    headers[0] = valid;
+    headers[0].eolWindows[0] = '\n';
+    CORRADE_VERIFY(!isDataChunk(headers));
+    CORRADE_VERIFY(!Trade::dataChunkHeaderDeserialize(headers));
+
+    headers[0] = valid;
+    headers[0].signature = DataChunkSignature::Current == DataChunkSignature::Little64 ? DataChunkSignature::Big32 : DataChunkSignature::Little64;
+    CORRADE_VERIFY(!isDataChunk(headers));
+    CORRADE_VERIFY(!Trade::dataChunkHeaderDeserialize(headers));
+
+    headers[0] = valid;
+    headers[0].size = sizeof(DataChunkHeader) + 4;
+    CORRADE_VERIFY(!isDataChunk(headers));
+    CORRADE_VERIFY(!Trade::dataChunkHeaderDeserialize(headers));
+
+    headers[0] = valid;
+    headers[0].size = 3*sizeof(DataChunkHeader);
+    CORRADE_VERIFY(!isDataChunk(headers));
+    CORRADE_VERIFY(!Trade::dataChunkHeaderDeserialize(headers));
+
+    CORRADE_COMPARE(out.str(), Utility::formatString(
+        "Trade::dataChunkHeaderDeserialize(): expected at least {0} bytes for a header but got {1}\n"
+        "Trade::dataChunkHeaderDeserialize(): data not aligned to 8 bytes\n"
+        "Trade::dataChunkHeaderDeserialize(): invalid header\n"
+        "Trade::dataChunkHeaderDeserialize(): expected signature Trade::DataChunkSignature::{2} but got Trade::DataChunkSignature::{3}\n"
+        "Trade::dataChunkHeaderDeserialize(): invalid chunk size {4}\n"
+        "Trade::dataChunkHeaderDeserialize(): expected {5} bytes for a Trade::DataChunkType::Mesh chunk but got {6}\n",
+        sizeof(DataChunkHeader), sizeof(DataChunkHeader) - 1,
+        DataChunkSignature::Current == DataChunkSignature::Little64 ? "Little64" : DataChunkSignature::Current == DataChunkSignature::Little32 ? "Little32" : DataChunkSignature::Current == DataChunkSignature::Big64 ? "Big64" : "Big32",
+        DataChunkSignature::Current == DataChunkSignature::Little64 ? "Big32" : "Little64",
+        sizeof(DataChunkHeader) + 4,
+        3*sizeof(DataChunkHeader), 2*sizeof(DataChunkHeader)));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::DataTest)
@@ -31,6 +31,7 @@
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/String.h>
 #include <Corrade/TestSuite/Compare/StringToFile.h>
 #include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/Path.h>
@@ -46,6 +47,9 @@ struct ImageConverterTest: TestSuite::Tester {
     explicit ImageConverterTest();
 
     void info();
+
+    void batch();
+    void batchList();
 };
 
 using namespace Containers::Literals;
@@ -100,6 +104,9 @@ ImageConverterTest::ImageConverterTest() {
     addInstancedTests({&ImageConverterTest::info},
         Containers::arraySize(InfoData));
 
+    addTests({&ImageConverterTest::batch,
+              &ImageConverterTest::batchList});
+
     /* Create output dir, if doesn't already exist */
     Utility::Path::make(Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles"));
 }
@@ -154,6 +161,80 @@ void ImageConverterTest::info() {
     #endif
 }
 
+void ImageConverterTest::batch() {
+    #ifndef IMAGECONVERTER_EXECUTABLE_FILENAME
+    CORRADE_SKIP("magnum-imageconverter not built, can't test");
+    #else
+    PluginManager::Manager<Trade::AbstractImporter> importerManager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    PluginManager::Manager<Trade::AbstractImageConverter> converterManager{MAGNUM_PLUGINS_IMAGECONVERTER_INSTALL_DIR};
+    if(!(importerManager.load("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin can't be loaded.");
+    if(!(converterManager.load("TgaImageConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImageConverter plugin can't be loaded.");
+
+    const Containers::String outputDirectory = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/batch");
+    const Containers::String outputFilename = Utility::Path::join(outputDirectory, "file.out.tga");
+    if(Utility::Path::exists(outputFilename))
+        CORRADE_VERIFY(Utility::Path::remove(outputFilename));
+
+    /* The output directory gets created if it doesn't exist */
+    Containers::Pair<bool, Containers::String> output = call({
+        "--batch", "--batch-extension", "out.tga", "--threads", "2",
+        "-I", "TgaImporter", "-C", "TgaImageConverter",
+        Utility::Path::join(TRADE_TEST_DIR, "ImageConverterTestFiles/file.tga"),
+        outputDirectory
+    });
+    CORRADE_COMPARE(output.second(), "");
+    CORRADE_VERIFY(output.first());
+    CORRADE_VERIFY(Utility::Path::exists(outputFilename));
+    #endif
+}
+
+void ImageConverterTest::batchList() {
+    #ifndef IMAGECONVERTER_EXECUTABLE_FILENAME
+    CORRADE_SKIP("magnum-imageconverter not built, can't test");
+    #else
+    PluginManager::Manager<Trade::AbstractImporter> importerManager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    PluginManager::Manager<Trade::AbstractImageConverter> converterManager{MAGNUM_PLUGINS_IMAGECONVERTER_INSTALL_DIR};
+    if(!(importerManager.load("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin can't be loaded.");
+    if(!(converterManager.load("TgaImageConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImageConverter plugin can't be loaded.");
+
+    const Containers::String input = Utility::Path::join(TRADE_TEST_DIR, "ImageConverterTestFiles/file.tga");
+    const Containers::String outputA = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/batch-a.tga");
+    const Containers::String outputB = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/batch-b.tga");
+    const Containers::String outputMissing = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/batch-missing.tga");
+    if(Utility::Path::exists(outputA))
+        CORRADE_VERIFY(Utility::Path::remove(outputA));
+    if(Utility::Path::exists(outputB))
+        CORRADE_VERIFY(Utility::Path::remove(outputB));
+
+    /* Comments and empty lines are skipped, a failed item doesn't stop the
+       others from being converted */
+    const Containers::String list = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/batch.txt");
+    const Containers::String listContents = Utility::format(
+        "# A comment\n"
+        "{}\t{}\n"
+        "\n"
+        "nonexistent.tga\t{}\n"
+        "{}\t{}\n", input, outputA, outputMissing, input, outputB);
+    CORRADE_VERIFY(Utility::Path::write(list, Containers::ArrayView<const void>{listContents.data(), listContents.size()}));
+
+    Containers::Pair<bool, Containers::String> output = call({
+        "--batch-list", list, "--threads", "2",
+        "-I", "TgaImporter", "-C", "TgaImageConverter"
+    });
+    CORRADE_VERIFY(!output.first());
+    CORRADE_COMPARE_AS(output.second(),
+        "1 out of 3 images failed to convert\n",
+        TestSuite::Compare::StringHasSuffix);
+    CORRADE_VERIFY(Utility::Path::exists(outputA));
+    CORRADE_VERIFY(Utility::Path::exists(outputB));
+    CORRADE_VERIFY(!Utility::Path::exists(outputMissing));
+    #endif
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::ImageConverterTest)
@@ -30,8 +30,10 @@
 #include "Magnum/Trade/ImageData.h"
 
 #include <sstream>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/DebugStl.h>
 
 #include "Magnum/ImageView.h"
@@ -86,6 +88,10 @@ struct ImageDataTest: TestSuite::Tester {
     void release();
     void releaseCompressed();
 
+    void serialize();
+    void serializeCompressed();
+    void deserializeInvalid();
+
     void pixels1D();
     void pixels2D();
     void pixels3D();
@@ -162,6 +168,10 @@ ImageDataTest::ImageDataTest() {
               &ImageDataTest::release,
               &ImageDataTest::releaseCompressed,
 
+              &ImageDataTest::serialize,
+              &ImageDataTest::serializeCompressed,
+              &ImageDataTest::deserializeInvalid,
+
               &ImageDataTest::pixels1D,
               &ImageDataTest::pixels2D,
               &ImageDataTest::pixels3D,
@@ -1160,6 +1170,85 @@ void ImageDataTest::pixelsCompressed() {
     CORRADE_COMPARE(out.str(), "Trade::ImageData::pixels(): the image is compressed\n");
 }
 
+void ImageDataTest::serialize() {
+    ImageData2D image{
+        PixelStorage{}
+            .setAlignment(1)
+            .setRowLength(2)
+            .setSkip({1, 0, 0}),
+        PixelFormat::RG8Unorm, {1, 3},
+        Containers::Array<char>{InPlaceInit, {
+            0, 0, 'a', 'b',
+            0, 0, 'c', 'd',
+            0, 0, 'e', 'f'
+        }}, ImageFlag2D::Array};
+
+    Containers::Array<char> serialized = image.serialize();
+    CORRADE_COMPARE(serialized.size(), image.serializedSize());
+    CORRADE_COMPARE(serialized.size() % 8, 0);
+    CORRADE_VERIFY(isDataChunk(serialized));
+
+    Containers::Optional<ImageData2D> deserialized = ImageData2D::deserialize(serialized);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_VERIFY(!deserialized->isCompressed());
+    CORRADE_COMPARE(deserialized->dataFlags(), DataFlags{});
+    CORRADE_COMPARE(deserialized->flags(), ImageFlag2D::Array);
+    CORRADE_COMPARE(deserialized->storage().alignment(), 1);
+    CORRADE_COMPARE(deserialized->storage().rowLength(), 2);
+    CORRADE_COMPARE(deserialized->storage().skip(), (Vector3i{1, 0, 0}));
+    CORRADE_COMPARE(deserialized->format(), PixelFormat::RG8Unorm);
+    CORRADE_COMPARE(deserialized->pixelSize(), 2);
+    CORRADE_COMPARE(deserialized->size(), (Vector2i{1, 3}));
+
+    /* Nothing is copied */
+    CORRADE_VERIFY(deserialized->data().data() > serialized.data());
+    CORRADE_VERIFY(deserialized->data().data() < serialized.end());
+    CORRADE_COMPARE(deserialized->pixels<Vector2ub>()[1][0], (Vector2ub{'c', 'd'}));
+
+    /* Serializing again gives the same output */
+    CORRADE_COMPARE_AS(deserialized->serialize(), serialized,
+        TestSuite::Compare::Container);
+}
+
+void ImageDataTest::serializeCompressed() {
+    ImageData3D image{
+        CompressedPixelStorage{}
+            .setCompressedBlockSize({4, 4, 1})
+            .setCompressedBlockDataSize(8),
+        CompressedPixelFormat::Bc1RGBAUnorm, {4, 4, 2},
+        Containers::Array<char>{ValueInit, 16}, ImageFlag3D::Array};
+
+    Containers::Array<char> serialized = image.serialize();
+    Containers::Optional<ImageData3D> deserialized = ImageData3D::deserialize(serialized);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_VERIFY(deserialized->isCompressed());
+    CORRADE_COMPARE(deserialized->flags(), ImageFlag3D::Array);
+    CORRADE_COMPARE(deserialized->compressedStorage().compressedBlockSize(), (Vector3i{4, 4, 1}));
+    CORRADE_COMPARE(deserialized->compressedStorage().compressedBlockDataSize(), 8);
+    CORRADE_COMPARE(deserialized->compressedFormat(), CompressedPixelFormat::Bc1RGBAUnorm);
+    CORRADE_COMPARE(deserialized->size(), (Vector3i{4, 4, 2}));
+    CORRADE_COMPARE(deserialized->data().size(), 16);
+}
+
+void ImageDataTest::deserializeInvalid() {
+    Containers::Array<char> serialized = ImageData2D{PixelFormat::R8Unorm, {4, 1}, Containers::Array<char>{ValueInit, 4}}.serialize();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    /* Valid chunk of a different type */
+    reinterpret_cast<DataChunkHeader*>(serialized.data())->type = DataChunkType::Mesh;
+    CORRADE_VERIFY(!ImageData2D::deserialize(serialized));
+
+    /* Valid image of a different dimension count */
+    reinterpret_cast<DataChunkHeader*>(serialized.data())->type = DataChunkType::Image;
+    CORRADE_VERIFY(!ImageData3D::deserialize(serialized));
+
+    CORRADE_COMPARE(out.str(),
+        "Trade::ImageData::deserialize(): expected a Trade::DataChunkType::Image chunk but got Trade::DataChunkType::Mesh\n"
+        "Trade::ImageData::deserialize(): expected a 3D image but got 2D\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::ImageDataTest)
@@ -26,6 +26,7 @@
 
 #include <algorithm> /* std::next_permutation() */
 #include <sstream>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StaticArray.h>
 #include <Corrade/Containers/StringStl.h> /* partition() on a std::string */
 #include <Corrade/TestSuite/Tester.h>
@@ -162,6 +163,11 @@ struct MaterialDataTest: TestSuite::Tester {
     void releaseAttributes();
     void releaseLayers();
 
+    void serialize();
+    void serializePointer();
+    void deserializeInvalid();
+    void deserializeInvalidAttribute();
+
     void templateLayerAccess();
     void templateLayerAccessMutable();
 
@@ -331,6 +337,11 @@ MaterialDataTest::MaterialDataTest() {
               &MaterialDataTest::releaseAttributes,
               &MaterialDataTest::releaseLayers,
 
+              &MaterialDataTest::serialize,
+              &MaterialDataTest::serializePointer,
+              &MaterialDataTest::deserializeInvalid,
+              &MaterialDataTest::deserializeInvalidAttribute,
+
               &MaterialDataTest::templateLayerAccess,
               &MaterialDataTest::templateLayerAccessMutable,
 
@@ -3445,6 +3456,142 @@ void MaterialDataTest::debugAlphaModePacked() {
     CORRADE_COMPARE(out.str(), "Opaque 0xee Trade::MaterialAlphaMode::Blend\n");
 }
 
+void MaterialDataTest::serialize() {
+    MaterialData data{MaterialType::Phong|MaterialType::PbrClearCoat, {
+        {MaterialAttribute::DiffuseColor, 0xff3366aa_rgbaf},
+        {MaterialAttribute::DoubleSided, true},
+        {MaterialLayer::ClearCoat},
+        {MaterialAttribute::LayerFactor, 0.35f},
+        {"name", "a very long string that doesn't fit into SSO"},
+    }, {2, 5}};
+
+    Containers::Optional<Containers::Array<char>> serialized = data.serialize();
+    CORRADE_VERIFY(serialized);
+    CORRADE_COMPARE(serialized->size(), data.serializedSize());
+    CORRADE_COMPARE(serialized->size() % 8, 0);
+    CORRADE_VERIFY(isDataChunk(*serialized));
+
+    Containers::Optional<MaterialData> deserialized = MaterialData::deserialize(*serialized);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_COMPARE(deserialized->types(), MaterialType::Phong|MaterialType::PbrClearCoat);
+    CORRADE_COMPARE(deserialized->attributeDataFlags(), DataFlags{});
+    CORRADE_COMPARE(deserialized->layerDataFlags(), DataFlags{});
+
+    /* Nothing is copied */
+    CORRADE_VERIFY(deserialized->attributeData().data() > static_cast<const void*>(serialized->data()));
+    CORRADE_VERIFY(deserialized->layerData().data() < static_cast<const void*>(serialized->end()));
+
+    CORRADE_COMPARE(deserialized->layerCount(), 2);
+    CORRADE_COMPARE(deserialized->attributeCount(0), 2);
+    CORRADE_COMPARE(deserialized->attributeCount(1), 3);
+    CORRADE_COMPARE(deserialized->attribute<Color4>(MaterialAttribute::DiffuseColor), 0xff3366aa_rgbaf);
+    CORRADE_COMPARE(deserialized->attribute<bool>(MaterialAttribute::DoubleSided), true);
+    CORRADE_COMPARE(deserialized->layerName(1), "ClearCoat");
+    CORRADE_COMPARE(deserialized->attribute<Float>(1, MaterialAttribute::LayerFactor), 0.35f);
+    CORRADE_COMPARE(deserialized->attribute<Containers::StringView>(1, "name"), "a very long string that doesn't fit into SSO");
+
+    /* Serializing again gives the same output */
+    Containers::Optional<Containers::Array<char>> serializedAgain = deserialized->serialize();
+    CORRADE_VERIFY(serializedAgain);
+    CORRADE_COMPARE_AS(*serializedAgain, *serialized,
+        TestSuite::Compare::Container);
+}
+
+void MaterialDataTest::serializePointer() {
+    const Float value{};
+    MaterialData data{{}, {
+        {MaterialAttribute::DiffuseColor, 0xff3366aa_rgbaf},
+        {"pointer", &value}
+    }};
+
+    Containers::Array<char> out{ValueInit, data.serializedSize()};
+
+    std::ostringstream err;
+    Error redirectError{&err};
+    CORRADE_COMPARE(data.serializeInto(out), 0);
+    CORRADE_VERIFY(!data.serialize());
+    CORRADE_COMPARE(err.str(),
+        "Trade::MaterialData::serializeInto(): can't serialize a Trade::MaterialAttributeType::Pointer attribute pointer\n"
+        "Trade::MaterialData::serializeInto(): can't serialize a Trade::MaterialAttributeType::Pointer attribute pointer\n");
+}
+
+void MaterialDataTest::deserializeInvalid() {
+    Containers::Optional<Containers::Array<char>> serialized = MaterialData{{}, {}}.serialize();
+    CORRADE_VERIFY(serialized);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    /* Valid chunk of a different type */
+    reinterpret_cast<DataChunkHeader*>(serialized->data())->type = DataChunkType::Image;
+    CORRADE_VERIFY(!MaterialData::deserialize(*serialized));
+
+    reinterpret_cast<DataChunkHeader*>(serialized->data())->type = DataChunkType::Material;
+    reinterpret_cast<DataChunkHeader*>(serialized->data())->typeVersion = 1;
+    CORRADE_VERIFY(!MaterialData::deserialize(*serialized));
+
+    CORRADE_COMPARE(out.str(),
+        "Trade::MaterialData::deserialize(): expected a Trade::DataChunkType::Material chunk but got Trade::DataChunkType::Image\n"
+        "Trade::MaterialData::deserialize(): invalid chunk type version 1\n");
+}
+
+void MaterialDataTest::deserializeInvalidAttribute() {
+    const MaterialData material{{}, {
+        {"a", 1.0f},
+        {"b", "hello"_s}
+    }, {2}};
+    /* The attributes are right after the header, followed by the single
+       layer offset padded to 8 bytes */
+    const std::size_t attributeOffset = material.serializedSize() - 2*sizeof(MaterialAttributeData) - 8;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    /* Invalid type */
+    {
+        Containers::Optional<Containers::Array<char>> serialized = material.serialize();
+        CORRADE_VERIFY(serialized);
+        (*serialized)[attributeOffset] = 0;
+        CORRADE_VERIFY(!MaterialData::deserialize(*serialized));
+
+    /* Name not null-terminated */
+    } {
+        Containers::Optional<Containers::Array<char>> serialized = material.serialize();
+        CORRADE_VERIFY(serialized);
+        for(std::size_t i = 1; i != sizeof(MaterialAttributeData); ++i)
+            (*serialized)[attributeOffset + i] = 'a';
+        CORRADE_VERIFY(!MaterialData::deserialize(*serialized));
+
+    /* String value size too large, it's stored in the last byte */
+    } {
+        Containers::Optional<Containers::Array<char>> serialized = material.serialize();
+        CORRADE_VERIFY(serialized);
+        (*serialized)[attributeOffset + 2*sizeof(MaterialAttributeData) - 1] = 61;
+        CORRADE_VERIFY(!MaterialData::deserialize(*serialized));
+
+    /* Attributes not sorted */
+    } {
+        Containers::Optional<Containers::Array<char>> serialized = material.serialize();
+        CORRADE_VERIFY(serialized);
+        (*serialized)[attributeOffset + 1] = 'c';
+        CORRADE_VERIFY(!MaterialData::deserialize(*serialized));
+
+    /* Layer offset out of range */
+    } {
+        Containers::Optional<Containers::Array<char>> serialized = material.serialize();
+        CORRADE_VERIFY(serialized);
+        *reinterpret_cast<UnsignedInt*>(serialized->data() + serialized->size() - 8) = 3;
+        CORRADE_VERIFY(!MaterialData::deserialize(*serialized));
+    }
+
+    CORRADE_COMPARE(out.str(),
+        "Trade::MaterialData::deserialize(): invalid type Trade::MaterialAttributeType(0x0) of attribute 0\n"
+        "Trade::MaterialData::deserialize(): invalid name of attribute 0\n"
+        "Trade::MaterialData::deserialize(): invalid string value of attribute b\n"
+        "Trade::MaterialData::deserialize(): attribute b in layer 0 is duplicate or not sorted\n"
+        "Trade::MaterialData::deserialize(): invalid range (0, 3) for layer 0 with 2 attributes in total\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::MaterialDataTest)
@@ -33,6 +33,7 @@
 #include <Corrade/TestSuite/Compare/String.h>
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/DebugStl.h> /** @todo remove once Debug is stream-free */
+#include <Corrade/Utility/FormatStl.h>
 
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Half.h"
@@ -171,9 +172,11 @@ struct MeshDataTest: TestSuite::Tester {
     void positions3DIntoArrayInvalidSize();
     template<class T> void tangentsAsArray();
     template<class T> void tangentsAsArrayPackedSignedNormalized();
+    void tangentsAsArrayPacked1010102();
     void tangentsIntoArrayInvalidSize();
     template<class T> void bitangentSignsAsArray();
     template<class T> void bitangentSignsAsArrayPackedSignedNormalized();
+    void bitangentSignsAsArrayPacked1010102();
     void bitangentSignsAsArrayNotFourComponent();
     void bitangentSignsIntoArrayInvalidSize();
     template<class T> void bitangentsAsArray();
@@ -181,6 +184,7 @@ struct MeshDataTest: TestSuite::Tester {
     void bitangentsIntoArrayInvalidSize();
     template<class T> void normalsAsArray();
     template<class T> void normalsAsArrayPackedSignedNormalized();
+    void normalsAsArrayPacked1010102();
     void normalsIntoArrayInvalidSize();
     template<class T> void textureCoordinates2DAsArray();
     template<class T> void textureCoordinates2DAsArrayPackedUnsigned();
@@ -190,6 +194,7 @@ struct MeshDataTest: TestSuite::Tester {
     void textureCoordinates2DIntoArrayInvalidSize();
     template<class T> void colorsAsArray();
     template<class T> void colorsAsArrayPackedUnsignedNormalized();
+    void colorsAsArrayPacked1010102();
     void colorsIntoArrayInvalidSize();
     template<class T> void jointIdsAsArray();
     void jointIdsIntoArrayInvalidSizeStride();
@@ -214,6 +219,13 @@ struct MeshDataTest: TestSuite::Tester {
     void releaseIndexData();
     void releaseAttributeData();
     void releaseVertexData();
+
+    void serialize();
+    void serializeNonIndexed();
+    void deserializeInvalid();
+    void deserializeInvalidAttribute();
+    void deserializeMutable();
+    void deserializeOwned();
 };
 
 const struct {
@@ -253,6 +265,31 @@ const struct {
     {"morph target", 0, 37}
 };
 
+const struct {
+    const char* name;
+    MeshAttributeData attribute;
+    const char* message;
+} DeserializeInvalidAttributeData[]{
+    {"invalid format",
+        MeshAttributeData{meshAttributeCustom(1), VertexFormat(0xdead), 0, 3, 8},
+        "invalid format VertexFormat(0xdead) of attribute 0"},
+    {"vertex count mismatch",
+        MeshAttributeData{meshAttributeCustom(1), VertexFormat::Vector2, 0, 2, 8},
+        "attribute 0 has 2 vertices but 3 expected"},
+    {"offset out of range",
+        MeshAttributeData{meshAttributeCustom(1), VertexFormat::Vector2, 8, 3, 8},
+        "attribute 0 of 3 vertices with VertexFormat::Vector2[0] and a stride of 8 at offset 8 out of range for 24 bytes of vertex data"},
+    {"stride out of range",
+        MeshAttributeData{meshAttributeCustom(1), VertexFormat::Vector2, 0, 3, 12},
+        "attribute 0 of 3 vertices with VertexFormat::Vector2[0] and a stride of 12 at offset 0 out of range for 24 bytes of vertex data"},
+    {"negative stride out of range",
+        MeshAttributeData{meshAttributeCustom(1), VertexFormat::Vector2, 8, 3, -8},
+        "attribute 0 of 3 vertices with VertexFormat::Vector2[0] and a stride of -8 at offset 8 out of range for 24 bytes of vertex data"},
+    {"array size out of range",
+        MeshAttributeData{meshAttributeCustom(1), VertexFormat::Vector2, 0, 3, 8, 2},
+        "attribute 0 of 3 vertices with VertexFormat::Vector2[2] and a stride of 8 at offset 0 out of range for 24 bytes of vertex data"},
+};
+
 MeshDataTest::MeshDataTest() {
     addTests({&MeshDataTest::customAttributeName,
               &MeshDataTest::customAttributeNameTooLarge,
@@ -435,6 +472,7 @@ MeshDataTest::MeshDataTest() {
               &MeshDataTest::tangentsAsArrayPackedSignedNormalized<Vector3s>,
               &MeshDataTest::tangentsAsArrayPackedSignedNormalized<Vector4b>,
               &MeshDataTest::tangentsAsArrayPackedSignedNormalized<Vector4s>,
+              &MeshDataTest::tangentsAsArrayPacked1010102,
               &MeshDataTest::tangentsIntoArrayInvalidSize});
 
     addInstancedTests<MeshDataTest>({
@@ -444,6 +482,7 @@ MeshDataTest::MeshDataTest() {
 
     addTests({&MeshDataTest::bitangentSignsAsArrayPackedSignedNormalized<Byte>,
               &MeshDataTest::bitangentSignsAsArrayPackedSignedNormalized<Short>,
+              &MeshDataTest::bitangentSignsAsArrayPacked1010102,
               &MeshDataTest::bitangentSignsAsArrayNotFourComponent,
               &MeshDataTest::bitangentSignsIntoArrayInvalidSize});
 
@@ -463,6 +502,7 @@ MeshDataTest::MeshDataTest() {
 
     addTests({&MeshDataTest::normalsAsArrayPackedSignedNormalized<Vector3b>,
               &MeshDataTest::normalsAsArrayPackedSignedNormalized<Vector3s>,
+              &MeshDataTest::normalsAsArrayPacked1010102,
               &MeshDataTest::normalsIntoArrayInvalidSize});
 
     addInstancedTests<MeshDataTest>({
@@ -491,6 +531,7 @@ MeshDataTest::MeshDataTest() {
               &MeshDataTest::colorsAsArrayPackedUnsignedNormalized<Color3us>,
               &MeshDataTest::colorsAsArrayPackedUnsignedNormalized<Color4ub>,
               &MeshDataTest::colorsAsArrayPackedUnsignedNormalized<Color4us>,
+              &MeshDataTest::colorsAsArrayPacked1010102,
               &MeshDataTest::colorsIntoArrayInvalidSize,
               &MeshDataTest::jointIdsAsArray<UnsignedInt>,
               &MeshDataTest::jointIdsAsArray<UnsignedByte>,
@@ -520,7 +561,17 @@ MeshDataTest::MeshDataTest() {
 
               &MeshDataTest::releaseIndexData,
               &MeshDataTest::releaseAttributeData,
-              &MeshDataTest::releaseVertexData});
+              &MeshDataTest::releaseVertexData,
+
+              &MeshDataTest::serialize,
+              &MeshDataTest::serializeNonIndexed,
+              &MeshDataTest::deserializeInvalid});
+
+    addInstancedTests({&MeshDataTest::deserializeInvalidAttribute},
+        Containers::arraySize(DeserializeInvalidAttributeData));
+
+    addTests({&MeshDataTest::deserializeMutable,
+              &MeshDataTest::deserializeOwned});
 }
 
 void MeshDataTest::customAttributeName() {
@@ -3622,6 +3673,41 @@ template<class T> void MeshDataTest::tangentsAsArrayPackedSignedNormalized() {
     }), TestSuite::Compare::Container);
 }
 
+void MeshDataTest::tangentsAsArrayPacked1010102() {
+    /* Three-component */
+    {
+        UnsignedInt tangents[]{
+            0x1ff001ff, /* {1.0f, 0.0f, 1.0f} */
+            0x00080400  /* {0.0f, -1.0f, 0.0f} */
+        };
+
+        MeshData data{MeshPrimitive::Points, {}, tangents, {
+            MeshAttributeData{MeshAttribute::Tangent,
+                VertexFormat::Vector3i1010102Normalized,
+                Containers::arrayView(tangents)}
+        }};
+        CORRADE_COMPARE_AS(data.tangentsAsArray(), Containers::arrayView<Vector3>({
+            {1.0f, 0.0f, 1.0f}, {0.0f, -1.0f, 0.0f}
+        }), TestSuite::Compare::Container);
+
+    /* Four-component, the last component is ignored */
+    } {
+        UnsignedInt tangents[]{
+            0xdff001ff, /* {1.0f, 0.0f, 1.0f, -1.0f} */
+            0x40080400  /* {0.0f, -1.0f, 0.0f, 1.0f} */
+        };
+
+        MeshData data{MeshPrimitive::Points, {}, tangents, {
+            MeshAttributeData{MeshAttribute::Tangent,
+                VertexFormat::Vector4i1010102Normalized,
+                Containers::arrayView(tangents)}
+        }};
+        CORRADE_COMPARE_AS(data.tangentsAsArray(), Containers::arrayView<Vector3>({
+            {1.0f, 0.0f, 1.0f}, {0.0f, -1.0f, 0.0f}
+        }), TestSuite::Compare::Container);
+    }
+}
+
 void MeshDataTest::tangentsIntoArrayInvalidSize() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -3689,6 +3775,23 @@ template<class T> void MeshDataTest::bitangentSignsAsArrayPackedSignedNormalized
     }), TestSuite::Compare::Container);
 }
 
+void MeshDataTest::bitangentSignsAsArrayPacked1010102() {
+    UnsignedInt tangents[]{
+        0xdff001ff, /* {1.0f, 0.0f, 1.0f, -1.0f} */
+        0x40080400, /* {0.0f, -1.0f, 0.0f, 1.0f} */
+        0x80000000  /* -2 in the top bits, clamped to -1 */
+    };
+
+    MeshData data{MeshPrimitive::Points, {}, tangents, {
+        MeshAttributeData{MeshAttribute::Tangent,
+            VertexFormat::Vector4i1010102Normalized,
+            Containers::arrayView(tangents)}
+    }};
+    CORRADE_COMPARE_AS(data.bitangentSignsAsArray(), Containers::arrayView<Float>({
+        -1.0f, 1.0f, -1.0f
+    }), TestSuite::Compare::Container);
+}
+
 void MeshDataTest::bitangentSignsAsArrayNotFourComponent() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -3844,6 +3947,22 @@ template<class T> void MeshDataTest::normalsAsArrayPackedSignedNormalized() {
     }), TestSuite::Compare::Container);
 }
 
+void MeshDataTest::normalsAsArrayPacked1010102() {
+    UnsignedInt normals[]{
+        0x1ff001ff, /* {1.0f, 0.0f, 1.0f} */
+        0x00080400  /* {0.0f, -1.0f, 0.0f} */
+    };
+
+    MeshData data{MeshPrimitive::Points, {}, normals, {
+        MeshAttributeData{MeshAttribute::Normal,
+            VertexFormat::Vector3i1010102Normalized,
+            Containers::arrayView(normals)}
+    }};
+    CORRADE_COMPARE_AS(data.normalsAsArray(), Containers::arrayView<Vector3>({
+        {1.0f, 0.0f, 1.0f}, {0.0f, -1.0f, 0.0f}
+    }), TestSuite::Compare::Container);
+}
+
 void MeshDataTest::normalsIntoArrayInvalidSize() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -4033,6 +4152,22 @@ template<class T> void MeshDataTest::colorsAsArrayPackedUnsignedNormalized() {
     }), TestSuite::Compare::Container);
 }
 
+void MeshDataTest::colorsAsArrayPacked1010102() {
+    UnsignedInt colors[]{
+        0x7ff003ff, /* {1.0f, 0.0f, 1.0f, 1.0f/3.0f} */
+        0xc00ffc00  /* {0.0f, 1.0f, 0.0f, 1.0f} */
+    };
+
+    MeshData data{MeshPrimitive::Points, {}, colors, {
+        MeshAttributeData{MeshAttribute::Color,
+            VertexFormat::Vector4ui1010102Normalized,
+            Containers::arrayView(colors)}
+    }};
+    CORRADE_COMPARE_AS(data.colorsAsArray(), Containers::arrayView<Color4>({
+        {1.0f, 0.0f, 1.0f, 1.0f/3.0f}, {0.0f, 1.0f, 0.0f, 1.0f}
+    }), TestSuite::Compare::Container);
+}
+
 void MeshDataTest::colorsIntoArrayInvalidSize() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -4749,6 +4884,184 @@ void MeshDataTest::releaseVertexData() {
     CORRADE_COMPARE(data.attributeOffset(0), 48);
 }
 
+void MeshDataTest::serialize() {
+    struct Vertex {
+        Vector3 position;
+        Vector2 textureCoordinates;
+    };
+    Containers::Array<char> vertexData{3*sizeof(Vertex)};
+    auto vertices = Containers::arrayCast<Vertex>(vertexData);
+    vertices[0] = {{0.1f, 0.2f, 0.3f}, {0.0f, 1.0f}};
+    vertices[1] = {{0.4f, 0.5f, 0.6f}, {1.0f, 0.0f}};
+    vertices[2] = {{0.7f, 0.8f, 0.9f}, {0.5f, 0.5f}};
+
+    /* Index data with a prefix to verify the offset is preserved */
+    Containers::Array<char> indexData{2 + 4*sizeof(UnsignedShort)};
+    auto indices = Containers::arrayCast<UnsignedShort>(indexData.exceptPrefix(2));
+    Utility::copy({0, 2, 1, 0}, indices);
+
+    MeshData mesh{MeshPrimitive::Lines,
+        Utility::move(indexData), MeshIndexData{indices},
+        Utility::move(vertexData), {
+            MeshAttributeData{MeshAttribute::Position, vertices.slice(&Vertex::position)},
+            MeshAttributeData{MeshAttribute::TextureCoordinates, vertices.slice(&Vertex::textureCoordinates)},
+        }};
+
+    Containers::Array<char> serialized = mesh.serialize();
+    CORRADE_COMPARE(serialized.size(), mesh.serializedSize());
+    CORRADE_COMPARE(serialized.size() % 8, 0);
+    CORRADE_VERIFY(isDataChunk(serialized));
+
+    Containers::Optional<MeshData> deserialized = MeshData::deserialize(serialized);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_COMPARE(deserialized->primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE(deserialized->indexDataFlags(), DataFlags{});
+    CORRADE_COMPARE(deserialized->vertexDataFlags(), DataFlags{});
+
+    /* Nothing is copied */
+    CORRADE_VERIFY(deserialized->indexData().data() > serialized.data());
+    CORRADE_VERIFY(deserialized->vertexData().data() < serialized.end());
+
+    CORRADE_VERIFY(deserialized->isIndexed());
+    CORRADE_COMPARE(deserialized->indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(deserialized->indexOffset(), 2);
+    CORRADE_COMPARE_AS(deserialized->indices<UnsignedShort>(),
+        Containers::arrayView<UnsignedShort>({0, 2, 1, 0}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(deserialized->vertexCount(), 3);
+    CORRADE_COMPARE(deserialized->attributeCount(), 2);
+    CORRADE_COMPARE(deserialized->attributeName(1), MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE(deserialized->attributeOffset(1), sizeof(Vector3));
+    CORRADE_COMPARE(deserialized->attributeStride(1), sizeof(Vertex));
+    CORRADE_COMPARE_AS(deserialized->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {0.1f, 0.2f, 0.3f},
+            {0.4f, 0.5f, 0.6f},
+            {0.7f, 0.8f, 0.9f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(deserialized->attribute<Vector2>(MeshAttribute::TextureCoordinates),
+        Containers::arrayView<Vector2>({
+            {0.0f, 1.0f},
+            {1.0f, 0.0f},
+            {0.5f, 0.5f}
+        }), TestSuite::Compare::Container);
+
+    /* Serializing again gives the same output */
+    CORRADE_COMPARE_AS(deserialized->serialize(), serialized,
+        TestSuite::Compare::Container);
+}
+
+void MeshDataTest::serializeNonIndexed() {
+    MeshData mesh{MeshPrimitive::Points, 37};
+
+    Containers::Array<char> serialized = mesh.serialize();
+    Containers::Optional<MeshData> deserialized = MeshData::deserialize(serialized);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_COMPARE(deserialized->primitive(), MeshPrimitive::Points);
+    CORRADE_VERIFY(!deserialized->isIndexed());
+    CORRADE_COMPARE(deserialized->attributeCount(), 0);
+    CORRADE_COMPARE(deserialized->vertexCount(), 37);
+}
+
+void MeshDataTest::deserializeInvalid() {
+    Containers::Array<char> serialized = MeshData{MeshPrimitive::Points, 37}.serialize();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    /* Valid chunk of a different type */
+    reinterpret_cast<DataChunkHeader*>(serialized.data())->type = DataChunkType::Scene;
+    CORRADE_VERIFY(!MeshData::deserialize(serialized));
+
+    reinterpret_cast<DataChunkHeader*>(serialized.data())->type = DataChunkType::Mesh;
+    reinterpret_cast<DataChunkHeader*>(serialized.data())->typeVersion = 1;
+    CORRADE_VERIFY(!MeshData::deserialize(serialized));
+
+    /* Header too small for a mesh. The original chunk has no data so its
+       size is just the mesh header. */
+    reinterpret_cast<DataChunkHeader*>(serialized.data())->typeVersion = 0;
+    reinterpret_cast<DataChunkHeader*>(serialized.data())->size = sizeof(DataChunkHeader);
+    CORRADE_VERIFY(!MeshData::deserialize(serialized));
+
+    CORRADE_COMPARE(out.str(), Utility::formatString(
+        "Trade::MeshData::deserialize(): expected a Trade::DataChunkType::Mesh chunk but got Trade::DataChunkType::Scene\n"
+        "Trade::MeshData::deserialize(): invalid chunk type version 1\n"
+        "Trade::MeshData::deserialize(): expected at least {} bytes for a Trade::DataChunkType::Mesh chunk header but got {}\n",
+        serialized.size(), sizeof(DataChunkHeader)));
+}
+
+void MeshDataTest::deserializeInvalidAttribute() {
+    auto&& data = DeserializeInvalidAttributeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> serialized = MeshData{MeshPrimitive::Points,
+        Containers::Array<char>{ValueInit, 3*sizeof(Vector2)}, {
+            MeshAttributeData{meshAttributeCustom(1), VertexFormat::Vector2, 0, 3, sizeof(Vector2)}
+        }}.serialize();
+    CORRADE_VERIFY(MeshData::deserialize(serialized));
+
+    /* The attribute is right after the header, followed by the vertex data,
+       both padded to 8 bytes */
+    const std::size_t attributeOffset = serialized.size() - 3*sizeof(Vector2) - (sizeof(MeshAttributeData) + 7)/8*8;
+    *reinterpret_cast<MeshAttributeData*>(serialized.data() + attributeOffset) = data.attribute;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!MeshData::deserialize(serialized));
+    CORRADE_COMPARE(out.str(), Utility::formatString("Trade::MeshData::deserialize(): {}\n", data.message));
+}
+
+void MeshDataTest::deserializeMutable() {
+    Containers::Array<char> indexData{3*sizeof(UnsignedByte)};
+    auto indices = Containers::arrayCast<UnsignedByte>(indexData);
+    Utility::copy({2, 0, 1}, indices);
+    Containers::Array<char> vertexData{3*sizeof(Vector2)};
+    auto positions = Containers::arrayCast<Vector2>(vertexData);
+    Utility::copy({{0.1f, 0.2f}, {0.3f, 0.4f}, {0.5f, 0.6f}}, positions);
+
+    Containers::Array<char> serialized = MeshData{MeshPrimitive::Triangles,
+        Utility::move(indexData), MeshIndexData{indices},
+        Utility::move(vertexData), {
+            MeshAttributeData{MeshAttribute::Position, positions}
+        }}.serialize();
+
+    /* Such as a memory-mapped file */
+    Containers::Optional<MeshData> deserialized = MeshData::deserialize(serialized, DataFlag::Mutable);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_COMPARE(deserialized->indexDataFlags(), DataFlag::Mutable);
+    CORRADE_COMPARE(deserialized->vertexDataFlags(), DataFlag::Mutable);
+
+    deserialized->mutableIndices<UnsignedByte>()[0] = 1;
+    deserialized->mutableAttribute<Vector2>(MeshAttribute::Position)[2] = {7.0f, 8.0f};
+
+    /* The modifications are done directly in the original memory, so
+       deserializing again sees them */
+    Containers::Optional<MeshData> again = MeshData::deserialize(serialized);
+    CORRADE_VERIFY(again);
+    CORRADE_COMPARE_AS(again->indices<UnsignedByte>(),
+        Containers::arrayView<UnsignedByte>({1, 0, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(again->attribute<Vector2>(MeshAttribute::Position),
+        Containers::arrayView<Vector2>({
+            {0.1f, 0.2f},
+            {0.3f, 0.4f},
+            {7.0f, 8.0f}
+        }), TestSuite::Compare::Container);
+}
+
+void MeshDataTest::deserializeOwned() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::Array<char> serialized = MeshData{MeshPrimitive::Points, 37}.serialize();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshData::deserialize(serialized, DataFlag::Owned);
+    CORRADE_COMPARE(out.str(),
+        "Trade::MeshData::deserialize(): can't reference non-owned data but got Trade::DataFlag::Owned\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshDataTest)
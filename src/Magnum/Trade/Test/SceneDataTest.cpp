@@ -248,6 +248,10 @@ struct SceneDataTest: TestSuite::Tester {
 
     void releaseFieldData();
     void releaseData();
+
+    void serialize();
+    void deserializeInvalid();
+    void deserializeInvalidField();
 };
 
 const struct {
@@ -407,6 +411,49 @@ const struct {
 };
 #endif
 
+const struct {
+    const char* name;
+    SceneFieldData fields[2];
+    const char* message;
+} DeserializeInvalidFieldData[]{
+    {"mapping data out of range", {
+        SceneFieldData{sceneFieldCustom(1), 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Float, 16, 4},
+        SceneFieldData{sceneFieldCustom(2), 3, SceneMappingType::UnsignedInt, 56, 4, SceneFieldType::Float, 16, 4}
+    }, "mapping data of field 1 with 3 entries and a stride of 4 at offset 56 out of range for 64 bytes of data"},
+    {"mapping data with a negative stride out of range", {
+        SceneFieldData{sceneFieldCustom(1), 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Float, 16, 4},
+        SceneFieldData{sceneFieldCustom(2), 3, SceneMappingType::UnsignedInt, 4, -4, SceneFieldType::Float, 16, 4}
+    }, "mapping data of field 1 with 3 entries and a stride of -4 at offset 4 out of range for 64 bytes of data"},
+    {"field data out of range", {
+        SceneFieldData{sceneFieldCustom(1), 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Float, 16, 4},
+        SceneFieldData{sceneFieldCustom(2), 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Float, 56, 4}
+    }, "field data of field 1 with 3 entries of Trade::SceneFieldType::Float[0] and a stride of 4 at offset 56 out of range for 64 bytes of data"},
+    {"field array out of range", {
+        SceneFieldData{sceneFieldCustom(1), 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Float, 16, 4},
+        SceneFieldData{sceneFieldCustom(2), 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Float, 16, 16, 5}
+    }, "field data of field 1 with 3 entries of Trade::SceneFieldType::Float[5] and a stride of 16 at offset 16 out of range for 64 bytes of data"},
+    {"inconsistent mapping type", {
+        SceneFieldData{sceneFieldCustom(1), 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Float, 16, 4},
+        SceneFieldData{sceneFieldCustom(2), 3, SceneMappingType::UnsignedShort, 0, 2, SceneFieldType::Float, 16, 4}
+    }, "inconsistent mapping type, got Trade::SceneMappingType::UnsignedShort for field 1 but expected Trade::SceneMappingType::UnsignedInt"},
+    {"duplicate field", {
+        SceneFieldData{sceneFieldCustom(1), 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Float, 16, 4},
+        SceneFieldData{sceneFieldCustom(1), 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Float, 16, 4}
+    }, "duplicate field Trade::SceneField::Custom(1)"},
+    {"transformation dimension mismatch", {
+        SceneFieldData{SceneField::Translation, 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Vector2, 16, 8},
+        SceneFieldData{SceneField::Rotation, 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Quaternion, 16, 16}
+    }, "expected a 2D Trade::SceneField::Rotation field but got Trade::SceneFieldType::Quaternion"},
+    {"shared mapping mismatch", {
+        SceneFieldData{SceneField::Translation, 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Vector2, 16, 8},
+        SceneFieldData{SceneField::Rotation, 2, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Complex, 16, 8}
+    }, "Trade::SceneField::Rotation mapping data are different from Trade::SceneField::Translation mapping data"},
+    {"skin without a transformation", {
+        SceneFieldData{SceneField::Skin, 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::UnsignedInt, 16, 4},
+        SceneFieldData{sceneFieldCustom(2), 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Float, 16, 4}
+    }, "a skin field requires some transformation field to be present in order to disambiguate between 2D and 3D"},
+};
+
 SceneDataTest::SceneDataTest() {
     addTests({&SceneDataTest::mappingTypeSizeAlignment,
               &SceneDataTest::mappingTypeSizeAlignmentInvalid,
@@ -675,7 +722,13 @@ SceneDataTest::SceneDataTest() {
               &SceneDataTest::findFieldObjectOffsetInvalidObject,
 
               &SceneDataTest::releaseFieldData,
-              &SceneDataTest::releaseData});
+              &SceneDataTest::releaseData,
+
+              &SceneDataTest::serialize,
+              &SceneDataTest::deserializeInvalid});
+
+    addInstancedTests({&SceneDataTest::deserializeInvalidField},
+        Containers::arraySize(DeserializeInvalidFieldData));
 }
 
 using namespace Containers::Literals;
@@ -7694,6 +7747,123 @@ void SceneDataTest::releaseData() {
     CORRADE_COMPARE(scene.mappingType(), SceneMappingType::UnsignedByte);
 }
 
+void SceneDataTest::serialize() {
+    struct Data {
+        UnsignedInt mapping[3];
+        Int parent[3];
+        UnsignedByte nameEnd[3];
+        char nameString[13];
+    };
+    Containers::Array<char> data{ValueInit, sizeof(Data)};
+    Data& d = *reinterpret_cast<Data*>(data.data());
+    Utility::copy({2, 0, 1}, d.mapping);
+    Utility::copy({-1, 2, 0}, d.parent);
+    Utility::copy({5, 9, 13}, d.nameEnd);
+    Utility::copy(Containers::arrayView("ChairLampDesk", 13), d.nameString);
+
+    /* The parent field is offset-only, the string field is with pointers to
+       verify the conversion to offset-only during serialization */
+    SceneData scene{SceneMappingType::UnsignedInt, 3, Utility::move(data), {
+        SceneFieldData{SceneField::Parent, 3,
+            SceneMappingType::UnsignedInt, offsetof(Data, mapping), sizeof(UnsignedInt),
+            SceneFieldType::Int, offsetof(Data, parent), sizeof(Int)},
+        SceneFieldData{sceneFieldCustom(25), Containers::arrayView(d.mapping),
+            d.nameString, SceneFieldType::StringRange8,
+            Containers::arrayView(d.nameEnd)}
+    }};
+
+    Containers::Array<char> serialized = scene.serialize();
+    CORRADE_COMPARE(serialized.size(), scene.serializedSize());
+    CORRADE_COMPARE(serialized.size() % 8, 0);
+    CORRADE_VERIFY(isDataChunk(serialized));
+
+    Containers::Optional<SceneData> deserialized = SceneData::deserialize(serialized);
+    CORRADE_VERIFY(deserialized);
+    CORRADE_COMPARE(deserialized->dataFlags(), DataFlags{});
+    CORRADE_COMPARE(deserialized->mappingType(), SceneMappingType::UnsignedInt);
+    CORRADE_COMPARE(deserialized->mappingBound(), 3);
+    CORRADE_COMPARE(deserialized->fieldCount(), 2);
+
+    /* Nothing is copied */
+    CORRADE_VERIFY(deserialized->data().data() > serialized.data());
+    CORRADE_VERIFY(deserialized->data().data() < serialized.end());
+
+    /* All fields are offset-only after a round trip */
+    CORRADE_COMPARE(deserialized->fieldFlags(0), SceneFieldFlag::OffsetOnly);
+    CORRADE_COMPARE(deserialized->fieldFlags(1), SceneFieldFlag::OffsetOnly);
+
+    CORRADE_COMPARE_AS(deserialized->mapping<UnsignedInt>(SceneField::Parent),
+        Containers::arrayView<UnsignedInt>({2, 0, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(deserialized->field<Int>(SceneField::Parent),
+        Containers::arrayView<Int>({-1, 2, 0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(deserialized->mapping<UnsignedInt>(sceneFieldCustom(25)),
+        Containers::arrayView<UnsignedInt>({2, 0, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(deserialized->fieldStrings(sceneFieldCustom(25)),
+        Containers::arrayView({"Chair"_s, "Lamp"_s, "Desk"_s}),
+        TestSuite::Compare::Container);
+
+    /* Serializing again gives the same output */
+    CORRADE_COMPARE_AS(deserialized->serialize(), serialized,
+        TestSuite::Compare::Container);
+}
+
+void SceneDataTest::deserializeInvalid() {
+    Containers::Array<char> serialized = SceneData{SceneMappingType::UnsignedInt, 5, nullptr, {}}.serialize();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    /* Valid chunk of a different type */
+    reinterpret_cast<DataChunkHeader*>(serialized.data())->type = DataChunkType::Mesh;
+    CORRADE_VERIFY(!SceneData::deserialize(serialized));
+
+    reinterpret_cast<DataChunkHeader*>(serialized.data())->type = DataChunkType::Scene;
+    reinterpret_cast<DataChunkHeader*>(serialized.data())->typeVersion = 1;
+    CORRADE_VERIFY(!SceneData::deserialize(serialized));
+
+    /* Field data reaching past the chunk end. The field count is after the
+       64-bit mapping bound and the mapping type padded to four bytes. */
+    reinterpret_cast<DataChunkHeader*>(serialized.data())->typeVersion = 0;
+    *reinterpret_cast<UnsignedInt*>(serialized.data() + sizeof(DataChunkHeader) + 12) = 1;
+    CORRADE_VERIFY(!SceneData::deserialize(serialized));
+
+    /* Field count so large that the total size would overflow on 32-bit */
+    *reinterpret_cast<UnsignedInt*>(serialized.data() + sizeof(DataChunkHeader) + 12) = 0xffffffffu;
+    CORRADE_VERIFY(!SceneData::deserialize(serialized));
+
+    CORRADE_COMPARE(out.str(), Utility::formatString(
+        "Trade::SceneData::deserialize(): expected a Trade::DataChunkType::Scene chunk but got Trade::DataChunkType::Mesh\n"
+        "Trade::SceneData::deserialize(): invalid chunk type version 1\n"
+        "Trade::SceneData::deserialize(): field data of {} bytes at offset {} out of range for a chunk of {} bytes\n"
+        "Trade::SceneData::deserialize(): field data of 4294967295 items out of range for a chunk of {} bytes\n",
+        sizeof(SceneFieldData), serialized.size(), serialized.size(), serialized.size()));
+}
+
+void SceneDataTest::deserializeInvalidField() {
+    auto&& data = DeserializeInvalidFieldData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> serialized = SceneData{SceneMappingType::UnsignedInt, 3, Containers::Array<char>{ValueInit, 64}, {
+        SceneFieldData{sceneFieldCustom(1), 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Float, 16, 4},
+        SceneFieldData{sceneFieldCustom(2), 3, SceneMappingType::UnsignedInt, 0, 4, SceneFieldType::Float, 16, 4}
+    }}.serialize();
+    CORRADE_VERIFY(SceneData::deserialize(serialized));
+
+    /* The fields are right after the header, followed by the data, both
+       padded to 8 bytes */
+    SceneFieldData* fields = reinterpret_cast<SceneFieldData*>(serialized.data() + serialized.size() - 64 - (2*sizeof(SceneFieldData) + 7)/8*8);
+    fields[0] = data.fields[0];
+    fields[1] = data.fields[1];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!SceneData::deserialize(serialized));
+    CORRADE_COMPARE(out.str(), Utility::formatString("Trade::SceneData::deserialize(): {}\n", data.message));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::SceneDataTest)
@@ -24,6 +24,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Pair.h>
@@ -45,6 +46,13 @@
 #include "Magnum/Trade/ImageData.h"
 #include "Magnum/Trade/Implementation/converterUtilities.h"
 
+#if defined(CORRADE_BUILD_MULTITHREADED) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#include <atomic>
+#include <thread>
+
+#define MAGNUM_IMAGECONVERTER_THREADS
+#endif
+
 namespace Magnum {
 
 /** @page magnum-imageconverter Image conversion utility
@@ -181,6 +189,14 @@ magnum-imageconverter --info-converter -C StbResizeImageConverter -c size="512 5
 
 @endparblock
 
+Converting all PNG files in a directory to KTX2 files in another directory,
+processing them on all available CPU cores and printing timing of each image:
+
+@code{.sh}
+magnum-imageconverter --batch --batch-extension ktx2 --threads 0 --profile \
+    textures/*.png textures-ktx/
+@endcode
+
 @subsection magnum-imageconverter-example-levels-layers Dealing with image levels and layers
 
 Converting six 2D images to a 3D cube map file using @relativeref{Trade,OpenExrImageConverter}. Note the `-c envmap-cube` which the
@@ -216,6 +232,7 @@ magnum-imageconverter [-h|--help] [-I|--importer PLUGIN]
     [-i|--importer-options key=val,key2=val2,…]
     [-c|--converter-options key=val,key2=val2,…]... [-D|--dimensions N]
     [--image N] [--level N] [--layer N] [--layers] [--levels] [--in-place]
+    [--batch] [--batch-list FILE] [--batch-extension EXT] [--threads N]
     [--info-importer] [--info-converter] [--info] [--color on|off|auto]
     [-v|--verbose] [--profile] [--] input output
 @endcode
@@ -223,8 +240,8 @@ magnum-imageconverter [-h|--help] [-I|--importer PLUGIN]
 Arguments:
 
 -   `input` --- input image
--   `output` --- output image; ignored if `--info` is present, disallowed for
-    `--in-place`
+-   `output` --- output image or a directory for `--batch`; ignored if
+    `--info` is present, disallowed for `--in-place`
 -   `-h`, `--help` --- display this help message and exit
 -   `-I`, `--importer PLUGIN` --- image importer plugin (default:
     @ref Trade::AnyImageImporter "AnyImageImporter")
@@ -246,6 +263,13 @@ Arguments:
     more
 -   `--levels` --- combine multiple image levels into a single file
 -   `--in-place` --- overwrite the input image with the output
+-   `--batch` --- convert each input image separately to the output directory
+-   `--batch-list FILE` --- read tab-separated input and output pairs to
+    convert from a file
+-   `--batch-extension EXT` --- replace the input file extension with given
+    one in `--batch`
+-   `--threads N` --- number of threads to use for `--batch`, `0` for all
+    available (default: `1`)
 -   `--info-importer` --- print info about the importer plugin and exit
 -   `--info-converter` --- print info about the image converter plugin and exit
 -   `--info` --- print info about the input file and exit
@@ -284,6 +308,25 @@ image-to-image or image-to-file conversion. If the last converter doesn't
 support conversion to a file, @relativeref{Trade,AnyImageConverter} is used to
 save its output; if no `-C` / `--converter` is specified,
 @relativeref{Trade,AnyImageConverter} is used.
+
+If `--batch` is given, each input is converted separately to a file of the
+same name in the directory specified as `output`, optionally with the extension
+replaced with `--batch-extension`, or each input is overwritten if
+`--in-place` is set. Alternatively, `--batch-list` reads input and output
+filenames from a file, one tab-separated pair per line, ignoring empty lines
+and lines starting with `#`. All other options apply to each image the same
+way as when converting a single file, except for `--layers`, `--levels` and
+`--info`, which can't be used in batch mode. Plugins are loaded just once and
+reused for all images. If `--threads` is set to a value other than `1`, the
+images are converted on multiple worker threads, each having its own plugin
+managers, as they aren't thread-safe. Output of each image is buffered and
+printed in the original order once all images are processed. Failure to
+convert one image doesn't stop the others, the utility then exits with a
+non-zero code and prints how many images failed. With `--profile`, import and
+conversion time of each image is printed, followed by the total import and
+conversion time summed across all images and threads, and the wall time of the
+whole batch. Parallel processing isn't available on platforms without thread
+support.
 */
 
 }
@@ -298,7 +341,7 @@ bool isPluginInfoRequested(const Utility::Arguments& args) {
            args.isSet("info-converter");
 }
 
-template<UnsignedInt dimensions> bool checkCommonFormatFlags(const Utility::Arguments& args, const Containers::Array<Trade::ImageData<dimensions>>& images) {
+template<UnsignedInt dimensions> bool checkCommonFormatFlags(const Containers::ArrayView<const Containers::StringView> inputs, const Containers::Array<Trade::ImageData<dimensions>>& images) {
     CORRADE_INTERNAL_ASSERT(!images.isEmpty());
     const bool compressed = images.front().isCompressed();
     PixelFormat format{};
@@ -312,7 +355,7 @@ template<UnsignedInt dimensions> bool checkCommonFormatFlags(const Utility::Argu
            (compressed && images[i].compressedFormat() != compressedFormat))
         {
             Error e;
-            e << "Images have different formats," << args.arrayValue("input", i) << "has";
+            e << "Images have different formats," << inputs[i] << "has";
             if(images[i].isCompressed())
                 e << images[i].compressedFormat();
             else
@@ -325,7 +368,7 @@ template<UnsignedInt dimensions> bool checkCommonFormatFlags(const Utility::Argu
             return false;
         }
         if(images[i].flags() != flags) {
-            Error{} << "Images have different flags," << args.arrayValue("input", i) << "has" << images[i].flags() << Debug::nospace << ", expected" << flags;
+            Error{} << "Images have different flags," << inputs[i] << "has" << images[i].flags() << Debug::nospace << ", expected" << flags;
             return false;
         }
     }
@@ -333,14 +376,14 @@ template<UnsignedInt dimensions> bool checkCommonFormatFlags(const Utility::Argu
     return true;
 }
 
-template<UnsignedInt dimensions> bool checkCommonFormatAndSize(const Utility::Arguments& args, const Containers::Array<Trade::ImageData<dimensions>>& images) {
-    if(!checkCommonFormatFlags(args, images)) return false;
+template<UnsignedInt dimensions> bool checkCommonFormatAndSize(const Containers::ArrayView<const Containers::StringView> inputs, const Containers::Array<Trade::ImageData<dimensions>>& images) {
+    if(!checkCommonFormatFlags(inputs, images)) return false;
 
     CORRADE_INTERNAL_ASSERT(!images.isEmpty());
     Math::Vector<dimensions, Int> size = images.front().size();
     for(std::size_t i = 1; i != images.size(); ++i) {
         if(images[i].size() != size) {
-            Error{} << "Images have different sizes," << args.arrayValue("input", i) << "has a size of" << images[i].size() << Debug::nospace << ", expected" << size;
+            Error{} << "Images have different sizes," << inputs[i] << "has a size of" << images[i].size() << Debug::nospace << ", expected" << size;
             return false;
         }
     }
@@ -381,187 +424,11 @@ template<UnsignedInt dimensions> bool convertImages(Trade::AbstractImageConverte
     return true;
 }
 
-}
-
-int main(int argc, char** argv) {
-    Utility::Arguments args;
-    args.addArrayArgument("input").setHelp("input", "input image(s)")
-        .addArgument("output").setHelp("output", "output image; ignored if --info is present, disallowed for --in-place")
-        .addOption('I', "importer", "AnyImageImporter").setHelp("importer", "image importer plugin", "PLUGIN")
-        .addArrayOption('C', "converter").setHelp("converter", "image converter plugin(s)", "PLUGIN")
-        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        .addOption("plugin-dir").setHelp("plugin-dir", "override base plugin dir", "DIR")
-        #endif
-        #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
-        .addBooleanOption("map").setHelp("map", "memory-map the input for zero-copy import (works only for standalone files)")
-        #endif
-        .addOption('i', "importer-options").setHelp("importer-options", "configuration options to pass to the importer", "key=val,key2=val2,…")
-        .addArrayOption('c', "converter-options").setHelp("converter-options", "configuration options to pass to the converter(s)", "key=val,key2=val2,…")
-        .addOption('D', "dimensions", "2").setHelp("dimensions", "import and convert image of given dimensions", "N")
-        .addOption("image", "0").setHelp("image", "image to import", "N")
-        .addOption("level").setHelp("level", "import given image level instead of all", "N")
-        .addOption("layer").setHelp("layer", "extract a layer into an image with one dimension less", "N")
-        .addBooleanOption("layers").setHelp("layers", "combine multiple layers into an image with one dimension more")
-        .addBooleanOption("levels").setHelp("layers", "combine multiple image levels into a single file")
-        .addBooleanOption("in-place").setHelp("in-place", "overwrite the input image with the output")
-        .addBooleanOption("info-importer").setHelp("info-importer", "print info about the importer plugin and exit")
-        .addBooleanOption("info-converter").setHelp("info-converter", "print info about the image converter plugin and exit")
-        .addBooleanOption("info").setHelp("info", "print info about the input file and exit")
-        .addOption("color", "auto").setHelp("color", "colored output for --info", "on|off|auto")
-        .addBooleanOption('v', "verbose").setHelp("verbose", "verbose output from importer and converter plugins")
-        .addBooleanOption("profile").setHelp("profile", "measure import and conversion time")
-        .setParseErrorCallback([](const Utility::Arguments& args, Utility::Arguments::ParseError error, const std::string& key) {
-            /* If --info for plugins is passed, we don't need the input */
-            if(error == Utility::Arguments::ParseError::MissingArgument &&
-               key == "input" && isPluginInfoRequested(args))
-                return true;
-            /* If --in-place or --info for plugins or data is passed, we don't
-               need the output argument */
-            if(error == Utility::Arguments::ParseError::MissingArgument &&
-               key == "output" && (args.isSet("in-place") || isPluginInfoRequested(args) || args.isSet("info")))
-                return true;
-
-            /* Handle all other errors as usual */
-            return false;
-        })
-        .setGlobalHelp(R"(Converts images of different formats.
-
-Specifying --importer raw:<format> will treat the input as a raw tightly-packed
-square of pixels in given pixel format. Specifying -C / --converter raw will
-save raw imported data instead of using a converter plugin.
-
-If the --info-importer or --info-converter option is given, the utility will
-print information about given plugin specified via the -I or -C option,
-including its configuration options potentially overriden with -i or -c. In
-this case no file is read and no conversion is done and neither the input nor
-the output file needs to be specified.
-
-If --info is given, the utility will print information about given data, independently of the -D / --dimensions option. In this case the input file is
-read but no conversion is done and output file doesn't need to be specified.
-
-The -i / --importer-options and -c / --converter-options arguments accept a
-comma-separated list of key/value pairs to set in the importer / converter
-plugin configuration. If the = character is omitted, it's equivalent to saying
-key=true; configuration subgroups are delimited with /. Prefix the key with +
-to add new options or multiple options of the same name.
-
-It's possible to specify the -C / --converter option (and correspondingly also
--c / --converter-options) multiple times in order to chain more converters
-together. All converters in the chain have to support image-to-image
-conversion, the last converter has to be either raw or support either
-image-to-image or image-to-file conversion. If the last converter doesn't
-support conversion to a file, AnyImageConverter is used to save its output; if
-no -C / --converter is specified, AnyImageConverter is used.)")
-        .parse(argc, argv);
-
-    /* Colored output. Enable only if a TTY. */
-    Debug::Flags useColor;
-    if(args.value("color") == "on")
-        useColor = Debug::Flags{};
-    else if(args.value("color") == "off")
-        useColor = Debug::Flag::DisableColors;
-    else
-        useColor = Debug::isTty() ? Debug::Flags{} : Debug::Flag::DisableColors;
-
-    /* Generic checks */
-    if(const std::size_t inputCount = args.arrayValueCount("input")) {
-        /* Not an error in this case, it should be possible to just append
-           --info* to existing command line without having to remove anything.
-           But print a warning at least, it could also be a mistyped option. */
-        if(isPluginInfoRequested(args)) {
-            Warning w;
-            w << "Ignoring input files for --info:";
-            for(std::size_t i = 0; i != inputCount; ++i)
-                w << args.arrayValue<Containers::StringView>("input", i);
-        }
-    }
-    if(args.value<Containers::StringView>("output")) {
-        if(args.isSet("in-place")) {
-            Error{} << "Output file shouldn't be set for --in-place:" << args.value<Containers::StringView>("output");
-            return 1;
-        }
-
-        /* Same as above, it should be possible to just append --info* to
-           existing command line */
-        if(isPluginInfoRequested(args) || args.isSet("info"))
-            Warning{} << "Ignoring output file for --info:" << args.value<Containers::StringView>("output");
-    }
-
-    /* Mutually incompatible options */
-    if(args.isSet("layers") && args.isSet("levels")) {
-        Error{} << "The --layers and --levels options can't be used together. First combine layers of each level and then all levels in a second step.";
-        return 1;
-    }
-    if((args.isSet("layers") || args.isSet("levels")) && args.isSet("in-place")) {
-        Error{} << "The --layers / --levels option can't be combined with --in-place";
-        return 1;
-    }
-    if((args.isSet("layers") || args.isSet("levels")) && args.isSet("info")) {
-        Error{} << "The --layers / --levels option can't be combined with --info";
-        return 1;
-    }
-    /* It can be combined with --levels though. This could potentially be
-       possible to implement, but I don't see a reason, all it would do is
-       picking Nth image from the input set and recompress it. OTOH, combining
-       --levels and --level "works", the --level picks Nth level from each
-       input image, although the usefulness of that is also doubtful. Why
-       create multi-level images from images that are already multi-level? */
-    if(args.isSet("layers") && !args.value("layer").empty()) {
-        Error{} << "The --layers option can't be combined with --layer.";
-        return 1;
-    }
-    if(args.isSet("levels") && args.arrayValueCount("converter") && args.arrayValue("converter", args.arrayValueCount("converter") - 1) == "raw") {
-        Error{} << "The --levels option can't be combined with raw data output";
-        return 1;
-    }
-    if(!args.isSet("layers") && !args.isSet("levels") && args.arrayValueCount("input") > 1 && !isPluginInfoRequested(args)) {
-        Error{} << "Multiple input files require the --layers / --levels option to be set";
-        return 1;
-    }
-
-    /* Importer and converter manager */
-    PluginManager::Manager<Trade::AbstractImporter> importerManager{
-        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        args.value("plugin-dir").empty() ? Containers::String{} :
-        Utility::Path::join(args.value("plugin-dir"), Utility::Path::split(Trade::AbstractImporter::pluginSearchPaths().back()).second())
-        #endif
-    };
-    PluginManager::Manager<Trade::AbstractImageConverter> converterManager{
-        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        args.value("plugin-dir").empty() ? Containers::String{} :
-        Utility::Path::join(args.value("plugin-dir"), Utility::Path::split(Trade::AbstractImageConverter::pluginSearchPaths().back()).second())
-        #endif
-    };
-
-    /* Print plugin info, if requested */
-    if(args.isSet("info-importer")) {
-        Containers::Pointer<Trade::AbstractImporter> importer = importerManager.loadAndInstantiate(args.value("importer"));
-        if(!importer) {
-            Debug{} << "Available importer plugins:" << ", "_s.join(importerManager.aliasList());
-            return 1;
-        }
-
-        /* Set options, if passed */
-        if(args.isSet("verbose")) importer->addFlags(Trade::ImporterFlag::Verbose);
-        Implementation::setOptions(*importer, "AnyImageImporter", args.value("importer-options"));
-        Trade::Implementation::printImporterInfo(useColor, *importer);
-        return 0;
-    }
-    if(args.isSet("info-converter")) {
-        Containers::Pointer<Trade::AbstractImageConverter> converter = converterManager.loadAndInstantiate(args.arrayValueCount("converter") ? args.arrayValue("converter", 0) : "AnyImageConverter");
-        if(!converter) {
-            Debug{} << "Available converter plugins:" << ", "_s.join(converterManager.aliasList());
-            return 1;
-        }
-
-        /* Set options, if passed */
-        if(args.isSet("verbose")) converter->addFlags(Trade::ImageConverterFlag::Verbose);
-        if(args.arrayValueCount("converter-options"))
-            Implementation::setOptions(*converter, "AnyImageConverter", args.arrayValue("converter-options", 0));
-        Trade::Implementation::printImageConverterInfo(useColor, *converter);
-        return 0;
-    }
-
+/* Imports the inputs, processes them and saves the result to the output.
+   Used for both the single-file operation and for each item of --batch,
+   potentially on multiple threads, in which case each thread has its own
+   plugin managers. Returns the process exit code. */
+int importAndConvert(const Utility::Arguments& args, const Debug::Flags useColor, PluginManager::Manager<Trade::AbstractImporter>& importerManager, PluginManager::Manager<Trade::AbstractImageConverter>& converterManager, const Containers::ArrayView<const Containers::StringView> inputs, const Containers::StringView output, std::chrono::high_resolution_clock::duration& importTime, std::chrono::high_resolution_clock::duration& conversionTime) {
     const Int dimensions = args.value<Int>("dimensions");
     /** @todo make them array options as well? */
     const UnsignedInt image = args.value<UnsignedInt>("image");
@@ -574,11 +441,7 @@ no -C / --converter is specified, AnyImageConverter is used.)")
     Containers::Array<Trade::ImageData2D> images2D;
     Containers::Array<Trade::ImageData3D> images3D;
 
-    /* Wow, C++, you suck. This implicitly initializes to random shit?! */
-    std::chrono::high_resolution_clock::duration importTime{};
-
-    for(std::size_t i = 0, max = args.arrayValueCount("input"); i != max; ++i) {
-        const Containers::StringView input = args.arrayValue<Containers::StringView>("input", i);
+    for(const Containers::StringView input: inputs) {
 
         /* Load raw data, if requested; assume it's a tightly-packed square of
            given format */
@@ -847,16 +710,6 @@ no -C / --converter is specified, AnyImageConverter is used.)")
         }
     }
 
-    /* Wow, C++, you suck. This implicitly initializes to random shit?! */
-    std::chrono::high_resolution_clock::duration conversionTime{};
-
-    Containers::StringView output;
-    if(args.isSet("in-place")) {
-        /* Should have been checked in a graceful way above */
-        CORRADE_INTERNAL_ASSERT(args.arrayValueCount("input") == 1);
-        output = args.arrayValue<Containers::StringView>("input", 0);
-    } else output = args.value<Containers::StringView>("output");
-
     Int outputDimensions;
     Containers::Array<Trade::ImageData1D> outputImages1D;
     Containers::Array<Trade::ImageData2D> outputImages2D;
@@ -868,7 +721,7 @@ no -C / --converter is specified, AnyImageConverter is used.)")
         Trade::Implementation::Duration d{conversionTime};
 
         if(dimensions == 1) {
-            if(!checkCommonFormatAndSize(args, images1D)) return 1;
+            if(!checkCommonFormatAndSize(inputs, images1D)) return 1;
 
             outputDimensions = 2;
             if(!images1D.front().isCompressed()) {
@@ -896,7 +749,7 @@ no -C / --converter is specified, AnyImageConverter is used.)")
             }
 
         } else if(dimensions == 2) {
-            if(!checkCommonFormatAndSize(args, images2D)) return 1;
+            if(!checkCommonFormatAndSize(inputs, images2D)) return 1;
 
             outputDimensions = 3;
             if(!images2D.front().isCompressed()) {
@@ -942,7 +795,7 @@ no -C / --converter is specified, AnyImageConverter is used.)")
 
             /* There can be multiple input levels, and a layer should get
                extracted from each level, forming a multi-level image again */
-            if(!checkCommonFormatFlags(args, images2D)) return 1;
+            if(!checkCommonFormatFlags(inputs, images2D)) return 1;
             if(!images2D.front().isCompressed()) {
                 for(std::size_t i = 0; i != images2D.size(); ++i) {
                     /* Diagnostic printed in the import loop above, as here we
@@ -972,7 +825,7 @@ no -C / --converter is specified, AnyImageConverter is used.)")
 
             /* There can be multiple input levels, and a layer should get
                extracted from each level, forming a multi-level image again */
-            if(!checkCommonFormatFlags(args, images3D)) return 1;
+            if(!checkCommonFormatFlags(inputs, images3D)) return 1;
             if(!images3D.front().isCompressed()) {
                 for(std::size_t i = 0; i != images3D.size(); ++i) {
                     /* Diagnostic printed in the import loop above, as here we
@@ -1004,15 +857,15 @@ no -C / --converter is specified, AnyImageConverter is used.)")
        --levels is set or if the (single) input image is multi-level. */
     } else {
         if(dimensions == 1) {
-            if(!checkCommonFormatFlags(args, images1D)) return 1;
+            if(!checkCommonFormatFlags(inputs, images1D)) return 1;
             outputDimensions = 1;
             outputImages1D = Utility::move(images1D);
         } else if(dimensions == 2) {
-            if(!checkCommonFormatFlags(args, images2D)) return 1;
+            if(!checkCommonFormatFlags(inputs, images2D)) return 1;
             outputDimensions = 2;
             outputImages2D = Utility::move(images2D);
         } else if(dimensions == 3) {
-            if(!checkCommonFormatFlags(args, images3D)) return 1;
+            if(!checkCommonFormatFlags(inputs, images3D)) return 1;
             outputDimensions = 3;
             outputImages3D = Utility::move(images3D);
         } else CORRADE_INTERNAL_ASSERT_UNREACHABLE();
@@ -1230,6 +1083,449 @@ no -C / --converter is specified, AnyImageConverter is used.)")
         }
     }
 
+    return 0;
+}
+
+#ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+/* Plugin directory for given plugin interface, empty if --plugin-dir isn't
+   set */
+template<class T> Containers::String pluginDirectory(const Utility::Arguments& args) {
+    if(args.value("plugin-dir").empty())
+        return {};
+    return Utility::Path::join(args.value("plugin-dir"), Utility::Path::split(T::pluginSearchPaths().back()).second());
+}
+#endif
+
+/* Captured diagnostic output, exit code and timing of a single --batch item */
+struct BatchItemOutput {
+    std::ostringstream debug, error;
+    int result{};
+    /* Wow, C++, you suck. This implicitly initializes to random shit?! */
+    std::chrono::high_resolution_clock::duration importTime{}, conversionTime{};
+};
+
+/* Converts a single --batch item, capturing all its output so items
+   processed on different threads don't interleave */
+void convertBatchItem(const Utility::Arguments& args, const Debug::Flags useColor, PluginManager::Manager<Trade::AbstractImporter>& importerManager, PluginManager::Manager<Trade::AbstractImageConverter>& converterManager, const Containers::Pair<Containers::String, Containers::String>& item, BatchItemOutput& output) {
+    Debug redirectDebug{&output.debug};
+    Warning redirectWarning{&output.error};
+    Error redirectError{&output.error};
+
+    const Containers::StringView input = item.first();
+    output.result = importAndConvert(args, useColor, importerManager, converterManager, {&input, 1}, item.second(), output.importTime, output.conversionTime);
+
+    if(!output.result && args.isSet("profile")) {
+        Debug{} << input << "->" << item.second() << Debug::nospace << ": import took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(output.importTime).count())/1.0e3f << "seconds, conversion"
+            << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(output.conversionTime).count())/1.0e3f << "seconds";
+    }
+}
+
+/* Prints captured output of a --batch item and adds its timing to the
+   totals. Returns true if the item was converted successfully. */
+bool printBatchItemOutput(const BatchItemOutput& output, std::chrono::high_resolution_clock::duration& importTime, std::chrono::high_resolution_clock::duration& conversionTime) {
+    const std::string debug = output.debug.str();
+    const std::string error = output.error.str();
+    if(!debug.empty()) Debug{Debug::Flag::NoNewlineAtTheEnd} << debug;
+    if(!error.empty()) Error{Debug::Flag::NoNewlineAtTheEnd} << error;
+    importTime += output.importTime;
+    conversionTime += output.conversionTime;
+    return !output.result;
+}
+
+/* Converts each input of the batch to its output independently of the
+   others. Unlike with a single input, a failure doesn't stop the processing,
+   instead the count of failed items is returned. With more than one thread,
+   each worker picks the next unprocessed item and the captured output is
+   printed in the original order once all items are done. */
+std::size_t convertBatch(const Utility::Arguments& args, const Debug::Flags useColor, PluginManager::Manager<Trade::AbstractImporter>& importerManager, PluginManager::Manager<Trade::AbstractImageConverter>& converterManager, const Containers::ArrayView<const Containers::Pair<Containers::String, Containers::String>> items, const std::size_t threadCount, std::chrono::high_resolution_clock::duration& importTime, std::chrono::high_resolution_clock::duration& conversionTime) {
+    std::size_t failedCount = 0;
+
+    #ifdef MAGNUM_IMAGECONVERTER_THREADS
+    if(threadCount > 1) {
+        /* Plugin managers aren't thread-safe and the Any* plugins load their
+           delegates through them, so each worker thread has its own. The
+           first thread reuses the managers passed from outside, the others
+           are created upfront here. Plugins then get loaded once per thread,
+           on first use, and stay loaded for all other items the thread
+           processes. */
+        Containers::Array<Containers::Pointer<PluginManager::Manager<Trade::AbstractImporter>>> importerManagers{threadCount - 1};
+        Containers::Array<Containers::Pointer<PluginManager::Manager<Trade::AbstractImageConverter>>> converterManagers{threadCount - 1};
+        for(std::size_t t = 0; t != threadCount - 1; ++t) {
+            importerManagers[t].emplace(
+                #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+                pluginDirectory<Trade::AbstractImporter>(args)
+                #endif
+            );
+            converterManagers[t].emplace(
+                #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+                pluginDirectory<Trade::AbstractImageConverter>(args)
+                #endif
+            );
+        }
+
+        Containers::Array<BatchItemOutput> outputs{ValueInit, items.size()};
+        std::atomic<std::size_t> next{0};
+
+        Containers::Array<std::thread> threads{threadCount};
+        for(std::size_t t = 0; t != threadCount; ++t) threads[t] = std::thread{[&, t]() {
+            for(std::size_t i; (i = next++) < items.size(); )
+                convertBatchItem(args, useColor,
+                    t ? *importerManagers[t - 1] : importerManager,
+                    t ? *converterManagers[t - 1] : converterManager,
+                    items[i], outputs[i]);
+        }};
+
+        for(std::thread& thread: threads) thread.join();
+
+        for(const BatchItemOutput& output: outputs)
+            if(!printBatchItemOutput(output, importTime, conversionTime))
+                ++failedCount;
+
+        return failedCount;
+    }
+    #else
+    CORRADE_INTERNAL_ASSERT(threadCount == 1);
+    #endif
+
+    /* Serial processing, printing the output right after each item */
+    for(const Containers::Pair<Containers::String, Containers::String>& item: items) {
+        BatchItemOutput output;
+        convertBatchItem(args, useColor, importerManager, converterManager, item, output);
+        if(!printBatchItemOutput(output, importTime, conversionTime))
+            ++failedCount;
+    }
+
+    return failedCount;
+}
+
+}
+
+int main(int argc, char** argv) {
+    Utility::Arguments args;
+    args.addArrayArgument("input").setHelp("input", "input image(s)")
+        .addArgument("output").setHelp("output", "output image or a directory for --batch; ignored if --info is present, disallowed for --in-place")
+        .addOption('I', "importer", "AnyImageImporter").setHelp("importer", "image importer plugin", "PLUGIN")
+        .addArrayOption('C', "converter").setHelp("converter", "image converter plugin(s)", "PLUGIN")
+        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+        .addOption("plugin-dir").setHelp("plugin-dir", "override base plugin dir", "DIR")
+        #endif
+        #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+        .addBooleanOption("map").setHelp("map", "memory-map the input for zero-copy import (works only for standalone files)")
+        #endif
+        .addOption('i', "importer-options").setHelp("importer-options", "configuration options to pass to the importer", "key=val,key2=val2,…")
+        .addArrayOption('c', "converter-options").setHelp("converter-options", "configuration options to pass to the converter(s)", "key=val,key2=val2,…")
+        .addOption('D', "dimensions", "2").setHelp("dimensions", "import and convert image of given dimensions", "N")
+        .addOption("image", "0").setHelp("image", "image to import", "N")
+        .addOption("level").setHelp("level", "import given image level instead of all", "N")
+        .addOption("layer").setHelp("layer", "extract a layer into an image with one dimension less", "N")
+        .addBooleanOption("layers").setHelp("layers", "combine multiple layers into an image with one dimension more")
+        .addBooleanOption("levels").setHelp("layers", "combine multiple image levels into a single file")
+        .addBooleanOption("in-place").setHelp("in-place", "overwrite the input image with the output")
+        .addBooleanOption("batch").setHelp("batch", "convert each input image separately to the output directory")
+        .addOption("batch-list").setHelp("batch-list", "read tab-separated input and output pairs to convert from a file", "FILE")
+        .addOption("batch-extension").setHelp("batch-extension", "replace the input file extension with given one in --batch", "EXT")
+        .addOption("threads", "1").setHelp("threads", "number of threads to use for --batch, 0 for all available", "N")
+        .addBooleanOption("info-importer").setHelp("info-importer", "print info about the importer plugin and exit")
+        .addBooleanOption("info-converter").setHelp("info-converter", "print info about the image converter plugin and exit")
+        .addBooleanOption("info").setHelp("info", "print info about the input file and exit")
+        .addOption("color", "auto").setHelp("color", "colored output for --info", "on|off|auto")
+        .addBooleanOption('v', "verbose").setHelp("verbose", "verbose output from importer and converter plugins")
+        .addBooleanOption("profile").setHelp("profile", "measure import and conversion time")
+        .setParseErrorCallback([](const Utility::Arguments& args, Utility::Arguments::ParseError error, const std::string& key) {
+            /* If --info for plugins or --batch-list is passed, we don't need
+               the input */
+            if(error == Utility::Arguments::ParseError::MissingArgument &&
+               key == "input" && (isPluginInfoRequested(args) || !args.value("batch-list").empty()))
+                return true;
+            /* If --in-place, --batch-list or --info for plugins or data is
+               passed, we don't need the output argument */
+            if(error == Utility::Arguments::ParseError::MissingArgument &&
+               key == "output" && (args.isSet("in-place") || !args.value("batch-list").empty() || isPluginInfoRequested(args) || args.isSet("info")))
+                return true;
+
+            /* Handle all other errors as usual */
+            return false;
+        })
+        .setGlobalHelp(R"(Converts images of different formats.
+
+Specifying --importer raw:<format> will treat the input as a raw tightly-packed
+square of pixels in given pixel format. Specifying -C / --converter raw will
+save raw imported data instead of using a converter plugin.
+
+If the --info-importer or --info-converter option is given, the utility will
+print information about given plugin specified via the -I or -C option,
+including its configuration options potentially overriden with -i or -c. In
+this case no file is read and no conversion is done and neither the input nor
+the output file needs to be specified.
+
+If --info is given, the utility will print information about given data, independently of the -D / --dimensions option. In this case the input file is
+read but no conversion is done and output file doesn't need to be specified.
+
+The -i / --importer-options and -c / --converter-options arguments accept a
+comma-separated list of key/value pairs to set in the importer / converter
+plugin configuration. If the = character is omitted, it's equivalent to saying
+key=true; configuration subgroups are delimited with /. Prefix the key with +
+to add new options or multiple options of the same name.
+
+It's possible to specify the -C / --converter option (and correspondingly also
+-c / --converter-options) multiple times in order to chain more converters
+together. All converters in the chain have to support image-to-image
+conversion, the last converter has to be either raw or support either
+image-to-image or image-to-file conversion. If the last converter doesn't
+support conversion to a file, AnyImageConverter is used to save its output; if
+no -C / --converter is specified, AnyImageConverter is used.
+
+If --batch is given, each input is converted separately to a file of the same
+name in the output directory, optionally with the extension replaced with
+--batch-extension, or overwritten if --in-place is set. Alternatively,
+--batch-list reads input and output filenames from a file, one tab-separated
+pair per line, ignoring empty lines and lines starting with #. With --threads,
+the images are converted on multiple threads, each having its own plugin
+managers. Failure to convert one image doesn't stop the others. With
+--profile, timing of each image is printed, followed by the total summed
+across all images.)")
+        .parse(argc, argv);
+
+    /* Colored output. Enable only if a TTY. */
+    Debug::Flags useColor;
+    if(args.value("color") == "on")
+        useColor = Debug::Flags{};
+    else if(args.value("color") == "off")
+        useColor = Debug::Flag::DisableColors;
+    else
+        useColor = Debug::isTty() ? Debug::Flags{} : Debug::Flag::DisableColors;
+
+    /* Generic checks */
+    if(const std::size_t inputCount = args.arrayValueCount("input")) {
+        /* Not an error in this case, it should be possible to just append
+           --info* to existing command line without having to remove anything.
+           But print a warning at least, it could also be a mistyped option. */
+        if(isPluginInfoRequested(args)) {
+            Warning w;
+            w << "Ignoring input files for --info:";
+            for(std::size_t i = 0; i != inputCount; ++i)
+                w << args.arrayValue<Containers::StringView>("input", i);
+        }
+    }
+    const bool isBatch = args.isSet("batch") || !args.value("batch-list").empty();
+    if(args.value<Containers::StringView>("output")) {
+        /* In case of --batch, a trailing input gets parsed as the output */
+        if(args.isSet("in-place") && !isBatch) {
+            Error{} << "Output file shouldn't be set for --in-place:" << args.value<Containers::StringView>("output");
+            return 1;
+        }
+
+        /* Same as above, it should be possible to just append --info* to
+           existing command line */
+        if(isPluginInfoRequested(args) || args.isSet("info"))
+            Warning{} << "Ignoring output file for --info:" << args.value<Containers::StringView>("output");
+    }
+
+    /* Mutually incompatible options */
+    if(args.isSet("layers") && args.isSet("levels")) {
+        Error{} << "The --layers and --levels options can't be used together. First combine layers of each level and then all levels in a second step.";
+        return 1;
+    }
+    if((args.isSet("layers") || args.isSet("levels")) && args.isSet("in-place")) {
+        Error{} << "The --layers / --levels option can't be combined with --in-place";
+        return 1;
+    }
+    if((args.isSet("layers") || args.isSet("levels")) && args.isSet("info")) {
+        Error{} << "The --layers / --levels option can't be combined with --info";
+        return 1;
+    }
+    /* It can be combined with --levels though. This could potentially be
+       possible to implement, but I don't see a reason, all it would do is
+       picking Nth image from the input set and recompress it. OTOH, combining
+       --levels and --level "works", the --level picks Nth level from each
+       input image, although the usefulness of that is also doubtful. Why
+       create multi-level images from images that are already multi-level? */
+    if(args.isSet("layers") && !args.value("layer").empty()) {
+        Error{} << "The --layers option can't be combined with --layer.";
+        return 1;
+    }
+    if(args.isSet("levels") && args.arrayValueCount("converter") && args.arrayValue("converter", args.arrayValueCount("converter") - 1) == "raw") {
+        Error{} << "The --levels option can't be combined with raw data output";
+        return 1;
+    }
+    if(isBatch && (args.isSet("layers") || args.isSet("levels"))) {
+        Error{} << "The --batch / --batch-list option can't be combined with --layers / --levels";
+        return 1;
+    }
+    if(isBatch && args.isSet("info")) {
+        Error{} << "The --batch / --batch-list option can't be combined with --info";
+        return 1;
+    }
+    if(!args.value("batch-list").empty() && (args.isSet("batch") || args.isSet("in-place") || args.arrayValueCount("input") || args.value<Containers::StringView>("output"))) {
+        Error{} << "The --batch-list option can't be combined with --batch, --in-place or input and output files";
+        return 1;
+    }
+    if(!args.value("batch-extension").empty() && (!args.isSet("batch") || args.isSet("in-place"))) {
+        Error{} << "The --batch-extension option can be only used with --batch without --in-place";
+        return 1;
+    }
+    if(!isBatch && !args.isSet("layers") && !args.isSet("levels") && args.arrayValueCount("input") > 1 && !isPluginInfoRequested(args)) {
+        Error{} << "Multiple input files require the --layers / --levels option to be set";
+        return 1;
+    }
+
+    /* Importer and converter manager */
+    PluginManager::Manager<Trade::AbstractImporter> importerManager{
+        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+        pluginDirectory<Trade::AbstractImporter>(args)
+        #endif
+    };
+    PluginManager::Manager<Trade::AbstractImageConverter> converterManager{
+        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+        pluginDirectory<Trade::AbstractImageConverter>(args)
+        #endif
+    };
+
+    /* Print plugin info, if requested */
+    if(args.isSet("info-importer")) {
+        Containers::Pointer<Trade::AbstractImporter> importer = importerManager.loadAndInstantiate(args.value("importer"));
+        if(!importer) {
+            Debug{} << "Available importer plugins:" << ", "_s.join(importerManager.aliasList());
+            return 1;
+        }
+
+        /* Set options, if passed */
+        if(args.isSet("verbose")) importer->addFlags(Trade::ImporterFlag::Verbose);
+        Implementation::setOptions(*importer, "AnyImageImporter", args.value("importer-options"));
+        Trade::Implementation::printImporterInfo(useColor, *importer);
+        return 0;
+    }
+    if(args.isSet("info-converter")) {
+        Containers::Pointer<Trade::AbstractImageConverter> converter = converterManager.loadAndInstantiate(args.arrayValueCount("converter") ? args.arrayValue("converter", 0) : "AnyImageConverter");
+        if(!converter) {
+            Debug{} << "Available converter plugins:" << ", "_s.join(converterManager.aliasList());
+            return 1;
+        }
+
+        /* Set options, if passed */
+        if(args.isSet("verbose")) converter->addFlags(Trade::ImageConverterFlag::Verbose);
+        if(args.arrayValueCount("converter-options"))
+            Implementation::setOptions(*converter, "AnyImageConverter", args.arrayValue("converter-options", 0));
+        Trade::Implementation::printImageConverterInfo(useColor, *converter);
+        return 0;
+    }
+
+    /* Wow, C++, you suck. This implicitly initializes to random shit?! */
+    std::chrono::high_resolution_clock::duration importTime{};
+    std::chrono::high_resolution_clock::duration conversionTime{};
+
+    /* Convert each input separately */
+    if(isBatch) {
+        Containers::Array<Containers::Pair<Containers::String, Containers::String>> items;
+
+        /* Input and output pairs from a file */
+        if(!args.value("batch-list").empty()) {
+            const Containers::Optional<Containers::String> list = Utility::Path::readString(args.value("batch-list"));
+            if(!list) {
+                Error{} << "Cannot read file" << args.value("batch-list");
+                return 3;
+            }
+
+            const Containers::Array<Containers::StringView> lines = list->split('\n');
+            for(std::size_t i = 0; i != lines.size(); ++i) {
+                const Containers::StringView line = lines[i].trimmed();
+                if(line.isEmpty() || line.hasPrefix('#'))
+                    continue;
+
+                const auto inputOutput = line.partition('\t');
+                if(inputOutput[1].isEmpty() || inputOutput[2].trimmed().isEmpty()) {
+                    Error{} << "Invalid line" << i + 1 << "in" << args.value("batch-list") << Debug::nospace << ", expected a tab-separated input and output";
+                    return 1;
+                }
+
+                arrayAppend(items, InPlaceInit, inputOutput[0].trimmed(), inputOutput[2].trimmed());
+            }
+
+        /* Input files converted in-place, the trailing one is parsed as the
+           output */
+        } else if(args.isSet("in-place")) {
+            for(std::size_t i = 0, max = args.arrayValueCount("input"); i != max; ++i) {
+                const Containers::StringView input = args.arrayValue<Containers::StringView>("input", i);
+                arrayAppend(items, InPlaceInit, input, input);
+            }
+            if(const Containers::StringView input = args.value<Containers::StringView>("output"))
+                arrayAppend(items, InPlaceInit, input, input);
+
+        /* Input files converted to an output directory */
+        } else {
+            const Containers::StringView outputDirectory = args.value<Containers::StringView>("output");
+            if(!Utility::Path::make(outputDirectory)) {
+                Error{} << "Cannot create output directory" << outputDirectory;
+                return 1;
+            }
+
+            const Containers::StringView extension = args.value<Containers::StringView>("batch-extension");
+            for(std::size_t i = 0, max = args.arrayValueCount("input"); i != max; ++i) {
+                const Containers::StringView input = args.arrayValue<Containers::StringView>("input", i);
+                const Containers::StringView filename = Utility::Path::split(input).second();
+                arrayAppend(items, InPlaceInit, input, Utility::Path::join(outputDirectory, extension ?
+                    Utility::format("{}.{}", Utility::Path::splitExtension(filename).first(), extension) :
+                    Containers::String{filename}));
+            }
+        }
+
+        /* Threads for batch processing */
+        std::size_t threadCount = args.value<UnsignedInt>("threads");
+        #ifdef MAGNUM_IMAGECONVERTER_THREADS
+        if(!threadCount) {
+            const UnsignedInt hardwareConcurrency = std::thread::hardware_concurrency();
+            threadCount = hardwareConcurrency ? hardwareConcurrency : 1;
+        }
+        #else
+        if(threadCount != 1) {
+            Warning{} << "Parallel processing isn't available on this platform, ignoring --threads";
+            threadCount = 1;
+        }
+        #endif
+        /* No point in having more threads than items */
+        if(threadCount > items.size())
+            threadCount = items.isEmpty() ? 1 : items.size();
+
+        std::chrono::high_resolution_clock::duration batchTime{};
+        std::size_t failedCount;
+        {
+            Trade::Implementation::Duration d{batchTime};
+            failedCount = convertBatch(args, useColor, importerManager, converterManager, items, threadCount, importTime, conversionTime);
+        }
+
+        if(args.isSet("profile")) {
+            if(threadCount > 1)
+                Debug{} << "Processing used" << threadCount << "threads, import and conversion time is summed across all threads";
+            Debug{} << "Import took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(importTime).count())/1.0e3f << "seconds, conversion"
+                << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(conversionTime).count())/1.0e3f << "seconds";
+            Debug{} << "Batch of" << items.size() << "images took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(batchTime).count())/1.0e3f << "seconds";
+        }
+
+        if(failedCount) {
+            Error{} << failedCount << "out of" << items.size() << "images failed to convert";
+            return 1;
+        }
+
+        return 0;
+    }
+
+    Containers::Array<Containers::StringView> inputs;
+    for(std::size_t i = 0, max = args.arrayValueCount("input"); i != max; ++i)
+        arrayAppend(inputs, args.arrayValue<Containers::StringView>("input", i));
+
+    Containers::StringView output;
+    if(args.isSet("in-place")) {
+        /* Should have been checked in a graceful way above */
+        CORRADE_INTERNAL_ASSERT(inputs.size() == 1);
+        output = inputs[0];
+    } else output = args.value<Containers::StringView>("output");
+
+    /* The --info output, including --profile, is printed directly by the
+       function */
+    const int result = importAndConvert(args, useColor, importerManager, converterManager, inputs, output, importTime, conversionTime);
+    if(result || args.isSet("info"))
+        return result;
+
     if(args.isSet("profile")) {
         Debug{} << "Import took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(importTime).count())/1.0e3f << "seconds, conversion"
             << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(conversionTime).count())/1.0e3f << "seconds";
@@ -71,6 +71,9 @@ UnsignedInt vertexFormatSize(const VertexFormat format) {
         case VertexFormat::Vector4b:
         case VertexFormat::Vector4bNormalized:
         case VertexFormat::Matrix2x2bNormalized:
+        case VertexFormat::Vector3i1010102Normalized:
+        case VertexFormat::Vector4i1010102Normalized:
+        case VertexFormat::Vector4ui1010102Normalized:
             return 4;
         case VertexFormat::Vector3h:
         case VertexFormat::Vector3us:
@@ -260,6 +263,7 @@ UnsignedInt vertexFormatComponentCount(const VertexFormat format) {
         case VertexFormat::Matrix4x3bNormalizedAligned:
         case VertexFormat::Matrix4x3hAligned:
         case VertexFormat::Matrix4x3sNormalizedAligned:
+        case VertexFormat::Vector3i1010102Normalized:
             return 3;
 
         case VertexFormat::Vector4:
@@ -290,6 +294,8 @@ UnsignedInt vertexFormatComponentCount(const VertexFormat format) {
         case VertexFormat::Matrix4x4d:
         case VertexFormat::Matrix4x4bNormalized:
         case VertexFormat::Matrix4x4sNormalized:
+        case VertexFormat::Vector4i1010102Normalized:
+        case VertexFormat::Vector4ui1010102Normalized:
             return 4;
     }
 
@@ -427,6 +433,12 @@ VertexFormat vertexFormatComponentFormat(const VertexFormat format) {
         case VertexFormat::Vector3i:
         case VertexFormat::Vector4i:
             return VertexFormat::Int;
+
+        /* Packed formats don't have a separate component format */
+        case VertexFormat::Vector3i1010102Normalized:
+        case VertexFormat::Vector4i1010102Normalized:
+        case VertexFormat::Vector4ui1010102Normalized:
+            return format;
     }
 
     CORRADE_ASSERT_UNREACHABLE("vertexFormatComponentType(): invalid format" << format, {});
@@ -489,6 +501,9 @@ UnsignedInt vertexFormatVectorCount(const VertexFormat format) {
         case VertexFormat::Vector4sNormalized:
         case VertexFormat::Vector4ui:
         case VertexFormat::Vector4i:
+        case VertexFormat::Vector3i1010102Normalized:
+        case VertexFormat::Vector4i1010102Normalized:
+        case VertexFormat::Vector4ui1010102Normalized:
             return 1;
 
         case VertexFormat::Matrix2x2:
@@ -616,6 +631,9 @@ UnsignedInt vertexFormatVectorStride(const VertexFormat format) {
         case VertexFormat::Matrix2x2sNormalized:
         case VertexFormat::Matrix3x2sNormalized:
         case VertexFormat::Matrix4x2sNormalized:
+        case VertexFormat::Vector3i1010102Normalized:
+        case VertexFormat::Vector4i1010102Normalized:
+        case VertexFormat::Vector4ui1010102Normalized:
             return 4;
         case VertexFormat::Vector3h:
         case VertexFormat::Vector3us:
@@ -803,6 +821,9 @@ bool isVertexFormatNormalized(const VertexFormat format) {
         case VertexFormat::Matrix4x2bNormalizedAligned:
         case VertexFormat::Matrix4x3bNormalizedAligned:
         case VertexFormat::Matrix4x3sNormalizedAligned:
+        case VertexFormat::Vector3i1010102Normalized:
+        case VertexFormat::Vector4i1010102Normalized:
+        case VertexFormat::Vector4ui1010102Normalized:
             return true;
     }
 
@@ -814,6 +835,10 @@ VertexFormat vertexFormat(const VertexFormat format, const UnsignedInt component
         "vertexFormat(): can't assemble a format out of an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format), {});
 
     VertexFormat componentFormat = vertexFormatComponentFormat(format);
+    CORRADE_ASSERT(componentFormat != VertexFormat::Vector3i1010102Normalized &&
+                   componentFormat != VertexFormat::Vector4i1010102Normalized &&
+                   componentFormat != VertexFormat::Vector4ui1010102Normalized,
+        "vertexFormat(): can't assemble a format out of a packed format" << format, {});
 
     /* First turn the format into a normalized one, if requested */
     if(normalized) {
@@ -1313,7 +1313,70 @@ enum class VertexFormat: UnsignedInt {
      * Same as four @ref VertexFormat::Vector3sNormalized following each other
      * with a 2-byte gap in between, bound to consecutive locations.
      */
-    Matrix4x3sNormalizedAligned
+    Matrix4x3sNormalizedAligned,
+
+    /**
+     * @ref Vector3 packed into a 32-bit integer, with the X, Y and Z
+     * components being signed 10-bit values in the lowest 30 bits, with range
+     * @f$ [-511, 511] @f$ interpreted as @f$ [-1.0, 1.0] @f$, and the
+     * remaining two bits unused. Can be used instead of
+     * @ref VertexFormat::Vector3 for packed normals, tangents and bitangents,
+     * taking a third of the memory. Use @ref Math::packInt1010102Into() and
+     * @ref Math::unpackInt1010102Into() to convert the data.
+     *
+     * Corresponds to four-component
+     * @ref GL::DynamicAttribute::Kind::GenericNormalized
+     * @ref GL::DynamicAttribute::DataType::Int2101010Rev, with the fourth
+     * component being ignored; @ref Vk::VertexFormat::Vector4i1010102Normalized;
+     * @m_class{m-doc-external} [MTLVertexFormatInt1010102Normalized](https://developer.apple.com/documentation/metal/mtlvertexformat/mtlvertexformatint1010102normalized?language=objc).
+     * No corresponding DXGI format.
+     * @m_keywords{VK_FORMAT_A2B10G10R10_SNORM_PACK32 MTLVertexFormatInt1010102Normalized}
+     * @m_since_latest
+     */
+    Vector3i1010102Normalized,
+
+    /**
+     * @ref Vector4 packed into a 32-bit integer, with the X, Y and Z
+     * components being signed 10-bit values in the lowest 30 bits, with range
+     * @f$ [-511, 511] @f$ interpreted as @f$ [-1.0, 1.0] @f$, and the W
+     * component being a signed 2-bit value in the highest two bits, with
+     * range @f$ [-1, 1] @f$ interpreted as @f$ [-1.0, 1.0] @f$. Can be used
+     * instead of @ref VertexFormat::Vector4 for packed tangents with a
+     * bitangent sign, taking a quarter of the memory. Use
+     * @ref Math::packInt1010102Into() and @ref Math::unpackInt1010102Into()
+     * to convert the data.
+     *
+     * Corresponds to four-component
+     * @ref GL::DynamicAttribute::Kind::GenericNormalized
+     * @ref GL::DynamicAttribute::DataType::Int2101010Rev;
+     * @ref Vk::VertexFormat::Vector4i1010102Normalized;
+     * @m_class{m-doc-external} [MTLVertexFormatInt1010102Normalized](https://developer.apple.com/documentation/metal/mtlvertexformat/mtlvertexformatint1010102normalized?language=objc).
+     * No corresponding DXGI format.
+     * @m_keywords{VK_FORMAT_A2B10G10R10_SNORM_PACK32 MTLVertexFormatInt1010102Normalized}
+     * @m_since_latest
+     */
+    Vector4i1010102Normalized,
+
+    /**
+     * @ref Vector4 packed into a 32-bit integer, with the X, Y and Z
+     * components being unsigned 10-bit values in the lowest 30 bits, with
+     * range @f$ [0, 1023] @f$ interpreted as @f$ [0.0, 1.0] @f$, and the W
+     * component being an unsigned 2-bit value in the highest two bits, with
+     * range @f$ [0, 3] @f$ interpreted as @f$ [0.0, 1.0] @f$. Can be used
+     * instead of @ref VertexFormat::Vector4 for packed linear four-component
+     * colors. Use @ref Math::packUnsignedInt1010102Into() and
+     * @ref Math::unpackUnsignedInt1010102Into() to convert the data.
+     *
+     * Corresponds to four-component
+     * @ref GL::DynamicAttribute::Kind::GenericNormalized
+     * @ref GL::DynamicAttribute::DataType::UnsignedInt2101010Rev;
+     * @ref Vk::VertexFormat::Vector4ui1010102Normalized;
+     * @m_class{m-doc-external} [DXGI_FORMAT_R10G10B10A2_UNORM](https://docs.microsoft.com/en-us/windows/win32/api/dxgiformat/ne-dxgiformat-dxgi_format)
+     * or @m_class{m-doc-external} [MTLVertexFormatUInt1010102Normalized](https://developer.apple.com/documentation/metal/mtlvertexformat/mtlvertexformatuint1010102normalized?language=objc).
+     * @m_keywords{VK_FORMAT_A2B10G10R10_UNORM_PACK32 DXGI_FORMAT_R10G10B10A2_UNORM MTLVertexFormatUInt1010102Normalized}
+     * @m_since_latest
+     */
+    Vector4ui1010102Normalized
 };
 
 /**
@@ -1389,6 +1452,10 @@ Calling @ref vertexFormatComponentCount() on the returned value will always
 give @cpp 1 @ce; calling @ref isVertexFormatNormalized() on the returned
 value will always give @cpp false @ce. Expects that the vertex format is *not*
 implementation-specific.
+
+Packed formats such as @ref VertexFormat::Vector3i1010102Normalized don't have
+a separate component format and are returned unchanged, so the above doesn't
+hold for them.
 @see @ref isVertexFormatImplementationSpecific(),
     @ref vertexFormat(VertexFormat, UnsignedInt, bool),
     @ref pixelFormatChannelFormat()
@@ -1454,7 +1521,8 @@ Converts @p format to a new format of desired component count and
 normalization. Expects that @p componentCount is @cpp 1 @ce, @cpp 2 @ce,
 @cpp 3 @ce or @cpp 4 @ce and @p normalized is @cpp true @ce only for 8- and
 16-bit integer formats. Expects that the vertex format is *not*
-implementation-specific.
+implementation-specific and not a packed format such as
+@ref VertexFormat::Vector3i1010102Normalized.
 
 Example usage --- picking a format for four-component tangents to match an
 existing (three-component) vertex normal format:
@@ -64,7 +64,7 @@ Buffer Buffer::wrap(Device& device, const VkBuffer handle, const HandleFlags fla
     return out;
 }
 
-Buffer::Buffer(Device& device, const BufferCreateInfo& info, NoAllocateT): _device{&device}, _flags{HandleFlag::DestroyOnDestruction}, _dedicatedMemory{NoCreate} {
+Buffer::Buffer(Device& device, const BufferCreateInfo& info, NoAllocateT): _device{&device}, _flags{HandleFlag::DestroyOnDestruction}, _dedicatedMemory{NoCreate}, _allocation{NoCreate} {
     MAGNUM_VK_INTERNAL_ASSERT_SUCCESS(device->CreateBuffer(device, info, nullptr, &_handle));
 }
 
@@ -76,9 +76,13 @@ Buffer::Buffer(Device& device, const BufferCreateInfo& info, const MemoryFlags m
     }});
 }
 
-Buffer::Buffer(NoCreateT): _device{}, _handle{}, _dedicatedMemory{NoCreate} {}
+Buffer::Buffer(Device& device, const BufferCreateInfo& info, MemoryAllocator& allocator, const MemoryFlags memoryFlags): Buffer{device, info, NoAllocate} {
+    bindAllocation(allocator.allocate(memoryRequirements(), memoryFlags, MemoryAllocationFlag::Linear));
+}
+
+Buffer::Buffer(NoCreateT): _device{}, _handle{}, _dedicatedMemory{NoCreate}, _allocation{NoCreate} {}
 
-Buffer::Buffer(Buffer&& other) noexcept: _device{other._device}, _handle{other._handle}, _flags{other._flags}, _dedicatedMemory{Utility::move(other._dedicatedMemory)} {
+Buffer::Buffer(Buffer&& other) noexcept: _device{other._device}, _handle{other._handle}, _flags{other._flags}, _dedicatedMemory{Utility::move(other._dedicatedMemory)}, _allocation{Utility::move(other._allocation)} {
     other._handle = {};
 }
 
@@ -93,6 +97,7 @@ Buffer& Buffer::operator=(Buffer&& other) noexcept {
     swap(other._handle, _handle);
     swap(other._flags, _flags);
     swap(other._dedicatedMemory, _dedicatedMemory);
+    swap(other._allocation, _allocation);
     return *this;
 }
 
@@ -131,6 +136,23 @@ Memory& Buffer::dedicatedMemory() {
     return _dedicatedMemory;
 }
 
+void Buffer::bindAllocation(MemoryAllocation&& allocation) {
+    CORRADE_ASSERT(allocation,
+        "Vk::Buffer::bindAllocation(): the allocation is empty", );
+    bindMemory(allocation.memory(), allocation.offset());
+    _allocation = Utility::move(allocation);
+}
+
+bool Buffer::hasAllocation() const {
+    return !!_allocation;
+}
+
+MemoryAllocation& Buffer::allocation() {
+    CORRADE_ASSERT(_allocation,
+        "Vk::Buffer::allocation(): buffer doesn't have memory from an allocator", _allocation);
+    return _allocation;
+}
+
 VkBuffer Buffer::release() {
     const VkBuffer handle = _handle;
     _handle = {};
@@ -38,6 +38,7 @@
 #include "Magnum/Magnum.h"
 #include "Magnum/Tags.h"
 #include "Magnum/Vk/Memory.h"
+#include "Magnum/Vk/MemoryAllocator.h"
 #include "Magnum/Vk/Vk.h"
 #include "Magnum/Vk/Vulkan.h"
 #include "Magnum/Vk/visibility.h"
@@ -63,6 +64,14 @@ constructor together with specifying @ref MemoryFlags for the allocation.
     accessible through @ref dedicatedMemory(). This behavior may change in the
     future.
 
+@subsection Vk-Buffer-creation-allocator Memory from an allocator
+
+With many objects, a dedicated allocation for each of them is wasteful and may
+hit the allocation count limit of the driver. Passing a @ref MemoryAllocator to
+the constructor instead sub-allocates the memory from a shared block. The
+allocation is then owned by the buffer and available through
+@ref allocation(). See @ref MemoryAllocator for more information.
+
 @subsection Vk-Buffer-creation-custom-allocation Custom memory allocation
 
 Using @ref Buffer(Device&, const BufferCreateInfo&, NoAllocateT), the buffer
@@ -148,6 +157,22 @@ class MAGNUM_VK_EXPORT Buffer {
          */
         explicit Buffer(Device& device, const BufferCreateInfo& info, MemoryFlags memoryFlags);
 
+        /**
+         * @brief Construct a buffer with memory from an allocator
+         * @param device        Vulkan device to create the buffer on
+         * @param info          Buffer creation info
+         * @param allocator     Allocator to allocate the memory from
+         * @param memoryFlags   Memory allocation flags
+         * @m_since_latest
+         *
+         * Compared to @ref Buffer(Device&, const BufferCreateInfo&, MemoryFlags)
+         * the memory is sub-allocated from a block shared with other objects
+         * using @ref MemoryAllocator::allocate() and is subsequently
+         * accessible through @ref allocation(). Buffers are always placed
+         * into blocks with @ref MemoryAllocationFlag::Linear.
+         */
+        explicit Buffer(Device& device, const BufferCreateInfo& info, MemoryAllocator& allocator, MemoryFlags memoryFlags);
+
         /**
          * @brief Construct without creating the buffer
          *
@@ -232,6 +257,36 @@ class MAGNUM_VK_EXPORT Buffer {
          */
         Memory& dedicatedMemory();
 
+        /**
+         * @brief Bind memory from an allocator
+         * @m_since_latest
+         *
+         * Equivalent to @ref bindMemory() with @ref MemoryAllocation::memory()
+         * and @ref MemoryAllocation::offset(), with the additional effect that
+         * @p allocation ownership transfers to the buffer and is then available
+         * through @ref allocation(). Expects that @p allocation is not empty.
+         */
+        void bindAllocation(MemoryAllocation&& allocation);
+
+        /**
+         * @brief Whether the buffer has memory from an allocator
+         * @m_since_latest
+         *
+         * Returns @cpp true @ce if the buffer memory was bound using
+         * @ref bindAllocation(), @cpp false @ce otherwise.
+         * @see @ref allocation()
+         */
+        bool hasAllocation() const;
+
+        /**
+         * @brief Memory allocation
+         * @m_since_latest
+         *
+         * Expects that the buffer has memory from an allocator.
+         * @see @ref hasAllocation()
+         */
+        MemoryAllocation& allocation();
+
         /**
          * @brief Release the underlying Vulkan buffer
          *
@@ -259,6 +314,7 @@ class MAGNUM_VK_EXPORT Buffer {
         VkBuffer _handle;
         HandleFlags _flags;
         Memory _dedicatedMemory;
+        MemoryAllocation _allocation;
 };
 
 /**
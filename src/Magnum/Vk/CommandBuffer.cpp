@@ -26,6 +26,8 @@
 
 #include "CommandBuffer.h"
 
+#include <Corrade/Containers/ArrayView.h>
+
 #include "Magnum/Vk/Assert.h"
 #include "Magnum/Vk/Device.h"
 #include "Magnum/Vk/Handle.h"
@@ -67,9 +69,17 @@ void CommandBuffer::reset(const CommandBufferResetFlags flags) {
     MAGNUM_VK_INTERNAL_ASSERT_SUCCESS((**_device).ResetCommandBuffer(_handle, VkCommandBufferResetFlags(flags)));
 }
 
-CommandBufferBeginInfo::CommandBufferBeginInfo(const Flags flags): _info{} {
+CommandBufferBeginInfo::CommandBufferBeginInfo(const Flags flags): _info{}, _inheritanceInfo{} {
     _info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
     _info.flags = VkCommandBufferUsageFlags(flags);
+    _info.pInheritanceInfo = &_inheritanceInfo;
+    _inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+}
+
+CommandBufferBeginInfo::CommandBufferBeginInfo(const VkRenderPass renderPass, const UnsignedInt subpass, const VkFramebuffer framebuffer, const Flags flags): CommandBufferBeginInfo{flags|Flag::RenderPassContinue} {
+    _inheritanceInfo.renderPass = renderPass;
+    _inheritanceInfo.subpass = subpass;
+    _inheritanceInfo.framebuffer = framebuffer;
 }
 
 CommandBufferBeginInfo::CommandBufferBeginInfo(NoInitT) noexcept {}
@@ -77,7 +87,20 @@ CommandBufferBeginInfo::CommandBufferBeginInfo(NoInitT) noexcept {}
 CommandBufferBeginInfo::CommandBufferBeginInfo(const VkCommandBufferBeginInfo& info):
     /* Can't use {} with GCC 4.8 here because it tries to initialize the first
        member instead of doing a copy */
-    _info(info) {}
+    _info(info), _inheritanceInfo{} {}
+
+CommandBufferBeginInfo::CommandBufferBeginInfo(const CommandBufferBeginInfo& other) noexcept: _info(other._info), _inheritanceInfo(other._inheritanceInfo) {
+    if(other._info.pInheritanceInfo == &other._inheritanceInfo)
+        _info.pInheritanceInfo = &_inheritanceInfo;
+}
+
+CommandBufferBeginInfo& CommandBufferBeginInfo::operator=(const CommandBufferBeginInfo& other) noexcept {
+    _info = other._info;
+    _inheritanceInfo = other._inheritanceInfo;
+    if(other._info.pInheritanceInfo == &other._inheritanceInfo)
+        _info.pInheritanceInfo = &_inheritanceInfo;
+    return *this;
+}
 
 CommandBuffer& CommandBuffer::begin(const CommandBufferBeginInfo& info) {
     MAGNUM_VK_INTERNAL_ASSERT_SUCCESS((**_device).BeginCommandBuffer(_handle, info));
@@ -94,6 +117,15 @@ void CommandBuffer::end() {
     MAGNUM_VK_INTERNAL_ASSERT_SUCCESS((**_device).EndCommandBuffer(_handle));
 }
 
+CommandBuffer& CommandBuffer::executeCommands(const Containers::ArrayView<const VkCommandBuffer> commandBuffers) {
+    (**_device).CmdExecuteCommands(_handle, commandBuffers.size(), commandBuffers.data());
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::executeCommands(const std::initializer_list<VkCommandBuffer> commandBuffers) {
+    return executeCommands(Containers::arrayView(commandBuffers));
+}
+
 VkCommandBuffer CommandBuffer::release() {
     const VkCommandBuffer handle = _handle;
     _handle = nullptr;
@@ -106,12 +106,46 @@ class MAGNUM_VK_EXPORT CommandBufferBeginInfo {
          * in addition to `sType`, everything else is zero-filled:
          *
          * -    `flags`
+         * -    `pInheritanceInfo` to an internal zero-filled
+         *      @type_vk{CommandBufferInheritanceInfo} structure, so
+         *      @ref CommandBufferLevel::Secondary command buffers can be used
+         *      outside of a render pass
          */
         /* cmd.begin(CommandBufferBeginInfo::Flag::OneTimeSubmit) doesn't work
            anyway (would need an extra conversion from Flag to Flags), so no
            point in making this implicit. */
         explicit CommandBufferBeginInfo(Flags flags = {});
 
+        /**
+         * @brief Construct for a secondary command buffer inside a render pass
+         * @param renderPass    Render pass the command buffer will be
+         *      executed in
+         * @param subpass       Subpass index the command buffer will be
+         *      executed in
+         * @param framebuffer   Framebuffer the command buffer will be
+         *      executed with. Can be @cpp nullptr @ce if not known, but
+         *      specifying it may allow the driver to produce more efficient
+         *      commands.
+         * @param flags         Command buffer begin flags.
+         *      @ref Flag::RenderPassContinue is added implicitly.
+         * @m_since_latest
+         *
+         * Meant for recording @ref CommandBufferLevel::Secondary command
+         * buffers that are then executed from a render pass subpass begun
+         * with @ref SubpassContents::SecondaryCommandBuffers using
+         * @ref CommandBuffer::executeCommands(). The following
+         * @type_vk{CommandBufferBeginInfo} and
+         * @type_vk{CommandBufferInheritanceInfo} fields are pre-filled in
+         * addition to `sType`, everything else is zero-filled:
+         *
+         * -    `flags`
+         * -    `pInheritanceInfo`
+         * -    `pInheritanceInfo->renderPass`
+         * -    `pInheritanceInfo->subpass`
+         * -    `pInheritanceInfo->framebuffer`
+         */
+        explicit CommandBufferBeginInfo(VkRenderPass renderPass, UnsignedInt subpass, VkFramebuffer framebuffer = {}, Flags flags = {});
+
         /**
          * @brief Construct without initializing the contents
          *
@@ -129,6 +163,18 @@ class MAGNUM_VK_EXPORT CommandBufferBeginInfo {
          */
         explicit CommandBufferBeginInfo(const VkCommandBufferBeginInfo& info);
 
+        /**
+         * @brief Copy constructor
+         *
+         * If `pInheritanceInfo` points to the internal
+         * @type_vk{CommandBufferInheritanceInfo} structure, it's redirected
+         * to the copy.
+         */
+        CommandBufferBeginInfo(const CommandBufferBeginInfo& other) noexcept;
+
+        /** @brief Copy assignment */
+        CommandBufferBeginInfo& operator=(const CommandBufferBeginInfo& other) noexcept;
+
         /** @brief Underlying @type_vk{CommandBufferBeginInfo} structure */
         VkCommandBufferBeginInfo& operator*() { return _info; }
         /** @overload */
@@ -142,6 +188,10 @@ class MAGNUM_VK_EXPORT CommandBufferBeginInfo {
 
     private:
         VkCommandBufferBeginInfo _info;
+        /* Always referenced from pInheritanceInfo by the non-NoInit
+           constructors, so secondary command buffers can be begun outside of
+           a render pass as well. Ignored for primary command buffers. */
+        VkCommandBufferInheritanceInfo _inheritanceInfo;
 };
 
 CORRADE_ENUMSET_OPERATORS(CommandBufferBeginInfo::Flags)
@@ -207,6 +257,36 @@ compatible @ref Queue that was set up at
 the submit completion with a @link Fence @endlink:
 
 @snippet Vk.cpp CommandBuffer-usage-submit
+
+@section Vk-CommandBuffer-secondary Secondary command buffers
+
+A @ref CommandBufferLevel::Secondary command buffer can't be submitted to a
+queue directly, instead it's executed from a primary command buffer using
+@ref executeCommands(). That allows recording parts of a frame in parallel on
+multiple threads and then stitching them together on a single thread. If the
+secondary command buffer is meant to be executed inside a render pass, begin it
+with a @ref CommandBufferBeginInfo referencing the render pass and subpass, and
+begin the subpass with @ref SubpassContents::SecondaryCommandBuffers:
+
+@snippet Vk.cpp CommandBuffer-secondary
+
+Command pools are not thread-safe, so each thread needs to allocate from its
+own @ref CommandPool. See the @ref FrameCommandPools class for a helper that
+manages per-thread pools for multiple frames in flight.
+
+@section Vk-CommandBuffer-dynamic-state Dynamic state
+
+Every distinct combination of baked-in rasterization state needs a separate
+@ref Pipeline, which inflates pipeline counts, @ref PipelineCache size and
+shader compilation stalls. State listed in
+@ref RasterizationPipelineCreateInfo::setDynamicStates() is instead ignored at
+pipeline creation and set while recording, after the pipeline is bound, using
+@ref setViewport(), @ref setScissor(), @ref setCullMode(),
+@ref setDepthTestEnabled() and other functions. With the
+@ref DeviceFeature::ExtendedDynamicState feature enabled, a single pipeline can
+then be used for drawing with different culling, depth and stencil setup:
+
+@snippet Vk.cpp CommandBuffer-dynamic-state
 */
 class MAGNUM_VK_EXPORT CommandBuffer {
     public:
@@ -373,6 +453,28 @@ class MAGNUM_VK_EXPORT CommandBuffer {
         CommandBuffer& endRenderPass();
         #endif
 
+        /**
+         * @brief Execute secondary command buffers
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * The @p commandBuffers are expected to be
+         * @ref CommandBufferLevel::Secondary and in an executable state. If
+         * called inside a render pass, the current subpass is expected to be
+         * begun with @ref SubpassContents::SecondaryCommandBuffers and the
+         * command buffers recorded with a @ref CommandBufferBeginInfo
+         * referencing the same render pass and subpass. See
+         * @ref Vk-CommandBuffer-secondary for more information.
+         * @see @fn_vk_keyword{CmdExecuteCommands}
+         */
+        CommandBuffer& executeCommands(Containers::ArrayView<const VkCommandBuffer> commandBuffers);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        CommandBuffer& executeCommands(std::initializer_list<VkCommandBuffer> commandBuffers);
+
         /**
          * @brief Bind a pipeline
          * @return Reference to self (for method chaining)
@@ -395,6 +497,273 @@ class MAGNUM_VK_EXPORT CommandBuffer {
          */
         CommandBuffer& draw(Mesh& mesh);
 
+        /**
+         * @brief Set viewport dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::Viewport or
+         * @ref DynamicRasterizationState::ViewportWithCount enabled. If the
+         * currently bound pipeline has the latter, the viewport count is set
+         * to @cpp 1 @ce as well, so in that case the pipeline has to be bound
+         * before calling this function.
+         * @see @fn_vk_keyword{CmdSetViewport},
+         *      @fn_vk_keyword{CmdSetViewportWithCountEXT}
+         */
+        CommandBuffer& setViewport(const Range3D& viewport);
+
+        /**
+         * @brief Set viewport dynamically with a default depth range
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to calling @ref setViewport(const Range3D&) with depth
+         * range set to @f$ [0.0, 1.0] @f$.
+         */
+        CommandBuffer& setViewport(const Range2D& viewport);
+
+        /**
+         * @brief Set scissor rectangle dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::Scissor or
+         * @ref DynamicRasterizationState::ScissorWithCount enabled. If the
+         * currently bound pipeline has the latter, the scissor count is set
+         * to @cpp 1 @ce as well, so in that case the pipeline has to be bound
+         * before calling this function.
+         * @see @fn_vk_keyword{CmdSetScissor},
+         *      @fn_vk_keyword{CmdSetScissorWithCountEXT}
+         */
+        CommandBuffer& setScissor(const Range2Di& scissor);
+
+        /**
+         * @brief Set line width dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::LineWidth enabled.
+         * @see @fn_vk_keyword{CmdSetLineWidth}
+         * @requires_vk_feature @ref DeviceFeature::WideLines if @p width is
+         *      not @cpp 1.0f @ce
+         */
+        CommandBuffer& setLineWidth(Float width);
+
+        /**
+         * @brief Set depth bias dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::DepthBias enabled.
+         * @see @fn_vk_keyword{CmdSetDepthBias}
+         * @requires_vk_feature @ref DeviceFeature::DepthBiasClamp if
+         *      @p clamp is not @cpp 0.0f @ce
+         */
+        CommandBuffer& setDepthBias(Float constantFactor, Float clamp, Float slopeFactor);
+
+        /**
+         * @brief Set blend constants dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::BlendConstants enabled.
+         * @see @fn_vk_keyword{CmdSetBlendConstants}
+         */
+        CommandBuffer& setBlendConstants(const Color4& color);
+
+        /**
+         * @brief Set depth bounds dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::DepthBounds enabled.
+         * @see @fn_vk_keyword{CmdSetDepthBounds}
+         * @requires_vk_feature @ref DeviceFeature::DepthBounds
+         */
+        CommandBuffer& setDepthBounds(Float min, Float max);
+
+        /**
+         * @brief Set stencil compare mask dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::StencilCompareMask enabled.
+         * @see @fn_vk_keyword{CmdSetStencilCompareMask}
+         */
+        CommandBuffer& setStencilCompareMask(StencilFaces faces, UnsignedInt mask);
+
+        /**
+         * @brief Set stencil write mask dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::StencilWriteMask enabled.
+         * @see @fn_vk_keyword{CmdSetStencilWriteMask}
+         */
+        CommandBuffer& setStencilWriteMask(StencilFaces faces, UnsignedInt mask);
+
+        /**
+         * @brief Set stencil reference dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::StencilReference enabled.
+         * @see @fn_vk_keyword{CmdSetStencilReference}
+         */
+        CommandBuffer& setStencilReference(StencilFaces faces, UnsignedInt reference);
+
+        /**
+         * @brief Set cull mode dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::CullMode enabled.
+         * @see @fn_vk_keyword{CmdSetCullModeEXT}
+         * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
+         */
+        CommandBuffer& setCullMode(CullMode mode);
+
+        /**
+         * @brief Set front face orientation dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::FrontFace enabled.
+         * @see @fn_vk_keyword{CmdSetFrontFaceEXT}
+         * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
+         */
+        CommandBuffer& setFrontFace(FrontFace face);
+
+        /**
+         * @brief Enable or disable depth test dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::DepthTestEnable enabled.
+         * @see @fn_vk_keyword{CmdSetDepthTestEnableEXT}
+         * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
+         */
+        CommandBuffer& setDepthTestEnabled(bool enabled);
+
+        /**
+         * @brief Enable or disable depth write dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::DepthWriteEnable enabled.
+         * @see @fn_vk_keyword{CmdSetDepthWriteEnableEXT}
+         * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
+         */
+        CommandBuffer& setDepthWriteEnabled(bool enabled);
+
+        /**
+         * @brief Set depth compare operation dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::DepthCompareOperation enabled.
+         * @see @fn_vk_keyword{CmdSetDepthCompareOpEXT}
+         * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
+         */
+        CommandBuffer& setDepthCompareOperation(CompareOperation operation);
+
+        /**
+         * @brief Enable or disable depth bounds test dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::DepthBoundsTestEnable enabled.
+         * @see @fn_vk_keyword{CmdSetDepthBoundsTestEnableEXT}
+         * @requires_vk_feature @ref DeviceFeature::DepthBounds and
+         *      @ref DeviceFeature::ExtendedDynamicState
+         */
+        CommandBuffer& setDepthBoundsTestEnabled(bool enabled);
+
+        /**
+         * @brief Enable or disable stencil test dynamically
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::StencilTestEnable enabled.
+         * @see @fn_vk_keyword{CmdSetStencilTestEnableEXT}
+         * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
+         */
+        CommandBuffer& setStencilTestEnabled(bool enabled);
+
+        /**
+         * @brief Set stencil operation dynamically
+         * @param faces                 Faces to set the operation for
+         * @param failOperation         Operation when the stencil test fails
+         * @param passOperation         Operation when both the stencil and
+         *      depth test passes
+         * @param depthFailOperation    Operation when the stencil test passes
+         *      but the depth test fails
+         * @param compareOperation      Stencil test compare operation
+         * @return Reference to self (for method chaining)
+         *
+         * Used by pipelines that have
+         * @ref DynamicRasterizationState::StencilOperation enabled.
+         * @see @fn_vk_keyword{CmdSetStencilOpEXT}
+         * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
+         */
+        CommandBuffer& setStencilOperation(StencilFaces faces, StencilOperation failOperation, StencilOperation passOperation, StencilOperation depthFailOperation, CompareOperation compareOperation);
+
+        /**
+         * @brief Reset queries in a query pool
+         * @param pool      Query pool
+         * @param first     First query to reset
+         * @param count     Count of queries to reset
+         * @return Reference to self (for method chaining)
+         *
+         * Allowed only outside of a render pass. Queries have to be reset
+         * before they're used by @ref beginQuery() or @ref writeTimestamp().
+         * See @ref Vk-QueryPool-usage for a usage example.
+         * @see @ref QueryPool::reset(), @fn_vk_keyword{CmdResetQueryPool}
+         */
+        CommandBuffer& resetQueryPool(QueryPool& pool, UnsignedInt first, UnsignedInt count);
+
+        /**
+         * @brief Begin a query
+         * @param pool      Occlusion or pipeline statistics query pool
+         * @param query     Query index in the pool
+         * @param flags     Query control flags
+         * @return Reference to self (for method chaining)
+         *
+         * The query has to be reset first and ended with a corresponding
+         * @ref endQuery(). A query that began inside a render pass has to
+         * end inside the same subpass, a query that began outside of a render
+         * pass has to end outside as well.
+         * @see @fn_vk_keyword{CmdBeginQuery}
+         */
+        CommandBuffer& beginQuery(QueryPool& pool, UnsignedInt query, QueryControlFlags flags = {});
+
+        /**
+         * @brief End a query
+         * @param pool      Query pool
+         * @param query     Query index in the pool
+         * @return Reference to self (for method chaining)
+         *
+         * Expects a preceding @ref beginQuery() with the same @p pool and
+         * @p query.
+         * @see @fn_vk_keyword{CmdEndQuery}
+         */
+        CommandBuffer& endQuery(QueryPool& pool, UnsignedInt query);
+
+        /**
+         * @brief Write a timestamp
+         * @param stage     Pipeline stage after which the timestamp is
+         *      written. Usually @ref PipelineStage::TopOfPipe at the start of
+         *      a measured region and @ref PipelineStage::BottomOfPipe at the
+         *      end.
+         * @param pool      Timestamp query pool
+         * @param query     Query index in the pool
+         * @return Reference to self (for method chaining)
+         *
+         * The query has to be reset first. See @ref Vk-QueryPool-usage for a
+         * usage example.
+         * @see @fn_vk_keyword{CmdWriteTimestamp}
+         */
+        CommandBuffer& writeTimestamp(PipelineStage stage, QueryPool& pool, UnsignedInt query);
+
         /**
          * @brief Insert an execution barrier with optional memory dependencies
          * @param sourceStages          Source stages. Has to contain at least
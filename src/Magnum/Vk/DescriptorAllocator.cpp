@@ -0,0 +1,167 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DescriptorAllocator.h"
+
+#include <string>
+#include <unordered_map>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Vk/DescriptorPool.h"
+
+namespace Magnum { namespace Vk {
+
+struct DescriptorAllocator::State {
+    explicit State(Device& device, UnsignedInt setsPerPool, Containers::ArrayView<const Containers::Pair<DescriptorType, UnsignedInt>> poolSizes, DescriptorPoolCreateInfo::Flags flags);
+
+    Device& device;
+    UnsignedInt setsPerPool;
+    DescriptorPoolCreateInfo::Flags flags;
+    Containers::Array<Containers::Pair<DescriptorType, UnsignedInt>> poolSizes;
+
+    /* Pools before the current one are exhausted, pools after it are empty.
+       The current pool has currentAllocated sets allocated from it. */
+    Containers::Array<DescriptorPool> pools;
+    std::size_t current{};
+    std::size_t currentAllocated{};
+
+    /* Keyed by the layout handle followed by the resource key, both as raw
+       bytes */
+    std::unordered_map<std::string, VkDescriptorSet> cache;
+};
+
+DescriptorAllocator::State::State(Device& device, const UnsignedInt setsPerPool, const Containers::ArrayView<const Containers::Pair<DescriptorType, UnsignedInt>> poolSizes, const DescriptorPoolCreateInfo::Flags flags): device(device), setsPerPool{setsPerPool}, flags{flags}, poolSizes{NoInit, poolSizes.size()} {
+    Utility::copy(poolSizes, this->poolSizes);
+}
+
+DescriptorAllocator::DescriptorAllocator(Device& device, const UnsignedInt setsPerPool, const Containers::ArrayView<const Containers::Pair<DescriptorType, UnsignedInt>> poolSizes, const DescriptorPoolCreateInfo::Flags flags) {
+    CORRADE_ASSERT(setsPerPool,
+        "Vk::DescriptorAllocator: there has to be at least one set per pool", );
+    /* On certain compilers, {} (empty initializer list) gets converted to an
+       arrayview that's not null, so explicitly using isEmpty() */
+    CORRADE_ASSERT(!poolSizes.isEmpty(),
+        "Vk::DescriptorAllocator: there has to be at least one pool size", );
+    CORRADE_ASSERT(!(flags & DescriptorPoolCreateInfo::Flag::FreeDescriptorSet),
+        "Vk::DescriptorAllocator: freeing individual descriptor sets isn't supported", );
+    _state.emplace(device, setsPerPool, poolSizes, flags);
+}
+
+DescriptorAllocator::DescriptorAllocator(Device& device, const UnsignedInt setsPerPool, const std::initializer_list<Containers::Pair<DescriptorType, UnsignedInt>> poolSizes, const DescriptorPoolCreateInfo::Flags flags): DescriptorAllocator{device, setsPerPool, Containers::arrayView(poolSizes), flags} {}
+
+DescriptorAllocator::DescriptorAllocator(NoCreateT) noexcept {}
+
+DescriptorAllocator::DescriptorAllocator(DescriptorAllocator&&) noexcept = default;
+
+DescriptorAllocator::~DescriptorAllocator() = default;
+
+DescriptorAllocator& DescriptorAllocator::operator=(DescriptorAllocator&&) noexcept = default;
+
+UnsignedInt DescriptorAllocator::setsPerPool() const {
+    return _state ? _state->setsPerPool : 0;
+}
+
+UnsignedInt DescriptorAllocator::poolCount() const {
+    return _state ? _state->pools.size() : 0;
+}
+
+std::size_t DescriptorAllocator::cachedSetCount() const {
+    return _state ? _state->cache.size() : 0;
+}
+
+DescriptorSet DescriptorAllocator::allocateInternal(const VkDescriptorSetLayout layout, const UnsignedInt* const variableDescriptorCount) {
+    State& state = *_state;
+
+    for(;;) {
+        /* All pools exhausted, create a new one */
+        if(state.current == state.pools.size())
+            arrayAppend(state.pools, InPlaceInit, state.device, DescriptorPoolCreateInfo{state.setsPerPool, state.poolSizes, state.flags});
+
+        DescriptorPool& pool = state.pools[state.current];
+        Containers::Optional<DescriptorSet> set = variableDescriptorCount ?
+            pool.tryAllocate(layout, *variableDescriptorCount) :
+            pool.tryAllocate(layout);
+        if(set) {
+            ++state.currentAllocated;
+            return Utility::move(*set);
+        }
+
+        /* If the allocation failed even on an empty pool, it'd fail on any
+           other new pool as well */
+        CORRADE_ASSERT(state.currentAllocated,
+            "Vk::DescriptorAllocator::allocate(): allocation failed on an empty pool, the pool sizes are too small for the layout", DescriptorSet{NoCreate});
+
+        ++state.current;
+        state.currentAllocated = 0;
+    }
+}
+
+DescriptorSet DescriptorAllocator::allocate(const VkDescriptorSetLayout layout) {
+    return allocateInternal(layout, nullptr);
+}
+
+DescriptorSet DescriptorAllocator::allocate(const VkDescriptorSetLayout layout, const UnsignedInt variableDescriptorCount) {
+    return allocateInternal(layout, &variableDescriptorCount);
+}
+
+Containers::Pair<DescriptorSet, bool> DescriptorAllocator::allocateCached(const VkDescriptorSetLayout layout, const Containers::ArrayView<const UnsignedLong> resources) {
+    State& state = *_state;
+
+    std::string key;
+    key.reserve(sizeof(VkDescriptorSetLayout) + resources.size()*sizeof(UnsignedLong));
+    key.append(reinterpret_cast<const char*>(&layout), sizeof(VkDescriptorSetLayout));
+    key.append(reinterpret_cast<const char*>(resources.data()), resources.size()*sizeof(UnsignedLong));
+
+    /* The pool the set was allocated from isn't needed for anything as the
+       sets are never freed individually, so wrapping with the current pool
+       is fine */
+    const auto found = state.cache.find(key);
+    if(found != state.cache.end())
+        return {DescriptorSet::wrap(state.device, state.pools[state.current], found->second), false};
+
+    DescriptorSet set = allocateInternal(layout, nullptr);
+    state.cache.emplace(Utility::move(key), set.handle());
+    return {Utility::move(set), true};
+}
+
+Containers::Pair<DescriptorSet, bool> DescriptorAllocator::allocateCached(const VkDescriptorSetLayout layout, const std::initializer_list<UnsignedLong> resources) {
+    return allocateCached(layout, Containers::arrayView(resources));
+}
+
+void DescriptorAllocator::reset() {
+    State& state = *_state;
+
+    /* Pools after the current one weren't used since the last reset, no need
+       to reset them */
+    for(std::size_t i = 0; i != state.pools.size() && i <= state.current; ++i)
+        state.pools[i].reset();
+    state.current = 0;
+    state.currentAllocated = 0;
+    state.cache.clear();
+}
+
+}}
@@ -0,0 +1,231 @@
+#ifndef Magnum_Vk_DescriptorAllocator_h
+#define Magnum_Vk_DescriptorAllocator_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::DescriptorAllocator
+ * @m_since_latest
+ */
+
+#include <initializer_list>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/DescriptorPoolCreateInfo.h"
+#include "Magnum/Vk/DescriptorSet.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/Vulkan.h"
+#include "Magnum/Vk/visibility.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Growable descriptor set allocator
+@m_since_latest
+
+A @ref DescriptorPool has a fixed capacity given at creation time and
+descriptor sets allocated from it can be either freed individually, which
+leads to fragmentation, or all at once with @ref DescriptorPool::reset(). This
+class manages a list of equally-sized pools, creating a new one whenever the
+current one gets exhausted, and resetting all of them at once, which is
+suitable for descriptor sets that get recreated every frame.
+
+@section Vk-DescriptorAllocator-creation Creation
+
+The allocator takes a count of descriptor sets and descriptor counts for each
+pool it creates, with the same meaning as in @ref DescriptorPoolCreateInfo. No
+pool is created upfront, the first one gets created on the first allocation:
+
+@snippet Vk.cpp DescriptorAllocator-creation
+
+@section Vk-DescriptorAllocator-usage Usage
+
+Descriptor sets are allocated with @ref allocate(), which tries the current
+pool and moves on to the next one if it's exhausted. Calling @ref reset()
+resets all pools that were used since the last reset and makes them available
+for allocation again, without freeing any of them. As descriptor sets can't be
+reset while the GPU still uses them, there should be a separate allocator for
+each frame in flight, reset once it's known the frame finished executing ---
+for example right after @ref FrameCommandPools::beginFrame():
+
+@snippet Vk.cpp DescriptorAllocator-usage
+
+@subsection Vk-DescriptorAllocator-usage-cache Descriptor set caching
+
+Often the same combination of resources gets bound multiple times in a frame.
+Instead of allocating and writing a new set every time, @ref allocateCached()
+takes a layout together with a key identifying the resources, and returns a
+set allocated earlier with the same layout and key, if there's any. The second
+returned value is @cpp true @ce if the set was newly allocated and thus needs
+to be written to:
+
+@snippet Vk.cpp DescriptorAllocator-usage-cache
+
+The cache is cleared on every @ref reset().
+
+@section Vk-DescriptorAllocator-destruction Destruction
+
+Destroying the allocator destroys all its pools and thus all descriptor sets
+allocated from them. It's the application responsibility to ensure none of
+them is being used by the GPU anymore.
+*/
+class MAGNUM_VK_EXPORT DescriptorAllocator {
+    public:
+        /**
+         * @brief Constructor
+         * @param device        Vulkan device to create the pools on
+         * @param setsPerPool   Maximum count of descriptor sets that can be
+         *      allocated from a single pool. Has to be at least one.
+         * @param poolSizes     Pool sizes for each descriptor type. There has
+         *      to be at least one, and pool sizes can't be zero.
+         * @param flags         Descriptor pool creation flags. Expected to not
+         *      contain @ref DescriptorPoolCreateInfo::Flag::FreeDescriptorSet,
+         *      as descriptor sets allocated through this class are never
+         *      freed individually.
+         *
+         * No pools are created upfront, each is created with the parameters
+         * passed to @ref DescriptorPoolCreateInfo once the previous pools get
+         * exhausted.
+         */
+        explicit DescriptorAllocator(Device& device, UnsignedInt setsPerPool, Containers::ArrayView<const Containers::Pair<DescriptorType, UnsignedInt>> poolSizes, DescriptorPoolCreateInfo::Flags flags = {});
+        /** @overload */
+        explicit DescriptorAllocator(Device& device, UnsignedInt setsPerPool, std::initializer_list<Containers::Pair<DescriptorType, UnsignedInt>> poolSizes, DescriptorPoolCreateInfo::Flags flags = {});
+
+        /**
+         * @brief Construct without creating the allocator
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         */
+        explicit DescriptorAllocator(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        DescriptorAllocator(const DescriptorAllocator&) = delete;
+
+        /** @brief Move constructor */
+        DescriptorAllocator(DescriptorAllocator&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys all pools. See @ref Vk-DescriptorAllocator-destruction for
+         * more information.
+         */
+        ~DescriptorAllocator();
+
+        /** @brief Copying is not allowed */
+        DescriptorAllocator& operator=(const DescriptorAllocator&) = delete;
+
+        /** @brief Move assignment */
+        DescriptorAllocator& operator=(DescriptorAllocator&&) noexcept;
+
+        /** @brief Maximum count of descriptor sets in a single pool */
+        UnsignedInt setsPerPool() const;
+
+        /**
+         * @brief Count of created pools
+         *
+         * Grows as pools get exhausted, doesn't get reduced by @ref reset().
+         */
+        UnsignedInt poolCount() const;
+
+        /**
+         * @brief Count of cached descriptor sets
+         *
+         * Count of sets allocated with @ref allocateCached() since the last
+         * @ref reset().
+         */
+        std::size_t cachedSetCount() const;
+
+        /**
+         * @brief Allocate a descriptor set
+         *
+         * Allocates from the current pool. If it fails with
+         * @ref Result::ErrorOutOfPoolMemory or @ref Result::ErrorFragmentedPool,
+         * moves to the next pool, creating a new one if there's none left.
+         * Expects that the allocation succeeds at least on an empty pool,
+         * i.e. that the descriptor counts of @p layout fit into the pool
+         * sizes passed to the constructor. The returned instance doesn't own
+         * the Vulkan handle, the set stays valid until the next
+         * @ref reset() or until the allocator is destroyed.
+         * @see @ref DescriptorPool::tryAllocate(VkDescriptorSetLayout)
+         */
+        DescriptorSet allocate(VkDescriptorSetLayout layout);
+
+        /**
+         * @brief Allocate a descriptor set with a variable descriptor count
+         *
+         * Compared to @ref allocate(VkDescriptorSetLayout), the
+         * @p variableDescriptorCount is used for a binding that was created
+         * with @ref DescriptorSetLayoutBinding::Flag::VariableDescriptorCount.
+         * @see @ref DescriptorPool::tryAllocate(VkDescriptorSetLayout, UnsignedInt)
+         * @requires_vk_feature @ref DeviceFeature::DescriptorBindingVariableDescriptorCount
+         */
+        DescriptorSet allocate(VkDescriptorSetLayout layout, UnsignedInt variableDescriptorCount);
+
+        /**
+         * @brief Allocate a cached descriptor set
+         * @param layout        Descriptor set layout
+         * @param resources     Key identifying the resources bound to the
+         *      set, such as buffer, image view and sampler handles together
+         *      with offsets and ranges
+         *
+         * If a set with the same @p layout and @p resources was allocated
+         * since the last @ref reset(), returns it together with
+         * @cpp false @ce. Otherwise allocates a new one with
+         * @ref allocate(VkDescriptorSetLayout) and returns it together with
+         * @cpp true @ce, signalling that the set needs to be written to. See
+         * @ref Vk-DescriptorAllocator-usage-cache for more information.
+         */
+        Containers::Pair<DescriptorSet, bool> allocateCached(VkDescriptorSetLayout layout, Containers::ArrayView<const UnsignedLong> resources);
+        /** @overload */
+        Containers::Pair<DescriptorSet, bool> allocateCached(VkDescriptorSetLayout layout, std::initializer_list<UnsignedLong> resources);
+
+        /**
+         * @brief Reset the allocator
+         *
+         * Calls @ref DescriptorPool::reset() on all pools used since the last
+         * reset, making all of them available for allocation again, and
+         * clears the cache used by @ref allocateCached(). All
+         * @ref DescriptorSet instances returned by the allocator become
+         * invalid.
+         */
+        void reset();
+
+    private:
+        MAGNUM_VK_LOCAL DescriptorSet allocateInternal(VkDescriptorSetLayout layout, const UnsignedInt* variableDescriptorCount);
+
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
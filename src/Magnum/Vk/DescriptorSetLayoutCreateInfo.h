@@ -84,8 +84,9 @@ class MAGNUM_VK_EXPORT DescriptorSetLayoutBinding {
              * the binding and the updates do not invalidate the command
              * buffer.
              *
-             * Descriptor set layouts using this flag can be only allocated
-             * from a @ref DescriptorPool that has
+             * Descriptor set layouts using this flag have to be created with
+             * @ref DescriptorSetLayoutCreateInfo::Flag::UpdateAfterBindPool
+             * and can be only allocated from a @ref DescriptorPool that has
              * @ref DescriptorPoolCreateInfo::Flag::UpdateAfterBind set as
              * well.
              * @requires_vk_feature @ref DeviceFeature::DescriptorBindingSampledImageUpdateAfterBind
@@ -291,7 +292,17 @@ class MAGNUM_VK_EXPORT DescriptorSetLayoutCreateInfo {
          * @m_enum_values_as_keywords
          */
         enum class Flag: UnsignedInt {
-            /** @todo all the flags from extensions and 1.2 */
+            /**
+             * Descriptor sets using this layout have to be allocated from a
+             * pool with @ref DescriptorPoolCreateInfo::Flag::UpdateAfterBind
+             * set. Required if any binding has
+             * @ref DescriptorSetLayoutBinding::Flag::UpdateAfterBind set.
+             *
+             * @requires_vk12 Extension @vk_extension{EXT,descriptor_indexing}
+             */
+            UpdateAfterBindPool = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT
+
+            /** @todo push descriptors and other flags from extensions */
         };
 
         /**
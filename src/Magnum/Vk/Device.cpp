@@ -171,14 +171,13 @@ DeviceCreateInfo::DeviceCreateInfo(DeviceProperties& deviceProperties, const Ext
     /* Enable implicit extensions unless that's forbidden */
     /** @todo move this somewhere else as this will grow significantly? */
     if(!(flags & Flag::NoImplicitExtensions)) {
-        /* Fetch searchable extension properties if not already */
-        Containers::Optional<ExtensionProperties> extensionPropertiesStorage;
-        if(!extensionProperties) {
-            /** @todo i'd like to know which layers are enabled so i can list
-                the exts from those .. but how? */
-            extensionPropertiesStorage = deviceProperties.enumerateExtensionProperties();
-            extensionProperties = &*extensionPropertiesStorage;
-        }
+        /* Use the searchable extension properties cached in deviceProperties
+           if not supplied, so creating several devices from the same
+           properties instance doesn't enumerate them again */
+        /** @todo i'd like to know which layers are enabled so i can list
+            the exts from those .. but how? */
+        if(!extensionProperties)
+            extensionProperties = &deviceProperties.extensionPropertiesInternal();
 
         /* Only if we don't have Vulkan 1.1, on which these are core */
         if(_state->version < Version::Vk11) {
@@ -249,8 +248,10 @@ DeviceCreateInfo::DeviceCreateInfo(DeviceProperties& deviceProperties, const Ext
          own.
        - In case addQueues(QueueFlags) / setEnabledFeatures() is used it'll get
          populated and then possibly discarded if it isn't subsequently moved
-         to the Device. */
-    _state->properties = DeviceProperties::wrap(*deviceProperties._instance, deviceProperties._handle);
+         to the Device.
+       Everything already queried on the passed instance is copied over so
+       it doesn't need to be queried from the driver again. */
+    _state->properties = deviceProperties.copyCachedInternal();
 }
 
 DeviceCreateInfo::DeviceCreateInfo(DeviceProperties&& deviceProperties, const ExtensionProperties* extensionProperties, const Flags flags): DeviceCreateInfo{deviceProperties, extensionProperties, flags} {
@@ -32,6 +32,7 @@
 #include <Corrade/Containers/StaticArray.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/Debug.h>
 
@@ -53,6 +54,9 @@ namespace Magnum { namespace Vk {
 
 struct DeviceProperties::State {
     explicit State(Instance& instance, VkPhysicalDevice handle);
+    /* Copies everything except the extension properties, used by
+       copyCachedInternal() */
+    explicit State(const State& other);
 
     /* Cached device extension properties to dispatch on when querying
        properties. Should be only used through
@@ -143,6 +147,26 @@ DeviceProperties::State::State(Instance& instance, const VkPhysicalDevice handle
     }
 }
 
+DeviceProperties::State::State(const State& other):
+    getPropertiesImplementation{other.getPropertiesImplementation},
+    getFeaturesImplementation{other.getFeaturesImplementation},
+    getQueueFamilyPropertiesImplementation{other.getQueueFamilyPropertiesImplementation},
+    getMemoryPropertiesImplementation{other.getMemoryPropertiesImplementation},
+    /* Can't use {} with GCC 4.8 here because it tries to initialize the first
+       member instead of doing a copy */
+    properties(other.properties),
+    driverProperties(other.driverProperties),
+    memoryProperties(other.memoryProperties),
+    queueFamilyProperties{NoInit, other.queueFamilyProperties.size()},
+    features{other.features}
+{
+    /* The driver properties are the only thing that can be on the pNext
+       chain, point it to our copy instead */
+    if(properties.pNext == &other.driverProperties)
+        properties.pNext = &driverProperties;
+    Utility::copy(other.queueFamilyProperties, queueFamilyProperties);
+}
+
 DeviceProperties::DeviceProperties(NoCreateT) noexcept: _instance{}, _handle{} {}
 
 DeviceProperties::DeviceProperties(Instance& instance, VkPhysicalDevice handle): _instance{&instance}, _handle{handle} {}
@@ -250,6 +274,12 @@ ExtensionProperties DeviceProperties::enumerateExtensionProperties() {
     return enumerateExtensionProperties({});
 }
 
+DeviceProperties DeviceProperties::copyCachedInternal() {
+    DeviceProperties out{*_instance, _handle};
+    if(_state) out._state.emplace(*_state);
+    return out;
+}
+
 const ExtensionProperties& DeviceProperties::extensionPropertiesInternal() {
     if(!_state) _state.emplace(*_instance, _handle);
     if(!_state->extensions) _state->extensions = enumerateExtensionProperties();
@@ -462,6 +492,22 @@ const VkPhysicalDeviceMemoryProperties2& DeviceProperties::memoryProperties() {
     return _state->memoryProperties;
 }
 
+VkPhysicalDeviceMemoryBudgetPropertiesEXT DeviceProperties::memoryBudget() {
+    if(!_state) _state.emplace(*_instance, _handle);
+
+    CORRADE_ASSERT(_state->getMemoryPropertiesImplementation != &DeviceProperties::getMemoryPropertiesImplementationDefault,
+        "Vk::DeviceProperties::memoryBudget(): Vulkan 1.1 or KHR_get_physical_device_properties2 is required", {});
+
+    /* Not cached in the state as the values change over time */
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budget{};
+    budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+    VkPhysicalDeviceMemoryProperties2 properties{};
+    properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+    properties.pNext = &budget;
+    _state->getMemoryPropertiesImplementation(*this, properties);
+    return budget;
+}
+
 void DeviceProperties::getMemoryPropertiesImplementationDefault(DeviceProperties& self, VkPhysicalDeviceMemoryProperties2& properties) {
     return (**self._instance).GetPhysicalDeviceMemoryProperties(self._handle, &properties.memoryProperties);
 }
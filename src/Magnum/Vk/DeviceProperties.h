@@ -656,6 +656,25 @@ class MAGNUM_VK_EXPORT DeviceProperties {
          */
         UnsignedInt memoryHeapIndex(UnsignedInt memory);
 
+        /**
+         * @brief Query memory heap budget and usage
+         * @m_since_latest
+         *
+         * Unlike @ref memoryProperties(), the budget changes over time and
+         * thus is queried anew on every call. The @cpp heapBudget @ce and
+         * @cpp heapUsage @ce fields are filled for the first
+         * @ref memoryHeapCount() heaps. Expects that Vulkan 1.1 is supported
+         * or the @vk_extension{KHR,get_physical_device_properties2} extension
+         * is enabled on the originating instance; the
+         * @vk_extension{EXT,memory_budget} extension is expected to be
+         * supported by the device.
+         * @see @ref MemoryAllocator::heapBudget(),
+         *      @ref MemoryAllocator::heapUsage(),
+         *      @fn_vk_keyword{GetPhysicalDeviceMemoryProperties2},
+         *      @type_vk_keyword{PhysicalDeviceMemoryBudgetPropertiesEXT}
+         */
+        VkPhysicalDeviceMemoryBudgetPropertiesEXT memoryBudget();
+
         /**
          * @brief Pick a memory type satisfying given flags
          * @param requiredFlags     Memory flags that should be present in
@@ -743,6 +762,12 @@ class MAGNUM_VK_EXPORT DeviceProperties {
            function. */
         MAGNUM_VK_LOCAL const ExtensionProperties& extensionPropertiesInternal();
 
+        /* Used by DeviceCreateInfo(DeviceProperties&) to not have to query
+           everything again in the instance that gets subsequently moved to
+           the Device. Copies all properties and features that were queried
+           so far, extension properties get queried again if needed. */
+        MAGNUM_VK_LOCAL DeviceProperties copyCachedInternal();
+
         /* Combines isVersionSupported(E::coreVersion()) and
            ExtensionProperties::isSupported<E>(). Used internally to avoid
            accidents with incorrectly specified extension core version when
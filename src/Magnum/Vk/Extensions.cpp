@@ -72,6 +72,7 @@ constexpr Extension DeviceExtensions[] {
     Extensions::EXT::extended_dynamic_state{},
     Extensions::EXT::image_robustness{},
     Extensions::EXT::index_type_uint8{},
+    Extensions::EXT::memory_budget{},
     Extensions::EXT::robustness2{},
     Extensions::EXT::texture_compression_astc_hdr{},
     Extensions::EXT::vertex_attribute_divisor{},
@@ -121,12 +121,13 @@ namespace EXT {
     _extension(4,  EXT,shader_viewport_index_layer,         Vk10, Vk12) // #163
     _extension(5,  EXT,vertex_attribute_divisor,            Vk10, None) // #191
     _extension(6,  EXT,scalar_block_layout,                 Vk10, Vk12) // #222
-    _extension(7,  EXT,separate_stencil_usage,              Vk10, Vk12) // #247
-    _extension(8,  EXT,host_query_reset,                    Vk10, Vk12) // #262
-    _extension(9,  EXT,index_type_uint8,                    Vk10, None) // #266
-    _extension(10, EXT,extended_dynamic_state,              Vk10, None) // #268
-    _extension(11, EXT,robustness2,                         Vk10, None) // #287
-    _extension(12, EXT,image_robustness,                    Vk10, None) // #336
+    _extension(7,  EXT,memory_budget,                       Vk10, None) // #238
+    _extension(8,  EXT,separate_stencil_usage,              Vk10, Vk12) // #247
+    _extension(9,  EXT,host_query_reset,                    Vk10, Vk12) // #262
+    _extension(10, EXT,index_type_uint8,                    Vk10, None) // #266
+    _extension(11, EXT,extended_dynamic_state,              Vk10, None) // #268
+    _extension(12, EXT,robustness2,                         Vk10, None) // #287
+    _extension(13, EXT,image_robustness,                    Vk10, None) // #336
 } namespace IMG {
     _extension(20, IMG,format_pvrtc,                        Vk10, None) // #55
 } namespace KHR {
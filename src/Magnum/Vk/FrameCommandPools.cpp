@@ -0,0 +1,146 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FrameCommandPools.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+
+#include "Magnum/Vk/CommandBuffer.h"
+#include "Magnum/Vk/CommandPoolCreateInfo.h"
+#include "Magnum/Vk/FenceCreateInfo.h"
+
+namespace Magnum { namespace Vk {
+
+namespace {
+
+struct Thread {
+    CommandPool pool{NoCreate};
+    /* Command buffers allocated from the pool, primary and secondary. They're
+       freed together with the pool, and the first used[i] of them are
+       currently handed out. */
+    Containers::Array<VkCommandBuffer> buffers[2];
+    std::size_t used[2]{};
+};
+
+struct Frame {
+    Fence fence{NoCreate};
+    Containers::Array<Thread> threads;
+};
+
+}
+
+struct FrameCommandPools::State {
+    explicit State(Device& device, UnsignedInt queueFamilyIndex, UnsignedInt threadCount, UnsignedInt frameCount);
+
+    Device& device;
+    UnsignedInt threadCount;
+    Containers::Array<Frame> frames;
+    /* Count of beginFrame() calls, the current frame slot is then
+       (frameId - 1) % frames.size() */
+    UnsignedLong frameId{};
+};
+
+FrameCommandPools::State::State(Device& device, const UnsignedInt queueFamilyIndex, const UnsignedInt threadCount, const UnsignedInt frameCount): device(device), threadCount{threadCount}, frames{frameCount} {
+    for(Frame& frame: frames) {
+        frame.fence = Fence{device, FenceCreateInfo{FenceCreateInfo::Flag::Signaled}};
+        frame.threads = Containers::Array<Thread>{threadCount};
+        for(Thread& thread: frame.threads)
+            thread.pool = CommandPool{device, CommandPoolCreateInfo{queueFamilyIndex, CommandPoolCreateInfo::Flag::Transient}};
+    }
+}
+
+FrameCommandPools::FrameCommandPools(Device& device, const UnsignedInt queueFamilyIndex, const UnsignedInt threadCount, const UnsignedInt frameCount) {
+    CORRADE_ASSERT(threadCount && frameCount,
+        "Vk::FrameCommandPools: expected non-zero thread and frame count, got" << threadCount << "and" << frameCount, );
+    _state.emplace(device, queueFamilyIndex, threadCount, frameCount);
+}
+
+FrameCommandPools::FrameCommandPools(NoCreateT) noexcept {}
+
+FrameCommandPools::FrameCommandPools(FrameCommandPools&&) noexcept = default;
+
+FrameCommandPools::~FrameCommandPools() = default;
+
+FrameCommandPools& FrameCommandPools::operator=(FrameCommandPools&&) noexcept = default;
+
+UnsignedInt FrameCommandPools::threadCount() const {
+    return _state ? _state->threadCount : 0;
+}
+
+UnsignedInt FrameCommandPools::frameCount() const {
+    return _state ? _state->frames.size() : 0;
+}
+
+UnsignedInt FrameCommandPools::frame() const {
+    CORRADE_ASSERT(_state->frameId,
+        "Vk::FrameCommandPools::frame(): no frame begun yet", {});
+    return (_state->frameId - 1) % _state->frames.size();
+}
+
+void FrameCommandPools::beginFrame() {
+    State& state = *_state;
+    Frame& frame = state.frames[state.frameId++ % state.frames.size()];
+
+    /* Wait until the GPU is done with the commands submitted with this slot
+       the last time, after that the pools can be reset */
+    frame.fence.wait();
+    frame.fence.reset();
+    for(Thread& thread: frame.threads) {
+        thread.pool.reset();
+        thread.used[0] = thread.used[1] = 0;
+    }
+}
+
+Fence& FrameCommandPools::fence() {
+    CORRADE_ASSERT(_state->frameId,
+        "Vk::FrameCommandPools::fence(): no frame begun yet", _state->frames[0].fence);
+    return _state->frames[(_state->frameId - 1) % _state->frames.size()].fence;
+}
+
+CommandPool& FrameCommandPools::pool(const UnsignedInt thread) {
+    CORRADE_ASSERT(_state->frameId,
+        "Vk::FrameCommandPools::pool(): no frame begun yet", _state->frames[0].threads[0].pool);
+    CORRADE_ASSERT(thread < _state->threadCount,
+        "Vk::FrameCommandPools::pool(): index" << thread << "out of range for" << _state->threadCount << "threads", _state->frames[0].threads[0].pool);
+    return _state->frames[(_state->frameId - 1) % _state->frames.size()].threads[thread].pool;
+}
+
+CommandBuffer FrameCommandPools::allocate(const UnsignedInt thread, const CommandBufferLevel level) {
+    CORRADE_ASSERT(_state->frameId,
+        "Vk::FrameCommandPools::allocate(): no frame begun yet", CommandBuffer{NoCreate});
+    CORRADE_ASSERT(thread < _state->threadCount,
+        "Vk::FrameCommandPools::allocate(): index" << thread << "out of range for" << _state->threadCount << "threads", CommandBuffer{NoCreate});
+    Thread& t = _state->frames[(_state->frameId - 1) % _state->frames.size()].threads[thread];
+
+    /* Reuse a buffer allocated in an earlier frame, if there's any left,
+       otherwise allocate a new one. The pool owns it in both cases. */
+    const std::size_t i = level == CommandBufferLevel::Primary ? 0 : 1;
+    if(t.used[i] == t.buffers[i].size())
+        arrayAppend(t.buffers[i], t.pool.allocate(level).release());
+    return CommandBuffer::wrap(_state->device, t.pool, t.buffers[i][t.used[i]++]);
+}
+
+}}
@@ -0,0 +1,211 @@
+#ifndef Magnum_Vk_FrameCommandPools_h
+#define Magnum_Vk_FrameCommandPools_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::FrameCommandPools
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/CommandPool.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/Vulkan.h"
+#include "Magnum/Vk/visibility.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Per-thread command pools for multiple frames in flight
+@m_since_latest
+
+A @ref CommandPool and command buffers allocated from it can be used only from
+a single thread at a time. For recording a frame on multiple threads in
+parallel, each thread thus needs its own pool, and because the command buffers
+can't be reset while the GPU still executes them, there has to be a separate
+set of pools for each frame in flight. This class manages such pools, together
+with a @ref Fence for each frame that tells when the pools can be safely
+reused.
+
+@section Vk-FrameCommandPools-creation Creation
+
+The instance is created for a particular queue family, a count of threads
+that are going to record commands and a count of frames in flight:
+
+@snippet Vk.cpp FrameCommandPools-creation
+
+@section Vk-FrameCommandPools-usage Usage
+
+Each frame starts with @ref beginFrame(), which waits until the GPU finishes
+executing commands submitted with the same frame slot @ref frameCount() frames
+ago, and then resets all its command pools at once, which is significantly
+cheaper than resetting each command buffer separately.
+
+After that, each thread calls @ref allocate() with its own thread index to get
+command buffers for recording. The buffers are recycled across frames, so after
+the first few frames no new allocations happen. Secondary command buffers are
+then executed from a primary command buffer with
+@ref CommandBuffer::executeCommands(), and the primary command buffers
+submitted to a queue with @ref fence(), which then gets waited on by the next
+@ref beginFrame() using the same slot:
+
+@snippet Vk.cpp FrameCommandPools-usage
+
+@subsection Vk-FrameCommandPools-usage-threads Thread safety
+
+The @ref beginFrame() function is expected to be called on a single thread
+while no other thread is accessing the instance. After that, @ref allocate()
+and @ref pool() can be called from multiple threads concurrently as long as
+each thread uses a different thread index.
+
+@section Vk-FrameCommandPools-destruction Destruction
+
+Destroying the instance frees all command pools and command buffers allocated
+from them. It's the application responsibility to ensure none of them is being
+executed anymore, for example by waiting on @ref fence() of the last submitted
+frame.
+*/
+class MAGNUM_VK_EXPORT FrameCommandPools {
+    public:
+        /**
+         * @brief Constructor
+         * @param device            Vulkan device to create the pools on
+         * @param queueFamilyIndex  Queue family index the command buffers
+         *      will be submitted to
+         * @param threadCount       Count of threads recording command
+         *      buffers. Expected to be non-zero.
+         * @param frameCount        Count of frames in flight. Expected to be
+         *      non-zero.
+         *
+         * Creates @cpp threadCount*frameCount @ce command pools with
+         * @ref CommandPoolCreateInfo::Flag::Transient set and
+         * @p frameCount fences created with
+         * @ref FenceCreateInfo::Flag::Signaled set, so the first
+         * @ref beginFrame() for each frame slot doesn't wait.
+         */
+        explicit FrameCommandPools(Device& device, UnsignedInt queueFamilyIndex, UnsignedInt threadCount, UnsignedInt frameCount = 2);
+
+        /**
+         * @brief Construct without creating the pools
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         */
+        explicit FrameCommandPools(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        FrameCommandPools(const FrameCommandPools&) = delete;
+
+        /** @brief Move constructor */
+        FrameCommandPools(FrameCommandPools&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Frees all command pools and fences. See
+         * @ref Vk-FrameCommandPools-destruction for more information.
+         */
+        ~FrameCommandPools();
+
+        /** @brief Copying is not allowed */
+        FrameCommandPools& operator=(const FrameCommandPools&) = delete;
+
+        /** @brief Move assignment */
+        FrameCommandPools& operator=(FrameCommandPools&&) noexcept;
+
+        /** @brief Thread count */
+        UnsignedInt threadCount() const;
+
+        /** @brief Count of frames in flight */
+        UnsignedInt frameCount() const;
+
+        /**
+         * @brief Current frame slot
+         *
+         * Index of the frame slot used since the last @ref beginFrame(), in
+         * range @cpp [0, frameCount()) @ce. Expects that @ref beginFrame()
+         * was called at least once.
+         */
+        UnsignedInt frame() const;
+
+        /**
+         * @brief Begin a frame
+         *
+         * Advances to the next frame slot, waits on its @ref fence(), resets
+         * the fence and all command pools of the slot. All command buffers
+         * previously allocated from the slot are put back to the initial
+         * state and will get reused by subsequent @ref allocate() calls.
+         * @see @ref Fence::wait(), @ref Fence::reset(),
+         *      @ref CommandPool::reset()
+         */
+        void beginFrame();
+
+        /**
+         * @brief Fence of the current frame slot
+         *
+         * Meant to be passed to the last @ref Queue::submit() of the frame
+         * so the next @ref beginFrame() using the same slot can wait for the
+         * submitted work to finish. Expects that @ref beginFrame() was called
+         * at least once.
+         */
+        Fence& fence();
+
+        /**
+         * @brief Command pool for given thread in the current frame slot
+         *
+         * Expects that @ref beginFrame() was called at least once and
+         * @p thread is less than @ref threadCount().
+         */
+        CommandPool& pool(UnsignedInt thread);
+
+        /**
+         * @brief Allocate a command buffer for given thread
+         *
+         * Returns a command buffer in the initial state allocated from
+         * @ref pool() for given @p thread, reusing a buffer allocated in an
+         * earlier frame using the same slot if possible. The returned
+         * instance doesn't own the Vulkan handle, the buffer stays valid
+         * until the next @ref beginFrame() using the same slot or until the
+         * @ref FrameCommandPools instance is destroyed. Expects that
+         * @ref beginFrame() was called at least once and @p thread is less
+         * than @ref threadCount().
+         * @see @ref CommandPool::allocate()
+         */
+        CommandBuffer allocate(UnsignedInt thread, CommandBufferLevel level = CommandBufferLevel::Primary);
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
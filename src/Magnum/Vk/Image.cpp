@@ -137,7 +137,7 @@ Image Image::wrap(Device& device, const VkImage handle, const Magnum::Compressed
     return wrap(device, handle, pixelFormat(format), flags);
 }
 
-Image::Image(Device& device, const ImageCreateInfo& info, NoAllocateT): _device{&device}, _flags{HandleFlag::DestroyOnDestruction}, _format{PixelFormat(info->format)}, _dedicatedMemory{NoCreate} {
+Image::Image(Device& device, const ImageCreateInfo& info, NoAllocateT): _device{&device}, _flags{HandleFlag::DestroyOnDestruction}, _format{PixelFormat(info->format)}, _dedicatedMemory{NoCreate}, _allocation{NoCreate} {
     MAGNUM_VK_INTERNAL_ASSERT_SUCCESS(device->CreateImage(device, info, nullptr, &_handle));
 }
 
@@ -149,9 +149,13 @@ Image::Image(Device& device, const ImageCreateInfo& info, const MemoryFlags memo
     }});
 }
 
-Image::Image(NoCreateT): _device{}, _handle{}, _format{}, _dedicatedMemory{NoCreate} {}
+Image::Image(Device& device, const ImageCreateInfo& info, MemoryAllocator& allocator, const MemoryFlags memoryFlags): Image{device, info, NoAllocate} {
+    bindAllocation(allocator.allocate(memoryRequirements(), memoryFlags, info->tiling == VK_IMAGE_TILING_LINEAR ? MemoryAllocationFlags{MemoryAllocationFlag::Linear} : MemoryAllocationFlags{}));
+}
+
+Image::Image(NoCreateT): _device{}, _handle{}, _format{}, _dedicatedMemory{NoCreate}, _allocation{NoCreate} {}
 
-Image::Image(Image&& other) noexcept: _device{other._device}, _handle{other._handle}, _flags{other._flags}, _format{other._format}, _dedicatedMemory{Utility::move(other._dedicatedMemory)} {
+Image::Image(Image&& other) noexcept: _device{other._device}, _handle{other._handle}, _flags{other._flags}, _format{other._format}, _dedicatedMemory{Utility::move(other._dedicatedMemory)}, _allocation{Utility::move(other._allocation)} {
     other._handle = {};
 }
 
@@ -167,6 +171,7 @@ Image& Image::operator=(Image&& other) noexcept {
     swap(other._flags, _flags);
     swap(other._format, _format);
     swap(other._dedicatedMemory, _dedicatedMemory);
+    swap(other._allocation, _allocation);
     return *this;
 }
 
@@ -205,6 +210,23 @@ Memory& Image::dedicatedMemory() {
     return _dedicatedMemory;
 }
 
+void Image::bindAllocation(MemoryAllocation&& allocation) {
+    CORRADE_ASSERT(allocation,
+        "Vk::Image::bindAllocation(): the allocation is empty", );
+    bindMemory(allocation.memory(), allocation.offset());
+    _allocation = Utility::move(allocation);
+}
+
+bool Image::hasAllocation() const {
+    return !!_allocation;
+}
+
+MemoryAllocation& Image::allocation() {
+    CORRADE_ASSERT(_allocation,
+        "Vk::Image::allocation(): image doesn't have memory from an allocator", _allocation);
+    return _allocation;
+}
+
 VkImage Image::release() {
     const VkImage handle = _handle;
     _handle = {};
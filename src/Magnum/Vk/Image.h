@@ -36,6 +36,7 @@
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Vk/Memory.h"
+#include "Magnum/Vk/MemoryAllocator.h"
 #include "Magnum/Vk/Vk.h"
 #include "Magnum/Vk/Vulkan.h"
 #include "Magnum/Vk/visibility.h"
@@ -245,6 +246,14 @@ constructor together with specifying @ref MemoryFlags for memory allocation.
 
 With an @ref Image ready, you may want to proceed to @ref ImageView creation.
 
+@subsection Vk-Image-creation-allocator Memory from an allocator
+
+With many objects, a dedicated allocation for each of them is wasteful and may
+hit the allocation count limit of the driver. Passing a @ref MemoryAllocator to
+the constructor instead sub-allocates the memory from a shared block. The
+allocation is then owned by the image and available through
+@ref allocation(). See @ref MemoryAllocator for more information.
+
 @subsection Vk-Image-creation-custom-allocation Custom memory allocation
 
 Using @ref Image(Device&, const ImageCreateInfo&, NoAllocateT), the image will
@@ -376,6 +385,23 @@ class MAGNUM_VK_EXPORT Image {
          */
         explicit Image(Device& device, const ImageCreateInfo& info, MemoryFlags memoryFlags);
 
+        /**
+         * @brief Construct an image with memory from an allocator
+         * @param device        Vulkan device to create the image on
+         * @param info          Image creation info
+         * @param allocator     Allocator to allocate the memory from
+         * @param memoryFlags   Memory allocation flags
+         * @m_since_latest
+         *
+         * Compared to @ref Image(Device&, const ImageCreateInfo&, MemoryFlags)
+         * the memory is sub-allocated from a block shared with other objects
+         * using @ref MemoryAllocator::allocate() and is subsequently
+         * accessible through @ref allocation(). Images with
+         * @val_vk{IMAGE_TILING_LINEAR,ImageTiling} are placed into blocks
+         * with @ref MemoryAllocationFlag::Linear.
+         */
+        explicit Image(Device& device, const ImageCreateInfo& info, MemoryAllocator& allocator, MemoryFlags memoryFlags);
+
         /**
          * @brief Construct without creating the image
          *
@@ -463,6 +489,36 @@ class MAGNUM_VK_EXPORT Image {
          */
         Memory& dedicatedMemory();
 
+        /**
+         * @brief Bind memory from an allocator
+         * @m_since_latest
+         *
+         * Equivalent to @ref bindMemory() with @ref MemoryAllocation::memory()
+         * and @ref MemoryAllocation::offset(), with the additional effect that
+         * @p allocation ownership transfers to the image and is then available
+         * through @ref allocation(). Expects that @p allocation is not empty.
+         */
+        void bindAllocation(MemoryAllocation&& allocation);
+
+        /**
+         * @brief Whether the image has memory from an allocator
+         * @m_since_latest
+         *
+         * Returns @cpp true @ce if the image memory was bound using
+         * @ref bindAllocation(), @cpp false @ce otherwise.
+         * @see @ref allocation()
+         */
+        bool hasAllocation() const;
+
+        /**
+         * @brief Memory allocation
+         * @m_since_latest
+         *
+         * Expects that the image has memory from an allocator.
+         * @see @ref hasAllocation()
+         */
+        MemoryAllocation& allocation();
+
         /**
          * @brief Release the underlying Vulkan image
          *
@@ -503,6 +559,7 @@ class MAGNUM_VK_EXPORT Image {
         PixelFormat _format;
 
         Memory _dedicatedMemory;
+        MemoryAllocation _allocation;
 };
 
 /**
@@ -32,7 +32,9 @@
 #include "Magnum/Vk/DeviceProperties.h"
 #include "Magnum/Vk/Extensions.h"
 #include "Magnum/Vk/Image.h"
+#include "Magnum/Vk/QueryPool.h"
 #include "Magnum/Vk/RenderPass.h"
+#include "Magnum/Vk/Semaphore.h"
 #include "Magnum/Vk/Shader.h"
 #include "Magnum/Vk/Version.h"
 #include "Magnum/Vk/Implementation/DriverWorkaround.h"
@@ -125,6 +127,27 @@ DeviceState::DeviceState(Device& device, Containers::Array<Containers::Pair<Cont
     } else {
         createShaderImplementation = &Shader::createImplementationDefault;
     }
+
+    /* There's no fallback if neither Vulkan 1.2 nor KHR_timeline_semaphore is
+       available, the Semaphore constructor asserts that timeline semaphores
+       are enabled instead */
+    if(device.isVersionSupported(Version::Vk12)) {
+        getSemaphoreValueImplementation = &Semaphore::getValueImplementation12;
+        signalSemaphoreImplementation = &Semaphore::signalImplementation12;
+        waitSemaphoresImplementation = &Semaphore::waitImplementation12;
+    } else {
+        getSemaphoreValueImplementation = &Semaphore::getValueImplementationKHR;
+        signalSemaphoreImplementation = &Semaphore::signalImplementationKHR;
+        waitSemaphoresImplementation = &Semaphore::waitImplementationKHR;
+    }
+
+    /* Similarly, QueryPool::reset() has no fallback if neither Vulkan 1.2 nor
+       EXT_host_query_reset is available */
+    if(device.isVersionSupported(Version::Vk12)) {
+        resetQueryPoolImplementation = &QueryPool::resetImplementation12;
+    } else {
+        resetQueryPoolImplementation = &QueryPool::resetImplementationEXT;
+    }
 }
 
 }}}
@@ -63,6 +63,12 @@ struct DeviceState {
     void(*cmdCopyImageImplementation)(CommandBuffer&, const CopyImageInfo&);
     void(*cmdCopyBufferToImageImplementation)(CommandBuffer&, const CopyBufferToImageInfo&);
     void(*cmdCopyImageToBufferImplementation)(CommandBuffer&, const CopyImageToBufferInfo&);
+
+    VkResult(*getSemaphoreValueImplementation)(Device&, VkSemaphore, UnsignedLong&);
+    VkResult(*signalSemaphoreImplementation)(Device&, const VkSemaphoreSignalInfo&);
+    VkResult(*waitSemaphoresImplementation)(Device&, const VkSemaphoreWaitInfo&, UnsignedLong);
+
+    void(*resetQueryPoolImplementation)(Device&, VkQueryPool, UnsignedInt, UnsignedInt);
 };
 
 }}}
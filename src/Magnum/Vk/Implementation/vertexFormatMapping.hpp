@@ -136,4 +136,7 @@ _c(Matrix4x2bNormalizedAligned, Vector2bNormalized)
 _c(Matrix4x3hAligned, Vector3h)
 _c(Matrix4x3bNormalizedAligned, Vector3b)
 _c(Matrix4x3sNormalizedAligned, Vector3s)
+_c(Vector3i1010102Normalized, Vector4i1010102Normalized)
+_c2(Vector4i1010102Normalized)
+_c2(Vector4ui1010102Normalized)
 #endif
@@ -89,9 +89,12 @@ InstanceCreateInfo::InstanceCreateInfo(const Int argc, const char* const* const
         if((_state->version = args.value<Version>("vulkan-version")) == Version::None)
             Warning{} << "Invalid --magnum-vulkan-version" << args.value<Containers::StringView>("vulkan-version") << Debug::nospace << ", ignoring";
     }
-    if(_state && _state->version == Version::None)
+    /* Otherwise query the version, but only once and save it -- it's needed
+       for implicit extensions below and then again in Instance::tryCreate() */
+    if(!_state) _state.emplace();
+    if(_state->version == Version::None)
         _state->version = enumerateInstanceVersion();
-    _applicationInfo.apiVersion = UnsignedInt(_state ? _state->version : enumerateInstanceVersion());
+    _applicationInfo.apiVersion = UnsignedInt(_state->version);
 
     /** @todo handle disabled workarounds once we need them on the instance
        level as well -- also ensure that warnings about unknown workarounds are
@@ -0,0 +1,372 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MemoryAllocator.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Vk/Device.h"
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/Extensions.h"
+#include "Magnum/Vk/Memory.h"
+#include "Magnum/Vk/MemoryAllocateInfo.h"
+
+namespace Magnum { namespace Vk {
+
+namespace Implementation {
+
+struct MemoryFreeRange {
+    UnsignedLong offset;
+    UnsignedLong size;
+};
+
+struct MemoryBlock {
+    explicit MemoryBlock(Memory&& memory, UnsignedInt type, UnsignedInt heap, bool linear, bool dedicated): memory{Utility::move(memory)}, type{type}, heap{heap}, linear{linear}, dedicated{dedicated}, allocationCount{} {}
+
+    Memory memory;
+    UnsignedInt type;
+    UnsignedInt heap;
+    bool linear;
+    bool dedicated;
+    UnsignedInt allocationCount;
+    /* Sorted by offset, adjacent ranges are always merged together */
+    Containers::Array<MemoryFreeRange> free;
+    /* Declared after the memory so it gets unmapped before the memory is
+       freed */
+    Containers::Array<char, MemoryMapDeleter> mapping;
+};
+
+struct MemoryAllocatorState {
+    explicit MemoryAllocatorState(Device& device, UnsignedLong blockSize): device{&device}, blockSize{blockSize}, allocationCount{}, allocatedSize{} {}
+
+    Device* device;
+    UnsignedLong blockSize;
+    Containers::Array<Containers::Pointer<MemoryBlock>> blocks;
+    std::size_t allocationCount;
+    UnsignedLong allocatedSize[VK_MAX_MEMORY_HEAPS];
+};
+
+}
+
+namespace {
+
+using Implementation::MemoryAllocatorState;
+using Implementation::MemoryBlock;
+using Implementation::MemoryFreeRange;
+
+MemoryBlock& allocateBlock(MemoryAllocatorState& state, const UnsignedInt memory, const UnsignedLong size, const bool linear, const bool dedicated) {
+    Device& device = *state.device;
+    const UnsignedInt heap = device.properties().memoryHeapIndex(memory);
+    Containers::Pointer<MemoryBlock> block{InPlaceInit, Memory{device, MemoryAllocateInfo{size, memory}}, memory, heap, linear, dedicated};
+    if(!dedicated) arrayAppend(block->free, MemoryFreeRange{0, size});
+    state.allocatedSize[heap] += size;
+
+    MemoryBlock& out = *block;
+    arrayAppend(state.blocks, Utility::move(block));
+    return out;
+}
+
+void destroyBlock(MemoryAllocatorState& state, MemoryBlock& block) {
+    state.allocatedSize[block.heap] -= block.memory.size();
+
+    /* Order of the blocks doesn't matter, so swap with the last one and
+       drop it */
+    for(std::size_t i = 0; i != state.blocks.size(); ++i) {
+        if(state.blocks[i].get() != &block) continue;
+
+        if(i != state.blocks.size() - 1) {
+            using Utility::swap;
+            swap(state.blocks[i], state.blocks[state.blocks.size() - 1]);
+        }
+        arrayRemoveSuffix(state.blocks);
+        return;
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+void removeFreeRange(Containers::Array<MemoryFreeRange>& free, const std::size_t i) {
+    for(std::size_t j = i + 1; j != free.size(); ++j)
+        free[j - 1] = free[j];
+    arrayRemoveSuffix(free);
+}
+
+void freeAllocation(MemoryAllocatorState& state, MemoryBlock& block, const UnsignedLong offset, const UnsignedLong size) {
+    --state.allocationCount;
+    --block.allocationCount;
+
+    if(block.dedicated) {
+        destroyBlock(state, block);
+        return;
+    }
+
+    /* Put the range back, merging it with free neighbors */
+    Containers::Array<MemoryFreeRange>& free = block.free;
+    std::size_t i = 0;
+    while(i != free.size() && free[i].offset < offset) ++i;
+    const bool mergePrevious = i && free[i - 1].offset + free[i - 1].size == offset;
+    const bool mergeNext = i != free.size() && offset + size == free[i].offset;
+    if(mergePrevious && mergeNext) {
+        free[i - 1].size += size + free[i].size;
+        removeFreeRange(free, i);
+    } else if(mergePrevious) {
+        free[i - 1].size += size;
+    } else if(mergeNext) {
+        free[i].offset = offset;
+        free[i].size += size;
+    } else arrayInsert(free, i, MemoryFreeRange{offset, size});
+
+    /* Free the block if it's empty, unless it's the last one of given kind.
+       Otherwise creating and destroying a single buffer in a loop would
+       allocate and free a whole block every time. */
+    if(block.allocationCount) return;
+    for(Containers::Pointer<MemoryBlock>& other: state.blocks) {
+        if(other.get() == &block || other->dedicated || other->type != block.type || other->linear != block.linear)
+            continue;
+
+        destroyBlock(state, block);
+        return;
+    }
+}
+
+}
+
+MemoryAllocation::MemoryAllocation(NoCreateT) noexcept: _state{}, _block{}, _offset{}, _size{} {}
+
+MemoryAllocation::MemoryAllocation(MemoryAllocation&& other) noexcept: _state{other._state}, _block{other._block}, _offset{other._offset}, _size{other._size} {
+    other._block = {};
+    other._offset = {};
+    other._size = {};
+}
+
+MemoryAllocation::~MemoryAllocation() {
+    if(_block) freeAllocation(*_state, *_block, _offset, _size);
+}
+
+MemoryAllocation& MemoryAllocation::operator=(MemoryAllocation&& other) noexcept {
+    using Utility::swap;
+    swap(other._state, _state);
+    swap(other._block, _block);
+    swap(other._offset, _offset);
+    swap(other._size, _size);
+    return *this;
+}
+
+Memory& MemoryAllocation::memory() {
+    CORRADE_ASSERT(_block,
+        "Vk::MemoryAllocation::memory(): the instance holds no allocation", _block->memory);
+    return _block->memory;
+}
+
+UnsignedInt MemoryAllocation::memoryType() const {
+    CORRADE_ASSERT(_block,
+        "Vk::MemoryAllocation::memoryType(): the instance holds no allocation", {});
+    return _block->type;
+}
+
+bool MemoryAllocation::isDedicated() const {
+    CORRADE_ASSERT(_block,
+        "Vk::MemoryAllocation::isDedicated(): the instance holds no allocation", {});
+    return _block->dedicated;
+}
+
+Containers::ArrayView<char> MemoryAllocation::map() {
+    CORRADE_ASSERT(_block,
+        "Vk::MemoryAllocation::map(): the instance holds no allocation", {});
+
+    if(!_block->mapping.data()) {
+        CORRADE_ASSERT(_state->device->properties().memoryFlags(_block->type) & MemoryFlag::HostVisible,
+            "Vk::MemoryAllocation::map(): memory type" << _block->type << "is not host-visible", {});
+        _block->mapping = _block->memory.map();
+    }
+
+    return _block->mapping.slice(_offset, _offset + _size);
+}
+
+MemoryAllocator::MemoryAllocator(Device& device, const UnsignedLong blockSize): _state{InPlaceInit, device, blockSize} {}
+
+MemoryAllocator::MemoryAllocator(NoCreateT) noexcept {}
+
+MemoryAllocator::MemoryAllocator(MemoryAllocator&&) noexcept = default;
+
+MemoryAllocator::~MemoryAllocator() {
+    CORRADE_ASSERT(!_state || !_state->allocationCount,
+        "Vk::MemoryAllocator: destroyed with" << _state->allocationCount << "live allocations", );
+}
+
+MemoryAllocator& MemoryAllocator::operator=(MemoryAllocator&&) noexcept = default;
+
+UnsignedLong MemoryAllocator::blockSize(const UnsignedInt memory) const {
+    DeviceProperties& properties = _state->device->properties();
+    CORRADE_ASSERT(memory < properties.memoryCount(),
+        "Vk::MemoryAllocator::blockSize(): index" << memory << "out of range for" << properties.memoryCount() << "memory types", {});
+
+    if(_state->blockSize) return _state->blockSize;
+
+    /* Same heuristic as in AMD's Vulkan Memory Allocator -- small heaps, such
+       as the 256 MB device-local host-visible heap on discrete GPUs, would
+       otherwise be eaten by a single block */
+    return Math::min(UnsignedLong{256*1024*1024}, properties.memoryHeapSize(properties.memoryHeapIndex(memory))/8);
+}
+
+MemoryAllocation MemoryAllocator::allocate(const MemoryRequirements& requirements, const MemoryFlags requiredFlags, const MemoryFlags preferredFlags, const MemoryAllocationFlags flags) {
+    const UnsignedInt memory = _state->device->properties().pickMemory(requiredFlags, preferredFlags, requirements.memories());
+    const UnsignedLong size = requirements.size();
+    const UnsignedLong alignment = Math::max(requirements.alignment(), UnsignedLong{1});
+    const UnsignedLong blockSize = this->blockSize(memory);
+    const bool linear = !!(flags & MemoryAllocationFlag::Linear);
+
+    MemoryAllocation out{NoCreate};
+    out._state = _state.get();
+    out._size = size;
+    ++_state->allocationCount;
+
+    /* Allocations that are explicitly dedicated or too large to share a block
+       with anything else get their own memory */
+    if((flags & MemoryAllocationFlag::Dedicated) || size > blockSize/2) {
+        MemoryBlock& block = allocateBlock(*_state, memory, size, linear, true);
+        ++block.allocationCount;
+        out._block = &block;
+        return out;
+    }
+
+    /* Pick the smallest free range that fits the allocation among all blocks
+       of given kind */
+    MemoryBlock* bestBlock = nullptr;
+    std::size_t bestRange{};
+    UnsignedLong bestOffset{};
+    UnsignedLong bestSize = ~UnsignedLong{};
+    for(Containers::Pointer<MemoryBlock>& block: _state->blocks) {
+        if(block->dedicated || block->type != memory || block->linear != linear)
+            continue;
+
+        for(std::size_t i = 0; i != block->free.size(); ++i) {
+            const MemoryFreeRange& range = block->free[i];
+            if(range.size >= bestSize) continue;
+
+            const UnsignedLong offset = (range.offset + alignment - 1)/alignment*alignment;
+            if(offset + size > range.offset + range.size) continue;
+
+            bestBlock = block.get();
+            bestRange = i;
+            bestOffset = offset;
+            bestSize = range.size;
+        }
+    }
+
+    /* Nothing found, allocate a new block */
+    if(!bestBlock) {
+        bestBlock = &allocateBlock(*_state, memory, blockSize, linear, false);
+        bestRange = 0;
+        bestOffset = 0;
+    }
+
+    /* Cut the allocation out of the range, keeping the alignment padding
+       before and the remaining space after free */
+    Containers::Array<MemoryFreeRange>& free = bestBlock->free;
+    const MemoryFreeRange range = free[bestRange];
+    const UnsignedLong padding = bestOffset - range.offset;
+    const UnsignedLong remaining = range.offset + range.size - bestOffset - size;
+    if(padding && remaining) {
+        free[bestRange].size = padding;
+        arrayInsert(free, bestRange + 1, MemoryFreeRange{bestOffset + size, remaining});
+    } else if(padding) {
+        free[bestRange].size = padding;
+    } else if(remaining) {
+        free[bestRange] = MemoryFreeRange{bestOffset + size, remaining};
+    } else removeFreeRange(free, bestRange);
+
+    ++bestBlock->allocationCount;
+    out._block = bestBlock;
+    out._offset = bestOffset;
+    return out;
+}
+
+MemoryAllocation MemoryAllocator::allocate(const MemoryRequirements& requirements, const MemoryFlags requiredFlags, const MemoryAllocationFlags flags) {
+    return allocate(requirements, requiredFlags, {}, flags);
+}
+
+std::size_t MemoryAllocator::allocationCount() const {
+    return _state->allocationCount;
+}
+
+std::size_t MemoryAllocator::blockCount() const {
+    return _state->blocks.size();
+}
+
+UnsignedLong MemoryAllocator::allocatedSize(const UnsignedInt heap) const {
+    CORRADE_ASSERT(heap < _state->device->properties().memoryHeapCount(),
+        "Vk::MemoryAllocator::allocatedSize(): index" << heap << "out of range for" << _state->device->properties().memoryHeapCount() << "memory heaps", {});
+    return _state->allocatedSize[heap];
+}
+
+UnsignedLong MemoryAllocator::heapUsage(const UnsignedInt heap) {
+    Device& device = *_state->device;
+    CORRADE_ASSERT(heap < device.properties().memoryHeapCount(),
+        "Vk::MemoryAllocator::heapUsage(): index" << heap << "out of range for" << device.properties().memoryHeapCount() << "memory heaps", {});
+
+    if(device.isExtensionEnabled<Extensions::EXT::memory_budget>())
+        return device.properties().memoryBudget().heapUsage[heap];
+    return _state->allocatedSize[heap];
+}
+
+UnsignedLong MemoryAllocator::heapBudget(const UnsignedInt heap) {
+    Device& device = *_state->device;
+    CORRADE_ASSERT(heap < device.properties().memoryHeapCount(),
+        "Vk::MemoryAllocator::heapBudget(): index" << heap << "out of range for" << device.properties().memoryHeapCount() << "memory heaps", {});
+
+    if(device.isExtensionEnabled<Extensions::EXT::memory_budget>())
+        return device.properties().memoryBudget().heapBudget[heap];
+    return device.properties().memoryHeapSize(heap)/10*8;
+}
+
+Debug& operator<<(Debug& debug, const MemoryAllocationFlag value) {
+    debug << "Vk::MemoryAllocationFlag" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case Vk::MemoryAllocationFlag::value: return debug << "::" << Debug::nospace << #value;
+        _c(Dedicated)
+        _c(Linear)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    /* Flag bits should be in hex, unlike plain values */
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const MemoryAllocationFlags value) {
+    return Containers::enumSetDebugOutput(debug, value, "Vk::MemoryAllocationFlags{}", {
+        Vk::MemoryAllocationFlag::Dedicated,
+        Vk::MemoryAllocationFlag::Linear});
+}
+
+}}
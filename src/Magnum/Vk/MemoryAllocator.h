@@ -0,0 +1,373 @@
+#ifndef Magnum_Vk_MemoryAllocator_h
+#define Magnum_Vk_MemoryAllocator_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::MemoryAllocator, @ref Magnum::Vk::MemoryAllocation, enum @ref Magnum::Vk::MemoryAllocationFlag, enum set @ref Magnum::Vk::MemoryAllocationFlags
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/EnumSet.h>
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/Vulkan.h"
+#include "Magnum/Vk/visibility.h"
+
+namespace Magnum { namespace Vk {
+
+namespace Implementation {
+    struct MemoryAllocatorState;
+    struct MemoryBlock;
+}
+
+/**
+@brief Memory allocation flag
+@m_since_latest
+
+@see @ref MemoryAllocationFlags, @ref MemoryAllocator::allocate()
+*/
+enum class MemoryAllocationFlag: UnsignedByte {
+    /**
+     * Allocate a dedicated @ref Memory instead of a sub-range of a shared
+     * block. Done implicitly for allocations larger than half of
+     * @ref MemoryAllocator::blockSize().
+     */
+    Dedicated = 1 << 0,
+
+    /**
+     * The allocation is for a buffer or a linearly tiled image. Linear and
+     * non-linear resources are placed into separate blocks so the
+     * @m_class{m-doc-external} [bufferImageGranularity](https://www.khronos.org/registry/vulkan/specs/1.2/html/vkspec.html#resources-bufferimagegranularity)
+     * limit doesn't need to be taken into account when placing them next to
+     * each other. Buffers created with
+     * @ref Buffer::Buffer(Device&, const BufferCreateInfo&, MemoryAllocator&, MemoryFlags)
+     * set this flag implicitly.
+     */
+    Linear = 1 << 1
+};
+
+/**
+@debugoperatorenum{MemoryAllocationFlag}
+@m_since_latest
+*/
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, MemoryAllocationFlag value);
+
+/**
+@brief Memory allocation flags
+@m_since_latest
+
+@see @ref MemoryAllocator::allocate()
+*/
+typedef Containers::EnumSet<MemoryAllocationFlag> MemoryAllocationFlags;
+
+CORRADE_ENUMSET_OPERATORS(MemoryAllocationFlags)
+
+/**
+@debugoperatorenum{MemoryAllocationFlags}
+@m_since_latest
+*/
+MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, MemoryAllocationFlags value);
+
+/**
+@brief Memory sub-allocation
+@m_since_latest
+
+A sub-range of a @ref Memory block owned by a @ref MemoryAllocator, returned
+from @ref MemoryAllocator::allocate(). The range is returned back to the
+allocator on destruction. See @ref MemoryAllocator for more information.
+
+@attention The allocation keeps a reference to internal allocator state, which
+    means the originating @ref MemoryAllocator has to stay alive for as long as
+    any of its allocations exist. Moving the allocator is fine.
+*/
+class MAGNUM_VK_EXPORT MemoryAllocation {
+    public:
+        /**
+         * @brief Construct without allocating
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         */
+        explicit MemoryAllocation(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        MemoryAllocation(const MemoryAllocation&) = delete;
+
+        /** @brief Move constructor */
+        MemoryAllocation(MemoryAllocation&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Returns the range back to the originating allocator. If the
+         * allocation is dedicated, the memory is freed immediately.
+         */
+        ~MemoryAllocation();
+
+        /** @brief Copying is not allowed */
+        MemoryAllocation& operator=(const MemoryAllocation&) = delete;
+
+        /** @brief Move assignment */
+        MemoryAllocation& operator=(MemoryAllocation&& other) noexcept;
+
+        /**
+         * @brief Whether the instance holds an allocation
+         *
+         * Returns @cpp false @ce for a @ref MemoryAllocation(NoCreateT) "NoCreate"'d
+         * or moved-out instance, @cpp true @ce otherwise.
+         */
+        explicit operator bool() const { return _block; }
+
+        /**
+         * @brief Memory the allocation is a sub-range of
+         *
+         * The memory is shared with other allocations unless
+         * @ref isDedicated() is @cpp true @ce, so it shouldn't be mapped
+         * directly --- use @ref map() instead. Expects that the instance holds
+         * an allocation.
+         */
+        Memory& memory();
+
+        /** @brief Offset of the allocation in @ref memory() */
+        UnsignedLong offset() const { return _offset; }
+
+        /** @brief Allocation size */
+        UnsignedLong size() const { return _size; }
+
+        /**
+         * @brief Memory type index
+         *
+         * Expects that the instance holds an allocation.
+         * @see @ref DeviceProperties::memoryFlags()
+         */
+        UnsignedInt memoryType() const;
+
+        /**
+         * @brief Whether the allocation has its own dedicated memory
+         *
+         * Expects that the instance holds an allocation.
+         * @see @ref MemoryAllocationFlag::Dedicated
+         */
+        bool isDedicated() const;
+
+        /**
+         * @brief Map the allocation for host access
+         *
+         * The whole @ref memory() block is mapped on the first call and stays
+         * mapped until the block is freed, so repeated calls and mapping
+         * other allocations from the same block are cheap. The returned view
+         * has @ref size() bytes. Expects that the instance holds an
+         * allocation in memory with @ref MemoryFlag::HostVisible.
+         */
+        Containers::ArrayView<char> map();
+
+    private:
+        friend MemoryAllocator;
+
+        Implementation::MemoryAllocatorState* _state;
+        Implementation::MemoryBlock* _block;
+        UnsignedLong _offset;
+        UnsignedLong _size;
+};
+
+/**
+@brief Memory allocator
+@m_since_latest
+
+Sub-allocates @ref Buffer, @ref Image and other object memory from a pool of
+large @ref Memory blocks instead of making a dedicated @fn_vk{AllocateMemory}
+call for each. Besides the allocation call latency, this avoids hitting the
+@m_class{m-doc-external} [maxMemoryAllocationCount](https://www.khronos.org/registry/vulkan/specs/1.2/html/vkspec.html#limits-maxMemoryAllocationCount)
+limit, which is as low as 4096 on common drivers.
+
+@section Vk-MemoryAllocator-usage Usage
+
+Pass the allocator to the @ref Buffer or @ref Image constructor together with
+the desired @ref MemoryFlags. The allocation is then owned by the object and
+returned back to the allocator on its destruction:
+
+@snippet Vk.cpp MemoryAllocator-usage
+
+Alternatively, for objects created with @ref NoAllocate, call
+@ref allocate() with their @ref MemoryRequirements and bind the result with
+@ref Buffer::bindAllocation() or @ref Image::bindAllocation().
+
+@section Vk-MemoryAllocator-strategy Allocation strategy
+
+Blocks are allocated lazily for each memory type, with a size of
+@ref blockSize() that's by default 256 MB or an eighth of the memory heap size,
+whichever is smaller. Inside a block, free ranges are kept sorted by offset,
+each allocation picks the smallest range that fits it with given alignment and
+neighboring free ranges are merged back together when an allocation is freed.
+Allocations larger than half of the block size or ones with
+@ref MemoryAllocationFlag::Dedicated get their own @ref Memory instead. Linear
+and non-linear resources are kept in separate blocks, see
+@ref MemoryAllocationFlag::Linear for details.
+
+When a block becomes empty, it's freed, except for the last block of given
+memory type and kind, which is kept around to avoid repeated allocations and
+deallocations when a single object gets repeatedly created and destroyed.
+
+@section Vk-MemoryAllocator-budget Memory budget
+
+@ref heapUsage() and @ref heapBudget() report how much of a heap is used and
+how much the application can use before allocations may start failing or
+causing the system to swap. If the @vk_extension{EXT,memory_budget} extension
+is enabled on the device, the values are queried from the driver and thus
+include allocations done by other parts of the application and other
+processes. Otherwise the usage includes only blocks allocated by this allocator
+and the budget is estimated as 80% of the heap size.
+
+@section Vk-MemoryAllocator-thread-safety Thread safety
+
+The allocator is not thread-safe, allocations and deallocations from multiple
+threads have to be externally synchronized.
+*/
+class MAGNUM_VK_EXPORT MemoryAllocator {
+    public:
+        /**
+         * @brief Constructor
+         * @param device        Vulkan device to allocate the memory on
+         * @param blockSize     Preferred block size. If @cpp 0 @ce, for each
+         *      memory type it's picked as 256 MB or an eighth of the
+         *      corresponding heap size, whichever is smaller.
+         */
+        explicit MemoryAllocator(Device& device, UnsignedLong blockSize = 0);
+
+        /**
+         * @brief Construct without creating the allocator
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         */
+        explicit MemoryAllocator(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        MemoryAllocator(const MemoryAllocator&) = delete;
+
+        /** @brief Move constructor */
+        MemoryAllocator(MemoryAllocator&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Frees all blocks. Expects that there are no live allocations.
+         */
+        ~MemoryAllocator();
+
+        /** @brief Copying is not allowed */
+        MemoryAllocator& operator=(const MemoryAllocator&) = delete;
+
+        /** @brief Move assignment */
+        MemoryAllocator& operator=(MemoryAllocator&& other) noexcept;
+
+        /**
+         * @brief Block size for given memory type
+         *
+         * Expects that @p memory is smaller than
+         * @ref DeviceProperties::memoryCount().
+         */
+        UnsignedLong blockSize(UnsignedInt memory) const;
+
+        /**
+         * @brief Allocate memory
+         * @param requirements      Memory requirements of the object the
+         *      memory is allocated for
+         * @param requiredFlags     Memory flags that should be present in the
+         *      picked memory type
+         * @param preferredFlags    Memory flags that are preferred to be
+         *      present in the picked memory type
+         * @param flags             Allocation flags
+         *
+         * The memory type is picked using @ref DeviceProperties::pickMemory().
+         * @see @ref Buffer::bindAllocation(), @ref Image::bindAllocation()
+         */
+        MemoryAllocation allocate(const MemoryRequirements& requirements, MemoryFlags requiredFlags, MemoryFlags preferredFlags = {}, MemoryAllocationFlags flags = {});
+
+        /** @overload */
+        MemoryAllocation allocate(const MemoryRequirements& requirements, MemoryFlags requiredFlags, MemoryAllocationFlags flags);
+
+        /**
+         * @brief Count of live allocations
+         *
+         * Includes dedicated allocations.
+         */
+        std::size_t allocationCount() const;
+
+        /**
+         * @brief Count of allocated memory blocks
+         *
+         * Includes dedicated allocations, as each of those has its own
+         * @ref Memory.
+         */
+        std::size_t blockCount() const;
+
+        /**
+         * @brief Size of memory blocks allocated from given heap
+         *
+         * Sum of all block sizes allocated by this allocator from given heap,
+         * including dedicated allocations. Expects that @p heap is smaller
+         * than @ref DeviceProperties::memoryHeapCount().
+         */
+        UnsignedLong allocatedSize(UnsignedInt heap) const;
+
+        /**
+         * @brief Memory heap usage
+         *
+         * If @vk_extension{EXT,memory_budget} is enabled on the device,
+         * returns the current usage of the heap by the whole process as
+         * reported by the driver, otherwise returns @ref allocatedSize().
+         * Expects that @p heap is smaller than
+         * @ref DeviceProperties::memoryHeapCount().
+         * @see @ref DeviceProperties::memoryBudget()
+         */
+        UnsignedLong heapUsage(UnsignedInt heap);
+
+        /**
+         * @brief Memory heap budget
+         *
+         * If @vk_extension{EXT,memory_budget} is enabled on the device,
+         * returns the heap budget as reported by the driver, otherwise
+         * returns 80% of @ref DeviceProperties::memoryHeapSize(). Expects that
+         * @p heap is smaller than @ref DeviceProperties::memoryHeapCount().
+         * @see @ref DeviceProperties::memoryBudget()
+         */
+        UnsignedLong heapBudget(UnsignedInt heap);
+
+    private:
+        Containers::Pointer<Implementation::MemoryAllocatorState> _state;
+};
+
+}}
+
+#endif
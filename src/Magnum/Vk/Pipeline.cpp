@@ -32,12 +32,15 @@
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/BigEnumSet.hpp>
 
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Vk/Assert.h"
 #include "Magnum/Vk/Device.h"
 #include "Magnum/Vk/Handle.h"
 #include "Magnum/Vk/Image.h"
 #include "Magnum/Vk/Integration.h"
 #include "Magnum/Vk/MeshLayout.h"
+#include "Magnum/Vk/PipelineCache.h"
 #include "Magnum/Vk/ShaderSet.h"
 
 namespace Magnum { namespace Vk {
@@ -301,7 +304,11 @@ Pipeline Pipeline::wrap(Device& device, const PipelineBindPoint bindPoint, const
     return wrap(device, bindPoint, handle, DynamicRasterizationStates{}, flags);
 }
 
-Pipeline::Pipeline(Device& device, const RasterizationPipelineCreateInfo& info):
+Pipeline::Pipeline(Device& device, const RasterizationPipelineCreateInfo& info): Pipeline{device, info, VkPipelineCache{}} {}
+
+Pipeline::Pipeline(Device& device, const RasterizationPipelineCreateInfo& info, PipelineCache& cache): Pipeline{device, info, cache.handle()} {}
+
+Pipeline::Pipeline(Device& device, const RasterizationPipelineCreateInfo& info, const VkPipelineCache cache):
     _device{&device},
     #ifdef CORRADE_GRACEFUL_ASSERT
     /* Otherwise vkDestroyPipeline() crashes when we hit the assert */
@@ -316,11 +323,15 @@ Pipeline::Pipeline(Device& device, const RasterizationPipelineCreateInfo& info):
     CORRADE_ASSERT(info->pViewportState || info->pRasterizationState->rasterizerDiscardEnable || info->pDynamicState,
         "Vk::Pipeline: if rasterization discard is not enabled, the viewport has to be either dynamic or set via setViewport()", );
 
-    MAGNUM_VK_INTERNAL_ASSERT_SUCCESS(device->CreateGraphicsPipelines(device, {}, 1, info, nullptr, &_handle));
+    MAGNUM_VK_INTERNAL_ASSERT_SUCCESS(device->CreateGraphicsPipelines(device, cache, 1, info, nullptr, &_handle));
 }
 
-Pipeline::Pipeline(Device& device, const ComputePipelineCreateInfo& info): _device{&device}, _bindPoint{PipelineBindPoint::Compute}, _flags{HandleFlag::DestroyOnDestruction}, _dynamicStates{} {
-    MAGNUM_VK_INTERNAL_ASSERT_SUCCESS(device->CreateComputePipelines(device, {}, 1, info, nullptr, &_handle));
+Pipeline::Pipeline(Device& device, const ComputePipelineCreateInfo& info): Pipeline{device, info, VkPipelineCache{}} {}
+
+Pipeline::Pipeline(Device& device, const ComputePipelineCreateInfo& info, PipelineCache& cache): Pipeline{device, info, cache.handle()} {}
+
+Pipeline::Pipeline(Device& device, const ComputePipelineCreateInfo& info, const VkPipelineCache cache): _device{&device}, _bindPoint{PipelineBindPoint::Compute}, _flags{HandleFlag::DestroyOnDestruction}, _dynamicStates{} {
+    MAGNUM_VK_INTERNAL_ASSERT_SUCCESS(device->CreateComputePipelines(device, cache, 1, info, nullptr, &_handle));
 }
 
 Pipeline::Pipeline(NoCreateT): _device{}, _handle{}, _bindPoint{}, _dynamicStates{} {}
@@ -421,6 +432,103 @@ CommandBuffer& CommandBuffer::bindPipeline(Pipeline& pipeline) {
     return *this;
 }
 
+CommandBuffer& CommandBuffer::setViewport(const Range3D& viewport) {
+    const VkViewport vkViewport(viewport);
+    if(_dynamicRasterizationStates & DynamicRasterizationState::ViewportWithCount)
+        (**_device).CmdSetViewportWithCountEXT(_handle, 1, &vkViewport);
+    else
+        (**_device).CmdSetViewport(_handle, 0, 1, &vkViewport);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setViewport(const Range2D& viewport) {
+    return setViewport(Range3D{{viewport.min(), 0.0f}, {viewport.max(), 1.0f}});
+}
+
+CommandBuffer& CommandBuffer::setScissor(const Range2Di& scissor) {
+    const VkRect2D vkScissor(scissor);
+    if(_dynamicRasterizationStates & DynamicRasterizationState::ScissorWithCount)
+        (**_device).CmdSetScissorWithCountEXT(_handle, 1, &vkScissor);
+    else
+        (**_device).CmdSetScissor(_handle, 0, 1, &vkScissor);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setLineWidth(const Float width) {
+    (**_device).CmdSetLineWidth(_handle, width);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setDepthBias(const Float constantFactor, const Float clamp, const Float slopeFactor) {
+    (**_device).CmdSetDepthBias(_handle, constantFactor, clamp, slopeFactor);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setBlendConstants(const Color4& color) {
+    (**_device).CmdSetBlendConstants(_handle, color.data());
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setDepthBounds(const Float min, const Float max) {
+    (**_device).CmdSetDepthBounds(_handle, min, max);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setStencilCompareMask(const StencilFaces faces, const UnsignedInt mask) {
+    (**_device).CmdSetStencilCompareMask(_handle, VkStencilFaceFlags(faces), mask);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setStencilWriteMask(const StencilFaces faces, const UnsignedInt mask) {
+    (**_device).CmdSetStencilWriteMask(_handle, VkStencilFaceFlags(faces), mask);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setStencilReference(const StencilFaces faces, const UnsignedInt reference) {
+    (**_device).CmdSetStencilReference(_handle, VkStencilFaceFlags(faces), reference);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setCullMode(const CullMode mode) {
+    (**_device).CmdSetCullModeEXT(_handle, VkCullModeFlags(mode));
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setFrontFace(const FrontFace face) {
+    (**_device).CmdSetFrontFaceEXT(_handle, VkFrontFace(face));
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setDepthTestEnabled(const bool enabled) {
+    (**_device).CmdSetDepthTestEnableEXT(_handle, enabled);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setDepthWriteEnabled(const bool enabled) {
+    (**_device).CmdSetDepthWriteEnableEXT(_handle, enabled);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setDepthCompareOperation(const CompareOperation operation) {
+    (**_device).CmdSetDepthCompareOpEXT(_handle, VkCompareOp(operation));
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setDepthBoundsTestEnabled(const bool enabled) {
+    (**_device).CmdSetDepthBoundsTestEnableEXT(_handle, enabled);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setStencilTestEnabled(const bool enabled) {
+    (**_device).CmdSetStencilTestEnableEXT(_handle, enabled);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::setStencilOperation(const StencilFaces faces, const StencilOperation failOperation, const StencilOperation passOperation, const StencilOperation depthFailOperation, const CompareOperation compareOperation) {
+    (**_device).CmdSetStencilOpEXT(_handle, VkStencilFaceFlags(faces), VkStencilOp(failOperation), VkStencilOp(passOperation), VkStencilOp(depthFailOperation), VkCompareOp(compareOperation));
+    return *this;
+}
+
 CommandBuffer& CommandBuffer::pipelineBarrier(const PipelineStages sourceStages, const PipelineStages destinationStages, const Containers::ArrayView<const MemoryBarrier> memoryBarriers, const Containers::ArrayView<const BufferMemoryBarrier> bufferMemoryBarriers, const Containers::ArrayView<const ImageMemoryBarrier> imageMemoryBarriers, const DependencyFlags dependencyFlags) {
     /* Once these grow (VkSampleLocationsInfoEXT?), they will need to be
        linearized into a separate array first */
@@ -106,6 +106,16 @@ a @ref ShaderSet containing a single @ref ShaderStage::Compute shader and a
 
 @snippet Vk.cpp Pipeline-creation-compute
 
+@section Vk-Pipeline-creation-cache Pipeline creation with a cache
+
+Both rasterization and compute pipelines can be created with a
+@ref PipelineCache, which allows the driver to reuse shader compilation
+results from earlier pipeline creations and, if the cache data get saved and
+loaded again, from previous application runs. See
+@ref Vk-PipelineCache-creation for details.
+
+@snippet Vk.cpp Pipeline-creation-cache
+
 @section Vk-Pipeline-usage Pipeline usage
 
 A pipeline is bound to a compatible command buffer using
@@ -147,6 +157,17 @@ class MAGNUM_VK_EXPORT Pipeline {
          */
         explicit Pipeline(Device& device, const RasterizationPipelineCreateInfo& info);
 
+        /**
+         * @brief Construct a rasterization pipeline using a pipeline cache
+         * @param device    Vulkan device to create the pipeline on
+         * @param info      Rasterization pipeline creation info
+         * @param cache     Pipeline cache
+         *
+         * Compared to @ref Pipeline(Device&, const RasterizationPipelineCreateInfo&)
+         * passes @p cache to @fn_vk{CreateGraphicsPipelines}.
+         */
+        explicit Pipeline(Device& device, const RasterizationPipelineCreateInfo& info, PipelineCache& cache);
+
         /**
          * @brief Construct a compute pipeline
          * @param device    Vulkan device to create the pipeline on
@@ -157,6 +178,17 @@ class MAGNUM_VK_EXPORT Pipeline {
          */
         explicit Pipeline(Device& device, const ComputePipelineCreateInfo& info);
 
+        /**
+         * @brief Construct a compute pipeline using a pipeline cache
+         * @param device    Vulkan device to create the pipeline on
+         * @param info      Compute pipeline creation info
+         * @param cache     Pipeline cache
+         *
+         * Compared to @ref Pipeline(Device&, const ComputePipelineCreateInfo&)
+         * passes @p cache to @fn_vk{CreateComputePipelines}.
+         */
+        explicit Pipeline(Device& device, const ComputePipelineCreateInfo& info, PipelineCache& cache);
+
         /**
          * @brief Construct without creating the pipeline layout
          *
@@ -224,6 +256,9 @@ class MAGNUM_VK_EXPORT Pipeline {
         VkPipeline release();
 
     private:
+        MAGNUM_VK_LOCAL explicit Pipeline(Device& device, const RasterizationPipelineCreateInfo& info, VkPipelineCache cache);
+        MAGNUM_VK_LOCAL explicit Pipeline(Device& device, const ComputePipelineCreateInfo& info, VkPipelineCache cache);
+
         /* Can't be a reference because of the NoCreate constructor */
         Device* _device;
 
@@ -0,0 +1,143 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PipelineCache.h"
+#include "PipelineCacheCreateInfo.h"
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Vk/Assert.h"
+#include "Magnum/Vk/Device.h"
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/Result.h"
+
+namespace Magnum { namespace Vk {
+
+PipelineCacheCreateInfo::PipelineCacheCreateInfo(const Containers::ArrayView<const void> initialData): _info{} {
+    _info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    _info.initialDataSize = initialData.size();
+    _info.pInitialData = initialData.data();
+}
+
+PipelineCacheCreateInfo::PipelineCacheCreateInfo(NoInitT) noexcept {}
+
+PipelineCacheCreateInfo::PipelineCacheCreateInfo(const VkPipelineCacheCreateInfo& info):
+    /* Can't use {} with GCC 4.8 here because it tries to initialize the first
+       member instead of doing a copy */
+    _info(info) {}
+
+PipelineCache PipelineCache::wrap(Device& device, const VkPipelineCache handle, const HandleFlags flags) {
+    PipelineCache out{NoCreate};
+    out._device = &device;
+    out._handle = handle;
+    out._flags = flags;
+    return out;
+}
+
+bool PipelineCache::isDataCompatible(DeviceProperties& properties, const Containers::ArrayView<const void> data) {
+    /* The data don't need to be aligned in any way, copy the header out */
+    VkPipelineCacheHeaderVersionOne header;
+    if(data.size() < sizeof(header)) return false;
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    const VkPhysicalDeviceProperties& deviceProperties = properties.properties().properties;
+    return header.headerSize >= sizeof(header) &&
+        header.headerSize <= data.size() &&
+        header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+        header.vendorID == deviceProperties.vendorID &&
+        header.deviceID == deviceProperties.deviceID &&
+        std::memcmp(header.pipelineCacheUUID, deviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+PipelineCache::PipelineCache(Device& device, const PipelineCacheCreateInfo& info): _device{&device}, _flags{HandleFlag::DestroyOnDestruction} {
+    /* Drivers are supposed to validate the data on their own, but not all of
+       them are robust enough, so discard data from a different device or
+       driver version here */
+    if(info->initialDataSize && !isDataCompatible(device.properties(), {info->pInitialData, info->initialDataSize})) {
+        VkPipelineCacheCreateInfo emptyInfo = *info;
+        emptyInfo.initialDataSize = 0;
+        emptyInfo.pInitialData = nullptr;
+        MAGNUM_VK_INTERNAL_ASSERT_SUCCESS(device->CreatePipelineCache(device, &emptyInfo, nullptr, &_handle));
+    } else MAGNUM_VK_INTERNAL_ASSERT_SUCCESS(device->CreatePipelineCache(device, info, nullptr, &_handle));
+}
+
+PipelineCache::PipelineCache(Device& device): PipelineCache{device, PipelineCacheCreateInfo{}} {}
+
+PipelineCache::PipelineCache(NoCreateT): _device{}, _handle{} {}
+
+PipelineCache::PipelineCache(PipelineCache&& other) noexcept: _device{other._device}, _handle{other._handle}, _flags{other._flags} {
+    other._handle = {};
+}
+
+PipelineCache::~PipelineCache() {
+    if(_handle && (_flags & HandleFlag::DestroyOnDestruction))
+        (**_device).DestroyPipelineCache(*_device, _handle, nullptr);
+}
+
+PipelineCache& PipelineCache::operator=(PipelineCache&& other) noexcept {
+    using Utility::swap;
+    swap(other._device, _device);
+    swap(other._handle, _handle);
+    swap(other._flags, _flags);
+    return *this;
+}
+
+Containers::Array<char> PipelineCache::data() {
+    std::size_t size;
+    MAGNUM_VK_INTERNAL_ASSERT_SUCCESS((**_device).GetPipelineCacheData(*_device, _handle, &size, nullptr));
+
+    /* The cache can be only growing between the two calls (if another thread
+       creates a pipeline with it), in which case the driver returns
+       VK_INCOMPLETE with only what fits written. That's still a valid
+       cache, so accept it, but make sure the size reflects what was actually
+       written. */
+    Containers::Array<char> out{NoInit, size};
+    if(MAGNUM_VK_INTERNAL_ASSERT_SUCCESS_OR((**_device).GetPipelineCacheData(*_device, _handle, &size, out.data()), Result::Incomplete) == Result::Incomplete && size != out.size()) {
+        Containers::Array<char> truncated{NoInit, size};
+        Utility::copy(out.prefix(size), truncated);
+        return truncated;
+    }
+
+    return out;
+}
+
+void PipelineCache::merge(const Containers::ArrayView<const VkPipelineCache> caches) {
+    MAGNUM_VK_INTERNAL_ASSERT_SUCCESS((**_device).MergePipelineCaches(*_device, _handle, caches.size(), caches.data()));
+}
+
+void PipelineCache::merge(const std::initializer_list<VkPipelineCache> caches) {
+    merge(Containers::arrayView(caches));
+}
+
+VkPipelineCache PipelineCache::release() {
+    const VkPipelineCache handle = _handle;
+    _handle = {};
+    return handle;
+}
+
+}}
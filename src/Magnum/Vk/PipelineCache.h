@@ -0,0 +1,207 @@
+#ifndef Magnum_Vk_PipelineCache_h
+#define Magnum_Vk_PipelineCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::PipelineCache
+ * @m_since_latest
+ */
+
+#include <initializer_list>
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/Handle.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/Vulkan.h"
+#include "Magnum/Vk/visibility.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Pipeline cache
+@m_since_latest
+
+Wraps a @type_vk_keyword{PipelineCache}. Allows the driver to reuse results of
+shader compilation across @ref Pipeline creations and, by saving and loading
+its contents, across application runs.
+
+@section Vk-PipelineCache-creation Pipeline cache creation
+
+An empty pipeline cache can be constructed directly using
+@ref PipelineCache(Device&). To reuse results from a previous run, pass the
+data retrieved via @ref data() to a @ref PipelineCacheCreateInfo:
+
+@snippet Vk.cpp PipelineCache-creation
+
+The cache data begin with a @type_vk{PipelineCacheHeaderVersionOne} header
+that identifies the vendor, the device and a driver-specific pipeline cache
+UUID, which is expected to change with every driver version that produces incompatible
+binaries. As some drivers are known to misbehave when given data from a
+different device or driver version, the header is checked using
+@ref isDataCompatible() on construction and incompatible data are discarded,
+resulting in an empty cache.
+
+@section Vk-PipelineCache-usage Pipeline cache usage
+
+The cache is then passed to @ref Pipeline creation. It's internally
+synchronized, so it can be used to create multiple pipelines from different
+threads at the same time. Once done, save the data for the next run:
+
+@snippet Vk.cpp PipelineCache-usage
+*/
+class MAGNUM_VK_EXPORT PipelineCache {
+    public:
+        /**
+         * @brief Wrap existing Vulkan handle
+         * @param device            Vulkan device the pipeline cache is
+         *      created on
+         * @param handle            The @type_vk{PipelineCache} handle
+         * @param flags             Handle flags
+         *
+         * The @p handle is expected to be originating from @p device. Unlike
+         * a pipeline cache created using a constructor, the Vulkan pipeline
+         * cache is by default not deleted on destruction, use @p flags for
+         * different behavior.
+         * @see @ref release()
+         */
+        static PipelineCache wrap(Device& device, VkPipelineCache handle, HandleFlags flags = {});
+
+        /**
+         * @brief Check whether pipeline cache data are compatible with a device
+         *
+         * Returns @cpp true @ce if @p data are large enough to contain a
+         * @type_vk{PipelineCacheHeaderVersionOne} header, the header is of
+         * @val_vk{PIPELINE_CACHE_HEADER_VERSION_ONE,PipelineCacheHeaderVersion}
+         * and its `vendorID`, `deviceID` and `pipelineCacheUUID` match the
+         * corresponding fields of @type_vk{PhysicalDeviceProperties} queried
+         * via @ref DeviceProperties::properties(), @cpp false @ce otherwise.
+         */
+        static bool isDataCompatible(DeviceProperties& properties, Containers::ArrayView<const void> data);
+
+        /**
+         * @brief Constructor
+         * @param device    Vulkan device to create the pipeline cache on
+         * @param info      Pipeline cache creation info
+         *
+         * If @p info contains initial data that aren't compatible with
+         * @p device according to @ref isDataCompatible(), the data are
+         * ignored and an empty cache is created instead.
+         * @see @fn_vk_keyword{CreatePipelineCache}
+         */
+        explicit PipelineCache(Device& device, const PipelineCacheCreateInfo& info);
+
+        /**
+         * @brief Construct an empty pipeline cache
+         *
+         * Equivalent to calling @ref PipelineCache(Device&, const PipelineCacheCreateInfo&)
+         * with a default-constructed @ref PipelineCacheCreateInfo.
+         */
+        explicit PipelineCache(Device& device);
+
+        /**
+         * @brief Construct without creating the pipeline cache
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         */
+        explicit PipelineCache(NoCreateT);
+
+        /** @brief Copying is not allowed */
+        PipelineCache(const PipelineCache&) = delete;
+
+        /** @brief Move constructor */
+        PipelineCache(PipelineCache&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys associated @type_vk{PipelineCache} handle, unless the
+         * instance was created using @ref wrap() without
+         * @ref HandleFlag::DestroyOnDestruction specified.
+         * @see @fn_vk_keyword{DestroyPipelineCache}, @ref release()
+         */
+        ~PipelineCache();
+
+        /** @brief Copying is not allowed */
+        PipelineCache& operator=(const PipelineCache&) = delete;
+
+        /** @brief Move assignment */
+        PipelineCache& operator=(PipelineCache&& other) noexcept;
+
+        /** @brief Underlying @type_vk{PipelineCache} handle */
+        VkPipelineCache handle() { return _handle; }
+        /** @overload */
+        operator VkPipelineCache() { return _handle; }
+
+        /** @brief Handle flags */
+        HandleFlags handleFlags() const { return _flags; }
+
+        /**
+         * @brief Pipeline cache data
+         *
+         * The returned data can be saved and passed to
+         * @ref PipelineCacheCreateInfo in a subsequent run.
+         * @see @fn_vk_keyword{GetPipelineCacheData}
+         */
+        Containers::Array<char> data();
+
+        /**
+         * @brief Merge other pipeline caches into this one
+         *
+         * Useful when each thread creates pipelines with its own cache. The
+         * @p caches are expected to not contain this cache.
+         * @see @fn_vk_keyword{MergePipelineCaches}
+         */
+        void merge(Containers::ArrayView<const VkPipelineCache> caches);
+
+        /** @overload */
+        void merge(std::initializer_list<VkPipelineCache> caches);
+
+        /**
+         * @brief Release the underlying Vulkan pipeline cache
+         *
+         * Releases ownership of the Vulkan pipeline cache and returns its
+         * handle so @fn_vk{DestroyPipelineCache} is not called on destruction.
+         * The internal state is then equivalent to moved-from state.
+         * @see @ref wrap()
+         */
+        VkPipelineCache release();
+
+    private:
+        /* Can't be a reference because of the NoCreate constructor */
+        Device* _device;
+
+        VkPipelineCache _handle;
+        HandleFlags _flags;
+};
+
+}}
+
+#endif
@@ -0,0 +1,147 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "QueryPool.h"
+#include "QueryPoolCreateInfo.h"
+#include "CommandBuffer.h"
+
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Vk/Assert.h"
+#include "Magnum/Vk/Device.h"
+#include "Magnum/Vk/Pipeline.h"
+#include "Magnum/Vk/Result.h"
+#include "Magnum/Vk/Implementation/DeviceState.h"
+
+namespace Magnum { namespace Vk {
+
+QueryPoolCreateInfo::QueryPoolCreateInfo(const QueryType type, const UnsignedInt count): _info{} {
+    CORRADE_ASSERT(type != QueryType::PipelineStatistics,
+        "Vk::QueryPoolCreateInfo: use the QueryPipelineStatistics overload for pipeline statistics queries", );
+    CORRADE_ASSERT(count,
+        "Vk::QueryPoolCreateInfo: there has to be at least one query", );
+
+    _info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    _info.queryType = VkQueryType(type);
+    _info.queryCount = count;
+}
+
+QueryPoolCreateInfo::QueryPoolCreateInfo(const QueryPipelineStatistics statistics, const UnsignedInt count): _info{} {
+    CORRADE_ASSERT(statistics,
+        "Vk::QueryPoolCreateInfo: there has to be at least one pipeline statistic", );
+    CORRADE_ASSERT(count,
+        "Vk::QueryPoolCreateInfo: there has to be at least one query", );
+
+    _info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    _info.queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS;
+    _info.queryCount = count;
+    _info.pipelineStatistics = VkQueryPipelineStatisticFlags(statistics);
+}
+
+QueryPoolCreateInfo::QueryPoolCreateInfo(NoInitT) noexcept {}
+
+QueryPoolCreateInfo::QueryPoolCreateInfo(const VkQueryPoolCreateInfo& info):
+    /* Can't use {} with GCC 4.8 here because it tries to initialize the first
+       member instead of doing a copy */
+    _info(info) {}
+
+QueryPool QueryPool::wrap(Device& device, const VkQueryPool handle, const HandleFlags flags) {
+    QueryPool out{NoCreate};
+    out._device = &device;
+    out._handle = handle;
+    out._flags = flags;
+    return out;
+}
+
+QueryPool::QueryPool(Device& device, const QueryPoolCreateInfo& info): _device{&device}, _flags{HandleFlag::DestroyOnDestruction} {
+    MAGNUM_VK_INTERNAL_ASSERT_SUCCESS(device->CreateQueryPool(device, info, nullptr, &_handle));
+}
+
+QueryPool::QueryPool(NoCreateT): _device{}, _handle{} {}
+
+QueryPool::QueryPool(QueryPool&& other) noexcept: _device{other._device}, _handle{other._handle}, _flags{other._flags} {
+    other._handle = {};
+}
+
+QueryPool::~QueryPool() {
+    if(_handle && (_flags & HandleFlag::DestroyOnDestruction))
+        (**_device).DestroyQueryPool(*_device, _handle, nullptr);
+}
+
+QueryPool& QueryPool::operator=(QueryPool&& other) noexcept {
+    using Utility::swap;
+    swap(other._device, _device);
+    swap(other._handle, _handle);
+    swap(other._flags, _flags);
+    return *this;
+}
+
+void QueryPool::reset(const UnsignedInt first, const UnsignedInt count) {
+    _device->state().resetQueryPoolImplementation(*_device, _handle, first, count);
+}
+
+bool QueryPool::results(const UnsignedInt first, const UnsignedInt count, const Containers::ArrayView<UnsignedLong> data, const QueryResultFlags flags) {
+    CORRADE_ASSERT(count && data.size() % count == 0,
+        "Vk::QueryPool::results(): expected a non-zero query count and a data size divisible by it but got" << count << "queries and" << data.size() << "values", {});
+
+    return MAGNUM_VK_INTERNAL_ASSERT_SUCCESS_OR((**_device).GetQueryPoolResults(*_device, _handle, first, count, data.size()*sizeof(UnsignedLong), data.data(), data.size()/count*sizeof(UnsignedLong), VK_QUERY_RESULT_64_BIT|VkQueryResultFlags(flags)), Result::NotReady) == Result::Success;
+}
+
+VkQueryPool QueryPool::release() {
+    const VkQueryPool handle = _handle;
+    _handle = {};
+    return handle;
+}
+
+void QueryPool::resetImplementationEXT(Device& device, const VkQueryPool queryPool, const UnsignedInt first, const UnsignedInt count) {
+    device->ResetQueryPoolEXT(device, queryPool, first, count);
+}
+
+void QueryPool::resetImplementation12(Device& device, const VkQueryPool queryPool, const UnsignedInt first, const UnsignedInt count) {
+    device->ResetQueryPool(device, queryPool, first, count);
+}
+
+CommandBuffer& CommandBuffer::resetQueryPool(QueryPool& pool, const UnsignedInt first, const UnsignedInt count) {
+    (**_device).CmdResetQueryPool(_handle, pool, first, count);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::beginQuery(QueryPool& pool, const UnsignedInt query, const QueryControlFlags flags) {
+    (**_device).CmdBeginQuery(_handle, pool, query, VkQueryControlFlags(flags));
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::endQuery(QueryPool& pool, const UnsignedInt query) {
+    (**_device).CmdEndQuery(_handle, pool, query);
+    return *this;
+}
+
+CommandBuffer& CommandBuffer::writeTimestamp(const PipelineStage stage, QueryPool& pool, const UnsignedInt query) {
+    (**_device).CmdWriteTimestamp(_handle, VkPipelineStageFlagBits(stage), pool, query);
+    return *this;
+}
+
+}}
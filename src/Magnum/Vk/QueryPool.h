@@ -0,0 +1,269 @@
+#ifndef Magnum_Vk_QueryPool_h
+#define Magnum_Vk_QueryPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::QueryPool, enum @ref Magnum::Vk::QueryResultFlag, @ref Magnum::Vk::QueryControlFlag, enum set @ref Magnum::Vk::QueryResultFlags, @ref Magnum::Vk::QueryControlFlags
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/Handle.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/Vulkan.h"
+#include "Magnum/Vk/visibility.h"
+
+namespace Magnum { namespace Vk {
+
+namespace Implementation { struct DeviceState; }
+
+/**
+@brief Query result flag
+@m_since_latest
+
+Wraps @type_vk_keyword{QueryResultFlagBits}. The
+@val_vk{QUERY_RESULT_64_BIT,QueryResultFlagBits} flag is implicitly set for
+all results retrieved through @ref QueryPool::results().
+@see @ref QueryResultFlags
+@m_enum_values_as_keywords
+*/
+enum class QueryResultFlag: UnsignedInt {
+    /** Wait for the results to become available */
+    Wait = VK_QUERY_RESULT_WAIT_BIT,
+
+    /**
+     * Write an additional availability value after each query, which is
+     * non-zero if the result is available and zero otherwise.
+     */
+    WithAvailability = VK_QUERY_RESULT_WITH_AVAILABILITY_BIT,
+
+    /** Allow returning partial results for queries that aren't available */
+    Partial = VK_QUERY_RESULT_PARTIAL_BIT
+};
+
+/**
+@brief Query result flags
+@m_since_latest
+
+Type-safe wrapper for @type_vk_keyword{QueryResultFlags}.
+@see @ref QueryPool::results()
+*/
+typedef Containers::EnumSet<QueryResultFlag> QueryResultFlags;
+
+CORRADE_ENUMSET_OPERATORS(QueryResultFlags)
+
+/**
+@brief Query control flag
+@m_since_latest
+
+Wraps @type_vk_keyword{QueryControlFlagBits}.
+@see @ref QueryControlFlags, @ref CommandBuffer::beginQuery()
+@m_enum_values_as_keywords
+*/
+enum class QueryControlFlag: UnsignedInt {
+    /**
+     * Precise occlusion query, returning the exact sample count instead of
+     * just a zero / non-zero value.
+     * @requires_vk_feature @ref DeviceFeature::OcclusionQueryPrecise
+     */
+    Precise = VK_QUERY_CONTROL_PRECISE_BIT
+};
+
+/**
+@brief Query control flags
+@m_since_latest
+
+Type-safe wrapper for @type_vk_keyword{QueryControlFlags}.
+@see @ref CommandBuffer::beginQuery()
+*/
+typedef Containers::EnumSet<QueryControlFlag> QueryControlFlags;
+
+CORRADE_ENUMSET_OPERATORS(QueryControlFlags)
+
+/**
+@brief Query pool
+@m_since_latest
+
+Wraps a @type_vk_keyword{QueryPool}, which holds a fixed count of occlusion,
+pipeline statistics or timestamp queries.
+
+@section Vk-QueryPool-creation Query pool creation
+
+A query pool is created from a @ref QueryPoolCreateInfo specifying the query
+type and count. For pipeline statistics queries, a set of
+@ref QueryPipelineStatistic values is passed instead of the type:
+
+@snippet Vk.cpp QueryPool-creation
+
+@section Vk-QueryPool-usage Basic usage
+
+Queries have to be reset before each use, either in a command buffer via
+@ref CommandBuffer::resetQueryPool() or from the host via @ref reset().
+Timestamps are then written using @ref CommandBuffer::writeTimestamp(),
+occlusion and pipeline statistics queries are delimited by
+@ref CommandBuffer::beginQuery() and @ref CommandBuffer::endQuery(). Once the
+command buffer finished executing, the results can be retrieved with
+@ref results():
+
+@snippet Vk.cpp QueryPool-usage
+
+Timestamp values are in units of `timestampPeriod` nanoseconds, available from
+@type_vk{PhysicalDeviceLimits} in @ref DeviceProperties::properties(). To
+avoid stalling the CPU on the GPU, use a ring of queries spanning more frames
+than there's frames in flight and retrieve results of the oldest ones, as is
+done in the @ref DebugTools::FrameProfilerVk class.
+*/
+class MAGNUM_VK_EXPORT QueryPool {
+    public:
+        /**
+         * @brief Wrap existing Vulkan handle
+         * @param device            Vulkan device the query pool is created on
+         * @param handle            The @type_vk{QueryPool} handle
+         * @param flags             Handle flags
+         *
+         * The @p handle is expected to be originating from @p device. Unlike
+         * a query pool created using a constructor, the Vulkan query pool is
+         * by default not deleted on destruction, use @p flags for different
+         * behavior.
+         * @see @ref release()
+         */
+        static QueryPool wrap(Device& device, VkQueryPool handle, HandleFlags flags = {});
+
+        /**
+         * @brief Constructor
+         * @param device    Vulkan device to create the query pool on
+         * @param info      Query pool creation info
+         *
+         * @see @fn_vk_keyword{CreateQueryPool}
+         */
+        explicit QueryPool(Device& device, const QueryPoolCreateInfo& info);
+
+        /**
+         * @brief Construct without creating the query pool
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         */
+        explicit QueryPool(NoCreateT);
+
+        /** @brief Copying is not allowed */
+        QueryPool(const QueryPool&) = delete;
+
+        /** @brief Move constructor */
+        QueryPool(QueryPool&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys associated @type_vk{QueryPool} handle, unless the instance
+         * was created using @ref wrap() without
+         * @ref HandleFlag::DestroyOnDestruction specified.
+         * @see @fn_vk_keyword{DestroyQueryPool}, @ref release()
+         */
+        ~QueryPool();
+
+        /** @brief Copying is not allowed */
+        QueryPool& operator=(const QueryPool&) = delete;
+
+        /** @brief Move assignment */
+        QueryPool& operator=(QueryPool&& other) noexcept;
+
+        /** @brief Underlying @type_vk{QueryPool} handle */
+        VkQueryPool handle() { return _handle; }
+        /** @overload */
+        operator VkQueryPool() { return _handle; }
+
+        /** @brief Handle flags */
+        HandleFlags handleFlags() const { return _flags; }
+
+        /**
+         * @brief Reset queries from the host
+         * @param first     First query to reset
+         * @param count     Count of queries to reset
+         *
+         * Equivalent to @ref CommandBuffer::resetQueryPool(), but done
+         * immediately from the host.
+         * @requires_vk12 Extension @vk_extension{EXT,host_query_reset} and the
+         *      @ref DeviceFeature::HostQueryReset feature enabled
+         * @see @fn_vk_keyword{ResetQueryPool},
+         *      @fn_vk_keyword{ResetQueryPoolEXT}
+         */
+        void reset(UnsignedInt first, UnsignedInt count);
+
+        /**
+         * @brief Retrieve query results
+         * @param first     First query to retrieve results of
+         * @param count     Count of queries to retrieve results of. Expected
+         *      to be non-zero.
+         * @param data      Output 64-bit values. Expected to have a size
+         *      divisible by @p count, the values of each query are then
+         *      placed at consecutive locations, with a stride of
+         *      @cpp data.size()/count @ce values.
+         * @param flags     Query result flags
+         *
+         * Returns @cpp true @ce if results of all queries were available and
+         * written to @p data, @cpp false @ce otherwise. A timestamp or
+         * occlusion query produces one value, a pipeline statistics query one
+         * value for each enabled @ref QueryPipelineStatistic, and
+         * @ref QueryResultFlag::WithAvailability adds one more value for
+         * each query. If @ref QueryResultFlag::Wait is set, the function
+         * blocks until the results are available and always returns
+         * @cpp true @ce.
+         * @see @fn_vk_keyword{GetQueryPoolResults}
+         */
+        bool results(UnsignedInt first, UnsignedInt count, Containers::ArrayView<UnsignedLong> data, QueryResultFlags flags = {});
+
+        /**
+         * @brief Release the underlying Vulkan query pool
+         *
+         * Releases ownership of the Vulkan query pool and returns its handle
+         * so @fn_vk{DestroyQueryPool} is not called on destruction. The
+         * internal state is then equivalent to moved-from state.
+         * @see @ref wrap()
+         */
+        VkQueryPool release();
+
+    private:
+        friend Implementation::DeviceState;
+
+        MAGNUM_VK_LOCAL static void resetImplementationEXT(Device& device, VkQueryPool queryPool, UnsignedInt first, UnsignedInt count);
+        MAGNUM_VK_LOCAL static void resetImplementation12(Device& device, VkQueryPool queryPool, UnsignedInt first, UnsignedInt count);
+
+        /* Can't be a reference because of the NoCreate constructor */
+        Device* _device;
+
+        VkQueryPool _handle;
+        HandleFlags _flags;
+};
+
+}}
+
+#endif
@@ -0,0 +1,213 @@
+#ifndef Magnum_Vk_QueryPoolCreateInfo_h
+#define Magnum_Vk_QueryPoolCreateInfo_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::QueryPoolCreateInfo, enum @ref Magnum::Vk::QueryType, @ref Magnum::Vk::QueryPipelineStatistic, enum set @ref Magnum::Vk::QueryPipelineStatistics
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/visibility.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/Vulkan.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Query type
+@m_since_latest
+
+Wraps @type_vk_keyword{QueryType}.
+@see @ref QueryPoolCreateInfo
+@m_enum_values_as_keywords
+*/
+enum class QueryType: Int {
+    /**
+     * Occlusion query, counting samples that passed the depth and stencil
+     * tests.
+     */
+    Occlusion = VK_QUERY_TYPE_OCCLUSION,
+
+    /**
+     * Pipeline statistics query. Create with
+     * @ref QueryPoolCreateInfo::QueryPoolCreateInfo(QueryPipelineStatistics, UnsignedInt)
+     * to specify which statistics to count.
+     * @requires_vk_feature @ref DeviceFeature::PipelineStatisticsQuery
+     */
+    PipelineStatistics = VK_QUERY_TYPE_PIPELINE_STATISTICS,
+
+    /**
+     * Timestamp query, written with
+     * @ref CommandBuffer::writeTimestamp(). Timestamp values are in units of
+     * `timestampPeriod` nanoseconds from @type_vk{PhysicalDeviceLimits}.
+     */
+    Timestamp = VK_QUERY_TYPE_TIMESTAMP
+};
+
+/**
+@brief Query pipeline statistic
+@m_since_latest
+
+Wraps @type_vk_keyword{QueryPipelineStatisticFlagBits}.
+@see @ref QueryPipelineStatistics, @ref QueryPoolCreateInfo
+@m_enum_values_as_keywords
+*/
+enum class QueryPipelineStatistic: UnsignedInt {
+    /** Count of vertices processed by the input assembly stage */
+    InputAssemblyVertices = VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT,
+
+    /** Count of primitives processed by the input assembly stage */
+    InputAssemblyPrimitives = VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT,
+
+    /** Count of vertex shader invocations */
+    VertexShaderInvocations = VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT,
+
+    /** Count of geometry shader invocations */
+    GeometryShaderInvocations = VK_QUERY_PIPELINE_STATISTIC_GEOMETRY_SHADER_INVOCATIONS_BIT,
+
+    /** Count of primitives generated by geometry shader invocations */
+    GeometryShaderPrimitives = VK_QUERY_PIPELINE_STATISTIC_GEOMETRY_SHADER_PRIMITIVES_BIT,
+
+    /** Count of primitives processed by the clipping stage */
+    ClippingInvocations = VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT,
+
+    /** Count of primitives output by the clipping stage */
+    ClippingPrimitives = VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT,
+
+    /** Count of fragment shader invocations */
+    FragmentShaderInvocations = VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT,
+
+    /** Count of patches processed by the tessellation control shader */
+    TessellationControlShaderPatches = VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_CONTROL_SHADER_PATCHES_BIT,
+
+    /** Count of tessellation evaluation shader invocations */
+    TessellationEvaluationShaderInvocations = VK_QUERY_PIPELINE_STATISTIC_TESSELLATION_EVALUATION_SHADER_INVOCATIONS_BIT,
+
+    /** Count of compute shader invocations */
+    ComputeShaderInvocations = VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT
+};
+
+/**
+@brief Query pipeline statistics
+@m_since_latest
+
+Type-safe wrapper for @type_vk_keyword{QueryPipelineStatisticFlags}.
+@see @ref QueryPoolCreateInfo
+*/
+typedef Containers::EnumSet<QueryPipelineStatistic> QueryPipelineStatistics;
+
+CORRADE_ENUMSET_OPERATORS(QueryPipelineStatistics)
+
+/**
+@brief Query pool creation info
+@m_since_latest
+
+Wraps a @type_vk_keyword{QueryPoolCreateInfo}. See
+@ref Vk-QueryPool-creation "Query pool creation" for usage information.
+*/
+class MAGNUM_VK_EXPORT QueryPoolCreateInfo {
+    public:
+        /**
+         * @brief Constructor
+         * @param type      Query type. Expected to not be
+         *      @ref QueryType::PipelineStatistics, use
+         *      @ref QueryPoolCreateInfo(QueryPipelineStatistics, UnsignedInt)
+         *      for that instead.
+         * @param count     Count of queries in the pool. Expected to be
+         *      non-zero.
+         *
+         * The following @type_vk{QueryPoolCreateInfo} fields are pre-filled
+         * in addition to `sType`, everything else is zero-filled:
+         *
+         * -    `queryType` to @p type
+         * -    `queryCount` to @p count
+         */
+        explicit QueryPoolCreateInfo(QueryType type, UnsignedInt count);
+
+        /**
+         * @brief Construct for pipeline statistics queries
+         * @param statistics    Statistics counted by each query. Expected to
+         *      be non-empty.
+         * @param count         Count of queries in the pool. Expected to be
+         *      non-zero.
+         *
+         * The following @type_vk{QueryPoolCreateInfo} fields are pre-filled
+         * in addition to `sType`, everything else is zero-filled:
+         *
+         * -    `queryType` to @ref QueryType::PipelineStatistics
+         * -    `queryCount` to @p count
+         * -    `pipelineStatistics` to @p statistics
+         *
+         * Each query then produces one value for each bit set in
+         * @p statistics, ordered by bit position.
+         * @requires_vk_feature @ref DeviceFeature::PipelineStatisticsQuery
+         */
+        explicit QueryPoolCreateInfo(QueryPipelineStatistics statistics, UnsignedInt count);
+
+        /**
+         * @brief Construct without initializing the contents
+         *
+         * Note that not even the `sType` field is set --- the structure has to
+         * be fully initialized afterwards in order to be usable.
+         */
+        explicit QueryPoolCreateInfo(NoInitT) noexcept;
+
+        /**
+         * @brief Construct from existing data
+         *
+         * Copies the existing values verbatim, pointers are kept unchanged
+         * without taking over the ownership. Modifying the newly created
+         * instance will not modify the original data nor the pointed-to data.
+         */
+        explicit QueryPoolCreateInfo(const VkQueryPoolCreateInfo& info);
+
+        /** @brief Underlying @type_vk{QueryPoolCreateInfo} structure */
+        VkQueryPoolCreateInfo& operator*() { return _info; }
+        /** @overload */
+        const VkQueryPoolCreateInfo& operator*() const { return _info; }
+        /** @overload */
+        VkQueryPoolCreateInfo* operator->() { return &_info; }
+        /** @overload */
+        const VkQueryPoolCreateInfo* operator->() const { return &_info; }
+        /** @overload */
+        operator const VkQueryPoolCreateInfo*() const { return &_info; }
+
+    private:
+        VkQueryPoolCreateInfo _info;
+};
+
+}}
+
+/* Make the definition complete -- it doesn't make sense to have a CreateInfo
+   without the corresponding object anyway. */
+#include "Magnum/Vk/QueryPool.h"
+
+#endif
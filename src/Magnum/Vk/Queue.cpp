@@ -33,6 +33,7 @@
 #include "Magnum/Vk/Assert.h"
 #include "Magnum/Vk/Device.h"
 #include "Magnum/Vk/Fence.h"
+#include "Magnum/Vk/Pipeline.h"
 
 namespace Magnum { namespace Vk {
 
@@ -97,6 +98,16 @@ Fence Queue::submit(const std::initializer_list<Containers::Reference<const Subm
 
 struct SubmitInfo::State {
     Containers::Array<VkCommandBuffer> commandBuffers;
+    Containers::Array<VkSemaphore> waitSemaphores;
+    Containers::Array<VkPipelineStageFlags> waitStages;
+    Containers::Array<UnsignedLong> waitValues;
+    Containers::Array<VkSemaphore> signalSemaphores;
+    Containers::Array<UnsignedLong> signalValues;
+
+    /* Connected to the pNext chain only once a timeline variant is used, but
+       the value arrays are kept in sync with the semaphore arrays always */
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    bool timelineInfoConnected{};
 };
 
 SubmitInfo::SubmitInfo(): _info{} {
@@ -152,4 +163,104 @@ SubmitInfo& SubmitInfo::setCommandBuffers(const std::initializer_list<VkCommandB
     return setCommandBuffers(Containers::arrayView(buffers));
 }
 
+void SubmitInfo::connectTimelineInfo() {
+    if(_state->timelineInfoConnected) return;
+    _state->timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    _state->timelineInfo.pNext = _info.pNext;
+    _info.pNext = &_state->timelineInfo;
+    _state->timelineInfoConnected = true;
+}
+
+SubmitInfo& SubmitInfo::setWaitSemaphores(const Containers::ArrayView<const Containers::Pair<VkSemaphore, PipelineStages>> semaphores) {
+    if(!_state) _state.emplace();
+
+    _state->waitSemaphores = Containers::Array<VkSemaphore>{NoInit, semaphores.size()};
+    _state->waitStages = Containers::Array<VkPipelineStageFlags>{NoInit, semaphores.size()};
+    /* Values are ignored for binary semaphores but if the timeline info is
+       connected, the count has to match */
+    _state->waitValues = Containers::Array<UnsignedLong>{ValueInit, semaphores.size()};
+    for(std::size_t i = 0; i != semaphores.size(); ++i) {
+        _state->waitSemaphores[i] = semaphores[i].first();
+        _state->waitStages[i] = VkPipelineStageFlags(semaphores[i].second());
+    }
+
+    _info.waitSemaphoreCount = semaphores.size();
+    _info.pWaitSemaphores = _state->waitSemaphores;
+    _info.pWaitDstStageMask = _state->waitStages;
+    _state->timelineInfo.waitSemaphoreValueCount = semaphores.size();
+    _state->timelineInfo.pWaitSemaphoreValues = _state->waitValues;
+    return *this;
+}
+
+SubmitInfo& SubmitInfo::setWaitSemaphores(const std::initializer_list<Containers::Pair<VkSemaphore, PipelineStages>> semaphores) {
+    return setWaitSemaphores(Containers::arrayView(semaphores));
+}
+
+SubmitInfo& SubmitInfo::setWaitSemaphores(const Containers::ArrayView<const Containers::Triple<VkSemaphore, UnsignedLong, PipelineStages>> semaphores) {
+    if(!_state) _state.emplace();
+
+    _state->waitSemaphores = Containers::Array<VkSemaphore>{NoInit, semaphores.size()};
+    _state->waitStages = Containers::Array<VkPipelineStageFlags>{NoInit, semaphores.size()};
+    _state->waitValues = Containers::Array<UnsignedLong>{NoInit, semaphores.size()};
+    for(std::size_t i = 0; i != semaphores.size(); ++i) {
+        _state->waitSemaphores[i] = semaphores[i].first();
+        _state->waitValues[i] = semaphores[i].second();
+        _state->waitStages[i] = VkPipelineStageFlags(semaphores[i].third());
+    }
+
+    _info.waitSemaphoreCount = semaphores.size();
+    _info.pWaitSemaphores = _state->waitSemaphores;
+    _info.pWaitDstStageMask = _state->waitStages;
+    _state->timelineInfo.waitSemaphoreValueCount = semaphores.size();
+    _state->timelineInfo.pWaitSemaphoreValues = _state->waitValues;
+    connectTimelineInfo();
+    return *this;
+}
+
+SubmitInfo& SubmitInfo::setWaitSemaphores(const std::initializer_list<Containers::Triple<VkSemaphore, UnsignedLong, PipelineStages>> semaphores) {
+    return setWaitSemaphores(Containers::arrayView(semaphores));
+}
+
+SubmitInfo& SubmitInfo::setSignalSemaphores(const Containers::ArrayView<const VkSemaphore> semaphores) {
+    if(!_state) _state.emplace();
+
+    _state->signalSemaphores = Containers::Array<VkSemaphore>{NoInit, semaphores.size()};
+    Utility::copy(semaphores, _state->signalSemaphores);
+    /* Values are ignored for binary semaphores but if the timeline info is
+       connected, the count has to match */
+    _state->signalValues = Containers::Array<UnsignedLong>{ValueInit, semaphores.size()};
+
+    _info.signalSemaphoreCount = semaphores.size();
+    _info.pSignalSemaphores = _state->signalSemaphores;
+    _state->timelineInfo.signalSemaphoreValueCount = semaphores.size();
+    _state->timelineInfo.pSignalSemaphoreValues = _state->signalValues;
+    return *this;
+}
+
+SubmitInfo& SubmitInfo::setSignalSemaphores(const std::initializer_list<VkSemaphore> semaphores) {
+    return setSignalSemaphores(Containers::arrayView(semaphores));
+}
+
+SubmitInfo& SubmitInfo::setSignalSemaphores(const Containers::ArrayView<const Containers::Pair<VkSemaphore, UnsignedLong>> semaphores) {
+    if(!_state) _state.emplace();
+
+    _state->signalSemaphores = Containers::Array<VkSemaphore>{NoInit, semaphores.size()};
+    _state->signalValues = Containers::Array<UnsignedLong>{NoInit, semaphores.size()};
+    for(std::size_t i = 0; i != semaphores.size(); ++i) {
+        _state->signalSemaphores[i] = semaphores[i].first();
+        _state->signalValues[i] = semaphores[i].second();
+    }
+
+    _info.signalSemaphoreCount = semaphores.size();
+    _info.pSignalSemaphores = _state->signalSemaphores;
+    _state->timelineInfo.signalSemaphoreValueCount = semaphores.size();
+    _state->timelineInfo.pSignalSemaphoreValues = _state->signalValues;
+    connectTimelineInfo();
+    return *this;
+}
+
+SubmitInfo& SubmitInfo::setSignalSemaphores(const std::initializer_list<Containers::Pair<VkSemaphore, UnsignedLong>> semaphores) {
+    return setSignalSemaphores(Containers::arrayView(semaphores));
+}
+
 }}
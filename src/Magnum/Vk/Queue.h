@@ -31,7 +31,9 @@
  * @m_since_latest
  */
 
+#include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/Triple.h>
 
 #include "Magnum/Tags.h"
 #include "Magnum/Vk/Vk.h"
@@ -162,7 +164,8 @@ class MAGNUM_VK_EXPORT SubmitInfo {
          *
          * -    *(none)*
          *
-         * @see @ref setCommandBuffers()
+         * @see @ref setCommandBuffers(), @ref setWaitSemaphores(),
+         *      @ref setSignalSemaphores()
          */
         explicit SubmitInfo();
 
@@ -209,6 +212,99 @@ class MAGNUM_VK_EXPORT SubmitInfo {
         /** @overload */
         SubmitInfo& setCommandBuffers(std::initializer_list<VkCommandBuffer> buffers);
 
+        /**
+         * @brief Set binary semaphores to wait on before executing the batch
+         * @param semaphores    Semaphores together with pipeline stages at
+         *      which each wait happens
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Replaces all semaphores set by previous calls to this function or
+         * @ref setWaitSemaphores(Containers::ArrayView<const Containers::Triple<VkSemaphore, UnsignedLong, PipelineStages>>).
+         * The following @type_vk{SubmitInfo} fields are set by this
+         * function:
+         *
+         * -    `waitSemaphoreCount` and `pWaitSemaphores` to the semaphores
+         * -    `pWaitDstStageMask` to the stages
+         *
+         * See @ref Vk-Semaphore-usage for a usage example.
+         */
+        SubmitInfo& setWaitSemaphores(Containers::ArrayView<const Containers::Pair<VkSemaphore, PipelineStages>> semaphores);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        SubmitInfo& setWaitSemaphores(std::initializer_list<Containers::Pair<VkSemaphore, PipelineStages>> semaphores);
+
+        /**
+         * @brief Set timeline semaphores to wait on before executing the batch
+         * @param semaphores    Semaphores together with values to wait for
+         *      and pipeline stages at which each wait happens
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Compared to @ref setWaitSemaphores(Containers::ArrayView<const Containers::Pair<VkSemaphore, PipelineStages>>)
+         * additionally connects a @type_vk_keyword{TimelineSemaphoreSubmitInfo}
+         * structure to the `pNext` chain, if not already, and sets its
+         * `waitSemaphoreValueCount` and `pWaitSemaphoreValues` fields to the
+         * values. For binary semaphores the value is ignored, so both kinds
+         * can be mixed together.
+         * @requires_vk12 Extension @vk_extension{KHR,timeline_semaphore}
+         */
+        SubmitInfo& setWaitSemaphores(Containers::ArrayView<const Containers::Triple<VkSemaphore, UnsignedLong, PipelineStages>> semaphores);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        SubmitInfo& setWaitSemaphores(std::initializer_list<Containers::Triple<VkSemaphore, UnsignedLong, PipelineStages>> semaphores);
+
+        /**
+         * @brief Set binary semaphores to signal once the batch finishes
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Replaces all semaphores set by previous calls to this function or
+         * @ref setSignalSemaphores(Containers::ArrayView<const Containers::Pair<VkSemaphore, UnsignedLong>>).
+         * The following @type_vk{SubmitInfo} fields are set by this
+         * function:
+         *
+         * -    `signalSemaphoreCount` and `pSignalSemaphores` to the
+         *      semaphores
+         *
+         * See @ref Vk-Semaphore-usage for a usage example.
+         */
+        SubmitInfo& setSignalSemaphores(Containers::ArrayView<const VkSemaphore> semaphores);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        SubmitInfo& setSignalSemaphores(std::initializer_list<VkSemaphore> semaphores);
+
+        /**
+         * @brief Set timeline semaphores to signal once the batch finishes
+         * @param semaphores    Semaphores together with values to set
+         * @return Reference to self (for method chaining)
+         * @m_since_latest
+         *
+         * Compared to @ref setSignalSemaphores(Containers::ArrayView<const VkSemaphore>)
+         * additionally connects a @type_vk_keyword{TimelineSemaphoreSubmitInfo}
+         * structure to the `pNext` chain, if not already, and sets its
+         * `signalSemaphoreValueCount` and `pSignalSemaphoreValues` fields to
+         * the values. For binary semaphores the value is ignored, so both
+         * kinds can be mixed together.
+         * @requires_vk12 Extension @vk_extension{KHR,timeline_semaphore}
+         */
+        SubmitInfo& setSignalSemaphores(Containers::ArrayView<const Containers::Pair<VkSemaphore, UnsignedLong>> semaphores);
+
+        /**
+         * @overload
+         * @m_since_latest
+         */
+        SubmitInfo& setSignalSemaphores(std::initializer_list<Containers::Pair<VkSemaphore, UnsignedLong>> semaphores);
+
         /** @brief Underlying @type_vk{SubmitInfo} structure */
         VkSubmitInfo& operator*() { return _info; }
         /** @overload */
@@ -230,6 +326,8 @@ class MAGNUM_VK_EXPORT SubmitInfo {
         operator const VkSubmitInfo&() const { return _info; }
 
     private:
+        MAGNUM_VK_LOCAL void connectTimelineInfo();
+
         VkSubmitInfo _info;
 
         struct State;
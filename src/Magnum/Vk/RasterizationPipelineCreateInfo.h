@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::Vk::RasterizationPipelineCreateInfo, enum @ref Magnum::Vk::DynamicRasterizationState, enum set @ref Magnum::Vk::DynamicRasterizationStates
+ * @brief Class @ref Magnum::Vk::RasterizationPipelineCreateInfo, enum @ref Magnum::Vk::DynamicRasterizationState, @ref Magnum::Vk::CullMode, @ref Magnum::Vk::FrontFace, @ref Magnum::Vk::CompareOperation, @ref Magnum::Vk::StencilOperation, @ref Magnum::Vk::StencilFace, enum set @ref Magnum::Vk::DynamicRasterizationStates, @ref Magnum::Vk::StencilFaces
  * @m_since_latest
  */
 
@@ -55,105 +55,96 @@ enum class DynamicRasterizationState: UnsignedByte {
     /**
      * Viewport range set in
      * @ref RasterizationPipelineCreateInfo::setViewport() is ignored and is
-     * expected to be set dynamically using @fn_vk{CmdSetViewport}. Viewport
-     * count is still set in @ref RasterizationPipelineCreateInfo, see
+     * expected to be set dynamically using @ref CommandBuffer::setViewport().
+     * Viewport count is still set in @ref RasterizationPipelineCreateInfo, see
      * @ref DynamicRasterizationState::ViewportWithCount for having both
      * dynamic.
      * @m_keywords{VK_DYNAMIC_STATE_VIEWPORT}
-     * @todoc link the multi-view API instead when exposed
      */
     Viewport,
 
     /**
      * Scissor rectangle set in
      * @ref RasterizationPipelineCreateInfo::setViewport() is ignored and is
-     * expected to be set dynamically using @fn_vk{CmdSetScissor}. Scissor
-     * count is still set in @ref RasterizationPipelineCreateInfo, see
+     * expected to be set dynamically using @ref CommandBuffer::setScissor().
+     * Scissor count is still set in @ref RasterizationPipelineCreateInfo, see
      * @ref DynamicRasterizationState::ScissorWithCount for having both
      * dynamic.
      * @m_keywords{VK_DYNAMIC_STATE_SCISSOR}
-     * @todoc link the multi-view API instead when exposed
      */
     Scissor,
 
     /**
      * Line width set in @ref RasterizationPipelineCreateInfo is ignored and is
-     * expected to be set dynamically using @fn_vk{CmdSetLineWidth}.
+     * expected to be set dynamically using @ref CommandBuffer::setLineWidth().
      * @requires_vk_feature @ref DeviceFeature::WideLines
      * @m_keywords{VK_DYNAMIC_STATE_LINE_WIDTH}
-     * @todoc link to the actual API when exposed
      */
     LineWidth,
 
     /**
      * Depth bias constant factor, depth bias clamp and depth bias slope factor
      * set in @ref RasterizationPipelineCreateInfo are ignored and expected to
-     * be set dynamically using @fn_vk{CmdSetDepthBias}.
+     * be set dynamically using @ref CommandBuffer::setDepthBias().
      * @m_keywords{VK_DYNAMIC_STATE_DEPTH_BIAS}
-     * @todoc link to the actual API when exposed
      */
     DepthBias,
 
     /**
      * Blend constants set in @ref RasterizationPipelineCreateInfo are ignored
-     * and expected to be set dynamically using @fn_vk{CmdSetBlendConstants}.
+     * and expected to be set dynamically using
+     * @ref CommandBuffer::setBlendConstants().
      * @m_keywords{VK_DYNAMIC_STATE_BLEND_CONSTANTS}
-     * @todoc link to the actual API when exposed
      */
     BlendConstants,
 
     /**
      * Min and max depth bounds set in @ref RasterizationPipelineCreateInfo are
      * ignored and expected to be set dynamically using
-     * @fn_vk{CmdSetDepthBounds}.
+     * @ref CommandBuffer::setDepthBounds().
      * @see @ref DynamicRasterizationState::DepthBoundsTestEnable
      * @requires_vk_feature @ref DeviceFeature::DepthBounds
      * @m_keywords{VK_DYNAMIC_STATE_DEPTH_BOUNDS}
-     * @todoc link to the actual API when exposed
      */
     DepthBounds,
 
     /**
      * Stencil compare mask set in @ref RasterizationPipelineCreateInfo is
      * ignored and expected to be set dynamically using
-     * @fn_vk{CmdSetStencilCompareMask}.
+     * @ref CommandBuffer::setStencilCompareMask().
      * @m_keywords{VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK}
-     * @todoc link to the actual API when exposed
      */
     StencilCompareMask,
 
     /**
      * Stencil write mask set in @ref RasterizationPipelineCreateInfo is
      * ignored and expected to be set dynamically using
-     * @fn_vk{CmdSetStencilWriteMask}.
+     * @ref CommandBuffer::setStencilWriteMask().
      * @m_keywords{VK_DYNAMIC_STATE_STENCIL_WRITE_MASK}
-     * @todoc link to the actual API when exposed
      */
     StencilWriteMask,
 
     /**
      * Stencil reference set in @ref RasterizationPipelineCreateInfo is ignored
-     * and expected to be set dynamically using @fn_vk{CmdSetStencilReference}.
+     * and expected to be set dynamically using
+     * @ref CommandBuffer::setStencilReference().
      * @m_keywords{VK_DYNAMIC_STATE_STENCIL_REFERENCE}
-     * @todoc link to the actual API when exposed
      */
     StencilReference,
 
     /**
      * Cull mode set in @ref RasterizationPipelineCreateInfo is ignored and
-     * expected to be set dynamically using @fn_vk{CmdSetCullModeEXT}.
+     * expected to be set dynamically using @ref CommandBuffer::setCullMode().
      * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
      * @m_keywords{VK_DYNAMIC_STATE_CULL_MODE_EXT}
-     * @todoc link to the actual API when exposed
      */
     CullMode,
 
     /**
      * Front face set in @ref RasterizationPipelineCreateInfo is ignored and
-     * expected to be set dynamically using @fn_vk{CmdSetFrontFaceEXT}.
+     * expected to be set dynamically using @ref CommandBuffer::setFrontFace().
      * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
      * @m_keywords{VK_DYNAMIC_STATE_FRONT_FACE_EXT}
-     * @todoc link to the actual API when exposed
      */
     FrontFace,
 
@@ -171,22 +162,20 @@ enum class DynamicRasterizationState: UnsignedByte {
     /**
      * Both the number of viewports and their ranges set in
      * @ref RasterizationPipelineCreateInfo::setViewport() are ignored and
-     * expected to be set dynamically using @fn_vk{CmdSetViewportWithCountEXT}.
+     * expected to be set dynamically using @ref CommandBuffer::setViewport().
      * A superset of @ref DynamicRasterizationState::Viewport.
      * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
      * @m_keywords{VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT_EXT}
-     * @todoc link the multi-view API instead when exposed
      */
     ViewportWithCount,
 
     /**
      * Both the number of scissors and their rectangles set in
      * @ref RasterizationPipelineCreateInfo::setViewport() are ignored and
-     * expected to be set dynamically using @fn_vk{CmdSetScissorWithCountEXT}.
+     * expected to be set dynamically using @ref CommandBuffer::setScissor().
      * A superset of @ref DynamicRasterizationState::Scissor.
      * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
      * @m_keywords{VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT_EXT}
-     * @todoc link the multi-view API instead when exposed
      */
     ScissorWithCount,
 
@@ -202,60 +191,56 @@ enum class DynamicRasterizationState: UnsignedByte {
 
     /**
      * Depth test enablement in @ref RasterizationPipelineCreateInfo is ignored
-     * and expected to be set dynamically using @fn_vk{CmdSetDepthTestEnableEXT}.
+     * and expected to be set dynamically using
+     * @ref CommandBuffer::setDepthTestEnabled().
      * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
      * @m_keywords{VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT}
-     * @todoc link to the actual API when exposed
      */
     DepthTestEnable,
 
     /**
      * Depth write enablement in @ref RasterizationPipelineCreateInfo is
      * ignored and expected to be set dynamically using
-     * @fn_vk{CmdSetDepthWriteEnableEXT}.
+     * @ref CommandBuffer::setDepthWriteEnabled().
      * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
      * @m_keywords{VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT}
-     * @todoc link to the actual API when exposed
      */
     DepthWriteEnable,
 
     /**
      * Depth compare operation in @ref RasterizationPipelineCreateInfo is
      * ignored and expected to be set dynamically using
-     * @fn_vk{CmdSetDepthCompareOpEXT}.
+     * @ref CommandBuffer::setDepthCompareOperation().
      * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
      * @m_keywords{VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT}
-     * @todoc link to the actual API when exposed
      */
     DepthCompareOperation,
 
     /**
      * Depth bounds test enablement in @ref RasterizationPipelineCreateInfo is
      * ignored and expected to be set dynamically using
-     * @fn_vk{CmdSetDepthBoundsTestEnableEXT}.
+     * @ref CommandBuffer::setDepthBoundsTestEnabled().
      * @requires_vk_feature @ref DeviceFeature::DepthBounds and
      *      @ref DeviceFeature::ExtendedDynamicState
      * @m_keywords{VK_DYNAMIC_STATE_DEPTH_BOUNDS_TEST_ENABLE_EXT}
-     * @todoc link to the actual API when exposed
      */
     DepthBoundsTestEnable,
 
     /**
      * Stencil test enablement in @ref RasterizationPipelineCreateInfo is
      * ignored and expected to be set dynamically using
-     * @fn_vk{CmdSetStencilTestEnableEXT}.
+     * @ref CommandBuffer::setStencilTestEnabled().
      * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
      * @m_keywords{VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE_EXT}
-     * @todoc link to the actual API when exposed
      */
     StencilTestEnable,
 
     /**
      * Stencil operation in @ref RasterizationPipelineCreateInfo is ignored and
-     * expected to be set dynamically using @fn_vk{CmdSetStencilOpEXT}.
+     * expected to be set dynamically using
+     * @ref CommandBuffer::setStencilOperation().
      * @requires_vk_feature @ref DeviceFeature::ExtendedDynamicState
      * @m_keywords{VK_DYNAMIC_STATE_STENCIL_OP_EXT}
-     * @todoc link to the actual API when exposed
      */
     StencilOperation,
 
@@ -287,6 +272,154 @@ MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, DynamicRasterizationState value
 */
 MAGNUM_VK_EXPORT Debug& operator<<(Debug& debug, const DynamicRasterizationStates& value);
 
+/**
+@brief Cull mode
+@m_since_latest
+
+Wraps @type_vk_keyword{CullModeFlagBits}.
+@see @ref CommandBuffer::setCullMode()
+@m_enum_values_as_keywords
+*/
+enum class CullMode: UnsignedInt {
+    /** No triangles are discarded */
+    None = VK_CULL_MODE_NONE,
+
+    /** Front-facing triangles are discarded */
+    Front = VK_CULL_MODE_FRONT_BIT,
+
+    /** Back-facing triangles are discarded */
+    Back = VK_CULL_MODE_BACK_BIT,
+
+    /** All triangles are discarded */
+    FrontAndBack = VK_CULL_MODE_FRONT_AND_BACK
+};
+
+/**
+@brief Front face orientation
+@m_since_latest
+
+Wraps @type_vk_keyword{FrontFace}.
+@see @ref CommandBuffer::setFrontFace()
+@m_enum_values_as_keywords
+*/
+enum class FrontFace: Int {
+    /** Triangles with counter-clockwise winding are front-facing */
+    CounterClockwise = VK_FRONT_FACE_COUNTER_CLOCKWISE,
+
+    /** Triangles with clockwise winding are front-facing */
+    Clockwise = VK_FRONT_FACE_CLOCKWISE
+};
+
+/**
+@brief Compare operation
+@m_since_latest
+
+Wraps @type_vk_keyword{CompareOp}.
+@see @ref CommandBuffer::setDepthCompareOperation(),
+    @ref CommandBuffer::setStencilOperation()
+@m_enum_values_as_keywords
+*/
+enum class CompareOperation: Int {
+    /** Never passes */
+    Never = VK_COMPARE_OP_NEVER,
+
+    /** Passes if the new value is less than the stored value */
+    Less = VK_COMPARE_OP_LESS,
+
+    /** Passes if the new value is equal to the stored value */
+    Equal = VK_COMPARE_OP_EQUAL,
+
+    /** Passes if the new value is less than or equal to the stored value */
+    LessOrEqual = VK_COMPARE_OP_LESS_OR_EQUAL,
+
+    /** Passes if the new value is greater than the stored value */
+    Greater = VK_COMPARE_OP_GREATER,
+
+    /** Passes if the new value is not equal to the stored value */
+    NotEqual = VK_COMPARE_OP_NOT_EQUAL,
+
+    /**
+     * Passes if the new value is greater than or equal to the stored value
+     */
+    GreaterOrEqual = VK_COMPARE_OP_GREATER_OR_EQUAL,
+
+    /** Always passes */
+    Always = VK_COMPARE_OP_ALWAYS
+};
+
+/**
+@brief Stencil operation
+@m_since_latest
+
+Wraps @type_vk_keyword{StencilOp}.
+@see @ref CommandBuffer::setStencilOperation()
+@m_enum_values_as_keywords
+*/
+enum class StencilOperation: Int {
+    /** Keep the current value */
+    Keep = VK_STENCIL_OP_KEEP,
+
+    /** Set the value to @cpp 0 @ce */
+    Zero = VK_STENCIL_OP_ZERO,
+
+    /** Set the value to the stencil reference */
+    Replace = VK_STENCIL_OP_REPLACE,
+
+    /** Increment the value and clamp to the maximum representable value */
+    IncrementAndClamp = VK_STENCIL_OP_INCREMENT_AND_CLAMP,
+
+    /** Decrement the value and clamp to @cpp 0 @ce */
+    DecrementAndClamp = VK_STENCIL_OP_DECREMENT_AND_CLAMP,
+
+    /** Bitwise invert the value */
+    Invert = VK_STENCIL_OP_INVERT,
+
+    /**
+     * Increment the value and wrap to @cpp 0 @ce when exceeding the
+     * maximum representable value
+     */
+    IncrementAndWrap = VK_STENCIL_OP_INCREMENT_AND_WRAP,
+
+    /**
+     * Decrement the value and wrap to the maximum representable value when
+     * going below @cpp 0 @ce
+     */
+    DecrementAndWrap = VK_STENCIL_OP_DECREMENT_AND_WRAP
+};
+
+/**
+@brief Stencil face
+@m_since_latest
+
+Wraps @type_vk_keyword{StencilFaceFlagBits}.
+@see @ref StencilFaces, @ref CommandBuffer::setStencilCompareMask(),
+    @ref CommandBuffer::setStencilWriteMask(),
+    @ref CommandBuffer::setStencilReference(),
+    @ref CommandBuffer::setStencilOperation()
+@m_enum_values_as_keywords
+*/
+enum class StencilFace: UnsignedInt {
+    /** Front face */
+    Front = VK_STENCIL_FACE_FRONT_BIT,
+
+    /** Back face */
+    Back = VK_STENCIL_FACE_BACK_BIT
+};
+
+/**
+@brief Stencil faces
+@m_since_latest
+
+Type-safe wrapper for @type_vk_keyword{StencilFaceFlags}.
+@see @ref CommandBuffer::setStencilCompareMask(),
+    @ref CommandBuffer::setStencilWriteMask(),
+    @ref CommandBuffer::setStencilReference(),
+    @ref CommandBuffer::setStencilOperation()
+*/
+typedef Containers::EnumSet<StencilFace> StencilFaces;
+
+CORRADE_ENUMSET_OPERATORS(StencilFaces)
+
 /**
 @brief Rasterization pipeline creation info
 @m_since_latest
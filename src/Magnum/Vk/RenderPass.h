@@ -389,9 +389,9 @@ enum class SubpassContents: Int {
 
     /**
      * Subpass contents are recorded in @ref CommandBufferLevel::Secondary
-     * command buffers that will be called from the primary command buffer.
-     * @todoc reference @fn_vk{CmdExecuteCommands} when exposed and mention
-     *      it's the only allowed command until nextsubpass / renderpass end
+     * command buffers that will be called from the primary command buffer
+     * using @ref CommandBuffer::executeCommands(), which is then the only
+     * command allowed until the next subpass or the end of the render pass.
      */
     SecondaryCommandBuffers = VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
 };
@@ -0,0 +1,229 @@
+#ifndef Magnum_Vk_Semaphore_h
+#define Magnum_Vk_Semaphore_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::Semaphore
+ * @m_since_latest
+ */
+
+#include <chrono>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/Handle.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/Vulkan.h"
+#include "Magnum/Vk/visibility.h"
+
+namespace Magnum { namespace Vk {
+
+namespace Implementation { struct DeviceState; }
+
+/**
+@brief Semaphore
+@m_since_latest
+
+Wraps a @type_vk_keyword{Semaphore}, which is used for synchronizing work
+between queue submissions, and in case of timeline semaphores also between the
+host and the device.
+
+@section Vk-Semaphore-creation Semaphore creation
+
+A binary semaphore doesn't need any extra parameters for construction and can
+be constructed directly using @ref Semaphore(Device&, const SemaphoreCreateInfo&),
+leaving the @p info parameter at its default. For a timeline semaphore, pass
+@ref SemaphoreType::Timeline and an initial value to @ref SemaphoreCreateInfo:
+
+@snippet Vk.cpp Semaphore-creation
+
+Timeline semaphores require Vulkan 1.2 or the
+@vk_extension{KHR,timeline_semaphore} extension, and the
+@ref DeviceFeature::TimelineSemaphore feature enabled on the device.
+
+@section Vk-Semaphore-usage Basic usage
+
+Semaphores are waited on and signaled by queue submissions through
+@ref SubmitInfo::setWaitSemaphores() and
+@ref SubmitInfo::setSignalSemaphores(). A binary semaphore gets signaled by a
+submission and unsignaled again by a submission waiting on it. A timeline
+semaphore instead carries a monotonically increasing value --- a submission
+waits until the value reaches given threshold and sets it to a new value once
+finished. That allows for example an async compute or transfer queue to feed
+a graphics queue without any CPU round trips:
+
+@snippet Vk.cpp Semaphore-usage
+
+Compared to binary semaphores, a timeline semaphore can be also queried from
+the host via @ref value(), signaled from the host via @ref signal() and waited
+on from the host via @ref wait(), which makes it possible to use it in place of
+a @ref Fence.
+*/
+class MAGNUM_VK_EXPORT Semaphore {
+    public:
+        /**
+         * @brief Wrap existing Vulkan handle
+         * @param device            Vulkan device the semaphore is created on
+         * @param handle            The @type_vk{Semaphore} handle
+         * @param flags             Handle flags
+         *
+         * The @p handle is expected to be originating from @p device. Unlike
+         * a semaphore created using a constructor, the Vulkan semaphore is by
+         * default not deleted on destruction, use @p flags for different
+         * behavior.
+         * @see @ref release()
+         */
+        static Semaphore wrap(Device& device, VkSemaphore handle, HandleFlags flags = {});
+
+        /**
+         * @brief Constructor
+         * @param device    Vulkan device to create the semaphore on
+         * @param info      Semaphore creation info
+         *
+         * If @p info describes a @ref SemaphoreType::Timeline semaphore,
+         * expects that the @ref DeviceFeature::TimelineSemaphore feature is
+         * enabled on @p device.
+         * @see @fn_vk_keyword{CreateSemaphore}
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        explicit Semaphore(Device& device, const SemaphoreCreateInfo& info = SemaphoreCreateInfo{});
+        #else
+        explicit Semaphore(Device& device, const SemaphoreCreateInfo& info);
+        explicit Semaphore(Device& device);
+        #endif
+
+        /**
+         * @brief Construct without creating the semaphore
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         */
+        explicit Semaphore(NoCreateT);
+
+        /** @brief Copying is not allowed */
+        Semaphore(const Semaphore&) = delete;
+
+        /** @brief Move constructor */
+        Semaphore(Semaphore&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys associated @type_vk{Semaphore} handle, unless the instance
+         * was created using @ref wrap() without
+         * @ref HandleFlag::DestroyOnDestruction specified.
+         * @see @fn_vk_keyword{DestroySemaphore}, @ref release()
+         */
+        ~Semaphore();
+
+        /** @brief Copying is not allowed */
+        Semaphore& operator=(const Semaphore&) = delete;
+
+        /** @brief Move assignment */
+        Semaphore& operator=(Semaphore&& other) noexcept;
+
+        /** @brief Underlying @type_vk{Semaphore} handle */
+        VkSemaphore handle() { return _handle; }
+        /** @overload */
+        operator VkSemaphore() { return _handle; }
+
+        /** @brief Handle flags */
+        HandleFlags handleFlags() const { return _flags; }
+
+        /**
+         * @brief Current timeline semaphore value
+         *
+         * Expects that the semaphore is a @ref SemaphoreType::Timeline one.
+         * @see @fn_vk_keyword{GetSemaphoreCounterValue},
+         *      @fn_vk_keyword{GetSemaphoreCounterValueKHR}
+         */
+        UnsignedLong value();
+
+        /**
+         * @brief Signal a timeline semaphore from the host
+         *
+         * Sets the value of the semaphore to @p value. Expects that the
+         * semaphore is a @ref SemaphoreType::Timeline one and @p value is
+         * larger than the current value.
+         * @see @fn_vk_keyword{SignalSemaphore},
+         *      @fn_vk_keyword{SignalSemaphoreKHR}
+         */
+        void signal(UnsignedLong value);
+
+        /**
+         * @brief Wait for a timeline semaphore to reach given value
+         *
+         * Blocks until the semaphore value becomes at least @p value or
+         * @p timeout is elapsed, whichever happens sooner, returning
+         * @cpp true @ce if the value was reached. If the value is already
+         * reached, the function returns immediately, if the timeout happens
+         * before, @cpp false @ce is returned. Expects that the semaphore is a
+         * @ref SemaphoreType::Timeline one.
+         * @see @fn_vk_keyword{WaitSemaphores},
+         *      @fn_vk_keyword{WaitSemaphoresKHR}
+         */
+        bool wait(UnsignedLong value, std::chrono::nanoseconds timeout);
+
+        /**
+         * @brief Wait indefinitely for a timeline semaphore to reach given value
+         *
+         * Equivalent to calling @ref wait(UnsignedLong, std::chrono::nanoseconds)
+         * with the largest representable 64-bit value.
+         */
+        void wait(UnsignedLong value);
+
+        /**
+         * @brief Release the underlying Vulkan semaphore
+         *
+         * Releases ownership of the Vulkan semaphore and returns its handle so
+         * @fn_vk{DestroySemaphore} is not called on destruction. The internal
+         * state is then equivalent to moved-from state.
+         * @see @ref wrap()
+         */
+        VkSemaphore release();
+
+    private:
+        friend Implementation::DeviceState;
+
+        MAGNUM_VK_LOCAL static VkResult getValueImplementationKHR(Device& device, VkSemaphore semaphore, UnsignedLong& value);
+        MAGNUM_VK_LOCAL static VkResult getValueImplementation12(Device& device, VkSemaphore semaphore, UnsignedLong& value);
+        MAGNUM_VK_LOCAL static VkResult signalImplementationKHR(Device& device, const VkSemaphoreSignalInfo& info);
+        MAGNUM_VK_LOCAL static VkResult signalImplementation12(Device& device, const VkSemaphoreSignalInfo& info);
+        MAGNUM_VK_LOCAL static VkResult waitImplementationKHR(Device& device, const VkSemaphoreWaitInfo& info, UnsignedLong timeout);
+        MAGNUM_VK_LOCAL static VkResult waitImplementation12(Device& device, const VkSemaphoreWaitInfo& info, UnsignedLong timeout);
+
+        /* Can't be a reference because of the NoCreate constructor */
+        Device* _device;
+
+        VkSemaphore _handle;
+        HandleFlags _flags;
+};
+
+}}
+
+#endif
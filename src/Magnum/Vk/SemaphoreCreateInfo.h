@@ -0,0 +1,152 @@
+#ifndef Magnum_Vk_SemaphoreCreateInfo_h
+#define Magnum_Vk_SemaphoreCreateInfo_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::SemaphoreCreateInfo, enum @ref Magnum::Vk::SemaphoreType
+ * @m_since_latest
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/visibility.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/Vulkan.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Semaphore type
+@m_since_latest
+
+Wraps @type_vk_keyword{SemaphoreType}.
+@see @ref SemaphoreCreateInfo::SemaphoreCreateInfo(SemaphoreType, UnsignedLong)
+@m_enum_values_as_keywords
+*/
+enum class SemaphoreType: Int {
+    /**
+     * Binary semaphore, having either a signaled or unsignaled state. The
+     * default.
+     */
+    Binary = VK_SEMAPHORE_TYPE_BINARY,
+
+    /**
+     * Timeline semaphore, having a monotonically increasing 64-bit payload.
+     *
+     * @requires_vk12 Extension @vk_extension{KHR,timeline_semaphore} and the
+     *      @ref DeviceFeature::TimelineSemaphore feature enabled
+     */
+    Timeline = VK_SEMAPHORE_TYPE_TIMELINE
+};
+
+/**
+@brief Semaphore creation info
+@m_since_latest
+
+Wraps a @type_vk_keyword{SemaphoreCreateInfo} and
+@type_vk_keyword{SemaphoreTypeCreateInfo}. See
+@ref Vk-Semaphore-creation "Semaphore creation" for usage information.
+*/
+class MAGNUM_VK_EXPORT SemaphoreCreateInfo {
+    public:
+        /**
+         * @brief Constructor
+         * @param type          Semaphore type
+         * @param initialValue  Initial value of a timeline semaphore. Expected
+         *      to be zero for a @ref SemaphoreType::Binary semaphore.
+         *
+         * The following @type_vk{SemaphoreCreateInfo} fields are pre-filled
+         * in addition to `sType`, everything else is zero-filled:
+         *
+         * -    *(none)*
+         *
+         * If @p type is @ref SemaphoreType::Timeline, the following
+         * @type_vk{SemaphoreTypeCreateInfo} fields are set in addition to
+         * `sType`, and the structure is referenced from the `pNext` chain
+         * of @type_vk{SemaphoreCreateInfo}:
+         *
+         * -    `semaphoreType`
+         * -    `initialValue`
+         *
+         * The @type_vk{SemaphoreTypeCreateInfo} structure isn't referenced
+         * for a @ref SemaphoreType::Binary semaphore, so it can be created
+         * on devices without @vk_extension{KHR,timeline_semaphore} support.
+         */
+        explicit SemaphoreCreateInfo(SemaphoreType type = SemaphoreType::Binary, UnsignedLong initialValue = 0);
+
+        /**
+         * @brief Construct without initializing the contents
+         *
+         * Note that not even the `sType` field is set --- the structure has to
+         * be fully initialized afterwards in order to be usable.
+         */
+        explicit SemaphoreCreateInfo(NoInitT) noexcept;
+
+        /**
+         * @brief Construct from existing data
+         *
+         * Copies the existing values verbatim, pointers are kept unchanged
+         * without taking over the ownership. Modifying the newly created
+         * instance will not modify the original data nor the pointed-to data.
+         */
+        explicit SemaphoreCreateInfo(const VkSemaphoreCreateInfo& info);
+
+        /**
+         * @brief Copy constructor
+         *
+         * If `pNext` points to the internal
+         * @type_vk{SemaphoreTypeCreateInfo} structure, it's redirected to
+         * the copy.
+         */
+        SemaphoreCreateInfo(const SemaphoreCreateInfo& other) noexcept;
+
+        /** @brief Copy assignment */
+        SemaphoreCreateInfo& operator=(const SemaphoreCreateInfo& other) noexcept;
+
+        /** @brief Underlying @type_vk{SemaphoreCreateInfo} structure */
+        VkSemaphoreCreateInfo& operator*() { return _info; }
+        /** @overload */
+        const VkSemaphoreCreateInfo& operator*() const { return _info; }
+        /** @overload */
+        VkSemaphoreCreateInfo* operator->() { return &_info; }
+        /** @overload */
+        const VkSemaphoreCreateInfo* operator->() const { return &_info; }
+        /** @overload */
+        operator const VkSemaphoreCreateInfo*() const { return &_info; }
+
+    private:
+        VkSemaphoreCreateInfo _info;
+        VkSemaphoreTypeCreateInfo _typeInfo;
+};
+
+}}
+
+/* Make the definition complete -- it doesn't make sense to have a CreateInfo
+   without the corresponding object anyway. */
+#include "Magnum/Vk/Semaphore.h"
+
+#endif
@@ -0,0 +1,326 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "StagingUploader.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Vk/BufferCreateInfo.h"
+#include "Magnum/Vk/CommandBuffer.h"
+#include "Magnum/Vk/CommandPoolCreateInfo.h"
+#include "Magnum/Vk/Device.h"
+#include "Magnum/Vk/Fence.h"
+#include "Magnum/Vk/Image.h"
+#include "Magnum/Vk/Memory.h"
+#include "Magnum/Vk/Pipeline.h"
+#include "Magnum/Vk/Queue.h"
+
+namespace Magnum { namespace Vk {
+
+namespace {
+
+/* Max count of batches in flight. If all are in flight, the oldest is waited
+   on before recording a new one. */
+constexpr std::size_t BatchCount = 4;
+
+struct Batch {
+    CommandBuffer commandBuffer{NoCreate};
+    Fence fence{NoCreate};
+    /* Ring position at which the batch data end */
+    UnsignedLong end{};
+};
+
+}
+
+struct StagingUploader::State {
+    explicit State(Device& device, Queue& queue, UnsignedInt queueFamilyIndex, UnsignedLong size);
+
+    Device& device;
+    Queue& queue;
+    CommandPool pool;
+    Buffer buffer;
+    Containers::Array<char, MemoryMapDeleter> mapped;
+    UnsignedLong size;
+
+    /* Monotonically increasing positions in the ring, the actual offset in
+       the staging buffer is the position modulo size. Data between tail and
+       head are used by batches that are either recorded or in flight. */
+    UnsignedLong head{}, tail{}, submittedEnd{};
+
+    Batch batches[BatchCount];
+    /* IDs of the last submitted and last completed batch, batch with ID n is
+       in slot (n - 1) % BatchCount */
+    UnsignedLong submitted{}, completed{};
+    bool recording{};
+};
+
+StagingUploader::State::State(Device& device, Queue& queue, const UnsignedInt queueFamilyIndex, const UnsignedLong size): device(device), queue(queue),
+    pool{device, CommandPoolCreateInfo{queueFamilyIndex,
+        CommandPoolCreateInfo::Flag::Transient|
+        CommandPoolCreateInfo::Flag::ResetCommandBuffer}},
+    buffer{device, BufferCreateInfo{BufferUsage::TransferSource, size},
+        MemoryFlag::HostVisible|MemoryFlag::HostCoherent},
+    mapped{buffer.dedicatedMemory().map()}, size{size} {}
+
+StagingUploader::StagingUploader(Device& device, Queue& queue, const UnsignedInt queueFamilyIndex, const UnsignedLong size) {
+    CORRADE_ASSERT(size,
+        "Vk::StagingUploader: expected non-zero staging buffer size", );
+    _state.emplace(device, queue, queueFamilyIndex, size);
+}
+
+StagingUploader::StagingUploader(NoCreateT) noexcept {}
+
+StagingUploader::StagingUploader(StagingUploader&&) noexcept = default;
+
+StagingUploader::~StagingUploader() {
+    /* The staging buffer and command buffers can't be destroyed while still
+       in use. Recorded but unsubmitted command buffers are freed together
+       with the pool. */
+    if(_state) while(_state->completed != _state->submitted)
+        retire(true);
+}
+
+StagingUploader& StagingUploader::operator=(StagingUploader&&) noexcept = default;
+
+Device& StagingUploader::device() {
+    return _state->device;
+}
+
+UnsignedLong StagingUploader::size() const {
+    return _state ? _state->size : 0;
+}
+
+UnsignedLong StagingUploader::pendingSize() const {
+    return _state ? _state->head - _state->submittedEnd : 0;
+}
+
+UnsignedLong StagingUploader::allocate(const UnsignedLong size, const UnsignedLong alignment) {
+    State& state = *_state;
+    CORRADE_INTERNAL_ASSERT(size && size <= state.size);
+
+    for(;;) {
+        /* If nothing is in use, start from the beginning of the buffer so the
+           whole size is available without having to wrap around */
+        if(state.head == state.tail)
+            state.head = state.tail = state.submittedEnd = 0;
+
+        /* Align the offset, if the data wouldn't fit before the end of the
+           buffer, wrap around to the beginning */
+        UnsignedLong position = state.head;
+        const UnsignedLong offset = position % state.size;
+        UnsignedLong alignedOffset = (offset + alignment - 1)/alignment*alignment;
+        if(alignedOffset + size > state.size) {
+            position += state.size - offset;
+            alignedOffset = 0;
+        } else position += alignedOffset - offset;
+
+        if(position + size - state.tail <= state.size) {
+            state.head = position + size;
+            return alignedOffset;
+        }
+
+        /* Not enough space, free up the oldest batch. If nothing is in
+           flight, the space is used by what's recorded so far, so submit
+           it. */
+        if(state.completed == state.submitted) submit();
+        retire(true);
+    }
+}
+
+CommandBuffer& StagingUploader::commandBuffer() {
+    State& state = *_state;
+    Batch& batch = state.batches[state.submitted % BatchCount];
+    if(state.recording) return batch.commandBuffer;
+
+    /* If the slot is still in flight, wait for it */
+    if(state.submitted - state.completed == BatchCount) retire(true);
+
+    if(!batch.commandBuffer.handle()) {
+        batch.commandBuffer = state.pool.allocate();
+        batch.fence = Fence{state.device};
+    }
+
+    batch.commandBuffer.begin(CommandBufferBeginInfo{CommandBufferBeginInfo::Flag::OneTimeSubmit});
+    state.recording = true;
+    return batch.commandBuffer;
+}
+
+bool StagingUploader::retire(const bool wait) {
+    State& state = *_state;
+    CORRADE_INTERNAL_ASSERT(state.completed < state.submitted);
+
+    Batch& batch = state.batches[state.completed % BatchCount];
+    if(wait) batch.fence.wait();
+    else if(!batch.fence.status()) return false;
+
+    /* Reset the fence for next use of the slot */
+    batch.fence.reset();
+    state.tail = batch.end;
+    ++state.completed;
+    return true;
+}
+
+StagingUploader& StagingUploader::upload(Buffer& buffer, UnsignedLong offset, const Containers::ArrayView<const void> data) {
+    /* Split the data into chunks if they don't fit into the staging buffer */
+    const char* in = static_cast<const char*>(data.data());
+    UnsignedLong size = data.size();
+    while(size) {
+        const UnsignedLong chunkSize = Math::min(size, _state->size);
+        /* vkCmdCopyBuffer() has no alignment requirements, but align to 4
+           bytes to avoid slow paths in some drivers */
+        const UnsignedLong stagingOffset = allocate(chunkSize, 4);
+        Utility::copy(Containers::arrayView(in, chunkSize), _state->mapped.slice(stagingOffset, stagingOffset + chunkSize));
+        commandBuffer().copyBuffer({_state->buffer, buffer, {
+            {stagingOffset, offset, chunkSize}
+        }});
+
+        in += chunkSize;
+        offset += chunkSize;
+        size -= chunkSize;
+    }
+
+    return *this;
+}
+
+Containers::ArrayView<char> StagingUploader::uploadImageInternal(Image& image, const Int level, const Vector3i& size, const UnsignedInt pixelSize, const ImageLayout layout) {
+    const UnsignedLong dataSize = UnsignedLong(size.product())*pixelSize;
+    CORRADE_ASSERT(dataSize <= _state->size,
+        "Vk::StagingUploader::upload(): image of" << dataSize << "bytes doesn't fit into a staging buffer of" << _state->size << "bytes", {});
+    const ImageAspects aspects = imageAspectsFor(image.format());
+    CORRADE_ASSERT(aspects == ImageAspect::Color || aspects == ImageAspect::Depth || aspects == ImageAspect::Stencil,
+        "Vk::StagingUploader::upload(): combined depth/stencil images are not supported", {});
+    if(!dataSize) return {};
+
+    /* The buffer offset has to be a multiple of the texel size and 4 */
+    const UnsignedLong alignment = pixelSize % 4 == 0 ? pixelSize :
+        pixelSize % 2 == 0 ? pixelSize*2 : pixelSize*4;
+    const UnsignedLong offset = allocate(dataSize, alignment);
+
+    /* Transition just the uploaded level, others may contain data uploaded
+       earlier */
+    commandBuffer()
+        .pipelineBarrier(PipelineStage::TopOfPipe, PipelineStage::Transfer, {
+            {{}, Access::TransferWrite,
+             ImageLayout::Undefined, ImageLayout::TransferDestination,
+             image, 0, 1, UnsignedInt(level), 1}
+        })
+        .copyBufferToImage({_state->buffer, image, ImageLayout::TransferDestination, {
+            BufferImageCopy{offset, 0, 0, ImageAspect(UnsignedInt(aspects)), level, 0, 1, {{}, size}}
+        }})
+        /* Consumers are expected to wait on the fence, which makes the
+           writes visible, so no destination access is needed */
+        .pipelineBarrier(PipelineStage::Transfer, PipelineStage::BottomOfPipe, {
+            {Access::TransferWrite, {},
+             ImageLayout::TransferDestination, layout,
+             image, 0, 1, UnsignedInt(level), 1}
+        });
+
+    return _state->mapped.slice(offset, offset + dataSize);
+}
+
+StagingUploader& StagingUploader::upload(Image& image, const Int level, const ImageView1D& data, const ImageLayout layout) {
+    const Containers::ArrayView<char> out = uploadImageInternal(image, level, {data.size(), 1, 1}, data.pixelSize(), layout);
+    /* Empty image or a graceful assert */
+    if(out.isEmpty()) return *this;
+
+    Utility::copy(data.pixels(), Containers::StridedArrayView2D<char>{out, {
+        std::size_t(data.size()),
+        data.pixelSize()}});
+    return *this;
+}
+
+StagingUploader& StagingUploader::upload(Image& image, const Int level, const ImageView1D& data) {
+    return upload(image, level, data, ImageLayout::ShaderReadOnly);
+}
+
+StagingUploader& StagingUploader::upload(Image& image, const Int level, const ImageView2D& data, const ImageLayout layout) {
+    const Containers::ArrayView<char> out = uploadImageInternal(image, level, {data.size(), 1}, data.pixelSize(), layout);
+    /* Empty image or a graceful assert */
+    if(out.isEmpty()) return *this;
+
+    Utility::copy(data.pixels(), Containers::StridedArrayView3D<char>{out, {
+        std::size_t(data.size().y()),
+        std::size_t(data.size().x()),
+        data.pixelSize()}});
+    return *this;
+}
+
+StagingUploader& StagingUploader::upload(Image& image, const Int level, const ImageView2D& data) {
+    return upload(image, level, data, ImageLayout::ShaderReadOnly);
+}
+
+StagingUploader& StagingUploader::upload(Image& image, const Int level, const ImageView3D& data, const ImageLayout layout) {
+    const Containers::ArrayView<char> out = uploadImageInternal(image, level, data.size(), data.pixelSize(), layout);
+    /* Empty image or a graceful assert */
+    if(out.isEmpty()) return *this;
+
+    Utility::copy(data.pixels(), Containers::StridedArrayView4D<char>{out, {
+        std::size_t(data.size().z()),
+        std::size_t(data.size().y()),
+        std::size_t(data.size().x()),
+        data.pixelSize()}});
+    return *this;
+}
+
+StagingUploader& StagingUploader::upload(Image& image, const Int level, const ImageView3D& data) {
+    return upload(image, level, data, ImageLayout::ShaderReadOnly);
+}
+
+UnsignedLong StagingUploader::submit() {
+    State& state = *_state;
+    if(!state.recording) return state.submitted;
+
+    Batch& batch = state.batches[state.submitted % BatchCount];
+    batch.commandBuffer.end();
+    state.queue.submit({SubmitInfo{}.setCommandBuffers({batch.commandBuffer})}, batch.fence);
+    batch.end = state.head;
+    state.submittedEnd = state.head;
+    state.recording = false;
+    return ++state.submitted;
+}
+
+bool StagingUploader::isComplete(const UnsignedLong id) {
+    CORRADE_ASSERT(id <= _state->submitted,
+        "Vk::StagingUploader::isComplete(): batch" << id << "not submitted yet, last submitted is" << _state->submitted, {});
+    while(_state->completed < id && retire(false));
+    return _state->completed >= id;
+}
+
+void StagingUploader::wait(const UnsignedLong id) {
+    CORRADE_ASSERT(id <= _state->submitted,
+        "Vk::StagingUploader::wait(): batch" << id << "not submitted yet, last submitted is" << _state->submitted, );
+    while(_state->completed < id) retire(true);
+}
+
+void StagingUploader::finish() {
+    wait(submit());
+}
+
+}}
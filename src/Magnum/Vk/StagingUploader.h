@@ -0,0 +1,262 @@
+#ifndef Magnum_Vk_StagingUploader_h
+#define Magnum_Vk_StagingUploader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Vk::StagingUploader
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Tags.h"
+#include "Magnum/Vk/Vk.h"
+#include "Magnum/Vk/Vulkan.h"
+#include "Magnum/Vk/visibility.h"
+
+namespace Magnum { namespace Vk {
+
+/**
+@brief Staging uploader
+@m_since_latest
+
+Uploads data to device-local @ref Buffer and @ref Image memory through a
+host-visible staging buffer, which is otherwise a matter of hand-written
+staging buffer management, @ref CommandBuffer::copyBuffer() /
+@ref CommandBuffer::copyBufferToImage() calls, image layout transitions and
+@ref Fence synchronization.
+
+@section Vk-StagingUploader-creation Staging uploader creation
+
+The uploader is created on a @ref Queue, together with its family index, and a
+staging buffer size. The queue can be the same one that's used for rendering,
+but it's also possible to use a dedicated transfer queue and upload data in
+parallel to rendering:
+
+@snippet Vk.cpp StagingUploader-creation
+
+@section Vk-StagingUploader-usage Uploading data
+
+Each @ref upload() copies the data into the staging buffer and records a copy
+command into a command buffer. Uploads are batched until @ref submit() is
+called, which submits the commands to the queue and returns an ID that can be
+subsequently used to query the batch completion using @ref isComplete() or
+wait for it with @ref wait(). A batch can contain an arbitrary number of
+uploads of arbitrary sizes. Once the data of a batch are copied, its staging
+buffer space is reused for subsequent uploads.
+
+@snippet Vk.cpp StagingUploader-usage
+
+The staging buffer is used as a ring buffer. If there's not enough space for
+an upload, the uploader implicitly submits what's recorded so far and waits
+until enough earlier batches complete. Buffer uploads larger than the whole
+staging buffer are split into multiple copies, image uploads are expected to
+fit into the staging buffer.
+
+@subsection Vk-StagingUploader-usage-images Image uploads
+
+Image uploads always cover a whole mip level, which is expected to be not
+uploaded yet --- the level is transitioned from @ref ImageLayout::Undefined to
+@ref ImageLayout::TransferDestination for the copy, discarding any previous
+contents, and then to a layout passed to @ref upload(), which is
+@ref ImageLayout::ShaderReadOnly by default. Pixel data are repacked to match
+the image size, so any @ref PixelStorage parameters of the source image are
+taken into account. Compressed images are not supported at the moment.
+
+@subsection Vk-StagingUploader-usage-synchronization Synchronization
+
+The uploaded data can be used once the batch @ref isComplete() or after
+@ref wait() returns. If the uploader queue is from a different family than the
+queue consuming the data, the resources need to be either created with
+@val_vk{SHARING_MODE_CONCURRENT,SharingMode} or the consuming queue is
+responsible for performing a queue family ownership transfer, as the uploader
+doesn't do any queue family release operations.
+*/
+class MAGNUM_VK_EXPORT StagingUploader {
+    public:
+        /**
+         * @brief Constructor
+         * @param device            Vulkan device
+         * @param queue             Queue to submit the copy commands to
+         * @param queueFamilyIndex  Family index of @p queue
+         * @param size              Staging buffer size
+         *
+         * Allocates a @ref MemoryFlag::HostVisible and
+         * @ref MemoryFlag::HostCoherent staging buffer of @p size bytes,
+         * which stays persistently mapped for the whole uploader lifetime,
+         * and creates a @ref CommandPool for @p queueFamilyIndex. Expects
+         * that @p size is non-zero.
+         */
+        explicit StagingUploader(Device& device, Queue& queue, UnsignedInt queueFamilyIndex, UnsignedLong size = 16*1024*1024);
+
+        /**
+         * @brief Construct without creating the uploader
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         */
+        explicit StagingUploader(NoCreateT) noexcept;
+
+        /** @brief Copying is not allowed */
+        StagingUploader(const StagingUploader&) = delete;
+
+        /** @brief Move constructor */
+        StagingUploader(StagingUploader&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for all submitted batches to complete. Uploads that were
+         * recorded but not submitted are discarded.
+         */
+        ~StagingUploader();
+
+        /** @brief Copying is not allowed */
+        StagingUploader& operator=(const StagingUploader&) = delete;
+
+        /** @brief Move assignment */
+        StagingUploader& operator=(StagingUploader&&) noexcept;
+
+        /** @brief Device the uploader is created on */
+        Device& device();
+
+        /** @brief Staging buffer size */
+        UnsignedLong size() const;
+
+        /**
+         * @brief Upload data to a buffer
+         * @param buffer    Destination buffer
+         * @param offset    Offset in the destination buffer
+         * @param data      Data to upload
+         * @return Reference to self (for method chaining)
+         *
+         * The @p buffer is expected to be created with
+         * @ref BufferUsage::TransferDestination and to be large enough. The
+         * data are copied to the staging buffer right away, so @p data don't
+         * need to stay in scope after the function returns; @p buffer however
+         * has to stay alive until the batch containing the copy completes.
+         * @see @ref submit()
+         */
+        StagingUploader& upload(Buffer& buffer, UnsignedLong offset, Containers::ArrayView<const void> data);
+
+        /**
+         * @brief Upload a whole 1D image level
+         * @param image     Destination image
+         * @param level     Mip level
+         * @param data      Pixel data
+         * @param layout    Layout to transition the level to after the copy
+         * @return Reference to self (for method chaining)
+         *
+         * The @p image is expected to be created with
+         * @ref ImageUsage::TransferDestination and the @p data size to match
+         * size of given @p level. The pixel data are expected to fit into the
+         * staging buffer. See @ref Vk-StagingUploader-usage-images for more
+         * information.
+         */
+        StagingUploader& upload(Image& image, Int level, const ImageView1D& data, ImageLayout layout);
+        StagingUploader& upload(Image& image, Int level, const ImageView1D& data); /**< @overload */
+
+        /**
+         * @brief Upload a whole 2D image level
+         *
+         * See @ref upload(Image&, Int, const ImageView1D&, ImageLayout) for
+         * more information.
+         */
+        StagingUploader& upload(Image& image, Int level, const ImageView2D& data, ImageLayout layout);
+        StagingUploader& upload(Image& image, Int level, const ImageView2D& data); /**< @overload */
+
+        /**
+         * @brief Upload a whole 3D image level
+         *
+         * See @ref upload(Image&, Int, const ImageView1D&, ImageLayout) for
+         * more information.
+         */
+        StagingUploader& upload(Image& image, Int level, const ImageView3D& data, ImageLayout layout);
+        StagingUploader& upload(Image& image, Int level, const ImageView3D& data); /**< @overload */
+
+        /**
+         * @brief Size of data recorded but not submitted yet
+         *
+         * Including any padding needed to satisfy alignment requirements.
+         * @see @ref submit()
+         */
+        UnsignedLong pendingSize() const;
+
+        /**
+         * @brief Submit recorded uploads
+         * @return ID of the submitted batch
+         *
+         * Ends the command buffer recorded by previous @ref upload() calls and
+         * submits it to the queue. If nothing was recorded since the last
+         * submit, returns ID of the last submitted batch, or @cpp 0 @ce if
+         * nothing was submitted yet. The @cpp 0 @ce ID is always treated as
+         * complete.
+         * @see @ref isComplete(), @ref wait(), @ref finish()
+         */
+        UnsignedLong submit();
+
+        /**
+         * @brief Whether given batch completed
+         *
+         * Expects that @p id is not larger than the last ID returned by
+         * @ref submit(). Batches are completed in the order they were
+         * submitted in.
+         */
+        bool isComplete(UnsignedLong id);
+
+        /**
+         * @brief Wait for given batch to complete
+         *
+         * Expects that @p id is not larger than the last ID returned by
+         * @ref submit().
+         * @see @ref finish()
+         */
+        void wait(UnsignedLong id);
+
+        /**
+         * @brief Submit recorded uploads and wait for all batches to complete
+         *
+         * Equivalent to calling @ref wait() with the result of @ref submit().
+         */
+        void finish();
+
+    private:
+        struct State;
+
+        MAGNUM_VK_LOCAL UnsignedLong allocate(UnsignedLong size, UnsignedLong alignment);
+        MAGNUM_VK_LOCAL CommandBuffer& commandBuffer();
+        MAGNUM_VK_LOCAL bool retire(bool wait);
+        MAGNUM_VK_LOCAL Containers::ArrayView<char> uploadImageInternal(Image& image, Int level, const Vector3i& size, UnsignedInt pixelSize, ImageLayout layout);
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
@@ -45,6 +45,8 @@ struct BufferTest: TestSuite::Tester {
     void constructCopy();
 
     void dedicatedMemoryNotDedicated();
+    void allocationNotFromAllocator();
+    void bindAllocationEmpty();
 
     /* While *ConstructFromVk() tests that going from VkFromThing -> Vk::Thing
        -> VkToThing doesn't result in information loss, the *ConvertToVk()
@@ -73,6 +75,8 @@ BufferTest::BufferTest() {
               &BufferTest::constructCopy,
 
               &BufferTest::dedicatedMemoryNotDedicated,
+              &BufferTest::allocationNotFromAllocator,
+              &BufferTest::bindAllocationEmpty,
 
               &BufferTest::bufferCopyConstruct,
               &BufferTest::bufferCopyConstructNoInit,
@@ -162,6 +166,29 @@ void BufferTest::dedicatedMemoryNotDedicated() {
     CORRADE_COMPARE(out.str(), "Vk::Buffer::dedicatedMemory(): buffer doesn't have a dedicated memory\n");
 }
 
+void BufferTest::allocationNotFromAllocator() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Buffer buffer{NoCreate};
+    CORRADE_VERIFY(!buffer.hasAllocation());
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    buffer.allocation();
+    CORRADE_COMPARE(out.str(), "Vk::Buffer::allocation(): buffer doesn't have memory from an allocator\n");
+}
+
+void BufferTest::bindAllocationEmpty() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Buffer buffer{NoCreate};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    buffer.bindAllocation(MemoryAllocation{NoCreate});
+    CORRADE_COMPARE(out.str(), "Vk::Buffer::bindAllocation(): the allocation is empty\n");
+}
+
 void BufferTest::bufferCopyConstruct() {
     BufferCopy copy{3, 5, 7};
     CORRADE_COMPARE(copy->srcOffset, 3);
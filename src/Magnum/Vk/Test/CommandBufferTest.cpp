@@ -35,8 +35,10 @@ struct CommandBufferTest: TestSuite::Tester {
     explicit CommandBufferTest();
 
     void beginInfoConstruct();
+    void beginInfoConstructRenderPass();
     void beginInfoConstructNoInit();
     void beginInfoConstructFromVk();
+    void beginInfoConstructCopy();
 
     void constructNoCreate();
     void constructCopy();
@@ -44,8 +46,10 @@ struct CommandBufferTest: TestSuite::Tester {
 
 CommandBufferTest::CommandBufferTest() {
     addTests({&CommandBufferTest::beginInfoConstruct,
+              &CommandBufferTest::beginInfoConstructRenderPass,
               &CommandBufferTest::beginInfoConstructNoInit,
               &CommandBufferTest::beginInfoConstructFromVk,
+              &CommandBufferTest::beginInfoConstructCopy,
 
               &CommandBufferTest::constructNoCreate,
               &CommandBufferTest::constructCopy});
@@ -54,6 +58,24 @@ CommandBufferTest::CommandBufferTest() {
 void CommandBufferTest::beginInfoConstruct() {
     CommandBufferBeginInfo info{CommandBufferBeginInfo::Flag::OneTimeSubmit};
     CORRADE_COMPARE(info->flags, VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+    /* The inheritance info is always present so secondary command buffers can
+       be used outside of a render pass */
+    CORRADE_VERIFY(info->pInheritanceInfo);
+    CORRADE_COMPARE(info->pInheritanceInfo->sType, VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO);
+    CORRADE_VERIFY(!info->pInheritanceInfo->renderPass);
+}
+
+void CommandBufferTest::beginInfoConstructRenderPass() {
+    auto renderPass = reinterpret_cast<VkRenderPass>(reinterpret_cast<void*>(0xdeadbeef));
+    auto framebuffer = reinterpret_cast<VkFramebuffer>(reinterpret_cast<void*>(0xcafebabe));
+
+    CommandBufferBeginInfo info{renderPass, 3, framebuffer, CommandBufferBeginInfo::Flag::OneTimeSubmit};
+    CORRADE_COMPARE(info->flags, VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT|VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT);
+    CORRADE_VERIFY(info->pInheritanceInfo);
+    CORRADE_COMPARE(info->pInheritanceInfo->sType, VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO);
+    CORRADE_COMPARE(info->pInheritanceInfo->renderPass, renderPass);
+    CORRADE_COMPARE(info->pInheritanceInfo->subpass, 3);
+    CORRADE_COMPARE(info->pInheritanceInfo->framebuffer, framebuffer);
 }
 
 void CommandBufferTest::beginInfoConstructNoInit() {
@@ -76,6 +98,33 @@ void CommandBufferTest::beginInfoConstructFromVk() {
     CORRADE_COMPARE(info->sType, VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2);
 }
 
+void CommandBufferTest::beginInfoConstructCopy() {
+    auto renderPass = reinterpret_cast<VkRenderPass>(reinterpret_cast<void*>(0xdeadbeef));
+
+    CommandBufferBeginInfo a{renderPass, 3};
+    CommandBufferBeginInfo b = a;
+    /* The inheritance info pointer should be redirected to the copy */
+    CORRADE_VERIFY(b->pInheritanceInfo);
+    CORRADE_VERIFY(b->pInheritanceInfo != a->pInheritanceInfo);
+    CORRADE_COMPARE(b->pInheritanceInfo->renderPass, renderPass);
+    CORRADE_COMPARE(b->pInheritanceInfo->subpass, 3);
+
+    CommandBufferBeginInfo c;
+    c = a;
+    CORRADE_VERIFY(c->pInheritanceInfo);
+    CORRADE_VERIFY(c->pInheritanceInfo != a->pInheritanceInfo);
+    CORRADE_COMPARE(c->pInheritanceInfo->renderPass, renderPass);
+    CORRADE_COMPARE(c->pInheritanceInfo->subpass, 3);
+
+    /* External pointers are kept as-is */
+    VkCommandBufferInheritanceInfo inheritanceInfo{};
+    VkCommandBufferBeginInfo vkInfo{};
+    vkInfo.pInheritanceInfo = &inheritanceInfo;
+    CommandBufferBeginInfo d{vkInfo};
+    CommandBufferBeginInfo e = d;
+    CORRADE_COMPARE(e->pInheritanceInfo, &inheritanceInfo);
+}
+
 void CommandBufferTest::constructNoCreate() {
     {
         CommandBuffer buffer{NoCreate};
@@ -0,0 +1,253 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Vk/DescriptorAllocator.h"
+#include "Magnum/Vk/DescriptorSetLayoutCreateInfo.h"
+#include "Magnum/Vk/DescriptorType.h"
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/VulkanTester.h"
+
+namespace Magnum { namespace Vk { namespace Test { namespace {
+
+struct DescriptorAllocatorVkTest: VulkanTester {
+    explicit DescriptorAllocatorVkTest();
+
+    void construct();
+    void constructInvalid();
+    void constructMove();
+
+    void allocate();
+    void allocateGrow();
+    void allocateTooLarge();
+    void allocateCached();
+
+    void reset();
+};
+
+DescriptorAllocatorVkTest::DescriptorAllocatorVkTest() {
+    addTests({&DescriptorAllocatorVkTest::construct,
+              &DescriptorAllocatorVkTest::constructInvalid,
+              &DescriptorAllocatorVkTest::constructMove,
+
+              &DescriptorAllocatorVkTest::allocate,
+              &DescriptorAllocatorVkTest::allocateGrow,
+              &DescriptorAllocatorVkTest::allocateTooLarge,
+              &DescriptorAllocatorVkTest::allocateCached,
+
+              &DescriptorAllocatorVkTest::reset});
+}
+
+void DescriptorAllocatorVkTest::construct() {
+    {
+        DescriptorAllocator allocator{device(), 5, {
+            {DescriptorType::UniformBuffer, 2}
+        }};
+        CORRADE_COMPARE(allocator.setsPerPool(), 5);
+        /* No pools are created upfront */
+        CORRADE_COMPARE(allocator.poolCount(), 0);
+        CORRADE_COMPARE(allocator.cachedSetCount(), 0);
+    }
+
+    /* Shouldn't crash or anything */
+    CORRADE_VERIFY(true);
+}
+
+void DescriptorAllocatorVkTest::constructInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    DescriptorAllocator{device(), 0, {
+        {DescriptorType::UniformBuffer, 2}
+    }};
+    DescriptorAllocator{device(), 5, {}};
+    DescriptorAllocator{device(), 5, {
+        {DescriptorType::UniformBuffer, 2}
+    }, DescriptorPoolCreateInfo::Flag::FreeDescriptorSet};
+    CORRADE_COMPARE(out.str(),
+        "Vk::DescriptorAllocator: there has to be at least one set per pool\n"
+        "Vk::DescriptorAllocator: there has to be at least one pool size\n"
+        "Vk::DescriptorAllocator: freeing individual descriptor sets isn't supported\n");
+}
+
+void DescriptorAllocatorVkTest::constructMove() {
+    DescriptorSetLayout layout{device(), DescriptorSetLayoutCreateInfo{
+        {{0, DescriptorType::UniformBuffer}}
+    }};
+
+    DescriptorAllocator a{device(), 5, {
+        {DescriptorType::UniformBuffer, 5}
+    }};
+    a.allocate(layout);
+    CORRADE_COMPARE(a.poolCount(), 1);
+
+    DescriptorAllocator b = Utility::move(a);
+    CORRADE_COMPARE(a.poolCount(), 0);
+    CORRADE_COMPARE(b.poolCount(), 1);
+    CORRADE_COMPARE(b.setsPerPool(), 5);
+
+    DescriptorAllocator c{NoCreate};
+    c = Utility::move(b);
+    CORRADE_COMPARE(b.poolCount(), 0);
+    CORRADE_COMPARE(c.poolCount(), 1);
+    CORRADE_COMPARE(c.setsPerPool(), 5);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<DescriptorAllocator>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<DescriptorAllocator>::value);
+}
+
+void DescriptorAllocatorVkTest::allocate() {
+    DescriptorSetLayout layout{device(), DescriptorSetLayoutCreateInfo{
+        {{0, DescriptorType::UniformBuffer}}
+    }};
+
+    DescriptorAllocator allocator{device(), 5, {
+        {DescriptorType::UniformBuffer, 5}
+    }};
+
+    DescriptorSet a = allocator.allocate(layout);
+    DescriptorSet b = allocator.allocate(layout);
+    CORRADE_VERIFY(a.handle());
+    CORRADE_VERIFY(b.handle());
+    CORRADE_VERIFY(a.handle() != b.handle());
+    /* No DestroyOnDestruction, the sets get freed only on reset */
+    CORRADE_COMPARE(a.handleFlags(), HandleFlags{});
+    CORRADE_COMPARE(b.handleFlags(), HandleFlags{});
+    CORRADE_COMPARE(allocator.poolCount(), 1);
+}
+
+void DescriptorAllocatorVkTest::allocateGrow() {
+    DescriptorSetLayout layout{device(), DescriptorSetLayoutCreateInfo{
+        {{0, DescriptorType::UniformBuffer}}
+    }};
+
+    /* Two sets at most in each pool */
+    DescriptorAllocator allocator{device(), 2, {
+        {DescriptorType::UniformBuffer, 2}
+    }};
+
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_VERIFY(allocator.allocate(layout).handle());
+
+    {
+        CORRADE_EXPECT_FAIL_IF(device().properties().name().contains("llvmpipe"),
+            "Mesa llvmpipe never fails an allocation.");
+        CORRADE_EXPECT_FAIL_IF(device().properties().name().contains("NVIDIA"),
+            "NVidia never fails an allocation.");
+        CORRADE_COMPARE(allocator.poolCount(), 3);
+    }
+}
+
+void DescriptorAllocatorVkTest::allocateTooLarge() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    if(device().properties().name().contains("llvmpipe") ||
+       device().properties().name().contains("NVIDIA"))
+        CORRADE_SKIP("The driver never fails an allocation, can't test.");
+
+    DescriptorSetLayout layout{device(), DescriptorSetLayoutCreateInfo{
+        {{0, DescriptorType::UniformBuffer, 64}}
+    }};
+
+    DescriptorAllocator allocator{device(), 2, {
+        {DescriptorType::UniformBuffer, 1}
+    }};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    allocator.allocate(layout);
+    CORRADE_COMPARE(out.str(), "Vk::DescriptorAllocator::allocate(): allocation failed on an empty pool, the pool sizes are too small for the layout\n");
+}
+
+void DescriptorAllocatorVkTest::allocateCached() {
+    DescriptorSetLayout layout{device(), DescriptorSetLayoutCreateInfo{
+        {{0, DescriptorType::UniformBuffer}}
+    }};
+    DescriptorSetLayout layout2{device(), DescriptorSetLayoutCreateInfo{
+        {{1, DescriptorType::UniformBuffer}}
+    }};
+
+    DescriptorAllocator allocator{device(), 5, {
+        {DescriptorType::UniformBuffer, 5}
+    }};
+
+    Containers::Pair<DescriptorSet, bool> a = allocator.allocateCached(layout, {0xcafe, 16});
+    CORRADE_VERIFY(a.first().handle());
+    CORRADE_VERIFY(a.second());
+    CORRADE_COMPARE(allocator.cachedSetCount(), 1);
+
+    /* Same layout and key gives back the same set, not needing an update */
+    Containers::Pair<DescriptorSet, bool> b = allocator.allocateCached(layout, {0xcafe, 16});
+    CORRADE_COMPARE(b.first().handle(), a.first().handle());
+    CORRADE_VERIFY(!b.second());
+    CORRADE_COMPARE(allocator.cachedSetCount(), 1);
+
+    /* Different key or different layout gives a new one */
+    Containers::Pair<DescriptorSet, bool> c = allocator.allocateCached(layout, {0xcafe, 32});
+    CORRADE_VERIFY(c.first().handle() != a.first().handle());
+    CORRADE_VERIFY(c.second());
+    Containers::Pair<DescriptorSet, bool> d = allocator.allocateCached(layout2, {0xcafe, 16});
+    CORRADE_VERIFY(d.first().handle() != a.first().handle());
+    CORRADE_VERIFY(d.first().handle() != c.first().handle());
+    CORRADE_VERIFY(d.second());
+    CORRADE_COMPARE(allocator.cachedSetCount(), 3);
+
+    /* Reset clears the cache */
+    allocator.reset();
+    CORRADE_COMPARE(allocator.cachedSetCount(), 0);
+    Containers::Pair<DescriptorSet, bool> e = allocator.allocateCached(layout, {0xcafe, 16});
+    CORRADE_VERIFY(e.first().handle());
+    CORRADE_VERIFY(e.second());
+    CORRADE_COMPARE(allocator.cachedSetCount(), 1);
+}
+
+void DescriptorAllocatorVkTest::reset() {
+    DescriptorSetLayout layout{device(), DescriptorSetLayoutCreateInfo{
+        {{0, DescriptorType::UniformBuffer}}
+    }};
+
+    DescriptorAllocator allocator{device(), 2, {
+        {DescriptorType::UniformBuffer, 2}
+    }};
+
+    for(std::size_t i = 0; i != 5; ++i)
+        allocator.allocate(layout);
+    const UnsignedInt poolCount = allocator.poolCount();
+
+    /* After a reset the existing pools get reused, no new ones created */
+    allocator.reset();
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_VERIFY(allocator.allocate(layout).handle());
+    CORRADE_COMPARE(allocator.poolCount(), poolCount);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::DescriptorAllocatorVkTest)
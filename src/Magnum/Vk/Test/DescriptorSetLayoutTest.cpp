@@ -182,7 +182,7 @@ void DescriptorSetLayoutTest::createInfoConstruct() {
         /* I hope the {{ will no longer be needed with C++14? */
         {{7, DescriptorType::UniformBuffer}},
         {{12, DescriptorType::CombinedImageSampler}}
-    }, DescriptorSetLayoutCreateInfo::Flag(VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT)};
+    }, DescriptorSetLayoutCreateInfo::Flag::UpdateAfterBindPool};
     CORRADE_COMPARE(info->bindingCount, 2);
     CORRADE_VERIFY(info->pBindings);
     CORRADE_COMPARE(info->pBindings[0].binding, 7);
@@ -713,6 +713,9 @@ void DeviceVkTest::constructFeaturesFromExtensions() {
 void DeviceVkTest::constructDeviceCreateInfoConstReference() {
     Queue queue{NoCreate};
     DeviceProperties deviceProperties = pickDevice(instance());
+    /* Query some properties upfront so they get copied to the device */
+    const UnsignedInt queueFamilyCount = deviceProperties.queueFamilyCount();
+    const DeviceFeatures features = deviceProperties.features();
     DeviceCreateInfo info{deviceProperties};
     info.addQueues(0, {0.0f}, {queue});
 
@@ -721,10 +724,14 @@ void DeviceVkTest::constructDeviceCreateInfoConstReference() {
     Device device{instance(), info};
     CORRADE_VERIFY(device.handle());
 
-    /* Device properties should be lazy-populated and different from the
-       above instances because we didn't transfer the ownership here either */
+    /* Device properties should be different from the above instances because
+       we didn't transfer the ownership here either, but with the already
+       queried values copied over */
     CORRADE_COMPARE(device.properties().name(), deviceProperties.name());
     CORRADE_VERIFY(&device.properties().properties() != &deviceProperties.properties());
+    CORRADE_COMPARE(device.properties().queueFamilyCount(), queueFamilyCount);
+    CORRADE_COMPARE(device.properties().features(), features);
+    CORRADE_COMPARE(device.properties().driver(), deviceProperties.driver());
 }
 
 void DeviceVkTest::constructTransferDeviceProperties() {
@@ -0,0 +1,243 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <thread>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Vk/CommandBuffer.h"
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/Fence.h"
+#include "Magnum/Vk/FrameCommandPools.h"
+#include "Magnum/Vk/Queue.h"
+#include "Magnum/Vk/VulkanTester.h"
+
+namespace Magnum { namespace Vk { namespace Test { namespace {
+
+struct FrameCommandPoolsVkTest: VulkanTester {
+    explicit FrameCommandPoolsVkTest();
+
+    void construct();
+    void constructZeroCount();
+    void constructMove();
+
+    void frames();
+    void allocateReuse();
+    void recordParallel();
+
+    void noFrameBegun();
+    void threadOutOfRange();
+};
+
+FrameCommandPoolsVkTest::FrameCommandPoolsVkTest() {
+    addTests({&FrameCommandPoolsVkTest::construct,
+              &FrameCommandPoolsVkTest::constructZeroCount,
+              &FrameCommandPoolsVkTest::constructMove,
+
+              &FrameCommandPoolsVkTest::frames,
+              &FrameCommandPoolsVkTest::allocateReuse,
+              &FrameCommandPoolsVkTest::recordParallel,
+
+              &FrameCommandPoolsVkTest::noFrameBegun,
+              &FrameCommandPoolsVkTest::threadOutOfRange});
+}
+
+void FrameCommandPoolsVkTest::construct() {
+    {
+        FrameCommandPools pools{device(), device().properties().pickQueueFamily(QueueFlag::Graphics), 4, 3};
+        CORRADE_COMPARE(pools.threadCount(), 4);
+        CORRADE_COMPARE(pools.frameCount(), 3);
+    }
+
+    /* Shouldn't crash or anything */
+    CORRADE_VERIFY(true);
+}
+
+void FrameCommandPoolsVkTest::constructZeroCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    FrameCommandPools{device(), device().properties().pickQueueFamily(QueueFlag::Graphics), 0, 2};
+    FrameCommandPools{device(), device().properties().pickQueueFamily(QueueFlag::Graphics), 2, 0};
+    CORRADE_COMPARE(out.str(),
+        "Vk::FrameCommandPools: expected non-zero thread and frame count, got 0 and 2\n"
+        "Vk::FrameCommandPools: expected non-zero thread and frame count, got 2 and 0\n");
+}
+
+void FrameCommandPoolsVkTest::constructMove() {
+    FrameCommandPools a{device(), device().properties().pickQueueFamily(QueueFlag::Graphics), 2};
+
+    FrameCommandPools b = Utility::move(a);
+    CORRADE_COMPARE(a.threadCount(), 0);
+    CORRADE_COMPARE(b.threadCount(), 2);
+    CORRADE_COMPARE(b.frameCount(), 2);
+
+    FrameCommandPools c{NoCreate};
+    c = Utility::move(b);
+    CORRADE_COMPARE(b.threadCount(), 0);
+    CORRADE_COMPARE(c.threadCount(), 2);
+    CORRADE_COMPARE(c.frameCount(), 2);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<FrameCommandPools>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<FrameCommandPools>::value);
+}
+
+void FrameCommandPoolsVkTest::frames() {
+    FrameCommandPools pools{device(), device().properties().pickQueueFamily(QueueFlag::Graphics), 1, 3};
+
+    /* Each frame slot has its own fence and pools, cycling around */
+    pools.beginFrame();
+    CORRADE_COMPARE(pools.frame(), 0);
+    VkFence fence0 = pools.fence();
+    VkCommandPool pool0 = pools.pool(0);
+
+    /* Submit nothing so the fence gets signaled again */
+    queue().submit(nullptr, pools.fence());
+
+    pools.beginFrame();
+    CORRADE_COMPARE(pools.frame(), 1);
+    CORRADE_VERIFY(pools.fence().handle() != fence0);
+    CORRADE_VERIFY(pools.pool(0).handle() != pool0);
+    queue().submit(nullptr, pools.fence());
+
+    pools.beginFrame();
+    CORRADE_COMPARE(pools.frame(), 2);
+    queue().submit(nullptr, pools.fence());
+
+    pools.beginFrame();
+    CORRADE_COMPARE(pools.frame(), 0);
+    CORRADE_COMPARE(pools.fence().handle(), fence0);
+    CORRADE_COMPARE(pools.pool(0).handle(), pool0);
+    queue().submit(nullptr, pools.fence());
+    pools.fence().wait();
+}
+
+void FrameCommandPoolsVkTest::allocateReuse() {
+    FrameCommandPools pools{device(), device().properties().pickQueueFamily(QueueFlag::Graphics), 1, 1};
+
+    pools.beginFrame();
+    CommandBuffer a = pools.allocate(0);
+    CommandBuffer b = pools.allocate(0);
+    CommandBuffer c = pools.allocate(0, CommandBufferLevel::Secondary);
+    CORRADE_VERIFY(a.handle());
+    CORRADE_VERIFY(b.handle());
+    CORRADE_VERIFY(c.handle());
+    CORRADE_VERIFY(a.handle() != b.handle());
+    /* The buffers are owned by the pool */
+    CORRADE_COMPARE(a.handleFlags(), HandleFlags{});
+    VkCommandBuffer aHandle = a.handle();
+    VkCommandBuffer bHandle = b.handle();
+    VkCommandBuffer cHandle = c.handle();
+
+    c.begin().end();
+    a.begin()
+     .executeCommands({c})
+     .end();
+    b.begin().end();
+    queue().submit({SubmitInfo{}.setCommandBuffers({a, b})}, pools.fence());
+
+    /* In the next frame the same buffers are reused, once the previous frame
+       is done */
+    pools.beginFrame();
+    CORRADE_COMPARE(pools.allocate(0).handle(), aHandle);
+    CORRADE_COMPARE(pools.allocate(0, CommandBufferLevel::Secondary).handle(), cHandle);
+    CORRADE_COMPARE(pools.allocate(0).handle(), bHandle);
+
+    /* And a new one allocated if there's not enough */
+    CommandBuffer d = pools.allocate(0);
+    CORRADE_VERIFY(d.handle());
+    CORRADE_VERIFY(d.handle() != aHandle);
+    CORRADE_VERIFY(d.handle() != bHandle);
+}
+
+void FrameCommandPoolsVkTest::recordParallel() {
+    FrameCommandPools pools{device(), device().properties().pickQueueFamily(QueueFlag::Graphics), 4};
+
+    for(std::size_t frame = 0; frame != 3; ++frame) {
+        pools.beginFrame();
+
+        /* Each thread records its own secondary command buffer */
+        VkCommandBuffer secondary[4];
+        std::thread threads[4];
+        for(UnsignedInt i = 0; i != 4; ++i) threads[i] = std::thread{[&pools, &secondary, i]() {
+            CommandBuffer cmd = pools.allocate(i, CommandBufferLevel::Secondary);
+            cmd.begin().end();
+            secondary[i] = cmd;
+        }};
+        for(std::thread& thread: threads) thread.join();
+
+        /* And then they're all executed from a primary one */
+        CommandBuffer cmd = pools.allocate(0);
+        cmd.begin()
+           .executeCommands(secondary)
+           .end();
+        queue().submit({SubmitInfo{}.setCommandBuffers({cmd})}, pools.fence());
+    }
+
+    pools.fence().wait();
+
+    /* Does not do anything visible, so just test that it didn't blow up */
+    CORRADE_VERIFY(true);
+}
+
+void FrameCommandPoolsVkTest::noFrameBegun() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FrameCommandPools pools{device(), device().properties().pickQueueFamily(QueueFlag::Graphics), 1};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    pools.frame();
+    pools.fence();
+    pools.pool(0);
+    pools.allocate(0);
+    CORRADE_COMPARE(out.str(),
+        "Vk::FrameCommandPools::frame(): no frame begun yet\n"
+        "Vk::FrameCommandPools::fence(): no frame begun yet\n"
+        "Vk::FrameCommandPools::pool(): no frame begun yet\n"
+        "Vk::FrameCommandPools::allocate(): no frame begun yet\n");
+}
+
+void FrameCommandPoolsVkTest::threadOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    FrameCommandPools pools{device(), device().properties().pickQueueFamily(QueueFlag::Graphics), 3};
+    pools.beginFrame();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    pools.pool(3);
+    pools.allocate(3);
+    CORRADE_COMPARE(out.str(),
+        "Vk::FrameCommandPools::pool(): index 3 out of range for 3 threads\n"
+        "Vk::FrameCommandPools::allocate(): index 3 out of range for 3 threads\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::FrameCommandPoolsVkTest)
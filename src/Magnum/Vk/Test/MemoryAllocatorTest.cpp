@@ -0,0 +1,151 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Vk/MemoryAllocator.h"
+
+namespace Magnum { namespace Vk { namespace Test { namespace {
+
+struct MemoryAllocatorTest: TestSuite::Tester {
+    explicit MemoryAllocatorTest();
+
+    void allocationConstructNoCreate();
+    void allocationConstructCopy();
+    void allocationConstructMove();
+
+    void allocationNoAllocation();
+
+    void constructNoCreate();
+    void constructCopy();
+
+    void debugFlag();
+    void debugFlags();
+};
+
+MemoryAllocatorTest::MemoryAllocatorTest() {
+    addTests({&MemoryAllocatorTest::allocationConstructNoCreate,
+              &MemoryAllocatorTest::allocationConstructCopy,
+              &MemoryAllocatorTest::allocationConstructMove,
+
+              &MemoryAllocatorTest::allocationNoAllocation,
+
+              &MemoryAllocatorTest::constructNoCreate,
+              &MemoryAllocatorTest::constructCopy,
+
+              &MemoryAllocatorTest::debugFlag,
+              &MemoryAllocatorTest::debugFlags});
+}
+
+void MemoryAllocatorTest::allocationConstructNoCreate() {
+    {
+        MemoryAllocation allocation{NoCreate};
+        CORRADE_VERIFY(!allocation);
+        CORRADE_COMPARE(allocation.offset(), 0);
+        CORRADE_COMPARE(allocation.size(), 0);
+    }
+
+    /* Shouldn't crash or anything */
+    CORRADE_VERIFY(true);
+
+    CORRADE_VERIFY(std::is_nothrow_constructible<MemoryAllocation, NoCreateT>::value);
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<NoCreateT, MemoryAllocation>::value);
+}
+
+void MemoryAllocatorTest::allocationConstructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<MemoryAllocation>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<MemoryAllocation>{});
+}
+
+void MemoryAllocatorTest::allocationConstructMove() {
+    /* Moving an empty allocation shouldn't crash, the rest is tested in
+       MemoryAllocatorVkTest */
+    MemoryAllocation a{NoCreate};
+    MemoryAllocation b = Utility::move(a);
+    CORRADE_VERIFY(!b);
+
+    MemoryAllocation c{NoCreate};
+    c = Utility::move(b);
+    CORRADE_VERIFY(!c);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<MemoryAllocation>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<MemoryAllocation>::value);
+}
+
+void MemoryAllocatorTest::allocationNoAllocation() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    MemoryAllocation allocation{NoCreate};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    allocation.memoryType();
+    allocation.isDedicated();
+    allocation.map();
+    CORRADE_COMPARE(out.str(),
+        "Vk::MemoryAllocation::memoryType(): the instance holds no allocation\n"
+        "Vk::MemoryAllocation::isDedicated(): the instance holds no allocation\n"
+        "Vk::MemoryAllocation::map(): the instance holds no allocation\n");
+}
+
+void MemoryAllocatorTest::constructNoCreate() {
+    {
+        MemoryAllocator allocator{NoCreate};
+    }
+
+    /* Shouldn't crash or anything */
+    CORRADE_VERIFY(true);
+
+    CORRADE_VERIFY(std::is_nothrow_constructible<MemoryAllocator, NoCreateT>::value);
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<NoCreateT, MemoryAllocator>::value);
+}
+
+void MemoryAllocatorTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<MemoryAllocator>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<MemoryAllocator>{});
+}
+
+void MemoryAllocatorTest::debugFlag() {
+    std::ostringstream out;
+    Debug{&out} << MemoryAllocationFlag::Linear << MemoryAllocationFlag(0xcc);
+    CORRADE_COMPARE(out.str(), "Vk::MemoryAllocationFlag::Linear Vk::MemoryAllocationFlag(0xcc)\n");
+}
+
+void MemoryAllocatorTest::debugFlags() {
+    std::ostringstream out;
+    Debug{&out} << (MemoryAllocationFlag::Dedicated|MemoryAllocationFlag::Linear) << MemoryAllocationFlags{};
+    CORRADE_COMPARE(out.str(), "Vk::MemoryAllocationFlag::Dedicated|Vk::MemoryAllocationFlag::Linear Vk::MemoryAllocationFlags{}\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::MemoryAllocatorTest)
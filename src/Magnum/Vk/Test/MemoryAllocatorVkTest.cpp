@@ -0,0 +1,505 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/FormatStl.h>
+
+#include "Magnum/Vk/BufferCreateInfo.h"
+#include "Magnum/Vk/DeviceCreateInfo.h"
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/ExtensionProperties.h"
+#include "Magnum/Vk/Extensions.h"
+#include "Magnum/Vk/ImageCreateInfo.h"
+#include "Magnum/Vk/Instance.h"
+#include "Magnum/Vk/MemoryAllocateInfo.h"
+#include "Magnum/Vk/MemoryAllocator.h"
+#include "Magnum/Vk/PixelFormat.h"
+#include "Magnum/Vk/Version.h"
+#include "Magnum/Vk/VulkanTester.h"
+
+namespace Magnum { namespace Vk { namespace Test { namespace {
+
+struct MemoryAllocatorVkTest: VulkanTester {
+    explicit MemoryAllocatorVkTest();
+
+    void construct();
+    void constructBlockSize();
+    void constructMove();
+
+    void allocate();
+    void allocateAlignment();
+    void allocateReuse();
+    void allocateMerge();
+    void allocateNewBlock();
+    void allocateDedicated();
+    void allocateDedicatedLarge();
+    void allocateLinear();
+
+    void allocationMove();
+    void allocationMap();
+    void allocationMapNotHostVisible();
+
+    void buffer();
+    void image();
+
+    void budget();
+    void budgetExtension();
+    void heapOutOfRange();
+};
+
+MemoryAllocatorVkTest::MemoryAllocatorVkTest() {
+    addTests({&MemoryAllocatorVkTest::construct,
+              &MemoryAllocatorVkTest::constructBlockSize,
+              &MemoryAllocatorVkTest::constructMove,
+
+              &MemoryAllocatorVkTest::allocate,
+              &MemoryAllocatorVkTest::allocateAlignment,
+              &MemoryAllocatorVkTest::allocateReuse,
+              &MemoryAllocatorVkTest::allocateMerge,
+              &MemoryAllocatorVkTest::allocateNewBlock,
+              &MemoryAllocatorVkTest::allocateDedicated,
+              &MemoryAllocatorVkTest::allocateDedicatedLarge,
+              &MemoryAllocatorVkTest::allocateLinear,
+
+              &MemoryAllocatorVkTest::allocationMove,
+              &MemoryAllocatorVkTest::allocationMap,
+              &MemoryAllocatorVkTest::allocationMapNotHostVisible,
+
+              &MemoryAllocatorVkTest::buffer,
+              &MemoryAllocatorVkTest::image,
+
+              &MemoryAllocatorVkTest::budget,
+              &MemoryAllocatorVkTest::budgetExtension,
+              &MemoryAllocatorVkTest::heapOutOfRange});
+}
+
+/* The allocator only looks at the size, alignment and allowed memory types,
+   so there's no need to create actual buffers to get requirements with
+   predictable values */
+MemoryRequirements requirements(const UnsignedLong size, const UnsignedLong alignment) {
+    VkMemoryRequirements2 requirements{};
+    requirements.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+    requirements.memoryRequirements.size = size;
+    requirements.memoryRequirements.alignment = alignment;
+    requirements.memoryRequirements.memoryTypeBits = ~UnsignedInt{};
+    return MemoryRequirements{requirements};
+}
+
+constexpr UnsignedLong BlockSize = 1024*1024;
+
+void MemoryAllocatorVkTest::construct() {
+    MemoryAllocator allocator{device()};
+    CORRADE_COMPARE(allocator.allocationCount(), 0);
+    CORRADE_COMPARE(allocator.blockCount(), 0);
+
+    const UnsignedInt memory = device().properties().pickMemory(MemoryFlag::DeviceLocal);
+    const UnsignedLong heapSize = device().properties().memoryHeapSize(device().properties().memoryHeapIndex(memory));
+    CORRADE_COMPARE_AS(allocator.blockSize(memory), 256*1024*1024,
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(allocator.blockSize(memory), heapSize/8,
+        TestSuite::Compare::LessOrEqual);
+}
+
+void MemoryAllocatorVkTest::constructBlockSize() {
+    MemoryAllocator allocator{device(), BlockSize};
+    CORRADE_COMPARE(allocator.blockSize(device().properties().pickMemory(MemoryFlag::DeviceLocal)), BlockSize);
+}
+
+void MemoryAllocatorVkTest::constructMove() {
+    MemoryAllocator a{device(), BlockSize};
+    MemoryAllocation allocation = a.allocate(requirements(1024, 256), MemoryFlag::DeviceLocal);
+    CORRADE_COMPARE(a.allocationCount(), 1);
+
+    MemoryAllocator b = Utility::move(a);
+    CORRADE_COMPARE(b.allocationCount(), 1);
+    CORRADE_COMPARE(b.blockCount(), 1);
+
+    MemoryAllocator c{NoCreate};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.allocationCount(), 1);
+
+    /* The allocation references the internal state, which stays where it was
+       even though the allocator got moved */
+    allocation = MemoryAllocation{NoCreate};
+    CORRADE_COMPARE(c.allocationCount(), 0);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<MemoryAllocator>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<MemoryAllocator>::value);
+}
+
+void MemoryAllocatorVkTest::allocate() {
+    MemoryAllocator allocator{device(), BlockSize};
+
+    MemoryAllocation a = allocator.allocate(requirements(1000, 256), MemoryFlag::DeviceLocal);
+    MemoryAllocation b = allocator.allocate(requirements(1000, 256), MemoryFlag::DeviceLocal);
+    MemoryAllocation c = allocator.allocate(requirements(1000, 256), MemoryFlag::DeviceLocal);
+    CORRADE_VERIFY(a);
+    CORRADE_VERIFY(!a.isDedicated());
+    CORRADE_COMPARE(a.memoryType(), device().properties().pickMemory(MemoryFlag::DeviceLocal));
+
+    /* All from the same block, one after another */
+    CORRADE_COMPARE(a.memory().handle(), b.memory().handle());
+    CORRADE_COMPARE(a.memory().handle(), c.memory().handle());
+    CORRADE_COMPARE(a.memory().size(), BlockSize);
+    CORRADE_COMPARE(a.offset(), 0);
+    CORRADE_COMPARE(a.size(), 1000);
+    CORRADE_COMPARE(b.offset(), 1024);
+    CORRADE_COMPARE(b.size(), 1000);
+    CORRADE_COMPARE(c.offset(), 2048);
+    CORRADE_COMPARE(c.size(), 1000);
+
+    CORRADE_COMPARE(allocator.allocationCount(), 3);
+    CORRADE_COMPARE(allocator.blockCount(), 1);
+    CORRADE_COMPARE(allocator.allocatedSize(device().properties().memoryHeapIndex(a.memoryType())), BlockSize);
+}
+
+void MemoryAllocatorVkTest::allocateAlignment() {
+    MemoryAllocator allocator{device(), BlockSize};
+
+    MemoryAllocation a = allocator.allocate(requirements(100, 1), MemoryFlag::DeviceLocal);
+    MemoryAllocation b = allocator.allocate(requirements(100, 256), MemoryFlag::DeviceLocal);
+    CORRADE_COMPARE(a.offset(), 0);
+    CORRADE_COMPARE(b.offset(), 256);
+
+    /* The alignment padding is kept free and as it's the smallest range that
+       fits, it gets used for the next small allocation */
+    MemoryAllocation c = allocator.allocate(requirements(16, 4), MemoryFlag::DeviceLocal);
+    CORRADE_COMPARE(c.offset(), 100);
+    MemoryAllocation d = allocator.allocate(requirements(200, 4), MemoryFlag::DeviceLocal);
+    CORRADE_COMPARE(d.offset(), 356);
+}
+
+void MemoryAllocatorVkTest::allocateReuse() {
+    MemoryAllocator allocator{device(), BlockSize};
+
+    MemoryAllocation a = allocator.allocate(requirements(4096, 256), MemoryFlag::DeviceLocal);
+    MemoryAllocation b = allocator.allocate(requirements(4096, 256), MemoryFlag::DeviceLocal);
+    CORRADE_COMPARE(b.offset(), 4096);
+
+    a = MemoryAllocation{NoCreate};
+    CORRADE_COMPARE(allocator.allocationCount(), 1);
+
+    /* The freed range gets reused */
+    MemoryAllocation c = allocator.allocate(requirements(4096, 256), MemoryFlag::DeviceLocal);
+    CORRADE_COMPARE(c.offset(), 0);
+    CORRADE_COMPARE(c.memory().handle(), b.memory().handle());
+
+    /* The last block is kept even if it's empty */
+    b = MemoryAllocation{NoCreate};
+    c = MemoryAllocation{NoCreate};
+    CORRADE_COMPARE(allocator.allocationCount(), 0);
+    CORRADE_COMPARE(allocator.blockCount(), 1);
+}
+
+void MemoryAllocatorVkTest::allocateMerge() {
+    MemoryAllocator allocator{device(), BlockSize};
+
+    MemoryAllocation a = allocator.allocate(requirements(BlockSize/4, 256), MemoryFlag::DeviceLocal);
+    MemoryAllocation b = allocator.allocate(requirements(BlockSize/4, 256), MemoryFlag::DeviceLocal);
+    MemoryAllocation c = allocator.allocate(requirements(BlockSize/4, 256), MemoryFlag::DeviceLocal);
+    MemoryAllocation d = allocator.allocate(requirements(BlockSize/4, 256), MemoryFlag::DeviceLocal);
+    CORRADE_COMPARE(d.offset(), BlockSize*3/4);
+    CORRADE_COMPARE(allocator.blockCount(), 1);
+
+    /* Free two neighboring ranges, in reverse order so the merge with the
+       next range is tested as well. A half-block allocation should then fit
+       into the merged range without needing a new block. */
+    c = MemoryAllocation{NoCreate};
+    b = MemoryAllocation{NoCreate};
+    MemoryAllocation e = allocator.allocate(requirements(BlockSize/2, 256), MemoryFlag::DeviceLocal);
+    CORRADE_VERIFY(!e.isDedicated());
+    CORRADE_COMPARE(e.offset(), BlockSize/4);
+    CORRADE_COMPARE(allocator.blockCount(), 1);
+
+    /* Free everything and verify the whole block is again available */
+    a = MemoryAllocation{NoCreate};
+    d = MemoryAllocation{NoCreate};
+    e = MemoryAllocation{NoCreate};
+    MemoryAllocation f = allocator.allocate(requirements(BlockSize/2, 256), MemoryFlag::DeviceLocal);
+    MemoryAllocation g = allocator.allocate(requirements(BlockSize/2, 256), MemoryFlag::DeviceLocal);
+    CORRADE_COMPARE(f.offset(), 0);
+    CORRADE_COMPARE(g.offset(), BlockSize/2);
+    CORRADE_COMPARE(allocator.blockCount(), 1);
+}
+
+void MemoryAllocatorVkTest::allocateNewBlock() {
+    MemoryAllocator allocator{device(), BlockSize};
+
+    MemoryAllocation a = allocator.allocate(requirements(400*1024, 256), MemoryFlag::DeviceLocal);
+    MemoryAllocation b = allocator.allocate(requirements(400*1024, 256), MemoryFlag::DeviceLocal);
+    CORRADE_COMPARE(allocator.blockCount(), 1);
+
+    /* Doesn't fit anymore, a new block is allocated */
+    MemoryAllocation c = allocator.allocate(requirements(400*1024, 256), MemoryFlag::DeviceLocal);
+    CORRADE_COMPARE(allocator.blockCount(), 2);
+    CORRADE_VERIFY(c.memory().handle() != a.memory().handle());
+    CORRADE_COMPARE(c.offset(), 0);
+    CORRADE_COMPARE(allocator.allocatedSize(device().properties().memoryHeapIndex(a.memoryType())), 2*BlockSize);
+
+    /* The new block is freed once empty, as there's another one of the same
+       kind */
+    c = MemoryAllocation{NoCreate};
+    CORRADE_COMPARE(allocator.blockCount(), 1);
+    CORRADE_COMPARE(allocator.allocatedSize(device().properties().memoryHeapIndex(a.memoryType())), BlockSize);
+}
+
+void MemoryAllocatorVkTest::allocateDedicated() {
+    MemoryAllocator allocator{device(), BlockSize};
+
+    MemoryAllocation a = allocator.allocate(requirements(1000, 256), MemoryFlag::DeviceLocal);
+    MemoryAllocation b = allocator.allocate(requirements(1000, 256), MemoryFlag::DeviceLocal, MemoryAllocationFlag::Dedicated);
+    CORRADE_VERIFY(!a.isDedicated());
+    CORRADE_VERIFY(b.isDedicated());
+    CORRADE_COMPARE(b.offset(), 0);
+    CORRADE_COMPARE(b.size(), 1000);
+    CORRADE_COMPARE(b.memory().size(), 1000);
+    CORRADE_VERIFY(b.memory().handle() != a.memory().handle());
+    CORRADE_COMPARE(allocator.allocationCount(), 2);
+    CORRADE_COMPARE(allocator.blockCount(), 2);
+
+    /* Dedicated memory is freed right away */
+    b = MemoryAllocation{NoCreate};
+    CORRADE_COMPARE(allocator.allocationCount(), 1);
+    CORRADE_COMPARE(allocator.blockCount(), 1);
+}
+
+void MemoryAllocatorVkTest::allocateDedicatedLarge() {
+    MemoryAllocator allocator{device(), BlockSize};
+
+    /* Exactly half a block is still sub-allocated */
+    MemoryAllocation a = allocator.allocate(requirements(BlockSize/2, 256), MemoryFlag::DeviceLocal);
+    CORRADE_VERIFY(!a.isDedicated());
+
+    MemoryAllocation b = allocator.allocate(requirements(BlockSize/2 + 1, 256), MemoryFlag::DeviceLocal);
+    CORRADE_VERIFY(b.isDedicated());
+    CORRADE_COMPARE(b.memory().size(), BlockSize/2 + 1);
+}
+
+void MemoryAllocatorVkTest::allocateLinear() {
+    MemoryAllocator allocator{device(), BlockSize};
+
+    MemoryAllocation a = allocator.allocate(requirements(1000, 256), MemoryFlag::DeviceLocal, MemoryAllocationFlag::Linear);
+    MemoryAllocation b = allocator.allocate(requirements(1000, 256), MemoryFlag::DeviceLocal);
+    MemoryAllocation c = allocator.allocate(requirements(1000, 256), MemoryFlag::DeviceLocal, MemoryAllocationFlag::Linear);
+
+    /* Linear and non-linear resources are in separate blocks */
+    CORRADE_COMPARE(allocator.blockCount(), 2);
+    CORRADE_VERIFY(a.memory().handle() != b.memory().handle());
+    CORRADE_COMPARE(a.memory().handle(), c.memory().handle());
+    CORRADE_COMPARE(b.offset(), 0);
+    CORRADE_COMPARE(c.offset(), 1024);
+}
+
+void MemoryAllocatorVkTest::allocationMove() {
+    MemoryAllocator allocator{device(), BlockSize};
+
+    MemoryAllocation a = allocator.allocate(requirements(1000, 256), MemoryFlag::DeviceLocal);
+    MemoryAllocation b = allocator.allocate(requirements(1000, 256), MemoryFlag::DeviceLocal);
+    VkDeviceMemory memory = a.memory().handle();
+
+    MemoryAllocation c = Utility::move(b);
+    CORRADE_VERIFY(!b);
+    CORRADE_COMPARE(b.offset(), 0);
+    CORRADE_COMPARE(b.size(), 0);
+    CORRADE_VERIFY(c);
+    CORRADE_COMPARE(c.memory().handle(), memory);
+    CORRADE_COMPARE(c.offset(), 1024);
+    CORRADE_COMPARE(c.size(), 1000);
+    CORRADE_COMPARE(allocator.allocationCount(), 2);
+
+    /* Move assignment swaps, so the original allocation gets freed only once
+       the moved-from instance gets destroyed */
+    MemoryAllocation d{NoCreate};
+    d = Utility::move(c);
+    CORRADE_VERIFY(!c);
+    CORRADE_COMPARE(d.offset(), 1024);
+
+    a = Utility::move(d);
+    CORRADE_COMPARE(a.offset(), 1024);
+    CORRADE_COMPARE(d.offset(), 0);
+    CORRADE_COMPARE(allocator.allocationCount(), 2);
+    d = MemoryAllocation{NoCreate};
+    CORRADE_COMPARE(allocator.allocationCount(), 1);
+}
+
+void MemoryAllocatorVkTest::allocationMap() {
+    MemoryAllocator allocator{device(), BlockSize};
+
+    MemoryAllocation a = allocator.allocate(requirements(1000, 256), MemoryFlag::HostVisible);
+    MemoryAllocation b = allocator.allocate(requirements(1000, 256), MemoryFlag::HostVisible);
+
+    Containers::ArrayView<char> mappedA = a.map();
+    Containers::ArrayView<char> mappedB = b.map();
+    CORRADE_COMPARE(mappedA.size(), 1000);
+    CORRADE_COMPARE(mappedB.size(), 1000);
+
+    /* Both are views on the same mapping of the whole block */
+    CORRADE_COMPARE(mappedB.data() - mappedA.data(), 1024);
+    CORRADE_COMPARE(a.map().data(), mappedA.data());
+
+    mappedA[37] = 'a';
+    mappedB[37] = 'b';
+    CORRADE_COMPARE(a.map()[37], 'a');
+    CORRADE_COMPARE(b.map()[37], 'b');
+}
+
+void MemoryAllocatorVkTest::allocationMapNotHostVisible() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::Optional<UnsignedInt> memory;
+    for(UnsignedInt i = 0; i != device().properties().memoryCount(); ++i) {
+        if(device().properties().memoryFlags(i) & MemoryFlag::HostVisible)
+            continue;
+        memory = i;
+        break;
+    }
+    if(!memory)
+        CORRADE_SKIP("All memory types on this device are host-visible, can't test.");
+
+    MemoryAllocator allocator{device(), BlockSize};
+    MemoryAllocation a = allocator.allocate(requirements(1000, 256), device().properties().memoryFlags(*memory));
+
+    /* The picked memory may be different than the one we found above, so
+       check again */
+    if(device().properties().memoryFlags(a.memoryType()) & MemoryFlag::HostVisible)
+        CORRADE_SKIP("Picked a host-visible memory, can't test.");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.map();
+    CORRADE_COMPARE(out.str(), Utility::formatString("Vk::MemoryAllocation::map(): memory type {} is not host-visible\n", a.memoryType()));
+}
+
+void MemoryAllocatorVkTest::buffer() {
+    MemoryAllocator allocator{device()};
+
+    {
+        Buffer a{device(), BufferCreateInfo{BufferUsage::VertexBuffer, 1024}, allocator, MemoryFlag::DeviceLocal};
+        Buffer b{device(), BufferCreateInfo{BufferUsage::VertexBuffer, 1024}, allocator, MemoryFlag::DeviceLocal};
+        CORRADE_VERIFY(a.hasAllocation());
+        CORRADE_VERIFY(!a.hasDedicatedMemory());
+        CORRADE_COMPARE_AS(a.allocation().size(), 1024,
+            TestSuite::Compare::GreaterOrEqual);
+        CORRADE_COMPARE(a.allocation().memory().handle(), b.allocation().memory().handle());
+        CORRADE_COMPARE(allocator.allocationCount(), 2);
+        CORRADE_COMPARE(allocator.blockCount(), 1);
+
+        /* The allocation gets moved together with the buffer */
+        Buffer c = Utility::move(b);
+        CORRADE_VERIFY(!b.hasAllocation());
+        CORRADE_VERIFY(c.hasAllocation());
+        CORRADE_COMPARE(allocator.allocationCount(), 2);
+    }
+
+    CORRADE_COMPARE(allocator.allocationCount(), 0);
+}
+
+void MemoryAllocatorVkTest::image() {
+    MemoryAllocator allocator{device()};
+
+    {
+        Image a{device(), ImageCreateInfo2D{ImageUsage::Sampled,
+            PixelFormat::RGBA8Unorm, {256, 256}, 1}, allocator, MemoryFlag::DeviceLocal};
+        CORRADE_VERIFY(a.hasAllocation());
+        CORRADE_VERIFY(!a.hasDedicatedMemory());
+        CORRADE_COMPARE_AS(a.allocation().size(), 256*256*4,
+            TestSuite::Compare::GreaterOrEqual);
+        CORRADE_COMPARE(allocator.allocationCount(), 1);
+
+        /* A buffer goes to a different block because it's linear */
+        Buffer b{device(), BufferCreateInfo{BufferUsage::VertexBuffer, 1024}, allocator, MemoryFlag::DeviceLocal};
+        CORRADE_COMPARE(allocator.blockCount(), 2);
+    }
+
+    CORRADE_COMPARE(allocator.allocationCount(), 0);
+}
+
+void MemoryAllocatorVkTest::budget() {
+    if(device().isExtensionEnabled<Extensions::EXT::memory_budget>())
+        CORRADE_SKIP("EXT_memory_budget enabled, can't test the fallback.");
+
+    MemoryAllocator allocator{device(), BlockSize};
+    MemoryAllocation a = allocator.allocate(requirements(1000, 256), MemoryFlag::DeviceLocal);
+
+    const UnsignedInt heap = device().properties().memoryHeapIndex(a.memoryType());
+    CORRADE_COMPARE(allocator.heapUsage(heap), BlockSize);
+    CORRADE_COMPARE(allocator.heapBudget(heap), device().properties().memoryHeapSize(heap)/10*8);
+}
+
+void MemoryAllocatorVkTest::budgetExtension() {
+    if(!instance().isVersionSupported(Version::Vk11) && !instance().isExtensionEnabled<Extensions::KHR::get_physical_device_properties2>())
+        CORRADE_SKIP("Neither Vulkan 1.1 nor KHR_get_physical_device_properties2 is supported, can't test.");
+
+    DeviceProperties properties = pickDevice(instance());
+    if(!properties.enumerateExtensionProperties().isSupported<Extensions::EXT::memory_budget>())
+        CORRADE_SKIP("EXT_memory_budget not supported, can't test.");
+
+    Queue queue{NoCreate};
+    Device device{instance(), DeviceCreateInfo{Utility::move(properties)}
+        .addQueues(QueueFlag::Graphics, {0.0f}, {queue})
+        .addEnabledExtensions<Extensions::EXT::memory_budget>()};
+
+    MemoryAllocator allocator{device, BlockSize};
+    MemoryAllocation a = allocator.allocate(requirements(1000, 256), MemoryFlag::DeviceLocal);
+
+    /* The values are driver-specific, so just verify they make sense */
+    const UnsignedInt heap = device.properties().memoryHeapIndex(a.memoryType());
+    CORRADE_COMPARE_AS(allocator.heapUsage(heap), 0,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(allocator.heapBudget(heap), 0,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE_AS(allocator.heapBudget(heap), device.properties().memoryHeapSize(heap),
+        TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE(allocator.allocatedSize(heap), BlockSize);
+}
+
+void MemoryAllocatorVkTest::heapOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    MemoryAllocator allocator{device()};
+    const UnsignedInt heapCount = device().properties().memoryHeapCount();
+    const UnsignedInt memoryCount = device().properties().memoryCount();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    allocator.blockSize(memoryCount);
+    allocator.allocatedSize(heapCount);
+    allocator.heapUsage(heapCount);
+    allocator.heapBudget(heapCount);
+    CORRADE_COMPARE(out.str(), Utility::formatString(
+        "Vk::MemoryAllocator::blockSize(): index {0} out of range for {0} memory types\n"
+        "Vk::MemoryAllocator::allocatedSize(): index {1} out of range for {1} memory heaps\n"
+        "Vk::MemoryAllocator::heapUsage(): index {1} out of range for {1} memory heaps\n"
+        "Vk::MemoryAllocator::heapBudget(): index {1} out of range for {1} memory heaps\n", memoryCount, heapCount));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::MemoryAllocatorVkTest)
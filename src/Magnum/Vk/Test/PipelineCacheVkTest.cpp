@@ -0,0 +1,183 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/PipelineCacheCreateInfo.h"
+#include "Magnum/Vk/Result.h"
+#include "Magnum/Vk/VulkanTester.h"
+
+namespace Magnum { namespace Vk { namespace Test { namespace {
+
+struct PipelineCacheVkTest: VulkanTester {
+    explicit PipelineCacheVkTest();
+
+    void construct();
+    void constructInitialData();
+    void constructInitialDataIncompatible();
+    void constructMove();
+
+    void wrap();
+
+    void isDataCompatible();
+    void merge();
+};
+
+const struct {
+    const char* name;
+    bool truncate;
+    std::size_t offset;
+    UnsignedInt value;
+} IsDataCompatibleData[]{
+    {"too small", true, 0, 0},
+    {"header size too small", false, offsetof(VkPipelineCacheHeaderVersionOne, headerSize), 16},
+    {"header size too large", false, offsetof(VkPipelineCacheHeaderVersionOne, headerSize), 0xffffffffu},
+    {"different header version", false, offsetof(VkPipelineCacheHeaderVersionOne, headerVersion), 2},
+    /* Zero is not a valid vendor / device ID */
+    {"different vendor ID", false, offsetof(VkPipelineCacheHeaderVersionOne, vendorID), 0},
+    {"different device ID", false, offsetof(VkPipelineCacheHeaderVersionOne, deviceID), 0},
+};
+
+PipelineCacheVkTest::PipelineCacheVkTest() {
+    addTests({&PipelineCacheVkTest::construct,
+              &PipelineCacheVkTest::constructInitialData,
+              &PipelineCacheVkTest::constructInitialDataIncompatible,
+              &PipelineCacheVkTest::constructMove,
+
+              &PipelineCacheVkTest::wrap});
+
+    addInstancedTests({&PipelineCacheVkTest::isDataCompatible},
+        Containers::arraySize(IsDataCompatibleData));
+
+    addTests({&PipelineCacheVkTest::merge});
+}
+
+void PipelineCacheVkTest::construct() {
+    {
+        PipelineCache cache{device()};
+        CORRADE_VERIFY(cache.handle());
+        CORRADE_COMPARE(cache.handleFlags(), HandleFlag::DestroyOnDestruction);
+
+        /* Even an empty cache has at least the header */
+        Containers::Array<char> data = cache.data();
+        CORRADE_COMPARE_AS(data.size(), sizeof(VkPipelineCacheHeaderVersionOne),
+            TestSuite::Compare::GreaterOrEqual);
+        CORRADE_VERIFY(PipelineCache::isDataCompatible(device().properties(), data));
+    }
+
+    /* Shouldn't crash or anything */
+    CORRADE_VERIFY(true);
+}
+
+void PipelineCacheVkTest::constructInitialData() {
+    Containers::Array<char> data = PipelineCache{device()}.data();
+
+    PipelineCache cache{device(), PipelineCacheCreateInfo{data}};
+    CORRADE_VERIFY(cache.handle());
+    CORRADE_VERIFY(PipelineCache::isDataCompatible(device().properties(), cache.data()));
+}
+
+void PipelineCacheVkTest::constructInitialDataIncompatible() {
+    Containers::Array<char> data = PipelineCache{device()}.data();
+    /* Pretend the data come from a different driver version */
+    data[offsetof(VkPipelineCacheHeaderVersionOne, pipelineCacheUUID)] ^= 0xff;
+    CORRADE_VERIFY(!PipelineCache::isDataCompatible(device().properties(), data));
+
+    /* The data get silently discarded, resulting in an empty cache with a
+       valid header */
+    PipelineCache cache{device(), PipelineCacheCreateInfo{data}};
+    CORRADE_VERIFY(cache.handle());
+    CORRADE_VERIFY(PipelineCache::isDataCompatible(device().properties(), cache.data()));
+}
+
+void PipelineCacheVkTest::constructMove() {
+    PipelineCache a{device()};
+    VkPipelineCache handle = a.handle();
+
+    PipelineCache b = Utility::move(a);
+    CORRADE_VERIFY(!a.handle());
+    CORRADE_COMPARE(b.handle(), handle);
+    CORRADE_COMPARE(b.handleFlags(), HandleFlag::DestroyOnDestruction);
+
+    PipelineCache c{NoCreate};
+    c = Utility::move(b);
+    CORRADE_VERIFY(!b.handle());
+    CORRADE_COMPARE(b.handleFlags(), HandleFlags{});
+    CORRADE_COMPARE(c.handle(), handle);
+    CORRADE_COMPARE(c.handleFlags(), HandleFlag::DestroyOnDestruction);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<PipelineCache>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<PipelineCache>::value);
+}
+
+void PipelineCacheVkTest::wrap() {
+    VkPipelineCache cache{};
+    CORRADE_COMPARE(Result(device()->CreatePipelineCache(device(),
+        PipelineCacheCreateInfo{},
+        nullptr, &cache)), Result::Success);
+
+    auto wrapped = PipelineCache::wrap(device(), cache, HandleFlag::DestroyOnDestruction);
+    CORRADE_COMPARE(wrapped.handle(), cache);
+
+    /* Release the handle again, destroy by hand */
+    CORRADE_COMPARE(wrapped.release(), cache);
+    CORRADE_VERIFY(!wrapped.handle());
+    device()->DestroyPipelineCache(device(), cache, nullptr);
+}
+
+void PipelineCacheVkTest::isDataCompatible() {
+    auto&& data = IsDataCompatibleData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<char> cacheData = PipelineCache{device()}.data();
+    CORRADE_VERIFY(PipelineCache::isDataCompatible(device().properties(), cacheData));
+
+    /* The header fields are all 32-bit, the data are in native endianness */
+    Containers::ArrayView<char> modified = cacheData;
+    if(data.truncate)
+        modified = modified.prefix(sizeof(VkPipelineCacheHeaderVersionOne) - 1);
+    else
+        std::memcpy(modified.data() + data.offset, &data.value, sizeof(UnsignedInt));
+    CORRADE_VERIFY(!PipelineCache::isDataCompatible(device().properties(), modified));
+}
+
+void PipelineCacheVkTest::merge() {
+    PipelineCache a{device()};
+    PipelineCache b{device()};
+    PipelineCache c{device()};
+    a.merge({b, c});
+
+    /* Shouldn't crash or anything */
+    CORRADE_VERIFY(PipelineCache::isDataCompatible(device().properties(), a.data()));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::PipelineCacheVkTest)
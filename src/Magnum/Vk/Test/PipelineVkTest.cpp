@@ -40,6 +40,7 @@
 #include "Magnum/Vk/ImageCreateInfo.h"
 #include "Magnum/Vk/MeshLayout.h"
 #include "Magnum/Vk/Pipeline.h"
+#include "Magnum/Vk/PipelineCacheCreateInfo.h"
 #include "Magnum/Vk/PipelineLayoutCreateInfo.h"
 #include "Magnum/Vk/PixelFormat.h"
 #include "Magnum/Vk/RasterizationPipelineCreateInfo.h"
@@ -62,6 +63,7 @@ struct PipelineVkTest: VulkanTester {
     void constructRasterizationViewportNotSetDiscardEnabled();
     void constructRasterizationViewportNotSetDynamic();
     void constructCompute();
+    void constructComputeCache();
     void constructMove();
 
     void wrapRasterization();
@@ -85,6 +87,7 @@ PipelineVkTest::PipelineVkTest() {
               &PipelineVkTest::constructRasterizationViewportNotSetDiscardEnabled,
               &PipelineVkTest::constructRasterizationViewportNotSetDynamic,
               &PipelineVkTest::constructCompute,
+              &PipelineVkTest::constructComputeCache,
               &PipelineVkTest::constructMove,
 
               &PipelineVkTest::wrapRasterization,
@@ -289,6 +292,36 @@ void PipelineVkTest::constructCompute() {
     CORRADE_VERIFY(true);
 }
 
+void PipelineVkTest::constructComputeCache() {
+    PipelineLayout pipelineLayout{device(), PipelineLayoutCreateInfo{}};
+
+    Containers::Optional<Containers::Array<char>> data = Utility::Path::read(Utility::Path::join(VK_TEST_DIR, "compute-noop.spv"));
+    CORRADE_VERIFY(data);
+    Shader shader{device(), ShaderCreateInfo{*data}};
+
+    ShaderSet shaderSet;
+    shaderSet.addShader(ShaderStage::Compute, shader, "main"_s);
+
+    PipelineCache cache{device()};
+    {
+        Pipeline pipeline{device(), ComputePipelineCreateInfo{
+            shaderSet, pipelineLayout
+        }, cache};
+        CORRADE_VERIFY(pipeline.handle());
+        CORRADE_COMPARE(pipeline.handleFlags(), HandleFlag::DestroyOnDestruction);
+    }
+
+    /* Create a second pipeline from a cache populated from the saved data.
+       It's up to the driver whether it puts anything into the cache, so
+       verify just that it doesn't crash. */
+    Containers::Array<char> cacheData = cache.data();
+    PipelineCache cache2{device(), PipelineCacheCreateInfo{cacheData}};
+    Pipeline pipeline{device(), ComputePipelineCreateInfo{
+        shaderSet, pipelineLayout
+    }, cache2};
+    CORRADE_VERIFY(pipeline.handle());
+}
+
 void PipelineVkTest::constructMove() {
     RenderPass renderPass{device(), RenderPassCreateInfo{}
         .setAttachments({
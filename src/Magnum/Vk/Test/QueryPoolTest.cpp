@@ -0,0 +1,171 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <new>
+#include <sstream>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Vk/QueryPoolCreateInfo.h"
+
+namespace Magnum { namespace Vk { namespace Test { namespace {
+
+struct QueryPoolTest: TestSuite::Tester {
+    explicit QueryPoolTest();
+
+    void createInfoConstruct();
+    void createInfoConstructPipelineStatistics();
+    void createInfoConstructPipelineStatisticsType();
+    void createInfoConstructNoStatistics();
+    void createInfoConstructZeroCount();
+    void createInfoConstructNoInit();
+    void createInfoConstructFromVk();
+
+    void constructNoCreate();
+    void constructCopy();
+
+    void resultsInvalidSize();
+};
+
+QueryPoolTest::QueryPoolTest() {
+    addTests({&QueryPoolTest::createInfoConstruct,
+              &QueryPoolTest::createInfoConstructPipelineStatistics,
+              &QueryPoolTest::createInfoConstructPipelineStatisticsType,
+              &QueryPoolTest::createInfoConstructNoStatistics,
+              &QueryPoolTest::createInfoConstructZeroCount,
+              &QueryPoolTest::createInfoConstructNoInit,
+              &QueryPoolTest::createInfoConstructFromVk,
+
+              &QueryPoolTest::constructNoCreate,
+              &QueryPoolTest::constructCopy,
+
+              &QueryPoolTest::resultsInvalidSize});
+}
+
+void QueryPoolTest::createInfoConstruct() {
+    QueryPoolCreateInfo info{QueryType::Timestamp, 6};
+    CORRADE_COMPARE(info->sType, VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO);
+    CORRADE_VERIFY(!info->pNext);
+    CORRADE_COMPARE(info->flags, 0);
+    CORRADE_COMPARE(info->queryType, VK_QUERY_TYPE_TIMESTAMP);
+    CORRADE_COMPARE(info->queryCount, 6);
+    CORRADE_COMPARE(info->pipelineStatistics, 0);
+}
+
+void QueryPoolTest::createInfoConstructPipelineStatistics() {
+    QueryPoolCreateInfo info{QueryPipelineStatistic::ClippingInvocations|QueryPipelineStatistic::ClippingPrimitives, 3};
+    CORRADE_COMPARE(info->sType, VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO);
+    CORRADE_COMPARE(info->queryType, VK_QUERY_TYPE_PIPELINE_STATISTICS);
+    CORRADE_COMPARE(info->queryCount, 3);
+    CORRADE_COMPARE(info->pipelineStatistics, VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT|VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT);
+}
+
+void QueryPoolTest::createInfoConstructPipelineStatisticsType() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    QueryPoolCreateInfo{QueryType::PipelineStatistics, 3};
+    CORRADE_COMPARE(out.str(), "Vk::QueryPoolCreateInfo: use the QueryPipelineStatistics overload for pipeline statistics queries\n");
+}
+
+void QueryPoolTest::createInfoConstructNoStatistics() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    QueryPoolCreateInfo{QueryPipelineStatistics{}, 3};
+    CORRADE_COMPARE(out.str(), "Vk::QueryPoolCreateInfo: there has to be at least one pipeline statistic\n");
+}
+
+void QueryPoolTest::createInfoConstructZeroCount() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    QueryPoolCreateInfo{QueryType::Occlusion, 0};
+    QueryPoolCreateInfo{QueryPipelineStatistic::VertexShaderInvocations, 0};
+    CORRADE_COMPARE(out.str(),
+        "Vk::QueryPoolCreateInfo: there has to be at least one query\n"
+        "Vk::QueryPoolCreateInfo: there has to be at least one query\n");
+}
+
+void QueryPoolTest::createInfoConstructNoInit() {
+    QueryPoolCreateInfo info{NoInit};
+    info->sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2;
+    new(&info) QueryPoolCreateInfo{NoInit};
+    CORRADE_COMPARE(info->sType, VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2);
+
+    CORRADE_VERIFY(std::is_nothrow_constructible<QueryPoolCreateInfo, NoInitT>::value);
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<NoInitT, QueryPoolCreateInfo>::value);
+}
+
+void QueryPoolTest::createInfoConstructFromVk() {
+    VkQueryPoolCreateInfo vkInfo;
+    vkInfo.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2;
+
+    QueryPoolCreateInfo info{vkInfo};
+    CORRADE_COMPARE(info->sType, VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2);
+}
+
+void QueryPoolTest::constructNoCreate() {
+    {
+        QueryPool pool{NoCreate};
+        CORRADE_VERIFY(!pool.handle());
+    }
+
+    /* Implicit construction is not allowed */
+    CORRADE_VERIFY(!std::is_convertible<NoCreateT, QueryPool>::value);
+}
+
+void QueryPoolTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<QueryPool>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<QueryPool>{});
+}
+
+void QueryPoolTest::resultsInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    /* The assertion fires before the device is touched, so a NoCreate
+       instance is enough */
+    QueryPool pool{NoCreate};
+    UnsignedLong data[5];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    pool.results(0, 0, data);
+    pool.results(0, 2, data);
+    CORRADE_COMPARE(out.str(),
+        "Vk::QueryPool::results(): expected a non-zero query count and a data size divisible by it but got 0 queries and 5 values\n"
+        "Vk::QueryPool::results(): expected a non-zero query count and a data size divisible by it but got 2 queries and 5 values\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::QueryPoolTest)
@@ -28,6 +28,7 @@
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Vk/Device.h"
+#include "Magnum/Vk/Pipeline.h"
 #include "Magnum/Vk/Queue.h"
 
 namespace Magnum { namespace Vk { namespace Test { namespace {
@@ -44,6 +45,8 @@ struct QueueTest: TestSuite::Tester {
     void submitInfoConstruct();
     void submitInfoConstructNoInit();
     void submitInfoConstructCommandBuffers();
+    void submitInfoConstructSemaphores();
+    void submitInfoConstructTimelineSemaphores();
     void submitInfoConstructFromVk();
     void submitInfoConstructCopy();
     void submitInfoConstructMove();
@@ -59,6 +62,8 @@ QueueTest::QueueTest() {
               &QueueTest::submitInfoConstruct,
               &QueueTest::submitInfoConstructNoInit,
               &QueueTest::submitInfoConstructCommandBuffers,
+              &QueueTest::submitInfoConstructSemaphores,
+              &QueueTest::submitInfoConstructTimelineSemaphores,
               &QueueTest::submitInfoConstructFromVk,
               &QueueTest::submitInfoConstructCopy,
               &QueueTest::submitInfoConstructMove});
@@ -142,6 +147,83 @@ void QueueTest::submitInfoConstructCommandBuffers() {
     CORRADE_COMPARE(info->pCommandBuffers[1], reinterpret_cast<VkCommandBuffer>(reinterpret_cast<void*>(std::size_t{0xcafecafe})));
 }
 
+void QueueTest::submitInfoConstructSemaphores() {
+    /* The double reinterpret_cast is needed because the handle is an uint64_t
+       instead of a pointer on 32-bit builds and only this works on both */
+    auto a = reinterpret_cast<VkSemaphore>(reinterpret_cast<void*>(std::size_t{0xbadbeef}));
+    auto b = reinterpret_cast<VkSemaphore>(reinterpret_cast<void*>(std::size_t{0xcafecafe}));
+    auto c = reinterpret_cast<VkSemaphore>(reinterpret_cast<void*>(std::size_t{0xdeadbeef}));
+
+    SubmitInfo info;
+    info.setWaitSemaphores({
+            {a, PipelineStage::Transfer},
+            {b, PipelineStage::VertexInput|PipelineStage::ComputeShader}
+        })
+        .setSignalSemaphores({c});
+
+    CORRADE_COMPARE(info->waitSemaphoreCount, 2);
+    CORRADE_VERIFY(info->pWaitSemaphores);
+    CORRADE_COMPARE(info->pWaitSemaphores[0], a);
+    CORRADE_COMPARE(info->pWaitSemaphores[1], b);
+    CORRADE_VERIFY(info->pWaitDstStageMask);
+    CORRADE_COMPARE(info->pWaitDstStageMask[0], VK_PIPELINE_STAGE_TRANSFER_BIT);
+    CORRADE_COMPARE(info->pWaitDstStageMask[1], VK_PIPELINE_STAGE_VERTEX_INPUT_BIT|VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+    CORRADE_COMPARE(info->signalSemaphoreCount, 1);
+    CORRADE_VERIFY(info->pSignalSemaphores);
+    CORRADE_COMPARE(info->pSignalSemaphores[0], c);
+
+    /* No timeline info connected for binary semaphores */
+    CORRADE_VERIFY(!info->pNext);
+}
+
+void QueueTest::submitInfoConstructTimelineSemaphores() {
+    /* The double reinterpret_cast is needed because the handle is an uint64_t
+       instead of a pointer on 32-bit builds and only this works on both */
+    auto a = reinterpret_cast<VkSemaphore>(reinterpret_cast<void*>(std::size_t{0xbadbeef}));
+    auto b = reinterpret_cast<VkSemaphore>(reinterpret_cast<void*>(std::size_t{0xcafecafe}));
+    auto c = reinterpret_cast<VkSemaphore>(reinterpret_cast<void*>(std::size_t{0xdeadbeef}));
+
+    SubmitInfo info;
+    info.setWaitSemaphores({
+            {a, 15, PipelineStage::Transfer}
+        })
+        .setSignalSemaphores({{b, 16}, {c, 0}});
+
+    CORRADE_COMPARE(info->waitSemaphoreCount, 1);
+    CORRADE_VERIFY(info->pWaitSemaphores);
+    CORRADE_COMPARE(info->pWaitSemaphores[0], a);
+    CORRADE_VERIFY(info->pWaitDstStageMask);
+    CORRADE_COMPARE(info->pWaitDstStageMask[0], VK_PIPELINE_STAGE_TRANSFER_BIT);
+    CORRADE_COMPARE(info->signalSemaphoreCount, 2);
+    CORRADE_VERIFY(info->pSignalSemaphores);
+    CORRADE_COMPARE(info->pSignalSemaphores[0], b);
+    CORRADE_COMPARE(info->pSignalSemaphores[1], c);
+
+    /* The timeline info is connected just once */
+    CORRADE_VERIFY(info->pNext);
+    const auto& timelineInfo = *static_cast<const VkTimelineSemaphoreSubmitInfo*>(info->pNext);
+    CORRADE_COMPARE(timelineInfo.sType, VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO);
+    CORRADE_VERIFY(!timelineInfo.pNext);
+    CORRADE_COMPARE(timelineInfo.waitSemaphoreValueCount, 1);
+    CORRADE_VERIFY(timelineInfo.pWaitSemaphoreValues);
+    CORRADE_COMPARE(timelineInfo.pWaitSemaphoreValues[0], 15);
+    CORRADE_COMPARE(timelineInfo.signalSemaphoreValueCount, 2);
+    CORRADE_VERIFY(timelineInfo.pSignalSemaphoreValues);
+    CORRADE_COMPARE(timelineInfo.pSignalSemaphoreValues[0], 16);
+    CORRADE_COMPARE(timelineInfo.pSignalSemaphoreValues[1], 0);
+
+    /* Setting binary semaphores afterwards keeps the value count in sync */
+    info.setWaitSemaphores({
+        {b, PipelineStage::Transfer},
+        {c, PipelineStage::Transfer}
+    });
+    CORRADE_COMPARE(info->waitSemaphoreCount, 2);
+    CORRADE_COMPARE(timelineInfo.waitSemaphoreValueCount, 2);
+    CORRADE_VERIFY(timelineInfo.pWaitSemaphoreValues);
+    CORRADE_COMPARE(timelineInfo.pWaitSemaphoreValues[0], 0);
+    CORRADE_COMPARE(timelineInfo.pWaitSemaphoreValues[1], 0);
+}
+
 void QueueTest::submitInfoConstructFromVk() {
     VkSubmitInfo vkInfo;
     vkInfo.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2;
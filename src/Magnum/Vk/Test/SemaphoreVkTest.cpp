@@ -0,0 +1,271 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/Vk/CommandBuffer.h"
+#include "Magnum/Vk/CommandPoolCreateInfo.h"
+#include "Magnum/Vk/DeviceCreateInfo.h"
+#include "Magnum/Vk/DeviceFeatures.h"
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/Fence.h"
+#include "Magnum/Vk/Pipeline.h"
+#include "Magnum/Vk/Queue.h"
+#include "Magnum/Vk/Result.h"
+#include "Magnum/Vk/SemaphoreCreateInfo.h"
+#include "Magnum/Vk/VulkanTester.h"
+
+namespace Magnum { namespace Vk { namespace Test { namespace {
+
+struct SemaphoreVkTest: VulkanTester {
+    explicit SemaphoreVkTest();
+
+    void construct();
+    void constructTimeline();
+    void constructTimelineNotEnabled();
+    void constructMove();
+
+    void wrap();
+
+    void signal();
+    void wait100ms();
+    void wait();
+
+    void submitBinary();
+    void submitTimeline();
+
+    private:
+        /* Device with the TimelineSemaphore feature enabled, created lazily
+           only if the feature is supported */
+        Device& timelineDevice();
+
+        Queue _timelineQueue{NoCreate};
+        Containers::Optional<Device> _timelineDevice;
+};
+
+SemaphoreVkTest::SemaphoreVkTest() {
+    addTests({&SemaphoreVkTest::construct,
+              &SemaphoreVkTest::constructTimeline,
+              &SemaphoreVkTest::constructTimelineNotEnabled,
+              &SemaphoreVkTest::constructMove,
+
+              &SemaphoreVkTest::wrap,
+
+              &SemaphoreVkTest::signal});
+
+    addBenchmarks({&SemaphoreVkTest::wait100ms}, 1);
+
+    addTests({&SemaphoreVkTest::wait,
+
+              &SemaphoreVkTest::submitBinary,
+              &SemaphoreVkTest::submitTimeline});
+}
+
+Device& SemaphoreVkTest::timelineDevice() {
+    if(!_timelineDevice) _timelineDevice.emplace(instance(),
+        DeviceCreateInfo{device().properties()}
+            .addQueues(device().properties().pickQueueFamily(QueueFlag::Graphics), {0.0f}, {_timelineQueue})
+            .setEnabledFeatures(DeviceFeature::TimelineSemaphore));
+    return *_timelineDevice;
+}
+
+void SemaphoreVkTest::construct() {
+    {
+        Semaphore semaphore{device()};
+        CORRADE_VERIFY(semaphore.handle());
+        CORRADE_COMPARE(semaphore.handleFlags(), HandleFlag::DestroyOnDestruction);
+    }
+
+    /* Shouldn't crash or anything */
+    CORRADE_VERIFY(true);
+}
+
+void SemaphoreVkTest::constructTimeline() {
+    if(!(device().properties().features() & DeviceFeature::TimelineSemaphore))
+        CORRADE_SKIP("TimelineSemaphore feature not supported, can't test.");
+
+    {
+        Semaphore semaphore{timelineDevice(), SemaphoreCreateInfo{SemaphoreType::Timeline, 37}};
+        CORRADE_VERIFY(semaphore.handle());
+        CORRADE_COMPARE(semaphore.handleFlags(), HandleFlag::DestroyOnDestruction);
+        CORRADE_COMPARE(semaphore.value(), 37);
+    }
+
+    /* Shouldn't crash or anything */
+    CORRADE_VERIFY(true);
+}
+
+void SemaphoreVkTest::constructTimelineNotEnabled() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    if(device().enabledFeatures() & DeviceFeature::TimelineSemaphore)
+        CORRADE_SKIP("TimelineSemaphore feature enabled on the default device, can't test.");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Semaphore{device(), SemaphoreCreateInfo{SemaphoreType::Timeline}};
+    CORRADE_COMPARE(out.str(), "Vk::Semaphore: timeline semaphores not enabled on the device\n");
+}
+
+void SemaphoreVkTest::constructMove() {
+    Semaphore a{device()};
+    VkSemaphore handle = a.handle();
+
+    Semaphore b = Utility::move(a);
+    CORRADE_VERIFY(!a.handle());
+    CORRADE_COMPARE(b.handle(), handle);
+    CORRADE_COMPARE(b.handleFlags(), HandleFlag::DestroyOnDestruction);
+
+    Semaphore c{NoCreate};
+    c = Utility::move(b);
+    CORRADE_VERIFY(!b.handle());
+    CORRADE_COMPARE(b.handleFlags(), HandleFlags{});
+    CORRADE_COMPARE(c.handle(), handle);
+    CORRADE_COMPARE(c.handleFlags(), HandleFlag::DestroyOnDestruction);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<Semaphore>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<Semaphore>::value);
+}
+
+void SemaphoreVkTest::wrap() {
+    VkSemaphore semaphore{};
+    CORRADE_COMPARE(Result(device()->CreateSemaphore(device(),
+        SemaphoreCreateInfo{},
+        nullptr, &semaphore)), Result::Success);
+
+    auto wrapped = Semaphore::wrap(device(), semaphore, HandleFlag::DestroyOnDestruction);
+    CORRADE_COMPARE(wrapped.handle(), semaphore);
+
+    /* Release the handle again, destroy by hand */
+    CORRADE_COMPARE(wrapped.release(), semaphore);
+    CORRADE_VERIFY(!wrapped.handle());
+    device()->DestroySemaphore(device(), semaphore, nullptr);
+}
+
+void SemaphoreVkTest::signal() {
+    if(!(device().properties().features() & DeviceFeature::TimelineSemaphore))
+        CORRADE_SKIP("TimelineSemaphore feature not supported, can't test.");
+
+    Semaphore a{timelineDevice(), SemaphoreCreateInfo{SemaphoreType::Timeline}};
+    CORRADE_COMPARE(a.value(), 0);
+
+    a.signal(15);
+    CORRADE_COMPARE(a.value(), 15);
+}
+
+void SemaphoreVkTest::wait100ms() {
+    if(!(device().properties().features() & DeviceFeature::TimelineSemaphore))
+        CORRADE_SKIP("TimelineSemaphore feature not supported, can't test.");
+
+    Semaphore a{timelineDevice(), SemaphoreCreateInfo{SemaphoreType::Timeline}};
+
+    /* A benchmark so we have at least some verification we're not terribly off
+       with the units */
+    CORRADE_BENCHMARK(1)
+        CORRADE_VERIFY(!a.wait(1, std::chrono::milliseconds{100}));
+
+    CORRADE_COMPARE(a.value(), 0);
+}
+
+void SemaphoreVkTest::wait() {
+    if(!(device().properties().features() & DeviceFeature::TimelineSemaphore))
+        CORRADE_SKIP("TimelineSemaphore feature not supported, can't test.");
+
+    Semaphore a{timelineDevice(), SemaphoreCreateInfo{SemaphoreType::Timeline, 3}};
+
+    /* Waiting for a value that was already reached returns immediately */
+    CORRADE_VERIFY(a.wait(2, std::chrono::milliseconds{1000}));
+    a.wait(3);
+    CORRADE_COMPARE(a.value(), 3);
+}
+
+void SemaphoreVkTest::submitBinary() {
+    CommandPool pool{device(), CommandPoolCreateInfo{
+        device().properties().pickQueueFamily(QueueFlag::Graphics)}};
+
+    CommandBuffer a = pool.allocate();
+    a.begin()
+     .end();
+
+    CommandBuffer b = pool.allocate();
+    b.begin()
+     .end();
+
+    /* The second submit waits on the semaphore signaled by the first */
+    Semaphore semaphore{device()};
+    Fence fence{device()};
+    queue().submit({
+        SubmitInfo{}
+            .setCommandBuffers({a})
+            .setSignalSemaphores({semaphore}),
+        SubmitInfo{}
+            .setWaitSemaphores({{semaphore, PipelineStage::TopOfPipe}})
+            .setCommandBuffers({b})
+    }, fence);
+
+    CORRADE_VERIFY(fence.wait(std::chrono::milliseconds{1000}));
+}
+
+void SemaphoreVkTest::submitTimeline() {
+    if(!(device().properties().features() & DeviceFeature::TimelineSemaphore))
+        CORRADE_SKIP("TimelineSemaphore feature not supported, can't test.");
+
+    Device& device2 = timelineDevice();
+    CommandPool pool{device2, CommandPoolCreateInfo{
+        device().properties().pickQueueFamily(QueueFlag::Graphics)}};
+
+    CommandBuffer a = pool.allocate();
+    a.begin()
+     .end();
+
+    CommandBuffer b = pool.allocate();
+    b.begin()
+     .end();
+
+    /* The second submit waits on value 5 signaled by the first and then
+       signals 6 */
+    Semaphore semaphore{device2, SemaphoreCreateInfo{SemaphoreType::Timeline}};
+    Fence fence{device2};
+    _timelineQueue.submit({
+        SubmitInfo{}
+            .setCommandBuffers({a})
+            .setSignalSemaphores({{semaphore, 5}}),
+        SubmitInfo{}
+            .setWaitSemaphores({{semaphore, 5, PipelineStage::TopOfPipe}})
+            .setCommandBuffers({b})
+            .setSignalSemaphores({{semaphore, 6}})
+    }, fence);
+
+    CORRADE_VERIFY(semaphore.wait(6, std::chrono::milliseconds{1000}));
+    CORRADE_COMPARE(semaphore.value(), 6);
+    CORRADE_VERIFY(fence.wait(std::chrono::milliseconds{1000}));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::SemaphoreVkTest)
@@ -0,0 +1,270 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Vk/BufferCreateInfo.h"
+#include "Magnum/Vk/CommandBuffer.h"
+#include "Magnum/Vk/CommandPoolCreateInfo.h"
+#include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/Fence.h"
+#include "Magnum/Vk/ImageCreateInfo.h"
+#include "Magnum/Vk/Memory.h"
+#include "Magnum/Vk/Pipeline.h"
+#include "Magnum/Vk/PixelFormat.h"
+#include "Magnum/Vk/StagingUploader.h"
+#include "Magnum/Vk/VulkanTester.h"
+
+namespace Magnum { namespace Vk { namespace Test { namespace {
+
+struct StagingUploaderVkTest: VulkanTester {
+    explicit StagingUploaderVkTest();
+
+    void construct();
+    void constructZeroSize();
+    void constructMove();
+
+    void uploadBuffer();
+    void uploadBufferLargerThanStaging();
+    void uploadBufferWrapAround();
+    void uploadImage2D();
+
+    void submitNothing();
+    void submitWait();
+};
+
+StagingUploaderVkTest::StagingUploaderVkTest() {
+    addTests({&StagingUploaderVkTest::construct,
+              &StagingUploaderVkTest::constructZeroSize,
+              &StagingUploaderVkTest::constructMove,
+
+              &StagingUploaderVkTest::uploadBuffer,
+              &StagingUploaderVkTest::uploadBufferLargerThanStaging,
+              &StagingUploaderVkTest::uploadBufferWrapAround,
+              &StagingUploaderVkTest::uploadImage2D,
+
+              &StagingUploaderVkTest::submitNothing,
+              &StagingUploaderVkTest::submitWait});
+}
+
+void StagingUploaderVkTest::construct() {
+    {
+        StagingUploader uploader{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 1024};
+        CORRADE_COMPARE(&uploader.device(), &device());
+        CORRADE_COMPARE(uploader.size(), 1024);
+        CORRADE_COMPARE(uploader.pendingSize(), 0);
+    }
+
+    /* Shouldn't crash or anything */
+    CORRADE_VERIFY(true);
+}
+
+void StagingUploaderVkTest::constructZeroSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    StagingUploader{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 0};
+    CORRADE_COMPARE(out.str(), "Vk::StagingUploader: expected non-zero staging buffer size\n");
+}
+
+void StagingUploaderVkTest::constructMove() {
+    StagingUploader a{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 1024};
+
+    StagingUploader b = Utility::move(a);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(b.size(), 1024);
+
+    StagingUploader c{NoCreate};
+    c = Utility::move(b);
+    CORRADE_COMPARE(b.size(), 0);
+    CORRADE_COMPARE(c.size(), 1024);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<StagingUploader>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<StagingUploader>::value);
+}
+
+void StagingUploaderVkTest::uploadBuffer() {
+    StagingUploader uploader{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 1024};
+
+    Buffer buffer{device(), BufferCreateInfo{
+        BufferUsage::TransferDestination, 16
+    }, MemoryFlag::HostVisible|MemoryFlag::HostCoherent};
+
+    const UnsignedInt a[]{0xdeadbeef, 0xcafebabe};
+    const UnsignedInt b[]{0x1337f00d};
+    uploader
+        .upload(buffer, 0, a)
+        .upload(buffer, 12, b);
+    CORRADE_COMPARE(uploader.pendingSize(), 12);
+
+    UnsignedLong id = uploader.submit();
+    CORRADE_COMPARE(id, 1);
+    CORRADE_COMPARE(uploader.pendingSize(), 0);
+    uploader.wait(id);
+    CORRADE_VERIFY(uploader.isComplete(id));
+
+    Containers::Array<const char, MemoryMapDeleter> data = buffer.dedicatedMemory().mapRead();
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedInt>(data.prefix(8)),
+        Containers::arrayView(a),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedInt>(data.exceptPrefix(12)),
+        Containers::arrayView(b),
+        TestSuite::Compare::Container);
+}
+
+void StagingUploaderVkTest::uploadBufferLargerThanStaging() {
+    StagingUploader uploader{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 64};
+
+    Buffer buffer{device(), BufferCreateInfo{
+        BufferUsage::TransferDestination, 1000*4
+    }, MemoryFlag::HostVisible|MemoryFlag::HostCoherent};
+
+    Containers::Array<UnsignedInt> data{NoInit, 1000};
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = i*3;
+
+    /* The upload gets split into chunks, some of which get submitted
+       implicitly */
+    uploader.upload(buffer, 0, data);
+    CORRADE_COMPARE_AS(uploader.pendingSize(), 64,
+        TestSuite::Compare::LessOrEqual);
+    uploader.finish();
+
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedInt>(buffer.dedicatedMemory().mapRead()),
+        data,
+        TestSuite::Compare::Container);
+}
+
+void StagingUploaderVkTest::uploadBufferWrapAround() {
+    StagingUploader uploader{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 64};
+
+    Buffer buffer{device(), BufferCreateInfo{
+        BufferUsage::TransferDestination, 4*40
+    }, MemoryFlag::HostVisible|MemoryFlag::HostCoherent};
+
+    /* Each upload is 40 bytes, so the second one doesn't fit after the first
+       and has to either wrap around or wait for the first batch to finish */
+    UnsignedInt data[40];
+    for(UnsignedInt i = 0; i != 40; ++i) data[i] = 0xff000000 + i;
+    for(std::size_t i = 0; i != 4; ++i) {
+        uploader.upload(buffer, i*40, Containers::arrayView(data).sliceSize(i*10, 10));
+        uploader.submit();
+    }
+    uploader.finish();
+
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedInt>(buffer.dedicatedMemory().mapRead()),
+        Containers::arrayView(data),
+        TestSuite::Compare::Container);
+}
+
+void StagingUploaderVkTest::uploadImage2D() {
+    StagingUploader uploader{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 1024};
+
+    Image image{device(), ImageCreateInfo2D{
+        ImageUsage::TransferDestination|ImageUsage::TransferSource,
+        PixelFormat::RGBA8Unorm, {4, 2}, 1
+    }, MemoryFlag::DeviceLocal};
+
+    const UnsignedByte pixels[]{
+        0x00, 0x01, 0x02, 0x03, 0x10, 0x11, 0x12, 0x13,
+        0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x33,
+        0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x53,
+        0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x73
+    };
+    uploader.upload(image, 0, ImageView2D{Magnum::PixelFormat::RGBA8Unorm, {4, 2}, pixels}, ImageLayout::TransferSource);
+    uploader.finish();
+
+    /* Verify through a buffer copy */
+    Buffer buffer{device(), BufferCreateInfo{
+        BufferUsage::TransferDestination, 4*2*4
+    }, MemoryFlag::HostVisible};
+
+    CommandPool pool{device(), CommandPoolCreateInfo{
+        device().properties().pickQueueFamily(QueueFlag::Graphics)}};
+    CommandBuffer cmd = pool.allocate();
+    cmd.begin()
+       .copyImageToBuffer(CopyImageToBufferInfo2D{image, ImageLayout::TransferSource, buffer, {
+           {0, ImageAspect::Color, 0, {{}, {4, 2}}}
+        }})
+       .pipelineBarrier(PipelineStage::Transfer, PipelineStage::Host, {
+           {Access::TransferWrite, Access::HostRead}
+        })
+       .end();
+    queue().submit({SubmitInfo{}.setCommandBuffers({cmd})}).wait();
+
+    CORRADE_COMPARE_AS(Containers::arrayCast<const UnsignedByte>(buffer.dedicatedMemory().mapRead()),
+        Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
+void StagingUploaderVkTest::submitNothing() {
+    StagingUploader uploader{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 1024};
+
+    /* Nothing submitted yet, ID 0 is always complete */
+    CORRADE_COMPARE(uploader.submit(), 0);
+    CORRADE_VERIFY(uploader.isComplete(0));
+    uploader.wait(0);
+    uploader.finish();
+}
+
+void StagingUploaderVkTest::submitWait() {
+    StagingUploader uploader{device(), queue(), device().properties().pickQueueFamily(QueueFlag::Graphics), 1024};
+
+    Buffer buffer{device(), BufferCreateInfo{
+        BufferUsage::TransferDestination, 16
+    }, MemoryFlag::DeviceLocal};
+
+    const Float data[]{1.0f, 2.0f, 3.0f, 4.0f};
+
+    uploader.upload(buffer, 0, data);
+    UnsignedLong a = uploader.submit();
+    CORRADE_COMPARE(a, 1);
+
+    /* Submitting again with nothing recorded returns the previous ID */
+    CORRADE_COMPARE(uploader.submit(), 1);
+
+    uploader.upload(buffer, 0, data);
+    UnsignedLong b = uploader.submit();
+    CORRADE_COMPARE(b, 2);
+
+    /* Waiting for the later batch implies the earlier one is complete as
+       well */
+    uploader.wait(b);
+    CORRADE_VERIFY(uploader.isComplete(a));
+    CORRADE_VERIFY(uploader.isComplete(b));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Vk::Test::StagingUploaderVkTest)
@@ -105,6 +105,8 @@ Debug& operator<<(Debug& debug, const VertexFormat value) {
         _c(Vector4sNormalized)
         _c(Vector4ui)
         _c(Vector4i)
+        _c(Vector4i1010102Normalized)
+        _c(Vector4ui1010102Normalized)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -322,6 +322,24 @@ enum class VertexFormat: Int {
 
     /** @ref Magnum::Vector4i "Vector4i" */
     Vector4i = VK_FORMAT_R32G32B32A32_SINT,
+
+    /**
+     * Four signed components packed into a 32-bit integer, with three 10-bit
+     * components in range @f$ [-511, 511] @f$ and a 2-bit component in range
+     * @f$ [-1, 1] @f$ interpreted as @f$ [-1.0, 1.0] @f$. The first
+     * component is in the lowest bits.
+     * @m_since_latest
+     */
+    Vector4i1010102Normalized = VK_FORMAT_A2B10G10R10_SNORM_PACK32,
+
+    /**
+     * Four unsigned components packed into a 32-bit integer, with three
+     * 10-bit components in range @f$ [0, 1023] @f$ and a 2-bit component in
+     * range @f$ [0, 3] @f$ interpreted as @f$ [0.0, 1.0] @f$. The first
+     * component is in the lowest bits.
+     * @m_since_latest
+     */
+    Vector4ui1010102Normalized = VK_FORMAT_A2B10G10R10_UNORM_PACK32,
 };
 
 /**
@@ -46,6 +46,7 @@ class CommandBuffer;
 /* CommandBufferBeginInfo is useful only in combination with CommandBuffer */
 class CommandPool;
 class CommandPoolCreateInfo;
+enum class CompareOperation: Int;
 class ComputePipelineCreateInfo;
 /* BufferCopy used only directly inside CopyBufferInfo */
 class CopyBufferInfo;
@@ -56,8 +57,10 @@ class CopyImageInfo;
 class CopyBufferToImageInfo;
 class CopyImageToBufferInfo;
 /* Not forward-declaring CopyBufferToImageInfo1D etc right now, I see no need */
+enum class CullMode: UnsignedInt;
 enum class DependencyFlag: UnsignedInt;
 typedef Containers::EnumSet<DependencyFlag> DependencyFlags;
+class DescriptorAllocator;
 class DescriptorPool;
 class DescriptorPoolCreateInfo;
 class DescriptorSet;
@@ -76,8 +79,10 @@ class Extension;
 class ExtensionProperties;
 class Fence;
 class FenceCreateInfo;
+class FrameCommandPools;
 class Framebuffer;
 class FramebufferCreateInfo;
+enum class FrontFace: Int;
 enum class HandleFlag: UnsignedByte;
 typedef Containers::EnumSet<HandleFlag> HandleFlags;
 class Image;
@@ -97,6 +102,10 @@ class InstanceExtensionProperties;
 class LayerProperties;
 class Memory;
 class MemoryAllocateInfo;
+class MemoryAllocation;
+enum class MemoryAllocationFlag: UnsignedByte;
+typedef Containers::EnumSet<MemoryAllocationFlag> MemoryAllocationFlags;
+class MemoryAllocator;
 class MemoryBarrier;
 class MemoryMapDeleter;
 class MemoryRequirements;
@@ -110,11 +119,22 @@ class MeshLayout;
 enum class MeshPrimitive: Int;
 class Pipeline;
 enum class PipelineBindPoint: Int;
+class PipelineCache;
+class PipelineCacheCreateInfo;
 class PipelineLayout;
 class PipelineLayoutCreateInfo;
 enum class PipelineStage: UnsignedInt;
 typedef Containers::EnumSet<PipelineStage> PipelineStages;
 enum class PixelFormat: Int;
+enum class QueryControlFlag: UnsignedInt;
+typedef Containers::EnumSet<QueryControlFlag> QueryControlFlags;
+enum class QueryPipelineStatistic: UnsignedInt;
+typedef Containers::EnumSet<QueryPipelineStatistic> QueryPipelineStatistics;
+class QueryPool;
+class QueryPoolCreateInfo;
+enum class QueryResultFlag: UnsignedInt;
+typedef Containers::EnumSet<QueryResultFlag> QueryResultFlags;
+enum class QueryType: Int;
 class Queue;
 enum class QueueFlag: UnsignedInt;
 typedef Containers::EnumSet<QueueFlag> QueueFlags;
@@ -131,6 +151,9 @@ class SamplerCreateInfo;
 enum class SamplerFilter: Int;
 enum class SamplerMipmap: Int;
 enum class SamplerWrapping: Int;
+class Semaphore;
+class SemaphoreCreateInfo;
+enum class SemaphoreType: Int;
 class Shader;
 class ShaderCreateInfo;
 class ShaderSet;
@@ -140,6 +163,10 @@ enum class ShaderStage: UnsignedInt;
    Vulkan headers. Using a number here and then the actual enum value in
    Shader.h to ensure it doesn't get out of sync. */
 typedef Containers::EnumSet<ShaderStage, 0x7FFFFFFF> ShaderStages;
+class StagingUploader;
+enum class StencilFace: UnsignedInt;
+typedef Containers::EnumSet<StencilFace> StencilFaces;
+enum class StencilOperation: Int;
 class SubmitInfo;
 class SubpassBeginInfo;
 class SubpassEndInfo;
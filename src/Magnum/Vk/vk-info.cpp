@@ -24,10 +24,13 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <chrono>
 #include <Corrade/Cpu.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Utility/Arguments.h>
 
+#include "Magnum/Vk/Device.h"
+#include "Magnum/Vk/DeviceCreateInfo.h"
 #include "Magnum/Vk/DeviceFeatures.h"
 #include "Magnum/Vk/Extensions.h"
 #include "Magnum/Vk/ExtensionProperties.h"
@@ -35,6 +38,7 @@
 #include "Magnum/Vk/LayerProperties.h"
 #include "Magnum/Vk/Memory.h"
 #include "Magnum/Vk/DeviceProperties.h"
+#include "Magnum/Vk/Queue.h"
 #include "Magnum/Vk/Version.h"
 
 namespace Magnum {
@@ -63,7 +67,7 @@ See @ref building, @ref cmake and the @ref Vk namespace for more information.
 
 @code{.sh}
 magnum-vk-info [--magnum-...] [-h|--help] [--extension-strings]
-    [--all-extensions] [--features]
+    [--all-extensions] [--features] [--timing]
 @endcode
 
 Arguments:
@@ -72,6 +76,9 @@ Arguments:
 -   `--extension-strings` --- list all extension strings provided by the driver
 -   `--all-extensions` --- display extensions also for fully supported versions
 -   `--features` -- display also features supported by the device
+-   `--timing` -- measure how long it takes to create an instance, enumerate
+    devices and create a device with a single graphics queue, and display it
+    at the end
 -   `--magnum-...` --- engine-specific options (see
     @ref Vk-Instance-command-line for details)
 
@@ -142,6 +149,7 @@ int main(int argc, char** argv) {
     args.addBooleanOption("extension-strings").setHelp("extension-strings", "list all extension strings provided by the driver")
         .addBooleanOption("all-extensions").setHelp("all-extensions", "display extensions also for fully supported versions")
         .addBooleanOption("features").setHelp("features", "display also features supported by the device")
+        .addBooleanOption("timing").setHelp("timing", "measure and display instance and device creation time")
         .addSkippedPrefix("magnum", "engine-specific options")
         .setGlobalHelp("Displays information about Magnum engine and Vulkan capabilities.")
         .parse(argc, argv);
@@ -316,10 +324,18 @@ int main(int argc, char** argv) {
 
     Debug{} << "";
 
+    /* The instance creation info is set up above already, so this doesn't
+       include the layer and extension enumeration. Which is fine, as that's
+       needed for the info printed above anyway. */
+    std::chrono::steady_clock::time_point timestamp = std::chrono::steady_clock::now();
     Vk::Instance instance{instanceCreateInfo};
+    const std::chrono::steady_clock::duration instanceCreationTime = std::chrono::steady_clock::now() - timestamp;
 
+    std::chrono::steady_clock::duration deviceEnumerationTime;
     {
+        timestamp = std::chrono::steady_clock::now();
         Containers::Array<Vk::DeviceProperties> devices = Vk::enumerateDevices(instance);
+        deviceEnumerationTime = std::chrono::steady_clock::now() - timestamp;
         Debug{} << "Found" << devices.size() << "devices:";
         for(Vk::DeviceProperties& device: devices) {
             Debug{} << "   " << device.name() << Debug::nospace << ","
@@ -455,4 +471,24 @@ int main(int argc, char** argv) {
         Debug{} << "   " << i << Debug::nospace << ":" << device.memoryFlags(i);
         Debug{} << "      heap index:" << device.memoryHeapIndex(i);
     }
+
+    if(args.isSet("timing")) {
+        /* Everything on the device was queried above already, so this
+           measures the creation alone. The device prints its own startup log,
+           which can be silenced with --magnum-log quiet. */
+        Debug{} << "";
+        timestamp = std::chrono::steady_clock::now();
+        {
+            Vk::Queue queue{NoCreate};
+            Vk::Device timedDevice{instance, Vk::DeviceCreateInfo{device}
+                .addQueues(Vk::QueueFlag::Graphics, {0.0f}, {queue})};
+        }
+        const std::chrono::steady_clock::duration deviceCreationTime = std::chrono::steady_clock::now() - timestamp;
+
+        Debug{} << "";
+        Debug{} << "Timing:";
+        Debug{} << "    instance creation:" << std::chrono::duration<Double, std::milli>(instanceCreationTime).count() << "ms";
+        Debug{} << "    device enumeration:" << std::chrono::duration<Double, std::milli>(deviceEnumerationTime).count() << "ms";
+        Debug{} << "    device creation and destruction:" << std::chrono::duration<Double, std::milli>(deviceCreationTime).count() << "ms";
+    }
 }
@@ -58,7 +58,59 @@ ImporterFeatures AnyImageImporter::doFeatures() const {
 bool AnyImageImporter::doIsOpened() const { return !!_in; }
 
 void AnyImageImporter::doClose() {
-    _in = nullptr;
+    /* If reuse is enabled, close the concrete importer but keep it for the
+       next open with the same plugin */
+    if(configuration().value<bool>("reuseImporter")) {
+        _in->close();
+        _cached = Utility::move(_in);
+    } else _in = nullptr;
+}
+
+Containers::Pointer<AbstractImporter> AnyImageImporter::instantiate(const char* const messagePrefix, const Containers::StringView plugin, const bool propagateFileCallback) {
+    Containers::Pointer<AbstractImporter> importer;
+
+    /* Reuse the previous instance if it's of the same plugin. Otherwise drop
+       it, only one instance is kept. */
+    const bool reuse = configuration().value<bool>("reuseImporter");
+    if(reuse && _cached && _cachedPlugin == plugin) {
+        if(flags() & ImporterFlag::Verbose)
+            Debug{} << messagePrefix << "reusing" << plugin;
+        importer = Utility::move(_cached);
+
+    } else {
+        _cached = nullptr;
+
+        /* Try to load the plugin */
+        if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
+            Error{} << messagePrefix << "cannot load the" << plugin << "plugin";
+            return {};
+        }
+
+        const PluginManager::PluginMetadata* const metadata = manager()->metadata(plugin);
+        CORRADE_INTERNAL_ASSERT(metadata);
+        if(flags() & ImporterFlag::Verbose) {
+            Debug d;
+            d << messagePrefix << "using" << plugin;
+            if(plugin != metadata->name())
+                d << "(provided by" << metadata->name() << Debug::nospace << ")";
+        }
+
+        importer = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
+        _cachedPlugin = plugin;
+    }
+
+    /* Propagate flags and the file callback, if set. If a reused instance
+       had a callback set before and now it shouldn't, reset it. */
+    importer->setFlags(flags());
+    if(propagateFileCallback && fileCallback())
+        importer->setFileCallback(fileCallback(), fileCallbackUserData());
+    else if(importer->fileCallback())
+        importer->setFileCallback(nullptr);
+
+    /* Propagate configuration, except for options of this plugin */
+    Magnum::Implementation::propagateConfiguration(messagePrefix, {}, importer->metadata()->name(), configuration(), importer->configuration(), {"reuseImporter"_s}, !(flags() & ImporterFlag::Quiet));
+
+    return importer;
 }
 
 void AnyImageImporter::doOpenFile(const Containers::StringView filename) {
@@ -158,32 +210,17 @@ void AnyImageImporter::doOpenFile(const Containers::StringView filename) {
         return;
     }
 
-    /* Try to load the plugin */
-    if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
-        Error{} << "Trade::AnyImageImporter::openFile(): cannot load the" << plugin << "plugin";
-        return;
-    }
-
-    const PluginManager::PluginMetadata* const metadata = manager()->metadata(plugin);
-    CORRADE_INTERNAL_ASSERT(metadata);
-    if(flags() & ImporterFlag::Verbose) {
-        Debug d;
-        d << "Trade::AnyImageImporter::openFile(): using" << plugin;
-        if(plugin != metadata->name())
-            d << "(provided by" << metadata->name() << Debug::nospace << ")";
-    }
-
-    /* Instantiate the plugin, propagate flags and the file callback, if set */
-    Containers::Pointer<AbstractImporter> importer = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
-    importer->setFlags(flags());
-    if(fileCallback()) importer->setFileCallback(fileCallback(), fileCallbackUserData());
-
-    /* Propagate configuration */
-    Magnum::Implementation::propagateConfiguration("Trade::AnyImageImporter::openFile():", {}, metadata->name(), configuration(), importer->configuration(), !(flags() & ImporterFlag::Quiet));
+    /* Get a concrete importer instance, either a new or a reused one */
+    Containers::Pointer<AbstractImporter> importer = instantiate("Trade::AnyImageImporter::openFile():", plugin, true);
+    if(!importer) return;
 
     /* Try to open the file (error output should be printed by the plugin
-       itself) */
-    if(!importer->openFile(filename)) return;
+       itself). If that fails, keep the instance for reuse anyway. */
+    if(!importer->openFile(filename)) {
+        if(configuration().value<bool>("reuseImporter"))
+            _cached = Utility::move(importer);
+        return;
+    }
 
     /* Success, save the instance */
     _in = Utility::move(importer);
@@ -291,34 +328,21 @@ void AnyImageImporter::doOpenData(Containers::Array<char>&& data, DataFlags) {
         return;
     }
 
-    /* Try to load the plugin */
-    if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
-        Error{} << "Trade::AnyImageImporter::openData(): cannot load the" << plugin << "plugin";
-        return;
-    }
-
-    const PluginManager::PluginMetadata* const metadata = manager()->metadata(plugin);
-    CORRADE_INTERNAL_ASSERT(metadata);
-    if(flags() & ImporterFlag::Verbose) {
-        Debug d;
-        d << "Trade::AnyImageImporter::openData(): using" << plugin;
-        if(plugin != metadata->name())
-            d << "(provided by" << metadata->name() << Debug::nospace << ")";
-    }
-
-    /* Instantiate the plugin, propagate flags. File callbacks not propagated
-       here as no image importers currently load any extra files. */
+    /* Get a concrete importer instance, either a new or a reused one. File
+       callbacks not propagated here as no image importers currently load any
+       extra files. */
     /** @todo revisit callbacks when that becomes true (such as loading XMP
         files accompanying RAWs) */
-    Containers::Pointer<AbstractImporter> importer = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
-    importer->setFlags(flags());
-
-    /* Propagate configuration */
-    Magnum::Implementation::propagateConfiguration("Trade::AnyImageImporter::openData():", {}, metadata->name(), configuration(), importer->configuration(), !(flags() & ImporterFlag::Quiet));
+    Containers::Pointer<AbstractImporter> importer = instantiate("Trade::AnyImageImporter::openData():", plugin, false);
+    if(!importer) return;
 
     /* Try to open the file (error output should be printed by the plugin
-       itself) */
-    if(!importer->openData(data)) return;
+       itself). If that fails, keep the instance for reuse anyway. */
+    if(!importer->openData(data)) {
+        if(configuration().value<bool>("reuseImporter"))
+            _cached = Utility::move(importer);
+        return;
+    }
 
     /* Success, save the instance */
     _in = Utility::move(importer);
@@ -65,6 +65,9 @@ struct AnyImageImporterTest: TestSuite::Tester {
        plugins have configuration subgroups as well */
     void propagateFileCallback();
 
+    void reuseImporter();
+    void reuseImporterDifferentPlugin();
+
     void images1D();
     void images2D();
     void images3D();
@@ -218,7 +221,12 @@ AnyImageImporterTest::AnyImageImporterTest() {
     addInstancedTests({&AnyImageImporterTest::propagateConfigurationUnknown},
         Containers::arraySize(PropagateConfigurationUnknownData));
 
-    addTests({&AnyImageImporterTest::propagateFileCallback,
+    addTests({&AnyImageImporterTest::propagateFileCallback});
+
+    addInstancedTests({&AnyImageImporterTest::reuseImporter},
+        Containers::arraySize(LoadData));
+
+    addTests({&AnyImageImporterTest::reuseImporterDifferentPlugin,
 
               &AnyImageImporterTest::images1D,
               &AnyImageImporterTest::images2D,
@@ -512,6 +520,85 @@ void AnyImageImporterTest::propagateFileCallback() {
     CORRADE_VERIFY(!importer->isOpened());
 }
 
+void AnyImageImporterTest::reuseImporter() {
+    auto&& data = LoadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
+    importer->configuration().setValue("reuseImporter", true);
+    importer->setFlags(ImporterFlag::Verbose);
+
+    const Containers::String filename = Utility::Path::join(ANYIMAGEIMPORTER_TEST_DIR, data.filename);
+    Containers::Optional<Containers::Array<char>> read = Utility::Path::read(filename);
+    CORRADE_VERIFY(read);
+
+    std::ostringstream out, outWarning;
+    {
+        Debug redirectOutput{&out};
+        /* The option itself shouldn't get propagated, causing a warning */
+        Warning redirectWarning{&outWarning};
+
+        /* Opening again implicitly closes the previous file, closing
+           explicitly should keep the instance as well */
+        for(std::size_t i = 0; i != 3; ++i) {
+            CORRADE_ITERATION(i);
+            if(data.asData)
+                CORRADE_VERIFY(importer->openData(*read));
+            else
+                CORRADE_VERIFY(importer->openFile(filename));
+            CORRADE_COMPARE(importer->image2DCount(), 1);
+            if(i == 1) {
+                importer->close();
+                CORRADE_VERIFY(!importer->isOpened());
+            }
+        }
+    }
+    CORRADE_COMPARE(out.str(), Utility::formatString(
+        "Trade::AnyImageImporter::{0}(): using TgaImporter\n"
+        "Trade::AnyImageImporter::{0}(): reusing TgaImporter\n"
+        "Trade::AnyImageImporter::{0}(): reusing TgaImporter\n",
+        data.messageFunctionName));
+    CORRADE_COMPARE(outWarning.str(), "");
+}
+
+void AnyImageImporterTest::reuseImporterDifferentPlugin() {
+    if(!(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, cannot test");
+    if(_manager.loadState("PngImporter") != PluginManager::LoadState::NotFound)
+        CORRADE_SKIP("PngImporter plugin is present, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
+    importer->configuration().setValue("reuseImporter", true);
+    importer->setFlags(ImporterFlag::Verbose);
+
+    std::ostringstream out;
+    {
+        Debug redirectOutput{&out};
+        Error redirectError{&out};
+        CORRADE_VERIFY(importer->openFile(Utility::Path::join(ANYIMAGEIMPORTER_TEST_DIR, "rgb.tga")));
+        /* Detecting a different plugin discards the previous instance, even
+           if the new one fails to load */
+        CORRADE_VERIFY(!importer->openFile(Utility::Path::join(ANYIMAGEIMPORTER_TEST_DIR, "rgb.png")));
+        CORRADE_VERIFY(importer->openFile(Utility::Path::join(ANYIMAGEIMPORTER_TEST_DIR, "rgb.tga")));
+    }
+    #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_COMPARE(out.str(),
+        "Trade::AnyImageImporter::openFile(): using TgaImporter\n"
+        "PluginManager::Manager::load(): plugin PngImporter is not static and was not found in nonexistent\n"
+        "Trade::AnyImageImporter::openFile(): cannot load the PngImporter plugin\n"
+        "Trade::AnyImageImporter::openFile(): using TgaImporter\n");
+    #else
+    CORRADE_COMPARE(out.str(),
+        "Trade::AnyImageImporter::openFile(): using TgaImporter\n"
+        "PluginManager::Manager::load(): plugin PngImporter was not found\n"
+        "Trade::AnyImageImporter::openFile(): cannot load the PngImporter plugin\n"
+        "Trade::AnyImageImporter::openFile(): using TgaImporter\n");
+    #endif
+}
+
 void AnyImageImporterTest::images1D() {
     PluginManager::Manager<AbstractImporter> manager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
     #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
@@ -71,7 +71,12 @@ ImporterFeatures AnySceneImporter::doFeatures() const {
 bool AnySceneImporter::doIsOpened() const { return !!_in; }
 
 void AnySceneImporter::doClose() {
-    _in = nullptr;
+    /* If reuse is enabled, close the concrete importer but keep it for the
+       next open with the same plugin */
+    if(configuration().value<bool>("reuseImporter")) {
+        _in->close();
+        _cached = Utility::move(_in);
+    } else _in = nullptr;
 }
 
 void AnySceneImporter::doOpenFile(const Containers::StringView filename) {
@@ -149,32 +154,55 @@ void AnySceneImporter::doOpenFile(const Containers::StringView filename) {
         return;
     }
 
-    /* Try to load the plugin */
-    if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
-        Error{} << "Trade::AnySceneImporter::openFile(): cannot load the" << plugin << "plugin";
-        return;
-    }
-
-    const PluginManager::PluginMetadata* const metadata = manager()->metadata(plugin);
-    CORRADE_INTERNAL_ASSERT(metadata);
-    if(flags() & ImporterFlag::Verbose) {
-        Debug d;
-        d << "Trade::AnySceneImporter::openFile(): using" << plugin;
-        if(plugin != metadata->name())
-            d << "(provided by" << metadata->name() << Debug::nospace << ")";
+    Containers::Pointer<AbstractImporter> importer;
+
+    /* Reuse the previous instance if it's of the same plugin. Otherwise drop
+       it, only one instance is kept. */
+    const bool reuse = configuration().value<bool>("reuseImporter");
+    if(reuse && _cached && _cachedPlugin == plugin) {
+        if(flags() & ImporterFlag::Verbose)
+            Debug{} << "Trade::AnySceneImporter::openFile(): reusing" << plugin;
+        importer = Utility::move(_cached);
+
+    } else {
+        _cached = nullptr;
+
+        /* Try to load the plugin */
+        if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
+            Error{} << "Trade::AnySceneImporter::openFile(): cannot load the" << plugin << "plugin";
+            return;
+        }
+
+        const PluginManager::PluginMetadata* const metadata = manager()->metadata(plugin);
+        CORRADE_INTERNAL_ASSERT(metadata);
+        if(flags() & ImporterFlag::Verbose) {
+            Debug d;
+            d << "Trade::AnySceneImporter::openFile(): using" << plugin;
+            if(plugin != metadata->name())
+                d << "(provided by" << metadata->name() << Debug::nospace << ")";
+        }
+
+        importer = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
+        _cachedPlugin = plugin;
     }
 
-    /* Instantiate the plugin, propagate flags and the file callback, if set */
-    Containers::Pointer<AbstractImporter> importer = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
+    /* Propagate flags and the file callback, if set. If a reused instance
+       had a callback set before and now it shouldn't, reset it. */
     importer->setFlags(flags());
-    if(fileCallback()) importer->setFileCallback(fileCallback(), fileCallbackUserData());
+    if(fileCallback())
+        importer->setFileCallback(fileCallback(), fileCallbackUserData());
+    else if(importer->fileCallback())
+        importer->setFileCallback(nullptr);
 
-    /* Propagate configuration */
-    Magnum::Implementation::propagateConfiguration("Trade::AnySceneImporter::openFile():", {}, metadata->name(), configuration(), importer->configuration(), !(flags() & ImporterFlag::Quiet));
+    /* Propagate configuration, except for options of this plugin */
+    Magnum::Implementation::propagateConfiguration("Trade::AnySceneImporter::openFile():", {}, importer->metadata()->name(), configuration(), importer->configuration(), {"reuseImporter"_s}, !(flags() & ImporterFlag::Quiet));
 
     /* Try to open the file (error output should be printed by the plugin
-       itself) */
-    if(!importer->openFile(filename)) return;
+       itself). If that fails, keep the instance for reuse anyway. */
+    if(!importer->openFile(filename)) {
+        if(reuse) _cached = Utility::move(importer);
+        return;
+    }
 
     /* Success, save the instance */
     _in = Utility::move(importer);
@@ -30,6 +30,8 @@
  * @brief Class @ref Magnum::Trade::AnySceneImporter
  */
 
+#include <Corrade/Containers/String.h>
+
 #include "Magnum/Trade/AbstractImporter.h"
 #include "MagnumPlugins/AnySceneImporter/configure.h"
 
@@ -163,6 +165,31 @@ Besides delegating the flags, the @ref AnySceneImporter itself recognizes
 @ref ImporterFlag::Verbose, printing info about the concrete plugin being used
 when the flag is enabled. @ref ImporterFlag::Quiet is recognized as well and
 causes all warnings to be suppressed.
+
+@section Trade-AnySceneImporter-reuse Reusing the concrete importer
+
+By default, the concrete plugin instance is discarded on @ref close() and a
+new one is instantiated on every @ref openFile() call, which can
+become significant when opening many small files. Enabling the
+@cb{.ini} reuseImporter @ce
+@ref Trade-AnySceneImporter-configuration "configuration option" makes the plugin
+keep the concrete instance after @ref close() or a failed open and reuse it if
+the same plugin is detected for the next file, skipping the plugin lookup and
+instantiation. If a different plugin is detected, the previous instance is
+discarded. Flags and file callbacks are set and configuration is propagated
+again on every open, however options that were propagated earlier and removed
+from @ref configuration() since stay set in the reused instance.
+
+@section Trade-AnySceneImporter-configuration Plugin-specific configuration
+
+Apart from options that are propagated to the concrete implementation as
+described above, the plugin has the following options of its own, which
+aren't propagated:
+
+@snippet MagnumPlugins/AnySceneImporter/AnySceneImporter.conf configuration_
+
+See @ref plugins-configuration for more information and an example showing how
+to edit the configuration values.
 */
 class MAGNUM_ANYSCENEIMPORTER_EXPORT AnySceneImporter: public AbstractImporter {
     public:
@@ -289,6 +316,11 @@ class MAGNUM_ANYSCENEIMPORTER_EXPORT AnySceneImporter: public AbstractImporter {
         MAGNUM_ANYSCENEIMPORTER_LOCAL Containers::Optional<ImageData3D> doImage3D(UnsignedInt id, UnsignedInt level) override;
 
         Containers::Pointer<AbstractImporter> _in;
+        /* Closed instance kept for reuse with the reuseImporter option and
+           the plugin name it was instantiated for. The name is also kept
+           while the instance is in _in. */
+        Containers::Pointer<AbstractImporter> _cached;
+        Containers::String _cachedPlugin;
 };
 
 }}
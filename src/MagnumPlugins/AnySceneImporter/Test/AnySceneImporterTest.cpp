@@ -74,6 +74,8 @@ struct AnySceneImporterTest: TestSuite::Tester {
     void propagateConfigurationUnknownInEmptySubgroup();
     void propagateFileCallback();
 
+    void reuseImporter();
+
     void animations();
     void animationTrackTargetNameNoFileOpened();
 
@@ -162,6 +164,8 @@ AnySceneImporterTest::AnySceneImporterTest() {
     addTests({&AnySceneImporterTest::propagateConfigurationUnknownInEmptySubgroup,
               &AnySceneImporterTest::propagateFileCallback,
 
+              &AnySceneImporterTest::reuseImporter,
+
               &AnySceneImporterTest::animations,
               &AnySceneImporterTest::animationTrackTargetNameNoFileOpened,
 
@@ -404,6 +408,40 @@ void AnySceneImporterTest::propagateFileCallback() {
     CORRADE_VERIFY(!importer->isOpened());
 }
 
+void AnySceneImporterTest::reuseImporter() {
+    if(!(_manager.loadState("ObjImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("ObjImporter plugin not enabled, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnySceneImporter");
+    importer->configuration().setValue("reuseImporter", true);
+    importer->setFlags(ImporterFlag::Verbose);
+
+    const Containers::String filename = Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-multiple.obj");
+
+    std::ostringstream out, outWarning;
+    {
+        Debug redirectOutput{&out};
+        /* The option itself shouldn't get propagated, causing a warning */
+        Warning redirectWarning{&outWarning};
+
+        /* Opening again implicitly closes the previous file, closing
+           explicitly should keep the instance as well */
+        CORRADE_VERIFY(importer->openFile(filename));
+        CORRADE_VERIFY(importer->mesh(0));
+        CORRADE_VERIFY(importer->openFile(filename));
+        CORRADE_VERIFY(importer->mesh(0));
+        importer->close();
+        CORRADE_VERIFY(!importer->isOpened());
+        CORRADE_VERIFY(importer->openFile(filename));
+        CORRADE_VERIFY(importer->mesh(0));
+    }
+    CORRADE_COMPARE(out.str(),
+        "Trade::AnySceneImporter::openFile(): using ObjImporter\n"
+        "Trade::AnySceneImporter::openFile(): reusing ObjImporter\n"
+        "Trade::AnySceneImporter::openFile(): reusing ObjImporter\n");
+    CORRADE_COMPARE(outWarning.str(), "");
+}
+
 void AnySceneImporterTest::animations() {
     PluginManager::Manager<AbstractImporter> manager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
     #ifdef ANYSCENEIMPORTER_PLUGIN_FILENAME
@@ -0,0 +1,147 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BcnImageConverter.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include "Magnum/ThreadPool.h"
+#endif
+#include "Magnum/TextureTools/BlockCompression.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace Trade {
+
+using namespace Containers::Literals;
+
+BcnImageConverter::BcnImageConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImageConverter{manager, plugin} {}
+
+ImageConverterFeatures BcnImageConverter::doFeatures() const { return ImageConverterFeature::Convert2D; }
+
+Containers::Optional<ImageData2D> BcnImageConverter::doConvert(const ImageView2D& image) {
+    if(!image.size().product()) {
+        Error{} << "Trade::BcnImageConverter::convert(): can't compress an image with zero size";
+        return {};
+    }
+
+    UnsignedInt channelCount;
+    switch(image.format()) {
+        case PixelFormat::R8Unorm:
+            channelCount = 1;
+            break;
+        case PixelFormat::RG8Unorm:
+            channelCount = 2;
+            break;
+        case PixelFormat::RGB8Unorm:
+        case PixelFormat::RGB8Srgb:
+            channelCount = 3;
+            break;
+        case PixelFormat::RGBA8Unorm:
+        case PixelFormat::RGBA8Srgb:
+            channelCount = 4;
+            break;
+        default:
+            Error{} << "Trade::BcnImageConverter::convert(): unsupported format" << image.format();
+            return {};
+    }
+    const bool srgb = image.format() == PixelFormat::RGB8Srgb ||
+                      image.format() == PixelFormat::RGBA8Srgb;
+
+    /* Pick the output format based on the option and channel count */
+    const Containers::StringView formatString = configuration().value<Containers::StringView>("format");
+    CompressedPixelFormat format;
+    if(formatString.isEmpty()) {
+        if(channelCount == 1)
+            format = CompressedPixelFormat::Bc4RUnorm;
+        else if(channelCount == 2)
+            format = CompressedPixelFormat::Bc5RGUnorm;
+        else if(channelCount == 3)
+            format = srgb ? CompressedPixelFormat::Bc1RGBSrgb : CompressedPixelFormat::Bc1RGBUnorm;
+        else
+            format = srgb ? CompressedPixelFormat::Bc3RGBASrgb : CompressedPixelFormat::Bc3RGBAUnorm;
+    } else if(formatString == "bc1"_s && channelCount >= 3) {
+        format = srgb ? CompressedPixelFormat::Bc1RGBSrgb : CompressedPixelFormat::Bc1RGBUnorm;
+    } else if(formatString == "bc1a"_s && channelCount == 4) {
+        format = srgb ? CompressedPixelFormat::Bc1RGBASrgb : CompressedPixelFormat::Bc1RGBAUnorm;
+    } else if(formatString == "bc3"_s && channelCount == 4) {
+        format = srgb ? CompressedPixelFormat::Bc3RGBASrgb : CompressedPixelFormat::Bc3RGBAUnorm;
+    } else if(formatString == "bc4"_s && channelCount == 1) {
+        format = CompressedPixelFormat::Bc4RUnorm;
+    } else if(formatString == "bc5"_s && channelCount == 2) {
+        format = CompressedPixelFormat::Bc5RGUnorm;
+    } else if(formatString == "etc2"_s && channelCount >= 3) {
+        format = srgb ? CompressedPixelFormat::Etc2RGB8Srgb : CompressedPixelFormat::Etc2RGB8Unorm;
+    } else if(formatString == "etc2a"_s && channelCount == 4) {
+        format = srgb ? CompressedPixelFormat::Etc2RGBA8Srgb : CompressedPixelFormat::Etc2RGBA8Unorm;
+    } else if(formatString == "eacr11"_s && channelCount == 1) {
+        format = CompressedPixelFormat::EacR11Unorm;
+    } else if(formatString == "eacrg11"_s && channelCount == 2) {
+        format = CompressedPixelFormat::EacRG11Unorm;
+    } else if(formatString == "bc7"_s && channelCount >= 3) {
+        format = srgb ? CompressedPixelFormat::Bc7RGBASrgb : CompressedPixelFormat::Bc7RGBAUnorm;
+    } else if(formatString == "bc1"_s || formatString == "bc1a"_s || formatString == "bc3"_s || formatString == "bc4"_s || formatString == "bc5"_s ||
+              formatString == "etc2"_s || formatString == "etc2a"_s || formatString == "eacr11"_s || formatString == "eacrg11"_s || formatString == "bc7"_s) {
+        Error{} << "Trade::BcnImageConverter::convert(): can't compress" << image.format() << "to" << formatString;
+        return {};
+    } else {
+        Error{} << "Trade::BcnImageConverter::convert(): expected format to be empty or one of bc1, bc1a, bc3, bc4, bc5, etc2, etc2a, eacr11, eacrg11 or bc7 but got" << formatString;
+        return {};
+    }
+
+    /* Zero threads means the hardware concurrency, a pool with a single
+       thread executes everything on the calling thread */
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    ThreadPool threadPool{configuration().value<UnsignedInt>("threads")};
+    const UnsignedInt threadCount = threadPool.threadCount();
+    #else
+    const UnsignedInt threadCount = 1;
+    #endif
+
+    if(flags() & ImageConverterFlag::Verbose)
+        Debug{} << "Trade::BcnImageConverter::convert(): compressing to" << format << "on" << threadCount << "threads";
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    CompressedImage2D compressed = TextureTools::compressBlocks(image, format, ThreadPool::parallelFor, &threadPool);
+    #else
+    CompressedImage2D compressed = TextureTools::compressBlocks(image, format);
+    #endif
+
+    /* Braced initialization guarantees the format and size are queried
+       before the data get released */
+    return ImageData2D{compressed.format(), compressed.size(), compressed.release(), image.flags()};
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(BcnImageConverter, Magnum::Trade::BcnImageConverter,
+    MAGNUM_TRADE_ABSTRACTIMAGECONVERTER_PLUGIN_INTERFACE)
@@ -0,0 +1,184 @@
+#ifndef Magnum_Trade_BcnImageConverter_h
+#define Magnum_Trade_BcnImageConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::BcnImageConverter
+ * @m_since_latest
+ */
+
+#include "Magnum/Trade/AbstractImageConverter.h"
+
+#include "MagnumPlugins/BcnImageConverter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_BCNIMAGECONVERTER_BUILD_STATIC
+    #if defined(BcnImageConverter_EXPORTS) || defined(BcnImageConverterObjects_EXPORTS)
+        #define MAGNUM_BCNIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_BCNIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_BCNIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_BCNIMAGECONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_BCNIMAGECONVERTER_EXPORT
+#define MAGNUM_BCNIMAGECONVERTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief BCn, ETC2 and EAC block compression image converter plugin
+@m_since_latest
+
+Compresses images with @ref PixelFormat::R8Unorm,
+@relativeref{PixelFormat,RG8Unorm}, @relativeref{PixelFormat,RGB8Unorm},
+@relativeref{PixelFormat,RGBA8Unorm}, @relativeref{PixelFormat,RGB8Srgb} or
+@relativeref{PixelFormat,RGBA8Srgb} to BC1, BC3, BC4, BC5, ETC2 or EAC using
+@ref TextureTools::compressBlocks(), optionally on multiple threads. The
+output is a compressed image, so the plugin is meant to be used either
+directly or as an intermediate step before saving to a file format
+supporting compressed images. For example with the
+@ref magnum-imageconverter "magnum-imageconverter" utility, where the
+@ref AnyImageConverter plugin is implicitly used after it to save the output
+to a KTX2 file:
+
+@code{.sh}
+magnum-imageconverter image.png image.ktx2 \
+    -C BcnImageConverter -c format=bc1,threads=4
+@endcode
+
+@section Trade-BcnImageConverter-usage Usage
+
+@m_class{m-note m-success}
+
+@par
+    This class is a plugin that's meant to be dynamically loaded and used
+    via the base @ref AbstractImageConverter interface. See its documentation
+    for introduction and usage examples.
+
+This plugin depends on the @ref Trade and @ref TextureTools libraries and is
+built if `MAGNUM_WITH_BCNIMAGECONVERTER` is enabled when building Magnum. To
+use as a dynamic plugin, load @cpp "BcnImageConverter" @ce via
+@ref Corrade::PluginManager::Manager.
+
+Additionally, if you're using Magnum as a CMake subproject, do the following:
+
+@code{.cmake}
+set(MAGNUM_WITH_BCNIMAGECONVERTER ON CACHE BOOL "" FORCE)
+add_subdirectory(magnum EXCLUDE_FROM_ALL)
+
+# So the dynamically loaded plugin gets built implicitly
+add_dependencies(your-app Magnum::BcnImageConverter)
+@endcode
+
+To use as a static plugin or as a dependency of another plugin with CMake, you
+need to request the `BcnImageConverter` component of the `Magnum` package and
+link to the `Magnum::BcnImageConverter` target:
+
+@code{.cmake}
+find_package(Magnum REQUIRED BcnImageConverter)
+
+# ...
+target_link_libraries(your-app PRIVATE Magnum::BcnImageConverter)
+@endcode
+
+See @ref building, @ref cmake, @ref plugins and @ref file-formats for more
+information.
+
+@section Trade-BcnImageConverter-behavior Behavior and limitations
+
+The output format is controlled with the @cb{.ini} format @ce
+@ref Trade-BcnImageConverter-configuration "configuration option". If empty,
+it's picked based on the input channel count:
+
+-   @ref PixelFormat::R8Unorm is compressed to
+    @ref CompressedPixelFormat::Bc4RUnorm
+-   @ref PixelFormat::RG8Unorm is compressed to
+    @ref CompressedPixelFormat::Bc5RGUnorm
+-   @ref PixelFormat::RGB8Unorm and @relativeref{PixelFormat,RGB8Srgb} is
+    compressed to @ref CompressedPixelFormat::Bc1RGBUnorm or
+    @relativeref{CompressedPixelFormat,Bc1RGBSrgb}
+-   @ref PixelFormat::RGBA8Unorm and @relativeref{PixelFormat,RGBA8Srgb} is
+    compressed to @ref CompressedPixelFormat::Bc3RGBAUnorm or
+    @relativeref{CompressedPixelFormat,Bc3RGBASrgb}
+
+Setting it to @cb{.ini} bc1 @ce compresses three- and four-channel images to
+BC1 without alpha, @cb{.ini} bc1a @ce four-channel images to BC1 with a
+punch-through alpha, @cb{.ini} bc3 @ce four-channel images to BC3 and
+@cb{.ini} bc4 @ce and @cb{.ini} bc5 @ce one- and two-channel images to BC4
+and BC5. Similarly, @cb{.ini} etc2 @ce compresses three- and four-channel
+images to @ref CompressedPixelFormat::Etc2RGB8Unorm /
+@relativeref{CompressedPixelFormat,Etc2RGB8Srgb} without alpha,
+@cb{.ini} etc2a @ce four-channel images to
+@relativeref{CompressedPixelFormat,Etc2RGBA8Unorm} /
+@relativeref{CompressedPixelFormat,Etc2RGBA8Srgb} with an EAC alpha and
+@cb{.ini} eacr11 @ce and @cb{.ini} eacrg11 @ce one- and two-channel images
+to @relativeref{CompressedPixelFormat,EacR11Unorm} and
+@relativeref{CompressedPixelFormat,EacRG11Unorm}. Finally, @cb{.ini} bc7 @ce
+compresses three- and four-channel images to
+@ref CompressedPixelFormat::Bc7RGBAUnorm /
+@relativeref{CompressedPixelFormat,Bc7RGBASrgb}, with alpha set to
+@cpp 255 @ce for three-channel images. Other combinations fail with an
+error. Images of any size are
+accepted, see @ref TextureTools::compressBlocks() for details about the
+encoding.
+
+The work is distributed on a @ref ThreadPool with as many threads as given
+by the @cb{.ini} threads @ce option, using the hardware concurrency by
+default. On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the compression always
+runs on the calling thread.
+
+Image flags are passed through unchanged. The converter recognizes
+@ref ImageConverterFlag::Verbose, printing the chosen format and thread
+count when the flag is enabled.
+
+@section Trade-BcnImageConverter-configuration Plugin-specific configuration
+
+It's possible to tune various output options through @ref configuration(). See
+below for all options and their default values:
+
+@snippet MagnumPlugins/BcnImageConverter/BcnImageConverter.conf configuration_
+
+See @ref plugins-configuration for more information and an example showing how
+to edit the configuration values.
+*/
+class MAGNUM_BCNIMAGECONVERTER_EXPORT BcnImageConverter: public AbstractImageConverter {
+    public:
+        /** @brief Plugin manager constructor */
+        explicit BcnImageConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
+
+    private:
+        MAGNUM_BCNIMAGECONVERTER_LOCAL ImageConverterFeatures doFeatures() const override;
+        MAGNUM_BCNIMAGECONVERTER_LOCAL Containers::Optional<ImageData2D> doConvert(const ImageView2D& image) override;
+};
+
+}}
+
+#endif
@@ -0,0 +1,259 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/DebugStl.h> /** @todo remove once Debug is stream-free */
+#include <Corrade/Utility/FormatStl.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/TextureTools/BlockCompression.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/AbstractImageConverter.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct BcnImageConverterTest: TestSuite::Tester {
+    explicit BcnImageConverterTest();
+
+    void convert();
+    void threads();
+
+    void zeroSize();
+    void unsupportedFormat();
+    void formatMismatch();
+    void invalidFormatOption();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractImageConverter> _manager{"nonexistent"};
+};
+
+const struct {
+    const char* name;
+    PixelFormat format;
+    UnsignedInt pixelSize;
+    const char* formatOption;
+    CompressedPixelFormat expected;
+} ConvertData[]{
+    {"R, auto", PixelFormat::R8Unorm, 1, nullptr,
+        CompressedPixelFormat::Bc4RUnorm},
+    {"RG, auto", PixelFormat::RG8Unorm, 2, nullptr,
+        CompressedPixelFormat::Bc5RGUnorm},
+    {"RGB, auto", PixelFormat::RGB8Unorm, 3, nullptr,
+        CompressedPixelFormat::Bc1RGBUnorm},
+    {"RGB sRGB, auto", PixelFormat::RGB8Srgb, 3, nullptr,
+        CompressedPixelFormat::Bc1RGBSrgb},
+    {"RGBA, auto", PixelFormat::RGBA8Unorm, 4, nullptr,
+        CompressedPixelFormat::Bc3RGBAUnorm},
+    {"RGBA sRGB, auto", PixelFormat::RGBA8Srgb, 4, nullptr,
+        CompressedPixelFormat::Bc3RGBASrgb},
+    {"RGBA, bc1", PixelFormat::RGBA8Unorm, 4, "bc1",
+        CompressedPixelFormat::Bc1RGBUnorm},
+    {"RGBA sRGB, bc1a", PixelFormat::RGBA8Srgb, 4, "bc1a",
+        CompressedPixelFormat::Bc1RGBASrgb},
+    {"R, bc4", PixelFormat::R8Unorm, 1, "bc4",
+        CompressedPixelFormat::Bc4RUnorm},
+    {"RGB, etc2", PixelFormat::RGB8Unorm, 3, "etc2",
+        CompressedPixelFormat::Etc2RGB8Unorm},
+    {"RGBA sRGB, etc2", PixelFormat::RGBA8Srgb, 4, "etc2",
+        CompressedPixelFormat::Etc2RGB8Srgb},
+    {"RGBA, etc2a", PixelFormat::RGBA8Unorm, 4, "etc2a",
+        CompressedPixelFormat::Etc2RGBA8Unorm},
+    {"RGBA sRGB, etc2a", PixelFormat::RGBA8Srgb, 4, "etc2a",
+        CompressedPixelFormat::Etc2RGBA8Srgb},
+    {"R, eacr11", PixelFormat::R8Unorm, 1, "eacr11",
+        CompressedPixelFormat::EacR11Unorm},
+    {"RG, eacrg11", PixelFormat::RG8Unorm, 2, "eacrg11",
+        CompressedPixelFormat::EacRG11Unorm},
+    {"RGB, bc7", PixelFormat::RGB8Unorm, 3, "bc7",
+        CompressedPixelFormat::Bc7RGBAUnorm},
+    {"RGBA sRGB, bc7", PixelFormat::RGBA8Srgb, 4, "bc7",
+        CompressedPixelFormat::Bc7RGBASrgb},
+};
+
+const struct {
+    const char* name;
+    PixelFormat format;
+    const char* formatOption;
+    const char* message;
+} FormatMismatchData[]{
+    {"RGB to bc3", PixelFormat::RGB8Unorm, "bc3",
+        "can't compress PixelFormat::RGB8Unorm to bc3"},
+    {"RGB to bc1a", PixelFormat::RGB8Srgb, "bc1a",
+        "can't compress PixelFormat::RGB8Srgb to bc1a"},
+    {"RG to bc4", PixelFormat::RG8Unorm, "bc4",
+        "can't compress PixelFormat::RG8Unorm to bc4"},
+    {"R to bc1", PixelFormat::R8Unorm, "bc1",
+        "can't compress PixelFormat::R8Unorm to bc1"},
+    {"RGB to etc2a", PixelFormat::RGB8Unorm, "etc2a",
+        "can't compress PixelFormat::RGB8Unorm to etc2a"},
+    {"RG to eacr11", PixelFormat::RG8Unorm, "eacr11",
+        "can't compress PixelFormat::RG8Unorm to eacr11"},
+    {"RG to bc7", PixelFormat::RG8Unorm, "bc7",
+        "can't compress PixelFormat::RG8Unorm to bc7"},
+};
+
+BcnImageConverterTest::BcnImageConverterTest() {
+    addInstancedTests({&BcnImageConverterTest::convert},
+        Containers::arraySize(ConvertData));
+
+    addTests({&BcnImageConverterTest::threads,
+
+              &BcnImageConverterTest::zeroSize,
+              &BcnImageConverterTest::unsupportedFormat});
+
+    addInstancedTests({&BcnImageConverterTest::formatMismatch},
+        Containers::arraySize(FormatMismatchData));
+
+    addTests({&BcnImageConverterTest::invalidFormatOption});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef BCNIMAGECONVERTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(BCNIMAGECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+/* Pseudo-random pixel data with a size that isn't a multiple of the block
+   size */
+Containers::Array<char> pixelData(const Vector2i& size, const UnsignedInt pixelSize) {
+    Containers::Array<char> out{NoInit, std::size_t(size.product())*pixelSize};
+    UnsignedInt state = 1234;
+    for(char& i: out) {
+        state = state*1103515245u + 12345u;
+        i = char(state >> 16);
+    }
+    return out;
+}
+
+void BcnImageConverterTest::convert() {
+    auto&& data = ConvertData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("BcnImageConverter");
+    if(data.formatOption)
+        converter->configuration().setValue("format", data.formatOption);
+    /* Single thread to verify the output matches the library function
+       exactly */
+    converter->configuration().setValue("threads", 1);
+
+    const Containers::Array<char> pixels = pixelData({13, 6}, data.pixelSize);
+    const ImageView2D image{PixelStorage{}.setAlignment(1), data.format, {13, 6}, pixels};
+    Containers::Optional<ImageData2D> out = converter->convert(image);
+    CORRADE_VERIFY(out);
+    CORRADE_VERIFY(out->isCompressed());
+    CORRADE_COMPARE(out->compressedFormat(), data.expected);
+    CORRADE_COMPARE(out->size(), (Vector2i{13, 6}));
+
+    const CompressedImage2D expected = TextureTools::compressBlocks(image, data.expected);
+    CORRADE_COMPARE_AS(out->data(), expected.data(),
+        TestSuite::Compare::Container);
+}
+
+void BcnImageConverterTest::threads() {
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_SKIP("Threads are not used on Emscripten.");
+    #else
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("BcnImageConverter");
+    converter->configuration().setValue("threads", 3);
+    converter->addFlags(ImageConverterFlag::Verbose);
+
+    const Containers::Array<char> pixels = pixelData({31, 27}, 4);
+    const ImageView2D image{PixelFormat::RGBA8Unorm, {31, 27}, pixels};
+
+    std::ostringstream out;
+    Containers::Optional<ImageData2D> converted;
+    {
+        Debug redirectOutput{&out};
+        converted = converter->convert(image);
+    }
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(out.str(), "Trade::BcnImageConverter::convert(): compressing to CompressedPixelFormat::Bc3RGBAUnorm on 3 threads\n");
+
+    /* The output should be the same regardless of the thread count */
+    const CompressedImage2D expected = TextureTools::compressBlocks(image, CompressedPixelFormat::Bc3RGBAUnorm);
+    CORRADE_COMPARE_AS(converted->data(), expected.data(),
+        TestSuite::Compare::Container);
+    #endif
+}
+
+void BcnImageConverterTest::zeroSize() {
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("BcnImageConverter");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(ImageView2D{PixelFormat::RGBA8Unorm, {4, 0}}));
+    CORRADE_COMPARE(out.str(), "Trade::BcnImageConverter::convert(): can't compress an image with zero size\n");
+}
+
+void BcnImageConverterTest::unsupportedFormat() {
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("BcnImageConverter");
+
+    const char data[8]{};
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(ImageView2D{PixelFormat::RG16Unorm, {1, 1}, data}));
+    CORRADE_COMPARE(out.str(), "Trade::BcnImageConverter::convert(): unsupported format PixelFormat::RG16Unorm\n");
+}
+
+void BcnImageConverterTest::formatMismatch() {
+    auto&& data = FormatMismatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("BcnImageConverter");
+    converter->configuration().setValue("format", data.formatOption);
+
+    const char pixels[16]{};
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(ImageView2D{PixelStorage{}.setAlignment(1), data.format, {1, 1}, pixels}));
+    CORRADE_COMPARE(out.str(), Utility::format("Trade::BcnImageConverter::convert(): {}\n", data.message));
+}
+
+void BcnImageConverterTest::invalidFormatOption() {
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("BcnImageConverter");
+    converter->configuration().setValue("format", "bc6h");
+
+    const char data[4]{};
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(ImageView2D{PixelFormat::RGBA8Unorm, {1, 1}, data}));
+    CORRADE_COMPARE(out.str(), "Trade::BcnImageConverter::convert(): expected format to be empty or one of bc1, bc1a, bc3, bc4, bc5, etc2, etc2a, eacr11, eacrg11 or bc7 but got bc6h\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::BcnImageConverterTest)
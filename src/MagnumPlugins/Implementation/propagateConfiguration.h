@@ -37,7 +37,8 @@
    implementation. Assumes that the Any* plugin itself doesn't have any
    configuration options and so propagates all groups and values that were
    set, emitting a warning if the target doesn't have such option in its
-   default configuration.
+   default configuration. Top-level values that are options of the Any*
+   plugin itself can be listed in ignoredValues to not propagate them.
 
    Thoroughly tested in AnySceneImporterTest. */
 
@@ -46,11 +47,20 @@ namespace Magnum { namespace Implementation {
 /* Used only in plugins where we don't want it to be exported */
 namespace {
 
-void propagateConfiguration(const char* warningPrefix, const Containers::String& groupPrefix, const Containers::StringView plugin, const Utility::ConfigurationGroup& src, Utility::ConfigurationGroup& dst, bool warnUnrecognized, bool warnUnrecognizedNested) {
+void propagateConfiguration(const char* warningPrefix, const Containers::String& groupPrefix, const Containers::StringView plugin, const Utility::ConfigurationGroup& src, Utility::ConfigurationGroup& dst, const Containers::StringIterable& ignoredValues, bool warnUnrecognized, bool warnUnrecognizedNested) {
     using namespace Containers::Literals;
 
     /* Propagate values */
     for(Containers::Pair<Containers::StringView, Containers::StringView> value: src.values()) {
+        bool ignored = false;
+        for(const Containers::StringView ignoredValue: ignoredValues) {
+            if(value.first() == ignoredValue) {
+                ignored = true;
+                break;
+            }
+        }
+        if(ignored) continue;
+
         if(!dst.hasValue(value.first()) && warnUnrecognized) {
             Warning{} << warningPrefix << "option" << "/"_s.joinWithoutEmptyParts({groupPrefix, value.first()}) << "not recognized by" << plugin;
         }
@@ -74,12 +84,16 @@ void propagateConfiguration(const char* warningPrefix, const Containers::String&
             warnUnrecognizedSubgroup = false;
         }
 
-        propagateConfiguration(warningPrefix, "/"_s.joinWithoutEmptyParts({groupPrefix, group.first()}), plugin, group.second(), *dstGroup, warnUnrecognizedSubgroup, warnUnrecognizedNested);
+        propagateConfiguration(warningPrefix, "/"_s.joinWithoutEmptyParts({groupPrefix, group.first()}), plugin, group.second(), *dstGroup, {}, warnUnrecognizedSubgroup, warnUnrecognizedNested);
     }
 }
 
+void propagateConfiguration(const char* warningPrefix, const Containers::String& groupPrefix, const Containers::StringView plugin, const Utility::ConfigurationGroup& src, Utility::ConfigurationGroup& dst, const Containers::StringIterable& ignoredValues, bool warnUnrecognized = true) {
+    propagateConfiguration(warningPrefix, groupPrefix, plugin, src, dst, ignoredValues, warnUnrecognized, warnUnrecognized);
+}
+
 void propagateConfiguration(const char* warningPrefix, const Containers::String& groupPrefix, const Containers::StringView plugin, const Utility::ConfigurationGroup& src, Utility::ConfigurationGroup& dst, bool warnUnrecognized = true) {
-    propagateConfiguration(warningPrefix, groupPrefix, plugin, src, dst, warnUnrecognized, warnUnrecognized);
+    propagateConfiguration(warningPrefix, groupPrefix, plugin, src, dst, {}, warnUnrecognized, warnUnrecognized);
 }
 
 }
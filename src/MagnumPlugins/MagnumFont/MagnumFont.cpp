@@ -26,13 +26,15 @@
 
 #include "MagnumFont.h"
 
+#include <algorithm> /* std::stable_sort(), std::lower_bound() */
+#include <cstring>
 #include <sstream>
-#include <unordered_map>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
 #include <Corrade/Containers/Triple.h>
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Configuration.h>
@@ -45,27 +47,53 @@
 #include "Magnum/Text/AbstractShaper.h"
 #include "Magnum/Text/GlyphCacheGL.h"
 #include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/MagnumFont/MagnumFontBinary.h"
 #include "MagnumPlugins/TgaImporter/TgaImporter.h"
 
 namespace Magnum { namespace Text {
 
-struct MagnumFont::Data {
-    /* Otherwise Clang complains about Utility::Configuration having explicit
-       constructor when emplace()ing the Pointer. Using = default works on
-       newer Clang but not older versions. */
-    explicit Data() {}
+using Implementation::MagnumFontBinaryChar;
+using Implementation::MagnumFontBinaryGlyph;
+using Implementation::MagnumFontBinaryHeader;
 
-    Utility::Configuration conf;
+struct MagnumFont::Data {
     Containers::Optional<Trade::ImageData2D> image;
     Containers::Optional<Containers::String> filePath;
-    std::unordered_map<char32_t, UnsignedInt> glyphId;
-    struct Glyph {
-        Vector2i size;
-        Vector2 advance;
-    };
-    Containers::Array<Glyph> glyphs;
+    Vector2i originalImageSize;
+    Vector2i padding;
+
+    /* Glyph properties and character->glyph mapping sorted by the codepoint.
+       Point either to the storage arrays below, or into a memory-mapped
+       binary file. */
+    Containers::ArrayView<const MagnumFontBinaryGlyph> glyphs;
+    Containers::ArrayView<const MagnumFontBinaryChar> chars;
+
+    /* Used if the font is parsed from a text file or if a binary file is
+       passed via openData() */
+    Containers::Array<MagnumFontBinaryGlyph> glyphStorage;
+    Containers::Array<MagnumFontBinaryChar> charStorage;
+    Containers::Array<char> binaryStorage;
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Array<const char, Utility::Path::MapDeleter> mapped;
+    #endif
 };
 
+namespace {
+
+bool isBinary(const Containers::ArrayView<const char> data) {
+    return data.size() >= sizeof(Implementation::MagnumFontBinaryMagic) && std::memcmp(data.data(), Implementation::MagnumFontBinaryMagic, sizeof(Implementation::MagnumFontBinaryMagic)) == 0;
+}
+
+UnsignedInt glyphForCharacter(const Containers::ArrayView<const MagnumFontBinaryChar> chars, const char32_t character) {
+    const MagnumFontBinaryChar* const found = std::lower_bound(chars.begin(), chars.end(), UnsignedInt(character),
+        [](const MagnumFontBinaryChar& a, const UnsignedInt b) {
+            return a.unicode < b;
+        });
+    return found != chars.end() && found->unicode == UnsignedInt(character) ? found->glyph : 0;
+}
+
+}
+
 MagnumFont::MagnumFont(): _opened(nullptr) {}
 
 MagnumFont::MagnumFont(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractFont{manager, plugin}, _opened(nullptr) {}
@@ -79,6 +107,10 @@ bool MagnumFont::doIsOpened() const { return _opened && _opened->image; }
 void MagnumFont::doClose() { _opened = nullptr; }
 
 auto MagnumFont::doOpenData(const Containers::ArrayView<const char> data, const Float) -> Properties {
+    return openDataInternal(data, false);
+}
+
+auto MagnumFont::openDataInternal(const Containers::ArrayView<const char> data, const bool dataPersistent) -> Properties {
     if(!_opened) _opened.emplace();
 
     if(!_opened->filePath && !fileCallback()) {
@@ -86,73 +118,159 @@ auto MagnumFont::doOpenData(const Containers::ArrayView<const char> data, const
         return {};
     }
 
-    /* Open the configuration file */
-    /* MSVC 2017 requires explicit std::string constructor. MSVC 2015 doesn't. */
-    std::istringstream in(std::string{data.begin(), data.size()});
-    Utility::Configuration conf(in, Utility::Configuration::Flag::SkipComments);
-    if(!conf.isValid() || conf.isEmpty()) {
-        Error{} << "Text::MagnumFont::openData(): font file is not valid";
-        return {};
-    }
+    Containers::String imageName;
+    Properties properties;
 
-    /* Check version */
-    if(conf.value<UnsignedInt>("version") != 1) {
-        Error() << "Text::MagnumFont::openData(): unsupported file version, expected 1 but got"
-                << conf.value<UnsignedInt>("version");
+    /* Binary file */
+    if(isBinary(data)) {
+        #ifdef CORRADE_TARGET_BIG_ENDIAN
+        Error{} << "Text::MagnumFont::openData(): binary fonts are not supported on Big-Endian platforms";
         return {};
+        #else
+        if(data.size() < sizeof(MagnumFontBinaryHeader)) {
+            Error{} << "Text::MagnumFont::openData(): binary font file too short, expected at least" << sizeof(MagnumFontBinaryHeader) << "bytes but got" << data.size();
+            return {};
+        }
+
+        /* Copy the data if they aren't guaranteed to stay in scope */
+        Containers::ArrayView<const char> binary = data;
+        if(!dataPersistent) {
+            _opened->binaryStorage = Containers::Array<char>{NoInit, data.size()};
+            Utility::copy(data, _opened->binaryStorage);
+            binary = _opened->binaryStorage;
+        }
+
+        const MagnumFontBinaryHeader& header = *reinterpret_cast<const MagnumFontBinaryHeader*>(binary.data());
+        if(header.version != 1) {
+            Error{} << "Text::MagnumFont::openData(): unsupported binary file version, expected 1 but got" << header.version;
+            return {};
+        }
+
+        const std::size_t glyphOffset = sizeof(MagnumFontBinaryHeader) + ((std::size_t(header.imageNameSize) + 3) & ~std::size_t{3});
+        const std::size_t charOffset = glyphOffset + std::size_t(header.glyphCount)*sizeof(MagnumFontBinaryGlyph);
+        const std::size_t expectedSize = charOffset + std::size_t(header.charCount)*sizeof(MagnumFontBinaryChar);
+        if(binary.size() != expectedSize) {
+            Error{} << "Text::MagnumFont::openData(): binary font file size doesn't match, expected" << expectedSize << "bytes but got" << binary.size();
+            return {};
+        }
+
+        _opened->glyphs = Containers::arrayCast<const MagnumFontBinaryGlyph>(binary.slice(glyphOffset, charOffset));
+        _opened->chars = Containers::arrayCast<const MagnumFontBinaryChar>(binary.exceptPrefix(charOffset));
+
+        /* The file may come from anywhere, so verify that lookups will stay
+           in bounds and that the binary search will work */
+        for(std::size_t i = 0; i != _opened->chars.size(); ++i) {
+            if(_opened->chars[i].glyph >= header.glyphCount) {
+                Error{} << "Text::MagnumFont::openData(): character" << i << "references glyph" << _opened->chars[i].glyph << "but only" << header.glyphCount << "glyphs are present";
+                return {};
+            }
+            if(i && _opened->chars[i - 1].unicode > _opened->chars[i].unicode) {
+                Error{} << "Text::MagnumFont::openData(): characters are not sorted";
+                return {};
+            }
+        }
+
+        imageName = Containers::String{binary.data() + sizeof(MagnumFontBinaryHeader), header.imageNameSize};
+        _opened->originalImageSize = header.originalImageSize;
+        _opened->padding = header.padding;
+        properties = {header.fontSize, header.ascent, header.descent, header.lineHeight, header.glyphCount};
+        #endif
+
+    /* Text file */
+    } else {
+        /* MSVC 2017 requires explicit std::string constructor. MSVC 2015
+           doesn't. */
+        std::istringstream in(std::string{data.begin(), data.size()});
+        Utility::Configuration conf(in, Utility::Configuration::Flag::SkipComments);
+        if(!conf.isValid() || conf.isEmpty()) {
+            Error{} << "Text::MagnumFont::openData(): font file is not valid";
+            return {};
+        }
+
+        /* Check version */
+        if(conf.value<UnsignedInt>("version") != 1) {
+            Error() << "Text::MagnumFont::openData(): unsupported file version, expected 1 but got"
+                    << conf.value<UnsignedInt>("version");
+            return {};
+        }
+
+        /* Glyph properties */
+        const std::vector<Utility::ConfigurationGroup*> glyphs = conf.groups("glyph");
+        _opened->glyphStorage = Containers::Array<MagnumFontBinaryGlyph>{NoInit, glyphs.size()};
+        for(std::size_t i = 0; i != glyphs.size(); ++i)
+            _opened->glyphStorage[i] = {
+                glyphs[i]->value<Vector2>("advance"),
+                glyphs[i]->value<Vector2i>("position"),
+                glyphs[i]->value<Range2Di>("rectangle")
+            };
+
+        /* Character->glyph map, sorted for binary search. Stable sort so if
+           a character is listed more than once, the first occurence wins. */
+        const std::vector<Utility::ConfigurationGroup*> chars = conf.groups("char");
+        _opened->charStorage = Containers::Array<MagnumFontBinaryChar>{NoInit, chars.size()};
+        for(std::size_t i = 0; i != chars.size(); ++i) {
+            const UnsignedInt glyphId = chars[i]->value<UnsignedInt>("glyph");
+            CORRADE_INTERNAL_ASSERT(glyphId < glyphs.size());
+            _opened->charStorage[i] = {UnsignedInt(chars[i]->value<char32_t>("unicode")), glyphId};
+        }
+        std::stable_sort(_opened->charStorage.begin(), _opened->charStorage.end(),
+            [](const MagnumFontBinaryChar& a, const MagnumFontBinaryChar& b) {
+                return a.unicode < b.unicode;
+            });
+
+        _opened->glyphs = _opened->glyphStorage;
+        _opened->chars = _opened->charStorage;
+        _opened->originalImageSize = conf.value<Vector2i>("originalImageSize");
+        _opened->padding = conf.value<Vector2i>("padding");
+        properties = {conf.value<Float>("fontSize"),
+                      conf.value<Float>("ascent"),
+                      conf.value<Float>("descent"),
+                      conf.value<Float>("lineHeight"),
+                      UnsignedInt(glyphs.size())};
+        imageName = conf.value("image");
     }
 
     /* Open and load image file. Error messages should be printed by the
        TgaImporter already, no need to repeat them again. */
     Trade::TgaImporter importer;
     importer.setFileCallback(fileCallback(), fileCallbackUserData());
-    if(!importer.openFile(Utility::Path::join(_opened->filePath ? *_opened->filePath : "", conf.value("image")))) return {};
+    if(!importer.openFile(Utility::Path::join(_opened->filePath ? *_opened->filePath : "", imageName))) return {};
     _opened->image = importer.image2D(0);
     if(!_opened->image) return {};
 
-    /* Everything okay, save the data internally */
-    _opened->conf = Utility::move(conf);
-
-    /* Glyph advances */
-    const std::vector<Utility::ConfigurationGroup*> glyphs = _opened->conf.groups("glyph");
-    _opened->glyphs = Containers::Array<Data::Glyph>{NoInit, glyphs.size()};
-    for(std::size_t i = 0; i != glyphs.size(); ++i)
-        _opened->glyphs[i] = {
-            glyphs[i]->value<Range2Di>("rectangle").size(),
-            glyphs[i]->value<Vector2>("advance")
-        };
-
-    /* Fill character->glyph map */
-    const std::vector<Utility::ConfigurationGroup*> chars = _opened->conf.groups("char");
-    for(const Utility::ConfigurationGroup* const c: chars) {
-        const UnsignedInt glyphId = c->value<UnsignedInt>("glyph");
-        CORRADE_INTERNAL_ASSERT(glyphId < _opened->glyphs.size());
-        _opened->glyphId.emplace(c->value<char32_t>("unicode"), glyphId);
-    }
-
-    return {_opened->conf.value<Float>("fontSize"),
-            _opened->conf.value<Float>("ascent"),
-            _opened->conf.value<Float>("descent"),
-            _opened->conf.value<Float>("lineHeight"),
-            UnsignedInt(glyphs.size())};
+    return properties;
 }
 
 auto MagnumFont::doOpenFile(const Containers::StringView filename, const Float size) -> Properties {
     _opened.emplace();
     _opened->filePath.emplace(Utility::Path::split(filename).first());
 
+    /* If there's no file callback, memory-map the file. A binary file is
+       then used directly without copying the glyph tables anywhere, a text
+       file gets parsed from the mapped memory. */
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    if(!fileCallback()) {
+        /* If mapping fails, fall back to the default implementation which
+           prints an error message */
+        if(Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mapped = Utility::Path::mapRead(filename)) {
+            const bool binary = isBinary(*mapped);
+            const Properties properties = openDataInternal(*mapped, binary);
+            if(binary) _opened->mapped = *Utility::move(mapped);
+            return properties;
+        }
+    }
+    #endif
+
     return AbstractFont::doOpenFile(filename, size);
 }
 
 void MagnumFont::doGlyphIdsInto(const Containers::StridedArrayView1D<const char32_t>& characters, const Containers::StridedArrayView1D<UnsignedInt>& glyphs) {
-    for(std::size_t i = 0; i != characters.size(); ++i) {
-        auto it = _opened->glyphId.find(characters[i]);
-        glyphs[i] = it != _opened->glyphId.end() ? it->second : 0;
-    }
+    for(std::size_t i = 0; i != characters.size(); ++i)
+        glyphs[i] = glyphForCharacter(_opened->chars, characters[i]);
 }
 
 Vector2 MagnumFont::doGlyphSize(const UnsignedInt glyph) {
-    return Vector2{_opened->glyphs[glyph].size};
+    return Vector2{_opened->glyphs[glyph].rectangle.size()};
 }
 
 Vector2 MagnumFont::doGlyphAdvance(const UnsignedInt glyph) {
@@ -175,23 +293,23 @@ Containers::Pointer<AbstractGlyphCache> MagnumFont::doCreateGlyphCache() {
     };
     Containers::Pointer<Cache> cache{InPlaceInit,
         PixelFormat::R8Unorm,
-        _opened->conf.value<Vector2i>("originalImageSize"),
+        _opened->originalImageSize,
         PixelFormat::R8Unorm,
         _opened->image->size(),
-        _opened->conf.value<Vector2i>("padding")};
+        _opened->padding};
     cache->setProcessedImage({}, *_opened->image);
 
-    const std::vector<Utility::ConfigurationGroup*> glyphs = _opened->conf.groups("glyph");
+    const Containers::ArrayView<const MagnumFontBinaryGlyph> glyphs = _opened->glyphs;
 
     /* Set the global invalid glyph to the same as the per-font invalid
        glyph. */
-    if(!glyphs.empty())
-        cache->setInvalidGlyph(glyphs[0]->value<Vector2i>("position"), glyphs[0]->value<Range2Di>("rectangle"));
+    if(!glyphs.isEmpty())
+        cache->setInvalidGlyph(glyphs[0].position, glyphs[0].rectangle);
 
     /* Add a font, fill the glyph map */
     const UnsignedInt fontId = cache->addFont(glyphs.size(), this);
     for(std::size_t i = 0; i < glyphs.size(); ++i)
-        cache->addGlyph(fontId, i, glyphs[i]->value<Vector2i>("position"), glyphs[i]->value<Range2Di>("rectangle"));
+        cache->addGlyph(fontId, i, glyphs[i].position, glyphs[i].rectangle);
 
     /* GCC 4.8 needs extra help here */
     return Containers::Pointer<AbstractGlyphCache>{Utility::move(cache)};
@@ -210,9 +328,8 @@ Containers::Pointer<AbstractShaper> MagnumFont::doCreateShaper() {
             arrayReserve(_glyphs, text.size());
             for(std::size_t i = 0; i != text.size(); ) {
                 const Containers::Pair<char32_t, std::size_t> codepointNext = Utility::Unicode::nextChar(text, i);
-                const auto it = fontData.glyphId.find(codepointNext.first());
                 arrayAppend(_glyphs, InPlaceInit,
-                    it == fontData.glyphId.end() ? 0 : it->second,
+                    glyphForCharacter(fontData.chars, codepointNext.first()),
                     begin + UnsignedInt(i));
                 i = codepointNext.second();
             }
@@ -117,6 +117,19 @@ rectangle=45 0 44 25
 # ...
 @endcode
 
+@section Text-MagnumFont-binary Binary format
+
+Alternatively, the glyph and character tables can be stored in a binary file
+with a `.magnumfont` extension, which is produced by @ref MagnumFontConverter
+with the @cb{.ini} binary @ce
+@ref Text-MagnumFontConverter-configuration "configuration option" enabled.
+The format is detected from the file signature. If the file is opened with
+@ref openFile() and no file callback is set, the file is memory-mapped and the
+tables are used directly from it without any parsing or copying, which makes
+opening fonts with large character sets significantly faster. When opened
+through @ref openData() or with a file callback, the data are copied
+internally. Binary files are currently not supported on Big-Endian platforms.
+
 @section Text-MagnumFont-usage Usage
 
 @m_class{m-note m-success}
@@ -177,6 +190,7 @@ class MAGNUM_MAGNUMFONT_EXPORT MagnumFont: public AbstractFont {
         MAGNUM_MAGNUMFONT_LOCAL Properties doOpenData(Containers::ArrayView<const char> data, Float) override;
         MAGNUM_MAGNUMFONT_LOCAL Properties doOpenFile(Containers::StringView filename, Float) override;
         MAGNUM_MAGNUMFONT_LOCAL void doClose() override;
+        MAGNUM_MAGNUMFONT_LOCAL Properties openDataInternal(Containers::ArrayView<const char> data, bool dataPersistent);
 
         MAGNUM_MAGNUMFONT_LOCAL void doGlyphIdsInto(const Containers::StridedArrayView1D<const char32_t>& characters, const Containers::StridedArrayView1D<UnsignedInt>& glyphs) override;
         MAGNUM_MAGNUMFONT_LOCAL Vector2 doGlyphSize(UnsignedInt glyph) override;
@@ -0,0 +1,75 @@
+#ifndef Magnum_Text_MagnumFontBinary_h
+#define Magnum_Text_MagnumFontBinary_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Math/Range.h"
+
+/* Used by both MagnumFont and MagnumFontConverter, which is why it isn't
+   directly inside MagnumFont.cpp. OTOH it doesn't need to be exposed
+   publicly, which is why it has no docblocks. */
+
+namespace Magnum { namespace Text { namespace Implementation {
+
+/* Binary variant of the glyph and character tables. Little-endian, laid out
+   as the header, followed by the image filename padded to four bytes,
+   glyphCount MagnumFontBinaryGlyph items and charCount MagnumFontBinaryChar
+   items sorted by the codepoint. All items are four-byte aligned, so the
+   tables can be used directly from a memory-mapped file. */
+struct MagnumFontBinaryHeader {
+    char magic[8];              /* MGNFNTB\0 */
+    UnsignedInt version;        /* 1 */
+    UnsignedInt imageNameSize;  /* Without the null terminator and padding */
+    UnsignedInt glyphCount;
+    UnsignedInt charCount;
+    Vector2i originalImageSize;
+    Vector2i padding;
+    Float fontSize;
+    Float ascent;
+    Float descent;
+    Float lineHeight;
+};
+
+struct MagnumFontBinaryGlyph {
+    Vector2 advance;
+    Vector2i position;
+    Range2Di rectangle;
+};
+
+struct MagnumFontBinaryChar {
+    UnsignedInt unicode;
+    UnsignedInt glyph;
+};
+
+static_assert(sizeof(MagnumFontBinaryHeader) == 56, "MagnumFontBinaryHeader size is not 56 bytes");
+static_assert(sizeof(MagnumFontBinaryGlyph) == 40, "MagnumFontBinaryGlyph size is not 40 bytes");
+static_assert(sizeof(MagnumFontBinaryChar) == 8, "MagnumFontBinaryChar size is not 8 bytes");
+
+constexpr char MagnumFontBinaryMagic[]{'M', 'G', 'N', 'F', 'N', 'T', 'B', '\0'};
+
+}}}
+
+#endif
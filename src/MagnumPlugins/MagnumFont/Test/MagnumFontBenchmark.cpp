@@ -0,0 +1,212 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StringStl.h> /** @todo remove once AbstractFont is <string>-free */
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/FileCallback.h"
+#include "Magnum/Test/BenchmarkTester.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "MagnumPlugins/MagnumFont/MagnumFontBinary.h"
+#include "MagnumPlugins/TgaImporter/TgaHeader.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Text { namespace Test { namespace {
+
+struct MagnumFontBenchmark: Magnum::Test::BenchmarkTester {
+    explicit MagnumFontBenchmark();
+
+    void text();
+    void binary();
+
+    private:
+        /* Explicitly forbid system-wide plugin dependencies */
+        PluginManager::Manager<Trade::AbstractImporter> _importerManager{"nonexistent"};
+        PluginManager::Manager<AbstractFont> _fontManager{"nonexistent"};
+        std::string _text;
+        Containers::Array<char> _binary, _image;
+        Containers::Array<char32_t> _characters;
+};
+
+/* Roughly what a font with a few scripts and an accompanying set of symbols
+   would have */
+enum: UnsignedInt { GlyphCount = 8192 };
+
+/* The characters are listed in a shuffled order to exercise the sorting as
+   well. As 7919 is coprime with the glyph count, it's a permutation. */
+UnsignedInt characterForGlyph(const UnsignedInt glyph) {
+    return 0x20 + (glyph*7919) % GlyphCount;
+}
+
+Implementation::MagnumFontBinaryGlyph glyph(const UnsignedInt i) {
+    const Vector2i position{Int(i % 128)*8, Int(i/128)*16};
+    return {Vector2{Float(6 + i % 5), 0.0f}, {1, -3},
+            Range2Di::fromSize(position, {6, 14})};
+}
+
+std::string textFont() {
+    std::ostringstream out;
+    out << "version=1\n"
+           "image=font.tga\n"
+           "originalImageSize=1024 1024\n"
+           "padding=1 1\n"
+           "fontSize=16\n"
+           "ascent=12.5\n"
+           "descent=-3.75\n"
+           "lineHeight=18.25\n";
+    for(UnsignedInt i = 0; i != GlyphCount; ++i)
+        out << "[char]\n"
+               "unicode=" << std::hex << characterForGlyph(i) << std::dec << "\n"
+               "glyph=" << i << "\n";
+    for(UnsignedInt i = 0; i != GlyphCount; ++i) {
+        const Implementation::MagnumFontBinaryGlyph g = glyph(i);
+        out << "[glyph]\n"
+               "advance=" << g.advance.x() << " " << g.advance.y() << "\n"
+               "position=" << g.position.x() << " " << g.position.y() << "\n"
+               "rectangle=" << g.rectangle.left() << " " << g.rectangle.bottom() << " " << g.rectangle.right() << " " << g.rectangle.top() << "\n";
+    }
+    return out.str();
+}
+
+Containers::Array<char> binaryFont() {
+    const std::size_t glyphOffset = sizeof(Implementation::MagnumFontBinaryHeader) + 8;
+    const std::size_t charOffset = glyphOffset + GlyphCount*sizeof(Implementation::MagnumFontBinaryGlyph);
+    Containers::Array<char> out{ValueInit, charOffset + GlyphCount*sizeof(Implementation::MagnumFontBinaryChar)};
+
+    Implementation::MagnumFontBinaryHeader& header = *reinterpret_cast<Implementation::MagnumFontBinaryHeader*>(out.data());
+    std::memcpy(header.magic, Implementation::MagnumFontBinaryMagic, sizeof(header.magic));
+    header.version = 1;
+    header.imageNameSize = 8;
+    header.glyphCount = GlyphCount;
+    header.charCount = GlyphCount;
+    header.originalImageSize = {1024, 1024};
+    header.padding = {1, 1};
+    header.fontSize = 16.0f;
+    header.ascent = 12.5f;
+    header.descent = -3.75f;
+    header.lineHeight = 18.25f;
+    std::memcpy(out.data() + sizeof(Implementation::MagnumFontBinaryHeader), "font.tga", 8);
+
+    /* Unlike in the text file, characters in the binary file are required to
+       be sorted */
+    Implementation::MagnumFontBinaryGlyph* const glyphs = reinterpret_cast<Implementation::MagnumFontBinaryGlyph*>(out.data() + glyphOffset);
+    Implementation::MagnumFontBinaryChar* const chars = reinterpret_cast<Implementation::MagnumFontBinaryChar*>(out.data() + charOffset);
+    for(UnsignedInt i = 0; i != GlyphCount; ++i) {
+        glyphs[i] = glyph(i);
+        chars[characterForGlyph(i) - 0x20] = {characterForGlyph(i), i};
+    }
+
+    return out;
+}
+
+MagnumFontBenchmark::MagnumFontBenchmark() {
+    addBenchmarks({&MagnumFontBenchmark::text,
+                   &MagnumFontBenchmark::binary}, 5);
+
+    /* Run all benchmarks again measuring throughput and allocation count */
+    addThroughputBenchmarks({&MagnumFontBenchmark::text,
+                             &MagnumFontBenchmark::binary}, 5);
+    addAllocationBenchmarks({&MagnumFontBenchmark::text,
+                             &MagnumFontBenchmark::binary}, 3);
+
+    _text = textFont();
+    _binary = binaryFont();
+
+    /* A tiny grayscale glyph cache image, so its import doesn't dominate the
+       measurement */
+    _image = Containers::Array<char>{ValueInit, sizeof(Trade::Implementation::TgaHeader) + 16*16};
+    Trade::Implementation::TgaHeader& header = *reinterpret_cast<Trade::Implementation::TgaHeader*>(_image.data());
+    header.imageType = 3;
+    header.width = Utility::Endianness::littleEndian(UnsignedShort(16));
+    header.height = Utility::Endianness::littleEndian(UnsignedShort(16));
+    header.bpp = 8;
+
+    /* Every character once, plus one that isn't in the font */
+    _characters = Containers::Array<char32_t>{NoInit, GlyphCount + 1};
+    for(UnsignedInt i = 0; i != GlyphCount + 1; ++i)
+        _characters[i] = 0x20 + i;
+
+    /* Load the plugins directly from the build tree. Otherwise they're static
+       and already loaded. */
+    _fontManager.registerExternalManager(_importerManager);
+    #if defined(TGAIMPORTER_PLUGIN_FILENAME) && defined(MAGNUMFONT_PLUGIN_FILENAME)
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_importerManager.load(TGAIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_fontManager.load(MAGNUMFONT_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void MagnumFontBenchmark::text() {
+    Containers::Pointer<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+    font->setFileCallback([](const std::string&, InputFileCallbackPolicy, Containers::Array<char>& image) {
+        return Containers::optional(Containers::ArrayView<const char>(image));
+    }, _image);
+
+    Containers::Array<UnsignedInt> glyphs{NoInit, _characters.size()};
+    CORRADE_BENCHMARK(1) {
+        CORRADE_VERIFY(font->openData(Containers::arrayView(_text.data(), _text.size()), 0.0f));
+        font->glyphIdsInto(Containers::stridedArrayView(_characters), Containers::stridedArrayView(glyphs));
+        setThroughputBytes(_text.size());
+    }
+
+    CORRADE_COMPARE(font->glyphCount(), GlyphCount);
+    CORRADE_COMPARE(glyphs[characterForGlyph(1234) - 0x20], 1234);
+    CORRADE_COMPARE(glyphs[GlyphCount], 0);
+}
+
+void MagnumFontBenchmark::binary() {
+    #ifdef CORRADE_TARGET_BIG_ENDIAN
+    CORRADE_SKIP("Binary fonts are not supported on Big-Endian platforms.");
+    #endif
+
+    Containers::Pointer<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+    font->setFileCallback([](const std::string&, InputFileCallbackPolicy, Containers::Array<char>& image) {
+        return Containers::optional(Containers::ArrayView<const char>(image));
+    }, _image);
+
+    Containers::Array<UnsignedInt> glyphs{NoInit, _characters.size()};
+    CORRADE_BENCHMARK(1) {
+        CORRADE_VERIFY(font->openData(_binary, 0.0f));
+        font->glyphIdsInto(Containers::stridedArrayView(_characters), Containers::stridedArrayView(glyphs));
+        setThroughputBytes(_binary.size());
+    }
+
+    CORRADE_COMPARE(font->glyphCount(), GlyphCount);
+    CORRADE_COMPARE(glyphs[characterForGlyph(1234) - 0x20], 1234);
+    CORRADE_COMPARE(glyphs[GlyphCount], 0);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::MagnumFontBenchmark)
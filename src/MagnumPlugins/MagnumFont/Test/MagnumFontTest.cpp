@@ -30,10 +30,13 @@
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once AbstractFont is <string>-free */
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/FormatStl.h>
 #include <Corrade/Utility/Path.h>
 
 #include "Magnum/FileCallback.h"
@@ -53,6 +56,8 @@ struct MagnumFontTest: TestSuite::Tester {
 
     void nonexistent();
     void properties();
+    void binaryOpenData();
+    void binaryInvalid();
 
     void shape();
     void shapeEmpty();
@@ -66,6 +71,32 @@ struct MagnumFontTest: TestSuite::Tester {
     PluginManager::Manager<AbstractFont> _fontManager{"nonexistent"};
 };
 
+const struct {
+    const char* name;
+    const char* filename;
+} PropertiesData[]{
+    {"", "font.conf"},
+    {"binary", "font.magnumfont"}
+};
+
+const struct {
+    const char* name;
+    std::size_t size, offset;
+    UnsignedInt value;
+    const char* message;
+} BinaryInvalidData[]{
+    {"too short", 20, 0, 0,
+        "binary font file too short, expected at least 56 bytes but got 20"},
+    {"unsupported version", 232, 8, 2,
+        "unsupported binary file version, expected 1 but got 2"},
+    {"size mismatch", 231, 0, 0,
+        "binary font file size doesn't match, expected 232 bytes but got 231"},
+    {"glyph out of range", 232, 236, 4,
+        "character 1 references glyph 4 but only 4 glyphs are present"},
+    {"characters not sorted", 232, 232, 0x10,
+        "characters are not sorted"},
+};
+
 const struct {
     const char* name;
     const char* string;
@@ -79,8 +110,15 @@ const struct {
 };
 
 MagnumFontTest::MagnumFontTest() {
-    addTests({&MagnumFontTest::nonexistent,
-              &MagnumFontTest::properties});
+    addTests({&MagnumFontTest::nonexistent});
+
+    addInstancedTests({&MagnumFontTest::properties},
+        Containers::arraySize(PropertiesData));
+
+    addTests({&MagnumFontTest::binaryOpenData});
+
+    addInstancedTests({&MagnumFontTest::binaryInvalid},
+        Containers::arraySize(BinaryInvalidData));
 
     addInstancedTests({&MagnumFontTest::shape},
         Containers::arraySize(ShapeData));
@@ -113,9 +151,17 @@ void MagnumFontTest::nonexistent() {
 }
 
 void MagnumFontTest::properties() {
+    auto&& data = PropertiesData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifdef CORRADE_TARGET_BIG_ENDIAN
+    if(Containers::StringView{data.filename}.hasSuffix(".magnumfont"))
+        CORRADE_SKIP("Binary fonts are not supported on Big-Endian platforms.");
+    #endif
+
     Containers::Pointer<AbstractFont> font = _fontManager.instantiate("MagnumFont");
 
-    CORRADE_VERIFY(font->openFile(Utility::Path::join(MAGNUMFONT_TEST_DIR, "font.conf"), 0.0f));
+    CORRADE_VERIFY(font->openFile(Utility::Path::join(MAGNUMFONT_TEST_DIR, data.filename), 0.0f));
     CORRADE_COMPARE(font->size(), 16.0f);
     CORRADE_COMPARE(font->ascent(), 25.0f);
     CORRADE_COMPARE(font->descent(), -10.0f);
@@ -139,6 +185,65 @@ void MagnumFontTest::properties() {
     CORRADE_COMPARE(font->glyphAdvance(font->glyphId(U'W')), (Vector2{23.0f, 0.0f}));
 }
 
+void MagnumFontTest::binaryOpenData() {
+    #ifdef CORRADE_TARGET_BIG_ENDIAN
+    CORRADE_SKIP("Binary fonts are not supported on Big-Endian platforms.");
+    #endif
+
+    Containers::Pointer<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+
+    Containers::Optional<Containers::Array<char>> tga = Utility::Path::read(Utility::Path::join(MAGNUMFONT_TEST_DIR, "font.tga"));
+    CORRADE_VERIFY(tga);
+    font->setFileCallback([](const std::string&, InputFileCallbackPolicy, Containers::Array<char>& tga) {
+        return Containers::optional(Containers::ArrayView<const char>(tga));
+    }, *tga);
+
+    Containers::Optional<Containers::Array<char>> binary = Utility::Path::read(Utility::Path::join(MAGNUMFONT_TEST_DIR, "font.magnumfont"));
+    CORRADE_VERIFY(binary);
+    CORRADE_VERIFY(font->openData(*binary, 0.0f));
+
+    /* The data should be copied internally, so clearing the original
+       shouldn't affect anything */
+    for(char& i: *binary) i = '\xff';
+
+    CORRADE_COMPARE(font->size(), 16.0f);
+    CORRADE_COMPARE(font->lineHeight(), 39.7333f);
+    CORRADE_COMPARE(font->glyphCount(), 4);
+    CORRADE_COMPARE(font->glyphId(U'W'), 2);
+    CORRADE_COMPARE(font->glyphId(U'e'), 1);
+    CORRADE_COMPARE(font->glyphId(U'x'), 0);
+    CORRADE_COMPARE(font->glyphSize(2), (Vector2{8.0f, 44.0f}));
+    CORRADE_COMPARE(font->glyphAdvance(2), (Vector2{23.0f, 0.0f}));
+}
+
+void MagnumFontTest::binaryInvalid() {
+    auto&& data = BinaryInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifdef CORRADE_TARGET_BIG_ENDIAN
+    CORRADE_SKIP("Binary fonts are not supported on Big-Endian platforms.");
+    #endif
+
+    Containers::Pointer<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+
+    /* The errors happen before the image gets loaded, a file callback is
+       only needed to make openData() work at all */
+    font->setFileCallback([](const std::string&, InputFileCallbackPolicy, void*) {
+        return Containers::Optional<Containers::ArrayView<const char>>{};
+    });
+
+    Containers::Optional<Containers::Array<char>> binary = Utility::Path::read(Utility::Path::join(MAGNUMFONT_TEST_DIR, "font.magnumfont"));
+    CORRADE_VERIFY(binary);
+    CORRADE_COMPARE(binary->size(), 232);
+    if(data.value)
+        Utility::copy(Containers::arrayView(reinterpret_cast<const char*>(&data.value), 4), binary->sliceSize(data.offset, 4));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!font->openData(binary->prefix(data.size), 0.0f));
+    CORRADE_COMPARE(out.str(), Utility::formatString("Text::MagnumFont::openData(): {}\n", data.message));
+}
+
 void MagnumFontTest::shape() {
     auto&& data = ShapeData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
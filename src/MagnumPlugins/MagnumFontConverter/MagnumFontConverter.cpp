@@ -26,13 +26,15 @@
 
 #include "MagnumFontConverter.h"
 
-#include <algorithm> /* std::sort() */
+#include <algorithm> /* std::sort(), std::stable_sort() */
+#include <cstring>
 #include <sstream>
 #include <unordered_map>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/Triple.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Configuration.h>
 #include <Corrade/Utility/Path.h>
 
@@ -42,6 +44,7 @@
 #include "Magnum/Math/ConfigurationValue.h"
 #include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Text/AbstractGlyphCache.h"
+#include "MagnumPlugins/MagnumFont/MagnumFontBinary.h"
 #include "MagnumPlugins/TgaImageConverter/TgaImageConverter.h"
 
 namespace Magnum { namespace Text {
@@ -76,16 +79,7 @@ std::vector<std::pair<std::string, Containers::Array<char>>> MagnumFontConverter
         return {};
     }
 
-    Utility::Configuration configuration;
-
-    configuration.setValue("version", 1);
-    configuration.setValue("image", Utility::Path::split(filename).second() + ".tga");
-    configuration.setValue("originalImageSize", cache.size().xy());
-    configuration.setValue("padding", cache.padding());
-    configuration.setValue("fontSize", font.size());
-    configuration.setValue("ascent", font.ascent());
-    configuration.setValue("descent", font.descent());
-    configuration.setValue("lineHeight", font.lineHeight());
+    const std::string imageName = Utility::Path::split(filename).second() + ".tga";
 
     /* Get the glyphs and sort them for predictable output */
     std::vector<std::pair<UnsignedInt, std::pair<Vector2i, Range2Di>>> sortedGlyphs;
@@ -115,37 +109,104 @@ std::vector<std::pair<std::string, Containers::Array<char>>> MagnumFontConverter
     for(const std::pair<const UnsignedInt, UnsignedInt>& map: glyphIdMap)
         inverseGlyphIdMap[map.second] = map.first;
 
-    /* Character->glyph map, map glyph IDs to new ones */
-    for(const char32_t c: characters) {
-        Utility::ConfigurationGroup* group = configuration.addGroup("char");
-        const UnsignedInt glyphId = font.glyphId(c);
-        group->setValue("unicode", c);
-
-        /* Map old glyph ID to new, if not found, map to glyph 0 */
-        auto found = glyphIdMap.find(glyphId);
-        group->setValue("glyph", found == glyphIdMap.end() ? 0 : glyphIdMap.at(glyphId));
+    /* Character->glyph map, map glyph IDs to new ones. If not found, map to
+       glyph 0. */
+    Containers::Array<Implementation::MagnumFontBinaryChar> chars{NoInit, characters.size()};
+    for(std::size_t i = 0; i != characters.size(); ++i) {
+        auto found = glyphIdMap.find(font.glyphId(characters[i]));
+        chars[i] = {UnsignedInt(characters[i]), found == glyphIdMap.end() ? 0 : found->second};
     }
 
-    /* Save glyph properties in order which preserves their IDs, remove padding
+    /* Glyph properties in order which preserves their IDs, remove padding
        from the values so they aren't added twice when using the font later */
     /** @todo Some better way to handle this padding stuff */
-    for(UnsignedInt oldGlyphId: inverseGlyphIdMap) {
+    Containers::Array<Implementation::MagnumFontBinaryGlyph> glyphs{NoInit, inverseGlyphIdMap.size()};
+    for(std::size_t i = 0; i != inverseGlyphIdMap.size(); ++i) {
+        const UnsignedInt oldGlyphId = inverseGlyphIdMap[i];
         /** @todo this branch is messy, clean up; also there's now a
             distinction between a cache-global invalid glyph and font-local,
             what to do there? */
         Containers::Triple<Vector2i, Int, Range2Di> glyph =
             oldGlyphId ? cache.glyph(*fontId, oldGlyphId) : cache.glyph(0);
-        Utility::ConfigurationGroup* group = configuration.addGroup("glyph");
-        group->setValue("advance", font.glyphAdvance(oldGlyphId));
-        group->setValue("position", glyph.first() + cache.padding());
-        group->setValue("rectangle", glyph.third().padded(-cache.padding()));
+        glyphs[i] = {
+            font.glyphAdvance(oldGlyphId),
+            glyph.first() + cache.padding(),
+            glyph.third().padded(-cache.padding())
+        };
     }
 
-    std::ostringstream confOut;
-    configuration.save(confOut);
-    std::string confStr = confOut.str();
-    Containers::Array<char> confData{confStr.size()};
-    std::copy(confStr.begin(), confStr.end(), confData.begin());
+    Containers::Array<char> fontData;
+    std::string fontFilename;
+    if(configuration().value<bool>("binary")) {
+        #ifdef CORRADE_TARGET_BIG_ENDIAN
+        Error{} << "Text::MagnumFontConverter::exportFontToData(): binary output is not supported on Big-Endian platforms";
+        return {};
+        #else
+        /* Characters sorted by the codepoint so the importer can binary
+           search them directly. Stable sort so if a character is listed more
+           than once, the first occurence wins, same as with the text
+           format. */
+        std::stable_sort(chars.begin(), chars.end(),
+            [](const Implementation::MagnumFontBinaryChar& a, const Implementation::MagnumFontBinaryChar& b) {
+                return a.unicode < b.unicode;
+            });
+
+        const std::size_t glyphOffset = sizeof(Implementation::MagnumFontBinaryHeader) + ((imageName.size() + 3) & ~std::size_t{3});
+        const std::size_t charOffset = glyphOffset + glyphs.size()*sizeof(Implementation::MagnumFontBinaryGlyph);
+        /* Zero-init to have the image name padding deterministic */
+        fontData = Containers::Array<char>{ValueInit, charOffset + chars.size()*sizeof(Implementation::MagnumFontBinaryChar)};
+
+        Implementation::MagnumFontBinaryHeader header{};
+        std::memcpy(header.magic, Implementation::MagnumFontBinaryMagic, sizeof(header.magic));
+        header.version = 1;
+        header.imageNameSize = imageName.size();
+        header.glyphCount = glyphs.size();
+        header.charCount = chars.size();
+        header.originalImageSize = cache.size().xy();
+        header.padding = cache.padding();
+        header.fontSize = font.size();
+        header.ascent = font.ascent();
+        header.descent = font.descent();
+        header.lineHeight = font.lineHeight();
+        std::memcpy(fontData.data(), &header, sizeof(header));
+        std::memcpy(fontData.data() + sizeof(header), imageName.data(), imageName.size());
+        Utility::copy(Containers::arrayCast<const char>(Containers::arrayView(glyphs)), fontData.slice(glyphOffset, charOffset));
+        Utility::copy(Containers::arrayCast<const char>(Containers::arrayView(chars)), fontData.exceptPrefix(charOffset));
+        fontFilename = filename + ".magnumfont";
+        #endif
+
+    } else {
+        Utility::Configuration configuration;
+
+        configuration.setValue("version", 1);
+        configuration.setValue("image", imageName);
+        configuration.setValue("originalImageSize", cache.size().xy());
+        configuration.setValue("padding", cache.padding());
+        configuration.setValue("fontSize", font.size());
+        configuration.setValue("ascent", font.ascent());
+        configuration.setValue("descent", font.descent());
+        configuration.setValue("lineHeight", font.lineHeight());
+
+        for(const Implementation::MagnumFontBinaryChar& c: chars) {
+            Utility::ConfigurationGroup* group = configuration.addGroup("char");
+            group->setValue("unicode", char32_t(c.unicode));
+            group->setValue("glyph", c.glyph);
+        }
+
+        for(const Implementation::MagnumFontBinaryGlyph& glyph: glyphs) {
+            Utility::ConfigurationGroup* group = configuration.addGroup("glyph");
+            group->setValue("advance", glyph.advance);
+            group->setValue("position", glyph.position);
+            group->setValue("rectangle", glyph.rectangle);
+        }
+
+        std::ostringstream confOut;
+        configuration.save(confOut);
+        std::string confStr = confOut.str();
+        fontData = Containers::Array<char>{NoInit, confStr.size()};
+        std::copy(confStr.begin(), confStr.end(), fontData.begin());
+        fontFilename = filename + ".conf";
+    }
 
     /* Save cache image. Either the source image or the processed one if the
        cache has image processing. */
@@ -163,7 +224,7 @@ std::vector<std::pair<std::string, Containers::Array<char>>> MagnumFontConverter
     }
 
     std::vector<std::pair<std::string, Containers::Array<char>>> out;
-    out.emplace_back(filename + ".conf", Utility::move(confData));
+    out.emplace_back(fontFilename, Utility::move(fontData));
     out.emplace_back(filename + ".tga", *Utility::move(tgaData));
     return out;
 }
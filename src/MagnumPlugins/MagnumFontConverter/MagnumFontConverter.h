@@ -55,7 +55,9 @@ namespace Magnum { namespace Text {
 /**
 @brief MagnumFont converter plugin
 
-Expects filename prefix, creates two files, `prefix.conf` and `prefix.tga`. See
+Expects filename prefix, creates two files, `prefix.conf` and `prefix.tga`, or
+`prefix.magnumfont` and `prefix.tga` if the
+@ref Text-MagnumFontConverter-binary "binary output" is enabled. See
 @ref MagnumFont for more information about the font. The plugin requires the
 passed @ref AbstractGlyphCache to be 2D, have a format compatible with the
 @relativeref{Trade,TgaImageConverter} plugin and either not have
@@ -108,6 +110,26 @@ you need to instantiate a manager for them and register it with
 @snippet plugins.cpp MagnumFontConverter-imageconverter-register
 
 See @ref building, @ref cmake and @ref plugins for more information.
+
+@section Text-MagnumFontConverter-binary Binary output
+
+With the @cb{.ini} binary @ce
+@ref Text-MagnumFontConverter-configuration "configuration option" enabled,
+the glyph and character tables are saved into a `prefix.magnumfont` file in a
+binary format that the @ref MagnumFont plugin can use directly from a
+memory-mapped file, without parsing. The characters are sorted by their
+codepoint in the output. Binary output is currently not supported on Big-Endian
+platforms.
+
+@section Text-MagnumFontConverter-configuration Plugin-specific configuration
+
+It's possible to tune various output options through @ref configuration(). See
+below for all options and their default values:
+
+@snippet MagnumPlugins/MagnumFontConverter/MagnumFontConverter.conf configuration_
+
+See @ref plugins-configuration for more information and an example showing how
+to edit the configuration values.
 */
 class MAGNUM_MAGNUMFONTCONVERTER_EXPORT MagnumFontConverter: public Text::AbstractFontConverter {
     public:
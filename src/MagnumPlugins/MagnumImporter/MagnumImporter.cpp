@@ -0,0 +1,252 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MagnumImporter.h"
+
+#include <cstdint>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Trade/AnimationData.h"
+#include "Magnum/Trade/Data.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace Trade {
+
+struct MagnumImporter::State {
+    Containers::Array<char> data;
+    /* Chunk views into the data, sorted by type in the order they appear in
+       the file */
+    Containers::Array<Containers::ArrayView<const char>> animations;
+    Containers::Array<Containers::ArrayView<const char>> scenes;
+    Containers::Array<Containers::ArrayView<const char>> meshes;
+    Containers::Array<Containers::ArrayView<const char>> materials;
+    Containers::Array<Containers::ArrayView<const char>> images[3];
+};
+
+MagnumImporter::MagnumImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImporter{manager, plugin} {}
+
+MagnumImporter::~MagnumImporter() = default;
+
+ImporterFeatures MagnumImporter::doFeatures() const { return ImporterFeature::OpenData|ImporterFeature::ConcurrentImport; }
+
+bool MagnumImporter::doIsOpened() const { return !!_state; }
+
+void MagnumImporter::doClose() { _state = nullptr; }
+
+void MagnumImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dataFlags) {
+    Containers::Pointer<State> state{InPlaceInit};
+
+    /* Take over the existing array if it's aligned enough, copy the data
+       otherwise. The allocation is aligned to at least 8 bytes. */
+    if(dataFlags & (DataFlag::Owned|DataFlag::ExternallyOwned) && reinterpret_cast<std::uintptr_t>(data.data()) % 8 == 0) {
+        state->data = Utility::move(data);
+    } else {
+        state->data = Containers::Array<char>{NoInit, data.size()};
+        Utility::copy(data, state->data);
+    }
+
+    /* Go through all chunk headers. The chunk contents are validated only
+       once the data are actually requested. */
+    for(std::size_t offset = 0; offset != state->data.size(); ) {
+        const DataChunkHeader* const header = dataChunkHeaderDeserialize(state->data.exceptPrefix(offset));
+        if(!header) {
+            Error{} << "Trade::MagnumImporter::openData(): invalid chunk at offset" << offset;
+            return;
+        }
+
+        const Containers::ArrayView<const char> chunk = state->data.slice(offset, offset + header->size);
+        if(header->type == DataChunkType::Animation)
+            arrayAppend(state->animations, chunk);
+        else if(header->type == DataChunkType::Scene)
+            arrayAppend(state->scenes, chunk);
+        else if(header->type == DataChunkType::Mesh)
+            arrayAppend(state->meshes, chunk);
+        else if(header->type == DataChunkType::Material)
+            arrayAppend(state->materials, chunk);
+        else if(header->type == DataChunkType::Image) {
+            /* The dimension count is the first byte after the chunk header,
+               see ImageData::serializeInto() */
+            const UnsignedByte dimensions = header->size > sizeof(DataChunkHeader) ? chunk[sizeof(DataChunkHeader)] : 0;
+            if(dimensions < 1 || dimensions > 3) {
+                Error{} << "Trade::MagnumImporter::openData(): invalid image dimension count" << dimensions << "in a chunk at offset" << offset;
+                return;
+            }
+            arrayAppend(state->images[dimensions - 1], chunk);
+        } else {
+            Warning{} << "Trade::MagnumImporter::openData(): skipping unknown chunk" << header->type << "at offset" << offset;
+        }
+
+        offset += header->size;
+    }
+
+    _state = Utility::move(state);
+}
+
+Containers::Array<char> MagnumImporter::allocateCopy(const Containers::ArrayView<const char> data) {
+    Containers::Array<char> out = allocateData(data.size(), 8);
+    if(!out) return {};
+    Utility::copy(data, out);
+    return out;
+}
+
+UnsignedInt MagnumImporter::doAnimationCount() const { return _state->animations.size(); }
+
+Containers::Optional<AnimationData> MagnumImporter::doAnimation(const UnsignedInt id) {
+    Containers::Optional<AnimationData> animation = AnimationData::deserialize(_state->animations[id]);
+    if(!animation || flags() & ImporterFlag::ZeroCopy) return animation;
+
+    /* Copy the keyframe data and rebase all track views onto the copy. The
+       interpolators were already resolved by deserialize(). */
+    const Containers::ArrayView<const char> animationData = animation->data();
+    Containers::Array<char> data{NoInit, animationData.size()};
+    Utility::copy(animationData, data);
+    const auto rebase = [&](const void* const pointer, const std::size_t size) {
+        return size ? data.data() + (static_cast<const char*>(pointer) - animationData.data()) : data.data();
+    };
+
+    Containers::Array<AnimationTrackData> tracks{animation->trackCount()};
+    for(UnsignedInt i = 0; i != tracks.size(); ++i) {
+        const Animation::TrackViewStorage<const Float> track = animation->track(i);
+        const Containers::StridedArrayView1D<const Float> keys = track.keys();
+        const Containers::StridedArrayView1D<const void> values = track.values();
+        tracks[i] = AnimationTrackData{
+            animation->trackTargetName(i), animation->trackTarget(i),
+            animation->trackType(i), animation->trackResultType(i),
+            Containers::StridedArrayView1D<const Float>{data, reinterpret_cast<const Float*>(rebase(keys.data(), keys.size())), keys.size(), keys.stride()},
+            Containers::StridedArrayView1D<const void>{data, rebase(values.data(), values.size()), values.size(), values.stride()},
+            track.interpolation(), track.interpolator(),
+            track.before(), track.after()};
+    }
+
+    return AnimationData{Utility::move(data), Utility::move(tracks), animation->duration()};
+}
+
+UnsignedInt MagnumImporter::doSceneCount() const { return _state->scenes.size(); }
+
+Containers::Optional<SceneData> MagnumImporter::doScene(const UnsignedInt id) {
+    Containers::Optional<SceneData> scene = SceneData::deserialize(_state->scenes[id]);
+    if(!scene || flags() & ImporterFlag::ZeroCopy) return scene;
+
+    /* Fields of a deserialized scene are all offset-only, so they can be
+       copied as-is */
+    Containers::Array<char> data{NoInit, scene->data().size()};
+    Utility::copy(scene->data(), data);
+    Containers::Array<SceneFieldData> fields{scene->fieldCount()};
+    Utility::copy(scene->fieldData(), fields);
+
+    return SceneData{scene->mappingType(), scene->mappingBound(), Utility::move(data), Utility::move(fields)};
+}
+
+UnsignedInt MagnumImporter::doMeshCount() const { return _state->meshes.size(); }
+
+Containers::Optional<MeshData> MagnumImporter::doMesh(const UnsignedInt id, UnsignedInt) {
+    Containers::Optional<MeshData> mesh = MeshData::deserialize(_state->meshes[id]);
+    if(!mesh || flags() & ImporterFlag::ZeroCopy) return mesh;
+
+    Containers::Array<char> indexData = allocateCopy(mesh->indexData());
+    if(!indexData && !mesh->indexData().isEmpty()) return {};
+    Containers::Array<char> vertexData = allocateCopy(mesh->vertexData());
+    if(!vertexData && !mesh->vertexData().isEmpty()) return {};
+
+    MeshIndexData indices;
+    if(mesh->isIndexed())
+        indices = MeshIndexData{mesh->indexType(), Containers::StridedArrayView1D<const void>{indexData, indexData.data() + (mesh->indexCount() ? mesh->indexOffset() : 0), mesh->indexCount(), mesh->indexStride()}};
+
+    /* Attributes of a deserialized mesh are all offset-only, so they can be
+       copied as-is */
+    Containers::Array<MeshAttributeData> attributes{mesh->attributeData().size()};
+    Utility::copy(mesh->attributeData(), attributes);
+
+    if(allocator()) return MeshData{mesh->primitive(),
+        DataFlag::Mutable, indexData, indices,
+        DataFlag::Mutable, vertexData, Utility::move(attributes),
+        mesh->vertexCount()};
+
+    return MeshData{mesh->primitive(),
+        Utility::move(indexData), indices,
+        Utility::move(vertexData), Utility::move(attributes),
+        mesh->vertexCount()};
+}
+
+UnsignedInt MagnumImporter::doMaterialCount() const { return _state->materials.size(); }
+
+Containers::Optional<MaterialData> MagnumImporter::doMaterial(const UnsignedInt id) {
+    Containers::Optional<MaterialData> material = MaterialData::deserialize(_state->materials[id]);
+    if(!material || flags() & ImporterFlag::ZeroCopy) return material;
+
+    Containers::Array<MaterialAttributeData> attributes{material->attributeData().size()};
+    Utility::copy(material->attributeData(), attributes);
+    Containers::Array<UnsignedInt> layers{NoInit, material->layerData().size()};
+    Utility::copy(material->layerData(), layers);
+
+    return MaterialData{material->types(), Utility::move(attributes), Utility::move(layers)};
+}
+
+template<UnsignedInt dimensions> Containers::Optional<ImageData<dimensions>> MagnumImporter::doImage(const Containers::ArrayView<const char> chunk) {
+    Containers::Optional<ImageData<dimensions>> image = ImageData<dimensions>::deserialize(chunk);
+    if(!image || flags() & ImporterFlag::ZeroCopy) return image;
+
+    Containers::Array<char> data = allocateCopy(image->data());
+    if(!data && !image->data().isEmpty()) return {};
+
+    if(image->isCompressed()) {
+        if(allocator()) return ImageData<dimensions>{image->compressedStorage(), image->compressedFormat(), image->size(), DataFlag::Mutable, data, image->flags()};
+        return ImageData<dimensions>{image->compressedStorage(), image->compressedFormat(), image->size(), Utility::move(data), image->flags()};
+    }
+
+    if(allocator()) return ImageData<dimensions>{image->storage(), image->format(), image->formatExtra(), image->pixelSize(), image->size(), DataFlag::Mutable, data, image->flags()};
+    return ImageData<dimensions>{image->storage(), image->format(), image->formatExtra(), image->pixelSize(), image->size(), Utility::move(data), image->flags()};
+}
+
+UnsignedInt MagnumImporter::doImage1DCount() const { return _state->images[0].size(); }
+
+Containers::Optional<ImageData1D> MagnumImporter::doImage1D(const UnsignedInt id, UnsignedInt) {
+    return doImage<1>(_state->images[0][id]);
+}
+
+UnsignedInt MagnumImporter::doImage2DCount() const { return _state->images[1].size(); }
+
+Containers::Optional<ImageData2D> MagnumImporter::doImage2D(const UnsignedInt id, UnsignedInt) {
+    return doImage<2>(_state->images[1][id]);
+}
+
+UnsignedInt MagnumImporter::doImage3DCount() const { return _state->images[2].size(); }
+
+Containers::Optional<ImageData3D> MagnumImporter::doImage3D(const UnsignedInt id, UnsignedInt) {
+    return doImage<3>(_state->images[2][id]);
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(MagnumImporter, Magnum::Trade::MagnumImporter,
+    MAGNUM_TRADE_ABSTRACTIMPORTER_PLUGIN_INTERFACE)
@@ -0,0 +1,188 @@
+#ifndef Magnum_Trade_MagnumImporter_h
+#define Magnum_Trade_MagnumImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MagnumImporter
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+
+#include "MagnumPlugins/MagnumImporter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_MAGNUMIMPORTER_BUILD_STATIC
+    #if defined(MagnumImporter_EXPORTS) || defined(MagnumImporterObjects_EXPORTS)
+        #define MAGNUM_MAGNUMIMPORTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_MAGNUMIMPORTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_MAGNUMIMPORTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_MAGNUMIMPORTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_MAGNUMIMPORTER_EXPORT
+#define MAGNUM_MAGNUMIMPORTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Magnum blob importer plugin
+@m_since_latest
+
+Imports a sequence of serialized data chunks, as produced by the
+@ref MagnumSceneConverter plugin or by concatenating the output of
+@ref MeshData::serialize(), @ref SceneData::serialize(),
+@ref MaterialData::serialize(), @ref ImageData::serialize() and
+@ref AnimationData::serialize(). The format is platform-specific and meant
+for caching already processed assets, opening them takes just a pass over
+the chunk headers. See @ref DataChunkHeader for details about the format.
+
+@section Trade-MagnumImporter-usage Usage
+
+@m_class{m-note m-success}
+
+@par
+    This class is a plugin that's meant to be dynamically loaded and used
+    through the base @ref AbstractImporter interface. See its documentation for
+    introduction and usage examples.
+
+This plugin depends on the @ref Trade library and is built if
+`MAGNUM_WITH_MAGNUMIMPORTER` is enabled when building Magnum. To use as a
+dynamic plugin, load @cpp "MagnumImporter" @ce via
+@ref Corrade::PluginManager::Manager.
+
+Additionally, if you're using Magnum as a CMake subproject, do the following:
+
+@code{.cmake}
+set(MAGNUM_WITH_MAGNUMIMPORTER ON CACHE BOOL "" FORCE)
+add_subdirectory(magnum EXCLUDE_FROM_ALL)
+
+# So the dynamically loaded plugin gets built implicitly
+add_dependencies(your-app Magnum::MagnumImporter)
+@endcode
+
+To use as a static plugin or as a dependency of another plugin with CMake, you
+need to request the `MagnumImporter` component of the `Magnum` package and
+link to the `Magnum::MagnumImporter` target:
+
+@code{.cmake}
+find_package(Magnum REQUIRED MagnumImporter)
+
+# ...
+target_link_libraries(your-app PRIVATE Magnum::MagnumImporter)
+@endcode
+
+See @ref building, @ref cmake, @ref plugins and @ref file-formats for more
+information.
+
+@section Trade-MagnumImporter-behavior Behavior and limitations
+
+On @ref openData() / @ref openFile() the chunk headers are checked and the
+chunks are sorted by their @ref DataChunkType into meshes, scenes,
+materials, 1D, 2D and 3D images and animations, in the order they appear in
+the file. Chunks of unknown types are skipped with a warning. A chunk is
+deserialized and validated only once the corresponding @ref mesh(),
+@ref scene(), @ref material(), @ref image2D() etc. is called. Names, levels
+and importer state aren't stored in the format, so all data are unnamed,
+have a single level and the @ref importerState() is always
+@cpp nullptr @ce.
+
+The input data are expected to be aligned to eight bytes. If the data passed
+to @ref openData() are not, or if they're not @ref DataFlag::Owned or
+@ref DataFlag::ExternallyOwned, they're copied into an internal aligned
+allocation.
+
+By default the imported data are copied out of the file, with
+@ref MeshData::indexDataFlags(), @ref MeshData::vertexDataFlags(),
+@ref SceneData::dataFlags(), @ref ImageData::dataFlags() and
+@ref AnimationData::dataFlags() being @ref DataFlag::Owned and
+@ref DataFlag::Mutable. If an allocator is set via @ref setAllocator(),
+index, vertex and pixel data are allocated from it and the flags contain
+just @ref DataFlag::Mutable.
+
+With @ref ImporterFlag::ZeroCopy enabled, @ref openFile() maps the file
+instead of reading it into memory and all returned data reference the file
+directly, with the data flags being empty. The only allocations done are
+then for animation track lists, as those contain pointers that can't be
+stored in the file. The data are valid only until the importer is
+destructed, @ref close() is called or another file is opened.
+
+The plugin supports @ref ImporterFeature::ConcurrentImport, as no importer
+state is modified after opening.
+*/
+class MAGNUM_MAGNUMIMPORTER_EXPORT MagnumImporter: public AbstractImporter {
+    public:
+        /** @brief Plugin manager constructor */
+        explicit MagnumImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
+
+        ~MagnumImporter();
+
+    private:
+        struct State;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL ImporterFeatures doFeatures() const override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL bool doIsOpened() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL void doOpenData(Containers::Array<char>&& data, DataFlags dataFlags) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL void doClose() override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL UnsignedInt doAnimationCount() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Optional<AnimationData> doAnimation(UnsignedInt id) override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL UnsignedInt doSceneCount() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Optional<SceneData> doScene(UnsignedInt id) override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL UnsignedInt doMeshCount() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL UnsignedInt doMaterialCount() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Optional<MaterialData> doMaterial(UnsignedInt id) override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL UnsignedInt doImage1DCount() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Optional<ImageData1D> doImage1D(UnsignedInt id, UnsignedInt level) override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL UnsignedInt doImage2DCount() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level) override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL UnsignedInt doImage3DCount() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Optional<ImageData3D> doImage3D(UnsignedInt id, UnsignedInt level) override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Array<char> allocateCopy(Containers::ArrayView<const char> data);
+        template<UnsignedInt dimensions> MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Optional<ImageData<dimensions>> doImage(Containers::ArrayView<const char> chunk);
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
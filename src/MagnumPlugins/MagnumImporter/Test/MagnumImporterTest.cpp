@@ -0,0 +1,424 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/DebugStl.h>
+#include <Corrade/Utility/Endianness.h>
+#include <Corrade/Utility/FormatStl.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AnimationData.h"
+#include "Magnum/Trade/Data.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct MagnumImporterTest: TestSuite::Tester {
+    explicit MagnumImporterTest();
+
+    void empty();
+    void invalidChunk();
+    void invalidImageDimensions();
+    void unknownChunk();
+
+    void import();
+    void zeroCopy();
+    void customAllocator();
+    void invalidData();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+};
+
+const struct {
+    const char* name;
+    bool(*open)(AbstractImporter&, Containers::ArrayView<const void>);
+} OpenMemoryData[]{
+    {"data", [](AbstractImporter& importer, Containers::ArrayView<const void> data) {
+        /* Copy to ensure the original memory isn't referenced */
+        Containers::Array<char> copy{NoInit, data.size()};
+        Utility::copy(Containers::arrayCast<const char>(data), copy);
+        return importer.openData(copy);
+    }},
+    {"memory", [](AbstractImporter& importer, Containers::ArrayView<const void> data) {
+        return importer.openMemory(data);
+    }},
+};
+
+MagnumImporterTest::MagnumImporterTest() {
+    addTests({&MagnumImporterTest::empty,
+              &MagnumImporterTest::invalidChunk,
+              &MagnumImporterTest::invalidImageDimensions,
+              &MagnumImporterTest::unknownChunk});
+
+    addInstancedTests({&MagnumImporterTest::import},
+        Containers::arraySize(OpenMemoryData));
+
+    addTests({&MagnumImporterTest::zeroCopy,
+              &MagnumImporterTest::customAllocator,
+              &MagnumImporterTest::invalidData});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef MAGNUMIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(MAGNUMIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+const UnsignedShort MeshIndices[]{0, 2, 1};
+const Vector2 MeshPositions[]{{1.0f, 2.0f}, {3.0f, 4.0f}, {5.0f, 6.0f}};
+
+const struct SceneParent {
+    UnsignedInt mapping;
+    Int parent;
+} SceneParents[]{{0, -1}, {1, 0}};
+
+/* Row length of 4 bytes so the default alignment needs no padding */
+const char ImagePixels[]{
+    1, 2, 3, 4,
+    5, 6, 7, 8
+};
+
+const char CompressedImagePixels[]{
+    '\x11', '\x22', '\x33', '\x44', '\x55', '\x66', '\x77', '\x88'
+};
+
+const struct AnimationKeyframe {
+    Float time;
+    Vector3 translation;
+} AnimationKeyframes[]{
+    {0.0f, {1.0f, 2.0f, 3.0f}},
+    {1.0f, {3.0f, 4.0f, 5.0f}}
+};
+
+/* Concatenates serialized chunks into an allocation that's aligned to at
+   least 8 bytes, unlike a growable array on 32-bit platforms */
+Containers::Array<char> concatenate(std::initializer_list<Containers::ArrayView<const char>> chunks) {
+    std::size_t size = 0;
+    for(const Containers::ArrayView<const char> chunk: chunks)
+        size += chunk.size();
+
+    Containers::Array<char> out{ValueInit, size};
+    std::size_t offset = 0;
+    for(const Containers::ArrayView<const char> chunk: chunks) {
+        Utility::copy(chunk, out.sliceSize(offset, chunk.size()));
+        offset += chunk.size();
+    }
+    return out;
+}
+
+Containers::Array<char> serializedFile() {
+    const Containers::StridedArrayView1D<const SceneParent> parents = SceneParents;
+    const Containers::StridedArrayView1D<const AnimationKeyframe> keyframes = AnimationKeyframes;
+    return concatenate({
+        MeshData{MeshPrimitive::Triangles,
+            {}, MeshIndices, MeshIndexData{MeshIndices},
+            {}, MeshPositions, {
+                MeshAttributeData{MeshAttribute::Position, Containers::arrayView(MeshPositions)}
+            }}.serialize(),
+        SceneData{SceneMappingType::UnsignedInt, 2, {}, SceneParents, {
+            SceneFieldData{SceneField::Parent,
+                parents.slice(&SceneParent::mapping),
+                parents.slice(&SceneParent::parent)}
+        }}.serialize(),
+        *MaterialData{MaterialType::Phong, {
+            {MaterialAttribute::DiffuseColor, Color4{0.5f, 1.0f, 0.25f, 1.0f}},
+            {MaterialAttribute::Shininess, 3.5f}
+        }}.serialize(),
+        /* Two 1D images to verify the order is preserved */
+        ImageData1D{PixelFormat::R8Unorm, 4, {}, Containers::arrayView(ImagePixels).prefix(4)}.serialize(),
+        ImageData1D{PixelFormat::R8Unorm, 4, {}, Containers::arrayView(ImagePixels).exceptPrefix(4)}.serialize(),
+        ImageData2D{PixelFormat::RG8Unorm, {2, 2}, {}, ImagePixels}.serialize(),
+        ImageData3D{CompressedPixelFormat::Bc1RGBAUnorm, {4, 4, 1}, {}, CompressedImagePixels}.serialize(),
+        AnimationData{{}, AnimationKeyframes, {
+            AnimationTrackData{AnimationTrackTarget::Translation3D, 5,
+                keyframes.slice(&AnimationKeyframe::time),
+                keyframes.slice(&AnimationKeyframe::translation),
+                Animation::Interpolation::Linear}
+        }}.serialize()
+    });
+}
+
+void MagnumImporterTest::empty() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+
+    /* An empty file is a valid sequence of zero chunks */
+    CORRADE_VERIFY(importer->openData(nullptr));
+    CORRADE_COMPARE(importer->meshCount(), 0);
+    CORRADE_COMPARE(importer->sceneCount(), 0);
+    CORRADE_COMPARE(importer->materialCount(), 0);
+    CORRADE_COMPARE(importer->image1DCount(), 0);
+    CORRADE_COMPARE(importer->image2DCount(), 0);
+    CORRADE_COMPARE(importer->image3DCount(), 0);
+    CORRADE_COMPARE(importer->animationCount(), 0);
+}
+
+void MagnumImporterTest::invalidChunk() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+
+    /* The second chunk is cut in half */
+    Containers::Array<char> mesh = MeshData{MeshPrimitive::Points, 3}.serialize();
+    Containers::Array<char> data = concatenate({mesh, mesh.prefix(mesh.size()/2)});
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), Utility::formatString(
+        "Trade::dataChunkHeaderDeserialize(): expected {} bytes for a Trade::DataChunkType::Mesh chunk but got {}\n"
+        "Trade::MagnumImporter::openData(): invalid chunk at offset {}\n", mesh.size(), mesh.size()/2, mesh.size()));
+}
+
+void MagnumImporterTest::invalidImageDimensions() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+
+    Containers::Array<char> data = ImageData2D{PixelFormat::RG8Unorm, {2, 2}, {}, ImagePixels}.serialize();
+    data[sizeof(DataChunkHeader)] = 4;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MagnumImporter::openData(): invalid image dimension count 4 in a chunk at offset 0\n");
+}
+
+void MagnumImporterTest::unknownChunk() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+
+    Containers::Array<char> unknown = MeshData{MeshPrimitive::Lines, 2}.serialize();
+    reinterpret_cast<DataChunkHeader*>(unknown.data())->type = DataChunkType(Utility::Endianness::fourCC('T', 'e', 's', 't'));
+    Containers::Array<char> mesh = MeshData{MeshPrimitive::Points, 3}.serialize();
+
+    std::ostringstream out;
+    Warning redirectWarning{&out};
+    CORRADE_VERIFY(importer->openData(concatenate({unknown, mesh})));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+    CORRADE_COMPARE(out.str(), "Trade::MagnumImporter::openData(): skipping unknown chunk Trade::DataChunkType(0x74736554) at offset 0\n");
+
+    Containers::Optional<MeshData> imported = importer->mesh(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE(imported->vertexCount(), 3);
+}
+
+void MagnumImporterTest::import() {
+    auto&& data = OpenMemoryData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    Containers::Array<char> file = serializedFile();
+    CORRADE_VERIFY(data.open(*importer, file));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+    CORRADE_COMPARE(importer->sceneCount(), 1);
+    CORRADE_COMPARE(importer->materialCount(), 1);
+    CORRADE_COMPARE(importer->image1DCount(), 2);
+    CORRADE_COMPARE(importer->image2DCount(), 1);
+    CORRADE_COMPARE(importer->image3DCount(), 1);
+    CORRADE_COMPARE(importer->animationCount(), 1);
+
+    /* Close the importer after getting everything to verify the data are
+       all owned */
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    Containers::Optional<SceneData> scene = importer->scene(0);
+    Containers::Optional<MaterialData> material = importer->material(0);
+    Containers::Optional<ImageData1D> image1D = importer->image1D(1);
+    Containers::Optional<ImageData2D> image2D = importer->image2D(0);
+    Containers::Optional<ImageData3D> image3D = importer->image3D(0);
+    Containers::Optional<AnimationData> animation = importer->animation(0);
+    importer->close();
+    for(char& i: file) i = 0;
+
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->indexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+        Containers::arrayView(MeshIndices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh->attributeCount(), 1);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector2>(MeshAttribute::Position),
+        Containers::arrayView(MeshPositions),
+        TestSuite::Compare::Container);
+
+    CORRADE_VERIFY(scene);
+    CORRADE_COMPARE(scene->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(scene->mappingBound(), 2);
+    CORRADE_COMPARE_AS(scene->mapping<UnsignedInt>(SceneField::Parent),
+        Containers::arrayView<UnsignedInt>({0, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene->field<Int>(SceneField::Parent),
+        Containers::arrayView<Int>({-1, 0}),
+        TestSuite::Compare::Container);
+
+    CORRADE_VERIFY(material);
+    CORRADE_COMPARE(material->types(), MaterialType::Phong);
+    CORRADE_COMPARE(material->attributeDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(material->attribute<Color4>(MaterialAttribute::DiffuseColor), (Color4{0.5f, 1.0f, 0.25f, 1.0f}));
+    CORRADE_COMPARE(material->attribute<Float>(MaterialAttribute::Shininess), 3.5f);
+
+    CORRADE_VERIFY(image1D);
+    CORRADE_COMPARE(image1D->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(image1D->size(), 4);
+    CORRADE_COMPARE_AS(image1D->data(),
+        Containers::arrayView(ImagePixels).exceptPrefix(4),
+        TestSuite::Compare::Container);
+
+    CORRADE_VERIFY(image2D);
+    CORRADE_COMPARE(image2D->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(image2D->format(), PixelFormat::RG8Unorm);
+    CORRADE_COMPARE(image2D->size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE_AS(image2D->data(),
+        Containers::arrayView(ImagePixels),
+        TestSuite::Compare::Container);
+
+    CORRADE_VERIFY(image3D);
+    CORRADE_COMPARE(image3D->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_VERIFY(image3D->isCompressed());
+    CORRADE_COMPARE(image3D->compressedFormat(), CompressedPixelFormat::Bc1RGBAUnorm);
+    CORRADE_COMPARE(image3D->size(), (Vector3i{4, 4, 1}));
+    CORRADE_COMPARE_AS(image3D->data(),
+        Containers::arrayView(CompressedImagePixels),
+        TestSuite::Compare::Container);
+
+    CORRADE_VERIFY(animation);
+    CORRADE_COMPARE(animation->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(animation->duration(), (Range1D{0.0f, 1.0f}));
+    CORRADE_COMPARE(animation->trackCount(), 1);
+    CORRADE_COMPARE(animation->trackTargetName(0), AnimationTrackTarget::Translation3D);
+    CORRADE_COMPARE(animation->trackTarget(0), 5);
+    /* The interpolator is resolved from the stored interpolation */
+    CORRADE_COMPARE(animation->track(0).interpolation(), Animation::Interpolation::Linear);
+    CORRADE_COMPARE(animation->track<Vector3>(0).at(0.5f), (Vector3{2.0f, 3.0f, 4.0f}));
+}
+
+void MagnumImporterTest::zeroCopy() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    importer->addFlags(ImporterFlag::ZeroCopy);
+
+    Containers::Array<char> file = serializedFile();
+    CORRADE_VERIFY(importer->openMemory(file));
+
+    /* All data reference the memory passed to openMemory() */
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->indexDataFlags(), DataFlags{});
+    CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlags{});
+    CORRADE_VERIFY(mesh->vertexData().data() > file.data());
+    CORRADE_VERIFY(mesh->vertexData().data() < file.end());
+    CORRADE_COMPARE_AS(mesh->attribute<Vector2>(MeshAttribute::Position),
+        Containers::arrayView(MeshPositions),
+        TestSuite::Compare::Container);
+
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), DataFlags{});
+    CORRADE_VERIFY(image->data().data() > file.data());
+    CORRADE_VERIFY(image->data().data() < file.end());
+
+    Containers::Optional<AnimationData> animation = importer->animation(0);
+    CORRADE_VERIFY(animation);
+    CORRADE_COMPARE(animation->dataFlags(), DataFlags{});
+    CORRADE_VERIFY(animation->data().data() > file.data());
+    CORRADE_VERIFY(animation->data().data() < file.end());
+    CORRADE_COMPARE(animation->track<Vector3>(0).at(0.5f), (Vector3{2.0f, 3.0f, 4.0f}));
+}
+
+void MagnumImporterTest::customAllocator() {
+    struct Arena {
+        alignas(8) char data[64];
+        std::size_t offset;
+        std::size_t allocationCount;
+    } arena{};
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    importer->setAllocator([](std::size_t size, std::size_t alignment, void* userData) -> void* {
+        CORRADE_COMPARE(alignment, 8);
+        Arena& arena = *static_cast<Arena*>(userData);
+        char* const data = arena.data + arena.offset;
+        arena.offset += (size + 7)/8*8;
+        ++arena.allocationCount;
+        return data;
+    }, &arena);
+    CORRADE_VERIFY(importer->openData(serializedFile()));
+
+    /* Index and vertex data are allocated from the arena */
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(arena.allocationCount, 2);
+    CORRADE_COMPARE(mesh->indexDataFlags(), DataFlag::Mutable);
+    CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::Mutable);
+    CORRADE_COMPARE(mesh->indexData().data(), arena.data);
+    CORRADE_COMPARE(mesh->vertexData().data(), arena.data + 8);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+        Containers::arrayView(MeshIndices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector2>(MeshAttribute::Position),
+        Containers::arrayView(MeshPositions),
+        TestSuite::Compare::Container);
+
+    /* Pixel data as well */
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(arena.allocationCount, 3);
+    CORRADE_COMPARE(image->dataFlags(), DataFlag::Mutable);
+    CORRADE_COMPARE(image->data().data(), arena.data + 32);
+    CORRADE_COMPARE_AS(image->data(),
+        Containers::arrayView(ImagePixels),
+        TestSuite::Compare::Container);
+}
+
+void MagnumImporterTest::invalidData() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+
+    /* The chunk headers are valid, so opening succeeds and the error is
+       reported only when the data are accessed */
+    Containers::Array<char> data = MeshData{MeshPrimitive::Points, 3}.serialize();
+    reinterpret_cast<DataChunkHeader*>(data.data())->typeVersion = 99;
+    CORRADE_VERIFY(importer->openData(data));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(0));
+    CORRADE_COMPARE(out.str(), "Trade::MeshData::deserialize(): invalid chunk type version 99\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MagnumImporterTest)
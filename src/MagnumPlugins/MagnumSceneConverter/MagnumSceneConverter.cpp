@@ -0,0 +1,164 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MagnumSceneConverter.h"
+
+#include <cstdint>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Trade/AnimationData.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace Trade {
+
+MagnumSceneConverter::MagnumSceneConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractSceneConverter{manager, plugin} {}
+
+MagnumSceneConverter::~MagnumSceneConverter() = default;
+
+SceneConverterFeatures MagnumSceneConverter::doFeatures() const {
+    return SceneConverterFeature::ConvertMultipleToData|
+        SceneConverterFeature::AddScenes|
+        SceneConverterFeature::AddAnimations|
+        SceneConverterFeature::AddMeshes|
+        SceneConverterFeature::AddMaterials|
+        SceneConverterFeature::AddImages1D|
+        SceneConverterFeature::AddImages2D|
+        SceneConverterFeature::AddImages3D|
+        SceneConverterFeature::AddCompressedImages1D|
+        SceneConverterFeature::AddCompressedImages2D|
+        SceneConverterFeature::AddCompressedImages3D;
+}
+
+bool MagnumSceneConverter::doBeginData() {
+    _chunks = {};
+    return true;
+}
+
+Containers::Optional<Containers::Array<char>> MagnumSceneConverter::doEndData() {
+    std::size_t size = 0;
+    for(const Containers::Array<char>& chunk: _chunks)
+        size += chunk.size();
+
+    /* NoInit arrays are allocated with new[], which is guaranteed to be
+       aligned for any fundamental type */
+    Containers::Array<char> out{NoInit, size};
+    std::size_t offset = 0;
+    for(const Containers::Array<char>& chunk: _chunks) {
+        Utility::copy(chunk, out.sliceSize(offset, chunk.size()));
+        offset += chunk.size();
+    }
+
+    _chunks = {};
+    return Containers::optional(Utility::move(out));
+}
+
+void MagnumSceneConverter::doAbort() {
+    _chunks = {};
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const SceneData& scene, Containers::StringView) {
+    arrayAppend(_chunks, scene.serialize());
+    return true;
+}
+
+namespace {
+
+/* Same as the check in AnimationData::serializeInto(), which is an assertion
+   there */
+bool isTrackViewContained(const void* const begin, const UnsignedInt size, const std::ptrdiff_t stride, const std::size_t itemSize, const Containers::ArrayView<const char> data) {
+    if(!size) return true;
+    const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(begin);
+    const std::uintptr_t span = std::size_t(size - 1)*(stride < 0 ? -stride : stride);
+    const std::uintptr_t min = stride < 0 ? first - span : first;
+    const std::uintptr_t max = (stride < 0 ? first : first + span) + itemSize;
+    return min >= reinterpret_cast<std::uintptr_t>(data.begin()) &&
+        max <= reinterpret_cast<std::uintptr_t>(data.end());
+}
+
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const AnimationData& animation, Containers::StringView) {
+    /* Check what AnimationData::serializeInto() would assert on */
+    for(UnsignedInt i = 0; i != animation.trackCount(); ++i) {
+        const Animation::TrackViewStorage<const Float> track = animation.track(i);
+        if(track.interpolation() == Animation::Interpolation::Custom) {
+            Error{} << "Trade::MagnumSceneConverter::add(): can't serialize a custom interpolator of track" << i;
+            return false;
+        }
+
+        const Containers::StridedArrayView1D<const Float> keys = track.keys();
+        const Containers::StridedArrayView1D<const void> values = track.values();
+        if(!isTrackViewContained(keys.data(), keys.size(), keys.stride(), sizeof(Float), animation.data()) ||
+           !isTrackViewContained(values.data(), values.size(), values.stride(), animationTrackTypeSize(animation.trackType(i)), animation.data())) {
+            Error{} << "Trade::MagnumSceneConverter::add(): keys or values of track" << i << "are not contained in the data";
+            return false;
+        }
+    }
+
+    arrayAppend(_chunks, animation.serialize());
+    return true;
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const MeshData& mesh, Containers::StringView) {
+    arrayAppend(_chunks, mesh.serialize());
+    return true;
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const MaterialData& material, Containers::StringView) {
+    /* MaterialData::serialize() prints a message on its own */
+    Containers::Optional<Containers::Array<char>> serialized = material.serialize();
+    if(!serialized) return false;
+
+    arrayAppend(_chunks, *Utility::move(serialized));
+    return true;
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const ImageData1D& image, Containers::StringView) {
+    arrayAppend(_chunks, image.serialize());
+    return true;
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const ImageData2D& image, Containers::StringView) {
+    arrayAppend(_chunks, image.serialize());
+    return true;
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const ImageData3D& image, Containers::StringView) {
+    arrayAppend(_chunks, image.serialize());
+    return true;
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(MagnumSceneConverter, Magnum::Trade::MagnumSceneConverter,
+    MAGNUM_TRADE_ABSTRACTSCENECONVERTER_PLUGIN_INTERFACE)
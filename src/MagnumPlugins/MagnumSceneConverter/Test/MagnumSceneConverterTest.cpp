@@ -0,0 +1,244 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <sstream>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/AbstractSceneConverter.h"
+#include "Magnum/Trade/AnimationData.h"
+#include "Magnum/Trade/Data.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct MagnumSceneConverterTest: TestSuite::Tester {
+    explicit MagnumSceneConverterTest();
+
+    void convert();
+    void convertMesh();
+    void empty();
+
+    void animationCustomInterpolation();
+    void animationTrackNotContained();
+    void materialUnserializable();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractSceneConverter> _manager{"nonexistent"};
+};
+
+MagnumSceneConverterTest::MagnumSceneConverterTest() {
+    addTests({&MagnumSceneConverterTest::convert,
+              &MagnumSceneConverterTest::convertMesh,
+              &MagnumSceneConverterTest::empty,
+
+              &MagnumSceneConverterTest::animationCustomInterpolation,
+              &MagnumSceneConverterTest::animationTrackNotContained,
+              &MagnumSceneConverterTest::materialUnserializable});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef MAGNUMSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(MAGNUMSCENECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+const Vector2 MeshPositions[]{{1.0f, 2.0f}, {3.0f, 4.0f}, {5.0f, 6.0f}};
+
+const char ImagePixels[]{
+    1, 2, 3, 4,
+    5, 6, 7, 8
+};
+
+const struct AnimationKeyframe {
+    Float time;
+    Vector3 translation;
+} AnimationKeyframes[]{
+    {0.0f, {1.0f, 2.0f, 3.0f}},
+    {1.0f, {3.0f, 4.0f, 5.0f}}
+};
+
+Vector3 customLerp(const Vector3& a, const Vector3&, Float) { return a; }
+
+void MagnumSceneConverterTest::convert() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MagnumSceneConverter");
+
+    const Containers::StridedArrayView1D<const AnimationKeyframe> keyframes = AnimationKeyframes;
+
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_COMPARE(converter->add(MeshData{MeshPrimitive::Triangles,
+        {}, MeshPositions, {
+            MeshAttributeData{MeshAttribute::Position, Containers::arrayView(MeshPositions)}
+        }}), 0);
+    CORRADE_COMPARE(converter->add(MaterialData{MaterialType::Phong, {
+        {MaterialAttribute::Shininess, 3.5f}
+    }}), 0);
+    CORRADE_COMPARE(converter->add(ImageData2D{PixelFormat::RG8Unorm, {2, 2}, {}, ImagePixels}), 0);
+    CORRADE_COMPARE(converter->add(ImageData2D{PixelFormat::R8Unorm, {4, 2}, {}, ImagePixels}), 1);
+    CORRADE_COMPARE(converter->add(AnimationData{{}, AnimationKeyframes, {
+        AnimationTrackData{AnimationTrackTarget::Translation3D, 5,
+            keyframes.slice(&AnimationKeyframe::time),
+            keyframes.slice(&AnimationKeyframe::translation),
+            Animation::Interpolation::Linear}
+    }}), 0);
+
+    Containers::Optional<Containers::Array<char>> data = converter->endData();
+    CORRADE_VERIFY(data);
+
+    /* The chunks are concatenated in the order they were added */
+    Containers::ArrayView<const char> chunks = *data;
+
+    Containers::Optional<MeshData> mesh = MeshData::deserialize(chunks);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector2>(MeshAttribute::Position),
+        Containers::arrayView(MeshPositions),
+        TestSuite::Compare::Container);
+    chunks = chunks.exceptPrefix(dataChunkHeaderDeserialize(chunks)->size);
+
+    Containers::Optional<MaterialData> material = MaterialData::deserialize(chunks);
+    CORRADE_VERIFY(material);
+    CORRADE_COMPARE(material->types(), MaterialType::Phong);
+    CORRADE_COMPARE(material->attribute<Float>(MaterialAttribute::Shininess), 3.5f);
+    chunks = chunks.exceptPrefix(dataChunkHeaderDeserialize(chunks)->size);
+
+    Containers::Optional<ImageData2D> image = ImageData2D::deserialize(chunks);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), PixelFormat::RG8Unorm);
+    CORRADE_COMPARE(image->size(), (Vector2i{2, 2}));
+    chunks = chunks.exceptPrefix(dataChunkHeaderDeserialize(chunks)->size);
+
+    image = ImageData2D::deserialize(chunks);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(image->size(), (Vector2i{4, 2}));
+    CORRADE_COMPARE_AS(image->data(),
+        Containers::arrayView(ImagePixels),
+        TestSuite::Compare::Container);
+    chunks = chunks.exceptPrefix(dataChunkHeaderDeserialize(chunks)->size);
+
+    Containers::Optional<AnimationData> animation = AnimationData::deserialize(chunks);
+    CORRADE_VERIFY(animation);
+    CORRADE_COMPARE(animation->trackCount(), 1);
+    CORRADE_COMPARE(animation->trackTarget(0), 5);
+    CORRADE_COMPARE(animation->track<Vector3>(0).at(0.5f), (Vector3{2.0f, 3.0f, 4.0f}));
+    chunks = chunks.exceptPrefix(dataChunkHeaderDeserialize(chunks)->size);
+
+    CORRADE_VERIFY(chunks.isEmpty());
+}
+
+void MagnumSceneConverterTest::convertMesh() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MagnumSceneConverter");
+
+    /* Goes through beginData(), add() and endData() internally */
+    Containers::Optional<Containers::Array<char>> data = converter->convertToData(MeshData{MeshPrimitive::Points, 3});
+    CORRADE_VERIFY(data);
+
+    Containers::Optional<MeshData> mesh = MeshData::deserialize(*data);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE(mesh->vertexCount(), 3);
+    CORRADE_COMPARE(dataChunkHeaderDeserialize(*data)->size, data->size());
+}
+
+void MagnumSceneConverterTest::empty() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MagnumSceneConverter");
+
+    CORRADE_VERIFY(converter->beginData());
+    Containers::Optional<Containers::Array<char>> data = converter->endData();
+    CORRADE_VERIFY(data);
+    CORRADE_VERIFY(data->isEmpty());
+}
+
+void MagnumSceneConverterTest::animationCustomInterpolation() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MagnumSceneConverter");
+
+    const Containers::StridedArrayView1D<const AnimationKeyframe> keyframes = AnimationKeyframes;
+
+    CORRADE_VERIFY(converter->beginData());
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->add(AnimationData{{}, AnimationKeyframes, {
+        AnimationTrackData{AnimationTrackTarget::Translation3D, 5,
+            keyframes.slice(&AnimationKeyframe::time),
+            keyframes.slice(&AnimationKeyframe::translation),
+            Animation::Interpolation::Linear},
+        AnimationTrackData{AnimationTrackTarget::Translation3D, 6,
+            keyframes.slice(&AnimationKeyframe::time),
+            keyframes.slice(&AnimationKeyframe::translation),
+            customLerp}
+    }}));
+    CORRADE_COMPARE(out.str(), "Trade::MagnumSceneConverter::add(): can't serialize a custom interpolator of track 1\n");
+}
+
+void MagnumSceneConverterTest::animationTrackNotContained() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MagnumSceneConverter");
+
+    const Containers::StridedArrayView1D<const AnimationKeyframe> keyframes = AnimationKeyframes;
+
+    CORRADE_VERIFY(converter->beginData());
+
+    /* The data view covers only the first keyframe, the track both */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->add(AnimationData{{}, Containers::arrayView(AnimationKeyframes).prefix(1), {
+        AnimationTrackData{AnimationTrackTarget::Translation3D, 5,
+            keyframes.slice(&AnimationKeyframe::time),
+            keyframes.slice(&AnimationKeyframe::translation),
+            Animation::Interpolation::Linear}
+    }}));
+    CORRADE_COMPARE(out.str(), "Trade::MagnumSceneConverter::add(): keys or values of track 0 are not contained in the data\n");
+}
+
+void MagnumSceneConverterTest::materialUnserializable() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MagnumSceneConverter");
+
+    CORRADE_VERIFY(converter->beginData());
+
+    Int value;
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->add(MaterialData{{}, {
+        {"pointer", &value}
+    }}));
+    CORRADE_COMPARE(out.str(), "Trade::MaterialData::serializeInto(): can't serialize a Trade::MaterialAttributeType::Pointer attribute pointer\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MagnumSceneConverterTest)
@@ -26,60 +26,201 @@
 
 #include "ObjImporter.h"
 
-#include <fstream>
-#include <limits>
-#include <sstream>
-#include <unordered_map>
+#include <cmath>
+#include <cstring>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
-#include <Corrade/Containers/StringStl.h> /** @todo remove once iostream is dropped */
-#include <Corrade/Utility/DebugStl.h>
-#include <Corrade/Utility/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/Algorithms.h>
 
 #include "Magnum/Mesh.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Trade/MeshData.h"
 
+#if defined(CORRADE_BUILD_MULTITHREADED) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#include <thread>
+
+#define MAGNUM_OBJIMPORTER_THREADS
+#endif
+
 namespace Magnum { namespace Trade {
 
+using namespace Containers::Literals;
+
+namespace {
+
+struct Mesh {
+    /* Byte range in the file */
+    std::size_t begin, end;
+    /* View on the file data, empty if the mesh is unnamed */
+    Containers::StringView name;
+    /* Offsets to subtract from indices referenced by this mesh */
+    UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
+    /* Count of vertex data in this mesh, used to reserve memory upfront */
+    UnsignedInt positionCount, textureCoordinateCount, normalCount;
+};
+
+}
+
 struct ObjImporter::File {
-    std::unordered_map<std::string, UnsignedInt> meshesForName;
-    std::vector<std::string> meshNames;
-    std::vector<std::tuple<std::streampos, std::streampos, UnsignedInt, UnsignedInt, UnsignedInt>> meshes;
-    Containers::Pointer<std::istream> in;
+    Containers::Array<char> data;
+    Containers::Array<Mesh> meshes;
 };
 
 namespace {
 
-void ignoreLine(std::istream& in) {
-    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+/* The parsing is done directly on the file data, going line by line and
+   splitting each line into whitespace-separated tokens without allocating
+   anything. Number parsing is hand-written as well, as the standard library
+   functions either need null-terminated input or go through locales and
+   streams. */
+
+inline bool isWhitespace(const char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
 }
 
-template<std::size_t size> Math::Vector<size, Float> extractFloatData(const std::string& str, Float* extra = nullptr) {
-    std::vector<std::string> data = Utility::String::splitWithoutEmptyParts(str, ' ');
-    if(data.size() < size || data.size() > size + (extra ? 1 : 0)) {
-        Error() << "Trade::ObjImporter::mesh(): invalid float array size";
-        throw 0;
+inline bool isDigit(const char c) {
+    return UnsignedInt(c - '0') < 10;
+}
+
+/* Returns the next line with leading and trailing whitespace removed and
+   advances the pointer past it */
+Containers::StringView nextLine(const char*& i, const char* const end) {
+    const char* lineEnd = static_cast<const char*>(std::memchr(i, '\n', end - i));
+    if(!lineEnd) lineEnd = end;
+
+    const char* begin = i;
+    i = lineEnd == end ? end : lineEnd + 1;
+
+    while(begin != lineEnd && isWhitespace(*begin)) ++begin;
+    while(lineEnd != begin && isWhitespace(*(lineEnd - 1))) --lineEnd;
+    return {begin, std::size_t(lineEnd - begin)};
+}
+
+/* Returns the next whitespace-separated token or an empty view if there's
+   none, and advances the view past it */
+Containers::StringView nextToken(Containers::StringView& string) {
+    const char* i = string.begin();
+    const char* const end = string.end();
+    while(i != end && isWhitespace(*i)) ++i;
+    const char* const begin = i;
+    while(i != end && !isWhitespace(*i)) ++i;
+    string = string.suffix(i);
+    return {begin, std::size_t(i - begin)};
+}
+
+/* Parses a [+-]digits[.digits][(e|E)[+-]digits] float, expecting the whole
+   token to be consumed. Up to 18 significant digits are taken into account,
+   which is way more than enough for a float. */
+bool parseFloat(const Containers::StringView token, Float& out) {
+    const char* i = token.begin();
+    const char* const end = token.end();
+
+    bool negative = false;
+    if(i != end && (*i == '-' || *i == '+')) {
+        negative = *i == '-';
+        ++i;
+    }
+
+    UnsignedLong mantissa = 0;
+    Int exponent = 0;
+    std::size_t digitCount = 0;
+    for(; i != end && isDigit(*i); ++i, ++digitCount) {
+        if(mantissa < 100000000000000000ull)
+            mantissa = mantissa*10 + (*i - '0');
+        else ++exponent;
+    }
+    if(i != end && *i == '.') {
+        ++i;
+        for(; i != end && isDigit(*i); ++i, ++digitCount) {
+            if(mantissa < 100000000000000000ull) {
+                mantissa = mantissa*10 + (*i - '0');
+                --exponent;
+            }
+        }
+    }
+    if(!digitCount) return false;
+
+    if(i != end && (*i == 'e' || *i == 'E')) {
+        ++i;
+        bool negativeExponent = false;
+        if(i != end && (*i == '-' || *i == '+')) {
+            negativeExponent = *i == '-';
+            ++i;
+        }
+        Int value = 0;
+        std::size_t exponentDigitCount = 0;
+        for(; i != end && isDigit(*i); ++i, ++exponentDigitCount)
+            if(value < 10000) value = value*10 + (*i - '0');
+        if(!exponentDigitCount) return false;
+        exponent += negativeExponent ? -value : value;
     }
 
-    Math::Vector<size, Float> output;
+    if(i != end) return false;
+
+    /* Powers of ten up to 22 are exactly representable in a double, so for
+       those the result is correctly rounded */
+    constexpr Double Powers[]{
+        1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9,
+        1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16, 1.0e17,
+        1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22
+    };
+    Double value = Double(mantissa);
+    if(exponent < 0) value /= -exponent <= 22 ? Powers[-exponent] : std::pow(10.0, -exponent);
+    else if(exponent > 0) value *= exponent <= 22 ? Powers[exponent] : std::pow(10.0, exponent);
+
+    out = Float(negative ? -value : value);
+    return true;
+}
+
+/* Parses an unsigned integer, expecting the whole token to be consumed */
+bool parseUnsignedInt(const Containers::StringView token, UnsignedInt& out) {
+    if(token.isEmpty()) return false;
+
+    UnsignedLong value = 0;
+    for(const char c: token) {
+        if(!isDigit(c)) return false;
+        value = value*10 + (c - '0');
+        if(value > ~UnsignedInt{}) return false;
+    }
+
+    out = UnsignedInt(value);
+    return true;
+}
+
+template<std::size_t size> bool extractFloatData(Containers::StringView contents, Math::Vector<size, Float>& out, Float* extra = nullptr) {
+    /* Gather one more token than allowed to detect too many values */
+    Containers::StringView tokens[size + 2];
+    std::size_t count = 0;
+    for(Containers::StringView token; count != size + 2 && !(token = nextToken(contents)).isEmpty(); )
+        tokens[count++] = token;
+    if(count < size || count > size + (extra ? 1 : 0)) {
+        Error() << "Trade::ObjImporter::mesh(): invalid float array size";
+        return false;
+    }
 
-    for(std::size_t i = 0; i != size; ++i)
-        output[i] = std::stof(data[i]);
+    for(std::size_t i = 0; i != size; ++i) if(!parseFloat(tokens[i], out[i])) {
+        Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
+        return false;
+    }
 
-    if(data.size() == size+1) {
+    if(count == size + 1) {
         /* This should be obvious from the first if, but add this just to make
            Clang Analyzer happy */
         CORRADE_INTERNAL_ASSERT(extra);
 
-        *extra = std::stof(data.back());
+        if(!parseFloat(tokens[size], *extra)) {
+            Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
+            return false;
+        }
     }
 
-    return output;
+    return true;
 }
 
 }
@@ -96,23 +237,17 @@ void ObjImporter::doClose() { _file.reset(); }
 
 bool ObjImporter::doIsOpened() const { return !!_file; }
 
-void ObjImporter::doOpenFile(const Containers::StringView filename) {
-    /** @todo ARGH clean this up, won't work with UTF-8 */
-    Containers::Pointer<std::istream> in{new std::ifstream{filename, std::ios::binary}};
-    if(!in->good()) {
-        Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
-        return;
-    }
-
+void ObjImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dataFlags) {
     _file.reset(new File);
-    _file->in = Utility::move(in);
-    parseMeshNames();
-}
 
-void ObjImporter::doOpenData(Containers::Array<char>&& data, DataFlags) {
-    _file.reset(new File);
-    /** @todo ARGH MY EYES what is this cursed thing, burn it to the ground */
-    _file->in.reset(new std::istringstream{{data.begin(), data.size()}});
+    /* Take over the existing array or copy the data if we can't. Mesh names
+       are views on it, so it has to stay around for the whole lifetime. */
+    if(dataFlags & (DataFlag::Owned|DataFlag::ExternallyOwned)) {
+        _file->data = Utility::move(data);
+    } else {
+        _file->data = Containers::Array<char>{NoInit, data.size()};
+        Utility::copy(data, _file->data);
+    }
 
     parseMeshNames();
 }
@@ -123,102 +258,90 @@ void ObjImporter::parseMeshNames() {
     UnsignedInt positionIndexOffset = 1;
     UnsignedInt normalIndexOffset = 1;
     UnsignedInt textureCoordinateIndexOffset = 1;
-    _file->meshes.emplace_back(0, 0, positionIndexOffset, normalIndexOffset, textureCoordinateIndexOffset);
+    arrayAppend(_file->meshes, Mesh{0, 0, {}, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, 0, 0, 0});
 
     /* The first mesh doesn't have name by default but we might find it later,
        so we need to track whether there are any data before first name */
     bool thisIsFirstMeshAndItHasNoData = true;
-    _file->meshNames.emplace_back();
 
-    while(_file->in->good()) {
+    const char* const begin = _file->data.begin();
+    const char* const end = _file->data.end();
+    for(const char* i = begin; i != end; ) {
         /* The previous object might end at the beginning of this line */
-        const std::streampos end = _file->in->tellg();
+        const std::size_t lineBegin = i - begin;
+
+        Containers::StringView line = nextLine(i, end);
 
-        /* Comment line */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
+        /* Empty and comment lines */
+        if(line.isEmpty() || line.front() == '#')
             continue;
-        }
 
         /* Parse the keyword */
-        std::string keyword;
-        *_file->in >> keyword;
+        const Containers::StringView keyword = nextToken(line);
 
         /* Mesh name */
-        if(keyword == "o") {
-            std::string name;
-            std::getline(*_file->in, name);
-            name = Utility::String::trim(name);
+        if(keyword == "o"_s) {
+            const Containers::StringView name = line.trimmed();
 
             /* This is the name of first mesh */
             if(thisIsFirstMeshAndItHasNoData) {
                 thisIsFirstMeshAndItHasNoData = false;
 
-                /* Update its name and add it to name map */
-                if(!name.empty())
-                    _file->meshesForName.emplace(name, _file->meshes.size() - 1);
-                _file->meshNames.back() = Utility::move(name);
-
-                /* Update its begin offset to be more precise */
-                std::get<0>(_file->meshes.back()) = _file->in->tellg();
+                /* Update its name and begin offset to be more precise */
+                _file->meshes.back().name = name;
+                _file->meshes.back().begin = i - begin;
 
             /* Otherwise this is a name of new mesh */
             } else {
                 /* Set end of the previous one */
-                std::get<1>(_file->meshes.back()) = end;
+                _file->meshes.back().end = lineBegin;
 
                 /* Save name and offset of the new one. The end offset will be
                    updated later. */
-                if(!name.empty())
-                    _file->meshesForName.emplace(name, _file->meshes.size());
-                _file->meshNames.emplace_back(Utility::move(name));
-                _file->meshes.emplace_back(_file->in->tellg(), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
+                arrayAppend(_file->meshes, Mesh{std::size_t(i - begin), 0, name, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, 0, 0, 0});
             }
 
-            continue;
-
         /* If there are any data/indices before the first name, it means that
            the first object is unnamed. We need to check for them. */
 
         /* Vertex data, update index offset for the following meshes */
-        } else if(keyword == "v") {
+        } else if(keyword == "v"_s) {
             ++positionIndexOffset;
+            ++_file->meshes.back().positionCount;
             thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vt") {
+        } else if(keyword == "vt"_s) {
             ++textureCoordinateIndexOffset;
+            ++_file->meshes.back().textureCoordinateCount;
             thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vn") {
+        } else if(keyword == "vn"_s) {
             ++normalIndexOffset;
+            ++_file->meshes.back().normalCount;
             thisIsFirstMeshAndItHasNoData = false;
 
         /* Index data, just mark that we found something for first unnamed
            object */
-        } else if(thisIsFirstMeshAndItHasNoData) for(const std::string data: {"p", "l", "f"}) {
-            if(keyword == data) {
-                thisIsFirstMeshAndItHasNoData = false;
-                break;
-            }
+        } else if(keyword == "p"_s || keyword == "l"_s || keyword == "f"_s) {
+            thisIsFirstMeshAndItHasNoData = false;
         }
-
-        /* Ignore the rest of the line */
-        ignoreLine(*_file->in);
     }
 
     /* Set end of the last object */
-    _file->in->clear();
-    _file->in->seekg(0, std::ios::end);
-    std::get<1>(_file->meshes.back()) = _file->in->tellg();
+    _file->meshes.back().end = _file->data.size();
 }
 
 UnsignedInt ObjImporter::doMeshCount() const { return _file->meshes.size(); }
 
 Int ObjImporter::doMeshForName(const Containers::StringView name) {
-    const auto it = _file->meshesForName.find(name);
-    return it == _file->meshesForName.end() ? -1 : it->second;
+    /* A linear search is fine here, this isn't expected to be called in a
+       hot loop and it avoids building a hashmap on every open */
+    if(name.isEmpty()) return -1;
+    for(std::size_t i = 0; i != _file->meshes.size(); ++i)
+        if(_file->meshes[i].name == name) return i;
+    return -1;
 }
 
 Containers::String ObjImporter::doMeshName(UnsignedInt id) {
-    return _file->meshNames[id];
+    return _file->meshes[id].name;
 }
 
 namespace {
@@ -235,15 +358,7 @@ template<class T> bool checkAndDuplicateInto(const Containers::StridedArrayView1
     return true;
 }
 
-}
-
-Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt) {
-    /* Seek the file, set mesh parsing parameters */
-    std::streampos begin, end;
-    UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
-    std::tie(begin, end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset) = _file->meshes[id];
-    _file->in->seekg(begin);
-
+struct ParsedData {
     Containers::Optional<MeshPrimitive> primitive;
     Containers::Array<Vector3> positions;
     Containers::Array<Vector3> normals;
@@ -252,157 +367,286 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
        of data. First positions, then normals, then texture coordinates. */
     Containers::Array<Vector3ui> indices;
     std::size_t textureCoordinateIndexCount = 0, normalIndexCount = 0;
+};
 
-    try { while(_file->in->good() && _file->in->tellg() < end) {
-        /* Ignore comments */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
-        }
-
-        /* Get the line */
-        std::string line;
-        std::getline(*_file->in, line);
-        line = Utility::String::trim(line);
+/* Parses vertex and index data in given range, which is expected to start at
+   a line beginning. Prints a message and returns false on error. */
+bool parseMeshData(const char* const begin, const char* const end, const UnsignedInt positionIndexOffset, const UnsignedInt textureCoordinateIndexOffset, const UnsignedInt normalIndexOffset, ParsedData& out) {
+    for(const char* i = begin; i != end; ) {
+        Containers::StringView contents = nextLine(i, end);
 
-        /* Ignore empty lines */
-        if(line.empty()) continue;
+        /* Ignore empty lines and comments */
+        if(contents.isEmpty() || contents.front() == '#') continue;
 
         /* Split the line into keyword and contents */
-        const std::size_t keywordEnd = line.find(' ');
-        const std::string keyword = line.substr(0, keywordEnd);
-        const std::string contents = keywordEnd != std::string::npos ?
-            Utility::String::ltrim(line.substr(keywordEnd+1)) : "";
+        const Containers::StringView keyword = nextToken(contents);
 
         /* Vertex position */
-        if(keyword == "v") {
+        if(keyword == "v"_s) {
             Float extra{1.0f};
-            const Vector3 data = extractFloatData<3>(contents, &extra);
+            Vector3 data;
+            if(!extractFloatData<3>(contents, data, &extra))
+                return false;
             if(!Math::TypeTraits<Float>::equals(extra, 1.0f)) {
                 Error() << "Trade::ObjImporter::mesh(): homogeneous coordinates are not supported";
-                return Containers::NullOpt;
+                return false;
             }
 
-            arrayAppend(positions, data);
+            arrayAppend(out.positions, data);
 
         /* Texture coordinate */
-        } else if(keyword == "vt") {
+        } else if(keyword == "vt"_s) {
             Float extra{0.0f};
-            const Vector2 data = extractFloatData<2>(contents, &extra);
+            Vector2 data;
+            if(!extractFloatData<2>(contents, data, &extra))
+                return false;
             if(!Math::TypeTraits<Float>::equals(extra, 0.0f)) {
                 Error() << "Trade::ObjImporter::mesh(): 3D texture coordinates are not supported";
-                return Containers::NullOpt;
+                return false;
             }
 
-            arrayAppend(textureCoordinates, data);
+            arrayAppend(out.textureCoordinates, data);
 
         /* Normal */
-        } else if(keyword == "vn") {
-            arrayAppend(normals, Vector3{extractFloatData<3>(contents)});
+        } else if(keyword == "vn"_s) {
+            Vector3 data;
+            if(!extractFloatData<3>(contents, data))
+                return false;
+
+            arrayAppend(out.normals, data);
 
         /* Indices */
-        } else if(keyword == "p" || keyword == "l" || keyword == "f") {
-            const std::vector<std::string> indexTuples = Utility::String::splitWithoutEmptyParts(contents, ' ');
+        } else if(keyword == "p"_s || keyword == "l"_s || keyword == "f"_s) {
+            /* Gather up to four index tuples, which is enough to detect
+               polygons */
+            Containers::StringView indexTuples[4];
+            std::size_t indexTupleCount = 0;
+            for(Containers::StringView token; indexTupleCount != 4 && !(token = nextToken(contents)).isEmpty(); )
+                indexTuples[indexTupleCount++] = token;
 
             /* Points */
-            if(keyword == "p") {
+            if(keyword == "p"_s) {
                 /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Points) {
-                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Points;
-                    return Containers::NullOpt;
+                if(out.primitive && out.primitive != MeshPrimitive::Points) {
+                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *out.primitive << "and" << MeshPrimitive::Points;
+                    return false;
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 1) {
+                if(indexTupleCount != 1) {
                     Error() << "Trade::ObjImporter::mesh(): wrong index count for point";
-                    return Containers::NullOpt;
+                    return false;
                 }
 
-                primitive = MeshPrimitive::Points;
+                out.primitive = MeshPrimitive::Points;
 
             /* Lines */
-            } else if(keyword == "l") {
+            } else if(keyword == "l"_s) {
                 /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Lines) {
-                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Lines;
-                    return Containers::NullOpt;
+                if(out.primitive && out.primitive != MeshPrimitive::Lines) {
+                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *out.primitive << "and" << MeshPrimitive::Lines;
+                    return false;
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 2) {
+                if(indexTupleCount != 2) {
                     Error() << "Trade::ObjImporter::mesh(): wrong index count for line";
-                    return Containers::NullOpt;
+                    return false;
                 }
 
-                primitive = MeshPrimitive::Lines;
+                out.primitive = MeshPrimitive::Lines;
 
             /* Faces */
-            } else if(keyword == "f") {
+            } else if(keyword == "f"_s) {
                 /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Triangles) {
-                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Triangles;
-                    return Containers::NullOpt;
+                if(out.primitive && out.primitive != MeshPrimitive::Triangles) {
+                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *out.primitive << "and" << MeshPrimitive::Triangles;
+                    return false;
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() < 3) {
+                if(indexTupleCount < 3) {
                     Error() << "Trade::ObjImporter::mesh(): wrong index count for triangle";
-                    return Containers::NullOpt;
-                } else if(indexTuples.size() != 3) {
+                    return false;
+                } else if(indexTupleCount != 3) {
                     Error() << "Trade::ObjImporter::mesh(): polygons are not supported";
-                    return Containers::NullOpt;
+                    return false;
                 }
 
-                primitive = MeshPrimitive::Triangles;
+                out.primitive = MeshPrimitive::Triangles;
 
             } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 
-            for(const std::string& indexTuple: indexTuples) {
-                std::vector<std::string> indexStrings = Utility::String::split(indexTuple, '/');
-                if(indexStrings.size() > 3) {
+            for(std::size_t j = 0; j != indexTupleCount; ++j) {
+                /* Split the tuple on slashes, gathering one more part than
+                   allowed to detect invalid tuples */
+                Containers::StringView indexStrings[4];
+                std::size_t indexStringCount = 0;
+                for(const char *k = indexTuples[j].begin(), *partBegin = k; indexStringCount != 4; ++k) {
+                    if(k == indexTuples[j].end() || *k == '/') {
+                        indexStrings[indexStringCount++] = {partBegin, std::size_t(k - partBegin)};
+                        if(k == indexTuples[j].end()) break;
+                        partBegin = k + 1;
+                    }
+                }
+                if(indexStringCount > 3) {
                     Error() << "Trade::ObjImporter::mesh(): invalid index data";
-                    return Containers::NullOpt;
+                    return false;
                 }
 
                 Vector3ui index;
+                bool valid = true;
 
                 /* Position indices */
-                index[0] = std::stoul(indexStrings[0]) - positionIndexOffset;
+                valid = valid && parseUnsignedInt(indexStrings[0], index[0]);
+                index[0] -= positionIndexOffset;
 
                 /* Texture coordinates */
-                if(indexStrings.size() == 2 || (indexStrings.size() == 3 && !indexStrings[1].empty())) {
-                    index[2] = std::stoul(indexStrings[1]) - textureCoordinateIndexOffset;
-                    ++textureCoordinateIndexCount;
+                if(indexStringCount == 2 || (indexStringCount == 3 && !indexStrings[1].isEmpty())) {
+                    valid = valid && parseUnsignedInt(indexStrings[1], index[2]);
+                    index[2] -= textureCoordinateIndexOffset;
+                    ++out.textureCoordinateIndexCount;
                 }
 
                 /* Normal indices */
-                if(indexStrings.size() == 3) {
-                    index[1] = std::stoul(indexStrings[2]) - normalIndexOffset;
-                    ++normalIndexCount;
+                if(indexStringCount == 3) {
+                    valid = valid && parseUnsignedInt(indexStrings[2], index[1]);
+                    index[1] -= normalIndexOffset;
+                    ++out.normalIndexCount;
+                }
+
+                if(!valid) {
+                    Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
+                    return false;
                 }
 
-                arrayAppend(indices, index);
+                arrayAppend(out.indices, index);
             }
 
         /* Ignore unsupported keywords, error out on unknown keywords */
-        } else if(![&keyword](){
-            /* Using lambda to emulate for-else construct like in Python */
-            for(const std::string expected: {"mtllib", "usemtl", "g", "s"})
-                if(keyword == expected) return true;
-            return false;
-        }()) {
+        } else if(keyword != "mtllib"_s && keyword != "usemtl"_s &&
+                  keyword != "g"_s && keyword != "s"_s) {
             Error() << "Trade::ObjImporter::mesh(): unknown keyword" << keyword;
-            return Containers::NullOpt;
+            return false;
         }
+    }
 
-    }} catch(const std::exception&) {
-        Error() << "Trade::ObjImporter::mesh(): error while converting numeric data";
-        return Containers::NullOpt;
-    } catch(...) {
-        /* Error message already printed */
-        return Containers::NullOpt;
+    return true;
+}
+
+#ifdef MAGNUM_OBJIMPORTER_THREADS
+/* Ranges smaller than this aren't worth splitting */
+constexpr std::size_t MinParallelChunkSize = 256*1024;
+
+/* Splits the range into chunks at line boundaries, parses each on a separate
+   thread and concatenates the results. Doesn't print anything, if any chunk
+   fails or primitives in different chunks don't match, returns false and the
+   caller is expected to parse the range again serially to get the error
+   message corresponding to the first error in the file. */
+bool parseMeshDataParallel(const char* const begin, const char* const end, const std::size_t chunkCount, const UnsignedInt positionIndexOffset, const UnsignedInt textureCoordinateIndexOffset, const UnsignedInt normalIndexOffset, ParsedData& out) {
+    Containers::Array<const char*> boundaries{NoInit, chunkCount + 1};
+    boundaries[0] = begin;
+    boundaries[chunkCount] = end;
+    for(std::size_t i = 1; i != chunkCount; ++i) {
+        const char* const split = begin + (end - begin)*i/chunkCount;
+        const char* const from = split < boundaries[i - 1] ? boundaries[i - 1] : split;
+        const char* const newline = static_cast<const char*>(std::memchr(from, '\n', end - from));
+        boundaries[i] = newline ? newline + 1 : end;
     }
 
+    /* The first chunk is parsed on the calling thread. Error output is
+       redirected per-thread, so it's silenced in each thread separately. */
+    Containers::Array<ParsedData> chunks{chunkCount};
+    Containers::Array<bool> succeeded{ValueInit, chunkCount};
+    Containers::Array<std::thread> threads{chunkCount - 1};
+    for(std::size_t i = 1; i != chunkCount; ++i) threads[i - 1] = std::thread{[&, i]() {
+        Error redirectError{nullptr};
+        succeeded[i] = parseMeshData(boundaries[i], boundaries[i + 1], positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, chunks[i]);
+    }};
+    {
+        Error redirectError{nullptr};
+        succeeded[0] = parseMeshData(boundaries[0], boundaries[1], positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, chunks[0]);
+    }
+    for(std::thread& thread: threads) thread.join();
+
+    std::size_t positionCount = 0, normalCount = 0, textureCoordinateCount = 0, indexCount = 0;
+    for(std::size_t i = 0; i != chunkCount; ++i) {
+        const ParsedData& chunk = chunks[i];
+        if(!succeeded[i]) return false;
+        if(chunk.primitive) {
+            if(out.primitive && out.primitive != chunk.primitive) return false;
+            out.primitive = chunk.primitive;
+        }
+        positionCount += chunk.positions.size();
+        normalCount += chunk.normals.size();
+        textureCoordinateCount += chunk.textureCoordinates.size();
+        indexCount += chunk.indices.size();
+        out.textureCoordinateIndexCount += chunk.textureCoordinateIndexCount;
+        out.normalIndexCount += chunk.normalIndexCount;
+    }
+
+    /* Concatenate the per-chunk data */
+    out.positions = Containers::Array<Vector3>{NoInit, positionCount};
+    out.normals = Containers::Array<Vector3>{NoInit, normalCount};
+    out.textureCoordinates = Containers::Array<Vector2>{NoInit, textureCoordinateCount};
+    out.indices = Containers::Array<Vector3ui>{NoInit, indexCount};
+    std::size_t positionOffset = 0, normalOffset = 0, textureCoordinateOffset = 0, indexOffset = 0;
+    for(const ParsedData& chunk: chunks) {
+        Utility::copy(chunk.positions, out.positions.sliceSize(positionOffset, chunk.positions.size()));
+        Utility::copy(chunk.normals, out.normals.sliceSize(normalOffset, chunk.normals.size()));
+        Utility::copy(chunk.textureCoordinates, out.textureCoordinates.sliceSize(textureCoordinateOffset, chunk.textureCoordinates.size()));
+        Utility::copy(chunk.indices, out.indices.sliceSize(indexOffset, chunk.indices.size()));
+        positionOffset += chunk.positions.size();
+        normalOffset += chunk.normals.size();
+        textureCoordinateOffset += chunk.textureCoordinates.size();
+        indexOffset += chunk.indices.size();
+    }
+
+    return true;
+}
+#endif
+
+}
+
+Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt) {
+    /* Set mesh parsing parameters */
+    const Mesh& mesh = _file->meshes[id];
+    const UnsignedInt positionIndexOffset = mesh.positionIndexOffset;
+    const UnsignedInt textureCoordinateIndexOffset = mesh.textureCoordinateIndexOffset;
+    const UnsignedInt normalIndexOffset = mesh.normalIndexOffset;
+    const char* const begin = _file->data.begin() + mesh.begin;
+    const char* const end = _file->data.begin() + mesh.end;
+
+    ParsedData parsed;
+    bool parsedInParallel = false;
+    #ifdef MAGNUM_OBJIMPORTER_THREADS
+    std::size_t threadCount = configuration().value<UnsignedInt>("threads");
+    if(!threadCount)
+        threadCount = Math::max(std::thread::hardware_concurrency(), 1u);
+    const std::size_t chunkCount = Math::min(threadCount, Math::max(std::size_t(end - begin)/MinParallelChunkSize, std::size_t{1}));
+    if(chunkCount > 1)
+        parsedInParallel = parseMeshDataParallel(begin, end, chunkCount, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, parsed);
+    #endif
+
+    /* Parse serially if parallel parsing is disabled, not worth it or if it
+       failed, in which case this prints the actual error */
+    if(!parsedInParallel) {
+        parsed = ParsedData{};
+        arrayReserve(parsed.positions, mesh.positionCount);
+        arrayReserve(parsed.normals, mesh.normalCount);
+        arrayReserve(parsed.textureCoordinates, mesh.textureCoordinateCount);
+        if(!parseMeshData(begin, end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, parsed))
+            return Containers::NullOpt;
+    }
+
+    const Containers::Optional<MeshPrimitive>& primitive = parsed.primitive;
+    const Containers::Array<Vector3>& positions = parsed.positions;
+    const Containers::Array<Vector3>& normals = parsed.normals;
+    const Containers::Array<Vector2>& textureCoordinates = parsed.textureCoordinates;
+    Containers::Array<Vector3ui>& indices = parsed.indices;
+    const std::size_t textureCoordinateIndexCount = parsed.textureCoordinateIndexCount;
+    const std::size_t normalIndexCount = parsed.normalIndexCount;
+
     /* There should be at least indexed position data */
     if(positions.isEmpty() || indices.isEmpty()) {
         Error() << "Trade::ObjImporter::mesh(): incomplete position data";
@@ -433,7 +677,8 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
 
     /* Merge index arrays. If any of the attributes was not there, the whole
        index array has zeros, not affecting the uniqueness in any way. */
-    Containers::Array<char> indexData{NoInit, indices.size()*sizeof(UnsignedInt)};
+    Containers::Array<char> indexData = allocateData(indices.size()*sizeof(UnsignedInt), alignof(UnsignedInt));
+    if(!indexData && !indices.isEmpty()) return Containers::NullOpt;
     const auto indexDataI = Containers::arrayCast<UnsignedInt>(indexData);
     const std::size_t vertexCount = MeshTools::removeDuplicatesInPlaceInto(
         Containers::arrayCast<2, char>(arrayView(indices)), indexDataI);
@@ -450,7 +695,8 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
         stride += sizeof(Vector2);
     }
     Containers::Array<MeshAttributeData> attributeData{attributeCount};
-    Containers::Array<char> vertexData{NoInit, vertexCount*stride};
+    Containers::Array<char> vertexData = allocateData(vertexCount*stride, alignof(Vector3));
+    if(!vertexData && vertexCount) return Containers::NullOpt;
 
     /* Duplicate the vertices into the output */
     const auto indicesPerAttribute = Containers::arrayCast<2, const UnsignedInt>(stridedArrayView(indices)).transposed<0, 1>();
@@ -482,6 +728,12 @@ Containers::Optional<MeshData> ObjImporter::doMesh(UnsignedInt id, UnsignedInt)
     }
     CORRADE_INTERNAL_ASSERT(offset == stride && attributeIndex == attributeCount);
 
+    /* Memory from a custom allocator is owned by the user, return just a
+       view on it */
+    if(allocator()) return MeshData{*primitive,
+        DataFlag::Mutable, indexData, Trade::MeshIndexData{indexDataI},
+        DataFlag::Mutable, vertexData, Utility::move(attributeData)};
+
     return MeshData{*primitive,
         Utility::move(indexData), Trade::MeshIndexData{indexDataI},
         Utility::move(vertexData), Utility::move(attributeData)};
@@ -106,6 +106,35 @@ positions with optional @ref VertexFormat::Vector3 normals and
 @ref VertexFormat::Vector2 texture coordinates, if present in the source file.
 
 Polygons (quads etc.) and material properties are currently not supported.
+
+The file is parsed directly from memory without any per-line allocations. On
+@ref openData() / @ref openFile() the data are scanned once for object names
+and offsets, and each @ref mesh() call then parses only the range belonging
+to given object. If the data passed to @ref openData() are
+@ref DataFlag::Owned or @ref DataFlag::ExternallyOwned, they're not copied.
+With @ref ImporterFlag::ZeroCopy enabled, @ref openFile() maps the file
+instead of reading it into memory.
+
+If the @cb{.ini} threads @ce @ref Trade-ObjImporter-configuration "configuration option"
+is set to a value other than @cpp 1 @ce, large meshes are split at line
+boundaries into chunks that are parsed on multiple threads and then
+concatenated. The result is the same as with serial parsing. If parsing of
+any chunk fails, the mesh is parsed again serially to report the first error
+in the file.
+
+@section Trade-ObjImporter-configuration Plugin-specific configuration
+
+It's possible to tune various import options through @ref configuration().
+See below for all options and their default values:
+
+@snippet MagnumPlugins/ObjImporter/ObjImporter.conf configuration_
+
+See @ref plugins-configuration for more information and an example showing how
+to edit the configuration values.
+
+If an allocator is set via @ref setAllocator(), index and vertex data are
+allocated from it and @ref MeshData::indexDataFlags() and
+@ref MeshData::vertexDataFlags() contain just @ref DataFlag::Mutable.
 */
 class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
     public:
@@ -124,7 +153,6 @@ class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
 
         MAGNUM_OBJIMPORTER_LOCAL bool doIsOpened() const override;
         MAGNUM_OBJIMPORTER_LOCAL void doOpenData(Containers::Array<char>&& data, DataFlags dataFlags) override;
-        MAGNUM_OBJIMPORTER_LOCAL void doOpenFile(Containers::StringView filename) override;
         MAGNUM_OBJIMPORTER_LOCAL void doClose() override;
 
         MAGNUM_OBJIMPORTER_LOCAL UnsignedInt doMeshCount() const override;
@@ -0,0 +1,139 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Test/BenchmarkTester.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/MeshData.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct ObjImporterBenchmark: Magnum::Test::BenchmarkTester {
+    explicit ObjImporterBenchmark();
+
+    void positions();
+    void positionsTextureCoordinatesNormals();
+
+    private:
+        /* Explicitly forbid system-wide plugin dependencies */
+        PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+        std::string _positions, _positionsTextureCoordinatesNormals;
+};
+
+/* A grid of 128x128 quads split into triangles */
+enum: Int { GridSize = 128 };
+
+std::string gridObj(const bool textureCoordinatesNormals) {
+    std::ostringstream out;
+    for(Int y = 0; y <= GridSize; ++y) for(Int x = 0; x <= GridSize; ++x) {
+        out << "v " << Float(x)/GridSize << " " << Float(y)/GridSize << " " << Float((x*y) % 7)*0.125f << "\n";
+        if(textureCoordinatesNormals) {
+            out << "vt " << Float(x)/GridSize << " " << Float(y)/GridSize << "\n";
+            out << "vn 0 0 1\n";
+        }
+    }
+
+    for(Int y = 0; y != GridSize; ++y) for(Int x = 0; x != GridSize; ++x) {
+        /* OBJ indices are one-based */
+        const Int a = y*(GridSize + 1) + x + 1;
+        const Int b = a + 1;
+        const Int c = a + GridSize + 1;
+        const Int d = c + 1;
+        const Int triangles[2][3]{{a, b, d}, {a, d, c}};
+        for(const auto& triangle: triangles) {
+            out << "f";
+            for(std::size_t i = 0; i != 3; ++i) {
+                if(textureCoordinatesNormals)
+                    out << " " << triangle[i] << "/" << triangle[i] << "/" << triangle[i];
+                else
+                    out << " " << triangle[i];
+            }
+            out << "\n";
+        }
+    }
+
+    return out.str();
+}
+
+ObjImporterBenchmark::ObjImporterBenchmark() {
+    addBenchmarks({&ObjImporterBenchmark::positions,
+                   &ObjImporterBenchmark::positionsTextureCoordinatesNormals}, 5);
+
+    /* Run all benchmarks again measuring throughput and allocation count */
+    addThroughputBenchmarks({&ObjImporterBenchmark::positions,
+                             &ObjImporterBenchmark::positionsTextureCoordinatesNormals}, 5);
+    addAllocationBenchmarks({&ObjImporterBenchmark::positions,
+                             &ObjImporterBenchmark::positionsTextureCoordinatesNormals}, 3);
+
+    _positions = gridObj(false);
+    _positionsTextureCoordinatesNormals = gridObj(true);
+
+    #ifdef OBJIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(OBJIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void ObjImporterBenchmark::positions() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+
+    UnsignedInt indexCount = 0;
+    CORRADE_BENCHMARK(1) {
+        CORRADE_VERIFY(importer->openData(Containers::arrayView(_positions.data(), _positions.size())));
+        Containers::Optional<MeshData> mesh = importer->mesh(0);
+        CORRADE_VERIFY(mesh);
+        indexCount += mesh->indexCount();
+        setThroughputBytes(_positions.size());
+    }
+
+    CORRADE_COMPARE(indexCount, GridSize*GridSize*6);
+}
+
+void ObjImporterBenchmark::positionsTextureCoordinatesNormals() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+
+    UnsignedInt indexCount = 0;
+    CORRADE_BENCHMARK(1) {
+        CORRADE_VERIFY(importer->openData(Containers::arrayView(_positionsTextureCoordinatesNormals.data(), _positionsTextureCoordinatesNormals.size())));
+        Containers::Optional<MeshData> mesh = importer->mesh(0);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->attributeCount(), 3);
+        indexCount += mesh->indexCount();
+        setThroughputBytes(_positionsTextureCoordinatesNormals.size());
+    }
+
+    CORRADE_COMPARE(indexCount, GridSize*GridSize*6);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ObjImporterBenchmark)
@@ -29,6 +29,7 @@
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
 #include <Corrade/Utility/DebugStl.h>
 #include <Corrade/Utility/FormatStl.h>
 #include <Corrade/Utility/Path.h>
@@ -57,8 +58,11 @@ struct ObjImporterTest: TestSuite::Tester {
     void meshTextureCoordinatesOptionalCoordinate();
     void meshNormals();
     void meshTextureCoordinatesNormals();
+    void meshCustomAllocator();
+    void meshCustomAllocatorFailed();
 
     void meshIgnoredKeyword();
+    void meshNumberFormats();
 
     void meshNamed();
     void meshNamedFirstUnnamed();
@@ -78,6 +82,9 @@ struct ObjImporterTest: TestSuite::Tester {
     void invalidIncompleteData();
     void invalidOptionalCoordinate();
 
+    void parallel();
+    void parallelInvalid();
+
     void openTwice();
     void importTwice();
 
@@ -160,6 +167,20 @@ const struct {
     {"missing texture coordinate indices", "incomplete texture coordinate data"},
 };
 
+const struct {
+    const char* name;
+    const char* insert;
+    const char* message;
+} ParallelInvalidData[]{
+    {"unknown keyword", "bleh\n",
+        "unknown keyword bleh"},
+    {"invalid number", "v 1 2 bleh\n",
+        "error while converting numeric data"},
+    /* The rest of the file has triangles */
+    {"mixed primitives", "p 1\n",
+        "mixed primitive MeshPrimitive::Triangles and MeshPrimitive::Points"}
+};
+
 const struct {
     const char* name;
     const char* message;
@@ -180,8 +201,11 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::meshTextureCoordinatesOptionalCoordinate,
               &ObjImporterTest::meshNormals,
               &ObjImporterTest::meshTextureCoordinatesNormals,
+              &ObjImporterTest::meshCustomAllocator,
+              &ObjImporterTest::meshCustomAllocatorFailed,
 
               &ObjImporterTest::meshIgnoredKeyword,
+              &ObjImporterTest::meshNumberFormats,
 
               &ObjImporterTest::meshNamed});
 
@@ -211,6 +235,11 @@ ObjImporterTest::ObjImporterTest() {
     addInstancedTests({&ObjImporterTest::invalidOptionalCoordinate},
         Containers::arraySize(InvalidOptionalCoordinateData));
 
+    addTests({&ObjImporterTest::parallel});
+
+    addInstancedTests({&ObjImporterTest::parallelInvalid},
+        Containers::arraySize(ParallelInvalidData));
+
     addTests({&ObjImporterTest::openTwice,
               &ObjImporterTest::importTwice});
 
@@ -432,6 +461,75 @@ void ObjImporterTest::meshTextureCoordinatesNormals() {
         TestSuite::Compare::Container);
 }
 
+struct Arena {
+    alignas(4) char data[128];
+    std::size_t offset;
+    std::size_t allocationCount;
+};
+
+void* arenaAllocate(std::size_t size, std::size_t alignment, void* userData) {
+    Arena& arena = *static_cast<Arena*>(userData);
+    const std::size_t offset = (arena.offset + alignment - 1)/alignment*alignment;
+    if(offset + size > sizeof(arena.data)) return nullptr;
+    arena.offset = offset + size;
+    ++arena.allocationCount;
+    return arena.data + offset;
+}
+
+void ObjImporterTest::meshCustomAllocator() {
+    Arena arena{};
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->setAllocator(arenaAllocate, &arena);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-normals.obj")));
+
+    const Containers::Optional<MeshData> data = importer->mesh(0);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(arena.allocationCount, 2);
+    /* 6 indices, 4 vertices with a position and a normal */
+    CORRADE_COMPARE(arena.offset, 6*4 + 4*24);
+
+    /* The data are in the arena and not owned by the mesh */
+    CORRADE_COMPARE(data->indexDataFlags(), DataFlag::Mutable);
+    CORRADE_COMPARE(data->vertexDataFlags(), DataFlag::Mutable);
+    CORRADE_COMPARE(data->indexData().data(), arena.data);
+    CORRADE_COMPARE(data->vertexData().data(), arena.data + 6*4);
+
+    CORRADE_COMPARE_AS(data->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {0.5f, 2.0f, 3.0f},
+            {0.0f, 1.5f, 1.0f},
+            {0.5f, 2.0f, 3.0f},
+            {0.0f, 1.5f, 1.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(data->attribute<Vector3>(MeshAttribute::Normal),
+        Containers::arrayView<Vector3>({
+            {1.0f, 0.5f, 3.5f},
+            {1.0f, 0.5f, 3.5f},
+            {0.5f, 1.0f, 0.5f},
+            {0.5f, 1.0f, 0.5f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(data->indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 3, 1, 0}),
+        TestSuite::Compare::Container);
+}
+
+void ObjImporterTest::meshCustomAllocatorFailed() {
+    /* Enough for the indices but not for the vertices */
+    Arena arena{};
+    arena.offset = sizeof(arena.data) - 6*4;
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->setAllocator(arenaAllocate, &arena);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-normals.obj")));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(0));
+    CORRADE_COMPARE(arena.allocationCount, 1);
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::allocateData(): allocator failed to provide 96 bytes\n");
+}
+
 void ObjImporterTest::meshIgnoredKeyword() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
     CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-ignored-keyword.obj")));
@@ -453,6 +551,34 @@ void ObjImporterTest::meshIgnoredKeyword() {
         TestSuite::Compare::Container);
 }
 
+void ObjImporterTest::meshNumberFormats() {
+    /* Various float literal forms, tabs, CRLF line endings and comments
+       indented with whitespace */
+    const char data[] =
+        "  # comment\r\n"
+        "v\t1.5e2 -.25 +3.\r\n"
+        "v 1E-3  0.1000000000000000000000001\t-0\n"
+        "\n"
+        "v 12345678901234567890 -2.5e+1 7 1.0\r\n"
+        "p 1\t\r\n"
+        "p  2 \n"
+        "p 3";
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openData(Containers::arrayView(data).exceptSuffix(1)));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+
+    const Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {150.0f, -0.25f, 3.0f},
+            {0.001f, 0.1f, 0.0f},
+            {12345678901234567890.0f, -25.0f, 7.0f}
+        }), TestSuite::Compare::Container);
+}
+
 void ObjImporterTest::meshNamed() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
     CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-named.obj")));
@@ -667,6 +793,79 @@ void ObjImporterTest::invalidOptionalCoordinate() {
     CORRADE_COMPARE(out.str(), Utility::formatString("Trade::ObjImporter::mesh(): {}\n", data.message));
 }
 
+/* Large enough to be split into several chunks by the importer, which
+   doesn't split ranges smaller than 256 kB */
+std::string largeObj(const char* insert = nullptr) {
+    constexpr std::size_t count = 20000;
+    std::string out;
+    out += "# A large mesh\n";
+    for(std::size_t i = 0; i != count; ++i) {
+        out += Utility::formatString("v {} {} {}\n", Float(i)*0.5f, Float(i), -Float(i));
+        out += Utility::formatString("vt {} {}\n", Float(i)*0.25f, Float(i % 7));
+        out += Utility::formatString("vn {} {} {}\n", Float(i % 3), Float(i % 5), 1.0f);
+    }
+    for(std::size_t i = 0; i != count - 2; ++i) {
+        /* Insert the extra line (if any) at three quarters of the faces, to
+           be in some later chunk */
+        if(insert && i == (count - 2)*3/4) out += insert;
+        out += Utility::formatString("f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\n", i + 1, i + 2, i + 3);
+    }
+    return out;
+}
+
+void ObjImporterTest::parallel() {
+    const std::string data = largeObj();
+    CORRADE_COMPARE_AS(data.size(), std::size_t{4*256*1024},
+        TestSuite::Compare::Greater);
+
+    Containers::Pointer<AbstractImporter> serialImporter = _manager.instantiate("ObjImporter");
+    serialImporter->configuration().setValue("threads", 1);
+    CORRADE_VERIFY(serialImporter->openData(Containers::arrayView(data.data(), data.size())));
+    Containers::Optional<MeshData> serial = serialImporter->mesh(0);
+    CORRADE_VERIFY(serial);
+
+    Containers::Pointer<AbstractImporter> parallelImporter = _manager.instantiate("ObjImporter");
+    parallelImporter->configuration().setValue("threads", 4);
+    CORRADE_VERIFY(parallelImporter->openData(Containers::arrayView(data.data(), data.size())));
+    Containers::Optional<MeshData> parallel = parallelImporter->mesh(0);
+    CORRADE_VERIFY(parallel);
+
+    /* The output should be exactly the same */
+    CORRADE_COMPARE(parallel->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(parallel->indexCount(), 3*(20000 - 2));
+    CORRADE_COMPARE(parallel->vertexCount(), 20000);
+    CORRADE_COMPARE_AS(parallel->indices<UnsignedInt>(),
+        serial->indices<UnsignedInt>(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(parallel->attribute<Vector3>(MeshAttribute::Position),
+        serial->attribute<Vector3>(MeshAttribute::Position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(parallel->attribute<Vector3>(MeshAttribute::Normal),
+        serial->attribute<Vector3>(MeshAttribute::Normal),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(parallel->attribute<Vector2>(MeshAttribute::TextureCoordinates),
+        serial->attribute<Vector2>(MeshAttribute::TextureCoordinates),
+        TestSuite::Compare::Container);
+}
+
+void ObjImporterTest::parallelInvalid() {
+    auto&& data = ParallelInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const std::string obj = largeObj(data.insert);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->configuration().setValue("threads", 4);
+    CORRADE_VERIFY(importer->openData(Containers::arrayView(obj.data(), obj.size())));
+
+    /* The error should be printed just once, the same as when parsing
+       serially */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(0));
+    CORRADE_COMPARE(out.str(), Utility::formatString("Trade::ObjImporter::mesh(): {}\n", data.message));
+}
+
 void ObjImporterTest::openTwice() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
 
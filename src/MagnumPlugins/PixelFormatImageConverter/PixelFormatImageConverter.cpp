@@ -0,0 +1,110 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PixelFormatImageConverter.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include "Magnum/ThreadPool.h"
+#endif
+#include "Magnum/TextureTools/ConvertPixelFormat.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace Trade {
+
+PixelFormatImageConverter::PixelFormatImageConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImageConverter{manager, plugin} {}
+
+ImageConverterFeatures PixelFormatImageConverter::doFeatures() const { return ImageConverterFeature::Convert2D; }
+
+Containers::Optional<ImageData2D> PixelFormatImageConverter::doConvert(const ImageView2D& image) {
+    if(!TextureTools::isPixelFormatConvertible(image.format())) {
+        Error{} << "Trade::PixelFormatImageConverter::convert(): unsupported input format" << image.format();
+        return {};
+    }
+
+    /* An empty option keeps the input format */
+    const Containers::StringView formatString = configuration().value<Containers::StringView>("format");
+    PixelFormat format;
+    if(formatString.isEmpty())
+        format = image.format();
+    else {
+        format = configuration().value<PixelFormat>("format");
+        if(format == PixelFormat{}) {
+            Error{} << "Trade::PixelFormatImageConverter::convert(): unrecognized format" << formatString;
+            return {};
+        }
+        if(!TextureTools::isPixelFormatConvertible(format)) {
+            Error{} << "Trade::PixelFormatImageConverter::convert(): unsupported output format" << format;
+            return {};
+        }
+    }
+
+    const Containers::StringView swizzle = configuration().value<Containers::StringView>("swizzle");
+    if(!swizzle.isEmpty()) {
+        bool valid = swizzle.size() == pixelFormatChannelCount(format);
+        for(const char c: swizzle)
+            if(c != 'r' && c != 'g' && c != 'b' && c != 'a' && c != '0' && c != '1')
+                valid = false;
+        if(!valid) {
+            Error{} << "Trade::PixelFormatImageConverter::convert(): invalid swizzle" << swizzle << "for" << format;
+            return {};
+        }
+    }
+
+    /* Zero threads means the hardware concurrency, a pool with a single
+       thread executes everything on the calling thread */
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    ThreadPool threadPool{configuration().value<UnsignedInt>("threads")};
+    const UnsignedInt threadCount = threadPool.threadCount();
+    #else
+    const UnsignedInt threadCount = 1;
+    #endif
+
+    if(flags() & ImageConverterFlag::Verbose)
+        Debug{} << "Trade::PixelFormatImageConverter::convert(): converting" << image.format() << "to" << format << "on" << threadCount << "threads";
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    Image2D converted = TextureTools::convertPixelFormat(image, format, swizzle, ThreadPool::parallelFor, &threadPool);
+    #else
+    Image2D converted = TextureTools::convertPixelFormat(image, format, swizzle);
+    #endif
+
+    /* Braced initialization guarantees the format and size are queried
+       before the data get released */
+    return ImageData2D{converted.storage(), converted.format(), converted.size(), converted.release(), image.flags()};
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(PixelFormatImageConverter, Magnum::Trade::PixelFormatImageConverter,
+    MAGNUM_TRADE_ABSTRACTIMAGECONVERTER_PLUGIN_INTERFACE)
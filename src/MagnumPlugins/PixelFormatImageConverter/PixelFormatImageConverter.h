@@ -0,0 +1,156 @@
+#ifndef Magnum_Trade_PixelFormatImageConverter_h
+#define Magnum_Trade_PixelFormatImageConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::PixelFormatImageConverter
+ * @m_since_latest
+ */
+
+#include "Magnum/Trade/AbstractImageConverter.h"
+
+#include "MagnumPlugins/PixelFormatImageConverter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_PIXELFORMATIMAGECONVERTER_BUILD_STATIC
+    #if defined(PixelFormatImageConverter_EXPORTS) || defined(PixelFormatImageConverterObjects_EXPORTS)
+        #define MAGNUM_PIXELFORMATIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_PIXELFORMATIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_PIXELFORMATIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_PIXELFORMATIMAGECONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_PIXELFORMATIMAGECONVERTER_EXPORT
+#define MAGNUM_PIXELFORMATIMAGECONVERTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Pixel format conversion image converter plugin
+@m_since_latest
+
+Converts images between normalized, sRGB and floating-point pixel formats
+with an optional channel swizzle using @ref TextureTools::convertPixelFormat(),
+optionally on multiple threads. The output is an uncompressed image, so the
+plugin is meant to be used either directly or as an intermediate step before
+saving to a file. For example with the
+@ref magnum-imageconverter "magnum-imageconverter" utility, where the
+@ref AnyImageConverter plugin is implicitly used after it to save the output
+to an OpenEXR file:
+
+@code{.sh}
+magnum-imageconverter image.png image.exr \
+    -C PixelFormatImageConverter -c format=RGBA16F,swizzle=bgr1
+@endcode
+
+@section Trade-PixelFormatImageConverter-usage Usage
+
+@m_class{m-note m-success}
+
+@par
+    This class is a plugin that's meant to be dynamically loaded and used
+    via the base @ref AbstractImageConverter interface. See its documentation
+    for introduction and usage examples.
+
+This plugin depends on the @ref Trade and @ref TextureTools libraries and is
+built if `MAGNUM_WITH_PIXELFORMATIMAGECONVERTER` is enabled when building
+Magnum. To use as a dynamic plugin, load @cpp "PixelFormatImageConverter" @ce
+via @ref Corrade::PluginManager::Manager.
+
+Additionally, if you're using Magnum as a CMake subproject, do the following:
+
+@code{.cmake}
+set(MAGNUM_WITH_PIXELFORMATIMAGECONVERTER ON CACHE BOOL "" FORCE)
+add_subdirectory(magnum EXCLUDE_FROM_ALL)
+
+# So the dynamically loaded plugin gets built implicitly
+add_dependencies(your-app Magnum::PixelFormatImageConverter)
+@endcode
+
+To use as a static plugin or as a dependency of another plugin with CMake, you
+need to request the `PixelFormatImageConverter` component of the `Magnum`
+package and link to the `Magnum::PixelFormatImageConverter` target:
+
+@code{.cmake}
+find_package(Magnum REQUIRED PixelFormatImageConverter)
+
+# ...
+target_link_libraries(your-app PRIVATE Magnum::PixelFormatImageConverter)
+@endcode
+
+See @ref building, @ref cmake, @ref plugins and @ref file-formats for more
+information.
+
+@section Trade-PixelFormatImageConverter-behavior Behavior and limitations
+
+The output format is controlled with the @cb{.ini} format @ce
+@ref Trade-PixelFormatImageConverter-configuration "configuration option",
+taking a @ref PixelFormat enum value name. If empty, the input format is
+kept, which is useful for just swizzling the channels with the
+@cb{.ini} swizzle @ce option. Both the input and output format have to be
+one of the formats for which @ref TextureTools::isPixelFormatConvertible()
+returns @cpp true @ce, and the swizzle has to be valid for the output
+format, otherwise the conversion fails with an error. See
+@ref TextureTools::convertPixelFormat() for details about the conversion
+itself.
+
+The work is distributed on a @ref ThreadPool with as many threads as given
+by the @cb{.ini} threads @ce option, using the hardware concurrency by
+default. On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the conversion always
+runs on the calling thread.
+
+The output has a default @ref PixelStorage, image flags are passed through
+unchanged. The converter recognizes @ref ImageConverterFlag::Verbose,
+printing the output format and thread count when the flag is enabled.
+
+@section Trade-PixelFormatImageConverter-configuration Plugin-specific configuration
+
+It's possible to tune various output options through @ref configuration(). See
+below for all options and their default values:
+
+@snippet MagnumPlugins/PixelFormatImageConverter/PixelFormatImageConverter.conf configuration_
+
+See @ref plugins-configuration for more information and an example showing how
+to edit the configuration values.
+*/
+class MAGNUM_PIXELFORMATIMAGECONVERTER_EXPORT PixelFormatImageConverter: public AbstractImageConverter {
+    public:
+        /** @brief Plugin manager constructor */
+        explicit PixelFormatImageConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
+
+    private:
+        MAGNUM_PIXELFORMATIMAGECONVERTER_LOCAL ImageConverterFeatures doFeatures() const override;
+        MAGNUM_PIXELFORMATIMAGECONVERTER_LOCAL Containers::Optional<ImageData2D> doConvert(const ImageView2D& image) override;
+};
+
+}}
+
+#endif
@@ -0,0 +1,210 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/DebugStl.h> /** @todo remove once Debug is stream-free */
+#include <Corrade/Utility/FormatStl.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/TextureTools/ConvertPixelFormat.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/AbstractImageConverter.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct PixelFormatImageConverterTest: TestSuite::Tester {
+    explicit PixelFormatImageConverterTest();
+
+    void convert();
+    void threads();
+
+    void unsupportedInputFormat();
+    void invalidOption();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractImageConverter> _manager{"nonexistent"};
+};
+
+const struct {
+    const char* name;
+    PixelFormat format;
+    const char* formatOption;
+    const char* swizzleOption;
+    PixelFormat expected;
+} ConvertData[]{
+    {"RGB to RGBA", PixelFormat::RGB8Unorm, "RGBA8Unorm", nullptr,
+        PixelFormat::RGBA8Unorm},
+    {"RGBA16F to RGBA8Srgb", PixelFormat::RGBA16F, "RGBA8Srgb", nullptr,
+        PixelFormat::RGBA8Srgb},
+    {"BGR to RGB", PixelFormat::RGB8Unorm, nullptr, "bgr",
+        PixelFormat::RGB8Unorm},
+    {"RG16Snorm to R32F, swizzled", PixelFormat::RG16Snorm, "R32F", "g",
+        PixelFormat::R32F},
+};
+
+const struct {
+    const char* name;
+    const char* formatOption;
+    const char* swizzleOption;
+    const char* message;
+} InvalidOptionData[]{
+    {"unrecognized format", "RGBA8Unnorm", nullptr,
+        "unrecognized format RGBA8Unnorm"},
+    {"unsupported output format", "RGBA8UI", nullptr,
+        "unsupported output format PixelFormat::RGBA8UI"},
+    {"swizzle too long", "RG8Unorm", "rgb",
+        "invalid swizzle rgb for PixelFormat::RG8Unorm"},
+    {"invalid swizzle character", nullptr, "rgbx",
+        "invalid swizzle rgbx for PixelFormat::RGBA8Unorm"},
+};
+
+PixelFormatImageConverterTest::PixelFormatImageConverterTest() {
+    addInstancedTests({&PixelFormatImageConverterTest::convert},
+        Containers::arraySize(ConvertData));
+
+    addTests({&PixelFormatImageConverterTest::threads,
+
+              &PixelFormatImageConverterTest::unsupportedInputFormat});
+
+    addInstancedTests({&PixelFormatImageConverterTest::invalidOption},
+        Containers::arraySize(InvalidOptionData));
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef PIXELFORMATIMAGECONVERTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(PIXELFORMATIMAGECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+/* Pseudo-random pixel data. Bytes making a half-float NaN or infinity are
+   fine as the outputs are compared against the library function. */
+Containers::Array<char> pixelData(const Vector2i& size, const UnsignedInt pixelSize) {
+    Containers::Array<char> out{NoInit, std::size_t(size.product())*pixelSize};
+    UnsignedInt state = 1234;
+    for(char& i: out) {
+        state = state*1103515245u + 12345u;
+        i = char(state >> 16);
+    }
+    return out;
+}
+
+void PixelFormatImageConverterTest::convert() {
+    auto&& data = ConvertData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("PixelFormatImageConverter");
+    if(data.formatOption)
+        converter->configuration().setValue("format", data.formatOption);
+    if(data.swizzleOption)
+        converter->configuration().setValue("swizzle", data.swizzleOption);
+    /* Single thread to verify the output matches the library function
+       exactly */
+    converter->configuration().setValue("threads", 1);
+
+    const Containers::Array<char> pixels = pixelData({12, 6}, pixelFormatSize(data.format));
+    const ImageView2D image{PixelStorage{}.setAlignment(1), data.format, {12, 6}, pixels};
+    Containers::Optional<ImageData2D> out = converter->convert(image);
+    CORRADE_VERIFY(out);
+    CORRADE_VERIFY(!out->isCompressed());
+    CORRADE_COMPARE(out->format(), data.expected);
+    CORRADE_COMPARE(out->size(), (Vector2i{12, 6}));
+
+    const Image2D expected = TextureTools::convertPixelFormat(image, data.expected, data.swizzleOption ? data.swizzleOption : "");
+    CORRADE_COMPARE_AS(out->data(), expected.data(),
+        TestSuite::Compare::Container);
+}
+
+void PixelFormatImageConverterTest::threads() {
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_SKIP("Threads are not used on Emscripten.");
+    #else
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("PixelFormatImageConverter");
+    converter->configuration().setValue("format", "RGBA16F");
+    converter->configuration().setValue("threads", 3);
+    converter->addFlags(ImageConverterFlag::Verbose);
+
+    /* Large enough to be split into more than one task */
+    const Containers::Array<char> pixels = pixelData({511, 97}, 4);
+    const ImageView2D image{PixelStorage{}.setAlignment(1), PixelFormat::RGBA8Srgb, {511, 97}, pixels};
+
+    std::ostringstream out;
+    Containers::Optional<ImageData2D> converted;
+    {
+        Debug redirectOutput{&out};
+        converted = converter->convert(image);
+    }
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(out.str(), "Trade::PixelFormatImageConverter::convert(): converting PixelFormat::RGBA8Srgb to PixelFormat::RGBA16F on 3 threads\n");
+
+    /* The output should be the same regardless of the thread count */
+    const Image2D expected = TextureTools::convertPixelFormat(image, PixelFormat::RGBA16F);
+    CORRADE_COMPARE_AS(converted->data(), expected.data(),
+        TestSuite::Compare::Container);
+    #endif
+}
+
+void PixelFormatImageConverterTest::unsupportedInputFormat() {
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("PixelFormatImageConverter");
+
+    const char data[8]{};
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(ImageView2D{PixelFormat::RG16UI, {1, 1}, data}));
+    CORRADE_COMPARE(out.str(), "Trade::PixelFormatImageConverter::convert(): unsupported input format PixelFormat::RG16UI\n");
+}
+
+void PixelFormatImageConverterTest::invalidOption() {
+    auto&& data = InvalidOptionData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImageConverter> converter = _manager.instantiate("PixelFormatImageConverter");
+    if(data.formatOption)
+        converter->configuration().setValue("format", data.formatOption);
+    if(data.swizzleOption)
+        converter->configuration().setValue("swizzle", data.swizzleOption);
+
+    const Color4ub pixels[1]{};
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(ImageView2D{PixelFormat::RGBA8Unorm, {1, 1}, pixels}));
+    CORRADE_COMPARE(out.str(), Utility::format("Trade::PixelFormatImageConverter::convert(): {}\n", data.message));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::PixelFormatImageConverterTest)
@@ -39,6 +39,7 @@
 #include "Magnum/Math/Swizzle.h"
 #include "Magnum/Math/Vector4.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
+#include "MagnumPlugins/TgaImporter/TgaSwizzle.h"
 
 namespace Magnum { namespace Trade {
 
@@ -294,13 +295,12 @@ Containers::Optional<Containers::Array<char>> TgaImageConverter::doConvertToData
         Utility::copy(image.pixels(), Containers::StridedArrayView3D<char>{pixels,
             {std::size_t(image.size().y()), std::size_t(image.size().x()), pixelSize}});
 
-        if(image.format() == PixelFormat::RGB8Unorm) {
-            for(Vector3ub& pixel: Containers::arrayCast<Vector3ub>(pixels))
-                pixel = Math::gather<'b', 'g', 'r'>(pixel);
-        } else if(image.format() == PixelFormat::RGBA8Unorm) {
-            for(Vector4ub& pixel: Containers::arrayCast<Vector4ub>(pixels))
-                pixel = Math::gather<'b', 'g', 'r', 'a'>(pixel);
-        }
+        /* The copied pixels are contiguous, so the whole image can be
+           swizzled in a single call */
+        if(image.format() == PixelFormat::RGB8Unorm)
+            Implementation::tgaSwizzleKernels().bgr(pixels.data(), pixels.size()/3);
+        else if(image.format() == PixelFormat::RGBA8Unorm)
+            Implementation::tgaSwizzleKernels().bgra(pixels.data(), pixels.size()/4);
     }
 
     /* If we started with a RLE-encoded file, turn the array back into a
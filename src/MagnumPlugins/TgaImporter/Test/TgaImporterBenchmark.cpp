@@ -0,0 +1,169 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Test/BenchmarkTester.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/TgaImporter/TgaHeader.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct TgaImporterBenchmark: Magnum::Test::BenchmarkTester {
+    explicit TgaImporterBenchmark();
+
+    void uncompressed();
+    void uncompressedZeroCopy();
+    void rle();
+
+    private:
+        /* Explicitly forbid system-wide plugin dependencies */
+        PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+        Containers::Array<char> _uncompressed, _rle;
+};
+
+/* A 2048x2048 RGBA image, i.e. 16 MB of pixel data */
+enum: Int { Size = 2048 };
+
+Containers::Array<char> tga(const bool rle) {
+    /* In the RLE variant, a 128-pixel run of a single color alternates with a
+       raw packet of 128 pixels, which is about the worst case for the
+       decoder. Each packet is prefixed with a single byte. */
+    const std::size_t pixelCount = std::size_t(Size)*Size;
+    const std::size_t pixelDataSize = rle ?
+        pixelCount/256*(1 + 4 + 1 + 128*4) : pixelCount*4;
+    Containers::Array<char> out{ValueInit, sizeof(Implementation::TgaHeader) + pixelDataSize};
+
+    Implementation::TgaHeader& header = *reinterpret_cast<Implementation::TgaHeader*>(out.data());
+    header.imageType = rle ? 10 : 2;
+    header.width = Utility::Endianness::littleEndian(UnsignedShort(Size));
+    header.height = Utility::Endianness::littleEndian(UnsignedShort(Size));
+    header.bpp = 32;
+
+    char* pixels = out.data() + sizeof(Implementation::TgaHeader);
+    if(!rle) {
+        for(std::size_t i = 0; i != pixelCount*4; ++i)
+            pixels[i] = char(i*7);
+    } else for(std::size_t i = 0; i != pixelCount/256; ++i) {
+        *pixels++ = char(0x80|127);
+        for(std::size_t j = 0; j != 4; ++j)
+            *pixels++ = char(i + j);
+        *pixels++ = char(127);
+        for(std::size_t j = 0; j != 128*4; ++j)
+            *pixels++ = char(i*3 + j*7);
+    }
+    CORRADE_INTERNAL_ASSERT(pixels == out.end());
+
+    return out;
+}
+
+TgaImporterBenchmark::TgaImporterBenchmark() {
+    addBenchmarks({&TgaImporterBenchmark::uncompressed,
+                   &TgaImporterBenchmark::uncompressedZeroCopy,
+                   &TgaImporterBenchmark::rle}, 5);
+
+    /* Run all benchmarks again measuring throughput and allocation count */
+    addThroughputBenchmarks({&TgaImporterBenchmark::uncompressed,
+                             &TgaImporterBenchmark::uncompressedZeroCopy,
+                             &TgaImporterBenchmark::rle}, 5);
+    addAllocationBenchmarks({&TgaImporterBenchmark::uncompressed,
+                             &TgaImporterBenchmark::uncompressedZeroCopy,
+                             &TgaImporterBenchmark::rle}, 3);
+
+    _uncompressed = tga(false);
+    _rle = tga(true);
+
+    #ifdef TGAIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(TGAIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void TgaImporterBenchmark::uncompressed() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+
+    Containers::Optional<ImageData2D> image;
+    CORRADE_BENCHMARK(1) {
+        CORRADE_VERIFY(importer->openData(_uncompressed));
+        image = importer->image2D(0);
+        CORRADE_VERIFY(image);
+        setThroughputBytes(_uncompressed.size());
+    }
+
+    CORRADE_COMPARE(image->format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i{Size});
+}
+
+void TgaImporterBenchmark::uncompressedZeroCopy() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    /* Without the BGRA to RGBA conversion the pixel data can be referenced
+       directly, so this measures just the parsing overhead */
+    importer->addFlags(ImporterFlag::ZeroCopy);
+    importer->configuration().setValue("convertBgr", false);
+
+    Containers::Optional<ImageData2D> image;
+    CORRADE_BENCHMARK(1) {
+        CORRADE_VERIFY(importer->openMemory(_uncompressed));
+        image = importer->image2D(0);
+        CORRADE_VERIFY(image);
+        setThroughputBytes(_uncompressed.size());
+    }
+
+    CORRADE_COMPARE(image->format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i{Size});
+    CORRADE_COMPARE(image->dataFlags(), DataFlags{});
+}
+
+void TgaImporterBenchmark::rle() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+
+    Containers::Optional<ImageData2D> image;
+    CORRADE_BENCHMARK(1) {
+        CORRADE_VERIFY(importer->openData(_rle));
+        image = importer->image2D(0);
+        CORRADE_VERIFY(image);
+        setThroughputBytes(_rle.size());
+    }
+
+    CORRADE_COMPARE(image->format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i{Size});
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::TgaImporterBenchmark)
@@ -25,7 +25,9 @@
 */
 
 #include <sstream>
+#include <thread>
 #include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
@@ -33,9 +35,12 @@
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/DebugStl.h>
 #include <Corrade/Utility/FormatStl.h>
+#include <Corrade/Utility/Move.h>
 #include <Corrade/Utility/Path.h>
 
+#include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/ImageData.h"
 
@@ -57,6 +62,19 @@ struct TgaImporterTest: TestSuite::Tester {
     void color32Rle();
     void grayscale8();
     void grayscale8Rle();
+    void grayscale8ZeroCopy();
+    void color24ZeroCopy();
+    void color24ZeroCopyNoConvertBgr();
+    void color24RleNoConvertBgr();
+    void colorLarge();
+
+    void layout();
+    void layoutInvalid();
+    void into();
+    void intoRle();
+    void intoWrongFormat();
+    void customAllocator();
+    void customAllocatorFailed();
 
     void tga2();
     void fileTooLong();
@@ -64,6 +82,7 @@ struct TgaImporterTest: TestSuite::Tester {
     void openMemory();
     void openTwice();
     void importTwice();
+    void importConcurrently();
 
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
@@ -290,7 +309,24 @@ TgaImporterTest::TgaImporterTest() {
         Containers::arraySize(VerboseData));
 
     addTests({&TgaImporterTest::grayscale8,
-              &TgaImporterTest::grayscale8Rle});
+              &TgaImporterTest::grayscale8Rle,
+              &TgaImporterTest::grayscale8ZeroCopy,
+              &TgaImporterTest::color24ZeroCopy,
+              &TgaImporterTest::color24ZeroCopyNoConvertBgr,
+              &TgaImporterTest::color24RleNoConvertBgr});
+
+    addInstancedTests({&TgaImporterTest::colorLarge},
+        Containers::arraySize(ColorLargeData));
+
+    addTests({
+
+              &TgaImporterTest::layout,
+              &TgaImporterTest::layoutInvalid,
+              &TgaImporterTest::into,
+              &TgaImporterTest::intoRle,
+              &TgaImporterTest::intoWrongFormat,
+              &TgaImporterTest::customAllocator,
+              &TgaImporterTest::customAllocatorFailed});
 
     addInstancedTests({&TgaImporterTest::tga2},
         Containers::arraySize(Tga2Data));
@@ -302,7 +338,8 @@ TgaImporterTest::TgaImporterTest() {
         Containers::arraySize(OpenMemoryData));
 
     addTests({&TgaImporterTest::openTwice,
-              &TgaImporterTest::importTwice});
+              &TgaImporterTest::importTwice,
+              &TgaImporterTest::importConcurrently});
 
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
@@ -507,6 +544,258 @@ void TgaImporterTest::grayscale8() {
     }), TestSuite::Compare::Container);
 }
 
+void TgaImporterTest::grayscale8ZeroCopy() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    importer->addFlags(ImporterFlag::ZeroCopy);
+    CORRADE_VERIFY(importer->openMemory(Grayscale8));
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), DataFlags{});
+    CORRADE_COMPARE(image->format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    /* The data should point directly into the input */
+    CORRADE_VERIFY(image->data().data() == Grayscale8 + 18);
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView<char>({
+        1, 2,
+        3, 4,
+        5, 6
+    }), TestSuite::Compare::Container);
+
+    /* Without the flag, a copy is made even with openMemory() */
+    importer->close();
+    importer->clearFlags(ImporterFlag::ZeroCopy);
+    CORRADE_VERIFY(importer->openMemory(Grayscale8));
+    Containers::Optional<Trade::ImageData2D> copied = importer->image2D(0);
+    CORRADE_VERIFY(copied);
+    CORRADE_COMPARE(copied->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+
+    /* The copy is made also if the input is not guaranteed to stay in
+       scope */
+    importer->close();
+    importer->addFlags(ImporterFlag::ZeroCopy);
+    CORRADE_VERIFY(importer->openData(Grayscale8));
+    copied = importer->image2D(0);
+    CORRADE_VERIFY(copied);
+    CORRADE_COMPARE(copied->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+}
+
+void TgaImporterTest::color24ZeroCopy() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    importer->addFlags(ImporterFlag::ZeroCopy);
+    CORRADE_VERIFY(importer->openMemory(Color24));
+
+    /* Color data need a BGR -> RGB swizzle, so they're always copied */
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGB8Unorm);
+}
+
+void TgaImporterTest::color24ZeroCopyNoConvertBgr() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    importer->configuration().setValue("convertBgr", false);
+    importer->addFlags(ImporterFlag::ZeroCopy);
+    CORRADE_VERIFY(importer->openMemory(Color24));
+
+    /* With the conversion disabled, the data can be referenced directly */
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), DataFlags{});
+    CORRADE_COMPARE(image->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_VERIFY(image->data().data() == Color24 + 18);
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView<char>({
+        1, 2, 3, 2, 3, 4,
+        3, 4, 5, 4, 5, 6,
+        5, 6, 7, 6, 7, 8
+    }), TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::color24RleNoConvertBgr() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    importer->configuration().setValue("convertBgr", false);
+    CORRADE_VERIFY(importer->openData(Color24Rle));
+
+    /* RLE data get decoded but the channel order stays */
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView<char>({
+        1, 2, 3, 2, 3, 4,
+        3, 4, 5, 4, 5, 6,
+        4, 5, 6, 4, 5, 6
+    }), TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::colorLarge() {
+    auto&& data = ColorLargeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Large enough to exercise the SIMD swizzle as well as its scalar tail,
+       with RLE runs spanning multiple rows */
+    const Vector2i size{37, 5};
+    const std::size_t pixelSize = data.bpp/8;
+    Containers::Array<char> pixels{NoInit, std::size_t(size.product())*pixelSize};
+    for(std::size_t i = 0; i != pixels.size(); ++i)
+        pixels[i] = char(i*7 + i/pixelSize);
+
+    /* Expected output has the first and third channel swapped */
+    Containers::Array<char> expected{NoInit, pixels.size()};
+    Utility::copy(pixels, expected);
+    for(std::size_t i = 0; i != expected.size(); i += pixelSize)
+        Utility::swap(expected[i], expected[i + 2]);
+
+    Containers::Array<char> file;
+    const char header[]{0, 0, char(data.rle ? 10 : 2), 0, 0, 0, 0, 0, 0, 0, 0, 0, char(size.x()), 0, char(size.y()), 0, char(data.bpp), 0};
+    arrayAppend(file, Containers::arrayView(header));
+    if(!data.rle) arrayAppend(file, pixels);
+    else {
+        /* Alternate 50 pixels as-is and a single pixel repeated 40x, both
+           of them spanning rows. The expected output is updated to match. */
+        std::size_t pixel = 0;
+        for(bool raw = true; pixel != std::size_t(size.product()); raw = !raw) {
+            const std::size_t count = Math::min(std::size_t(raw ? 50 : 40), std::size_t(size.product()) - pixel);
+            arrayAppend(file, char((raw ? 0x00 : 0x80) | (count - 1)));
+            arrayAppend(file, pixels.sliceSize(pixel*pixelSize, raw ? count*pixelSize : pixelSize));
+            if(!raw) for(std::size_t i = 1; i != count; ++i)
+                Utility::copy(expected.sliceSize(pixel*pixelSize, pixelSize), expected.sliceSize((pixel + i)*pixelSize, pixelSize));
+            pixel += count;
+        }
+    }
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    CORRADE_VERIFY(importer->openData(file));
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), size);
+    CORRADE_COMPARE_AS(image->data(), expected,
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::layout() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    CORRADE_VERIFY(importer->openData(Color24Rle));
+
+    Containers::Optional<ImageView2D> layout = importer->image2DLayout(0);
+    CORRADE_VERIFY(layout);
+    CORRADE_COMPARE(layout->storage().alignment(), 1);
+    CORRADE_COMPARE(layout->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(layout->size(), Vector2i(2, 3));
+    CORRADE_VERIFY(!layout->data().data());
+}
+
+void TgaImporterTest::layoutInvalid() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    /* Just the header, no pixel data. The layout can be queried but the
+       import fails. */
+    CORRADE_VERIFY(importer->openData(Containers::arrayView(Color24).prefix(18)));
+    CORRADE_VERIFY(importer->image2DLayout(0));
+
+    char data[18];
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->image2DInto(0, MutableImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {2, 3}, data}));
+
+    /* Paletted file, the layout query fails with a function-specific
+       prefix */
+    CORRADE_VERIFY(importer->openData(Containers::arrayView<char>({0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0})));
+    CORRADE_VERIFY(!importer->image2DLayout(0));
+    CORRADE_COMPARE(out.str(),
+        "Trade::TgaImporter::image2DInto(): file too short, expected 36 bytes but got 18\n"
+        "Trade::TgaImporter::image2DLayout(): paletted files are not supported\n");
+}
+
+void TgaImporterTest::into() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    CORRADE_VERIFY(importer->openData(Color24));
+
+    /* Decode into a destination that has rows padded to four bytes */
+    char data[3*8]{};
+    CORRADE_VERIFY(importer->image2DInto(0, MutableImageView2D{PixelFormat::RGB8Unorm, {2, 3}, data}));
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<char>({
+        3, 2, 1, 4, 3, 2, 0, 0,
+        5, 4, 3, 6, 5, 4, 0, 0,
+        7, 6, 5, 8, 7, 6, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::intoRle() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    CORRADE_VERIFY(importer->openData(Color24Rle));
+
+    /* The runs span multiple rows, which have padding in between */
+    char data[3*8]{};
+    CORRADE_VERIFY(importer->image2DInto(0, MutableImageView2D{PixelFormat::RGB8Unorm, {2, 3}, data}));
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<char>({
+        3, 2, 1, 4, 3, 2, 0, 0,
+        5, 4, 3, 6, 5, 4, 0, 0,
+        6, 5, 4, 6, 5, 4, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::intoWrongFormat() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    CORRADE_VERIFY(importer->openData(Grayscale8));
+
+    char data[32];
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->image2DInto(0, MutableImageView2D{PixelFormat::RGB8Unorm, {2, 3}, data}));
+    CORRADE_VERIFY(!importer->image2DInto(0, MutableImageView2D{PixelFormat::R8Unorm, {3, 2}, data}));
+    CORRADE_COMPARE(out.str(),
+        "Trade::TgaImporter::image2DInto(): expected a PixelFormat::R8Unorm image of size Vector(2, 3) but got PixelFormat::RGB8Unorm and Vector(2, 3)\n"
+        "Trade::TgaImporter::image2DInto(): expected a PixelFormat::R8Unorm image of size Vector(2, 3) but got PixelFormat::R8Unorm and Vector(3, 2)\n");
+}
+
+void TgaImporterTest::customAllocator() {
+    struct Arena {
+        char data[32];
+        std::size_t allocationCount;
+    } arena{};
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    importer->setAllocator([](std::size_t size, std::size_t alignment, void* userData) -> void* {
+        CORRADE_COMPARE(size, 2*3*3);
+        CORRADE_COMPARE(alignment, 4);
+        Arena& arena = *static_cast<Arena*>(userData);
+        ++arena.allocationCount;
+        return arena.data;
+    }, &arena);
+    CORRADE_VERIFY(importer->openData(Color24Rle));
+
+    /* The pixels are decoded directly into the arena, the image doesn't own
+       them */
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(arena.allocationCount, 1);
+    CORRADE_COMPARE(image->dataFlags(), DataFlag::Mutable);
+    CORRADE_COMPARE(image->data().data(), arena.data);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE_AS(Containers::arrayView(arena.data).prefix(2*3*3), Containers::arrayView<char>({
+        3, 2, 1, 4, 3, 2,
+        5, 4, 3, 6, 5, 4,
+        6, 5, 4, 6, 5, 4
+    }), TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::customAllocatorFailed() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    importer->setAllocator([](std::size_t, std::size_t, void*) -> void* {
+        return nullptr;
+    });
+    CORRADE_VERIFY(importer->openData(Color24));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->image2D(0));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::allocateData(): allocator failed to provide 18 bytes\n");
+}
+
 void TgaImporterTest::grayscale8Rle() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
     CORRADE_VERIFY(importer->openData(Grayscale8Rle));
@@ -632,6 +921,40 @@ void TgaImporterTest::importTwice() {
     }
 }
 
+void TgaImporterTest::importConcurrently() {
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_SKIP("Threads not available on Emscripten.");
+    #else
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    CORRADE_VERIFY(importer->features() & ImporterFeature::ConcurrentImport);
+    CORRADE_VERIFY(importer->openData(Color24));
+
+    /* Import the same image from several threads at once, all results
+       should be the same */
+    Containers::Optional<Trade::ImageData2D> images[4];
+    {
+        std::thread threads[Containers::arraySize(images)];
+        for(std::size_t i = 0; i != Containers::arraySize(threads); ++i)
+            threads[i] = std::thread{[&importer, &images, i]() {
+                images[i] = importer->image2D(0);
+            }};
+        for(std::thread& thread: threads) thread.join();
+    }
+
+    for(std::size_t i = 0; i != Containers::arraySize(images); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(images[i]);
+        CORRADE_COMPARE(images[i]->format(), PixelFormat::RGB8Unorm);
+        CORRADE_COMPARE(images[i]->size(), Vector2i(2, 3));
+        CORRADE_COMPARE_AS(images[i]->data(), Containers::arrayView<char>({
+            3, 2, 1, 4, 3, 2,
+            5, 4, 3, 6, 5, 4,
+            7, 6, 5, 8, 7, 6
+        }), TestSuite::Compare::Container);
+    }
+    #endif
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::TgaImporterTest)
@@ -26,17 +26,22 @@
 
 #include "TgaImporter.h"
 
+#include <cstring>
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Endianness.h>
 
+#include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Swizzle.h"
 #include "Magnum/Math/Vector4.h"
 #include "Magnum/Trade/ImageData.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
+#include "MagnumPlugins/TgaImporter/TgaSwizzle.h"
 
 namespace Magnum { namespace Trade {
 
@@ -48,7 +53,7 @@ TgaImporter::TgaImporter(PluginManager::AbstractManager& manager, const Containe
 
 TgaImporter::~TgaImporter() = default;
 
-ImporterFeatures TgaImporter::doFeatures() const { return ImporterFeature::OpenData; }
+ImporterFeatures TgaImporter::doFeatures() const { return ImporterFeature::OpenData|ImporterFeature::ConcurrentImport; }
 
 bool TgaImporter::doIsOpened() const { return _in; }
 
@@ -68,6 +73,7 @@ void TgaImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dat
     }
 
     /* Ttake over the existing array or copy the data if we can't */
+    _inExternallyOwned = !!(dataFlags & DataFlag::ExternallyOwned);
     if(dataFlags & (DataFlag::Owned|DataFlag::ExternallyOwned)) {
         _in = Utility::move(data);
     } else {
@@ -78,14 +84,28 @@ void TgaImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dat
 
 UnsignedInt TgaImporter::doImage2DCount() const { return 1; }
 
-Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedInt) {
+namespace {
+
+struct Layout {
+    PixelStorage storage;
+    PixelFormat format;
+    Vector2i size;
+    std::size_t pixelSize;
+    bool rle;
+    Containers::ArrayView<const char> srcPixels;
+};
+
+/* Parses the header and the optional TGA 2 footer without touching the pixel
+   data. Used by image2DLayout() as well as both image2D() and
+   image2DInto(). */
+Containers::Optional<Layout> parseLayout(const Containers::ArrayView<const char> in, const char* const messagePrefix) {
     /* Check if the file is long enough */
-    if(_in.size() < sizeof(Implementation::TgaHeader)) {
-        Error{} << "Trade::TgaImporter::image2D(): file too short, expected at least" << sizeof(Implementation::TgaHeader) << "bytes but got" << _in.size();
+    if(in.size() < sizeof(Implementation::TgaHeader)) {
+        Error{} << messagePrefix << "file too short, expected at least" << sizeof(Implementation::TgaHeader) << "bytes but got" << in.size();
         return {};
     }
 
-    const Implementation::TgaHeader& header = *reinterpret_cast<const Implementation::TgaHeader*>(_in.data());
+    const Implementation::TgaHeader& header = *reinterpret_cast<const Implementation::TgaHeader*>(in.data());
 
     /* Size in machine endian */
     const Vector2i size{Utility::Endianness::littleEndian(header.width),
@@ -94,7 +114,7 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
     /* Image format */
     PixelFormat format;
     if(header.colorMapType != 0) {
-        Error() << "Trade::TgaImporter::image2D(): paletted files are not supported";
+        Error{} << messagePrefix << "paletted files are not supported";
         return {};
     }
 
@@ -111,7 +131,7 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
                 format = PixelFormat::RGBA8Unorm;
                 break;
             default:
-                Error() << "Trade::TgaImporter::image2D(): unsupported color bits-per-pixel:" << header.bpp;
+                Error{} << messagePrefix << "unsupported color bits-per-pixel:" << header.bpp;
                 return {};
         }
 
@@ -119,26 +139,25 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
     } else if((header.imageType & ~8) == 3) {
         format = PixelFormat::R8Unorm;
         if(header.bpp != 8) {
-            Error() << "Trade::TgaImporter::image2D(): unsupported grayscale bits-per-pixel:" << header.bpp;
+            Error{} << messagePrefix << "unsupported grayscale bits-per-pixel:" << header.bpp;
             return {};
         }
 
     /* Other? */
     } else {
-        Error() << "Trade::TgaImporter::image2D(): unsupported image type:" << header.imageType;
+        Error{} << messagePrefix << "unsupported image type:" << header.imageType;
         return {};
     }
 
     const std::size_t pixelSize = header.bpp/8;
-    const std::size_t outputSize = std::size_t(size.product())*pixelSize;
 
     /* The source pixel data is implicitly the rest of the file. If there's a
        TGA 2 header at the end, ignore the extension and developer areas.
         https://en.wikipedia.org/wiki/Truevision_TGA#File_footer_(optional) */
-    Containers::ArrayView<const char> srcPixels = _in.exceptPrefix(sizeof(Implementation::TgaHeader));
-    if(Containers::StringView{_in}.hasSuffix("TRUEVISION-XFILE.\0"_s)) {
+    Containers::ArrayView<const char> srcPixels = in.exceptPrefix(sizeof(Implementation::TgaHeader));
+    if(Containers::StringView{in}.hasSuffix("TRUEVISION-XFILE.\0"_s)) {
         if(srcPixels.size() < sizeof(Implementation::TgaFooter)) {
-            Error{} << "Trade::TgaImporter::image2D(): TGA 2 file too short, expected at least" << sizeof(Implementation::TgaHeader) + sizeof(Implementation::TgaFooter) << "bytes but got" << _in.size();
+            Error{} << messagePrefix << "TGA 2 file too short, expected at least" << sizeof(Implementation::TgaHeader) + sizeof(Implementation::TgaFooter) << "bytes but got" << in.size();
             return {};
         }
 
@@ -151,57 +170,93 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
         /* If the extension area is present, cut it from the pixel data */
         if(extensionOffset) {
             if(extensionOffset < sizeof(Implementation::TgaHeader)) {
-                Error{} << "Trade::TgaImporter::image2D(): TGA 2 extension offset" << extensionOffset << "overlaps with file header";
+                Error{} << messagePrefix << "TGA 2 extension offset" << extensionOffset << "overlaps with file header";
                 return {};
             }
-            if(extensionOffset > _in.size() - sizeof(Implementation::TgaFooter)) {
-                Error{} << "Trade::TgaImporter::image2D(): TGA 2 extension offset" << extensionOffset << "out of range for" << _in.size() << "bytes and a" << sizeof(Implementation::TgaFooter) << Debug::nospace << "-byte file footer";
+            if(extensionOffset > in.size() - sizeof(Implementation::TgaFooter)) {
+                Error{} << messagePrefix << "TGA 2 extension offset" << extensionOffset << "out of range for" << in.size() << "bytes and a" << sizeof(Implementation::TgaFooter) << Debug::nospace << "-byte file footer";
                 return {};
             }
 
-            srcPixels = srcPixels.prefix(_in.data() + extensionOffset);
+            srcPixels = srcPixels.prefix(in.data() + extensionOffset);
         }
 
         /* If the developer area is present, cut it from the pixel data */
         if(developerAreaOffset) {
             if(developerAreaOffset < sizeof(Implementation::TgaHeader)) {
-                Error{} << "Trade::TgaImporter::image2D(): TGA 2 developer area offset" << developerAreaOffset << "overlaps with file header";
+                Error{} << messagePrefix << "TGA 2 developer area offset" << developerAreaOffset << "overlaps with file header";
                 return {};
             }
-            if(developerAreaOffset > _in.size() - sizeof(Implementation::TgaFooter)) {
-                Error{} << "Trade::TgaImporter::image2D(): TGA 2 developer area offset" << developerAreaOffset << "out of range for" << _in.size() << "bytes and a" << sizeof(Implementation::TgaFooter) << Debug::nospace << "-byte file footer";
+            if(developerAreaOffset > in.size() - sizeof(Implementation::TgaFooter)) {
+                Error{} << messagePrefix << "TGA 2 developer area offset" << developerAreaOffset << "out of range for" << in.size() << "bytes and a" << sizeof(Implementation::TgaFooter) << Debug::nospace << "-byte file footer";
                 return {};
             }
 
             if(!extensionOffset)
-                srcPixels = srcPixels.prefix(_in.data() + developerAreaOffset);
+                srcPixels = srcPixels.prefix(in.data() + developerAreaOffset);
             else if(developerAreaOffset < extensionOffset) {
-                Error{} << "Trade::TgaImporter::image2D(): TGA 2 developer area offset" << developerAreaOffset << "overlaps with extensions at" << extensionOffset << "bytes";
+                Error{} << messagePrefix << "TGA 2 developer area offset" << developerAreaOffset << "overlaps with extensions at" << extensionOffset << "bytes";
                 return {};
             }
         }
     }
 
-    /* Copy data directly if not RLE */
-    Containers::Array<char> data{outputSize};
-    if(!rle) {
-        if(srcPixels.size() < outputSize) {
-            Error{} << "Trade::TgaImporter::image2D(): file too short, expected" << outputSize + sizeof(Implementation::TgaHeader) << "bytes but got" << _in.size();
-            return {};
-        }
+    /* Adjust pixel storage if row size is not four byte aligned */
+    PixelStorage storage;
+    if((size.x()*header.bpp/8)%4 != 0)
+        storage.setAlignment(1);
 
-        /* Image data that are larger are allowed in this case (even if there's
-           a TGA 2 footer after), as we get garbage back in the worst case. In
-           case of RLE this would be a failure. */
-        if(srcPixels.size() > outputSize && !(flags() & ImporterFlag::Quiet)) {
-            Warning{} << "Trade::TgaImporter::image2D(): ignoring" << srcPixels.size() - outputSize << "extra bytes at the end of image data";
-        }
+    return Layout{storage, format, size, pixelSize, rle, srcPixels};
+}
+
+bool checkUncompressedSize(const Containers::ArrayView<const char> in, const Layout& layout, const ImporterFlags flags, const char* const messagePrefix) {
+    const std::size_t outputSize = std::size_t(layout.size.product())*layout.pixelSize;
+    if(layout.srcPixels.size() < outputSize) {
+        Error{} << messagePrefix << "file too short, expected" << outputSize + sizeof(Implementation::TgaHeader) << "bytes but got" << in.size();
+        return false;
+    }
+
+    /* Image data that are larger are allowed in this case (even if there's a
+       TGA 2 footer after), as we get garbage back in the worst case. In case
+       of RLE this would be a failure. */
+    if(layout.srcPixels.size() > outputSize && !(flags & ImporterFlag::Quiet)) {
+        Warning{} << messagePrefix << "ignoring" << layout.srcPixels.size() - outputSize << "extra bytes at the end of image data";
+    }
+
+    return true;
+}
+
+/* Fills a contiguous destination with count copies of a single pixel */
+inline void expandRun(const char* const src, char* const dst, const std::size_t count, const std::size_t pixelSize) {
+    if(pixelSize == 1) {
+        std::memset(dst, *src, count);
+        return;
+    }
+
+    /* Copy the first pixel, then keep doubling the filled prefix, which ends
+       up as a few large memcpy() calls instead of a per-pixel loop */
+    std::memcpy(dst, src, pixelSize);
+    const std::size_t size = count*pixelSize;
+    for(std::size_t filled = pixelSize; filled < size; filled *= 2)
+        std::memcpy(dst + filled, dst, Math::min(filled, size - filled));
+}
 
-        Utility::copy(srcPixels.prefix(data.size()), data);
+/* Decodes the pixel data into a destination of the size given by the layout,
+   with an arbitrary row stride */
+bool decode(const Containers::ArrayView<const char> in, const Layout& layout, const ImporterFlags flags, const bool convertBgr, const char* const messagePrefix, const Containers::StridedArrayView3D<char>& dst) {
+    /* Copy data directly if not RLE */
+    if(!layout.rle) {
+        if(!checkUncompressedSize(in, layout, flags, messagePrefix))
+            return false;
+
+        Utility::copy(Containers::StridedArrayView3D<const char>{layout.srcPixels.prefix(std::size_t(layout.size.product())*layout.pixelSize), {std::size_t(layout.size.y()), std::size_t(layout.size.x()), layout.pixelSize}}, dst);
 
     /* Otherwise decode */
     } else {
-        Containers::ArrayView<char> dstPixels = data;
+        const std::size_t width = layout.size.x();
+        const std::size_t pixelCount = layout.size.product();
+        std::size_t pixel = 0;
+        Containers::ArrayView<const char> srcPixels = layout.srcPixels;
         while(!srcPixels.isEmpty()) {
             /* Reference: http://www.paulbourke.net/dataformats/tga/ */
 
@@ -213,52 +268,125 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
             /* First bit set to 1 means copying the following pixel given
                number of times, 0 means copying the following number of
                pixels once. We represent that operation with a stride. */
-            const std::size_t dataSize = (rleHeader & 0x80 ? 1 : count)*pixelSize;
-            const std::ptrdiff_t stride = rleHeader & 0x80 ? 0 : pixelSize;
+            const std::size_t dataSize = (rleHeader & 0x80 ? 1 : count)*layout.pixelSize;
+            const std::size_t stride = rleHeader & 0x80 ? 0 : layout.pixelSize;
 
             /* Check bounds */
             if(1 + dataSize > srcPixels.size()) {
-                Error{} << "Trade::TgaImporter::image2D(): RLE file too short at pixel" << (dstPixels.begin() - data.begin())/pixelSize;
-                return {};
+                Error{} << messagePrefix << "RLE file too short at pixel" << pixel;
+                return false;
             }
-            if(count*pixelSize > dstPixels.size()) {
-                Error{} << "Trade::TgaImporter::image2D(): RLE data at byte" << (srcPixels.data() - _in.data()) << "contains" << count << "pixels but only" << dstPixels.size()/pixelSize << "left to decode";
-                return {};
+            if(count > pixelCount - pixel) {
+                Error{} << messagePrefix << "RLE data at byte" << (srcPixels.data() - in.data()) << "contains" << count << "pixels but only" << pixelCount - pixel << "left to decode";
+                return false;
             }
 
-            /* Copy the data */
-            Containers::StridedArrayView2D<const char> src{
-                srcPixels.slice(1, 1 + dataSize),
-                {count, pixelSize}, {stride, 1}};
-            Containers::StridedArrayView2D<char> dst{
-                dstPixels.prefix(count*pixelSize),
-                {count, pixelSize}};
-            Utility::copy(src, dst);
+            /* The run can span multiple rows and the destination rows don't
+               need to be contiguous, so copy it row segment by row segment */
+            for(std::size_t i = 0; i != count; ) {
+                const std::size_t x = pixel%width;
+                const std::size_t segment = Math::min(count - i, width - x);
+                const Containers::StridedArrayView2D<char> dstSegment = dst[pixel/width].slice(x, x + segment);
+                const char* const src = srcPixels.data() + 1 + i*stride;
+                if(dstSegment.isContiguous()) {
+                    char* const dstData = static_cast<char*>(dstSegment.data());
+                    if(stride) std::memcpy(dstData, src, segment*layout.pixelSize);
+                    else expandRun(src, dstData, segment, layout.pixelSize);
+                } else for(std::size_t j = 0; j != segment; ++j) {
+                    const Containers::StridedArrayView1D<char> dstPixel = dstSegment[j];
+                    for(std::size_t k = 0; k != layout.pixelSize; ++k)
+                        dstPixel[k] = src[j*stride + k];
+                }
+
+                i += segment;
+                pixel += segment;
+            }
 
-            /* Update views for the next round */
+            /* Update the view for the next round */
             srcPixels = srcPixels.exceptPrefix(1 + dataSize);
-            dstPixels = dstPixels.exceptPrefix(count*pixelSize);
         }
     }
 
-    /* Adjust pixel storage if row size is not four byte aligned */
-    PixelStorage storage;
-    if((size.x()*header.bpp/8)%4 != 0)
-        storage.setAlignment(1);
+    if(!convertBgr) return true;
 
-    if(format == PixelFormat::RGB8Unorm) {
-        if(flags() & ImporterFlag::Verbose)
-            Debug{} << "Trade::TgaImporter::image2D(): converting from BGR to RGB";
-        for(Vector3ub& pixel: Containers::arrayCast<Vector3ub>(data))
-            pixel = Math::gather<'b', 'g', 'r'>(pixel);
-    } else if(format == PixelFormat::RGBA8Unorm) {
+    if(layout.format == PixelFormat::RGB8Unorm) {
+        if(flags & ImporterFlag::Verbose)
+            Debug{} << messagePrefix << "converting from BGR to RGB";
+        for(const Containers::StridedArrayView2D<char> row: dst) {
+            if(row.isContiguous())
+                Implementation::tgaSwizzleKernels().bgr(static_cast<char*>(row.data()), row.size()[0]);
+            else for(Vector3ub& pixel: Containers::arrayCast<1, Vector3ub>(row))
+                pixel = Math::gather<'b', 'g', 'r'>(pixel);
+        }
+    } else if(layout.format == PixelFormat::RGBA8Unorm) {
+        if(flags & ImporterFlag::Verbose)
+            Debug{} << messagePrefix << "converting from BGRA to RGBA";
+        for(const Containers::StridedArrayView2D<char> row: dst) {
+            if(row.isContiguous())
+                Implementation::tgaSwizzleKernels().bgra(static_cast<char*>(row.data()), row.size()[0]);
+            else for(Vector4ub& pixel: Containers::arrayCast<1, Vector4ub>(row))
+                pixel = Math::gather<'b', 'g', 'r', 'a'>(pixel);
+        }
+    }
+
+    return true;
+}
+
+}
+
+Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedInt) {
+    const char* const messagePrefix = "Trade::TgaImporter::image2D():";
+    const Containers::Optional<Layout> layout = parseLayout(_in, messagePrefix);
+    if(!layout) return {};
+
+    /* Grayscale data don't need any conversion and neither color data if the
+       BGR(A) to RGB(A) conversion is disabled, so if the input memory stays
+       in scope, reference it directly */
+    const bool convertBgr = configuration().value<bool>("convertBgr");
+    const std::size_t outputSize = std::size_t(layout->size.product())*layout->pixelSize;
+    if(!layout->rle && (layout->format == PixelFormat::R8Unorm || !convertBgr) && _inExternallyOwned && (flags() & ImporterFlag::ZeroCopy)) {
+        if(!checkUncompressedSize(_in, *layout, flags(), messagePrefix))
+            return {};
         if(flags() & ImporterFlag::Verbose)
-            Debug{} << "Trade::TgaImporter::image2D(): converting from BGRA to RGBA";
-        for(Vector4ub& pixel: Containers::arrayCast<Vector4ub>(data))
-            pixel = Math::gather<'b', 'g', 'r', 'a'>(pixel);
+            Debug{} << messagePrefix << "referencing input data without a copy";
+        return ImageData2D{layout->storage, layout->format, layout->size, DataFlags{}, layout->srcPixels.prefix(outputSize)};
+    }
+
+    /* Taken from the user-supplied allocator if there's any */
+    Containers::Array<char> data = allocateData(outputSize, 4);
+    if(!data && outputSize) return {};
+
+    /* Zero-initialized in case the RLE data don't cover the whole image */
+    if(layout->rle) std::memset(data.data(), 0, data.size());
+
+    if(!decode(_in, *layout, flags(), convertBgr, messagePrefix, MutableImageView2D{layout->storage, layout->format, layout->size, data}.pixels()))
+        return {};
+
+    /* Memory from a custom allocator is owned by the user, return just a
+       view on it */
+    if(allocator())
+        return ImageData2D{layout->storage, layout->format, layout->size, DataFlag::Mutable, data};
+    return ImageData2D{layout->storage, layout->format, layout->size, Utility::move(data)};
+}
+
+Containers::Optional<ImageView2D> TgaImporter::doImage2DLayout(UnsignedInt, UnsignedInt) {
+    const Containers::Optional<Layout> layout = parseLayout(_in, "Trade::TgaImporter::image2DLayout():");
+    if(!layout) return {};
+
+    return ImageView2D{layout->storage, layout->format, layout->size};
+}
+
+bool TgaImporter::doImage2DInto(UnsignedInt, UnsignedInt, const MutableImageView2D& image) {
+    const char* const messagePrefix = "Trade::TgaImporter::image2DInto():";
+    const Containers::Optional<Layout> layout = parseLayout(_in, messagePrefix);
+    if(!layout) return false;
+
+    if(image.format() != layout->format || image.size() != layout->size) {
+        Error{} << messagePrefix << "expected a" << layout->format << "image of size" << layout->size << "but got" << image.format() << "and" << image.size();
+        return false;
     }
 
-    return ImageData2D{storage, format, size, Utility::move(data)};
+    return decode(_in, *layout, flags(), configuration().value<bool>("convertBgr"), messagePrefix, image.pixels());
 }
 
 }}
@@ -113,6 +113,41 @@ developer area blocks at the end of the file are ignored.
 The importer recognizes @ref ImporterFlag::Verbose, printing additional info
 when the flag is enabled. @ref ImporterFlag::Quiet is recognized as well and
 causes all import warnings to be suppressed.
+
+If @ref ImporterFlag::ZeroCopy is enabled and the file is opened with
+@ref openFile() or @ref openMemory(), uncompressed grayscale images are
+returned as a view on the input data without any copy, with
+@ref ImageData::dataFlags() being empty. Color images are copied as they need
+to be converted from BGR(A) to RGB(A), unless the @cb{.ini} convertBgr @ce
+@ref Trade-TgaImporter-configuration "configuration option" is disabled, in
+which case they're returned as a view as well, with the channels in the
+original BGR(A) order. It's then up to the application to swap the channels,
+for example using a texture swizzle. RLE-compressed images always have to be
+decoded.
+
+The BGR(A) to RGB(A) conversion is done with SSSE3 instructions if the CPU
+supports them, and RLE-compressed runs are expanded with bulk copies instead
+of pixel by pixel.
+
+The @ref image2DLayout() query parses just the file header. The
+@ref image2DInto() function decodes the pixels directly into the passed image,
+with the BGR(A) to RGB(A) conversion done in place. If an allocator is set
+via @ref setAllocator(), pixel data returned from @ref image2D() are allocated
+from it and @ref ImageData::dataFlags() contain just @ref DataFlag::Mutable.
+
+The plugin advertises @ref ImporterFeature::ConcurrentImport, images can be
+imported from multiple threads at once as described in
+@ref Trade-AbstractImporter-usage-threads.
+
+@section Trade-TgaImporter-configuration Plugin-specific configuration
+
+It's possible to tune various import options through @ref configuration().
+See below for all options and their default values:
+
+@snippet MagnumPlugins/TgaImporter/TgaImporter.conf configuration_
+
+See @ref plugins-configuration for more information and an example showing how
+to edit the configuration values.
 */
 class MAGNUM_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
     public:
@@ -131,8 +166,13 @@ class MAGNUM_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
         MAGNUM_TGAIMPORTER_LOCAL void doClose() override;
         MAGNUM_TGAIMPORTER_LOCAL UnsignedInt doImage2DCount() const override;
         MAGNUM_TGAIMPORTER_LOCAL Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level) override;
+        MAGNUM_TGAIMPORTER_LOCAL Containers::Optional<ImageView2D> doImage2DLayout(UnsignedInt id, UnsignedInt level) override;
+        MAGNUM_TGAIMPORTER_LOCAL bool doImage2DInto(UnsignedInt id, UnsignedInt level, const MutableImageView2D& image) override;
 
         Containers::Array<char> _in;
+        /* Whether _in is guaranteed to stay in scope until the file is
+           closed, allowing it to be referenced with ImporterFlag::ZeroCopy */
+        bool _inExternallyOwned{};
 };
 
 }}
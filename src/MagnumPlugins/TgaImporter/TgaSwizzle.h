@@ -0,0 +1,114 @@
+#ifndef Magnum_Trade_TgaSwizzle_h
+#define Magnum_Trade_TgaSwizzle_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Cpu.h>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Math/Swizzle.h"
+#include "Magnum/Math/Vector4.h"
+
+#ifdef CORRADE_ENABLE_SSSE3
+#include <Corrade/Utility/IntrinsicsSsse3.h>
+#endif
+
+/* Used by both TgaImporter and TgaImageConverter, which is why it isn't
+   directly inside TgaImporter.cpp. Each plugin gets its own copy of the
+   dispatch. */
+
+namespace Magnum { namespace Trade { namespace Implementation {
+
+/* In-place BGR <-> RGB and BGRA <-> RGBA conversion of a contiguous row. The
+   operation is its own inverse, so the same is used for both import and
+   export. */
+inline void swizzleBgrScalar(char* const data, const std::size_t count) {
+    for(Vector3ub& pixel: Containers::arrayCast<Vector3ub>(Containers::arrayView(data, count*3)))
+        pixel = Math::gather<'b', 'g', 'r'>(pixel);
+}
+
+inline void swizzleBgraScalar(char* const data, const std::size_t count) {
+    for(Vector4ub& pixel: Containers::arrayCast<Vector4ub>(Containers::arrayView(data, count*4)))
+        pixel = Math::gather<'b', 'g', 'r', 'a'>(pixel);
+}
+
+#ifdef CORRADE_ENABLE_SSSE3
+CORRADE_ENABLE_SSSE3 inline void swizzleBgrSsse3(char* const data, const std::size_t count) {
+    /* Five pixels in each 16-byte block, the last byte stays in place. As
+       the whole 16 bytes are loaded and stored, stop while there's at least
+       16 bytes left and do the rest with the scalar code. */
+    const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+    const std::size_t size = count*3;
+    std::size_t i = 0;
+    for(; i + 16 <= size; i += 15) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), _mm_shuffle_epi8(in, shuffle));
+    }
+    swizzleBgrScalar(data + i, (size - i)/3);
+}
+
+CORRADE_ENABLE_SSSE3 inline void swizzleBgraSsse3(char* const data, const std::size_t count) {
+    const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    const std::size_t size = count*4;
+    std::size_t i = 0;
+    for(; i + 16 <= size; i += 16) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), _mm_shuffle_epi8(in, shuffle));
+    }
+    swizzleBgraScalar(data + i, (size - i)/4);
+}
+#endif
+
+struct SwizzleKernels {
+    void(*bgr)(char*, std::size_t);
+    void(*bgra)(char*, std::size_t);
+};
+
+inline SwizzleKernels swizzleKernelsFor(const Cpu::Features features) {
+    SwizzleKernels out{swizzleBgrScalar, swizzleBgraScalar};
+
+    #ifdef CORRADE_ENABLE_SSSE3
+    if(features & Cpu::Ssse3) {
+        out.bgr = swizzleBgrSsse3;
+        out.bgra = swizzleBgraSsse3;
+    }
+    #endif
+
+    /* Silence unused variable warnings on platforms with no SIMD variant */
+    static_cast<void>(features);
+
+    return out;
+}
+
+inline const SwizzleKernels& tgaSwizzleKernels() {
+    /* Picked on first use, the static initialization is thread-safe */
+    static const SwizzleKernels out = swizzleKernelsFor(Cpu::runtimeFeatures());
+    return out;
+}
+
+}}}
+
+#endif
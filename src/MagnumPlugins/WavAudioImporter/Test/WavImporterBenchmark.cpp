@@ -0,0 +1,187 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+#include "Magnum/Audio/BufferFormat.h"
+#include "Magnum/Test/BenchmarkTester.h"
+#include "MagnumPlugins/WavAudioImporter/WavHeader.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Audio { namespace Test { namespace {
+
+using Implementation::RiffChunk;
+using Implementation::WavAudioFormat;
+using Implementation::WavFormatChunk;
+using Implementation::WavHeaderChunk;
+
+struct WavImporterBenchmark: Magnum::Test::BenchmarkTester {
+    explicit WavImporterBenchmark();
+
+    void wholeData();
+    void streaming();
+
+    private:
+        /* Explicitly forbid system-wide plugin dependencies */
+        PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+        Containers::Array<char> _files[3];
+};
+
+/* A minute of 48 kHz stereo audio */
+enum: UnsignedInt {
+    Frequency = 48000,
+    FrameCount = Frequency*60
+};
+
+const struct {
+    const char* name;
+    WavAudioFormat format;
+    UnsignedShort bitsPerSample;
+    bool bigEndian;
+    BufferFormat expectedFormat;
+} Data[]{
+    {"16-bit PCM", WavAudioFormat::Pcm, 16, false, BufferFormat::Stereo16},
+    {"16-bit PCM, big endian", WavAudioFormat::Pcm, 16, true, BufferFormat::Stereo16},
+    {"32-bit float", WavAudioFormat::IeeeFloat, 32, false, BufferFormat::StereoFloat}
+};
+
+Containers::Array<char> wav(const WavAudioFormat format, const UnsignedShort bitsPerSample, const bool bigEndian) {
+    const UnsignedShort blockAlign = 2*bitsPerSample/8;
+    const std::size_t dataSize = std::size_t(FrameCount)*blockAlign;
+    Containers::Array<char> out{NoInit, sizeof(WavHeaderChunk) + sizeof(WavFormatChunk) + sizeof(RiffChunk) + dataSize};
+
+    /* The importer doesn't interpret the samples in any way except for
+       swapping the endianness, so their contents don't matter */
+    char* const samples = out.data() + out.size() - dataSize;
+    for(std::size_t i = 0; i != dataSize; ++i)
+        samples[i] = char(i*7);
+
+    WavHeaderChunk header;
+    std::memcpy(header.chunk.chunkId, bigEndian ? "RIFX" : "RIFF", 4);
+    header.chunk.chunkSize = UnsignedInt(out.size() - sizeof(RiffChunk));
+    std::memcpy(header.format, "WAVE", 4);
+
+    WavFormatChunk formatChunk;
+    std::memcpy(formatChunk.chunk.chunkId, "fmt ", 4);
+    formatChunk.chunk.chunkSize = sizeof(WavFormatChunk) - sizeof(RiffChunk);
+    formatChunk.audioFormat = format;
+    formatChunk.numChannels = 2;
+    formatChunk.sampleRate = Frequency;
+    formatChunk.byteRate = Frequency*blockAlign;
+    formatChunk.blockAlign = blockAlign;
+    formatChunk.bitsPerSample = bitsPerSample;
+
+    RiffChunk dataChunk;
+    std::memcpy(dataChunk.chunkId, "data", 4);
+    dataChunk.chunkSize = UnsignedInt(dataSize);
+
+    if(bigEndian != Utility::Endianness::isBigEndian())
+        Utility::Endianness::swapInPlace(
+            header.chunk.chunkSize,
+            formatChunk.chunk.chunkSize, formatChunk.audioFormat,
+            formatChunk.numChannels, formatChunk.sampleRate,
+            formatChunk.byteRate, formatChunk.blockAlign,
+            formatChunk.bitsPerSample,
+            dataChunk.chunkSize);
+
+    std::memcpy(out.data(), &header, sizeof(WavHeaderChunk));
+    std::memcpy(out.data() + sizeof(WavHeaderChunk), &formatChunk, sizeof(WavFormatChunk));
+    std::memcpy(out.data() + sizeof(WavHeaderChunk) + sizeof(WavFormatChunk), &dataChunk, sizeof(RiffChunk));
+
+    return out;
+}
+
+WavImporterBenchmark::WavImporterBenchmark() {
+    addInstancedBenchmarks({&WavImporterBenchmark::wholeData,
+                            &WavImporterBenchmark::streaming}, 5,
+        Containers::arraySize(Data));
+
+    /* Run all benchmarks again measuring throughput and allocation count */
+    addInstancedThroughputBenchmarks({&WavImporterBenchmark::wholeData,
+                                      &WavImporterBenchmark::streaming}, 5,
+        Containers::arraySize(Data));
+    addInstancedAllocationBenchmarks({&WavImporterBenchmark::wholeData,
+                                      &WavImporterBenchmark::streaming}, 3,
+        Containers::arraySize(Data));
+
+    for(std::size_t i = 0; i != Containers::arraySize(Data); ++i)
+        _files[i] = wav(Data[i].format, Data[i].bitsPerSample, Data[i].bigEndian);
+
+    #ifdef WAVAUDIOIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(WAVAUDIOIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void WavImporterBenchmark::wholeData() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+    const Containers::ArrayView<const char> file = _files[testCaseInstanceId()];
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        CORRADE_VERIFY(importer->openData(file));
+        CORRADE_COMPARE(importer->format(), data.expectedFormat);
+        size += importer->data().size();
+        setThroughputBytes(file.size());
+    }
+
+    CORRADE_COMPARE(size, std::size_t(FrameCount)*2*data.bitsPerSample/8);
+}
+
+void WavImporterBenchmark::streaming() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+    const Containers::ArrayView<const char> file = _files[testCaseInstanceId()];
+
+    /* Reading roughly 85 milliseconds at a time, a typical streaming buffer
+       size */
+    Containers::Array<char> buffer{NoInit, 4096*std::size_t(2*data.bitsPerSample/8)};
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        CORRADE_VERIFY(importer->openData(file));
+        CORRADE_COMPARE(importer->format(), data.expectedFormat);
+        while(const std::size_t read = importer->readFrames(buffer))
+            size += read*importer->frameSize();
+        setThroughputBytes(file.size());
+    }
+
+    CORRADE_COMPARE(size, std::size_t(FrameCount)*2*data.bitsPerSample/8);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::WavImporterBenchmark)
@@ -27,6 +27,7 @@
 
 #include <sstream>
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once AbstractImporter is <string>-free */
 #include <Corrade/TestSuite/Tester.h>
@@ -81,10 +82,23 @@ struct WavImporterTest: TestSuite::Tester {
     void surround51Channel16();
     void surround71Channel24();
 
+    void streaming();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
 };
 
+const struct {
+    const char* name;
+    const char* filename;
+    bool fromFile;
+} StreamingData[]{
+    {"file", "stereo64f.wav", true},
+    {"file, big endian", "stereo64fbe.wav", true},
+    {"data", "stereo64f.wav", false},
+    {"data, big endian", "stereo64fbe.wav", false},
+};
+
 WavImporterTest::WavImporterTest() {
     addTests({&WavImporterTest::empty,
               &WavImporterTest::wrongSignature,
@@ -124,6 +138,9 @@ WavImporterTest::WavImporterTest() {
               &WavImporterTest::surround51Channel16,
               &WavImporterTest::surround71Channel24});
 
+    addInstancedTests({&WavImporterTest::streaming},
+        Containers::arraySize(StreamingData));
+
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
     #ifdef WAVAUDIOIMPORTER_PLUGIN_FILENAME
@@ -472,6 +489,53 @@ void WavImporterTest::surround71Channel24() {
     CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): unsupported format Audio::WavAudioFormat::Extensible\n");
 }
 
+void WavImporterTest::streaming() {
+    auto&& data = StreamingData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+    CORRADE_VERIFY(importer->features() & ImporterFeature::Streaming);
+
+    const Containers::String filename = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, data.filename);
+    if(data.fromFile) {
+        CORRADE_VERIFY(importer->openFile(filename));
+    } else {
+        Containers::Optional<Containers::Array<char>> file = Utility::Path::read(filename);
+        CORRADE_VERIFY(file);
+        CORRADE_VERIFY(importer->openData(*file));
+    }
+
+    CORRADE_COMPARE(importer->format(), BufferFormat::StereoDouble);
+    CORRADE_COMPARE(importer->frameSize(), 16);
+    CORRADE_COMPARE(importer->frameCount(), importer->data().size()/16);
+    CORRADE_COMPARE(importer->frameOffset(), 0);
+
+    /* Three whole frames fit, the extra space isn't touched */
+    Double out[7]{};
+    out[6] = 1337.0;
+    CORRADE_COMPARE(importer->readFrames(Containers::arrayCast<char>(Containers::arrayView(out))), 3);
+    CORRADE_COMPARE(importer->frameOffset(), 3);
+    CORRADE_COMPARE_AS(Containers::arrayView(out),
+        Containers::arrayView<Double>({
+            0.0, 0.0, 0.0, 0.0, 3.0517578125e-05, 6.103515625e-05, 1337.0}),
+        TestSuite::Compare::Container);
+
+    /* Seeking back */
+    importer->seekFrame(2);
+    CORRADE_COMPARE(importer->frameOffset(), 2);
+    CORRADE_COMPARE(importer->readFrames(Containers::arrayCast<char>(Containers::arrayView(out).prefix(2))), 1);
+    CORRADE_COMPARE_AS(Containers::arrayView(out).prefix(2),
+        Containers::arrayView<Double>({
+            3.0517578125e-05, 6.103515625e-05}),
+        TestSuite::Compare::Container);
+
+    /* Reading at the end gives back only what's left and then nothing */
+    importer->seekFrame(importer->frameCount() - 1);
+    CORRADE_COMPARE(importer->readFrames(Containers::arrayCast<char>(Containers::arrayView(out))), 1);
+    CORRADE_COMPARE(importer->frameOffset(), importer->frameCount());
+    CORRADE_COMPARE(importer->readFrames(Containers::arrayCast<char>(Containers::arrayView(out))), 0);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::WavImporterTest)
@@ -27,10 +27,16 @@
 
 #include "WavImporter.h"
 
+#include <string>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StringStl.h> /** @todo remove once AbstractImporter is <string>-free */
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 #include <Corrade/Utility/EndiannessBatch.h>
+#include <Corrade/Utility/Move.h>
+#include <Corrade/Utility/Path.h>
 
 #include "MagnumPlugins/WavAudioImporter/WavHeader.h"
 
@@ -41,19 +47,94 @@ using Implementation::WavAudioFormat;
 using Implementation::WavFormatChunk;
 using Implementation::WavHeaderChunk;
 
+struct WavImporter::State {
+    /* Either a copy of the data chunk if opened from memory, or a mapping of
+       the whole file if opened from a file */
+    Containers::Array<char> data;
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Array<const char, Utility::Path::MapDeleter> mapped;
+    #endif
+
+    /* Points either to data or into mapped */
+    Containers::ArrayView<const char> samples;
+
+    BufferFormat format;
+    UnsignedInt frequency;
+    UnsignedShort frameSize;
+    UnsignedShort bitsPerSample;
+    /* Set if the samples are directly in the mapped file and need to be
+       endian-swapped on every access */
+    bool swapEndianness;
+    UnsignedLong frameOffset;
+};
+
+namespace {
+
+/* Swaps sample endianness in-place, if requested */
+void fixEndianness(const Containers::ArrayView<char> data, const UnsignedShort bitsPerSample, const bool swap) {
+    if(!swap) return;
+
+    if(bitsPerSample == 16)
+        Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint16_t>(data));
+    else if(bitsPerSample == 32)
+        Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint32_t>(data));
+    else if(bitsPerSample == 64)
+        Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint64_t>(data));
+    else CORRADE_INTERNAL_ASSERT(bitsPerSample == 8);
+}
+
+}
+
 WavImporter::WavImporter() = default;
 
 WavImporter::WavImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImporter{manager, plugin} {}
 
-ImporterFeatures WavImporter::doFeatures() const { return ImporterFeature::OpenData; }
+WavImporter::~WavImporter() = default;
 
-bool WavImporter::doIsOpened() const { return !!_data; }
+ImporterFeatures WavImporter::doFeatures() const { return ImporterFeature::OpenData|ImporterFeature::Streaming; }
+
+bool WavImporter::doIsOpened() const { return !!_state; }
 
 void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
+    Containers::Pointer<State> state = parse(data);
+    if(!state) return;
+
+    /* The data aren't guaranteed to stay in scope, so copy the data chunk and
+       fix its endianness upfront */
+    state->data = Containers::Array<char>{NoInit, state->samples.size()};
+    Utility::copy(state->samples, state->data);
+    fixEndianness(state->data, state->bitsPerSample, state->swapEndianness);
+    state->samples = state->data;
+    state->swapEndianness = false;
+
+    _state = Utility::move(state);
+}
+
+void WavImporter::doOpenFile(const std::string& filename) {
+    /* Map the file instead of reading it, so streaming long files through
+       readFrames() doesn't need the whole file in memory. If that fails (for
+       example because the file is empty), fall back to the default
+       implementation, which also produces a proper error message. */
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mapped = Utility::Path::mapRead(filename);
+    if(mapped && !mapped->isEmpty()) {
+        Containers::Pointer<State> state = parse(*mapped);
+        if(!state) return;
+
+        state->mapped = *Utility::move(mapped);
+        _state = Utility::move(state);
+        return;
+    }
+    #endif
+
+    AbstractImporter::doOpenFile(filename);
+}
+
+Containers::Pointer<WavImporter::State> WavImporter::parse(const Containers::ArrayView<const char> data) {
     /* Check file size */
     if(data.size() < sizeof(WavHeaderChunk) + sizeof(WavFormatChunk) + sizeof(RiffChunk)) {
         Error() << "Audio::WavImporter::openData(): the file is too short:" << data.size() << "bytes";
-        return;
+        return {};
     }
 
     /* Get the RIFF/WAV header */
@@ -63,7 +144,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     if((std::strncmp(header.chunk.chunkId, "RIFF", 4) != 0 && std::strncmp(header.chunk.chunkId, "RIFX", 4) != 0) ||
        std::strncmp(header.format, "WAVE", 4) != 0) {
         Error() << "Audio::WavImporter::openData(): the file signature is invalid";
-        return;
+        return {};
     }
 
     /* Check if the file is Big-Endian. While RIFX files are extremely rare,
@@ -78,7 +159,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     if(header.chunk.chunkSize < 36 || header.chunk.chunkSize + 8 != data.size()) {
         Error() << "Audio::WavImporter::openData(): the file has improper size, expected"
                 << header.chunk.chunkSize + 8 << "but got" << data.size();
-        return;
+        return {};
     }
 
     const RiffChunk* dataChunk = nullptr;
@@ -102,7 +183,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
         if(std::strncmp(currChunk->chunkId, "fmt ", 4) == 0) {
             if(formatChunk) {
                 Error() << "Audio::WavImporter::openData(): the file contains too many format chunks";
-                return;
+                return {};
             }
 
             formatChunk = WavFormatChunk{*reinterpret_cast<const WavFormatChunk*>(currChunk)};
@@ -110,7 +191,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
         } else if(std::strncmp(currChunk->chunkId, "data", 4) == 0) {
             if(dataChunk != nullptr) {
                 Error() << "Audio::WavImporter::openData(): the file contains too many data chunks";
-                return;
+                return {};
             }
 
             dataChunk = currChunk;
@@ -122,13 +203,13 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     /* Make sure we actually got a format chunk */
     if(!formatChunk) {
         Error() << "Audio::WavImporter::openData(): the file contains no format chunk";
-        return;
+        return {};
     }
 
     /* Make sure we actually got a data chunk */
     if(dataChunk == nullptr) {
         Error() << "Audio::WavImporter::openData(): the file contains no data chunk";
-        return;
+        return {};
     }
 
     /* Fix endianness on Format chunk */
@@ -140,116 +221,129 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             formatChunk->bitsPerSample);
 
     /* Check PCM format */
+    BufferFormat format;
     if(formatChunk->audioFormat == WavAudioFormat::Pcm) {
         /* Decide about format */
         if(formatChunk->numChannels == 1 && formatChunk->bitsPerSample == 8)
-            _format = BufferFormat::Mono8;
+            format = BufferFormat::Mono8;
         else if(formatChunk->numChannels == 1 && formatChunk->bitsPerSample == 16)
-            _format = BufferFormat::Mono16;
+            format = BufferFormat::Mono16;
         else if(formatChunk->numChannels == 2 && formatChunk->bitsPerSample == 8)
-            _format = BufferFormat::Stereo8;
+            format = BufferFormat::Stereo8;
         else if(formatChunk->numChannels == 2 && formatChunk->bitsPerSample == 16)
-             _format = BufferFormat::Stereo16;
+             format = BufferFormat::Stereo16;
         else {
             Error() << "Audio::WavImporter::openData(): PCM with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Check IEEE Float format */
     } else if(formatChunk->audioFormat == WavAudioFormat::IeeeFloat) {
         if(formatChunk->numChannels == 1 && formatChunk->bitsPerSample == 32)
-            _format = BufferFormat::MonoFloat;
+            format = BufferFormat::MonoFloat;
         else if(formatChunk->numChannels == 2 && formatChunk->bitsPerSample == 32)
-            _format = BufferFormat::StereoFloat;
+            format = BufferFormat::StereoFloat;
         else if(formatChunk->numChannels == 1 && formatChunk->bitsPerSample == 64)
-            _format = BufferFormat::MonoDouble;
+            format = BufferFormat::MonoDouble;
         else if(formatChunk->numChannels == 2 && formatChunk->bitsPerSample == 64)
-            _format = BufferFormat::StereoDouble;
+            format = BufferFormat::StereoDouble;
         else {
             Error() << "Audio::WavImporter::openData(): IEEE with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Check A-Law format */
     } else if(formatChunk->audioFormat == WavAudioFormat::ALaw) {
         if(formatChunk->numChannels == 1)
-            _format = BufferFormat::MonoALaw;
+            format = BufferFormat::MonoALaw;
         else if(formatChunk->numChannels == 2)
-            _format = BufferFormat::StereoALaw;
+            format = BufferFormat::StereoALaw;
         else {
             Error() << "Audio::WavImporter::openData(): ALaw with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Check μ-Law format */
     } else if(formatChunk->audioFormat == WavAudioFormat::MuLaw) {
         if(formatChunk->numChannels == 1)
-            _format = BufferFormat::MonoMuLaw;
+            format = BufferFormat::MonoMuLaw;
         else if(formatChunk->numChannels == 2)
-            _format = BufferFormat::StereoMuLaw;
+            format = BufferFormat::StereoMuLaw;
         else {
             Error() << "Audio::WavImporter::openData(): MuLaw with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Unknown/unimplemented format */
     } else {
         Error() << "Audio::WavImporter::openData(): unsupported format" << formatChunk->audioFormat;
-        return;
+        return {};
     }
 
     /* Size sanity checks */
     if(headerSize + offset > data.size()) {
         Error() << "Audio::WavImporter::openData(): file size doesn't match computed size";
-        return;
+        return {};
     }
 
     /* Format sanity checks */
-    if(formatChunk->blockAlign != formatChunk->numChannels * formatChunk->bitsPerSample / 8 ||
+    if(!formatChunk->blockAlign ||
+       formatChunk->blockAlign != formatChunk->numChannels * formatChunk->bitsPerSample / 8 ||
        formatChunk->byteRate != formatChunk->sampleRate * formatChunk->blockAlign) {
         Error() << "Audio::WavImporter::openData(): the file is corrupted";
-        return;
+        return {};
     }
 
-    /* Save frequency */
-    _frequency = formatChunk->sampleRate;
-
-    /* Copy the data */
-    _data = Containers::Array<char>{NoInit, dataChunkSize};
-    Utility::copy(Containers::arrayView(reinterpret_cast<const char*>(dataChunk + 1), dataChunkSize), *_data);
-
-    /* Fix the data endianness */
-    if(hasBigEndianData != Utility::Endianness::isBigEndian()) {
-        if(formatChunk->bitsPerSample == 16)
-            Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint16_t>(*_data));
-        else if(formatChunk->bitsPerSample == 32)
-            Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint32_t>(*_data));
-        else if(formatChunk->bitsPerSample == 64)
-            Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint64_t>(*_data));
-        else CORRADE_INTERNAL_ASSERT(formatChunk->bitsPerSample == 8);
-    }
+    Containers::Pointer<State> state{InPlaceInit};
+    state->samples = Containers::arrayView(reinterpret_cast<const char*>(dataChunk + 1), dataChunkSize);
+    state->format = format;
+    state->frequency = formatChunk->sampleRate;
+    state->frameSize = formatChunk->blockAlign;
+    state->bitsPerSample = formatChunk->bitsPerSample;
+    state->swapEndianness = hasBigEndianData != Utility::Endianness::isBigEndian();
+    state->frameOffset = 0;
+    return state;
 }
 
-void WavImporter::doClose() { _data = Containers::NullOpt; }
+void WavImporter::doClose() { _state = nullptr; }
 
-BufferFormat WavImporter::doFormat() const { return _format; }
+BufferFormat WavImporter::doFormat() const { return _state->format; }
 
-UnsignedInt WavImporter::doFrequency() const { return _frequency; }
+UnsignedInt WavImporter::doFrequency() const { return _state->frequency; }
 
 Containers::Array<char> WavImporter::doData() {
-    Containers::Array<char> copy{NoInit, _data->size()};
-    Utility::copy(*_data, copy);
+    Containers::Array<char> copy{NoInit, _state->samples.size()};
+    Utility::copy(_state->samples, copy);
+    fixEndianness(copy, _state->bitsPerSample, _state->swapEndianness);
     return copy;
 }
 
+UnsignedInt WavImporter::doFrameSize() const { return _state->frameSize; }
+
+UnsignedLong WavImporter::doFrameCount() const {
+    return _state->samples.size()/_state->frameSize;
+}
+
+UnsignedLong WavImporter::doFrameOffset() const { return _state->frameOffset; }
+
+void WavImporter::doSeekFrame(const UnsignedLong frame) {
+    _state->frameOffset = frame;
+}
+
+void WavImporter::doReadFrames(const Containers::ArrayView<char> out) {
+    Utility::copy(_state->samples.sliceSize(_state->frameOffset*_state->frameSize, out.size()), out);
+    fixEndianness(out, _state->bitsPerSample, _state->swapEndianness);
+    _state->frameOffset += out.size()/_state->frameSize;
+}
+
 }}
 
 CORRADE_PLUGIN_REGISTER(WavAudioImporter, Magnum::Audio::WavImporter,
@@ -31,8 +31,7 @@
  * @brief Class @ref Magnum::Audio::WavImporter
  */
 
-#include <Corrade/Containers/Array.h>
-#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pointer.h>
 
 #include "Magnum/Audio/AbstractImporter.h"
 
@@ -118,6 +117,15 @@ Both Little-Endian files (with a `RIFF` header) and Big-Endian files (with
 a `RIFX` header) are supported, data is converted to machine endian on import.
 
 Multi-channel formats are not supported.
+
+@section Audio-WavImporter-streaming Streaming
+
+The plugin supports @ref ImporterFeature::Streaming. When opening a file via
+@ref openFile(), the file is memory-mapped on platforms that support it and
+@ref readFrames() copies the samples directly from the mapping, converting
+them to machine endian on the fly, so reading long files in chunks doesn't
+need the whole file loaded in memory. Data passed to @ref openData() are not
+guaranteed to stay in scope and thus the data chunk is always copied.
 */
 class MAGNUM_WAVAUDIOIMPORTER_EXPORT WavImporter: public AbstractImporter {
     public:
@@ -127,19 +135,29 @@ class MAGNUM_WAVAUDIOIMPORTER_EXPORT WavImporter: public AbstractImporter {
         /** @brief Plugin manager constructor */
         explicit WavImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
 
+        ~WavImporter();
+
     private:
+        struct State;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL ImporterFeatures doFeatures() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL bool doIsOpened() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL void doOpenData(Containers::ArrayView<const char> data) override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL void doOpenFile(const std::string& filename) override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL void doClose() override;
 
         MAGNUM_WAVAUDIOIMPORTER_LOCAL BufferFormat doFormat() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL UnsignedInt doFrequency() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL Containers::Array<char> doData() override;
 
-        Containers::Optional<Containers::Array<char>> _data;
-        BufferFormat _format;
-        UnsignedInt _frequency;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL UnsignedInt doFrameSize() const override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL UnsignedLong doFrameCount() const override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL UnsignedLong doFrameOffset() const override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL void doSeekFrame(UnsignedLong frame) override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL void doReadFrames(Containers::ArrayView<char> out) override;
+
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL Containers::Pointer<State> parse(Containers::ArrayView<const char> data);
+
+        Containers::Pointer<State> _state;
 };
 
 }}